@@ -0,0 +1,350 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "led_strip.h"
+#include "led_strip_interface.h"
+#include "mock_led_strip.h"
+
+/*
+ * Host harness for the led_strip encoders.
+ *
+ * The RMT backend runs against a mock channel that captures every emitted symbol, the SPI backend against a mock
+ * bus that captures the transmitted buffer. Both waveforms are checked against the datasheet timing of the LED
+ * model (with its +/-150ns tolerance) and decoded back into the pixel bytes.
+ *
+ * Usage: test_led_strip [bench]
+ */
+
+#define TEST_RESOLUTION_HZ  (10 * 1000 * 1000)
+#define TEST_SPI_BIT_NS     400   // SPI backend clocks at 2.5MHz
+#define TEST_TOLERANCE_NS   150
+#define TEST_RESET_MIN_NS   280000
+
+typedef struct {
+    const char *name;
+    uint32_t t0h_ns;
+    uint32_t t0l_ns;
+    uint32_t t1h_ns;
+    uint32_t t1l_ns;
+} golden_timing_t;
+
+static const golden_timing_t s_golden[LED_MODEL_INVALID] = {
+    [LED_MODEL_WS2812] = {"WS2812", 400, 850, 800, 450},
+    [LED_MODEL_SK6812] = {"SK6812", 300, 900, 600, 600},
+};
+
+static int s_failures;
+
+#define CHECK(cond, ...) do {                                   \
+        if (!(cond)) {                                          \
+            printf("  FAIL %s:%d: ", __FILE__, __LINE__);       \
+            printf(__VA_ARGS__);                                \
+            printf("\n");                                       \
+            s_failures++;                                       \
+            return;                                             \
+        }                                                       \
+    } while (0)
+
+static bool within(uint32_t ns, uint32_t golden_ns)
+{
+    return ns + TEST_TOLERANCE_NS >= golden_ns && ns <= golden_ns + TEST_TOLERANCE_NS;
+}
+
+// Checks one bit against the golden timing, returns the decoded bit or -1
+static int decode_bit(const golden_timing_t *golden, uint32_t high_ns, uint32_t low_ns)
+{
+    if (within(high_ns, golden->t0h_ns) && within(low_ns, golden->t0l_ns)) {
+        return 0;
+    }
+    if (within(high_ns, golden->t1h_ns) && within(low_ns, golden->t1l_ns)) {
+        return 1;
+    }
+    return -1;
+}
+
+static void fill_pixels(led_strip_handle_t strip, uint8_t *expected, uint32_t num_leds, uint8_t bytes_per_pixel, unsigned seed)
+{
+    srand(seed);
+    for (uint32_t i = 0; i < num_leds; i++) {
+        uint8_t r = rand(), g = rand(), b = rand(), w = rand();
+        if (bytes_per_pixel == 4) {
+            ESP_ERROR_CHECK(led_strip_set_pixel_rgbw(strip, i, r, g, b, w));
+        } else {
+            ESP_ERROR_CHECK(led_strip_set_pixel(strip, i, r, g, b));
+        }
+        // wire order is GRB(W)
+        uint8_t *px = expected + i * bytes_per_pixel;
+        px[0] = g;
+        px[1] = r;
+        px[2] = b;
+        if (bytes_per_pixel == 4) {
+            px[3] = w;
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------
+ * RMT backend
+ *---------------------------------------------------------------------------*/
+
+static led_strip_handle_t new_rmt_strip(led_model_t model, led_pixel_format_t format, uint32_t num_leds, size_t mem_block_symbols)
+{
+    led_strip_config_t strip_config = {
+        .strip_gpio_num = 0,
+        .max_leds = num_leds,
+        .led_pixel_format = format,
+        .led_model = model,
+    };
+    led_strip_rmt_config_t rmt_config = {
+        .clk_src = RMT_CLK_SRC_DEFAULT,
+        .resolution_hz = TEST_RESOLUTION_HZ,
+        .mem_block_symbols = mem_block_symbols,
+    };
+    led_strip_handle_t strip = NULL;
+    ESP_ERROR_CHECK(led_strip_new_rmt_device(&strip_config, &rmt_config, &strip));
+    return strip;
+}
+
+// led_strip_rmt_obj is private to the RMT backend, the channel handle is its first member after the interface
+static rmt_channel_handle_t rmt_strip_channel(led_strip_handle_t strip)
+{
+    return *(rmt_channel_handle_t *)((char *)strip + sizeof(led_strip_t));
+}
+
+static uint32_t ticks_to_ns(uint32_t ticks)
+{
+    return (uint64_t)ticks * 1000000000 / TEST_RESOLUTION_HZ;
+}
+
+// Checks the captured symbols of one frame against the golden timing and the expected bytes
+static void check_rmt_frame(rmt_channel_handle_t channel, const golden_timing_t *golden, const uint8_t *expected, size_t num_bytes, unsigned frame)
+{
+    CHECK(channel->num_symbols == num_bytes * 8 + 1, "frame %u: %zu symbols, expected %zu", frame, channel->num_symbols, num_bytes * 8 + 1);
+    for (size_t i = 0; i < num_bytes * 8; i++) {
+        rmt_symbol_word_t sym = channel->symbols[i];
+        CHECK(sym.level0 == 1 && sym.level1 == 0, "frame %u: symbol %zu has wrong levels", frame, i);
+        int bit = decode_bit(golden, ticks_to_ns(sym.duration0), ticks_to_ns(sym.duration1));
+        CHECK(bit >= 0, "frame %u: symbol %zu (%u/%uns) out of %s spec", frame, i,
+              ticks_to_ns(sym.duration0), ticks_to_ns(sym.duration1), golden->name);
+        int expected_bit = (expected[i / 8] >> (7 - i % 8)) & 1;
+        CHECK(bit == expected_bit, "frame %u: bit %zu is %d, expected %d", frame, i, bit, expected_bit);
+    }
+    rmt_symbol_word_t reset = channel->symbols[num_bytes * 8];
+    CHECK(reset.level0 == 0 && reset.level1 == 0, "frame %u: reset code is not low", frame);
+    CHECK(ticks_to_ns(reset.duration0 + reset.duration1) >= TEST_RESET_MIN_NS, "frame %u: reset code too short", frame);
+}
+
+static void test_rmt_waveform(led_model_t model, led_pixel_format_t format, uint32_t num_leds, size_t mem_block_symbols)
+{
+    const golden_timing_t *golden = &s_golden[model];
+    uint8_t bytes_per_pixel = format == LED_PIXEL_FORMAT_GRBW ? 4 : 3;
+    size_t num_bytes = num_leds * bytes_per_pixel;
+    printf("rmt  %-6s %-4s leds=%-4u mem_block=%-3zu\n", golden->name, bytes_per_pixel == 4 ? "GRBW" : "GRB", num_leds, mem_block_symbols);
+
+    led_strip_handle_t strip = new_rmt_strip(model, format, num_leds, mem_block_symbols);
+    rmt_channel_handle_t channel = rmt_strip_channel(strip);
+    uint8_t *expected = calloc(1, num_bytes);
+    // two frames in a row, the encoder must go back to its initial state in between
+    for (unsigned frame = 0; frame < 2; frame++) {
+        fill_pixels(strip, expected, num_leds, bytes_per_pixel, num_leds * 31 + frame);
+        mock_rmt_channel_clear(channel);
+        ESP_ERROR_CHECK(led_strip_refresh(strip));
+        check_rmt_frame(channel, golden, expected, num_bytes, frame);
+    }
+    free(expected);
+    ESP_ERROR_CHECK(led_strip_del(strip));
+}
+
+#define TEST_GROUP_STRIPS 3
+
+static void test_rmt_group(void)
+{
+    static const led_strip_config_t configs[TEST_GROUP_STRIPS] = {
+        {.strip_gpio_num = 0, .max_leds = 60, .led_pixel_format = LED_PIXEL_FORMAT_GRB, .led_model = LED_MODEL_WS2812},
+        {.strip_gpio_num = 1, .max_leds = 7, .led_pixel_format = LED_PIXEL_FORMAT_GRBW, .led_model = LED_MODEL_SK6812},
+        {.strip_gpio_num = 2, .max_leds = 300, .led_pixel_format = LED_PIXEL_FORMAT_GRB, .led_model = LED_MODEL_WS2812},
+    };
+    printf("rmt  group of %d strips\n", TEST_GROUP_STRIPS);
+
+    led_strip_rmt_config_t rmt_config = {
+        .clk_src = RMT_CLK_SRC_DEFAULT,
+        .resolution_hz = TEST_RESOLUTION_HZ,
+        .mem_block_symbols = 48,
+    };
+    led_strip_rmt_group_handle_t group = NULL;
+    ESP_ERROR_CHECK(led_strip_new_rmt_group(configs, TEST_GROUP_STRIPS, &rmt_config, &group));
+
+    led_strip_handle_t strips[TEST_GROUP_STRIPS];
+    rmt_channel_handle_t channels[TEST_GROUP_STRIPS];
+    uint8_t *expected[TEST_GROUP_STRIPS];
+    for (size_t s = 0; s < TEST_GROUP_STRIPS; s++) {
+        ESP_ERROR_CHECK(led_strip_rmt_group_get_strip(group, s, &strips[s]));
+        channels[s] = rmt_strip_channel(strips[s]);
+        expected[s] = calloc(1, configs[s].max_leds * 4);
+    }
+    rmt_sync_manager_handle_t synchro = channels[0]->synchro;
+    CHECK(synchro && synchro->num_channels == TEST_GROUP_STRIPS, "channels are not synchronized");
+
+    // the first frame through the group, the second one through a member strip
+    for (unsigned frame = 0; frame < 2; frame++) {
+        for (size_t s = 0; s < TEST_GROUP_STRIPS; s++) {
+            uint8_t bytes_per_pixel = configs[s].led_pixel_format == LED_PIXEL_FORMAT_GRBW ? 4 : 3;
+            fill_pixels(strips[s], expected[s], configs[s].max_leds, bytes_per_pixel, s * 7 + frame);
+            mock_rmt_channel_clear(channels[s]);
+        }
+        if (frame == 0) {
+            ESP_ERROR_CHECK(led_strip_rmt_group_refresh(group));
+        } else {
+            ESP_ERROR_CHECK(led_strip_refresh(strips[1]));
+        }
+        CHECK(synchro->resets == frame + 1, "frame %u: sync manager reset %zu times", frame, synchro->resets);
+        for (size_t s = 0; s < TEST_GROUP_STRIPS; s++) {
+            uint8_t bytes_per_pixel = configs[s].led_pixel_format == LED_PIXEL_FORMAT_GRBW ? 4 : 3;
+            // the channels stay enabled between refreshes
+            CHECK(channels[s]->enabled, "frame %u: channel %zu got disabled", frame, s);
+            check_rmt_frame(channels[s], &s_golden[configs[s].led_model], expected[s], configs[s].max_leds * bytes_per_pixel, frame);
+        }
+    }
+
+    CHECK(led_strip_del(strips[0]) == ESP_ERR_INVALID_STATE, "a member strip was deleted on its own");
+    for (size_t s = 0; s < TEST_GROUP_STRIPS; s++) {
+        free(expected[s]);
+    }
+    // the mock refuses to delete channels that are still enabled or synchronized
+    ESP_ERROR_CHECK(led_strip_rmt_group_del(group));
+}
+
+/*----------------------------------------------------------------------------
+ * SPI backend
+ *---------------------------------------------------------------------------*/
+
+static led_strip_handle_t new_spi_strip(led_model_t model, led_pixel_format_t format, uint32_t num_leds)
+{
+    led_strip_config_t strip_config = {
+        .strip_gpio_num = 0,
+        .max_leds = num_leds,
+        .led_pixel_format = format,
+        .led_model = model,
+    };
+    led_strip_spi_config_t spi_config = {
+        .clk_src = SPI_CLK_SRC_DEFAULT,
+        .spi_bus = SPI2_HOST,
+        .flags.with_dma = true,
+    };
+    led_strip_handle_t strip = NULL;
+    ESP_ERROR_CHECK(led_strip_new_spi_device(&strip_config, &spi_config, &strip));
+    return strip;
+}
+
+static void test_spi_waveform(led_model_t model, led_pixel_format_t format, uint32_t num_leds)
+{
+    const golden_timing_t *golden = &s_golden[model];
+    uint8_t bytes_per_pixel = format == LED_PIXEL_FORMAT_GRBW ? 4 : 3;
+    size_t num_bytes = num_leds * bytes_per_pixel;
+    printf("spi  %-6s %-4s leds=%-4u\n", golden->name, bytes_per_pixel == 4 ? "GRBW" : "GRB", num_leds);
+
+    led_strip_handle_t strip = new_spi_strip(model, format, num_leds);
+    uint8_t *expected = calloc(1, num_bytes);
+    fill_pixels(strip, expected, num_leds, bytes_per_pixel, num_leds * 17);
+    ESP_ERROR_CHECK(led_strip_refresh(strip));
+
+    size_t tx_bytes = 0;
+    const uint8_t *tx = mock_spi_get_last_tx(&tx_bytes);
+    CHECK(tx_bytes == num_bytes * 3, "%zu bytes on the bus, expected %zu", tx_bytes, num_bytes * 3);
+    // walk the MSB first bit stream, every color bit is a high run followed by a low run
+    size_t total_bits = tx_bytes * 8;
+    size_t pos = 0;
+    for (size_t i = 0; i < num_bytes * 8; i++) {
+        uint32_t high = 0, low = 0;
+        while (pos < total_bits && (tx[pos / 8] >> (7 - pos % 8)) & 1) {
+            high++;
+            pos++;
+        }
+        while (pos < total_bits && !((tx[pos / 8] >> (7 - pos % 8)) & 1) && (high + low) < 3) {
+            low++;
+            pos++;
+        }
+        int bit = decode_bit(golden, high * TEST_SPI_BIT_NS, low * TEST_SPI_BIT_NS);
+        CHECK(bit >= 0, "bit %zu (%u/%uns) out of %s spec", i, high * TEST_SPI_BIT_NS, low * TEST_SPI_BIT_NS, golden->name);
+        int expected_bit = (expected[i / 8] >> (7 - i % 8)) & 1;
+        CHECK(bit == expected_bit, "bit %zu is %d, expected %d", i, bit, expected_bit);
+    }
+    free(expected);
+    ESP_ERROR_CHECK(led_strip_del(strip));
+}
+
+/*----------------------------------------------------------------------------
+ * Benchmark
+ *---------------------------------------------------------------------------*/
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void bench(void)
+{
+    static const uint32_t lengths[] = {1, 16, 144, 300, 1024};
+    printf("\n%-6s %10s %16s %16s %16s\n", "leds", "backend", "encode ns/LED", "refills/frame", "avg ns/refill");
+    for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+        uint32_t num_leds = lengths[l];
+        uint32_t iterations = 2000000 / num_leds + 10;
+
+        led_strip_handle_t strip = new_rmt_strip(LED_MODEL_WS2812, LED_PIXEL_FORMAT_GRB, num_leds, 64);
+        rmt_channel_handle_t channel = rmt_strip_channel(strip);
+        channel->capture = false;
+        for (uint32_t i = 0; i < num_leds; i++) {
+            ESP_ERROR_CHECK(led_strip_set_pixel(strip, i, i, i * 3, i * 7));
+        }
+        led_strip_rmt_encoder_stats_t stats;
+        ESP_ERROR_CHECK(led_strip_rmt_get_encoder_stats(strip, &stats, true));
+        uint64_t start = now_ns();
+        for (uint32_t it = 0; it < iterations; it++) {
+            ESP_ERROR_CHECK(led_strip_refresh(strip));
+        }
+        uint64_t elapsed = now_ns() - start;
+        ESP_ERROR_CHECK(led_strip_rmt_get_encoder_stats(strip, &stats, true));
+        // the mock reports cycles in nanoseconds
+        printf("%-6u %10s %16.1f %16zu %16.1f\n", num_leds, "rmt", (double)elapsed / iterations / num_leds,
+               channel->refills, stats.refills ? (double)stats.total_cycles / stats.refills : 0.0);
+        ESP_ERROR_CHECK(led_strip_del(strip));
+
+        // the SPI backend encodes in set_pixel, the refresh is just a DMA transaction
+        strip = new_spi_strip(LED_MODEL_WS2812, LED_PIXEL_FORMAT_GRB, num_leds);
+        start = now_ns();
+        for (uint32_t it = 0; it < iterations; it++) {
+            for (uint32_t i = 0; i < num_leds; i++) {
+                ESP_ERROR_CHECK(led_strip_set_pixel(strip, i, i + it, i * 3, i * 7));
+            }
+        }
+        elapsed = now_ns() - start;
+        printf("%-6u %10s %16.1f %16s %16s\n", num_leds, "spi", (double)elapsed / iterations / num_leds, "-", "-");
+        ESP_ERROR_CHECK(led_strip_del(strip));
+    }
+}
+
+int main(int argc, char **argv)
+{
+    static const uint32_t lengths[] = {1, 7, 60, 300};
+    static const size_t mem_blocks[] = {64, 48};
+    for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+        for (size_t m = 0; m < sizeof(mem_blocks) / sizeof(mem_blocks[0]); m++) {
+            test_rmt_waveform(LED_MODEL_WS2812, LED_PIXEL_FORMAT_GRB, lengths[l], mem_blocks[m]);
+            test_rmt_waveform(LED_MODEL_SK6812, LED_PIXEL_FORMAT_GRBW, lengths[l], mem_blocks[m]);
+        }
+        // the SPI backend has fixed WS2812 timing, its 800ns T1H is out of the SK6812 spec
+        test_spi_waveform(LED_MODEL_WS2812, LED_PIXEL_FORMAT_GRB, lengths[l]);
+        test_spi_waveform(LED_MODEL_WS2812, LED_PIXEL_FORMAT_GRBW, lengths[l]);
+    }
+    test_rmt_group();
+
+    if (argc > 1 && strcmp(argv[1], "bench") == 0) {
+        bench();
+    }
+
+    printf("\n%s (%d failures)\n", s_failures ? "FAILED" : "PASSED", s_failures);
+    return s_failures ? 1 : 0;
+}
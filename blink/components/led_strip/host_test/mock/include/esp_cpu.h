@@ -0,0 +1,6 @@
+#pragma once
+
+#include <stdint.h>
+
+// Nanoseconds of the host monotonic clock, good enough to profile the encoder
+uint32_t esp_cpu_get_cycle_count(void);
@@ -0,0 +1,12 @@
+#pragma once
+
+// Force-included into every translation unit of the host test, fills the gaps between glibc and newlib/ESP-IDF
+
+#include <stddef.h>
+#include <assert.h>
+
+#ifndef __containerof
+#define __containerof(ptr, type, member) ((type *)((char *)(ptr) - offsetof(type, member)))
+#endif
+
+#define BIT(nr) (1UL << (nr))
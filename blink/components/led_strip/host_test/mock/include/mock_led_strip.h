@@ -0,0 +1,68 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "driver/rmt_tx.h"
+#include "driver/spi_master.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Mock RMT TX channel
+ *
+ * Models the ping-pong memory block of a non-DMA channel: the first encoder call may fill the whole block,
+ * every following refill gets half of it. Everything the encoders write is appended to `symbols`.
+ */
+struct rmt_channel_t {
+    size_t mem_block_symbols;
+    uint32_t resolution_hz;
+    bool enabled;
+    rmt_symbol_word_t *window;  // free space handed to the encoder in the current refill
+    size_t window_size;
+    size_t window_used;
+    bool capture;               // append the encoded symbols to `symbols`, disable for benchmarks
+    rmt_symbol_word_t *symbols;
+    size_t num_symbols;
+    size_t symbols_cap;
+    size_t refills;             // encoder invocations of the last transaction
+    rmt_sync_manager_handle_t synchro; // sync manager the channel is tied to
+};
+
+/**
+ * @brief Mock RMT sync manager, ties enabled TX channels together
+ */
+struct rmt_sync_manager_t {
+    size_t num_channels;
+    size_t resets;              // calls of `rmt_sync_reset`
+    rmt_channel_handle_t channels[];
+};
+
+/**
+ * @brief Reserve space in the current refill window of a mock channel
+ *
+ * @param[in] channel Mock channel
+ * @param[out] free_symbols Number of free symbols left in the window
+ * @return Pointer to the first free symbol
+ */
+rmt_symbol_word_t *mock_rmt_channel_get_space(rmt_channel_handle_t channel, size_t *free_symbols);
+
+/**
+ * @brief Mark symbols written through `mock_rmt_channel_get_space` as used
+ */
+void mock_rmt_channel_commit(rmt_channel_handle_t channel, size_t num_symbols);
+
+/**
+ * @brief Drop all captured symbols of a mock channel
+ */
+void mock_rmt_channel_clear(rmt_channel_handle_t channel);
+
+/**
+ * @brief Last buffer sent by `spi_device_transmit`, with its length in bytes
+ */
+const uint8_t *mock_spi_get_last_tx(size_t *num_bytes);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,4 @@
+#pragma once
+
+#define SOC_RMT_TX_CANDIDATES_PER_GROUP 4
+#define SOC_RMT_SUPPORT_TX_SYNCHRO      1
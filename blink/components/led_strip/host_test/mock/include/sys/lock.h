@@ -0,0 +1,15 @@
+#pragma once
+
+// newlib locks, the host test is single threaded
+
+typedef int _lock_t;
+
+static inline void _lock_acquire(_lock_t *lock)
+{
+    (void)lock;
+}
+
+static inline void _lock_release(_lock_t *lock)
+{
+    (void)lock;
+}
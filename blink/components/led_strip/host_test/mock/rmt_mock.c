@@ -0,0 +1,404 @@
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <assert.h>
+#include "esp_check.h"
+#include "esp_cpu.h"
+#include "mock_led_strip.h"
+
+static const char *TAG = "rmt_mock";
+
+uint32_t esp_cpu_get_cycle_count(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
+
+/*----------------------------------------------------------------------------
+ * Channel
+ *---------------------------------------------------------------------------*/
+
+rmt_symbol_word_t *mock_rmt_channel_get_space(rmt_channel_handle_t channel, size_t *free_symbols)
+{
+    *free_symbols = channel->window_size - channel->window_used;
+    return channel->window + channel->window_used;
+}
+
+void mock_rmt_channel_commit(rmt_channel_handle_t channel, size_t num_symbols)
+{
+    assert(channel->window_used + num_symbols <= channel->window_size);
+    if (channel->capture) {
+        if (channel->num_symbols + num_symbols > channel->symbols_cap) {
+            channel->symbols_cap = (channel->num_symbols + num_symbols) * 2;
+            channel->symbols = realloc(channel->symbols, channel->symbols_cap * sizeof(rmt_symbol_word_t));
+            assert(channel->symbols);
+        }
+        memcpy(channel->symbols + channel->num_symbols, channel->window + channel->window_used, num_symbols * sizeof(rmt_symbol_word_t));
+        channel->num_symbols += num_symbols;
+    }
+    channel->window_used += num_symbols;
+}
+
+void mock_rmt_channel_clear(rmt_channel_handle_t channel)
+{
+    channel->num_symbols = 0;
+}
+
+esp_err_t rmt_new_tx_channel(const rmt_tx_channel_config_t *config, rmt_channel_handle_t *ret_chan)
+{
+    ESP_RETURN_ON_FALSE(config && ret_chan && config->mem_block_symbols >= 2, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    rmt_channel_handle_t channel = calloc(1, sizeof(struct rmt_channel_t));
+    ESP_RETURN_ON_FALSE(channel, ESP_ERR_NO_MEM, TAG, "no mem for channel");
+    channel->window = calloc(config->mem_block_symbols, sizeof(rmt_symbol_word_t));
+    if (!channel->window) {
+        free(channel);
+        return ESP_ERR_NO_MEM;
+    }
+    channel->mem_block_symbols = config->mem_block_symbols;
+    channel->resolution_hz = config->resolution_hz;
+    channel->capture = true;
+    *ret_chan = channel;
+    return ESP_OK;
+}
+
+esp_err_t rmt_del_channel(rmt_channel_handle_t channel)
+{
+    ESP_RETURN_ON_FALSE(channel, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(!channel->enabled, ESP_ERR_INVALID_STATE, TAG, "channel not in init state");
+    ESP_RETURN_ON_FALSE(!channel->synchro, ESP_ERR_INVALID_STATE, TAG, "channel still in a sync manager");
+    free(channel->symbols);
+    free(channel->window);
+    free(channel);
+    return ESP_OK;
+}
+
+esp_err_t rmt_enable(rmt_channel_handle_t channel)
+{
+    ESP_RETURN_ON_FALSE(channel && !channel->enabled, ESP_ERR_INVALID_STATE, TAG, "channel not in init state");
+    channel->enabled = true;
+    return ESP_OK;
+}
+
+esp_err_t rmt_disable(rmt_channel_handle_t channel)
+{
+    ESP_RETURN_ON_FALSE(channel && channel->enabled, ESP_ERR_INVALID_STATE, TAG, "channel not enabled");
+    channel->enabled = false;
+    return ESP_OK;
+}
+
+esp_err_t rmt_transmit(rmt_channel_handle_t channel, rmt_encoder_handle_t encoder, const void *payload, size_t payload_bytes, const rmt_transmit_config_t *config)
+{
+    ESP_RETURN_ON_FALSE(channel && encoder && config, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(channel->enabled, ESP_ERR_INVALID_STATE, TAG, "channel not enabled");
+    // the driver primes the whole memory block, then the ISR refills one half whenever the other half is sent out
+    size_t window = channel->mem_block_symbols;
+    channel->refills = 0;
+    for (;;) {
+        rmt_encode_state_t state = RMT_ENCODING_RESET;
+        channel->window_size = window;
+        channel->window_used = 0;
+        encoder->encode(encoder, channel, payload, payload_bytes, &state);
+        channel->refills++;
+        if (state & RMT_ENCODING_COMPLETE) {
+            return ESP_OK;
+        }
+        // an encoder that yields must have filled the window, otherwise the hardware would run dry
+        ESP_RETURN_ON_FALSE(state & RMT_ENCODING_MEM_FULL, ESP_FAIL, TAG, "encoder yielded without filling the memory");
+        ESP_RETURN_ON_FALSE(channel->window_used == channel->window_size, ESP_FAIL, TAG,
+                            "encoder left %zu symbols free", channel->window_size - channel->window_used);
+        window = channel->mem_block_symbols / 2;
+    }
+}
+
+esp_err_t rmt_tx_wait_all_done(rmt_channel_handle_t channel, int timeout_ms)
+{
+    (void)timeout_ms;
+    ESP_RETURN_ON_FALSE(channel, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    return ESP_OK;
+}
+
+/*----------------------------------------------------------------------------
+ * Sync manager
+ *---------------------------------------------------------------------------*/
+
+esp_err_t rmt_new_sync_manager(const rmt_sync_manager_config_t *config, rmt_sync_manager_handle_t *ret_synchro)
+{
+    ESP_RETURN_ON_FALSE(config && ret_synchro && config->tx_channel_array && config->array_size, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    // like the driver, only channels that are enabled and not yet synchronized can be tied together
+    for (size_t i = 0; i < config->array_size; i++) {
+        rmt_channel_handle_t channel = config->tx_channel_array[i];
+        ESP_RETURN_ON_FALSE(channel->enabled, ESP_ERR_INVALID_STATE, TAG, "channel %zu not enabled", i);
+        ESP_RETURN_ON_FALSE(!channel->synchro, ESP_ERR_INVALID_STATE, TAG, "channel %zu already synchronized", i);
+    }
+    rmt_sync_manager_handle_t synchro = calloc(1, sizeof(struct rmt_sync_manager_t) + config->array_size * sizeof(rmt_channel_handle_t));
+    ESP_RETURN_ON_FALSE(synchro, ESP_ERR_NO_MEM, TAG, "no mem for sync manager");
+    for (size_t i = 0; i < config->array_size; i++) {
+        synchro->channels[i] = config->tx_channel_array[i];
+        synchro->channels[i]->synchro = synchro;
+    }
+    synchro->num_channels = config->array_size;
+    *ret_synchro = synchro;
+    return ESP_OK;
+}
+
+esp_err_t rmt_del_sync_manager(rmt_sync_manager_handle_t synchro)
+{
+    ESP_RETURN_ON_FALSE(synchro, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    for (size_t i = 0; i < synchro->num_channels; i++) {
+        synchro->channels[i]->synchro = NULL;
+    }
+    free(synchro);
+    return ESP_OK;
+}
+
+esp_err_t rmt_sync_reset(rmt_sync_manager_handle_t synchro)
+{
+    ESP_RETURN_ON_FALSE(synchro, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    synchro->resets++;
+    return ESP_OK;
+}
+
+/*----------------------------------------------------------------------------
+ * Encoders, modelled after esp_driver_rmt
+ *---------------------------------------------------------------------------*/
+
+typedef struct {
+    rmt_encoder_t base;
+    rmt_symbol_word_t bit0;
+    rmt_symbol_word_t bit1;
+    bool msb_first;
+    size_t last_byte_index;
+    size_t last_bit_index;
+} mock_bytes_encoder_t;
+
+static size_t mock_encode_bytes(rmt_encoder_t *encoder, rmt_channel_handle_t channel, const void *primary_data, size_t data_size, rmt_encode_state_t *ret_state)
+{
+    mock_bytes_encoder_t *bytes_encoder = __containerof(encoder, mock_bytes_encoder_t, base);
+    const uint8_t *data = primary_data;
+    rmt_encode_state_t state = RMT_ENCODING_RESET;
+    size_t free_symbols = 0;
+    rmt_symbol_word_t *symbols = mock_rmt_channel_get_space(channel, &free_symbols);
+    size_t encoded_symbols = 0;
+    while (bytes_encoder->last_byte_index < data_size) {
+        if (encoded_symbols == free_symbols) {
+            state |= RMT_ENCODING_MEM_FULL;
+            break;
+        }
+        uint8_t byte = data[bytes_encoder->last_byte_index];
+        size_t bit = bytes_encoder->last_bit_index;
+        bool one = bytes_encoder->msb_first ? byte & (0x80 >> bit) : byte & (1 << bit);
+        symbols[encoded_symbols++] = one ? bytes_encoder->bit1 : bytes_encoder->bit0;
+        if (++bytes_encoder->last_bit_index == 8) {
+            bytes_encoder->last_bit_index = 0;
+            bytes_encoder->last_byte_index++;
+        }
+    }
+    if (bytes_encoder->last_byte_index == data_size) {
+        bytes_encoder->last_byte_index = 0;
+        state |= RMT_ENCODING_COMPLETE;
+        if (encoded_symbols == free_symbols) {
+            state |= RMT_ENCODING_MEM_FULL;
+        }
+    }
+    mock_rmt_channel_commit(channel, encoded_symbols);
+    *ret_state = state;
+    return encoded_symbols;
+}
+
+static esp_err_t mock_reset_bytes_encoder(rmt_encoder_t *encoder)
+{
+    mock_bytes_encoder_t *bytes_encoder = __containerof(encoder, mock_bytes_encoder_t, base);
+    bytes_encoder->last_byte_index = 0;
+    bytes_encoder->last_bit_index = 0;
+    return ESP_OK;
+}
+
+static esp_err_t mock_del_bytes_encoder(rmt_encoder_t *encoder)
+{
+    free(__containerof(encoder, mock_bytes_encoder_t, base));
+    return ESP_OK;
+}
+
+esp_err_t rmt_new_bytes_encoder(const rmt_bytes_encoder_config_t *config, rmt_encoder_handle_t *ret_encoder)
+{
+    ESP_RETURN_ON_FALSE(config && ret_encoder, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    mock_bytes_encoder_t *bytes_encoder = calloc(1, sizeof(mock_bytes_encoder_t));
+    ESP_RETURN_ON_FALSE(bytes_encoder, ESP_ERR_NO_MEM, TAG, "no mem for bytes encoder");
+    bytes_encoder->base.encode = mock_encode_bytes;
+    bytes_encoder->base.reset = mock_reset_bytes_encoder;
+    bytes_encoder->base.del = mock_del_bytes_encoder;
+    bytes_encoder->bit0 = config->bit0;
+    bytes_encoder->bit1 = config->bit1;
+    bytes_encoder->msb_first = config->flags.msb_first;
+    *ret_encoder = &bytes_encoder->base;
+    return ESP_OK;
+}
+
+typedef struct {
+    rmt_encoder_t base;
+    size_t last_symbol_index;
+} mock_copy_encoder_t;
+
+static size_t mock_encode_copy(rmt_encoder_t *encoder, rmt_channel_handle_t channel, const void *primary_data, size_t data_size, rmt_encode_state_t *ret_state)
+{
+    mock_copy_encoder_t *copy_encoder = __containerof(encoder, mock_copy_encoder_t, base);
+    const rmt_symbol_word_t *src = primary_data;
+    size_t num_symbols = data_size / sizeof(rmt_symbol_word_t);
+    rmt_encode_state_t state = RMT_ENCODING_RESET;
+    size_t free_symbols = 0;
+    rmt_symbol_word_t *symbols = mock_rmt_channel_get_space(channel, &free_symbols);
+    size_t len = num_symbols - copy_encoder->last_symbol_index;
+    if (len > free_symbols) {
+        len = free_symbols;
+    }
+    memcpy(symbols, src + copy_encoder->last_symbol_index, len * sizeof(rmt_symbol_word_t));
+    copy_encoder->last_symbol_index += len;
+    if (copy_encoder->last_symbol_index == num_symbols) {
+        copy_encoder->last_symbol_index = 0;
+        state |= RMT_ENCODING_COMPLETE;
+    }
+    if (len == free_symbols) {
+        state |= RMT_ENCODING_MEM_FULL;
+    }
+    mock_rmt_channel_commit(channel, len);
+    *ret_state = state;
+    return len;
+}
+
+static esp_err_t mock_reset_copy_encoder(rmt_encoder_t *encoder)
+{
+    __containerof(encoder, mock_copy_encoder_t, base)->last_symbol_index = 0;
+    return ESP_OK;
+}
+
+static esp_err_t mock_del_copy_encoder(rmt_encoder_t *encoder)
+{
+    free(__containerof(encoder, mock_copy_encoder_t, base));
+    return ESP_OK;
+}
+
+esp_err_t rmt_new_copy_encoder(const rmt_copy_encoder_config_t *config, rmt_encoder_handle_t *ret_encoder)
+{
+    ESP_RETURN_ON_FALSE(config && ret_encoder, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    mock_copy_encoder_t *copy_encoder = calloc(1, sizeof(mock_copy_encoder_t));
+    ESP_RETURN_ON_FALSE(copy_encoder, ESP_ERR_NO_MEM, TAG, "no mem for copy encoder");
+    copy_encoder->base.encode = mock_encode_copy;
+    copy_encoder->base.reset = mock_reset_copy_encoder;
+    copy_encoder->base.del = mock_del_copy_encoder;
+    *ret_encoder = &copy_encoder->base;
+    return ESP_OK;
+}
+
+typedef struct {
+    rmt_encoder_t base;
+    rmt_encode_simple_cb_t callback;
+    void *arg;
+    size_t min_chunk_size;
+    size_t symbols_written;
+    bool done;
+    // symbols the callback produced into the overflow buffer that didn't fit into the memory block yet
+    rmt_symbol_word_t *ovf_buf;
+    size_t ovf_len;
+    size_t ovf_pos;
+} mock_simple_encoder_t;
+
+static size_t mock_encode_simple(rmt_encoder_t *encoder, rmt_channel_handle_t channel, const void *primary_data, size_t data_size, rmt_encode_state_t *ret_state)
+{
+    mock_simple_encoder_t *simple_encoder = __containerof(encoder, mock_simple_encoder_t, base);
+    size_t encoded_symbols = 0;
+    size_t free_symbols = 0;
+    rmt_symbol_word_t *symbols = mock_rmt_channel_get_space(channel, &free_symbols);
+
+    // drain what is left in the overflow buffer first
+    while (simple_encoder->ovf_pos < simple_encoder->ovf_len && encoded_symbols < free_symbols) {
+        symbols[encoded_symbols++] = simple_encoder->ovf_buf[simple_encoder->ovf_pos++];
+    }
+    // like the real simple encoder, keep calling back until the memory block is exactly full
+    while (!simple_encoder->done && encoded_symbols < free_symbols) {
+        size_t room = free_symbols - encoded_symbols;
+        size_t len;
+        if (room >= simple_encoder->min_chunk_size) {
+            len = simple_encoder->callback(primary_data, data_size, simple_encoder->symbols_written, room,
+                                           symbols + encoded_symbols, &simple_encoder->done, simple_encoder->arg);
+            assert(len <= room);
+            if (len == 0) {
+                ESP_LOGE(TAG, "encoder callback returned 0 symbols with %zu free", room);
+                abort();
+            }
+            encoded_symbols += len;
+        } else {
+            len = simple_encoder->callback(primary_data, data_size, simple_encoder->symbols_written, simple_encoder->min_chunk_size,
+                                           simple_encoder->ovf_buf, &simple_encoder->done, simple_encoder->arg);
+            simple_encoder->ovf_len = len;
+            simple_encoder->ovf_pos = 0;
+            while (simple_encoder->ovf_pos < simple_encoder->ovf_len && encoded_symbols < free_symbols) {
+                symbols[encoded_symbols++] = simple_encoder->ovf_buf[simple_encoder->ovf_pos++];
+            }
+        }
+        simple_encoder->symbols_written += len;
+    }
+    mock_rmt_channel_commit(channel, encoded_symbols);
+
+    rmt_encode_state_t state = RMT_ENCODING_RESET;
+    if (simple_encoder->done && simple_encoder->ovf_pos == simple_encoder->ovf_len) {
+        state |= RMT_ENCODING_COMPLETE;
+        simple_encoder->done = false;
+        simple_encoder->symbols_written = 0;
+        simple_encoder->ovf_len = simple_encoder->ovf_pos = 0;
+    }
+    if (encoded_symbols == free_symbols) {
+        state |= RMT_ENCODING_MEM_FULL;
+    }
+    *ret_state = state;
+    return encoded_symbols;
+}
+
+static esp_err_t mock_reset_simple_encoder(rmt_encoder_t *encoder)
+{
+    mock_simple_encoder_t *simple_encoder = __containerof(encoder, mock_simple_encoder_t, base);
+    simple_encoder->done = false;
+    simple_encoder->symbols_written = 0;
+    simple_encoder->ovf_len = simple_encoder->ovf_pos = 0;
+    return ESP_OK;
+}
+
+static esp_err_t mock_del_simple_encoder(rmt_encoder_t *encoder)
+{
+    mock_simple_encoder_t *simple_encoder = __containerof(encoder, mock_simple_encoder_t, base);
+    free(simple_encoder->ovf_buf);
+    free(simple_encoder);
+    return ESP_OK;
+}
+
+esp_err_t rmt_new_simple_encoder(const rmt_simple_encoder_config_t *config, rmt_encoder_handle_t *ret_encoder)
+{
+    ESP_RETURN_ON_FALSE(config && config->callback && ret_encoder, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    mock_simple_encoder_t *simple_encoder = calloc(1, sizeof(mock_simple_encoder_t));
+    ESP_RETURN_ON_FALSE(simple_encoder, ESP_ERR_NO_MEM, TAG, "no mem for simple encoder");
+    simple_encoder->min_chunk_size = config->min_chunk_size ? config->min_chunk_size : 64;
+    simple_encoder->ovf_buf = calloc(simple_encoder->min_chunk_size, sizeof(rmt_symbol_word_t));
+    if (!simple_encoder->ovf_buf) {
+        free(simple_encoder);
+        return ESP_ERR_NO_MEM;
+    }
+    simple_encoder->base.encode = mock_encode_simple;
+    simple_encoder->base.reset = mock_reset_simple_encoder;
+    simple_encoder->base.del = mock_del_simple_encoder;
+    simple_encoder->callback = config->callback;
+    simple_encoder->arg = config->arg;
+    *ret_encoder = &simple_encoder->base;
+    return ESP_OK;
+}
+
+esp_err_t rmt_del_encoder(rmt_encoder_handle_t encoder)
+{
+    ESP_RETURN_ON_FALSE(encoder, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    return encoder->del(encoder);
+}
+
+esp_err_t rmt_encoder_reset(rmt_encoder_handle_t encoder)
+{
+    ESP_RETURN_ON_FALSE(encoder, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    return encoder->reset(encoder);
+}
@@ -0,0 +1,67 @@
+#include <stdlib.h>
+#include "esp_check.h"
+#include "soc/spi_periph.h"
+#include "mock_led_strip.h"
+
+#define MOCK_SPI_CLOCK_KHZ 2500
+
+static const char *TAG = "spi_mock";
+
+const spi_signal_conn_t spi_periph_signal[3];
+
+struct spi_device_t {
+    spi_host_device_t host;
+};
+
+static const uint8_t *s_last_tx;
+static size_t s_last_tx_bytes;
+
+const uint8_t *mock_spi_get_last_tx(size_t *num_bytes)
+{
+    *num_bytes = s_last_tx_bytes;
+    return s_last_tx;
+}
+
+esp_err_t spi_bus_initialize(spi_host_device_t host_id, const spi_bus_config_t *bus_config, spi_dma_chan_t dma_chan)
+{
+    (void)dma_chan;
+    ESP_RETURN_ON_FALSE(bus_config, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_free(spi_host_device_t host_id)
+{
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_add_device(spi_host_device_t host_id, const spi_device_interface_config_t *dev_config, spi_device_handle_t *handle)
+{
+    ESP_RETURN_ON_FALSE(dev_config && handle, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    spi_device_handle_t dev = calloc(1, sizeof(struct spi_device_t));
+    ESP_RETURN_ON_FALSE(dev, ESP_ERR_NO_MEM, TAG, "no mem for spi device");
+    dev->host = host_id;
+    *handle = dev;
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_remove_device(spi_device_handle_t handle)
+{
+    free(handle);
+    return ESP_OK;
+}
+
+esp_err_t spi_device_transmit(spi_device_handle_t handle, spi_transaction_t *trans_desc)
+{
+    ESP_RETURN_ON_FALSE(handle && trans_desc && trans_desc->length % 8 == 0, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    // the buffer belongs to the strip object, it stays valid until the strip is deleted
+    s_last_tx = trans_desc->tx_buffer;
+    s_last_tx_bytes = trans_desc->length / 8;
+    return ESP_OK;
+}
+
+esp_err_t spi_device_get_actual_freq(spi_device_handle_t handle, int *freq_khz)
+{
+    ESP_RETURN_ON_FALSE(handle && freq_khz, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    *freq_khz = MOCK_SPI_CLOCK_KHZ;
+    return ESP_OK;
+}
@@ -0,0 +1,144 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "led_strip_types.h"
+#include "esp_idf_version.h"
+
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+#include "driver/rmt_types.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief LED Strip RMT specific configuration
+ */
+typedef struct {
+#if ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(5, 0, 0)
+    uint8_t rmt_channel;        /*!< Specify the channel number, the legacy RMT driver doesn't support channel allocator */
+#else // new driver supports specify the clock source and clock resolution
+    rmt_clock_source_t clk_src; /*!< RMT clock source */
+    uint32_t resolution_hz;     /*!< RMT tick resolution, if set to zero, a default resolution (10MHz) will be applied */
+#endif
+    size_t mem_block_symbols;   /*!< How many RMT symbols can one RMT channel hold at one time. Set to 0 will fallback to use the default size. */
+    struct {
+        uint32_t with_dma: 1;   /*!< Use DMA to transmit data */
+    } flags;                    /*!< Extra driver flags */
+} led_strip_rmt_config_t;
+
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+/**
+ * @brief Statistics of the RMT encoder that turns pixels into RMT symbols
+ *
+ * @note Each invocation of the encoder is counted as one refill, the first one is done in the task context by `rmt_transmit`,
+ *       the rest are done in the RMT ISR whenever the ping-pong buffer runs low.
+ */
+typedef struct {
+    uint32_t refills;      /*!< Number of encoder invocations */
+    uint32_t total_cycles; /*!< CPU cycles spent in the encoder, summed over all refills */
+    uint32_t max_cycles;   /*!< CPU cycles spent in the slowest refill */
+} led_strip_rmt_encoder_stats_t;
+#endif
+
+/**
+ * @brief Create LED strip based on RMT TX channel
+ *
+ * @param led_config LED strip configuration
+ * @param rmt_config RMT specific configuration
+ * @param ret_strip Returned LED strip handle
+ * @return
+ *      - ESP_OK: create LED strip handle successfully
+ *      - ESP_ERR_INVALID_ARG: create LED strip handle failed because of invalid argument
+ *      - ESP_ERR_NO_MEM: create LED strip handle failed because of out of memory
+ *      - ESP_FAIL: create LED strip handle failed because some other error
+ */
+esp_err_t led_strip_new_rmt_device(const led_strip_config_t *led_config, const led_strip_rmt_config_t *rmt_config, led_strip_handle_t *ret_strip);
+
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+/**
+ * @brief Get the encoder statistics of an LED strip created by `led_strip_new_rmt_device`
+ *
+ * @param strip LED strip handle, must be backed by RMT
+ * @param stats Returned encoder statistics
+ * @param clear Whether to clear the statistics after reading them
+ * @return
+ *      - ESP_OK: get statistics successfully
+ *      - ESP_ERR_INVALID_ARG: get statistics failed because of invalid argument
+ */
+esp_err_t led_strip_rmt_get_encoder_stats(led_strip_handle_t strip, led_strip_rmt_encoder_stats_t *stats, bool clear);
+
+/**
+ * @brief Handle of a group of RMT LED strips that are refreshed together
+ */
+typedef struct led_strip_rmt_group_t *led_strip_rmt_group_handle_t;
+
+/**
+ * @brief Create a group of LED strips, each one driven by its own RMT TX channel
+ *
+ * @note All strips of the group are refreshed by one call, and start transmitting at the same time.
+ *       On chips that support RMT TX synchronization, the start is aligned by the RMT sync manager,
+ *       otherwise the transmissions are queued back to back, leaving a small skew between the strips.
+ *       Either way, the refresh takes as long as the longest strip instead of the sum of all strips.
+ * @note Calling `led_strip_refresh` or `led_strip_clear` on a strip of the group refreshes the whole group.
+ * @note The RMT channels of the group are enabled here and stay enabled until `led_strip_rmt_group_del`.
+ *
+ * @param led_configs Array of LED strip configurations, one per strip
+ * @param num_strips Number of strips in the group
+ * @param rmt_config RMT specific configuration, shared by all strips
+ * @param ret_group Returned group handle
+ * @return
+ *      - ESP_OK: create group successfully
+ *      - ESP_ERR_INVALID_ARG: create group failed because of invalid argument
+ *      - ESP_ERR_NO_MEM: create group failed because of out of memory
+ *      - ESP_ERR_NOT_FOUND: create group failed because there are not enough free RMT channels
+ *      - ESP_FAIL: create group failed because some other error
+ */
+esp_err_t led_strip_new_rmt_group(const led_strip_config_t *led_configs, size_t num_strips, const led_strip_rmt_config_t *rmt_config, led_strip_rmt_group_handle_t *ret_group);
+
+/**
+ * @brief Get the handle of one strip in the group, to set its pixels
+ *
+ * @param group Group handle
+ * @param index Index of the strip, in the order of `led_configs` passed to `led_strip_new_rmt_group`
+ * @param ret_strip Returned LED strip handle, owned by the group
+ * @return
+ *      - ESP_OK: get strip successfully
+ *      - ESP_ERR_INVALID_ARG: get strip failed because of invalid argument
+ */
+esp_err_t led_strip_rmt_group_get_strip(led_strip_rmt_group_handle_t group, size_t index, led_strip_handle_t *ret_strip);
+
+/**
+ * @brief Flush the pixel buffers of all strips in the group, starting them together
+ *
+ * @param group Group handle
+ * @return
+ *      - ESP_OK: refresh successfully
+ *      - ESP_ERR_INVALID_ARG: refresh failed because of invalid argument
+ *      - ESP_FAIL: refresh failed because some other error occurred
+ */
+esp_err_t led_strip_rmt_group_refresh(led_strip_rmt_group_handle_t group);
+
+/**
+ * @brief Free the group, together with all of its strips
+ *
+ * @param group Group handle
+ * @return
+ *      - ESP_OK: free group successfully
+ *      - ESP_ERR_INVALID_ARG: free group failed because of invalid argument
+ *      - ESP_FAIL: free group failed because some other error occurred
+ */
+esp_err_t led_strip_rmt_group_del(led_strip_rmt_group_handle_t group);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
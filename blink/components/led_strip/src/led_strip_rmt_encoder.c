@@ -0,0 +1,333 @@
+/*
+ * SPDX-FileCopyrightText: 2022 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <sys/lock.h>
+#include "esp_check.h"
+#include "esp_cpu.h"
+#include "esp_heap_caps.h"
+#include "esp_idf_version.h"
+#include "led_strip_rmt_encoder.h"
+
+// the symbol table encoder is built on top of the RMT simple encoder, which is available since esp-idf v5.3
+#if CONFIG_LED_STRIP_RMT_USE_SYMBOL_TABLE && ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+#define LED_STRIP_RMT_ENCODER_SYMBOL_TABLE 1
+#else
+#define LED_STRIP_RMT_ENCODER_SYMBOL_TABLE 0
+#endif
+
+#define LED_STRIP_RMT_SYMBOLS_PER_BYTE 8
+#define LED_STRIP_RMT_RESET_US         280 // reset code duration defaults to 280us to accomodate WS2812B-V5
+#define LED_STRIP_RMT_MAX_RESOLUTION   80000000 // RMT can't tick faster than the APB clock
+#define LED_STRIP_RMT_MAX_DURATION     0x7FFF // duration field of rmt_symbol_word_t is 15 bits wide
+
+// Bit timing of each LED model, in nanoseconds
+#define WS2812_T0H_NS 300
+#define WS2812_T0L_NS 900
+#define WS2812_T1H_NS 900
+#define WS2812_T1L_NS 300
+#define SK6812_T0H_NS 300
+#define SK6812_T0L_NS 900
+#define SK6812_T1H_NS 600
+#define SK6812_T1L_NS 600
+
+// both LED models expect a 1.25us bit period, with a tolerance of +/-600ns
+#define LED_STRIP_BIT_PERIOD_VALID(h, l) (((h) + (l)) >= 650 && ((h) + (l)) <= 1850)
+
+_Static_assert(WS2812_T0H_NS < WS2812_T1H_NS, "WS2812: T0H must be shorter than T1H");
+_Static_assert(SK6812_T0H_NS < SK6812_T1H_NS, "SK6812: T0H must be shorter than T1H");
+_Static_assert(LED_STRIP_BIT_PERIOD_VALID(WS2812_T0H_NS, WS2812_T0L_NS), "WS2812: bit 0 period out of spec");
+_Static_assert(LED_STRIP_BIT_PERIOD_VALID(WS2812_T1H_NS, WS2812_T1L_NS), "WS2812: bit 1 period out of spec");
+_Static_assert(LED_STRIP_BIT_PERIOD_VALID(SK6812_T0H_NS, SK6812_T0L_NS), "SK6812: bit 0 period out of spec");
+_Static_assert(LED_STRIP_BIT_PERIOD_VALID(SK6812_T1H_NS, SK6812_T1L_NS), "SK6812: bit 1 period out of spec");
+_Static_assert((uint64_t)LED_STRIP_RMT_RESET_US * (LED_STRIP_RMT_MAX_RESOLUTION / 1000000) / 2 <= LED_STRIP_RMT_MAX_DURATION,
+               "reset code doesn't fit into one RMT symbol");
+
+typedef struct {
+    uint16_t t0h_ns;
+    uint16_t t0l_ns;
+    uint16_t t1h_ns;
+    uint16_t t1l_ns;
+} led_strip_bit_timing_t;
+
+static const led_strip_bit_timing_t s_led_timings[LED_MODEL_INVALID] = {
+    [LED_MODEL_WS2812] = {WS2812_T0H_NS, WS2812_T0L_NS, WS2812_T1H_NS, WS2812_T1L_NS},
+    [LED_MODEL_SK6812] = {SK6812_T0H_NS, SK6812_T0L_NS, SK6812_T1H_NS, SK6812_T1L_NS},
+};
+
+static const char *TAG = "led_rmt_encoder";
+
+#if LED_STRIP_RMT_ENCODER_SYMBOL_TABLE
+// RMT symbols for each byte value, MSB first. The table only depends on the bit symbols,
+// so encoders of the same LED model and resolution share one copy of its 8KB.
+typedef struct led_strip_symbol_table_t {
+    struct led_strip_symbol_table_t *next;
+    rmt_symbol_word_t bit0;
+    rmt_symbol_word_t bit1;
+    uint32_t ref_count;
+    rmt_symbol_word_t symbols[256][LED_STRIP_RMT_SYMBOLS_PER_BYTE];
+} led_strip_symbol_table_t;
+
+static led_strip_symbol_table_t *s_symbol_tables;
+static _lock_t s_symbol_tables_lock;
+#endif // LED_STRIP_RMT_ENCODER_SYMBOL_TABLE
+
+typedef struct {
+    rmt_encoder_t base;
+    rmt_encoder_t *bytes_encoder;
+    rmt_encoder_t *copy_encoder;
+    rmt_encoder_t *symbol_encoder;
+    int state;
+    rmt_symbol_word_t reset_code;
+    led_strip_rmt_encoder_stats_t stats;
+#if LED_STRIP_RMT_ENCODER_SYMBOL_TABLE
+    led_strip_symbol_table_t *symbol_table; // shared with the other encoders of the same bit symbols
+#endif
+} rmt_led_strip_encoder_t;
+
+static inline uint32_t led_strip_ns_to_ticks(uint32_t ns, uint32_t resolution)
+{
+    return (uint64_t)ns * resolution / 1000000000;
+}
+
+static inline void led_strip_encoder_record(rmt_led_strip_encoder_t *led_encoder, uint32_t start_cycles)
+{
+    uint32_t cycles = esp_cpu_get_cycle_count() - start_cycles;
+    led_encoder->stats.refills++;
+    led_encoder->stats.total_cycles += cycles;
+    if (cycles > led_encoder->stats.max_cycles) {
+        led_encoder->stats.max_cycles = cycles;
+    }
+}
+
+#if LED_STRIP_RMT_ENCODER_SYMBOL_TABLE
+static led_strip_symbol_table_t *led_strip_symbol_table_acquire(rmt_symbol_word_t bit0, rmt_symbol_word_t bit1)
+{
+    _lock_acquire(&s_symbol_tables_lock);
+    led_strip_symbol_table_t *table = s_symbol_tables;
+    while (table && (table->bit0.val != bit0.val || table->bit1.val != bit1.val)) {
+        table = table->next;
+    }
+    if (!table) {
+        // the table is read from the RMT ISR, so it must live in internal RAM
+        table = heap_caps_malloc(sizeof(led_strip_symbol_table_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (table) {
+            table->bit0 = bit0;
+            table->bit1 = bit1;
+            table->ref_count = 0;
+            for (int value = 0; value < 256; value++) {
+                for (int bit = 0; bit < LED_STRIP_RMT_SYMBOLS_PER_BYTE; bit++) {
+                    table->symbols[value][bit] = (value & (0x80 >> bit)) ? bit1 : bit0;
+                }
+            }
+            table->next = s_symbol_tables;
+            s_symbol_tables = table;
+        }
+    }
+    if (table) {
+        table->ref_count++;
+    }
+    _lock_release(&s_symbol_tables_lock);
+    return table;
+}
+
+static void led_strip_symbol_table_release(led_strip_symbol_table_t *table)
+{
+    _lock_acquire(&s_symbol_tables_lock);
+    if (--table->ref_count == 0) {
+        led_strip_symbol_table_t **link = &s_symbol_tables;
+        while (*link != table) {
+            link = &(*link)->next;
+        }
+        *link = table->next;
+        free(table);
+    }
+    _lock_release(&s_symbol_tables_lock);
+}
+
+static size_t rmt_encode_led_strip_symbols(const void *data, size_t data_size, size_t symbols_written, size_t symbols_free,
+                                           rmt_symbol_word_t *symbols, bool *done, void *arg)
+{
+    rmt_led_strip_encoder_t *led_encoder = (rmt_led_strip_encoder_t *)arg;
+    const led_strip_symbol_table_t *table = led_encoder->symbol_table;
+    const uint8_t *bytes = (const uint8_t *)data;
+    // we only ever emit whole bytes, so symbols_written is a multiple of 8 until the reset code goes out
+    size_t byte_index = symbols_written / LED_STRIP_RMT_SYMBOLS_PER_BYTE;
+    size_t byte_count = symbols_free / LED_STRIP_RMT_SYMBOLS_PER_BYTE;
+    if (byte_count > data_size - byte_index) {
+        byte_count = data_size - byte_index;
+    }
+    for (size_t i = 0; i < byte_count; i++) {
+        memcpy(symbols, table->symbols[bytes[byte_index + i]], sizeof(table->symbols[0]));
+        symbols += LED_STRIP_RMT_SYMBOLS_PER_BYTE;
+    }
+    size_t encoded_symbols = byte_count * LED_STRIP_RMT_SYMBOLS_PER_BYTE;
+    // append the reset code right away if all pixels are encoded and there's still room for it
+    if (byte_index + byte_count == data_size && encoded_symbols < symbols_free) {
+        *symbols = led_encoder->reset_code;
+        encoded_symbols++;
+        *done = true;
+    }
+    return encoded_symbols;
+}
+#endif // LED_STRIP_RMT_ENCODER_SYMBOL_TABLE
+
+static size_t rmt_encode_led_strip(rmt_encoder_t *encoder, rmt_channel_handle_t channel, const void *primary_data, size_t data_size, rmt_encode_state_t *ret_state)
+{
+    rmt_led_strip_encoder_t *led_encoder = __containerof(encoder, rmt_led_strip_encoder_t, base);
+    uint32_t start_cycles = esp_cpu_get_cycle_count();
+    rmt_encode_state_t session_state = 0;
+    rmt_encode_state_t state = 0;
+    size_t encoded_symbols = 0;
+    if (led_encoder->symbol_encoder) {
+        rmt_encoder_handle_t symbol_encoder = led_encoder->symbol_encoder;
+        encoded_symbols = symbol_encoder->encode(symbol_encoder, channel, primary_data, data_size, &state);
+        goto out;
+    }
+    rmt_encoder_handle_t bytes_encoder = led_encoder->bytes_encoder;
+    rmt_encoder_handle_t copy_encoder = led_encoder->copy_encoder;
+    switch (led_encoder->state) {
+    case 0: // send RGB data
+        encoded_symbols += bytes_encoder->encode(bytes_encoder, channel, primary_data, data_size, &session_state);
+        if (session_state & RMT_ENCODING_COMPLETE) {
+            led_encoder->state = 1; // switch to next state when current encoding session finished
+        }
+        if (session_state & RMT_ENCODING_MEM_FULL) {
+            state |= RMT_ENCODING_MEM_FULL;
+            goto out; // yield if there's no free space for encoding artifacts
+        }
+    // fall-through
+    case 1: // send reset code
+        encoded_symbols += copy_encoder->encode(copy_encoder, channel, &led_encoder->reset_code,
+                                                sizeof(led_encoder->reset_code), &session_state);
+        if (session_state & RMT_ENCODING_COMPLETE) {
+            led_encoder->state = 0; // back to the initial encoding session
+            state |= RMT_ENCODING_COMPLETE;
+        }
+        if (session_state & RMT_ENCODING_MEM_FULL) {
+            state |= RMT_ENCODING_MEM_FULL;
+            goto out; // yield if there's no free space for encoding artifacts
+        }
+    }
+out:
+    led_strip_encoder_record(led_encoder, start_cycles);
+    *ret_state = state;
+    return encoded_symbols;
+}
+
+static esp_err_t rmt_del_led_strip_encoder(rmt_encoder_t *encoder)
+{
+    rmt_led_strip_encoder_t *led_encoder = __containerof(encoder, rmt_led_strip_encoder_t, base);
+    if (led_encoder->bytes_encoder) {
+        rmt_del_encoder(led_encoder->bytes_encoder);
+    }
+    if (led_encoder->copy_encoder) {
+        rmt_del_encoder(led_encoder->copy_encoder);
+    }
+    if (led_encoder->symbol_encoder) {
+        rmt_del_encoder(led_encoder->symbol_encoder);
+    }
+#if LED_STRIP_RMT_ENCODER_SYMBOL_TABLE
+    if (led_encoder->symbol_table) {
+        led_strip_symbol_table_release(led_encoder->symbol_table);
+    }
+#endif
+    free(led_encoder);
+    return ESP_OK;
+}
+
+static esp_err_t rmt_led_strip_encoder_reset(rmt_encoder_t *encoder)
+{
+    rmt_led_strip_encoder_t *led_encoder = __containerof(encoder, rmt_led_strip_encoder_t, base);
+    if (led_encoder->symbol_encoder) {
+        rmt_encoder_reset(led_encoder->symbol_encoder);
+    } else {
+        rmt_encoder_reset(led_encoder->bytes_encoder);
+        rmt_encoder_reset(led_encoder->copy_encoder);
+    }
+    led_encoder->state = 0;
+    return ESP_OK;
+}
+
+esp_err_t rmt_new_led_strip_encoder(const led_strip_encoder_config_t *config, rmt_encoder_handle_t *ret_encoder)
+{
+    esp_err_t ret = ESP_OK;
+    rmt_led_strip_encoder_t *led_encoder = NULL;
+    ESP_GOTO_ON_FALSE(config && ret_encoder, ESP_ERR_INVALID_ARG, err, TAG, "invalid argument");
+    ESP_GOTO_ON_FALSE(config->led_model < LED_MODEL_INVALID, ESP_ERR_INVALID_ARG, err, TAG, "invalid led model");
+    ESP_GOTO_ON_FALSE(config->resolution <= LED_STRIP_RMT_MAX_RESOLUTION, ESP_ERR_INVALID_ARG, err, TAG, "resolution too high");
+    const led_strip_bit_timing_t *timing = &s_led_timings[config->led_model];
+    ESP_GOTO_ON_FALSE(led_strip_ns_to_ticks(timing->t0h_ns, config->resolution) > 0, ESP_ERR_INVALID_ARG, err, TAG,
+                      "resolution too low for led model timing");
+    led_encoder = calloc(1, sizeof(rmt_led_strip_encoder_t));
+    ESP_GOTO_ON_FALSE(led_encoder, ESP_ERR_NO_MEM, err, TAG, "no mem for led strip encoder");
+    led_encoder->base.encode = rmt_encode_led_strip;
+    led_encoder->base.del = rmt_del_led_strip_encoder;
+    led_encoder->base.reset = rmt_led_strip_encoder_reset;
+    rmt_symbol_word_t bit0 = {
+        .level0 = 1,
+        .duration0 = led_strip_ns_to_ticks(timing->t0h_ns, config->resolution),
+        .level1 = 0,
+        .duration1 = led_strip_ns_to_ticks(timing->t0l_ns, config->resolution),
+    };
+    rmt_symbol_word_t bit1 = {
+        .level0 = 1,
+        .duration0 = led_strip_ns_to_ticks(timing->t1h_ns, config->resolution),
+        .level1 = 0,
+        .duration1 = led_strip_ns_to_ticks(timing->t1l_ns, config->resolution),
+    };
+
+#if LED_STRIP_RMT_ENCODER_SYMBOL_TABLE
+    led_encoder->symbol_table = led_strip_symbol_table_acquire(bit0, bit1);
+    ESP_GOTO_ON_FALSE(led_encoder->symbol_table, ESP_ERR_NO_MEM, err, TAG, "no mem for symbol table");
+    rmt_simple_encoder_config_t symbol_encoder_config = {
+        .callback = rmt_encode_led_strip_symbols,
+        .arg = led_encoder,
+        .min_chunk_size = LED_STRIP_RMT_SYMBOLS_PER_BYTE,
+    };
+    ESP_GOTO_ON_ERROR(rmt_new_simple_encoder(&symbol_encoder_config, &led_encoder->symbol_encoder), err, TAG, "create symbol encoder failed");
+#else
+    rmt_bytes_encoder_config_t bytes_encoder_config = {
+        .bit0 = bit0,
+        .bit1 = bit1,
+        .flags.msb_first = 1 // WS2812 and SK6812 transfer bit order: G7...G0R7...R0B7...B0(W7...W0)
+    };
+    ESP_GOTO_ON_ERROR(rmt_new_bytes_encoder(&bytes_encoder_config, &led_encoder->bytes_encoder), err, TAG, "create bytes encoder failed");
+    rmt_copy_encoder_config_t copy_encoder_config = {};
+    ESP_GOTO_ON_ERROR(rmt_new_copy_encoder(&copy_encoder_config, &led_encoder->copy_encoder), err, TAG, "create copy encoder failed");
+#endif // LED_STRIP_RMT_ENCODER_SYMBOL_TABLE
+
+    uint32_t reset_ticks = config->resolution / 1000000 * LED_STRIP_RMT_RESET_US / 2;
+    led_encoder->reset_code = (rmt_symbol_word_t) {
+        .level0 = 0,
+        .duration0 = reset_ticks,
+        .level1 = 0,
+        .duration1 = reset_ticks,
+    };
+    *ret_encoder = &led_encoder->base;
+    return ESP_OK;
+err:
+    if (led_encoder) {
+        rmt_del_led_strip_encoder(&led_encoder->base);
+    }
+    return ret;
+}
+
+esp_err_t rmt_led_strip_encoder_get_stats(rmt_encoder_handle_t encoder, led_strip_rmt_encoder_stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE(encoder && stats, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    rmt_led_strip_encoder_t *led_encoder = __containerof(encoder, rmt_led_strip_encoder_t, base);
+    *stats = led_encoder->stats;
+    return ESP_OK;
+}
+
+esp_err_t rmt_led_strip_encoder_reset_stats(rmt_encoder_handle_t encoder)
+{
+    ESP_RETURN_ON_FALSE(encoder, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    rmt_led_strip_encoder_t *led_encoder = __containerof(encoder, rmt_led_strip_encoder_t, base);
+    memset(&led_encoder->stats, 0, sizeof(led_encoder->stats));
+    return ESP_OK;
+}
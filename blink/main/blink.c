@@ -2,17 +2,16 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_check.h"
+#include "esp_log.h"
 #include "led_strip.h"
+#include "effects.h"
 
 #define LED_GPIO    16                // your WS2812B data pin
 #define LED_NUM     1                 // number of pixels
 #define RMT_RES_HZ  (10 * 1000 * 1000) // 10 MHz
+#define FX_FPS      100               // a WS2812 takes 30us per pixel, so ~300 LEDs per strip max at 100 fps
 
-static inline void color_wheel(uint8_t x, uint8_t *r, uint8_t *g, uint8_t *b) {
-    if (x < 85)      { *r = 3*x;      *g = 255 - 3*x; *b = 0; }
-    else if (x < 170){ x -= 85; *r = 255 - 3*x; *g = 0; *b = 3*x; }
-    else             { x -= 170; *r = 0;         *g = 3*x; *b = 255 - 3*x; }
-}
+static const char *TAG = "blink";
 
 void app_main(void) {
     led_strip_handle_t strip;
@@ -39,14 +38,26 @@ void app_main(void) {
     ESP_ERROR_CHECK(led_strip_new_rmt_device(&strip_cfg, &rmt_cfg, &strip));
     ESP_ERROR_CHECK(led_strip_clear(strip));
 
-    uint8_t hue = 0;
+    fx_config_t fx_cfg = {
+        .strip = strip,
+        .num_leds = LED_NUM,
+        .fps = FX_FPS,
+        .kernel = fx_rainbow,
+    };
+    ESP_ERROR_CHECK(fx_start(&fx_cfg));
+
+    // report once per second: rendered fps, dropped ticks and frames that overran their deadline
+    fx_stats_t prev = {0};
     while (1) {
-        uint8_t r,g,b;
-        color_wheel(hue, &r, &g, &b);
-        ESP_ERROR_CHECK(led_strip_set_pixel(strip, 0, r, g, b));
-        ESP_ERROR_CHECK(led_strip_refresh(strip));
-        vTaskDelay(pdMS_TO_TICKS(30));
-        hue = (hue + 2) % 255;
+        vTaskDelay(pdMS_TO_TICKS(1000));
+        fx_stats_t now;
+        fx_get_stats(&now);
+        led_strip_rmt_encoder_stats_t enc;
+        ESP_ERROR_CHECK(led_strip_rmt_get_encoder_stats(strip, &enc, true));
+        ESP_LOGI(TAG, "%lu fps | skipped %lu | missed %lu | worst %lu us | rmt refill avg %lu max %lu cycles",
+                 (unsigned long)(now.frames - prev.frames), (unsigned long)(now.skipped - prev.skipped),
+                 (unsigned long)(now.missed - prev.missed), (unsigned long)now.max_frame_us,
+                 (unsigned long)(enc.refills ? enc.total_cycles / enc.refills : 0), (unsigned long)enc.max_cycles);
+        prev = now;
     }
 }
-
@@ -0,0 +1,145 @@
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_check.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "effects.h"
+
+#define FX_TASK_STACK       4096
+#define FX_TASK_PRIO        5
+#define FX_RAINBOW_SPEED    4     // hue steps per frame, a full turn takes FX_HUE_MAX / 4 frames
+#define FX_COMET_TAIL       16    // pixels
+
+static const char *TAG = "fx";
+
+static fx_config_t s_cfg;
+static fx_rgb_t *s_frame;
+static TaskHandle_t s_task;
+static esp_timer_handle_t s_timer;
+static fx_stats_t s_stats;
+static portMUX_TYPE s_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// x * y / 255 without a division, exact for the corner cases (0 and 255)
+static inline uint8_t scale8(uint8_t x, uint8_t y) {
+    return ((uint32_t)x * y + 255) >> 8;
+}
+
+fx_rgb_t fx_hsv(uint16_t hue, uint8_t sat, uint8_t val) {
+    hue %= FX_HUE_MAX;
+    uint8_t sector = hue >> 8;
+    uint8_t frac = hue & 0xFF;
+    uint8_t p = scale8(val, 255 - sat);
+    uint8_t q = scale8(val, 255 - scale8(sat, frac));
+    uint8_t t = scale8(val, 255 - scale8(sat, 255 - frac));
+    switch (sector) {
+        case 0:  return (fx_rgb_t){ val, t, p };
+        case 1:  return (fx_rgb_t){ q, val, p };
+        case 2:  return (fx_rgb_t){ p, val, t };
+        case 3:  return (fx_rgb_t){ p, q, val };
+        case 4:  return (fx_rgb_t){ t, p, val };
+        default: return (fx_rgb_t){ val, p, q };
+    }
+}
+
+void fx_rainbow(fx_rgb_t *frame, uint32_t n, uint32_t frame_no, void *arg) {
+    (void)arg;
+    // spread one hue turn over the strip, 8 fractional bits keep short strips smooth
+    uint32_t step = (FX_HUE_MAX << 8) / n;
+    // running start hue, frame_no * FX_RAINBOW_SPEED would overflow and make the hue jump
+    static uint32_t s_hue, s_last_frame;
+    uint32_t frames = frame_no - s_last_frame;  // more than one after skipped ticks
+    s_last_frame = frame_no;
+    s_hue = (s_hue + frames % FX_HUE_MAX * FX_RAINBOW_SPEED) % FX_HUE_MAX;
+    uint32_t hue = s_hue << 8;
+    for (uint32_t i = 0; i < n; i++) {
+        frame[i] = fx_hsv(hue >> 8, 255, 255);
+        hue += step;
+    }
+}
+
+void fx_comet(fx_rgb_t *frame, uint32_t n, uint32_t frame_no, void *arg) {
+    fx_rgb_t head = arg ? *(const fx_rgb_t *)arg : (fx_rgb_t){ 255, 255, 255 };
+    uint32_t pos = frame_no % n;
+    memset(frame, 0, n * sizeof(*frame));
+    for (uint32_t d = 0; d < FX_COMET_TAIL && d < n; d++) {
+        uint8_t fade = 255 - d * 255 / FX_COMET_TAIL;
+        fx_rgb_t *px = &frame[(pos + n - d) % n];
+        px->r = scale8(head.r, fade);
+        px->g = scale8(head.g, fade);
+        px->b = scale8(head.b, fade);
+    }
+}
+
+static void fx_tick(void *arg) {
+    // runs in the esp_timer task, the render task counts the pending ticks
+    xTaskNotifyGive(s_task);
+}
+
+static void fx_task(void *arg) {
+    const uint32_t period_us = 1000000 / s_cfg.fps;
+    uint32_t frame_no = 0;
+    while (1) {
+        uint32_t ticks = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        frame_no += ticks;
+
+        int64_t t0 = esp_timer_get_time();
+        s_cfg.kernel(s_frame, s_cfg.num_leds, frame_no, s_cfg.kernel_arg);
+        for (uint32_t i = 0; i < s_cfg.num_leds; i++) {
+            led_strip_set_pixel(s_cfg.strip, i, s_frame[i].r, s_frame[i].g, s_frame[i].b);
+        }
+        esp_err_t err = led_strip_refresh(s_cfg.strip);
+        uint32_t frame_us = esp_timer_get_time() - t0;
+        if (err != ESP_OK) {
+            ESP_LOGW(TAG, "refresh failed: %s", esp_err_to_name(err));
+        }
+
+        taskENTER_CRITICAL(&s_stats_lock);
+        s_stats.frames++;
+        s_stats.skipped += ticks - 1;
+        if (frame_us > period_us) s_stats.missed++;
+        if (frame_us > s_stats.max_frame_us) s_stats.max_frame_us = frame_us;
+        taskEXIT_CRITICAL(&s_stats_lock);
+    }
+}
+
+esp_err_t fx_start(const fx_config_t *cfg) {
+    ESP_RETURN_ON_FALSE(cfg && cfg->strip && cfg->num_leds && cfg->fps && cfg->kernel, ESP_ERR_INVALID_ARG, TAG, "invalid config");
+    ESP_RETURN_ON_FALSE(!s_task, ESP_ERR_INVALID_STATE, TAG, "already running");
+    esp_err_t ret = ESP_OK;
+    s_frame = calloc(cfg->num_leds, sizeof(*s_frame));
+    ESP_RETURN_ON_FALSE(s_frame, ESP_ERR_NO_MEM, TAG, "no mem for frame buffer");
+    s_cfg = *cfg;
+
+    ESP_GOTO_ON_FALSE(xTaskCreate(fx_task, "fx", FX_TASK_STACK, NULL, FX_TASK_PRIO, &s_task) == pdPASS,
+                      ESP_ERR_NO_MEM, err, TAG, "no mem for fx task");
+    const esp_timer_create_args_t targs = {
+        .callback = fx_tick,
+        .name = "fx_frame",
+    };
+    ESP_GOTO_ON_ERROR(esp_timer_create(&targs, &s_timer), err, TAG, "timer create failed");
+    ESP_GOTO_ON_ERROR(esp_timer_start_periodic(s_timer, 1000000 / cfg->fps), err, TAG, "timer start failed");
+    ESP_LOGI(TAG, "%lu LEDs @ %lu fps", (unsigned long)cfg->num_leds, (unsigned long)cfg->fps);
+    return ESP_OK;
+
+err:
+    // the task only waits for ticks until the timer runs, so it can go at any point
+    if (s_timer) {
+        esp_timer_delete(s_timer);
+        s_timer = NULL;
+    }
+    if (s_task) {
+        vTaskDelete(s_task);
+        s_task = NULL;
+    }
+    free(s_frame);
+    s_frame = NULL;
+    return ret;
+}
+
+void fx_get_stats(fx_stats_t *out) {
+    taskENTER_CRITICAL(&s_stats_lock);
+    *out = s_stats;
+    taskEXIT_CRITICAL(&s_stats_lock);
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "led_strip.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Full hue circle in fixed point: 6 sectors of 256 steps each
+#define FX_HUE_MAX  (6 * 256)
+
+typedef struct {
+    uint8_t r, g, b;
+} fx_rgb_t;
+
+// Fills the whole frame (n pixels) for the given frame number.
+// frame_no advances by one per timer tick, also across skipped frames, so effects stay locked to wall time.
+typedef void (*fx_kernel_t)(fx_rgb_t *frame, uint32_t n, uint32_t frame_no, void *arg);
+
+typedef struct {
+    led_strip_handle_t strip;
+    uint32_t num_leds;
+    uint32_t fps;           // frame clock rate
+    fx_kernel_t kernel;
+    void *kernel_arg;
+} fx_config_t;
+
+typedef struct {
+    uint32_t frames;        // frames rendered and sent to the strip
+    uint32_t skipped;       // timer ticks dropped because the previous frame was still busy
+    uint32_t missed;        // frames whose render + refresh took longer than one period
+    uint32_t max_frame_us;  // slowest render + refresh
+} fx_stats_t;
+
+// hue: 0..FX_HUE_MAX-1, sat/val: 0..255
+fx_rgb_t fx_hsv(uint16_t hue, uint8_t sat, uint8_t val);
+
+// Kernels. arg is unused by fx_rainbow; fx_comet takes an fx_rgb_t * as its head color (NULL for white).
+void fx_rainbow(fx_rgb_t *frame, uint32_t n, uint32_t frame_no, void *arg);
+void fx_comet(fx_rgb_t *frame, uint32_t n, uint32_t frame_no, void *arg);
+
+// Starts the frame clock and the render task. Only one engine can run at a time.
+esp_err_t fx_start(const fx_config_t *cfg);
+
+// Snapshot of the counters since fx_start().
+void fx_get_stats(fx_stats_t *out);
+
+#ifdef __cplusplus
+}
+#endif
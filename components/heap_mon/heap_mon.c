@@ -0,0 +1,194 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_check.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "heap_mon.h"
+
+#define HEAP_MON_CAPS   MALLOC_CAP_8BIT
+
+static const char *TAG = "heap_mon";
+
+static heap_mon_sample_t s_ring[HEAP_MON_RING_LEN];
+static uint32_t s_head;             // next slot to write
+static uint32_t s_count;            // samples taken, saturates at HEAP_MON_RING_LEN
+static size_t s_max_alloc;
+static TaskHandle_t s_tasks[HEAP_MON_MAX_TASKS];
+static char s_task_names[HEAP_MON_MAX_TASKS][configMAX_TASK_NAME_LEN];
+static int s_num_tasks;
+static esp_timer_handle_t s_timer;
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/* i-th newest sample, 0 = latest */
+static inline const heap_mon_sample_t *ring_at(uint32_t i) {
+    return &s_ring[(s_head + HEAP_MON_RING_LEN - 1 - i) % HEAP_MON_RING_LEN];
+}
+
+static inline unsigned frag_pct(const heap_mon_sample_t *s) {
+    return s->free ? 100 - (unsigned)((uint64_t)s->largest * 100 / s->free) : 0;
+}
+
+/*
+ * Fragmentation trend: mean of the newest quarter of the ring against the oldest quarter.
+ * Flag when the largest block lost more than 1/8 while free heap stayed within 1/16,
+ * i.e. the same amount of memory is getting chopped into smaller pieces.
+ */
+static bool frag_trend(void) {
+    uint32_t q = s_count / 4;
+    if (q < 2) return false;
+    uint64_t new_blk = 0, old_blk = 0, new_free = 0, old_free = 0;
+    for (uint32_t i = 0; i < q; ++i) {
+        new_blk  += ring_at(i)->largest;
+        new_free += ring_at(i)->free;
+        old_blk  += ring_at(s_count - 1 - i)->largest;
+        old_free += ring_at(s_count - 1 - i)->free;
+    }
+    return new_blk * 8 < old_blk * 7 && new_free * 16 >= old_free * 15;
+}
+
+/* names of the first n watched tasks; heap_mon_watch() may add one at any time */
+static void watched_names(char names[][configMAX_TASK_NAME_LEN], int n) {
+    taskENTER_CRITICAL(&s_lock);
+    memcpy(names, s_task_names, n * sizeof(s_task_names[0]));
+    taskEXIT_CRITICAL(&s_lock);
+}
+
+static void heap_mon_sample(void *arg) {
+    TaskHandle_t tasks[HEAP_MON_MAX_TASKS];
+    taskENTER_CRITICAL(&s_lock);
+    int num_tasks = s_num_tasks;
+    memcpy(tasks, s_tasks, num_tasks * sizeof(s_tasks[0]));
+    taskEXIT_CRITICAL(&s_lock);
+
+    heap_mon_sample_t s = {
+        .t_us = esp_timer_get_time(),
+        .free = heap_caps_get_free_size(HEAP_MON_CAPS),
+        .min_free = heap_caps_get_minimum_free_size(HEAP_MON_CAPS),
+        .largest = heap_caps_get_largest_free_block(HEAP_MON_CAPS),
+        .num_tasks = num_tasks,
+    };
+    for (int i = 0; i < num_tasks; ++i) {
+        s.stack_hwm[i] = uxTaskGetStackHighWaterMark(tasks[i]);     // bytes on ESP-IDF
+        if (s.stack_hwm[i] < HEAP_MON_STACK_LOW) s.flags |= HEAP_MON_WARN_STACK;
+    }
+    if (s.largest < 2 * s_max_alloc) s.flags |= HEAP_MON_WARN_BLOCK;
+
+    // only this callback writes the ring, the lock keeps readers from seeing a half-written slot
+    uint32_t prev_flags = s_count ? ring_at(0)->flags : 0;
+    taskENTER_CRITICAL(&s_lock);
+    s_ring[s_head] = s;
+    s_head = (s_head + 1) % HEAP_MON_RING_LEN;
+    if (s_count < HEAP_MON_RING_LEN) s_count++;
+    taskEXIT_CRITICAL(&s_lock);
+
+    if (frag_trend()) {
+        taskENTER_CRITICAL(&s_lock);
+        s_ring[(s_head + HEAP_MON_RING_LEN - 1) % HEAP_MON_RING_LEN].flags |= HEAP_MON_WARN_FRAG;
+        taskEXIT_CRITICAL(&s_lock);
+        s.flags |= HEAP_MON_WARN_FRAG;
+    }
+
+    uint32_t raised = s.flags & ~prev_flags;
+    if (raised & HEAP_MON_WARN_FRAG) {
+        ESP_LOGW(TAG, "fragmentation rising: largest block %lu of %lu free (%u%%)",
+                 (unsigned long)s.largest, (unsigned long)s.free, frag_pct(&s));
+    }
+    if (raised & HEAP_MON_WARN_BLOCK) {
+        ESP_LOGW(TAG, "largest free block %lu B, allocations of %u B may fail soon",
+                 (unsigned long)s.largest, (unsigned)s_max_alloc);
+    }
+    if (raised & HEAP_MON_WARN_STACK) {
+        char names[HEAP_MON_MAX_TASKS][configMAX_TASK_NAME_LEN];
+        watched_names(names, num_tasks);
+        for (int i = 0; i < num_tasks; ++i) {
+            if (s.stack_hwm[i] < HEAP_MON_STACK_LOW) {
+                ESP_LOGW(TAG, "task %s stack headroom %lu B", names[i], (unsigned long)s.stack_hwm[i]);
+            }
+        }
+    }
+}
+
+esp_err_t heap_mon_start(uint32_t period_ms, size_t max_alloc) {
+    ESP_RETURN_ON_FALSE(period_ms, ESP_ERR_INVALID_ARG, TAG, "period must be > 0");
+    ESP_RETURN_ON_FALSE(!s_timer, ESP_ERR_INVALID_STATE, TAG, "already running");
+    s_max_alloc = max_alloc;
+    const esp_timer_create_args_t targs = {
+        .callback = heap_mon_sample,
+        .name = "heap_mon",
+    };
+    ESP_RETURN_ON_ERROR(esp_timer_create(&targs, &s_timer), TAG, "timer create failed");
+    heap_mon_sample(NULL);
+    return esp_timer_start_periodic(s_timer, (uint64_t)period_ms * 1000);
+}
+
+esp_err_t heap_mon_watch(const char *task_name) {
+    ESP_RETURN_ON_FALSE(s_num_tasks < HEAP_MON_MAX_TASKS, ESP_ERR_NO_MEM, TAG, "too many tasks");
+    TaskHandle_t t = xTaskGetHandle(task_name);
+    ESP_RETURN_ON_FALSE(t, ESP_ERR_NOT_FOUND, TAG, "no task %s", task_name);
+    taskENTER_CRITICAL(&s_lock);
+    snprintf(s_task_names[s_num_tasks], sizeof(s_task_names[0]), "%s", task_name);
+    s_tasks[s_num_tasks] = t;
+    s_num_tasks++;
+    taskEXIT_CRITICAL(&s_lock);
+    return ESP_OK;
+}
+
+bool heap_mon_latest(heap_mon_sample_t *out) {
+    taskENTER_CRITICAL(&s_lock);
+    bool ok = s_count > 0;
+    if (ok) *out = *ring_at(0);
+    taskEXIT_CRITICAL(&s_lock);
+    return ok;
+}
+
+static const char *flags_str(uint32_t flags, char *buf, size_t len) {
+    if (!flags) return "ok";
+    snprintf(buf, len, "WARN%s%s%s", flags & HEAP_MON_WARN_FRAG ? " frag" : "",
+             flags & HEAP_MON_WARN_BLOCK ? " blk" : "", flags & HEAP_MON_WARN_STACK ? " stk" : "");
+    return buf;
+}
+
+void heap_mon_log(void) {
+    heap_mon_sample_t s;
+    char names[HEAP_MON_MAX_TASKS][configMAX_TASK_NAME_LEN];
+    char fl[24];
+    if (!heap_mon_latest(&s)) return;
+    watched_names(names, s.num_tasks);
+    ESP_LOGI(TAG, "free %lu min %lu largest %lu frag %u%% %s", (unsigned long)s.free,
+             (unsigned long)s.min_free, (unsigned long)s.largest, frag_pct(&s), flags_str(s.flags, fl, sizeof(fl)));
+    for (int i = 0; i < s.num_tasks; ++i) {
+        ESP_LOGI(TAG, "  %-16s stack headroom %5lu B", names[i], (unsigned long)s.stack_hwm[i]);
+    }
+}
+
+/* rows are clipped to the page width on purpose */
+static void page_row(char *row, const char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(row, HEAP_MON_PAGE_COLS + 1, fmt, ap);
+    va_end(ap);
+}
+
+int heap_mon_page(char rows[][HEAP_MON_PAGE_COLS + 1], int max_rows) {
+    heap_mon_sample_t s;
+    char names[HEAP_MON_MAX_TASKS][configMAX_TASK_NAME_LEN];
+    char fl[24];
+    if (max_rows <= 0 || !heap_mon_latest(&s)) return 0;
+    watched_names(names, s.num_tasks);
+
+    uint32_t mins = (uint32_t)(s.t_us / 60000000);
+    int n = 0;
+    page_row(rows[n++], "DIAG up %luh%02lum", (unsigned long)(mins / 60), (unsigned long)(mins % 60));
+    if (n < max_rows) page_row(rows[n++], "free %luk min %luk", (unsigned long)(s.free / 1024),
+                               (unsigned long)(s.min_free / 1024));
+    if (n < max_rows) page_row(rows[n++], "blk %luk frag %u%%", (unsigned long)(s.largest / 1024), frag_pct(&s));
+    if (n < max_rows) page_row(rows[n++], "%s", flags_str(s.flags, fl, sizeof(fl)));
+    for (int i = 0; i < s.num_tasks && n < max_rows; ++i) {
+        page_row(rows[n++], "%-.10s %5luB", names[i], (unsigned long)s.stack_hwm[i]);
+    }
+    return n;
+}
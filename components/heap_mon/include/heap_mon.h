@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HEAP_MON_RING_LEN       32      // samples kept, oldest overwritten
+#define HEAP_MON_MAX_TASKS      6       // tasks whose stack high-water mark is sampled
+#define HEAP_MON_PAGE_COLS      21      // one 128 px OLED text row
+#define HEAP_MON_STACK_LOW      512     // bytes of headroom below which a task is flagged
+
+/* Warning flags, recomputed on every sample */
+#define HEAP_MON_WARN_FRAG      (1u << 0)   // largest free block shrinking while total free heap is not
+#define HEAP_MON_WARN_BLOCK     (1u << 1)   // largest free block below twice the app's biggest allocation
+#define HEAP_MON_WARN_STACK     (1u << 2)   // a watched task is under HEAP_MON_STACK_LOW bytes of headroom
+
+typedef struct {
+    int64_t  t_us;
+    uint32_t free;          // free 8-bit capable heap
+    uint32_t min_free;      // lowest free heap since boot
+    uint32_t largest;       // largest free block
+    uint32_t stack_hwm[HEAP_MON_MAX_TASKS];    // bytes, same order as heap_mon_watch() calls
+    uint8_t  num_tasks;     // watched tasks at the time of the sample, entries of stack_hwm in use
+    uint32_t flags;         // HEAP_MON_WARN_*
+} heap_mon_sample_t;
+
+/*
+ * Start sampling every period_ms from the esp_timer task.
+ * max_alloc is the largest single allocation the app makes (e.g. its scan record array);
+ * HEAP_MON_WARN_BLOCK fires once the largest free block gets within 2x of it.
+ */
+esp_err_t heap_mon_start(uint32_t period_ms, size_t max_alloc);
+
+/* Add a task to the stack high-water mark set by name ("main", "wifi", ...) */
+esp_err_t heap_mon_watch(const char *task_name);
+
+/* Latest sample, false before the first one */
+bool heap_mon_latest(heap_mon_sample_t *out);
+
+/* One-line summary plus per-task headroom to the serial console */
+void heap_mon_log(void);
+
+/* Diagnostics page as text rows of up to HEAP_MON_PAGE_COLS chars; returns rows filled */
+int heap_mon_page(char rows[][HEAP_MON_PAGE_COLS + 1], int max_rows);
+
+#ifdef __cplusplus
+}
+#endif
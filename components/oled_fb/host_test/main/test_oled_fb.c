@@ -0,0 +1,99 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "oled_fb.h"
+
+/*
+ * Host check of the oled_fb raster helpers.
+ *
+ * fb_fill_rect() and fb_draw_char() write whole page bytes. Random rectangles and glyphs, many of them partly or
+ * entirely off the panel, are drawn into fb and into a one-byte-per-pixel reference, and both are compared.
+ */
+
+#define TEST_OPS        200000
+#define TEST_CMP_EVERY  64
+
+static bool ref[OLED_HEIGHT][OLED_WIDTH];
+
+static void ref_set(int x, int y, bool on)
+{
+    if (x >= 0 && x < OLED_WIDTH && y >= 0 && y < OLED_HEIGHT) ref[y][x] = on;
+}
+
+static void ref_fill_rect(int x, int y, int w, int h, bool on)
+{
+    for (int yy = y; yy < y + h; yy++) {
+        for (int xx = x; xx < x + w; xx++) ref_set(xx, yy, on);
+    }
+}
+
+// a glyph overwrites its 5x7 box, transparent nowhere
+static void ref_draw_char(int x, int y, char c)
+{
+    const uint8_t *col = font5x7[c - 32];
+    for (int dx = 0; dx < 5; dx++) {
+        for (int r = 0; r < 7; r++) ref_set(x + dx, y + r, (col[dx] >> r) & 1);
+    }
+}
+
+static bool fb_px(int x, int y)
+{
+    return (fb[(y >> 3) * OLED_WIDTH + x] >> (y & 7)) & 1;
+}
+
+static int compare(int op)
+{
+    for (int y = 0; y < OLED_HEIGHT; y++) {
+        for (int x = 0; x < OLED_WIDTH; x++) {
+            if (fb_px(x, y) != ref[y][x]) {
+                printf("FAIL after op %d: pixel %d,%d is %d, expected %d\n", op, x, y, fb_px(x, y), ref[y][x]);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+// mostly around the panel, sometimes far off it
+static int rand_coord(int size)
+{
+    return rand() % 8 == 0 ? rand() % (4 * size) - 2 * size : rand() % (size + 16) - 8;
+}
+
+int main(void)
+{
+    printf("%dx%d\n", OLED_WIDTH, OLED_HEIGHT);
+    srand(OLED_WIDTH * 1000 + OLED_HEIGHT);
+    fb_clear();
+    for (int op = 0; op < TEST_OPS; op++) {
+        switch (rand() % 3) {
+        case 0: {
+            int x = rand_coord(OLED_WIDTH), y = rand_coord(OLED_HEIGHT);
+            int w = rand() % 40 - 2, h = rand() % 40 - 2;
+            bool on = rand() & 1;
+            fb_fill_rect(x, y, w, h, on);
+            ref_fill_rect(x, y, w, h, on);
+            break;
+        }
+        case 1: {
+            int x = rand_coord(OLED_WIDTH), y = rand_coord(OLED_HEIGHT);
+            char c = 32 + rand() % 95;
+            fb_draw_char(x, y, c);
+            ref_draw_char(x, y, c);
+            break;
+        }
+        default: {
+            // a cell of the text grid, including the partial cell at the right edge
+            int x = rand() % (MAX_COLS + 1) * CELL_W, y = rand() % MAX_ROWS * CELL_H;
+            char c = 32 + rand() % 95;
+            fb_draw_char(x, y, c);
+            ref_draw_char(x, y, c);
+            break;
+        }
+        }
+        if (op % TEST_CMP_EVERY == 0 && compare(op)) return 1;
+    }
+    if (compare(TEST_OPS)) return 1;
+    printf("PASSED\n");
+    return 0;
+}
@@ -0,0 +1,3 @@
+#pragma once
+
+// the panel choice comes from the command line, see CMakeLists.txt
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ===== Panel geometry, fixed by Kconfig ===== */
+#if CONFIG_OLED_FB_PANEL_SH1107_128X128
+#define OLED_WIDTH      128
+#define OLED_HEIGHT     128
+#elif CONFIG_OLED_FB_PANEL_SSD1306_128X32
+#define OLED_WIDTH      128
+#define OLED_HEIGHT     32
+#else
+#define OLED_WIDTH      128
+#define OLED_HEIGHT     64
+#endif
+
+#define OLED_PAGES      (OLED_HEIGHT / 8)
+
+/* ===== Text grid (5x7 font -> 6x8 cell) ===== */
+#define CELL_W          6
+#define CELL_H          8
+#define MAX_COLS        (OLED_WIDTH / CELL_W)   // 21 chars/line
+#define MAX_ROWS        (OLED_HEIGHT / CELL_H)  // 4, 8 or 16 lines
+
+/* ===== 1-bpp framebuffer, page-major, LSB = top row of a page ===== */
+extern uint8_t fb[OLED_PAGES * OLED_WIDTH];
+
+/* 5x7 ASCII font (32..126), 5 columns/char, LSB = top */
+extern const uint8_t font5x7[95][5];
+
+static inline void fb_clear(void) { memset(fb, 0x00, sizeof(fb)); }
+
+/* single pixel, clipped; prefer fb_fill_rect() for anything larger */
+static inline void fb_set_px(int x, int y, int on) {
+    if ((unsigned)x >= OLED_WIDTH || (unsigned)y >= OLED_HEIGHT) return;
+    uint8_t *p = &fb[(y >> 3) * OLED_WIDTH + x];
+    uint8_t bit = 1u << (y & 7);
+    if (on) *p |= bit; else *p &= (uint8_t)~bit;
+}
+
+/* rectangles and glyphs are clipped once, then written a page byte at a time */
+void fb_fill_rect(int x, int y, int w, int h, int on);
+void fb_draw_char(int x, int y, char c);
+
+/* UTF-8 text, one cell per character: ASCII from font5x7, the rest from the glyph atlas picked
+ * in Kconfig, a box for characters outside it and '?' per malformed byte */
+void fb_draw_text_fit(int col, int row, const char *s, int max_cols);
+
+/* bytes of s that fill the first max_cols cells, for splitting UTF-8 text without cutting a character */
+size_t fb_text_bytes(const char *s, int max_cols);
+
+/* ===== I2C link ===== */
+#define OLED_LINK_TIERS 4   // 100, 400, 700, 1000 kHz
+
+typedef struct {
+    uint32_t hz;                            // current bus clock
+    uint32_t flushes;
+    uint32_t nacks;                         // failed flushes other than timeouts
+    uint32_t timeouts;
+    uint32_t recoveries;                    // bus resets, each drops one tier when calibrating
+    uint32_t tier_hz[OLED_LINK_TIERS];
+    uint16_t tier_fps_x10[OLED_LINK_TIERS]; // full-frame flushes/s x10 measured per tier, 0 = unstable or not tried
+} oled_link_stats_t;
+
+/* I2C bus + panel bring-up at the calibrated (or fixed) clock, aborts if the panel never answers */
+void oled_init(void);
+
+/* Full-frame flush of fb. Repeated failures reset the bus and re-init the panel one tier slower. */
+esp_err_t oled_flush_full(void);
+
+void oled_link_get_stats(oled_link_stats_t *out);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,159 @@
+#include <stdbool.h>
+#include "oled_fb.h"
+#include "oled_glyphs.h"
+
+_Static_assert(OLED_HEIGHT % 8 == 0, "panel height must be a whole number of pages");
+
+uint8_t fb[OLED_PAGES * OLED_WIDTH];
+
+/* ===== raster ===== */
+
+/* bits y0..y1 (inclusive, 0..7) of one page byte */
+static inline uint8_t page_mask(int y0, int y1) {
+    return (uint8_t)((0xFFu << y0) & (0xFFu >> (7 - y1)));
+}
+
+static inline void page_fill(uint8_t *p, int w, uint8_t mask, int on) {
+    if (mask == 0xFF) { memset(p, on ? 0xFF : 0x00, w); return; }
+    if (on) { for (int i = 0; i < w; ++i) p[i] |= mask; }
+    else    { for (int i = 0; i < w; ++i) p[i] &= (uint8_t)~mask; }
+}
+
+void fb_fill_rect(int x, int y, int w, int h, int on) {
+    if (w <= 0 || h <= 0) return;
+    int x1 = x + w, y1 = y + h;                 // exclusive
+    if (x < 0) x = 0;
+    if (y < 0) y = 0;
+    if (x1 > OLED_WIDTH)  x1 = OLED_WIDTH;
+    if (y1 > OLED_HEIGHT) y1 = OLED_HEIGHT;
+    if (x >= x1 || y >= y1) return;
+
+    int p0 = y >> 3, p1 = (y1 - 1) >> 3;
+    w = x1 - x;
+    for (int pg = p0; pg <= p1; ++pg) {
+        int top = pg == p0 ? (y & 7) : 0;
+        int bot = pg == p1 ? ((y1 - 1) & 7) : 7;
+        page_fill(&fb[pg * OLED_WIDTH + x], w, page_mask(top, bot), on);
+    }
+}
+
+/* A glyph covers 7 rows: one page when y is page aligned (all text rows are), two otherwise. */
+static void draw_cols(int x, int y, const uint8_t *col) {
+    // a cell of the text grid: no clipping, 5 plain stores that keep the bottom row of the page
+    if ((y & 7) == 0 && (unsigned)y < OLED_HEIGHT && (unsigned)x <= OLED_WIDTH - 5) {
+        uint8_t *p = &fb[(y >> 3) * OLED_WIDTH + x];
+        for (int dx = 0; dx < 5; ++dx) p[dx] = (p[dx] & 0x80) | col[dx];
+        return;
+    }
+    if (y <= -7 || y >= OLED_HEIGHT) return;
+
+    int sh = y & 7;
+    int pg = y >> 3;                            // arithmetic shift: -1 for y in -7..-1
+    uint16_t keep = (uint16_t)~(0x7Fu << sh);
+    for (int dx = 0; dx < 5; ++dx) {
+        int xx = x + dx;
+        if ((unsigned)xx >= OLED_WIDTH) continue;
+        uint16_t bits = (uint16_t)col[dx] << sh;
+        if (pg >= 0) {
+            uint8_t *p = &fb[pg * OLED_WIDTH + xx];
+            *p = (*p & (uint8_t)keep) | (uint8_t)bits;
+        }
+        if (sh && pg + 1 < OLED_PAGES) {
+            uint8_t *p = &fb[(pg + 1) * OLED_WIDTH + xx];
+            *p = (*p & (uint8_t)(keep >> 8)) | (uint8_t)(bits >> 8);
+        }
+    }
+}
+
+void fb_draw_char(int x, int y, char c) {
+    if ((unsigned char)c < 32 || (unsigned char)c > 126) c = '?';
+    draw_cols(x, y, font5x7[(uint8_t)c - 32]);
+}
+
+/* ===== UTF-8 text ===== */
+
+static const uint8_t glyph_box[5]  = { 0x7F, 0x41, 0x41, 0x41, 0x7F };  // codepoint not in the atlas
+static const uint8_t glyph_face[5] = { 0x3E, 0x55, 0x61, 0x55, 0x3E };  // any emoji
+
+/* Decode one sequence and advance *ps past it. Malformed, overlong or surrogate input gives '?'
+ * and skips a single byte, so arbitrary SSID bytes resync on the next lead byte. */
+static uint32_t utf8_next(const char **ps) {
+    const uint8_t *p = (const uint8_t *)*ps;
+    uint32_t cp = p[0], min;
+    int n;
+    if (cp < 0x80) { *ps += 1; return cp; }
+    if      ((cp & 0xE0) == 0xC0) { n = 1; cp &= 0x1F; min = 0x80; }
+    else if ((cp & 0xF0) == 0xE0) { n = 2; cp &= 0x0F; min = 0x800; }
+    else if ((cp & 0xF8) == 0xF0) { n = 3; cp &= 0x07; min = 0x10000; }
+    else goto bad;
+    for (int i = 1; i <= n; ++i) {              // stops at the NUL: it is not a continuation byte
+        if ((p[i] & 0xC0) != 0x80) goto bad;
+        cp = (cp << 6) | (p[i] & 0x3F);
+    }
+    if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) goto bad;
+    *ps += n + 1;
+    return cp;
+bad:
+    *ps += 1;
+    return '?';
+}
+
+/* combining marks, zero-width space/joiners/marks, variation selectors, emoji skin tones and tags */
+static inline bool zero_width(uint32_t cp) {
+    return (cp >= 0x0300 && cp <= 0x036F) || (cp >= 0x200B && cp <= 0x200F) ||
+           (cp >= 0xFE00 && cp <= 0xFE0F) || (cp >= 0x1F3FB && cp <= 0x1F3FF) ||
+           (cp >= 0xE0020 && cp <= 0xE007F);
+}
+
+static inline bool is_emoji(uint32_t cp) {
+    return (cp >= 0x1F000 && cp <= 0x1FAFF) || (cp >= 0x2600 && cp <= 0x27BF);
+}
+
+/* codepoint of the next character cell, 0 at the end; a ZWJ sequence such as a family emoji is one cell */
+static uint32_t next_cell(const char **ps) {
+    bool joined = false;
+    while (**ps) {
+        uint32_t cp = utf8_next(ps);
+        if (cp == 0x200D) { joined = true; continue; }
+        if (zero_width(cp)) continue;
+        if (joined) { joined = false; continue; }
+        return cp;
+    }
+    return 0;
+}
+
+/* ASCII, then two table reads into the generated atlas */
+static const uint8_t *glyph_for(uint32_t cp) {
+    if (cp - 32 < 95) return font5x7[cp - 32];
+    if (cp < oled_glyph_cp_end) {
+        uint8_t blk = oled_glyph_blocks[cp >> OLED_GLYPH_BLOCK_SHIFT];
+        uint16_t idx = blk ? oled_glyph_index[blk - 1][cp & (OLED_GLYPH_BLOCK_SIZE - 1)] : 0;
+        if (idx) return oled_glyph_cols[idx];
+    }
+    if (cp < 32 || cp == 0x7F) return font5x7['?' - 32];
+    return is_emoji(cp) ? glyph_face : glyph_box;
+}
+
+void fb_draw_text_fit(int col, int row, const char *s, int max_cols) {
+    if (row < 0 || row >= MAX_ROWS) return;
+    int x = col * CELL_W;
+    int y = row * CELL_H;
+    uint32_t cp;
+    for (int i = 0; i < max_cols && (cp = next_cell(&s)); ++i) {
+        draw_cols(x, y, glyph_for(cp));
+        x += CELL_W;
+        if (x + 5 > OLED_WIDTH) break;
+    }
+}
+
+size_t fb_text_bytes(const char *s, int max_cols) {
+    const char *p = s;
+    for (int i = 0; i < max_cols && next_cell(&p); ++i) {}
+    // keep marks and joined characters trailing the last cell with it
+    for (const char *q = p; *q; p = q) {
+        uint32_t cp = utf8_next(&q);
+        if (cp == 0x200D && *q) utf8_next(&q);
+        else if (!zero_width(cp)) break;
+    }
+    return (size_t)(p - s);
+}
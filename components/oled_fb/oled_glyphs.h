@@ -0,0 +1,18 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * UTF-8 glyph atlas, generated at build time by tools/gen_glyph_atlas.py (see CMakeLists.txt).
+ * Same column format as font5x7. Lookup for cp < oled_glyph_cp_end:
+ *   blk = oled_glyph_blocks[cp >> OLED_GLYPH_BLOCK_SHIFT]          0 = no glyphs in this block
+ *   idx = oled_glyph_index[blk - 1][cp & (OLED_GLYPH_BLOCK_SIZE - 1)]   0 = not in the atlas
+ *   oled_glyph_cols[idx]
+ */
+#define OLED_GLYPH_BLOCK_SHIFT  6
+#define OLED_GLYPH_BLOCK_SIZE   (1 << OLED_GLYPH_BLOCK_SHIFT)
+
+extern const uint32_t oled_glyph_cp_end;
+extern const uint8_t oled_glyph_cols[][5];
+extern const uint8_t oled_glyph_blocks[];
+extern const uint16_t oled_glyph_index[][OLED_GLYPH_BLOCK_SIZE];
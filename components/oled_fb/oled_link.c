@@ -0,0 +1,225 @@
+#include <stdbool.h>
+#include "esp_check.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "nvs.h"
+#include "driver/i2c_master.h"
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_panel_ops.h"
+#include "esp_lcd_panel_vendor.h"
+#if CONFIG_OLED_FB_PANEL_SH1107_128X128
+#include "esp_lcd_sh1107.h"
+#else
+#include "esp_lcd_panel_ssd1306.h"
+#endif
+#include "oled_fb.h"
+
+#define LINK_NVS_NS         "oled_fb"
+#define LINK_NVS_KEY        "i2c_hz"
+#define LINK_ERR_WINDOW     32      // recent flushes looked at for an error spike, one bit each in s_err_bits
+#define LINK_ERR_SPIKE      3       // failures within the window that trigger a recovery
+#define LINK_VERIFY_FRAMES  4       // frames to re-check a stored tier at boot
+
+static const char *TAG = "oled_fb";
+
+static const uint32_t s_tier_hz[OLED_LINK_TIERS] = { 100000, 400000, 700000, 1000000 };
+
+static i2c_master_bus_handle_t i2c_bus;
+static esp_lcd_panel_io_handle_t s_io;
+static esp_lcd_panel_handle_t panel;
+static int s_tier;                  // index into s_tier_hz, -1 with a fixed clock
+static uint32_t s_err_bits;         // one bit per recent flush, 1 = failed
+static oled_link_stats_t s_stats;
+
+/* ===== panel up/down at a given clock ===== */
+
+static void panel_down(void) {
+    if (panel) esp_lcd_panel_del(panel);
+    if (s_io) esp_lcd_panel_io_del(s_io);
+    panel = NULL;
+    s_io = NULL;
+}
+
+static esp_err_t panel_up(uint32_t hz) {
+    const esp_lcd_panel_dev_config_t panel_cfg_base = {
+        .reset_gpio_num = -1,
+        .bits_per_pixel = 1,
+    };
+#if CONFIG_OLED_FB_PANEL_SH1107_128X128
+    esp_lcd_panel_io_i2c_config_t io_cfg = ESP_LCD_IO_I2C_SH1107_CONFIG();
+    io_cfg.dev_addr = CONFIG_OLED_FB_I2C_ADDR;
+    io_cfg.scl_speed_hz = hz;
+    ESP_RETURN_ON_ERROR(esp_lcd_new_panel_io_i2c(i2c_bus, &io_cfg, &s_io), TAG, "panel io");
+    ESP_RETURN_ON_ERROR(esp_lcd_new_panel_sh1107(s_io, &panel_cfg_base, &panel), TAG, "sh1107");
+#else
+    const esp_lcd_panel_io_i2c_config_t io_cfg = {
+        .dev_addr = CONFIG_OLED_FB_I2C_ADDR,
+        .scl_speed_hz = hz,
+        .control_phase_bytes = 1,
+        .dc_bit_offset = 6,
+        .lcd_cmd_bits = 8,
+        .lcd_param_bits = 8,
+    };
+    ESP_RETURN_ON_ERROR(esp_lcd_new_panel_io_i2c(i2c_bus, &io_cfg, &s_io), TAG, "panel io");
+
+    esp_lcd_panel_ssd1306_config_t ssd1306_cfg = { .height = OLED_HEIGHT };
+    esp_lcd_panel_dev_config_t panel_cfg = panel_cfg_base;
+    panel_cfg.vendor_config = &ssd1306_cfg;
+    ESP_RETURN_ON_ERROR(esp_lcd_new_panel_ssd1306(s_io, &panel_cfg, &panel), TAG, "ssd1306");
+#endif
+    ESP_RETURN_ON_ERROR(esp_lcd_panel_reset(panel), TAG, "reset");
+    ESP_RETURN_ON_ERROR(esp_lcd_panel_init(panel), TAG, "init");
+    ESP_RETURN_ON_ERROR(esp_lcd_panel_disp_on_off(panel, true), TAG, "display on");
+#if CONFIG_OLED_FB_ROTATE_180
+    ESP_RETURN_ON_ERROR(esp_lcd_panel_mirror(panel, true, true), TAG, "mirror");
+#endif
+    s_stats.hz = hz;
+    return ESP_OK;
+}
+
+/* one full frame; counts NACKs and timeouts */
+static esp_err_t link_flush(void) {
+    esp_err_t err = esp_lcd_panel_draw_bitmap(panel, 0, 0, OLED_WIDTH, OLED_HEIGHT, fb);
+#if CONFIG_OLED_FB_PANEL_SH1107_128X128
+    // the SH1107 driver drops transfer errors, a trailing NOP command reports the link state instead
+    if (err == ESP_OK) err = esp_lcd_panel_io_tx_param(s_io, 0xE3, NULL, 0);
+#endif
+    s_stats.flushes++;
+    if (err == ESP_ERR_TIMEOUT) s_stats.timeouts++;
+    else if (err != ESP_OK) s_stats.nacks++;
+    return err;
+}
+
+/* ===== calibration ===== */
+
+#if CONFIG_OLED_FB_I2C_AUTOCAL
+static void tier_store(void) {
+    nvs_handle_t nvs;
+    if (nvs_open(LINK_NVS_NS, NVS_READWRITE, &nvs) != ESP_OK) return;
+    nvs_set_u32(nvs, LINK_NVS_KEY, s_tier_hz[s_tier]);
+    nvs_commit(nvs);
+    nvs_close(nvs);
+}
+
+static int tier_load(void) {
+    nvs_handle_t nvs;
+    uint32_t hz = 0;
+    if (nvs_open(LINK_NVS_NS, NVS_READONLY, &nvs) != ESP_OK) return -1;
+    nvs_get_u32(nvs, LINK_NVS_KEY, &hz);
+    nvs_close(nvs);
+    for (int t = 0; t < OLED_LINK_TIERS; ++t) {
+        if (s_tier_hz[t] == hz && hz <= CONFIG_OLED_FB_I2C_HZ) return t;
+    }
+    return -1;
+}
+
+/* bring the panel up at tier t and flush n frames; returns failed frames, fps x10 via *fps_x10 */
+static int tier_test(int t, int n, uint16_t *fps_x10) {
+    panel_down();
+    i2c_master_bus_reset(i2c_bus);
+    if (panel_up(s_tier_hz[t]) != ESP_OK) return n;
+    int failed = 0;
+    int64_t t0 = esp_timer_get_time();
+    for (int i = 0; i < n; ++i) {
+        if (link_flush() != ESP_OK) failed++;
+    }
+    int64_t us = esp_timer_get_time() - t0;
+    *fps_x10 = us > 0 ? (uint16_t)((int64_t)n * 10000000 / us) : 0;
+    return failed;
+}
+
+static void link_calibrate(void) {
+    int best = -1;
+    for (int t = 0; t < OLED_LINK_TIERS && s_tier_hz[t] <= CONFIG_OLED_FB_I2C_HZ; ++t) {
+        uint16_t fps_x10 = 0;
+        int failed = tier_test(t, CONFIG_OLED_FB_I2C_CAL_FRAMES, &fps_x10);
+        ESP_LOGI(TAG, "%4lu kHz: %d/%d frames failed, %u.%u fps", (unsigned long)(s_tier_hz[t] / 1000),
+                 failed, CONFIG_OLED_FB_I2C_CAL_FRAMES, fps_x10 / 10, fps_x10 % 10);
+        if (failed) break;      // faster tiers only get worse on the same wiring
+        s_stats.tier_fps_x10[t] = fps_x10;
+        best = t;
+    }
+    if (best < 0) {
+        ESP_LOGW(TAG, "no error-free tier, staying at %lu kHz", (unsigned long)(s_tier_hz[0] / 1000));
+        best = 0;
+    }
+    s_tier = best;
+    panel_down();
+    i2c_master_bus_reset(i2c_bus);  // a failed tier may have left a slave holding SDA
+    ESP_ERROR_CHECK(panel_up(s_tier_hz[s_tier]));
+    tier_store();
+}
+#endif
+
+/* reset the bus (clears a slave holding SDA) and re-init the panel, one tier slower when calibrating */
+static void link_recover(void) {
+    s_stats.recoveries++;
+    s_err_bits = 0;
+    panel_down();
+    i2c_master_bus_reset(i2c_bus);
+#if CONFIG_OLED_FB_I2C_AUTOCAL
+    if (s_tier > 0) s_tier--;
+    while (panel_up(s_tier_hz[s_tier]) != ESP_OK) {
+        panel_down();
+        if (s_tier == 0) return;    // retried on the next flush
+        s_tier--;
+    }
+    tier_store();
+#else
+    if (panel_up(CONFIG_OLED_FB_I2C_HZ) != ESP_OK) {
+        panel_down();
+        return;
+    }
+#endif
+    ESP_LOGW(TAG, "I2C link recovered at %lu kHz", (unsigned long)(s_stats.hz / 1000));
+}
+
+/* ===== public ===== */
+
+void oled_init(void) {
+    const i2c_master_bus_config_t bus_cfg = {
+        .i2c_port = I2C_NUM_0,
+        .sda_io_num = CONFIG_OLED_FB_I2C_SDA,
+        .scl_io_num = CONFIG_OLED_FB_I2C_SCL,
+        .clk_source = I2C_CLK_SRC_DEFAULT,
+        .glitch_ignore_cnt = 7,
+        .flags = { .enable_internal_pullup = true },
+    };
+    ESP_ERROR_CHECK(i2c_new_master_bus(&bus_cfg, &i2c_bus));
+    for (int t = 0; t < OLED_LINK_TIERS; ++t) s_stats.tier_hz[t] = s_tier_hz[t];
+
+#if CONFIG_OLED_FB_I2C_AUTOCAL
+    s_tier = tier_load();
+    uint16_t fps_x10 = 0;
+    if (s_tier >= 0 && tier_test(s_tier, LINK_VERIFY_FRAMES, &fps_x10) == 0) {
+        s_stats.tier_fps_x10[s_tier] = fps_x10;
+        ESP_LOGI(TAG, "I2C at stored %lu kHz, %u.%u fps", (unsigned long)(s_stats.hz / 1000),
+                 fps_x10 / 10, fps_x10 % 10);
+        return;
+    }
+    link_calibrate();
+    ESP_LOGI(TAG, "I2C calibrated to %lu kHz", (unsigned long)(s_stats.hz / 1000));
+#else
+    s_tier = -1;
+    ESP_ERROR_CHECK(panel_up(CONFIG_OLED_FB_I2C_HZ));
+#endif
+}
+
+esp_err_t oled_flush_full(void) {
+    if (!panel) {
+        link_recover();
+        if (!panel) return ESP_ERR_INVALID_STATE;
+    }
+    esp_err_t err = link_flush();
+    s_err_bits = (s_err_bits << 1) | (err != ESP_OK);
+    if (__builtin_popcount(s_err_bits) >= LINK_ERR_SPIKE) {
+        ESP_LOGW(TAG, "%d of the last %d flushes failed (%s)", __builtin_popcount(s_err_bits),
+                 LINK_ERR_WINDOW, esp_err_to_name(err));
+        link_recover();
+    }
+    return err;
+}
+
+void oled_link_get_stats(oled_link_stats_t *out) {
+    *out = s_stats;
+}
@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+"""
+Generate the UTF-8 glyph atlas for oled_fb.
+
+Glyphs use the font5x7 format: 5 column bytes, bit 0 = top row, 7 rows.
+Sources, first match wins (a later art file overrides an earlier one):
+  1. art files: a "U+XXXX" line (anything after it is a comment) followed by 7 rows of
+     5 '.'/'#' chars, or "U+XXXX = <ref>" where <ref> is an ASCII char or another U+XXXX
+     (lookalikes such as Cyrillic A). Lines starting with "//" are comments.
+  2. canonical decomposition (unicodedata): base glyph + combining mark, e.g. e + U+0301 -> é
+Lookup tables are two-level: block = cp >> 6 indexes a byte table of block ids, each block
+holds 64 uint16 glyph indices (0 = not in atlas).
+"""
+import argparse
+import re
+import sys
+import unicodedata
+
+BLOCK_SHIFT = 6
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+ROWS = 7
+
+# marks drawn above the base: 2 rows, placed in rows 0..1
+MARKS_ABOVE = {
+    0x0300: ['.#...', '..#..'],     # grave
+    0x0301: ['...#.', '..#..'],     # acute
+    0x0302: ['..#..', '.#.#.'],     # circumflex
+    0x0303: ['.##.#', '#..#.'],     # tilde
+    0x0304: ['.###.', '.....'],     # macron
+    0x0306: ['#...#', '.###.'],     # breve
+    0x0307: ['..#..', '.....'],     # dot above
+    0x0308: ['.#.#.', '.....'],     # diaeresis
+    0x030A: ['.###.', '.#.#.'],     # ring above (closed by the letter's top row)
+    0x030B: ['..#.#', '.#.#.'],     # double acute
+    0x030C: ['.#.#.', '..#..'],     # caron
+}
+# marks drawn below the base: 1 row, placed in row 6
+MARKS_BELOW = {
+    0x0326: '..#..',                # comma below
+    0x0327: '..##.',                # cedilla
+    0x0328: '...##',                # ogonek
+}
+
+
+def rows_to_cols(rows):
+    cols = [0] * 5
+    for r, line in enumerate(rows):
+        for c, ch in enumerate(line):
+            if ch == '#':
+                cols[c] |= 1 << r
+    return cols
+
+
+def cols_to_rows(cols):
+    return [''.join('#' if (cols[c] >> r) & 1 else '.' for c in range(5)) for r in range(ROWS)]
+
+
+def used_rows(cols):
+    bits = 0
+    for c in cols:
+        bits |= c
+    return [r for r in range(ROWS) if (bits >> r) & 1]
+
+
+def squash(rows, n_drop):
+    """Drop n_drop inner rows, preferring rows that repeat a neighbour, then the sparsest."""
+    rows = list(rows)
+    mid = (len(rows) - 1) / 2
+    for _ in range(n_drop):
+        best = None
+        for r in range(1, len(rows) - 1):
+            dup = rows[r] == rows[r - 1] or rows[r] == rows[r + 1]
+            key = (0 if dup else 1, rows[r].count('#'), abs(r - mid))
+            if best is None or key < best[0]:
+                best = (key, r)
+        del rows[best[1]]
+    return rows
+
+
+def compose(base_cols, mark, base_cp):
+    rows = cols_to_rows(base_cols)
+    top = min(used_rows(base_cols) or [ROWS])
+    if mark in MARKS_ABOVE:
+        if base_cp in (0x69, 0x6A, 0x456, 0x458):     # i, j and their Cyrillic twins
+            rows[0] = rows[1] = '.....'             # dotless base
+            top = 2
+        if top < 2:
+            rows = ['.....', '.....'] + squash(rows, 2)
+        rows[0:2] = [merge(a, b) for a, b in zip(rows[0:2], MARKS_ABOVE[mark])]
+        return rows_to_cols(rows)
+    if mark in MARKS_BELOW:
+        if rows[6] != '.....':
+            rows = squash(rows, 1) + ['.....']
+        rows[6] = merge(rows[6], MARKS_BELOW[mark])
+        return rows_to_cols(rows)
+    return None
+
+
+def merge(a, b):
+    return ''.join('#' if x == '#' or y == '#' else '.' for x, y in zip(a, b))
+
+
+def parse_ascii_font(path):
+    text = open(path, encoding='utf-8').read()
+    body = text[text.index('{', text.index('font5x7')) + 1:]
+    glyphs = re.findall(r'\{([^{}]*)\}', body)[:95]
+    font = {}
+    for i, g in enumerate(glyphs):
+        font[32 + i] = [int(v, 16) for v in g.split(',')]
+    return font
+
+
+def parse_art(path, art, alias):
+    lines = open(path, encoding='utf-8').read().splitlines()
+    i = 0
+    while i < len(lines):
+        line = lines[i].strip()
+        i += 1
+        if not line or line.startswith('//'):
+            continue
+        m = re.match(r'U\+([0-9A-Fa-f]{4,6})(?:\s*=\s*(\S+))?', line)
+        if not m:
+            sys.exit(f'{path}:{i}: expected "U+XXXX", got: {line}')
+        cp = int(m.group(1), 16)
+        if m.group(2):
+            ref = m.group(2)
+            alias[cp] = int(ref[2:], 16) if ref.startswith('U+') else ord(ref)
+            art.pop(cp, None)       # later files override earlier ones
+            continue
+        rows = [r.strip() for r in lines[i:i + ROWS]]
+        i += ROWS
+        if len(rows) != ROWS or any(len(r) != 5 or set(r) - set('.#') for r in rows):
+            sys.exit(f'{path}: U+{cp:04X}: expected {ROWS} rows of 5 "." or "#"')
+        art[cp] = rows_to_cols(rows)
+        alias.pop(cp, None)
+
+
+def parse_ranges(spec):
+    cps = set()
+    for part in filter(None, (p.strip() for p in spec.split(','))):
+        lo, _, hi = part.partition('-')
+        lo = int(lo, 0)
+        hi = int(hi, 0) if hi else lo
+        cps.update(range(lo, hi + 1))
+    return sorted(c for c in cps if c > 0x7E)
+
+
+def resolve(cp, font, art, alias, depth=0):
+    if depth > 4:
+        return None
+    if cp in font:
+        return font[cp]
+    if cp in art:
+        return art[cp]
+    if cp in alias:
+        return resolve(alias[cp], font, art, alias, depth + 1)
+    d = unicodedata.decomposition(chr(cp))
+    if d and not d.startswith('<'):
+        parts = [int(x, 16) for x in d.split()]
+        if len(parts) == 2:
+            base = resolve(parts[0], font, art, alias, depth + 1)
+            if base is not None:
+                return compose(base, parts[1], parts[0])
+    return None
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    ap.add_argument('--font', required=True, help='font5x7.c holding the ASCII table')
+    ap.add_argument('--art', action='append', default=[], help='glyph art file, repeatable')
+    ap.add_argument('--ranges', required=True, help='codepoints, e.g. "0xA0-0x17F,0x20AC"')
+    ap.add_argument('--out', help='generated C file')
+    ap.add_argument('--preview', action='store_true', help='print the glyphs instead')
+    args = ap.parse_args()
+
+    font = parse_ascii_font(args.font)
+    art, alias = {}, {}
+    for path in args.art:
+        if path:
+            parse_art(path, art, alias)
+
+    glyphs = []     # (cp, cols)
+    for cp in parse_ranges(args.ranges):
+        cols = resolve(cp, font, art, alias)
+        if cols is not None:
+            glyphs.append((cp, cols))
+
+    if args.preview:
+        for i in range(0, len(glyphs), 12):
+            row = glyphs[i:i + 12]
+            print('  '.join(f'{cp:04X}{chr(cp)}' for cp, _ in row))
+            art_rows = [cols_to_rows(cols) for _, cols in row]
+            for r in range(ROWS):
+                print('  '.join(a[r] for a in art_rows).replace('.', ' '))
+        return
+
+    cp_end = ((glyphs[-1][0] >> BLOCK_SHIFT) + 1) << BLOCK_SHIFT if glyphs else 0
+    blocks = {}     # block number -> [glyph index] * BLOCK_SIZE
+    for idx, (cp, _) in enumerate(glyphs, start=1):
+        blocks.setdefault(cp >> BLOCK_SHIFT, [0] * BLOCK_SIZE)[cp & (BLOCK_SIZE - 1)] = idx
+    if len(blocks) > 255:
+        sys.exit('too many blocks for a uint8_t block table, narrow the ranges')
+    block_ids = {b: i + 1 for i, b in enumerate(sorted(blocks))}
+
+    out = []
+    out.append('/* Generated by gen_glyph_atlas.py from font5x7.c and the glyph art files, do not edit. */')
+    out.append('#include "oled_glyphs.h"')
+    out.append('')
+    out.append(f'const uint32_t oled_glyph_cp_end = 0x{cp_end:X};')
+    out.append('')
+    out.append('/* index 0 is unused: a zero glyph index means "not in the atlas" */')
+    out.append(f'const uint8_t oled_glyph_cols[{len(glyphs) + 1}][5] = {{')
+    out.append('    {0x00,0x00,0x00,0x00,0x00},')
+    for cp, cols in glyphs:
+        out.append('    {%s},  // U+%04X %s' % (','.join(f'0x{c:02X}' for c in cols), cp, chr(cp)))
+    out.append('};')
+    out.append('')
+    out.append('/* cp >> %d -> block id, 0 = empty block */' % BLOCK_SHIFT)
+    n_top = cp_end >> BLOCK_SHIFT
+    top = [block_ids.get(b, 0) for b in range(n_top)]
+    out.append(f'const uint8_t oled_glyph_blocks[{max(n_top, 1)}] = {{')
+    for i in range(0, max(n_top, 1), 16):
+        out.append('    ' + ','.join(str(v) for v in (top[i:i + 16] or [0])) + ',')
+    out.append('};')
+    out.append('')
+    out.append(f'const uint16_t oled_glyph_index[{max(len(blocks), 1)}][{BLOCK_SIZE}] = {{')
+    for b in sorted(blocks):
+        out.append(f'    {{  // U+{b << BLOCK_SHIFT:04X}')
+        v = blocks[b]
+        for i in range(0, BLOCK_SIZE, 16):
+            out.append('        ' + ','.join(str(x) for x in v[i:i + 16]) + ',')
+        out.append('    },')
+    if not blocks:
+        out.append('    {0},')
+    out.append('};')
+    open(args.out, 'w', encoding='utf-8').write('\n'.join(out) + '\n')
+
+
+if __name__ == '__main__':
+    main()
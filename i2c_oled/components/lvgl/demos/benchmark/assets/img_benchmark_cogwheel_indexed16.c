@@ -0,0 +1,148 @@
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+#if LV_USE_DEMO_BENCHMARK
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_IMG_BENCHMARK_COGWHEEL_INDEXED16
+#define LV_ATTRIBUTE_IMAGE_IMG_BENCHMARK_COGWHEEL_INDEXED16
+#endif
+
+static const
+LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_BENCHMARK_COGWHEEL_INDEXED16
+uint8_t img_benchmark_cogwheel_indexed16_map[] = {
+
+    0x4c,0x70,0x47,0x00,0x72,0x64,0x50,0xff,0x82,0x70,0x60,0xff,0x7b,0x6b,0x58,0xff,
+    0x98,0x81,0x6e,0xff,0x6c,0x5e,0x4a,0xff,0x8e,0x78,0x67,0xff,0xa7,0x8e,0x7c,0xff,
+    0x8c,0x81,0x76,0xff,0xa3,0x96,0x8b,0xff,0x81,0x75,0x68,0xff,0xbe,0xb2,0xa8,0xff,
+    0xb3,0x9e,0x8e,0xff,0x6c,0x65,0x5f,0xff,0x7d,0x74,0x72,0xff,0x9d,0x96,0x92,0xff,
+
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc4,0x66,0x66,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x64,0x66,0x67,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x64,0x66,0x24,0x00,0x00,0x00,0x00,0x00,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0xc0,0x00,0x00,0x00,0x00,0x00,0x76,0x44,0x44,0x64,0x00,0x00,0x00,0x00,0x02,0x22,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xc7,0x44,0x7b,0x00,0x00,0x00,0x00,0x0b,0x44,0x44,0x44,0x64,0x90,0x00,0x00,0x00,0x72,0x32,0x2a,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb7,0x44,0x77,0x47,0x00,0x00,0x00,0x00,0x0c,0x46,0x44,0x64,0x66,0x80,0x00,0x00,0x09,0x26,0x62,0x22,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x74,0x74,0x74,0x00,0x00,0x00,0x00,0x09,0x44,0x64,0x64,0x46,0x40,0x00,0x00,0x08,0x26,0xa6,0x26,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc4,0x77,0x47,0x74,0x70,0x00,0x00,0x00,0x07,0x44,0x44,0x44,0x64,0xe0,0x00,0x00,0x04,0x62,0x63,0x62,0x26,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x77,0x74,0x74,0x4c,0x00,0x00,0x00,0xb4,0x44,0x44,0x44,0x66,0x47,0x00,0x00,0x82,0x66,0x62,0x26,0x36,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x47,0x77,0x74,0x77,0xc0,0x00,0xb9,0x46,0x44,0x46,0x44,0x44,0x66,0x4b,0x07,0x26,0x6a,0x6a,0x22,0x2e,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x74,0x74,0x77,0x44,0x74,0x74,0x64,0x44,0x44,0x84,0x46,0x64,0x64,0x62,0xa6,0x64,0x66,0x66,0xa6,0x2e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x77,0x77,0x74,0x77,0x44,0x44,0x44,0x44,0x64,0x46,0x44,0x44,0x66,0x66,0x66,0x26,0x66,0x62,0x63,0x2e,0x00,0x00,0x00,0x00,0x00,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x74,0x74,0x77,0x47,0x74,0x74,0x74,0x44,0x44,0x44,0x46,0x48,0x66,0x64,0x66,0xa6,0x26,0x6a,0x62,0xaa,0x00,0x00,0x00,0x00,0xb8,0x28,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbc,0xc0,0x00,0x00,0x00,0x00,0x0c,0x77,0x77,0x47,0x44,0x47,0x44,0x47,0x44,0x44,0x44,0x48,0x64,0x64,0x66,0xa4,0x66,0x42,0x66,0x26,0x62,0xb0,0x00,0x00,0x09,0x23,0x35,0xa9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x77,0x7c,0x00,0x00,0x00,0x00,0xb7,0x77,0x47,0x74,0x77,0x47,0x74,0x44,0x74,0x44,0x46,0x44,0x64,0x64,0x64,0x66,0xa6,0x62,0x66,0x32,0x22,0x49,0x00,0x00,0x8a,0x33,0x33,0x33,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbc,0x77,0x77,0x7b,0x00,0x00,0x07,0x77,0x77,0x74,0x77,0x44,0x74,0x47,0x44,0x66,0x64,0x44,0x44,0x46,0xa6,0x66,0x64,0x66,0xa6,0x26,0x6a,0x22,0x22,0x40,0x08,0x63,0x33,0x23,0x31,0x2f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x77,0x7c,0x77,0x77,0xc0,0x00,0xc7,0x77,0x47,0x77,0x47,0x77,0x44,0x62,0x2d,0x32,0x64,0x44,0x44,0x66,0x13,0x33,0x32,0x66,0x46,0x66,0x62,0x22,0x23,0x24,0x83,0x33,0x63,0x23,0x23,0x37,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x7c,0x77,0x77,0xc7,0x77,0x77,0x47,0x77,0x77,0x47,0x77,0x64,0x62,0x31,0x55,0x51,0x64,0x44,0x64,0x83,0x55,0x55,0x13,0x32,0x2a,0x22,0x6a,0xa2,0x22,0x33,0x33,0x33,0x32,0x33,0x31,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x77,0xc7,0xc7,0x77,0x77,0x77,0x77,0x77,0x77,0x74,0x46,0x21,0x51,0x15,0x55,0x5d,0x64,0x44,0x44,0x42,0x55,0x55,0x55,0x55,0x32,0x63,0x66,0x22,0x22,0x23,0x36,0x32,0x32,0x33,0x33,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x77,0x77,0x77,0xc7,0x77,0x77,0x77,0x77,0x76,0x23,0x15,0x55,0x51,0x11,0x51,0x64,0x44,0x64,0x62,0x15,0x55,0x55,0x11,0x11,0x33,0x32,0x22,0x22,0x32,0x23,0x23,0x33,0x23,0x33,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb7,0x77,0x7c,0x77,0x77,0x77,0x77,0x77,0x44,0x21,0x55,0x55,0x11,0x55,0x55,0x3e,0x64,0x44,0x44,0x63,0x55,0x31,0x55,0x55,0x11,0x13,0x32,0x22,0x26,0x33,0x23,0x23,0x23,0x23,0x32,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x77,0x77,0x77,0x77,0x77,0x77,0x74,0x43,0x55,0x15,0x15,0x55,0xda,0x8f,0x00,0x74,0x44,0x44,0x65,0xd0,0x00,0x08,0x21,0x55,0x33,0x33,0x22,0x22,0x22,0x36,0x32,0x33,0x31,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0xc7,0x77,0x77,0x77,0x77,0x72,0x11,0x55,0x55,0x15,0xda,0x80,0x00,0x00,0xc4,0x64,0x44,0x2e,0xf0,0x00,0x00,0x09,0x23,0x11,0x33,0x33,0x22,0x23,0x33,0x32,0x32,0x35,0xef,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x77,0x77,0x77,0x77,0x74,0x21,0x55,0x11,0x55,0xd8,0x00,0x00,0x00,0x00,0x94,0x44,0x64,0x66,0x00,0x00,0x00,0x00,0x00,0x61,0x13,0x22,0x32,0x32,0x62,0x23,0x33,0x23,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x77,0x77,0x77,0x77,0x72,0x55,0x51,0x55,0xda,0x00,0x00,0x00,0x00,0x00,0x94,0x44,0x64,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,0x33,0x36,0x33,0x33,0x33,0x32,0x33,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb7,0x77,0x77,0x77,0x74,0x35,0x55,0x15,0x1d,0x80,0x00,0x00,0x00,0x00,0x00,0xc4,0x64,0x44,0x6e,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x33,0x22,0x22,0x63,0x62,0x33,0x31,0xa9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x77,0x77,0xc7,0x73,0x55,0xd1,0x55,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0xc4,0x64,0x44,0x6e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x32,0x22,0x33,0x33,0x32,0x63,0x12,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x77,0x77,0x77,0x74,0x21,0x51,0x55,0xd8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0x46,0x46,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x26,0x66,0x23,0x33,0x33,0x31,0x9b,0xb0,0x98,0x31,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xcc,0x00,0x00,0x00,0xb7,0x77,0x77,0x77,0x72,0x55,0x51,0x55,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc4,0x44,0x44,0xe6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x22,0x62,0x23,0x33,0x32,0x33,0x1a,0xa3,0x15,0x31,0x13,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x07,0x77,0x77,0x7c,0xbb,0xc7,0x77,0x77,0x77,0x65,0x51,0x15,0xd8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0x64,0x66,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x64,0x62,0x23,0x33,0x33,0x31,0x55,0x53,0x13,0x15,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x07,0x47,0x77,0x77,0x77,0x77,0x77,0x77,0x76,0x15,0xd1,0x55,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc4,0x64,0x46,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x66,0x46,0x23,0x33,0x31,0x33,0x33,0x31,0x13,0x15,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x77,0x77,0x74,0x77,0x77,0x77,0x77,0x77,0x43,0x51,0x51,0x5e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0x46,0x66,0x6e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x66,0x46,0x63,0x33,0x12,0x33,0x35,0x21,0x31,0x35,0x1a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x44,0x74,0x77,0x74,0x74,0x74,0x77,0x77,0x21,0x51,0x15,0xdb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0x48,0x46,0x66,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x76,0x44,0x42,0x33,0x33,0x11,0x31,0x35,0x11,0x35,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x44,0x77,0x47,0x47,0x77,0x77,0x74,0x74,0x35,0x11,0x5d,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0x66,0x66,0x6e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x64,0x46,0x23,0x13,0x32,0x13,0x13,0x31,0x11,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x74,0x47,0x77,0x47,0x47,0x47,0x77,0x42,0x15,0x15,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0x44,0x46,0x6e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x44,0x44,0x23,0x33,0x11,0x35,0x25,0x31,0x53,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0xb7,0x44,0x47,0x74,0x74,0x74,0x47,0x43,0x51,0x11,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0x66,0x66,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x76,0x47,0x62,0x31,0x21,0x31,0x31,0x35,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xc7,0x44,0x74,0x74,0x77,0x74,0x25,0x51,0x13,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x66,0x64,0x66,0x26,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb4,0x47,0x42,0x13,0x53,0x52,0x55,0x52,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x77,0x47,0x47,0x44,0x74,0x21,0x11,0x5e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x46,0x46,0x46,0x66,0x64,0x24,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x74,0x76,0x21,0x21,0x31,0x25,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x74,0x47,0x74,0x72,0x11,0x15,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x46,0x66,0x4a,0x46,0x46,0xa6,0x62,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x74,0x21,0x12,0x53,0x11,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x74,0x74,0x47,0x42,0x11,0x13,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0x26,0x44,0x64,0x68,0x66,0x66,0xa6,0x63,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x74,0x63,0x31,0x31,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x74,0x47,0x47,0x43,0x51,0x15,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x23,0x64,0x66,0x66,0x22,0x26,0x66,0x63,0x23,0x32,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x77,0x63,0x52,0x53,0x35,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x44,0x74,0x44,0x63,0x51,0x13,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb6,0x13,0xff,0x7a,0x62,0x36,0xa6,0x26,0x2a,0x88,0x33,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x77,0x43,0x31,0x31,0x15,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x74,0x21,0x51,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x38,0x00,0x08,0x89,0xf9,0x9b,0x94,0x4f,0x00,0x7a,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x7c,0x72,0x52,0x52,0x15,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x0c,0x64,0x74,0x44,0x21,0x15,0x5e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x46,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x93,0x22,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x77,0x76,0x25,0x11,0x31,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x07,0x44,0x44,0x44,0x33,0x13,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x64,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x42,0x23,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x77,0x76,0x25,0x31,0x25,0x33,0x11,0x33,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0b,0x94,0x44,0x74,0x44,0x23,0x23,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb6,0x46,0x66,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x22,0x22,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x77,0x76,0x21,0x31,0x53,0x15,0x55,0x55,0x11,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0xbc,0xc7,0x74,0x44,0x44,0x44,0x44,0x66,0x66,0x64,0x9b,0x0b,0xbb,0xbb,0xbb,0xb0,0xb9,0x46,0x46,0x43,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x32,0x63,0x36,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x72,0x26,0x22,0x11,0x31,0x11,0x11,0x11,0x15,0x55,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x04,0x66,0x46,0x46,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x47,0x77,0x77,0x74,0x44,0x66,0x64,0x64,0x22,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x62,0x32,0x23,0x32,0x32,0x33,0x33,0x33,0x33,0x33,0x11,0x31,0x13,0x53,0x11,0x31,0x11,0x15,0xd1,0x55,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x04,0x66,0x44,0x44,0x64,0x44,0x44,0x44,0x44,0x44,0x46,0x44,0x66,0x66,0x66,0x46,0x66,0x46,0xa4,0x66,0x63,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x43,0x22,0x22,0x32,0x33,0x33,0x33,0x31,0x11,0x11,0x11,0x11,0x13,0x52,0x53,0x51,0x11,0x15,0x5d,0x55,0x5b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x04,0x64,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x84,0x84,0x44,0x64,0x66,0x46,0x46,0x42,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x43,0x22,0x23,0x33,0x32,0x32,0x33,0x33,0x33,0x33,0x33,0x21,0x35,0x21,0x31,0x31,0x15,0x11,0x55,0x55,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x08,0x66,0x46,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x64,0x44,0x46,0x46,0x64,0x64,0x46,0x66,0x66,0x62,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x43,0x22,0x22,0x22,0x23,0x33,0x33,0x33,0x23,0x33,0x13,0x53,0x13,0x53,0x51,0x11,0x15,0x51,0x55,0x55,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x04,0x68,0x44,0x46,0x46,0x44,0x44,0x46,0x44,0x44,0x44,0x44,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x86,0xa2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x62,0x22,0x23,0x32,0x33,0x31,0x33,0x13,0x55,0x55,0x52,0x13,0x55,0x25,0x31,0x11,0x11,0x15,0x55,0x55,0xdb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x04,0x66,0x66,0x64,0x46,0x46,0x46,0x44,0x46,0x46,0x44,0x66,0x44,0x48,0x46,0x64,0x66,0x64,0x66,0x66,0x62,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x23,0x33,0x33,0x32,0x33,0x33,0x33,0x32,0x23,0x23,0x35,0x31,0x25,0x35,0x11,0x51,0x11,0x55,0x5d,0xd3,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x04,0x66,0x64,0x66,0x64,0x64,0x64,0x46,0x22,0x22,0x23,0xe9,0xb0,0x00,0x00,0x00,0x00,0xb9,0x82,0x46,0x62,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x32,0x23,0x63,0x32,0x49,0xb0,0xbb,0xbb,0xb0,0xb9,0x62,0x23,0x22,0x13,0x11,0x15,0xd5,0xdd,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0xbc,0x97,0x78,0x46,0x64,0x66,0x46,0x35,0x55,0x5d,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x66,0x62,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x32,0x32,0x32,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x62,0x63,0x35,0x13,0x11,0x55,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0b,0x94,0x46,0x46,0x42,0x35,0x55,0x5f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x26,0x26,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x23,0x2e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x66,0x62,0x31,0x51,0x55,0x5d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x04,0xa6,0x64,0x46,0x35,0x55,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x62,0x38,0x00,0x00,0x90,0x00,0x00,0x0b,0x00,0x00,0x93,0x31,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x26,0x63,0x13,0x51,0x55,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x64,0x66,0x66,0x21,0x55,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x28,0x00,0x04,0x44,0xbc,0xbc,0x94,0x40,0x00,0xc6,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x66,0x23,0x51,0x11,0x15,0x5f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x66,0x68,0x66,0x21,0x55,0x5a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x36,0x79,0x83,0x22,0xa6,0x44,0x63,0x38,0x9c,0x72,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc6,0x44,0x23,0x51,0x11,0x15,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x46,0x66,0x64,0x61,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x62,0xa6,0x62,0x22,0x22,0x33,0x32,0x32,0xa2,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x66,0x21,0x11,0x51,0x55,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x92,0x6a,0x66,0x63,0x55,0x55,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc6,0x23,0x22,0x62,0x22,0x23,0x22,0x23,0x33,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x46,0x21,0x11,0x5d,0x55,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x96,0xa6,0x66,0x83,0x15,0x55,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x32,0x32,0x22,0x22,0x32,0x22,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x44,0x46,0x11,0x11,0x15,0x55,0x1a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x09,0x86,0x66,0x66,0x66,0x35,0x55,0x5f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x88,0x22,0x22,0x23,0x23,0x33,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x64,0x46,0x51,0x11,0x1d,0x55,0x15,0x5a,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0b,0x76,0x66,0x66,0x66,0x62,0x35,0x55,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x23,0x36,0x31,0x2e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc6,0x74,0x43,0x15,0x15,0x55,0x11,0x55,0x55,0x1a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x92,0x22,0x66,0x6a,0x66,0x6a,0x21,0x55,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x22,0x32,0x31,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0x74,0x61,0x15,0x11,0x15,0x51,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0xb6,0x32,0x66,0x26,0x26,0x26,0x66,0x63,0x15,0x51,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x33,0x23,0x2d,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x44,0x44,0x35,0x11,0x11,0x55,0x15,0x55,0x55,0x55,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0xa2,0x22,0x26,0x36,0x26,0x3a,0x63,0x82,0x31,0x15,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x32,0x22,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x77,0x46,0x35,0x15,0x51,0x15,0x1d,0x55,0x55,0x55,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x42,0x26,0x22,0x6a,0x62,0x66,0x62,0x62,0x31,0x11,0x1a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x33,0x33,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0x77,0x43,0x51,0x51,0x15,0x5d,0x55,0x55,0x55,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0xb4,0x32,0x22,0x22,0x22,0x22,0x63,0x2a,0x23,0x31,0x15,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x93,0x32,0x23,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x47,0x74,0x21,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x5e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x08,0x2a,0x2a,0x62,0x22,0x22,0x22,0x26,0x22,0x33,0x33,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x76,0x13,0x32,0x3a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x77,0x74,0x11,0x15,0xd5,0xd5,0x5d,0x3a,0xd5,0x55,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x09,0x63,0x23,0x22,0x22,0x22,0x22,0x22,0x22,0x21,0x33,0x13,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x32,0x32,0x1a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x77,0x77,0x43,0x55,0x15,0x15,0x55,0xd8,0x00,0xfa,0x11,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x42,0x36,0x28,0x8f,0x82,0x2a,0x22,0x22,0x23,0x33,0x33,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x93,0x33,0x33,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x77,0x74,0x21,0x1d,0x11,0x55,0x5d,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0c,0x9b,0x9b,0x00,0x07,0x32,0x22,0x22,0x22,0x33,0x32,0x32,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x72,0x33,0x23,0x1a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xc7,0x77,0x72,0x15,0x55,0x51,0x55,0x5e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x22,0x23,0x22,0x23,0x33,0x23,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x13,0x33,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x7c,0x77,0x65,0xd5,0x15,0xd5,0x55,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb6,0x33,0x22,0x23,0x22,0x33,0x22,0x22,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x33,0x31,0x1a,0x00,0x00,0x00,0x00,0x00,0x00,0xbc,0x77,0x7c,0x76,0x15,0x15,0x15,0x1d,0x5d,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x33,0x33,0x32,0x23,0x23,0x22,0x23,0x34,0x90,0x00,0x00,0x00,0x00,0x00,0x72,0x13,0x33,0x3e,0x00,0x00,0x00,0x00,0x00,0x0c,0x77,0x7c,0x77,0x61,0x11,0x5d,0x51,0x55,0x5d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x22,0x26,0x33,0x23,0x23,0x22,0x22,0x2a,0x66,0xb0,0x00,0x00,0x00,0x00,0x93,0x12,0x13,0x5a,0x00,0x00,0x00,0x00,0x0b,0x77,0x77,0xc7,0x72,0x15,0x51,0x51,0xd5,0x55,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x33,0x33,0x23,0x36,0x33,0x32,0x26,0xa6,0x62,0x64,0x70,0x00,0x00,0x00,0x82,0x11,0x33,0x1e,0x00,0x00,0x00,0x0c,0x77,0x77,0xc7,0x74,0x35,0x55,0x15,0x55,0x55,0x55,0x51,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb3,0x33,0x33,0x63,0x33,0x36,0x33,0x22,0x66,0x46,0x26,0x67,0xc0,0x00,0x00,0x43,0x33,0x13,0x52,0xb0,0x00,0xbc,0x74,0x77,0x77,0x77,0x62,0x15,0x11,0x11,0x55,0x15,0x55,0x55,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x32,0x33,0x32,0x32,0x33,0x33,0x33,0x22,0x64,0x44,0x46,0x66,0x47,0xbb,0x21,0x13,0x13,0x1a,0x79,0x94,0x64,0x47,0x77,0x77,0x42,0x35,0x5d,0x5d,0x5d,0x11,0x51,0x55,0x15,0x51,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x33,0x33,0x33,0x33,0x33,0x32,0x23,0x23,0x33,0x36,0x64,0x44,0x44,0x44,0x44,0x23,0x35,0x25,0x23,0x64,0x44,0x47,0x74,0x74,0x62,0x15,0x11,0x51,0x55,0x55,0x5d,0x51,0x15,0x55,0x55,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x93,0x33,0x23,0x23,0x23,0x23,0x23,0x33,0x33,0x33,0x33,0x22,0x44,0x47,0x47,0x74,0x33,0x13,0x15,0x32,0x44,0x44,0x44,0x44,0x62,0x31,0x11,0x55,0x15,0x15,0x55,0x55,0x55,0x51,0x55,0x55,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x22,0x24,0x44,0x74,0x21,0x12,0x13,0x32,0x64,0x44,0x66,0x23,0x35,0x51,0x5d,0x15,0x55,0x15,0x55,0xd5,0x55,0x51,0x55,0x55,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x53,0x33,0x33,0x31,0x52,0x33,0x13,0x33,0x33,0x31,0x33,0x33,0x32,0x26,0x66,0x23,0x53,0x11,0x52,0x66,0x62,0x23,0x55,0x51,0x15,0x15,0x51,0xd1,0x55,0xde,0xb0,0x85,0x55,0x55,0x5e,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x31,0x33,0x31,0x32,0xe8,0x98,0x23,0x13,0x33,0x33,0x11,0x33,0x13,0x33,0x13,0x53,0x51,0x23,0x35,0x11,0x51,0x51,0x11,0x11,0x11,0x11,0x55,0x55,0x5d,0xf0,0x00,0x08,0x15,0x55,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x51,0x53,0xa8,0x00,0x00,0xba,0x11,0x13,0x13,0x33,0x11,0x31,0x11,0x15,0x25,0x25,0x15,0x13,0x15,0x11,0x11,0x11,0x11,0x55,0x5d,0x15,0x5d,0xd0,0x00,0x00,0x00,0x05,0x5a,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x22,0x29,0x00,0x00,0x00,0x00,0x73,0x13,0x13,0x13,0x31,0x31,0x12,0x31,0x25,0x25,0x33,0x53,0x11,0x11,0x11,0x11,0x51,0x1d,0x55,0x15,0x5d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb9,0xb0,0x00,0x00,0x00,0x00,0xb2,0x51,0x31,0x11,0x11,0x31,0x35,0x35,0x31,0x13,0x11,0x11,0x11,0x11,0x11,0x5d,0x5d,0x55,0x55,0xd5,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x93,0x51,0x33,0x13,0x31,0x35,0x35,0x25,0x35,0x35,0x31,0x35,0x11,0x15,0x51,0x55,0x55,0x51,0x55,0x55,0xd8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x13,0x15,0x21,0x13,0x53,0x51,0x53,0x53,0x53,0x55,0x11,0x11,0x51,0x55,0x55,0x55,0x15,0x15,0x55,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0x31,0x25,0x35,0x35,0x52,0x22,0x35,0x35,0x53,0x51,0x11,0x55,0x5d,0xd8,0x88,0xa5,0x55,0x55,0x55,0x5a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0x31,0x13,0x52,0x55,0xe0,0x00,0x92,0x53,0x15,0x15,0x15,0x5d,0xe0,0x00,0x00,0x05,0x55,0x15,0x55,0x5a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x15,0x35,0x33,0x55,0x5e,0x00,0x00,0x0a,0x15,0x11,0x15,0x15,0x5e,0x00,0x00,0x00,0x08,0x55,0x11,0x55,0x51,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x55,0x31,0x35,0x35,0xdb,0x00,0x00,0x08,0x15,0x11,0x5d,0x55,0xdf,0x00,0x00,0x00,0x0b,0x55,0x55,0x55,0x5a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x55,0x55,0x53,0x80,0x00,0x00,0x09,0x35,0x51,0x51,0x55,0xe0,0x00,0x00,0x00,0x00,0x85,0x55,0x55,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x46,0x31,0x38,0x00,0x00,0x00,0x0f,0x35,0x15,0x15,0x55,0x30,0x00,0x00,0x00,0x00,0x08,0x3a,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x98,0x00,0x00,0x00,0x00,0x0f,0x35,0x55,0x55,0x55,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x55,0x55,0x5d,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xba,0xa8,0xaa,0xa8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+
+};
+
+const lv_img_dsc_t img_benchmark_cogwheel_indexed16 = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_I4,
+  .header.flags = 0,
+  .header.w = 100,
+  .header.h = 100,
+  .header.stride = 64,
+  .data_size = 6464,
+  .data = img_benchmark_cogwheel_indexed16_map,
+};
+
+#endif
@@ -0,0 +1,142 @@
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+#if LV_USE_DEMO_BENCHMARK
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_IMG_BENCHMARK_COGWHEEL_RGB
+#define LV_ATTRIBUTE_IMAGE_IMG_BENCHMARK_COGWHEEL_RGB
+#endif
+
+static const
+LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_BENCHMARK_COGWHEEL_RGB
+uint8_t img_benchmark_cogwheel_rgb_map[] = {
+
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xd5,0x8c,0xf2,0x6b,0xd1,0x63,0xd2,0x6b,0xd2,0x6b,0xb1,0x63,0x12,0x74,0x9a,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x53,0x7c,0xb1,0x63,0xd1,0x63,0xd2,0x63,0xd1,0x63,0xb1,0x63,0xb1,0x63,0x53,0x7c,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x33,0x74,0xd1,0x63,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0xb1,0x63,0xf2,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x9a,0xd6,0x15,0x95,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xd5,0x8c,0x33,0x74,0xd8,0xb5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xde,0x33,0x74,0xd2,0x63,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xb1,0x63,0xf2,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x9a,0xce,0x90,0x63,0x90,0x5b,0x70,0x5b,0xf1,0x6b,0xd4,0x8c,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x7a,0xc6,0xb5,0x84,0x74,0x7c,0x54,0x74,0x13,0x74,0x53,0x74,0x19,0xbe,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x19,0xbe,0x33,0x74,0xd2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x63,0xf2,0x6b,0x93,0x8c,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x53,0x7c,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x90,0x63,0xb1,0x63,0xf1,0x6b,0x73,0x7c,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf9,0xbd,0x74,0x7c,0x13,0x6c,0x33,0x74,0x33,0x74,0x53,0x74,0x13,0x6c,0x74,0x7c,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xd5,0x8c,0x13,0x74,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0xd2,0x6b,0x12,0x7c,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x56,0xa5,0xb1,0x63,0x90,0x63,0xb0,0x63,0xb0,0x63,0x90,0x63,0x70,0x5b,0x4f,0x53,0x70,0x5b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x1c,0xdf,0xd5,0x8c,0x13,0x74,0x54,0x74,0x54,0x7c,0x54,0x74,0x54,0x74,0x33,0x74,0x33,0x74,0x5a,0xc6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x94,0x84,0x13,0x74,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd1,0x6b,0xf1,0x73,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x12,0x74,0x70,0x5b,0xb1,0x63,0xb1,0x63,0xb0,0x63,0x90,0x63,0x90,0x63,0x4f,0x5b,0x70,0x5b,0x9a,0xce,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x77,0xa5,0x34,0x74,0x54,0x7c,0x54,0x7c,0x54,0x74,0x54,0x74,0x34,0x74,0x33,0x74,0x53,0x74,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x54,0x7c,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd1,0x63,0xf1,0x73,0xbb,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x59,0xc6,0xf1,0x6b,0x90,0x5b,0xb1,0x63,0xb1,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x70,0x5b,0xb0,0x63,0x56,0xa5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xd8,0xb5,0x54,0x7c,0x54,0x74,0x54,0x7c,0x54,0x74,0x54,0x74,0x54,0x74,0x33,0x74,0x13,0x6c,0x97,0xa5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x39,0xbe,0x13,0x74,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd1,0x6b,0xd1,0x6b,0x53,0x7c,0xbb,0xd6,0xfb,0xde,0xfb,0xde,0xdb,0xde,0xf2,0x6b,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x70,0x5b,0xb0,0x6b,0x35,0xa5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xb8,0xad,0x54,0x74,0x54,0x74,0x54,0x7c,0x54,0x74,0x54,0x74,0x34,0x74,0x33,0x74,0x33,0x74,0x54,0x7c,0xb8,0xad,0xdb,0xd6,0xdb,0xd6,0xba,0xd6,0xd8,0xb5,0x94,0x84,0x13,0x74,0xf2,0x6b,0x12,0x6c,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0xf2,0x6b,0xd1,0x63,0x53,0x7c,0xb8,0xad,0x9a,0xce,0x73,0x7c,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb0,0x63,0x90,0x63,0x90,0x5b,0x70,0x5b,0xb0,0x6b,0x76,0xad,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x7a,0xce,0x75,0x7c,0x34,0x74,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x34,0x74,0x34,0x74,0x53,0x74,0x33,0x74,0x13,0x74,0x33,0x74,0x33,0x74,0x13,0x6c,0xf2,0x6b,0x13,0x74,0x13,0x74,0x12,0x6c,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xf1,0x6b,0xd1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb0,0x63,0x90,0x63,0x90,0x5b,0x70,0x5b,0xb0,0x73,0xdb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x37,0x9d,0x54,0x7c,0x54,0x74,0x54,0x7c,0x54,0x74,0x54,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x13,0x74,0x13,0x6c,0x13,0x74,0x12,0x6c,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0xd1,0x6b,0xd1,0x63,0xd1,0x6b,0xd1,0x6b,0xb1,0x63,0xd1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb0,0x63,0x90,0x63,0x90,0x5b,0x90,0x63,0xf1,0x7b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xb7,0xad,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfc,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x5a,0xc6,0x74,0x7c,0x34,0x74,0x54,0x7c,0x54,0x7c,0x54,0x74,0x53,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x13,0x74,0x13,0x74,0x12,0x6c,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0xd1,0x6b,0xd1,0x6b,0xd1,0x6b,0xd1,0x6b,0xd1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb0,0x63,0x90,0x63,0x90,0x5b,0x90,0x63,0xf0,0x73,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x18,0xbe,0x32,0x74,0xb0,0x63,0xd1,0x6b,0xf8,0xb5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf9,0xb5,0xf6,0x8c,0x37,0x95,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x77,0xa5,0x54,0x7c,0x54,0x74,0x54,0x7c,0x54,0x74,0x54,0x74,0x34,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x13,0x74,0x13,0x74,0x13,0x74,0x13,0x74,0x12,0x6c,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd1,0x6b,0xd1,0x6b,0xd1,0x63,0xd1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb0,0x63,0x90,0x63,0x90,0x63,0x70,0x5b,0xb0,0x6b,0x18,0xbe,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xd4,0x8c,0xd1,0x63,0x4f,0x53,0xd1,0x6b,0x0e,0x4b,0x90,0x63,0x76,0xad,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x98,0xa5,0xb6,0x84,0x55,0x7c,0x75,0x7c,0xb6,0x84,0xdb,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x19,0xbe,0x74,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x74,0x54,0x74,0x54,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x13,0x74,0x13,0x74,0x12,0x6c,0x12,0x6c,0x12,0x6c,0x12,0x6c,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd1,0x6b,0xd1,0x63,0xd1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0x90,0x63,0x90,0x63,0xb0,0x63,0x70,0x5b,0xf1,0x6b,0xf8,0xbd,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x52,0x7c,0x90,0x5b,0x2f,0x53,0x4f,0x53,0x6f,0x5b,0x6f,0x5b,0x0e,0x4b,0x6f,0x5b,0x35,0x9d,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xb8,0xad,0xb6,0x84,0x95,0x7c,0x95,0x84,0x75,0x7c,0x75,0x7c,0x95,0x84,0xf9,0xb5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x7a,0xce,0xb5,0x84,0x74,0x7c,0x54,0x7c,0x74,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x74,0x34,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x13,0x74,0xf2,0x6b,0xd1,0x6b,0xd1,0x63,0xf2,0x6b,0x12,0x6c,0x12,0x6c,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xd1,0x6b,0xd1,0x6b,0xd1,0x63,0xd1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0xb0,0x63,0x70,0x5b,0x90,0x63,0xf1,0x6b,0x9a,0xce,0xfb,0xde,0x11,0x74,0x6f,0x5b,0x2f,0x53,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x0e,0x4b,0x6f,0x5b,0xb7,0xad,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x19,0xbe,0xb6,0x84,0x75,0x7c,0x96,0x84,0x95,0x84,0x95,0x84,0x95,0x84,0x75,0x7c,0x95,0x84,0x78,0xa5,0xfb,0xde,0xfb,0xde,0x7a,0xc6,0xb5,0x84,0x54,0x74,0x54,0x7c,0x74,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x74,0x54,0x74,0x54,0x74,0x54,0x74,0x33,0x74,0x12,0x6c,0xd1,0x63,0x90,0x63,0x6f,0x5b,0x4f,0x53,0x2e,0x53,0x4f,0x53,0xd1,0x6b,0x12,0x6c,0x12,0x6c,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0x90,0x63,0x4e,0x53,0x2e,0x53,0x2e,0x53,0x4f,0x53,0x70,0x5b,0x90,0x63,0xb1,0x63,0xd1,0x63,0xd1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0xb0,0x63,0x4f,0x53,0x6f,0x5b,0x12,0x74,0x11,0x74,0x4f,0x5b,0x4f,0x53,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x5b,0x6f,0x5b,0x4f,0x53,0x2e,0x53,0x93,0x84,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x57,0x9d,0x75,0x7c,0x95,0x84,0x95,0x84,0x95,0x84,0x95,0x84,0x95,0x7c,0x75,0x7c,0x75,0x7c,0x75,0x7c,0x95,0x84,0x95,0x7c,0x75,0x7c,0x54,0x7c,0x74,0x7c,0x74,0x7c,0x74,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x74,0x13,0x74,0xf2,0x6b,0xb1,0x63,0x70,0x5b,0x4f,0x53,0x0e,0x4b,0xed,0x4a,0xed,0x4a,0xcc,0x42,0x0e,0x53,0xd1,0x63,0x13,0x6c,0x12,0x6c,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0x70,0x5b,0x0d,0x4b,0xcc,0x42,0xed,0x4a,0xed,0x4a,0x0e,0x4b,0x2e,0x53,0x4f,0x53,0x6f,0x5b,0x90,0x5b,0xb1,0x63,0xb1,0x63,0xb1,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x5b,0x90,0x5b,0x90,0x5b,0x70,0x5b,0x4f,0x53,0x4f,0x53,0x6f,0x5b,0x70,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x5b,0x4f,0x5b,0x2e,0x53,0x4f,0x5b,0x35,0x9d,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x78,0xa5,0x75,0x7c,0x95,0x7c,0x95,0x84,0x95,0x7c,0x95,0x7c,0x75,0x7c,0x75,0x7c,0x95,0x7c,0x75,0x7c,0x75,0x7c,0x75,0x7c,0x74,0x7c,0x74,0x7c,0x74,0x7c,0x74,0x7c,0x74,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x74,0x33,0x74,0xf2,0x6b,0x90,0x5b,0x2e,0x53,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0x2e,0x53,0xd1,0x63,0x12,0x6c,0x12,0x6c,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0x90,0x5b,0x0e,0x4b,0xed,0x42,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0x2e,0x53,0x6f,0x5b,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x5b,0x90,0x5b,0x90,0x5b,0x70,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x5b,0x4f,0x53,0x2e,0x53,0x8f,0x63,0x96,0xad,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x9b,0xce,0x95,0x84,0x75,0x7c,0x95,0x84,0x95,0x7c,0x95,0x7c,0x75,0x7c,0x95,0x7c,0x95,0x7c,0x95,0x7c,0x75,0x7c,0x75,0x7c,0x75,0x7c,0x75,0x7c,0x74,0x7c,0x74,0x7c,0x74,0x7c,0x74,0x7c,0x74,0x7c,0x34,0x74,0xd2,0x6b,0x6f,0x5b,0x2e,0x53,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0x2e,0x53,0xd1,0x63,0x12,0x6c,0x12,0x6c,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0x90,0x5b,0x0e,0x4b,0xed,0x42,0xed,0x42,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0x0e,0x4b,0x2e,0x53,0x2e,0x53,0x4f,0x5b,0x90,0x5b,0x90,0x63,0x90,0x63,0x90,0x5b,0x90,0x5b,0x90,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x5b,0x4f,0x53,0x2e,0x53,0xd0,0x73,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x5a,0xc6,0x75,0x7c,0x75,0x7c,0x95,0x84,0x95,0x7c,0x95,0x7c,0x95,0x7c,0x95,0x7c,0x75,0x7c,0x75,0x7c,0x75,0x7c,0x75,0x7c,0x75,0x7c,0x74,0x7c,0x74,0x7c,0x75,0x7c,0x54,0x7c,0xf2,0x6b,0x90,0x5b,0x2e,0x53,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0xcd,0x4a,0x0d,0x53,0x4e,0x5b,0x6f,0x63,0xd1,0x6b,0x13,0x6c,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd1,0x6b,0x2f,0x5b,0xac,0x4a,0xed,0x52,0x4e,0x5b,0x2e,0x53,0xed,0x4a,0xac,0x42,0xed,0x42,0x0d,0x4b,0x0e,0x53,0x0e,0x53,0x0e,0x53,0x2e,0x53,0x4f,0x53,0x6f,0x5b,0x90,0x5b,0x90,0x63,0x90,0x63,0x90,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x53,0x2e,0x53,0x6f,0x63,0x15,0xa5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x5a,0xc6,0x75,0x7c,0x75,0x7c,0x95,0x7c,0x95,0x7c,0x95,0x7c,0x75,0x7c,0x75,0x7c,0x75,0x7c,0x75,0x7c,0x74,0x7c,0x75,0x7c,0x75,0x7c,0x75,0x7c,0x33,0x74,0xd1,0x6b,0x4f,0x53,0xed,0x4a,0xec,0x4a,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0xed,0x4a,0x0d,0x53,0x8f,0x63,0x32,0x7c,0xd7,0xb5,0xfb,0xde,0xdb,0xde,0x33,0x7c,0x12,0x6c,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0x12,0x6c,0xb1,0x63,0x0e,0x5b,0x2e,0x63,0x39,0xc6,0xfb,0xde,0xfb,0xde,0xba,0xd6,0x52,0x7c,0xd0,0x63,0x0e,0x4b,0xed,0x4a,0xee,0x4a,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2f,0x53,0x6f,0x5b,0x90,0x5b,0x90,0x63,0x90,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x53,0x0e,0x5b,0xaf,0x73,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xd6,0x8c,0x75,0x7c,0x95,0x7c,0x95,0x7c,0x75,0x7c,0x75,0x7c,0x75,0x7c,0x75,0x7c,0x74,0x7c,0x75,0x7c,0x75,0x7c,0x75,0x7c,0x34,0x74,0x90,0x63,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0x0d,0x53,0x2e,0x5b,0xaf,0x73,0x31,0x84,0xdb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf5,0x8c,0x12,0x6c,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0x90,0x63,0x6f,0x63,0x97,0xb5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xde,0x72,0x84,0xb0,0x63,0x4f,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x5b,0x70,0x5b,0x90,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0xee,0x52,0x4e,0x63,0xd7,0xbd,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf6,0x8c,0x75,0x7c,0x75,0x7c,0x75,0x7c,0x75,0x7c,0x75,0x7c,0x75,0x7c,0x75,0x7c,0x95,0x7c,0x75,0x7c,0x13,0x74,0x70,0x5b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0x2d,0x5b,0xd0,0x7b,0x9a,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x16,0x95,0x12,0x6c,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0x90,0x63,0xb0,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x7a,0xce,0xb0,0x63,0x2e,0x53,0x2e,0x53,0x4f,0x5b,0x4f,0x5b,0x4f,0x5b,0x6f,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x53,0x0e,0x53,0xd0,0x73,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf6,0x8c,0x74,0x7c,0x74,0x7c,0x75,0x7c,0x75,0x7c,0x74,0x7c,0x75,0x7c,0x95,0x7c,0x75,0x7c,0x13,0x6c,0x70,0x5b,0x0d,0x4b,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0x0d,0x53,0xaf,0x73,0x9a,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf5,0x94,0x12,0x74,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xb1,0x63,0xd0,0x73,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x59,0xc6,0xd1,0x6b,0x0e,0x53,0x4f,0x53,0x70,0x5b,0x6f,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x53,0x2e,0x53,0xf1,0x73,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x39,0xbe,0x95,0x84,0x74,0x7c,0x75,0x7c,0x75,0x7c,0x74,0x7c,0x75,0x7c,0x75,0x7c,0x75,0x7c,0x13,0x6c,0x6f,0x5b,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0x0e,0x4b,0xed,0x4a,0x4e,0x63,0x31,0x84,0xba,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf5,0x94,0x12,0x74,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xb1,0x63,0xd1,0x73,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x7a,0xce,0x12,0x74,0x6f,0x5b,0x4f,0x53,0x90,0x63,0x90,0x5b,0x90,0x5b,0x90,0x5b,0x70,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x5b,0x2e,0x53,0x90,0x63,0x97,0xad,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xb5,0x84,0x54,0x7c,0x74,0x7c,0x74,0x7c,0x74,0x7c,0x74,0x7c,0x75,0x7c,0x75,0x7c,0x13,0x74,0x6f,0x5b,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0x0e,0x4b,0x2e,0x53,0xed,0x52,0x6e,0x6b,0xf7,0xbd,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf5,0x94,0x12,0x6c,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xb1,0x63,0xd1,0x73,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x15,0x9d,0x70,0x5b,0x70,0x5b,0xb0,0x63,0x90,0x63,0xb0,0x63,0x90,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x5b,0x2e,0x53,0x90,0x5b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xde,0xf8,0xb5,0xd7,0xb5,0x76,0xa5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xb8,0xad,0x74,0x7c,0x54,0x7c,0x74,0x7c,0x74,0x7c,0x74,0x7c,0x75,0x7c,0x75,0x7c,0x33,0x74,0x6f,0x5b,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0x0e,0x4b,0x0e,0x53,0xed,0x52,0xd0,0x7b,0x9a,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf5,0x94,0x12,0x6c,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xb1,0x63,0xf1,0x73,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x39,0xbe,0xf1,0x6b,0x70,0x5b,0xb0,0x63,0xb1,0x63,0xb1,0x63,0x90,0x63,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x5b,0x4f,0x5b,0x4f,0x5b,0x2e,0x53,0x2e,0x53,0x56,0x9d,0x39,0xc6,0x39,0xc6,0x18,0xbe,0x96,0xad,0xf1,0x6b,0x6f,0x5b,0x0e,0x4b,0xed,0x4a,0x11,0x74,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf6,0x94,0x36,0x95,0xbb,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x39,0xbe,0x54,0x7c,0x54,0x74,0x75,0x7c,0x74,0x7c,0x74,0x7c,0x74,0x7c,0x75,0x7c,0x33,0x74,0x90,0x5b,0x0d,0x4b,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0x0d,0x53,0xed,0x52,0xd0,0x7b,0x9a,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf5,0x94,0x12,0x6c,0xd2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0xb1,0x63,0xf1,0x73,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x39,0xc6,0xf1,0x6b,0x90,0x5b,0xd1,0x63,0xd1,0x63,0xb1,0x63,0x90,0x5b,0x6f,0x5b,0x4f,0x5b,0x6f,0x5b,0x4f,0x5b,0x4f,0x53,0x4f,0x5b,0x4f,0x53,0x4f,0x5b,0x90,0x63,0xb0,0x63,0x4f,0x5b,0x0e,0x4b,0x0e,0x4b,0x8f,0x63,0x8f,0x63,0x6f,0x5b,0x4e,0x53,0x73,0x84,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xb5,0x84,0x34,0x74,0x54,0x7c,0x95,0x7c,0xb5,0x8c,0xf6,0x94,0x57,0x9d,0x19,0xbe,0xb8,0xad,0xb5,0x84,0x54,0x7c,0x74,0x7c,0x74,0x7c,0x74,0x7c,0x74,0x7c,0x74,0x7c,0x54,0x74,0xb1,0x63,0x0d,0x4b,0xed,0x4a,0x0d,0x4b,0x0e,0x4b,0x2e,0x53,0xed,0x52,0xf0,0x7b,0xba,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf5,0x94,0x12,0x6c,0xd2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0xb1,0x63,0xf1,0x73,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x39,0xbe,0x12,0x6c,0xb1,0x63,0xd1,0x6b,0xd1,0x6b,0xd1,0x63,0x90,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x5b,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x2e,0x53,0x0e,0x53,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0xed,0x4a,0xb0,0x63,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xd6,0x74,0x7c,0x33,0x74,0x54,0x7c,0x34,0x74,0x54,0x74,0x54,0x7c,0x74,0x7c,0x95,0x84,0x95,0x84,0x54,0x7c,0x74,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x74,0x7c,0x54,0x7c,0xd1,0x6b,0x2e,0x53,0xed,0x4a,0x0d,0x4b,0x0e,0x4b,0x0e,0x4b,0xed,0x52,0xd0,0x7b,0xba,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf5,0x94,0x12,0x6c,0xd2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0xb1,0x63,0xf1,0x73,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x39,0xc6,0xf2,0x6b,0xb1,0x63,0xd2,0x6b,0xd2,0x6b,0xb1,0x63,0x90,0x5b,0x4f,0x5b,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0xed,0x4a,0x2e,0x53,0x39,0xc6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xb5,0x84,0x54,0x74,0x54,0x74,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x74,0x34,0x74,0x54,0x74,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x33,0x74,0x6f,0x5b,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0x0e,0x4b,0xed,0x52,0x6f,0x6b,0x9a,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf5,0x94,0x12,0x6c,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x63,0xb1,0x63,0xd1,0x73,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xd5,0x8c,0xb1,0x63,0xd2,0x63,0xf2,0x6b,0xf2,0x6b,0xb1,0x63,0x4f,0x5b,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x4b,0x0e,0x53,0xd0,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x33,0x74,0x33,0x74,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x74,0x7c,0x34,0x74,0xb1,0x63,0x0e,0x53,0xed,0x4a,0x0d,0x4b,0x0e,0x4b,0xed,0x4a,0x4e,0x63,0xf8,0xc5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf5,0x94,0xf2,0x6b,0xd2,0x6b,0xf2,0x6b,0xd2,0x6b,0xd2,0x63,0xb1,0x63,0xd1,0x73,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x74,0x7c,0xd2,0x63,0xf2,0x6b,0x13,0x74,0xf2,0x6b,0x90,0x5b,0x4f,0x5b,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x4b,0x0e,0x4b,0x4e,0x5b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0x9a,0xce,0x13,0x74,0x13,0x74,0x54,0x74,0x54,0x74,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0xf2,0x6b,0x2e,0x53,0xed,0x4a,0x0d,0x4b,0x0e,0x4b,0xed,0x4a,0x2d,0x5b,0x52,0x8c,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf5,0x94,0xf2,0x6b,0xd1,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x63,0x91,0x63,0xd1,0x73,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xbb,0xd6,0x12,0x6c,0xf2,0x6b,0x13,0x74,0x13,0x74,0xd1,0x6b,0x6f,0x5b,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x53,0xed,0x4a,0x0e,0x53,0x31,0x7c,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0x9a,0xce,0x33,0x74,0x13,0x74,0x33,0x74,0x34,0x74,0x54,0x74,0x54,0x74,0x54,0x74,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x7c,0x54,0x74,0x54,0x74,0x54,0x7c,0x33,0x74,0xb1,0x63,0x0d,0x4b,0xed,0x4a,0x0e,0x4b,0x0d,0x4b,0xed,0x52,0x11,0x7c,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf5,0x94,0xf2,0x6b,0xd1,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x63,0x90,0x63,0xd1,0x73,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf5,0x94,0x13,0x74,0xf2,0x6b,0x33,0x74,0x13,0x6c,0x90,0x63,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x4b,0x0e,0x4b,0x0e,0x53,0x11,0x7c,0xbb,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x19,0xbe,0x33,0x74,0xf3,0x6b,0x33,0x74,0x53,0x74,0x54,0x74,0x54,0x74,0x54,0x74,0x34,0x74,0x54,0x74,0x54,0x74,0x33,0x74,0x54,0x74,0x54,0x7c,0xf2,0x6b,0x2e,0x53,0xed,0x4a,0x0d,0x4b,0x0e,0x4b,0xed,0x4a,0x4e,0x63,0x9a,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x94,0x84,0xd2,0x6b,0xd1,0x6b,0xd2,0x6b,0xd2,0x6b,0xd1,0x63,0x90,0x63,0xd1,0x6b,0xdb,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x74,0x7c,0xd2,0x6b,0x33,0x74,0x33,0x74,0xd2,0x6b,0x6f,0x5b,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0xed,0x4a,0x4e,0x63,0x55,0xa5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xde,0x57,0xa5,0x74,0x7c,0x13,0x6c,0x13,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x54,0x74,0x34,0x74,0x90,0x63,0xed,0x4a,0xed,0x4a,0x0e,0x4b,0x0d,0x4b,0x2e,0x5b,0x11,0x84,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xbb,0xd6,0xd5,0x8c,0xf2,0x6b,0xd1,0x63,0xd2,0x6b,0xd2,0x6b,0xd1,0x6b,0xd1,0x63,0xb1,0x63,0xd1,0x6b,0x53,0x7c,0xbb,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf9,0xb5,0x13,0x6c,0x33,0x74,0x33,0x74,0x13,0x74,0x90,0x63,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x53,0xed,0x52,0x6f,0x6b,0xd7,0xbd,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x5a,0xc6,0x94,0x84,0x33,0x74,0x53,0x7c,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x34,0x74,0x33,0x74,0x12,0x6c,0x6f,0x5b,0x0d,0x4b,0x0d,0x4b,0x2e,0x4b,0xed,0x4a,0x6f,0x6b,0xba,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xde,0x74,0x7c,0x33,0x74,0xd2,0x6b,0xf2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd1,0x6b,0xd1,0x63,0xd1,0x63,0xd1,0x6b,0xb1,0x63,0x12,0x74,0x94,0x84,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xb5,0x84,0x33,0x74,0x54,0x74,0x54,0x7c,0xd1,0x6b,0x4f,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x4e,0x53,0xed,0x52,0x0d,0x63,0xf7,0xbd,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x5a,0xc6,0x74,0x7c,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x54,0x74,0x33,0x74,0xb1,0x63,0x2e,0x53,0x0d,0x4b,0x0e,0x4b,0x0e,0x4b,0x0d,0x53,0x10,0x84,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x19,0xbe,0x13,0x74,0xb1,0x63,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd1,0x6b,0xd1,0x6b,0xd1,0x63,0xd1,0x63,0xd1,0x63,0xb1,0x63,0x90,0x63,0x90,0x5b,0xf2,0x6b,0x7a,0xce,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x7a,0xce,0x33,0x74,0x54,0x74,0x74,0x7c,0x13,0x6c,0x90,0x5b,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x4f,0x53,0xed,0x52,0x76,0xb5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xde,0x94,0x84,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x34,0x74,0x33,0x74,0x70,0x5b,0x0d,0x4b,0x0e,0x4b,0x2e,0x4b,0x0d,0x4b,0x2e,0x5b,0x96,0xb5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xb4,0x84,0xb1,0x63,0x90,0x63,0xd2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd1,0x6b,0xd1,0x6b,0xd1,0x63,0xd1,0x63,0xb1,0x63,0xd1,0x63,0xd1,0x63,0xd1,0x6b,0x4f,0x5b,0xb0,0x63,0x94,0x84,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x54,0x74,0x54,0x74,0x75,0x7c,0x54,0x74,0xd1,0x63,0x4f,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x6f,0x5b,0x2e,0x5b,0xba,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xbb,0xd6,0x53,0x74,0x53,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x12,0x6c,0x4f,0x53,0xed,0x4a,0x0e,0x4b,0x0e,0x4b,0xed,0x52,0xb0,0x73,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf6,0x94,0x90,0x5b,0xd0,0x6b,0xb0,0x63,0xf2,0x6b,0xf2,0x6b,0xd1,0x63,0xd1,0x63,0xb1,0x63,0x90,0x63,0x90,0x63,0x90,0x5b,0x91,0x5b,0xb1,0x63,0xb1,0x63,0xd1,0x63,0x90,0x63,0x90,0x63,0x4f,0x53,0xb0,0x63,0x70,0x5b,0x76,0xa5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xb5,0x84,0x74,0x7c,0x75,0x7c,0x75,0x7c,0xf2,0x6b,0x4f,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x4f,0x53,0x0e,0x53,0xb7,0xb5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x9a,0xd6,0x13,0x6c,0x53,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0xd1,0x63,0x2e,0x53,0xed,0x4a,0x0e,0x4b,0x0e,0x4b,0xed,0x52,0x35,0xa5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x19,0xbe,0xd2,0x6b,0x4f,0x53,0x4e,0x5b,0xf4,0x94,0x76,0xa5,0x53,0x7c,0xb1,0x63,0x70,0x5b,0x70,0x5b,0x90,0x5b,0x90,0x5b,0xb0,0x63,0xb1,0x63,0xb1,0x63,0x90,0x5b,0x90,0x5b,0xd1,0x6b,0x11,0x7c,0x72,0x84,0x6f,0x5b,0x4f,0x53,0xb1,0x63,0xbb,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xd6,0x95,0x84,0x75,0x7c,0xb5,0x84,0x33,0x74,0x4f,0x53,0x0e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0xed,0x4a,0x11,0x74,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x39,0xc6,0xf2,0x6b,0x33,0x74,0x13,0x74,0x13,0x74,0x33,0x74,0x12,0x6c,0xb1,0x63,0x2e,0x53,0x0d,0x4b,0x0e,0x4b,0x0e,0x53,0x2e,0x63,0xdb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xde,0x33,0x74,0xb1,0x63,0x6f,0x5b,0x92,0x84,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x73,0x7c,0x32,0x74,0xb3,0x8c,0x76,0xad,0x56,0xa5,0x97,0xad,0xb7,0xad,0xf5,0x8c,0x12,0x74,0x32,0x7c,0x96,0xad,0xfb,0xde,0xfb,0xde,0xf5,0x94,0x70,0x5b,0x4f,0x5b,0x12,0x74,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xb6,0x84,0x75,0x7c,0xb6,0x84,0x54,0x7c,0x90,0x5b,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x4b,0xb0,0x63,0xbb,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x16,0x95,0xd2,0x63,0x13,0x74,0x13,0x74,0x13,0x74,0x33,0x74,0xf2,0x6b,0x90,0x5b,0x2e,0x53,0x0e,0x4b,0x0e,0x4b,0x0e,0x53,0x8f,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x74,0x7c,0xd2,0x6b,0xd2,0x6b,0x90,0x5b,0xd4,0x8c,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x7a,0xce,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x7a,0xce,0xdb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x15,0x95,0x90,0x5b,0x70,0x5b,0x70,0x5b,0x56,0xa5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xd6,0x8c,0x75,0x7c,0xb6,0x84,0x75,0x7c,0xd1,0x6b,0x4f,0x53,0x0e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x4b,0x2e,0x53,0x52,0x7c,0xdb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xde,0x94,0x84,0xd2,0x6b,0x13,0x74,0x13,0x74,0x13,0x74,0x33,0x74,0xf2,0x6b,0x4f,0x5b,0x0e,0x4b,0x2e,0x53,0x0e,0x53,0x0e,0x53,0xf0,0x7b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xd6,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xb1,0x63,0x33,0x74,0xba,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x39,0xc6,0x12,0x74,0x70,0x5b,0x90,0x5b,0x90,0x5b,0xd1,0x6b,0xdb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf6,0x8c,0x55,0x7c,0xb6,0x84,0x95,0x7c,0xf2,0x6b,0x4f,0x5b,0x0e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0xd0,0x6b,0xd0,0x6b,0xd0,0x6b,0x6f,0x5b,0x72,0x7c,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf8,0xb5,0x94,0x84,0x13,0x74,0x12,0x6c,0x13,0x74,0x13,0x74,0x13,0x74,0x13,0x74,0xf2,0x6b,0x70,0x5b,0x4f,0x53,0x4f,0x5b,0x4f,0x53,0x4f,0x5b,0x11,0x7c,0xdb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x39,0xbe,0xd1,0x63,0xd1,0x6b,0xf2,0x6b,0xd2,0x6b,0xb1,0x63,0x12,0x74,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x33,0x7c,0x90,0x5b,0x90,0x5b,0x90,0x63,0x90,0x5b,0x4f,0x53,0x76,0xa5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xde,0x74,0x7c,0x13,0x74,0x54,0x7c,0x34,0x74,0xd2,0x6b,0x4f,0x5b,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x53,0x2e,0x53,0x2e,0x4b,0x0e,0x4b,0xcd,0x42,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0x2e,0x53,0x31,0x74,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0x77,0xa5,0xf5,0x8c,0xd5,0x8c,0x74,0x7c,0x33,0x74,0x13,0x74,0xf2,0x6b,0xf2,0x6b,0x13,0x74,0x13,0x74,0x13,0x74,0x12,0x6c,0x13,0x74,0xf2,0x6b,0xd1,0x63,0xd1,0x63,0xd1,0x63,0xd1,0x63,0xb1,0x6b,0xf2,0x73,0x94,0x8c,0x39,0xc6,0xbb,0xd6,0x7a,0xce,0x7a,0xce,0x7a,0xce,0x7a,0xce,0x7a,0xce,0x7a,0xce,0x7a,0xce,0x7a,0xce,0x9a,0xce,0xf8,0xb5,0xb4,0x84,0x32,0x74,0xd1,0x6b,0xd2,0x6b,0xd2,0x6b,0xf2,0x6b,0x4f,0x53,0x6f,0x5b,0x9a,0xce,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf2,0x6b,0x70,0x5b,0x90,0x5b,0x90,0x63,0x90,0x5b,0x6f,0x5b,0xb0,0x63,0x73,0x7c,0xd4,0x8c,0xd4,0x8c,0xb4,0x8c,0xb4,0x8c,0xb4,0x8c,0xb4,0x8c,0xb4,0x8c,0xb4,0x8c,0xb4,0x8c,0xb4,0x8c,0xb4,0x8c,0xb4,0x8c,0xd4,0x8c,0x52,0x7c,0x90,0x63,0x90,0x5b,0xb0,0x63,0x90,0x63,0x70,0x5b,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x53,0x2e,0x53,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0xac,0x42,0x0d,0x4b,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0x12,0x6c,0xd2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0x12,0x6c,0x12,0x6c,0x12,0x6c,0x12,0x6c,0x12,0x6c,0x12,0x6c,0x13,0x74,0x13,0x74,0x13,0x74,0x13,0x74,0x13,0x74,0x12,0x6c,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd1,0x6b,0xf2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0x4f,0x53,0x8f,0x63,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x36,0x9d,0xb1,0x63,0x6f,0x5b,0x90,0x5b,0x90,0x5b,0x90,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x5b,0x4f,0x5b,0x4f,0x5b,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x2f,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x53,0x0e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x53,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xac,0x42,0x6f,0x5b,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xf2,0x6b,0xb1,0x63,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0x12,0x6c,0x12,0x6c,0x12,0x6c,0x12,0x6c,0x12,0x6c,0x12,0x6c,0x12,0x6c,0x12,0x6c,0x12,0x6c,0x12,0x6c,0x12,0x6c,0x12,0x6c,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x63,0xd2,0x63,0xd1,0x63,0xd1,0x63,0xd1,0x63,0xd1,0x63,0xd1,0x63,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd1,0x63,0x4f,0x5b,0xaf,0x63,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x98,0xa5,0xd2,0x6b,0x6f,0x5b,0x90,0x5b,0x90,0x5b,0x70,0x5b,0x6f,0x5b,0x4f,0x5b,0x4f,0x53,0x4f,0x53,0x2f,0x53,0x2f,0x53,0x2f,0x53,0x2f,0x53,0x2f,0x53,0x2f,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x53,0x0e,0x53,0x0e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x53,0x0e,0x4b,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xac,0x42,0x0e,0x53,0xf8,0xbd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xdb,0xde,0x33,0x74,0xd1,0x63,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0x12,0x6c,0x12,0x6c,0x12,0x6c,0x12,0x6c,0x12,0x6c,0x12,0x6c,0x12,0x6c,0x12,0x6c,0x12,0x6c,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd1,0x6b,0xd1,0x6b,0xd1,0x6b,0xd1,0x63,0x4f,0x5b,0xb0,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xb8,0xad,0xf2,0x6b,0x4f,0x5b,0x70,0x5b,0x90,0x5b,0x70,0x5b,0x70,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x5b,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x53,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xcd,0x42,0x0d,0x4b,0x52,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfc,0xde,0x53,0x7c,0xd1,0x63,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd1,0x6b,0xd1,0x6b,0xd1,0x6b,0xd1,0x63,0xb1,0x63,0x70,0x5b,0xd0,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x98,0xad,0xf2,0x6b,0x4f,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x5b,0x4f,0x5b,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x53,0x0e,0x53,0x0e,0x4b,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xcc,0x42,0xed,0x4a,0x31,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfc,0xde,0x33,0x74,0xb1,0x63,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0x12,0x6c,0xf2,0x6b,0x12,0x6c,0x12,0x6c,0x12,0x6c,0xf2,0x6b,0xf2,0x6b,0xd1,0x63,0xd1,0x63,0xd1,0x63,0xd1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xd1,0x63,0xd1,0x6b,0xd1,0x63,0xd1,0x63,0xd1,0x63,0x70,0x5b,0xd1,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x77,0xa5,0xb1,0x63,0x4f,0x5b,0x70,0x5b,0x70,0x5b,0x6f,0x5b,0x70,0x5b,0x70,0x5b,0x6f,0x5b,0x4f,0x53,0x2f,0x53,0x2f,0x53,0x2f,0x53,0x2f,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x53,0x0e,0x53,0x0e,0x4b,0x0e,0x4b,0x0e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x53,0x0e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x53,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0d,0x4b,0xed,0x4a,0xcd,0x42,0xcc,0x42,0xed,0x42,0xcc,0x42,0x2e,0x53,0x39,0xc6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfc,0xde,0xf2,0x6b,0x91,0x63,0xd1,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0xd2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd1,0x6b,0xd1,0x63,0xd1,0x6b,0xd1,0x63,0xd1,0x63,0xd1,0x63,0x70,0x5b,0xf1,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xb4,0x84,0x90,0x5b,0x6f,0x5b,0x70,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x5b,0x4f,0x5b,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0x0d,0x53,0x6f,0x63,0x31,0x7c,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0x53,0x7c,0xd1,0x63,0xb1,0x63,0xd1,0x6b,0xd1,0x6b,0xd1,0x63,0xb1,0x63,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd1,0x6b,0x90,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x4f,0x5b,0x2f,0x5b,0x90,0x6b,0x53,0x84,0x39,0xc6,0xdb,0xde,0xdb,0xd6,0xdb,0xd6,0xbb,0xd6,0xbb,0xd6,0xdb,0xd6,0xdb,0xd6,0xbb,0xd6,0xdb,0xde,0x59,0xc6,0xb4,0x8c,0xf2,0x73,0xb1,0x63,0xd1,0x63,0xd1,0x63,0xb1,0x63,0x70,0x5b,0xf2,0x6b,0x9a,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xde,0xf1,0x6b,0x2f,0x53,0x70,0x5b,0x70,0x5b,0x6f,0x5b,0x70,0x5b,0x4f,0x5b,0x2e,0x5b,0x8f,0x6b,0x32,0x7c,0xb3,0x8c,0xf8,0xbd,0x79,0xce,0x59,0xc6,0x59,0xc6,0x59,0xc6,0x59,0xc6,0x59,0xc6,0x59,0xc6,0x39,0xc6,0x35,0x9d,0x12,0x74,0x6f,0x5b,0x4f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x53,0x2e,0x53,0x0e,0x53,0x0e,0x53,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0d,0x4b,0xcc,0x4a,0xcc,0x52,0x8f,0x6b,0x52,0x84,0x9a,0xce,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0x39,0xbe,0xb4,0x8c,0x94,0x84,0x74,0x84,0x73,0x7c,0x32,0x74,0xf1,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0xd2,0x6b,0xf2,0x6b,0xf2,0x6b,0xb1,0x63,0x2e,0x53,0xed,0x4a,0x0d,0x4b,0xed,0x4a,0xcc,0x4a,0x4e,0x6b,0x18,0xc6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x59,0xc6,0x90,0x63,0xb1,0x63,0xd1,0x63,0xb1,0x63,0x90,0x5b,0x12,0x74,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x32,0x7c,0x70,0x5b,0x6f,0x5b,0x70,0x5b,0x70,0x5b,0x90,0x5b,0x4f,0x63,0xd0,0x7b,0xdb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xd6,0xf2,0x6b,0x90,0x5b,0xb1,0x63,0x90,0x63,0x70,0x5b,0x2e,0x53,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x2e,0x4b,0xed,0x4a,0x8b,0x4a,0xaf,0x7b,0xdb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x59,0xc6,0x73,0x84,0xf2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xd2,0x6b,0xf2,0x6b,0xb1,0x63,0x4f,0x53,0xed,0x4a,0xed,0x4a,0xcc,0x42,0xcc,0x4a,0x72,0x8c,0x1c,0xe7,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xd6,0xf2,0x6b,0xb1,0x63,0xb1,0x63,0x90,0x5b,0xd1,0x6b,0x76,0xad,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x11,0x74,0x2f,0x53,0x6f,0x5b,0x70,0x5b,0x6f,0x5b,0xf1,0x7b,0xdb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x33,0x74,0x90,0x5b,0xd1,0x6b,0xb1,0x63,0x70,0x5b,0x2e,0x53,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0d,0x4b,0x0e,0x4b,0xcd,0x4a,0x4e,0x6b,0xba,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xde,0x53,0x7c,0x91,0x63,0xd2,0x6b,0xd1,0x6b,0xd2,0x6b,0xd2,0x6b,0xb1,0x63,0x6f,0x5b,0x0d,0x4b,0xed,0x4a,0xcd,0x42,0xed,0x4a,0x52,0x84,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x94,0x84,0xb1,0x63,0xb1,0x63,0x6f,0x5b,0xf1,0x73,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x9a,0xce,0x15,0x95,0xdb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfc,0xde,0x39,0xbe,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf5,0x94,0x6f,0x5b,0x4f,0x53,0x2f,0x53,0xb0,0x6b,0xdb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x32,0x74,0x91,0x63,0xd2,0x6b,0xb1,0x63,0x4f,0x5b,0x2e,0x53,0x0e,0x4b,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0xf0,0x7b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x19,0xbe,0x91,0x63,0xf2,0x6b,0xd1,0x6b,0xd1,0x6b,0xd2,0x6b,0xd1,0x63,0x70,0x5b,0x0e,0x4b,0xed,0x4a,0xed,0x42,0xed,0x42,0xd0,0x73,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xde,0x12,0x74,0x70,0x5b,0x4f,0x5b,0xf1,0x6b,0xdb,0xde,0xfb,0xde,0xfb,0xde,0x32,0x74,0xd1,0x6b,0x53,0x7c,0x97,0xad,0x97,0xa5,0x97,0xad,0xb8,0xad,0x95,0x84,0xf2,0x6b,0x32,0x74,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x36,0x9d,0xb1,0x63,0x0e,0x53,0xb0,0x6b,0xba,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xbb,0xd6,0x12,0x6c,0xb1,0x63,0xf2,0x6b,0xb1,0x63,0x4e,0x53,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x52,0x72,0x8c,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x9a,0xd6,0xb1,0x63,0xf2,0x6b,0xd1,0x6b,0xd1,0x6b,0xd1,0x6b,0xd1,0x6b,0x90,0x63,0x2e,0x4b,0xed,0x4a,0xed,0x42,0xed,0x4a,0x6f,0x63,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x9a,0xce,0x90,0x63,0x4f,0x53,0xb1,0x63,0x73,0x7c,0xf5,0x94,0x32,0x74,0x6f,0x5b,0x70,0x5b,0x90,0x63,0xd1,0x63,0xd1,0x6b,0xf2,0x6b,0xf2,0x6b,0xb1,0x63,0x4f,0x53,0x2f,0x53,0x11,0x74,0x15,0x9d,0x16,0x95,0x74,0x7c,0x91,0x63,0x4f,0x5b,0x39,0xc6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xd5,0x8c,0xf2,0x6b,0xd2,0x6b,0xf2,0x6b,0xb1,0x63,0x2e,0x53,0x0e,0x4b,0x0e,0x53,0x0e,0x4b,0x0e,0x4b,0x0d,0x4b,0xed,0x4a,0x4e,0x5b,0x9a,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x9a,0xd6,0x12,0x74,0xf1,0x6b,0xd1,0x63,0xd1,0x63,0xd1,0x63,0xd1,0x6b,0xb1,0x63,0x2e,0x53,0xed,0x4a,0xed,0x4a,0xed,0x4a,0x0d,0x53,0xdb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x19,0xbe,0x90,0x63,0xd1,0x6b,0xb1,0x63,0xd1,0x63,0x90,0x63,0x90,0x5b,0x90,0x63,0x90,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x6f,0x5b,0x6f,0x5b,0x70,0x5b,0x4f,0x5b,0x4f,0x5b,0xb0,0x63,0xd1,0x63,0xb1,0x63,0xb0,0x63,0x59,0xc6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x12,0x74,0xf2,0x6b,0xf2,0x6b,0xd2,0x6b,0x90,0x5b,0x2e,0x53,0x0e,0x4b,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0x8f,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xb4,0x84,0x90,0x63,0xb1,0x63,0xd1,0x63,0xd1,0x63,0xd1,0x6b,0xd1,0x63,0x4f,0x53,0xed,0x4a,0xed,0x4a,0xed,0x42,0xcc,0x42,0xb7,0xb5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x36,0x95,0xb1,0x63,0x70,0x5b,0xb0,0x63,0x90,0x5b,0x90,0x63,0x90,0x63,0x90,0x5b,0x90,0x5b,0x90,0x5b,0x70,0x5b,0x70,0x5b,0x6f,0x5b,0x70,0x5b,0x70,0x5b,0x4f,0x5b,0x6f,0x5b,0x4f,0x53,0x90,0x63,0x36,0x9d,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xde,0xd2,0x6b,0xf2,0x6b,0x12,0x6c,0xd1,0x63,0x6f,0x5b,0x2e,0x53,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0x4e,0x5b,0x59,0xc6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfc,0xde,0x94,0x84,0x90,0x63,0xd1,0x63,0xd1,0x63,0xb1,0x63,0xd1,0x63,0xd1,0x63,0x70,0x5b,0x2e,0x53,0xed,0x4a,0xed,0x42,0xcc,0x42,0xd0,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfc,0xde,0x7a,0xce,0x12,0x74,0x90,0x5b,0x2f,0x53,0x70,0x5b,0x90,0x5b,0x90,0x63,0x90,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x4f,0x53,0x90,0x63,0x39,0xc6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf5,0x8c,0xf2,0x6b,0xf2,0x6b,0x13,0x6c,0xb1,0x63,0x2e,0x53,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0x0d,0x4b,0xb0,0x63,0x79,0xce,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf8,0xb5,0xd1,0x6b,0xd1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb0,0x63,0x4f,0x53,0xed,0x4a,0xed,0x4a,0xed,0x4a,0x0d,0x53,0xf4,0x94,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xb7,0xad,0x32,0x74,0xf1,0x6b,0x90,0x5b,0x90,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x5b,0xd0,0x6b,0xba,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xde,0x53,0x7c,0xf2,0x6b,0x13,0x6c,0x12,0x6c,0x90,0x5b,0x0d,0x4b,0x0d,0x4b,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x42,0x6f,0x5b,0x18,0xbe,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x18,0xbe,0x53,0x7c,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0x6f,0x5b,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xcc,0x42,0xd0,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x7a,0xce,0xd1,0x63,0x6f,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x6f,0x5b,0x4f,0x5b,0x2e,0x5b,0xd0,0x73,0xbb,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xd5,0x8c,0xf2,0x6b,0x13,0x6c,0x13,0x74,0xd2,0x6b,0x6f,0x5b,0x0d,0x4b,0x0d,0x4b,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xcc,0x42,0xcd,0x42,0x2e,0x53,0xd0,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xbb,0xd6,0x73,0x84,0xd1,0x63,0x70,0x5b,0x90,0x5b,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0x90,0x5b,0x2e,0x53,0x0d,0x4b,0xed,0x4a,0xcd,0x42,0x6f,0x5b,0x7a,0xce,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x53,0x7c,0x70,0x5b,0x6f,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x4f,0x5b,0x0e,0x5b,0x8f,0x73,0xdb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xbb,0xd6,0x54,0x7c,0x13,0x6c,0x33,0x74,0x13,0x74,0x90,0x63,0x2e,0x53,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0x0d,0x4b,0xed,0x4a,0xac,0x3a,0xac,0x42,0x79,0xce,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x19,0xbe,0xd1,0x6b,0x4f,0x53,0x90,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb0,0x63,0x6f,0x5b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0e,0x53,0xf1,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x94,0x84,0x90,0x5b,0x4f,0x5b,0x70,0x5b,0x6f,0x5b,0x70,0x5b,0x2e,0x53,0x4e,0x63,0x56,0xad,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x94,0x84,0x33,0x74,0x33,0x74,0x33,0x74,0x12,0x6c,0x4f,0x53,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0xcd,0x42,0xcd,0x42,0x93,0x84,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xd1,0x6b,0x70,0x5b,0x90,0x63,0x90,0x63,0x90,0x63,0xb0,0x63,0xb0,0x63,0xb0,0x63,0xb0,0x63,0xb0,0x63,0xb0,0x63,0xb0,0x63,0xb0,0x63,0xb0,0x63,0xb1,0x63,0x90,0x5b,0x2e,0x53,0x0d,0x4b,0x0e,0x4b,0x0d,0x4b,0x2e,0x53,0x39,0xc6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x93,0x84,0x70,0x5b,0x4f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x2e,0x53,0x8f,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x9a,0xce,0x54,0x74,0x33,0x74,0x54,0x74,0x33,0x74,0xb1,0x63,0x2e,0x53,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xcd,0x42,0x0d,0x4b,0x55,0xa5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x12,0x74,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0xb0,0x63,0x90,0x63,0x6f,0x5b,0x2e,0x53,0x0e,0x53,0x2e,0x53,0x0e,0x4b,0x90,0x63,0x39,0xc6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x93,0x84,0x70,0x5b,0x4f,0x53,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x5b,0x8f,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xd6,0x95,0x84,0x34,0x74,0x54,0x7c,0x54,0x7c,0xf2,0x6b,0x4f,0x53,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xcd,0x42,0x2e,0x53,0xba,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x7a,0xce,0xb1,0x63,0x6f,0x5b,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x5b,0x4f,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0xed,0x4a,0xf1,0x6b,0x7a,0xce,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x93,0x84,0x70,0x5b,0x4f,0x53,0x4f,0x5b,0x4f,0x5b,0x4f,0x5b,0x4f,0x5b,0x8f,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xd6,0x8c,0x13,0x74,0x54,0x7c,0x74,0x7c,0x33,0x74,0x90,0x63,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x42,0xac,0x42,0xac,0x42,0xcc,0x42,0xed,0x42,0xed,0x4a,0xed,0x42,0xcd,0x42,0x8f,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x12,0x74,0x4f,0x5b,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x5b,0x90,0x5b,0x90,0x5b,0x70,0x5b,0x90,0x5b,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x63,0x6f,0x5b,0x2f,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x4f,0x53,0xf1,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x93,0x84,0x70,0x5b,0x4f,0x53,0x4f,0x5b,0x4f,0x5b,0x4f,0x53,0x4f,0x53,0xaf,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf6,0x94,0x54,0x74,0x54,0x7c,0x75,0x7c,0x74,0x7c,0xd1,0x63,0x2e,0x53,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xcc,0x4a,0x2e,0x53,0x8f,0x63,0xaf,0x63,0x6f,0x5b,0x0d,0x4b,0xcd,0x42,0xcc,0x42,0x4e,0x5b,0x72,0x8c,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x73,0x84,0x70,0x5b,0x6f,0x5b,0x6f,0x5b,0x70,0x5b,0x70,0x5b,0x6f,0x5b,0x70,0x5b,0x90,0x63,0x70,0x5b,0x90,0x63,0x90,0x5b,0x90,0x63,0x90,0x63,0x90,0x63,0x90,0x5b,0x90,0x5b,0x6f,0x5b,0x2e,0x53,0x2e,0x53,0x4f,0x53,0x2e,0x53,0x4f,0x53,0xb7,0xb5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x93,0x84,0x6f,0x5b,0x4f,0x53,0x6f,0x5b,0x6f,0x5b,0x4f,0x53,0x2e,0x53,0xaf,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x19,0xbe,0x54,0x7c,0x74,0x7c,0x95,0x7c,0x75,0x7c,0x13,0x6c,0x6f,0x5b,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xac,0x4a,0xcc,0x52,0x51,0x8c,0xba,0xd6,0xfb,0xde,0x35,0x9d,0x32,0x7c,0xf1,0x73,0xb0,0x6b,0x11,0x7c,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf2,0x73,0x6f,0x5b,0x90,0x5b,0x90,0x63,0xb0,0x6b,0xf1,0x73,0x72,0x84,0x15,0x9d,0xf1,0x73,0x70,0x5b,0x90,0x5b,0x90,0x63,0x90,0x5b,0x90,0x5b,0x90,0x5b,0x90,0x5b,0x90,0x5b,0x6f,0x5b,0x4f,0x53,0x4f,0x53,0x6f,0x5b,0x4f,0x53,0x70,0x5b,0x36,0x9d,0x1c,0xe7,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x73,0x84,0x6f,0x5b,0x4f,0x53,0x6f,0x5b,0x6f,0x5b,0x4f,0x53,0x2e,0x53,0x8f,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x98,0xa5,0x75,0x7c,0x75,0x7c,0x95,0x84,0x95,0x7c,0x33,0x74,0x6f,0x5b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0x0d,0x5b,0x35,0xad,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x56,0xa5,0xb7,0xb5,0xd8,0xb5,0xd7,0xb5,0x39,0xc6,0xfc,0xe6,0xfb,0xde,0x7a,0xce,0x73,0x84,0x90,0x5b,0x6f,0x5b,0x90,0x5b,0x90,0x5b,0x90,0x5b,0x90,0x5b,0x90,0x5b,0x70,0x5b,0x4f,0x5b,0x4f,0x53,0x4f,0x5b,0x6f,0x5b,0x2f,0x53,0x90,0x5b,0x15,0x95,0xfc,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x73,0x84,0x6f,0x5b,0x4f,0x53,0x4f,0x5b,0x4f,0x5b,0x4f,0x53,0x2e,0x53,0x8f,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xd9,0xad,0x95,0x7c,0x75,0x7c,0x95,0x84,0x95,0x84,0x54,0x74,0x90,0x63,0x0d,0x4b,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xcc,0x4a,0xd0,0x7b,0xdb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf1,0x6b,0x4f,0x53,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x6f,0x5b,0x4f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x5b,0x4f,0x5b,0x12,0x74,0x7a,0xce,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x73,0x84,0x6f,0x5b,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x2e,0x53,0x8f,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xde,0xd6,0x8c,0x55,0x7c,0x95,0x84,0xb5,0x84,0x96,0x84,0x54,0x7c,0xb1,0x63,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xcc,0x4a,0x2e,0x63,0x39,0xce,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x18,0xbe,0xb0,0x63,0x4f,0x5b,0x6f,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x6f,0x5b,0x6f,0x5b,0x70,0x5b,0x90,0x5b,0x70,0x5b,0x70,0x5b,0xf1,0x6b,0x39,0xc6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x73,0x84,0x6f,0x5b,0x2f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x2e,0x53,0x8f,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x3a,0xc6,0xb6,0x84,0x95,0x7c,0x95,0x84,0xb6,0x84,0xb6,0x84,0x74,0x7c,0xb1,0x63,0x0e,0x53,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xec,0x52,0xd0,0x7b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x56,0xa5,0x6f,0x5b,0x4f,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x70,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x70,0x5b,0x90,0x5b,0x90,0x63,0x90,0x63,0x4f,0x5b,0xd1,0x6b,0x76,0xa5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x73,0x84,0x4f,0x5b,0x2e,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x2e,0x53,0x8f,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x37,0x9d,0x95,0x7c,0x55,0x7c,0x95,0x7c,0xb6,0x84,0xb6,0x84,0x54,0x7c,0xb1,0x63,0x0e,0x53,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xac,0x42,0x2e,0x5b,0x59,0xce,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x18,0xbe,0x6f,0x5b,0x4f,0x53,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x90,0x5b,0x90,0x63,0xb0,0x63,0xb1,0x63,0xb0,0x63,0x90,0x5b,0xd1,0x63,0xd8,0xb5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x73,0x84,0x4f,0x5b,0x2e,0x53,0x4f,0x53,0x4f,0x53,0x2f,0x53,0x2e,0x53,0x8f,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x5a,0xc6,0x74,0x7c,0x54,0x74,0x75,0x7c,0x95,0x84,0xb6,0x84,0x95,0x84,0x34,0x74,0x90,0x63,0x0d,0x4b,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xcc,0x42,0x4e,0x53,0xba,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x1c,0xdf,0x53,0x7c,0x2f,0x53,0x4f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x90,0x5b,0xb0,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xb1,0x63,0xd1,0x6b,0xf2,0x6b,0x74,0x7c,0xbb,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x73,0x7c,0x6f,0x5b,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x53,0x8f,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x9b,0xce,0xb5,0x84,0x74,0x7c,0x74,0x7c,0x74,0x7c,0x75,0x7c,0x95,0x84,0x95,0x84,0x75,0x7c,0x13,0x74,0x6f,0x5b,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0xed,0x42,0x0d,0x4b,0xd0,0x6b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xd8,0xb5,0x90,0x63,0x4f,0x53,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x90,0x5b,0xb1,0x63,0xd1,0x63,0xd1,0x63,0xd1,0x6b,0xb1,0x63,0xb1,0x63,0xd1,0x63,0x53,0x7c,0xd5,0x8c,0x7a,0xc6,0xdb,0xde,0xfb,0xde,0xfb,0xde,0x1c,0xdf,0x12,0x74,0x4f,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x53,0x6f,0x63,0x39,0xc6,0xfb,0xde,0xfb,0xde,0xdb,0xde,0xf8,0xb5,0xd5,0x8c,0x74,0x7c,0x33,0x74,0x34,0x74,0x54,0x7c,0x75,0x7c,0x95,0x7c,0x75,0x7c,0x34,0x74,0xb1,0x63,0x4f,0x53,0x0d,0x4b,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0x32,0x7c,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xbb,0xd6,0x70,0x5b,0x2e,0x53,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x5b,0x6f,0x5b,0x70,0x5b,0x90,0x63,0xb1,0x63,0xd2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xf2,0x6b,0xd2,0x63,0xb2,0x63,0xf2,0x6b,0x94,0x84,0xd8,0xb5,0xd8,0xb5,0xb0,0x63,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x70,0x5b,0x53,0x7c,0xb5,0x8c,0x74,0x7c,0x13,0x6c,0xd2,0x6b,0x13,0x6c,0x33,0x74,0x54,0x7c,0x74,0x7c,0x75,0x7c,0x74,0x7c,0x33,0x74,0xd2,0x6b,0x70,0x5b,0x2e,0x53,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0xed,0x4a,0xcd,0x42,0x2e,0x53,0x55,0x9d,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xde,0x12,0x74,0x4f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x5b,0x4f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x5b,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x6f,0x5b,0x90,0x5b,0xb1,0x63,0xd1,0x63,0xf2,0x6b,0x12,0x6c,0x13,0x74,0x13,0x74,0x13,0x74,0x13,0x74,0x13,0x6c,0x13,0x74,0xf2,0x6b,0x6f,0x5b,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x90,0x5b,0xd2,0x6b,0xf2,0x6b,0x12,0x6c,0x13,0x74,0x33,0x74,0x34,0x74,0x54,0x74,0x54,0x74,0x33,0x74,0x33,0x74,0xf2,0x6b,0x90,0x5b,0x2e,0x53,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0xed,0x4a,0xac,0x3a,0x93,0x84,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xd4,0x8c,0x6f,0x5b,0x4f,0x53,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x5b,0x6f,0x5b,0x6f,0x5b,0x4f,0x53,0x4f,0x5b,0x6f,0x5b,0x4f,0x5b,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x70,0x5b,0xb1,0x63,0xf2,0x6b,0x12,0x6c,0x13,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0x54,0x74,0x13,0x6c,0x6f,0x5b,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x53,0x2e,0x53,0x90,0x5b,0xf2,0x6b,0x13,0x6c,0x13,0x74,0x13,0x74,0x33,0x74,0x33,0x74,0x33,0x74,0xf2,0x6b,0xd1,0x63,0x6f,0x5b,0x2e,0x53,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0xcd,0x42,0xcc,0x42,0xcd,0x42,0xed,0x4a,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0xed,0x4a,0x8b,0x3a,0x8f,0x5b,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x52,0x7c,0x2e,0x53,0x4f,0x53,0x4f,0x5b,0x4f,0x5b,0x4f,0x5b,0x4f,0x5b,0x4f,0x5b,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x2f,0x53,0x2f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x2e,0x53,0x4f,0x53,0x6f,0x5b,0x6f,0x5b,0x90,0x5b,0xb1,0x63,0xf2,0x6b,0x12,0x6c,0x33,0x74,0x74,0x7c,0x33,0x74,0x70,0x5b,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x53,0x2e,0x53,0x90,0x5b,0xf2,0x6b,0x13,0x74,0xf2,0x6b,0xf2,0x6b,0xd1,0x6b,0xb1,0x63,0x6f,0x5b,0x4f,0x53,0x2e,0x53,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xcc,0x4a,0x2d,0x5b,0x0d,0x53,0xcc,0x42,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x42,0xcd,0x4a,0x31,0x7c,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x35,0x9d,0x6f,0x5b,0x0e,0x4b,0x4f,0x5b,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x2e,0x53,0x0e,0x53,0x4f,0x63,0x6f,0x5b,0x2e,0x53,0x0e,0x4b,0x4f,0x5b,0x4f,0x5b,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x4f,0x5b,0x70,0x5b,0x90,0x63,0xb1,0x63,0xd1,0x6b,0xb1,0x63,0x4f,0x5b,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x4f,0x5b,0x90,0x5b,0xb0,0x63,0x90,0x5b,0x6f,0x5b,0x4f,0x5b,0x2e,0x53,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xcd,0x4a,0x2d,0x5b,0xd0,0x73,0x18,0xc6,0x7a,0xce,0x11,0x6c,0xed,0x4a,0xac,0x42,0x0d,0x4b,0xed,0x4a,0xed,0x42,0xac,0x42,0x8f,0x6b,0x18,0xbe,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x52,0x7c,0x6f,0x5b,0x0e,0x4b,0x4f,0x53,0x4f,0x5b,0x4f,0x53,0x2f,0x53,0x2e,0x53,0x4e,0x63,0x8f,0x73,0xb3,0x94,0x15,0x95,0x52,0x7c,0x90,0x63,0x2e,0x53,0x2e,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x4f,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x4b,0x0e,0x4b,0x2e,0x53,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x53,0xcd,0x4a,0x2e,0x63,0x31,0x8c,0xdb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x31,0x74,0x2e,0x53,0xcd,0x42,0xac,0x42,0xed,0x4a,0xaf,0x63,0x56,0xad,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x53,0x7c,0x6f,0x5b,0x0e,0x4b,0x2e,0x53,0x0e,0x4b,0x4f,0x5b,0xb0,0x6b,0x72,0x8c,0xdb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x18,0xbe,0xf1,0x6b,0x0e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x53,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xac,0x4a,0x6e,0x6b,0x39,0xc6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x59,0xc6,0x2e,0x53,0xb0,0x63,0xf1,0x73,0x39,0xc6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x35,0x9d,0xb0,0x63,0x2f,0x53,0xb0,0x6b,0x72,0x84,0xdb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x52,0x7c,0x4f,0x53,0x0e,0x4b,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x53,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xac,0x42,0x2d,0x63,0x39,0xce,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf8,0xb5,0xb7,0xad,0x39,0xc6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x77,0xad,0x8f,0x5b,0xed,0x4a,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x42,0xcc,0x4a,0x93,0x94,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x15,0x95,0x6f,0x5b,0xed,0x4a,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x53,0x0e,0x53,0x0e,0x53,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x42,0x0d,0x4b,0x35,0xa5,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x11,0x74,0x4f,0x53,0x0e,0x4b,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x53,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0xed,0x42,0xed,0x4a,0x15,0x9d,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x6f,0x5b,0x0e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0d,0x53,0xcc,0x4a,0x4e,0x63,0xb0,0x6b,0x8f,0x63,0x2e,0x53,0x0e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xcd,0x4a,0x2e,0x5b,0x6f,0x63,0xd0,0x73,0x31,0x84,0x52,0x84,0x6f,0x5b,0xcc,0x42,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0x0d,0x4b,0xed,0x4a,0xcc,0x42,0x72,0x84,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xdb,0xd6,0x2e,0x53,0xed,0x4a,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0xed,0x4a,0xcc,0x52,0xaf,0x73,0x79,0xce,0xdb,0xde,0xba,0xd6,0x76,0xad,0x4e,0x53,0x0d,0x4b,0x0e,0x4b,0x0e,0x4b,0x0d,0x4b,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0x0d,0x5b,0xb0,0x73,0x7a,0xce,0xdb,0xde,0xbb,0xde,0xfb,0xde,0x1c,0xe7,0xf8,0xbd,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xac,0x3a,0x8f,0x5b,0x7a,0xce,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xb4,0x8c,0x2e,0x53,0x0d,0x4b,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x4b,0xed,0x52,0x6e,0x6b,0xba,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfc,0xde,0xb0,0x63,0x0d,0x4b,0x0d,0x4b,0x0e,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xcc,0x52,0xaf,0x73,0xdb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x11,0x74,0xcd,0x42,0xcd,0x42,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0xed,0x42,0xcc,0x42,0x4e,0x5b,0x15,0x9d,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xb7,0xad,0x0e,0x53,0xcd,0x42,0x0e,0x53,0x2e,0x53,0x2e,0x53,0x2e,0x53,0x0e,0x4b,0xed,0x4a,0x4e,0x63,0xf7,0xbd,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x11,0x74,0x2e,0x53,0xed,0x4a,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xcd,0x4a,0x2d,0x5b,0x55,0xad,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x39,0xbe,0x0d,0x4b,0xac,0x3a,0xed,0x4a,0xed,0x4a,0xed,0x42,0xcc,0x42,0xcc,0x42,0x8f,0x63,0xdb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x32,0x74,0x4f,0x5b,0xed,0x4a,0xcd,0x42,0xed,0x4a,0x0e,0x4b,0xed,0x42,0x0d,0x53,0x31,0x84,0xfc,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x93,0x84,0x4e,0x53,0xcd,0x42,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0x4e,0x63,0xdb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x11,0x74,0xac,0x42,0xac,0x3a,0xcc,0x42,0xed,0x4a,0x2e,0x5b,0xf0,0x73,0xba,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x39,0xc6,0x32,0x7c,0xb0,0x63,0x4e,0x53,0x0e,0x53,0x4f,0x5b,0x31,0x7c,0xdb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf4,0x94,0x4e,0x5b,0xcc,0x42,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0x0d,0x4b,0xed,0x4a,0xed,0x4a,0x4e,0x63,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xba,0xd6,0x52,0x7c,0xb0,0x63,0x11,0x74,0x93,0x8c,0x9a,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xf4,0x94,0xf1,0x73,0x7a,0xce,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x35,0x9d,0x2e,0x53,0xac,0x42,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xcd,0x42,0xed,0x4a,0xb0,0x73,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x6f,0x5b,0xcc,0x42,0xed,0x4a,0xed,0x4a,0xed,0x4a,0xed,0x42,0xcc,0x42,0x2e,0x5b,0x72,0x8c,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xd7,0xb5,0xf1,0x6b,0x32,0x7c,0x52,0x7c,0x32,0x7c,0x11,0x74,0xb0,0x6b,0x72,0x84,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+
+};
+
+const lv_img_dsc_t img_benchmark_cogwheel_rgb = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 100,
+  .header.h = 100,
+  .header.stride = 256,
+  .data_size = 25600,
+  .data = img_benchmark_cogwheel_rgb_map,
+};
+
+#endif
@@ -0,0 +1,39 @@
+/**
+ * @file lv_demo_keypad_encoder.h
+ *
+ */
+
+#ifndef LV_DEMO_KEYPAD_ENCODER_H
+#define LV_DEMO_KEYPAD_ENCODER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_demos.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+void lv_demo_keypad_encoder(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_DEMO_KEYPAD_ENCODER_H*/
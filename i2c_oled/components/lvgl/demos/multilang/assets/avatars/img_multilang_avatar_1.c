@@ -0,0 +1,166 @@
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+#if LV_USE_DEMO_MULTILANG
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_1
+    #define LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_1
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_1 uint8_t
+img_multilang_avatar_1_map[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x5e, 0xff, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0xa8, 0xfe, 0xfe, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xd2, 0xfe, 0xfe, 0xfe, 0xe5, 0xfe, 0xfe, 0xfe, 0xee, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xfe, 0xfe, 0xfe, 0xee, 0xfe, 0xfe, 0xfe, 0xe5, 0xff, 0xff, 0xff, 0xd2, 0xfe, 0xfe, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xa8, 0xff, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0x5e, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x19, 0xff, 0xff, 0xff, 0x55, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xc1, 0xfe, 0xfe, 0xfe, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xe9, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x55, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x07, 0xff, 0xff, 0xff, 0x46, 0xff, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x46, 0xfe, 0xfe, 0xfe, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x9f, 0xfe, 0xfe, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xef, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x86, 0xfe, 0xfe, 0xfe, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xe5, 0xff, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x41, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xff, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xff, 0xff, 0xff, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x46, 0xff, 0xff, 0xff, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfc, 0xfd, 0xfd, 0xff, 0xfa, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfb, 0xf9, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf2, 0xf8, 0xff, 0xd3, 0xd4, 0xd9, 0xff, 0xbe, 0xc2, 0xc9, 0xff, 0xa9, 0xb0, 0xb8, 0xff, 0x97, 0x9d, 0xa5, 0xff, 0x97, 0x9d, 0xa5, 0xff, 0x99, 0x9c, 0xa1, 0xff, 0x9c, 0x9f, 0xa3, 0xff, 0xaf, 0xb2, 0xb5, 0xff, 0xca, 0xcb, 0xcd, 0xff, 0xe9, 0xea, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xff, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x09, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf7, 0xf9, 0xff, 0xbc, 0xc0, 0xc9, 0xff, 0x80, 0x87, 0x97, 0xff, 0x5e, 0x61, 0x71, 0xff, 0x3c, 0x3e, 0x51, 0xff, 0x21, 0x23, 0x37, 0xff, 0x12, 0x14, 0x27, 0xff, 0x13, 0x15, 0x24, 0xff, 0x14, 0x16, 0x26, 0xff, 0x1d, 0x1f, 0x2f, 0xff, 0x22, 0x25, 0x35, 0xff, 0x20, 0x22, 0x32, 0xff, 0x15, 0x19, 0x28, 0xff, 0x1f, 0x20, 0x2f, 0xff, 0x3c, 0x3c, 0x49, 0xff, 0x74, 0x76, 0x80, 0xff, 0xb9, 0xbc, 0xc1, 0xff, 0xf0, 0xef, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xd0, 0xda, 0xff, 0x8e, 0x93, 0xa1, 0xff, 0x49, 0x4f, 0x5f, 0xff, 0x10, 0x17, 0x27, 0xff, 0x00, 0x00, 0x11, 0xff, 0x00, 0x00, 0x09, 0xff, 0x00, 0x00, 0x02, 0xff, 0x07, 0x05, 0x07, 0xff, 0x03, 0x02, 0x03, 0xff, 0x00, 0x01, 0x00, 0xff, 0x08, 0x0b, 0x0a, 0xff, 0x0f, 0x11, 0x11, 0xff, 0x19, 0x1e, 0x24, 0xff, 0x27, 0x2b, 0x35, 0xff, 0x23, 0x27, 0x31, 0xff, 0x19, 0x1b, 0x28, 0xff, 0x0b, 0x0b, 0x19, 0xff, 0x03, 0x04, 0x11, 0xff, 0x1b, 0x1d, 0x28, 0xff, 0x4d, 0x50, 0x55, 0xff, 0x9d, 0x9d, 0xa0, 0xff, 0xf9, 0xf8, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xfa, 0xfb, 0xfb, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xff, 0xff, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x07, 0xff, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfd, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xb3, 0xba, 0xc5, 0xff, 0x61, 0x6c, 0x7a, 0xff, 0x2f, 0x34, 0x42, 0xff, 0x1b, 0x1e, 0x2e, 0xff, 0x1b, 0x1e, 0x2f, 0xff, 0x22, 0x26, 0x32, 0xff, 0x23, 0x28, 0x2f, 0xff, 0x1c, 0x1d, 0x25, 0xff, 0x1e, 0x1c, 0x22, 0xff, 0x1d, 0x18, 0x1b, 0xff, 0x15, 0x13, 0x13, 0xff, 0x03, 0x06, 0x06, 0xff, 0x00, 0x01, 0x02, 0xff, 0x03, 0x04, 0x05, 0xff, 0x06, 0x0a, 0x08, 0xff, 0x0f, 0x12, 0x13, 0xff, 0x1c, 0x1f, 0x23, 0xff, 0x23, 0x25, 0x2c, 0xff, 0x1b, 0x1e, 0x25, 0xff, 0x0c, 0x0e, 0x16, 0xff, 0x0c, 0x0e, 0x18, 0xff, 0x12, 0x14, 0x21, 0xff, 0x20, 0x1f, 0x2a, 0xff, 0x5f, 0x5d, 0x65, 0xff, 0xc8, 0xc7, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfa, 0xfb, 0xff, 0xfc, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x8e, 0xfe, 0xfe, 0xfe, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x29, 0xfe, 0xfe, 0xfe, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xcf, 0xd9, 0xff, 0x5d, 0x65, 0x6d, 0xff, 0x1b, 0x1e, 0x30, 0xff, 0x07, 0x0c, 0x20, 0xff, 0x10, 0x13, 0x1d, 0xff, 0x12, 0x14, 0x1b, 0xff, 0x1a, 0x1c, 0x25, 0xff, 0x23, 0x26, 0x2c, 0xff, 0x26, 0x2b, 0x2c, 0xff, 0x29, 0x28, 0x2d, 0xff, 0x29, 0x28, 0x30, 0xff, 0x22, 0x25, 0x32, 0xff, 0x20, 0x23, 0x2a, 0xff, 0x1e, 0x20, 0x1f, 0xff, 0x0a, 0x0c, 0x0d, 0xff, 0x02, 0x04, 0x05, 0xff, 0x03, 0x05, 0x02, 0xff, 0x07, 0x07, 0x06, 0xff, 0x0f, 0x0d, 0x10, 0xff, 0x13, 0x15, 0x19, 0xff, 0x1e, 0x22, 0x27, 0xff, 0x16, 0x19, 0x1d, 0xff, 0x04, 0x08, 0x0c, 0xff, 0x0f, 0x11, 0x18, 0xff, 0x18, 0x1a, 0x24, 0xff, 0x1c, 0x22, 0x2d, 0xff, 0x32, 0x38, 0x47, 0xff, 0x9d, 0xa0, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xd1, 0xfe, 0xfe, 0xfe, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x56, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xf0, 0xf8, 0xff, 0x87, 0x8c, 0x93, 0xff, 0x25, 0x33, 0x42, 0xff, 0x0e, 0x17, 0x22, 0xff, 0x21, 0x1b, 0x23, 0xff, 0x22, 0x1b, 0x23, 0xff, 0x1b, 0x1b, 0x23, 0xff, 0x10, 0x12, 0x19, 0xff, 0x13, 0x16, 0x19, 0xff, 0x14, 0x17, 0x19, 0xff, 0x0a, 0x0d, 0x0d, 0xff, 0x15, 0x15, 0x19, 0xff, 0x27, 0x28, 0x2f, 0xff, 0x23, 0x28, 0x35, 0xff, 0x20, 0x23, 0x2d, 0xff, 0x25, 0x25, 0x27, 0xff, 0x1d, 0x1f, 0x21, 0xff, 0x0f, 0x11, 0x11, 0xff, 0x04, 0x04, 0x02, 0xff, 0x07, 0x07, 0x06, 0xff, 0x12, 0x10, 0x11, 0xff, 0x0b, 0x0c, 0x0f, 0xff, 0x12, 0x15, 0x19, 0xff, 0x1a, 0x1c, 0x21, 0xff, 0x0e, 0x10, 0x13, 0xff, 0x09, 0x0c, 0x0b, 0xff, 0x05, 0x0a, 0x0b, 0xff, 0x13, 0x1a, 0x20, 0xff, 0x2a, 0x30, 0x3e, 0xff, 0x23, 0x2a, 0x39, 0xff, 0x8d, 0x8d, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x8a, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfc, 0xfc, 0xff, 0xf8, 0xf7, 0xf8, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xbc, 0xcc, 0xff, 0x46, 0x57, 0x6a, 0xff, 0x12, 0x1a, 0x26, 0xff, 0x1d, 0x1c, 0x25, 0xff, 0x1e, 0x21, 0x26, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x20, 0x1d, 0x21, 0xff, 0x16, 0x13, 0x17, 0xff, 0x17, 0x16, 0x1a, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x20, 0x21, 0x24, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x10, 0x12, 0x16, 0xff, 0x1f, 0x23, 0x27, 0xff, 0x2d, 0x2f, 0x38, 0xff, 0x36, 0x36, 0x40, 0xff, 0x23, 0x22, 0x2b, 0xff, 0x1f, 0x21, 0x25, 0xff, 0x20, 0x22, 0x22, 0xff, 0x0c, 0x0b, 0x0d, 0xff, 0x00, 0x00, 0x01, 0xff, 0x0b, 0x0a, 0x0c, 0xff, 0x10, 0x10, 0x13, 0xff, 0x11, 0x13, 0x17, 0xff, 0x1c, 0x1c, 0x20, 0xff, 0x18, 0x19, 0x1e, 0xff, 0x0c, 0x0d, 0x10, 0xff, 0x07, 0x09, 0x08, 0xff, 0x0e, 0x0c, 0x13, 0xff, 0x20, 0x21, 0x28, 0xff, 0x21, 0x2b, 0x35, 0xff, 0x26, 0x2b, 0x39, 0xff, 0xa9, 0xa6, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x0b, 0xff, 0xff, 0xff, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfb, 0xff, 0xf9, 0xfc, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xf6, 0xf8, 0xff, 0x82, 0x87, 0xa7, 0xff, 0x26, 0x27, 0x4f, 0xff, 0x0d, 0x1a, 0x1f, 0xff, 0x1d, 0x23, 0x2a, 0xff, 0x21, 0x1f, 0x26, 0xff, 0x0f, 0x11, 0x15, 0xff, 0x0f, 0x11, 0x13, 0xff, 0x09, 0x08, 0x09, 0xff, 0x06, 0x05, 0x07, 0xff, 0x0c, 0x0c, 0x0e, 0xff, 0x01, 0x02, 0x06, 0xff, 0x14, 0x15, 0x19, 0xff, 0x2d, 0x2e, 0x32, 0xff, 0x25, 0x28, 0x2b, 0xff, 0x1d, 0x20, 0x25, 0xff, 0x2a, 0x2c, 0x36, 0xff, 0x38, 0x37, 0x42, 0xff, 0x33, 0x32, 0x3a, 0xff, 0x23, 0x24, 0x27, 0xff, 0x23, 0x25, 0x25, 0xff, 0x22, 0x22, 0x23, 0xff, 0x0a, 0x09, 0x0b, 0xff, 0x04, 0x02, 0x04, 0xff, 0x13, 0x13, 0x16, 0xff, 0x0e, 0x10, 0x14, 0xff, 0x1c, 0x1e, 0x21, 0xff, 0x1c, 0x1d, 0x22, 0xff, 0x12, 0x13, 0x17, 0xff, 0x10, 0x12, 0x11, 0xff, 0x11, 0x10, 0x17, 0xff, 0x11, 0x16, 0x20, 0xff, 0x13, 0x19, 0x21, 0xff, 0x20, 0x22, 0x2c, 0xff, 0x4a, 0x4b, 0x52, 0xff, 0xd9, 0xd9, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x16, 0xff, 0xff, 0xff, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xe2, 0xe7, 0xff, 0x60, 0x69, 0x89, 0xff, 0x23, 0x2b, 0x4b, 0xff, 0x1f, 0x1b, 0x2b, 0xff, 0x1b, 0x15, 0x1c, 0xff, 0x15, 0x19, 0x1f, 0xff, 0x1a, 0x15, 0x1b, 0xff, 0x10, 0x0e, 0x10, 0xff, 0x0a, 0x0c, 0x0a, 0xff, 0x08, 0x08, 0x07, 0xff, 0x05, 0x04, 0x04, 0xff, 0x05, 0x05, 0x06, 0xff, 0x00, 0x00, 0x04, 0xff, 0x00, 0x00, 0x05, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x30, 0x33, 0x37, 0xff, 0x21, 0x24, 0x29, 0xff, 0x1e, 0x20, 0x29, 0xff, 0x2c, 0x2b, 0x36, 0xff, 0x3e, 0x3d, 0x44, 0xff, 0x2b, 0x2c, 0x2f, 0xff, 0x1d, 0x1f, 0x1f, 0xff, 0x2e, 0x2d, 0x2f, 0xff, 0x1f, 0x1d, 0x1f, 0xff, 0x08, 0x06, 0x07, 0xff, 0x0d, 0x0d, 0x10, 0xff, 0x0f, 0x10, 0x15, 0xff, 0x1a, 0x1c, 0x1f, 0xff, 0x1d, 0x1d, 0x22, 0xff, 0x19, 0x1a, 0x1d, 0xff, 0x18, 0x1b, 0x19, 0xff, 0x0e, 0x0d, 0x15, 0xff, 0x14, 0x1b, 0x29, 0xff, 0x0d, 0x12, 0x16, 0xff, 0x19, 0x19, 0x20, 0xff, 0x29, 0x2d, 0x36, 0xff, 0x84, 0x84, 0x82, 0xff, 0xf4, 0xf4, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1a, 0xff, 0xff, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xd7, 0xe5, 0xff, 0x4b, 0x5e, 0x7f, 0xff, 0x1f, 0x2a, 0x47, 0xff, 0x19, 0x1b, 0x20, 0xff, 0x1a, 0x1a, 0x17, 0xff, 0x1c, 0x1a, 0x20, 0xff, 0x13, 0x16, 0x18, 0xff, 0x15, 0x16, 0x17, 0xff, 0x19, 0x1a, 0x1b, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x17, 0x15, 0x15, 0xff, 0x08, 0x08, 0x07, 0xff, 0x02, 0x03, 0x02, 0xff, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x11, 0x13, 0x13, 0xff, 0x28, 0x2b, 0x2f, 0xff, 0x26, 0x29, 0x2e, 0xff, 0x24, 0x27, 0x2d, 0xff, 0x2d, 0x2e, 0x36, 0xff, 0x35, 0x35, 0x3f, 0xff, 0x2f, 0x31, 0x39, 0xff, 0x18, 0x19, 0x21, 0xff, 0x26, 0x26, 0x2a, 0xff, 0x24, 0x24, 0x27, 0xff, 0x0f, 0x10, 0x12, 0xff, 0x0d, 0x0e, 0x11, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x22, 0x23, 0x27, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x11, 0x13, 0x16, 0xff, 0x0f, 0x0f, 0x14, 0xff, 0x21, 0x24, 0x2b, 0xff, 0x19, 0x1d, 0x20, 0xff, 0x11, 0x11, 0x19, 0xff, 0x25, 0x27, 0x32, 0xff, 0x41, 0x46, 0x4c, 0xff, 0xbe, 0xc0, 0xc4, 0xff, 0xf4, 0xf5, 0xf7, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xff, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xd1, 0xda, 0xff, 0x44, 0x4f, 0x67, 0xff, 0x23, 0x34, 0x53, 0xff, 0x16, 0x21, 0x2f, 0xff, 0x16, 0x18, 0x16, 0xff, 0x1e, 0x1f, 0x1f, 0xff, 0x21, 0x26, 0x29, 0xff, 0x16, 0x18, 0x19, 0xff, 0x11, 0x14, 0x14, 0xff, 0x1c, 0x1f, 0x20, 0xff, 0x19, 0x1a, 0x1b, 0xff, 0x11, 0x11, 0x12, 0xff, 0x09, 0x0a, 0x0a, 0xff, 0x03, 0x04, 0x05, 0xff, 0x00, 0x02, 0x05, 0xff, 0x00, 0x00, 0x00, 0xff, 0x05, 0x07, 0x09, 0xff, 0x23, 0x26, 0x2b, 0xff, 0x2a, 0x2d, 0x33, 0xff, 0x28, 0x2b, 0x2f, 0xff, 0x31, 0x34, 0x3a, 0xff, 0x28, 0x29, 0x34, 0xff, 0x2f, 0x30, 0x3b, 0xff, 0x16, 0x17, 0x21, 0xff, 0x27, 0x27, 0x2d, 0xff, 0x2c, 0x2c, 0x32, 0xff, 0x19, 0x19, 0x1f, 0xff, 0x1a, 0x1a, 0x1f, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x20, 0x21, 0x25, 0xff, 0x29, 0x2a, 0x2e, 0xff, 0x27, 0x28, 0x2c, 0xff, 0x08, 0x09, 0x0d, 0xff, 0x0f, 0x10, 0x14, 0xff, 0x2e, 0x30, 0x32, 0xff, 0x20, 0x23, 0x28, 0xff, 0x0f, 0x10, 0x19, 0xff, 0x25, 0x27, 0x31, 0xff, 0x2f, 0x34, 0x3f, 0xff, 0x8b, 0x8e, 0x95, 0xff, 0xdb, 0xdc, 0xe0, 0xff, 0xec, 0xec, 0xed, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x1c, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xd3, 0xe0, 0xff, 0x42, 0x50, 0x68, 0xff, 0x28, 0x38, 0x52, 0xff, 0x2a, 0x31, 0x41, 0xff, 0x0f, 0x16, 0x1f, 0xff, 0x1f, 0x23, 0x28, 0xff, 0x24, 0x24, 0x24, 0xff, 0x0f, 0x12, 0x16, 0xff, 0x08, 0x0b, 0x0b, 0xff, 0x11, 0x13, 0x14, 0xff, 0x1a, 0x1d, 0x1d, 0xff, 0x18, 0x1b, 0x1d, 0xff, 0x13, 0x17, 0x19, 0xff, 0x0a, 0x0c, 0x0e, 0xff, 0x04, 0x07, 0x0b, 0xff, 0x08, 0x0e, 0x15, 0xff, 0x0f, 0x14, 0x1a, 0xff, 0x0b, 0x10, 0x14, 0xff, 0x18, 0x1b, 0x1e, 0xff, 0x29, 0x2b, 0x2e, 0xff, 0x24, 0x27, 0x2a, 0xff, 0x28, 0x29, 0x30, 0xff, 0x2c, 0x2b, 0x36, 0xff, 0x2f, 0x2f, 0x39, 0xff, 0x17, 0x17, 0x20, 0xff, 0x31, 0x2f, 0x38, 0xff, 0x28, 0x26, 0x2f, 0xff, 0x19, 0x17, 0x21, 0xff, 0x1c, 0x1c, 0x22, 0xff, 0x24, 0x25, 0x28, 0xff, 0x31, 0x31, 0x35, 0xff, 0x22, 0x22, 0x26, 0xff, 0x22, 0x22, 0x25, 0xff, 0x0c, 0x0d, 0x10, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x31, 0x33, 0x36, 0xff, 0x1c, 0x1f, 0x23, 0xff, 0x19, 0x1a, 0x23, 0xff, 0x1f, 0x22, 0x2c, 0xff, 0x2c, 0x31, 0x39, 0xff, 0x68, 0x69, 0x6d, 0xff, 0xdb, 0xdc, 0xe0, 0xff, 0xd5, 0xd6, 0xd7, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xfe, 0xfe, 0xfe, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xdf, 0xea, 0xff, 0x46, 0x52, 0x6a, 0xff, 0x1c, 0x29, 0x47, 0xff, 0x2f, 0x38, 0x50, 0xff, 0x19, 0x1b, 0x23, 0xff, 0x1a, 0x1c, 0x20, 0xff, 0x21, 0x25, 0x27, 0xff, 0x12, 0x13, 0x14, 0xff, 0x02, 0x04, 0x09, 0xff, 0x0f, 0x11, 0x13, 0xff, 0x1d, 0x1f, 0x21, 0xff, 0x1f, 0x20, 0x22, 0xff, 0x1a, 0x1f, 0x24, 0xff, 0x0f, 0x14, 0x1c, 0xff, 0x06, 0x0a, 0x12, 0xff, 0x0a, 0x0f, 0x14, 0xff, 0x15, 0x19, 0x1d, 0xff, 0x26, 0x2a, 0x33, 0xff, 0x27, 0x2d, 0x38, 0xff, 0x18, 0x1d, 0x25, 0xff, 0x29, 0x2e, 0x34, 0xff, 0x26, 0x2a, 0x30, 0xff, 0x28, 0x2b, 0x32, 0xff, 0x2d, 0x2f, 0x39, 0xff, 0x2c, 0x2f, 0x38, 0xff, 0x25, 0x27, 0x31, 0xff, 0x2a, 0x2c, 0x37, 0xff, 0x20, 0x22, 0x2d, 0xff, 0x1c, 0x1d, 0x28, 0xff, 0x15, 0x16, 0x1b, 0xff, 0x33, 0x32, 0x35, 0xff, 0x3a, 0x3a, 0x3e, 0xff, 0x14, 0x15, 0x1a, 0xff, 0x18, 0x1b, 0x21, 0xff, 0x0b, 0x0d, 0x12, 0xff, 0x2a, 0x2c, 0x30, 0xff, 0x34, 0x37, 0x3d, 0xff, 0x18, 0x1b, 0x21, 0xff, 0x28, 0x29, 0x31, 0xff, 0x2f, 0x2f, 0x38, 0xff, 0x29, 0x2b, 0x36, 0xff, 0x31, 0x39, 0x43, 0xff, 0xb0, 0xb1, 0xb5, 0xff, 0xe5, 0xe4, 0xe4, 0xff, 0xe7, 0xe7, 0xe6, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x0a, 0xff, 0xff, 0xff, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfc, 0xf9, 0xfb, 0xff, 0xfb, 0xfb, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0x4e, 0x5d, 0x78, 0xff, 0x15, 0x25, 0x41, 0xff, 0x34, 0x3a, 0x53, 0xff, 0x1f, 0x21, 0x32, 0xff, 0x14, 0x16, 0x1f, 0xff, 0x27, 0x28, 0x28, 0xff, 0x14, 0x17, 0x15, 0xff, 0x03, 0x05, 0x07, 0xff, 0x14, 0x14, 0x18, 0xff, 0x20, 0x21, 0x25, 0xff, 0x1d, 0x1d, 0x22, 0xff, 0x13, 0x13, 0x18, 0xff, 0x0c, 0x0c, 0x10, 0xff, 0x07, 0x08, 0x0d, 0xff, 0x14, 0x17, 0x1f, 0xff, 0x1f, 0x23, 0x29, 0xff, 0x22, 0x24, 0x29, 0xff, 0x29, 0x2e, 0x3e, 0xff, 0x3c, 0x45, 0x5d, 0xff, 0x33, 0x3f, 0x56, 0xff, 0x31, 0x3c, 0x4d, 0xff, 0x2d, 0x36, 0x45, 0xff, 0x33, 0x3c, 0x49, 0xff, 0x2e, 0x37, 0x45, 0xff, 0x34, 0x3d, 0x4b, 0xff, 0x32, 0x3b, 0x4a, 0xff, 0x31, 0x3b, 0x49, 0xff, 0x38, 0x40, 0x4c, 0xff, 0x26, 0x2c, 0x35, 0xff, 0x19, 0x1c, 0x23, 0xff, 0x2d, 0x30, 0x36, 0xff, 0x1e, 0x21, 0x29, 0xff, 0x13, 0x18, 0x22, 0xff, 0x16, 0x1c, 0x28, 0xff, 0x0f, 0x12, 0x1c, 0xff, 0x27, 0x2a, 0x2f, 0xff, 0x34, 0x38, 0x42, 0xff, 0x16, 0x1b, 0x22, 0xff, 0x29, 0x2a, 0x31, 0xff, 0x3e, 0x38, 0x43, 0xff, 0x3a, 0x3a, 0x49, 0xff, 0x27, 0x35, 0x46, 0xff, 0x5b, 0x5d, 0x63, 0xff, 0xc3, 0xbf, 0xc2, 0xff, 0xde, 0xdd, 0xdf, 0xff, 0xf5, 0xf6, 0xf3, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0xff, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfb, 0xfc, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x95, 0xa5, 0xff, 0x1d, 0x2c, 0x46, 0xff, 0x2b, 0x39, 0x52, 0xff, 0x2d, 0x37, 0x47, 0xff, 0x13, 0x18, 0x26, 0xff, 0x1a, 0x1c, 0x25, 0xff, 0x24, 0x23, 0x2a, 0xff, 0x0f, 0x0f, 0x14, 0xff, 0x08, 0x0b, 0x0a, 0xff, 0x11, 0x14, 0x12, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x14, 0x15, 0x19, 0xff, 0x0c, 0x0d, 0x11, 0xff, 0x13, 0x10, 0x0f, 0xff, 0x26, 0x24, 0x24, 0xff, 0x25, 0x28, 0x2e, 0xff, 0x1e, 0x24, 0x30, 0xff, 0x2a, 0x35, 0x49, 0xff, 0x3b, 0x49, 0x65, 0xff, 0x4f, 0x5f, 0x84, 0xff, 0x55, 0x67, 0x89, 0xff, 0x44, 0x56, 0x73, 0xff, 0x44, 0x52, 0x6e, 0xff, 0x41, 0x50, 0x6b, 0xff, 0x4b, 0x5a, 0x75, 0xff, 0x4c, 0x5c, 0x77, 0xff, 0x44, 0x53, 0x6e, 0xff, 0x51, 0x60, 0x77, 0xff, 0x4b, 0x59, 0x6e, 0xff, 0x35, 0x41, 0x51, 0xff, 0x29, 0x35, 0x49, 0xff, 0x2d, 0x3a, 0x4f, 0xff, 0x29, 0x33, 0x44, 0xff, 0x2c, 0x34, 0x42, 0xff, 0x17, 0x1e, 0x2b, 0xff, 0x0e, 0x14, 0x1f, 0xff, 0x28, 0x2a, 0x32, 0xff, 0x2a, 0x2e, 0x37, 0xff, 0x0f, 0x14, 0x1a, 0xff, 0x31, 0x32, 0x37, 0xff, 0x41, 0x3d, 0x4c, 0xff, 0x35, 0x36, 0x45, 0xff, 0x2b, 0x33, 0x3c, 0xff, 0x3c, 0x3e, 0x47, 0xff, 0x96, 0x94, 0x9b, 0xff, 0xd0, 0xcf, 0xd2, 0xff, 0xe4, 0xe3, 0xe5, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xbe, 0xc4, 0xff, 0x2a, 0x34, 0x49, 0xff, 0x26, 0x34, 0x50, 0xff, 0x2a, 0x36, 0x4e, 0xff, 0x18, 0x23, 0x2d, 0xff, 0x13, 0x19, 0x22, 0xff, 0x24, 0x26, 0x30, 0xff, 0x1f, 0x1c, 0x28, 0xff, 0x10, 0x0f, 0x16, 0xff, 0x0b, 0x0e, 0x0c, 0xff, 0x18, 0x1c, 0x17, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x13, 0x14, 0x18, 0xff, 0x17, 0x18, 0x1b, 0xff, 0x28, 0x28, 0x29, 0xff, 0x29, 0x2c, 0x33, 0xff, 0x21, 0x2c, 0x3c, 0xff, 0x2f, 0x3e, 0x56, 0xff, 0x47, 0x59, 0x79, 0xff, 0x52, 0x66, 0x8c, 0xff, 0x55, 0x6b, 0x9a, 0xff, 0x55, 0x6f, 0x9a, 0xff, 0x55, 0x6e, 0x97, 0xff, 0x55, 0x6a, 0x90, 0xff, 0x56, 0x6a, 0x8f, 0xff, 0x5b, 0x70, 0x95, 0xff, 0x5f, 0x73, 0x98, 0xff, 0x5f, 0x74, 0x9a, 0xff, 0x54, 0x71, 0x97, 0xff, 0x4d, 0x69, 0x8e, 0xff, 0x4d, 0x67, 0x89, 0xff, 0x59, 0x70, 0x92, 0xff, 0x63, 0x78, 0x96, 0xff, 0x53, 0x63, 0x7b, 0xff, 0x3d, 0x48, 0x5a, 0xff, 0x27, 0x2f, 0x3e, 0xff, 0x1c, 0x24, 0x30, 0xff, 0x2e, 0x33, 0x3e, 0xff, 0x20, 0x24, 0x2e, 0xff, 0x25, 0x29, 0x2e, 0xff, 0x40, 0x40, 0x46, 0xff, 0x3d, 0x3c, 0x4c, 0xff, 0x25, 0x28, 0x36, 0xff, 0x2f, 0x33, 0x36, 0xff, 0x2c, 0x30, 0x3a, 0xff, 0x4d, 0x4b, 0x56, 0xff, 0xb6, 0xb4, 0xba, 0xff, 0xe0, 0xdf, 0xe2, 0xff, 0xee, 0xed, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x55, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xee, 0xf1, 0xff, 0x3f, 0x4e, 0x63, 0xff, 0x1f, 0x28, 0x48, 0xff, 0x35, 0x3c, 0x59, 0xff, 0x26, 0x2f, 0x42, 0xff, 0x10, 0x17, 0x21, 0xff, 0x17, 0x18, 0x1b, 0xff, 0x26, 0x27, 0x2c, 0xff, 0x14, 0x16, 0x1d, 0xff, 0x03, 0x03, 0x06, 0xff, 0x16, 0x16, 0x19, 0xff, 0x28, 0x2a, 0x2d, 0xff, 0x1b, 0x1c, 0x1f, 0xff, 0x1a, 0x19, 0x1a, 0xff, 0x20, 0x25, 0x2c, 0xff, 0x2b, 0x30, 0x37, 0xff, 0x2c, 0x31, 0x45, 0xff, 0x3c, 0x4a, 0x6e, 0xff, 0x49, 0x60, 0x86, 0xff, 0x4c, 0x65, 0x8d, 0xff, 0x49, 0x64, 0x8e, 0xff, 0x50, 0x6c, 0x9a, 0xff, 0x54, 0x74, 0xa3, 0xff, 0x5d, 0x7d, 0xab, 0xff, 0x64, 0x80, 0xae, 0xff, 0x65, 0x7f, 0xad, 0xff, 0x62, 0x7a, 0xaa, 0xff, 0x68, 0x80, 0xaf, 0xff, 0x69, 0x83, 0xb2, 0xff, 0x6a, 0x88, 0xbd, 0xff, 0x72, 0x90, 0xc5, 0xff, 0x74, 0x91, 0xc7, 0xff, 0x7a, 0x98, 0xc9, 0xff, 0x76, 0x90, 0xbb, 0xff, 0x64, 0x76, 0x9b, 0xff, 0x55, 0x65, 0x84, 0xff, 0x4a, 0x5b, 0x77, 0xff, 0x3a, 0x48, 0x60, 0xff, 0x32, 0x3f, 0x52, 0xff, 0x34, 0x36, 0x46, 0xff, 0x39, 0x3a, 0x47, 0xff, 0x48, 0x4c, 0x58, 0xff, 0x3b, 0x41, 0x50, 0xff, 0x24, 0x2b, 0x39, 0xff, 0x29, 0x2f, 0x33, 0xff, 0x2b, 0x2e, 0x37, 0xff, 0x28, 0x2c, 0x34, 0xff, 0x84, 0x87, 0x8c, 0xff, 0xdf, 0xe1, 0xe2, 0xff, 0xd9, 0xda, 0xda, 0xff, 0xfa, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x29, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0x9f, 0xac, 0xff, 0x11, 0x1e, 0x35, 0xff, 0x32, 0x39, 0x55, 0xff, 0x37, 0x3d, 0x55, 0xff, 0x1c, 0x24, 0x31, 0xff, 0x17, 0x1c, 0x26, 0xff, 0x24, 0x23, 0x26, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x0b, 0x0e, 0x13, 0xff, 0x0b, 0x0c, 0x0f, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x23, 0x23, 0x29, 0xff, 0x1d, 0x1b, 0x1e, 0xff, 0x24, 0x23, 0x27, 0xff, 0x2a, 0x32, 0x40, 0xff, 0x2f, 0x3b, 0x4e, 0xff, 0x41, 0x4c, 0x6e, 0xff, 0x4d, 0x5f, 0x8d, 0xff, 0x53, 0x6c, 0x9b, 0xff, 0x55, 0x71, 0xa2, 0xff, 0x56, 0x73, 0xa6, 0xff, 0x5f, 0x7f, 0xb3, 0xff, 0x60, 0x82, 0xbb, 0xff, 0x68, 0x89, 0xc2, 0xff, 0x73, 0x90, 0xca, 0xff, 0x71, 0x8f, 0xc9, 0xff, 0x6e, 0x8f, 0xca, 0xff, 0x6e, 0x8f, 0xc9, 0xff, 0x6c, 0x8d, 0xc7, 0xff, 0x76, 0x95, 0xce, 0xff, 0x79, 0x96, 0xd0, 0xff, 0x76, 0x94, 0xce, 0xff, 0x71, 0x93, 0xce, 0xff, 0x6c, 0x8f, 0xc9, 0xff, 0x63, 0x82, 0xb8, 0xff, 0x61, 0x7d, 0xaf, 0xff, 0x65, 0x80, 0xa9, 0xff, 0x63, 0x79, 0x9e, 0xff, 0x58, 0x6b, 0x8c, 0xff, 0x47, 0x52, 0x6e, 0xff, 0x3d, 0x46, 0x5d, 0xff, 0x57, 0x61, 0x75, 0xff, 0x50, 0x59, 0x6b, 0xff, 0x26, 0x2d, 0x3a, 0xff, 0x18, 0x1f, 0x25, 0xff, 0x25, 0x28, 0x31, 0xff, 0x2b, 0x30, 0x39, 0xff, 0x45, 0x4a, 0x50, 0xff, 0xc8, 0xca, 0xce, 0xff, 0xe2, 0xe3, 0xe4, 0xff, 0xea, 0xea, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x07, 0xfe, 0xfe, 0xfe, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xf1, 0xf7, 0xff, 0x43, 0x4e, 0x6a, 0xff, 0x1f, 0x27, 0x3f, 0xff, 0x3b, 0x41, 0x53, 0xff, 0x32, 0x36, 0x49, 0xff, 0x16, 0x1e, 0x25, 0xff, 0x16, 0x1d, 0x26, 0xff, 0x2a, 0x2a, 0x2d, 0xff, 0x16, 0x17, 0x1c, 0xff, 0x07, 0x0a, 0x11, 0xff, 0x14, 0x14, 0x19, 0xff, 0x21, 0x22, 0x26, 0xff, 0x23, 0x23, 0x27, 0xff, 0x23, 0x1e, 0x24, 0xff, 0x2a, 0x29, 0x32, 0xff, 0x38, 0x40, 0x54, 0xff, 0x3f, 0x53, 0x74, 0xff, 0x52, 0x68, 0x99, 0xff, 0x59, 0x71, 0xa9, 0xff, 0x5c, 0x77, 0xaf, 0xff, 0x61, 0x7d, 0xb9, 0xff, 0x6c, 0x8a, 0xc8, 0xff, 0x73, 0x92, 0xd4, 0xff, 0x6b, 0x92, 0xd0, 0xff, 0x6e, 0x93, 0xd1, 0xff, 0x71, 0x92, 0xd2, 0xff, 0x77, 0x97, 0xd5, 0xff, 0x7a, 0x9b, 0xd8, 0xff, 0x76, 0x98, 0xd4, 0xff, 0x71, 0x93, 0xd0, 0xff, 0x76, 0x9a, 0xd7, 0xff, 0x7a, 0x9e, 0xdc, 0xff, 0x78, 0x9c, 0xd9, 0xff, 0x78, 0x9d, 0xdb, 0xff, 0x75, 0x9a, 0xd9, 0xff, 0x6e, 0x96, 0xd5, 0xff, 0x6d, 0x93, 0xd3, 0xff, 0x66, 0x87, 0xc3, 0xff, 0x67, 0x86, 0xbb, 0xff, 0x68, 0x83, 0xb3, 0xff, 0x58, 0x6e, 0x98, 0xff, 0x54, 0x64, 0x89, 0xff, 0x4b, 0x5c, 0x79, 0xff, 0x46, 0x53, 0x67, 0xff, 0x2e, 0x34, 0x3f, 0xff, 0x1b, 0x24, 0x27, 0xff, 0x19, 0x1c, 0x25, 0xff, 0x28, 0x2b, 0x36, 0xff, 0x2b, 0x2c, 0x36, 0xff, 0x8f, 0x8f, 0x97, 0xff, 0xe6, 0xe6, 0xe8, 0xff, 0xe6, 0xe7, 0xe5, 0xff, 0xf8, 0xf8, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xd1, 0xfe, 0xfe, 0xfe, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xa9, 0xc0, 0xff, 0x12, 0x1f, 0x3f, 0xff, 0x31, 0x3a, 0x4d, 0xff, 0x39, 0x41, 0x52, 0xff, 0x25, 0x29, 0x37, 0xff, 0x19, 0x1d, 0x24, 0xff, 0x21, 0x23, 0x2c, 0xff, 0x21, 0x21, 0x25, 0xff, 0x0a, 0x0c, 0x0f, 0xff, 0x0b, 0x0c, 0x0e, 0xff, 0x1b, 0x1a, 0x1c, 0xff, 0x23, 0x25, 0x29, 0xff, 0x21, 0x23, 0x27, 0xff, 0x27, 0x28, 0x2a, 0xff, 0x32, 0x36, 0x40, 0xff, 0x3c, 0x4f, 0x6e, 0xff, 0x4a, 0x67, 0x9c, 0xff, 0x5a, 0x75, 0xb2, 0xff, 0x5e, 0x79, 0xb6, 0xff, 0x5d, 0x7b, 0xb8, 0xff, 0x63, 0x83, 0xc5, 0xff, 0x6d, 0x90, 0xd1, 0xff, 0x70, 0x96, 0xd9, 0xff, 0x70, 0x97, 0xd6, 0xff, 0x72, 0x98, 0xd6, 0xff, 0x75, 0x99, 0xd5, 0xff, 0x76, 0x9a, 0xd5, 0xff, 0x76, 0x9b, 0xd6, 0xff, 0x7b, 0x9d, 0xd9, 0xff, 0x7c, 0x9d, 0xd9, 0xff, 0x79, 0x9e, 0xdc, 0xff, 0x7a, 0xa0, 0xde, 0xff, 0x7b, 0xa1, 0xdf, 0xff, 0x7d, 0xa3, 0xdf, 0xff, 0x7e, 0xa3, 0xdf, 0xff, 0x80, 0xa6, 0xe3, 0xff, 0x7d, 0xa6, 0xe4, 0xff, 0x6f, 0x9c, 0xd9, 0xff, 0x6c, 0x94, 0xcf, 0xff, 0x6e, 0x91, 0xcb, 0xff, 0x62, 0x83, 0xb9, 0xff, 0x5b, 0x78, 0xa1, 0xff, 0x55, 0x6a, 0x8a, 0xff, 0x3f, 0x48, 0x64, 0xff, 0x2e, 0x33, 0x41, 0xff, 0x29, 0x2c, 0x35, 0xff, 0x27, 0x2b, 0x32, 0xff, 0x28, 0x2c, 0x37, 0xff, 0x21, 0x26, 0x31, 0xff, 0x54, 0x55, 0x61, 0xff, 0xd0, 0xcd, 0xd5, 0xff, 0xe2, 0xe1, 0xe2, 0xff, 0xf0, 0xf0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfa, 0xf9, 0xfa, 0xff, 0xfc, 0xfd, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf6, 0xfa, 0xff, 0x51, 0x5e, 0x7c, 0xff, 0x19, 0x28, 0x42, 0xff, 0x35, 0x3f, 0x4f, 0xff, 0x2b, 0x33, 0x48, 0xff, 0x21, 0x27, 0x32, 0xff, 0x20, 0x22, 0x2c, 0xff, 0x29, 0x27, 0x30, 0xff, 0x14, 0x14, 0x1a, 0xff, 0x02, 0x05, 0x05, 0xff, 0x12, 0x12, 0x12, 0xff, 0x23, 0x22, 0x24, 0xff, 0x1d, 0x20, 0x24, 0xff, 0x16, 0x19, 0x21, 0xff, 0x2a, 0x2f, 0x39, 0xff, 0x43, 0x4e, 0x65, 0xff, 0x4c, 0x6a, 0x9c, 0xff, 0x56, 0x78, 0xbb, 0xff, 0x5e, 0x7d, 0xbf, 0xff, 0x60, 0x7e, 0xbe, 0xff, 0x5e, 0x7f, 0xbf, 0xff, 0x65, 0x8a, 0xca, 0xff, 0x6d, 0x93, 0xd3, 0xff, 0x6f, 0x9a, 0xd8, 0xff, 0x75, 0x9a, 0xdb, 0xff, 0x78, 0x9a, 0xda, 0xff, 0x7b, 0x9c, 0xd7, 0xff, 0x78, 0x9d, 0xd7, 0xff, 0x75, 0x9e, 0xd8, 0xff, 0x7c, 0xa0, 0xdc, 0xff, 0x81, 0xa3, 0xdf, 0xff, 0x82, 0xa6, 0xe1, 0xff, 0x81, 0xa6, 0xe1, 0xff, 0x83, 0xa7, 0xe1, 0xff, 0x83, 0xa8, 0xe3, 0xff, 0x84, 0xaa, 0xe5, 0xff, 0x86, 0xab, 0xe6, 0xff, 0x84, 0xac, 0xe5, 0xff, 0x80, 0xae, 0xe6, 0xff, 0x84, 0xaf, 0xe8, 0xff, 0x7f, 0xa5, 0xe2, 0xff, 0x70, 0x95, 0xd0, 0xff, 0x5e, 0x84, 0xaf, 0xff, 0x61, 0x78, 0x9e, 0xff, 0x52, 0x5a, 0x7f, 0xff, 0x34, 0x3d, 0x52, 0xff, 0x32, 0x32, 0x42, 0xff, 0x35, 0x3b, 0x41, 0xff, 0x2f, 0x34, 0x3d, 0xff, 0x18, 0x21, 0x2c, 0xff, 0x22, 0x25, 0x31, 0xff, 0xa7, 0xa1, 0xaf, 0xff, 0xec, 0xeb, 0xef, 0xff, 0xe5, 0xe6, 0xe2, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x09, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfa, 0xfb, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xbf, 0xcd, 0xff, 0x1e, 0x2a, 0x45, 0xff, 0x2e, 0x3c, 0x54, 0xff, 0x37, 0x44, 0x56, 0xff, 0x26, 0x2f, 0x43, 0xff, 0x20, 0x25, 0x33, 0xff, 0x1f, 0x20, 0x2b, 0xff, 0x26, 0x25, 0x2d, 0xff, 0x17, 0x17, 0x1d, 0xff, 0x05, 0x08, 0x08, 0xff, 0x18, 0x1a, 0x1c, 0xff, 0x20, 0x23, 0x27, 0xff, 0x13, 0x16, 0x1f, 0xff, 0x1a, 0x1e, 0x28, 0xff, 0x37, 0x3d, 0x52, 0xff, 0x4e, 0x61, 0x8c, 0xff, 0x59, 0x79, 0xb7, 0xff, 0x5b, 0x7d, 0xbf, 0xff, 0x60, 0x81, 0xc3, 0xff, 0x63, 0x83, 0xc5, 0xff, 0x66, 0x88, 0xc9, 0xff, 0x6f, 0x91, 0xd1, 0xff, 0x74, 0x98, 0xd8, 0xff, 0x73, 0x9c, 0xdc, 0xff, 0x76, 0x9d, 0xdd, 0xff, 0x79, 0x9c, 0xdb, 0xff, 0x7c, 0x9e, 0xda, 0xff, 0x7d, 0xa0, 0xda, 0xff, 0x7f, 0xa5, 0xdc, 0xff, 0x88, 0xa8, 0xe0, 0xff, 0x8d, 0xab, 0xe4, 0xff, 0x89, 0xab, 0xe3, 0xff, 0x88, 0xab, 0xe3, 0xff, 0x89, 0xac, 0xe4, 0xff, 0x88, 0xac, 0xe4, 0xff, 0x89, 0xae, 0xe7, 0xff, 0x8d, 0xb1, 0xe9, 0xff, 0x8d, 0xb1, 0xea, 0xff, 0x8b, 0xaf, 0xea, 0xff, 0x8c, 0xb2, 0xed, 0xff, 0x8c, 0xb2, 0xed, 0xff, 0x84, 0xad, 0xe4, 0xff, 0x6e, 0x96, 0xcd, 0xff, 0x5b, 0x78, 0xae, 0xff, 0x54, 0x69, 0x94, 0xff, 0x42, 0x53, 0x6f, 0xff, 0x2b, 0x30, 0x44, 0xff, 0x22, 0x27, 0x30, 0xff, 0x2e, 0x32, 0x3b, 0xff, 0x1e, 0x26, 0x31, 0xff, 0x11, 0x13, 0x1f, 0xff, 0x63, 0x5d, 0x6b, 0xff, 0xec, 0xea, 0xed, 0xff, 0xea, 0xec, 0xe7, 0xff, 0xef, 0xef, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x69, 0x77, 0x8c, 0xff, 0x1b, 0x27, 0x45, 0xff, 0x31, 0x3d, 0x54, 0xff, 0x33, 0x3f, 0x53, 0xff, 0x28, 0x2f, 0x41, 0xff, 0x22, 0x27, 0x33, 0xff, 0x27, 0x28, 0x32, 0xff, 0x24, 0x23, 0x2c, 0xff, 0x0b, 0x0b, 0x10, 0xff, 0x0c, 0x0e, 0x0f, 0xff, 0x1a, 0x1c, 0x21, 0xff, 0x14, 0x18, 0x21, 0xff, 0x10, 0x16, 0x1e, 0xff, 0x29, 0x2d, 0x36, 0xff, 0x41, 0x4e, 0x64, 0xff, 0x55, 0x74, 0xa8, 0xff, 0x5d, 0x82, 0xc0, 0xff, 0x5b, 0x80, 0xc1, 0xff, 0x60, 0x83, 0xc5, 0xff, 0x60, 0x83, 0xc5, 0xff, 0x67, 0x8a, 0xcc, 0xff, 0x75, 0x98, 0xd7, 0xff, 0x77, 0x9d, 0xdd, 0xff, 0x76, 0x9f, 0xde, 0xff, 0x7a, 0xa0, 0xe0, 0xff, 0x7c, 0x9f, 0xde, 0xff, 0x7e, 0xa1, 0xdc, 0xff, 0x7f, 0xa3, 0xdc, 0xff, 0x83, 0xa6, 0xdd, 0xff, 0x8b, 0xab, 0xe1, 0xff, 0x91, 0xae, 0xe6, 0xff, 0x8e, 0xad, 0xe3, 0xff, 0x8d, 0xad, 0xe4, 0xff, 0x90, 0xaf, 0xe6, 0xff, 0x8d, 0xaf, 0xe5, 0xff, 0x8e, 0xb2, 0xe8, 0xff, 0x92, 0xb6, 0xeb, 0xff, 0x94, 0xb6, 0xed, 0xff, 0x94, 0xb3, 0xee, 0xff, 0x92, 0xb4, 0xef, 0xff, 0x8e, 0xb5, 0xef, 0xff, 0x8c, 0xb6, 0xeb, 0xff, 0x84, 0xaf, 0xeb, 0xff, 0x73, 0x97, 0xd6, 0xff, 0x58, 0x75, 0xa7, 0xff, 0x44, 0x58, 0x7d, 0xff, 0x2d, 0x35, 0x4b, 0xff, 0x1e, 0x24, 0x2d, 0xff, 0x2b, 0x2f, 0x38, 0xff, 0x2d, 0x34, 0x3e, 0xff, 0x1b, 0x1e, 0x2a, 0xff, 0x33, 0x2f, 0x3b, 0xff, 0xc1, 0xbf, 0xc3, 0xff, 0xf5, 0xf7, 0xf4, 0xff, 0xeb, 0xea, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xd9, 0xde, 0xff, 0x30, 0x42, 0x60, 0xff, 0x28, 0x39, 0x57, 0xff, 0x33, 0x3e, 0x57, 0xff, 0x34, 0x39, 0x4e, 0xff, 0x2d, 0x30, 0x3b, 0xff, 0x1d, 0x24, 0x28, 0xff, 0x20, 0x25, 0x2f, 0xff, 0x1d, 0x22, 0x2b, 0xff, 0x08, 0x0d, 0x0e, 0xff, 0x1a, 0x19, 0x1e, 0xff, 0x19, 0x1c, 0x29, 0xff, 0x0f, 0x11, 0x21, 0xff, 0x1b, 0x21, 0x21, 0xff, 0x2e, 0x35, 0x3b, 0xff, 0x47, 0x59, 0x81, 0xff, 0x5c, 0x80, 0xc0, 0xff, 0x62, 0x87, 0xc4, 0xff, 0x5e, 0x86, 0xc7, 0xff, 0x5f, 0x85, 0xc5, 0xff, 0x60, 0x87, 0xc7, 0xff, 0x6c, 0x90, 0xd1, 0xff, 0x73, 0x9a, 0xda, 0xff, 0x72, 0x9e, 0xdd, 0xff, 0x79, 0x9f, 0xde, 0xff, 0x80, 0xa2, 0xe2, 0xff, 0x7f, 0xa3, 0xe0, 0xff, 0x7f, 0xa4, 0xdc, 0xff, 0x7f, 0xa4, 0xde, 0xff, 0x80, 0xa4, 0xe0, 0xff, 0x85, 0xa8, 0xe0, 0xff, 0x8d, 0xad, 0xe3, 0xff, 0x8f, 0xac, 0xe3, 0xff, 0x90, 0xae, 0xe5, 0xff, 0x94, 0xb1, 0xe9, 0xff, 0x93, 0xb4, 0xea, 0xff, 0x93, 0xb5, 0xea, 0xff, 0x95, 0xb7, 0xec, 0xff, 0x96, 0xb8, 0xed, 0xff, 0x97, 0xb8, 0xed, 0xff, 0x96, 0xb7, 0xec, 0xff, 0x95, 0xb6, 0xeb, 0xff, 0x90, 0xb7, 0xea, 0xff, 0x90, 0xb9, 0xed, 0xff, 0x8a, 0xb5, 0xe9, 0xff, 0x78, 0x9a, 0xd3, 0xff, 0x51, 0x64, 0x95, 0xff, 0x32, 0x40, 0x55, 0xff, 0x2a, 0x2c, 0x3a, 0xff, 0x1c, 0x1f, 0x2a, 0xff, 0x2c, 0x30, 0x3a, 0xff, 0x35, 0x38, 0x44, 0xff, 0x16, 0x1b, 0x25, 0xff, 0x76, 0x7b, 0x83, 0xff, 0xf3, 0xf2, 0xf8, 0xff, 0xf4, 0xee, 0xf2, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x97, 0xa9, 0xff, 0x20, 0x33, 0x53, 0xff, 0x2e, 0x3e, 0x5b, 0xff, 0x34, 0x40, 0x58, 0xff, 0x35, 0x39, 0x4e, 0xff, 0x2a, 0x2c, 0x37, 0xff, 0x14, 0x1a, 0x1f, 0xff, 0x16, 0x1a, 0x24, 0xff, 0x12, 0x17, 0x20, 0xff, 0x10, 0x16, 0x16, 0xff, 0x22, 0x22, 0x28, 0xff, 0x15, 0x17, 0x22, 0xff, 0x15, 0x16, 0x25, 0xff, 0x21, 0x26, 0x29, 0xff, 0x33, 0x3b, 0x4b, 0xff, 0x58, 0x6e, 0x9f, 0xff, 0x61, 0x88, 0xc5, 0xff, 0x68, 0x8a, 0xc8, 0xff, 0x65, 0x8b, 0xcf, 0xff, 0x5f, 0x85, 0xc4, 0xff, 0x66, 0x8c, 0xcc, 0xff, 0x73, 0x98, 0xd8, 0xff, 0x76, 0x9d, 0xdd, 0xff, 0x73, 0x9f, 0xde, 0xff, 0x7a, 0xa0, 0xe0, 0xff, 0x81, 0xa3, 0xe3, 0xff, 0x80, 0xa4, 0xe1, 0xff, 0x80, 0xa5, 0xde, 0xff, 0x7f, 0xa4, 0xde, 0xff, 0x7f, 0xa4, 0xe0, 0xff, 0x85, 0xa8, 0xe0, 0xff, 0x8c, 0xad, 0xe3, 0xff, 0x8f, 0xad, 0xe4, 0xff, 0x90, 0xaf, 0xe6, 0xff, 0x93, 0xb2, 0xe9, 0xff, 0x93, 0xb4, 0xea, 0xff, 0x94, 0xb6, 0xea, 0xff, 0x95, 0xb7, 0xec, 0xff, 0x97, 0xb9, 0xee, 0xff, 0x97, 0xb9, 0xee, 0xff, 0x96, 0xb8, 0xed, 0xff, 0x95, 0xb7, 0xec, 0xff, 0x93, 0xb7, 0xeb, 0xff, 0x94, 0xba, 0xee, 0xff, 0x93, 0xba, 0xed, 0xff, 0x8d, 0xb2, 0xe9, 0xff, 0x68, 0x86, 0xba, 0xff, 0x38, 0x4a, 0x6a, 0xff, 0x2c, 0x31, 0x42, 0xff, 0x23, 0x26, 0x31, 0xff, 0x1b, 0x1f, 0x29, 0xff, 0x2c, 0x30, 0x3b, 0xff, 0x30, 0x35, 0x3f, 0xff, 0x52, 0x57, 0x60, 0xff, 0xe4, 0xe3, 0xe9, 0xff, 0xf9, 0xf2, 0xf7, 0xff, 0xf8, 0xf6, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xd9, 0xe1, 0xff, 0x39, 0x48, 0x69, 0xff, 0x2d, 0x41, 0x64, 0xff, 0x30, 0x3f, 0x5b, 0xff, 0x2d, 0x39, 0x52, 0xff, 0x2f, 0x34, 0x4a, 0xff, 0x2b, 0x2e, 0x39, 0xff, 0x14, 0x1c, 0x1f, 0xff, 0x12, 0x17, 0x21, 0xff, 0x15, 0x1a, 0x23, 0xff, 0x1d, 0x21, 0x21, 0xff, 0x28, 0x28, 0x2d, 0xff, 0x15, 0x12, 0x1c, 0xff, 0x1d, 0x17, 0x28, 0xff, 0x27, 0x2e, 0x34, 0xff, 0x43, 0x4c, 0x65, 0xff, 0x60, 0x7a, 0xb3, 0xff, 0x60, 0x8e, 0xc4, 0xff, 0x6a, 0x8b, 0xc7, 0xff, 0x61, 0x85, 0xcb, 0xff, 0x64, 0x8b, 0xca, 0xff, 0x6e, 0x94, 0xd4, 0xff, 0x77, 0x9b, 0xdc, 0xff, 0x79, 0xa0, 0xdf, 0xff, 0x75, 0xa2, 0xe1, 0xff, 0x7b, 0xa1, 0xe1, 0xff, 0x82, 0xa4, 0xe4, 0xff, 0x81, 0xa5, 0xe2, 0xff, 0x80, 0xa7, 0xdf, 0xff, 0x7f, 0xa5, 0xde, 0xff, 0x7d, 0xa3, 0xe0, 0xff, 0x84, 0xa8, 0xdf, 0xff, 0x8d, 0xad, 0xe3, 0xff, 0x90, 0xae, 0xe5, 0xff, 0x91, 0xb0, 0xe7, 0xff, 0x95, 0xb2, 0xeb, 0xff, 0x94, 0xb4, 0xeb, 0xff, 0x93, 0xb6, 0xeb, 0xff, 0x96, 0xb8, 0xed, 0xff, 0x97, 0xba, 0xef, 0xff, 0x97, 0xba, 0xef, 0xff, 0x96, 0xb8, 0xee, 0xff, 0x95, 0xb7, 0xed, 0xff, 0x95, 0xb7, 0xed, 0xff, 0x97, 0xb9, 0xee, 0xff, 0x99, 0xb9, 0xee, 0xff, 0x90, 0xb9, 0xee, 0xff, 0x72, 0x9e, 0xd5, 0xff, 0x48, 0x5c, 0x89, 0xff, 0x26, 0x2e, 0x41, 0xff, 0x25, 0x28, 0x30, 0xff, 0x25, 0x28, 0x31, 0xff, 0x21, 0x25, 0x30, 0xff, 0x2b, 0x31, 0x3b, 0xff, 0x38, 0x3d, 0x45, 0xff, 0xb2, 0xaf, 0xb5, 0xff, 0xff, 0xf8, 0xfc, 0xff, 0xfa, 0xf8, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x85, 0x8d, 0xa0, 0xff, 0x13, 0x23, 0x45, 0xff, 0x3f, 0x51, 0x74, 0xff, 0x37, 0x46, 0x62, 0xff, 0x2b, 0x36, 0x4d, 0xff, 0x2c, 0x35, 0x46, 0xff, 0x24, 0x28, 0x34, 0xff, 0x13, 0x15, 0x1d, 0xff, 0x12, 0x17, 0x1f, 0xff, 0x17, 0x1b, 0x22, 0xff, 0x26, 0x2a, 0x2f, 0xff, 0x24, 0x28, 0x31, 0xff, 0x0e, 0x10, 0x1a, 0xff, 0x19, 0x17, 0x22, 0xff, 0x2d, 0x30, 0x3d, 0xff, 0x4f, 0x5c, 0x80, 0xff, 0x62, 0x81, 0xc3, 0xff, 0x6a, 0x90, 0xce, 0xff, 0x68, 0x8b, 0xcb, 0xff, 0x60, 0x87, 0xc9, 0xff, 0x69, 0x92, 0xd0, 0xff, 0x71, 0x99, 0xd9, 0xff, 0x79, 0x9e, 0xde, 0xff, 0x80, 0xa4, 0xe3, 0xff, 0x7f, 0xa5, 0xe4, 0xff, 0x80, 0xa4, 0xe4, 0xff, 0x82, 0xa6, 0xe3, 0xff, 0x83, 0xa6, 0xe3, 0xff, 0x85, 0xa6, 0xe2, 0xff, 0x86, 0xa5, 0xe1, 0xff, 0x86, 0xa6, 0xe1, 0xff, 0x89, 0xa9, 0xe3, 0xff, 0x8c, 0xab, 0xe5, 0xff, 0x8b, 0xae, 0xe6, 0xff, 0x8e, 0xb1, 0xe7, 0xff, 0x94, 0xb4, 0xe9, 0xff, 0x96, 0xb7, 0xea, 0xff, 0x98, 0xb9, 0xec, 0xff, 0x99, 0xbb, 0xed, 0xff, 0x9b, 0xbc, 0xee, 0xff, 0x9d, 0xbb, 0xef, 0xff, 0x9a, 0xbc, 0xee, 0xff, 0x9a, 0xbb, 0xee, 0xff, 0x98, 0xba, 0xec, 0xff, 0x97, 0xb9, 0xeb, 0xff, 0x99, 0xb8, 0xed, 0xff, 0x96, 0xbb, 0xf0, 0xff, 0x89, 0xb4, 0xeb, 0xff, 0x58, 0x75, 0xa6, 0xff, 0x2d, 0x36, 0x4e, 0xff, 0x22, 0x27, 0x34, 0xff, 0x1d, 0x24, 0x31, 0xff, 0x23, 0x28, 0x35, 0xff, 0x25, 0x29, 0x33, 0xff, 0x23, 0x28, 0x33, 0xff, 0x5a, 0x5d, 0x68, 0xff, 0xcf, 0xcd, 0xd2, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xda, 0xe2, 0xff, 0x30, 0x3f, 0x5a, 0xff, 0x29, 0x38, 0x57, 0xff, 0x48, 0x59, 0x79, 0xff, 0x43, 0x53, 0x6e, 0xff, 0x2f, 0x3b, 0x4f, 0xff, 0x2a, 0x35, 0x43, 0xff, 0x21, 0x24, 0x31, 0xff, 0x14, 0x10, 0x1d, 0xff, 0x10, 0x14, 0x1b, 0xff, 0x14, 0x17, 0x1b, 0xff, 0x30, 0x33, 0x3c, 0xff, 0x23, 0x29, 0x34, 0xff, 0x08, 0x10, 0x19, 0xff, 0x1c, 0x21, 0x26, 0xff, 0x35, 0x39, 0x4d, 0xff, 0x55, 0x66, 0x92, 0xff, 0x67, 0x8a, 0xce, 0xff, 0x70, 0x91, 0xd4, 0xff, 0x68, 0x8d, 0xcd, 0xff, 0x68, 0x90, 0xcd, 0xff, 0x71, 0x99, 0xd6, 0xff, 0x77, 0xa0, 0xdd, 0xff, 0x7d, 0xa4, 0xe1, 0xff, 0x84, 0xa7, 0xe5, 0xff, 0x86, 0xa8, 0xe6, 0xff, 0x84, 0xa7, 0xe6, 0xff, 0x83, 0xa9, 0xe3, 0xff, 0x85, 0xa9, 0xe3, 0xff, 0x89, 0xa7, 0xe4, 0xff, 0x8b, 0xa8, 0xe3, 0xff, 0x8c, 0xa9, 0xe2, 0xff, 0x8d, 0xaa, 0xe5, 0xff, 0x8d, 0xab, 0xe6, 0xff, 0x8b, 0xaf, 0xe7, 0xff, 0x90, 0xb3, 0xe7, 0xff, 0x95, 0xb5, 0xe7, 0xff, 0x9a, 0xb9, 0xe9, 0xff, 0x9d, 0xbb, 0xeb, 0xff, 0x9e, 0xbd, 0xed, 0xff, 0xa1, 0xbe, 0xee, 0xff, 0xa3, 0xbd, 0xee, 0xff, 0x9f, 0xbe, 0xee, 0xff, 0x9d, 0xbe, 0xee, 0xff, 0x9b, 0xbf, 0xee, 0xff, 0x98, 0xbd, 0xec, 0xff, 0x96, 0xb9, 0xed, 0xff, 0x96, 0xb7, 0xec, 0xff, 0x93, 0xb8, 0xee, 0xff, 0x75, 0x96, 0xc9, 0xff, 0x37, 0x42, 0x60, 0xff, 0x22, 0x28, 0x3a, 0xff, 0x25, 0x2d, 0x3d, 0xff, 0x26, 0x2b, 0x39, 0xff, 0x28, 0x2a, 0x35, 0xff, 0x25, 0x2b, 0x38, 0xff, 0x44, 0x4b, 0x5b, 0xff, 0xc5, 0xc5, 0xca, 0xff, 0xe6, 0xe5, 0xe5, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0x7f, 0x88, 0x96, 0xff, 0x13, 0x23, 0x3e, 0xff, 0x3a, 0x48, 0x66, 0xff, 0x4c, 0x5d, 0x7d, 0xff, 0x45, 0x55, 0x72, 0xff, 0x2e, 0x3a, 0x4f, 0xff, 0x25, 0x30, 0x40, 0xff, 0x23, 0x26, 0x33, 0xff, 0x15, 0x12, 0x1d, 0xff, 0x0c, 0x10, 0x17, 0xff, 0x19, 0x1c, 0x21, 0xff, 0x36, 0x38, 0x41, 0xff, 0x21, 0x26, 0x32, 0xff, 0x0c, 0x15, 0x1b, 0xff, 0x20, 0x28, 0x2e, 0xff, 0x39, 0x46, 0x5c, 0xff, 0x63, 0x7c, 0xaa, 0xff, 0x73, 0x96, 0xd3, 0xff, 0x71, 0x96, 0xd1, 0xff, 0x68, 0x90, 0xcb, 0xff, 0x6d, 0x95, 0xcf, 0xff, 0x7c, 0xa2, 0xdb, 0xff, 0x83, 0xa9, 0xe2, 0xff, 0x83, 0xa8, 0xe2, 0xff, 0x85, 0xaa, 0xe4, 0xff, 0x87, 0xac, 0xe4, 0xff, 0x84, 0xaa, 0xe4, 0xff, 0x84, 0xab, 0xe3, 0xff, 0x87, 0xac, 0xe3, 0xff, 0x89, 0xab, 0xe3, 0xff, 0x8c, 0xab, 0xe2, 0xff, 0x8c, 0xac, 0xe1, 0xff, 0x8e, 0xae, 0xe4, 0xff, 0x90, 0xaf, 0xe5, 0xff, 0x91, 0xb2, 0xe7, 0xff, 0x95, 0xb5, 0xe7, 0xff, 0x99, 0xb8, 0xe7, 0xff, 0x9f, 0xbb, 0xe9, 0xff, 0xa2, 0xbf, 0xec, 0xff, 0xa3, 0xbf, 0xed, 0xff, 0xa6, 0xc1, 0xef, 0xff, 0xa8, 0xc0, 0xef, 0xff, 0xa4, 0xbf, 0xee, 0xff, 0xa0, 0xbe, 0xec, 0xff, 0x9a, 0xbe, 0xec, 0xff, 0x98, 0xbc, 0xec, 0xff, 0x96, 0xb8, 0xed, 0xff, 0x98, 0xb8, 0xec, 0xff, 0x94, 0xb8, 0xec, 0xff, 0x88, 0xa9, 0xe0, 0xff, 0x49, 0x59, 0x7d, 0xff, 0x1f, 0x27, 0x38, 0xff, 0x28, 0x2e, 0x3d, 0xff, 0x2c, 0x2f, 0x3e, 0xff, 0x2a, 0x2c, 0x37, 0xff, 0x24, 0x2b, 0x37, 0xff, 0x2e, 0x33, 0x42, 0xff, 0xc6, 0xc4, 0xc9, 0xff, 0xf7, 0xf7, 0xf6, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xc7, 0xd0, 0xff, 0x30, 0x3b, 0x4f, 0xff, 0x1e, 0x2d, 0x48, 0xff, 0x3c, 0x4a, 0x66, 0xff, 0x4a, 0x59, 0x79, 0xff, 0x41, 0x51, 0x6d, 0xff, 0x2d, 0x38, 0x4c, 0xff, 0x23, 0x2e, 0x3c, 0xff, 0x1e, 0x22, 0x2e, 0xff, 0x14, 0x13, 0x1d, 0xff, 0x0e, 0x10, 0x16, 0xff, 0x21, 0x24, 0x29, 0xff, 0x31, 0x34, 0x3b, 0xff, 0x16, 0x1c, 0x26, 0xff, 0x11, 0x17, 0x1d, 0xff, 0x26, 0x2d, 0x35, 0xff, 0x41, 0x54, 0x71, 0xff, 0x70, 0x92, 0xc9, 0xff, 0x76, 0x9e, 0xe0, 0xff, 0x71, 0x98, 0xd7, 0xff, 0x6f, 0x96, 0xd4, 0xff, 0x77, 0x9d, 0xda, 0xff, 0x83, 0xa9, 0xe5, 0xff, 0x88, 0xb0, 0xed, 0xff, 0x89, 0xb1, 0xec, 0xff, 0x89, 0xb1, 0xeb, 0xff, 0x8a, 0xb2, 0xed, 0xff, 0x8b, 0xb2, 0xe9, 0xff, 0x87, 0xae, 0xe3, 0xff, 0x87, 0xac, 0xe2, 0xff, 0x8d, 0xae, 0xe3, 0xff, 0x8d, 0xac, 0xe2, 0xff, 0x8e, 0xae, 0xe2, 0xff, 0x90, 0xb0, 0xe5, 0xff, 0x91, 0xb1, 0xe6, 0xff, 0x96, 0xb5, 0xe5, 0xff, 0x98, 0xb7, 0xe7, 0xff, 0x9e, 0xba, 0xe9, 0xff, 0xa5, 0xbe, 0xeb, 0xff, 0xa9, 0xc2, 0xee, 0xff, 0xab, 0xc6, 0xf4, 0xff, 0xad, 0xc7, 0xf7, 0xff, 0xb1, 0xc9, 0xf6, 0xff, 0xae, 0xc9, 0xf5, 0xff, 0xa9, 0xc8, 0xf2, 0xff, 0xa2, 0xc9, 0xf8, 0xff, 0x9b, 0xc3, 0xf7, 0xff, 0x98, 0xbc, 0xf3, 0xff, 0x97, 0xb9, 0xec, 0xff, 0x95, 0xbb, 0xee, 0xff, 0x90, 0xb6, 0xee, 0xff, 0x53, 0x68, 0x92, 0xff, 0x26, 0x2e, 0x40, 0xff, 0x2b, 0x32, 0x3f, 0xff, 0x29, 0x2f, 0x3c, 0xff, 0x21, 0x24, 0x2e, 0xff, 0x28, 0x2c, 0x3a, 0xff, 0x27, 0x2c, 0x3b, 0xff, 0x93, 0x95, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xee, 0xec, 0xff, 0xea, 0xea, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xfd, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xf2, 0xf2, 0xf9, 0xff, 0x71, 0x7b, 0x91, 0xff, 0x27, 0x32, 0x4b, 0xff, 0x26, 0x31, 0x4a, 0xff, 0x43, 0x50, 0x6c, 0xff, 0x55, 0x64, 0x84, 0xff, 0x42, 0x50, 0x6a, 0xff, 0x30, 0x3c, 0x4c, 0xff, 0x23, 0x29, 0x35, 0xff, 0x1b, 0x1d, 0x27, 0xff, 0x0e, 0x10, 0x18, 0xff, 0x0c, 0x0b, 0x11, 0xff, 0x20, 0x22, 0x27, 0xff, 0x33, 0x37, 0x3c, 0xff, 0x11, 0x19, 0x1c, 0xff, 0x10, 0x16, 0x1d, 0xff, 0x2b, 0x30, 0x3f, 0xff, 0x59, 0x69, 0x88, 0xff, 0x68, 0x86, 0xbb, 0xff, 0x51, 0x72, 0xaa, 0xff, 0x51, 0x6a, 0x9f, 0xff, 0x59, 0x6b, 0x9f, 0xff, 0x5f, 0x71, 0xa2, 0xff, 0x62, 0x78, 0xa9, 0xff, 0x66, 0x83, 0xb3, 0xff, 0x72, 0x8d, 0xba, 0xff, 0x76, 0x92, 0xc1, 0xff, 0x79, 0x9d, 0xd8, 0xff, 0x8f, 0xb0, 0xe6, 0xff, 0x8c, 0xae, 0xe2, 0xff, 0x86, 0xa8, 0xde, 0xff, 0x8e, 0xaf, 0xe4, 0xff, 0x8d, 0xad, 0xe2, 0xff, 0x8f, 0xae, 0xe3, 0xff, 0x91, 0xb1, 0xe7, 0xff, 0x92, 0xb1, 0xe5, 0xff, 0x97, 0xb4, 0xe5, 0xff, 0x95, 0xb6, 0xec, 0xff, 0x9f, 0xba, 0xeb, 0xff, 0xa1, 0xbd, 0xf0, 0xff, 0x9b, 0xb9, 0xf2, 0xff, 0x9a, 0xb7, 0xec, 0xff, 0x98, 0xb4, 0xe7, 0xff, 0x96, 0xb2, 0xe0, 0xff, 0x91, 0xad, 0xd9, 0xff, 0x8b, 0xa8, 0xd3, 0xff, 0x87, 0xa7, 0xd0, 0xff, 0x8c, 0xad, 0xd8, 0xff, 0x9d, 0xbc, 0xf0, 0xff, 0xa0, 0xc1, 0xf3, 0xff, 0x93, 0xbe, 0xef, 0xff, 0x91, 0xbc, 0xf2, 0xff, 0x58, 0x73, 0x9c, 0xff, 0x2f, 0x35, 0x47, 0xff, 0x2a, 0x31, 0x3c, 0xff, 0x27, 0x31, 0x3a, 0xff, 0x28, 0x2d, 0x37, 0xff, 0x24, 0x23, 0x34, 0xff, 0x20, 0x25, 0x37, 0xff, 0x5e, 0x67, 0x70, 0xff, 0xed, 0xef, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf2, 0xf1, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xb4, 0xc1, 0xff, 0x3c, 0x44, 0x58, 0xff, 0x2e, 0x39, 0x50, 0xff, 0x2f, 0x3a, 0x54, 0xff, 0x4c, 0x59, 0x76, 0xff, 0x59, 0x69, 0x88, 0xff, 0x42, 0x51, 0x6a, 0xff, 0x2f, 0x3b, 0x4b, 0xff, 0x26, 0x2c, 0x39, 0xff, 0x1a, 0x1c, 0x27, 0xff, 0x0c, 0x0c, 0x15, 0xff, 0x0b, 0x0b, 0x11, 0xff, 0x22, 0x25, 0x2a, 0xff, 0x36, 0x3a, 0x40, 0xff, 0x0b, 0x13, 0x15, 0xff, 0x0b, 0x16, 0x22, 0xff, 0x32, 0x39, 0x4c, 0xff, 0x50, 0x58, 0x70, 0xff, 0x38, 0x45, 0x65, 0xff, 0x27, 0x2f, 0x4a, 0xff, 0x2a, 0x2f, 0x48, 0xff, 0x30, 0x34, 0x4a, 0xff, 0x2d, 0x2f, 0x43, 0xff, 0x29, 0x2b, 0x3f, 0xff, 0x2e, 0x31, 0x43, 0xff, 0x35, 0x35, 0x4b, 0xff, 0x3a, 0x40, 0x5b, 0xff, 0x45, 0x53, 0x7a, 0xff, 0x5e, 0x74, 0xa5, 0xff, 0x7f, 0x9d, 0xd2, 0xff, 0x8b, 0xab, 0xe1, 0xff, 0x89, 0xaf, 0xe3, 0xff, 0x8a, 0xae, 0xe2, 0xff, 0x8f, 0xae, 0xe3, 0xff, 0x92, 0xb2, 0xe6, 0xff, 0x91, 0xb1, 0xe6, 0xff, 0x89, 0xad, 0xe8, 0xff, 0x86, 0xac, 0xe9, 0xff, 0x82, 0xa2, 0xd6, 0xff, 0x6e, 0x86, 0xb4, 0xff, 0x54, 0x67, 0x91, 0xff, 0x4b, 0x55, 0x76, 0xff, 0x50, 0x58, 0x71, 0xff, 0x45, 0x4f, 0x66, 0xff, 0x43, 0x49, 0x65, 0xff, 0x4e, 0x4e, 0x6d, 0xff, 0x4a, 0x50, 0x6c, 0xff, 0x4f, 0x60, 0x7c, 0xff, 0x56, 0x6c, 0x94, 0xff, 0x89, 0xa4, 0xd1, 0xff, 0xa4, 0xc8, 0xfb, 0xff, 0x98, 0xc0, 0xf7, 0xff, 0x5b, 0x74, 0x9d, 0xff, 0x23, 0x2b, 0x3c, 0xff, 0x29, 0x2f, 0x3b, 0xff, 0x19, 0x23, 0x2d, 0xff, 0x2b, 0x31, 0x38, 0xff, 0x25, 0x26, 0x32, 0xff, 0x25, 0x29, 0x3c, 0xff, 0x3b, 0x42, 0x50, 0xff, 0xd0, 0xcd, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xee, 0xed, 0xef, 0xff, 0xf9, 0xf9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xe5, 0xed, 0xff, 0x60, 0x6a, 0x7b, 0xff, 0x23, 0x2b, 0x3b, 0xff, 0x27, 0x32, 0x49, 0xff, 0x3d, 0x48, 0x62, 0xff, 0x4f, 0x5d, 0x79, 0xff, 0x4e, 0x5f, 0x7e, 0xff, 0x42, 0x51, 0x6a, 0xff, 0x30, 0x3b, 0x4b, 0xff, 0x26, 0x2c, 0x38, 0xff, 0x18, 0x1a, 0x24, 0xff, 0x0d, 0x0e, 0x17, 0xff, 0x0f, 0x0e, 0x15, 0xff, 0x24, 0x27, 0x2c, 0xff, 0x28, 0x2d, 0x32, 0xff, 0x08, 0x0f, 0x11, 0xff, 0x18, 0x23, 0x2f, 0xff, 0x34, 0x3d, 0x51, 0xff, 0x42, 0x4f, 0x6a, 0xff, 0x46, 0x58, 0x81, 0xff, 0x4d, 0x5c, 0x85, 0xff, 0x48, 0x59, 0x7c, 0xff, 0x41, 0x57, 0x76, 0xff, 0x3f, 0x52, 0x70, 0xff, 0x37, 0x44, 0x62, 0xff, 0x32, 0x38, 0x58, 0xff, 0x32, 0x3b, 0x5c, 0xff, 0x31, 0x3e, 0x58, 0xff, 0x37, 0x40, 0x57, 0xff, 0x34, 0x47, 0x6b, 0xff, 0x62, 0x7d, 0xb2, 0xff, 0x87, 0xa7, 0xde, 0xff, 0x84, 0xad, 0xe1, 0xff, 0x88, 0xaf, 0xe3, 0xff, 0x90, 0xae, 0xe3, 0xff, 0x92, 0xb2, 0xe7, 0xff, 0x93, 0xb3, 0xe9, 0xff, 0x82, 0xa6, 0xe1, 0xff, 0x6a, 0x8d, 0xc6, 0xff, 0x57, 0x70, 0x9d, 0xff, 0x43, 0x4d, 0x6b, 0xff, 0x35, 0x3b, 0x53, 0xff, 0x2b, 0x31, 0x4a, 0xff, 0x2d, 0x31, 0x47, 0xff, 0x3d, 0x3e, 0x52, 0xff, 0x46, 0x4e, 0x69, 0xff, 0x4d, 0x5b, 0x7b, 0xff, 0x5d, 0x6f, 0x9a, 0xff, 0x6c, 0x80, 0xae, 0xff, 0x5f, 0x76, 0x9e, 0xff, 0x5b, 0x71, 0x9a, 0xff, 0x8f, 0xab, 0xe0, 0xff, 0xa9, 0xcc, 0xff, 0xff, 0x59, 0x74, 0x9c, 0xff, 0x12, 0x1b, 0x2c, 0xff, 0x2d, 0x34, 0x3f, 0xff, 0x0a, 0x15, 0x1f, 0xff, 0x1d, 0x25, 0x28, 0xff, 0x26, 0x2a, 0x30, 0xff, 0x22, 0x28, 0x3b, 0xff, 0x2f, 0x33, 0x47, 0xff, 0x9f, 0x9a, 0xa9, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfb, 0xff, 0xfb, 0xfc, 0xfb, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xf2, 0xf7, 0xfa, 0xff, 0x8b, 0x93, 0xa1, 0xff, 0x2f, 0x38, 0x4c, 0xff, 0x31, 0x39, 0x50, 0xff, 0x1f, 0x2a, 0x44, 0xff, 0x48, 0x53, 0x6e, 0xff, 0x5a, 0x65, 0x81, 0xff, 0x52, 0x5d, 0x7b, 0xff, 0x3b, 0x49, 0x62, 0xff, 0x2f, 0x3a, 0x4e, 0xff, 0x24, 0x2a, 0x38, 0xff, 0x1e, 0x23, 0x2d, 0xff, 0x0e, 0x11, 0x19, 0xff, 0x0f, 0x12, 0x17, 0xff, 0x24, 0x24, 0x28, 0xff, 0x1b, 0x19, 0x20, 0xff, 0x03, 0x09, 0x12, 0xff, 0x21, 0x26, 0x34, 0xff, 0x3a, 0x41, 0x5a, 0xff, 0x6d, 0x87, 0xaf, 0xff, 0x7e, 0xa2, 0xd6, 0xff, 0x77, 0x95, 0xcb, 0xff, 0x73, 0x92, 0xc7, 0xff, 0x6f, 0x91, 0xc6, 0xff, 0x6c, 0x8d, 0xc7, 0xff, 0x68, 0x89, 0xc2, 0xff, 0x65, 0x85, 0xba, 0xff, 0x5d, 0x81, 0xb2, 0xff, 0x5c, 0x7e, 0xac, 0xff, 0x5d, 0x76, 0xa1, 0xff, 0x5b, 0x6f, 0x9d, 0xff, 0x6d, 0x85, 0xba, 0xff, 0x84, 0xa5, 0xd8, 0xff, 0x85, 0xae, 0xe4, 0xff, 0x87, 0xab, 0xe4, 0xff, 0x90, 0xad, 0xe0, 0xff, 0x92, 0xb0, 0xe4, 0xff, 0x9a, 0xb8, 0xeb, 0xff, 0x92, 0xaf, 0xdf, 0xff, 0x68, 0x86, 0xb5, 0xff, 0x58, 0x77, 0xa2, 0xff, 0x57, 0x70, 0x9b, 0xff, 0x58, 0x70, 0x9f, 0xff, 0x56, 0x75, 0xa7, 0xff, 0x58, 0x79, 0xab, 0xff, 0x71, 0x91, 0xbd, 0xff, 0x79, 0x9b, 0xca, 0xff, 0x7b, 0x9f, 0xd3, 0xff, 0x8a, 0xac, 0xdc, 0xff, 0x9b, 0xba, 0xe3, 0xff, 0xb7, 0xd2, 0xf6, 0xff, 0x94, 0xb0, 0xd3, 0xff, 0x70, 0x8f, 0xb8, 0xff, 0x9c, 0xc4, 0xf8, 0xff, 0x57, 0x76, 0xa3, 0xff, 0x0d, 0x12, 0x20, 0xff, 0x2e, 0x30, 0x3c, 0xff, 0x15, 0x1a, 0x28, 0xff, 0x10, 0x14, 0x1e, 0xff, 0x1f, 0x21, 0x29, 0xff, 0x1d, 0x20, 0x30, 0xff, 0x28, 0x2d, 0x3f, 0xff, 0x66, 0x6a, 0x7a, 0xff, 0xd8, 0xdc, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xff, 0xf5, 0xf4, 0xf5, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xef, 0xf4, 0xf7, 0xff, 0xa9, 0xaf, 0xba, 0xff, 0x3c, 0x42, 0x53, 0xff, 0x47, 0x4e, 0x62, 0xff, 0x35, 0x3f, 0x58, 0xff, 0x2a, 0x35, 0x52, 0xff, 0x57, 0x62, 0x7d, 0xff, 0x53, 0x5c, 0x78, 0xff, 0x4c, 0x55, 0x72, 0xff, 0x39, 0x47, 0x60, 0xff, 0x2c, 0x36, 0x4c, 0xff, 0x25, 0x29, 0x39, 0xff, 0x1b, 0x21, 0x2a, 0xff, 0x11, 0x15, 0x1d, 0xff, 0x14, 0x17, 0x1b, 0xff, 0x1c, 0x1c, 0x1e, 0xff, 0x17, 0x12, 0x1a, 0xff, 0x0e, 0x11, 0x1e, 0xff, 0x24, 0x2c, 0x3c, 0xff, 0x44, 0x53, 0x6f, 0xff, 0x7d, 0xa0, 0xd0, 0xff, 0x7b, 0xaa, 0xe3, 0xff, 0x69, 0x93, 0xcc, 0xff, 0x63, 0x8a, 0xc8, 0xff, 0x68, 0x8b, 0xd1, 0xff, 0x67, 0x8c, 0xd3, 0xff, 0x66, 0x8e, 0xd0, 0xff, 0x67, 0x91, 0xd1, 0xff, 0x66, 0x8f, 0xcc, 0xff, 0x6b, 0x8e, 0xcb, 0xff, 0x6f, 0x92, 0xd0, 0xff, 0x77, 0x96, 0xd4, 0xff, 0x83, 0xa1, 0xda, 0xff, 0x8f, 0xb1, 0xe1, 0xff, 0x93, 0xb7, 0xe7, 0xff, 0x8c, 0xae, 0xe6, 0xff, 0x8b, 0xac, 0xe2, 0xff, 0x92, 0xb1, 0xe4, 0xff, 0xa0, 0xbb, 0xeb, 0xff, 0xa9, 0xc1, 0xec, 0xff, 0x91, 0xaf, 0xdb, 0xff, 0x83, 0xa8, 0xd9, 0xff, 0x83, 0xae, 0xe0, 0xff, 0x7a, 0xa5, 0xdb, 0xff, 0x7a, 0xa5, 0xe0, 0xff, 0x79, 0xa4, 0xe6, 0xff, 0x7a, 0xa1, 0xe7, 0xff, 0x7b, 0xa2, 0xe3, 0xff, 0x83, 0xa9, 0xe6, 0xff, 0x81, 0xac, 0xe4, 0xff, 0x8c, 0xb5, 0xe8, 0xff, 0xa3, 0xc3, 0xec, 0xff, 0xb6, 0xd4, 0xfb, 0xff, 0x8b, 0xab, 0xd2, 0xff, 0x8d, 0xb6, 0xed, 0xff, 0x52, 0x72, 0xa1, 0xff, 0x0d, 0x10, 0x1d, 0xff, 0x29, 0x2a, 0x36, 0xff, 0x24, 0x26, 0x35, 0xff, 0x11, 0x12, 0x1f, 0xff, 0x14, 0x13, 0x1e, 0xff, 0x1a, 0x1d, 0x29, 0xff, 0x21, 0x26, 0x35, 0xff, 0x55, 0x5e, 0x6d, 0xff, 0x9f, 0xa5, 0xaf, 0xff, 0xf6, 0xfa, 0xfa, 0xff, 0xfc, 0xfc, 0xfa, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf9, 0xfd, 0xff, 0xc1, 0xc4, 0xd3, 0xff, 0x40, 0x42, 0x59, 0xff, 0x48, 0x4b, 0x62, 0xff, 0x59, 0x61, 0x74, 0xff, 0x23, 0x2e, 0x44, 0xff, 0x3e, 0x49, 0x65, 0xff, 0x55, 0x5f, 0x7a, 0xff, 0x4c, 0x58, 0x74, 0xff, 0x44, 0x4d, 0x6b, 0xff, 0x3e, 0x4d, 0x66, 0xff, 0x28, 0x34, 0x49, 0xff, 0x21, 0x25, 0x34, 0xff, 0x1f, 0x25, 0x2e, 0xff, 0x15, 0x18, 0x21, 0xff, 0x0f, 0x12, 0x16, 0xff, 0x10, 0x10, 0x12, 0xff, 0x14, 0x10, 0x17, 0xff, 0x19, 0x1d, 0x27, 0xff, 0x24, 0x2f, 0x3e, 0xff, 0x49, 0x5c, 0x78, 0xff, 0x6e, 0x91, 0xc5, 0xff, 0x68, 0x96, 0xdc, 0xff, 0x69, 0x91, 0xd3, 0xff, 0x58, 0x7d, 0xb9, 0xff, 0x57, 0x78, 0xaf, 0xff, 0x51, 0x70, 0xa6, 0xff, 0x55, 0x72, 0xab, 0xff, 0x55, 0x71, 0xad, 0xff, 0x54, 0x6d, 0xab, 0xff, 0x59, 0x70, 0xb4, 0xff, 0x5d, 0x7d, 0xbd, 0xff, 0x5b, 0x83, 0xc1, 0xff, 0x75, 0x9e, 0xdd, 0xff, 0x93, 0xba, 0xeb, 0xff, 0xa9, 0xc7, 0xe9, 0xff, 0x96, 0xb7, 0xe8, 0xff, 0x82, 0xac, 0xe8, 0xff, 0x94, 0xb6, 0xe6, 0xff, 0xa8, 0xc3, 0xee, 0xff, 0xba, 0xce, 0xf5, 0xff, 0xaa, 0xc5, 0xf1, 0xff, 0x8e, 0xb6, 0xe7, 0xff, 0x78, 0xa1, 0xdb, 0xff, 0x6a, 0x8e, 0xcd, 0xff, 0x5b, 0x81, 0xb8, 0xff, 0x5a, 0x7f, 0xb5, 0xff, 0x60, 0x7e, 0xbb, 0xff, 0x6e, 0x8f, 0xce, 0xff, 0x72, 0x98, 0xd9, 0xff, 0x76, 0xa0, 0xe3, 0xff, 0x87, 0xb1, 0xef, 0xff, 0x84, 0xab, 0xe4, 0xff, 0x96, 0xb6, 0xee, 0xff, 0xaa, 0xc2, 0xf4, 0xff, 0x97, 0xbc, 0xf6, 0xff, 0x42, 0x63, 0x8e, 0xff, 0x09, 0x0d, 0x1a, 0xff, 0x1e, 0x1e, 0x2b, 0xff, 0x26, 0x29, 0x39, 0xff, 0x20, 0x22, 0x2e, 0xff, 0x0a, 0x0a, 0x14, 0xff, 0x10, 0x14, 0x21, 0xff, 0x16, 0x1c, 0x2c, 0xff, 0x64, 0x6b, 0x7e, 0xff, 0x87, 0x8c, 0x99, 0xff, 0xc8, 0xca, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf4, 0xf4, 0xf5, 0xff, 0xf4, 0xf4, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x07, 0xfe, 0xfe, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xdb, 0xe0, 0xeb, 0xff, 0x73, 0x77, 0x8c, 0xff, 0x57, 0x5a, 0x72, 0xff, 0x54, 0x59, 0x6f, 0xff, 0x21, 0x2a, 0x3d, 0xff, 0x2d, 0x37, 0x4c, 0xff, 0x42, 0x4d, 0x69, 0xff, 0x49, 0x57, 0x72, 0xff, 0x45, 0x4f, 0x68, 0xff, 0x44, 0x4e, 0x6a, 0xff, 0x48, 0x55, 0x6f, 0xff, 0x2a, 0x34, 0x49, 0xff, 0x20, 0x25, 0x34, 0xff, 0x26, 0x2d, 0x36, 0xff, 0x19, 0x1d, 0x25, 0xff, 0x0a, 0x0c, 0x11, 0xff, 0x13, 0x13, 0x16, 0xff, 0x11, 0x0f, 0x18, 0xff, 0x1a, 0x1f, 0x2d, 0xff, 0x30, 0x35, 0x43, 0xff, 0x48, 0x51, 0x70, 0xff, 0x66, 0x81, 0xc0, 0xff, 0x5f, 0x83, 0xcf, 0xff, 0x5b, 0x77, 0xb7, 0xff, 0x4d, 0x64, 0x94, 0xff, 0x36, 0x4e, 0x6b, 0xff, 0x1f, 0x2d, 0x47, 0xff, 0x2c, 0x36, 0x50, 0xff, 0x28, 0x33, 0x50, 0xff, 0x27, 0x31, 0x5e, 0xff, 0x3b, 0x49, 0x82, 0xff, 0x57, 0x72, 0xa9, 0xff, 0x5c, 0x84, 0xbc, 0xff, 0x62, 0x8c, 0xcb, 0xff, 0x8d, 0xb4, 0xe5, 0xff, 0xaf, 0xce, 0xef, 0xff, 0x9b, 0xbd, 0xec, 0xff, 0x83, 0xac, 0xea, 0xff, 0x94, 0xb5, 0xe7, 0xff, 0xad, 0xc9, 0xef, 0xff, 0xb5, 0xcb, 0xef, 0xff, 0x9f, 0xbd, 0xeb, 0xff, 0x71, 0x9d, 0xd7, 0xff, 0x62, 0x85, 0xc9, 0xff, 0x52, 0x69, 0xa5, 0xff, 0x2c, 0x43, 0x69, 0xff, 0x1d, 0x2e, 0x44, 0xff, 0x38, 0x41, 0x54, 0xff, 0x2c, 0x3b, 0x5c, 0xff, 0x32, 0x47, 0x75, 0xff, 0x69, 0x82, 0xb5, 0xff, 0x77, 0x92, 0xcd, 0xff, 0x7f, 0xa5, 0xe6, 0xff, 0x82, 0xac, 0xe7, 0xff, 0x9a, 0xb9, 0xea, 0xff, 0x9c, 0xc5, 0xfe, 0xff, 0x44, 0x63, 0x8e, 0xff, 0x0a, 0x0d, 0x1a, 0xff, 0x20, 0x21, 0x2d, 0xff, 0x21, 0x24, 0x32, 0xff, 0x21, 0x24, 0x2f, 0xff, 0x0c, 0x0d, 0x17, 0xff, 0x12, 0x12, 0x21, 0xff, 0x16, 0x1b, 0x2b, 0xff, 0x4d, 0x53, 0x65, 0xff, 0xaf, 0xb2, 0xbf, 0xff, 0xad, 0xae, 0xb6, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xf6, 0xf6, 0xf5, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xef, 0xfe, 0xfe, 0xfe, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x46, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xfd, 0xf8, 0xff, 0xfc, 0xfd, 0xfd, 0xff, 0xea, 0xee, 0xf4, 0xff, 0x7e, 0x83, 0x8f, 0xff, 0x5c, 0x63, 0x77, 0xff, 0x76, 0x7d, 0x8f, 0xff, 0x13, 0x1c, 0x2c, 0xff, 0x29, 0x35, 0x47, 0xff, 0x4d, 0x56, 0x6d, 0xff, 0x3d, 0x47, 0x62, 0xff, 0x3f, 0x50, 0x67, 0xff, 0x3e, 0x45, 0x58, 0xff, 0x4c, 0x57, 0x71, 0xff, 0x4f, 0x5c, 0x76, 0xff, 0x2c, 0x32, 0x47, 0xff, 0x20, 0x26, 0x35, 0xff, 0x1d, 0x23, 0x2c, 0xff, 0x18, 0x1b, 0x23, 0xff, 0x0f, 0x11, 0x16, 0xff, 0x11, 0x11, 0x16, 0xff, 0x0e, 0x11, 0x1c, 0xff, 0x21, 0x25, 0x39, 0xff, 0x39, 0x3e, 0x50, 0xff, 0x3f, 0x4a, 0x6e, 0xff, 0x59, 0x6e, 0xae, 0xff, 0x4b, 0x63, 0x9b, 0xff, 0x43, 0x53, 0x78, 0xff, 0x2c, 0x31, 0x4f, 0xff, 0x16, 0x1e, 0x33, 0xff, 0x07, 0x0a, 0x15, 0xff, 0x1a, 0x1f, 0x1c, 0xff, 0x20, 0x27, 0x2c, 0xff, 0x32, 0x3b, 0x53, 0xff, 0x44, 0x4f, 0x6a, 0xff, 0x31, 0x44, 0x6d, 0xff, 0x5e, 0x78, 0xb0, 0xff, 0x6f, 0x8f, 0xcb, 0xff, 0x88, 0xae, 0xde, 0xff, 0xa3, 0xc6, 0xf2, 0xff, 0x9a, 0xbd, 0xf1, 0xff, 0x8b, 0xac, 0xe8, 0xff, 0x94, 0xb1, 0xe7, 0xff, 0xac, 0xca, 0xf0, 0xff, 0xa8, 0xc8, 0xf2, 0xff, 0x8b, 0xb4, 0xe7, 0xff, 0x71, 0x9a, 0xda, 0xff, 0x4b, 0x6c, 0xa2, 0xff, 0x2a, 0x40, 0x63, 0xff, 0x21, 0x2a, 0x41, 0xff, 0x0b, 0x09, 0x13, 0xff, 0x20, 0x18, 0x1d, 0xff, 0x3f, 0x3e, 0x47, 0xff, 0x50, 0x55, 0x5e, 0xff, 0x2a, 0x37, 0x4d, 0xff, 0x5a, 0x69, 0x9a, 0xff, 0x78, 0x97, 0xd9, 0xff, 0x78, 0xaa, 0xea, 0xff, 0x87, 0xb3, 0xe9, 0xff, 0x98, 0xc5, 0xff, 0xff, 0x4a, 0x67, 0x90, 0xff, 0x07, 0x09, 0x14, 0xff, 0x2a, 0x2d, 0x36, 0xff, 0x29, 0x2d, 0x38, 0xff, 0x16, 0x1d, 0x26, 0xff, 0x17, 0x1a, 0x23, 0xff, 0x1a, 0x16, 0x25, 0xff, 0x1a, 0x1e, 0x2b, 0xff, 0x28, 0x2e, 0x3c, 0xff, 0xc5, 0xc8, 0xd2, 0xff, 0xb6, 0xb7, 0xc4, 0xff, 0xc4, 0xc0, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfd, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf8, 0xff, 0xff, 0x87, 0x8f, 0x9d, 0xff, 0x47, 0x4e, 0x5d, 0xff, 0x5f, 0x64, 0x76, 0xff, 0x0e, 0x13, 0x25, 0xff, 0x18, 0x21, 0x32, 0xff, 0x67, 0x72, 0x84, 0xff, 0x43, 0x4f, 0x68, 0xff, 0x45, 0x4f, 0x68, 0xff, 0x35, 0x3e, 0x4c, 0xff, 0x3b, 0x42, 0x55, 0xff, 0x4e, 0x5b, 0x78, 0xff, 0x47, 0x54, 0x6e, 0xff, 0x2b, 0x32, 0x47, 0xff, 0x25, 0x2b, 0x3a, 0xff, 0x1a, 0x20, 0x28, 0xff, 0x15, 0x18, 0x20, 0xff, 0x0d, 0x0f, 0x14, 0xff, 0x0f, 0x0f, 0x14, 0xff, 0x13, 0x15, 0x20, 0xff, 0x2b, 0x2e, 0x40, 0xff, 0x3a, 0x46, 0x5d, 0xff, 0x35, 0x48, 0x6e, 0xff, 0x3d, 0x4a, 0x7a, 0xff, 0x2d, 0x36, 0x56, 0xff, 0x07, 0x0d, 0x1a, 0xff, 0x1d, 0x1a, 0x28, 0xff, 0x67, 0x67, 0x73, 0xff, 0x2a, 0x35, 0x41, 0xff, 0x06, 0x0d, 0x1a, 0xff, 0x1a, 0x22, 0x35, 0xff, 0x4f, 0x5c, 0x74, 0xff, 0x5c, 0x6b, 0x81, 0xff, 0x19, 0x2a, 0x50, 0xff, 0x40, 0x52, 0x8a, 0xff, 0x70, 0x8e, 0xce, 0xff, 0x82, 0xa7, 0xdc, 0xff, 0xa1, 0xc2, 0xf1, 0xff, 0x9a, 0xbb, 0xf0, 0xff, 0x89, 0xab, 0xe7, 0xff, 0x99, 0xb6, 0xec, 0xff, 0xa9, 0xc7, 0xee, 0xff, 0xa1, 0xc5, 0xf5, 0xff, 0x8e, 0xb8, 0xec, 0xff, 0x72, 0x98, 0xd1, 0xff, 0x38, 0x50, 0x7f, 0xff, 0x30, 0x41, 0x63, 0xff, 0x37, 0x43, 0x60, 0xff, 0x1e, 0x27, 0x40, 0xff, 0x05, 0x0f, 0x28, 0xff, 0x4e, 0x57, 0x6a, 0xff, 0x90, 0x97, 0xa1, 0xff, 0x14, 0x19, 0x1d, 0xff, 0x0d, 0x0f, 0x22, 0xff, 0x46, 0x4f, 0x7e, 0xff, 0x6f, 0x8b, 0xd1, 0xff, 0x8b, 0xb3, 0xf7, 0xff, 0x95, 0xc1, 0xff, 0xff, 0x55, 0x73, 0x99, 0xff, 0x00, 0x02, 0x0b, 0xff, 0x1c, 0x1f, 0x29, 0xff, 0x30, 0x33, 0x3f, 0xff, 0x0e, 0x13, 0x1d, 0xff, 0x11, 0x14, 0x1d, 0xff, 0x2b, 0x28, 0x37, 0xff, 0x1b, 0x1f, 0x2e, 0xff, 0x1f, 0x23, 0x37, 0xff, 0xa4, 0xa7, 0xb3, 0xff, 0xdb, 0xde, 0xe3, 0xff, 0xab, 0xa9, 0xb6, 0xff, 0xf1, 0xf1, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfc, 0xf8, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xab, 0xba, 0xff, 0x40, 0x4d, 0x61, 0xff, 0x4d, 0x57, 0x69, 0xff, 0x1e, 0x22, 0x34, 0xff, 0x3e, 0x44, 0x55, 0xff, 0x4f, 0x59, 0x6a, 0xff, 0x46, 0x51, 0x63, 0xff, 0x32, 0x3f, 0x59, 0xff, 0x33, 0x3c, 0x53, 0xff, 0x21, 0x24, 0x2b, 0xff, 0x46, 0x4a, 0x5e, 0xff, 0x50, 0x5e, 0x7b, 0xff, 0x3e, 0x4a, 0x64, 0xff, 0x26, 0x2c, 0x41, 0xff, 0x28, 0x2e, 0x3d, 0xff, 0x23, 0x29, 0x32, 0xff, 0x17, 0x1a, 0x22, 0xff, 0x07, 0x09, 0x0e, 0xff, 0x0c, 0x0c, 0x10, 0xff, 0x17, 0x19, 0x24, 0xff, 0x30, 0x33, 0x46, 0xff, 0x3a, 0x44, 0x55, 0xff, 0x43, 0x51, 0x6f, 0xff, 0x3d, 0x46, 0x6e, 0xff, 0x1f, 0x29, 0x43, 0xff, 0x17, 0x29, 0x3d, 0xff, 0x36, 0x42, 0x5d, 0xff, 0x39, 0x4a, 0x6b, 0xff, 0x26, 0x3a, 0x5c, 0xff, 0x34, 0x3f, 0x68, 0xff, 0x3e, 0x4a, 0x78, 0xff, 0x41, 0x57, 0x85, 0xff, 0x52, 0x6c, 0x9e, 0xff, 0x5a, 0x77, 0xad, 0xff, 0x5b, 0x79, 0xb4, 0xff, 0x6c, 0x8c, 0xcd, 0xff, 0x87, 0xaa, 0xe1, 0xff, 0xa2, 0xc2, 0xf4, 0xff, 0x99, 0xbb, 0xf1, 0xff, 0x88, 0xaa, 0xe6, 0xff, 0x9c, 0xba, 0xf0, 0xff, 0xa8, 0xc5, 0xec, 0xff, 0xa6, 0xc4, 0xec, 0xff, 0x93, 0xba, 0xec, 0xff, 0x72, 0x9d, 0xdb, 0xff, 0x66, 0x85, 0xbf, 0xff, 0x54, 0x6d, 0xa0, 0xff, 0x3f, 0x5b, 0x8f, 0xff, 0x44, 0x5f, 0x94, 0xff, 0x4b, 0x63, 0x99, 0xff, 0x46, 0x5f, 0x94, 0xff, 0x4a, 0x65, 0x97, 0xff, 0x56, 0x6f, 0xa1, 0xff, 0x34, 0x47, 0x72, 0xff, 0x44, 0x52, 0x84, 0xff, 0x77, 0x94, 0xd0, 0xff, 0x89, 0xb7, 0xea, 0xff, 0x99, 0xc6, 0xff, 0xff, 0x6b, 0x88, 0xb1, 0xff, 0x06, 0x08, 0x12, 0xff, 0x05, 0x05, 0x0f, 0xff, 0x2c, 0x30, 0x3b, 0xff, 0x1b, 0x21, 0x2b, 0xff, 0x11, 0x13, 0x1d, 0xff, 0x2d, 0x2a, 0x39, 0xff, 0x29, 0x2d, 0x3c, 0xff, 0x20, 0x23, 0x3b, 0xff, 0x81, 0x84, 0x92, 0xff, 0xe3, 0xe7, 0xea, 0xff, 0xc0, 0xbf, 0xc8, 0xff, 0xe9, 0xe8, 0xe8, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfd, 0xfe, 0xfc, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xd0, 0xdb, 0xff, 0x39, 0x47, 0x60, 0xff, 0x2a, 0x38, 0x49, 0xff, 0x21, 0x23, 0x33, 0xff, 0x89, 0x8b, 0x98, 0xff, 0x77, 0x81, 0x93, 0xff, 0x49, 0x52, 0x68, 0xff, 0x28, 0x2f, 0x42, 0xff, 0x24, 0x2c, 0x3d, 0xff, 0x09, 0x12, 0x1f, 0xff, 0x1f, 0x28, 0x33, 0xff, 0x56, 0x63, 0x70, 0xff, 0x4f, 0x5e, 0x74, 0xff, 0x35, 0x3e, 0x5b, 0xff, 0x25, 0x2a, 0x3e, 0xff, 0x26, 0x2a, 0x37, 0xff, 0x28, 0x2b, 0x38, 0xff, 0x19, 0x1a, 0x22, 0xff, 0x06, 0x07, 0x09, 0xff, 0x0c, 0x0c, 0x11, 0xff, 0x17, 0x1a, 0x26, 0xff, 0x31, 0x3c, 0x4e, 0xff, 0x3e, 0x46, 0x5d, 0xff, 0x45, 0x56, 0x7b, 0xff, 0x49, 0x65, 0x96, 0xff, 0x50, 0x68, 0x9b, 0xff, 0x5a, 0x7a, 0xaf, 0xff, 0x56, 0x76, 0xad, 0xff, 0x50, 0x6f, 0xa8, 0xff, 0x5a, 0x7c, 0xb5, 0xff, 0x60, 0x82, 0xbd, 0xff, 0x61, 0x83, 0xbf, 0xff, 0x60, 0x81, 0xbc, 0xff, 0x61, 0x7e, 0xbb, 0xff, 0x70, 0x92, 0xcf, 0xff, 0x74, 0x9b, 0xd8, 0xff, 0x79, 0xa1, 0xdb, 0xff, 0x90, 0xb9, 0xe7, 0xff, 0xa7, 0xc7, 0xf5, 0xff, 0x96, 0xba, 0xf3, 0xff, 0x89, 0xab, 0xea, 0xff, 0xa4, 0xb9, 0xef, 0xff, 0xa7, 0xc1, 0xee, 0xff, 0xa4, 0xc3, 0xee, 0xff, 0x9d, 0xc0, 0xf0, 0xff, 0x8a, 0xb4, 0xe8, 0xff, 0x7a, 0xa4, 0xdb, 0xff, 0x69, 0x8f, 0xc8, 0xff, 0x63, 0x82, 0xc1, 0xff, 0x62, 0x81, 0xbf, 0xff, 0x6e, 0x94, 0xce, 0xff, 0x77, 0x9f, 0xdc, 0xff, 0x79, 0xa5, 0xe5, 0xff, 0x80, 0xad, 0xee, 0xff, 0x84, 0xaf, 0xec, 0xff, 0x84, 0xad, 0xe8, 0xff, 0x83, 0xaf, 0xe5, 0xff, 0x85, 0xb3, 0xe6, 0xff, 0x9e, 0xc4, 0xff, 0xff, 0x74, 0x96, 0xc8, 0xff, 0x0e, 0x12, 0x1e, 0xff, 0x03, 0x00, 0x00, 0xff, 0x1d, 0x1e, 0x2a, 0xff, 0x28, 0x2f, 0x40, 0xff, 0x1f, 0x26, 0x33, 0xff, 0x1f, 0x25, 0x34, 0xff, 0x2a, 0x31, 0x40, 0xff, 0x2c, 0x32, 0x43, 0xff, 0x61, 0x64, 0x77, 0xff, 0xd5, 0xd8, 0xe4, 0xff, 0xcf, 0xd0, 0xd7, 0xff, 0xe4, 0xe3, 0xe9, 0xff, 0xf8, 0xf6, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xee, 0xf7, 0xff, 0x45, 0x50, 0x68, 0xff, 0x11, 0x1e, 0x36, 0xff, 0x20, 0x2a, 0x37, 0xff, 0xa7, 0xa8, 0xb6, 0xff, 0xb0, 0xb5, 0xc4, 0xff, 0x49, 0x52, 0x65, 0xff, 0x2b, 0x32, 0x46, 0xff, 0x10, 0x14, 0x25, 0xff, 0x0d, 0x12, 0x1e, 0xff, 0x00, 0x09, 0x13, 0xff, 0x39, 0x45, 0x55, 0xff, 0x54, 0x61, 0x72, 0xff, 0x4a, 0x58, 0x6e, 0xff, 0x30, 0x38, 0x55, 0xff, 0x22, 0x26, 0x39, 0xff, 0x21, 0x25, 0x32, 0xff, 0x23, 0x24, 0x32, 0xff, 0x13, 0x14, 0x1c, 0xff, 0x09, 0x09, 0x0b, 0xff, 0x0e, 0x0f, 0x16, 0xff, 0x1a, 0x1f, 0x2e, 0xff, 0x34, 0x3f, 0x54, 0xff, 0x39, 0x47, 0x64, 0xff, 0x46, 0x65, 0x91, 0xff, 0x5a, 0x84, 0xbb, 0xff, 0x67, 0x8b, 0xc7, 0xff, 0x63, 0x8a, 0xc7, 0xff, 0x63, 0x8b, 0xc7, 0xff, 0x65, 0x8e, 0xc9, 0xff, 0x68, 0x8e, 0xcc, 0xff, 0x69, 0x90, 0xce, 0xff, 0x61, 0x88, 0xc5, 0xff, 0x63, 0x89, 0xc7, 0xff, 0x6c, 0x93, 0xd0, 0xff, 0x72, 0x9b, 0xd7, 0xff, 0x77, 0xa1, 0xde, 0xff, 0x82, 0xad, 0xe4, 0xff, 0x9a, 0xc3, 0xf0, 0xff, 0xaa, 0xca, 0xf7, 0xff, 0x97, 0xb9, 0xf2, 0xff, 0x8b, 0xae, 0xeb, 0xff, 0xa4, 0xbc, 0xee, 0xff, 0xaa, 0xc2, 0xee, 0xff, 0xa6, 0xc2, 0xf1, 0xff, 0xa2, 0xc2, 0xf2, 0xff, 0x97, 0xbe, 0xee, 0xff, 0x8a, 0xb2, 0xe6, 0xff, 0x7f, 0xa6, 0xde, 0xff, 0x7a, 0x9c, 0xd7, 0xff, 0x76, 0x98, 0xd3, 0xff, 0x73, 0x9a, 0xd3, 0xff, 0x76, 0x9e, 0xda, 0xff, 0x7c, 0xa8, 0xe7, 0xff, 0x87, 0xb1, 0xeb, 0xff, 0x8a, 0xb3, 0xeb, 0xff, 0x8a, 0xb3, 0xed, 0xff, 0x86, 0xb0, 0xe8, 0xff, 0x87, 0xb0, 0xea, 0xff, 0x9d, 0xc1, 0xfe, 0xff, 0x7f, 0xa3, 0xdb, 0xff, 0x1a, 0x21, 0x35, 0xff, 0x01, 0x00, 0x00, 0xff, 0x19, 0x1a, 0x26, 0xff, 0x31, 0x38, 0x49, 0xff, 0x2f, 0x37, 0x46, 0xff, 0x1b, 0x23, 0x32, 0xff, 0x1a, 0x22, 0x2f, 0xff, 0x32, 0x39, 0x47, 0xff, 0x54, 0x57, 0x6c, 0xff, 0xbe, 0xc0, 0xcf, 0xff, 0xdb, 0xdd, 0xe5, 0xff, 0xdd, 0xdc, 0xe4, 0xff, 0xf6, 0xf4, 0xf7, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xa4, 0xae, 0xff, 0x00, 0x0a, 0x22, 0xff, 0x11, 0x15, 0x24, 0xff, 0xa0, 0xa6, 0xad, 0xff, 0xeb, 0xec, 0xfc, 0xff, 0x61, 0x6a, 0x7f, 0xff, 0x3e, 0x47, 0x5b, 0xff, 0x13, 0x17, 0x27, 0xff, 0x08, 0x08, 0x16, 0xff, 0x03, 0x05, 0x10, 0xff, 0x1f, 0x2a, 0x33, 0xff, 0x4f, 0x59, 0x6d, 0xff, 0x4a, 0x53, 0x6e, 0xff, 0x45, 0x52, 0x6b, 0xff, 0x30, 0x38, 0x55, 0xff, 0x22, 0x27, 0x39, 0xff, 0x20, 0x25, 0x32, 0xff, 0x1d, 0x20, 0x2f, 0xff, 0x10, 0x12, 0x1a, 0xff, 0x11, 0x11, 0x13, 0xff, 0x15, 0x16, 0x20, 0xff, 0x22, 0x2b, 0x3b, 0xff, 0x36, 0x45, 0x5b, 0xff, 0x3b, 0x4a, 0x6d, 0xff, 0x56, 0x75, 0xa4, 0xff, 0x5e, 0x87, 0xc1, 0xff, 0x65, 0x89, 0xc6, 0xff, 0x62, 0x87, 0xc4, 0xff, 0x61, 0x88, 0xc5, 0xff, 0x63, 0x8a, 0xc7, 0xff, 0x65, 0x8c, 0xca, 0xff, 0x66, 0x8e, 0xce, 0xff, 0x69, 0x90, 0xce, 0xff, 0x70, 0x99, 0xdb, 0xff, 0x72, 0x9d, 0xe2, 0xff, 0x7b, 0xa2, 0xe0, 0xff, 0x85, 0xaa, 0xe6, 0xff, 0x91, 0xba, 0xf3, 0xff, 0x9f, 0xc9, 0xf5, 0xff, 0xa7, 0xc7, 0xf4, 0xff, 0x9b, 0xb8, 0xf1, 0xff, 0x8c, 0xb2, 0xe9, 0xff, 0x9e, 0xc2, 0xee, 0xff, 0xb2, 0xc6, 0xef, 0xff, 0xae, 0xc3, 0xf1, 0xff, 0xa4, 0xc2, 0xf3, 0xff, 0x9c, 0xc1, 0xf2, 0xff, 0x94, 0xb9, 0xef, 0xff, 0x89, 0xad, 0xe5, 0xff, 0x7d, 0xa7, 0xe0, 0xff, 0x7c, 0xa6, 0xe1, 0xff, 0x83, 0xa6, 0xe3, 0xff, 0x7a, 0xa0, 0xdf, 0xff, 0x78, 0xa2, 0xe5, 0xff, 0x7f, 0xa7, 0xe6, 0xff, 0x82, 0xa9, 0xe5, 0xff, 0x84, 0xad, 0xeb, 0xff, 0x87, 0xac, 0xed, 0xff, 0x8e, 0xb0, 0xef, 0xff, 0x9a, 0xc1, 0xf8, 0xff, 0x86, 0xac, 0xea, 0xff, 0x22, 0x2f, 0x4b, 0xff, 0x00, 0x00, 0x01, 0xff, 0x15, 0x15, 0x22, 0xff, 0x2e, 0x33, 0x42, 0xff, 0x3b, 0x43, 0x52, 0xff, 0x22, 0x29, 0x38, 0xff, 0x1a, 0x22, 0x30, 0xff, 0x28, 0x2f, 0x3e, 0xff, 0x5a, 0x5c, 0x71, 0xff, 0xa9, 0xac, 0xb8, 0xff, 0xe2, 0xe5, 0xeb, 0xff, 0xda, 0xd8, 0xe1, 0xff, 0xf1, 0xee, 0xf1, 0xff, 0xfb, 0xf7, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xfb, 0xff, 0xff, 0x4c, 0x52, 0x67, 0xff, 0x00, 0x00, 0x0b, 0xff, 0x89, 0x89, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xcb, 0xd5, 0xff, 0x42, 0x4d, 0x60, 0xff, 0x19, 0x23, 0x35, 0xff, 0x0c, 0x10, 0x1e, 0xff, 0x05, 0x08, 0x16, 0xff, 0x1b, 0x20, 0x2c, 0xff, 0x4a, 0x53, 0x60, 0xff, 0x4a, 0x53, 0x68, 0xff, 0x48, 0x51, 0x6e, 0xff, 0x3f, 0x4c, 0x66, 0xff, 0x2c, 0x35, 0x4e, 0xff, 0x23, 0x28, 0x3b, 0xff, 0x24, 0x29, 0x35, 0xff, 0x20, 0x21, 0x2a, 0xff, 0x0d, 0x0c, 0x12, 0xff, 0x11, 0x13, 0x18, 0xff, 0x13, 0x1a, 0x25, 0xff, 0x2f, 0x35, 0x4a, 0xff, 0x3d, 0x48, 0x5f, 0xff, 0x3e, 0x4e, 0x6e, 0xff, 0x5e, 0x78, 0xb3, 0xff, 0x64, 0x8c, 0xce, 0xff, 0x6a, 0x8e, 0xd1, 0xff, 0x6a, 0x8e, 0xd0, 0xff, 0x6c, 0x91, 0xd1, 0xff, 0x6d, 0x92, 0xd1, 0xff, 0x6e, 0x95, 0xd5, 0xff, 0x70, 0x9a, 0xda, 0xff, 0x73, 0x9d, 0xdc, 0xff, 0x79, 0xa0, 0xe2, 0xff, 0x7d, 0x9f, 0xe8, 0xff, 0x7f, 0xa5, 0xe7, 0xff, 0x8c, 0xb3, 0xeb, 0xff, 0x99, 0xc3, 0xf7, 0xff, 0x9b, 0xc4, 0xf3, 0xff, 0xa1, 0xc2, 0xf0, 0xff, 0x9a, 0xba, 0xef, 0xff, 0x91, 0xb3, 0xea, 0xff, 0xa0, 0xbf, 0xee, 0xff, 0xac, 0xc5, 0xef, 0xff, 0xac, 0xc9, 0xf4, 0xff, 0xa8, 0xc6, 0xf6, 0xff, 0xa4, 0xc2, 0xf8, 0xff, 0x9a, 0xbe, 0xf3, 0xff, 0x8f, 0xb6, 0xeb, 0xff, 0x87, 0xaf, 0xe8, 0xff, 0x80, 0xaa, 0xe3, 0xff, 0x82, 0xa9, 0xe7, 0xff, 0x7e, 0xa6, 0xe5, 0xff, 0x7b, 0xa5, 0xe5, 0xff, 0x82, 0xaa, 0xeb, 0xff, 0x89, 0xae, 0xee, 0xff, 0x8b, 0xb1, 0xee, 0xff, 0x90, 0xb3, 0xf4, 0xff, 0x95, 0xb7, 0xf7, 0xff, 0x99, 0xc2, 0xf6, 0xff, 0x8b, 0xb4, 0xef, 0xff, 0x26, 0x34, 0x56, 0xff, 0x00, 0x00, 0x02, 0xff, 0x0e, 0x10, 0x15, 0xff, 0x1e, 0x25, 0x32, 0xff, 0x2a, 0x32, 0x43, 0xff, 0x2a, 0x31, 0x41, 0xff, 0x1a, 0x21, 0x30, 0xff, 0x1c, 0x22, 0x31, 0xff, 0x4e, 0x52, 0x67, 0xff, 0x91, 0x92, 0xa2, 0xff, 0xe5, 0xe5, 0xed, 0xff, 0xe8, 0xe8, 0xee, 0xff, 0xf0, 0xef, 0xf3, 0xff, 0xf4, 0xf3, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xcf, 0xdf, 0xff, 0x06, 0x0a, 0x29, 0xff, 0x27, 0x26, 0x35, 0xff, 0xf9, 0xfa, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x9e, 0xa5, 0xff, 0x1f, 0x2b, 0x3c, 0xff, 0x14, 0x1c, 0x2d, 0xff, 0x11, 0x17, 0x26, 0xff, 0x07, 0x0f, 0x1e, 0xff, 0x2a, 0x31, 0x40, 0xff, 0x44, 0x4c, 0x5d, 0xff, 0x31, 0x3a, 0x50, 0xff, 0x50, 0x59, 0x73, 0xff, 0x43, 0x50, 0x6b, 0xff, 0x27, 0x31, 0x48, 0xff, 0x19, 0x1f, 0x32, 0xff, 0x26, 0x2b, 0x39, 0xff, 0x1d, 0x1e, 0x21, 0xff, 0x06, 0x03, 0x05, 0xff, 0x08, 0x0d, 0x15, 0xff, 0x11, 0x1b, 0x26, 0xff, 0x3c, 0x3d, 0x57, 0xff, 0x46, 0x4d, 0x66, 0xff, 0x41, 0x53, 0x72, 0xff, 0x67, 0x83, 0xcb, 0xff, 0x66, 0x90, 0xd9, 0xff, 0x6a, 0x92, 0xd9, 0xff, 0x72, 0x98, 0xde, 0xff, 0x74, 0x9d, 0xde, 0xff, 0x76, 0xa0, 0xde, 0xff, 0x78, 0xa1, 0xe1, 0xff, 0x7a, 0xa2, 0xe3, 0xff, 0x7a, 0xa1, 0xe4, 0xff, 0x7c, 0xa4, 0xe3, 0xff, 0x7c, 0xa7, 0xe3, 0xff, 0x83, 0xb0, 0xee, 0xff, 0x9d, 0xc5, 0xf6, 0xff, 0xa7, 0xc8, 0xf6, 0xff, 0x9c, 0xbe, 0xf4, 0xff, 0x95, 0xba, 0xf8, 0xff, 0x8c, 0xb4, 0xf3, 0xff, 0x8d, 0xae, 0xeb, 0xff, 0x99, 0xb3, 0xed, 0xff, 0x93, 0xb9, 0xec, 0xff, 0x9e, 0xc5, 0xf2, 0xff, 0xab, 0xc9, 0xf7, 0xff, 0xa6, 0xc7, 0xf2, 0xff, 0x97, 0xc1, 0xed, 0xff, 0x8d, 0xb4, 0xee, 0xff, 0x8c, 0xaf, 0xed, 0xff, 0x8a, 0xaf, 0xe9, 0xff, 0x83, 0xac, 0xe9, 0xff, 0x84, 0xac, 0xea, 0xff, 0x86, 0xae, 0xeb, 0xff, 0x8a, 0xb0, 0xf0, 0xff, 0x90, 0xb4, 0xf3, 0xff, 0x96, 0xb8, 0xf3, 0xff, 0x9c, 0xbc, 0xf8, 0xff, 0x9a, 0xbe, 0xf8, 0xff, 0x9b, 0xc4, 0xf5, 0xff, 0x8c, 0xb8, 0xec, 0xff, 0x23, 0x33, 0x57, 0xff, 0x00, 0x00, 0x00, 0xff, 0x03, 0x05, 0x03, 0xff, 0x09, 0x12, 0x1c, 0xff, 0x1a, 0x21, 0x34, 0xff, 0x23, 0x2a, 0x3b, 0xff, 0x1e, 0x24, 0x34, 0xff, 0x17, 0x1b, 0x2a, 0xff, 0x3e, 0x46, 0x5b, 0xff, 0x8c, 0x8c, 0xa2, 0xff, 0xd5, 0xd4, 0xdc, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xf4, 0xf6, 0xfa, 0xff, 0xf3, 0xf4, 0xf9, 0xff, 0xfd, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0x01,
+    0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0xac, 0xbe, 0xff, 0x00, 0x00, 0x0a, 0xff, 0x84, 0x89, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf8, 0xfc, 0xff, 0x4f, 0x5b, 0x71, 0xff, 0x0f, 0x1b, 0x33, 0xff, 0x2d, 0x33, 0x44, 0xff, 0x12, 0x19, 0x28, 0xff, 0x18, 0x20, 0x2f, 0xff, 0x25, 0x2c, 0x3c, 0xff, 0x23, 0x2b, 0x3b, 0xff, 0x2c, 0x35, 0x4a, 0xff, 0x4b, 0x55, 0x70, 0xff, 0x44, 0x51, 0x6c, 0xff, 0x27, 0x32, 0x49, 0xff, 0x1a, 0x1f, 0x33, 0xff, 0x27, 0x2c, 0x3a, 0xff, 0x10, 0x11, 0x16, 0xff, 0x06, 0x04, 0x06, 0xff, 0x0a, 0x0e, 0x14, 0xff, 0x1b, 0x21, 0x27, 0xff, 0x42, 0x43, 0x5b, 0xff, 0x46, 0x51, 0x6c, 0xff, 0x49, 0x61, 0x86, 0xff, 0x68, 0x89, 0xd6, 0xff, 0x60, 0x8b, 0xd4, 0xff, 0x78, 0x9c, 0xe3, 0xff, 0x7f, 0xa5, 0xeb, 0xff, 0x7e, 0xa6, 0xe7, 0xff, 0x7f, 0xa9, 0xe7, 0xff, 0x7b, 0xa4, 0xe4, 0xff, 0x79, 0xa2, 0xe4, 0xff, 0x7c, 0xa3, 0xe5, 0xff, 0x7c, 0xa6, 0xe4, 0xff, 0x7e, 0xae, 0xea, 0xff, 0x87, 0xb3, 0xf0, 0xff, 0xa1, 0xc3, 0xf5, 0xff, 0xaf, 0xca, 0xf8, 0xff, 0x9d, 0xbd, 0xf5, 0xff, 0x8a, 0xb0, 0xf6, 0xff, 0x7f, 0xa9, 0xf1, 0xff, 0x84, 0xab, 0xec, 0xff, 0x8f, 0xaf, 0xed, 0xff, 0x88, 0xb1, 0xe9, 0xff, 0x91, 0xb7, 0xed, 0xff, 0xa4, 0xc3, 0xf4, 0xff, 0xa3, 0xc8, 0xef, 0xff, 0x93, 0xbe, 0xed, 0xff, 0x8c, 0xaf, 0xf1, 0xff, 0x88, 0xaa, 0xee, 0xff, 0x85, 0xa8, 0xe8, 0xff, 0x85, 0xa9, 0xe6, 0xff, 0x88, 0xac, 0xeb, 0xff, 0x8e, 0xb3, 0xf2, 0xff, 0x8f, 0xb3, 0xf2, 0xff, 0x93, 0xb6, 0xf2, 0xff, 0x9b, 0xbc, 0xf5, 0xff, 0xa4, 0xc1, 0xf9, 0xff, 0xa5, 0xc2, 0xf6, 0xff, 0xa1, 0xc8, 0xf7, 0xff, 0x88, 0xb5, 0xec, 0xff, 0x24, 0x38, 0x5d, 0xff, 0x00, 0x00, 0x02, 0xff, 0x04, 0x01, 0x01, 0xff, 0x00, 0x05, 0x11, 0xff, 0x0e, 0x16, 0x29, 0xff, 0x18, 0x1f, 0x31, 0xff, 0x16, 0x1d, 0x2d, 0xff, 0x17, 0x1e, 0x30, 0xff, 0x35, 0x3e, 0x56, 0xff, 0x74, 0x77, 0x8f, 0xff, 0xcc, 0xcb, 0xd4, 0xff, 0xe2, 0xe3, 0xe4, 0xff, 0xf7, 0xf8, 0xfc, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf9, 0xf7, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21,
+    0xff, 0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x9d, 0xb0, 0xff, 0x05, 0x0c, 0x1e, 0xff, 0xc5, 0xcc, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xe1, 0xea, 0xff, 0x2f, 0x41, 0x60, 0xff, 0x27, 0x33, 0x50, 0xff, 0x2e, 0x34, 0x43, 0xff, 0x18, 0x1f, 0x2d, 0xff, 0x18, 0x1e, 0x2d, 0xff, 0x11, 0x18, 0x26, 0xff, 0x1e, 0x26, 0x36, 0xff, 0x2c, 0x35, 0x4a, 0xff, 0x43, 0x4d, 0x67, 0xff, 0x3e, 0x4b, 0x66, 0xff, 0x2a, 0x34, 0x4b, 0xff, 0x21, 0x26, 0x38, 0xff, 0x24, 0x29, 0x36, 0xff, 0x0d, 0x0e, 0x12, 0xff, 0x08, 0x06, 0x09, 0xff, 0x0f, 0x13, 0x19, 0xff, 0x29, 0x2d, 0x31, 0xff, 0x47, 0x47, 0x5d, 0xff, 0x40, 0x4d, 0x6b, 0xff, 0x51, 0x6c, 0x99, 0xff, 0x64, 0x89, 0xd8, 0xff, 0x73, 0x9d, 0xe6, 0xff, 0x88, 0xac, 0xf0, 0xff, 0x85, 0xab, 0xf1, 0xff, 0x83, 0xaa, 0xec, 0xff, 0x80, 0xa9, 0xe8, 0xff, 0x7d, 0xa5, 0xe5, 0xff, 0x7e, 0xa5, 0xe6, 0xff, 0x7d, 0xa5, 0xe6, 0xff, 0x82, 0xa7, 0xea, 0xff, 0x7d, 0xa0, 0xe9, 0xff, 0x6a, 0x94, 0xdb, 0xff, 0x84, 0xad, 0xea, 0xff, 0x96, 0xbd, 0xf1, 0xff, 0xa1, 0xc5, 0xf7, 0xff, 0x9f, 0xc0, 0xf3, 0xff, 0x8a, 0xaf, 0xe9, 0xff, 0x85, 0xa9, 0xea, 0xff, 0x95, 0xb3, 0xeb, 0xff, 0x96, 0xba, 0xec, 0xff, 0x97, 0xbd, 0xf1, 0xff, 0x99, 0xb8, 0xf3, 0xff, 0x94, 0xb7, 0xf6, 0xff, 0x85, 0xac, 0xea, 0xff, 0x7b, 0x9e, 0xe2, 0xff, 0x81, 0xa3, 0xed, 0xff, 0x84, 0xa7, 0xeb, 0xff, 0x87, 0xaa, 0xe9, 0xff, 0x8a, 0xad, 0xeb, 0xff, 0x8f, 0xb1, 0xf0, 0xff, 0x92, 0xb3, 0xef, 0xff, 0x96, 0xb7, 0xf0, 0xff, 0x9e, 0xbc, 0xf5, 0xff, 0xa9, 0xc3, 0xfa, 0xff, 0xae, 0xc7, 0xf7, 0xff, 0xa3, 0xca, 0xf8, 0xff, 0x8b, 0xb9, 0xf2, 0xff, 0x32, 0x49, 0x6c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0a, 0x04, 0x06, 0xff, 0x06, 0x07, 0x14, 0xff, 0x08, 0x10, 0x22, 0xff, 0x10, 0x16, 0x27, 0xff, 0x15, 0x1c, 0x2c, 0xff, 0x17, 0x20, 0x33, 0xff, 0x2a, 0x34, 0x4e, 0xff, 0x61, 0x65, 0x7f, 0xff, 0xc3, 0xc3, 0xce, 0xff, 0xe4, 0xe5, 0xe7, 0xff, 0xf1, 0xf2, 0xf7, 0xff, 0xed, 0xed, 0xf1, 0xff, 0xf5, 0xf4, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4b,
+    0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xa2, 0xb1, 0xff, 0x20, 0x28, 0x3c, 0xff, 0xe4, 0xe2, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xd7, 0xe0, 0xff, 0x2c, 0x3e, 0x5c, 0xff, 0x2e, 0x3b, 0x52, 0xff, 0x22, 0x27, 0x34, 0xff, 0x23, 0x22, 0x2f, 0xff, 0x0c, 0x0c, 0x14, 0xff, 0x13, 0x1a, 0x25, 0xff, 0x29, 0x30, 0x44, 0xff, 0x2d, 0x36, 0x4c, 0xff, 0x4a, 0x55, 0x6d, 0xff, 0x41, 0x4c, 0x66, 0xff, 0x28, 0x2b, 0x40, 0xff, 0x23, 0x25, 0x30, 0xff, 0x1f, 0x24, 0x2b, 0xff, 0x08, 0x0b, 0x0e, 0xff, 0x03, 0x08, 0x0a, 0xff, 0x0d, 0x13, 0x1e, 0xff, 0x32, 0x38, 0x43, 0xff, 0x41, 0x47, 0x5b, 0xff, 0x3d, 0x4d, 0x75, 0xff, 0x55, 0x6e, 0xad, 0xff, 0x6f, 0x93, 0xd9, 0xff, 0x8b, 0xb2, 0xf1, 0xff, 0x93, 0xb5, 0xf1, 0xff, 0x8b, 0xb1, 0xf5, 0xff, 0x88, 0xac, 0xf1, 0xff, 0x87, 0xa8, 0xef, 0xff, 0x88, 0xa9, 0xeb, 0xff, 0x84, 0xa5, 0xe7, 0xff, 0x81, 0xa7, 0xee, 0xff, 0x75, 0x9a, 0xe7, 0xff, 0x58, 0x7c, 0xcb, 0xff, 0x6d, 0x91, 0xd6, 0xff, 0x95, 0xba, 0xf8, 0xff, 0x98, 0xbb, 0xf4, 0xff, 0xbd, 0xd3, 0xfa, 0xff, 0xbe, 0xd7, 0xfb, 0xff, 0x8b, 0xb3, 0xea, 0xff, 0x7a, 0xa6, 0xe8, 0xff, 0x86, 0xaa, 0xe6, 0xff, 0xa2, 0xbc, 0xee, 0xff, 0xae, 0xcf, 0xfe, 0xff, 0xa0, 0xc5, 0xfb, 0xff, 0x8f, 0xb6, 0xf5, 0xff, 0x87, 0xaf, 0xed, 0xff, 0x69, 0x93, 0xd7, 0xff, 0x61, 0x8b, 0xd8, 0xff, 0x7e, 0xa0, 0xec, 0xff, 0x83, 0xa4, 0xec, 0xff, 0x84, 0xad, 0xe3, 0xff, 0x91, 0xb0, 0xe9, 0xff, 0x96, 0xb7, 0xf1, 0xff, 0x96, 0xb9, 0xef, 0xff, 0xa0, 0xbd, 0xf4, 0xff, 0xaf, 0xc5, 0xfd, 0xff, 0xb0, 0xc9, 0xf9, 0xff, 0xa9, 0xca, 0xff, 0xff, 0x7f, 0xa4, 0xda, 0xff, 0x15, 0x2e, 0x45, 0xff, 0x00, 0x00, 0x01, 0xff, 0x02, 0x04, 0x0d, 0xff, 0x08, 0x07, 0x12, 0xff, 0x12, 0x12, 0x20, 0xff, 0x0d, 0x12, 0x22, 0xff, 0x15, 0x1f, 0x30, 0xff, 0x15, 0x1f, 0x33, 0xff, 0x33, 0x3b, 0x50, 0xff, 0x64, 0x67, 0x7e, 0xff, 0xa9, 0xae, 0xbe, 0xff, 0xd0, 0xd6, 0xde, 0xff, 0xf2, 0xf4, 0xf8, 0xff, 0xf6, 0xf4, 0xf5, 0xff, 0xf2, 0xf1, 0xf4, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6b,
+    0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0xbb, 0xcb, 0xff, 0x2c, 0x36, 0x4d, 0xff, 0xdc, 0xd9, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0xad, 0xc1, 0xff, 0x39, 0x48, 0x62, 0xff, 0x44, 0x4e, 0x61, 0xff, 0x03, 0x08, 0x15, 0xff, 0x17, 0x14, 0x21, 0xff, 0x10, 0x10, 0x17, 0xff, 0x1d, 0x25, 0x2f, 0xff, 0x24, 0x2b, 0x40, 0xff, 0x2d, 0x36, 0x4c, 0xff, 0x50, 0x5b, 0x73, 0xff, 0x40, 0x4b, 0x65, 0xff, 0x22, 0x25, 0x3a, 0xff, 0x25, 0x27, 0x32, 0xff, 0x13, 0x17, 0x1e, 0xff, 0x01, 0x04, 0x07, 0xff, 0x08, 0x0f, 0x10, 0xff, 0x12, 0x19, 0x24, 0xff, 0x36, 0x3d, 0x4b, 0xff, 0x43, 0x4c, 0x62, 0xff, 0x43, 0x56, 0x82, 0xff, 0x55, 0x70, 0xb4, 0xff, 0x82, 0xa2, 0xe4, 0xff, 0xa5, 0xc6, 0xfa, 0xff, 0xa1, 0xc0, 0xf5, 0xff, 0x94, 0xb6, 0xf5, 0xff, 0x8c, 0xae, 0xf1, 0xff, 0x86, 0xa8, 0xf0, 0xff, 0x83, 0xa4, 0xed, 0xff, 0x81, 0xa2, 0xeb, 0xff, 0x77, 0x99, 0xe2, 0xff, 0x4f, 0x73, 0xc0, 0xff, 0x3c, 0x5f, 0xab, 0xff, 0x76, 0x93, 0xce, 0xff, 0xbb, 0xd3, 0xff, 0xff, 0xc1, 0xd9, 0xff, 0xff, 0xae, 0xc5, 0xee, 0xff, 0x9f, 0xc0, 0xef, 0xff, 0x82, 0xaf, 0xee, 0xff, 0x6e, 0x9e, 0xe7, 0xff, 0x73, 0x9f, 0xe7, 0xff, 0x8c, 0xae, 0xee, 0xff, 0x8c, 0xac, 0xe6, 0xff, 0x98, 0xb7, 0xee, 0xff, 0xaf, 0xcb, 0xfb, 0xff, 0x9e, 0xbf, 0xf4, 0xff, 0x78, 0xa3, 0xe7, 0xff, 0x48, 0x71, 0xbb, 0xff, 0x54, 0x74, 0xbf, 0xff, 0x76, 0x96, 0xdf, 0xff, 0x7c, 0xa6, 0xe6, 0xff, 0x8c, 0xaf, 0xee, 0xff, 0x92, 0xb3, 0xf2, 0xff, 0x95, 0xb6, 0xf1, 0xff, 0xa0, 0xbd, 0xf6, 0xff, 0xb3, 0xc7, 0xfb, 0xff, 0xb6, 0xca, 0xf1, 0xff, 0xb4, 0xd0, 0xff, 0xff, 0x66, 0x85, 0xb9, 0xff, 0x09, 0x1f, 0x3a, 0xff, 0x04, 0x04, 0x0a, 0xff, 0x03, 0x06, 0x0f, 0xff, 0x04, 0x04, 0x0c, 0xff, 0x12, 0x11, 0x20, 0xff, 0x0b, 0x10, 0x20, 0xff, 0x0c, 0x16, 0x27, 0xff, 0x16, 0x20, 0x34, 0xff, 0x34, 0x3b, 0x4f, 0xff, 0x6a, 0x6d, 0x83, 0xff, 0xa3, 0xa8, 0xb8, 0xff, 0xc2, 0xc8, 0xd0, 0xff, 0xef, 0xf0, 0xf5, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xee, 0xed, 0xf2, 0xff, 0xfb, 0xfb, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b,
+    0xff, 0xff, 0xff, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xd5, 0xe7, 0xff, 0x35, 0x43, 0x5b, 0xff, 0xc6, 0xc1, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0x6f, 0x91, 0xff, 0x3a, 0x45, 0x5d, 0xff, 0x49, 0x4f, 0x5d, 0xff, 0x04, 0x08, 0x15, 0xff, 0x0c, 0x0a, 0x18, 0xff, 0x0c, 0x0c, 0x12, 0xff, 0x1e, 0x25, 0x2f, 0xff, 0x1b, 0x21, 0x35, 0xff, 0x33, 0x3b, 0x50, 0xff, 0x51, 0x5c, 0x74, 0xff, 0x41, 0x4d, 0x68, 0xff, 0x19, 0x1b, 0x32, 0xff, 0x24, 0x26, 0x31, 0xff, 0x0e, 0x13, 0x1a, 0xff, 0x06, 0x07, 0x0b, 0xff, 0x0b, 0x11, 0x12, 0xff, 0x1b, 0x21, 0x2b, 0xff, 0x3a, 0x42, 0x52, 0xff, 0x3e, 0x48, 0x62, 0xff, 0x40, 0x55, 0x83, 0xff, 0x54, 0x72, 0xba, 0xff, 0x96, 0xb0, 0xee, 0xff, 0xbb, 0xd2, 0xf9, 0xff, 0xae, 0xc8, 0xf8, 0xff, 0x9e, 0xba, 0xf2, 0xff, 0x8f, 0xaf, 0xed, 0xff, 0x80, 0xa3, 0xea, 0xff, 0x7a, 0x9e, 0xee, 0xff, 0x76, 0x9b, 0xe9, 0xff, 0x53, 0x73, 0xbe, 0xff, 0x40, 0x5c, 0xa4, 0xff, 0x54, 0x6e, 0xb1, 0xff, 0x72, 0x8f, 0xcd, 0xff, 0xa5, 0xc6, 0xfa, 0xff, 0x9f, 0xb6, 0xf0, 0xff, 0x50, 0x68, 0xad, 0xff, 0x66, 0x82, 0xc3, 0xff, 0x96, 0xb8, 0xf9, 0xff, 0x6d, 0x99, 0xe1, 0xff, 0x70, 0x9c, 0xe8, 0xff, 0x8c, 0xaf, 0xf7, 0xff, 0x4e, 0x67, 0xad, 0xff, 0x38, 0x55, 0x96, 0xff, 0x90, 0xb2, 0xef, 0xff, 0x9a, 0xbf, 0xf7, 0xff, 0x85, 0xab, 0xec, 0xff, 0x64, 0x8a, 0xd2, 0xff, 0x3a, 0x57, 0x9c, 0xff, 0x4f, 0x6f, 0xb7, 0xff, 0x6e, 0x97, 0xe7, 0xff, 0x7b, 0xa4, 0xed, 0xff, 0x8b, 0xac, 0xf0, 0xff, 0x98, 0xb3, 0xf5, 0xff, 0xa3, 0xbf, 0xf9, 0xff, 0xae, 0xc5, 0xf6, 0xff, 0xb2, 0xca, 0xf0, 0xff, 0xa6, 0xc6, 0xfe, 0xff, 0x72, 0x95, 0xd3, 0xff, 0x41, 0x55, 0x7b, 0xff, 0x0b, 0x08, 0x14, 0xff, 0x05, 0x08, 0x0f, 0xff, 0x05, 0x04, 0x0b, 0xff, 0x10, 0x0f, 0x1f, 0xff, 0x10, 0x15, 0x24, 0xff, 0x08, 0x12, 0x23, 0xff, 0x0f, 0x19, 0x2c, 0xff, 0x2e, 0x33, 0x47, 0xff, 0x64, 0x67, 0x7e, 0xff, 0x8d, 0x92, 0xa1, 0xff, 0xba, 0xc0, 0xc7, 0xff, 0xe9, 0xe9, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xed, 0xf3, 0xff, 0xf9, 0xf8, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab,
+    0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xf4, 0xfd, 0xff, 0x4e, 0x59, 0x77, 0xff, 0xa7, 0xb0, 0xb2, 0xff, 0xe8, 0xef, 0xfe, 0xff, 0x46, 0x5c, 0x81, 0xff, 0x28, 0x39, 0x4d, 0xff, 0x29, 0x2c, 0x3e, 0xff, 0x1a, 0x22, 0x2f, 0xff, 0x0b, 0x0e, 0x18, 0xff, 0x0a, 0x0d, 0x18, 0xff, 0x24, 0x2d, 0x3a, 0xff, 0x20, 0x2a, 0x3d, 0xff, 0x3a, 0x44, 0x5b, 0xff, 0x50, 0x59, 0x76, 0xff, 0x48, 0x52, 0x6a, 0xff, 0x16, 0x1b, 0x2c, 0xff, 0x21, 0x23, 0x2c, 0xff, 0x07, 0x09, 0x10, 0xff, 0x07, 0x09, 0x0e, 0xff, 0x12, 0x16, 0x1b, 0xff, 0x1e, 0x23, 0x33, 0xff, 0x3e, 0x47, 0x58, 0xff, 0x3a, 0x47, 0x5d, 0xff, 0x3e, 0x53, 0x82, 0xff, 0x57, 0x78, 0xbf, 0xff, 0x95, 0xb6, 0xf0, 0xff, 0xb9, 0xd1, 0xf7, 0xff, 0xb0, 0xc6, 0xf2, 0xff, 0x9d, 0xbc, 0xf2, 0xff, 0x86, 0xab, 0xee, 0xff, 0x7d, 0xa1, 0xee, 0xff, 0x75, 0x99, 0xe7, 0xff, 0x5d, 0x79, 0xc5, 0xff, 0x43, 0x5d, 0xa8, 0xff, 0x52, 0x72, 0xb8, 0xff, 0x68, 0x8b, 0xc9, 0xff, 0x70, 0x96, 0xd3, 0xff, 0x78, 0xa0, 0xe2, 0xff, 0x7d, 0x9f, 0xe8, 0xff, 0x77, 0x96, 0xde, 0xff, 0x88, 0xa3, 0xe6, 0xff, 0x99, 0xb9, 0xf2, 0xff, 0x7f, 0xa6, 0xe5, 0xff, 0x72, 0x97, 0xde, 0xff, 0x85, 0xa9, 0xe6, 0xff, 0x83, 0xa1, 0xe2, 0xff, 0x6b, 0x8f, 0xd4, 0xff, 0x78, 0xa0, 0xe2, 0xff, 0x90, 0xb7, 0xee, 0xff, 0x8a, 0xb1, 0xec, 0xff, 0x7d, 0xa5, 0xec, 0xff, 0x57, 0x7a, 0xbf, 0xff, 0x2d, 0x48, 0x8a, 0xff, 0x4f, 0x6c, 0xbb, 0xff, 0x73, 0x9a, 0xec, 0xff, 0x7d, 0xa7, 0xf2, 0xff, 0x8e, 0xb1, 0xf4, 0xff, 0xa4, 0xbf, 0xf6, 0xff, 0xb0, 0xc6, 0xf8, 0xff, 0xad, 0xcc, 0xf7, 0xff, 0x9f, 0xc1, 0xf6, 0xff, 0x6c, 0x89, 0xc3, 0xff, 0x32, 0x45, 0x66, 0xff, 0x0c, 0x11, 0x19, 0xff, 0x0d, 0x0f, 0x18, 0xff, 0x04, 0x06, 0x0d, 0xff, 0x0d, 0x0d, 0x18, 0xff, 0x11, 0x16, 0x25, 0xff, 0x0c, 0x15, 0x26, 0xff, 0x0f, 0x19, 0x2b, 0xff, 0x1e, 0x28, 0x40, 0xff, 0x61, 0x66, 0x7d, 0xff, 0x8a, 0x8e, 0x9f, 0xff, 0xb7, 0xbc, 0xc9, 0xff, 0xdc, 0xdd, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xf0, 0xf1, 0xff, 0xf3, 0xf3, 0xf4, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe,
+    0xff, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x99, 0xb2, 0xff, 0x58, 0x6d, 0x76, 0xff, 0xab, 0xb2, 0xc8, 0xff, 0x82, 0x94, 0xae, 0xff, 0x26, 0x3b, 0x50, 0xff, 0x19, 0x1b, 0x33, 0xff, 0x13, 0x20, 0x2b, 0xff, 0x0d, 0x13, 0x1c, 0xff, 0x13, 0x16, 0x25, 0xff, 0x23, 0x2e, 0x3f, 0xff, 0x2e, 0x3b, 0x4f, 0xff, 0x3e, 0x49, 0x60, 0xff, 0x47, 0x50, 0x6c, 0xff, 0x46, 0x4d, 0x63, 0xff, 0x19, 0x20, 0x2e, 0xff, 0x18, 0x1b, 0x21, 0xff, 0x04, 0x06, 0x0a, 0xff, 0x11, 0x14, 0x1a, 0xff, 0x13, 0x17, 0x1f, 0xff, 0x23, 0x26, 0x3c, 0xff, 0x44, 0x4b, 0x5e, 0xff, 0x34, 0x40, 0x53, 0xff, 0x41, 0x54, 0x83, 0xff, 0x5c, 0x7d, 0xc2, 0xff, 0x84, 0xab, 0xe8, 0xff, 0xaa, 0xc8, 0xf9, 0xff, 0xa8, 0xbf, 0xf2, 0xff, 0x91, 0xb5, 0xef, 0xff, 0x7d, 0xa5, 0xef, 0xff, 0x78, 0x9b, 0xe9, 0xff, 0x56, 0x78, 0xc3, 0xff, 0x3e, 0x59, 0xa5, 0xff, 0x56, 0x73, 0xbb, 0xff, 0x69, 0x8f, 0xd9, 0xff, 0x74, 0x9b, 0xe6, 0xff, 0x78, 0xa0, 0xe1, 0xff, 0x76, 0x9b, 0xe1, 0xff, 0x78, 0xa6, 0xe4, 0xff, 0x72, 0xa2, 0xdb, 0xff, 0x65, 0x90, 0xcd, 0xff, 0x61, 0x8a, 0xc5, 0xff, 0x5e, 0x81, 0xc4, 0xff, 0x5f, 0x81, 0xc7, 0xff, 0x6f, 0x94, 0xd2, 0xff, 0x7d, 0xa3, 0xe1, 0xff, 0x87, 0xb3, 0xf2, 0xff, 0x8c, 0xb6, 0xec, 0xff, 0x91, 0xb8, 0xe2, 0xff, 0x91, 0xb9, 0xe7, 0xff, 0x8d, 0xb3, 0xf3, 0xff, 0x80, 0xa5, 0xea, 0xff, 0x4d, 0x67, 0xa5, 0xff, 0x24, 0x39, 0x7f, 0xff, 0x59, 0x79, 0xca, 0xff, 0x6e, 0x9b, 0xea, 0xff, 0x86, 0xb1, 0xf5, 0xff, 0x9c, 0xbc, 0xf1, 0xff, 0xa7, 0xc0, 0xf4, 0xff, 0xab, 0xcb, 0xf9, 0xff, 0x99, 0xba, 0xeb, 0xff, 0x51, 0x67, 0x9e, 0xff, 0x33, 0x42, 0x63, 0xff, 0x11, 0x1e, 0x25, 0xff, 0x0f, 0x11, 0x1e, 0xff, 0x07, 0x09, 0x12, 0xff, 0x09, 0x0a, 0x11, 0xff, 0x10, 0x15, 0x23, 0xff, 0x0d, 0x15, 0x27, 0xff, 0x17, 0x21, 0x33, 0xff, 0x15, 0x23, 0x3d, 0xff, 0x57, 0x5f, 0x75, 0xff, 0x8b, 0x8e, 0xa1, 0xff, 0xaa, 0xad, 0xbf, 0xff, 0xd3, 0xd4, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xef, 0xed, 0xff, 0xee, 0xee, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3,
+    0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xe3, 0xee, 0xff, 0x23, 0x35, 0x5c, 0xff, 0x7a, 0x80, 0x8e, 0xff, 0xbd, 0xcb, 0xd6, 0xff, 0x31, 0x3e, 0x5a, 0xff, 0x1c, 0x1f, 0x35, 0xff, 0x11, 0x1f, 0x2a, 0xff, 0x19, 0x1c, 0x2a, 0xff, 0x1d, 0x1f, 0x30, 0xff, 0x2d, 0x36, 0x49, 0xff, 0x3e, 0x46, 0x5b, 0xff, 0x29, 0x32, 0x46, 0xff, 0x3d, 0x46, 0x58, 0xff, 0x3a, 0x44, 0x58, 0xff, 0x19, 0x20, 0x31, 0xff, 0x0a, 0x0e, 0x13, 0xff, 0x05, 0x07, 0x0c, 0xff, 0x0f, 0x12, 0x17, 0xff, 0x12, 0x16, 0x1d, 0xff, 0x30, 0x33, 0x46, 0xff, 0x47, 0x4f, 0x60, 0xff, 0x2f, 0x3c, 0x4f, 0xff, 0x40, 0x53, 0x83, 0xff, 0x5c, 0x7e, 0xc1, 0xff, 0x70, 0x94, 0xdc, 0xff, 0x99, 0xb7, 0xfa, 0xff, 0x9d, 0xbc, 0xf8, 0xff, 0x84, 0xa8, 0xec, 0xff, 0x75, 0x9d, 0xe6, 0xff, 0x5d, 0x80, 0xc3, 0xff, 0x3f, 0x5a, 0xa3, 0xff, 0x4c, 0x6d, 0xb6, 0xff, 0x74, 0x9c, 0xdc, 0xff, 0x93, 0xb5, 0xee, 0xff, 0x9c, 0xbe, 0xed, 0xff, 0x99, 0xbf, 0xf2, 0xff, 0x8a, 0xb0, 0xef, 0xff, 0x78, 0x9d, 0xed, 0xff, 0x62, 0x85, 0xda, 0xff, 0x53, 0x72, 0xcb, 0xff, 0x50, 0x67, 0xc5, 0xff, 0x58, 0x6b, 0xc4, 0xff, 0x64, 0x7a, 0xd2, 0xff, 0x6d, 0x81, 0xde, 0xff, 0x70, 0x86, 0xe0, 0xff, 0x6f, 0x8f, 0xe5, 0xff, 0x85, 0xa8, 0xef, 0xff, 0x9f, 0xbb, 0xf6, 0xff, 0xa8, 0xc6, 0xf2, 0xff, 0xa4, 0xc7, 0xf1, 0xff, 0x9a, 0xbc, 0xf4, 0xff, 0x83, 0xa7, 0xe4, 0xff, 0x3f, 0x56, 0x98, 0xff, 0x2e, 0x42, 0x88, 0xff, 0x61, 0x87, 0xd6, 0xff, 0x7c, 0xa6, 0xf0, 0xff, 0x94, 0xb9, 0xf0, 0xff, 0x9b, 0xbd, 0xf0, 0xff, 0xa4, 0xc7, 0xf5, 0xff, 0x95, 0xb8, 0xf0, 0xff, 0x58, 0x6f, 0xb5, 0xff, 0x43, 0x4d, 0x80, 0xff, 0x2c, 0x33, 0x46, 0xff, 0x15, 0x16, 0x26, 0xff, 0x06, 0x09, 0x11, 0xff, 0x08, 0x09, 0x11, 0xff, 0x11, 0x17, 0x24, 0xff, 0x0b, 0x14, 0x26, 0xff, 0x17, 0x21, 0x33, 0xff, 0x19, 0x26, 0x3e, 0xff, 0x4f, 0x57, 0x6b, 0xff, 0x8e, 0x91, 0xa3, 0xff, 0xa1, 0xa4, 0xb5, 0xff, 0xc6, 0xc7, 0xd3, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xf6, 0xf6, 0xf5, 0xff, 0xf0, 0xf0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfe, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x51, 0x63, 0x91, 0xff, 0x69, 0x72, 0x82, 0xff, 0xc2, 0xcd, 0xd0, 0xff, 0x30, 0x3b, 0x57, 0xff, 0x22, 0x29, 0x3f, 0xff, 0x16, 0x22, 0x2f, 0xff, 0x26, 0x29, 0x3a, 0xff, 0x21, 0x24, 0x38, 0xff, 0x32, 0x38, 0x51, 0xff, 0x3b, 0x40, 0x58, 0xff, 0x15, 0x1b, 0x2b, 0xff, 0x39, 0x41, 0x4f, 0xff, 0x33, 0x3b, 0x4d, 0xff, 0x15, 0x1a, 0x29, 0xff, 0x05, 0x07, 0x0f, 0xff, 0x0d, 0x0d, 0x14, 0xff, 0x05, 0x08, 0x0e, 0xff, 0x17, 0x1c, 0x24, 0xff, 0x41, 0x45, 0x59, 0xff, 0x4c, 0x55, 0x68, 0xff, 0x26, 0x31, 0x46, 0xff, 0x39, 0x4c, 0x7a, 0xff, 0x60, 0x83, 0xc4, 0xff, 0x65, 0x8b, 0xd7, 0xff, 0x81, 0xa5, 0xf0, 0xff, 0x87, 0xad, 0xef, 0xff, 0x79, 0x9e, 0xe8, 0xff, 0x5e, 0x85, 0xcf, 0xff, 0x46, 0x64, 0xa2, 0xff, 0x59, 0x71, 0xaf, 0xff, 0x81, 0xa5, 0xdd, 0xff, 0xa1, 0xc7, 0xf0, 0xff, 0xc0, 0xd8, 0xfc, 0xff, 0xbf, 0xd0, 0xfa, 0xff, 0x9e, 0xb1, 0xf5, 0xff, 0x72, 0x7f, 0xeb, 0xff, 0x69, 0x6e, 0xeb, 0xff, 0x5d, 0x5d, 0xdf, 0xff, 0x54, 0x4e, 0xdc, 0xff, 0x4e, 0x49, 0xd2, 0xff, 0x56, 0x56, 0xd0, 0xff, 0x63, 0x66, 0xd8, 0xff, 0x62, 0x60, 0xdc, 0xff, 0x5b, 0x5a, 0xdc, 0xff, 0x59, 0x62, 0xd9, 0xff, 0x73, 0x7d, 0xe5, 0xff, 0x8d, 0x91, 0xf2, 0xff, 0x99, 0xa6, 0xf3, 0xff, 0xaa, 0xc5, 0xf4, 0xff, 0xaa, 0xd1, 0xfe, 0xff, 0x9a, 0xc5, 0xfd, 0xff, 0x7d, 0x9a, 0xd6, 0xff, 0x32, 0x45, 0x82, 0xff, 0x3e, 0x5b, 0xa8, 0xff, 0x73, 0x9b, 0xe8, 0xff, 0x8c, 0xb6, 0xf1, 0xff, 0x9b, 0xbf, 0xf4, 0xff, 0xa4, 0xc5, 0xf7, 0xff, 0x91, 0xb3, 0xf5, 0xff, 0x7b, 0x91, 0xe0, 0xff, 0x4a, 0x56, 0x8d, 0xff, 0x12, 0x15, 0x2d, 0xff, 0x25, 0x27, 0x39, 0xff, 0x14, 0x16, 0x1e, 0xff, 0x01, 0x01, 0x09, 0xff, 0x11, 0x17, 0x25, 0xff, 0x0c, 0x14, 0x26, 0xff, 0x15, 0x20, 0x32, 0xff, 0x21, 0x2e, 0x48, 0xff, 0x40, 0x48, 0x5e, 0xff, 0x7a, 0x7e, 0x90, 0xff, 0xaa, 0xaf, 0xc0, 0xff, 0xc6, 0xc8, 0xd3, 0xff, 0xf2, 0xf4, 0xf9, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xf1, 0xf1, 0xf0, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xad, 0xbd, 0xff, 0x64, 0x73, 0x93, 0xff, 0xbc, 0xc2, 0xd1, 0xff, 0x3a, 0x47, 0x5e, 0xff, 0x20, 0x2e, 0x46, 0xff, 0x14, 0x1a, 0x2b, 0xff, 0x19, 0x1e, 0x2c, 0xff, 0x2a, 0x32, 0x46, 0xff, 0x3b, 0x42, 0x62, 0xff, 0x2f, 0x35, 0x4d, 0xff, 0x11, 0x13, 0x1e, 0xff, 0x3c, 0x3f, 0x53, 0xff, 0x2f, 0x32, 0x41, 0xff, 0x0b, 0x0d, 0x16, 0xff, 0x08, 0x06, 0x13, 0xff, 0x0e, 0x0c, 0x16, 0xff, 0x12, 0x14, 0x1c, 0xff, 0x2a, 0x2f, 0x3c, 0xff, 0x45, 0x4f, 0x63, 0xff, 0x47, 0x50, 0x6b, 0xff, 0x21, 0x26, 0x3f, 0xff, 0x33, 0x46, 0x6b, 0xff, 0x5e, 0x7e, 0xbd, 0xff, 0x65, 0x8e, 0xd5, 0xff, 0x73, 0xa1, 0xe4, 0xff, 0x7e, 0xa8, 0xec, 0xff, 0x71, 0x98, 0xe1, 0xff, 0x50, 0x72, 0xbc, 0xff, 0x44, 0x57, 0x98, 0xff, 0x6f, 0x8d, 0xcb, 0xff, 0xa1, 0xc1, 0xff, 0xff, 0xb1, 0xc3, 0xf8, 0xff, 0x9f, 0xa8, 0xe0, 0xff, 0x7d, 0x7f, 0xd6, 0xff, 0x7d, 0x83, 0xe1, 0xff, 0x6b, 0x6c, 0xe8, 0xff, 0x5c, 0x5e, 0xe3, 0xff, 0x58, 0x59, 0xe4, 0xff, 0x5b, 0x56, 0xf0, 0xff, 0x5a, 0x5b, 0xe8, 0xff, 0x50, 0x4e, 0xe9, 0xff, 0x57, 0x59, 0xdc, 0xff, 0x62, 0x64, 0xe3, 0xff, 0x66, 0x67, 0xe8, 0xff, 0x71, 0x75, 0xe3, 0xff, 0x7f, 0x81, 0xe6, 0xff, 0x7e, 0x7a, 0xe8, 0xff, 0x5e, 0x5f, 0xde, 0xff, 0x60, 0x64, 0xc5, 0xff, 0x7a, 0x90, 0xd5, 0xff, 0x8b, 0xa4, 0xdc, 0xff, 0x72, 0x98, 0xcc, 0xff, 0x42, 0x5e, 0x99, 0xff, 0x38, 0x4a, 0x94, 0xff, 0x73, 0x99, 0xe1, 0xff, 0x8b, 0xb4, 0xf5, 0xff, 0x9d, 0xc1, 0xf5, 0xff, 0xa9, 0xce, 0xfb, 0xff, 0x78, 0x99, 0xce, 0xff, 0x37, 0x44, 0x6a, 0xff, 0x1a, 0x21, 0x35, 0xff, 0x00, 0x03, 0x13, 0xff, 0x13, 0x16, 0x25, 0xff, 0x30, 0x35, 0x40, 0xff, 0x08, 0x0e, 0x1a, 0xff, 0x12, 0x18, 0x29, 0xff, 0x0e, 0x14, 0x25, 0xff, 0x15, 0x1d, 0x33, 0xff, 0x22, 0x2f, 0x4a, 0xff, 0x44, 0x4f, 0x67, 0xff, 0x6f, 0x77, 0x8b, 0xff, 0xaa, 0xb1, 0xc3, 0xff, 0xcf, 0xd3, 0xdd, 0xff, 0xee, 0xef, 0xf2, 0xff, 0xfd, 0xfc, 0xfc, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xce, 0xda, 0xff, 0x6e, 0x7f, 0x99, 0xff, 0x98, 0xa1, 0xba, 0xff, 0x45, 0x54, 0x70, 0xff, 0x2a, 0x36, 0x50, 0xff, 0x18, 0x1d, 0x2e, 0xff, 0x0e, 0x14, 0x20, 0xff, 0x2e, 0x36, 0x4a, 0xff, 0x44, 0x4b, 0x6a, 0xff, 0x28, 0x30, 0x45, 0xff, 0x0d, 0x10, 0x19, 0xff, 0x40, 0x44, 0x56, 0xff, 0x21, 0x25, 0x34, 0xff, 0x01, 0x03, 0x0d, 0xff, 0x0d, 0x0b, 0x18, 0xff, 0x0f, 0x0c, 0x17, 0xff, 0x1c, 0x1e, 0x26, 0xff, 0x2f, 0x34, 0x42, 0xff, 0x4b, 0x55, 0x69, 0xff, 0x45, 0x4b, 0x65, 0xff, 0x24, 0x26, 0x3d, 0xff, 0x31, 0x40, 0x64, 0xff, 0x52, 0x71, 0xb0, 0xff, 0x61, 0x8b, 0xd2, 0xff, 0x70, 0x9e, 0xe0, 0xff, 0x7a, 0xa4, 0xe6, 0xff, 0x6f, 0x98, 0xe0, 0xff, 0x51, 0x75, 0xbf, 0xff, 0x3f, 0x56, 0x97, 0xff, 0x60, 0x78, 0xb3, 0xff, 0x6b, 0x7c, 0xc7, 0xff, 0x40, 0x46, 0x90, 0xff, 0x2c, 0x2e, 0x7a, 0xff, 0x71, 0x6e, 0xda, 0xff, 0x9f, 0xae, 0xf4, 0xff, 0xae, 0xc9, 0xf8, 0xff, 0x94, 0xae, 0xf9, 0xff, 0x81, 0x98, 0xf5, 0xff, 0x81, 0x94, 0xf8, 0xff, 0x87, 0x9d, 0xf3, 0xff, 0x7b, 0x86, 0xf3, 0xff, 0x85, 0x94, 0xec, 0xff, 0x99, 0xa9, 0xf5, 0xff, 0x93, 0x9d, 0xf4, 0xff, 0x9a, 0xa7, 0xf1, 0xff, 0xa4, 0xb1, 0xf6, 0xff, 0x9c, 0xaf, 0xfe, 0xff, 0x76, 0x8e, 0xee, 0xff, 0x1f, 0x21, 0x70, 0xff, 0x1e, 0x17, 0x69, 0xff, 0x47, 0x40, 0x91, 0xff, 0x4e, 0x67, 0xa1, 0xff, 0x46, 0x64, 0xa1, 0xff, 0x45, 0x5e, 0xaa, 0xff, 0x75, 0xa1, 0xe7, 0xff, 0x90, 0xb9, 0xf3, 0xff, 0x9a, 0xc1, 0xf3, 0xff, 0xac, 0xd8, 0xff, 0xff, 0x5d, 0x7b, 0x9f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0c, 0x00, 0x00, 0xff, 0x19, 0x15, 0x19, 0xff, 0x00, 0x00, 0x08, 0xff, 0x21, 0x28, 0x35, 0xff, 0x1c, 0x25, 0x32, 0xff, 0x08, 0x0e, 0x1e, 0xff, 0x0e, 0x14, 0x24, 0xff, 0x17, 0x1f, 0x35, 0xff, 0x24, 0x32, 0x4d, 0xff, 0x41, 0x4c, 0x64, 0xff, 0x73, 0x7b, 0x8e, 0xff, 0xb4, 0xbb, 0xcd, 0xff, 0xcc, 0xd0, 0xda, 0xff, 0xec, 0xed, 0xf0, 0xff, 0xf9, 0xf9, 0xf8, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xd0, 0xdd, 0xe3, 0xff, 0x81, 0x92, 0xa7, 0xff, 0x7b, 0x89, 0xac, 0xff, 0x3a, 0x49, 0x6d, 0xff, 0x3c, 0x45, 0x61, 0xff, 0x2d, 0x30, 0x42, 0xff, 0x0f, 0x15, 0x21, 0xff, 0x36, 0x3e, 0x51, 0xff, 0x46, 0x4e, 0x6c, 0xff, 0x22, 0x2b, 0x3d, 0xff, 0x11, 0x15, 0x19, 0xff, 0x3a, 0x3e, 0x4c, 0xff, 0x10, 0x15, 0x24, 0xff, 0x00, 0x00, 0x0a, 0xff, 0x14, 0x12, 0x1e, 0xff, 0x19, 0x16, 0x21, 0xff, 0x14, 0x15, 0x1d, 0xff, 0x29, 0x2f, 0x3c, 0xff, 0x52, 0x5c, 0x6f, 0xff, 0x44, 0x49, 0x5f, 0xff, 0x22, 0x23, 0x36, 0xff, 0x27, 0x36, 0x57, 0xff, 0x4b, 0x6a, 0xa9, 0xff, 0x5e, 0x87, 0xcf, 0xff, 0x72, 0x9f, 0xe1, 0xff, 0x7c, 0xa6, 0xe9, 0xff, 0x6d, 0x99, 0xe1, 0xff, 0x5e, 0x85, 0xcf, 0xff, 0x47, 0x63, 0xa1, 0xff, 0x40, 0x4c, 0x88, 0xff, 0x2a, 0x28, 0x7c, 0xff, 0x14, 0x15, 0x56, 0xff, 0x03, 0x0c, 0x38, 0xff, 0x77, 0x7f, 0xcb, 0xff, 0xb8, 0xcd, 0xff, 0xff, 0xb5, 0xda, 0xf4, 0xff, 0xbc, 0xe1, 0xf9, 0xff, 0xb0, 0xcf, 0xf3, 0xff, 0xa7, 0xc3, 0xee, 0xff, 0xb2, 0xd7, 0xf0, 0xff, 0xa3, 0xbc, 0xf6, 0xff, 0xa3, 0xc0, 0xe8, 0xff, 0xbb, 0xdb, 0xef, 0xff, 0xb6, 0xc6, 0xf2, 0xff, 0xbc, 0xd1, 0xf4, 0xff, 0xb9, 0xd3, 0xf6, 0xff, 0xb1, 0xce, 0xff, 0xff, 0x76, 0x99, 0xd9, 0xff, 0x15, 0x1a, 0x4d, 0xff, 0x22, 0x17, 0x6e, 0xff, 0x4e, 0x4e, 0xb8, 0xff, 0x58, 0x80, 0xbb, 0xff, 0x3c, 0x64, 0xa0, 0xff, 0x5b, 0x7a, 0xcb, 0xff, 0x7f, 0xb3, 0xf8, 0xff, 0x92, 0xc1, 0xf3, 0xff, 0x9d, 0xc2, 0xf0, 0xff, 0xae, 0xcf, 0xff, 0xff, 0x41, 0x57, 0x7c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x14, 0x08, 0x03, 0xff, 0x0f, 0x0b, 0x10, 0xff, 0x06, 0x06, 0x10, 0xff, 0x09, 0x0e, 0x19, 0xff, 0x1f, 0x26, 0x33, 0xff, 0x10, 0x17, 0x26, 0xff, 0x10, 0x16, 0x26, 0xff, 0x1b, 0x23, 0x38, 0xff, 0x25, 0x33, 0x4e, 0xff, 0x35, 0x40, 0x57, 0xff, 0x6a, 0x71, 0x84, 0xff, 0xc8, 0xce, 0xe1, 0xff, 0xc5, 0xc9, 0xd3, 0xff, 0xe6, 0xe8, 0xea, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xde, 0xe4, 0xeb, 0xff, 0x96, 0xa4, 0xb9, 0xff, 0x7e, 0x8d, 0xb0, 0xff, 0x32, 0x45, 0x6d, 0xff, 0x4c, 0x57, 0x75, 0xff, 0x43, 0x4d, 0x5f, 0xff, 0x0f, 0x1b, 0x27, 0xff, 0x37, 0x41, 0x57, 0xff, 0x4a, 0x55, 0x6f, 0xff, 0x18, 0x21, 0x2f, 0xff, 0x0f, 0x17, 0x22, 0xff, 0x33, 0x3b, 0x49, 0xff, 0x09, 0x0d, 0x15, 0xff, 0x00, 0x00, 0x04, 0xff, 0x17, 0x1b, 0x26, 0xff, 0x1c, 0x1f, 0x29, 0xff, 0x0b, 0x0f, 0x18, 0xff, 0x2d, 0x34, 0x43, 0xff, 0x57, 0x5d, 0x73, 0xff, 0x45, 0x49, 0x60, 0xff, 0x21, 0x27, 0x38, 0xff, 0x28, 0x31, 0x4d, 0xff, 0x4b, 0x68, 0xa1, 0xff, 0x56, 0x7f, 0xc8, 0xff, 0x6d, 0x9a, 0xdf, 0xff, 0x7a, 0xa5, 0xe7, 0xff, 0x73, 0x9f, 0xe5, 0xff, 0x67, 0x93, 0xd9, 0xff, 0x52, 0x75, 0xb5, 0xff, 0x4b, 0x5c, 0x99, 0xff, 0x5a, 0x5c, 0xc4, 0xff, 0x3d, 0x3b, 0xa8, 0xff, 0x00, 0x02, 0x39, 0xff, 0x1d, 0x31, 0x50, 0xff, 0xb5, 0xcf, 0xf4, 0xff, 0xd6, 0xf9, 0xff, 0xff, 0xbb, 0xd8, 0xf8, 0xff, 0xb9, 0xd0, 0xf6, 0xff, 0xc0, 0xd8, 0xef, 0xff, 0xd0, 0xf0, 0xf8, 0xff, 0xb8, 0xd4, 0xf1, 0xff, 0xb5, 0xcd, 0xee, 0xff, 0xd1, 0xeb, 0xfc, 0xff, 0xc4, 0xd9, 0xec, 0xff, 0xbd, 0xd3, 0xf3, 0xff, 0xd1, 0xe9, 0xff, 0xff, 0xcc, 0xe6, 0xfc, 0xff, 0x51, 0x65, 0x8f, 0xff, 0x0d, 0x0a, 0x59, 0xff, 0x4e, 0x4c, 0xc7, 0xff, 0x80, 0xa1, 0xf1, 0xff, 0x5d, 0x87, 0xc4, 0xff, 0x3d, 0x66, 0xae, 0xff, 0x6e, 0x99, 0xe3, 0xff, 0x93, 0xbe, 0xfb, 0xff, 0x9f, 0xc1, 0xf5, 0xff, 0xa0, 0xc6, 0xf7, 0xff, 0x98, 0xc4, 0xf7, 0xff, 0x28, 0x37, 0x48, 0xff, 0x00, 0x00, 0x00, 0xff, 0x06, 0x03, 0x09, 0xff, 0x0e, 0x0c, 0x17, 0xff, 0x0d, 0x0d, 0x17, 0xff, 0x04, 0x05, 0x0e, 0xff, 0x1b, 0x21, 0x2e, 0xff, 0x21, 0x2c, 0x40, 0xff, 0x10, 0x1a, 0x2d, 0xff, 0x17, 0x21, 0x36, 0xff, 0x29, 0x35, 0x50, 0xff, 0x30, 0x3b, 0x59, 0xff, 0x60, 0x68, 0x86, 0xff, 0xc3, 0xc9, 0xd7, 0xff, 0xc0, 0xc3, 0xd2, 0xff, 0xda, 0xd9, 0xe3, 0xff, 0xf5, 0xf6, 0xf3, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfa, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe8, 0xeb, 0xf3, 0xff, 0x90, 0x9e, 0xb6, 0xff, 0x64, 0x74, 0x95, 0xff, 0x3c, 0x4d, 0x70, 0xff, 0x4c, 0x58, 0x74, 0xff, 0x57, 0x66, 0x7b, 0xff, 0x20, 0x2e, 0x3e, 0xff, 0x2a, 0x35, 0x4c, 0xff, 0x47, 0x54, 0x6b, 0xff, 0x17, 0x1f, 0x2c, 0xff, 0x0f, 0x1a, 0x29, 0xff, 0x25, 0x2e, 0x3c, 0xff, 0x02, 0x04, 0x0a, 0xff, 0x05, 0x06, 0x0d, 0xff, 0x1d, 0x24, 0x2e, 0xff, 0x0f, 0x16, 0x20, 0xff, 0x11, 0x17, 0x20, 0xff, 0x3c, 0x44, 0x53, 0xff, 0x4f, 0x52, 0x6a, 0xff, 0x37, 0x3e, 0x56, 0xff, 0x2b, 0x36, 0x44, 0xff, 0x27, 0x2b, 0x42, 0xff, 0x48, 0x63, 0x94, 0xff, 0x50, 0x75, 0xba, 0xff, 0x62, 0x8c, 0xd1, 0xff, 0x7d, 0xa5, 0xe6, 0xff, 0x80, 0xaa, 0xeb, 0xff, 0x72, 0xa1, 0xe3, 0xff, 0x5c, 0x82, 0xc8, 0xff, 0x4a, 0x6b, 0xa5, 0xff, 0x85, 0xa7, 0xe1, 0xff, 0x7e, 0x82, 0xff, 0xff, 0x41, 0x39, 0xb9, 0xff, 0x09, 0x11, 0x4b, 0xff, 0x2c, 0x36, 0x52, 0xff, 0x58, 0x5e, 0x7e, 0xff, 0x6e, 0x7d, 0xba, 0xff, 0x88, 0x9c, 0xe2, 0xff, 0x96, 0xb0, 0xf0, 0xff, 0x9e, 0xb8, 0xf4, 0xff, 0x8f, 0xa4, 0xe2, 0xff, 0x89, 0x9c, 0xd9, 0xff, 0xa1, 0xb5, 0xe7, 0xff, 0x94, 0xa9, 0xe6, 0xff, 0x74, 0x8b, 0xd9, 0xff, 0x6e, 0x8b, 0xbd, 0xff, 0x56, 0x71, 0x89, 0xff, 0x2f, 0x38, 0x6d, 0xff, 0x50, 0x41, 0xcc, 0xff, 0x93, 0xa2, 0xfd, 0xff, 0x99, 0xc6, 0xf5, 0xff, 0x58, 0x7c, 0xc1, 0xff, 0x51, 0x78, 0xc4, 0xff, 0x85, 0xb2, 0xf4, 0xff, 0x98, 0xbc, 0xf2, 0xff, 0xa0, 0xbe, 0xf2, 0xff, 0x9d, 0xc5, 0xff, 0xff, 0x71, 0x9b, 0xd0, 0xff, 0x0d, 0x0f, 0x19, 0xff, 0x03, 0x00, 0x00, 0xff, 0x04, 0x04, 0x0e, 0xff, 0x11, 0x0f, 0x17, 0xff, 0x0d, 0x0d, 0x19, 0xff, 0x06, 0x06, 0x0f, 0xff, 0x16, 0x1b, 0x28, 0xff, 0x23, 0x2f, 0x46, 0xff, 0x0b, 0x16, 0x2b, 0xff, 0x18, 0x22, 0x37, 0xff, 0x32, 0x3d, 0x56, 0xff, 0x26, 0x33, 0x54, 0xff, 0x51, 0x58, 0x7d, 0xff, 0xb7, 0xbe, 0xca, 0xff, 0xcd, 0xce, 0xe1, 0xff, 0xdd, 0xdb, 0xe9, 0xff, 0xfb, 0xfc, 0xfb, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfa, 0xf9, 0xff, 0xf6, 0xf2, 0xf1, 0xff, 0xee, 0xf1, 0xf9, 0xff, 0x98, 0xa9, 0xc2, 0xff, 0x3b, 0x51, 0x72, 0xff, 0x3c, 0x49, 0x61, 0xff, 0x52, 0x60, 0x7a, 0xff, 0x5d, 0x6c, 0x8b, 0xff, 0x2d, 0x36, 0x4d, 0xff, 0x37, 0x41, 0x58, 0xff, 0x43, 0x51, 0x67, 0xff, 0x20, 0x29, 0x36, 0xff, 0x18, 0x23, 0x30, 0xff, 0x15, 0x1e, 0x2d, 0xff, 0x00, 0x02, 0x07, 0xff, 0x15, 0x18, 0x1e, 0xff, 0x1e, 0x23, 0x2d, 0xff, 0x10, 0x16, 0x1f, 0xff, 0x20, 0x26, 0x2d, 0xff, 0x3f, 0x46, 0x55, 0xff, 0x4c, 0x50, 0x68, 0xff, 0x2f, 0x3b, 0x54, 0xff, 0x2a, 0x38, 0x43, 0xff, 0x19, 0x1b, 0x2e, 0xff, 0x39, 0x53, 0x7d, 0xff, 0x53, 0x78, 0xb3, 0xff, 0x5c, 0x81, 0xc2, 0xff, 0x84, 0xa5, 0xe5, 0xff, 0x8d, 0xb4, 0xee, 0xff, 0x7b, 0xab, 0xe9, 0xff, 0x60, 0x8c, 0xcf, 0xff, 0x4e, 0x71, 0xb9, 0xff, 0x88, 0xa4, 0xe2, 0xff, 0xb0, 0xcf, 0xef, 0xff, 0x8b, 0x94, 0xff, 0xff, 0x5f, 0x5b, 0xef, 0xff, 0x2c, 0x32, 0x9a, 0xff, 0x1d, 0x20, 0x89, 0xff, 0x40, 0x45, 0xb4, 0xff, 0x5a, 0x61, 0xd4, 0xff, 0x49, 0x56, 0xc5, 0xff, 0x49, 0x59, 0xc3, 0xff, 0x4c, 0x5a, 0xc1, 0xff, 0x59, 0x67, 0xc3, 0xff, 0x57, 0x62, 0xbd, 0xff, 0x55, 0x61, 0xc6, 0xff, 0x4f, 0x59, 0xd9, 0xff, 0x3d, 0x47, 0xc0, 0xff, 0x43, 0x41, 0xb9, 0xff, 0x65, 0x5c, 0xef, 0xff, 0x8a, 0x93, 0xff, 0xff, 0xb5, 0xd4, 0xf1, 0xff, 0x92, 0xb8, 0xe9, 0xff, 0x4e, 0x7a, 0xc4, 0xff, 0x6e, 0x95, 0xdc, 0xff, 0x96, 0xbd, 0xf8, 0xff, 0x97, 0xbb, 0xeb, 0xff, 0x9a, 0xbe, 0xef, 0xff, 0x9c, 0xc6, 0xff, 0xff, 0x43, 0x5e, 0x91, 0xff, 0x00, 0x00, 0x00, 0xff, 0x08, 0x02, 0x03, 0xff, 0x0c, 0x0c, 0x17, 0xff, 0x1a, 0x17, 0x1e, 0xff, 0x05, 0x06, 0x12, 0xff, 0x01, 0x02, 0x0b, 0xff, 0x14, 0x19, 0x25, 0xff, 0x1e, 0x2a, 0x40, 0xff, 0x0c, 0x17, 0x2b, 0xff, 0x26, 0x31, 0x45, 0xff, 0x33, 0x3e, 0x57, 0xff, 0x29, 0x36, 0x57, 0xff, 0x43, 0x4a, 0x6c, 0xff, 0xad, 0xb5, 0xc0, 0xff, 0xd3, 0xd5, 0xe8, 0xff, 0xe1, 0xde, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6,
+    0xff, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf9, 0xfa, 0xfa, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xf6, 0xf5, 0xf3, 0xff, 0xe9, 0xed, 0xf4, 0xff, 0x78, 0x89, 0xa2, 0xff, 0x2c, 0x3f, 0x5d, 0xff, 0x32, 0x3d, 0x50, 0xff, 0x4d, 0x5b, 0x72, 0xff, 0x56, 0x64, 0x84, 0xff, 0x41, 0x49, 0x63, 0xff, 0x3f, 0x4a, 0x60, 0xff, 0x3f, 0x4c, 0x60, 0xff, 0x28, 0x30, 0x3e, 0xff, 0x1a, 0x21, 0x2f, 0xff, 0x0d, 0x14, 0x22, 0xff, 0x05, 0x07, 0x0f, 0xff, 0x1c, 0x1f, 0x26, 0xff, 0x0e, 0x15, 0x20, 0xff, 0x16, 0x1c, 0x28, 0xff, 0x29, 0x2f, 0x3b, 0xff, 0x42, 0x49, 0x59, 0xff, 0x47, 0x4f, 0x64, 0xff, 0x2f, 0x3e, 0x56, 0xff, 0x2d, 0x36, 0x46, 0xff, 0x09, 0x0c, 0x19, 0xff, 0x21, 0x34, 0x4f, 0xff, 0x5a, 0x75, 0xac, 0xff, 0x50, 0x74, 0xb9, 0xff, 0x76, 0x9a, 0xd7, 0xff, 0x93, 0xb8, 0xee, 0xff, 0x85, 0xb2, 0xee, 0xff, 0x69, 0x96, 0xdf, 0xff, 0x5c, 0x7e, 0xca, 0xff, 0x91, 0xa8, 0xe4, 0xff, 0xb2, 0xc9, 0xf4, 0xff, 0xaf, 0xc9, 0xf3, 0xff, 0xa5, 0xb2, 0xfa, 0xff, 0x98, 0x9d, 0xff, 0xff, 0x85, 0x87, 0xff, 0xff, 0x62, 0x5f, 0xf6, 0xff, 0x52, 0x4d, 0xe7, 0xff, 0x52, 0x49, 0xd1, 0xff, 0x55, 0x50, 0xce, 0xff, 0x5e, 0x5f, 0xd5, 0xff, 0x6c, 0x6c, 0xdd, 0xff, 0x6a, 0x63, 0xdf, 0xff, 0x6d, 0x61, 0xe4, 0xff, 0x71, 0x66, 0xf9, 0xff, 0x80, 0x7a, 0xfa, 0xff, 0x83, 0x7a, 0xf7, 0xff, 0x88, 0x89, 0xff, 0xff, 0xa5, 0xcd, 0xea, 0xff, 0xb1, 0xd0, 0xf3, 0xff, 0x89, 0xab, 0xe8, 0xff, 0x52, 0x85, 0xcd, 0xff, 0x84, 0xac, 0xec, 0xff, 0x9d, 0xbf, 0xf2, 0xff, 0x96, 0xbd, 0xee, 0xff, 0x93, 0xbf, 0xf9, 0xff, 0x82, 0xac, 0xe4, 0xff, 0x1a, 0x26, 0x48, 0xff, 0x00, 0x00, 0x00, 0xff, 0x06, 0x04, 0x09, 0xff, 0x0d, 0x0e, 0x1a, 0xff, 0x1c, 0x1a, 0x22, 0xff, 0x08, 0x07, 0x10, 0xff, 0x03, 0x02, 0x0d, 0xff, 0x13, 0x1a, 0x29, 0xff, 0x19, 0x25, 0x3a, 0xff, 0x10, 0x1b, 0x30, 0xff, 0x2e, 0x39, 0x50, 0xff, 0x36, 0x41, 0x5c, 0xff, 0x34, 0x40, 0x5f, 0xff, 0x3a, 0x44, 0x67, 0xff, 0xa7, 0xae, 0xbd, 0xff, 0xd0, 0xd2, 0xde, 0xff, 0xe2, 0xe2, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3,
+    0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xff, 0xfa, 0xff, 0xfb, 0xfe, 0xfa, 0xff, 0xf9, 0xfb, 0xfa, 0xff, 0xf2, 0xf6, 0xf9, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xbd, 0xc4, 0xcd, 0xff, 0x42, 0x51, 0x69, 0xff, 0x31, 0x3c, 0x52, 0xff, 0x31, 0x3c, 0x52, 0xff, 0x55, 0x60, 0x75, 0xff, 0x59, 0x61, 0x7b, 0xff, 0x47, 0x51, 0x6b, 0xff, 0x40, 0x4b, 0x60, 0xff, 0x3f, 0x49, 0x5c, 0xff, 0x2d, 0x32, 0x44, 0xff, 0x17, 0x19, 0x29, 0xff, 0x0d, 0x0e, 0x1a, 0xff, 0x08, 0x0a, 0x14, 0xff, 0x23, 0x27, 0x32, 0xff, 0x0f, 0x16, 0x24, 0xff, 0x1c, 0x21, 0x34, 0xff, 0x34, 0x38, 0x4d, 0xff, 0x4a, 0x52, 0x65, 0xff, 0x43, 0x4f, 0x60, 0xff, 0x36, 0x42, 0x55, 0xff, 0x36, 0x35, 0x4e, 0xff, 0x06, 0x0d, 0x15, 0xff, 0x0d, 0x12, 0x1e, 0xff, 0x54, 0x5d, 0x91, 0xff, 0x52, 0x72, 0xbb, 0xff, 0x59, 0x83, 0xc2, 0xff, 0x88, 0xae, 0xe6, 0xff, 0x8f, 0xb7, 0xf1, 0xff, 0x7a, 0xa3, 0xed, 0xff, 0x68, 0x8a, 0xd6, 0xff, 0x90, 0xb0, 0xe8, 0xff, 0xaf, 0xc9, 0xf8, 0xff, 0xb3, 0xcb, 0xf4, 0xff, 0xbe, 0xd4, 0xf3, 0xff, 0xc6, 0xd0, 0xf9, 0xff, 0xb4, 0xb6, 0xfe, 0xff, 0x7d, 0x81, 0xee, 0xff, 0x57, 0x5a, 0xdb, 0xff, 0x5b, 0x51, 0xdd, 0xff, 0x6c, 0x5d, 0xe1, 0xff, 0x73, 0x6d, 0xdd, 0xff, 0x7a, 0x76, 0xdf, 0xff, 0x79, 0x73, 0xe4, 0xff, 0x79, 0x6f, 0xee, 0xff, 0x7d, 0x73, 0xf1, 0xff, 0x8d, 0x91, 0xee, 0xff, 0x9f, 0xa7, 0xf2, 0xff, 0xb3, 0xc4, 0xfa, 0xff, 0xaa, 0xcc, 0xef, 0xff, 0xa4, 0xc6, 0xf8, 0xff, 0x84, 0xaa, 0xe9, 0xff, 0x6c, 0x9f, 0xdf, 0xff, 0x90, 0xb9, 0xf0, 0xff, 0x9b, 0xba, 0xe7, 0xff, 0x92, 0xbd, 0xf7, 0xff, 0x90, 0xc1, 0xff, 0xff, 0x4b, 0x69, 0x92, 0xff, 0x00, 0x01, 0x02, 0xff, 0x08, 0x03, 0x02, 0xff, 0x02, 0x06, 0x0e, 0xff, 0x08, 0x0d, 0x1b, 0xff, 0x1d, 0x1f, 0x29, 0xff, 0x0f, 0x0e, 0x12, 0xff, 0x05, 0x05, 0x0e, 0xff, 0x14, 0x1c, 0x2f, 0xff, 0x18, 0x23, 0x34, 0xff, 0x12, 0x1d, 0x33, 0xff, 0x2b, 0x36, 0x55, 0xff, 0x37, 0x42, 0x62, 0xff, 0x37, 0x42, 0x5f, 0xff, 0x2f, 0x3c, 0x5e, 0xff, 0x8f, 0x97, 0xaf, 0xff, 0xdc, 0xde, 0xe1, 0xff, 0xe8, 0xed, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe,
+    0xff, 0xff, 0xff, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfa, 0xfc, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xe7, 0xef, 0xff, 0x63, 0x6c, 0x81, 0xff, 0x32, 0x3e, 0x58, 0xff, 0x30, 0x3b, 0x51, 0xff, 0x32, 0x3d, 0x53, 0xff, 0x57, 0x62, 0x78, 0xff, 0x57, 0x61, 0x7b, 0xff, 0x41, 0x4b, 0x65, 0xff, 0x49, 0x54, 0x69, 0xff, 0x45, 0x50, 0x62, 0xff, 0x2f, 0x35, 0x46, 0xff, 0x11, 0x15, 0x24, 0xff, 0x02, 0x03, 0x10, 0xff, 0x11, 0x12, 0x1c, 0xff, 0x24, 0x28, 0x33, 0xff, 0x18, 0x1e, 0x2d, 0xff, 0x26, 0x2c, 0x3d, 0xff, 0x3a, 0x3e, 0x52, 0xff, 0x47, 0x4e, 0x61, 0xff, 0x43, 0x4e, 0x5f, 0xff, 0x36, 0x3f, 0x53, 0xff, 0x2f, 0x35, 0x4d, 0xff, 0x12, 0x1b, 0x25, 0xff, 0x01, 0x03, 0x10, 0xff, 0x1f, 0x21, 0x41, 0xff, 0x5f, 0x75, 0xa8, 0xff, 0x54, 0x77, 0xbb, 0xff, 0x73, 0x9a, 0xd7, 0xff, 0x92, 0xbb, 0xef, 0xff, 0x8f, 0xb6, 0xf0, 0xff, 0x7a, 0xa0, 0xe0, 0xff, 0x8c, 0xb2, 0xe6, 0xff, 0xaa, 0xc8, 0xf5, 0xff, 0xac, 0xc5, 0xf1, 0xff, 0xb8, 0xd2, 0xf2, 0xff, 0xc7, 0xd9, 0xf7, 0xff, 0xbc, 0xcb, 0xfc, 0xff, 0x99, 0xa2, 0xfa, 0xff, 0x6d, 0x75, 0xeb, 0xff, 0x58, 0x58, 0xdf, 0xff, 0x5d, 0x57, 0xdc, 0xff, 0x60, 0x5d, 0xd9, 0xff, 0x62, 0x60, 0xda, 0xff, 0x67, 0x66, 0xde, 0xff, 0x69, 0x6d, 0xe7, 0xff, 0x84, 0x8c, 0xf0, 0xff, 0xa7, 0xb8, 0xf5, 0xff, 0xb7, 0xd0, 0xef, 0xff, 0xb2, 0xd0, 0xea, 0xff, 0xa4, 0xc6, 0xee, 0xff, 0x9c, 0xc0, 0xf8, 0xff, 0x8b, 0xb1, 0xec, 0xff, 0x8b, 0xb8, 0xed, 0xff, 0x96, 0xbe, 0xf2, 0xff, 0x95, 0xbc, 0xee, 0xff, 0x99, 0xc6, 0xfc, 0xff, 0x76, 0x95, 0xc3, 0xff, 0x09, 0x11, 0x24, 0xff, 0x00, 0x00, 0x02, 0xff, 0x07, 0x06, 0x0b, 0xff, 0x0b, 0x0e, 0x18, 0xff, 0x17, 0x1e, 0x2b, 0xff, 0x1c, 0x20, 0x2c, 0xff, 0x09, 0x09, 0x11, 0xff, 0x06, 0x08, 0x12, 0xff, 0x22, 0x2a, 0x3c, 0xff, 0x13, 0x1e, 0x30, 0xff, 0x16, 0x21, 0x36, 0xff, 0x34, 0x3f, 0x5d, 0xff, 0x2f, 0x3a, 0x59, 0xff, 0x39, 0x44, 0x63, 0xff, 0x35, 0x40, 0x5f, 0xff, 0x68, 0x72, 0x8a, 0xff, 0xdb, 0xe0, 0xea, 0xff, 0xee, 0xf0, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab,
+    0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xf8, 0xfb, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf3, 0xf6, 0xff, 0x80, 0x81, 0x91, 0xff, 0x32, 0x3b, 0x5a, 0xff, 0x2e, 0x35, 0x51, 0xff, 0x1d, 0x28, 0x3e, 0xff, 0x31, 0x3c, 0x52, 0xff, 0x53, 0x5e, 0x74, 0xff, 0x52, 0x5c, 0x76, 0xff, 0x37, 0x40, 0x5a, 0xff, 0x50, 0x5c, 0x71, 0xff, 0x46, 0x51, 0x63, 0xff, 0x2b, 0x30, 0x42, 0xff, 0x0d, 0x11, 0x20, 0xff, 0x00, 0x01, 0x0e, 0xff, 0x1c, 0x1e, 0x26, 0xff, 0x26, 0x29, 0x34, 0xff, 0x19, 0x1f, 0x2d, 0xff, 0x28, 0x2d, 0x3f, 0xff, 0x3a, 0x3d, 0x51, 0xff, 0x47, 0x50, 0x62, 0xff, 0x41, 0x4b, 0x5c, 0xff, 0x37, 0x3d, 0x52, 0xff, 0x2b, 0x38, 0x4e, 0xff, 0x13, 0x1b, 0x28, 0xff, 0x0a, 0x09, 0x0e, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2c, 0x3b, 0x51, 0xff, 0x5a, 0x7b, 0xbb, 0xff, 0x63, 0x8b, 0xcf, 0xff, 0x8e, 0xb6, 0xe7, 0xff, 0xa1, 0xc5, 0xf2, 0xff, 0x8f, 0xb8, 0xed, 0xff, 0x91, 0xbc, 0xeb, 0xff, 0xa6, 0xc6, 0xf3, 0xff, 0xaa, 0xc5, 0xf5, 0xff, 0xb1, 0xcc, 0xf0, 0xff, 0xc0, 0xd6, 0xee, 0xff, 0xbb, 0xd0, 0xf4, 0xff, 0x9b, 0xb9, 0xed, 0xff, 0x7f, 0xa4, 0xea, 0xff, 0x71, 0x94, 0xe7, 0xff, 0x6c, 0x8a, 0xdb, 0xff, 0x6d, 0x88, 0xda, 0xff, 0x71, 0x8b, 0xe2, 0xff, 0x74, 0x93, 0xde, 0xff, 0x82, 0xa1, 0xe8, 0xff, 0xa1, 0xbf, 0xf6, 0xff, 0xb1, 0xcb, 0xf3, 0xff, 0xb1, 0xc9, 0xf0, 0xff, 0xa8, 0xc2, 0xf1, 0xff, 0x9d, 0xc1, 0xef, 0xff, 0x97, 0xc2, 0xf2, 0xff, 0x94, 0xbb, 0xf1, 0xff, 0x9c, 0xc3, 0xed, 0xff, 0x98, 0xc0, 0xee, 0xff, 0x99, 0xc7, 0xfd, 0xff, 0x8a, 0xb8, 0xec, 0xff, 0x27, 0x35, 0x51, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0c, 0x07, 0x0c, 0xff, 0x06, 0x06, 0x12, 0xff, 0x17, 0x17, 0x23, 0xff, 0x1f, 0x25, 0x34, 0xff, 0x13, 0x1a, 0x28, 0xff, 0x02, 0x04, 0x0e, 0xff, 0x11, 0x15, 0x22, 0xff, 0x1e, 0x28, 0x3a, 0xff, 0x0f, 0x1a, 0x2b, 0xff, 0x1f, 0x2b, 0x40, 0xff, 0x38, 0x43, 0x61, 0xff, 0x2e, 0x39, 0x58, 0xff, 0x3d, 0x48, 0x68, 0xff, 0x47, 0x4f, 0x6b, 0xff, 0x48, 0x52, 0x6b, 0xff, 0xc6, 0xcf, 0xdc, 0xff, 0xf9, 0xf8, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b,
+    0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xf9, 0xfb, 0xfb, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x89, 0x8f, 0xa3, 0xff, 0x4e, 0x56, 0x6b, 0xff, 0x4b, 0x55, 0x6b, 0xff, 0x19, 0x21, 0x38, 0xff, 0x2a, 0x32, 0x4c, 0xff, 0x37, 0x3f, 0x56, 0xff, 0x45, 0x4e, 0x62, 0xff, 0x4b, 0x54, 0x68, 0xff, 0x39, 0x43, 0x56, 0xff, 0x47, 0x51, 0x64, 0xff, 0x3a, 0x45, 0x57, 0xff, 0x1e, 0x25, 0x34, 0xff, 0x0e, 0x0f, 0x19, 0xff, 0x0a, 0x0e, 0x19, 0xff, 0x20, 0x27, 0x35, 0xff, 0x32, 0x37, 0x44, 0xff, 0x1e, 0x21, 0x2b, 0xff, 0x24, 0x29, 0x37, 0xff, 0x35, 0x3f, 0x51, 0xff, 0x44, 0x4e, 0x60, 0xff, 0x41, 0x49, 0x5d, 0xff, 0x34, 0x3e, 0x52, 0xff, 0x2f, 0x3c, 0x53, 0xff, 0x11, 0x15, 0x28, 0xff, 0x0b, 0x0d, 0x13, 0xff, 0x03, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x34, 0x46, 0x71, 0xff, 0x64, 0x8c, 0xcc, 0xff, 0x7c, 0xa9, 0xe6, 0xff, 0xa6, 0xc6, 0xf5, 0xff, 0xa7, 0xc3, 0xeb, 0xff, 0x9e, 0xc0, 0xec, 0xff, 0xa3, 0xc6, 0xf5, 0xff, 0xa2, 0xc4, 0xf5, 0xff, 0xa6, 0xc3, 0xf0, 0xff, 0xb2, 0xcb, 0xf7, 0xff, 0xaf, 0xc6, 0xf6, 0xff, 0x93, 0xb6, 0xed, 0xff, 0x81, 0xac, 0xe6, 0xff, 0x7b, 0xa7, 0xe4, 0xff, 0x77, 0xa2, 0xdf, 0xff, 0x7c, 0xa4, 0xe0, 0xff, 0x80, 0xa7, 0xe2, 0xff, 0x87, 0xae, 0xe5, 0xff, 0x90, 0xb2, 0xe9, 0xff, 0x99, 0xbb, 0xec, 0xff, 0xa1, 0xbd, 0xec, 0xff, 0xa6, 0xc2, 0xf3, 0xff, 0xa2, 0xc0, 0xf3, 0xff, 0x9f, 0xc0, 0xef, 0xff, 0x9d, 0xc1, 0xef, 0xff, 0x9f, 0xc3, 0xf1, 0xff, 0xa2, 0xc3, 0xef, 0xff, 0x9b, 0xc4, 0xf7, 0xff, 0x92, 0xbc, 0xf4, 0xff, 0x42, 0x53, 0x6e, 0xff, 0x05, 0x08, 0x16, 0xff, 0x07, 0x08, 0x0f, 0xff, 0x01, 0x02, 0x07, 0xff, 0x09, 0x0d, 0x17, 0xff, 0x18, 0x1e, 0x2a, 0xff, 0x18, 0x21, 0x2e, 0xff, 0x0f, 0x18, 0x24, 0xff, 0x0b, 0x0f, 0x19, 0xff, 0x1f, 0x22, 0x2f, 0xff, 0x0f, 0x12, 0x25, 0xff, 0x11, 0x19, 0x2e, 0xff, 0x2a, 0x35, 0x4f, 0xff, 0x40, 0x49, 0x65, 0xff, 0x34, 0x3e, 0x56, 0xff, 0x34, 0x3f, 0x54, 0xff, 0x4d, 0x58, 0x70, 0xff, 0x3c, 0x47, 0x68, 0xff, 0xa0, 0xa5, 0xbb, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6b,
+    0xff, 0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfa, 0xfc, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0xa9, 0xb6, 0xff, 0x65, 0x70, 0x86, 0xff, 0x70, 0x7a, 0x8f, 0xff, 0x17, 0x21, 0x32, 0xff, 0x24, 0x2d, 0x41, 0xff, 0x38, 0x3e, 0x5a, 0xff, 0x34, 0x3b, 0x53, 0xff, 0x3a, 0x43, 0x56, 0xff, 0x3a, 0x44, 0x56, 0xff, 0x36, 0x40, 0x51, 0xff, 0x3c, 0x46, 0x58, 0xff, 0x3c, 0x47, 0x5a, 0xff, 0x12, 0x1a, 0x29, 0xff, 0x07, 0x08, 0x0f, 0xff, 0x11, 0x15, 0x1f, 0xff, 0x1f, 0x27, 0x37, 0xff, 0x2c, 0x32, 0x41, 0xff, 0x1f, 0x20, 0x29, 0xff, 0x2f, 0x34, 0x40, 0xff, 0x35, 0x41, 0x53, 0xff, 0x35, 0x3e, 0x51, 0xff, 0x39, 0x40, 0x56, 0xff, 0x38, 0x44, 0x57, 0xff, 0x35, 0x40, 0x58, 0xff, 0x18, 0x1a, 0x30, 0xff, 0x0c, 0x0c, 0x11, 0xff, 0x07, 0x02, 0x00, 0xff, 0x05, 0x00, 0x00, 0xff, 0x02, 0x05, 0x17, 0xff, 0x39, 0x57, 0x86, 0xff, 0x77, 0x9e, 0xda, 0xff, 0x9f, 0xc0, 0xf5, 0xff, 0xb2, 0xcd, 0xf5, 0xff, 0xab, 0xca, 0xf3, 0xff, 0xa6, 0xc6, 0xf3, 0xff, 0xa3, 0xc6, 0xf1, 0xff, 0xa2, 0xc6, 0xf2, 0xff, 0xa5, 0xc6, 0xf5, 0xff, 0xa8, 0xc4, 0xf6, 0xff, 0x98, 0xb8, 0xf4, 0xff, 0x88, 0xac, 0xec, 0xff, 0x80, 0xa5, 0xe5, 0xff, 0x7c, 0xa1, 0xe4, 0xff, 0x7f, 0xa2, 0xe7, 0xff, 0x83, 0xa4, 0xe5, 0xff, 0x8a, 0xa8, 0xe9, 0xff, 0x92, 0xaf, 0xeb, 0xff, 0x9d, 0xba, 0xf1, 0xff, 0xa4, 0xbf, 0xf1, 0xff, 0xa4, 0xc3, 0xef, 0xff, 0xa2, 0xc4, 0xee, 0xff, 0xa7, 0xc6, 0xf2, 0xff, 0xa8, 0xc6, 0xf2, 0xff, 0xa8, 0xc8, 0xf4, 0xff, 0xa4, 0xc7, 0xf9, 0xff, 0x9e, 0xc4, 0xfb, 0xff, 0x4e, 0x70, 0xa1, 0xff, 0x00, 0x00, 0x04, 0xff, 0x00, 0x00, 0x08, 0xff, 0x16, 0x1a, 0x27, 0xff, 0x0b, 0x0f, 0x19, 0xff, 0x0f, 0x16, 0x22, 0xff, 0x16, 0x1f, 0x2e, 0xff, 0x16, 0x1f, 0x2f, 0xff, 0x13, 0x1b, 0x2a, 0xff, 0x20, 0x26, 0x30, 0xff, 0x13, 0x16, 0x21, 0xff, 0x0f, 0x10, 0x23, 0xff, 0x13, 0x19, 0x30, 0xff, 0x33, 0x3d, 0x59, 0xff, 0x44, 0x4d, 0x68, 0xff, 0x3e, 0x48, 0x5f, 0xff, 0x30, 0x3c, 0x4d, 0xff, 0x41, 0x4c, 0x63, 0xff, 0x40, 0x4b, 0x6f, 0xff, 0x59, 0x5f, 0x7b, 0xff, 0xe0, 0xe1, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4b,
+    0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xc1, 0xc8, 0xff, 0x7c, 0x84, 0x95, 0xff, 0x89, 0x90, 0xa3, 0xff, 0x1d, 0x26, 0x3b, 0xff, 0x15, 0x1d, 0x31, 0xff, 0x2f, 0x37, 0x4c, 0xff, 0x42, 0x47, 0x63, 0xff, 0x41, 0x47, 0x60, 0xff, 0x36, 0x3f, 0x53, 0xff, 0x33, 0x3c, 0x4e, 0xff, 0x38, 0x42, 0x53, 0xff, 0x33, 0x3e, 0x51, 0xff, 0x39, 0x45, 0x5a, 0xff, 0x13, 0x1a, 0x2a, 0xff, 0x08, 0x09, 0x10, 0xff, 0x19, 0x1d, 0x28, 0xff, 0x2a, 0x31, 0x41, 0xff, 0x30, 0x35, 0x43, 0xff, 0x19, 0x1a, 0x23, 0xff, 0x33, 0x38, 0x44, 0xff, 0x51, 0x5d, 0x6f, 0xff, 0x4f, 0x5a, 0x6c, 0xff, 0x42, 0x4a, 0x5f, 0xff, 0x3c, 0x47, 0x5a, 0xff, 0x34, 0x40, 0x57, 0xff, 0x1a, 0x1c, 0x31, 0xff, 0x07, 0x05, 0x08, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x00, 0x00, 0xff, 0x02, 0x04, 0x01, 0xff, 0x07, 0x15, 0x2e, 0xff, 0x4b, 0x5f, 0x96, 0xff, 0x8b, 0xb4, 0xee, 0xff, 0xa9, 0xd0, 0xfe, 0xff, 0xb3, 0xce, 0xf6, 0xff, 0xb3, 0xcd, 0xf3, 0xff, 0xaf, 0xce, 0xf2, 0xff, 0xab, 0xcd, 0xf6, 0xff, 0xb0, 0xcb, 0xf8, 0xff, 0xaf, 0xc5, 0xf2, 0xff, 0x9d, 0xbb, 0xf3, 0xff, 0x8e, 0xb1, 0xee, 0xff, 0x87, 0xac, 0xe9, 0xff, 0x84, 0xa8, 0xe8, 0xff, 0x87, 0xa8, 0xea, 0xff, 0x8c, 0xaa, 0xea, 0xff, 0x92, 0xaf, 0xed, 0xff, 0x9b, 0xb7, 0xef, 0xff, 0xa6, 0xc0, 0xf3, 0xff, 0xac, 0xc4, 0xf3, 0xff, 0xaa, 0xc6, 0xf0, 0xff, 0xa7, 0xc7, 0xf0, 0xff, 0xae, 0xce, 0xf7, 0xff, 0xb4, 0xce, 0xf2, 0xff, 0xb2, 0xca, 0xf5, 0xff, 0x99, 0xc2, 0xfc, 0xff, 0x6d, 0x90, 0xc6, 0xff, 0x2d, 0x43, 0x69, 0xff, 0x02, 0x01, 0x07, 0xff, 0x02, 0x01, 0x05, 0xff, 0x05, 0x09, 0x16, 0xff, 0x13, 0x19, 0x2b, 0xff, 0x11, 0x19, 0x2d, 0xff, 0x11, 0x1c, 0x32, 0xff, 0x1b, 0x21, 0x3e, 0xff, 0x1b, 0x21, 0x35, 0xff, 0x0d, 0x12, 0x1a, 0xff, 0x07, 0x09, 0x14, 0xff, 0x14, 0x16, 0x29, 0xff, 0x1a, 0x21, 0x37, 0xff, 0x39, 0x42, 0x5d, 0xff, 0x45, 0x4d, 0x68, 0xff, 0x4d, 0x57, 0x6e, 0xff, 0x3c, 0x48, 0x5b, 0xff, 0x3f, 0x49, 0x60, 0xff, 0x4d, 0x56, 0x79, 0xff, 0x32, 0x3c, 0x5a, 0xff, 0xa0, 0xa7, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21,
+    0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xfa, 0xff, 0xff, 0xfe, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xd2, 0xdc, 0xff, 0x60, 0x69, 0x81, 0xff, 0x8f, 0x98, 0xac, 0xff, 0x39, 0x44, 0x53, 0xff, 0x00, 0x0a, 0x1e, 0xff, 0x1e, 0x28, 0x3c, 0xff, 0x27, 0x30, 0x46, 0xff, 0x5a, 0x64, 0x7f, 0xff, 0x51, 0x5a, 0x72, 0xff, 0x21, 0x2b, 0x3f, 0xff, 0x2c, 0x36, 0x4b, 0xff, 0x3f, 0x4a, 0x5d, 0xff, 0x2d, 0x36, 0x47, 0xff, 0x27, 0x30, 0x40, 0xff, 0x0b, 0x12, 0x20, 0xff, 0x0c, 0x0f, 0x18, 0xff, 0x2f, 0x31, 0x3a, 0xff, 0x36, 0x3d, 0x4d, 0xff, 0x30, 0x38, 0x46, 0xff, 0x10, 0x14, 0x1d, 0xff, 0x2c, 0x33, 0x3f, 0xff, 0x53, 0x5d, 0x6f, 0xff, 0x55, 0x5c, 0x6f, 0xff, 0x47, 0x4f, 0x65, 0xff, 0x39, 0x44, 0x5a, 0xff, 0x31, 0x3c, 0x53, 0xff, 0x22, 0x27, 0x3c, 0xff, 0x08, 0x09, 0x13, 0xff, 0x00, 0x01, 0x03, 0xff, 0x04, 0x04, 0x03, 0xff, 0x08, 0x08, 0x06, 0xff, 0x10, 0x17, 0x28, 0xff, 0x17, 0x27, 0x50, 0xff, 0x4c, 0x6d, 0xa2, 0xff, 0x9f, 0xbf, 0xef, 0xff, 0xb2, 0xd1, 0xfd, 0xff, 0xb7, 0xd4, 0xf9, 0xff, 0xc1, 0xd4, 0xf6, 0xff, 0xbc, 0xd0, 0xf5, 0xff, 0xbb, 0xd1, 0xf9, 0xff, 0xb3, 0xc7, 0xf9, 0xff, 0xa3, 0xbe, 0xf5, 0xff, 0x96, 0xb6, 0xef, 0xff, 0x8d, 0xae, 0xec, 0xff, 0x8b, 0xaa, 0xe9, 0xff, 0x8d, 0xab, 0xea, 0xff, 0x93, 0xaf, 0xe8, 0xff, 0x9a, 0xb5, 0xec, 0xff, 0xa2, 0xbc, 0xf2, 0xff, 0xaa, 0xc4, 0xf5, 0xff, 0xaf, 0xc7, 0xf3, 0xff, 0xb0, 0xcb, 0xf1, 0xff, 0xb7, 0xd0, 0xf0, 0xff, 0xba, 0xd3, 0xf6, 0xff, 0xb0, 0xce, 0xf7, 0xff, 0xa4, 0xc2, 0xf3, 0xff, 0x6a, 0x87, 0xc2, 0xff, 0x40, 0x5e, 0x94, 0xff, 0x43, 0x60, 0x87, 0xff, 0x0e, 0x12, 0x18, 0xff, 0x08, 0x08, 0x0d, 0xff, 0x02, 0x06, 0x12, 0xff, 0x07, 0x0c, 0x1d, 0xff, 0x14, 0x1a, 0x2d, 0xff, 0x1a, 0x21, 0x36, 0xff, 0x19, 0x1f, 0x36, 0xff, 0x10, 0x13, 0x2a, 0xff, 0x01, 0x04, 0x0e, 0xff, 0x14, 0x18, 0x21, 0xff, 0x15, 0x1a, 0x2d, 0xff, 0x22, 0x2a, 0x41, 0xff, 0x3a, 0x45, 0x61, 0xff, 0x44, 0x50, 0x6c, 0xff, 0x64, 0x6d, 0x85, 0xff, 0x4a, 0x53, 0x66, 0xff, 0x41, 0x48, 0x5c, 0xff, 0x47, 0x51, 0x71, 0xff, 0x3a, 0x49, 0x6c, 0xff, 0x63, 0x67, 0x7e, 0xff, 0xf7, 0xf5, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xf9, 0xfb, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xe6, 0xea, 0xff, 0x51, 0x60, 0x77, 0xff, 0x60, 0x69, 0x87, 0xff, 0x52, 0x55, 0x6c, 0xff, 0x1a, 0x25, 0x34, 0xff, 0x3a, 0x4a, 0x5a, 0xff, 0x48, 0x53, 0x66, 0xff, 0x3c, 0x48, 0x5d, 0xff, 0x6e, 0x7d, 0x97, 0xff, 0x43, 0x50, 0x67, 0xff, 0x1a, 0x26, 0x39, 0xff, 0x1e, 0x2a, 0x41, 0xff, 0x41, 0x4c, 0x60, 0xff, 0x29, 0x2d, 0x3b, 0xff, 0x1e, 0x21, 0x2b, 0xff, 0x0b, 0x10, 0x1e, 0xff, 0x12, 0x18, 0x24, 0xff, 0x36, 0x3a, 0x45, 0xff, 0x3c, 0x46, 0x57, 0xff, 0x25, 0x2f, 0x3f, 0xff, 0x10, 0x17, 0x22, 0xff, 0x2f, 0x3a, 0x47, 0xff, 0x43, 0x4c, 0x5d, 0xff, 0x32, 0x34, 0x47, 0xff, 0x3f, 0x48, 0x5e, 0xff, 0x39, 0x44, 0x5d, 0xff, 0x3a, 0x43, 0x58, 0xff, 0x26, 0x2f, 0x44, 0xff, 0x04, 0x07, 0x17, 0xff, 0x00, 0x01, 0x00, 0xff, 0x07, 0x06, 0x02, 0xff, 0x07, 0x01, 0x07, 0xff, 0x0e, 0x16, 0x2a, 0xff, 0x1e, 0x34, 0x4f, 0xff, 0x1e, 0x30, 0x59, 0xff, 0x51, 0x66, 0x97, 0xff, 0x92, 0xb9, 0xed, 0xff, 0xb0, 0xd4, 0xff, 0xff, 0xc1, 0xd1, 0xfc, 0xff, 0xc4, 0xd5, 0xf8, 0xff, 0xbe, 0xd4, 0xf4, 0xff, 0xb7, 0xcc, 0xf5, 0xff, 0xaa, 0xc1, 0xf5, 0xff, 0x96, 0xb8, 0xf0, 0xff, 0x8e, 0xaf, 0xec, 0xff, 0x8e, 0xa8, 0xe9, 0xff, 0x90, 0xac, 0xe7, 0xff, 0x93, 0xb0, 0xe5, 0xff, 0x9d, 0xb9, 0xea, 0xff, 0xa8, 0xc0, 0xf0, 0xff, 0xb0, 0xc7, 0xf4, 0xff, 0xb6, 0xcc, 0xf2, 0xff, 0xb7, 0xce, 0xef, 0xff, 0xc0, 0xd4, 0xf1, 0xff, 0xbe, 0xd2, 0xf6, 0xff, 0x9b, 0xc0, 0xf5, 0xff, 0x60, 0x88, 0xc4, 0xff, 0x45, 0x56, 0x8d, 0xff, 0x58, 0x77, 0xad, 0xff, 0x3e, 0x68, 0x96, 0xff, 0x07, 0x13, 0x1e, 0xff, 0x06, 0x08, 0x10, 0xff, 0x05, 0x07, 0x14, 0xff, 0x11, 0x14, 0x1f, 0xff, 0x20, 0x21, 0x31, 0xff, 0x23, 0x23, 0x35, 0xff, 0x14, 0x1b, 0x26, 0xff, 0x10, 0x14, 0x26, 0xff, 0x06, 0x05, 0x11, 0xff, 0x17, 0x1d, 0x26, 0xff, 0x16, 0x21, 0x35, 0xff, 0x2c, 0x36, 0x4f, 0xff, 0x3b, 0x48, 0x66, 0xff, 0x39, 0x4a, 0x66, 0xff, 0x8a, 0x90, 0xaa, 0xff, 0x7a, 0x7f, 0x92, 0xff, 0x4f, 0x54, 0x67, 0xff, 0x3d, 0x4c, 0x69, 0xff, 0x4a, 0x5c, 0x81, 0xff, 0x42, 0x44, 0x66, 0xff, 0xb6, 0xb5, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfc, 0xff, 0xfa, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xef, 0xf7, 0xff, 0x66, 0x71, 0x82, 0xff, 0x57, 0x66, 0x72, 0xff, 0x95, 0xa0, 0xac, 0xff, 0x6b, 0x6b, 0x81, 0xff, 0x2a, 0x2e, 0x3d, 0xff, 0xb1, 0xb9, 0xc1, 0xff, 0x4e, 0x58, 0x6a, 0xff, 0x5b, 0x68, 0x80, 0xff, 0x66, 0x74, 0x8f, 0xff, 0x25, 0x33, 0x49, 0xff, 0x19, 0x25, 0x39, 0xff, 0x27, 0x31, 0x45, 0xff, 0x42, 0x4a, 0x5c, 0xff, 0x1d, 0x21, 0x2c, 0xff, 0x0e, 0x0f, 0x18, 0xff, 0x0e, 0x12, 0x1e, 0xff, 0x20, 0x27, 0x37, 0xff, 0x35, 0x40, 0x52, 0xff, 0x43, 0x4d, 0x60, 0xff, 0x32, 0x39, 0x4c, 0xff, 0x19, 0x1d, 0x2d, 0xff, 0x29, 0x32, 0x41, 0xff, 0x4c, 0x55, 0x67, 0xff, 0x2b, 0x2e, 0x41, 0xff, 0x3c, 0x45, 0x5b, 0xff, 0x3e, 0x4a, 0x62, 0xff, 0x3e, 0x47, 0x5c, 0xff, 0x29, 0x30, 0x45, 0xff, 0x0d, 0x10, 0x1e, 0xff, 0x00, 0x01, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x02, 0x00, 0x01, 0xff, 0x0c, 0x12, 0x22, 0xff, 0x1e, 0x31, 0x4b, 0xff, 0x25, 0x39, 0x60, 0xff, 0x19, 0x31, 0x60, 0xff, 0x33, 0x52, 0x89, 0xff, 0x7a, 0x99, 0xd1, 0xff, 0xb2, 0xcf, 0xff, 0xff, 0xbe, 0xd8, 0xff, 0xff, 0xba, 0xd3, 0xf6, 0xff, 0xba, 0xce, 0xf3, 0xff, 0xa3, 0xbe, 0xf0, 0xff, 0x90, 0xb5, 0xed, 0xff, 0x8a, 0xae, 0xeb, 0xff, 0x8a, 0xa8, 0xea, 0xff, 0x8d, 0xab, 0xeb, 0xff, 0x8f, 0xae, 0xe7, 0xff, 0x98, 0xb5, 0xe9, 0xff, 0xa3, 0xba, 0xea, 0xff, 0xac, 0xc2, 0xed, 0xff, 0xba, 0xcf, 0xf3, 0xff, 0xc0, 0xd6, 0xf8, 0xff, 0xba, 0xd5, 0xfd, 0xff, 0x96, 0xb4, 0xe7, 0xff, 0x5f, 0x7e, 0xb6, 0xff, 0x3a, 0x5f, 0x97, 0xff, 0x4a, 0x6c, 0xa1, 0xff, 0x64, 0x8f, 0xc3, 0xff, 0x42, 0x64, 0x92, 0xff, 0x0f, 0x11, 0x1d, 0xff, 0x04, 0x06, 0x0e, 0xff, 0x07, 0x0b, 0x17, 0xff, 0x18, 0x1b, 0x28, 0xff, 0x22, 0x25, 0x35, 0xff, 0x18, 0x1a, 0x2e, 0xff, 0x0e, 0x14, 0x26, 0xff, 0x0b, 0x11, 0x1d, 0xff, 0x07, 0x09, 0x11, 0xff, 0x1e, 0x24, 0x31, 0xff, 0x16, 0x24, 0x3a, 0xff, 0x32, 0x3e, 0x59, 0xff, 0x41, 0x50, 0x6f, 0xff, 0x3a, 0x4a, 0x67, 0xff, 0x86, 0x8c, 0xa6, 0xff, 0xa7, 0xac, 0xbf, 0xff, 0x77, 0x82, 0x96, 0xff, 0x44, 0x50, 0x6e, 0xff, 0x4b, 0x57, 0x74, 0xff, 0x3b, 0x47, 0x61, 0xff, 0x61, 0x68, 0x82, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfa, 0xfc, 0xfa, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe5, 0xe8, 0xec, 0xff, 0x7e, 0x8e, 0xa6, 0xff, 0x5a, 0x65, 0x7e, 0xff, 0xa0, 0xa0, 0xa8, 0xff, 0xe7, 0xee, 0xed, 0xff, 0x4b, 0x57, 0x69, 0xff, 0x89, 0x8f, 0x9c, 0xff, 0xd0, 0xd4, 0xd9, 0xff, 0x20, 0x2a, 0x3c, 0xff, 0x89, 0x97, 0xb0, 0xff, 0x60, 0x6d, 0x88, 0xff, 0x14, 0x20, 0x36, 0xff, 0x19, 0x24, 0x38, 0xff, 0x37, 0x3f, 0x53, 0xff, 0x32, 0x38, 0x46, 0xff, 0x06, 0x08, 0x11, 0xff, 0x08, 0x09, 0x0f, 0xff, 0x12, 0x17, 0x21, 0xff, 0x2c, 0x36, 0x47, 0xff, 0x4b, 0x59, 0x71, 0xff, 0x4f, 0x59, 0x71, 0xff, 0x37, 0x3f, 0x53, 0xff, 0x14, 0x18, 0x2a, 0xff, 0x28, 0x30, 0x41, 0xff, 0x51, 0x5b, 0x6b, 0xff, 0x2f, 0x32, 0x46, 0xff, 0x38, 0x41, 0x56, 0xff, 0x48, 0x54, 0x6c, 0xff, 0x3e, 0x47, 0x5d, 0xff, 0x2a, 0x32, 0x47, 0xff, 0x13, 0x16, 0x24, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x0b, 0x0f, 0x1e, 0xff, 0x1e, 0x30, 0x49, 0xff, 0x28, 0x3b, 0x61, 0xff, 0x2d, 0x40, 0x68, 0xff, 0x28, 0x3b, 0x6a, 0xff, 0x2d, 0x43, 0x76, 0xff, 0x5d, 0x7a, 0xa8, 0xff, 0x93, 0xb3, 0xe0, 0xff, 0xac, 0xd1, 0xff, 0xff, 0xa6, 0xcc, 0xff, 0xff, 0x9b, 0xbc, 0xf2, 0xff, 0x8d, 0xb3, 0xe9, 0xff, 0x87, 0xae, 0xea, 0xff, 0x89, 0xaa, 0xec, 0xff, 0x8b, 0xac, 0xee, 0xff, 0x8e, 0xae, 0xe9, 0xff, 0x95, 0xb4, 0xeb, 0xff, 0x98, 0xb6, 0xed, 0xff, 0xa3, 0xc0, 0xf4, 0xff, 0xae, 0xcb, 0xf8, 0xff, 0xaf, 0xc7, 0xf0, 0xff, 0x83, 0xa0, 0xd2, 0xff, 0x4d, 0x71, 0xb0, 0xff, 0x46, 0x64, 0x9f, 0xff, 0x52, 0x75, 0xac, 0xff, 0x59, 0x86, 0xbb, 0xff, 0x5c, 0x90, 0xc4, 0xff, 0x3f, 0x5c, 0x8b, 0xff, 0x0d, 0x09, 0x17, 0xff, 0x05, 0x07, 0x10, 0xff, 0x0f, 0x14, 0x20, 0xff, 0x1f, 0x22, 0x2f, 0xff, 0x22, 0x25, 0x34, 0xff, 0x0c, 0x0e, 0x21, 0xff, 0x0a, 0x0f, 0x23, 0xff, 0x06, 0x0e, 0x16, 0xff, 0x0b, 0x0d, 0x14, 0xff, 0x21, 0x27, 0x3a, 0xff, 0x1a, 0x28, 0x41, 0xff, 0x34, 0x41, 0x5f, 0xff, 0x41, 0x52, 0x73, 0xff, 0x3d, 0x4d, 0x6a, 0xff, 0x66, 0x6c, 0x85, 0xff, 0xa7, 0xac, 0xbe, 0xff, 0x8e, 0x9b, 0xb0, 0xff, 0x5a, 0x64, 0x82, 0xff, 0x4f, 0x58, 0x70, 0xff, 0x4b, 0x5b, 0x72, 0xff, 0x31, 0x3d, 0x64, 0xff, 0xb0, 0xb5, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xe8, 0xec, 0xff, 0xb4, 0xbb, 0xc2, 0xff, 0xaf, 0xb5, 0xc3, 0xff, 0x82, 0x87, 0x96, 0xff, 0xda, 0xd9, 0xdc, 0xff, 0xcf, 0xd0, 0xd9, 0xff, 0x38, 0x47, 0x51, 0xff, 0xe7, 0xea, 0xf6, 0xff, 0x9c, 0xa7, 0xc2, 0xff, 0x17, 0x1f, 0x33, 0xff, 0x7f, 0x88, 0x9c, 0xff, 0x51, 0x5c, 0x75, 0xff, 0x17, 0x1a, 0x30, 0xff, 0x21, 0x26, 0x3a, 0xff, 0x2b, 0x2e, 0x41, 0xff, 0x1a, 0x17, 0x22, 0xff, 0x03, 0x02, 0x06, 0xff, 0x12, 0x15, 0x1e, 0xff, 0x15, 0x1e, 0x2c, 0xff, 0x39, 0x49, 0x5b, 0xff, 0x5d, 0x66, 0x7f, 0xff, 0x57, 0x5f, 0x7a, 0xff, 0x2f, 0x39, 0x50, 0xff, 0x10, 0x18, 0x29, 0xff, 0x26, 0x2d, 0x3d, 0xff, 0x5a, 0x61, 0x74, 0xff, 0x33, 0x3a, 0x4d, 0xff, 0x3b, 0x41, 0x55, 0xff, 0x49, 0x50, 0x68, 0xff, 0x42, 0x4f, 0x6a, 0xff, 0x2a, 0x37, 0x4d, 0xff, 0x11, 0x13, 0x20, 0xff, 0x07, 0x05, 0x0b, 0xff, 0x00, 0x00, 0x02, 0xff, 0x01, 0x00, 0x00, 0xff, 0x0a, 0x0d, 0x1b, 0xff, 0x1f, 0x2c, 0x4b, 0xff, 0x28, 0x39, 0x5d, 0xff, 0x30, 0x42, 0x6d, 0xff, 0x36, 0x4b, 0x74, 0xff, 0x31, 0x47, 0x74, 0xff, 0x2f, 0x49, 0x77, 0xff, 0x48, 0x64, 0x98, 0xff, 0x6c, 0x8e, 0xc4, 0xff, 0x8a, 0xb0, 0xea, 0xff, 0x93, 0xba, 0xf4, 0xff, 0x91, 0xb7, 0xf1, 0xff, 0x89, 0xb1, 0xea, 0xff, 0x83, 0xa8, 0xe5, 0xff, 0x84, 0xa6, 0xe7, 0xff, 0x84, 0xa7, 0xe7, 0xff, 0x86, 0xa8, 0xe7, 0xff, 0x8e, 0xaf, 0xec, 0xff, 0x93, 0xb5, 0xf1, 0xff, 0x83, 0xa5, 0xe0, 0xff, 0x63, 0x83, 0xbd, 0xff, 0x4a, 0x6b, 0xa6, 0xff, 0x4b, 0x70, 0xac, 0xff, 0x5b, 0x81, 0xbc, 0xff, 0x65, 0x88, 0xbf, 0xff, 0x5f, 0x8f, 0xca, 0xff, 0x61, 0x8d, 0xcc, 0xff, 0x38, 0x47, 0x70, 0xff, 0x00, 0x00, 0x08, 0xff, 0x08, 0x0b, 0x16, 0xff, 0x19, 0x20, 0x2c, 0xff, 0x1c, 0x23, 0x32, 0xff, 0x1c, 0x20, 0x2c, 0xff, 0x10, 0x12, 0x1d, 0xff, 0x0b, 0x0e, 0x1a, 0xff, 0x05, 0x0c, 0x14, 0xff, 0x0c, 0x13, 0x23, 0xff, 0x23, 0x28, 0x40, 0xff, 0x22, 0x2a, 0x44, 0xff, 0x38, 0x44, 0x63, 0xff, 0x41, 0x4f, 0x72, 0xff, 0x4b, 0x54, 0x74, 0xff, 0x4f, 0x55, 0x6f, 0xff, 0x71, 0x75, 0x89, 0xff, 0x89, 0x92, 0xaa, 0xff, 0x7c, 0x88, 0xa6, 0xff, 0x43, 0x4e, 0x68, 0xff, 0x54, 0x5f, 0x7b, 0xff, 0x51, 0x58, 0x7b, 0xff, 0x71, 0x78, 0x8d, 0xff, 0xf8, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfe, 0xfe, 0xfc, 0xff, 0xfd, 0xfe, 0xfc, 0xff, 0xfc, 0xfd, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd9, 0xdd, 0xe1, 0xff, 0xd6, 0xdb, 0xe0, 0xff, 0xee, 0xf0, 0xf4, 0xff, 0xc6, 0xcb, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0x7d, 0x93, 0xff, 0x50, 0x5c, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0x85, 0xa3, 0xff, 0x29, 0x30, 0x45, 0xff, 0x3f, 0x47, 0x5a, 0xff, 0x1f, 0x2a, 0x43, 0xff, 0x18, 0x19, 0x30, 0xff, 0x1c, 0x20, 0x34, 0xff, 0x14, 0x18, 0x29, 0xff, 0x0d, 0x0a, 0x15, 0xff, 0x05, 0x05, 0x0e, 0xff, 0x20, 0x23, 0x31, 0xff, 0x2d, 0x35, 0x46, 0xff, 0x4d, 0x5d, 0x71, 0xff, 0x5d, 0x64, 0x7f, 0xff, 0x52, 0x5a, 0x76, 0xff, 0x2d, 0x37, 0x4f, 0xff, 0x1d, 0x26, 0x36, 0xff, 0x1d, 0x24, 0x35, 0xff, 0x54, 0x5b, 0x6e, 0xff, 0x34, 0x3b, 0x4e, 0xff, 0x37, 0x3d, 0x50, 0xff, 0x4f, 0x56, 0x6e, 0xff, 0x43, 0x50, 0x6e, 0xff, 0x2e, 0x3c, 0x53, 0xff, 0x10, 0x12, 0x1e, 0xff, 0x08, 0x06, 0x0c, 0xff, 0x00, 0x00, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x08, 0x0a, 0x19, 0xff, 0x1e, 0x2a, 0x4b, 0xff, 0x28, 0x39, 0x5d, 0xff, 0x30, 0x43, 0x6f, 0xff, 0x33, 0x4b, 0x74, 0xff, 0x36, 0x4d, 0x7a, 0xff, 0x3a, 0x54, 0x84, 0xff, 0x44, 0x5f, 0x93, 0xff, 0x45, 0x65, 0x9b, 0xff, 0x4b, 0x6f, 0xa6, 0xff, 0x61, 0x87, 0xc1, 0xff, 0x72, 0x98, 0xd2, 0xff, 0x6f, 0x94, 0xce, 0xff, 0x6f, 0x93, 0xce, 0xff, 0x6e, 0x92, 0xcf, 0xff, 0x6d, 0x91, 0xce, 0xff, 0x6c, 0x90, 0xcd, 0xff, 0x6d, 0x90, 0xcb, 0xff, 0x63, 0x88, 0xc2, 0xff, 0x53, 0x77, 0xb2, 0xff, 0x4d, 0x70, 0xac, 0xff, 0x59, 0x7e, 0xb9, 0xff, 0x60, 0x87, 0xc0, 0xff, 0x63, 0x8d, 0xc8, 0xff, 0x6a, 0x91, 0xc8, 0xff, 0x65, 0x95, 0xcf, 0xff, 0x63, 0x8b, 0xc7, 0xff, 0x2b, 0x34, 0x55, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x10, 0x1b, 0xff, 0x18, 0x1f, 0x2d, 0xff, 0x1c, 0x23, 0x32, 0xff, 0x14, 0x19, 0x25, 0xff, 0x10, 0x12, 0x1b, 0xff, 0x0e, 0x11, 0x1c, 0xff, 0x07, 0x0f, 0x18, 0xff, 0x0f, 0x17, 0x29, 0xff, 0x2a, 0x2f, 0x48, 0xff, 0x2f, 0x35, 0x4f, 0xff, 0x38, 0x44, 0x63, 0xff, 0x47, 0x55, 0x78, 0xff, 0x49, 0x53, 0x73, 0xff, 0x64, 0x6c, 0x87, 0xff, 0x6f, 0x75, 0x8a, 0xff, 0x58, 0x62, 0x79, 0xff, 0x72, 0x7d, 0x9b, 0xff, 0x4c, 0x57, 0x75, 0xff, 0x2d, 0x38, 0x53, 0xff, 0x7d, 0x83, 0x99, 0xff, 0x6a, 0x6c, 0x80, 0xff, 0xc5, 0xc8, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xe9, 0xeb, 0xef, 0xff, 0xef, 0xf0, 0xf3, 0xff, 0xf5, 0xf7, 0xf6, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xff, 0xff, 0x5d, 0x6c, 0x8d, 0xff, 0x6c, 0x77, 0x89, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x81, 0x9e, 0xff, 0x49, 0x51, 0x65, 0xff, 0x57, 0x5f, 0x73, 0xff, 0x27, 0x30, 0x4a, 0xff, 0x2b, 0x2a, 0x40, 0xff, 0x1b, 0x1f, 0x31, 0xff, 0x12, 0x1a, 0x29, 0xff, 0x09, 0x0a, 0x12, 0xff, 0x12, 0x12, 0x22, 0xff, 0x29, 0x2b, 0x41, 0xff, 0x3a, 0x40, 0x52, 0xff, 0x59, 0x67, 0x7d, 0xff, 0x56, 0x5a, 0x7a, 0xff, 0x53, 0x5a, 0x76, 0xff, 0x32, 0x3c, 0x53, 0xff, 0x20, 0x28, 0x38, 0xff, 0x19, 0x20, 0x31, 0xff, 0x43, 0x4a, 0x5f, 0xff, 0x38, 0x3f, 0x52, 0xff, 0x31, 0x38, 0x4b, 0xff, 0x52, 0x5a, 0x72, 0xff, 0x46, 0x53, 0x70, 0xff, 0x31, 0x3e, 0x54, 0xff, 0x14, 0x15, 0x20, 0xff, 0x07, 0x04, 0x0a, 0xff, 0x01, 0x02, 0x05, 0xff, 0x00, 0x00, 0x00, 0xff, 0x05, 0x06, 0x16, 0xff, 0x1c, 0x2a, 0x4b, 0xff, 0x29, 0x3b, 0x5e, 0xff, 0x31, 0x43, 0x70, 0xff, 0x36, 0x4f, 0x78, 0xff, 0x39, 0x51, 0x7e, 0xff, 0x3a, 0x53, 0x83, 0xff, 0x46, 0x62, 0x95, 0xff, 0x56, 0x77, 0xad, 0xff, 0x4d, 0x71, 0xaa, 0xff, 0x47, 0x6a, 0xa4, 0xff, 0x4c, 0x6e, 0xa9, 0xff, 0x51, 0x72, 0xae, 0xff, 0x57, 0x7a, 0xb4, 0xff, 0x56, 0x7c, 0xb4, 0xff, 0x58, 0x7d, 0xb5, 0xff, 0x59, 0x7e, 0xb7, 0xff, 0x56, 0x7d, 0xb7, 0xff, 0x57, 0x7e, 0xb8, 0xff, 0x5d, 0x84, 0xbe, 0xff, 0x62, 0x89, 0xc3, 0xff, 0x65, 0x8c, 0xc6, 0xff, 0x68, 0x92, 0xca, 0xff, 0x68, 0x96, 0xd2, 0xff, 0x69, 0x94, 0xcd, 0xff, 0x6b, 0x9e, 0xd5, 0xff, 0x51, 0x7c, 0xb1, 0xff, 0x0f, 0x15, 0x30, 0xff, 0x02, 0x03, 0x02, 0xff, 0x13, 0x16, 0x22, 0xff, 0x13, 0x1c, 0x2c, 0xff, 0x17, 0x1e, 0x2f, 0xff, 0x0c, 0x11, 0x1e, 0xff, 0x11, 0x12, 0x1b, 0xff, 0x0f, 0x11, 0x1c, 0xff, 0x0b, 0x14, 0x1b, 0xff, 0x13, 0x1b, 0x2b, 0xff, 0x37, 0x3a, 0x54, 0xff, 0x32, 0x38, 0x53, 0xff, 0x34, 0x40, 0x5f, 0xff, 0x51, 0x5f, 0x82, 0xff, 0x44, 0x52, 0x70, 0xff, 0x4c, 0x58, 0x73, 0xff, 0x6d, 0x79, 0x8b, 0xff, 0x50, 0x5b, 0x71, 0xff, 0x5a, 0x64, 0x82, 0xff, 0x62, 0x6d, 0x8b, 0xff, 0x35, 0x42, 0x5c, 0xff, 0x59, 0x68, 0x7e, 0xff, 0x62, 0x68, 0x85, 0xff, 0x60, 0x61, 0x7a, 0xff, 0xdf, 0xdd, 0xe4, 0xff, 0xf9, 0xf7, 0xf5, 0xff, 0xfe, 0xfe, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x46, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xfa, 0xfb, 0xfc, 0xff, 0xf8, 0xf9, 0xfa, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfa, 0xfb, 0xf9, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfa, 0xfd, 0xff, 0xff, 0x81, 0x96, 0xb3, 0xff, 0x9b, 0xa2, 0xb4, 0xff, 0xfd, 0xf9, 0xfd, 0xff, 0x88, 0x94, 0xab, 0xff, 0x5a, 0x60, 0x77, 0xff, 0x76, 0x80, 0x92, 0xff, 0x32, 0x3e, 0x59, 0xff, 0x32, 0x38, 0x50, 0xff, 0x25, 0x2c, 0x41, 0xff, 0x16, 0x20, 0x32, 0xff, 0x06, 0x0c, 0x1b, 0xff, 0x32, 0x38, 0x4b, 0xff, 0x30, 0x37, 0x4c, 0xff, 0x42, 0x4a, 0x5f, 0xff, 0x5b, 0x67, 0x82, 0xff, 0x52, 0x5c, 0x78, 0xff, 0x4f, 0x5a, 0x75, 0xff, 0x34, 0x3e, 0x56, 0xff, 0x21, 0x29, 0x3c, 0xff, 0x18, 0x1f, 0x30, 0xff, 0x35, 0x3c, 0x4c, 0xff, 0x45, 0x4c, 0x5e, 0xff, 0x28, 0x2d, 0x41, 0xff, 0x55, 0x5a, 0x73, 0xff, 0x51, 0x5c, 0x79, 0xff, 0x38, 0x46, 0x5e, 0xff, 0x14, 0x1b, 0x2a, 0xff, 0x02, 0x02, 0x09, 0xff, 0x01, 0x03, 0x05, 0xff, 0x00, 0x00, 0x02, 0xff, 0x04, 0x04, 0x11, 0xff, 0x1e, 0x2a, 0x44, 0xff, 0x2b, 0x3e, 0x60, 0xff, 0x35, 0x48, 0x71, 0xff, 0x3c, 0x51, 0x7a, 0xff, 0x3e, 0x55, 0x83, 0xff, 0x3f, 0x58, 0x89, 0xff, 0x44, 0x5e, 0x91, 0xff, 0x52, 0x6e, 0xa3, 0xff, 0x5e, 0x82, 0xb8, 0xff, 0x5a, 0x7f, 0xb9, 0xff, 0x59, 0x7c, 0xb8, 0xff, 0x5c, 0x7f, 0xba, 0xff, 0x5b, 0x80, 0xba, 0xff, 0x5a, 0x81, 0xb9, 0xff, 0x5e, 0x84, 0xbd, 0xff, 0x60, 0x85, 0xbe, 0xff, 0x63, 0x8a, 0xc4, 0xff, 0x65, 0x8c, 0xc6, 0xff, 0x64, 0x8c, 0xc6, 0xff, 0x6a, 0x90, 0xca, 0xff, 0x6e, 0x94, 0xce, 0xff, 0x72, 0x9e, 0xd7, 0xff, 0x6b, 0x99, 0xd2, 0xff, 0x69, 0x99, 0xd2, 0xff, 0x6f, 0x9f, 0xda, 0xff, 0x39, 0x58, 0x85, 0xff, 0x00, 0x00, 0x10, 0xff, 0x05, 0x09, 0x0b, 0xff, 0x17, 0x1a, 0x26, 0xff, 0x1e, 0x23, 0x2f, 0xff, 0x0e, 0x14, 0x1f, 0xff, 0x08, 0x0d, 0x18, 0xff, 0x14, 0x19, 0x24, 0xff, 0x0f, 0x15, 0x21, 0xff, 0x0b, 0x10, 0x1d, 0xff, 0x1a, 0x23, 0x34, 0xff, 0x36, 0x3e, 0x54, 0xff, 0x2e, 0x36, 0x4d, 0xff, 0x33, 0x41, 0x5c, 0xff, 0x56, 0x64, 0x89, 0xff, 0x46, 0x51, 0x74, 0xff, 0x31, 0x3e, 0x56, 0xff, 0x2a, 0x37, 0x4b, 0xff, 0x45, 0x51, 0x6c, 0xff, 0x59, 0x65, 0x84, 0xff, 0x60, 0x6c, 0x85, 0xff, 0x43, 0x4f, 0x66, 0xff, 0x42, 0x4f, 0x67, 0xff, 0x4b, 0x55, 0x72, 0xff, 0x20, 0x29, 0x45, 0xff, 0x65, 0x68, 0x7f, 0xff, 0x97, 0x96, 0xab, 0xff, 0xac, 0xad, 0xb8, 0xff, 0xf5, 0xf8, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x07, 0xfe, 0xfe, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xf5, 0xf5, 0xf4, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0x9a, 0xad, 0xc3, 0xff, 0xc7, 0xca, 0xdb, 0xff, 0xf6, 0xf4, 0xfc, 0xff, 0x8b, 0x91, 0xa4, 0xff, 0x6c, 0x71, 0x89, 0xff, 0x5c, 0x68, 0x7c, 0xff, 0x4d, 0x5a, 0x76, 0xff, 0x3b, 0x48, 0x63, 0xff, 0x21, 0x2d, 0x45, 0xff, 0x19, 0x23, 0x38, 0xff, 0x2a, 0x34, 0x49, 0xff, 0x4e, 0x58, 0x6d, 0xff, 0x34, 0x3f, 0x50, 0xff, 0x4e, 0x5a, 0x6f, 0xff, 0x5e, 0x68, 0x87, 0xff, 0x57, 0x67, 0x80, 0xff, 0x50, 0x5f, 0x77, 0xff, 0x38, 0x43, 0x5d, 0xff, 0x27, 0x30, 0x46, 0xff, 0x16, 0x1e, 0x2e, 0xff, 0x27, 0x2e, 0x3a, 0xff, 0x49, 0x50, 0x61, 0xff, 0x2d, 0x31, 0x45, 0xff, 0x55, 0x58, 0x71, 0xff, 0x54, 0x5f, 0x7c, 0xff, 0x44, 0x51, 0x6d, 0xff, 0x0f, 0x1b, 0x2e, 0xff, 0x00, 0x03, 0x0a, 0xff, 0x05, 0x07, 0x0a, 0xff, 0x00, 0x02, 0x0a, 0xff, 0x04, 0x04, 0x0e, 0xff, 0x1e, 0x26, 0x3a, 0xff, 0x29, 0x3d, 0x60, 0xff, 0x35, 0x48, 0x6e, 0xff, 0x40, 0x51, 0x7b, 0xff, 0x43, 0x5b, 0x89, 0xff, 0x3e, 0x59, 0x8a, 0xff, 0x41, 0x59, 0x8c, 0xff, 0x52, 0x6a, 0x9d, 0xff, 0x5c, 0x82, 0xb6, 0xff, 0x5e, 0x87, 0xc0, 0xff, 0x62, 0x88, 0xc3, 0xff, 0x60, 0x87, 0xc1, 0xff, 0x63, 0x89, 0xc3, 0xff, 0x64, 0x8a, 0xc4, 0xff, 0x65, 0x8b, 0xc6, 0xff, 0x67, 0x8d, 0xc7, 0xff, 0x67, 0x8d, 0xc7, 0xff, 0x6a, 0x8f, 0xc9, 0xff, 0x6f, 0x94, 0xce, 0xff, 0x73, 0x99, 0xd3, 0xff, 0x76, 0x9d, 0xd7, 0xff, 0x73, 0x9e, 0xd8, 0xff, 0x6e, 0x9b, 0xd2, 0xff, 0x73, 0xa2, 0xdc, 0xff, 0x62, 0x8a, 0xc6, 0xff, 0x1f, 0x2e, 0x54, 0xff, 0x01, 0x08, 0x12, 0xff, 0x0a, 0x12, 0x19, 0xff, 0x17, 0x1b, 0x26, 0xff, 0x24, 0x24, 0x2d, 0xff, 0x0c, 0x0f, 0x16, 0xff, 0x06, 0x0b, 0x15, 0xff, 0x13, 0x1c, 0x2a, 0xff, 0x0e, 0x17, 0x25, 0xff, 0x10, 0x12, 0x24, 0xff, 0x1c, 0x25, 0x38, 0xff, 0x2e, 0x3a, 0x4d, 0xff, 0x28, 0x30, 0x43, 0xff, 0x32, 0x40, 0x58, 0xff, 0x55, 0x61, 0x89, 0xff, 0x44, 0x4b, 0x72, 0xff, 0x37, 0x43, 0x5a, 0xff, 0x23, 0x30, 0x45, 0xff, 0x33, 0x3f, 0x5c, 0xff, 0x4e, 0x5a, 0x79, 0xff, 0x36, 0x42, 0x57, 0xff, 0x24, 0x2e, 0x40, 0xff, 0x32, 0x39, 0x4d, 0xff, 0x46, 0x4e, 0x61, 0xff, 0x3c, 0x44, 0x57, 0xff, 0x1f, 0x2c, 0x3e, 0xff, 0x47, 0x52, 0x6b, 0xff, 0x5a, 0x61, 0x7c, 0xff, 0x6e, 0x74, 0x82, 0xff, 0x9e, 0x9f, 0xa9, 0xff, 0xc2, 0xc5, 0xcb, 0xff, 0xe5, 0xeb, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xef, 0xfe, 0xfe, 0xfe, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xa5, 0xb3, 0xc9, 0xff, 0xdc, 0xe0, 0xea, 0xff, 0xe3, 0xe4, 0xee, 0xff, 0x8c, 0x95, 0xac, 0xff, 0x8c, 0x98, 0xac, 0xff, 0x36, 0x43, 0x5e, 0xff, 0x6b, 0x78, 0x95, 0xff, 0x4a, 0x56, 0x70, 0xff, 0x1d, 0x28, 0x3f, 0xff, 0x2a, 0x34, 0x48, 0xff, 0x59, 0x62, 0x75, 0xff, 0x4b, 0x52, 0x67, 0xff, 0x38, 0x42, 0x54, 0xff, 0x55, 0x60, 0x75, 0xff, 0x5c, 0x66, 0x85, 0xff, 0x54, 0x63, 0x7d, 0xff, 0x52, 0x5f, 0x79, 0xff, 0x3c, 0x47, 0x5f, 0xff, 0x32, 0x3c, 0x51, 0xff, 0x12, 0x19, 0x2a, 0xff, 0x0f, 0x17, 0x24, 0xff, 0x38, 0x3f, 0x50, 0xff, 0x37, 0x3c, 0x50, 0xff, 0x4d, 0x51, 0x6a, 0xff, 0x50, 0x5c, 0x79, 0xff, 0x4e, 0x5b, 0x76, 0xff, 0x20, 0x2a, 0x3c, 0xff, 0x05, 0x08, 0x0f, 0xff, 0x08, 0x09, 0x0c, 0xff, 0x05, 0x07, 0x0f, 0xff, 0x05, 0x05, 0x10, 0xff, 0x15, 0x1d, 0x34, 0xff, 0x23, 0x37, 0x5a, 0xff, 0x34, 0x47, 0x6d, 0xff, 0x41, 0x52, 0x7c, 0xff, 0x48, 0x5f, 0x8d, 0xff, 0x42, 0x5d, 0x8e, 0xff, 0x40, 0x59, 0x8c, 0xff, 0x4d, 0x67, 0x9a, 0xff, 0x58, 0x7e, 0xb2, 0xff, 0x60, 0x87, 0xc1, 0xff, 0x65, 0x8b, 0xc5, 0xff, 0x66, 0x8b, 0xc5, 0xff, 0x68, 0x8e, 0xc8, 0xff, 0x6a, 0x8f, 0xc9, 0xff, 0x6b, 0x91, 0xcb, 0xff, 0x6d, 0x93, 0xcd, 0xff, 0x70, 0x96, 0xd0, 0xff, 0x72, 0x98, 0xd2, 0xff, 0x76, 0x9c, 0xd6, 0xff, 0x7c, 0xa2, 0xdc, 0xff, 0x7c, 0xa2, 0xdd, 0xff, 0x70, 0x9b, 0xd4, 0xff, 0x70, 0x9e, 0xd8, 0xff, 0x75, 0xa2, 0xdd, 0xff, 0x4a, 0x67, 0x96, 0xff, 0x14, 0x1a, 0x39, 0xff, 0x0a, 0x0d, 0x21, 0xff, 0x12, 0x17, 0x27, 0xff, 0x16, 0x19, 0x25, 0xff, 0x12, 0x13, 0x1c, 0xff, 0x09, 0x0a, 0x16, 0xff, 0x11, 0x15, 0x23, 0xff, 0x18, 0x1f, 0x2f, 0xff, 0x0a, 0x12, 0x20, 0xff, 0x17, 0x19, 0x2a, 0xff, 0x19, 0x22, 0x34, 0xff, 0x34, 0x3f, 0x53, 0xff, 0x23, 0x2a, 0x3e, 0xff, 0x30, 0x3e, 0x57, 0xff, 0x50, 0x5d, 0x84, 0xff, 0x42, 0x4a, 0x71, 0xff, 0x36, 0x42, 0x5a, 0xff, 0x24, 0x32, 0x47, 0xff, 0x35, 0x40, 0x5a, 0xff, 0x41, 0x4b, 0x66, 0xff, 0x2e, 0x37, 0x4b, 0xff, 0x2d, 0x35, 0x45, 0xff, 0x12, 0x18, 0x2a, 0xff, 0x1a, 0x20, 0x33, 0xff, 0x3c, 0x42, 0x56, 0xff, 0x22, 0x2a, 0x36, 0xff, 0x10, 0x19, 0x22, 0xff, 0x2e, 0x38, 0x49, 0xff, 0x32, 0x38, 0x55, 0xff, 0x2f, 0x30, 0x4f, 0xff, 0x38, 0x3d, 0x52, 0xff, 0x52, 0x5a, 0x67, 0xff, 0x6c, 0x72, 0x7c, 0xff, 0x89, 0x8c, 0x94, 0xff, 0xc8, 0xca, 0xcd, 0xff, 0xee, 0xef, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xc6, 0xd8, 0xff, 0xe1, 0xe8, 0xf0, 0xff, 0xbb, 0xc2, 0xd0, 0xff, 0x63, 0x6f, 0x86, 0xff, 0x76, 0x84, 0x97, 0xff, 0x3d, 0x49, 0x67, 0xff, 0x69, 0x76, 0x91, 0xff, 0x52, 0x5e, 0x76, 0xff, 0x23, 0x2e, 0x43, 0xff, 0x42, 0x4b, 0x60, 0xff, 0x68, 0x71, 0x85, 0xff, 0x39, 0x42, 0x56, 0xff, 0x3e, 0x48, 0x5a, 0xff, 0x5e, 0x69, 0x7e, 0xff, 0x59, 0x63, 0x81, 0xff, 0x4e, 0x5c, 0x76, 0xff, 0x53, 0x60, 0x7a, 0xff, 0x3f, 0x4a, 0x63, 0xff, 0x37, 0x41, 0x56, 0xff, 0x15, 0x1c, 0x2e, 0xff, 0x09, 0x10, 0x1f, 0xff, 0x20, 0x27, 0x39, 0xff, 0x37, 0x3c, 0x50, 0xff, 0x48, 0x4d, 0x65, 0xff, 0x51, 0x5c, 0x78, 0xff, 0x48, 0x55, 0x70, 0xff, 0x33, 0x3e, 0x50, 0xff, 0x0a, 0x0e, 0x16, 0xff, 0x06, 0x07, 0x0b, 0xff, 0x06, 0x08, 0x10, 0xff, 0x06, 0x07, 0x13, 0xff, 0x0e, 0x17, 0x2d, 0xff, 0x20, 0x33, 0x56, 0xff, 0x35, 0x48, 0x6f, 0xff, 0x3f, 0x52, 0x7c, 0xff, 0x46, 0x5f, 0x8d, 0xff, 0x48, 0x64, 0x95, 0xff, 0x46, 0x5f, 0x91, 0xff, 0x4d, 0x66, 0x9a, 0xff, 0x57, 0x7b, 0xb0, 0xff, 0x64, 0x8c, 0xc5, 0xff, 0x6a, 0x90, 0xca, 0xff, 0x6b, 0x91, 0xcb, 0xff, 0x6e, 0x95, 0xcf, 0xff, 0x71, 0x97, 0xd1, 0xff, 0x72, 0x99, 0xd3, 0xff, 0x74, 0x9b, 0xd5, 0xff, 0x77, 0x9e, 0xd8, 0xff, 0x77, 0x9d, 0xd7, 0xff, 0x78, 0x9e, 0xd8, 0xff, 0x79, 0x9f, 0xd8, 0xff, 0x7c, 0xa2, 0xdb, 0xff, 0x73, 0x9e, 0xd7, 0xff, 0x74, 0xa2, 0xdf, 0xff, 0x66, 0x90, 0xca, 0xff, 0x37, 0x4b, 0x71, 0xff, 0x21, 0x22, 0x39, 0xff, 0x10, 0x12, 0x27, 0xff, 0x11, 0x16, 0x29, 0xff, 0x17, 0x1b, 0x25, 0xff, 0x08, 0x0c, 0x14, 0xff, 0x08, 0x0b, 0x17, 0xff, 0x1a, 0x1c, 0x2c, 0xff, 0x1c, 0x23, 0x36, 0xff, 0x15, 0x1e, 0x2d, 0xff, 0x1a, 0x1d, 0x2d, 0xff, 0x1a, 0x21, 0x34, 0xff, 0x35, 0x3f, 0x54, 0xff, 0x1c, 0x24, 0x38, 0xff, 0x30, 0x3f, 0x57, 0xff, 0x46, 0x53, 0x79, 0xff, 0x48, 0x50, 0x75, 0xff, 0x39, 0x45, 0x5d, 0xff, 0x2c, 0x3a, 0x50, 0xff, 0x3d, 0x48, 0x63, 0xff, 0x39, 0x42, 0x5a, 0xff, 0x21, 0x29, 0x3c, 0xff, 0x39, 0x40, 0x4f, 0xff, 0x0f, 0x13, 0x23, 0xff, 0x00, 0x04, 0x15, 0xff, 0x1c, 0x21, 0x33, 0xff, 0x37, 0x34, 0x47, 0xff, 0x15, 0x14, 0x1e, 0xff, 0x12, 0x16, 0x20, 0xff, 0x33, 0x37, 0x4a, 0xff, 0x3b, 0x43, 0x57, 0xff, 0x34, 0x3c, 0x50, 0xff, 0x33, 0x39, 0x4f, 0xff, 0x32, 0x3b, 0x53, 0xff, 0x2d, 0x37, 0x4a, 0xff, 0x3f, 0x4a, 0x56, 0xff, 0x50, 0x55, 0x5b, 0xff, 0x6a, 0x68, 0x69, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf7, 0xfb, 0xff, 0xa7, 0xb8, 0xc8, 0xff, 0x7c, 0x8b, 0x9f, 0xff, 0x7a, 0x83, 0x94, 0xff, 0xba, 0xc1, 0xd5, 0xff, 0x8c, 0x92, 0xa7, 0xff, 0x5d, 0x67, 0x7b, 0xff, 0x4f, 0x58, 0x6c, 0xff, 0x33, 0x3d, 0x51, 0xff, 0x56, 0x5d, 0x75, 0xff, 0x5e, 0x65, 0x7d, 0xff, 0x32, 0x3d, 0x4f, 0xff, 0x4a, 0x54, 0x66, 0xff, 0x63, 0x6a, 0x81, 0xff, 0x51, 0x5b, 0x75, 0xff, 0x50, 0x5c, 0x78, 0xff, 0x5b, 0x67, 0x84, 0xff, 0x40, 0x4a, 0x65, 0xff, 0x3d, 0x45, 0x5e, 0xff, 0x1b, 0x22, 0x36, 0xff, 0x0b, 0x12, 0x22, 0xff, 0x1c, 0x23, 0x34, 0xff, 0x31, 0x38, 0x48, 0xff, 0x40, 0x47, 0x59, 0xff, 0x5c, 0x62, 0x7d, 0xff, 0x4d, 0x57, 0x71, 0xff, 0x3a, 0x41, 0x5a, 0xff, 0x0d, 0x13, 0x26, 0xff, 0x06, 0x09, 0x10, 0xff, 0x0e, 0x0f, 0x1a, 0xff, 0x07, 0x0f, 0x20, 0xff, 0x0f, 0x18, 0x29, 0xff, 0x22, 0x34, 0x51, 0xff, 0x30, 0x47, 0x6f, 0xff, 0x3b, 0x55, 0x80, 0xff, 0x40, 0x5f, 0x90, 0xff, 0x49, 0x67, 0x99, 0xff, 0x4b, 0x67, 0x97, 0xff, 0x4a, 0x68, 0x9b, 0xff, 0x5a, 0x79, 0xae, 0xff, 0x6b, 0x8f, 0xc9, 0xff, 0x70, 0x96, 0xd1, 0xff, 0x6f, 0x99, 0xd2, 0xff, 0x72, 0x9c, 0xd5, 0xff, 0x76, 0x9d, 0xd7, 0xff, 0x77, 0x9f, 0xd9, 0xff, 0x79, 0xa1, 0xdb, 0xff, 0x78, 0xa0, 0xda, 0xff, 0x78, 0xa0, 0xda, 0xff, 0x78, 0xa1, 0xdb, 0xff, 0x7a, 0xa2, 0xd8, 0xff, 0x7d, 0xa4, 0xd7, 0xff, 0x79, 0xa0, 0xdb, 0xff, 0x78, 0xa1, 0xe0, 0xff, 0x50, 0x74, 0xa7, 0xff, 0x2a, 0x3d, 0x5b, 0xff, 0x1d, 0x27, 0x39, 0xff, 0x10, 0x18, 0x25, 0xff, 0x13, 0x1b, 0x26, 0xff, 0x17, 0x1f, 0x2b, 0xff, 0x07, 0x13, 0x1c, 0xff, 0x08, 0x11, 0x1a, 0xff, 0x20, 0x1e, 0x31, 0xff, 0x18, 0x1d, 0x37, 0xff, 0x19, 0x23, 0x35, 0xff, 0x13, 0x17, 0x22, 0xff, 0x25, 0x27, 0x3a, 0xff, 0x33, 0x3a, 0x50, 0xff, 0x12, 0x1c, 0x2e, 0xff, 0x33, 0x3d, 0x56, 0xff, 0x3e, 0x48, 0x67, 0xff, 0x42, 0x4a, 0x6a, 0xff, 0x37, 0x44, 0x5a, 0xff, 0x31, 0x3d, 0x59, 0xff, 0x3e, 0x4a, 0x69, 0xff, 0x2a, 0x32, 0x45, 0xff, 0x12, 0x17, 0x28, 0xff, 0x2b, 0x33, 0x45, 0xff, 0x15, 0x18, 0x23, 0xff, 0x0d, 0x11, 0x1c, 0xff, 0x11, 0x15, 0x21, 0xff, 0x1a, 0x1e, 0x29, 0xff, 0x20, 0x22, 0x2c, 0xff, 0x10, 0x0e, 0x17, 0xff, 0x10, 0x0f, 0x18, 0xff, 0x20, 0x23, 0x2b, 0xff, 0x25, 0x26, 0x30, 0xff, 0x24, 0x25, 0x30, 0xff, 0x28, 0x27, 0x33, 0xff, 0x32, 0x31, 0x3d, 0xff, 0x34, 0x35, 0x3f, 0xff, 0x22, 0x1f, 0x2d, 0xff, 0x1b, 0x15, 0x25, 0xff, 0x40, 0x3e, 0x44, 0xff, 0xcb, 0xcb, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xe8, 0xeb, 0xff, 0x9f, 0xa8, 0xb5, 0xff, 0xd4, 0xdc, 0xe3, 0xff, 0xe8, 0xec, 0xf3, 0xff, 0xe0, 0xe5, 0xf3, 0xff, 0xb6, 0xbd, 0xce, 0xff, 0x60, 0x69, 0x7d, 0xff, 0x4d, 0x56, 0x6a, 0xff, 0x31, 0x3a, 0x4e, 0xff, 0x4e, 0x55, 0x6e, 0xff, 0x4c, 0x53, 0x6b, 0xff, 0x2a, 0x34, 0x46, 0xff, 0x48, 0x51, 0x64, 0xff, 0x5b, 0x62, 0x7a, 0xff, 0x42, 0x4b, 0x65, 0xff, 0x4e, 0x5a, 0x76, 0xff, 0x59, 0x65, 0x82, 0xff, 0x38, 0x42, 0x5c, 0xff, 0x3f, 0x47, 0x60, 0xff, 0x19, 0x20, 0x34, 0xff, 0x0c, 0x13, 0x23, 0xff, 0x16, 0x1d, 0x2e, 0xff, 0x22, 0x29, 0x39, 0xff, 0x42, 0x49, 0x5a, 0xff, 0x5a, 0x5f, 0x7b, 0xff, 0x52, 0x5c, 0x76, 0xff, 0x41, 0x4a, 0x65, 0xff, 0x1f, 0x27, 0x3c, 0xff, 0x07, 0x0c, 0x14, 0xff, 0x10, 0x12, 0x1f, 0xff, 0x0d, 0x14, 0x26, 0xff, 0x12, 0x1b, 0x2c, 0xff, 0x20, 0x32, 0x4f, 0xff, 0x2d, 0x45, 0x6d, 0xff, 0x3c, 0x56, 0x80, 0xff, 0x44, 0x63, 0x93, 0xff, 0x4f, 0x6e, 0xa1, 0xff, 0x53, 0x70, 0xa3, 0xff, 0x4d, 0x6d, 0xa2, 0xff, 0x56, 0x77, 0xae, 0xff, 0x69, 0x8d, 0xc7, 0xff, 0x77, 0x9d, 0xd7, 0xff, 0x77, 0xa1, 0xdb, 0xff, 0x77, 0xa1, 0xda, 0xff, 0x77, 0x9f, 0xd9, 0xff, 0x78, 0xa0, 0xda, 0xff, 0x79, 0xa1, 0xdb, 0xff, 0x78, 0xa0, 0xda, 0xff, 0x78, 0xa0, 0xda, 0xff, 0x79, 0xa1, 0xdc, 0xff, 0x7b, 0xa5, 0xdd, 0xff, 0x7b, 0xa4, 0xda, 0xff, 0x7b, 0xa2, 0xdb, 0xff, 0x6e, 0x92, 0xcc, 0xff, 0x32, 0x4f, 0x7c, 0xff, 0x26, 0x34, 0x50, 0xff, 0x27, 0x31, 0x44, 0xff, 0x12, 0x1a, 0x29, 0xff, 0x15, 0x1c, 0x2a, 0xff, 0x16, 0x1d, 0x2d, 0xff, 0x09, 0x11, 0x1f, 0xff, 0x11, 0x17, 0x27, 0xff, 0x24, 0x28, 0x3c, 0xff, 0x22, 0x26, 0x3d, 0xff, 0x15, 0x1d, 0x2e, 0xff, 0x0b, 0x0f, 0x1b, 0xff, 0x2e, 0x31, 0x45, 0xff, 0x2c, 0x33, 0x47, 0xff, 0x0c, 0x17, 0x26, 0xff, 0x33, 0x3e, 0x55, 0xff, 0x2f, 0x3b, 0x56, 0xff, 0x32, 0x40, 0x5a, 0xff, 0x3a, 0x47, 0x60, 0xff, 0x35, 0x3f, 0x5a, 0xff, 0x36, 0x3f, 0x58, 0xff, 0x12, 0x16, 0x25, 0xff, 0x0e, 0x0e, 0x1a, 0xff, 0x1d, 0x22, 0x31, 0xff, 0x13, 0x17, 0x22, 0xff, 0x14, 0x18, 0x23, 0xff, 0x19, 0x1d, 0x28, 0xff, 0x0e, 0x14, 0x1d, 0xff, 0x17, 0x1a, 0x24, 0xff, 0x17, 0x16, 0x20, 0xff, 0x15, 0x14, 0x1e, 0xff, 0x17, 0x17, 0x21, 0xff, 0x1b, 0x1c, 0x25, 0xff, 0x1d, 0x1d, 0x27, 0xff, 0x1f, 0x1e, 0x25, 0xff, 0x21, 0x20, 0x27, 0xff, 0x27, 0x26, 0x2d, 0xff, 0x2a, 0x28, 0x31, 0xff, 0x33, 0x30, 0x39, 0xff, 0x23, 0x22, 0x27, 0xff, 0x33, 0x32, 0x33, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfa, 0xfc, 0xff, 0xe5, 0xe5, 0xe9, 0xff, 0xf4, 0xf6, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xeb, 0xef, 0xf5, 0xff, 0xbe, 0xc6, 0xd6, 0xff, 0x63, 0x6d, 0x82, 0xff, 0x41, 0x4a, 0x5e, 0xff, 0x33, 0x3d, 0x52, 0xff, 0x33, 0x3a, 0x53, 0xff, 0x3c, 0x43, 0x5b, 0xff, 0x21, 0x2b, 0x3d, 0xff, 0x2e, 0x37, 0x49, 0xff, 0x4e, 0x55, 0x6d, 0xff, 0x44, 0x4d, 0x67, 0xff, 0x49, 0x55, 0x71, 0xff, 0x57, 0x64, 0x80, 0xff, 0x38, 0x42, 0x5d, 0xff, 0x31, 0x38, 0x52, 0xff, 0x18, 0x1d, 0x32, 0xff, 0x13, 0x1a, 0x2a, 0xff, 0x12, 0x19, 0x2b, 0xff, 0x1b, 0x21, 0x31, 0xff, 0x36, 0x3c, 0x4e, 0xff, 0x45, 0x4b, 0x68, 0xff, 0x47, 0x51, 0x6b, 0xff, 0x43, 0x4e, 0x6a, 0xff, 0x29, 0x34, 0x4c, 0xff, 0x12, 0x19, 0x23, 0xff, 0x19, 0x1b, 0x2a, 0xff, 0x13, 0x1a, 0x2b, 0xff, 0x15, 0x1d, 0x2e, 0xff, 0x1c, 0x2f, 0x4b, 0xff, 0x28, 0x41, 0x69, 0xff, 0x3b, 0x56, 0x80, 0xff, 0x48, 0x66, 0x95, 0xff, 0x54, 0x74, 0xa7, 0xff, 0x5c, 0x7a, 0xb0, 0xff, 0x5a, 0x7a, 0xb2, 0xff, 0x60, 0x84, 0xbe, 0xff, 0x6e, 0x92, 0xcc, 0xff, 0x76, 0x9b, 0xd5, 0xff, 0x78, 0xa2, 0xdc, 0xff, 0x7a, 0xa4, 0xdd, 0xff, 0x7a, 0xa2, 0xdc, 0xff, 0x7a, 0xa2, 0xdc, 0xff, 0x7a, 0xa2, 0xdc, 0xff, 0x79, 0xa1, 0xdb, 0xff, 0x79, 0xa1, 0xdb, 0xff, 0x7b, 0xa2, 0xdc, 0xff, 0x79, 0xa5, 0xe1, 0xff, 0x79, 0xa4, 0xe0, 0xff, 0x7d, 0xa4, 0xdc, 0xff, 0x5a, 0x7c, 0xb1, 0xff, 0x24, 0x38, 0x5e, 0xff, 0x2b, 0x33, 0x4b, 0xff, 0x34, 0x39, 0x4f, 0xff, 0x20, 0x26, 0x39, 0xff, 0x1a, 0x21, 0x31, 0xff, 0x14, 0x1b, 0x2b, 0xff, 0x16, 0x18, 0x2a, 0xff, 0x29, 0x2a, 0x42, 0xff, 0x29, 0x32, 0x48, 0xff, 0x2b, 0x2d, 0x42, 0xff, 0x0c, 0x12, 0x23, 0xff, 0x0c, 0x11, 0x1c, 0xff, 0x21, 0x24, 0x37, 0xff, 0x19, 0x21, 0x35, 0xff, 0x09, 0x15, 0x21, 0xff, 0x32, 0x3e, 0x51, 0xff, 0x1f, 0x2d, 0x45, 0xff, 0x20, 0x36, 0x48, 0xff, 0x39, 0x46, 0x62, 0xff, 0x34, 0x3b, 0x54, 0xff, 0x1f, 0x24, 0x36, 0xff, 0x10, 0x10, 0x1a, 0xff, 0x0f, 0x0a, 0x10, 0xff, 0x13, 0x13, 0x1e, 0xff, 0x10, 0x15, 0x21, 0xff, 0x09, 0x0d, 0x19, 0xff, 0x23, 0x27, 0x34, 0xff, 0x1f, 0x25, 0x2f, 0xff, 0x12, 0x15, 0x1f, 0xff, 0x15, 0x15, 0x20, 0xff, 0x1b, 0x19, 0x24, 0xff, 0x18, 0x19, 0x24, 0xff, 0x1c, 0x1d, 0x27, 0xff, 0x1e, 0x1f, 0x2a, 0xff, 0x1b, 0x1c, 0x21, 0xff, 0x20, 0x21, 0x24, 0xff, 0x22, 0x23, 0x27, 0xff, 0x23, 0x23, 0x25, 0xff, 0x2d, 0x2c, 0x2b, 0xff, 0x32, 0x30, 0x32, 0xff, 0x25, 0x23, 0x26, 0xff, 0x24, 0x24, 0x24, 0xff, 0x9f, 0x9f, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xe7, 0xed, 0xf7, 0xff, 0x86, 0x8c, 0x9f, 0xff, 0x25, 0x2e, 0x42, 0xff, 0x5f, 0x64, 0x72, 0xff, 0x48, 0x50, 0x65, 0xff, 0x22, 0x2f, 0x48, 0xff, 0x20, 0x2b, 0x3f, 0xff, 0x26, 0x2f, 0x43, 0xff, 0x3c, 0x45, 0x5b, 0xff, 0x3f, 0x4a, 0x62, 0xff, 0x3b, 0x44, 0x60, 0xff, 0x52, 0x5a, 0x7b, 0xff, 0x33, 0x3c, 0x59, 0xff, 0x33, 0x3e, 0x54, 0xff, 0x1b, 0x24, 0x37, 0xff, 0x11, 0x1a, 0x29, 0xff, 0x10, 0x1a, 0x27, 0xff, 0x13, 0x1c, 0x2e, 0xff, 0x1d, 0x25, 0x38, 0xff, 0x33, 0x38, 0x4d, 0xff, 0x40, 0x46, 0x61, 0xff, 0x3e, 0x46, 0x65, 0xff, 0x3a, 0x42, 0x5c, 0xff, 0x16, 0x20, 0x2e, 0xff, 0x1a, 0x23, 0x2f, 0xff, 0x15, 0x1b, 0x2d, 0xff, 0x10, 0x1c, 0x2e, 0xff, 0x1d, 0x2c, 0x4b, 0xff, 0x31, 0x44, 0x6b, 0xff, 0x3e, 0x53, 0x81, 0xff, 0x4b, 0x66, 0x98, 0xff, 0x56, 0x78, 0xab, 0xff, 0x57, 0x7d, 0xb3, 0xff, 0x5f, 0x85, 0xbc, 0xff, 0x6c, 0x93, 0xca, 0xff, 0x74, 0x9b, 0xd5, 0xff, 0x76, 0x9d, 0xd8, 0xff, 0x78, 0xa1, 0xdb, 0xff, 0x7b, 0xa3, 0xdd, 0xff, 0x7b, 0xa3, 0xdc, 0xff, 0x7a, 0xa1, 0xdb, 0xff, 0x79, 0xa1, 0xdb, 0xff, 0x78, 0xa2, 0xdb, 0xff, 0x7a, 0xa4, 0xdd, 0xff, 0x7a, 0xa4, 0xde, 0xff, 0x79, 0xa5, 0xde, 0xff, 0x79, 0xa6, 0xe0, 0xff, 0x75, 0x9c, 0xd6, 0xff, 0x4a, 0x63, 0x96, 0xff, 0x28, 0x30, 0x5a, 0xff, 0x20, 0x28, 0x45, 0xff, 0x27, 0x2f, 0x44, 0xff, 0x25, 0x2c, 0x3e, 0xff, 0x15, 0x1c, 0x2d, 0xff, 0x13, 0x1c, 0x2c, 0xff, 0x2c, 0x33, 0x48, 0xff, 0x32, 0x38, 0x52, 0xff, 0x2b, 0x35, 0x48, 0xff, 0x16, 0x1c, 0x2c, 0xff, 0x00, 0x03, 0x0e, 0xff, 0x0b, 0x0e, 0x1b, 0xff, 0x15, 0x15, 0x2b, 0xff, 0x13, 0x18, 0x2a, 0xff, 0x15, 0x1f, 0x2c, 0xff, 0x2b, 0x36, 0x4b, 0xff, 0x09, 0x18, 0x2c, 0xff, 0x1b, 0x29, 0x41, 0xff, 0x2e, 0x39, 0x5a, 0xff, 0x22, 0x29, 0x41, 0xff, 0x05, 0x09, 0x14, 0xff, 0x09, 0x09, 0x12, 0xff, 0x0b, 0x0b, 0x12, 0xff, 0x08, 0x08, 0x12, 0xff, 0x0c, 0x0c, 0x16, 0xff, 0x08, 0x09, 0x10, 0xff, 0x16, 0x19, 0x1e, 0xff, 0x20, 0x22, 0x27, 0xff, 0x1d, 0x1f, 0x25, 0xff, 0x16, 0x16, 0x1d, 0xff, 0x12, 0x12, 0x18, 0xff, 0x14, 0x15, 0x1b, 0xff, 0x12, 0x13, 0x19, 0xff, 0x1b, 0x1c, 0x23, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x24, 0x25, 0x28, 0xff, 0x25, 0x26, 0x27, 0xff, 0x2a, 0x2a, 0x2d, 0xff, 0x2e, 0x2e, 0x32, 0xff, 0x24, 0x25, 0x27, 0xff, 0x23, 0x23, 0x26, 0xff, 0xa1, 0xa2, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfc, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfd, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf5, 0xf9, 0xff, 0xcf, 0xd7, 0xe7, 0xff, 0x3a, 0x47, 0x5e, 0xff, 0x33, 0x3b, 0x4a, 0xff, 0x51, 0x5b, 0x6b, 0xff, 0x14, 0x21, 0x36, 0xff, 0x10, 0x1a, 0x2e, 0xff, 0x21, 0x2d, 0x41, 0xff, 0x2a, 0x35, 0x48, 0xff, 0x3a, 0x45, 0x5a, 0xff, 0x2e, 0x38, 0x51, 0xff, 0x40, 0x46, 0x66, 0xff, 0x2c, 0x35, 0x51, 0xff, 0x39, 0x45, 0x59, 0xff, 0x26, 0x31, 0x44, 0xff, 0x04, 0x0f, 0x1f, 0xff, 0x09, 0x16, 0x21, 0xff, 0x14, 0x1f, 0x33, 0xff, 0x13, 0x1d, 0x31, 0xff, 0x28, 0x2c, 0x3b, 0xff, 0x41, 0x46, 0x5d, 0xff, 0x2f, 0x36, 0x54, 0xff, 0x35, 0x3b, 0x55, 0xff, 0x2c, 0x36, 0x49, 0xff, 0x16, 0x21, 0x31, 0xff, 0x05, 0x0c, 0x1f, 0xff, 0x16, 0x24, 0x38, 0xff, 0x23, 0x30, 0x4f, 0xff, 0x37, 0x46, 0x6e, 0xff, 0x43, 0x57, 0x89, 0xff, 0x4c, 0x66, 0x9c, 0xff, 0x57, 0x7b, 0xae, 0xff, 0x5d, 0x88, 0xbd, 0xff, 0x69, 0x92, 0xc7, 0xff, 0x74, 0x9c, 0xd0, 0xff, 0x79, 0xa1, 0xdb, 0xff, 0x7c, 0xa4, 0xde, 0xff, 0x7e, 0xa5, 0xe0, 0xff, 0x7d, 0xa5, 0xdf, 0xff, 0x7d, 0xa5, 0xdf, 0xff, 0x7b, 0xa3, 0xdd, 0xff, 0x7b, 0xa3, 0xdd, 0xff, 0x79, 0xa4, 0xdd, 0xff, 0x7a, 0xa6, 0xdf, 0xff, 0x79, 0xa4, 0xde, 0xff, 0x7a, 0xa6, 0xdc, 0xff, 0x75, 0xa3, 0xdb, 0xff, 0x63, 0x8a, 0xc4, 0xff, 0x39, 0x4f, 0x80, 0xff, 0x27, 0x2c, 0x57, 0xff, 0x19, 0x22, 0x44, 0xff, 0x1a, 0x26, 0x3b, 0xff, 0x27, 0x2e, 0x44, 0xff, 0x1e, 0x23, 0x3b, 0xff, 0x21, 0x2c, 0x42, 0xff, 0x2a, 0x37, 0x50, 0xff, 0x25, 0x31, 0x4c, 0xff, 0x1d, 0x25, 0x39, 0xff, 0x08, 0x10, 0x1f, 0xff, 0x01, 0x07, 0x12, 0xff, 0x01, 0x05, 0x14, 0xff, 0x1a, 0x1b, 0x32, 0xff, 0x10, 0x13, 0x27, 0xff, 0x26, 0x2b, 0x41, 0xff, 0x29, 0x2e, 0x4c, 0xff, 0x0d, 0x17, 0x2d, 0xff, 0x24, 0x2b, 0x45, 0xff, 0x1a, 0x24, 0x41, 0xff, 0x0c, 0x13, 0x27, 0xff, 0x07, 0x08, 0x12, 0xff, 0x06, 0x07, 0x10, 0xff, 0x07, 0x0a, 0x14, 0xff, 0x07, 0x08, 0x13, 0xff, 0x0f, 0x0d, 0x15, 0xff, 0x10, 0x0f, 0x13, 0xff, 0x11, 0x13, 0x12, 0xff, 0x13, 0x13, 0x15, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1a, 0x1b, 0x1e, 0xff, 0x16, 0x18, 0x1b, 0xff, 0x15, 0x16, 0x19, 0xff, 0x12, 0x13, 0x16, 0xff, 0x13, 0x14, 0x17, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x23, 0x24, 0x28, 0xff, 0x21, 0x22, 0x26, 0xff, 0x23, 0x25, 0x29, 0xff, 0x2c, 0x2d, 0x32, 0xff, 0x26, 0x27, 0x2c, 0xff, 0x26, 0x27, 0x2b, 0xff, 0x2e, 0x2f, 0x34, 0xff, 0x26, 0x27, 0x2c, 0xff, 0x2c, 0x2d, 0x32, 0xff, 0xcd, 0xce, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfc, 0xff, 0xfd, 0xfd, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf2, 0xf1, 0xf1, 0xff, 0xfa, 0xfe, 0xff, 0xff, 0xbd, 0xca, 0xd9, 0xff, 0x30, 0x3d, 0x4e, 0xff, 0x52, 0x58, 0x63, 0xff, 0x54, 0x5b, 0x67, 0xff, 0x12, 0x1e, 0x30, 0xff, 0x1a, 0x28, 0x3a, 0xff, 0x1c, 0x29, 0x39, 0xff, 0x2e, 0x39, 0x4d, 0xff, 0x29, 0x34, 0x4a, 0xff, 0x26, 0x31, 0x47, 0xff, 0x1e, 0x29, 0x3e, 0xff, 0x33, 0x3f, 0x52, 0xff, 0x40, 0x4a, 0x61, 0xff, 0x19, 0x21, 0x36, 0xff, 0x11, 0x1b, 0x2a, 0xff, 0x19, 0x21, 0x39, 0xff, 0x1f, 0x29, 0x3f, 0xff, 0x18, 0x1e, 0x2d, 0xff, 0x2c, 0x36, 0x44, 0xff, 0x28, 0x31, 0x48, 0xff, 0x1d, 0x23, 0x3e, 0xff, 0x33, 0x3a, 0x54, 0xff, 0x22, 0x29, 0x40, 0xff, 0x09, 0x0f, 0x1f, 0xff, 0x1b, 0x2a, 0x3a, 0xff, 0x28, 0x35, 0x53, 0xff, 0x32, 0x43, 0x6e, 0xff, 0x45, 0x5c, 0x91, 0xff, 0x53, 0x6f, 0xa8, 0xff, 0x60, 0x85, 0xb9, 0xff, 0x6f, 0x98, 0xcc, 0xff, 0x79, 0xa0, 0xd6, 0xff, 0x7e, 0xa6, 0xdb, 0xff, 0x80, 0xa9, 0xdf, 0xff, 0x83, 0xac, 0xe3, 0xff, 0x85, 0xad, 0xe3, 0xff, 0x83, 0xaa, 0xe4, 0xff, 0x81, 0xa8, 0xe3, 0xff, 0x81, 0xa8, 0xe2, 0xff, 0x7f, 0xa7, 0xe0, 0xff, 0x7c, 0xa6, 0xdf, 0xff, 0x7c, 0xa7, 0xdf, 0xff, 0x7b, 0xa5, 0xdf, 0xff, 0x78, 0xa4, 0xd9, 0xff, 0x6f, 0x9d, 0xd5, 0xff, 0x57, 0x7e, 0xb8, 0xff, 0x2d, 0x47, 0x77, 0xff, 0x1f, 0x2c, 0x51, 0xff, 0x17, 0x24, 0x43, 0xff, 0x13, 0x20, 0x37, 0xff, 0x1f, 0x25, 0x43, 0xff, 0x27, 0x2b, 0x4d, 0xff, 0x22, 0x2c, 0x4b, 0xff, 0x20, 0x2b, 0x4b, 0xff, 0x1f, 0x28, 0x4a, 0xff, 0x19, 0x22, 0x3e, 0xff, 0x15, 0x1d, 0x33, 0xff, 0x07, 0x0f, 0x1c, 0xff, 0x0e, 0x14, 0x23, 0xff, 0x29, 0x2d, 0x48, 0xff, 0x1d, 0x23, 0x3d, 0xff, 0x2e, 0x35, 0x4c, 0xff, 0x2a, 0x2d, 0x48, 0xff, 0x1e, 0x21, 0x34, 0xff, 0x1e, 0x24, 0x3a, 0xff, 0x08, 0x16, 0x23, 0xff, 0x02, 0x09, 0x15, 0xff, 0x0c, 0x0a, 0x17, 0xff, 0x09, 0x0a, 0x14, 0xff, 0x09, 0x0a, 0x15, 0xff, 0x07, 0x07, 0x12, 0xff, 0x0f, 0x0e, 0x18, 0xff, 0x14, 0x15, 0x1a, 0xff, 0x0e, 0x10, 0x10, 0xff, 0x11, 0x12, 0x15, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x12, 0x13, 0x17, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x20, 0x21, 0x25, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x20, 0x21, 0x25, 0xff, 0x20, 0x21, 0x25, 0xff, 0x26, 0x27, 0x2b, 0xff, 0x28, 0x29, 0x2d, 0xff, 0x25, 0x26, 0x2a, 0xff, 0x29, 0x2a, 0x2e, 0xff, 0x31, 0x32, 0x36, 0xff, 0x23, 0x24, 0x29, 0xff, 0x4c, 0x4c, 0x4f, 0xff, 0xf0, 0xef, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x51, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf9, 0xff, 0xf8, 0xf6, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xd2, 0xdb, 0xff, 0xcc, 0xce, 0xd1, 0xff, 0xd5, 0xda, 0xdd, 0xff, 0x93, 0x9e, 0xac, 0xff, 0x48, 0x57, 0x68, 0xff, 0x19, 0x26, 0x36, 0xff, 0x29, 0x36, 0x49, 0xff, 0x27, 0x32, 0x47, 0xff, 0x1b, 0x25, 0x39, 0xff, 0x1a, 0x24, 0x38, 0xff, 0x1d, 0x27, 0x3c, 0xff, 0x3f, 0x48, 0x60, 0xff, 0x3c, 0x44, 0x58, 0xff, 0x27, 0x31, 0x43, 0xff, 0x1e, 0x26, 0x40, 0xff, 0x26, 0x2d, 0x44, 0xff, 0x10, 0x12, 0x1c, 0xff, 0x0d, 0x16, 0x1b, 0xff, 0x29, 0x37, 0x4a, 0xff, 0x1e, 0x26, 0x3f, 0xff, 0x24, 0x2a, 0x44, 0xff, 0x23, 0x2c, 0x48, 0xff, 0x1d, 0x2a, 0x3d, 0xff, 0x18, 0x26, 0x3c, 0xff, 0x1f, 0x30, 0x52, 0xff, 0x34, 0x46, 0x72, 0xff, 0x56, 0x6e, 0xa3, 0xff, 0x64, 0x86, 0xbf, 0xff, 0x6c, 0x95, 0xcb, 0xff, 0x7b, 0xa5, 0xda, 0xff, 0x83, 0xac, 0xe1, 0xff, 0x87, 0xb0, 0xe4, 0xff, 0x88, 0xb1, 0xe6, 0xff, 0x87, 0xb2, 0xe7, 0xff, 0x86, 0xb3, 0xe6, 0xff, 0x84, 0xae, 0xe5, 0xff, 0x81, 0xa9, 0xe3, 0xff, 0x80, 0xa9, 0xe4, 0xff, 0x80, 0xa9, 0xe3, 0xff, 0x7e, 0xa9, 0xe2, 0xff, 0x7b, 0xa7, 0xe1, 0xff, 0x78, 0xa4, 0xde, 0xff, 0x77, 0xa3, 0xdb, 0xff, 0x6e, 0x9b, 0xd5, 0xff, 0x54, 0x79, 0xb4, 0xff, 0x2e, 0x45, 0x75, 0xff, 0x1f, 0x2d, 0x4e, 0xff, 0x1a, 0x26, 0x46, 0xff, 0x19, 0x24, 0x42, 0xff, 0x22, 0x2b, 0x4e, 0xff, 0x2c, 0x34, 0x5b, 0xff, 0x2d, 0x37, 0x5d, 0xff, 0x23, 0x30, 0x55, 0xff, 0x1f, 0x2b, 0x4e, 0xff, 0x22, 0x2d, 0x4c, 0xff, 0x16, 0x20, 0x3b, 0xff, 0x0b, 0x13, 0x27, 0xff, 0x1e, 0x29, 0x3f, 0xff, 0x2e, 0x34, 0x50, 0xff, 0x23, 0x29, 0x3d, 0xff, 0x27, 0x31, 0x3f, 0xff, 0x17, 0x1b, 0x28, 0xff, 0x05, 0x06, 0x0e, 0xff, 0x10, 0x12, 0x27, 0xff, 0x10, 0x1b, 0x24, 0xff, 0x08, 0x0f, 0x16, 0xff, 0x08, 0x09, 0x13, 0xff, 0x0a, 0x0b, 0x13, 0xff, 0x0d, 0x0e, 0x17, 0xff, 0x0b, 0x0b, 0x14, 0xff, 0x14, 0x13, 0x1b, 0xff, 0x13, 0x13, 0x18, 0xff, 0x0a, 0x0c, 0x0d, 0xff, 0x0f, 0x10, 0x13, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x22, 0x23, 0x27, 0xff, 0x25, 0x26, 0x2a, 0xff, 0x23, 0x24, 0x27, 0xff, 0x29, 0x2a, 0x2e, 0xff, 0x22, 0x23, 0x27, 0xff, 0x21, 0x22, 0x26, 0xff, 0x28, 0x29, 0x2d, 0xff, 0x2e, 0x30, 0x34, 0xff, 0x1f, 0x1e, 0x23, 0xff, 0x91, 0x90, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfd, 0xfc, 0xfd, 0xff, 0xfa, 0xf9, 0xf9, 0xff, 0xf5, 0xf4, 0xf5, 0xff, 0xfb, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xbc, 0xc5, 0xff, 0x4a, 0x54, 0x62, 0xff, 0x10, 0x1b, 0x2c, 0xff, 0x1e, 0x27, 0x3d, 0xff, 0x22, 0x2b, 0x42, 0xff, 0x17, 0x1b, 0x34, 0xff, 0x19, 0x1c, 0x36, 0xff, 0x17, 0x1a, 0x35, 0xff, 0x33, 0x38, 0x4d, 0xff, 0x4e, 0x56, 0x66, 0xff, 0x33, 0x3e, 0x50, 0xff, 0x1b, 0x28, 0x3e, 0xff, 0x15, 0x1e, 0x32, 0xff, 0x09, 0x0b, 0x13, 0xff, 0x01, 0x06, 0x0b, 0xff, 0x1c, 0x2c, 0x3e, 0xff, 0x20, 0x2a, 0x3c, 0xff, 0x1b, 0x1d, 0x30, 0xff, 0x1e, 0x27, 0x42, 0xff, 0x23, 0x2f, 0x42, 0xff, 0x1f, 0x21, 0x3b, 0xff, 0x19, 0x23, 0x41, 0xff, 0x24, 0x32, 0x5b, 0xff, 0x43, 0x5d, 0x8e, 0xff, 0x6c, 0x96, 0xcb, 0xff, 0x80, 0xab, 0xe3, 0xff, 0x88, 0xb3, 0xe7, 0xff, 0x8b, 0xb6, 0xe7, 0xff, 0x8d, 0xb6, 0xe6, 0xff, 0x8f, 0xb6, 0xea, 0xff, 0x8a, 0xb4, 0xe8, 0xff, 0x84, 0xb5, 0xe8, 0xff, 0x84, 0xb2, 0xe6, 0xff, 0x85, 0xb0, 0xe5, 0xff, 0x7e, 0xac, 0xe5, 0xff, 0x7c, 0xab, 0xe6, 0xff, 0x7d, 0xac, 0xe6, 0xff, 0x7a, 0xa8, 0xe3, 0xff, 0x78, 0xa5, 0xe0, 0xff, 0x75, 0xa4, 0xdd, 0xff, 0x6d, 0x9b, 0xd8, 0xff, 0x5b, 0x7e, 0xbb, 0xff, 0x3e, 0x54, 0x83, 0xff, 0x2c, 0x3c, 0x5d, 0xff, 0x25, 0x2e, 0x55, 0xff, 0x25, 0x33, 0x5d, 0xff, 0x41, 0x54, 0x7f, 0xff, 0x46, 0x57, 0x83, 0xff, 0x3e, 0x4e, 0x7b, 0xff, 0x31, 0x44, 0x6e, 0xff, 0x28, 0x3c, 0x61, 0xff, 0x28, 0x39, 0x5c, 0xff, 0x2b, 0x3a, 0x5b, 0xff, 0x2b, 0x3a, 0x5d, 0xff, 0x3a, 0x4c, 0x70, 0xff, 0x21, 0x2a, 0x3d, 0xff, 0x0f, 0x14, 0x1b, 0xff, 0x0f, 0x16, 0x20, 0xff, 0x03, 0x05, 0x0e, 0xff, 0x02, 0x00, 0x0a, 0xff, 0x14, 0x13, 0x27, 0xff, 0x15, 0x17, 0x27, 0xff, 0x0a, 0x0f, 0x17, 0xff, 0x08, 0x0c, 0x10, 0xff, 0x0c, 0x0c, 0x0e, 0xff, 0x0c, 0x0d, 0x10, 0xff, 0x0d, 0x0e, 0x12, 0xff, 0x10, 0x12, 0x15, 0xff, 0x10, 0x11, 0x15, 0xff, 0x10, 0x11, 0x15, 0xff, 0x14, 0x15, 0x19, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x13, 0x14, 0x18, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x23, 0x24, 0x28, 0xff, 0x20, 0x21, 0x25, 0xff, 0x26, 0x27, 0x2a, 0xff, 0x27, 0x29, 0x2a, 0xff, 0x24, 0x26, 0x27, 0xff, 0x23, 0x25, 0x25, 0xff, 0x22, 0x23, 0x27, 0xff, 0x27, 0x28, 0x2c, 0xff, 0x2d, 0x2f, 0x32, 0xff, 0x2a, 0x29, 0x30, 0xff, 0x3b, 0x37, 0x41, 0xff, 0xe0, 0xdf, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xce, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x46, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xd2, 0xd5, 0xd0, 0xff, 0x95, 0x97, 0x98, 0xff, 0x5b, 0x5e, 0x64, 0xff, 0x14, 0x19, 0x21, 0xff, 0x18, 0x20, 0x27, 0xff, 0x1d, 0x25, 0x2f, 0xff, 0x1b, 0x21, 0x2f, 0xff, 0x1e, 0x24, 0x34, 0xff, 0x1d, 0x23, 0x36, 0xff, 0x17, 0x1c, 0x30, 0xff, 0x17, 0x1b, 0x30, 0xff, 0x18, 0x1e, 0x30, 0xff, 0x40, 0x48, 0x59, 0xff, 0x46, 0x50, 0x63, 0xff, 0x2c, 0x37, 0x4d, 0xff, 0x17, 0x26, 0x3c, 0xff, 0x26, 0x36, 0x4d, 0xff, 0x29, 0x35, 0x51, 0xff, 0x19, 0x25, 0x40, 0xff, 0x2b, 0x35, 0x50, 0xff, 0x21, 0x25, 0x45, 0xff, 0x1a, 0x1e, 0x40, 0xff, 0x16, 0x22, 0x45, 0xff, 0x26, 0x35, 0x59, 0xff, 0x1c, 0x2c, 0x52, 0xff, 0x15, 0x29, 0x52, 0xff, 0x45, 0x65, 0x91, 0xff, 0x8c, 0xb0, 0xde, 0xff, 0xa2, 0xc4, 0xf1, 0xff, 0x9e, 0xc4, 0xee, 0xff, 0x99, 0xc0, 0xee, 0xff, 0x91, 0xba, 0xea, 0xff, 0x8d, 0xb6, 0xe7, 0xff, 0x8b, 0xb6, 0xe6, 0xff, 0x8d, 0xb7, 0xe7, 0xff, 0x8d, 0xb7, 0xe9, 0xff, 0x8c, 0xb4, 0xe9, 0xff, 0x83, 0xaf, 0xe5, 0xff, 0x7d, 0xab, 0xe3, 0xff, 0x7d, 0xa9, 0xe2, 0xff, 0x7f, 0xac, 0xe3, 0xff, 0x7f, 0xab, 0xe3, 0xff, 0x79, 0xa8, 0xdc, 0xff, 0x71, 0xa2, 0xda, 0xff, 0x67, 0x8d, 0xcb, 0xff, 0x4c, 0x69, 0x9e, 0xff, 0x30, 0x4b, 0x77, 0xff, 0x2a, 0x3d, 0x6d, 0xff, 0x42, 0x5b, 0x8d, 0xff, 0x58, 0x75, 0xa9, 0xff, 0x4e, 0x6a, 0x9f, 0xff, 0x47, 0x63, 0x97, 0xff, 0x42, 0x5e, 0x93, 0xff, 0x42, 0x5f, 0x91, 0xff, 0x45, 0x60, 0x8f, 0xff, 0x45, 0x5e, 0x8c, 0xff, 0x59, 0x71, 0x9f, 0xff, 0x5e, 0x6e, 0x8f, 0xff, 0x15, 0x19, 0x24, 0xff, 0x0a, 0x0b, 0x10, 0xff, 0x06, 0x0a, 0x13, 0xff, 0x12, 0x15, 0x20, 0xff, 0x1a, 0x1c, 0x2b, 0xff, 0x13, 0x12, 0x23, 0xff, 0x10, 0x10, 0x1e, 0xff, 0x13, 0x15, 0x1c, 0xff, 0x0d, 0x0f, 0x12, 0xff, 0x0b, 0x0c, 0x10, 0xff, 0x0c, 0x0d, 0x11, 0xff, 0x0f, 0x10, 0x14, 0xff, 0x0e, 0x0f, 0x13, 0xff, 0x0c, 0x0d, 0x11, 0xff, 0x12, 0x13, 0x17, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x20, 0x21, 0x25, 0xff, 0x1d, 0x1e, 0x23, 0xff, 0x24, 0x26, 0x28, 0xff, 0x27, 0x29, 0x2a, 0xff, 0x26, 0x28, 0x29, 0xff, 0x23, 0x25, 0x26, 0xff, 0x27, 0x28, 0x2c, 0xff, 0x2c, 0x2c, 0x30, 0xff, 0x2a, 0x2c, 0x2f, 0xff, 0x2f, 0x2d, 0x35, 0xff, 0x22, 0x1e, 0x27, 0xff, 0x8e, 0x8d, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xd6, 0xd7, 0xd7, 0xff, 0xa2, 0xa5, 0xab, 0xff, 0x69, 0x6c, 0x71, 0xff, 0x37, 0x3a, 0x3f, 0xff, 0x14, 0x19, 0x20, 0xff, 0x0b, 0x11, 0x18, 0xff, 0x12, 0x16, 0x1b, 0xff, 0x1a, 0x1e, 0x21, 0xff, 0x14, 0x19, 0x1b, 0xff, 0x10, 0x15, 0x19, 0xff, 0x15, 0x19, 0x21, 0xff, 0x13, 0x1a, 0x27, 0xff, 0x15, 0x1d, 0x2c, 0xff, 0x24, 0x2c, 0x39, 0xff, 0x15, 0x1c, 0x2c, 0xff, 0x17, 0x1f, 0x31, 0xff, 0x36, 0x41, 0x54, 0xff, 0x40, 0x4a, 0x5e, 0xff, 0x3b, 0x41, 0x5b, 0xff, 0x61, 0x77, 0xa0, 0xff, 0x52, 0x72, 0xa1, 0xff, 0x40, 0x5d, 0x84, 0xff, 0x71, 0x91, 0xbf, 0xff, 0x32, 0x4f, 0x85, 0xff, 0x2c, 0x3e, 0x6e, 0xff, 0x5a, 0x73, 0xa2, 0xff, 0x87, 0xaf, 0xdc, 0xff, 0x89, 0xad, 0xd9, 0xff, 0x83, 0x9f, 0xc9, 0xff, 0x9f, 0xc2, 0xe9, 0xff, 0xb2, 0xd0, 0xf7, 0xff, 0xb5, 0xcc, 0xf1, 0xff, 0xab, 0xc9, 0xec, 0xff, 0xa2, 0xc6, 0xef, 0xff, 0x95, 0xbe, 0xec, 0xff, 0x8a, 0xb7, 0xe6, 0xff, 0x8e, 0xb7, 0xe7, 0xff, 0x95, 0xb9, 0xea, 0xff, 0x95, 0xb9, 0xe9, 0xff, 0x8e, 0xb6, 0xe8, 0xff, 0x88, 0xb2, 0xe6, 0xff, 0x84, 0xb0, 0xe6, 0xff, 0x87, 0xb2, 0xe8, 0xff, 0x8c, 0xb7, 0xed, 0xff, 0x89, 0xb4, 0xe9, 0xff, 0x83, 0xb0, 0xe1, 0xff, 0x76, 0xa8, 0xdd, 0xff, 0x6e, 0x98, 0xd7, 0xff, 0x5c, 0x80, 0xba, 0xff, 0x49, 0x6e, 0xa3, 0xff, 0x54, 0x73, 0xab, 0xff, 0x5d, 0x80, 0xbb, 0xff, 0x5f, 0x86, 0xc3, 0xff, 0x5f, 0x85, 0xc2, 0xff, 0x61, 0x87, 0xc4, 0xff, 0x63, 0x89, 0xc7, 0xff, 0x63, 0x8a, 0xc9, 0xff, 0x70, 0x94, 0xcf, 0xff, 0x6e, 0x92, 0xcd, 0xff, 0x7e, 0xa0, 0xdc, 0xff, 0x43, 0x53, 0x73, 0xff, 0x07, 0x04, 0x09, 0xff, 0x10, 0x0d, 0x0c, 0xff, 0x06, 0x09, 0x0d, 0xff, 0x1f, 0x23, 0x30, 0xff, 0x29, 0x2f, 0x42, 0xff, 0x0a, 0x07, 0x17, 0xff, 0x0f, 0x0c, 0x17, 0xff, 0x10, 0x11, 0x14, 0xff, 0x0f, 0x11, 0x13, 0xff, 0x10, 0x10, 0x15, 0xff, 0x0f, 0x10, 0x14, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x14, 0x15, 0x19, 0xff, 0x0c, 0x0d, 0x11, 0xff, 0x14, 0x15, 0x19, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x23, 0x24, 0x28, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x22, 0x23, 0x27, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x28, 0x29, 0x2d, 0xff, 0x23, 0x25, 0x28, 0xff, 0x26, 0x28, 0x28, 0xff, 0x28, 0x2b, 0x2b, 0xff, 0x24, 0x26, 0x27, 0xff, 0x24, 0x25, 0x29, 0xff, 0x27, 0x28, 0x2c, 0xff, 0x2a, 0x2c, 0x2f, 0xff, 0x2e, 0x2c, 0x34, 0xff, 0x2c, 0x29, 0x31, 0xff, 0x51, 0x4f, 0x53, 0xff, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x27, 0xfd, 0xfd, 0xfd, 0xfa, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfc, 0xfd, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf2, 0xf2, 0xff, 0xd1, 0xd2, 0xd4, 0xff, 0x9b, 0x9c, 0x9f, 0xff, 0x69, 0x69, 0x6c, 0xff, 0x41, 0x42, 0x46, 0xff, 0x1a, 0x1b, 0x22, 0xff, 0x14, 0x15, 0x1c, 0xff, 0x18, 0x19, 0x20, 0xff, 0x18, 0x1b, 0x1f, 0xff, 0x10, 0x13, 0x16, 0xff, 0x10, 0x12, 0x14, 0xff, 0x0a, 0x0c, 0x0d, 0xff, 0x0d, 0x10, 0x0f, 0xff, 0x04, 0x07, 0x07, 0xff, 0x08, 0x0a, 0x0c, 0xff, 0x0c, 0x0e, 0x12, 0xff, 0x0b, 0x0f, 0x14, 0xff, 0x18, 0x1d, 0x25, 0xff, 0x2b, 0x32, 0x3b, 0xff, 0x1d, 0x24, 0x2f, 0xff, 0x1b, 0x23, 0x30, 0xff, 0x28, 0x2e, 0x3c, 0xff, 0x22, 0x29, 0x40, 0xff, 0x3c, 0x4f, 0x79, 0xff, 0x6a, 0x8c, 0xbf, 0xff, 0x97, 0xbe, 0xef, 0xff, 0xa2, 0xca, 0xfc, 0xff, 0x83, 0xae, 0xdd, 0xff, 0x97, 0xba, 0xe1, 0xff, 0xc4, 0xdb, 0xfb, 0xff, 0xc1, 0xdd, 0xfc, 0xff, 0xc6, 0xe1, 0xfe, 0xff, 0xcf, 0xe6, 0xff, 0xff, 0xc1, 0xd8, 0xfd, 0xff, 0xb9, 0xcf, 0xf2, 0xff, 0xbb, 0xd0, 0xf2, 0xff, 0xb7, 0xd2, 0xf0, 0xff, 0xab, 0xcb, 0xed, 0xff, 0x99, 0xbb, 0xea, 0xff, 0x8c, 0xb4, 0xe9, 0xff, 0x8d, 0xb6, 0xe8, 0xff, 0x96, 0xbb, 0xe7, 0xff, 0x99, 0xbe, 0xe7, 0xff, 0x97, 0xbc, 0xe9, 0xff, 0x96, 0xba, 0xef, 0xff, 0x98, 0xbc, 0xef, 0xff, 0x9a, 0xc1, 0xf0, 0xff, 0x9b, 0xc4, 0xf4, 0xff, 0x95, 0xbd, 0xf3, 0xff, 0x8d, 0xb6, 0xeb, 0xff, 0x85, 0xb0, 0xe5, 0xff, 0x7e, 0xa6, 0xe1, 0xff, 0x75, 0x9c, 0xd9, 0xff, 0x70, 0x96, 0xd6, 0xff, 0x74, 0x99, 0xd8, 0xff, 0x70, 0x96, 0xd4, 0xff, 0x75, 0x9b, 0xd9, 0xff, 0x7b, 0xa1, 0xdf, 0xff, 0x7c, 0xa3, 0xdd, 0xff, 0x7a, 0xa3, 0xdd, 0xff, 0x7a, 0xa2, 0xda, 0xff, 0x70, 0x9c, 0xdd, 0xff, 0x7f, 0xac, 0xed, 0xff, 0x7b, 0x97, 0xc4, 0xff, 0x17, 0x19, 0x25, 0xff, 0x0a, 0x06, 0x07, 0xff, 0x0e, 0x10, 0x1a, 0xff, 0x0a, 0x0a, 0x10, 0xff, 0x11, 0x14, 0x19, 0xff, 0x19, 0x1c, 0x21, 0xff, 0x0a, 0x0b, 0x11, 0xff, 0x0d, 0x0e, 0x13, 0xff, 0x0b, 0x0c, 0x0f, 0xff, 0x13, 0x14, 0x17, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x10, 0x11, 0x15, 0xff, 0x0f, 0x10, 0x14, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x20, 0x21, 0x25, 0xff, 0x26, 0x27, 0x2b, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x26, 0x27, 0x2b, 0xff, 0x20, 0x21, 0x25, 0xff, 0x2e, 0x2f, 0x33, 0xff, 0x25, 0x26, 0x2a, 0xff, 0x23, 0x25, 0x28, 0xff, 0x27, 0x28, 0x2b, 0xff, 0x20, 0x21, 0x24, 0xff, 0x23, 0x24, 0x28, 0xff, 0x24, 0x25, 0x29, 0xff, 0x29, 0x2b, 0x2f, 0xff, 0x29, 0x28, 0x2b, 0xff, 0x2e, 0x2f, 0x34, 0xff, 0x2d, 0x2f, 0x36, 0xff, 0xbb, 0xbb, 0xbc, 0xfa, 0xff, 0xff, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x88, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xb3, 0xff, 0x8d, 0x8e, 0x91, 0xff, 0x87, 0x89, 0x8b, 0xff, 0x59, 0x5b, 0x5e, 0xff, 0x34, 0x35, 0x39, 0xff, 0x27, 0x28, 0x2d, 0xff, 0x19, 0x1a, 0x1f, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x15, 0x16, 0x19, 0xff, 0x1c, 0x1d, 0x20, 0xff, 0x15, 0x16, 0x19, 0xff, 0x11, 0x11, 0x13, 0xff, 0x0e, 0x0f, 0x0e, 0xff, 0x0c, 0x0e, 0x0e, 0xff, 0x08, 0x0a, 0x0b, 0xff, 0x04, 0x06, 0x07, 0xff, 0x03, 0x05, 0x06, 0xff, 0x05, 0x07, 0x06, 0xff, 0x07, 0x08, 0x06, 0xff, 0x08, 0x0b, 0x0b, 0xff, 0x04, 0x09, 0x0d, 0xff, 0x1c, 0x22, 0x27, 0xff, 0x25, 0x2b, 0x31, 0xff, 0x17, 0x1a, 0x24, 0xff, 0x0f, 0x12, 0x1c, 0xff, 0x0f, 0x18, 0x28, 0xff, 0x27, 0x37, 0x5c, 0xff, 0x67, 0x84, 0xb7, 0xff, 0x9f, 0xc6, 0xf6, 0xff, 0xa8, 0xcb, 0xf5, 0xff, 0xbe, 0xd6, 0xfb, 0xff, 0xc9, 0xdd, 0xfd, 0xff, 0xc5, 0xdb, 0xf5, 0xff, 0xc5, 0xd9, 0xf3, 0xff, 0xc5, 0xd9, 0xf3, 0xff, 0xc4, 0xda, 0xf9, 0xff, 0xc0, 0xd6, 0xf9, 0xff, 0xbd, 0xd2, 0xf5, 0xff, 0xbb, 0xd2, 0xf4, 0xff, 0xbb, 0xd7, 0xf5, 0xff, 0xb3, 0xd3, 0xf3, 0xff, 0x9c, 0xbb, 0xea, 0xff, 0x8d, 0xb1, 0xe9, 0xff, 0x90, 0xb5, 0xe9, 0xff, 0x96, 0xbb, 0xe6, 0xff, 0x9d, 0xc0, 0xe7, 0xff, 0xa0, 0xc0, 0xeb, 0xff, 0xa2, 0xc0, 0xf2, 0xff, 0xa7, 0xc6, 0xf3, 0xff, 0xa7, 0xca, 0xf1, 0xff, 0xa4, 0xc8, 0xf5, 0xff, 0x9d, 0xc2, 0xf5, 0xff, 0x91, 0xb7, 0xed, 0xff, 0x8c, 0xb3, 0xe8, 0xff, 0x87, 0xac, 0xe4, 0xff, 0x84, 0xa8, 0xe5, 0xff, 0x83, 0xa6, 0xe7, 0xff, 0x81, 0xa6, 0xe3, 0xff, 0x81, 0xa8, 0xe1, 0xff, 0x87, 0xab, 0xe4, 0xff, 0x88, 0xac, 0xe5, 0xff, 0x8a, 0xae, 0xe3, 0xff, 0x86, 0xad, 0xe3, 0xff, 0x87, 0xaa, 0xdb, 0xff, 0x7c, 0xa8, 0xe3, 0xff, 0x97, 0xbf, 0xfa, 0xff, 0x51, 0x63, 0x81, 0xff, 0x01, 0x00, 0x03, 0xff, 0x18, 0x15, 0x18, 0xff, 0x11, 0x14, 0x21, 0xff, 0x09, 0x07, 0x0f, 0xff, 0x07, 0x08, 0x0a, 0xff, 0x0a, 0x0b, 0x0a, 0xff, 0x0b, 0x0c, 0x0e, 0xff, 0x0d, 0x0f, 0x12, 0xff, 0x0e, 0x0f, 0x14, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x14, 0x15, 0x19, 0xff, 0x0e, 0x0f, 0x13, 0xff, 0x10, 0x11, 0x15, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x21, 0x22, 0x26, 0xff, 0x25, 0x26, 0x2a, 0xff, 0x26, 0x27, 0x2b, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x25, 0x26, 0x2a, 0xff, 0x25, 0x26, 0x2a, 0xff, 0x22, 0x23, 0x27, 0xff, 0x21, 0x21, 0x26, 0xff, 0x21, 0x22, 0x26, 0xff, 0x21, 0x22, 0x26, 0xff, 0x22, 0x23, 0x27, 0xff, 0x29, 0x2a, 0x2e, 0xff, 0x28, 0x2a, 0x2e, 0xff, 0x2b, 0x2a, 0x2b, 0xff, 0x30, 0x32, 0x36, 0xff, 0x27, 0x2b, 0x33, 0xff, 0x91, 0x91, 0x93, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x09, 0xfd, 0xfd, 0xff, 0xdb, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8d, 0x90, 0x94, 0xff, 0x29, 0x2b, 0x32, 0xff, 0x24, 0x24, 0x2b, 0xff, 0x1d, 0x1c, 0x24, 0xff, 0x21, 0x20, 0x29, 0xff, 0x23, 0x23, 0x2a, 0xff, 0x1a, 0x1c, 0x1f, 0xff, 0x1d, 0x1e, 0x23, 0xff, 0x18, 0x19, 0x1e, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x12, 0x13, 0x15, 0xff, 0x0c, 0x0e, 0x0f, 0xff, 0x0d, 0x0f, 0x0f, 0xff, 0x08, 0x0a, 0x0b, 0xff, 0x07, 0x09, 0x0a, 0xff, 0x08, 0x0a, 0x0b, 0xff, 0x06, 0x08, 0x09, 0xff, 0x04, 0x07, 0x04, 0xff, 0x05, 0x0a, 0x07, 0xff, 0x03, 0x0b, 0x0c, 0xff, 0x13, 0x19, 0x1c, 0xff, 0x26, 0x29, 0x2d, 0xff, 0x1c, 0x1e, 0x26, 0xff, 0x0b, 0x0b, 0x13, 0xff, 0x19, 0x1a, 0x25, 0xff, 0x3f, 0x4c, 0x70, 0xff, 0x48, 0x66, 0x99, 0xff, 0x74, 0x9d, 0xce, 0xff, 0x9a, 0xbf, 0xed, 0xff, 0xab, 0xc7, 0xef, 0xff, 0xb6, 0xce, 0xf1, 0xff, 0xbd, 0xd4, 0xf1, 0xff, 0xbd, 0xd5, 0xf3, 0xff, 0xbf, 0xd7, 0xf5, 0xff, 0xc0, 0xda, 0xfa, 0xff, 0xba, 0xd5, 0xf6, 0xff, 0xb6, 0xd1, 0xf2, 0xff, 0xb8, 0xd1, 0xf3, 0xff, 0xbc, 0xd7, 0xf3, 0xff, 0xb4, 0xd3, 0xf2, 0xff, 0x9e, 0xbe, 0xed, 0xff, 0x91, 0xb3, 0xec, 0xff, 0x95, 0xb6, 0xea, 0xff, 0x9a, 0xbc, 0xe8, 0xff, 0xa2, 0xc1, 0xe8, 0xff, 0xa7, 0xc1, 0xeb, 0xff, 0xab, 0xc5, 0xf1, 0xff, 0xb1, 0xcf, 0xf0, 0xff, 0xb0, 0xd1, 0xf1, 0xff, 0xaa, 0xca, 0xf2, 0xff, 0xa5, 0xc4, 0xf2, 0xff, 0x96, 0xba, 0xec, 0xff, 0x8f, 0xb6, 0xeb, 0xff, 0x8d, 0xb3, 0xe9, 0xff, 0x8b, 0xaf, 0xe8, 0xff, 0x8b, 0xae, 0xe8, 0xff, 0x8b, 0xb0, 0xe7, 0xff, 0x8e, 0xb5, 0xe8, 0xff, 0x90, 0xb4, 0xe8, 0xff, 0x91, 0xb3, 0xe7, 0xff, 0x92, 0xb7, 0xe6, 0xff, 0x90, 0xb6, 0xe8, 0xff, 0x94, 0xb3, 0xe0, 0xff, 0x9e, 0xc0, 0xf3, 0xff, 0x8f, 0xaf, 0xdd, 0xff, 0x1a, 0x25, 0x39, 0xff, 0x06, 0x08, 0x11, 0xff, 0x1d, 0x1d, 0x23, 0xff, 0x0f, 0x0f, 0x1a, 0xff, 0x0c, 0x0b, 0x14, 0xff, 0x10, 0x11, 0x14, 0xff, 0x10, 0x12, 0x11, 0xff, 0x13, 0x14, 0x18, 0xff, 0x12, 0x13, 0x17, 0xff, 0x14, 0x15, 0x19, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x14, 0x15, 0x19, 0xff, 0x13, 0x14, 0x18, 0xff, 0x12, 0x13, 0x17, 0xff, 0x14, 0x15, 0x19, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x20, 0x21, 0x25, 0xff, 0x21, 0x22, 0x26, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x27, 0x28, 0x2d, 0xff, 0x21, 0x22, 0x26, 0xff, 0x21, 0x22, 0x26, 0xff, 0x24, 0x25, 0x29, 0xff, 0x20, 0x21, 0x25, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x20, 0x21, 0x26, 0xff, 0x20, 0x21, 0x25, 0xff, 0x1e, 0x1f, 0x24, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x29, 0x2a, 0x2e, 0xff, 0x24, 0x26, 0x2a, 0xff, 0x2c, 0x2b, 0x2c, 0xff, 0x32, 0x34, 0x39, 0xff, 0x27, 0x2c, 0x34, 0xdb, 0x71, 0x71, 0x71, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xfb, 0xfb, 0x41, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xa1, 0xa6, 0xac, 0xff, 0x27, 0x2a, 0x32, 0xff, 0x2b, 0x2c, 0x36, 0xff, 0x2d, 0x2c, 0x36, 0xff, 0x1b, 0x1b, 0x23, 0xff, 0x23, 0x23, 0x2a, 0xff, 0x26, 0x27, 0x2c, 0xff, 0x09, 0x0b, 0x0d, 0xff, 0x0f, 0x10, 0x13, 0xff, 0x13, 0x15, 0x17, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x14, 0x15, 0x19, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x11, 0x12, 0x15, 0xff, 0x12, 0x14, 0x16, 0xff, 0x10, 0x12, 0x14, 0xff, 0x0a, 0x0b, 0x0d, 0xff, 0x0b, 0x0d, 0x0e, 0xff, 0x08, 0x09, 0x0a, 0xff, 0x07, 0x09, 0x0a, 0xff, 0x09, 0x0b, 0x0a, 0xff, 0x0a, 0x0d, 0x0c, 0xff, 0x0c, 0x12, 0x12, 0xff, 0x12, 0x17, 0x19, 0xff, 0x29, 0x2b, 0x2f, 0xff, 0x1f, 0x22, 0x28, 0xff, 0x13, 0x13, 0x1a, 0xff, 0x0e, 0x0e, 0x13, 0xff, 0x41, 0x4b, 0x66, 0xff, 0x49, 0x6a, 0xa0, 0xff, 0x56, 0x82, 0xbc, 0xff, 0x7b, 0xa7, 0xdf, 0xff, 0x80, 0xb0, 0xe6, 0xff, 0x96, 0xc0, 0xed, 0xff, 0xa8, 0xc7, 0xee, 0xff, 0xa9, 0xc8, 0xf0, 0xff, 0xaf, 0xce, 0xf5, 0xff, 0xb7, 0xd4, 0xf8, 0xff, 0xb7, 0xd2, 0xf4, 0xff, 0xb3, 0xcf, 0xf2, 0xff, 0xb3, 0xcf, 0xf3, 0xff, 0xb4, 0xd2, 0xf4, 0xff, 0xad, 0xce, 0xf2, 0xff, 0x9e, 0xc0, 0xee, 0xff, 0x93, 0xb5, 0xeb, 0xff, 0x94, 0xb6, 0xe8, 0xff, 0x9a, 0xbc, 0xe8, 0xff, 0xa2, 0xc0, 0xe9, 0xff, 0xa8, 0xc1, 0xea, 0xff, 0xae, 0xc8, 0xee, 0xff, 0xb6, 0xd3, 0xef, 0xff, 0xba, 0xd6, 0xf5, 0xff, 0xb3, 0xd1, 0xf4, 0xff, 0xa9, 0xcb, 0xf3, 0xff, 0x9f, 0xc2, 0xef, 0xff, 0x98, 0xbc, 0xed, 0xff, 0x95, 0xb9, 0xec, 0xff, 0x93, 0xb5, 0xea, 0xff, 0x94, 0xb7, 0xe9, 0xff, 0x95, 0xb8, 0xe9, 0xff, 0x97, 0xbb, 0xea, 0xff, 0x98, 0xba, 0xe9, 0xff, 0x99, 0xba, 0xe9, 0xff, 0x98, 0xbb, 0xe6, 0xff, 0x98, 0xbc, 0xe9, 0xff, 0x9e, 0xbd, 0xed, 0xff, 0xa8, 0xc9, 0xfb, 0xff, 0x56, 0x6b, 0x8c, 0xff, 0x00, 0x03, 0x0c, 0xff, 0x16, 0x17, 0x1e, 0xff, 0x18, 0x19, 0x20, 0xff, 0x0e, 0x0f, 0x16, 0xff, 0x0f, 0x0e, 0x15, 0xff, 0x11, 0x12, 0x15, 0xff, 0x0f, 0x11, 0x12, 0xff, 0x13, 0x14, 0x18, 0xff, 0x13, 0x14, 0x18, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x14, 0x15, 0x19, 0xff, 0x11, 0x12, 0x16, 0xff, 0x11, 0x12, 0x16, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x22, 0x24, 0x27, 0xff, 0x1b, 0x1d, 0x20, 0xff, 0x1d, 0x1e, 0x21, 0xff, 0x2a, 0x2b, 0x2e, 0xff, 0x28, 0x29, 0x2c, 0xff, 0x1a, 0x1c, 0x1f, 0xff, 0x1c, 0x1d, 0x20, 0xff, 0x18, 0x19, 0x1c, 0xff, 0x1d, 0x1e, 0x21, 0xff, 0x1e, 0x1f, 0x22, 0xff, 0x1d, 0x1e, 0x21, 0xff, 0x23, 0x24, 0x28, 0xff, 0x29, 0x2a, 0x2e, 0xff, 0x26, 0x27, 0x2b, 0xff, 0x2b, 0x2b, 0x2c, 0xff, 0x2a, 0x2c, 0x30, 0xfe, 0x2b, 0x2f, 0x36, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8f, 0xc2, 0xc6, 0xcc, 0xff, 0x38, 0x3c, 0x48, 0xff, 0x2f, 0x2f, 0x3a, 0xff, 0x3b, 0x39, 0x44, 0xff, 0x34, 0x33, 0x3d, 0xff, 0x21, 0x21, 0x27, 0xff, 0x13, 0x16, 0x15, 0xff, 0x21, 0x24, 0x23, 0xff, 0x12, 0x14, 0x14, 0xff, 0x06, 0x08, 0x08, 0xff, 0x08, 0x0a, 0x0b, 0xff, 0x11, 0x12, 0x16, 0xff, 0x0f, 0x10, 0x14, 0xff, 0x12, 0x13, 0x17, 0xff, 0x13, 0x14, 0x19, 0xff, 0x12, 0x13, 0x17, 0xff, 0x0d, 0x0d, 0x12, 0xff, 0x0c, 0x0e, 0x11, 0xff, 0x0f, 0x11, 0x12, 0xff, 0x0a, 0x0c, 0x0d, 0xff, 0x0a, 0x0c, 0x0d, 0xff, 0x0d, 0x0e, 0x12, 0xff, 0x10, 0x11, 0x16, 0xff, 0x11, 0x11, 0x16, 0xff, 0x14, 0x15, 0x1a, 0xff, 0x23, 0x27, 0x2a, 0xff, 0x23, 0x25, 0x2d, 0xff, 0x1c, 0x1d, 0x26, 0xff, 0x0d, 0x0e, 0x12, 0xff, 0x2a, 0x31, 0x3d, 0xff, 0x55, 0x75, 0xa9, 0xff, 0x62, 0x90, 0xd0, 0xff, 0x70, 0xa1, 0xdd, 0xff, 0x6e, 0xa1, 0xe3, 0xff, 0x83, 0xaf, 0xe6, 0xff, 0x91, 0xb8, 0xe8, 0xff, 0x98, 0xbd, 0xec, 0xff, 0xa1, 0xc5, 0xf1, 0xff, 0xa7, 0xc7, 0xf2, 0xff, 0xa9, 0xc8, 0xf3, 0xff, 0xa9, 0xc9, 0xf4, 0xff, 0xa7, 0xc7, 0xf1, 0xff, 0xa6, 0xc7, 0xf2, 0xff, 0xa3, 0xc7, 0xf4, 0xff, 0x9a, 0xbf, 0xed, 0xff, 0x90, 0xb6, 0xe8, 0xff, 0x90, 0xb4, 0xe6, 0xff, 0x98, 0xba, 0xe8, 0xff, 0x9d, 0xbe, 0xec, 0xff, 0xa3, 0xc1, 0xec, 0xff, 0xab, 0xc9, 0xed, 0xff, 0xb6, 0xd1, 0xf1, 0xff, 0xbd, 0xd6, 0xf7, 0xff, 0xb9, 0xd6, 0xf8, 0xff, 0xac, 0xd2, 0xf5, 0xff, 0xa5, 0xc8, 0xf1, 0xff, 0xa0, 0xbe, 0xeb, 0xff, 0x9e, 0xbd, 0xed, 0xff, 0x9d, 0xbb, 0xec, 0xff, 0x9c, 0xbc, 0xe9, 0xff, 0x9c, 0xbc, 0xe9, 0xff, 0x9c, 0xbc, 0xe9, 0xff, 0x9a, 0xbb, 0xe7, 0xff, 0x99, 0xba, 0xe7, 0xff, 0x9b, 0xbc, 0xe9, 0xff, 0x9b, 0xba, 0xe7, 0xff, 0xa4, 0xc7, 0xfa, 0xff, 0x92, 0xb1, 0xdf, 0xff, 0x1b, 0x24, 0x37, 0xff, 0x0c, 0x0a, 0x0b, 0xff, 0x1f, 0x1f, 0x21, 0xff, 0x12, 0x13, 0x16, 0xff, 0x0b, 0x0c, 0x0f, 0xff, 0x12, 0x13, 0x17, 0xff, 0x10, 0x11, 0x15, 0xff, 0x11, 0x12, 0x16, 0xff, 0x12, 0x13, 0x17, 0xff, 0x13, 0x14, 0x18, 0xff, 0x13, 0x14, 0x18, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x13, 0x14, 0x18, 0xff, 0x0e, 0x0f, 0x13, 0xff, 0x0c, 0x0d, 0x11, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1f, 0x20, 0x25, 0xff, 0x27, 0x28, 0x2b, 0xff, 0x22, 0x25, 0x25, 0xff, 0x1e, 0x21, 0x21, 0xff, 0x29, 0x2b, 0x2b, 0xff, 0x1f, 0x21, 0x22, 0xff, 0x14, 0x16, 0x17, 0xff, 0x15, 0x17, 0x17, 0xff, 0x14, 0x16, 0x17, 0xff, 0x18, 0x1a, 0x1b, 0xff, 0x1e, 0x20, 0x21, 0xff, 0x22, 0x24, 0x25, 0xff, 0x29, 0x2a, 0x2e, 0xff, 0x25, 0x25, 0x2a, 0xff, 0x25, 0x26, 0x2b, 0xff, 0x2b, 0x2e, 0x30, 0xff, 0x2e, 0x2f, 0x2f, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xda, 0xda, 0x07, 0x3a, 0x3f, 0x47, 0xd1, 0x26, 0x2a, 0x34, 0xff, 0x36, 0x37, 0x41, 0xff, 0x32, 0x31, 0x3b, 0xff, 0x33, 0x32, 0x3b, 0xff, 0x30, 0x30, 0x36, 0xff, 0x11, 0x13, 0x15, 0xff, 0x1c, 0x1e, 0x1f, 0xff, 0x1e, 0x20, 0x21, 0xff, 0x05, 0x07, 0x08, 0xff, 0x07, 0x09, 0x0a, 0xff, 0x08, 0x09, 0x0e, 0xff, 0x0e, 0x0f, 0x13, 0xff, 0x10, 0x11, 0x15, 0xff, 0x11, 0x12, 0x16, 0xff, 0x0e, 0x0f, 0x13, 0xff, 0x0c, 0x0e, 0x11, 0xff, 0x11, 0x12, 0x15, 0xff, 0x10, 0x12, 0x13, 0xff, 0x0c, 0x0e, 0x0f, 0xff, 0x09, 0x0b, 0x0c, 0xff, 0x0d, 0x0e, 0x12, 0xff, 0x0f, 0x10, 0x14, 0xff, 0x17, 0x17, 0x1b, 0xff, 0x15, 0x17, 0x1b, 0xff, 0x1c, 0x1f, 0x23, 0xff, 0x29, 0x2b, 0x33, 0xff, 0x21, 0x22, 0x2c, 0xff, 0x13, 0x14, 0x19, 0xff, 0x13, 0x16, 0x1e, 0xff, 0x5b, 0x6d, 0x90, 0xff, 0x8f, 0xb8, 0xf0, 0xff, 0x87, 0xb5, 0xed, 0xff, 0x87, 0xb2, 0xe9, 0xff, 0x83, 0xaf, 0xe7, 0xff, 0x86, 0xb0, 0xe6, 0xff, 0x93, 0xbc, 0xee, 0xff, 0x9a, 0xc1, 0xf1, 0xff, 0xa0, 0xc3, 0xf1, 0xff, 0xa4, 0xc5, 0xf3, 0xff, 0xa3, 0xc5, 0xf4, 0xff, 0xa3, 0xc3, 0xf1, 0xff, 0xa1, 0xc2, 0xee, 0xff, 0x9d, 0xbf, 0xed, 0xff, 0x95, 0xb9, 0xea, 0xff, 0x8e, 0xb6, 0xeb, 0xff, 0x8d, 0xb4, 0xe9, 0xff, 0x93, 0xb7, 0xe8, 0xff, 0x9a, 0xbc, 0xeb, 0xff, 0x9f, 0xc1, 0xec, 0xff, 0xa8, 0xc7, 0xee, 0xff, 0xb2, 0xd0, 0xf2, 0xff, 0xba, 0xd5, 0xf6, 0xff, 0xba, 0xd5, 0xf8, 0xff, 0xb4, 0xd0, 0xf6, 0xff, 0xab, 0xc9, 0xf1, 0xff, 0xa4, 0xc2, 0xed, 0xff, 0xa6, 0xc2, 0xf0, 0xff, 0xa3, 0xc1, 0xf0, 0xff, 0x9d, 0xbf, 0xed, 0xff, 0x9c, 0xbe, 0xeb, 0xff, 0x9b, 0xbc, 0xea, 0xff, 0x9c, 0xbd, 0xea, 0xff, 0x99, 0xba, 0xe7, 0xff, 0x98, 0xb9, 0xe5, 0xff, 0x9f, 0xc0, 0xee, 0xff, 0xaf, 0xd0, 0xfc, 0xff, 0x4a, 0x5e, 0x7c, 0xff, 0x00, 0x03, 0x0a, 0xff, 0x1b, 0x1a, 0x1b, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x13, 0x14, 0x18, 0xff, 0x10, 0x11, 0x15, 0xff, 0x14, 0x15, 0x19, 0xff, 0x13, 0x14, 0x18, 0xff, 0x14, 0x15, 0x19, 0xff, 0x11, 0x12, 0x16, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x11, 0x12, 0x16, 0xff, 0x14, 0x15, 0x19, 0xff, 0x0d, 0x0e, 0x12, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x23, 0x24, 0x29, 0xff, 0x22, 0x23, 0x26, 0xff, 0x29, 0x2c, 0x2c, 0xff, 0x25, 0x27, 0x28, 0xff, 0x1b, 0x1d, 0x1e, 0xff, 0x13, 0x15, 0x16, 0xff, 0x10, 0x12, 0x13, 0xff, 0x10, 0x12, 0x13, 0xff, 0x15, 0x17, 0x18, 0xff, 0x18, 0x1a, 0x1b, 0xff, 0x23, 0x26, 0x26, 0xff, 0x28, 0x2a, 0x2b, 0xff, 0x2b, 0x2c, 0x30, 0xff, 0x23, 0x24, 0x28, 0xff, 0x23, 0x23, 0x28, 0xff, 0x2a, 0x2d, 0x2f, 0xd1, 0x1f, 0x3f, 0x3f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1e, 0x24, 0x2a, 0x2c, 0x2f, 0x38, 0xf3, 0x2c, 0x2d, 0x37, 0xff, 0x2a, 0x29, 0x32, 0xff, 0x33, 0x32, 0x3b, 0xff, 0x32, 0x32, 0x38, 0xff, 0x1b, 0x1d, 0x1f, 0xff, 0x10, 0x12, 0x13, 0xff, 0x1f, 0x21, 0x22, 0xff, 0x0a, 0x0c, 0x0d, 0xff, 0x07, 0x09, 0x0a, 0xff, 0x09, 0x0a, 0x0e, 0xff, 0x0a, 0x0b, 0x0f, 0xff, 0x10, 0x11, 0x15, 0xff, 0x13, 0x14, 0x18, 0xff, 0x0c, 0x0d, 0x11, 0xff, 0x0f, 0x10, 0x15, 0xff, 0x10, 0x11, 0x14, 0xff, 0x0c, 0x0f, 0x0f, 0xff, 0x11, 0x13, 0x13, 0xff, 0x0d, 0x0f, 0x10, 0xff, 0x10, 0x11, 0x14, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x14, 0x16, 0x1a, 0xff, 0x1a, 0x1d, 0x20, 0xff, 0x26, 0x28, 0x2f, 0xff, 0x20, 0x21, 0x2c, 0xff, 0x18, 0x1b, 0x20, 0xff, 0x0f, 0x0e, 0x11, 0xff, 0x32, 0x39, 0x4f, 0xff, 0x93, 0xb4, 0xe2, 0xff, 0xaf, 0xd4, 0xfe, 0xff, 0xaa, 0xc8, 0xed, 0xff, 0x9a, 0xbf, 0xee, 0xff, 0x99, 0xbf, 0xef, 0xff, 0x9f, 0xc1, 0xef, 0xff, 0xa5, 0xc7, 0xf2, 0xff, 0xab, 0xca, 0xf3, 0xff, 0xae, 0xcc, 0xf4, 0xff, 0xae, 0xcc, 0xf4, 0xff, 0xac, 0xca, 0xf4, 0xff, 0xa5, 0xc4, 0xf4, 0xff, 0x9c, 0xbd, 0xef, 0xff, 0x94, 0xb5, 0xea, 0xff, 0x8d, 0xb4, 0xec, 0xff, 0x8a, 0xb4, 0xea, 0xff, 0x8e, 0xb4, 0xe9, 0xff, 0x96, 0xba, 0xec, 0xff, 0x9d, 0xbe, 0xed, 0xff, 0xa4, 0xc6, 0xef, 0xff, 0xae, 0xcf, 0xf2, 0xff, 0xb5, 0xd1, 0xf3, 0xff, 0xb8, 0xd2, 0xf5, 0xff, 0xb7, 0xcd, 0xf4, 0xff, 0xae, 0xc8, 0xf0, 0xff, 0xa6, 0xc4, 0xeb, 0xff, 0xaa, 0xc4, 0xef, 0xff, 0xa8, 0xc3, 0xf1, 0xff, 0x9f, 0xc1, 0xef, 0xff, 0x9e, 0xbf, 0xed, 0xff, 0x9c, 0xbd, 0xec, 0xff, 0x9a, 0xbb, 0xe9, 0xff, 0x9c, 0xbc, 0xe9, 0xff, 0x9c, 0xbe, 0xeb, 0xff, 0xa8, 0xcc, 0xfc, 0xff, 0x75, 0x95, 0xbb, 0xff, 0x0a, 0x15, 0x22, 0xff, 0x13, 0x10, 0x0c, 0xff, 0x1c, 0x1b, 0x1b, 0xff, 0x13, 0x14, 0x1a, 0xff, 0x13, 0x14, 0x18, 0xff, 0x12, 0x13, 0x17, 0xff, 0x13, 0x14, 0x18, 0xff, 0x12, 0x13, 0x17, 0xff, 0x14, 0x15, 0x19, 0xff, 0x11, 0x12, 0x16, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x24, 0x25, 0x29, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x0f, 0x10, 0x14, 0xff, 0x0e, 0x0f, 0x13, 0xff, 0x10, 0x11, 0x15, 0xff, 0x22, 0x23, 0x27, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x0f, 0x10, 0x14, 0xff, 0x24, 0x25, 0x29, 0xff, 0x1a, 0x1c, 0x1f, 0xff, 0x26, 0x28, 0x29, 0xff, 0x1e, 0x20, 0x21, 0xff, 0x0f, 0x11, 0x12, 0xff, 0x10, 0x12, 0x13, 0xff, 0x10, 0x12, 0x13, 0xff, 0x11, 0x13, 0x14, 0xff, 0x18, 0x1a, 0x1b, 0xff, 0x18, 0x1a, 0x1b, 0xff, 0x21, 0x23, 0x24, 0xff, 0x25, 0x27, 0x28, 0xff, 0x2c, 0x2d, 0x31, 0xff, 0x21, 0x22, 0x26, 0xff, 0x22, 0x22, 0x26, 0xf4, 0x2a, 0x2a, 0x30, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x2a, 0x33, 0x55, 0x24, 0x26, 0x29, 0xfe, 0x25, 0x27, 0x28, 0xff, 0x2e, 0x2f, 0x33, 0xff, 0x2f, 0x30, 0x34, 0xff, 0x22, 0x24, 0x27, 0xff, 0x0e, 0x0f, 0x13, 0xff, 0x22, 0x23, 0x27, 0xff, 0x0f, 0x10, 0x14, 0xff, 0x05, 0x06, 0x09, 0xff, 0x09, 0x0b, 0x0c, 0xff, 0x09, 0x0b, 0x0c, 0xff, 0x10, 0x12, 0x13, 0xff, 0x15, 0x16, 0x19, 0xff, 0x11, 0x12, 0x17, 0xff, 0x10, 0x11, 0x16, 0xff, 0x0e, 0x0f, 0x13, 0xff, 0x0e, 0x0f, 0x12, 0xff, 0x13, 0x14, 0x17, 0xff, 0x11, 0x12, 0x16, 0xff, 0x10, 0x11, 0x15, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x12, 0x12, 0x16, 0xff, 0x13, 0x15, 0x19, 0xff, 0x1a, 0x1e, 0x21, 0xff, 0x20, 0x22, 0x29, 0xff, 0x25, 0x27, 0x31, 0xff, 0x1b, 0x1d, 0x26, 0xff, 0x13, 0x12, 0x17, 0xff, 0x0c, 0x15, 0x17, 0xff, 0x5f, 0x7d, 0x9c, 0xff, 0xbb, 0xdb, 0xff, 0xff, 0xbc, 0xd4, 0xf3, 0xff, 0xb5, 0xce, 0xf0, 0xff, 0xb0, 0xcd, 0xf1, 0xff, 0xaf, 0xcc, 0xf0, 0xff, 0xb1, 0xcd, 0xf2, 0xff, 0xb6, 0xd0, 0xf3, 0xff, 0xb7, 0xd0, 0xf3, 0xff, 0xb3, 0xcf, 0xf2, 0xff, 0xaf, 0xcb, 0xf5, 0xff, 0xab, 0xc6, 0xf6, 0xff, 0xa1, 0xc0, 0xf1, 0xff, 0x99, 0xb9, 0xed, 0xff, 0x92, 0xb4, 0xe9, 0xff, 0x8e, 0xb4, 0xe7, 0xff, 0x8c, 0xb6, 0xe9, 0xff, 0x92, 0xb9, 0xeb, 0xff, 0x9a, 0xbd, 0xed, 0xff, 0xa0, 0xc2, 0xf0, 0xff, 0xa8, 0xc8, 0xf3, 0xff, 0xaf, 0xcc, 0xf3, 0xff, 0xb0, 0xcc, 0xf2, 0xff, 0xb0, 0xcb, 0xf1, 0xff, 0xac, 0xc8, 0xf2, 0xff, 0xa6, 0xc4, 0xf0, 0xff, 0xa5, 0xc2, 0xee, 0xff, 0xa5, 0xc2, 0xef, 0xff, 0xa3, 0xc0, 0xed, 0xff, 0x9f, 0xbf, 0xec, 0xff, 0x9c, 0xbf, 0xeb, 0xff, 0x9a, 0xbe, 0xe9, 0xff, 0x9b, 0xba, 0xea, 0xff, 0xa6, 0xc6, 0xfb, 0xff, 0x98, 0xbb, 0xed, 0xff, 0x2a, 0x3a, 0x58, 0xff, 0x0e, 0x0d, 0x10, 0xff, 0x1c, 0x1e, 0x21, 0xff, 0x17, 0x18, 0x21, 0xff, 0x13, 0x12, 0x18, 0xff, 0x11, 0x13, 0x15, 0xff, 0x12, 0x14, 0x16, 0xff, 0x12, 0x13, 0x18, 0xff, 0x13, 0x14, 0x18, 0xff, 0x13, 0x14, 0x18, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x25, 0x26, 0x2b, 0xff, 0x1d, 0x1f, 0x21, 0xff, 0x17, 0x19, 0x1a, 0xff, 0x17, 0x1a, 0x1a, 0xff, 0x11, 0x13, 0x14, 0xff, 0x0c, 0x0d, 0x11, 0xff, 0x10, 0x11, 0x15, 0xff, 0x23, 0x24, 0x28, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x0d, 0x0e, 0x12, 0xff, 0x25, 0x26, 0x2b, 0xff, 0x24, 0x25, 0x29, 0xff, 0x19, 0x18, 0x1a, 0xff, 0x13, 0x12, 0x14, 0xff, 0x0e, 0x0d, 0x0f, 0xff, 0x0e, 0x0f, 0x13, 0xff, 0x12, 0x13, 0x16, 0xff, 0x12, 0x14, 0x17, 0xff, 0x1e, 0x1f, 0x22, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x20, 0x21, 0x25, 0xff, 0x27, 0x28, 0x2c, 0xff, 0x2b, 0x2c, 0x30, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x23, 0x23, 0x29, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x20, 0x22, 0x8d, 0x21, 0x24, 0x23, 0xff, 0x23, 0x25, 0x27, 0xff, 0x27, 0x28, 0x2c, 0xff, 0x28, 0x29, 0x2d, 0xff, 0x14, 0x15, 0x19, 0xff, 0x20, 0x21, 0x25, 0xff, 0x19, 0x1a, 0x1f, 0xff, 0x03, 0x04, 0x07, 0xff, 0x05, 0x07, 0x07, 0xff, 0x05, 0x07, 0x08, 0xff, 0x0d, 0x0f, 0x10, 0xff, 0x12, 0x14, 0x17, 0xff, 0x14, 0x14, 0x19, 0xff, 0x11, 0x12, 0x16, 0xff, 0x0f, 0x10, 0x14, 0xff, 0x0e, 0x0f, 0x14, 0xff, 0x11, 0x12, 0x16, 0xff, 0x11, 0x12, 0x16, 0xff, 0x11, 0x12, 0x16, 0xff, 0x14, 0x15, 0x19, 0xff, 0x12, 0x13, 0x17, 0xff, 0x16, 0x18, 0x1c, 0xff, 0x1c, 0x1f, 0x23, 0xff, 0x16, 0x18, 0x1f, 0xff, 0x2a, 0x2b, 0x35, 0xff, 0x27, 0x28, 0x33, 0xff, 0x18, 0x1a, 0x20, 0xff, 0x0b, 0x13, 0x14, 0xff, 0x1d, 0x2d, 0x40, 0xff, 0x95, 0xac, 0xd1, 0xff, 0xc3, 0xdc, 0xff, 0xff, 0xbe, 0xd5, 0xf9, 0xff, 0xb9, 0xcf, 0xf2, 0xff, 0xba, 0xd1, 0xf3, 0xff, 0xba, 0xd1, 0xf4, 0xff, 0xbc, 0xd3, 0xf4, 0xff, 0xbb, 0xd3, 0xf5, 0xff, 0xb5, 0xd0, 0xf4, 0xff, 0xb2, 0xcd, 0xf3, 0xff, 0xb0, 0xca, 0xf5, 0xff, 0xa9, 0xc5, 0xf2, 0xff, 0xa1, 0xc0, 0xef, 0xff, 0x9b, 0xbb, 0xec, 0xff, 0x97, 0xb9, 0xea, 0xff, 0x94, 0xbb, 0xec, 0xff, 0x96, 0xbd, 0xee, 0xff, 0x9c, 0xc0, 0xef, 0xff, 0xa2, 0xc3, 0xf1, 0xff, 0xa7, 0xc7, 0xf3, 0xff, 0xab, 0xc9, 0xf3, 0xff, 0xaa, 0xc9, 0xf2, 0xff, 0xaa, 0xc8, 0xf1, 0xff, 0xa9, 0xc7, 0xf2, 0xff, 0xa6, 0xc3, 0xf1, 0xff, 0xa3, 0xc1, 0xee, 0xff, 0xa4, 0xc1, 0xee, 0xff, 0xa3, 0xc0, 0xed, 0xff, 0x9f, 0xbf, 0xec, 0xff, 0x9b, 0xbe, 0xea, 0xff, 0x9c, 0xc0, 0xe9, 0xff, 0x9b, 0xbd, 0xee, 0xff, 0xae, 0xca, 0xfd, 0xff, 0x5a, 0x6f, 0x93, 0xff, 0x05, 0x09, 0x1b, 0xff, 0x1c, 0x1a, 0x1f, 0xff, 0x1d, 0x20, 0x27, 0xff, 0x17, 0x18, 0x22, 0xff, 0x0f, 0x0d, 0x14, 0xff, 0x11, 0x13, 0x14, 0xff, 0x14, 0x16, 0x17, 0xff, 0x14, 0x15, 0x19, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x13, 0x14, 0x18, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x25, 0x25, 0x2a, 0xff, 0x1f, 0x20, 0x22, 0xff, 0x14, 0x17, 0x17, 0xff, 0x13, 0x15, 0x16, 0xff, 0x14, 0x16, 0x17, 0xff, 0x0c, 0x0d, 0x11, 0xff, 0x12, 0x13, 0x17, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x13, 0x14, 0x18, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x22, 0x23, 0x27, 0xff, 0x2c, 0x2d, 0x30, 0xff, 0x17, 0x15, 0x17, 0xff, 0x07, 0x06, 0x08, 0xff, 0x10, 0x0e, 0x10, 0xff, 0x0e, 0x0e, 0x12, 0xff, 0x17, 0x18, 0x1d, 0xff, 0x18, 0x18, 0x1d, 0xff, 0x22, 0x23, 0x27, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x25, 0x26, 0x2b, 0xff, 0x27, 0x28, 0x2c, 0xff, 0x29, 0x2a, 0x2e, 0xff, 0x27, 0x27, 0x2b, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x19, 0x1c, 0x1b, 0xb1, 0x1c, 0x1d, 0x20, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x21, 0x21, 0x26, 0xff, 0x18, 0x19, 0x1e, 0xff, 0x15, 0x16, 0x19, 0xff, 0x22, 0x22, 0x27, 0xff, 0x08, 0x0a, 0x0d, 0xff, 0x03, 0x06, 0x06, 0xff, 0x03, 0x05, 0x06, 0xff, 0x0b, 0x0d, 0x0d, 0xff, 0x0e, 0x10, 0x13, 0xff, 0x12, 0x13, 0x18, 0xff, 0x10, 0x11, 0x16, 0xff, 0x0f, 0x10, 0x14, 0xff, 0x0e, 0x0f, 0x13, 0xff, 0x10, 0x11, 0x15, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x14, 0x15, 0x19, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x15, 0x17, 0x1b, 0xff, 0x15, 0x19, 0x1d, 0xff, 0x1e, 0x21, 0x28, 0xff, 0x20, 0x20, 0x2c, 0xff, 0x2a, 0x29, 0x35, 0xff, 0x1f, 0x28, 0x2c, 0xff, 0x1a, 0x1c, 0x24, 0xff, 0x15, 0x0b, 0x11, 0xff, 0x4d, 0x56, 0x6d, 0xff, 0xa5, 0xc3, 0xf1, 0xff, 0xc1, 0xd9, 0xfe, 0xff, 0xc9, 0xd7, 0xf7, 0xff, 0xc3, 0xd2, 0xf4, 0xff, 0xc2, 0xd3, 0xf6, 0xff, 0xc2, 0xd6, 0xf4, 0xff, 0xc2, 0xd7, 0xf4, 0xff, 0xbb, 0xd3, 0xf6, 0xff, 0xb8, 0xd1, 0xf4, 0xff, 0xb7, 0xd1, 0xf5, 0xff, 0xb0, 0xcb, 0xf2, 0xff, 0xaa, 0xc7, 0xf0, 0xff, 0xa4, 0xc4, 0xf3, 0xff, 0x9f, 0xc2, 0xf2, 0xff, 0x9d, 0xc2, 0xef, 0xff, 0x9c, 0xc3, 0xf2, 0xff, 0x9e, 0xc3, 0xf4, 0xff, 0xa4, 0xc4, 0xf3, 0xff, 0xa7, 0xc6, 0xf2, 0xff, 0xa7, 0xc7, 0xf4, 0xff, 0xa6, 0xc6, 0xf4, 0xff, 0xa5, 0xc6, 0xf2, 0xff, 0xa7, 0xc5, 0xf2, 0xff, 0xa7, 0xc2, 0xef, 0xff, 0xa4, 0xc0, 0xed, 0xff, 0xa4, 0xc0, 0xec, 0xff, 0xa4, 0xc0, 0xec, 0xff, 0xa0, 0xbf, 0xec, 0xff, 0x9b, 0xbf, 0xec, 0xff, 0x9b, 0xbf, 0xe7, 0xff, 0xa9, 0xce, 0xff, 0xff, 0x88, 0xa3, 0xd2, 0xff, 0x1a, 0x1e, 0x2c, 0xff, 0x19, 0x12, 0x15, 0xff, 0x1f, 0x20, 0x28, 0xff, 0x15, 0x19, 0x23, 0xff, 0x13, 0x12, 0x1c, 0xff, 0x11, 0x11, 0x17, 0xff, 0x13, 0x15, 0x16, 0xff, 0x13, 0x15, 0x16, 0xff, 0x15, 0x16, 0x1b, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x12, 0x13, 0x17, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x23, 0x24, 0x28, 0xff, 0x26, 0x27, 0x2b, 0xff, 0x1b, 0x1d, 0x1f, 0xff, 0x12, 0x15, 0x15, 0xff, 0x16, 0x18, 0x19, 0xff, 0x0e, 0x11, 0x12, 0xff, 0x0b, 0x0c, 0x10, 0xff, 0x14, 0x15, 0x19, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x0e, 0x10, 0x14, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x21, 0x23, 0x27, 0xff, 0x15, 0x16, 0x19, 0xff, 0x14, 0x11, 0x13, 0xff, 0x0c, 0x0b, 0x0c, 0xff, 0x11, 0x0f, 0x11, 0xff, 0x19, 0x1a, 0x1d, 0xff, 0x20, 0x22, 0x26, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x26, 0x27, 0x2b, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x25, 0x26, 0x2a, 0xff, 0x26, 0x27, 0x2b, 0xff, 0x25, 0x25, 0x29, 0xb1, 0x00, 0x00, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x33, 0x0a, 0x15, 0x15, 0x1d, 0xc8, 0x1f, 0x1f, 0x24, 0xff, 0x17, 0x19, 0x1b, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x0f, 0x10, 0x14, 0xff, 0x22, 0x22, 0x27, 0xff, 0x11, 0x11, 0x15, 0xff, 0x08, 0x09, 0x0a, 0xff, 0x09, 0x09, 0x0a, 0xff, 0x08, 0x08, 0x09, 0xff, 0x0a, 0x0b, 0x0d, 0xff, 0x12, 0x13, 0x15, 0xff, 0x13, 0x15, 0x17, 0xff, 0x10, 0x11, 0x14, 0xff, 0x0d, 0x0e, 0x12, 0xff, 0x0e, 0x0f, 0x13, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x12, 0x13, 0x17, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x1a, 0x1c, 0x20, 0xff, 0x21, 0x23, 0x29, 0xff, 0x1b, 0x1b, 0x23, 0xff, 0x22, 0x23, 0x29, 0xff, 0x25, 0x2d, 0x31, 0xff, 0x20, 0x20, 0x2b, 0xff, 0x21, 0x19, 0x1a, 0xff, 0x13, 0x18, 0x1f, 0xff, 0x63, 0x77, 0xa4, 0xff, 0xaa, 0xc3, 0xf9, 0xff, 0xba, 0xd6, 0xf6, 0xff, 0xc0, 0xd5, 0xf1, 0xff, 0xc4, 0xd4, 0xf2, 0xff, 0xc2, 0xd5, 0xf4, 0xff, 0xc1, 0xd6, 0xf6, 0xff, 0xc0, 0xd5, 0xf7, 0xff, 0xbc, 0xd3, 0xf5, 0xff, 0xb6, 0xd0, 0xf3, 0xff, 0xb4, 0xcf, 0xf2, 0xff, 0xb1, 0xcc, 0xf1, 0xff, 0xae, 0xc9, 0xf3, 0xff, 0xaa, 0xc7, 0xf3, 0xff, 0xa6, 0xc6, 0xf1, 0xff, 0xa4, 0xc5, 0xf3, 0xff, 0xa4, 0xc5, 0xf4, 0xff, 0xa4, 0xc5, 0xf3, 0xff, 0xa4, 0xc5, 0xf2, 0xff, 0xa3, 0xc5, 0xf2, 0xff, 0xa2, 0xc3, 0xf1, 0xff, 0xa1, 0xc3, 0xf0, 0xff, 0xa3, 0xc3, 0xf0, 0xff, 0xa3, 0xc2, 0xf0, 0xff, 0xa1, 0xc0, 0xed, 0xff, 0xa1, 0xc0, 0xee, 0xff, 0xa0, 0xc1, 0xf1, 0xff, 0x9d, 0xc0, 0xec, 0xff, 0xa1, 0xc1, 0xe8, 0xff, 0xa2, 0xc2, 0xf0, 0xff, 0xad, 0xcc, 0xff, 0xff, 0x41, 0x50, 0x6e, 0xff, 0x09, 0x05, 0x08, 0xff, 0x29, 0x23, 0x25, 0xff, 0x23, 0x25, 0x2b, 0xff, 0x14, 0x18, 0x1d, 0xff, 0x10, 0x10, 0x16, 0xff, 0x15, 0x15, 0x1a, 0xff, 0x15, 0x17, 0x19, 0xff, 0x14, 0x16, 0x18, 0xff, 0x15, 0x16, 0x1b, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x24, 0x25, 0x29, 0xff, 0x23, 0x24, 0x28, 0xff, 0x1b, 0x1c, 0x1f, 0xff, 0x14, 0x14, 0x15, 0xff, 0x17, 0x17, 0x18, 0xff, 0x0d, 0x0d, 0x0e, 0xff, 0x10, 0x11, 0x15, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x13, 0x14, 0x18, 0xff, 0x10, 0x10, 0x14, 0xff, 0x1f, 0x1f, 0x22, 0xff, 0x27, 0x27, 0x2a, 0xff, 0x0a, 0x0b, 0x0d, 0xff, 0x08, 0x08, 0x0a, 0xff, 0x0e, 0x0e, 0x11, 0xff, 0x1a, 0x1a, 0x1d, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x23, 0x24, 0x28, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x24, 0x25, 0x29, 0xff, 0x21, 0x22, 0x26, 0xff, 0x25, 0x26, 0x2a, 0xff, 0x2c, 0x2c, 0x30, 0xc8, 0x19, 0x19, 0x33, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x15, 0x1c, 0x1b, 0x20, 0xd7, 0x17, 0x19, 0x1a, 0xff, 0x11, 0x13, 0x15, 0xff, 0x11, 0x12, 0x17, 0xff, 0x1c, 0x1e, 0x22, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x09, 0x08, 0x0a, 0xff, 0x0a, 0x08, 0x0b, 0xff, 0x06, 0x05, 0x07, 0xff, 0x08, 0x09, 0x0b, 0xff, 0x0e, 0x11, 0x11, 0xff, 0x15, 0x17, 0x17, 0xff, 0x11, 0x12, 0x13, 0xff, 0x0d, 0x0d, 0x12, 0xff, 0x0f, 0x10, 0x14, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x13, 0x14, 0x18, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1c, 0x1c, 0x20, 0xff, 0x1c, 0x1c, 0x20, 0xff, 0x1c, 0x1d, 0x20, 0xff, 0x20, 0x24, 0x27, 0xff, 0x2c, 0x2e, 0x33, 0xff, 0x22, 0x22, 0x2c, 0xff, 0x18, 0x1c, 0x23, 0xff, 0x0d, 0x11, 0x10, 0xff, 0x22, 0x2d, 0x3e, 0xff, 0x7b, 0x94, 0xc5, 0xff, 0x99, 0xba, 0xee, 0xff, 0xb3, 0xce, 0xf3, 0xff, 0xbb, 0xd2, 0xec, 0xff, 0xbb, 0xd1, 0xf2, 0xff, 0xbc, 0xd2, 0xf7, 0xff, 0xbe, 0xd3, 0xf6, 0xff, 0xb9, 0xd0, 0xf3, 0xff, 0xb4, 0xce, 0xf2, 0xff, 0xb6, 0xcf, 0xf3, 0xff, 0xb4, 0xce, 0xf1, 0xff, 0xb2, 0xcb, 0xee, 0xff, 0xb1, 0xca, 0xf0, 0xff, 0xad, 0xc8, 0xf2, 0xff, 0xaa, 0xc5, 0xf2, 0xff, 0xa8, 0xc5, 0xf2, 0xff, 0xa4, 0xc5, 0xf2, 0xff, 0xa2, 0xc6, 0xf2, 0xff, 0xa3, 0xc4, 0xf1, 0xff, 0xa0, 0xc1, 0xee, 0xff, 0xa1, 0xc2, 0xef, 0xff, 0xa0, 0xc2, 0xf0, 0xff, 0x9e, 0xc1, 0xf0, 0xff, 0x9d, 0xc1, 0xee, 0xff, 0x9f, 0xbf, 0xef, 0xff, 0x9e, 0xbc, 0xf0, 0xff, 0x98, 0xc1, 0xed, 0xff, 0x9b, 0xc1, 0xe3, 0xff, 0xaa, 0xd2, 0xff, 0xff, 0x74, 0x92, 0xbc, 0xff, 0x10, 0x13, 0x20, 0xff, 0x20, 0x1a, 0x1f, 0xff, 0x23, 0x23, 0x2c, 0xff, 0x1c, 0x1d, 0x20, 0xff, 0x14, 0x16, 0x15, 0xff, 0x16, 0x17, 0x1a, 0xff, 0x15, 0x16, 0x1b, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x13, 0x14, 0x18, 0xff, 0x14, 0x15, 0x19, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x21, 0x22, 0x26, 0xff, 0x1f, 0x20, 0x25, 0xff, 0x20, 0x20, 0x23, 0xff, 0x16, 0x15, 0x17, 0xff, 0x17, 0x16, 0x18, 0xff, 0x0c, 0x0b, 0x0e, 0xff, 0x10, 0x11, 0x15, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x14, 0x15, 0x1a, 0xff, 0x10, 0x0f, 0x11, 0xff, 0x1d, 0x1c, 0x1c, 0xff, 0x1f, 0x1d, 0x1e, 0xff, 0x04, 0x04, 0x07, 0xff, 0x08, 0x0a, 0x0e, 0xff, 0x14, 0x15, 0x1a, 0xff, 0x21, 0x22, 0x26, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x21, 0x22, 0x26, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x21, 0x22, 0x25, 0xd8, 0x24, 0x24, 0x30, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x1b, 0x1c, 0x18, 0x19, 0x1a, 0xdc, 0x13, 0x15, 0x17, 0xff, 0x14, 0x15, 0x19, 0xff, 0x1b, 0x1d, 0x21, 0xff, 0x22, 0x23, 0x27, 0xff, 0x0a, 0x09, 0x0a, 0xff, 0x09, 0x07, 0x09, 0xff, 0x08, 0x06, 0x08, 0xff, 0x0a, 0x0b, 0x0d, 0xff, 0x0c, 0x0e, 0x0f, 0xff, 0x10, 0x13, 0x13, 0xff, 0x12, 0x14, 0x16, 0xff, 0x0f, 0x10, 0x14, 0xff, 0x0e, 0x0f, 0x13, 0xff, 0x13, 0x14, 0x18, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x21, 0x22, 0x26, 0xff, 0x20, 0x23, 0x26, 0xff, 0x1d, 0x20, 0x25, 0xff, 0x2e, 0x30, 0x39, 0xff, 0x1f, 0x1f, 0x2e, 0xff, 0x17, 0x18, 0x1d, 0xff, 0x0b, 0x11, 0x0d, 0xff, 0x40, 0x4d, 0x62, 0xff, 0x8a, 0x9e, 0xdc, 0xff, 0x96, 0xb4, 0xed, 0xff, 0xae, 0xcc, 0xee, 0xff, 0xb7, 0xd0, 0xed, 0xff, 0xb8, 0xd1, 0xf2, 0xff, 0xb6, 0xd0, 0xf1, 0xff, 0xb4, 0xce, 0xf0, 0xff, 0xb5, 0xcf, 0xf3, 0xff, 0xb5, 0xcf, 0xf3, 0xff, 0xb3, 0xcd, 0xf1, 0xff, 0xb2, 0xcc, 0xef, 0xff, 0xb0, 0xca, 0xee, 0xff, 0xac, 0xca, 0xf0, 0xff, 0xa9, 0xc7, 0xf1, 0xff, 0xa7, 0xc4, 0xf2, 0xff, 0xa4, 0xc5, 0xf2, 0xff, 0xa2, 0xc6, 0xf2, 0xff, 0xa3, 0xc4, 0xf1, 0xff, 0xa1, 0xc2, 0xef, 0xff, 0xa1, 0xc2, 0xef, 0xff, 0xa0, 0xc2, 0xef, 0xff, 0x9e, 0xc0, 0xee, 0xff, 0x9d, 0xc0, 0xed, 0xff, 0xa0, 0xbe, 0xee, 0xff, 0x9e, 0xba, 0xed, 0xff, 0x94, 0xbd, 0xeb, 0xff, 0xa1, 0xcc, 0xfa, 0xff, 0x97, 0xc1, 0xea, 0xff, 0x24, 0x3b, 0x51, 0xff, 0x05, 0x06, 0x10, 0xff, 0x23, 0x20, 0x2b, 0xff, 0x21, 0x20, 0x28, 0xff, 0x0f, 0x10, 0x14, 0xff, 0x11, 0x13, 0x14, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x21, 0x22, 0x26, 0xff, 0x1c, 0x1d, 0x22, 0xff, 0x22, 0x22, 0x25, 0xff, 0x19, 0x18, 0x1a, 0xff, 0x16, 0x15, 0x16, 0xff, 0x0c, 0x0c, 0x0e, 0xff, 0x0f, 0x10, 0x15, 0xff, 0x20, 0x22, 0x26, 0xff, 0x12, 0x14, 0x18, 0xff, 0x0f, 0x0f, 0x11, 0xff, 0x1c, 0x1a, 0x1c, 0xff, 0x11, 0x0f, 0x11, 0xff, 0x02, 0x01, 0x04, 0xff, 0x13, 0x15, 0x18, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x24, 0x25, 0x29, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x21, 0x22, 0x26, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x1f, 0x20, 0x23, 0xdd, 0x24, 0x24, 0x24, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x1e, 0x1e, 0x21, 0x14, 0x16, 0x19, 0xde, 0x12, 0x13, 0x16, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x2c, 0x2d, 0x32, 0xff, 0x11, 0x0f, 0x12, 0xff, 0x0a, 0x09, 0x0b, 0xff, 0x08, 0x07, 0x09, 0xff, 0x09, 0x0a, 0x0b, 0xff, 0x06, 0x09, 0x0a, 0xff, 0x0c, 0x0d, 0x0e, 0xff, 0x13, 0x14, 0x16, 0xff, 0x10, 0x11, 0x15, 0xff, 0x0d, 0x0e, 0x12, 0xff, 0x12, 0x13, 0x17, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x20, 0x21, 0x25, 0xff, 0x20, 0x23, 0x26, 0xff, 0x14, 0x17, 0x1c, 0xff, 0x22, 0x23, 0x2c, 0xff, 0x2b, 0x2c, 0x39, 0xff, 0x23, 0x22, 0x28, 0xff, 0x1d, 0x19, 0x1a, 0xff, 0x11, 0x0f, 0x20, 0xff, 0x5a, 0x6b, 0x92, 0xff, 0x82, 0xa8, 0xdf, 0xff, 0x91, 0xb8, 0xe8, 0xff, 0xad, 0xca, 0xed, 0xff, 0xb0, 0xcc, 0xed, 0xff, 0xb3, 0xcf, 0xf1, 0xff, 0xb4, 0xd0, 0xf2, 0xff, 0xb5, 0xcf, 0xf3, 0xff, 0xb5, 0xcf, 0xf3, 0xff, 0xb3, 0xcd, 0xf1, 0xff, 0xb2, 0xcd, 0xee, 0xff, 0xb1, 0xcc, 0xef, 0xff, 0xad, 0xcc, 0xef, 0xff, 0xab, 0xc9, 0xf1, 0xff, 0xa7, 0xc4, 0xf2, 0xff, 0xa4, 0xc5, 0xf2, 0xff, 0xa4, 0xc6, 0xf2, 0xff, 0xa4, 0xc5, 0xf1, 0xff, 0xa2, 0xc3, 0xf0, 0xff, 0xa2, 0xc2, 0xef, 0xff, 0xa0, 0xc1, 0xef, 0xff, 0x9c, 0xbf, 0xee, 0xff, 0x9d, 0xbf, 0xec, 0xff, 0x9c, 0xbe, 0xec, 0xff, 0x99, 0xc1, 0xf0, 0xff, 0x97, 0xc2, 0xf3, 0xff, 0xaa, 0xcf, 0xff, 0xff, 0x5d, 0x70, 0x94, 0xff, 0x0c, 0x0a, 0x12, 0xff, 0x1d, 0x1a, 0x1f, 0xff, 0x1a, 0x1e, 0x2b, 0xff, 0x1e, 0x1d, 0x25, 0xff, 0x10, 0x11, 0x15, 0xff, 0x15, 0x17, 0x18, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x14, 0x15, 0x19, 0xff, 0x20, 0x21, 0x25, 0xff, 0x27, 0x28, 0x2c, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x20, 0x20, 0x23, 0xff, 0x1c, 0x1a, 0x1c, 0xff, 0x13, 0x12, 0x14, 0xff, 0x0c, 0x0c, 0x0e, 0xff, 0x11, 0x12, 0x16, 0xff, 0x22, 0x23, 0x27, 0xff, 0x12, 0x13, 0x16, 0xff, 0x0c, 0x0c, 0x0f, 0xff, 0x14, 0x13, 0x15, 0xff, 0x0a, 0x09, 0x0a, 0xff, 0x0c, 0x0c, 0x0e, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x23, 0x24, 0x28, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x20, 0x21, 0x25, 0xff, 0x1b, 0x1b, 0x20, 0xde, 0x26, 0x26, 0x26, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x1d, 0x27, 0x1a, 0x10, 0x11, 0x12, 0xd7, 0x12, 0x13, 0x15, 0xff, 0x29, 0x28, 0x33, 0xff, 0x17, 0x16, 0x1f, 0xff, 0x0a, 0x0b, 0x10, 0xff, 0x0a, 0x0d, 0x0e, 0xff, 0x09, 0x09, 0x0b, 0xff, 0x06, 0x06, 0x08, 0xff, 0x0c, 0x0b, 0x0d, 0xff, 0x16, 0x15, 0x18, 0xff, 0x14, 0x14, 0x18, 0xff, 0x0e, 0x0f, 0x13, 0xff, 0x0c, 0x0d, 0x11, 0xff, 0x12, 0x13, 0x17, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x1e, 0x21, 0x26, 0xff, 0x1c, 0x1f, 0x23, 0xff, 0x1f, 0x22, 0x26, 0xff, 0x22, 0x25, 0x29, 0xff, 0x2b, 0x2e, 0x32, 0xff, 0x1f, 0x1f, 0x28, 0xff, 0x10, 0x0e, 0x15, 0xff, 0x23, 0x28, 0x2f, 0xff, 0x74, 0x8d, 0xb4, 0xff, 0x7a, 0xa7, 0xea, 0xff, 0x8f, 0xb4, 0xed, 0xff, 0xa7, 0xc6, 0xf2, 0xff, 0xab, 0xcb, 0xf4, 0xff, 0xb0, 0xce, 0xf2, 0xff, 0xb2, 0xce, 0xf3, 0xff, 0xb2, 0xcf, 0xf4, 0xff, 0xb0, 0xcd, 0xf2, 0xff, 0xae, 0xcb, 0xf0, 0xff, 0xb0, 0xcd, 0xf2, 0xff, 0xaf, 0xcc, 0xf1, 0xff, 0xaf, 0xcc, 0xf1, 0xff, 0xac, 0xc9, 0xf0, 0xff, 0xa9, 0xc4, 0xf0, 0xff, 0xaa, 0xc3, 0xf2, 0xff, 0xa8, 0xc6, 0xf0, 0xff, 0xa5, 0xc6, 0xf1, 0xff, 0xa1, 0xc2, 0xf0, 0xff, 0x9c, 0xc0, 0xf1, 0xff, 0x99, 0xbf, 0xf1, 0xff, 0x9c, 0xc0, 0xef, 0xff, 0x9f, 0xc0, 0xec, 0xff, 0x99, 0xbc, 0xe9, 0xff, 0xaa, 0xd1, 0xff, 0xff, 0x87, 0xac, 0xdf, 0xff, 0x1f, 0x26, 0x3a, 0xff, 0x11, 0x0b, 0x0e, 0xff, 0x21, 0x1d, 0x27, 0xff, 0x21, 0x1d, 0x29, 0xff, 0x19, 0x18, 0x20, 0xff, 0x15, 0x15, 0x19, 0xff, 0x19, 0x1b, 0x1b, 0xff, 0x16, 0x18, 0x1b, 0xff, 0x15, 0x16, 0x1b, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x27, 0x28, 0x2c, 0xff, 0x1a, 0x1c, 0x20, 0xff, 0x20, 0x20, 0x23, 0xff, 0x1b, 0x19, 0x1b, 0xff, 0x0e, 0x0d, 0x0f, 0xff, 0x08, 0x07, 0x09, 0xff, 0x15, 0x14, 0x16, 0xff, 0x1f, 0x1e, 0x20, 0xff, 0x0e, 0x0d, 0x0f, 0xff, 0x09, 0x0b, 0x0c, 0xff, 0x09, 0x0b, 0x0c, 0xff, 0x0b, 0x0c, 0x0d, 0xff, 0x15, 0x16, 0x19, 0xff, 0x1e, 0x1f, 0x24, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x20, 0x21, 0x25, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x23, 0x23, 0x28, 0xd7, 0x1c, 0x1c, 0x1c, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 0x17, 0x16, 0x10, 0x11, 0x12, 0xca, 0x28, 0x26, 0x32, 0xff, 0x20, 0x1f, 0x29, 0xff, 0x0c, 0x0d, 0x12, 0xff, 0x07, 0x0a, 0x0a, 0xff, 0x06, 0x06, 0x08, 0xff, 0x08, 0x07, 0x09, 0xff, 0x09, 0x07, 0x09, 0xff, 0x13, 0x12, 0x15, 0xff, 0x16, 0x17, 0x1c, 0xff, 0x11, 0x12, 0x16, 0xff, 0x0a, 0x0b, 0x0f, 0xff, 0x11, 0x12, 0x16, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x18, 0x1a, 0x1e, 0xff, 0x1c, 0x1f, 0x23, 0xff, 0x1c, 0x1f, 0x23, 0xff, 0x1f, 0x22, 0x26, 0xff, 0x20, 0x23, 0x26, 0xff, 0x2a, 0x2e, 0x32, 0xff, 0x22, 0x24, 0x2c, 0xff, 0x18, 0x18, 0x1f, 0xff, 0x0d, 0x0e, 0x12, 0xff, 0x39, 0x44, 0x5a, 0xff, 0x82, 0xa1, 0xd3, 0xff, 0x7f, 0xa4, 0xdc, 0xff, 0x97, 0xb9, 0xeb, 0xff, 0xa3, 0xc5, 0xf0, 0xff, 0xab, 0xcb, 0xf2, 0xff, 0xaf, 0xcc, 0xf0, 0xff, 0xb0, 0xcd, 0xf2, 0xff, 0xaf, 0xcd, 0xf2, 0xff, 0xae, 0xcb, 0xf0, 0xff, 0xb0, 0xcd, 0xf2, 0xff, 0xb0, 0xcd, 0xf1, 0xff, 0xae, 0xcb, 0xf1, 0xff, 0xae, 0xca, 0xf2, 0xff, 0xab, 0xc6, 0xf2, 0xff, 0xaa, 0xc3, 0xf2, 0xff, 0xa6, 0xc4, 0xee, 0xff, 0xa3, 0xc4, 0xef, 0xff, 0x9f, 0xc0, 0xee, 0xff, 0x9a, 0xbe, 0xf0, 0xff, 0x9a, 0xc0, 0xf2, 0xff, 0x9e, 0xc1, 0xf0, 0xff, 0x9d, 0xbe, 0xeb, 0xff, 0xa4, 0xc6, 0xf4, 0xff, 0xb1, 0xd1, 0xfd, 0xff, 0x3a, 0x50, 0x6e, 0xff, 0x00, 0x04, 0x0f, 0xff, 0x1f, 0x1d, 0x24, 0xff, 0x1f, 0x1b, 0x27, 0xff, 0x1b, 0x16, 0x21, 0xff, 0x16, 0x15, 0x1d, 0xff, 0x17, 0x17, 0x1b, 0xff, 0x1d, 0x1f, 0x1f, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x26, 0x27, 0x2b, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1b, 0x1b, 0x1e, 0xff, 0x1e, 0x1d, 0x1e, 0xff, 0x0d, 0x0c, 0x0e, 0xff, 0x08, 0x07, 0x09, 0xff, 0x15, 0x14, 0x16, 0xff, 0x19, 0x18, 0x1a, 0xff, 0x10, 0x0e, 0x10, 0xff, 0x0b, 0x0c, 0x0d, 0xff, 0x03, 0x06, 0x06, 0xff, 0x13, 0x15, 0x15, 0xff, 0x1b, 0x1d, 0x1f, 0xff, 0x21, 0x22, 0x26, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x23, 0x24, 0x28, 0xff, 0x1a, 0x1a, 0x1f, 0xca, 0x22, 0x22, 0x22, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 0x17, 0x0b, 0x2a, 0x27, 0x33, 0xaf, 0x2b, 0x2a, 0x34, 0xff, 0x13, 0x14, 0x18, 0xff, 0x0c, 0x0f, 0x0f, 0xff, 0x05, 0x05, 0x06, 0xff, 0x07, 0x05, 0x07, 0xff, 0x04, 0x03, 0x04, 0xff, 0x0d, 0x0d, 0x10, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x13, 0x14, 0x18, 0xff, 0x0c, 0x0d, 0x11, 0xff, 0x0f, 0x10, 0x14, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1a, 0x1d, 0x21, 0xff, 0x20, 0x23, 0x27, 0xff, 0x1f, 0x22, 0x26, 0xff, 0x1e, 0x21, 0x25, 0xff, 0x25, 0x28, 0x2c, 0xff, 0x2d, 0x2e, 0x37, 0xff, 0x18, 0x19, 0x25, 0xff, 0x1b, 0x1a, 0x1d, 0xff, 0x17, 0x13, 0x15, 0xff, 0x4b, 0x58, 0x74, 0xff, 0x80, 0xa6, 0xe0, 0xff, 0x83, 0xaa, 0xe1, 0xff, 0x9a, 0xbd, 0xea, 0xff, 0xa5, 0xc6, 0xef, 0xff, 0xae, 0xca, 0xec, 0xff, 0xb0, 0xcc, 0xf1, 0xff, 0xaf, 0xcc, 0xf1, 0xff, 0xad, 0xcb, 0xf0, 0xff, 0xb0, 0xcd, 0xf2, 0xff, 0xb0, 0xcd, 0xf1, 0xff, 0xae, 0xcb, 0xf1, 0xff, 0xae, 0xcc, 0xf3, 0xff, 0xad, 0xc8, 0xf5, 0xff, 0xa9, 0xc3, 0xf2, 0xff, 0xa7, 0xc5, 0xee, 0xff, 0xa4, 0xc5, 0xf0, 0xff, 0xa0, 0xc1, 0xef, 0xff, 0x98, 0xbc, 0xef, 0xff, 0x98, 0xc0, 0xf3, 0xff, 0x9f, 0xc2, 0xf1, 0xff, 0x9f, 0xc0, 0xef, 0xff, 0xb0, 0xd6, 0xff, 0xff, 0x60, 0x7c, 0xa2, 0xff, 0x0b, 0x0d, 0x12, 0xff, 0x1c, 0x1a, 0x1d, 0xff, 0x1d, 0x1e, 0x2b, 0xff, 0x20, 0x1c, 0x28, 0xff, 0x19, 0x15, 0x21, 0xff, 0x18, 0x17, 0x20, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1a, 0x1c, 0x1b, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x16, 0x16, 0x1b, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x22, 0x23, 0x27, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1b, 0x1a, 0x1d, 0xff, 0x21, 0x20, 0x22, 0xff, 0x0d, 0x0c, 0x0e, 0xff, 0x09, 0x08, 0x0a, 0xff, 0x16, 0x15, 0x17, 0xff, 0x13, 0x11, 0x14, 0xff, 0x12, 0x11, 0x13, 0xff, 0x0b, 0x0d, 0x0e, 0xff, 0x07, 0x0a, 0x0a, 0xff, 0x17, 0x1a, 0x19, 0xff, 0x1c, 0x1e, 0x20, 0xff, 0x24, 0x24, 0x29, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1f, 0x21, 0x25, 0xb0, 0x17, 0x17, 0x17, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x03, 0x31, 0x31, 0x37, 0x8b, 0x1e, 0x1e, 0x22, 0xff, 0x16, 0x18, 0x1b, 0xff, 0x07, 0x07, 0x09, 0xff, 0x08, 0x06, 0x08, 0xff, 0x04, 0x03, 0x05, 0xff, 0x0a, 0x09, 0x0c, 0xff, 0x14, 0x15, 0x19, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x0f, 0x10, 0x14, 0xff, 0x0e, 0x0f, 0x13, 0xff, 0x10, 0x11, 0x15, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1b, 0x1e, 0x22, 0xff, 0x20, 0x23, 0x27, 0xff, 0x1c, 0x1f, 0x23, 0xff, 0x1b, 0x1e, 0x22, 0xff, 0x18, 0x1b, 0x1f, 0xff, 0x2b, 0x2d, 0x33, 0xff, 0x23, 0x26, 0x2c, 0xff, 0x18, 0x1d, 0x1c, 0xff, 0x15, 0x15, 0x15, 0xff, 0x0f, 0x12, 0x1b, 0xff, 0x5c, 0x73, 0x99, 0xff, 0x86, 0xae, 0xec, 0xff, 0x90, 0xb6, 0xe6, 0xff, 0xaa, 0xc8, 0xe9, 0xff, 0xa8, 0xc7, 0xf1, 0xff, 0xab, 0xc9, 0xf1, 0xff, 0xaf, 0xcc, 0xf2, 0xff, 0xb1, 0xcd, 0xf1, 0xff, 0xb1, 0xce, 0xf1, 0xff, 0xb0, 0xcc, 0xef, 0xff, 0xaf, 0xcb, 0xf1, 0xff, 0xb0, 0xca, 0xf4, 0xff, 0xb0, 0xc9, 0xf5, 0xff, 0xac, 0xc6, 0xf2, 0xff, 0xaa, 0xc7, 0xf2, 0xff, 0xa7, 0xc7, 0xf3, 0xff, 0xa3, 0xc5, 0xf1, 0xff, 0xa0, 0xc3, 0xf2, 0xff, 0xa0, 0xc1, 0xef, 0xff, 0x9d, 0xc0, 0xea, 0xff, 0xaf, 0xd7, 0xff, 0xff, 0x81, 0xa1, 0xd1, 0xff, 0x13, 0x1d, 0x30, 0xff, 0x1a, 0x16, 0x15, 0xff, 0x20, 0x1f, 0x23, 0xff, 0x1e, 0x1f, 0x26, 0xff, 0x18, 0x17, 0x1d, 0xff, 0x16, 0x15, 0x1c, 0xff, 0x17, 0x18, 0x1d, 0xff, 0x18, 0x19, 0x1c, 0xff, 0x19, 0x1a, 0x1d, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x20, 0x21, 0x25, 0xff, 0x1e, 0x1f, 0x24, 0xff, 0x1b, 0x1b, 0x1e, 0xff, 0x23, 0x22, 0x23, 0xff, 0x0c, 0x0b, 0x0d, 0xff, 0x08, 0x07, 0x09, 0xff, 0x16, 0x15, 0x17, 0xff, 0x11, 0x10, 0x12, 0xff, 0x0c, 0x0b, 0x0d, 0xff, 0x09, 0x0a, 0x0c, 0xff, 0x0f, 0x11, 0x14, 0xff, 0x1b, 0x1d, 0x1f, 0xff, 0x1a, 0x1c, 0x1f, 0xff, 0x22, 0x23, 0x27, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x17, 0x19, 0x1d, 0x8b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x29, 0x2e, 0x57, 0x17, 0x18, 0x1d, 0xf3, 0x05, 0x04, 0x08, 0xff, 0x09, 0x08, 0x09, 0xff, 0x07, 0x06, 0x08, 0xff, 0x08, 0x07, 0x0a, 0xff, 0x10, 0x12, 0x16, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x13, 0x14, 0x18, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x0f, 0x10, 0x14, 0xff, 0x14, 0x15, 0x19, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1d, 0x20, 0x24, 0xff, 0x1a, 0x1d, 0x21, 0xff, 0x1b, 0x1e, 0x22, 0xff, 0x1c, 0x1f, 0x23, 0xff, 0x19, 0x1c, 0x20, 0xff, 0x1c, 0x20, 0x23, 0xff, 0x2c, 0x2e, 0x32, 0xff, 0x20, 0x21, 0x28, 0xff, 0x1c, 0x1e, 0x23, 0xff, 0x19, 0x17, 0x13, 0xff, 0x1d, 0x23, 0x23, 0xff, 0x69, 0x86, 0xae, 0xff, 0x8a, 0xb6, 0xf6, 0xff, 0x92, 0xba, 0xef, 0xff, 0xa7, 0xc7, 0xf4, 0xff, 0xab, 0xca, 0xf4, 0xff, 0xad, 0xca, 0xf1, 0xff, 0xb2, 0xcd, 0xf0, 0xff, 0xb3, 0xce, 0xf0, 0xff, 0xb1, 0xcc, 0xee, 0xff, 0xb1, 0xcb, 0xf1, 0xff, 0xb1, 0xca, 0xf5, 0xff, 0xb1, 0xcb, 0xf3, 0xff, 0xb0, 0xc9, 0xf1, 0xff, 0xae, 0xc8, 0xf3, 0xff, 0xaa, 0xc8, 0xf2, 0xff, 0xa5, 0xc8, 0xf1, 0xff, 0xa9, 0xc8, 0xf0, 0xff, 0xa5, 0xc2, 0xed, 0xff, 0xaa, 0xd2, 0xff, 0xff, 0x97, 0xc0, 0xed, 0xff, 0x2a, 0x34, 0x48, 0xff, 0x14, 0x0e, 0x0e, 0xff, 0x24, 0x23, 0x2a, 0xff, 0x1a, 0x1c, 0x24, 0xff, 0x1c, 0x1c, 0x1e, 0xff, 0x0f, 0x11, 0x14, 0xff, 0x17, 0x18, 0x1b, 0xff, 0x16, 0x18, 0x1b, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x1a, 0x1b, 0x20, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x20, 0x21, 0x25, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x21, 0x22, 0x27, 0xff, 0x1a, 0x1a, 0x1d, 0xff, 0x21, 0x20, 0x21, 0xff, 0x0a, 0x09, 0x0b, 0xff, 0x07, 0x06, 0x08, 0xff, 0x18, 0x17, 0x19, 0xff, 0x17, 0x16, 0x18, 0xff, 0x0a, 0x09, 0x0a, 0xff, 0x06, 0x06, 0x0a, 0xff, 0x11, 0x12, 0x18, 0xff, 0x23, 0x24, 0x29, 0xff, 0x1f, 0x20, 0x25, 0xff, 0x1e, 0x1f, 0x22, 0xf3, 0x26, 0x26, 0x29, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 0x1d, 0x2b, 0x0a, 0x0a, 0x0d, 0xd2, 0x0c, 0x0b, 0x0c, 0xff, 0x07, 0x06, 0x08, 0xff, 0x04, 0x03, 0x06, 0xff, 0x0b, 0x0c, 0x11, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x0e, 0x0f, 0x13, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x21, 0x22, 0x26, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x20, 0x21, 0x25, 0xff, 0x19, 0x1d, 0x21, 0xff, 0x18, 0x1b, 0x1f, 0xff, 0x1b, 0x1f, 0x23, 0xff, 0x1e, 0x21, 0x25, 0xff, 0x1c, 0x20, 0x24, 0xff, 0x1f, 0x23, 0x26, 0xff, 0x2a, 0x2c, 0x31, 0xff, 0x2e, 0x2b, 0x35, 0xff, 0x24, 0x22, 0x28, 0xff, 0x20, 0x20, 0x1f, 0xff, 0x10, 0x13, 0x0e, 0xff, 0x1f, 0x28, 0x33, 0xff, 0x75, 0x94, 0xc7, 0xff, 0x8f, 0xbb, 0xf9, 0xff, 0xa0, 0xbe, 0xe9, 0xff, 0xab, 0xc9, 0xf2, 0xff, 0xac, 0xca, 0xf3, 0xff, 0xb0, 0xcc, 0xf1, 0xff, 0xb2, 0xcd, 0xf0, 0xff, 0xb2, 0xce, 0xf1, 0xff, 0xb1, 0xcd, 0xf0, 0xff, 0xb1, 0xcd, 0xf1, 0xff, 0xb3, 0xce, 0xf2, 0xff, 0xb2, 0xcd, 0xf1, 0xff, 0xb1, 0xc9, 0xf1, 0xff, 0xad, 0xc9, 0xf1, 0xff, 0xaa, 0xc9, 0xf1, 0xff, 0xa7, 0xc6, 0xeb, 0xff, 0xb0, 0xd4, 0xff, 0xff, 0xa9, 0xce, 0xfc, 0xff, 0x37, 0x47, 0x60, 0xff, 0x15, 0x10, 0x10, 0xff, 0x20, 0x1d, 0x20, 0xff, 0x20, 0x21, 0x2b, 0xff, 0x1e, 0x1f, 0x26, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x14, 0x15, 0x19, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x1c, 0x1c, 0x1f, 0xff, 0x20, 0x1f, 0x21, 0xff, 0x0c, 0x0b, 0x0d, 0xff, 0x08, 0x07, 0x09, 0xff, 0x16, 0x15, 0x17, 0xff, 0x16, 0x14, 0x16, 0xff, 0x08, 0x06, 0x07, 0xff, 0x08, 0x08, 0x0b, 0xff, 0x15, 0x16, 0x1b, 0xff, 0x25, 0x26, 0x2a, 0xff, 0x1b, 0x1d, 0x20, 0xd2, 0x17, 0x17, 0x1c, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x08, 0x10, 0x0e, 0x11, 0x8f, 0x06, 0x05, 0x07, 0xfe, 0x01, 0x01, 0x03, 0xff, 0x07, 0x07, 0x0c, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x0d, 0x0e, 0x12, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x20, 0x21, 0x25, 0xff, 0x1a, 0x1c, 0x20, 0xff, 0x1b, 0x1e, 0x22, 0xff, 0x21, 0x24, 0x28, 0xff, 0x20, 0x22, 0x26, 0xff, 0x1b, 0x1e, 0x22, 0xff, 0x22, 0x24, 0x29, 0xff, 0x21, 0x24, 0x26, 0xff, 0x25, 0x2b, 0x2b, 0xff, 0x28, 0x2e, 0x32, 0xff, 0x1b, 0x20, 0x27, 0xff, 0x17, 0x1c, 0x24, 0xff, 0x12, 0x0d, 0x12, 0xff, 0x25, 0x2a, 0x36, 0xff, 0x7f, 0xa2, 0xc6, 0xff, 0x9a, 0xc3, 0xf9, 0xff, 0x99, 0xba, 0xe6, 0xff, 0xb3, 0xcc, 0xed, 0xff, 0xb1, 0xcc, 0xec, 0xff, 0xb0, 0xcd, 0xef, 0xff, 0xb3, 0xce, 0xf1, 0xff, 0xb1, 0xcc, 0xef, 0xff, 0xb1, 0xcd, 0xef, 0xff, 0xb3, 0xcf, 0xf1, 0xff, 0xb3, 0xce, 0xf2, 0xff, 0xb2, 0xcb, 0xf2, 0xff, 0xb0, 0xc9, 0xec, 0xff, 0xb2, 0xca, 0xe9, 0xff, 0xb4, 0xd6, 0xfc, 0xff, 0xa9, 0xd1, 0xff, 0xff, 0x45, 0x58, 0x74, 0xff, 0x0b, 0x08, 0x0a, 0xff, 0x20, 0x1f, 0x23, 0xff, 0x27, 0x2a, 0x33, 0xff, 0x21, 0x22, 0x29, 0xff, 0x16, 0x16, 0x19, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x1e, 0x1d, 0x20, 0xff, 0x21, 0x20, 0x21, 0xff, 0x0c, 0x0b, 0x0d, 0xff, 0x0b, 0x0a, 0x0c, 0xff, 0x16, 0x15, 0x17, 0xff, 0x11, 0x10, 0x12, 0xff, 0x06, 0x05, 0x06, 0xff, 0x0f, 0x10, 0x13, 0xff, 0x18, 0x19, 0x1d, 0xfe, 0x1e, 0x20, 0x23, 0x8f, 0x1f, 0x1f, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x42, 0x03, 0x03, 0x05, 0xdb, 0x04, 0x05, 0x09, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x11, 0x12, 0x16, 0xff, 0x14, 0x15, 0x19, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x21, 0x22, 0x26, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x21, 0x22, 0x26, 0xff, 0x21, 0x21, 0x25, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x21, 0x21, 0x25, 0xff, 0x1f, 0x21, 0x24, 0xff, 0x1b, 0x1f, 0x22, 0xff, 0x23, 0x26, 0x2a, 0xff, 0x2d, 0x31, 0x35, 0xff, 0x13, 0x1b, 0x1b, 0xff, 0x20, 0x1b, 0x1f, 0xff, 0x14, 0x0e, 0x16, 0xff, 0x18, 0x2e, 0x42, 0xff, 0x78, 0xa2, 0xd0, 0xff, 0x9d, 0xc7, 0xf7, 0xff, 0x9e, 0xbf, 0xe4, 0xff, 0xa9, 0xc9, 0xea, 0xff, 0xaa, 0xca, 0xee, 0xff, 0xb1, 0xcc, 0xf2, 0xff, 0xb1, 0xca, 0xf0, 0xff, 0xb0, 0xca, 0xee, 0xff, 0xb1, 0xcb, 0xef, 0xff, 0xb3, 0xce, 0xf2, 0xff, 0xb1, 0xcc, 0xf2, 0xff, 0xaf, 0xca, 0xed, 0xff, 0xb9, 0xd8, 0xf8, 0xff, 0xb8, 0xd8, 0xff, 0xff, 0x4e, 0x60, 0x84, 0xff, 0x07, 0x0a, 0x13, 0xff, 0x1d, 0x1c, 0x1d, 0xff, 0x24, 0x26, 0x29, 0xff, 0x24, 0x25, 0x29, 0xff, 0x15, 0x16, 0x19, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x21, 0x22, 0x26, 0xff, 0x1a, 0x1a, 0x1d, 0xff, 0x1e, 0x1c, 0x1e, 0xff, 0x0a, 0x09, 0x0b, 0xff, 0x0e, 0x0d, 0x0f, 0xff, 0x13, 0x12, 0x14, 0xff, 0x0c, 0x0b, 0x0d, 0xff, 0x06, 0x05, 0x07, 0xff, 0x18, 0x18, 0x1b, 0xdb, 0x17, 0x1b, 0x1e, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x03, 0x07, 0x87, 0x1b, 0x1c, 0x20, 0xf9, 0x20, 0x21, 0x25, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x13, 0x14, 0x17, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x20, 0x21, 0x25, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x20, 0x21, 0x25, 0xff, 0x23, 0x23, 0x27, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x22, 0x24, 0x28, 0xff, 0x1c, 0x1f, 0x23, 0xff, 0x19, 0x1b, 0x1f, 0xff, 0x2d, 0x30, 0x32, 0xff, 0x1e, 0x29, 0x31, 0xff, 0x20, 0x23, 0x2c, 0xff, 0x22, 0x1d, 0x22, 0xff, 0x0d, 0x0b, 0x0b, 0xff, 0x28, 0x2f, 0x35, 0xff, 0x7d, 0x9b, 0xbf, 0xff, 0x94, 0xc5, 0xff, 0xff, 0x9a, 0xc1, 0xf3, 0xff, 0xa4, 0xc2, 0xec, 0xff, 0xa9, 0xc7, 0xf0, 0xff, 0xb0, 0xcc, 0xf1, 0xff, 0xb1, 0xcb, 0xee, 0xff, 0xb1, 0xcc, 0xf0, 0xff, 0xb2, 0xcb, 0xee, 0xff, 0xb8, 0xcf, 0xf0, 0xff, 0xb6, 0xd7, 0xff, 0xff, 0xa5, 0xd5, 0xff, 0xff, 0x4b, 0x61, 0x81, 0xff, 0x13, 0x0c, 0x0f, 0xff, 0x24, 0x1e, 0x1a, 0xff, 0x2b, 0x28, 0x27, 0xff, 0x26, 0x27, 0x2c, 0xff, 0x19, 0x1b, 0x1e, 0xff, 0x0d, 0x0e, 0x12, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1d, 0x1e, 0x23, 0xff, 0x1b, 0x1b, 0x1e, 0xff, 0x20, 0x1e, 0x20, 0xff, 0x08, 0x07, 0x09, 0xff, 0x0e, 0x0d, 0x0f, 0xff, 0x12, 0x11, 0x13, 0xff, 0x0c, 0x0b, 0x0d, 0xf9, 0x0b, 0x09, 0x0b, 0x88, 0x1c, 0x1c, 0x1c, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x22, 0x25, 0x22, 0x24, 0x28, 0xb7, 0x1f, 0x20, 0x24, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1a, 0x1a, 0x1f, 0xff, 0x11, 0x12, 0x17, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x21, 0x22, 0x26, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x20, 0x21, 0x25, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x1d, 0x1f, 0x23, 0xff, 0x21, 0x24, 0x28, 0xff, 0x1d, 0x20, 0x24, 0xff, 0x26, 0x29, 0x2d, 0xff, 0x2b, 0x2e, 0x32, 0xff, 0x28, 0x2d, 0x30, 0xff, 0x21, 0x21, 0x25, 0xff, 0x22, 0x1e, 0x21, 0xff, 0x10, 0x0d, 0x0c, 0xff, 0x1d, 0x20, 0x29, 0xff, 0x6b, 0x81, 0x9f, 0xff, 0x9b, 0xbf, 0xf8, 0xff, 0xa2, 0xc5, 0xfd, 0xff, 0x9d, 0xbf, 0xec, 0xff, 0xaa, 0xc7, 0xec, 0xff, 0xb1, 0xca, 0xec, 0xff, 0xaf, 0xc9, 0xec, 0xff, 0xaf, 0xc7, 0xeb, 0xff, 0xbf, 0xda, 0xff, 0xff, 0xb6, 0xd8, 0xff, 0xff, 0x4e, 0x63, 0x75, 0xff, 0x0c, 0x0c, 0x0e, 0xff, 0x23, 0x1a, 0x1d, 0xff, 0x23, 0x24, 0x29, 0xff, 0x1d, 0x25, 0x31, 0xff, 0x18, 0x1a, 0x1e, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1e, 0x20, 0x23, 0xff, 0x1e, 0x1e, 0x21, 0xff, 0x21, 0x20, 0x22, 0xff, 0x05, 0x04, 0x06, 0xff, 0x0f, 0x0e, 0x10, 0xff, 0x17, 0x16, 0x17, 0xb7, 0x0d, 0x0d, 0x0d, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x2b, 0x46, 0x1b, 0x1b, 0x22, 0xca, 0x16, 0x18, 0x1a, 0xff, 0x12, 0x14, 0x16, 0xff, 0x1b, 0x1c, 0x21, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x24, 0x25, 0x29, 0xff, 0x21, 0x22, 0x26, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x23, 0x24, 0x28, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x23, 0x25, 0x29, 0xff, 0x22, 0x23, 0x27, 0xff, 0x26, 0x26, 0x29, 0xff, 0x23, 0x26, 0x29, 0xff, 0x27, 0x2a, 0x2f, 0xff, 0x1d, 0x20, 0x27, 0xff, 0x1c, 0x1e, 0x26, 0xff, 0x12, 0x0f, 0x14, 0xff, 0x13, 0x10, 0x17, 0xff, 0x47, 0x4f, 0x69, 0xff, 0x8a, 0xa6, 0xca, 0xff, 0xae, 0xd1, 0xfe, 0xff, 0xae, 0xce, 0xff, 0xff, 0xa9, 0xca, 0xf5, 0xff, 0xa9, 0xc7, 0xef, 0xff, 0xbf, 0xdc, 0xff, 0xff, 0xad, 0xc9, 0xef, 0xff, 0x49, 0x59, 0x72, 0xff, 0x11, 0x11, 0x11, 0xff, 0x25, 0x22, 0x22, 0xff, 0x29, 0x29, 0x2f, 0xff, 0x22, 0x25, 0x2d, 0xff, 0x11, 0x17, 0x20, 0xff, 0x13, 0x14, 0x18, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x20, 0x21, 0x25, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1c, 0x1e, 0x22, 0xff, 0x1f, 0x1e, 0x21, 0xff, 0x23, 0x22, 0x24, 0xff, 0x08, 0x07, 0x0a, 0xca, 0x12, 0x12, 0x15, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x1a, 0x1a, 0x4d, 0x14, 0x16, 0x16, 0xcc, 0x16, 0x17, 0x1c, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x20, 0x21, 0x25, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x20, 0x21, 0x25, 0xff, 0x1d, 0x1d, 0x21, 0xff, 0x24, 0x25, 0x29, 0xff, 0x1b, 0x1b, 0x1f, 0xff, 0x21, 0x24, 0x29, 0xff, 0x12, 0x16, 0x1a, 0xff, 0x27, 0x2a, 0x2e, 0xff, 0x2b, 0x2e, 0x32, 0xff, 0x23, 0x26, 0x2b, 0xff, 0x19, 0x1b, 0x25, 0xff, 0x13, 0x12, 0x1c, 0xff, 0x0b, 0x04, 0x08, 0xff, 0x1d, 0x26, 0x31, 0xff, 0x5e, 0x6f, 0x8b, 0xff, 0x89, 0xa1, 0xca, 0xff, 0xa0, 0xc1, 0xec, 0xff, 0xbc, 0xd8, 0xff, 0xff, 0x9a, 0xb6, 0xda, 0xff, 0x2c, 0x3e, 0x58, 0xff, 0x02, 0x06, 0x0f, 0xff, 0x18, 0x1a, 0x21, 0xff, 0x26, 0x28, 0x2f, 0xff, 0x28, 0x29, 0x2b, 0xff, 0x1e, 0x1f, 0x22, 0xff, 0x12, 0x11, 0x14, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1d, 0x1e, 0x23, 0xff, 0x20, 0x20, 0x23, 0xcc, 0x24, 0x24, 0x24, 0x4d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 0x1f, 0x41, 0x16, 0x16, 0x1a, 0xb4, 0x1d, 0x1e, 0x22, 0xfe, 0x1d, 0x1e, 0x22, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x20, 0x21, 0x25, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x20, 0x22, 0x26, 0xff, 0x17, 0x1a, 0x1e, 0xff, 0x19, 0x1c, 0x20, 0xff, 0x29, 0x2d, 0x30, 0xff, 0x27, 0x2b, 0x2c, 0xff, 0x21, 0x25, 0x29, 0xff, 0x1c, 0x1f, 0x26, 0xff, 0x23, 0x23, 0x28, 0xff, 0x1a, 0x14, 0x1a, 0xff, 0x07, 0x06, 0x0e, 0xff, 0x15, 0x1e, 0x2a, 0xff, 0x33, 0x3e, 0x50, 0xff, 0x58, 0x64, 0x79, 0xff, 0x29, 0x38, 0x4e, 0xff, 0x08, 0x0c, 0x15, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x23, 0x25, 0x2b, 0xff, 0x23, 0x26, 0x2d, 0xff, 0x1d, 0x1e, 0x21, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x22, 0x23, 0x27, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x20, 0x21, 0x25, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1b, 0x1c, 0x20, 0xfe, 0x1c, 0x1c, 0x20, 0xb4, 0x1f, 0x1f, 0x23, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x24, 0x24, 0x23, 0x1e, 0x1f, 0x23, 0x88, 0x1c, 0x1d, 0x22, 0xe6, 0x1c, 0x1d, 0x21, 0xff, 0x21, 0x22, 0x26, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x21, 0x22, 0x26, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x22, 0x23, 0x27, 0xff, 0x19, 0x1b, 0x1f, 0xff, 0x1f, 0x21, 0x25, 0xff, 0x18, 0x1a, 0x1f, 0xff, 0x26, 0x29, 0x2b, 0xff, 0x18, 0x1c, 0x1c, 0xff, 0x25, 0x28, 0x2b, 0xff, 0x24, 0x27, 0x2b, 0xff, 0x25, 0x29, 0x2f, 0xff, 0x23, 0x1e, 0x24, 0xff, 0x1c, 0x19, 0x1d, 0xff, 0x13, 0x14, 0x14, 0xff, 0x17, 0x13, 0x13, 0xff, 0x0b, 0x0b, 0x0e, 0xff, 0x1c, 0x1f, 0x25, 0xff, 0x28, 0x26, 0x27, 0xff, 0x1f, 0x1b, 0x19, 0xff, 0x21, 0x21, 0x26, 0xff, 0x16, 0x18, 0x1f, 0xff, 0x20, 0x21, 0x24, 0xff, 0x20, 0x21, 0x25, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x25, 0x26, 0x2a, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x22, 0x23, 0x27, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x23, 0x24, 0x28, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1a, 0x1b, 0x20, 0xe7, 0x18, 0x1a, 0x1e, 0x88, 0x15, 0x15, 0x1d, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x05, 0x18, 0x1b, 0x1f, 0x4a, 0x1f, 0x21, 0x24, 0xa0, 0x1c, 0x1d, 0x22, 0xef, 0x21, 0x22, 0x26, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x21, 0x22, 0x26, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x26, 0x27, 0x2b, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x21, 0x21, 0x25, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x26, 0x27, 0x2b, 0xff, 0x14, 0x14, 0x19, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x23, 0x24, 0x28, 0xff, 0x22, 0x23, 0x27, 0xff, 0x21, 0x23, 0x27, 0xff, 0x1e, 0x20, 0x24, 0xff, 0x1b, 0x1c, 0x1f, 0xff, 0x26, 0x26, 0x2a, 0xff, 0x1c, 0x1c, 0x1f, 0xff, 0x18, 0x18, 0x1a, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x1a, 0x1c, 0x21, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x13, 0x13, 0x17, 0xff, 0x23, 0x24, 0x28, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1b, 0x1c, 0x21, 0xef, 0x1e, 0x1e, 0x23, 0xa0, 0x1b, 0x1f, 0x22, 0x4a, 0x33, 0x33, 0x33, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x07, 0x19, 0x19, 0x20, 0x46, 0x1e, 0x1e, 0x22, 0x8e, 0x22, 0x23, 0x27, 0xd7, 0x15, 0x16, 0x1a, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x20, 0x21, 0x25, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x20, 0x21, 0x25, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x24, 0x26, 0x29, 0xff, 0x1a, 0x1c, 0x1f, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x12, 0x13, 0x17, 0xff, 0x12, 0x13, 0x17, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x2c, 0x2d, 0x31, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x27, 0x28, 0x2c, 0xff, 0x15, 0x16, 0x1a, 0xff, 0x28, 0x29, 0x2d, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x20, 0x21, 0x25, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1c, 0x1d, 0x21, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x1b, 0x1c, 0x20, 0xd7, 0x19, 0x1a, 0x1e, 0x8e, 0x20, 0x20, 0x24, 0x46, 0x24, 0x24, 0x24, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x1b, 0x18, 0x18, 0x1e, 0x55, 0x1e, 0x20, 0x23, 0x8f, 0x1f, 0x1f, 0x23, 0xc2, 0x22, 0x23, 0x28, 0xea, 0x17, 0x18, 0x1c, 0xff, 0x20, 0x21, 0x25, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x24, 0x25, 0x29, 0xff, 0x12, 0x13, 0x17, 0xff, 0x24, 0x25, 0x29, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x1b, 0x1c, 0x20, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x22, 0x23, 0x27, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x23, 0x24, 0x28, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x25, 0x26, 0x2a, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x28, 0x29, 0x2d, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x23, 0x24, 0x28, 0xff, 0x1a, 0x1b, 0x1f, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x1d, 0x1e, 0x21, 0xea, 0x1c, 0x1e, 0x22, 0xc2, 0x1a, 0x1a, 0x1e, 0x8f, 0x1e, 0x1e, 0x24, 0x55, 0x1c, 0x1c, 0x1c, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x11, 0x20, 0x20, 0x25, 0x37, 0x12, 0x15, 0x18, 0x5f, 0x24, 0x24, 0x29, 0x86, 0x15, 0x16, 0x1b, 0xa8, 0x1e, 0x1e, 0x22, 0xc0, 0x19, 0x1a, 0x1e, 0xd3, 0x17, 0x18, 0x1b, 0xe6, 0x22, 0x23, 0x26, 0xee, 0x20, 0x21, 0x25, 0xf5, 0x27, 0x28, 0x2c, 0xff, 0x14, 0x15, 0x19, 0xff, 0x22, 0x23, 0x26, 0xf5, 0x1e, 0x1f, 0x23, 0xee, 0x19, 0x1a, 0x1f, 0xe6, 0x1a, 0x1a, 0x1f, 0xd3, 0x1e, 0x1e, 0x22, 0xc0, 0x27, 0x27, 0x2c, 0xa8, 0x18, 0x18, 0x1c, 0x86, 0x22, 0x22, 0x28, 0x5f, 0x17, 0x17, 0x1b, 0x37, 0x1e, 0x1e, 0x2d, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const lv_image_dsc_t img_multilang_avatar_1 = {
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .header.w = 128,
+    .header.h = 128,
+    .header.stride = 512,
+    .data = img_multilang_avatar_1_map,
+    .data_size = sizeof(img_multilang_avatar_1_map),
+};
+
+#endif
@@ -0,0 +1,166 @@
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+#if LV_USE_DEMO_MULTILANG
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_11
+    #define LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_11
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_11 uint8_t
+img_multilang_avatar_11_map[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x5e, 0xff, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0xa8, 0xfe, 0xfe, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xd2, 0xfe, 0xfe, 0xfe, 0xe5, 0xfe, 0xfe, 0xfe, 0xee, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xfe, 0xfe, 0xfe, 0xee, 0xfe, 0xfe, 0xfe, 0xe5, 0xff, 0xff, 0xff, 0xd2, 0xfe, 0xfe, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xa8, 0xff, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0x5e, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x19, 0xff, 0xff, 0xff, 0x55, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xc1, 0xfe, 0xfe, 0xfe, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xe9, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x55, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x07, 0xff, 0xff, 0xff, 0x46, 0xff, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x46, 0xfe, 0xfe, 0xfe, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x9f, 0xfe, 0xfe, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xef, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x86, 0xfe, 0xfe, 0xfe, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xe5, 0xff, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x41, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xff, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xed, 0xee, 0xff, 0xd9, 0xdc, 0xdc, 0xff, 0xb9, 0xbc, 0xbd, 0xff, 0xb9, 0xbc, 0xbd, 0xff, 0xb8, 0xbb, 0xbc, 0xff, 0xb1, 0xb7, 0xb8, 0xff, 0xba, 0xc1, 0xc4, 0xff, 0xa4, 0xad, 0xb2, 0xff, 0x91, 0x9b, 0xa3, 0xff, 0xa8, 0xb5, 0xbb, 0xff, 0xc9, 0xd6, 0xd9, 0xff, 0xea, 0xf2, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xff, 0xff, 0xff, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x46, 0xff, 0xff, 0xff, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfd, 0xfd, 0xff, 0xbd, 0xc1, 0xc3, 0xff, 0xa0, 0xa4, 0xa6, 0xff, 0x94, 0x99, 0x9a, 0xff, 0x8e, 0x92, 0x93, 0xff, 0x93, 0x99, 0x9c, 0xff, 0x79, 0x80, 0x84, 0xff, 0x75, 0x7c, 0x7f, 0xff, 0x5f, 0x66, 0x6a, 0xff, 0x67, 0x6d, 0x71, 0xff, 0x75, 0x7e, 0x80, 0xff, 0x60, 0x6d, 0x6f, 0xff, 0x5f, 0x6b, 0x70, 0xff, 0x5c, 0x6a, 0x71, 0xff, 0x4c, 0x5d, 0x63, 0xff, 0x47, 0x5c, 0x6d, 0xff, 0x5b, 0x72, 0x87, 0xff, 0x72, 0x85, 0x93, 0xff, 0x92, 0x9e, 0xa7, 0xff, 0xce, 0xd8, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xd3, 0xd3, 0xff, 0x62, 0x6d, 0x6f, 0xff, 0x4a, 0x53, 0x57, 0xff, 0x4c, 0x55, 0x58, 0xff, 0x53, 0x5c, 0x5f, 0xff, 0x5a, 0x63, 0x66, 0xff, 0x57, 0x62, 0x67, 0xff, 0x56, 0x61, 0x68, 0xff, 0x54, 0x5f, 0x65, 0xff, 0x51, 0x5c, 0x62, 0xff, 0x5a, 0x65, 0x6c, 0xff, 0x65, 0x6f, 0x74, 0xff, 0x64, 0x6d, 0x72, 0xff, 0x48, 0x53, 0x5a, 0xff, 0x49, 0x55, 0x5e, 0xff, 0x51, 0x5f, 0x69, 0xff, 0x43, 0x52, 0x63, 0xff, 0x51, 0x61, 0x75, 0xff, 0x57, 0x6b, 0x7b, 0xff, 0x3c, 0x50, 0x60, 0xff, 0x56, 0x6f, 0x7d, 0xff, 0xa8, 0xb3, 0xbe, 0xff, 0xf8, 0xf9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xff, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x09, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xed, 0xef, 0xff, 0x97, 0xa3, 0xa5, 0xff, 0x3f, 0x53, 0x54, 0xff, 0x37, 0x45, 0x49, 0xff, 0x4c, 0x56, 0x5b, 0xff, 0x46, 0x52, 0x56, 0xff, 0x51, 0x5d, 0x61, 0xff, 0x52, 0x5e, 0x61, 0xff, 0x4a, 0x57, 0x5c, 0xff, 0x4f, 0x5c, 0x63, 0xff, 0x3f, 0x4d, 0x53, 0xff, 0x3f, 0x4d, 0x53, 0xff, 0x47, 0x55, 0x5b, 0xff, 0x45, 0x4c, 0x53, 0xff, 0x51, 0x54, 0x5c, 0xff, 0x37, 0x3d, 0x46, 0xff, 0x3d, 0x44, 0x50, 0xff, 0x4a, 0x53, 0x61, 0xff, 0x4a, 0x51, 0x5c, 0xff, 0x40, 0x47, 0x51, 0xff, 0x52, 0x5f, 0x6d, 0xff, 0x4c, 0x63, 0x73, 0xff, 0x38, 0x57, 0x6a, 0xff, 0x4c, 0x67, 0x7a, 0xff, 0x77, 0x88, 0x98, 0xff, 0xbd, 0xc7, 0xcf, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xb8, 0xc3, 0xff, 0x59, 0x6e, 0x79, 0xff, 0x37, 0x49, 0x50, 0xff, 0x40, 0x45, 0x4d, 0xff, 0x4b, 0x51, 0x59, 0xff, 0x46, 0x50, 0x59, 0xff, 0x44, 0x4d, 0x56, 0xff, 0x49, 0x53, 0x5b, 0xff, 0x45, 0x4e, 0x56, 0xff, 0x39, 0x43, 0x4c, 0xff, 0x42, 0x4d, 0x56, 0xff, 0x36, 0x41, 0x4a, 0xff, 0x30, 0x3a, 0x44, 0xff, 0x39, 0x44, 0x4d, 0xff, 0x38, 0x41, 0x4a, 0xff, 0x41, 0x48, 0x51, 0xff, 0x35, 0x3d, 0x46, 0xff, 0x33, 0x3b, 0x45, 0xff, 0x32, 0x3a, 0x44, 0xff, 0x3b, 0x46, 0x4f, 0xff, 0x36, 0x45, 0x4c, 0xff, 0x3f, 0x4e, 0x59, 0xff, 0x5b, 0x6d, 0x7c, 0xff, 0x3d, 0x51, 0x61, 0xff, 0x35, 0x4f, 0x5f, 0xff, 0x49, 0x64, 0x73, 0xff, 0x4c, 0x61, 0x72, 0xff, 0x70, 0x7f, 0x8f, 0xff, 0xaf, 0xbc, 0xcb, 0xff, 0xec, 0xf2, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xfa, 0xfc, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xff, 0xff, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x07, 0xff, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xf6, 0xf5, 0xff, 0x7a, 0x84, 0x8f, 0xff, 0x3b, 0x49, 0x5a, 0xff, 0x45, 0x58, 0x64, 0xff, 0x3d, 0x4c, 0x55, 0xff, 0x3f, 0x43, 0x4c, 0xff, 0x44, 0x4a, 0x53, 0xff, 0x44, 0x4e, 0x58, 0xff, 0x3f, 0x48, 0x52, 0xff, 0x36, 0x3f, 0x49, 0xff, 0x3a, 0x43, 0x4c, 0xff, 0x36, 0x3f, 0x4a, 0xff, 0x38, 0x42, 0x4c, 0xff, 0x32, 0x3b, 0x46, 0xff, 0x2e, 0x38, 0x42, 0xff, 0x3e, 0x48, 0x53, 0xff, 0x39, 0x43, 0x4c, 0xff, 0x3a, 0x43, 0x4c, 0xff, 0x41, 0x4a, 0x53, 0xff, 0x30, 0x39, 0x42, 0xff, 0x29, 0x31, 0x3a, 0xff, 0x33, 0x3e, 0x47, 0xff, 0x2f, 0x3e, 0x48, 0xff, 0x2d, 0x3d, 0x48, 0xff, 0x45, 0x55, 0x64, 0xff, 0x4e, 0x5e, 0x6e, 0xff, 0x33, 0x43, 0x52, 0xff, 0x3d, 0x4c, 0x5c, 0xff, 0x5d, 0x6d, 0x7d, 0xff, 0x46, 0x59, 0x69, 0xff, 0x42, 0x58, 0x69, 0xff, 0x6a, 0x7e, 0x91, 0xff, 0xbd, 0xc6, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x8e, 0xfe, 0xfe, 0xfe, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x29, 0xfe, 0xfe, 0xfe, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xe3, 0xe7, 0xff, 0x58, 0x6e, 0x76, 0xff, 0x33, 0x45, 0x52, 0xff, 0x57, 0x62, 0x70, 0xff, 0x41, 0x4e, 0x59, 0xff, 0x33, 0x3e, 0x47, 0xff, 0x3a, 0x42, 0x4a, 0xff, 0x3d, 0x46, 0x4e, 0xff, 0x3c, 0x45, 0x4e, 0xff, 0x30, 0x39, 0x42, 0xff, 0x30, 0x39, 0x42, 0xff, 0x36, 0x3f, 0x48, 0xff, 0x32, 0x3c, 0x46, 0xff, 0x31, 0x3c, 0x46, 0xff, 0x2e, 0x38, 0x42, 0xff, 0x32, 0x3c, 0x47, 0xff, 0x46, 0x51, 0x5b, 0xff, 0x31, 0x3a, 0x43, 0xff, 0x34, 0x3d, 0x46, 0xff, 0x42, 0x4b, 0x54, 0xff, 0x2f, 0x38, 0x41, 0xff, 0x27, 0x30, 0x39, 0xff, 0x35, 0x3e, 0x48, 0xff, 0x39, 0x44, 0x4e, 0xff, 0x2c, 0x39, 0x44, 0xff, 0x35, 0x44, 0x53, 0xff, 0x50, 0x61, 0x71, 0xff, 0x41, 0x4b, 0x5c, 0xff, 0x33, 0x37, 0x49, 0xff, 0x44, 0x50, 0x60, 0xff, 0x5a, 0x6c, 0x7c, 0xff, 0x48, 0x60, 0x6d, 0xff, 0x48, 0x5f, 0x74, 0xff, 0x56, 0x69, 0x80, 0xff, 0xa4, 0xb1, 0xbc, 0xff, 0xf7, 0xfa, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xd1, 0xfe, 0xfe, 0xfe, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x56, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xd8, 0xdb, 0xff, 0x47, 0x5a, 0x67, 0xff, 0x36, 0x47, 0x5a, 0xff, 0x57, 0x69, 0x79, 0xff, 0x4a, 0x58, 0x65, 0xff, 0x38, 0x3e, 0x4b, 0xff, 0x38, 0x3d, 0x47, 0xff, 0x2d, 0x3a, 0x40, 0xff, 0x2b, 0x37, 0x3f, 0xff, 0x39, 0x41, 0x4a, 0xff, 0x2b, 0x33, 0x3d, 0xff, 0x2e, 0x37, 0x40, 0xff, 0x2d, 0x35, 0x3e, 0xff, 0x28, 0x31, 0x3b, 0xff, 0x29, 0x33, 0x3d, 0xff, 0x26, 0x30, 0x3a, 0xff, 0x3a, 0x44, 0x4e, 0xff, 0x3e, 0x48, 0x52, 0xff, 0x23, 0x2c, 0x35, 0xff, 0x28, 0x30, 0x39, 0xff, 0x37, 0x40, 0x48, 0xff, 0x31, 0x3a, 0x42, 0xff, 0x21, 0x2a, 0x33, 0xff, 0x30, 0x38, 0x41, 0xff, 0x37, 0x40, 0x49, 0xff, 0x29, 0x32, 0x3e, 0xff, 0x2c, 0x37, 0x47, 0xff, 0x34, 0x43, 0x54, 0xff, 0x41, 0x4d, 0x5d, 0xff, 0x36, 0x3f, 0x50, 0xff, 0x2e, 0x3a, 0x4a, 0xff, 0x44, 0x52, 0x62, 0xff, 0x41, 0x4f, 0x5f, 0xff, 0x4c, 0x5d, 0x6e, 0xff, 0x4d, 0x63, 0x77, 0xff, 0x46, 0x5e, 0x72, 0xff, 0x94, 0xa4, 0xb0, 0xff, 0xf6, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x8a, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xce, 0xcd, 0xff, 0x43, 0x57, 0x5e, 0xff, 0x34, 0x48, 0x57, 0xff, 0x52, 0x5c, 0x74, 0xff, 0x4c, 0x5c, 0x6e, 0xff, 0x2d, 0x3e, 0x49, 0xff, 0x33, 0x35, 0x43, 0xff, 0x35, 0x38, 0x42, 0xff, 0x27, 0x35, 0x3c, 0xff, 0x2c, 0x39, 0x40, 0xff, 0x32, 0x3a, 0x43, 0xff, 0x2d, 0x35, 0x3e, 0xff, 0x2b, 0x33, 0x3c, 0xff, 0x28, 0x30, 0x39, 0xff, 0x28, 0x31, 0x3b, 0xff, 0x2e, 0x38, 0x41, 0xff, 0x20, 0x29, 0x33, 0xff, 0x2f, 0x39, 0x42, 0xff, 0x3a, 0x44, 0x4e, 0xff, 0x24, 0x2d, 0x36, 0xff, 0x26, 0x2e, 0x36, 0xff, 0x32, 0x3a, 0x43, 0xff, 0x34, 0x3c, 0x44, 0xff, 0x23, 0x2c, 0x34, 0xff, 0x29, 0x30, 0x3a, 0xff, 0x30, 0x37, 0x41, 0xff, 0x29, 0x32, 0x3d, 0xff, 0x2b, 0x34, 0x43, 0xff, 0x2b, 0x35, 0x47, 0xff, 0x34, 0x45, 0x54, 0xff, 0x37, 0x49, 0x59, 0xff, 0x26, 0x33, 0x43, 0xff, 0x3b, 0x43, 0x54, 0xff, 0x47, 0x49, 0x5c, 0xff, 0x42, 0x4b, 0x57, 0xff, 0x4e, 0x63, 0x6e, 0xff, 0x43, 0x5d, 0x73, 0xff, 0x50, 0x68, 0x7d, 0xff, 0xa0, 0xb2, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x0b, 0xff, 0xff, 0xff, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xd4, 0xda, 0xff, 0x4b, 0x5d, 0x6a, 0xff, 0x3c, 0x4e, 0x5a, 0xff, 0x48, 0x58, 0x66, 0xff, 0x44, 0x52, 0x62, 0xff, 0x3a, 0x46, 0x50, 0xff, 0x22, 0x2d, 0x32, 0xff, 0x26, 0x2f, 0x36, 0xff, 0x27, 0x31, 0x37, 0xff, 0x25, 0x30, 0x36, 0xff, 0x2a, 0x35, 0x3d, 0xff, 0x2b, 0x35, 0x3e, 0xff, 0x29, 0x34, 0x3d, 0xff, 0x2a, 0x35, 0x3d, 0xff, 0x28, 0x33, 0x3b, 0xff, 0x23, 0x2d, 0x37, 0xff, 0x30, 0x3b, 0x45, 0xff, 0x1c, 0x27, 0x31, 0xff, 0x29, 0x33, 0x3e, 0xff, 0x41, 0x4c, 0x56, 0xff, 0x2f, 0x39, 0x45, 0xff, 0x30, 0x39, 0x47, 0xff, 0x3a, 0x43, 0x50, 0xff, 0x45, 0x4f, 0x5c, 0xff, 0x34, 0x3d, 0x4b, 0xff, 0x26, 0x30, 0x3d, 0xff, 0x2e, 0x3a, 0x45, 0xff, 0x36, 0x41, 0x4d, 0xff, 0x31, 0x3c, 0x48, 0xff, 0x29, 0x33, 0x40, 0xff, 0x2d, 0x3e, 0x4b, 0xff, 0x3f, 0x53, 0x62, 0xff, 0x30, 0x40, 0x4f, 0xff, 0x38, 0x44, 0x54, 0xff, 0x49, 0x52, 0x63, 0xff, 0x3e, 0x4a, 0x55, 0xff, 0x43, 0x50, 0x58, 0xff, 0x4c, 0x57, 0x65, 0xff, 0x57, 0x68, 0x7a, 0xff, 0x4b, 0x6c, 0x81, 0xff, 0xbd, 0xd0, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x16, 0xff, 0xff, 0xff, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xda, 0xd9, 0xff, 0x5c, 0x72, 0x7c, 0xff, 0x46, 0x5c, 0x6c, 0xff, 0x49, 0x59, 0x67, 0xff, 0x40, 0x4c, 0x59, 0xff, 0x37, 0x40, 0x4e, 0xff, 0x33, 0x3e, 0x47, 0xff, 0x1c, 0x28, 0x2e, 0xff, 0x27, 0x34, 0x3b, 0xff, 0x2a, 0x37, 0x3f, 0xff, 0x25, 0x31, 0x37, 0xff, 0x1d, 0x29, 0x34, 0xff, 0x28, 0x36, 0x41, 0xff, 0x22, 0x2f, 0x3a, 0xff, 0x23, 0x31, 0x3b, 0xff, 0x33, 0x40, 0x4b, 0xff, 0x24, 0x31, 0x3e, 0xff, 0x28, 0x34, 0x42, 0xff, 0x20, 0x2c, 0x3a, 0xff, 0x28, 0x35, 0x42, 0xff, 0x4d, 0x5a, 0x67, 0xff, 0x55, 0x62, 0x72, 0xff, 0x4a, 0x58, 0x6a, 0xff, 0x4f, 0x5d, 0x6f, 0xff, 0x5e, 0x6c, 0x7e, 0xff, 0x54, 0x62, 0x74, 0xff, 0x36, 0x45, 0x55, 0xff, 0x3a, 0x4a, 0x58, 0xff, 0x38, 0x48, 0x56, 0xff, 0x2f, 0x3e, 0x4c, 0xff, 0x35, 0x44, 0x52, 0xff, 0x36, 0x48, 0x58, 0xff, 0x3f, 0x55, 0x65, 0xff, 0x3b, 0x4d, 0x5d, 0xff, 0x3c, 0x4b, 0x5c, 0xff, 0x3c, 0x4a, 0x5c, 0xff, 0x33, 0x42, 0x50, 0xff, 0x34, 0x40, 0x4b, 0xff, 0x44, 0x4c, 0x5a, 0xff, 0x4e, 0x5c, 0x6d, 0xff, 0x47, 0x66, 0x79, 0xff, 0x7d, 0x91, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1a, 0xff, 0xff, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xe7, 0xea, 0xff, 0x55, 0x72, 0x79, 0xff, 0x48, 0x66, 0x70, 0xff, 0x40, 0x58, 0x64, 0xff, 0x3e, 0x4f, 0x5c, 0xff, 0x30, 0x3a, 0x48, 0xff, 0x2f, 0x33, 0x42, 0xff, 0x2a, 0x36, 0x43, 0xff, 0x20, 0x30, 0x3c, 0xff, 0x2b, 0x3a, 0x46, 0xff, 0x2e, 0x3d, 0x49, 0xff, 0x26, 0x35, 0x40, 0xff, 0x1c, 0x2c, 0x3a, 0xff, 0x27, 0x39, 0x48, 0xff, 0x29, 0x3a, 0x49, 0xff, 0x2c, 0x3d, 0x4b, 0xff, 0x3a, 0x4b, 0x59, 0xff, 0x32, 0x42, 0x53, 0xff, 0x30, 0x3f, 0x51, 0xff, 0x29, 0x38, 0x4a, 0xff, 0x2f, 0x3f, 0x50, 0xff, 0x54, 0x63, 0x73, 0xff, 0x72, 0x84, 0x9b, 0xff, 0x6e, 0x83, 0x9f, 0xff, 0x66, 0x7a, 0x94, 0xff, 0x73, 0x87, 0xa1, 0xff, 0x6c, 0x81, 0x9b, 0xff, 0x5a, 0x6f, 0x86, 0xff, 0x50, 0x65, 0x79, 0xff, 0x3f, 0x54, 0x69, 0xff, 0x3b, 0x4f, 0x64, 0xff, 0x3a, 0x4f, 0x64, 0xff, 0x35, 0x4b, 0x60, 0xff, 0x47, 0x5f, 0x74, 0xff, 0x4d, 0x62, 0x77, 0xff, 0x3e, 0x51, 0x66, 0xff, 0x49, 0x59, 0x71, 0xff, 0x46, 0x56, 0x68, 0xff, 0x34, 0x44, 0x51, 0xff, 0x31, 0x3c, 0x4c, 0xff, 0x39, 0x47, 0x56, 0xff, 0x51, 0x6a, 0x78, 0xff, 0x52, 0x67, 0x78, 0xff, 0xc4, 0xca, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xff, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x73, 0x7f, 0x8c, 0xff, 0x3f, 0x5d, 0x6e, 0xff, 0x46, 0x5c, 0x6a, 0xff, 0x3f, 0x4c, 0x59, 0xff, 0x36, 0x45, 0x53, 0xff, 0x2b, 0x3a, 0x47, 0xff, 0x2e, 0x3d, 0x49, 0xff, 0x2f, 0x40, 0x50, 0xff, 0x27, 0x39, 0x4b, 0xff, 0x35, 0x47, 0x57, 0xff, 0x40, 0x52, 0x62, 0xff, 0x38, 0x4a, 0x5a, 0xff, 0x2d, 0x41, 0x52, 0xff, 0x3d, 0x50, 0x64, 0xff, 0x43, 0x57, 0x69, 0xff, 0x41, 0x55, 0x68, 0xff, 0x4d, 0x61, 0x73, 0xff, 0x45, 0x59, 0x6c, 0xff, 0x43, 0x56, 0x6b, 0xff, 0x3f, 0x52, 0x67, 0xff, 0x43, 0x56, 0x6b, 0xff, 0x4e, 0x60, 0x73, 0xff, 0x70, 0x89, 0xa7, 0xff, 0x81, 0x9f, 0xc3, 0xff, 0x81, 0x9c, 0xbf, 0xff, 0x7c, 0x98, 0xba, 0xff, 0x7b, 0x97, 0xbb, 0xff, 0x7b, 0x95, 0xb4, 0xff, 0x6f, 0x87, 0xa3, 0xff, 0x59, 0x72, 0x8f, 0xff, 0x4b, 0x64, 0x80, 0xff, 0x3f, 0x57, 0x74, 0xff, 0x47, 0x61, 0x7c, 0xff, 0x5a, 0x75, 0x8e, 0xff, 0x51, 0x6a, 0x83, 0xff, 0x4b, 0x62, 0x7c, 0xff, 0x4f, 0x62, 0x7e, 0xff, 0x44, 0x58, 0x6e, 0xff, 0x35, 0x46, 0x56, 0xff, 0x30, 0x3c, 0x4d, 0xff, 0x37, 0x45, 0x52, 0xff, 0x48, 0x5f, 0x67, 0xff, 0x50, 0x66, 0x77, 0xff, 0x82, 0x8d, 0xa0, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x1c, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0xbc, 0xc4, 0xff, 0x40, 0x4a, 0x5d, 0xff, 0x52, 0x6b, 0x81, 0xff, 0x34, 0x3c, 0x4e, 0xff, 0x43, 0x44, 0x52, 0xff, 0x37, 0x44, 0x51, 0xff, 0x3f, 0x55, 0x61, 0xff, 0x37, 0x54, 0x5e, 0xff, 0x37, 0x4f, 0x5f, 0xff, 0x2e, 0x42, 0x56, 0xff, 0x3a, 0x4f, 0x61, 0xff, 0x54, 0x69, 0x7c, 0xff, 0x57, 0x6c, 0x7e, 0xff, 0x48, 0x5e, 0x72, 0xff, 0x4e, 0x64, 0x7a, 0xff, 0x61, 0x77, 0x8d, 0xff, 0x5f, 0x76, 0x8b, 0xff, 0x6a, 0x80, 0x95, 0xff, 0x61, 0x77, 0x8e, 0xff, 0x65, 0x7a, 0x92, 0xff, 0x5e, 0x74, 0x8c, 0xff, 0x5e, 0x74, 0x8c, 0xff, 0x59, 0x6e, 0x83, 0xff, 0x67, 0x82, 0xa4, 0xff, 0x7f, 0xa0, 0xca, 0xff, 0x98, 0xb8, 0xe0, 0xff, 0x8b, 0xaa, 0xd2, 0xff, 0x85, 0xa5, 0xce, 0xff, 0x85, 0xa2, 0xc4, 0xff, 0x79, 0x95, 0xb3, 0xff, 0x6c, 0x88, 0xa7, 0xff, 0x5b, 0x78, 0x97, 0xff, 0x52, 0x6e, 0x8d, 0xff, 0x57, 0x74, 0x91, 0xff, 0x56, 0x73, 0x8e, 0xff, 0x58, 0x72, 0x8e, 0xff, 0x5e, 0x75, 0x91, 0xff, 0x57, 0x6c, 0x8a, 0xff, 0x40, 0x58, 0x6f, 0xff, 0x35, 0x48, 0x5a, 0xff, 0x33, 0x3f, 0x50, 0xff, 0x3d, 0x4a, 0x57, 0xff, 0x44, 0x58, 0x5f, 0xff, 0x5e, 0x74, 0x86, 0xff, 0x60, 0x6f, 0x87, 0xff, 0xce, 0xd4, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xfe, 0xfe, 0xfe, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf5, 0xfa, 0xfb, 0xff, 0x53, 0x69, 0x7e, 0xff, 0x43, 0x5d, 0x75, 0xff, 0x4f, 0x63, 0x71, 0xff, 0x3c, 0x47, 0x4f, 0xff, 0x43, 0x4e, 0x57, 0xff, 0x3a, 0x4a, 0x57, 0xff, 0x3e, 0x53, 0x65, 0xff, 0x43, 0x5c, 0x70, 0xff, 0x3d, 0x58, 0x6b, 0xff, 0x3e, 0x5b, 0x6e, 0xff, 0x44, 0x5f, 0x74, 0xff, 0x4e, 0x69, 0x80, 0xff, 0x63, 0x7c, 0x95, 0xff, 0x69, 0x82, 0x9e, 0xff, 0x62, 0x7b, 0x99, 0xff, 0x71, 0x8a, 0xa7, 0xff, 0x7f, 0x97, 0xb5, 0xff, 0x83, 0x9b, 0xb8, 0xff, 0x7f, 0x99, 0xb9, 0xff, 0x7e, 0x97, 0xba, 0xff, 0x75, 0x8c, 0xac, 0xff, 0x75, 0x8b, 0xa8, 0xff, 0x7e, 0x92, 0xac, 0xff, 0x75, 0x8f, 0xb0, 0xff, 0x7e, 0x9c, 0xc3, 0xff, 0x92, 0xb1, 0xd7, 0xff, 0x97, 0xb8, 0xe1, 0xff, 0x8f, 0xb2, 0xde, 0xff, 0x89, 0xaa, 0xd1, 0xff, 0x7f, 0x9e, 0xc1, 0xff, 0x79, 0x99, 0xbd, 0xff, 0x71, 0x90, 0xb4, 0xff, 0x75, 0x94, 0xb9, 0xff, 0x76, 0x94, 0xb6, 0xff, 0x72, 0x8d, 0xad, 0xff, 0x6b, 0x87, 0xa6, 0xff, 0x6e, 0x86, 0xa3, 0xff, 0x68, 0x7f, 0x9b, 0xff, 0x59, 0x70, 0x8a, 0xff, 0x50, 0x66, 0x7c, 0xff, 0x3c, 0x4f, 0x61, 0xff, 0x42, 0x51, 0x5f, 0xff, 0x46, 0x51, 0x5a, 0xff, 0x59, 0x6c, 0x7b, 0xff, 0x4d, 0x6b, 0x7d, 0xff, 0x9a, 0xa9, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x0a, 0xff, 0xff, 0xff, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xc2, 0xc9, 0xff, 0x3a, 0x51, 0x68, 0xff, 0x49, 0x65, 0x7c, 0xff, 0x41, 0x55, 0x61, 0xff, 0x3b, 0x4b, 0x54, 0xff, 0x41, 0x51, 0x5f, 0xff, 0x49, 0x5d, 0x6f, 0xff, 0x3b, 0x52, 0x68, 0xff, 0x3a, 0x52, 0x6c, 0xff, 0x48, 0x65, 0x7d, 0xff, 0x54, 0x73, 0x8a, 0xff, 0x60, 0x7c, 0x97, 0xff, 0x68, 0x84, 0xa1, 0xff, 0x7a, 0x94, 0xb4, 0xff, 0x8c, 0xa6, 0xc8, 0xff, 0x90, 0xaa, 0xcc, 0xff, 0x8b, 0xa5, 0xc6, 0xff, 0x93, 0xae, 0xcf, 0xff, 0x96, 0xb1, 0xd1, 0xff, 0x95, 0xb0, 0xd4, 0xff, 0x91, 0xac, 0xd1, 0xff, 0x89, 0xa2, 0xc5, 0xff, 0x8c, 0xa2, 0xc2, 0xff, 0x95, 0xa9, 0xc6, 0xff, 0x97, 0xaf, 0xd0, 0xff, 0x8f, 0xab, 0xd1, 0xff, 0x91, 0xad, 0xd4, 0xff, 0x96, 0xb4, 0xdd, 0xff, 0x99, 0xba, 0xe6, 0xff, 0x9d, 0xbd, 0xe7, 0xff, 0x93, 0xb2, 0xda, 0xff, 0x8b, 0xaa, 0xd2, 0xff, 0x84, 0xa3, 0xcb, 0xff, 0x77, 0x97, 0xc0, 0xff, 0x75, 0x93, 0xba, 0xff, 0x6e, 0x8a, 0xad, 0xff, 0x64, 0x80, 0xa2, 0xff, 0x5b, 0x75, 0x95, 0xff, 0x58, 0x70, 0x8e, 0xff, 0x57, 0x6f, 0x8a, 0xff, 0x43, 0x5a, 0x73, 0xff, 0x3b, 0x4f, 0x65, 0xff, 0x40, 0x4f, 0x60, 0xff, 0x3c, 0x47, 0x54, 0xff, 0x58, 0x68, 0x79, 0xff, 0x53, 0x73, 0x82, 0xff, 0x73, 0x87, 0x91, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0xff, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x7e, 0x8b, 0x97, 0xff, 0x3d, 0x52, 0x65, 0xff, 0x40, 0x59, 0x6c, 0xff, 0x42, 0x57, 0x65, 0xff, 0x40, 0x54, 0x64, 0xff, 0x48, 0x5e, 0x73, 0xff, 0x56, 0x6f, 0x87, 0xff, 0x53, 0x70, 0x8c, 0xff, 0x4d, 0x6c, 0x8b, 0xff, 0x50, 0x6e, 0x8f, 0xff, 0x63, 0x81, 0xa3, 0xff, 0x75, 0x92, 0xb6, 0xff, 0x88, 0xa5, 0xcb, 0xff, 0x98, 0xb4, 0xdd, 0xff, 0x9a, 0xb6, 0xde, 0xff, 0x9f, 0xbb, 0xe2, 0xff, 0x9f, 0xbb, 0xe3, 0xff, 0x9b, 0xb7, 0xde, 0xff, 0x9d, 0xba, 0xe1, 0xff, 0x9b, 0xb6, 0xdf, 0xff, 0x9c, 0xb6, 0xdf, 0xff, 0x98, 0xb2, 0xd9, 0xff, 0x9d, 0xb5, 0xd9, 0xff, 0xa6, 0xbb, 0xdd, 0xff, 0xa6, 0xbc, 0xe1, 0xff, 0xa2, 0xbb, 0xe4, 0xff, 0xa2, 0xbb, 0xe6, 0xff, 0x9f, 0xb9, 0xe6, 0xff, 0x9c, 0xb9, 0xe7, 0xff, 0xa1, 0xbd, 0xeb, 0xff, 0xa3, 0xc0, 0xed, 0xff, 0x9e, 0xba, 0xe7, 0xff, 0x95, 0xb2, 0xdf, 0xff, 0x84, 0xa0, 0xce, 0xff, 0x71, 0x8f, 0xba, 0xff, 0x62, 0x80, 0xa7, 0xff, 0x52, 0x6e, 0x94, 0xff, 0x48, 0x62, 0x86, 0xff, 0x47, 0x61, 0x83, 0xff, 0x40, 0x58, 0x78, 0xff, 0x35, 0x4c, 0x69, 0xff, 0x40, 0x55, 0x70, 0xff, 0x3d, 0x4e, 0x63, 0xff, 0x3d, 0x4b, 0x5c, 0xff, 0x56, 0x64, 0x77, 0xff, 0x55, 0x71, 0x81, 0xff, 0x51, 0x69, 0x73, 0xff, 0xe7, 0xe4, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xe5, 0xed, 0xff, 0x53, 0x64, 0x78, 0xff, 0x45, 0x57, 0x68, 0xff, 0x3d, 0x52, 0x63, 0xff, 0x46, 0x5e, 0x6c, 0xff, 0x4a, 0x63, 0x79, 0xff, 0x56, 0x71, 0x8d, 0xff, 0x62, 0x80, 0x9d, 0xff, 0x64, 0x85, 0xa8, 0xff, 0x64, 0x89, 0xad, 0xff, 0x65, 0x86, 0xb0, 0xff, 0x74, 0x94, 0xbf, 0xff, 0x83, 0xa3, 0xd0, 0xff, 0x8d, 0xab, 0xdb, 0xff, 0x95, 0xb3, 0xe6, 0xff, 0x96, 0xb4, 0xe5, 0xff, 0x98, 0xb6, 0xe5, 0xff, 0x9c, 0xba, 0xea, 0xff, 0x98, 0xb7, 0xe6, 0xff, 0x96, 0xb5, 0xe4, 0xff, 0x98, 0xb6, 0xe5, 0xff, 0x9e, 0xb9, 0xe6, 0xff, 0x9f, 0xb9, 0xe5, 0xff, 0x9f, 0xb8, 0xe1, 0xff, 0xa6, 0xbe, 0xe5, 0xff, 0xaa, 0xbd, 0xe7, 0xff, 0xab, 0xbe, 0xea, 0xff, 0xa9, 0xbe, 0xec, 0xff, 0xa5, 0xbc, 0xec, 0xff, 0xa1, 0xb9, 0xe9, 0xff, 0x9d, 0xb7, 0xe9, 0xff, 0x9f, 0xba, 0xec, 0xff, 0xa1, 0xbc, 0xee, 0xff, 0x9e, 0xb9, 0xeb, 0xff, 0xa1, 0xbb, 0xed, 0xff, 0x9e, 0xbc, 0xeb, 0xff, 0x8c, 0xab, 0xd8, 0xff, 0x7c, 0x98, 0xc4, 0xff, 0x66, 0x81, 0xaa, 0xff, 0x55, 0x6e, 0x96, 0xff, 0x57, 0x70, 0x96, 0xff, 0x61, 0x7a, 0x9b, 0xff, 0x64, 0x7a, 0x98, 0xff, 0x59, 0x6a, 0x85, 0xff, 0x45, 0x55, 0x6c, 0xff, 0x3f, 0x4a, 0x5f, 0xff, 0x57, 0x72, 0x81, 0xff, 0x41, 0x61, 0x68, 0xff, 0xd5, 0xd6, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x55, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xc8, 0xd5, 0xff, 0x42, 0x57, 0x6f, 0xff, 0x49, 0x5a, 0x6a, 0xff, 0x44, 0x57, 0x66, 0xff, 0x55, 0x6c, 0x7a, 0xff, 0x53, 0x6f, 0x88, 0xff, 0x62, 0x80, 0xa0, 0xff, 0x66, 0x87, 0xa9, 0xff, 0x66, 0x8b, 0xb1, 0xff, 0x69, 0x91, 0xba, 0xff, 0x74, 0x97, 0xc6, 0xff, 0x7f, 0xa0, 0xd2, 0xff, 0x89, 0xaa, 0xdd, 0xff, 0x90, 0xaf, 0xe5, 0xff, 0x93, 0xb1, 0xea, 0xff, 0x93, 0xb3, 0xe8, 0xff, 0x93, 0xb5, 0xe6, 0xff, 0x94, 0xb5, 0xe7, 0xff, 0x95, 0xb6, 0xe9, 0xff, 0x93, 0xb5, 0xe7, 0xff, 0x97, 0xb5, 0xe7, 0xff, 0x9e, 0xb9, 0xea, 0xff, 0x9e, 0xb8, 0xe7, 0xff, 0xa1, 0xba, 0xe6, 0xff, 0xa7, 0xbf, 0xea, 0xff, 0xad, 0xc0, 0xec, 0xff, 0xad, 0xbe, 0xec, 0xff, 0xa8, 0xbd, 0xec, 0xff, 0xa7, 0xbd, 0xef, 0xff, 0xa1, 0xb8, 0xeb, 0xff, 0x9e, 0xb7, 0xec, 0xff, 0x9c, 0xb7, 0xed, 0xff, 0x9b, 0xb6, 0xeb, 0xff, 0x9c, 0xb6, 0xeb, 0xff, 0x9f, 0xb8, 0xee, 0xff, 0x9d, 0xbc, 0xee, 0xff, 0x9c, 0xbc, 0xec, 0xff, 0x97, 0xb4, 0xe3, 0xff, 0x8d, 0xa8, 0xd4, 0xff, 0x82, 0x9a, 0xc5, 0xff, 0x77, 0x91, 0xb9, 0xff, 0x70, 0x8b, 0xaf, 0xff, 0x71, 0x87, 0xa8, 0xff, 0x74, 0x86, 0xa3, 0xff, 0x59, 0x69, 0x84, 0xff, 0x3e, 0x46, 0x5e, 0xff, 0x51, 0x69, 0x78, 0xff, 0x42, 0x64, 0x6c, 0xff, 0xbe, 0xc3, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x29, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0xb4, 0xc3, 0xff, 0x36, 0x50, 0x64, 0xff, 0x4d, 0x5c, 0x6b, 0xff, 0x4d, 0x5f, 0x70, 0xff, 0x5e, 0x73, 0x8b, 0xff, 0x5f, 0x7e, 0x9a, 0xff, 0x64, 0x88, 0xa6, 0xff, 0x64, 0x89, 0xad, 0xff, 0x62, 0x8a, 0xb6, 0xff, 0x6a, 0x95, 0xc5, 0xff, 0x7d, 0xa1, 0xd5, 0xff, 0x84, 0xa5, 0xda, 0xff, 0x88, 0xaa, 0xdf, 0xff, 0x8a, 0xac, 0xe2, 0xff, 0x8d, 0xae, 0xe4, 0xff, 0x8c, 0xb1, 0xe7, 0xff, 0x8e, 0xb6, 0xeb, 0xff, 0x92, 0xb5, 0xe9, 0xff, 0x97, 0xb5, 0xe7, 0xff, 0x9a, 0xb7, 0xe8, 0xff, 0x9f, 0xb8, 0xe7, 0xff, 0xa5, 0xbb, 0xe8, 0xff, 0xaa, 0xbf, 0xea, 0xff, 0xad, 0xc1, 0xe9, 0xff, 0xb0, 0xc2, 0xe8, 0xff, 0xaf, 0xc4, 0xec, 0xff, 0xad, 0xc6, 0xef, 0xff, 0xac, 0xc4, 0xed, 0xff, 0xaa, 0xc2, 0xeb, 0xff, 0xa6, 0xbe, 0xe6, 0xff, 0x9e, 0xb9, 0xe9, 0xff, 0x99, 0xb7, 0xed, 0xff, 0x98, 0xb6, 0xeb, 0xff, 0x96, 0xb5, 0xea, 0xff, 0x97, 0xb5, 0xec, 0xff, 0x92, 0xb2, 0xea, 0xff, 0x93, 0xb5, 0xea, 0xff, 0x94, 0xb4, 0xe4, 0xff, 0x95, 0xb1, 0xdd, 0xff, 0x9b, 0xb6, 0xdb, 0xff, 0x90, 0xa9, 0xd2, 0xff, 0x76, 0x8f, 0xba, 0xff, 0x69, 0x87, 0xaa, 0xff, 0x71, 0x8c, 0xa8, 0xff, 0x60, 0x72, 0x8b, 0xff, 0x4c, 0x59, 0x6d, 0xff, 0x4c, 0x5d, 0x6d, 0xff, 0x39, 0x4d, 0x5e, 0xff, 0x9b, 0xa6, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x07, 0xfe, 0xfe, 0xfe, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x9e, 0xac, 0xff, 0x31, 0x4c, 0x5f, 0xff, 0x4d, 0x5c, 0x6a, 0xff, 0x55, 0x67, 0x78, 0xff, 0x5b, 0x70, 0x8a, 0xff, 0x69, 0x87, 0xa4, 0xff, 0x67, 0x8b, 0xa9, 0xff, 0x6d, 0x93, 0xb6, 0xff, 0x6f, 0x97, 0xc4, 0xff, 0x74, 0x9f, 0xd0, 0xff, 0x7e, 0xa2, 0xd7, 0xff, 0x84, 0xa5, 0xdb, 0xff, 0x88, 0xab, 0xe0, 0xff, 0x8a, 0xac, 0xe1, 0xff, 0x8d, 0xae, 0xe4, 0xff, 0x8d, 0xb2, 0xe7, 0xff, 0x90, 0xb6, 0xeb, 0xff, 0x96, 0xb8, 0xea, 0xff, 0x9e, 0xb9, 0xe9, 0xff, 0xa2, 0xba, 0xe9, 0xff, 0xa5, 0xbb, 0xe7, 0xff, 0xac, 0xc0, 0xe8, 0xff, 0xb2, 0xc5, 0xec, 0xff, 0xb5, 0xc8, 0xed, 0xff, 0xb8, 0xc8, 0xec, 0xff, 0xb7, 0xca, 0xeb, 0xff, 0xba, 0xcf, 0xee, 0xff, 0xbc, 0xd0, 0xf0, 0xff, 0xb8, 0xcc, 0xec, 0xff, 0xb6, 0xc8, 0xe5, 0xff, 0xab, 0xc1, 0xea, 0xff, 0xa1, 0xbc, 0xef, 0xff, 0x9d, 0xb8, 0xea, 0xff, 0x96, 0xb4, 0xe8, 0xff, 0x93, 0xb3, 0xe7, 0xff, 0x91, 0xb2, 0xe8, 0xff, 0x8f, 0xb0, 0xe8, 0xff, 0x92, 0xb3, 0xe5, 0xff, 0x8e, 0xae, 0xda, 0xff, 0x8b, 0xaa, 0xd0, 0xff, 0x91, 0xab, 0xd6, 0xff, 0x83, 0x9e, 0xcb, 0xff, 0x67, 0x88, 0xac, 0xff, 0x63, 0x81, 0x9e, 0xff, 0x5d, 0x72, 0x8a, 0xff, 0x46, 0x56, 0x69, 0xff, 0x49, 0x59, 0x69, 0xff, 0x36, 0x47, 0x5a, 0xff, 0x89, 0x95, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xd1, 0xfe, 0xfe, 0xfe, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0x8b, 0x99, 0xff, 0x34, 0x4f, 0x62, 0xff, 0x47, 0x56, 0x64, 0xff, 0x59, 0x6b, 0x7c, 0xff, 0x5d, 0x73, 0x8b, 0xff, 0x65, 0x81, 0x9e, 0xff, 0x75, 0x95, 0xb4, 0xff, 0x7e, 0xa0, 0xc4, 0xff, 0x79, 0x9d, 0xcb, 0xff, 0x79, 0xa0, 0xd1, 0xff, 0x7d, 0xa0, 0xd5, 0xff, 0x83, 0xa4, 0xda, 0xff, 0x87, 0xa9, 0xde, 0xff, 0x89, 0xab, 0xe0, 0xff, 0x8c, 0xad, 0xe3, 0xff, 0x90, 0xb3, 0xe6, 0xff, 0x98, 0xb8, 0xea, 0xff, 0x9e, 0xbb, 0xeb, 0xff, 0xa5, 0xbc, 0xeb, 0xff, 0xaa, 0xbe, 0xed, 0xff, 0xad, 0xc1, 0xec, 0xff, 0xb2, 0xc6, 0xec, 0xff, 0xb6, 0xc8, 0xee, 0xff, 0xb6, 0xc7, 0xeb, 0xff, 0xba, 0xca, 0xed, 0xff, 0xc2, 0xce, 0xea, 0xff, 0xc9, 0xd2, 0xea, 0xff, 0xca, 0xd4, 0xee, 0xff, 0xc8, 0xd3, 0xec, 0xff, 0xc6, 0xcf, 0xe6, 0xff, 0xb8, 0xc9, 0xeb, 0xff, 0xac, 0xc3, 0xee, 0xff, 0xa6, 0xbd, 0xea, 0xff, 0x9e, 0xb9, 0xea, 0xff, 0x97, 0xb5, 0xe9, 0xff, 0x92, 0xb2, 0xe8, 0xff, 0x8e, 0xae, 0xe4, 0xff, 0x8b, 0xac, 0xdf, 0xff, 0x89, 0xab, 0xda, 0xff, 0x83, 0xa7, 0xd4, 0xff, 0x84, 0xa1, 0xd0, 0xff, 0x84, 0xa0, 0xcd, 0xff, 0x64, 0x86, 0xad, 0xff, 0x56, 0x75, 0x92, 0xff, 0x60, 0x76, 0x91, 0xff, 0x42, 0x52, 0x67, 0xff, 0x4a, 0x5a, 0x6a, 0xff, 0x49, 0x5b, 0x6d, 0xff, 0x7b, 0x86, 0x91, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfa, 0xff, 0x6d, 0x80, 0x8e, 0xff, 0x37, 0x52, 0x66, 0xff, 0x41, 0x4f, 0x5e, 0xff, 0x41, 0x53, 0x64, 0xff, 0x63, 0x79, 0x91, 0xff, 0x76, 0x90, 0xad, 0xff, 0x82, 0x9f, 0xbe, 0xff, 0x86, 0xa5, 0xca, 0xff, 0x7f, 0xa0, 0xcf, 0xff, 0x7b, 0x9f, 0xd1, 0xff, 0x7d, 0xa0, 0xd5, 0xff, 0x82, 0xa4, 0xda, 0xff, 0x85, 0xa7, 0xdc, 0xff, 0x88, 0xaa, 0xdf, 0xff, 0x8a, 0xae, 0xe3, 0xff, 0x93, 0xb2, 0xe5, 0xff, 0x9f, 0xb9, 0xe9, 0xff, 0xa5, 0xbd, 0xec, 0xff, 0xac, 0xbf, 0xed, 0xff, 0xb3, 0xc2, 0xf0, 0xff, 0xb3, 0xc5, 0xed, 0xff, 0xb2, 0xc6, 0xea, 0xff, 0xb8, 0xca, 0xee, 0xff, 0xbd, 0xcc, 0xee, 0xff, 0xbd, 0xcb, 0xeb, 0xff, 0xc5, 0xcf, 0xe9, 0xff, 0xca, 0xd2, 0xe9, 0xff, 0xca, 0xd3, 0xeb, 0xff, 0xcb, 0xd4, 0xeb, 0xff, 0xca, 0xd2, 0xe8, 0xff, 0xc3, 0xce, 0xea, 0xff, 0xba, 0xc9, 0xec, 0xff, 0xb1, 0xc4, 0xec, 0xff, 0xa6, 0xbd, 0xec, 0xff, 0x9a, 0xb6, 0xea, 0xff, 0x93, 0xb2, 0xe7, 0xff, 0x8e, 0xae, 0xe2, 0xff, 0x87, 0xa8, 0xdd, 0xff, 0x82, 0xa7, 0xda, 0xff, 0x7c, 0xa5, 0xd7, 0xff, 0x7a, 0x9c, 0xcd, 0xff, 0x7e, 0x9c, 0xcb, 0xff, 0x73, 0x97, 0xbf, 0xff, 0x59, 0x7b, 0x9a, 0xff, 0x57, 0x6f, 0x8c, 0xff, 0x3d, 0x4d, 0x62, 0xff, 0x42, 0x52, 0x61, 0xff, 0x54, 0x66, 0x78, 0xff, 0x74, 0x80, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x09, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf0, 0xee, 0xff, 0x68, 0x7c, 0x89, 0xff, 0x3e, 0x59, 0x6d, 0xff, 0x35, 0x44, 0x53, 0xff, 0x36, 0x48, 0x59, 0xff, 0x5b, 0x71, 0x89, 0xff, 0x82, 0x9a, 0xb8, 0xff, 0x8a, 0xa6, 0xc5, 0xff, 0x8d, 0xaa, 0xcf, 0xff, 0x89, 0xa9, 0xd7, 0xff, 0x82, 0xa3, 0xd6, 0xff, 0x80, 0xa3, 0xd8, 0xff, 0x83, 0xa4, 0xda, 0xff, 0x84, 0xa6, 0xdb, 0xff, 0x88, 0xaa, 0xdf, 0xff, 0x8a, 0xae, 0xe3, 0xff, 0x95, 0xb2, 0xe3, 0xff, 0xa2, 0xb9, 0xe7, 0xff, 0xa7, 0xbc, 0xeb, 0xff, 0xaf, 0xbe, 0xeb, 0xff, 0xb5, 0xc1, 0xed, 0xff, 0xb3, 0xc4, 0xea, 0xff, 0xb2, 0xc4, 0xe7, 0xff, 0xba, 0xc9, 0xeb, 0xff, 0xc0, 0xce, 0xed, 0xff, 0xbf, 0xca, 0xe8, 0xff, 0xc0, 0xcb, 0xe7, 0xff, 0xc3, 0xce, 0xe9, 0xff, 0xc4, 0xcf, 0xea, 0xff, 0xc4, 0xcf, 0xea, 0xff, 0xc4, 0xd0, 0xeb, 0xff, 0xc5, 0xce, 0xe8, 0xff, 0xc1, 0xcb, 0xe7, 0xff, 0xb8, 0xc8, 0xec, 0xff, 0xaa, 0xc1, 0xed, 0xff, 0x9c, 0xb7, 0xe9, 0xff, 0x93, 0xb0, 0xe4, 0xff, 0x8d, 0xac, 0xdf, 0xff, 0x87, 0xa8, 0xdd, 0xff, 0x7c, 0xa4, 0xd9, 0xff, 0x73, 0x9f, 0xd5, 0xff, 0x7a, 0x9d, 0xd1, 0xff, 0x7d, 0x9c, 0xcb, 0xff, 0x73, 0x99, 0xc2, 0xff, 0x63, 0x85, 0xa7, 0xff, 0x52, 0x6c, 0x8b, 0xff, 0x33, 0x44, 0x5a, 0xff, 0x3e, 0x4e, 0x5d, 0xff, 0x42, 0x54, 0x66, 0xff, 0x6c, 0x78, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xee, 0xeb, 0xff, 0x66, 0x79, 0x88, 0xff, 0x4b, 0x60, 0x74, 0xff, 0x3b, 0x4b, 0x59, 0xff, 0x41, 0x55, 0x65, 0xff, 0x5c, 0x75, 0x8e, 0xff, 0x79, 0x93, 0xb1, 0xff, 0x89, 0xa3, 0xc5, 0xff, 0x8f, 0xac, 0xcf, 0xff, 0x93, 0xb1, 0xd6, 0xff, 0x8f, 0xae, 0xd6, 0xff, 0x89, 0xaa, 0xd5, 0xff, 0x85, 0xa6, 0xd5, 0xff, 0x87, 0xa8, 0xd7, 0xff, 0x89, 0xaa, 0xdc, 0xff, 0x8e, 0xae, 0xe2, 0xff, 0x97, 0xb4, 0xe4, 0xff, 0x9f, 0xb8, 0xe5, 0xff, 0xa3, 0xba, 0xe8, 0xff, 0xa8, 0xbe, 0xe9, 0xff, 0xab, 0xc0, 0xe9, 0xff, 0xb0, 0xc1, 0xea, 0xff, 0xb2, 0xc0, 0xe9, 0xff, 0xb5, 0xc3, 0xec, 0xff, 0xb7, 0xc5, 0xed, 0xff, 0xb7, 0xc5, 0xee, 0xff, 0xb9, 0xc6, 0xe9, 0xff, 0xbb, 0xc9, 0xe7, 0xff, 0xbc, 0xc9, 0xe9, 0xff, 0xba, 0xc7, 0xe7, 0xff, 0xbc, 0xc9, 0xe8, 0xff, 0xb9, 0xc9, 0xe9, 0xff, 0xb5, 0xc7, 0xea, 0xff, 0xb0, 0xc6, 0xec, 0xff, 0xa4, 0xbe, 0xec, 0xff, 0x9b, 0xb8, 0xe8, 0xff, 0x91, 0xb1, 0xe5, 0xff, 0x84, 0xa8, 0xde, 0xff, 0x80, 0xa3, 0xda, 0xff, 0x7b, 0xa0, 0xd6, 0xff, 0x77, 0x9d, 0xd3, 0xff, 0x7b, 0x9c, 0xd3, 0xff, 0x7d, 0x9d, 0xcf, 0xff, 0x74, 0x99, 0xc3, 0xff, 0x6b, 0x8b, 0xab, 0xff, 0x5b, 0x71, 0x8d, 0xff, 0x30, 0x3f, 0x54, 0xff, 0x34, 0x45, 0x55, 0xff, 0x40, 0x52, 0x64, 0xff, 0x66, 0x71, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xf0, 0xec, 0xff, 0x63, 0x76, 0x84, 0xff, 0x4d, 0x61, 0x76, 0xff, 0x3f, 0x4f, 0x5d, 0xff, 0x4c, 0x61, 0x71, 0xff, 0x77, 0x90, 0xa9, 0xff, 0x73, 0x8e, 0xad, 0xff, 0x85, 0x9e, 0xc0, 0xff, 0x90, 0xac, 0xce, 0xff, 0x93, 0xaf, 0xd3, 0xff, 0x92, 0xb1, 0xd6, 0xff, 0x8c, 0xad, 0xd5, 0xff, 0x86, 0xa7, 0xd4, 0xff, 0x87, 0xa8, 0xd5, 0xff, 0x89, 0xa9, 0xda, 0xff, 0x8e, 0xae, 0xe1, 0xff, 0x95, 0xb2, 0xe4, 0xff, 0x9a, 0xb4, 0xe4, 0xff, 0x9f, 0xb7, 0xe6, 0xff, 0xa3, 0xbb, 0xe8, 0xff, 0xa4, 0xbc, 0xe7, 0xff, 0xab, 0xbc, 0xe7, 0xff, 0xae, 0xbc, 0xe7, 0xff, 0xaf, 0xbf, 0xea, 0xff, 0xaf, 0xbf, 0xea, 0xff, 0xae, 0xbf, 0xec, 0xff, 0xb1, 0xc1, 0xe7, 0xff, 0xb2, 0xc2, 0xe3, 0xff, 0xb1, 0xc1, 0xe4, 0xff, 0xb1, 0xc0, 0xe3, 0xff, 0xb4, 0xc2, 0xe4, 0xff, 0xb1, 0xc3, 0xe7, 0xff, 0xac, 0xc3, 0xe9, 0xff, 0xa8, 0xc0, 0xea, 0xff, 0x9e, 0xb8, 0xe7, 0xff, 0x96, 0xb4, 0xe4, 0xff, 0x8c, 0xaf, 0xe3, 0xff, 0x83, 0xa8, 0xe0, 0xff, 0x7d, 0xa1, 0xd7, 0xff, 0x7a, 0x9e, 0xd4, 0xff, 0x78, 0x9c, 0xd2, 0xff, 0x7a, 0x9c, 0xd2, 0xff, 0x79, 0x99, 0xcc, 0xff, 0x77, 0x9b, 0xc6, 0xff, 0x62, 0x82, 0xa1, 0xff, 0x4c, 0x60, 0x7a, 0xff, 0x38, 0x47, 0x5c, 0xff, 0x3a, 0x4b, 0x5b, 0xff, 0x4c, 0x5f, 0x71, 0xff, 0x5f, 0x6b, 0x77, 0xff, 0xf5, 0xf7, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xf3, 0xef, 0xff, 0x65, 0x79, 0x87, 0xff, 0x4d, 0x62, 0x76, 0xff, 0x40, 0x50, 0x5e, 0xff, 0x44, 0x59, 0x69, 0xff, 0x6c, 0x85, 0x9d, 0xff, 0x77, 0x91, 0xb0, 0xff, 0x86, 0x9f, 0xc1, 0xff, 0x90, 0xab, 0xce, 0xff, 0x90, 0xad, 0xd1, 0xff, 0x8b, 0xaa, 0xd0, 0xff, 0x85, 0xa7, 0xd0, 0xff, 0x86, 0xa7, 0xd5, 0xff, 0x86, 0xa7, 0xd6, 0xff, 0x87, 0xa7, 0xd8, 0xff, 0x8d, 0xad, 0xe0, 0xff, 0x90, 0xae, 0xe2, 0xff, 0x94, 0xb0, 0xe2, 0xff, 0x9a, 0xb4, 0xe5, 0xff, 0x9d, 0xb6, 0xe4, 0xff, 0x9f, 0xb8, 0xe5, 0xff, 0xa5, 0xb8, 0xe4, 0xff, 0xa7, 0xb8, 0xe3, 0xff, 0xa8, 0xb9, 0xe5, 0xff, 0xa8, 0xba, 0xe5, 0xff, 0xa8, 0xba, 0xe6, 0xff, 0xaa, 0xbd, 0xe5, 0xff, 0xaa, 0xbd, 0xe3, 0xff, 0xa7, 0xba, 0xe0, 0xff, 0xa8, 0xbb, 0xe1, 0xff, 0xa9, 0xbc, 0xe2, 0xff, 0xa9, 0xbd, 0xe4, 0xff, 0xa6, 0xbd, 0xe4, 0xff, 0xa2, 0xbb, 0xe6, 0xff, 0x99, 0xb5, 0xe6, 0xff, 0x90, 0xaf, 0xe3, 0xff, 0x89, 0xac, 0xe1, 0xff, 0x83, 0xa8, 0xde, 0xff, 0x7d, 0xa1, 0xd7, 0xff, 0x7a, 0x9e, 0xd4, 0xff, 0x77, 0x9c, 0xd2, 0xff, 0x77, 0x99, 0xcf, 0xff, 0x79, 0x99, 0xcc, 0xff, 0x76, 0x9a, 0xc5, 0xff, 0x65, 0x85, 0xa4, 0xff, 0x4b, 0x60, 0x7b, 0xff, 0x4d, 0x5c, 0x71, 0xff, 0x40, 0x51, 0x61, 0xff, 0x41, 0x54, 0x66, 0xff, 0x56, 0x62, 0x6d, 0xff, 0xed, 0xef, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xfc, 0xfa, 0xff, 0x70, 0x83, 0x91, 0xff, 0x4d, 0x62, 0x76, 0xff, 0x39, 0x4a, 0x58, 0xff, 0x3d, 0x51, 0x62, 0xff, 0x62, 0x7b, 0x94, 0xff, 0x78, 0x92, 0xb1, 0xff, 0x86, 0x9f, 0xc1, 0xff, 0x8c, 0xa8, 0xca, 0xff, 0x8c, 0xa9, 0xcd, 0xff, 0x87, 0xa6, 0xcc, 0xff, 0x7f, 0xa1, 0xca, 0xff, 0x80, 0xa2, 0xcf, 0xff, 0x82, 0xa3, 0xd1, 0xff, 0x83, 0xa3, 0xd4, 0xff, 0x86, 0xa5, 0xd8, 0xff, 0x8b, 0xaa, 0xdf, 0xff, 0x8e, 0xad, 0xe2, 0xff, 0x92, 0xad, 0xe0, 0xff, 0x96, 0xb0, 0xe0, 0xff, 0x9a, 0xb4, 0xe2, 0xff, 0xa0, 0xb5, 0xe3, 0xff, 0xa1, 0xb2, 0xe1, 0xff, 0xa0, 0xb3, 0xe2, 0xff, 0xa3, 0xb6, 0xe5, 0xff, 0xa5, 0xb7, 0xe6, 0xff, 0xa5, 0xba, 0xe6, 0xff, 0xa3, 0xb9, 0xe3, 0xff, 0xa2, 0xb8, 0xe2, 0xff, 0xa1, 0xb7, 0xe2, 0xff, 0xa1, 0xb7, 0xe2, 0xff, 0xa0, 0xb8, 0xe1, 0xff, 0x9f, 0xb7, 0xe0, 0xff, 0x9a, 0xb5, 0xe2, 0xff, 0x91, 0xb0, 0xe2, 0xff, 0x88, 0xa9, 0xe0, 0xff, 0x83, 0xa6, 0xdc, 0xff, 0x7c, 0xa1, 0xd7, 0xff, 0x79, 0x9d, 0xd3, 0xff, 0x78, 0x9c, 0xd2, 0xff, 0x76, 0x9a, 0xd1, 0xff, 0x76, 0x97, 0xcd, 0xff, 0x78, 0x98, 0xca, 0xff, 0x74, 0x99, 0xc3, 0xff, 0x71, 0x91, 0xb0, 0xff, 0x5e, 0x73, 0x8e, 0xff, 0x4e, 0x5c, 0x71, 0xff, 0x42, 0x53, 0x62, 0xff, 0x41, 0x53, 0x65, 0xff, 0x57, 0x63, 0x6e, 0xff, 0xec, 0xee, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x8f, 0x9d, 0xff, 0x4c, 0x60, 0x75, 0xff, 0x42, 0x52, 0x60, 0xff, 0x35, 0x48, 0x59, 0xff, 0x5c, 0x75, 0x8d, 0xff, 0x77, 0x91, 0xb0, 0xff, 0x85, 0x9e, 0xc0, 0xff, 0x89, 0xa5, 0xc7, 0xff, 0x88, 0xa4, 0xc9, 0xff, 0x83, 0xa2, 0xc8, 0xff, 0x7f, 0xa0, 0xc9, 0xff, 0x7a, 0x9b, 0xc9, 0xff, 0x7e, 0x9e, 0xcd, 0xff, 0x81, 0xa1, 0xd3, 0xff, 0x82, 0xa0, 0xd3, 0xff, 0x85, 0xa4, 0xda, 0xff, 0x89, 0xa8, 0xdf, 0xff, 0x8c, 0xaa, 0xdf, 0xff, 0x90, 0xab, 0xde, 0xff, 0x94, 0xaf, 0xdf, 0xff, 0x9b, 0xb1, 0xe1, 0xff, 0x9c, 0xaf, 0xdf, 0xff, 0x9d, 0xb1, 0xe1, 0xff, 0xa0, 0xb4, 0xe4, 0xff, 0xa3, 0xb6, 0xe7, 0xff, 0xa1, 0xb7, 0xe6, 0xff, 0x9d, 0xb5, 0xe3, 0xff, 0x9c, 0xb4, 0xe2, 0xff, 0x9d, 0xb4, 0xe2, 0xff, 0x9d, 0xb5, 0xe3, 0xff, 0x9b, 0xb3, 0xde, 0xff, 0x97, 0xb0, 0xda, 0xff, 0x93, 0xaf, 0xde, 0xff, 0x8c, 0xac, 0xe0, 0xff, 0x84, 0xa6, 0xdd, 0xff, 0x7d, 0xa2, 0xd8, 0xff, 0x79, 0x9d, 0xd3, 0xff, 0x74, 0x98, 0xcd, 0xff, 0x73, 0x97, 0xcd, 0xff, 0x74, 0x98, 0xce, 0xff, 0x75, 0x97, 0xcc, 0xff, 0x76, 0x96, 0xc9, 0xff, 0x73, 0x98, 0xc1, 0xff, 0x6e, 0x8e, 0xad, 0xff, 0x61, 0x76, 0x90, 0xff, 0x50, 0x5e, 0x73, 0xff, 0x3f, 0x50, 0x5f, 0xff, 0x4e, 0x61, 0x73, 0xff, 0x5c, 0x67, 0x73, 0xff, 0xe0, 0xe2, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x90, 0x9c, 0xff, 0x3c, 0x53, 0x64, 0xff, 0x50, 0x61, 0x6d, 0xff, 0x46, 0x5b, 0x6a, 0xff, 0x59, 0x73, 0x89, 0xff, 0x71, 0x8d, 0xa9, 0xff, 0x82, 0x9d, 0xbe, 0xff, 0x83, 0xa1, 0xc5, 0xff, 0x7f, 0xa2, 0xc9, 0xff, 0x7c, 0xa2, 0xcb, 0xff, 0x7c, 0x9c, 0xcc, 0xff, 0x7b, 0x99, 0xcc, 0xff, 0x7c, 0x9b, 0xcd, 0xff, 0x7e, 0x9d, 0xcf, 0xff, 0x7f, 0x9d, 0xd0, 0xff, 0x7e, 0xa0, 0xd2, 0xff, 0x84, 0xa7, 0xd9, 0xff, 0x88, 0xa9, 0xdc, 0xff, 0x8b, 0xaa, 0xdc, 0xff, 0x90, 0xac, 0xdf, 0xff, 0x96, 0xae, 0xde, 0xff, 0x9a, 0xb0, 0xde, 0xff, 0x9b, 0xb2, 0xe1, 0xff, 0x9d, 0xb4, 0xe3, 0xff, 0x9d, 0xb5, 0xe3, 0xff, 0x9f, 0xb6, 0xe2, 0xff, 0xa1, 0xb7, 0xe0, 0xff, 0x9d, 0xb3, 0xde, 0xff, 0x9d, 0xb3, 0xdd, 0xff, 0xa0, 0xb6, 0xdf, 0xff, 0x9d, 0xb4, 0xde, 0xff, 0x97, 0xb2, 0xdd, 0xff, 0x91, 0xae, 0xde, 0xff, 0x89, 0xab, 0xe2, 0xff, 0x7e, 0xa4, 0xe0, 0xff, 0x7b, 0xa0, 0xd7, 0xff, 0x7b, 0x9e, 0xd0, 0xff, 0x78, 0x9b, 0xce, 0xff, 0x76, 0x99, 0xcc, 0xff, 0x76, 0x99, 0xca, 0xff, 0x71, 0x98, 0xcd, 0xff, 0x6c, 0x94, 0xc9, 0xff, 0x75, 0x96, 0xc2, 0xff, 0x72, 0x8d, 0xac, 0xff, 0x62, 0x74, 0x8d, 0xff, 0x53, 0x68, 0x7d, 0xff, 0x4c, 0x5d, 0x6f, 0xff, 0x4b, 0x58, 0x67, 0xff, 0x3e, 0x56, 0x5b, 0xff, 0xd3, 0xdb, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x85, 0x96, 0xa1, 0xff, 0x37, 0x4f, 0x5f, 0xff, 0x53, 0x64, 0x6e, 0xff, 0x51, 0x66, 0x75, 0xff, 0x63, 0x7d, 0x93, 0xff, 0x78, 0x95, 0xb0, 0xff, 0x86, 0xa2, 0xc3, 0xff, 0x82, 0xa1, 0xc5, 0xff, 0x7b, 0x9f, 0xc8, 0xff, 0x79, 0xa0, 0xca, 0xff, 0x78, 0x9c, 0xce, 0xff, 0x7a, 0x9d, 0xd1, 0xff, 0x7a, 0x9d, 0xd0, 0xff, 0x79, 0x9d, 0xcf, 0xff, 0x7a, 0x9e, 0xd0, 0xff, 0x7c, 0xa0, 0xcf, 0xff, 0x82, 0xa6, 0xd3, 0xff, 0x86, 0xa7, 0xd6, 0xff, 0x8e, 0xac, 0xdb, 0xff, 0x92, 0xae, 0xdf, 0xff, 0x97, 0xb1, 0xdf, 0xff, 0x9a, 0xb1, 0xde, 0xff, 0x99, 0xb2, 0xe0, 0xff, 0x9c, 0xb4, 0xe2, 0xff, 0x99, 0xb2, 0xe0, 0xff, 0x9b, 0xb2, 0xde, 0xff, 0x9f, 0xb5, 0xe0, 0xff, 0x9d, 0xb4, 0xdf, 0xff, 0x9c, 0xb2, 0xdd, 0xff, 0x9f, 0xb5, 0xe0, 0xff, 0x9f, 0xb7, 0xe1, 0xff, 0x9b, 0xb6, 0xe1, 0xff, 0x93, 0xb0, 0xe0, 0xff, 0x89, 0xaa, 0xe0, 0xff, 0x7f, 0xa4, 0xde, 0xff, 0x7a, 0x9f, 0xd7, 0xff, 0x77, 0x9d, 0xd2, 0xff, 0x76, 0x9b, 0xd1, 0xff, 0x73, 0x99, 0xcf, 0xff, 0x72, 0x97, 0xcd, 0xff, 0x6e, 0x96, 0xcd, 0xff, 0x6c, 0x94, 0xc9, 0xff, 0x79, 0x98, 0xc5, 0xff, 0x81, 0x9c, 0xbd, 0xff, 0x73, 0x84, 0xa0, 0xff, 0x56, 0x6e, 0x85, 0xff, 0x5f, 0x6e, 0x81, 0xff, 0x44, 0x50, 0x5d, 0xff, 0x34, 0x50, 0x53, 0xff, 0xd5, 0xde, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8a, 0x9b, 0xa6, 0xff, 0x29, 0x40, 0x51, 0xff, 0x5b, 0x6c, 0x76, 0xff, 0x67, 0x7c, 0x8a, 0xff, 0x72, 0x8c, 0xa2, 0xff, 0x83, 0xa0, 0xbc, 0xff, 0x87, 0xa3, 0xc4, 0xff, 0x83, 0xa2, 0xc5, 0xff, 0x7c, 0x9f, 0xc7, 0xff, 0x79, 0x9f, 0xc9, 0xff, 0x75, 0x9d, 0xcd, 0xff, 0x73, 0x9e, 0xd0, 0xff, 0x73, 0x9d, 0xce, 0xff, 0x75, 0x9f, 0xd0, 0xff, 0x74, 0xa0, 0xd1, 0xff, 0x7e, 0xa3, 0xd2, 0xff, 0x89, 0xa9, 0xd5, 0xff, 0x8c, 0xab, 0xd8, 0xff, 0x92, 0xae, 0xdb, 0xff, 0x96, 0xb0, 0xde, 0xff, 0x98, 0xb1, 0xdf, 0xff, 0x9a, 0xb2, 0xe0, 0xff, 0x98, 0xb0, 0xde, 0xff, 0x9b, 0xb3, 0xe1, 0xff, 0x9c, 0xb4, 0xe3, 0xff, 0x99, 0xb1, 0xdf, 0xff, 0x9b, 0xb3, 0xe1, 0xff, 0x9b, 0xb3, 0xe1, 0xff, 0x9b, 0xb3, 0xe1, 0xff, 0x9c, 0xb4, 0xe2, 0xff, 0x9e, 0xb6, 0xe3, 0xff, 0x9c, 0xb6, 0xe3, 0xff, 0x96, 0xb1, 0xe0, 0xff, 0x90, 0xae, 0xe0, 0xff, 0x8b, 0xaa, 0xdd, 0xff, 0x81, 0xa4, 0xdc, 0xff, 0x79, 0xa1, 0xdc, 0xff, 0x77, 0x9e, 0xd7, 0xff, 0x71, 0x98, 0xd1, 0xff, 0x6f, 0x96, 0xd0, 0xff, 0x6d, 0x93, 0xcb, 0xff, 0x6f, 0x94, 0xc7, 0xff, 0x7d, 0x9c, 0xc9, 0xff, 0x87, 0xa0, 0xc6, 0xff, 0x82, 0x95, 0xb8, 0xff, 0x6f, 0x87, 0xa0, 0xff, 0x5f, 0x6f, 0x80, 0xff, 0x3b, 0x47, 0x55, 0xff, 0x38, 0x52, 0x56, 0xff, 0xd3, 0xdb, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0xa9, 0xb5, 0xff, 0x1e, 0x36, 0x46, 0xff, 0x55, 0x66, 0x70, 0xff, 0x7d, 0x92, 0xa0, 0xff, 0x87, 0xa2, 0xb7, 0xff, 0x88, 0xa5, 0xc1, 0xff, 0x88, 0xa3, 0xc4, 0xff, 0x82, 0xa2, 0xc5, 0xff, 0x7c, 0xa0, 0xc7, 0xff, 0x7c, 0xa2, 0xcc, 0xff, 0x7c, 0xa2, 0xd2, 0xff, 0x7b, 0xa1, 0xd4, 0xff, 0x78, 0x9e, 0xd0, 0xff, 0x7b, 0xa1, 0xd3, 0xff, 0x80, 0xa7, 0xd9, 0xff, 0x88, 0xab, 0xd9, 0xff, 0x90, 0xae, 0xd9, 0xff, 0x95, 0xb2, 0xde, 0xff, 0x9a, 0xb5, 0xe0, 0xff, 0x9e, 0xb5, 0xe1, 0xff, 0x9a, 0xb2, 0xdf, 0xff, 0x9a, 0xb2, 0xe0, 0xff, 0x98, 0xb0, 0xde, 0xff, 0x99, 0xb1, 0xdf, 0xff, 0x99, 0xb1, 0xde, 0xff, 0x97, 0xb0, 0xdf, 0xff, 0x98, 0xb3, 0xe2, 0xff, 0x98, 0xb1, 0xe1, 0xff, 0x98, 0xb2, 0xe1, 0xff, 0x98, 0xb1, 0xe1, 0xff, 0x99, 0xb2, 0xe1, 0xff, 0x9b, 0xb5, 0xe3, 0xff, 0x99, 0xb3, 0xe1, 0xff, 0x98, 0xb3, 0xe1, 0xff, 0x96, 0xb2, 0xdf, 0xff, 0x8f, 0xb0, 0xe2, 0xff, 0x8a, 0xaf, 0xe5, 0xff, 0x87, 0xaa, 0xe0, 0xff, 0x84, 0xa8, 0xdd, 0xff, 0x7d, 0xa1, 0xd7, 0xff, 0x77, 0x99, 0xce, 0xff, 0x76, 0x96, 0xca, 0xff, 0x7c, 0x98, 0xc8, 0xff, 0x8a, 0xa2, 0xce, 0xff, 0x90, 0xa6, 0xd0, 0xff, 0x89, 0xa2, 0xbd, 0xff, 0x60, 0x6f, 0x7f, 0xff, 0x31, 0x3d, 0x4b, 0xff, 0x34, 0x4f, 0x52, 0xff, 0xd8, 0xe1, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0xb2, 0xbd, 0xff, 0x20, 0x37, 0x48, 0xff, 0x4a, 0x5b, 0x66, 0xff, 0x86, 0x9b, 0xaa, 0xff, 0x95, 0xb0, 0xc5, 0xff, 0x8b, 0xa7, 0xc3, 0xff, 0x89, 0xa4, 0xc5, 0xff, 0x82, 0xa1, 0xc4, 0xff, 0x7d, 0xa1, 0xc9, 0xff, 0x83, 0xaa, 0xd3, 0xff, 0x8e, 0xb0, 0xe2, 0xff, 0x8c, 0xab, 0xe1, 0xff, 0x86, 0xa7, 0xdb, 0xff, 0x8b, 0xab, 0xe0, 0xff, 0x8f, 0xb0, 0xe7, 0xff, 0x92, 0xb1, 0xde, 0xff, 0x95, 0xb4, 0xdb, 0xff, 0x9b, 0xb7, 0xe1, 0xff, 0xa1, 0xba, 0xe4, 0xff, 0xa0, 0xb7, 0xe1, 0xff, 0x9e, 0xb5, 0xe2, 0xff, 0x99, 0xb0, 0xe0, 0xff, 0x97, 0xaf, 0xdd, 0xff, 0x95, 0xad, 0xdb, 0xff, 0x95, 0xad, 0xd9, 0xff, 0x94, 0xae, 0xdf, 0xff, 0x94, 0xb0, 0xe3, 0xff, 0x93, 0xae, 0xe1, 0xff, 0x91, 0xac, 0xdf, 0xff, 0x90, 0xab, 0xde, 0xff, 0x91, 0xae, 0xdd, 0xff, 0x9b, 0xb8, 0xe5, 0xff, 0xa3, 0xbc, 0xea, 0xff, 0xa1, 0xbb, 0xe6, 0xff, 0xa6, 0xbd, 0xe7, 0xff, 0xa3, 0xbf, 0xec, 0xff, 0x9a, 0xba, 0xe9, 0xff, 0x8e, 0xac, 0xda, 0xff, 0x82, 0xa0, 0xce, 0xff, 0x88, 0xa6, 0xd3, 0xff, 0x8a, 0xa8, 0xd9, 0xff, 0x84, 0xa2, 0xd7, 0xff, 0x83, 0xa0, 0xd0, 0xff, 0x88, 0xa1, 0xcf, 0xff, 0x93, 0xab, 0xda, 0xff, 0x8f, 0xa9, 0xc6, 0xff, 0x66, 0x75, 0x83, 0xff, 0x38, 0x44, 0x52, 0xff, 0x3e, 0x59, 0x5c, 0xff, 0xe3, 0xea, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xc0, 0xc0, 0xff, 0x29, 0x3d, 0x42, 0xff, 0x30, 0x48, 0x50, 0xff, 0x7e, 0x97, 0xaa, 0xff, 0x9b, 0xb2, 0xcf, 0xff, 0x8c, 0xa5, 0xca, 0xff, 0x85, 0x9f, 0xc7, 0xff, 0x87, 0xa4, 0xcc, 0xff, 0x8c, 0xaa, 0xd6, 0xff, 0x89, 0xa9, 0xd5, 0xff, 0x74, 0x98, 0xc8, 0xff, 0x6c, 0x91, 0xc1, 0xff, 0x76, 0x9a, 0xc7, 0xff, 0x81, 0xa3, 0xcf, 0xff, 0x84, 0xa6, 0xd1, 0xff, 0x96, 0xae, 0xda, 0xff, 0x9e, 0xb3, 0xdf, 0xff, 0x9f, 0xb6, 0xe2, 0xff, 0xa1, 0xba, 0xe6, 0xff, 0x9b, 0xb6, 0xe1, 0xff, 0x94, 0xb1, 0xda, 0xff, 0x91, 0xaf, 0xd7, 0xff, 0x93, 0xaf, 0xd9, 0xff, 0x97, 0xaf, 0xdc, 0xff, 0x9a, 0xb0, 0xe0, 0xff, 0x9b, 0xb2, 0xe1, 0xff, 0x99, 0xb3, 0xdf, 0xff, 0x94, 0xae, 0xdc, 0xff, 0x8e, 0xab, 0xd8, 0xff, 0x8d, 0xac, 0xd8, 0xff, 0x8f, 0xb0, 0xde, 0xff, 0x95, 0xb3, 0xe1, 0xff, 0x95, 0xae, 0xd8, 0xff, 0x95, 0xaa, 0xcc, 0xff, 0x90, 0xa1, 0xbd, 0xff, 0x7d, 0x8d, 0xb3, 0xff, 0x6b, 0x7c, 0xa9, 0xff, 0x63, 0x75, 0x9e, 0xff, 0x54, 0x6a, 0x93, 0xff, 0x56, 0x6d, 0x92, 0xff, 0x5d, 0x7a, 0x9f, 0xff, 0x5d, 0x7e, 0xa5, 0xff, 0x7f, 0x9b, 0xc4, 0xff, 0x8f, 0xa7, 0xd2, 0xff, 0x97, 0xac, 0xdc, 0xff, 0x91, 0xab, 0xce, 0xff, 0x57, 0x6f, 0x81, 0xff, 0x37, 0x43, 0x50, 0xff, 0x60, 0x67, 0x6b, 0xff, 0xf5, 0xf8, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xe2, 0xe3, 0xff, 0x3a, 0x4e, 0x55, 0xff, 0x2e, 0x47, 0x4e, 0xff, 0x75, 0x8e, 0xa1, 0xff, 0x98, 0xb0, 0xcf, 0xff, 0x8d, 0xa7, 0xca, 0xff, 0x89, 0xa4, 0xc8, 0xff, 0x81, 0x9e, 0xc3, 0xff, 0x61, 0x80, 0xa6, 0xff, 0x4b, 0x6c, 0x96, 0xff, 0x40, 0x5c, 0x7d, 0xff, 0x48, 0x5f, 0x79, 0xff, 0x4d, 0x63, 0x7e, 0xff, 0x48, 0x5d, 0x76, 0xff, 0x5c, 0x6d, 0x82, 0xff, 0x6e, 0x83, 0xa3, 0xff, 0x6a, 0x82, 0xab, 0xff, 0x74, 0x8e, 0xb4, 0xff, 0x87, 0xa3, 0xc8, 0xff, 0x92, 0xb2, 0xd6, 0xff, 0x92, 0xb4, 0xd9, 0xff, 0x90, 0xb1, 0xd8, 0xff, 0x91, 0xaf, 0xd8, 0xff, 0x95, 0xae, 0xdb, 0xff, 0x9a, 0xb0, 0xe1, 0xff, 0x9c, 0xb2, 0xe0, 0xff, 0x9a, 0xb2, 0xdd, 0xff, 0x94, 0xaf, 0xda, 0xff, 0x90, 0xad, 0xd8, 0xff, 0x8d, 0xae, 0xd8, 0xff, 0x8b, 0xa9, 0xd3, 0xff, 0x7f, 0x97, 0xc1, 0xff, 0x66, 0x7f, 0xa6, 0xff, 0x55, 0x6e, 0x90, 0xff, 0x40, 0x57, 0x79, 0xff, 0x35, 0x4b, 0x6b, 0xff, 0x3f, 0x56, 0x74, 0xff, 0x55, 0x6f, 0x8c, 0xff, 0x63, 0x80, 0x9d, 0xff, 0x5f, 0x7e, 0x98, 0xff, 0x5d, 0x7d, 0x9e, 0xff, 0x4e, 0x6d, 0x95, 0xff, 0x60, 0x7a, 0xa2, 0xff, 0x8b, 0xa4, 0xcd, 0xff, 0x9e, 0xb4, 0xe1, 0xff, 0x92, 0xab, 0xcb, 0xff, 0x53, 0x6c, 0x7d, 0xff, 0x39, 0x48, 0x58, 0xff, 0x57, 0x61, 0x72, 0xff, 0xa8, 0xba, 0xd0, 0xff, 0xe0, 0xed, 0xf7, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfc, 0xfd, 0xff, 0xb7, 0xc8, 0xda, 0xff, 0x4c, 0x63, 0x76, 0xff, 0x31, 0x47, 0x50, 0xff, 0x6d, 0x85, 0x94, 0xff, 0x98, 0xb2, 0xd1, 0xff, 0x8f, 0xac, 0xcc, 0xff, 0x87, 0xa4, 0xc0, 0xff, 0x6a, 0x8a, 0xa9, 0xff, 0x56, 0x78, 0x99, 0xff, 0x5d, 0x80, 0xa4, 0xff, 0x68, 0x83, 0xa5, 0xff, 0x68, 0x7d, 0x9d, 0xff, 0x65, 0x7b, 0x99, 0xff, 0x56, 0x69, 0x85, 0xff, 0x4b, 0x5d, 0x76, 0xff, 0x3e, 0x56, 0x75, 0xff, 0x3d, 0x5a, 0x7c, 0xff, 0x4c, 0x6a, 0x8a, 0xff, 0x60, 0x81, 0xa0, 0xff, 0x76, 0x98, 0xb7, 0xff, 0x85, 0xa9, 0xcd, 0xff, 0x89, 0xac, 0xd4, 0xff, 0x89, 0xa9, 0xd3, 0xff, 0x8f, 0xab, 0xd7, 0xff, 0x93, 0xac, 0xdc, 0xff, 0x97, 0xae, 0xdc, 0xff, 0x95, 0xad, 0xd9, 0xff, 0x8e, 0xa9, 0xd5, 0xff, 0x8a, 0xa7, 0xd3, 0xff, 0x7f, 0xa0, 0xcc, 0xff, 0x74, 0x8e, 0xb4, 0xff, 0x6a, 0x80, 0xa2, 0xff, 0x4f, 0x68, 0x8f, 0xff, 0x3f, 0x5b, 0x85, 0xff, 0x49, 0x66, 0x95, 0xff, 0x68, 0x83, 0xad, 0xff, 0x87, 0xa1, 0xc7, 0xff, 0x8f, 0xab, 0xd4, 0xff, 0x8d, 0xaa, 0xd5, 0xff, 0x85, 0xa5, 0xd2, 0xff, 0x81, 0xa0, 0xcd, 0xff, 0x82, 0x9e, 0xca, 0xff, 0x77, 0x91, 0xbb, 0xff, 0x85, 0x9f, 0xc6, 0xff, 0xa1, 0xb9, 0xe1, 0xff, 0x94, 0xaa, 0xc7, 0xff, 0x4c, 0x62, 0x72, 0xff, 0x36, 0x4c, 0x5e, 0xff, 0x50, 0x6a, 0x89, 0xff, 0x6c, 0x91, 0xce, 0xff, 0xa5, 0xbc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xde, 0xe9, 0xff, 0x67, 0x7f, 0xa6, 0xff, 0x55, 0x6d, 0x8d, 0xff, 0x39, 0x48, 0x54, 0xff, 0x65, 0x7a, 0x87, 0xff, 0x96, 0xb2, 0xd1, 0xff, 0x91, 0xae, 0xd0, 0xff, 0x87, 0xa3, 0xc2, 0xff, 0x7d, 0x9b, 0xbd, 0xff, 0x86, 0xa6, 0xc9, 0xff, 0x85, 0xa7, 0xcb, 0xff, 0x7f, 0xa2, 0xd1, 0xff, 0x82, 0xa5, 0xd9, 0xff, 0x89, 0xaa, 0xda, 0xff, 0x81, 0xa1, 0xcf, 0xff, 0x76, 0x94, 0xc3, 0xff, 0x65, 0x83, 0xaa, 0xff, 0x55, 0x73, 0x94, 0xff, 0x46, 0x66, 0x88, 0xff, 0x40, 0x63, 0x84, 0xff, 0x46, 0x6c, 0x8c, 0xff, 0x5c, 0x82, 0xa6, 0xff, 0x70, 0x96, 0xbc, 0xff, 0x7b, 0x9d, 0xc6, 0xff, 0x86, 0xa4, 0xd1, 0xff, 0x8e, 0xaa, 0xd8, 0xff, 0x94, 0xad, 0xdb, 0xff, 0x93, 0xab, 0xd6, 0xff, 0x88, 0xa3, 0xcf, 0xff, 0x77, 0x94, 0xc0, 0xff, 0x66, 0x86, 0xb1, 0xff, 0x59, 0x76, 0xa0, 0xff, 0x4e, 0x67, 0x91, 0xff, 0x58, 0x72, 0x9e, 0xff, 0x69, 0x85, 0xaf, 0xff, 0x6f, 0x8e, 0xb8, 0xff, 0x7a, 0x92, 0xc2, 0xff, 0x78, 0x8c, 0xc0, 0xff, 0x66, 0x7b, 0xb3, 0xff, 0x5f, 0x75, 0xb1, 0xff, 0x70, 0x85, 0xc8, 0xff, 0x7e, 0x99, 0xd0, 0xff, 0x81, 0x9e, 0xc9, 0xff, 0x83, 0x9c, 0xc7, 0xff, 0x8b, 0xa4, 0xca, 0xff, 0x9e, 0xb7, 0xda, 0xff, 0x9a, 0xb1, 0xd0, 0xff, 0x4e, 0x63, 0x79, 0xff, 0x30, 0x4b, 0x5c, 0xff, 0x63, 0x82, 0xa4, 0xff, 0x39, 0x61, 0xb1, 0xff, 0x7c, 0x91, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x07, 0xfe, 0xfe, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xdf, 0xec, 0xff, 0x69, 0x87, 0xba, 0xff, 0x63, 0x7b, 0xa3, 0xff, 0x49, 0x58, 0x62, 0xff, 0x64, 0x76, 0x81, 0xff, 0x91, 0xb0, 0xcd, 0xff, 0x91, 0xae, 0xd6, 0xff, 0x8b, 0xa4, 0xcc, 0xff, 0x80, 0x9b, 0xc4, 0xff, 0x7e, 0x9b, 0xc6, 0xff, 0x7b, 0x9a, 0xc7, 0xff, 0x66, 0x86, 0xb5, 0xff, 0x4f, 0x6e, 0x9c, 0xff, 0x55, 0x72, 0xa1, 0xff, 0x5f, 0x7b, 0xa8, 0xff, 0x66, 0x7f, 0xab, 0xff, 0x61, 0x7d, 0xa9, 0xff, 0x5a, 0x7a, 0xa6, 0xff, 0x59, 0x7a, 0xa5, 0xff, 0x4c, 0x70, 0x99, 0xff, 0x36, 0x5a, 0x83, 0xff, 0x38, 0x5f, 0x85, 0xff, 0x50, 0x77, 0x9d, 0xff, 0x68, 0x8b, 0xb4, 0xff, 0x7e, 0x9f, 0xcb, 0xff, 0x88, 0xa6, 0xd5, 0xff, 0x90, 0xaa, 0xd8, 0xff, 0x95, 0xad, 0xd9, 0xff, 0x85, 0x9f, 0xcb, 0xff, 0x66, 0x83, 0xaf, 0xff, 0x4f, 0x6e, 0x98, 0xff, 0x40, 0x63, 0x95, 0xff, 0x4a, 0x6f, 0xa6, 0xff, 0x51, 0x71, 0xa1, 0xff, 0x42, 0x5f, 0x88, 0xff, 0x42, 0x5b, 0x83, 0xff, 0x43, 0x59, 0x7b, 0xff, 0x41, 0x56, 0x75, 0xff, 0x3d, 0x52, 0x78, 0xff, 0x48, 0x5d, 0x8a, 0xff, 0x49, 0x5d, 0x8e, 0xff, 0x4c, 0x65, 0x98, 0xff, 0x64, 0x80, 0xb1, 0xff, 0x77, 0x90, 0xbb, 0xff, 0x88, 0xa2, 0xc6, 0xff, 0x9c, 0xb5, 0xd6, 0xff, 0x9c, 0xb5, 0xd5, 0xff, 0x5f, 0x77, 0x8f, 0xff, 0x4d, 0x68, 0x75, 0xff, 0x77, 0x93, 0xb0, 0xff, 0x3b, 0x5c, 0xad, 0xff, 0x8c, 0x9d, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xef, 0xfe, 0xfe, 0xfe, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x46, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xfa, 0xf8, 0xff, 0x63, 0x7c, 0xc0, 0xff, 0x57, 0x7b, 0xb7, 0xff, 0x60, 0x79, 0x82, 0xff, 0x70, 0x84, 0x9a, 0xff, 0x95, 0xb0, 0xd3, 0xff, 0x98, 0xb4, 0xd6, 0xff, 0x87, 0xa1, 0xc7, 0xff, 0x69, 0x8a, 0xb6, 0xff, 0x5f, 0x80, 0xae, 0xff, 0x45, 0x65, 0x8f, 0xff, 0x3d, 0x5e, 0x88, 0xff, 0x44, 0x61, 0x89, 0xff, 0x2d, 0x3f, 0x5e, 0xff, 0x1c, 0x29, 0x3d, 0xff, 0x2e, 0x3e, 0x46, 0xff, 0x56, 0x56, 0x64, 0xff, 0x30, 0x34, 0x4d, 0xff, 0x1a, 0x3b, 0x57, 0xff, 0x37, 0x5d, 0x82, 0xff, 0x4d, 0x61, 0x93, 0xff, 0x39, 0x52, 0x7f, 0xff, 0x3a, 0x62, 0x87, 0xff, 0x5b, 0x83, 0xa9, 0xff, 0x7a, 0x9f, 0xc7, 0xff, 0x8f, 0xad, 0xd7, 0xff, 0x9e, 0xb2, 0xdb, 0xff, 0x9b, 0xaf, 0xd9, 0xff, 0x85, 0xa1, 0xd2, 0xff, 0x5f, 0x7f, 0xb1, 0xff, 0x43, 0x61, 0x8d, 0xff, 0x40, 0x64, 0x99, 0xff, 0x3c, 0x62, 0x99, 0xff, 0x20, 0x3c, 0x64, 0xff, 0x0c, 0x1d, 0x37, 0xff, 0x23, 0x2d, 0x3c, 0xff, 0x55, 0x57, 0x5b, 0xff, 0x20, 0x1e, 0x1f, 0xff, 0x35, 0x36, 0x41, 0xff, 0x42, 0x4c, 0x62, 0xff, 0x3f, 0x55, 0x6c, 0xff, 0x3a, 0x55, 0x7f, 0xff, 0x44, 0x60, 0x96, 0xff, 0x61, 0x80, 0xb3, 0xff, 0x7f, 0x9d, 0xca, 0xff, 0x99, 0xb2, 0xd7, 0xff, 0xa3, 0xb9, 0xd4, 0xff, 0x7d, 0x92, 0xa7, 0xff, 0x6b, 0x7f, 0x97, 0xff, 0x89, 0x9e, 0xc7, 0xff, 0x6a, 0x86, 0xd5, 0xff, 0xb1, 0xbd, 0xe3, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0xa5, 0xd8, 0xff, 0x4d, 0x76, 0xab, 0xff, 0x74, 0x93, 0x9e, 0xff, 0x83, 0x9a, 0xb3, 0xff, 0x96, 0xad, 0xd2, 0xff, 0x99, 0xb3, 0xd3, 0xff, 0x87, 0xa5, 0xc7, 0xff, 0x61, 0x84, 0xb0, 0xff, 0x49, 0x6d, 0x9b, 0xff, 0x35, 0x58, 0x81, 0xff, 0x3a, 0x51, 0x72, 0xff, 0x3d, 0x47, 0x5f, 0xff, 0x4b, 0x4c, 0x56, 0xff, 0x39, 0x35, 0x2e, 0xff, 0x1b, 0x1b, 0x05, 0xff, 0x44, 0x3d, 0x34, 0xff, 0x30, 0x2c, 0x30, 0xff, 0x2f, 0x38, 0x47, 0xff, 0x25, 0x3b, 0x5b, 0xff, 0x32, 0x53, 0x7f, 0xff, 0x30, 0x51, 0x7e, 0xff, 0x2a, 0x4e, 0x76, 0xff, 0x4d, 0x76, 0x9e, 0xff, 0x7a, 0xa0, 0xc8, 0xff, 0x9a, 0xb6, 0xe1, 0xff, 0xb0, 0xc1, 0xe8, 0xff, 0xaa, 0xbd, 0xe5, 0xff, 0x87, 0xa4, 0xd7, 0xff, 0x54, 0x75, 0xaa, 0xff, 0x32, 0x55, 0x83, 0xff, 0x40, 0x59, 0x88, 0xff, 0x35, 0x45, 0x6f, 0xff, 0x50, 0x5b, 0x74, 0xff, 0x57, 0x5a, 0x5f, 0xff, 0x1c, 0x17, 0x0b, 0xff, 0x0f, 0x0b, 0x02, 0xff, 0x28, 0x26, 0x27, 0xff, 0x7b, 0x79, 0x85, 0xff, 0x58, 0x5f, 0x78, 0xff, 0x11, 0x25, 0x46, 0xff, 0x44, 0x5d, 0x8b, 0xff, 0x62, 0x7e, 0xb2, 0xff, 0x70, 0x90, 0xc6, 0xff, 0x86, 0xa4, 0xd6, 0xff, 0x9a, 0xb2, 0xd9, 0xff, 0xa8, 0xbe, 0xd9, 0xff, 0x87, 0x9f, 0xba, 0xff, 0x64, 0x7b, 0xa3, 0xff, 0x82, 0x99, 0xd0, 0xff, 0x75, 0x93, 0xe1, 0xff, 0xbe, 0xc9, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xdd, 0xec, 0xff, 0x68, 0x8b, 0xb1, 0xff, 0x6e, 0x8e, 0xac, 0xff, 0x82, 0xa2, 0xb4, 0xff, 0x9c, 0xaf, 0xd1, 0xff, 0x9c, 0xb0, 0xd6, 0xff, 0x91, 0xaf, 0xd2, 0xff, 0x75, 0x97, 0xc3, 0xff, 0x67, 0x8b, 0xb8, 0xff, 0x58, 0x7b, 0xa5, 0xff, 0x21, 0x34, 0x58, 0xff, 0x32, 0x38, 0x55, 0xff, 0x9a, 0x9c, 0xaa, 0xff, 0x85, 0x82, 0x81, 0xff, 0x2e, 0x32, 0x22, 0xff, 0x01, 0x0b, 0x03, 0xff, 0x4f, 0x55, 0x56, 0xff, 0xb3, 0xa8, 0xb9, 0xff, 0x61, 0x68, 0x89, 0xff, 0x1e, 0x50, 0x76, 0xff, 0x52, 0x7e, 0xaa, 0xff, 0x43, 0x61, 0x8f, 0xff, 0x46, 0x6e, 0x99, 0xff, 0x7f, 0xa3, 0xcf, 0xff, 0xa3, 0xbe, 0xed, 0xff, 0xb8, 0xca, 0xf2, 0xff, 0xb1, 0xc5, 0xed, 0xff, 0x84, 0xa2, 0xd4, 0xff, 0x55, 0x75, 0xa8, 0xff, 0x59, 0x7c, 0xa9, 0xff, 0x6d, 0x83, 0xb5, 0xff, 0x57, 0x63, 0x96, 0xff, 0x8a, 0x98, 0xba, 0xff, 0x99, 0xa3, 0xb3, 0xff, 0x60, 0x65, 0x66, 0xff, 0x42, 0x52, 0x53, 0xff, 0x62, 0x76, 0x82, 0xff, 0x88, 0x93, 0xac, 0xff, 0x7d, 0x8a, 0xb1, 0xff, 0x6f, 0x84, 0xb6, 0xff, 0x78, 0x91, 0xc4, 0xff, 0x86, 0xa2, 0xd4, 0xff, 0x8d, 0xac, 0xe0, 0xff, 0x90, 0xae, 0xde, 0xff, 0x9b, 0xb2, 0xd8, 0xff, 0xaa, 0xc2, 0xe0, 0xff, 0x82, 0x9f, 0xc4, 0xff, 0x48, 0x67, 0x9d, 0xff, 0x6f, 0x8d, 0xcc, 0xff, 0x7b, 0x9c, 0xe3, 0xff, 0xc8, 0xd5, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xf9, 0xf9, 0xff, 0x79, 0x8f, 0xc1, 0xff, 0x49, 0x67, 0xa2, 0xff, 0x72, 0x9a, 0xaa, 0xff, 0xaa, 0xb9, 0xd5, 0xff, 0xa0, 0xb1, 0xd6, 0xff, 0x97, 0xb7, 0xd9, 0xff, 0x8c, 0xae, 0xd9, 0xff, 0x7f, 0xa3, 0xd0, 0xff, 0x81, 0xa2, 0xc9, 0xff, 0x7e, 0x9e, 0xcc, 0xff, 0x6c, 0x88, 0xb9, 0xff, 0x76, 0x88, 0xb0, 0xff, 0x73, 0x85, 0xa5, 0xff, 0x65, 0x7c, 0x93, 0xff, 0x68, 0x82, 0x91, 0xff, 0x81, 0x8f, 0xa4, 0xff, 0xa9, 0xae, 0xce, 0xff, 0x92, 0xa1, 0xc7, 0xff, 0x6c, 0x91, 0xbb, 0xff, 0x8f, 0xb3, 0xe0, 0xff, 0x71, 0x92, 0xc0, 0xff, 0x52, 0x78, 0xa5, 0xff, 0x82, 0xa5, 0xd3, 0xff, 0xa0, 0xbb, 0xeb, 0xff, 0xb6, 0xc8, 0xf1, 0xff, 0xb0, 0xc4, 0xec, 0xff, 0x83, 0xa0, 0xd2, 0xff, 0x63, 0x83, 0xb6, 0xff, 0x88, 0xa9, 0xd4, 0xff, 0x91, 0xb0, 0xe7, 0xff, 0x81, 0x9f, 0xdd, 0xff, 0x7f, 0x9e, 0xd4, 0xff, 0x73, 0x91, 0xc0, 0xff, 0x71, 0x8c, 0xb9, 0xff, 0x79, 0x9a, 0xbc, 0xff, 0x81, 0xa0, 0xbe, 0xff, 0x80, 0x95, 0xbc, 0xff, 0x88, 0x9c, 0xca, 0xff, 0x8f, 0xab, 0xdc, 0xff, 0x8d, 0xa8, 0xdb, 0xff, 0x92, 0xac, 0xdf, 0xff, 0x93, 0xb2, 0xe6, 0xff, 0x92, 0xaf, 0xdf, 0xff, 0x99, 0xb1, 0xd8, 0xff, 0xa9, 0xbe, 0xd9, 0xff, 0x85, 0xa0, 0xc5, 0xff, 0x56, 0x75, 0xb5, 0xff, 0x6f, 0x8c, 0xd0, 0xff, 0x8b, 0xa7, 0xdc, 0xff, 0xe2, 0xed, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xfa, 0xf9, 0xff, 0x71, 0x79, 0xc1, 0xff, 0x32, 0x4e, 0xa2, 0xff, 0x65, 0x92, 0xa1, 0xff, 0xb0, 0xbd, 0xd0, 0xff, 0xa6, 0xb5, 0xda, 0xff, 0x97, 0xb8, 0xda, 0xff, 0x93, 0xb5, 0xe1, 0xff, 0x86, 0xab, 0xd8, 0xff, 0x82, 0xa2, 0xca, 0xff, 0x83, 0xa9, 0xcf, 0xff, 0x8b, 0xae, 0xd6, 0xff, 0x88, 0x9d, 0xc7, 0xff, 0x7c, 0x8f, 0xbc, 0xff, 0x78, 0x90, 0xbd, 0xff, 0x84, 0x94, 0xc7, 0xff, 0x86, 0x9b, 0xd1, 0xff, 0x72, 0x9b, 0xca, 0xff, 0x85, 0xa8, 0xd7, 0xff, 0xa6, 0xb2, 0xe2, 0xff, 0x99, 0xad, 0xde, 0xff, 0x7c, 0xa2, 0xd3, 0xff, 0x61, 0x87, 0xb7, 0xff, 0x80, 0xa4, 0xd4, 0xff, 0x9f, 0xb8, 0xec, 0xff, 0xb4, 0xc5, 0xf0, 0xff, 0xad, 0xc1, 0xe9, 0xff, 0x87, 0xa4, 0xd5, 0xff, 0x71, 0x92, 0xc4, 0xff, 0x84, 0xa5, 0xd3, 0xff, 0x8c, 0xab, 0xd5, 0xff, 0x84, 0xa2, 0xce, 0xff, 0x7b, 0x98, 0xca, 0xff, 0x6b, 0x87, 0xbf, 0xff, 0x64, 0x7c, 0xbb, 0xff, 0x62, 0x86, 0xc0, 0xff, 0x6b, 0x93, 0xc7, 0xff, 0x83, 0x9f, 0xd1, 0xff, 0x8e, 0xa9, 0xd8, 0xff, 0x8c, 0xaf, 0xd8, 0xff, 0x92, 0xb0, 0xde, 0xff, 0x97, 0xb0, 0xe4, 0xff, 0x91, 0xb0, 0xe4, 0xff, 0x91, 0xae, 0xde, 0xff, 0x99, 0xb1, 0xd9, 0xff, 0xab, 0xbe, 0xd3, 0xff, 0x8a, 0x9f, 0xbf, 0xff, 0x6f, 0x8b, 0xd0, 0xff, 0x81, 0x98, 0xdc, 0xff, 0xa0, 0xb6, 0xd9, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xf9, 0xf7, 0xff, 0x74, 0x85, 0xc4, 0xff, 0x3c, 0x5c, 0xae, 0xff, 0x60, 0x8b, 0xa3, 0xff, 0xaf, 0xbd, 0xcd, 0xff, 0xad, 0xba, 0xdd, 0xff, 0x96, 0xb4, 0xdc, 0xff, 0x92, 0xb1, 0xdf, 0xff, 0x91, 0xb3, 0xdf, 0xff, 0x90, 0xae, 0xd5, 0xff, 0x80, 0xa1, 0xc6, 0xff, 0x79, 0x9b, 0xc3, 0xff, 0x7b, 0x9a, 0xc6, 0xff, 0x78, 0x96, 0xc8, 0xff, 0x6f, 0x90, 0xc6, 0xff, 0x7b, 0x93, 0xcb, 0xff, 0x81, 0x97, 0xd0, 0xff, 0x77, 0x95, 0xca, 0xff, 0x77, 0x92, 0xc3, 0xff, 0x94, 0xa2, 0xd2, 0xff, 0x96, 0xab, 0xdd, 0xff, 0x7a, 0x9b, 0xce, 0xff, 0x6d, 0x91, 0xc1, 0xff, 0x87, 0xa6, 0xd8, 0xff, 0xa0, 0xb6, 0xeb, 0xff, 0xb5, 0xc5, 0xf1, 0xff, 0xa9, 0xbc, 0xe8, 0xff, 0x89, 0xa4, 0xdf, 0xff, 0x7d, 0x9a, 0xd7, 0xff, 0x82, 0xa3, 0xd6, 0xff, 0x96, 0xb1, 0xd4, 0xff, 0x9e, 0xb4, 0xd3, 0xff, 0x9d, 0xb3, 0xdb, 0xff, 0x9a, 0xab, 0xdc, 0xff, 0x94, 0xa2, 0xdc, 0xff, 0x89, 0xa0, 0xd4, 0xff, 0x81, 0xa0, 0xcf, 0xff, 0x89, 0xa4, 0xd5, 0xff, 0x90, 0xad, 0xdc, 0xff, 0x97, 0xb7, 0xe8, 0xff, 0x9c, 0xb8, 0xe7, 0xff, 0x99, 0xb5, 0xe2, 0xff, 0x90, 0xb1, 0xe2, 0xff, 0x8f, 0xad, 0xdc, 0xff, 0x9c, 0xb2, 0xd9, 0xff, 0xa0, 0xc2, 0xd8, 0xff, 0x84, 0x9f, 0xbf, 0xff, 0x81, 0x94, 0xde, 0xff, 0x6c, 0x92, 0xe1, 0xff, 0xba, 0xca, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xfc, 0xfc, 0xff, 0x87, 0x9a, 0xce, 0xff, 0x4b, 0x6c, 0xb7, 0xff, 0x5a, 0x80, 0xa8, 0xff, 0xaa, 0xb8, 0xce, 0xff, 0xae, 0xbd, 0xdc, 0xff, 0x92, 0xae, 0xd6, 0xff, 0x8f, 0xae, 0xdb, 0xff, 0x90, 0xb0, 0xdd, 0xff, 0x9e, 0xbc, 0xe2, 0xff, 0x9c, 0xb6, 0xe0, 0xff, 0x8d, 0xa8, 0xd7, 0xff, 0x84, 0xa0, 0xd1, 0xff, 0x7d, 0x9a, 0xcd, 0xff, 0x7c, 0x99, 0xcf, 0xff, 0x88, 0xa1, 0xd3, 0xff, 0x95, 0xaa, 0xda, 0xff, 0x9e, 0xb1, 0xe3, 0xff, 0x9a, 0xae, 0xde, 0xff, 0x9c, 0xb1, 0xe0, 0xff, 0x92, 0xaa, 0xdd, 0xff, 0x7f, 0x9f, 0xd2, 0xff, 0x7b, 0x9e, 0xcf, 0xff, 0x8a, 0xa6, 0xda, 0xff, 0xa1, 0xb5, 0xeb, 0xff, 0xb5, 0xc4, 0xef, 0xff, 0xa6, 0xb8, 0xe6, 0xff, 0x8b, 0xa5, 0xe4, 0xff, 0x85, 0xa1, 0xe0, 0xff, 0x84, 0xa5, 0xd7, 0xff, 0x99, 0xb3, 0xde, 0xff, 0xaa, 0xbf, 0xea, 0xff, 0xad, 0xc2, 0xed, 0xff, 0xae, 0xbf, 0xeb, 0xff, 0xad, 0xbd, 0xea, 0xff, 0xad, 0xbc, 0xe7, 0xff, 0xab, 0xbd, 0xe8, 0xff, 0xa5, 0xba, 0xe7, 0xff, 0xa2, 0xb8, 0xe8, 0xff, 0xa2, 0xba, 0xee, 0xff, 0x9f, 0xb9, 0xe9, 0xff, 0x98, 0xb6, 0xe3, 0xff, 0x8f, 0xaf, 0xe1, 0xff, 0x8d, 0xac, 0xd8, 0xff, 0x9f, 0xb5, 0xd8, 0xff, 0x9c, 0xc3, 0xdb, 0xff, 0x81, 0xa0, 0xc6, 0xff, 0x77, 0x8a, 0xd3, 0xff, 0x6c, 0x92, 0xd9, 0xff, 0xdc, 0xe7, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa6, 0xb1, 0xd6, 0xff, 0x4f, 0x6f, 0xb5, 0xff, 0x5c, 0x7e, 0xb7, 0xff, 0xa0, 0xb2, 0xd0, 0xff, 0xad, 0xc0, 0xda, 0xff, 0x88, 0xa5, 0xc8, 0xff, 0x89, 0xaa, 0xd6, 0xff, 0x8f, 0xaf, 0xde, 0xff, 0x96, 0xb4, 0xdf, 0xff, 0xa0, 0xb6, 0xe3, 0xff, 0xa8, 0xba, 0xea, 0xff, 0xae, 0xbe, 0xee, 0xff, 0xaf, 0xbd, 0xed, 0xff, 0xac, 0xb9, 0xea, 0xff, 0xaa, 0xba, 0xe8, 0xff, 0xab, 0xbe, 0xea, 0xff, 0xab, 0xbf, 0xed, 0xff, 0xa4, 0xba, 0xea, 0xff, 0x9d, 0xb2, 0xe4, 0xff, 0x93, 0xac, 0xdf, 0xff, 0x89, 0xa9, 0xdb, 0xff, 0x7e, 0xa1, 0xd3, 0xff, 0x89, 0xa7, 0xda, 0xff, 0xa0, 0xb5, 0xeb, 0xff, 0xb8, 0xc8, 0xf1, 0xff, 0xab, 0xbf, 0xe8, 0xff, 0x8f, 0xaa, 0xe5, 0xff, 0x8b, 0xa8, 0xe4, 0xff, 0x8b, 0xad, 0xda, 0xff, 0x95, 0xaf, 0xe1, 0xff, 0xa3, 0xb8, 0xf1, 0xff, 0xaa, 0xbf, 0xf0, 0xff, 0xb2, 0xc5, 0xed, 0xff, 0xb6, 0xc9, 0xe9, 0xff, 0xba, 0xc8, 0xee, 0xff, 0xbc, 0xc8, 0xf4, 0xff, 0xb7, 0xc5, 0xf1, 0xff, 0xb2, 0xc1, 0xf1, 0xff, 0xac, 0xbc, 0xec, 0xff, 0xa2, 0xb8, 0xe9, 0xff, 0x98, 0xb4, 0xe7, 0xff, 0x8e, 0xae, 0xe1, 0xff, 0x8b, 0xab, 0xd6, 0xff, 0x9f, 0xb7, 0xd5, 0xff, 0xa3, 0xc2, 0xd9, 0xff, 0x82, 0xa2, 0xd0, 0xff, 0x78, 0x8f, 0xd5, 0xff, 0xa3, 0xba, 0xe1, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0x01,
+    0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xe4, 0xed, 0xff, 0x5d, 0x7e, 0xb3, 0xff, 0x5e, 0x7d, 0xc3, 0xff, 0x98, 0xb0, 0xcd, 0xff, 0xae, 0xc7, 0xd7, 0xff, 0x89, 0xa5, 0xc7, 0xff, 0x85, 0xa5, 0xd1, 0xff, 0x8b, 0xaa, 0xdc, 0xff, 0x91, 0xad, 0xde, 0xff, 0x9e, 0xb4, 0xe4, 0xff, 0xa5, 0xb9, 0xe8, 0xff, 0xae, 0xbe, 0xec, 0xff, 0xb5, 0xc2, 0xef, 0xff, 0xba, 0xc3, 0xee, 0xff, 0xb9, 0xc4, 0xec, 0xff, 0xba, 0xc8, 0xef, 0xff, 0xb7, 0xc7, 0xf2, 0xff, 0xa8, 0xbc, 0xec, 0xff, 0x9c, 0xb1, 0xe5, 0xff, 0x94, 0xad, 0xe1, 0xff, 0x8a, 0xa9, 0xdc, 0xff, 0x81, 0xa4, 0xd5, 0xff, 0x8e, 0xac, 0xdf, 0xff, 0xa2, 0xb7, 0xee, 0xff, 0xbc, 0xcd, 0xf4, 0xff, 0xb1, 0xc6, 0xeb, 0xff, 0x90, 0xac, 0xe3, 0xff, 0x8c, 0xab, 0xe4, 0xff, 0x95, 0xb7, 0xe1, 0xff, 0x94, 0xb2, 0xe4, 0xff, 0x9b, 0xb5, 0xec, 0xff, 0xa8, 0xbf, 0xee, 0xff, 0xb7, 0xc7, 0xef, 0xff, 0xbe, 0xcb, 0xec, 0xff, 0xbf, 0xcc, 0xf0, 0xff, 0xbd, 0xcb, 0xf4, 0xff, 0xbb, 0xc9, 0xf3, 0xff, 0xb8, 0xc8, 0xf5, 0xff, 0xb1, 0xc1, 0xee, 0xff, 0xa5, 0xb9, 0xec, 0xff, 0x96, 0xb1, 0xe9, 0xff, 0x8d, 0xac, 0xe0, 0xff, 0x8b, 0xab, 0xd5, 0xff, 0x9e, 0xba, 0xd3, 0xff, 0xac, 0xc7, 0xdb, 0xff, 0x84, 0xa6, 0xdf, 0xff, 0x81, 0x9f, 0xe0, 0xff, 0xde, 0xe7, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21,
+    0xff, 0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0xb3, 0xd8, 0xff, 0x5b, 0x7b, 0xc8, 0xff, 0x8f, 0xb0, 0xc3, 0xff, 0xb3, 0xd1, 0xd7, 0xff, 0x8b, 0xa7, 0xc8, 0xff, 0x81, 0xa1, 0xcc, 0xff, 0x87, 0xa6, 0xd9, 0xff, 0x91, 0xab, 0xdf, 0xff, 0x98, 0xb2, 0xe2, 0xff, 0x9e, 0xb8, 0xe6, 0xff, 0xaa, 0xbf, 0xec, 0xff, 0xb5, 0xc3, 0xec, 0xff, 0xbd, 0xc7, 0xed, 0xff, 0xc2, 0xc9, 0xed, 0xff, 0xc1, 0xca, 0xed, 0xff, 0xb6, 0xc5, 0xee, 0xff, 0xa7, 0xba, 0xe9, 0xff, 0x9f, 0xb4, 0xe8, 0xff, 0x96, 0xaf, 0xe3, 0xff, 0x8c, 0xab, 0xde, 0xff, 0x85, 0xa8, 0xda, 0xff, 0x91, 0xaf, 0xe2, 0xff, 0xa3, 0xb8, 0xf0, 0xff, 0xbd, 0xcf, 0xf5, 0xff, 0xb3, 0xc8, 0xed, 0xff, 0x93, 0xaf, 0xe6, 0xff, 0x8d, 0xac, 0xe3, 0xff, 0x95, 0xb7, 0xde, 0xff, 0x95, 0xb9, 0xe2, 0xff, 0x99, 0xb9, 0xe8, 0xff, 0xa7, 0xbd, 0xea, 0xff, 0xb3, 0xc2, 0xec, 0xff, 0xc0, 0xc5, 0xef, 0xff, 0xbb, 0xc8, 0xee, 0xff, 0xb4, 0xca, 0xed, 0xff, 0xb3, 0xc7, 0xed, 0xff, 0xaf, 0xc4, 0xed, 0xff, 0xaa, 0xc2, 0xea, 0xff, 0xa0, 0xb7, 0xea, 0xff, 0x95, 0xad, 0xe9, 0xff, 0x8e, 0xac, 0xe2, 0xff, 0x8d, 0xad, 0xd6, 0xff, 0x9e, 0xbb, 0xd2, 0xff, 0xb2, 0xcb, 0xdd, 0xff, 0x7f, 0xa3, 0xe4, 0xff, 0x9a, 0xba, 0xf7, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xfa, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4b,
+    0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xe8, 0xfa, 0xff, 0x6a, 0x85, 0xb8, 0xff, 0x6e, 0x93, 0xc4, 0xff, 0xaf, 0xce, 0xe0, 0xff, 0x94, 0xac, 0xc7, 0xff, 0x7f, 0x9d, 0xca, 0xff, 0x87, 0xa9, 0xd0, 0xff, 0x94, 0xac, 0xde, 0xff, 0x99, 0xae, 0xe4, 0xff, 0x9d, 0xb5, 0xe5, 0xff, 0xa7, 0xbc, 0xea, 0xff, 0xaf, 0xc0, 0xea, 0xff, 0xb1, 0xc1, 0xe8, 0xff, 0xb5, 0xc5, 0xe8, 0xff, 0xb5, 0xc5, 0xea, 0xff, 0xac, 0xc0, 0xe9, 0xff, 0xa2, 0xb9, 0xe6, 0xff, 0x99, 0xb3, 0xe3, 0xff, 0x94, 0xaf, 0xdf, 0xff, 0x8f, 0xac, 0xdc, 0xff, 0x8c, 0xaf, 0xde, 0xff, 0x96, 0xb3, 0xe3, 0xff, 0xa7, 0xbb, 0xec, 0xff, 0xba, 0xc8, 0xf9, 0xff, 0xb0, 0xc4, 0xf6, 0xff, 0x98, 0xb7, 0xe9, 0xff, 0x8d, 0xaf, 0xe0, 0xff, 0x88, 0xab, 0xdb, 0xff, 0x94, 0xad, 0xda, 0xff, 0x9d, 0xb3, 0xe1, 0xff, 0x9b, 0xb9, 0xe6, 0xff, 0xa2, 0xbc, 0xe9, 0xff, 0xb7, 0xc3, 0xf3, 0xff, 0xb8, 0xc3, 0xf1, 0xff, 0xad, 0xbf, 0xec, 0xff, 0xab, 0xbf, 0xed, 0xff, 0xa5, 0xbb, 0xec, 0xff, 0x9d, 0xb6, 0xe8, 0xff, 0x95, 0xb0, 0xe6, 0xff, 0x90, 0xac, 0xe5, 0xff, 0x8e, 0xae, 0xe2, 0xff, 0x8f, 0xaf, 0xd5, 0xff, 0xa9, 0xc2, 0xd5, 0xff, 0xac, 0xc8, 0xdf, 0xff, 0x63, 0x7c, 0xb1, 0xff, 0xa5, 0xb4, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfa, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6b,
+    0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0xb1, 0xc9, 0xff, 0x53, 0x6e, 0xa3, 0xff, 0xa4, 0xc1, 0xd4, 0xff, 0x9d, 0xb4, 0xcc, 0xff, 0x7d, 0x9a, 0xc7, 0xff, 0x86, 0xaa, 0xca, 0xff, 0x8d, 0xaa, 0xd9, 0xff, 0x95, 0xaa, 0xe2, 0xff, 0x9a, 0xaf, 0xe1, 0xff, 0x9f, 0xb4, 0xe3, 0xff, 0xa4, 0xb9, 0xe6, 0xff, 0xa9, 0xbc, 0xe5, 0xff, 0xa9, 0xbe, 0xe9, 0xff, 0xa6, 0xbb, 0xe9, 0xff, 0x9e, 0xb5, 0xe4, 0xff, 0x8f, 0xa8, 0xda, 0xff, 0x81, 0x9c, 0xd0, 0xff, 0x8d, 0xa7, 0xd8, 0xff, 0x8d, 0xaa, 0xd7, 0xff, 0x8f, 0xb1, 0xde, 0xff, 0x9e, 0xbb, 0xe9, 0xff, 0xa6, 0xba, 0xeb, 0xff, 0xba, 0xc7, 0xf4, 0xff, 0xb8, 0xca, 0xf3, 0xff, 0xa1, 0xbf, 0xe8, 0xff, 0x90, 0xaf, 0xde, 0xff, 0x8d, 0xa8, 0xde, 0xff, 0x97, 0xab, 0xe0, 0xff, 0x8b, 0xa1, 0xd4, 0xff, 0x7e, 0xa0, 0xd2, 0xff, 0x87, 0xa8, 0xda, 0xff, 0xa2, 0xb7, 0xec, 0xff, 0xab, 0xbc, 0xef, 0xff, 0xa6, 0xb8, 0xe9, 0xff, 0xa1, 0xb6, 0xea, 0xff, 0x9d, 0xb4, 0xea, 0xff, 0x95, 0xae, 0xe6, 0xff, 0x8f, 0xa9, 0xe2, 0xff, 0x89, 0xa8, 0xe0, 0xff, 0x88, 0xa9, 0xdc, 0xff, 0x8c, 0xac, 0xd1, 0xff, 0xb8, 0xd1, 0xe3, 0xff, 0x8e, 0xaa, 0xc0, 0xff, 0x15, 0x2c, 0x4f, 0xff, 0x78, 0x82, 0x9b, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b,
+    0xff, 0xff, 0xff, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xfa, 0xfd, 0xff, 0xc3, 0xcb, 0xd9, 0xff, 0xb5, 0xc9, 0xd1, 0xff, 0x96, 0xae, 0xc9, 0xff, 0x7d, 0x9a, 0xc5, 0xff, 0x81, 0xa7, 0xc7, 0xff, 0x87, 0xa7, 0xd5, 0xff, 0x8c, 0xa8, 0xdc, 0xff, 0x8f, 0xac, 0xda, 0xff, 0x94, 0xae, 0xde, 0xff, 0x98, 0xaf, 0xdf, 0xff, 0x9b, 0xb1, 0xdf, 0xff, 0x9a, 0xb2, 0xe6, 0xff, 0x92, 0xab, 0xe4, 0xff, 0x85, 0x9e, 0xd6, 0xff, 0x80, 0x99, 0xd3, 0xff, 0x73, 0x8c, 0xc7, 0xff, 0x8b, 0xa4, 0xd7, 0xff, 0x93, 0xb0, 0xdd, 0xff, 0x8f, 0xb1, 0xdf, 0xff, 0x9d, 0xbb, 0xe9, 0xff, 0xa8, 0xbc, 0xef, 0xff, 0xbf, 0xcc, 0xed, 0xff, 0xc4, 0xd6, 0xed, 0xff, 0xae, 0xc9, 0xed, 0xff, 0x9b, 0xb5, 0xe4, 0xff, 0x99, 0xac, 0xe5, 0xff, 0x9c, 0xb1, 0xeb, 0xff, 0x82, 0x9d, 0xd6, 0xff, 0x7c, 0x9a, 0xd2, 0xff, 0x70, 0x8f, 0xc7, 0xff, 0x69, 0x8a, 0xc2, 0xff, 0x88, 0xa5, 0xd7, 0xff, 0x99, 0xb2, 0xe3, 0xff, 0x96, 0xb0, 0xe3, 0xff, 0x94, 0xae, 0xe4, 0xff, 0x8d, 0xa6, 0xde, 0xff, 0x89, 0xa4, 0xdd, 0xff, 0x87, 0xa5, 0xdd, 0xff, 0x83, 0xa4, 0xd7, 0xff, 0x89, 0xa9, 0xcf, 0xff, 0xba, 0xd4, 0xea, 0xff, 0x7d, 0x96, 0xa1, 0xff, 0x0d, 0x23, 0x3c, 0xff, 0x59, 0x6a, 0x86, 0xff, 0xd8, 0xe8, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab,
+    0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xe7, 0xe8, 0xff, 0x90, 0xa5, 0xc3, 0xff, 0x7d, 0x9a, 0xc2, 0xff, 0x7b, 0xa5, 0xc1, 0xff, 0x83, 0xa6, 0xd0, 0xff, 0x88, 0xa9, 0xda, 0xff, 0x87, 0xa9, 0xd6, 0xff, 0x87, 0xa6, 0xd7, 0xff, 0x8e, 0xa9, 0xdc, 0xff, 0x8e, 0xa6, 0xdb, 0xff, 0x7e, 0x9c, 0xd5, 0xff, 0x6e, 0x90, 0xca, 0xff, 0x77, 0x96, 0xcf, 0xff, 0x88, 0xa5, 0xdc, 0xff, 0x6f, 0x8b, 0xc2, 0xff, 0x90, 0xab, 0xdc, 0xff, 0xa2, 0xbe, 0xec, 0xff, 0x94, 0xb6, 0xe3, 0xff, 0x9f, 0xbc, 0xeb, 0xff, 0xa7, 0xbb, 0xed, 0xff, 0xb7, 0xc4, 0xea, 0xff, 0xbe, 0xd0, 0xee, 0xff, 0xb0, 0xcc, 0xf2, 0xff, 0x9d, 0xb9, 0xe8, 0xff, 0x9c, 0xb3, 0xea, 0xff, 0x9a, 0xb1, 0xe8, 0xff, 0x8c, 0xa2, 0xd9, 0xff, 0x97, 0xab, 0xe2, 0xff, 0x89, 0xa2, 0xd9, 0xff, 0x5a, 0x80, 0xb4, 0xff, 0x48, 0x6f, 0xa1, 0xff, 0x6f, 0x91, 0xc3, 0xff, 0x86, 0xa5, 0xdb, 0xff, 0x87, 0xa3, 0xdc, 0xff, 0x82, 0x9c, 0xd7, 0xff, 0x81, 0x9b, 0xd5, 0xff, 0x7f, 0x9d, 0xd4, 0xff, 0x7b, 0x9c, 0xcf, 0xff, 0x86, 0xa6, 0xcb, 0xff, 0xbb, 0xd6, 0xed, 0xff, 0x6b, 0x80, 0x87, 0xff, 0x0d, 0x1e, 0x33, 0xff, 0x4d, 0x60, 0x82, 0xff, 0xb3, 0xc7, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe,
+    0xff, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xf2, 0xf1, 0xff, 0x97, 0xac, 0xc9, 0xff, 0x7a, 0x97, 0xbc, 0xff, 0x77, 0xa2, 0xba, 0xff, 0x79, 0xa2, 0xc9, 0xff, 0x7b, 0xa1, 0xd0, 0xff, 0x7b, 0xa1, 0xcd, 0xff, 0x7d, 0xa0, 0xd1, 0xff, 0x80, 0x9d, 0xd4, 0xff, 0x78, 0x91, 0xcc, 0xff, 0x5b, 0x7e, 0xb7, 0xff, 0x59, 0x83, 0xb9, 0xff, 0x7a, 0x9e, 0xd3, 0xff, 0x87, 0xaa, 0xd9, 0xff, 0x6e, 0x8f, 0xbb, 0xff, 0x68, 0x83, 0xb1, 0xff, 0x8d, 0xa8, 0xd8, 0xff, 0x7f, 0xa1, 0xd0, 0xff, 0x90, 0xad, 0xdc, 0xff, 0x9f, 0xb1, 0xe2, 0xff, 0xa9, 0xb4, 0xe5, 0xff, 0xa6, 0xb9, 0xe9, 0xff, 0x9a, 0xba, 0xe9, 0xff, 0x7f, 0xa2, 0xd2, 0xff, 0x6f, 0x92, 0xc4, 0xff, 0x75, 0x8e, 0xbf, 0xff, 0x98, 0xa5, 0xd7, 0xff, 0xab, 0xb4, 0xe8, 0xff, 0x9e, 0xb0, 0xe1, 0xff, 0x86, 0xac, 0xd8, 0xff, 0x4c, 0x78, 0xa8, 0xff, 0x2c, 0x55, 0x8b, 0xff, 0x57, 0x7a, 0xb1, 0xff, 0x72, 0x90, 0xca, 0xff, 0x78, 0x91, 0xcf, 0xff, 0x75, 0x8e, 0xca, 0xff, 0x71, 0x8e, 0xc5, 0xff, 0x73, 0x94, 0xc7, 0xff, 0x82, 0xa2, 0xc8, 0xff, 0xb5, 0xd2, 0xe8, 0xff, 0x54, 0x64, 0x6b, 0xff, 0x05, 0x10, 0x2a, 0xff, 0x50, 0x65, 0x91, 0xff, 0x93, 0xa9, 0xb7, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3,
+    0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfd, 0xfa, 0xff, 0xa5, 0xb8, 0xcc, 0xff, 0x6b, 0x92, 0xbd, 0xff, 0x69, 0x97, 0xc2, 0xff, 0x75, 0x9d, 0xbd, 0xff, 0x72, 0x96, 0xbe, 0xff, 0x6d, 0x90, 0xc0, 0xff, 0x6e, 0x90, 0xc0, 0xff, 0x65, 0x86, 0xb7, 0xff, 0x50, 0x70, 0xa1, 0xff, 0x4d, 0x6f, 0xa0, 0xff, 0x6c, 0x90, 0xc0, 0xff, 0x83, 0xa4, 0xd2, 0xff, 0x8b, 0xaa, 0xd5, 0xff, 0x82, 0xa0, 0xc9, 0xff, 0x55, 0x6e, 0x9f, 0xff, 0x3d, 0x56, 0x8a, 0xff, 0x40, 0x5b, 0x8d, 0xff, 0x6b, 0x84, 0xb7, 0xff, 0x8f, 0xa6, 0xd8, 0xff, 0x92, 0xa4, 0xde, 0xff, 0x93, 0xa6, 0xe5, 0xff, 0x7f, 0x95, 0xcf, 0xff, 0x45, 0x5a, 0x90, 0xff, 0x35, 0x4a, 0x7e, 0xff, 0x71, 0x82, 0xb2, 0xff, 0xa3, 0xb4, 0xe0, 0xff, 0xa2, 0xb6, 0xe2, 0xff, 0x97, 0xb4, 0xdd, 0xff, 0x89, 0xb2, 0xd7, 0xff, 0x7c, 0xa2, 0xd0, 0xff, 0x47, 0x6a, 0x9e, 0xff, 0x25, 0x4a, 0x7d, 0xff, 0x41, 0x66, 0x9c, 0xff, 0x5b, 0x80, 0xb9, 0xff, 0x63, 0x86, 0xbc, 0xff, 0x64, 0x87, 0xbb, 0xff, 0x6d, 0x91, 0xc4, 0xff, 0x85, 0xa2, 0xcb, 0xff, 0xad, 0xc2, 0xdd, 0xff, 0x42, 0x51, 0x60, 0xff, 0x05, 0x0c, 0x25, 0xff, 0x4b, 0x59, 0x81, 0xff, 0x77, 0x92, 0xab, 0xff, 0xd6, 0xde, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xcb, 0xd8, 0xff, 0x68, 0x90, 0xbb, 0xff, 0x60, 0x8e, 0xc1, 0xff, 0x72, 0x98, 0xb8, 0xff, 0x6f, 0x8f, 0xb6, 0xff, 0x5f, 0x80, 0xb2, 0xff, 0x53, 0x75, 0xa2, 0xff, 0x49, 0x6b, 0x98, 0xff, 0x3b, 0x5e, 0x8b, 0xff, 0x55, 0x79, 0xa2, 0xff, 0x77, 0x9c, 0xc1, 0xff, 0x84, 0xa7, 0xce, 0xff, 0x8f, 0xaf, 0xd6, 0xff, 0x8b, 0xaa, 0xd1, 0xff, 0x74, 0x93, 0xbc, 0xff, 0x4a, 0x69, 0x94, 0xff, 0x35, 0x53, 0x7e, 0xff, 0x3e, 0x5d, 0x87, 0xff, 0x63, 0x84, 0xad, 0xff, 0x71, 0x8f, 0xc0, 0xff, 0x6c, 0x85, 0xbc, 0xff, 0x55, 0x6b, 0x9e, 0xff, 0x47, 0x5b, 0x8a, 0xff, 0x6a, 0x7e, 0xac, 0xff, 0x99, 0xac, 0xd4, 0xff, 0xa6, 0xbc, 0xdf, 0xff, 0x9c, 0xb8, 0xdd, 0xff, 0x93, 0xb4, 0xdc, 0xff, 0x8a, 0xac, 0xd8, 0xff, 0x88, 0xaa, 0xd4, 0xff, 0x7c, 0x9e, 0xc9, 0xff, 0x41, 0x65, 0x92, 0xff, 0x29, 0x51, 0x7f, 0xff, 0x47, 0x72, 0xa2, 0xff, 0x5a, 0x82, 0xb3, 0xff, 0x63, 0x89, 0xbb, 0xff, 0x6e, 0x93, 0xc4, 0xff, 0x8f, 0xab, 0xd3, 0xff, 0x95, 0xa7, 0xc3, 0xff, 0x24, 0x34, 0x47, 0xff, 0x18, 0x1e, 0x36, 0xff, 0x37, 0x41, 0x61, 0xff, 0x6a, 0x89, 0xa3, 0xff, 0xb3, 0xc0, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xdf, 0xe7, 0xff, 0x74, 0x93, 0xb5, 0xff, 0x65, 0x8c, 0xb9, 0xff, 0x6d, 0x94, 0xb9, 0xff, 0x69, 0x8c, 0xb6, 0xff, 0x5a, 0x7c, 0xac, 0xff, 0x4e, 0x70, 0x9e, 0xff, 0x45, 0x67, 0x95, 0xff, 0x52, 0x72, 0xa3, 0xff, 0x6d, 0x95, 0xb9, 0xff, 0x77, 0xa2, 0xbe, 0xff, 0x82, 0xaa, 0xca, 0xff, 0x8a, 0xaf, 0xd1, 0xff, 0x8d, 0xae, 0xd2, 0xff, 0x83, 0xa7, 0xc9, 0xff, 0x74, 0x9b, 0xba, 0xff, 0x5f, 0x85, 0xa5, 0xff, 0x38, 0x5e, 0x7e, 0xff, 0x1c, 0x43, 0x62, 0xff, 0x21, 0x45, 0x6a, 0xff, 0x26, 0x47, 0x6e, 0xff, 0x41, 0x61, 0x86, 0xff, 0x77, 0x95, 0xba, 0xff, 0x98, 0xb4, 0xdc, 0xff, 0xa6, 0xbe, 0xde, 0xff, 0xad, 0xc2, 0xdf, 0xff, 0xa7, 0xbe, 0xe3, 0xff, 0x9f, 0xb5, 0xe2, 0xff, 0x97, 0xae, 0xe0, 0xff, 0x87, 0xa6, 0xd0, 0xff, 0x5c, 0x81, 0xa4, 0xff, 0x41, 0x65, 0x8d, 0xff, 0x4b, 0x71, 0x9b, 0xff, 0x56, 0x7d, 0xa9, 0xff, 0x63, 0x88, 0xb6, 0xff, 0x6b, 0x8e, 0xbf, 0xff, 0x71, 0x94, 0xc3, 0xff, 0x9d, 0xb8, 0xdc, 0xff, 0x7a, 0x8a, 0xa2, 0xff, 0x07, 0x18, 0x2b, 0xff, 0x27, 0x30, 0x48, 0xff, 0x21, 0x2a, 0x49, 0xff, 0x50, 0x6e, 0x86, 0xff, 0xaa, 0xbb, 0xcc, 0xff, 0xfc, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf8, 0xfb, 0xff, 0x8f, 0xa4, 0xbe, 0xff, 0x66, 0x89, 0xb0, 0xff, 0x68, 0x90, 0xba, 0xff, 0x6b, 0x8f, 0xbc, 0xff, 0x66, 0x87, 0xb6, 0xff, 0x63, 0x85, 0xb3, 0xff, 0x5c, 0x7e, 0xad, 0xff, 0x4f, 0x71, 0xa2, 0xff, 0x5b, 0x80, 0xa2, 0xff, 0x77, 0x9d, 0xb9, 0xff, 0x8a, 0xa9, 0xcc, 0xff, 0x93, 0xaf, 0xd7, 0xff, 0x9a, 0xb0, 0xde, 0xff, 0x94, 0xaf, 0xda, 0xff, 0x86, 0xa6, 0xce, 0xff, 0x77, 0x96, 0xbe, 0xff, 0x64, 0x82, 0xaa, 0xff, 0x45, 0x64, 0x8c, 0xff, 0x39, 0x56, 0x80, 0xff, 0x58, 0x73, 0x9e, 0xff, 0x84, 0x9d, 0xc9, 0xff, 0x9b, 0xb1, 0xe1, 0xff, 0x9b, 0xaf, 0xe2, 0xff, 0x9d, 0xad, 0xdc, 0xff, 0x9c, 0xab, 0xd7, 0xff, 0x98, 0xa7, 0xd5, 0xff, 0x9c, 0xab, 0xdb, 0xff, 0x86, 0x94, 0xc7, 0xff, 0x36, 0x4d, 0x78, 0xff, 0x21, 0x43, 0x6a, 0xff, 0x58, 0x79, 0xa4, 0xff, 0x75, 0x97, 0xc4, 0xff, 0x71, 0x95, 0xc4, 0xff, 0x6c, 0x8f, 0xbd, 0xff, 0x70, 0x91, 0xbf, 0xff, 0x73, 0x94, 0xc1, 0xff, 0xa4, 0xbe, 0xe1, 0xff, 0x52, 0x5f, 0x74, 0xff, 0x03, 0x15, 0x28, 0xff, 0x29, 0x31, 0x4d, 0xff, 0x2f, 0x35, 0x50, 0xff, 0x2b, 0x47, 0x5e, 0xff, 0x8c, 0xa5, 0xbf, 0xff, 0xf3, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xc4, 0xd9, 0xff, 0x65, 0x86, 0xad, 0xff, 0x60, 0x89, 0xb8, 0xff, 0x68, 0x8d, 0xbd, 0xff, 0x6f, 0x90, 0xbe, 0xff, 0x70, 0x93, 0xc2, 0xff, 0x72, 0x95, 0xc3, 0xff, 0x57, 0x7a, 0xa9, 0xff, 0x23, 0x3e, 0x64, 0xff, 0x29, 0x3c, 0x5a, 0xff, 0x63, 0x77, 0xa1, 0xff, 0x7d, 0x8a, 0xc2, 0xff, 0x81, 0x89, 0xc5, 0xff, 0x6b, 0x78, 0xb5, 0xff, 0x61, 0x73, 0xaf, 0xff, 0x61, 0x71, 0xad, 0xff, 0x60, 0x71, 0xad, 0xff, 0x68, 0x7a, 0xb5, 0xff, 0x7a, 0x8a, 0xc4, 0xff, 0x85, 0x93, 0xce, 0xff, 0x7e, 0x89, 0xca, 0xff, 0x7c, 0x82, 0xc9, 0xff, 0x6b, 0x6d, 0xb8, 0xff, 0x60, 0x63, 0xaf, 0xff, 0x54, 0x5a, 0xa2, 0xff, 0x53, 0x5b, 0x99, 0xff, 0x31, 0x3a, 0x6d, 0xff, 0x09, 0x0e, 0x3a, 0xff, 0x0a, 0x19, 0x48, 0xff, 0x55, 0x72, 0xa2, 0xff, 0x85, 0xa2, 0xd4, 0xff, 0x8a, 0xa8, 0xde, 0xff, 0x7b, 0x9b, 0xd3, 0xff, 0x72, 0x93, 0xc4, 0xff, 0x70, 0x91, 0xbe, 0xff, 0x84, 0xa5, 0xd2, 0xff, 0x8a, 0xa3, 0xc6, 0xff, 0x19, 0x24, 0x38, 0xff, 0x17, 0x28, 0x3c, 0xff, 0x2f, 0x39, 0x55, 0xff, 0x37, 0x3a, 0x51, 0xff, 0x21, 0x3e, 0x53, 0xff, 0x56, 0x74, 0x94, 0xff, 0xdf, 0xe2, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xf0, 0xf4, 0xff, 0x88, 0x99, 0xb4, 0xff, 0x61, 0x84, 0xb8, 0xff, 0x60, 0x89, 0xbb, 0xff, 0x68, 0x8c, 0xb2, 0xff, 0x76, 0x94, 0xbb, 0xff, 0x7e, 0x9c, 0xc6, 0xff, 0x65, 0x8e, 0xbc, 0xff, 0x3d, 0x5a, 0x79, 0xff, 0x03, 0x06, 0x1f, 0xff, 0x00, 0x00, 0x1a, 0xff, 0x14, 0x13, 0x37, 0xff, 0x30, 0x34, 0x5e, 0xff, 0x44, 0x57, 0x87, 0xff, 0x48, 0x5f, 0x96, 0xff, 0x48, 0x59, 0x94, 0xff, 0x3b, 0x48, 0x89, 0xff, 0x35, 0x3e, 0x83, 0xff, 0x37, 0x3e, 0x8b, 0xff, 0x3b, 0x42, 0x92, 0xff, 0x3e, 0x47, 0x92, 0xff, 0x3f, 0x48, 0x8c, 0xff, 0x4d, 0x58, 0x96, 0xff, 0x4e, 0x62, 0x89, 0xff, 0x43, 0x53, 0x7b, 0xff, 0x20, 0x20, 0x62, 0xff, 0x00, 0x00, 0x3d, 0xff, 0x35, 0x38, 0x6b, 0xff, 0x85, 0x99, 0xca, 0xff, 0x89, 0xa5, 0xd9, 0xff, 0x88, 0xa3, 0xd6, 0xff, 0x8c, 0xa7, 0xdc, 0xff, 0x7b, 0x95, 0xcb, 0xff, 0x72, 0x91, 0xc4, 0xff, 0x74, 0x92, 0xbe, 0xff, 0xa5, 0xba, 0xdb, 0xff, 0x53, 0x64, 0x7a, 0xff, 0x00, 0x0b, 0x1a, 0xff, 0x1c, 0x29, 0x3f, 0xff, 0x2f, 0x3b, 0x58, 0xff, 0x32, 0x40, 0x5b, 0xff, 0x28, 0x3f, 0x5c, 0xff, 0x38, 0x56, 0x78, 0xff, 0xa0, 0xb2, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xc2, 0xd5, 0xff, 0x65, 0x80, 0xb0, 0xff, 0x61, 0x88, 0xb7, 0xff, 0x68, 0x89, 0xb2, 0xff, 0x74, 0x8d, 0xb8, 0xff, 0x76, 0x92, 0xbf, 0xff, 0x61, 0x8c, 0xb9, 0xff, 0x66, 0x88, 0xc1, 0xff, 0x62, 0x6d, 0xab, 0xff, 0x28, 0x21, 0x55, 0xff, 0x00, 0x00, 0x0c, 0xff, 0x00, 0x00, 0x10, 0xff, 0x6d, 0x7f, 0x90, 0xff, 0xae, 0xbd, 0xd1, 0xff, 0x9b, 0xa7, 0xbc, 0xff, 0x85, 0x8c, 0xa4, 0xff, 0x8a, 0x8f, 0xa9, 0xff, 0x73, 0x78, 0x94, 0xff, 0x7b, 0x80, 0x9b, 0xff, 0x9a, 0xa0, 0xb8, 0xff, 0x92, 0x9c, 0xac, 0xff, 0xbc, 0xc7, 0xca, 0xff, 0x9a, 0xae, 0xc0, 0xff, 0x44, 0x54, 0x84, 0xff, 0x31, 0x2e, 0x74, 0xff, 0x6c, 0x6a, 0xb2, 0xff, 0xa2, 0xab, 0xe1, 0xff, 0xa1, 0xb9, 0xe8, 0xff, 0x83, 0xa1, 0xd2, 0xff, 0x86, 0xa2, 0xd2, 0xff, 0x83, 0x9e, 0xce, 0xff, 0x77, 0x93, 0xc2, 0xff, 0x70, 0x8d, 0xbe, 0xff, 0x8c, 0xa6, 0xcf, 0xff, 0x81, 0x91, 0xaa, 0xff, 0x13, 0x1e, 0x2e, 0xff, 0x13, 0x22, 0x30, 0xff, 0x22, 0x2e, 0x44, 0xff, 0x26, 0x34, 0x51, 0xff, 0x39, 0x4d, 0x6b, 0xff, 0x28, 0x3e, 0x5e, 0xff, 0x2a, 0x47, 0x68, 0xff, 0x73, 0x8d, 0xab, 0xff, 0xea, 0xf3, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf7, 0xfe, 0xff, 0x96, 0xa5, 0xc2, 0xff, 0x66, 0x7f, 0xa7, 0xff, 0x6c, 0x87, 0xb4, 0xff, 0x6c, 0x86, 0xba, 0xff, 0x6a, 0x88, 0xbf, 0xff, 0x62, 0x86, 0xb7, 0xff, 0x62, 0x8d, 0xcb, 0xff, 0x7a, 0x9a, 0xdd, 0xff, 0x7f, 0x8b, 0xc6, 0xff, 0x4f, 0x52, 0x8c, 0xff, 0x28, 0x28, 0x65, 0xff, 0x50, 0x58, 0x79, 0xff, 0x71, 0x7f, 0x88, 0xff, 0xa9, 0xb5, 0xbe, 0xff, 0xc3, 0xcf, 0xd1, 0xff, 0xe0, 0xed, 0xe8, 0xff, 0xcb, 0xd7, 0xd3, 0xff, 0xcb, 0xd7, 0xd4, 0xff, 0xe4, 0xf0, 0xef, 0xff, 0xb0, 0xb9, 0xc0, 0xff, 0x99, 0x9f, 0xa8, 0xff, 0x68, 0x6d, 0xa6, 0xff, 0x4c, 0x4d, 0xa7, 0xff, 0x7b, 0x7b, 0xc4, 0xff, 0xa3, 0xa9, 0xe5, 0xff, 0xa9, 0xba, 0xe6, 0xff, 0x92, 0xae, 0xd8, 0xff, 0x85, 0xa3, 0xd1, 0xff, 0x80, 0x9d, 0xcb, 0xff, 0x76, 0x93, 0xc0, 0xff, 0x70, 0x8e, 0xbb, 0xff, 0x79, 0x95, 0xc1, 0xff, 0x8e, 0xa3, 0xc7, 0xff, 0x2f, 0x3d, 0x55, 0xff, 0x03, 0x0e, 0x1f, 0xff, 0x19, 0x26, 0x37, 0xff, 0x2b, 0x39, 0x4f, 0xff, 0x26, 0x33, 0x50, 0xff, 0x33, 0x45, 0x62, 0xff, 0x30, 0x46, 0x65, 0xff, 0x2b, 0x46, 0x66, 0xff, 0x56, 0x71, 0x92, 0xff, 0xc3, 0xd3, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6,
+    0xff, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xed, 0xf3, 0xff, 0x88, 0x96, 0xae, 0xff, 0x65, 0x7e, 0xa4, 0xff, 0x64, 0x80, 0xb4, 0xff, 0x63, 0x84, 0xbc, 0xff, 0x68, 0x88, 0xbb, 0xff, 0x6c, 0x9a, 0xbe, 0xff, 0x79, 0xa8, 0xc5, 0xff, 0x87, 0xa7, 0xce, 0xff, 0x88, 0x92, 0xd6, 0xff, 0x79, 0x6d, 0xd7, 0xff, 0x4e, 0x52, 0xa5, 0xff, 0x22, 0x35, 0x6c, 0xff, 0x4a, 0x59, 0x91, 0xff, 0x66, 0x75, 0xa4, 0xff, 0x7a, 0x88, 0xb1, 0xff, 0x76, 0x84, 0xb4, 0xff, 0x6b, 0x78, 0xab, 0xff, 0x6e, 0x7d, 0xac, 0xff, 0x62, 0x6c, 0xa8, 0xff, 0x55, 0x58, 0xa9, 0xff, 0x73, 0x6f, 0xd4, 0xff, 0x7d, 0x79, 0xd5, 0xff, 0x91, 0x96, 0xd4, 0xff, 0xa6, 0xb5, 0xe2, 0xff, 0x97, 0xb1, 0xda, 0xff, 0x8a, 0xa8, 0xd3, 0xff, 0x87, 0xa4, 0xd0, 0xff, 0x7b, 0x98, 0xc4, 0xff, 0x6d, 0x8a, 0xb6, 0xff, 0x69, 0x88, 0xb6, 0xff, 0x82, 0x9c, 0xc4, 0xff, 0x48, 0x5a, 0x77, 0xff, 0x08, 0x15, 0x29, 0xff, 0x16, 0x21, 0x31, 0xff, 0x1f, 0x2f, 0x3e, 0xff, 0x31, 0x3f, 0x56, 0xff, 0x23, 0x30, 0x4d, 0xff, 0x26, 0x38, 0x55, 0xff, 0x37, 0x4d, 0x6c, 0xff, 0x37, 0x50, 0x6f, 0xff, 0x3d, 0x5c, 0x80, 0xff, 0x8f, 0xa7, 0xc6, 0xff, 0xf8, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3,
+    0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xe4, 0xe9, 0xff, 0x78, 0x91, 0xad, 0xff, 0x5a, 0x7b, 0xab, 0xff, 0x59, 0x7e, 0xb2, 0xff, 0x65, 0x8a, 0xb1, 0xff, 0x74, 0x92, 0xbd, 0xff, 0x80, 0x9e, 0xc6, 0xff, 0x84, 0xa7, 0xc4, 0xff, 0x8a, 0xa2, 0xcf, 0xff, 0x7d, 0x85, 0xcd, 0xff, 0x75, 0x71, 0xd7, 0xff, 0x75, 0x6d, 0xda, 0xff, 0x6e, 0x69, 0xcd, 0xff, 0x6f, 0x67, 0xc7, 0xff, 0x77, 0x6f, 0xcf, 0xff, 0x80, 0x7a, 0xd2, 0xff, 0x87, 0x87, 0xcf, 0xff, 0x95, 0x97, 0xd6, 0xff, 0xac, 0xaa, 0xf5, 0xff, 0x9b, 0x8e, 0xf7, 0xff, 0x7e, 0x72, 0xe4, 0xff, 0x84, 0x80, 0xd9, 0xff, 0xa2, 0xa9, 0xdb, 0xff, 0x9e, 0xb3, 0xd2, 0xff, 0x89, 0xaa, 0xd2, 0xff, 0x85, 0xa5, 0xd1, 0xff, 0x83, 0xa0, 0xc7, 0xff, 0x72, 0x8f, 0xb8, 0xff, 0x66, 0x84, 0xac, 0xff, 0x6f, 0x8e, 0xb9, 0xff, 0x5c, 0x74, 0x98, 0xff, 0x0b, 0x18, 0x32, 0xff, 0x1a, 0x24, 0x36, 0xff, 0x22, 0x2c, 0x3a, 0xff, 0x2d, 0x3e, 0x4d, 0xff, 0x2c, 0x3a, 0x52, 0xff, 0x23, 0x30, 0x4e, 0xff, 0x24, 0x37, 0x54, 0xff, 0x25, 0x3b, 0x5a, 0xff, 0x34, 0x4e, 0x6c, 0xff, 0x3c, 0x5d, 0x85, 0xff, 0x6f, 0x8b, 0xb0, 0xff, 0xdb, 0xe4, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe,
+    0xff, 0xff, 0xff, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xd4, 0xe3, 0xff, 0x72, 0x89, 0xb2, 0xff, 0x58, 0x77, 0xa9, 0xff, 0x5d, 0x84, 0xad, 0xff, 0x69, 0x8b, 0xb8, 0xff, 0x75, 0x95, 0xc2, 0xff, 0x7c, 0x9b, 0xc1, 0xff, 0x8a, 0xa4, 0xc9, 0xff, 0x8c, 0xa1, 0xc6, 0xff, 0x73, 0x79, 0xbb, 0xff, 0x6e, 0x67, 0xc7, 0xff, 0x7b, 0x6f, 0xda, 0xff, 0x91, 0x82, 0xf0, 0xff, 0xa2, 0x94, 0xf8, 0xff, 0x9f, 0x93, 0xf1, 0xff, 0xa4, 0x9b, 0xf4, 0xff, 0xa8, 0xa0, 0xf4, 0xff, 0x8c, 0x83, 0xd9, 0xff, 0x71, 0x62, 0xc4, 0xff, 0x78, 0x7b, 0xc6, 0xff, 0x95, 0xa8, 0xda, 0xff, 0x95, 0xa9, 0xd6, 0xff, 0x88, 0xa1, 0xca, 0xff, 0x87, 0xa5, 0xd1, 0xff, 0x83, 0xa3, 0xcf, 0xff, 0x75, 0x95, 0xc1, 0xff, 0x61, 0x82, 0xad, 0xff, 0x58, 0x78, 0xa3, 0xff, 0x6a, 0x8d, 0xbc, 0xff, 0x4d, 0x63, 0x85, 0xff, 0x02, 0x0a, 0x1f, 0xff, 0x1d, 0x28, 0x3e, 0xff, 0x31, 0x3d, 0x52, 0xff, 0x1e, 0x2b, 0x41, 0xff, 0x1f, 0x30, 0x47, 0xff, 0x28, 0x3a, 0x51, 0xff, 0x21, 0x2f, 0x48, 0xff, 0x23, 0x34, 0x4f, 0xff, 0x2d, 0x43, 0x5d, 0xff, 0x35, 0x58, 0x80, 0xff, 0x65, 0x88, 0xb2, 0xff, 0xb9, 0xca, 0xdc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab,
+    0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xe1, 0xe7, 0xff, 0x97, 0xa8, 0xc7, 0xff, 0x78, 0x91, 0xbd, 0xff, 0x5d, 0x7c, 0xa6, 0xff, 0x64, 0x8c, 0xb1, 0xff, 0x6b, 0x92, 0xb8, 0xff, 0x78, 0x96, 0xc0, 0xff, 0x7f, 0x96, 0xc1, 0xff, 0x8b, 0xa0, 0xc7, 0xff, 0x82, 0x98, 0xc1, 0xff, 0x66, 0x75, 0xb4, 0xff, 0x59, 0x5e, 0xb3, 0xff, 0x59, 0x5a, 0xb4, 0xff, 0x61, 0x65, 0xae, 0xff, 0x6b, 0x6d, 0xbe, 0xff, 0x64, 0x63, 0xbf, 0xff, 0x56, 0x58, 0xad, 0xff, 0x56, 0x5b, 0xa8, 0xff, 0x70, 0x74, 0xbd, 0xff, 0x87, 0x98, 0xc9, 0xff, 0x87, 0xa2, 0xc6, 0xff, 0x83, 0x9d, 0xcb, 0xff, 0x86, 0x9f, 0xd0, 0xff, 0x89, 0xa4, 0xd2, 0xff, 0x7c, 0x9c, 0xc9, 0xff, 0x62, 0x85, 0xb3, 0xff, 0x54, 0x75, 0xa3, 0xff, 0x52, 0x74, 0xa1, 0xff, 0x6b, 0x91, 0xc2, 0xff, 0x49, 0x5e, 0x7f, 0xff, 0x06, 0x0f, 0x22, 0xff, 0x17, 0x24, 0x3d, 0xff, 0x1d, 0x2a, 0x43, 0xff, 0x23, 0x2e, 0x48, 0xff, 0x26, 0x39, 0x4e, 0xff, 0x2a, 0x3f, 0x53, 0xff, 0x1b, 0x27, 0x3e, 0xff, 0x21, 0x2e, 0x49, 0xff, 0x25, 0x3a, 0x52, 0xff, 0x1e, 0x40, 0x65, 0xff, 0x5b, 0x80, 0xaa, 0xff, 0xa5, 0xbc, 0xd5, 0xff, 0xeb, 0xf4, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b,
+    0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xe0, 0xe2, 0xff, 0x80, 0x95, 0xb0, 0xff, 0x8b, 0xa6, 0xcc, 0xff, 0x81, 0x99, 0xbc, 0xff, 0x67, 0x86, 0xac, 0xff, 0x6b, 0x8c, 0xb6, 0xff, 0x75, 0x93, 0xbc, 0xff, 0x80, 0x9a, 0xc3, 0xff, 0x79, 0x90, 0xba, 0xff, 0x72, 0x8f, 0xb5, 0xff, 0x6f, 0x8d, 0xb6, 0xff, 0x60, 0x76, 0xad, 0xff, 0x53, 0x67, 0xa0, 0xff, 0x52, 0x66, 0x95, 0xff, 0x54, 0x64, 0xa0, 0xff, 0x52, 0x61, 0xa5, 0xff, 0x57, 0x69, 0xa1, 0xff, 0x67, 0x7d, 0xab, 0xff, 0x78, 0x91, 0xb5, 0xff, 0x7e, 0x93, 0xbf, 0xff, 0x82, 0x96, 0xc7, 0xff, 0x8a, 0xa2, 0xd0, 0xff, 0x8c, 0xa5, 0xd3, 0xff, 0x85, 0xa1, 0xce, 0xff, 0x6c, 0x8c, 0xb9, 0xff, 0x54, 0x76, 0xa3, 0xff, 0x4e, 0x6f, 0x9c, 0xff, 0x5b, 0x7c, 0xa9, 0xff, 0x74, 0x98, 0xc9, 0xff, 0x3a, 0x50, 0x71, 0xff, 0x07, 0x10, 0x24, 0xff, 0x1b, 0x28, 0x40, 0xff, 0x0d, 0x1a, 0x32, 0xff, 0x27, 0x32, 0x4b, 0xff, 0x1c, 0x2e, 0x44, 0xff, 0x1f, 0x33, 0x48, 0xff, 0x1e, 0x2b, 0x43, 0xff, 0x19, 0x29, 0x43, 0xff, 0x25, 0x3c, 0x55, 0xff, 0x1a, 0x3a, 0x5b, 0xff, 0x47, 0x6a, 0x8f, 0xff, 0x94, 0xad, 0xcb, 0xff, 0xd6, 0xe4, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6b,
+    0xff, 0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xe9, 0xeb, 0xff, 0x71, 0x8e, 0xaa, 0xff, 0x5f, 0x80, 0xa7, 0xff, 0x80, 0x96, 0xbc, 0xff, 0x7c, 0x95, 0xbd, 0xff, 0x6a, 0x89, 0xb2, 0xff, 0x6f, 0x8c, 0xb5, 0xff, 0x7d, 0x99, 0xc2, 0xff, 0x7f, 0x9a, 0xc3, 0xff, 0x70, 0x8e, 0xb4, 0xff, 0x64, 0x84, 0xa8, 0xff, 0x5e, 0x79, 0xa2, 0xff, 0x5a, 0x73, 0x9c, 0xff, 0x56, 0x6e, 0x95, 0xff, 0x56, 0x6c, 0x9a, 0xff, 0x5d, 0x73, 0xa5, 0xff, 0x69, 0x80, 0xad, 0xff, 0x71, 0x8a, 0xb2, 0xff, 0x78, 0x94, 0xb5, 0xff, 0x86, 0x9c, 0xc7, 0xff, 0x91, 0xa5, 0xd6, 0xff, 0x92, 0xaa, 0xd7, 0xff, 0x8c, 0xa5, 0xd3, 0xff, 0x7b, 0x97, 0xc4, 0xff, 0x5b, 0x7b, 0xa8, 0xff, 0x48, 0x6a, 0x97, 0xff, 0x4d, 0x6e, 0x9b, 0xff, 0x65, 0x86, 0xb3, 0xff, 0x79, 0x9e, 0xce, 0xff, 0x34, 0x4a, 0x6b, 0xff, 0x00, 0x0a, 0x1e, 0xff, 0x28, 0x35, 0x4d, 0xff, 0x13, 0x20, 0x38, 0xff, 0x14, 0x20, 0x38, 0xff, 0x21, 0x34, 0x4a, 0xff, 0x19, 0x2d, 0x42, 0xff, 0x1f, 0x2c, 0x44, 0xff, 0x20, 0x2f, 0x49, 0xff, 0x1f, 0x36, 0x50, 0xff, 0x22, 0x3f, 0x5c, 0xff, 0x38, 0x56, 0x79, 0xff, 0x85, 0xa3, 0xc6, 0xff, 0xbc, 0xd1, 0xe6, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4b,
+    0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xe6, 0xec, 0xff, 0x70, 0x97, 0xb7, 0xff, 0x54, 0x7c, 0xab, 0xff, 0x54, 0x6c, 0x99, 0xff, 0x6c, 0x81, 0xab, 0xff, 0x78, 0x93, 0xbb, 0xff, 0x73, 0x8e, 0xb7, 0xff, 0x74, 0x91, 0xba, 0xff, 0x86, 0xa6, 0xce, 0xff, 0x88, 0xa1, 0xcf, 0xff, 0x81, 0x96, 0xc7, 0xff, 0x7c, 0x94, 0xbe, 0xff, 0x80, 0x94, 0xbe, 0xff, 0x8a, 0x99, 0xc9, 0xff, 0x8e, 0xa0, 0xca, 0xff, 0x91, 0xa5, 0xcc, 0xff, 0x94, 0xa5, 0xd4, 0xff, 0x96, 0xa6, 0xd9, 0xff, 0x9a, 0xa7, 0xdf, 0xff, 0x9a, 0xab, 0xde, 0xff, 0x99, 0xae, 0xdb, 0xff, 0x96, 0xad, 0xdb, 0xff, 0x89, 0xa1, 0xd0, 0xff, 0x64, 0x80, 0xad, 0xff, 0x44, 0x64, 0x91, 0xff, 0x49, 0x6a, 0x97, 0xff, 0x5d, 0x7e, 0xab, 0xff, 0x6b, 0x8c, 0xb8, 0xff, 0x7b, 0xa0, 0xd0, 0xff, 0x3c, 0x50, 0x71, 0xff, 0x00, 0x06, 0x1b, 0xff, 0x1b, 0x28, 0x41, 0xff, 0x10, 0x1e, 0x36, 0xff, 0x06, 0x11, 0x2a, 0xff, 0x1a, 0x2c, 0x41, 0xff, 0x2a, 0x3e, 0x53, 0xff, 0x19, 0x26, 0x3e, 0xff, 0x23, 0x32, 0x4d, 0xff, 0x23, 0x3c, 0x58, 0xff, 0x20, 0x3c, 0x57, 0xff, 0x2d, 0x49, 0x6a, 0xff, 0x61, 0x82, 0xa9, 0xff, 0xa4, 0xbd, 0xd9, 0xff, 0xec, 0xf1, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21,
+    0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xdc, 0xeb, 0xff, 0x70, 0x8f, 0xb8, 0xff, 0x5d, 0x89, 0xaf, 0xff, 0x50, 0x75, 0xa1, 0xff, 0x42, 0x60, 0x8d, 0xff, 0x50, 0x70, 0x98, 0xff, 0x6e, 0x8e, 0xb6, 0xff, 0x77, 0x93, 0xbc, 0xff, 0x7f, 0x9d, 0xc5, 0xff, 0x96, 0xad, 0xdc, 0xff, 0xa1, 0xb2, 0xe3, 0xff, 0xa3, 0xb7, 0xe0, 0xff, 0xab, 0xbd, 0xe4, 0xff, 0xb0, 0xc0, 0xe7, 0xff, 0xae, 0xbe, 0xe5, 0xff, 0xab, 0xbb, 0xe6, 0xff, 0xaa, 0xb9, 0xe5, 0xff, 0xaa, 0xb9, 0xe8, 0xff, 0xab, 0xb7, 0xe9, 0xff, 0x9f, 0xb2, 0xe1, 0xff, 0x9a, 0xb2, 0xe0, 0xff, 0x98, 0xaf, 0xde, 0xff, 0x6d, 0x87, 0xb5, 0xff, 0x3e, 0x5a, 0x87, 0xff, 0x42, 0x62, 0x8e, 0xff, 0x59, 0x7b, 0xa8, 0xff, 0x6a, 0x8b, 0xb9, 0xff, 0x6f, 0x90, 0xbf, 0xff, 0x7e, 0xa1, 0xd6, 0xff, 0x40, 0x55, 0x78, 0xff, 0x07, 0x0f, 0x20, 0xff, 0x17, 0x22, 0x35, 0xff, 0x0d, 0x19, 0x2d, 0xff, 0x12, 0x22, 0x3b, 0xff, 0x09, 0x1a, 0x34, 0xff, 0x2d, 0x3e, 0x57, 0xff, 0x25, 0x34, 0x4c, 0xff, 0x11, 0x20, 0x36, 0xff, 0x2e, 0x3d, 0x51, 0xff, 0x30, 0x3f, 0x58, 0xff, 0x28, 0x42, 0x64, 0xff, 0x3b, 0x64, 0x89, 0xff, 0x86, 0xa9, 0xc7, 0xff, 0xd2, 0xdf, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xd3, 0xe8, 0xff, 0x6f, 0x89, 0xb6, 0xff, 0x5f, 0x8c, 0xab, 0xff, 0x54, 0x7f, 0xa9, 0xff, 0x48, 0x6c, 0x99, 0xff, 0x32, 0x57, 0x7d, 0xff, 0x38, 0x59, 0x82, 0xff, 0x65, 0x81, 0xaa, 0xff, 0x7e, 0x9b, 0xc3, 0xff, 0x89, 0xa0, 0xcd, 0xff, 0x9c, 0xb0, 0xdf, 0xff, 0xa5, 0xb8, 0xe5, 0xff, 0xab, 0xbe, 0xe6, 0xff, 0xad, 0xbe, 0xe2, 0xff, 0xa7, 0xb7, 0xe2, 0xff, 0xa6, 0xb5, 0xe7, 0xff, 0xa9, 0xb9, 0xe7, 0xff, 0xa7, 0xb7, 0xe5, 0xff, 0xa2, 0xb1, 0xde, 0xff, 0x9b, 0xb0, 0xdd, 0xff, 0x95, 0xad, 0xdb, 0xff, 0x6e, 0x87, 0xb5, 0xff, 0x3c, 0x58, 0x85, 0xff, 0x41, 0x5f, 0x8c, 0xff, 0x59, 0x7a, 0xa6, 0xff, 0x6a, 0x8c, 0xb8, 0xff, 0x73, 0x94, 0xc2, 0xff, 0x73, 0x93, 0xc4, 0xff, 0x7d, 0x9e, 0xd6, 0xff, 0x4c, 0x63, 0x89, 0xff, 0x10, 0x1c, 0x2d, 0xff, 0x16, 0x21, 0x31, 0xff, 0x09, 0x14, 0x26, 0xff, 0x1b, 0x2b, 0x46, 0xff, 0x09, 0x1b, 0x37, 0xff, 0x18, 0x28, 0x43, 0xff, 0x28, 0x38, 0x51, 0xff, 0x10, 0x1f, 0x32, 0xff, 0x1f, 0x29, 0x38, 0xff, 0x3c, 0x46, 0x5c, 0xff, 0x29, 0x42, 0x63, 0xff, 0x2c, 0x56, 0x79, 0xff, 0x6c, 0x93, 0xb2, 0xff, 0xb5, 0xca, 0xda, 0xff, 0xfc, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xc1, 0xdb, 0xff, 0x6d, 0x8c, 0xbb, 0xff, 0x64, 0x91, 0xb2, 0xff, 0x5d, 0x84, 0xad, 0xff, 0x52, 0x74, 0xa0, 0xff, 0x43, 0x66, 0x8d, 0xff, 0x2e, 0x4f, 0x77, 0xff, 0x2b, 0x47, 0x70, 0xff, 0x51, 0x6d, 0x95, 0xff, 0x74, 0x8e, 0xbe, 0xff, 0x83, 0x9b, 0xcf, 0xff, 0x8a, 0xa0, 0xd2, 0xff, 0x92, 0xa6, 0xd7, 0xff, 0x96, 0xa8, 0xd8, 0xff, 0x90, 0xa2, 0xd5, 0xff, 0x8e, 0xa1, 0xd5, 0xff, 0x90, 0xa2, 0xd6, 0xff, 0x91, 0xa4, 0xd8, 0xff, 0x8e, 0xa1, 0xd5, 0xff, 0x81, 0x98, 0xc8, 0xff, 0x5b, 0x76, 0xa2, 0xff, 0x37, 0x52, 0x80, 0xff, 0x3e, 0x5d, 0x8a, 0xff, 0x5a, 0x7b, 0xa8, 0xff, 0x69, 0x8c, 0xb7, 0xff, 0x73, 0x94, 0xc0, 0xff, 0x7a, 0x9a, 0xc9, 0xff, 0x77, 0x96, 0xc7, 0xff, 0x78, 0x99, 0xcf, 0xff, 0x5d, 0x78, 0xa0, 0xff, 0x19, 0x2a, 0x40, 0xff, 0x08, 0x14, 0x27, 0xff, 0x07, 0x14, 0x26, 0xff, 0x1b, 0x2b, 0x43, 0xff, 0x14, 0x27, 0x41, 0xff, 0x0f, 0x20, 0x3a, 0xff, 0x22, 0x31, 0x49, 0xff, 0x1a, 0x28, 0x3c, 0xff, 0x06, 0x12, 0x24, 0xff, 0x2f, 0x3c, 0x50, 0xff, 0x39, 0x50, 0x6c, 0xff, 0x28, 0x4c, 0x71, 0xff, 0x52, 0x78, 0x99, 0xff, 0x96, 0xb4, 0xcc, 0xff, 0xe9, 0xf3, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x97, 0xab, 0xcc, 0xff, 0x6f, 0x8f, 0xc1, 0xff, 0x6a, 0x97, 0xb9, 0xff, 0x64, 0x8a, 0xb1, 0xff, 0x5c, 0x7d, 0xa8, 0xff, 0x4e, 0x71, 0x98, 0xff, 0x3d, 0x5e, 0x87, 0xff, 0x30, 0x4d, 0x76, 0xff, 0x27, 0x42, 0x6a, 0xff, 0x37, 0x57, 0x81, 0xff, 0x52, 0x73, 0x9f, 0xff, 0x64, 0x81, 0xaf, 0xff, 0x6b, 0x85, 0xb5, 0xff, 0x6d, 0x84, 0xb6, 0xff, 0x66, 0x7e, 0xaf, 0xff, 0x60, 0x79, 0xaa, 0xff, 0x61, 0x7a, 0xaa, 0xff, 0x5f, 0x78, 0xa9, 0xff, 0x54, 0x6c, 0x9d, 0xff, 0x3c, 0x56, 0x85, 0xff, 0x32, 0x4e, 0x7b, 0xff, 0x44, 0x62, 0x8f, 0xff, 0x58, 0x7a, 0xa6, 0xff, 0x67, 0x8b, 0xb7, 0xff, 0x71, 0x94, 0xc0, 0xff, 0x77, 0x98, 0xc5, 0xff, 0x7c, 0x9d, 0xcb, 0xff, 0x77, 0x97, 0xc8, 0xff, 0x74, 0x95, 0xca, 0xff, 0x66, 0x83, 0xaf, 0xff, 0x21, 0x38, 0x56, 0xff, 0x02, 0x11, 0x28, 0xff, 0x06, 0x12, 0x27, 0xff, 0x1a, 0x29, 0x3f, 0xff, 0x16, 0x27, 0x40, 0xff, 0x0d, 0x1e, 0x39, 0xff, 0x21, 0x30, 0x49, 0xff, 0x25, 0x34, 0x48, 0xff, 0x04, 0x10, 0x23, 0xff, 0x18, 0x25, 0x35, 0xff, 0x3b, 0x52, 0x68, 0xff, 0x29, 0x47, 0x6c, 0xff, 0x3e, 0x62, 0x8a, 0xff, 0x72, 0x9b, 0xbd, 0xff, 0xcb, 0xe1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xe1, 0xe3, 0xff, 0x82, 0x98, 0xbd, 0xff, 0x71, 0x95, 0xc9, 0xff, 0x6b, 0x9b, 0xbd, 0xff, 0x6b, 0x91, 0xb6, 0xff, 0x65, 0x85, 0xb0, 0xff, 0x56, 0x7a, 0xa0, 0xff, 0x46, 0x66, 0x8e, 0xff, 0x3b, 0x56, 0x80, 0xff, 0x34, 0x4d, 0x79, 0xff, 0x24, 0x49, 0x6a, 0xff, 0x23, 0x4d, 0x6b, 0xff, 0x2d, 0x52, 0x77, 0xff, 0x2e, 0x4e, 0x78, 0xff, 0x2c, 0x47, 0x75, 0xff, 0x28, 0x45, 0x71, 0xff, 0x22, 0x42, 0x6b, 0xff, 0x20, 0x3f, 0x69, 0xff, 0x1f, 0x3e, 0x69, 0xff, 0x1f, 0x3e, 0x68, 0xff, 0x2c, 0x4a, 0x76, 0xff, 0x47, 0x65, 0x93, 0xff, 0x5b, 0x7c, 0xa9, 0xff, 0x67, 0x8b, 0xb7, 0xff, 0x6d, 0x94, 0xc0, 0xff, 0x75, 0x99, 0xc5, 0xff, 0x7d, 0x9e, 0xcb, 0xff, 0x7f, 0xa0, 0xce, 0xff, 0x76, 0x96, 0xc8, 0xff, 0x73, 0x92, 0xc7, 0xff, 0x6e, 0x8d, 0xbb, 0xff, 0x31, 0x4b, 0x6d, 0xff, 0x06, 0x18, 0x31, 0xff, 0x0f, 0x1c, 0x31, 0xff, 0x10, 0x1e, 0x33, 0xff, 0x1d, 0x2e, 0x47, 0xff, 0x17, 0x28, 0x43, 0xff, 0x15, 0x25, 0x3d, 0xff, 0x28, 0x36, 0x4a, 0xff, 0x1f, 0x2a, 0x3d, 0xff, 0x0e, 0x1d, 0x29, 0xff, 0x29, 0x40, 0x52, 0xff, 0x34, 0x4c, 0x74, 0xff, 0x39, 0x5b, 0x89, 0xff, 0x54, 0x85, 0xb1, 0xff, 0xad, 0xc9, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0x99, 0xb0, 0xc9, 0xff, 0x75, 0x96, 0xc4, 0xff, 0x77, 0x99, 0xc7, 0xff, 0x75, 0x9b, 0xc3, 0xff, 0x72, 0x94, 0xbe, 0xff, 0x6a, 0x8d, 0xb8, 0xff, 0x5e, 0x82, 0xac, 0xff, 0x53, 0x74, 0x9d, 0xff, 0x42, 0x62, 0x88, 0xff, 0x35, 0x54, 0x79, 0xff, 0x31, 0x52, 0x76, 0xff, 0x2e, 0x51, 0x76, 0xff, 0x28, 0x48, 0x6f, 0xff, 0x1f, 0x3e, 0x66, 0xff, 0x18, 0x36, 0x5f, 0xff, 0x16, 0x33, 0x5e, 0xff, 0x16, 0x33, 0x5e, 0xff, 0x17, 0x34, 0x5f, 0xff, 0x1f, 0x3c, 0x66, 0xff, 0x33, 0x50, 0x7a, 0xff, 0x48, 0x67, 0x92, 0xff, 0x59, 0x7a, 0xa5, 0xff, 0x67, 0x88, 0xb3, 0xff, 0x6f, 0x91, 0xbc, 0xff, 0x77, 0x9b, 0xc6, 0xff, 0x81, 0xa1, 0xcb, 0xff, 0x85, 0xa1, 0xcc, 0xff, 0x83, 0xa0, 0xce, 0xff, 0x79, 0x99, 0xc8, 0xff, 0x70, 0x90, 0xc3, 0xff, 0x70, 0x8f, 0xc0, 0xff, 0x37, 0x51, 0x78, 0xff, 0x08, 0x19, 0x35, 0xff, 0x16, 0x22, 0x38, 0xff, 0x10, 0x1c, 0x33, 0xff, 0x1d, 0x2c, 0x45, 0xff, 0x24, 0x34, 0x4e, 0xff, 0x0f, 0x1e, 0x38, 0xff, 0x21, 0x2f, 0x48, 0xff, 0x21, 0x2f, 0x49, 0xff, 0x12, 0x1e, 0x2e, 0xff, 0x21, 0x2f, 0x3e, 0xff, 0x3f, 0x58, 0x77, 0xff, 0x3e, 0x62, 0x87, 0xff, 0x58, 0x87, 0xad, 0xff, 0x8a, 0xaa, 0xc2, 0xff, 0xea, 0xf5, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xcd, 0xda, 0xff, 0x74, 0x96, 0xc1, 0xff, 0x77, 0x9d, 0xcd, 0xff, 0x7b, 0x9d, 0xc7, 0xff, 0x7b, 0x9b, 0xc7, 0xff, 0x76, 0x98, 0xc4, 0xff, 0x6f, 0x94, 0xbf, 0xff, 0x66, 0x8a, 0xb6, 0xff, 0x5c, 0x7f, 0xa8, 0xff, 0x4f, 0x72, 0x96, 0xff, 0x40, 0x62, 0x83, 0xff, 0x38, 0x56, 0x7e, 0xff, 0x33, 0x4f, 0x7b, 0xff, 0x2f, 0x4c, 0x75, 0xff, 0x2a, 0x48, 0x71, 0xff, 0x21, 0x40, 0x68, 0xff, 0x23, 0x3e, 0x69, 0xff, 0x29, 0x42, 0x70, 0xff, 0x30, 0x4b, 0x77, 0xff, 0x3b, 0x55, 0x82, 0xff, 0x4d, 0x66, 0x93, 0xff, 0x57, 0x74, 0xa0, 0xff, 0x61, 0x81, 0xac, 0xff, 0x6f, 0x8d, 0xb8, 0xff, 0x7b, 0x99, 0xc5, 0xff, 0x83, 0xa2, 0xcd, 0xff, 0x89, 0xa5, 0xce, 0xff, 0x8a, 0xa4, 0xcd, 0xff, 0x84, 0x9f, 0xcc, 0xff, 0x7a, 0x9a, 0xc7, 0xff, 0x6e, 0x8f, 0xc0, 0xff, 0x6f, 0x8e, 0xc0, 0xff, 0x42, 0x5c, 0x85, 0xff, 0x11, 0x22, 0x40, 0xff, 0x15, 0x21, 0x39, 0xff, 0x17, 0x23, 0x3b, 0xff, 0x1e, 0x2c, 0x46, 0xff, 0x29, 0x38, 0x52, 0xff, 0x13, 0x22, 0x3c, 0xff, 0x21, 0x30, 0x4b, 0xff, 0x29, 0x3a, 0x57, 0xff, 0x06, 0x0f, 0x22, 0xff, 0x1b, 0x23, 0x30, 0xff, 0x40, 0x5a, 0x73, 0xff, 0x3c, 0x61, 0x7f, 0xff, 0x5b, 0x86, 0xa5, 0xff, 0x81, 0xa4, 0xc2, 0xff, 0xcc, 0xe0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x46, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xdd, 0xee, 0xff, 0x7c, 0x9a, 0xc0, 0xff, 0x7a, 0x9d, 0xc8, 0xff, 0x7b, 0x9c, 0xc8, 0xff, 0x7c, 0x9e, 0xc9, 0xff, 0x7a, 0x9c, 0xc7, 0xff, 0x79, 0x9b, 0xc6, 0xff, 0x73, 0x97, 0xc1, 0xff, 0x6d, 0x91, 0xbc, 0xff, 0x67, 0x8a, 0xb2, 0xff, 0x60, 0x81, 0xa6, 0xff, 0x54, 0x74, 0x96, 0xff, 0x44, 0x63, 0x8a, 0xff, 0x3c, 0x59, 0x83, 0xff, 0x36, 0x54, 0x7d, 0xff, 0x32, 0x50, 0x79, 0xff, 0x31, 0x50, 0x78, 0xff, 0x35, 0x52, 0x7c, 0xff, 0x3a, 0x55, 0x81, 0xff, 0x42, 0x5d, 0x89, 0xff, 0x4f, 0x6a, 0x96, 0xff, 0x5c, 0x76, 0xa2, 0xff, 0x67, 0x82, 0xae, 0xff, 0x71, 0x8e, 0xba, 0xff, 0x7e, 0x9a, 0xc6, 0xff, 0x86, 0xa2, 0xcf, 0xff, 0x89, 0xa6, 0xd2, 0xff, 0x8b, 0xa7, 0xd1, 0xff, 0x88, 0xa3, 0xcd, 0xff, 0x82, 0x9e, 0xcb, 0xff, 0x7b, 0x9b, 0xc8, 0xff, 0x71, 0x92, 0xc3, 0xff, 0x73, 0x93, 0xc5, 0xff, 0x52, 0x6f, 0x99, 0xff, 0x1f, 0x31, 0x51, 0xff, 0x1b, 0x29, 0x43, 0xff, 0x10, 0x1e, 0x39, 0xff, 0x25, 0x34, 0x4f, 0xff, 0x2e, 0x3c, 0x56, 0xff, 0x10, 0x1f, 0x39, 0xff, 0x1b, 0x2a, 0x44, 0xff, 0x2c, 0x3d, 0x59, 0xff, 0x06, 0x0f, 0x21, 0xff, 0x0f, 0x15, 0x23, 0xff, 0x35, 0x4b, 0x67, 0xff, 0x3e, 0x61, 0x82, 0xff, 0x4f, 0x77, 0x98, 0xff, 0x84, 0xa8, 0xc6, 0xff, 0xb2, 0xc8, 0xdc, 0xff, 0xf9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x07, 0xfe, 0xfe, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xe2, 0xf0, 0xff, 0x7f, 0x9d, 0xc7, 0xff, 0x77, 0x9b, 0xcb, 0xff, 0x7e, 0xa1, 0xce, 0xff, 0x7e, 0xa0, 0xca, 0xff, 0x7d, 0x9f, 0xca, 0xff, 0x7b, 0x9d, 0xc8, 0xff, 0x7a, 0x9c, 0xc7, 0xff, 0x76, 0x9b, 0xc5, 0xff, 0x72, 0x96, 0xc1, 0xff, 0x6e, 0x90, 0xb9, 0xff, 0x69, 0x8a, 0xaf, 0xff, 0x62, 0x83, 0xa6, 0xff, 0x5c, 0x7b, 0xa2, 0xff, 0x56, 0x73, 0x9d, 0xff, 0x50, 0x6e, 0x97, 0xff, 0x4d, 0x6b, 0x94, 0xff, 0x4d, 0x6b, 0x94, 0xff, 0x52, 0x6e, 0x99, 0xff, 0x59, 0x74, 0xa0, 0xff, 0x60, 0x7b, 0xa7, 0xff, 0x69, 0x84, 0xb0, 0xff, 0x70, 0x8b, 0xb7, 0xff, 0x78, 0x93, 0xbf, 0xff, 0x83, 0x9d, 0xc9, 0xff, 0x8a, 0xa4, 0xcf, 0xff, 0x8b, 0xa5, 0xd1, 0xff, 0x8d, 0xa7, 0xd3, 0xff, 0x8d, 0xa8, 0xd2, 0xff, 0x87, 0xa3, 0xcc, 0xff, 0x83, 0x9f, 0xcc, 0xff, 0x7e, 0x9e, 0xcb, 0xff, 0x75, 0x96, 0xc7, 0xff, 0x7b, 0x9c, 0xcf, 0xff, 0x56, 0x75, 0xa3, 0xff, 0x1d, 0x32, 0x53, 0xff, 0x16, 0x25, 0x41, 0xff, 0x0e, 0x1e, 0x3b, 0xff, 0x23, 0x33, 0x4e, 0xff, 0x2a, 0x3a, 0x53, 0xff, 0x0e, 0x1c, 0x36, 0xff, 0x0f, 0x1d, 0x37, 0xff, 0x2d, 0x3e, 0x5a, 0xff, 0x23, 0x29, 0x3b, 0xff, 0x04, 0x08, 0x17, 0xff, 0x1e, 0x31, 0x4d, 0xff, 0x48, 0x67, 0x88, 0xff, 0x45, 0x68, 0x8a, 0xff, 0x7a, 0x9f, 0xc0, 0xff, 0x9d, 0xb9, 0xd4, 0xff, 0xe0, 0xea, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xef, 0xfe, 0xfe, 0xfe, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xd2, 0xd9, 0xe5, 0xff, 0x86, 0xa0, 0xc6, 0xff, 0x79, 0x9c, 0xcc, 0xff, 0x81, 0xa3, 0xd3, 0xff, 0x82, 0xa4, 0xd0, 0xff, 0x81, 0xa4, 0xce, 0xff, 0x80, 0xa2, 0xcd, 0xff, 0x7d, 0x9f, 0xca, 0xff, 0x7d, 0x9f, 0xca, 0xff, 0x78, 0x9e, 0xc8, 0xff, 0x73, 0x97, 0xc3, 0xff, 0x73, 0x96, 0xbf, 0xff, 0x71, 0x93, 0xb8, 0xff, 0x70, 0x91, 0xb3, 0xff, 0x6c, 0x8b, 0xb2, 0xff, 0x67, 0x86, 0xb0, 0xff, 0x65, 0x83, 0xac, 0xff, 0x63, 0x81, 0xaa, 0xff, 0x66, 0x84, 0xad, 0xff, 0x69, 0x86, 0xb1, 0xff, 0x6d, 0x88, 0xb5, 0xff, 0x73, 0x8e, 0xba, 0xff, 0x7a, 0x96, 0xc2, 0xff, 0x7c, 0x98, 0xc4, 0xff, 0x82, 0x9c, 0xc8, 0xff, 0x8b, 0xa3, 0xcf, 0xff, 0x8f, 0xa7, 0xd3, 0xff, 0x93, 0xaa, 0xd7, 0xff, 0x94, 0xab, 0xd8, 0xff, 0x8c, 0xa6, 0xd0, 0xff, 0x87, 0xa3, 0xcc, 0xff, 0x85, 0xa2, 0xd0, 0xff, 0x7e, 0xa0, 0xce, 0xff, 0x7a, 0x9c, 0xcb, 0xff, 0x7d, 0xa0, 0xd4, 0xff, 0x52, 0x73, 0xa3, 0xff, 0x1e, 0x34, 0x57, 0xff, 0x12, 0x22, 0x3f, 0xff, 0x1d, 0x2f, 0x4e, 0xff, 0x14, 0x24, 0x41, 0xff, 0x20, 0x2f, 0x47, 0xff, 0x16, 0x24, 0x3d, 0xff, 0x0e, 0x1c, 0x36, 0xff, 0x37, 0x48, 0x64, 0xff, 0x28, 0x2d, 0x3e, 0xff, 0x05, 0x05, 0x14, 0xff, 0x15, 0x27, 0x44, 0xff, 0x48, 0x66, 0x88, 0xff, 0x46, 0x67, 0x86, 0xff, 0x5e, 0x85, 0xa7, 0xff, 0x94, 0xb4, 0xd4, 0xff, 0xcf, 0xd9, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf8, 0xef, 0xff, 0xce, 0xc5, 0xc1, 0xff, 0x94, 0xa6, 0xc1, 0xff, 0x83, 0xa2, 0xcd, 0xff, 0x82, 0xa1, 0xcd, 0xff, 0x86, 0xa8, 0xd5, 0xff, 0x86, 0xa6, 0xd2, 0xff, 0x85, 0xa5, 0xcf, 0xff, 0x83, 0xa4, 0xcd, 0xff, 0x83, 0xa4, 0xcd, 0xff, 0x80, 0xa1, 0xcb, 0xff, 0x7e, 0x9f, 0xc9, 0xff, 0x7c, 0x9e, 0xc8, 0xff, 0x78, 0x9a, 0xc3, 0xff, 0x78, 0x9a, 0xc3, 0xff, 0x79, 0x9a, 0xc2, 0xff, 0x79, 0x9a, 0xc1, 0xff, 0x7a, 0x98, 0xc0, 0xff, 0x79, 0x94, 0xbe, 0xff, 0x75, 0x91, 0xbb, 0xff, 0x72, 0x8e, 0xb8, 0xff, 0x75, 0x92, 0xbb, 0xff, 0x7b, 0x95, 0xbf, 0xff, 0x7f, 0x97, 0xc2, 0xff, 0x81, 0x9a, 0xc5, 0xff, 0x84, 0x9d, 0xc8, 0xff, 0x88, 0xa2, 0xcd, 0xff, 0x8e, 0xa4, 0xd0, 0xff, 0x93, 0xa7, 0xd2, 0xff, 0x96, 0xad, 0xd8, 0xff, 0x97, 0xaf, 0xda, 0xff, 0x94, 0xac, 0xd7, 0xff, 0x8a, 0xa8, 0xd3, 0xff, 0x89, 0xa7, 0xd0, 0xff, 0x8f, 0xa6, 0xd0, 0xff, 0x89, 0xa3, 0xce, 0xff, 0x83, 0xa0, 0xd2, 0xff, 0x7b, 0x9a, 0xce, 0xff, 0x51, 0x70, 0x9d, 0xff, 0x20, 0x3a, 0x60, 0xff, 0x14, 0x2a, 0x49, 0xff, 0x27, 0x3d, 0x59, 0xff, 0x09, 0x1c, 0x37, 0xff, 0x2a, 0x3b, 0x55, 0xff, 0x1b, 0x2d, 0x47, 0xff, 0x11, 0x23, 0x3e, 0xff, 0x34, 0x47, 0x63, 0xff, 0x17, 0x22, 0x38, 0xff, 0x0e, 0x16, 0x27, 0xff, 0x1b, 0x30, 0x46, 0xff, 0x44, 0x62, 0x80, 0xff, 0x4b, 0x6a, 0x92, 0xff, 0x42, 0x65, 0x90, 0xff, 0x79, 0x99, 0xbb, 0xff, 0xb9, 0xc9, 0xd9, 0xff, 0xf0, 0xf5, 0xf7, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfd, 0xff, 0xe7, 0xd9, 0xd2, 0xff, 0xd5, 0xb5, 0x9d, 0xff, 0xa7, 0x91, 0x8e, 0xff, 0x81, 0x9c, 0xc7, 0xff, 0x81, 0xa9, 0xdf, 0xff, 0x8c, 0xac, 0xd8, 0xff, 0x8c, 0xab, 0xd6, 0xff, 0x8b, 0xaa, 0xd5, 0xff, 0x88, 0xa7, 0xd0, 0xff, 0x86, 0xa5, 0xcd, 0xff, 0x88, 0xa7, 0xcf, 0xff, 0x88, 0xa7, 0xd0, 0xff, 0x84, 0xa3, 0xcc, 0xff, 0x82, 0xa1, 0xca, 0xff, 0x7f, 0x9e, 0xc7, 0xff, 0x7d, 0x9c, 0xc5, 0xff, 0x7d, 0x9c, 0xc6, 0xff, 0x7e, 0x9e, 0xc8, 0xff, 0x83, 0x9f, 0xc8, 0xff, 0x85, 0x9e, 0xc7, 0xff, 0x82, 0x9b, 0xc5, 0xff, 0x7f, 0x99, 0xc2, 0xff, 0x82, 0x9b, 0xc5, 0xff, 0x88, 0xa0, 0xca, 0xff, 0x8b, 0xa3, 0xcc, 0xff, 0x8e, 0xa6, 0xcf, 0xff, 0x8f, 0xa8, 0xd1, 0xff, 0x92, 0xac, 0xd4, 0xff, 0x97, 0xab, 0xd5, 0xff, 0x9b, 0xad, 0xd8, 0xff, 0x9b, 0xb1, 0xdb, 0xff, 0x99, 0xb1, 0xdb, 0xff, 0x95, 0xaf, 0xd8, 0xff, 0x8c, 0xac, 0xd7, 0xff, 0x8e, 0xa9, 0xd4, 0xff, 0x98, 0xad, 0xd1, 0xff, 0x97, 0xad, 0xd5, 0xff, 0x8d, 0xa5, 0xd8, 0xff, 0x7a, 0x97, 0xca, 0xff, 0x4f, 0x6c, 0x97, 0xff, 0x15, 0x31, 0x58, 0xff, 0x1e, 0x36, 0x58, 0xff, 0x25, 0x3d, 0x55, 0xff, 0x0e, 0x23, 0x3c, 0xff, 0x32, 0x45, 0x60, 0xff, 0x10, 0x23, 0x3e, 0xff, 0x16, 0x2a, 0x45, 0xff, 0x30, 0x44, 0x60, 0xff, 0x16, 0x27, 0x40, 0xff, 0x14, 0x23, 0x37, 0xff, 0x24, 0x3a, 0x4d, 0xff, 0x44, 0x60, 0x7b, 0xff, 0x49, 0x66, 0x92, 0xff, 0x40, 0x61, 0x8e, 0xff, 0x73, 0x92, 0xb5, 0xff, 0xae, 0xc4, 0xdd, 0xff, 0xdf, 0xe9, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf6, 0xf6, 0xff, 0xe1, 0xd0, 0xc3, 0xff, 0xc9, 0xad, 0xa2, 0xff, 0xba, 0x96, 0x85, 0xff, 0xd8, 0xad, 0x95, 0xff, 0xc5, 0xa7, 0xa5, 0xff, 0x91, 0xa4, 0xc9, 0xff, 0x89, 0xad, 0xdc, 0xff, 0x8f, 0xad, 0xd7, 0xff, 0x90, 0xad, 0xd7, 0xff, 0x8f, 0xac, 0xd6, 0xff, 0x8c, 0xaa, 0xd3, 0xff, 0x8a, 0xa8, 0xd1, 0xff, 0x8c, 0xaa, 0xd2, 0xff, 0x8c, 0xaa, 0xd3, 0xff, 0x8b, 0xa9, 0xd2, 0xff, 0x88, 0xa6, 0xcf, 0xff, 0x84, 0xa2, 0xcb, 0xff, 0x81, 0x9f, 0xc8, 0xff, 0x82, 0xa0, 0xc9, 0xff, 0x85, 0xa4, 0xcd, 0xff, 0x8b, 0xa5, 0xcd, 0xff, 0x8d, 0xa5, 0xcd, 0xff, 0x8d, 0xa5, 0xcd, 0xff, 0x8c, 0xa5, 0xcd, 0xff, 0x8f, 0xa7, 0xcf, 0xff, 0x92, 0xa9, 0xd1, 0xff, 0x93, 0xa9, 0xd2, 0xff, 0x94, 0xab, 0xd3, 0xff, 0x96, 0xad, 0xd5, 0xff, 0x96, 0xae, 0xd5, 0xff, 0x9b, 0xaf, 0xd9, 0xff, 0xa1, 0xb4, 0xdf, 0xff, 0x9d, 0xb3, 0xdd, 0xff, 0x98, 0xb1, 0xdb, 0xff, 0x93, 0xad, 0xd8, 0xff, 0x8e, 0xac, 0xd5, 0xff, 0x95, 0xaf, 0xd6, 0xff, 0x9e, 0xb3, 0xd6, 0xff, 0x9d, 0xb2, 0xd9, 0xff, 0x8f, 0xa6, 0xd7, 0xff, 0x7b, 0x98, 0xc9, 0xff, 0x4d, 0x6b, 0x97, 0xff, 0x1f, 0x3a, 0x60, 0xff, 0x21, 0x38, 0x59, 0xff, 0x16, 0x2e, 0x47, 0xff, 0x20, 0x34, 0x4e, 0xff, 0x30, 0x43, 0x5e, 0xff, 0x0f, 0x22, 0x3d, 0xff, 0x1e, 0x31, 0x4c, 0xff, 0x31, 0x45, 0x60, 0xff, 0x18, 0x28, 0x43, 0xff, 0x1b, 0x2b, 0x42, 0xff, 0x37, 0x4e, 0x62, 0xff, 0x44, 0x5e, 0x79, 0xff, 0x4c, 0x67, 0x8f, 0xff, 0x45, 0x64, 0x8c, 0xff, 0x66, 0x86, 0xa9, 0xff, 0x9f, 0xb7, 0xd4, 0xff, 0xd3, 0xe1, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xef, 0xee, 0xff, 0xe7, 0xe1, 0xdd, 0xff, 0xe2, 0xd0, 0xcc, 0xff, 0xe4, 0xcf, 0xc9, 0xff, 0xf6, 0xed, 0xe4, 0xff, 0xe3, 0xcd, 0xbb, 0xff, 0xb5, 0x96, 0x88, 0xff, 0xc2, 0x9e, 0x8b, 0xff, 0xe5, 0xb5, 0x9a, 0xff, 0xcd, 0xa9, 0xa2, 0xff, 0x95, 0xa5, 0xc6, 0xff, 0x8a, 0xaf, 0xd8, 0xff, 0x94, 0xb0, 0xd6, 0xff, 0x96, 0xb2, 0xd7, 0xff, 0x96, 0xb2, 0xd7, 0xff, 0x93, 0xae, 0xd6, 0xff, 0x92, 0xac, 0xd6, 0xff, 0x91, 0xac, 0xd5, 0xff, 0x90, 0xaa, 0xd4, 0xff, 0x93, 0xad, 0xd7, 0xff, 0x93, 0xad, 0xd6, 0xff, 0x8e, 0xa9, 0xd2, 0xff, 0x8a, 0xa5, 0xce, 0xff, 0x8a, 0xa4, 0xce, 0xff, 0x8c, 0xa7, 0xd1, 0xff, 0x94, 0xad, 0xd4, 0xff, 0x99, 0xb0, 0xd4, 0xff, 0x97, 0xae, 0xd3, 0xff, 0x98, 0xaf, 0xd4, 0xff, 0x98, 0xaf, 0xd4, 0xff, 0x98, 0xad, 0xd2, 0xff, 0x9b, 0xae, 0xd4, 0xff, 0x9d, 0xb1, 0xd6, 0xff, 0x9d, 0xb1, 0xd6, 0xff, 0x9e, 0xb1, 0xd6, 0xff, 0xa0, 0xb3, 0xdc, 0xff, 0xa1, 0xb5, 0xe0, 0xff, 0x9f, 0xb5, 0xe0, 0xff, 0x9b, 0xb4, 0xde, 0xff, 0x92, 0xad, 0xd7, 0xff, 0x91, 0xae, 0xd6, 0xff, 0x9f, 0xb8, 0xdb, 0xff, 0xa7, 0xba, 0xdb, 0xff, 0xa3, 0xb6, 0xdb, 0xff, 0x90, 0xa6, 0xd4, 0xff, 0x73, 0x8f, 0xc0, 0xff, 0x45, 0x63, 0x90, 0xff, 0x2a, 0x46, 0x6c, 0xff, 0x18, 0x30, 0x50, 0xff, 0x10, 0x28, 0x42, 0xff, 0x26, 0x3a, 0x54, 0xff, 0x28, 0x3a, 0x56, 0xff, 0x17, 0x2a, 0x45, 0xff, 0x2a, 0x3d, 0x58, 0xff, 0x2a, 0x3d, 0x58, 0xff, 0x16, 0x28, 0x44, 0xff, 0x34, 0x48, 0x62, 0xff, 0x3a, 0x52, 0x68, 0xff, 0x29, 0x43, 0x5b, 0xff, 0x57, 0x6f, 0x92, 0xff, 0x45, 0x5e, 0x84, 0xff, 0x50, 0x70, 0x93, 0xff, 0x81, 0xa1, 0xc4, 0xff, 0xbe, 0xd2, 0xe7, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf7, 0xf9, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfb, 0xfd, 0xf5, 0xff, 0xe5, 0xdf, 0xd9, 0xff, 0xdb, 0xd0, 0xcc, 0xff, 0xee, 0xdb, 0xd8, 0xff, 0xe1, 0xdd, 0xd1, 0xff, 0xcd, 0xbd, 0xac, 0xff, 0xc7, 0x97, 0x88, 0xff, 0xc3, 0x94, 0x82, 0xff, 0xd8, 0xbe, 0xa7, 0xff, 0xfc, 0xf5, 0xeb, 0xff, 0xea, 0xdf, 0xe1, 0xff, 0xc4, 0xa6, 0x96, 0xff, 0xdd, 0xae, 0x8e, 0xff, 0xce, 0xae, 0x9f, 0xff, 0x94, 0xa7, 0xc8, 0xff, 0x8e, 0xb0, 0xdb, 0xff, 0x9a, 0xb4, 0xd6, 0xff, 0x99, 0xb4, 0xd8, 0xff, 0x9a, 0xb6, 0xd8, 0xff, 0x99, 0xb2, 0xda, 0xff, 0x97, 0xaf, 0xdb, 0xff, 0x97, 0xb0, 0xda, 0xff, 0x98, 0xb0, 0xdb, 0xff, 0x9a, 0xb3, 0xdd, 0xff, 0x99, 0xb1, 0xdc, 0xff, 0x97, 0xae, 0xd9, 0xff, 0x94, 0xac, 0xd7, 0xff, 0x91, 0xa8, 0xd3, 0xff, 0x93, 0xaa, 0xd6, 0xff, 0x9a, 0xb1, 0xd7, 0xff, 0xa1, 0xb7, 0xd8, 0xff, 0xa0, 0xb7, 0xda, 0xff, 0x9f, 0xb6, 0xd9, 0xff, 0x9e, 0xb6, 0xd9, 0xff, 0x9f, 0xb4, 0xd8, 0xff, 0xa1, 0xb3, 0xd7, 0xff, 0xa1, 0xb5, 0xd9, 0xff, 0xa5, 0xb8, 0xdc, 0xff, 0xa7, 0xba, 0xdd, 0xff, 0xa5, 0xb7, 0xe1, 0xff, 0xa4, 0xb8, 0xe6, 0xff, 0xa2, 0xb9, 0xe4, 0xff, 0x9c, 0xb5, 0xdf, 0xff, 0x95, 0xb1, 0xda, 0xff, 0x96, 0xb3, 0xda, 0xff, 0xa3, 0xbb, 0xde, 0xff, 0xac, 0xbf, 0xde, 0xff, 0xa7, 0xb9, 0xdc, 0xff, 0x96, 0xa9, 0xd5, 0xff, 0x76, 0x8f, 0xc1, 0xff, 0x3f, 0x5c, 0x89, 0xff, 0x22, 0x3d, 0x64, 0xff, 0x18, 0x31, 0x52, 0xff, 0x13, 0x2b, 0x43, 0xff, 0x23, 0x37, 0x50, 0xff, 0x1f, 0x31, 0x4d, 0xff, 0x1b, 0x2e, 0x49, 0xff, 0x2c, 0x3f, 0x5a, 0xff, 0x18, 0x2a, 0x44, 0xff, 0x29, 0x3c, 0x5a, 0xff, 0x44, 0x59, 0x77, 0xff, 0x24, 0x3c, 0x53, 0xff, 0x1e, 0x37, 0x4d, 0xff, 0x59, 0x6f, 0x90, 0xff, 0x51, 0x69, 0x8e, 0xff, 0x3a, 0x5c, 0x80, 0xff, 0x5e, 0x82, 0xa9, 0xff, 0xb1, 0xc6, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xef, 0xff, 0xda, 0xc5, 0xba, 0xff, 0xdb, 0xbc, 0xb1, 0xff, 0xda, 0xc4, 0xb6, 0xff, 0xe3, 0xe3, 0xd8, 0xff, 0xe4, 0xe6, 0xe1, 0xff, 0xd6, 0xbb, 0xad, 0xff, 0xdd, 0xc0, 0xb2, 0xff, 0xdf, 0xcb, 0xc7, 0xff, 0xc7, 0xb2, 0xac, 0xff, 0xb8, 0x9d, 0x90, 0xff, 0xd4, 0xc4, 0xa8, 0xff, 0xf2, 0xe6, 0xd2, 0xff, 0xf6, 0xe1, 0xdf, 0xff, 0xd0, 0xb0, 0xab, 0xff, 0xc1, 0x91, 0x7c, 0xff, 0xcc, 0xa7, 0x94, 0xff, 0xf5, 0xe7, 0xda, 0xff, 0xf1, 0xe8, 0xd3, 0xff, 0xc8, 0xb1, 0x97, 0xff, 0xd8, 0xae, 0x99, 0xff, 0xab, 0xab, 0xb8, 0xff, 0x8e, 0xb2, 0xdc, 0xff, 0x96, 0xb4, 0xdf, 0xff, 0xa1, 0xb6, 0xda, 0xff, 0x9e, 0xb4, 0xdc, 0xff, 0x9b, 0xb3, 0xdd, 0xff, 0x9d, 0xb3, 0xdb, 0xff, 0x9c, 0xb3, 0xdb, 0xff, 0x9d, 0xb3, 0xdc, 0xff, 0x9e, 0xb4, 0xdd, 0xff, 0x9d, 0xb7, 0xde, 0xff, 0x9c, 0xb9, 0xde, 0xff, 0x9a, 0xb6, 0xdb, 0xff, 0x95, 0xb1, 0xd6, 0xff, 0x96, 0xb2, 0xd8, 0xff, 0x9e, 0xb5, 0xdb, 0xff, 0xa5, 0xb9, 0xdf, 0xff, 0xa8, 0xbc, 0xe0, 0xff, 0xa8, 0xbb, 0xdf, 0xff, 0xaa, 0xbb, 0xdd, 0xff, 0xaa, 0xbb, 0xdd, 0xff, 0xa8, 0xba, 0xde, 0xff, 0xa8, 0xba, 0xdd, 0xff, 0xaa, 0xbb, 0xdf, 0xff, 0xac, 0xbe, 0xe1, 0xff, 0xad, 0xbf, 0xe3, 0xff, 0xac, 0xbf, 0xe4, 0xff, 0xa7, 0xbc, 0xe2, 0xff, 0x9f, 0xb5, 0xdf, 0xff, 0x9a, 0xb1, 0xdf, 0xff, 0x9f, 0xb5, 0xdd, 0xff, 0xaf, 0xbf, 0xe2, 0xff, 0xb2, 0xbf, 0xe4, 0xff, 0xa7, 0xb7, 0xdf, 0xff, 0x9a, 0xb0, 0xd9, 0xff, 0x6e, 0x91, 0xbe, 0xff, 0x2c, 0x53, 0x7d, 0xff, 0x25, 0x42, 0x64, 0xff, 0x1f, 0x34, 0x53, 0xff, 0x13, 0x26, 0x45, 0xff, 0x24, 0x39, 0x54, 0xff, 0x1c, 0x33, 0x49, 0xff, 0x1d, 0x32, 0x4d, 0xff, 0x1c, 0x30, 0x4b, 0xff, 0x1b, 0x2c, 0x4a, 0xff, 0x44, 0x58, 0x76, 0xff, 0x31, 0x48, 0x64, 0xff, 0x23, 0x3a, 0x54, 0xff, 0x2e, 0x45, 0x5f, 0xff, 0x4f, 0x63, 0x81, 0xff, 0x59, 0x76, 0x93, 0xff, 0x30, 0x51, 0x76, 0xff, 0x44, 0x65, 0x95, 0xff, 0x8b, 0xaf, 0xd0, 0xff, 0xf5, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf7, 0xfc, 0xff, 0xc2, 0xc4, 0xcb, 0xff, 0xb6, 0x98, 0x88, 0xff, 0xdc, 0x9e, 0x83, 0xff, 0xc3, 0x93, 0x77, 0xff, 0xb0, 0x9f, 0x85, 0xff, 0xf1, 0xe1, 0xd2, 0xff, 0xf3, 0xd3, 0xc9, 0xff, 0xb3, 0x8f, 0x81, 0xff, 0xcf, 0xae, 0x9e, 0xff, 0xf6, 0xdb, 0xce, 0xff, 0xea, 0xd8, 0xce, 0xff, 0xc6, 0x9f, 0x90, 0xff, 0xc3, 0x9d, 0x8f, 0xff, 0xe4, 0xd1, 0xca, 0xff, 0xfa, 0xf2, 0xe9, 0xff, 0xd8, 0xca, 0xbd, 0xff, 0xb7, 0x97, 0x82, 0xff, 0xc6, 0xa6, 0x8b, 0xff, 0xe4, 0xcc, 0xb6, 0xff, 0xd2, 0xb9, 0xa7, 0xff, 0xdd, 0xb1, 0x98, 0xff, 0xb8, 0xac, 0xa9, 0xff, 0x8b, 0xac, 0xd4, 0xff, 0x8d, 0xaf, 0xe2, 0xff, 0x9e, 0xb0, 0xd8, 0xff, 0x97, 0xad, 0xdb, 0xff, 0x92, 0xac, 0xdc, 0xff, 0x97, 0xaf, 0xda, 0xff, 0x9a, 0xb3, 0xde, 0xff, 0x98, 0xb1, 0xdc, 0xff, 0x99, 0xb1, 0xdd, 0xff, 0x9d, 0xb8, 0xe0, 0xff, 0x9d, 0xb9, 0xdf, 0xff, 0x9c, 0xb7, 0xde, 0xff, 0x9c, 0xb7, 0xde, 0xff, 0x9c, 0xb8, 0xde, 0xff, 0xa3, 0xba, 0xe4, 0xff, 0xab, 0xbe, 0xe7, 0xff, 0xae, 0xc1, 0xe6, 0xff, 0xaf, 0xbf, 0xe5, 0xff, 0xb2, 0xc0, 0xe1, 0xff, 0xb1, 0xbf, 0xe2, 0xff, 0xb0, 0xbf, 0xe4, 0xff, 0xaf, 0xbe, 0xe3, 0xff, 0xae, 0xbe, 0xe2, 0xff, 0xb2, 0xc1, 0xe6, 0xff, 0xb6, 0xc6, 0xe6, 0xff, 0xb2, 0xc5, 0xe3, 0xff, 0xad, 0xc0, 0xe3, 0xff, 0xa6, 0xb9, 0xe3, 0xff, 0xa0, 0xb4, 0xe5, 0xff, 0xa9, 0xba, 0xe3, 0xff, 0xb5, 0xc3, 0xe7, 0xff, 0xb4, 0xc1, 0xea, 0xff, 0xaa, 0xbb, 0xe6, 0xff, 0x97, 0xb2, 0xdc, 0xff, 0x5c, 0x86, 0xb2, 0xff, 0x2a, 0x54, 0x7d, 0xff, 0x25, 0x41, 0x5f, 0xff, 0x13, 0x26, 0x43, 0xff, 0x1d, 0x2e, 0x52, 0xff, 0x2a, 0x41, 0x5c, 0xff, 0x1c, 0x35, 0x49, 0xff, 0x17, 0x2d, 0x47, 0xff, 0x15, 0x29, 0x45, 0xff, 0x34, 0x45, 0x65, 0xff, 0x37, 0x4b, 0x69, 0xff, 0x1d, 0x35, 0x4f, 0xff, 0x35, 0x4a, 0x67, 0xff, 0x3c, 0x51, 0x6e, 0xff, 0x3e, 0x51, 0x6b, 0xff, 0x4d, 0x6c, 0x85, 0xff, 0x4a, 0x68, 0x8d, 0xff, 0x39, 0x57, 0x8a, 0xff, 0x61, 0x8e, 0xb4, 0xff, 0xcc, 0xdb, 0xe3, 0xff, 0xf5, 0xf5, 0xf3, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xfa, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x51, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xf4, 0xf9, 0xff, 0xbb, 0xcc, 0xe3, 0xff, 0x97, 0xb1, 0xd9, 0xff, 0x81, 0xa2, 0xd3, 0xff, 0xb3, 0xa5, 0x9e, 0xff, 0xe1, 0xa8, 0x88, 0xff, 0xd4, 0xa0, 0x84, 0xff, 0xbb, 0x94, 0x79, 0xff, 0xcf, 0x9a, 0x89, 0xff, 0xfe, 0xee, 0xf0, 0xff, 0xde, 0xcf, 0xc3, 0xff, 0xb6, 0x89, 0x66, 0xff, 0xc9, 0x9d, 0x81, 0xff, 0xf3, 0xda, 0xd8, 0xff, 0xff, 0xee, 0xf6, 0xff, 0xcb, 0xa6, 0x9a, 0xff, 0xbd, 0x92, 0x71, 0xff, 0xd7, 0xb9, 0x9d, 0xff, 0xf5, 0xf4, 0xed, 0xff, 0xdc, 0xd8, 0xcb, 0xff, 0xc1, 0x9e, 0x8a, 0xff, 0xd6, 0x9d, 0x8e, 0xff, 0xdd, 0xa8, 0x96, 0xff, 0xd6, 0xb4, 0x98, 0xff, 0xb9, 0xab, 0xa1, 0xff, 0x9d, 0xac, 0xcd, 0xff, 0x92, 0xb0, 0xe4, 0xff, 0x9a, 0xb0, 0xdb, 0xff, 0x95, 0xad, 0xdb, 0xff, 0x90, 0xac, 0xde, 0xff, 0x92, 0xad, 0xdc, 0xff, 0x92, 0xad, 0xdc, 0xff, 0x93, 0xae, 0xdd, 0xff, 0x94, 0xb0, 0xdf, 0xff, 0x9b, 0xb3, 0xe2, 0xff, 0x9e, 0xb4, 0xe2, 0xff, 0x9c, 0xb3, 0xe1, 0xff, 0x9f, 0xb6, 0xe4, 0xff, 0xa0, 0xb7, 0xe6, 0xff, 0xa8, 0xbd, 0xe9, 0xff, 0xb0, 0xc4, 0xea, 0xff, 0xb3, 0xc5, 0xea, 0xff, 0xb3, 0xc4, 0xe8, 0xff, 0xb6, 0xc5, 0xe5, 0xff, 0xb4, 0xc3, 0xe7, 0xff, 0xb4, 0xc4, 0xe8, 0xff, 0xb5, 0xc5, 0xe9, 0xff, 0xb4, 0xc4, 0xe8, 0xff, 0xb6, 0xc6, 0xea, 0xff, 0xb8, 0xca, 0xea, 0xff, 0xb6, 0xc9, 0xe9, 0xff, 0xb1, 0xc5, 0xe9, 0xff, 0xab, 0xbf, 0xe9, 0xff, 0xa7, 0xbb, 0xea, 0xff, 0xa8, 0xbd, 0xe9, 0xff, 0xab, 0xbe, 0xe6, 0xff, 0xad, 0xbc, 0xe9, 0xff, 0xa6, 0xbb, 0xe8, 0xff, 0x8d, 0xac, 0xda, 0xff, 0x53, 0x7a, 0xa8, 0xff, 0x2e, 0x53, 0x7c, 0xff, 0x16, 0x31, 0x50, 0xff, 0x15, 0x2b, 0x49, 0xff, 0x2b, 0x43, 0x64, 0xff, 0x28, 0x3f, 0x5a, 0xff, 0x15, 0x2a, 0x3f, 0xff, 0x0a, 0x1f, 0x39, 0xff, 0x22, 0x37, 0x53, 0xff, 0x41, 0x57, 0x75, 0xff, 0x2e, 0x43, 0x61, 0xff, 0x26, 0x3c, 0x57, 0xff, 0x2e, 0x44, 0x60, 0xff, 0x35, 0x4b, 0x67, 0xff, 0x34, 0x48, 0x64, 0xff, 0x43, 0x61, 0x7b, 0xff, 0x60, 0x7e, 0xa0, 0xff, 0x3c, 0x58, 0x84, 0xff, 0x3c, 0x67, 0x8a, 0xff, 0x97, 0xaf, 0xc4, 0xff, 0xee, 0xe6, 0xe4, 0xff, 0xff, 0xef, 0xe4, 0xff, 0xf0, 0xe7, 0xe3, 0xff, 0xef, 0xea, 0xe8, 0xff, 0xf5, 0xf2, 0xf4, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf8, 0xfd, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfb, 0xff, 0xff, 0xc7, 0xd1, 0xe9, 0xff, 0x9b, 0xad, 0xd0, 0xff, 0x83, 0x9f, 0xcf, 0xff, 0x87, 0xac, 0xe1, 0xff, 0x84, 0xb0, 0xea, 0xff, 0xa9, 0xa1, 0xa0, 0xff, 0xda, 0xa4, 0x88, 0xff, 0xdd, 0xa9, 0x90, 0xff, 0xcd, 0xa2, 0x87, 0xff, 0xc5, 0x89, 0x75, 0xff, 0xc9, 0xae, 0xaa, 0xff, 0xff, 0xfe, 0xf3, 0xff, 0xdf, 0xba, 0xa0, 0xff, 0xb7, 0x8b, 0x70, 0xff, 0xbb, 0x92, 0x81, 0xff, 0xe2, 0xe3, 0xe0, 0xff, 0xf3, 0xf4, 0xe6, 0xff, 0xc5, 0xa1, 0x82, 0xff, 0xc2, 0x8f, 0x75, 0xff, 0xde, 0xad, 0xa2, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe6, 0xd3, 0xc2, 0xff, 0xcb, 0x97, 0x87, 0xff, 0xd2, 0x9f, 0x8b, 0xff, 0xce, 0xab, 0x8e, 0xff, 0xc6, 0xa5, 0x8b, 0xff, 0xbb, 0xb4, 0xc1, 0xff, 0xaa, 0xc0, 0xee, 0xff, 0xa8, 0xbb, 0xe3, 0xff, 0xa6, 0xba, 0xe2, 0xff, 0x9e, 0xb8, 0xe4, 0xff, 0x9d, 0xb7, 0xe2, 0xff, 0x9c, 0xb7, 0xe1, 0xff, 0x9c, 0xb7, 0xe1, 0xff, 0x9c, 0xb7, 0xe1, 0xff, 0xa0, 0xb7, 0xe3, 0xff, 0xa3, 0xb6, 0xe4, 0xff, 0xa2, 0xb6, 0xe4, 0xff, 0xa3, 0xb7, 0xe5, 0xff, 0xa8, 0xbc, 0xea, 0xff, 0xab, 0xc0, 0xeb, 0xff, 0xaf, 0xc3, 0xe9, 0xff, 0xb4, 0xc6, 0xeb, 0xff, 0xb7, 0xc7, 0xec, 0xff, 0xba, 0xc9, 0xe9, 0xff, 0xb7, 0xc7, 0xe9, 0xff, 0xb5, 0xc5, 0xea, 0xff, 0xb8, 0xc8, 0xec, 0xff, 0xb8, 0xc8, 0xec, 0xff, 0xb8, 0xc7, 0xec, 0xff, 0xb8, 0xc9, 0xea, 0xff, 0xb6, 0xc9, 0xe9, 0xff, 0xb3, 0xc7, 0xeb, 0xff, 0xac, 0xc0, 0xea, 0xff, 0xa6, 0xba, 0xe8, 0xff, 0x9e, 0xb5, 0xe4, 0xff, 0x9c, 0xb3, 0xe1, 0xff, 0x9f, 0xb2, 0xe4, 0xff, 0x96, 0xaf, 0xe1, 0xff, 0x7c, 0xa1, 0xd4, 0xff, 0x4b, 0x71, 0xa2, 0xff, 0x2a, 0x49, 0x73, 0xff, 0x18, 0x31, 0x51, 0xff, 0x27, 0x3e, 0x5b, 0xff, 0x25, 0x43, 0x63, 0xff, 0x24, 0x38, 0x53, 0xff, 0x15, 0x22, 0x38, 0xff, 0x16, 0x29, 0x43, 0xff, 0x2b, 0x42, 0x5c, 0xff, 0x3b, 0x55, 0x73, 0xff, 0x30, 0x49, 0x66, 0xff, 0x35, 0x4a, 0x66, 0xff, 0x28, 0x3e, 0x5a, 0xff, 0x2b, 0x41, 0x5d, 0xff, 0x37, 0x4b, 0x66, 0xff, 0x3d, 0x5a, 0x75, 0xff, 0x50, 0x6a, 0x8b, 0xff, 0x5a, 0x71, 0x98, 0xff, 0x21, 0x4c, 0x6e, 0xff, 0x5f, 0x87, 0xa8, 0xff, 0xe2, 0xd6, 0xe0, 0xff, 0xde, 0xb1, 0xa6, 0xff, 0xbb, 0x98, 0x93, 0xff, 0xe4, 0xc3, 0xbe, 0xff, 0xe4, 0xc1, 0xc0, 0xff, 0xd9, 0xb5, 0xa4, 0xff, 0xef, 0xda, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x46, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xee, 0xf3, 0xff, 0x9d, 0xb6, 0xdc, 0xff, 0x7d, 0x9b, 0xd7, 0xff, 0x7f, 0x9e, 0xde, 0xff, 0x89, 0xab, 0xe6, 0xff, 0x95, 0xb5, 0xe7, 0xff, 0x97, 0xb6, 0xde, 0xff, 0xad, 0xa3, 0xa1, 0xff, 0xc6, 0x96, 0x86, 0xff, 0xd4, 0xaa, 0x9a, 0xff, 0xe7, 0xcc, 0xb4, 0xff, 0xc8, 0x9c, 0x87, 0xff, 0xbf, 0x8d, 0x79, 0xff, 0xe0, 0xcb, 0xc0, 0xff, 0xff, 0xf8, 0xfa, 0xff, 0xc1, 0xa4, 0x98, 0xff, 0xc3, 0x94, 0x68, 0xff, 0xc3, 0x9f, 0x84, 0xff, 0xff, 0xf1, 0xea, 0xff, 0xf0, 0xdf, 0xd6, 0xff, 0xbc, 0x99, 0x87, 0xff, 0xc5, 0x97, 0x73, 0xff, 0xd6, 0xbb, 0xa8, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xdc, 0xcb, 0xb6, 0xff, 0xb2, 0x95, 0x7b, 0xff, 0xc9, 0x9c, 0x80, 0xff, 0xe0, 0xa2, 0x79, 0xff, 0xc2, 0xaa, 0xa4, 0xff, 0xb7, 0xc6, 0xee, 0xff, 0xc0, 0xc8, 0xeb, 0xff, 0xbb, 0xca, 0xe8, 0xff, 0xaf, 0xc6, 0xea, 0xff, 0xaf, 0xc3, 0xe7, 0xff, 0xaf, 0xc4, 0xe8, 0xff, 0xad, 0xc1, 0xe4, 0xff, 0xa9, 0xbd, 0xe0, 0xff, 0xa8, 0xbd, 0xe3, 0xff, 0xa8, 0xbe, 0xe6, 0xff, 0xa8, 0xbe, 0xe5, 0xff, 0xa7, 0xbd, 0xe4, 0xff, 0xa9, 0xc0, 0xe6, 0xff, 0xac, 0xc1, 0xea, 0xff, 0xad, 0xc2, 0xea, 0xff, 0xb2, 0xc4, 0xe9, 0xff, 0xb7, 0xc7, 0xeb, 0xff, 0xbb, 0xc9, 0xe8, 0xff, 0xb9, 0xc9, 0xea, 0xff, 0xb8, 0xc8, 0xec, 0xff, 0xba, 0xc9, 0xec, 0xff, 0xb9, 0xc9, 0xec, 0xff, 0xb9, 0xc8, 0xec, 0xff, 0xb8, 0xc9, 0xe8, 0xff, 0xb5, 0xc8, 0xe7, 0xff, 0xb1, 0xc5, 0xe9, 0xff, 0xa9, 0xbe, 0xe7, 0xff, 0xa4, 0xb8, 0xe5, 0xff, 0x9a, 0xb4, 0xe2, 0xff, 0x97, 0xb1, 0xe3, 0xff, 0x9a, 0xb0, 0xe6, 0xff, 0x8d, 0xa8, 0xe1, 0xff, 0x73, 0x9c, 0xd5, 0xff, 0x4b, 0x71, 0xa5, 0xff, 0x23, 0x3d, 0x67, 0xff, 0x1f, 0x35, 0x55, 0xff, 0x35, 0x4c, 0x69, 0xff, 0x24, 0x47, 0x67, 0xff, 0x23, 0x39, 0x54, 0xff, 0x0d, 0x15, 0x2d, 0xff, 0x18, 0x2a, 0x44, 0xff, 0x34, 0x4d, 0x66, 0xff, 0x3b, 0x5b, 0x77, 0xff, 0x2e, 0x49, 0x66, 0xff, 0x2b, 0x40, 0x5c, 0xff, 0x2c, 0x41, 0x5d, 0xff, 0x34, 0x4a, 0x65, 0xff, 0x33, 0x47, 0x64, 0xff, 0x34, 0x53, 0x6d, 0xff, 0x36, 0x4f, 0x6c, 0xff, 0x5d, 0x70, 0x95, 0xff, 0x36, 0x63, 0x86, 0xff, 0x1f, 0x4b, 0x76, 0xff, 0x90, 0x8e, 0xa0, 0xff, 0xc8, 0xad, 0xa1, 0xff, 0xe2, 0xce, 0xc6, 0xff, 0xf6, 0xe0, 0xd3, 0xff, 0xcb, 0xac, 0x96, 0xff, 0xcf, 0xa9, 0x8f, 0xff, 0xc6, 0xaa, 0xa3, 0xff, 0xc3, 0xca, 0xdf, 0xff, 0xca, 0xdf, 0xf2, 0xff, 0xee, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfd, 0xb4, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xe1, 0xf2, 0xff, 0x91, 0xa7, 0xd4, 0xff, 0x7a, 0x9b, 0xda, 0xff, 0x81, 0xa5, 0xe2, 0xff, 0x86, 0xaa, 0xe3, 0xff, 0x8c, 0xae, 0xe3, 0xff, 0x94, 0xb2, 0xe1, 0xff, 0x97, 0xb6, 0xe2, 0xff, 0xa6, 0xa6, 0xb0, 0xff, 0xc2, 0x9b, 0x82, 0xff, 0xcc, 0x9c, 0x7d, 0xff, 0xfc, 0xe8, 0xd6, 0xff, 0xda, 0xcd, 0xc6, 0xff, 0xba, 0x90, 0x70, 0xff, 0xce, 0x93, 0x80, 0xff, 0xf8, 0xdc, 0xe5, 0xff, 0xf2, 0xed, 0xe8, 0xff, 0xc5, 0x9e, 0x7c, 0xff, 0xc9, 0x91, 0x6a, 0xff, 0xd9, 0xa6, 0x9c, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xc9, 0xd1, 0xc8, 0xff, 0xbc, 0x9b, 0x6f, 0xff, 0xcf, 0x95, 0x7c, 0xff, 0xdd, 0xc5, 0xbb, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xcb, 0xc3, 0xae, 0xff, 0xbf, 0x89, 0x73, 0xff, 0xdc, 0x9e, 0x73, 0xff, 0xc7, 0x9a, 0x87, 0xff, 0xba, 0xb8, 0xce, 0xff, 0xb4, 0xd5, 0xef, 0xff, 0xc6, 0xcc, 0xe4, 0xff, 0xc6, 0xca, 0xe7, 0xff, 0xb7, 0xca, 0xe8, 0xff, 0xb8, 0xc7, 0xe6, 0xff, 0xb8, 0xc5, 0xe7, 0xff, 0xb7, 0xc4, 0xe7, 0xff, 0xb2, 0xc3, 0xe6, 0xff, 0xaf, 0xc2, 0xe5, 0xff, 0xb0, 0xc3, 0xe6, 0xff, 0xb2, 0xc4, 0xe8, 0xff, 0xb3, 0xc6, 0xe9, 0xff, 0xb5, 0xc6, 0xeb, 0xff, 0xb1, 0xc2, 0xe8, 0xff, 0xb0, 0xc1, 0xe7, 0xff, 0xb3, 0xc4, 0xec, 0xff, 0xb2, 0xc3, 0xeb, 0xff, 0xb1, 0xc2, 0xe9, 0xff, 0xb4, 0xc7, 0xee, 0xff, 0xb6, 0xc8, 0xef, 0xff, 0xb1, 0xc4, 0xea, 0xff, 0xb2, 0xc5, 0xec, 0xff, 0xb4, 0xc6, 0xea, 0xff, 0xb2, 0xc4, 0xea, 0xff, 0xae, 0xbf, 0xe9, 0xff, 0xaa, 0xbb, 0xea, 0xff, 0xa9, 0xb7, 0xe9, 0xff, 0x99, 0xb1, 0xe8, 0xff, 0x93, 0xb0, 0xe6, 0xff, 0x9a, 0xb1, 0xe2, 0xff, 0x97, 0xb2, 0xe1, 0xff, 0x7e, 0xa1, 0xd5, 0xff, 0x46, 0x65, 0x96, 0xff, 0x18, 0x32, 0x5b, 0xff, 0x11, 0x32, 0x54, 0xff, 0x33, 0x52, 0x70, 0xff, 0x36, 0x50, 0x6f, 0xff, 0x14, 0x23, 0x3b, 0xff, 0x03, 0x0d, 0x21, 0xff, 0x1d, 0x2e, 0x48, 0xff, 0x3b, 0x52, 0x70, 0xff, 0x3f, 0x5c, 0x7f, 0xff, 0x2d, 0x44, 0x62, 0xff, 0x23, 0x37, 0x51, 0xff, 0x2d, 0x44, 0x63, 0xff, 0x35, 0x4d, 0x6c, 0xff, 0x33, 0x47, 0x62, 0xff, 0x30, 0x47, 0x61, 0xff, 0x2c, 0x43, 0x62, 0xff, 0x45, 0x5c, 0x7e, 0xff, 0x50, 0x72, 0x96, 0xff, 0x29, 0x4e, 0x77, 0xff, 0x35, 0x52, 0x71, 0xff, 0xb3, 0xbf, 0xc9, 0xff, 0xff, 0xfd, 0xf7, 0xff, 0xcb, 0xac, 0x97, 0xff, 0xc1, 0xa1, 0x85, 0xff, 0xd6, 0xb7, 0xa0, 0xff, 0xb5, 0xab, 0xb8, 0xff, 0x86, 0xa2, 0xd9, 0xff, 0x83, 0xa5, 0xe0, 0xff, 0x9d, 0xb6, 0xdd, 0xff, 0xc7, 0xd4, 0xee, 0xff, 0xf2, 0xf3, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xdc, 0xe9, 0xff, 0x8b, 0xa2, 0xcc, 0xff, 0x81, 0x9f, 0xdb, 0xff, 0x89, 0xa6, 0xe8, 0xff, 0x8c, 0xad, 0xe0, 0xff, 0x8e, 0xb0, 0xdc, 0xff, 0x93, 0xb2, 0xdf, 0xff, 0x96, 0xb5, 0xe2, 0xff, 0x97, 0xba, 0xee, 0xff, 0xa0, 0xa7, 0xbb, 0xff, 0xc4, 0xa0, 0x80, 0xff, 0xd1, 0x9a, 0x6f, 0xff, 0xd8, 0xb6, 0xa7, 0xff, 0xff, 0xfa, 0xf9, 0xff, 0xc6, 0xb5, 0x9d, 0xff, 0xcb, 0x8d, 0x76, 0xff, 0xcf, 0x9a, 0x8d, 0xff, 0xfc, 0xf7, 0xe8, 0xff, 0xe9, 0xd6, 0xcb, 0xff, 0xb9, 0x97, 0x7a, 0xff, 0xc7, 0x92, 0x7d, 0xff, 0xde, 0xbd, 0xb9, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xd7, 0xbc, 0xa8, 0xff, 0xcf, 0x92, 0x7a, 0xff, 0xbf, 0x99, 0x84, 0xff, 0xdc, 0xd0, 0xc4, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xcd, 0xb0, 0xa0, 0xff, 0xb2, 0x8c, 0x6f, 0xff, 0xd5, 0x9d, 0x83, 0xff, 0xc1, 0xa6, 0x9d, 0xff, 0xae, 0xcf, 0xda, 0xff, 0xc0, 0xca, 0xeb, 0xff, 0xc5, 0xc7, 0xe8, 0xff, 0xbb, 0xcc, 0xe6, 0xff, 0xbb, 0xc7, 0xe6, 0xff, 0xbb, 0xc5, 0xe9, 0xff, 0xbd, 0xc7, 0xec, 0xff, 0xb8, 0xc5, 0xe9, 0xff, 0xb4, 0xc3, 0xe7, 0xff, 0xb5, 0xc4, 0xe8, 0xff, 0xb8, 0xc6, 0xea, 0xff, 0xb9, 0xc8, 0xec, 0xff, 0xbd, 0xca, 0xee, 0xff, 0xb9, 0xc6, 0xea, 0xff, 0xb0, 0xc0, 0xe7, 0xff, 0xae, 0xc0, 0xea, 0xff, 0xac, 0xc0, 0xec, 0xff, 0xaa, 0xbe, 0xea, 0xff, 0xab, 0xbf, 0xe9, 0xff, 0xac, 0xc0, 0xea, 0xff, 0xac, 0xc0, 0xeb, 0xff, 0xae, 0xc3, 0xed, 0xff, 0xaf, 0xc3, 0xeb, 0xff, 0xad, 0xbf, 0xe9, 0xff, 0xac, 0xbc, 0xea, 0xff, 0xb1, 0xc0, 0xf0, 0xff, 0xb2, 0xbd, 0xf0, 0xff, 0xa0, 0xb6, 0xed, 0xff, 0x98, 0xb4, 0xe8, 0xff, 0xa0, 0xb6, 0xe2, 0xff, 0xa2, 0xba, 0xe4, 0xff, 0x81, 0xa0, 0xd1, 0xff, 0x42, 0x5d, 0x8b, 0xff, 0x17, 0x33, 0x59, 0xff, 0x14, 0x3b, 0x5d, 0xff, 0x36, 0x57, 0x75, 0xff, 0x25, 0x36, 0x53, 0xff, 0x06, 0x10, 0x27, 0xff, 0x0d, 0x1c, 0x2e, 0xff, 0x26, 0x37, 0x51, 0xff, 0x43, 0x58, 0x7a, 0xff, 0x38, 0x51, 0x79, 0xff, 0x2c, 0x41, 0x5f, 0xff, 0x27, 0x3c, 0x53, 0xff, 0x32, 0x4b, 0x6d, 0xff, 0x31, 0x4b, 0x6d, 0xff, 0x36, 0x4a, 0x63, 0xff, 0x21, 0x32, 0x4e, 0xff, 0x34, 0x48, 0x69, 0xff, 0x3c, 0x55, 0x75, 0xff, 0x4b, 0x65, 0x88, 0xff, 0x3b, 0x5a, 0x7e, 0xff, 0x1a, 0x46, 0x6e, 0xff, 0x59, 0x77, 0x96, 0xff, 0xbe, 0xb2, 0xb5, 0xff, 0xcc, 0xa3, 0x92, 0xff, 0xd6, 0xa9, 0x90, 0xff, 0xd9, 0xb1, 0x98, 0xff, 0xb6, 0xaf, 0xbd, 0xff, 0x90, 0xb0, 0xee, 0xff, 0x90, 0xb0, 0xec, 0xff, 0x90, 0xab, 0xdd, 0xff, 0x8b, 0xa5, 0xd9, 0xff, 0xa4, 0xb2, 0xdc, 0xff, 0xd5, 0xd9, 0xe9, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfe, 0xfc, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfa, 0xff, 0xff, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xe0, 0xf3, 0xff, 0x86, 0xa0, 0xc8, 0xff, 0x83, 0xa1, 0xd0, 0xff, 0x8d, 0xaa, 0xdf, 0xff, 0x93, 0xac, 0xe1, 0xff, 0x94, 0xb0, 0xe0, 0xff, 0x96, 0xb4, 0xe0, 0xff, 0x9b, 0xb7, 0xe2, 0xff, 0x9f, 0xba, 0xe3, 0xff, 0xa3, 0xc1, 0xed, 0xff, 0xa7, 0xaf, 0xc5, 0xff, 0xbf, 0x9b, 0x86, 0xff, 0xd3, 0x9d, 0x76, 0xff, 0xb4, 0x8c, 0x78, 0xff, 0xec, 0xd8, 0xcc, 0xff, 0xfd, 0xf8, 0xf0, 0xff, 0xc1, 0xa2, 0x8f, 0xff, 0xc3, 0x90, 0x6d, 0xff, 0xd4, 0xb5, 0x98, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xd0, 0xc0, 0xb8, 0xff, 0xbf, 0x94, 0x7c, 0xff, 0xcf, 0x9c, 0x78, 0xff, 0xf0, 0xd5, 0xbc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xc8, 0xb0, 0x9e, 0xff, 0xc7, 0x99, 0x7d, 0xff, 0xcc, 0x99, 0x8c, 0xff, 0xef, 0xd4, 0xc8, 0xff, 0xfc, 0xff, 0xf4, 0xff, 0xba, 0xaa, 0x9b, 0xff, 0xc5, 0x93, 0x79, 0xff, 0xd0, 0xa1, 0x7c, 0xff, 0xc9, 0xbc, 0xb3, 0xff, 0xba, 0xcb, 0xf7, 0xff, 0xb5, 0xc6, 0xf0, 0xff, 0xbe, 0xcb, 0xe4, 0xff, 0xba, 0xc7, 0xe7, 0xff, 0xba, 0xc6, 0xe9, 0xff, 0xbc, 0xc7, 0xeb, 0xff, 0xb8, 0xc6, 0xea, 0xff, 0xb5, 0xc7, 0xeb, 0xff, 0xb7, 0xc7, 0xeb, 0xff, 0xb8, 0xc8, 0xec, 0xff, 0xb9, 0xc9, 0xed, 0xff, 0xba, 0xc8, 0xed, 0xff, 0xbb, 0xc9, 0xee, 0xff, 0xb5, 0xc6, 0xed, 0xff, 0xb1, 0xc2, 0xec, 0xff, 0xaf, 0xc3, 0xed, 0xff, 0xad, 0xc0, 0xec, 0xff, 0xaa, 0xbd, 0xe8, 0xff, 0xab, 0xbe, 0xe9, 0xff, 0xad, 0xc0, 0xeb, 0xff, 0xad, 0xc0, 0xec, 0xff, 0xae, 0xc1, 0xeb, 0xff, 0xae, 0xc0, 0xe9, 0xff, 0xb0, 0xc1, 0xec, 0xff, 0xb3, 0xc4, 0xf0, 0xff, 0xb3, 0xc3, 0xee, 0xff, 0xa7, 0xbc, 0xea, 0xff, 0xa1, 0xb8, 0xe7, 0xff, 0xa7, 0xba, 0xe5, 0xff, 0xab, 0xc2, 0xee, 0xff, 0x78, 0x99, 0xcd, 0xff, 0x2d, 0x4d, 0x7b, 0xff, 0x05, 0x21, 0x44, 0xff, 0x24, 0x40, 0x62, 0xff, 0x32, 0x4c, 0x69, 0xff, 0x04, 0x16, 0x30, 0xff, 0x0b, 0x1a, 0x34, 0xff, 0x0d, 0x1e, 0x39, 0xff, 0x27, 0x3a, 0x57, 0xff, 0x49, 0x5f, 0x80, 0xff, 0x36, 0x4f, 0x74, 0xff, 0x27, 0x3d, 0x5b, 0xff, 0x2a, 0x40, 0x5a, 0xff, 0x37, 0x53, 0x75, 0xff, 0x38, 0x54, 0x76, 0xff, 0x2e, 0x45, 0x60, 0xff, 0x1a, 0x2e, 0x49, 0xff, 0x2e, 0x41, 0x5e, 0xff, 0x3c, 0x52, 0x71, 0xff, 0x2d, 0x49, 0x6a, 0xff, 0x3f, 0x5d, 0x7f, 0xff, 0x27, 0x4d, 0x73, 0xff, 0x24, 0x45, 0x6b, 0xff, 0x60, 0x67, 0x7a, 0xff, 0xbc, 0xa7, 0xa4, 0xff, 0xd6, 0xa8, 0x8f, 0xff, 0xe2, 0xb3, 0x93, 0xff, 0xbf, 0xb3, 0xbb, 0xff, 0x96, 0xb1, 0xe9, 0xff, 0x91, 0xb1, 0xe9, 0xff, 0x9a, 0xb1, 0xdc, 0xff, 0x93, 0xaf, 0xe4, 0xff, 0x8b, 0xaa, 0xe3, 0xff, 0x96, 0xaa, 0xd1, 0xff, 0xbd, 0xc7, 0xdd, 0xff, 0xee, 0xf4, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x09, 0xff, 0xff, 0xfa, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xf3, 0xf9, 0xff, 0x91, 0xa9, 0xd2, 0xff, 0x84, 0xa3, 0xd7, 0xff, 0x8a, 0xab, 0xe0, 0xff, 0x8d, 0xab, 0xde, 0xff, 0x97, 0xb0, 0xdd, 0xff, 0x9b, 0xb4, 0xde, 0xff, 0x9e, 0xb8, 0xe0, 0xff, 0xa5, 0xbc, 0xe3, 0xff, 0xa7, 0xbe, 0xe2, 0xff, 0xac, 0xc6, 0xec, 0xff, 0xaa, 0xb3, 0xcf, 0xff, 0xb7, 0x96, 0x88, 0xff, 0xd6, 0x9e, 0x79, 0xff, 0xc4, 0x9a, 0x82, 0xff, 0xbe, 0x9c, 0x89, 0xff, 0xfe, 0xef, 0xe7, 0xff, 0xee, 0xe2, 0xd2, 0xff, 0xc2, 0x99, 0x78, 0xff, 0xc3, 0x90, 0x75, 0xff, 0xde, 0xcb, 0xbf, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xca, 0xb3, 0x9e, 0xff, 0xcb, 0x9a, 0x76, 0xff, 0xd1, 0x9a, 0x82, 0xff, 0xeb, 0xde, 0xdd, 0xff, 0xff, 0xfb, 0xee, 0xff, 0xcd, 0xa8, 0x92, 0xff, 0xcf, 0x98, 0x87, 0xff, 0xc6, 0x9a, 0x8a, 0xff, 0xe5, 0xe0, 0xd1, 0xff, 0xf9, 0xef, 0xe8, 0xff, 0xb8, 0x96, 0x7e, 0xff, 0xd0, 0x9c, 0x72, 0xff, 0xd4, 0xa3, 0x90, 0xff, 0xc3, 0xc1, 0xd8, 0xff, 0xbb, 0xce, 0xf0, 0xff, 0xbb, 0xca, 0xe6, 0xff, 0xbc, 0xc9, 0xe9, 0xff, 0xba, 0xc6, 0xe9, 0xff, 0xba, 0xc6, 0xea, 0xff, 0xb8, 0xc6, 0xea, 0xff, 0xb7, 0xc7, 0xeb, 0xff, 0xb9, 0xc9, 0xed, 0xff, 0xba, 0xca, 0xee, 0xff, 0xba, 0xca, 0xee, 0xff, 0xbb, 0xc9, 0xee, 0xff, 0xba, 0xc8, 0xed, 0xff, 0xb7, 0xc7, 0xee, 0xff, 0xb3, 0xc4, 0xee, 0xff, 0xb0, 0xc3, 0xed, 0xff, 0xae, 0xc1, 0xee, 0xff, 0xad, 0xc0, 0xee, 0xff, 0xad, 0xc0, 0xee, 0xff, 0xad, 0xc0, 0xed, 0xff, 0xac, 0xbe, 0xed, 0xff, 0xaf, 0xc0, 0xec, 0xff, 0xb1, 0xc2, 0xec, 0xff, 0xb3, 0xc5, 0xed, 0xff, 0xb1, 0xc4, 0xeb, 0xff, 0xb3, 0xc7, 0xec, 0xff, 0xac, 0xbf, 0xe8, 0xff, 0xab, 0xbc, 0xe7, 0xff, 0xb2, 0xc3, 0xe9, 0xff, 0xad, 0xc4, 0xee, 0xff, 0x63, 0x85, 0xbc, 0xff, 0x21, 0x46, 0x72, 0xff, 0x1a, 0x37, 0x57, 0xff, 0x36, 0x4a, 0x6b, 0xff, 0x1a, 0x2c, 0x48, 0xff, 0x06, 0x1a, 0x30, 0xff, 0x16, 0x2d, 0x48, 0xff, 0x0f, 0x24, 0x47, 0xff, 0x1f, 0x34, 0x56, 0xff, 0x42, 0x58, 0x7a, 0xff, 0x37, 0x4e, 0x72, 0xff, 0x2a, 0x40, 0x5e, 0xff, 0x30, 0x48, 0x67, 0xff, 0x3c, 0x59, 0x7e, 0xff, 0x30, 0x4e, 0x72, 0xff, 0x2a, 0x44, 0x64, 0xff, 0x20, 0x33, 0x4e, 0xff, 0x23, 0x34, 0x4e, 0xff, 0x3f, 0x54, 0x70, 0xff, 0x25, 0x3f, 0x5e, 0xff, 0x31, 0x4f, 0x6e, 0xff, 0x2d, 0x49, 0x6b, 0xff, 0x27, 0x44, 0x6a, 0xff, 0x25, 0x3e, 0x62, 0xff, 0x8c, 0x8d, 0x9e, 0xff, 0xe3, 0xbd, 0xb1, 0xff, 0xdc, 0xa7, 0x87, 0xff, 0xc4, 0xb2, 0xb0, 0xff, 0x98, 0xb2, 0xe4, 0xff, 0x91, 0xb0, 0xe7, 0xff, 0x9a, 0xb2, 0xde, 0xff, 0x93, 0xb1, 0xe5, 0xff, 0x8d, 0xb0, 0xea, 0xff, 0x8f, 0xad, 0xe2, 0xff, 0x92, 0xa9, 0xd6, 0xff, 0xa8, 0xba, 0xdc, 0xff, 0xe5, 0xec, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xfd, 0xfd, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfb, 0x41, 0xff, 0xff, 0xff, 0xfe, 0xba, 0xca, 0xdb, 0xff, 0x94, 0xa8, 0xcd, 0xff, 0x98, 0xaf, 0xde, 0xff, 0x90, 0xb0, 0xe3, 0xff, 0x8f, 0xaf, 0xdf, 0xff, 0x97, 0xb3, 0xdf, 0xff, 0xa1, 0xb9, 0xe0, 0xff, 0xa7, 0xbe, 0xe2, 0xff, 0xac, 0xc1, 0xe4, 0xff, 0xae, 0xc2, 0xe2, 0xff, 0xb1, 0xc8, 0xea, 0xff, 0xaf, 0xba, 0xd9, 0xff, 0xb8, 0x9a, 0x92, 0xff, 0xd3, 0x9b, 0x75, 0xff, 0xcc, 0x9c, 0x82, 0xff, 0xc0, 0x97, 0x7f, 0xff, 0xd1, 0xaa, 0x96, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xda, 0xc5, 0xbc, 0xff, 0xd2, 0x8d, 0x83, 0xff, 0xca, 0x9c, 0x7e, 0xff, 0xed, 0xe3, 0xd2, 0xff, 0xf7, 0xfc, 0xf1, 0xff, 0xc3, 0xa2, 0x94, 0xff, 0xdb, 0x90, 0x80, 0xff, 0xc5, 0xa3, 0x84, 0xff, 0xe9, 0xee, 0xe4, 0xff, 0xfb, 0xef, 0xea, 0xff, 0xc7, 0xa6, 0x8b, 0xff, 0xcb, 0xa0, 0x82, 0xff, 0xcd, 0x9e, 0x8a, 0xff, 0xff, 0xe1, 0xdb, 0xff, 0xe5, 0xdc, 0xca, 0xff, 0xb6, 0x8e, 0x74, 0xff, 0xe0, 0x93, 0x84, 0xff, 0xcc, 0xaa, 0x9e, 0xff, 0xb8, 0xcd, 0xe3, 0xff, 0xb4, 0xca, 0xf0, 0xff, 0xba, 0xc6, 0xe5, 0xff, 0xbe, 0xc8, 0xeb, 0xff, 0xbc, 0xc7, 0xed, 0xff, 0xb8, 0xc6, 0xeb, 0xff, 0xb7, 0xc7, 0xeb, 0xff, 0xb8, 0xca, 0xee, 0xff, 0xb9, 0xca, 0xef, 0xff, 0xba, 0xca, 0xef, 0xff, 0xbc, 0xc9, 0xef, 0xff, 0xba, 0xc8, 0xed, 0xff, 0xb5, 0xc5, 0xed, 0xff, 0xb4, 0xc6, 0xf0, 0xff, 0xb1, 0xc5, 0xee, 0xff, 0xaf, 0xc1, 0xf0, 0xff, 0xaf, 0xc0, 0xf1, 0xff, 0xaf, 0xc0, 0xf1, 0xff, 0xad, 0xbe, 0xef, 0xff, 0xac, 0xbd, 0xee, 0xff, 0xb0, 0xbf, 0xf0, 0xff, 0xb2, 0xc3, 0xef, 0xff, 0xb3, 0xc7, 0xed, 0xff, 0xb1, 0xc5, 0xe8, 0xff, 0xb1, 0xc7, 0xe6, 0xff, 0xb1, 0xc2, 0xe7, 0xff, 0xb5, 0xc1, 0xe8, 0xff, 0xb6, 0xc7, 0xe9, 0xff, 0xa7, 0xbf, 0xe7, 0xff, 0x4e, 0x72, 0xa8, 0xff, 0x1c, 0x44, 0x70, 0xff, 0x2c, 0x4a, 0x69, 0xff, 0x19, 0x29, 0x4a, 0xff, 0x10, 0x1b, 0x37, 0xff, 0x14, 0x2a, 0x3c, 0xff, 0x15, 0x30, 0x4c, 0xff, 0x15, 0x2d, 0x55, 0xff, 0x1d, 0x36, 0x5b, 0xff, 0x3b, 0x53, 0x76, 0xff, 0x33, 0x48, 0x69, 0xff, 0x38, 0x4f, 0x6c, 0xff, 0x3e, 0x57, 0x78, 0xff, 0x2e, 0x4b, 0x72, 0xff, 0x2a, 0x49, 0x6f, 0xff, 0x29, 0x46, 0x67, 0xff, 0x21, 0x33, 0x4e, 0xff, 0x21, 0x2e, 0x47, 0xff, 0x3e, 0x51, 0x6c, 0xff, 0x2f, 0x48, 0x65, 0xff, 0x27, 0x47, 0x67, 0xff, 0x30, 0x42, 0x5d, 0xff, 0x2a, 0x3c, 0x5a, 0xff, 0x07, 0x2f, 0x5d, 0xff, 0x3b, 0x50, 0x73, 0xff, 0xbf, 0xa1, 0xa5, 0xff, 0xeb, 0xb1, 0x94, 0xff, 0xc3, 0xaf, 0xa5, 0xff, 0x99, 0xb0, 0xe0, 0xff, 0x96, 0xb2, 0xea, 0xff, 0x97, 0xb4, 0xe4, 0xff, 0x9c, 0xb4, 0xe0, 0xff, 0x99, 0xb2, 0xe0, 0xff, 0x8d, 0xae, 0xe6, 0xff, 0x8d, 0xad, 0xe7, 0xff, 0x94, 0xab, 0xde, 0xff, 0xa2, 0xb4, 0xdb, 0xff, 0xda, 0xe8, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xed, 0xf4, 0x8f, 0x9c, 0xae, 0xcd, 0xff, 0x9d, 0xb3, 0xdc, 0xff, 0x9b, 0xb2, 0xde, 0xff, 0x98, 0xb1, 0xdf, 0xff, 0x97, 0xb2, 0xdf, 0xff, 0x9a, 0xb4, 0xe1, 0xff, 0xa5, 0xbc, 0xe2, 0xff, 0xac, 0xc1, 0xe4, 0xff, 0xaf, 0xc3, 0xe6, 0xff, 0xb1, 0xc4, 0xe5, 0xff, 0xb5, 0xcb, 0xec, 0xff, 0xb7, 0xbf, 0xdf, 0xff, 0xb7, 0x96, 0x92, 0xff, 0xd0, 0x98, 0x76, 0xff, 0xd1, 0xa3, 0x88, 0xff, 0xca, 0xa3, 0x85, 0xff, 0xc3, 0x93, 0x74, 0xff, 0xdb, 0xc3, 0xb6, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xd5, 0xac, 0xa7, 0xff, 0xd1, 0x95, 0x73, 0xff, 0xc8, 0xa2, 0x84, 0xff, 0xf7, 0xf4, 0xe9, 0xff, 0xef, 0xe7, 0xe6, 0xff, 0xc5, 0x9b, 0x91, 0xff, 0xd3, 0x9d, 0x77, 0xff, 0xc7, 0xa7, 0x8e, 0xff, 0xfe, 0xf5, 0xed, 0xff, 0xf0, 0xeb, 0xdf, 0xff, 0xbc, 0xa0, 0x8e, 0xff, 0xdb, 0x9d, 0x80, 0xff, 0xd2, 0xa3, 0x8e, 0xff, 0xfc, 0xf4, 0xe7, 0xff, 0xd9, 0xca, 0xbe, 0xff, 0xb5, 0x86, 0x76, 0xff, 0xd7, 0x9e, 0x7b, 0xff, 0xc4, 0xae, 0xac, 0xff, 0xc2, 0xcb, 0xea, 0xff, 0xb3, 0xca, 0xef, 0xff, 0xaf, 0xc8, 0xf0, 0xff, 0xc1, 0xca, 0xe8, 0xff, 0xb9, 0xc9, 0xe9, 0xff, 0xb4, 0xc5, 0xea, 0xff, 0xbe, 0xc6, 0xea, 0xff, 0xc0, 0xc9, 0xeb, 0xff, 0xb9, 0xca, 0xea, 0xff, 0xb9, 0xca, 0xed, 0xff, 0xbb, 0xca, 0xef, 0xff, 0xb9, 0xc9, 0xef, 0xff, 0xb7, 0xc6, 0xf0, 0xff, 0xb4, 0xc2, 0xee, 0xff, 0xaf, 0xc0, 0xee, 0xff, 0xae, 0xc0, 0xee, 0xff, 0xae, 0xc0, 0xee, 0xff, 0xad, 0xbf, 0xed, 0xff, 0xac, 0xbe, 0xed, 0xff, 0xb1, 0xc2, 0xed, 0xff, 0xb4, 0xc6, 0xed, 0xff, 0xb4, 0xc6, 0xec, 0xff, 0xb2, 0xc5, 0xe9, 0xff, 0xb1, 0xc6, 0xe8, 0xff, 0xb6, 0xc8, 0xe9, 0xff, 0xba, 0xc7, 0xe9, 0xff, 0xb9, 0xc5, 0xeb, 0xff, 0xa6, 0xb6, 0xe5, 0xff, 0x50, 0x6d, 0xa8, 0xff, 0x22, 0x42, 0x6f, 0xff, 0x19, 0x30, 0x4b, 0xff, 0x0a, 0x16, 0x2f, 0xff, 0x04, 0x0c, 0x20, 0xff, 0x1a, 0x28, 0x38, 0xff, 0x25, 0x3e, 0x5c, 0xff, 0x23, 0x42, 0x68, 0xff, 0x22, 0x3b, 0x5b, 0xff, 0x3c, 0x53, 0x72, 0xff, 0x34, 0x4b, 0x6d, 0xff, 0x39, 0x54, 0x72, 0xff, 0x2f, 0x4b, 0x6a, 0xff, 0x28, 0x49, 0x6f, 0xff, 0x35, 0x52, 0x78, 0xff, 0x22, 0x37, 0x58, 0xff, 0x20, 0x32, 0x4e, 0xff, 0x21, 0x34, 0x4e, 0xff, 0x2d, 0x42, 0x5d, 0xff, 0x2b, 0x42, 0x5e, 0xff, 0x34, 0x4d, 0x6b, 0xff, 0x2e, 0x46, 0x5c, 0xff, 0x20, 0x3b, 0x52, 0xff, 0x0e, 0x2e, 0x54, 0xff, 0x17, 0x2a, 0x4c, 0xff, 0x6c, 0x68, 0x7f, 0xff, 0xd4, 0xb8, 0x9c, 0xff, 0xd3, 0xb0, 0xa4, 0xff, 0xa0, 0xb6, 0xee, 0xff, 0x98, 0xbd, 0xeb, 0xff, 0xa5, 0xb8, 0xe4, 0xff, 0x9d, 0xb8, 0xe7, 0xff, 0xa3, 0xb7, 0xe2, 0xff, 0x9a, 0xb4, 0xe7, 0xff, 0x94, 0xb0, 0xe7, 0xff, 0x95, 0xaf, 0xe6, 0xff, 0x8e, 0xaa, 0xe0, 0xff, 0x95, 0xae, 0xdb, 0xff, 0xdb, 0xe8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xda, 0xda, 0x07, 0x96, 0xaa, 0xcf, 0xd1, 0x99, 0xb3, 0xe1, 0xff, 0x99, 0xb2, 0xdf, 0xff, 0x98, 0xaf, 0xdb, 0xff, 0x99, 0xb0, 0xdc, 0xff, 0x9a, 0xb3, 0xdf, 0xff, 0xa2, 0xb8, 0xe1, 0xff, 0xa7, 0xbc, 0xe2, 0xff, 0xac, 0xbf, 0xe4, 0xff, 0xb1, 0xc4, 0xe7, 0xff, 0xb3, 0xc9, 0xed, 0xff, 0xba, 0xc0, 0xe0, 0xff, 0xb7, 0x95, 0x90, 0xff, 0xc2, 0x8b, 0x6e, 0xff, 0xe8, 0xc4, 0xb0, 0xff, 0xdd, 0xc6, 0xb0, 0xff, 0xc9, 0x96, 0x79, 0xff, 0xc4, 0x95, 0x83, 0xff, 0xee, 0xe1, 0xdc, 0xff, 0xf6, 0xed, 0xe5, 0xff, 0xc9, 0x9e, 0x89, 0xff, 0xcf, 0x9b, 0x79, 0xff, 0xcd, 0xad, 0x97, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xe2, 0xdd, 0xd6, 0xff, 0xc7, 0x9b, 0x86, 0xff, 0xd5, 0x9e, 0x7a, 0xff, 0xce, 0xaf, 0x98, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xe5, 0xdb, 0xd7, 0xff, 0xc5, 0x9c, 0x84, 0xff, 0xc7, 0x9a, 0x7d, 0xff, 0xd1, 0xb2, 0xa0, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xc4, 0xb7, 0xa5, 0xff, 0xba, 0x8c, 0x6f, 0xff, 0xd8, 0xa1, 0x88, 0xff, 0xcc, 0xb4, 0xb4, 0xff, 0xbd, 0xcd, 0xeb, 0xff, 0xad, 0xcc, 0xf6, 0xff, 0xb7, 0xc6, 0xeb, 0xff, 0xb7, 0xc9, 0xea, 0xff, 0xb5, 0xca, 0xeb, 0xff, 0xc1, 0xc8, 0xea, 0xff, 0xc1, 0xca, 0xea, 0xff, 0xb8, 0xcc, 0xe9, 0xff, 0xb6, 0xca, 0xea, 0xff, 0xb9, 0xc8, 0xed, 0xff, 0xb9, 0xc9, 0xed, 0xff, 0xb8, 0xc7, 0xed, 0xff, 0xb7, 0xc3, 0xed, 0xff, 0xb2, 0xc2, 0xed, 0xff, 0xaf, 0xc3, 0xed, 0xff, 0xb1, 0xc4, 0xed, 0xff, 0xb1, 0xc4, 0xed, 0xff, 0xb0, 0xc3, 0xee, 0xff, 0xb3, 0xc6, 0xec, 0xff, 0xb6, 0xc8, 0xeb, 0xff, 0xb5, 0xc7, 0xeb, 0xff, 0xb3, 0xc5, 0xea, 0xff, 0xb2, 0xc4, 0xeb, 0xff, 0xb6, 0xc7, 0xe7, 0xff, 0xb9, 0xc7, 0xe7, 0xff, 0xb8, 0xc4, 0xef, 0xff, 0x9c, 0xb0, 0xe2, 0xff, 0x4a, 0x6f, 0xa8, 0xff, 0x22, 0x41, 0x6d, 0xff, 0x10, 0x21, 0x3d, 0xff, 0x11, 0x1f, 0x33, 0xff, 0x06, 0x12, 0x21, 0xff, 0x06, 0x0e, 0x1f, 0xff, 0x2a, 0x41, 0x5e, 0xff, 0x33, 0x56, 0x79, 0xff, 0x2a, 0x44, 0x63, 0xff, 0x39, 0x51, 0x70, 0xff, 0x39, 0x4e, 0x73, 0xff, 0x37, 0x52, 0x71, 0xff, 0x23, 0x43, 0x60, 0xff, 0x2d, 0x4d, 0x72, 0xff, 0x3c, 0x58, 0x7d, 0xff, 0x2b, 0x3c, 0x5d, 0xff, 0x2a, 0x3e, 0x59, 0xff, 0x19, 0x32, 0x4e, 0xff, 0x28, 0x3e, 0x5a, 0xff, 0x2f, 0x44, 0x60, 0xff, 0x33, 0x46, 0x62, 0xff, 0x2f, 0x4b, 0x62, 0xff, 0x1f, 0x3f, 0x55, 0xff, 0x11, 0x24, 0x41, 0xff, 0x23, 0x31, 0x4d, 0xff, 0x36, 0x4d, 0x6b, 0xff, 0x9d, 0x9d, 0x88, 0xff, 0xe5, 0xb0, 0xa4, 0xff, 0xaa, 0xb9, 0xed, 0xff, 0x9b, 0xc6, 0xe9, 0xff, 0xb4, 0xc1, 0xe5, 0xff, 0x9f, 0xbf, 0xec, 0xff, 0xa7, 0xbd, 0xe7, 0xff, 0xa4, 0xbb, 0xe6, 0xff, 0x9f, 0xb7, 0xe4, 0xff, 0x98, 0xb5, 0xe5, 0xff, 0x93, 0xb0, 0xe8, 0xff, 0x8e, 0xa8, 0xe0, 0xff, 0xa3, 0xb4, 0xd7, 0xd1, 0xdf, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xb0, 0xd4, 0x2a, 0x95, 0xb1, 0xdd, 0xf3, 0x93, 0xae, 0xdb, 0xff, 0x91, 0xac, 0xd8, 0xff, 0x92, 0xad, 0xd9, 0xff, 0x95, 0xb0, 0xdc, 0xff, 0x9b, 0xb3, 0xdd, 0xff, 0x9f, 0xb6, 0xde, 0xff, 0xa5, 0xbb, 0xe0, 0xff, 0xaa, 0xbe, 0xe2, 0xff, 0xab, 0xc2, 0xe8, 0xff, 0xb3, 0xbe, 0xdf, 0xff, 0xb7, 0x9b, 0x92, 0xff, 0xbd, 0x89, 0x69, 0xff, 0xde, 0xc1, 0xb4, 0xff, 0xff, 0xf7, 0xf5, 0xff, 0xd5, 0xa5, 0x8d, 0xff, 0xca, 0x95, 0x79, 0xff, 0xc3, 0xa4, 0x96, 0xff, 0xff, 0xf9, 0xef, 0xff, 0xe3, 0xd5, 0xcc, 0xff, 0xc8, 0x9c, 0x82, 0xff, 0xcd, 0x9d, 0x81, 0xff, 0xd4, 0xba, 0xab, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xd7, 0xcb, 0xc2, 0xff, 0xc8, 0x9d, 0x83, 0xff, 0xcd, 0x9d, 0x81, 0xff, 0xd4, 0xb9, 0xa9, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xdd, 0xd1, 0xc8, 0xff, 0xc6, 0x9d, 0x87, 0xff, 0xc8, 0x99, 0x7d, 0xff, 0xdc, 0xbf, 0xac, 0xff, 0xff, 0xfb, 0xec, 0xff, 0xbb, 0xad, 0x9f, 0xff, 0xbf, 0x8e, 0x6c, 0xff, 0xd8, 0xa3, 0x83, 0xff, 0xc5, 0xb2, 0xb7, 0xff, 0xc6, 0xcc, 0xed, 0xff, 0xb9, 0xc9, 0xff, 0xff, 0xb2, 0xc6, 0xec, 0xff, 0xb8, 0xcd, 0xe6, 0xff, 0xb9, 0xcb, 0xe9, 0xff, 0xb8, 0xcc, 0xeb, 0xff, 0xb5, 0xce, 0xec, 0xff, 0xb8, 0xcc, 0xeb, 0xff, 0xbb, 0xca, 0xec, 0xff, 0xba, 0xca, 0xed, 0xff, 0xb8, 0xc8, 0xed, 0xff, 0xb9, 0xc8, 0xee, 0xff, 0xb7, 0xc7, 0xf0, 0xff, 0xb5, 0xc7, 0xf0, 0xff, 0xb5, 0xc6, 0xef, 0xff, 0xb5, 0xc6, 0xf0, 0xff, 0xb5, 0xc6, 0xf0, 0xff, 0xb6, 0xc7, 0xee, 0xff, 0xb7, 0xc9, 0xed, 0xff, 0xb6, 0xc8, 0xed, 0xff, 0xb3, 0xc5, 0xea, 0xff, 0xb2, 0xc5, 0xea, 0xff, 0xb5, 0xc5, 0xe8, 0xff, 0xb7, 0xc4, 0xe8, 0xff, 0xb4, 0xc5, 0xef, 0xff, 0x8f, 0xad, 0xdc, 0xff, 0x3d, 0x71, 0xa3, 0xff, 0x1a, 0x42, 0x6d, 0xff, 0x14, 0x27, 0x46, 0xff, 0x14, 0x24, 0x3b, 0xff, 0x10, 0x1c, 0x30, 0xff, 0x00, 0x0b, 0x1f, 0xff, 0x0e, 0x24, 0x3f, 0xff, 0x36, 0x54, 0x76, 0xff, 0x38, 0x55, 0x79, 0xff, 0x2c, 0x48, 0x6b, 0xff, 0x36, 0x4a, 0x6d, 0xff, 0x42, 0x58, 0x74, 0xff, 0x36, 0x52, 0x71, 0xff, 0x34, 0x51, 0x77, 0xff, 0x3b, 0x58, 0x7e, 0xff, 0x2d, 0x44, 0x64, 0xff, 0x2b, 0x40, 0x5b, 0xff, 0x20, 0x36, 0x52, 0xff, 0x29, 0x3f, 0x5b, 0xff, 0x2a, 0x40, 0x5c, 0xff, 0x2f, 0x45, 0x61, 0xff, 0x2f, 0x44, 0x5f, 0xff, 0x34, 0x46, 0x61, 0xff, 0x14, 0x24, 0x40, 0xff, 0x18, 0x2a, 0x46, 0xff, 0x20, 0x42, 0x61, 0xff, 0x6d, 0x75, 0x72, 0xff, 0xdc, 0xa4, 0x9d, 0xff, 0xbe, 0xbf, 0xde, 0xff, 0xa7, 0xce, 0xef, 0xff, 0xb4, 0xc7, 0xea, 0xff, 0xa9, 0xc7, 0xe9, 0xff, 0xae, 0xc5, 0xe7, 0xff, 0xaa, 0xc3, 0xe7, 0xff, 0xa3, 0xbe, 0xe4, 0xff, 0x9f, 0xbd, 0xe2, 0xff, 0x9d, 0xb7, 0xe5, 0xff, 0x9a, 0xb2, 0xe4, 0xf4, 0x97, 0xaa, 0xd4, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xae, 0xdb, 0x55, 0x8c, 0xa9, 0xd6, 0xfe, 0x8b, 0xa9, 0xd5, 0xff, 0x8e, 0xab, 0xd7, 0xff, 0x91, 0xae, 0xda, 0xff, 0x96, 0xb0, 0xdc, 0xff, 0x99, 0xb1, 0xdc, 0xff, 0x9f, 0xb6, 0xdf, 0xff, 0xa4, 0xb9, 0xdf, 0xff, 0xa8, 0xbf, 0xe7, 0xff, 0xa7, 0xbc, 0xe0, 0xff, 0xae, 0x99, 0x91, 0xff, 0xc8, 0x92, 0x6c, 0xff, 0xbe, 0x99, 0x86, 0xff, 0xf9, 0xee, 0xee, 0xff, 0xf9, 0xdf, 0xd0, 0xff, 0xc5, 0x9a, 0x7f, 0xff, 0xc4, 0x9b, 0x82, 0xff, 0xdb, 0xbe, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xbc, 0xad, 0xff, 0xc8, 0x9b, 0x81, 0xff, 0xc5, 0x9a, 0x81, 0xff, 0xe5, 0xcb, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xbe, 0xaf, 0xff, 0xca, 0x9c, 0x82, 0xff, 0xc9, 0x9f, 0x86, 0xff, 0xe0, 0xc5, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xc4, 0xb4, 0xff, 0xc6, 0x99, 0x7e, 0xff, 0xc1, 0x99, 0x81, 0xff, 0xe1, 0xc5, 0xb3, 0xff, 0xff, 0xf7, 0xec, 0xff, 0xcb, 0xaa, 0x8d, 0xff, 0xc7, 0x92, 0x6d, 0xff, 0xcb, 0xa0, 0x8d, 0xff, 0xc4, 0xac, 0xb3, 0xff, 0xca, 0xc8, 0xe8, 0xff, 0xc8, 0xd2, 0xef, 0xff, 0xc1, 0xcf, 0xe5, 0xff, 0xb6, 0xcc, 0xe6, 0xff, 0xb4, 0xcc, 0xea, 0xff, 0xb7, 0xcd, 0xee, 0xff, 0xbb, 0xcd, 0xeb, 0xff, 0xbc, 0xce, 0xeb, 0xff, 0xbb, 0xcd, 0xed, 0xff, 0xba, 0xca, 0xee, 0xff, 0xba, 0xca, 0xee, 0xff, 0xbb, 0xcb, 0xf1, 0xff, 0xba, 0xcb, 0xf1, 0xff, 0xb6, 0xc6, 0xed, 0xff, 0xb8, 0xc8, 0xee, 0xff, 0xb9, 0xc9, 0xef, 0xff, 0xb7, 0xc8, 0xee, 0xff, 0xb8, 0xca, 0xef, 0xff, 0xb5, 0xc7, 0xec, 0xff, 0xb4, 0xc6, 0xeb, 0xff, 0xb4, 0xc6, 0xeb, 0xff, 0xb3, 0xc5, 0xec, 0xff, 0xb3, 0xc4, 0xed, 0xff, 0xb5, 0xc5, 0xf0, 0xff, 0x91, 0xac, 0xd9, 0xff, 0x44, 0x73, 0xa1, 0xff, 0x22, 0x48, 0x72, 0xff, 0x16, 0x2b, 0x4e, 0xff, 0x1b, 0x2d, 0x46, 0xff, 0x14, 0x22, 0x38, 0xff, 0x15, 0x23, 0x3b, 0xff, 0x07, 0x1d, 0x36, 0xff, 0x2a, 0x48, 0x67, 0xff, 0x43, 0x65, 0x8d, 0xff, 0x28, 0x46, 0x6f, 0xff, 0x3d, 0x4f, 0x6e, 0xff, 0x3b, 0x4c, 0x66, 0xff, 0x31, 0x48, 0x69, 0xff, 0x32, 0x4f, 0x75, 0xff, 0x41, 0x60, 0x85, 0xff, 0x2e, 0x4a, 0x69, 0xff, 0x25, 0x3c, 0x58, 0xff, 0x28, 0x3d, 0x59, 0xff, 0x29, 0x3f, 0x5b, 0xff, 0x22, 0x38, 0x54, 0xff, 0x2d, 0x43, 0x5f, 0xff, 0x2f, 0x47, 0x63, 0xff, 0x34, 0x4a, 0x65, 0xff, 0x24, 0x31, 0x4b, 0xff, 0x17, 0x27, 0x42, 0xff, 0x1a, 0x3c, 0x5e, 0xff, 0x3c, 0x5a, 0x6e, 0xff, 0xbc, 0x94, 0x99, 0xff, 0xcf, 0xc5, 0xd4, 0xff, 0xa9, 0xd0, 0xf4, 0xff, 0xb6, 0xc4, 0xec, 0xff, 0xb1, 0xc8, 0xe5, 0xff, 0xb2, 0xc8, 0xe9, 0xff, 0xae, 0xc6, 0xe7, 0xff, 0xa8, 0xc1, 0xe5, 0xff, 0xa2, 0xbd, 0xe2, 0xff, 0xa0, 0xb8, 0xe2, 0xff, 0xa0, 0xb4, 0xe7, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xa8, 0xd3, 0x8d, 0x87, 0xa7, 0xd2, 0xff, 0x8c, 0xab, 0xd6, 0xff, 0x8e, 0xae, 0xd8, 0xff, 0x94, 0xaf, 0xdc, 0xff, 0x97, 0xaf, 0xdc, 0xff, 0x98, 0xb0, 0xdb, 0xff, 0x9f, 0xb4, 0xdd, 0xff, 0xa3, 0xba, 0xe3, 0xff, 0x98, 0xb8, 0xe1, 0xff, 0xa5, 0x98, 0x90, 0xff, 0xd7, 0x9b, 0x6a, 0xff, 0xc5, 0x95, 0x74, 0xff, 0xcb, 0xb1, 0xa3, 0xff, 0xfc, 0xff, 0xf8, 0xff, 0xd5, 0xc1, 0xae, 0xff, 0xd0, 0x9c, 0x7b, 0xff, 0xc7, 0x9a, 0x80, 0xff, 0xeb, 0xd6, 0xcf, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xc8, 0xaf, 0x9b, 0xff, 0xd5, 0x9f, 0x7f, 0xff, 0xcc, 0x9d, 0x83, 0xff, 0xec, 0xdc, 0xd5, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xcc, 0xb2, 0x9f, 0xff, 0xd9, 0xa4, 0x83, 0xff, 0xcd, 0x9e, 0x83, 0xff, 0xdd, 0xcd, 0xc6, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xd7, 0xbb, 0xa8, 0xff, 0xc8, 0x99, 0x7d, 0xff, 0xc5, 0x97, 0x7c, 0xff, 0xe7, 0xca, 0xb8, 0xff, 0xfb, 0xfb, 0xf3, 0xff, 0xbf, 0xab, 0x99, 0xff, 0xc9, 0x92, 0x6d, 0xff, 0xd5, 0xa2, 0x83, 0xff, 0xc3, 0xa8, 0x99, 0xff, 0xc6, 0xc5, 0xd8, 0xff, 0xc8, 0xd6, 0xf6, 0xff, 0xbc, 0xd0, 0xea, 0xff, 0xb8, 0xcc, 0xea, 0xff, 0xc1, 0xcb, 0xf1, 0xff, 0xbf, 0xcd, 0xed, 0xff, 0xbb, 0xd0, 0xea, 0xff, 0xbd, 0xcf, 0xec, 0xff, 0xbc, 0xcd, 0xed, 0xff, 0xbb, 0xcc, 0xee, 0xff, 0xbd, 0xca, 0xef, 0xff, 0xbf, 0xcc, 0xf1, 0xff, 0xbc, 0xcb, 0xef, 0xff, 0xbd, 0xcc, 0xf0, 0xff, 0xc1, 0xcd, 0xf1, 0xff, 0xbb, 0xca, 0xf0, 0xff, 0xb8, 0xcb, 0xf1, 0xff, 0xb6, 0xc8, 0xee, 0xff, 0xb5, 0xc7, 0xed, 0xff, 0xb6, 0xc8, 0xed, 0xff, 0xb0, 0xc7, 0xee, 0xff, 0xb1, 0xc5, 0xf0, 0xff, 0xb8, 0xc4, 0xf3, 0xff, 0x9a, 0xac, 0xde, 0xff, 0x5a, 0x77, 0xac, 0xff, 0x2b, 0x4b, 0x7a, 0xff, 0x15, 0x30, 0x53, 0xff, 0x1c, 0x2f, 0x4a, 0xff, 0x20, 0x2e, 0x47, 0xff, 0x20, 0x2f, 0x4a, 0xff, 0x0f, 0x22, 0x38, 0xff, 0x1e, 0x3c, 0x58, 0xff, 0x3e, 0x64, 0x92, 0xff, 0x32, 0x52, 0x80, 0xff, 0x3a, 0x4b, 0x67, 0xff, 0x3d, 0x4a, 0x62, 0xff, 0x2b, 0x3f, 0x63, 0xff, 0x2b, 0x48, 0x6e, 0xff, 0x3b, 0x5b, 0x7f, 0xff, 0x37, 0x57, 0x75, 0xff, 0x31, 0x4a, 0x65, 0xff, 0x2c, 0x40, 0x5c, 0xff, 0x2f, 0x45, 0x60, 0xff, 0x1f, 0x34, 0x50, 0xff, 0x2d, 0x40, 0x5c, 0xff, 0x2e, 0x4e, 0x6a, 0xff, 0x25, 0x49, 0x63, 0xff, 0x26, 0x34, 0x4a, 0xff, 0x21, 0x2a, 0x44, 0xff, 0x22, 0x35, 0x5d, 0xff, 0x21, 0x52, 0x7c, 0xff, 0x88, 0x7d, 0x8e, 0xff, 0xd0, 0xc3, 0xc9, 0xff, 0xa0, 0xcb, 0xf9, 0xff, 0xb7, 0xbb, 0xf0, 0xff, 0xb7, 0xc3, 0xe2, 0xff, 0xb1, 0xc4, 0xe9, 0xff, 0xaf, 0xc1, 0xe7, 0xff, 0xa9, 0xbe, 0xe7, 0xff, 0xa3, 0xba, 0xe6, 0xff, 0xa0, 0xb6, 0xe0, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0x85, 0xa7, 0xd2, 0xb1, 0x88, 0xa9, 0xd5, 0xff, 0x8a, 0xab, 0xd7, 0xff, 0x8f, 0xac, 0xda, 0xff, 0x93, 0xae, 0xdc, 0xff, 0x93, 0xae, 0xd9, 0xff, 0x98, 0xb1, 0xda, 0xff, 0xa0, 0xb9, 0xe4, 0xff, 0x9a, 0xb3, 0xe1, 0xff, 0xa4, 0x93, 0x92, 0xff, 0xcc, 0x9a, 0x6c, 0xff, 0xd0, 0xa2, 0x7f, 0xff, 0xc2, 0x96, 0x7f, 0xff, 0xe8, 0xd6, 0xd5, 0xff, 0xf8, 0xfb, 0xf0, 0xff, 0xc9, 0xa9, 0x87, 0xff, 0xd9, 0x9a, 0x7e, 0xff, 0xc8, 0x9f, 0x8d, 0xff, 0xf2, 0xf0, 0xf1, 0xff, 0xf6, 0xec, 0xe5, 0xff, 0xcb, 0xa4, 0x85, 0xff, 0xcf, 0xa3, 0x84, 0xff, 0xce, 0xa2, 0x92, 0xff, 0xef, 0xe8, 0xea, 0xff, 0xfa, 0xf6, 0xee, 0xff, 0xd2, 0xab, 0x8f, 0xff, 0xd2, 0xa2, 0x86, 0xff, 0xcb, 0x9a, 0x89, 0xff, 0xe1, 0xdb, 0xd1, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xd4, 0xb1, 0xa3, 0xff, 0xc7, 0x97, 0x82, 0xff, 0xc9, 0x98, 0x77, 0xff, 0xde, 0xc8, 0xbd, 0xff, 0xff, 0xfa, 0xf8, 0xff, 0xd0, 0xb6, 0xa3, 0xff, 0xbb, 0x93, 0x75, 0xff, 0xd8, 0xa5, 0x7e, 0xff, 0xcf, 0xa4, 0x8c, 0xff, 0xc6, 0xb6, 0xb7, 0xff, 0xc6, 0xd0, 0xe8, 0xff, 0xbe, 0xd6, 0xfe, 0xff, 0xbb, 0xd0, 0xfa, 0xff, 0xc0, 0xd0, 0xea, 0xff, 0xc3, 0xd2, 0xe7, 0xff, 0xbe, 0xce, 0xec, 0xff, 0xba, 0xcb, 0xef, 0xff, 0xbb, 0xcb, 0xf6, 0xff, 0xb8, 0xcb, 0xf3, 0xff, 0xba, 0xcc, 0xf1, 0xff, 0xc1, 0xca, 0xf2, 0xff, 0xc0, 0xcb, 0xf2, 0xff, 0xbb, 0xcd, 0xf3, 0xff, 0xb7, 0xcd, 0xf1, 0xff, 0xb9, 0xcd, 0xf2, 0xff, 0xb9, 0xcb, 0xee, 0xff, 0xba, 0xc9, 0xeb, 0xff, 0xbf, 0xc9, 0xe7, 0xff, 0xaf, 0xc6, 0xef, 0xff, 0xa6, 0xc7, 0xfb, 0xff, 0xb6, 0xcd, 0xfe, 0xff, 0xa4, 0xb0, 0xd7, 0xff, 0x7a, 0x76, 0x8b, 0xff, 0x3b, 0x4b, 0x68, 0xff, 0x1a, 0x3a, 0x61, 0xff, 0x21, 0x35, 0x4f, 0xff, 0x1e, 0x2f, 0x48, 0xff, 0x1d, 0x30, 0x4d, 0xff, 0x16, 0x2f, 0x48, 0xff, 0x20, 0x37, 0x54, 0xff, 0x41, 0x5c, 0x85, 0xff, 0x3b, 0x61, 0x87, 0xff, 0x23, 0x39, 0x55, 0xff, 0x3b, 0x48, 0x61, 0xff, 0x30, 0x47, 0x65, 0xff, 0x24, 0x3e, 0x66, 0xff, 0x3b, 0x58, 0x7f, 0xff, 0x39, 0x57, 0x75, 0xff, 0x32, 0x4b, 0x66, 0xff, 0x2c, 0x42, 0x5f, 0xff, 0x3a, 0x51, 0x6e, 0xff, 0x1e, 0x35, 0x52, 0xff, 0x2a, 0x3f, 0x5c, 0xff, 0x2f, 0x4c, 0x69, 0xff, 0x27, 0x44, 0x5f, 0xff, 0x23, 0x35, 0x4c, 0xff, 0x2d, 0x3d, 0x56, 0xff, 0x34, 0x48, 0x6c, 0xff, 0x2e, 0x58, 0x87, 0xff, 0x55, 0x64, 0x87, 0xff, 0xba, 0xb6, 0xc6, 0xff, 0xb1, 0xcd, 0xed, 0xff, 0xaa, 0xbe, 0xeb, 0xff, 0xac, 0xbd, 0xe7, 0xff, 0xa7, 0xbc, 0xe7, 0xff, 0xa7, 0xbb, 0xe7, 0xff, 0xa5, 0xba, 0xe7, 0xff, 0x9f, 0xb5, 0xe3, 0xb1, 0xaa, 0xaa, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xb2, 0xcc, 0x0a, 0x85, 0xa7, 0xd4, 0xc8, 0x86, 0xa8, 0xd6, 0xff, 0x8b, 0xab, 0xd9, 0xff, 0x8f, 0xad, 0xdb, 0xff, 0x91, 0xaf, 0xda, 0xff, 0x96, 0xb1, 0xda, 0xff, 0x9e, 0xb8, 0xe3, 0xff, 0x99, 0xb3, 0xe0, 0xff, 0x9e, 0x8f, 0x91, 0xff, 0xc1, 0x97, 0x73, 0xff, 0xca, 0x9f, 0x82, 0xff, 0xd1, 0x9d, 0x85, 0xff, 0xd3, 0xa0, 0x97, 0xff, 0xf8, 0xfc, 0xf2, 0xff, 0xe6, 0xe1, 0xcf, 0xff, 0xd1, 0x99, 0x87, 0xff, 0xd0, 0x9f, 0x81, 0xff, 0xcb, 0xb1, 0xa3, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xea, 0xdf, 0xd2, 0xff, 0xc0, 0xa2, 0x8f, 0xff, 0xd7, 0xa0, 0x85, 0xff, 0xcd, 0xaa, 0x9d, 0xff, 0xfc, 0xf7, 0xf3, 0xff, 0xf7, 0xf0, 0xe5, 0xff, 0xc7, 0xa5, 0x94, 0xff, 0xd9, 0x9f, 0x84, 0xff, 0xc3, 0xa0, 0x89, 0xff, 0xec, 0xe5, 0xd8, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xcd, 0xb0, 0xa2, 0xff, 0xca, 0x99, 0x7c, 0xff, 0xce, 0x97, 0x7e, 0xff, 0xdf, 0xbe, 0xb3, 0xff, 0xff, 0xfc, 0xf6, 0xff, 0xd6, 0xca, 0xbc, 0xff, 0xbb, 0x91, 0x78, 0xff, 0xd4, 0x9b, 0x76, 0xff, 0xd1, 0xa4, 0x86, 0xff, 0xbe, 0xa9, 0xa7, 0xff, 0xc3, 0xc2, 0xd5, 0xff, 0xcd, 0xd7, 0xec, 0xff, 0xc3, 0xd8, 0xf8, 0xff, 0xb8, 0xd0, 0xf8, 0xff, 0xb9, 0xcc, 0xf0, 0xff, 0xbd, 0xcc, 0xec, 0xff, 0xc4, 0xcf, 0xee, 0xff, 0xbd, 0xd0, 0xee, 0xff, 0xbc, 0xcf, 0xed, 0xff, 0xc6, 0xcc, 0xed, 0xff, 0xc5, 0xcd, 0xed, 0xff, 0xbb, 0xd0, 0xee, 0xff, 0xbc, 0xce, 0xe6, 0xff, 0xc3, 0xd0, 0xe7, 0xff, 0xbd, 0xcf, 0xef, 0xff, 0xb6, 0xc9, 0xf4, 0xff, 0xaf, 0xc6, 0xfb, 0xff, 0xba, 0xcf, 0xfe, 0xff, 0xc8, 0xd3, 0xf2, 0xff, 0xc5, 0xc5, 0xd7, 0xff, 0xaa, 0xa0, 0xa7, 0xff, 0x83, 0x6c, 0x69, 0xff, 0x3c, 0x46, 0x5d, 0xff, 0x1e, 0x41, 0x69, 0xff, 0x29, 0x3f, 0x59, 0xff, 0x1e, 0x33, 0x4b, 0xff, 0x1d, 0x34, 0x53, 0xff, 0x21, 0x3f, 0x5c, 0xff, 0x26, 0x39, 0x57, 0xff, 0x40, 0x50, 0x74, 0xff, 0x40, 0x69, 0x88, 0xff, 0x21, 0x3b, 0x5a, 0xff, 0x1a, 0x28, 0x3e, 0xff, 0x2f, 0x46, 0x59, 0xff, 0x11, 0x26, 0x4b, 0xff, 0x3b, 0x54, 0x7d, 0xff, 0x48, 0x67, 0x89, 0xff, 0x26, 0x41, 0x60, 0xff, 0x25, 0x3c, 0x5b, 0xff, 0x34, 0x4d, 0x6c, 0xff, 0x20, 0x39, 0x57, 0xff, 0x2d, 0x46, 0x65, 0xff, 0x2d, 0x45, 0x65, 0xff, 0x33, 0x47, 0x65, 0xff, 0x28, 0x3d, 0x56, 0xff, 0x2b, 0x43, 0x5e, 0xff, 0x3f, 0x5b, 0x7b, 0xff, 0x3b, 0x5c, 0x87, 0xff, 0x42, 0x59, 0x87, 0xff, 0xa4, 0xa6, 0xc4, 0xff, 0xbd, 0xcf, 0xe2, 0xff, 0x9f, 0xbf, 0xe3, 0xff, 0xa1, 0xb8, 0xea, 0xff, 0xa0, 0xb8, 0xe6, 0xff, 0x9f, 0xb7, 0xe5, 0xff, 0x9f, 0xb7, 0xe5, 0xc8, 0x99, 0xb2, 0xe5, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xaa, 0xce, 0x15, 0x86, 0xa7, 0xd4, 0xd7, 0x8a, 0xaa, 0xd7, 0xff, 0x8d, 0xac, 0xd9, 0xff, 0x92, 0xae, 0xda, 0xff, 0x97, 0xb1, 0xda, 0xff, 0x9c, 0xb4, 0xdf, 0xff, 0x8b, 0xb4, 0xdf, 0xff, 0x98, 0x95, 0x95, 0xff, 0xc3, 0x96, 0x73, 0xff, 0xcf, 0x9e, 0x84, 0xff, 0xcf, 0xa0, 0x8b, 0xff, 0xd0, 0x9b, 0x7c, 0xff, 0xd4, 0xc1, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xbe, 0xb9, 0xff, 0xd1, 0x9f, 0x7c, 0xff, 0xd1, 0xa0, 0x7a, 0xff, 0xde, 0xc5, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xc9, 0xc7, 0xff, 0xd1, 0xa1, 0x81, 0xff, 0xdd, 0xa4, 0x82, 0xff, 0xd2, 0xb1, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xe5, 0xe1, 0xff, 0xca, 0xa4, 0x84, 0xff, 0xdc, 0x9e, 0x82, 0xff, 0xcc, 0xa0, 0x8c, 0xff, 0xea, 0xe6, 0xd2, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xd5, 0xb5, 0xab, 0xff, 0xd5, 0x9b, 0x81, 0xff, 0xd1, 0x99, 0x7a, 0xff, 0xd2, 0xb3, 0xa1, 0xff, 0xfe, 0xf3, 0xe9, 0xff, 0xe4, 0xdd, 0xd9, 0xff, 0xb7, 0x99, 0x90, 0xff, 0xc6, 0x94, 0x79, 0xff, 0xda, 0xa2, 0x79, 0xff, 0xd3, 0xa2, 0x82, 0xff, 0xce, 0xad, 0xa1, 0xff, 0xc2, 0xbe, 0xd3, 0xff, 0xc4, 0xd0, 0xf0, 0xff, 0xce, 0xdc, 0xf6, 0xff, 0xc3, 0xd7, 0xf3, 0xff, 0xba, 0xd3, 0xef, 0xff, 0xb9, 0xd1, 0xee, 0xff, 0xbd, 0xd0, 0xf0, 0xff, 0xbf, 0xd1, 0xf0, 0xff, 0xbf, 0xd0, 0xef, 0xff, 0xbc, 0xd1, 0xf0, 0xff, 0xba, 0xce, 0xef, 0xff, 0xbc, 0xcd, 0xef, 0xff, 0xbf, 0xcf, 0xf4, 0xff, 0xc7, 0xd5, 0xfd, 0xff, 0xbc, 0xd1, 0xff, 0xff, 0xc6, 0xc4, 0xdf, 0xff, 0xd6, 0xb2, 0xa6, 0xff, 0xe1, 0xae, 0x8c, 0xff, 0xbd, 0x92, 0x79, 0xff, 0x6d, 0x5b, 0x64, 0xff, 0x2d, 0x42, 0x68, 0xff, 0x20, 0x44, 0x6c, 0xff, 0x2d, 0x43, 0x5f, 0xff, 0x22, 0x37, 0x51, 0xff, 0x24, 0x3d, 0x5d, 0xff, 0x25, 0x43, 0x60, 0xff, 0x20, 0x34, 0x51, 0xff, 0x35, 0x48, 0x6e, 0xff, 0x40, 0x68, 0x88, 0xff, 0x2d, 0x47, 0x66, 0xff, 0x1a, 0x26, 0x3a, 0xff, 0x17, 0x28, 0x37, 0xff, 0x21, 0x32, 0x4e, 0xff, 0x10, 0x26, 0x4b, 0xff, 0x38, 0x5b, 0x84, 0xff, 0x38, 0x59, 0x7d, 0xff, 0x28, 0x3f, 0x5f, 0xff, 0x34, 0x4d, 0x6d, 0xff, 0x2b, 0x45, 0x65, 0xff, 0x36, 0x4f, 0x6f, 0xff, 0x2b, 0x46, 0x67, 0xff, 0x2d, 0x46, 0x65, 0xff, 0x2d, 0x42, 0x5c, 0xff, 0x28, 0x3f, 0x5c, 0xff, 0x36, 0x53, 0x78, 0xff, 0x3f, 0x65, 0x8f, 0xff, 0x45, 0x5b, 0x84, 0xff, 0x94, 0x9b, 0xbc, 0xff, 0xb0, 0xc9, 0xe7, 0xff, 0xa4, 0xbc, 0xe3, 0xff, 0xa4, 0xb5, 0xe4, 0xff, 0x9c, 0xb4, 0xe1, 0xff, 0x9b, 0xb3, 0xe0, 0xd8, 0x9d, 0xb6, 0xe6, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xad, 0xd1, 0x1c, 0x88, 0xa8, 0xd6, 0xdc, 0x8c, 0xaa, 0xd7, 0xff, 0x92, 0xaf, 0xda, 0xff, 0x98, 0xb2, 0xdb, 0xff, 0x9d, 0xb5, 0xe0, 0xff, 0x88, 0xb3, 0xe1, 0xff, 0x98, 0x94, 0x98, 0xff, 0xbf, 0x8f, 0x6d, 0xff, 0xe1, 0xb8, 0x9f, 0xff, 0xd7, 0xba, 0xa7, 0xff, 0xcf, 0x9d, 0x7a, 0xff, 0xc5, 0x9c, 0x86, 0xff, 0xe9, 0xde, 0xe0, 0xff, 0xfe, 0xfc, 0xf9, 0xff, 0xd0, 0xab, 0x91, 0xff, 0xd9, 0xa5, 0x7f, 0xff, 0xc4, 0xa0, 0x8c, 0xff, 0xde, 0xcc, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xc4, 0xac, 0xff, 0xd7, 0xa0, 0x82, 0xff, 0xce, 0xa0, 0x8e, 0xff, 0xc9, 0xb5, 0xb1, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf0, 0xe0, 0xcd, 0xff, 0xd2, 0x9b, 0x86, 0xff, 0xd2, 0x9d, 0x87, 0xff, 0xbb, 0xa1, 0x88, 0xff, 0xed, 0xde, 0xce, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xe6, 0xc1, 0xae, 0xff, 0xc8, 0x9a, 0x7b, 0xff, 0xc0, 0x97, 0x80, 0xff, 0xc4, 0xa5, 0x97, 0xff, 0xf3, 0xe9, 0xe6, 0xff, 0xfe, 0xf5, 0xf1, 0xff, 0xd2, 0xad, 0x97, 0xff, 0xc3, 0x8a, 0x60, 0xff, 0xd9, 0x9e, 0x72, 0xff, 0xd2, 0xa1, 0x84, 0xff, 0xcc, 0x9f, 0x85, 0xff, 0xd3, 0xae, 0x97, 0xff, 0xcf, 0xbf, 0xbc, 0xff, 0xc8, 0xcf, 0xe5, 0xff, 0xbe, 0xd9, 0xff, 0xff, 0xc1, 0xd7, 0xff, 0xff, 0xc4, 0xd7, 0xfb, 0xff, 0xbe, 0xd6, 0xfa, 0xff, 0xbc, 0xd3, 0xf8, 0xff, 0xc4, 0xd5, 0xf9, 0xff, 0xbe, 0xd7, 0xff, 0xff, 0xbf, 0xd7, 0xff, 0xff, 0xd0, 0xd5, 0xed, 0xff, 0xd7, 0xc7, 0xc8, 0xff, 0xd5, 0xb5, 0xa5, 0xff, 0xc6, 0x9d, 0x8d, 0xff, 0xc5, 0x92, 0x77, 0xff, 0xd2, 0x96, 0x6a, 0xff, 0xb7, 0x8d, 0x71, 0xff, 0x99, 0x8f, 0x9a, 0xff, 0x48, 0x63, 0x8b, 0xff, 0x1a, 0x3f, 0x69, 0xff, 0x27, 0x3f, 0x5d, 0xff, 0x22, 0x38, 0x55, 0xff, 0x28, 0x42, 0x65, 0xff, 0x2c, 0x4a, 0x68, 0xff, 0x20, 0x33, 0x50, 0xff, 0x2c, 0x3f, 0x65, 0xff, 0x48, 0x6f, 0x90, 0xff, 0x2f, 0x48, 0x66, 0xff, 0x25, 0x34, 0x4e, 0xff, 0x11, 0x25, 0x3a, 0xff, 0x1f, 0x2b, 0x42, 0xff, 0x0e, 0x1e, 0x39, 0xff, 0x10, 0x2e, 0x51, 0xff, 0x35, 0x56, 0x7a, 0xff, 0x28, 0x43, 0x64, 0xff, 0x2e, 0x49, 0x6b, 0xff, 0x36, 0x52, 0x74, 0xff, 0x34, 0x4f, 0x71, 0xff, 0x2c, 0x49, 0x6c, 0xff, 0x2c, 0x47, 0x67, 0xff, 0x2b, 0x41, 0x5e, 0xff, 0x28, 0x40, 0x5e, 0xff, 0x3f, 0x5d, 0x84, 0xff, 0x4a, 0x71, 0x9b, 0xff, 0x3c, 0x58, 0x7f, 0xff, 0x83, 0x90, 0xb8, 0xff, 0xa8, 0xc5, 0xea, 0xff, 0xa7, 0xbb, 0xe4, 0xff, 0xa9, 0xb6, 0xe3, 0xff, 0x9a, 0xb4, 0xe2, 0xdd, 0x9a, 0xad, 0xda, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xaa, 0xd8, 0x21, 0x8d, 0xac, 0xd9, 0xde, 0x93, 0xb0, 0xdb, 0xff, 0x98, 0xb2, 0xda, 0xff, 0x9d, 0xb6, 0xdf, 0xff, 0x8e, 0xb2, 0xe3, 0xff, 0xa0, 0x90, 0x97, 0xff, 0xba, 0x84, 0x65, 0xff, 0xdf, 0xc0, 0xa8, 0xff, 0xf3, 0xf1, 0xd9, 0xff, 0xc2, 0xa3, 0x87, 0xff, 0xd9, 0x9a, 0x83, 0xff, 0xce, 0xa9, 0x94, 0xff, 0xf5, 0xff, 0xed, 0xff, 0xf7, 0xe6, 0xe4, 0xff, 0xcc, 0xa0, 0x8e, 0xff, 0xd2, 0xa7, 0x8b, 0xff, 0xca, 0x9e, 0x8d, 0xff, 0xf5, 0xe1, 0xd7, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xce, 0xb1, 0xa9, 0xff, 0xcf, 0xa2, 0x87, 0xff, 0xc7, 0xa0, 0x7e, 0xff, 0xd5, 0xba, 0xa6, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xe9, 0xdb, 0xd8, 0xff, 0xca, 0x9e, 0x88, 0xff, 0xdc, 0x9b, 0x82, 0xff, 0xd1, 0x9c, 0x88, 0xff, 0xe0, 0xd4, 0xcc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xdd, 0xcf, 0xc1, 0xff, 0xcc, 0x9c, 0x82, 0xff, 0xcf, 0x99, 0x7f, 0xff, 0xc8, 0x9d, 0x89, 0xff, 0xe7, 0xd8, 0xca, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xdd, 0xc9, 0xc1, 0xff, 0xb5, 0x92, 0x7f, 0xff, 0xc3, 0x8f, 0x69, 0xff, 0xd5, 0x9f, 0x78, 0xff, 0xd2, 0xa2, 0x82, 0xff, 0xc2, 0x99, 0x83, 0xff, 0xc6, 0xa1, 0x97, 0xff, 0xdc, 0xb3, 0xae, 0xff, 0xd5, 0xc0, 0xca, 0xff, 0xcd, 0xcd, 0xe0, 0xff, 0xce, 0xd4, 0xe3, 0xff, 0xd2, 0xd6, 0xe5, 0xff, 0xd7, 0xd0, 0xe3, 0xff, 0xd3, 0xc8, 0xd0, 0xff, 0xcc, 0xbc, 0xb7, 0xff, 0xc9, 0xaa, 0x9f, 0xff, 0xc6, 0x9d, 0x85, 0xff, 0xce, 0x9f, 0x7e, 0xff, 0xd2, 0x9d, 0x7a, 0xff, 0xbd, 0x8a, 0x6c, 0xff, 0xc4, 0xa4, 0x96, 0xff, 0xee, 0xe5, 0xea, 0xff, 0xb1, 0xb5, 0xbd, 0xff, 0x45, 0x5f, 0x80, 0xff, 0x1a, 0x3f, 0x6d, 0xff, 0x28, 0x42, 0x63, 0xff, 0x27, 0x40, 0x5f, 0xff, 0x28, 0x43, 0x69, 0xff, 0x32, 0x51, 0x6f, 0xff, 0x26, 0x38, 0x55, 0xff, 0x31, 0x44, 0x6b, 0xff, 0x49, 0x73, 0x93, 0xff, 0x37, 0x4d, 0x67, 0xff, 0x21, 0x36, 0x57, 0xff, 0x1d, 0x3e, 0x5f, 0xff, 0x17, 0x20, 0x36, 0xff, 0x11, 0x17, 0x28, 0xff, 0x13, 0x27, 0x3a, 0xff, 0x17, 0x35, 0x54, 0xff, 0x29, 0x46, 0x6d, 0xff, 0x2f, 0x4b, 0x6f, 0xff, 0x3f, 0x5b, 0x7f, 0xff, 0x34, 0x51, 0x74, 0xff, 0x29, 0x47, 0x6c, 0xff, 0x2c, 0x49, 0x6d, 0xff, 0x2c, 0x45, 0x63, 0xff, 0x37, 0x4f, 0x6f, 0xff, 0x4f, 0x6f, 0x9c, 0xff, 0x3b, 0x67, 0x91, 0xff, 0x39, 0x56, 0x7c, 0xff, 0x6e, 0x80, 0xad, 0xff, 0x9d, 0xc0, 0xec, 0xff, 0xa8, 0xb9, 0xe4, 0xff, 0xad, 0xb5, 0xe2, 0xde, 0x9a, 0xb1, 0xe0, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xb0, 0xd7, 0x1a, 0x94, 0xaf, 0xdb, 0xd7, 0x99, 0xb2, 0xde, 0xff, 0x9b, 0xb5, 0xe3, 0xff, 0x8c, 0xb5, 0xe0, 0xff, 0x96, 0x95, 0x9e, 0xff, 0xb8, 0x88, 0x6e, 0xff, 0xcc, 0xa4, 0x8b, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xde, 0xcf, 0xc4, 0xff, 0xcd, 0x99, 0x83, 0xff, 0xd5, 0xa0, 0x7d, 0xff, 0xd0, 0xbc, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xd1, 0xd3, 0xff, 0xc9, 0x9f, 0x8d, 0xff, 0xde, 0xa5, 0x86, 0xff, 0xd4, 0xa8, 0x90, 0xff, 0xf6, 0xee, 0xed, 0xff, 0xf9, 0xf6, 0xff, 0xff, 0xc9, 0xaa, 0x9a, 0xff, 0xda, 0xa9, 0x7c, 0xff, 0xcf, 0x9f, 0x7f, 0xff, 0xd4, 0xb4, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xdf, 0xd3, 0xff, 0xd6, 0x9c, 0x91, 0xff, 0xd9, 0x9f, 0x8a, 0xff, 0xc3, 0x9f, 0x7a, 0xff, 0xd1, 0xc7, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xdf, 0xd6, 0xff, 0xc9, 0xa1, 0x8c, 0xff, 0xcf, 0x98, 0x7a, 0xff, 0xca, 0x9c, 0x7a, 0xff, 0xd4, 0xc2, 0xb0, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf2, 0xe7, 0xed, 0xff, 0xc9, 0xa6, 0x95, 0xff, 0xb2, 0x87, 0x69, 0xff, 0xb9, 0x8c, 0x6f, 0xff, 0xd0, 0x99, 0x7c, 0xff, 0xd6, 0x9b, 0x7c, 0xff, 0xd7, 0x9d, 0x77, 0xff, 0xd2, 0xa1, 0x88, 0xff, 0xcd, 0xa4, 0x95, 0xff, 0xcd, 0xa8, 0x95, 0xff, 0xcc, 0xa6, 0x93, 0xff, 0xc9, 0xa0, 0x90, 0xff, 0xd4, 0x98, 0x7d, 0xff, 0xcd, 0x96, 0x71, 0xff, 0xb7, 0x9c, 0x76, 0xff, 0xbd, 0x9e, 0x7c, 0xff, 0xc9, 0x8b, 0x6e, 0xff, 0xb8, 0x82, 0x6f, 0xff, 0xcf, 0xbe, 0xba, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xd8, 0xd5, 0xd2, 0xff, 0x76, 0x71, 0x7c, 0xff, 0x3f, 0x57, 0x7a, 0xff, 0x20, 0x46, 0x71, 0xff, 0x2a, 0x42, 0x66, 0xff, 0x27, 0x3f, 0x61, 0xff, 0x28, 0x45, 0x68, 0xff, 0x32, 0x4d, 0x6b, 0xff, 0x28, 0x3c, 0x57, 0xff, 0x33, 0x48, 0x69, 0xff, 0x4d, 0x6c, 0x8d, 0xff, 0x2f, 0x48, 0x66, 0xff, 0x20, 0x3a, 0x60, 0xff, 0x2a, 0x49, 0x6f, 0xff, 0x24, 0x33, 0x4e, 0xff, 0x12, 0x1e, 0x33, 0xff, 0x18, 0x2b, 0x42, 0xff, 0x0d, 0x26, 0x45, 0xff, 0x24, 0x42, 0x65, 0xff, 0x3b, 0x5a, 0x7e, 0xff, 0x48, 0x67, 0x8c, 0xff, 0x3c, 0x57, 0x7f, 0xff, 0x2c, 0x45, 0x6a, 0xff, 0x34, 0x49, 0x6d, 0xff, 0x2f, 0x47, 0x6b, 0xff, 0x37, 0x5d, 0x7e, 0xff, 0x66, 0x83, 0xa3, 0xff, 0x4b, 0x6b, 0x91, 0xff, 0x3b, 0x60, 0x8c, 0xff, 0x63, 0x7b, 0xa7, 0xff, 0x9c, 0xb5, 0xdf, 0xff, 0xad, 0xbd, 0xe3, 0xd7, 0xa0, 0xb3, 0xe2, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xad, 0xdc, 0x16, 0x98, 0xb0, 0xdf, 0xca, 0x9a, 0xb4, 0xe5, 0xff, 0x8b, 0xb4, 0xdf, 0xff, 0x8a, 0x94, 0xa3, 0xff, 0xbd, 0x90, 0x7a, 0xff, 0xc6, 0x91, 0x74, 0xff, 0xe5, 0xcf, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xaf, 0x9f, 0xff, 0xd3, 0xa1, 0x82, 0xff, 0xce, 0x9d, 0x83, 0xff, 0xdd, 0xce, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xc1, 0xbc, 0xff, 0xd6, 0xa2, 0x87, 0xff, 0xd9, 0xa5, 0x89, 0xff, 0xce, 0xac, 0x9b, 0xff, 0xfd, 0xf7, 0xf8, 0xff, 0xf8, 0xf1, 0xed, 0xff, 0xcd, 0xaa, 0x91, 0xff, 0xd1, 0xa3, 0x88, 0xff, 0xd2, 0x99, 0x88, 0xff, 0xd4, 0xbc, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xe4, 0xe0, 0xff, 0xc7, 0xa4, 0x93, 0xff, 0xcf, 0xa0, 0x79, 0xff, 0xcc, 0x9b, 0x83, 0xff, 0xd4, 0xb6, 0xb3, 0xff, 0xff, 0xfb, 0xfa, 0xff, 0xf3, 0xef, 0xe8, 0xff, 0xce, 0xae, 0x9c, 0xff, 0xd6, 0x9a, 0x7f, 0xff, 0xd2, 0x98, 0x81, 0xff, 0xc6, 0xa5, 0x9b, 0xff, 0xef, 0xe3, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xd3, 0xc0, 0xff, 0xc4, 0x98, 0x7b, 0xff, 0xbd, 0x89, 0x71, 0xff, 0xc1, 0x8d, 0x73, 0xff, 0xb7, 0x90, 0x73, 0xff, 0xc2, 0x99, 0x79, 0xff, 0xcc, 0x9d, 0x7c, 0xff, 0xce, 0x9f, 0x7e, 0xff, 0xcb, 0x9c, 0x7b, 0xff, 0xc3, 0x95, 0x73, 0xff, 0xbb, 0x94, 0x74, 0xff, 0xc1, 0x94, 0x78, 0xff, 0xc5, 0x8c, 0x73, 0xff, 0xb7, 0x83, 0x6b, 0xff, 0xbd, 0x98, 0x79, 0xff, 0xe9, 0xd7, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xc7, 0xbd, 0xff, 0xa3, 0x82, 0x6b, 0xff, 0x72, 0x67, 0x72, 0xff, 0x3c, 0x59, 0x82, 0xff, 0x26, 0x4d, 0x74, 0xff, 0x2a, 0x3f, 0x64, 0xff, 0x23, 0x38, 0x5c, 0xff, 0x2e, 0x4b, 0x6a, 0xff, 0x32, 0x4b, 0x68, 0xff, 0x26, 0x3a, 0x55, 0xff, 0x31, 0x48, 0x64, 0xff, 0x55, 0x6d, 0x8e, 0xff, 0x30, 0x4c, 0x6f, 0xff, 0x1b, 0x39, 0x5e, 0xff, 0x37, 0x52, 0x76, 0xff, 0x23, 0x39, 0x56, 0xff, 0x0a, 0x20, 0x3b, 0xff, 0x21, 0x38, 0x58, 0xff, 0x1f, 0x36, 0x58, 0xff, 0x18, 0x34, 0x53, 0xff, 0x33, 0x54, 0x76, 0xff, 0x48, 0x69, 0x8c, 0xff, 0x3f, 0x57, 0x81, 0xff, 0x37, 0x4c, 0x71, 0xff, 0x3a, 0x48, 0x6b, 0xff, 0x2d, 0x44, 0x6c, 0xff, 0x3f, 0x70, 0x92, 0xff, 0x80, 0x98, 0xae, 0xff, 0x64, 0x78, 0x9a, 0xff, 0x3f, 0x69, 0x9a, 0xff, 0x64, 0x7d, 0xa9, 0xff, 0x9d, 0xae, 0xd5, 0xca, 0xad, 0xc5, 0xe7, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xb9, 0xe7, 0x0b, 0x97, 0xb4, 0xe3, 0xaf, 0x8c, 0xae, 0xe0, 0xff, 0x8e, 0x91, 0xa5, 0xff, 0xbe, 0x8f, 0x7a, 0xff, 0xd0, 0x98, 0x78, 0xff, 0xc0, 0x9a, 0x8a, 0xff, 0xf3, 0xec, 0xe7, 0xff, 0xf7, 0xed, 0xe3, 0xff, 0xc3, 0xa2, 0x8c, 0xff, 0xcc, 0xa2, 0x88, 0xff, 0xce, 0xa2, 0x88, 0xff, 0xec, 0xe1, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xb5, 0xa3, 0xff, 0xcf, 0xa0, 0x89, 0xff, 0xd8, 0xa3, 0x8c, 0xff, 0xd4, 0xaf, 0x9d, 0xff, 0xff, 0xfd, 0xf5, 0xff, 0xf3, 0xea, 0xec, 0xff, 0xc0, 0xa3, 0x9a, 0xff, 0xdc, 0xa3, 0x80, 0xff, 0xd4, 0x9c, 0x85, 0xff, 0xd1, 0xb8, 0xad, 0xff, 0xfd, 0xff, 0xf3, 0xff, 0xf4, 0xf0, 0xe8, 0xff, 0xcb, 0xa4, 0xa1, 0xff, 0xd4, 0x9c, 0x87, 0xff, 0xd1, 0xa0, 0x84, 0xff, 0xca, 0xab, 0x9d, 0xff, 0xf6, 0xed, 0xe7, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xd6, 0xbc, 0xb9, 0xff, 0xc8, 0x98, 0x84, 0xff, 0xd0, 0x9e, 0x78, 0xff, 0xc5, 0x9f, 0x7f, 0xff, 0xd3, 0xc6, 0xbd, 0xff, 0xff, 0xfd, 0xf8, 0xff, 0xff, 0xf7, 0xea, 0xff, 0xd6, 0xba, 0xab, 0xff, 0xc5, 0x98, 0x84, 0xff, 0xc4, 0x92, 0x7c, 0xff, 0xc6, 0x98, 0x7c, 0xff, 0xc1, 0x97, 0x77, 0xff, 0xbb, 0x90, 0x72, 0xff, 0xc4, 0x99, 0x7b, 0xff, 0xc6, 0x99, 0x79, 0xff, 0xb6, 0x99, 0x7b, 0xff, 0xb5, 0x8e, 0x77, 0xff, 0xcd, 0x8a, 0x7b, 0xff, 0xe8, 0xba, 0xaf, 0xff, 0xf8, 0xff, 0xf5, 0xff, 0xf8, 0xf8, 0xe7, 0xff, 0xd9, 0xb3, 0xa5, 0xff, 0xcf, 0x8f, 0x83, 0xff, 0xc1, 0x85, 0x74, 0xff, 0x67, 0x6a, 0x72, 0xff, 0x2e, 0x58, 0x7d, 0xff, 0x2c, 0x4f, 0x78, 0xff, 0x2b, 0x42, 0x67, 0xff, 0x2c, 0x42, 0x65, 0xff, 0x30, 0x4d, 0x6d, 0xff, 0x28, 0x41, 0x5e, 0xff, 0x2b, 0x3f, 0x5a, 0xff, 0x34, 0x4b, 0x67, 0xff, 0x4c, 0x66, 0x87, 0xff, 0x38, 0x53, 0x75, 0xff, 0x1d, 0x3c, 0x61, 0xff, 0x36, 0x55, 0x79, 0xff, 0x27, 0x3d, 0x59, 0xff, 0x0d, 0x23, 0x3b, 0xff, 0x1d, 0x36, 0x52, 0xff, 0x2e, 0x48, 0x68, 0xff, 0x0e, 0x29, 0x49, 0xff, 0x25, 0x46, 0x68, 0xff, 0x49, 0x69, 0x8d, 0xff, 0x39, 0x50, 0x7a, 0xff, 0x3d, 0x54, 0x79, 0xff, 0x38, 0x4d, 0x6e, 0xff, 0x2c, 0x45, 0x6c, 0xff, 0x55, 0x82, 0xa4, 0xff, 0x7e, 0x94, 0xae, 0xff, 0x59, 0x6e, 0x8f, 0xff, 0x54, 0x7b, 0xa7, 0xff, 0x6b, 0x7f, 0xaa, 0xb0, 0xa2, 0xa2, 0xd0, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xff, 0x03, 0x84, 0xaa, 0xe1, 0x8b, 0x84, 0x8c, 0xa7, 0xff, 0xb2, 0x89, 0x75, 0xff, 0xd4, 0x9d, 0x7a, 0xff, 0xc8, 0x98, 0x81, 0xff, 0xc4, 0xab, 0x9f, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xe2, 0xd1, 0xc6, 0xff, 0xbc, 0x9c, 0x89, 0xff, 0xda, 0xa6, 0x86, 0xff, 0xc9, 0xaa, 0x97, 0xff, 0xf5, 0xf1, 0xea, 0xff, 0xff, 0xf9, 0xf0, 0xff, 0xcb, 0xab, 0x9c, 0xff, 0xd8, 0xa3, 0x8b, 0xff, 0xd3, 0xa1, 0x83, 0xff, 0xcf, 0xb5, 0xa6, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xf5, 0xeb, 0xe7, 0xff, 0xd1, 0xa7, 0x8a, 0xff, 0xd7, 0x9e, 0x86, 0xff, 0xc4, 0x9c, 0x8b, 0xff, 0xc0, 0xb0, 0x9c, 0xff, 0xfc, 0xf7, 0xef, 0xff, 0xff, 0xf7, 0xfe, 0xff, 0xdd, 0xb4, 0xa5, 0xff, 0xcd, 0xa0, 0x81, 0xff, 0xc6, 0x9f, 0x88, 0xff, 0xc1, 0xa2, 0x94, 0xff, 0xe5, 0xd6, 0xd4, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xdc, 0xdc, 0xc9, 0xff, 0xcd, 0xa5, 0x83, 0xff, 0xd5, 0x9c, 0x7d, 0xff, 0xd2, 0x92, 0x88, 0xff, 0xc8, 0xa5, 0xa0, 0xff, 0xe9, 0xe1, 0xd5, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xf8, 0xe5, 0xd7, 0xff, 0xcd, 0xaa, 0x9b, 0xff, 0xc7, 0x95, 0x80, 0xff, 0xd1, 0x98, 0x7f, 0xff, 0xcd, 0x97, 0x7f, 0xff, 0xcc, 0x96, 0x7e, 0xff, 0xd1, 0x9c, 0x82, 0xff, 0xd8, 0x97, 0x87, 0xff, 0xdc, 0xb1, 0xa4, 0xff, 0xe9, 0xed, 0xdb, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xf2, 0xd3, 0xcf, 0xff, 0xca, 0xa0, 0x8e, 0xff, 0xc0, 0x99, 0x84, 0xff, 0xd5, 0x95, 0x87, 0xff, 0xbd, 0x88, 0x79, 0xff, 0x6a, 0x78, 0x8a, 0xff, 0x2d, 0x5b, 0x84, 0xff, 0x2b, 0x4c, 0x73, 0xff, 0x29, 0x40, 0x65, 0xff, 0x2f, 0x45, 0x68, 0xff, 0x31, 0x4f, 0x6e, 0xff, 0x23, 0x3d, 0x59, 0xff, 0x2e, 0x43, 0x5e, 0xff, 0x2e, 0x45, 0x63, 0xff, 0x3c, 0x56, 0x77, 0xff, 0x38, 0x52, 0x74, 0xff, 0x1b, 0x3c, 0x61, 0xff, 0x2f, 0x50, 0x74, 0xff, 0x2b, 0x44, 0x60, 0xff, 0x18, 0x30, 0x48, 0xff, 0x18, 0x34, 0x50, 0xff, 0x2c, 0x47, 0x67, 0xff, 0x14, 0x30, 0x4f, 0xff, 0x33, 0x53, 0x75, 0xff, 0x4e, 0x6e, 0x92, 0xff, 0x31, 0x48, 0x72, 0xff, 0x38, 0x54, 0x77, 0xff, 0x35, 0x4e, 0x6f, 0xff, 0x31, 0x4b, 0x72, 0xff, 0x5b, 0x87, 0xa9, 0xff, 0x65, 0x78, 0x93, 0xff, 0x55, 0x65, 0x86, 0xff, 0x66, 0x89, 0xb0, 0x8b, 0x55, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x89, 0xa4, 0x57, 0xa4, 0x8c, 0x77, 0xf3, 0xc8, 0x99, 0x71, 0xff, 0xd0, 0x9f, 0x81, 0xff, 0xc5, 0x93, 0x7b, 0xff, 0xe6, 0xc7, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xbf, 0xb3, 0xff, 0xc8, 0xa0, 0x84, 0xff, 0xd8, 0xa5, 0x83, 0xff, 0xcb, 0xae, 0x9c, 0xff, 0xf8, 0xfa, 0xfc, 0xff, 0xf7, 0xee, 0xec, 0xff, 0xcd, 0xa5, 0x90, 0xff, 0xd7, 0xa6, 0x87, 0xff, 0xc5, 0xa3, 0x86, 0xff, 0xc8, 0xb6, 0xa2, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xf4, 0xe8, 0xeb, 0xff, 0xc7, 0xa5, 0x98, 0xff, 0xd5, 0xa1, 0x87, 0xff, 0xd6, 0x9e, 0x88, 0xff, 0xcd, 0xa4, 0x94, 0xff, 0xec, 0xe8, 0xe3, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd9, 0xc8, 0xb8, 0xff, 0xcf, 0x9d, 0x83, 0xff, 0xd6, 0x9e, 0x82, 0xff, 0xc6, 0x9c, 0x85, 0xff, 0xd6, 0xc1, 0xb6, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xf8, 0xee, 0xee, 0xff, 0xd4, 0xb4, 0xa8, 0xff, 0xcb, 0x9b, 0x79, 0xff, 0xcf, 0x98, 0x7b, 0xff, 0xc3, 0x98, 0x83, 0xff, 0xcd, 0xc0, 0xad, 0xff, 0xf2, 0xf5, 0xe9, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xe5, 0xcf, 0xc2, 0xff, 0xd7, 0xb8, 0xa3, 0xff, 0xd0, 0xb0, 0x9e, 0xff, 0xc7, 0xa8, 0x96, 0xff, 0xd1, 0xb1, 0x9e, 0xff, 0xed, 0xde, 0xd3, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xec, 0xe0, 0xff, 0xcf, 0xb4, 0xa1, 0xff, 0xc5, 0x99, 0x81, 0xff, 0xd9, 0x9e, 0x83, 0xff, 0xc7, 0x96, 0x84, 0xff, 0xc4, 0xa6, 0x96, 0xff, 0xe3, 0xcf, 0xc1, 0xff, 0x80, 0x95, 0xb5, 0xff, 0x1a, 0x47, 0x78, 0xff, 0x2f, 0x50, 0x75, 0xff, 0x2b, 0x41, 0x67, 0xff, 0x29, 0x3f, 0x63, 0xff, 0x33, 0x52, 0x72, 0xff, 0x2a, 0x44, 0x61, 0xff, 0x35, 0x4a, 0x64, 0xff, 0x26, 0x3d, 0x5a, 0xff, 0x36, 0x52, 0x72, 0xff, 0x43, 0x5b, 0x7c, 0xff, 0x21, 0x41, 0x66, 0xff, 0x2b, 0x50, 0x73, 0xff, 0x2b, 0x46, 0x60, 0xff, 0x17, 0x32, 0x49, 0xff, 0x12, 0x33, 0x4f, 0xff, 0x2d, 0x48, 0x68, 0xff, 0x21, 0x3c, 0x5a, 0xff, 0x3c, 0x5d, 0x7f, 0xff, 0x4c, 0x6d, 0x90, 0xff, 0x34, 0x4a, 0x74, 0xff, 0x3b, 0x59, 0x7b, 0xff, 0x39, 0x56, 0x76, 0xff, 0x41, 0x5a, 0x81, 0xff, 0x48, 0x73, 0x95, 0xff, 0x4f, 0x5d, 0x78, 0xf3, 0x63, 0x6c, 0x8c, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x8e, 0x76, 0x2b, 0xd5, 0xa6, 0x79, 0xd2, 0xc8, 0xa4, 0x89, 0xff, 0xd6, 0x9d, 0x74, 0xff, 0xc6, 0x9d, 0x83, 0xff, 0xe9, 0xe1, 0xe3, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xc9, 0xae, 0x98, 0xff, 0xdc, 0xa3, 0x7f, 0xff, 0xd5, 0xa6, 0x87, 0xff, 0xc6, 0xb9, 0xa8, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xeb, 0xe4, 0xe1, 0xff, 0xc4, 0x9f, 0x91, 0xff, 0xdb, 0xa6, 0x8b, 0xff, 0xcd, 0x9e, 0x81, 0xff, 0xd1, 0xb3, 0xa0, 0xff, 0xff, 0xfe, 0xfa, 0xff, 0xf0, 0xf1, 0xf2, 0xff, 0xcd, 0xae, 0x9d, 0xff, 0xde, 0xa3, 0x84, 0xff, 0xdb, 0xa3, 0x84, 0xff, 0xc1, 0x9c, 0x89, 0xff, 0xdb, 0xd1, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xde, 0xd4, 0xff, 0xca, 0xa3, 0x8c, 0xff, 0xd2, 0x9e, 0x7d, 0xff, 0xcf, 0x9a, 0x83, 0xff, 0xcd, 0xab, 0x9f, 0xff, 0xf0, 0xeb, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xcd, 0xc8, 0xff, 0xd0, 0x9e, 0x89, 0xff, 0xda, 0x9b, 0x7e, 0xff, 0xcc, 0x95, 0x80, 0xff, 0xc5, 0xa0, 0x8e, 0xff, 0xdc, 0xcf, 0xbd, 0xff, 0xff, 0xf9, 0xef, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf4, 0xf3, 0xeb, 0xff, 0xf7, 0xf6, 0xee, 0xff, 0xff, 0xfa, 0xf6, 0xff, 0xf4, 0xf0, 0xe3, 0xff, 0xd9, 0xc2, 0xb1, 0xff, 0xd3, 0x96, 0x87, 0xff, 0xd8, 0x93, 0x80, 0xff, 0xcc, 0x9f, 0x7f, 0xff, 0xbf, 0x9b, 0x8e, 0xff, 0xd8, 0xbe, 0xbd, 0xff, 0xff, 0xfe, 0xf0, 0xff, 0xc8, 0xdb, 0xd4, 0xff, 0x59, 0x69, 0x8d, 0xff, 0x2f, 0x48, 0x77, 0xff, 0x32, 0x54, 0x77, 0xff, 0x2b, 0x44, 0x67, 0xff, 0x2e, 0x46, 0x67, 0xff, 0x39, 0x53, 0x72, 0xff, 0x32, 0x4b, 0x68, 0xff, 0x38, 0x4d, 0x6a, 0xff, 0x21, 0x36, 0x54, 0xff, 0x41, 0x59, 0x7c, 0xff, 0x3f, 0x5e, 0x81, 0xff, 0x27, 0x4b, 0x6e, 0xff, 0x2f, 0x53, 0x75, 0xff, 0x29, 0x47, 0x64, 0xff, 0x18, 0x33, 0x4e, 0xff, 0x1c, 0x36, 0x51, 0xff, 0x33, 0x4e, 0x6e, 0xff, 0x26, 0x43, 0x66, 0xff, 0x4a, 0x69, 0x8d, 0xff, 0x4e, 0x6c, 0x91, 0xff, 0x33, 0x4d, 0x74, 0xff, 0x3d, 0x5a, 0x7e, 0xff, 0x3e, 0x5d, 0x81, 0xff, 0x3e, 0x60, 0x84, 0xff, 0x39, 0x5e, 0x80, 0xd2, 0x45, 0x5c, 0x79, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xbf, 0x9f, 0x08, 0xe9, 0xd9, 0xcb, 0x8f, 0xcd, 0x9f, 0x7c, 0xfe, 0xcd, 0xa1, 0x86, 0xff, 0xbf, 0xa4, 0x98, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xfc, 0xf2, 0xe6, 0xff, 0xc7, 0xa2, 0x8d, 0xff, 0xd7, 0xa5, 0x89, 0xff, 0xcc, 0xa4, 0x86, 0xff, 0xd6, 0xbf, 0xad, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xec, 0xe0, 0xdc, 0xff, 0xcd, 0x9e, 0x8f, 0xff, 0xd8, 0xa2, 0x8b, 0xff, 0xcb, 0x9c, 0x84, 0xff, 0xcf, 0xb4, 0x9f, 0xff, 0xfb, 0xf9, 0xf5, 0xff, 0xf9, 0xf9, 0xf5, 0xff, 0xd6, 0xbb, 0xa6, 0xff, 0xcd, 0xa1, 0x87, 0xff, 0xd6, 0x9f, 0x86, 0xff, 0xc9, 0x97, 0x88, 0xff, 0xda, 0xbf, 0xb9, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xf4, 0xf2, 0xec, 0xff, 0xd2, 0xb2, 0x9f, 0xff, 0xce, 0x97, 0x82, 0xff, 0xd2, 0x9c, 0x83, 0xff, 0xc4, 0x9f, 0x83, 0xff, 0xd9, 0xc9, 0xb9, 0xff, 0xfe, 0xfa, 0xff, 0xff, 0xf8, 0xf1, 0xeb, 0xff, 0xd1, 0xba, 0x9f, 0xff, 0xc8, 0x97, 0x83, 0xff, 0xd5, 0x98, 0x83, 0xff, 0xd6, 0x96, 0x7c, 0xff, 0xcf, 0xa4, 0x95, 0xff, 0xd5, 0xc1, 0xba, 0xff, 0xdf, 0xd1, 0xc6, 0xff, 0xe1, 0xd2, 0xc7, 0xff, 0xcf, 0xb7, 0xb0, 0xff, 0xca, 0x9c, 0x8b, 0xff, 0xd4, 0x98, 0x7f, 0xff, 0xd3, 0x9b, 0x88, 0xff, 0xc6, 0x93, 0x84, 0xff, 0xd4, 0xaa, 0x98, 0xff, 0xeb, 0xe2, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xd8, 0xcd, 0xff, 0x6e, 0x83, 0x87, 0xff, 0x3f, 0x53, 0x77, 0xff, 0x3f, 0x52, 0x7d, 0xff, 0x28, 0x46, 0x68, 0xff, 0x25, 0x41, 0x62, 0xff, 0x33, 0x4c, 0x6c, 0xff, 0x38, 0x4f, 0x6d, 0xff, 0x2d, 0x45, 0x62, 0xff, 0x38, 0x4e, 0x6e, 0xff, 0x1e, 0x31, 0x52, 0xff, 0x46, 0x5c, 0x7f, 0xff, 0x3e, 0x63, 0x87, 0xff, 0x26, 0x4d, 0x70, 0xff, 0x32, 0x54, 0x76, 0xff, 0x2e, 0x4d, 0x6f, 0xff, 0x23, 0x3c, 0x5d, 0xff, 0x23, 0x35, 0x51, 0xff, 0x30, 0x49, 0x6a, 0xff, 0x35, 0x55, 0x7c, 0xff, 0x49, 0x65, 0x8a, 0xff, 0x47, 0x64, 0x89, 0xff, 0x39, 0x58, 0x7c, 0xff, 0x3b, 0x57, 0x7e, 0xff, 0x3f, 0x5f, 0x86, 0xfe, 0x43, 0x69, 0x8c, 0x8f, 0x3f, 0x5f, 0x7f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xbd, 0xb9, 0x42, 0xc2, 0x96, 0x83, 0xdb, 0xcf, 0x9e, 0x78, 0xff, 0xd5, 0xb6, 0x98, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe5, 0xe0, 0xda, 0xff, 0xc5, 0x9e, 0x8f, 0xff, 0xe1, 0xa3, 0x92, 0xff, 0xcc, 0x99, 0x84, 0xff, 0xd7, 0xc5, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xde, 0xd7, 0xff, 0xc1, 0xa0, 0x8f, 0xff, 0xd2, 0xa4, 0x8e, 0xff, 0xd7, 0x9e, 0x87, 0xff, 0xd7, 0xaf, 0x97, 0xff, 0xfa, 0xee, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xbf, 0xc0, 0xff, 0xc7, 0x9e, 0x87, 0xff, 0xdb, 0xa3, 0x84, 0xff, 0xcf, 0x9c, 0x84, 0xff, 0xcc, 0xac, 0x9e, 0xff, 0xf8, 0xed, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xc5, 0xbc, 0xff, 0xd1, 0x99, 0x8b, 0xff, 0xd7, 0x96, 0x86, 0xff, 0xcb, 0x98, 0x83, 0xff, 0xc1, 0xb3, 0x97, 0xff, 0xeb, 0xe9, 0xdc, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xd8, 0xdc, 0xcc, 0xff, 0xc3, 0xa9, 0x97, 0xff, 0xdd, 0x94, 0x85, 0xff, 0xdf, 0x9a, 0x84, 0xff, 0xce, 0x9f, 0x83, 0xff, 0xcd, 0x9d, 0x81, 0xff, 0xcc, 0x9c, 0x80, 0xff, 0xd3, 0x9d, 0x80, 0xff, 0xd1, 0xa1, 0x8b, 0xff, 0xbf, 0x97, 0x86, 0xff, 0xc9, 0xa4, 0x96, 0xff, 0xe3, 0xcf, 0xc7, 0xff, 0xff, 0xfd, 0xfa, 0xff, 0xf8, 0xf7, 0xe2, 0xff, 0xdb, 0xba, 0x9f, 0xff, 0xbe, 0x91, 0x8d, 0xff, 0x6d, 0x6f, 0x7f, 0xff, 0x27, 0x52, 0x79, 0xff, 0x2d, 0x53, 0x7d, 0xff, 0x2a, 0x44, 0x66, 0xff, 0x24, 0x3f, 0x61, 0xff, 0x38, 0x51, 0x71, 0xff, 0x2d, 0x45, 0x64, 0xff, 0x26, 0x3e, 0x5c, 0xff, 0x3f, 0x54, 0x73, 0xff, 0x22, 0x36, 0x56, 0xff, 0x44, 0x5b, 0x7e, 0xff, 0x44, 0x67, 0x8a, 0xff, 0x32, 0x58, 0x7d, 0xff, 0x37, 0x5b, 0x7f, 0xff, 0x35, 0x55, 0x78, 0xff, 0x2e, 0x49, 0x6b, 0xff, 0x25, 0x3b, 0x5a, 0xff, 0x2e, 0x47, 0x69, 0xff, 0x45, 0x63, 0x89, 0xff, 0x3d, 0x5a, 0x7f, 0xff, 0x3f, 0x5c, 0x81, 0xff, 0x4b, 0x68, 0x8d, 0xff, 0x41, 0x5e, 0x83, 0xdb, 0x41, 0x60, 0x87, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xaa, 0x8d, 0x09, 0xcf, 0x9e, 0x75, 0x87, 0xc0, 0x9a, 0x76, 0xf9, 0xc7, 0xbb, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xd3, 0xca, 0xff, 0xca, 0x97, 0x84, 0xff, 0xd7, 0xa2, 0x8a, 0xff, 0xc7, 0xa1, 0x86, 0xff, 0xd5, 0xc7, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xe0, 0xd5, 0xff, 0xc3, 0xa1, 0x90, 0xff, 0xd8, 0xa2, 0x8b, 0xff, 0xd7, 0xa3, 0x87, 0xff, 0xc7, 0xa5, 0x95, 0xff, 0xe8, 0xdb, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xd8, 0xc9, 0xff, 0xce, 0xa3, 0x88, 0xff, 0xd3, 0xa0, 0x86, 0xff, 0xcc, 0x9f, 0x8a, 0xff, 0xc2, 0xa0, 0x93, 0xff, 0xe6, 0xd4, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe2, 0xd2, 0xff, 0xce, 0xa1, 0x95, 0xff, 0xd6, 0x97, 0x86, 0xff, 0xd8, 0x9d, 0x7c, 0xff, 0xcd, 0x97, 0x8a, 0xff, 0xde, 0xbd, 0xbb, 0xff, 0xff, 0xfe, 0xf1, 0xff, 0xfb, 0xfd, 0xec, 0xff, 0xd1, 0xc2, 0xb1, 0xff, 0xc3, 0x9b, 0x84, 0xff, 0xc7, 0x93, 0x77, 0xff, 0xd4, 0x9f, 0x85, 0xff, 0xcf, 0x9b, 0x81, 0xff, 0xca, 0x98, 0x7c, 0xff, 0xca, 0xa2, 0x8f, 0xff, 0xdb, 0xc5, 0xb9, 0xff, 0xff, 0xf7, 0xeb, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xda, 0xcf, 0xcc, 0xff, 0xb7, 0xa4, 0x8a, 0xff, 0xc8, 0x9d, 0x82, 0xff, 0xb8, 0x93, 0x9d, 0xff, 0x54, 0x63, 0x82, 0xff, 0x1e, 0x4e, 0x78, 0xff, 0x35, 0x5a, 0x83, 0xff, 0x39, 0x53, 0x75, 0xff, 0x24, 0x3f, 0x61, 0xff, 0x3e, 0x57, 0x77, 0xff, 0x2c, 0x44, 0x62, 0xff, 0x2f, 0x48, 0x65, 0xff, 0x44, 0x59, 0x78, 0xff, 0x26, 0x3a, 0x5a, 0xff, 0x43, 0x5a, 0x7d, 0xff, 0x3c, 0x5e, 0x81, 0xff, 0x35, 0x5d, 0x82, 0xff, 0x36, 0x5b, 0x82, 0xff, 0x30, 0x52, 0x77, 0xff, 0x30, 0x4d, 0x70, 0xff, 0x27, 0x3f, 0x61, 0xff, 0x32, 0x4d, 0x70, 0xff, 0x42, 0x60, 0x86, 0xff, 0x36, 0x53, 0x78, 0xff, 0x40, 0x5e, 0x83, 0xf9, 0x52, 0x6e, 0x94, 0x88, 0x38, 0x55, 0x8d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x9e, 0x82, 0x25, 0xc1, 0x96, 0x7d, 0xb7, 0xd8, 0xc4, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xd0, 0xb3, 0xff, 0xbb, 0x9d, 0x81, 0xff, 0xda, 0xa3, 0x8e, 0xff, 0xcb, 0x97, 0x87, 0xff, 0xdc, 0xc2, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xe4, 0xdc, 0xff, 0xc0, 0xa6, 0x93, 0xff, 0xd0, 0xa1, 0x8c, 0xff, 0xd5, 0xa1, 0x89, 0xff, 0xcb, 0xa0, 0x85, 0xff, 0xe3, 0xcf, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xea, 0xe7, 0xff, 0xc8, 0xaa, 0x9b, 0xff, 0xd4, 0x9b, 0x82, 0xff, 0xdd, 0xa0, 0x86, 0xff, 0xca, 0x97, 0x84, 0xff, 0xd1, 0xba, 0xae, 0xff, 0xf9, 0xfa, 0xf2, 0xff, 0xf9, 0xfc, 0xf6, 0xff, 0xd1, 0xbf, 0xb1, 0xff, 0xcd, 0x9a, 0x80, 0xff, 0xd7, 0x9c, 0x81, 0xff, 0xca, 0x97, 0x82, 0xff, 0xce, 0xa4, 0x93, 0xff, 0xec, 0xdc, 0xd0, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xe7, 0xe9, 0xde, 0xff, 0xda, 0xc4, 0xb9, 0xff, 0xdc, 0xbc, 0xb4, 0xff, 0xd7, 0xb8, 0xb0, 0xff, 0xd2, 0xc3, 0xb8, 0xff, 0xf3, 0xea, 0xe3, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe7, 0xe5, 0xd8, 0xff, 0xc5, 0xad, 0x9b, 0xff, 0xc1, 0x91, 0x7c, 0xff, 0xd5, 0x9e, 0x83, 0xff, 0xd3, 0xa2, 0x98, 0xff, 0x7c, 0x79, 0x93, 0xff, 0x17, 0x4b, 0x74, 0xff, 0x25, 0x46, 0x72, 0xff, 0x4c, 0x5f, 0x88, 0xff, 0x33, 0x51, 0x74, 0xff, 0x2c, 0x47, 0x69, 0xff, 0x3a, 0x54, 0x73, 0xff, 0x21, 0x3a, 0x58, 0xff, 0x3c, 0x54, 0x71, 0xff, 0x3f, 0x52, 0x71, 0xff, 0x2c, 0x40, 0x5f, 0xff, 0x49, 0x60, 0x82, 0xff, 0x3a, 0x5c, 0x7e, 0xff, 0x37, 0x60, 0x87, 0xff, 0x37, 0x5e, 0x88, 0xff, 0x3b, 0x5e, 0x85, 0xff, 0x2a, 0x49, 0x6e, 0xff, 0x28, 0x43, 0x66, 0xff, 0x38, 0x54, 0x78, 0xff, 0x41, 0x5f, 0x84, 0xff, 0x32, 0x4f, 0x73, 0xb7, 0x49, 0x6b, 0x8c, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x95, 0x7f, 0x46, 0xdf, 0xd1, 0xc3, 0xca, 0xff, 0xff, 0xfc, 0xff, 0xd0, 0xc7, 0xb5, 0xff, 0xd1, 0x97, 0x88, 0xff, 0xdc, 0xa1, 0x8f, 0xff, 0xc0, 0x9b, 0x89, 0xff, 0xd7, 0xc1, 0xb5, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xef, 0xf1, 0xeb, 0xff, 0xc6, 0xaa, 0xa1, 0xff, 0xcc, 0x9b, 0x83, 0xff, 0xda, 0xa7, 0x82, 0xff, 0xca, 0x9f, 0x81, 0xff, 0xd2, 0xb7, 0xaa, 0xff, 0xf9, 0xf6, 0xf7, 0xff, 0xff, 0xf8, 0xf9, 0xff, 0xdb, 0xbb, 0xb1, 0xff, 0xce, 0x9d, 0x88, 0xff, 0xd6, 0x9d, 0x7c, 0xff, 0xd3, 0x94, 0x7f, 0xff, 0xce, 0xa5, 0x9a, 0xff, 0xe9, 0xe4, 0xd8, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xdb, 0xdb, 0xd2, 0xff, 0xb7, 0xa5, 0x8c, 0xff, 0xc6, 0x96, 0x7b, 0xff, 0xe0, 0x97, 0x86, 0xff, 0xd2, 0x92, 0x83, 0xff, 0xd2, 0xba, 0xa5, 0xff, 0xf5, 0xee, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfd, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xe9, 0xe1, 0xff, 0xd3, 0xb5, 0xa5, 0xff, 0xb9, 0x98, 0x84, 0xff, 0xc5, 0x9a, 0x83, 0xff, 0xd9, 0x9e, 0x87, 0xff, 0xd2, 0x9d, 0x8c, 0xff, 0xab, 0x9a, 0x9e, 0xff, 0x51, 0x6e, 0x8c, 0xff, 0x12, 0x3e, 0x6c, 0xff, 0x2b, 0x45, 0x70, 0xff, 0x4a, 0x60, 0x85, 0xff, 0x2d, 0x4b, 0x6d, 0xff, 0x38, 0x52, 0x75, 0xff, 0x36, 0x4d, 0x6e, 0xff, 0x22, 0x38, 0x59, 0xff, 0x41, 0x5a, 0x79, 0xff, 0x2e, 0x47, 0x66, 0xff, 0x2f, 0x44, 0x66, 0xff, 0x44, 0x5b, 0x80, 0xff, 0x38, 0x59, 0x7d, 0xff, 0x3c, 0x63, 0x8a, 0xff, 0x35, 0x5d, 0x86, 0xff, 0x44, 0x67, 0x8e, 0xff, 0x3b, 0x59, 0x7e, 0xff, 0x2c, 0x47, 0x6a, 0xff, 0x33, 0x4f, 0x71, 0xca, 0x3d, 0x5b, 0x7f, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xda, 0xd3, 0x4d, 0xff, 0xff, 0xff, 0xcc, 0xd9, 0xbb, 0xb0, 0xff, 0xc3, 0x9a, 0x87, 0xff, 0xd3, 0xa9, 0x91, 0xff, 0xc6, 0x9e, 0x84, 0xff, 0xd1, 0xb8, 0xa7, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xfc, 0xf7, 0xf5, 0xff, 0xcf, 0xb5, 0xa9, 0xff, 0xc3, 0x9c, 0x85, 0xff, 0xd5, 0xa3, 0x87, 0xff, 0xd1, 0x98, 0x7c, 0xff, 0xc8, 0xa6, 0x95, 0xff, 0xef, 0xe3, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xd3, 0xcc, 0xff, 0xbf, 0x9f, 0x89, 0xff, 0xcd, 0x9f, 0x83, 0xff, 0xd2, 0x9d, 0x84, 0xff, 0xc4, 0x94, 0x82, 0xff, 0xdd, 0xc2, 0xb8, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xf2, 0xf3, 0xea, 0xff, 0xd3, 0xb0, 0xa4, 0xff, 0xca, 0x91, 0x83, 0xff, 0xd7, 0x9a, 0x85, 0xff, 0xc9, 0x98, 0x78, 0xff, 0xc7, 0x9c, 0x8a, 0xff, 0xd8, 0xba, 0xb2, 0xff, 0xe0, 0xd1, 0xc3, 0xff, 0xe0, 0xd3, 0xc4, 0xff, 0xcf, 0xbc, 0xb0, 0xff, 0xc8, 0x9e, 0x8d, 0xff, 0xcb, 0x93, 0x79, 0xff, 0xd1, 0x9b, 0x7f, 0xff, 0xc7, 0x98, 0x80, 0xff, 0xcc, 0xa5, 0x93, 0xff, 0xdd, 0xc5, 0xc6, 0xff, 0x8b, 0x9f, 0xb2, 0xff, 0x34, 0x5f, 0x80, 0xff, 0x1a, 0x30, 0x5f, 0xff, 0x30, 0x4a, 0x6f, 0xff, 0x3a, 0x5a, 0x7a, 0xff, 0x26, 0x41, 0x62, 0xff, 0x39, 0x53, 0x75, 0xff, 0x37, 0x4c, 0x6f, 0xff, 0x30, 0x41, 0x66, 0xff, 0x41, 0x5b, 0x7b, 0xff, 0x27, 0x45, 0x64, 0xff, 0x2c, 0x43, 0x67, 0xff, 0x42, 0x5b, 0x7f, 0xff, 0x3c, 0x5c, 0x84, 0xff, 0x3c, 0x62, 0x89, 0xff, 0x39, 0x61, 0x87, 0xff, 0x42, 0x66, 0x8c, 0xff, 0x3f, 0x5c, 0x80, 0xcc, 0x31, 0x4c, 0x70, 0x4d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x41, 0xd1, 0xb8, 0xa7, 0xb4, 0xcd, 0x9a, 0x81, 0xfe, 0xd5, 0xa7, 0x8e, 0xff, 0xc5, 0x9b, 0x84, 0xff, 0xd6, 0xaf, 0xa0, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xc3, 0xb7, 0xff, 0xc0, 0x96, 0x84, 0xff, 0xce, 0x9c, 0x8a, 0xff, 0xcb, 0x9b, 0x7f, 0xff, 0xc5, 0x9d, 0x80, 0xff, 0xe2, 0xcb, 0xbc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xeb, 0xea, 0xea, 0xff, 0xb6, 0xad, 0x98, 0xff, 0xbb, 0x95, 0x78, 0xff, 0xde, 0x99, 0x88, 0xff, 0xd1, 0x92, 0x83, 0xff, 0xc8, 0xad, 0x96, 0xff, 0xf9, 0xed, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xcb, 0xbe, 0xff, 0xb2, 0x9c, 0x8b, 0xff, 0xcb, 0x95, 0x83, 0xff, 0xd8, 0x9f, 0x8a, 0xff, 0xcf, 0xa1, 0x8a, 0xff, 0xc6, 0x9c, 0x84, 0xff, 0xc2, 0x99, 0x82, 0xff, 0xc6, 0x9c, 0x84, 0xff, 0xd3, 0xa1, 0x8b, 0xff, 0xd2, 0x9e, 0x86, 0xff, 0xc0, 0x93, 0x7a, 0xff, 0xcd, 0xaf, 0x9c, 0xff, 0xff, 0xf0, 0xe1, 0xff, 0xd4, 0xd1, 0xe2, 0xff, 0x4b, 0x6b, 0x94, 0xff, 0x0b, 0x3b, 0x65, 0xff, 0x1c, 0x37, 0x64, 0xff, 0x3e, 0x57, 0x77, 0xff, 0x2e, 0x4c, 0x6a, 0xff, 0x24, 0x3f, 0x62, 0xff, 0x36, 0x50, 0x72, 0xff, 0x30, 0x45, 0x68, 0xff, 0x35, 0x47, 0x6c, 0xff, 0x42, 0x5b, 0x7c, 0xff, 0x29, 0x46, 0x65, 0xff, 0x2e, 0x44, 0x67, 0xff, 0x47, 0x5e, 0x83, 0xff, 0x41, 0x62, 0x88, 0xff, 0x3c, 0x62, 0x88, 0xfe, 0x3f, 0x67, 0x8f, 0xb4, 0x46, 0x69, 0x91, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xb6, 0xa0, 0x23, 0xc1, 0x97, 0x7d, 0x88, 0xd3, 0xa2, 0x89, 0xe6, 0xcc, 0x97, 0x82, 0xff, 0xbd, 0xa3, 0x96, 0xff, 0xeb, 0xe2, 0xda, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xeb, 0xd3, 0xcb, 0xff, 0xc0, 0x9c, 0x93, 0xff, 0xc9, 0x97, 0x7d, 0xff, 0xd2, 0x9d, 0x7d, 0xff, 0xbc, 0x94, 0x7d, 0xff, 0xca, 0xb3, 0xa9, 0xff, 0xfa, 0xf5, 0xf9, 0xff, 0xfe, 0xff, 0xf4, 0xff, 0xd7, 0xbf, 0xa7, 0xff, 0xc9, 0x8f, 0x7e, 0xff, 0xd4, 0x95, 0x82, 0xff, 0xc3, 0x94, 0x7a, 0xff, 0xba, 0x96, 0x89, 0xff, 0xdf, 0xcf, 0xca, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xeb, 0xe7, 0xd8, 0xff, 0xcb, 0xa2, 0x9b, 0xff, 0xc0, 0x90, 0x7d, 0xff, 0xc7, 0x98, 0x7d, 0xff, 0xd5, 0xa2, 0x89, 0xff, 0xd4, 0xa1, 0x89, 0xff, 0xd0, 0x9e, 0x84, 0xff, 0xc2, 0x95, 0x7f, 0xff, 0xb8, 0x90, 0x7d, 0xff, 0xe0, 0xc4, 0xb3, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xdb, 0xde, 0xe2, 0xff, 0x66, 0x73, 0x97, 0xff, 0x1a, 0x42, 0x74, 0xff, 0x10, 0x41, 0x6a, 0xff, 0x2f, 0x4a, 0x6f, 0xff, 0x36, 0x4e, 0x6d, 0xff, 0x2f, 0x4d, 0x6c, 0xff, 0x2f, 0x49, 0x6c, 0xff, 0x34, 0x4e, 0x70, 0xff, 0x2e, 0x43, 0x66, 0xff, 0x38, 0x4a, 0x6d, 0xff, 0x39, 0x52, 0x72, 0xff, 0x21, 0x3e, 0x5d, 0xff, 0x2e, 0x44, 0x68, 0xff, 0x44, 0x5b, 0x81, 0xe7, 0x43, 0x65, 0x8a, 0x88, 0x41, 0x66, 0x8a, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x99, 0x66, 0x05, 0xcb, 0x97, 0x86, 0x4a, 0xcf, 0x9d, 0x7d, 0xa0, 0xc5, 0x9d, 0x84, 0xef, 0xd8, 0xca, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xea, 0xe5, 0xff, 0xc9, 0xa7, 0x9a, 0xff, 0xc5, 0x90, 0x7a, 0xff, 0xce, 0x9b, 0x80, 0xff, 0xc5, 0x94, 0x7f, 0xff, 0xcc, 0x9c, 0x95, 0xff, 0xee, 0xd9, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xd3, 0xc4, 0xff, 0xb8, 0x98, 0x82, 0xff, 0xc9, 0x92, 0x78, 0xff, 0xd2, 0x97, 0x7d, 0xff, 0xc2, 0x91, 0x7a, 0xff, 0xd7, 0xb5, 0xa7, 0xff, 0xff, 0xf4, 0xee, 0xff, 0xfa, 0xf8, 0xfa, 0xff, 0xcd, 0xbe, 0xb2, 0xff, 0xbe, 0x9b, 0x85, 0xff, 0xcc, 0x9c, 0x8a, 0xff, 0xcb, 0x98, 0x86, 0xff, 0xbc, 0x8f, 0x7c, 0xff, 0xc2, 0xa5, 0x96, 0xff, 0xec, 0xdf, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xcf, 0xda, 0xff, 0x6a, 0x74, 0x94, 0xff, 0x39, 0x48, 0x74, 0xff, 0x1c, 0x41, 0x66, 0xff, 0x21, 0x50, 0x6e, 0xff, 0x2d, 0x44, 0x62, 0xff, 0x2e, 0x4c, 0x6a, 0xff, 0x3c, 0x5e, 0x7e, 0xff, 0x30, 0x49, 0x6c, 0xff, 0x2e, 0x47, 0x6b, 0xff, 0x31, 0x45, 0x69, 0xff, 0x43, 0x55, 0x79, 0xff, 0x37, 0x51, 0x70, 0xef, 0x21, 0x3f, 0x5e, 0xa0, 0x2c, 0x44, 0x67, 0x4a, 0x33, 0x66, 0x66, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x91, 0x6d, 0x07, 0xb9, 0x91, 0x7b, 0x46, 0xce, 0xb3, 0xa8, 0x8e, 0xff, 0xf5, 0xf0, 0xd7, 0xff, 0xfd, 0xfc, 0xff, 0xce, 0xb6, 0xb1, 0xff, 0xc3, 0x8a, 0x7e, 0xff, 0xd5, 0x93, 0x80, 0xff, 0xcc, 0x95, 0x7d, 0xff, 0xbf, 0x8d, 0x7c, 0xff, 0xdb, 0xc5, 0xb8, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xec, 0xef, 0xdf, 0xff, 0xc8, 0xa2, 0x95, 0xff, 0xc0, 0x8d, 0x74, 0xff, 0xcb, 0x98, 0x77, 0xff, 0xc3, 0x8e, 0x77, 0xff, 0xc7, 0x9e, 0x90, 0xff, 0xe3, 0xd6, 0xcf, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfb, 0xf2, 0xea, 0xff, 0xe1, 0xd1, 0xcd, 0xff, 0xd5, 0xc4, 0xc0, 0xff, 0xe4, 0xd5, 0xce, 0xff, 0xfd, 0xfd, 0xef, 0xff, 0xff, 0xfa, 0xf2, 0xff, 0xd7, 0xb4, 0xbd, 0xff, 0x6c, 0x71, 0x86, 0xff, 0x38, 0x59, 0x7a, 0xff, 0x2b, 0x42, 0x68, 0xff, 0x23, 0x3f, 0x60, 0xff, 0x27, 0x4a, 0x67, 0xff, 0x3b, 0x53, 0x73, 0xff, 0x40, 0x5d, 0x7e, 0xff, 0x37, 0x56, 0x79, 0xff, 0x29, 0x44, 0x65, 0xff, 0x2e, 0x49, 0x66, 0xd7, 0x39, 0x50, 0x6d, 0x8e, 0x41, 0x53, 0x78, 0x46, 0x24, 0x48, 0x6d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xe2, 0xd9, 0x1b, 0xff, 0xff, 0xfc, 0x55, 0xe9, 0xc9, 0xc9, 0x8f, 0xbe, 0x93, 0x86, 0xc2, 0xbd, 0x94, 0x7a, 0xea, 0xd0, 0x9a, 0x79, 0xff, 0xba, 0x8d, 0x70, 0xff, 0xbb, 0xad, 0xa1, 0xff, 0xf9, 0xf3, 0xf0, 0xff, 0xff, 0xf5, 0xf1, 0xff, 0xca, 0xb3, 0xa5, 0xff, 0xb3, 0x92, 0x7b, 0xff, 0xc8, 0x98, 0x7d, 0xff, 0xc6, 0x94, 0x78, 0xff, 0xbb, 0x90, 0x77, 0xff, 0xcd, 0xb4, 0xa7, 0xff, 0xf0, 0xe6, 0xe3, 0xff, 0xfc, 0xf9, 0xfa, 0xff, 0xfd, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xe4, 0xde, 0xcc, 0xff, 0xca, 0xa0, 0x97, 0xff, 0x9f, 0x71, 0x7f, 0xff, 0x4b, 0x5e, 0x75, 0xff, 0x2e, 0x54, 0x6e, 0xff, 0x2b, 0x45, 0x65, 0xff, 0x2e, 0x48, 0x6b, 0xff, 0x43, 0x5b, 0x7f, 0xea, 0x59, 0x73, 0x97, 0xc2, 0x33, 0x4c, 0x70, 0x8f, 0x2a, 0x42, 0x66, 0x55, 0x2f, 0x4b, 0x67, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x96, 0x78, 0x11, 0xc2, 0x99, 0x7d, 0x37, 0xbe, 0x86, 0x78, 0x5f, 0xc0, 0x92, 0x8c, 0x86, 0xe6, 0xd9, 0xcf, 0xa8, 0xff, 0xfb, 0xf3, 0xc0, 0xe1, 0xc9, 0xc0, 0xd3, 0xc6, 0x9c, 0x86, 0xe6, 0xca, 0x98, 0x7b, 0xee, 0xc7, 0x9a, 0x7b, 0xf5, 0xb7, 0x8d, 0x76, 0xff, 0xbd, 0x97, 0x89, 0xff, 0xcd, 0xac, 0xa3, 0xf5, 0xd5, 0xb8, 0xac, 0xee, 0xc9, 0xac, 0x99, 0xe6, 0xc0, 0x92, 0x7d, 0xd3, 0xad, 0x84, 0x7c, 0xc0, 0x67, 0x6a, 0x73, 0xa8, 0x3e, 0x5d, 0x74, 0x86, 0x48, 0x55, 0x70, 0x5f, 0x4e, 0x5c, 0x7d, 0x37, 0x4b, 0x69, 0x87, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const lv_image_dsc_t img_multilang_avatar_11 = {
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .header.w = 128,
+    .header.h = 128,
+    .header.stride = 512,
+    .data = img_multilang_avatar_11_map,
+    .data_size = sizeof(img_multilang_avatar_11_map),
+};
+
+#endif
@@ -0,0 +1,166 @@
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+#if LV_USE_DEMO_MULTILANG
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_12
+    #define LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_12
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_12 uint8_t
+img_multilang_avatar_12_map[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x96, 0x69, 0x11, 0xcc, 0xa6, 0x61, 0x37, 0xd9, 0xaa, 0x56, 0x5e, 0xe6, 0xb2, 0x55, 0x86, 0xeb, 0xba, 0x4d, 0xa8, 0xec, 0xbc, 0x46, 0xbf, 0xec, 0xbd, 0x42, 0xd2, 0xed, 0xbf, 0x40, 0xe5, 0xeb, 0xbb, 0x41, 0xee, 0xe6, 0xb6, 0x49, 0xf2, 0xdf, 0xb1, 0x4a, 0xff, 0xe4, 0xaf, 0x4a, 0xff, 0xe0, 0xab, 0x58, 0xf2, 0xca, 0xa1, 0x66, 0xee, 0xac, 0x8a, 0x70, 0xe5, 0x96, 0x77, 0x7b, 0xd2, 0x95, 0x72, 0x7d, 0xbf, 0xa6, 0x77, 0x7c, 0xa8, 0xad, 0x79, 0x70, 0x86, 0xb8, 0x7c, 0x6f, 0x5e, 0xb9, 0x7d, 0x73, 0x37, 0xb4, 0x78, 0x78, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x84, 0x5b, 0x19, 0xb1, 0x84, 0x5d, 0x55, 0xac, 0x82, 0x5c, 0x8f, 0xae, 0x85, 0x63, 0xc1, 0xb3, 0x8d, 0x65, 0xe9, 0xc1, 0x99, 0x65, 0xff, 0xd3, 0xa8, 0x5c, 0xff, 0xde, 0xb1, 0x4d, 0xff, 0xea, 0xb9, 0x48, 0xff, 0xed, 0xc0, 0x40, 0xff, 0xf0, 0xc0, 0x39, 0xff, 0xf1, 0xc2, 0x37, 0xff, 0xf2, 0xc2, 0x35, 0xff, 0xf3, 0xc1, 0x34, 0xff, 0xf1, 0xbd, 0x38, 0xff, 0xe9, 0xbb, 0x3d, 0xff, 0xe7, 0xb5, 0x49, 0xff, 0xd5, 0xa8, 0x60, 0xff, 0xbd, 0x9b, 0x66, 0xff, 0x9f, 0x85, 0x69, 0xff, 0x8f, 0x76, 0x74, 0xff, 0x95, 0x76, 0x7a, 0xff, 0xa1, 0x79, 0x74, 0xff, 0xa6, 0x76, 0x69, 0xff, 0xaf, 0x76, 0x65, 0xff, 0xb1, 0x72, 0x66, 0xff, 0xb7, 0x74, 0x6e, 0xff, 0xbb, 0x77, 0x72, 0xe9, 0xb7, 0x72, 0x6d, 0xc1, 0xbb, 0x79, 0x6e, 0x8f, 0xc0, 0x81, 0x6c, 0x55, 0xcc, 0x84, 0x66, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x91, 0x48, 0x07, 0xbd, 0x83, 0x53, 0x46, 0xbc, 0x7f, 0x54, 0x8e, 0xba, 0x7b, 0x5a, 0xd7, 0xb1, 0x7b, 0x5e, 0xff, 0xae, 0x7f, 0x5e, 0xff, 0xb1, 0x82, 0x61, 0xff, 0xb3, 0x87, 0x64, 0xff, 0xb9, 0x91, 0x5e, 0xff, 0xc8, 0x9c, 0x5a, 0xff, 0xdb, 0xad, 0x4f, 0xff, 0xe5, 0xba, 0x3e, 0xff, 0xee, 0xc0, 0x39, 0xff, 0xef, 0xc5, 0x2e, 0xff, 0xef, 0xc8, 0x23, 0xff, 0xf4, 0xca, 0x20, 0xff, 0xf7, 0xc9, 0x1e, 0xff, 0xf7, 0xc6, 0x1e, 0xff, 0xf1, 0xc1, 0x24, 0xff, 0xee, 0xc1, 0x29, 0xff, 0xea, 0xba, 0x3c, 0xff, 0xcf, 0xa6, 0x5c, 0xff, 0xb3, 0x8f, 0x63, 0xff, 0x9c, 0x7e, 0x63, 0xff, 0x95, 0x78, 0x70, 0xff, 0xa1, 0x7c, 0x79, 0xff, 0xaa, 0x7d, 0x72, 0xff, 0xaf, 0x79, 0x6b, 0xff, 0xb4, 0x76, 0x67, 0xff, 0xb7, 0x76, 0x67, 0xff, 0xba, 0x7a, 0x6a, 0xff, 0xba, 0x78, 0x69, 0xff, 0xc0, 0x7c, 0x6b, 0xff, 0xc5, 0x81, 0x6c, 0xff, 0xc9, 0x86, 0x69, 0xff, 0xcf, 0x89, 0x68, 0xff, 0xd4, 0x8a, 0x67, 0xd7, 0xd2, 0x8f, 0x66, 0x8e, 0xd3, 0x8e, 0x69, 0x46, 0xda, 0x91, 0x6d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x99, 0x66, 0x05, 0xb8, 0x86, 0x6a, 0x48, 0xb5, 0x81, 0x60, 0x9f, 0xb3, 0x7d, 0x54, 0xef, 0xb9, 0x82, 0x4f, 0xff, 0xbc, 0x86, 0x50, 0xff, 0xbb, 0x7e, 0x56, 0xff, 0xb8, 0x7c, 0x5c, 0xff, 0xb6, 0x7d, 0x5e, 0xff, 0xb7, 0x7f, 0x5f, 0xff, 0xbe, 0x88, 0x5d, 0xff, 0xc6, 0x96, 0x51, 0xff, 0xd3, 0xa2, 0x4a, 0xff, 0xe0, 0xb2, 0x3f, 0xff, 0xe9, 0xbf, 0x2e, 0xff, 0xf0, 0xc3, 0x2a, 0xff, 0xef, 0xc5, 0x28, 0xff, 0xef, 0xc6, 0x24, 0xff, 0xf2, 0xc7, 0x21, 0xff, 0xf6, 0xc7, 0x1e, 0xff, 0xf8, 0xc5, 0x1f, 0xff, 0xf5, 0xc5, 0x23, 0xff, 0xf2, 0xc5, 0x1d, 0xff, 0xe9, 0xba, 0x29, 0xff, 0xce, 0xa7, 0x4c, 0xff, 0xb8, 0x94, 0x55, 0xff, 0xa6, 0x88, 0x55, 0xff, 0xa3, 0x84, 0x5f, 0xff, 0xb0, 0x85, 0x65, 0xff, 0xb8, 0x85, 0x62, 0xff, 0xb9, 0x80, 0x5e, 0xff, 0xb8, 0x7c, 0x59, 0xff, 0xb6, 0x7d, 0x59, 0xff, 0xb7, 0x81, 0x5f, 0xff, 0xbd, 0x82, 0x67, 0xff, 0xc2, 0x82, 0x6b, 0xff, 0xc6, 0x84, 0x6c, 0xff, 0xcd, 0x84, 0x70, 0xff, 0xd5, 0x85, 0x72, 0xff, 0xda, 0x89, 0x72, 0xff, 0xdb, 0x8f, 0x71, 0xff, 0xd7, 0x8b, 0x6e, 0xff, 0xd9, 0x87, 0x76, 0xef, 0xda, 0x85, 0x7b, 0x9f, 0xd4, 0x86, 0x74, 0x48, 0xcc, 0x99, 0x66, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x8a, 0x74, 0x23, 0xb2, 0x87, 0x74, 0x86, 0xb5, 0x84, 0x70, 0xe5, 0xb7, 0x7f, 0x6d, 0xff, 0xba, 0x7e, 0x60, 0xff, 0xba, 0x7f, 0x56, 0xff, 0xbb, 0x82, 0x50, 0xff, 0xb8, 0x7f, 0x4a, 0xff, 0xb6, 0x7f, 0x4f, 0xff, 0xb6, 0x7c, 0x56, 0xff, 0xb5, 0x79, 0x59, 0xff, 0xb7, 0x7e, 0x56, 0xff, 0xbf, 0x8b, 0x51, 0xff, 0xc7, 0x9a, 0x48, 0xff, 0xd0, 0xaa, 0x45, 0xff, 0xdd, 0xb9, 0x42, 0xff, 0xea, 0xc3, 0x38, 0xff, 0xea, 0xc6, 0x36, 0xff, 0xe5, 0xc5, 0x40, 0xff, 0xe9, 0xc6, 0x47, 0xff, 0xe9, 0xc9, 0x49, 0xff, 0xea, 0xcb, 0x45, 0xff, 0xe9, 0xc9, 0x3f, 0xff, 0xed, 0xc6, 0x3b, 0xff, 0xf4, 0xc5, 0x32, 0xff, 0xe8, 0xbc, 0x32, 0xff, 0xd1, 0xb1, 0x3f, 0xff, 0xc2, 0xa5, 0x42, 0xff, 0xb2, 0x99, 0x46, 0xff, 0xb1, 0x92, 0x4f, 0xff, 0xba, 0x90, 0x50, 0xff, 0xbe, 0x8f, 0x52, 0xff, 0xbf, 0x8b, 0x50, 0xff, 0xbb, 0x83, 0x4f, 0xff, 0xb5, 0x81, 0x57, 0xff, 0xb7, 0x84, 0x5f, 0xff, 0xbe, 0x86, 0x6a, 0xff, 0xc3, 0x81, 0x71, 0xff, 0xc7, 0x82, 0x73, 0xff, 0xcf, 0x83, 0x78, 0xff, 0xd8, 0x85, 0x7d, 0xff, 0xde, 0x8a, 0x7d, 0xff, 0xdd, 0x8d, 0x79, 0xff, 0xd8, 0x88, 0x7a, 0xff, 0xdc, 0x84, 0x81, 0xff, 0xdf, 0x85, 0x82, 0xff, 0xd5, 0x82, 0x77, 0xff, 0xcf, 0x80, 0x70, 0xe5, 0xc7, 0x7d, 0x72, 0x86, 0xbd, 0x74, 0x6d, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x81, 0x6d, 0x41, 0xaf, 0x83, 0x6f, 0xb4, 0xb0, 0x83, 0x75, 0xfe, 0xb3, 0x83, 0x71, 0xff, 0xb3, 0x80, 0x6e, 0xff, 0xb3, 0x7b, 0x69, 0xff, 0xb7, 0x77, 0x5c, 0xff, 0xbe, 0x7b, 0x53, 0xff, 0xbe, 0x7e, 0x50, 0xff, 0xb5, 0x77, 0x4d, 0xff, 0xb5, 0x78, 0x54, 0xff, 0xaf, 0x75, 0x59, 0xff, 0xac, 0x76, 0x59, 0xff, 0xab, 0x81, 0x4f, 0xff, 0xb3, 0x91, 0x4d, 0xff, 0xc3, 0xab, 0x51, 0xff, 0xd1, 0xbc, 0x57, 0xff, 0xda, 0xc2, 0x5c, 0xff, 0xe2, 0xc8, 0x61, 0xff, 0xeb, 0xd4, 0x77, 0xff, 0xee, 0xdc, 0x8f, 0xff, 0xf0, 0xe2, 0x9d, 0xff, 0xef, 0xe6, 0xa1, 0xff, 0xed, 0xe5, 0x9b, 0xff, 0xeb, 0xe2, 0x91, 0xff, 0xe8, 0xd5, 0x7c, 0xff, 0xe5, 0xc7, 0x5f, 0xff, 0xe2, 0xbf, 0x4f, 0xff, 0xd7, 0xb6, 0x47, 0xff, 0xcc, 0xaa, 0x41, 0xff, 0xbd, 0x9e, 0x45, 0xff, 0xb9, 0x97, 0x4d, 0xff, 0xba, 0x91, 0x4c, 0xff, 0xbe, 0x8e, 0x52, 0xff, 0xc2, 0x8d, 0x58, 0xff, 0xbf, 0x88, 0x5d, 0xff, 0xb9, 0x83, 0x64, 0xff, 0xb9, 0x80, 0x6d, 0xff, 0xbe, 0x80, 0x74, 0xff, 0xc5, 0x82, 0x79, 0xff, 0xcc, 0x84, 0x7d, 0xff, 0xd5, 0x89, 0x81, 0xff, 0xdb, 0x8a, 0x81, 0xff, 0xdd, 0x88, 0x7f, 0xff, 0xdb, 0x88, 0x7e, 0xff, 0xdc, 0x89, 0x82, 0xff, 0xde, 0x85, 0x84, 0xff, 0xde, 0x83, 0x82, 0xff, 0xd9, 0x83, 0x7d, 0xff, 0xd1, 0x80, 0x7a, 0xff, 0xc9, 0x7a, 0x7f, 0xff, 0xc3, 0x73, 0x7f, 0xfe, 0xb2, 0x6b, 0x88, 0xb4, 0xa0, 0x62, 0x95, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x75, 0x64, 0x4c, 0xa2, 0x78, 0x65, 0xcb, 0xa7, 0x7c, 0x6b, 0xff, 0xad, 0x7f, 0x70, 0xff, 0xb3, 0x7e, 0x6f, 0xff, 0xb5, 0x7e, 0x69, 0xff, 0xb1, 0x7c, 0x62, 0xff, 0xb2, 0x77, 0x5e, 0xff, 0xb8, 0x74, 0x59, 0xff, 0xbc, 0x73, 0x53, 0xff, 0xb9, 0x72, 0x51, 0xff, 0xb3, 0x70, 0x52, 0xff, 0xb1, 0x6e, 0x54, 0xff, 0xa7, 0x71, 0x50, 0xff, 0xa8, 0x7e, 0x51, 0xff, 0xb0, 0x8f, 0x55, 0xff, 0xb4, 0xa1, 0x58, 0xff, 0xc2, 0xb7, 0x65, 0xff, 0xd1, 0xc7, 0x75, 0xff, 0xdc, 0xd7, 0x89, 0xff, 0xee, 0xe8, 0xaa, 0xff, 0xfc, 0xf9, 0xcf, 0xff, 0xff, 0xff, 0xe6, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xfe, 0xff, 0xf5, 0xff, 0xfe, 0xff, 0xed, 0xff, 0xff, 0xfd, 0xd3, 0xff, 0xfa, 0xeb, 0xb1, 0xff, 0xec, 0xd2, 0x83, 0xff, 0xe1, 0xbf, 0x60, 0xff, 0xcc, 0xac, 0x55, 0xff, 0xbd, 0x9b, 0x51, 0xff, 0xbd, 0x95, 0x56, 0xff, 0xbc, 0x8f, 0x58, 0xff, 0xbe, 0x89, 0x5f, 0xff, 0xb7, 0x83, 0x64, 0xff, 0xb5, 0x80, 0x6e, 0xff, 0xb8, 0x82, 0x76, 0xff, 0xb9, 0x81, 0x78, 0xff, 0xbb, 0x81, 0x78, 0xff, 0xc3, 0x84, 0x7d, 0xff, 0xca, 0x86, 0x86, 0xff, 0xd3, 0x8a, 0x87, 0xff, 0xd8, 0x8b, 0x80, 0xff, 0xd9, 0x8a, 0x7d, 0xff, 0xdb, 0x8c, 0x83, 0xff, 0xdf, 0x8d, 0x88, 0xff, 0xdf, 0x8a, 0x84, 0xff, 0xdd, 0x86, 0x82, 0xff, 0xdb, 0x86, 0x84, 0xff, 0xd6, 0x80, 0x89, 0xff, 0xcf, 0x7b, 0x93, 0xff, 0xcc, 0x75, 0x97, 0xff, 0xbe, 0x6f, 0xa5, 0xff, 0xa7, 0x64, 0xb1, 0xff, 0x92, 0x55, 0xb7, 0xcb, 0x7d, 0x4f, 0xb9, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x6d, 0x5e, 0x46, 0x94, 0x6e, 0x62, 0xc9, 0x98, 0x71, 0x65, 0xff, 0x99, 0x71, 0x66, 0xff, 0x9f, 0x75, 0x67, 0xff, 0xa8, 0x79, 0x67, 0xff, 0xb0, 0x77, 0x64, 0xff, 0xaf, 0x77, 0x5b, 0xff, 0xb0, 0x79, 0x55, 0xff, 0xb7, 0x75, 0x54, 0xff, 0xb5, 0x6c, 0x51, 0xff, 0xb1, 0x66, 0x51, 0xff, 0xac, 0x66, 0x51, 0xff, 0xac, 0x65, 0x4e, 0xff, 0xab, 0x65, 0x4b, 0xff, 0xa4, 0x73, 0x40, 0xff, 0xa2, 0x88, 0x45, 0xff, 0xa7, 0x9a, 0x59, 0xff, 0xb3, 0xb8, 0x6e, 0xff, 0xc6, 0xcf, 0x8a, 0xff, 0xe2, 0xe6, 0xae, 0xff, 0xf8, 0xfb, 0xd7, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xfc, 0xf8, 0xd0, 0xff, 0xe6, 0xd8, 0x99, 0xff, 0xc6, 0xb4, 0x77, 0xff, 0xb7, 0x9b, 0x67, 0xff, 0xbd, 0x93, 0x6b, 0xff, 0xc0, 0x8c, 0x6f, 0xff, 0xbd, 0x86, 0x70, 0xff, 0xb2, 0x80, 0x76, 0xff, 0xaf, 0x80, 0x84, 0xff, 0xb3, 0x7e, 0x88, 0xff, 0xb3, 0x7f, 0x83, 0xff, 0xb5, 0x7f, 0x7f, 0xff, 0xbd, 0x80, 0x89, 0xff, 0xc2, 0x7f, 0x95, 0xff, 0xcc, 0x82, 0x9b, 0xff, 0xd4, 0x89, 0x92, 0xff, 0xd8, 0x8d, 0x8b, 0xff, 0xd9, 0x8f, 0x8f, 0xff, 0xdb, 0x8b, 0x96, 0xff, 0xdf, 0x88, 0x94, 0xff, 0xe1, 0x89, 0x95, 0xff, 0xdc, 0x86, 0x99, 0xff, 0xd9, 0x7f, 0x9a, 0xff, 0xd5, 0x7b, 0xa0, 0xff, 0xd2, 0x79, 0xa4, 0xff, 0xc4, 0x73, 0xb0, 0xff, 0xb1, 0x6a, 0xbb, 0xff, 0xa0, 0x5f, 0xc3, 0xff, 0x8d, 0x57, 0xcb, 0xff, 0x81, 0x53, 0xc3, 0xc9, 0x7f, 0x57, 0xb6, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x63, 0x55, 0x24, 0x86, 0x67, 0x59, 0xb4, 0x89, 0x68, 0x5a, 0xff, 0x8f, 0x67, 0x5c, 0xff, 0x95, 0x69, 0x5c, 0xff, 0x96, 0x6d, 0x5f, 0xff, 0x99, 0x71, 0x5f, 0xff, 0xa1, 0x72, 0x5d, 0xff, 0xaa, 0x71, 0x59, 0xff, 0xae, 0x70, 0x53, 0xff, 0xad, 0x6f, 0x50, 0xff, 0xaf, 0x6c, 0x4b, 0xff, 0xb0, 0x65, 0x46, 0xff, 0xab, 0x62, 0x49, 0xff, 0xa0, 0x60, 0x49, 0xff, 0x9c, 0x61, 0x46, 0xff, 0xa2, 0x63, 0x41, 0xff, 0x9d, 0x71, 0x41, 0xff, 0x92, 0x88, 0x51, 0xff, 0xa3, 0xa6, 0x71, 0xff, 0xc1, 0xcf, 0x9c, 0xff, 0xe6, 0xf2, 0xc7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xfc, 0xfa, 0xce, 0xff, 0xdb, 0xcf, 0x9e, 0xff, 0xb6, 0xa5, 0x7a, 0xff, 0xb7, 0x97, 0x73, 0xff, 0xc0, 0x91, 0x74, 0xff, 0xbf, 0x8a, 0x74, 0xff, 0xb6, 0x84, 0x7f, 0xff, 0xb2, 0x82, 0x88, 0xff, 0xb5, 0x7b, 0x95, 0xff, 0xb4, 0x7d, 0x98, 0xff, 0xb4, 0x7e, 0x98, 0xff, 0xba, 0x7e, 0xa2, 0xff, 0xc0, 0x7b, 0xa9, 0xff, 0xc5, 0x7d, 0xad, 0xff, 0xd0, 0x86, 0xad, 0xff, 0xd9, 0x8b, 0xa6, 0xff, 0xd9, 0x8c, 0xa0, 0xff, 0xda, 0x8a, 0xa2, 0xff, 0xdd, 0x89, 0xa2, 0xff, 0xdf, 0x89, 0xa2, 0xff, 0xdf, 0x86, 0xa4, 0xff, 0xdc, 0x82, 0xa6, 0xff, 0xd8, 0x7d, 0xa9, 0xff, 0xd1, 0x7d, 0xae, 0xff, 0xc3, 0x73, 0xb8, 0xff, 0xb4, 0x68, 0xc0, 0xff, 0xaa, 0x65, 0xc8, 0xff, 0x9d, 0x62, 0xd3, 0xff, 0x94, 0x62, 0xd2, 0xff, 0x93, 0x63, 0xcd, 0xff, 0x93, 0x66, 0xc1, 0xb5, 0x9b, 0x6a, 0xb1, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x55, 0x55, 0x09, 0x7e, 0x60, 0x51, 0x87, 0x80, 0x60, 0x51, 0xf9, 0x83, 0x63, 0x52, 0xff, 0x84, 0x63, 0x52, 0xff, 0x88, 0x63, 0x52, 0xff, 0x90, 0x65, 0x52, 0xff, 0x93, 0x69, 0x53, 0xff, 0x94, 0x6c, 0x53, 0xff, 0x99, 0x6c, 0x55, 0xff, 0xa2, 0x6b, 0x53, 0xff, 0xa6, 0x68, 0x50, 0xff, 0xa3, 0x65, 0x4a, 0xff, 0xa1, 0x60, 0x40, 0xff, 0xa3, 0x5c, 0x3a, 0xff, 0x9f, 0x5a, 0x3a, 0xff, 0x94, 0x56, 0x3b, 0xff, 0x8d, 0x59, 0x39, 0xff, 0x8a, 0x5a, 0x35, 0xff, 0x85, 0x6a, 0x43, 0xff, 0x82, 0x8d, 0x68, 0xff, 0xb2, 0xc2, 0xa4, 0xff, 0xde, 0xed, 0xd6, 0xff, 0xf9, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xf9, 0xf6, 0xd4, 0xff, 0xcc, 0xc3, 0x9e, 0xff, 0xb5, 0x9b, 0x7a, 0xff, 0xbf, 0x92, 0x76, 0xff, 0xc2, 0x8a, 0x7d, 0xff, 0xbd, 0x84, 0x8b, 0xff, 0xb7, 0x80, 0x90, 0xff, 0xbb, 0x7e, 0xa0, 0xff, 0xbc, 0x7d, 0xb1, 0xff, 0xb7, 0x7b, 0xb9, 0xff, 0xb6, 0x7b, 0xc1, 0xff, 0xba, 0x7e, 0xc3, 0xff, 0xbc, 0x7d, 0xbe, 0xff, 0xc9, 0x82, 0xc0, 0xff, 0xd4, 0x87, 0xbf, 0xff, 0xd6, 0x88, 0xba, 0xff, 0xd7, 0x8a, 0xb4, 0xff, 0xd7, 0x8a, 0xaf, 0xff, 0xda, 0x8a, 0xae, 0xff, 0xda, 0x86, 0xae, 0xff, 0xd9, 0x82, 0xb3, 0xff, 0xd6, 0x7c, 0xba, 0xff, 0xcf, 0x7a, 0xbb, 0xff, 0xc3, 0x72, 0xc2, 0xff, 0xb9, 0x67, 0xc8, 0xff, 0xb2, 0x67, 0xce, 0xff, 0xa8, 0x65, 0xd6, 0xff, 0xa0, 0x65, 0xd6, 0xff, 0x9f, 0x66, 0xd4, 0xff, 0xa1, 0x6a, 0xcd, 0xff, 0xaa, 0x6d, 0xc5, 0xf9, 0xb7, 0x78, 0xb7, 0x87, 0xc6, 0x8d, 0xaa, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x5b, 0x53, 0x40, 0x71, 0x5d, 0x50, 0xda, 0x77, 0x5f, 0x4f, 0xff, 0x7a, 0x60, 0x4f, 0xff, 0x7b, 0x61, 0x4b, 0xff, 0x7e, 0x60, 0x4a, 0xff, 0x85, 0x61, 0x49, 0xff, 0x8b, 0x62, 0x47, 0xff, 0x8f, 0x65, 0x45, 0xff, 0x8f, 0x68, 0x45, 0xff, 0x92, 0x67, 0x48, 0xff, 0x9a, 0x64, 0x48, 0xff, 0x97, 0x5e, 0x46, 0xff, 0x97, 0x5c, 0x42, 0xff, 0x97, 0x5b, 0x38, 0xff, 0x91, 0x56, 0x2f, 0xff, 0x8e, 0x51, 0x2c, 0xff, 0x87, 0x4e, 0x2d, 0xff, 0x7f, 0x54, 0x30, 0xff, 0x74, 0x56, 0x2c, 0xff, 0x73, 0x6f, 0x47, 0xff, 0x8a, 0xa9, 0x86, 0xff, 0xc8, 0xe8, 0xcd, 0xff, 0xef, 0xff, 0xf6, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfb, 0xfe, 0xfb, 0xff, 0xfb, 0xfe, 0xfb, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xfa, 0xfe, 0xfc, 0xff, 0xf7, 0xfd, 0xfb, 0xff, 0xfa, 0xfe, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xe7, 0xe9, 0xd2, 0xff, 0xbd, 0xa9, 0x97, 0xff, 0xba, 0x8e, 0x8a, 0xff, 0xc4, 0x89, 0x9b, 0xff, 0xc3, 0x81, 0xaa, 0xff, 0xc6, 0x87, 0xb6, 0xff, 0xbf, 0x82, 0xb8, 0xff, 0xba, 0x7e, 0xc4, 0xff, 0xb3, 0x77, 0xd0, 0xff, 0xa8, 0x73, 0xd3, 0xff, 0xa9, 0x7c, 0xce, 0xff, 0xb2, 0x81, 0xca, 0xff, 0xba, 0x7e, 0xcd, 0xff, 0xc1, 0x7d, 0xcd, 0xff, 0xc5, 0x80, 0xca, 0xff, 0xca, 0x84, 0xcb, 0xff, 0xcb, 0x82, 0xc6, 0xff, 0xcf, 0x83, 0xc5, 0xff, 0xd1, 0x80, 0xc4, 0xff, 0xce, 0x7b, 0xc2, 0xff, 0xcb, 0x74, 0xc9, 0xff, 0xc8, 0x70, 0xc9, 0xff, 0xbf, 0x6c, 0xce, 0xff, 0xbb, 0x65, 0xd4, 0xff, 0xb6, 0x66, 0xd7, 0xff, 0xb0, 0x68, 0xda, 0xff, 0xad, 0x68, 0xdb, 0xff, 0xad, 0x68, 0xdc, 0xff, 0xad, 0x69, 0xdc, 0xff, 0xaf, 0x68, 0xd8, 0xff, 0xba, 0x74, 0xc8, 0xff, 0xc5, 0x83, 0xb5, 0xda, 0xcf, 0x89, 0x9c, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x48, 0x48, 0x07, 0x64, 0x59, 0x50, 0x8e, 0x66, 0x5f, 0x52, 0xfe, 0x6a, 0x60, 0x52, 0xff, 0x6f, 0x60, 0x4f, 0xff, 0x73, 0x62, 0x4d, 0xff, 0x71, 0x5e, 0x46, 0xff, 0x78, 0x5f, 0x44, 0xff, 0x84, 0x62, 0x44, 0xff, 0x88, 0x60, 0x3e, 0xff, 0x8b, 0x60, 0x39, 0xff, 0x8b, 0x63, 0x38, 0xff, 0x8c, 0x64, 0x3a, 0xff, 0x91, 0x60, 0x3b, 0xff, 0x91, 0x5a, 0x3b, 0xff, 0x8c, 0x55, 0x37, 0xff, 0x83, 0x50, 0x2c, 0xff, 0x7c, 0x4e, 0x25, 0xff, 0x7e, 0x4e, 0x23, 0xff, 0x7d, 0x4a, 0x26, 0xff, 0x63, 0x3f, 0x1c, 0xff, 0x5f, 0x4e, 0x1f, 0xff, 0x7c, 0x84, 0x56, 0xff, 0xab, 0xce, 0xa8, 0xff, 0xe2, 0xfb, 0xe6, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xf8, 0xfe, 0xfe, 0xff, 0xf7, 0xfd, 0xfe, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfa, 0xfd, 0xfd, 0xff, 0xfd, 0xfb, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xf8, 0xfd, 0xfb, 0xff, 0xf7, 0xfe, 0xf8, 0xff, 0xfc, 0xfe, 0xfa, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xfc, 0xfd, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf7, 0xff, 0xd9, 0xc9, 0xc9, 0xff, 0xbb, 0x95, 0xac, 0xff, 0xc7, 0x8c, 0xbe, 0xff, 0xc9, 0x82, 0xce, 0xff, 0xc9, 0x85, 0xd4, 0xff, 0xc3, 0x86, 0xd5, 0xff, 0xb4, 0x7b, 0xd7, 0xff, 0xa9, 0x71, 0xe5, 0xff, 0xa1, 0x6e, 0xe8, 0xff, 0xa3, 0x78, 0xdb, 0xff, 0xa5, 0x7b, 0xd2, 0xff, 0xab, 0x75, 0xd9, 0xff, 0xb4, 0x72, 0xe0, 0xff, 0xb2, 0x70, 0xd7, 0xff, 0xb7, 0x75, 0xd6, 0xff, 0xba, 0x74, 0xd1, 0xff, 0xc2, 0x77, 0xd2, 0xff, 0xc7, 0x75, 0xd2, 0xff, 0xc1, 0x71, 0xcc, 0xff, 0xc1, 0x6b, 0xd2, 0xff, 0xc1, 0x69, 0xd4, 0xff, 0xbf, 0x68, 0xd8, 0xff, 0xbb, 0x65, 0xdd, 0xff, 0xb6, 0x68, 0xdc, 0xff, 0xb3, 0x6c, 0xde, 0xff, 0xb4, 0x6c, 0xe0, 0xff, 0xb3, 0x6b, 0xdf, 0xff, 0xb2, 0x6b, 0xe1, 0xff, 0xb0, 0x67, 0xe1, 0xff, 0xb8, 0x72, 0xd3, 0xff, 0xc6, 0x85, 0xc0, 0xff, 0xcf, 0x8b, 0xa8, 0xfe, 0xd7, 0x8f, 0x8f, 0x8e, 0xda, 0x91, 0x6d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x5d, 0x57, 0x29, 0x6a, 0x60, 0x5a, 0xd1, 0x64, 0x62, 0x5a, 0xff, 0x64, 0x65, 0x5d, 0xff, 0x67, 0x65, 0x5b, 0xff, 0x66, 0x5f, 0x53, 0xff, 0x69, 0x5c, 0x4c, 0xff, 0x6b, 0x60, 0x47, 0xff, 0x70, 0x61, 0x41, 0xff, 0x7d, 0x5f, 0x3a, 0xff, 0x85, 0x5a, 0x2f, 0xff, 0x83, 0x5b, 0x2b, 0xff, 0x7f, 0x5e, 0x29, 0xff, 0x82, 0x5c, 0x2b, 0xff, 0x82, 0x54, 0x2e, 0xff, 0x80, 0x4f, 0x2e, 0xff, 0x7a, 0x4e, 0x28, 0xff, 0x73, 0x4d, 0x21, 0xff, 0x6e, 0x49, 0x21, 0xff, 0x6c, 0x42, 0x1d, 0xff, 0x6b, 0x3c, 0x1a, 0xff, 0x53, 0x32, 0x0a, 0xff, 0x51, 0x49, 0x0f, 0xff, 0x86, 0x9b, 0x67, 0xff, 0xc3, 0xe1, 0xcf, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfe, 0xfa, 0xff, 0xff, 0xf9, 0xfd, 0xff, 0xff, 0xf6, 0xfc, 0xff, 0xff, 0xfa, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfb, 0xfe, 0xff, 0xfd, 0xfc, 0xfe, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfa, 0xfe, 0xfa, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xfc, 0xfe, 0xfb, 0xff, 0xfa, 0xfa, 0xfe, 0xff, 0xfd, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xe7, 0xee, 0xff, 0xc3, 0x9e, 0xc7, 0xff, 0xc8, 0x93, 0xd4, 0xff, 0xe2, 0xa5, 0xf0, 0xff, 0xe6, 0xa8, 0xfa, 0xff, 0xd6, 0xa4, 0xf9, 0xff, 0xca, 0x9a, 0xfc, 0xff, 0xbc, 0x87, 0xff, 0xff, 0xa2, 0x6f, 0xf1, 0xff, 0x9d, 0x70, 0xe8, 0xff, 0xa0, 0x72, 0xea, 0xff, 0xa3, 0x6c, 0xee, 0xff, 0xa2, 0x65, 0xe9, 0xff, 0xa9, 0x69, 0xe8, 0xff, 0xa8, 0x69, 0xda, 0xff, 0xaa, 0x6a, 0xd2, 0xff, 0xb6, 0x6d, 0xd4, 0xff, 0xbb, 0x6b, 0xd2, 0xff, 0xbd, 0x6a, 0xd4, 0xff, 0xbf, 0x6a, 0xda, 0xff, 0xbc, 0x68, 0xdc, 0xff, 0xba, 0x68, 0xdd, 0xff, 0xb6, 0x67, 0xde, 0xff, 0xb4, 0x67, 0xdf, 0xff, 0xb5, 0x6b, 0xe3, 0xff, 0xb4, 0x6b, 0xe5, 0xff, 0xb4, 0x6c, 0xe4, 0xff, 0xb6, 0x6d, 0xe5, 0xff, 0xb4, 0x69, 0xe5, 0xff, 0xb4, 0x74, 0xd6, 0xff, 0xc5, 0x88, 0xc8, 0xff, 0xd0, 0x8e, 0xaf, 0xff, 0xd6, 0x92, 0x93, 0xff, 0xd7, 0x99, 0x80, 0xd1, 0xd9, 0xa1, 0x76, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x5b, 0x56, 0x6f, 0x65, 0x62, 0xf3, 0x6f, 0x6a, 0x69, 0xff, 0x67, 0x6b, 0x67, 0xff, 0x65, 0x6a, 0x69, 0xff, 0x6c, 0x6c, 0x67, 0xff, 0x6c, 0x67, 0x5d, 0xff, 0x68, 0x60, 0x51, 0xff, 0x6a, 0x60, 0x46, 0xff, 0x6e, 0x60, 0x3d, 0xff, 0x7d, 0x63, 0x37, 0xff, 0x87, 0x5f, 0x2b, 0xff, 0x80, 0x58, 0x1e, 0xff, 0x7a, 0x5a, 0x20, 0xff, 0x78, 0x55, 0x20, 0xff, 0x75, 0x4c, 0x1c, 0xff, 0x73, 0x4b, 0x1c, 0xff, 0x6b, 0x4c, 0x1b, 0xff, 0x5d, 0x46, 0x17, 0xff, 0x5d, 0x41, 0x15, 0xff, 0x61, 0x39, 0x16, 0xff, 0x61, 0x32, 0x12, 0xff, 0x54, 0x35, 0x05, 0xff, 0x47, 0x4b, 0x00, 0xff, 0x8a, 0xad, 0x70, 0xff, 0xcf, 0xf1, 0xec, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfc, 0xfc, 0xfe, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xf8, 0xfb, 0xfb, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xd4, 0xf5, 0xff, 0xd7, 0xad, 0xe0, 0xff, 0xa6, 0x7d, 0xaa, 0xff, 0x6e, 0x4e, 0x76, 0xff, 0x58, 0x46, 0x6b, 0xff, 0x63, 0x4f, 0x7f, 0xff, 0x93, 0x77, 0xb5, 0xff, 0xc0, 0x98, 0xf4, 0xff, 0xb9, 0x84, 0xff, 0xff, 0xa0, 0x6b, 0xf9, 0xff, 0x9d, 0x68, 0xf6, 0xff, 0x9d, 0x68, 0xed, 0xff, 0xa0, 0x6d, 0xe2, 0xff, 0xa2, 0x6a, 0xdc, 0xff, 0xa2, 0x66, 0xd5, 0xff, 0xa7, 0x65, 0xcf, 0xff, 0xb0, 0x66, 0xd0, 0xff, 0xba, 0x69, 0xd2, 0xff, 0xbd, 0x6a, 0xd3, 0xff, 0xba, 0x68, 0xd9, 0xff, 0xb2, 0x69, 0xdf, 0xff, 0xb1, 0x69, 0xe1, 0xff, 0xb4, 0x67, 0xe3, 0xff, 0xb6, 0x6a, 0xe8, 0xff, 0xb6, 0x6b, 0xea, 0xff, 0xb5, 0x6c, 0xe9, 0xff, 0xb4, 0x6e, 0xe6, 0xff, 0xb2, 0x6a, 0xe4, 0xff, 0xb1, 0x73, 0xd9, 0xff, 0xbd, 0x85, 0xcc, 0xff, 0xca, 0x8e, 0xb3, 0xff, 0xd6, 0x94, 0x99, 0xff, 0xdd, 0x9c, 0x87, 0xff, 0xda, 0xa1, 0x7c, 0xf3, 0xd8, 0xa3, 0x79, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x74, 0x60, 0x5c, 0x8a, 0x71, 0x65, 0x65, 0xfe, 0x6c, 0x6b, 0x6b, 0xff, 0x65, 0x6e, 0x6e, 0xff, 0x63, 0x6f, 0x6e, 0xff, 0x60, 0x6c, 0x6c, 0xff, 0x6b, 0x70, 0x6e, 0xff, 0x6f, 0x72, 0x6a, 0xff, 0x69, 0x6c, 0x5d, 0xff, 0x66, 0x62, 0x47, 0xff, 0x6a, 0x60, 0x39, 0xff, 0x78, 0x66, 0x35, 0xff, 0x80, 0x63, 0x29, 0xff, 0x78, 0x57, 0x15, 0xff, 0x74, 0x55, 0x14, 0xff, 0x6f, 0x4f, 0x16, 0xff, 0x6e, 0x4a, 0x18, 0xff, 0x6b, 0x4b, 0x18, 0xff, 0x5f, 0x48, 0x14, 0xff, 0x52, 0x42, 0x10, 0xff, 0x58, 0x43, 0x11, 0xff, 0x5e, 0x3a, 0x14, 0xff, 0x5c, 0x30, 0x11, 0xff, 0x4e, 0x31, 0x03, 0xff, 0x46, 0x47, 0x00, 0xff, 0xa8, 0xc6, 0x85, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xea, 0xff, 0xee, 0xec, 0xca, 0xff, 0xdb, 0xd9, 0xb5, 0xff, 0xc3, 0xc2, 0xa2, 0xff, 0xba, 0xb8, 0x97, 0xff, 0xc9, 0xc8, 0xa6, 0xff, 0xec, 0xed, 0xd2, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xef, 0xf2, 0xff, 0x86, 0x73, 0x82, 0xff, 0x2f, 0x19, 0x2e, 0xff, 0x02, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x41, 0x31, 0x55, 0xff, 0xa0, 0x79, 0xd1, 0xff, 0xc3, 0x96, 0xff, 0xff, 0xa4, 0x77, 0xf3, 0xff, 0x99, 0x6b, 0xeb, 0xff, 0x96, 0x6e, 0xe0, 0xff, 0x9b, 0x68, 0xd6, 0xff, 0xa3, 0x68, 0xd3, 0xff, 0xa9, 0x6a, 0xcd, 0xff, 0xb0, 0x6b, 0xcc, 0xff, 0xb2, 0x69, 0xce, 0xff, 0xb7, 0x68, 0xce, 0xff, 0xb9, 0x6a, 0xd3, 0xff, 0xae, 0x69, 0xdb, 0xff, 0xad, 0x69, 0xe1, 0xff, 0xb1, 0x6a, 0xe3, 0xff, 0xb4, 0x6d, 0xe7, 0xff, 0xb7, 0x6e, 0xea, 0xff, 0xb3, 0x6c, 0xe8, 0xff, 0xb0, 0x6e, 0xe3, 0xff, 0xb1, 0x6e, 0xe3, 0xff, 0xb1, 0x73, 0xdb, 0xff, 0xb8, 0x81, 0xcf, 0xff, 0xc4, 0x8b, 0xb8, 0xff, 0xd3, 0x92, 0x9f, 0xff, 0xdb, 0x99, 0x8d, 0xff, 0xd8, 0x9f, 0x82, 0xff, 0xd7, 0xa0, 0x81, 0xfe, 0xda, 0xa6, 0x7e, 0x8b, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x5c, 0x45, 0x0b, 0x6f, 0x68, 0x52, 0xae, 0x6a, 0x6a, 0x5f, 0xff, 0x62, 0x6f, 0x68, 0xff, 0x62, 0x72, 0x6e, 0xff, 0x66, 0x76, 0x73, 0xff, 0x65, 0x79, 0x75, 0xff, 0x64, 0x77, 0x73, 0xff, 0x6a, 0x77, 0x74, 0xff, 0x6d, 0x7c, 0x75, 0xff, 0x6d, 0x7d, 0x6d, 0xff, 0x69, 0x6d, 0x4f, 0xff, 0x6a, 0x66, 0x40, 0xff, 0x72, 0x6a, 0x3a, 0xff, 0x79, 0x68, 0x2c, 0xff, 0x77, 0x5e, 0x1a, 0xff, 0x75, 0x5a, 0x17, 0xff, 0x70, 0x51, 0x17, 0xff, 0x6b, 0x48, 0x19, 0xff, 0x64, 0x44, 0x20, 0xff, 0x5e, 0x44, 0x1b, 0xff, 0x5e, 0x48, 0x12, 0xff, 0x5f, 0x4a, 0x13, 0xff, 0x5e, 0x3d, 0x14, 0xff, 0x5c, 0x36, 0x19, 0xff, 0x48, 0x2b, 0x0b, 0xff, 0x4c, 0x3e, 0x0a, 0xff, 0xa2, 0xa5, 0x6d, 0xff, 0xba, 0xbc, 0x9c, 0xff, 0x85, 0x7e, 0x6a, 0xff, 0x4f, 0x48, 0x38, 0xff, 0x36, 0x2d, 0x19, 0xff, 0x36, 0x2b, 0x17, 0xff, 0x37, 0x2a, 0x21, 0xff, 0x31, 0x21, 0x14, 0xff, 0x3a, 0x29, 0x15, 0xff, 0x55, 0x45, 0x28, 0xff, 0x71, 0x63, 0x40, 0xff, 0x8b, 0x7d, 0x5a, 0xff, 0xa2, 0x93, 0x6f, 0xff, 0xaa, 0x9a, 0x75, 0xff, 0xa4, 0x95, 0x74, 0xff, 0xa3, 0x92, 0x7a, 0xff, 0xac, 0x97, 0x83, 0xff, 0xc4, 0xb3, 0x99, 0xff, 0xdc, 0xd4, 0xbb, 0xff, 0x9d, 0x92, 0x84, 0xff, 0x27, 0x1c, 0x18, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x02, 0x00, 0xff, 0x02, 0x07, 0x00, 0xff, 0x08, 0x0e, 0x00, 0xff, 0x09, 0x0c, 0x00, 0xff, 0x01, 0x02, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x08, 0xff, 0x69, 0x55, 0x7f, 0xff, 0xbe, 0x9b, 0xef, 0xff, 0xab, 0x7d, 0xf7, 0xff, 0x91, 0x64, 0xe5, 0xff, 0x8c, 0x64, 0xdf, 0xff, 0x90, 0x67, 0xd9, 0xff, 0x98, 0x69, 0xd2, 0xff, 0xa1, 0x6c, 0xd3, 0xff, 0xa2, 0x67, 0xd2, 0xff, 0xaf, 0x66, 0xce, 0xff, 0xb7, 0x68, 0xcc, 0xff, 0xae, 0x68, 0xd2, 0xff, 0xa8, 0x68, 0xda, 0xff, 0xaa, 0x68, 0xdd, 0xff, 0xaf, 0x6a, 0xe0, 0xff, 0xb3, 0x6b, 0xe4, 0xff, 0xb0, 0x69, 0xe1, 0xff, 0xb0, 0x6c, 0xdc, 0xff, 0xb6, 0x72, 0xe1, 0xff, 0xb4, 0x76, 0xd8, 0xff, 0xb8, 0x7d, 0xd0, 0xff, 0xc5, 0x87, 0xbe, 0xff, 0xcf, 0x8f, 0xa3, 0xff, 0xce, 0x95, 0x8e, 0xff, 0xd1, 0x9b, 0x80, 0xff, 0xd7, 0xa0, 0x80, 0xff, 0xd5, 0xa1, 0x81, 0xff, 0xd3, 0xa1, 0x81, 0xaf, 0xd0, 0xa2, 0x73, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x5c, 0x39, 0x16, 0x61, 0x60, 0x49, 0xc9, 0x61, 0x6b, 0x5c, 0xff, 0x61, 0x72, 0x69, 0xff, 0x5c, 0x74, 0x70, 0xff, 0x65, 0x7a, 0x7a, 0xff, 0x69, 0x7f, 0x7d, 0xff, 0x6a, 0x85, 0x7f, 0xff, 0x6f, 0x83, 0x81, 0xff, 0x6c, 0x81, 0x7b, 0xff, 0x6f, 0x84, 0x78, 0xff, 0x74, 0x8a, 0x79, 0xff, 0x6a, 0x77, 0x61, 0xff, 0x6f, 0x6b, 0x50, 0xff, 0x78, 0x70, 0x48, 0xff, 0x7a, 0x6b, 0x36, 0xff, 0x73, 0x5f, 0x1f, 0xff, 0x78, 0x5f, 0x1d, 0xff, 0x79, 0x5d, 0x22, 0xff, 0x70, 0x52, 0x24, 0xff, 0x6b, 0x4f, 0x27, 0xff, 0x69, 0x4f, 0x23, 0xff, 0x6a, 0x4c, 0x17, 0xff, 0x63, 0x46, 0x0f, 0xff, 0x5b, 0x3e, 0x16, 0xff, 0x63, 0x45, 0x30, 0xff, 0x63, 0x4a, 0x37, 0xff, 0x5a, 0x4e, 0x2b, 0xff, 0x2d, 0x27, 0x08, 0xff, 0x07, 0x00, 0x00, 0xff, 0x0c, 0x00, 0x00, 0xff, 0x23, 0x15, 0x07, 0xff, 0x42, 0x34, 0x26, 0xff, 0x5b, 0x4d, 0x41, 0xff, 0x69, 0x5a, 0x52, 0xff, 0x73, 0x62, 0x59, 0xff, 0x7b, 0x6b, 0x5e, 0xff, 0x75, 0x65, 0x53, 0xff, 0x6a, 0x58, 0x3c, 0xff, 0x68, 0x55, 0x31, 0xff, 0x6a, 0x55, 0x29, 0xff, 0x70, 0x59, 0x2c, 0xff, 0x67, 0x4f, 0x25, 0xff, 0x5f, 0x47, 0x22, 0xff, 0x63, 0x4b, 0x2b, 0xff, 0x63, 0x4c, 0x2d, 0xff, 0x2d, 0x1e, 0x0a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0a, 0x03, 0x02, 0xff, 0x09, 0x05, 0x04, 0xff, 0x03, 0x07, 0x03, 0xff, 0x06, 0x0b, 0x04, 0xff, 0x0b, 0x09, 0x00, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x08, 0x04, 0x01, 0xff, 0x06, 0x03, 0x01, 0xff, 0x01, 0x02, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3f, 0x2a, 0x58, 0xff, 0xa5, 0x84, 0xdf, 0xff, 0x9d, 0x77, 0xf2, 0xff, 0x82, 0x61, 0xe0, 0xff, 0x84, 0x62, 0xdd, 0xff, 0x8c, 0x61, 0xd9, 0xff, 0x8d, 0x62, 0xce, 0xff, 0x96, 0x64, 0xca, 0xff, 0xa0, 0x63, 0xc4, 0xff, 0xa6, 0x63, 0xbf, 0xff, 0xa3, 0x63, 0xc8, 0xff, 0x9f, 0x63, 0xd0, 0xff, 0xa3, 0x65, 0xd6, 0xff, 0xa6, 0x66, 0xd8, 0xff, 0xa9, 0x68, 0xd7, 0xff, 0xaa, 0x68, 0xd7, 0xff, 0xae, 0x6c, 0xd6, 0xff, 0xb4, 0x75, 0xd7, 0xff, 0xb6, 0x79, 0xd5, 0xff, 0xb9, 0x7d, 0xce, 0xff, 0xc1, 0x86, 0xc0, 0xff, 0xc6, 0x8f, 0xa7, 0xff, 0xc7, 0x94, 0x8f, 0xff, 0xc7, 0x97, 0x81, 0xff, 0xca, 0x9c, 0x7e, 0xff, 0xcb, 0x9d, 0x80, 0xff, 0xc9, 0x9d, 0x82, 0xff, 0xc8, 0x9c, 0x81, 0xc9, 0xc5, 0xa2, 0x7f, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x58, 0x3a, 0x1a, 0x66, 0x5c, 0x46, 0xd6, 0x5f, 0x63, 0x57, 0xff, 0x5f, 0x6d, 0x67, 0xff, 0x5e, 0x75, 0x72, 0xff, 0x5d, 0x77, 0x7a, 0xff, 0x66, 0x7f, 0x84, 0xff, 0x67, 0x85, 0x83, 0xff, 0x67, 0x87, 0x81, 0xff, 0x6f, 0x89, 0x86, 0xff, 0x6f, 0x87, 0x86, 0xff, 0x73, 0x89, 0x83, 0xff, 0x74, 0x8b, 0x80, 0xff, 0x64, 0x73, 0x65, 0xff, 0x6c, 0x69, 0x59, 0xff, 0x7b, 0x74, 0x57, 0xff, 0x7d, 0x6f, 0x41, 0xff, 0x72, 0x61, 0x26, 0xff, 0x74, 0x62, 0x22, 0xff, 0x78, 0x62, 0x26, 0xff, 0x75, 0x5b, 0x2a, 0xff, 0x74, 0x57, 0x2a, 0xff, 0x71, 0x53, 0x26, 0xff, 0x6d, 0x50, 0x20, 0xff, 0x67, 0x4e, 0x1e, 0xff, 0x6f, 0x5b, 0x3b, 0xff, 0x5f, 0x4d, 0x43, 0xff, 0x30, 0x23, 0x1c, 0xff, 0x22, 0x1b, 0x0c, 0xff, 0x36, 0x2f, 0x22, 0xff, 0x5a, 0x4c, 0x46, 0xff, 0x75, 0x64, 0x5d, 0xff, 0x80, 0x71, 0x66, 0xff, 0x84, 0x77, 0x66, 0xff, 0x76, 0x6b, 0x57, 0xff, 0x72, 0x67, 0x50, 0xff, 0x6f, 0x64, 0x50, 0xff, 0x6a, 0x60, 0x4d, 0xff, 0x68, 0x5c, 0x4c, 0xff, 0x6e, 0x60, 0x4f, 0xff, 0x72, 0x66, 0x4d, 0xff, 0x78, 0x6a, 0x4c, 0xff, 0x7f, 0x70, 0x50, 0xff, 0x77, 0x65, 0x4a, 0xff, 0x74, 0x63, 0x4b, 0xff, 0x7b, 0x6d, 0x57, 0xff, 0x45, 0x38, 0x26, 0xff, 0x09, 0x00, 0x00, 0xff, 0x0d, 0x03, 0x00, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x0f, 0x0c, 0x08, 0xff, 0x10, 0x0a, 0x0a, 0xff, 0x0c, 0x09, 0x06, 0xff, 0x09, 0x08, 0x02, 0xff, 0x0d, 0x09, 0x01, 0xff, 0x0f, 0x08, 0x07, 0xff, 0x0e, 0x07, 0x0a, 0xff, 0x0c, 0x08, 0x06, 0xff, 0x0d, 0x0b, 0x01, 0xff, 0x08, 0x07, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1f, 0x1c, 0x31, 0xff, 0x8f, 0x80, 0xd0, 0xff, 0x92, 0x79, 0xeb, 0xff, 0x7d, 0x5c, 0xd9, 0xff, 0x86, 0x5f, 0xde, 0xff, 0x84, 0x5e, 0xd0, 0xff, 0x8b, 0x65, 0xc3, 0xff, 0x93, 0x66, 0xbb, 0xff, 0x95, 0x64, 0xba, 0xff, 0x8e, 0x60, 0xc0, 0xff, 0x90, 0x60, 0xc6, 0xff, 0x98, 0x64, 0xcd, 0xff, 0x9a, 0x65, 0xd0, 0xff, 0x9d, 0x68, 0xce, 0xff, 0x9f, 0x6a, 0xca, 0xff, 0xa0, 0x6c, 0xc7, 0xff, 0xa5, 0x73, 0xc6, 0xff, 0xa9, 0x76, 0xc8, 0xff, 0xaf, 0x7b, 0xc3, 0xff, 0xb6, 0x83, 0xb6, 0xff, 0xb9, 0x8c, 0xa2, 0xff, 0xbe, 0x90, 0x8f, 0xff, 0xc0, 0x93, 0x86, 0xff, 0xbf, 0x95, 0x83, 0xff, 0xbd, 0x94, 0x82, 0xff, 0xbf, 0x93, 0x88, 0xff, 0xc1, 0x92, 0x8c, 0xff, 0xbd, 0x92, 0x87, 0xd6, 0xba, 0x93, 0x89, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x57, 0x2f, 0x20, 0x6d, 0x5e, 0x44, 0xde, 0x66, 0x63, 0x55, 0xff, 0x5d, 0x67, 0x63, 0xff, 0x59, 0x6e, 0x6f, 0xff, 0x5c, 0x7a, 0x7e, 0xff, 0x5d, 0x7e, 0x8a, 0xff, 0x63, 0x83, 0x8d, 0xff, 0x65, 0x89, 0x8b, 0xff, 0x63, 0x8a, 0x88, 0xff, 0x6a, 0x8b, 0x8c, 0xff, 0x6f, 0x8c, 0x92, 0xff, 0x78, 0x92, 0x95, 0xff, 0x73, 0x90, 0x8a, 0xff, 0x5e, 0x73, 0x68, 0xff, 0x68, 0x6b, 0x5d, 0xff, 0x75, 0x75, 0x5e, 0xff, 0x7a, 0x73, 0x4e, 0xff, 0x72, 0x65, 0x35, 0xff, 0x70, 0x63, 0x2f, 0xff, 0x71, 0x61, 0x2f, 0xff, 0x73, 0x5e, 0x32, 0xff, 0x72, 0x56, 0x33, 0xff, 0x6e, 0x51, 0x32, 0xff, 0x72, 0x5b, 0x37, 0xff, 0x77, 0x6a, 0x49, 0xff, 0x43, 0x3b, 0x26, 0xff, 0x1a, 0x13, 0x0c, 0xff, 0x39, 0x33, 0x32, 0xff, 0x6b, 0x61, 0x5c, 0xff, 0x87, 0x7a, 0x73, 0xff, 0x87, 0x77, 0x73, 0xff, 0x73, 0x61, 0x5e, 0xff, 0x6d, 0x5d, 0x54, 0xff, 0x6f, 0x63, 0x53, 0xff, 0x6b, 0x60, 0x4b, 0xff, 0x6c, 0x61, 0x4a, 0xff, 0x6c, 0x61, 0x4c, 0xff, 0x6b, 0x5f, 0x4d, 0xff, 0x6c, 0x5f, 0x50, 0xff, 0x69, 0x5e, 0x4f, 0xff, 0x6f, 0x64, 0x50, 0xff, 0x6d, 0x60, 0x48, 0xff, 0x5f, 0x51, 0x3a, 0xff, 0x67, 0x59, 0x45, 0xff, 0x7c, 0x6e, 0x5c, 0xff, 0x43, 0x36, 0x29, 0xff, 0x0e, 0x02, 0x00, 0xff, 0x15, 0x09, 0x06, 0xff, 0x17, 0x0e, 0x0a, 0xff, 0x14, 0x0f, 0x09, 0xff, 0x14, 0x11, 0x0a, 0xff, 0x16, 0x0e, 0x07, 0xff, 0x18, 0x10, 0x09, 0xff, 0x16, 0x0e, 0x07, 0xff, 0x13, 0x0b, 0x02, 0xff, 0x12, 0x09, 0x09, 0xff, 0x11, 0x09, 0x0d, 0xff, 0x0e, 0x09, 0x07, 0xff, 0x0b, 0x0a, 0x00, 0xff, 0x0a, 0x0a, 0x00, 0xff, 0x0a, 0x0a, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1a, 0x1a, 0x39, 0xff, 0x8d, 0x7e, 0xd1, 0xff, 0x8b, 0x70, 0xda, 0xff, 0x7a, 0x58, 0xd2, 0xff, 0x81, 0x60, 0xd6, 0xff, 0x7f, 0x62, 0xc2, 0xff, 0x83, 0x64, 0xbe, 0xff, 0x83, 0x62, 0xc3, 0xff, 0x80, 0x61, 0xc7, 0xff, 0x82, 0x5e, 0xca, 0xff, 0x85, 0x5d, 0xcc, 0xff, 0x88, 0x60, 0xcd, 0xff, 0x8a, 0x63, 0xcb, 0xff, 0x8d, 0x65, 0xc4, 0xff, 0x90, 0x69, 0xc0, 0xff, 0x92, 0x6e, 0xbc, 0xff, 0x95, 0x73, 0xba, 0xff, 0x9c, 0x77, 0xb7, 0xff, 0xa4, 0x7d, 0xaf, 0xff, 0xa8, 0x85, 0xa0, 0xff, 0xad, 0x8b, 0x97, 0xff, 0xb0, 0x8f, 0x8d, 0xff, 0xac, 0x8f, 0x84, 0xff, 0xa8, 0x8e, 0x85, 0xff, 0xb1, 0x8f, 0x8b, 0xff, 0xb8, 0x90, 0x92, 0xff, 0xb5, 0x90, 0x90, 0xff, 0xb5, 0x8e, 0x91, 0xde, 0xbf, 0x8f, 0x97, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x64, 0x2d, 0x1c, 0x75, 0x5f, 0x37, 0xdb, 0x74, 0x67, 0x4f, 0xff, 0x68, 0x68, 0x5c, 0xff, 0x60, 0x6b, 0x6c, 0xff, 0x5c, 0x71, 0x7a, 0xff, 0x5c, 0x7b, 0x87, 0xff, 0x5c, 0x7e, 0x91, 0xff, 0x5f, 0x81, 0x93, 0xff, 0x63, 0x8b, 0x96, 0xff, 0x63, 0x8e, 0x95, 0xff, 0x67, 0x8c, 0x97, 0xff, 0x6a, 0x8d, 0x97, 0xff, 0x75, 0x95, 0x98, 0xff, 0x70, 0x93, 0x8e, 0xff, 0x5a, 0x75, 0x68, 0xff, 0x66, 0x70, 0x5f, 0xff, 0x75, 0x7c, 0x63, 0xff, 0x7b, 0x78, 0x58, 0xff, 0x6e, 0x65, 0x42, 0xff, 0x71, 0x62, 0x41, 0xff, 0x73, 0x61, 0x41, 0xff, 0x6e, 0x5e, 0x3f, 0xff, 0x6b, 0x59, 0x46, 0xff, 0x7c, 0x68, 0x5b, 0xff, 0x72, 0x64, 0x50, 0xff, 0x28, 0x25, 0x11, 0xff, 0x25, 0x23, 0x13, 0xff, 0x66, 0x62, 0x56, 0xff, 0x89, 0x7e, 0x77, 0xff, 0x81, 0x6d, 0x66, 0xff, 0x77, 0x62, 0x5a, 0xff, 0x70, 0x61, 0x54, 0xff, 0x6f, 0x62, 0x54, 0xff, 0x71, 0x64, 0x55, 0xff, 0x68, 0x5b, 0x4b, 0xff, 0x67, 0x5a, 0x4a, 0xff, 0x67, 0x5a, 0x4d, 0xff, 0x69, 0x5c, 0x4e, 0xff, 0x6e, 0x62, 0x51, 0xff, 0x6a, 0x5e, 0x4e, 0xff, 0x61, 0x54, 0x46, 0xff, 0x62, 0x56, 0x41, 0xff, 0x6d, 0x5e, 0x48, 0xff, 0x5f, 0x4e, 0x3b, 0xff, 0x74, 0x63, 0x51, 0xff, 0x53, 0x44, 0x32, 0xff, 0x10, 0x02, 0x00, 0xff, 0x17, 0x0a, 0x04, 0xff, 0x1f, 0x15, 0x0a, 0xff, 0x19, 0x11, 0x06, 0xff, 0x1b, 0x11, 0x09, 0xff, 0x19, 0x0f, 0x08, 0xff, 0x1a, 0x12, 0x07, 0xff, 0x20, 0x11, 0x08, 0xff, 0x20, 0x0f, 0x07, 0xff, 0x19, 0x0e, 0x05, 0xff, 0x12, 0x0a, 0x05, 0xff, 0x0e, 0x06, 0x06, 0xff, 0x0d, 0x06, 0x06, 0xff, 0x0d, 0x08, 0x04, 0xff, 0x0a, 0x0a, 0x03, 0xff, 0x0c, 0x0a, 0x06, 0xff, 0x0a, 0x07, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x37, 0x2d, 0x4c, 0xff, 0xa0, 0x85, 0xd2, 0xff, 0x88, 0x63, 0xd2, 0xff, 0x7f, 0x5b, 0xcb, 0xff, 0x7e, 0x5f, 0xc8, 0xff, 0x79, 0x5b, 0xc9, 0xff, 0x77, 0x59, 0xcf, 0xff, 0x7b, 0x5b, 0xd7, 0xff, 0x7c, 0x5c, 0xd9, 0xff, 0x7a, 0x59, 0xd7, 0xff, 0x7d, 0x5a, 0xd7, 0xff, 0x7d, 0x5c, 0xd1, 0xff, 0x7e, 0x5c, 0xcc, 0xff, 0x83, 0x60, 0xc8, 0xff, 0x83, 0x65, 0xbd, 0xff, 0x86, 0x6c, 0xb3, 0xff, 0x8c, 0x72, 0xb2, 0xff, 0x92, 0x77, 0xaf, 0xff, 0x96, 0x7f, 0xa5, 0xff, 0x9c, 0x87, 0xa1, 0xff, 0xa1, 0x88, 0x9c, 0xff, 0x9e, 0x89, 0x95, 0xff, 0x9a, 0x8d, 0x92, 0xff, 0xa3, 0x8c, 0x91, 0xff, 0xae, 0x8c, 0x97, 0xff, 0xb0, 0x8c, 0x99, 0xff, 0xb0, 0x8a, 0x9a, 0xff, 0xb7, 0x86, 0xa3, 0xdc, 0xc8, 0x88, 0xad, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x6d, 0x3c, 0x15, 0x81, 0x66, 0x3b, 0xd6, 0x7b, 0x63, 0x43, 0xff, 0x73, 0x69, 0x56, 0xff, 0x67, 0x68, 0x62, 0xff, 0x5e, 0x6a, 0x6e, 0xff, 0x5c, 0x6f, 0x7c, 0xff, 0x5f, 0x79, 0x8e, 0xff, 0x5c, 0x7c, 0x96, 0xff, 0x59, 0x7e, 0x98, 0xff, 0x5f, 0x85, 0x9c, 0xff, 0x64, 0x89, 0x9a, 0xff, 0x67, 0x89, 0x99, 0xff, 0x66, 0x86, 0x96, 0xff, 0x75, 0x96, 0x9f, 0xff, 0x71, 0x92, 0x8d, 0xff, 0x5a, 0x72, 0x66, 0xff, 0x65, 0x75, 0x62, 0xff, 0x70, 0x7c, 0x62, 0xff, 0x7a, 0x7a, 0x60, 0xff, 0x76, 0x6a, 0x50, 0xff, 0x74, 0x64, 0x4d, 0xff, 0x75, 0x64, 0x51, 0xff, 0x76, 0x63, 0x53, 0xff, 0x7a, 0x6a, 0x61, 0xff, 0x5b, 0x51, 0x4c, 0xff, 0x18, 0x11, 0x0a, 0xff, 0x3f, 0x39, 0x2e, 0xff, 0x81, 0x7b, 0x6b, 0xff, 0x7d, 0x74, 0x62, 0xff, 0x72, 0x63, 0x50, 0xff, 0x75, 0x5f, 0x4f, 0xff, 0x72, 0x5c, 0x4c, 0xff, 0x6e, 0x5e, 0x4e, 0xff, 0x6d, 0x62, 0x50, 0xff, 0x66, 0x5b, 0x47, 0xff, 0x68, 0x5c, 0x49, 0xff, 0x6c, 0x5f, 0x50, 0xff, 0x66, 0x56, 0x4f, 0xff, 0x66, 0x54, 0x52, 0xff, 0x68, 0x56, 0x51, 0xff, 0x65, 0x56, 0x47, 0xff, 0x6b, 0x5c, 0x49, 0xff, 0x63, 0x55, 0x41, 0xff, 0x5b, 0x4a, 0x36, 0xff, 0x77, 0x62, 0x4e, 0xff, 0x62, 0x4e, 0x3b, 0xff, 0x19, 0x06, 0x00, 0xff, 0x1b, 0x0c, 0x02, 0xff, 0x1e, 0x13, 0x07, 0xff, 0x1b, 0x13, 0x05, 0xff, 0x1d, 0x14, 0x08, 0xff, 0x1d, 0x13, 0x0c, 0xff, 0x1e, 0x14, 0x0f, 0xff, 0x21, 0x11, 0x0c, 0xff, 0x1f, 0x0d, 0x07, 0xff, 0x1b, 0x0d, 0x06, 0xff, 0x18, 0x0d, 0x05, 0xff, 0x15, 0x0e, 0x0a, 0xff, 0x10, 0x0b, 0x07, 0xff, 0x0c, 0x05, 0x02, 0xff, 0x0d, 0x06, 0x06, 0xff, 0x08, 0x07, 0x07, 0xff, 0x05, 0x05, 0x03, 0xff, 0x08, 0x06, 0x01, 0xff, 0x0d, 0x08, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x5c, 0x48, 0x74, 0xff, 0xa1, 0x7e, 0xd5, 0xff, 0x81, 0x5a, 0xc9, 0xff, 0x82, 0x5a, 0xd6, 0xff, 0x78, 0x52, 0xd8, 0xff, 0x75, 0x55, 0xda, 0xff, 0x79, 0x57, 0xde, 0xff, 0x78, 0x56, 0xe3, 0xff, 0x77, 0x54, 0xe3, 0xff, 0x79, 0x56, 0xe2, 0xff, 0x78, 0x57, 0xdc, 0xff, 0x7a, 0x5a, 0xd7, 0xff, 0x77, 0x5b, 0xcd, 0xff, 0x78, 0x62, 0xc3, 0xff, 0x7f, 0x6b, 0xbb, 0xff, 0x82, 0x6e, 0xb7, 0xff, 0x85, 0x73, 0xb5, 0xff, 0x88, 0x79, 0xb1, 0xff, 0x8b, 0x7f, 0xaf, 0xff, 0x90, 0x82, 0xae, 0xff, 0x92, 0x83, 0xac, 0xff, 0x96, 0x87, 0xaa, 0xff, 0x9e, 0x86, 0xa6, 0xff, 0xa4, 0x84, 0xa5, 0xff, 0xa7, 0x86, 0xa7, 0xff, 0xa7, 0x85, 0xa5, 0xff, 0xb0, 0x82, 0xaa, 0xff, 0xbe, 0x83, 0xb1, 0xd7, 0xc2, 0x85, 0xaa, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x7f, 0x4c, 0x0a, 0x88, 0x6d, 0x4f, 0xc8, 0x7c, 0x65, 0x49, 0xff, 0x74, 0x63, 0x4f, 0xff, 0x6a, 0x67, 0x61, 0xff, 0x62, 0x6a, 0x70, 0xff, 0x5a, 0x69, 0x76, 0xff, 0x57, 0x6b, 0x81, 0xff, 0x5e, 0x77, 0x97, 0xff, 0x58, 0x7a, 0x9d, 0xff, 0x55, 0x7c, 0x9e, 0xff, 0x5c, 0x82, 0x9f, 0xff, 0x64, 0x87, 0x9c, 0xff, 0x66, 0x87, 0x99, 0xff, 0x6a, 0x88, 0x9b, 0xff, 0x79, 0x9a, 0xa4, 0xff, 0x68, 0x89, 0x85, 0xff, 0x5c, 0x76, 0x6b, 0xff, 0x67, 0x79, 0x6d, 0xff, 0x6c, 0x78, 0x6b, 0xff, 0x77, 0x78, 0x6b, 0xff, 0x7d, 0x71, 0x62, 0xff, 0x78, 0x69, 0x58, 0xff, 0x6e, 0x5d, 0x4f, 0xff, 0x77, 0x64, 0x58, 0xff, 0x65, 0x58, 0x4b, 0xff, 0x1e, 0x15, 0x0a, 0xff, 0x52, 0x45, 0x3c, 0xff, 0x8a, 0x7b, 0x6d, 0xff, 0x77, 0x66, 0x55, 0xff, 0x76, 0x64, 0x4e, 0xff, 0x76, 0x66, 0x4e, 0xff, 0x79, 0x66, 0x54, 0xff, 0x6e, 0x5d, 0x4f, 0xff, 0x6b, 0x5d, 0x54, 0xff, 0x6b, 0x5b, 0x54, 0xff, 0x66, 0x5a, 0x4a, 0xff, 0x6a, 0x5f, 0x4c, 0xff, 0x6b, 0x5f, 0x4d, 0xff, 0x65, 0x58, 0x4c, 0xff, 0x66, 0x56, 0x51, 0xff, 0x5f, 0x4e, 0x47, 0xff, 0x5c, 0x4f, 0x3e, 0xff, 0x5c, 0x4f, 0x40, 0xff, 0x51, 0x43, 0x36, 0xff, 0x64, 0x54, 0x44, 0xff, 0x6b, 0x5a, 0x4a, 0xff, 0x1c, 0x0d, 0x07, 0xff, 0x13, 0x05, 0x02, 0xff, 0x20, 0x14, 0x0e, 0xff, 0x19, 0x11, 0x04, 0xff, 0x17, 0x0e, 0x03, 0xff, 0x18, 0x0e, 0x06, 0xff, 0x13, 0x08, 0x03, 0xff, 0x10, 0x04, 0x01, 0xff, 0x0b, 0x02, 0x02, 0xff, 0x09, 0x03, 0x02, 0xff, 0x0b, 0x04, 0x03, 0xff, 0x0e, 0x05, 0x05, 0xff, 0x13, 0x08, 0x06, 0xff, 0x15, 0x0b, 0x05, 0xff, 0x12, 0x0a, 0x04, 0xff, 0x0c, 0x05, 0x04, 0xff, 0x0d, 0x03, 0x06, 0xff, 0x0e, 0x05, 0x05, 0xff, 0x0e, 0x08, 0x04, 0xff, 0x0f, 0x0b, 0x03, 0xff, 0x05, 0x07, 0x00, 0xff, 0x05, 0x02, 0x09, 0xff, 0x7a, 0x63, 0x9b, 0xff, 0x8e, 0x6c, 0xd7, 0xff, 0x7c, 0x53, 0xe2, 0xff, 0x76, 0x4e, 0xec, 0xff, 0x75, 0x54, 0xea, 0xff, 0x75, 0x55, 0xe5, 0xff, 0x75, 0x52, 0xe9, 0xff, 0x75, 0x51, 0xea, 0xff, 0x73, 0x51, 0xe8, 0xff, 0x71, 0x52, 0xe3, 0xff, 0x76, 0x57, 0xde, 0xff, 0x73, 0x59, 0xd4, 0xff, 0x72, 0x60, 0xce, 0xff, 0x7b, 0x6a, 0xcb, 0xff, 0x7e, 0x6c, 0xc7, 0xff, 0x7f, 0x6d, 0xc9, 0xff, 0x80, 0x6f, 0xc8, 0xff, 0x81, 0x71, 0xc7, 0xff, 0x82, 0x75, 0xc4, 0xff, 0x83, 0x79, 0xc0, 0xff, 0x89, 0x7c, 0xc2, 0xff, 0x91, 0x7e, 0xc2, 0xff, 0x94, 0x7c, 0xbb, 0xff, 0x96, 0x7f, 0xb7, 0xff, 0x98, 0x7e, 0xb4, 0xff, 0xa1, 0x7d, 0xb5, 0xff, 0xae, 0x7e, 0xbe, 0xff, 0xb5, 0x7b, 0xc0, 0xc8, 0xb2, 0x7f, 0xb2, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x55, 0x03, 0x9b, 0x7b, 0x5f, 0xb1, 0x88, 0x6f, 0x5d, 0xff, 0x74, 0x64, 0x55, 0xff, 0x6e, 0x64, 0x5b, 0xff, 0x63, 0x64, 0x6a, 0xff, 0x5c, 0x65, 0x79, 0xff, 0x5c, 0x6d, 0x88, 0xff, 0x58, 0x6d, 0x90, 0xff, 0x57, 0x6f, 0x99, 0xff, 0x53, 0x73, 0x9f, 0xff, 0x57, 0x7a, 0xa4, 0xff, 0x5a, 0x7d, 0x9f, 0xff, 0x60, 0x80, 0x9a, 0xff, 0x6a, 0x89, 0xa0, 0xff, 0x70, 0x8b, 0x9e, 0xff, 0x72, 0x8e, 0x97, 0xff, 0x69, 0x86, 0x87, 0xff, 0x5f, 0x76, 0x71, 0xff, 0x66, 0x74, 0x75, 0xff, 0x6b, 0x72, 0x76, 0xff, 0x76, 0x76, 0x73, 0xff, 0x75, 0x6d, 0x64, 0xff, 0x69, 0x5b, 0x4f, 0xff, 0x6a, 0x5a, 0x4d, 0xff, 0x68, 0x5b, 0x4c, 0xff, 0x31, 0x26, 0x14, 0xff, 0x5c, 0x4d, 0x3c, 0xff, 0x8c, 0x77, 0x68, 0xff, 0x75, 0x61, 0x4f, 0xff, 0x79, 0x65, 0x51, 0xff, 0x7c, 0x68, 0x51, 0xff, 0x75, 0x65, 0x4d, 0xff, 0x72, 0x64, 0x52, 0xff, 0x71, 0x65, 0x5a, 0xff, 0x66, 0x5a, 0x54, 0xff, 0x68, 0x55, 0x52, 0xff, 0x67, 0x57, 0x4b, 0xff, 0x63, 0x56, 0x44, 0xff, 0x6b, 0x5d, 0x4b, 0xff, 0x5e, 0x50, 0x40, 0xff, 0x58, 0x4a, 0x3e, 0xff, 0x5c, 0x50, 0x43, 0xff, 0x59, 0x52, 0x41, 0xff, 0x4e, 0x44, 0x36, 0xff, 0x5f, 0x50, 0x46, 0xff, 0x6e, 0x60, 0x57, 0xff, 0x20, 0x16, 0x11, 0xff, 0x0d, 0x01, 0x00, 0xff, 0x1a, 0x0e, 0x07, 0xff, 0x12, 0x06, 0x01, 0xff, 0x0d, 0x01, 0x00, 0xff, 0x08, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x04, 0xff, 0x01, 0x02, 0x0b, 0xff, 0x00, 0x00, 0x07, 0xff, 0x00, 0x00, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x0c, 0x02, 0x00, 0xff, 0x10, 0x05, 0x00, 0xff, 0x0f, 0x03, 0x04, 0xff, 0x12, 0x03, 0x04, 0xff, 0x12, 0x06, 0x03, 0xff, 0x0a, 0x07, 0x00, 0xff, 0x0e, 0x0e, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2d, 0x20, 0x3c, 0xff, 0x9a, 0x74, 0xde, 0xff, 0x7f, 0x58, 0xeb, 0xff, 0x74, 0x51, 0xed, 0xff, 0x74, 0x55, 0xe9, 0xff, 0x72, 0x53, 0xe2, 0xff, 0x76, 0x4f, 0xeb, 0xff, 0x78, 0x4e, 0xf0, 0xff, 0x73, 0x4c, 0xec, 0xff, 0x6f, 0x4c, 0xe9, 0xff, 0x73, 0x53, 0xe2, 0xff, 0x71, 0x59, 0xd9, 0xff, 0x6d, 0x5e, 0xd4, 0xff, 0x73, 0x66, 0xd2, 0xff, 0x79, 0x69, 0xd5, 0xff, 0x7b, 0x6a, 0xd7, 0xff, 0x7b, 0x6b, 0xd8, 0xff, 0x7a, 0x6a, 0xda, 0xff, 0x7e, 0x6c, 0xd7, 0xff, 0x81, 0x70, 0xd4, 0xff, 0x83, 0x73, 0xd7, 0xff, 0x88, 0x75, 0xd9, 0xff, 0x8a, 0x72, 0xd1, 0xff, 0x8a, 0x73, 0xc6, 0xff, 0x8d, 0x74, 0xc3, 0xff, 0x96, 0x74, 0xc3, 0xff, 0xa0, 0x74, 0xc7, 0xff, 0xa9, 0x73, 0xca, 0xff, 0xae, 0x74, 0xc3, 0xb1, 0xaa, 0x55, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x82, 0x61, 0x8d, 0x9b, 0x7e, 0x64, 0xff, 0x8f, 0x73, 0x65, 0xff, 0x79, 0x65, 0x5e, 0xff, 0x70, 0x62, 0x63, 0xff, 0x63, 0x5e, 0x6d, 0xff, 0x5b, 0x5d, 0x78, 0xff, 0x58, 0x64, 0x87, 0xff, 0x54, 0x67, 0x8f, 0xff, 0x57, 0x6c, 0x9b, 0xff, 0x54, 0x6e, 0x9d, 0xff, 0x59, 0x74, 0xa4, 0xff, 0x5c, 0x75, 0xa1, 0xff, 0x61, 0x7c, 0x9b, 0xff, 0x6b, 0x84, 0x9e, 0xff, 0x69, 0x7d, 0x95, 0xff, 0x6f, 0x83, 0x93, 0xff, 0x6e, 0x83, 0x8c, 0xff, 0x63, 0x71, 0x7b, 0xff, 0x64, 0x6b, 0x77, 0xff, 0x6f, 0x72, 0x77, 0xff, 0x7c, 0x7a, 0x76, 0xff, 0x68, 0x62, 0x54, 0xff, 0x5d, 0x51, 0x3e, 0xff, 0x78, 0x6c, 0x5a, 0xff, 0x40, 0x3a, 0x28, 0xff, 0x49, 0x3e, 0x2d, 0xff, 0x83, 0x73, 0x62, 0xff, 0x74, 0x64, 0x52, 0xff, 0x6e, 0x5f, 0x4c, 0xff, 0x6c, 0x5e, 0x4b, 0xff, 0x72, 0x64, 0x50, 0xff, 0x6d, 0x61, 0x4e, 0xff, 0x60, 0x58, 0x48, 0xff, 0x63, 0x58, 0x4c, 0xff, 0x66, 0x56, 0x4b, 0xff, 0x6a, 0x59, 0x4d, 0xff, 0x67, 0x59, 0x47, 0xff, 0x5d, 0x4f, 0x3b, 0xff, 0x63, 0x54, 0x43, 0xff, 0x5d, 0x4d, 0x40, 0xff, 0x53, 0x47, 0x38, 0xff, 0x55, 0x4b, 0x40, 0xff, 0x4d, 0x47, 0x39, 0xff, 0x52, 0x4b, 0x32, 0xff, 0x68, 0x54, 0x45, 0xff, 0x35, 0x20, 0x1f, 0xff, 0x04, 0x00, 0x00, 0xff, 0x04, 0x02, 0x00, 0xff, 0x01, 0x01, 0x00, 0xff, 0x03, 0x03, 0x10, 0xff, 0x06, 0x06, 0x28, 0xff, 0x02, 0x0a, 0x2d, 0xff, 0x09, 0x19, 0x3a, 0xff, 0x13, 0x32, 0x53, 0xff, 0x1b, 0x43, 0x65, 0xff, 0x2a, 0x51, 0x77, 0xff, 0x3a, 0x61, 0x89, 0xff, 0x38, 0x60, 0x8c, 0xff, 0x29, 0x51, 0x82, 0xff, 0x12, 0x35, 0x5f, 0xff, 0x00, 0x11, 0x2e, 0xff, 0x00, 0x00, 0x08, 0xff, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x0d, 0x01, 0x00, 0xff, 0x11, 0x02, 0x00, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x05, 0x07, 0x04, 0xff, 0x0a, 0x0a, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x79, 0x4a, 0xa1, 0xff, 0x9a, 0x6b, 0xfb, 0xff, 0x78, 0x51, 0xed, 0xff, 0x78, 0x51, 0xe9, 0xff, 0x7a, 0x4e, 0xea, 0xff, 0x81, 0x4b, 0xef, 0xff, 0x82, 0x4b, 0xee, 0xff, 0x7b, 0x48, 0xed, 0xff, 0x79, 0x4c, 0xed, 0xff, 0x78, 0x51, 0xeb, 0xff, 0x72, 0x54, 0xe8, 0xff, 0x6c, 0x56, 0xe2, 0xff, 0x6f, 0x5b, 0xdf, 0xff, 0x77, 0x61, 0xe3, 0xff, 0x7a, 0x65, 0xe6, 0xff, 0x7b, 0x66, 0xe5, 0xff, 0x7c, 0x69, 0xe2, 0xff, 0x7b, 0x68, 0xe4, 0xff, 0x77, 0x66, 0xe6, 0xff, 0x75, 0x6b, 0xe9, 0xff, 0x79, 0x6b, 0xe9, 0xff, 0x77, 0x68, 0xe5, 0xff, 0x73, 0x68, 0xdd, 0xff, 0x77, 0x6a, 0xd5, 0xff, 0x80, 0x6b, 0xd3, 0xff, 0x8a, 0x68, 0xd2, 0xff, 0x98, 0x6b, 0xd1, 0xff, 0xa1, 0x6e, 0xd2, 0xff, 0xab, 0x6c, 0xd1, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x84, 0x6c, 0x55, 0xa2, 0x83, 0x6a, 0xfe, 0x9e, 0x82, 0x67, 0xff, 0x91, 0x7a, 0x66, 0xff, 0x81, 0x6c, 0x63, 0xff, 0x78, 0x68, 0x66, 0xff, 0x68, 0x60, 0x6d, 0xff, 0x5a, 0x5b, 0x78, 0xff, 0x52, 0x58, 0x7f, 0xff, 0x4d, 0x59, 0x84, 0xff, 0x4d, 0x60, 0x90, 0xff, 0x48, 0x5f, 0x93, 0xff, 0x4a, 0x61, 0x93, 0xff, 0x53, 0x6a, 0x96, 0xff, 0x5b, 0x70, 0x93, 0xff, 0x5e, 0x71, 0x8e, 0xff, 0x62, 0x71, 0x89, 0xff, 0x6c, 0x7c, 0x8f, 0xff, 0x64, 0x71, 0x83, 0xff, 0x68, 0x6f, 0x7d, 0xff, 0x6e, 0x70, 0x7a, 0xff, 0x7d, 0x7a, 0x7e, 0xff, 0x76, 0x71, 0x68, 0xff, 0x5f, 0x57, 0x44, 0xff, 0x76, 0x6b, 0x56, 0xff, 0x5e, 0x52, 0x3f, 0xff, 0x41, 0x36, 0x27, 0xff, 0x74, 0x67, 0x59, 0xff, 0x70, 0x62, 0x52, 0xff, 0x74, 0x66, 0x54, 0xff, 0x6a, 0x5b, 0x4c, 0xff, 0x6b, 0x5c, 0x4e, 0xff, 0x6d, 0x60, 0x52, 0xff, 0x64, 0x5b, 0x4d, 0xff, 0x61, 0x57, 0x48, 0xff, 0x65, 0x57, 0x48, 0xff, 0x6a, 0x59, 0x49, 0xff, 0x68, 0x5a, 0x47, 0xff, 0x62, 0x53, 0x41, 0xff, 0x5e, 0x4f, 0x3f, 0xff, 0x5f, 0x4f, 0x41, 0xff, 0x5c, 0x4d, 0x3f, 0xff, 0x57, 0x4b, 0x3e, 0xff, 0x49, 0x3e, 0x38, 0xff, 0x48, 0x3e, 0x38, 0xff, 0x5d, 0x51, 0x3d, 0xff, 0x3f, 0x2f, 0x20, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x07, 0xff, 0x0f, 0x1a, 0x1c, 0xff, 0x1a, 0x26, 0x36, 0xff, 0x15, 0x23, 0x4e, 0xff, 0x23, 0x38, 0x68, 0xff, 0x3b, 0x57, 0x87, 0xff, 0x56, 0x7e, 0xae, 0xff, 0x6a, 0xa0, 0xd2, 0xff, 0x72, 0xb0, 0xe3, 0xff, 0x7d, 0xbf, 0xf0, 0xff, 0x91, 0xcf, 0xff, 0xff, 0x9e, 0xdc, 0xff, 0xff, 0x98, 0xdb, 0xff, 0xff, 0x96, 0xd5, 0xfe, 0xff, 0x7d, 0xbb, 0xe5, 0xff, 0x58, 0x8c, 0xb6, 0xff, 0x1f, 0x3b, 0x69, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x06, 0x01, 0x00, 0xff, 0x14, 0x06, 0x02, 0xff, 0x09, 0x04, 0x05, 0xff, 0x0a, 0x08, 0x04, 0xff, 0x03, 0x00, 0x00, 0xff, 0x38, 0x1d, 0x48, 0xff, 0x9c, 0x68, 0xf5, 0xff, 0x85, 0x53, 0xef, 0xff, 0x83, 0x49, 0xf7, 0xff, 0x83, 0x46, 0xf6, 0xff, 0x84, 0x4b, 0xee, 0xff, 0x82, 0x49, 0xf1, 0xff, 0x7f, 0x47, 0xed, 0xff, 0x82, 0x4b, 0xef, 0xff, 0x7f, 0x4d, 0xf0, 0xff, 0x77, 0x50, 0xed, 0xff, 0x70, 0x52, 0xe7, 0xff, 0x6c, 0x52, 0xe5, 0xff, 0x72, 0x58, 0xea, 0xff, 0x76, 0x5e, 0xea, 0xff, 0x78, 0x62, 0xe8, 0xff, 0x7a, 0x64, 0xe7, 0xff, 0x76, 0x62, 0xe9, 0xff, 0x6f, 0x5f, 0xeb, 0xff, 0x6d, 0x61, 0xee, 0xff, 0x69, 0x60, 0xf0, 0xff, 0x67, 0x5e, 0xee, 0xff, 0x66, 0x5d, 0xea, 0xff, 0x69, 0x5e, 0xe8, 0xff, 0x72, 0x63, 0xe5, 0xff, 0x7a, 0x61, 0xdc, 0xff, 0x87, 0x60, 0xd7, 0xff, 0x95, 0x66, 0xdb, 0xff, 0xa0, 0x68, 0xd9, 0xfe, 0xa2, 0x63, 0xd2, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x88, 0x69, 0x29, 0xa8, 0x87, 0x6e, 0xf3, 0xaa, 0x89, 0x70, 0xff, 0xa4, 0x87, 0x6c, 0xff, 0x96, 0x7f, 0x68, 0xff, 0x89, 0x77, 0x67, 0xff, 0x81, 0x71, 0x69, 0xff, 0x73, 0x69, 0x70, 0xff, 0x63, 0x61, 0x7c, 0xff, 0x55, 0x56, 0x7d, 0xff, 0x4d, 0x53, 0x80, 0xff, 0x44, 0x55, 0x88, 0xff, 0x43, 0x56, 0x8d, 0xff, 0x40, 0x55, 0x89, 0xff, 0x49, 0x5f, 0x8b, 0xff, 0x52, 0x64, 0x8a, 0xff, 0x5f, 0x6f, 0x8d, 0xff, 0x70, 0x7e, 0x93, 0xff, 0x64, 0x72, 0x84, 0xff, 0x5e, 0x69, 0x7c, 0xff, 0x6c, 0x75, 0x7d, 0xff, 0x79, 0x7a, 0x7e, 0xff, 0x82, 0x7c, 0x7e, 0xff, 0x69, 0x63, 0x57, 0xff, 0x6c, 0x62, 0x4f, 0xff, 0x79, 0x6c, 0x59, 0xff, 0x42, 0x34, 0x22, 0xff, 0x60, 0x4f, 0x43, 0xff, 0x76, 0x67, 0x5a, 0xff, 0x73, 0x64, 0x54, 0xff, 0x67, 0x58, 0x49, 0xff, 0x6a, 0x5a, 0x4e, 0xff, 0x6c, 0x5a, 0x4f, 0xff, 0x62, 0x53, 0x47, 0xff, 0x5d, 0x51, 0x45, 0xff, 0x63, 0x56, 0x48, 0xff, 0x6a, 0x5c, 0x4d, 0xff, 0x6b, 0x5c, 0x4b, 0xff, 0x61, 0x53, 0x41, 0xff, 0x58, 0x49, 0x39, 0xff, 0x57, 0x47, 0x3a, 0xff, 0x57, 0x49, 0x3c, 0xff, 0x5c, 0x4f, 0x44, 0xff, 0x50, 0x40, 0x39, 0xff, 0x4d, 0x3b, 0x37, 0xff, 0x53, 0x41, 0x3d, 0xff, 0x40, 0x34, 0x29, 0xff, 0x07, 0x03, 0x00, 0xff, 0x0b, 0x0f, 0x1e, 0xff, 0x2e, 0x3d, 0x58, 0xff, 0x2c, 0x45, 0x63, 0xff, 0x2b, 0x3e, 0x71, 0xff, 0x4f, 0x66, 0xa7, 0xff, 0x7c, 0xa7, 0xcc, 0xff, 0xa1, 0xd2, 0xef, 0xff, 0xa7, 0xe0, 0xff, 0xff, 0x9c, 0xdc, 0xff, 0xff, 0x9a, 0xd9, 0xff, 0xff, 0x9b, 0xd6, 0xfe, 0xff, 0xa3, 0xd5, 0xff, 0xff, 0xac, 0xdd, 0xff, 0xff, 0xa9, 0xe2, 0xfb, 0xff, 0xab, 0xe9, 0xfd, 0xff, 0x9f, 0xeb, 0xff, 0xff, 0x9e, 0xf1, 0xff, 0xff, 0x95, 0xe1, 0xff, 0xff, 0x5e, 0x9a, 0xc5, 0xff, 0x19, 0x2a, 0x4b, 0xff, 0x00, 0x00, 0x04, 0xff, 0x05, 0x01, 0x00, 0xff, 0x10, 0x05, 0x02, 0xff, 0x07, 0x02, 0x03, 0xff, 0x00, 0x08, 0x00, 0xff, 0x00, 0x04, 0x01, 0xff, 0x80, 0x56, 0xc3, 0xff, 0xa2, 0x58, 0xff, 0xff, 0x8a, 0x41, 0xf9, 0xff, 0x80, 0x41, 0xf1, 0xff, 0x81, 0x45, 0xf5, 0xff, 0x84, 0x47, 0xf6, 0xff, 0x83, 0x48, 0xf4, 0xff, 0x84, 0x47, 0xf2, 0xff, 0x84, 0x4d, 0xf3, 0xff, 0x83, 0x55, 0xf2, 0xff, 0x7b, 0x54, 0xeb, 0xff, 0x70, 0x50, 0xe8, 0xff, 0x6d, 0x4f, 0xe9, 0xff, 0x6f, 0x54, 0xe8, 0xff, 0x71, 0x59, 0xe7, 0xff, 0x74, 0x5c, 0xea, 0xff, 0x70, 0x5b, 0xeb, 0xff, 0x6c, 0x5a, 0xe9, 0xff, 0x69, 0x58, 0xec, 0xff, 0x63, 0x56, 0xef, 0xff, 0x63, 0x54, 0xef, 0xff, 0x61, 0x51, 0xec, 0xff, 0x65, 0x54, 0xed, 0xff, 0x6d, 0x5a, 0xea, 0xff, 0x77, 0x5c, 0xe4, 0xff, 0x82, 0x5b, 0xe1, 0xff, 0x89, 0x5d, 0xdd, 0xff, 0x97, 0x61, 0xdc, 0xff, 0x9a, 0x60, 0xd9, 0xf4, 0xa3, 0x61, 0xd4, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x91, 0x6d, 0x07, 0xae, 0x8b, 0x6c, 0xd1, 0xab, 0x8d, 0x71, 0xff, 0xab, 0x8d, 0x73, 0xff, 0xa8, 0x89, 0x71, 0xff, 0x9f, 0x87, 0x6c, 0xff, 0x93, 0x81, 0x6b, 0xff, 0x85, 0x74, 0x66, 0xff, 0x79, 0x6a, 0x6c, 0xff, 0x70, 0x6a, 0x7d, 0xff, 0x64, 0x61, 0x82, 0xff, 0x54, 0x54, 0x84, 0xff, 0x45, 0x4b, 0x86, 0xff, 0x47, 0x51, 0x8d, 0xff, 0x4d, 0x5a, 0x92, 0xff, 0x52, 0x60, 0x92, 0xff, 0x5e, 0x6a, 0x92, 0xff, 0x6a, 0x76, 0x94, 0xff, 0x68, 0x70, 0x87, 0xff, 0x60, 0x67, 0x79, 0xff, 0x6e, 0x75, 0x83, 0xff, 0x7c, 0x80, 0x83, 0xff, 0x85, 0x80, 0x7f, 0xff, 0x78, 0x6f, 0x6a, 0xff, 0x62, 0x58, 0x4a, 0xff, 0x7a, 0x6d, 0x5b, 0xff, 0x5f, 0x50, 0x3e, 0xff, 0x4e, 0x40, 0x2f, 0xff, 0x79, 0x69, 0x5d, 0xff, 0x69, 0x59, 0x4c, 0xff, 0x67, 0x57, 0x49, 0xff, 0x63, 0x53, 0x46, 0xff, 0x67, 0x57, 0x4b, 0xff, 0x6a, 0x5a, 0x4e, 0xff, 0x60, 0x51, 0x47, 0xff, 0x5f, 0x51, 0x46, 0xff, 0x64, 0x56, 0x49, 0xff, 0x65, 0x58, 0x4a, 0xff, 0x5f, 0x53, 0x45, 0xff, 0x59, 0x4d, 0x3f, 0xff, 0x5a, 0x4e, 0x41, 0xff, 0x54, 0x47, 0x3b, 0xff, 0x4e, 0x42, 0x38, 0xff, 0x52, 0x47, 0x41, 0xff, 0x49, 0x3c, 0x36, 0xff, 0x47, 0x35, 0x2e, 0xff, 0x58, 0x44, 0x3c, 0xff, 0x20, 0x18, 0x18, 0xff, 0x11, 0x18, 0x2f, 0xff, 0x3c, 0x51, 0x7d, 0xff, 0x23, 0x41, 0x70, 0xff, 0x2a, 0x50, 0x79, 0xff, 0x7c, 0xa0, 0xd0, 0xff, 0xb4, 0xdc, 0xff, 0xff, 0xc1, 0xfa, 0xff, 0xff, 0xb8, 0xf5, 0xff, 0xff, 0xa2, 0xe2, 0xfd, 0xff, 0x99, 0xdb, 0xf9, 0xff, 0x94, 0xd4, 0xf6, 0xff, 0x96, 0xce, 0xf3, 0xff, 0x9e, 0xd1, 0xf7, 0xff, 0xa5, 0xd8, 0xfd, 0xff, 0xa5, 0xdd, 0xfc, 0xff, 0x99, 0xdb, 0xfc, 0xff, 0x8c, 0xd7, 0xf8, 0xff, 0x87, 0xdc, 0xf9, 0xff, 0x8a, 0xe6, 0xfe, 0xff, 0xa2, 0xf4, 0xff, 0xff, 0x92, 0xd9, 0xff, 0xff, 0x38, 0x65, 0xa1, 0xff, 0x00, 0x00, 0x1a, 0xff, 0x05, 0x00, 0x00, 0xff, 0x07, 0x06, 0x03, 0xff, 0x01, 0x0b, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x48, 0x30, 0x62, 0xff, 0xa7, 0x58, 0xff, 0xff, 0x8f, 0x3b, 0xff, 0xff, 0x86, 0x44, 0xf7, 0xff, 0x81, 0x3d, 0xfc, 0xff, 0x8a, 0x47, 0xfc, 0xff, 0x8c, 0x4b, 0xfc, 0xff, 0x8a, 0x48, 0xf6, 0xff, 0x88, 0x4b, 0xf5, 0xff, 0x8a, 0x51, 0xf5, 0xff, 0x88, 0x54, 0xf3, 0xff, 0x7c, 0x51, 0xf0, 0xff, 0x6f, 0x4a, 0xef, 0xff, 0x6c, 0x4a, 0xed, 0xff, 0x6c, 0x4e, 0xeb, 0xff, 0x6b, 0x50, 0xee, 0xff, 0x69, 0x50, 0xf0, 0xff, 0x64, 0x50, 0xef, 0xff, 0x5f, 0x4d, 0xf0, 0xff, 0x5b, 0x4b, 0xf2, 0xff, 0x5a, 0x4a, 0xf4, 0xff, 0x5a, 0x48, 0xf4, 0xff, 0x5d, 0x4b, 0xf3, 0xff, 0x64, 0x4f, 0xef, 0xff, 0x6c, 0x51, 0xe9, 0xff, 0x77, 0x55, 0xe9, 0xff, 0x81, 0x5a, 0xe9, 0xff, 0x8b, 0x5e, 0xe7, 0xff, 0x91, 0x5c, 0xe5, 0xff, 0x94, 0x5b, 0xdb, 0xd1, 0xb6, 0x6d, 0xda, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x8a, 0x69, 0x8e, 0xac, 0x8d, 0x6e, 0xff, 0xab, 0x90, 0x73, 0xff, 0xae, 0x90, 0x77, 0xff, 0xac, 0x8c, 0x76, 0xff, 0xa5, 0x8f, 0x6f, 0xff, 0x9b, 0x88, 0x6a, 0xff, 0x91, 0x7d, 0x69, 0xff, 0x80, 0x70, 0x6c, 0xff, 0x77, 0x6c, 0x7a, 0xff, 0x6a, 0x62, 0x81, 0xff, 0x59, 0x53, 0x86, 0xff, 0x46, 0x44, 0x86, 0xff, 0x3e, 0x40, 0x82, 0xff, 0x47, 0x4c, 0x88, 0xff, 0x53, 0x57, 0x8d, 0xff, 0x5f, 0x62, 0x8d, 0xff, 0x62, 0x65, 0x85, 0xff, 0x5f, 0x5f, 0x76, 0xff, 0x6b, 0x68, 0x7a, 0xff, 0x78, 0x77, 0x81, 0xff, 0x85, 0x7e, 0x7f, 0xff, 0x81, 0x75, 0x70, 0xff, 0x6a, 0x5f, 0x54, 0xff, 0x6a, 0x5c, 0x4d, 0xff, 0x78, 0x67, 0x58, 0xff, 0x4d, 0x3c, 0x2c, 0xff, 0x5f, 0x4f, 0x40, 0xff, 0x6c, 0x5a, 0x52, 0xff, 0x66, 0x53, 0x4a, 0xff, 0x68, 0x57, 0x4b, 0xff, 0x67, 0x56, 0x4a, 0xff, 0x64, 0x55, 0x49, 0xff, 0x63, 0x52, 0x48, 0xff, 0x64, 0x52, 0x4a, 0xff, 0x66, 0x55, 0x4b, 0xff, 0x64, 0x55, 0x4a, 0xff, 0x5a, 0x4d, 0x42, 0xff, 0x59, 0x4f, 0x42, 0xff, 0x54, 0x4b, 0x3f, 0xff, 0x52, 0x47, 0x3d, 0xff, 0x56, 0x4b, 0x42, 0xff, 0x51, 0x45, 0x3e, 0xff, 0x57, 0x4d, 0x46, 0xff, 0x4c, 0x43, 0x3b, 0xff, 0x3c, 0x38, 0x26, 0xff, 0x34, 0x2d, 0x19, 0xff, 0x1b, 0x19, 0x23, 0xff, 0x32, 0x42, 0x6f, 0xff, 0x16, 0x33, 0x73, 0xff, 0x27, 0x48, 0x82, 0xff, 0xa1, 0xc7, 0xe7, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xca, 0xf6, 0xff, 0xff, 0xbb, 0xe8, 0xfa, 0xff, 0xb1, 0xdd, 0xf7, 0xff, 0xaa, 0xdf, 0xf9, 0xff, 0x9d, 0xd6, 0xf3, 0xff, 0x9d, 0xd5, 0xf6, 0xff, 0xa1, 0xdc, 0xfd, 0xff, 0xa0, 0xd8, 0xf8, 0xff, 0x9d, 0xd6, 0xf6, 0xff, 0x96, 0xd6, 0xf9, 0xff, 0x99, 0xd9, 0xfb, 0xff, 0x9f, 0xd7, 0xf6, 0xff, 0x9b, 0xd2, 0xf4, 0xff, 0x97, 0xd3, 0xfd, 0xff, 0x96, 0xd3, 0xff, 0xff, 0x8a, 0xe0, 0xff, 0xff, 0x86, 0xeb, 0xff, 0xff, 0x48, 0x82, 0xb6, 0xff, 0x00, 0x00, 0x0b, 0xff, 0x06, 0x00, 0x00, 0xff, 0x11, 0x03, 0x01, 0xff, 0x00, 0x02, 0x00, 0xff, 0x00, 0x05, 0x01, 0xff, 0x7f, 0x4a, 0xc7, 0xff, 0xa0, 0x44, 0xff, 0xff, 0x86, 0x3d, 0xf8, 0xff, 0x83, 0x3f, 0xf9, 0xff, 0x8d, 0x45, 0xfd, 0xff, 0x92, 0x4d, 0xff, 0xff, 0x94, 0x50, 0xfc, 0xff, 0x93, 0x53, 0xfb, 0xff, 0x94, 0x53, 0xf8, 0xff, 0x93, 0x53, 0xf6, 0xff, 0x85, 0x53, 0xf5, 0xff, 0x74, 0x4c, 0xf6, 0xff, 0x6d, 0x4a, 0xf2, 0xff, 0x68, 0x49, 0xed, 0xff, 0x62, 0x47, 0xee, 0xff, 0x61, 0x47, 0xf2, 0xff, 0x5d, 0x46, 0xf3, 0xff, 0x56, 0x41, 0xf2, 0xff, 0x53, 0x40, 0xf5, 0xff, 0x52, 0x40, 0xf5, 0xff, 0x4f, 0x3f, 0xf2, 0xff, 0x54, 0x44, 0xf4, 0xff, 0x5d, 0x49, 0xf2, 0xff, 0x66, 0x4a, 0xec, 0xff, 0x71, 0x50, 0xed, 0xff, 0x79, 0x55, 0xed, 0xff, 0x80, 0x58, 0xea, 0xff, 0x89, 0x5b, 0xea, 0xff, 0x8c, 0x59, 0xe0, 0xff, 0x9e, 0x62, 0xdd, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x87, 0x5f, 0x40, 0xac, 0x89, 0x67, 0xfe, 0xad, 0x8e, 0x6e, 0xff, 0xad, 0x90, 0x74, 0xff, 0xad, 0x90, 0x76, 0xff, 0xac, 0x8f, 0x76, 0xff, 0xa7, 0x8d, 0x70, 0xff, 0xa0, 0x89, 0x6e, 0xff, 0x99, 0x84, 0x6f, 0xff, 0x8c, 0x78, 0x72, 0xff, 0x7c, 0x6a, 0x79, 0xff, 0x6c, 0x5c, 0x7b, 0xff, 0x5c, 0x50, 0x82, 0xff, 0x47, 0x41, 0x84, 0xff, 0x36, 0x32, 0x74, 0xff, 0x39, 0x36, 0x73, 0xff, 0x43, 0x42, 0x7a, 0xff, 0x51, 0x4d, 0x78, 0xff, 0x5a, 0x56, 0x73, 0xff, 0x62, 0x5c, 0x6e, 0xff, 0x70, 0x66, 0x75, 0xff, 0x82, 0x76, 0x82, 0xff, 0x81, 0x75, 0x70, 0xff, 0x6f, 0x62, 0x54, 0xff, 0x67, 0x5b, 0x4c, 0xff, 0x75, 0x6a, 0x55, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x4c, 0x3c, 0x2e, 0xff, 0x69, 0x57, 0x4c, 0xff, 0x64, 0x53, 0x49, 0xff, 0x62, 0x54, 0x45, 0xff, 0x64, 0x56, 0x45, 0xff, 0x62, 0x52, 0x45, 0xff, 0x60, 0x50, 0x44, 0xff, 0x61, 0x50, 0x46, 0xff, 0x66, 0x55, 0x4b, 0xff, 0x5e, 0x50, 0x47, 0xff, 0x5a, 0x4d, 0x42, 0xff, 0x55, 0x4a, 0x3e, 0xff, 0x5e, 0x54, 0x47, 0xff, 0x55, 0x4a, 0x3d, 0xff, 0x4c, 0x42, 0x36, 0xff, 0x54, 0x4d, 0x43, 0xff, 0x50, 0x48, 0x42, 0xff, 0x4d, 0x45, 0x3e, 0xff, 0x4a, 0x45, 0x35, 0xff, 0x4b, 0x45, 0x32, 0xff, 0x23, 0x25, 0x14, 0xff, 0x11, 0x1a, 0x2a, 0xff, 0x0b, 0x26, 0x60, 0xff, 0x11, 0x39, 0x7a, 0xff, 0x98, 0xb7, 0xe7, 0xff, 0xde, 0xfc, 0xff, 0xff, 0xd2, 0xfa, 0xf5, 0xff, 0xcc, 0xf3, 0xec, 0xff, 0xc8, 0xe4, 0xfc, 0xff, 0xbb, 0xdb, 0xf9, 0xff, 0xaf, 0xd7, 0xf3, 0xff, 0xa6, 0xd4, 0xf3, 0xff, 0xa2, 0xd4, 0xf7, 0xff, 0xa1, 0xd6, 0xf7, 0xff, 0x9c, 0xd4, 0xf2, 0xff, 0x9b, 0xd5, 0xf3, 0xff, 0x9e, 0xd5, 0xf4, 0xff, 0xa0, 0xd2, 0xf3, 0xff, 0xa3, 0xd1, 0xf4, 0xff, 0xa1, 0xcd, 0xf9, 0xff, 0x9e, 0xcc, 0xff, 0xff, 0x93, 0xce, 0xfe, 0xff, 0x84, 0xcc, 0xf7, 0xff, 0x80, 0xd5, 0xfb, 0xff, 0x8e, 0xf3, 0xff, 0xff, 0x45, 0x76, 0xa1, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0f, 0x02, 0x00, 0xff, 0x05, 0x02, 0x0d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3e, 0x2d, 0x5b, 0xff, 0xa4, 0x59, 0xff, 0xff, 0x88, 0x39, 0xfc, 0xff, 0x8c, 0x44, 0xf6, 0xff, 0x93, 0x48, 0xfe, 0xff, 0x96, 0x4f, 0xfd, 0xff, 0x99, 0x52, 0xfe, 0xff, 0x98, 0x57, 0xfd, 0xff, 0x9a, 0x58, 0xf7, 0xff, 0x9d, 0x57, 0xf7, 0xff, 0x92, 0x56, 0xfb, 0xff, 0x81, 0x52, 0xfc, 0xff, 0x74, 0x4c, 0xf6, 0xff, 0x6a, 0x46, 0xef, 0xff, 0x61, 0x42, 0xed, 0xff, 0x5d, 0x41, 0xf1, 0xff, 0x5a, 0x3e, 0xf4, 0xff, 0x56, 0x3c, 0xf3, 0xff, 0x4c, 0x3b, 0xf5, 0xff, 0x48, 0x3b, 0xf3, 0xff, 0x49, 0x3a, 0xf0, 0xff, 0x4d, 0x3e, 0xf0, 0xff, 0x59, 0x43, 0xf2, 0xff, 0x61, 0x46, 0xee, 0xff, 0x6a, 0x4c, 0xeb, 0xff, 0x72, 0x4d, 0xe8, 0xff, 0x7c, 0x51, 0xe9, 0xff, 0x87, 0x57, 0xed, 0xff, 0x89, 0x58, 0xe3, 0xff, 0x94, 0x60, 0xdb, 0xfe, 0xb0, 0x6d, 0xd3, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x8d, 0x55, 0x09, 0xae, 0x8a, 0x60, 0xdb, 0xac, 0x8b, 0x65, 0xff, 0xab, 0x8d, 0x6a, 0xff, 0xab, 0x8f, 0x6f, 0xff, 0xac, 0x90, 0x72, 0xff, 0xaa, 0x8d, 0x73, 0xff, 0xa6, 0x88, 0x73, 0xff, 0xa1, 0x85, 0x75, 0xff, 0x9b, 0x81, 0x72, 0xff, 0x94, 0x7a, 0x73, 0xff, 0x86, 0x6e, 0x79, 0xff, 0x77, 0x60, 0x7c, 0xff, 0x64, 0x53, 0x82, 0xff, 0x4b, 0x42, 0x82, 0xff, 0x3c, 0x34, 0x74, 0xff, 0x41, 0x38, 0x77, 0xff, 0x4b, 0x42, 0x7c, 0xff, 0x59, 0x4d, 0x79, 0xff, 0x66, 0x59, 0x77, 0xff, 0x71, 0x62, 0x73, 0xff, 0x7c, 0x6a, 0x76, 0xff, 0x86, 0x72, 0x7c, 0xff, 0x71, 0x5f, 0x56, 0xff, 0x67, 0x58, 0x43, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x75, 0x6a, 0x54, 0xff, 0x59, 0x4d, 0x3c, 0xff, 0x4f, 0x41, 0x35, 0xff, 0x68, 0x58, 0x51, 0xff, 0x5f, 0x50, 0x49, 0xff, 0x56, 0x4c, 0x40, 0xff, 0x60, 0x57, 0x47, 0xff, 0x5d, 0x52, 0x41, 0xff, 0x62, 0x57, 0x48, 0xff, 0x5a, 0x4e, 0x40, 0xff, 0x5c, 0x50, 0x43, 0xff, 0x63, 0x58, 0x4a, 0xff, 0x52, 0x48, 0x39, 0xff, 0x4e, 0x46, 0x36, 0xff, 0x58, 0x51, 0x3f, 0xff, 0x49, 0x42, 0x31, 0xff, 0x52, 0x4a, 0x3c, 0xff, 0x53, 0x4a, 0x41, 0xff, 0x51, 0x47, 0x40, 0xff, 0x40, 0x3d, 0x31, 0xff, 0x3a, 0x38, 0x23, 0xff, 0x46, 0x3d, 0x27, 0xff, 0x20, 0x23, 0x1c, 0xff, 0x00, 0x0b, 0x31, 0xff, 0x06, 0x23, 0x6f, 0xff, 0x75, 0xa1, 0xd9, 0xff, 0xd2, 0xfc, 0xff, 0xff, 0xce, 0xef, 0xfe, 0xff, 0xc8, 0xec, 0xfb, 0xff, 0xc6, 0xf0, 0xf4, 0xff, 0xbd, 0xe2, 0xf6, 0xff, 0xb6, 0xd9, 0xf5, 0xff, 0xb2, 0xd8, 0xf5, 0xff, 0xa7, 0xd4, 0xf4, 0xff, 0xa2, 0xd1, 0xf3, 0xff, 0xa4, 0xd0, 0xf5, 0xff, 0x9f, 0xcf, 0xf2, 0xff, 0x9f, 0xd0, 0xf0, 0xff, 0xa3, 0xcf, 0xee, 0xff, 0xa1, 0xce, 0xf0, 0xff, 0x9c, 0xce, 0xf3, 0xff, 0x96, 0xcd, 0xf5, 0xff, 0x92, 0xcb, 0xf5, 0xff, 0x8b, 0xcb, 0xf2, 0xff, 0x84, 0xc7, 0xef, 0xff, 0x7d, 0xc5, 0xed, 0xff, 0x7a, 0xce, 0xf8, 0xff, 0x90, 0xda, 0xff, 0xff, 0x30, 0x4c, 0x68, 0xff, 0x00, 0x00, 0x00, 0xff, 0x09, 0x02, 0x0b, 0xff, 0x00, 0x02, 0x00, 0xff, 0x05, 0x06, 0x04, 0xff, 0x85, 0x58, 0xc4, 0xff, 0xa8, 0x58, 0xff, 0xff, 0x95, 0x47, 0xf9, 0xff, 0x98, 0x51, 0xfb, 0xff, 0x9b, 0x56, 0xfc, 0xff, 0x9c, 0x58, 0xf9, 0xff, 0x9b, 0x5b, 0xfc, 0xff, 0x9e, 0x5c, 0xfc, 0xff, 0xa0, 0x5d, 0xf9, 0xff, 0x96, 0x5c, 0xfb, 0xff, 0x8c, 0x59, 0xfa, 0xff, 0x81, 0x51, 0xf5, 0xff, 0x70, 0x48, 0xf3, 0xff, 0x62, 0x42, 0xf3, 0xff, 0x59, 0x3d, 0xf3, 0xff, 0x58, 0x3b, 0xf6, 0xff, 0x56, 0x39, 0xf7, 0xff, 0x4d, 0x36, 0xf7, 0xff, 0x48, 0x37, 0xf7, 0xff, 0x47, 0x36, 0xf4, 0xff, 0x4c, 0x39, 0xf3, 0xff, 0x5a, 0x40, 0xf6, 0xff, 0x61, 0x41, 0xf1, 0xff, 0x67, 0x44, 0xea, 0xff, 0x70, 0x45, 0xea, 0xff, 0x7c, 0x4a, 0xeb, 0xff, 0x83, 0x4f, 0xed, 0xff, 0x85, 0x55, 0xe4, 0xff, 0x90, 0x5e, 0xdc, 0xff, 0xab, 0x6b, 0xce, 0xdb, 0xc6, 0x71, 0xaa, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x83, 0x58, 0x88, 0xac, 0x88, 0x5f, 0xff, 0xa9, 0x89, 0x62, 0xff, 0xa5, 0x8a, 0x65, 0xff, 0xa6, 0x8c, 0x66, 0xff, 0xa6, 0x8b, 0x69, 0xff, 0xa4, 0x85, 0x6e, 0xff, 0xa0, 0x80, 0x71, 0xff, 0x9d, 0x7d, 0x74, 0xff, 0x99, 0x79, 0x6e, 0xff, 0x92, 0x73, 0x6d, 0xff, 0x88, 0x6b, 0x72, 0xff, 0x7c, 0x62, 0x7b, 0xff, 0x6b, 0x57, 0x81, 0xff, 0x55, 0x43, 0x7e, 0xff, 0x48, 0x39, 0x7c, 0xff, 0x4b, 0x3c, 0x7d, 0xff, 0x57, 0x46, 0x7c, 0xff, 0x64, 0x53, 0x78, 0xff, 0x72, 0x5e, 0x7b, 0xff, 0x7f, 0x68, 0x7a, 0xff, 0x8c, 0x74, 0x7c, 0xff, 0x7d, 0x66, 0x67, 0xff, 0x6c, 0x58, 0x4a, 0xff, 0x69, 0x5a, 0x44, 0xff, 0x65, 0x59, 0x42, 0xff, 0x71, 0x63, 0x50, 0xff, 0x54, 0x45, 0x34, 0xff, 0x51, 0x43, 0x34, 0xff, 0x62, 0x54, 0x4a, 0xff, 0x5b, 0x4e, 0x46, 0xff, 0x5b, 0x4f, 0x46, 0xff, 0x61, 0x58, 0x4a, 0xff, 0x5a, 0x54, 0x40, 0xff, 0x5b, 0x55, 0x42, 0xff, 0x5b, 0x55, 0x44, 0xff, 0x54, 0x4d, 0x3c, 0xff, 0x58, 0x50, 0x3d, 0xff, 0x51, 0x4a, 0x38, 0xff, 0x4d, 0x45, 0x34, 0xff, 0x4f, 0x4a, 0x37, 0xff, 0x50, 0x4b, 0x3a, 0xff, 0x51, 0x49, 0x3f, 0xff, 0x4f, 0x46, 0x40, 0xff, 0x50, 0x4a, 0x3a, 0xff, 0x3d, 0x3e, 0x2a, 0xff, 0x44, 0x3e, 0x2f, 0xff, 0x40, 0x3d, 0x29, 0xff, 0x0b, 0x12, 0x25, 0xff, 0x02, 0x11, 0x51, 0xff, 0x57, 0x75, 0xc0, 0xff, 0xbd, 0xec, 0xff, 0xff, 0xc3, 0xf4, 0xf7, 0xff, 0xba, 0xe1, 0xf2, 0xff, 0xb8, 0xdd, 0xff, 0xff, 0xb0, 0xde, 0xf9, 0xff, 0xa4, 0xd6, 0xf0, 0xff, 0xaa, 0xd3, 0xf0, 0xff, 0xad, 0xd5, 0xf4, 0xff, 0xa3, 0xce, 0xef, 0xff, 0xa0, 0xcb, 0xed, 0xff, 0xa2, 0xcc, 0xf1, 0xff, 0xa1, 0xca, 0xf0, 0xff, 0xa1, 0xcc, 0xf1, 0xff, 0xa1, 0xce, 0xf3, 0xff, 0x9b, 0xce, 0xf3, 0xff, 0x97, 0xcc, 0xf0, 0xff, 0x92, 0xc9, 0xec, 0xff, 0x8c, 0xc8, 0xe8, 0xff, 0x88, 0xc3, 0xea, 0xff, 0x86, 0xc2, 0xee, 0xff, 0x82, 0xc1, 0xf3, 0xff, 0x7c, 0xbd, 0xf4, 0xff, 0x86, 0xdc, 0xff, 0xff, 0x6e, 0xbc, 0xf6, 0xff, 0x09, 0x13, 0x35, 0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x03, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x41, 0x2f, 0x62, 0xff, 0xbb, 0x72, 0xff, 0xff, 0xa3, 0x4f, 0xff, 0xff, 0xa0, 0x56, 0xfd, 0xff, 0xa2, 0x5b, 0xff, 0xff, 0xa1, 0x60, 0xfd, 0xff, 0xa3, 0x63, 0xfd, 0xff, 0xa2, 0x61, 0xfc, 0xff, 0x9e, 0x60, 0xfb, 0xff, 0x97, 0x60, 0xfa, 0xff, 0x94, 0x5e, 0xf6, 0xff, 0x8c, 0x57, 0xf5, 0xff, 0x78, 0x4e, 0xf6, 0xff, 0x65, 0x45, 0xf5, 0xff, 0x5a, 0x3c, 0xf5, 0xff, 0x59, 0x3b, 0xf9, 0xff, 0x53, 0x37, 0xf8, 0xff, 0x4e, 0x32, 0xf9, 0xff, 0x4a, 0x33, 0xfc, 0xff, 0x45, 0x33, 0xf9, 0xff, 0x4d, 0x35, 0xf7, 0xff, 0x58, 0x39, 0xf6, 0xff, 0x63, 0x3c, 0xf3, 0xff, 0x6c, 0x3f, 0xf1, 0xff, 0x6f, 0x40, 0xee, 0xff, 0x76, 0x44, 0xef, 0xff, 0x7b, 0x48, 0xed, 0xff, 0x7f, 0x50, 0xe5, 0xff, 0x8b, 0x5a, 0xdb, 0xff, 0xa7, 0x68, 0xcb, 0xff, 0xc3, 0x74, 0xb2, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x78, 0x57, 0x26, 0xa6, 0x80, 0x54, 0xfa, 0xa9, 0x86, 0x5b, 0xff, 0xa7, 0x89, 0x61, 0xff, 0xa3, 0x8b, 0x61, 0xff, 0xa4, 0x89, 0x66, 0xff, 0xa1, 0x85, 0x69, 0xff, 0x9f, 0x81, 0x6b, 0xff, 0x9d, 0x7d, 0x6d, 0xff, 0x99, 0x7b, 0x6f, 0xff, 0x92, 0x76, 0x69, 0xff, 0x8c, 0x6d, 0x67, 0xff, 0x83, 0x65, 0x70, 0xff, 0x7a, 0x5f, 0x78, 0xff, 0x6d, 0x53, 0x79, 0xff, 0x5b, 0x42, 0x78, 0xff, 0x52, 0x3d, 0x84, 0xff, 0x50, 0x3d, 0x80, 0xff, 0x59, 0x48, 0x76, 0xff, 0x66, 0x56, 0x6f, 0xff, 0x75, 0x61, 0x76, 0xff, 0x85, 0x6c, 0x7d, 0xff, 0x88, 0x6f, 0x74, 0xff, 0x73, 0x5f, 0x58, 0xff, 0x6b, 0x59, 0x45, 0xff, 0x64, 0x54, 0x3e, 0xff, 0x6d, 0x5e, 0x4d, 0xff, 0x71, 0x61, 0x51, 0xff, 0x4d, 0x3f, 0x28, 0xff, 0x54, 0x48, 0x2c, 0xff, 0x60, 0x51, 0x3b, 0xff, 0x5f, 0x4e, 0x3d, 0xff, 0x68, 0x59, 0x47, 0xff, 0x63, 0x56, 0x41, 0xff, 0x5c, 0x55, 0x3f, 0xff, 0x5b, 0x53, 0x3e, 0xff, 0x5a, 0x51, 0x3d, 0xff, 0x55, 0x4c, 0x3a, 0xff, 0x56, 0x4e, 0x3e, 0xff, 0x52, 0x4b, 0x3c, 0xff, 0x4a, 0x43, 0x36, 0xff, 0x4b, 0x43, 0x36, 0xff, 0x50, 0x43, 0x3b, 0xff, 0x52, 0x47, 0x45, 0xff, 0x4a, 0x47, 0x3d, 0xff, 0x40, 0x46, 0x26, 0xff, 0x4c, 0x45, 0x2e, 0xff, 0x47, 0x3a, 0x36, 0xff, 0x28, 0x27, 0x25, 0xff, 0x00, 0x00, 0x37, 0xff, 0x2d, 0x43, 0x8a, 0xff, 0xa5, 0xcf, 0xfb, 0xff, 0xbb, 0xf2, 0xff, 0xff, 0xb0, 0xdd, 0xf4, 0xff, 0xb0, 0xd8, 0xfa, 0xff, 0xa7, 0xd0, 0xf2, 0xff, 0xa6, 0xd3, 0xea, 0xff, 0xa6, 0xd1, 0xf3, 0xff, 0xa3, 0xce, 0xf2, 0xff, 0xa2, 0xcd, 0xee, 0xff, 0xa4, 0xcd, 0xee, 0xff, 0xa4, 0xcc, 0xef, 0xff, 0xa0, 0xcb, 0xf1, 0xff, 0xa0, 0xc9, 0xf1, 0xff, 0x9f, 0xca, 0xf3, 0xff, 0x99, 0xcb, 0xf5, 0xff, 0x95, 0xca, 0xf0, 0xff, 0x94, 0xc8, 0xee, 0xff, 0x92, 0xc5, 0xed, 0xff, 0x90, 0xc4, 0xed, 0xff, 0x8c, 0xc1, 0xec, 0xff, 0x88, 0xbf, 0xee, 0xff, 0x86, 0xc0, 0xf2, 0xff, 0x86, 0xc0, 0xf5, 0xff, 0x7f, 0xc2, 0xee, 0xff, 0x8b, 0xdf, 0xff, 0xff, 0x46, 0x8b, 0xb6, 0xff, 0x00, 0x00, 0x02, 0xff, 0x11, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x09, 0xff, 0x9c, 0x63, 0xca, 0xff, 0xce, 0x7b, 0xff, 0xff, 0xb2, 0x65, 0xfc, 0xff, 0xac, 0x60, 0xff, 0xff, 0xa9, 0x64, 0xff, 0xff, 0xb0, 0x6e, 0xfd, 0xff, 0xac, 0x6a, 0xfa, 0xff, 0xa3, 0x64, 0xfe, 0xff, 0xa1, 0x64, 0xfe, 0xff, 0x9d, 0x61, 0xfb, 0xff, 0x95, 0x5b, 0xfb, 0xff, 0x88, 0x55, 0xfc, 0xff, 0x78, 0x4b, 0xf8, 0xff, 0x6b, 0x40, 0xf6, 0xff, 0x5d, 0x3a, 0xf7, 0xff, 0x4f, 0x35, 0xf6, 0xff, 0x47, 0x31, 0xf7, 0xff, 0x43, 0x2d, 0xfa, 0xff, 0x43, 0x2f, 0xfb, 0xff, 0x4c, 0x33, 0xf6, 0xff, 0x59, 0x36, 0xf4, 0xff, 0x66, 0x3c, 0xf5, 0xff, 0x6c, 0x3f, 0xf4, 0xff, 0x6b, 0x3e, 0xef, 0xff, 0x6d, 0x42, 0xee, 0xff, 0x72, 0x45, 0xee, 0xff, 0x7c, 0x4d, 0xea, 0xff, 0x85, 0x58, 0xdc, 0xff, 0xa3, 0x66, 0xca, 0xff, 0xbf, 0x75, 0xb0, 0xfa, 0xd0, 0x78, 0x8c, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x77, 0x54, 0xb3, 0xa2, 0x7d, 0x55, 0xff, 0xa8, 0x87, 0x5b, 0xff, 0xa6, 0x8b, 0x5f, 0xff, 0xa3, 0x8b, 0x5f, 0xff, 0xa4, 0x89, 0x66, 0xff, 0xa4, 0x85, 0x68, 0xff, 0xa1, 0x81, 0x69, 0xff, 0x9c, 0x7f, 0x6c, 0xff, 0x97, 0x80, 0x6c, 0xff, 0x90, 0x76, 0x65, 0xff, 0x8a, 0x6c, 0x67, 0xff, 0x82, 0x63, 0x6f, 0xff, 0x73, 0x58, 0x71, 0xff, 0x6c, 0x4e, 0x74, 0xff, 0x63, 0x43, 0x78, 0xff, 0x59, 0x40, 0x83, 0xff, 0x52, 0x43, 0x7c, 0xff, 0x57, 0x49, 0x6d, 0xff, 0x67, 0x55, 0x6c, 0xff, 0x7c, 0x66, 0x74, 0xff, 0x81, 0x67, 0x74, 0xff, 0x72, 0x5d, 0x5f, 0xff, 0x64, 0x54, 0x45, 0xff, 0x61, 0x54, 0x3c, 0xff, 0x61, 0x53, 0x3e, 0xff, 0x63, 0x53, 0x44, 0xff, 0x6c, 0x5c, 0x4c, 0xff, 0x48, 0x3b, 0x24, 0xff, 0x56, 0x4a, 0x2b, 0xff, 0x66, 0x5b, 0x3b, 0xff, 0x60, 0x54, 0x39, 0xff, 0x54, 0x48, 0x31, 0xff, 0x59, 0x4f, 0x39, 0xff, 0x5e, 0x57, 0x42, 0xff, 0x5c, 0x53, 0x40, 0xff, 0x53, 0x4a, 0x38, 0xff, 0x53, 0x49, 0x39, 0xff, 0x5c, 0x52, 0x43, 0xff, 0x58, 0x50, 0x40, 0xff, 0x4e, 0x48, 0x3b, 0xff, 0x4a, 0x42, 0x39, 0xff, 0x50, 0x3c, 0x39, 0xff, 0x55, 0x49, 0x47, 0xff, 0x44, 0x49, 0x3b, 0xff, 0x39, 0x40, 0x20, 0xff, 0x4c, 0x40, 0x2b, 0xff, 0x46, 0x31, 0x32, 0xff, 0x13, 0x12, 0x23, 0xff, 0x00, 0x0d, 0x56, 0xff, 0x7a, 0x9c, 0xd7, 0xff, 0xc4, 0xf2, 0xff, 0xff, 0xae, 0xe5, 0xf4, 0xff, 0xa8, 0xd7, 0xf7, 0xff, 0xac, 0xd5, 0xfd, 0xff, 0xad, 0xd9, 0xf2, 0xff, 0xad, 0xda, 0xea, 0xff, 0xac, 0xd3, 0xf1, 0xff, 0xa9, 0xd1, 0xf3, 0xff, 0xa7, 0xd1, 0xf1, 0xff, 0xa9, 0xd0, 0xf1, 0xff, 0xaa, 0xd0, 0xf2, 0xff, 0xa7, 0xd0, 0xf4, 0xff, 0xa3, 0xcd, 0xf3, 0xff, 0xa1, 0xcd, 0xf5, 0xff, 0x98, 0xcb, 0xf3, 0xff, 0x98, 0xc8, 0xef, 0xff, 0x99, 0xc8, 0xef, 0xff, 0x97, 0xc6, 0xf0, 0xff, 0x95, 0xc5, 0xf1, 0xff, 0x8f, 0xc2, 0xee, 0xff, 0x8a, 0xc1, 0xeb, 0xff, 0x86, 0xbe, 0xea, 0xff, 0x85, 0xbd, 0xef, 0xff, 0x8b, 0xc1, 0xf2, 0xff, 0x76, 0xc3, 0xf3, 0xff, 0x7d, 0xdc, 0xff, 0xff, 0x2f, 0x4f, 0x77, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0f, 0x05, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x5b, 0x3b, 0x6b, 0xff, 0xe9, 0x98, 0xff, 0xff, 0xbc, 0x71, 0xf9, 0xff, 0xb5, 0x6c, 0xff, 0xff, 0xb4, 0x71, 0xfd, 0xff, 0xb8, 0x77, 0xfc, 0xff, 0xb6, 0x73, 0xfd, 0xff, 0xaf, 0x6e, 0xfe, 0xff, 0xab, 0x69, 0xff, 0xff, 0xa4, 0x66, 0xff, 0xff, 0x9c, 0x62, 0xfe, 0xff, 0x94, 0x5c, 0xfd, 0xff, 0x88, 0x52, 0xfc, 0xff, 0x7b, 0x46, 0xf9, 0xff, 0x67, 0x3c, 0xf6, 0xff, 0x51, 0x37, 0xf4, 0xff, 0x43, 0x30, 0xf9, 0xff, 0x3f, 0x2b, 0xfa, 0xff, 0x40, 0x2e, 0xf8, 0xff, 0x49, 0x33, 0xf6, 0xff, 0x5a, 0x37, 0xf4, 0xff, 0x67, 0x3b, 0xf3, 0xff, 0x66, 0x3c, 0xf1, 0xff, 0x64, 0x3d, 0xef, 0xff, 0x67, 0x41, 0xec, 0xff, 0x6d, 0x42, 0xe9, 0xff, 0x7a, 0x4b, 0xe7, 0xff, 0x88, 0x55, 0xdd, 0xff, 0xa4, 0x67, 0xcb, 0xff, 0xba, 0x77, 0xad, 0xff, 0xca, 0x7f, 0x88, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x6c, 0x4b, 0x44, 0x9c, 0x73, 0x50, 0xff, 0xa0, 0x79, 0x53, 0xff, 0xa6, 0x84, 0x59, 0xff, 0xa7, 0x88, 0x5a, 0xff, 0xa2, 0x88, 0x5b, 0xff, 0xa1, 0x88, 0x5f, 0xff, 0xa4, 0x86, 0x63, 0xff, 0xa4, 0x85, 0x69, 0xff, 0x9f, 0x83, 0x6d, 0xff, 0x98, 0x81, 0x6b, 0xff, 0x90, 0x77, 0x63, 0xff, 0x89, 0x6b, 0x65, 0xff, 0x7f, 0x61, 0x68, 0xff, 0x73, 0x58, 0x6d, 0xff, 0x67, 0x49, 0x6e, 0xff, 0x5d, 0x3d, 0x6f, 0xff, 0x58, 0x40, 0x7a, 0xff, 0x56, 0x45, 0x7c, 0xff, 0x59, 0x45, 0x72, 0xff, 0x6e, 0x56, 0x72, 0xff, 0x7d, 0x63, 0x6d, 0xff, 0x6d, 0x54, 0x53, 0xff, 0x66, 0x52, 0x49, 0xff, 0x5e, 0x4f, 0x3f, 0xff, 0x56, 0x4c, 0x39, 0xff, 0x5e, 0x54, 0x44, 0xff, 0x5d, 0x51, 0x45, 0xff, 0x5b, 0x4e, 0x43, 0xff, 0x46, 0x3b, 0x2c, 0xff, 0x4f, 0x47, 0x30, 0xff, 0x58, 0x53, 0x37, 0xff, 0x52, 0x4b, 0x35, 0xff, 0x54, 0x4d, 0x3b, 0xff, 0x5c, 0x55, 0x46, 0xff, 0x53, 0x4a, 0x3a, 0xff, 0x51, 0x49, 0x3a, 0xff, 0x5b, 0x54, 0x44, 0xff, 0x50, 0x47, 0x38, 0xff, 0x53, 0x4a, 0x39, 0xff, 0x52, 0x4b, 0x38, 0xff, 0x4c, 0x46, 0x39, 0xff, 0x4e, 0x46, 0x3c, 0xff, 0x56, 0x47, 0x3a, 0xff, 0x49, 0x3f, 0x36, 0xff, 0x42, 0x47, 0x3d, 0xff, 0x48, 0x47, 0x36, 0xff, 0x46, 0x3b, 0x25, 0xff, 0x38, 0x26, 0x23, 0xff, 0x00, 0x00, 0x22, 0xff, 0x3b, 0x58, 0x9b, 0xff, 0xc2, 0xeb, 0xff, 0xff, 0xc1, 0xee, 0xfe, 0xff, 0xaf, 0xe1, 0xf3, 0xff, 0xb1, 0xe0, 0xfb, 0xff, 0xb6, 0xdd, 0xfe, 0xff, 0xb6, 0xe0, 0xf6, 0xff, 0xb5, 0xde, 0xf2, 0xff, 0xb4, 0xdb, 0xf3, 0xff, 0xb3, 0xd9, 0xf2, 0xff, 0xb4, 0xda, 0xf3, 0xff, 0xb2, 0xd8, 0xf3, 0xff, 0xb1, 0xd6, 0xf4, 0xff, 0xac, 0xd2, 0xf2, 0xff, 0xa7, 0xd0, 0xf3, 0xff, 0xa4, 0xd2, 0xf5, 0xff, 0xa0, 0xcf, 0xf4, 0xff, 0x9f, 0xcc, 0xf1, 0xff, 0xa0, 0xcc, 0xf2, 0xff, 0x9e, 0xcc, 0xf2, 0xff, 0x9b, 0xc9, 0xf1, 0xff, 0x95, 0xc7, 0xf0, 0xff, 0x8f, 0xc5, 0xed, 0xff, 0x8e, 0xc5, 0xed, 0xff, 0x8b, 0xc2, 0xf1, 0xff, 0x86, 0xc1, 0xed, 0xff, 0x78, 0xc0, 0xeb, 0xff, 0x84, 0xd3, 0xff, 0xff, 0x74, 0xb6, 0xe9, 0xff, 0x00, 0x0c, 0x23, 0xff, 0x09, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x14, 0x07, 0x1e, 0xff, 0xc4, 0x82, 0xdf, 0xff, 0xd5, 0x8d, 0xff, 0xff, 0xc2, 0x7c, 0xff, 0xff, 0xbe, 0x7f, 0xf8, 0xff, 0xba, 0x7a, 0xfa, 0xff, 0xbb, 0x79, 0xff, 0xff, 0xb7, 0x77, 0xfc, 0xff, 0xb2, 0x70, 0xfd, 0xff, 0xac, 0x6c, 0xff, 0xff, 0xa4, 0x68, 0xfe, 0xff, 0x9d, 0x61, 0xfc, 0xff, 0x94, 0x56, 0xfd, 0xff, 0x88, 0x4c, 0xfe, 0xff, 0x73, 0x43, 0xf8, 0xff, 0x59, 0x39, 0xf3, 0xff, 0x46, 0x2e, 0xf8, 0xff, 0x3d, 0x29, 0xf9, 0xff, 0x3c, 0x2d, 0xf4, 0xff, 0x45, 0x35, 0xf6, 0xff, 0x56, 0x37, 0xf5, 0xff, 0x64, 0x39, 0xf3, 0xff, 0x65, 0x3a, 0xf0, 0xff, 0x63, 0x3c, 0xef, 0xff, 0x67, 0x3e, 0xea, 0xff, 0x6e, 0x41, 0xe6, 0xff, 0x7c, 0x4b, 0xe5, 0xff, 0x8d, 0x54, 0xdb, 0xff, 0xa6, 0x67, 0xc7, 0xff, 0xba, 0x77, 0xaa, 0xff, 0xcd, 0x82, 0x86, 0xff, 0xe1, 0x8e, 0x6c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x6c, 0x49, 0xc8, 0xa0, 0x72, 0x50, 0xff, 0xa3, 0x77, 0x54, 0xff, 0xa8, 0x81, 0x58, 0xff, 0xa7, 0x87, 0x58, 0xff, 0xa5, 0x89, 0x59, 0xff, 0xa4, 0x8a, 0x5e, 0xff, 0xa7, 0x89, 0x63, 0xff, 0xa7, 0x87, 0x69, 0xff, 0xa2, 0x86, 0x6b, 0xff, 0x9b, 0x82, 0x6a, 0xff, 0x97, 0x7b, 0x66, 0xff, 0x8d, 0x6e, 0x64, 0xff, 0x82, 0x63, 0x64, 0xff, 0x77, 0x58, 0x6a, 0xff, 0x67, 0x49, 0x69, 0xff, 0x5d, 0x43, 0x6d, 0xff, 0x55, 0x40, 0x70, 0xff, 0x53, 0x3c, 0x74, 0xff, 0x62, 0x46, 0x7c, 0xff, 0x6e, 0x54, 0x71, 0xff, 0x6a, 0x55, 0x57, 0xff, 0x68, 0x53, 0x41, 0xff, 0x6f, 0x5c, 0x45, 0xff, 0x5c, 0x4d, 0x3e, 0xff, 0x54, 0x4a, 0x3f, 0xff, 0x5a, 0x51, 0x48, 0xff, 0x56, 0x4c, 0x46, 0xff, 0x54, 0x4a, 0x45, 0xff, 0x42, 0x39, 0x2f, 0xff, 0x53, 0x4d, 0x3b, 0xff, 0x4f, 0x4b, 0x38, 0xff, 0x4c, 0x46, 0x39, 0xff, 0x50, 0x4b, 0x42, 0xff, 0x4d, 0x46, 0x3e, 0xff, 0x54, 0x4b, 0x40, 0xff, 0x55, 0x4e, 0x41, 0xff, 0x4f, 0x48, 0x3a, 0xff, 0x48, 0x42, 0x35, 0xff, 0x49, 0x43, 0x34, 0xff, 0x49, 0x43, 0x32, 0xff, 0x4c, 0x44, 0x3a, 0xff, 0x4d, 0x45, 0x3a, 0xff, 0x51, 0x46, 0x30, 0xff, 0x4f, 0x47, 0x37, 0xff, 0x41, 0x40, 0x3b, 0xff, 0x45, 0x39, 0x38, 0xff, 0x44, 0x3a, 0x23, 0xff, 0x21, 0x1c, 0x1a, 0xff, 0x01, 0x09, 0x40, 0xff, 0x85, 0xa8, 0xdc, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xbf, 0xed, 0xfc, 0xff, 0xba, 0xe6, 0xf3, 0xff, 0xbb, 0xe2, 0xf9, 0xff, 0xbc, 0xe0, 0xfa, 0xff, 0xbc, 0xe1, 0xf6, 0xff, 0xc0, 0xe3, 0xf8, 0xff, 0xc0, 0xe1, 0xf8, 0xff, 0xbb, 0xdf, 0xf1, 0xff, 0xbb, 0xdf, 0xf1, 0xff, 0xbd, 0xe0, 0xf3, 0xff, 0xb9, 0xdc, 0xf1, 0xff, 0xb0, 0xd5, 0xf0, 0xff, 0xad, 0xd4, 0xf4, 0xff, 0xaa, 0xd5, 0xf6, 0xff, 0xa6, 0xd3, 0xf5, 0xff, 0xa4, 0xd0, 0xf2, 0xff, 0xa5, 0xd1, 0xf4, 0xff, 0xa4, 0xd0, 0xf4, 0xff, 0xa0, 0xcd, 0xf2, 0xff, 0x9d, 0xcc, 0xf5, 0xff, 0x99, 0xcc, 0xf2, 0xff, 0x97, 0xcb, 0xf3, 0xff, 0x91, 0xc3, 0xf1, 0xff, 0x83, 0xc0, 0xe9, 0xff, 0x88, 0xc2, 0xe9, 0xff, 0x79, 0xbb, 0xf4, 0xff, 0x80, 0xdf, 0xff, 0xff, 0x40, 0x6f, 0x99, 0xff, 0x00, 0x00, 0x00, 0xff, 0x03, 0x06, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x85, 0x5a, 0x99, 0xff, 0xe9, 0xa1, 0xff, 0xff, 0xcb, 0x84, 0xf9, 0xff, 0xc6, 0x87, 0xf5, 0xff, 0xbf, 0x7d, 0xfd, 0xff, 0xbe, 0x7b, 0xfe, 0xff, 0xbd, 0x7a, 0xfc, 0xff, 0xba, 0x76, 0xfc, 0xff, 0xb7, 0x72, 0xfe, 0xff, 0xb1, 0x6d, 0xff, 0xff, 0xab, 0x67, 0xfe, 0xff, 0xa4, 0x5d, 0xff, 0xff, 0x98, 0x52, 0xff, 0xff, 0x83, 0x46, 0xfa, 0xff, 0x6b, 0x3b, 0xf3, 0xff, 0x55, 0x34, 0xf7, 0xff, 0x44, 0x2b, 0xf5, 0xff, 0x3c, 0x29, 0xf0, 0xff, 0x47, 0x35, 0xf7, 0xff, 0x53, 0x37, 0xf6, 0xff, 0x61, 0x39, 0xf5, 0xff, 0x69, 0x3c, 0xf4, 0xff, 0x66, 0x3c, 0xf0, 0xff, 0x6a, 0x3e, 0xe8, 0xff, 0x77, 0x44, 0xe7, 0xff, 0x87, 0x4f, 0xe7, 0xff, 0x95, 0x57, 0xda, 0xff, 0xad, 0x68, 0xc3, 0xff, 0xc2, 0x79, 0xa5, 0xff, 0xd1, 0x86, 0x82, 0xff, 0xde, 0x94, 0x65, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x69, 0x45, 0x4d, 0xa2, 0x6e, 0x4c, 0xff, 0xa5, 0x71, 0x51, 0xff, 0xa7, 0x79, 0x58, 0xff, 0xab, 0x83, 0x5a, 0xff, 0xa8, 0x87, 0x56, 0xff, 0xa6, 0x87, 0x55, 0xff, 0xa7, 0x8d, 0x5d, 0xff, 0xab, 0x8e, 0x63, 0xff, 0xab, 0x8b, 0x68, 0xff, 0xa1, 0x86, 0x67, 0xff, 0x9e, 0x83, 0x68, 0xff, 0x9b, 0x7d, 0x66, 0xff, 0x96, 0x75, 0x67, 0xff, 0x8b, 0x6c, 0x67, 0xff, 0x79, 0x5a, 0x68, 0xff, 0x65, 0x4a, 0x67, 0xff, 0x55, 0x41, 0x64, 0xff, 0x52, 0x40, 0x66, 0xff, 0x55, 0x3c, 0x68, 0xff, 0x62, 0x45, 0x74, 0xff, 0x65, 0x49, 0x66, 0xff, 0x64, 0x4e, 0x4b, 0xff, 0x6c, 0x5e, 0x3f, 0xff, 0x6e, 0x63, 0x44, 0xff, 0x5c, 0x4b, 0x3d, 0xff, 0x57, 0x47, 0x3c, 0xff, 0x58, 0x4c, 0x43, 0xff, 0x55, 0x4b, 0x46, 0xff, 0x55, 0x49, 0x45, 0xff, 0x43, 0x39, 0x2f, 0xff, 0x4e, 0x47, 0x37, 0xff, 0x4e, 0x48, 0x38, 0xff, 0x55, 0x50, 0x44, 0xff, 0x49, 0x43, 0x3b, 0xff, 0x48, 0x42, 0x3c, 0xff, 0x4e, 0x47, 0x43, 0xff, 0x49, 0x44, 0x3c, 0xff, 0x46, 0x41, 0x36, 0xff, 0x45, 0x42, 0x34, 0xff, 0x43, 0x42, 0x33, 0xff, 0x4b, 0x47, 0x38, 0xff, 0x4a, 0x41, 0x39, 0xff, 0x43, 0x39, 0x31, 0xff, 0x53, 0x49, 0x33, 0xff, 0x54, 0x4b, 0x38, 0xff, 0x40, 0x3d, 0x36, 0xff, 0x41, 0x2e, 0x3a, 0xff, 0x43, 0x36, 0x2b, 0xff, 0x11, 0x14, 0x15, 0xff, 0x2c, 0x38, 0x7e, 0xff, 0xbb, 0xe7, 0xff, 0xff, 0xc6, 0xf8, 0xff, 0xff, 0xc0, 0xed, 0xfc, 0xff, 0xc3, 0xea, 0xf7, 0xff, 0xc8, 0xea, 0xf9, 0xff, 0xc4, 0xe7, 0xf9, 0xff, 0xc3, 0xe4, 0xf8, 0xff, 0xca, 0xe8, 0xfc, 0xff, 0xca, 0xe7, 0xfa, 0xff, 0xc4, 0xe3, 0xf3, 0xff, 0xc3, 0xe3, 0xf4, 0xff, 0xc8, 0xe6, 0xf9, 0xff, 0xc4, 0xe0, 0xf4, 0xff, 0xbb, 0xdb, 0xf3, 0xff, 0xb6, 0xda, 0xf4, 0xff, 0xb2, 0xd9, 0xf5, 0xff, 0xab, 0xd4, 0xf4, 0xff, 0xa9, 0xd3, 0xf3, 0xff, 0xac, 0xd6, 0xf6, 0xff, 0xaa, 0xd5, 0xf7, 0xff, 0xa5, 0xd1, 0xf3, 0xff, 0xa2, 0xce, 0xf3, 0xff, 0xa1, 0xcf, 0xf3, 0xff, 0x9d, 0xce, 0xf3, 0xff, 0x9b, 0xcc, 0xf8, 0xff, 0x89, 0xcb, 0xf2, 0xff, 0x8b, 0xc7, 0xe6, 0xff, 0x82, 0xc2, 0xf4, 0xff, 0x7a, 0xca, 0xff, 0xff, 0x78, 0xc7, 0xff, 0xff, 0x13, 0x20, 0x3b, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x4c, 0x2c, 0x58, 0xff, 0xe0, 0x9d, 0xff, 0xff, 0xd4, 0x8f, 0xf6, 0xff, 0xcd, 0x89, 0xf4, 0xff, 0xc3, 0x7d, 0xff, 0xff, 0xbf, 0x7c, 0xfe, 0xff, 0xc2, 0x7d, 0xfd, 0xff, 0xc1, 0x7a, 0xfd, 0xff, 0xbf, 0x75, 0xfe, 0xff, 0xba, 0x6f, 0xfc, 0xff, 0xb6, 0x6a, 0xfc, 0xff, 0xae, 0x60, 0xfe, 0xff, 0xa5, 0x55, 0xff, 0xff, 0x9b, 0x4c, 0xfd, 0xff, 0x84, 0x42, 0xf7, 0xff, 0x66, 0x37, 0xf8, 0xff, 0x4f, 0x2c, 0xf5, 0xff, 0x46, 0x2b, 0xf3, 0xff, 0x4b, 0x33, 0xf6, 0xff, 0x55, 0x36, 0xf7, 0xff, 0x61, 0x38, 0xf6, 0xff, 0x68, 0x3b, 0xf5, 0xff, 0x69, 0x3c, 0xf1, 0xff, 0x6e, 0x3f, 0xe8, 0xff, 0x7d, 0x48, 0xea, 0xff, 0x8e, 0x51, 0xe7, 0xff, 0x9b, 0x5a, 0xd7, 0xff, 0xb3, 0x6a, 0xc0, 0xff, 0xc6, 0x79, 0xa0, 0xff, 0xd1, 0x86, 0x7c, 0xff, 0xdc, 0x98, 0x5f, 0xff, 0xee, 0xa5, 0x52, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x72, 0x4a, 0xcd, 0xaa, 0x73, 0x4f, 0xff, 0xae, 0x76, 0x55, 0xff, 0xae, 0x7c, 0x59, 0xff, 0xae, 0x83, 0x59, 0xff, 0xa9, 0x84, 0x54, 0xff, 0xa8, 0x87, 0x55, 0xff, 0xaa, 0x8c, 0x5d, 0xff, 0xab, 0x8e, 0x63, 0xff, 0xa9, 0x8b, 0x66, 0xff, 0xa6, 0x8b, 0x69, 0xff, 0xa7, 0x8a, 0x6d, 0xff, 0x9e, 0x7d, 0x65, 0xff, 0x98, 0x76, 0x65, 0xff, 0x8d, 0x6b, 0x68, 0xff, 0x7d, 0x5d, 0x64, 0xff, 0x6f, 0x52, 0x64, 0xff, 0x5d, 0x45, 0x63, 0xff, 0x56, 0x40, 0x67, 0xff, 0x56, 0x3c, 0x66, 0xff, 0x5b, 0x3e, 0x64, 0xff, 0x59, 0x40, 0x52, 0xff, 0x61, 0x4e, 0x43, 0xff, 0x6a, 0x5e, 0x40, 0xff, 0x58, 0x4e, 0x32, 0xff, 0x52, 0x46, 0x35, 0xff, 0x57, 0x49, 0x3e, 0xff, 0x59, 0x49, 0x40, 0xff, 0x5e, 0x4d, 0x48, 0xff, 0x54, 0x43, 0x3e, 0xff, 0x47, 0x38, 0x2f, 0xff, 0x4a, 0x3e, 0x2f, 0xff, 0x4a, 0x41, 0x31, 0xff, 0x4d, 0x44, 0x39, 0xff, 0x49, 0x3f, 0x38, 0xff, 0x4f, 0x45, 0x42, 0xff, 0x46, 0x3f, 0x3d, 0xff, 0x45, 0x3f, 0x38, 0xff, 0x46, 0x40, 0x37, 0xff, 0x46, 0x43, 0x36, 0xff, 0x3f, 0x3c, 0x2d, 0xff, 0x46, 0x41, 0x33, 0xff, 0x48, 0x40, 0x38, 0xff, 0x47, 0x3d, 0x34, 0xff, 0x4c, 0x42, 0x2f, 0xff, 0x4b, 0x45, 0x34, 0xff, 0x43, 0x3d, 0x34, 0xff, 0x4f, 0x39, 0x41, 0xff, 0x3c, 0x2f, 0x27, 0xff, 0x00, 0x06, 0x10, 0xff, 0x5f, 0x77, 0xba, 0xff, 0xd1, 0xff, 0xff, 0xff, 0xbb, 0xec, 0xfa, 0xff, 0xc3, 0xe9, 0xfc, 0xff, 0xcb, 0xec, 0xfb, 0xff, 0xca, 0xeb, 0xf7, 0xff, 0xc9, 0xe9, 0xf6, 0xff, 0xc8, 0xe6, 0xf9, 0xff, 0xc9, 0xe7, 0xfc, 0xff, 0xc3, 0xe5, 0xf5, 0xff, 0xca, 0xe5, 0xf6, 0xff, 0xcf, 0xe8, 0xfa, 0xff, 0xd0, 0xea, 0xfc, 0xff, 0xc5, 0xe4, 0xf6, 0xff, 0xbb, 0xdd, 0xf3, 0xff, 0xb3, 0xd8, 0xf5, 0xff, 0xad, 0xd5, 0xf5, 0xff, 0xac, 0xd4, 0xf4, 0xff, 0xad, 0xd5, 0xf5, 0xff, 0xb2, 0xd7, 0xfa, 0xff, 0xb1, 0xd8, 0xfd, 0xff, 0xa6, 0xd1, 0xf7, 0xff, 0xa5, 0xd0, 0xf6, 0xff, 0xa6, 0xd4, 0xfa, 0xff, 0x9e, 0xcf, 0xf5, 0xff, 0xa0, 0xcd, 0xf9, 0xff, 0x97, 0xcf, 0xf8, 0xff, 0x8a, 0xcf, 0xf1, 0xff, 0x93, 0xcb, 0xf2, 0xff, 0x8c, 0xc4, 0xfd, 0xff, 0x92, 0xe3, 0xff, 0xff, 0x59, 0x88, 0xa9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x13, 0x0a, 0x22, 0xff, 0xc4, 0x85, 0xe7, 0xff, 0xe6, 0x98, 0xff, 0xff, 0xce, 0x8a, 0xf9, 0xff, 0xc4, 0x79, 0xff, 0xff, 0xc5, 0x79, 0xff, 0xff, 0xc5, 0x7b, 0xfe, 0xff, 0xca, 0x7a, 0xfe, 0xff, 0xc9, 0x76, 0xff, 0xff, 0xc2, 0x71, 0xfb, 0xff, 0xbf, 0x6b, 0xfa, 0xff, 0xbd, 0x62, 0xfb, 0xff, 0xb7, 0x58, 0xfe, 0xff, 0xa8, 0x51, 0xfe, 0xff, 0x94, 0x48, 0xfa, 0xff, 0x76, 0x37, 0xf4, 0xff, 0x5a, 0x2d, 0xf2, 0xff, 0x50, 0x2d, 0xf3, 0xff, 0x4f, 0x32, 0xf5, 0xff, 0x56, 0x35, 0xf6, 0xff, 0x61, 0x3a, 0xf6, 0xff, 0x69, 0x3a, 0xf3, 0xff, 0x67, 0x38, 0xec, 0xff, 0x70, 0x3e, 0xe9, 0xff, 0x85, 0x48, 0xea, 0xff, 0x92, 0x4f, 0xe4, 0xff, 0xa2, 0x5a, 0xd6, 0xff, 0xb8, 0x6b, 0xbd, 0xff, 0xc7, 0x7b, 0x9b, 0xff, 0xd3, 0x8b, 0x75, 0xff, 0xe0, 0x9f, 0x5b, 0xff, 0xee, 0xaa, 0x4f, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x6f, 0x47, 0x40, 0xb0, 0x77, 0x4d, 0xff, 0xaf, 0x78, 0x4f, 0xff, 0xb1, 0x78, 0x57, 0xff, 0xb3, 0x7d, 0x59, 0xff, 0xb0, 0x82, 0x57, 0xff, 0xac, 0x85, 0x55, 0xff, 0xab, 0x88, 0x58, 0xff, 0xad, 0x8b, 0x60, 0xff, 0xaf, 0x8e, 0x67, 0xff, 0xaa, 0x8b, 0x69, 0xff, 0xa7, 0x89, 0x6b, 0xff, 0xa9, 0x89, 0x6c, 0xff, 0xa7, 0x83, 0x66, 0xff, 0xa1, 0x7a, 0x67, 0xff, 0x97, 0x6e, 0x6a, 0xff, 0x87, 0x64, 0x67, 0xff, 0x76, 0x58, 0x64, 0xff, 0x66, 0x49, 0x63, 0xff, 0x53, 0x3d, 0x67, 0xff, 0x53, 0x3b, 0x66, 0xff, 0x57, 0x3f, 0x5b, 0xff, 0x54, 0x43, 0x49, 0xff, 0x5b, 0x4d, 0x42, 0xff, 0x62, 0x53, 0x43, 0xff, 0x58, 0x4c, 0x3b, 0xff, 0x50, 0x4a, 0x38, 0xff, 0x54, 0x4d, 0x3b, 0xff, 0x52, 0x47, 0x37, 0xff, 0x51, 0x42, 0x38, 0xff, 0x50, 0x42, 0x3a, 0xff, 0x42, 0x37, 0x2a, 0xff, 0x52, 0x4a, 0x38, 0xff, 0x4a, 0x42, 0x32, 0xff, 0x46, 0x3e, 0x32, 0xff, 0x4e, 0x47, 0x40, 0xff, 0x44, 0x3c, 0x37, 0xff, 0x49, 0x3e, 0x38, 0xff, 0x46, 0x3c, 0x35, 0xff, 0x44, 0x3a, 0x33, 0xff, 0x4a, 0x43, 0x39, 0xff, 0x3d, 0x3a, 0x2b, 0xff, 0x41, 0x3b, 0x2f, 0xff, 0x45, 0x3f, 0x35, 0xff, 0x50, 0x47, 0x3b, 0xff, 0x42, 0x3c, 0x2b, 0xff, 0x41, 0x40, 0x32, 0xff, 0x40, 0x3c, 0x33, 0xff, 0x47, 0x3a, 0x30, 0xff, 0x2e, 0x22, 0x1e, 0xff, 0x01, 0x12, 0x34, 0xff, 0x92, 0xbb, 0xe2, 0xff, 0xca, 0xfe, 0xff, 0xff, 0xbc, 0xe7, 0xf9, 0xff, 0xc9, 0xe9, 0xfb, 0xff, 0xd3, 0xef, 0xfb, 0xff, 0xd2, 0xef, 0xf7, 0xff, 0xd3, 0xee, 0xfa, 0xff, 0xce, 0xe8, 0xfb, 0xff, 0xcb, 0xe7, 0xfd, 0xff, 0xc9, 0xea, 0xfc, 0xff, 0xcc, 0xeb, 0xfb, 0xff, 0xcd, 0xe8, 0xfd, 0xff, 0xc9, 0xe6, 0xfd, 0xff, 0xbf, 0xe3, 0xfb, 0xff, 0xb8, 0xdc, 0xf6, 0xff, 0xb0, 0xd5, 0xf6, 0xff, 0xaa, 0xd2, 0xf6, 0xff, 0xab, 0xd2, 0xf4, 0xff, 0xab, 0xd3, 0xf5, 0xff, 0xae, 0xd2, 0xf5, 0xff, 0xb0, 0xd3, 0xf6, 0xff, 0xa8, 0xd1, 0xf4, 0xff, 0xa6, 0xd0, 0xf0, 0xff, 0xa3, 0xd3, 0xf4, 0xff, 0x9c, 0xd0, 0xf4, 0xff, 0xa1, 0xd3, 0xfc, 0xff, 0xa2, 0xce, 0xfa, 0xff, 0x95, 0xd0, 0xfc, 0xff, 0xad, 0xd8, 0xf9, 0xff, 0xac, 0xdb, 0xfe, 0xff, 0x97, 0xde, 0xff, 0xff, 0x93, 0xe0, 0xff, 0xff, 0x1b, 0x29, 0x3c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x9e, 0x60, 0xb5, 0xff, 0xf9, 0xa0, 0xff, 0xff, 0xce, 0x84, 0xff, 0xff, 0xc3, 0x7c, 0xfc, 0xff, 0xc1, 0x78, 0xfe, 0xff, 0xc4, 0x79, 0xfd, 0xff, 0xd0, 0x76, 0xfc, 0xff, 0xcf, 0x72, 0xfe, 0xff, 0xc8, 0x71, 0xfd, 0xff, 0xc8, 0x6c, 0xfd, 0xff, 0xc7, 0x65, 0xfe, 0xff, 0xc8, 0x5b, 0xff, 0xff, 0xb9, 0x53, 0xfe, 0xff, 0xa5, 0x4c, 0xfb, 0xff, 0x8b, 0x3c, 0xf6, 0xff, 0x69, 0x31, 0xf0, 0xff, 0x5b, 0x2e, 0xef, 0xff, 0x5a, 0x31, 0xf4, 0xff, 0x5e, 0x34, 0xf3, 0xff, 0x64, 0x3a, 0xf5, 0xff, 0x69, 0x3a, 0xee, 0xff, 0x6a, 0x36, 0xe8, 0xff, 0x77, 0x40, 0xed, 0xff, 0x8e, 0x49, 0xe9, 0xff, 0x99, 0x50, 0xe4, 0xff, 0xab, 0x5c, 0xd7, 0xff, 0xbf, 0x6c, 0xbb, 0xff, 0xca, 0x7d, 0x96, 0xff, 0xd5, 0x91, 0x71, 0xff, 0xe5, 0xa4, 0x58, 0xff, 0xf0, 0xad, 0x4c, 0xff, 0xf3, 0xb7, 0x37, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x74, 0x4b, 0xb3, 0xb0, 0x79, 0x4e, 0xff, 0xb0, 0x7a, 0x50, 0xff, 0xb1, 0x78, 0x56, 0xff, 0xb2, 0x7c, 0x58, 0xff, 0xb0, 0x80, 0x56, 0xff, 0xb0, 0x87, 0x57, 0xff, 0xaa, 0x87, 0x56, 0xff, 0xab, 0x88, 0x5d, 0xff, 0xb0, 0x8c, 0x67, 0xff, 0xb1, 0x8e, 0x6e, 0xff, 0xac, 0x8a, 0x6f, 0xff, 0xaa, 0x88, 0x6a, 0xff, 0xae, 0x87, 0x6b, 0xff, 0xab, 0x7e, 0x6e, 0xff, 0xa3, 0x73, 0x6b, 0xff, 0x90, 0x67, 0x6a, 0xff, 0x78, 0x58, 0x64, 0xff, 0x64, 0x4a, 0x5f, 0xff, 0x51, 0x3c, 0x65, 0xff, 0x51, 0x3d, 0x63, 0xff, 0x54, 0x43, 0x50, 0xff, 0x56, 0x4b, 0x45, 0xff, 0x5b, 0x4d, 0x44, 0xff, 0x5b, 0x48, 0x45, 0xff, 0x56, 0x48, 0x44, 0xff, 0x4b, 0x45, 0x36, 0xff, 0x50, 0x4c, 0x32, 0xff, 0x48, 0x41, 0x2a, 0xff, 0x4a, 0x41, 0x34, 0xff, 0x52, 0x4a, 0x3d, 0xff, 0x37, 0x32, 0x21, 0xff, 0x46, 0x42, 0x2f, 0xff, 0x42, 0x3e, 0x2c, 0xff, 0x41, 0x3d, 0x2d, 0xff, 0x45, 0x43, 0x36, 0xff, 0x40, 0x3b, 0x31, 0xff, 0x4a, 0x40, 0x38, 0xff, 0x44, 0x3a, 0x31, 0xff, 0x44, 0x3a, 0x32, 0xff, 0x47, 0x3e, 0x34, 0xff, 0x45, 0x41, 0x35, 0xff, 0x44, 0x3e, 0x34, 0xff, 0x43, 0x3c, 0x31, 0xff, 0x3c, 0x33, 0x28, 0xff, 0x45, 0x3f, 0x34, 0xff, 0x45, 0x43, 0x36, 0xff, 0x3a, 0x3d, 0x2e, 0xff, 0x3b, 0x3b, 0x22, 0xff, 0x19, 0x0d, 0x12, 0xff, 0x2d, 0x42, 0x73, 0xff, 0xba, 0xf5, 0xff, 0xff, 0xc0, 0xef, 0xff, 0xff, 0xc9, 0xec, 0xff, 0xff, 0xd0, 0xed, 0xfd, 0xff, 0xda, 0xf2, 0xfe, 0xff, 0xde, 0xf5, 0xfd, 0xff, 0xdd, 0xf5, 0xfe, 0xff, 0xd4, 0xf3, 0xfc, 0xff, 0xcc, 0xee, 0xfc, 0xff, 0xcc, 0xec, 0xfe, 0xff, 0xcc, 0xec, 0xfa, 0xff, 0xc6, 0xe7, 0xf7, 0xff, 0xc0, 0xe0, 0xf6, 0xff, 0xbf, 0xdd, 0xf8, 0xff, 0xb5, 0xd6, 0xf6, 0xff, 0xab, 0xd2, 0xf2, 0xff, 0xa5, 0xcf, 0xef, 0xff, 0xa4, 0xcc, 0xee, 0xff, 0xa3, 0xcf, 0xef, 0xff, 0xa5, 0xce, 0xef, 0xff, 0xaa, 0xd0, 0xf2, 0xff, 0xac, 0xd5, 0xf7, 0xff, 0xa7, 0xd1, 0xf2, 0xff, 0xa4, 0xd2, 0xf5, 0xff, 0xa3, 0xd6, 0xfd, 0xff, 0x9f, 0xd3, 0xf6, 0xff, 0xa3, 0xcf, 0xfc, 0xff, 0x9c, 0xc9, 0xf9, 0xff, 0x9c, 0xca, 0xe5, 0xff, 0xa1, 0xce, 0xe1, 0xff, 0x96, 0xd0, 0xf6, 0xff, 0xbd, 0xfd, 0xff, 0xff, 0x73, 0x90, 0xa9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x66, 0x3a, 0x6e, 0xff, 0xf2, 0x98, 0xff, 0xff, 0xd3, 0x7e, 0xff, 0xff, 0xc3, 0x7e, 0xf9, 0xff, 0xbc, 0x7b, 0xfe, 0xff, 0xc8, 0x78, 0xfe, 0xff, 0xd1, 0x76, 0xfd, 0xff, 0xd2, 0x71, 0xff, 0xff, 0xcf, 0x70, 0xff, 0xff, 0xce, 0x6b, 0xff, 0xff, 0xcc, 0x64, 0xff, 0xff, 0xcd, 0x5d, 0xff, 0xff, 0xc0, 0x56, 0xff, 0xff, 0xaf, 0x4f, 0xfd, 0xff, 0x98, 0x42, 0xfa, 0xff, 0x79, 0x37, 0xf5, 0xff, 0x66, 0x33, 0xf0, 0xff, 0x60, 0x35, 0xf3, 0xff, 0x5f, 0x35, 0xf1, 0xff, 0x65, 0x37, 0xf3, 0xff, 0x6a, 0x37, 0xec, 0xff, 0x71, 0x3a, 0xeb, 0xff, 0x7f, 0x46, 0xf2, 0xff, 0x92, 0x4c, 0xeb, 0xff, 0x9f, 0x54, 0xe7, 0xff, 0xb1, 0x5f, 0xd8, 0xff, 0xc4, 0x6e, 0xb8, 0xff, 0xce, 0x7f, 0x92, 0xff, 0xd9, 0x94, 0x6f, 0xff, 0xe7, 0xa7, 0x56, 0xff, 0xf0, 0xb0, 0x48, 0xff, 0xf2, 0xba, 0x34, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x78, 0x52, 0x22, 0xaf, 0x79, 0x4f, 0xfe, 0xb1, 0x7b, 0x4e, 0xff, 0xb4, 0x7e, 0x53, 0xff, 0xb5, 0x7c, 0x58, 0xff, 0xb4, 0x7d, 0x59, 0xff, 0xb6, 0x85, 0x5b, 0xff, 0xb4, 0x89, 0x5a, 0xff, 0xac, 0x87, 0x57, 0xff, 0xaf, 0x8b, 0x5d, 0xff, 0xb2, 0x8c, 0x62, 0xff, 0xb4, 0x8f, 0x6a, 0xff, 0xb3, 0x90, 0x6e, 0xff, 0xac, 0x8c, 0x6e, 0xff, 0xab, 0x83, 0x70, 0xff, 0xac, 0x7b, 0x74, 0xff, 0xa4, 0x73, 0x6e, 0xff, 0x9a, 0x6b, 0x6d, 0xff, 0x89, 0x61, 0x65, 0xff, 0x6e, 0x51, 0x5a, 0xff, 0x59, 0x41, 0x63, 0xff, 0x51, 0x3a, 0x5f, 0xff, 0x56, 0x45, 0x48, 0xff, 0x5c, 0x52, 0x38, 0xff, 0x5b, 0x4c, 0x38, 0xff, 0x5a, 0x44, 0x3e, 0xff, 0x58, 0x44, 0x3f, 0xff, 0x4e, 0x43, 0x38, 0xff, 0x53, 0x46, 0x37, 0xff, 0x41, 0x33, 0x24, 0xff, 0x43, 0x39, 0x2f, 0xff, 0x57, 0x4c, 0x45, 0xff, 0x37, 0x2f, 0x22, 0xff, 0x3e, 0x38, 0x26, 0xff, 0x53, 0x4b, 0x3a, 0xff, 0x4e, 0x48, 0x37, 0xff, 0x41, 0x3c, 0x2b, 0xff, 0x41, 0x3d, 0x2d, 0xff, 0x3e, 0x3a, 0x2e, 0xff, 0x43, 0x3e, 0x34, 0xff, 0x43, 0x3e, 0x35, 0xff, 0x44, 0x3f, 0x36, 0xff, 0x3d, 0x37, 0x2e, 0xff, 0x43, 0x3c, 0x32, 0xff, 0x3e, 0x37, 0x2a, 0xff, 0x43, 0x3a, 0x2f, 0xff, 0x49, 0x3e, 0x39, 0xff, 0x47, 0x3e, 0x32, 0xff, 0x3e, 0x41, 0x2c, 0xff, 0x3b, 0x3e, 0x22, 0xff, 0x0c, 0x07, 0x0a, 0xff, 0x5e, 0x85, 0xa7, 0xff, 0xc6, 0xff, 0xff, 0xff, 0xbe, 0xf9, 0xfa, 0xff, 0xcf, 0xf9, 0xfe, 0xff, 0xdb, 0xf8, 0xff, 0xff, 0xe9, 0xfa, 0xff, 0xff, 0xe9, 0xf6, 0xff, 0xff, 0xda, 0xf3, 0xff, 0xff, 0xca, 0xf7, 0xff, 0xff, 0xbe, 0xf0, 0xff, 0xff, 0xc2, 0xe8, 0xff, 0xff, 0xbe, 0xe5, 0xff, 0xff, 0xb5, 0xe3, 0xfd, 0xff, 0xad, 0xda, 0xf2, 0xff, 0xae, 0xd4, 0xf0, 0xff, 0xac, 0xd1, 0xf2, 0xff, 0xa4, 0xd1, 0xef, 0xff, 0x9d, 0xcf, 0xea, 0xff, 0x9b, 0xca, 0xe9, 0xff, 0x9f, 0xcb, 0xed, 0xff, 0xa3, 0xca, 0xf2, 0xff, 0x9d, 0xc5, 0xf5, 0xff, 0x91, 0xbf, 0xf5, 0xff, 0x81, 0xb3, 0xec, 0xff, 0x76, 0xa7, 0xe3, 0xff, 0x67, 0x8f, 0xc9, 0xff, 0x5c, 0x7e, 0xab, 0xff, 0x49, 0x6c, 0x9d, 0xff, 0x41, 0x5d, 0x96, 0xff, 0x33, 0x4f, 0x72, 0xff, 0x2a, 0x37, 0x4d, 0xff, 0x30, 0x32, 0x49, 0xff, 0x43, 0x59, 0x78, 0xff, 0x8c, 0xb4, 0xd2, 0xff, 0x1a, 0x26, 0x2c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2f, 0x11, 0x32, 0xff, 0xd1, 0x8c, 0xf5, 0xff, 0xdc, 0x8c, 0xff, 0xff, 0xc8, 0x79, 0xfa, 0xff, 0xc1, 0x6e, 0xff, 0xff, 0xd0, 0x74, 0xfe, 0xff, 0xd4, 0x77, 0xfc, 0xff, 0xd3, 0x72, 0xfe, 0xff, 0xd7, 0x71, 0xff, 0xff, 0xd5, 0x6d, 0xfd, 0xff, 0xd4, 0x67, 0xfc, 0xff, 0xcf, 0x5f, 0xfe, 0xff, 0xbf, 0x58, 0xfd, 0xff, 0xb8, 0x50, 0xfb, 0xff, 0xac, 0x44, 0xfc, 0xff, 0x94, 0x3b, 0xf7, 0xff, 0x81, 0x35, 0xf0, 0xff, 0x6e, 0x36, 0xf4, 0xff, 0x60, 0x36, 0xf1, 0xff, 0x62, 0x37, 0xf2, 0xff, 0x70, 0x39, 0xee, 0xff, 0x7a, 0x40, 0xf0, 0xff, 0x87, 0x49, 0xf5, 0xff, 0x97, 0x4d, 0xed, 0xff, 0xa0, 0x54, 0xe8, 0xff, 0xb3, 0x63, 0xd9, 0xff, 0xc6, 0x71, 0xb9, 0xff, 0xd0, 0x82, 0x91, 0xff, 0xde, 0x98, 0x6d, 0xff, 0xe9, 0xaa, 0x53, 0xff, 0xef, 0xb4, 0x44, 0xff, 0xef, 0xbc, 0x31, 0xfe, 0xf7, 0xc3, 0x1e, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x79, 0x51, 0x86, 0xb5, 0x79, 0x50, 0xff, 0xb3, 0x7c, 0x51, 0xff, 0xb4, 0x80, 0x55, 0xff, 0xb5, 0x80, 0x59, 0xff, 0xb4, 0x80, 0x5a, 0xff, 0xb8, 0x8a, 0x5e, 0xff, 0xb4, 0x8a, 0x5c, 0xff, 0xaf, 0x86, 0x5a, 0xff, 0xb1, 0x8c, 0x60, 0xff, 0xb0, 0x8e, 0x61, 0xff, 0xb2, 0x8e, 0x65, 0xff, 0xb3, 0x8f, 0x6d, 0xff, 0xae, 0x8b, 0x74, 0xff, 0xa5, 0x7d, 0x71, 0xff, 0xa6, 0x78, 0x72, 0xff, 0xa7, 0x75, 0x73, 0xff, 0x9c, 0x6c, 0x69, 0xff, 0x8d, 0x64, 0x61, 0xff, 0x78, 0x57, 0x5f, 0xff, 0x64, 0x49, 0x66, 0xff, 0x59, 0x3f, 0x5e, 0xff, 0x58, 0x44, 0x43, 0xff, 0x59, 0x4e, 0x30, 0xff, 0x55, 0x49, 0x2a, 0xff, 0x56, 0x44, 0x33, 0xff, 0x56, 0x44, 0x37, 0xff, 0x52, 0x3f, 0x35, 0xff, 0x59, 0x44, 0x3e, 0xff, 0x4a, 0x39, 0x32, 0xff, 0x3b, 0x2e, 0x26, 0xff, 0x54, 0x47, 0x40, 0xff, 0x42, 0x37, 0x2f, 0xff, 0x44, 0x3a, 0x2d, 0xff, 0x53, 0x4a, 0x37, 0xff, 0x4a, 0x41, 0x2e, 0xff, 0x46, 0x40, 0x2d, 0xff, 0x44, 0x42, 0x31, 0xff, 0x3e, 0x3d, 0x2f, 0xff, 0x3e, 0x3c, 0x31, 0xff, 0x36, 0x33, 0x29, 0xff, 0x3e, 0x3c, 0x32, 0xff, 0x46, 0x43, 0x3a, 0xff, 0x47, 0x44, 0x36, 0xff, 0x39, 0x36, 0x24, 0xff, 0x41, 0x3b, 0x2e, 0xff, 0x42, 0x3a, 0x35, 0xff, 0x41, 0x39, 0x2c, 0xff, 0x43, 0x42, 0x27, 0xff, 0x34, 0x35, 0x1e, 0xff, 0x22, 0x1c, 0x25, 0xff, 0xa1, 0xcd, 0xd5, 0xff, 0xe1, 0xff, 0xff, 0xff, 0xcb, 0xf1, 0xf9, 0xff, 0xc7, 0xe4, 0xfd, 0xff, 0xbd, 0xda, 0xf1, 0xff, 0xab, 0xc8, 0xe4, 0xff, 0xa4, 0xc2, 0xe7, 0xff, 0x9d, 0xc2, 0xea, 0xff, 0x8c, 0xb3, 0xde, 0xff, 0x82, 0xa7, 0xdb, 0xff, 0x82, 0xa7, 0xdf, 0xff, 0x7c, 0xaa, 0xe0, 0xff, 0x76, 0xae, 0xe4, 0xff, 0x7a, 0xb3, 0xe6, 0xff, 0x8b, 0xba, 0xe7, 0xff, 0x95, 0xbf, 0xea, 0xff, 0x90, 0xc2, 0xe8, 0xff, 0x90, 0xc8, 0xe9, 0xff, 0x91, 0xc8, 0xe9, 0xff, 0x96, 0xc3, 0xe8, 0xff, 0x90, 0xbc, 0xe8, 0xff, 0x7b, 0xad, 0xe2, 0xff, 0x62, 0x9c, 0xda, 0xff, 0x49, 0x86, 0xcd, 0xff, 0x40, 0x70, 0xbe, 0xff, 0x1a, 0x3c, 0x83, 0xff, 0x10, 0x20, 0x56, 0xff, 0x03, 0x10, 0x3c, 0xff, 0x12, 0x1f, 0x4a, 0xff, 0x13, 0x16, 0x36, 0xff, 0x12, 0x09, 0x1f, 0xff, 0x1e, 0x0d, 0x21, 0xff, 0x00, 0x00, 0x0b, 0xff, 0x33, 0x4f, 0x66, 0xff, 0x37, 0x4c, 0x55, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x11, 0xff, 0xb7, 0x78, 0xce, 0xff, 0xe2, 0x91, 0xff, 0xff, 0xc7, 0x74, 0xfb, 0xff, 0xc7, 0x66, 0xff, 0xff, 0xd0, 0x6c, 0xfc, 0xff, 0xd3, 0x74, 0xfb, 0xff, 0xd3, 0x72, 0xfd, 0xff, 0xd9, 0x71, 0xfe, 0xff, 0xd8, 0x6e, 0xfb, 0xff, 0xda, 0x6c, 0xfe, 0xff, 0xd7, 0x64, 0xff, 0xff, 0xca, 0x5a, 0xfe, 0xff, 0xc4, 0x51, 0xfd, 0xff, 0xbb, 0x47, 0xff, 0xff, 0xab, 0x3e, 0xfb, 0xff, 0x98, 0x3a, 0xf5, 0xff, 0x81, 0x39, 0xf6, 0xff, 0x70, 0x37, 0xf2, 0xff, 0x6b, 0x37, 0xee, 0xff, 0x74, 0x3c, 0xee, 0xff, 0x81, 0x45, 0xf3, 0xff, 0x8a, 0x4b, 0xf3, 0xff, 0x96, 0x51, 0xef, 0xff, 0x9f, 0x57, 0xe5, 0xff, 0xb2, 0x66, 0xd3, 0xff, 0xc6, 0x78, 0xb5, 0xff, 0xd2, 0x87, 0x8f, 0xff, 0xe0, 0x9d, 0x6b, 0xff, 0xea, 0xae, 0x50, 0xff, 0xf0, 0xb7, 0x44, 0xff, 0xf2, 0xc0, 0x33, 0xff, 0xf3, 0xc6, 0x25, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x7f, 0x3f, 0x04, 0xb8, 0x7b, 0x51, 0xe7, 0xb9, 0x7a, 0x52, 0xff, 0xb8, 0x7c, 0x55, 0xff, 0xb7, 0x80, 0x58, 0xff, 0xb6, 0x83, 0x59, 0xff, 0xb6, 0x86, 0x5d, 0xff, 0xbb, 0x8f, 0x62, 0xff, 0xb8, 0x90, 0x60, 0xff, 0xb3, 0x8c, 0x61, 0xff, 0xb2, 0x8e, 0x65, 0xff, 0xb2, 0x91, 0x65, 0xff, 0xb1, 0x8f, 0x68, 0xff, 0xb2, 0x8e, 0x70, 0xff, 0xb2, 0x8a, 0x76, 0xff, 0xa8, 0x82, 0x71, 0xff, 0xa3, 0x7e, 0x6f, 0xff, 0xac, 0x7d, 0x72, 0xff, 0xa3, 0x72, 0x6c, 0xff, 0x90, 0x65, 0x69, 0xff, 0x7c, 0x58, 0x6a, 0xff, 0x68, 0x4c, 0x6a, 0xff, 0x5e, 0x47, 0x5a, 0xff, 0x55, 0x42, 0x3f, 0xff, 0x4c, 0x41, 0x29, 0xff, 0x51, 0x46, 0x29, 0xff, 0x4f, 0x42, 0x2c, 0xff, 0x54, 0x46, 0x34, 0xff, 0x55, 0x42, 0x33, 0xff, 0x50, 0x40, 0x33, 0xff, 0x4d, 0x42, 0x38, 0xff, 0x35, 0x2b, 0x23, 0xff, 0x52, 0x48, 0x3e, 0xff, 0x44, 0x3a, 0x31, 0xff, 0x3b, 0x2f, 0x25, 0xff, 0x49, 0x3c, 0x2a, 0xff, 0x4a, 0x3e, 0x2a, 0xff, 0x41, 0x3b, 0x28, 0xff, 0x46, 0x43, 0x34, 0xff, 0x3b, 0x37, 0x2a, 0xff, 0x44, 0x3f, 0x34, 0xff, 0x43, 0x3d, 0x32, 0xff, 0x3f, 0x39, 0x30, 0xff, 0x46, 0x41, 0x36, 0xff, 0x42, 0x41, 0x2f, 0xff, 0x3d, 0x3e, 0x2b, 0xff, 0x33, 0x35, 0x27, 0xff, 0x38, 0x3b, 0x37, 0xff, 0x45, 0x40, 0x32, 0xff, 0x49, 0x44, 0x25, 0xff, 0x22, 0x1c, 0x0a, 0xff, 0x60, 0x52, 0x5a, 0xff, 0xd7, 0xf6, 0xff, 0xff, 0x89, 0xa5, 0xb8, 0xff, 0x76, 0x78, 0x9a, 0xff, 0x60, 0x6a, 0x87, 0xff, 0x4d, 0x68, 0x76, 0xff, 0x39, 0x63, 0x70, 0xff, 0x2e, 0x5d, 0x71, 0xff, 0x23, 0x4a, 0x67, 0xff, 0x17, 0x2e, 0x5b, 0xff, 0x11, 0x24, 0x5d, 0xff, 0x1f, 0x3f, 0x78, 0xff, 0x3a, 0x63, 0xa7, 0xff, 0x34, 0x68, 0xb8, 0xff, 0x3a, 0x73, 0xc3, 0xff, 0x5e, 0x90, 0xd5, 0xff, 0x68, 0x99, 0xd5, 0xff, 0x77, 0xae, 0xe6, 0xff, 0x7e, 0xb8, 0xec, 0xff, 0x83, 0xb9, 0xea, 0xff, 0x81, 0xb6, 0xe1, 0xff, 0x7b, 0xb5, 0xde, 0xff, 0x6f, 0xaf, 0xe0, 0xff, 0x4e, 0x92, 0xcd, 0xff, 0x38, 0x78, 0xbb, 0xff, 0x3b, 0x69, 0xb0, 0xff, 0x0b, 0x28, 0x65, 0xff, 0x00, 0x00, 0x2a, 0xff, 0x03, 0x05, 0x21, 0xff, 0x0a, 0x12, 0x1e, 0xff, 0x2c, 0x30, 0x3a, 0xff, 0x44, 0x48, 0x60, 0xff, 0x3d, 0x45, 0x69, 0xff, 0x56, 0x68, 0x8c, 0xff, 0x31, 0x51, 0x75, 0xff, 0x0e, 0x1f, 0x32, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x96, 0x52, 0xa4, 0xff, 0xe8, 0x8a, 0xff, 0xff, 0xc7, 0x6e, 0xf7, 0xff, 0xd2, 0x6f, 0xff, 0xff, 0xd2, 0x70, 0xfd, 0xff, 0xd4, 0x72, 0xfe, 0xff, 0xd8, 0x72, 0xfe, 0xff, 0xd9, 0x71, 0xfe, 0xff, 0xd8, 0x6e, 0xfb, 0xff, 0xda, 0x6b, 0xfd, 0xff, 0xd9, 0x66, 0xff, 0xff, 0xd1, 0x5e, 0xff, 0xff, 0xc6, 0x56, 0xff, 0xff, 0xba, 0x4b, 0xff, 0xff, 0xaf, 0x43, 0xfd, 0xff, 0xa0, 0x44, 0xfb, 0xff, 0x8e, 0x41, 0xf8, 0xff, 0x7f, 0x3d, 0xf2, 0xff, 0x7b, 0x3f, 0xed, 0xff, 0x7c, 0x45, 0xf0, 0xff, 0x83, 0x4a, 0xf2, 0xff, 0x8b, 0x50, 0xee, 0xff, 0x97, 0x57, 0xef, 0xff, 0xa2, 0x5e, 0xe3, 0xff, 0xaf, 0x67, 0xca, 0xff, 0xc5, 0x7b, 0xae, 0xff, 0xd4, 0x8f, 0x8c, 0xff, 0xe2, 0xa2, 0x67, 0xff, 0xeb, 0xb1, 0x4c, 0xff, 0xf3, 0xba, 0x42, 0xff, 0xf5, 0xc3, 0x32, 0xff, 0xf6, 0xc8, 0x25, 0xe7, 0xff, 0xbf, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x7a, 0x4c, 0x49, 0xb9, 0x79, 0x4f, 0xff, 0xb8, 0x79, 0x50, 0xff, 0xba, 0x7a, 0x52, 0xff, 0xbb, 0x7e, 0x55, 0xff, 0xb9, 0x83, 0x59, 0xff, 0xbb, 0x88, 0x5e, 0xff, 0xc0, 0x93, 0x64, 0xff, 0xbc, 0x95, 0x63, 0xff, 0xb7, 0x93, 0x64, 0xff, 0xb6, 0x95, 0x68, 0xff, 0xb7, 0x95, 0x6c, 0xff, 0xb5, 0x93, 0x71, 0xff, 0xb4, 0x91, 0x73, 0xff, 0xb2, 0x8f, 0x74, 0xff, 0xab, 0x89, 0x70, 0xff, 0xab, 0x87, 0x72, 0xff, 0xb2, 0x87, 0x75, 0xff, 0xa9, 0x78, 0x71, 0xff, 0x93, 0x64, 0x70, 0xff, 0x7f, 0x57, 0x6f, 0xff, 0x6d, 0x52, 0x69, 0xff, 0x5c, 0x49, 0x52, 0xff, 0x4c, 0x3b, 0x35, 0xff, 0x48, 0x3a, 0x27, 0xff, 0x4f, 0x41, 0x2a, 0xff, 0x4c, 0x3f, 0x29, 0xff, 0x57, 0x4a, 0x35, 0xff, 0x53, 0x44, 0x32, 0xff, 0x52, 0x49, 0x36, 0xff, 0x4b, 0x45, 0x36, 0xff, 0x37, 0x2f, 0x26, 0xff, 0x52, 0x4a, 0x40, 0xff, 0x39, 0x32, 0x29, 0xff, 0x39, 0x2f, 0x25, 0xff, 0x47, 0x38, 0x29, 0xff, 0x49, 0x3a, 0x28, 0xff, 0x4a, 0x3e, 0x2e, 0xff, 0x43, 0x3c, 0x2f, 0xff, 0x3e, 0x38, 0x2b, 0xff, 0x42, 0x3c, 0x31, 0xff, 0x43, 0x3e, 0x33, 0xff, 0x41, 0x39, 0x2f, 0xff, 0x4c, 0x40, 0x34, 0xff, 0x42, 0x3c, 0x2b, 0xff, 0x43, 0x42, 0x30, 0xff, 0x3e, 0x40, 0x35, 0xff, 0x35, 0x3b, 0x39, 0xff, 0x44, 0x3d, 0x2e, 0xff, 0x4e, 0x40, 0x23, 0xff, 0x36, 0x2a, 0x1d, 0xff, 0x46, 0x3d, 0x4b, 0xff, 0x38, 0x48, 0x61, 0xff, 0x11, 0x1c, 0x32, 0xff, 0x2d, 0x2a, 0x44, 0xff, 0x31, 0x36, 0x45, 0xff, 0x2d, 0x3c, 0x41, 0xff, 0x17, 0x2f, 0x2f, 0xff, 0x02, 0x19, 0x1a, 0xff, 0x00, 0x08, 0x17, 0xff, 0x05, 0x0e, 0x2b, 0xff, 0x01, 0x09, 0x30, 0xff, 0x01, 0x18, 0x41, 0xff, 0x0f, 0x35, 0x6e, 0xff, 0x1f, 0x4f, 0x9c, 0xff, 0x1f, 0x5b, 0xac, 0xff, 0x2c, 0x6e, 0xb3, 0xff, 0x4b, 0x8a, 0xc1, 0xff, 0x64, 0xa5, 0xd9, 0xff, 0x75, 0xb4, 0xe6, 0xff, 0x7e, 0xb7, 0xe8, 0xff, 0x79, 0xb5, 0xe3, 0xff, 0x70, 0xb6, 0xe1, 0xff, 0x5d, 0xa6, 0xd7, 0xff, 0x3c, 0x82, 0xbd, 0xff, 0x30, 0x6c, 0xab, 0xff, 0x2c, 0x53, 0x8f, 0xff, 0x1c, 0x35, 0x63, 0xff, 0x14, 0x1d, 0x3e, 0xff, 0x24, 0x1c, 0x35, 0xff, 0x2d, 0x2b, 0x34, 0xff, 0x2e, 0x38, 0x3f, 0xff, 0x34, 0x40, 0x64, 0xff, 0x3e, 0x51, 0x86, 0xff, 0x51, 0x6b, 0x9d, 0xff, 0x59, 0x78, 0xa7, 0xff, 0x25, 0x38, 0x51, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x76, 0x3e, 0x78, 0xff, 0xf1, 0x8c, 0xff, 0xff, 0xd3, 0x6b, 0xf2, 0xff, 0xda, 0x72, 0xf7, 0xff, 0xd5, 0x71, 0xfb, 0xff, 0xd3, 0x6d, 0xfc, 0xff, 0xda, 0x70, 0xff, 0xff, 0xdd, 0x71, 0xff, 0xff, 0xda, 0x6f, 0xfc, 0xff, 0xda, 0x6b, 0xfb, 0xff, 0xd7, 0x67, 0xfe, 0xff, 0xd2, 0x63, 0xff, 0xff, 0xcb, 0x5c, 0xff, 0xff, 0xc0, 0x51, 0xff, 0xff, 0xb4, 0x48, 0xfb, 0xff, 0xad, 0x48, 0xfb, 0xff, 0xa2, 0x47, 0xfa, 0xff, 0x93, 0x43, 0xf2, 0xff, 0x8c, 0x47, 0xed, 0xff, 0x88, 0x4d, 0xed, 0xff, 0x88, 0x52, 0xed, 0xff, 0x90, 0x59, 0xeb, 0xff, 0x9c, 0x5f, 0xea, 0xff, 0xa5, 0x66, 0xde, 0xff, 0xb4, 0x70, 0xc8, 0xff, 0xc5, 0x7d, 0xa9, 0xff, 0xd3, 0x8e, 0x86, 0xff, 0xe3, 0xa3, 0x64, 0xff, 0xeb, 0xb2, 0x4a, 0xff, 0xf2, 0xba, 0x3b, 0xff, 0xf3, 0xc3, 0x28, 0xff, 0xf5, 0xca, 0x1e, 0xff, 0xfb, 0xd5, 0x14, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x79, 0x49, 0x9f, 0xbb, 0x79, 0x4c, 0xff, 0xb7, 0x77, 0x4d, 0xff, 0xbc, 0x76, 0x4e, 0xff, 0xc0, 0x7a, 0x52, 0xff, 0xba, 0x82, 0x57, 0xff, 0xba, 0x89, 0x5b, 0xff, 0xc1, 0x93, 0x61, 0xff, 0xbc, 0x97, 0x61, 0xff, 0xb5, 0x96, 0x62, 0xff, 0xb6, 0x96, 0x69, 0xff, 0xb7, 0x96, 0x71, 0xff, 0xb9, 0x96, 0x78, 0xff, 0xb6, 0x95, 0x77, 0xff, 0xb4, 0x93, 0x78, 0xff, 0xae, 0x8d, 0x75, 0xff, 0xad, 0x8b, 0x76, 0xff, 0xb5, 0x8b, 0x79, 0xff, 0xab, 0x7b, 0x70, 0xff, 0x96, 0x64, 0x71, 0xff, 0x83, 0x5a, 0x74, 0xff, 0x70, 0x59, 0x61, 0xff, 0x59, 0x4a, 0x48, 0xff, 0x4c, 0x3b, 0x33, 0xff, 0x4d, 0x3e, 0x2c, 0xff, 0x54, 0x45, 0x31, 0xff, 0x4a, 0x3d, 0x29, 0xff, 0x52, 0x46, 0x31, 0xff, 0x4b, 0x3e, 0x2c, 0xff, 0x46, 0x42, 0x31, 0xff, 0x49, 0x48, 0x38, 0xff, 0x2e, 0x2a, 0x1c, 0xff, 0x49, 0x45, 0x37, 0xff, 0x43, 0x40, 0x31, 0xff, 0x33, 0x2d, 0x20, 0xff, 0x40, 0x36, 0x28, 0xff, 0x48, 0x3c, 0x2b, 0xff, 0x3d, 0x31, 0x23, 0xff, 0x48, 0x3f, 0x34, 0xff, 0x3e, 0x37, 0x2a, 0xff, 0x3e, 0x36, 0x2c, 0xff, 0x43, 0x3b, 0x32, 0xff, 0x39, 0x30, 0x25, 0xff, 0x47, 0x3d, 0x2d, 0xff, 0x49, 0x40, 0x2f, 0xff, 0x3e, 0x36, 0x28, 0xff, 0x3b, 0x37, 0x2e, 0xff, 0x3b, 0x3e, 0x36, 0xff, 0x47, 0x3e, 0x2b, 0xff, 0x56, 0x43, 0x2b, 0xff, 0x38, 0x2a, 0x27, 0xff, 0x12, 0x1a, 0x30, 0xff, 0x3b, 0x53, 0x70, 0xff, 0x63, 0x7a, 0x90, 0xff, 0x61, 0x79, 0x8e, 0xff, 0x62, 0x75, 0x8d, 0xff, 0x4a, 0x58, 0x71, 0xff, 0x1c, 0x26, 0x3f, 0xff, 0x0e, 0x14, 0x2d, 0xff, 0x0f, 0x14, 0x2e, 0xff, 0x11, 0x11, 0x2f, 0xff, 0x0f, 0x16, 0x2e, 0xff, 0x0f, 0x22, 0x32, 0xff, 0x15, 0x2c, 0x50, 0xff, 0x19, 0x3a, 0x7a, 0xff, 0x18, 0x4d, 0x94, 0xff, 0x28, 0x6f, 0xa5, 0xff, 0x3d, 0x89, 0xb3, 0xff, 0x52, 0x9c, 0xc6, 0xff, 0x68, 0xab, 0xd7, 0xff, 0x73, 0xac, 0xdb, 0xff, 0x70, 0xaa, 0xdc, 0xff, 0x64, 0xaa, 0xd9, 0xff, 0x51, 0x98, 0xcb, 0xff, 0x49, 0x88, 0xc5, 0xff, 0x42, 0x71, 0xaf, 0xff, 0x2e, 0x46, 0x7e, 0xff, 0x27, 0x37, 0x65, 0xff, 0x31, 0x37, 0x61, 0xff, 0x2c, 0x31, 0x59, 0xff, 0x21, 0x29, 0x4b, 0xff, 0x17, 0x1e, 0x3c, 0xff, 0x2b, 0x3c, 0x56, 0xff, 0x37, 0x4c, 0x70, 0xff, 0x28, 0x36, 0x65, 0xff, 0x37, 0x4b, 0x83, 0xff, 0x4c, 0x64, 0x8d, 0xff, 0x06, 0x11, 0x19, 0xff, 0x00, 0x00, 0x00, 0xff, 0x51, 0x1f, 0x4e, 0xff, 0xf1, 0x8d, 0xff, 0xff, 0xe8, 0x78, 0xf4, 0xff, 0xde, 0x71, 0xea, 0xff, 0xd3, 0x70, 0xf4, 0xff, 0xd7, 0x6a, 0xfe, 0xff, 0xd9, 0x6a, 0xff, 0xff, 0xdb, 0x6e, 0xfe, 0xff, 0xdc, 0x6f, 0xfb, 0xff, 0xd9, 0x6b, 0xf9, 0xff, 0xd5, 0x69, 0xfc, 0xff, 0xd3, 0x65, 0xfe, 0xff, 0xcf, 0x60, 0xff, 0xff, 0xc4, 0x56, 0xfd, 0xff, 0xb8, 0x4b, 0xf7, 0xff, 0xb9, 0x4b, 0xfa, 0xff, 0xb8, 0x4d, 0xfb, 0xff, 0xab, 0x4c, 0xf5, 0xff, 0xa2, 0x4f, 0xed, 0xff, 0x99, 0x53, 0xe9, 0xff, 0x8f, 0x58, 0xe9, 0xff, 0x97, 0x5e, 0xe8, 0xff, 0xa5, 0x65, 0xe7, 0xff, 0xad, 0x6e, 0xdb, 0xff, 0xbe, 0x78, 0xc8, 0xff, 0xca, 0x80, 0xa3, 0xff, 0xd3, 0x8d, 0x80, 0xff, 0xdf, 0x9f, 0x62, 0xff, 0xea, 0xae, 0x49, 0xff, 0xf2, 0xb8, 0x39, 0xff, 0xf3, 0xc5, 0x23, 0xff, 0xf4, 0xcb, 0x18, 0xff, 0xf8, 0xd2, 0x0b, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x6d, 0x48, 0x07, 0xb4, 0x77, 0x47, 0xef, 0xbd, 0x78, 0x4e, 0xff, 0xb9, 0x73, 0x4c, 0xff, 0xba, 0x73, 0x4b, 0xff, 0xbb, 0x78, 0x4e, 0xff, 0xb9, 0x7e, 0x55, 0xff, 0xb9, 0x84, 0x55, 0xff, 0xbf, 0x90, 0x5b, 0xff, 0xbb, 0x94, 0x5e, 0xff, 0xb3, 0x93, 0x60, 0xff, 0xb5, 0x96, 0x69, 0xff, 0xb9, 0x97, 0x74, 0xff, 0xb9, 0x96, 0x7a, 0xff, 0xb8, 0x97, 0x78, 0xff, 0xb6, 0x95, 0x78, 0xff, 0xaf, 0x8e, 0x78, 0xff, 0xae, 0x8c, 0x7c, 0xff, 0xb2, 0x8a, 0x7a, 0xff, 0xaa, 0x7d, 0x72, 0xff, 0x99, 0x69, 0x70, 0xff, 0x87, 0x58, 0x74, 0xff, 0x71, 0x58, 0x5a, 0xff, 0x54, 0x4a, 0x36, 0xff, 0x4e, 0x3e, 0x34, 0xff, 0x4a, 0x3a, 0x2e, 0xff, 0x53, 0x43, 0x31, 0xff, 0x52, 0x45, 0x2f, 0xff, 0x4c, 0x44, 0x2e, 0xff, 0x43, 0x3a, 0x27, 0xff, 0x3e, 0x3a, 0x2a, 0xff, 0x4c, 0x4a, 0x3c, 0xff, 0x2a, 0x25, 0x17, 0xff, 0x37, 0x34, 0x27, 0xff, 0x51, 0x4e, 0x43, 0xff, 0x2c, 0x29, 0x1e, 0xff, 0x3d, 0x37, 0x29, 0xff, 0x46, 0x3d, 0x2c, 0xff, 0x44, 0x3d, 0x2c, 0xff, 0x42, 0x3d, 0x2e, 0xff, 0x41, 0x38, 0x2d, 0xff, 0x42, 0x3a, 0x2f, 0xff, 0x3e, 0x36, 0x2b, 0xff, 0x3c, 0x34, 0x29, 0xff, 0x40, 0x38, 0x2a, 0xff, 0x44, 0x3f, 0x31, 0xff, 0x44, 0x38, 0x2e, 0xff, 0x4a, 0x39, 0x33, 0xff, 0x3c, 0x37, 0x2e, 0xff, 0x43, 0x3a, 0x27, 0xff, 0x4b, 0x34, 0x22, 0xff, 0x1e, 0x1a, 0x22, 0xff, 0x67, 0x8a, 0xa7, 0xff, 0x9c, 0xc1, 0xe9, 0xff, 0x8d, 0xb8, 0xd3, 0xff, 0x7e, 0xb3, 0xc9, 0xff, 0x5a, 0x8e, 0xb0, 0xff, 0x57, 0x84, 0xae, 0xff, 0x60, 0x83, 0xb4, 0xff, 0x4a, 0x68, 0x98, 0xff, 0x39, 0x4c, 0x71, 0xff, 0x23, 0x29, 0x46, 0xff, 0x1a, 0x1d, 0x2d, 0xff, 0x1e, 0x29, 0x2c, 0xff, 0x23, 0x2c, 0x46, 0xff, 0x2e, 0x3b, 0x79, 0xff, 0x25, 0x4a, 0x95, 0xff, 0x1b, 0x58, 0x96, 0xff, 0x35, 0x79, 0xb3, 0xff, 0x4f, 0x92, 0xcb, 0xff, 0x5a, 0x95, 0xce, 0xff, 0x6c, 0x9c, 0xd3, 0xff, 0x70, 0xa2, 0xd5, 0xff, 0x61, 0xa1, 0xd3, 0xff, 0x4e, 0x8e, 0xc6, 0xff, 0x3e, 0x70, 0xb0, 0xff, 0x21, 0x42, 0x80, 0xff, 0x24, 0x33, 0x6a, 0xff, 0x23, 0x31, 0x64, 0xff, 0x15, 0x1b, 0x48, 0xff, 0x01, 0x08, 0x35, 0xff, 0x15, 0x28, 0x5d, 0xff, 0x14, 0x1c, 0x4d, 0xff, 0x13, 0x17, 0x38, 0xff, 0x1b, 0x1e, 0x34, 0xff, 0x12, 0x17, 0x36, 0xff, 0x17, 0x28, 0x56, 0xff, 0x3b, 0x54, 0x80, 0xff, 0x15, 0x24, 0x32, 0xff, 0x00, 0x00, 0x00, 0xff, 0x32, 0x12, 0x25, 0xff, 0xe9, 0x90, 0xf1, 0xff, 0xf3, 0x81, 0xfd, 0xff, 0xe7, 0x6e, 0xe7, 0xff, 0xd6, 0x6c, 0xf4, 0xff, 0xd5, 0x6a, 0xfd, 0xff, 0xde, 0x68, 0xfc, 0xff, 0xdc, 0x6b, 0xfa, 0xff, 0xdd, 0x6d, 0xfb, 0xff, 0xdb, 0x6d, 0xfc, 0xff, 0xd6, 0x6a, 0xfb, 0xff, 0xd2, 0x65, 0xfa, 0xff, 0xd0, 0x61, 0xfd, 0xff, 0xc7, 0x57, 0xfb, 0xff, 0xbe, 0x4e, 0xf7, 0xff, 0xbd, 0x4d, 0xfa, 0xff, 0xbe, 0x51, 0xfc, 0xff, 0xb7, 0x53, 0xf7, 0xff, 0xb1, 0x56, 0xef, 0xff, 0xa9, 0x5b, 0xea, 0xff, 0xa2, 0x5e, 0xeb, 0xff, 0xa3, 0x63, 0xe5, 0xff, 0xad, 0x6b, 0xdf, 0xff, 0xb8, 0x75, 0xd6, 0xff, 0xc3, 0x7b, 0xbf, 0xff, 0xcd, 0x81, 0x9c, 0xff, 0xd7, 0x8f, 0x7a, 0xff, 0xe0, 0x9c, 0x5f, 0xff, 0xe9, 0xab, 0x4b, 0xff, 0xf2, 0xb9, 0x39, 0xff, 0xf1, 0xc4, 0x1f, 0xff, 0xf4, 0xca, 0x15, 0xff, 0xf7, 0xd1, 0x08, 0xef, 0xfe, 0xda, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x74, 0x41, 0x46, 0xb5, 0x75, 0x46, 0xff, 0xbe, 0x77, 0x4c, 0xff, 0xbe, 0x73, 0x4b, 0xff, 0xb9, 0x74, 0x48, 0xff, 0xb7, 0x77, 0x4b, 0xff, 0xba, 0x7a, 0x54, 0xff, 0xbc, 0x81, 0x56, 0xff, 0xbf, 0x8b, 0x58, 0xff, 0xbb, 0x90, 0x5b, 0xff, 0xb5, 0x91, 0x5d, 0xff, 0xb3, 0x94, 0x63, 0xff, 0xb6, 0x96, 0x70, 0xff, 0xb7, 0x95, 0x76, 0xff, 0xb6, 0x96, 0x73, 0xff, 0xb5, 0x95, 0x73, 0xff, 0xaf, 0x8d, 0x79, 0xff, 0xb0, 0x8d, 0x81, 0xff, 0xb2, 0x89, 0x82, 0xff, 0xa8, 0x7d, 0x7a, 0xff, 0x9c, 0x6e, 0x70, 0xff, 0x8f, 0x5f, 0x74, 0xff, 0x6c, 0x57, 0x4e, 0xff, 0x50, 0x4c, 0x27, 0xff, 0x4d, 0x3f, 0x2e, 0xff, 0x39, 0x26, 0x21, 0xff, 0x49, 0x34, 0x2f, 0xff, 0x4a, 0x3c, 0x2c, 0xff, 0x45, 0x3d, 0x29, 0xff, 0x44, 0x3c, 0x2d, 0xff, 0x41, 0x39, 0x2e, 0xff, 0x4f, 0x48, 0x40, 0xff, 0x29, 0x24, 0x1d, 0xff, 0x3a, 0x37, 0x2e, 0xff, 0x42, 0x40, 0x39, 0xff, 0x25, 0x24, 0x19, 0xff, 0x3e, 0x39, 0x29, 0xff, 0x40, 0x38, 0x26, 0xff, 0x45, 0x42, 0x2c, 0xff, 0x43, 0x41, 0x2c, 0xff, 0x42, 0x3d, 0x2d, 0xff, 0x3c, 0x37, 0x28, 0xff, 0x40, 0x3a, 0x2d, 0xff, 0x40, 0x39, 0x2e, 0xff, 0x42, 0x3d, 0x34, 0xff, 0x3d, 0x3a, 0x30, 0xff, 0x43, 0x38, 0x2f, 0xff, 0x49, 0x38, 0x30, 0xff, 0x33, 0x34, 0x29, 0xff, 0x43, 0x43, 0x2e, 0xff, 0x49, 0x35, 0x25, 0xff, 0x24, 0x2e, 0x3b, 0xff, 0x6f, 0xa9, 0xd2, 0xff, 0x71, 0xab, 0xe0, 0xff, 0x5a, 0x95, 0xc5, 0xff, 0x52, 0x86, 0xb8, 0xff, 0x35, 0x6c, 0xa4, 0xff, 0x3b, 0x6b, 0xa6, 0xff, 0x52, 0x7a, 0xb3, 0xff, 0x48, 0x6e, 0xa1, 0xff, 0x3b, 0x52, 0x78, 0xff, 0x17, 0x1c, 0x38, 0xff, 0x14, 0x12, 0x24, 0xff, 0x0f, 0x0e, 0x1e, 0xff, 0x12, 0x13, 0x28, 0xff, 0x1c, 0x22, 0x47, 0xff, 0x1b, 0x34, 0x6e, 0xff, 0x15, 0x42, 0x8b, 0xff, 0x2c, 0x63, 0xae, 0xff, 0x4b, 0x89, 0xcd, 0xff, 0x5c, 0x9a, 0xd6, 0xff, 0x65, 0x9a, 0xcf, 0xff, 0x60, 0x9a, 0xcd, 0xff, 0x59, 0x9c, 0xd2, 0xff, 0x51, 0x8b, 0xc8, 0xff, 0x2d, 0x52, 0x95, 0xff, 0x10, 0x25, 0x6d, 0xff, 0x1a, 0x2c, 0x67, 0xff, 0x04, 0x1b, 0x4f, 0xff, 0x20, 0x37, 0x5e, 0xff, 0x67, 0x7c, 0xa7, 0xff, 0x6c, 0x79, 0xaa, 0xff, 0x30, 0x38, 0x58, 0xff, 0x08, 0x0b, 0x1b, 0xff, 0x00, 0x00, 0x06, 0xff, 0x01, 0x04, 0x10, 0xff, 0x16, 0x1c, 0x31, 0xff, 0x25, 0x33, 0x4b, 0xff, 0x0f, 0x1e, 0x25, 0xff, 0x00, 0x00, 0x00, 0xff, 0x13, 0x02, 0x00, 0xff, 0xc6, 0x7b, 0xc1, 0xff, 0xff, 0x91, 0xff, 0xff, 0xe8, 0x68, 0xeb, 0xff, 0xd6, 0x64, 0xf5, 0xff, 0xd2, 0x68, 0xfb, 0xff, 0xdf, 0x67, 0xf9, 0xff, 0xdd, 0x69, 0xf9, 0xff, 0xdd, 0x6a, 0xfd, 0xff, 0xda, 0x6a, 0xfe, 0xff, 0xd7, 0x67, 0xfc, 0xff, 0xd5, 0x64, 0xfb, 0xff, 0xd0, 0x5f, 0xfd, 0xff, 0xc9, 0x56, 0xfd, 0xff, 0xc4, 0x50, 0xfb, 0xff, 0xbf, 0x4f, 0xfa, 0xff, 0xbd, 0x53, 0xfa, 0xff, 0xba, 0x57, 0xf5, 0xff, 0xb6, 0x5b, 0xf1, 0xff, 0xb1, 0x60, 0xeb, 0xff, 0xb2, 0x63, 0xe9, 0xff, 0xb2, 0x6a, 0xde, 0xff, 0xb6, 0x74, 0xcf, 0xff, 0xc2, 0x7a, 0xc9, 0xff, 0xc9, 0x7f, 0xb0, 0xff, 0xd0, 0x84, 0x90, 0xff, 0xd9, 0x91, 0x6f, 0xff, 0xe5, 0x9f, 0x58, 0xff, 0xeb, 0xac, 0x4b, 0xff, 0xf1, 0xb8, 0x36, 0xff, 0xf3, 0xc1, 0x1f, 0xff, 0xf4, 0xc7, 0x16, 0xff, 0xf9, 0xce, 0x0e, 0xff, 0xfb, 0xd3, 0x07, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x77, 0x42, 0x8d, 0xb8, 0x78, 0x4a, 0xff, 0xbe, 0x77, 0x4d, 0xff, 0xbe, 0x75, 0x4a, 0xff, 0xbb, 0x76, 0x48, 0xff, 0xb9, 0x76, 0x4b, 0xff, 0xbb, 0x76, 0x53, 0xff, 0xc1, 0x80, 0x5c, 0xff, 0xc0, 0x87, 0x59, 0xff, 0xbb, 0x8d, 0x58, 0xff, 0xb8, 0x90, 0x57, 0xff, 0xb2, 0x91, 0x5d, 0xff, 0xb5, 0x94, 0x6b, 0xff, 0xb7, 0x94, 0x72, 0xff, 0xb7, 0x97, 0x71, 0xff, 0xb6, 0x95, 0x73, 0xff, 0xaf, 0x8e, 0x7a, 0xff, 0xaf, 0x8b, 0x84, 0xff, 0xb3, 0x86, 0x8a, 0xff, 0xaf, 0x80, 0x81, 0xff, 0xa0, 0x6f, 0x74, 0xff, 0x96, 0x6d, 0x71, 0xff, 0x60, 0x53, 0x39, 0xff, 0x42, 0x40, 0x1b, 0xff, 0x4e, 0x43, 0x30, 0xff, 0x38, 0x26, 0x23, 0xff, 0x45, 0x2f, 0x32, 0xff, 0x45, 0x33, 0x2d, 0xff, 0x41, 0x35, 0x29, 0xff, 0x43, 0x37, 0x32, 0xff, 0x3e, 0x33, 0x30, 0xff, 0x4c, 0x44, 0x43, 0xff, 0x30, 0x2b, 0x2b, 0xff, 0x30, 0x2d, 0x28, 0xff, 0x48, 0x48, 0x3e, 0xff, 0x25, 0x24, 0x18, 0xff, 0x39, 0x36, 0x27, 0xff, 0x37, 0x36, 0x24, 0xff, 0x3f, 0x3f, 0x2b, 0xff, 0x40, 0x40, 0x29, 0xff, 0x39, 0x3a, 0x22, 0xff, 0x3a, 0x38, 0x27, 0xff, 0x42, 0x3e, 0x33, 0xff, 0x37, 0x33, 0x2b, 0xff, 0x45, 0x40, 0x39, 0xff, 0x44, 0x3e, 0x36, 0xff, 0x3e, 0x37, 0x2d, 0xff, 0x46, 0x40, 0x34, 0xff, 0x37, 0x44, 0x33, 0xff, 0x3c, 0x46, 0x2f, 0xff, 0x30, 0x24, 0x18, 0xff, 0x2a, 0x3c, 0x52, 0xff, 0x4f, 0x97, 0xcf, 0xff, 0x41, 0x8b, 0xca, 0xff, 0x3a, 0x75, 0xb1, 0xff, 0x26, 0x43, 0x86, 0xff, 0x37, 0x50, 0x8c, 0xff, 0x66, 0x79, 0xae, 0xff, 0x6e, 0x76, 0x9e, 0xff, 0x5c, 0x61, 0x7b, 0xff, 0x32, 0x37, 0x46, 0xff, 0x0a, 0x0b, 0x16, 0xff, 0x11, 0x12, 0x1b, 0xff, 0x0f, 0x10, 0x1b, 0xff, 0x0d, 0x0f, 0x12, 0xff, 0x06, 0x0c, 0x0a, 0xff, 0x11, 0x25, 0x3a, 0xff, 0x26, 0x49, 0x88, 0xff, 0x2f, 0x66, 0xb6, 0xff, 0x51, 0x95, 0xd6, 0xff, 0x61, 0xa9, 0xdc, 0xff, 0x5e, 0xa1, 0xd0, 0xff, 0x5f, 0xa2, 0xd6, 0xff, 0x65, 0xa8, 0xe0, 0xff, 0x54, 0x89, 0xc9, 0xff, 0x1e, 0x41, 0x89, 0xff, 0x09, 0x20, 0x70, 0xff, 0x00, 0x13, 0x54, 0xff, 0x25, 0x46, 0x79, 0xff, 0x8d, 0xb7, 0xdb, 0xff, 0x44, 0x59, 0x70, 0xff, 0x00, 0x00, 0x09, 0xff, 0x06, 0x00, 0x00, 0xff, 0x04, 0x05, 0x00, 0xff, 0x00, 0x09, 0x03, 0xff, 0x01, 0x04, 0x01, 0xff, 0x0f, 0x06, 0x08, 0xff, 0x08, 0x0e, 0x14, 0xff, 0x07, 0x19, 0x1f, 0xff, 0x08, 0x0e, 0x0a, 0xff, 0x00, 0x00, 0x00, 0xff, 0xa1, 0x61, 0x9d, 0xff, 0xff, 0x9a, 0xff, 0xff, 0xdf, 0x6a, 0xf0, 0xff, 0xd5, 0x5e, 0xf1, 0xff, 0xdb, 0x63, 0xf9, 0xff, 0xdd, 0x65, 0xfb, 0xff, 0xdd, 0x66, 0xfc, 0xff, 0xdc, 0x67, 0xfd, 0xff, 0xd8, 0x66, 0xfd, 0xff, 0xd7, 0x64, 0xfe, 0xff, 0xd6, 0x61, 0xff, 0xff, 0xd1, 0x5c, 0xff, 0xff, 0xcb, 0x55, 0xff, 0xff, 0xc6, 0x53, 0xfb, 0xff, 0xc4, 0x55, 0xfa, 0xff, 0xc1, 0x57, 0xfb, 0xff, 0xbd, 0x5b, 0xf6, 0xff, 0xba, 0x5e, 0xf2, 0xff, 0xb9, 0x63, 0xec, 0xff, 0xba, 0x67, 0xe6, 0xff, 0xbf, 0x70, 0xd6, 0xff, 0xc5, 0x79, 0xc4, 0xff, 0xcc, 0x7c, 0xba, 0xff, 0xd0, 0x83, 0xa0, 0xff, 0xd6, 0x88, 0x82, 0xff, 0xde, 0x95, 0x67, 0xff, 0xe7, 0xa5, 0x52, 0xff, 0xec, 0xaf, 0x42, 0xff, 0xef, 0xb2, 0x32, 0xff, 0xf5, 0xbc, 0x27, 0xff, 0xf7, 0xc3, 0x1f, 0xff, 0xfa, 0xc9, 0x18, 0xff, 0xfb, 0xcc, 0x10, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x75, 0x48, 0xd7, 0xb4, 0x77, 0x4c, 0xff, 0xb7, 0x75, 0x50, 0xff, 0xb9, 0x75, 0x51, 0xff, 0xb8, 0x76, 0x4c, 0xff, 0xb8, 0x79, 0x4b, 0xff, 0xbb, 0x7b, 0x51, 0xff, 0xbf, 0x80, 0x56, 0xff, 0xc0, 0x89, 0x58, 0xff, 0xbb, 0x8e, 0x58, 0xff, 0xb5, 0x8e, 0x58, 0xff, 0xb2, 0x90, 0x60, 0xff, 0xb7, 0x93, 0x6e, 0xff, 0xb9, 0x93, 0x76, 0xff, 0xb9, 0x96, 0x73, 0xff, 0xb6, 0x94, 0x75, 0xff, 0xb0, 0x8f, 0x7c, 0xff, 0xaf, 0x8c, 0x82, 0xff, 0xb4, 0x8b, 0x88, 0xff, 0xb4, 0x84, 0x82, 0xff, 0xa9, 0x72, 0x7c, 0xff, 0x90, 0x69, 0x66, 0xff, 0x51, 0x48, 0x29, 0xff, 0x43, 0x40, 0x25, 0xff, 0x47, 0x3b, 0x2e, 0xff, 0x3b, 0x2b, 0x26, 0xff, 0x4c, 0x3c, 0x31, 0xff, 0x49, 0x3b, 0x2a, 0xff, 0x45, 0x3a, 0x2a, 0xff, 0x45, 0x3b, 0x30, 0xff, 0x40, 0x37, 0x31, 0xff, 0x53, 0x4b, 0x46, 0xff, 0x3e, 0x36, 0x2f, 0xff, 0x27, 0x20, 0x19, 0xff, 0x55, 0x50, 0x48, 0xff, 0x30, 0x2b, 0x23, 0xff, 0x2e, 0x2b, 0x23, 0xff, 0x34, 0x36, 0x2b, 0xff, 0x34, 0x34, 0x26, 0xff, 0x37, 0x35, 0x25, 0xff, 0x3d, 0x3f, 0x2e, 0xff, 0x3b, 0x3b, 0x2e, 0xff, 0x35, 0x35, 0x2a, 0xff, 0x38, 0x35, 0x2d, 0xff, 0x41, 0x36, 0x33, 0xff, 0x49, 0x3c, 0x35, 0xff, 0x42, 0x39, 0x2f, 0xff, 0x48, 0x41, 0x34, 0xff, 0x3f, 0x3e, 0x32, 0xff, 0x3a, 0x3d, 0x2f, 0xff, 0x2a, 0x1d, 0x1e, 0xff, 0x1f, 0x38, 0x5c, 0xff, 0x3c, 0x83, 0xc6, 0xff, 0x36, 0x61, 0x9b, 0xff, 0x0b, 0x26, 0x45, 0xff, 0x2c, 0x3e, 0x56, 0xff, 0x5f, 0x6c, 0x80, 0xff, 0x3f, 0x44, 0x54, 0xff, 0x11, 0x0d, 0x12, 0xff, 0x07, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x03, 0x02, 0x00, 0xff, 0x0a, 0x0c, 0x08, 0xff, 0x0d, 0x0f, 0x13, 0xff, 0x05, 0x0a, 0x05, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x09, 0x23, 0xff, 0x0a, 0x39, 0x7e, 0xff, 0x31, 0x6c, 0xc2, 0xff, 0x52, 0x9a, 0xda, 0xff, 0x64, 0xaf, 0xdc, 0xff, 0x71, 0xb2, 0xde, 0xff, 0x7a, 0xb2, 0xdc, 0xff, 0x7c, 0xb1, 0xe3, 0xff, 0x5d, 0x8d, 0xce, 0xff, 0x12, 0x3b, 0x8a, 0xff, 0x00, 0x19, 0x62, 0xff, 0x30, 0x57, 0x89, 0xff, 0x65, 0x88, 0xab, 0xff, 0x16, 0x22, 0x30, 0xff, 0x0e, 0x09, 0x04, 0xff, 0x40, 0x2c, 0x20, 0xff, 0x37, 0x14, 0x07, 0xff, 0x24, 0x0a, 0x09, 0xff, 0x17, 0x0e, 0x0f, 0xff, 0x08, 0x08, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x05, 0x0e, 0x1b, 0xff, 0x10, 0x1e, 0x3e, 0xff, 0x0b, 0x0f, 0x1c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x8c, 0x55, 0x81, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xd8, 0x6e, 0xf3, 0xff, 0xde, 0x60, 0xf2, 0xff, 0xe2, 0x5d, 0xf0, 0xff, 0xd9, 0x63, 0xf3, 0xff, 0xdc, 0x64, 0xf7, 0xff, 0xdb, 0x66, 0xfb, 0xff, 0xda, 0x67, 0xfc, 0xff, 0xd8, 0x64, 0xfc, 0xff, 0xd5, 0x5f, 0xfc, 0xff, 0xd1, 0x5b, 0xfb, 0xff, 0xca, 0x55, 0xfa, 0xff, 0xc7, 0x55, 0xf9, 0xff, 0xc8, 0x59, 0xfa, 0xff, 0xc4, 0x5c, 0xfb, 0xff, 0xbf, 0x60, 0xf6, 0xff, 0xbf, 0x62, 0xf1, 0xff, 0xc2, 0x65, 0xeb, 0xff, 0xc4, 0x69, 0xe4, 0xff, 0xcd, 0x71, 0xd5, 0xff, 0xd0, 0x79, 0xbe, 0xff, 0xce, 0x7d, 0xa9, 0xff, 0xd2, 0x85, 0x8f, 0xff, 0xd7, 0x8d, 0x76, 0xff, 0xe1, 0x99, 0x63, 0xff, 0xe9, 0xa2, 0x51, 0xff, 0xea, 0xab, 0x3b, 0xff, 0xf0, 0xb2, 0x32, 0xff, 0xf7, 0xbb, 0x2a, 0xff, 0xf9, 0xc0, 0x24, 0xff, 0xfb, 0xc5, 0x21, 0xff, 0xfa, 0xca, 0x17, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb0, 0x7f, 0x4e, 0x1a, 0xae, 0x79, 0x4d, 0xff, 0xb3, 0x77, 0x51, 0xff, 0xb8, 0x79, 0x55, 0xff, 0xb5, 0x75, 0x52, 0xff, 0xb5, 0x78, 0x4f, 0xff, 0xb6, 0x7b, 0x4b, 0xff, 0xb9, 0x7e, 0x4e, 0xff, 0xbb, 0x81, 0x52, 0xff, 0xbe, 0x89, 0x57, 0xff, 0xba, 0x8d, 0x59, 0xff, 0xb3, 0x8c, 0x5b, 0xff, 0xb3, 0x90, 0x63, 0xff, 0xb7, 0x92, 0x6e, 0xff, 0xb9, 0x92, 0x74, 0xff, 0xb9, 0x94, 0x73, 0xff, 0xb5, 0x93, 0x75, 0xff, 0xb0, 0x8e, 0x7c, 0xff, 0xb0, 0x8b, 0x84, 0xff, 0xb9, 0x8f, 0x85, 0xff, 0xb3, 0x87, 0x7b, 0xff, 0xb3, 0x7e, 0x8c, 0xff, 0x83, 0x5f, 0x52, 0xff, 0x41, 0x39, 0x19, 0xff, 0x48, 0x3f, 0x37, 0xff, 0x47, 0x3c, 0x32, 0xff, 0x41, 0x35, 0x29, 0xff, 0x4d, 0x43, 0x2d, 0xff, 0x4a, 0x41, 0x2b, 0xff, 0x46, 0x3d, 0x2d, 0xff, 0x42, 0x3a, 0x2a, 0xff, 0x36, 0x2f, 0x22, 0xff, 0x54, 0x4c, 0x40, 0xff, 0x3b, 0x32, 0x25, 0xff, 0x22, 0x19, 0x0f, 0xff, 0x4a, 0x41, 0x39, 0xff, 0x39, 0x31, 0x2c, 0xff, 0x2e, 0x2b, 0x29, 0xff, 0x35, 0x38, 0x32, 0xff, 0x31, 0x31, 0x28, 0xff, 0x32, 0x2f, 0x26, 0xff, 0x37, 0x37, 0x2d, 0xff, 0x3b, 0x3a, 0x31, 0xff, 0x3a, 0x3b, 0x30, 0xff, 0x3b, 0x38, 0x2f, 0xff, 0x46, 0x38, 0x36, 0xff, 0x4c, 0x39, 0x35, 0xff, 0x45, 0x39, 0x32, 0xff, 0x45, 0x3d, 0x33, 0xff, 0x44, 0x37, 0x2e, 0xff, 0x49, 0x3f, 0x36, 0xff, 0x38, 0x2e, 0x32, 0xff, 0x15, 0x2f, 0x5f, 0xff, 0x2d, 0x64, 0xa9, 0xff, 0x13, 0x21, 0x4a, 0xff, 0x26, 0x23, 0x25, 0xff, 0x27, 0x33, 0x26, 0xff, 0x00, 0x06, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2f, 0x34, 0x2a, 0xff, 0x2d, 0x2a, 0x1a, 0xff, 0x1f, 0x11, 0x03, 0xff, 0x1a, 0x12, 0x09, 0xff, 0x04, 0x00, 0x00, 0xff, 0x09, 0x05, 0x06, 0xff, 0x10, 0x11, 0x14, 0xff, 0x0b, 0x14, 0x2a, 0xff, 0x09, 0x28, 0x61, 0xff, 0x20, 0x53, 0xa8, 0xff, 0x41, 0x80, 0xd3, 0xff, 0x58, 0x9c, 0xd9, 0xff, 0x75, 0xb7, 0xe7, 0xff, 0x90, 0xc9, 0xf3, 0xff, 0x9c, 0xc8, 0xea, 0xff, 0x93, 0xc0, 0xe7, 0xff, 0x54, 0x85, 0xc7, 0xff, 0x00, 0x27, 0x83, 0xff, 0x0a, 0x2d, 0x79, 0xff, 0x7a, 0x9f, 0xcd, 0xff, 0x1f, 0x26, 0x45, 0xff, 0x1b, 0x0f, 0x1f, 0xff, 0x7d, 0x69, 0x71, 0xff, 0x93, 0x77, 0x70, 0xff, 0x48, 0x26, 0x13, 0xff, 0x33, 0x10, 0x07, 0xff, 0x19, 0x05, 0x05, 0xff, 0x01, 0x02, 0x02, 0xff, 0x05, 0x0c, 0x18, 0xff, 0x0f, 0x26, 0x47, 0xff, 0x14, 0x2f, 0x65, 0xff, 0x04, 0x00, 0x16, 0xff, 0x00, 0x00, 0x00, 0xff, 0x70, 0x34, 0x63, 0xff, 0xff, 0x93, 0xff, 0xff, 0xd6, 0x73, 0xf6, 0xff, 0xd9, 0x60, 0xee, 0xff, 0xdd, 0x5a, 0xea, 0xff, 0xd4, 0x5d, 0xeb, 0xff, 0xda, 0x61, 0xf1, 0xff, 0xdb, 0x66, 0xf6, 0xff, 0xda, 0x67, 0xf8, 0xff, 0xd7, 0x62, 0xf9, 0xff, 0xd2, 0x5d, 0xfa, 0xff, 0xcc, 0x58, 0xf8, 0xff, 0xc9, 0x54, 0xf5, 0xff, 0xca, 0x55, 0xf7, 0xff, 0xca, 0x59, 0xfa, 0xff, 0xc7, 0x5a, 0xf9, 0xff, 0xc2, 0x5f, 0xf5, 0xff, 0xc3, 0x61, 0xf3, 0xff, 0xc8, 0x65, 0xeb, 0xff, 0xca, 0x69, 0xe3, 0xff, 0xd1, 0x6e, 0xd4, 0xff, 0xd3, 0x74, 0xbc, 0xff, 0xce, 0x79, 0xa2, 0xff, 0xd1, 0x83, 0x89, 0xff, 0xd6, 0x8c, 0x71, 0xff, 0xe0, 0x99, 0x63, 0xff, 0xe7, 0x9e, 0x50, 0xff, 0xeb, 0xa8, 0x3c, 0xff, 0xf6, 0xb4, 0x37, 0xff, 0xf9, 0xbb, 0x2e, 0xff, 0xf8, 0xc0, 0x23, 0xff, 0xf8, 0xc3, 0x1e, 0xff, 0xf8, 0xc7, 0x18, 0xff, 0xf5, 0xcf, 0x09, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb3, 0x85, 0x51, 0x58, 0xb1, 0x7d, 0x4f, 0xff, 0xb6, 0x7c, 0x55, 0xff, 0xbc, 0x7d, 0x57, 0xff, 0xbc, 0x7b, 0x52, 0xff, 0xbb, 0x7d, 0x51, 0xff, 0xba, 0x7e, 0x51, 0xff, 0xba, 0x7d, 0x54, 0xff, 0xb9, 0x80, 0x57, 0xff, 0xbb, 0x88, 0x59, 0xff, 0xb9, 0x8d, 0x5b, 0xff, 0xb6, 0x8e, 0x5d, 0xff, 0xb4, 0x91, 0x62, 0xff, 0xb6, 0x93, 0x68, 0xff, 0xb8, 0x93, 0x70, 0xff, 0xb9, 0x91, 0x75, 0xff, 0xb3, 0x90, 0x75, 0xff, 0xad, 0x8c, 0x7c, 0xff, 0xb0, 0x88, 0x86, 0xff, 0xbc, 0x8d, 0x86, 0xff, 0xb5, 0x87, 0x84, 0xff, 0xb1, 0x87, 0x83, 0xff, 0x6e, 0x54, 0x34, 0xff, 0x35, 0x2c, 0x16, 0xff, 0x43, 0x3c, 0x37, 0xff, 0x4a, 0x42, 0x34, 0xff, 0x41, 0x39, 0x2b, 0xff, 0x46, 0x3d, 0x2d, 0xff, 0x45, 0x3b, 0x2d, 0xff, 0x36, 0x2d, 0x21, 0xff, 0x34, 0x2c, 0x1f, 0xff, 0x32, 0x2b, 0x1c, 0xff, 0x4c, 0x44, 0x38, 0xff, 0x44, 0x3b, 0x32, 0xff, 0x1f, 0x18, 0x0f, 0xff, 0x43, 0x3d, 0x34, 0xff, 0x39, 0x34, 0x2e, 0xff, 0x29, 0x27, 0x23, 0xff, 0x30, 0x32, 0x2c, 0xff, 0x30, 0x30, 0x29, 0xff, 0x39, 0x36, 0x2d, 0xff, 0x3c, 0x3b, 0x31, 0xff, 0x3b, 0x3a, 0x30, 0xff, 0x3c, 0x3b, 0x31, 0xff, 0x35, 0x34, 0x2a, 0xff, 0x3d, 0x36, 0x2e, 0xff, 0x4a, 0x3b, 0x38, 0xff, 0x45, 0x3a, 0x3b, 0xff, 0x3b, 0x38, 0x35, 0xff, 0x45, 0x3b, 0x33, 0xff, 0x4f, 0x44, 0x32, 0xff, 0x2d, 0x2c, 0x25, 0xff, 0x19, 0x2f, 0x6b, 0xff, 0x18, 0x3e, 0x87, 0xff, 0x0f, 0x1c, 0x32, 0xff, 0x25, 0x1e, 0x17, 0xff, 0x08, 0x02, 0x00, 0xff, 0x29, 0x26, 0x22, 0xff, 0x55, 0x54, 0x4f, 0xff, 0x85, 0x81, 0x77, 0xff, 0x62, 0x58, 0x47, 0xff, 0x26, 0x16, 0x04, 0xff, 0x16, 0x04, 0x00, 0xff, 0x0a, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x18, 0x15, 0x17, 0xff, 0x71, 0x82, 0xa2, 0xff, 0x59, 0x85, 0xc2, 0xff, 0x55, 0x8d, 0xd9, 0xff, 0x5a, 0x9c, 0xe0, 0xff, 0x68, 0xa8, 0xdf, 0xff, 0x8e, 0xc2, 0xf7, 0xff, 0xb1, 0xdf, 0xff, 0xff, 0xb7, 0xe3, 0xfe, 0xff, 0x98, 0xcb, 0xf0, 0xff, 0x5f, 0x91, 0xd3, 0xff, 0x19, 0x47, 0x93, 0xff, 0x56, 0x7c, 0xbb, 0xff, 0x28, 0x34, 0x57, 0xff, 0x01, 0x00, 0x1c, 0xff, 0x3d, 0x3c, 0x5b, 0xff, 0x58, 0x57, 0x62, 0xff, 0x7f, 0x77, 0x72, 0xff, 0x2b, 0x1f, 0x11, 0xff, 0x0b, 0x01, 0x00, 0xff, 0x04, 0x03, 0x03, 0xff, 0x01, 0x02, 0x0f, 0xff, 0x19, 0x19, 0x43, 0xff, 0x32, 0x50, 0x82, 0xff, 0x2d, 0x68, 0xab, 0xff, 0x05, 0x0e, 0x25, 0xff, 0x00, 0x00, 0x00, 0xff, 0x4f, 0x14, 0x41, 0xff, 0xf4, 0x8d, 0xf9, 0xff, 0xdf, 0x78, 0xfb, 0xff, 0xd5, 0x61, 0xef, 0xff, 0xd7, 0x5c, 0xed, 0xff, 0xd3, 0x5c, 0xeb, 0xff, 0xd4, 0x5f, 0xed, 0xff, 0xd3, 0x60, 0xee, 0xff, 0xd2, 0x5e, 0xf3, 0xff, 0xd2, 0x5d, 0xf7, 0xff, 0xcc, 0x5a, 0xf8, 0xff, 0xc4, 0x54, 0xf7, 0xff, 0xc6, 0x52, 0xf5, 0xff, 0xcc, 0x55, 0xf7, 0xff, 0xcb, 0x58, 0xf8, 0xff, 0xc7, 0x59, 0xf4, 0xff, 0xc5, 0x5b, 0xf3, 0xff, 0xc7, 0x5d, 0xf2, 0xff, 0xc9, 0x63, 0xe8, 0xff, 0xca, 0x68, 0xdf, 0xff, 0xcd, 0x6b, 0xce, 0xff, 0xd0, 0x71, 0xb9, 0xff, 0xcf, 0x76, 0xa0, 0xff, 0xcf, 0x7c, 0x84, 0xff, 0xd5, 0x86, 0x6c, 0xff, 0xe1, 0x96, 0x5e, 0xff, 0xe8, 0x9d, 0x4d, 0xff, 0xf1, 0xa7, 0x3d, 0xff, 0xf8, 0xb1, 0x37, 0xff, 0xf7, 0xb7, 0x2d, 0xff, 0xf5, 0xbf, 0x21, 0xff, 0xf6, 0xc3, 0x1a, 0xff, 0xf9, 0xc5, 0x19, 0xff, 0xfc, 0xcd, 0x0b, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xaf, 0x84, 0x4f, 0x90, 0xb0, 0x7e, 0x50, 0xff, 0xb6, 0x7f, 0x57, 0xff, 0xbb, 0x7f, 0x58, 0xff, 0xbc, 0x7c, 0x54, 0xff, 0xbb, 0x7d, 0x51, 0xff, 0xbe, 0x82, 0x56, 0xff, 0xbe, 0x80, 0x5a, 0xff, 0xb8, 0x7f, 0x58, 0xff, 0xba, 0x89, 0x5c, 0xff, 0xb9, 0x90, 0x5e, 0xff, 0xb5, 0x91, 0x5f, 0xff, 0xb1, 0x92, 0x5e, 0xff, 0xb3, 0x93, 0x62, 0xff, 0xb5, 0x93, 0x6c, 0xff, 0xb4, 0x8d, 0x75, 0xff, 0xb3, 0x8d, 0x7b, 0xff, 0xae, 0x8c, 0x7c, 0xff, 0xac, 0x88, 0x7d, 0xff, 0xb5, 0x85, 0x82, 0xff, 0xbb, 0x88, 0x93, 0xff, 0xa4, 0x8a, 0x61, 0xff, 0x52, 0x42, 0x19, 0xff, 0x3e, 0x32, 0x2f, 0xff, 0x47, 0x44, 0x35, 0xff, 0x4a, 0x42, 0x35, 0xff, 0x41, 0x38, 0x2b, 0xff, 0x40, 0x37, 0x2a, 0xff, 0x44, 0x3a, 0x2f, 0xff, 0x32, 0x28, 0x1f, 0xff, 0x39, 0x31, 0x27, 0xff, 0x36, 0x30, 0x25, 0xff, 0x3e, 0x38, 0x2d, 0xff, 0x4a, 0x42, 0x39, 0xff, 0x1d, 0x16, 0x0e, 0xff, 0x36, 0x31, 0x2a, 0xff, 0x44, 0x3f, 0x3b, 0xff, 0x28, 0x23, 0x20, 0xff, 0x29, 0x28, 0x22, 0xff, 0x2f, 0x2c, 0x25, 0xff, 0x39, 0x36, 0x2d, 0xff, 0x39, 0x37, 0x2d, 0xff, 0x39, 0x37, 0x2d, 0xff, 0x40, 0x3e, 0x34, 0xff, 0x34, 0x35, 0x2b, 0xff, 0x34, 0x35, 0x2b, 0xff, 0x3e, 0x38, 0x33, 0xff, 0x3c, 0x38, 0x38, 0xff, 0x38, 0x34, 0x37, 0xff, 0x42, 0x39, 0x38, 0xff, 0x42, 0x40, 0x28, 0xff, 0x12, 0x1b, 0x15, 0xff, 0x30, 0x47, 0x8b, 0xff, 0x42, 0x66, 0xae, 0xff, 0x00, 0x0c, 0x1f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x12, 0x0d, 0x16, 0xff, 0x48, 0x44, 0x50, 0xff, 0x6e, 0x6d, 0x73, 0xff, 0x90, 0x91, 0x8c, 0xff, 0x68, 0x64, 0x58, 0xff, 0x0c, 0x04, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x18, 0x13, 0x14, 0xff, 0x10, 0x0d, 0x11, 0xff, 0x00, 0x00, 0x00, 0xff, 0x74, 0x7f, 0xa1, 0xff, 0xac, 0xd7, 0xff, 0xff, 0x6c, 0xb1, 0xe8, 0xff, 0x6d, 0xb2, 0xe7, 0xff, 0x6d, 0xab, 0xdf, 0xff, 0x90, 0xbd, 0xef, 0xff, 0xc8, 0xe7, 0xff, 0xff, 0xc5, 0xf2, 0xfe, 0xff, 0x93, 0xc9, 0xf2, 0xff, 0x5e, 0x92, 0xd2, 0xff, 0x6f, 0xa3, 0xce, 0xff, 0xa1, 0xc8, 0xd8, 0xff, 0x62, 0x79, 0x86, 0xff, 0x4c, 0x59, 0x78, 0xff, 0x61, 0x72, 0x8e, 0xff, 0x7c, 0x96, 0xa6, 0xff, 0x95, 0xad, 0xb5, 0xff, 0x7f, 0x96, 0x96, 0xff, 0x6f, 0x88, 0x83, 0xff, 0x68, 0x7a, 0x86, 0xff, 0x1c, 0x2c, 0x49, 0xff, 0x50, 0x63, 0x8d, 0xff, 0x8b, 0xb4, 0xe8, 0xff, 0x65, 0xb6, 0xf7, 0xff, 0x0f, 0x2a, 0x51, 0xff, 0x00, 0x00, 0x00, 0xff, 0x36, 0x10, 0x26, 0xff, 0xe5, 0x8b, 0xe5, 0xff, 0xf0, 0x7c, 0xf8, 0xff, 0xe1, 0x67, 0xef, 0xff, 0xd4, 0x5f, 0xec, 0xff, 0xd6, 0x60, 0xeb, 0xff, 0xd3, 0x60, 0xe9, 0xff, 0xcf, 0x5e, 0xeb, 0xff, 0xcb, 0x5a, 0xf0, 0xff, 0xcb, 0x58, 0xf2, 0xff, 0xc8, 0x57, 0xf2, 0xff, 0xc2, 0x54, 0xf5, 0xff, 0xc4, 0x51, 0xf6, 0xff, 0xca, 0x54, 0xf6, 0xff, 0xca, 0x57, 0xf3, 0xff, 0xc6, 0x57, 0xee, 0xff, 0xc4, 0x58, 0xec, 0xff, 0xc6, 0x5a, 0xeb, 0xff, 0xc7, 0x62, 0xe4, 0xff, 0xc8, 0x65, 0xdb, 0xff, 0xcd, 0x6a, 0xcc, 0xff, 0xd0, 0x6e, 0xb7, 0xff, 0xcc, 0x6e, 0xa0, 0xff, 0xcd, 0x73, 0x83, 0xff, 0xd3, 0x7c, 0x67, 0xff, 0xe1, 0x8e, 0x58, 0xff, 0xe9, 0x98, 0x4a, 0xff, 0xf2, 0xa5, 0x3b, 0xff, 0xf6, 0xac, 0x34, 0xff, 0xf4, 0xb3, 0x29, 0xff, 0xf6, 0xbd, 0x1c, 0xff, 0xfb, 0xc5, 0x18, 0xff, 0xff, 0xc7, 0x19, 0xff, 0xfd, 0xc9, 0x0e, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb0, 0x85, 0x4e, 0xc6, 0xad, 0x7e, 0x4e, 0xff, 0xb3, 0x7f, 0x55, 0xff, 0xba, 0x83, 0x58, 0xff, 0xb9, 0x80, 0x56, 0xff, 0xba, 0x82, 0x54, 0xff, 0xba, 0x83, 0x57, 0xff, 0xb8, 0x80, 0x5d, 0xff, 0xb8, 0x80, 0x5e, 0xff, 0xbb, 0x89, 0x60, 0xff, 0xb8, 0x91, 0x5f, 0xff, 0xb1, 0x91, 0x5d, 0xff, 0xb0, 0x90, 0x61, 0xff, 0xb2, 0x93, 0x62, 0xff, 0xb3, 0x94, 0x67, 0xff, 0xb2, 0x8e, 0x70, 0xff, 0xb0, 0x8a, 0x7d, 0xff, 0xab, 0x8a, 0x7a, 0xff, 0xac, 0x8a, 0x78, 0xff, 0xb9, 0x85, 0x89, 0xff, 0xc2, 0x94, 0x8f, 0xff, 0x87, 0x75, 0x40, 0xff, 0x3c, 0x31, 0x0e, 0xff, 0x46, 0x40, 0x38, 0xff, 0x43, 0x41, 0x30, 0xff, 0x42, 0x3b, 0x2f, 0xff, 0x3a, 0x33, 0x27, 0xff, 0x3b, 0x31, 0x28, 0xff, 0x4d, 0x44, 0x3b, 0xff, 0x37, 0x2f, 0x27, 0xff, 0x2c, 0x25, 0x1e, 0xff, 0x31, 0x2b, 0x23, 0xff, 0x47, 0x41, 0x38, 0xff, 0x47, 0x40, 0x37, 0xff, 0x23, 0x1d, 0x17, 0xff, 0x28, 0x24, 0x1f, 0xff, 0x4c, 0x46, 0x42, 0xff, 0x2d, 0x26, 0x23, 0xff, 0x2c, 0x2b, 0x26, 0xff, 0x34, 0x31, 0x2a, 0xff, 0x39, 0x33, 0x2b, 0xff, 0x2d, 0x2b, 0x21, 0xff, 0x37, 0x35, 0x2b, 0xff, 0x40, 0x3e, 0x35, 0xff, 0x3b, 0x3a, 0x31, 0xff, 0x36, 0x38, 0x2e, 0xff, 0x35, 0x36, 0x2d, 0xff, 0x3b, 0x3b, 0x31, 0xff, 0x43, 0x3c, 0x34, 0xff, 0x45, 0x35, 0x39, 0xff, 0x37, 0x31, 0x2d, 0xff, 0x0a, 0x1a, 0x24, 0xff, 0x3d, 0x68, 0xa6, 0xff, 0x71, 0xa5, 0xd0, 0xff, 0x4a, 0x72, 0x90, 0xff, 0x05, 0x15, 0x37, 0xff, 0x1b, 0x30, 0x4f, 0xff, 0x1b, 0x37, 0x4f, 0xff, 0x37, 0x55, 0x6c, 0xff, 0x67, 0x86, 0x95, 0xff, 0x84, 0xa1, 0xa8, 0xff, 0x84, 0x9f, 0xab, 0xff, 0x82, 0x9d, 0xae, 0xff, 0x86, 0xa2, 0xbd, 0xff, 0x80, 0x9b, 0xc6, 0xff, 0x58, 0x6f, 0x9c, 0xff, 0x55, 0x75, 0x9a, 0xff, 0x81, 0xb1, 0xd5, 0xff, 0x8e, 0xc9, 0xf1, 0xff, 0x7c, 0xbb, 0xea, 0xff, 0x79, 0xb4, 0xe9, 0xff, 0x94, 0xbe, 0xf4, 0xff, 0xcc, 0xe7, 0xfa, 0xff, 0xce, 0xf3, 0xfb, 0xff, 0x9d, 0xd4, 0xf5, 0xff, 0x6d, 0xa8, 0xe3, 0xff, 0x72, 0xa5, 0xd7, 0xff, 0x8d, 0xb9, 0xd5, 0xff, 0xa7, 0xcb, 0xed, 0xff, 0x69, 0x84, 0xc5, 0xff, 0x63, 0x87, 0xc8, 0xff, 0x8a, 0xb4, 0xed, 0xff, 0x81, 0xa7, 0xe7, 0xff, 0x83, 0xa8, 0xea, 0xff, 0x83, 0xaa, 0xe6, 0xff, 0x77, 0x9a, 0xd7, 0xff, 0x2e, 0x50, 0x8b, 0xff, 0x2e, 0x4d, 0x82, 0xff, 0xad, 0xdb, 0xff, 0xff, 0x8e, 0xe9, 0xff, 0xff, 0x25, 0x61, 0x96, 0xff, 0x00, 0x00, 0x00, 0xff, 0x34, 0x0b, 0x1c, 0xff, 0xe9, 0x8a, 0xd4, 0xff, 0xff, 0x83, 0xeb, 0xff, 0xe9, 0x6a, 0xe2, 0xff, 0xd3, 0x66, 0xe3, 0xff, 0xda, 0x60, 0xe2, 0xff, 0xd7, 0x61, 0xe4, 0xff, 0xd2, 0x61, 0xe6, 0xff, 0xcb, 0x5c, 0xea, 0xff, 0xc6, 0x57, 0xec, 0xff, 0xc2, 0x54, 0xee, 0xff, 0xbf, 0x51, 0xf3, 0xff, 0xbf, 0x4d, 0xf3, 0xff, 0xc4, 0x50, 0xf2, 0xff, 0xc7, 0x54, 0xf1, 0xff, 0xc5, 0x53, 0xed, 0xff, 0xc6, 0x54, 0xeb, 0xff, 0xc8, 0x57, 0xec, 0xff, 0xc7, 0x5b, 0xe7, 0xff, 0xc8, 0x5f, 0xdf, 0xff, 0xcd, 0x61, 0xd0, 0xff, 0xcf, 0x66, 0xbb, 0xff, 0xcd, 0x65, 0xa9, 0xff, 0xd1, 0x6b, 0x91, 0xff, 0xd8, 0x73, 0x71, 0xff, 0xe1, 0x83, 0x58, 0xff, 0xea, 0x91, 0x4a, 0xff, 0xf4, 0xa0, 0x3c, 0xff, 0xf4, 0xa5, 0x32, 0xff, 0xf3, 0xae, 0x2a, 0xff, 0xf7, 0xbb, 0x18, 0xff, 0xfa, 0xc1, 0x0f, 0xff, 0xfd, 0xc2, 0x12, 0xff, 0xfc, 0xc4, 0x0d, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x01, 0xb1, 0x88, 0x52, 0xf2, 0xad, 0x81, 0x4f, 0xff, 0xb2, 0x81, 0x55, 0xff, 0xb9, 0x86, 0x5b, 0xff, 0xb8, 0x87, 0x5c, 0xff, 0xb7, 0x88, 0x5d, 0xff, 0xb4, 0x83, 0x5d, 0xff, 0xb6, 0x82, 0x5f, 0xff, 0xb9, 0x86, 0x62, 0xff, 0xbb, 0x8e, 0x63, 0xff, 0xb5, 0x92, 0x60, 0xff, 0xb1, 0x91, 0x60, 0xff, 0xb3, 0x91, 0x65, 0xff, 0xb4, 0x95, 0x67, 0xff, 0xb3, 0x94, 0x68, 0xff, 0xb1, 0x91, 0x6d, 0xff, 0xb0, 0x8a, 0x7d, 0xff, 0xad, 0x89, 0x7c, 0xff, 0xac, 0x8a, 0x75, 0xff, 0xb6, 0x87, 0x8e, 0xff, 0xbc, 0x99, 0x80, 0xff, 0x69, 0x57, 0x29, 0xff, 0x3c, 0x33, 0x1b, 0xff, 0x44, 0x45, 0x34, 0xff, 0x4d, 0x4a, 0x3e, 0xff, 0x44, 0x3d, 0x30, 0xff, 0x3c, 0x34, 0x2a, 0xff, 0x3b, 0x33, 0x2a, 0xff, 0x49, 0x3f, 0x39, 0xff, 0x40, 0x36, 0x30, 0xff, 0x2b, 0x24, 0x1b, 0xff, 0x23, 0x1e, 0x16, 0xff, 0x38, 0x32, 0x2d, 0xff, 0x4c, 0x46, 0x41, 0xff, 0x30, 0x2c, 0x27, 0xff, 0x1a, 0x18, 0x14, 0xff, 0x4d, 0x49, 0x46, 0xff, 0x29, 0x23, 0x1f, 0xff, 0x31, 0x2c, 0x26, 0xff, 0x30, 0x2a, 0x23, 0xff, 0x33, 0x30, 0x26, 0xff, 0x32, 0x31, 0x27, 0xff, 0x31, 0x2f, 0x25, 0xff, 0x35, 0x32, 0x27, 0xff, 0x3f, 0x3c, 0x32, 0xff, 0x38, 0x37, 0x2d, 0xff, 0x39, 0x3b, 0x2d, 0xff, 0x3d, 0x40, 0x2a, 0xff, 0x3a, 0x34, 0x1f, 0xff, 0x48, 0x34, 0x32, 0xff, 0x24, 0x18, 0x2b, 0xff, 0x0d, 0x28, 0x4a, 0xff, 0x95, 0xcc, 0xf4, 0xff, 0xd3, 0xff, 0xff, 0xff, 0x86, 0xc8, 0xe6, 0xff, 0x34, 0x5e, 0xa4, 0xff, 0x35, 0x5e, 0x9e, 0xff, 0x24, 0x57, 0x93, 0xff, 0x3a, 0x70, 0xae, 0xff, 0x60, 0x97, 0xd3, 0xff, 0x80, 0xb4, 0xeb, 0xff, 0x8e, 0xc2, 0xf8, 0xff, 0x73, 0xab, 0xe3, 0xff, 0x57, 0x8d, 0xda, 0xff, 0x40, 0x71, 0xd1, 0xff, 0x59, 0x8e, 0xd5, 0xff, 0x84, 0xb7, 0xd5, 0xff, 0xaa, 0xd7, 0xe7, 0xff, 0xa6, 0xcf, 0xf4, 0xff, 0x91, 0xc1, 0xf5, 0xff, 0x81, 0xba, 0xf4, 0xff, 0x8b, 0xbb, 0xf0, 0xff, 0xbe, 0xde, 0xf3, 0xff, 0xd5, 0xf1, 0xff, 0xff, 0xad, 0xdf, 0xf9, 0xff, 0x81, 0xbc, 0xef, 0xff, 0x74, 0xa4, 0xe5, 0xff, 0x70, 0xa3, 0xda, 0xff, 0x4c, 0x79, 0xc1, 0xff, 0x12, 0x36, 0x9c, 0xff, 0x00, 0x24, 0x8a, 0xff, 0x08, 0x2c, 0x94, 0xff, 0x17, 0x3a, 0xaf, 0xff, 0x16, 0x38, 0xb6, 0xff, 0x19, 0x36, 0xb5, 0xff, 0x05, 0x26, 0x97, 0xff, 0x20, 0x48, 0xa4, 0xff, 0x24, 0x4c, 0x95, 0xff, 0x3e, 0x6a, 0xa9, 0xff, 0x92, 0xe2, 0xff, 0xff, 0x5f, 0xa9, 0xdf, 0xff, 0x00, 0x00, 0x08, 0xff, 0x41, 0x0d, 0x1e, 0xff, 0xf7, 0x92, 0xcd, 0xff, 0xff, 0x86, 0xd7, 0xff, 0xf1, 0x6b, 0xd4, 0xff, 0xdb, 0x68, 0xd8, 0xff, 0xdc, 0x62, 0xd9, 0xff, 0xd9, 0x5e, 0xd9, 0xff, 0xcf, 0x5a, 0xd9, 0xff, 0xcb, 0x57, 0xe0, 0xff, 0xc8, 0x56, 0xe8, 0xff, 0xc0, 0x52, 0xeb, 0xff, 0xbd, 0x4d, 0xee, 0xff, 0xbc, 0x4a, 0xf1, 0xff, 0xbd, 0x48, 0xf1, 0xff, 0xc1, 0x4b, 0xef, 0xff, 0xc2, 0x4d, 0xec, 0xff, 0xc5, 0x4f, 0xea, 0xff, 0xc3, 0x4f, 0xeb, 0xff, 0xc1, 0x52, 0xe6, 0xff, 0xc4, 0x57, 0xde, 0xff, 0xc8, 0x5a, 0xd2, 0xff, 0xcb, 0x5b, 0xc4, 0xff, 0xcf, 0x5e, 0xb8, 0xff, 0xd5, 0x64, 0xa0, 0xff, 0xd6, 0x69, 0x79, 0xff, 0xdf, 0x7a, 0x5c, 0xff, 0xee, 0x8e, 0x4d, 0xff, 0xf5, 0x9c, 0x42, 0xff, 0xf3, 0x9f, 0x38, 0xff, 0xf2, 0xa9, 0x2b, 0xff, 0xf8, 0xb8, 0x17, 0xff, 0xf9, 0xbe, 0x06, 0xff, 0xfb, 0xbd, 0x0a, 0xff, 0xfc, 0xbe, 0x0c, 0xf2, 0xff, 0xff, 0x00, 0x01,
+    0xb1, 0x8b, 0x5c, 0x21, 0xb0, 0x8c, 0x58, 0xff, 0xaf, 0x87, 0x56, 0xff, 0xb3, 0x88, 0x59, 0xff, 0xb9, 0x8b, 0x5f, 0xff, 0xb8, 0x8c, 0x62, 0xff, 0xb4, 0x89, 0x64, 0xff, 0xb4, 0x87, 0x67, 0xff, 0xbb, 0x88, 0x66, 0xff, 0xb9, 0x8c, 0x63, 0xff, 0xb7, 0x8f, 0x61, 0xff, 0xb6, 0x91, 0x61, 0xff, 0xb5, 0x93, 0x66, 0xff, 0xb5, 0x96, 0x67, 0xff, 0xb8, 0x99, 0x6c, 0xff, 0xb5, 0x94, 0x6f, 0xff, 0xb4, 0x94, 0x70, 0xff, 0xb0, 0x8f, 0x79, 0xff, 0xb1, 0x89, 0x7e, 0xff, 0xaf, 0x85, 0x7b, 0xff, 0xba, 0x93, 0x8d, 0xff, 0xa8, 0x8a, 0x6b, 0xff, 0x4a, 0x36, 0x16, 0xff, 0x3c, 0x38, 0x20, 0xff, 0x3e, 0x41, 0x2c, 0xff, 0x52, 0x4c, 0x42, 0xff, 0x4b, 0x41, 0x36, 0xff, 0x3d, 0x33, 0x2a, 0xff, 0x3f, 0x35, 0x2a, 0xff, 0x52, 0x46, 0x3c, 0xff, 0x4e, 0x43, 0x37, 0xff, 0x30, 0x29, 0x17, 0xff, 0x28, 0x20, 0x17, 0xff, 0x2f, 0x28, 0x27, 0xff, 0x45, 0x42, 0x3f, 0xff, 0x34, 0x32, 0x2e, 0xff, 0x10, 0x0f, 0x0b, 0xff, 0x40, 0x40, 0x3b, 0xff, 0x33, 0x2f, 0x29, 0xff, 0x34, 0x2c, 0x25, 0xff, 0x2c, 0x27, 0x1f, 0xff, 0x2b, 0x2b, 0x21, 0xff, 0x36, 0x33, 0x2a, 0xff, 0x34, 0x2f, 0x25, 0xff, 0x3d, 0x37, 0x2b, 0xff, 0x42, 0x3b, 0x2f, 0xff, 0x36, 0x33, 0x25, 0xff, 0x3b, 0x3d, 0x2d, 0xff, 0x3f, 0x3e, 0x2c, 0xff, 0x3d, 0x38, 0x2c, 0xff, 0x44, 0x36, 0x2b, 0xff, 0x16, 0x04, 0x1b, 0xff, 0x3a, 0x58, 0x92, 0xff, 0xc5, 0xff, 0xff, 0xff, 0xb0, 0xed, 0xff, 0xff, 0x77, 0xb9, 0xf1, 0xff, 0x68, 0x96, 0xdc, 0xff, 0x29, 0x56, 0xad, 0xff, 0x18, 0x4a, 0xac, 0xff, 0x22, 0x53, 0xbe, 0xff, 0x26, 0x53, 0xc3, 0xff, 0x31, 0x5b, 0xc6, 0xff, 0x30, 0x5d, 0xbf, 0xff, 0x14, 0x47, 0xa8, 0xff, 0x00, 0x32, 0x9d, 0xff, 0x0e, 0x43, 0xa4, 0xff, 0x64, 0x97, 0xd8, 0xff, 0xb8, 0xe4, 0xfe, 0xff, 0xb9, 0xe1, 0xf0, 0xff, 0xa8, 0xd1, 0xf3, 0xff, 0x9b, 0xc6, 0xf7, 0xff, 0x85, 0xbd, 0xf4, 0xff, 0x82, 0xba, 0xec, 0xff, 0xa3, 0xc9, 0xef, 0xff, 0xc2, 0xe6, 0xfa, 0xff, 0xbf, 0xe8, 0xf9, 0xff, 0xa1, 0xc9, 0xf2, 0xff, 0x81, 0xb2, 0xe7, 0xff, 0x75, 0xb5, 0xdf, 0xff, 0x83, 0xbd, 0xf1, 0xff, 0x67, 0x95, 0xdd, 0xff, 0x47, 0x73, 0xc7, 0xff, 0x16, 0x3d, 0x9e, 0xff, 0x00, 0x1b, 0x84, 0xff, 0x00, 0x17, 0x84, 0xff, 0x00, 0x1b, 0x8a, 0xff, 0x1c, 0x41, 0xa1, 0xff, 0x71, 0x9d, 0xe8, 0xff, 0x85, 0xb8, 0xf4, 0xff, 0x58, 0x88, 0xc4, 0xff, 0x5c, 0x9c, 0xd4, 0xff, 0x7e, 0xcc, 0xff, 0xff, 0x0d, 0x27, 0x48, 0xff, 0x39, 0x00, 0x11, 0xff, 0xfd, 0x97, 0xc6, 0xff, 0xff, 0x8a, 0xc8, 0xff, 0xf5, 0x74, 0xc4, 0xff, 0xe2, 0x69, 0xca, 0xff, 0xe0, 0x66, 0xd1, 0xff, 0xde, 0x63, 0xd0, 0xff, 0xd3, 0x5b, 0xcf, 0xff, 0xcb, 0x53, 0xd3, 0xff, 0xc7, 0x52, 0xdc, 0xff, 0xc4, 0x52, 0xe4, 0xff, 0xbe, 0x4c, 0xe6, 0xff, 0xb9, 0x46, 0xec, 0xff, 0xb8, 0x44, 0xef, 0xff, 0xb8, 0x44, 0xea, 0xff, 0xbd, 0x49, 0xe6, 0xff, 0xbe, 0x47, 0xe5, 0xff, 0xbd, 0x45, 0xe8, 0xff, 0xbd, 0x4a, 0xe8, 0xff, 0xbe, 0x4e, 0xe0, 0xff, 0xc4, 0x52, 0xd9, 0xff, 0xc5, 0x4d, 0xd2, 0xff, 0xc7, 0x4e, 0xc0, 0xff, 0xcd, 0x51, 0xa5, 0xff, 0xd3, 0x5d, 0x85, 0xff, 0xdd, 0x73, 0x67, 0xff, 0xec, 0x8a, 0x51, 0xff, 0xf4, 0x97, 0x48, 0xff, 0xf3, 0x9b, 0x42, 0xff, 0xf1, 0xa7, 0x2c, 0xff, 0xf7, 0xb4, 0x18, 0xff, 0xfc, 0xbd, 0x05, 0xff, 0xff, 0xbd, 0x09, 0xff, 0xff, 0xbc, 0x0f, 0xff, 0xff, 0xc1, 0x07, 0x21,
+    0xb0, 0x8e, 0x5b, 0x4b, 0xaf, 0x8f, 0x5d, 0xff, 0xaf, 0x8b, 0x5c, 0xff, 0xb5, 0x8d, 0x61, 0xff, 0xba, 0x8f, 0x65, 0xff, 0xbb, 0x90, 0x67, 0xff, 0xb8, 0x8e, 0x6a, 0xff, 0xb7, 0x8c, 0x6b, 0xff, 0xba, 0x8c, 0x68, 0xff, 0xbd, 0x8e, 0x68, 0xff, 0xba, 0x8e, 0x64, 0xff, 0xbc, 0x95, 0x67, 0xff, 0xb9, 0x97, 0x69, 0xff, 0xb7, 0x97, 0x6a, 0xff, 0xb9, 0x9a, 0x70, 0xff, 0xb8, 0x99, 0x74, 0xff, 0xb6, 0x97, 0x74, 0xff, 0xb1, 0x94, 0x74, 0xff, 0xb2, 0x89, 0x84, 0xff, 0xb6, 0x83, 0x8c, 0xff, 0xcc, 0xa4, 0x8b, 0xff, 0x8c, 0x72, 0x4b, 0xff, 0x3e, 0x2c, 0x1a, 0xff, 0x44, 0x42, 0x2a, 0xff, 0x41, 0x46, 0x27, 0xff, 0x44, 0x3e, 0x30, 0xff, 0x49, 0x3c, 0x36, 0xff, 0x3c, 0x31, 0x27, 0xff, 0x3e, 0x30, 0x25, 0xff, 0x53, 0x46, 0x38, 0xff, 0x55, 0x4b, 0x38, 0xff, 0x35, 0x2d, 0x19, 0xff, 0x27, 0x1d, 0x13, 0xff, 0x26, 0x1f, 0x1c, 0xff, 0x3f, 0x3d, 0x38, 0xff, 0x42, 0x3f, 0x3a, 0xff, 0x0e, 0x0e, 0x08, 0xff, 0x36, 0x36, 0x30, 0xff, 0x37, 0x32, 0x2f, 0xff, 0x29, 0x24, 0x20, 0xff, 0x31, 0x2e, 0x27, 0xff, 0x2e, 0x2b, 0x23, 0xff, 0x35, 0x2e, 0x27, 0xff, 0x3c, 0x34, 0x2b, 0xff, 0x3f, 0x36, 0x2c, 0xff, 0x40, 0x37, 0x2c, 0xff, 0x34, 0x30, 0x21, 0xff, 0x36, 0x32, 0x29, 0xff, 0x42, 0x3c, 0x39, 0xff, 0x32, 0x30, 0x2d, 0xff, 0x37, 0x32, 0x1d, 0xff, 0x1c, 0x0e, 0x16, 0xff, 0x79, 0x90, 0xcf, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xab, 0xdd, 0xfe, 0xff, 0x99, 0xc8, 0xf8, 0xff, 0x85, 0xba, 0xe5, 0xff, 0x5c, 0x93, 0xcd, 0xff, 0x4b, 0x7b, 0xcf, 0xff, 0x2d, 0x59, 0xbb, 0xff, 0x13, 0x37, 0xa3, 0xff, 0x03, 0x21, 0x8b, 0xff, 0x05, 0x26, 0x87, 0xff, 0x0e, 0x2f, 0x95, 0xff, 0x2f, 0x55, 0xb1, 0xff, 0x85, 0xb4, 0xe7, 0xff, 0xbf, 0xe2, 0xff, 0xff, 0xc4, 0xe6, 0xff, 0xff, 0xb6, 0xdf, 0xf9, 0xff, 0xa4, 0xd4, 0xf8, 0xff, 0x9d, 0xd1, 0xf6, 0xff, 0x8d, 0xc5, 0xf3, 0xff, 0x84, 0xbd, 0xf2, 0xff, 0x8d, 0xbf, 0xf3, 0xff, 0xab, 0xd8, 0xf5, 0xff, 0xd3, 0xee, 0xff, 0xff, 0xc2, 0xd5, 0xfc, 0xff, 0x8d, 0xb9, 0xea, 0xff, 0x72, 0xb0, 0xdf, 0xff, 0x81, 0xba, 0xe6, 0xff, 0x9c, 0xca, 0xfa, 0xff, 0xa2, 0xc4, 0xff, 0xff, 0x93, 0xb4, 0xfc, 0xff, 0x77, 0x9d, 0xe3, 0xff, 0x73, 0x9a, 0xdc, 0xff, 0x82, 0xa9, 0xe8, 0xff, 0x99, 0xc1, 0xfc, 0xff, 0x9c, 0xc9, 0xff, 0xff, 0x94, 0xc2, 0xfa, 0xff, 0x9e, 0xca, 0xff, 0xff, 0x7d, 0xb2, 0xf3, 0xff, 0x7f, 0xca, 0xff, 0xff, 0x24, 0x5f, 0x91, 0xff, 0x2f, 0x03, 0x17, 0xff, 0xff, 0x92, 0xc2, 0xff, 0xfc, 0x8c, 0xca, 0xff, 0xf4, 0x7f, 0xb9, 0xff, 0xe7, 0x6b, 0xc3, 0xff, 0xe5, 0x61, 0xca, 0xff, 0xe0, 0x62, 0xc8, 0xff, 0xd8, 0x5a, 0xc9, 0xff, 0xd1, 0x54, 0xd0, 0xff, 0xc9, 0x4f, 0xd3, 0xff, 0xc2, 0x4d, 0xd7, 0xff, 0xbe, 0x48, 0xde, 0xff, 0xb5, 0x43, 0xe5, 0xff, 0xb1, 0x42, 0xe8, 0xff, 0xb2, 0x44, 0xe8, 0xff, 0xb6, 0x42, 0xe6, 0xff, 0xba, 0x41, 0xe4, 0xff, 0xbc, 0x41, 0xe6, 0xff, 0xbb, 0x44, 0xea, 0xff, 0xb9, 0x45, 0xe4, 0xff, 0xbc, 0x46, 0xde, 0xff, 0xbc, 0x40, 0xd7, 0xff, 0xbd, 0x3c, 0xc6, 0xff, 0xc1, 0x3c, 0xa6, 0xff, 0xd1, 0x50, 0x8c, 0xff, 0xde, 0x6b, 0x71, 0xff, 0xe6, 0x81, 0x54, 0xff, 0xf0, 0x8f, 0x4a, 0xff, 0xf3, 0x98, 0x45, 0xff, 0xf4, 0xa6, 0x30, 0xff, 0xf8, 0xb3, 0x16, 0xff, 0xfd, 0xbb, 0x04, 0xff, 0xfe, 0xb9, 0x09, 0xff, 0xfd, 0xb8, 0x0e, 0xff, 0xff, 0xbb, 0x0a, 0x4b,
+    0xb0, 0x93, 0x61, 0x6b, 0xae, 0x92, 0x62, 0xff, 0xae, 0x90, 0x63, 0xff, 0xb5, 0x93, 0x68, 0xff, 0xb9, 0x94, 0x6b, 0xff, 0xba, 0x93, 0x6e, 0xff, 0xb8, 0x92, 0x71, 0xff, 0xb7, 0x91, 0x70, 0xff, 0xba, 0x90, 0x69, 0xff, 0xbc, 0x91, 0x6a, 0xff, 0xbb, 0x94, 0x6a, 0xff, 0xb9, 0x98, 0x6a, 0xff, 0xb7, 0x9a, 0x6c, 0xff, 0xb8, 0x9a, 0x70, 0xff, 0xb9, 0x9a, 0x73, 0xff, 0xb9, 0x9b, 0x76, 0xff, 0xb7, 0x9a, 0x75, 0xff, 0xb4, 0x96, 0x77, 0xff, 0xb4, 0x8a, 0x88, 0xff, 0xb9, 0x8c, 0x94, 0xff, 0xbc, 0xa4, 0x77, 0xff, 0x66, 0x55, 0x29, 0xff, 0x41, 0x32, 0x2b, 0xff, 0x42, 0x41, 0x31, 0xff, 0x3d, 0x3d, 0x29, 0xff, 0x44, 0x3f, 0x31, 0xff, 0x44, 0x3f, 0x30, 0xff, 0x3b, 0x32, 0x28, 0xff, 0x42, 0x37, 0x2f, 0xff, 0x4f, 0x42, 0x3d, 0xff, 0x58, 0x4e, 0x42, 0xff, 0x3a, 0x35, 0x22, 0xff, 0x25, 0x21, 0x15, 0xff, 0x22, 0x1e, 0x16, 0xff, 0x35, 0x33, 0x2b, 0xff, 0x4c, 0x4a, 0x43, 0xff, 0x19, 0x1b, 0x11, 0xff, 0x22, 0x24, 0x1d, 0xff, 0x45, 0x42, 0x40, 0xff, 0x1f, 0x1a, 0x17, 0xff, 0x2c, 0x2a, 0x25, 0xff, 0x2e, 0x2d, 0x26, 0xff, 0x32, 0x2e, 0x27, 0xff, 0x31, 0x2d, 0x24, 0xff, 0x31, 0x2d, 0x23, 0xff, 0x3d, 0x39, 0x2e, 0xff, 0x3b, 0x35, 0x29, 0xff, 0x3e, 0x34, 0x2c, 0xff, 0x40, 0x3b, 0x38, 0xff, 0x31, 0x31, 0x29, 0xff, 0x2c, 0x21, 0x14, 0xff, 0x24, 0x25, 0x3c, 0xff, 0xa5, 0xcd, 0xec, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xbc, 0xe5, 0xf9, 0xff, 0xcb, 0xe3, 0xfd, 0xff, 0xb5, 0xe1, 0xf3, 0xff, 0xaa, 0xd7, 0xf5, 0xff, 0xa1, 0xce, 0xf5, 0xff, 0x8d, 0xbb, 0xef, 0xff, 0x85, 0xb1, 0xee, 0xff, 0x7c, 0xa4, 0xdf, 0xff, 0x7d, 0xa2, 0xdb, 0xff, 0x94, 0xbb, 0xf0, 0xff, 0xa4, 0xc9, 0xf8, 0xff, 0xb9, 0xe0, 0xf3, 0xff, 0xca, 0xea, 0xfe, 0xff, 0xbb, 0xdb, 0xfe, 0xff, 0xaa, 0xd0, 0xfa, 0xff, 0x98, 0xca, 0xf4, 0xff, 0x8e, 0xc8, 0xf0, 0xff, 0x92, 0xc7, 0xf6, 0xff, 0x8e, 0xc1, 0xf3, 0xff, 0x87, 0xbc, 0xf0, 0xff, 0xa1, 0xce, 0xf7, 0xff, 0xcb, 0xe8, 0xff, 0xff, 0xcb, 0xde, 0xff, 0xff, 0xa4, 0xc6, 0xf6, 0xff, 0x83, 0xb2, 0xea, 0xff, 0x7d, 0xa8, 0xe8, 0xff, 0x8e, 0xb3, 0xf3, 0xff, 0xa2, 0xbf, 0xfb, 0xff, 0xa7, 0xc6, 0xfb, 0xff, 0xb1, 0xd1, 0xff, 0xff, 0xb5, 0xd4, 0xff, 0xff, 0xad, 0xcf, 0xfb, 0xff, 0xa6, 0xcd, 0xfd, 0xff, 0x9c, 0xc5, 0xfc, 0xff, 0x94, 0xbc, 0xfc, 0xff, 0x90, 0xb9, 0xff, 0xff, 0x8f, 0xbb, 0xfd, 0xff, 0x88, 0xc4, 0xff, 0xff, 0x46, 0x85, 0xcf, 0xff, 0x35, 0x16, 0x3a, 0xff, 0xfa, 0x90, 0xad, 0xff, 0xff, 0x8c, 0xbc, 0xff, 0xf2, 0x7b, 0xb5, 0xff, 0xeb, 0x6c, 0xbd, 0xff, 0xeb, 0x61, 0xbf, 0xff, 0xe6, 0x61, 0xbc, 0xff, 0xde, 0x5d, 0xc1, 0xff, 0xd8, 0x56, 0xcb, 0xff, 0xd3, 0x52, 0xd1, 0xff, 0xc7, 0x4a, 0xd1, 0xff, 0xbb, 0x43, 0xd7, 0xff, 0xb2, 0x3f, 0xe4, 0xff, 0xaf, 0x3c, 0xe6, 0xff, 0xb1, 0x3b, 0xe7, 0xff, 0xb2, 0x3a, 0xe9, 0xff, 0xb4, 0x3d, 0xea, 0xff, 0xb5, 0x3f, 0xe8, 0xff, 0xb2, 0x3e, 0xe7, 0xff, 0xae, 0x3d, 0xe3, 0xff, 0xae, 0x3c, 0xe1, 0xff, 0xad, 0x34, 0xdc, 0xff, 0xb6, 0x33, 0xcf, 0xff, 0xb8, 0x34, 0xa6, 0xff, 0xcb, 0x4e, 0x86, 0xff, 0xdd, 0x6c, 0x6e, 0xff, 0xe1, 0x7a, 0x56, 0xff, 0xee, 0x8a, 0x4a, 0xff, 0xf4, 0x93, 0x43, 0xff, 0xf6, 0xa4, 0x2e, 0xff, 0xf9, 0xb2, 0x14, 0xff, 0xfe, 0xb9, 0x06, 0xff, 0xff, 0xb5, 0x0b, 0xff, 0xfd, 0xb2, 0x0e, 0xff, 0xff, 0xb5, 0x07, 0x6b,
+    0xb3, 0x98, 0x68, 0x8b, 0xb0, 0x95, 0x66, 0xff, 0xaf, 0x94, 0x67, 0xff, 0xb7, 0x96, 0x6d, 0xff, 0xbb, 0x98, 0x72, 0xff, 0xbb, 0x95, 0x73, 0xff, 0xba, 0x95, 0x73, 0xff, 0xba, 0x94, 0x72, 0xff, 0xbb, 0x93, 0x6e, 0xff, 0xb8, 0x92, 0x6c, 0xff, 0xb8, 0x96, 0x6d, 0xff, 0xb5, 0x99, 0x6c, 0xff, 0xb5, 0x9c, 0x6e, 0xff, 0xb9, 0x9c, 0x74, 0xff, 0xb8, 0x9a, 0x75, 0xff, 0xb8, 0x9b, 0x77, 0xff, 0xb5, 0x9a, 0x74, 0xff, 0xb4, 0x92, 0x7b, 0xff, 0xb6, 0x8a, 0x8b, 0xff, 0xbe, 0x98, 0x91, 0xff, 0xa3, 0x94, 0x61, 0xff, 0x4d, 0x42, 0x1b, 0xff, 0x49, 0x3b, 0x35, 0xff, 0x42, 0x3b, 0x34, 0xff, 0x3e, 0x37, 0x2d, 0xff, 0x4b, 0x47, 0x38, 0xff, 0x47, 0x46, 0x32, 0xff, 0x3a, 0x36, 0x29, 0xff, 0x2c, 0x25, 0x1f, 0xff, 0x2e, 0x24, 0x25, 0xff, 0x44, 0x3d, 0x39, 0xff, 0x38, 0x37, 0x29, 0xff, 0x20, 0x21, 0x13, 0xff, 0x1f, 0x1e, 0x15, 0xff, 0x29, 0x26, 0x1f, 0xff, 0x45, 0x43, 0x3a, 0xff, 0x25, 0x26, 0x1c, 0xff, 0x18, 0x18, 0x10, 0xff, 0x3d, 0x3b, 0x37, 0xff, 0x28, 0x24, 0x1e, 0xff, 0x2b, 0x2a, 0x23, 0xff, 0x28, 0x29, 0x22, 0xff, 0x28, 0x28, 0x22, 0xff, 0x2b, 0x2a, 0x23, 0xff, 0x26, 0x25, 0x1d, 0xff, 0x35, 0x33, 0x2a, 0xff, 0x32, 0x2b, 0x22, 0xff, 0x3b, 0x33, 0x2a, 0xff, 0x35, 0x35, 0x2b, 0xff, 0x3c, 0x3b, 0x2b, 0xff, 0x21, 0x0b, 0x15, 0xff, 0x3a, 0x42, 0x76, 0xff, 0xbc, 0xf0, 0xff, 0xff, 0xc1, 0xe7, 0xff, 0xff, 0xc7, 0xea, 0xfd, 0xff, 0xda, 0xe7, 0xfe, 0xff, 0xcc, 0xe8, 0xff, 0xff, 0xc4, 0xe1, 0xff, 0xff, 0xba, 0xdd, 0xfd, 0xff, 0xb2, 0xd9, 0xff, 0xff, 0xae, 0xd9, 0xff, 0xff, 0xb2, 0xdd, 0xff, 0xff, 0xb1, 0xdb, 0xfd, 0xff, 0xaf, 0xdb, 0xf7, 0xff, 0xb7, 0xdc, 0xf8, 0xff, 0xc1, 0xdd, 0xf7, 0xff, 0xc7, 0xe4, 0xfe, 0xff, 0xbb, 0xdb, 0xff, 0xff, 0x99, 0xc0, 0xef, 0xff, 0x88, 0xba, 0xe9, 0xff, 0x81, 0xba, 0xec, 0xff, 0x8d, 0xc0, 0xf6, 0xff, 0x91, 0xc1, 0xf6, 0xff, 0x8b, 0xbc, 0xec, 0xff, 0xa1, 0xcc, 0xf4, 0xff, 0xbc, 0xe2, 0xfa, 0xff, 0xc7, 0xe7, 0xff, 0xff, 0xb0, 0xd1, 0xf6, 0xff, 0x93, 0xb8, 0xe8, 0xff, 0x81, 0xa8, 0xea, 0xff, 0x84, 0xab, 0xf1, 0xff, 0x9e, 0xc3, 0xf2, 0xff, 0xae, 0xd0, 0xf9, 0xff, 0xb2, 0xd0, 0xfa, 0xff, 0xb6, 0xd2, 0xfa, 0xff, 0xb4, 0xd2, 0xff, 0xff, 0xac, 0xce, 0xfd, 0xff, 0xa4, 0xcb, 0xf9, 0xff, 0x99, 0xc3, 0xf9, 0xff, 0x8f, 0xba, 0xfb, 0xff, 0x8e, 0xb6, 0xf6, 0xff, 0x89, 0xb6, 0xff, 0xff, 0x57, 0x90, 0xe8, 0xff, 0x31, 0x24, 0x53, 0xff, 0xf1, 0x8f, 0x97, 0xff, 0xff, 0x8f, 0xa5, 0xff, 0xf6, 0x7a, 0xae, 0xff, 0xec, 0x71, 0xb4, 0xff, 0xed, 0x6b, 0xb0, 0xff, 0xea, 0x67, 0xb4, 0xff, 0xe4, 0x61, 0xb9, 0xff, 0xde, 0x5a, 0xc0, 0xff, 0xd4, 0x51, 0xca, 0xff, 0xca, 0x49, 0xd5, 0xff, 0xba, 0x3e, 0xd7, 0xff, 0xad, 0x37, 0xdf, 0xff, 0xab, 0x34, 0xe5, 0xff, 0xab, 0x2f, 0xe4, 0xff, 0xa7, 0x2e, 0xe8, 0xff, 0xa6, 0x31, 0xe8, 0xff, 0xa6, 0x32, 0xe6, 0xff, 0xa5, 0x31, 0xe6, 0xff, 0xa1, 0x31, 0xe5, 0xff, 0x9c, 0x2b, 0xe2, 0xff, 0xa0, 0x28, 0xe1, 0xff, 0xa6, 0x27, 0xcb, 0xff, 0xb1, 0x2f, 0xa2, 0xff, 0xd2, 0x5a, 0x88, 0xff, 0xdd, 0x71, 0x6c, 0xff, 0xe3, 0x79, 0x5b, 0xff, 0xed, 0x86, 0x4e, 0xff, 0xf3, 0x92, 0x40, 0xff, 0xf6, 0xa4, 0x2b, 0xff, 0xfc, 0xb2, 0x17, 0xff, 0xff, 0xba, 0x08, 0xff, 0xff, 0xb7, 0x0d, 0xff, 0xfe, 0xb3, 0x11, 0xff, 0xfd, 0xb5, 0x09, 0x8b,
+    0xb7, 0x9a, 0x6f, 0xaa, 0xb6, 0x99, 0x6c, 0xff, 0xb4, 0x97, 0x6c, 0xff, 0xb9, 0x99, 0x74, 0xff, 0xbf, 0x9c, 0x79, 0xff, 0xbf, 0x9b, 0x78, 0xff, 0xbf, 0x9a, 0x74, 0xff, 0xbe, 0x99, 0x72, 0xff, 0xbf, 0x96, 0x75, 0xff, 0xbb, 0x95, 0x72, 0xff, 0xb8, 0x98, 0x70, 0xff, 0xb9, 0x9b, 0x71, 0xff, 0xb9, 0x9f, 0x71, 0xff, 0xba, 0x9e, 0x77, 0xff, 0xb9, 0x9c, 0x78, 0xff, 0xb8, 0x9a, 0x77, 0xff, 0xb7, 0x9b, 0x75, 0xff, 0xb2, 0x91, 0x7c, 0xff, 0xb4, 0x86, 0x87, 0xff, 0xcc, 0xa5, 0x95, 0xff, 0x8c, 0x78, 0x4e, 0xff, 0x3f, 0x37, 0x14, 0xff, 0x4b, 0x41, 0x2f, 0xff, 0x4b, 0x3d, 0x37, 0xff, 0x48, 0x3d, 0x34, 0xff, 0x46, 0x40, 0x30, 0xff, 0x49, 0x44, 0x35, 0xff, 0x3f, 0x3c, 0x2c, 0xff, 0x1b, 0x16, 0x0d, 0xff, 0x11, 0x0d, 0x0b, 0xff, 0x30, 0x2d, 0x2a, 0xff, 0x39, 0x37, 0x2e, 0xff, 0x1d, 0x1b, 0x11, 0xff, 0x21, 0x1e, 0x17, 0xff, 0x1f, 0x1c, 0x18, 0xff, 0x40, 0x3e, 0x37, 0xff, 0x3e, 0x3d, 0x33, 0xff, 0x0e, 0x0c, 0x02, 0xff, 0x36, 0x33, 0x2b, 0xff, 0x2b, 0x2a, 0x21, 0xff, 0x23, 0x24, 0x1a, 0xff, 0x27, 0x28, 0x20, 0xff, 0x29, 0x29, 0x23, 0xff, 0x29, 0x27, 0x22, 0xff, 0x2a, 0x27, 0x23, 0xff, 0x3f, 0x3a, 0x34, 0xff, 0x33, 0x2e, 0x24, 0xff, 0x2f, 0x2e, 0x23, 0xff, 0x38, 0x38, 0x2e, 0xff, 0x35, 0x31, 0x1f, 0xff, 0x1c, 0x0c, 0x15, 0xff, 0x5f, 0x6e, 0x9e, 0xff, 0xbb, 0xf0, 0xff, 0xff, 0xb4, 0xda, 0xfb, 0xff, 0xbd, 0xdf, 0xfb, 0xff, 0xd1, 0xe3, 0xfc, 0xff, 0xce, 0xe6, 0xff, 0xff, 0xc2, 0xdd, 0xfe, 0xff, 0xb1, 0xd1, 0xf3, 0xff, 0xaa, 0xcb, 0xf0, 0xff, 0xaa, 0xcf, 0xf7, 0xff, 0xab, 0xd3, 0xfb, 0xff, 0xad, 0xd7, 0xfa, 0xff, 0xb1, 0xd9, 0xfd, 0xff, 0xba, 0xdc, 0xfc, 0xff, 0xc5, 0xde, 0xfa, 0xff, 0xca, 0xe2, 0xff, 0xff, 0xbf, 0xdc, 0xff, 0xff, 0x95, 0xbe, 0xec, 0xff, 0x80, 0xb5, 0xe9, 0xff, 0x7c, 0xb6, 0xee, 0xff, 0x7c, 0xb6, 0xf4, 0xff, 0x86, 0xbc, 0xfa, 0xff, 0x8d, 0xbf, 0xf4, 0xff, 0x9e, 0xc8, 0xf6, 0xff, 0xbb, 0xdc, 0xfb, 0xff, 0xcc, 0xe8, 0xff, 0xff, 0xb8, 0xd9, 0xf9, 0xff, 0x9a, 0xbe, 0xed, 0xff, 0x7f, 0xab, 0xe9, 0xff, 0x79, 0xab, 0xed, 0xff, 0x92, 0xbe, 0xf3, 0xff, 0xa8, 0xcf, 0xfc, 0xff, 0xb1, 0xd4, 0xff, 0xff, 0xb9, 0xd5, 0xfd, 0xff, 0xbb, 0xd6, 0xfe, 0xff, 0xb3, 0xd0, 0xff, 0xff, 0xa5, 0xca, 0xfa, 0xff, 0x94, 0xc2, 0xf5, 0xff, 0x8d, 0xb9, 0xf8, 0xff, 0x90, 0xb5, 0xf8, 0xff, 0x87, 0xb4, 0xfe, 0xff, 0x5c, 0x96, 0xf0, 0xff, 0x35, 0x2f, 0x57, 0xff, 0xe2, 0x87, 0x88, 0xff, 0xff, 0x8c, 0x9a, 0xff, 0xf8, 0x7c, 0xa6, 0xff, 0xee, 0x73, 0xb2, 0xff, 0xeb, 0x6e, 0xac, 0xff, 0xe9, 0x65, 0xb4, 0xff, 0xe6, 0x5c, 0xba, 0xff, 0xe1, 0x58, 0xc1, 0xff, 0xd7, 0x50, 0xca, 0xff, 0xcc, 0x49, 0xd6, 0xff, 0xbf, 0x3f, 0xdd, 0xff, 0xae, 0x36, 0xdf, 0xff, 0xa3, 0x2b, 0xe5, 0xff, 0xa0, 0x26, 0xe8, 0xff, 0x9e, 0x25, 0xe9, 0xff, 0x9c, 0x27, 0xe9, 0xff, 0x9b, 0x26, 0xe5, 0xff, 0x9f, 0x2b, 0xe7, 0xff, 0x9a, 0x2c, 0xe7, 0xff, 0x91, 0x21, 0xe2, 0xff, 0x95, 0x1f, 0xe2, 0xff, 0x9c, 0x1d, 0xcc, 0xff, 0xb8, 0x31, 0xb0, 0xff, 0xdb, 0x5d, 0x95, 0xff, 0xdf, 0x6c, 0x75, 0xff, 0xe3, 0x73, 0x61, 0xff, 0xec, 0x80, 0x55, 0xff, 0xf3, 0x92, 0x42, 0xff, 0xf5, 0xa1, 0x2b, 0xff, 0xfa, 0xad, 0x15, 0xff, 0xff, 0xb7, 0x06, 0xff, 0xff, 0xb5, 0x0c, 0xff, 0xfc, 0xb4, 0x12, 0xff, 0xfa, 0xb4, 0x0b, 0xab,
+    0xb7, 0x9b, 0x72, 0xbe, 0xb9, 0x9b, 0x72, 0xff, 0xb9, 0x9b, 0x73, 0xff, 0xbf, 0x9e, 0x78, 0xff, 0xc3, 0xa0, 0x7d, 0xff, 0xc4, 0xa0, 0x7c, 0xff, 0xc4, 0xa0, 0x78, 0xff, 0xc1, 0x9e, 0x75, 0xff, 0xc1, 0x9a, 0x75, 0xff, 0xc0, 0x9a, 0x74, 0xff, 0xbd, 0x9c, 0x74, 0xff, 0xbc, 0x9d, 0x75, 0xff, 0xbc, 0x9f, 0x76, 0xff, 0xbb, 0x9e, 0x78, 0xff, 0xba, 0x9d, 0x78, 0xff, 0xbc, 0x9c, 0x79, 0xff, 0xbd, 0x9e, 0x79, 0xff, 0xb9, 0x94, 0x7d, 0xff, 0xb7, 0x8a, 0x83, 0xff, 0xc4, 0xa2, 0x8c, 0xff, 0x6b, 0x58, 0x39, 0xff, 0x3e, 0x3b, 0x16, 0xff, 0x47, 0x46, 0x25, 0xff, 0x4c, 0x43, 0x34, 0xff, 0x4c, 0x41, 0x3a, 0xff, 0x41, 0x37, 0x2d, 0xff, 0x40, 0x3a, 0x2a, 0xff, 0x36, 0x31, 0x24, 0xff, 0x1a, 0x17, 0x0f, 0xff, 0x0d, 0x08, 0x08, 0xff, 0x20, 0x1c, 0x1a, 0xff, 0x3f, 0x3d, 0x34, 0xff, 0x27, 0x26, 0x1c, 0xff, 0x18, 0x16, 0x10, 0xff, 0x18, 0x15, 0x11, 0xff, 0x33, 0x30, 0x2b, 0xff, 0x4a, 0x49, 0x41, 0xff, 0x14, 0x12, 0x09, 0xff, 0x34, 0x31, 0x29, 0xff, 0x39, 0x37, 0x2e, 0xff, 0x1c, 0x1c, 0x12, 0xff, 0x25, 0x26, 0x1e, 0xff, 0x2d, 0x2e, 0x28, 0xff, 0x31, 0x2f, 0x2a, 0xff, 0x2e, 0x2a, 0x26, 0xff, 0x35, 0x31, 0x2b, 0xff, 0x32, 0x2f, 0x25, 0xff, 0x37, 0x35, 0x2b, 0xff, 0x2f, 0x2e, 0x25, 0xff, 0x2c, 0x26, 0x17, 0xff, 0x17, 0x10, 0x1a, 0xff, 0x73, 0x90, 0xc4, 0xff, 0xb4, 0xe6, 0xff, 0xff, 0xa6, 0xce, 0xf7, 0xff, 0xb1, 0xd4, 0xf4, 0xff, 0xc6, 0xda, 0xf9, 0xff, 0xce, 0xe6, 0xff, 0xff, 0xd0, 0xe7, 0xff, 0xff, 0xc6, 0xdf, 0xfb, 0xff, 0xb9, 0xd5, 0xf3, 0xff, 0xb2, 0xd2, 0xf3, 0xff, 0xb2, 0xd4, 0xf8, 0xff, 0xb1, 0xd5, 0xf7, 0xff, 0xaf, 0xd4, 0xf8, 0xff, 0xb5, 0xd7, 0xf8, 0xff, 0xbe, 0xda, 0xf5, 0xff, 0xc2, 0xdf, 0xfb, 0xff, 0xb9, 0xda, 0xff, 0xff, 0x99, 0xc3, 0xf7, 0xff, 0x83, 0xb7, 0xf5, 0xff, 0x77, 0xb5, 0xf3, 0xff, 0x70, 0xad, 0xf0, 0xff, 0x75, 0xad, 0xef, 0xff, 0x85, 0xbb, 0xf4, 0xff, 0xa3, 0xcd, 0xf9, 0xff, 0xc2, 0xe1, 0xfa, 0xff, 0xcf, 0xe9, 0xfc, 0xff, 0xc6, 0xe3, 0xfe, 0xff, 0xa1, 0xc7, 0xf2, 0xff, 0x83, 0xb2, 0xec, 0xff, 0x78, 0xa9, 0xec, 0xff, 0x88, 0xb9, 0xf6, 0xff, 0x9a, 0xc6, 0xfc, 0xff, 0xad, 0xd2, 0xff, 0xff, 0xb9, 0xd6, 0xfb, 0xff, 0xbf, 0xd7, 0xf6, 0xff, 0xb1, 0xcf, 0xf8, 0xff, 0x9e, 0xc6, 0xf7, 0xff, 0x93, 0xc0, 0xf7, 0xff, 0x90, 0xbd, 0xfc, 0xff, 0x90, 0xb8, 0xf7, 0xff, 0x80, 0xb0, 0xf8, 0xff, 0x6c, 0xa9, 0xff, 0xff, 0x40, 0x3b, 0x60, 0xff, 0xd1, 0x76, 0x74, 0xff, 0xff, 0x94, 0x98, 0xff, 0xf4, 0x7c, 0x99, 0xff, 0xed, 0x74, 0xa9, 0xff, 0xed, 0x70, 0xaa, 0xff, 0xe9, 0x65, 0xb1, 0xff, 0xe7, 0x5d, 0xb8, 0xff, 0xe2, 0x58, 0xc1, 0xff, 0xd8, 0x51, 0xc9, 0xff, 0xcc, 0x47, 0xd3, 0xff, 0xbf, 0x3c, 0xdf, 0xff, 0xb1, 0x32, 0xe7, 0xff, 0xa4, 0x24, 0xec, 0xff, 0x9d, 0x1e, 0xec, 0xff, 0x9a, 0x1c, 0xec, 0xff, 0x98, 0x1e, 0xed, 0xff, 0x98, 0x21, 0xec, 0xff, 0x98, 0x25, 0xed, 0xff, 0x92, 0x22, 0xed, 0xff, 0x8a, 0x1b, 0xe6, 0xff, 0x8a, 0x16, 0xdf, 0xff, 0x9b, 0x1c, 0xd4, 0xff, 0xbc, 0x36, 0xbf, 0xff, 0xd5, 0x55, 0x9a, 0xff, 0xdf, 0x68, 0x7d, 0xff, 0xe3, 0x6f, 0x68, 0xff, 0xec, 0x7c, 0x58, 0xff, 0xf2, 0x8b, 0x48, 0xff, 0xf3, 0x9a, 0x32, 0xff, 0xf8, 0xa8, 0x16, 0xff, 0xff, 0xb3, 0x07, 0xff, 0xff, 0xb3, 0x0c, 0xff, 0xfd, 0xb3, 0x12, 0xff, 0xfd, 0xb5, 0x0c, 0xbe,
+    0xb7, 0x9d, 0x76, 0xd3, 0xbb, 0x9a, 0x77, 0xff, 0xbc, 0x9b, 0x78, 0xff, 0xc2, 0xa0, 0x7c, 0xff, 0xc4, 0xa1, 0x7e, 0xff, 0xc6, 0xa3, 0x7c, 0xff, 0xc6, 0xa3, 0x78, 0xff, 0xc4, 0xa1, 0x75, 0xff, 0xc4, 0x9c, 0x76, 0xff, 0xc0, 0x9c, 0x75, 0xff, 0xbd, 0x9b, 0x74, 0xff, 0xbc, 0x9c, 0x76, 0xff, 0xbb, 0x9e, 0x79, 0xff, 0xbb, 0x9e, 0x7a, 0xff, 0xb9, 0x9c, 0x77, 0xff, 0xbc, 0x99, 0x77, 0xff, 0xbe, 0x98, 0x75, 0xff, 0xb8, 0x8e, 0x77, 0xff, 0xc1, 0x94, 0x85, 0xff, 0xad, 0x8d, 0x70, 0xff, 0x51, 0x41, 0x2b, 0xff, 0x43, 0x40, 0x27, 0xff, 0x47, 0x47, 0x24, 0xff, 0x4b, 0x44, 0x30, 0xff, 0x49, 0x3d, 0x37, 0xff, 0x46, 0x3a, 0x32, 0xff, 0x42, 0x39, 0x2a, 0xff, 0x2b, 0x26, 0x1a, 0xff, 0x18, 0x16, 0x10, 0xff, 0x0f, 0x0d, 0x0d, 0xff, 0x13, 0x11, 0x10, 0xff, 0x36, 0x36, 0x2e, 0xff, 0x36, 0x37, 0x2e, 0xff, 0x15, 0x14, 0x0f, 0xff, 0x12, 0x0f, 0x0c, 0xff, 0x25, 0x22, 0x1e, 0xff, 0x4d, 0x49, 0x45, 0xff, 0x20, 0x1d, 0x15, 0xff, 0x23, 0x21, 0x16, 0xff, 0x43, 0x41, 0x37, 0xff, 0x1b, 0x1b, 0x10, 0xff, 0x23, 0x24, 0x1b, 0xff, 0x27, 0x27, 0x22, 0xff, 0x28, 0x25, 0x20, 0xff, 0x27, 0x23, 0x1e, 0xff, 0x2e, 0x2a, 0x23, 0xff, 0x2d, 0x2b, 0x23, 0xff, 0x2f, 0x2c, 0x24, 0xff, 0x2e, 0x2a, 0x22, 0xff, 0x35, 0x2a, 0x1c, 0xff, 0x14, 0x16, 0x22, 0xff, 0x72, 0x9e, 0xd3, 0xff, 0xa4, 0xd4, 0xff, 0xff, 0x9d, 0xc5, 0xf9, 0xff, 0xa3, 0xc9, 0xf4, 0xff, 0xb8, 0xce, 0xf9, 0xff, 0xc4, 0xde, 0xfe, 0xff, 0xd0, 0xe4, 0xfc, 0xff, 0xcf, 0xe5, 0xfe, 0xff, 0xc5, 0xe0, 0xfb, 0xff, 0xbb, 0xd8, 0xf8, 0xff, 0xb8, 0xd7, 0xf9, 0xff, 0xb0, 0xd0, 0xf8, 0xff, 0xa8, 0xcb, 0xf5, 0xff, 0xab, 0xcf, 0xf6, 0xff, 0xaf, 0xd0, 0xf2, 0xff, 0xb8, 0xd7, 0xfb, 0xff, 0xb2, 0xd2, 0xff, 0xff, 0x99, 0xc6, 0xfd, 0xff, 0x7a, 0xb2, 0xf1, 0xff, 0x64, 0xa4, 0xe7, 0xff, 0x64, 0xa4, 0xea, 0xff, 0x6f, 0xaa, 0xeb, 0xff, 0x87, 0xbc, 0xf4, 0xff, 0xa7, 0xd0, 0xf9, 0xff, 0xca, 0xe7, 0xfc, 0xff, 0xd7, 0xee, 0xfa, 0xff, 0xd8, 0xef, 0xff, 0xff, 0xb6, 0xd9, 0xf9, 0xff, 0x92, 0xbe, 0xee, 0xff, 0x6f, 0x9e, 0xdc, 0xff, 0x74, 0xa8, 0xe8, 0xff, 0x92, 0xc2, 0xff, 0xff, 0xa2, 0xca, 0xfe, 0xff, 0xaf, 0xd0, 0xf8, 0xff, 0xb6, 0xd4, 0xf4, 0xff, 0xaf, 0xcf, 0xf5, 0xff, 0x9f, 0xc6, 0xf7, 0xff, 0x93, 0xc1, 0xfb, 0xff, 0x8d, 0xbc, 0xfa, 0xff, 0x8e, 0xb8, 0xf4, 0xff, 0x80, 0xb2, 0xf7, 0xff, 0x79, 0xb9, 0xff, 0xff, 0x3e, 0x39, 0x5f, 0xff, 0xb6, 0x5c, 0x56, 0xff, 0xff, 0x9c, 0x94, 0xff, 0xf3, 0x7f, 0x8e, 0xff, 0xef, 0x7a, 0xa3, 0xff, 0xef, 0x72, 0xa6, 0xff, 0xe9, 0x64, 0xad, 0xff, 0xe8, 0x5e, 0xb6, 0xff, 0xe3, 0x59, 0xc0, 0xff, 0xd8, 0x50, 0xca, 0xff, 0xcc, 0x43, 0xd6, 0xff, 0xc0, 0x39, 0xe2, 0xff, 0xb3, 0x2f, 0xea, 0xff, 0xa6, 0x22, 0xf0, 0xff, 0xa1, 0x1f, 0xf1, 0xff, 0x9b, 0x1b, 0xef, 0xff, 0x97, 0x1d, 0xf0, 0xff, 0x96, 0x21, 0xee, 0xff, 0x91, 0x22, 0xed, 0xff, 0x8a, 0x1e, 0xee, 0xff, 0x84, 0x1a, 0xe6, 0xff, 0x86, 0x18, 0xdf, 0xff, 0x9c, 0x1f, 0xde, 0xff, 0xb7, 0x32, 0xc2, 0xff, 0xcf, 0x4e, 0x9a, 0xff, 0xe1, 0x66, 0x87, 0xff, 0xe5, 0x6d, 0x6d, 0xff, 0xee, 0x7c, 0x59, 0xff, 0xf1, 0x87, 0x48, 0xff, 0xf1, 0x94, 0x34, 0xff, 0xf7, 0xa3, 0x18, 0xff, 0xfe, 0xae, 0x08, 0xff, 0xff, 0xb2, 0x0f, 0xff, 0xfe, 0xb2, 0x13, 0xff, 0xfb, 0xb0, 0x0a, 0xd3,
+    0xb9, 0xa0, 0x7a, 0xe7, 0xbb, 0x9c, 0x77, 0xff, 0xbf, 0x9d, 0x79, 0xff, 0xc4, 0xa2, 0x7e, 0xff, 0xc7, 0xa4, 0x80, 0xff, 0xc8, 0xa6, 0x7e, 0xff, 0xc8, 0xa6, 0x7a, 0xff, 0xc6, 0xa4, 0x77, 0xff, 0xc6, 0xa1, 0x77, 0xff, 0xc2, 0x9e, 0x76, 0xff, 0xbe, 0x9c, 0x75, 0xff, 0xbb, 0x9b, 0x75, 0xff, 0xb9, 0x9b, 0x78, 0xff, 0xba, 0x9d, 0x78, 0xff, 0xb9, 0x9c, 0x76, 0xff, 0xb9, 0x98, 0x74, 0xff, 0xbb, 0x96, 0x72, 0xff, 0xb6, 0x8e, 0x70, 0xff, 0xc1, 0x96, 0x83, 0xff, 0x8e, 0x71, 0x54, 0xff, 0x3e, 0x30, 0x20, 0xff, 0x45, 0x41, 0x33, 0xff, 0x45, 0x47, 0x2a, 0xff, 0x4a, 0x45, 0x32, 0xff, 0x45, 0x3b, 0x32, 0xff, 0x41, 0x36, 0x2f, 0xff, 0x3f, 0x37, 0x2b, 0xff, 0x2c, 0x27, 0x1b, 0xff, 0x1e, 0x1a, 0x15, 0xff, 0x14, 0x11, 0x12, 0xff, 0x0e, 0x0d, 0x0b, 0xff, 0x27, 0x28, 0x20, 0xff, 0x43, 0x46, 0x3d, 0xff, 0x1e, 0x1d, 0x19, 0xff, 0x12, 0x0e, 0x0b, 0xff, 0x14, 0x11, 0x0d, 0xff, 0x36, 0x33, 0x2f, 0xff, 0x2c, 0x2a, 0x24, 0xff, 0x13, 0x12, 0x08, 0xff, 0x3d, 0x3d, 0x33, 0xff, 0x1e, 0x1f, 0x15, 0xff, 0x1d, 0x1d, 0x15, 0xff, 0x26, 0x26, 0x21, 0xff, 0x29, 0x28, 0x22, 0xff, 0x23, 0x20, 0x1c, 0xff, 0x24, 0x21, 0x1c, 0xff, 0x24, 0x24, 0x1b, 0xff, 0x29, 0x28, 0x20, 0xff, 0x33, 0x2e, 0x27, 0xff, 0x2d, 0x1e, 0x12, 0xff, 0x1e, 0x26, 0x33, 0xff, 0x76, 0xab, 0xe6, 0xff, 0x97, 0xc6, 0xff, 0xff, 0x94, 0xbf, 0xfb, 0xff, 0x94, 0xc3, 0xf6, 0xff, 0xa6, 0xc8, 0xfa, 0xff, 0xb7, 0xd6, 0xfc, 0xff, 0xc9, 0xdf, 0xfb, 0xff, 0xcf, 0xe4, 0xff, 0xff, 0xcb, 0xe2, 0xff, 0xff, 0xc0, 0xd9, 0xfa, 0xff, 0xb9, 0xd5, 0xfa, 0xff, 0xac, 0xcd, 0xfa, 0xff, 0xa0, 0xc5, 0xf5, 0xff, 0xa1, 0xc8, 0xf8, 0xff, 0xa3, 0xcb, 0xf7, 0xff, 0xae, 0xcf, 0xfc, 0xff, 0xab, 0xd0, 0xff, 0xff, 0x7f, 0xae, 0xe9, 0xff, 0x59, 0x94, 0xd1, 0xff, 0x5d, 0x9d, 0xd8, 0xff, 0x6b, 0xa8, 0xeb, 0xff, 0x78, 0xaf, 0xee, 0xff, 0x8b, 0xba, 0xed, 0xff, 0xa9, 0xd1, 0xf6, 0xff, 0xd1, 0xef, 0xff, 0xff, 0xda, 0xf2, 0xfa, 0xff, 0xd1, 0xec, 0xfb, 0xff, 0xbb, 0xdf, 0xfb, 0xff, 0xac, 0xd4, 0xfd, 0xff, 0x83, 0xaf, 0xe5, 0xff, 0x5a, 0x8a, 0xcb, 0xff, 0x7e, 0xb0, 0xee, 0xff, 0x9b, 0xc8, 0xfe, 0xff, 0xa2, 0xc9, 0xf7, 0xff, 0xa6, 0xcc, 0xf7, 0xff, 0xa2, 0xc8, 0xf4, 0xff, 0x9b, 0xc4, 0xf5, 0xff, 0x91, 0xbf, 0xfa, 0xff, 0x87, 0xb8, 0xf7, 0xff, 0x86, 0xb6, 0xf3, 0xff, 0x81, 0xb5, 0xf7, 0xff, 0x7e, 0xbd, 0xff, 0xff, 0x3d, 0x36, 0x5e, 0xff, 0xa7, 0x4e, 0x43, 0xff, 0xff, 0xa2, 0x91, 0xff, 0xf5, 0x82, 0x85, 0xff, 0xef, 0x78, 0x99, 0xff, 0xec, 0x72, 0xa2, 0xff, 0xe9, 0x66, 0xab, 0xff, 0xe8, 0x5e, 0xb5, 0xff, 0xe5, 0x59, 0xc0, 0xff, 0xdd, 0x4f, 0xcd, 0xff, 0xcf, 0x3d, 0xd8, 0xff, 0xc1, 0x34, 0xe4, 0xff, 0xb2, 0x2d, 0xe8, 0xff, 0xa7, 0x22, 0xec, 0xff, 0xa3, 0x20, 0xed, 0xff, 0x99, 0x1c, 0xec, 0xff, 0x99, 0x21, 0xf1, 0xff, 0x95, 0x24, 0xee, 0xff, 0x8c, 0x22, 0xeb, 0xff, 0x88, 0x1e, 0xee, 0xff, 0x83, 0x1d, 0xe5, 0xff, 0x84, 0x1c, 0xdd, 0xff, 0x99, 0x20, 0xdb, 0xff, 0xb4, 0x31, 0xc1, 0xff, 0xca, 0x48, 0x9b, 0xff, 0xdd, 0x61, 0x88, 0xff, 0xe3, 0x68, 0x6f, 0xff, 0xec, 0x79, 0x59, 0xff, 0xf0, 0x85, 0x49, 0xff, 0xf2, 0x91, 0x36, 0xff, 0xf6, 0x9f, 0x19, 0xff, 0xfc, 0xab, 0x09, 0xff, 0xff, 0xaf, 0x0e, 0xff, 0xfc, 0xaf, 0x11, 0xff, 0xfa, 0xaf, 0x08, 0xe6,
+    0xb8, 0x9f, 0x75, 0xf0, 0xbc, 0x9e, 0x74, 0xff, 0xbf, 0x9e, 0x76, 0xff, 0xc3, 0xa1, 0x7b, 0xff, 0xca, 0xa5, 0x82, 0xff, 0xcb, 0xa7, 0x82, 0xff, 0xc9, 0xa6, 0x7e, 0xff, 0xc6, 0xa4, 0x78, 0xff, 0xc3, 0xa3, 0x74, 0xff, 0xc0, 0x9e, 0x74, 0xff, 0xbd, 0x9b, 0x73, 0xff, 0xba, 0x9a, 0x73, 0xff, 0xb8, 0x9b, 0x75, 0xff, 0xb8, 0x9c, 0x76, 0xff, 0xb9, 0x9d, 0x72, 0xff, 0xb8, 0x99, 0x70, 0xff, 0xb7, 0x93, 0x71, 0xff, 0xb4, 0x90, 0x6a, 0xff, 0xb7, 0x96, 0x71, 0xff, 0x70, 0x57, 0x42, 0xff, 0x3d, 0x31, 0x2b, 0xff, 0x3d, 0x40, 0x33, 0xff, 0x3c, 0x41, 0x2c, 0xff, 0x49, 0x46, 0x3a, 0xff, 0x47, 0x3e, 0x37, 0xff, 0x44, 0x3b, 0x34, 0xff, 0x3d, 0x37, 0x2d, 0xff, 0x2c, 0x27, 0x1c, 0xff, 0x21, 0x19, 0x15, 0xff, 0x19, 0x13, 0x13, 0xff, 0x10, 0x0c, 0x0b, 0xff, 0x12, 0x11, 0x0b, 0xff, 0x37, 0x3a, 0x2e, 0xff, 0x32, 0x32, 0x29, 0xff, 0x15, 0x12, 0x0d, 0xff, 0x0f, 0x0d, 0x07, 0xff, 0x28, 0x24, 0x20, 0xff, 0x37, 0x36, 0x2f, 0xff, 0x09, 0x0c, 0x01, 0xff, 0x32, 0x33, 0x2b, 0xff, 0x2c, 0x2e, 0x24, 0xff, 0x17, 0x17, 0x10, 0xff, 0x22, 0x22, 0x1c, 0xff, 0x24, 0x24, 0x1f, 0xff, 0x24, 0x23, 0x1f, 0xff, 0x25, 0x24, 0x20, 0xff, 0x1e, 0x1e, 0x1b, 0xff, 0x23, 0x22, 0x1f, 0xff, 0x31, 0x2b, 0x29, 0xff, 0x24, 0x13, 0x0a, 0xff, 0x1c, 0x2c, 0x3a, 0xff, 0x72, 0xb1, 0xf3, 0xff, 0x8c, 0xbd, 0xff, 0xff, 0x8c, 0xbb, 0xfd, 0xff, 0x88, 0xbf, 0xf8, 0xff, 0x91, 0xc5, 0xf6, 0xff, 0xa7, 0xce, 0xf7, 0xff, 0xbc, 0xda, 0xfc, 0xff, 0xc4, 0xe1, 0xff, 0xff, 0xc4, 0xe0, 0xfe, 0xff, 0xbe, 0xdb, 0xfb, 0xff, 0xb5, 0xd5, 0xfb, 0xff, 0xaa, 0xcd, 0xf8, 0xff, 0xa0, 0xc6, 0xf9, 0xff, 0x9a, 0xc6, 0xfd, 0xff, 0x96, 0xc6, 0xfa, 0xff, 0x99, 0xc1, 0xfa, 0xff, 0x7b, 0xa8, 0xdf, 0xff, 0x51, 0x83, 0xc3, 0xff, 0x6d, 0xa6, 0xdd, 0xff, 0x8c, 0xca, 0xfb, 0xff, 0x95, 0xcc, 0xff, 0xff, 0x90, 0xc2, 0xf6, 0xff, 0x8b, 0xbe, 0xf0, 0xff, 0xa4, 0xd0, 0xf9, 0xff, 0xc5, 0xea, 0xff, 0xff, 0xcc, 0xee, 0xfd, 0xff, 0xb8, 0xdb, 0xf9, 0xff, 0xab, 0xd4, 0xfb, 0xff, 0xa5, 0xce, 0xf6, 0xff, 0x99, 0xc4, 0xf5, 0xff, 0x84, 0xb3, 0xf1, 0xff, 0x68, 0x9a, 0xd7, 0xff, 0x82, 0xb4, 0xeb, 0xff, 0x8f, 0xc0, 0xf4, 0xff, 0x95, 0xc5, 0xf7, 0xff, 0x93, 0xc4, 0xf9, 0xff, 0x94, 0xc2, 0xfa, 0xff, 0x8f, 0xbb, 0xf5, 0xff, 0x88, 0xba, 0xf5, 0xff, 0x86, 0xb6, 0xf5, 0xff, 0x83, 0xb5, 0xf7, 0xff, 0x78, 0xbc, 0xff, 0xff, 0x43, 0x3d, 0x68, 0xff, 0xaa, 0x4f, 0x42, 0xff, 0xff, 0xa0, 0x8d, 0xff, 0xfa, 0x82, 0x7e, 0xff, 0xf0, 0x79, 0x91, 0xff, 0xe6, 0x72, 0x9d, 0xff, 0xe9, 0x68, 0xa7, 0xff, 0xe7, 0x5d, 0xb2, 0xff, 0xe6, 0x55, 0xbf, 0xff, 0xde, 0x4c, 0xcc, 0xff, 0xcf, 0x3c, 0xd7, 0xff, 0xc3, 0x31, 0xe8, 0xff, 0xb4, 0x2b, 0xe9, 0xff, 0xad, 0x25, 0xec, 0xff, 0xa7, 0x20, 0xee, 0xff, 0x9c, 0x1a, 0xea, 0xff, 0x9b, 0x20, 0xf1, 0xff, 0x96, 0x22, 0xee, 0xff, 0x8e, 0x22, 0xed, 0xff, 0x88, 0x20, 0xef, 0xff, 0x81, 0x1d, 0xe7, 0xff, 0x87, 0x1c, 0xe3, 0xff, 0x9c, 0x23, 0xdb, 0xff, 0xb4, 0x2e, 0xc2, 0xff, 0xc5, 0x3e, 0x9b, 0xff, 0xd8, 0x5b, 0x85, 0xff, 0xe1, 0x68, 0x74, 0xff, 0xe5, 0x77, 0x5c, 0xff, 0xeb, 0x83, 0x4a, 0xff, 0xf2, 0x8f, 0x3b, 0xff, 0xf7, 0x9c, 0x1f, 0xff, 0xfb, 0xa9, 0x0b, 0xff, 0xfd, 0xad, 0x0d, 0xff, 0xf9, 0xad, 0x0e, 0xff, 0xfb, 0xae, 0x08, 0xf0,
+    0xba, 0x9e, 0x72, 0xf3, 0xbe, 0xa0, 0x76, 0xff, 0xbd, 0x9e, 0x77, 0xff, 0xbf, 0x9e, 0x79, 0xff, 0xc7, 0xa4, 0x80, 0xff, 0xc9, 0xa5, 0x81, 0xff, 0xc8, 0xa4, 0x7d, 0xff, 0xc4, 0xa2, 0x78, 0xff, 0xc2, 0xa1, 0x74, 0xff, 0xc1, 0xa0, 0x73, 0xff, 0xbd, 0x9c, 0x71, 0xff, 0xb8, 0x9a, 0x70, 0xff, 0xb9, 0x9c, 0x74, 0xff, 0xb7, 0x9d, 0x72, 0xff, 0xb7, 0x9b, 0x6d, 0xff, 0xb5, 0x94, 0x6b, 0xff, 0xb1, 0x89, 0x6c, 0xff, 0xb8, 0x91, 0x6f, 0xff, 0xa9, 0x92, 0x54, 0xff, 0x50, 0x3b, 0x2c, 0xff, 0x3a, 0x2f, 0x33, 0xff, 0x39, 0x43, 0x31, 0xff, 0x3a, 0x42, 0x37, 0xff, 0x45, 0x44, 0x3b, 0xff, 0x44, 0x3a, 0x37, 0xff, 0x41, 0x38, 0x32, 0xff, 0x3c, 0x38, 0x2c, 0xff, 0x2d, 0x2a, 0x1e, 0xff, 0x20, 0x1c, 0x15, 0xff, 0x21, 0x1a, 0x1b, 0xff, 0x1c, 0x13, 0x16, 0xff, 0x0e, 0x09, 0x04, 0xff, 0x28, 0x28, 0x1a, 0xff, 0x4a, 0x4a, 0x3d, 0xff, 0x25, 0x23, 0x1b, 0xff, 0x0d, 0x0b, 0x03, 0xff, 0x1a, 0x18, 0x0f, 0xff, 0x3b, 0x38, 0x31, 0xff, 0x14, 0x12, 0x0d, 0xff, 0x27, 0x25, 0x1f, 0xff, 0x35, 0x33, 0x2b, 0xff, 0x12, 0x11, 0x09, 0xff, 0x23, 0x23, 0x1d, 0xff, 0x21, 0x21, 0x1c, 0xff, 0x24, 0x23, 0x1e, 0xff, 0x26, 0x24, 0x21, 0xff, 0x1d, 0x1b, 0x1c, 0xff, 0x22, 0x20, 0x20, 0xff, 0x2b, 0x23, 0x24, 0xff, 0x17, 0x08, 0x00, 0xff, 0x18, 0x2f, 0x3e, 0xff, 0x6f, 0xb6, 0xfd, 0xff, 0x80, 0xb7, 0xff, 0xff, 0x86, 0xb7, 0xfe, 0xff, 0x80, 0xbb, 0xf7, 0xff, 0x86, 0xbe, 0xf3, 0xff, 0x97, 0xc5, 0xf2, 0xff, 0xaa, 0xcf, 0xf8, 0xff, 0xb1, 0xd6, 0xf9, 0xff, 0xb5, 0xd7, 0xf8, 0xff, 0xb3, 0xd6, 0xf6, 0xff, 0xac, 0xd2, 0xf7, 0xff, 0xa5, 0xc9, 0xf6, 0xff, 0x9b, 0xc4, 0xf6, 0xff, 0x8f, 0xbf, 0xf6, 0xff, 0x83, 0xb9, 0xf6, 0xff, 0x6d, 0x9e, 0xe6, 0xff, 0x50, 0x84, 0xc1, 0xff, 0x70, 0xa6, 0xe2, 0xff, 0x93, 0xce, 0xff, 0xff, 0x99, 0xd2, 0xff, 0xff, 0xb7, 0xe3, 0xff, 0xff, 0xb6, 0xe2, 0xfb, 0xff, 0x8b, 0xc8, 0xf9, 0xff, 0x8e, 0xc9, 0xf8, 0xff, 0x98, 0xcb, 0xec, 0xff, 0xa1, 0xce, 0xf0, 0xff, 0xa1, 0xcb, 0xf8, 0xff, 0x99, 0xc8, 0xf8, 0xff, 0x94, 0xc2, 0xf0, 0xff, 0x8a, 0xb7, 0xe7, 0xff, 0x93, 0xc3, 0xf8, 0xff, 0x86, 0xb6, 0xf1, 0xff, 0x64, 0x97, 0xd5, 0xff, 0x74, 0xae, 0xea, 0xff, 0x7b, 0xba, 0xf2, 0xff, 0x84, 0xbd, 0xf8, 0xff, 0x89, 0xba, 0xf5, 0xff, 0x8a, 0xb6, 0xf0, 0xff, 0x8b, 0xb9, 0xef, 0xff, 0x8e, 0xb5, 0xf0, 0xff, 0x7f, 0xb0, 0xf2, 0xff, 0x6c, 0xb8, 0xff, 0xff, 0x47, 0x44, 0x6d, 0xff, 0xb3, 0x54, 0x45, 0xff, 0xff, 0x99, 0x86, 0xff, 0xf8, 0x81, 0x7a, 0xff, 0xee, 0x7c, 0x90, 0xff, 0xe7, 0x72, 0x98, 0xff, 0xec, 0x67, 0xa3, 0xff, 0xe7, 0x5b, 0xae, 0xff, 0xe2, 0x52, 0xba, 0xff, 0xd9, 0x4a, 0xc9, 0xff, 0xcc, 0x3c, 0xd9, 0xff, 0xc6, 0x33, 0xea, 0xff, 0xb9, 0x2b, 0xeb, 0xff, 0xb1, 0x23, 0xee, 0xff, 0xac, 0x1f, 0xf0, 0xff, 0xa0, 0x19, 0xef, 0xff, 0x9a, 0x1d, 0xf1, 0xff, 0x95, 0x20, 0xee, 0xff, 0x90, 0x21, 0xef, 0xff, 0x8a, 0x1e, 0xf3, 0xff, 0x83, 0x1c, 0xed, 0xff, 0x89, 0x1c, 0xeb, 0xff, 0x9a, 0x1e, 0xe2, 0xff, 0xaf, 0x25, 0xc3, 0xff, 0xc3, 0x36, 0x9c, 0xff, 0xd5, 0x54, 0x86, 0xff, 0xdb, 0x66, 0x75, 0xff, 0xe0, 0x74, 0x5c, 0xff, 0xe5, 0x80, 0x4c, 0xff, 0xed, 0x8c, 0x3c, 0xff, 0xf6, 0x98, 0x20, 0xff, 0xf9, 0xa4, 0x0a, 0xff, 0xfe, 0xa9, 0x0c, 0xff, 0xfb, 0xab, 0x0e, 0xff, 0xf7, 0xab, 0x07, 0xf3,
+    0xb9, 0x9e, 0x74, 0xff, 0xba, 0x9e, 0x74, 0xff, 0xbb, 0x9d, 0x76, 0xff, 0xbf, 0x9e, 0x79, 0xff, 0xc6, 0xa4, 0x80, 0xff, 0xc8, 0xa5, 0x81, 0xff, 0xc7, 0xa3, 0x7e, 0xff, 0xc6, 0xa3, 0x7a, 0xff, 0xc5, 0xa3, 0x78, 0xff, 0xc2, 0xa1, 0x73, 0xff, 0xbe, 0x9e, 0x70, 0xff, 0xba, 0x9d, 0x70, 0xff, 0xb7, 0x9b, 0x71, 0xff, 0xb7, 0x9a, 0x70, 0xff, 0xb7, 0x99, 0x6b, 0xff, 0xb5, 0x94, 0x66, 0xff, 0xb1, 0x8b, 0x62, 0xff, 0xb9, 0x98, 0x6b, 0xff, 0x8d, 0x7a, 0x49, 0xff, 0x3d, 0x2e, 0x22, 0xff, 0x3c, 0x32, 0x33, 0xff, 0x3c, 0x3b, 0x33, 0xff, 0x3f, 0x3f, 0x3b, 0xff, 0x42, 0x3f, 0x39, 0xff, 0x46, 0x3f, 0x3a, 0xff, 0x47, 0x42, 0x39, 0xff, 0x3e, 0x3b, 0x2d, 0xff, 0x2a, 0x29, 0x1a, 0xff, 0x1c, 0x1b, 0x12, 0xff, 0x23, 0x1e, 0x1c, 0xff, 0x1e, 0x18, 0x16, 0xff, 0x0e, 0x0b, 0x06, 0xff, 0x13, 0x14, 0x0b, 0xff, 0x3f, 0x3e, 0x35, 0xff, 0x3f, 0x3c, 0x37, 0xff, 0x17, 0x14, 0x10, 0xff, 0x0e, 0x0b, 0x05, 0xff, 0x2b, 0x28, 0x24, 0xff, 0x25, 0x20, 0x20, 0xff, 0x13, 0x10, 0x0b, 0xff, 0x3e, 0x3b, 0x32, 0xff, 0x1c, 0x1a, 0x13, 0xff, 0x21, 0x21, 0x1b, 0xff, 0x25, 0x25, 0x20, 0xff, 0x1f, 0x1e, 0x1a, 0xff, 0x1f, 0x1e, 0x1b, 0xff, 0x1e, 0x1c, 0x1a, 0xff, 0x21, 0x1f, 0x1d, 0xff, 0x29, 0x21, 0x21, 0xff, 0x16, 0x04, 0x00, 0xff, 0x17, 0x2d, 0x39, 0xff, 0x6a, 0xb4, 0xff, 0xff, 0x72, 0xb1, 0xff, 0xff, 0x76, 0xb0, 0xf8, 0xff, 0x77, 0xb9, 0xf7, 0xff, 0x7b, 0xbb, 0xf4, 0xff, 0x87, 0xbd, 0xf1, 0xff, 0x97, 0xc3, 0xf4, 0xff, 0x9f, 0xca, 0xf6, 0xff, 0xa6, 0xcd, 0xf6, 0xff, 0xa9, 0xcd, 0xf4, 0xff, 0xa2, 0xca, 0xf5, 0xff, 0x94, 0xc3, 0xf4, 0xff, 0x8b, 0xbc, 0xf1, 0xff, 0x7d, 0xb0, 0xf0, 0xff, 0x6a, 0x9d, 0xeb, 0xff, 0x4c, 0x87, 0xc3, 0xff, 0x69, 0xaa, 0xda, 0xff, 0x82, 0xc1, 0xff, 0xff, 0x83, 0xbf, 0xff, 0xff, 0x96, 0xce, 0xfe, 0xff, 0xa6, 0xdd, 0xf7, 0xff, 0xa3, 0xdd, 0xf8, 0xff, 0x7a, 0xba, 0xf2, 0xff, 0x61, 0xa4, 0xe2, 0xff, 0x63, 0xa4, 0xde, 0xff, 0x76, 0xb2, 0xea, 0xff, 0x7d, 0xb6, 0xee, 0xff, 0x77, 0xb1, 0xeb, 0xff, 0x79, 0xac, 0xe5, 0xff, 0x5d, 0x8c, 0xc6, 0xff, 0x4c, 0x77, 0xb5, 0xff, 0x85, 0xb3, 0xf0, 0xff, 0x53, 0x8b, 0xcd, 0xff, 0x53, 0x94, 0xd9, 0xff, 0x66, 0xa7, 0xe9, 0xff, 0x6f, 0xae, 0xea, 0xff, 0x74, 0xae, 0xe9, 0xff, 0x7e, 0xb0, 0xec, 0xff, 0x7e, 0xb0, 0xed, 0xff, 0x7c, 0xae, 0xf0, 0xff, 0x71, 0xa3, 0xec, 0xff, 0x6d, 0xa8, 0xff, 0xff, 0x41, 0x3f, 0x61, 0xff, 0xb2, 0x61, 0x40, 0xff, 0xff, 0xa1, 0x7c, 0xff, 0xf7, 0x82, 0x71, 0xff, 0xef, 0x7a, 0x8a, 0xff, 0xea, 0x70, 0x95, 0xff, 0xee, 0x65, 0x9d, 0xff, 0xe9, 0x5a, 0xab, 0xff, 0xe0, 0x52, 0xb9, 0xff, 0xdd, 0x48, 0xc8, 0xff, 0xd6, 0x37, 0xd7, 0xff, 0xc7, 0x2d, 0xe6, 0xff, 0xb9, 0x27, 0xea, 0xff, 0xb0, 0x20, 0xed, 0xff, 0xab, 0x1c, 0xf0, 0xff, 0xa0, 0x1a, 0xf2, 0xff, 0x98, 0x1d, 0xf4, 0xff, 0x91, 0x1d, 0xee, 0xff, 0x8c, 0x1d, 0xef, 0xff, 0x84, 0x1a, 0xf5, 0xff, 0x7f, 0x1b, 0xf2, 0xff, 0x84, 0x1d, 0xf1, 0xff, 0x92, 0x19, 0xe1, 0xff, 0xaa, 0x22, 0xc9, 0xff, 0xc3, 0x32, 0xa9, 0xff, 0xd4, 0x4d, 0x90, 0xff, 0xdb, 0x5f, 0x7a, 0xff, 0xde, 0x6d, 0x60, 0xff, 0xe5, 0x7a, 0x50, 0xff, 0xec, 0x86, 0x40, 0xff, 0xf2, 0x92, 0x20, 0xff, 0xfa, 0xa1, 0x0d, 0xff, 0xff, 0xa6, 0x0d, 0xff, 0xfc, 0xa5, 0x0a, 0xff, 0xf9, 0xa5, 0x04, 0xff,
+    0xb5, 0x9c, 0x74, 0xff, 0xb7, 0x9c, 0x73, 0xff, 0xbb, 0x9e, 0x76, 0xff, 0xbf, 0xa0, 0x7a, 0xff, 0xc4, 0xa3, 0x80, 0xff, 0xc8, 0xa5, 0x80, 0xff, 0xc7, 0xa3, 0x7d, 0xff, 0xc5, 0xa2, 0x79, 0xff, 0xc3, 0xa0, 0x76, 0xff, 0xc0, 0x9f, 0x73, 0xff, 0xbe, 0xa0, 0x72, 0xff, 0xbb, 0x9f, 0x71, 0xff, 0xb5, 0x9b, 0x6d, 0xff, 0xb5, 0x9a, 0x6d, 0xff, 0xb8, 0x99, 0x6a, 0xff, 0xb5, 0x96, 0x5f, 0xff, 0xb2, 0x91, 0x5a, 0xff, 0xb5, 0x9b, 0x66, 0xff, 0x6b, 0x59, 0x3d, 0xff, 0x3a, 0x30, 0x23, 0xff, 0x46, 0x3e, 0x37, 0xff, 0x4c, 0x41, 0x40, 0xff, 0x4d, 0x43, 0x3e, 0xff, 0x43, 0x3d, 0x34, 0xff, 0x44, 0x43, 0x36, 0xff, 0x41, 0x3f, 0x31, 0xff, 0x3c, 0x3a, 0x2c, 0xff, 0x30, 0x2f, 0x21, 0xff, 0x1e, 0x1c, 0x13, 0xff, 0x21, 0x1f, 0x18, 0xff, 0x1b, 0x1b, 0x13, 0xff, 0x13, 0x13, 0x0e, 0xff, 0x08, 0x0a, 0x05, 0xff, 0x1d, 0x1d, 0x19, 0xff, 0x47, 0x44, 0x42, 0xff, 0x29, 0x25, 0x23, 0xff, 0x13, 0x10, 0x0e, 0xff, 0x17, 0x12, 0x12, 0xff, 0x29, 0x23, 0x24, 0xff, 0x12, 0x0d, 0x0b, 0xff, 0x3b, 0x37, 0x30, 0xff, 0x25, 0x24, 0x1c, 0xff, 0x16, 0x16, 0x0f, 0xff, 0x24, 0x23, 0x1d, 0xff, 0x22, 0x20, 0x1d, 0xff, 0x20, 0x1f, 0x1b, 0xff, 0x1c, 0x1b, 0x16, 0xff, 0x1e, 0x1e, 0x18, 0xff, 0x24, 0x20, 0x1d, 0xff, 0x1a, 0x08, 0x00, 0xff, 0x20, 0x2c, 0x38, 0xff, 0x62, 0xae, 0xfd, 0xff, 0x66, 0xae, 0xfe, 0xff, 0x67, 0xa8, 0xee, 0xff, 0x6a, 0xb0, 0xf2, 0xff, 0x76, 0xb7, 0xf4, 0xff, 0x81, 0xbc, 0xf4, 0xff, 0x8b, 0xbe, 0xf6, 0xff, 0x8c, 0xc2, 0xf8, 0xff, 0x8e, 0xc4, 0xf3, 0xff, 0x90, 0xc3, 0xf0, 0xff, 0x8b, 0xc0, 0xef, 0xff, 0x7f, 0xb7, 0xed, 0xff, 0x79, 0xb0, 0xeb, 0xff, 0x71, 0xa2, 0xee, 0xff, 0x4f, 0x7d, 0xd3, 0xff, 0x5a, 0x99, 0xc3, 0xff, 0x74, 0xb6, 0xd8, 0xff, 0x63, 0x9e, 0xe4, 0xff, 0x60, 0x9c, 0xfb, 0xff, 0x58, 0x9e, 0xea, 0xff, 0x5e, 0xaa, 0xea, 0xff, 0x54, 0xa1, 0xe8, 0xff, 0x3d, 0x82, 0xd5, 0xff, 0x1c, 0x5c, 0xb6, 0xff, 0x16, 0x53, 0xb1, 0xff, 0x32, 0x6e, 0xc6, 0xff, 0x46, 0x80, 0xce, 0xff, 0x53, 0x8d, 0xd3, 0xff, 0x48, 0x7a, 0xbf, 0xff, 0x21, 0x47, 0x90, 0xff, 0x12, 0x32, 0x85, 0xff, 0x33, 0x60, 0xa7, 0xff, 0x48, 0x81, 0xc9, 0xff, 0x30, 0x6c, 0xc3, 0xff, 0x4c, 0x88, 0xd8, 0xff, 0x5b, 0x98, 0xdb, 0xff, 0x66, 0x9e, 0xe3, 0xff, 0x6b, 0xa0, 0xe9, 0xff, 0x69, 0xa1, 0xe9, 0xff, 0x5d, 0xa0, 0xe6, 0xff, 0x60, 0x91, 0xe3, 0xff, 0x65, 0x8c, 0xea, 0xff, 0x3e, 0x39, 0x52, 0xff, 0xbd, 0x76, 0x44, 0xff, 0xff, 0xa5, 0x6f, 0xff, 0xf4, 0x83, 0x6a, 0xff, 0xf0, 0x73, 0x84, 0xff, 0xed, 0x6d, 0x91, 0xff, 0xee, 0x62, 0x98, 0xff, 0xe6, 0x58, 0xa6, 0xff, 0xdb, 0x50, 0xb5, 0xff, 0xe4, 0x45, 0xc7, 0xff, 0xe0, 0x32, 0xd5, 0xff, 0xcb, 0x29, 0xe3, 0xff, 0xbd, 0x28, 0xeb, 0xff, 0xaf, 0x20, 0xed, 0xff, 0xa6, 0x1a, 0xef, 0xff, 0x9d, 0x1a, 0xf3, 0xff, 0x96, 0x1e, 0xf5, 0xff, 0x8e, 0x1d, 0xef, 0xff, 0x86, 0x1c, 0xf0, 0xff, 0x7e, 0x1a, 0xf4, 0xff, 0x77, 0x19, 0xf3, 0xff, 0x7a, 0x1b, 0xf0, 0xff, 0x8b, 0x1a, 0xe1, 0xff, 0xa6, 0x21, 0xcd, 0xff, 0xbd, 0x2f, 0xb2, 0xff, 0xcc, 0x44, 0x95, 0xff, 0xdb, 0x58, 0x7d, 0xff, 0xdf, 0x66, 0x65, 0xff, 0xe4, 0x72, 0x56, 0xff, 0xe9, 0x7e, 0x42, 0xff, 0xeb, 0x8c, 0x1d, 0xff, 0xf9, 0x9d, 0x0b, 0xff, 0xff, 0xa2, 0x0b, 0xff, 0xfb, 0x9f, 0x07, 0xff, 0xfc, 0xa2, 0x02, 0xff,
+    0xb5, 0x9e, 0x74, 0xf3, 0xb9, 0x9e, 0x74, 0xff, 0xbc, 0x9f, 0x77, 0xff, 0xbd, 0x9f, 0x77, 0xff, 0xc4, 0xa3, 0x7e, 0xff, 0xc9, 0xa4, 0x7f, 0xff, 0xc6, 0xa2, 0x7c, 0xff, 0xc4, 0xa1, 0x79, 0xff, 0xc5, 0x9e, 0x76, 0xff, 0xc0, 0x9c, 0x73, 0xff, 0xbb, 0x9b, 0x70, 0xff, 0xbb, 0x9d, 0x6e, 0xff, 0xb8, 0x9c, 0x6a, 0xff, 0xb4, 0x9b, 0x64, 0xff, 0xb2, 0x95, 0x60, 0xff, 0xb4, 0x98, 0x58, 0xff, 0xb3, 0x95, 0x58, 0xff, 0xa5, 0x8a, 0x5e, 0xff, 0x51, 0x42, 0x24, 0xff, 0x40, 0x3a, 0x2c, 0xff, 0x45, 0x41, 0x3b, 0xff, 0x48, 0x42, 0x38, 0xff, 0x4f, 0x48, 0x3d, 0xff, 0x4e, 0x49, 0x40, 0xff, 0x47, 0x43, 0x35, 0xff, 0x3f, 0x3f, 0x2c, 0xff, 0x41, 0x41, 0x31, 0xff, 0x2f, 0x2d, 0x21, 0xff, 0x1d, 0x1a, 0x11, 0xff, 0x25, 0x22, 0x19, 0xff, 0x22, 0x20, 0x19, 0xff, 0x1a, 0x18, 0x16, 0xff, 0x0d, 0x0e, 0x07, 0xff, 0x0b, 0x0e, 0x04, 0xff, 0x3a, 0x3a, 0x34, 0xff, 0x3d, 0x3c, 0x37, 0xff, 0x17, 0x16, 0x13, 0xff, 0x0e, 0x0b, 0x08, 0xff, 0x26, 0x20, 0x1e, 0xff, 0x15, 0x10, 0x10, 0xff, 0x2a, 0x27, 0x24, 0xff, 0x37, 0x36, 0x2e, 0xff, 0x11, 0x12, 0x08, 0xff, 0x21, 0x20, 0x1a, 0xff, 0x1e, 0x1c, 0x1a, 0xff, 0x20, 0x1e, 0x1c, 0xff, 0x1c, 0x19, 0x16, 0xff, 0x1d, 0x1e, 0x19, 0xff, 0x20, 0x1f, 0x1a, 0xff, 0x19, 0x0b, 0x00, 0xff, 0x23, 0x27, 0x35, 0xff, 0x55, 0xa0, 0xf8, 0xff, 0x5d, 0xab, 0xf7, 0xff, 0x63, 0xa9, 0xf0, 0xff, 0x64, 0xac, 0xf0, 0xff, 0x75, 0xb2, 0xf1, 0xff, 0x74, 0xb6, 0xf1, 0xff, 0x79, 0xb4, 0xf1, 0xff, 0x7f, 0xb6, 0xf0, 0xff, 0x7c, 0xb5, 0xeb, 0xff, 0x7b, 0xb5, 0xea, 0xff, 0x7a, 0xb1, 0xeb, 0xff, 0x6f, 0xa7, 0xe8, 0xff, 0x63, 0x9b, 0xe3, 0xff, 0x4d, 0x81, 0xd7, 0xff, 0x3e, 0x74, 0xbd, 0xff, 0x89, 0xc5, 0xe9, 0xff, 0xa5, 0xd6, 0xf3, 0xff, 0x38, 0x61, 0xab, 0xff, 0x2a, 0x5d, 0xd0, 0xff, 0x2c, 0x70, 0xd5, 0xff, 0x1a, 0x4e, 0xa9, 0xff, 0x0b, 0x24, 0x88, 0xff, 0x03, 0x1c, 0x7b, 0xff, 0x00, 0x28, 0x82, 0xff, 0x07, 0x3b, 0x9a, 0xff, 0x13, 0x4a, 0xa3, 0xff, 0x19, 0x4f, 0x9c, 0xff, 0x28, 0x57, 0xa0, 0xff, 0x17, 0x41, 0x88, 0xff, 0x00, 0x0e, 0x58, 0xff, 0x0a, 0x1d, 0x6f, 0xff, 0x67, 0x92, 0xd3, 0xff, 0x7b, 0xb2, 0xf8, 0xff, 0x1b, 0x53, 0xb5, 0xff, 0x17, 0x51, 0xae, 0xff, 0x3d, 0x72, 0xc0, 0xff, 0x51, 0x7f, 0xd5, 0xff, 0x4f, 0x7d, 0xd6, 0xff, 0x50, 0x84, 0xd2, 0xff, 0x4b, 0x87, 0xd2, 0xff, 0x43, 0x74, 0xd0, 0xff, 0x3d, 0x6b, 0xcc, 0xff, 0x3d, 0x2f, 0x46, 0xff, 0xdd, 0x87, 0x54, 0xff, 0xfb, 0xa2, 0x6e, 0xff, 0xf0, 0x84, 0x70, 0xff, 0xf0, 0x74, 0x87, 0xff, 0xed, 0x6e, 0x91, 0xff, 0xf3, 0x63, 0x98, 0xff, 0xe4, 0x59, 0xa3, 0xff, 0xda, 0x4f, 0xb2, 0xff, 0xe8, 0x40, 0xc5, 0xff, 0xe0, 0x2c, 0xd1, 0xff, 0xcf, 0x28, 0xe3, 0xff, 0xc3, 0x29, 0xec, 0xff, 0xb2, 0x1e, 0xeb, 0xff, 0xa6, 0x1b, 0xee, 0xff, 0x9a, 0x19, 0xf1, 0xff, 0x94, 0x19, 0xf1, 0xff, 0x8e, 0x1a, 0xf0, 0xff, 0x85, 0x1c, 0xf1, 0xff, 0x7b, 0x19, 0xf1, 0xff, 0x6f, 0x16, 0xef, 0xff, 0x70, 0x17, 0xee, 0xff, 0x84, 0x16, 0xe0, 0xff, 0x9d, 0x1c, 0xcc, 0xff, 0xb3, 0x2d, 0xb4, 0xff, 0xc2, 0x3c, 0x94, 0xff, 0xd5, 0x53, 0x7b, 0xff, 0xe0, 0x65, 0x69, 0xff, 0xda, 0x6b, 0x58, 0xff, 0xe7, 0x7b, 0x41, 0xff, 0xeb, 0x88, 0x1d, 0xff, 0xf6, 0x95, 0x05, 0xff, 0xff, 0xa0, 0x08, 0xff, 0xfe, 0xa0, 0x0a, 0xff, 0xff, 0xa4, 0x05, 0xf3,
+    0xb8, 0x9f, 0x71, 0xf0, 0xb8, 0x9d, 0x70, 0xff, 0xbb, 0x9d, 0x72, 0xff, 0xbe, 0x9f, 0x75, 0xff, 0xc3, 0xa2, 0x7a, 0xff, 0xc7, 0xa1, 0x7d, 0xff, 0xc6, 0xa1, 0x7c, 0xff, 0xc3, 0x9f, 0x79, 0xff, 0xc4, 0x9c, 0x76, 0xff, 0xc2, 0x9a, 0x70, 0xff, 0xbf, 0x99, 0x6b, 0xff, 0xbe, 0x9c, 0x68, 0xff, 0xb9, 0x9a, 0x62, 0xff, 0xb2, 0x96, 0x58, 0xff, 0xae, 0x92, 0x51, 0xff, 0xae, 0x94, 0x4d, 0xff, 0xb4, 0x99, 0x5c, 0xff, 0x88, 0x6f, 0x47, 0xff, 0x46, 0x3a, 0x1e, 0xff, 0x3f, 0x3c, 0x2e, 0xff, 0x41, 0x3f, 0x36, 0xff, 0x45, 0x41, 0x34, 0xff, 0x51, 0x4c, 0x40, 0xff, 0x51, 0x4c, 0x44, 0xff, 0x45, 0x43, 0x36, 0xff, 0x3e, 0x3e, 0x2d, 0xff, 0x3e, 0x3c, 0x2f, 0xff, 0x33, 0x31, 0x26, 0xff, 0x21, 0x1f, 0x15, 0xff, 0x24, 0x22, 0x19, 0xff, 0x2a, 0x26, 0x20, 0xff, 0x1c, 0x19, 0x15, 0xff, 0x15, 0x16, 0x0e, 0xff, 0x08, 0x0a, 0x00, 0xff, 0x1a, 0x1a, 0x13, 0xff, 0x3f, 0x3f, 0x39, 0xff, 0x2c, 0x2c, 0x28, 0xff, 0x13, 0x10, 0x0c, 0xff, 0x18, 0x12, 0x0f, 0xff, 0x18, 0x13, 0x12, 0xff, 0x1b, 0x19, 0x13, 0xff, 0x3b, 0x3c, 0x33, 0xff, 0x15, 0x16, 0x0e, 0xff, 0x1b, 0x1a, 0x16, 0xff, 0x18, 0x17, 0x16, 0xff, 0x1b, 0x18, 0x17, 0xff, 0x1b, 0x1a, 0x16, 0xff, 0x18, 0x1a, 0x16, 0xff, 0x1d, 0x1c, 0x18, 0xff, 0x15, 0x09, 0x00, 0xff, 0x16, 0x18, 0x24, 0xff, 0x56, 0x99, 0xe8, 0xff, 0x56, 0xab, 0xfa, 0xff, 0x55, 0xa3, 0xed, 0xff, 0x5c, 0xa7, 0xed, 0xff, 0x68, 0xaa, 0xeb, 0xff, 0x64, 0xac, 0xe9, 0xff, 0x68, 0xab, 0xe9, 0xff, 0x6b, 0xae, 0xea, 0xff, 0x69, 0xab, 0xe7, 0xff, 0x65, 0xa2, 0xe4, 0xff, 0x5f, 0x97, 0xe3, 0xff, 0x57, 0x8f, 0xe3, 0xff, 0x3d, 0x77, 0xd1, 0xff, 0x17, 0x4e, 0xa8, 0xff, 0x5a, 0x93, 0xd1, 0xff, 0xae, 0xe9, 0xff, 0xff, 0xcb, 0xff, 0xff, 0xff, 0x45, 0x67, 0x9f, 0xff, 0x00, 0x04, 0x65, 0xff, 0x0a, 0x2a, 0x7d, 0xff, 0x01, 0x1c, 0x64, 0xff, 0x0b, 0x16, 0x64, 0xff, 0x0d, 0x1a, 0x62, 0xff, 0x01, 0x1a, 0x63, 0xff, 0x03, 0x27, 0x75, 0xff, 0x16, 0x42, 0x8a, 0xff, 0x15, 0x45, 0x83, 0xff, 0x17, 0x3e, 0x77, 0xff, 0x0e, 0x2d, 0x65, 0xff, 0x19, 0x28, 0x63, 0xff, 0x39, 0x50, 0x89, 0xff, 0x9d, 0xca, 0xf2, 0xff, 0x97, 0xd3, 0xff, 0xff, 0x34, 0x6d, 0xbe, 0xff, 0x00, 0x24, 0x7b, 0xff, 0x19, 0x49, 0x90, 0xff, 0x23, 0x51, 0x9d, 0xff, 0x2a, 0x59, 0xae, 0xff, 0x2d, 0x5e, 0xad, 0xff, 0x32, 0x5c, 0xb5, 0xff, 0x23, 0x58, 0xbd, 0xff, 0x15, 0x50, 0xac, 0xff, 0x42, 0x28, 0x3b, 0xff, 0xfc, 0x9d, 0x6c, 0xff, 0xf9, 0xa0, 0x72, 0xff, 0xef, 0x83, 0x76, 0xff, 0xee, 0x74, 0x87, 0xff, 0xeb, 0x6d, 0x91, 0xff, 0xf0, 0x61, 0x98, 0xff, 0xe2, 0x57, 0xa1, 0xff, 0xdc, 0x4e, 0xb0, 0xff, 0xe6, 0x3c, 0xbd, 0xff, 0xe0, 0x27, 0xca, 0xff, 0xd6, 0x24, 0xe1, 0xff, 0xc6, 0x24, 0xea, 0xff, 0xb4, 0x1c, 0xec, 0xff, 0xac, 0x1e, 0xf3, 0xff, 0x9a, 0x1a, 0xf2, 0xff, 0x8d, 0x18, 0xf0, 0xff, 0x8b, 0x1b, 0xf1, 0xff, 0x82, 0x19, 0xf1, 0xff, 0x71, 0x13, 0xf0, 0xff, 0x6b, 0x12, 0xf1, 0xff, 0x6f, 0x17, 0xf3, 0xff, 0x7a, 0x14, 0xe3, 0xff, 0x93, 0x1a, 0xcf, 0xff, 0xaf, 0x2e, 0xba, 0xff, 0xc1, 0x39, 0x97, 0xff, 0xd1, 0x4e, 0x7b, 0xff, 0xdb, 0x5f, 0x67, 0xff, 0xd9, 0x67, 0x58, 0xff, 0xe5, 0x75, 0x41, 0xff, 0xef, 0x84, 0x1e, 0xff, 0xf8, 0x90, 0x04, 0xff, 0xff, 0x99, 0x06, 0xff, 0xff, 0x9f, 0x0a, 0xff, 0xff, 0xa6, 0x04, 0xf0,
+    0xb8, 0x9b, 0x6d, 0xe7, 0xb7, 0x9a, 0x6c, 0xff, 0xb7, 0x98, 0x6c, 0xff, 0xbb, 0x9c, 0x71, 0xff, 0xc1, 0x9f, 0x75, 0xff, 0xc3, 0x9f, 0x76, 0xff, 0xc2, 0x9f, 0x76, 0xff, 0xbf, 0x9d, 0x73, 0xff, 0xc1, 0x9b, 0x6f, 0xff, 0xc0, 0x98, 0x6b, 0xff, 0xbe, 0x97, 0x66, 0xff, 0xba, 0x99, 0x5e, 0xff, 0xb1, 0x93, 0x53, 0xff, 0xae, 0x93, 0x4e, 0xff, 0xad, 0x94, 0x4c, 0xff, 0xa4, 0x8f, 0x42, 0xff, 0xa4, 0x8f, 0x57, 0xff, 0x62, 0x51, 0x2e, 0xff, 0x3e, 0x37, 0x1e, 0xff, 0x3d, 0x3f, 0x30, 0xff, 0x45, 0x47, 0x3b, 0xff, 0x4a, 0x49, 0x39, 0xff, 0x4a, 0x46, 0x39, 0xff, 0x43, 0x40, 0x37, 0xff, 0x44, 0x43, 0x38, 0xff, 0x45, 0x46, 0x37, 0xff, 0x3b, 0x39, 0x2d, 0xff, 0x2e, 0x2c, 0x22, 0xff, 0x21, 0x1e, 0x17, 0xff, 0x25, 0x22, 0x1a, 0xff, 0x2c, 0x29, 0x22, 0xff, 0x1e, 0x19, 0x17, 0xff, 0x19, 0x17, 0x10, 0xff, 0x11, 0x13, 0x09, 0xff, 0x07, 0x08, 0x00, 0xff, 0x26, 0x26, 0x1f, 0xff, 0x37, 0x37, 0x31, 0xff, 0x21, 0x20, 0x1a, 0xff, 0x13, 0x10, 0x0b, 0xff, 0x17, 0x14, 0x11, 0xff, 0x0a, 0x0b, 0x03, 0xff, 0x36, 0x39, 0x2f, 0xff, 0x22, 0x24, 0x1e, 0xff, 0x15, 0x16, 0x12, 0xff, 0x1a, 0x1b, 0x1a, 0xff, 0x16, 0x15, 0x15, 0xff, 0x19, 0x18, 0x14, 0xff, 0x15, 0x18, 0x13, 0xff, 0x1c, 0x1d, 0x16, 0xff, 0x16, 0x0c, 0x02, 0xff, 0x07, 0x06, 0x12, 0xff, 0x4e, 0x89, 0xcd, 0xff, 0x4c, 0xaa, 0xfb, 0xff, 0x3e, 0x98, 0xe4, 0xff, 0x49, 0x96, 0xe5, 0xff, 0x51, 0x99, 0xe2, 0xff, 0x4d, 0x9b, 0xe0, 0xff, 0x4f, 0x9a, 0xe0, 0xff, 0x51, 0x98, 0xe1, 0xff, 0x51, 0x95, 0xdf, 0xff, 0x4a, 0x89, 0xd8, 0xff, 0x3f, 0x77, 0xd0, 0xff, 0x2b, 0x62, 0xc2, 0xff, 0x07, 0x42, 0xab, 0xff, 0x0b, 0x41, 0xa3, 0xff, 0x78, 0xab, 0xe0, 0xff, 0xa0, 0xd9, 0xf3, 0xff, 0xb4, 0xf0, 0xff, 0xff, 0x70, 0x9a, 0xd3, 0xff, 0x00, 0x02, 0x57, 0xff, 0x04, 0x0d, 0x56, 0xff, 0x0b, 0x24, 0x5d, 0xff, 0x12, 0x32, 0x6e, 0xff, 0x12, 0x30, 0x64, 0xff, 0x12, 0x25, 0x5e, 0xff, 0x0d, 0x20, 0x63, 0xff, 0x05, 0x1e, 0x5e, 0xff, 0x0b, 0x26, 0x5c, 0xff, 0x17, 0x2f, 0x5d, 0xff, 0x2f, 0x3c, 0x70, 0xff, 0x49, 0x48, 0x83, 0xff, 0x3a, 0x48, 0x80, 0xff, 0x7b, 0xa4, 0xc7, 0xff, 0x8d, 0xc8, 0xeb, 0xff, 0x3d, 0x78, 0xbf, 0xff, 0x00, 0x24, 0x78, 0xff, 0x0f, 0x2f, 0x7b, 0xff, 0x14, 0x3c, 0x8d, 0xff, 0x1a, 0x48, 0x9e, 0xff, 0x22, 0x50, 0xa0, 0xff, 0x26, 0x4a, 0xa3, 0xff, 0x21, 0x56, 0xb4, 0xff, 0x0b, 0x3c, 0x87, 0xff, 0x5c, 0x3c, 0x37, 0xff, 0xff, 0xb7, 0x75, 0xff, 0xf7, 0x9f, 0x6b, 0xff, 0xea, 0x85, 0x77, 0xff, 0xea, 0x73, 0x88, 0xff, 0xeb, 0x6e, 0x92, 0xff, 0xf1, 0x61, 0x9a, 0xff, 0xe3, 0x56, 0xa1, 0xff, 0xde, 0x4e, 0xaf, 0xff, 0xe6, 0x3b, 0xba, 0xff, 0xe1, 0x24, 0xc7, 0xff, 0xd8, 0x1f, 0xde, 0xff, 0xc5, 0x1f, 0xe8, 0xff, 0xb7, 0x1d, 0xef, 0xff, 0xaf, 0x1d, 0xf4, 0xff, 0x98, 0x17, 0xf2, 0xff, 0x8c, 0x1a, 0xf2, 0xff, 0x87, 0x1a, 0xf1, 0xff, 0x77, 0x17, 0xf0, 0xff, 0x65, 0x13, 0xf3, 0xff, 0x62, 0x12, 0xf6, 0xff, 0x66, 0x13, 0xf7, 0xff, 0x71, 0x14, 0xea, 0xff, 0x89, 0x19, 0xd5, 0xff, 0xaa, 0x2c, 0xc0, 0xff, 0xc1, 0x37, 0x9d, 0xff, 0xce, 0x45, 0x7a, 0xff, 0xda, 0x56, 0x67, 0xff, 0xe1, 0x65, 0x5f, 0xff, 0xea, 0x6e, 0x43, 0xff, 0xf0, 0x79, 0x1d, 0xff, 0xf9, 0x89, 0x04, 0xff, 0xff, 0x92, 0x03, 0xff, 0xfe, 0x9a, 0x07, 0xff, 0xfc, 0xa2, 0x01, 0xe6,
+    0xb5, 0x99, 0x64, 0xd3, 0xb2, 0x95, 0x63, 0xff, 0xb2, 0x93, 0x64, 0xff, 0xb7, 0x98, 0x69, 0xff, 0xba, 0x9a, 0x6d, 0xff, 0xbe, 0x9c, 0x6f, 0xff, 0xbd, 0x9c, 0x6c, 0xff, 0xbb, 0x9b, 0x6a, 0xff, 0xbb, 0x96, 0x68, 0xff, 0xb9, 0x94, 0x64, 0xff, 0xb8, 0x96, 0x61, 0xff, 0xb5, 0x97, 0x5a, 0xff, 0xad, 0x92, 0x4f, 0xff, 0xa6, 0x8e, 0x48, 0xff, 0xa1, 0x8c, 0x42, 0xff, 0x9d, 0x8f, 0x42, 0xff, 0x89, 0x7b, 0x48, 0xff, 0x51, 0x42, 0x26, 0xff, 0x45, 0x40, 0x2b, 0xff, 0x43, 0x47, 0x3a, 0xff, 0x45, 0x47, 0x38, 0xff, 0x4c, 0x4b, 0x38, 0xff, 0x48, 0x47, 0x39, 0xff, 0x45, 0x42, 0x3b, 0xff, 0x44, 0x43, 0x3a, 0xff, 0x49, 0x48, 0x3b, 0xff, 0x43, 0x41, 0x34, 0xff, 0x32, 0x30, 0x25, 0xff, 0x24, 0x20, 0x1b, 0xff, 0x21, 0x1d, 0x18, 0xff, 0x29, 0x25, 0x1e, 0xff, 0x28, 0x23, 0x20, 0xff, 0x1a, 0x16, 0x10, 0xff, 0x15, 0x14, 0x0b, 0xff, 0x0a, 0x0b, 0x01, 0xff, 0x0d, 0x0f, 0x05, 0xff, 0x2a, 0x2b, 0x24, 0xff, 0x30, 0x2f, 0x29, 0xff, 0x1d, 0x1a, 0x15, 0xff, 0x11, 0x0f, 0x0b, 0xff, 0x08, 0x09, 0x03, 0xff, 0x25, 0x29, 0x20, 0xff, 0x2d, 0x2f, 0x2a, 0xff, 0x0e, 0x0f, 0x0d, 0xff, 0x19, 0x19, 0x19, 0xff, 0x16, 0x15, 0x15, 0xff, 0x1a, 0x1b, 0x17, 0xff, 0x14, 0x19, 0x14, 0xff, 0x1a, 0x1b, 0x15, 0xff, 0x1b, 0x12, 0x09, 0xff, 0x04, 0x00, 0x07, 0xff, 0x41, 0x75, 0xaf, 0xff, 0x3f, 0xa4, 0xf4, 0xff, 0x2f, 0x8e, 0xdd, 0xff, 0x3a, 0x8a, 0xe1, 0xff, 0x3e, 0x87, 0xd9, 0xff, 0x30, 0x83, 0xcd, 0xff, 0x31, 0x7f, 0xce, 0xff, 0x38, 0x7f, 0xd3, 0xff, 0x32, 0x76, 0xca, 0xff, 0x2a, 0x68, 0xc1, 0xff, 0x21, 0x57, 0xb5, 0xff, 0x0c, 0x43, 0xa3, 0xff, 0x00, 0x29, 0x93, 0xff, 0x1f, 0x51, 0xb1, 0xff, 0x82, 0xb4, 0xe8, 0xff, 0x8c, 0xc5, 0xe2, 0xff, 0x9d, 0xd8, 0xf6, 0xff, 0x90, 0xbe, 0xf5, 0xff, 0x19, 0x39, 0x84, 0xff, 0x00, 0x0f, 0x57, 0xff, 0x02, 0x1d, 0x5c, 0xff, 0x0a, 0x19, 0x5c, 0xff, 0x13, 0x1a, 0x57, 0xff, 0x17, 0x22, 0x56, 0xff, 0x1b, 0x28, 0x62, 0xff, 0x22, 0x2f, 0x68, 0xff, 0x28, 0x35, 0x64, 0xff, 0x31, 0x3d, 0x68, 0xff, 0x41, 0x3f, 0x75, 0xff, 0x51, 0x42, 0x85, 0xff, 0x3d, 0x3e, 0x84, 0xff, 0x6f, 0x8e, 0xbc, 0xff, 0x90, 0xca, 0xf0, 0xff, 0x3c, 0x78, 0xbc, 0xff, 0x01, 0x26, 0x7a, 0xff, 0x08, 0x20, 0x74, 0xff, 0x1a, 0x3b, 0x95, 0xff, 0x10, 0x40, 0x97, 0xff, 0x1d, 0x4a, 0x98, 0xff, 0x25, 0x4a, 0x9f, 0xff, 0x21, 0x58, 0xa9, 0xff, 0x02, 0x24, 0x59, 0xff, 0x7d, 0x5b, 0x3a, 0xff, 0xff, 0xd4, 0x7b, 0xff, 0xf9, 0xa1, 0x66, 0xff, 0xe9, 0x86, 0x77, 0xff, 0xe7, 0x72, 0x88, 0xff, 0xea, 0x6c, 0x92, 0xff, 0xf2, 0x62, 0x9b, 0xff, 0xe6, 0x56, 0xa2, 0xff, 0xe1, 0x4d, 0xae, 0xff, 0xe8, 0x3d, 0xbc, 0xff, 0xe1, 0x26, 0xc9, 0xff, 0xd5, 0x1c, 0xda, 0xff, 0xc1, 0x1d, 0xe5, 0xff, 0xb8, 0x1e, 0xf1, 0xff, 0xaa, 0x18, 0xef, 0xff, 0x93, 0x15, 0xee, 0xff, 0x88, 0x1a, 0xf3, 0xff, 0x7c, 0x18, 0xf0, 0xff, 0x6d, 0x15, 0xf0, 0xff, 0x5c, 0x14, 0xf4, 0xff, 0x5a, 0x11, 0xf8, 0xff, 0x5b, 0x0c, 0xf6, 0xff, 0x67, 0x10, 0xec, 0xff, 0x7e, 0x17, 0xd5, 0xff, 0x9e, 0x25, 0xbc, 0xff, 0xbe, 0x2f, 0x9b, 0xff, 0xcc, 0x39, 0x75, 0xff, 0xd7, 0x4c, 0x62, 0xff, 0xe0, 0x5b, 0x5b, 0xff, 0xe8, 0x64, 0x3f, 0xff, 0xef, 0x72, 0x1c, 0xff, 0xfb, 0x86, 0x05, 0xff, 0xff, 0x90, 0x02, 0xff, 0xfb, 0x94, 0x03, 0xff, 0xfa, 0x9d, 0x01, 0xd3,
+    0xaf, 0x94, 0x59, 0xbe, 0xae, 0x90, 0x57, 0xff, 0xad, 0x8e, 0x58, 0xff, 0xb2, 0x93, 0x5f, 0xff, 0xb4, 0x95, 0x62, 0xff, 0xb8, 0x98, 0x66, 0xff, 0xb7, 0x98, 0x62, 0xff, 0xb5, 0x97, 0x60, 0xff, 0xb2, 0x92, 0x61, 0xff, 0xaf, 0x90, 0x5b, 0xff, 0xaf, 0x91, 0x55, 0xff, 0xae, 0x92, 0x53, 0xff, 0xa8, 0x8e, 0x49, 0xff, 0x9b, 0x87, 0x40, 0xff, 0x8e, 0x80, 0x38, 0xff, 0x8d, 0x86, 0x3c, 0xff, 0x6d, 0x61, 0x37, 0xff, 0x47, 0x3a, 0x27, 0xff, 0x48, 0x45, 0x37, 0xff, 0x42, 0x43, 0x3d, 0xff, 0x40, 0x3e, 0x33, 0xff, 0x47, 0x40, 0x31, 0xff, 0x4e, 0x48, 0x40, 0xff, 0x48, 0x44, 0x42, 0xff, 0x48, 0x42, 0x3b, 0xff, 0x4b, 0x42, 0x36, 0xff, 0x4b, 0x42, 0x36, 0xff, 0x3d, 0x36, 0x2d, 0xff, 0x23, 0x1f, 0x1a, 0xff, 0x1f, 0x1b, 0x16, 0xff, 0x25, 0x22, 0x1e, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x20, 0x1d, 0x19, 0xff, 0x17, 0x15, 0x0e, 0xff, 0x10, 0x11, 0x08, 0xff, 0x07, 0x09, 0x02, 0xff, 0x15, 0x17, 0x13, 0xff, 0x2c, 0x2e, 0x29, 0xff, 0x2a, 0x2b, 0x26, 0xff, 0x15, 0x14, 0x13, 0xff, 0x09, 0x0b, 0x03, 0xff, 0x16, 0x19, 0x11, 0xff, 0x31, 0x32, 0x31, 0xff, 0x10, 0x11, 0x10, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x15, 0x16, 0x16, 0xff, 0x15, 0x16, 0x15, 0xff, 0x16, 0x19, 0x17, 0xff, 0x18, 0x1a, 0x10, 0xff, 0x1f, 0x16, 0x06, 0xff, 0x04, 0x00, 0x00, 0xff, 0x39, 0x63, 0x9a, 0xff, 0x3d, 0xa4, 0xf4, 0xff, 0x26, 0x86, 0xd8, 0xff, 0x28, 0x7a, 0xdb, 0xff, 0x29, 0x6f, 0xce, 0xff, 0x18, 0x6b, 0xbb, 0xff, 0x1c, 0x69, 0xc0, 0xff, 0x22, 0x67, 0xc3, 0xff, 0x16, 0x58, 0xb7, 0xff, 0x15, 0x4f, 0xb2, 0xff, 0x12, 0x49, 0xa6, 0xff, 0x04, 0x3b, 0x95, 0xff, 0x00, 0x2a, 0x88, 0xff, 0x41, 0x78, 0xc6, 0xff, 0x8a, 0xc8, 0xfc, 0xff, 0x95, 0xca, 0xf1, 0xff, 0xa5, 0xd2, 0xf4, 0xff, 0xb3, 0xe0, 0xff, 0xff, 0x73, 0xa7, 0xd5, 0xff, 0x1e, 0x4e, 0x81, 0xff, 0x19, 0x37, 0x6d, 0xff, 0x2e, 0x3e, 0x71, 0xff, 0x28, 0x3a, 0x64, 0xff, 0x0f, 0x26, 0x4d, 0xff, 0x0e, 0x20, 0x4d, 0xff, 0x1b, 0x29, 0x58, 0xff, 0x26, 0x34, 0x5e, 0xff, 0x30, 0x3a, 0x63, 0xff, 0x43, 0x3f, 0x74, 0xff, 0x5a, 0x53, 0x97, 0xff, 0x49, 0x48, 0x99, 0xff, 0x61, 0x7b, 0xb2, 0xff, 0x95, 0xd3, 0xf4, 0xff, 0x51, 0x92, 0xc5, 0xff, 0x11, 0x36, 0x7a, 0xff, 0x09, 0x1d, 0x64, 0xff, 0x13, 0x2d, 0x80, 0xff, 0x0d, 0x43, 0x8e, 0xff, 0x1b, 0x4d, 0x91, 0xff, 0x25, 0x49, 0x9d, 0xff, 0x26, 0x5d, 0xa6, 0xff, 0x0e, 0x14, 0x39, 0xff, 0xb1, 0x7f, 0x45, 0xff, 0xff, 0xe1, 0x6f, 0xff, 0xf7, 0xa1, 0x67, 0xff, 0xee, 0x7e, 0x7a, 0xff, 0xe9, 0x70, 0x8b, 0xff, 0xed, 0x69, 0x93, 0xff, 0xee, 0x5f, 0x9a, 0xff, 0xe5, 0x57, 0xa1, 0xff, 0xe1, 0x4b, 0xa9, 0xff, 0xe7, 0x3d, 0xbb, 0xff, 0xe2, 0x29, 0xc8, 0xff, 0xcf, 0x1e, 0xd5, 0xff, 0xbf, 0x1c, 0xe1, 0xff, 0xb8, 0x1a, 0xee, 0xff, 0xa6, 0x19, 0xf0, 0xff, 0x90, 0x17, 0xf1, 0xff, 0x84, 0x17, 0xf2, 0xff, 0x72, 0x18, 0xf0, 0xff, 0x65, 0x18, 0xf1, 0xff, 0x58, 0x15, 0xf2, 0xff, 0x4f, 0x0f, 0xf4, 0xff, 0x4d, 0x0d, 0xf7, 0xff, 0x59, 0x13, 0xeb, 0xff, 0x6d, 0x15, 0xd1, 0xff, 0x91, 0x21, 0xb6, 0xff, 0xba, 0x2a, 0x95, 0xff, 0xce, 0x32, 0x70, 0xff, 0xd4, 0x44, 0x5d, 0xff, 0xdc, 0x54, 0x55, 0xff, 0xe7, 0x61, 0x3d, 0xff, 0xec, 0x6e, 0x1b, 0xff, 0xf7, 0x80, 0x03, 0xff, 0xff, 0x8c, 0x05, 0xff, 0xfa, 0x8e, 0x03, 0xff, 0xf9, 0x96, 0x01, 0xbe,
+    0xa9, 0x8e, 0x52, 0xaa, 0xa9, 0x8c, 0x51, 0xff, 0xa7, 0x89, 0x51, 0xff, 0xab, 0x8b, 0x53, 0xff, 0xaf, 0x8e, 0x58, 0xff, 0xae, 0x90, 0x57, 0xff, 0xae, 0x92, 0x57, 0xff, 0xac, 0x90, 0x54, 0xff, 0xac, 0x90, 0x55, 0xff, 0xaa, 0x8e, 0x50, 0xff, 0xa9, 0x8f, 0x4d, 0xff, 0xa7, 0x8f, 0x4a, 0xff, 0x9b, 0x86, 0x3c, 0xff, 0x8e, 0x7c, 0x38, 0xff, 0x86, 0x79, 0x37, 0xff, 0x7e, 0x78, 0x36, 0xff, 0x60, 0x53, 0x31, 0xff, 0x45, 0x39, 0x2d, 0xff, 0x41, 0x3d, 0x33, 0xff, 0x44, 0x42, 0x3d, 0xff, 0x43, 0x41, 0x3a, 0xff, 0x4a, 0x42, 0x36, 0xff, 0x56, 0x4b, 0x44, 0xff, 0x4d, 0x43, 0x43, 0xff, 0x49, 0x3d, 0x39, 0xff, 0x4d, 0x40, 0x37, 0xff, 0x49, 0x3c, 0x35, 0xff, 0x43, 0x39, 0x33, 0xff, 0x30, 0x28, 0x23, 0xff, 0x22, 0x1c, 0x18, 0xff, 0x24, 0x21, 0x21, 0xff, 0x2a, 0x29, 0x2b, 0xff, 0x28, 0x25, 0x25, 0xff, 0x1d, 0x19, 0x15, 0xff, 0x14, 0x11, 0x0c, 0xff, 0x0d, 0x0b, 0x08, 0xff, 0x07, 0x06, 0x06, 0xff, 0x19, 0x1b, 0x18, 0xff, 0x27, 0x2b, 0x27, 0xff, 0x1f, 0x21, 0x20, 0xff, 0x09, 0x0d, 0x07, 0xff, 0x06, 0x0a, 0x02, 0xff, 0x2c, 0x2c, 0x29, 0xff, 0x1c, 0x1d, 0x1a, 0xff, 0x14, 0x14, 0x13, 0xff, 0x16, 0x15, 0x16, 0xff, 0x11, 0x12, 0x13, 0xff, 0x13, 0x17, 0x13, 0xff, 0x19, 0x1c, 0x0d, 0xff, 0x19, 0x14, 0x03, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2a, 0x4d, 0x7c, 0xff, 0x3d, 0xaa, 0xfa, 0xff, 0x25, 0x87, 0xdb, 0xff, 0x1b, 0x65, 0xd2, 0xff, 0x17, 0x5d, 0xc8, 0xff, 0x15, 0x66, 0xc3, 0xff, 0x19, 0x61, 0xc5, 0xff, 0x16, 0x59, 0xc0, 0xff, 0x12, 0x4f, 0xb6, 0xff, 0x11, 0x48, 0xaa, 0xff, 0x09, 0x3e, 0x97, 0xff, 0x00, 0x33, 0x83, 0xff, 0x14, 0x48, 0x96, 0xff, 0x76, 0xb0, 0xed, 0xff, 0x90, 0xd3, 0xfd, 0xff, 0x96, 0xd6, 0xfa, 0xff, 0xa6, 0xdf, 0xfb, 0xff, 0xb4, 0xef, 0xfd, 0xff, 0xba, 0xff, 0xff, 0xff, 0xb6, 0xf0, 0xfc, 0xff, 0xae, 0xd7, 0xf2, 0xff, 0xb6, 0xd8, 0xf3, 0xff, 0xa4, 0xcb, 0xeb, 0xff, 0x89, 0xa7, 0xe0, 0xff, 0x60, 0x73, 0xbe, 0xff, 0x34, 0x3a, 0x8e, 0xff, 0x31, 0x2e, 0x87, 0xff, 0x2c, 0x2a, 0x85, 0xff, 0x33, 0x2e, 0x95, 0xff, 0x52, 0x4a, 0xc3, 0xff, 0x5f, 0x58, 0xdc, 0xff, 0x67, 0x80, 0xd3, 0xff, 0x82, 0xbf, 0xeb, 0xff, 0x5c, 0x99, 0xce, 0xff, 0x20, 0x45, 0x81, 0xff, 0x0c, 0x1d, 0x5e, 0xff, 0x0d, 0x21, 0x6f, 0xff, 0x0f, 0x3f, 0x88, 0xff, 0x1b, 0x49, 0x95, 0xff, 0x23, 0x51, 0xa6, 0xff, 0x22, 0x4b, 0x97, 0xff, 0x2c, 0x15, 0x2f, 0xff, 0xe4, 0xb2, 0x61, 0xff, 0xff, 0xdb, 0x5b, 0xff, 0xf5, 0xa5, 0x65, 0xff, 0xf2, 0x7c, 0x7d, 0xff, 0xed, 0x6a, 0x8f, 0xff, 0xef, 0x62, 0x95, 0xff, 0xed, 0x5c, 0x9a, 0xff, 0xe3, 0x55, 0xa1, 0xff, 0xde, 0x4d, 0xa9, 0xff, 0xe3, 0x3f, 0xb8, 0xff, 0xe0, 0x29, 0xc4, 0xff, 0xce, 0x1e, 0xd4, 0xff, 0xbb, 0x19, 0xe2, 0xff, 0xb3, 0x15, 0xec, 0xff, 0xa4, 0x16, 0xf0, 0xff, 0x91, 0x17, 0xf6, 0xff, 0x82, 0x15, 0xf6, 0xff, 0x6f, 0x16, 0xf1, 0xff, 0x61, 0x17, 0xf3, 0xff, 0x4d, 0x13, 0xf3, 0xff, 0x3f, 0x0f, 0xf4, 0xff, 0x3a, 0x0e, 0xf2, 0xff, 0x42, 0x11, 0xe4, 0xff, 0x5b, 0x15, 0xcd, 0xff, 0x86, 0x1f, 0xb4, 0xff, 0xb5, 0x2a, 0x95, 0xff, 0xcd, 0x36, 0x72, 0xff, 0xd5, 0x45, 0x5d, 0xff, 0xe0, 0x5a, 0x59, 0xff, 0xe9, 0x65, 0x3f, 0xff, 0xee, 0x6e, 0x1c, 0xff, 0xfa, 0x7e, 0x04, 0xff, 0xff, 0x84, 0x03, 0xff, 0xfe, 0x8b, 0x08, 0xff, 0xf9, 0x90, 0x00, 0xab,
+    0x9b, 0x87, 0x49, 0x8b, 0x9f, 0x8a, 0x4a, 0xff, 0x9e, 0x87, 0x49, 0xff, 0x9f, 0x85, 0x48, 0xff, 0xa7, 0x8a, 0x4e, 0xff, 0xa4, 0x8a, 0x4d, 0xff, 0xa5, 0x8a, 0x4f, 0xff, 0xa5, 0x8b, 0x4d, 0xff, 0xa5, 0x8d, 0x4a, 0xff, 0xa5, 0x8b, 0x48, 0xff, 0xa2, 0x89, 0x47, 0xff, 0x9b, 0x87, 0x42, 0xff, 0x8c, 0x7c, 0x34, 0xff, 0x81, 0x73, 0x30, 0xff, 0x7c, 0x72, 0x31, 0xff, 0x6c, 0x6a, 0x2a, 0xff, 0x57, 0x4e, 0x30, 0xff, 0x4d, 0x41, 0x3b, 0xff, 0x4a, 0x45, 0x3b, 0xff, 0x4e, 0x49, 0x3f, 0xff, 0x50, 0x49, 0x3f, 0xff, 0x52, 0x49, 0x3e, 0xff, 0x50, 0x46, 0x40, 0xff, 0x4d, 0x44, 0x46, 0xff, 0x4b, 0x41, 0x3d, 0xff, 0x50, 0x44, 0x3b, 0xff, 0x4e, 0x42, 0x3a, 0xff, 0x49, 0x41, 0x39, 0xff, 0x3c, 0x36, 0x2d, 0xff, 0x21, 0x1d, 0x17, 0xff, 0x22, 0x21, 0x20, 0xff, 0x2a, 0x2b, 0x2c, 0xff, 0x2c, 0x2b, 0x2a, 0xff, 0x24, 0x21, 0x1c, 0xff, 0x1d, 0x19, 0x13, 0xff, 0x11, 0x0f, 0x0b, 0xff, 0x0a, 0x09, 0x07, 0xff, 0x0c, 0x0b, 0x09, 0xff, 0x1a, 0x19, 0x18, 0xff, 0x27, 0x24, 0x25, 0xff, 0x17, 0x16, 0x13, 0xff, 0x05, 0x05, 0x00, 0xff, 0x20, 0x1f, 0x1a, 0xff, 0x26, 0x24, 0x21, 0xff, 0x10, 0x0d, 0x0c, 0xff, 0x18, 0x17, 0x16, 0xff, 0x0f, 0x11, 0x0f, 0xff, 0x11, 0x14, 0x12, 0xff, 0x19, 0x1a, 0x11, 0xff, 0x1b, 0x15, 0x0b, 0xff, 0x0b, 0x00, 0x00, 0xff, 0x17, 0x30, 0x4c, 0xff, 0x34, 0xa0, 0xf4, 0xff, 0x25, 0x84, 0xdc, 0xff, 0x1b, 0x63, 0xce, 0xff, 0x1b, 0x64, 0xce, 0xff, 0x1c, 0x74, 0xce, 0xff, 0x1c, 0x66, 0xca, 0xff, 0x13, 0x51, 0xb9, 0xff, 0x16, 0x46, 0xaf, 0xff, 0x15, 0x3e, 0xa2, 0xff, 0x0d, 0x3a, 0x96, 0xff, 0x00, 0x2c, 0x7e, 0xff, 0x38, 0x6f, 0xb2, 0xff, 0x8d, 0xd1, 0xff, 0xff, 0x90, 0xdd, 0xff, 0xff, 0x94, 0xe5, 0xff, 0xff, 0xa2, 0xe3, 0xff, 0xff, 0xa3, 0xd5, 0xff, 0xff, 0x96, 0xc8, 0xff, 0xff, 0x8d, 0xb4, 0xff, 0xff, 0x7c, 0x9c, 0xfe, 0xff, 0x6e, 0x8c, 0xfe, 0xff, 0x64, 0x7d, 0xfd, 0xff, 0x6b, 0x79, 0xff, 0xff, 0x61, 0x68, 0xf5, 0xff, 0x3d, 0x37, 0xca, 0xff, 0x2e, 0x1d, 0xb7, 0xff, 0x18, 0x09, 0xa7, 0xff, 0x10, 0x07, 0xa7, 0xff, 0x10, 0x07, 0xa2, 0xff, 0x20, 0x11, 0x9b, 0xff, 0x38, 0x43, 0xa9, 0xff, 0x55, 0x87, 0xc9, 0xff, 0x50, 0x88, 0xc9, 0xff, 0x1a, 0x44, 0x90, 0xff, 0x07, 0x1d, 0x6d, 0xff, 0x07, 0x18, 0x6f, 0xff, 0x19, 0x47, 0x94, 0xff, 0x24, 0x51, 0xa3, 0xff, 0x36, 0x5c, 0xc2, 0xff, 0x10, 0x30, 0x7c, 0xff, 0x45, 0x2a, 0x21, 0xff, 0xff, 0xd9, 0x6a, 0xff, 0xfc, 0xcf, 0x52, 0xff, 0xf1, 0x9a, 0x69, 0xff, 0xf4, 0x74, 0x81, 0xff, 0xec, 0x68, 0x8f, 0xff, 0xe7, 0x63, 0x92, 0xff, 0xe6, 0x5b, 0x96, 0xff, 0xe1, 0x54, 0xa1, 0xff, 0xe3, 0x4e, 0xb0, 0xff, 0xe3, 0x3c, 0xba, 0xff, 0xda, 0x25, 0xc3, 0xff, 0xcb, 0x1e, 0xd5, 0xff, 0xb9, 0x1a, 0xdf, 0xff, 0xae, 0x16, 0xe8, 0xff, 0x9b, 0x16, 0xeb, 0xff, 0x87, 0x16, 0xf1, 0xff, 0x78, 0x16, 0xf4, 0xff, 0x66, 0x15, 0xf0, 0xff, 0x59, 0x15, 0xf4, 0xff, 0x46, 0x12, 0xf8, 0xff, 0x39, 0x11, 0xf7, 0xff, 0x32, 0x11, 0xf1, 0xff, 0x32, 0x0e, 0xdc, 0xff, 0x48, 0x13, 0xc8, 0xff, 0x74, 0x1a, 0xae, 0xff, 0xa7, 0x22, 0x90, 0xff, 0xc5, 0x31, 0x72, 0xff, 0xd2, 0x3f, 0x5d, 0xff, 0xe0, 0x56, 0x5d, 0xff, 0xe5, 0x61, 0x42, 0xff, 0xee, 0x70, 0x24, 0xff, 0xfb, 0x80, 0x0b, 0xff, 0xfe, 0x82, 0x03, 0xff, 0xfd, 0x88, 0x06, 0xff, 0xfd, 0x8d, 0x03, 0x8b,
+    0x8e, 0x83, 0x42, 0x6b, 0x93, 0x85, 0x42, 0xff, 0x92, 0x82, 0x3f, 0xff, 0x92, 0x7d, 0x3d, 0xff, 0x9b, 0x83, 0x44, 0xff, 0x9c, 0x82, 0x47, 0xff, 0x9a, 0x7f, 0x48, 0xff, 0x9d, 0x82, 0x48, 0xff, 0x9d, 0x86, 0x41, 0xff, 0x9c, 0x81, 0x3e, 0xff, 0x96, 0x7c, 0x3c, 0xff, 0x8d, 0x79, 0x37, 0xff, 0x80, 0x71, 0x2d, 0xff, 0x78, 0x6e, 0x28, 0xff, 0x71, 0x6c, 0x25, 0xff, 0x6b, 0x6a, 0x2a, 0xff, 0x52, 0x4c, 0x2f, 0xff, 0x4b, 0x40, 0x3a, 0xff, 0x4d, 0x43, 0x36, 0xff, 0x51, 0x46, 0x36, 0xff, 0x54, 0x47, 0x39, 0xff, 0x4f, 0x46, 0x3a, 0xff, 0x48, 0x44, 0x3e, 0xff, 0x48, 0x45, 0x44, 0xff, 0x46, 0x3f, 0x3c, 0xff, 0x51, 0x49, 0x40, 0xff, 0x51, 0x4b, 0x3e, 0xff, 0x4a, 0x46, 0x39, 0xff, 0x40, 0x40, 0x30, 0xff, 0x29, 0x28, 0x1b, 0xff, 0x1c, 0x1e, 0x18, 0xff, 0x21, 0x26, 0x23, 0xff, 0x30, 0x32, 0x2d, 0xff, 0x31, 0x2f, 0x27, 0xff, 0x20, 0x1d, 0x15, 0xff, 0x19, 0x16, 0x10, 0xff, 0x0e, 0x0d, 0x07, 0xff, 0x0d, 0x0b, 0x06, 0xff, 0x11, 0x0b, 0x0b, 0xff, 0x1b, 0x15, 0x16, 0xff, 0x21, 0x1b, 0x1a, 0xff, 0x10, 0x0d, 0x08, 0xff, 0x10, 0x10, 0x0a, 0xff, 0x2f, 0x2d, 0x29, 0xff, 0x13, 0x11, 0x0e, 0xff, 0x16, 0x14, 0x12, 0xff, 0x0e, 0x11, 0x0e, 0xff, 0x0f, 0x11, 0x12, 0xff, 0x16, 0x14, 0x15, 0xff, 0x19, 0x12, 0x11, 0xff, 0x16, 0x01, 0x00, 0xff, 0x11, 0x19, 0x26, 0xff, 0x2d, 0x92, 0xe4, 0xff, 0x2d, 0x87, 0xe5, 0xff, 0x26, 0x71, 0xd3, 0xff, 0x2d, 0x7f, 0xdb, 0xff, 0x2b, 0x88, 0xd7, 0xff, 0x22, 0x71, 0xca, 0xff, 0x19, 0x56, 0xb5, 0xff, 0x22, 0x4d, 0xb0, 0xff, 0x17, 0x39, 0x9a, 0xff, 0x01, 0x25, 0x82, 0xff, 0x01, 0x31, 0x85, 0xff, 0x4c, 0x8b, 0xcc, 0xff, 0x72, 0xb7, 0xee, 0xff, 0x4f, 0x93, 0xd2, 0xff, 0x37, 0x73, 0xcc, 0xff, 0x35, 0x59, 0xc8, 0xff, 0x24, 0x2d, 0xb7, 0xff, 0x13, 0x10, 0xad, 0xff, 0x08, 0x05, 0xac, 0xff, 0x00, 0x00, 0xa5, 0xff, 0x00, 0x00, 0x9f, 0xff, 0x00, 0x00, 0x9b, 0xff, 0x00, 0x00, 0x93, 0xff, 0x00, 0x00, 0x8c, 0xff, 0x00, 0x00, 0x8f, 0xff, 0x07, 0x02, 0x97, 0xff, 0x04, 0x01, 0x86, 0xff, 0x0c, 0x11, 0x87, 0xff, 0x11, 0x16, 0x73, 0xff, 0x07, 0x06, 0x37, 0xff, 0x00, 0x00, 0x2d, 0xff, 0x06, 0x18, 0x49, 0xff, 0x19, 0x42, 0x77, 0xff, 0x3d, 0x68, 0xa8, 0xff, 0x2c, 0x57, 0xa1, 0xff, 0x1b, 0x42, 0x96, 0xff, 0x3c, 0x72, 0xba, 0xff, 0x32, 0x6c, 0xb4, 0xff, 0x45, 0x64, 0xc8, 0xff, 0x06, 0x0f, 0x51, 0xff, 0x81, 0x68, 0x30, 0xff, 0xff, 0xf8, 0x60, 0xff, 0xfa, 0xbe, 0x4f, 0xff, 0xf1, 0x88, 0x71, 0xff, 0xf2, 0x6e, 0x84, 0xff, 0xe7, 0x6a, 0x8c, 0xff, 0xde, 0x66, 0x8b, 0xff, 0xdd, 0x5b, 0x92, 0xff, 0xe0, 0x53, 0xa1, 0xff, 0xe7, 0x49, 0xb4, 0xff, 0xe2, 0x35, 0xbd, 0xff, 0xd2, 0x21, 0xc5, 0xff, 0xc5, 0x1c, 0xd4, 0xff, 0xb7, 0x1c, 0xdb, 0xff, 0xaa, 0x19, 0xe3, 0xff, 0x92, 0x16, 0xe5, 0xff, 0x7b, 0x15, 0xeb, 0xff, 0x6d, 0x16, 0xf0, 0xff, 0x5c, 0x17, 0xf0, 0xff, 0x51, 0x15, 0xf3, 0xff, 0x41, 0x10, 0xf9, 0xff, 0x36, 0x0e, 0xf5, 0xff, 0x30, 0x0d, 0xeb, 0xff, 0x31, 0x0b, 0xd9, 0xff, 0x45, 0x13, 0xc9, 0xff, 0x6f, 0x1c, 0xb0, 0xff, 0xa2, 0x25, 0x94, 0xff, 0xbd, 0x2c, 0x75, 0xff, 0xca, 0x32, 0x58, 0xff, 0xdf, 0x4f, 0x5a, 0xff, 0xe7, 0x61, 0x4a, 0xff, 0xe9, 0x6b, 0x2a, 0xff, 0xf7, 0x7e, 0x0e, 0xff, 0xff, 0x87, 0x04, 0xff, 0xfc, 0x87, 0x02, 0xff, 0xfc, 0x85, 0x00, 0x6b,
+    0x88, 0x7a, 0x39, 0x4b, 0x88, 0x7c, 0x35, 0xff, 0x87, 0x79, 0x33, 0xff, 0x88, 0x74, 0x33, 0xff, 0x90, 0x79, 0x3b, 0xff, 0x94, 0x7a, 0x3f, 0xff, 0x90, 0x79, 0x40, 0xff, 0x91, 0x7b, 0x3f, 0xff, 0x99, 0x7f, 0x3d, 0xff, 0x97, 0x7b, 0x38, 0xff, 0x8e, 0x76, 0x33, 0xff, 0x84, 0x72, 0x2e, 0xff, 0x77, 0x6d, 0x23, 0xff, 0x75, 0x70, 0x22, 0xff, 0x71, 0x6c, 0x27, 0xff, 0x69, 0x66, 0x2d, 0xff, 0x4d, 0x46, 0x2d, 0xff, 0x45, 0x38, 0x32, 0xff, 0x4b, 0x40, 0x31, 0xff, 0x4d, 0x44, 0x31, 0xff, 0x4f, 0x42, 0x35, 0xff, 0x51, 0x49, 0x3e, 0xff, 0x45, 0x43, 0x3b, 0xff, 0x45, 0x42, 0x3e, 0xff, 0x4c, 0x46, 0x42, 0xff, 0x51, 0x4b, 0x42, 0xff, 0x54, 0x51, 0x44, 0xff, 0x4a, 0x44, 0x38, 0xff, 0x40, 0x39, 0x2a, 0xff, 0x30, 0x2c, 0x1c, 0xff, 0x1f, 0x1f, 0x14, 0xff, 0x27, 0x25, 0x22, 0xff, 0x2d, 0x2b, 0x27, 0xff, 0x37, 0x34, 0x2e, 0xff, 0x32, 0x2e, 0x2b, 0xff, 0x28, 0x25, 0x21, 0xff, 0x15, 0x12, 0x0e, 0xff, 0x11, 0x0e, 0x0a, 0xff, 0x0d, 0x0a, 0x06, 0xff, 0x10, 0x0d, 0x09, 0xff, 0x1b, 0x18, 0x14, 0xff, 0x15, 0x11, 0x0d, 0xff, 0x09, 0x05, 0x02, 0xff, 0x26, 0x23, 0x20, 0xff, 0x1b, 0x1a, 0x16, 0xff, 0x0e, 0x0f, 0x0b, 0xff, 0x10, 0x13, 0x11, 0xff, 0x0e, 0x11, 0x0f, 0xff, 0x13, 0x15, 0x13, 0xff, 0x0f, 0x11, 0x11, 0xff, 0x17, 0x05, 0x00, 0xff, 0x07, 0x05, 0x0a, 0xff, 0x2f, 0x81, 0xc2, 0xff, 0x34, 0x95, 0xf9, 0xff, 0x2c, 0x7f, 0xe1, 0xff, 0x31, 0x87, 0xdf, 0xff, 0x34, 0x87, 0xd7, 0xff, 0x35, 0x7f, 0xcf, 0xff, 0x2d, 0x6d, 0xc1, 0xff, 0x39, 0x75, 0xc7, 0xff, 0x22, 0x59, 0xa8, 0xff, 0x0b, 0x3e, 0x8b, 0xff, 0x1b, 0x4c, 0x94, 0xff, 0x14, 0x3a, 0x74, 0xff, 0x09, 0x16, 0x4f, 0xff, 0x00, 0x08, 0x69, 0xff, 0x00, 0x0a, 0x80, 0xff, 0x00, 0x00, 0x6e, 0xff, 0x04, 0x19, 0x96, 0xff, 0x03, 0x0b, 0x82, 0xff, 0x00, 0x07, 0x77, 0xff, 0x12, 0x30, 0xa2, 0xff, 0x0b, 0x13, 0x85, 0xff, 0x00, 0x03, 0x6d, 0xff, 0x18, 0x22, 0x83, 0xff, 0x11, 0x18, 0x71, 0xff, 0x0a, 0x12, 0x5e, 0xff, 0x3f, 0x49, 0x89, 0xff, 0x52, 0x5c, 0x8b, 0xff, 0x51, 0x5e, 0x80, 0xff, 0x8b, 0x99, 0xa6, 0xff, 0x40, 0x46, 0x44, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x02, 0xff, 0x3c, 0x5c, 0x93, 0xff, 0x7f, 0xb4, 0xef, 0xff, 0x69, 0xa9, 0xdf, 0xff, 0x59, 0x94, 0xd8, 0xff, 0x5c, 0x9a, 0xea, 0xff, 0x3a, 0x7f, 0xce, 0xff, 0x31, 0x59, 0xb5, 0xff, 0x21, 0x11, 0x32, 0xff, 0xcf, 0xaf, 0x4c, 0xff, 0xff, 0xeb, 0x5a, 0xff, 0xf8, 0xa6, 0x56, 0xff, 0xf6, 0x7d, 0x70, 0xff, 0xeb, 0x6e, 0x7e, 0xff, 0xe8, 0x68, 0x87, 0xff, 0xe6, 0x62, 0x8b, 0xff, 0xe3, 0x59, 0x94, 0xff, 0xe4, 0x50, 0xa3, 0xff, 0xde, 0x3e, 0xae, 0xff, 0xd8, 0x2d, 0xba, 0xff, 0xc6, 0x22, 0xc6, 0xff, 0xb6, 0x1b, 0xce, 0xff, 0xac, 0x19, 0xd5, 0xff, 0x9f, 0x16, 0xde, 0xff, 0x8c, 0x14, 0xe4, 0xff, 0x73, 0x12, 0xec, 0xff, 0x64, 0x14, 0xef, 0xff, 0x4f, 0x13, 0xed, 0xff, 0x43, 0x12, 0xef, 0xff, 0x37, 0x11, 0xf5, 0xff, 0x2d, 0x0c, 0xf1, 0xff, 0x27, 0x0b, 0xdf, 0xff, 0x31, 0x10, 0xd7, 0xff, 0x45, 0x14, 0xc3, 0xff, 0x6c, 0x1c, 0xad, 0xff, 0x9a, 0x28, 0x95, 0xff, 0xb4, 0x2a, 0x75, 0xff, 0xc8, 0x2b, 0x54, 0xff, 0xd7, 0x3e, 0x4c, 0xff, 0xdf, 0x52, 0x48, 0xff, 0xe4, 0x64, 0x31, 0xff, 0xf0, 0x75, 0x13, 0xff, 0xfa, 0x7f, 0x05, 0xff, 0xfb, 0x80, 0x02, 0xff, 0xfb, 0x81, 0x03, 0x4b,
+    0x7b, 0x7b, 0x2e, 0x21, 0x7d, 0x76, 0x2c, 0xff, 0x7e, 0x73, 0x2e, 0xff, 0x80, 0x72, 0x2f, 0xff, 0x88, 0x76, 0x36, 0xff, 0x8b, 0x77, 0x39, 0xff, 0x8a, 0x77, 0x3c, 0xff, 0x8b, 0x79, 0x3d, 0xff, 0x8f, 0x79, 0x39, 0xff, 0x8c, 0x77, 0x32, 0xff, 0x84, 0x76, 0x2a, 0xff, 0x7e, 0x76, 0x26, 0xff, 0x78, 0x74, 0x21, 0xff, 0x71, 0x70, 0x20, 0xff, 0x6c, 0x68, 0x2b, 0xff, 0x5b, 0x57, 0x28, 0xff, 0x49, 0x40, 0x2b, 0xff, 0x47, 0x3c, 0x35, 0xff, 0x4d, 0x44, 0x36, 0xff, 0x50, 0x47, 0x37, 0xff, 0x50, 0x46, 0x39, 0xff, 0x4c, 0x43, 0x39, 0xff, 0x42, 0x3f, 0x36, 0xff, 0x4b, 0x48, 0x44, 0xff, 0x54, 0x4c, 0x48, 0xff, 0x4e, 0x47, 0x3e, 0xff, 0x51, 0x4d, 0x41, 0xff, 0x4d, 0x46, 0x39, 0xff, 0x43, 0x3b, 0x2d, 0xff, 0x3d, 0x36, 0x28, 0xff, 0x36, 0x2c, 0x23, 0xff, 0x34, 0x29, 0x24, 0xff, 0x32, 0x2a, 0x26, 0xff, 0x31, 0x2d, 0x2a, 0xff, 0x38, 0x34, 0x34, 0xff, 0x36, 0x32, 0x32, 0xff, 0x29, 0x25, 0x24, 0xff, 0x15, 0x10, 0x0f, 0xff, 0x0f, 0x0c, 0x07, 0xff, 0x0e, 0x0b, 0x07, 0xff, 0x15, 0x13, 0x0e, 0xff, 0x18, 0x15, 0x11, 0xff, 0x0d, 0x0a, 0x06, 0xff, 0x14, 0x13, 0x0f, 0xff, 0x1e, 0x1e, 0x1a, 0xff, 0x0a, 0x0b, 0x08, 0xff, 0x0d, 0x10, 0x0e, 0xff, 0x0d, 0x10, 0x0e, 0xff, 0x11, 0x15, 0x12, 0xff, 0x0d, 0x13, 0x12, 0xff, 0x14, 0x0a, 0x09, 0xff, 0x03, 0x00, 0x00, 0xff, 0x2f, 0x5f, 0x98, 0xff, 0x35, 0xa2, 0xff, 0xff, 0x28, 0x87, 0xe1, 0xff, 0x2b, 0x82, 0xd8, 0xff, 0x3d, 0x88, 0xd8, 0xff, 0x4c, 0x8e, 0xd9, 0xff, 0x4d, 0x91, 0xd6, 0xff, 0x54, 0x9a, 0xdd, 0xff, 0x40, 0x88, 0xc6, 0xff, 0x32, 0x7d, 0xb8, 0xff, 0x4b, 0x82, 0xbd, 0xff, 0x2f, 0x37, 0x60, 0xff, 0x00, 0x00, 0x00, 0xff, 0x15, 0x1e, 0x44, 0xff, 0x28, 0x53, 0x97, 0xff, 0x09, 0x2e, 0x8b, 0xff, 0x1d, 0x5c, 0xc5, 0xff, 0x07, 0x54, 0xaf, 0xff, 0x20, 0x61, 0xad, 0xff, 0x4f, 0x99, 0xbf, 0xff, 0x4a, 0x80, 0x9e, 0xff, 0x2b, 0x4d, 0x89, 0xff, 0x51, 0x6b, 0xb2, 0xff, 0x35, 0x4a, 0x89, 0xff, 0x25, 0x36, 0x62, 0xff, 0x67, 0x77, 0x8d, 0xff, 0x83, 0x94, 0x9e, 0xff, 0x77, 0x86, 0x8b, 0xff, 0xac, 0xb9, 0xba, 0xff, 0x4b, 0x51, 0x51, 0xff, 0x00, 0x00, 0x00, 0xff, 0x45, 0x4e, 0x64, 0xff, 0xa8, 0xd0, 0xff, 0xff, 0x92, 0xd4, 0xff, 0xff, 0x79, 0xc8, 0xeb, 0xff, 0x7e, 0xc9, 0xfa, 0xff, 0x6f, 0xbc, 0xff, 0xff, 0x42, 0x91, 0xe2, 0xff, 0x1e, 0x3f, 0x8c, 0xff, 0x41, 0x23, 0x1b, 0xff, 0xff, 0xd6, 0x63, 0xff, 0xff, 0xbf, 0x54, 0xff, 0xf4, 0x8e, 0x66, 0xff, 0xf1, 0x78, 0x71, 0xff, 0xeb, 0x6f, 0x74, 0xff, 0xec, 0x64, 0x87, 0xff, 0xed, 0x5d, 0x91, 0xff, 0xe8, 0x55, 0x93, 0xff, 0xe4, 0x4d, 0xa0, 0xff, 0xd8, 0x39, 0xa6, 0xff, 0xd2, 0x2c, 0xb6, 0xff, 0xc1, 0x25, 0xc6, 0xff, 0xb1, 0x1e, 0xcd, 0xff, 0xa4, 0x1b, 0xd3, 0xff, 0x95, 0x15, 0xdc, 0xff, 0x7f, 0x11, 0xe3, 0xff, 0x67, 0x0f, 0xeb, 0xff, 0x55, 0x10, 0xed, 0xff, 0x42, 0x11, 0xeb, 0xff, 0x36, 0x10, 0xec, 0xff, 0x29, 0x0e, 0xf0, 0xff, 0x1e, 0x0b, 0xea, 0xff, 0x1a, 0x0c, 0xd7, 0xff, 0x20, 0x0f, 0xc7, 0xff, 0x34, 0x10, 0xb4, 0xff, 0x5a, 0x17, 0xa0, 0xff, 0x8c, 0x24, 0x8d, 0xff, 0xaf, 0x2a, 0x71, 0xff, 0xc3, 0x2a, 0x54, 0xff, 0xcd, 0x37, 0x4a, 0xff, 0xd7, 0x48, 0x47, 0xff, 0xe3, 0x5c, 0x38, 0xff, 0xf3, 0x71, 0x20, 0xff, 0xf7, 0x75, 0x0d, 0xff, 0xf9, 0x79, 0x08, 0xff, 0xf7, 0x7b, 0x07, 0x21,
+    0x00, 0x00, 0x00, 0x01, 0x72, 0x71, 0x24, 0xf2, 0x75, 0x71, 0x28, 0xff, 0x79, 0x71, 0x2b, 0xff, 0x7f, 0x74, 0x30, 0xff, 0x82, 0x76, 0x34, 0xff, 0x80, 0x75, 0x38, 0xff, 0x80, 0x75, 0x3a, 0xff, 0x85, 0x75, 0x36, 0xff, 0x81, 0x75, 0x32, 0xff, 0x7b, 0x77, 0x28, 0xff, 0x75, 0x76, 0x1e, 0xff, 0x6f, 0x72, 0x1a, 0xff, 0x6a, 0x6e, 0x1e, 0xff, 0x63, 0x60, 0x2c, 0xff, 0x4f, 0x49, 0x28, 0xff, 0x49, 0x3f, 0x30, 0xff, 0x49, 0x40, 0x3a, 0xff, 0x48, 0x42, 0x35, 0xff, 0x48, 0x42, 0x33, 0xff, 0x49, 0x42, 0x37, 0xff, 0x48, 0x3e, 0x35, 0xff, 0x49, 0x42, 0x3a, 0xff, 0x4b, 0x46, 0x43, 0xff, 0x52, 0x49, 0x46, 0xff, 0x4f, 0x47, 0x3e, 0xff, 0x4d, 0x46, 0x3a, 0xff, 0x50, 0x47, 0x3a, 0xff, 0x52, 0x49, 0x3a, 0xff, 0x4d, 0x43, 0x37, 0xff, 0x45, 0x36, 0x2d, 0xff, 0x3b, 0x29, 0x1f, 0xff, 0x31, 0x29, 0x23, 0xff, 0x2c, 0x2a, 0x28, 0xff, 0x29, 0x25, 0x24, 0xff, 0x37, 0x33, 0x32, 0xff, 0x37, 0x33, 0x32, 0xff, 0x25, 0x22, 0x1f, 0xff, 0x19, 0x17, 0x12, 0xff, 0x0c, 0x09, 0x05, 0xff, 0x0d, 0x0a, 0x05, 0xff, 0x1a, 0x17, 0x12, 0xff, 0x0f, 0x0f, 0x0a, 0xff, 0x0b, 0x0c, 0x08, 0xff, 0x1a, 0x1d, 0x17, 0xff, 0x0f, 0x12, 0x0d, 0xff, 0x0c, 0x0d, 0x0b, 0xff, 0x0c, 0x0f, 0x0d, 0xff, 0x0c, 0x13, 0x10, 0xff, 0x0d, 0x13, 0x11, 0xff, 0x12, 0x0d, 0x10, 0xff, 0x01, 0x00, 0x00, 0xff, 0x1f, 0x34, 0x58, 0xff, 0x43, 0xa5, 0xfb, 0xff, 0x29, 0x8d, 0xe7, 0xff, 0x2a, 0x82, 0xd9, 0xff, 0x3a, 0x87, 0xd8, 0xff, 0x4f, 0x93, 0xd9, 0xff, 0x55, 0x9f, 0xdb, 0xff, 0x5c, 0xa8, 0xe2, 0xff, 0x63, 0xb2, 0xe7, 0xff, 0x5c, 0xac, 0xdf, 0xff, 0x7b, 0xc0, 0xf0, 0xff, 0xb2, 0xda, 0xfd, 0xff, 0x53, 0x58, 0x6f, 0xff, 0x00, 0x00, 0x26, 0xff, 0x15, 0x31, 0x6b, 0xff, 0x0e, 0x21, 0x69, 0xff, 0x26, 0x53, 0x9f, 0xff, 0x39, 0x76, 0xb8, 0xff, 0x4d, 0x7e, 0xae, 0xff, 0xac, 0xe5, 0xf9, 0xff, 0xa3, 0xd1, 0xe3, 0xff, 0x50, 0x7b, 0xa5, 0xff, 0x50, 0x7c, 0xb8, 0xff, 0x3c, 0x60, 0x9d, 0xff, 0x30, 0x4c, 0x7b, 0xff, 0x69, 0x86, 0x9c, 0xff, 0x88, 0xa0, 0xa7, 0xff, 0x59, 0x68, 0x72, 0xff, 0x4c, 0x53, 0x6d, 0xff, 0x08, 0x09, 0x32, 0xff, 0x11, 0x0b, 0x59, 0xff, 0xa5, 0xaf, 0xef, 0xff, 0xb3, 0xe2, 0xff, 0xff, 0x84, 0xcf, 0xea, 0xff, 0x71, 0xc5, 0xe3, 0xff, 0x7f, 0xd0, 0xfa, 0xff, 0x68, 0xb8, 0xeb, 0xff, 0x4d, 0x90, 0xda, 0xff, 0x16, 0x2e, 0x64, 0xff, 0x1a, 0x0d, 0x00, 0xff, 0xbd, 0x87, 0x35, 0xff, 0xff, 0xac, 0x72, 0xff, 0xfc, 0x88, 0x69, 0xff, 0xef, 0x79, 0x6e, 0xff, 0xea, 0x6c, 0x77, 0xff, 0xe5, 0x5f, 0x84, 0xff, 0xe4, 0x59, 0x8e, 0xff, 0xe3, 0x53, 0x94, 0xff, 0xdf, 0x48, 0x9b, 0xff, 0xd6, 0x34, 0xa0, 0xff, 0xd2, 0x2b, 0xb3, 0xff, 0xbe, 0x26, 0xc2, 0xff, 0xb0, 0x20, 0xcc, 0xff, 0xa3, 0x1d, 0xd2, 0xff, 0x8e, 0x17, 0xdb, 0xff, 0x75, 0x12, 0xe0, 0xff, 0x5d, 0x10, 0xe8, 0xff, 0x4b, 0x11, 0xea, 0xff, 0x39, 0x11, 0xe8, 0xff, 0x2f, 0x12, 0xe8, 0xff, 0x1e, 0x0f, 0xe7, 0xff, 0x13, 0x0c, 0xdf, 0xff, 0x11, 0x0f, 0xcb, 0xff, 0x18, 0x0f, 0xba, 0xff, 0x29, 0x14, 0xae, 0xff, 0x47, 0x17, 0x9b, 0xff, 0x70, 0x1d, 0x85, 0xff, 0x99, 0x27, 0x71, 0xff, 0xba, 0x2c, 0x58, 0xff, 0xc2, 0x31, 0x46, 0xff, 0xd4, 0x45, 0x47, 0xff, 0xea, 0x5d, 0x46, 0xff, 0xf4, 0x6a, 0x2a, 0xff, 0xf8, 0x6f, 0x18, 0xff, 0xfb, 0x76, 0x0d, 0xf2, 0xff, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x6d, 0x71, 0x24, 0xc6, 0x6e, 0x6f, 0x25, 0xff, 0x6e, 0x6b, 0x24, 0xff, 0x70, 0x6a, 0x24, 0xff, 0x77, 0x6f, 0x2d, 0xff, 0x75, 0x6f, 0x32, 0xff, 0x72, 0x6d, 0x2f, 0xff, 0x77, 0x6d, 0x2e, 0xff, 0x78, 0x70, 0x30, 0xff, 0x73, 0x73, 0x26, 0xff, 0x6a, 0x70, 0x17, 0xff, 0x65, 0x6b, 0x14, 0xff, 0x5f, 0x66, 0x19, 0xff, 0x57, 0x56, 0x28, 0xff, 0x49, 0x40, 0x2b, 0xff, 0x48, 0x3d, 0x32, 0xff, 0x4b, 0x43, 0x3c, 0xff, 0x4d, 0x47, 0x3b, 0xff, 0x4c, 0x46, 0x39, 0xff, 0x49, 0x44, 0x39, 0xff, 0x49, 0x42, 0x38, 0xff, 0x4d, 0x44, 0x3d, 0xff, 0x46, 0x40, 0x3c, 0xff, 0x4e, 0x44, 0x40, 0xff, 0x50, 0x47, 0x3e, 0xff, 0x51, 0x48, 0x3d, 0xff, 0x51, 0x48, 0x3b, 0xff, 0x50, 0x47, 0x39, 0xff, 0x4d, 0x44, 0x39, 0xff, 0x44, 0x36, 0x2c, 0xff, 0x3f, 0x2e, 0x22, 0xff, 0x38, 0x31, 0x2b, 0xff, 0x33, 0x31, 0x2f, 0xff, 0x34, 0x31, 0x2e, 0xff, 0x33, 0x30, 0x2c, 0xff, 0x35, 0x33, 0x2d, 0xff, 0x39, 0x36, 0x31, 0xff, 0x2a, 0x26, 0x22, 0xff, 0x1d, 0x19, 0x13, 0xff, 0x0f, 0x0c, 0x06, 0xff, 0x11, 0x0e, 0x0a, 0xff, 0x13, 0x13, 0x10, 0xff, 0x0b, 0x0c, 0x08, 0xff, 0x11, 0x15, 0x10, 0xff, 0x12, 0x15, 0x12, 0xff, 0x0c, 0x0d, 0x0c, 0xff, 0x0b, 0x0f, 0x0d, 0xff, 0x09, 0x13, 0x10, 0xff, 0x0d, 0x11, 0x10, 0xff, 0x0b, 0x0e, 0x0f, 0xff, 0x03, 0x00, 0x00, 0xff, 0x0d, 0x0b, 0x1e, 0xff, 0x3f, 0x8c, 0xd8, 0xff, 0x2f, 0x99, 0xf2, 0xff, 0x2a, 0x85, 0xe3, 0xff, 0x38, 0x88, 0xdf, 0xff, 0x47, 0x92, 0xda, 0xff, 0x4d, 0x9a, 0xd9, 0xff, 0x55, 0xa1, 0xdd, 0xff, 0x68, 0xb2, 0xeb, 0xff, 0x7b, 0xbe, 0xf7, 0xff, 0x86, 0xc5, 0xfc, 0xff, 0x84, 0xd5, 0xfc, 0xff, 0xb7, 0xee, 0xff, 0xff, 0x94, 0xa5, 0xd7, 0xff, 0x46, 0x54, 0xa1, 0xff, 0x0f, 0x13, 0x57, 0xff, 0x20, 0x2b, 0x6a, 0xff, 0x31, 0x38, 0x7c, 0xff, 0x00, 0x00, 0x2f, 0xff, 0x4a, 0x50, 0x8e, 0xff, 0x37, 0x3e, 0x8d, 0xff, 0x3c, 0x57, 0x9f, 0xff, 0x5f, 0x80, 0xc9, 0xff, 0x30, 0x45, 0x9a, 0xff, 0x28, 0x33, 0x88, 0xff, 0x5a, 0x67, 0xa7, 0xff, 0x4e, 0x58, 0x93, 0xff, 0x0a, 0x0a, 0x4f, 0xff, 0x1e, 0x16, 0x72, 0xff, 0x42, 0x37, 0xb4, 0xff, 0x74, 0x6f, 0xed, 0xff, 0x98, 0xaf, 0xf5, 0xff, 0x9f, 0xd7, 0xee, 0xff, 0x82, 0xc9, 0xe4, 0xff, 0x71, 0xbd, 0xf0, 0xff, 0x7b, 0xc4, 0xf7, 0xff, 0x5f, 0xa0, 0xd4, 0xff, 0x4c, 0x76, 0xbb, 0xff, 0x15, 0x17, 0x39, 0xff, 0x17, 0x06, 0x00, 0xff, 0x4c, 0x2a, 0x16, 0xff, 0xd5, 0x80, 0x5f, 0xff, 0xff, 0x9c, 0x65, 0xff, 0xec, 0x75, 0x62, 0xff, 0xdf, 0x65, 0x7c, 0xff, 0xdc, 0x60, 0x85, 0xff, 0xd7, 0x5b, 0x89, 0xff, 0xd7, 0x51, 0x91, 0xff, 0xd5, 0x41, 0x94, 0xff, 0xd7, 0x33, 0x9e, 0xff, 0xd4, 0x29, 0xb0, 0xff, 0xbc, 0x20, 0xbc, 0xff, 0xae, 0x1e, 0xc7, 0xff, 0xa2, 0x1c, 0xd0, 0xff, 0x8c, 0x18, 0xd7, 0xff, 0x71, 0x14, 0xdc, 0xff, 0x58, 0x10, 0xe3, 0xff, 0x46, 0x11, 0xe6, 0xff, 0x35, 0x11, 0xe3, 0xff, 0x2b, 0x11, 0xe1, 0xff, 0x1b, 0x0f, 0xdf, 0xff, 0x10, 0x0e, 0xd4, 0xff, 0x11, 0x13, 0xc4, 0xff, 0x17, 0x10, 0xb7, 0xff, 0x1e, 0x10, 0xa9, 0xff, 0x37, 0x15, 0x9a, 0xff, 0x5c, 0x1c, 0x87, 0xff, 0x83, 0x24, 0x73, 0xff, 0xb1, 0x30, 0x5f, 0xff, 0xc1, 0x32, 0x47, 0xff, 0xd3, 0x42, 0x42, 0xff, 0xe9, 0x5a, 0x45, 0xff, 0xf3, 0x66, 0x30, 0xff, 0xf6, 0x6a, 0x1b, 0xff, 0xf4, 0x6d, 0x09, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x63, 0x68, 0x1e, 0x90, 0x63, 0x66, 0x1e, 0xff, 0x64, 0x63, 0x1e, 0xff, 0x64, 0x62, 0x1f, 0xff, 0x6c, 0x64, 0x28, 0xff, 0x71, 0x6e, 0x2e, 0xff, 0x69, 0x6b, 0x27, 0xff, 0x68, 0x68, 0x24, 0xff, 0x6b, 0x6d, 0x24, 0xff, 0x62, 0x65, 0x1c, 0xff, 0x5d, 0x63, 0x11, 0xff, 0x5c, 0x63, 0x13, 0xff, 0x54, 0x59, 0x18, 0xff, 0x4f, 0x4e, 0x27, 0xff, 0x4c, 0x43, 0x37, 0xff, 0x4a, 0x40, 0x38, 0xff, 0x48, 0x42, 0x35, 0xff, 0x49, 0x45, 0x37, 0xff, 0x49, 0x46, 0x3a, 0xff, 0x46, 0x44, 0x3a, 0xff, 0x4e, 0x4a, 0x42, 0xff, 0x4c, 0x44, 0x3e, 0xff, 0x4e, 0x46, 0x3f, 0xff, 0x4b, 0x41, 0x3a, 0xff, 0x45, 0x3e, 0x37, 0xff, 0x51, 0x4d, 0x45, 0xff, 0x51, 0x4b, 0x43, 0xff, 0x4d, 0x47, 0x3f, 0xff, 0x50, 0x4a, 0x42, 0xff, 0x4c, 0x44, 0x3b, 0xff, 0x48, 0x3d, 0x35, 0xff, 0x44, 0x3b, 0x33, 0xff, 0x3f, 0x3a, 0x34, 0xff, 0x33, 0x31, 0x2c, 0xff, 0x34, 0x32, 0x29, 0xff, 0x37, 0x37, 0x2c, 0xff, 0x36, 0x34, 0x2c, 0xff, 0x32, 0x2e, 0x29, 0xff, 0x27, 0x25, 0x1c, 0xff, 0x1c, 0x1b, 0x14, 0xff, 0x0f, 0x0d, 0x0b, 0xff, 0x0c, 0x0a, 0x0b, 0xff, 0x0c, 0x0e, 0x09, 0xff, 0x0c, 0x0d, 0x0c, 0xff, 0x0e, 0x11, 0x12, 0xff, 0x08, 0x0d, 0x0c, 0xff, 0x09, 0x0e, 0x0d, 0xff, 0x0c, 0x11, 0x12, 0xff, 0x0f, 0x10, 0x11, 0xff, 0x05, 0x0c, 0x0a, 0xff, 0x09, 0x06, 0x01, 0xff, 0x01, 0x00, 0x03, 0xff, 0x33, 0x66, 0x9f, 0xff, 0x37, 0x9e, 0xf7, 0xff, 0x2a, 0x8a, 0xec, 0xff, 0x38, 0x8a, 0xe0, 0xff, 0x38, 0x90, 0xdb, 0xff, 0x4a, 0x94, 0xdd, 0xff, 0x57, 0x9e, 0xdf, 0xff, 0x67, 0xa9, 0xe4, 0xff, 0x72, 0xb3, 0xf0, 0xff, 0x75, 0xbb, 0xf6, 0xff, 0x73, 0xc9, 0xf2, 0xff, 0x79, 0xca, 0xeb, 0xff, 0x9f, 0xd9, 0xfb, 0xff, 0xa7, 0xd8, 0xff, 0xff, 0x98, 0xb4, 0xfe, 0xff, 0x74, 0x83, 0xe7, 0xff, 0x59, 0x5c, 0xcc, 0xff, 0x59, 0x53, 0xc1, 0xff, 0x46, 0x44, 0xb8, 0xff, 0x3e, 0x41, 0xb9, 0xff, 0x58, 0x5c, 0xcd, 0xff, 0x5a, 0x5b, 0xd5, 0xff, 0x47, 0x42, 0xc7, 0xff, 0x59, 0x4b, 0xd3, 0xff, 0x60, 0x4e, 0xd4, 0xff, 0x53, 0x3d, 0xc8, 0xff, 0x72, 0x57, 0xe8, 0xff, 0x8a, 0x6f, 0xff, 0xff, 0x7a, 0x6a, 0xff, 0xff, 0x75, 0x85, 0xea, 0xff, 0x87, 0xab, 0xda, 0xff, 0xa0, 0xd4, 0xf3, 0xff, 0x79, 0xbe, 0xe5, 0xff, 0x75, 0xbe, 0xfe, 0xff, 0x72, 0xb2, 0xf1, 0xff, 0x58, 0x7f, 0xd4, 0xff, 0x3a, 0x4c, 0x94, 0xff, 0x08, 0x02, 0x0b, 0xff, 0x37, 0x1a, 0x14, 0xff, 0x20, 0x0f, 0x24, 0xff, 0x45, 0x20, 0x12, 0xff, 0xef, 0x85, 0x4e, 0xff, 0xfe, 0x80, 0x68, 0xff, 0xd7, 0x61, 0x73, 0xff, 0xda, 0x5d, 0x85, 0xff, 0xd8, 0x58, 0x86, 0xff, 0xd3, 0x4a, 0x89, 0xff, 0xd6, 0x3b, 0x8d, 0xff, 0xd3, 0x30, 0x98, 0xff, 0xcc, 0x26, 0xa8, 0xff, 0xb9, 0x20, 0xb8, 0xff, 0xa7, 0x1c, 0xc1, 0xff, 0x95, 0x1b, 0xc8, 0xff, 0x7e, 0x18, 0xd1, 0xff, 0x6b, 0x15, 0xd7, 0xff, 0x4e, 0x11, 0xde, 0xff, 0x3a, 0x11, 0xe3, 0xff, 0x31, 0x14, 0xdf, 0xff, 0x24, 0x12, 0xd7, 0xff, 0x1c, 0x12, 0xd6, 0xff, 0x16, 0x13, 0xd2, 0xff, 0x0f, 0x12, 0xc7, 0xff, 0x0f, 0x10, 0xb6, 0xff, 0x1b, 0x0f, 0xaa, 0xff, 0x2e, 0x17, 0xa0, 0xff, 0x4f, 0x21, 0x8e, 0xff, 0x71, 0x22, 0x75, 0xff, 0x9a, 0x2b, 0x65, 0xff, 0xb4, 0x2e, 0x4b, 0xff, 0xcd, 0x39, 0x3b, 0xff, 0xe0, 0x4e, 0x3b, 0xff, 0xe7, 0x58, 0x32, 0xff, 0xf1, 0x60, 0x20, 0xff, 0xf6, 0x6a, 0x0a, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x56, 0x59, 0x17, 0x58, 0x5a, 0x5d, 0x18, 0xff, 0x5d, 0x5e, 0x1b, 0xff, 0x60, 0x60, 0x1e, 0xff, 0x5e, 0x5e, 0x1b, 0xff, 0x5c, 0x61, 0x1d, 0xff, 0x59, 0x5f, 0x1d, 0xff, 0x59, 0x5c, 0x19, 0xff, 0x59, 0x61, 0x19, 0xff, 0x54, 0x5b, 0x17, 0xff, 0x4f, 0x5a, 0x11, 0xff, 0x4e, 0x59, 0x14, 0xff, 0x4f, 0x53, 0x1d, 0xff, 0x4c, 0x48, 0x2b, 0xff, 0x4f, 0x44, 0x3d, 0xff, 0x4e, 0x44, 0x3c, 0xff, 0x48, 0x44, 0x36, 0xff, 0x3f, 0x3f, 0x32, 0xff, 0x3e, 0x3d, 0x33, 0xff, 0x3b, 0x3b, 0x30, 0xff, 0x3e, 0x3a, 0x32, 0xff, 0x49, 0x41, 0x3b, 0xff, 0x51, 0x49, 0x42, 0xff, 0x52, 0x47, 0x40, 0xff, 0x52, 0x4b, 0x45, 0xff, 0x4f, 0x4d, 0x49, 0xff, 0x4d, 0x49, 0x45, 0xff, 0x4b, 0x49, 0x45, 0xff, 0x4e, 0x4d, 0x47, 0xff, 0x4d, 0x47, 0x41, 0xff, 0x4e, 0x46, 0x3c, 0xff, 0x4d, 0x4a, 0x3a, 0xff, 0x3b, 0x3d, 0x2b, 0xff, 0x37, 0x38, 0x28, 0xff, 0x3f, 0x3e, 0x31, 0xff, 0x41, 0x41, 0x35, 0xff, 0x3e, 0x3b, 0x34, 0xff, 0x3f, 0x3a, 0x35, 0xff, 0x35, 0x34, 0x2a, 0xff, 0x20, 0x20, 0x1c, 0xff, 0x19, 0x17, 0x16, 0xff, 0x09, 0x08, 0x04, 0xff, 0x0a, 0x0b, 0x07, 0xff, 0x0d, 0x0d, 0x0e, 0xff, 0x0f, 0x10, 0x14, 0xff, 0x09, 0x0e, 0x0d, 0xff, 0x09, 0x0e, 0x0e, 0xff, 0x0a, 0x0e, 0x11, 0xff, 0x11, 0x11, 0x10, 0xff, 0x0a, 0x12, 0x09, 0xff, 0x02, 0x0f, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x24, 0x35, 0x68, 0xff, 0x39, 0x94, 0xfd, 0xff, 0x23, 0x8e, 0xec, 0xff, 0x2c, 0x8a, 0xd6, 0xff, 0x37, 0x8f, 0xdd, 0xff, 0x4d, 0x96, 0xdf, 0xff, 0x54, 0x9e, 0xdc, 0xff, 0x5e, 0xa8, 0xe0, 0xff, 0x63, 0xb2, 0xe8, 0xff, 0x66, 0xb8, 0xeb, 0xff, 0x83, 0xc9, 0xf4, 0xff, 0x92, 0xd1, 0xfa, 0xff, 0x81, 0xc6, 0xf0, 0xff, 0x6f, 0xae, 0xe4, 0xff, 0x84, 0xb3, 0xf5, 0xff, 0x81, 0xb0, 0xfc, 0xff, 0x8d, 0xb5, 0xfd, 0xff, 0x9a, 0xac, 0xff, 0xff, 0x8a, 0x97, 0xff, 0xff, 0x90, 0x97, 0xff, 0xff, 0x8f, 0x8d, 0xff, 0xff, 0x84, 0x82, 0xff, 0xff, 0x87, 0x89, 0xff, 0xff, 0x8c, 0x8a, 0xff, 0xff, 0x87, 0x7c, 0xff, 0xff, 0x89, 0x7a, 0xff, 0xff, 0x82, 0x72, 0xff, 0xff, 0x62, 0x57, 0xf7, 0xff, 0x60, 0x69, 0xe1, 0xff, 0x77, 0x91, 0xca, 0xff, 0x95, 0xb8, 0xd9, 0xff, 0x98, 0xcc, 0xed, 0xff, 0x70, 0xb5, 0xe6, 0xff, 0x77, 0xbd, 0xf9, 0xff, 0x55, 0x92, 0xda, 0xff, 0x3d, 0x69, 0xc2, 0xff, 0x1b, 0x28, 0x56, 0xff, 0x08, 0x00, 0x00, 0xff, 0x34, 0x1a, 0x19, 0xff, 0x18, 0x10, 0x23, 0xff, 0x00, 0x00, 0x00, 0xff, 0x81, 0x43, 0x1f, 0xff, 0xfe, 0x7d, 0x61, 0xff, 0xe9, 0x5f, 0x6a, 0xff, 0xdc, 0x58, 0x79, 0xff, 0xda, 0x4f, 0x7b, 0xff, 0xd9, 0x40, 0x7e, 0xff, 0xd7, 0x33, 0x85, 0xff, 0xcf, 0x27, 0x91, 0xff, 0xc5, 0x20, 0xa4, 0xff, 0xad, 0x1f, 0xb4, 0xff, 0x96, 0x1f, 0xbd, 0xff, 0x7e, 0x1d, 0xbf, 0xff, 0x68, 0x18, 0xc5, 0xff, 0x5c, 0x17, 0xcf, 0xff, 0x42, 0x16, 0xd8, 0xff, 0x2e, 0x15, 0xdb, 0xff, 0x25, 0x16, 0xd6, 0xff, 0x19, 0x13, 0xcd, 0xff, 0x0f, 0x0f, 0xca, 0xff, 0x0c, 0x12, 0xc6, 0xff, 0x0c, 0x11, 0xc2, 0xff, 0x15, 0x0f, 0xb9, 0xff, 0x1b, 0x12, 0xb0, 0xff, 0x23, 0x17, 0xa4, 0xff, 0x3c, 0x1e, 0x90, 0xff, 0x61, 0x23, 0x7c, 0xff, 0x8b, 0x29, 0x69, 0xff, 0xab, 0x2b, 0x4e, 0xff, 0xcd, 0x38, 0x41, 0xff, 0xd8, 0x40, 0x3e, 0xff, 0xe4, 0x4e, 0x35, 0xff, 0xf6, 0x5f, 0x2e, 0xff, 0xf6, 0x65, 0x14, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x1c, 0x1b, 0x56, 0x59, 0x1b, 0xff, 0x58, 0x5b, 0x1c, 0xff, 0x5a, 0x5b, 0x1b, 0xff, 0x59, 0x60, 0x19, 0xff, 0x53, 0x5c, 0x19, 0xff, 0x53, 0x5b, 0x19, 0xff, 0x56, 0x5b, 0x10, 0xff, 0x56, 0x57, 0x16, 0xff, 0x57, 0x59, 0x1e, 0xff, 0x4e, 0x55, 0x10, 0xff, 0x4a, 0x51, 0x0e, 0xff, 0x4e, 0x4e, 0x23, 0xff, 0x4e, 0x47, 0x36, 0xff, 0x45, 0x39, 0x39, 0xff, 0x4d, 0x44, 0x3d, 0xff, 0x4b, 0x46, 0x39, 0xff, 0x3d, 0x39, 0x2e, 0xff, 0x3b, 0x38, 0x2e, 0xff, 0x42, 0x41, 0x37, 0xff, 0x3e, 0x3a, 0x32, 0xff, 0x4b, 0x43, 0x3d, 0xff, 0x4e, 0x46, 0x3f, 0xff, 0x4d, 0x43, 0x3b, 0xff, 0x58, 0x50, 0x4a, 0xff, 0x4c, 0x48, 0x43, 0xff, 0x51, 0x4e, 0x49, 0xff, 0x52, 0x51, 0x4b, 0xff, 0x48, 0x49, 0x43, 0xff, 0x46, 0x45, 0x40, 0xff, 0x48, 0x44, 0x3b, 0xff, 0x4a, 0x4b, 0x3e, 0xff, 0x41, 0x42, 0x35, 0xff, 0x3e, 0x3c, 0x32, 0xff, 0x38, 0x36, 0x2c, 0xff, 0x3a, 0x37, 0x31, 0xff, 0x3b, 0x38, 0x33, 0xff, 0x3b, 0x3b, 0x32, 0xff, 0x38, 0x39, 0x30, 0xff, 0x22, 0x23, 0x21, 0xff, 0x1c, 0x1a, 0x1d, 0xff, 0x13, 0x12, 0x11, 0xff, 0x0a, 0x0a, 0x06, 0xff, 0x0d, 0x0d, 0x0c, 0xff, 0x0a, 0x0d, 0x0f, 0xff, 0x0d, 0x14, 0x13, 0xff, 0x04, 0x09, 0x09, 0xff, 0x06, 0x0a, 0x0e, 0xff, 0x0f, 0x12, 0x10, 0xff, 0x0a, 0x11, 0x04, 0xff, 0x05, 0x10, 0x08, 0xff, 0x06, 0x00, 0x00, 0xff, 0x07, 0x08, 0x29, 0xff, 0x1f, 0x78, 0xda, 0xff, 0x20, 0x93, 0xf9, 0xff, 0x2c, 0x88, 0xe0, 0xff, 0x3c, 0x89, 0xdb, 0xff, 0x44, 0x94, 0xe0, 0xff, 0x49, 0x99, 0xdb, 0xff, 0x51, 0x9f, 0xd9, 0xff, 0x58, 0xaa, 0xe0, 0xff, 0x6b, 0xb5, 0xe7, 0xff, 0x86, 0xbe, 0xf1, 0xff, 0x97, 0xc8, 0xf9, 0xff, 0x8f, 0xcd, 0xfc, 0xff, 0x7a, 0xc1, 0xee, 0xff, 0x70, 0xaf, 0xdb, 0xff, 0x62, 0xaa, 0xd4, 0xff, 0x60, 0xa7, 0xd4, 0xff, 0x6d, 0xa7, 0xdd, 0xff, 0x66, 0x97, 0xe4, 0xff, 0x58, 0x78, 0xe4, 0xff, 0x5a, 0x6a, 0xe9, 0xff, 0x54, 0x65, 0xe3, 0xff, 0x55, 0x69, 0xdb, 0xff, 0x55, 0x66, 0xdd, 0xff, 0x4d, 0x56, 0xe0, 0xff, 0x44, 0x4a, 0xdc, 0xff, 0x35, 0x40, 0xcc, 0xff, 0x35, 0x47, 0xbb, 0xff, 0x52, 0x73, 0xab, 0xff, 0x7a, 0x98, 0xc3, 0xff, 0xa2, 0xc2, 0xee, 0xff, 0x92, 0xc4, 0xe2, 0xff, 0x74, 0xb8, 0xd9, 0xff, 0x62, 0xad, 0xe5, 0xff, 0x39, 0x78, 0xc4, 0xff, 0x27, 0x51, 0x8f, 0xff, 0x03, 0x04, 0x11, 0xff, 0x0d, 0x0f, 0x00, 0xff, 0x22, 0x1f, 0x16, 0xff, 0x17, 0x0e, 0x11, 0xff, 0x00, 0x00, 0x00, 0xff, 0x26, 0x1c, 0x07, 0xff, 0xc9, 0x5a, 0x4a, 0xff, 0xf3, 0x50, 0x5d, 0xff, 0xda, 0x48, 0x6a, 0xff, 0xd7, 0x41, 0x73, 0xff, 0xda, 0x37, 0x7b, 0xff, 0xd3, 0x2e, 0x80, 0xff, 0xca, 0x2b, 0x8e, 0xff, 0xbe, 0x27, 0xa0, 0xff, 0x9b, 0x21, 0xaa, 0xff, 0x81, 0x1f, 0xb5, 0xff, 0x6e, 0x1c, 0xb8, 0xff, 0x5b, 0x16, 0xbe, 0xff, 0x4b, 0x16, 0xc6, 0xff, 0x33, 0x14, 0xcf, 0xff, 0x20, 0x12, 0xd1, 0xff, 0x19, 0x13, 0xcf, 0xff, 0x11, 0x11, 0xcc, 0xff, 0x0b, 0x0f, 0xc9, 0xff, 0x0a, 0x13, 0xc6, 0xff, 0x0f, 0x16, 0xc4, 0xff, 0x17, 0x14, 0xbe, 0xff, 0x12, 0x10, 0xb1, 0xff, 0x14, 0x13, 0xa6, 0xff, 0x2d, 0x19, 0x95, 0xff, 0x54, 0x1d, 0x81, 0xff, 0x7f, 0x29, 0x71, 0xff, 0xaa, 0x31, 0x5a, 0xff, 0xc5, 0x31, 0x40, 0xff, 0xd4, 0x3b, 0x3b, 0xff, 0xee, 0x51, 0x3b, 0xff, 0xf5, 0x56, 0x30, 0xff, 0xec, 0x55, 0x1c, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x58, 0x1d, 0xd7, 0x58, 0x5b, 0x1e, 0xff, 0x57, 0x5a, 0x1b, 0xff, 0x57, 0x5c, 0x1b, 0xff, 0x51, 0x57, 0x19, 0xff, 0x56, 0x5b, 0x19, 0xff, 0x5b, 0x62, 0x0f, 0xff, 0x5a, 0x55, 0x17, 0xff, 0x57, 0x4d, 0x1c, 0xff, 0x5a, 0x57, 0x13, 0xff, 0x55, 0x56, 0x0a, 0xff, 0x4e, 0x4b, 0x25, 0xff, 0x50, 0x47, 0x41, 0xff, 0x42, 0x37, 0x3a, 0xff, 0x40, 0x39, 0x32, 0xff, 0x44, 0x3c, 0x30, 0xff, 0x4a, 0x41, 0x38, 0xff, 0x45, 0x3c, 0x34, 0xff, 0x4d, 0x45, 0x3e, 0xff, 0x4b, 0x45, 0x3e, 0xff, 0x4e, 0x47, 0x40, 0xff, 0x4d, 0x46, 0x3f, 0xff, 0x4b, 0x42, 0x3b, 0xff, 0x55, 0x4a, 0x43, 0xff, 0x57, 0x4d, 0x45, 0xff, 0x51, 0x4c, 0x43, 0xff, 0x49, 0x47, 0x3d, 0xff, 0x46, 0x48, 0x40, 0xff, 0x44, 0x46, 0x41, 0xff, 0x44, 0x41, 0x3c, 0xff, 0x3d, 0x3e, 0x39, 0xff, 0x37, 0x36, 0x36, 0xff, 0x36, 0x30, 0x34, 0xff, 0x39, 0x35, 0x36, 0xff, 0x3f, 0x3b, 0x3a, 0xff, 0x35, 0x33, 0x2d, 0xff, 0x36, 0x38, 0x2d, 0xff, 0x3a, 0x3a, 0x34, 0xff, 0x36, 0x37, 0x38, 0xff, 0x21, 0x1d, 0x26, 0xff, 0x18, 0x14, 0x1b, 0xff, 0x0a, 0x0c, 0x0a, 0xff, 0x07, 0x0a, 0x03, 0xff, 0x09, 0x0f, 0x08, 0xff, 0x09, 0x0e, 0x0c, 0xff, 0x0d, 0x13, 0x13, 0xff, 0x05, 0x0a, 0x0d, 0xff, 0x07, 0x0f, 0x0a, 0xff, 0x0d, 0x11, 0x06, 0xff, 0x10, 0x0a, 0x0a, 0xff, 0x12, 0x09, 0x06, 0xff, 0x00, 0x00, 0x05, 0xff, 0x15, 0x4a, 0x96, 0xff, 0x26, 0x8d, 0xff, 0xff, 0x17, 0x7a, 0xe9, 0xff, 0x23, 0x82, 0xdb, 0xff, 0x2f, 0x88, 0xda, 0xff, 0x3e, 0x92, 0xda, 0xff, 0x4f, 0x9b, 0xda, 0xff, 0x5c, 0xa6, 0xe0, 0xff, 0x66, 0xae, 0xe5, 0xff, 0x6f, 0xb8, 0xec, 0xff, 0x7c, 0xc2, 0xf2, 0xff, 0x84, 0xc5, 0xf0, 0xff, 0x8a, 0xca, 0xf8, 0xff, 0x80, 0xbe, 0xea, 0xff, 0x61, 0xaa, 0xd8, 0xff, 0x4b, 0x93, 0xcb, 0xff, 0x3e, 0x85, 0xc7, 0xff, 0x2f, 0x76, 0xc0, 0xff, 0x20, 0x5d, 0xb4, 0xff, 0x1c, 0x50, 0xac, 0xff, 0x18, 0x48, 0xa1, 0xff, 0x17, 0x42, 0x9d, 0xff, 0x20, 0x46, 0xa1, 0xff, 0x26, 0x49, 0x9c, 0xff, 0x1e, 0x42, 0x92, 0xff, 0x23, 0x4c, 0x94, 0xff, 0x3f, 0x66, 0xaa, 0xff, 0x4d, 0x6f, 0xa5, 0xff, 0x78, 0x9e, 0xc6, 0xff, 0xa2, 0xc8, 0xec, 0xff, 0x88, 0xb5, 0xd9, 0xff, 0x79, 0xb3, 0xdf, 0xff, 0x4e, 0x95, 0xd8, 0xff, 0x38, 0x62, 0xaf, 0xff, 0x1c, 0x27, 0x47, 0xff, 0x04, 0x00, 0x00, 0xff, 0x1f, 0x16, 0x0d, 0xff, 0x23, 0x14, 0x1b, 0xff, 0x1d, 0x09, 0x0c, 0xff, 0x00, 0x0f, 0x03, 0xff, 0x00, 0x15, 0x07, 0xff, 0x97, 0x3a, 0x3c, 0xff, 0xf2, 0x3f, 0x56, 0xff, 0xd8, 0x37, 0x60, 0xff, 0xd2, 0x32, 0x6e, 0xff, 0xd3, 0x32, 0x7c, 0xff, 0xcd, 0x30, 0x80, 0xff, 0xbd, 0x2b, 0x84, 0xff, 0xb0, 0x29, 0x95, 0xff, 0x94, 0x25, 0xa3, 0xff, 0x77, 0x1e, 0xae, 0xff, 0x6c, 0x19, 0xb8, 0xff, 0x5c, 0x18, 0xc2, 0xff, 0x45, 0x17, 0xc5, 0xff, 0x2b, 0x11, 0xcb, 0xff, 0x1b, 0x11, 0xcf, 0xff, 0x17, 0x13, 0xd2, 0xff, 0x13, 0x11, 0xd4, 0xff, 0x10, 0x11, 0xd2, 0xff, 0x0f, 0x12, 0xcd, 0xff, 0x0d, 0x12, 0xc6, 0xff, 0x11, 0x15, 0xbe, 0xff, 0x11, 0x13, 0xb7, 0xff, 0x13, 0x13, 0xac, 0xff, 0x24, 0x15, 0x99, 0xff, 0x44, 0x1d, 0x86, 0xff, 0x6a, 0x28, 0x72, 0xff, 0x8f, 0x2e, 0x5b, 0xff, 0xb6, 0x34, 0x42, 0xff, 0xd7, 0x40, 0x33, 0xff, 0xec, 0x4d, 0x2f, 0xff, 0xee, 0x4d, 0x29, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x56, 0x1c, 0x8e, 0x57, 0x57, 0x1b, 0xff, 0x57, 0x59, 0x1a, 0xff, 0x56, 0x59, 0x18, 0xff, 0x54, 0x56, 0x19, 0xff, 0x58, 0x59, 0x19, 0xff, 0x59, 0x5f, 0x0e, 0xff, 0x56, 0x55, 0x13, 0xff, 0x53, 0x4a, 0x17, 0xff, 0x57, 0x53, 0x10, 0xff, 0x57, 0x58, 0x0d, 0xff, 0x53, 0x4e, 0x2a, 0xff, 0x4d, 0x41, 0x43, 0xff, 0x48, 0x41, 0x42, 0xff, 0x3c, 0x3a, 0x32, 0xff, 0x3e, 0x38, 0x33, 0xff, 0x49, 0x41, 0x3a, 0xff, 0x4c, 0x42, 0x39, 0xff, 0x57, 0x4b, 0x40, 0xff, 0x56, 0x4c, 0x43, 0xff, 0x49, 0x44, 0x3c, 0xff, 0x4b, 0x45, 0x3f, 0xff, 0x5a, 0x50, 0x4b, 0xff, 0x58, 0x4e, 0x47, 0xff, 0x50, 0x49, 0x3e, 0xff, 0x49, 0x44, 0x3a, 0xff, 0x43, 0x41, 0x37, 0xff, 0x42, 0x44, 0x39, 0xff, 0x44, 0x43, 0x3d, 0xff, 0x42, 0x3d, 0x3b, 0xff, 0x33, 0x35, 0x2f, 0xff, 0x2b, 0x2f, 0x27, 0xff, 0x31, 0x2e, 0x2e, 0xff, 0x3c, 0x38, 0x39, 0xff, 0x3c, 0x36, 0x36, 0xff, 0x3f, 0x3c, 0x35, 0xff, 0x3f, 0x3e, 0x34, 0xff, 0x42, 0x40, 0x3d, 0xff, 0x43, 0x45, 0x48, 0xff, 0x37, 0x34, 0x3a, 0xff, 0x20, 0x19, 0x1f, 0xff, 0x0b, 0x0e, 0x14, 0xff, 0x05, 0x0a, 0x07, 0xff, 0x08, 0x0e, 0x01, 0xff, 0x01, 0x07, 0x00, 0xff, 0x11, 0x16, 0x15, 0xff, 0x16, 0x1b, 0x19, 0xff, 0x04, 0x07, 0x04, 0xff, 0x0a, 0x0a, 0x0b, 0xff, 0x0d, 0x07, 0x07, 0xff, 0x14, 0x0a, 0x05, 0xff, 0x0b, 0x00, 0x00, 0xff, 0x07, 0x12, 0x36, 0xff, 0x29, 0x7e, 0xdd, 0xff, 0x13, 0x79, 0xff, 0xff, 0x16, 0x71, 0xe7, 0xff, 0x1f, 0x72, 0xdb, 0xff, 0x34, 0x83, 0xe1, 0xff, 0x4d, 0x96, 0xe4, 0xff, 0x5c, 0xa0, 0xe2, 0xff, 0x62, 0xac, 0xe2, 0xff, 0x62, 0xb5, 0xe8, 0xff, 0x69, 0xb9, 0xe8, 0xff, 0x81, 0xc2, 0xf0, 0xff, 0x8a, 0xc5, 0xf7, 0xff, 0x83, 0xc3, 0xf3, 0xff, 0x78, 0xbb, 0xed, 0xff, 0x63, 0xa5, 0xdd, 0xff, 0x4e, 0x8f, 0xd4, 0xff, 0x34, 0x7d, 0xc5, 0xff, 0x21, 0x69, 0xb4, 0xff, 0x1c, 0x56, 0xa7, 0xff, 0x18, 0x4a, 0x9b, 0xff, 0x19, 0x48, 0x99, 0xff, 0x20, 0x4c, 0x9a, 0xff, 0x26, 0x4f, 0x98, 0xff, 0x29, 0x53, 0x94, 0xff, 0x39, 0x66, 0xa4, 0xff, 0x4d, 0x77, 0xb2, 0xff, 0x61, 0x87, 0xbe, 0xff, 0x87, 0xb4, 0xde, 0xff, 0xa3, 0xcc, 0xe9, 0xff, 0x85, 0xb2, 0xdc, 0xff, 0x70, 0xab, 0xe3, 0xff, 0x47, 0x87, 0xc9, 0xff, 0x21, 0x40, 0x80, 0xff, 0x09, 0x05, 0x12, 0xff, 0x12, 0x05, 0x00, 0xff, 0x20, 0x15, 0x14, 0xff, 0x1a, 0x10, 0x13, 0xff, 0x19, 0x09, 0x09, 0xff, 0x13, 0x1b, 0x11, 0xff, 0x02, 0x18, 0x0a, 0xff, 0x6f, 0x29, 0x2b, 0xff, 0xe3, 0x3c, 0x54, 0xff, 0xde, 0x31, 0x5c, 0xff, 0xd3, 0x34, 0x69, 0xff, 0xce, 0x33, 0x77, 0xff, 0xc8, 0x30, 0x7f, 0xff, 0xbc, 0x2b, 0x83, 0xff, 0xa6, 0x26, 0x8f, 0xff, 0x91, 0x23, 0xa0, 0xff, 0x7b, 0x1e, 0xaa, 0xff, 0x66, 0x17, 0xb4, 0xff, 0x58, 0x1a, 0xc6, 0xff, 0x44, 0x19, 0xc8, 0xff, 0x28, 0x14, 0xcc, 0xff, 0x17, 0x13, 0xd0, 0xff, 0x14, 0x10, 0xd1, 0xff, 0x12, 0x0f, 0xd3, 0xff, 0x12, 0x11, 0xd2, 0xff, 0x11, 0x12, 0xd0, 0xff, 0x0f, 0x10, 0xcb, 0xff, 0x10, 0x13, 0xbf, 0xff, 0x14, 0x16, 0xba, 0xff, 0x17, 0x13, 0xb1, 0xff, 0x1e, 0x15, 0x9f, 0xff, 0x40, 0x1f, 0x8c, 0xff, 0x67, 0x2a, 0x74, 0xff, 0x85, 0x2f, 0x60, 0xff, 0xae, 0x31, 0x4a, 0xff, 0xd5, 0x3c, 0x33, 0xff, 0xf0, 0x4b, 0x2a, 0xff, 0xee, 0x50, 0x27, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x53, 0x1d, 0x46, 0x58, 0x56, 0x1b, 0xff, 0x5c, 0x5a, 0x1e, 0xff, 0x5a, 0x5b, 0x19, 0xff, 0x58, 0x59, 0x17, 0xff, 0x5a, 0x5a, 0x17, 0xff, 0x5b, 0x5d, 0x0e, 0xff, 0x58, 0x55, 0x16, 0xff, 0x59, 0x52, 0x1d, 0xff, 0x54, 0x4f, 0x0f, 0xff, 0x54, 0x54, 0x13, 0xff, 0x56, 0x4f, 0x32, 0xff, 0x40, 0x36, 0x37, 0xff, 0x41, 0x3c, 0x3b, 0xff, 0x41, 0x3f, 0x38, 0xff, 0x3e, 0x3c, 0x37, 0xff, 0x3a, 0x38, 0x30, 0xff, 0x4f, 0x4b, 0x41, 0xff, 0x55, 0x4f, 0x43, 0xff, 0x57, 0x50, 0x44, 0xff, 0x50, 0x4a, 0x41, 0xff, 0x52, 0x4d, 0x45, 0xff, 0x52, 0x48, 0x42, 0xff, 0x51, 0x47, 0x40, 0xff, 0x4a, 0x43, 0x3a, 0xff, 0x47, 0x44, 0x3a, 0xff, 0x49, 0x48, 0x3e, 0xff, 0x44, 0x44, 0x3b, 0xff, 0x3c, 0x39, 0x35, 0xff, 0x34, 0x2f, 0x2a, 0xff, 0x2f, 0x32, 0x25, 0xff, 0x32, 0x38, 0x27, 0xff, 0x3d, 0x3c, 0x32, 0xff, 0x3a, 0x37, 0x32, 0xff, 0x39, 0x34, 0x30, 0xff, 0x41, 0x3e, 0x36, 0xff, 0x3f, 0x3c, 0x36, 0xff, 0x46, 0x45, 0x40, 0xff, 0x40, 0x43, 0x3f, 0xff, 0x45, 0x4a, 0x43, 0xff, 0x32, 0x37, 0x2e, 0xff, 0x17, 0x1e, 0x1b, 0xff, 0x02, 0x09, 0x09, 0xff, 0x01, 0x04, 0x05, 0xff, 0x06, 0x07, 0x04, 0xff, 0x0d, 0x0a, 0x03, 0xff, 0x15, 0x0c, 0x07, 0xff, 0x03, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x10, 0x08, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1a, 0x45, 0x8e, 0xff, 0x19, 0x88, 0xff, 0xff, 0x10, 0x67, 0xec, 0xff, 0x16, 0x66, 0xda, 0xff, 0x24, 0x77, 0xdd, 0xff, 0x3e, 0x8f, 0xde, 0xff, 0x4f, 0x9e, 0xde, 0xff, 0x59, 0xa9, 0xda, 0xff, 0x5e, 0xb0, 0xe1, 0xff, 0x6c, 0xb7, 0xe9, 0xff, 0x7b, 0xbc, 0xef, 0xff, 0x81, 0xbf, 0xf2, 0xff, 0x80, 0xc1, 0xf0, 0xff, 0x7f, 0xc1, 0xef, 0xff, 0x79, 0xb8, 0xeb, 0xff, 0x6a, 0xa8, 0xe3, 0xff, 0x5b, 0x9e, 0xdc, 0xff, 0x57, 0x99, 0xdc, 0xff, 0x47, 0x80, 0xca, 0xff, 0x31, 0x67, 0xb1, 0xff, 0x25, 0x5b, 0xa2, 0xff, 0x24, 0x55, 0x9b, 0xff, 0x2c, 0x5b, 0x9f, 0xff, 0x3f, 0x6d, 0xac, 0xff, 0x4e, 0x7f, 0xbb, 0xff, 0x5b, 0x8d, 0xc5, 0xff, 0x76, 0xa7, 0xd7, 0xff, 0x98, 0xc0, 0xe9, 0xff, 0xa7, 0xca, 0xea, 0xff, 0x8a, 0xba, 0xe8, 0xff, 0x64, 0xa0, 0xe0, 0xff, 0x3d, 0x6e, 0xa5, 0xff, 0x08, 0x18, 0x34, 0xff, 0x03, 0x00, 0x00, 0xff, 0x1b, 0x09, 0x0a, 0xff, 0x1b, 0x15, 0x13, 0xff, 0x0c, 0x0f, 0x0e, 0xff, 0x16, 0x0d, 0x0c, 0xff, 0x2a, 0x24, 0x1c, 0xff, 0x1c, 0x2a, 0x1c, 0xff, 0x4f, 0x28, 0x23, 0xff, 0xc2, 0x3a, 0x4b, 0xff, 0xd8, 0x31, 0x57, 0xff, 0xcc, 0x31, 0x60, 0xff, 0xc6, 0x33, 0x71, 0xff, 0xc4, 0x32, 0x7c, 0xff, 0xbb, 0x2f, 0x86, 0xff, 0x9f, 0x24, 0x8b, 0xff, 0x89, 0x20, 0x9a, 0xff, 0x79, 0x20, 0xab, 0xff, 0x5c, 0x14, 0xb1, 0xff, 0x47, 0x13, 0xbf, 0xff, 0x3b, 0x16, 0xc4, 0xff, 0x27, 0x14, 0xcc, 0xff, 0x18, 0x14, 0xd1, 0xff, 0x13, 0x0f, 0xd1, 0xff, 0x12, 0x0e, 0xd2, 0xff, 0x12, 0x10, 0xd1, 0xff, 0x11, 0x12, 0xd0, 0xff, 0x10, 0x10, 0xcc, 0xff, 0x11, 0x10, 0xbf, 0xff, 0x12, 0x13, 0xb9, 0xff, 0x13, 0x12, 0xb2, 0xff, 0x18, 0x14, 0xa2, 0xff, 0x38, 0x1b, 0x8f, 0xff, 0x5c, 0x25, 0x78, 0xff, 0x7c, 0x2c, 0x65, 0xff, 0xa5, 0x2e, 0x4c, 0xff, 0xc7, 0x35, 0x31, 0xff, 0xe9, 0x47, 0x2b, 0xff, 0xf0, 0x53, 0x2b, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x48, 0x24, 0x07, 0x5d, 0x58, 0x1e, 0xef, 0x5e, 0x59, 0x1e, 0xff, 0x5c, 0x59, 0x1b, 0xff, 0x5e, 0x5a, 0x1b, 0xff, 0x5f, 0x5a, 0x16, 0xff, 0x5e, 0x5a, 0x11, 0xff, 0x5a, 0x53, 0x17, 0xff, 0x5d, 0x53, 0x1f, 0xff, 0x53, 0x4e, 0x11, 0xff, 0x50, 0x4e, 0x1b, 0xff, 0x46, 0x3d, 0x2b, 0xff, 0x37, 0x2e, 0x30, 0xff, 0x38, 0x36, 0x32, 0xff, 0x3f, 0x3e, 0x37, 0xff, 0x45, 0x43, 0x3f, 0xff, 0x4c, 0x4b, 0x42, 0xff, 0x53, 0x51, 0x47, 0xff, 0x4e, 0x4a, 0x3e, 0xff, 0x4e, 0x48, 0x3c, 0xff, 0x54, 0x4f, 0x45, 0xff, 0x4d, 0x49, 0x3f, 0xff, 0x4d, 0x43, 0x3b, 0xff, 0x4a, 0x40, 0x38, 0xff, 0x49, 0x43, 0x3a, 0xff, 0x3f, 0x3b, 0x32, 0xff, 0x40, 0x3e, 0x34, 0xff, 0x40, 0x3f, 0x36, 0xff, 0x3d, 0x3a, 0x34, 0xff, 0x36, 0x30, 0x2c, 0xff, 0x2f, 0x2f, 0x26, 0xff, 0x32, 0x34, 0x29, 0xff, 0x3b, 0x36, 0x31, 0xff, 0x36, 0x32, 0x2e, 0xff, 0x40, 0x3d, 0x32, 0xff, 0x44, 0x43, 0x35, 0xff, 0x44, 0x44, 0x38, 0xff, 0x42, 0x43, 0x38, 0xff, 0x3c, 0x3e, 0x35, 0xff, 0x3c, 0x44, 0x3b, 0xff, 0x39, 0x48, 0x3b, 0xff, 0x3a, 0x46, 0x3a, 0xff, 0x22, 0x2b, 0x27, 0xff, 0x0f, 0x12, 0x14, 0xff, 0x12, 0x05, 0x0b, 0xff, 0x02, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x20, 0x25, 0x30, 0xff, 0x49, 0x5a, 0x6c, 0xff, 0x37, 0x47, 0x51, 0xff, 0x05, 0x0b, 0x0f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xff, 0x05, 0x06, 0x28, 0xff, 0x25, 0x6e, 0xdb, 0xff, 0x19, 0x79, 0xfb, 0xff, 0x0a, 0x69, 0xd8, 0xff, 0x17, 0x77, 0xd5, 0xff, 0x2e, 0x8d, 0xd7, 0xff, 0x3f, 0x9d, 0xda, 0xff, 0x4e, 0xa4, 0xdd, 0xff, 0x58, 0xa9, 0xe1, 0xff, 0x63, 0xac, 0xe4, 0xff, 0x73, 0xb5, 0xec, 0xff, 0x7e, 0xbf, 0xf4, 0xff, 0x86, 0xc8, 0xf6, 0xff, 0x89, 0xc8, 0xf4, 0xff, 0x85, 0xc0, 0xee, 0xff, 0x7c, 0xb8, 0xe7, 0xff, 0x73, 0xb0, 0xe1, 0xff, 0x69, 0xa6, 0xdb, 0xff, 0x60, 0x9c, 0xd4, 0xff, 0x53, 0x90, 0xc8, 0xff, 0x43, 0x7d, 0xb6, 0xff, 0x41, 0x76, 0xb0, 0xff, 0x57, 0x8a, 0xc3, 0xff, 0x71, 0xa3, 0xd7, 0xff, 0x70, 0xa6, 0xd9, 0xff, 0x6f, 0xa8, 0xd9, 0xff, 0x82, 0xba, 0xe4, 0xff, 0xa4, 0xcb, 0xf3, 0xff, 0xa9, 0xcd, 0xec, 0xff, 0x85, 0xb9, 0xe3, 0xff, 0x68, 0x9d, 0xde, 0xff, 0x26, 0x3e, 0x69, 0xff, 0x00, 0x00, 0x00, 0xff, 0x13, 0x00, 0x00, 0xff, 0x1d, 0x0a, 0x0d, 0xff, 0x17, 0x12, 0x0e, 0xff, 0x04, 0x0d, 0x0b, 0xff, 0x15, 0x15, 0x12, 0xff, 0x36, 0x28, 0x21, 0xff, 0x2e, 0x34, 0x28, 0xff, 0x2f, 0x29, 0x1d, 0xff, 0x96, 0x37, 0x3e, 0xff, 0xcd, 0x36, 0x55, 0xff, 0xc4, 0x31, 0x5a, 0xff, 0xb9, 0x2f, 0x66, 0xff, 0xb6, 0x2e, 0x73, 0xff, 0xb0, 0x2d, 0x81, 0xff, 0x97, 0x22, 0x87, 0xff, 0x7f, 0x1b, 0x91, 0xff, 0x6b, 0x1b, 0xa2, 0xff, 0x53, 0x17, 0xb2, 0xff, 0x3e, 0x14, 0xc0, 0xff, 0x2f, 0x12, 0xc1, 0xff, 0x21, 0x13, 0xcb, 0xff, 0x18, 0x14, 0xd3, 0xff, 0x16, 0x11, 0xd5, 0xff, 0x17, 0x10, 0xd6, 0xff, 0x15, 0x11, 0xd4, 0xff, 0x11, 0x10, 0xd0, 0xff, 0x11, 0x0e, 0xcb, 0xff, 0x13, 0x10, 0xc1, 0xff, 0x11, 0x13, 0xbd, 0xff, 0x10, 0x12, 0xb8, 0xff, 0x12, 0x15, 0xa8, 0xff, 0x2a, 0x18, 0x93, 0xff, 0x49, 0x20, 0x7f, 0xff, 0x6a, 0x26, 0x6a, 0xff, 0x9c, 0x2d, 0x52, 0xff, 0xbf, 0x35, 0x38, 0xff, 0xd8, 0x3b, 0x26, 0xef, 0xda, 0x48, 0x24, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x52, 0x1b, 0xa0, 0x5d, 0x55, 0x1c, 0xff, 0x5f, 0x56, 0x1e, 0xff, 0x64, 0x5a, 0x1f, 0xff, 0x63, 0x59, 0x1b, 0xff, 0x60, 0x55, 0x17, 0xff, 0x5e, 0x54, 0x1b, 0xff, 0x5c, 0x51, 0x1b, 0xff, 0x52, 0x4d, 0x13, 0xff, 0x4a, 0x45, 0x1f, 0xff, 0x37, 0x2c, 0x22, 0xff, 0x35, 0x2c, 0x2e, 0xff, 0x3b, 0x3c, 0x34, 0xff, 0x3e, 0x3e, 0x38, 0xff, 0x4c, 0x49, 0x45, 0xff, 0x57, 0x54, 0x4b, 0xff, 0x53, 0x4d, 0x44, 0xff, 0x4e, 0x45, 0x3b, 0xff, 0x55, 0x4e, 0x40, 0xff, 0x4e, 0x4b, 0x3e, 0xff, 0x4b, 0x48, 0x3d, 0xff, 0x4b, 0x42, 0x3a, 0xff, 0x43, 0x3a, 0x31, 0xff, 0x41, 0x3b, 0x32, 0xff, 0x39, 0x36, 0x2c, 0xff, 0x3b, 0x3b, 0x30, 0xff, 0x38, 0x38, 0x2c, 0xff, 0x41, 0x3c, 0x35, 0xff, 0x3a, 0x30, 0x32, 0xff, 0x32, 0x2d, 0x30, 0xff, 0x32, 0x2e, 0x31, 0xff, 0x32, 0x2a, 0x2e, 0xff, 0x35, 0x2f, 0x2e, 0xff, 0x49, 0x46, 0x38, 0xff, 0x49, 0x48, 0x31, 0xff, 0x41, 0x42, 0x2d, 0xff, 0x3f, 0x45, 0x36, 0xff, 0x3a, 0x41, 0x3a, 0xff, 0x3c, 0x40, 0x3b, 0xff, 0x41, 0x3a, 0x32, 0xff, 0x55, 0x43, 0x3a, 0xff, 0x59, 0x43, 0x3b, 0xff, 0x2a, 0x1d, 0x1a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1f, 0x2a, 0x46, 0xff, 0x7e, 0xad, 0xc1, 0xff, 0xb3, 0xfe, 0xff, 0xff, 0xbc, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xa9, 0xe1, 0xf2, 0xff, 0x45, 0x5a, 0x71, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0e, 0x1e, 0x5e, 0xff, 0x18, 0x77, 0xf4, 0xff, 0x06, 0x70, 0xeb, 0xff, 0x0c, 0x6f, 0xdc, 0xff, 0x1e, 0x80, 0xdb, 0xff, 0x32, 0x91, 0xe0, 0xff, 0x48, 0x9c, 0xe5, 0xff, 0x60, 0xab, 0xf0, 0xff, 0x63, 0xa9, 0xe5, 0xff, 0x6c, 0xb1, 0xe6, 0xff, 0x7b, 0xbe, 0xf5, 0xff, 0x84, 0xc6, 0xf6, 0xff, 0x8a, 0xc8, 0xf2, 0xff, 0x8b, 0xc5, 0xef, 0xff, 0x8c, 0xc5, 0xee, 0xff, 0x8e, 0xc6, 0xf0, 0xff, 0x85, 0xc0, 0xeb, 0xff, 0x7d, 0xbb, 0xe7, 0xff, 0x7c, 0xba, 0xe7, 0xff, 0x80, 0xba, 0xea, 0xff, 0x86, 0xba, 0xed, 0xff, 0x90, 0xc2, 0xf4, 0xff, 0x95, 0xc6, 0xf4, 0xff, 0x8d, 0xc2, 0xf0, 0xff, 0x90, 0xc9, 0xf5, 0xff, 0x99, 0xd1, 0xf8, 0xff, 0xac, 0xd4, 0xfd, 0xff, 0xa6, 0xd1, 0xf1, 0xff, 0x89, 0xc0, 0xe4, 0xff, 0x5e, 0x89, 0xc0, 0xff, 0x05, 0x0e, 0x2d, 0xff, 0x02, 0x00, 0x00, 0xff, 0x1f, 0x09, 0x07, 0xff, 0x1d, 0x0f, 0x11, 0xff, 0x12, 0x0d, 0x08, 0xff, 0x07, 0x0b, 0x0a, 0xff, 0x18, 0x1b, 0x18, 0xff, 0x32, 0x25, 0x1e, 0xff, 0x33, 0x32, 0x26, 0xff, 0x29, 0x31, 0x23, 0xff, 0x7a, 0x37, 0x37, 0xff, 0xbe, 0x37, 0x50, 0xff, 0xbc, 0x33, 0x55, 0xff, 0xb5, 0x30, 0x61, 0xff, 0xad, 0x2b, 0x6d, 0xff, 0xa9, 0x2b, 0x7c, 0xff, 0x92, 0x24, 0x84, 0xff, 0x77, 0x1c, 0x8e, 0xff, 0x62, 0x1b, 0xa0, 0xff, 0x4a, 0x16, 0xaf, 0xff, 0x37, 0x15, 0xbf, 0xff, 0x2d, 0x14, 0xc3, 0xff, 0x1c, 0x12, 0xca, 0xff, 0x18, 0x14, 0xd3, 0xff, 0x19, 0x13, 0xd8, 0xff, 0x18, 0x10, 0xd7, 0xff, 0x16, 0x11, 0xd3, 0xff, 0x11, 0x0f, 0xd1, 0xff, 0x12, 0x0e, 0xcc, 0xff, 0x15, 0x12, 0xc5, 0xff, 0x12, 0x15, 0xc2, 0xff, 0x11, 0x15, 0xbd, 0xff, 0x10, 0x18, 0xaf, 0xff, 0x23, 0x18, 0x9a, 0xff, 0x3d, 0x1f, 0x86, 0xff, 0x5f, 0x26, 0x70, 0xff, 0x94, 0x2d, 0x57, 0xff, 0xb8, 0x36, 0x3c, 0xff, 0xd2, 0x3a, 0x26, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x52, 0x1f, 0x4a, 0x61, 0x52, 0x21, 0xff, 0x69, 0x57, 0x24, 0xff, 0x69, 0x56, 0x22, 0xff, 0x65, 0x54, 0x20, 0xff, 0x62, 0x52, 0x20, 0xff, 0x61, 0x51, 0x1f, 0xff, 0x5a, 0x50, 0x15, 0xff, 0x52, 0x4d, 0x18, 0xff, 0x44, 0x3a, 0x22, 0xff, 0x3b, 0x2d, 0x2b, 0xff, 0x3c, 0x33, 0x31, 0xff, 0x43, 0x42, 0x38, 0xff, 0x48, 0x46, 0x3c, 0xff, 0x55, 0x4f, 0x45, 0xff, 0x55, 0x4d, 0x42, 0xff, 0x50, 0x47, 0x3d, 0xff, 0x50, 0x46, 0x3c, 0xff, 0x52, 0x4b, 0x3d, 0xff, 0x4b, 0x47, 0x3b, 0xff, 0x48, 0x44, 0x3d, 0xff, 0x45, 0x3c, 0x35, 0xff, 0x44, 0x3b, 0x32, 0xff, 0x3d, 0x36, 0x2d, 0xff, 0x3b, 0x39, 0x2e, 0xff, 0x39, 0x3c, 0x2e, 0xff, 0x36, 0x36, 0x2b, 0xff, 0x34, 0x2d, 0x29, 0xff, 0x2f, 0x28, 0x25, 0xff, 0x33, 0x2f, 0x32, 0xff, 0x33, 0x2f, 0x34, 0xff, 0x41, 0x38, 0x3c, 0xff, 0x3f, 0x38, 0x3c, 0xff, 0x43, 0x3c, 0x37, 0xff, 0x41, 0x3b, 0x2c, 0xff, 0x3f, 0x3e, 0x30, 0xff, 0x3e, 0x41, 0x3d, 0xff, 0x41, 0x41, 0x39, 0xff, 0x3c, 0x39, 0x2c, 0xff, 0x2f, 0x21, 0x1e, 0xff, 0x22, 0x04, 0x12, 0xff, 0x19, 0x03, 0x1c, 0xff, 0x34, 0x35, 0x51, 0xff, 0x74, 0x98, 0xb1, 0xff, 0xb0, 0xfb, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xba, 0xfc, 0xff, 0xff, 0xb8, 0xf6, 0xfe, 0xff, 0xaf, 0xf4, 0xff, 0xff, 0xb7, 0xfe, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0x76, 0x9c, 0xac, 0xff, 0x28, 0x31, 0x37, 0xff, 0x02, 0x00, 0x20, 0xff, 0x00, 0x25, 0x9e, 0xff, 0x00, 0x54, 0xdd, 0xff, 0x01, 0x59, 0xd9, 0xff, 0x14, 0x6d, 0xdf, 0xff, 0x2d, 0x85, 0xe3, 0xff, 0x45, 0x95, 0xe7, 0xff, 0x5b, 0xa3, 0xea, 0xff, 0x68, 0xad, 0xe9, 0xff, 0x69, 0xb2, 0xea, 0xff, 0x76, 0xbb, 0xf2, 0xff, 0x86, 0xc7, 0xf8, 0xff, 0x92, 0xd1, 0xfa, 0xff, 0x99, 0xd3, 0xfb, 0xff, 0xa0, 0xd2, 0xfa, 0xff, 0x9d, 0xd3, 0xf9, 0xff, 0x97, 0xd2, 0xf9, 0xff, 0x93, 0xcf, 0xf7, 0xff, 0x8e, 0xca, 0xf5, 0xff, 0x97, 0xcd, 0xf9, 0xff, 0x9e, 0xce, 0xfb, 0xff, 0x9d, 0xce, 0xfc, 0xff, 0x9c, 0xcf, 0xfa, 0xff, 0x9c, 0xd2, 0xf7, 0xff, 0xa3, 0xda, 0xfb, 0xff, 0xa8, 0xdd, 0xff, 0xff, 0xac, 0xd7, 0xfe, 0xff, 0x9c, 0xcd, 0xf7, 0xff, 0x93, 0xc4, 0xec, 0xff, 0x48, 0x5b, 0x80, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0b, 0x01, 0x00, 0xff, 0x18, 0x0d, 0x05, 0xff, 0x1a, 0x0f, 0x0f, 0xff, 0x11, 0x0b, 0x0d, 0xff, 0x16, 0x0d, 0x0f, 0xff, 0x1c, 0x19, 0x16, 0xff, 0x2c, 0x28, 0x1d, 0xff, 0x3b, 0x3a, 0x2b, 0xff, 0x2d, 0x3b, 0x2b, 0xff, 0x63, 0x3a, 0x38, 0xff, 0xac, 0x38, 0x4b, 0xff, 0xb2, 0x2e, 0x4b, 0xff, 0xb3, 0x31, 0x61, 0xff, 0xa6, 0x2a, 0x6a, 0xff, 0x9b, 0x26, 0x72, 0xff, 0x8a, 0x20, 0x80, 0xff, 0x6d, 0x1c, 0x90, 0xff, 0x5d, 0x1a, 0xa2, 0xff, 0x47, 0x17, 0xab, 0xff, 0x34, 0x16, 0xb8, 0xff, 0x2b, 0x15, 0xbf, 0xff, 0x19, 0x10, 0xc4, 0xff, 0x14, 0x11, 0xcc, 0xff, 0x18, 0x11, 0xd2, 0xff, 0x13, 0x0f, 0xd2, 0xff, 0x13, 0x0f, 0xd2, 0xff, 0x12, 0x11, 0xd2, 0xff, 0x12, 0x10, 0xcc, 0xff, 0x15, 0x10, 0xc5, 0xff, 0x12, 0x12, 0xbf, 0xff, 0x0e, 0x15, 0xb9, 0xff, 0x0c, 0x15, 0xb1, 0xff, 0x20, 0x18, 0x9d, 0xff, 0x37, 0x1e, 0x87, 0xff, 0x59, 0x26, 0x74, 0xff, 0x8c, 0x2c, 0x5d, 0xff, 0xb2, 0x34, 0x3f, 0xff, 0xd2, 0x3a, 0x29, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x3f, 0x3f, 0x04, 0x62, 0x52, 0x24, 0xe7, 0x6a, 0x57, 0x27, 0xff, 0x68, 0x53, 0x25, 0xff, 0x63, 0x4e, 0x24, 0xff, 0x64, 0x4c, 0x27, 0xff, 0x63, 0x4d, 0x20, 0xff, 0x5b, 0x4d, 0x16, 0xff, 0x57, 0x4b, 0x20, 0xff, 0x4c, 0x3d, 0x2d, 0xff, 0x4b, 0x3b, 0x3d, 0xff, 0x49, 0x3f, 0x3d, 0xff, 0x50, 0x4b, 0x41, 0xff, 0x5a, 0x55, 0x45, 0xff, 0x5b, 0x50, 0x42, 0xff, 0x4f, 0x43, 0x38, 0xff, 0x4e, 0x43, 0x37, 0xff, 0x53, 0x48, 0x3b, 0xff, 0x50, 0x45, 0x3c, 0xff, 0x43, 0x38, 0x35, 0xff, 0x3d, 0x36, 0x33, 0xff, 0x3f, 0x36, 0x30, 0xff, 0x43, 0x39, 0x30, 0xff, 0x3c, 0x33, 0x2b, 0xff, 0x39, 0x34, 0x2a, 0xff, 0x34, 0x32, 0x26, 0xff, 0x32, 0x2f, 0x27, 0xff, 0x31, 0x2c, 0x28, 0xff, 0x39, 0x31, 0x2b, 0xff, 0x3b, 0x37, 0x2d, 0xff, 0x32, 0x32, 0x2b, 0xff, 0x34, 0x30, 0x30, 0xff, 0x3b, 0x34, 0x32, 0xff, 0x45, 0x3b, 0x35, 0xff, 0x3a, 0x37, 0x2e, 0xff, 0x3f, 0x3a, 0x39, 0xff, 0x3b, 0x25, 0x30, 0xff, 0x1c, 0x0a, 0x0e, 0xff, 0x10, 0x06, 0x11, 0xff, 0x29, 0x27, 0x46, 0xff, 0x4f, 0x67, 0x84, 0xff, 0x72, 0xa3, 0xbe, 0xff, 0xb1, 0xed, 0xf9, 0xff, 0xca, 0xff, 0xff, 0xff, 0xb9, 0xfd, 0xff, 0xff, 0xb8, 0xf2, 0xfe, 0xff, 0xc8, 0xf0, 0xfe, 0xff, 0xcc, 0xf1, 0xff, 0xff, 0xc0, 0xf1, 0xff, 0xff, 0xbc, 0xf4, 0xfd, 0xff, 0xba, 0xf7, 0xfe, 0xff, 0xc6, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xb2, 0xdd, 0xe5, 0xff, 0x7a, 0xa4, 0xcf, 0xff, 0x59, 0x92, 0xd5, 0xff, 0x32, 0x74, 0xc7, 0xff, 0x0b, 0x59, 0xc5, 0xff, 0x12, 0x69, 0xd9, 0xff, 0x35, 0x8d, 0xe8, 0xff, 0x4d, 0xa2, 0xe5, 0xff, 0x61, 0xae, 0xeb, 0xff, 0x69, 0xb0, 0xf4, 0xff, 0x6d, 0xb6, 0xeb, 0xff, 0x7e, 0xc3, 0xed, 0xff, 0x92, 0xcd, 0xf3, 0xff, 0xa0, 0xd5, 0xfb, 0xff, 0xa7, 0xda, 0xf9, 0xff, 0xa9, 0xdc, 0xfb, 0xff, 0xab, 0xdd, 0xff, 0xff, 0xa1, 0xd3, 0xfa, 0xff, 0x98, 0xcc, 0xf3, 0xff, 0x9b, 0xc9, 0xf1, 0xff, 0xa0, 0xca, 0xf2, 0xff, 0xa6, 0xd2, 0xfa, 0xff, 0xa7, 0xd5, 0xfa, 0xff, 0xab, 0xd9, 0xf8, 0xff, 0xb0, 0xde, 0xf9, 0xff, 0xad, 0xdc, 0xf7, 0xff, 0x9a, 0xd4, 0xf7, 0xff, 0x8d, 0xc3, 0xf7, 0xff, 0x92, 0xb2, 0xe3, 0xff, 0x23, 0x2a, 0x37, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0b, 0x05, 0x07, 0xff, 0x15, 0x0f, 0x07, 0xff, 0x13, 0x10, 0x08, 0xff, 0x0f, 0x0a, 0x09, 0xff, 0x20, 0x10, 0x14, 0xff, 0x21, 0x1c, 0x1a, 0xff, 0x2a, 0x30, 0x25, 0xff, 0x4a, 0x48, 0x37, 0xff, 0x39, 0x47, 0x33, 0xff, 0x43, 0x38, 0x32, 0xff, 0x97, 0x32, 0x46, 0xff, 0xb5, 0x2f, 0x4e, 0xff, 0xa8, 0x2c, 0x5a, 0xff, 0xa0, 0x26, 0x64, 0xff, 0x95, 0x22, 0x70, 0xff, 0x8a, 0x20, 0x81, 0xff, 0x6f, 0x1b, 0x92, 0xff, 0x59, 0x17, 0x9f, 0xff, 0x43, 0x16, 0xa8, 0xff, 0x2f, 0x14, 0xb3, 0xff, 0x27, 0x12, 0xb8, 0xff, 0x18, 0x10, 0xc2, 0xff, 0x14, 0x10, 0xca, 0xff, 0x17, 0x10, 0xd1, 0xff, 0x15, 0x10, 0xd5, 0xff, 0x15, 0x10, 0xd7, 0xff, 0x12, 0x11, 0xd6, 0xff, 0x13, 0x11, 0xcf, 0xff, 0x16, 0x11, 0xc8, 0xff, 0x14, 0x12, 0xc1, 0xff, 0x11, 0x15, 0xbc, 0xff, 0x0d, 0x15, 0xb3, 0xff, 0x20, 0x16, 0xa0, 0xff, 0x38, 0x1e, 0x90, 0xff, 0x55, 0x26, 0x7d, 0xff, 0x87, 0x2a, 0x60, 0xff, 0xb0, 0x30, 0x3e, 0xe7, 0xcc, 0x33, 0x33, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x4f, 0x27, 0x87, 0x6a, 0x52, 0x2a, 0xff, 0x6e, 0x54, 0x2d, 0xff, 0x6f, 0x51, 0x2e, 0xff, 0x6c, 0x4a, 0x2a, 0xff, 0x6b, 0x4d, 0x20, 0xff, 0x63, 0x4c, 0x1a, 0xff, 0x5f, 0x4c, 0x28, 0xff, 0x59, 0x47, 0x3b, 0xff, 0x59, 0x49, 0x43, 0xff, 0x5c, 0x4f, 0x49, 0xff, 0x5a, 0x4e, 0x47, 0xff, 0x62, 0x57, 0x45, 0xff, 0x5e, 0x51, 0x3f, 0xff, 0x51, 0x43, 0x35, 0xff, 0x4d, 0x42, 0x33, 0xff, 0x4b, 0x43, 0x33, 0xff, 0x46, 0x3d, 0x31, 0xff, 0x3a, 0x32, 0x2c, 0xff, 0x3e, 0x3a, 0x38, 0xff, 0x38, 0x34, 0x30, 0xff, 0x34, 0x2e, 0x28, 0xff, 0x3a, 0x34, 0x2c, 0xff, 0x36, 0x32, 0x29, 0xff, 0x33, 0x30, 0x24, 0xff, 0x33, 0x32, 0x27, 0xff, 0x34, 0x30, 0x2b, 0xff, 0x39, 0x2e, 0x2c, 0xff, 0x37, 0x2f, 0x26, 0xff, 0x31, 0x32, 0x1f, 0xff, 0x36, 0x36, 0x24, 0xff, 0x3d, 0x36, 0x29, 0xff, 0x37, 0x32, 0x2c, 0xff, 0x1e, 0x19, 0x1f, 0xff, 0x08, 0x00, 0x11, 0xff, 0x14, 0x0c, 0x2a, 0xff, 0x3f, 0x4e, 0x73, 0xff, 0x7e, 0x9e, 0xc0, 0xff, 0xb9, 0xe4, 0xf8, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xc8, 0xff, 0xff, 0xff, 0xb5, 0xf7, 0xff, 0xff, 0xab, 0xed, 0xfb, 0xff, 0xb7, 0xee, 0xf9, 0xff, 0xb5, 0xee, 0xff, 0xff, 0xaa, 0xed, 0xfb, 0xff, 0xaf, 0xf1, 0xfb, 0xff, 0xb7, 0xf2, 0xfe, 0xff, 0xc5, 0xf6, 0xf8, 0xff, 0xd0, 0xf8, 0xf6, 0xff, 0xbe, 0xf3, 0xfc, 0xff, 0xbe, 0xfc, 0xfe, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xb5, 0xed, 0xfa, 0xff, 0x79, 0xbd, 0xeb, 0xff, 0x40, 0x8d, 0xd3, 0xff, 0x22, 0x6f, 0xc6, 0xff, 0x39, 0x8a, 0xdb, 0xff, 0x56, 0xad, 0xf0, 0xff, 0x5e, 0xb4, 0xed, 0xff, 0x65, 0xb7, 0xee, 0xff, 0x72, 0xbd, 0xed, 0xff, 0x82, 0xc5, 0xee, 0xff, 0x90, 0xcc, 0xf6, 0xff, 0x9c, 0xd6, 0xfc, 0xff, 0xa7, 0xd9, 0xfe, 0xff, 0xaa, 0xd7, 0xfd, 0xff, 0xa9, 0xdb, 0xfe, 0xff, 0xac, 0xde, 0xff, 0xff, 0xa9, 0xd7, 0xfa, 0xff, 0xad, 0xda, 0xfd, 0xff, 0xad, 0xdd, 0xff, 0xff, 0xa9, 0xdb, 0xfd, 0xff, 0xab, 0xd9, 0xfa, 0xff, 0xa8, 0xd5, 0xf7, 0xff, 0x9e, 0xd1, 0xf8, 0xff, 0x86, 0xc8, 0xf3, 0xff, 0x89, 0xbd, 0xf5, 0xff, 0x6f, 0x81, 0xb0, 0xff, 0x03, 0x02, 0x04, 0xff, 0x02, 0x00, 0x00, 0xff, 0x0e, 0x09, 0x09, 0xff, 0x18, 0x10, 0x0c, 0xff, 0x13, 0x10, 0x07, 0xff, 0x10, 0x0c, 0x0a, 0xff, 0x26, 0x13, 0x18, 0xff, 0x2d, 0x22, 0x21, 0xff, 0x28, 0x2e, 0x22, 0xff, 0x40, 0x39, 0x29, 0xff, 0x42, 0x3d, 0x2d, 0xff, 0x34, 0x31, 0x27, 0xff, 0x79, 0x2e, 0x39, 0xff, 0xac, 0x2f, 0x4a, 0xff, 0xa3, 0x29, 0x55, 0xff, 0xa2, 0x2b, 0x68, 0xff, 0x8f, 0x26, 0x74, 0xff, 0x7d, 0x20, 0x82, 0xff, 0x65, 0x19, 0x90, 0xff, 0x50, 0x13, 0x9a, 0xff, 0x3c, 0x11, 0xa3, 0xff, 0x2b, 0x12, 0xab, 0xff, 0x25, 0x12, 0xb1, 0xff, 0x18, 0x11, 0xc1, 0xff, 0x14, 0x10, 0xca, 0xff, 0x15, 0x0f, 0xce, 0xff, 0x15, 0x11, 0xd6, 0xff, 0x15, 0x10, 0xd7, 0xff, 0x10, 0x0e, 0xd2, 0xff, 0x0f, 0x0f, 0xcc, 0xff, 0x12, 0x10, 0xc5, 0xff, 0x11, 0x11, 0xbf, 0xff, 0x11, 0x13, 0xb9, 0xff, 0x0f, 0x15, 0xb1, 0xff, 0x20, 0x19, 0xa3, 0xff, 0x34, 0x1c, 0x95, 0xff, 0x4c, 0x22, 0x7f, 0xff, 0x7a, 0x26, 0x61, 0xff, 0xa0, 0x2d, 0x44, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x52, 0x2d, 0x22, 0x72, 0x50, 0x31, 0xfe, 0x76, 0x53, 0x33, 0xff, 0x79, 0x54, 0x30, 0xff, 0x7a, 0x52, 0x2b, 0xff, 0x75, 0x55, 0x20, 0xff, 0x67, 0x4f, 0x1c, 0xff, 0x60, 0x4c, 0x2b, 0xff, 0x59, 0x46, 0x3a, 0xff, 0x59, 0x4d, 0x3d, 0xff, 0x59, 0x50, 0x42, 0xff, 0x59, 0x4b, 0x46, 0xff, 0x5c, 0x49, 0x3e, 0xff, 0x4e, 0x42, 0x30, 0xff, 0x4c, 0x45, 0x32, 0xff, 0x47, 0x41, 0x2f, 0xff, 0x3d, 0x3b, 0x28, 0xff, 0x37, 0x36, 0x20, 0xff, 0x36, 0x36, 0x26, 0xff, 0x3a, 0x3c, 0x35, 0xff, 0x2c, 0x2e, 0x2b, 0xff, 0x2d, 0x2e, 0x29, 0xff, 0x2f, 0x32, 0x28, 0xff, 0x2f, 0x31, 0x27, 0xff, 0x33, 0x33, 0x29, 0xff, 0x34, 0x33, 0x27, 0xff, 0x2f, 0x2a, 0x22, 0xff, 0x2c, 0x1f, 0x1f, 0xff, 0x35, 0x2c, 0x24, 0xff, 0x35, 0x30, 0x23, 0xff, 0x32, 0x25, 0x20, 0xff, 0x19, 0x07, 0x11, 0xff, 0x0e, 0x02, 0x1e, 0xff, 0x2a, 0x2a, 0x52, 0xff, 0x5b, 0x74, 0x94, 0xff, 0x94, 0xc9, 0xdf, 0xff, 0xc5, 0xff, 0xff, 0xff, 0xce, 0xff, 0xff, 0xff, 0xba, 0xfb, 0xff, 0xff, 0xb4, 0xf0, 0xff, 0xff, 0xad, 0xeb, 0xfd, 0xff, 0xa9, 0xea, 0xfb, 0xff, 0xad, 0xe9, 0xfe, 0xff, 0xab, 0xeb, 0xfb, 0xff, 0xa2, 0xe8, 0xf9, 0xff, 0x9d, 0xe5, 0xf6, 0xff, 0xa0, 0xe6, 0xfb, 0xff, 0xa1, 0xe5, 0xff, 0xff, 0xa6, 0xe6, 0xff, 0xff, 0xaf, 0xea, 0xff, 0xff, 0xa5, 0xe5, 0xfc, 0xff, 0xaf, 0xf3, 0xfc, 0xff, 0xc3, 0xf9, 0xff, 0xff, 0xbe, 0xf8, 0xfc, 0xff, 0xbe, 0xf8, 0xfb, 0xff, 0xc7, 0xfb, 0xfe, 0xff, 0xcd, 0xff, 0xff, 0xff, 0xbd, 0xf8, 0xff, 0xff, 0x82, 0xc6, 0xe5, 0xff, 0x3d, 0x84, 0xce, 0xff, 0x26, 0x78, 0xd5, 0xff, 0x42, 0xa0, 0xea, 0xff, 0x5a, 0xb3, 0xf3, 0xff, 0x61, 0xb3, 0xed, 0xff, 0x6c, 0xbc, 0xee, 0xff, 0x77, 0xc4, 0xf5, 0xff, 0x86, 0xc8, 0xfd, 0xff, 0x93, 0xc8, 0xfb, 0xff, 0x9a, 0xcb, 0xf6, 0xff, 0x98, 0xd1, 0xf4, 0xff, 0x99, 0xd1, 0xf5, 0xff, 0xa0, 0xd5, 0xf9, 0xff, 0xa0, 0xd5, 0xf9, 0xff, 0x99, 0xd3, 0xf7, 0xff, 0x90, 0xd0, 0xf2, 0xff, 0x92, 0xca, 0xef, 0xff, 0x90, 0xc3, 0xf5, 0xff, 0x80, 0xbd, 0xfc, 0xff, 0x65, 0xa1, 0xe2, 0xff, 0x75, 0x9d, 0xd7, 0xff, 0x37, 0x42, 0x62, 0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x07, 0x00, 0xff, 0x17, 0x10, 0x07, 0xff, 0x1b, 0x0f, 0x0d, 0xff, 0x17, 0x0d, 0x0c, 0xff, 0x17, 0x12, 0x12, 0xff, 0x2f, 0x1c, 0x20, 0xff, 0x35, 0x21, 0x21, 0xff, 0x32, 0x29, 0x1f, 0xff, 0x39, 0x33, 0x27, 0xff, 0x3a, 0x34, 0x29, 0xff, 0x2d, 0x30, 0x22, 0xff, 0x4e, 0x32, 0x2d, 0xff, 0x98, 0x33, 0x44, 0xff, 0xaa, 0x25, 0x52, 0xff, 0x9c, 0x24, 0x63, 0xff, 0x80, 0x22, 0x70, 0xff, 0x6b, 0x20, 0x81, 0xff, 0x56, 0x1b, 0x91, 0xff, 0x48, 0x14, 0x9a, 0xff, 0x3e, 0x14, 0xa4, 0xff, 0x2e, 0x12, 0xaa, 0xff, 0x25, 0x12, 0xaf, 0xff, 0x1a, 0x13, 0xc0, 0xff, 0x13, 0x10, 0xc9, 0xff, 0x10, 0x0b, 0xc9, 0xff, 0x10, 0x0d, 0xcd, 0xff, 0x14, 0x10, 0xd2, 0xff, 0x0e, 0x0e, 0xcc, 0xff, 0x0d, 0x10, 0xc7, 0xff, 0x10, 0x11, 0xc2, 0xff, 0x10, 0x13, 0xbb, 0xff, 0x11, 0x15, 0xb5, 0xff, 0x0f, 0x16, 0xad, 0xff, 0x1e, 0x19, 0xa0, 0xff, 0x2e, 0x19, 0x92, 0xff, 0x47, 0x21, 0x7d, 0xff, 0x73, 0x29, 0x64, 0xfe, 0x91, 0x2b, 0x48, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x55, 0x33, 0xb4, 0x79, 0x54, 0x31, 0xff, 0x79, 0x55, 0x30, 0xff, 0x79, 0x55, 0x2e, 0xff, 0x73, 0x55, 0x25, 0xff, 0x63, 0x51, 0x1f, 0xff, 0x5b, 0x4e, 0x35, 0xff, 0x53, 0x47, 0x3e, 0xff, 0x4f, 0x4e, 0x3a, 0xff, 0x47, 0x4c, 0x37, 0xff, 0x4a, 0x46, 0x46, 0xff, 0x4c, 0x3f, 0x3c, 0xff, 0x43, 0x3e, 0x2e, 0xff, 0x38, 0x3a, 0x2f, 0xff, 0x33, 0x33, 0x2d, 0xff, 0x32, 0x33, 0x29, 0xff, 0x38, 0x32, 0x25, 0xff, 0x34, 0x29, 0x22, 0xff, 0x37, 0x30, 0x2f, 0xff, 0x37, 0x2f, 0x2a, 0xff, 0x31, 0x29, 0x21, 0xff, 0x2e, 0x2c, 0x26, 0xff, 0x28, 0x28, 0x26, 0xff, 0x25, 0x27, 0x29, 0xff, 0x2e, 0x27, 0x2b, 0xff, 0x34, 0x2a, 0x27, 0xff, 0x32, 0x27, 0x19, 0xff, 0x18, 0x17, 0x00, 0xff, 0x01, 0x0b, 0x00, 0xff, 0x17, 0x18, 0x2d, 0xff, 0x47, 0x4e, 0x78, 0xff, 0x8e, 0xa2, 0xc6, 0xff, 0xcb, 0xee, 0xfb, 0xff, 0xda, 0xff, 0xff, 0xff, 0xb5, 0xfb, 0xff, 0xff, 0xa8, 0xf1, 0xff, 0xff, 0xb3, 0xf2, 0xfe, 0xff, 0xb0, 0xef, 0xfe, 0xff, 0xad, 0xea, 0xf9, 0xff, 0xa9, 0xe9, 0xfb, 0xff, 0xa9, 0xe9, 0xff, 0xff, 0xa6, 0xe3, 0xfc, 0xff, 0xa2, 0xe1, 0xfb, 0xff, 0xa9, 0xe3, 0xf9, 0xff, 0xb0, 0xe7, 0xfc, 0xff, 0xa5, 0xdd, 0xfb, 0xff, 0x93, 0xcb, 0xf8, 0xff, 0x77, 0xba, 0xf5, 0xff, 0x6f, 0xbe, 0xf5, 0xff, 0x79, 0xcc, 0xfd, 0xff, 0x71, 0xc4, 0xf9, 0xff, 0x91, 0xd9, 0xff, 0xff, 0xa1, 0xdf, 0xfc, 0xff, 0xae, 0xe8, 0xfd, 0xff, 0xbf, 0xf2, 0xfd, 0xff, 0xc6, 0xf2, 0xf9, 0xff, 0xca, 0xfa, 0xfd, 0xff, 0xc3, 0xfd, 0xff, 0xff, 0xac, 0xe1, 0xfe, 0xff, 0x68, 0xa7, 0xdf, 0xff, 0x33, 0x80, 0xd1, 0xff, 0x40, 0x93, 0xde, 0xff, 0x59, 0xa5, 0xf1, 0xff, 0x5e, 0xa3, 0xee, 0xff, 0x6c, 0xae, 0xf1, 0xff, 0x79, 0xb3, 0xef, 0xff, 0x6f, 0xba, 0xe4, 0xff, 0x6f, 0xc3, 0xe7, 0xff, 0x77, 0xbf, 0xf2, 0xff, 0x77, 0xb8, 0xee, 0xff, 0x79, 0xb8, 0xec, 0xff, 0x80, 0xbd, 0xf3, 0xff, 0x7e, 0xbf, 0xf5, 0xff, 0x78, 0xba, 0xf1, 0xff, 0x75, 0xb6, 0xe8, 0xff, 0x76, 0xb1, 0xf1, 0xff, 0x5b, 0x99, 0xe4, 0xff, 0x47, 0x7b, 0xc2, 0xff, 0x54, 0x6e, 0xa0, 0xff, 0x10, 0x10, 0x20, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0e, 0x0d, 0x08, 0xff, 0x1a, 0x0f, 0x09, 0xff, 0x1a, 0x0b, 0x0c, 0xff, 0x1b, 0x12, 0x13, 0xff, 0x1e, 0x17, 0x14, 0xff, 0x2e, 0x22, 0x1e, 0xff, 0x35, 0x24, 0x20, 0xff, 0x36, 0x27, 0x21, 0xff, 0x3c, 0x31, 0x2a, 0xff, 0x3f, 0x39, 0x2d, 0xff, 0x2f, 0x35, 0x27, 0xff, 0x39, 0x2d, 0x27, 0xff, 0x81, 0x32, 0x40, 0xff, 0xa8, 0x29, 0x55, 0xff, 0x9a, 0x1f, 0x61, 0xff, 0x7f, 0x1f, 0x76, 0xff, 0x67, 0x1a, 0x7f, 0xff, 0x55, 0x17, 0x8e, 0xff, 0x43, 0x14, 0x9e, 0xff, 0x38, 0x11, 0xa1, 0xff, 0x2a, 0x11, 0xa8, 0xff, 0x22, 0x12, 0xae, 0xff, 0x1b, 0x10, 0xba, 0xff, 0x13, 0x0e, 0xc7, 0xff, 0x0e, 0x0c, 0xca, 0xff, 0x11, 0x0e, 0xcb, 0xff, 0x15, 0x12, 0xce, 0xff, 0x12, 0x10, 0xc8, 0xff, 0x10, 0x10, 0xc3, 0xff, 0x11, 0x12, 0xbf, 0xff, 0x12, 0x13, 0xba, 0xff, 0x11, 0x14, 0xb3, 0xff, 0x11, 0x15, 0xac, 0xff, 0x1d, 0x17, 0x9c, 0xff, 0x27, 0x18, 0x8e, 0xff, 0x3f, 0x21, 0x7a, 0xff, 0x6d, 0x28, 0x62, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x57, 0x33, 0x40, 0x77, 0x57, 0x33, 0xff, 0x7b, 0x56, 0x32, 0xff, 0x7e, 0x54, 0x2f, 0xff, 0x7c, 0x55, 0x2d, 0xff, 0x6c, 0x51, 0x28, 0xff, 0x5f, 0x49, 0x3a, 0xff, 0x57, 0x43, 0x42, 0xff, 0x54, 0x47, 0x39, 0xff, 0x51, 0x49, 0x35, 0xff, 0x49, 0x3d, 0x39, 0xff, 0x48, 0x3a, 0x32, 0xff, 0x43, 0x3c, 0x31, 0xff, 0x31, 0x2c, 0x30, 0xff, 0x31, 0x2b, 0x33, 0xff, 0x34, 0x2f, 0x32, 0xff, 0x33, 0x27, 0x23, 0xff, 0x34, 0x27, 0x22, 0xff, 0x33, 0x2c, 0x28, 0xff, 0x33, 0x2e, 0x24, 0xff, 0x39, 0x2a, 0x23, 0xff, 0x39, 0x25, 0x25, 0xff, 0x30, 0x22, 0x23, 0xff, 0x2a, 0x21, 0x24, 0xff, 0x1e, 0x1b, 0x1c, 0xff, 0x00, 0x02, 0x02, 0xff, 0x05, 0x02, 0x0f, 0xff, 0x2f, 0x2c, 0x4b, 0xff, 0x6c, 0x80, 0x98, 0xff, 0xaa, 0xd4, 0xde, 0xff, 0xd4, 0xff, 0xff, 0xff, 0xc6, 0xff, 0xff, 0xff, 0xab, 0xf6, 0xff, 0xff, 0xa5, 0xeb, 0xfe, 0xff, 0xad, 0xed, 0xf7, 0xff, 0xb2, 0xef, 0xfc, 0xff, 0xb1, 0xf0, 0xff, 0xff, 0xac, 0xed, 0xfb, 0xff, 0xa8, 0xe8, 0xf6, 0xff, 0xad, 0xea, 0xfc, 0xff, 0xac, 0xe4, 0xfb, 0xff, 0xa4, 0xd9, 0xf6, 0xff, 0xa5, 0xdb, 0xfb, 0xff, 0x9f, 0xd9, 0xff, 0xff, 0x9d, 0xd6, 0xfd, 0xff, 0xa1, 0xcf, 0xff, 0xff, 0x81, 0xb5, 0xfd, 0xff, 0x52, 0x93, 0xe7, 0xff, 0x14, 0x60, 0xbb, 0xff, 0x2d, 0x77, 0xda, 0xff, 0x1f, 0x64, 0xc4, 0xff, 0x41, 0x87, 0xd9, 0xff, 0x6e, 0xb4, 0xf6, 0xff, 0x84, 0xc9, 0xfb, 0xff, 0x94, 0xd2, 0xf8, 0xff, 0xa7, 0xe2, 0xfa, 0xff, 0xb2, 0xec, 0xfb, 0xff, 0xba, 0xf0, 0xfb, 0xff, 0xc1, 0xf2, 0xfe, 0xff, 0xc5, 0xf7, 0xff, 0xff, 0x86, 0xb8, 0xe8, 0xff, 0x25, 0x66, 0xba, 0xff, 0x24, 0x79, 0xd8, 0xff, 0x36, 0x88, 0xeb, 0xff, 0x52, 0x8f, 0xe9, 0xff, 0x62, 0x9e, 0xe9, 0xff, 0x5f, 0xad, 0xe9, 0xff, 0x51, 0xa6, 0xde, 0xff, 0x50, 0x9d, 0xe0, 0xff, 0x63, 0xa3, 0xe8, 0xff, 0x69, 0xa3, 0xe8, 0xff, 0x69, 0xa3, 0xe8, 0xff, 0x69, 0xa7, 0xeb, 0xff, 0x5b, 0x9c, 0xe7, 0xff, 0x58, 0x99, 0xe2, 0xff, 0x47, 0x80, 0xd3, 0xff, 0x23, 0x57, 0xad, 0xff, 0x3d, 0x6b, 0xa8, 0xff, 0x2a, 0x3b, 0x58, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0b, 0x05, 0x06, 0xff, 0x16, 0x0c, 0x12, 0xff, 0x15, 0x08, 0x0d, 0xff, 0x18, 0x0b, 0x0b, 0xff, 0x1d, 0x16, 0x12, 0xff, 0x21, 0x19, 0x14, 0xff, 0x2e, 0x21, 0x1c, 0xff, 0x34, 0x24, 0x1e, 0xff, 0x32, 0x23, 0x1c, 0xff, 0x38, 0x2b, 0x24, 0xff, 0x3d, 0x33, 0x2c, 0xff, 0x2e, 0x2e, 0x26, 0xff, 0x34, 0x28, 0x24, 0xff, 0x71, 0x30, 0x3b, 0xff, 0x9e, 0x2d, 0x57, 0xff, 0x9b, 0x20, 0x62, 0xff, 0x86, 0x1b, 0x75, 0xff, 0x6f, 0x19, 0x80, 0xff, 0x57, 0x18, 0x8f, 0xff, 0x40, 0x13, 0x9c, 0xff, 0x30, 0x0d, 0x9d, 0xff, 0x28, 0x11, 0xa9, 0xff, 0x23, 0x12, 0xae, 0xff, 0x1a, 0x0f, 0xb4, 0xff, 0x11, 0x0c, 0xbe, 0xff, 0x10, 0x0e, 0xc4, 0xff, 0x16, 0x11, 0xc8, 0xff, 0x14, 0x0f, 0xc7, 0xff, 0x12, 0x0f, 0xc2, 0xff, 0x12, 0x10, 0xbe, 0xff, 0x11, 0x11, 0xb9, 0xff, 0x11, 0x12, 0xb5, 0xff, 0x11, 0x13, 0xb0, 0xff, 0x0e, 0x14, 0xa9, 0xff, 0x16, 0x17, 0x9a, 0xff, 0x22, 0x1b, 0x8e, 0xff, 0x35, 0x21, 0x7a, 0xff, 0x5f, 0x23, 0x5f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x54, 0x30, 0xcd, 0x7c, 0x56, 0x31, 0xff, 0x80, 0x54, 0x2e, 0xff, 0x7b, 0x51, 0x2b, 0xff, 0x6f, 0x50, 0x2b, 0xff, 0x59, 0x40, 0x33, 0xff, 0x55, 0x40, 0x42, 0xff, 0x59, 0x48, 0x3d, 0xff, 0x55, 0x46, 0x31, 0xff, 0x4b, 0x37, 0x2d, 0xff, 0x43, 0x32, 0x28, 0xff, 0x3f, 0x33, 0x29, 0xff, 0x38, 0x2f, 0x31, 0xff, 0x34, 0x29, 0x31, 0xff, 0x3b, 0x2f, 0x33, 0xff, 0x3d, 0x30, 0x2a, 0xff, 0x37, 0x2f, 0x23, 0xff, 0x2b, 0x29, 0x1f, 0xff, 0x2a, 0x26, 0x20, 0xff, 0x2a, 0x2a, 0x21, 0xff, 0x29, 0x28, 0x1d, 0xff, 0x26, 0x19, 0x18, 0xff, 0x0d, 0x00, 0x00, 0xff, 0x09, 0x03, 0x13, 0xff, 0x3f, 0x4b, 0x69, 0xff, 0x8b, 0xa5, 0xc6, 0xff, 0xc3, 0xf1, 0xff, 0xff, 0xd5, 0xff, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xa0, 0xec, 0xfd, 0xff, 0x93, 0xe7, 0xfa, 0xff, 0x94, 0xe5, 0xff, 0xff, 0xa4, 0xea, 0xfd, 0xff, 0xb6, 0xef, 0xf2, 0xff, 0xbc, 0xf1, 0xfb, 0xff, 0xb3, 0xec, 0xff, 0xff, 0xad, 0xe9, 0xfa, 0xff, 0xaa, 0xe7, 0xf6, 0xff, 0xa3, 0xe1, 0xf3, 0xff, 0xa2, 0xde, 0xfa, 0xff, 0xa0, 0xd8, 0xfd, 0xff, 0x96, 0xcc, 0xf9, 0xff, 0x82, 0xbe, 0xfb, 0xff, 0x46, 0x8b, 0xd5, 0xff, 0x47, 0x93, 0xe1, 0xff, 0x42, 0x89, 0xe4, 0xff, 0x20, 0x5d, 0xc3, 0xff, 0x00, 0x33, 0x9c, 0xff, 0x05, 0x42, 0xaa, 0xff, 0x08, 0x32, 0x93, 0xff, 0x0b, 0x40, 0x9b, 0xff, 0x1a, 0x63, 0xbf, 0xff, 0x2f, 0x7d, 0xd9, 0xff, 0x4f, 0x9d, 0xf2, 0xff, 0x6c, 0xb9, 0xff, 0xff, 0x81, 0xcd, 0xff, 0xff, 0x98, 0xdb, 0xff, 0xff, 0xa2, 0xe3, 0xfd, 0xff, 0xaa, 0xe9, 0xfa, 0xff, 0xac, 0xde, 0xff, 0xff, 0x3c, 0x7d, 0xce, 0xff, 0x00, 0x53, 0xc2, 0xff, 0x00, 0x64, 0xdf, 0xff, 0x13, 0x6a, 0xd8, 0xff, 0x2a, 0x72, 0xd1, 0xff, 0x3f, 0x7f, 0xda, 0xff, 0x4e, 0x88, 0xe1, 0xff, 0x48, 0x83, 0xda, 0xff, 0x4a, 0x83, 0xd8, 0xff, 0x48, 0x7d, 0xd1, 0xff, 0x48, 0x7c, 0xce, 0xff, 0x3f, 0x79, 0xc8, 0xff, 0x32, 0x69, 0xb6, 0xff, 0x25, 0x59, 0xa7, 0xff, 0x1e, 0x45, 0x99, 0xff, 0x38, 0x56, 0x9b, 0xff, 0x38, 0x4f, 0x77, 0xff, 0x03, 0x07, 0x0d, 0xff, 0x06, 0x00, 0x00, 0xff, 0x18, 0x0b, 0x07, 0xff, 0x19, 0x0a, 0x14, 0xff, 0x0f, 0x07, 0x0c, 0xff, 0x13, 0x10, 0x08, 0xff, 0x1b, 0x17, 0x0f, 0xff, 0x24, 0x19, 0x14, 0xff, 0x30, 0x21, 0x1b, 0xff, 0x37, 0x25, 0x1e, 0xff, 0x35, 0x24, 0x1c, 0xff, 0x3b, 0x30, 0x28, 0xff, 0x38, 0x2c, 0x27, 0xff, 0x2f, 0x29, 0x25, 0xff, 0x2f, 0x2a, 0x22, 0xff, 0x4a, 0x26, 0x27, 0xff, 0x7e, 0x28, 0x49, 0xff, 0x99, 0x23, 0x60, 0xff, 0x8f, 0x1c, 0x6f, 0xff, 0x76, 0x1a, 0x80, 0xff, 0x53, 0x17, 0x89, 0xff, 0x3b, 0x14, 0x92, 0xff, 0x31, 0x14, 0x9c, 0xff, 0x27, 0x13, 0xaa, 0xff, 0x23, 0x13, 0xae, 0xff, 0x1c, 0x11, 0xb1, 0xff, 0x14, 0x0f, 0xb7, 0xff, 0x10, 0x0e, 0xbb, 0xff, 0x13, 0x11, 0xbf, 0xff, 0x14, 0x10, 0xbf, 0xff, 0x0f, 0x0d, 0xb8, 0xff, 0x0d, 0x0c, 0xb2, 0xff, 0x0f, 0x0f, 0xb0, 0xff, 0x10, 0x12, 0xae, 0xff, 0x10, 0x15, 0xac, 0xff, 0x0d, 0x16, 0xa6, 0xff, 0x15, 0x17, 0x98, 0xff, 0x1c, 0x1c, 0x8d, 0xff, 0x2c, 0x21, 0x79, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x58, 0x35, 0x51, 0x7d, 0x58, 0x34, 0xff, 0x7e, 0x56, 0x31, 0xff, 0x77, 0x57, 0x2e, 0xff, 0x62, 0x50, 0x27, 0xff, 0x4a, 0x3e, 0x2d, 0xff, 0x44, 0x37, 0x35, 0xff, 0x40, 0x3c, 0x2e, 0xff, 0x4c, 0x48, 0x2f, 0xff, 0x5a, 0x4a, 0x3b, 0xff, 0x48, 0x3a, 0x2b, 0xff, 0x3e, 0x34, 0x20, 0xff, 0x39, 0x31, 0x25, 0xff, 0x2f, 0x27, 0x21, 0xff, 0x3b, 0x30, 0x27, 0xff, 0x41, 0x36, 0x26, 0xff, 0x33, 0x2f, 0x1a, 0xff, 0x2a, 0x2a, 0x19, 0xff, 0x2e, 0x29, 0x25, 0xff, 0x1a, 0x11, 0x16, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x13, 0xff, 0x41, 0x50, 0x6e, 0xff, 0x9d, 0xc1, 0xd9, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xff, 0xb8, 0xfa, 0xfe, 0xff, 0xa6, 0xf1, 0xfb, 0xff, 0xa3, 0xe7, 0xfd, 0xff, 0xa3, 0xe2, 0xfe, 0xff, 0xaa, 0xe4, 0xfd, 0xff, 0xb4, 0xeb, 0xf7, 0xff, 0xb8, 0xef, 0xf6, 0xff, 0xb6, 0xeb, 0xfa, 0xff, 0xb9, 0xe7, 0xff, 0xff, 0xb9, 0xe3, 0xfd, 0xff, 0xb0, 0xe0, 0xf6, 0xff, 0xa6, 0xdf, 0xf4, 0xff, 0x98, 0xd8, 0xf0, 0xff, 0x8e, 0xd1, 0xf4, 0xff, 0x89, 0xcc, 0xfb, 0xff, 0x7b, 0xb9, 0xee, 0xff, 0x59, 0x9e, 0xe7, 0xff, 0x0d, 0x4a, 0xa5, 0xff, 0x00, 0x32, 0x8e, 0xff, 0x14, 0x54, 0xb2, 0xff, 0x0c, 0x47, 0xa6, 0xff, 0x04, 0x3a, 0x98, 0xff, 0x24, 0x53, 0xad, 0xff, 0x1d, 0x38, 0x8c, 0xff, 0x00, 0x1b, 0x76, 0xff, 0x02, 0x3c, 0xa2, 0xff, 0x07, 0x49, 0xac, 0xff, 0x15, 0x5c, 0xc1, 0xff, 0x27, 0x70, 0xd3, 0xff, 0x2e, 0x76, 0xd2, 0xff, 0x3a, 0x83, 0xcf, 0xff, 0x79, 0xc7, 0xf8, 0xff, 0x95, 0xe2, 0xfd, 0xff, 0xa4, 0xe1, 0xff, 0xff, 0x62, 0x9f, 0xe5, 0xff, 0x00, 0x3e, 0xba, 0xff, 0x02, 0x57, 0xe3, 0xff, 0x02, 0x64, 0xda, 0xff, 0x00, 0x58, 0xbc, 0xff, 0x07, 0x4f, 0xbb, 0xff, 0x25, 0x58, 0xc5, 0xff, 0x2a, 0x5d, 0xbe, 0xff, 0x21, 0x56, 0xb0, 0xff, 0x23, 0x55, 0xae, 0xff, 0x22, 0x56, 0xae, 0xff, 0x13, 0x4d, 0xa3, 0xff, 0x0f, 0x46, 0x95, 0xff, 0x10, 0x43, 0x95, 0xff, 0x29, 0x4e, 0xa2, 0xff, 0x2d, 0x41, 0x79, 0xff, 0x04, 0x06, 0x19, 0xff, 0x04, 0x02, 0x00, 0xff, 0x16, 0x10, 0x00, 0xff, 0x1c, 0x0e, 0x06, 0xff, 0x15, 0x07, 0x0b, 0xff, 0x0e, 0x0b, 0x05, 0xff, 0x12, 0x14, 0x05, 0xff, 0x17, 0x13, 0x0b, 0xff, 0x23, 0x18, 0x13, 0xff, 0x30, 0x22, 0x1a, 0xff, 0x3c, 0x29, 0x21, 0xff, 0x3b, 0x2a, 0x21, 0xff, 0x42, 0x39, 0x2c, 0xff, 0x43, 0x34, 0x2c, 0xff, 0x38, 0x2f, 0x2a, 0xff, 0x2b, 0x2e, 0x1e, 0xff, 0x36, 0x2c, 0x1e, 0xff, 0x66, 0x2a, 0x3f, 0xff, 0x8f, 0x22, 0x56, 0xff, 0x8f, 0x1c, 0x68, 0xff, 0x74, 0x19, 0x77, 0xff, 0x52, 0x18, 0x81, 0xff, 0x38, 0x13, 0x86, 0xff, 0x2a, 0x12, 0x91, 0xff, 0x23, 0x12, 0xa6, 0xff, 0x21, 0x12, 0xab, 0xff, 0x1b, 0x10, 0xae, 0xff, 0x14, 0x10, 0xb3, 0xff, 0x12, 0x10, 0xb6, 0xff, 0x14, 0x10, 0xb9, 0xff, 0x13, 0x0f, 0xb8, 0xff, 0x0f, 0x0d, 0xb2, 0xff, 0x12, 0x11, 0xaf, 0xff, 0x16, 0x13, 0xaf, 0xff, 0x12, 0x14, 0xac, 0xff, 0x0e, 0x13, 0xa7, 0xff, 0x0d, 0x16, 0xa3, 0xff, 0x1a, 0x1a, 0x99, 0xff, 0x1a, 0x19, 0x8a, 0xff, 0x25, 0x1c, 0x74, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0x83, 0x55, 0x35, 0xce, 0x82, 0x58, 0x32, 0xff, 0x7d, 0x5c, 0x32, 0xff, 0x62, 0x4d, 0x2c, 0xff, 0x4a, 0x38, 0x2c, 0xff, 0x2f, 0x1a, 0x20, 0xff, 0x18, 0x05, 0x02, 0xff, 0x3f, 0x2c, 0x1d, 0xff, 0x54, 0x3e, 0x2f, 0xff, 0x49, 0x37, 0x2b, 0xff, 0x4c, 0x46, 0x34, 0xff, 0x42, 0x42, 0x30, 0xff, 0x3a, 0x35, 0x27, 0xff, 0x39, 0x2c, 0x1b, 0xff, 0x3c, 0x28, 0x17, 0xff, 0x37, 0x29, 0x18, 0xff, 0x1d, 0x0e, 0x04, 0xff, 0x09, 0x00, 0x02, 0xff, 0x23, 0x0e, 0x33, 0xff, 0x5b, 0x5c, 0x83, 0xff, 0x96, 0xc7, 0xdd, 0xff, 0xcb, 0xff, 0xff, 0xff, 0xcb, 0xff, 0xff, 0xff, 0xb2, 0xf5, 0xff, 0xff, 0xae, 0xed, 0xff, 0xff, 0xa8, 0xed, 0xfc, 0xff, 0xa6, 0xed, 0xf9, 0xff, 0xad, 0xed, 0xf4, 0xff, 0xb5, 0xed, 0xf1, 0xff, 0xc1, 0xeb, 0xf6, 0xff, 0xc2, 0xe7, 0xf8, 0xff, 0xba, 0xe5, 0xfa, 0xff, 0xb5, 0xe4, 0xfe, 0xff, 0xb2, 0xe0, 0xff, 0xff, 0xb1, 0xdc, 0xfc, 0xff, 0xaa, 0xda, 0xfa, 0xff, 0x98, 0xd4, 0xf5, 0xff, 0x8e, 0xce, 0xf6, 0xff, 0x81, 0xc2, 0xf2, 0xff, 0x6f, 0xb2, 0xec, 0xff, 0x3d, 0x7e, 0xbe, 0xff, 0x26, 0x63, 0xa9, 0xff, 0x0e, 0x38, 0x7f, 0xff, 0x07, 0x25, 0x6d, 0xff, 0x23, 0x4e, 0x9a, 0xff, 0x1b, 0x4b, 0x99, 0xff, 0x13, 0x46, 0x95, 0xff, 0x25, 0x53, 0xa5, 0xff, 0x1c, 0x41, 0x95, 0xff, 0x01, 0x1a, 0x74, 0xff, 0x07, 0x22, 0x7c, 0xff, 0x0a, 0x2d, 0x7d, 0xff, 0x08, 0x38, 0x8f, 0xff, 0x06, 0x36, 0x96, 0xff, 0x00, 0x13, 0x76, 0xff, 0x27, 0x5e, 0xb4, 0xff, 0x69, 0xb5, 0xf1, 0xff, 0x86, 0xd3, 0xf1, 0xff, 0x98, 0xde, 0xef, 0xff, 0xa3, 0xde, 0xf5, 0xff, 0x6d, 0x95, 0xdc, 0xff, 0x06, 0x31, 0xa5, 0xff, 0x0a, 0x55, 0xc8, 0xff, 0x10, 0x66, 0xd7, 0xff, 0x0a, 0x59, 0xd6, 0xff, 0x06, 0x4c, 0xcc, 0xff, 0x0a, 0x4b, 0xbe, 0xff, 0x11, 0x4d, 0xb6, 0xff, 0x0f, 0x48, 0xad, 0xff, 0x13, 0x48, 0xa4, 0xff, 0x1b, 0x4e, 0x9f, 0xff, 0x23, 0x54, 0x97, 0xff, 0x21, 0x47, 0x88, 0xff, 0x12, 0x26, 0x5c, 0xff, 0x00, 0x00, 0x16, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0c, 0x08, 0x01, 0xff, 0x17, 0x0f, 0x00, 0xff, 0x13, 0x0b, 0x03, 0xff, 0x07, 0x01, 0x01, 0xff, 0x0e, 0x09, 0x03, 0xff, 0x19, 0x13, 0x07, 0xff, 0x1b, 0x11, 0x0c, 0xff, 0x21, 0x17, 0x12, 0xff, 0x2b, 0x1c, 0x16, 0xff, 0x3d, 0x29, 0x21, 0xff, 0x3c, 0x2d, 0x20, 0xff, 0x4b, 0x3c, 0x31, 0xff, 0x53, 0x43, 0x3c, 0xff, 0x46, 0x3d, 0x34, 0xff, 0x42, 0x43, 0x31, 0xff, 0x45, 0x49, 0x32, 0xff, 0x54, 0x31, 0x39, 0xff, 0x80, 0x1d, 0x4f, 0xff, 0x8e, 0x1b, 0x67, 0xff, 0x72, 0x1b, 0x76, 0xff, 0x53, 0x19, 0x81, 0xff, 0x3c, 0x15, 0x87, 0xff, 0x2a, 0x13, 0x90, 0xff, 0x1d, 0x11, 0xa0, 0xff, 0x1b, 0x0f, 0xa5, 0xff, 0x19, 0x10, 0xa7, 0xff, 0x14, 0x10, 0xab, 0xff, 0x13, 0x10, 0xae, 0xff, 0x14, 0x0e, 0xb0, 0xff, 0x13, 0x10, 0xb1, 0xff, 0x0f, 0x12, 0xad, 0xff, 0x0f, 0x12, 0xa9, 0xff, 0x15, 0x13, 0xa9, 0xff, 0x17, 0x14, 0xa7, 0xff, 0x12, 0x12, 0xa2, 0xff, 0x0f, 0x14, 0x9f, 0xff, 0x17, 0x1a, 0x96, 0xff, 0x19, 0x1b, 0x88, 0xce, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x5b, 0x3a, 0x46, 0x87, 0x54, 0x33, 0xff, 0x83, 0x58, 0x31, 0xff, 0x6b, 0x3c, 0x25, 0xff, 0x34, 0x06, 0x09, 0xff, 0x6e, 0x4f, 0x62, 0xff, 0x9a, 0x7b, 0x87, 0xff, 0x48, 0x20, 0x23, 0xff, 0x30, 0x04, 0x06, 0xff, 0x3d, 0x0e, 0x16, 0xff, 0x46, 0x22, 0x25, 0xff, 0x57, 0x3c, 0x3b, 0xff, 0x51, 0x3c, 0x38, 0xff, 0x40, 0x30, 0x23, 0xff, 0x43, 0x31, 0x21, 0xff, 0x30, 0x26, 0x25, 0xff, 0x4a, 0x43, 0x5c, 0xff, 0x81, 0x8b, 0xac, 0xff, 0xb8, 0xe0, 0xf2, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xd2, 0xff, 0xff, 0xff, 0xaa, 0xfa, 0xfc, 0xff, 0xa3, 0xf2, 0xfa, 0xff, 0xaa, 0xef, 0xfb, 0xff, 0xaa, 0xe9, 0xf6, 0xff, 0xb1, 0xe4, 0xf6, 0xff, 0xb5, 0xe6, 0xfb, 0xff, 0xb2, 0xe8, 0xf8, 0xff, 0xb7, 0xec, 0xf4, 0xff, 0xb8, 0xe9, 0xf8, 0xff, 0xb8, 0xe2, 0xfa, 0xff, 0xbc, 0xe2, 0xfb, 0xff, 0xb3, 0xe0, 0xf8, 0xff, 0xa8, 0xde, 0xf2, 0xff, 0x99, 0xd4, 0xee, 0xff, 0x8f, 0xce, 0xf3, 0xff, 0x7f, 0xc1, 0xef, 0xff, 0x74, 0xb4, 0xef, 0xff, 0x59, 0x97, 0xd8, 0xff, 0x2f, 0x6b, 0xb0, 0xff, 0x19, 0x52, 0x98, 0xff, 0x27, 0x55, 0x98, 0xff, 0x1b, 0x39, 0x77, 0xff, 0x10, 0x28, 0x64, 0xff, 0x22, 0x42, 0x82, 0xff, 0x1e, 0x45, 0x8a, 0xff, 0x1c, 0x49, 0x91, 0xff, 0x1c, 0x4b, 0x97, 0xff, 0x17, 0x41, 0x95, 0xff, 0x1f, 0x3b, 0x93, 0xff, 0x13, 0x1c, 0x6e, 0xff, 0x06, 0x0f, 0x56, 0xff, 0x13, 0x2f, 0x78, 0xff, 0x00, 0x19, 0x6a, 0xff, 0x00, 0x0e, 0x69, 0xff, 0x38, 0x67, 0xc3, 0xff, 0x5d, 0xa5, 0xe4, 0xff, 0x7d, 0xcd, 0xe6, 0xff, 0x98, 0xdf, 0xe3, 0xff, 0xa0, 0xdd, 0xe4, 0xff, 0xd1, 0xff, 0xff, 0xff, 0x67, 0x87, 0xb1, 0xff, 0x00, 0x00, 0x48, 0xff, 0x1c, 0x36, 0x96, 0xff, 0x24, 0x4e, 0xb4, 0xff, 0x1d, 0x55, 0xbc, 0xff, 0x12, 0x53, 0xb6, 0xff, 0x0e, 0x49, 0xad, 0xff, 0x13, 0x42, 0x9c, 0xff, 0x1c, 0x3e, 0x81, 0xff, 0x1b, 0x36, 0x62, 0xff, 0x14, 0x25, 0x3e, 0xff, 0x06, 0x07, 0x10, 0xff, 0x06, 0x00, 0x00, 0xff, 0x0a, 0x01, 0x00, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x10, 0x05, 0x06, 0xff, 0x17, 0x09, 0x0d, 0xff, 0x08, 0x08, 0x02, 0xff, 0x0a, 0x08, 0x04, 0xff, 0x10, 0x08, 0x05, 0xff, 0x14, 0x09, 0x03, 0xff, 0x1a, 0x0b, 0x06, 0xff, 0x24, 0x12, 0x0f, 0xff, 0x2d, 0x17, 0x13, 0xff, 0x3e, 0x28, 0x22, 0xff, 0x3c, 0x28, 0x23, 0xff, 0x45, 0x35, 0x2a, 0xff, 0x55, 0x4a, 0x3d, 0xff, 0x57, 0x4d, 0x41, 0xff, 0x59, 0x53, 0x3d, 0xff, 0x4b, 0x51, 0x3c, 0xff, 0x47, 0x31, 0x40, 0xff, 0x7c, 0x1f, 0x53, 0xff, 0x92, 0x1a, 0x6a, 0xff, 0x73, 0x19, 0x75, 0xff, 0x4e, 0x18, 0x7e, 0xff, 0x38, 0x12, 0x86, 0xff, 0x27, 0x11, 0x92, 0xff, 0x19, 0x0f, 0x9f, 0xff, 0x18, 0x0e, 0xa0, 0xff, 0x18, 0x0f, 0xa2, 0xff, 0x15, 0x0e, 0xa6, 0xff, 0x13, 0x0e, 0xa9, 0xff, 0x13, 0x0e, 0xaa, 0xff, 0x12, 0x10, 0xab, 0xff, 0x0e, 0x10, 0xa8, 0xff, 0x0b, 0x0f, 0xa2, 0xff, 0x0f, 0x0f, 0xa4, 0xff, 0x13, 0x10, 0xa2, 0xff, 0x0f, 0x10, 0x9e, 0xff, 0x0e, 0x12, 0x9d, 0xff, 0x14, 0x15, 0x92, 0xff, 0x15, 0x15, 0x81, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x55, 0x3c, 0xb4, 0x7f, 0x4e, 0x37, 0xff, 0x35, 0x08, 0x02, 0xff, 0x78, 0x53, 0x63, 0xff, 0xfc, 0xf3, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xeb, 0xf2, 0xff, 0xd0, 0xb1, 0xbc, 0xff, 0xa6, 0x6e, 0x82, 0xff, 0x71, 0x2a, 0x40, 0xff, 0x56, 0x13, 0x26, 0xff, 0x3f, 0x0c, 0x19, 0xff, 0x4f, 0x2f, 0x2f, 0xff, 0x46, 0x36, 0x35, 0xff, 0x2b, 0x2e, 0x3d, 0xff, 0x8f, 0xa9, 0xbc, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xc9, 0xff, 0xff, 0xff, 0xb3, 0xf9, 0xfc, 0xff, 0xc0, 0xf1, 0xfa, 0xff, 0xc5, 0xef, 0xfe, 0xff, 0xbc, 0xe7, 0xfe, 0xff, 0xae, 0xe2, 0xfc, 0xff, 0xa2, 0xe3, 0xfb, 0xff, 0xa9, 0xe4, 0xfe, 0xff, 0xb4, 0xe2, 0xff, 0xff, 0xb6, 0xe4, 0xfd, 0xff, 0xb7, 0xe8, 0xfd, 0xff, 0xb5, 0xe9, 0xfe, 0xff, 0xb3, 0xe5, 0xfb, 0xff, 0xb4, 0xdf, 0xf6, 0xff, 0xa9, 0xd7, 0xf2, 0xff, 0x97, 0xd3, 0xee, 0xff, 0x82, 0xc9, 0xe8, 0xff, 0x78, 0xbc, 0xec, 0xff, 0x6c, 0xad, 0xec, 0xff, 0x41, 0x7d, 0xc6, 0xff, 0x2a, 0x5d, 0xad, 0xff, 0x1d, 0x4c, 0x9d, 0xff, 0x21, 0x4f, 0x98, 0xff, 0x15, 0x34, 0x79, 0xff, 0x0e, 0x20, 0x63, 0xff, 0x19, 0x2f, 0x6f, 0xff, 0x0b, 0x29, 0x67, 0xff, 0x05, 0x28, 0x6c, 0xff, 0x11, 0x35, 0x82, 0xff, 0x16, 0x40, 0x91, 0xff, 0x17, 0x40, 0x95, 0xff, 0x26, 0x41, 0x93, 0xff, 0x15, 0x1f, 0x64, 0xff, 0x0d, 0x16, 0x4f, 0xff, 0x27, 0x42, 0x7d, 0xff, 0x0c, 0x2b, 0x75, 0xff, 0x00, 0x0d, 0x68, 0xff, 0x39, 0x63, 0xba, 0xff, 0x7d, 0xc2, 0xff, 0xff, 0x83, 0xce, 0xfa, 0xff, 0x9c, 0xd4, 0xfd, 0xff, 0x87, 0xc0, 0xe9, 0xff, 0xa3, 0xea, 0xfa, 0xff, 0xba, 0xe8, 0xf0, 0xff, 0x0f, 0x0e, 0x21, 0xff, 0x00, 0x00, 0x05, 0xff, 0x06, 0x09, 0x22, 0xff, 0x0e, 0x13, 0x28, 0xff, 0x0c, 0x14, 0x29, 0xff, 0x0c, 0x0f, 0x23, 0xff, 0x09, 0x06, 0x1a, 0xff, 0x03, 0x01, 0x0e, 0xff, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x06, 0x00, 0x00, 0xff, 0x17, 0x05, 0x00, 0xff, 0x17, 0x10, 0x07, 0xff, 0x22, 0x15, 0x14, 0xff, 0x2e, 0x19, 0x28, 0xff, 0x2c, 0x1b, 0x33, 0xff, 0x1e, 0x1a, 0x27, 0xff, 0x22, 0x21, 0x23, 0xff, 0x2b, 0x21, 0x24, 0xff, 0x21, 0x12, 0x16, 0xff, 0x24, 0x10, 0x11, 0xff, 0x2a, 0x17, 0x15, 0xff, 0x23, 0x14, 0x0f, 0xff, 0x31, 0x23, 0x19, 0xff, 0x3e, 0x2c, 0x20, 0xff, 0x45, 0x33, 0x26, 0xff, 0x5a, 0x4c, 0x3f, 0xff, 0x5f, 0x54, 0x47, 0xff, 0x58, 0x52, 0x3a, 0xff, 0x4c, 0x51, 0x3f, 0xff, 0x4b, 0x38, 0x49, 0xff, 0x71, 0x20, 0x51, 0xff, 0x86, 0x17, 0x68, 0xff, 0x6b, 0x14, 0x77, 0xff, 0x4c, 0x15, 0x81, 0xff, 0x36, 0x11, 0x88, 0xff, 0x25, 0x13, 0x93, 0xff, 0x18, 0x11, 0x9d, 0xff, 0x18, 0x0e, 0x9c, 0xff, 0x19, 0x0e, 0xa0, 0xff, 0x19, 0x0e, 0xa3, 0xff, 0x16, 0x0d, 0xa2, 0xff, 0x12, 0x0e, 0xa3, 0xff, 0x12, 0x0f, 0xa7, 0xff, 0x11, 0x11, 0xa5, 0xff, 0x0f, 0x11, 0xa1, 0xff, 0x13, 0x11, 0xa0, 0xff, 0x16, 0x11, 0x9d, 0xff, 0x12, 0x11, 0x99, 0xff, 0x13, 0x14, 0x9a, 0xff, 0x19, 0x16, 0x91, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x4e, 0x3a, 0x27, 0x59, 0x1a, 0x19, 0xfa, 0x88, 0x64, 0x73, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xff, 0xff, 0xdf, 0xc6, 0xd6, 0xff, 0xa7, 0x76, 0x8c, 0xff, 0x72, 0x2d, 0x43, 0xff, 0x49, 0x0e, 0x1e, 0xff, 0x38, 0x16, 0x1e, 0xff, 0x34, 0x24, 0x32, 0xff, 0x3e, 0x53, 0x71, 0xff, 0x80, 0xb2, 0xd0, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xc6, 0xfb, 0xff, 0xff, 0xbb, 0xea, 0xfd, 0xff, 0xbe, 0xe6, 0xfc, 0xff, 0xa5, 0xdd, 0xf5, 0xff, 0x98, 0xe3, 0xf8, 0xff, 0xa6, 0xe4, 0xfc, 0xff, 0xb6, 0xe4, 0xff, 0xff, 0xb5, 0xe3, 0xff, 0xff, 0xb2, 0xe1, 0xfb, 0xff, 0xb3, 0xe3, 0xf6, 0xff, 0xad, 0xe4, 0xf4, 0xff, 0x9f, 0xd9, 0xf2, 0xff, 0x93, 0xc5, 0xea, 0xff, 0x83, 0xbf, 0xed, 0xff, 0x76, 0xbb, 0xec, 0xff, 0x68, 0xa8, 0xe2, 0xff, 0x45, 0x7f, 0xc9, 0xff, 0x24, 0x54, 0xa7, 0xff, 0x23, 0x4e, 0x97, 0xff, 0x1f, 0x49, 0x84, 0xff, 0x12, 0x3e, 0x71, 0xff, 0x1e, 0x3e, 0x70, 0xff, 0x10, 0x1f, 0x56, 0xff, 0x03, 0x10, 0x45, 0xff, 0x18, 0x2a, 0x5a, 0xff, 0x13, 0x26, 0x5f, 0xff, 0x14, 0x22, 0x68, 0xff, 0x1a, 0x2c, 0x76, 0xff, 0x14, 0x2d, 0x76, 0xff, 0x14, 0x29, 0x5e, 0xff, 0x11, 0x18, 0x37, 0xff, 0x05, 0x11, 0x29, 0xff, 0x10, 0x30, 0x50, 0xff, 0x19, 0x3c, 0x77, 0xff, 0x00, 0x0f, 0x68, 0xff, 0x20, 0x41, 0x9e, 0xff, 0x84, 0xc9, 0xff, 0xff, 0x90, 0xdd, 0xff, 0xff, 0x9a, 0xd6, 0xfb, 0xff, 0x87, 0xbc, 0xe9, 0xff, 0x92, 0xca, 0xea, 0xff, 0xd6, 0xff, 0xff, 0xff, 0x4e, 0x5a, 0x74, 0xff, 0x00, 0x00, 0x02, 0xff, 0x00, 0x01, 0x07, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xff, 0x06, 0x00, 0x00, 0xff, 0x09, 0x00, 0x00, 0xff, 0x0c, 0x00, 0x00, 0xff, 0x10, 0x01, 0x00, 0xff, 0x11, 0x08, 0x09, 0xff, 0x19, 0x16, 0x20, 0xff, 0x2b, 0x2a, 0x35, 0xff, 0x3a, 0x36, 0x48, 0xff, 0x44, 0x44, 0x5a, 0xff, 0x47, 0x4c, 0x65, 0xff, 0x4d, 0x52, 0x72, 0xff, 0x4a, 0x56, 0x73, 0xff, 0x47, 0x4f, 0x6e, 0xff, 0x3c, 0x3a, 0x5e, 0xff, 0x32, 0x2a, 0x49, 0xff, 0x2c, 0x23, 0x3a, 0xff, 0x1f, 0x19, 0x28, 0xff, 0x2a, 0x21, 0x27, 0xff, 0x3e, 0x2b, 0x27, 0xff, 0x46, 0x2c, 0x24, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x51, 0x48, 0xff, 0x52, 0x54, 0x40, 0xff, 0x50, 0x50, 0x3e, 0xff, 0x55, 0x3a, 0x43, 0xff, 0x6b, 0x22, 0x4f, 0xff, 0x73, 0x17, 0x6b, 0xff, 0x61, 0x11, 0x81, 0xff, 0x4b, 0x0f, 0x8c, 0xff, 0x33, 0x11, 0x8e, 0xff, 0x1d, 0x10, 0x8f, 0xff, 0x11, 0x0c, 0x96, 0xff, 0x18, 0x0e, 0x98, 0xff, 0x19, 0x0e, 0x9c, 0xff, 0x19, 0x0b, 0xa1, 0xff, 0x18, 0x0b, 0xa0, 0xff, 0x14, 0x0e, 0x9e, 0xff, 0x12, 0x0f, 0xa1, 0xff, 0x0e, 0x0f, 0xa1, 0xff, 0x0f, 0x0f, 0x9d, 0xff, 0x17, 0x10, 0x95, 0xff, 0x17, 0x0f, 0x93, 0xff, 0x17, 0x12, 0x92, 0xff, 0x17, 0x15, 0x92, 0xfa, 0x19, 0x13, 0x85, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x94, 0xa5, 0x88, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0xf2, 0xff, 0xfb, 0xfc, 0xf8, 0xff, 0xf8, 0xf9, 0xfc, 0xff, 0xf3, 0xfd, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xed, 0xf6, 0xff, 0xc5, 0x98, 0xb3, 0xff, 0x86, 0x4c, 0x5f, 0xff, 0x4c, 0x12, 0x1c, 0xff, 0x24, 0x00, 0x11, 0xff, 0x1f, 0x0b, 0x38, 0xff, 0x50, 0x6a, 0x8f, 0xff, 0xb0, 0xf5, 0xfa, 0xff, 0xb4, 0xff, 0xff, 0xff, 0xa0, 0xe5, 0xf5, 0xff, 0xa4, 0xe3, 0xf5, 0xff, 0xa1, 0xe2, 0xfc, 0xff, 0xb1, 0xe5, 0xf9, 0xff, 0xbb, 0xe6, 0xf9, 0xff, 0xb6, 0xe1, 0xfd, 0xff, 0xab, 0xd7, 0xf5, 0xff, 0xa3, 0xd2, 0xeb, 0xff, 0x9b, 0xcf, 0xe7, 0xff, 0x94, 0xcb, 0xef, 0xff, 0x84, 0xbe, 0xed, 0xff, 0x72, 0xae, 0xe6, 0xff, 0x53, 0x90, 0xcb, 0xff, 0x33, 0x6d, 0xab, 0xff, 0x23, 0x54, 0x9d, 0xff, 0x26, 0x4f, 0x9d, 0xff, 0x19, 0x3e, 0x84, 0xff, 0x0b, 0x31, 0x69, 0xff, 0x17, 0x43, 0x6f, 0xff, 0x21, 0x42, 0x68, 0xff, 0x1b, 0x2a, 0x52, 0xff, 0x08, 0x12, 0x32, 0xff, 0x07, 0x13, 0x27, 0xff, 0x18, 0x1e, 0x37, 0xff, 0x1b, 0x1e, 0x47, 0xff, 0x14, 0x1c, 0x47, 0xff, 0x11, 0x1f, 0x47, 0xff, 0x10, 0x1d, 0x30, 0xff, 0x0d, 0x14, 0x15, 0xff, 0x0a, 0x11, 0x1f, 0xff, 0x07, 0x20, 0x41, 0xff, 0x0f, 0x2b, 0x62, 0xff, 0x12, 0x23, 0x69, 0xff, 0x00, 0x0f, 0x59, 0xff, 0x2e, 0x61, 0xa3, 0xff, 0x7b, 0xba, 0xf6, 0xff, 0x91, 0xdb, 0xf7, 0xff, 0x80, 0xc2, 0xe2, 0xff, 0x92, 0xbe, 0xe8, 0xff, 0xd9, 0xff, 0xff, 0xff, 0x8f, 0xb8, 0xcd, 0xff, 0x04, 0x14, 0x44, 0xff, 0x1b, 0x22, 0x55, 0xff, 0x04, 0x06, 0x11, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x02, 0x02, 0xff, 0x0a, 0x03, 0x03, 0xff, 0x0d, 0x01, 0x00, 0xff, 0x09, 0x00, 0x00, 0xff, 0x11, 0x0c, 0x0d, 0xff, 0x1f, 0x21, 0x26, 0xff, 0x36, 0x3e, 0x4d, 0xff, 0x50, 0x59, 0x73, 0xff, 0x65, 0x72, 0x8f, 0xff, 0x77, 0x8b, 0xa6, 0xff, 0x7f, 0x99, 0xb6, 0xff, 0x88, 0xa4, 0xc7, 0xff, 0x85, 0xa1, 0xca, 0xff, 0x7d, 0x98, 0xc1, 0xff, 0x72, 0x8b, 0xb2, 0xff, 0x5e, 0x71, 0x9c, 0xff, 0x43, 0x55, 0x7a, 0xff, 0x2b, 0x39, 0x52, 0xff, 0x35, 0x31, 0x42, 0xff, 0x44, 0x2d, 0x39, 0xff, 0x4c, 0x29, 0x30, 0xff, 0x58, 0x3e, 0x39, 0xff, 0x5b, 0x51, 0x44, 0xff, 0x53, 0x54, 0x45, 0xff, 0x53, 0x4c, 0x43, 0xff, 0x5f, 0x3f, 0x47, 0xff, 0x5e, 0x22, 0x4d, 0xff, 0x5f, 0x14, 0x65, 0xff, 0x61, 0x13, 0x83, 0xff, 0x50, 0x12, 0x8a, 0xff, 0x31, 0x13, 0x82, 0xff, 0x24, 0x0f, 0x84, 0xff, 0x1f, 0x06, 0x88, 0xff, 0x1b, 0x09, 0x92, 0xff, 0x13, 0x0e, 0x98, 0xff, 0x0c, 0x0c, 0x93, 0xff, 0x12, 0x10, 0x91, 0xff, 0x14, 0x13, 0x92, 0xff, 0x12, 0x11, 0x92, 0xff, 0x11, 0x0e, 0x99, 0xff, 0x13, 0x0f, 0x9b, 0xff, 0x17, 0x10, 0x92, 0xff, 0x16, 0x0e, 0x8a, 0xff, 0x15, 0x10, 0x89, 0xff, 0x14, 0x10, 0x8b, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xc6, 0xe2, 0x09, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xfe, 0xf5, 0xfb, 0xff, 0xff, 0xf9, 0xfb, 0xff, 0xfe, 0xfb, 0xfa, 0xff, 0xf5, 0xfb, 0xf6, 0xff, 0xf2, 0xfe, 0xf8, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xba, 0xcd, 0xff, 0x75, 0x35, 0x4d, 0xff, 0x2c, 0x00, 0x03, 0xff, 0x00, 0x00, 0x0d, 0xff, 0x26, 0x49, 0x71, 0xff, 0x9e, 0xe2, 0xfa, 0xff, 0xb3, 0xff, 0xff, 0xff, 0xa1, 0xe1, 0xfb, 0xff, 0xa9, 0xdc, 0xf7, 0xff, 0xb3, 0xdd, 0xf3, 0xff, 0xaa, 0xd2, 0xea, 0xff, 0xa8, 0xd0, 0xee, 0xff, 0x9a, 0xc7, 0xeb, 0xff, 0x91, 0xc3, 0xe8, 0xff, 0x82, 0xb7, 0xdd, 0xff, 0x78, 0xae, 0xde, 0xff, 0x77, 0xb2, 0xea, 0xff, 0x5b, 0x95, 0xd2, 0xff, 0x28, 0x5e, 0x9e, 0xff, 0x21, 0x53, 0x96, 0xff, 0x24, 0x52, 0x95, 0xff, 0x14, 0x3e, 0x7e, 0xff, 0x15, 0x39, 0x76, 0xff, 0x17, 0x3a, 0x71, 0xff, 0x0a, 0x30, 0x5e, 0xff, 0x08, 0x23, 0x4f, 0xff, 0x19, 0x26, 0x51, 0xff, 0x21, 0x2b, 0x45, 0xff, 0x0e, 0x19, 0x21, 0xff, 0x00, 0x02, 0x02, 0xff, 0x00, 0x00, 0x01, 0xff, 0x01, 0x00, 0x06, 0xff, 0x04, 0x06, 0x0e, 0xff, 0x03, 0x07, 0x07, 0xff, 0x00, 0x02, 0x00, 0xff, 0x09, 0x09, 0x12, 0xff, 0x0b, 0x11, 0x2a, 0xff, 0x0f, 0x1a, 0x48, 0xff, 0x0a, 0x0f, 0x43, 0xff, 0x09, 0x0e, 0x42, 0xff, 0x33, 0x5f, 0x97, 0xff, 0x57, 0x8e, 0xd5, 0xff, 0x5e, 0xa6, 0xd9, 0xff, 0x5b, 0xa3, 0xcf, 0xff, 0x75, 0xab, 0xd9, 0xff, 0xb9, 0xed, 0xff, 0xff, 0xc6, 0xff, 0xff, 0xff, 0x48, 0x68, 0x92, 0xff, 0x0c, 0x19, 0x64, 0xff, 0x37, 0x42, 0x75, 0xff, 0x0e, 0x15, 0x22, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x01, 0x00, 0xff, 0x0f, 0x02, 0x00, 0xff, 0x0b, 0x0b, 0x0d, 0xff, 0x17, 0x28, 0x36, 0xff, 0x38, 0x4c, 0x65, 0xff, 0x5d, 0x74, 0x8c, 0xff, 0x78, 0x97, 0xa4, 0xff, 0x88, 0xae, 0xb9, 0xff, 0x91, 0xba, 0xc9, 0xff, 0x93, 0xbf, 0xd0, 0xff, 0x92, 0xc3, 0xd4, 0xff, 0x93, 0xc2, 0xd4, 0xff, 0x91, 0xc1, 0xd1, 0xff, 0x87, 0xbc, 0xcc, 0xff, 0x78, 0xae, 0xc8, 0xff, 0x63, 0x9a, 0xb8, 0xff, 0x49, 0x76, 0x92, 0xff, 0x40, 0x51, 0x6b, 0xff, 0x43, 0x37, 0x4f, 0xff, 0x47, 0x29, 0x3b, 0xff, 0x4f, 0x33, 0x38, 0xff, 0x5e, 0x4e, 0x46, 0xff, 0x5c, 0x54, 0x4e, 0xff, 0x5d, 0x53, 0x4d, 0xff, 0x5e, 0x49, 0x43, 0xff, 0x45, 0x1f, 0x28, 0xff, 0x60, 0x30, 0x4b, 0xff, 0x6f, 0x3f, 0x65, 0xff, 0x5b, 0x3d, 0x5c, 0xff, 0x4d, 0x41, 0x55, 0xff, 0x53, 0x45, 0x54, 0xff, 0x4e, 0x30, 0x64, 0xff, 0x2f, 0x11, 0x84, 0xff, 0x12, 0x09, 0x90, 0xff, 0x02, 0x14, 0x82, 0xff, 0x02, 0x1b, 0x7b, 0xff, 0x0e, 0x11, 0x90, 0xff, 0x1d, 0x0d, 0x97, 0xff, 0x19, 0x0f, 0x92, 0xff, 0x0f, 0x11, 0x8c, 0xff, 0x15, 0x10, 0x8c, 0xff, 0x1b, 0x13, 0x89, 0xff, 0x18, 0x13, 0x89, 0xdb, 0x1c, 0x1c, 0x8d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x66, 0x81, 0x41, 0xb1, 0x9e, 0xb5, 0xfe, 0xe8, 0xda, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xf8, 0xfb, 0xfc, 0xff, 0xf6, 0xfe, 0xfd, 0xff, 0xf0, 0xfd, 0xf4, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xae, 0x80, 0x8c, 0xff, 0x2d, 0x04, 0x09, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x25, 0x4b, 0xff, 0x7e, 0xa8, 0xd3, 0xff, 0xb1, 0xf0, 0xff, 0xff, 0xa1, 0xdf, 0xf7, 0xff, 0x93, 0xcd, 0xeb, 0xff, 0x8d, 0xc0, 0xe6, 0xff, 0x8c, 0xbc, 0xe9, 0xff, 0x7f, 0xb1, 0xe5, 0xff, 0x79, 0xb0, 0xe6, 0xff, 0x71, 0xa9, 0xde, 0xff, 0x60, 0x98, 0xd2, 0xff, 0x47, 0x7d, 0xbf, 0xff, 0x31, 0x61, 0xa5, 0xff, 0x29, 0x55, 0x99, 0xff, 0x2b, 0x54, 0x96, 0xff, 0x1b, 0x45, 0x7e, 0xff, 0x13, 0x3c, 0x70, 0xff, 0x1a, 0x3e, 0x70, 0xff, 0x17, 0x37, 0x68, 0xff, 0x16, 0x35, 0x66, 0xff, 0x1c, 0x32, 0x68, 0xff, 0x17, 0x24, 0x5f, 0xff, 0x16, 0x1c, 0x4c, 0xff, 0x16, 0x1b, 0x34, 0xff, 0x0c, 0x0d, 0x10, 0xff, 0x05, 0x00, 0x00, 0xff, 0x0d, 0x01, 0x00, 0xff, 0x0d, 0x01, 0x00, 0xff, 0x09, 0x02, 0x04, 0xff, 0x07, 0x04, 0x06, 0xff, 0x09, 0x03, 0x01, 0xff, 0x07, 0x02, 0x04, 0xff, 0x00, 0x00, 0x0a, 0xff, 0x00, 0x00, 0x14, 0xff, 0x85, 0xa2, 0xcd, 0xff, 0xba, 0xf3, 0xff, 0xff, 0x7a, 0xb7, 0xf1, 0xff, 0x53, 0x92, 0xdb, 0xff, 0x1d, 0x5a, 0xa6, 0xff, 0x58, 0x92, 0xc9, 0xff, 0xb6, 0xf3, 0xff, 0xff, 0xbb, 0xf3, 0xff, 0xff, 0xa1, 0xcc, 0xeb, 0xff, 0x05, 0x21, 0x68, 0xff, 0x21, 0x34, 0x88, 0xff, 0x3e, 0x4c, 0x86, 0xff, 0x18, 0x1d, 0x35, 0xff, 0x00, 0x00, 0x00, 0xff, 0x03, 0x01, 0x02, 0xff, 0x17, 0x23, 0x32, 0xff, 0x37, 0x56, 0x72, 0xff, 0x5c, 0x7a, 0xa2, 0xff, 0x77, 0x95, 0xb7, 0xff, 0x87, 0xad, 0xb3, 0xff, 0x8e, 0xb9, 0xbb, 0xff, 0x92, 0xbd, 0xc6, 0xff, 0x92, 0xc0, 0xc8, 0xff, 0x8e, 0xc0, 0xc8, 0xff, 0x8e, 0xc1, 0xc7, 0xff, 0x8e, 0xc1, 0xc5, 0xff, 0x85, 0xbb, 0xc4, 0xff, 0x73, 0xb5, 0xc5, 0xff, 0x65, 0xaa, 0xc4, 0xff, 0x57, 0x96, 0xb7, 0xff, 0x45, 0x73, 0x98, 0xff, 0x3b, 0x50, 0x74, 0xff, 0x31, 0x31, 0x4d, 0xff, 0x3b, 0x2d, 0x3c, 0xff, 0x5a, 0x46, 0x48, 0xff, 0x5c, 0x4c, 0x4b, 0xff, 0x5a, 0x4f, 0x50, 0xff, 0x54, 0x45, 0x43, 0xff, 0x56, 0x43, 0x3b, 0xff, 0x6e, 0x57, 0x52, 0xff, 0x60, 0x4b, 0x44, 0xff, 0x4c, 0x40, 0x2b, 0xff, 0x55, 0x4f, 0x2e, 0xff, 0x64, 0x54, 0x31, 0xff, 0x69, 0x56, 0x3b, 0xff, 0x55, 0x46, 0x54, 0xff, 0x2f, 0x22, 0x75, 0xff, 0x0a, 0x08, 0x86, 0xff, 0x03, 0x0c, 0x8b, 0xff, 0x11, 0x0f, 0x8e, 0xff, 0x20, 0x0c, 0x95, 0xff, 0x19, 0x0e, 0x8f, 0xff, 0x10, 0x12, 0x85, 0xff, 0x16, 0x11, 0x81, 0xff, 0x17, 0x11, 0x7e, 0xfe, 0x17, 0x13, 0x81, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0e, 0x27, 0x8f, 0x48, 0x28, 0x40, 0xff, 0x75, 0x5a, 0x70, 0xff, 0xa5, 0x95, 0xa7, 0xff, 0xd6, 0xd8, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfa, 0xfb, 0xf8, 0xff, 0xfe, 0xfb, 0xf8, 0xff, 0xf9, 0xf9, 0xf7, 0xff, 0xf7, 0xfd, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0xaf, 0xb9, 0xff, 0x52, 0x1e, 0x29, 0xff, 0x06, 0x00, 0x00, 0xff, 0x18, 0x08, 0x18, 0xff, 0x75, 0x87, 0xa6, 0xff, 0x9d, 0xe0, 0xff, 0xff, 0x7c, 0xc4, 0xf4, 0xff, 0x75, 0xb3, 0xe9, 0xff, 0x69, 0xa6, 0xe8, 0xff, 0x5b, 0x95, 0xd9, 0xff, 0x57, 0x92, 0xd5, 0xff, 0x46, 0x7e, 0xbd, 0xff, 0x32, 0x67, 0xa5, 0xff, 0x27, 0x57, 0x9b, 0xff, 0x2a, 0x51, 0x97, 0xff, 0x26, 0x48, 0x8b, 0xff, 0x1b, 0x3f, 0x7b, 0xff, 0x1b, 0x41, 0x73, 0xff, 0x19, 0x3e, 0x6d, 0xff, 0x1c, 0x3f, 0x71, 0xff, 0x21, 0x41, 0x74, 0xff, 0x1e, 0x3a, 0x6f, 0xff, 0x1a, 0x30, 0x70, 0xff, 0x15, 0x26, 0x6e, 0xff, 0x13, 0x21, 0x5d, 0xff, 0x18, 0x21, 0x46, 0xff, 0x0c, 0x0d, 0x18, 0xff, 0x03, 0x00, 0x00, 0xff, 0x0a, 0x08, 0x00, 0xff, 0x0b, 0x03, 0x00, 0xff, 0x09, 0x01, 0x02, 0xff, 0x04, 0x02, 0x03, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x02, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x61, 0x75, 0x88, 0xff, 0xbb, 0xf9, 0xff, 0xff, 0x7b, 0xc7, 0xfe, 0xff, 0x6e, 0xb5, 0xeb, 0xff, 0x39, 0x6f, 0xc7, 0xff, 0x01, 0x27, 0x9a, 0xff, 0x5b, 0x89, 0xd4, 0xff, 0xb7, 0xef, 0xff, 0xff, 0xae, 0xe0, 0xfd, 0xff, 0xcb, 0xf6, 0xff, 0xff, 0x61, 0x8a, 0xae, 0xff, 0x00, 0x11, 0x66, 0xff, 0x27, 0x3f, 0x9b, 0xff, 0x31, 0x43, 0x83, 0xff, 0x1b, 0x20, 0x3f, 0xff, 0x15, 0x1a, 0x2b, 0xff, 0x2d, 0x42, 0x64, 0xff, 0x55, 0x72, 0x9c, 0xff, 0x79, 0x94, 0xb5, 0xff, 0x8a, 0xa3, 0xbb, 0xff, 0x9a, 0xb1, 0xc6, 0xff, 0xa5, 0xb8, 0xcd, 0xff, 0xac, 0xbe, 0xd3, 0xff, 0xb3, 0xc8, 0xdd, 0xff, 0xb2, 0xc9, 0xdd, 0xff, 0xaa, 0xc7, 0xd9, 0xff, 0xa9, 0xc3, 0xd5, 0xff, 0xa0, 0xba, 0xce, 0xff, 0x88, 0xae, 0xc8, 0xff, 0x76, 0xa5, 0xc3, 0xff, 0x63, 0x9b, 0xc0, 0xff, 0x4e, 0x8c, 0xb7, 0xff, 0x40, 0x77, 0x9f, 0xff, 0x27, 0x4f, 0x6e, 0xff, 0x2a, 0x36, 0x4a, 0xff, 0x46, 0x36, 0x40, 0xff, 0x4b, 0x39, 0x3d, 0xff, 0x5f, 0x53, 0x55, 0xff, 0x5d, 0x52, 0x4f, 0xff, 0x5a, 0x51, 0x4c, 0xff, 0x56, 0x4a, 0x49, 0xff, 0x4a, 0x36, 0x3b, 0xff, 0x4e, 0x37, 0x37, 0xff, 0x4f, 0x40, 0x34, 0xff, 0x4d, 0x3a, 0x33, 0xff, 0x58, 0x48, 0x35, 0xff, 0x5c, 0x58, 0x2d, 0xff, 0x51, 0x4d, 0x42, 0xff, 0x34, 0x1f, 0x67, 0xff, 0x20, 0x05, 0x86, 0xff, 0x16, 0x10, 0x7f, 0xff, 0x0f, 0x17, 0x71, 0xff, 0x10, 0x14, 0x78, 0xff, 0x16, 0x11, 0x80, 0xff, 0x16, 0x12, 0x7b, 0xff, 0x17, 0x11, 0x78, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x24, 0x24, 0x07, 0x3e, 0x22, 0x22, 0xd1, 0x35, 0x0f, 0x1e, 0xff, 0x33, 0x0a, 0x24, 0xff, 0x46, 0x25, 0x44, 0xff, 0x81, 0x66, 0x84, 0xff, 0xcc, 0xc3, 0xd1, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xf6, 0xf6, 0xfc, 0xff, 0xf2, 0xf7, 0xf4, 0xff, 0xfb, 0xfe, 0xf2, 0xff, 0xff, 0xfb, 0xf7, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf0, 0xf1, 0xff, 0x87, 0x58, 0x5b, 0xff, 0x1b, 0x00, 0x00, 0xff, 0x15, 0x05, 0x19, 0xff, 0x3d, 0x62, 0x8c, 0xff, 0x7b, 0xbb, 0xee, 0xff, 0x77, 0xb3, 0xf0, 0xff, 0x55, 0x90, 0xd3, 0xff, 0x3f, 0x79, 0xc3, 0xff, 0x28, 0x60, 0xa9, 0xff, 0x1a, 0x4f, 0x90, 0xff, 0x21, 0x50, 0x8d, 0xff, 0x26, 0x53, 0x93, 0xff, 0x24, 0x46, 0x89, 0xff, 0x1a, 0x36, 0x77, 0xff, 0x1e, 0x3e, 0x76, 0xff, 0x25, 0x47, 0x78, 0xff, 0x20, 0x41, 0x71, 0xff, 0x20, 0x41, 0x73, 0xff, 0x28, 0x46, 0x7b, 0xff, 0x28, 0x41, 0x7f, 0xff, 0x20, 0x3a, 0x7f, 0xff, 0x16, 0x33, 0x78, 0xff, 0x10, 0x28, 0x5f, 0xff, 0x1e, 0x2c, 0x52, 0xff, 0x14, 0x19, 0x24, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x03, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x03, 0x03, 0x01, 0xff, 0x06, 0x06, 0x01, 0xff, 0x08, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1f, 0x28, 0x35, 0xff, 0xb9, 0xf5, 0xfd, 0xff, 0x92, 0xe8, 0xff, 0xff, 0x71, 0xc1, 0xf8, 0xff, 0x3b, 0x7b, 0xbc, 0xff, 0x16, 0x37, 0x9c, 0xff, 0x00, 0x04, 0x8c, 0xff, 0x5d, 0x8a, 0xdb, 0xff, 0xb5, 0xee, 0xff, 0xff, 0xaa, 0xdc, 0xfd, 0xff, 0xaa, 0xd8, 0xfa, 0xff, 0xbe, 0xeb, 0xf1, 0xff, 0x22, 0x42, 0x83, 0xff, 0x00, 0x16, 0x80, 0xff, 0x1b, 0x35, 0x8d, 0xff, 0x3f, 0x5b, 0x91, 0xff, 0x5c, 0x77, 0x95, 0xff, 0x62, 0x7a, 0x9e, 0xff, 0x7e, 0x8e, 0xb4, 0xff, 0x96, 0xa9, 0xc2, 0xff, 0xa8, 0xb6, 0xc7, 0xff, 0xc2, 0xc3, 0xd6, 0xff, 0xd2, 0xd0, 0xe6, 0xff, 0xd9, 0xda, 0xef, 0xff, 0xe2, 0xe3, 0xf7, 0xff, 0xe2, 0xe4, 0xf6, 0xff, 0xdd, 0xe2, 0xf5, 0xff, 0xd8, 0xdd, 0xf0, 0xff, 0xcd, 0xd5, 0xe6, 0xff, 0xb9, 0xc8, 0xde, 0xff, 0x9e, 0xb5, 0xd0, 0xff, 0x7c, 0xa7, 0xc7, 0xff, 0x5b, 0x9c, 0xc2, 0xff, 0x46, 0x90, 0xb8, 0xff, 0x35, 0x71, 0x95, 0xff, 0x2a, 0x4c, 0x65, 0xff, 0x40, 0x44, 0x58, 0xff, 0x54, 0x45, 0x4c, 0xff, 0x5a, 0x4d, 0x48, 0xff, 0x51, 0x4c, 0x40, 0xff, 0x40, 0x3f, 0x2e, 0xff, 0x41, 0x38, 0x2c, 0xff, 0x42, 0x33, 0x30, 0xff, 0x3e, 0x2e, 0x2b, 0xff, 0x42, 0x32, 0x29, 0xff, 0x41, 0x35, 0x28, 0xff, 0x45, 0x3c, 0x31, 0xff, 0x4f, 0x46, 0x30, 0xff, 0x5c, 0x52, 0x2d, 0xff, 0x58, 0x4a, 0x3b, 0xff, 0x43, 0x2c, 0x56, 0xff, 0x21, 0x11, 0x6e, 0xff, 0x0e, 0x13, 0x6f, 0xff, 0x0e, 0x13, 0x73, 0xff, 0x14, 0x12, 0x79, 0xff, 0x17, 0x0f, 0x73, 0xd1, 0x1f, 0x1f, 0x7f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x2a, 0x18, 0x2a, 0x50, 0x33, 0x30, 0xf3, 0x4f, 0x2e, 0x34, 0xff, 0x42, 0x1c, 0x2b, 0xff, 0x3a, 0x14, 0x24, 0xff, 0x48, 0x1b, 0x36, 0xff, 0x74, 0x4c, 0x70, 0xff, 0xc0, 0xb3, 0xcd, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf7, 0xff, 0xef, 0xfb, 0xf4, 0xff, 0xf5, 0xf4, 0xfc, 0xff, 0xf3, 0xf7, 0xfb, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x8f, 0x9b, 0xff, 0x1c, 0x00, 0x0c, 0xff, 0x07, 0x00, 0x00, 0xff, 0x31, 0x49, 0x5c, 0xff, 0x61, 0x94, 0xbd, 0xff, 0x47, 0x78, 0xb3, 0xff, 0x1a, 0x4e, 0x90, 0xff, 0x16, 0x4b, 0x8e, 0xff, 0x20, 0x51, 0x8e, 0xff, 0x23, 0x4f, 0x89, 0xff, 0x1d, 0x48, 0x82, 0xff, 0x20, 0x41, 0x7e, 0xff, 0x25, 0x40, 0x7e, 0xff, 0x26, 0x45, 0x7c, 0xff, 0x29, 0x49, 0x7b, 0xff, 0x28, 0x48, 0x79, 0xff, 0x26, 0x46, 0x79, 0xff, 0x29, 0x47, 0x80, 0xff, 0x22, 0x3c, 0x7d, 0xff, 0x1a, 0x38, 0x7c, 0xff, 0x13, 0x37, 0x79, 0xff, 0x17, 0x32, 0x71, 0xff, 0x1b, 0x27, 0x5b, 0xff, 0x0e, 0x11, 0x2e, 0xff, 0x02, 0x03, 0x0b, 0xff, 0x0c, 0x0f, 0x10, 0xff, 0x09, 0x0c, 0x16, 0xff, 0x0a, 0x10, 0x1c, 0xff, 0x0d, 0x16, 0x20, 0xff, 0x0b, 0x0f, 0x20, 0xff, 0x00, 0x00, 0x03, 0xff, 0x3c, 0x4a, 0x6b, 0xff, 0xaa, 0xfe, 0xff, 0xff, 0x7e, 0xda, 0xff, 0xff, 0x4f, 0x8c, 0xde, 0xff, 0x29, 0x4b, 0x9b, 0xff, 0x0a, 0x0e, 0x63, 0xff, 0x00, 0x00, 0x79, 0xff, 0x5c, 0x8d, 0xdf, 0xff, 0xa9, 0xe7, 0xff, 0xff, 0xa2, 0xd9, 0xfa, 0xff, 0x8e, 0xc4, 0xe4, 0xff, 0xcb, 0xff, 0xff, 0xff, 0x74, 0x9b, 0xc6, 0xff, 0x00, 0x08, 0x62, 0xff, 0x45, 0x63, 0xb0, 0xff, 0x59, 0x8f, 0xce, 0xff, 0x74, 0xab, 0xda, 0xff, 0x99, 0xb9, 0xda, 0xff, 0xa4, 0xae, 0xc6, 0xff, 0xad, 0xb8, 0xc8, 0xff, 0xc7, 0xd4, 0xda, 0xff, 0xdf, 0xe7, 0xe9, 0xff, 0xeb, 0xec, 0xec, 0xff, 0xf0, 0xf0, 0xee, 0xff, 0xf4, 0xf5, 0xf2, 0xff, 0xf7, 0xf7, 0xf2, 0xff, 0xf3, 0xf5, 0xf2, 0xff, 0xee, 0xf1, 0xf0, 0xff, 0xe8, 0xee, 0xef, 0xff, 0xdc, 0xe6, 0xee, 0xff, 0xc5, 0xd2, 0xe5, 0xff, 0xa3, 0xbf, 0xda, 0xff, 0x76, 0xa9, 0xcb, 0xff, 0x56, 0x99, 0xbd, 0xff, 0x4b, 0x8e, 0xb3, 0xff, 0x3e, 0x74, 0x94, 0xff, 0x40, 0x59, 0x79, 0xff, 0x43, 0x40, 0x51, 0xff, 0x43, 0x36, 0x36, 0xff, 0x41, 0x37, 0x32, 0xff, 0x36, 0x34, 0x25, 0xff, 0x35, 0x30, 0x24, 0xff, 0x35, 0x2d, 0x26, 0xff, 0x31, 0x29, 0x1f, 0xff, 0x36, 0x2c, 0x1e, 0xff, 0x3b, 0x35, 0x21, 0xff, 0x41, 0x3e, 0x2e, 0xff, 0x42, 0x37, 0x2e, 0xff, 0x4e, 0x3c, 0x2b, 0xff, 0x5b, 0x4c, 0x2b, 0xff, 0x4a, 0x44, 0x1e, 0xff, 0x2a, 0x26, 0x3b, 0xff, 0x1e, 0x11, 0x73, 0xff, 0x1c, 0x0d, 0x7b, 0xff, 0x16, 0x12, 0x72, 0xf4, 0x1e, 0x12, 0x73, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x2d, 0x24, 0x55, 0x39, 0x2f, 0x22, 0xfe, 0x3f, 0x39, 0x29, 0xff, 0x4b, 0x3a, 0x32, 0xff, 0x3f, 0x25, 0x29, 0xff, 0x20, 0x0a, 0x1e, 0xff, 0x19, 0x0b, 0x2c, 0xff, 0x67, 0x5f, 0x7d, 0xff, 0xe0, 0xd9, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xef, 0xfc, 0xf8, 0xff, 0xf4, 0xfa, 0xf9, 0xff, 0xf5, 0xf8, 0xfa, 0xff, 0xf9, 0xfb, 0xfa, 0xff, 0xfb, 0xfc, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xa5, 0xac, 0xff, 0x26, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0c, 0x24, 0x3f, 0xff, 0x37, 0x54, 0x79, 0xff, 0x27, 0x4c, 0x80, 0xff, 0x20, 0x4e, 0x87, 0xff, 0x21, 0x4f, 0x89, 0xff, 0x19, 0x46, 0x80, 0xff, 0x22, 0x4c, 0x84, 0xff, 0x2a, 0x4b, 0x83, 0xff, 0x31, 0x4c, 0x85, 0xff, 0x2e, 0x4a, 0x82, 0xff, 0x2f, 0x4c, 0x7f, 0xff, 0x34, 0x51, 0x84, 0xff, 0x2a, 0x47, 0x7e, 0xff, 0x24, 0x40, 0x7e, 0xff, 0x26, 0x3f, 0x83, 0xff, 0x1e, 0x3b, 0x81, 0xff, 0x1d, 0x3e, 0x84, 0xff, 0x1f, 0x3c, 0x82, 0xff, 0x1c, 0x2a, 0x69, 0xff, 0x0d, 0x10, 0x42, 0xff, 0x0e, 0x12, 0x32, 0xff, 0x18, 0x1e, 0x32, 0xff, 0x19, 0x1c, 0x39, 0xff, 0x15, 0x1d, 0x3f, 0xff, 0x0d, 0x21, 0x42, 0xff, 0x0a, 0x1b, 0x3b, 0xff, 0x04, 0x00, 0x26, 0xff, 0x17, 0x21, 0x57, 0xff, 0x66, 0xb1, 0xef, 0xff, 0x3f, 0x8f, 0xdf, 0xff, 0x32, 0x5a, 0xc0, 0xff, 0x23, 0x2c, 0x7a, 0xff, 0x00, 0x00, 0x34, 0xff, 0x09, 0x19, 0x7d, 0xff, 0x5a, 0x8f, 0xdd, 0xff, 0x95, 0xd9, 0xfe, 0xff, 0x9b, 0xdb, 0xfa, 0xff, 0x85, 0xbf, 0xdb, 0xff, 0xa7, 0xe1, 0xee, 0xff, 0xaa, 0xd7, 0xf2, 0xff, 0x19, 0x1e, 0x5f, 0xff, 0x3d, 0x5b, 0x9c, 0xff, 0x5f, 0x98, 0xd6, 0xff, 0x7a, 0xb4, 0xe5, 0xff, 0x9c, 0xbf, 0xd9, 0xff, 0xb6, 0xbf, 0xcf, 0xff, 0xcc, 0xd2, 0xd9, 0xff, 0xde, 0xe8, 0xe6, 0xff, 0xe6, 0xf4, 0xed, 0xff, 0xec, 0xf8, 0xf2, 0xff, 0xef, 0xf8, 0xf4, 0xff, 0xf0, 0xfa, 0xf5, 0xff, 0xf2, 0xfc, 0xf4, 0xff, 0xef, 0xfb, 0xf4, 0xff, 0xee, 0xf9, 0xf8, 0xff, 0xea, 0xf4, 0xf8, 0xff, 0xe0, 0xf0, 0xf6, 0xff, 0xd7, 0xe6, 0xf0, 0xff, 0xc5, 0xd5, 0xe8, 0xff, 0x9a, 0xba, 0xd6, 0xff, 0x72, 0xa6, 0xc6, 0xff, 0x61, 0x9f, 0xc1, 0xff, 0x51, 0x8a, 0xad, 0xff, 0x3b, 0x5c, 0x84, 0xff, 0x36, 0x37, 0x53, 0xff, 0x31, 0x28, 0x2f, 0xff, 0x2a, 0x26, 0x23, 0xff, 0x2c, 0x27, 0x1e, 0xff, 0x2b, 0x26, 0x1f, 0xff, 0x2f, 0x27, 0x28, 0xff, 0x37, 0x2b, 0x32, 0xff, 0x3c, 0x2f, 0x33, 0xff, 0x3c, 0x33, 0x33, 0xff, 0x39, 0x32, 0x32, 0xff, 0x3d, 0x2d, 0x31, 0xff, 0x3e, 0x2b, 0x2b, 0xff, 0x47, 0x37, 0x21, 0xff, 0x48, 0x42, 0x16, 0xff, 0x38, 0x3b, 0x1f, 0xff, 0x2a, 0x24, 0x35, 0xff, 0x24, 0x13, 0x5d, 0xff, 0x1a, 0x0e, 0x79, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x2b, 0x20, 0x8d, 0x3b, 0x42, 0x29, 0xff, 0x32, 0x35, 0x2b, 0xff, 0x40, 0x36, 0x36, 0xff, 0x3f, 0x3a, 0x2f, 0xff, 0x2f, 0x2e, 0x23, 0xff, 0x23, 0x0e, 0x15, 0xff, 0x3c, 0x18, 0x3a, 0xff, 0xa5, 0x8c, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xfd, 0xfa, 0xff, 0xf7, 0xf8, 0xfb, 0xff, 0xf6, 0xf8, 0xf8, 0xff, 0xf9, 0xfe, 0xfb, 0xff, 0xf3, 0xf9, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0x94, 0x9b, 0xff, 0x08, 0x00, 0x00, 0xff, 0x09, 0x00, 0x01, 0xff, 0x25, 0x28, 0x38, 0xff, 0x3a, 0x4f, 0x7a, 0xff, 0x25, 0x4c, 0x87, 0xff, 0x13, 0x42, 0x80, 0xff, 0x1b, 0x4b, 0x89, 0xff, 0x27, 0x54, 0x8f, 0xff, 0x2d, 0x53, 0x8c, 0xff, 0x38, 0x54, 0x8c, 0xff, 0x37, 0x4f, 0x86, 0xff, 0x33, 0x4d, 0x80, 0xff, 0x35, 0x4f, 0x82, 0xff, 0x2d, 0x46, 0x81, 0xff, 0x29, 0x3d, 0x81, 0xff, 0x2f, 0x41, 0x89, 0xff, 0x29, 0x40, 0x89, 0xff, 0x26, 0x43, 0x87, 0xff, 0x2a, 0x43, 0x85, 0xff, 0x23, 0x31, 0x71, 0xff, 0x0e, 0x19, 0x4e, 0xff, 0x12, 0x20, 0x4b, 0xff, 0x16, 0x22, 0x4b, 0xff, 0x1e, 0x21, 0x50, 0xff, 0x19, 0x22, 0x52, 0xff, 0x0e, 0x23, 0x4e, 0xff, 0x0f, 0x20, 0x41, 0xff, 0x19, 0x21, 0x3f, 0xff, 0x06, 0x08, 0x38, 0xff, 0x0c, 0x2c, 0x6f, 0xff, 0x3e, 0x67, 0xb3, 0xff, 0x43, 0x4f, 0x93, 0xff, 0x00, 0x00, 0x2d, 0xff, 0x00, 0x00, 0x2f, 0xff, 0x13, 0x28, 0x73, 0xff, 0x67, 0x9f, 0xe6, 0xff, 0x92, 0xd9, 0xff, 0xff, 0x8d, 0xd1, 0xf6, 0xff, 0x82, 0xb7, 0xdd, 0xff, 0x8d, 0xc7, 0xe4, 0xff, 0xbc, 0xfa, 0xff, 0xff, 0x33, 0x44, 0x78, 0xff, 0x00, 0x0c, 0x53, 0xff, 0x50, 0x6f, 0xa6, 0xff, 0x82, 0xa0, 0xc0, 0xff, 0x9e, 0xb7, 0xc4, 0xff, 0xbc, 0xc8, 0xd6, 0xff, 0xda, 0xde, 0xe9, 0xff, 0xeb, 0xef, 0xef, 0xff, 0xee, 0xf5, 0xf1, 0xff, 0xf2, 0xf7, 0xf8, 0xff, 0xf4, 0xf9, 0xfa, 0xff, 0xf6, 0xfc, 0xfb, 0xff, 0xf6, 0xfc, 0xfa, 0xff, 0xf3, 0xfc, 0xf8, 0xff, 0xf5, 0xfb, 0xfb, 0xff, 0xf0, 0xf6, 0xf9, 0xff, 0xe9, 0xf6, 0xf1, 0xff, 0xdd, 0xf1, 0xee, 0xff, 0xd0, 0xe1, 0xed, 0xff, 0xb6, 0xca, 0xe2, 0xff, 0x8a, 0xb0, 0xce, 0xff, 0x68, 0xa3, 0xbc, 0xff, 0x52, 0x97, 0xaf, 0xff, 0x37, 0x6e, 0x90, 0xff, 0x2a, 0x42, 0x5a, 0xff, 0x1e, 0x29, 0x2a, 0xff, 0x1d, 0x23, 0x1e, 0xff, 0x28, 0x24, 0x19, 0xff, 0x30, 0x23, 0x1c, 0xff, 0x37, 0x2a, 0x2c, 0xff, 0x3d, 0x2f, 0x36, 0xff, 0x3e, 0x2f, 0x33, 0xff, 0x43, 0x37, 0x3a, 0xff, 0x40, 0x34, 0x36, 0xff, 0x43, 0x36, 0x34, 0xff, 0x43, 0x39, 0x30, 0xff, 0x3a, 0x31, 0x26, 0xff, 0x46, 0x38, 0x2f, 0xff, 0x41, 0x3b, 0x29, 0xff, 0x2e, 0x2b, 0x13, 0xff, 0x1b, 0x15, 0x29, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x03, 0x2e, 0x05, 0x0b, 0xb1, 0x42, 0x2f, 0x2b, 0xff, 0x47, 0x3c, 0x32, 0xff, 0x3d, 0x38, 0x2f, 0xff, 0x44, 0x2e, 0x2c, 0xff, 0x2e, 0x16, 0x11, 0xff, 0x1e, 0x16, 0x15, 0xff, 0x1a, 0x0d, 0x17, 0xff, 0x77, 0x5f, 0x83, 0xff, 0xf9, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfd, 0xfc, 0xff, 0xf1, 0xf9, 0xf7, 0xff, 0xeb, 0xf8, 0xf2, 0xff, 0xf7, 0xfc, 0xf7, 0xff, 0xfc, 0xf5, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x88, 0x71, 0x70, 0xff, 0x00, 0x00, 0x00, 0xff, 0x11, 0x07, 0x09, 0xff, 0x1e, 0x28, 0x3f, 0xff, 0x2f, 0x4c, 0x7c, 0xff, 0x17, 0x43, 0x84, 0xff, 0x1e, 0x4f, 0x90, 0xff, 0x2c, 0x53, 0x8c, 0xff, 0x30, 0x57, 0x8b, 0xff, 0x34, 0x5a, 0x8c, 0xff, 0x35, 0x57, 0x86, 0xff, 0x32, 0x52, 0x81, 0xff, 0x33, 0x50, 0x82, 0xff, 0x31, 0x4e, 0x84, 0xff, 0x2d, 0x4a, 0x86, 0xff, 0x2b, 0x44, 0x85, 0xff, 0x25, 0x41, 0x85, 0xff, 0x20, 0x3f, 0x84, 0xff, 0x2c, 0x45, 0x88, 0xff, 0x17, 0x2c, 0x6c, 0xff, 0x0b, 0x1d, 0x56, 0xff, 0x1e, 0x30, 0x63, 0xff, 0x19, 0x2b, 0x61, 0xff, 0x1a, 0x28, 0x63, 0xff, 0x15, 0x25, 0x5f, 0xff, 0x13, 0x26, 0x5b, 0xff, 0x15, 0x1e, 0x4a, 0xff, 0x19, 0x21, 0x41, 0xff, 0x12, 0x1a, 0x3f, 0xff, 0x00, 0x0a, 0x3f, 0xff, 0x1e, 0x2e, 0x69, 0xff, 0x14, 0x19, 0x46, 0xff, 0x06, 0x0b, 0x24, 0xff, 0x11, 0x13, 0x3b, 0xff, 0x00, 0x05, 0x48, 0xff, 0x3d, 0x72, 0xb3, 0xff, 0x8d, 0xce, 0xff, 0xff, 0x8b, 0xcf, 0xf6, 0xff, 0x87, 0xbe, 0xe3, 0xff, 0x79, 0xb4, 0xde, 0xff, 0xb1, 0xf2, 0xff, 0xff, 0x6b, 0x8f, 0xc5, 0xff, 0x00, 0x00, 0x42, 0xff, 0x48, 0x55, 0x8a, 0xff, 0x8c, 0x9c, 0xae, 0xff, 0xab, 0xba, 0xc1, 0xff, 0xc7, 0xd0, 0xde, 0xff, 0xe3, 0xe6, 0xef, 0xff, 0xf1, 0xf4, 0xef, 0xff, 0xf2, 0xf8, 0xf5, 0xff, 0xf6, 0xf9, 0xfa, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xf8, 0xfb, 0xf9, 0xff, 0xf6, 0xf9, 0xf3, 0xff, 0xe8, 0xf6, 0xf4, 0xff, 0xd3, 0xe9, 0xf3, 0xff, 0xc3, 0xd5, 0xeb, 0xff, 0x9d, 0xba, 0xd7, 0xff, 0x69, 0xa7, 0xbe, 0xff, 0x49, 0x97, 0xae, 0xff, 0x2e, 0x6b, 0x90, 0xff, 0x2a, 0x47, 0x61, 0xff, 0x23, 0x30, 0x33, 0xff, 0x1d, 0x22, 0x1f, 0xff, 0x2e, 0x28, 0x1e, 0xff, 0x34, 0x27, 0x20, 0xff, 0x32, 0x27, 0x20, 0xff, 0x37, 0x2c, 0x28, 0xff, 0x39, 0x29, 0x2a, 0xff, 0x3b, 0x2b, 0x29, 0xff, 0x3e, 0x2e, 0x29, 0xff, 0x41, 0x34, 0x2b, 0xff, 0x3a, 0x31, 0x25, 0xff, 0x3f, 0x36, 0x2d, 0xff, 0x41, 0x37, 0x32, 0xff, 0x43, 0x39, 0x2d, 0xff, 0x33, 0x2c, 0x19, 0xb1, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x4c, 0x66, 0x0a, 0x43, 0x00, 0x0a, 0xc8, 0x31, 0x08, 0x06, 0xff, 0x28, 0x26, 0x1e, 0xff, 0x23, 0x20, 0x18, 0xff, 0x35, 0x1f, 0x20, 0xff, 0x41, 0x30, 0x2c, 0xff, 0x30, 0x28, 0x1d, 0xff, 0x05, 0x00, 0x0b, 0xff, 0x4e, 0x37, 0x61, 0xff, 0xe3, 0xd7, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf8, 0xfc, 0xff, 0xf0, 0xf3, 0xfe, 0xff, 0xec, 0xf1, 0xf0, 0xff, 0xf4, 0xfa, 0xea, 0xff, 0xf4, 0xf1, 0xeb, 0xff, 0xec, 0xe3, 0xe3, 0xff, 0x6f, 0x5c, 0x5f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x11, 0x07, 0x00, 0xff, 0x29, 0x34, 0x48, 0xff, 0x33, 0x59, 0x8f, 0xff, 0x25, 0x55, 0x91, 0xff, 0x26, 0x50, 0x84, 0xff, 0x33, 0x5a, 0x89, 0xff, 0x31, 0x5b, 0x86, 0xff, 0x28, 0x56, 0x80, 0xff, 0x2e, 0x59, 0x85, 0xff, 0x2e, 0x54, 0x82, 0xff, 0x2b, 0x4e, 0x7e, 0xff, 0x2e, 0x4e, 0x85, 0xff, 0x30, 0x4d, 0x8a, 0xff, 0x29, 0x45, 0x8a, 0xff, 0x25, 0x41, 0x8c, 0xff, 0x28, 0x41, 0x8b, 0xff, 0x14, 0x2e, 0x73, 0xff, 0x16, 0x2d, 0x6f, 0xff, 0x19, 0x2f, 0x70, 0xff, 0x16, 0x2e, 0x6d, 0xff, 0x13, 0x28, 0x6b, 0xff, 0x11, 0x22, 0x64, 0xff, 0x19, 0x26, 0x64, 0xff, 0x1b, 0x1e, 0x52, 0xff, 0x1e, 0x20, 0x46, 0xff, 0x1a, 0x23, 0x46, 0xff, 0x0e, 0x1d, 0x48, 0xff, 0x03, 0x12, 0x3e, 0xff, 0x09, 0x10, 0x33, 0xff, 0x13, 0x19, 0x2b, 0xff, 0x0c, 0x0c, 0x2b, 0xff, 0x00, 0x00, 0x3b, 0xff, 0x5c, 0x92, 0xca, 0xff, 0x9b, 0xdb, 0xff, 0xff, 0x8e, 0xd0, 0xf4, 0xff, 0x90, 0xc6, 0xeb, 0xff, 0x69, 0xa7, 0xd5, 0xff, 0x8b, 0xd1, 0xf9, 0xff, 0x9a, 0xd4, 0xff, 0xff, 0x2a, 0x48, 0x83, 0xff, 0x35, 0x45, 0x77, 0xff, 0x90, 0x9c, 0xab, 0xff, 0xb1, 0xb9, 0xba, 0xff, 0xd3, 0xd9, 0xe0, 0xff, 0xe7, 0xec, 0xef, 0xff, 0xf1, 0xf9, 0xec, 0xff, 0xf4, 0xfd, 0xf3, 0xff, 0xf7, 0xfd, 0xfd, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xf9, 0xfe, 0xfe, 0xff, 0xf7, 0xfd, 0xfb, 0xff, 0xf7, 0xfa, 0xfa, 0xff, 0xef, 0xf8, 0xf9, 0xff, 0xdb, 0xf1, 0xf4, 0xff, 0xcb, 0xdd, 0xec, 0xff, 0xa7, 0xc4, 0xd9, 0xff, 0x6f, 0xa9, 0xc4, 0xff, 0x4a, 0x92, 0xb1, 0xff, 0x33, 0x68, 0x95, 0xff, 0x2e, 0x41, 0x62, 0xff, 0x27, 0x2d, 0x34, 0xff, 0x1b, 0x1c, 0x1a, 0xff, 0x23, 0x19, 0x11, 0xff, 0x31, 0x25, 0x1d, 0xff, 0x34, 0x29, 0x23, 0xff, 0x3a, 0x2e, 0x2b, 0xff, 0x41, 0x34, 0x33, 0xff, 0x43, 0x32, 0x30, 0xff, 0x44, 0x32, 0x2c, 0xff, 0x45, 0x35, 0x2e, 0xff, 0x3f, 0x31, 0x2b, 0xff, 0x39, 0x2e, 0x26, 0xff, 0x3c, 0x35, 0x2b, 0xff, 0x41, 0x3e, 0x2f, 0xc8, 0x33, 0x19, 0x19, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x9d, 0xb6, 0x15, 0x3e, 0x0f, 0x1d, 0xd7, 0x0d, 0x00, 0x00, 0xff, 0x24, 0x23, 0x13, 0xff, 0x31, 0x24, 0x1b, 0xff, 0x39, 0x17, 0x22, 0xff, 0x2e, 0x1a, 0x22, 0xff, 0x23, 0x22, 0x1a, 0xff, 0x10, 0x03, 0x0a, 0xff, 0x35, 0x1d, 0x39, 0xff, 0xc8, 0xbc, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf9, 0xf6, 0xff, 0xe8, 0xf1, 0xe9, 0xff, 0xdf, 0xea, 0xdf, 0xff, 0xe7, 0xf0, 0xe4, 0xff, 0xd6, 0xd5, 0xd2, 0xff, 0xda, 0xcd, 0xd0, 0xff, 0x78, 0x61, 0x5a, 0xff, 0x04, 0x00, 0x00, 0xff, 0x15, 0x0f, 0x10, 0xff, 0x37, 0x4b, 0x64, 0xff, 0x3e, 0x60, 0x8d, 0xff, 0x28, 0x56, 0x8a, 0xff, 0x2e, 0x5a, 0x8c, 0xff, 0x3a, 0x5d, 0x8a, 0xff, 0x37, 0x59, 0x89, 0xff, 0x3b, 0x5a, 0x8c, 0xff, 0x39, 0x55, 0x88, 0xff, 0x35, 0x51, 0x85, 0xff, 0x35, 0x50, 0x88, 0xff, 0x3a, 0x50, 0x8e, 0xff, 0x34, 0x4c, 0x8e, 0xff, 0x30, 0x4b, 0x90, 0xff, 0x26, 0x3f, 0x83, 0xff, 0x15, 0x2b, 0x6d, 0xff, 0x20, 0x34, 0x73, 0xff, 0x18, 0x2d, 0x68, 0xff, 0x19, 0x30, 0x66, 0xff, 0x1d, 0x2e, 0x66, 0xff, 0x1b, 0x27, 0x5d, 0xff, 0x20, 0x28, 0x59, 0xff, 0x21, 0x23, 0x4a, 0xff, 0x20, 0x22, 0x40, 0xff, 0x1d, 0x22, 0x3c, 0xff, 0x19, 0x23, 0x3e, 0xff, 0x15, 0x22, 0x3a, 0xff, 0x18, 0x1c, 0x2b, 0xff, 0x19, 0x1a, 0x1d, 0xff, 0x07, 0x01, 0x15, 0xff, 0x0c, 0x18, 0x47, 0xff, 0x7f, 0xbf, 0xee, 0xff, 0x95, 0xd7, 0xff, 0xff, 0x94, 0xcf, 0xf5, 0xff, 0x88, 0xb7, 0xe2, 0xff, 0x62, 0x9f, 0xd4, 0xff, 0x80, 0xcf, 0xf8, 0xff, 0x8d, 0xd5, 0xfc, 0xff, 0x6a, 0x99, 0xcd, 0xff, 0x2e, 0x43, 0x74, 0xff, 0x88, 0x8c, 0x9d, 0xff, 0xc2, 0xbf, 0xbf, 0xff, 0xdd, 0xde, 0xdf, 0xff, 0xea, 0xf0, 0xef, 0xff, 0xf1, 0xfc, 0xed, 0xff, 0xf6, 0xfe, 0xf4, 0xff, 0xf8, 0xfc, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0xf8, 0xfd, 0xfc, 0xff, 0xf8, 0xfd, 0xfc, 0xff, 0xf8, 0xfd, 0xfc, 0xff, 0xf7, 0xfc, 0xfb, 0xff, 0xf7, 0xfb, 0xfa, 0xff, 0xf1, 0xf9, 0xf7, 0xff, 0xe1, 0xf3, 0xf1, 0xff, 0xd1, 0xe2, 0xe8, 0xff, 0xaa, 0xc7, 0xd6, 0xff, 0x71, 0xa6, 0xc3, 0xff, 0x4a, 0x88, 0xaf, 0xff, 0x34, 0x63, 0x91, 0xff, 0x30, 0x3d, 0x61, 0xff, 0x1f, 0x1f, 0x28, 0xff, 0x16, 0x13, 0x11, 0xff, 0x27, 0x1b, 0x13, 0xff, 0x36, 0x29, 0x20, 0xff, 0x3a, 0x2f, 0x2a, 0xff, 0x3b, 0x2f, 0x2c, 0xff, 0x3e, 0x31, 0x2b, 0xff, 0x44, 0x34, 0x31, 0xff, 0x3e, 0x2d, 0x29, 0xff, 0x3a, 0x2b, 0x24, 0xff, 0x42, 0x36, 0x2e, 0xff, 0x3c, 0x31, 0x29, 0xff, 0x42, 0x3b, 0x2f, 0xd8, 0x3c, 0x3c, 0x30, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xe3, 0xe3, 0x1c, 0x6f, 0x35, 0x47, 0xdc, 0x1c, 0x00, 0x00, 0xff, 0x14, 0x0b, 0x01, 0xff, 0x1b, 0x1a, 0x0e, 0xff, 0x32, 0x27, 0x29, 0xff, 0x32, 0x25, 0x1a, 0xff, 0x20, 0x15, 0x0a, 0xff, 0x0b, 0x00, 0x08, 0xff, 0x16, 0x06, 0x1a, 0xff, 0xc1, 0xbc, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xe8, 0xed, 0xff, 0xe2, 0xe6, 0xec, 0xff, 0xdc, 0xea, 0xde, 0xff, 0xef, 0xf1, 0xe9, 0xff, 0xe5, 0xdc, 0xdc, 0xff, 0xec, 0xe0, 0xde, 0xff, 0x64, 0x53, 0x52, 0xff, 0x00, 0x00, 0x00, 0xff, 0x14, 0x0c, 0x0e, 0xff, 0x3f, 0x4c, 0x68, 0xff, 0x34, 0x61, 0x95, 0xff, 0x27, 0x54, 0x8e, 0xff, 0x37, 0x57, 0x8e, 0xff, 0x3a, 0x59, 0x92, 0xff, 0x3d, 0x59, 0x93, 0xff, 0x3b, 0x53, 0x90, 0xff, 0x3d, 0x54, 0x92, 0xff, 0x36, 0x4c, 0x88, 0xff, 0x32, 0x45, 0x80, 0xff, 0x35, 0x4e, 0x86, 0xff, 0x34, 0x52, 0x89, 0xff, 0x29, 0x44, 0x7b, 0xff, 0x21, 0x37, 0x67, 0xff, 0x24, 0x33, 0x59, 0xff, 0x22, 0x2d, 0x4c, 0xff, 0x22, 0x29, 0x45, 0xff, 0x1e, 0x23, 0x41, 0xff, 0x1c, 0x22, 0x3a, 0xff, 0x19, 0x1f, 0x30, 0xff, 0x14, 0x1a, 0x26, 0xff, 0x11, 0x19, 0x22, 0xff, 0x0a, 0x0f, 0x19, 0xff, 0x09, 0x0d, 0x1a, 0xff, 0x08, 0x0d, 0x1a, 0xff, 0x0e, 0x0b, 0x11, 0xff, 0x10, 0x0b, 0x07, 0xff, 0x01, 0x00, 0x06, 0xff, 0x0a, 0x15, 0x3e, 0xff, 0x71, 0xb1, 0xdf, 0xff, 0x8f, 0xd0, 0xff, 0xff, 0x97, 0xcc, 0xfa, 0xff, 0x70, 0x94, 0xcb, 0xff, 0x4e, 0x84, 0xc3, 0xff, 0x7c, 0xcd, 0xfe, 0xff, 0x72, 0xc3, 0xea, 0xff, 0x76, 0xa9, 0xe0, 0xff, 0x4a, 0x59, 0x95, 0xff, 0x84, 0x7e, 0x9c, 0xff, 0xc3, 0xba, 0xc3, 0xff, 0xe1, 0xdd, 0xdf, 0xff, 0xea, 0xee, 0xee, 0xff, 0xef, 0xfb, 0xee, 0xff, 0xf6, 0xfc, 0xf7, 0xff, 0xf8, 0xfb, 0xfd, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xf7, 0xfc, 0xfb, 0xff, 0xf6, 0xfb, 0xf9, 0xff, 0xf1, 0xf6, 0xf7, 0xff, 0xe4, 0xf1, 0xf0, 0xff, 0xd6, 0xe4, 0xe7, 0xff, 0xac, 0xc6, 0xd6, 0xff, 0x72, 0xa3, 0xc0, 0xff, 0x46, 0x81, 0xa7, 0xff, 0x28, 0x54, 0x82, 0xff, 0x27, 0x32, 0x52, 0xff, 0x1c, 0x18, 0x1f, 0xff, 0x20, 0x17, 0x17, 0xff, 0x3a, 0x2a, 0x23, 0xff, 0x39, 0x29, 0x21, 0xff, 0x36, 0x2b, 0x27, 0xff, 0x39, 0x2e, 0x29, 0xff, 0x35, 0x2b, 0x20, 0xff, 0x36, 0x27, 0x21, 0xff, 0x32, 0x1f, 0x1d, 0xff, 0x37, 0x28, 0x20, 0xff, 0x3c, 0x31, 0x28, 0xff, 0x3d, 0x33, 0x2a, 0xdd, 0x3f, 0x36, 0x2d, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x21, 0x97, 0x67, 0x74, 0xde, 0x15, 0x00, 0x00, 0xff, 0x0c, 0x0b, 0x00, 0xff, 0x19, 0x1d, 0x0d, 0xff, 0x2c, 0x1a, 0x13, 0xff, 0x26, 0x14, 0x15, 0xff, 0x1d, 0x0f, 0x0f, 0xff, 0x01, 0x00, 0x00, 0xff, 0x07, 0x03, 0x08, 0xff, 0xb9, 0xb3, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xe3, 0xe6, 0xff, 0xe7, 0xeb, 0xed, 0xff, 0xf2, 0xf1, 0xef, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xe4, 0xe7, 0xee, 0xff, 0xdb, 0xd9, 0xe5, 0xff, 0x4e, 0x41, 0x45, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1b, 0x1c, 0x25, 0xff, 0x2e, 0x4b, 0x78, 0xff, 0x2a, 0x59, 0x8f, 0xff, 0x30, 0x5b, 0x8b, 0xff, 0x2f, 0x55, 0x89, 0xff, 0x31, 0x55, 0x8d, 0xff, 0x33, 0x55, 0x8c, 0xff, 0x37, 0x58, 0x8d, 0xff, 0x38, 0x57, 0x8b, 0xff, 0x31, 0x51, 0x80, 0xff, 0x2f, 0x4b, 0x74, 0xff, 0x28, 0x40, 0x65, 0xff, 0x16, 0x28, 0x48, 0xff, 0x11, 0x1c, 0x34, 0xff, 0x0d, 0x13, 0x21, 0xff, 0x0b, 0x0c, 0x13, 0xff, 0x0c, 0x08, 0x0e, 0xff, 0x07, 0x04, 0x08, 0xff, 0x06, 0x05, 0x04, 0xff, 0x04, 0x06, 0x01, 0xff, 0x02, 0x07, 0x00, 0xff, 0x00, 0x06, 0x01, 0xff, 0x00, 0x02, 0x01, 0xff, 0x01, 0x02, 0x03, 0xff, 0x00, 0x01, 0x05, 0xff, 0x02, 0x00, 0x01, 0xff, 0x04, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x27, 0x32, 0x53, 0xff, 0x84, 0xc3, 0xf2, 0xff, 0x87, 0xc5, 0xf9, 0xff, 0x9b, 0xcb, 0xfa, 0xff, 0x61, 0x7e, 0xb5, 0xff, 0x39, 0x62, 0xad, 0xff, 0x76, 0xc1, 0xf9, 0xff, 0x7b, 0xc8, 0xf6, 0xff, 0x75, 0xa4, 0xe3, 0xff, 0x53, 0x60, 0xa5, 0xff, 0x7a, 0x73, 0x99, 0xff, 0xc0, 0xb8, 0xc2, 0xff, 0xdf, 0xda, 0xdf, 0xff, 0xe9, 0xed, 0xef, 0xff, 0xee, 0xf7, 0xf3, 0xff, 0xf7, 0xfa, 0xf7, 0xff, 0xf8, 0xfc, 0xfb, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0xfa, 0xfd, 0xfd, 0xff, 0xf9, 0xfb, 0xfc, 0xff, 0xf7, 0xfb, 0xfa, 0xff, 0xf5, 0xf9, 0xf8, 0xff, 0xf0, 0xf6, 0xf5, 0xff, 0xe4, 0xf3, 0xef, 0xff, 0xd3, 0xe0, 0xe5, 0xff, 0xae, 0xc3, 0xd8, 0xff, 0x72, 0x9d, 0xbe, 0xff, 0x3e, 0x6e, 0x9a, 0xff, 0x23, 0x46, 0x71, 0xff, 0x20, 0x28, 0x40, 0xff, 0x24, 0x21, 0x24, 0xff, 0x2b, 0x24, 0x22, 0xff, 0x37, 0x27, 0x21, 0xff, 0x32, 0x25, 0x1f, 0xff, 0x29, 0x21, 0x1e, 0xff, 0x2c, 0x21, 0x1e, 0xff, 0x30, 0x24, 0x1b, 0xff, 0x31, 0x24, 0x1d, 0xff, 0x33, 0x24, 0x21, 0xff, 0x3a, 0x2c, 0x28, 0xff, 0x37, 0x2a, 0x24, 0xde, 0x36, 0x2e, 0x26, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1a, 0xb4, 0x8b, 0xa4, 0xd7, 0x21, 0x00, 0x07, 0xff, 0x0e, 0x00, 0x00, 0xff, 0x1e, 0x10, 0x0d, 0xff, 0x1c, 0x13, 0x0c, 0xff, 0x17, 0x0f, 0x06, 0xff, 0x11, 0x09, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x09, 0x08, 0x13, 0xff, 0xb2, 0xb5, 0xbf, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xe9, 0xeb, 0xef, 0xff, 0xeb, 0xef, 0xe8, 0xff, 0xe7, 0xee, 0xe6, 0xff, 0xe9, 0xf1, 0xf6, 0xff, 0xc3, 0xc3, 0xcc, 0xff, 0xb7, 0xa3, 0xa6, 0xff, 0x39, 0x24, 0x21, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1a, 0x24, 0x30, 0xff, 0x36, 0x51, 0x6a, 0xff, 0x2b, 0x4b, 0x68, 0xff, 0x29, 0x49, 0x69, 0xff, 0x2c, 0x49, 0x6d, 0xff, 0x26, 0x44, 0x67, 0xff, 0x1f, 0x38, 0x57, 0xff, 0x20, 0x2f, 0x4c, 0xff, 0x11, 0x24, 0x39, 0xff, 0x07, 0x12, 0x21, 0xff, 0x04, 0x08, 0x13, 0xff, 0x00, 0x02, 0x09, 0xff, 0x00, 0x00, 0x01, 0xff, 0x01, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x02, 0x00, 0xff, 0x04, 0x03, 0x00, 0xff, 0x05, 0x05, 0x00, 0xff, 0x07, 0x07, 0x00, 0xff, 0x08, 0x07, 0x04, 0xff, 0x03, 0x06, 0x06, 0xff, 0x03, 0x08, 0x06, 0xff, 0x08, 0x0a, 0x03, 0xff, 0x09, 0x09, 0x01, 0xff, 0x08, 0x05, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x55, 0x6c, 0x92, 0xff, 0x9d, 0xe9, 0xff, 0xff, 0x92, 0xd4, 0xfd, 0xff, 0xa7, 0xd0, 0xfe, 0xff, 0x5b, 0x69, 0xab, 0xff, 0x0f, 0x2c, 0x7f, 0xff, 0x5b, 0xa8, 0xe1, 0xff, 0x8a, 0xd0, 0xf8, 0xff, 0x83, 0xaa, 0xe5, 0xff, 0x5a, 0x63, 0xa9, 0xff, 0x70, 0x69, 0x92, 0xff, 0xbe, 0xb9, 0xc5, 0xff, 0xdd, 0xda, 0xde, 0xff, 0xe9, 0xec, 0xec, 0xff, 0xef, 0xf4, 0xf4, 0xff, 0xf6, 0xfb, 0xf6, 0xff, 0xf8, 0xfd, 0xfa, 0xff, 0xf8, 0xfd, 0xfd, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xfb, 0xfe, 0xfd, 0xff, 0xfa, 0xfd, 0xfc, 0xff, 0xf7, 0xfc, 0xfb, 0xff, 0xf6, 0xfa, 0xf9, 0xff, 0xed, 0xf8, 0xf3, 0xff, 0xdf, 0xf3, 0xec, 0xff, 0xd4, 0xde, 0xe9, 0xff, 0xb2, 0xbc, 0xdf, 0xff, 0x6f, 0x91, 0xbd, 0xff, 0x3a, 0x66, 0x91, 0xff, 0x1c, 0x3a, 0x5b, 0xff, 0x1b, 0x25, 0x31, 0xff, 0x1f, 0x1f, 0x1d, 0xff, 0x28, 0x24, 0x1d, 0xff, 0x30, 0x24, 0x1c, 0xff, 0x29, 0x20, 0x19, 0xff, 0x23, 0x1f, 0x1c, 0xff, 0x29, 0x1f, 0x1d, 0xff, 0x2f, 0x22, 0x1b, 0xff, 0x30, 0x25, 0x1f, 0xff, 0x31, 0x26, 0x22, 0xff, 0x35, 0x28, 0x24, 0xd7, 0x38, 0x2f, 0x25, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x16, 0xd4, 0xac, 0xb9, 0xca, 0x2c, 0x00, 0x07, 0xff, 0x13, 0x00, 0x00, 0xff, 0x1d, 0x16, 0x0c, 0xff, 0x19, 0x12, 0x09, 0xff, 0x09, 0x03, 0x05, 0xff, 0x04, 0x04, 0x08, 0xff, 0x00, 0x00, 0x00, 0xff, 0x11, 0x0c, 0x11, 0xff, 0xcf, 0xcb, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xe9, 0xde, 0xff, 0xde, 0xe8, 0xde, 0xff, 0xe1, 0xe7, 0xe7, 0xff, 0xd0, 0xce, 0xcf, 0xff, 0xbd, 0xae, 0xad, 0xff, 0xbc, 0xa3, 0xa4, 0xff, 0x19, 0x0a, 0x0d, 0xff, 0x07, 0x02, 0x00, 0xff, 0x18, 0x16, 0x12, 0xff, 0x06, 0x08, 0x13, 0xff, 0x0e, 0x11, 0x1c, 0xff, 0x09, 0x0a, 0x19, 0xff, 0x04, 0x05, 0x14, 0xff, 0x00, 0x00, 0x07, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x06, 0x00, 0x00, 0xff, 0x0c, 0x04, 0x00, 0xff, 0x14, 0x0b, 0x02, 0xff, 0x0d, 0x06, 0x01, 0xff, 0x0b, 0x05, 0x00, 0xff, 0x0c, 0x07, 0x02, 0xff, 0x08, 0x05, 0x06, 0xff, 0x08, 0x05, 0x07, 0xff, 0x07, 0x05, 0x06, 0xff, 0x08, 0x04, 0x06, 0xff, 0x09, 0x04, 0x0c, 0xff, 0x04, 0x04, 0x0a, 0xff, 0x04, 0x06, 0x06, 0xff, 0x09, 0x09, 0x02, 0xff, 0x0c, 0x0a, 0x00, 0xff, 0x0b, 0x07, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x62, 0x81, 0xa9, 0xff, 0x9d, 0xf0, 0xff, 0xff, 0x97, 0xdd, 0xff, 0xff, 0x82, 0xa6, 0xdc, 0xff, 0x6e, 0x74, 0xba, 0xff, 0x16, 0x2b, 0x76, 0xff, 0x3c, 0x7c, 0xba, 0xff, 0x81, 0xc6, 0xed, 0xff, 0x88, 0xb1, 0xe7, 0xff, 0x85, 0x8f, 0xd3, 0xff, 0x83, 0x81, 0xa7, 0xff, 0xac, 0xaf, 0xb8, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xeb, 0xed, 0xeb, 0xff, 0xf2, 0xf5, 0xf3, 0xff, 0xf5, 0xfa, 0xf7, 0xff, 0xf7, 0xfd, 0xfb, 0xff, 0xf8, 0xfd, 0xfd, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0xfa, 0xfe, 0xfd, 0xff, 0xf8, 0xfd, 0xfc, 0xff, 0xf6, 0xfc, 0xfb, 0xff, 0xf5, 0xfa, 0xfa, 0xff, 0xea, 0xf7, 0xf3, 0xff, 0xdb, 0xf0, 0xea, 0xff, 0xd5, 0xde, 0xe8, 0xff, 0xb1, 0xb5, 0xe1, 0xff, 0x6a, 0x84, 0xbb, 0xff, 0x32, 0x55, 0x80, 0xff, 0x16, 0x2f, 0x45, 0xff, 0x16, 0x1f, 0x22, 0xff, 0x24, 0x23, 0x1d, 0xff, 0x27, 0x21, 0x1a, 0xff, 0x26, 0x20, 0x17, 0xff, 0x20, 0x1b, 0x13, 0xff, 0x22, 0x1d, 0x1c, 0xff, 0x28, 0x21, 0x20, 0xff, 0x31, 0x26, 0x20, 0xff, 0x30, 0x27, 0x22, 0xff, 0x2e, 0x27, 0x24, 0xca, 0x2e, 0x22, 0x22, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x0b, 0xd7, 0xb7, 0xc6, 0xaf, 0x2c, 0x04, 0x0d, 0xff, 0x11, 0x00, 0x00, 0xff, 0x1c, 0x10, 0x0f, 0xff, 0x15, 0x0e, 0x0b, 0xff, 0x07, 0x08, 0x05, 0xff, 0x0e, 0x07, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2a, 0x26, 0x2e, 0xff, 0xe2, 0xea, 0xf2, 0xff, 0xe6, 0xf6, 0xf4, 0xff, 0xd2, 0xdc, 0xd9, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xf2, 0xef, 0xee, 0xff, 0xec, 0xe8, 0xea, 0xff, 0xc6, 0xc0, 0xc2, 0xff, 0x99, 0x8a, 0x88, 0xff, 0x08, 0x00, 0x00, 0xff, 0x23, 0x13, 0x0f, 0xff, 0x40, 0x39, 0x35, 0xff, 0x00, 0x00, 0x00, 0xff, 0x05, 0x00, 0x00, 0xff, 0x08, 0x00, 0x00, 0xff, 0x0e, 0x04, 0x03, 0xff, 0x0f, 0x06, 0x01, 0xff, 0x13, 0x06, 0x02, 0xff, 0x13, 0x08, 0x04, 0xff, 0x0f, 0x0a, 0x05, 0xff, 0x0a, 0x07, 0x01, 0xff, 0x0b, 0x07, 0x02, 0xff, 0x0b, 0x08, 0x03, 0xff, 0x0a, 0x07, 0x02, 0xff, 0x08, 0x07, 0x06, 0xff, 0x0a, 0x08, 0x09, 0xff, 0x0b, 0x07, 0x0b, 0xff, 0x0a, 0x05, 0x0b, 0xff, 0x0a, 0x06, 0x08, 0xff, 0x05, 0x05, 0x09, 0xff, 0x06, 0x07, 0x06, 0xff, 0x09, 0x08, 0x03, 0xff, 0x09, 0x07, 0x02, 0xff, 0x0b, 0x07, 0x02, 0xff, 0x08, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x30, 0x45, 0x6b, 0xff, 0x6e, 0xbc, 0xff, 0xff, 0x5b, 0x9d, 0xf7, 0xff, 0x5c, 0x87, 0xce, 0xff, 0xab, 0xc8, 0xed, 0xff, 0x27, 0x2f, 0x62, 0xff, 0x23, 0x45, 0x96, 0xff, 0x6d, 0xb8, 0xf1, 0xff, 0x7b, 0xb7, 0xed, 0xff, 0x97, 0xb0, 0xf1, 0xff, 0x9b, 0xa2, 0xc1, 0xff, 0xab, 0xb3, 0xb2, 0xff, 0xda, 0xe1, 0xd9, 0xff, 0xef, 0xf0, 0xeb, 0xff, 0xf6, 0xf6, 0xf4, 0xff, 0xf4, 0xfb, 0xf8, 0xff, 0xf6, 0xfd, 0xfb, 0xff, 0xf9, 0xfd, 0xfd, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0xf8, 0xfd, 0xfc, 0xff, 0xf6, 0xfc, 0xfb, 0xff, 0xf4, 0xfa, 0xf9, 0xff, 0xf1, 0xf8, 0xf8, 0xff, 0xed, 0xf4, 0xf3, 0xff, 0xe3, 0xf1, 0xeb, 0xff, 0xd2, 0xdb, 0xe0, 0xff, 0xa8, 0xb5, 0xd8, 0xff, 0x69, 0x7f, 0xbe, 0xff, 0x2e, 0x40, 0x76, 0xff, 0x12, 0x20, 0x33, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x2b, 0x23, 0x20, 0xff, 0x22, 0x1d, 0x1a, 0xff, 0x1e, 0x1c, 0x17, 0xff, 0x20, 0x1b, 0x1c, 0xff, 0x22, 0x1d, 0x21, 0xff, 0x25, 0x21, 0x1f, 0xff, 0x30, 0x27, 0x23, 0xff, 0x2a, 0x22, 0x1f, 0xb0, 0x2e, 0x17, 0x17, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xcb, 0xae, 0xb9, 0x8b, 0x1a, 0x00, 0x06, 0xff, 0x0e, 0x00, 0x00, 0xff, 0x19, 0x12, 0x0e, 0xff, 0x0d, 0x0d, 0x09, 0xff, 0x0f, 0x06, 0x03, 0xff, 0x12, 0x06, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3c, 0x3f, 0x4a, 0xff, 0xf5, 0xf6, 0xfe, 0xff, 0xf2, 0xf2, 0xf5, 0xff, 0xe2, 0xe5, 0xe6, 0xff, 0xe6, 0xea, 0xe8, 0xff, 0xed, 0xf0, 0xef, 0xff, 0xb7, 0xb7, 0xb4, 0xff, 0xb2, 0xa7, 0xa3, 0xff, 0x86, 0x70, 0x70, 0xff, 0x05, 0x00, 0x00, 0xff, 0x4a, 0x40, 0x3f, 0xff, 0x2e, 0x2b, 0x2b, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0e, 0x08, 0x09, 0xff, 0x0b, 0x09, 0x04, 0xff, 0x0d, 0x08, 0x02, 0xff, 0x13, 0x07, 0x07, 0xff, 0x12, 0x09, 0x0b, 0xff, 0x0b, 0x08, 0x09, 0xff, 0x08, 0x07, 0x06, 0xff, 0x0c, 0x09, 0x08, 0xff, 0x0b, 0x08, 0x06, 0xff, 0x0a, 0x07, 0x05, 0xff, 0x0c, 0x09, 0x05, 0xff, 0x0d, 0x08, 0x05, 0xff, 0x0a, 0x07, 0x06, 0xff, 0x09, 0x08, 0x07, 0xff, 0x08, 0x07, 0x05, 0xff, 0x06, 0x04, 0x03, 0xff, 0x07, 0x05, 0x04, 0xff, 0x08, 0x06, 0x04, 0xff, 0x09, 0x06, 0x05, 0xff, 0x0a, 0x06, 0x03, 0xff, 0x09, 0x05, 0x01, 0xff, 0x07, 0x00, 0x00, 0xff, 0x05, 0x06, 0x16, 0xff, 0x14, 0x3b, 0x8f, 0xff, 0x1b, 0x49, 0xb9, 0xff, 0x6e, 0x92, 0xdc, 0xff, 0xc1, 0xe1, 0xf7, 0xff, 0x23, 0x29, 0x3f, 0xff, 0x00, 0x10, 0x49, 0xff, 0x43, 0x80, 0xcc, 0xff, 0x60, 0x8d, 0xe2, 0xff, 0x8a, 0x93, 0xeb, 0xff, 0xa1, 0xa0, 0xcc, 0xff, 0xb6, 0xbd, 0xbd, 0xff, 0xdc, 0xe1, 0xde, 0xff, 0xf1, 0xf0, 0xee, 0xff, 0xf6, 0xf7, 0xf3, 0xff, 0xf5, 0xfb, 0xf9, 0xff, 0xf7, 0xfd, 0xfc, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0xf8, 0xfd, 0xfc, 0xff, 0xf8, 0xfd, 0xfc, 0xff, 0xf7, 0xfd, 0xfc, 0xff, 0xf6, 0xfc, 0xfb, 0xff, 0xf4, 0xfb, 0xfa, 0xff, 0xef, 0xf8, 0xf6, 0xff, 0xec, 0xf3, 0xf2, 0xff, 0xe6, 0xef, 0xeb, 0xff, 0xcf, 0xdc, 0xdb, 0xff, 0xa7, 0xb7, 0xd3, 0xff, 0x69, 0x75, 0xb6, 0xff, 0x2f, 0x33, 0x72, 0xff, 0x18, 0x1b, 0x31, 0xff, 0x25, 0x20, 0x1d, 0xff, 0x2b, 0x22, 0x1f, 0xff, 0x20, 0x1b, 0x18, 0xff, 0x23, 0x1f, 0x1c, 0xff, 0x26, 0x22, 0x21, 0xff, 0x29, 0x25, 0x25, 0xff, 0x28, 0x22, 0x20, 0xff, 0x28, 0x1d, 0x1b, 0x8b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xac, 0xb2, 0x57, 0x13, 0x00, 0x00, 0xf3, 0x0b, 0x00, 0x00, 0xff, 0x1d, 0x12, 0x10, 0xff, 0x10, 0x0b, 0x08, 0xff, 0x08, 0x0a, 0x07, 0xff, 0x00, 0x01, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x75, 0x67, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf4, 0xf7, 0xff, 0xd7, 0xde, 0xde, 0xff, 0xdd, 0xe2, 0xda, 0xff, 0xf1, 0xf2, 0xe9, 0xff, 0xd0, 0xca, 0xc7, 0xff, 0xf1, 0xe2, 0xe1, 0xff, 0x64, 0x5b, 0x5a, 0xff, 0x09, 0x06, 0x07, 0xff, 0x87, 0x7d, 0x80, 0xff, 0x18, 0x10, 0x14, 0xff, 0x07, 0x03, 0x02, 0xff, 0x0e, 0x0c, 0x05, 0xff, 0x0c, 0x09, 0x02, 0xff, 0x11, 0x07, 0x08, 0xff, 0x12, 0x09, 0x0c, 0xff, 0x0d, 0x09, 0x08, 0xff, 0x0f, 0x0a, 0x09, 0xff, 0x0f, 0x0a, 0x09, 0xff, 0x0e, 0x08, 0x07, 0xff, 0x0e, 0x08, 0x08, 0xff, 0x0f, 0x09, 0x08, 0xff, 0x0f, 0x06, 0x07, 0xff, 0x09, 0x04, 0x03, 0xff, 0x06, 0x07, 0x05, 0xff, 0x08, 0x06, 0x05, 0xff, 0x08, 0x05, 0x04, 0xff, 0x08, 0x06, 0x06, 0xff, 0x09, 0x08, 0x07, 0xff, 0x0b, 0x07, 0x05, 0xff, 0x0b, 0x07, 0x04, 0xff, 0x0b, 0x08, 0x03, 0xff, 0x0c, 0x09, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x06, 0x29, 0xff, 0x1b, 0x29, 0x63, 0xff, 0x1c, 0x2c, 0x51, 0xff, 0x0f, 0x1a, 0x20, 0xff, 0x07, 0x06, 0x03, 0xff, 0x01, 0x02, 0x11, 0xff, 0x09, 0x1c, 0x5d, 0xff, 0x1b, 0x26, 0x83, 0xff, 0x4f, 0x40, 0xa2, 0xff, 0x98, 0x83, 0xbf, 0xff, 0xc7, 0xbe, 0xd3, 0xff, 0xe1, 0xdf, 0xea, 0xff, 0xee, 0xef, 0xf2, 0xff, 0xf2, 0xf6, 0xf4, 0xff, 0xf6, 0xfb, 0xf9, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0xf7, 0xfd, 0xfc, 0xff, 0xf7, 0xfd, 0xfc, 0xff, 0xf7, 0xfd, 0xfc, 0xff, 0xf6, 0xfc, 0xfb, 0xff, 0xf4, 0xfc, 0xf9, 0xff, 0xed, 0xf8, 0xf4, 0xff, 0xe9, 0xf3, 0xef, 0xff, 0xe4, 0xea, 0xea, 0xff, 0xcf, 0xdb, 0xdc, 0xff, 0xa8, 0xb5, 0xce, 0xff, 0x70, 0x76, 0xb3, 0xff, 0x33, 0x32, 0x6f, 0xff, 0x19, 0x13, 0x29, 0xff, 0x23, 0x1b, 0x15, 0xff, 0x29, 0x1f, 0x1a, 0xff, 0x2c, 0x23, 0x1f, 0xff, 0x2d, 0x24, 0x21, 0xff, 0x2b, 0x25, 0x20, 0xff, 0x2f, 0x28, 0x22, 0xf3, 0x2b, 0x23, 0x20, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xa6, 0xb1, 0x2b, 0x15, 0x00, 0x00, 0xd2, 0x17, 0x02, 0x01, 0xff, 0x1d, 0x17, 0x13, 0xff, 0x00, 0x07, 0x01, 0xff, 0x0b, 0x06, 0x05, 0xff, 0x17, 0x00, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x7e, 0x7b, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xda, 0xdc, 0xff, 0xe2, 0xe8, 0xe0, 0xff, 0xf9, 0xfd, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf3, 0xf1, 0xff, 0x9c, 0x94, 0x93, 0xff, 0x00, 0x00, 0x00, 0xff, 0x68, 0x62, 0x64, 0xff, 0x84, 0x7b, 0x7f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0e, 0x0c, 0x05, 0xff, 0x0f, 0x0b, 0x03, 0xff, 0x12, 0x08, 0x08, 0xff, 0x12, 0x0a, 0x0b, 0xff, 0x0e, 0x0a, 0x09, 0xff, 0x0e, 0x09, 0x08, 0xff, 0x0f, 0x0a, 0x09, 0xff, 0x10, 0x0b, 0x0a, 0xff, 0x10, 0x0b, 0x0a, 0xff, 0x10, 0x0a, 0x09, 0xff, 0x10, 0x08, 0x08, 0xff, 0x0a, 0x06, 0x05, 0xff, 0x08, 0x08, 0x06, 0xff, 0x0d, 0x0c, 0x0b, 0xff, 0x0f, 0x0d, 0x0c, 0xff, 0x0e, 0x0d, 0x0c, 0xff, 0x10, 0x0d, 0x0d, 0xff, 0x0e, 0x0a, 0x0a, 0xff, 0x0d, 0x09, 0x08, 0xff, 0x0b, 0x09, 0x05, 0xff, 0x0a, 0x07, 0x03, 0xff, 0x0f, 0x06, 0x03, 0xff, 0x15, 0x03, 0x01, 0xff, 0x0b, 0x00, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x02, 0x00, 0xff, 0x08, 0x07, 0x00, 0xff, 0x07, 0x04, 0x01, 0xff, 0x00, 0x00, 0x0a, 0xff, 0x00, 0x00, 0x20, 0xff, 0x4b, 0x30, 0x6f, 0xff, 0xaf, 0x93, 0xbc, 0xff, 0xd7, 0xc9, 0xd7, 0xff, 0xe4, 0xe0, 0xeb, 0xff, 0xed, 0xf1, 0xf5, 0xff, 0xee, 0xf7, 0xf4, 0xff, 0xf5, 0xfb, 0xf9, 0xff, 0xfa, 0xfe, 0xfd, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0xf7, 0xfd, 0xfc, 0xff, 0xf7, 0xfd, 0xfc, 0xff, 0xf6, 0xfc, 0xfb, 0xff, 0xf3, 0xfa, 0xfa, 0xff, 0xf1, 0xfa, 0xf8, 0xff, 0xeb, 0xf7, 0xf3, 0xff, 0xe7, 0xf2, 0xef, 0xff, 0xe2, 0xe8, 0xeb, 0xff, 0xcd, 0xd7, 0xdc, 0xff, 0xa6, 0xb3, 0xc8, 0xff, 0x70, 0x78, 0xaa, 0xff, 0x3b, 0x36, 0x69, 0xff, 0x1e, 0x0f, 0x21, 0xff, 0x26, 0x19, 0x12, 0xff, 0x2d, 0x1e, 0x1a, 0xff, 0x30, 0x21, 0x1d, 0xff, 0x30, 0x23, 0x1f, 0xff, 0x34, 0x26, 0x24, 0xd2, 0x2e, 0x28, 0x22, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x7f, 0x7f, 0x08, 0x0a, 0x00, 0x00, 0x8f, 0x16, 0x0b, 0x05, 0xfe, 0x0f, 0x11, 0x07, 0xff, 0x17, 0x0f, 0x08, 0xff, 0x11, 0x08, 0x06, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x8d, 0x89, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xe3, 0xe0, 0xff, 0xe3, 0xe8, 0xe2, 0xff, 0xeb, 0xed, 0xe5, 0xff, 0xb4, 0xb2, 0xaf, 0xff, 0x89, 0x80, 0x81, 0xff, 0x1f, 0x14, 0x16, 0xff, 0x3e, 0x35, 0x39, 0xff, 0x51, 0x49, 0x4d, 0xff, 0x01, 0x00, 0x00, 0xff, 0x0d, 0x0b, 0x04, 0xff, 0x0f, 0x0d, 0x03, 0xff, 0x16, 0x0d, 0x0b, 0xff, 0x15, 0x0c, 0x0c, 0xff, 0x0d, 0x08, 0x06, 0xff, 0x09, 0x04, 0x03, 0xff, 0x0c, 0x07, 0x06, 0xff, 0x11, 0x0c, 0x0b, 0xff, 0x0f, 0x0b, 0x09, 0xff, 0x10, 0x0a, 0x09, 0xff, 0x12, 0x0a, 0x0a, 0xff, 0x10, 0x0b, 0x0a, 0xff, 0x0f, 0x0e, 0x0d, 0xff, 0x14, 0x13, 0x12, 0xff, 0x16, 0x14, 0x13, 0xff, 0x11, 0x0f, 0x0e, 0xff, 0x11, 0x0f, 0x0e, 0xff, 0x0d, 0x08, 0x0b, 0xff, 0x0c, 0x07, 0x08, 0xff, 0x0b, 0x07, 0x06, 0xff, 0x0a, 0x08, 0x05, 0xff, 0x11, 0x0c, 0x03, 0xff, 0x16, 0x07, 0x00, 0xff, 0x17, 0x06, 0x03, 0xff, 0x0e, 0x06, 0x06, 0xff, 0x09, 0x06, 0x07, 0xff, 0x0b, 0x0b, 0x03, 0xff, 0x0f, 0x09, 0x00, 0xff, 0x08, 0x00, 0x00, 0xff, 0x10, 0x00, 0x05, 0xff, 0x71, 0x4c, 0x6c, 0xff, 0xc3, 0xa4, 0xb6, 0xff, 0xdb, 0xd1, 0xcf, 0xff, 0xeb, 0xe9, 0xe8, 0xff, 0xed, 0xf6, 0xf3, 0xff, 0xeb, 0xfa, 0xf4, 0xff, 0xf8, 0xfd, 0xfb, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0xf7, 0xfd, 0xfc, 0xff, 0xf8, 0xfd, 0xfc, 0xff, 0xf5, 0xfb, 0xfb, 0xff, 0xf0, 0xfa, 0xf8, 0xff, 0xef, 0xfa, 0xf7, 0xff, 0xea, 0xf7, 0xf3, 0xff, 0xe4, 0xf0, 0xee, 0xff, 0xdd, 0xe3, 0xea, 0xff, 0xca, 0xd2, 0xd9, 0xff, 0xa6, 0xb1, 0xc2, 0xff, 0x6a, 0x73, 0x9b, 0xff, 0x33, 0x2b, 0x57, 0xff, 0x27, 0x10, 0x20, 0xff, 0x32, 0x1d, 0x16, 0xff, 0x39, 0x2a, 0x24, 0xff, 0x32, 0x26, 0x1f, 0xfe, 0x33, 0x27, 0x20, 0x8f, 0x3f, 0x1f, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0x11, 0x0f, 0xdb, 0x13, 0x16, 0x0f, 0xff, 0x0c, 0x10, 0x09, 0xff, 0x0e, 0x06, 0x0c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x03, 0x02, 0x03, 0xff, 0xc4, 0xc3, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xcd, 0xcd, 0xff, 0x9e, 0x9b, 0x99, 0xff, 0x97, 0x91, 0x8c, 0xff, 0x8a, 0x80, 0x7c, 0xff, 0x22, 0x16, 0x16, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x01, 0xff, 0x0d, 0x07, 0x09, 0xff, 0x0e, 0x0c, 0x06, 0xff, 0x0f, 0x0c, 0x02, 0xff, 0x15, 0x0c, 0x0b, 0xff, 0x13, 0x0c, 0x0d, 0xff, 0x09, 0x05, 0x04, 0xff, 0x09, 0x03, 0x03, 0xff, 0x0c, 0x07, 0x07, 0xff, 0x0c, 0x07, 0x07, 0xff, 0x0c, 0x06, 0x06, 0xff, 0x0c, 0x08, 0x06, 0xff, 0x10, 0x0a, 0x0a, 0xff, 0x0d, 0x0a, 0x0a, 0xff, 0x0a, 0x0a, 0x08, 0xff, 0x0f, 0x0d, 0x0c, 0xff, 0x14, 0x12, 0x11, 0xff, 0x11, 0x10, 0x0f, 0xff, 0x0e, 0x0c, 0x0b, 0xff, 0x0b, 0x08, 0x04, 0xff, 0x0c, 0x08, 0x06, 0xff, 0x0f, 0x09, 0x0a, 0xff, 0x10, 0x0a, 0x0d, 0xff, 0x08, 0x09, 0x0a, 0xff, 0x0b, 0x09, 0x0a, 0xff, 0x0f, 0x0b, 0x08, 0xff, 0x14, 0x0a, 0x0c, 0xff, 0x19, 0x08, 0x11, 0xff, 0x0d, 0x0a, 0x03, 0xff, 0x09, 0x0e, 0x00, 0xff, 0x10, 0x00, 0x00, 0xff, 0x26, 0x02, 0x1b, 0xff, 0x8f, 0x61, 0x8d, 0xff, 0xd2, 0xb0, 0xca, 0xff, 0xe1, 0xd7, 0xd6, 0xff, 0xe8, 0xec, 0xe6, 0xff, 0xee, 0xf9, 0xee, 0xff, 0xf1, 0xfd, 0xf0, 0xff, 0xf7, 0xfd, 0xf9, 0xff, 0xfa, 0xfd, 0xfe, 0xff, 0xfa, 0xfe, 0xfd, 0xff, 0xf7, 0xfd, 0xfc, 0xff, 0xf6, 0xfc, 0xfb, 0xff, 0xf2, 0xfb, 0xfa, 0xff, 0xee, 0xf9, 0xf8, 0xff, 0xeb, 0xf9, 0xf5, 0xff, 0xe7, 0xf7, 0xef, 0xff, 0xdf, 0xee, 0xea, 0xff, 0xd9, 0xde, 0xe5, 0xff, 0xc9, 0xcb, 0xd4, 0xff, 0xa0, 0xa9, 0xbc, 0xff, 0x66, 0x6c, 0x95, 0xff, 0x3b, 0x2d, 0x57, 0xff, 0x35, 0x1d, 0x29, 0xff, 0x33, 0x20, 0x18, 0xff, 0x36, 0x26, 0x21, 0xdb, 0x32, 0x22, 0x1e, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x09, 0x1e, 0x1a, 0x18, 0x87, 0x15, 0x12, 0x0b, 0xf9, 0x22, 0x14, 0x11, 0xff, 0x1e, 0x17, 0x14, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x22, 0x27, 0xff, 0xe8, 0xe0, 0xee, 0xff, 0xbc, 0xb4, 0xbe, 0xff, 0x78, 0x6d, 0x6f, 0xff, 0x7f, 0x72, 0x6c, 0xff, 0xb0, 0xa7, 0x98, 0xff, 0x55, 0x4f, 0x44, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0f, 0x08, 0x09, 0xff, 0x0b, 0x06, 0x06, 0xff, 0x0e, 0x0c, 0x05, 0xff, 0x10, 0x0b, 0x05, 0xff, 0x12, 0x0a, 0x0a, 0xff, 0x10, 0x0a, 0x0c, 0xff, 0x09, 0x06, 0x07, 0xff, 0x0b, 0x09, 0x08, 0xff, 0x0c, 0x09, 0x09, 0xff, 0x06, 0x03, 0x03, 0xff, 0x07, 0x04, 0x03, 0xff, 0x09, 0x05, 0x04, 0xff, 0x0a, 0x07, 0x06, 0xff, 0x0a, 0x09, 0x08, 0xff, 0x0a, 0x0a, 0x08, 0xff, 0x0d, 0x0b, 0x0a, 0xff, 0x0d, 0x0b, 0x0a, 0xff, 0x13, 0x11, 0x10, 0xff, 0x17, 0x15, 0x14, 0xff, 0x0f, 0x0c, 0x09, 0xff, 0x0a, 0x06, 0x05, 0xff, 0x14, 0x0d, 0x0e, 0xff, 0x18, 0x12, 0x13, 0xff, 0x09, 0x07, 0x12, 0xff, 0x0c, 0x0a, 0x0f, 0xff, 0x10, 0x12, 0x00, 0xff, 0x16, 0x12, 0x02, 0xff, 0x1c, 0x0e, 0x18, 0xff, 0x0e, 0x09, 0x12, 0xff, 0x00, 0x0a, 0x06, 0xff, 0x0c, 0x00, 0x07, 0xff, 0x3a, 0x0e, 0x3e, 0xff, 0xa3, 0x72, 0xb2, 0xff, 0xd7, 0xb7, 0xdc, 0xff, 0xe6, 0xdd, 0xe1, 0xff, 0xe9, 0xee, 0xec, 0xff, 0xf1, 0xf8, 0xf1, 0xff, 0xf6, 0xfd, 0xf3, 0xff, 0xf8, 0xfd, 0xfb, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfa, 0xfe, 0xfd, 0xff, 0xf8, 0xfd, 0xfc, 0xff, 0xf4, 0xfb, 0xfa, 0xff, 0xef, 0xf9, 0xf9, 0xff, 0xeb, 0xf8, 0xf7, 0xff, 0xe9, 0xf7, 0xf3, 0xff, 0xe4, 0xf5, 0xeb, 0xff, 0xdb, 0xea, 0xe8, 0xff, 0xd7, 0xda, 0xe6, 0xff, 0xc5, 0xc5, 0xd1, 0xff, 0x9a, 0xa4, 0xb4, 0xff, 0x63, 0x69, 0x91, 0xff, 0x3d, 0x33, 0x5c, 0xff, 0x36, 0x20, 0x2d, 0xf9, 0x36, 0x23, 0x1f, 0x88, 0x38, 0x38, 0x38, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x14, 0x14, 0x25, 0x30, 0x28, 0x1b, 0xb7, 0x2b, 0x22, 0x17, 0xff, 0x0f, 0x07, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x55, 0x4b, 0x58, 0xff, 0xa9, 0x98, 0xa5, 0xff, 0x73, 0x61, 0x62, 0xff, 0xa3, 0x93, 0x8b, 0xff, 0xc1, 0xb7, 0xa8, 0xff, 0x36, 0x32, 0x24, 0xff, 0x00, 0x00, 0x00, 0xff, 0x11, 0x0c, 0x0b, 0xff, 0x0e, 0x09, 0x06, 0xff, 0x0d, 0x0a, 0x03, 0xff, 0x12, 0x0c, 0x0a, 0xff, 0x13, 0x09, 0x0c, 0xff, 0x0e, 0x07, 0x09, 0xff, 0x08, 0x06, 0x05, 0xff, 0x05, 0x07, 0x04, 0xff, 0x05, 0x06, 0x04, 0xff, 0x06, 0x08, 0x06, 0xff, 0x08, 0x09, 0x07, 0xff, 0x0a, 0x07, 0x06, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x06, 0x04, 0xff, 0x09, 0x0a, 0x08, 0xff, 0x0d, 0x0b, 0x0a, 0xff, 0x0c, 0x09, 0x08, 0xff, 0x0d, 0x0b, 0x0a, 0xff, 0x11, 0x0f, 0x0f, 0xff, 0x0f, 0x09, 0x0c, 0xff, 0x0d, 0x08, 0x09, 0xff, 0x19, 0x16, 0x11, 0xff, 0x1a, 0x16, 0x0f, 0xff, 0x0f, 0x08, 0x11, 0xff, 0x0f, 0x06, 0x10, 0xff, 0x12, 0x0f, 0x00, 0xff, 0x16, 0x14, 0x00, 0xff, 0x1b, 0x14, 0x14, 0xff, 0x11, 0x08, 0x11, 0xff, 0x00, 0x00, 0x00, 0xff, 0x09, 0x00, 0x00, 0xff, 0x51, 0x27, 0x51, 0xff, 0xb2, 0x8c, 0xbb, 0xff, 0xda, 0xc7, 0xd6, 0xff, 0xe8, 0xe7, 0xe1, 0xff, 0xee, 0xf3, 0xf2, 0xff, 0xf3, 0xf8, 0xf8, 0xff, 0xf6, 0xfc, 0xf9, 0xff, 0xf8, 0xfd, 0xfd, 0xff, 0xfa, 0xfc, 0xfd, 0xff, 0xf9, 0xfd, 0xfc, 0xff, 0xf6, 0xfc, 0xfb, 0xff, 0xf3, 0xfa, 0xf9, 0xff, 0xee, 0xf9, 0xf9, 0xff, 0xeb, 0xf9, 0xf8, 0xff, 0xe7, 0xf6, 0xf3, 0xff, 0xde, 0xf0, 0xea, 0xff, 0xda, 0xe6, 0xe8, 0xff, 0xd2, 0xd4, 0xe7, 0xff, 0xb9, 0xbe, 0xcf, 0xff, 0x90, 0x9b, 0xab, 0xff, 0x5b, 0x64, 0x84, 0xff, 0x3a, 0x36, 0x59, 0xb7, 0x43, 0x35, 0x3c, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x15, 0x0a, 0x46, 0x1f, 0x15, 0x11, 0xca, 0x08, 0x00, 0x02, 0xff, 0x09, 0x00, 0x04, 0xff, 0x71, 0x5d, 0x62, 0xff, 0xa9, 0x94, 0x93, 0xff, 0xd2, 0xc2, 0xba, 0xff, 0x4c, 0x44, 0x3f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0c, 0x09, 0x06, 0xff, 0x0e, 0x08, 0x09, 0xff, 0x12, 0x0a, 0x09, 0xff, 0x0f, 0x0a, 0x07, 0xff, 0x11, 0x0b, 0x0c, 0xff, 0x14, 0x09, 0x0d, 0xff, 0x0e, 0x06, 0x08, 0xff, 0x0a, 0x09, 0x07, 0xff, 0x0a, 0x08, 0x04, 0xff, 0x0b, 0x0a, 0x05, 0xff, 0x0d, 0x0c, 0x07, 0xff, 0x0b, 0x09, 0x05, 0xff, 0x08, 0x07, 0x06, 0xff, 0x05, 0x07, 0x04, 0xff, 0x04, 0x07, 0x05, 0xff, 0x06, 0x09, 0x07, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x0b, 0x0a, 0x09, 0xff, 0x0c, 0x0a, 0x09, 0xff, 0x0c, 0x09, 0x07, 0xff, 0x10, 0x0c, 0x09, 0xff, 0x18, 0x13, 0x0f, 0xff, 0x19, 0x15, 0x0f, 0xff, 0x19, 0x12, 0x10, 0xff, 0x16, 0x08, 0x13, 0xff, 0x14, 0x09, 0x09, 0xff, 0x15, 0x0c, 0x0b, 0xff, 0x1c, 0x12, 0x11, 0xff, 0x23, 0x1a, 0x0d, 0xff, 0x11, 0x0f, 0x00, 0xff, 0x0f, 0x00, 0x03, 0xff, 0x6e, 0x44, 0x66, 0xff, 0xc0, 0xa6, 0xbe, 0xff, 0xda, 0xd5, 0xd3, 0xff, 0xe7, 0xed, 0xe5, 0xff, 0xee, 0xf4, 0xf2, 0xff, 0xf3, 0xf8, 0xf7, 0xff, 0xf6, 0xfb, 0xfa, 0xff, 0xf7, 0xfc, 0xfa, 0xff, 0xfa, 0xfd, 0xfc, 0xff, 0xf9, 0xfc, 0xfc, 0xff, 0xf6, 0xfc, 0xfb, 0xff, 0xf4, 0xfa, 0xf9, 0xff, 0xed, 0xf8, 0xf7, 0xff, 0xe8, 0xf8, 0xf6, 0xff, 0xe3, 0xf4, 0xf2, 0xff, 0xd7, 0xea, 0xe6, 0xff, 0xd6, 0xe2, 0xe1, 0xff, 0xcb, 0xcf, 0xe0, 0xff, 0xae, 0xb5, 0xcb, 0xff, 0x89, 0x92, 0xab, 0xca, 0x5e, 0x66, 0x7f, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x06, 0x06, 0x4d, 0x06, 0x00, 0x00, 0xcc, 0xb0, 0x9e, 0x9d, 0xff, 0xef, 0xdd, 0xdd, 0xff, 0x63, 0x59, 0x57, 0xff, 0x00, 0x00, 0x00, 0xff, 0x06, 0x05, 0x05, 0xff, 0x12, 0x0d, 0x0d, 0xff, 0x14, 0x0e, 0x0f, 0xff, 0x13, 0x0a, 0x0b, 0xff, 0x14, 0x09, 0x0a, 0xff, 0x12, 0x0b, 0x0c, 0xff, 0x0f, 0x09, 0x0a, 0xff, 0x0d, 0x0a, 0x09, 0xff, 0x0e, 0x0a, 0x09, 0xff, 0x0d, 0x08, 0x06, 0xff, 0x0f, 0x0b, 0x08, 0xff, 0x10, 0x0c, 0x09, 0xff, 0x0e, 0x09, 0x07, 0xff, 0x0a, 0x07, 0x06, 0xff, 0x09, 0x08, 0x07, 0xff, 0x09, 0x09, 0x08, 0xff, 0x09, 0x09, 0x08, 0xff, 0x07, 0x05, 0x04, 0xff, 0x06, 0x04, 0x03, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x0f, 0x0c, 0x0b, 0xff, 0x0e, 0x0c, 0x07, 0xff, 0x0d, 0x0b, 0x06, 0xff, 0x11, 0x0d, 0x09, 0xff, 0x17, 0x13, 0x0f, 0xff, 0x1e, 0x16, 0x12, 0xff, 0x18, 0x0e, 0x12, 0xff, 0x13, 0x09, 0x0d, 0xff, 0x12, 0x06, 0x0c, 0xff, 0x1b, 0x0d, 0x12, 0xff, 0x37, 0x2f, 0x1b, 0xff, 0x3c, 0x2d, 0x1e, 0xff, 0x41, 0x10, 0x39, 0xff, 0x94, 0x66, 0x90, 0xff, 0xcc, 0xb7, 0xc9, 0xff, 0xde, 0xdd, 0xdc, 0xff, 0xeb, 0xef, 0xec, 0xff, 0xf2, 0xf6, 0xf3, 0xff, 0xf6, 0xf9, 0xf6, 0xff, 0xf8, 0xfc, 0xf9, 0xff, 0xf8, 0xfe, 0xf8, 0xff, 0xf9, 0xfd, 0xfa, 0xff, 0xf8, 0xfc, 0xfb, 0xff, 0xf5, 0xfb, 0xfa, 0xff, 0xf2, 0xfb, 0xfa, 0xff, 0xec, 0xf9, 0xf7, 0xff, 0xe7, 0xf6, 0xf4, 0xff, 0xe1, 0xf0, 0xef, 0xff, 0xd8, 0xe8, 0xe6, 0xff, 0xd0, 0xdb, 0xdc, 0xff, 0xc0, 0xc8, 0xd5, 0xcc, 0xa2, 0xac, 0xc3, 0x4d, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x91, 0x8d, 0x41, 0xb6, 0xae, 0xae, 0xb4, 0x00, 0x00, 0x00, 0xfe, 0x01, 0x00, 0x00, 0xff, 0x09, 0x05, 0x04, 0xff, 0x14, 0x0f, 0x0e, 0xff, 0x21, 0x19, 0x19, 0xff, 0x18, 0x0f, 0x0f, 0xff, 0x17, 0x0c, 0x0c, 0xff, 0x16, 0x0e, 0x0d, 0xff, 0x08, 0x07, 0x05, 0xff, 0x07, 0x06, 0x04, 0xff, 0x0b, 0x06, 0x05, 0xff, 0x0b, 0x06, 0x05, 0xff, 0x0c, 0x07, 0x06, 0xff, 0x0d, 0x08, 0x07, 0xff, 0x0b, 0x06, 0x06, 0xff, 0x0b, 0x06, 0x05, 0xff, 0x0d, 0x0a, 0x09, 0xff, 0x0c, 0x09, 0x09, 0xff, 0x07, 0x06, 0x04, 0xff, 0x08, 0x06, 0x05, 0xff, 0x09, 0x07, 0x06, 0xff, 0x09, 0x07, 0x06, 0xff, 0x09, 0x07, 0x06, 0xff, 0x0d, 0x0a, 0x06, 0xff, 0x0d, 0x0a, 0x06, 0xff, 0x0e, 0x0c, 0x07, 0xff, 0x13, 0x10, 0x0c, 0xff, 0x16, 0x10, 0x12, 0xff, 0x11, 0x0f, 0x0f, 0xff, 0x0f, 0x0e, 0x09, 0xff, 0x15, 0x11, 0x05, 0xff, 0x18, 0x0e, 0x05, 0xff, 0x35, 0x26, 0x21, 0xff, 0x4b, 0x2a, 0x3c, 0xff, 0x79, 0x47, 0x73, 0xff, 0xbf, 0x96, 0xbb, 0xff, 0xd5, 0xc5, 0xd1, 0xff, 0xe5, 0xe7, 0xe4, 0xff, 0xf0, 0xf2, 0xee, 0xff, 0xf6, 0xf5, 0xf5, 0xff, 0xfa, 0xfa, 0xf9, 0xff, 0xfb, 0xfe, 0xfa, 0xff, 0xfa, 0xfe, 0xf9, 0xff, 0xf9, 0xfd, 0xfa, 0xff, 0xf7, 0xfc, 0xfb, 0xff, 0xf5, 0xfb, 0xfa, 0xff, 0xf1, 0xfb, 0xfb, 0xff, 0xed, 0xfa, 0xf9, 0xff, 0xe7, 0xf6, 0xf3, 0xff, 0xe0, 0xed, 0xeb, 0xfe, 0xd8, 0xe5, 0xe5, 0xb4, 0xc8, 0xd7, 0xd7, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x10, 0x0b, 0x09, 0x88, 0x0d, 0x05, 0x05, 0xe6, 0x10, 0x09, 0x09, 0xff, 0x12, 0x0a, 0x0a, 0xff, 0x11, 0x09, 0x09, 0xff, 0x14, 0x0d, 0x0d, 0xff, 0x13, 0x0d, 0x0d, 0xff, 0x08, 0x05, 0x04, 0xff, 0x08, 0x05, 0x04, 0xff, 0x0d, 0x07, 0x07, 0xff, 0x0b, 0x05, 0x06, 0xff, 0x0c, 0x06, 0x06, 0xff, 0x0c, 0x06, 0x06, 0xff, 0x0b, 0x06, 0x06, 0xff, 0x0b, 0x07, 0x07, 0xff, 0x0a, 0x07, 0x07, 0xff, 0x08, 0x06, 0x05, 0xff, 0x06, 0x05, 0x04, 0xff, 0x0a, 0x09, 0x07, 0xff, 0x0d, 0x0b, 0x0a, 0xff, 0x0b, 0x0a, 0x09, 0xff, 0x09, 0x06, 0x05, 0xff, 0x0b, 0x08, 0x04, 0xff, 0x0b, 0x08, 0x04, 0xff, 0x0c, 0x09, 0x05, 0xff, 0x0e, 0x0a, 0x06, 0xff, 0x0a, 0x0a, 0x0b, 0xff, 0x08, 0x0b, 0x0b, 0xff, 0x0b, 0x0e, 0x06, 0xff, 0x16, 0x18, 0x03, 0xff, 0x2a, 0x21, 0x11, 0xff, 0x36, 0x14, 0x2c, 0xff, 0x47, 0x16, 0x49, 0xff, 0x92, 0x69, 0x92, 0xff, 0xcb, 0xb1, 0xc9, 0xff, 0xdd, 0xd5, 0xdc, 0xff, 0xe8, 0xec, 0xe9, 0xff, 0xf2, 0xf3, 0xf1, 0xff, 0xf9, 0xf6, 0xf6, 0xff, 0xfc, 0xfa, 0xfa, 0xff, 0xfc, 0xfd, 0xfb, 0xff, 0xfb, 0xfe, 0xfa, 0xff, 0xfa, 0xfd, 0xfb, 0xff, 0xf7, 0xfc, 0xfb, 0xff, 0xf4, 0xfa, 0xf9, 0xff, 0xf0, 0xf9, 0xf9, 0xff, 0xed, 0xf9, 0xf8, 0xe7, 0xe6, 0xf5, 0xf1, 0x88, 0xda, 0xe9, 0xe9, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x14, 0x0a, 0x0a, 0x4a, 0x11, 0x09, 0x09, 0xa0, 0x12, 0x0b, 0x0b, 0xef, 0x15, 0x10, 0x10, 0xff, 0x11, 0x0e, 0x0d, 0xff, 0x0a, 0x09, 0x09, 0xff, 0x0b, 0x06, 0x05, 0xff, 0x0f, 0x07, 0x07, 0xff, 0x0e, 0x08, 0x0a, 0xff, 0x0e, 0x08, 0x0a, 0xff, 0x0d, 0x07, 0x09, 0xff, 0x0d, 0x06, 0x08, 0xff, 0x0c, 0x06, 0x08, 0xff, 0x08, 0x05, 0x06, 0xff, 0x08, 0x07, 0x07, 0xff, 0x09, 0x08, 0x08, 0xff, 0x09, 0x07, 0x06, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x09, 0x07, 0x07, 0xff, 0x08, 0x05, 0x04, 0xff, 0x0a, 0x07, 0x03, 0xff, 0x0a, 0x08, 0x03, 0xff, 0x0b, 0x08, 0x03, 0xff, 0x0a, 0x08, 0x03, 0xff, 0x04, 0x06, 0x05, 0xff, 0x05, 0x09, 0x0b, 0xff, 0x0a, 0x0a, 0x07, 0xff, 0x10, 0x0c, 0x00, 0xff, 0x1e, 0x10, 0x0a, 0xff, 0x29, 0x00, 0x1d, 0xff, 0x69, 0x2f, 0x68, 0xff, 0xb5, 0x92, 0xba, 0xff, 0xd3, 0xc5, 0xd5, 0xff, 0xe2, 0xe2, 0xe4, 0xff, 0xe9, 0xf0, 0xed, 0xff, 0xf6, 0xf5, 0xf5, 0xff, 0xfb, 0xf6, 0xf8, 0xff, 0xfd, 0xfa, 0xfb, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xfd, 0xfd, 0xfb, 0xff, 0xfa, 0xfd, 0xfb, 0xff, 0xf7, 0xfb, 0xfa, 0xef, 0xf3, 0xfa, 0xf8, 0xa0, 0xed, 0xf8, 0xf8, 0x4a, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x07, 0x15, 0x12, 0x0e, 0x46, 0x0a, 0x08, 0x05, 0x8e, 0x0d, 0x08, 0x05, 0xd7, 0x0f, 0x09, 0x06, 0xff, 0x11, 0x09, 0x08, 0xff, 0x11, 0x09, 0x0a, 0xff, 0x11, 0x0a, 0x0a, 0xff, 0x10, 0x0a, 0x0a, 0xff, 0x0e, 0x09, 0x08, 0xff, 0x0e, 0x09, 0x07, 0xff, 0x0e, 0x0b, 0x09, 0xff, 0x0c, 0x09, 0x09, 0xff, 0x09, 0x08, 0x08, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x09, 0x07, 0x06, 0xff, 0x0a, 0x07, 0x06, 0xff, 0x0b, 0x08, 0x04, 0xff, 0x0b, 0x08, 0x04, 0xff, 0x0b, 0x08, 0x05, 0xff, 0x0b, 0x07, 0x05, 0xff, 0x07, 0x08, 0x06, 0xff, 0x0a, 0x07, 0x05, 0xff, 0x0d, 0x05, 0x04, 0xff, 0x08, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0xff, 0x3e, 0x11, 0x38, 0xff, 0xa6, 0x73, 0xa8, 0xff, 0xcd, 0xb6, 0xd0, 0xff, 0xdf, 0xda, 0xe1, 0xff, 0xe7, 0xeb, 0xe9, 0xff, 0xed, 0xf6, 0xee, 0xff, 0xf7, 0xf8, 0xf8, 0xff, 0xfd, 0xf7, 0xfb, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xfb, 0xfc, 0xfd, 0xd7, 0xfb, 0xfd, 0xfd, 0x8e, 0xfb, 0xff, 0xfb, 0x46, 0xfe, 0xfe, 0xfe, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x09, 0x09, 0x1b, 0x0f, 0x09, 0x06, 0x55, 0x0e, 0x05, 0x05, 0x8f, 0x0e, 0x06, 0x06, 0xc2, 0x0e, 0x07, 0x06, 0xea, 0x0c, 0x07, 0x06, 0xff, 0x0c, 0x08, 0x03, 0xff, 0x0e, 0x0a, 0x07, 0xff, 0x0c, 0x09, 0x08, 0xff, 0x09, 0x08, 0x07, 0xff, 0x09, 0x07, 0x06, 0xff, 0x09, 0x07, 0x06, 0xff, 0x08, 0x06, 0x05, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x0b, 0x08, 0x04, 0xff, 0x0b, 0x07, 0x05, 0xff, 0x0b, 0x07, 0x06, 0xff, 0x0b, 0x07, 0x07, 0xff, 0x0a, 0x05, 0x04, 0xff, 0x0e, 0x01, 0x00, 0xff, 0x14, 0x01, 0x02, 0xff, 0x08, 0x00, 0x02, 0xff, 0x2d, 0x0c, 0x2b, 0xff, 0x92, 0x69, 0x93, 0xff, 0xca, 0xaa, 0xcb, 0xff, 0xdc, 0xcf, 0xd9, 0xff, 0xe8, 0xe6, 0xe7, 0xff, 0xed, 0xf3, 0xec, 0xea, 0xf0, 0xf9, 0xef, 0xc2, 0xf6, 0xf9, 0xf6, 0x8f, 0xff, 0xf9, 0xff, 0x55, 0xff, 0xf5, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x11, 0x09, 0x04, 0x00, 0x37, 0x0a, 0x08, 0x05, 0x5f, 0x0b, 0x07, 0x07, 0x86, 0x09, 0x07, 0x07, 0xa8, 0x07, 0x06, 0x05, 0xc0, 0x08, 0x07, 0x06, 0xd3, 0x06, 0x05, 0x04, 0xe6, 0x07, 0x05, 0x03, 0xee, 0x09, 0x06, 0x02, 0xf5, 0x09, 0x06, 0x03, 0xff, 0x09, 0x05, 0x04, 0xff, 0x08, 0x04, 0x04, 0xf5, 0x0d, 0x04, 0x00, 0xee, 0x15, 0x01, 0x00, 0xe6, 0x1a, 0x00, 0x09, 0xd3, 0x39, 0x0d, 0x3a, 0xc0, 0x87, 0x56, 0x96, 0xa8, 0xc2, 0x9d, 0xc0, 0x86, 0xdc, 0xc6, 0xcc, 0x5f, 0xe7, 0xd9, 0xde, 0x37, 0xf0, 0xf0, 0xf0, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const lv_image_dsc_t img_multilang_avatar_12 = {
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .header.w = 128,
+    .header.h = 128,
+    .header.stride = 512,
+    .data = img_multilang_avatar_12_map,
+    .data_size = sizeof(img_multilang_avatar_12_map),
+};
+
+#endif
@@ -0,0 +1,166 @@
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+#if LV_USE_DEMO_MULTILANG
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_13
+    #define LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_13
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_13 uint8_t
+img_multilang_avatar_13_map[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xb4, 0xb4, 0x11, 0xab, 0xb0, 0xb0, 0x37, 0xa8, 0xb0, 0xad, 0x5e, 0xa9, 0xaf, 0xa9, 0x86, 0xab, 0xae, 0xa3, 0xa8, 0xa5, 0xad, 0xa1, 0xbf, 0x9d, 0xa8, 0xac, 0xd2, 0x99, 0xa8, 0xb5, 0xe5, 0x9b, 0xae, 0xb9, 0xee, 0x9d, 0xaf, 0xb1, 0xf2, 0xa3, 0xaf, 0xb1, 0xff, 0xa4, 0xb0, 0xb4, 0xff, 0xa3, 0xaf, 0xb4, 0xf2, 0xa0, 0xac, 0xae, 0xee, 0xa1, 0xac, 0xac, 0xe5, 0xa1, 0xac, 0xab, 0xd2, 0xa1, 0xa9, 0xa9, 0xbf, 0xa6, 0xab, 0xa8, 0xa8, 0xa7, 0xab, 0xa3, 0x86, 0xa8, 0xaa, 0xa8, 0x5e, 0xab, 0xb0, 0xab, 0x37, 0xa5, 0xb4, 0xa5, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0xad, 0xad, 0x19, 0xab, 0xae, 0xae, 0x55, 0xa9, 0xae, 0xae, 0x8f, 0xaa, 0xb1, 0xae, 0xc1, 0xa8, 0xaf, 0xac, 0xe9, 0xa9, 0xae, 0xae, 0xff, 0xa7, 0xaf, 0xaf, 0xff, 0xa6, 0xae, 0xae, 0xff, 0xa8, 0xad, 0xab, 0xff, 0xab, 0xad, 0xa6, 0xff, 0xa7, 0xae, 0xa5, 0xff, 0x9d, 0xa7, 0xa8, 0xff, 0x8d, 0x9a, 0xa7, 0xff, 0x97, 0xa9, 0xb1, 0xff, 0xa0, 0xb3, 0xb2, 0xff, 0xa7, 0xb0, 0xb3, 0xff, 0xa6, 0xb0, 0xb4, 0xff, 0xa5, 0xb1, 0xb5, 0xff, 0xa2, 0xaf, 0xb2, 0xff, 0xa3, 0xae, 0xaf, 0xff, 0xa5, 0xaf, 0xad, 0xff, 0x9d, 0xa6, 0xa6, 0xff, 0xa5, 0xab, 0xa7, 0xff, 0xa9, 0xad, 0xa6, 0xff, 0xa7, 0xab, 0xa6, 0xff, 0xa8, 0xac, 0xa7, 0xff, 0xa9, 0xac, 0xaa, 0xff, 0xa8, 0xaa, 0xa9, 0xe9, 0xa6, 0xaa, 0xa7, 0xc1, 0xa5, 0xac, 0xa7, 0x8f, 0xa8, 0xab, 0xa8, 0x55, 0xa3, 0xad, 0xa3, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb6, 0xb6, 0x07, 0xae, 0xb2, 0xae, 0x46, 0xae, 0xb1, 0xac, 0x8e, 0xb0, 0xb5, 0xaf, 0xd7, 0xae, 0xb2, 0xb2, 0xff, 0xaa, 0xb0, 0xb1, 0xff, 0xad, 0xb2, 0xb0, 0xff, 0xae, 0xb4, 0xad, 0xff, 0xa7, 0xac, 0xaa, 0xff, 0xa7, 0xab, 0xaf, 0xff, 0xaa, 0xb1, 0xb4, 0xff, 0xa6, 0xae, 0xb1, 0xff, 0xa5, 0xab, 0xac, 0xff, 0xa8, 0xab, 0xaa, 0xff, 0xa7, 0xac, 0xa6, 0xff, 0xa1, 0xaa, 0xaa, 0xff, 0x91, 0x9b, 0xa5, 0xff, 0x96, 0xa3, 0xa7, 0xff, 0xa3, 0xb2, 0xaf, 0xff, 0xa6, 0xb1, 0xb2, 0xff, 0xa5, 0xaf, 0xb4, 0xff, 0xa2, 0xae, 0xb2, 0xff, 0xa2, 0xaf, 0xb1, 0xff, 0xa6, 0xb0, 0xb1, 0xff, 0xa8, 0xb1, 0xaf, 0xff, 0xa6, 0xae, 0xae, 0xff, 0xa9, 0xad, 0xaa, 0xff, 0xa9, 0xac, 0xa6, 0xff, 0xa9, 0xae, 0xa8, 0xff, 0xac, 0xb0, 0xab, 0xff, 0xaa, 0xad, 0xa9, 0xff, 0xa6, 0xaa, 0xa6, 0xff, 0xa2, 0xa8, 0xa3, 0xff, 0xa3, 0xa9, 0xa4, 0xff, 0xa6, 0xaa, 0xa5, 0xff, 0xa6, 0xaa, 0xa4, 0xff, 0xa7, 0xa9, 0xa3, 0xd7, 0xa5, 0xa8, 0xa1, 0x8e, 0xa7, 0xa7, 0xa0, 0x46, 0xb6, 0xb6, 0x91, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x99, 0x99, 0x05, 0x8a, 0x9f, 0xad, 0x48, 0x90, 0xa1, 0xa8, 0x9f, 0x9c, 0xa9, 0xad, 0xef, 0xa4, 0xae, 0xb2, 0xff, 0xad, 0xb3, 0xb0, 0xff, 0xb1, 0xb8, 0xb3, 0xff, 0xaa, 0xb2, 0xb6, 0xff, 0xa6, 0xaf, 0xb5, 0xff, 0xac, 0xb3, 0xb4, 0xff, 0xb0, 0xb4, 0xae, 0xff, 0xac, 0xb1, 0xae, 0xff, 0xac, 0xb3, 0xb5, 0xff, 0xad, 0xb5, 0xb9, 0xff, 0xa5, 0xad, 0xb2, 0xff, 0xa5, 0xab, 0xac, 0xff, 0xaa, 0xad, 0xad, 0xff, 0xa6, 0xac, 0xa7, 0xff, 0xa6, 0xac, 0xab, 0xff, 0xa1, 0xa7, 0xad, 0xff, 0x9e, 0xa8, 0xa8, 0xff, 0xa6, 0xb1, 0xac, 0xff, 0xa8, 0xb1, 0xb2, 0xff, 0xa5, 0xaf, 0xb4, 0xff, 0x9f, 0xab, 0xaf, 0xff, 0xa0, 0xab, 0xae, 0xff, 0xa2, 0xab, 0xac, 0xff, 0xa6, 0xae, 0xac, 0xff, 0xa9, 0xb0, 0xaf, 0xff, 0xab, 0xaf, 0xac, 0xff, 0xa9, 0xac, 0xa7, 0xff, 0xaa, 0xae, 0xa9, 0xff, 0xad, 0xb1, 0xac, 0xff, 0xa9, 0xad, 0xa8, 0xff, 0xa4, 0xa9, 0xa3, 0xff, 0x9f, 0xa4, 0x9e, 0xff, 0xa1, 0xa6, 0xa1, 0xff, 0xa4, 0xa8, 0xa3, 0xff, 0xa6, 0xa9, 0xa4, 0xff, 0xa8, 0xa9, 0xa3, 0xff, 0xa6, 0xa8, 0xa2, 0xff, 0xa6, 0xa8, 0xa2, 0xff, 0xa4, 0xa7, 0xa2, 0xef, 0xa3, 0xa8, 0xa5, 0x9f, 0xa2, 0xa6, 0xa6, 0x48, 0x99, 0x99, 0x99, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xae, 0xa7, 0x23, 0x85, 0x98, 0xaf, 0x86, 0x73, 0x8c, 0xaa, 0xe5, 0x82, 0x96, 0xa8, 0xff, 0x92, 0xa2, 0xab, 0xff, 0x95, 0xa1, 0xa2, 0xff, 0xa3, 0xab, 0xab, 0xff, 0xaf, 0xb7, 0xb5, 0xff, 0xa6, 0xb1, 0xb4, 0xff, 0x9a, 0xa6, 0xb1, 0xff, 0x9e, 0xab, 0xb7, 0xff, 0xa9, 0xb4, 0xba, 0xff, 0xaf, 0xb4, 0xaf, 0xff, 0xab, 0xb3, 0xad, 0xff, 0xa6, 0xaf, 0xae, 0xff, 0xa9, 0xb3, 0xb4, 0xff, 0xaa, 0xb4, 0xb5, 0xff, 0xa9, 0xb1, 0xb1, 0xff, 0xa9, 0xae, 0xac, 0xff, 0xa6, 0xad, 0xa6, 0xff, 0xa5, 0xaa, 0xa9, 0xff, 0xa7, 0xa9, 0xaf, 0xff, 0xa9, 0xaf, 0xad, 0xff, 0xa9, 0xb3, 0xab, 0xff, 0xa9, 0xaf, 0xb1, 0xff, 0xa6, 0xaf, 0xb5, 0xff, 0xa2, 0xae, 0xb3, 0xff, 0xa1, 0xa9, 0xae, 0xff, 0x9f, 0xa7, 0xa9, 0xff, 0xa8, 0xaf, 0xad, 0xff, 0xa8, 0xae, 0xae, 0xff, 0xa8, 0xac, 0xaa, 0xff, 0xa6, 0xa8, 0xa7, 0xff, 0xa8, 0xac, 0xa9, 0xff, 0xaa, 0xaf, 0xa9, 0xff, 0xa7, 0xab, 0xa5, 0xff, 0xa3, 0xa7, 0xa0, 0xff, 0x9d, 0xa1, 0x9b, 0xff, 0xa2, 0xa6, 0xa1, 0xff, 0xa8, 0xa9, 0xa6, 0xff, 0xa8, 0xa9, 0xa4, 0xff, 0xa8, 0xa8, 0xa2, 0xff, 0xa8, 0xa8, 0xa2, 0xff, 0xa3, 0xa5, 0xa0, 0xff, 0xa1, 0xa4, 0xa0, 0xff, 0xa6, 0xa9, 0xa4, 0xff, 0xa4, 0xa8, 0xa3, 0xff, 0xa3, 0xaa, 0xa3, 0xe5, 0xa5, 0xad, 0xa7, 0x86, 0xa7, 0xae, 0xa7, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0xb0, 0xac, 0x41, 0xa2, 0xa8, 0xa7, 0xb4, 0xa9, 0xb0, 0xad, 0xfe, 0x99, 0xa9, 0xbc, 0xff, 0x83, 0x97, 0xb1, 0xff, 0x92, 0xa0, 0xaa, 0xff, 0x9f, 0xa8, 0xa9, 0xff, 0xa2, 0xa9, 0xa2, 0xff, 0xb0, 0xaf, 0xa6, 0xff, 0xae, 0xb5, 0xb2, 0xff, 0x9d, 0xab, 0xb3, 0xff, 0x8d, 0x9e, 0xad, 0xff, 0x99, 0xaa, 0xbb, 0xff, 0xa7, 0xb5, 0xbd, 0xff, 0xad, 0xb5, 0xb3, 0xff, 0xa9, 0xb2, 0xac, 0xff, 0xa3, 0xae, 0xa9, 0xff, 0x9c, 0xa8, 0xa7, 0xff, 0x9d, 0xa8, 0xa8, 0xff, 0xb3, 0xbb, 0xbb, 0xff, 0xb0, 0xb6, 0xb5, 0xff, 0xac, 0xb2, 0xac, 0xff, 0xa9, 0xae, 0xac, 0xff, 0xac, 0xb0, 0xb2, 0xff, 0xb2, 0xb7, 0xb3, 0xff, 0xb0, 0xb7, 0xaf, 0xff, 0xa8, 0xad, 0xae, 0xff, 0xa5, 0xae, 0xb3, 0xff, 0xa3, 0xb0, 0xb3, 0xff, 0xa0, 0xa9, 0xac, 0xff, 0xa1, 0xa8, 0xa8, 0xff, 0xa5, 0xac, 0xaa, 0xff, 0xa6, 0xab, 0xa9, 0xff, 0xa6, 0xa9, 0xa8, 0xff, 0xa3, 0xa5, 0xa4, 0xff, 0xa8, 0xaa, 0xa7, 0xff, 0xab, 0xae, 0xa8, 0xff, 0xa7, 0xab, 0xa5, 0xff, 0xa1, 0xa6, 0x9f, 0xff, 0x9c, 0xa1, 0x9d, 0xff, 0xa3, 0xa5, 0xa3, 0xff, 0xa9, 0xa9, 0xa7, 0xff, 0xa5, 0xa8, 0xa4, 0xff, 0xa6, 0xa8, 0xa3, 0xff, 0xa9, 0xa8, 0xa3, 0xff, 0xa3, 0xa5, 0xa2, 0xff, 0x9f, 0xa4, 0xa1, 0xff, 0xa6, 0xa8, 0xa3, 0xff, 0xa7, 0xaa, 0xa3, 0xff, 0xa7, 0xac, 0xa6, 0xff, 0xa7, 0xaf, 0xa8, 0xff, 0xa6, 0xab, 0xa6, 0xfe, 0xa2, 0xa4, 0xa0, 0xb4, 0xa4, 0xa4, 0xa0, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xb1, 0xb5, 0x4c, 0xb1, 0xb3, 0xb2, 0xcb, 0xae, 0xb2, 0xab, 0xff, 0xa4, 0xad, 0xa9, 0xff, 0xa0, 0xaa, 0xb1, 0xff, 0x7d, 0x9b, 0xbc, 0xff, 0x70, 0x90, 0xae, 0xff, 0x8e, 0x9b, 0xa0, 0xff, 0xa1, 0xa4, 0x9c, 0xff, 0xa4, 0xa9, 0xa3, 0xff, 0xa8, 0xaf, 0xb4, 0xff, 0xae, 0xb6, 0xb9, 0xff, 0x99, 0xa3, 0xa7, 0xff, 0x79, 0x87, 0x95, 0xff, 0x7b, 0x8b, 0x9f, 0xff, 0x86, 0x97, 0xa6, 0xff, 0x87, 0x97, 0xa2, 0xff, 0x9c, 0xa7, 0xa8, 0xff, 0xa4, 0xad, 0xac, 0xff, 0x91, 0x99, 0x9c, 0xff, 0x97, 0xa1, 0xa4, 0xff, 0x85, 0x8d, 0x94, 0xff, 0x72, 0x78, 0x82, 0xff, 0x7d, 0x83, 0x86, 0xff, 0xa6, 0xab, 0xaa, 0xff, 0x9b, 0xa3, 0xa2, 0xff, 0x7c, 0x85, 0x84, 0xff, 0x95, 0x9e, 0x9d, 0xff, 0xad, 0xb6, 0xb6, 0xff, 0xa5, 0xb2, 0xb0, 0xff, 0xa4, 0xb2, 0xb0, 0xff, 0xa2, 0xab, 0xab, 0xff, 0xa0, 0xa6, 0xa6, 0xff, 0xa3, 0xa7, 0xa6, 0xff, 0xa9, 0xaa, 0xa6, 0xff, 0xa3, 0xa9, 0xab, 0xff, 0xa4, 0xa8, 0xa7, 0xff, 0xb0, 0xac, 0xa0, 0xff, 0xac, 0xac, 0xa3, 0xff, 0xa2, 0xa8, 0xa8, 0xff, 0x9f, 0xa5, 0xa3, 0xff, 0x98, 0xa1, 0xa4, 0xff, 0xa0, 0xa4, 0xa8, 0xff, 0xaa, 0xaa, 0xa7, 0xff, 0x9c, 0xa6, 0xa5, 0xff, 0x92, 0xa2, 0x9e, 0xff, 0xa6, 0xa3, 0x93, 0xff, 0xa4, 0x9f, 0x92, 0xff, 0x9b, 0x9e, 0x95, 0xff, 0xa7, 0xa6, 0x98, 0xff, 0xaf, 0xac, 0x9d, 0xff, 0xae, 0xad, 0xa2, 0xff, 0xa9, 0xac, 0xaa, 0xff, 0xa5, 0xaa, 0xa7, 0xff, 0xa2, 0xa6, 0xa1, 0xff, 0xa2, 0xa8, 0xa7, 0xff, 0xa2, 0xa9, 0xa8, 0xcb, 0xa5, 0xa8, 0xa5, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xae, 0xb9, 0x46, 0xa3, 0xb2, 0xb5, 0xc9, 0xab, 0xb3, 0xb4, 0xff, 0xb0, 0xb3, 0xb3, 0xff, 0xab, 0xb0, 0xab, 0xff, 0xa5, 0xb0, 0xaf, 0xff, 0x96, 0xa6, 0xb5, 0xff, 0x73, 0x91, 0xb4, 0xff, 0x73, 0x90, 0xab, 0xff, 0x90, 0x9d, 0xa0, 0xff, 0x9f, 0xa4, 0x9b, 0xff, 0x9f, 0xa5, 0x9f, 0xff, 0xa3, 0xad, 0xb2, 0xff, 0xa4, 0xac, 0xb0, 0xff, 0x7b, 0x83, 0x87, 0xff, 0x46, 0x4f, 0x5d, 0xff, 0x36, 0x40, 0x52, 0xff, 0x4a, 0x55, 0x65, 0xff, 0x6f, 0x79, 0x86, 0xff, 0x9a, 0xa0, 0xa6, 0xff, 0x7d, 0x81, 0x86, 0xff, 0x5c, 0x60, 0x67, 0xff, 0x5b, 0x5f, 0x67, 0xff, 0x51, 0x55, 0x5f, 0xff, 0x47, 0x4a, 0x58, 0xff, 0x4f, 0x53, 0x5b, 0xff, 0x70, 0x75, 0x79, 0xff, 0x81, 0x85, 0x8a, 0xff, 0x5f, 0x66, 0x6b, 0xff, 0x60, 0x67, 0x6c, 0xff, 0x97, 0x9e, 0xa3, 0xff, 0xae, 0xb8, 0xb9, 0xff, 0xab, 0xb7, 0xb8, 0xff, 0x97, 0x9f, 0xa4, 0xff, 0x68, 0x70, 0x75, 0xff, 0x9c, 0xa2, 0xa5, 0xff, 0xab, 0xb1, 0xb0, 0xff, 0x9f, 0xa9, 0xaa, 0xff, 0xa1, 0xa9, 0xa4, 0xff, 0xab, 0xaa, 0x9c, 0xff, 0xa6, 0xa9, 0xa2, 0xff, 0xa0, 0xa8, 0xa8, 0xff, 0xa0, 0xa7, 0xa5, 0xff, 0x9d, 0xa4, 0x9d, 0xff, 0xa6, 0xa6, 0x9d, 0xff, 0xac, 0xa6, 0x97, 0xff, 0x9a, 0x9d, 0x8b, 0xff, 0x92, 0x97, 0x81, 0xff, 0xa0, 0x95, 0x73, 0xff, 0xa0, 0x95, 0x77, 0xff, 0x9d, 0x9a, 0x81, 0xff, 0xa3, 0x9a, 0x80, 0xff, 0xa2, 0x99, 0x80, 0xff, 0xa9, 0xa3, 0x92, 0xff, 0xad, 0xae, 0xa6, 0xff, 0xa8, 0xac, 0xa5, 0xff, 0xa5, 0xa9, 0xa4, 0xff, 0xa1, 0xa6, 0xa4, 0xff, 0x9f, 0xa5, 0xa1, 0xff, 0xa6, 0xa9, 0xa2, 0xff, 0xac, 0xaa, 0x9e, 0xc9, 0xab, 0xa7, 0x9c, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xb1, 0xb1, 0x24, 0xa5, 0xb1, 0xb3, 0xb4, 0x9f, 0xad, 0xb6, 0xff, 0xa2, 0xaf, 0xb0, 0xff, 0xab, 0xb0, 0xb1, 0xff, 0xad, 0xaf, 0xb3, 0xff, 0xa6, 0xad, 0xaa, 0xff, 0xa0, 0xae, 0xb2, 0xff, 0x8d, 0xa0, 0xb8, 0xff, 0x76, 0x8e, 0xab, 0xff, 0x88, 0x9d, 0xaf, 0xff, 0xa8, 0xb3, 0xb6, 0xff, 0xa7, 0xac, 0xa7, 0xff, 0xaa, 0xaf, 0xab, 0xff, 0xa2, 0xa8, 0xab, 0xff, 0x85, 0x8c, 0x91, 0xff, 0x59, 0x5f, 0x66, 0xff, 0x3a, 0x3e, 0x4c, 0xff, 0x34, 0x35, 0x46, 0xff, 0x37, 0x38, 0x46, 0xff, 0x49, 0x4a, 0x55, 0xff, 0x5e, 0x5f, 0x69, 0xff, 0x3e, 0x3f, 0x48, 0xff, 0x2d, 0x2d, 0x38, 0xff, 0x34, 0x33, 0x40, 0xff, 0x35, 0x35, 0x42, 0xff, 0x3f, 0x3f, 0x4e, 0xff, 0x3c, 0x3d, 0x49, 0xff, 0x38, 0x39, 0x43, 0xff, 0x43, 0x44, 0x4e, 0xff, 0x45, 0x47, 0x51, 0xff, 0x45, 0x4a, 0x53, 0xff, 0x62, 0x67, 0x71, 0xff, 0xab, 0xb1, 0xb8, 0xff, 0x9a, 0xa1, 0xa8, 0xff, 0x54, 0x5a, 0x64, 0xff, 0x44, 0x4c, 0x56, 0xff, 0x97, 0xa2, 0xa8, 0xff, 0xa7, 0xb4, 0xb8, 0xff, 0x9e, 0xac, 0xac, 0xff, 0x9d, 0xa6, 0xa2, 0xff, 0x9f, 0xa4, 0x9b, 0xff, 0x9f, 0xa7, 0xa2, 0xff, 0xa0, 0xa8, 0xa7, 0xff, 0xa4, 0xa7, 0xa3, 0xff, 0xa5, 0xa2, 0x8d, 0xff, 0xa1, 0x98, 0x7a, 0xff, 0xa4, 0x97, 0x76, 0xff, 0xa2, 0x96, 0x68, 0xff, 0xa5, 0x99, 0x63, 0xff, 0xa7, 0x91, 0x5b, 0xff, 0xa3, 0x91, 0x62, 0xff, 0xa7, 0x9a, 0x6f, 0xff, 0xa8, 0x98, 0x6c, 0xff, 0xa0, 0x93, 0x6d, 0xff, 0x9f, 0x97, 0x7d, 0xff, 0xab, 0xaa, 0x98, 0xff, 0xac, 0xaf, 0xa7, 0xff, 0xa5, 0xa8, 0xa4, 0xff, 0xa2, 0xa5, 0x9f, 0xff, 0xa4, 0xa5, 0x9e, 0xff, 0xaa, 0xa9, 0x9f, 0xff, 0xac, 0xab, 0xa0, 0xff, 0xad, 0xa9, 0x9f, 0xff, 0xae, 0xa9, 0x9d, 0xb5, 0xb1, 0xaa, 0x9b, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x09, 0xa6, 0xab, 0xaa, 0x87, 0xa6, 0xaf, 0xab, 0xf9, 0xaa, 0xb3, 0xb4, 0xff, 0xa4, 0xb0, 0xb6, 0xff, 0xa5, 0xb1, 0xb0, 0xff, 0xab, 0xb0, 0xb1, 0xff, 0xad, 0xae, 0xb2, 0xff, 0xa7, 0xac, 0xaa, 0xff, 0x99, 0xa6, 0xab, 0xff, 0x8d, 0xa0, 0xb9, 0xff, 0x6a, 0x7b, 0x91, 0xff, 0x5d, 0x68, 0x74, 0xff, 0x89, 0x91, 0x97, 0xff, 0x8b, 0x90, 0x90, 0xff, 0x7a, 0x7e, 0x7e, 0xff, 0x74, 0x78, 0x7c, 0xff, 0x53, 0x56, 0x5e, 0xff, 0x43, 0x45, 0x4f, 0xff, 0x3b, 0x3c, 0x47, 0xff, 0x44, 0x41, 0x4e, 0xff, 0x3b, 0x38, 0x44, 0xff, 0x39, 0x38, 0x42, 0xff, 0x34, 0x34, 0x3f, 0xff, 0x27, 0x26, 0x33, 0xff, 0x1d, 0x1d, 0x29, 0xff, 0x33, 0x32, 0x3f, 0xff, 0x38, 0x37, 0x45, 0xff, 0x2d, 0x2d, 0x3b, 0xff, 0x30, 0x30, 0x3d, 0xff, 0x2a, 0x2a, 0x36, 0xff, 0x28, 0x29, 0x35, 0xff, 0x30, 0x32, 0x3d, 0xff, 0x2d, 0x2f, 0x3a, 0xff, 0x35, 0x39, 0x44, 0xff, 0x60, 0x62, 0x6d, 0xff, 0x52, 0x53, 0x5e, 0xff, 0x2e, 0x30, 0x3e, 0xff, 0x34, 0x38, 0x46, 0xff, 0x69, 0x72, 0x7c, 0xff, 0x87, 0x95, 0x9a, 0xff, 0x7a, 0x87, 0x8a, 0xff, 0x9f, 0xa7, 0xa5, 0xff, 0x9c, 0xa1, 0x9d, 0xff, 0x9c, 0xa6, 0xa5, 0xff, 0xa4, 0xaa, 0xa7, 0xff, 0xaa, 0xa7, 0x99, 0xff, 0xa2, 0x96, 0x73, 0xff, 0x95, 0x85, 0x59, 0xff, 0x9e, 0x8b, 0x5d, 0xff, 0xa5, 0x8f, 0x4c, 0xff, 0xa7, 0x8f, 0x42, 0xff, 0xa1, 0x88, 0x47, 0xff, 0x95, 0x81, 0x4b, 0xff, 0x99, 0x88, 0x52, 0xff, 0x9e, 0x8b, 0x56, 0xff, 0xa7, 0x97, 0x6a, 0xff, 0xa4, 0x9a, 0x79, 0xff, 0xa8, 0xa4, 0x8c, 0xff, 0xa9, 0xac, 0xa4, 0xff, 0xa1, 0xa8, 0xa6, 0xff, 0xa4, 0xa5, 0x9f, 0xff, 0xa6, 0xa7, 0x9f, 0xff, 0xa9, 0xa9, 0x9e, 0xff, 0xab, 0xab, 0xa1, 0xff, 0xab, 0xa9, 0xa0, 0xff, 0xa9, 0xa6, 0x9c, 0xff, 0xad, 0xa8, 0x9c, 0xf9, 0xab, 0xab, 0x9c, 0x87, 0xaa, 0xaa, 0xaa, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xab, 0xa7, 0x40, 0xa2, 0xab, 0xaa, 0xda, 0xa5, 0xab, 0xa8, 0xff, 0xa6, 0xad, 0xa9, 0xff, 0xa9, 0xb1, 0xb1, 0xff, 0xa6, 0xb0, 0xb2, 0xff, 0xa6, 0xb1, 0xb1, 0xff, 0xad, 0xb3, 0xb5, 0xff, 0xb5, 0xb5, 0xb6, 0xff, 0xb0, 0xb3, 0xae, 0xff, 0xa5, 0xae, 0xad, 0xff, 0x80, 0x90, 0xa2, 0xff, 0x47, 0x4e, 0x5f, 0xff, 0x35, 0x36, 0x41, 0xff, 0x40, 0x46, 0x4f, 0xff, 0x44, 0x48, 0x50, 0xff, 0x41, 0x43, 0x4b, 0xff, 0x4c, 0x4d, 0x57, 0xff, 0x3a, 0x3a, 0x45, 0xff, 0x2a, 0x29, 0x34, 0xff, 0x23, 0x1f, 0x2a, 0xff, 0x2c, 0x27, 0x31, 0xff, 0x37, 0x37, 0x41, 0xff, 0x40, 0x43, 0x4d, 0xff, 0x41, 0x43, 0x4e, 0xff, 0x2a, 0x2b, 0x37, 0xff, 0x32, 0x33, 0x3e, 0xff, 0x38, 0x39, 0x44, 0xff, 0x38, 0x39, 0x44, 0xff, 0x2f, 0x2f, 0x3a, 0xff, 0x34, 0x34, 0x3f, 0xff, 0x26, 0x26, 0x31, 0xff, 0x2e, 0x2e, 0x39, 0xff, 0x33, 0x34, 0x3f, 0xff, 0x2b, 0x2d, 0x38, 0xff, 0x2f, 0x32, 0x3c, 0xff, 0x32, 0x33, 0x3d, 0xff, 0x2a, 0x2a, 0x36, 0xff, 0x2a, 0x2a, 0x38, 0xff, 0x1f, 0x20, 0x2f, 0xff, 0x46, 0x4a, 0x55, 0xff, 0x4e, 0x54, 0x5a, 0xff, 0x3a, 0x40, 0x49, 0xff, 0x72, 0x75, 0x7d, 0xff, 0x9d, 0xa0, 0xa3, 0xff, 0xa6, 0xae, 0xb0, 0xff, 0xa1, 0xa7, 0x9d, 0xff, 0xa5, 0x9d, 0x81, 0xff, 0x9d, 0x8a, 0x58, 0xff, 0x91, 0x7f, 0x4d, 0xff, 0x9a, 0x85, 0x55, 0xff, 0xa5, 0x88, 0x3d, 0xff, 0xa2, 0x82, 0x2e, 0xff, 0x95, 0x7f, 0x42, 0xff, 0x8b, 0x7e, 0x4e, 0xff, 0x94, 0x84, 0x4e, 0xff, 0x9f, 0x8c, 0x58, 0xff, 0xb1, 0x9f, 0x72, 0xff, 0xae, 0xa1, 0x80, 0xff, 0xac, 0xa2, 0x8b, 0xff, 0xa8, 0xaa, 0xa5, 0xff, 0x9b, 0xa6, 0xa9, 0xff, 0xa0, 0xa4, 0xa1, 0xff, 0xa4, 0xa5, 0x9e, 0xff, 0xa9, 0xab, 0xa2, 0xff, 0xa6, 0xaa, 0xa4, 0xff, 0xa1, 0xa6, 0xa1, 0xff, 0xa1, 0xa7, 0x9e, 0xff, 0xa6, 0xa8, 0x9d, 0xff, 0xab, 0xa9, 0x9f, 0xff, 0xa8, 0xa6, 0xa0, 0xda, 0xa4, 0xa4, 0xa0, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb6, 0xb6, 0x07, 0xb3, 0xb3, 0xa8, 0x8e, 0xab, 0xb0, 0xac, 0xfe, 0xa6, 0xaf, 0xaf, 0xff, 0xa9, 0xaf, 0xab, 0xff, 0xa9, 0xae, 0xa9, 0xff, 0xa8, 0xae, 0xac, 0xff, 0xa4, 0xad, 0xad, 0xff, 0xa4, 0xb0, 0xb1, 0xff, 0xa6, 0xad, 0xb0, 0xff, 0xae, 0xac, 0xab, 0xff, 0xab, 0xab, 0xa4, 0xff, 0xae, 0xb4, 0xb0, 0xff, 0x7a, 0x84, 0x90, 0xff, 0x38, 0x39, 0x46, 0xff, 0x2b, 0x2a, 0x33, 0xff, 0x2c, 0x2e, 0x39, 0xff, 0x2c, 0x2e, 0x39, 0xff, 0x37, 0x39, 0x44, 0xff, 0x2c, 0x2b, 0x37, 0xff, 0x1c, 0x1a, 0x27, 0xff, 0x1e, 0x1a, 0x26, 0xff, 0x28, 0x22, 0x2c, 0xff, 0x23, 0x1f, 0x27, 0xff, 0x2d, 0x2f, 0x38, 0xff, 0x25, 0x2d, 0x35, 0xff, 0x27, 0x2c, 0x36, 0xff, 0x28, 0x2a, 0x34, 0xff, 0x39, 0x3c, 0x46, 0xff, 0x32, 0x35, 0x3f, 0xff, 0x1c, 0x1f, 0x27, 0xff, 0x28, 0x2c, 0x34, 0xff, 0x37, 0x37, 0x41, 0xff, 0x31, 0x31, 0x3b, 0xff, 0x28, 0x29, 0x33, 0xff, 0x1a, 0x1b, 0x25, 0xff, 0x2a, 0x2c, 0x35, 0xff, 0x36, 0x38, 0x42, 0xff, 0x29, 0x2a, 0x34, 0xff, 0x21, 0x22, 0x2c, 0xff, 0x2d, 0x2c, 0x39, 0xff, 0x2e, 0x2e, 0x3b, 0xff, 0x32, 0x32, 0x3c, 0xff, 0x28, 0x27, 0x2d, 0xff, 0x24, 0x24, 0x30, 0xff, 0x31, 0x31, 0x40, 0xff, 0x73, 0x76, 0x7e, 0xff, 0xa9, 0xaf, 0xb3, 0xff, 0xa6, 0xa8, 0x9b, 0xff, 0x9c, 0x8d, 0x67, 0xff, 0x9a, 0x84, 0x4a, 0xff, 0x9a, 0x87, 0x55, 0xff, 0xa2, 0x8d, 0x5e, 0xff, 0xa7, 0x89, 0x3f, 0xff, 0xaa, 0x8a, 0x33, 0xff, 0x9b, 0x8a, 0x54, 0xff, 0x98, 0x8e, 0x66, 0xff, 0xa5, 0x97, 0x65, 0xff, 0xa6, 0x98, 0x67, 0xff, 0xb0, 0xa1, 0x77, 0xff, 0xae, 0xa1, 0x82, 0xff, 0xb0, 0xa5, 0x8d, 0xff, 0xa2, 0xa7, 0xa2, 0xff, 0x93, 0xa0, 0xa7, 0xff, 0x9b, 0xa1, 0xa0, 0xff, 0xa2, 0xa4, 0x9f, 0xff, 0xa6, 0xa9, 0xa5, 0xff, 0x9d, 0xa2, 0xa2, 0xff, 0x92, 0x9b, 0x99, 0xff, 0x9a, 0xa5, 0x9e, 0xff, 0xa1, 0xa7, 0xa0, 0xff, 0xa7, 0xa8, 0xa1, 0xff, 0xa8, 0xa5, 0xa2, 0xff, 0xa7, 0xa2, 0xa4, 0xfe, 0xa8, 0xa8, 0xa3, 0x8e, 0xb6, 0xb6, 0x91, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xa7, 0xa1, 0x29, 0xb2, 0xb4, 0xae, 0xd1, 0xa8, 0xb2, 0xb2, 0xff, 0x9f, 0xac, 0xb5, 0xff, 0xa3, 0xae, 0xb3, 0xff, 0xad, 0xb0, 0xaf, 0xff, 0xae, 0xb0, 0xab, 0xff, 0xa8, 0xad, 0xab, 0xff, 0xa6, 0xae, 0xb2, 0xff, 0xa8, 0xb4, 0xb6, 0xff, 0x96, 0xa0, 0xa2, 0xff, 0x66, 0x69, 0x6d, 0xff, 0x84, 0x83, 0x89, 0xff, 0x86, 0x86, 0x8f, 0xff, 0x59, 0x5a, 0x67, 0xff, 0x35, 0x38, 0x40, 0xff, 0x1c, 0x20, 0x26, 0xff, 0x2c, 0x2c, 0x36, 0xff, 0x35, 0x33, 0x3d, 0xff, 0x31, 0x32, 0x38, 0xff, 0x22, 0x24, 0x25, 0xff, 0x26, 0x29, 0x31, 0xff, 0x3b, 0x3c, 0x49, 0xff, 0x2d, 0x2e, 0x36, 0xff, 0x14, 0x16, 0x1a, 0xff, 0x1a, 0x1d, 0x1f, 0xff, 0x15, 0x18, 0x18, 0xff, 0x1b, 0x1a, 0x21, 0xff, 0x26, 0x24, 0x2f, 0xff, 0x25, 0x29, 0x31, 0xff, 0x1b, 0x20, 0x28, 0xff, 0x1f, 0x22, 0x29, 0xff, 0x22, 0x24, 0x2b, 0xff, 0x1e, 0x1f, 0x28, 0xff, 0x25, 0x26, 0x2f, 0xff, 0x21, 0x22, 0x27, 0xff, 0x26, 0x27, 0x2a, 0xff, 0x2d, 0x2b, 0x32, 0xff, 0x26, 0x21, 0x2f, 0xff, 0x22, 0x21, 0x2d, 0xff, 0x27, 0x29, 0x32, 0xff, 0x31, 0x32, 0x3c, 0xff, 0x2f, 0x30, 0x3b, 0xff, 0x28, 0x29, 0x33, 0xff, 0x29, 0x29, 0x32, 0xff, 0x23, 0x24, 0x2e, 0xff, 0x23, 0x24, 0x2e, 0xff, 0x3a, 0x3c, 0x4b, 0xff, 0x5d, 0x61, 0x72, 0xff, 0x9e, 0x9d, 0x9a, 0xff, 0xb1, 0x9d, 0x75, 0xff, 0x9c, 0x8c, 0x55, 0xff, 0xa1, 0x8e, 0x5f, 0xff, 0xac, 0x8b, 0x5a, 0xff, 0xa4, 0x8c, 0x42, 0xff, 0xa4, 0x93, 0x40, 0xff, 0xac, 0x94, 0x56, 0xff, 0xae, 0x9a, 0x6c, 0xff, 0xa9, 0x9e, 0x74, 0xff, 0xa7, 0x9d, 0x7d, 0xff, 0xa6, 0x9f, 0x88, 0xff, 0xa5, 0xa0, 0x8c, 0xff, 0xaa, 0xa8, 0x8c, 0xff, 0xa1, 0xa4, 0x99, 0xff, 0x99, 0xa1, 0xa3, 0xff, 0x9c, 0xa3, 0x9d, 0xff, 0xa2, 0xa7, 0x9e, 0xff, 0xa6, 0xa9, 0xa2, 0xff, 0xa0, 0xa4, 0xa0, 0xff, 0x9c, 0x9e, 0x98, 0xff, 0x9e, 0xa2, 0x9c, 0xff, 0x9b, 0xa2, 0x9e, 0xff, 0x96, 0x9a, 0x8f, 0xff, 0x9a, 0x97, 0x88, 0xff, 0xa5, 0xa3, 0x9c, 0xff, 0xa6, 0xab, 0xac, 0xff, 0xa1, 0xa5, 0xa9, 0xd1, 0xa7, 0xa7, 0xa1, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xae, 0xb1, 0x56, 0xac, 0xb0, 0xad, 0xf3, 0xab, 0xb3, 0xb3, 0xff, 0x8a, 0xa1, 0xb4, 0xff, 0x89, 0x9e, 0xb0, 0xff, 0xa2, 0xae, 0xb6, 0xff, 0xac, 0xb3, 0xb4, 0xff, 0xaf, 0xb1, 0xaf, 0xff, 0xa9, 0xae, 0xad, 0xff, 0xa2, 0xaa, 0xae, 0xff, 0xa8, 0xb1, 0xb5, 0xff, 0xa9, 0xb0, 0xb3, 0xff, 0x55, 0x59, 0x5e, 0xff, 0x3d, 0x3d, 0x46, 0xff, 0x45, 0x43, 0x4f, 0xff, 0x30, 0x30, 0x3b, 0xff, 0x27, 0x27, 0x32, 0xff, 0x32, 0x31, 0x3d, 0xff, 0x3d, 0x3a, 0x48, 0xff, 0x37, 0x32, 0x3f, 0xff, 0x2f, 0x2b, 0x34, 0xff, 0x20, 0x20, 0x21, 0xff, 0x39, 0x36, 0x3b, 0xff, 0x33, 0x30, 0x39, 0xff, 0x22, 0x1f, 0x26, 0xff, 0x20, 0x1d, 0x21, 0xff, 0x1a, 0x19, 0x1b, 0xff, 0x11, 0x0f, 0x10, 0xff, 0x19, 0x15, 0x1b, 0xff, 0x24, 0x22, 0x29, 0xff, 0x1f, 0x23, 0x27, 0xff, 0x14, 0x18, 0x1b, 0xff, 0x19, 0x19, 0x1e, 0xff, 0x1d, 0x1a, 0x1e, 0xff, 0x11, 0x10, 0x19, 0xff, 0x11, 0x14, 0x1c, 0xff, 0x1f, 0x22, 0x25, 0xff, 0x23, 0x25, 0x28, 0xff, 0x27, 0x26, 0x2c, 0xff, 0x2c, 0x29, 0x34, 0xff, 0x22, 0x21, 0x2c, 0xff, 0x22, 0x24, 0x2d, 0xff, 0x2a, 0x2b, 0x35, 0xff, 0x2b, 0x2c, 0x36, 0xff, 0x2a, 0x2b, 0x35, 0xff, 0x30, 0x31, 0x3c, 0xff, 0x26, 0x28, 0x30, 0xff, 0x26, 0x26, 0x2e, 0xff, 0x26, 0x28, 0x36, 0xff, 0x22, 0x28, 0x3b, 0xff, 0x56, 0x58, 0x5b, 0xff, 0xb7, 0xab, 0x8f, 0xff, 0xac, 0x9d, 0x73, 0xff, 0x99, 0x86, 0x52, 0xff, 0xa1, 0x83, 0x3c, 0xff, 0xa3, 0x8a, 0x3e, 0xff, 0xa4, 0x8f, 0x4c, 0xff, 0xae, 0x96, 0x53, 0xff, 0xaf, 0x98, 0x63, 0xff, 0xa8, 0x96, 0x72, 0xff, 0xaf, 0xa1, 0x86, 0xff, 0xa3, 0x9c, 0x8b, 0xff, 0xa0, 0x9b, 0x90, 0xff, 0xa5, 0xa3, 0x93, 0xff, 0xa3, 0xa4, 0x9b, 0xff, 0xa2, 0xa5, 0xa1, 0xff, 0xa5, 0xa8, 0x9d, 0xff, 0xa6, 0xa8, 0x9a, 0xff, 0xaa, 0xa9, 0x9b, 0xff, 0xad, 0xa9, 0x9b, 0xff, 0xa8, 0xa6, 0x9f, 0xff, 0xa0, 0xa5, 0xa1, 0xff, 0xa1, 0xa2, 0x96, 0xff, 0x92, 0x8b, 0x6f, 0xff, 0x8d, 0x83, 0x64, 0xff, 0x9c, 0x9b, 0x88, 0xff, 0xa5, 0xab, 0xac, 0xff, 0xa1, 0xa6, 0xab, 0xff, 0xa4, 0xa6, 0x9f, 0xf3, 0xa3, 0xa3, 0x97, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0xa0, 0xad, 0xb8, 0x8a, 0xa4, 0xad, 0xb0, 0xfe, 0xac, 0xb0, 0xab, 0xff, 0xa6, 0xb0, 0xb6, 0xff, 0x79, 0x95, 0xb2, 0xff, 0x7a, 0x92, 0xa7, 0xff, 0x9f, 0xae, 0xb8, 0xff, 0xa8, 0xb2, 0xb7, 0xff, 0xa9, 0xb0, 0xaf, 0xff, 0xa9, 0xb0, 0xaf, 0xff, 0xa4, 0xac, 0xac, 0xff, 0xa7, 0xb1, 0xb3, 0xff, 0x86, 0x8c, 0x91, 0xff, 0x43, 0x45, 0x4b, 0xff, 0x32, 0x31, 0x3a, 0xff, 0x2b, 0x29, 0x33, 0xff, 0x22, 0x22, 0x2b, 0xff, 0x25, 0x22, 0x2d, 0xff, 0x23, 0x1f, 0x2c, 0xff, 0x31, 0x2e, 0x3a, 0xff, 0x2b, 0x29, 0x33, 0xff, 0x0f, 0x0e, 0x13, 0xff, 0x19, 0x15, 0x16, 0xff, 0x28, 0x22, 0x25, 0xff, 0x1c, 0x19, 0x1d, 0xff, 0x15, 0x13, 0x17, 0xff, 0x1d, 0x1b, 0x21, 0xff, 0x21, 0x21, 0x27, 0xff, 0x0f, 0x11, 0x18, 0xff, 0x0b, 0x0c, 0x13, 0xff, 0x14, 0x17, 0x1e, 0xff, 0x0a, 0x10, 0x17, 0xff, 0x04, 0x09, 0x11, 0xff, 0x01, 0x02, 0x0b, 0xff, 0x0c, 0x09, 0x13, 0xff, 0x0d, 0x0d, 0x17, 0xff, 0x0a, 0x0d, 0x16, 0xff, 0x0d, 0x10, 0x17, 0xff, 0x16, 0x19, 0x1f, 0xff, 0x2d, 0x2e, 0x34, 0xff, 0x30, 0x2f, 0x37, 0xff, 0x26, 0x26, 0x30, 0xff, 0x25, 0x26, 0x30, 0xff, 0x27, 0x28, 0x32, 0xff, 0x1a, 0x1b, 0x25, 0xff, 0x28, 0x29, 0x33, 0xff, 0x2c, 0x2d, 0x37, 0xff, 0x1e, 0x20, 0x28, 0xff, 0x25, 0x23, 0x2c, 0xff, 0x2b, 0x2b, 0x36, 0xff, 0x24, 0x2a, 0x3b, 0xff, 0x15, 0x1a, 0x25, 0xff, 0x72, 0x71, 0x68, 0xff, 0xba, 0xac, 0x97, 0xff, 0xa1, 0x8d, 0x54, 0xff, 0xa2, 0x8c, 0x2d, 0xff, 0xb1, 0x96, 0x48, 0xff, 0xb3, 0x97, 0x66, 0xff, 0xa6, 0x90, 0x4f, 0xff, 0xa5, 0x8f, 0x4f, 0xff, 0xa9, 0x91, 0x65, 0xff, 0xaf, 0x9d, 0x79, 0xff, 0xa1, 0x97, 0x80, 0xff, 0x9f, 0x9a, 0x8b, 0xff, 0xa4, 0xa0, 0x95, 0xff, 0xa4, 0xa3, 0x9f, 0xff, 0xa2, 0xa4, 0xa4, 0xff, 0xa4, 0xa5, 0x9d, 0xff, 0xa6, 0xa6, 0x9a, 0xff, 0xab, 0xa8, 0x9b, 0xff, 0xb0, 0xa8, 0x9a, 0xff, 0xa5, 0xa5, 0xa4, 0xff, 0xa1, 0xa6, 0xa6, 0xff, 0xa5, 0x9d, 0x85, 0xff, 0x93, 0x7e, 0x4f, 0xff, 0x86, 0x72, 0x44, 0xff, 0x8e, 0x8e, 0x76, 0xff, 0xa3, 0xa9, 0xa9, 0xff, 0xa5, 0xa7, 0xab, 0xff, 0xa5, 0xa7, 0x9f, 0xff, 0xa3, 0xa3, 0x96, 0xfe, 0x9d, 0x9d, 0x90, 0x8b, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xb9, 0xb9, 0x0b, 0xa5, 0xae, 0xb4, 0xae, 0xa7, 0xb0, 0xb5, 0xff, 0xaa, 0xb1, 0xb2, 0xff, 0xb2, 0xb3, 0xad, 0xff, 0xac, 0xb1, 0xb3, 0xff, 0x83, 0x97, 0xaa, 0xff, 0x83, 0x96, 0xa6, 0xff, 0xa2, 0xb1, 0xb9, 0xff, 0xa4, 0xb0, 0xb6, 0xff, 0xa4, 0xad, 0xae, 0xff, 0xa7, 0xaf, 0xae, 0xff, 0xae, 0xb6, 0xb3, 0xff, 0x9e, 0xa7, 0xaa, 0xff, 0x44, 0x4b, 0x50, 0xff, 0x22, 0x22, 0x2a, 0xff, 0x2d, 0x29, 0x33, 0xff, 0x1e, 0x1c, 0x25, 0xff, 0x1d, 0x1b, 0x26, 0xff, 0x29, 0x28, 0x2b, 0xff, 0x1d, 0x1d, 0x1e, 0xff, 0x13, 0x16, 0x18, 0xff, 0x11, 0x16, 0x18, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x13, 0x0e, 0x0b, 0xff, 0x0a, 0x0b, 0x0d, 0xff, 0x0a, 0x10, 0x14, 0xff, 0x03, 0x08, 0x0d, 0xff, 0x00, 0x04, 0x0b, 0xff, 0x00, 0x04, 0x0d, 0xff, 0x03, 0x0b, 0x13, 0xff, 0x09, 0x0e, 0x1b, 0xff, 0x0a, 0x0f, 0x20, 0xff, 0x0a, 0x11, 0x22, 0xff, 0x0a, 0x12, 0x23, 0xff, 0x20, 0x28, 0x3a, 0xff, 0x19, 0x1e, 0x33, 0xff, 0x15, 0x18, 0x27, 0xff, 0x0f, 0x13, 0x1c, 0xff, 0x0e, 0x10, 0x1c, 0xff, 0x18, 0x1a, 0x25, 0xff, 0x17, 0x1a, 0x22, 0xff, 0x0d, 0x0f, 0x16, 0xff, 0x20, 0x22, 0x29, 0xff, 0x1b, 0x1c, 0x25, 0xff, 0x11, 0x13, 0x1b, 0xff, 0x15, 0x16, 0x1f, 0xff, 0x1f, 0x21, 0x2a, 0xff, 0x1f, 0x21, 0x29, 0xff, 0x20, 0x24, 0x2c, 0xff, 0x26, 0x26, 0x2c, 0xff, 0x24, 0x21, 0x27, 0xff, 0x24, 0x29, 0x36, 0xff, 0x12, 0x19, 0x27, 0xff, 0x26, 0x2b, 0x31, 0xff, 0x83, 0x7c, 0x79, 0xff, 0xa7, 0x97, 0x6a, 0xff, 0xa9, 0x95, 0x39, 0xff, 0xb5, 0x99, 0x4a, 0xff, 0xb3, 0x96, 0x64, 0xff, 0xa0, 0x8a, 0x4c, 0xff, 0xa2, 0x8d, 0x45, 0xff, 0xaa, 0x93, 0x56, 0xff, 0xab, 0x9c, 0x68, 0xff, 0xa3, 0x9b, 0x72, 0xff, 0xa2, 0x9e, 0x80, 0xff, 0xa7, 0xa2, 0x89, 0xff, 0xa4, 0xa4, 0x9c, 0xff, 0x9f, 0xa4, 0xa7, 0xff, 0x9f, 0xa4, 0x9e, 0xff, 0xa2, 0xa5, 0x9d, 0xff, 0xa7, 0xa9, 0xa1, 0xff, 0xa9, 0xa8, 0xa2, 0xff, 0xa0, 0xa4, 0xa5, 0xff, 0xa2, 0xa6, 0xa4, 0xff, 0xa6, 0x9d, 0x81, 0xff, 0x94, 0x7d, 0x4c, 0xff, 0x8c, 0x78, 0x4b, 0xff, 0x91, 0x94, 0x84, 0xff, 0xa3, 0xab, 0xad, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0xa5, 0xa5, 0x9e, 0xff, 0xa4, 0xa3, 0x97, 0xff, 0x9f, 0xa0, 0x94, 0xff, 0x9e, 0xa0, 0x9a, 0xaf, 0xa2, 0xa2, 0xa2, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xad, 0xad, 0x16, 0xa3, 0xb0, 0xb1, 0xc9, 0xaf, 0xb5, 0xb5, 0xff, 0xa7, 0xb0, 0xb8, 0xff, 0x9c, 0xab, 0xb8, 0xff, 0xa7, 0xb1, 0xb7, 0xff, 0xae, 0xb3, 0xb3, 0xff, 0xa0, 0xa9, 0xb1, 0xff, 0xa1, 0xab, 0xaf, 0xff, 0xaa, 0xb4, 0xb4, 0xff, 0xa7, 0xb2, 0xb3, 0xff, 0xa2, 0xad, 0xad, 0xff, 0xa5, 0xae, 0xae, 0xff, 0xad, 0xb6, 0xb4, 0xff, 0x96, 0x9c, 0xa1, 0xff, 0x3a, 0x3d, 0x46, 0xff, 0x28, 0x28, 0x31, 0xff, 0x21, 0x1d, 0x27, 0xff, 0x19, 0x15, 0x1d, 0xff, 0x25, 0x23, 0x2a, 0xff, 0x24, 0x24, 0x25, 0xff, 0x0c, 0x0f, 0x0f, 0xff, 0x03, 0x0a, 0x11, 0xff, 0x02, 0x09, 0x13, 0xff, 0x0e, 0x12, 0x1d, 0xff, 0x25, 0x1f, 0x29, 0xff, 0x15, 0x16, 0x22, 0xff, 0x0c, 0x13, 0x21, 0xff, 0x13, 0x17, 0x24, 0xff, 0x19, 0x18, 0x25, 0xff, 0x25, 0x24, 0x30, 0xff, 0x48, 0x46, 0x52, 0xff, 0x62, 0x5c, 0x6a, 0xff, 0x70, 0x6a, 0x7a, 0xff, 0x68, 0x68, 0x79, 0xff, 0x66, 0x6b, 0x7d, 0xff, 0x77, 0x7d, 0x90, 0xff, 0x75, 0x7a, 0x8f, 0xff, 0x73, 0x77, 0x89, 0xff, 0x71, 0x74, 0x84, 0xff, 0x53, 0x55, 0x67, 0xff, 0x1d, 0x1f, 0x30, 0xff, 0x07, 0x08, 0x16, 0xff, 0x11, 0x14, 0x1d, 0xff, 0x1b, 0x1d, 0x25, 0xff, 0x0f, 0x11, 0x19, 0xff, 0x12, 0x14, 0x1c, 0xff, 0x21, 0x23, 0x2b, 0xff, 0x0d, 0x0f, 0x17, 0xff, 0x0f, 0x12, 0x1a, 0xff, 0x27, 0x2b, 0x36, 0xff, 0x23, 0x24, 0x2a, 0xff, 0x13, 0x10, 0x0f, 0xff, 0x15, 0x16, 0x1e, 0xff, 0x26, 0x2d, 0x3a, 0xff, 0x21, 0x24, 0x30, 0xff, 0x33, 0x31, 0x39, 0xff, 0x7c, 0x72, 0x5f, 0xff, 0xb3, 0x9a, 0x5d, 0xff, 0xae, 0x93, 0x43, 0xff, 0xa2, 0x8c, 0x43, 0xff, 0xa3, 0x8c, 0x4f, 0xff, 0xa5, 0x8c, 0x4d, 0xff, 0xa7, 0x91, 0x4f, 0xff, 0xa3, 0x93, 0x59, 0xff, 0x9c, 0x93, 0x63, 0xff, 0xa0, 0x9a, 0x76, 0xff, 0xab, 0xa2, 0x83, 0xff, 0xa9, 0xa4, 0x92, 0xff, 0xa5, 0xa4, 0x9b, 0xff, 0xa8, 0xa6, 0x99, 0xff, 0xa9, 0xab, 0x9d, 0xff, 0xab, 0xaf, 0xa3, 0xff, 0xaa, 0xac, 0xa6, 0xff, 0xa4, 0xa7, 0xa4, 0xff, 0xa7, 0xaa, 0xa3, 0xff, 0xa8, 0xa2, 0x8e, 0xff, 0x9b, 0x8e, 0x6e, 0xff, 0x99, 0x8f, 0x75, 0xff, 0x8e, 0x97, 0x9d, 0xff, 0x9a, 0xa3, 0xaf, 0xff, 0xaa, 0xaa, 0xa5, 0xff, 0xa4, 0xa5, 0x9b, 0xff, 0xa1, 0xa0, 0x94, 0xff, 0x9f, 0xa1, 0x95, 0xff, 0x9e, 0xa1, 0x9c, 0xff, 0xa1, 0xa1, 0x9e, 0xc9, 0xa2, 0xa2, 0xa2, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xb0, 0xa6, 0x1a, 0x9e, 0xa4, 0x9c, 0xd6, 0xa1, 0xa8, 0xa1, 0xff, 0xad, 0xb3, 0xb5, 0xff, 0x92, 0xa3, 0xb6, 0xff, 0x75, 0x92, 0xb0, 0xff, 0x87, 0x9f, 0xb8, 0xff, 0xa2, 0xad, 0xb7, 0xff, 0xac, 0xb2, 0xb7, 0xff, 0xb3, 0xb8, 0xb5, 0xff, 0xb0, 0xb7, 0xb0, 0xff, 0xac, 0xb3, 0xb1, 0xff, 0xa5, 0xae, 0xaf, 0xff, 0xa6, 0xb1, 0xb1, 0xff, 0xac, 0xb6, 0xb5, 0xff, 0x93, 0x9a, 0x9f, 0xff, 0x35, 0x38, 0x41, 0xff, 0x31, 0x2e, 0x37, 0xff, 0x23, 0x1f, 0x28, 0xff, 0x1a, 0x18, 0x1e, 0xff, 0x22, 0x20, 0x26, 0xff, 0x11, 0x11, 0x19, 0xff, 0x0e, 0x11, 0x1d, 0xff, 0x2e, 0x35, 0x46, 0xff, 0x39, 0x3e, 0x57, 0xff, 0x4a, 0x49, 0x66, 0xff, 0x82, 0x77, 0x95, 0xff, 0x85, 0x7e, 0x96, 0xff, 0x5f, 0x5b, 0x70, 0xff, 0x7e, 0x75, 0x8a, 0xff, 0x92, 0x85, 0x97, 0xff, 0x98, 0x87, 0x97, 0xff, 0xab, 0x99, 0xa7, 0xff, 0xba, 0xa4, 0xae, 0xff, 0xce, 0xb7, 0xbf, 0xff, 0xca, 0xbd, 0xc7, 0xff, 0xbf, 0xba, 0xc5, 0xff, 0xb7, 0xb6, 0xc2, 0xff, 0xba, 0xba, 0xc6, 0xff, 0xbf, 0xc1, 0xd2, 0xff, 0xaa, 0xad, 0xc3, 0xff, 0xac, 0xad, 0xc3, 0xff, 0x79, 0x79, 0x90, 0xff, 0x34, 0x35, 0x47, 0xff, 0x1c, 0x1e, 0x2a, 0xff, 0x1d, 0x1f, 0x27, 0xff, 0x20, 0x22, 0x29, 0xff, 0x15, 0x17, 0x1f, 0xff, 0x1f, 0x21, 0x28, 0xff, 0x18, 0x1a, 0x22, 0xff, 0x0a, 0x0b, 0x13, 0xff, 0x15, 0x1a, 0x25, 0xff, 0x21, 0x23, 0x29, 0xff, 0x11, 0x0d, 0x09, 0xff, 0x0e, 0x0c, 0x10, 0xff, 0x20, 0x22, 0x2e, 0xff, 0x2c, 0x2c, 0x38, 0xff, 0x1c, 0x20, 0x2b, 0xff, 0x4c, 0x48, 0x4b, 0xff, 0x99, 0x7d, 0x60, 0xff, 0xab, 0x92, 0x46, 0xff, 0xac, 0x9b, 0x3f, 0xff, 0xac, 0x93, 0x52, 0xff, 0xa9, 0x8d, 0x59, 0xff, 0xa7, 0x91, 0x58, 0xff, 0x9f, 0x8d, 0x59, 0xff, 0x9a, 0x8e, 0x61, 0xff, 0x9e, 0x92, 0x70, 0xff, 0x9f, 0x91, 0x7a, 0xff, 0x9c, 0x8e, 0x74, 0xff, 0x9c, 0x90, 0x6f, 0xff, 0xa3, 0x9a, 0x79, 0xff, 0xa8, 0xa4, 0x87, 0xff, 0xa8, 0xa6, 0x8f, 0xff, 0xaa, 0xaa, 0x99, 0xff, 0xac, 0xac, 0x9f, 0xff, 0xa9, 0xab, 0xa2, 0xff, 0xa5, 0xa6, 0x9b, 0xff, 0x9c, 0x9a, 0x8c, 0xff, 0x90, 0x8e, 0x89, 0xff, 0x84, 0x91, 0xa8, 0xff, 0x97, 0xa0, 0xb1, 0xff, 0xaa, 0xa7, 0x9f, 0xff, 0xa2, 0xa1, 0x98, 0xff, 0xa1, 0xa0, 0x94, 0xff, 0xa4, 0xa4, 0x9a, 0xff, 0xa0, 0xa3, 0x9f, 0xff, 0xa1, 0xa2, 0xa1, 0xff, 0xa5, 0xa4, 0xa4, 0xd6, 0xa6, 0xa6, 0xa6, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xb7, 0xb7, 0x20, 0xab, 0xaf, 0xab, 0xde, 0xa4, 0xa3, 0x95, 0xff, 0xa7, 0xa1, 0x8a, 0xff, 0x9d, 0xa1, 0x9c, 0xff, 0x88, 0x9b, 0xac, 0xff, 0x70, 0x8d, 0xaf, 0xff, 0x6e, 0x8e, 0xb5, 0xff, 0x7f, 0x95, 0xae, 0xff, 0xa0, 0xaa, 0xae, 0xff, 0xa1, 0xaf, 0xb4, 0xff, 0x9b, 0xa8, 0xb6, 0xff, 0xa7, 0xad, 0xb9, 0xff, 0xaa, 0xb2, 0xb2, 0xff, 0xa6, 0xaf, 0xaa, 0xff, 0xa8, 0xaf, 0xb1, 0xff, 0xa2, 0xa9, 0xb2, 0xff, 0x4e, 0x52, 0x5a, 0xff, 0x1c, 0x1a, 0x21, 0xff, 0x13, 0x10, 0x1a, 0xff, 0x1f, 0x20, 0x2f, 0xff, 0x30, 0x34, 0x4b, 0xff, 0x3c, 0x3f, 0x5c, 0xff, 0x64, 0x61, 0x7d, 0xff, 0x9c, 0x8f, 0xa3, 0xff, 0xb3, 0x9d, 0xab, 0xff, 0xb8, 0x9f, 0xa8, 0xff, 0xc4, 0xac, 0xb3, 0xff, 0xcf, 0xb4, 0xba, 0xff, 0xba, 0x9e, 0xa4, 0xff, 0xc0, 0xa7, 0xab, 0xff, 0xc4, 0xae, 0xb0, 0xff, 0xc8, 0xb2, 0xb4, 0xff, 0xc8, 0xb3, 0xb3, 0xff, 0xc4, 0xad, 0xaf, 0xff, 0xc3, 0xad, 0xb1, 0xff, 0xc5, 0xb3, 0xba, 0xff, 0xbf, 0xb3, 0xbd, 0xff, 0xae, 0xaa, 0xb6, 0xff, 0xb6, 0xb6, 0xc5, 0xff, 0xa2, 0xa5, 0xb8, 0xff, 0x88, 0x8b, 0xa0, 0xff, 0x8d, 0x8b, 0xa0, 0xff, 0xae, 0xaa, 0xbf, 0xff, 0x90, 0x8e, 0xa1, 0xff, 0x45, 0x45, 0x57, 0xff, 0x24, 0x25, 0x31, 0xff, 0x1a, 0x1b, 0x24, 0xff, 0x1c, 0x1c, 0x26, 0xff, 0x1f, 0x1e, 0x26, 0xff, 0x21, 0x20, 0x26, 0xff, 0x1a, 0x19, 0x1d, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x22, 0x20, 0x26, 0xff, 0x15, 0x14, 0x19, 0xff, 0x0c, 0x0d, 0x14, 0xff, 0x17, 0x19, 0x23, 0xff, 0x1e, 0x1f, 0x2b, 0xff, 0x18, 0x17, 0x1d, 0xff, 0x29, 0x29, 0x33, 0xff, 0x35, 0x35, 0x3d, 0xff, 0x78, 0x6c, 0x4e, 0xff, 0xb9, 0xa1, 0x5f, 0xff, 0xaf, 0x98, 0x4f, 0xff, 0xae, 0x96, 0x5a, 0xff, 0xa6, 0x90, 0x5f, 0xff, 0x9c, 0x92, 0x62, 0xff, 0xa1, 0x96, 0x64, 0xff, 0xa9, 0x99, 0x6d, 0xff, 0xa4, 0x93, 0x7f, 0xff, 0x94, 0x87, 0x6b, 0xff, 0x91, 0x85, 0x59, 0xff, 0x9b, 0x8f, 0x63, 0xff, 0x9f, 0x95, 0x6a, 0xff, 0x9c, 0x92, 0x71, 0xff, 0xa4, 0x9c, 0x7e, 0xff, 0xb1, 0xaa, 0x9a, 0xff, 0xa8, 0xa7, 0xa7, 0xff, 0x9a, 0xa1, 0xa2, 0xff, 0x95, 0x9b, 0x98, 0xff, 0x8f, 0x92, 0x8d, 0xff, 0x91, 0x9a, 0xa2, 0xff, 0xa1, 0xa7, 0xac, 0xff, 0xab, 0xa7, 0xa0, 0xff, 0x9f, 0x9e, 0x96, 0xff, 0xa4, 0xa1, 0x9a, 0xff, 0xa5, 0xa4, 0x9f, 0xff, 0x9e, 0x9f, 0x9b, 0xff, 0xa0, 0xa1, 0xa0, 0xff, 0xa3, 0xa5, 0xa3, 0xff, 0xa3, 0xa6, 0xa5, 0xde, 0x9f, 0xa7, 0xa7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xb6, 0xbf, 0x1c, 0xa8, 0xb4, 0xbb, 0xdb, 0xab, 0xb1, 0xaf, 0xff, 0xa9, 0xa9, 0x9e, 0xff, 0xa5, 0xa0, 0x8e, 0xff, 0x8c, 0x91, 0x8c, 0xff, 0x86, 0x98, 0xa5, 0xff, 0x78, 0x90, 0xaf, 0xff, 0x66, 0x83, 0xa7, 0xff, 0x76, 0x8d, 0xa5, 0xff, 0xa5, 0xb1, 0xb6, 0xff, 0x98, 0xa8, 0xb1, 0xff, 0x84, 0x92, 0xa7, 0xff, 0x98, 0xa1, 0xb1, 0xff, 0xa5, 0xaf, 0xaf, 0xff, 0xa8, 0xb1, 0xad, 0xff, 0xa5, 0xae, 0xb3, 0xff, 0xa8, 0xae, 0xb6, 0xff, 0x47, 0x4c, 0x55, 0xff, 0x17, 0x1b, 0x2a, 0xff, 0x47, 0x46, 0x5c, 0xff, 0x69, 0x66, 0x7c, 0xff, 0x8c, 0x87, 0x9b, 0xff, 0x9b, 0x97, 0xaa, 0xff, 0xb4, 0xaa, 0xbb, 0xff, 0xd0, 0xba, 0xc4, 0xff, 0xd7, 0xb9, 0xbd, 0xff, 0xd5, 0xb6, 0xb5, 0xff, 0xd0, 0xb4, 0xb1, 0xff, 0xd2, 0xb6, 0xb2, 0xff, 0xc9, 0xad, 0xaa, 0xff, 0xc7, 0xad, 0xab, 0xff, 0xca, 0xb3, 0xb3, 0xff, 0xc6, 0xb0, 0xb2, 0xff, 0xbc, 0xa8, 0xa9, 0xff, 0xbc, 0xaa, 0xb0, 0xff, 0xab, 0x9c, 0xa5, 0xff, 0x9a, 0x8d, 0x97, 0xff, 0x98, 0x91, 0xa0, 0xff, 0x92, 0x90, 0xa3, 0xff, 0x81, 0x81, 0x95, 0xff, 0x67, 0x6c, 0x80, 0xff, 0x66, 0x6a, 0x7f, 0xff, 0x79, 0x7a, 0x8e, 0xff, 0x98, 0x96, 0xaa, 0xff, 0x95, 0x94, 0xa8, 0xff, 0x54, 0x56, 0x6a, 0xff, 0x34, 0x35, 0x44, 0xff, 0x20, 0x1f, 0x2a, 0xff, 0x18, 0x18, 0x23, 0xff, 0x17, 0x18, 0x21, 0xff, 0x1a, 0x1b, 0x21, 0xff, 0x1f, 0x20, 0x24, 0xff, 0x22, 0x22, 0x26, 0xff, 0x17, 0x16, 0x1c, 0xff, 0x1b, 0x1d, 0x24, 0xff, 0x17, 0x19, 0x21, 0xff, 0x21, 0x23, 0x2b, 0xff, 0x1d, 0x21, 0x2a, 0xff, 0x24, 0x21, 0x2c, 0xff, 0x14, 0x14, 0x24, 0xff, 0x0d, 0x13, 0x26, 0xff, 0x46, 0x3d, 0x3b, 0xff, 0xa4, 0x8d, 0x6b, 0xff, 0xa3, 0x91, 0x65, 0xff, 0xa3, 0x90, 0x59, 0xff, 0xa7, 0x93, 0x59, 0xff, 0x9d, 0x93, 0x69, 0xff, 0x9e, 0x94, 0x6e, 0xff, 0xa4, 0x96, 0x71, 0xff, 0x96, 0x8d, 0x75, 0xff, 0x8c, 0x84, 0x6c, 0xff, 0x9a, 0x8e, 0x6e, 0xff, 0xa4, 0x97, 0x75, 0xff, 0xa4, 0x98, 0x76, 0xff, 0xa2, 0x96, 0x7a, 0xff, 0xa7, 0x9b, 0x85, 0xff, 0xad, 0xa3, 0x93, 0xff, 0xa8, 0xa6, 0x9f, 0xff, 0x9c, 0xa1, 0xa0, 0xff, 0x96, 0x9a, 0x94, 0xff, 0x9d, 0x9c, 0x90, 0xff, 0xa4, 0xa4, 0x9d, 0xff, 0xa8, 0xa9, 0xa6, 0xff, 0xa6, 0xa5, 0x9e, 0xff, 0x9a, 0x9b, 0x94, 0xff, 0xa5, 0xa5, 0xa1, 0xff, 0xa7, 0xa6, 0xa2, 0xff, 0x9d, 0x9d, 0x9a, 0xff, 0x9f, 0xa0, 0x9d, 0xff, 0xa2, 0xa5, 0xa3, 0xff, 0xa4, 0xa8, 0xa5, 0xff, 0xa3, 0xa5, 0xa4, 0xdc, 0xa3, 0xa3, 0xa3, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0xaa, 0xc2, 0x15, 0x9f, 0xb1, 0xbd, 0xd6, 0xa8, 0xb4, 0xba, 0xff, 0xaa, 0xb3, 0xb3, 0xff, 0xaa, 0xaf, 0xaa, 0xff, 0xa5, 0xa8, 0xa1, 0xff, 0x97, 0xa0, 0x9f, 0xff, 0x8a, 0x98, 0xa5, 0xff, 0x79, 0x8d, 0xa5, 0xff, 0x6c, 0x84, 0x9d, 0xff, 0x83, 0x95, 0xa9, 0xff, 0xa9, 0xb6, 0xbe, 0xff, 0x93, 0xa3, 0xaf, 0xff, 0x7e, 0x8d, 0xa1, 0xff, 0x8d, 0x97, 0xa7, 0xff, 0x9e, 0xaa, 0xaf, 0xff, 0xaa, 0xb6, 0xb6, 0xff, 0xa6, 0xb1, 0xba, 0xff, 0xa5, 0xad, 0xb3, 0xff, 0x4e, 0x56, 0x62, 0xff, 0x46, 0x4f, 0x6c, 0xff, 0x79, 0x7c, 0x9e, 0xff, 0x9a, 0x8f, 0xa9, 0xff, 0xba, 0xa2, 0xae, 0xff, 0xc5, 0xb0, 0xb2, 0xff, 0xcb, 0xb7, 0xb5, 0xff, 0xd4, 0xb9, 0xb7, 0xff, 0xd6, 0xb8, 0xb3, 0xff, 0xd6, 0xba, 0xb5, 0xff, 0xd2, 0xb9, 0xb5, 0xff, 0xcd, 0xb6, 0xb3, 0xff, 0xca, 0xb3, 0xaf, 0xff, 0xc0, 0xaa, 0xaa, 0xff, 0xbf, 0xaa, 0xaf, 0xff, 0xb4, 0xa1, 0xa9, 0xff, 0xb1, 0x9e, 0xa7, 0xff, 0xa3, 0x97, 0xa5, 0xff, 0x8d, 0x85, 0x96, 0xff, 0x89, 0x84, 0x94, 0xff, 0x73, 0x71, 0x86, 0xff, 0x5e, 0x5f, 0x77, 0xff, 0x54, 0x58, 0x70, 0xff, 0x46, 0x4e, 0x64, 0xff, 0x4c, 0x54, 0x69, 0xff, 0x78, 0x7c, 0x91, 0xff, 0x84, 0x86, 0x9b, 0xff, 0x6e, 0x72, 0x85, 0xff, 0x49, 0x50, 0x63, 0xff, 0x2a, 0x2e, 0x3e, 0xff, 0x2a, 0x2c, 0x39, 0xff, 0x2b, 0x2d, 0x3a, 0xff, 0x1a, 0x1c, 0x26, 0xff, 0x1c, 0x1e, 0x26, 0xff, 0x21, 0x23, 0x2a, 0xff, 0x14, 0x15, 0x1c, 0xff, 0x10, 0x12, 0x18, 0xff, 0x1b, 0x1e, 0x25, 0xff, 0x21, 0x23, 0x2b, 0xff, 0x22, 0x24, 0x2c, 0xff, 0x1f, 0x22, 0x2a, 0xff, 0x25, 0x26, 0x31, 0xff, 0x1e, 0x1f, 0x2e, 0xff, 0x0e, 0x11, 0x22, 0xff, 0x29, 0x25, 0x2d, 0xff, 0x5b, 0x4f, 0x49, 0xff, 0x54, 0x4a, 0x44, 0xff, 0x87, 0x77, 0x4a, 0xff, 0xab, 0x9a, 0x5b, 0xff, 0x9f, 0x94, 0x77, 0xff, 0xa0, 0x95, 0x81, 0xff, 0x9d, 0x93, 0x7c, 0xff, 0x7f, 0x80, 0x66, 0xff, 0x86, 0x83, 0x6d, 0xff, 0x9c, 0x90, 0x7a, 0xff, 0xa1, 0x96, 0x7b, 0xff, 0xa3, 0x98, 0x7b, 0xff, 0xa3, 0x98, 0x7d, 0xff, 0xa8, 0x9d, 0x88, 0xff, 0xa5, 0x9d, 0x8a, 0xff, 0x9c, 0x9d, 0x91, 0xff, 0x99, 0x9f, 0x9e, 0xff, 0x99, 0x9d, 0x9a, 0xff, 0xa7, 0xa5, 0x9d, 0xff, 0xaa, 0xaa, 0xa3, 0xff, 0xa8, 0xa9, 0xa3, 0xff, 0x9b, 0x9b, 0x94, 0xff, 0x98, 0x99, 0x95, 0xff, 0xa5, 0xa7, 0xa5, 0xff, 0xa1, 0xa4, 0xa1, 0xff, 0x9d, 0x9f, 0x9a, 0xff, 0x9e, 0x9f, 0x9b, 0xff, 0xa0, 0xa3, 0xa1, 0xff, 0xa3, 0xa7, 0xa4, 0xff, 0xa4, 0xa6, 0xa5, 0xff, 0xa0, 0xa3, 0xa3, 0xd7, 0x9d, 0xaa, 0x9d, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xb2, 0xb2, 0x0a, 0x95, 0xa8, 0xb6, 0xc8, 0x9d, 0xae, 0xb9, 0xff, 0xa8, 0xb4, 0xb9, 0xff, 0xa9, 0xb1, 0xb2, 0xff, 0xa6, 0xae, 0xad, 0xff, 0xa0, 0xa8, 0xaa, 0xff, 0x9a, 0xa4, 0xa9, 0xff, 0x9d, 0xaa, 0xb5, 0xff, 0x96, 0xa5, 0xb5, 0xff, 0x80, 0x90, 0xa1, 0xff, 0x8a, 0x9a, 0xa9, 0xff, 0x9f, 0xae, 0xb8, 0xff, 0x85, 0x99, 0xa7, 0xff, 0x83, 0x95, 0xaa, 0xff, 0x92, 0x9d, 0xb1, 0xff, 0x9b, 0xaa, 0xb3, 0xff, 0xa3, 0xb3, 0xb8, 0xff, 0xa0, 0xaf, 0xbd, 0xff, 0xaa, 0xb5, 0xc0, 0xff, 0x6e, 0x75, 0x86, 0xff, 0x5f, 0x66, 0x8b, 0xff, 0x7e, 0x7e, 0xa6, 0xff, 0xa2, 0x91, 0xab, 0xff, 0xcb, 0xad, 0xb5, 0xff, 0xd4, 0xb6, 0xb3, 0xff, 0xcf, 0xb3, 0xad, 0xff, 0xd3, 0xb8, 0xb1, 0xff, 0xd3, 0xba, 0xb4, 0xff, 0xcc, 0xb5, 0xb2, 0xff, 0xc1, 0xab, 0xab, 0xff, 0xbd, 0xa8, 0xa8, 0xff, 0xba, 0xa5, 0xa6, 0xff, 0xa6, 0x92, 0x98, 0xff, 0x9c, 0x8b, 0x94, 0xff, 0x97, 0x89, 0x99, 0xff, 0x8d, 0x80, 0x92, 0xff, 0x83, 0x7d, 0x92, 0xff, 0x71, 0x6f, 0x86, 0xff, 0x67, 0x67, 0x7e, 0xff, 0x5a, 0x5c, 0x74, 0xff, 0x4d, 0x51, 0x6a, 0xff, 0x43, 0x4a, 0x63, 0xff, 0x3d, 0x47, 0x5f, 0xff, 0x46, 0x50, 0x66, 0xff, 0x5f, 0x64, 0x7b, 0xff, 0x68, 0x6c, 0x83, 0xff, 0x69, 0x6f, 0x83, 0xff, 0x46, 0x4e, 0x62, 0xff, 0x2f, 0x35, 0x47, 0xff, 0x33, 0x39, 0x48, 0xff, 0x2f, 0x34, 0x43, 0xff, 0x24, 0x27, 0x33, 0xff, 0x22, 0x27, 0x32, 0xff, 0x1f, 0x22, 0x2c, 0xff, 0x16, 0x19, 0x22, 0xff, 0x19, 0x1c, 0x24, 0xff, 0x11, 0x13, 0x1c, 0xff, 0x10, 0x13, 0x1b, 0xff, 0x16, 0x19, 0x21, 0xff, 0x20, 0x22, 0x29, 0xff, 0x10, 0x16, 0x19, 0xff, 0x1a, 0x20, 0x22, 0xff, 0x11, 0x14, 0x18, 0xff, 0x18, 0x1c, 0x22, 0xff, 0x1a, 0x1c, 0x21, 0xff, 0x2e, 0x2e, 0x31, 0xff, 0x90, 0x84, 0x5f, 0xff, 0xb0, 0xa2, 0x6e, 0xff, 0xa7, 0xa0, 0x8d, 0xff, 0xa4, 0x9b, 0x8f, 0xff, 0x9b, 0x94, 0x82, 0xff, 0x86, 0x89, 0x76, 0xff, 0x88, 0x89, 0x73, 0xff, 0x93, 0x8c, 0x6f, 0xff, 0x9b, 0x93, 0x71, 0xff, 0x9d, 0x94, 0x6d, 0xff, 0x9a, 0x91, 0x6b, 0xff, 0x9f, 0x95, 0x70, 0xff, 0xa0, 0x9a, 0x7d, 0xff, 0x97, 0x9b, 0x90, 0xff, 0x92, 0x9d, 0xa3, 0xff, 0x97, 0xa0, 0xa9, 0xff, 0xa3, 0xa8, 0xa9, 0xff, 0xa1, 0xaa, 0xaa, 0xff, 0xa0, 0xa6, 0xa0, 0xff, 0x96, 0x97, 0x8e, 0xff, 0x98, 0x9c, 0x99, 0xff, 0xa0, 0xa6, 0xa5, 0xff, 0x9a, 0xa0, 0x9f, 0xff, 0x9b, 0x9e, 0x99, 0xff, 0x9e, 0x9e, 0x9b, 0xff, 0x9e, 0xa0, 0x9f, 0xff, 0xa2, 0xa6, 0xa3, 0xff, 0xa3, 0xa5, 0xa4, 0xff, 0x9e, 0xa2, 0xa1, 0xff, 0x9e, 0xa4, 0xa1, 0xc8, 0x99, 0x99, 0x99, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0x9d, 0xab, 0xb8, 0xb1, 0x90, 0xa3, 0xb1, 0xff, 0x9d, 0xad, 0xb5, 0xff, 0xaa, 0xb5, 0xb6, 0xff, 0xa8, 0xae, 0xad, 0xff, 0x9e, 0xa7, 0xa7, 0xff, 0x94, 0x9e, 0xa5, 0xff, 0x8a, 0x98, 0xa1, 0xff, 0xa1, 0xae, 0xb8, 0xff, 0xa8, 0xb1, 0xbc, 0xff, 0x94, 0x9e, 0xa9, 0xff, 0x9d, 0xaa, 0xb4, 0xff, 0x9d, 0xae, 0xb9, 0xff, 0x81, 0x96, 0xa6, 0xff, 0x89, 0x9c, 0xb3, 0xff, 0x91, 0x9f, 0xb5, 0xff, 0x99, 0xa9, 0xb7, 0xff, 0x96, 0xaa, 0xb3, 0xff, 0x9f, 0xb2, 0xc3, 0xff, 0x95, 0xa5, 0xb7, 0xff, 0x58, 0x60, 0x77, 0xff, 0x69, 0x6b, 0x8d, 0xff, 0x95, 0x8b, 0xac, 0xff, 0xb8, 0xa4, 0xb7, 0xff, 0xca, 0xb1, 0xb4, 0xff, 0xcd, 0xb1, 0xb4, 0xff, 0xcd, 0xb2, 0xb7, 0xff, 0xcb, 0xb5, 0xb7, 0xff, 0xc0, 0xad, 0xaf, 0xff, 0xb9, 0xa6, 0xab, 0xff, 0xb0, 0x9d, 0xa6, 0xff, 0xb1, 0x9e, 0xa8, 0xff, 0xa0, 0x8f, 0x9a, 0xff, 0x93, 0x84, 0x92, 0xff, 0x87, 0x7e, 0x8e, 0xff, 0x79, 0x73, 0x87, 0xff, 0x72, 0x6d, 0x83, 0xff, 0x5e, 0x5c, 0x76, 0xff, 0x4b, 0x4c, 0x69, 0xff, 0x4f, 0x52, 0x6d, 0xff, 0x4b, 0x4f, 0x68, 0xff, 0x4a, 0x4f, 0x68, 0xff, 0x46, 0x4c, 0x65, 0xff, 0x49, 0x53, 0x6b, 0xff, 0x4f, 0x58, 0x71, 0xff, 0x5e, 0x63, 0x7c, 0xff, 0x63, 0x66, 0x7f, 0xff, 0x5a, 0x5e, 0x76, 0xff, 0x42, 0x48, 0x5e, 0xff, 0x34, 0x3b, 0x4f, 0xff, 0x32, 0x3a, 0x4c, 0xff, 0x24, 0x2a, 0x3b, 0xff, 0x2d, 0x33, 0x42, 0xff, 0x1a, 0x20, 0x2d, 0xff, 0x1e, 0x23, 0x2f, 0xff, 0x16, 0x1b, 0x25, 0xff, 0x11, 0x17, 0x1e, 0xff, 0x14, 0x18, 0x20, 0xff, 0x15, 0x17, 0x20, 0xff, 0x13, 0x18, 0x1d, 0xff, 0x18, 0x1a, 0x1f, 0xff, 0x0a, 0x11, 0x16, 0xff, 0x11, 0x17, 0x15, 0xff, 0x18, 0x15, 0x11, 0xff, 0x14, 0x18, 0x1f, 0xff, 0x0d, 0x14, 0x1e, 0xff, 0x42, 0x41, 0x41, 0xff, 0xa5, 0x99, 0x7e, 0xff, 0xaf, 0xa6, 0x88, 0xff, 0xa6, 0xa6, 0x97, 0xff, 0x9f, 0x9e, 0x8e, 0xff, 0x98, 0x95, 0x82, 0xff, 0x8d, 0x8e, 0x84, 0xff, 0x83, 0x83, 0x71, 0xff, 0x8d, 0x86, 0x66, 0xff, 0x97, 0x8f, 0x6b, 0xff, 0x99, 0x8f, 0x63, 0xff, 0x97, 0x8b, 0x5e, 0xff, 0xa0, 0x93, 0x6a, 0xff, 0xa6, 0x9c, 0x74, 0xff, 0xa1, 0xa1, 0x8a, 0xff, 0x9a, 0xa3, 0xa6, 0xff, 0x9d, 0xa6, 0xb0, 0xff, 0xa2, 0xa8, 0xac, 0xff, 0x9e, 0xa8, 0xab, 0xff, 0x9a, 0xa0, 0x9a, 0xff, 0x9a, 0x9a, 0x8f, 0xff, 0x9e, 0xa4, 0xa2, 0xff, 0x9e, 0xa8, 0xa9, 0xff, 0x9a, 0xa3, 0xa3, 0xff, 0x9c, 0xa0, 0x9a, 0xff, 0x9f, 0x9f, 0x9b, 0xff, 0xa0, 0xa3, 0xa2, 0xff, 0xa5, 0xa9, 0xa7, 0xff, 0xa4, 0xa6, 0xa5, 0xff, 0xa1, 0xa5, 0xa4, 0xff, 0xa1, 0xa7, 0xa6, 0xff, 0xa1, 0xa4, 0xa2, 0xb1, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xb1, 0xb1, 0x8d, 0xa0, 0xb0, 0xc0, 0xff, 0x9a, 0xac, 0xb7, 0xff, 0xa0, 0xad, 0xb1, 0xff, 0xa9, 0xb0, 0xaf, 0xff, 0xaa, 0xae, 0xab, 0xff, 0x9f, 0xa8, 0xa9, 0xff, 0x8e, 0x99, 0xa2, 0xff, 0x83, 0x92, 0x9d, 0xff, 0xa0, 0xad, 0xb6, 0xff, 0xab, 0xb1, 0xb7, 0xff, 0xaa, 0xae, 0xb5, 0xff, 0xa9, 0xb4, 0xbd, 0xff, 0x98, 0xa9, 0xb5, 0xff, 0x88, 0x9f, 0xb1, 0xff, 0x8c, 0xa0, 0xba, 0xff, 0x90, 0xa0, 0xb7, 0xff, 0x9a, 0xac, 0xb7, 0xff, 0x94, 0xa8, 0xb2, 0xff, 0x98, 0xae, 0xc1, 0xff, 0x62, 0x77, 0x90, 0xff, 0x56, 0x60, 0x7c, 0xff, 0x84, 0x7f, 0x9b, 0xff, 0xa5, 0x93, 0xab, 0xff, 0xbd, 0xa7, 0xb3, 0xff, 0xc7, 0xb4, 0xb4, 0xff, 0xc5, 0xae, 0xb8, 0xff, 0xbc, 0xa5, 0xb5, 0xff, 0xad, 0x9a, 0xa7, 0xff, 0xa1, 0x93, 0x9d, 0xff, 0x9f, 0x93, 0x9f, 0xff, 0x9b, 0x8d, 0x9e, 0xff, 0x8e, 0x7e, 0x90, 0xff, 0x92, 0x83, 0x95, 0xff, 0x8e, 0x83, 0x98, 0xff, 0x7d, 0x76, 0x8d, 0xff, 0x6d, 0x6a, 0x82, 0xff, 0x58, 0x58, 0x71, 0xff, 0x45, 0x47, 0x63, 0xff, 0x52, 0x56, 0x73, 0xff, 0x53, 0x56, 0x71, 0xff, 0x47, 0x4c, 0x64, 0xff, 0x46, 0x4b, 0x64, 0xff, 0x4a, 0x50, 0x66, 0xff, 0x51, 0x58, 0x72, 0xff, 0x58, 0x5e, 0x7a, 0xff, 0x66, 0x69, 0x83, 0xff, 0x62, 0x63, 0x7d, 0xff, 0x4c, 0x4e, 0x67, 0xff, 0x43, 0x46, 0x5f, 0xff, 0x47, 0x4d, 0x63, 0xff, 0x3c, 0x43, 0x56, 0xff, 0x30, 0x38, 0x4a, 0xff, 0x35, 0x3c, 0x4d, 0xff, 0x2c, 0x33, 0x41, 0xff, 0x1b, 0x23, 0x30, 0xff, 0x25, 0x2b, 0x35, 0xff, 0x21, 0x27, 0x2f, 0xff, 0x16, 0x1c, 0x24, 0xff, 0x10, 0x15, 0x1b, 0xff, 0x0d, 0x10, 0x15, 0xff, 0x10, 0x13, 0x16, 0xff, 0x0d, 0x14, 0x1d, 0xff, 0x1b, 0x1c, 0x23, 0xff, 0x22, 0x19, 0x18, 0xff, 0x19, 0x19, 0x25, 0xff, 0x12, 0x19, 0x2a, 0xff, 0x31, 0x2c, 0x2c, 0xff, 0x92, 0x86, 0x77, 0xff, 0xaa, 0xa6, 0x98, 0xff, 0x9e, 0xa4, 0x95, 0xff, 0x93, 0x96, 0x80, 0xff, 0x8b, 0x8a, 0x74, 0xff, 0x77, 0x77, 0x73, 0xff, 0x77, 0x73, 0x6c, 0xff, 0x8d, 0x80, 0x69, 0xff, 0x92, 0x87, 0x67, 0xff, 0x98, 0x88, 0x61, 0xff, 0x99, 0x88, 0x5f, 0xff, 0xa3, 0x91, 0x6e, 0xff, 0xa4, 0x91, 0x61, 0xff, 0xa7, 0x9a, 0x6d, 0xff, 0xa7, 0xa7, 0x9e, 0xff, 0xa7, 0xa9, 0xad, 0xff, 0xa4, 0xa5, 0xa5, 0xff, 0xa0, 0xa7, 0xa4, 0xff, 0x98, 0x9d, 0x95, 0xff, 0x9a, 0x9a, 0x91, 0xff, 0x96, 0x9d, 0x9e, 0xff, 0x93, 0x9e, 0xa3, 0xff, 0x90, 0x9a, 0x9c, 0xff, 0x95, 0x9a, 0x96, 0xff, 0x9c, 0x9d, 0x98, 0xff, 0x9e, 0xa0, 0x9e, 0xff, 0x9f, 0xa3, 0xa0, 0xff, 0x9f, 0xa1, 0xa0, 0xff, 0x9a, 0x9e, 0x9d, 0xff, 0x97, 0x9e, 0x9d, 0xff, 0x9e, 0x9f, 0x9d, 0xff, 0x9d, 0x96, 0x94, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xab, 0xa2, 0x55, 0xa5, 0xb1, 0xb0, 0xfe, 0xa7, 0xb6, 0xbf, 0xff, 0xae, 0xb4, 0xaf, 0xff, 0xa8, 0xaa, 0x9d, 0xff, 0xa4, 0xa9, 0xa3, 0xff, 0xab, 0xb1, 0xaf, 0xff, 0xaa, 0xb2, 0xb4, 0xff, 0x9d, 0xa8, 0xac, 0xff, 0x95, 0xa1, 0xa7, 0xff, 0xa7, 0xaf, 0xb0, 0xff, 0xad, 0xae, 0xa9, 0xff, 0xaf, 0xb1, 0xaf, 0xff, 0xa6, 0xb0, 0xb8, 0xff, 0x90, 0xa1, 0xb2, 0xff, 0x8b, 0xa6, 0xb5, 0xff, 0x95, 0xaa, 0xbf, 0xff, 0x98, 0xa4, 0xb7, 0xff, 0x9b, 0xaa, 0xac, 0xff, 0xab, 0xbd, 0xbf, 0xff, 0x83, 0x94, 0xae, 0xff, 0x45, 0x52, 0x7b, 0xff, 0x73, 0x76, 0x99, 0xff, 0x9c, 0x91, 0xa7, 0xff, 0xb7, 0xa2, 0xaf, 0xff, 0xc2, 0xad, 0xb7, 0xff, 0xbf, 0xad, 0xb5, 0xff, 0xb1, 0x9d, 0xad, 0xff, 0xa7, 0x95, 0xa9, 0xff, 0x96, 0x8c, 0xa0, 0xff, 0x8d, 0x89, 0x9f, 0xff, 0x7e, 0x7c, 0x93, 0xff, 0x71, 0x70, 0x8b, 0xff, 0x78, 0x74, 0x8e, 0xff, 0x79, 0x73, 0x8b, 0xff, 0x67, 0x63, 0x7c, 0xff, 0x62, 0x60, 0x79, 0xff, 0x4e, 0x4e, 0x67, 0xff, 0x4b, 0x4d, 0x66, 0xff, 0x54, 0x57, 0x71, 0xff, 0x4f, 0x53, 0x6c, 0xff, 0x3f, 0x43, 0x5c, 0xff, 0x43, 0x48, 0x61, 0xff, 0x45, 0x4b, 0x64, 0xff, 0x55, 0x5c, 0x74, 0xff, 0x58, 0x5d, 0x78, 0xff, 0x60, 0x63, 0x80, 0xff, 0x5b, 0x5e, 0x7a, 0xff, 0x56, 0x5b, 0x76, 0xff, 0x50, 0x57, 0x71, 0xff, 0x3b, 0x41, 0x5c, 0xff, 0x3b, 0x44, 0x5c, 0xff, 0x40, 0x49, 0x5f, 0xff, 0x34, 0x3d, 0x50, 0xff, 0x31, 0x39, 0x4b, 0xff, 0x36, 0x3d, 0x4f, 0xff, 0x1c, 0x24, 0x35, 0xff, 0x1a, 0x20, 0x2c, 0xff, 0x27, 0x2b, 0x36, 0xff, 0x16, 0x1a, 0x24, 0xff, 0x16, 0x1b, 0x23, 0xff, 0x0d, 0x13, 0x1a, 0xff, 0x0f, 0x16, 0x1c, 0xff, 0x1a, 0x1d, 0x24, 0xff, 0x18, 0x17, 0x1e, 0xff, 0x1c, 0x1d, 0x22, 0xff, 0x1a, 0x1c, 0x25, 0xff, 0x1b, 0x1f, 0x2a, 0xff, 0x16, 0x19, 0x23, 0xff, 0x67, 0x6e, 0x6f, 0xff, 0xa6, 0xac, 0xa2, 0xff, 0xa1, 0x9d, 0x8f, 0xff, 0x88, 0x81, 0x6f, 0xff, 0x71, 0x6f, 0x65, 0xff, 0x55, 0x63, 0x67, 0xff, 0x5b, 0x61, 0x67, 0xff, 0x79, 0x6f, 0x62, 0xff, 0x88, 0x7b, 0x58, 0xff, 0x8a, 0x7e, 0x50, 0xff, 0x8d, 0x80, 0x51, 0xff, 0x9c, 0x87, 0x58, 0xff, 0xa0, 0x84, 0x47, 0xff, 0xa6, 0x8f, 0x54, 0xff, 0xaa, 0xa3, 0x88, 0xff, 0xa3, 0xa8, 0xa4, 0xff, 0x9e, 0xa5, 0xa9, 0xff, 0x9f, 0xa4, 0xa3, 0xff, 0x98, 0x9a, 0x97, 0xff, 0x8e, 0x96, 0x9a, 0xff, 0x7b, 0x8e, 0x96, 0xff, 0x80, 0x90, 0x9c, 0xff, 0x8f, 0x94, 0x9d, 0xff, 0x91, 0x96, 0x96, 0xff, 0x95, 0x98, 0x91, 0xff, 0x9c, 0x9c, 0x94, 0xff, 0x99, 0x9c, 0x96, 0xff, 0x98, 0x9b, 0x98, 0xff, 0x97, 0x9c, 0x9b, 0xff, 0x91, 0x99, 0x99, 0xff, 0x8b, 0x91, 0x92, 0xff, 0x8f, 0x93, 0x95, 0xfe, 0x96, 0x99, 0x99, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xa7, 0xa1, 0x29, 0xa1, 0xaa, 0xa3, 0xf3, 0xa5, 0xb1, 0xb2, 0xff, 0xa8, 0xb5, 0xbd, 0xff, 0xa7, 0xad, 0xa6, 0xff, 0xa0, 0xa4, 0x98, 0xff, 0xa5, 0xac, 0xa8, 0xff, 0xac, 0xb5, 0xb6, 0xff, 0xa9, 0xb5, 0xb9, 0xff, 0xa1, 0xae, 0xb4, 0xff, 0x9d, 0xaa, 0xb0, 0xff, 0xa3, 0xac, 0xac, 0xff, 0xa1, 0xa5, 0x9f, 0xff, 0xa4, 0xa9, 0xa2, 0xff, 0xa4, 0xac, 0xb0, 0xff, 0x95, 0xa3, 0xb0, 0xff, 0x92, 0xa3, 0xaf, 0xff, 0x9b, 0xa9, 0xbc, 0xff, 0x99, 0xa6, 0xc0, 0xff, 0x9a, 0xa9, 0xba, 0xff, 0x9a, 0xaa, 0xba, 0xff, 0x59, 0x64, 0x87, 0xff, 0x61, 0x62, 0x88, 0xff, 0x96, 0x90, 0xab, 0xff, 0xb6, 0xa8, 0xbb, 0xff, 0xbb, 0xa8, 0xb5, 0xff, 0xb7, 0xa6, 0xb4, 0xff, 0xaa, 0x9e, 0xb0, 0xff, 0x99, 0x8d, 0xa4, 0xff, 0x8f, 0x84, 0x9d, 0xff, 0x86, 0x82, 0x9a, 0xff, 0x79, 0x79, 0x92, 0xff, 0x66, 0x67, 0x82, 0xff, 0x66, 0x66, 0x82, 0xff, 0x69, 0x68, 0x83, 0xff, 0x55, 0x54, 0x6e, 0xff, 0x4c, 0x4d, 0x65, 0xff, 0x41, 0x44, 0x5d, 0xff, 0x38, 0x3b, 0x53, 0xff, 0x44, 0x47, 0x5f, 0xff, 0x45, 0x4a, 0x62, 0xff, 0x3d, 0x43, 0x5b, 0xff, 0x3f, 0x44, 0x5d, 0xff, 0x45, 0x4b, 0x63, 0xff, 0x4f, 0x54, 0x6d, 0xff, 0x5e, 0x63, 0x7b, 0xff, 0x5d, 0x62, 0x7c, 0xff, 0x54, 0x58, 0x74, 0xff, 0x49, 0x4e, 0x69, 0xff, 0x45, 0x4d, 0x68, 0xff, 0x46, 0x4f, 0x6a, 0xff, 0x3e, 0x46, 0x62, 0xff, 0x37, 0x41, 0x5a, 0xff, 0x35, 0x40, 0x56, 0xff, 0x29, 0x33, 0x48, 0xff, 0x27, 0x31, 0x44, 0xff, 0x24, 0x2d, 0x3e, 0xff, 0x24, 0x2d, 0x3e, 0xff, 0x1b, 0x23, 0x32, 0xff, 0x1d, 0x21, 0x2e, 0xff, 0x1b, 0x1f, 0x2b, 0xff, 0x1e, 0x22, 0x2d, 0xff, 0x14, 0x19, 0x22, 0xff, 0x11, 0x18, 0x1f, 0xff, 0x1b, 0x1e, 0x24, 0xff, 0x0f, 0x10, 0x14, 0xff, 0x0e, 0x11, 0x17, 0xff, 0x16, 0x19, 0x20, 0xff, 0x14, 0x17, 0x1e, 0xff, 0x0a, 0x0f, 0x1c, 0xff, 0x6c, 0x74, 0x76, 0xff, 0xac, 0xb0, 0xa5, 0xff, 0x9a, 0x99, 0x91, 0xff, 0x7d, 0x7b, 0x75, 0xff, 0x68, 0x6b, 0x69, 0xff, 0x61, 0x6e, 0x70, 0xff, 0x62, 0x6b, 0x6c, 0xff, 0x75, 0x6f, 0x62, 0xff, 0x7e, 0x72, 0x54, 0xff, 0x7b, 0x6e, 0x47, 0xff, 0x83, 0x75, 0x47, 0xff, 0x92, 0x79, 0x3d, 0xff, 0x96, 0x7b, 0x38, 0xff, 0x93, 0x80, 0x4a, 0xff, 0x97, 0x90, 0x70, 0xff, 0x9f, 0xa1, 0x96, 0xff, 0x9f, 0xa3, 0xa0, 0xff, 0xa2, 0xa0, 0x95, 0xff, 0xa2, 0x9d, 0x93, 0xff, 0x95, 0x9a, 0x9b, 0xff, 0x84, 0x94, 0x98, 0xff, 0x89, 0x95, 0x9c, 0xff, 0x98, 0x97, 0x9a, 0xff, 0x9b, 0x9a, 0x90, 0xff, 0x99, 0x9c, 0x93, 0xff, 0x93, 0x96, 0x93, 0xff, 0x95, 0x98, 0x96, 0xff, 0x94, 0x9a, 0x9b, 0xff, 0x92, 0x9a, 0x9d, 0xff, 0x93, 0x9c, 0xa0, 0xff, 0x85, 0x91, 0x98, 0xff, 0x89, 0x99, 0xa0, 0xff, 0x95, 0x9c, 0xa0, 0xf4, 0x91, 0x97, 0x97, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb6, 0xb6, 0x07, 0xa3, 0xae, 0xae, 0xd1, 0xa2, 0xaa, 0xa9, 0xff, 0xa8, 0xb1, 0xb3, 0xff, 0xa9, 0xb1, 0xb8, 0xff, 0xa2, 0xa9, 0xa7, 0xff, 0xa3, 0xaa, 0xa5, 0xff, 0xa9, 0xb2, 0xb3, 0xff, 0xaa, 0xb7, 0xba, 0xff, 0xa6, 0xb3, 0xbd, 0xff, 0x90, 0xa1, 0xad, 0xff, 0x8e, 0x9f, 0xa7, 0xff, 0x9d, 0xa9, 0xab, 0xff, 0x9b, 0xa3, 0x9f, 0xff, 0xa2, 0xa7, 0xa0, 0xff, 0xa7, 0xaf, 0xad, 0xff, 0x9e, 0xa9, 0xae, 0xff, 0x9d, 0xa3, 0xa1, 0xff, 0x9a, 0xa2, 0xaa, 0xff, 0x8f, 0xa1, 0xbd, 0xff, 0x98, 0xaf, 0xd0, 0xff, 0x6c, 0x7c, 0x9d, 0xff, 0x4f, 0x56, 0x79, 0xff, 0x94, 0x8e, 0xa7, 0xff, 0xb8, 0xaa, 0xba, 0xff, 0xbc, 0xac, 0xbd, 0xff, 0xb5, 0xa5, 0xb7, 0xff, 0xa5, 0x9b, 0xb2, 0xff, 0x93, 0x91, 0xac, 0xff, 0x7e, 0x7d, 0x9d, 0xff, 0x73, 0x73, 0x93, 0xff, 0x6b, 0x6e, 0x8a, 0xff, 0x60, 0x64, 0x80, 0xff, 0x5b, 0x5d, 0x79, 0xff, 0x59, 0x58, 0x72, 0xff, 0x4f, 0x50, 0x69, 0xff, 0x43, 0x48, 0x61, 0xff, 0x40, 0x44, 0x5d, 0xff, 0x34, 0x39, 0x52, 0xff, 0x34, 0x39, 0x52, 0xff, 0x44, 0x49, 0x61, 0xff, 0x3b, 0x41, 0x5b, 0xff, 0x3a, 0x41, 0x5b, 0xff, 0x46, 0x4b, 0x66, 0xff, 0x4c, 0x50, 0x6c, 0xff, 0x58, 0x5b, 0x76, 0xff, 0x5c, 0x5e, 0x79, 0xff, 0x4c, 0x52, 0x6d, 0xff, 0x40, 0x4a, 0x65, 0xff, 0x40, 0x48, 0x63, 0xff, 0x38, 0x42, 0x5d, 0xff, 0x32, 0x3d, 0x58, 0xff, 0x33, 0x3d, 0x58, 0xff, 0x31, 0x3b, 0x55, 0xff, 0x28, 0x34, 0x4b, 0xff, 0x2b, 0x37, 0x4e, 0xff, 0x2d, 0x38, 0x4c, 0xff, 0x1c, 0x27, 0x39, 0xff, 0x21, 0x2c, 0x3d, 0xff, 0x20, 0x29, 0x3a, 0xff, 0x19, 0x20, 0x2f, 0xff, 0x18, 0x1f, 0x2d, 0xff, 0x19, 0x1f, 0x2a, 0xff, 0x1b, 0x1f, 0x29, 0xff, 0x0e, 0x14, 0x1c, 0xff, 0x13, 0x18, 0x1d, 0xff, 0x19, 0x1c, 0x22, 0xff, 0x12, 0x13, 0x1b, 0xff, 0x18, 0x1b, 0x23, 0xff, 0x1b, 0x1e, 0x26, 0xff, 0x0c, 0x0f, 0x1b, 0xff, 0x60, 0x60, 0x5d, 0xff, 0xb6, 0xb6, 0xab, 0xff, 0x8f, 0x96, 0x9a, 0xff, 0x67, 0x72, 0x7b, 0xff, 0x63, 0x6c, 0x70, 0xff, 0x6f, 0x72, 0x6e, 0xff, 0x67, 0x6d, 0x64, 0xff, 0x6d, 0x6f, 0x61, 0xff, 0x79, 0x6f, 0x5c, 0xff, 0x74, 0x65, 0x50, 0xff, 0x7e, 0x6d, 0x49, 0xff, 0x8a, 0x71, 0x30, 0xff, 0x92, 0x77, 0x2d, 0xff, 0x8b, 0x75, 0x3b, 0xff, 0x87, 0x7c, 0x54, 0xff, 0x9b, 0x97, 0x83, 0xff, 0x9e, 0xa0, 0x96, 0xff, 0x99, 0x9b, 0x8d, 0xff, 0xa4, 0xa1, 0x97, 0xff, 0x9f, 0xa1, 0x9e, 0xff, 0x95, 0xa3, 0xa4, 0xff, 0x9a, 0xa3, 0xa8, 0xff, 0x9d, 0x9c, 0x9d, 0xff, 0xa2, 0x9e, 0x93, 0xff, 0x9c, 0x9f, 0x98, 0xff, 0x84, 0x8d, 0x92, 0xff, 0x90, 0x99, 0x9c, 0xff, 0x8c, 0x98, 0x9d, 0xff, 0x72, 0x7f, 0x87, 0xff, 0x80, 0x8e, 0x99, 0xff, 0x91, 0xa0, 0xab, 0xff, 0x9b, 0xa9, 0xb1, 0xff, 0x92, 0x9c, 0xa4, 0xff, 0x89, 0x92, 0x97, 0xd1, 0x91, 0x91, 0x91, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xb5, 0xc0, 0x8e, 0xa8, 0xb4, 0xb9, 0xff, 0xa5, 0xad, 0xae, 0xff, 0xab, 0xb0, 0xae, 0xff, 0xad, 0xaf, 0xae, 0xff, 0xa6, 0xab, 0xa8, 0xff, 0xa7, 0xaf, 0xab, 0xff, 0xaa, 0xb5, 0xb5, 0xff, 0xa9, 0xb6, 0xba, 0xff, 0xa3, 0xb1, 0xbb, 0xff, 0x91, 0xa0, 0xab, 0xff, 0x90, 0xa2, 0xa9, 0xff, 0x9f, 0xad, 0xaf, 0xff, 0xa4, 0xac, 0xa9, 0xff, 0xab, 0xb0, 0xac, 0xff, 0xae, 0xb5, 0xb2, 0xff, 0xa5, 0xaf, 0xaf, 0xff, 0x9b, 0x9d, 0x92, 0xff, 0x95, 0x9d, 0x93, 0xff, 0x94, 0xab, 0xb7, 0xff, 0x8a, 0xa4, 0xc2, 0xff, 0x4f, 0x60, 0x81, 0xff, 0x6e, 0x76, 0x8f, 0xff, 0xae, 0xa5, 0xb5, 0xff, 0xb8, 0xa9, 0xb9, 0xff, 0xb0, 0xa3, 0xb6, 0xff, 0xb2, 0xa8, 0xc0, 0xff, 0x99, 0x98, 0xb5, 0xff, 0x76, 0x7e, 0x9e, 0xff, 0x6b, 0x71, 0x95, 0xff, 0x62, 0x67, 0x8c, 0xff, 0x4f, 0x57, 0x78, 0xff, 0x50, 0x57, 0x76, 0xff, 0x49, 0x4c, 0x69, 0xff, 0x45, 0x45, 0x61, 0xff, 0x3c, 0x42, 0x5c, 0xff, 0x33, 0x3c, 0x54, 0xff, 0x30, 0x37, 0x50, 0xff, 0x2e, 0x35, 0x4f, 0xff, 0x3b, 0x41, 0x5a, 0xff, 0x3d, 0x42, 0x5c, 0xff, 0x3c, 0x43, 0x5d, 0xff, 0x3f, 0x46, 0x62, 0xff, 0x44, 0x48, 0x64, 0xff, 0x50, 0x54, 0x71, 0xff, 0x55, 0x59, 0x75, 0xff, 0x4c, 0x4e, 0x6a, 0xff, 0x3d, 0x45, 0x61, 0xff, 0x35, 0x41, 0x5d, 0xff, 0x33, 0x3e, 0x59, 0xff, 0x2f, 0x3b, 0x57, 0xff, 0x2e, 0x3a, 0x56, 0xff, 0x2b, 0x37, 0x53, 0xff, 0x25, 0x31, 0x4d, 0xff, 0x24, 0x30, 0x4a, 0xff, 0x2d, 0x3a, 0x52, 0xff, 0x2b, 0x37, 0x4f, 0xff, 0x23, 0x2f, 0x43, 0xff, 0x1f, 0x2b, 0x3d, 0xff, 0x1e, 0x28, 0x3a, 0xff, 0x24, 0x2e, 0x40, 0xff, 0x12, 0x1a, 0x2b, 0xff, 0x13, 0x1a, 0x27, 0xff, 0x1c, 0x22, 0x2d, 0xff, 0x18, 0x1d, 0x25, 0xff, 0x13, 0x17, 0x1e, 0xff, 0x15, 0x16, 0x1f, 0xff, 0x13, 0x16, 0x1e, 0xff, 0x16, 0x18, 0x20, 0xff, 0x15, 0x17, 0x1f, 0xff, 0x04, 0x07, 0x10, 0xff, 0x4c, 0x4b, 0x48, 0xff, 0xae, 0xad, 0xaa, 0xff, 0x7a, 0x88, 0x93, 0xff, 0x5b, 0x6e, 0x7e, 0xff, 0x67, 0x75, 0x7e, 0xff, 0x66, 0x68, 0x63, 0xff, 0x5f, 0x66, 0x5c, 0xff, 0x60, 0x68, 0x61, 0xff, 0x69, 0x65, 0x5d, 0xff, 0x67, 0x5e, 0x55, 0xff, 0x6e, 0x62, 0x4b, 0xff, 0x7f, 0x6b, 0x35, 0xff, 0x98, 0x79, 0x32, 0xff, 0x94, 0x75, 0x34, 0xff, 0x82, 0x71, 0x46, 0xff, 0x8a, 0x87, 0x73, 0xff, 0x90, 0x98, 0x95, 0xff, 0x84, 0x96, 0x9d, 0xff, 0x8d, 0x98, 0x9e, 0xff, 0x94, 0x9d, 0xa1, 0xff, 0x7a, 0x90, 0x99, 0xff, 0x6d, 0x7e, 0x8d, 0xff, 0x7e, 0x84, 0x8e, 0xff, 0x92, 0x96, 0x95, 0xff, 0x91, 0x9a, 0x9b, 0xff, 0x81, 0x8d, 0x96, 0xff, 0x8f, 0x9a, 0xa3, 0xff, 0x92, 0x9f, 0xaa, 0xff, 0x7f, 0x90, 0x9d, 0xff, 0x6b, 0x7d, 0x8f, 0xff, 0x74, 0x82, 0x8f, 0xff, 0xa2, 0xa8, 0xae, 0xff, 0x97, 0x9e, 0xa3, 0xff, 0x8d, 0x93, 0x94, 0xff, 0x8c, 0x92, 0x94, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xaf, 0xbb, 0x40, 0xa0, 0xac, 0xb5, 0xfe, 0xa0, 0xad, 0xb0, 0xff, 0x9f, 0xa8, 0xa3, 0xff, 0xa4, 0xa5, 0x9a, 0xff, 0xac, 0xa7, 0x99, 0xff, 0xa8, 0xaa, 0x9e, 0xff, 0xa5, 0xa9, 0xa2, 0xff, 0xa8, 0xaf, 0xaa, 0xff, 0xab, 0xb4, 0xb2, 0xff, 0xa2, 0xac, 0xb0, 0xff, 0x99, 0xa4, 0xab, 0xff, 0xa2, 0xb0, 0xb4, 0xff, 0xa5, 0xb1, 0xb3, 0xff, 0xaa, 0xb2, 0xb3, 0xff, 0xae, 0xb4, 0xb5, 0xff, 0xaf, 0xb6, 0xb6, 0xff, 0xad, 0xb6, 0xb8, 0xff, 0xa9, 0xab, 0xa6, 0xff, 0xa1, 0xac, 0x9e, 0xff, 0xa6, 0xbd, 0xbb, 0xff, 0x74, 0x87, 0x9f, 0xff, 0x4c, 0x57, 0x7c, 0xff, 0x82, 0x8a, 0xa3, 0xff, 0xa6, 0xa0, 0xb5, 0xff, 0xa9, 0x9e, 0xb5, 0xff, 0xa7, 0xa1, 0xbb, 0xff, 0xa5, 0xa2, 0xbf, 0xff, 0x80, 0x83, 0xa5, 0xff, 0x65, 0x6f, 0x91, 0xff, 0x5c, 0x64, 0x86, 0xff, 0x50, 0x57, 0x79, 0xff, 0x47, 0x52, 0x71, 0xff, 0x3d, 0x47, 0x66, 0xff, 0x39, 0x3f, 0x5d, 0xff, 0x3a, 0x3d, 0x5c, 0xff, 0x34, 0x3b, 0x57, 0xff, 0x2e, 0x37, 0x51, 0xff, 0x2b, 0x32, 0x4d, 0xff, 0x30, 0x36, 0x51, 0xff, 0x38, 0x3d, 0x59, 0xff, 0x37, 0x3b, 0x57, 0xff, 0x45, 0x47, 0x63, 0xff, 0x54, 0x54, 0x71, 0xff, 0x55, 0x57, 0x73, 0xff, 0x58, 0x5c, 0x78, 0xff, 0x4f, 0x54, 0x70, 0xff, 0x3f, 0x47, 0x62, 0xff, 0x35, 0x40, 0x5c, 0xff, 0x32, 0x3f, 0x5b, 0xff, 0x2b, 0x38, 0x54, 0xff, 0x28, 0x35, 0x52, 0xff, 0x2a, 0x39, 0x55, 0xff, 0x29, 0x39, 0x55, 0xff, 0x27, 0x35, 0x51, 0xff, 0x26, 0x32, 0x4e, 0xff, 0x27, 0x34, 0x4e, 0xff, 0x1e, 0x2a, 0x43, 0xff, 0x1a, 0x28, 0x3e, 0xff, 0x21, 0x2e, 0x42, 0xff, 0x23, 0x2f, 0x44, 0xff, 0x1b, 0x27, 0x3d, 0xff, 0x19, 0x23, 0x35, 0xff, 0x1b, 0x23, 0x33, 0xff, 0x16, 0x1c, 0x28, 0xff, 0x15, 0x1b, 0x23, 0xff, 0x1a, 0x1e, 0x27, 0xff, 0x18, 0x1b, 0x24, 0xff, 0x10, 0x14, 0x1b, 0xff, 0x0d, 0x10, 0x18, 0xff, 0x13, 0x16, 0x1b, 0xff, 0x03, 0x03, 0x08, 0xff, 0x3c, 0x3d, 0x42, 0xff, 0x87, 0x8d, 0x96, 0xff, 0x62, 0x70, 0x7e, 0xff, 0x76, 0x88, 0x96, 0xff, 0x83, 0x92, 0x9a, 0xff, 0x71, 0x77, 0x74, 0xff, 0x59, 0x61, 0x63, 0xff, 0x58, 0x63, 0x6a, 0xff, 0x5f, 0x63, 0x62, 0xff, 0x5a, 0x5f, 0x59, 0xff, 0x59, 0x58, 0x4a, 0xff, 0x75, 0x65, 0x43, 0xff, 0x8f, 0x79, 0x4a, 0xff, 0x92, 0x7f, 0x53, 0xff, 0x87, 0x7a, 0x5e, 0xff, 0x82, 0x82, 0x76, 0xff, 0x86, 0x8f, 0x94, 0xff, 0x77, 0x8e, 0x9d, 0xff, 0x7d, 0x8b, 0x98, 0xff, 0x8a, 0x95, 0x9e, 0xff, 0x6a, 0x85, 0x95, 0xff, 0x5d, 0x73, 0x86, 0xff, 0x76, 0x7f, 0x8f, 0xff, 0x88, 0x92, 0x95, 0xff, 0x8d, 0x99, 0x9c, 0xff, 0x8f, 0x9b, 0xa4, 0xff, 0x91, 0x9e, 0xa8, 0xff, 0x87, 0x97, 0xa3, 0xff, 0x8c, 0x9e, 0xad, 0xff, 0x80, 0x94, 0xa6, 0xff, 0x63, 0x74, 0x83, 0xff, 0x81, 0x8b, 0x95, 0xff, 0x91, 0x9a, 0xa2, 0xff, 0x7c, 0x85, 0x8b, 0xff, 0x7f, 0x89, 0x91, 0xfe, 0x7d, 0x89, 0x91, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xc6, 0x09, 0xa3, 0xb0, 0xb9, 0xdb, 0x9d, 0xaa, 0xaf, 0xff, 0x9c, 0xaa, 0xa7, 0xff, 0xa0, 0xa8, 0x9d, 0xff, 0x9f, 0x9e, 0x8a, 0xff, 0xab, 0xa1, 0x88, 0xff, 0xab, 0xa7, 0x95, 0xff, 0xa7, 0xa8, 0x9a, 0xff, 0xa6, 0xa9, 0x9c, 0xff, 0xa7, 0xaa, 0xa4, 0xff, 0xa2, 0xa8, 0xa6, 0xff, 0xa3, 0xab, 0xac, 0xff, 0xad, 0xb5, 0xb7, 0xff, 0xab, 0xb4, 0xb6, 0xff, 0xaa, 0xb2, 0xb4, 0xff, 0xad, 0xb4, 0xb8, 0xff, 0xae, 0xb6, 0xbc, 0xff, 0xae, 0xb7, 0xbe, 0xff, 0xae, 0xb5, 0xbd, 0xff, 0xaa, 0xb7, 0xb5, 0xff, 0xad, 0xbd, 0xbc, 0xff, 0x65, 0x6d, 0x88, 0xff, 0x5b, 0x5e, 0x8a, 0xff, 0x85, 0x8c, 0xaf, 0xff, 0x96, 0x96, 0xb3, 0xff, 0x9a, 0x95, 0xb4, 0xff, 0x9a, 0x99, 0xba, 0xff, 0x81, 0x83, 0xa5, 0xff, 0x72, 0x77, 0x99, 0xff, 0x62, 0x6a, 0x8c, 0xff, 0x53, 0x5b, 0x7a, 0xff, 0x4b, 0x53, 0x71, 0xff, 0x41, 0x4c, 0x69, 0xff, 0x36, 0x42, 0x5f, 0xff, 0x3b, 0x43, 0x61, 0xff, 0x3c, 0x3f, 0x5f, 0xff, 0x39, 0x3e, 0x5a, 0xff, 0x34, 0x3c, 0x57, 0xff, 0x39, 0x3f, 0x5a, 0xff, 0x42, 0x45, 0x62, 0xff, 0x47, 0x4b, 0x67, 0xff, 0x4c, 0x50, 0x6d, 0xff, 0x61, 0x5d, 0x7b, 0xff, 0x60, 0x5b, 0x7a, 0xff, 0x56, 0x55, 0x73, 0xff, 0x4d, 0x52, 0x6f, 0xff, 0x3f, 0x47, 0x63, 0xff, 0x35, 0x41, 0x5c, 0xff, 0x30, 0x3c, 0x58, 0xff, 0x2c, 0x3a, 0x56, 0xff, 0x2d, 0x3b, 0x57, 0xff, 0x2b, 0x3b, 0x57, 0xff, 0x29, 0x3a, 0x55, 0xff, 0x28, 0x39, 0x54, 0xff, 0x26, 0x35, 0x51, 0xff, 0x25, 0x32, 0x4f, 0xff, 0x25, 0x32, 0x4e, 0xff, 0x1e, 0x2b, 0x43, 0xff, 0x1b, 0x28, 0x3f, 0xff, 0x1e, 0x2b, 0x41, 0xff, 0x1a, 0x28, 0x3f, 0xff, 0x1a, 0x27, 0x3e, 0xff, 0x19, 0x24, 0x37, 0xff, 0x1c, 0x26, 0x35, 0xff, 0x1d, 0x25, 0x2f, 0xff, 0x15, 0x1c, 0x24, 0xff, 0x11, 0x16, 0x1f, 0xff, 0x19, 0x1e, 0x27, 0xff, 0x17, 0x1a, 0x23, 0xff, 0x0f, 0x12, 0x19, 0xff, 0x14, 0x16, 0x1b, 0xff, 0x10, 0x0f, 0x13, 0xff, 0x23, 0x27, 0x33, 0xff, 0x6d, 0x77, 0x8a, 0xff, 0x7b, 0x87, 0x93, 0xff, 0x7a, 0x88, 0x8f, 0xff, 0x82, 0x8f, 0x95, 0xff, 0x8d, 0x96, 0x98, 0xff, 0x6a, 0x76, 0x85, 0xff, 0x5f, 0x6b, 0x7e, 0xff, 0x70, 0x7c, 0x7b, 0xff, 0x5f, 0x6f, 0x6b, 0xff, 0x61, 0x6a, 0x62, 0xff, 0x91, 0x83, 0x6f, 0xff, 0x89, 0x82, 0x6f, 0xff, 0x84, 0x8a, 0x81, 0xff, 0x9b, 0x9d, 0x95, 0xff, 0x9c, 0x9f, 0x9d, 0xff, 0x97, 0x9e, 0xa1, 0xff, 0x89, 0x98, 0xa0, 0xff, 0x93, 0x9c, 0xa2, 0xff, 0x94, 0x9d, 0xa2, 0xff, 0x86, 0x9c, 0xa8, 0xff, 0x8e, 0x9f, 0xaf, 0xff, 0x96, 0x9c, 0xa6, 0xff, 0x9f, 0xa4, 0xa1, 0xff, 0x9e, 0xa8, 0xa8, 0xff, 0x88, 0x94, 0x9d, 0xff, 0x6e, 0x7e, 0x86, 0xff, 0x67, 0x77, 0x82, 0xff, 0x72, 0x83, 0x91, 0xff, 0x64, 0x77, 0x85, 0xff, 0x3c, 0x50, 0x62, 0xff, 0x49, 0x5c, 0x72, 0xff, 0x76, 0x87, 0x99, 0xff, 0x74, 0x84, 0x97, 0xff, 0x79, 0x8b, 0x9f, 0xff, 0x62, 0x77, 0x8f, 0xdb, 0x55, 0x55, 0x71, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xb2, 0xc1, 0x88, 0xa3, 0xb5, 0xba, 0xff, 0x9c, 0xaa, 0xad, 0xff, 0x99, 0xa4, 0xaa, 0xff, 0x9f, 0xa5, 0xa4, 0xff, 0x9a, 0x99, 0x8c, 0xff, 0xa3, 0x9f, 0x87, 0xff, 0xa3, 0xa6, 0x9b, 0xff, 0xa5, 0xaa, 0xa4, 0xff, 0xa7, 0xab, 0xa3, 0xff, 0xa6, 0xaa, 0xa4, 0xff, 0xa4, 0xad, 0xac, 0xff, 0xa7, 0xb5, 0xb9, 0xff, 0x9f, 0xb0, 0xb9, 0xff, 0xa3, 0xb2, 0xba, 0xff, 0xac, 0xb6, 0xb8, 0xff, 0xac, 0xb6, 0xb8, 0xff, 0xab, 0xb7, 0xbf, 0xff, 0x9f, 0xae, 0xbd, 0xff, 0x91, 0xa8, 0xbc, 0xff, 0x9f, 0xb6, 0xc4, 0xff, 0x9a, 0xab, 0xb5, 0xff, 0x53, 0x5c, 0x77, 0xff, 0x5e, 0x67, 0x8d, 0xff, 0x75, 0x84, 0xa4, 0xff, 0x8c, 0x92, 0xb5, 0xff, 0x8b, 0x8c, 0xb0, 0xff, 0x82, 0x85, 0xa7, 0xff, 0x73, 0x78, 0x9b, 0xff, 0x69, 0x71, 0x95, 0xff, 0x4d, 0x58, 0x7e, 0xff, 0x45, 0x4f, 0x75, 0xff, 0x40, 0x48, 0x6d, 0xff, 0x37, 0x40, 0x64, 0xff, 0x36, 0x40, 0x5f, 0xff, 0x34, 0x3d, 0x58, 0xff, 0x37, 0x3f, 0x58, 0xff, 0x3f, 0x44, 0x5f, 0xff, 0x42, 0x45, 0x62, 0xff, 0x46, 0x4a, 0x67, 0xff, 0x59, 0x5b, 0x7a, 0xff, 0x60, 0x62, 0x80, 0xff, 0x64, 0x65, 0x84, 0xff, 0x62, 0x61, 0x81, 0xff, 0x52, 0x51, 0x70, 0xff, 0x48, 0x4b, 0x68, 0xff, 0x43, 0x49, 0x66, 0xff, 0x34, 0x40, 0x5c, 0xff, 0x2d, 0x3a, 0x56, 0xff, 0x2e, 0x3a, 0x55, 0xff, 0x28, 0x34, 0x51, 0xff, 0x25, 0x33, 0x4f, 0xff, 0x2d, 0x3d, 0x57, 0xff, 0x29, 0x3a, 0x54, 0xff, 0x27, 0x38, 0x52, 0xff, 0x26, 0x37, 0x53, 0xff, 0x23, 0x34, 0x51, 0xff, 0x1d, 0x2e, 0x47, 0xff, 0x22, 0x30, 0x46, 0xff, 0x20, 0x2c, 0x42, 0xff, 0x1a, 0x25, 0x3b, 0xff, 0x1b, 0x2a, 0x41, 0xff, 0x1b, 0x2a, 0x41, 0xff, 0x1d, 0x2a, 0x3f, 0xff, 0x26, 0x31, 0x41, 0xff, 0x1b, 0x24, 0x31, 0xff, 0x12, 0x18, 0x24, 0xff, 0x16, 0x1e, 0x2a, 0xff, 0x12, 0x19, 0x23, 0xff, 0x15, 0x16, 0x21, 0xff, 0x13, 0x12, 0x1b, 0xff, 0x12, 0x13, 0x18, 0xff, 0x0f, 0x0f, 0x12, 0xff, 0x09, 0x12, 0x1c, 0xff, 0x6e, 0x7c, 0x88, 0xff, 0x92, 0x9b, 0x9b, 0xff, 0x80, 0x88, 0x83, 0xff, 0x8b, 0x97, 0x96, 0xff, 0x99, 0xa5, 0xab, 0xff, 0x7d, 0x96, 0xa5, 0xff, 0x71, 0x8f, 0x9f, 0xff, 0x88, 0x9b, 0xa3, 0xff, 0x85, 0x90, 0x97, 0xff, 0x85, 0x92, 0x9d, 0xff, 0x86, 0x94, 0xa5, 0xff, 0x67, 0x7c, 0x8e, 0xff, 0x6b, 0x82, 0x92, 0xff, 0x87, 0x9b, 0xa7, 0xff, 0x87, 0x98, 0xa3, 0xff, 0x86, 0x99, 0xa6, 0xff, 0x86, 0x9e, 0xb0, 0xff, 0x8e, 0xa3, 0xb1, 0xff, 0x83, 0x95, 0xa0, 0xff, 0x71, 0x88, 0x9d, 0xff, 0x54, 0x6d, 0x87, 0xff, 0x59, 0x6d, 0x85, 0xff, 0x83, 0x90, 0xa1, 0xff, 0x77, 0x85, 0x9a, 0xff, 0x42, 0x56, 0x71, 0xff, 0x31, 0x46, 0x61, 0xff, 0x39, 0x4e, 0x6b, 0xff, 0x3d, 0x4f, 0x69, 0xff, 0x36, 0x43, 0x58, 0xff, 0x27, 0x32, 0x4a, 0xff, 0x2f, 0x3f, 0x59, 0xff, 0x43, 0x59, 0x6f, 0xff, 0x4b, 0x65, 0x7c, 0xff, 0x4a, 0x62, 0x7c, 0xff, 0x4c, 0x5e, 0x7b, 0xff, 0x3d, 0x4b, 0x67, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xae, 0xbb, 0x26, 0x9d, 0xb4, 0xbf, 0xfa, 0x9f, 0xb4, 0xbd, 0xff, 0x9b, 0xae, 0xba, 0xff, 0x9a, 0xab, 0xbc, 0xff, 0x99, 0xa8, 0xb6, 0xff, 0x98, 0xa4, 0xa9, 0xff, 0xa0, 0xab, 0xa8, 0xff, 0xa7, 0xb4, 0xb8, 0xff, 0xa9, 0xb5, 0xbe, 0xff, 0xa7, 0xb1, 0xb8, 0xff, 0xa6, 0xb2, 0xb9, 0xff, 0xa4, 0xb4, 0xc0, 0xff, 0x9b, 0xae, 0xc1, 0xff, 0x82, 0x9e, 0xb2, 0xff, 0x8d, 0xa6, 0xb7, 0xff, 0xa1, 0xb3, 0xbf, 0xff, 0xa8, 0xb9, 0xc4, 0xff, 0x9f, 0xb3, 0xc4, 0xff, 0x84, 0x9d, 0xb5, 0xff, 0x86, 0xa0, 0xb6, 0xff, 0xad, 0xc4, 0xd5, 0xff, 0x84, 0x95, 0xa6, 0xff, 0x47, 0x52, 0x70, 0xff, 0x62, 0x6f, 0x92, 0xff, 0x6c, 0x7d, 0x9d, 0xff, 0x7a, 0x83, 0xa7, 0xff, 0x76, 0x7b, 0xa0, 0xff, 0x76, 0x7c, 0x9e, 0xff, 0x67, 0x6e, 0x90, 0xff, 0x5a, 0x64, 0x89, 0xff, 0x4d, 0x5a, 0x82, 0xff, 0x48, 0x52, 0x7a, 0xff, 0x3c, 0x45, 0x6b, 0xff, 0x42, 0x4b, 0x6e, 0xff, 0x43, 0x4a, 0x6b, 0xff, 0x42, 0x49, 0x67, 0xff, 0x42, 0x49, 0x65, 0xff, 0x48, 0x4b, 0x69, 0xff, 0x50, 0x51, 0x6e, 0xff, 0x69, 0x6a, 0x87, 0xff, 0x75, 0x72, 0x8f, 0xff, 0x70, 0x6c, 0x88, 0xff, 0x72, 0x6b, 0x86, 0xff, 0x62, 0x5e, 0x7c, 0xff, 0x56, 0x56, 0x76, 0xff, 0x4a, 0x4d, 0x6b, 0xff, 0x39, 0x3e, 0x5c, 0xff, 0x2d, 0x37, 0x54, 0xff, 0x2a, 0x36, 0x52, 0xff, 0x25, 0x32, 0x4f, 0xff, 0x26, 0x33, 0x50, 0xff, 0x26, 0x34, 0x50, 0xff, 0x25, 0x35, 0x51, 0xff, 0x27, 0x38, 0x53, 0xff, 0x25, 0x36, 0x51, 0xff, 0x27, 0x39, 0x55, 0xff, 0x23, 0x36, 0x53, 0xff, 0x1f, 0x30, 0x4b, 0xff, 0x1e, 0x2e, 0x46, 0xff, 0x20, 0x2f, 0x46, 0xff, 0x22, 0x2f, 0x45, 0xff, 0x1b, 0x29, 0x40, 0xff, 0x1b, 0x2a, 0x41, 0xff, 0x1d, 0x29, 0x3f, 0xff, 0x1a, 0x25, 0x37, 0xff, 0x20, 0x28, 0x38, 0xff, 0x1b, 0x22, 0x30, 0xff, 0x14, 0x1b, 0x29, 0xff, 0x10, 0x17, 0x23, 0xff, 0x14, 0x16, 0x21, 0xff, 0x1b, 0x1a, 0x24, 0xff, 0x16, 0x18, 0x1d, 0xff, 0x0d, 0x10, 0x13, 0xff, 0x11, 0x16, 0x19, 0xff, 0x30, 0x36, 0x36, 0xff, 0x7a, 0x80, 0x7d, 0xff, 0xa5, 0xac, 0xa9, 0xff, 0xab, 0xb4, 0xb4, 0xff, 0xaf, 0xb7, 0xbb, 0xff, 0xa2, 0xb6, 0xbd, 0xff, 0x9c, 0xb7, 0xc0, 0xff, 0xa7, 0xb8, 0xc1, 0xff, 0xa5, 0xb4, 0xc5, 0xff, 0x83, 0x9b, 0xbb, 0xff, 0x50, 0x78, 0xa9, 0xff, 0x4a, 0x74, 0xa3, 0xff, 0x62, 0x86, 0xaa, 0xff, 0x66, 0x8a, 0xab, 0xff, 0x61, 0x7f, 0x9a, 0xff, 0x78, 0x90, 0xa4, 0xff, 0xa8, 0xb7, 0xc1, 0xff, 0xa5, 0xbc, 0xce, 0xff, 0x7e, 0xa1, 0xc2, 0xff, 0x5f, 0x84, 0xa9, 0xff, 0x3c, 0x64, 0x8e, 0xff, 0x45, 0x6b, 0x95, 0xff, 0x5a, 0x7a, 0xa3, 0xff, 0x44, 0x5d, 0x82, 0xff, 0x46, 0x5e, 0x7f, 0xff, 0x4b, 0x67, 0x8e, 0xff, 0x51, 0x6d, 0x97, 0xff, 0x3f, 0x5b, 0x84, 0xff, 0x3c, 0x53, 0x7a, 0xff, 0x39, 0x4f, 0x74, 0xff, 0x3f, 0x57, 0x7b, 0xff, 0x4d, 0x6b, 0x8e, 0xff, 0x50, 0x72, 0x95, 0xff, 0x3c, 0x5d, 0x82, 0xff, 0x42, 0x5c, 0x82, 0xff, 0x39, 0x51, 0x7c, 0xfa, 0x35, 0x57, 0x86, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xc7, 0xcb, 0xb3, 0xc3, 0xcf, 0xce, 0xff, 0xc1, 0xce, 0xd3, 0xff, 0xbf, 0xcf, 0xdb, 0xff, 0xba, 0xcc, 0xdb, 0xff, 0xaf, 0xc1, 0xd4, 0xff, 0xad, 0xc0, 0xd0, 0xff, 0xb0, 0xc3, 0xd0, 0xff, 0xba, 0xca, 0xda, 0xff, 0xbb, 0xcb, 0xdc, 0xff, 0xb5, 0xc4, 0xd4, 0xff, 0xb4, 0xc5, 0xd7, 0xff, 0xb4, 0xc7, 0xdd, 0xff, 0xac, 0xc1, 0xdb, 0xff, 0xa4, 0xbf, 0xd6, 0xff, 0xa8, 0xc1, 0xd5, 0xff, 0xac, 0xc1, 0xd2, 0xff, 0xb6, 0xca, 0xdb, 0xff, 0xb4, 0xcb, 0xdf, 0xff, 0xa8, 0xc2, 0xdb, 0xff, 0xb1, 0xc5, 0xd9, 0xff, 0xcc, 0xdd, 0xeb, 0xff, 0x80, 0x8f, 0xa3, 0xff, 0x46, 0x50, 0x73, 0xff, 0x64, 0x6f, 0x99, 0xff, 0x62, 0x71, 0x97, 0xff, 0x5d, 0x6a, 0x8d, 0xff, 0x6e, 0x78, 0x9d, 0xff, 0x68, 0x72, 0x93, 0xff, 0x53, 0x5d, 0x7f, 0xff, 0x5d, 0x69, 0x8d, 0xff, 0x48, 0x5a, 0x81, 0xff, 0x44, 0x4f, 0x74, 0xff, 0x5b, 0x63, 0x85, 0xff, 0x5b, 0x63, 0x85, 0xff, 0x57, 0x5d, 0x82, 0xff, 0x5f, 0x64, 0x89, 0xff, 0x63, 0x68, 0x8c, 0xff, 0x66, 0x6a, 0x91, 0xff, 0x73, 0x78, 0x9c, 0xff, 0x86, 0x87, 0xa8, 0xff, 0x8b, 0x88, 0xa7, 0xff, 0x90, 0x8a, 0xa6, 0xff, 0x96, 0x8d, 0xa5, 0xff, 0x92, 0x8c, 0xa6, 0xff, 0x7e, 0x7d, 0x9a, 0xff, 0x5b, 0x5d, 0x7a, 0xff, 0x41, 0x46, 0x63, 0xff, 0x2e, 0x35, 0x53, 0xff, 0x25, 0x31, 0x4c, 0xff, 0x27, 0x33, 0x51, 0xff, 0x24, 0x33, 0x51, 0xff, 0x23, 0x31, 0x4f, 0xff, 0x23, 0x32, 0x50, 0xff, 0x23, 0x32, 0x51, 0xff, 0x27, 0x36, 0x56, 0xff, 0x24, 0x38, 0x56, 0xff, 0x20, 0x36, 0x52, 0xff, 0x23, 0x35, 0x53, 0xff, 0x1f, 0x30, 0x4e, 0xff, 0x1d, 0x2d, 0x48, 0xff, 0x1d, 0x2d, 0x46, 0xff, 0x1b, 0x27, 0x40, 0xff, 0x21, 0x2e, 0x44, 0xff, 0x20, 0x2d, 0x43, 0xff, 0x13, 0x1f, 0x31, 0xff, 0x1b, 0x24, 0x36, 0xff, 0x1a, 0x22, 0x32, 0xff, 0x1e, 0x26, 0x34, 0xff, 0x1c, 0x24, 0x31, 0xff, 0x10, 0x13, 0x1e, 0xff, 0x13, 0x14, 0x1d, 0xff, 0x13, 0x16, 0x1c, 0xff, 0x13, 0x19, 0x1d, 0xff, 0x09, 0x09, 0x08, 0xff, 0x31, 0x2e, 0x2d, 0xff, 0xae, 0xb5, 0xbb, 0xff, 0xc7, 0xd3, 0xdc, 0xff, 0xc5, 0xd1, 0xd9, 0xff, 0xcb, 0xd2, 0xd8, 0xff, 0xce, 0xd8, 0xde, 0xff, 0xbe, 0xcb, 0xcf, 0xff, 0xc0, 0xc9, 0xcd, 0xff, 0xc1, 0xce, 0xdb, 0xff, 0x93, 0xab, 0xc9, 0xff, 0x5c, 0x84, 0xb7, 0xff, 0x76, 0x9d, 0xca, 0xff, 0x9f, 0xbf, 0xe1, 0xff, 0x94, 0xb8, 0xdf, 0xff, 0x8a, 0xaa, 0xcc, 0xff, 0xa3, 0xb8, 0xcb, 0xff, 0xd3, 0xd9, 0xdb, 0xff, 0xd6, 0xde, 0xe1, 0xff, 0xc0, 0xd5, 0xe3, 0xff, 0xb5, 0xcb, 0xdd, 0xff, 0xb0, 0xc7, 0xde, 0xff, 0xaf, 0xc5, 0xde, 0xff, 0xa8, 0xba, 0xd2, 0xff, 0x91, 0xa6, 0xbd, 0xff, 0x87, 0xa0, 0xbd, 0xff, 0x89, 0xa4, 0xc5, 0xff, 0x81, 0x9f, 0xc7, 0xff, 0x5d, 0x7c, 0xaa, 0xff, 0x50, 0x71, 0xa2, 0xff, 0x5b, 0x7d, 0xab, 0xff, 0x65, 0x85, 0xb1, 0xff, 0x7e, 0xa2, 0xcb, 0xff, 0x93, 0xb9, 0xdf, 0xff, 0x7e, 0xa4, 0xcd, 0xff, 0x79, 0x9d, 0xcf, 0xff, 0x77, 0x99, 0xc4, 0xff, 0x83, 0xa7, 0xca, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xd5, 0xdd, 0x44, 0xdb, 0xe2, 0xe2, 0xff, 0xe0, 0xe5, 0xe1, 0xff, 0xe1, 0xe4, 0xe4, 0xff, 0xdc, 0xe1, 0xe3, 0xff, 0xd4, 0xdf, 0xe5, 0xff, 0xcc, 0xd8, 0xe1, 0xff, 0xc8, 0xd5, 0xde, 0xff, 0xc6, 0xd2, 0xdb, 0xff, 0xcc, 0xd6, 0xe1, 0xff, 0xce, 0xd9, 0xe4, 0xff, 0xca, 0xd6, 0xe4, 0xff, 0xc7, 0xd4, 0xe4, 0xff, 0xc7, 0xd4, 0xe5, 0xff, 0xcc, 0xd9, 0xea, 0xff, 0xcf, 0xdf, 0xec, 0xff, 0xce, 0xde, 0xe9, 0xff, 0xca, 0xd9, 0xe3, 0xff, 0xcc, 0xda, 0xe5, 0xff, 0xce, 0xdc, 0xe9, 0xff, 0xca, 0xda, 0xe9, 0xff, 0xc9, 0xd5, 0xe5, 0xff, 0xd7, 0xe6, 0xf2, 0xff, 0x7f, 0x8e, 0xa1, 0xff, 0x3d, 0x49, 0x6f, 0xff, 0x55, 0x60, 0x8f, 0xff, 0x58, 0x67, 0x8f, 0xff, 0x60, 0x6e, 0x92, 0xff, 0x60, 0x6d, 0x92, 0xff, 0x5b, 0x66, 0x88, 0xff, 0x5f, 0x68, 0x8c, 0xff, 0x55, 0x62, 0x87, 0xff, 0x44, 0x55, 0x7d, 0xff, 0x5d, 0x67, 0x8d, 0xff, 0x6c, 0x74, 0x96, 0xff, 0x69, 0x72, 0x97, 0xff, 0x71, 0x7a, 0xa0, 0xff, 0x6d, 0x75, 0x9d, 0xff, 0x71, 0x78, 0xa1, 0xff, 0x77, 0x82, 0xaf, 0xff, 0x85, 0x90, 0xbd, 0xff, 0x86, 0x8e, 0xb6, 0xff, 0x7c, 0x80, 0xa4, 0xff, 0x7d, 0x7d, 0x9d, 0xff, 0x87, 0x84, 0xa3, 0xff, 0x83, 0x80, 0x98, 0xff, 0x73, 0x71, 0x86, 0xff, 0x66, 0x67, 0x7f, 0xff, 0x45, 0x4a, 0x62, 0xff, 0x3a, 0x41, 0x5a, 0xff, 0x37, 0x41, 0x59, 0xff, 0x33, 0x3e, 0x58, 0xff, 0x2c, 0x3a, 0x55, 0xff, 0x29, 0x36, 0x50, 0xff, 0x27, 0x34, 0x50, 0xff, 0x24, 0x32, 0x4f, 0xff, 0x26, 0x33, 0x52, 0xff, 0x22, 0x34, 0x50, 0xff, 0x21, 0x35, 0x50, 0xff, 0x23, 0x36, 0x53, 0xff, 0x22, 0x34, 0x54, 0xff, 0x1f, 0x30, 0x4e, 0xff, 0x19, 0x2b, 0x45, 0xff, 0x16, 0x26, 0x3d, 0xff, 0x23, 0x30, 0x46, 0xff, 0x18, 0x26, 0x3b, 0xff, 0x1b, 0x28, 0x3b, 0xff, 0x1b, 0x26, 0x39, 0xff, 0x19, 0x23, 0x35, 0xff, 0x20, 0x2a, 0x39, 0xff, 0x1f, 0x27, 0x34, 0xff, 0x18, 0x1a, 0x27, 0xff, 0x12, 0x13, 0x1d, 0xff, 0x10, 0x12, 0x1a, 0xff, 0x0e, 0x13, 0x18, 0xff, 0x00, 0x00, 0x01, 0xff, 0x78, 0x79, 0x7e, 0xff, 0xe1, 0xec, 0xf5, 0xff, 0xc7, 0xd6, 0xe2, 0xff, 0xc5, 0xd2, 0xdf, 0xff, 0xc2, 0xcc, 0xd7, 0xff, 0xc4, 0xcc, 0xd6, 0xff, 0xb8, 0xbf, 0xc4, 0xff, 0xc5, 0xc5, 0xbf, 0xff, 0xd2, 0xce, 0xc4, 0xff, 0xbb, 0xbd, 0xba, 0xff, 0x9f, 0xaa, 0xb7, 0xff, 0xb8, 0xbf, 0xc5, 0xff, 0xd6, 0xd9, 0xd6, 0xff, 0xcb, 0xd7, 0xe1, 0xff, 0xbf, 0xcf, 0xde, 0xff, 0xc3, 0xd1, 0xdc, 0xff, 0xcf, 0xd8, 0xdf, 0xff, 0xd8, 0xdc, 0xd9, 0xff, 0xd8, 0xdb, 0xd4, 0xff, 0xd6, 0xdb, 0xdb, 0xff, 0xd5, 0xdd, 0xe3, 0xff, 0xd4, 0xde, 0xe5, 0xff, 0xd0, 0xd8, 0xe0, 0xff, 0xc2, 0xce, 0xdb, 0xff, 0xaa, 0xbc, 0xcf, 0xff, 0xb1, 0xc4, 0xd8, 0xff, 0xb1, 0xc8, 0xe1, 0xff, 0x97, 0xb1, 0xd1, 0xff, 0x8b, 0xa8, 0xcf, 0xff, 0x8e, 0xac, 0xd3, 0xff, 0x92, 0xaf, 0xd2, 0xff, 0x9a, 0xb4, 0xd3, 0xff, 0xa8, 0xc1, 0xdc, 0xff, 0xa7, 0xc4, 0xe2, 0xff, 0x97, 0xb5, 0xdc, 0xff, 0x96, 0xb5, 0xda, 0xff, 0x94, 0xb5, 0xd4, 0xff, 0x87, 0xa8, 0xce, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xcf, 0xdd, 0xc8, 0xc4, 0xd3, 0xe2, 0xff, 0xc4, 0xd3, 0xe4, 0xff, 0xb8, 0xc5, 0xd5, 0xff, 0xb3, 0xc1, 0xcf, 0xff, 0xbd, 0xcd, 0xdb, 0xff, 0xbd, 0xce, 0xdd, 0xff, 0xc0, 0xd0, 0xdd, 0xff, 0xc5, 0xd2, 0xe0, 0xff, 0xce, 0xd5, 0xda, 0xff, 0xd2, 0xd9, 0xde, 0xff, 0xcc, 0xd5, 0xdf, 0xff, 0xc6, 0xd1, 0xdb, 0xff, 0xca, 0xd4, 0xdc, 0xff, 0xd1, 0xd9, 0xdf, 0xff, 0xd4, 0xdd, 0xdf, 0xff, 0xd5, 0xdf, 0xe1, 0xff, 0xd4, 0xdd, 0xe1, 0xff, 0xd2, 0xdc, 0xe1, 0xff, 0xcf, 0xd7, 0xde, 0xff, 0xc9, 0xd1, 0xd8, 0xff, 0xce, 0xd7, 0xe0, 0xff, 0xe1, 0xee, 0xf6, 0xff, 0x74, 0x85, 0x95, 0xff, 0x38, 0x47, 0x6c, 0xff, 0x5a, 0x67, 0x95, 0xff, 0x5b, 0x6c, 0x92, 0xff, 0x60, 0x6e, 0x94, 0xff, 0x64, 0x70, 0x96, 0xff, 0x62, 0x6c, 0x91, 0xff, 0x57, 0x60, 0x85, 0xff, 0x51, 0x5c, 0x82, 0xff, 0x70, 0x7a, 0xa5, 0xff, 0x6b, 0x75, 0x9e, 0xff, 0x64, 0x6f, 0x95, 0xff, 0x71, 0x7d, 0xa5, 0xff, 0x65, 0x70, 0x9a, 0xff, 0x5b, 0x69, 0x91, 0xff, 0x57, 0x67, 0x90, 0xff, 0x4b, 0x54, 0x7f, 0xff, 0x5b, 0x61, 0x88, 0xff, 0x6d, 0x73, 0x97, 0xff, 0x61, 0x66, 0x86, 0xff, 0x50, 0x53, 0x6f, 0xff, 0x3f, 0x41, 0x5c, 0xff, 0x32, 0x31, 0x43, 0xff, 0x25, 0x23, 0x30, 0xff, 0x1b, 0x1c, 0x2d, 0xff, 0x0d, 0x12, 0x23, 0xff, 0x0c, 0x13, 0x25, 0xff, 0x0f, 0x19, 0x2e, 0xff, 0x15, 0x20, 0x32, 0xff, 0x20, 0x2a, 0x39, 0xff, 0x24, 0x2e, 0x41, 0xff, 0x26, 0x31, 0x46, 0xff, 0x2c, 0x38, 0x4e, 0xff, 0x2f, 0x38, 0x51, 0xff, 0x2b, 0x3a, 0x50, 0xff, 0x26, 0x39, 0x50, 0xff, 0x26, 0x36, 0x55, 0xff, 0x26, 0x34, 0x56, 0xff, 0x24, 0x34, 0x51, 0xff, 0x1f, 0x31, 0x49, 0xff, 0x1d, 0x2d, 0x43, 0xff, 0x1a, 0x27, 0x3e, 0xff, 0x18, 0x25, 0x3a, 0xff, 0x1a, 0x28, 0x3a, 0xff, 0x1b, 0x28, 0x3b, 0xff, 0x17, 0x25, 0x38, 0xff, 0x10, 0x1b, 0x2c, 0xff, 0x14, 0x1b, 0x2a, 0xff, 0x1b, 0x20, 0x2d, 0xff, 0x12, 0x13, 0x1e, 0xff, 0x14, 0x16, 0x1e, 0xff, 0x0c, 0x11, 0x16, 0xff, 0x00, 0x01, 0x07, 0xff, 0x48, 0x4d, 0x53, 0xff, 0xc6, 0xc8, 0xc8, 0xff, 0xbf, 0xc0, 0xbd, 0xff, 0xb0, 0xb4, 0xb3, 0xff, 0x9e, 0xa6, 0xab, 0xff, 0x9d, 0xa4, 0xac, 0xff, 0xab, 0xaa, 0xaa, 0xff, 0xc5, 0xbb, 0xa7, 0xff, 0xd3, 0xc0, 0x9d, 0xff, 0xcc, 0xbb, 0x96, 0xff, 0xc2, 0xb4, 0x9a, 0xff, 0xc6, 0xb7, 0x9c, 0xff, 0xca, 0xba, 0x9a, 0xff, 0xc8, 0xbc, 0xa4, 0xff, 0xcb, 0xc5, 0xb5, 0xff, 0xc9, 0xcc, 0xc7, 0xff, 0xbe, 0xc9, 0xcb, 0xff, 0xc1, 0xcd, 0xd4, 0xff, 0xc6, 0xcf, 0xd9, 0xff, 0xc8, 0xd4, 0xdf, 0xff, 0xc6, 0xd6, 0xe5, 0xff, 0xba, 0xcd, 0xe0, 0xff, 0xaa, 0xc3, 0xd9, 0xff, 0xaa, 0xbf, 0xd4, 0xff, 0xac, 0xbc, 0xcb, 0xff, 0xb7, 0xc6, 0xd5, 0xff, 0xbb, 0xca, 0xd9, 0xff, 0xb2, 0xc4, 0xd6, 0xff, 0xb5, 0xc9, 0xe1, 0xff, 0xad, 0xc4, 0xde, 0xff, 0x9c, 0xb2, 0xca, 0xff, 0x9d, 0xad, 0xbc, 0xff, 0xb3, 0xbe, 0xca, 0xff, 0xbc, 0xcc, 0xdc, 0xff, 0x9b, 0xb0, 0xc6, 0xff, 0x8b, 0xa9, 0xcd, 0xff, 0x73, 0x98, 0xc7, 0xff, 0x68, 0x8c, 0xbb, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xc3, 0xd7, 0x4d, 0xa2, 0xb8, 0xd2, 0xff, 0x91, 0xaf, 0xd2, 0xff, 0x84, 0xa7, 0xd3, 0xff, 0x7f, 0xa1, 0xce, 0xff, 0x81, 0xa3, 0xcd, 0xff, 0x88, 0xab, 0xd0, 0xff, 0x88, 0xa8, 0xc9, 0xff, 0x92, 0xae, 0xcd, 0xff, 0xa1, 0xb9, 0xda, 0xff, 0xc6, 0xd0, 0xd8, 0xff, 0xd3, 0xda, 0xdb, 0xff, 0xc2, 0xcf, 0xd9, 0xff, 0xbf, 0xcd, 0xd7, 0xff, 0xcd, 0xd8, 0xe0, 0xff, 0xd3, 0xdc, 0xe1, 0xff, 0xd5, 0xdd, 0xde, 0xff, 0xd5, 0xdd, 0xdf, 0xff, 0xd0, 0xd9, 0xde, 0xff, 0xcf, 0xd7, 0xde, 0xff, 0xce, 0xd5, 0xdc, 0xff, 0xce, 0xd4, 0xda, 0xff, 0xd2, 0xd9, 0xdb, 0xff, 0xdd, 0xe8, 0xe9, 0xff, 0x71, 0x81, 0x90, 0xff, 0x38, 0x49, 0x6f, 0xff, 0x57, 0x66, 0x92, 0xff, 0x69, 0x79, 0x9c, 0xff, 0x69, 0x79, 0x9d, 0xff, 0x70, 0x7c, 0xa2, 0xff, 0x60, 0x67, 0x8c, 0xff, 0x49, 0x50, 0x74, 0xff, 0x69, 0x6f, 0x96, 0xff, 0x72, 0x79, 0xa3, 0xff, 0x61, 0x6c, 0x98, 0xff, 0x5e, 0x6b, 0x98, 0xff, 0x5e, 0x6b, 0x98, 0xff, 0x42, 0x53, 0x7f, 0xff, 0x1c, 0x30, 0x57, 0xff, 0x2b, 0x42, 0x6b, 0xff, 0x63, 0x68, 0x87, 0xff, 0x62, 0x5c, 0x73, 0xff, 0x37, 0x37, 0x4d, 0xff, 0x24, 0x23, 0x37, 0xff, 0x20, 0x1f, 0x31, 0xff, 0x19, 0x1a, 0x2a, 0xff, 0x08, 0x06, 0x11, 0xff, 0x00, 0x00, 0x05, 0xff, 0x00, 0x02, 0x0c, 0xff, 0x18, 0x1c, 0x29, 0xff, 0x1d, 0x25, 0x33, 0xff, 0x1c, 0x25, 0x36, 0xff, 0x12, 0x1b, 0x27, 0xff, 0x00, 0x02, 0x09, 0xff, 0x07, 0x10, 0x1b, 0xff, 0x0a, 0x13, 0x22, 0xff, 0x11, 0x1a, 0x2a, 0xff, 0x16, 0x20, 0x31, 0xff, 0x17, 0x25, 0x35, 0xff, 0x1a, 0x2b, 0x3f, 0xff, 0x25, 0x31, 0x4f, 0xff, 0x2d, 0x38, 0x59, 0xff, 0x2c, 0x3a, 0x56, 0xff, 0x1e, 0x30, 0x44, 0xff, 0x17, 0x27, 0x3c, 0xff, 0x1b, 0x28, 0x3f, 0xff, 0x1d, 0x2a, 0x41, 0xff, 0x18, 0x26, 0x39, 0xff, 0x13, 0x21, 0x35, 0xff, 0x12, 0x22, 0x36, 0xff, 0x13, 0x1f, 0x2f, 0xff, 0x19, 0x21, 0x2e, 0xff, 0x1a, 0x20, 0x2d, 0xff, 0x12, 0x15, 0x1e, 0xff, 0x11, 0x14, 0x1c, 0xff, 0x10, 0x16, 0x1c, 0xff, 0x00, 0x05, 0x0d, 0xff, 0x22, 0x21, 0x25, 0xff, 0xb0, 0xa3, 0x90, 0xff, 0xc9, 0xb8, 0x98, 0xff, 0xb8, 0xab, 0x91, 0xff, 0xa3, 0xa0, 0x97, 0xff, 0xa0, 0x9d, 0x9c, 0xff, 0xb8, 0xac, 0xa0, 0xff, 0xcb, 0xb8, 0x98, 0xff, 0xd4, 0xbb, 0x8d, 0xff, 0xd3, 0xbb, 0x8d, 0xff, 0xca, 0xb5, 0x94, 0xff, 0xbf, 0xb1, 0x93, 0xff, 0xbb, 0xab, 0x87, 0xff, 0xc3, 0xac, 0x84, 0xff, 0xca, 0xb5, 0x90, 0xff, 0xcd, 0xc4, 0xad, 0xff, 0xc9, 0xd1, 0xca, 0xff, 0xc8, 0xd1, 0xd3, 0xff, 0xce, 0xd3, 0xd7, 0xff, 0xcf, 0xd6, 0xdb, 0xff, 0xcd, 0xd8, 0xe1, 0xff, 0xb7, 0xc7, 0xd5, 0xff, 0xa6, 0xb9, 0xcb, 0xff, 0xa6, 0xbe, 0xd5, 0xff, 0xa8, 0xc1, 0xd7, 0xff, 0xb4, 0xc8, 0xd9, 0xff, 0xb3, 0xc1, 0xcf, 0xff, 0xaa, 0xb7, 0xc5, 0xff, 0xb5, 0xc4, 0xd3, 0xff, 0xb1, 0xc6, 0xda, 0xff, 0xb1, 0xc6, 0xd9, 0xff, 0xc3, 0xcd, 0xd6, 0xff, 0xcf, 0xd5, 0xda, 0xff, 0xc6, 0xcf, 0xda, 0xff, 0xa3, 0xba, 0xcd, 0xff, 0x9f, 0xb6, 0xd0, 0xff, 0x98, 0xa8, 0xc5, 0xff, 0x8a, 0x9b, 0xb6, 0xff, 0x98, 0xa5, 0xc0, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xc4, 0xcf, 0xcd, 0xb0, 0xc2, 0xd2, 0xff, 0x8f, 0xaa, 0xcb, 0xff, 0x70, 0x96, 0xc5, 0xff, 0x7e, 0xa0, 0xce, 0xff, 0x90, 0xaa, 0xd6, 0xff, 0x85, 0xa1, 0xcc, 0xff, 0x79, 0x9c, 0xc3, 0xff, 0x73, 0x94, 0xb9, 0xff, 0x87, 0xa1, 0xc4, 0xff, 0xc8, 0xd0, 0xd6, 0xff, 0xd5, 0xd8, 0xd3, 0xff, 0xc1, 0xc8, 0xc9, 0xff, 0xbc, 0xc5, 0xca, 0xff, 0xba, 0xc8, 0xd5, 0xff, 0xb4, 0xc6, 0xdb, 0xff, 0xba, 0xc7, 0xd2, 0xff, 0xc3, 0xca, 0xcf, 0xff, 0xc4, 0xc9, 0xcd, 0xff, 0xc6, 0xc9, 0xca, 0xff, 0xc6, 0xc9, 0xc7, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xe0, 0xd4, 0xc5, 0xff, 0xe2, 0xdd, 0xcc, 0xff, 0x69, 0x7a, 0x86, 0xff, 0x34, 0x48, 0x7a, 0xff, 0x5e, 0x6d, 0xa4, 0xff, 0x84, 0x8f, 0xad, 0xff, 0x7e, 0x8c, 0xae, 0xff, 0x71, 0x7c, 0xa5, 0xff, 0x60, 0x63, 0x87, 0xff, 0x5d, 0x5f, 0x81, 0xff, 0x68, 0x71, 0x95, 0xff, 0x5d, 0x70, 0x96, 0xff, 0x4c, 0x5c, 0x93, 0xff, 0x3e, 0x4d, 0x7c, 0xff, 0x23, 0x2f, 0x50, 0xff, 0x3c, 0x3e, 0x68, 0xff, 0x6c, 0x69, 0x93, 0xff, 0x5a, 0x58, 0x76, 0xff, 0x58, 0x56, 0x62, 0xff, 0x45, 0x43, 0x52, 0xff, 0x28, 0x2e, 0x4a, 0xff, 0x34, 0x41, 0x63, 0xff, 0x42, 0x4e, 0x6f, 0xff, 0x4c, 0x54, 0x72, 0xff, 0x43, 0x4c, 0x69, 0xff, 0x17, 0x1c, 0x2f, 0xff, 0x09, 0x08, 0x0f, 0xff, 0x1d, 0x1e, 0x28, 0xff, 0x44, 0x4b, 0x5c, 0xff, 0x34, 0x38, 0x49, 0xff, 0x3f, 0x4a, 0x5d, 0xff, 0x2c, 0x3d, 0x50, 0xff, 0x14, 0x1e, 0x2b, 0xff, 0x15, 0x1b, 0x25, 0xff, 0x0f, 0x15, 0x1e, 0xff, 0x07, 0x0f, 0x19, 0xff, 0x08, 0x0d, 0x18, 0xff, 0x0a, 0x0d, 0x1a, 0xff, 0x0c, 0x10, 0x1f, 0xff, 0x11, 0x14, 0x25, 0xff, 0x19, 0x1f, 0x2f, 0xff, 0x1e, 0x25, 0x35, 0xff, 0x1e, 0x28, 0x38, 0xff, 0x21, 0x2e, 0x3e, 0xff, 0x1d, 0x2a, 0x3c, 0xff, 0x19, 0x27, 0x3a, 0xff, 0x12, 0x22, 0x37, 0xff, 0x13, 0x25, 0x3d, 0xff, 0x1b, 0x29, 0x38, 0xff, 0x1b, 0x24, 0x2d, 0xff, 0x18, 0x20, 0x2d, 0xff, 0x13, 0x15, 0x22, 0xff, 0x0e, 0x0f, 0x17, 0xff, 0x14, 0x16, 0x16, 0xff, 0x11, 0x0e, 0x21, 0xff, 0x14, 0x0b, 0x13, 0xff, 0x91, 0x83, 0x50, 0xff, 0xdc, 0xc8, 0x73, 0xff, 0xc6, 0xaf, 0x63, 0xff, 0xb7, 0xa1, 0x77, 0xff, 0xb3, 0xa2, 0x7f, 0xff, 0xc2, 0xb0, 0x82, 0xff, 0xcd, 0xb4, 0x80, 0xff, 0xcf, 0xb6, 0x7c, 0xff, 0xc9, 0xb2, 0x7d, 0xff, 0xb9, 0xa8, 0x7d, 0xff, 0xba, 0xa7, 0x79, 0xff, 0xc8, 0xae, 0x79, 0xff, 0xce, 0xb3, 0x82, 0xff, 0xcb, 0xb6, 0x8b, 0xff, 0xd2, 0xc6, 0xa7, 0xff, 0xcf, 0xcd, 0xbb, 0xff, 0xc1, 0xc3, 0xb9, 0xff, 0xc5, 0xc7, 0xbf, 0xff, 0xc4, 0xc7, 0xc3, 0xff, 0xbe, 0xc6, 0xc8, 0xff, 0xb4, 0xc0, 0xc7, 0xff, 0xac, 0xbb, 0xc7, 0xff, 0xaf, 0xc2, 0xce, 0xff, 0xb0, 0xc6, 0xd0, 0xff, 0xac, 0xbf, 0xcd, 0xff, 0x9f, 0xaf, 0xbd, 0xff, 0xa7, 0xb5, 0xc1, 0xff, 0xb0, 0xc0, 0xc6, 0xff, 0xaf, 0xc1, 0xc9, 0xff, 0xaf, 0xc2, 0xcd, 0xff, 0xaf, 0xc3, 0xcc, 0xff, 0xaf, 0xc3, 0xce, 0xff, 0xab, 0xbd, 0xcb, 0xff, 0x98, 0xa9, 0xb7, 0xff, 0x87, 0x94, 0xa7, 0xff, 0x8d, 0x97, 0xa9, 0xff, 0x8e, 0x96, 0x98, 0xff, 0x94, 0x96, 0x8b, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xb7, 0xcb, 0x40, 0xac, 0xc1, 0xd4, 0xff, 0xad, 0xc2, 0xd9, 0xff, 0x8e, 0xa8, 0xc9, 0xff, 0x76, 0x98, 0xbf, 0xff, 0x7c, 0x9e, 0xc7, 0xff, 0x8b, 0xa5, 0xcf, 0xff, 0x80, 0x9b, 0xc6, 0xff, 0x7e, 0xa4, 0xcc, 0xff, 0x6e, 0x95, 0xba, 0xff, 0x7d, 0x9a, 0xbc, 0xff, 0xaf, 0xbe, 0xd3, 0xff, 0xb0, 0xbd, 0xcb, 0xff, 0xab, 0xb6, 0xc7, 0xff, 0xa2, 0xae, 0xc2, 0xff, 0x98, 0xa9, 0xc2, 0xff, 0x99, 0xae, 0xce, 0xff, 0x97, 0xaf, 0xca, 0xff, 0x98, 0xac, 0xc2, 0xff, 0x9e, 0xaf, 0xc0, 0xff, 0xa4, 0xb3, 0xc0, 0xff, 0xa3, 0xb1, 0xbc, 0xff, 0xa2, 0xb1, 0xbe, 0xff, 0xa6, 0xaf, 0xbc, 0xff, 0xa3, 0xaf, 0xb4, 0xff, 0x5c, 0x68, 0x74, 0xff, 0x50, 0x55, 0x7c, 0xff, 0x76, 0x7d, 0xb2, 0xff, 0x80, 0x91, 0xbc, 0xff, 0x87, 0x87, 0xb2, 0xff, 0x73, 0x6f, 0x9b, 0xff, 0x59, 0x68, 0x8d, 0xff, 0x49, 0x61, 0x85, 0xff, 0x53, 0x69, 0x90, 0xff, 0x56, 0x69, 0x95, 0xff, 0x29, 0x3a, 0x6a, 0xff, 0x2a, 0x3b, 0x5b, 0xff, 0x63, 0x70, 0x83, 0xff, 0x66, 0x64, 0x7f, 0xff, 0x5b, 0x50, 0x6c, 0xff, 0x79, 0x6c, 0x76, 0xff, 0xa3, 0xa1, 0xaa, 0xff, 0x7c, 0x80, 0x9a, 0xff, 0x6c, 0x76, 0x98, 0xff, 0x5b, 0x6b, 0x92, 0xff, 0x49, 0x56, 0x7d, 0xff, 0x43, 0x4a, 0x6b, 0xff, 0x47, 0x52, 0x73, 0xff, 0x3e, 0x46, 0x5d, 0xff, 0x0f, 0x0d, 0x18, 0xff, 0x13, 0x15, 0x23, 0xff, 0x1d, 0x27, 0x3c, 0xff, 0x02, 0x0a, 0x1e, 0xff, 0x0e, 0x17, 0x30, 0xff, 0x23, 0x30, 0x4b, 0xff, 0x15, 0x1f, 0x31, 0xff, 0x17, 0x1e, 0x2a, 0xff, 0x10, 0x16, 0x22, 0xff, 0x05, 0x0d, 0x1a, 0xff, 0x0a, 0x0e, 0x1c, 0xff, 0x16, 0x18, 0x25, 0xff, 0x0e, 0x11, 0x1d, 0xff, 0x07, 0x09, 0x15, 0xff, 0x03, 0x05, 0x11, 0xff, 0x05, 0x05, 0x12, 0xff, 0x0e, 0x12, 0x1e, 0xff, 0x14, 0x1c, 0x26, 0xff, 0x15, 0x1e, 0x29, 0xff, 0x1d, 0x29, 0x37, 0xff, 0x23, 0x2f, 0x40, 0xff, 0x17, 0x24, 0x37, 0xff, 0x13, 0x1e, 0x2c, 0xff, 0x19, 0x21, 0x2c, 0xff, 0x18, 0x1f, 0x2f, 0xff, 0x09, 0x0d, 0x1d, 0xff, 0x12, 0x15, 0x23, 0xff, 0x09, 0x0b, 0x18, 0xff, 0x04, 0x07, 0x0b, 0xff, 0x1b, 0x21, 0x18, 0xff, 0x81, 0x7e, 0x6b, 0xff, 0x95, 0x8c, 0x6f, 0xff, 0x92, 0x88, 0x6a, 0xff, 0xa5, 0x9e, 0x84, 0xff, 0xab, 0xaa, 0x91, 0xff, 0xa6, 0xa5, 0x8a, 0xff, 0x9e, 0x99, 0x7b, 0xff, 0x96, 0x8f, 0x71, 0xff, 0x8f, 0x8c, 0x72, 0xff, 0x81, 0x86, 0x73, 0xff, 0x80, 0x81, 0x72, 0xff, 0x87, 0x84, 0x76, 0xff, 0x91, 0x90, 0x85, 0xff, 0x9d, 0x9f, 0x99, 0xff, 0x98, 0x9f, 0xa2, 0xff, 0x89, 0x95, 0xa0, 0xff, 0x88, 0x98, 0xa6, 0xff, 0x8b, 0x9d, 0xa9, 0xff, 0x89, 0x9d, 0xac, 0xff, 0x87, 0x9d, 0xb1, 0xff, 0x81, 0x9b, 0xb1, 0xff, 0x75, 0x90, 0xaa, 0xff, 0x76, 0x91, 0xa7, 0xff, 0x81, 0x9c, 0xae, 0xff, 0x7e, 0x98, 0xb0, 0xff, 0x81, 0x9a, 0xb4, 0xff, 0x86, 0x9e, 0xb6, 0xff, 0x7e, 0x98, 0xa8, 0xff, 0x7e, 0x98, 0xa8, 0xff, 0x73, 0x8e, 0xa0, 0xff, 0x67, 0x86, 0x9a, 0xff, 0x59, 0x7a, 0x90, 0xff, 0x69, 0x86, 0x9e, 0xff, 0x84, 0x99, 0xad, 0xff, 0x62, 0x7a, 0x9b, 0xff, 0x50, 0x70, 0x9b, 0xff, 0x57, 0x74, 0x8e, 0xff, 0x5c, 0x75, 0x7f, 0xff, 0x5f, 0x6f, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x9e, 0xb3, 0xb3, 0x81, 0xa1, 0xc1, 0xff, 0x7f, 0x9f, 0xc4, 0xff, 0x77, 0x96, 0xb9, 0xff, 0x83, 0x9e, 0xbd, 0xff, 0x7b, 0x9d, 0xbc, 0xff, 0x78, 0x96, 0xb9, 0xff, 0x7d, 0x99, 0xbd, 0xff, 0x78, 0x9c, 0xbe, 0xff, 0x65, 0x8a, 0xa8, 0xff, 0x75, 0x90, 0xac, 0xff, 0x7c, 0x97, 0xb7, 0xff, 0x7f, 0x9b, 0xb9, 0xff, 0x85, 0x9d, 0xb8, 0xff, 0x84, 0x96, 0xb1, 0xff, 0x86, 0x96, 0xae, 0xff, 0x8a, 0x9b, 0xb2, 0xff, 0x81, 0x9c, 0xbb, 0xff, 0x6d, 0x8c, 0xaa, 0xff, 0x6d, 0x85, 0x9f, 0xff, 0x74, 0x8b, 0xa1, 0xff, 0x78, 0x8f, 0xa4, 0xff, 0x78, 0x8f, 0xa5, 0xff, 0x65, 0x83, 0xa2, 0xff, 0x5b, 0x76, 0x92, 0xff, 0x59, 0x65, 0x80, 0xff, 0x65, 0x69, 0x91, 0xff, 0x78, 0x80, 0xb4, 0xff, 0x68, 0x7c, 0xb3, 0xff, 0x59, 0x6e, 0x9c, 0xff, 0x4b, 0x62, 0x8a, 0xff, 0x43, 0x5e, 0x87, 0xff, 0x36, 0x50, 0x7a, 0xff, 0x33, 0x41, 0x71, 0xff, 0x54, 0x54, 0x88, 0xff, 0x51, 0x5d, 0x81, 0xff, 0x67, 0x7c, 0x8f, 0xff, 0x4f, 0x5c, 0x6c, 0xff, 0x4d, 0x52, 0x61, 0xff, 0x8f, 0x8a, 0x97, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xe8, 0xe9, 0xfa, 0xff, 0x66, 0x6f, 0x92, 0xff, 0x5c, 0x65, 0x85, 0xff, 0x4e, 0x55, 0x76, 0xff, 0x45, 0x4a, 0x69, 0xff, 0x42, 0x45, 0x5f, 0xff, 0x3b, 0x43, 0x5e, 0xff, 0x45, 0x4c, 0x5f, 0xff, 0x1b, 0x1b, 0x29, 0xff, 0x08, 0x0f, 0x25, 0xff, 0x05, 0x14, 0x30, 0xff, 0x0e, 0x1c, 0x36, 0xff, 0x0d, 0x1a, 0x35, 0xff, 0x06, 0x12, 0x2e, 0xff, 0x0c, 0x16, 0x2f, 0xff, 0x0c, 0x16, 0x2a, 0xff, 0x0d, 0x17, 0x2b, 0xff, 0x0c, 0x14, 0x29, 0xff, 0x09, 0x12, 0x26, 0xff, 0x0f, 0x18, 0x29, 0xff, 0x0d, 0x14, 0x25, 0xff, 0x0c, 0x11, 0x1f, 0xff, 0x10, 0x13, 0x1d, 0xff, 0x0c, 0x0d, 0x16, 0xff, 0x08, 0x09, 0x11, 0xff, 0x0a, 0x0d, 0x14, 0xff, 0x0d, 0x10, 0x17, 0xff, 0x12, 0x16, 0x20, 0xff, 0x17, 0x1d, 0x28, 0xff, 0x24, 0x2b, 0x36, 0xff, 0x22, 0x29, 0x37, 0xff, 0x0b, 0x11, 0x21, 0xff, 0x1f, 0x25, 0x38, 0xff, 0x57, 0x5c, 0x73, 0xff, 0x52, 0x59, 0x70, 0xff, 0x33, 0x3c, 0x58, 0xff, 0x12, 0x1c, 0x1b, 0xff, 0x0d, 0x19, 0x10, 0xff, 0x5a, 0x64, 0x7d, 0xff, 0x69, 0x73, 0x9b, 0xff, 0x6d, 0x7b, 0x9b, 0xff, 0x84, 0x99, 0x9f, 0xff, 0x78, 0x8b, 0x98, 0xff, 0x80, 0x8c, 0xa9, 0xff, 0x73, 0x7f, 0x96, 0xff, 0x5b, 0x66, 0x7f, 0xff, 0x4e, 0x5e, 0x7b, 0xff, 0x46, 0x5a, 0x7f, 0xff, 0x4e, 0x69, 0x8b, 0xff, 0x52, 0x70, 0x8c, 0xff, 0x4a, 0x66, 0x83, 0xff, 0x53, 0x6d, 0x8a, 0xff, 0x49, 0x63, 0x81, 0xff, 0x4b, 0x66, 0x89, 0xff, 0x4f, 0x6a, 0x89, 0xff, 0x3c, 0x57, 0x70, 0xff, 0x3f, 0x5b, 0x75, 0xff, 0x54, 0x70, 0x8b, 0xff, 0x53, 0x70, 0x8a, 0xff, 0x42, 0x5f, 0x7a, 0xff, 0x38, 0x54, 0x6d, 0xff, 0x41, 0x5d, 0x72, 0xff, 0x3f, 0x59, 0x71, 0xff, 0x4f, 0x67, 0x80, 0xff, 0x49, 0x61, 0x79, 0xff, 0x43, 0x5c, 0x71, 0xff, 0x54, 0x6c, 0x80, 0xff, 0x4e, 0x67, 0x79, 0xff, 0x45, 0x5f, 0x71, 0xff, 0x3e, 0x58, 0x69, 0xff, 0x4a, 0x61, 0x74, 0xff, 0x61, 0x77, 0x8b, 0xff, 0x54, 0x66, 0x7f, 0xff, 0x45, 0x55, 0x70, 0xff, 0x44, 0x56, 0x69, 0xff, 0x46, 0x58, 0x67, 0xff, 0x40, 0x51, 0x5f, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x87, 0x96, 0x22, 0x70, 0x85, 0x99, 0xfe, 0x5c, 0x7c, 0x9d, 0xff, 0x52, 0x73, 0x96, 0xff, 0x5b, 0x77, 0x93, 0xff, 0x71, 0x86, 0x9a, 0xff, 0x6f, 0x88, 0x96, 0xff, 0x72, 0x85, 0x96, 0xff, 0x6f, 0x80, 0x93, 0xff, 0x5e, 0x79, 0x89, 0xff, 0x5a, 0x73, 0x83, 0xff, 0x6a, 0x78, 0x87, 0xff, 0x64, 0x7c, 0x8c, 0xff, 0x65, 0x83, 0x91, 0xff, 0x66, 0x7f, 0x8a, 0xff, 0x6c, 0x7e, 0x86, 0xff, 0x67, 0x75, 0x78, 0xff, 0x61, 0x6c, 0x6b, 0xff, 0x5b, 0x6c, 0x76, 0xff, 0x47, 0x58, 0x67, 0xff, 0x49, 0x57, 0x60, 0xff, 0x57, 0x63, 0x6a, 0xff, 0x60, 0x6c, 0x74, 0xff, 0x5d, 0x6b, 0x73, 0xff, 0x59, 0x64, 0x63, 0xff, 0x56, 0x63, 0x73, 0xff, 0x5c, 0x6e, 0xa0, 0xff, 0x69, 0x7f, 0xbe, 0xff, 0x63, 0x77, 0xb1, 0xff, 0x46, 0x53, 0x83, 0xff, 0x26, 0x46, 0x6a, 0xff, 0x14, 0x34, 0x5a, 0xff, 0x29, 0x33, 0x64, 0xff, 0x4a, 0x4e, 0x7a, 0xff, 0x64, 0x76, 0xa3, 0xff, 0x82, 0xa6, 0xd2, 0xff, 0x7c, 0x96, 0xb3, 0xff, 0x28, 0x32, 0x4b, 0xff, 0x18, 0x25, 0x42, 0xff, 0xba, 0xc7, 0xde, 0xff, 0xc6, 0xce, 0xdd, 0xff, 0xca, 0xca, 0xd4, 0xff, 0x9d, 0xa3, 0xbc, 0xff, 0x48, 0x53, 0x73, 0xff, 0x48, 0x4f, 0x6a, 0xff, 0x43, 0x47, 0x5f, 0xff, 0x3b, 0x3e, 0x53, 0xff, 0x39, 0x3b, 0x50, 0xff, 0x2c, 0x36, 0x4b, 0xff, 0x38, 0x3f, 0x51, 0xff, 0x1b, 0x1d, 0x2f, 0xff, 0x08, 0x11, 0x2d, 0xff, 0x10, 0x20, 0x3f, 0xff, 0x02, 0x11, 0x29, 0xff, 0x0f, 0x1b, 0x33, 0xff, 0x16, 0x22, 0x3e, 0xff, 0x16, 0x22, 0x3f, 0xff, 0x18, 0x24, 0x40, 0xff, 0x1a, 0x26, 0x41, 0xff, 0x17, 0x21, 0x3e, 0xff, 0x15, 0x21, 0x39, 0xff, 0x10, 0x1c, 0x31, 0xff, 0x0b, 0x16, 0x29, 0xff, 0x09, 0x12, 0x22, 0xff, 0x0b, 0x11, 0x1e, 0xff, 0x09, 0x0e, 0x1b, 0xff, 0x09, 0x0d, 0x17, 0xff, 0x08, 0x0c, 0x13, 0xff, 0x0c, 0x10, 0x18, 0xff, 0x0d, 0x11, 0x1a, 0xff, 0x04, 0x0a, 0x13, 0xff, 0x07, 0x0b, 0x13, 0xff, 0x16, 0x18, 0x21, 0xff, 0x29, 0x2d, 0x40, 0xff, 0x52, 0x56, 0x6e, 0xff, 0x44, 0x4a, 0x68, 0xff, 0x15, 0x1e, 0x3d, 0xff, 0x12, 0x1d, 0x3b, 0xff, 0x34, 0x3a, 0x53, 0xff, 0x15, 0x15, 0x2a, 0xff, 0x21, 0x32, 0x48, 0xff, 0x55, 0x6e, 0x82, 0xff, 0x54, 0x6f, 0x80, 0xff, 0x52, 0x69, 0x77, 0xff, 0x44, 0x5b, 0x62, 0xff, 0x56, 0x6f, 0x72, 0xff, 0x51, 0x69, 0x6e, 0xff, 0x36, 0x4f, 0x56, 0xff, 0x23, 0x40, 0x4a, 0xff, 0x31, 0x50, 0x5d, 0xff, 0x47, 0x65, 0x76, 0xff, 0x4c, 0x68, 0x7c, 0xff, 0x3c, 0x58, 0x6a, 0xff, 0x3d, 0x55, 0x66, 0xff, 0x3a, 0x4f, 0x5e, 0xff, 0x40, 0x51, 0x5f, 0xff, 0x3d, 0x4f, 0x59, 0xff, 0x30, 0x40, 0x49, 0xff, 0x31, 0x40, 0x49, 0xff, 0x3e, 0x4c, 0x54, 0xff, 0x48, 0x53, 0x58, 0xff, 0x42, 0x4e, 0x52, 0xff, 0x36, 0x40, 0x44, 0xff, 0x3b, 0x44, 0x47, 0xff, 0x3e, 0x46, 0x47, 0xff, 0x3f, 0x47, 0x47, 0xff, 0x3e, 0x45, 0x44, 0xff, 0x43, 0x49, 0x48, 0xff, 0x4f, 0x55, 0x54, 0xff, 0x4a, 0x4e, 0x4d, 0xff, 0x46, 0x4a, 0x44, 0xff, 0x4d, 0x50, 0x4a, 0xff, 0x52, 0x55, 0x4f, 0xff, 0x56, 0x59, 0x57, 0xff, 0x4d, 0x4d, 0x4a, 0xff, 0x4d, 0x48, 0x42, 0xff, 0x53, 0x51, 0x49, 0xff, 0x52, 0x50, 0x49, 0xff, 0x4d, 0x4d, 0x49, 0xfe, 0x52, 0x52, 0x52, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x55, 0x64, 0x86, 0x40, 0x52, 0x62, 0xff, 0x3a, 0x50, 0x63, 0xff, 0x38, 0x4f, 0x61, 0xff, 0x3d, 0x51, 0x60, 0xff, 0x44, 0x55, 0x5e, 0xff, 0x44, 0x55, 0x59, 0xff, 0x50, 0x59, 0x5f, 0xff, 0x52, 0x5b, 0x64, 0xff, 0x4a, 0x5b, 0x63, 0xff, 0x4a, 0x5b, 0x62, 0xff, 0x52, 0x58, 0x5e, 0xff, 0x4c, 0x59, 0x5a, 0xff, 0x46, 0x59, 0x59, 0xff, 0x49, 0x5b, 0x5c, 0xff, 0x51, 0x60, 0x60, 0xff, 0x49, 0x55, 0x50, 0xff, 0x47, 0x4d, 0x45, 0xff, 0x3d, 0x45, 0x45, 0xff, 0x37, 0x3f, 0x40, 0xff, 0x3e, 0x43, 0x40, 0xff, 0x47, 0x4a, 0x46, 0xff, 0x4d, 0x52, 0x4f, 0xff, 0x4e, 0x55, 0x53, 0xff, 0x45, 0x48, 0x39, 0xff, 0x5b, 0x5d, 0x67, 0xff, 0x69, 0x74, 0xa8, 0xff, 0x50, 0x64, 0x99, 0xff, 0x49, 0x5b, 0x7e, 0xff, 0x42, 0x4a, 0x64, 0xff, 0x38, 0x3b, 0x59, 0xff, 0x71, 0x73, 0x92, 0xff, 0xb5, 0xb6, 0xc9, 0xff, 0xdd, 0xf1, 0xff, 0xff, 0x9e, 0xcb, 0xf2, 0xff, 0x5e, 0xa4, 0xc7, 0xff, 0x2c, 0x4d, 0x66, 0xff, 0x10, 0x15, 0x36, 0xff, 0x67, 0x7e, 0xab, 0xff, 0x7f, 0x9e, 0xc1, 0xff, 0x5d, 0x7e, 0x94, 0xff, 0x65, 0x81, 0xa0, 0xff, 0x5c, 0x6d, 0x8c, 0xff, 0x35, 0x3e, 0x55, 0xff, 0x38, 0x3c, 0x4d, 0xff, 0x32, 0x33, 0x3f, 0xff, 0x2d, 0x30, 0x3d, 0xff, 0x28, 0x2d, 0x3f, 0xff, 0x1c, 0x27, 0x3b, 0xff, 0x2c, 0x34, 0x46, 0xff, 0x20, 0x21, 0x37, 0xff, 0x10, 0x18, 0x37, 0xff, 0x14, 0x1f, 0x3d, 0xff, 0x00, 0x07, 0x18, 0xff, 0x0a, 0x14, 0x27, 0xff, 0x0a, 0x17, 0x32, 0xff, 0x10, 0x1f, 0x3c, 0xff, 0x16, 0x27, 0x45, 0xff, 0x1c, 0x2d, 0x4a, 0xff, 0x20, 0x2e, 0x4b, 0xff, 0x1d, 0x2a, 0x45, 0xff, 0x19, 0x27, 0x40, 0xff, 0x19, 0x27, 0x3f, 0xff, 0x1b, 0x28, 0x40, 0xff, 0x1b, 0x27, 0x3e, 0xff, 0x15, 0x21, 0x37, 0xff, 0x12, 0x1d, 0x2f, 0xff, 0x12, 0x1c, 0x2c, 0xff, 0x0e, 0x18, 0x29, 0xff, 0x14, 0x1e, 0x2e, 0xff, 0x19, 0x23, 0x33, 0xff, 0x02, 0x0a, 0x18, 0xff, 0x08, 0x0c, 0x1b, 0xff, 0x39, 0x3e, 0x57, 0xff, 0x24, 0x2b, 0x48, 0xff, 0x06, 0x10, 0x2f, 0xff, 0x19, 0x26, 0x45, 0xff, 0x05, 0x14, 0x2f, 0xff, 0x05, 0x07, 0x30, 0xff, 0x2e, 0x2a, 0x53, 0xff, 0x2e, 0x39, 0x43, 0xff, 0x34, 0x47, 0x3f, 0xff, 0x36, 0x48, 0x42, 0xff, 0x42, 0x4c, 0x56, 0xff, 0x48, 0x51, 0x5a, 0xff, 0x46, 0x50, 0x53, 0xff, 0x41, 0x4c, 0x52, 0xff, 0x30, 0x3c, 0x42, 0xff, 0x26, 0x33, 0x39, 0xff, 0x34, 0x40, 0x49, 0xff, 0x41, 0x4b, 0x4b, 0xff, 0x40, 0x4a, 0x42, 0xff, 0x3f, 0x4a, 0x47, 0xff, 0x45, 0x50, 0x4e, 0xff, 0x43, 0x4b, 0x45, 0xff, 0x3f, 0x41, 0x38, 0xff, 0x44, 0x46, 0x3d, 0xff, 0x41, 0x44, 0x3c, 0xff, 0x40, 0x41, 0x38, 0xff, 0x45, 0x44, 0x3b, 0xff, 0x49, 0x48, 0x3d, 0xff, 0x4b, 0x49, 0x3c, 0xff, 0x46, 0x42, 0x36, 0xff, 0x46, 0x42, 0x37, 0xff, 0x46, 0x43, 0x34, 0xff, 0x44, 0x40, 0x2f, 0xff, 0x49, 0x44, 0x34, 0xff, 0x4c, 0x46, 0x37, 0xff, 0x4f, 0x47, 0x3c, 0xff, 0x4d, 0x44, 0x37, 0xff, 0x47, 0x3e, 0x29, 0xff, 0x48, 0x3e, 0x27, 0xff, 0x50, 0x47, 0x30, 0xff, 0x4e, 0x43, 0x30, 0xff, 0x41, 0x3c, 0x30, 0xff, 0x41, 0x43, 0x3c, 0xff, 0x46, 0x45, 0x3f, 0xff, 0x40, 0x3e, 0x3a, 0xff, 0x3e, 0x3d, 0x39, 0xff, 0x3e, 0x3e, 0x3c, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x04, 0x2c, 0x3c, 0x48, 0xe7, 0x2c, 0x3a, 0x45, 0xff, 0x35, 0x40, 0x44, 0xff, 0x39, 0x43, 0x43, 0xff, 0x36, 0x42, 0x43, 0xff, 0x35, 0x43, 0x45, 0xff, 0x33, 0x45, 0x48, 0xff, 0x37, 0x42, 0x49, 0xff, 0x3b, 0x44, 0x4f, 0xff, 0x3d, 0x4e, 0x59, 0xff, 0x3c, 0x4e, 0x55, 0xff, 0x44, 0x48, 0x51, 0xff, 0x3d, 0x43, 0x45, 0xff, 0x39, 0x44, 0x47, 0xff, 0x3d, 0x49, 0x52, 0xff, 0x41, 0x4e, 0x58, 0xff, 0x40, 0x4a, 0x51, 0xff, 0x3f, 0x43, 0x48, 0xff, 0x36, 0x42, 0x48, 0xff, 0x3a, 0x47, 0x4b, 0xff, 0x3b, 0x44, 0x45, 0xff, 0x3a, 0x41, 0x43, 0xff, 0x3a, 0x45, 0x45, 0xff, 0x2a, 0x35, 0x38, 0xff, 0x23, 0x38, 0x43, 0xff, 0x70, 0x7b, 0x98, 0xff, 0x92, 0x8a, 0xad, 0xff, 0x85, 0x7d, 0x8a, 0xff, 0x65, 0x63, 0x62, 0xff, 0x3a, 0x3d, 0x45, 0xff, 0x1a, 0x18, 0x2c, 0xff, 0x90, 0xa3, 0xb9, 0xff, 0xe6, 0xff, 0xff, 0xff, 0x96, 0xcf, 0xe6, 0xff, 0x37, 0x53, 0x74, 0xff, 0x2c, 0x32, 0x58, 0xff, 0x24, 0x2b, 0x3f, 0xff, 0x29, 0x3c, 0x5b, 0xff, 0x87, 0xa8, 0xda, 0xff, 0x72, 0xa5, 0xc8, 0xff, 0x44, 0x7e, 0x95, 0xff, 0x5f, 0x99, 0xbe, 0xff, 0x53, 0x6b, 0x8b, 0xff, 0x29, 0x2f, 0x3d, 0xff, 0x32, 0x35, 0x3e, 0xff, 0x36, 0x37, 0x3a, 0xff, 0x1c, 0x21, 0x29, 0xff, 0x30, 0x38, 0x48, 0xff, 0x36, 0x42, 0x56, 0xff, 0x36, 0x3f, 0x51, 0xff, 0x26, 0x27, 0x3d, 0xff, 0x19, 0x1e, 0x3d, 0xff, 0x15, 0x1f, 0x3a, 0xff, 0x04, 0x0a, 0x11, 0xff, 0x0a, 0x13, 0x1e, 0xff, 0x09, 0x17, 0x2f, 0xff, 0x14, 0x25, 0x41, 0xff, 0x17, 0x2b, 0x4a, 0xff, 0x1a, 0x2e, 0x4d, 0xff, 0x1d, 0x2f, 0x4b, 0xff, 0x1a, 0x29, 0x43, 0xff, 0x1b, 0x28, 0x44, 0xff, 0x1e, 0x2d, 0x48, 0xff, 0x1f, 0x30, 0x4c, 0xff, 0x20, 0x31, 0x4e, 0xff, 0x20, 0x32, 0x50, 0xff, 0x1d, 0x2d, 0x48, 0xff, 0x16, 0x24, 0x3e, 0xff, 0x10, 0x1f, 0x39, 0xff, 0x16, 0x25, 0x3f, 0xff, 0x1f, 0x2b, 0x44, 0xff, 0x14, 0x22, 0x38, 0xff, 0x22, 0x2d, 0x46, 0xff, 0x1f, 0x27, 0x44, 0xff, 0x06, 0x11, 0x2e, 0xff, 0x09, 0x14, 0x35, 0xff, 0x1a, 0x28, 0x46, 0xff, 0x1a, 0x2d, 0x49, 0xff, 0x00, 0x0a, 0x26, 0xff, 0x0a, 0x17, 0x28, 0xff, 0x3e, 0x47, 0x47, 0xff, 0x36, 0x3b, 0x31, 0xff, 0x2e, 0x31, 0x28, 0xff, 0x38, 0x3c, 0x39, 0xff, 0x48, 0x4c, 0x4c, 0xff, 0x44, 0x46, 0x46, 0xff, 0x39, 0x3b, 0x3c, 0xff, 0x32, 0x35, 0x34, 0xff, 0x39, 0x39, 0x35, 0xff, 0x40, 0x3c, 0x36, 0xff, 0x45, 0x40, 0x35, 0xff, 0x44, 0x40, 0x35, 0xff, 0x41, 0x40, 0x3d, 0xff, 0x43, 0x45, 0x45, 0xff, 0x44, 0x45, 0x44, 0xff, 0x45, 0x40, 0x3d, 0xff, 0x47, 0x45, 0x3e, 0xff, 0x3f, 0x40, 0x38, 0xff, 0x3b, 0x3d, 0x33, 0xff, 0x46, 0x46, 0x3c, 0xff, 0x4a, 0x4a, 0x3f, 0xff, 0x4a, 0x4a, 0x3e, 0xff, 0x41, 0x3f, 0x38, 0xff, 0x3c, 0x39, 0x35, 0xff, 0x3f, 0x3f, 0x34, 0xff, 0x42, 0x41, 0x33, 0xff, 0x41, 0x3f, 0x32, 0xff, 0x43, 0x3f, 0x35, 0xff, 0x49, 0x44, 0x41, 0xff, 0x46, 0x43, 0x3d, 0xff, 0x42, 0x3d, 0x2d, 0xff, 0x45, 0x3e, 0x29, 0xff, 0x4a, 0x44, 0x30, 0xff, 0x46, 0x41, 0x34, 0xff, 0x44, 0x43, 0x37, 0xff, 0x4a, 0x4c, 0x3c, 0xff, 0x48, 0x46, 0x39, 0xff, 0x42, 0x3d, 0x31, 0xff, 0x43, 0x3c, 0x2e, 0xff, 0x46, 0x3e, 0x2d, 0xe7, 0x3f, 0x3f, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x4c, 0x50, 0x49, 0x40, 0x4d, 0x52, 0xff, 0x3f, 0x4a, 0x4d, 0xff, 0x41, 0x49, 0x47, 0xff, 0x3f, 0x47, 0x43, 0xff, 0x38, 0x42, 0x42, 0xff, 0x3b, 0x46, 0x49, 0xff, 0x41, 0x4e, 0x53, 0xff, 0x3b, 0x48, 0x4e, 0xff, 0x37, 0x43, 0x49, 0xff, 0x3e, 0x4a, 0x50, 0xff, 0x44, 0x4f, 0x55, 0xff, 0x49, 0x53, 0x58, 0xff, 0x3f, 0x4a, 0x52, 0xff, 0x3b, 0x47, 0x50, 0xff, 0x3b, 0x4a, 0x53, 0xff, 0x42, 0x51, 0x58, 0xff, 0x43, 0x4f, 0x55, 0xff, 0x3d, 0x46, 0x4b, 0xff, 0x36, 0x42, 0x43, 0xff, 0x3d, 0x47, 0x45, 0xff, 0x3f, 0x44, 0x40, 0xff, 0x2a, 0x2c, 0x2a, 0xff, 0x41, 0x43, 0x47, 0xff, 0x73, 0x77, 0x81, 0xff, 0x5a, 0x69, 0x86, 0xff, 0x57, 0x5d, 0x79, 0xff, 0x6e, 0x67, 0x78, 0xff, 0x6c, 0x6b, 0x80, 0xff, 0x31, 0x36, 0x49, 0xff, 0x24, 0x25, 0x2b, 0xff, 0x0d, 0x14, 0x23, 0xff, 0x0c, 0x1e, 0x35, 0xff, 0x2e, 0x48, 0x5e, 0xff, 0x00, 0x11, 0x23, 0xff, 0x00, 0x00, 0x07, 0xff, 0x0c, 0x09, 0x1a, 0xff, 0x2e, 0x31, 0x43, 0xff, 0x36, 0x49, 0x64, 0xff, 0x58, 0x77, 0x99, 0xff, 0x5d, 0x85, 0xa5, 0xff, 0x4c, 0x79, 0x93, 0xff, 0x5c, 0x8d, 0xa4, 0xff, 0x41, 0x58, 0x69, 0xff, 0x2c, 0x31, 0x3f, 0xff, 0x2f, 0x34, 0x43, 0xff, 0x22, 0x25, 0x34, 0xff, 0x27, 0x2c, 0x3e, 0xff, 0x41, 0x4a, 0x5c, 0xff, 0x3a, 0x41, 0x5a, 0xff, 0x31, 0x36, 0x51, 0xff, 0x1c, 0x23, 0x3a, 0xff, 0x1c, 0x25, 0x3d, 0xff, 0x21, 0x2c, 0x46, 0xff, 0x1b, 0x22, 0x38, 0xff, 0x2c, 0x30, 0x4a, 0xff, 0x39, 0x3c, 0x5a, 0xff, 0x35, 0x3c, 0x5a, 0xff, 0x27, 0x33, 0x52, 0xff, 0x25, 0x32, 0x50, 0xff, 0x20, 0x2f, 0x4b, 0xff, 0x1a, 0x2b, 0x47, 0xff, 0x1d, 0x2e, 0x4c, 0xff, 0x21, 0x32, 0x4f, 0xff, 0x23, 0x34, 0x50, 0xff, 0x22, 0x33, 0x4f, 0xff, 0x23, 0x32, 0x50, 0xff, 0x21, 0x31, 0x4a, 0xff, 0x16, 0x26, 0x3e, 0xff, 0x11, 0x21, 0x3b, 0xff, 0x16, 0x26, 0x41, 0xff, 0x19, 0x27, 0x44, 0xff, 0x1e, 0x2b, 0x47, 0xff, 0x14, 0x25, 0x44, 0xff, 0x0c, 0x1f, 0x3b, 0xff, 0x00, 0x0a, 0x21, 0xff, 0x0b, 0x12, 0x30, 0xff, 0x15, 0x20, 0x41, 0xff, 0x15, 0x2c, 0x46, 0xff, 0x09, 0x19, 0x31, 0xff, 0x02, 0x07, 0x21, 0xff, 0x2a, 0x2e, 0x44, 0xff, 0x42, 0x3c, 0x43, 0xff, 0x39, 0x2f, 0x2b, 0xff, 0x3e, 0x38, 0x34, 0xff, 0x49, 0x49, 0x44, 0xff, 0x46, 0x45, 0x3f, 0xff, 0x3c, 0x3a, 0x32, 0xff, 0x37, 0x35, 0x2d, 0xff, 0x3d, 0x39, 0x31, 0xff, 0x41, 0x3e, 0x38, 0xff, 0x40, 0x3c, 0x35, 0xff, 0x43, 0x3d, 0x37, 0xff, 0x43, 0x42, 0x3f, 0xff, 0x43, 0x45, 0x45, 0xff, 0x43, 0x45, 0x44, 0xff, 0x3f, 0x40, 0x3b, 0xff, 0x44, 0x44, 0x40, 0xff, 0x45, 0x44, 0x3c, 0xff, 0x3c, 0x3d, 0x2d, 0xff, 0x46, 0x43, 0x37, 0xff, 0x4e, 0x49, 0x44, 0xff, 0x48, 0x48, 0x3f, 0xff, 0x40, 0x3d, 0x34, 0xff, 0x41, 0x3c, 0x35, 0xff, 0x47, 0x45, 0x39, 0xff, 0x43, 0x41, 0x34, 0xff, 0x3f, 0x3d, 0x32, 0xff, 0x43, 0x41, 0x38, 0xff, 0x46, 0x45, 0x41, 0xff, 0x43, 0x46, 0x41, 0xff, 0x46, 0x44, 0x39, 0xff, 0x46, 0x43, 0x32, 0xff, 0x44, 0x42, 0x30, 0xff, 0x4a, 0x49, 0x3e, 0xff, 0x47, 0x47, 0x41, 0xff, 0x4a, 0x4a, 0x45, 0xff, 0x4a, 0x49, 0x3f, 0xff, 0x46, 0x44, 0x37, 0xff, 0x46, 0x42, 0x35, 0xff, 0x4b, 0x44, 0x37, 0xff, 0x48, 0x41, 0x30, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x48, 0x4c, 0x9f, 0x47, 0x4e, 0x53, 0xff, 0x47, 0x4c, 0x50, 0xff, 0x41, 0x45, 0x47, 0xff, 0x3e, 0x42, 0x44, 0xff, 0x3a, 0x3f, 0x43, 0xff, 0x3a, 0x41, 0x48, 0xff, 0x42, 0x4b, 0x54, 0xff, 0x42, 0x4e, 0x56, 0xff, 0x3f, 0x4a, 0x52, 0xff, 0x3f, 0x49, 0x52, 0xff, 0x43, 0x4e, 0x57, 0xff, 0x44, 0x51, 0x5a, 0xff, 0x45, 0x4f, 0x57, 0xff, 0x45, 0x4e, 0x54, 0xff, 0x3f, 0x4c, 0x4f, 0xff, 0x46, 0x53, 0x54, 0xff, 0x49, 0x52, 0x54, 0xff, 0x44, 0x4a, 0x4c, 0xff, 0x38, 0x3f, 0x3d, 0xff, 0x31, 0x38, 0x37, 0xff, 0x40, 0x45, 0x48, 0xff, 0x6e, 0x72, 0x77, 0xff, 0x72, 0x73, 0x7c, 0xff, 0x67, 0x66, 0x72, 0xff, 0x7c, 0x77, 0x82, 0xff, 0x8e, 0x81, 0x85, 0xff, 0xcc, 0xc4, 0xc7, 0xff, 0x90, 0x96, 0xb1, 0xff, 0x3f, 0x4e, 0x72, 0xff, 0x4f, 0x58, 0x6d, 0xff, 0x53, 0x58, 0x6a, 0xff, 0x20, 0x24, 0x37, 0xff, 0x00, 0x00, 0x10, 0xff, 0x0f, 0x13, 0x22, 0xff, 0x08, 0x13, 0x23, 0xff, 0x11, 0x1e, 0x2e, 0xff, 0x22, 0x2a, 0x3f, 0xff, 0x3a, 0x44, 0x5e, 0xff, 0x31, 0x40, 0x5d, 0xff, 0x3f, 0x51, 0x70, 0xff, 0x3c, 0x4f, 0x6b, 0xff, 0x3e, 0x54, 0x6a, 0xff, 0x35, 0x44, 0x52, 0xff, 0x29, 0x31, 0x40, 0xff, 0x3c, 0x42, 0x54, 0xff, 0x3f, 0x43, 0x5a, 0xff, 0x43, 0x4a, 0x63, 0xff, 0x2f, 0x39, 0x51, 0xff, 0x27, 0x2e, 0x4a, 0xff, 0x3b, 0x41, 0x60, 0xff, 0x1d, 0x26, 0x41, 0xff, 0x21, 0x2a, 0x46, 0xff, 0x41, 0x4a, 0x67, 0xff, 0x46, 0x4a, 0x6b, 0xff, 0x54, 0x55, 0x77, 0xff, 0x58, 0x5a, 0x79, 0xff, 0x46, 0x4b, 0x6a, 0xff, 0x31, 0x39, 0x56, 0xff, 0x23, 0x2f, 0x4c, 0xff, 0x1c, 0x2b, 0x47, 0xff, 0x1e, 0x30, 0x4d, 0xff, 0x1f, 0x32, 0x50, 0xff, 0x21, 0x32, 0x50, 0xff, 0x22, 0x33, 0x4f, 0xff, 0x25, 0x36, 0x51, 0xff, 0x26, 0x33, 0x50, 0xff, 0x21, 0x30, 0x49, 0xff, 0x18, 0x27, 0x40, 0xff, 0x17, 0x26, 0x40, 0xff, 0x19, 0x28, 0x42, 0xff, 0x1b, 0x29, 0x45, 0xff, 0x1b, 0x29, 0x45, 0xff, 0x15, 0x25, 0x43, 0xff, 0x12, 0x23, 0x3b, 0xff, 0x0a, 0x14, 0x25, 0xff, 0x1f, 0x23, 0x3d, 0xff, 0x20, 0x29, 0x4a, 0xff, 0x14, 0x2c, 0x48, 0xff, 0x0d, 0x20, 0x37, 0xff, 0x00, 0x0b, 0x25, 0xff, 0x18, 0x25, 0x3a, 0xff, 0x3d, 0x3f, 0x40, 0xff, 0x39, 0x34, 0x24, 0xff, 0x3a, 0x3a, 0x28, 0xff, 0x47, 0x48, 0x3d, 0xff, 0x4b, 0x47, 0x3d, 0xff, 0x45, 0x3f, 0x31, 0xff, 0x3e, 0x37, 0x27, 0xff, 0x3c, 0x35, 0x28, 0xff, 0x3d, 0x38, 0x2e, 0xff, 0x3b, 0x37, 0x2d, 0xff, 0x3c, 0x37, 0x2d, 0xff, 0x40, 0x3e, 0x37, 0xff, 0x42, 0x43, 0x3d, 0xff, 0x43, 0x45, 0x40, 0xff, 0x3f, 0x40, 0x39, 0xff, 0x43, 0x41, 0x3b, 0xff, 0x45, 0x43, 0x38, 0xff, 0x3e, 0x3c, 0x27, 0xff, 0x45, 0x3e, 0x30, 0xff, 0x4d, 0x45, 0x41, 0xff, 0x4c, 0x4a, 0x42, 0xff, 0x45, 0x41, 0x33, 0xff, 0x41, 0x3a, 0x2a, 0xff, 0x47, 0x41, 0x31, 0xff, 0x45, 0x40, 0x30, 0xff, 0x41, 0x3d, 0x2e, 0xff, 0x47, 0x42, 0x35, 0xff, 0x49, 0x44, 0x3f, 0xff, 0x49, 0x46, 0x46, 0xff, 0x4c, 0x48, 0x41, 0xff, 0x45, 0x3f, 0x34, 0xff, 0x45, 0x3d, 0x33, 0xff, 0x4f, 0x48, 0x42, 0xff, 0x49, 0x45, 0x43, 0xff, 0x46, 0x47, 0x43, 0xff, 0x47, 0x46, 0x3e, 0xff, 0x43, 0x42, 0x37, 0xff, 0x42, 0x3f, 0x34, 0xff, 0x47, 0x41, 0x38, 0xff, 0x43, 0x3e, 0x2e, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x48, 0x48, 0x07, 0x3c, 0x42, 0x48, 0xef, 0x45, 0x48, 0x4e, 0xff, 0x4a, 0x4c, 0x4f, 0xff, 0x42, 0x43, 0x44, 0xff, 0x3c, 0x3c, 0x3e, 0xff, 0x3d, 0x3e, 0x40, 0xff, 0x40, 0x43, 0x49, 0xff, 0x43, 0x49, 0x51, 0xff, 0x42, 0x4a, 0x52, 0xff, 0x42, 0x4b, 0x53, 0xff, 0x43, 0x4c, 0x55, 0xff, 0x44, 0x4d, 0x57, 0xff, 0x3a, 0x45, 0x4e, 0xff, 0x42, 0x47, 0x4c, 0xff, 0x49, 0x4d, 0x51, 0xff, 0x42, 0x4b, 0x4d, 0xff, 0x45, 0x4e, 0x50, 0xff, 0x49, 0x4e, 0x50, 0xff, 0x45, 0x47, 0x49, 0xff, 0x3b, 0x3e, 0x40, 0xff, 0x4e, 0x56, 0x5d, 0xff, 0x71, 0x7d, 0x8f, 0xff, 0x51, 0x5f, 0x78, 0xff, 0x44, 0x4e, 0x61, 0xff, 0xac, 0xad, 0xb4, 0xff, 0xf7, 0xf2, 0xf2, 0xff, 0xfa, 0xf1, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x85, 0x8a, 0xa1, 0xff, 0x37, 0x44, 0x64, 0xff, 0x3e, 0x4c, 0x6c, 0xff, 0x4d, 0x50, 0x64, 0xff, 0x4c, 0x4d, 0x5b, 0xff, 0x10, 0x18, 0x25, 0xff, 0x13, 0x1e, 0x2f, 0xff, 0x19, 0x25, 0x3d, 0xff, 0x24, 0x30, 0x50, 0xff, 0x14, 0x1b, 0x38, 0xff, 0x34, 0x38, 0x53, 0xff, 0x47, 0x4f, 0x68, 0xff, 0x3f, 0x49, 0x62, 0xff, 0x42, 0x4a, 0x65, 0xff, 0x38, 0x3e, 0x5a, 0xff, 0x1d, 0x24, 0x38, 0xff, 0x26, 0x2c, 0x3d, 0xff, 0x35, 0x3b, 0x50, 0xff, 0x40, 0x46, 0x60, 0xff, 0x2c, 0x34, 0x52, 0xff, 0x27, 0x32, 0x52, 0xff, 0x2f, 0x39, 0x57, 0xff, 0x54, 0x5f, 0x7e, 0xff, 0x25, 0x2b, 0x4c, 0xff, 0x2d, 0x35, 0x58, 0xff, 0x6c, 0x74, 0x98, 0xff, 0x69, 0x6c, 0x91, 0xff, 0x58, 0x5b, 0x7e, 0xff, 0x47, 0x4f, 0x6f, 0xff, 0x39, 0x42, 0x61, 0xff, 0x2b, 0x37, 0x56, 0xff, 0x1f, 0x2e, 0x4d, 0xff, 0x1c, 0x2b, 0x4b, 0xff, 0x1f, 0x30, 0x4d, 0xff, 0x20, 0x33, 0x50, 0xff, 0x22, 0x33, 0x50, 0xff, 0x23, 0x33, 0x4f, 0xff, 0x22, 0x33, 0x4e, 0xff, 0x23, 0x30, 0x4d, 0xff, 0x22, 0x31, 0x4c, 0xff, 0x1a, 0x29, 0x43, 0xff, 0x19, 0x28, 0x42, 0xff, 0x18, 0x26, 0x42, 0xff, 0x1c, 0x2a, 0x46, 0xff, 0x16, 0x25, 0x42, 0xff, 0x14, 0x21, 0x3c, 0xff, 0x0d, 0x13, 0x25, 0xff, 0x0d, 0x11, 0x1d, 0xff, 0x1b, 0x1f, 0x33, 0xff, 0x21, 0x27, 0x46, 0xff, 0x1a, 0x2f, 0x4b, 0xff, 0x0f, 0x23, 0x3f, 0xff, 0x02, 0x11, 0x2e, 0xff, 0x16, 0x24, 0x39, 0xff, 0x35, 0x3a, 0x39, 0xff, 0x39, 0x35, 0x22, 0xff, 0x34, 0x34, 0x1e, 0xff, 0x44, 0x43, 0x34, 0xff, 0x4f, 0x47, 0x3b, 0xff, 0x44, 0x3b, 0x29, 0xff, 0x40, 0x35, 0x22, 0xff, 0x3d, 0x34, 0x20, 0xff, 0x3e, 0x35, 0x22, 0xff, 0x40, 0x39, 0x26, 0xff, 0x3c, 0x38, 0x27, 0xff, 0x3d, 0x3a, 0x30, 0xff, 0x40, 0x40, 0x39, 0xff, 0x44, 0x43, 0x3e, 0xff, 0x43, 0x40, 0x3d, 0xff, 0x41, 0x3d, 0x39, 0xff, 0x42, 0x40, 0x32, 0xff, 0x42, 0x40, 0x2a, 0xff, 0x43, 0x3d, 0x2f, 0xff, 0x4b, 0x44, 0x3f, 0xff, 0x4b, 0x49, 0x42, 0xff, 0x44, 0x3f, 0x32, 0xff, 0x41, 0x38, 0x28, 0xff, 0x49, 0x41, 0x2f, 0xff, 0x44, 0x3e, 0x2b, 0xff, 0x3f, 0x3a, 0x29, 0xff, 0x48, 0x41, 0x31, 0xff, 0x4a, 0x43, 0x3d, 0xff, 0x49, 0x43, 0x45, 0xff, 0x4c, 0x45, 0x3f, 0xff, 0x44, 0x3c, 0x31, 0xff, 0x42, 0x3b, 0x31, 0xff, 0x4e, 0x46, 0x43, 0xff, 0x4c, 0x45, 0x42, 0xff, 0x4a, 0x46, 0x3c, 0xff, 0x49, 0x45, 0x37, 0xff, 0x44, 0x3f, 0x2f, 0xff, 0x3f, 0x38, 0x27, 0xff, 0x46, 0x3d, 0x30, 0xff, 0x45, 0x3c, 0x2a, 0xef, 0x48, 0x48, 0x24, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x3a, 0x3d, 0x46, 0x3b, 0x43, 0x46, 0xff, 0x41, 0x49, 0x4a, 0xff, 0x48, 0x4e, 0x4d, 0xff, 0x43, 0x48, 0x44, 0xff, 0x3a, 0x40, 0x3c, 0xff, 0x3c, 0x42, 0x40, 0xff, 0x43, 0x4a, 0x4a, 0xff, 0x47, 0x4c, 0x52, 0xff, 0x47, 0x4a, 0x50, 0xff, 0x47, 0x4b, 0x4f, 0xff, 0x4a, 0x4e, 0x51, 0xff, 0x49, 0x4e, 0x4f, 0xff, 0x3f, 0x43, 0x43, 0xff, 0x45, 0x4a, 0x4e, 0xff, 0x49, 0x4f, 0x57, 0xff, 0x41, 0x4b, 0x51, 0xff, 0x42, 0x4d, 0x53, 0xff, 0x48, 0x51, 0x56, 0xff, 0x45, 0x4c, 0x52, 0xff, 0x4b, 0x4e, 0x53, 0xff, 0x4c, 0x54, 0x60, 0xff, 0x19, 0x25, 0x40, 0xff, 0x2f, 0x42, 0x62, 0xff, 0xb5, 0xc7, 0xde, 0xff, 0xca, 0xd7, 0xe3, 0xff, 0x9c, 0xb0, 0xc2, 0xff, 0x86, 0x9d, 0xb7, 0xff, 0x9a, 0xac, 0xc8, 0xff, 0x63, 0x6f, 0x8b, 0xff, 0x44, 0x4c, 0x65, 0xff, 0x35, 0x3e, 0x56, 0xff, 0x2f, 0x31, 0x42, 0xff, 0x3e, 0x40, 0x4b, 0xff, 0x1c, 0x23, 0x30, 0xff, 0x01, 0x0a, 0x1b, 0xff, 0x1a, 0x25, 0x41, 0xff, 0x4b, 0x55, 0x7e, 0xff, 0x37, 0x42, 0x63, 0xff, 0x1d, 0x27, 0x41, 0xff, 0x48, 0x54, 0x6a, 0xff, 0x28, 0x34, 0x48, 0xff, 0x4a, 0x53, 0x6c, 0xff, 0x4d, 0x55, 0x73, 0xff, 0x2b, 0x31, 0x4a, 0xff, 0x21, 0x27, 0x3e, 0xff, 0x28, 0x2f, 0x4b, 0xff, 0x3b, 0x44, 0x63, 0xff, 0x4a, 0x52, 0x75, 0xff, 0x4f, 0x57, 0x7d, 0xff, 0x53, 0x5b, 0x7b, 0xff, 0x69, 0x72, 0x91, 0xff, 0x20, 0x26, 0x4b, 0xff, 0x4c, 0x54, 0x7c, 0xff, 0x72, 0x7b, 0xa3, 0xff, 0x57, 0x5c, 0x85, 0xff, 0x3c, 0x44, 0x67, 0xff, 0x2a, 0x36, 0x55, 0xff, 0x29, 0x35, 0x55, 0xff, 0x24, 0x32, 0x52, 0xff, 0x1e, 0x2f, 0x4f, 0xff, 0x20, 0x31, 0x51, 0xff, 0x20, 0x31, 0x4f, 0xff, 0x20, 0x32, 0x4f, 0xff, 0x22, 0x33, 0x50, 0xff, 0x23, 0x34, 0x50, 0xff, 0x22, 0x33, 0x4e, 0xff, 0x24, 0x32, 0x4e, 0xff, 0x23, 0x31, 0x4c, 0xff, 0x1d, 0x2c, 0x46, 0xff, 0x1b, 0x29, 0x45, 0xff, 0x1c, 0x2a, 0x46, 0xff, 0x25, 0x33, 0x4f, 0xff, 0x2c, 0x3b, 0x59, 0xff, 0x15, 0x22, 0x3e, 0xff, 0x06, 0x0a, 0x19, 0xff, 0x00, 0x00, 0x03, 0xff, 0x03, 0x05, 0x16, 0xff, 0x10, 0x15, 0x32, 0xff, 0x1a, 0x2a, 0x49, 0xff, 0x1d, 0x2c, 0x48, 0xff, 0x0e, 0x18, 0x36, 0xff, 0x21, 0x29, 0x3f, 0xff, 0x36, 0x34, 0x35, 0xff, 0x39, 0x2f, 0x1c, 0xff, 0x38, 0x31, 0x1a, 0xff, 0x42, 0x3f, 0x32, 0xff, 0x48, 0x44, 0x3b, 0xff, 0x3d, 0x35, 0x25, 0xff, 0x3c, 0x30, 0x1e, 0xff, 0x3b, 0x31, 0x1c, 0xff, 0x3b, 0x33, 0x1e, 0xff, 0x40, 0x3a, 0x25, 0xff, 0x3d, 0x3b, 0x28, 0xff, 0x3b, 0x3a, 0x2e, 0xff, 0x40, 0x3f, 0x39, 0xff, 0x3e, 0x3d, 0x39, 0xff, 0x3f, 0x3c, 0x39, 0xff, 0x40, 0x3c, 0x38, 0xff, 0x41, 0x3e, 0x31, 0xff, 0x41, 0x3f, 0x2a, 0xff, 0x3f, 0x3c, 0x2e, 0xff, 0x45, 0x41, 0x3d, 0xff, 0x45, 0x47, 0x41, 0xff, 0x42, 0x41, 0x36, 0xff, 0x42, 0x3a, 0x2c, 0xff, 0x49, 0x43, 0x33, 0xff, 0x41, 0x3d, 0x2d, 0xff, 0x3b, 0x37, 0x29, 0xff, 0x40, 0x3d, 0x31, 0xff, 0x45, 0x43, 0x3b, 0xff, 0x47, 0x45, 0x3e, 0xff, 0x49, 0x46, 0x3a, 0xff, 0x40, 0x3e, 0x2e, 0xff, 0x3a, 0x3a, 0x2c, 0xff, 0x47, 0x47, 0x40, 0xff, 0x4c, 0x49, 0x45, 0xff, 0x4d, 0x47, 0x40, 0xff, 0x45, 0x42, 0x36, 0xff, 0x3d, 0x3a, 0x2d, 0xff, 0x3a, 0x35, 0x29, 0xff, 0x41, 0x3a, 0x31, 0xff, 0x41, 0x3d, 0x2f, 0xff, 0x3a, 0x3a, 0x2b, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x48, 0x4d, 0x8d, 0x45, 0x52, 0x58, 0xff, 0x48, 0x57, 0x5e, 0xff, 0x4b, 0x5b, 0x61, 0xff, 0x4d, 0x5a, 0x5e, 0xff, 0x4a, 0x56, 0x5a, 0xff, 0x49, 0x58, 0x5c, 0xff, 0x4b, 0x5c, 0x61, 0xff, 0x4d, 0x5a, 0x6a, 0xff, 0x4e, 0x59, 0x68, 0xff, 0x53, 0x5d, 0x68, 0xff, 0x5b, 0x65, 0x6a, 0xff, 0x54, 0x5c, 0x5a, 0xff, 0x52, 0x58, 0x54, 0xff, 0x5c, 0x66, 0x6e, 0xff, 0x5e, 0x6c, 0x7a, 0xff, 0x51, 0x63, 0x70, 0xff, 0x4b, 0x5e, 0x6b, 0xff, 0x57, 0x68, 0x77, 0xff, 0x66, 0x75, 0x84, 0xff, 0x34, 0x3c, 0x46, 0xff, 0x00, 0x02, 0x11, 0xff, 0x0e, 0x17, 0x30, 0xff, 0x6f, 0x82, 0x9f, 0xff, 0xa7, 0xc4, 0xe1, 0xff, 0x7c, 0x9f, 0xbf, 0xff, 0x67, 0x93, 0xb5, 0xff, 0x3d, 0x6f, 0x9a, 0xff, 0x51, 0x78, 0xa4, 0xff, 0x3f, 0x51, 0x6c, 0xff, 0x32, 0x34, 0x41, 0xff, 0x22, 0x27, 0x35, 0xff, 0x28, 0x2a, 0x3b, 0xff, 0x3c, 0x40, 0x4e, 0xff, 0x27, 0x2d, 0x38, 0xff, 0x00, 0x04, 0x13, 0xff, 0x16, 0x1f, 0x3d, 0xff, 0x67, 0x6f, 0x9d, 0xff, 0x78, 0x83, 0xab, 0xff, 0x1b, 0x27, 0x44, 0xff, 0x3b, 0x45, 0x5c, 0xff, 0x2a, 0x37, 0x4b, 0xff, 0x30, 0x3c, 0x56, 0xff, 0x58, 0x64, 0x87, 0xff, 0x61, 0x6a, 0x8d, 0xff, 0x4e, 0x56, 0x78, 0xff, 0x48, 0x53, 0x76, 0xff, 0x50, 0x5b, 0x7e, 0xff, 0x5d, 0x65, 0x8a, 0xff, 0x63, 0x68, 0x90, 0xff, 0x92, 0x95, 0xb6, 0xff, 0x4f, 0x52, 0x6e, 0xff, 0x1c, 0x23, 0x48, 0xff, 0x77, 0x85, 0xb0, 0xff, 0x49, 0x56, 0x81, 0xff, 0x24, 0x31, 0x59, 0xff, 0x1d, 0x2c, 0x4d, 0xff, 0x1f, 0x2f, 0x4e, 0xff, 0x1c, 0x2c, 0x4c, 0xff, 0x1e, 0x2f, 0x4f, 0xff, 0x20, 0x32, 0x51, 0xff, 0x1e, 0x31, 0x50, 0xff, 0x21, 0x33, 0x51, 0xff, 0x20, 0x32, 0x4e, 0xff, 0x21, 0x32, 0x50, 0xff, 0x21, 0x31, 0x4d, 0xff, 0x21, 0x32, 0x4d, 0xff, 0x25, 0x32, 0x4e, 0xff, 0x22, 0x30, 0x4c, 0xff, 0x1f, 0x2d, 0x49, 0xff, 0x1c, 0x2a, 0x46, 0xff, 0x20, 0x2e, 0x4b, 0xff, 0x25, 0x33, 0x50, 0xff, 0x34, 0x42, 0x5f, 0xff, 0x27, 0x35, 0x55, 0xff, 0x08, 0x12, 0x28, 0xff, 0x00, 0x03, 0x0d, 0xff, 0x04, 0x06, 0x16, 0xff, 0x03, 0x06, 0x22, 0xff, 0x1c, 0x27, 0x46, 0xff, 0x25, 0x31, 0x4e, 0xff, 0x15, 0x1e, 0x3c, 0xff, 0x25, 0x2e, 0x45, 0xff, 0x35, 0x33, 0x36, 0xff, 0x3c, 0x32, 0x24, 0xff, 0x3c, 0x35, 0x24, 0xff, 0x3f, 0x42, 0x3d, 0xff, 0x48, 0x4c, 0x4c, 0xff, 0x45, 0x44, 0x3e, 0xff, 0x3f, 0x3b, 0x2e, 0xff, 0x3c, 0x38, 0x27, 0xff, 0x3d, 0x3a, 0x28, 0xff, 0x3f, 0x3d, 0x2d, 0xff, 0x3e, 0x3c, 0x2e, 0xff, 0x3e, 0x3e, 0x35, 0xff, 0x47, 0x4a, 0x44, 0xff, 0x41, 0x43, 0x3f, 0xff, 0x41, 0x43, 0x3d, 0xff, 0x44, 0x45, 0x40, 0xff, 0x40, 0x41, 0x36, 0xff, 0x3e, 0x41, 0x2e, 0xff, 0x46, 0x45, 0x3a, 0xff, 0x4f, 0x4f, 0x50, 0xff, 0x4e, 0x54, 0x53, 0xff, 0x4b, 0x50, 0x4a, 0xff, 0x49, 0x47, 0x40, 0xff, 0x4d, 0x4d, 0x44, 0xff, 0x49, 0x4b, 0x42, 0xff, 0x45, 0x48, 0x40, 0xff, 0x49, 0x4b, 0x47, 0xff, 0x4d, 0x4f, 0x4e, 0xff, 0x52, 0x56, 0x53, 0xff, 0x52, 0x56, 0x4e, 0xff, 0x48, 0x4d, 0x42, 0xff, 0x42, 0x48, 0x3f, 0xff, 0x4d, 0x55, 0x54, 0xff, 0x58, 0x5d, 0x5f, 0xff, 0x5a, 0x5b, 0x5b, 0xff, 0x52, 0x55, 0x52, 0xff, 0x45, 0x49, 0x44, 0xff, 0x3f, 0x42, 0x40, 0xff, 0x45, 0x48, 0x49, 0xff, 0x42, 0x47, 0x44, 0xff, 0x41, 0x46, 0x42, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x5c, 0x6d, 0xd7, 0x53, 0x63, 0x78, 0xff, 0x53, 0x66, 0x7e, 0xff, 0x5a, 0x6e, 0x86, 0xff, 0x59, 0x6b, 0x7f, 0xff, 0x59, 0x6a, 0x7e, 0xff, 0x59, 0x6b, 0x82, 0xff, 0x54, 0x67, 0x7f, 0xff, 0x46, 0x63, 0x83, 0xff, 0x45, 0x62, 0x84, 0xff, 0x55, 0x6c, 0x86, 0xff, 0x66, 0x7a, 0x8b, 0xff, 0x5e, 0x6e, 0x75, 0xff, 0x5d, 0x6b, 0x6c, 0xff, 0x67, 0x79, 0x87, 0xff, 0x69, 0x80, 0x93, 0xff, 0x5e, 0x78, 0x8a, 0xff, 0x52, 0x6d, 0x81, 0xff, 0x5b, 0x76, 0x8b, 0xff, 0x6e, 0x88, 0x9f, 0xff, 0x41, 0x4d, 0x5e, 0xff, 0x00, 0x02, 0x0f, 0xff, 0x18, 0x1d, 0x2e, 0xff, 0x63, 0x73, 0x8b, 0xff, 0x81, 0xa5, 0xc8, 0xff, 0x64, 0x99, 0xc5, 0xff, 0x5c, 0x90, 0xac, 0xff, 0x5e, 0x92, 0xb2, 0xff, 0x59, 0x87, 0xaf, 0xff, 0x1e, 0x31, 0x46, 0xff, 0x28, 0x2a, 0x30, 0xff, 0x2e, 0x34, 0x40, 0xff, 0x24, 0x29, 0x3c, 0xff, 0x55, 0x5c, 0x6b, 0xff, 0x36, 0x3c, 0x47, 0xff, 0x00, 0x00, 0x0b, 0xff, 0x35, 0x3d, 0x5b, 0xff, 0x90, 0x96, 0xc4, 0xff, 0x8f, 0x92, 0xc2, 0xff, 0x32, 0x34, 0x57, 0xff, 0x1e, 0x22, 0x3a, 0xff, 0x4e, 0x54, 0x69, 0xff, 0x2b, 0x34, 0x51, 0xff, 0x58, 0x63, 0x8c, 0xff, 0x75, 0x7e, 0xab, 0xff, 0x77, 0x82, 0xab, 0xff, 0x6a, 0x77, 0x9f, 0xff, 0x66, 0x72, 0x99, 0xff, 0x83, 0x8a, 0xb0, 0xff, 0x98, 0x97, 0xbf, 0xff, 0x63, 0x61, 0x7d, 0xff, 0x21, 0x22, 0x3c, 0xff, 0x4c, 0x53, 0x7a, 0xff, 0x3f, 0x4d, 0x79, 0xff, 0x18, 0x2b, 0x55, 0xff, 0x15, 0x2c, 0x51, 0xff, 0x17, 0x2a, 0x4c, 0xff, 0x19, 0x2a, 0x4b, 0xff, 0x19, 0x2b, 0x4c, 0xff, 0x1b, 0x2d, 0x4e, 0xff, 0x1c, 0x2f, 0x50, 0xff, 0x1d, 0x30, 0x52, 0xff, 0x21, 0x33, 0x52, 0xff, 0x22, 0x34, 0x50, 0xff, 0x20, 0x31, 0x4f, 0xff, 0x21, 0x31, 0x4d, 0xff, 0x1e, 0x2f, 0x49, 0xff, 0x20, 0x2e, 0x4a, 0xff, 0x23, 0x30, 0x4c, 0xff, 0x20, 0x2e, 0x4a, 0xff, 0x1f, 0x2c, 0x49, 0xff, 0x24, 0x32, 0x4f, 0xff, 0x23, 0x30, 0x4d, 0xff, 0x1e, 0x2a, 0x48, 0xff, 0x25, 0x35, 0x5a, 0xff, 0x0e, 0x1f, 0x3c, 0xff, 0x06, 0x10, 0x1b, 0xff, 0x0c, 0x10, 0x1f, 0xff, 0x05, 0x06, 0x22, 0xff, 0x21, 0x27, 0x47, 0xff, 0x26, 0x34, 0x4f, 0xff, 0x13, 0x26, 0x43, 0xff, 0x26, 0x37, 0x4f, 0xff, 0x3f, 0x45, 0x4b, 0xff, 0x45, 0x48, 0x3c, 0xff, 0x48, 0x4e, 0x41, 0xff, 0x56, 0x61, 0x63, 0xff, 0x62, 0x6b, 0x76, 0xff, 0x64, 0x69, 0x6a, 0xff, 0x60, 0x63, 0x5b, 0xff, 0x54, 0x57, 0x4d, 0xff, 0x50, 0x55, 0x48, 0xff, 0x55, 0x56, 0x4b, 0xff, 0x58, 0x55, 0x4e, 0xff, 0x59, 0x5b, 0x56, 0xff, 0x5c, 0x61, 0x5e, 0xff, 0x53, 0x58, 0x53, 0xff, 0x57, 0x5e, 0x55, 0xff, 0x5c, 0x5e, 0x5a, 0xff, 0x55, 0x57, 0x50, 0xff, 0x53, 0x57, 0x47, 0xff, 0x63, 0x66, 0x5e, 0xff, 0x6b, 0x6e, 0x71, 0xff, 0x66, 0x6e, 0x70, 0xff, 0x65, 0x6c, 0x6c, 0xff, 0x60, 0x64, 0x63, 0xff, 0x61, 0x67, 0x64, 0xff, 0x61, 0x67, 0x64, 0xff, 0x5b, 0x61, 0x61, 0xff, 0x61, 0x68, 0x69, 0xff, 0x67, 0x6e, 0x77, 0xff, 0x68, 0x6e, 0x7b, 0xff, 0x68, 0x6f, 0x75, 0xff, 0x66, 0x6c, 0x71, 0xff, 0x64, 0x6c, 0x73, 0xff, 0x65, 0x71, 0x81, 0xff, 0x67, 0x71, 0x80, 0xff, 0x6b, 0x74, 0x7b, 0xff, 0x6c, 0x76, 0x7b, 0xff, 0x5e, 0x6a, 0x6e, 0xff, 0x54, 0x60, 0x66, 0xff, 0x58, 0x63, 0x6d, 0xff, 0x4e, 0x5b, 0x63, 0xff, 0x49, 0x56, 0x5c, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4e, 0x6b, 0x7f, 0x1a, 0x51, 0x69, 0x7c, 0xff, 0x54, 0x6d, 0x84, 0xff, 0x4a, 0x64, 0x7d, 0xff, 0x4c, 0x67, 0x83, 0xff, 0x49, 0x64, 0x83, 0xff, 0x48, 0x62, 0x82, 0xff, 0x4c, 0x68, 0x88, 0xff, 0x44, 0x63, 0x80, 0xff, 0x41, 0x62, 0x7f, 0xff, 0x45, 0x64, 0x84, 0xff, 0x4e, 0x6a, 0x87, 0xff, 0x5e, 0x79, 0x92, 0xff, 0x62, 0x79, 0x8d, 0xff, 0x66, 0x79, 0x88, 0xff, 0x66, 0x7e, 0x8e, 0xff, 0x67, 0x82, 0x94, 0xff, 0x64, 0x7f, 0x91, 0xff, 0x60, 0x7b, 0x8e, 0xff, 0x60, 0x7c, 0x8e, 0xff, 0x66, 0x82, 0x96, 0xff, 0x58, 0x68, 0x73, 0xff, 0x09, 0x13, 0x1d, 0xff, 0x16, 0x1e, 0x34, 0xff, 0x37, 0x41, 0x5d, 0xff, 0x37, 0x47, 0x64, 0xff, 0x37, 0x4c, 0x67, 0xff, 0x3a, 0x5e, 0x6f, 0xff, 0x5b, 0x7d, 0x97, 0xff, 0x57, 0x6f, 0x8e, 0xff, 0x1a, 0x2b, 0x37, 0xff, 0x22, 0x2c, 0x30, 0xff, 0x20, 0x26, 0x39, 0xff, 0x1e, 0x23, 0x31, 0xff, 0x54, 0x5f, 0x6c, 0xff, 0x25, 0x32, 0x4a, 0xff, 0x00, 0x05, 0x27, 0xff, 0x78, 0x7f, 0xa7, 0xff, 0xb2, 0xad, 0xd7, 0xff, 0x96, 0x90, 0xbd, 0xff, 0x5e, 0x62, 0x91, 0xff, 0x01, 0x0c, 0x2f, 0xff, 0x39, 0x3f, 0x4f, 0xff, 0x72, 0x78, 0x86, 0xff, 0x57, 0x6a, 0x8e, 0xff, 0x7a, 0x82, 0xa9, 0xff, 0xa2, 0xa3, 0xc2, 0xff, 0xa6, 0xab, 0xcc, 0xff, 0x93, 0x98, 0xb7, 0xff, 0x76, 0x74, 0x91, 0xff, 0x4f, 0x4a, 0x65, 0xff, 0x2e, 0x2c, 0x4d, 0xff, 0x5f, 0x64, 0x8a, 0xff, 0x5c, 0x63, 0x88, 0xff, 0x2c, 0x36, 0x5d, 0xff, 0x1e, 0x2b, 0x50, 0xff, 0x1b, 0x2b, 0x4c, 0xff, 0x1a, 0x2a, 0x4b, 0xff, 0x19, 0x28, 0x49, 0xff, 0x19, 0x2a, 0x4b, 0xff, 0x1b, 0x2c, 0x4d, 0xff, 0x16, 0x29, 0x4a, 0xff, 0x1c, 0x2f, 0x51, 0xff, 0x1f, 0x33, 0x51, 0xff, 0x21, 0x33, 0x50, 0xff, 0x1e, 0x30, 0x4d, 0xff, 0x1d, 0x30, 0x4b, 0xff, 0x1e, 0x2f, 0x49, 0xff, 0x1e, 0x2e, 0x4a, 0xff, 0x1e, 0x2e, 0x49, 0xff, 0x20, 0x30, 0x4a, 0xff, 0x1f, 0x30, 0x4b, 0xff, 0x22, 0x33, 0x50, 0xff, 0x1a, 0x2e, 0x4a, 0xff, 0x19, 0x2d, 0x4c, 0xff, 0x1c, 0x2f, 0x46, 0xff, 0x0c, 0x1a, 0x2d, 0xff, 0x03, 0x0e, 0x23, 0xff, 0x06, 0x0d, 0x27, 0xff, 0x0a, 0x11, 0x30, 0xff, 0x2d, 0x35, 0x53, 0xff, 0x26, 0x31, 0x53, 0xff, 0x13, 0x21, 0x3f, 0xff, 0x34, 0x44, 0x53, 0xff, 0x54, 0x61, 0x6c, 0xff, 0x4b, 0x57, 0x61, 0xff, 0x53, 0x64, 0x69, 0xff, 0x69, 0x7b, 0x86, 0xff, 0x6b, 0x7b, 0x8c, 0xff, 0x68, 0x76, 0x82, 0xff, 0x6d, 0x79, 0x81, 0xff, 0x61, 0x6d, 0x6d, 0xff, 0x58, 0x66, 0x5f, 0xff, 0x64, 0x6b, 0x66, 0xff, 0x68, 0x6d, 0x6c, 0xff, 0x67, 0x6f, 0x71, 0xff, 0x66, 0x70, 0x73, 0xff, 0x60, 0x6a, 0x6c, 0xff, 0x64, 0x6e, 0x6b, 0xff, 0x68, 0x71, 0x71, 0xff, 0x64, 0x6c, 0x6f, 0xff, 0x60, 0x67, 0x63, 0xff, 0x70, 0x74, 0x72, 0xff, 0x73, 0x7a, 0x7e, 0xff, 0x6d, 0x79, 0x81, 0xff, 0x72, 0x7d, 0x84, 0xff, 0x6f, 0x77, 0x7d, 0xff, 0x6c, 0x75, 0x79, 0xff, 0x6b, 0x73, 0x74, 0xff, 0x61, 0x6a, 0x67, 0xff, 0x67, 0x6f, 0x6a, 0xff, 0x74, 0x7d, 0x7e, 0xff, 0x6e, 0x78, 0x84, 0xff, 0x65, 0x71, 0x7e, 0xff, 0x6a, 0x79, 0x89, 0xff, 0x6f, 0x7e, 0x8e, 0xff, 0x6b, 0x78, 0x88, 0xff, 0x68, 0x74, 0x81, 0xff, 0x6d, 0x78, 0x80, 0xff, 0x70, 0x7d, 0x85, 0xff, 0x6b, 0x77, 0x7f, 0xff, 0x67, 0x73, 0x7b, 0xff, 0x65, 0x71, 0x7c, 0xff, 0x5d, 0x68, 0x71, 0xff, 0x5e, 0x6a, 0x70, 0xff, 0x67, 0x71, 0x7a, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x54, 0x6e, 0x7f, 0x58, 0x51, 0x6e, 0x80, 0xff, 0x4a, 0x6b, 0x7e, 0xff, 0x44, 0x61, 0x78, 0xff, 0x40, 0x5c, 0x76, 0xff, 0x3f, 0x5b, 0x79, 0xff, 0x43, 0x61, 0x7f, 0xff, 0x4b, 0x69, 0x83, 0xff, 0x49, 0x69, 0x80, 0xff, 0x4c, 0x69, 0x81, 0xff, 0x50, 0x6d, 0x88, 0xff, 0x52, 0x6f, 0x8a, 0xff, 0x5c, 0x76, 0x92, 0xff, 0x69, 0x81, 0x97, 0xff, 0x6e, 0x83, 0x94, 0xff, 0x67, 0x80, 0x91, 0xff, 0x68, 0x82, 0x93, 0xff, 0x67, 0x80, 0x91, 0xff, 0x68, 0x81, 0x92, 0xff, 0x69, 0x82, 0x93, 0xff, 0x62, 0x7d, 0x8d, 0xff, 0x78, 0x8a, 0x93, 0xff, 0x25, 0x33, 0x40, 0xff, 0x0e, 0x1b, 0x36, 0xff, 0x52, 0x5c, 0x7d, 0xff, 0x33, 0x3f, 0x5a, 0xff, 0x2f, 0x3d, 0x4f, 0xff, 0x25, 0x3e, 0x4d, 0xff, 0x1b, 0x2f, 0x4a, 0xff, 0x3b, 0x44, 0x61, 0xff, 0x1f, 0x29, 0x36, 0xff, 0x21, 0x29, 0x31, 0xff, 0x3e, 0x3d, 0x56, 0xff, 0x44, 0x48, 0x5d, 0xff, 0x4b, 0x56, 0x67, 0xff, 0x0e, 0x17, 0x31, 0xff, 0x24, 0x2c, 0x4f, 0xff, 0xae, 0xaf, 0xd6, 0xff, 0xa9, 0x9e, 0xc8, 0xff, 0x89, 0x85, 0xab, 0xff, 0x5f, 0x6c, 0x96, 0xff, 0x29, 0x39, 0x60, 0xff, 0x05, 0x0b, 0x1e, 0xff, 0x50, 0x4a, 0x57, 0xff, 0x6e, 0x70, 0x8b, 0xff, 0x71, 0x73, 0x92, 0xff, 0x6e, 0x6f, 0x8b, 0xff, 0x5a, 0x5b, 0x77, 0xff, 0x3e, 0x41, 0x5e, 0xff, 0x22, 0x24, 0x42, 0xff, 0x35, 0x36, 0x54, 0xff, 0x63, 0x66, 0x8d, 0xff, 0x4c, 0x54, 0x7d, 0xff, 0x38, 0x40, 0x66, 0xff, 0x38, 0x43, 0x66, 0xff, 0x2a, 0x37, 0x58, 0xff, 0x20, 0x2e, 0x4e, 0xff, 0x1b, 0x2a, 0x4b, 0xff, 0x19, 0x2a, 0x4b, 0xff, 0x18, 0x29, 0x4a, 0xff, 0x19, 0x2a, 0x4b, 0xff, 0x1a, 0x2d, 0x4e, 0xff, 0x19, 0x2c, 0x4d, 0xff, 0x1b, 0x30, 0x4e, 0xff, 0x22, 0x35, 0x51, 0xff, 0x21, 0x32, 0x50, 0xff, 0x1d, 0x30, 0x4c, 0xff, 0x1c, 0x2d, 0x48, 0xff, 0x1d, 0x2e, 0x49, 0xff, 0x1c, 0x2e, 0x49, 0xff, 0x20, 0x31, 0x4c, 0xff, 0x20, 0x32, 0x4e, 0xff, 0x20, 0x33, 0x50, 0xff, 0x19, 0x2e, 0x4b, 0xff, 0x1a, 0x30, 0x4f, 0xff, 0x08, 0x1a, 0x2f, 0xff, 0x03, 0x0e, 0x21, 0xff, 0x25, 0x2f, 0x4c, 0xff, 0x2c, 0x37, 0x58, 0xff, 0x24, 0x30, 0x4f, 0xff, 0x2e, 0x3a, 0x56, 0xff, 0x15, 0x20, 0x41, 0xff, 0x18, 0x23, 0x3f, 0xff, 0x4c, 0x5c, 0x65, 0xff, 0x56, 0x65, 0x6f, 0xff, 0x4c, 0x5a, 0x6d, 0xff, 0x58, 0x6a, 0x76, 0xff, 0x68, 0x7c, 0x89, 0xff, 0x66, 0x7a, 0x8d, 0xff, 0x67, 0x79, 0x8b, 0xff, 0x6c, 0x7b, 0x89, 0xff, 0x58, 0x66, 0x6b, 0xff, 0x54, 0x63, 0x61, 0xff, 0x66, 0x72, 0x71, 0xff, 0x69, 0x73, 0x75, 0xff, 0x67, 0x74, 0x77, 0xff, 0x6a, 0x78, 0x7e, 0xff, 0x69, 0x75, 0x7a, 0xff, 0x67, 0x73, 0x75, 0xff, 0x6b, 0x77, 0x7b, 0xff, 0x63, 0x6f, 0x74, 0xff, 0x5f, 0x69, 0x6d, 0xff, 0x71, 0x78, 0x7b, 0xff, 0x72, 0x7c, 0x81, 0xff, 0x6f, 0x7b, 0x86, 0xff, 0x72, 0x7e, 0x8a, 0xff, 0x6c, 0x79, 0x81, 0xff, 0x65, 0x72, 0x79, 0xff, 0x67, 0x71, 0x76, 0xff, 0x62, 0x6a, 0x6a, 0xff, 0x68, 0x6d, 0x6a, 0xff, 0x73, 0x7b, 0x7a, 0xff, 0x6e, 0x7a, 0x7f, 0xff, 0x63, 0x72, 0x7c, 0xff, 0x67, 0x78, 0x88, 0xff, 0x6f, 0x7f, 0x8d, 0xff, 0x6c, 0x78, 0x84, 0xff, 0x64, 0x70, 0x79, 0xff, 0x67, 0x73, 0x79, 0xff, 0x6d, 0x78, 0x80, 0xff, 0x6d, 0x78, 0x80, 0xff, 0x6d, 0x78, 0x80, 0xff, 0x6b, 0x76, 0x7d, 0xff, 0x64, 0x6f, 0x77, 0xff, 0x66, 0x73, 0x7b, 0xff, 0x6b, 0x76, 0x7f, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x56, 0x71, 0x83, 0x90, 0x55, 0x73, 0x87, 0xff, 0x49, 0x6b, 0x80, 0xff, 0x4f, 0x6d, 0x85, 0xff, 0x54, 0x6f, 0x88, 0xff, 0x4c, 0x67, 0x80, 0xff, 0x56, 0x6e, 0x87, 0xff, 0x60, 0x78, 0x8d, 0xff, 0x5d, 0x75, 0x89, 0xff, 0x51, 0x6c, 0x81, 0xff, 0x52, 0x6c, 0x86, 0xff, 0x56, 0x72, 0x91, 0xff, 0x5e, 0x78, 0x95, 0xff, 0x65, 0x7c, 0x90, 0xff, 0x6f, 0x83, 0x90, 0xff, 0x70, 0x86, 0x97, 0xff, 0x6d, 0x85, 0x98, 0xff, 0x67, 0x7e, 0x90, 0xff, 0x64, 0x7c, 0x8e, 0xff, 0x6d, 0x84, 0x97, 0xff, 0x68, 0x81, 0x93, 0xff, 0x77, 0x8a, 0x97, 0xff, 0x4d, 0x5e, 0x6f, 0xff, 0x0b, 0x1a, 0x38, 0xff, 0x6b, 0x7d, 0x9e, 0xff, 0x73, 0x89, 0xa6, 0xff, 0x72, 0x8e, 0xa4, 0xff, 0x64, 0x7b, 0x8d, 0xff, 0x57, 0x67, 0x7d, 0xff, 0x3f, 0x49, 0x60, 0xff, 0x16, 0x1b, 0x2d, 0xff, 0x28, 0x2c, 0x3f, 0xff, 0x40, 0x3f, 0x5b, 0xff, 0x3c, 0x43, 0x63, 0xff, 0x53, 0x5a, 0x78, 0xff, 0x21, 0x20, 0x39, 0xff, 0x81, 0x7c, 0x97, 0xff, 0xc9, 0xc1, 0xe2, 0xff, 0x8c, 0x80, 0xac, 0xff, 0x4f, 0x4c, 0x70, 0xff, 0x36, 0x41, 0x66, 0xff, 0x54, 0x64, 0x90, 0xff, 0x4c, 0x56, 0x7b, 0xff, 0x13, 0x11, 0x2d, 0xff, 0x1f, 0x16, 0x2e, 0xff, 0x2d, 0x2c, 0x47, 0xff, 0x29, 0x30, 0x4f, 0xff, 0x2e, 0x35, 0x5a, 0xff, 0x39, 0x44, 0x6f, 0xff, 0x45, 0x53, 0x7f, 0xff, 0x39, 0x46, 0x72, 0xff, 0x37, 0x41, 0x68, 0xff, 0x31, 0x3c, 0x60, 0xff, 0x29, 0x38, 0x5a, 0xff, 0x26, 0x36, 0x57, 0xff, 0x1e, 0x2e, 0x4f, 0xff, 0x1a, 0x2c, 0x4d, 0xff, 0x14, 0x27, 0x47, 0xff, 0x15, 0x26, 0x47, 0xff, 0x1b, 0x2c, 0x4d, 0xff, 0x17, 0x2a, 0x4b, 0xff, 0x1b, 0x2e, 0x4f, 0xff, 0x1b, 0x2f, 0x50, 0xff, 0x1d, 0x32, 0x50, 0xff, 0x23, 0x35, 0x51, 0xff, 0x20, 0x31, 0x4f, 0xff, 0x1c, 0x2e, 0x4a, 0xff, 0x1b, 0x2d, 0x48, 0xff, 0x1d, 0x2e, 0x48, 0xff, 0x1d, 0x2d, 0x4a, 0xff, 0x22, 0x32, 0x4f, 0xff, 0x22, 0x32, 0x4f, 0xff, 0x21, 0x32, 0x4f, 0xff, 0x1f, 0x30, 0x4c, 0xff, 0x16, 0x29, 0x45, 0xff, 0x0e, 0x1e, 0x3c, 0xff, 0x2e, 0x3b, 0x5a, 0xff, 0x3a, 0x49, 0x69, 0xff, 0x2f, 0x3e, 0x5f, 0xff, 0x22, 0x32, 0x4f, 0xff, 0x0f, 0x1f, 0x39, 0xff, 0x0a, 0x16, 0x33, 0xff, 0x21, 0x2f, 0x44, 0xff, 0x51, 0x63, 0x68, 0xff, 0x53, 0x62, 0x6a, 0xff, 0x51, 0x60, 0x6e, 0xff, 0x59, 0x6c, 0x73, 0xff, 0x63, 0x79, 0x85, 0xff, 0x63, 0x79, 0x8c, 0xff, 0x68, 0x7b, 0x8a, 0xff, 0x6e, 0x7d, 0x8a, 0xff, 0x5e, 0x6b, 0x72, 0xff, 0x5a, 0x68, 0x67, 0xff, 0x64, 0x71, 0x72, 0xff, 0x65, 0x70, 0x76, 0xff, 0x65, 0x73, 0x79, 0xff, 0x6b, 0x7a, 0x81, 0xff, 0x68, 0x75, 0x7b, 0xff, 0x65, 0x71, 0x73, 0xff, 0x69, 0x75, 0x79, 0xff, 0x64, 0x6f, 0x76, 0xff, 0x65, 0x71, 0x75, 0xff, 0x73, 0x7e, 0x85, 0xff, 0x71, 0x7c, 0x85, 0xff, 0x72, 0x7e, 0x8a, 0xff, 0x70, 0x80, 0x8c, 0xff, 0x5f, 0x70, 0x7b, 0xff, 0x5a, 0x68, 0x72, 0xff, 0x66, 0x70, 0x78, 0xff, 0x67, 0x6c, 0x74, 0xff, 0x6b, 0x6d, 0x71, 0xff, 0x73, 0x79, 0x7d, 0xff, 0x71, 0x7e, 0x83, 0xff, 0x6a, 0x75, 0x7e, 0xff, 0x62, 0x6f, 0x7a, 0xff, 0x6b, 0x78, 0x83, 0xff, 0x70, 0x7c, 0x88, 0xff, 0x6b, 0x76, 0x81, 0xff, 0x6e, 0x77, 0x7f, 0xff, 0x72, 0x7c, 0x85, 0xff, 0x6f, 0x79, 0x82, 0xff, 0x6e, 0x78, 0x80, 0xff, 0x6d, 0x76, 0x7e, 0xff, 0x61, 0x6d, 0x78, 0xff, 0x5e, 0x6f, 0x7c, 0xff, 0x68, 0x74, 0x7d, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x63, 0x77, 0xc6, 0x57, 0x76, 0x8a, 0xff, 0x58, 0x7a, 0x91, 0xff, 0x5c, 0x78, 0x90, 0xff, 0x5f, 0x7a, 0x90, 0xff, 0x57, 0x70, 0x85, 0xff, 0x5b, 0x72, 0x88, 0xff, 0x65, 0x7c, 0x92, 0xff, 0x62, 0x79, 0x8e, 0xff, 0x59, 0x71, 0x83, 0xff, 0x56, 0x6f, 0x85, 0xff, 0x59, 0x75, 0x93, 0xff, 0x5f, 0x7a, 0x98, 0xff, 0x63, 0x7a, 0x90, 0xff, 0x70, 0x84, 0x90, 0xff, 0x78, 0x8f, 0x9e, 0xff, 0x74, 0x8e, 0x9f, 0xff, 0x6d, 0x86, 0x97, 0xff, 0x69, 0x82, 0x93, 0xff, 0x68, 0x81, 0x92, 0xff, 0x6d, 0x86, 0x96, 0xff, 0x73, 0x8b, 0x9a, 0xff, 0x77, 0x8c, 0x9f, 0xff, 0x1b, 0x2c, 0x4a, 0xff, 0x3e, 0x52, 0x74, 0xff, 0x71, 0x88, 0xa3, 0xff, 0x7a, 0x95, 0xa9, 0xff, 0x81, 0x9b, 0xac, 0xff, 0x92, 0xaa, 0xb6, 0xff, 0x7c, 0x8f, 0x9c, 0xff, 0x3e, 0x4c, 0x61, 0xff, 0x37, 0x42, 0x5e, 0xff, 0x3a, 0x46, 0x64, 0xff, 0x5e, 0x69, 0x8e, 0xff, 0x5d, 0x62, 0x89, 0xff, 0x6f, 0x6b, 0x8b, 0xff, 0xcb, 0xc4, 0xe1, 0xff, 0xaf, 0xa8, 0xcc, 0xff, 0x8b, 0x87, 0xb1, 0xff, 0x74, 0x6e, 0x9a, 0xff, 0x8e, 0x8c, 0xba, 0xff, 0xa0, 0xaa, 0xda, 0xff, 0x78, 0x8b, 0xbf, 0xff, 0x3f, 0x52, 0x80, 0xff, 0x14, 0x21, 0x46, 0xff, 0x19, 0x21, 0x3d, 0xff, 0x5c, 0x65, 0x83, 0xff, 0x7a, 0x87, 0xb1, 0xff, 0x66, 0x76, 0xa6, 0xff, 0x48, 0x59, 0x8a, 0xff, 0x35, 0x47, 0x77, 0xff, 0x31, 0x41, 0x67, 0xff, 0x2e, 0x3b, 0x5e, 0xff, 0x25, 0x35, 0x56, 0xff, 0x1a, 0x2b, 0x4c, 0xff, 0x17, 0x29, 0x49, 0xff, 0x17, 0x2a, 0x49, 0xff, 0x16, 0x28, 0x48, 0xff, 0x15, 0x26, 0x47, 0xff, 0x19, 0x2c, 0x4e, 0xff, 0x1a, 0x2d, 0x4f, 0xff, 0x1a, 0x2f, 0x4f, 0xff, 0x1a, 0x30, 0x50, 0xff, 0x1f, 0x34, 0x52, 0xff, 0x21, 0x34, 0x50, 0xff, 0x1c, 0x2e, 0x4b, 0xff, 0x1b, 0x2d, 0x49, 0xff, 0x1e, 0x30, 0x4a, 0xff, 0x1f, 0x31, 0x4b, 0xff, 0x1e, 0x2d, 0x4b, 0xff, 0x21, 0x30, 0x50, 0xff, 0x21, 0x31, 0x4e, 0xff, 0x20, 0x30, 0x4c, 0xff, 0x21, 0x32, 0x4d, 0xff, 0x17, 0x2a, 0x43, 0xff, 0x15, 0x24, 0x42, 0xff, 0x19, 0x27, 0x49, 0xff, 0x05, 0x17, 0x3a, 0xff, 0x10, 0x25, 0x45, 0xff, 0x0f, 0x22, 0x3e, 0xff, 0x06, 0x18, 0x30, 0xff, 0x16, 0x23, 0x3b, 0xff, 0x1d, 0x29, 0x36, 0xff, 0x51, 0x60, 0x61, 0xff, 0x59, 0x68, 0x6c, 0xff, 0x55, 0x63, 0x6d, 0xff, 0x59, 0x6b, 0x72, 0xff, 0x68, 0x7d, 0x88, 0xff, 0x69, 0x80, 0x91, 0xff, 0x6a, 0x7d, 0x8c, 0xff, 0x72, 0x81, 0x8d, 0xff, 0x6c, 0x7a, 0x80, 0xff, 0x62, 0x70, 0x70, 0xff, 0x64, 0x70, 0x73, 0xff, 0x63, 0x70, 0x78, 0xff, 0x62, 0x73, 0x7a, 0xff, 0x69, 0x78, 0x80, 0xff, 0x68, 0x75, 0x7b, 0xff, 0x68, 0x73, 0x75, 0xff, 0x6d, 0x77, 0x79, 0xff, 0x65, 0x72, 0x77, 0xff, 0x68, 0x74, 0x7b, 0xff, 0x74, 0x81, 0x8a, 0xff, 0x73, 0x7f, 0x8a, 0xff, 0x75, 0x81, 0x8c, 0xff, 0x73, 0x81, 0x8d, 0xff, 0x60, 0x70, 0x7b, 0xff, 0x60, 0x6e, 0x77, 0xff, 0x6d, 0x77, 0x80, 0xff, 0x68, 0x6f, 0x77, 0xff, 0x6e, 0x70, 0x76, 0xff, 0x77, 0x7d, 0x82, 0xff, 0x74, 0x81, 0x85, 0xff, 0x6f, 0x79, 0x7f, 0xff, 0x69, 0x74, 0x7b, 0xff, 0x72, 0x7d, 0x86, 0xff, 0x78, 0x83, 0x8f, 0xff, 0x75, 0x81, 0x8b, 0xff, 0x77, 0x80, 0x88, 0xff, 0x7a, 0x83, 0x8b, 0xff, 0x73, 0x7c, 0x84, 0xff, 0x6e, 0x78, 0x7f, 0xff, 0x70, 0x78, 0x7f, 0xff, 0x63, 0x6e, 0x79, 0xff, 0x5d, 0x6e, 0x7c, 0xff, 0x69, 0x75, 0x7e, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x38, 0x52, 0x69, 0xf2, 0x4b, 0x66, 0x7e, 0xff, 0x55, 0x71, 0x8b, 0xff, 0x64, 0x7c, 0x94, 0xff, 0x6b, 0x82, 0x97, 0xff, 0x59, 0x72, 0x85, 0xff, 0x4f, 0x6a, 0x7f, 0xff, 0x5b, 0x76, 0x8f, 0xff, 0x5e, 0x79, 0x94, 0xff, 0x63, 0x77, 0x88, 0xff, 0x62, 0x79, 0x8c, 0xff, 0x5d, 0x7a, 0x97, 0xff, 0x60, 0x7d, 0x9d, 0xff, 0x67, 0x7f, 0x96, 0xff, 0x75, 0x88, 0x93, 0xff, 0x7a, 0x91, 0x9e, 0xff, 0x79, 0x92, 0xa3, 0xff, 0x79, 0x91, 0xa1, 0xff, 0x78, 0x90, 0xa0, 0xff, 0x68, 0x80, 0x90, 0xff, 0x60, 0x79, 0x89, 0xff, 0x59, 0x74, 0x81, 0xff, 0x76, 0x8f, 0xa1, 0xff, 0x3c, 0x4e, 0x6a, 0xff, 0x23, 0x32, 0x53, 0xff, 0x7a, 0x8b, 0xa6, 0xff, 0x7d, 0x90, 0xa1, 0xff, 0x7d, 0x93, 0xa2, 0xff, 0x81, 0x9b, 0xa3, 0xff, 0x85, 0x9c, 0xa2, 0xff, 0x60, 0x6f, 0x88, 0xff, 0x49, 0x55, 0x7b, 0xff, 0x60, 0x73, 0x93, 0xff, 0x70, 0x7b, 0x9e, 0xff, 0x69, 0x6f, 0x98, 0xff, 0xaa, 0xb1, 0xdc, 0xff, 0x87, 0x8c, 0xb9, 0xff, 0x47, 0x4d, 0x77, 0xff, 0x69, 0x70, 0x97, 0xff, 0xac, 0xb1, 0xe1, 0xff, 0x89, 0x89, 0xb6, 0xff, 0x48, 0x4a, 0x71, 0xff, 0x2a, 0x3c, 0x6c, 0xff, 0x1f, 0x3f, 0x71, 0xff, 0x12, 0x32, 0x5b, 0xff, 0x05, 0x15, 0x2d, 0xff, 0x1b, 0x24, 0x3f, 0xff, 0x49, 0x55, 0x7f, 0xff, 0x58, 0x66, 0x97, 0xff, 0x45, 0x55, 0x84, 0xff, 0x39, 0x4b, 0x75, 0xff, 0x2c, 0x3d, 0x61, 0xff, 0x22, 0x31, 0x51, 0xff, 0x17, 0x26, 0x47, 0xff, 0x17, 0x27, 0x47, 0xff, 0x17, 0x27, 0x46, 0xff, 0x1a, 0x2a, 0x49, 0xff, 0x1a, 0x2b, 0x4c, 0xff, 0x16, 0x29, 0x4b, 0xff, 0x1a, 0x2c, 0x4e, 0xff, 0x1a, 0x2f, 0x4f, 0xff, 0x19, 0x2e, 0x4e, 0xff, 0x19, 0x2f, 0x4f, 0xff, 0x1d, 0x32, 0x50, 0xff, 0x21, 0x33, 0x4f, 0xff, 0x1e, 0x2f, 0x4d, 0xff, 0x1d, 0x2f, 0x4b, 0xff, 0x20, 0x31, 0x4c, 0xff, 0x20, 0x32, 0x4c, 0xff, 0x20, 0x30, 0x4f, 0xff, 0x22, 0x30, 0x52, 0xff, 0x21, 0x30, 0x4f, 0xff, 0x23, 0x32, 0x4e, 0xff, 0x20, 0x2e, 0x49, 0xff, 0x1e, 0x2d, 0x46, 0xff, 0x21, 0x2c, 0x48, 0xff, 0x1a, 0x26, 0x44, 0xff, 0x35, 0x49, 0x67, 0xff, 0x16, 0x2c, 0x49, 0xff, 0x10, 0x24, 0x3f, 0xff, 0x19, 0x27, 0x43, 0xff, 0x1c, 0x25, 0x3a, 0xff, 0x15, 0x1c, 0x23, 0xff, 0x57, 0x62, 0x5f, 0xff, 0x64, 0x6e, 0x70, 0xff, 0x5b, 0x66, 0x70, 0xff, 0x5e, 0x6e, 0x75, 0xff, 0x6f, 0x82, 0x89, 0xff, 0x6f, 0x84, 0x8f, 0xff, 0x70, 0x81, 0x8c, 0xff, 0x78, 0x84, 0x8e, 0xff, 0x73, 0x80, 0x84, 0xff, 0x6a, 0x75, 0x75, 0xff, 0x6b, 0x76, 0x78, 0xff, 0x65, 0x73, 0x79, 0xff, 0x66, 0x75, 0x7b, 0xff, 0x6f, 0x7d, 0x83, 0xff, 0x70, 0x7c, 0x7e, 0xff, 0x72, 0x7b, 0x7a, 0xff, 0x76, 0x7e, 0x7c, 0xff, 0x6c, 0x77, 0x77, 0xff, 0x68, 0x74, 0x7b, 0xff, 0x73, 0x80, 0x8a, 0xff, 0x7a, 0x85, 0x8f, 0xff, 0x7e, 0x88, 0x91, 0xff, 0x7c, 0x87, 0x8c, 0xff, 0x73, 0x7d, 0x81, 0xff, 0x71, 0x7b, 0x7e, 0xff, 0x74, 0x7d, 0x81, 0xff, 0x6d, 0x75, 0x77, 0xff, 0x74, 0x7a, 0x7b, 0xff, 0x7c, 0x84, 0x87, 0xff, 0x79, 0x84, 0x88, 0xff, 0x77, 0x80, 0x84, 0xff, 0x77, 0x7f, 0x82, 0xff, 0x7c, 0x84, 0x8a, 0xff, 0x7c, 0x86, 0x93, 0xff, 0x7a, 0x85, 0x8f, 0xff, 0x7a, 0x85, 0x8b, 0xff, 0x7b, 0x85, 0x8c, 0xff, 0x73, 0x7e, 0x85, 0xff, 0x6e, 0x78, 0x7f, 0xff, 0x74, 0x7e, 0x84, 0xff, 0x6d, 0x78, 0x82, 0xff, 0x68, 0x75, 0x82, 0xff, 0x70, 0x79, 0x7e, 0xf2, 0x00, 0x00, 0x00, 0x01,
+    0x55, 0x73, 0x8b, 0x21, 0x54, 0x6c, 0x85, 0xff, 0x50, 0x68, 0x82, 0xff, 0x5e, 0x75, 0x91, 0xff, 0x71, 0x86, 0x9c, 0xff, 0x6a, 0x80, 0x94, 0xff, 0x66, 0x80, 0x94, 0xff, 0x62, 0x80, 0x96, 0xff, 0x5c, 0x7c, 0x99, 0xff, 0x5d, 0x7d, 0xa2, 0xff, 0x6c, 0x81, 0x8f, 0xff, 0x74, 0x89, 0x99, 0xff, 0x69, 0x86, 0xa5, 0xff, 0x62, 0x80, 0xa0, 0xff, 0x67, 0x7e, 0x95, 0xff, 0x7e, 0x8f, 0x99, 0xff, 0x81, 0x96, 0xa4, 0xff, 0x7b, 0x92, 0xa4, 0xff, 0x7b, 0x92, 0xa2, 0xff, 0x7b, 0x92, 0xa2, 0xff, 0x6e, 0x84, 0x95, 0xff, 0x5d, 0x74, 0x85, 0xff, 0x48, 0x64, 0x71, 0xff, 0x61, 0x7c, 0x8d, 0xff, 0x72, 0x84, 0x9f, 0xff, 0x28, 0x32, 0x52, 0xff, 0x60, 0x68, 0x82, 0xff, 0x88, 0x90, 0xa0, 0xff, 0x87, 0x92, 0xa3, 0xff, 0x8a, 0x9b, 0xa1, 0xff, 0x8a, 0x99, 0x9b, 0xff, 0x63, 0x6a, 0x87, 0xff, 0x62, 0x67, 0x95, 0xff, 0x76, 0x82, 0xa7, 0xff, 0x70, 0x77, 0x93, 0xff, 0x6a, 0x73, 0x9a, 0xff, 0x66, 0x77, 0xb1, 0xff, 0x2d, 0x42, 0x80, 0xff, 0x0e, 0x22, 0x55, 0xff, 0x2f, 0x3d, 0x63, 0xff, 0x3b, 0x54, 0x81, 0xff, 0x0b, 0x18, 0x3a, 0xff, 0x00, 0x00, 0x04, 0xff, 0x03, 0x08, 0x22, 0xff, 0x17, 0x2c, 0x57, 0xff, 0x17, 0x2c, 0x53, 0xff, 0x0f, 0x1b, 0x33, 0xff, 0x23, 0x2e, 0x47, 0xff, 0x21, 0x2c, 0x54, 0xff, 0x35, 0x41, 0x70, 0xff, 0x42, 0x4f, 0x79, 0xff, 0x3b, 0x4a, 0x6a, 0xff, 0x29, 0x38, 0x58, 0xff, 0x18, 0x28, 0x49, 0xff, 0x16, 0x25, 0x46, 0xff, 0x19, 0x27, 0x47, 0xff, 0x14, 0x21, 0x41, 0xff, 0x16, 0x21, 0x41, 0xff, 0x16, 0x27, 0x47, 0xff, 0x17, 0x2b, 0x4d, 0xff, 0x19, 0x2d, 0x4f, 0xff, 0x18, 0x2d, 0x4d, 0xff, 0x15, 0x2a, 0x4a, 0xff, 0x19, 0x30, 0x51, 0xff, 0x1c, 0x32, 0x50, 0xff, 0x1f, 0x2f, 0x4c, 0xff, 0x1c, 0x2e, 0x4b, 0xff, 0x1b, 0x2e, 0x4a, 0xff, 0x20, 0x31, 0x4c, 0xff, 0x22, 0x33, 0x4d, 0xff, 0x21, 0x32, 0x51, 0xff, 0x1f, 0x2e, 0x51, 0xff, 0x20, 0x2f, 0x4f, 0xff, 0x23, 0x32, 0x4e, 0xff, 0x1e, 0x2b, 0x46, 0xff, 0x14, 0x21, 0x3b, 0xff, 0x28, 0x32, 0x4a, 0xff, 0x30, 0x3b, 0x52, 0xff, 0x3a, 0x4d, 0x66, 0xff, 0x17, 0x2f, 0x4a, 0xff, 0x21, 0x33, 0x4f, 0xff, 0x2d, 0x38, 0x55, 0xff, 0x17, 0x1a, 0x2e, 0xff, 0x1b, 0x1e, 0x20, 0xff, 0x67, 0x6e, 0x68, 0xff, 0x6c, 0x72, 0x73, 0xff, 0x65, 0x6c, 0x76, 0xff, 0x6d, 0x78, 0x80, 0xff, 0x76, 0x87, 0x8d, 0xff, 0x74, 0x86, 0x8e, 0xff, 0x75, 0x84, 0x8c, 0xff, 0x7f, 0x89, 0x91, 0xff, 0x7c, 0x85, 0x8a, 0xff, 0x74, 0x7b, 0x79, 0xff, 0x71, 0x7b, 0x7b, 0xff, 0x62, 0x6f, 0x75, 0xff, 0x64, 0x71, 0x76, 0xff, 0x77, 0x84, 0x88, 0xff, 0x7a, 0x83, 0x84, 0xff, 0x76, 0x7d, 0x7a, 0xff, 0x79, 0x7f, 0x7b, 0xff, 0x75, 0x7c, 0x7b, 0xff, 0x70, 0x7b, 0x7e, 0xff, 0x76, 0x82, 0x8a, 0xff, 0x7c, 0x87, 0x8e, 0xff, 0x84, 0x8e, 0x94, 0xff, 0x89, 0x8e, 0x90, 0xff, 0x84, 0x88, 0x86, 0xff, 0x7c, 0x82, 0x81, 0xff, 0x7d, 0x85, 0x82, 0xff, 0x76, 0x7f, 0x7d, 0xff, 0x75, 0x7e, 0x7b, 0xff, 0x79, 0x84, 0x84, 0xff, 0x7d, 0x87, 0x8d, 0xff, 0x80, 0x86, 0x89, 0xff, 0x81, 0x86, 0x87, 0xff, 0x81, 0x89, 0x8d, 0xff, 0x7d, 0x88, 0x94, 0xff, 0x7b, 0x86, 0x92, 0xff, 0x7e, 0x87, 0x8e, 0xff, 0x7f, 0x88, 0x90, 0xff, 0x79, 0x83, 0x8a, 0xff, 0x72, 0x7b, 0x83, 0xff, 0x72, 0x7b, 0x82, 0xff, 0x74, 0x7e, 0x88, 0xff, 0x71, 0x7b, 0x86, 0xff, 0x7c, 0x81, 0x83, 0xff, 0x83, 0x83, 0x83, 0x21,
+    0x66, 0x84, 0xa6, 0x4b, 0x69, 0x82, 0xa0, 0xff, 0x67, 0x7c, 0x93, 0xff, 0x77, 0x88, 0x9a, 0xff, 0x76, 0x8c, 0xa0, 0xff, 0x5f, 0x78, 0x8a, 0xff, 0x65, 0x80, 0x90, 0xff, 0x74, 0x8e, 0xa2, 0xff, 0x6a, 0x83, 0x9e, 0xff, 0x67, 0x80, 0x9f, 0xff, 0x6f, 0x89, 0x9e, 0xff, 0x7a, 0x93, 0xa7, 0xff, 0x76, 0x8f, 0xa7, 0xff, 0x68, 0x82, 0x99, 0xff, 0x66, 0x7f, 0x98, 0xff, 0x71, 0x8b, 0xa6, 0xff, 0x82, 0x96, 0xa9, 0xff, 0x87, 0x97, 0xa3, 0xff, 0x80, 0x95, 0xa1, 0xff, 0x7a, 0x94, 0xa3, 0xff, 0x84, 0x9b, 0xa6, 0xff, 0x88, 0x96, 0x97, 0xff, 0x7e, 0x8a, 0x89, 0xff, 0x7e, 0x8f, 0x98, 0xff, 0x91, 0xa1, 0xb5, 0xff, 0x5c, 0x67, 0x79, 0xff, 0x35, 0x3b, 0x4e, 0xff, 0x9c, 0xa4, 0xbe, 0xff, 0xa1, 0xac, 0xbd, 0xff, 0xa6, 0xae, 0xb2, 0xff, 0xa3, 0xa8, 0xaf, 0xff, 0x78, 0x80, 0x98, 0xff, 0x5b, 0x65, 0x8a, 0xff, 0x56, 0x5c, 0x7e, 0xff, 0x96, 0xa1, 0xca, 0xff, 0x63, 0x77, 0xa5, 0xff, 0x20, 0x3a, 0x69, 0xff, 0x17, 0x30, 0x64, 0xff, 0x14, 0x28, 0x59, 0xff, 0x11, 0x21, 0x45, 0xff, 0x05, 0x0c, 0x1f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x03, 0xff, 0x18, 0x25, 0x3a, 0xff, 0x14, 0x20, 0x42, 0xff, 0x0f, 0x13, 0x2f, 0xff, 0x38, 0x3c, 0x55, 0xff, 0x3f, 0x47, 0x6a, 0xff, 0x2e, 0x37, 0x5f, 0xff, 0x30, 0x3a, 0x5e, 0xff, 0x2d, 0x38, 0x55, 0xff, 0x26, 0x31, 0x50, 0xff, 0x1f, 0x2a, 0x4c, 0xff, 0x19, 0x24, 0x42, 0xff, 0x15, 0x20, 0x3d, 0xff, 0x16, 0x21, 0x40, 0xff, 0x15, 0x22, 0x42, 0xff, 0x14, 0x26, 0x45, 0xff, 0x16, 0x29, 0x46, 0xff, 0x18, 0x2c, 0x49, 0xff, 0x18, 0x2d, 0x4b, 0xff, 0x17, 0x2b, 0x4a, 0xff, 0x19, 0x2f, 0x4e, 0xff, 0x1d, 0x31, 0x50, 0xff, 0x1d, 0x2f, 0x4e, 0xff, 0x1c, 0x2d, 0x4c, 0xff, 0x1b, 0x2e, 0x4a, 0xff, 0x1f, 0x30, 0x4d, 0xff, 0x22, 0x32, 0x4e, 0xff, 0x20, 0x33, 0x4f, 0xff, 0x1c, 0x2f, 0x4f, 0xff, 0x1d, 0x2f, 0x4e, 0xff, 0x21, 0x2f, 0x4b, 0xff, 0x1f, 0x2a, 0x43, 0xff, 0x02, 0x0d, 0x1f, 0xff, 0x06, 0x10, 0x27, 0xff, 0x1d, 0x29, 0x45, 0xff, 0x15, 0x22, 0x3e, 0xff, 0x1d, 0x2d, 0x49, 0xff, 0x24, 0x2f, 0x4a, 0xff, 0x30, 0x3a, 0x53, 0xff, 0x15, 0x15, 0x21, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x75, 0x7b, 0x7d, 0xff, 0x6c, 0x70, 0x6f, 0xff, 0x6d, 0x71, 0x73, 0xff, 0x75, 0x80, 0x8e, 0xff, 0x7c, 0x8e, 0x9b, 0xff, 0x7a, 0x8b, 0x92, 0xff, 0x79, 0x87, 0x8e, 0xff, 0x83, 0x8e, 0x93, 0xff, 0x86, 0x8f, 0x90, 0xff, 0x7d, 0x83, 0x81, 0xff, 0x77, 0x7d, 0x7b, 0xff, 0x75, 0x7c, 0x7b, 0xff, 0x76, 0x7e, 0x7f, 0xff, 0x7d, 0x85, 0x86, 0xff, 0x7f, 0x85, 0x82, 0xff, 0x7d, 0x7d, 0x73, 0xff, 0x80, 0x81, 0x77, 0xff, 0x7c, 0x82, 0x7e, 0xff, 0x76, 0x7e, 0x7f, 0xff, 0x7f, 0x88, 0x91, 0xff, 0x83, 0x8e, 0x96, 0xff, 0x83, 0x90, 0x92, 0xff, 0x8a, 0x8f, 0x94, 0xff, 0x88, 0x89, 0x8e, 0xff, 0x7e, 0x83, 0x84, 0xff, 0x7b, 0x82, 0x81, 0xff, 0x7e, 0x83, 0x81, 0xff, 0x7f, 0x80, 0x7d, 0xff, 0x82, 0x86, 0x83, 0xff, 0x84, 0x8d, 0x8c, 0xff, 0x84, 0x8a, 0x89, 0xff, 0x82, 0x88, 0x89, 0xff, 0x81, 0x89, 0x8d, 0xff, 0x81, 0x88, 0x8f, 0xff, 0x82, 0x89, 0x8d, 0xff, 0x85, 0x8a, 0x8a, 0xff, 0x87, 0x8d, 0x8d, 0xff, 0x87, 0x8c, 0x8d, 0xff, 0x7f, 0x84, 0x87, 0xff, 0x7a, 0x7f, 0x83, 0xff, 0x79, 0x82, 0x80, 0xff, 0x78, 0x82, 0x81, 0xff, 0x86, 0x83, 0x92, 0xff, 0x88, 0x88, 0x88, 0x4b,
+    0x5c, 0x79, 0x9d, 0x6b, 0x63, 0x7f, 0x9d, 0xff, 0x74, 0x89, 0x9f, 0xff, 0x7e, 0x90, 0x9e, 0xff, 0x76, 0x8e, 0xa1, 0xff, 0x6c, 0x87, 0x9a, 0xff, 0x6f, 0x8a, 0x9a, 0xff, 0x74, 0x8d, 0xa0, 0xff, 0x73, 0x89, 0xa2, 0xff, 0x6f, 0x84, 0x9f, 0xff, 0x6e, 0x87, 0x9d, 0xff, 0x74, 0x8d, 0xa0, 0xff, 0x72, 0x89, 0x99, 0xff, 0x71, 0x88, 0x9a, 0xff, 0x6f, 0x88, 0x9f, 0xff, 0x62, 0x7e, 0x9e, 0xff, 0x71, 0x86, 0x99, 0xff, 0x8a, 0x98, 0xa1, 0xff, 0x84, 0x98, 0xa2, 0xff, 0x7d, 0x99, 0xa7, 0xff, 0x88, 0x9f, 0xad, 0xff, 0x93, 0x9d, 0x9e, 0xff, 0x8b, 0x93, 0x8f, 0xff, 0x82, 0x92, 0x98, 0xff, 0x84, 0x97, 0xa3, 0xff, 0x97, 0xa1, 0xab, 0xff, 0x56, 0x5c, 0x67, 0xff, 0x52, 0x5c, 0x72, 0xff, 0x7c, 0x86, 0x98, 0xff, 0x7f, 0x82, 0x8b, 0xff, 0x6d, 0x70, 0x7e, 0xff, 0x48, 0x52, 0x70, 0xff, 0x14, 0x20, 0x4a, 0xff, 0x46, 0x4d, 0x76, 0xff, 0x6d, 0x76, 0xa2, 0xff, 0x2d, 0x3e, 0x63, 0xff, 0x2f, 0x47, 0x66, 0xff, 0x1f, 0x35, 0x5b, 0xff, 0x14, 0x23, 0x4c, 0xff, 0x0a, 0x16, 0x35, 0xff, 0x01, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0xff, 0x03, 0x06, 0x0e, 0xff, 0x0f, 0x18, 0x24, 0xff, 0x10, 0x1c, 0x2f, 0xff, 0x00, 0x0a, 0x25, 0xff, 0x0b, 0x11, 0x2e, 0xff, 0x37, 0x3a, 0x59, 0xff, 0x49, 0x52, 0x73, 0xff, 0x45, 0x4f, 0x71, 0xff, 0x33, 0x3e, 0x5f, 0xff, 0x21, 0x29, 0x49, 0xff, 0x1b, 0x25, 0x43, 0xff, 0x17, 0x21, 0x3f, 0xff, 0x12, 0x1b, 0x36, 0xff, 0x0f, 0x19, 0x33, 0xff, 0x12, 0x1e, 0x39, 0xff, 0x12, 0x21, 0x3e, 0xff, 0x14, 0x25, 0x42, 0xff, 0x17, 0x29, 0x44, 0xff, 0x18, 0x2a, 0x47, 0xff, 0x1c, 0x2e, 0x4b, 0xff, 0x18, 0x2d, 0x4b, 0xff, 0x17, 0x2b, 0x4a, 0xff, 0x1d, 0x31, 0x50, 0xff, 0x1c, 0x2e, 0x4e, 0xff, 0x1c, 0x2d, 0x4c, 0xff, 0x1d, 0x2f, 0x4c, 0xff, 0x20, 0x31, 0x4e, 0xff, 0x23, 0x33, 0x4f, 0xff, 0x1e, 0x31, 0x4d, 0xff, 0x1c, 0x31, 0x4e, 0xff, 0x1f, 0x30, 0x4e, 0xff, 0x20, 0x2c, 0x49, 0xff, 0x21, 0x2d, 0x45, 0xff, 0x11, 0x1c, 0x2d, 0xff, 0x02, 0x0c, 0x22, 0xff, 0x07, 0x14, 0x32, 0xff, 0x16, 0x21, 0x3d, 0xff, 0x1d, 0x28, 0x44, 0xff, 0x25, 0x2e, 0x47, 0xff, 0x30, 0x37, 0x51, 0xff, 0x11, 0x14, 0x1b, 0xff, 0x33, 0x38, 0x34, 0xff, 0x77, 0x83, 0x86, 0xff, 0x6c, 0x74, 0x6f, 0xff, 0x6f, 0x74, 0x6c, 0xff, 0x76, 0x82, 0x88, 0xff, 0x7f, 0x8e, 0x9b, 0xff, 0x7d, 0x8c, 0x93, 0xff, 0x7b, 0x88, 0x8d, 0xff, 0x85, 0x8f, 0x92, 0xff, 0x89, 0x90, 0x8f, 0xff, 0x80, 0x87, 0x83, 0xff, 0x7c, 0x7e, 0x78, 0xff, 0x81, 0x82, 0x7a, 0xff, 0x81, 0x85, 0x84, 0xff, 0x7f, 0x84, 0x84, 0xff, 0x7f, 0x85, 0x81, 0xff, 0x7f, 0x80, 0x77, 0xff, 0x84, 0x85, 0x7d, 0xff, 0x82, 0x87, 0x84, 0xff, 0x78, 0x7f, 0x81, 0xff, 0x83, 0x8b, 0x92, 0xff, 0x8a, 0x93, 0x98, 0xff, 0x87, 0x91, 0x91, 0xff, 0x89, 0x90, 0x92, 0xff, 0x87, 0x8b, 0x90, 0xff, 0x7f, 0x84, 0x85, 0xff, 0x79, 0x7f, 0x7b, 0xff, 0x84, 0x88, 0x82, 0xff, 0x89, 0x88, 0x83, 0xff, 0x86, 0x86, 0x83, 0xff, 0x86, 0x8d, 0x8a, 0xff, 0x7f, 0x85, 0x82, 0xff, 0x7f, 0x86, 0x85, 0xff, 0x83, 0x89, 0x8b, 0xff, 0x82, 0x89, 0x8e, 0xff, 0x86, 0x8b, 0x8d, 0xff, 0x87, 0x8c, 0x89, 0xff, 0x89, 0x8e, 0x8c, 0xff, 0x8b, 0x90, 0x8e, 0xff, 0x8c, 0x91, 0x8f, 0xff, 0x85, 0x89, 0x8b, 0xff, 0x7e, 0x86, 0x7d, 0xff, 0x85, 0x8b, 0x84, 0xff, 0x8d, 0x86, 0x96, 0xff, 0x87, 0x85, 0x85, 0x6b,
+    0x59, 0x77, 0x98, 0x8b, 0x61, 0x7d, 0x98, 0xff, 0x74, 0x8c, 0xa0, 0xff, 0x78, 0x8d, 0x9e, 0xff, 0x71, 0x89, 0x9e, 0xff, 0x6d, 0x87, 0x9c, 0xff, 0x67, 0x80, 0x95, 0xff, 0x6b, 0x84, 0x98, 0xff, 0x70, 0x87, 0xa0, 0xff, 0x71, 0x88, 0xa4, 0xff, 0x75, 0x8a, 0x9c, 0xff, 0x7e, 0x92, 0x9e, 0xff, 0x81, 0x95, 0xa1, 0xff, 0x89, 0x9c, 0xa9, 0xff, 0x7f, 0x92, 0xa5, 0xff, 0x73, 0x89, 0xa1, 0xff, 0x7a, 0x90, 0x9f, 0xff, 0x88, 0x99, 0xa0, 0xff, 0x83, 0x98, 0xa1, 0xff, 0x7b, 0x97, 0xa8, 0xff, 0x7f, 0x97, 0xab, 0xff, 0x86, 0x93, 0xa2, 0xff, 0x7e, 0x90, 0x94, 0xff, 0x75, 0x8b, 0x93, 0xff, 0x81, 0x94, 0x9f, 0xff, 0x94, 0x9d, 0xa0, 0xff, 0x9a, 0x9e, 0x9f, 0xff, 0x62, 0x6b, 0x74, 0xff, 0x5c, 0x64, 0x6f, 0xff, 0x77, 0x7a, 0x83, 0xff, 0x61, 0x65, 0x75, 0xff, 0x1f, 0x2b, 0x4f, 0xff, 0x49, 0x58, 0x8b, 0xff, 0x52, 0x5e, 0x94, 0xff, 0x00, 0x00, 0x1b, 0xff, 0x00, 0x00, 0x0a, 0xff, 0x09, 0x0e, 0x20, 0xff, 0x0b, 0x16, 0x31, 0xff, 0x0a, 0x15, 0x35, 0xff, 0x04, 0x0d, 0x26, 0xff, 0x00, 0x02, 0x0b, 0xff, 0x03, 0x09, 0x13, 0xff, 0x1b, 0x20, 0x39, 0xff, 0x1d, 0x25, 0x45, 0xff, 0x0e, 0x19, 0x36, 0xff, 0x0d, 0x1b, 0x32, 0xff, 0x22, 0x2e, 0x4c, 0xff, 0x3a, 0x43, 0x68, 0xff, 0x49, 0x54, 0x76, 0xff, 0x54, 0x5f, 0x80, 0xff, 0x41, 0x4c, 0x6b, 0xff, 0x2b, 0x34, 0x50, 0xff, 0x17, 0x22, 0x3c, 0xff, 0x0e, 0x1a, 0x32, 0xff, 0x12, 0x1c, 0x31, 0xff, 0x12, 0x1c, 0x31, 0xff, 0x0e, 0x1b, 0x30, 0xff, 0x11, 0x20, 0x38, 0xff, 0x13, 0x23, 0x3d, 0xff, 0x15, 0x26, 0x41, 0xff, 0x19, 0x2b, 0x47, 0xff, 0x1a, 0x2c, 0x49, 0xff, 0x17, 0x2b, 0x4a, 0xff, 0x18, 0x2c, 0x4b, 0xff, 0x1c, 0x30, 0x4f, 0xff, 0x1e, 0x30, 0x50, 0xff, 0x1b, 0x2d, 0x4c, 0xff, 0x1e, 0x30, 0x4d, 0xff, 0x22, 0x32, 0x50, 0xff, 0x21, 0x31, 0x4d, 0xff, 0x1e, 0x30, 0x4c, 0xff, 0x1c, 0x2e, 0x4c, 0xff, 0x20, 0x2f, 0x4c, 0xff, 0x23, 0x2f, 0x4c, 0xff, 0x26, 0x33, 0x4c, 0xff, 0x20, 0x2d, 0x40, 0xff, 0x15, 0x23, 0x3a, 0xff, 0x16, 0x22, 0x3e, 0xff, 0x19, 0x25, 0x42, 0xff, 0x21, 0x2e, 0x49, 0xff, 0x24, 0x2f, 0x48, 0xff, 0x2d, 0x35, 0x4d, 0xff, 0x0c, 0x12, 0x1b, 0xff, 0x42, 0x4e, 0x50, 0xff, 0x72, 0x84, 0x8d, 0xff, 0x6b, 0x79, 0x78, 0xff, 0x71, 0x79, 0x71, 0xff, 0x7a, 0x84, 0x80, 0xff, 0x84, 0x8f, 0x95, 0xff, 0x80, 0x8b, 0x93, 0xff, 0x81, 0x8b, 0x8e, 0xff, 0x87, 0x8f, 0x8f, 0xff, 0x85, 0x89, 0x86, 0xff, 0x82, 0x84, 0x80, 0xff, 0x82, 0x83, 0x79, 0xff, 0x80, 0x7f, 0x73, 0xff, 0x7e, 0x81, 0x7b, 0xff, 0x7f, 0x85, 0x83, 0xff, 0x7b, 0x81, 0x81, 0xff, 0x73, 0x7b, 0x7b, 0xff, 0x7e, 0x84, 0x85, 0xff, 0x7f, 0x85, 0x84, 0xff, 0x7f, 0x87, 0x8a, 0xff, 0x8d, 0x95, 0x9a, 0xff, 0x8e, 0x93, 0x95, 0xff, 0x8d, 0x92, 0x8e, 0xff, 0x8f, 0x94, 0x92, 0xff, 0x89, 0x8e, 0x90, 0xff, 0x86, 0x8c, 0x86, 0xff, 0x83, 0x87, 0x7d, 0xff, 0x89, 0x8c, 0x80, 0xff, 0x8a, 0x8b, 0x80, 0xff, 0x87, 0x88, 0x83, 0xff, 0x8a, 0x8e, 0x8d, 0xff, 0x87, 0x8c, 0x8a, 0xff, 0x87, 0x8c, 0x8c, 0xff, 0x8b, 0x91, 0x91, 0xff, 0x89, 0x90, 0x92, 0xff, 0x86, 0x8c, 0x8e, 0xff, 0x88, 0x8c, 0x8b, 0xff, 0x8b, 0x8e, 0x8d, 0xff, 0x8b, 0x8f, 0x8e, 0xff, 0x8b, 0x8f, 0x8e, 0xff, 0x87, 0x8a, 0x8b, 0xff, 0x83, 0x86, 0x7e, 0xff, 0x8d, 0x8c, 0x82, 0xff, 0x92, 0x8c, 0x8f, 0xff, 0x8d, 0x89, 0x84, 0x8b,
+    0x60, 0x7b, 0x99, 0xaa, 0x68, 0x83, 0x9a, 0xff, 0x76, 0x8f, 0xa2, 0xff, 0x79, 0x93, 0xa3, 0xff, 0x78, 0x91, 0xa5, 0xff, 0x6e, 0x87, 0x9b, 0xff, 0x56, 0x70, 0x81, 0xff, 0x59, 0x72, 0x85, 0xff, 0x64, 0x7d, 0x92, 0xff, 0x73, 0x8b, 0xa4, 0xff, 0x82, 0x95, 0xa3, 0xff, 0x8b, 0x9b, 0xa4, 0xff, 0x90, 0xa0, 0xa8, 0xff, 0x92, 0xa2, 0xac, 0xff, 0x84, 0x95, 0xa3, 0xff, 0x7a, 0x8e, 0xa0, 0xff, 0x7f, 0x93, 0xa1, 0xff, 0x83, 0x93, 0x99, 0xff, 0x7d, 0x8f, 0x93, 0xff, 0x6b, 0x84, 0x95, 0xff, 0x6b, 0x84, 0x9c, 0xff, 0x77, 0x88, 0x9d, 0xff, 0x7d, 0x8f, 0x98, 0xff, 0x77, 0x8e, 0x98, 0xff, 0x82, 0x94, 0x9c, 0xff, 0x94, 0x9d, 0x9a, 0xff, 0x93, 0x97, 0x91, 0xff, 0x9a, 0xa3, 0xa4, 0xff, 0xa1, 0xac, 0xac, 0xff, 0xb5, 0xbd, 0xba, 0xff, 0x87, 0x90, 0x98, 0xff, 0x2f, 0x41, 0x60, 0xff, 0x64, 0x7a, 0xa6, 0xff, 0x5c, 0x6c, 0x99, 0xff, 0x04, 0x04, 0x1d, 0xff, 0x00, 0x00, 0x06, 0xff, 0x04, 0x05, 0x0e, 0xff, 0x17, 0x1b, 0x2f, 0xff, 0x27, 0x2e, 0x4b, 0xff, 0x1c, 0x23, 0x3c, 0xff, 0x14, 0x20, 0x2e, 0xff, 0x1c, 0x29, 0x3c, 0xff, 0x27, 0x2d, 0x50, 0xff, 0x28, 0x2f, 0x55, 0xff, 0x29, 0x33, 0x54, 0xff, 0x2d, 0x3b, 0x52, 0xff, 0x35, 0x42, 0x60, 0xff, 0x3d, 0x49, 0x6c, 0xff, 0x44, 0x4e, 0x6f, 0xff, 0x48, 0x53, 0x70, 0xff, 0x3d, 0x48, 0x63, 0xff, 0x25, 0x30, 0x4b, 0xff, 0x0e, 0x1a, 0x31, 0xff, 0x11, 0x1c, 0x2f, 0xff, 0x11, 0x1a, 0x2b, 0xff, 0x11, 0x1b, 0x2c, 0xff, 0x0e, 0x1b, 0x2c, 0xff, 0x0c, 0x1b, 0x2e, 0xff, 0x0f, 0x1e, 0x36, 0xff, 0x14, 0x23, 0x3d, 0xff, 0x19, 0x29, 0x44, 0xff, 0x17, 0x29, 0x46, 0xff, 0x17, 0x2b, 0x4a, 0xff, 0x1a, 0x2f, 0x4e, 0xff, 0x1b, 0x30, 0x4f, 0xff, 0x1f, 0x31, 0x50, 0xff, 0x1f, 0x31, 0x50, 0xff, 0x1c, 0x2e, 0x4b, 0xff, 0x1f, 0x2f, 0x4d, 0xff, 0x21, 0x31, 0x4e, 0xff, 0x1d, 0x2f, 0x49, 0xff, 0x1a, 0x2c, 0x48, 0xff, 0x1e, 0x2e, 0x4b, 0xff, 0x22, 0x2f, 0x4c, 0xff, 0x28, 0x35, 0x4f, 0xff, 0x22, 0x2f, 0x45, 0xff, 0x1a, 0x27, 0x3f, 0xff, 0x1a, 0x27, 0x42, 0xff, 0x1e, 0x2a, 0x45, 0xff, 0x20, 0x2e, 0x48, 0xff, 0x27, 0x32, 0x49, 0xff, 0x2b, 0x33, 0x47, 0xff, 0x10, 0x16, 0x25, 0xff, 0x48, 0x55, 0x68, 0xff, 0x5f, 0x74, 0x8d, 0xff, 0x5b, 0x6d, 0x7e, 0xff, 0x6e, 0x76, 0x7b, 0xff, 0x83, 0x87, 0x8b, 0xff, 0x8a, 0x93, 0x99, 0xff, 0x83, 0x8e, 0x95, 0xff, 0x86, 0x8e, 0x91, 0xff, 0x8c, 0x92, 0x91, 0xff, 0x85, 0x87, 0x85, 0xff, 0x81, 0x81, 0x7e, 0xff, 0x84, 0x84, 0x79, 0xff, 0x84, 0x81, 0x73, 0xff, 0x82, 0x82, 0x77, 0xff, 0x82, 0x85, 0x81, 0xff, 0x7d, 0x85, 0x86, 0xff, 0x6d, 0x79, 0x7f, 0xff, 0x78, 0x82, 0x84, 0xff, 0x7f, 0x87, 0x87, 0xff, 0x83, 0x8d, 0x92, 0xff, 0x8f, 0x99, 0x9f, 0xff, 0x8f, 0x95, 0x98, 0xff, 0x92, 0x96, 0x92, 0xff, 0x93, 0x98, 0x94, 0xff, 0x8e, 0x93, 0x92, 0xff, 0x8d, 0x8f, 0x86, 0xff, 0x89, 0x89, 0x79, 0xff, 0x8b, 0x8b, 0x7d, 0xff, 0x8e, 0x8f, 0x82, 0xff, 0x8e, 0x90, 0x8a, 0xff, 0x91, 0x93, 0x92, 0xff, 0x8e, 0x92, 0x90, 0xff, 0x8d, 0x91, 0x8f, 0xff, 0x8f, 0x95, 0x92, 0xff, 0x8d, 0x92, 0x91, 0xff, 0x8a, 0x8e, 0x8d, 0xff, 0x8d, 0x8f, 0x8e, 0xff, 0x8f, 0x92, 0x90, 0xff, 0x8d, 0x8f, 0x8c, 0xff, 0x8a, 0x8b, 0x88, 0xff, 0x8a, 0x8b, 0x87, 0xff, 0x88, 0x87, 0x7d, 0xff, 0x8d, 0x88, 0x79, 0xff, 0x93, 0x8f, 0x86, 0xff, 0x95, 0x92, 0x89, 0xab,
+    0x6b, 0x83, 0x9a, 0xbe, 0x77, 0x8e, 0x9f, 0xff, 0x7b, 0x93, 0xa1, 0xff, 0x7c, 0x96, 0xa4, 0xff, 0x7d, 0x93, 0xa5, 0xff, 0x79, 0x8f, 0xa1, 0xff, 0x71, 0x89, 0x96, 0xff, 0x6d, 0x84, 0x92, 0xff, 0x6f, 0x86, 0x96, 0xff, 0x78, 0x8e, 0xa0, 0xff, 0x85, 0x96, 0xa1, 0xff, 0x8e, 0x9e, 0xa5, 0xff, 0x94, 0xa3, 0xa9, 0xff, 0x94, 0xa3, 0xaa, 0xff, 0x81, 0x92, 0x9d, 0xff, 0x7c, 0x8e, 0x9f, 0xff, 0x86, 0x98, 0xa7, 0xff, 0x8c, 0x98, 0x9e, 0xff, 0x8a, 0x96, 0x9a, 0xff, 0x7a, 0x8f, 0x9b, 0xff, 0x73, 0x8b, 0xa1, 0xff, 0x72, 0x85, 0x99, 0xff, 0x7c, 0x8d, 0x9a, 0xff, 0x7c, 0x90, 0x9c, 0xff, 0x84, 0x95, 0x9a, 0xff, 0x9a, 0xa1, 0x9b, 0xff, 0x93, 0x97, 0x8f, 0xff, 0x8c, 0x97, 0x99, 0xff, 0x92, 0xa1, 0x9e, 0xff, 0xa0, 0xac, 0xa5, 0xff, 0x7c, 0x8b, 0x92, 0xff, 0x3f, 0x54, 0x72, 0xff, 0x5a, 0x71, 0x98, 0xff, 0x58, 0x67, 0x8b, 0xff, 0x2d, 0x32, 0x52, 0xff, 0x0d, 0x13, 0x29, 0xff, 0x0f, 0x18, 0x29, 0xff, 0x41, 0x49, 0x64, 0xff, 0x52, 0x56, 0x77, 0xff, 0x49, 0x4e, 0x6c, 0xff, 0x44, 0x4f, 0x6b, 0xff, 0x35, 0x42, 0x5f, 0xff, 0x26, 0x31, 0x50, 0xff, 0x2c, 0x34, 0x55, 0xff, 0x36, 0x3d, 0x5c, 0xff, 0x40, 0x47, 0x63, 0xff, 0x45, 0x4e, 0x6a, 0xff, 0x3f, 0x4a, 0x65, 0xff, 0x36, 0x3e, 0x56, 0xff, 0x2e, 0x35, 0x4b, 0xff, 0x32, 0x3b, 0x53, 0xff, 0x24, 0x31, 0x4d, 0xff, 0x12, 0x1d, 0x35, 0xff, 0x0f, 0x17, 0x2a, 0xff, 0x11, 0x18, 0x2a, 0xff, 0x11, 0x18, 0x29, 0xff, 0x10, 0x1a, 0x2b, 0xff, 0x0c, 0x19, 0x2d, 0xff, 0x10, 0x1d, 0x34, 0xff, 0x15, 0x22, 0x39, 0xff, 0x0e, 0x1c, 0x36, 0xff, 0x14, 0x26, 0x42, 0xff, 0x17, 0x2b, 0x4a, 0xff, 0x17, 0x2c, 0x4c, 0xff, 0x1c, 0x31, 0x50, 0xff, 0x1b, 0x2d, 0x4c, 0xff, 0x1c, 0x2e, 0x4c, 0xff, 0x1c, 0x2e, 0x4a, 0xff, 0x1d, 0x2d, 0x4a, 0xff, 0x1e, 0x2f, 0x4b, 0xff, 0x1c, 0x2d, 0x47, 0xff, 0x1d, 0x2d, 0x47, 0xff, 0x1f, 0x2d, 0x4a, 0xff, 0x20, 0x2e, 0x4b, 0xff, 0x26, 0x33, 0x4e, 0xff, 0x24, 0x31, 0x48, 0xff, 0x1c, 0x29, 0x41, 0xff, 0x1b, 0x28, 0x42, 0xff, 0x1d, 0x2a, 0x45, 0xff, 0x21, 0x2f, 0x48, 0xff, 0x26, 0x31, 0x47, 0xff, 0x27, 0x2e, 0x41, 0xff, 0x25, 0x2a, 0x3b, 0xff, 0x54, 0x62, 0x7a, 0xff, 0x45, 0x5d, 0x7f, 0xff, 0x4e, 0x64, 0x7f, 0xff, 0x6e, 0x79, 0x86, 0xff, 0x87, 0x8a, 0x93, 0xff, 0x8c, 0x94, 0x9d, 0xff, 0x87, 0x92, 0x99, 0xff, 0x85, 0x8e, 0x92, 0xff, 0x8e, 0x94, 0x97, 0xff, 0x8a, 0x8c, 0x8b, 0xff, 0x87, 0x89, 0x86, 0xff, 0x89, 0x89, 0x81, 0xff, 0x88, 0x85, 0x78, 0xff, 0x86, 0x84, 0x7a, 0xff, 0x8a, 0x8c, 0x85, 0xff, 0x8b, 0x92, 0x92, 0xff, 0x71, 0x7f, 0x85, 0xff, 0x7c, 0x87, 0x89, 0xff, 0x8c, 0x94, 0x94, 0xff, 0x83, 0x8e, 0x95, 0xff, 0x89, 0x95, 0x9f, 0xff, 0x89, 0x94, 0x9c, 0xff, 0x87, 0x92, 0x95, 0xff, 0x92, 0x9b, 0x9d, 0xff, 0x94, 0x97, 0x97, 0xff, 0x93, 0x92, 0x87, 0xff, 0x8d, 0x8c, 0x78, 0xff, 0x8f, 0x8e, 0x7c, 0xff, 0x94, 0x93, 0x88, 0xff, 0x93, 0x94, 0x8e, 0xff, 0x94, 0x95, 0x92, 0xff, 0x92, 0x93, 0x8f, 0xff, 0x90, 0x94, 0x8f, 0xff, 0x92, 0x97, 0x91, 0xff, 0x90, 0x96, 0x90, 0xff, 0x8e, 0x92, 0x8f, 0xff, 0x8f, 0x91, 0x90, 0xff, 0x90, 0x93, 0x90, 0xff, 0x91, 0x92, 0x8d, 0xff, 0x90, 0x8f, 0x88, 0xff, 0x8f, 0x8e, 0x87, 0xff, 0x8f, 0x8b, 0x80, 0xff, 0x8c, 0x87, 0x77, 0xff, 0x8b, 0x8a, 0x7b, 0xff, 0x8f, 0x8e, 0x84, 0xbe,
+    0x7c, 0x8f, 0xa1, 0xd3, 0x85, 0x98, 0xa4, 0xff, 0x82, 0x97, 0xa1, 0xff, 0x79, 0x91, 0x9b, 0xff, 0x79, 0x8d, 0x9c, 0xff, 0x81, 0x94, 0xa1, 0xff, 0x85, 0x9b, 0xa4, 0xff, 0x7e, 0x95, 0x9d, 0xff, 0x79, 0x8e, 0x99, 0xff, 0x7b, 0x8f, 0x9d, 0xff, 0x81, 0x93, 0x9d, 0xff, 0x8d, 0x9e, 0xa5, 0xff, 0x94, 0xa3, 0xaa, 0xff, 0x92, 0xa2, 0xaa, 0xff, 0x80, 0x8f, 0x9d, 0xff, 0x7d, 0x8f, 0xa2, 0xff, 0x8f, 0x9c, 0xac, 0xff, 0x96, 0x9c, 0xa2, 0xff, 0x98, 0xa0, 0xa2, 0xff, 0x91, 0xa4, 0xad, 0xff, 0x8a, 0xa2, 0xb3, 0xff, 0x7c, 0x90, 0x9f, 0xff, 0x7f, 0x8f, 0x9c, 0xff, 0x86, 0x98, 0xa5, 0xff, 0x8e, 0x9b, 0xa2, 0xff, 0x9c, 0xa1, 0x9a, 0xff, 0x94, 0x99, 0x92, 0xff, 0x86, 0x94, 0x99, 0xff, 0x8d, 0x9d, 0xa2, 0xff, 0x94, 0xa1, 0xa4, 0xff, 0x7e, 0x8c, 0x9f, 0xff, 0x3f, 0x54, 0x7c, 0xff, 0x48, 0x5c, 0x8b, 0xff, 0x40, 0x48, 0x70, 0xff, 0x36, 0x3e, 0x68, 0xff, 0x49, 0x58, 0x7a, 0xff, 0x25, 0x31, 0x4a, 0xff, 0x3c, 0x44, 0x67, 0xff, 0x4b, 0x50, 0x79, 0xff, 0x4d, 0x55, 0x78, 0xff, 0x4d, 0x57, 0x7c, 0xff, 0x3d, 0x48, 0x6b, 0xff, 0x2c, 0x38, 0x51, 0xff, 0x31, 0x3c, 0x51, 0xff, 0x2c, 0x31, 0x4a, 0xff, 0x3b, 0x3b, 0x5e, 0xff, 0x40, 0x43, 0x5e, 0xff, 0x2e, 0x34, 0x45, 0xff, 0x24, 0x28, 0x39, 0xff, 0x1c, 0x20, 0x32, 0xff, 0x18, 0x21, 0x38, 0xff, 0x19, 0x28, 0x45, 0xff, 0x1d, 0x27, 0x41, 0xff, 0x14, 0x1a, 0x2e, 0xff, 0x11, 0x17, 0x2b, 0xff, 0x13, 0x19, 0x2b, 0xff, 0x0e, 0x16, 0x2a, 0xff, 0x0e, 0x1a, 0x30, 0xff, 0x14, 0x21, 0x36, 0xff, 0x13, 0x1f, 0x35, 0xff, 0x0f, 0x1c, 0x34, 0xff, 0x11, 0x23, 0x3e, 0xff, 0x13, 0x28, 0x47, 0xff, 0x13, 0x29, 0x49, 0xff, 0x15, 0x2a, 0x4a, 0xff, 0x18, 0x2b, 0x4a, 0xff, 0x1b, 0x2d, 0x4c, 0xff, 0x19, 0x2b, 0x48, 0xff, 0x19, 0x29, 0x46, 0xff, 0x1a, 0x2b, 0x48, 0xff, 0x1e, 0x2e, 0x47, 0xff, 0x20, 0x2d, 0x47, 0xff, 0x1e, 0x2c, 0x4a, 0xff, 0x21, 0x2f, 0x4d, 0xff, 0x24, 0x32, 0x4e, 0xff, 0x21, 0x30, 0x48, 0xff, 0x1d, 0x2b, 0x42, 0xff, 0x1d, 0x29, 0x42, 0xff, 0x1d, 0x2a, 0x45, 0xff, 0x20, 0x2d, 0x46, 0xff, 0x23, 0x2e, 0x44, 0xff, 0x23, 0x2c, 0x3f, 0xff, 0x35, 0x3b, 0x46, 0xff, 0x63, 0x72, 0x80, 0xff, 0x41, 0x5e, 0x7b, 0xff, 0x4f, 0x6b, 0x83, 0xff, 0x75, 0x84, 0x8e, 0xff, 0x8b, 0x92, 0x94, 0xff, 0x85, 0x8e, 0x94, 0xff, 0x7f, 0x8b, 0x95, 0xff, 0x88, 0x92, 0x9a, 0xff, 0x93, 0x9a, 0x9e, 0xff, 0x86, 0x8a, 0x8a, 0xff, 0x77, 0x7b, 0x7a, 0xff, 0x8d, 0x8c, 0x85, 0xff, 0x8f, 0x8d, 0x81, 0xff, 0x84, 0x83, 0x78, 0xff, 0x8c, 0x8d, 0x83, 0xff, 0x8c, 0x92, 0x8d, 0xff, 0x7e, 0x8b, 0x8f, 0xff, 0x89, 0x92, 0x94, 0xff, 0x89, 0x91, 0x8e, 0xff, 0x84, 0x8f, 0x98, 0xff, 0x76, 0x84, 0x92, 0xff, 0x5d, 0x6d, 0x7a, 0xff, 0x6e, 0x81, 0x8d, 0xff, 0x88, 0x93, 0x9c, 0xff, 0x95, 0x96, 0x95, 0xff, 0x98, 0x96, 0x89, 0xff, 0x94, 0x8f, 0x7c, 0xff, 0x95, 0x93, 0x81, 0xff, 0x94, 0x93, 0x89, 0xff, 0x93, 0x92, 0x8e, 0xff, 0x96, 0x95, 0x92, 0xff, 0x94, 0x95, 0x92, 0xff, 0x93, 0x95, 0x92, 0xff, 0x92, 0x97, 0x92, 0xff, 0x92, 0x97, 0x90, 0xff, 0x91, 0x94, 0x90, 0xff, 0x8e, 0x92, 0x91, 0xff, 0x91, 0x93, 0x8f, 0xff, 0x96, 0x95, 0x90, 0xff, 0x94, 0x92, 0x8a, 0xff, 0x91, 0x90, 0x86, 0xff, 0x94, 0x8f, 0x85, 0xff, 0x93, 0x8d, 0x7e, 0xff, 0x8e, 0x8f, 0x7c, 0xff, 0x87, 0x89, 0x82, 0xd3,
+    0x75, 0x8e, 0xa2, 0xe7, 0x7b, 0x91, 0xa1, 0xff, 0x79, 0x91, 0x9f, 0xff, 0x6b, 0x86, 0x94, 0xff, 0x6a, 0x84, 0x97, 0xff, 0x80, 0x96, 0xa4, 0xff, 0x90, 0x9f, 0xa4, 0xff, 0x8b, 0x98, 0x9a, 0xff, 0x81, 0x92, 0x99, 0xff, 0x7f, 0x94, 0xa0, 0xff, 0x84, 0x96, 0xa1, 0xff, 0x91, 0xa1, 0xa9, 0xff, 0x93, 0xa2, 0xab, 0xff, 0x8f, 0x9e, 0xa7, 0xff, 0x83, 0x93, 0xa1, 0xff, 0x81, 0x92, 0xa3, 0xff, 0x90, 0x9c, 0xa6, 0xff, 0x90, 0x9a, 0x9f, 0xff, 0x94, 0xa0, 0xa4, 0xff, 0x99, 0xa7, 0xaf, 0xff, 0x92, 0xa1, 0xab, 0xff, 0x84, 0x93, 0x9c, 0xff, 0x87, 0x95, 0x99, 0xff, 0x92, 0x9c, 0x9e, 0xff, 0x9a, 0x9f, 0x9f, 0xff, 0x9a, 0x9d, 0x9a, 0xff, 0x94, 0x9a, 0x94, 0xff, 0x91, 0x9c, 0x98, 0xff, 0x97, 0xa0, 0xa4, 0xff, 0x91, 0x9e, 0x9f, 0xff, 0x7e, 0x93, 0x9b, 0xff, 0x40, 0x54, 0x79, 0xff, 0x34, 0x41, 0x75, 0xff, 0x27, 0x31, 0x57, 0xff, 0x40, 0x4e, 0x73, 0xff, 0x67, 0x79, 0x9e, 0xff, 0x57, 0x65, 0x85, 0xff, 0x3c, 0x44, 0x66, 0xff, 0x44, 0x47, 0x6d, 0xff, 0x4a, 0x4c, 0x73, 0xff, 0x68, 0x68, 0x95, 0xff, 0x6c, 0x6f, 0x99, 0xff, 0x5d, 0x63, 0x83, 0xff, 0x59, 0x60, 0x7b, 0xff, 0x45, 0x4b, 0x6a, 0xff, 0x3a, 0x3e, 0x65, 0xff, 0x2c, 0x33, 0x54, 0xff, 0x17, 0x21, 0x3a, 0xff, 0x11, 0x19, 0x2d, 0xff, 0x0a, 0x11, 0x23, 0xff, 0x08, 0x0d, 0x20, 0xff, 0x10, 0x14, 0x27, 0xff, 0x17, 0x1f, 0x36, 0xff, 0x17, 0x21, 0x37, 0xff, 0x13, 0x1d, 0x30, 0xff, 0x0f, 0x1b, 0x2c, 0xff, 0x0d, 0x1a, 0x2e, 0xff, 0x0c, 0x19, 0x2e, 0xff, 0x0f, 0x1d, 0x35, 0xff, 0x13, 0x20, 0x39, 0xff, 0x10, 0x1e, 0x38, 0xff, 0x11, 0x20, 0x3c, 0xff, 0x16, 0x27, 0x44, 0xff, 0x14, 0x28, 0x43, 0xff, 0x15, 0x28, 0x44, 0xff, 0x19, 0x2b, 0x47, 0xff, 0x1a, 0x2c, 0x47, 0xff, 0x18, 0x2a, 0x45, 0xff, 0x1a, 0x2b, 0x46, 0xff, 0x1a, 0x2c, 0x47, 0xff, 0x1c, 0x2d, 0x48, 0xff, 0x1d, 0x2b, 0x47, 0xff, 0x1f, 0x2b, 0x45, 0xff, 0x23, 0x2f, 0x48, 0xff, 0x24, 0x30, 0x4a, 0xff, 0x1f, 0x2d, 0x47, 0xff, 0x1b, 0x2a, 0x41, 0xff, 0x1c, 0x29, 0x41, 0xff, 0x1d, 0x2a, 0x44, 0xff, 0x1f, 0x2c, 0x46, 0xff, 0x23, 0x2e, 0x44, 0xff, 0x22, 0x2b, 0x3f, 0xff, 0x3b, 0x41, 0x4b, 0xff, 0x74, 0x7f, 0x87, 0xff, 0x53, 0x6a, 0x7e, 0xff, 0x49, 0x66, 0x7d, 0xff, 0x65, 0x7c, 0x91, 0xff, 0x78, 0x86, 0x97, 0xff, 0x73, 0x82, 0x8e, 0xff, 0x76, 0x87, 0x90, 0xff, 0x8c, 0x97, 0x9d, 0xff, 0x92, 0x98, 0x9b, 0xff, 0x85, 0x8b, 0x8e, 0xff, 0x6e, 0x74, 0x7b, 0xff, 0x7a, 0x83, 0x8b, 0xff, 0x8b, 0x92, 0x90, 0xff, 0x90, 0x8b, 0x7e, 0xff, 0x97, 0x92, 0x87, 0xff, 0x89, 0x8e, 0x8f, 0xff, 0x81, 0x8b, 0x93, 0xff, 0x74, 0x83, 0x97, 0xff, 0x68, 0x7b, 0x91, 0xff, 0x7e, 0x8b, 0x96, 0xff, 0x7a, 0x84, 0x8f, 0xff, 0x69, 0x70, 0x7d, 0xff, 0x7a, 0x83, 0x8d, 0xff, 0x8a, 0x91, 0x93, 0xff, 0x8d, 0x94, 0x94, 0xff, 0x85, 0x91, 0x8f, 0xff, 0x8f, 0x90, 0x86, 0xff, 0x9f, 0x97, 0x86, 0xff, 0x8e, 0x92, 0x83, 0xff, 0x8c, 0x90, 0x8b, 0xff, 0x99, 0x93, 0x93, 0xff, 0x97, 0x95, 0x92, 0xff, 0x93, 0x92, 0x8e, 0xff, 0x90, 0x92, 0x8f, 0xff, 0x92, 0x96, 0x96, 0xff, 0x93, 0x95, 0x92, 0xff, 0x96, 0x94, 0x8e, 0xff, 0x95, 0x95, 0x8f, 0xff, 0x96, 0x95, 0x90, 0xff, 0x93, 0x91, 0x8a, 0xff, 0x92, 0x90, 0x84, 0xff, 0x95, 0x92, 0x87, 0xff, 0x96, 0x94, 0x89, 0xff, 0x96, 0x94, 0x85, 0xff, 0x90, 0x8f, 0x7f, 0xe6,
+    0x6f, 0x88, 0x9e, 0xf0, 0x74, 0x8c, 0x9e, 0xff, 0x74, 0x8e, 0x9f, 0xff, 0x76, 0x8f, 0xa1, 0xff, 0x7d, 0x93, 0xa0, 0xff, 0x88, 0x9b, 0xa4, 0xff, 0x91, 0x9f, 0xa4, 0xff, 0x90, 0x9c, 0x9f, 0xff, 0x8b, 0x99, 0x9b, 0xff, 0x8a, 0x9a, 0x9e, 0xff, 0x84, 0x97, 0xa5, 0xff, 0x8c, 0x9e, 0xad, 0xff, 0x91, 0xa1, 0xab, 0xff, 0x8f, 0x9c, 0xa6, 0xff, 0x8a, 0x9a, 0xa2, 0xff, 0x8a, 0x9a, 0xa4, 0xff, 0x89, 0x9a, 0xa5, 0xff, 0x7a, 0x8d, 0x99, 0xff, 0x7e, 0x91, 0x9e, 0xff, 0x89, 0x9b, 0xa8, 0xff, 0x82, 0x93, 0x9f, 0xff, 0x7d, 0x90, 0x9c, 0xff, 0x8a, 0x9a, 0x9e, 0xff, 0x95, 0x9e, 0x9e, 0xff, 0x98, 0x9d, 0x9b, 0xff, 0x94, 0x96, 0x95, 0xff, 0x90, 0x96, 0x93, 0xff, 0x96, 0xa0, 0x9c, 0xff, 0xa0, 0xa3, 0xa5, 0xff, 0x9c, 0xa5, 0xa1, 0xff, 0x92, 0xa6, 0xa5, 0xff, 0x47, 0x57, 0x72, 0xff, 0x2b, 0x34, 0x5e, 0xff, 0x35, 0x3d, 0x5c, 0xff, 0x54, 0x62, 0x84, 0xff, 0x68, 0x77, 0x9e, 0xff, 0x4c, 0x59, 0x7c, 0xff, 0x46, 0x4d, 0x6e, 0xff, 0x70, 0x73, 0x94, 0xff, 0x7d, 0x7c, 0xa2, 0xff, 0x87, 0x84, 0xac, 0xff, 0x6d, 0x6e, 0x91, 0xff, 0x5f, 0x62, 0x80, 0xff, 0x56, 0x5c, 0x77, 0xff, 0x44, 0x4b, 0x66, 0xff, 0x30, 0x36, 0x53, 0xff, 0x20, 0x29, 0x48, 0xff, 0x1c, 0x26, 0x41, 0xff, 0x17, 0x1f, 0x35, 0xff, 0x0d, 0x15, 0x24, 0xff, 0x06, 0x0b, 0x18, 0xff, 0x0d, 0x0c, 0x17, 0xff, 0x16, 0x1d, 0x31, 0xff, 0x11, 0x1e, 0x36, 0xff, 0x14, 0x1f, 0x32, 0xff, 0x11, 0x1f, 0x30, 0xff, 0x0f, 0x1f, 0x31, 0xff, 0x0e, 0x1b, 0x30, 0xff, 0x0f, 0x1c, 0x35, 0xff, 0x13, 0x20, 0x3c, 0xff, 0x11, 0x20, 0x3a, 0xff, 0x11, 0x1f, 0x3a, 0xff, 0x16, 0x23, 0x3f, 0xff, 0x16, 0x26, 0x41, 0xff, 0x14, 0x25, 0x40, 0xff, 0x19, 0x28, 0x43, 0xff, 0x1a, 0x2a, 0x44, 0xff, 0x1a, 0x2a, 0x45, 0xff, 0x1a, 0x2a, 0x45, 0xff, 0x18, 0x28, 0x43, 0xff, 0x18, 0x29, 0x46, 0xff, 0x19, 0x28, 0x45, 0xff, 0x1d, 0x29, 0x42, 0xff, 0x21, 0x2c, 0x42, 0xff, 0x22, 0x2d, 0x44, 0xff, 0x1f, 0x2b, 0x46, 0xff, 0x19, 0x27, 0x3f, 0xff, 0x1a, 0x27, 0x3f, 0xff, 0x1d, 0x2a, 0x45, 0xff, 0x20, 0x2d, 0x47, 0xff, 0x24, 0x2f, 0x45, 0xff, 0x25, 0x2c, 0x40, 0xff, 0x3d, 0x47, 0x58, 0xff, 0x65, 0x76, 0x87, 0xff, 0x4d, 0x66, 0x7e, 0xff, 0x45, 0x63, 0x81, 0xff, 0x51, 0x6d, 0x8c, 0xff, 0x62, 0x74, 0x91, 0xff, 0x66, 0x7d, 0x93, 0xff, 0x69, 0x80, 0x96, 0xff, 0x59, 0x6a, 0x7b, 0xff, 0x53, 0x60, 0x6d, 0xff, 0x6f, 0x7c, 0x87, 0xff, 0x71, 0x7e, 0x8e, 0xff, 0x58, 0x69, 0x7c, 0xff, 0x68, 0x77, 0x80, 0xff, 0x7d, 0x81, 0x7e, 0xff, 0x88, 0x8d, 0x8e, 0xff, 0x7e, 0x8a, 0x97, 0xff, 0x7f, 0x89, 0x96, 0xff, 0x73, 0x80, 0x97, 0xff, 0x65, 0x76, 0x8d, 0xff, 0x76, 0x83, 0x89, 0xff, 0x95, 0x9b, 0xa1, 0xff, 0x98, 0x9a, 0xa4, 0xff, 0x89, 0x8d, 0x92, 0xff, 0x96, 0x9a, 0x9d, 0xff, 0x86, 0x90, 0x96, 0xff, 0x6a, 0x7b, 0x7e, 0xff, 0x8f, 0x90, 0x8a, 0xff, 0xa1, 0x96, 0x87, 0xff, 0x8f, 0x90, 0x82, 0xff, 0x81, 0x8a, 0x81, 0xff, 0x8e, 0x92, 0x85, 0xff, 0x98, 0x98, 0x84, 0xff, 0x8b, 0x85, 0x6f, 0xff, 0x8f, 0x89, 0x79, 0xff, 0x9b, 0x98, 0x97, 0xff, 0x9a, 0x99, 0x96, 0xff, 0x99, 0x97, 0x8c, 0xff, 0x97, 0x97, 0x90, 0xff, 0x95, 0x96, 0x90, 0xff, 0x92, 0x90, 0x89, 0xff, 0x94, 0x8f, 0x87, 0xff, 0x98, 0x95, 0x8b, 0xff, 0x94, 0x95, 0x8a, 0xff, 0x94, 0x93, 0x87, 0xff, 0x95, 0x92, 0x83, 0xf0,
+    0x76, 0x8b, 0x9f, 0xf3, 0x7a, 0x8f, 0xa0, 0xff, 0x77, 0x8d, 0x9e, 0xff, 0x7b, 0x91, 0xa4, 0xff, 0x88, 0x94, 0x9a, 0xff, 0x88, 0x97, 0x9d, 0xff, 0x82, 0x97, 0xa3, 0xff, 0x7d, 0x92, 0xa1, 0xff, 0x81, 0x93, 0x9b, 0xff, 0x8b, 0x98, 0x99, 0xff, 0x7f, 0x93, 0xa6, 0xff, 0x7f, 0x94, 0xac, 0xff, 0x92, 0xa1, 0xaf, 0xff, 0x96, 0xa4, 0xaa, 0xff, 0x8f, 0x9c, 0x9f, 0xff, 0x8d, 0x9b, 0x9d, 0xff, 0x80, 0x96, 0xa2, 0xff, 0x6c, 0x84, 0x94, 0xff, 0x71, 0x88, 0x96, 0xff, 0x7f, 0x94, 0xa2, 0xff, 0x79, 0x8f, 0x9d, 0xff, 0x77, 0x8e, 0x9c, 0xff, 0x7c, 0x91, 0x9b, 0xff, 0x8a, 0x99, 0x9e, 0xff, 0x98, 0xa1, 0xa3, 0xff, 0x94, 0x9a, 0x9b, 0xff, 0x8e, 0x98, 0x9a, 0xff, 0x91, 0xa0, 0xa3, 0xff, 0x97, 0xa1, 0xa8, 0xff, 0x92, 0x9e, 0xa3, 0xff, 0x92, 0xa4, 0xae, 0xff, 0x53, 0x62, 0x7c, 0xff, 0x23, 0x2e, 0x51, 0xff, 0x37, 0x40, 0x5f, 0xff, 0x62, 0x6b, 0x93, 0xff, 0x5f, 0x69, 0x95, 0xff, 0x44, 0x4e, 0x73, 0xff, 0x6b, 0x73, 0x94, 0xff, 0x89, 0x8e, 0xae, 0xff, 0x8a, 0x8c, 0xad, 0xff, 0x6d, 0x6e, 0x8b, 0xff, 0x60, 0x62, 0x7b, 0xff, 0x53, 0x57, 0x6c, 0xff, 0x40, 0x47, 0x59, 0xff, 0x23, 0x2a, 0x3c, 0xff, 0x0d, 0x14, 0x26, 0xff, 0x05, 0x0c, 0x22, 0xff, 0x06, 0x0e, 0x23, 0xff, 0x0e, 0x16, 0x25, 0xff, 0x0b, 0x11, 0x1c, 0xff, 0x00, 0x00, 0x06, 0xff, 0x02, 0x02, 0x09, 0xff, 0x1a, 0x22, 0x36, 0xff, 0x15, 0x21, 0x39, 0xff, 0x13, 0x1d, 0x31, 0xff, 0x11, 0x1e, 0x30, 0xff, 0x12, 0x20, 0x33, 0xff, 0x12, 0x1f, 0x36, 0xff, 0x10, 0x1d, 0x35, 0xff, 0x12, 0x1f, 0x38, 0xff, 0x13, 0x20, 0x39, 0xff, 0x10, 0x20, 0x3a, 0xff, 0x10, 0x1e, 0x3a, 0xff, 0x13, 0x22, 0x3e, 0xff, 0x14, 0x23, 0x3f, 0xff, 0x17, 0x24, 0x41, 0xff, 0x19, 0x27, 0x43, 0xff, 0x1b, 0x28, 0x45, 0xff, 0x1c, 0x2a, 0x46, 0xff, 0x1a, 0x28, 0x44, 0xff, 0x18, 0x26, 0x43, 0xff, 0x19, 0x27, 0x43, 0xff, 0x1e, 0x29, 0x42, 0xff, 0x20, 0x2b, 0x41, 0xff, 0x21, 0x2c, 0x42, 0xff, 0x1c, 0x28, 0x41, 0xff, 0x18, 0x24, 0x3e, 0xff, 0x1b, 0x28, 0x40, 0xff, 0x1b, 0x28, 0x43, 0xff, 0x20, 0x2d, 0x47, 0xff, 0x24, 0x2f, 0x45, 0xff, 0x27, 0x2c, 0x3f, 0xff, 0x36, 0x42, 0x56, 0xff, 0x50, 0x66, 0x80, 0xff, 0x4a, 0x65, 0x81, 0xff, 0x48, 0x65, 0x83, 0xff, 0x54, 0x6d, 0x88, 0xff, 0x6d, 0x7f, 0x91, 0xff, 0x66, 0x7a, 0x96, 0xff, 0x55, 0x6e, 0x91, 0xff, 0x30, 0x45, 0x61, 0xff, 0x3e, 0x4f, 0x65, 0xff, 0x57, 0x66, 0x78, 0xff, 0x5f, 0x6f, 0x7e, 0xff, 0x5a, 0x6b, 0x77, 0xff, 0x5d, 0x6b, 0x74, 0xff, 0x68, 0x76, 0x7e, 0xff, 0x6b, 0x7d, 0x8d, 0xff, 0x69, 0x7b, 0x8f, 0xff, 0x80, 0x8a, 0x91, 0xff, 0x8f, 0x94, 0x97, 0xff, 0x86, 0x8e, 0x90, 0xff, 0x89, 0x92, 0x8c, 0xff, 0x97, 0x9d, 0x9d, 0xff, 0x95, 0x9a, 0xa2, 0xff, 0x91, 0x9a, 0x9b, 0xff, 0x89, 0x92, 0x99, 0xff, 0x84, 0x8e, 0x9b, 0xff, 0x85, 0x8f, 0x8b, 0xff, 0x95, 0x92, 0x85, 0xff, 0x9b, 0x91, 0x84, 0xff, 0x96, 0x90, 0x85, 0xff, 0x7f, 0x88, 0x7d, 0xff, 0x83, 0x90, 0x81, 0xff, 0x8a, 0x86, 0x66, 0xff, 0x87, 0x78, 0x4e, 0xff, 0x95, 0x84, 0x60, 0xff, 0x9a, 0x8f, 0x7d, 0xff, 0x98, 0x94, 0x8a, 0xff, 0x95, 0x97, 0x8c, 0xff, 0x95, 0x97, 0x8f, 0xff, 0x95, 0x97, 0x93, 0xff, 0x95, 0x93, 0x8f, 0xff, 0x97, 0x91, 0x8d, 0xff, 0x95, 0x91, 0x8c, 0xff, 0x87, 0x89, 0x80, 0xff, 0x90, 0x8e, 0x84, 0xff, 0x98, 0x96, 0x8c, 0xf3,
+    0x7c, 0x90, 0xa1, 0xff, 0x83, 0x94, 0xa6, 0xff, 0x78, 0x8c, 0x9f, 0xff, 0x73, 0x88, 0x9e, 0xff, 0x83, 0x93, 0x9b, 0xff, 0x83, 0x96, 0xa1, 0xff, 0x70, 0x8b, 0xa3, 0xff, 0x66, 0x84, 0x9e, 0xff, 0x6c, 0x86, 0x9a, 0xff, 0x7e, 0x90, 0x9c, 0xff, 0x7d, 0x92, 0xaa, 0xff, 0x7f, 0x93, 0xac, 0xff, 0x93, 0xa4, 0xb2, 0xff, 0x9a, 0xa8, 0xad, 0xff, 0x8e, 0x9b, 0x9d, 0xff, 0x8e, 0x9c, 0x9c, 0xff, 0x86, 0x98, 0x9e, 0xff, 0x79, 0x8c, 0x95, 0xff, 0x85, 0x96, 0x9c, 0xff, 0x90, 0xa1, 0xa6, 0xff, 0x8e, 0x9e, 0xa2, 0xff, 0x80, 0x91, 0x94, 0xff, 0x74, 0x86, 0x8e, 0xff, 0x7e, 0x8e, 0x95, 0xff, 0x96, 0xa1, 0xa4, 0xff, 0x98, 0xa2, 0xa5, 0xff, 0x8a, 0x96, 0x9f, 0xff, 0x83, 0x94, 0xa0, 0xff, 0x7a, 0x92, 0xa4, 0xff, 0x74, 0x8b, 0xa3, 0xff, 0x80, 0x96, 0xb1, 0xff, 0x5e, 0x74, 0x92, 0xff, 0x19, 0x2d, 0x4f, 0xff, 0x2c, 0x3c, 0x64, 0xff, 0x5b, 0x65, 0x92, 0xff, 0x53, 0x59, 0x83, 0xff, 0x51, 0x5a, 0x7e, 0xff, 0x6b, 0x74, 0x93, 0xff, 0x6a, 0x70, 0x8d, 0xff, 0x4b, 0x4f, 0x6c, 0xff, 0x39, 0x3b, 0x55, 0xff, 0x38, 0x38, 0x50, 0xff, 0x16, 0x19, 0x30, 0xff, 0x00, 0x06, 0x19, 0xff, 0x00, 0x00, 0x11, 0xff, 0x06, 0x0e, 0x1d, 0xff, 0x0a, 0x12, 0x25, 0xff, 0x08, 0x10, 0x22, 0xff, 0x06, 0x0e, 0x1d, 0xff, 0x00, 0x04, 0x0d, 0xff, 0x00, 0x00, 0x05, 0xff, 0x08, 0x0b, 0x14, 0xff, 0x1e, 0x26, 0x3b, 0xff, 0x16, 0x21, 0x3a, 0xff, 0x14, 0x1e, 0x33, 0xff, 0x10, 0x1d, 0x30, 0xff, 0x0f, 0x1d, 0x32, 0xff, 0x13, 0x1f, 0x37, 0xff, 0x13, 0x1f, 0x37, 0xff, 0x11, 0x1d, 0x35, 0xff, 0x10, 0x1c, 0x34, 0xff, 0x12, 0x1f, 0x39, 0xff, 0x11, 0x1f, 0x3a, 0xff, 0x11, 0x20, 0x3a, 0xff, 0x14, 0x23, 0x3d, 0xff, 0x18, 0x26, 0x41, 0xff, 0x19, 0x28, 0x42, 0xff, 0x19, 0x27, 0x42, 0xff, 0x19, 0x27, 0x42, 0xff, 0x17, 0x26, 0x41, 0xff, 0x16, 0x24, 0x40, 0xff, 0x19, 0x25, 0x40, 0xff, 0x1d, 0x28, 0x3f, 0xff, 0x1f, 0x2a, 0x40, 0xff, 0x1f, 0x2a, 0x40, 0xff, 0x1a, 0x25, 0x3e, 0xff, 0x17, 0x24, 0x3c, 0xff, 0x1a, 0x27, 0x3f, 0xff, 0x1c, 0x29, 0x43, 0xff, 0x1d, 0x2b, 0x44, 0xff, 0x21, 0x2c, 0x43, 0xff, 0x20, 0x27, 0x3a, 0xff, 0x41, 0x4a, 0x5b, 0xff, 0x73, 0x82, 0x94, 0xff, 0x63, 0x74, 0x86, 0xff, 0x5a, 0x6c, 0x7c, 0xff, 0x65, 0x75, 0x81, 0xff, 0x83, 0x8d, 0x93, 0xff, 0x77, 0x84, 0x96, 0xff, 0x69, 0x7a, 0x96, 0xff, 0x64, 0x74, 0x88, 0xff, 0x77, 0x84, 0x93, 0xff, 0x81, 0x8a, 0x92, 0xff, 0x84, 0x8c, 0x8d, 0xff, 0x89, 0x8f, 0x8e, 0xff, 0x88, 0x8e, 0x8b, 0xff, 0x7f, 0x88, 0x8a, 0xff, 0x64, 0x73, 0x7f, 0xff, 0x71, 0x7f, 0x89, 0xff, 0x98, 0x97, 0x90, 0xff, 0x9f, 0x99, 0x8d, 0xff, 0x99, 0x9a, 0x91, 0xff, 0x9a, 0x9f, 0x92, 0xff, 0x99, 0x9f, 0x9b, 0xff, 0x93, 0x99, 0xa0, 0xff, 0x8c, 0x96, 0x96, 0xff, 0x7e, 0x8a, 0x92, 0xff, 0x8c, 0x95, 0x9f, 0xff, 0xa1, 0xa2, 0x90, 0xff, 0x89, 0x83, 0x6d, 0xff, 0x93, 0x8a, 0x7d, 0xff, 0xa0, 0x98, 0x88, 0xff, 0x96, 0x96, 0x93, 0xff, 0x84, 0x83, 0x8a, 0xff, 0x77, 0x69, 0x53, 0xff, 0x90, 0x7a, 0x50, 0xff, 0x99, 0x84, 0x57, 0xff, 0x8e, 0x7f, 0x57, 0xff, 0x87, 0x83, 0x6c, 0xff, 0x92, 0x96, 0x8e, 0xff, 0x99, 0x9b, 0x95, 0xff, 0x97, 0x99, 0x96, 0xff, 0x90, 0x90, 0x8d, 0xff, 0x95, 0x91, 0x8d, 0xff, 0x91, 0x8e, 0x8a, 0xff, 0x7d, 0x7e, 0x77, 0xff, 0x85, 0x84, 0x7b, 0xff, 0x92, 0x92, 0x8a, 0xff,
+    0x80, 0x96, 0xa6, 0xff, 0x82, 0x96, 0xa6, 0xff, 0x72, 0x87, 0x9c, 0xff, 0x6d, 0x85, 0x9c, 0xff, 0x83, 0x96, 0xa3, 0xff, 0x87, 0x9a, 0xa9, 0xff, 0x74, 0x8c, 0xa0, 0xff, 0x68, 0x83, 0x98, 0xff, 0x68, 0x83, 0x99, 0xff, 0x6d, 0x88, 0x9f, 0xff, 0x7c, 0x92, 0xa7, 0xff, 0x8a, 0x9c, 0xad, 0xff, 0x93, 0xa1, 0xaf, 0xff, 0x95, 0xa3, 0xaa, 0xff, 0x8d, 0x9b, 0xa0, 0xff, 0x8d, 0x9c, 0xa2, 0xff, 0x8a, 0x98, 0x9e, 0xff, 0x80, 0x8d, 0x92, 0xff, 0x8d, 0x98, 0x9d, 0xff, 0x97, 0xa3, 0xa5, 0xff, 0x98, 0xa2, 0xa2, 0xff, 0x91, 0x9a, 0x99, 0xff, 0x87, 0x95, 0x96, 0xff, 0x90, 0x9d, 0x9e, 0xff, 0x99, 0xa4, 0xa3, 0xff, 0x97, 0xa4, 0xa6, 0xff, 0x83, 0x93, 0xa1, 0xff, 0x72, 0x87, 0x9f, 0xff, 0x6a, 0x89, 0xa3, 0xff, 0x65, 0x83, 0xa4, 0xff, 0x6e, 0x85, 0xaa, 0xff, 0x73, 0x8b, 0xa7, 0xff, 0x28, 0x3e, 0x59, 0xff, 0x26, 0x36, 0x61, 0xff, 0x4d, 0x56, 0x7e, 0xff, 0x49, 0x51, 0x72, 0xff, 0x50, 0x59, 0x77, 0xff, 0x5a, 0x63, 0x7d, 0xff, 0x3a, 0x40, 0x5a, 0xff, 0x12, 0x16, 0x32, 0xff, 0x0b, 0x0e, 0x2b, 0xff, 0x00, 0x00, 0x16, 0xff, 0x00, 0x00, 0x19, 0xff, 0x17, 0x19, 0x38, 0xff, 0x37, 0x3b, 0x58, 0xff, 0x44, 0x48, 0x61, 0xff, 0x33, 0x3b, 0x52, 0xff, 0x26, 0x2e, 0x44, 0xff, 0x1e, 0x25, 0x38, 0xff, 0x16, 0x20, 0x2e, 0xff, 0x13, 0x1c, 0x2c, 0xff, 0x1e, 0x25, 0x35, 0xff, 0x24, 0x2c, 0x44, 0xff, 0x12, 0x1d, 0x37, 0xff, 0x11, 0x1c, 0x31, 0xff, 0x0f, 0x1d, 0x2f, 0xff, 0x12, 0x1f, 0x35, 0xff, 0x15, 0x20, 0x3b, 0xff, 0x15, 0x20, 0x39, 0xff, 0x13, 0x1f, 0x36, 0xff, 0x0f, 0x1b, 0x33, 0xff, 0x12, 0x1e, 0x37, 0xff, 0x13, 0x1f, 0x39, 0xff, 0x12, 0x20, 0x3a, 0xff, 0x14, 0x22, 0x3c, 0xff, 0x15, 0x22, 0x3c, 0xff, 0x18, 0x26, 0x3f, 0xff, 0x1a, 0x27, 0x41, 0xff, 0x18, 0x25, 0x3f, 0xff, 0x18, 0x25, 0x3f, 0xff, 0x15, 0x23, 0x3e, 0xff, 0x16, 0x23, 0x3e, 0xff, 0x1a, 0x25, 0x3c, 0xff, 0x1e, 0x27, 0x3b, 0xff, 0x1d, 0x26, 0x3b, 0xff, 0x17, 0x22, 0x39, 0xff, 0x16, 0x23, 0x3b, 0xff, 0x19, 0x26, 0x3e, 0xff, 0x1c, 0x29, 0x44, 0xff, 0x1d, 0x2a, 0x44, 0xff, 0x21, 0x2c, 0x42, 0xff, 0x24, 0x2d, 0x42, 0xff, 0x2c, 0x31, 0x3e, 0xff, 0x6c, 0x6f, 0x76, 0xff, 0x85, 0x8d, 0x93, 0xff, 0x72, 0x7c, 0x80, 0xff, 0x73, 0x7e, 0x80, 0xff, 0x87, 0x8e, 0x8e, 0xff, 0x88, 0x92, 0x97, 0xff, 0x7f, 0x89, 0x95, 0xff, 0x83, 0x8e, 0x96, 0xff, 0x8e, 0x97, 0x9b, 0xff, 0x97, 0x9b, 0x97, 0xff, 0x9e, 0x9c, 0x92, 0xff, 0x98, 0x96, 0x8b, 0xff, 0x99, 0x98, 0x8a, 0xff, 0x92, 0x91, 0x82, 0xff, 0x87, 0x8b, 0x86, 0xff, 0x90, 0x95, 0x93, 0xff, 0xa3, 0x9e, 0x90, 0xff, 0xa3, 0x9b, 0x8d, 0xff, 0x9d, 0x9a, 0x92, 0xff, 0x9b, 0x9f, 0x93, 0xff, 0x95, 0x9c, 0x9b, 0xff, 0x7d, 0x84, 0x8d, 0xff, 0x71, 0x7b, 0x7d, 0xff, 0x8b, 0x96, 0x9a, 0xff, 0xa2, 0xa6, 0xa1, 0xff, 0x9a, 0x91, 0x6c, 0xff, 0x7c, 0x70, 0x4c, 0xff, 0x99, 0x8f, 0x7f, 0xff, 0xa5, 0x9e, 0x8d, 0xff, 0xa5, 0x9c, 0x91, 0xff, 0x7d, 0x6e, 0x6a, 0xff, 0x70, 0x61, 0x4b, 0xff, 0x8b, 0x79, 0x56, 0xff, 0x8b, 0x7b, 0x50, 0xff, 0x81, 0x70, 0x42, 0xff, 0x8a, 0x82, 0x68, 0xff, 0x99, 0x9b, 0x9d, 0xff, 0x9a, 0x9b, 0x99, 0xff, 0x92, 0x94, 0x91, 0xff, 0x8b, 0x8b, 0x85, 0xff, 0x91, 0x8f, 0x87, 0xff, 0x8f, 0x8d, 0x83, 0xff, 0x88, 0x86, 0x7e, 0xff, 0x8c, 0x8a, 0x81, 0xff, 0x90, 0x8e, 0x86, 0xff,
+    0x7a, 0x92, 0xa1, 0xf3, 0x79, 0x91, 0xa2, 0xff, 0x6d, 0x84, 0x9b, 0xff, 0x6a, 0x85, 0x9e, 0xff, 0x81, 0x92, 0xa0, 0xff, 0x90, 0x9b, 0xa0, 0xff, 0x8e, 0x98, 0x9c, 0xff, 0x88, 0x93, 0x9b, 0xff, 0x7a, 0x8e, 0x9f, 0xff, 0x68, 0x83, 0x9e, 0xff, 0x7b, 0x8e, 0x9f, 0xff, 0x93, 0xa1, 0xaa, 0xff, 0x94, 0xa3, 0xac, 0xff, 0x95, 0xa4, 0xad, 0xff, 0x90, 0xa0, 0xab, 0xff, 0x89, 0x9a, 0xa7, 0xff, 0x84, 0x93, 0xa2, 0xff, 0x81, 0x90, 0x9e, 0xff, 0x8a, 0x97, 0xa2, 0xff, 0x93, 0x9f, 0xa8, 0xff, 0x93, 0x9e, 0xa5, 0xff, 0x94, 0x9e, 0xa5, 0xff, 0x97, 0x9f, 0x9d, 0xff, 0x9d, 0xa4, 0x9c, 0xff, 0x9e, 0xa7, 0x9f, 0xff, 0x96, 0xa4, 0xa4, 0xff, 0x81, 0x96, 0xa8, 0xff, 0x6e, 0x88, 0xa9, 0xff, 0x6e, 0x8c, 0xa4, 0xff, 0x6a, 0x83, 0xa1, 0xff, 0x6b, 0x7d, 0xa2, 0xff, 0x8a, 0x9c, 0xaf, 0xff, 0x50, 0x61, 0x6f, 0xff, 0x2a, 0x33, 0x55, 0xff, 0x42, 0x49, 0x69, 0xff, 0x31, 0x3b, 0x56, 0xff, 0x3a, 0x44, 0x5d, 0xff, 0x1a, 0x23, 0x38, 0xff, 0x00, 0x00, 0x12, 0xff, 0x00, 0x00, 0x15, 0xff, 0x10, 0x11, 0x34, 0xff, 0x3d, 0x3b, 0x68, 0xff, 0x70, 0x6f, 0x9e, 0xff, 0x78, 0x77, 0xa7, 0xff, 0x5d, 0x60, 0x8b, 0xff, 0x3a, 0x3f, 0x63, 0xff, 0x2e, 0x36, 0x54, 0xff, 0x25, 0x2f, 0x4a, 0xff, 0x22, 0x2c, 0x43, 0xff, 0x21, 0x2b, 0x40, 0xff, 0x1b, 0x26, 0x3b, 0xff, 0x22, 0x2c, 0x42, 0xff, 0x1f, 0x28, 0x43, 0xff, 0x10, 0x1a, 0x34, 0xff, 0x0e, 0x19, 0x2e, 0xff, 0x11, 0x1e, 0x32, 0xff, 0x12, 0x1f, 0x35, 0xff, 0x16, 0x21, 0x3c, 0xff, 0x15, 0x21, 0x39, 0xff, 0x13, 0x20, 0x35, 0xff, 0x12, 0x1e, 0x36, 0xff, 0x11, 0x1e, 0x36, 0xff, 0x11, 0x1e, 0x37, 0xff, 0x13, 0x20, 0x3a, 0xff, 0x14, 0x21, 0x3b, 0xff, 0x13, 0x20, 0x3a, 0xff, 0x15, 0x22, 0x3c, 0xff, 0x16, 0x23, 0x3e, 0xff, 0x15, 0x22, 0x3c, 0xff, 0x15, 0x22, 0x3c, 0xff, 0x15, 0x22, 0x3d, 0xff, 0x16, 0x22, 0x3c, 0xff, 0x19, 0x23, 0x38, 0xff, 0x1a, 0x22, 0x35, 0xff, 0x18, 0x21, 0x34, 0xff, 0x16, 0x20, 0x37, 0xff, 0x17, 0x23, 0x3b, 0xff, 0x18, 0x26, 0x3e, 0xff, 0x1a, 0x27, 0x42, 0xff, 0x1c, 0x2b, 0x44, 0xff, 0x22, 0x2c, 0x43, 0xff, 0x2b, 0x34, 0x49, 0xff, 0x17, 0x1a, 0x27, 0xff, 0x3d, 0x3e, 0x45, 0xff, 0x8e, 0x96, 0x9b, 0xff, 0x76, 0x81, 0x84, 0xff, 0x6e, 0x7b, 0x81, 0xff, 0x7e, 0x8a, 0x91, 0xff, 0x88, 0x94, 0x98, 0xff, 0x7d, 0x8b, 0x8c, 0xff, 0x7f, 0x8c, 0x8f, 0xff, 0x8b, 0x94, 0x97, 0xff, 0x95, 0x98, 0x94, 0xff, 0x9f, 0x9c, 0x8f, 0xff, 0x96, 0x96, 0x8c, 0xff, 0x92, 0x92, 0x85, 0xff, 0x9e, 0x97, 0x81, 0xff, 0x9f, 0x9b, 0x8d, 0xff, 0x99, 0x9c, 0x98, 0xff, 0x99, 0x9d, 0x96, 0xff, 0x9c, 0x97, 0x91, 0xff, 0x9e, 0x99, 0x93, 0xff, 0x99, 0x9f, 0x95, 0xff, 0x90, 0x98, 0x9c, 0xff, 0x80, 0x86, 0x96, 0xff, 0x7e, 0x87, 0x8d, 0xff, 0x94, 0x9b, 0x9d, 0xff, 0xa7, 0xa4, 0x92, 0xff, 0x82, 0x72, 0x3f, 0xff, 0x81, 0x72, 0x40, 0xff, 0xa2, 0x9a, 0x83, 0xff, 0xa4, 0x9f, 0x95, 0xff, 0x9e, 0x91, 0x70, 0xff, 0x7a, 0x69, 0x33, 0xff, 0x73, 0x6a, 0x3f, 0xff, 0x78, 0x72, 0x4e, 0xff, 0x7a, 0x70, 0x51, 0xff, 0x7a, 0x67, 0x43, 0xff, 0x97, 0x89, 0x77, 0xff, 0x98, 0x98, 0x9f, 0xff, 0x90, 0x91, 0x92, 0xff, 0x8a, 0x8d, 0x8c, 0xff, 0x8d, 0x91, 0x88, 0xff, 0x91, 0x92, 0x84, 0xff, 0x90, 0x8e, 0x81, 0xff, 0x91, 0x8d, 0x84, 0xff, 0x96, 0x92, 0x88, 0xff, 0x95, 0x91, 0x8a, 0xf3,
+    0x7f, 0x91, 0x9d, 0xf0, 0x87, 0x99, 0xa4, 0xff, 0x83, 0x97, 0xa5, 0xff, 0x7d, 0x94, 0xa6, 0xff, 0x83, 0x94, 0xa3, 0xff, 0x87, 0x93, 0x9d, 0xff, 0x8e, 0x9b, 0xa1, 0xff, 0x8e, 0x9b, 0x9e, 0xff, 0x85, 0x94, 0x99, 0xff, 0x7e, 0x90, 0x95, 0xff, 0x81, 0x96, 0xa0, 0xff, 0x8f, 0xa1, 0xa9, 0xff, 0x98, 0xa4, 0xa8, 0xff, 0x9d, 0xa7, 0xab, 0xff, 0x94, 0xa3, 0xad, 0xff, 0x80, 0x95, 0xa6, 0xff, 0x7f, 0x8e, 0xa0, 0xff, 0x83, 0x92, 0xa0, 0xff, 0x89, 0x9b, 0xa4, 0xff, 0x94, 0xa3, 0xa9, 0xff, 0x98, 0x9e, 0xa6, 0xff, 0x9a, 0x9e, 0xa6, 0xff, 0x99, 0xa1, 0xa2, 0xff, 0x98, 0xa3, 0xa0, 0xff, 0x9b, 0xa4, 0xa3, 0xff, 0x95, 0xa2, 0xa9, 0xff, 0x85, 0x96, 0xaa, 0xff, 0x73, 0x89, 0xa8, 0xff, 0x6a, 0x88, 0xa7, 0xff, 0x6f, 0x89, 0xa4, 0xff, 0x86, 0x92, 0xa0, 0xff, 0x9d, 0xa4, 0xa1, 0xff, 0x8d, 0x93, 0x96, 0xff, 0x40, 0x42, 0x5e, 0xff, 0x2a, 0x32, 0x55, 0xff, 0x15, 0x20, 0x31, 0xff, 0x18, 0x23, 0x2b, 0xff, 0x0c, 0x12, 0x34, 0xff, 0x4e, 0x4e, 0x86, 0xff, 0x77, 0x72, 0xa2, 0xff, 0x8d, 0x85, 0xbb, 0xff, 0xa0, 0x9a, 0xd3, 0xff, 0x76, 0x74, 0xa3, 0xff, 0x37, 0x39, 0x60, 0xff, 0x1a, 0x20, 0x42, 0xff, 0x20, 0x28, 0x49, 0xff, 0x21, 0x2a, 0x46, 0xff, 0x16, 0x1f, 0x39, 0xff, 0x14, 0x1e, 0x36, 0xff, 0x1a, 0x23, 0x38, 0xff, 0x1d, 0x24, 0x39, 0xff, 0x25, 0x2b, 0x3f, 0xff, 0x19, 0x21, 0x37, 0xff, 0x0d, 0x19, 0x2e, 0xff, 0x0d, 0x18, 0x2d, 0xff, 0x10, 0x1c, 0x31, 0xff, 0x0e, 0x1a, 0x2e, 0xff, 0x11, 0x1c, 0x32, 0xff, 0x12, 0x1f, 0x33, 0xff, 0x10, 0x1e, 0x34, 0xff, 0x10, 0x1d, 0x33, 0xff, 0x10, 0x1c, 0x33, 0xff, 0x12, 0x1f, 0x38, 0xff, 0x12, 0x1f, 0x3a, 0xff, 0x12, 0x1f, 0x39, 0xff, 0x12, 0x1e, 0x39, 0xff, 0x10, 0x1c, 0x36, 0xff, 0x11, 0x1d, 0x36, 0xff, 0x13, 0x1e, 0x36, 0xff, 0x12, 0x1e, 0x36, 0xff, 0x16, 0x20, 0x35, 0xff, 0x18, 0x21, 0x34, 0xff, 0x17, 0x21, 0x34, 0xff, 0x14, 0x1d, 0x32, 0xff, 0x11, 0x1d, 0x33, 0xff, 0x15, 0x21, 0x38, 0xff, 0x18, 0x24, 0x3c, 0xff, 0x17, 0x25, 0x3c, 0xff, 0x1b, 0x27, 0x40, 0xff, 0x1d, 0x2b, 0x42, 0xff, 0x1f, 0x2b, 0x41, 0xff, 0x2b, 0x37, 0x4f, 0xff, 0x13, 0x19, 0x28, 0xff, 0x33, 0x2d, 0x2b, 0xff, 0x94, 0x94, 0x9a, 0xff, 0x7a, 0x85, 0x95, 0xff, 0x75, 0x7b, 0x7f, 0xff, 0x87, 0x94, 0x99, 0xff, 0x85, 0x91, 0x92, 0xff, 0x80, 0x89, 0x83, 0xff, 0x71, 0x86, 0x8e, 0xff, 0x6a, 0x83, 0x8f, 0xff, 0x7d, 0x8d, 0x92, 0xff, 0x96, 0x95, 0x91, 0xff, 0x98, 0x95, 0x8c, 0xff, 0x94, 0x98, 0x88, 0xff, 0x9a, 0x99, 0x87, 0xff, 0x95, 0x95, 0x86, 0xff, 0x95, 0x9a, 0x91, 0xff, 0x94, 0x9c, 0x96, 0xff, 0x85, 0x91, 0x91, 0xff, 0x86, 0x95, 0x94, 0xff, 0x98, 0x9c, 0x9a, 0xff, 0x9d, 0x99, 0x99, 0xff, 0xa0, 0x9c, 0x9b, 0xff, 0x9c, 0x9e, 0x96, 0xff, 0x9e, 0xa2, 0xa4, 0xff, 0x9c, 0x8e, 0x7f, 0xff, 0x7e, 0x6c, 0x08, 0xff, 0x99, 0x86, 0x53, 0xff, 0x9a, 0x9a, 0x8a, 0xff, 0xa0, 0x9c, 0x87, 0xff, 0x8d, 0x7c, 0x4b, 0xff, 0x79, 0x69, 0x29, 0xff, 0x7b, 0x6a, 0x48, 0xff, 0x7b, 0x67, 0x42, 0xff, 0x7d, 0x6d, 0x40, 0xff, 0x83, 0x73, 0x50, 0xff, 0x96, 0x92, 0x8a, 0xff, 0x7e, 0x8a, 0x92, 0xff, 0x7a, 0x82, 0x87, 0xff, 0x89, 0x8b, 0x88, 0xff, 0x98, 0x94, 0x89, 0xff, 0x95, 0x92, 0x88, 0xff, 0x94, 0x91, 0x8a, 0xff, 0x96, 0x90, 0x87, 0xff, 0x97, 0x92, 0x89, 0xff, 0x96, 0x92, 0x89, 0xf0,
+    0x85, 0x95, 0x9b, 0xe7, 0x8d, 0x9c, 0xa0, 0xff, 0x8b, 0x9c, 0xa4, 0xff, 0x7f, 0x91, 0x9f, 0xff, 0x7a, 0x8c, 0x9c, 0xff, 0x7e, 0x90, 0x9e, 0xff, 0x83, 0x95, 0xa1, 0xff, 0x84, 0x96, 0x9c, 0xff, 0x8a, 0x99, 0x99, 0xff, 0x8d, 0x9a, 0x97, 0xff, 0x8c, 0xa0, 0xa4, 0xff, 0x8d, 0x9f, 0xa8, 0xff, 0x93, 0xa0, 0xa9, 0xff, 0x96, 0xa2, 0xab, 0xff, 0x8c, 0x9c, 0xa8, 0xff, 0x7e, 0x91, 0xa0, 0xff, 0x8c, 0x99, 0xa3, 0xff, 0x93, 0x9e, 0xa5, 0xff, 0x93, 0xa1, 0xa6, 0xff, 0x98, 0xa5, 0xa8, 0xff, 0x9b, 0xa2, 0xa6, 0xff, 0x9b, 0x9d, 0xa1, 0xff, 0x94, 0x9c, 0x9d, 0xff, 0x99, 0xa2, 0xa2, 0xff, 0x9e, 0xa6, 0xa8, 0xff, 0x9b, 0xa4, 0xa9, 0xff, 0x8e, 0x99, 0xa7, 0xff, 0x82, 0x93, 0xa4, 0xff, 0x73, 0x8a, 0xa0, 0xff, 0x80, 0x91, 0xa1, 0xff, 0xa0, 0xa4, 0xa1, 0xff, 0xa6, 0xa7, 0x95, 0xff, 0xb4, 0xb7, 0xae, 0xff, 0x69, 0x6b, 0x7f, 0xff, 0x26, 0x2f, 0x53, 0xff, 0x18, 0x22, 0x30, 0xff, 0x00, 0x00, 0x00, 0xff, 0x45, 0x4b, 0x70, 0xff, 0xb5, 0xb6, 0xf7, 0xff, 0x99, 0x91, 0xc8, 0xff, 0x6d, 0x69, 0x9d, 0xff, 0x4d, 0x50, 0x81, 0xff, 0x1f, 0x25, 0x4a, 0xff, 0x12, 0x1d, 0x37, 0xff, 0x13, 0x21, 0x36, 0xff, 0x0e, 0x1b, 0x32, 0xff, 0x0c, 0x16, 0x2d, 0xff, 0x12, 0x19, 0x2f, 0xff, 0x13, 0x1b, 0x2f, 0xff, 0x18, 0x1f, 0x33, 0xff, 0x1e, 0x24, 0x37, 0xff, 0x1e, 0x23, 0x35, 0xff, 0x15, 0x1e, 0x30, 0xff, 0x0f, 0x1c, 0x2f, 0xff, 0x0e, 0x19, 0x2d, 0xff, 0x10, 0x1b, 0x2f, 0xff, 0x10, 0x1b, 0x2f, 0xff, 0x10, 0x1b, 0x2e, 0xff, 0x0f, 0x1c, 0x2f, 0xff, 0x0f, 0x1c, 0x32, 0xff, 0x0f, 0x1c, 0x32, 0xff, 0x0e, 0x1b, 0x32, 0xff, 0x0f, 0x1b, 0x34, 0xff, 0x0e, 0x1a, 0x34, 0xff, 0x0f, 0x1b, 0x35, 0xff, 0x0f, 0x1b, 0x35, 0xff, 0x10, 0x1c, 0x34, 0xff, 0x11, 0x1c, 0x34, 0xff, 0x10, 0x1b, 0x31, 0xff, 0x10, 0x1b, 0x31, 0xff, 0x16, 0x1d, 0x30, 0xff, 0x18, 0x1e, 0x2f, 0xff, 0x14, 0x1d, 0x2f, 0xff, 0x0f, 0x1a, 0x2f, 0xff, 0x0f, 0x1c, 0x33, 0xff, 0x16, 0x22, 0x3a, 0xff, 0x16, 0x23, 0x3b, 0xff, 0x17, 0x24, 0x3c, 0xff, 0x1c, 0x28, 0x40, 0xff, 0x1d, 0x29, 0x40, 0xff, 0x1d, 0x2a, 0x40, 0xff, 0x28, 0x35, 0x4f, 0xff, 0x10, 0x19, 0x2b, 0xff, 0x30, 0x26, 0x20, 0xff, 0x97, 0x8c, 0x8d, 0xff, 0x93, 0x98, 0xa7, 0xff, 0x8c, 0x8c, 0x8a, 0xff, 0x7d, 0x89, 0x8b, 0xff, 0x7d, 0x90, 0x9f, 0xff, 0x78, 0x85, 0x90, 0xff, 0x6b, 0x7e, 0x8c, 0xff, 0x79, 0x8a, 0x93, 0xff, 0x8f, 0x92, 0x90, 0xff, 0xac, 0x9c, 0x8d, 0xff, 0xae, 0x9c, 0x89, 0xff, 0x9e, 0x91, 0x7f, 0xff, 0xa8, 0x9a, 0x89, 0xff, 0xad, 0xa1, 0x8f, 0xff, 0xa8, 0x9d, 0x8f, 0xff, 0xa5, 0x99, 0x8f, 0xff, 0x89, 0x8f, 0x8f, 0xff, 0x6f, 0x81, 0x86, 0xff, 0x89, 0x8f, 0x92, 0xff, 0x9c, 0x9d, 0x9c, 0xff, 0x9c, 0x9c, 0x97, 0xff, 0x95, 0x9c, 0x96, 0xff, 0xa3, 0xa2, 0xa3, 0xff, 0x8d, 0x77, 0x50, 0xff, 0x86, 0x70, 0x09, 0xff, 0xa9, 0x96, 0x71, 0xff, 0x97, 0x98, 0x92, 0xff, 0x9c, 0x91, 0x72, 0xff, 0x80, 0x6a, 0x35, 0xff, 0x7b, 0x6e, 0x3b, 0xff, 0x79, 0x64, 0x48, 0xff, 0x7b, 0x66, 0x39, 0xff, 0x7f, 0x6f, 0x37, 0xff, 0x8e, 0x86, 0x6b, 0xff, 0x97, 0x9a, 0x97, 0xff, 0x84, 0x90, 0x90, 0xff, 0x7e, 0x87, 0x8b, 0xff, 0x8f, 0x8f, 0x8b, 0xff, 0x9d, 0x95, 0x8a, 0xff, 0x8b, 0x8a, 0x87, 0xff, 0x8a, 0x8a, 0x88, 0xff, 0x98, 0x92, 0x88, 0xff, 0x98, 0x92, 0x89, 0xff, 0x94, 0x91, 0x87, 0xe6,
+    0x8a, 0x98, 0x9e, 0xd3, 0x8d, 0x9a, 0x9d, 0xff, 0x8d, 0x9c, 0xa3, 0xff, 0x7d, 0x8d, 0x99, 0xff, 0x71, 0x85, 0x91, 0xff, 0x80, 0x94, 0xa0, 0xff, 0x7a, 0x8c, 0x96, 0xff, 0x7c, 0x8c, 0x91, 0xff, 0x8f, 0x9c, 0xa0, 0xff, 0x94, 0x9f, 0xa2, 0xff, 0x96, 0xa1, 0xa2, 0xff, 0x8e, 0x9c, 0xa5, 0xff, 0x87, 0x99, 0xae, 0xff, 0x86, 0x9a, 0xb2, 0xff, 0x83, 0x94, 0xa7, 0xff, 0x88, 0x96, 0xa1, 0xff, 0x9e, 0xa7, 0xa8, 0xff, 0x9f, 0xa8, 0xa8, 0xff, 0x9a, 0xa5, 0xa8, 0xff, 0x99, 0xa4, 0xa7, 0xff, 0x9c, 0xa6, 0xaa, 0xff, 0x9b, 0xa2, 0xa5, 0xff, 0x94, 0x99, 0x99, 0xff, 0x9e, 0xa2, 0xa0, 0xff, 0xa4, 0xa8, 0xa7, 0xff, 0x9f, 0xa5, 0xa3, 0xff, 0x98, 0xa0, 0xa1, 0xff, 0x97, 0xa2, 0xa4, 0xff, 0x94, 0x9f, 0xa1, 0xff, 0x9a, 0x9f, 0xa1, 0xff, 0xa6, 0xa5, 0x9f, 0xff, 0xa6, 0xa9, 0x97, 0xff, 0xa6, 0xaf, 0xa5, 0xff, 0x88, 0x96, 0xa3, 0xff, 0x3f, 0x49, 0x69, 0xff, 0x37, 0x3c, 0x50, 0xff, 0x1e, 0x20, 0x2b, 0xff, 0x45, 0x4d, 0x6c, 0xff, 0x5d, 0x66, 0x92, 0xff, 0x53, 0x57, 0x7d, 0xff, 0x36, 0x3e, 0x63, 0xff, 0x22, 0x2d, 0x50, 0xff, 0x04, 0x0e, 0x2b, 0xff, 0x01, 0x0d, 0x22, 0xff, 0x03, 0x10, 0x1f, 0xff, 0x04, 0x0f, 0x1e, 0xff, 0x0e, 0x15, 0x25, 0xff, 0x10, 0x16, 0x26, 0xff, 0x11, 0x19, 0x2a, 0xff, 0x16, 0x20, 0x31, 0xff, 0x16, 0x20, 0x34, 0xff, 0x12, 0x1c, 0x31, 0xff, 0x13, 0x1e, 0x33, 0xff, 0x11, 0x1c, 0x30, 0xff, 0x11, 0x1b, 0x2f, 0xff, 0x10, 0x1b, 0x2f, 0xff, 0x0f, 0x1a, 0x2e, 0xff, 0x11, 0x1b, 0x2f, 0xff, 0x0f, 0x1c, 0x31, 0xff, 0x10, 0x1d, 0x33, 0xff, 0x0f, 0x1c, 0x32, 0xff, 0x0f, 0x1c, 0x33, 0xff, 0x12, 0x1d, 0x35, 0xff, 0x11, 0x1d, 0x34, 0xff, 0x0f, 0x1a, 0x31, 0xff, 0x0d, 0x18, 0x30, 0xff, 0x0f, 0x1a, 0x31, 0xff, 0x10, 0x1a, 0x2f, 0xff, 0x0e, 0x18, 0x2d, 0xff, 0x0f, 0x19, 0x2c, 0xff, 0x12, 0x1a, 0x2d, 0xff, 0x12, 0x19, 0x2c, 0xff, 0x0d, 0x17, 0x29, 0xff, 0x0f, 0x19, 0x2e, 0xff, 0x12, 0x1f, 0x36, 0xff, 0x19, 0x25, 0x3d, 0xff, 0x18, 0x25, 0x3d, 0xff, 0x18, 0x25, 0x3d, 0xff, 0x1a, 0x26, 0x3e, 0xff, 0x1b, 0x28, 0x3f, 0xff, 0x1c, 0x29, 0x3f, 0xff, 0x27, 0x33, 0x4a, 0xff, 0x10, 0x1b, 0x31, 0xff, 0x2e, 0x28, 0x27, 0xff, 0x99, 0x8a, 0x82, 0xff, 0x90, 0x8c, 0x8e, 0xff, 0xa1, 0x9b, 0x93, 0xff, 0x6e, 0x78, 0x7d, 0xff, 0x64, 0x7d, 0x9b, 0xff, 0x74, 0x84, 0x9f, 0xff, 0x7f, 0x84, 0x8c, 0xff, 0x87, 0x7d, 0x73, 0xff, 0xab, 0x93, 0x7f, 0xff, 0xc8, 0xa9, 0x8e, 0xff, 0xbf, 0x9e, 0x84, 0xff, 0x9b, 0x79, 0x64, 0xff, 0x91, 0x6f, 0x57, 0xff, 0xbb, 0x9b, 0x83, 0xff, 0xc8, 0xaa, 0x97, 0xff, 0xca, 0xab, 0x9c, 0xff, 0xbe, 0xaa, 0xa3, 0xff, 0x9a, 0x94, 0x94, 0xff, 0x8f, 0x91, 0x8e, 0xff, 0x89, 0x94, 0x91, 0xff, 0x83, 0x8d, 0x8c, 0xff, 0x8e, 0x98, 0x9e, 0xff, 0xa6, 0x99, 0x90, 0xff, 0x85, 0x6e, 0x12, 0xff, 0x8e, 0x74, 0x2e, 0xff, 0xa7, 0x96, 0x7e, 0xff, 0x9a, 0x95, 0x8c, 0xff, 0x97, 0x81, 0x55, 0xff, 0x82, 0x65, 0x23, 0xff, 0x7f, 0x6e, 0x39, 0xff, 0x7e, 0x6d, 0x38, 0xff, 0x83, 0x73, 0x33, 0xff, 0x84, 0x76, 0x3d, 0xff, 0x94, 0x90, 0x80, 0xff, 0x9c, 0x9b, 0x9a, 0xff, 0x96, 0x96, 0x8c, 0xff, 0x82, 0x86, 0x85, 0xff, 0x8f, 0x90, 0x8b, 0xff, 0x9c, 0x99, 0x93, 0xff, 0x77, 0x7e, 0x84, 0xff, 0x70, 0x76, 0x79, 0xff, 0x97, 0x8f, 0x84, 0xff, 0x9a, 0x96, 0x8b, 0xff, 0x98, 0x94, 0x8a, 0xd3,
+    0x93, 0x9e, 0xa3, 0xbe, 0x94, 0x9e, 0xa2, 0xff, 0x93, 0x9f, 0xa5, 0xff, 0x8a, 0x99, 0xa4, 0xff, 0x80, 0x95, 0xa3, 0xff, 0x85, 0x9a, 0xa6, 0xff, 0x79, 0x8b, 0x95, 0xff, 0x7e, 0x8c, 0x92, 0xff, 0x93, 0x9c, 0xa0, 0xff, 0x97, 0x9e, 0xa0, 0xff, 0x9b, 0xa3, 0xa1, 0xff, 0x8f, 0x9d, 0xa4, 0xff, 0x7d, 0x93, 0xaa, 0xff, 0x7d, 0x94, 0xb1, 0xff, 0x7e, 0x92, 0xa6, 0xff, 0x86, 0x93, 0x9e, 0xff, 0x9c, 0xa5, 0xa4, 0xff, 0x9a, 0xa5, 0xa3, 0xff, 0x93, 0x9f, 0xa4, 0xff, 0x96, 0xa3, 0xa9, 0xff, 0x98, 0xa4, 0xa8, 0xff, 0x9b, 0xa5, 0xa8, 0xff, 0x9b, 0xa1, 0xa3, 0xff, 0x9e, 0xa3, 0xa5, 0xff, 0xa0, 0xa7, 0xa7, 0xff, 0x98, 0x9f, 0x9d, 0xff, 0x9a, 0xa0, 0x9c, 0xff, 0xa0, 0xa6, 0x9f, 0xff, 0x9e, 0xa7, 0xa5, 0xff, 0x9a, 0xa1, 0xa5, 0xff, 0x9d, 0xa1, 0xa2, 0xff, 0x9e, 0xa9, 0xa3, 0xff, 0x8f, 0xa3, 0xa5, 0xff, 0x7f, 0x99, 0xae, 0xff, 0x63, 0x75, 0x8f, 0xff, 0x3b, 0x40, 0x56, 0xff, 0x5a, 0x5d, 0x72, 0xff, 0x4b, 0x53, 0x6e, 0xff, 0x29, 0x35, 0x56, 0xff, 0x19, 0x25, 0x44, 0xff, 0x04, 0x09, 0x25, 0xff, 0x0f, 0x11, 0x2e, 0xff, 0x1d, 0x1f, 0x39, 0xff, 0x1b, 0x1c, 0x30, 0xff, 0x06, 0x07, 0x19, 0xff, 0x04, 0x03, 0x11, 0xff, 0x08, 0x0d, 0x1a, 0xff, 0x0f, 0x17, 0x26, 0xff, 0x13, 0x1c, 0x2d, 0xff, 0x15, 0x20, 0x32, 0xff, 0x13, 0x1f, 0x33, 0xff, 0x10, 0x1e, 0x34, 0xff, 0x10, 0x1e, 0x32, 0xff, 0x10, 0x1d, 0x2f, 0xff, 0x11, 0x1e, 0x31, 0xff, 0x12, 0x1f, 0x32, 0xff, 0x0e, 0x1c, 0x2f, 0xff, 0x11, 0x1e, 0x31, 0xff, 0x13, 0x20, 0x35, 0xff, 0x11, 0x1e, 0x35, 0xff, 0x10, 0x1c, 0x33, 0xff, 0x13, 0x1e, 0x34, 0xff, 0x13, 0x1e, 0x33, 0xff, 0x13, 0x1c, 0x30, 0xff, 0x10, 0x1b, 0x2f, 0xff, 0x0c, 0x18, 0x2c, 0xff, 0x0b, 0x15, 0x29, 0xff, 0x0c, 0x15, 0x28, 0xff, 0x0d, 0x14, 0x27, 0xff, 0x0e, 0x16, 0x27, 0xff, 0x0f, 0x16, 0x29, 0xff, 0x0d, 0x14, 0x27, 0xff, 0x0c, 0x15, 0x27, 0xff, 0x11, 0x1b, 0x30, 0xff, 0x13, 0x20, 0x37, 0xff, 0x16, 0x22, 0x3a, 0xff, 0x1a, 0x26, 0x3f, 0xff, 0x17, 0x24, 0x3c, 0xff, 0x18, 0x23, 0x3b, 0xff, 0x19, 0x26, 0x3d, 0xff, 0x1b, 0x28, 0x3e, 0xff, 0x25, 0x31, 0x47, 0xff, 0x11, 0x1c, 0x35, 0xff, 0x32, 0x2b, 0x2d, 0xff, 0x9c, 0x8c, 0x80, 0xff, 0x8e, 0x86, 0x83, 0xff, 0xa7, 0x9a, 0x8d, 0xff, 0x91, 0x95, 0x9a, 0xff, 0x66, 0x73, 0x89, 0xff, 0x6b, 0x6a, 0x71, 0xff, 0x58, 0x48, 0x40, 0xff, 0x39, 0x1d, 0x07, 0xff, 0x88, 0x67, 0x50, 0xff, 0xbe, 0xa1, 0x8f, 0xff, 0xac, 0x8a, 0x74, 0xff, 0xb8, 0x91, 0x73, 0xff, 0x9e, 0x79, 0x5b, 0xff, 0xa2, 0x7c, 0x60, 0xff, 0xb7, 0x96, 0x7c, 0xff, 0xcb, 0xae, 0x99, 0xff, 0xdd, 0xbb, 0xa9, 0xff, 0xdc, 0xbc, 0xaa, 0xff, 0xce, 0xc1, 0xae, 0xff, 0xb7, 0xb6, 0xa7, 0xff, 0x9e, 0xa0, 0x93, 0xff, 0x9c, 0x9b, 0x9b, 0xff, 0x8d, 0x76, 0x5d, 0xff, 0x75, 0x61, 0x00, 0xff, 0x9e, 0x88, 0x4f, 0xff, 0xa3, 0x95, 0x82, 0xff, 0x9a, 0x93, 0x75, 0xff, 0x90, 0x77, 0x30, 0xff, 0x91, 0x6e, 0x1a, 0xff, 0x8c, 0x71, 0x2b, 0xff, 0x8a, 0x74, 0x23, 0xff, 0x90, 0x78, 0x26, 0xff, 0x91, 0x7c, 0x42, 0xff, 0x9b, 0x93, 0x86, 0xff, 0x99, 0x96, 0x94, 0xff, 0x93, 0x8f, 0x85, 0xff, 0x89, 0x89, 0x87, 0xff, 0x90, 0x91, 0x8b, 0xff, 0x98, 0x99, 0x93, 0xff, 0x86, 0x90, 0x99, 0xff, 0x80, 0x88, 0x8c, 0xff, 0x95, 0x90, 0x82, 0xff, 0x9a, 0x97, 0x8b, 0xff, 0x9b, 0x99, 0x8f, 0xbe,
+    0x90, 0x9c, 0xa3, 0xaa, 0x95, 0xa0, 0xa5, 0xff, 0x91, 0x9e, 0xa7, 0xff, 0x88, 0x97, 0xa5, 0xff, 0x80, 0x95, 0xa8, 0xff, 0x81, 0x98, 0xa8, 0xff, 0x82, 0x92, 0x9d, 0xff, 0x89, 0x96, 0x9c, 0xff, 0x92, 0x99, 0x99, 0xff, 0x94, 0x98, 0x93, 0xff, 0x94, 0x9f, 0x9f, 0xff, 0x93, 0xa3, 0xab, 0xff, 0x8a, 0x9b, 0xab, 0xff, 0x86, 0x98, 0xad, 0xff, 0x76, 0x8a, 0x9d, 0xff, 0x70, 0x84, 0x95, 0xff, 0x87, 0x99, 0x9f, 0xff, 0x7c, 0x8f, 0x94, 0xff, 0x7f, 0x90, 0x9e, 0xff, 0x8d, 0x9e, 0xac, 0xff, 0x91, 0xa0, 0xaa, 0xff, 0x8e, 0x9a, 0x9f, 0xff, 0x86, 0x94, 0x99, 0xff, 0x89, 0x97, 0x9f, 0xff, 0x89, 0x97, 0xa0, 0xff, 0x8b, 0x9a, 0x9e, 0xff, 0x95, 0x9e, 0xa0, 0xff, 0x9e, 0xa5, 0xa1, 0xff, 0x99, 0xa7, 0xa8, 0xff, 0x93, 0x9f, 0xaa, 0xff, 0x90, 0x99, 0xa4, 0xff, 0x87, 0x97, 0x9d, 0xff, 0x78, 0x8f, 0x9a, 0xff, 0x69, 0x85, 0xa0, 0xff, 0x7d, 0x97, 0xac, 0xff, 0x4b, 0x57, 0x6c, 0xff, 0x43, 0x44, 0x60, 0xff, 0x54, 0x5a, 0x75, 0xff, 0x2d, 0x39, 0x55, 0xff, 0x28, 0x30, 0x51, 0xff, 0x47, 0x46, 0x65, 0xff, 0x6c, 0x6a, 0x88, 0xff, 0x76, 0x74, 0x94, 0xff, 0x73, 0x71, 0x8e, 0xff, 0x5d, 0x5a, 0x75, 0xff, 0x38, 0x35, 0x4a, 0xff, 0x14, 0x1a, 0x2f, 0xff, 0x05, 0x10, 0x24, 0xff, 0x0d, 0x16, 0x2a, 0xff, 0x15, 0x1f, 0x34, 0xff, 0x15, 0x20, 0x36, 0xff, 0x14, 0x1e, 0x36, 0xff, 0x11, 0x1e, 0x32, 0xff, 0x10, 0x1f, 0x31, 0xff, 0x10, 0x1e, 0x31, 0xff, 0x13, 0x22, 0x35, 0xff, 0x13, 0x22, 0x35, 0xff, 0x13, 0x22, 0x34, 0xff, 0x13, 0x21, 0x36, 0xff, 0x11, 0x1f, 0x35, 0xff, 0x11, 0x1d, 0x33, 0xff, 0x13, 0x1d, 0x32, 0xff, 0x12, 0x1a, 0x2e, 0xff, 0x10, 0x17, 0x2a, 0xff, 0x0d, 0x16, 0x28, 0xff, 0x0c, 0x17, 0x28, 0xff, 0x0c, 0x15, 0x26, 0xff, 0x0b, 0x13, 0x23, 0xff, 0x0b, 0x12, 0x22, 0xff, 0x0c, 0x13, 0x21, 0xff, 0x0b, 0x12, 0x23, 0xff, 0x0d, 0x14, 0x27, 0xff, 0x0f, 0x18, 0x2b, 0xff, 0x10, 0x1a, 0x2f, 0xff, 0x0f, 0x1c, 0x32, 0xff, 0x13, 0x1f, 0x37, 0xff, 0x17, 0x24, 0x3c, 0xff, 0x15, 0x22, 0x3a, 0xff, 0x17, 0x23, 0x3c, 0xff, 0x17, 0x23, 0x3a, 0xff, 0x1b, 0x28, 0x3e, 0xff, 0x23, 0x30, 0x46, 0xff, 0x14, 0x1d, 0x34, 0xff, 0x39, 0x2f, 0x32, 0xff, 0x94, 0x89, 0x83, 0xff, 0x8f, 0x8b, 0x8b, 0xff, 0x9b, 0x8b, 0x7c, 0xff, 0xad, 0xa2, 0x9e, 0xff, 0x97, 0x91, 0x91, 0xff, 0x4b, 0x39, 0x2a, 0xff, 0x2d, 0x13, 0x00, 0xff, 0x42, 0x21, 0x0a, 0xff, 0x7c, 0x5b, 0x45, 0xff, 0xaa, 0x90, 0x82, 0xff, 0x9a, 0x7d, 0x67, 0xff, 0xba, 0x96, 0x75, 0xff, 0xb5, 0x91, 0x73, 0xff, 0xad, 0x8b, 0x6d, 0xff, 0xc2, 0xa3, 0x89, 0xff, 0xbf, 0xa5, 0x91, 0xff, 0xab, 0x88, 0x72, 0xff, 0xb0, 0x85, 0x6b, 0xff, 0xc9, 0xaa, 0x91, 0xff, 0xdd, 0xc5, 0xb0, 0xff, 0xdc, 0xc9, 0xb7, 0xff, 0xcf, 0xc0, 0xb5, 0xff, 0xb0, 0x98, 0x7a, 0xff, 0x8d, 0x7a, 0x2d, 0xff, 0x96, 0x85, 0x5b, 0xff, 0x9d, 0x8d, 0x7c, 0xff, 0x96, 0x8d, 0x58, 0xff, 0x89, 0x72, 0x19, 0xff, 0x94, 0x71, 0x1a, 0xff, 0x8d, 0x70, 0x1a, 0xff, 0x8e, 0x76, 0x18, 0xff, 0x95, 0x77, 0x28, 0xff, 0x9f, 0x82, 0x55, 0xff, 0x9f, 0x99, 0x8f, 0xff, 0x93, 0x95, 0x93, 0xff, 0x8d, 0x8d, 0x88, 0xff, 0x8f, 0x92, 0x93, 0xff, 0x95, 0x96, 0x91, 0xff, 0x99, 0x97, 0x8f, 0xff, 0x8f, 0x97, 0x99, 0xff, 0x85, 0x8d, 0x8d, 0xff, 0x8f, 0x8b, 0x7f, 0xff, 0x9c, 0x98, 0x8c, 0xff, 0x9b, 0x99, 0x90, 0xab,
+    0x8b, 0x98, 0xa1, 0x8b, 0x91, 0x9c, 0xa5, 0xff, 0x8e, 0x9c, 0xa7, 0xff, 0x7f, 0x90, 0x9f, 0xff, 0x73, 0x8a, 0xa3, 0xff, 0x7b, 0x90, 0xa7, 0xff, 0x83, 0x92, 0xa1, 0xff, 0x8d, 0x99, 0x9d, 0xff, 0x92, 0x99, 0x93, 0xff, 0x93, 0x96, 0x8b, 0xff, 0x89, 0x9a, 0x9c, 0xff, 0x93, 0xa5, 0xad, 0xff, 0x9c, 0xa8, 0xae, 0xff, 0x8f, 0x9c, 0xa6, 0xff, 0x71, 0x85, 0x96, 0xff, 0x6b, 0x87, 0x9f, 0xff, 0x77, 0x92, 0xa3, 0xff, 0x69, 0x83, 0x93, 0xff, 0x70, 0x88, 0x9f, 0xff, 0x7d, 0x93, 0xaa, 0xff, 0x91, 0xa2, 0xb2, 0xff, 0x88, 0x97, 0x9d, 0xff, 0x6d, 0x85, 0x8f, 0xff, 0x76, 0x90, 0xa0, 0xff, 0x76, 0x8e, 0x9d, 0xff, 0x7e, 0x93, 0xa1, 0xff, 0x8d, 0x9a, 0xa5, 0xff, 0x99, 0xa1, 0xa8, 0xff, 0x8e, 0x9c, 0x9f, 0xff, 0x80, 0x8e, 0x98, 0xff, 0x8e, 0x97, 0xa5, 0xff, 0x87, 0x95, 0x9c, 0xff, 0x78, 0x8a, 0x92, 0xff, 0x73, 0x86, 0x9b, 0xff, 0x73, 0x95, 0xa2, 0xff, 0x71, 0x88, 0x99, 0xff, 0x5a, 0x5a, 0x7a, 0xff, 0x7b, 0x7d, 0x9a, 0xff, 0x77, 0x7e, 0x9a, 0xff, 0x82, 0x82, 0xa8, 0xff, 0x92, 0x90, 0xb6, 0xff, 0x83, 0x84, 0xa8, 0xff, 0x6a, 0x6c, 0x92, 0xff, 0x5a, 0x5d, 0x83, 0xff, 0x53, 0x58, 0x7a, 0xff, 0x51, 0x59, 0x75, 0xff, 0x45, 0x51, 0x6b, 0xff, 0x30, 0x3b, 0x54, 0xff, 0x1c, 0x25, 0x3f, 0xff, 0x12, 0x1b, 0x32, 0xff, 0x12, 0x19, 0x2f, 0xff, 0x17, 0x1c, 0x33, 0xff, 0x12, 0x1d, 0x31, 0xff, 0x0e, 0x1d, 0x30, 0xff, 0x12, 0x20, 0x33, 0xff, 0x14, 0x22, 0x34, 0xff, 0x17, 0x25, 0x37, 0xff, 0x14, 0x23, 0x35, 0xff, 0x10, 0x1f, 0x34, 0xff, 0x12, 0x20, 0x37, 0xff, 0x0f, 0x1c, 0x31, 0xff, 0x10, 0x1a, 0x2d, 0xff, 0x12, 0x19, 0x2c, 0xff, 0x0d, 0x13, 0x26, 0xff, 0x0a, 0x12, 0x23, 0xff, 0x0b, 0x13, 0x24, 0xff, 0x0a, 0x12, 0x22, 0xff, 0x09, 0x10, 0x1f, 0xff, 0x09, 0x10, 0x1e, 0xff, 0x0b, 0x13, 0x1f, 0xff, 0x0d, 0x14, 0x24, 0xff, 0x10, 0x17, 0x2a, 0xff, 0x11, 0x1a, 0x2c, 0xff, 0x10, 0x1a, 0x2f, 0xff, 0x0d, 0x1a, 0x30, 0xff, 0x10, 0x1c, 0x34, 0xff, 0x13, 0x20, 0x38, 0xff, 0x17, 0x24, 0x3c, 0xff, 0x17, 0x23, 0x3b, 0xff, 0x17, 0x24, 0x3b, 0xff, 0x1c, 0x29, 0x3e, 0xff, 0x21, 0x2e, 0x45, 0xff, 0x13, 0x19, 0x2e, 0xff, 0x43, 0x38, 0x39, 0xff, 0x8d, 0x88, 0x89, 0xff, 0x82, 0x87, 0x90, 0xff, 0x9e, 0x8b, 0x7b, 0xff, 0xa9, 0x8b, 0x79, 0xff, 0xba, 0xaa, 0x9d, 0xff, 0xb5, 0xa6, 0x93, 0xff, 0xa8, 0x91, 0x80, 0xff, 0x90, 0x71, 0x5e, 0xff, 0x6c, 0x4b, 0x32, 0xff, 0xa4, 0x82, 0x62, 0xff, 0x9f, 0x7b, 0x5d, 0xff, 0xba, 0x93, 0x7a, 0xff, 0xbd, 0x96, 0x7c, 0xff, 0xc1, 0x9b, 0x80, 0xff, 0xc0, 0x9e, 0x86, 0xff, 0xa5, 0x85, 0x75, 0xff, 0x91, 0x73, 0x61, 0xff, 0x97, 0x77, 0x60, 0xff, 0xa8, 0x83, 0x70, 0xff, 0xcc, 0xa4, 0x95, 0xff, 0xde, 0xbd, 0xb0, 0xff, 0xd6, 0xc2, 0xb4, 0xff, 0xdd, 0xcb, 0xb7, 0xff, 0xdb, 0xc1, 0xb8, 0xff, 0xc2, 0xb3, 0x9d, 0xff, 0xb4, 0x9f, 0x97, 0xff, 0x8f, 0x81, 0x43, 0xff, 0x78, 0x60, 0x04, 0xff, 0x87, 0x64, 0x17, 0xff, 0x87, 0x72, 0x14, 0xff, 0x8f, 0x7b, 0x21, 0xff, 0x95, 0x78, 0x3c, 0xff, 0xa0, 0x86, 0x6e, 0xff, 0x91, 0x95, 0x94, 0xff, 0x84, 0x91, 0x92, 0xff, 0x85, 0x87, 0x8b, 0xff, 0x7d, 0x84, 0x8b, 0xff, 0x90, 0x91, 0x8e, 0xff, 0x9d, 0x99, 0x8b, 0xff, 0x96, 0x98, 0x91, 0xff, 0x8b, 0x92, 0x8d, 0xff, 0x94, 0x91, 0x84, 0xff, 0x9d, 0x98, 0x8c, 0xff, 0x9a, 0x98, 0x8d, 0x8b,
+    0x8a, 0x96, 0x9d, 0x6b, 0x90, 0x9c, 0xa1, 0xff, 0x89, 0x9a, 0xa4, 0xff, 0x7b, 0x90, 0x9e, 0xff, 0x73, 0x88, 0x9f, 0xff, 0x77, 0x8c, 0xa5, 0xff, 0x7d, 0x8d, 0x9f, 0xff, 0x8b, 0x95, 0x99, 0xff, 0x92, 0x99, 0x95, 0xff, 0x8a, 0x96, 0x93, 0xff, 0x7b, 0x93, 0xa1, 0xff, 0x8a, 0xa0, 0xb0, 0xff, 0x9c, 0xa9, 0xb2, 0xff, 0x96, 0xa2, 0xa9, 0xff, 0x8a, 0x9a, 0xa5, 0xff, 0x88, 0x9c, 0xad, 0xff, 0x84, 0x9b, 0xac, 0xff, 0x85, 0x9c, 0xae, 0xff, 0x81, 0x98, 0xac, 0xff, 0x79, 0x8e, 0xa0, 0xff, 0x90, 0x9f, 0xaa, 0xff, 0x9a, 0xa5, 0xa9, 0xff, 0x8b, 0x9c, 0x9a, 0xff, 0x86, 0x9c, 0xa3, 0xff, 0x79, 0x91, 0xa7, 0xff, 0x6c, 0x84, 0x9f, 0xff, 0x7a, 0x8d, 0x9e, 0xff, 0x93, 0xa2, 0xa6, 0xff, 0x8a, 0x97, 0x99, 0xff, 0x82, 0x8d, 0x92, 0xff, 0xa0, 0xa6, 0xaa, 0xff, 0xa8, 0xae, 0xae, 0xff, 0xa2, 0xaa, 0xae, 0xff, 0x97, 0xa1, 0xa8, 0xff, 0x86, 0x94, 0xa8, 0xff, 0x8b, 0x92, 0xb0, 0xff, 0x8b, 0x8c, 0xae, 0xff, 0x77, 0x7d, 0x9e, 0xff, 0x66, 0x6f, 0x8f, 0xff, 0x5d, 0x64, 0x8a, 0xff, 0x54, 0x5c, 0x82, 0xff, 0x46, 0x4f, 0x75, 0xff, 0x36, 0x41, 0x65, 0xff, 0x1d, 0x2b, 0x4f, 0xff, 0x12, 0x21, 0x42, 0xff, 0x18, 0x2a, 0x48, 0xff, 0x2c, 0x3b, 0x57, 0xff, 0x3c, 0x4a, 0x69, 0xff, 0x37, 0x48, 0x6a, 0xff, 0x24, 0x36, 0x56, 0xff, 0x15, 0x21, 0x3b, 0xff, 0x11, 0x17, 0x2a, 0xff, 0x0e, 0x17, 0x2b, 0xff, 0x0e, 0x1b, 0x2e, 0xff, 0x14, 0x21, 0x33, 0xff, 0x14, 0x1f, 0x38, 0xff, 0x12, 0x1e, 0x38, 0xff, 0x10, 0x1f, 0x32, 0xff, 0x10, 0x1d, 0x30, 0xff, 0x11, 0x1c, 0x31, 0xff, 0x10, 0x1a, 0x2e, 0xff, 0x0e, 0x16, 0x29, 0xff, 0x0d, 0x14, 0x25, 0xff, 0x0a, 0x11, 0x21, 0xff, 0x09, 0x10, 0x1f, 0xff, 0x07, 0x0e, 0x1e, 0xff, 0x07, 0x0e, 0x1c, 0xff, 0x07, 0x0f, 0x1e, 0xff, 0x09, 0x11, 0x21, 0xff, 0x0c, 0x14, 0x23, 0xff, 0x0e, 0x16, 0x28, 0xff, 0x0e, 0x17, 0x2b, 0xff, 0x0e, 0x19, 0x2c, 0xff, 0x0f, 0x1a, 0x2f, 0xff, 0x0d, 0x19, 0x30, 0xff, 0x0d, 0x19, 0x30, 0xff, 0x0e, 0x1e, 0x35, 0xff, 0x15, 0x25, 0x3c, 0xff, 0x17, 0x24, 0x3b, 0xff, 0x18, 0x25, 0x3b, 0xff, 0x1b, 0x28, 0x3f, 0xff, 0x1e, 0x2b, 0x48, 0xff, 0x11, 0x16, 0x29, 0xff, 0x46, 0x42, 0x47, 0xff, 0x84, 0x81, 0x87, 0xff, 0x87, 0x85, 0x8a, 0xff, 0x9f, 0x92, 0x8b, 0xff, 0x9e, 0x85, 0x7a, 0xff, 0x9d, 0x8c, 0x82, 0xff, 0xbb, 0xae, 0xa5, 0xff, 0xd1, 0xc2, 0xb8, 0xff, 0xc3, 0xaf, 0xa2, 0xff, 0x74, 0x59, 0x43, 0xff, 0x88, 0x69, 0x4b, 0xff, 0xa5, 0x7e, 0x5e, 0xff, 0xbb, 0x91, 0x72, 0xff, 0xc0, 0x99, 0x7c, 0xff, 0xc4, 0x9f, 0x84, 0xff, 0xac, 0x89, 0x72, 0xff, 0x99, 0x76, 0x64, 0xff, 0xa0, 0x81, 0x6e, 0xff, 0x9c, 0x7e, 0x6b, 0xff, 0x99, 0x71, 0x63, 0xff, 0xb6, 0x8c, 0x7a, 0xff, 0xd4, 0xb3, 0x9d, 0xff, 0xd4, 0xbb, 0xaf, 0xff, 0xcd, 0xb7, 0xad, 0xff, 0xd2, 0xb7, 0xb3, 0xff, 0xdf, 0xc8, 0xbb, 0xff, 0xdc, 0xc3, 0xb7, 0xff, 0xcf, 0xb6, 0x98, 0xff, 0xaf, 0x99, 0x72, 0xff, 0x94, 0x7a, 0x42, 0xff, 0x82, 0x69, 0x0e, 0xff, 0x89, 0x71, 0x19, 0xff, 0x95, 0x7c, 0x3d, 0xff, 0x98, 0x88, 0x73, 0xff, 0x81, 0x85, 0x92, 0xff, 0x78, 0x84, 0x90, 0xff, 0x81, 0x87, 0x85, 0xff, 0x7f, 0x85, 0x85, 0xff, 0x91, 0x94, 0x8f, 0xff, 0x97, 0x95, 0x8e, 0xff, 0x99, 0x98, 0x91, 0xff, 0x94, 0x98, 0x93, 0xff, 0x93, 0x93, 0x8d, 0xff, 0x97, 0x93, 0x87, 0xff, 0x96, 0x96, 0x91, 0x6b,
+    0x8e, 0x9c, 0x9c, 0x4b, 0x91, 0x9c, 0x9f, 0xff, 0x86, 0x96, 0x9e, 0xff, 0x7e, 0x93, 0xa1, 0xff, 0x7e, 0x91, 0xa2, 0xff, 0x7d, 0x92, 0xa5, 0xff, 0x7b, 0x8c, 0x9e, 0xff, 0x8b, 0x93, 0x97, 0xff, 0x92, 0x9a, 0x96, 0xff, 0x84, 0x94, 0x96, 0xff, 0x78, 0x8e, 0x9d, 0xff, 0x89, 0x9d, 0xac, 0xff, 0x9a, 0xa9, 0xb2, 0xff, 0x99, 0xa6, 0xad, 0xff, 0x98, 0xa6, 0xaf, 0xff, 0x90, 0x9f, 0xaa, 0xff, 0x82, 0x93, 0x9f, 0xff, 0x88, 0x9a, 0xa9, 0xff, 0x8e, 0xa2, 0xaf, 0xff, 0x88, 0x99, 0xa3, 0xff, 0x8f, 0x9a, 0xa0, 0xff, 0xa0, 0xa7, 0xa9, 0xff, 0xa1, 0xa9, 0xa6, 0xff, 0x94, 0xa3, 0xa5, 0xff, 0x81, 0x97, 0xa8, 0xff, 0x72, 0x89, 0x9e, 0xff, 0x78, 0x8d, 0x9d, 0xff, 0x96, 0xa4, 0xac, 0xff, 0x99, 0xa4, 0xaa, 0xff, 0x96, 0x9e, 0xa6, 0xff, 0xa2, 0xa6, 0xae, 0xff, 0xa0, 0xa2, 0xb1, 0xff, 0x91, 0x94, 0xad, 0xff, 0x83, 0x86, 0xa4, 0xff, 0x7e, 0x80, 0xa5, 0xff, 0x6a, 0x6e, 0x94, 0xff, 0x49, 0x52, 0x77, 0xff, 0x3d, 0x4c, 0x72, 0xff, 0x32, 0x44, 0x6b, 0xff, 0x2c, 0x40, 0x66, 0xff, 0x22, 0x35, 0x5c, 0xff, 0x16, 0x28, 0x50, 0xff, 0x10, 0x24, 0x4a, 0xff, 0x0d, 0x22, 0x45, 0xff, 0x0c, 0x20, 0x42, 0xff, 0x0f, 0x24, 0x46, 0xff, 0x17, 0x29, 0x49, 0xff, 0x1e, 0x2f, 0x51, 0xff, 0x21, 0x38, 0x5e, 0xff, 0x2b, 0x43, 0x6a, 0xff, 0x2f, 0x41, 0x5f, 0xff, 0x16, 0x22, 0x39, 0xff, 0x09, 0x13, 0x27, 0xff, 0x0f, 0x1a, 0x2c, 0xff, 0x13, 0x1e, 0x30, 0xff, 0x15, 0x1e, 0x39, 0xff, 0x13, 0x1b, 0x38, 0xff, 0x11, 0x1e, 0x31, 0xff, 0x10, 0x1b, 0x2d, 0xff, 0x0e, 0x16, 0x2a, 0xff, 0x0d, 0x14, 0x26, 0xff, 0x0b, 0x13, 0x24, 0xff, 0x0a, 0x12, 0x22, 0xff, 0x0a, 0x11, 0x1f, 0xff, 0x08, 0x0f, 0x1d, 0xff, 0x09, 0x0e, 0x1d, 0xff, 0x09, 0x11, 0x1f, 0xff, 0x09, 0x11, 0x22, 0xff, 0x0b, 0x12, 0x24, 0xff, 0x0b, 0x14, 0x26, 0xff, 0x09, 0x14, 0x26, 0xff, 0x0e, 0x17, 0x2b, 0xff, 0x0d, 0x17, 0x2c, 0xff, 0x0c, 0x17, 0x2c, 0xff, 0x0e, 0x19, 0x2f, 0xff, 0x0e, 0x1a, 0x30, 0xff, 0x0e, 0x1e, 0x34, 0xff, 0x10, 0x1f, 0x35, 0xff, 0x17, 0x24, 0x3a, 0xff, 0x1a, 0x27, 0x3c, 0xff, 0x18, 0x25, 0x3d, 0xff, 0x1a, 0x2a, 0x46, 0xff, 0x10, 0x14, 0x24, 0xff, 0x55, 0x50, 0x56, 0xff, 0x89, 0x86, 0x8a, 0xff, 0x88, 0x82, 0x7f, 0xff, 0x96, 0x8a, 0x88, 0xff, 0x9d, 0x8b, 0x86, 0xff, 0x9e, 0x8c, 0x84, 0xff, 0x9e, 0x90, 0x87, 0xff, 0xa1, 0x93, 0x8a, 0xff, 0xb9, 0xa9, 0x9d, 0xff, 0xc3, 0xae, 0x9e, 0xff, 0x8f, 0x77, 0x64, 0xff, 0x8f, 0x6e, 0x51, 0xff, 0xbb, 0x94, 0x71, 0xff, 0xc2, 0x9d, 0x80, 0xff, 0xb8, 0x96, 0x7c, 0xff, 0xa4, 0x83, 0x6d, 0xff, 0xa2, 0x82, 0x6f, 0xff, 0xa1, 0x83, 0x6c, 0xff, 0x9d, 0x7d, 0x68, 0xff, 0x8c, 0x63, 0x55, 0xff, 0xad, 0x85, 0x6f, 0xff, 0xd5, 0xb6, 0x9b, 0xff, 0xd2, 0xb8, 0xab, 0xff, 0xd0, 0xb6, 0xac, 0xff, 0xcf, 0xb5, 0xa3, 0xff, 0xcf, 0xb4, 0xa7, 0xff, 0xd4, 0xb8, 0xa9, 0xff, 0xdd, 0xc3, 0xb6, 0xff, 0xe7, 0xd1, 0xc4, 0xff, 0xe3, 0xcb, 0xb1, 0xff, 0xc7, 0xa8, 0x7a, 0xff, 0x9d, 0x83, 0x46, 0xff, 0x8c, 0x78, 0x42, 0xff, 0x93, 0x8b, 0x74, 0xff, 0x89, 0x91, 0x97, 0xff, 0x81, 0x8b, 0x92, 0xff, 0x8e, 0x8d, 0x8a, 0xff, 0x93, 0x93, 0x8f, 0xff, 0x92, 0x92, 0x8d, 0xff, 0x91, 0x8f, 0x8c, 0xff, 0x9e, 0x98, 0x93, 0xff, 0x99, 0x98, 0x96, 0xff, 0x92, 0x92, 0x90, 0xff, 0x98, 0x92, 0x87, 0xff, 0x8e, 0x8e, 0x8e, 0x4b,
+    0x92, 0x9a, 0xa2, 0x21, 0x8f, 0x9c, 0xa1, 0xff, 0x83, 0x93, 0x9b, 0xff, 0x7d, 0x8e, 0x9d, 0xff, 0x87, 0x97, 0xa2, 0xff, 0x88, 0x99, 0xa7, 0xff, 0x85, 0x95, 0xa3, 0xff, 0x8d, 0x93, 0x95, 0xff, 0x95, 0x9b, 0x96, 0xff, 0x8c, 0x99, 0x97, 0xff, 0x87, 0x96, 0x9a, 0xff, 0x94, 0xa2, 0xa6, 0xff, 0x9b, 0xa7, 0xac, 0xff, 0x96, 0xa4, 0xaa, 0xff, 0x94, 0xa3, 0xae, 0xff, 0x8e, 0x9f, 0xad, 0xff, 0x85, 0x95, 0x9e, 0xff, 0x8a, 0x99, 0xa3, 0xff, 0x94, 0xa4, 0xad, 0xff, 0x97, 0xa4, 0xab, 0xff, 0x98, 0xa0, 0xa5, 0xff, 0x9b, 0xa2, 0xa2, 0xff, 0x99, 0x9f, 0xa5, 0xff, 0x95, 0xa1, 0xa8, 0xff, 0x8e, 0xa2, 0xa8, 0xff, 0x8a, 0xa1, 0xaa, 0xff, 0x85, 0x94, 0xa5, 0xff, 0x95, 0x9b, 0xb3, 0xff, 0x94, 0x9a, 0xb0, 0xff, 0x89, 0x90, 0xa6, 0xff, 0x84, 0x88, 0xa5, 0xff, 0x72, 0x75, 0x9a, 0xff, 0x62, 0x65, 0x94, 0xff, 0x56, 0x59, 0x91, 0xff, 0x4b, 0x56, 0x7f, 0xff, 0x31, 0x40, 0x61, 0xff, 0x1b, 0x2c, 0x4f, 0xff, 0x1f, 0x32, 0x56, 0xff, 0x18, 0x2d, 0x51, 0xff, 0x12, 0x29, 0x4d, 0xff, 0x0c, 0x26, 0x4b, 0xff, 0x07, 0x20, 0x44, 0xff, 0x0c, 0x22, 0x46, 0xff, 0x11, 0x26, 0x48, 0xff, 0x13, 0x26, 0x48, 0xff, 0x0d, 0x1f, 0x3e, 0xff, 0x0f, 0x21, 0x42, 0xff, 0x19, 0x2e, 0x52, 0xff, 0x18, 0x2f, 0x55, 0xff, 0x1a, 0x31, 0x57, 0xff, 0x24, 0x39, 0x5b, 0xff, 0x27, 0x36, 0x56, 0xff, 0x0d, 0x1b, 0x2e, 0xff, 0x00, 0x0c, 0x1b, 0xff, 0x10, 0x1b, 0x31, 0xff, 0x16, 0x1f, 0x36, 0xff, 0x13, 0x1b, 0x30, 0xff, 0x12, 0x19, 0x2d, 0xff, 0x0e, 0x16, 0x29, 0xff, 0x0b, 0x13, 0x25, 0xff, 0x09, 0x11, 0x22, 0xff, 0x09, 0x11, 0x22, 0xff, 0x09, 0x10, 0x22, 0xff, 0x08, 0x0f, 0x20, 0xff, 0x09, 0x0f, 0x1e, 0xff, 0x08, 0x10, 0x1e, 0xff, 0x08, 0x11, 0x21, 0xff, 0x0b, 0x12, 0x24, 0xff, 0x0a, 0x13, 0x24, 0xff, 0x09, 0x14, 0x26, 0xff, 0x0b, 0x15, 0x26, 0xff, 0x0c, 0x16, 0x28, 0xff, 0x0c, 0x15, 0x29, 0xff, 0x0c, 0x16, 0x2a, 0xff, 0x0d, 0x19, 0x2d, 0xff, 0x0e, 0x19, 0x2f, 0xff, 0x13, 0x1d, 0x34, 0xff, 0x13, 0x1f, 0x35, 0xff, 0x14, 0x21, 0x38, 0xff, 0x17, 0x24, 0x3b, 0xff, 0x19, 0x27, 0x3d, 0xff, 0x16, 0x29, 0x40, 0xff, 0x0f, 0x14, 0x1f, 0xff, 0x63, 0x59, 0x5b, 0xff, 0x8b, 0x86, 0x87, 0xff, 0x87, 0x80, 0x7c, 0xff, 0x95, 0x87, 0x80, 0xff, 0xa3, 0x8e, 0x87, 0xff, 0xa1, 0x8e, 0x83, 0xff, 0x9d, 0x8d, 0x81, 0xff, 0x94, 0x85, 0x7b, 0xff, 0x91, 0x81, 0x75, 0xff, 0xb0, 0x9d, 0x8f, 0xff, 0x86, 0x73, 0x64, 0xff, 0x71, 0x56, 0x3f, 0xff, 0xc8, 0xa6, 0x89, 0xff, 0xb4, 0x92, 0x79, 0xff, 0xa0, 0x7f, 0x69, 0xff, 0xa2, 0x83, 0x6e, 0xff, 0x9e, 0x7e, 0x6c, 0xff, 0xa1, 0x82, 0x6c, 0xff, 0x98, 0x76, 0x61, 0xff, 0x9b, 0x75, 0x67, 0xff, 0xbd, 0x9a, 0x86, 0xff, 0xca, 0xac, 0x93, 0xff, 0xce, 0xb3, 0xa4, 0xff, 0xc9, 0xb0, 0xa3, 0xff, 0xca, 0xb1, 0xa0, 0xff, 0xcc, 0xb2, 0xa4, 0xff, 0xd3, 0xb8, 0xaa, 0xff, 0xd6, 0xbb, 0xad, 0xff, 0xd6, 0xbb, 0xa8, 0xff, 0xd7, 0xb9, 0xb5, 0xff, 0xe5, 0xc7, 0xc9, 0xff, 0xdf, 0xc6, 0xae, 0xff, 0xc0, 0xab, 0x91, 0xff, 0xa9, 0x9e, 0x8f, 0xff, 0x90, 0x93, 0x8b, 0xff, 0x87, 0x8c, 0x87, 0xff, 0x95, 0x91, 0x90, 0xff, 0x9c, 0x98, 0x94, 0xff, 0x96, 0x93, 0x8f, 0xff, 0x96, 0x93, 0x90, 0xff, 0x9c, 0x9a, 0x95, 0xff, 0x96, 0x95, 0x92, 0xff, 0x95, 0x93, 0x8d, 0xff, 0x9c, 0x95, 0x89, 0xff, 0x92, 0x8b, 0x8b, 0x21,
+    0xff, 0xff, 0xff, 0x01, 0x8d, 0x9a, 0xa2, 0xf2, 0x83, 0x93, 0x9c, 0xff, 0x7c, 0x8c, 0x99, 0xff, 0x8b, 0x98, 0x9d, 0xff, 0x87, 0x96, 0xa0, 0xff, 0x87, 0x96, 0xa4, 0xff, 0x92, 0x98, 0x9d, 0xff, 0x97, 0x9b, 0x98, 0xff, 0x90, 0x9b, 0x99, 0xff, 0x92, 0x9b, 0x9a, 0xff, 0x9a, 0xa3, 0xa2, 0xff, 0x9a, 0xa4, 0xa8, 0xff, 0x95, 0xa1, 0xa9, 0xff, 0x93, 0xa2, 0xae, 0xff, 0x92, 0xa3, 0xb1, 0xff, 0x91, 0xa1, 0xa9, 0xff, 0x96, 0xa4, 0xa9, 0xff, 0x9b, 0xa5, 0xab, 0xff, 0x99, 0xa3, 0xa6, 0xff, 0x9e, 0xa6, 0xa8, 0xff, 0x9d, 0xa2, 0xa4, 0xff, 0x8b, 0x91, 0x9a, 0xff, 0x89, 0x95, 0x9d, 0xff, 0x92, 0xa5, 0xa9, 0xff, 0x84, 0x97, 0xa0, 0xff, 0x87, 0x92, 0xa9, 0xff, 0x84, 0x87, 0xab, 0xff, 0x78, 0x7a, 0xa3, 0xff, 0x72, 0x77, 0x9f, 0xff, 0x6a, 0x70, 0x99, 0xff, 0x5d, 0x65, 0x8d, 0xff, 0x4d, 0x57, 0x7d, 0xff, 0x46, 0x53, 0x79, 0xff, 0x3b, 0x45, 0x65, 0xff, 0x29, 0x34, 0x4f, 0xff, 0x0f, 0x1c, 0x38, 0xff, 0x00, 0x0c, 0x28, 0xff, 0x02, 0x12, 0x2e, 0xff, 0x0a, 0x1a, 0x36, 0xff, 0x08, 0x1d, 0x38, 0xff, 0x09, 0x1f, 0x39, 0xff, 0x0d, 0x1e, 0x39, 0xff, 0x0d, 0x1b, 0x35, 0xff, 0x0a, 0x16, 0x2d, 0xff, 0x07, 0x11, 0x24, 0xff, 0x07, 0x18, 0x34, 0xff, 0x0e, 0x26, 0x49, 0xff, 0x18, 0x2e, 0x50, 0xff, 0x16, 0x2b, 0x50, 0xff, 0x10, 0x24, 0x48, 0xff, 0x14, 0x26, 0x4a, 0xff, 0x1d, 0x32, 0x46, 0xff, 0x18, 0x28, 0x3d, 0xff, 0x02, 0x0a, 0x2a, 0xff, 0x0f, 0x18, 0x2d, 0xff, 0x14, 0x1d, 0x29, 0xff, 0x10, 0x14, 0x27, 0xff, 0x0d, 0x12, 0x25, 0xff, 0x0a, 0x12, 0x20, 0xff, 0x0a, 0x11, 0x21, 0xff, 0x09, 0x10, 0x22, 0xff, 0x09, 0x10, 0x21, 0xff, 0x08, 0x0f, 0x20, 0xff, 0x06, 0x0d, 0x1e, 0xff, 0x06, 0x0f, 0x1f, 0xff, 0x0a, 0x13, 0x23, 0xff, 0x0d, 0x16, 0x27, 0xff, 0x0b, 0x15, 0x27, 0xff, 0x09, 0x14, 0x26, 0xff, 0x0b, 0x14, 0x26, 0xff, 0x0d, 0x14, 0x26, 0xff, 0x0c, 0x14, 0x26, 0xff, 0x0d, 0x16, 0x29, 0xff, 0x0d, 0x16, 0x2b, 0xff, 0x0c, 0x18, 0x2d, 0xff, 0x14, 0x1d, 0x31, 0xff, 0x17, 0x20, 0x36, 0xff, 0x14, 0x20, 0x39, 0xff, 0x18, 0x25, 0x3e, 0xff, 0x1a, 0x29, 0x3e, 0xff, 0x0d, 0x20, 0x34, 0xff, 0x17, 0x18, 0x21, 0xff, 0x70, 0x66, 0x65, 0xff, 0x84, 0x7f, 0x7d, 0xff, 0x8b, 0x82, 0x7e, 0xff, 0x9b, 0x8d, 0x86, 0xff, 0xa4, 0x90, 0x88, 0xff, 0x94, 0x82, 0x79, 0xff, 0x90, 0x80, 0x77, 0xff, 0x8a, 0x7c, 0x75, 0xff, 0x8c, 0x7e, 0x75, 0xff, 0xa2, 0x92, 0x86, 0xff, 0x56, 0x47, 0x3b, 0xff, 0x74, 0x5c, 0x4a, 0xff, 0xbb, 0x9a, 0x83, 0xff, 0x8d, 0x6e, 0x59, 0xff, 0x86, 0x68, 0x53, 0xff, 0x89, 0x69, 0x55, 0xff, 0x93, 0x72, 0x5f, 0xff, 0x9e, 0x7e, 0x67, 0xff, 0x98, 0x76, 0x5e, 0xff, 0xa2, 0x7d, 0x71, 0xff, 0x8b, 0x68, 0x58, 0xff, 0xb9, 0x9b, 0x84, 0xff, 0xd3, 0xb6, 0xa7, 0xff, 0xc8, 0xae, 0xa1, 0xff, 0xc0, 0xa7, 0x95, 0xff, 0xc5, 0xac, 0x9c, 0xff, 0xd1, 0xb6, 0xa7, 0xff, 0xd6, 0xb8, 0xab, 0xff, 0xd7, 0xb9, 0xac, 0xff, 0xd5, 0xb6, 0xb2, 0xff, 0xd5, 0xb7, 0xb5, 0xff, 0xde, 0xc3, 0xb0, 0xff, 0xe7, 0xcc, 0xbb, 0xff, 0xdc, 0xc2, 0xbb, 0xff, 0xc6, 0xb0, 0xaa, 0xff, 0xa4, 0x9b, 0x92, 0xff, 0x8e, 0x90, 0x86, 0xff, 0x91, 0x90, 0x88, 0xff, 0x94, 0x94, 0x8c, 0xff, 0x97, 0x99, 0x91, 0xff, 0x94, 0x99, 0x91, 0xff, 0x91, 0x94, 0x8e, 0xff, 0x99, 0x94, 0x8c, 0xff, 0x9f, 0x97, 0x8a, 0xf2, 0xff, 0xff, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x8c, 0x99, 0xa3, 0xc6, 0x83, 0x92, 0x9b, 0xff, 0x84, 0x93, 0x9d, 0xff, 0x91, 0x9b, 0x9d, 0xff, 0x87, 0x95, 0x9d, 0xff, 0x82, 0x91, 0xa1, 0xff, 0x91, 0x9a, 0xa1, 0xff, 0x95, 0x9c, 0x9b, 0xff, 0x90, 0x9a, 0x9a, 0xff, 0x95, 0x9f, 0x9d, 0xff, 0x99, 0xa3, 0xa4, 0xff, 0x8e, 0x9b, 0xa2, 0xff, 0x88, 0x98, 0xa2, 0xff, 0x92, 0xa2, 0xaf, 0xff, 0x96, 0xa4, 0xb1, 0xff, 0x91, 0x9f, 0xa8, 0xff, 0x93, 0xa1, 0xa5, 0xff, 0x97, 0xa1, 0xa4, 0xff, 0x99, 0xa1, 0xa3, 0xff, 0x9b, 0xa4, 0xa7, 0xff, 0x96, 0x9e, 0xa3, 0xff, 0x85, 0x90, 0x97, 0xff, 0x7d, 0x8b, 0x94, 0xff, 0x80, 0x92, 0x9d, 0xff, 0x7f, 0x8e, 0xa1, 0xff, 0x7f, 0x88, 0xaa, 0xff, 0x6d, 0x72, 0x9d, 0xff, 0x71, 0x73, 0xa3, 0xff, 0x61, 0x66, 0x95, 0xff, 0x5e, 0x65, 0x92, 0xff, 0x5a, 0x66, 0x8d, 0xff, 0x5e, 0x6a, 0x88, 0xff, 0x6e, 0x7a, 0x92, 0xff, 0x73, 0x7a, 0x95, 0xff, 0x64, 0x68, 0x85, 0xff, 0x4a, 0x50, 0x6b, 0xff, 0x28, 0x31, 0x4c, 0xff, 0x16, 0x20, 0x39, 0xff, 0x10, 0x18, 0x30, 0xff, 0x0d, 0x14, 0x2d, 0xff, 0x0c, 0x14, 0x2d, 0xff, 0x0a, 0x12, 0x28, 0xff, 0x0a, 0x14, 0x2a, 0xff, 0x06, 0x0d, 0x1f, 0xff, 0x01, 0x05, 0x15, 0xff, 0x00, 0x09, 0x20, 0xff, 0x00, 0x0a, 0x25, 0xff, 0x09, 0x19, 0x34, 0xff, 0x13, 0x22, 0x42, 0xff, 0x0c, 0x1a, 0x3b, 0xff, 0x0e, 0x1b, 0x3d, 0xff, 0x0d, 0x25, 0x3d, 0xff, 0x47, 0x5d, 0x80, 0xff, 0x3c, 0x47, 0x76, 0xff, 0x01, 0x0c, 0x21, 0xff, 0x0b, 0x18, 0x1c, 0xff, 0x0c, 0x11, 0x1f, 0xff, 0x0c, 0x10, 0x22, 0xff, 0x0d, 0x11, 0x1f, 0xff, 0x09, 0x0f, 0x1d, 0xff, 0x06, 0x0d, 0x1d, 0xff, 0x09, 0x10, 0x21, 0xff, 0x09, 0x11, 0x21, 0xff, 0x08, 0x10, 0x21, 0xff, 0x0a, 0x12, 0x23, 0xff, 0x0c, 0x15, 0x26, 0xff, 0x0e, 0x18, 0x2a, 0xff, 0x0c, 0x17, 0x29, 0xff, 0x07, 0x13, 0x28, 0xff, 0x08, 0x11, 0x23, 0xff, 0x0e, 0x15, 0x26, 0xff, 0x0f, 0x15, 0x28, 0xff, 0x0b, 0x14, 0x27, 0xff, 0x0c, 0x16, 0x29, 0xff, 0x0f, 0x19, 0x2d, 0xff, 0x12, 0x1c, 0x30, 0xff, 0x12, 0x1d, 0x32, 0xff, 0x12, 0x20, 0x3a, 0xff, 0x17, 0x26, 0x40, 0xff, 0x1f, 0x2c, 0x41, 0xff, 0x06, 0x12, 0x23, 0xff, 0x32, 0x30, 0x37, 0xff, 0x82, 0x79, 0x79, 0xff, 0x81, 0x7c, 0x7c, 0xff, 0x8b, 0x83, 0x83, 0xff, 0x94, 0x88, 0x84, 0xff, 0x98, 0x85, 0x80, 0xff, 0x89, 0x79, 0x73, 0xff, 0x70, 0x65, 0x5f, 0xff, 0x66, 0x5a, 0x56, 0xff, 0x81, 0x76, 0x70, 0xff, 0x93, 0x83, 0x7a, 0xff, 0x5f, 0x4f, 0x42, 0xff, 0x78, 0x61, 0x4e, 0xff, 0x83, 0x64, 0x4e, 0xff, 0x7e, 0x60, 0x4c, 0xff, 0x83, 0x64, 0x4d, 0xff, 0x86, 0x64, 0x4e, 0xff, 0x9e, 0x7b, 0x65, 0xff, 0xa4, 0x82, 0x66, 0xff, 0xa7, 0x82, 0x6b, 0xff, 0x9a, 0x74, 0x69, 0xff, 0x77, 0x54, 0x45, 0xff, 0xb7, 0x9a, 0x85, 0xff, 0xce, 0xb2, 0xa0, 0xff, 0xc7, 0xaa, 0x9d, 0xff, 0xc0, 0xa6, 0x97, 0xff, 0xc6, 0xad, 0x9a, 0xff, 0xd3, 0xb7, 0xa5, 0xff, 0xd7, 0xbb, 0xaa, 0xff, 0xd5, 0xb7, 0xab, 0xff, 0xd6, 0xb6, 0xaa, 0xff, 0xd5, 0xb7, 0xa2, 0xff, 0xd2, 0xb7, 0x9d, 0xff, 0xd9, 0xba, 0xaa, 0xff, 0xde, 0xba, 0xb5, 0xff, 0xe6, 0xc1, 0xb9, 0xff, 0xd8, 0xc1, 0xb3, 0xff, 0xbc, 0xb6, 0xa7, 0xff, 0xaf, 0xa7, 0x98, 0xff, 0xa1, 0x9a, 0x8c, 0xff, 0x98, 0x94, 0x85, 0xff, 0x92, 0x90, 0x84, 0xff, 0x93, 0x93, 0x89, 0xff, 0x9a, 0x94, 0x8b, 0xff, 0x9e, 0x96, 0x87, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x86, 0x94, 0x9f, 0x90, 0x7e, 0x8c, 0x96, 0xff, 0x89, 0x96, 0xa0, 0xff, 0x94, 0x9e, 0x9e, 0xff, 0x87, 0x98, 0xa1, 0xff, 0x7f, 0x93, 0xa5, 0xff, 0x8c, 0x97, 0xa1, 0xff, 0x93, 0x9b, 0x9d, 0xff, 0x90, 0x9b, 0x9c, 0xff, 0x92, 0x9f, 0xa1, 0xff, 0x95, 0xa3, 0xa9, 0xff, 0x88, 0x99, 0xa4, 0xff, 0x7f, 0x92, 0x9f, 0xff, 0x8b, 0x9b, 0xa8, 0xff, 0x95, 0xa3, 0xad, 0xff, 0x91, 0xa0, 0xa9, 0xff, 0x93, 0xa2, 0xa7, 0xff, 0x98, 0xa1, 0xa3, 0xff, 0x9b, 0xa3, 0xa6, 0xff, 0x9b, 0xa5, 0xaa, 0xff, 0x90, 0x9d, 0xa5, 0xff, 0x87, 0x9a, 0x9c, 0xff, 0x85, 0x97, 0x9f, 0xff, 0x81, 0x8f, 0xa5, 0xff, 0x82, 0x8c, 0xb0, 0xff, 0x6c, 0x74, 0xa1, 0xff, 0x6f, 0x75, 0xa4, 0xff, 0x68, 0x72, 0x98, 0xff, 0x5c, 0x67, 0x8e, 0xff, 0x54, 0x5f, 0x8c, 0xff, 0x5f, 0x68, 0x97, 0xff, 0x8d, 0x8e, 0xbc, 0xff, 0xa3, 0x9e, 0xca, 0xff, 0x8b, 0x8f, 0xb6, 0xff, 0x74, 0x7c, 0xa1, 0xff, 0x6f, 0x77, 0x9b, 0xff, 0x6e, 0x76, 0x99, 0xff, 0x62, 0x6b, 0x8d, 0xff, 0x50, 0x59, 0x7a, 0xff, 0x48, 0x52, 0x72, 0xff, 0x40, 0x4c, 0x6c, 0xff, 0x37, 0x43, 0x60, 0xff, 0x30, 0x3f, 0x5b, 0xff, 0x29, 0x3a, 0x54, 0xff, 0x1b, 0x2c, 0x45, 0xff, 0x1b, 0x26, 0x3a, 0xff, 0x1d, 0x25, 0x36, 0xff, 0x0e, 0x19, 0x2c, 0xff, 0x04, 0x0d, 0x24, 0xff, 0x08, 0x13, 0x30, 0xff, 0x16, 0x1f, 0x3d, 0xff, 0x08, 0x22, 0x40, 0xff, 0x19, 0x33, 0x66, 0xff, 0x58, 0x64, 0xa2, 0xff, 0x15, 0x25, 0x3d, 0xff, 0x00, 0x0c, 0x09, 0xff, 0x0c, 0x12, 0x1e, 0xff, 0x0c, 0x0d, 0x1f, 0xff, 0x0b, 0x0e, 0x1a, 0xff, 0x09, 0x0e, 0x1c, 0xff, 0x09, 0x0f, 0x1e, 0xff, 0x0b, 0x12, 0x23, 0xff, 0x0d, 0x15, 0x26, 0xff, 0x0e, 0x16, 0x27, 0xff, 0x0f, 0x18, 0x29, 0xff, 0x0f, 0x19, 0x2b, 0xff, 0x11, 0x1b, 0x2d, 0xff, 0x0e, 0x19, 0x2c, 0xff, 0x09, 0x15, 0x2a, 0xff, 0x0d, 0x16, 0x28, 0xff, 0x0e, 0x16, 0x26, 0xff, 0x0c, 0x13, 0x25, 0xff, 0x0d, 0x14, 0x27, 0xff, 0x0d, 0x18, 0x29, 0xff, 0x11, 0x19, 0x2d, 0xff, 0x11, 0x1d, 0x30, 0xff, 0x0d, 0x1d, 0x32, 0xff, 0x0e, 0x21, 0x3a, 0xff, 0x13, 0x24, 0x3f, 0xff, 0x1c, 0x26, 0x3c, 0xff, 0x07, 0x0c, 0x1c, 0xff, 0x54, 0x50, 0x57, 0xff, 0x85, 0x7d, 0x7f, 0xff, 0x7c, 0x78, 0x7a, 0xff, 0x7f, 0x7b, 0x7c, 0xff, 0x81, 0x78, 0x77, 0xff, 0x8b, 0x79, 0x77, 0xff, 0x7b, 0x6e, 0x6c, 0xff, 0x5a, 0x54, 0x54, 0xff, 0x45, 0x3e, 0x3d, 0xff, 0x61, 0x57, 0x54, 0xff, 0x88, 0x78, 0x6d, 0xff, 0x59, 0x47, 0x36, 0xff, 0x59, 0x40, 0x2d, 0xff, 0x73, 0x56, 0x41, 0xff, 0x85, 0x66, 0x51, 0xff, 0x95, 0x74, 0x5c, 0xff, 0xb6, 0x91, 0x78, 0xff, 0xc3, 0x9c, 0x82, 0xff, 0xb8, 0x92, 0x74, 0xff, 0xb0, 0x8b, 0x73, 0xff, 0xa2, 0x7d, 0x71, 0xff, 0x8d, 0x6d, 0x60, 0xff, 0xb8, 0x9d, 0x87, 0xff, 0xcc, 0xb1, 0x9d, 0xff, 0xc2, 0xa6, 0x99, 0xff, 0xc3, 0xa9, 0x9b, 0xff, 0xca, 0xb0, 0x9b, 0xff, 0xcd, 0xb3, 0x9b, 0xff, 0xcd, 0xb1, 0x9a, 0xff, 0xcd, 0xae, 0x9b, 0xff, 0xcb, 0xab, 0x9e, 0xff, 0xce, 0xb1, 0xa2, 0xff, 0xce, 0xb5, 0xa1, 0xff, 0xd3, 0xb7, 0xaa, 0xff, 0xd9, 0xba, 0xb3, 0xff, 0xde, 0xc1, 0xab, 0xff, 0xe2, 0xc3, 0xaa, 0xff, 0xe1, 0xbf, 0xaf, 0xff, 0xdd, 0xbf, 0xae, 0xff, 0xd3, 0xbb, 0xab, 0xff, 0xc6, 0xb1, 0xa2, 0xff, 0xb8, 0xa3, 0x94, 0xff, 0xa2, 0x98, 0x8c, 0xff, 0x8d, 0x8c, 0x81, 0xff, 0x94, 0x8b, 0x7b, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x85, 0x96, 0x99, 0x58, 0x7d, 0x92, 0x99, 0xff, 0x8c, 0x9c, 0xa0, 0xff, 0x97, 0x9f, 0x9c, 0xff, 0x92, 0x9c, 0x9e, 0xff, 0x8a, 0x9a, 0xa5, 0xff, 0x8e, 0x9c, 0xa7, 0xff, 0x91, 0x9d, 0xa6, 0xff, 0x8f, 0x9b, 0xa2, 0xff, 0x94, 0x9f, 0xa4, 0xff, 0x93, 0x9f, 0xa4, 0xff, 0x8e, 0x9c, 0xa5, 0xff, 0x8f, 0x9e, 0xa7, 0xff, 0x95, 0xa2, 0xa9, 0xff, 0x94, 0xa0, 0xa3, 0xff, 0x8a, 0xa0, 0xa5, 0xff, 0x8d, 0xa2, 0xac, 0xff, 0x95, 0xa2, 0xab, 0xff, 0x9d, 0xa7, 0xaa, 0xff, 0x9f, 0xa9, 0xa9, 0xff, 0x9a, 0xa1, 0xa7, 0xff, 0x94, 0xa2, 0x9b, 0xff, 0x96, 0xa4, 0xaa, 0xff, 0x8e, 0x94, 0xba, 0xff, 0x76, 0x7d, 0xad, 0xff, 0x69, 0x72, 0x9f, 0xff, 0x6c, 0x77, 0x9e, 0xff, 0x60, 0x6a, 0x8f, 0xff, 0x5a, 0x62, 0x8a, 0xff, 0x5f, 0x67, 0x94, 0xff, 0x7d, 0x83, 0xb2, 0xff, 0x8c, 0x91, 0xbe, 0xff, 0x67, 0x6c, 0x97, 0xff, 0x4f, 0x53, 0x7c, 0xff, 0x61, 0x66, 0x8d, 0xff, 0x65, 0x6f, 0x96, 0xff, 0x52, 0x60, 0x84, 0xff, 0x45, 0x57, 0x7a, 0xff, 0x40, 0x56, 0x78, 0xff, 0x40, 0x51, 0x73, 0xff, 0x41, 0x4f, 0x71, 0xff, 0x39, 0x47, 0x69, 0xff, 0x31, 0x3f, 0x60, 0xff, 0x2f, 0x3d, 0x5e, 0xff, 0x2b, 0x37, 0x58, 0xff, 0x25, 0x3b, 0x54, 0xff, 0x31, 0x44, 0x5a, 0xff, 0x39, 0x3f, 0x54, 0xff, 0x0e, 0x14, 0x22, 0xff, 0x02, 0x0a, 0x1b, 0xff, 0x16, 0x1d, 0x38, 0xff, 0x14, 0x24, 0x48, 0xff, 0x0f, 0x26, 0x53, 0xff, 0x2e, 0x3e, 0x6a, 0xff, 0x1a, 0x23, 0x3a, 0xff, 0x04, 0x09, 0x11, 0xff, 0x05, 0x0c, 0x1f, 0xff, 0x06, 0x0b, 0x1c, 0xff, 0x06, 0x0d, 0x17, 0xff, 0x06, 0x0d, 0x1b, 0xff, 0x08, 0x0f, 0x1e, 0xff, 0x0a, 0x12, 0x21, 0xff, 0x0e, 0x16, 0x27, 0xff, 0x10, 0x19, 0x2a, 0xff, 0x0d, 0x18, 0x2b, 0xff, 0x0c, 0x1a, 0x2c, 0xff, 0x10, 0x1e, 0x31, 0xff, 0x11, 0x1d, 0x33, 0xff, 0x0f, 0x1a, 0x31, 0xff, 0x0e, 0x15, 0x29, 0xff, 0x0b, 0x12, 0x24, 0xff, 0x0c, 0x13, 0x25, 0xff, 0x0e, 0x14, 0x27, 0xff, 0x0f, 0x17, 0x29, 0xff, 0x10, 0x19, 0x2b, 0xff, 0x14, 0x1c, 0x2f, 0xff, 0x13, 0x1c, 0x35, 0xff, 0x0f, 0x1d, 0x38, 0xff, 0x13, 0x22, 0x3b, 0xff, 0x0d, 0x16, 0x28, 0xff, 0x14, 0x11, 0x19, 0xff, 0x6a, 0x69, 0x6e, 0xff, 0x70, 0x6f, 0x75, 0xff, 0x79, 0x70, 0x73, 0xff, 0x8c, 0x7f, 0x7e, 0xff, 0x88, 0x7c, 0x79, 0xff, 0x80, 0x73, 0x6e, 0xff, 0x61, 0x5e, 0x60, 0xff, 0x4b, 0x49, 0x4d, 0xff, 0x50, 0x41, 0x3c, 0xff, 0x5d, 0x52, 0x4c, 0xff, 0x67, 0x5f, 0x57, 0xff, 0x41, 0x31, 0x27, 0xff, 0x65, 0x44, 0x2d, 0xff, 0x9b, 0x75, 0x56, 0xff, 0xb7, 0x95, 0x7a, 0xff, 0xc1, 0xa1, 0x89, 0xff, 0xbb, 0x99, 0x80, 0xff, 0xa9, 0x86, 0x6c, 0xff, 0x9f, 0x7a, 0x62, 0xff, 0xa8, 0x84, 0x70, 0xff, 0x9a, 0x76, 0x66, 0xff, 0x96, 0x73, 0x63, 0xff, 0xc0, 0xa0, 0x8e, 0xff, 0xc3, 0xa7, 0x95, 0xff, 0xbd, 0xa1, 0x92, 0xff, 0xc0, 0xa3, 0x94, 0xff, 0xc9, 0xac, 0x9c, 0xff, 0xcb, 0xaf, 0x9d, 0xff, 0xc3, 0xa8, 0x95, 0xff, 0xc6, 0xab, 0x99, 0xff, 0xd2, 0xb6, 0xa8, 0xff, 0xd7, 0xbd, 0xb0, 0xff, 0xd8, 0xbf, 0xb0, 0xff, 0xde, 0xc4, 0xb6, 0xff, 0xde, 0xc4, 0xb6, 0xff, 0xd9, 0xc0, 0xac, 0xff, 0xdc, 0xbe, 0xa9, 0xff, 0xdd, 0xbb, 0xaa, 0xff, 0xdb, 0xbb, 0xaa, 0xff, 0xdb, 0xbd, 0xac, 0xff, 0xe0, 0xc2, 0xb2, 0xff, 0xe0, 0xc3, 0xb2, 0xff, 0xd3, 0xbb, 0xab, 0xff, 0xc2, 0xb1, 0xa1, 0xff, 0xb3, 0xa2, 0x93, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8d, 0xa0, 0xa0, 0x1b, 0x88, 0x9b, 0xa6, 0xff, 0x8f, 0x9c, 0xa3, 0xff, 0x99, 0x9e, 0x9c, 0xff, 0x97, 0x9f, 0x9d, 0xff, 0x92, 0x9d, 0xa3, 0xff, 0x8e, 0x9d, 0xa8, 0xff, 0x88, 0x99, 0xa6, 0xff, 0x8d, 0x9b, 0xa6, 0xff, 0x99, 0xa1, 0xa6, 0xff, 0x97, 0xa2, 0xa5, 0xff, 0x93, 0x9f, 0xa5, 0xff, 0x99, 0xa5, 0xaa, 0xff, 0x9c, 0xa9, 0xab, 0xff, 0x93, 0x9e, 0x9e, 0xff, 0x8f, 0xa3, 0xa4, 0xff, 0x94, 0xa6, 0xb0, 0xff, 0x97, 0xa3, 0xae, 0xff, 0x9c, 0xa7, 0xa7, 0xff, 0xa0, 0xa8, 0xa3, 0xff, 0xa1, 0xa4, 0xa5, 0xff, 0x99, 0xa3, 0x9d, 0xff, 0x8f, 0x99, 0xa6, 0xff, 0x82, 0x86, 0xb3, 0xff, 0x7a, 0x80, 0xb3, 0xff, 0x74, 0x7e, 0xa8, 0xff, 0x60, 0x6b, 0x91, 0xff, 0x57, 0x5e, 0x87, 0xff, 0x60, 0x66, 0x92, 0xff, 0x70, 0x75, 0xa2, 0xff, 0x78, 0x7f, 0xaa, 0xff, 0x4f, 0x5a, 0x80, 0xff, 0x33, 0x41, 0x64, 0xff, 0x3c, 0x44, 0x67, 0xff, 0x4d, 0x52, 0x77, 0xff, 0x39, 0x44, 0x66, 0xff, 0x1d, 0x2d, 0x4d, 0xff, 0x15, 0x2a, 0x48, 0xff, 0x18, 0x2f, 0x4d, 0xff, 0x1f, 0x34, 0x52, 0xff, 0x20, 0x33, 0x51, 0xff, 0x1d, 0x30, 0x4e, 0xff, 0x1b, 0x2d, 0x4b, 0xff, 0x19, 0x2a, 0x4a, 0xff, 0x1c, 0x2d, 0x4c, 0xff, 0x18, 0x36, 0x52, 0xff, 0x1d, 0x36, 0x58, 0xff, 0x2c, 0x38, 0x5b, 0xff, 0x1c, 0x2a, 0x3f, 0xff, 0x00, 0x05, 0x11, 0xff, 0x01, 0x02, 0x18, 0xff, 0x01, 0x04, 0x20, 0xff, 0x0d, 0x1b, 0x35, 0xff, 0x15, 0x21, 0x38, 0xff, 0x09, 0x0a, 0x18, 0xff, 0x0c, 0x08, 0x12, 0xff, 0x07, 0x0a, 0x17, 0xff, 0x05, 0x0c, 0x1a, 0xff, 0x04, 0x0c, 0x19, 0xff, 0x04, 0x0c, 0x1b, 0xff, 0x05, 0x0c, 0x1b, 0xff, 0x06, 0x0e, 0x1f, 0xff, 0x0c, 0x14, 0x25, 0xff, 0x0e, 0x18, 0x29, 0xff, 0x0c, 0x18, 0x2c, 0xff, 0x0c, 0x1b, 0x2f, 0xff, 0x10, 0x21, 0x33, 0xff, 0x12, 0x20, 0x36, 0xff, 0x10, 0x1a, 0x32, 0xff, 0x0d, 0x14, 0x29, 0xff, 0x0d, 0x14, 0x27, 0xff, 0x0e, 0x15, 0x28, 0xff, 0x0d, 0x14, 0x27, 0xff, 0x0f, 0x16, 0x29, 0xff, 0x11, 0x18, 0x2a, 0xff, 0x15, 0x1a, 0x2f, 0xff, 0x12, 0x1b, 0x33, 0xff, 0x10, 0x1d, 0x37, 0xff, 0x13, 0x21, 0x37, 0xff, 0x00, 0x03, 0x10, 0xff, 0x31, 0x2a, 0x2d, 0xff, 0x74, 0x72, 0x74, 0xff, 0x6b, 0x6b, 0x6f, 0xff, 0x87, 0x7b, 0x7d, 0xff, 0x95, 0x84, 0x82, 0xff, 0x88, 0x7c, 0x78, 0xff, 0x71, 0x68, 0x64, 0xff, 0x4a, 0x4e, 0x51, 0xff, 0x3d, 0x3b, 0x3e, 0xff, 0x66, 0x51, 0x49, 0xff, 0x73, 0x67, 0x60, 0xff, 0x4f, 0x4b, 0x46, 0xff, 0x35, 0x25, 0x1d, 0xff, 0x87, 0x64, 0x4d, 0xff, 0xb9, 0x94, 0x76, 0xff, 0xa8, 0x88, 0x74, 0xff, 0x84, 0x68, 0x58, 0xff, 0x69, 0x4f, 0x40, 0xff, 0x6b, 0x52, 0x41, 0xff, 0x85, 0x67, 0x55, 0xff, 0xa6, 0x80, 0x6f, 0xff, 0x88, 0x64, 0x52, 0xff, 0x99, 0x75, 0x64, 0xff, 0xc9, 0xa6, 0x97, 0xff, 0xc0, 0xa2, 0x92, 0xff, 0xba, 0x9c, 0x8d, 0xff, 0xc2, 0xa1, 0x93, 0xff, 0xc0, 0xa3, 0x94, 0xff, 0xca, 0xac, 0x9f, 0xff, 0xd0, 0xb5, 0xa6, 0xff, 0xd5, 0xbb, 0xac, 0xff, 0xd4, 0xbc, 0xab, 0xff, 0xda, 0xc1, 0xb0, 0xff, 0xdf, 0xc5, 0xb6, 0xff, 0xd9, 0xbf, 0xaf, 0xff, 0xd5, 0xba, 0xa9, 0xff, 0xd3, 0xb5, 0xa8, 0xff, 0xc9, 0xad, 0x9f, 0xff, 0xcf, 0xb5, 0xa4, 0xff, 0xd9, 0xbe, 0xad, 0xff, 0xdb, 0xbf, 0xae, 0xff, 0xdd, 0xc1, 0xaf, 0xff, 0xda, 0xbe, 0xac, 0xff, 0xdf, 0xc0, 0xad, 0xff, 0xe0, 0xbe, 0xad, 0xff, 0xd9, 0xbc, 0xaa, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x99, 0xa8, 0xd7, 0x92, 0x98, 0xa4, 0xff, 0x99, 0xa0, 0xa0, 0xff, 0x94, 0xa1, 0xa0, 0xff, 0x92, 0x9f, 0xa5, 0xff, 0x8e, 0x9c, 0xa7, 0xff, 0x86, 0x97, 0xa3, 0xff, 0x88, 0x98, 0xa5, 0xff, 0x97, 0xa1, 0xa7, 0xff, 0x9a, 0xa4, 0xa8, 0xff, 0x96, 0xa2, 0xa9, 0xff, 0x99, 0xa6, 0xab, 0xff, 0x9b, 0xa6, 0xaa, 0xff, 0x98, 0xa2, 0xa3, 0xff, 0x9d, 0xa6, 0xa4, 0xff, 0x9d, 0xa4, 0xaa, 0xff, 0x99, 0xa1, 0xa8, 0xff, 0x9a, 0xa5, 0xa0, 0xff, 0x9c, 0xa5, 0x9d, 0xff, 0x9f, 0xa4, 0xa1, 0xff, 0x9c, 0xa6, 0xad, 0xff, 0x89, 0x93, 0xad, 0xff, 0x7e, 0x83, 0xb3, 0xff, 0x74, 0x7c, 0xad, 0xff, 0x66, 0x70, 0x9b, 0xff, 0x55, 0x5d, 0x8b, 0xff, 0x5d, 0x65, 0x8f, 0xff, 0x6c, 0x73, 0x9d, 0xff, 0x6d, 0x74, 0xa0, 0xff, 0x50, 0x58, 0x84, 0xff, 0x3d, 0x48, 0x6f, 0xff, 0x3e, 0x4a, 0x6f, 0xff, 0x3d, 0x4a, 0x6c, 0xff, 0x36, 0x44, 0x65, 0xff, 0x1d, 0x2b, 0x4b, 0xff, 0x19, 0x27, 0x47, 0xff, 0x24, 0x31, 0x50, 0xff, 0x27, 0x35, 0x52, 0xff, 0x1a, 0x29, 0x46, 0xff, 0x14, 0x27, 0x42, 0xff, 0x14, 0x2a, 0x45, 0xff, 0x12, 0x29, 0x44, 0xff, 0x11, 0x2b, 0x46, 0xff, 0x12, 0x2f, 0x48, 0xff, 0x17, 0x32, 0x4c, 0xff, 0x18, 0x30, 0x55, 0xff, 0x16, 0x2f, 0x5b, 0xff, 0x0a, 0x1e, 0x3c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1d, 0x12, 0x17, 0xff, 0x33, 0x2c, 0x32, 0xff, 0x0a, 0x10, 0x1e, 0xff, 0x00, 0x06, 0x17, 0xff, 0x0a, 0x0b, 0x14, 0xff, 0x10, 0x0b, 0x0d, 0xff, 0x0c, 0x0b, 0x0d, 0xff, 0x04, 0x0a, 0x15, 0xff, 0x02, 0x09, 0x1a, 0xff, 0x05, 0x0c, 0x1b, 0xff, 0x07, 0x0d, 0x1d, 0xff, 0x08, 0x10, 0x21, 0xff, 0x0c, 0x14, 0x25, 0xff, 0x0e, 0x17, 0x28, 0xff, 0x0f, 0x1a, 0x2e, 0xff, 0x10, 0x1f, 0x32, 0xff, 0x11, 0x20, 0x33, 0xff, 0x0e, 0x1c, 0x31, 0xff, 0x10, 0x1a, 0x31, 0xff, 0x11, 0x18, 0x2d, 0xff, 0x0e, 0x15, 0x27, 0xff, 0x0d, 0x14, 0x27, 0xff, 0x0d, 0x14, 0x27, 0xff, 0x10, 0x17, 0x2a, 0xff, 0x11, 0x17, 0x2a, 0xff, 0x0f, 0x1a, 0x2d, 0xff, 0x0e, 0x1d, 0x32, 0xff, 0x11, 0x20, 0x36, 0xff, 0x0b, 0x16, 0x2a, 0xff, 0x00, 0x00, 0x0b, 0xff, 0x55, 0x49, 0x4e, 0xff, 0x7e, 0x75, 0x76, 0xff, 0x77, 0x72, 0x72, 0xff, 0x7b, 0x72, 0x6f, 0xff, 0x7e, 0x72, 0x70, 0xff, 0x72, 0x69, 0x6a, 0xff, 0x56, 0x52, 0x55, 0xff, 0x39, 0x3d, 0x42, 0xff, 0x3e, 0x39, 0x39, 0xff, 0x6d, 0x5a, 0x53, 0xff, 0x75, 0x69, 0x64, 0xff, 0x4a, 0x43, 0x3e, 0xff, 0x2f, 0x1b, 0x0e, 0xff, 0x85, 0x62, 0x51, 0xff, 0xa0, 0x7f, 0x6d, 0xff, 0x7a, 0x5d, 0x50, 0xff, 0x5b, 0x44, 0x38, 0xff, 0x59, 0x44, 0x38, 0xff, 0x62, 0x4f, 0x43, 0xff, 0x98, 0x7b, 0x6b, 0xff, 0xa9, 0x82, 0x6f, 0xff, 0x86, 0x62, 0x51, 0xff, 0xa0, 0x7b, 0x6b, 0xff, 0xc6, 0xa4, 0x94, 0xff, 0xc3, 0xa6, 0x96, 0xff, 0xc4, 0xa6, 0x97, 0xff, 0xca, 0xab, 0x9c, 0xff, 0xd0, 0xb3, 0xa4, 0xff, 0xd2, 0xb4, 0xa6, 0xff, 0xd3, 0xb8, 0xa8, 0xff, 0xda, 0xc0, 0xb0, 0xff, 0xdc, 0xc2, 0xb2, 0xff, 0xdb, 0xc2, 0xb1, 0xff, 0xd6, 0xbd, 0xad, 0xff, 0xd2, 0xb5, 0xa6, 0xff, 0xce, 0xb1, 0xa2, 0xff, 0xc4, 0xa6, 0x98, 0xff, 0xc5, 0xa8, 0x99, 0xff, 0xcf, 0xb4, 0xa3, 0xff, 0xd5, 0xba, 0xa9, 0xff, 0xd9, 0xbe, 0xad, 0xff, 0xdb, 0xbf, 0xae, 0xff, 0xd4, 0xb9, 0xa8, 0xff, 0xd5, 0xb7, 0xa6, 0xff, 0xd9, 0xb5, 0xa4, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x9e, 0xa7, 0x8e, 0x95, 0x9d, 0xa3, 0xff, 0x94, 0x9e, 0xa1, 0xff, 0x92, 0x9e, 0xa2, 0xff, 0x92, 0x9e, 0xa5, 0xff, 0x8f, 0x9e, 0xa7, 0xff, 0x8c, 0x9b, 0xaa, 0xff, 0x8b, 0x9d, 0xac, 0xff, 0x92, 0x9f, 0xa9, 0xff, 0x91, 0x9c, 0xa4, 0xff, 0x8c, 0x9a, 0xa3, 0xff, 0x93, 0x9f, 0xa7, 0xff, 0x99, 0xa4, 0xa9, 0xff, 0x98, 0xa2, 0xa2, 0xff, 0x9c, 0xa0, 0x9e, 0xff, 0x9d, 0xa0, 0xa4, 0xff, 0x9a, 0xa2, 0xa8, 0xff, 0x9a, 0xa7, 0xa3, 0xff, 0x99, 0xa5, 0x9c, 0xff, 0xa2, 0xa8, 0xa5, 0xff, 0x94, 0x9c, 0xaf, 0xff, 0x80, 0x88, 0xaf, 0xff, 0x7d, 0x82, 0xb5, 0xff, 0x67, 0x70, 0xa0, 0xff, 0x50, 0x5c, 0x87, 0xff, 0x55, 0x5e, 0x8c, 0xff, 0x66, 0x6e, 0x98, 0xff, 0x63, 0x6a, 0x94, 0xff, 0x59, 0x62, 0x8e, 0xff, 0x4d, 0x56, 0x82, 0xff, 0x4a, 0x55, 0x7d, 0xff, 0x3c, 0x49, 0x6f, 0xff, 0x32, 0x44, 0x65, 0xff, 0x1a, 0x2d, 0x4c, 0xff, 0x0f, 0x1e, 0x3d, 0xff, 0x1e, 0x2a, 0x49, 0xff, 0x43, 0x4c, 0x6b, 0xff, 0x4e, 0x57, 0x75, 0xff, 0x3b, 0x42, 0x5f, 0xff, 0x18, 0x20, 0x3c, 0xff, 0x0a, 0x16, 0x32, 0xff, 0x12, 0x21, 0x3d, 0xff, 0x13, 0x26, 0x40, 0xff, 0x0d, 0x23, 0x3d, 0xff, 0x12, 0x22, 0x39, 0xff, 0x0f, 0x24, 0x42, 0xff, 0x08, 0x1f, 0x44, 0xff, 0x06, 0x0d, 0x23, 0xff, 0x6b, 0x5c, 0x5a, 0xff, 0x9f, 0x7f, 0x6c, 0xff, 0x5e, 0x4e, 0x48, 0xff, 0x34, 0x39, 0x49, 0xff, 0x0d, 0x17, 0x2d, 0xff, 0x0a, 0x13, 0x24, 0xff, 0x0a, 0x0e, 0x17, 0xff, 0x05, 0x09, 0x14, 0xff, 0x03, 0x08, 0x18, 0xff, 0x03, 0x0a, 0x19, 0xff, 0x05, 0x0c, 0x1c, 0xff, 0x09, 0x10, 0x21, 0xff, 0x0a, 0x12, 0x23, 0xff, 0x0c, 0x13, 0x25, 0xff, 0x0e, 0x16, 0x29, 0xff, 0x0d, 0x19, 0x2d, 0xff, 0x0e, 0x1c, 0x2f, 0xff, 0x0d, 0x1d, 0x30, 0xff, 0x0f, 0x1d, 0x32, 0xff, 0x13, 0x1d, 0x34, 0xff, 0x11, 0x17, 0x2c, 0xff, 0x0d, 0x13, 0x26, 0xff, 0x0d, 0x14, 0x27, 0xff, 0x0f, 0x16, 0x29, 0xff, 0x10, 0x17, 0x2a, 0xff, 0x12, 0x18, 0x2b, 0xff, 0x0f, 0x19, 0x2d, 0xff, 0x0d, 0x1c, 0x2e, 0xff, 0x0c, 0x19, 0x2b, 0xff, 0x01, 0x04, 0x12, 0xff, 0x16, 0x14, 0x1d, 0xff, 0x71, 0x63, 0x68, 0xff, 0x7c, 0x71, 0x71, 0xff, 0x6e, 0x68, 0x66, 0xff, 0x6e, 0x66, 0x64, 0xff, 0x6a, 0x64, 0x62, 0xff, 0x5c, 0x58, 0x5a, 0xff, 0x40, 0x40, 0x46, 0xff, 0x2f, 0x31, 0x34, 0xff, 0x4f, 0x46, 0x43, 0xff, 0x74, 0x61, 0x5a, 0xff, 0x65, 0x59, 0x55, 0xff, 0x39, 0x32, 0x2d, 0xff, 0x3b, 0x24, 0x16, 0xff, 0x93, 0x6e, 0x59, 0xff, 0x9a, 0x75, 0x60, 0xff, 0x87, 0x67, 0x55, 0xff, 0x79, 0x5d, 0x4d, 0xff, 0x73, 0x5a, 0x48, 0xff, 0x83, 0x6b, 0x57, 0xff, 0xab, 0x8c, 0x79, 0xff, 0xaf, 0x89, 0x77, 0xff, 0xa6, 0x82, 0x71, 0xff, 0xac, 0x87, 0x77, 0xff, 0xc6, 0xa4, 0x94, 0xff, 0xc8, 0xab, 0x9a, 0xff, 0xcf, 0xb1, 0xa2, 0xff, 0xd0, 0xb2, 0xa2, 0xff, 0xcb, 0xae, 0x9f, 0xff, 0xd0, 0xb3, 0xa4, 0xff, 0xd4, 0xba, 0xaa, 0xff, 0xda, 0xc1, 0xb1, 0xff, 0xde, 0xc4, 0xb4, 0xff, 0xd9, 0xc0, 0xaf, 0xff, 0xd3, 0xb7, 0xa8, 0xff, 0xc8, 0xab, 0x9c, 0xff, 0xc2, 0xa4, 0x95, 0xff, 0xc6, 0xa7, 0x99, 0xff, 0xcb, 0xad, 0x9d, 0xff, 0xd3, 0xb6, 0xa5, 0xff, 0xd9, 0xbc, 0xab, 0xff, 0xda, 0xbc, 0xab, 0xff, 0xda, 0xbd, 0xac, 0xff, 0xda, 0xbd, 0xac, 0xff, 0xd3, 0xb6, 0xa5, 0xff, 0xc7, 0xac, 0x98, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xa0, 0xa7, 0x46, 0x94, 0xa2, 0xa5, 0xff, 0x8f, 0x9d, 0xa1, 0xff, 0x8f, 0x9e, 0xa4, 0xff, 0x95, 0xa2, 0xa8, 0xff, 0x91, 0xa0, 0xa8, 0xff, 0x87, 0x98, 0xa8, 0xff, 0x84, 0x97, 0xab, 0xff, 0x88, 0x99, 0xa6, 0xff, 0x89, 0x99, 0xa5, 0xff, 0x8a, 0x9b, 0xa9, 0xff, 0x8f, 0xa0, 0xac, 0xff, 0x94, 0xa3, 0xa9, 0xff, 0x94, 0xa0, 0xa3, 0xff, 0x9a, 0xa2, 0xa2, 0xff, 0x96, 0x9d, 0xa5, 0xff, 0x91, 0x9d, 0xa8, 0xff, 0x8e, 0x9e, 0xa1, 0xff, 0x93, 0xa1, 0x9f, 0xff, 0xa1, 0xa6, 0xab, 0xff, 0x88, 0x8e, 0xac, 0xff, 0x79, 0x80, 0xb1, 0xff, 0x6d, 0x76, 0xa8, 0xff, 0x55, 0x62, 0x8e, 0xff, 0x4b, 0x58, 0x7e, 0xff, 0x5f, 0x68, 0x95, 0xff, 0x60, 0x67, 0x92, 0xff, 0x59, 0x62, 0x8c, 0xff, 0x58, 0x60, 0x8c, 0xff, 0x51, 0x5c, 0x87, 0xff, 0x41, 0x4e, 0x76, 0xff, 0x3b, 0x48, 0x6d, 0xff, 0x28, 0x38, 0x5b, 0xff, 0x15, 0x25, 0x49, 0xff, 0x2f, 0x3c, 0x5f, 0xff, 0x5c, 0x65, 0x88, 0xff, 0x72, 0x7a, 0x9d, 0xff, 0x74, 0x7a, 0x9b, 0xff, 0x6c, 0x73, 0x92, 0xff, 0x46, 0x4d, 0x6b, 0xff, 0x1d, 0x24, 0x43, 0xff, 0x1a, 0x23, 0x41, 0xff, 0x16, 0x21, 0x3f, 0xff, 0x0f, 0x1b, 0x38, 0xff, 0x0d, 0x14, 0x2e, 0xff, 0x01, 0x0e, 0x28, 0xff, 0x00, 0x02, 0x18, 0xff, 0x87, 0x7e, 0x85, 0xff, 0xf7, 0xd4, 0xc6, 0xff, 0x7d, 0x56, 0x3a, 0xff, 0x2d, 0x1a, 0x10, 0xff, 0x42, 0x43, 0x54, 0xff, 0x2a, 0x36, 0x53, 0xff, 0x13, 0x21, 0x3d, 0xff, 0x0c, 0x16, 0x2b, 0xff, 0x05, 0x0d, 0x22, 0xff, 0x04, 0x0b, 0x1c, 0xff, 0x06, 0x0c, 0x1b, 0xff, 0x07, 0x0e, 0x1f, 0xff, 0x09, 0x10, 0x22, 0xff, 0x0a, 0x11, 0x24, 0xff, 0x0d, 0x14, 0x28, 0xff, 0x0e, 0x16, 0x29, 0xff, 0x0a, 0x16, 0x29, 0xff, 0x0b, 0x1a, 0x2d, 0xff, 0x0f, 0x1e, 0x31, 0xff, 0x11, 0x1e, 0x34, 0xff, 0x10, 0x19, 0x31, 0xff, 0x0e, 0x16, 0x2a, 0xff, 0x0d, 0x14, 0x26, 0xff, 0x0d, 0x14, 0x27, 0xff, 0x0e, 0x15, 0x28, 0xff, 0x0e, 0x15, 0x28, 0xff, 0x10, 0x17, 0x2a, 0xff, 0x0f, 0x17, 0x2a, 0xff, 0x0c, 0x17, 0x28, 0xff, 0x09, 0x12, 0x20, 0xff, 0x00, 0x00, 0x05, 0xff, 0x34, 0x31, 0x37, 0xff, 0x7e, 0x72, 0x75, 0xff, 0x74, 0x6a, 0x6b, 0xff, 0x68, 0x63, 0x63, 0xff, 0x60, 0x5b, 0x5b, 0xff, 0x54, 0x51, 0x50, 0xff, 0x4d, 0x4b, 0x4e, 0xff, 0x3b, 0x3a, 0x41, 0xff, 0x3b, 0x39, 0x3d, 0xff, 0x61, 0x55, 0x50, 0xff, 0x70, 0x5b, 0x56, 0xff, 0x5f, 0x53, 0x51, 0xff, 0x27, 0x21, 0x1c, 0xff, 0x54, 0x3b, 0x2c, 0xff, 0xa3, 0x7c, 0x63, 0xff, 0x9f, 0x7d, 0x62, 0xff, 0x90, 0x6f, 0x58, 0xff, 0x7e, 0x5d, 0x4a, 0xff, 0x80, 0x5e, 0x48, 0xff, 0x9f, 0x7c, 0x61, 0xff, 0xb0, 0x8c, 0x75, 0xff, 0xb3, 0x8f, 0x7e, 0xff, 0xae, 0x8a, 0x78, 0xff, 0xb3, 0x8e, 0x7e, 0xff, 0xc9, 0xa7, 0x97, 0xff, 0xc2, 0xa4, 0x94, 0xff, 0xbd, 0xa0, 0x91, 0xff, 0xc8, 0xa9, 0x9a, 0xff, 0xce, 0xb0, 0xa1, 0xff, 0xd9, 0xbc, 0xad, 0xff, 0xe1, 0xc6, 0xb7, 0xff, 0xe2, 0xc8, 0xb8, 0xff, 0xdc, 0xc3, 0xb2, 0xff, 0xd4, 0xb8, 0xa8, 0xff, 0xc7, 0xa9, 0x9a, 0xff, 0xbf, 0xa2, 0x93, 0xff, 0xc6, 0xa7, 0x98, 0xff, 0xd0, 0xb1, 0xa2, 0xff, 0xd1, 0xb3, 0xa3, 0xff, 0xd1, 0xb3, 0xa1, 0xff, 0xd8, 0xba, 0xa9, 0xff, 0xd7, 0xb9, 0xa8, 0xff, 0xd2, 0xb4, 0xa3, 0xff, 0xd6, 0xb8, 0xa7, 0xff, 0xc4, 0xa8, 0x97, 0xff, 0xab, 0x91, 0x7f, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x91, 0x91, 0x07, 0x8c, 0x9e, 0xaa, 0xef, 0x91, 0xa1, 0xaa, 0xff, 0x92, 0xa2, 0xa9, 0xff, 0x95, 0xa1, 0xa7, 0xff, 0x8d, 0x9b, 0xa1, 0xff, 0x85, 0x95, 0xa3, 0xff, 0x7e, 0x93, 0xa9, 0xff, 0x83, 0x96, 0xa8, 0xff, 0x8a, 0x9b, 0xab, 0xff, 0x87, 0x9a, 0xaa, 0xff, 0x87, 0x9b, 0xa9, 0xff, 0x8e, 0x9f, 0xa9, 0xff, 0x92, 0xa0, 0xa7, 0xff, 0x93, 0xa0, 0xa6, 0xff, 0x81, 0x92, 0x9e, 0xff, 0x79, 0x8f, 0x9e, 0xff, 0x7e, 0x94, 0x9c, 0xff, 0x93, 0xa1, 0xa5, 0xff, 0x99, 0x9c, 0xa5, 0xff, 0x84, 0x89, 0xae, 0xff, 0x6f, 0x79, 0xac, 0xff, 0x5a, 0x66, 0x98, 0xff, 0x4e, 0x5f, 0x85, 0xff, 0x58, 0x68, 0x8b, 0xff, 0x65, 0x6f, 0x9b, 0xff, 0x5c, 0x64, 0x8f, 0xff, 0x5e, 0x66, 0x91, 0xff, 0x57, 0x5f, 0x8c, 0xff, 0x40, 0x4c, 0x78, 0xff, 0x32, 0x3e, 0x66, 0xff, 0x2e, 0x3d, 0x61, 0xff, 0x29, 0x36, 0x5c, 0xff, 0x41, 0x4b, 0x73, 0xff, 0x74, 0x7d, 0xa4, 0xff, 0x7e, 0x87, 0xad, 0xff, 0x69, 0x70, 0x96, 0xff, 0x65, 0x6a, 0x90, 0xff, 0x56, 0x64, 0x85, 0xff, 0x46, 0x59, 0x78, 0xff, 0x3f, 0x51, 0x71, 0xff, 0x42, 0x52, 0x72, 0xff, 0x41, 0x50, 0x70, 0xff, 0x3c, 0x48, 0x68, 0xff, 0x33, 0x3e, 0x63, 0xff, 0x17, 0x2d, 0x4f, 0xff, 0x16, 0x25, 0x37, 0xff, 0xc6, 0xae, 0xab, 0xff, 0xca, 0x9c, 0x8b, 0xff, 0x4a, 0x2e, 0x1d, 0xff, 0x2c, 0x18, 0x0f, 0xff, 0x38, 0x30, 0x39, 0xff, 0x3c, 0x45, 0x60, 0xff, 0x23, 0x2e, 0x4c, 0xff, 0x19, 0x21, 0x37, 0xff, 0x12, 0x16, 0x2a, 0xff, 0x0c, 0x0f, 0x23, 0xff, 0x09, 0x0f, 0x20, 0xff, 0x07, 0x0f, 0x20, 0xff, 0x09, 0x0f, 0x21, 0xff, 0x0a, 0x0f, 0x24, 0xff, 0x0b, 0x12, 0x24, 0xff, 0x0c, 0x15, 0x27, 0xff, 0x0b, 0x17, 0x2a, 0xff, 0x0b, 0x1b, 0x2e, 0xff, 0x0c, 0x1c, 0x2e, 0xff, 0x0d, 0x1a, 0x31, 0xff, 0x0f, 0x19, 0x31, 0xff, 0x10, 0x16, 0x2b, 0xff, 0x0d, 0x14, 0x26, 0xff, 0x0d, 0x14, 0x27, 0xff, 0x0d, 0x15, 0x28, 0xff, 0x0e, 0x15, 0x29, 0xff, 0x0e, 0x15, 0x29, 0xff, 0x10, 0x15, 0x28, 0xff, 0x0e, 0x13, 0x25, 0xff, 0x07, 0x0c, 0x19, 0xff, 0x05, 0x08, 0x0e, 0xff, 0x53, 0x51, 0x53, 0xff, 0x79, 0x6f, 0x70, 0xff, 0x6c, 0x63, 0x66, 0xff, 0x61, 0x5e, 0x62, 0xff, 0x4f, 0x4e, 0x4d, 0xff, 0x42, 0x42, 0x41, 0xff, 0x4b, 0x49, 0x4a, 0xff, 0x43, 0x3f, 0x45, 0xff, 0x3d, 0x3b, 0x3d, 0xff, 0x64, 0x58, 0x53, 0xff, 0x72, 0x5a, 0x56, 0xff, 0x4b, 0x40, 0x3f, 0xff, 0x18, 0x12, 0x10, 0xff, 0x76, 0x59, 0x48, 0xff, 0xaa, 0x85, 0x6b, 0xff, 0x8c, 0x73, 0x5a, 0xff, 0x73, 0x59, 0x45, 0xff, 0x72, 0x56, 0x46, 0xff, 0x8b, 0x69, 0x58, 0xff, 0x9f, 0x76, 0x61, 0xff, 0xa7, 0x7f, 0x6a, 0xff, 0x9f, 0x7a, 0x66, 0xff, 0x8c, 0x68, 0x55, 0xff, 0xb3, 0x8e, 0x7e, 0xff, 0xc5, 0xa3, 0x93, 0xff, 0xbd, 0xa1, 0x90, 0xff, 0xc4, 0xa7, 0x98, 0xff, 0xd6, 0xb7, 0xa8, 0xff, 0xdd, 0xc0, 0xb1, 0xff, 0xdc, 0xbf, 0xb0, 0xff, 0xe0, 0xc6, 0xb6, 0xff, 0xd8, 0xc0, 0xb0, 0xff, 0xd1, 0xb6, 0xa6, 0xff, 0xc9, 0xab, 0x9d, 0xff, 0xbb, 0x9e, 0x8f, 0xff, 0xc3, 0xa4, 0x95, 0xff, 0xc9, 0xa9, 0x9b, 0xff, 0xc9, 0xa9, 0x9a, 0xff, 0xd1, 0xb1, 0xa2, 0xff, 0xd9, 0xbc, 0xaa, 0xff, 0xdb, 0xbd, 0xac, 0xff, 0xd8, 0xbb, 0xa9, 0xff, 0xd0, 0xb2, 0xa1, 0xff, 0xc5, 0xa7, 0x95, 0xff, 0xb8, 0x98, 0x88, 0xef, 0xb6, 0x91, 0x6d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x9f, 0xa8, 0xa0, 0x96, 0xa5, 0xad, 0xff, 0x96, 0xa2, 0xa9, 0xff, 0x8c, 0x99, 0xa5, 0xff, 0x78, 0x8c, 0xa3, 0xff, 0x79, 0x90, 0xac, 0xff, 0x7e, 0x95, 0xac, 0xff, 0x60, 0x7c, 0x93, 0xff, 0x58, 0x77, 0x91, 0xff, 0x66, 0x84, 0x9e, 0xff, 0x6b, 0x86, 0x9b, 0xff, 0x7e, 0x92, 0x9f, 0xff, 0x91, 0x9f, 0xa4, 0xff, 0x90, 0xa1, 0xa3, 0xff, 0x86, 0x93, 0xa2, 0xff, 0x88, 0x94, 0xa5, 0xff, 0x91, 0xa4, 0xa3, 0xff, 0x91, 0xa1, 0xa6, 0xff, 0x80, 0x85, 0xab, 0xff, 0x77, 0x7c, 0xae, 0xff, 0x6b, 0x72, 0xa2, 0xff, 0x67, 0x70, 0x9d, 0xff, 0x5d, 0x68, 0x91, 0xff, 0x6f, 0x7a, 0xa0, 0xff, 0x6e, 0x77, 0x9e, 0xff, 0x5d, 0x6a, 0x91, 0xff, 0x54, 0x61, 0x8a, 0xff, 0x43, 0x4e, 0x77, 0xff, 0x34, 0x40, 0x67, 0xff, 0x34, 0x3f, 0x64, 0xff, 0x35, 0x40, 0x64, 0xff, 0x3e, 0x4b, 0x71, 0xff, 0x57, 0x63, 0x8a, 0xff, 0x56, 0x5e, 0x86, 0xff, 0x40, 0x48, 0x70, 0xff, 0x3e, 0x48, 0x6e, 0xff, 0x2f, 0x3c, 0x61, 0xff, 0x21, 0x31, 0x52, 0xff, 0x17, 0x28, 0x46, 0xff, 0x15, 0x25, 0x42, 0xff, 0x23, 0x33, 0x50, 0xff, 0x2a, 0x3c, 0x59, 0xff, 0x24, 0x38, 0x57, 0xff, 0x2c, 0x37, 0x55, 0xff, 0x2d, 0x3a, 0x58, 0xff, 0x1f, 0x33, 0x4e, 0xff, 0x38, 0x38, 0x47, 0xff, 0x63, 0x4f, 0x4b, 0xff, 0x4b, 0x2e, 0x1c, 0xff, 0x2f, 0x1a, 0x03, 0xff, 0x31, 0x1e, 0x1e, 0xff, 0x3c, 0x3c, 0x54, 0xff, 0x27, 0x33, 0x51, 0xff, 0x26, 0x24, 0x3c, 0xff, 0x16, 0x1c, 0x2f, 0xff, 0x07, 0x13, 0x24, 0xff, 0x09, 0x0f, 0x21, 0xff, 0x06, 0x0d, 0x20, 0xff, 0x06, 0x0d, 0x20, 0xff, 0x08, 0x0e, 0x22, 0xff, 0x08, 0x11, 0x25, 0xff, 0x0c, 0x15, 0x28, 0xff, 0x0c, 0x17, 0x29, 0xff, 0x0d, 0x18, 0x2b, 0xff, 0x0d, 0x19, 0x2b, 0xff, 0x0d, 0x17, 0x2b, 0xff, 0x10, 0x1a, 0x2d, 0xff, 0x0d, 0x16, 0x29, 0xff, 0x0b, 0x14, 0x26, 0xff, 0x0d, 0x15, 0x28, 0xff, 0x0e, 0x15, 0x27, 0xff, 0x0d, 0x15, 0x26, 0xff, 0x0d, 0x14, 0x26, 0xff, 0x0a, 0x13, 0x25, 0xff, 0x09, 0x11, 0x21, 0xff, 0x01, 0x01, 0x0b, 0xff, 0x23, 0x1d, 0x23, 0xff, 0x71, 0x6c, 0x6e, 0xff, 0x6b, 0x67, 0x68, 0xff, 0x5f, 0x5d, 0x5f, 0xff, 0x4d, 0x4b, 0x50, 0xff, 0x36, 0x37, 0x3a, 0xff, 0x38, 0x38, 0x3a, 0xff, 0x46, 0x45, 0x44, 0xff, 0x46, 0x44, 0x43, 0xff, 0x50, 0x46, 0x42, 0xff, 0x66, 0x57, 0x51, 0xff, 0x6e, 0x61, 0x5e, 0xff, 0x3a, 0x2c, 0x25, 0xff, 0x47, 0x33, 0x23, 0xff, 0xaa, 0x88, 0x71, 0xff, 0x85, 0x6d, 0x61, 0xff, 0x52, 0x46, 0x42, 0xff, 0x57, 0x3f, 0x32, 0xff, 0x7c, 0x5f, 0x4b, 0xff, 0xa0, 0x7e, 0x68, 0xff, 0xb7, 0x92, 0x7c, 0xff, 0x9d, 0x7c, 0x6f, 0xff, 0x70, 0x53, 0x4b, 0xff, 0x6f, 0x4f, 0x41, 0xff, 0xae, 0x8b, 0x7b, 0xff, 0xc5, 0xa2, 0x91, 0xff, 0xcc, 0xaa, 0x9b, 0xff, 0xd7, 0xb6, 0xa7, 0xff, 0xd4, 0xb4, 0xa4, 0xff, 0xd1, 0xb3, 0xa3, 0xff, 0xdc, 0xbe, 0xae, 0xff, 0xdb, 0xbe, 0xaf, 0xff, 0xd2, 0xb6, 0xa7, 0xff, 0xc3, 0xa7, 0x98, 0xff, 0xbc, 0x9f, 0x91, 0xff, 0xc0, 0xa2, 0x94, 0xff, 0xd0, 0xb1, 0xa2, 0xff, 0xcf, 0xb1, 0xa0, 0xff, 0xcd, 0xac, 0x9c, 0xff, 0xd1, 0xb3, 0xa2, 0xff, 0xd7, 0xbe, 0xa9, 0xff, 0xdd, 0xbf, 0xad, 0xff, 0xd8, 0xb7, 0xa6, 0xff, 0xc5, 0xa6, 0x95, 0xff, 0xb0, 0x95, 0x84, 0xff, 0xb0, 0x94, 0x85, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xa1, 0xa8, 0x4a, 0x93, 0xa3, 0xab, 0xff, 0x97, 0xa4, 0xac, 0xff, 0x88, 0x96, 0xa4, 0xff, 0x6b, 0x83, 0xa2, 0xff, 0x6a, 0x86, 0xa8, 0xff, 0x72, 0x8a, 0xa1, 0xff, 0x5f, 0x7a, 0x93, 0xff, 0x54, 0x71, 0x90, 0xff, 0x69, 0x85, 0xa3, 0xff, 0x7a, 0x92, 0xaa, 0xff, 0x89, 0x98, 0xa6, 0xff, 0x98, 0xa1, 0xa5, 0xff, 0x94, 0xa3, 0xa6, 0xff, 0x91, 0x9d, 0xa6, 0xff, 0x93, 0x9b, 0xa3, 0xff, 0x97, 0xa3, 0xa5, 0xff, 0x83, 0x90, 0xa2, 0xff, 0x74, 0x7e, 0xaf, 0xff, 0x6e, 0x75, 0xa8, 0xff, 0x73, 0x78, 0xa5, 0xff, 0x6e, 0x74, 0x9f, 0xff, 0x67, 0x6d, 0x98, 0xff, 0x71, 0x77, 0xa0, 0xff, 0x6a, 0x72, 0x98, 0xff, 0x51, 0x5f, 0x86, 0xff, 0x44, 0x53, 0x7b, 0xff, 0x35, 0x42, 0x68, 0xff, 0x33, 0x3f, 0x64, 0xff, 0x3b, 0x46, 0x6a, 0xff, 0x40, 0x48, 0x6d, 0xff, 0x4e, 0x5d, 0x82, 0xff, 0x46, 0x55, 0x7b, 0xff, 0x38, 0x41, 0x68, 0xff, 0x3b, 0x43, 0x6a, 0xff, 0x24, 0x30, 0x53, 0xff, 0x0b, 0x1d, 0x3e, 0xff, 0x14, 0x24, 0x44, 0xff, 0x1c, 0x27, 0x45, 0xff, 0x1a, 0x24, 0x3f, 0xff, 0x16, 0x23, 0x3d, 0xff, 0x17, 0x28, 0x42, 0xff, 0x13, 0x29, 0x44, 0xff, 0x19, 0x28, 0x41, 0xff, 0x1b, 0x28, 0x46, 0xff, 0x12, 0x28, 0x4e, 0xff, 0x14, 0x29, 0x4a, 0xff, 0x28, 0x2b, 0x36, 0xff, 0x42, 0x29, 0x1c, 0xff, 0x2a, 0x15, 0x00, 0xff, 0x44, 0x2d, 0x28, 0xff, 0x56, 0x51, 0x65, 0xff, 0x26, 0x36, 0x52, 0xff, 0x29, 0x25, 0x3f, 0xff, 0x13, 0x1e, 0x31, 0xff, 0x06, 0x17, 0x27, 0xff, 0x0a, 0x0f, 0x20, 0xff, 0x08, 0x0e, 0x20, 0xff, 0x07, 0x0e, 0x21, 0xff, 0x08, 0x10, 0x23, 0xff, 0x09, 0x12, 0x24, 0xff, 0x0a, 0x13, 0x25, 0xff, 0x0c, 0x17, 0x28, 0xff, 0x0e, 0x17, 0x29, 0xff, 0x0f, 0x18, 0x2a, 0xff, 0x0e, 0x18, 0x29, 0xff, 0x0d, 0x17, 0x28, 0xff, 0x0b, 0x16, 0x27, 0xff, 0x0b, 0x15, 0x27, 0xff, 0x0b, 0x13, 0x26, 0xff, 0x0d, 0x14, 0x25, 0xff, 0x0d, 0x15, 0x25, 0xff, 0x0c, 0x12, 0x23, 0xff, 0x05, 0x10, 0x21, 0xff, 0x04, 0x0f, 0x1d, 0xff, 0x00, 0x00, 0x06, 0xff, 0x43, 0x3a, 0x3f, 0xff, 0x7b, 0x75, 0x77, 0xff, 0x61, 0x60, 0x61, 0xff, 0x47, 0x47, 0x49, 0xff, 0x31, 0x31, 0x35, 0xff, 0x2c, 0x2e, 0x33, 0xff, 0x3a, 0x3d, 0x41, 0xff, 0x3e, 0x3e, 0x3f, 0xff, 0x42, 0x41, 0x3f, 0xff, 0x65, 0x56, 0x4e, 0xff, 0x6c, 0x5c, 0x57, 0xff, 0x53, 0x4e, 0x50, 0xff, 0x32, 0x24, 0x1b, 0xff, 0x64, 0x49, 0x36, 0xff, 0x80, 0x63, 0x50, 0xff, 0x4c, 0x39, 0x36, 0xff, 0x30, 0x20, 0x22, 0xff, 0x57, 0x3a, 0x2b, 0xff, 0x96, 0x71, 0x58, 0xff, 0xc0, 0x9b, 0x81, 0xff, 0xb9, 0x97, 0x80, 0xff, 0x7a, 0x5f, 0x56, 0xff, 0x54, 0x3d, 0x3b, 0xff, 0x75, 0x57, 0x4d, 0xff, 0xb5, 0x93, 0x84, 0xff, 0xbf, 0x9b, 0x8b, 0xff, 0xd5, 0xaf, 0xa1, 0xff, 0xd0, 0xad, 0x9e, 0xff, 0xcc, 0xab, 0x9a, 0xff, 0xd6, 0xb6, 0xa6, 0xff, 0xdd, 0xbf, 0xae, 0xff, 0xd4, 0xb4, 0xa5, 0xff, 0xc9, 0xab, 0x9c, 0xff, 0xbe, 0xa1, 0x92, 0xff, 0xbc, 0x9f, 0x90, 0xff, 0xca, 0xab, 0x9d, 0xff, 0xc7, 0xa9, 0x99, 0xff, 0xc7, 0xa8, 0x97, 0xff, 0xd2, 0xaf, 0xa0, 0xff, 0xd8, 0xba, 0xa7, 0xff, 0xdb, 0xc0, 0xab, 0xff, 0xdc, 0xbd, 0xab, 0xff, 0xcb, 0xa9, 0x9b, 0xff, 0xaf, 0x90, 0x83, 0xff, 0x99, 0x7f, 0x73, 0xff, 0x94, 0x7c, 0x6e, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0xbf, 0x04, 0x84, 0x98, 0xa5, 0xe7, 0x8d, 0x9b, 0xa6, 0xff, 0x89, 0x96, 0xa5, 0xff, 0x6a, 0x7f, 0x98, 0xff, 0x5e, 0x78, 0x95, 0xff, 0x74, 0x8c, 0xa2, 0xff, 0x89, 0x9b, 0xb2, 0xff, 0x84, 0x96, 0xb0, 0xff, 0x7b, 0x8f, 0xa9, 0xff, 0x7f, 0x8f, 0xa4, 0xff, 0x92, 0x9c, 0xab, 0xff, 0xa0, 0xa5, 0xac, 0xff, 0x98, 0xa0, 0xad, 0xff, 0x93, 0xa4, 0xa2, 0xff, 0x99, 0xa9, 0xa3, 0xff, 0x8c, 0x93, 0xad, 0xff, 0x7d, 0x81, 0xaf, 0xff, 0x75, 0x7f, 0xa6, 0xff, 0x74, 0x7b, 0xa6, 0xff, 0x76, 0x7c, 0xaa, 0xff, 0x63, 0x6a, 0x96, 0xff, 0x62, 0x69, 0x92, 0xff, 0x68, 0x70, 0x97, 0xff, 0x5e, 0x67, 0x8d, 0xff, 0x3f, 0x4a, 0x72, 0xff, 0x34, 0x42, 0x69, 0xff, 0x36, 0x43, 0x69, 0xff, 0x3c, 0x47, 0x6e, 0xff, 0x43, 0x4e, 0x74, 0xff, 0x52, 0x5d, 0x81, 0xff, 0x4f, 0x5d, 0x83, 0xff, 0x3b, 0x49, 0x6f, 0xff, 0x3a, 0x44, 0x69, 0xff, 0x28, 0x32, 0x52, 0xff, 0x0c, 0x1a, 0x37, 0xff, 0x09, 0x1b, 0x36, 0xff, 0x0d, 0x1e, 0x3c, 0xff, 0x19, 0x26, 0x44, 0xff, 0x25, 0x31, 0x4b, 0xff, 0x1f, 0x2c, 0x43, 0xff, 0x1e, 0x2e, 0x47, 0xff, 0x1d, 0x31, 0x4a, 0xff, 0x18, 0x2d, 0x49, 0xff, 0x0f, 0x2a, 0x4c, 0xff, 0x09, 0x27, 0x4d, 0xff, 0x14, 0x29, 0x4a, 0xff, 0x23, 0x27, 0x38, 0xff, 0x2f, 0x1f, 0x1f, 0xff, 0x1b, 0x0a, 0x00, 0xff, 0x63, 0x49, 0x40, 0xff, 0x87, 0x7b, 0x88, 0xff, 0x25, 0x33, 0x4b, 0xff, 0x2c, 0x2c, 0x48, 0xff, 0x16, 0x1f, 0x35, 0xff, 0x0e, 0x1a, 0x2b, 0xff, 0x0d, 0x12, 0x23, 0xff, 0x07, 0x0f, 0x1f, 0xff, 0x09, 0x0f, 0x20, 0xff, 0x0b, 0x10, 0x21, 0xff, 0x0c, 0x11, 0x22, 0xff, 0x09, 0x12, 0x23, 0xff, 0x09, 0x15, 0x27, 0xff, 0x0b, 0x15, 0x27, 0xff, 0x0d, 0x17, 0x29, 0xff, 0x0d, 0x17, 0x29, 0xff, 0x0c, 0x17, 0x29, 0xff, 0x0c, 0x15, 0x28, 0xff, 0x0c, 0x13, 0x27, 0xff, 0x0b, 0x12, 0x25, 0xff, 0x0b, 0x13, 0x24, 0xff, 0x0a, 0x11, 0x22, 0xff, 0x09, 0x10, 0x20, 0xff, 0x06, 0x0f, 0x1e, 0xff, 0x02, 0x07, 0x15, 0xff, 0x0c, 0x0c, 0x15, 0xff, 0x62, 0x5c, 0x62, 0xff, 0x6d, 0x67, 0x6b, 0xff, 0x48, 0x46, 0x49, 0xff, 0x2c, 0x2c, 0x30, 0xff, 0x27, 0x29, 0x2e, 0xff, 0x32, 0x35, 0x3b, 0xff, 0x3a, 0x3d, 0x42, 0xff, 0x38, 0x37, 0x39, 0xff, 0x3d, 0x39, 0x3b, 0xff, 0x69, 0x5b, 0x55, 0xff, 0x6e, 0x5d, 0x57, 0xff, 0x41, 0x3b, 0x3c, 0xff, 0x21, 0x16, 0x13, 0xff, 0x59, 0x47, 0x3b, 0xff, 0x52, 0x40, 0x38, 0xff, 0x39, 0x24, 0x1e, 0xff, 0x5b, 0x3e, 0x31, 0xff, 0x9b, 0x78, 0x65, 0xff, 0xc2, 0x9b, 0x81, 0xff, 0xbd, 0x97, 0x82, 0xff, 0x8b, 0x6a, 0x5b, 0xff, 0x5f, 0x44, 0x3c, 0xff, 0x53, 0x3a, 0x35, 0xff, 0x92, 0x74, 0x69, 0xff, 0xb4, 0x91, 0x83, 0xff, 0xa8, 0x84, 0x74, 0xff, 0xb3, 0x8f, 0x80, 0xff, 0xbb, 0x99, 0x89, 0xff, 0xd8, 0xb8, 0xa5, 0xff, 0xdd, 0xbc, 0xab, 0xff, 0xd3, 0xb5, 0xa4, 0xff, 0xc6, 0xa8, 0x98, 0xff, 0xc2, 0xa4, 0x95, 0xff, 0xbc, 0x9e, 0x90, 0xff, 0xbd, 0x9e, 0x8f, 0xff, 0xbc, 0x9e, 0x8e, 0xff, 0xc0, 0xa1, 0x91, 0xff, 0xc7, 0xa6, 0x96, 0xff, 0xd0, 0xb0, 0x9f, 0xff, 0xdf, 0xbf, 0xaa, 0xff, 0xe4, 0xc4, 0xae, 0xff, 0xd0, 0xb0, 0xa3, 0xff, 0xaa, 0x8e, 0x86, 0xff, 0x99, 0x7d, 0x78, 0xff, 0x9a, 0x82, 0x7c, 0xe7, 0x99, 0x99, 0x66, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x8f, 0xa4, 0x87, 0x86, 0x95, 0xa3, 0xff, 0x88, 0x94, 0xa2, 0xff, 0x72, 0x86, 0x9c, 0xff, 0x65, 0x7f, 0x98, 0xff, 0x7c, 0x93, 0xa6, 0xff, 0x84, 0x98, 0xa8, 0xff, 0x6f, 0x85, 0x97, 0xff, 0x69, 0x82, 0x96, 0xff, 0x6d, 0x83, 0x97, 0xff, 0x8b, 0x9b, 0xa8, 0xff, 0x9b, 0xa7, 0xae, 0xff, 0x9a, 0xa3, 0xb0, 0xff, 0x9b, 0xa8, 0xa7, 0xff, 0x90, 0xa1, 0x9f, 0xff, 0x7f, 0x84, 0xad, 0xff, 0x7d, 0x7d, 0xbb, 0xff, 0x74, 0x7c, 0xa2, 0xff, 0x7c, 0x84, 0xab, 0xff, 0x6a, 0x70, 0x9e, 0xff, 0x5b, 0x62, 0x8c, 0xff, 0x62, 0x6b, 0x92, 0xff, 0x5c, 0x65, 0x8b, 0xff, 0x42, 0x4a, 0x6f, 0xff, 0x31, 0x3c, 0x62, 0xff, 0x38, 0x44, 0x6a, 0xff, 0x3c, 0x48, 0x6e, 0xff, 0x45, 0x51, 0x77, 0xff, 0x55, 0x62, 0x88, 0xff, 0x53, 0x5e, 0x84, 0xff, 0x3f, 0x4d, 0x76, 0xff, 0x38, 0x45, 0x6c, 0xff, 0x26, 0x31, 0x52, 0xff, 0x11, 0x1c, 0x39, 0xff, 0x09, 0x17, 0x32, 0xff, 0x0c, 0x1f, 0x3a, 0xff, 0x1a, 0x2a, 0x4a, 0xff, 0x2b, 0x38, 0x57, 0xff, 0x3a, 0x46, 0x60, 0xff, 0x30, 0x3e, 0x55, 0xff, 0x15, 0x23, 0x3a, 0xff, 0x11, 0x20, 0x39, 0xff, 0x13, 0x26, 0x3e, 0xff, 0x13, 0x2c, 0x45, 0xff, 0x10, 0x2b, 0x47, 0xff, 0x15, 0x27, 0x3f, 0xff, 0x23, 0x22, 0x2c, 0xff, 0x2d, 0x19, 0x16, 0xff, 0x1a, 0x08, 0x00, 0xff, 0x76, 0x57, 0x4c, 0xff, 0x87, 0x73, 0x74, 0xff, 0x20, 0x2b, 0x3f, 0xff, 0x35, 0x37, 0x59, 0xff, 0x24, 0x2b, 0x43, 0xff, 0x13, 0x1e, 0x30, 0xff, 0x0e, 0x13, 0x26, 0xff, 0x0a, 0x11, 0x23, 0xff, 0x0a, 0x10, 0x22, 0xff, 0x0c, 0x10, 0x21, 0xff, 0x0d, 0x10, 0x22, 0xff, 0x0b, 0x11, 0x24, 0xff, 0x0b, 0x14, 0x27, 0xff, 0x0d, 0x15, 0x27, 0xff, 0x0e, 0x16, 0x29, 0xff, 0x0f, 0x17, 0x29, 0xff, 0x0d, 0x16, 0x29, 0xff, 0x0c, 0x13, 0x26, 0xff, 0x0b, 0x13, 0x24, 0xff, 0x0b, 0x13, 0x24, 0xff, 0x0c, 0x13, 0x24, 0xff, 0x0b, 0x12, 0x20, 0xff, 0x09, 0x10, 0x1e, 0xff, 0x0c, 0x0f, 0x1e, 0xff, 0x00, 0x00, 0x0a, 0xff, 0x2b, 0x2b, 0x34, 0xff, 0x75, 0x73, 0x77, 0xff, 0x51, 0x50, 0x54, 0xff, 0x2d, 0x2d, 0x33, 0xff, 0x2c, 0x2c, 0x30, 0xff, 0x38, 0x39, 0x3d, 0xff, 0x3d, 0x3f, 0x43, 0xff, 0x3e, 0x3c, 0x41, 0xff, 0x34, 0x30, 0x33, 0xff, 0x3b, 0x35, 0x36, 0xff, 0x68, 0x58, 0x52, 0xff, 0x6f, 0x5f, 0x58, 0xff, 0x2f, 0x29, 0x2b, 0xff, 0x1d, 0x16, 0x14, 0xff, 0x55, 0x46, 0x3d, 0xff, 0x45, 0x38, 0x37, 0xff, 0x5c, 0x45, 0x3e, 0xff, 0x94, 0x6f, 0x5a, 0xff, 0xb2, 0x8c, 0x74, 0xff, 0xb2, 0x89, 0x6f, 0xff, 0x9b, 0x76, 0x64, 0xff, 0x6f, 0x52, 0x4a, 0xff, 0x5c, 0x43, 0x3c, 0xff, 0x61, 0x47, 0x3e, 0xff, 0x9a, 0x7b, 0x71, 0xff, 0xa4, 0x81, 0x75, 0xff, 0xaf, 0x89, 0x7c, 0xff, 0xa4, 0x80, 0x70, 0xff, 0xc0, 0x9f, 0x8c, 0xff, 0xd0, 0xb0, 0x9d, 0xff, 0xde, 0xbe, 0xab, 0xff, 0xd6, 0xb5, 0xa5, 0xff, 0xc5, 0xa7, 0x96, 0xff, 0xbc, 0x9e, 0x8d, 0xff, 0xb9, 0x9b, 0x8a, 0xff, 0xbd, 0x9f, 0x8e, 0xff, 0xc3, 0xa5, 0x94, 0xff, 0xc5, 0xa4, 0x93, 0xff, 0xcb, 0xab, 0x98, 0xff, 0xd2, 0xb3, 0xa0, 0xff, 0xe2, 0xbf, 0xa9, 0xff, 0xd9, 0xb6, 0xa1, 0xff, 0xb9, 0x9e, 0x95, 0xff, 0x90, 0x7b, 0x7b, 0xff, 0x7d, 0x66, 0x66, 0xff, 0x88, 0x6f, 0x6b, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x7f, 0x9d, 0x22, 0x80, 0x92, 0xa3, 0xfe, 0x8a, 0x96, 0xa3, 0xff, 0x85, 0x97, 0xaa, 0xff, 0x76, 0x8e, 0xa5, 0xff, 0x76, 0x8c, 0x9d, 0xff, 0x7a, 0x8e, 0x98, 0xff, 0x6b, 0x83, 0x90, 0xff, 0x75, 0x8f, 0xa0, 0xff, 0x7b, 0x94, 0xa6, 0xff, 0x8c, 0xa2, 0xac, 0xff, 0x93, 0xa4, 0xa9, 0xff, 0x9a, 0xa4, 0xab, 0xff, 0x9c, 0xa6, 0xaf, 0xff, 0x7f, 0x89, 0x9f, 0xff, 0x7c, 0x81, 0xae, 0xff, 0x7e, 0x82, 0xb6, 0xff, 0x84, 0x89, 0xb1, 0xff, 0x7f, 0x86, 0xae, 0xff, 0x57, 0x5e, 0x8a, 0xff, 0x5c, 0x64, 0x8d, 0xff, 0x6c, 0x75, 0x9b, 0xff, 0x4f, 0x58, 0x7e, 0xff, 0x37, 0x3f, 0x64, 0xff, 0x3b, 0x46, 0x6a, 0xff, 0x3f, 0x4a, 0x6f, 0xff, 0x4c, 0x57, 0x7d, 0xff, 0x5e, 0x6b, 0x91, 0xff, 0x4f, 0x5d, 0x83, 0xff, 0x3f, 0x4c, 0x74, 0xff, 0x35, 0x43, 0x6c, 0xff, 0x26, 0x34, 0x59, 0xff, 0x1a, 0x25, 0x44, 0xff, 0x17, 0x22, 0x3f, 0xff, 0x1b, 0x28, 0x47, 0xff, 0x30, 0x40, 0x64, 0xff, 0x43, 0x53, 0x78, 0xff, 0x52, 0x60, 0x82, 0xff, 0x52, 0x5c, 0x7b, 0xff, 0x3f, 0x4a, 0x65, 0xff, 0x16, 0x1f, 0x3a, 0xff, 0x12, 0x1c, 0x36, 0xff, 0x16, 0x24, 0x3d, 0xff, 0x0f, 0x1c, 0x33, 0xff, 0x05, 0x15, 0x2c, 0xff, 0x11, 0x1a, 0x29, 0xff, 0x28, 0x21, 0x21, 0xff, 0x31, 0x19, 0x0d, 0xff, 0x20, 0x0b, 0x00, 0xff, 0x85, 0x62, 0x54, 0xff, 0x8c, 0x72, 0x66, 0xff, 0x17, 0x21, 0x31, 0xff, 0x37, 0x3c, 0x62, 0xff, 0x2a, 0x31, 0x4a, 0xff, 0x1e, 0x2b, 0x3f, 0xff, 0x14, 0x1c, 0x35, 0xff, 0x11, 0x18, 0x2e, 0xff, 0x0f, 0x16, 0x2a, 0xff, 0x0d, 0x13, 0x26, 0xff, 0x10, 0x13, 0x25, 0xff, 0x0f, 0x14, 0x27, 0xff, 0x0d, 0x14, 0x27, 0xff, 0x0f, 0x15, 0x28, 0xff, 0x0f, 0x16, 0x29, 0xff, 0x0f, 0x15, 0x29, 0xff, 0x0e, 0x14, 0x29, 0xff, 0x0d, 0x14, 0x26, 0xff, 0x0c, 0x13, 0x24, 0xff, 0x0a, 0x11, 0x22, 0xff, 0x0b, 0x12, 0x21, 0xff, 0x0d, 0x12, 0x21, 0xff, 0x0a, 0x11, 0x1e, 0xff, 0x0b, 0x0c, 0x1a, 0xff, 0x05, 0x02, 0x0e, 0xff, 0x54, 0x54, 0x5c, 0xff, 0x62, 0x64, 0x68, 0xff, 0x32, 0x34, 0x38, 0xff, 0x29, 0x2a, 0x31, 0xff, 0x3f, 0x3d, 0x41, 0xff, 0x50, 0x4e, 0x4e, 0xff, 0x56, 0x54, 0x56, 0xff, 0x4d, 0x49, 0x4b, 0xff, 0x46, 0x3f, 0x3e, 0xff, 0x5f, 0x53, 0x51, 0xff, 0x68, 0x55, 0x4e, 0xff, 0x63, 0x55, 0x50, 0xff, 0x23, 0x1f, 0x22, 0xff, 0x1d, 0x15, 0x14, 0xff, 0x43, 0x33, 0x2b, 0xff, 0x4d, 0x3d, 0x3c, 0xff, 0x6e, 0x59, 0x51, 0xff, 0x89, 0x68, 0x55, 0xff, 0x91, 0x6d, 0x57, 0xff, 0x9a, 0x74, 0x5d, 0xff, 0x7f, 0x5e, 0x4e, 0xff, 0x64, 0x4b, 0x47, 0xff, 0x53, 0x3d, 0x38, 0xff, 0x6a, 0x4f, 0x44, 0xff, 0x93, 0x74, 0x6b, 0xff, 0xaa, 0x86, 0x7d, 0xff, 0xa0, 0x7b, 0x6e, 0xff, 0xb0, 0x8c, 0x7b, 0xff, 0xcd, 0xac, 0x98, 0xff, 0xdf, 0xbe, 0xaa, 0xff, 0xe3, 0xc2, 0xaf, 0xff, 0xbf, 0xa0, 0x8c, 0xff, 0xc2, 0xa1, 0x90, 0xff, 0xc0, 0xa0, 0x90, 0xff, 0xbe, 0xa1, 0x8f, 0xff, 0xc2, 0xa2, 0x91, 0xff, 0xc1, 0x9f, 0x90, 0xff, 0xba, 0x9a, 0x87, 0xff, 0xc0, 0xa0, 0x8d, 0xff, 0xd8, 0xb8, 0xa5, 0xff, 0xdc, 0xb8, 0xa2, 0xff, 0xd2, 0xae, 0x9c, 0xff, 0x9e, 0x8a, 0x84, 0xff, 0x71, 0x65, 0x67, 0xff, 0x6b, 0x59, 0x59, 0xfe, 0x83, 0x5e, 0x57, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x90, 0xa4, 0xb4, 0x8f, 0x9a, 0xa9, 0xff, 0x85, 0x95, 0xa6, 0xff, 0x7d, 0x94, 0xa7, 0xff, 0x83, 0x99, 0xa7, 0xff, 0x91, 0x9d, 0xa3, 0xff, 0x97, 0xa1, 0xaa, 0xff, 0x91, 0xa1, 0xb1, 0xff, 0x8b, 0x9c, 0xad, 0xff, 0x94, 0xa2, 0xaf, 0xff, 0x97, 0xa1, 0xa7, 0xff, 0xa1, 0xaa, 0xa6, 0xff, 0x8a, 0x90, 0xa6, 0xff, 0x75, 0x76, 0xaa, 0xff, 0x81, 0x8a, 0xb2, 0xff, 0x83, 0x8d, 0xae, 0xff, 0x83, 0x86, 0xb3, 0xff, 0x62, 0x67, 0x95, 0xff, 0x4d, 0x55, 0x7f, 0xff, 0x6e, 0x77, 0x9e, 0xff, 0x67, 0x70, 0x96, 0xff, 0x49, 0x52, 0x77, 0xff, 0x3d, 0x46, 0x6a, 0xff, 0x42, 0x4a, 0x6f, 0xff, 0x53, 0x5c, 0x81, 0xff, 0x63, 0x6f, 0x93, 0xff, 0x55, 0x61, 0x88, 0xff, 0x39, 0x46, 0x6e, 0xff, 0x31, 0x41, 0x68, 0xff, 0x21, 0x31, 0x58, 0xff, 0x1e, 0x2d, 0x50, 0xff, 0x26, 0x32, 0x4e, 0xff, 0x31, 0x3b, 0x57, 0xff, 0x4b, 0x55, 0x7b, 0xff, 0x51, 0x5b, 0x8c, 0xff, 0x4a, 0x58, 0x86, 0xff, 0x4e, 0x5b, 0x82, 0xff, 0x40, 0x47, 0x6a, 0xff, 0x32, 0x3b, 0x58, 0xff, 0x2e, 0x3a, 0x55, 0xff, 0x3b, 0x46, 0x62, 0xff, 0x3d, 0x4a, 0x6a, 0xff, 0x33, 0x40, 0x60, 0xff, 0x23, 0x30, 0x4c, 0xff, 0x20, 0x25, 0x35, 0xff, 0x24, 0x1b, 0x1c, 0xff, 0x29, 0x14, 0x07, 0xff, 0x20, 0x0f, 0x04, 0xff, 0x8e, 0x66, 0x58, 0xff, 0xa8, 0x88, 0x73, 0xff, 0x10, 0x1c, 0x28, 0xff, 0x2d, 0x33, 0x5d, 0xff, 0x2f, 0x33, 0x4e, 0xff, 0x1f, 0x2d, 0x44, 0xff, 0x19, 0x26, 0x44, 0xff, 0x16, 0x20, 0x3b, 0xff, 0x12, 0x19, 0x32, 0xff, 0x0e, 0x14, 0x2a, 0xff, 0x0d, 0x12, 0x28, 0xff, 0x0d, 0x14, 0x27, 0xff, 0x0c, 0x14, 0x27, 0xff, 0x0d, 0x14, 0x27, 0xff, 0x0d, 0x14, 0x27, 0xff, 0x0c, 0x13, 0x27, 0xff, 0x0a, 0x11, 0x25, 0xff, 0x0b, 0x12, 0x24, 0xff, 0x0c, 0x13, 0x24, 0xff, 0x0b, 0x11, 0x22, 0xff, 0x0c, 0x11, 0x20, 0xff, 0x0c, 0x10, 0x1f, 0xff, 0x09, 0x11, 0x1f, 0xff, 0x00, 0x00, 0x08, 0xff, 0x2b, 0x24, 0x30, 0xff, 0x6d, 0x6d, 0x75, 0xff, 0x3a, 0x3e, 0x41, 0xff, 0x26, 0x29, 0x2d, 0xff, 0x33, 0x38, 0x40, 0xff, 0x4f, 0x4e, 0x50, 0xff, 0x62, 0x5d, 0x58, 0xff, 0x63, 0x5d, 0x5e, 0xff, 0x5c, 0x55, 0x55, 0xff, 0x5f, 0x53, 0x50, 0xff, 0x80, 0x6d, 0x65, 0xff, 0x81, 0x6c, 0x63, 0xff, 0x55, 0x48, 0x46, 0xff, 0x16, 0x13, 0x16, 0xff, 0x22, 0x19, 0x16, 0xff, 0x40, 0x2e, 0x23, 0xff, 0x4d, 0x3a, 0x32, 0xff, 0x4c, 0x3a, 0x34, 0xff, 0x5e, 0x47, 0x39, 0xff, 0x7c, 0x5e, 0x4b, 0xff, 0x7f, 0x5f, 0x49, 0xff, 0x63, 0x47, 0x38, 0xff, 0x50, 0x3c, 0x3c, 0xff, 0x55, 0x40, 0x3c, 0xff, 0x75, 0x59, 0x4c, 0xff, 0x86, 0x68, 0x60, 0xff, 0x9b, 0x77, 0x70, 0xff, 0xad, 0x86, 0x7b, 0xff, 0xc3, 0x9f, 0x8b, 0xff, 0xcd, 0xae, 0x98, 0xff, 0xdc, 0xbb, 0xa6, 0xff, 0xc1, 0x9f, 0x8b, 0xff, 0xc3, 0xa3, 0x8e, 0xff, 0xd8, 0xb7, 0xa5, 0xff, 0xcb, 0xaa, 0x9a, 0xff, 0xc4, 0xa3, 0x93, 0xff, 0xbf, 0x9d, 0x8d, 0xff, 0xb0, 0x90, 0x7e, 0xff, 0xba, 0x9b, 0x87, 0xff, 0xc7, 0xa7, 0x93, 0xff, 0xd3, 0xb3, 0x9f, 0xff, 0xd9, 0xb7, 0xa2, 0xff, 0xc2, 0xa2, 0x90, 0xff, 0x86, 0x75, 0x71, 0xff, 0x59, 0x53, 0x56, 0xff, 0x6b, 0x5e, 0x5b, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x93, 0xa3, 0x40, 0x8e, 0x9d, 0xa8, 0xff, 0x7b, 0x8e, 0xa2, 0xff, 0x72, 0x8c, 0xa3, 0xff, 0x81, 0x97, 0xac, 0xff, 0x87, 0x99, 0xa4, 0xff, 0x7f, 0x91, 0xa0, 0xff, 0x7b, 0x8f, 0xa6, 0xff, 0x87, 0x9a, 0xa9, 0xff, 0x98, 0xa5, 0xa8, 0xff, 0xa6, 0xaa, 0xa9, 0xff, 0x98, 0xa2, 0xac, 0xff, 0x72, 0x7a, 0x9c, 0xff, 0x78, 0x7d, 0xab, 0xff, 0x7f, 0x84, 0xad, 0xff, 0x7e, 0x84, 0xa9, 0xff, 0x6e, 0x70, 0x9e, 0xff, 0x4e, 0x53, 0x80, 0xff, 0x68, 0x70, 0x9b, 0xff, 0x74, 0x7b, 0xa5, 0xff, 0x58, 0x60, 0x88, 0xff, 0x43, 0x4c, 0x72, 0xff, 0x3c, 0x46, 0x6e, 0xff, 0x52, 0x5b, 0x81, 0xff, 0x65, 0x6f, 0x95, 0xff, 0x4f, 0x5a, 0x80, 0xff, 0x30, 0x3b, 0x62, 0xff, 0x2e, 0x3a, 0x60, 0xff, 0x27, 0x34, 0x5a, 0xff, 0x27, 0x35, 0x59, 0xff, 0x31, 0x3d, 0x62, 0xff, 0x3c, 0x47, 0x6d, 0xff, 0x4d, 0x58, 0x80, 0xff, 0x53, 0x60, 0x89, 0xff, 0x3a, 0x4a, 0x75, 0xff, 0x31, 0x43, 0x69, 0xff, 0x28, 0x39, 0x5b, 0xff, 0x19, 0x27, 0x48, 0xff, 0x16, 0x24, 0x41, 0xff, 0x1a, 0x27, 0x43, 0xff, 0x23, 0x2f, 0x4b, 0xff, 0x26, 0x35, 0x4e, 0xff, 0x22, 0x36, 0x51, 0xff, 0x20, 0x36, 0x55, 0xff, 0x2b, 0x39, 0x52, 0xff, 0x25, 0x20, 0x2a, 0xff, 0x27, 0x0f, 0x09, 0xff, 0x31, 0x18, 0x0b, 0xff, 0x8d, 0x6b, 0x5b, 0xff, 0xac, 0x8d, 0x7f, 0xff, 0x2c, 0x29, 0x33, 0xff, 0x22, 0x2b, 0x49, 0xff, 0x2d, 0x3a, 0x56, 0xff, 0x1f, 0x29, 0x42, 0xff, 0x22, 0x28, 0x43, 0xff, 0x1c, 0x25, 0x3f, 0xff, 0x13, 0x1c, 0x36, 0xff, 0x0d, 0x17, 0x2c, 0xff, 0x0c, 0x15, 0x28, 0xff, 0x0d, 0x14, 0x26, 0xff, 0x0d, 0x14, 0x25, 0xff, 0x0b, 0x12, 0x24, 0xff, 0x0b, 0x12, 0x24, 0xff, 0x0b, 0x12, 0x24, 0xff, 0x0b, 0x12, 0x23, 0xff, 0x0b, 0x10, 0x22, 0xff, 0x0b, 0x10, 0x22, 0xff, 0x09, 0x12, 0x22, 0xff, 0x07, 0x12, 0x1f, 0xff, 0x0a, 0x10, 0x1d, 0xff, 0x06, 0x0a, 0x16, 0xff, 0x08, 0x03, 0x0d, 0xff, 0x64, 0x5c, 0x66, 0xff, 0x55, 0x58, 0x60, 0xff, 0x22, 0x29, 0x2d, 0xff, 0x2f, 0x33, 0x37, 0xff, 0x48, 0x46, 0x4e, 0xff, 0x47, 0x42, 0x46, 0xff, 0x49, 0x45, 0x44, 0xff, 0x5a, 0x54, 0x55, 0xff, 0x63, 0x58, 0x59, 0xff, 0x66, 0x58, 0x55, 0xff, 0x6c, 0x59, 0x54, 0xff, 0x69, 0x58, 0x52, 0xff, 0x3f, 0x34, 0x2f, 0xff, 0x15, 0x0e, 0x0a, 0xff, 0x3b, 0x30, 0x29, 0xff, 0x50, 0x3e, 0x33, 0xff, 0x4a, 0x33, 0x2a, 0xff, 0x64, 0x47, 0x39, 0xff, 0x8e, 0x6e, 0x58, 0xff, 0x9f, 0x7d, 0x6c, 0xff, 0x90, 0x71, 0x63, 0xff, 0x5e, 0x44, 0x38, 0xff, 0x4f, 0x39, 0x32, 0xff, 0x47, 0x39, 0x30, 0xff, 0x52, 0x3e, 0x35, 0xff, 0x96, 0x6e, 0x69, 0xff, 0x9e, 0x76, 0x70, 0xff, 0x91, 0x73, 0x67, 0xff, 0xa9, 0x87, 0x78, 0xff, 0xc6, 0x9f, 0x8f, 0xff, 0xcf, 0xa9, 0x99, 0xff, 0xc2, 0x9f, 0x8f, 0xff, 0xd0, 0xae, 0x9e, 0xff, 0xaf, 0x8f, 0x7e, 0xff, 0xa5, 0x83, 0x72, 0xff, 0xbb, 0x98, 0x88, 0xff, 0xb7, 0x94, 0x85, 0xff, 0xb1, 0x8e, 0x7a, 0xff, 0xbd, 0x96, 0x83, 0xff, 0xd3, 0xab, 0x98, 0xff, 0xd5, 0xaf, 0x9e, 0xff, 0xd9, 0xb0, 0x9a, 0xff, 0xb2, 0x93, 0x80, 0xff, 0x69, 0x61, 0x62, 0xff, 0x50, 0x4b, 0x52, 0xff, 0x77, 0x63, 0x5b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x9b, 0xa6, 0xcd, 0x74, 0x8b, 0xa3, 0xff, 0x69, 0x83, 0xa3, 0xff, 0x76, 0x8c, 0xa9, 0xff, 0x7d, 0x95, 0xa7, 0xff, 0x75, 0x8b, 0xa4, 0xff, 0x7b, 0x8d, 0xa8, 0xff, 0x8c, 0x9d, 0xaa, 0xff, 0x9d, 0xab, 0xad, 0xff, 0xa1, 0xab, 0xae, 0xff, 0x7f, 0x88, 0xa8, 0xff, 0x6e, 0x79, 0x9e, 0xff, 0x7a, 0x82, 0xa6, 0xff, 0x7a, 0x7e, 0xaa, 0xff, 0x7a, 0x7e, 0xac, 0xff, 0x5d, 0x63, 0x8c, 0xff, 0x5d, 0x62, 0x8c, 0xff, 0x75, 0x7b, 0xa7, 0xff, 0x63, 0x6a, 0x95, 0xff, 0x50, 0x58, 0x81, 0xff, 0x47, 0x51, 0x79, 0xff, 0x53, 0x5d, 0x85, 0xff, 0x59, 0x65, 0x8a, 0xff, 0x46, 0x53, 0x77, 0xff, 0x2f, 0x3a, 0x5f, 0xff, 0x2a, 0x36, 0x5a, 0xff, 0x2d, 0x38, 0x5d, 0xff, 0x2f, 0x3a, 0x5f, 0xff, 0x3a, 0x46, 0x69, 0xff, 0x42, 0x4e, 0x73, 0xff, 0x4a, 0x55, 0x81, 0xff, 0x49, 0x57, 0x84, 0xff, 0x33, 0x43, 0x6c, 0xff, 0x1f, 0x33, 0x55, 0xff, 0x18, 0x2b, 0x49, 0xff, 0x0e, 0x20, 0x3d, 0xff, 0x0c, 0x1e, 0x3b, 0xff, 0x12, 0x23, 0x3f, 0xff, 0x17, 0x29, 0x44, 0xff, 0x13, 0x25, 0x40, 0xff, 0x19, 0x22, 0x38, 0xff, 0x14, 0x21, 0x3b, 0xff, 0x0b, 0x21, 0x42, 0xff, 0x18, 0x2b, 0x47, 0xff, 0x22, 0x25, 0x31, 0xff, 0x1f, 0x13, 0x0c, 0xff, 0x3e, 0x22, 0x13, 0xff, 0x7c, 0x5d, 0x4c, 0xff, 0xa2, 0x86, 0x7c, 0xff, 0x61, 0x52, 0x59, 0xff, 0x25, 0x2c, 0x42, 0xff, 0x1b, 0x2b, 0x47, 0xff, 0x28, 0x31, 0x4b, 0xff, 0x24, 0x29, 0x43, 0xff, 0x1c, 0x26, 0x41, 0xff, 0x11, 0x1d, 0x36, 0xff, 0x0c, 0x19, 0x2c, 0xff, 0x0f, 0x19, 0x29, 0xff, 0x0d, 0x14, 0x25, 0xff, 0x0a, 0x11, 0x22, 0xff, 0x09, 0x10, 0x21, 0xff, 0x0b, 0x12, 0x22, 0xff, 0x0c, 0x13, 0x23, 0xff, 0x0a, 0x12, 0x22, 0xff, 0x0b, 0x10, 0x22, 0xff, 0x0a, 0x10, 0x22, 0xff, 0x06, 0x10, 0x20, 0xff, 0x06, 0x10, 0x1d, 0xff, 0x0a, 0x11, 0x1d, 0xff, 0x00, 0x00, 0x05, 0xff, 0x42, 0x3a, 0x45, 0xff, 0x6a, 0x63, 0x6d, 0xff, 0x29, 0x2c, 0x33, 0xff, 0x28, 0x2e, 0x33, 0xff, 0x3a, 0x3e, 0x44, 0xff, 0x3c, 0x36, 0x3d, 0xff, 0x36, 0x30, 0x33, 0xff, 0x41, 0x3d, 0x40, 0xff, 0x53, 0x4d, 0x4f, 0xff, 0x60, 0x56, 0x58, 0xff, 0x68, 0x5c, 0x5a, 0xff, 0x5f, 0x52, 0x4e, 0xff, 0x42, 0x38, 0x35, 0xff, 0x23, 0x1a, 0x16, 0xff, 0x29, 0x20, 0x17, 0xff, 0x5b, 0x4e, 0x44, 0xff, 0x60, 0x4d, 0x43, 0xff, 0x62, 0x47, 0x3d, 0xff, 0x9c, 0x77, 0x63, 0xff, 0xaa, 0x83, 0x69, 0xff, 0x92, 0x6e, 0x5e, 0xff, 0x76, 0x55, 0x4c, 0xff, 0x72, 0x56, 0x4f, 0xff, 0x71, 0x58, 0x4d, 0xff, 0x4f, 0x45, 0x3a, 0xff, 0x5b, 0x49, 0x44, 0xff, 0xb7, 0x8a, 0x84, 0xff, 0xb7, 0x8f, 0x84, 0xff, 0x81, 0x69, 0x5a, 0xff, 0xaa, 0x89, 0x7c, 0xff, 0xc9, 0xa3, 0x99, 0xff, 0x8f, 0x70, 0x68, 0xff, 0x95, 0x77, 0x6e, 0xff, 0x93, 0x75, 0x69, 0xff, 0x81, 0x60, 0x53, 0xff, 0xb5, 0x91, 0x7f, 0xff, 0xc9, 0xa9, 0x99, 0xff, 0xba, 0xa1, 0x93, 0xff, 0xb1, 0x8f, 0x7e, 0xff, 0xb8, 0x93, 0x7f, 0xff, 0xd1, 0xab, 0x96, 0xff, 0xd9, 0xb5, 0xa1, 0xff, 0xd1, 0xa8, 0x92, 0xff, 0x9f, 0x83, 0x73, 0xff, 0x53, 0x51, 0x55, 0xff, 0x50, 0x49, 0x4f, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x97, 0xa6, 0x51, 0x72, 0x88, 0xa4, 0xff, 0x6a, 0x85, 0xa6, 0xff, 0x73, 0x8a, 0xa6, 0xff, 0x77, 0x8b, 0xa5, 0xff, 0x7f, 0x8b, 0xa9, 0xff, 0x80, 0x83, 0x9d, 0xff, 0x84, 0x87, 0x96, 0xff, 0x92, 0x9c, 0xaa, 0xff, 0x86, 0x95, 0xad, 0xff, 0x6d, 0x77, 0x9d, 0xff, 0x77, 0x7f, 0xa8, 0xff, 0x78, 0x80, 0xab, 0xff, 0x77, 0x7f, 0xab, 0xff, 0x64, 0x6c, 0x96, 0xff, 0x58, 0x61, 0x87, 0xff, 0x6b, 0x72, 0x9d, 0xff, 0x68, 0x6e, 0x99, 0xff, 0x55, 0x5d, 0x85, 0xff, 0x52, 0x5d, 0x84, 0xff, 0x53, 0x5d, 0x84, 0xff, 0x4f, 0x5b, 0x81, 0xff, 0x40, 0x4c, 0x70, 0xff, 0x31, 0x3d, 0x60, 0xff, 0x2b, 0x37, 0x5b, 0xff, 0x30, 0x3c, 0x60, 0xff, 0x31, 0x3d, 0x61, 0xff, 0x36, 0x42, 0x66, 0xff, 0x3d, 0x49, 0x6c, 0xff, 0x46, 0x52, 0x76, 0xff, 0x3d, 0x49, 0x70, 0xff, 0x2c, 0x39, 0x5e, 0xff, 0x20, 0x2e, 0x52, 0xff, 0x1a, 0x2b, 0x4d, 0xff, 0x16, 0x25, 0x42, 0xff, 0x10, 0x1d, 0x39, 0xff, 0x11, 0x20, 0x3d, 0xff, 0x16, 0x26, 0x42, 0xff, 0x15, 0x28, 0x42, 0xff, 0x11, 0x25, 0x40, 0xff, 0x16, 0x20, 0x3d, 0xff, 0x15, 0x1d, 0x3f, 0xff, 0x0f, 0x20, 0x40, 0xff, 0x14, 0x26, 0x3c, 0xff, 0x17, 0x1f, 0x23, 0xff, 0x1b, 0x1a, 0x0e, 0xff, 0x46, 0x31, 0x21, 0xff, 0x61, 0x3f, 0x2e, 0xff, 0xa3, 0x85, 0x77, 0xff, 0x7f, 0x6f, 0x72, 0xff, 0x4b, 0x4c, 0x61, 0xff, 0x12, 0x1b, 0x34, 0xff, 0x25, 0x30, 0x4b, 0xff, 0x1c, 0x28, 0x46, 0xff, 0x1a, 0x26, 0x43, 0xff, 0x11, 0x1e, 0x37, 0xff, 0x0c, 0x17, 0x2b, 0xff, 0x0c, 0x13, 0x23, 0xff, 0x09, 0x10, 0x20, 0xff, 0x08, 0x0f, 0x20, 0xff, 0x07, 0x0e, 0x1f, 0xff, 0x09, 0x10, 0x21, 0xff, 0x0a, 0x11, 0x22, 0xff, 0x09, 0x10, 0x21, 0xff, 0x09, 0x0e, 0x20, 0xff, 0x0a, 0x0f, 0x21, 0xff, 0x09, 0x11, 0x20, 0xff, 0x0c, 0x12, 0x20, 0xff, 0x00, 0x00, 0x07, 0xff, 0x20, 0x21, 0x2c, 0xff, 0x65, 0x61, 0x6c, 0xff, 0x3b, 0x36, 0x3e, 0xff, 0x29, 0x2b, 0x30, 0xff, 0x34, 0x3a, 0x3e, 0xff, 0x37, 0x38, 0x3d, 0xff, 0x2e, 0x29, 0x2f, 0xff, 0x48, 0x40, 0x45, 0xff, 0x5e, 0x56, 0x59, 0xff, 0x5c, 0x53, 0x55, 0xff, 0x4f, 0x47, 0x48, 0xff, 0x3c, 0x34, 0x34, 0xff, 0x41, 0x3a, 0x37, 0xff, 0x35, 0x2e, 0x2e, 0xff, 0x10, 0x0a, 0x0c, 0xff, 0x33, 0x2a, 0x26, 0xff, 0x4f, 0x3f, 0x35, 0xff, 0x60, 0x49, 0x3a, 0xff, 0x79, 0x5a, 0x49, 0xff, 0x81, 0x5c, 0x49, 0xff, 0x8e, 0x69, 0x57, 0xff, 0x86, 0x64, 0x57, 0xff, 0x71, 0x52, 0x4b, 0xff, 0x75, 0x59, 0x53, 0xff, 0x6d, 0x52, 0x4b, 0xff, 0x69, 0x57, 0x50, 0xff, 0x6b, 0x55, 0x4d, 0xff, 0x96, 0x6e, 0x63, 0xff, 0xac, 0x85, 0x76, 0xff, 0xaa, 0x8a, 0x7b, 0xff, 0xc7, 0xa5, 0x94, 0xff, 0x79, 0x62, 0x5b, 0xff, 0x1a, 0x11, 0x12, 0xff, 0x55, 0x42, 0x3c, 0xff, 0x7c, 0x63, 0x58, 0xff, 0xae, 0x8d, 0x7f, 0xff, 0xd1, 0xaa, 0x9a, 0xff, 0xbd, 0xa2, 0x95, 0xff, 0x8d, 0x7d, 0x74, 0xff, 0x85, 0x6c, 0x5c, 0xff, 0xaf, 0x92, 0x7c, 0xff, 0xda, 0xb9, 0xa2, 0xff, 0xd7, 0xb4, 0x9b, 0xff, 0xbf, 0x9c, 0x88, 0xff, 0x8a, 0x74, 0x6f, 0xff, 0x4f, 0x4d, 0x50, 0xff, 0x5e, 0x51, 0x51, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x6f, 0x85, 0xa2, 0xce, 0x6c, 0x85, 0xa5, 0xff, 0x73, 0x87, 0x9f, 0xff, 0x67, 0x7b, 0x95, 0xff, 0x72, 0x7a, 0x9b, 0xff, 0xa1, 0x9b, 0xb8, 0xff, 0x8d, 0x88, 0x9a, 0xff, 0x72, 0x76, 0x8a, 0xff, 0x56, 0x60, 0x83, 0xff, 0x6e, 0x78, 0xa1, 0xff, 0x79, 0x80, 0xaa, 0xff, 0x76, 0x7e, 0xaa, 0xff, 0x6b, 0x74, 0xa1, 0xff, 0x53, 0x5e, 0x87, 0xff, 0x5d, 0x6a, 0x91, 0xff, 0x68, 0x71, 0x9a, 0xff, 0x59, 0x60, 0x89, 0xff, 0x54, 0x5e, 0x86, 0xff, 0x55, 0x60, 0x87, 0xff, 0x47, 0x53, 0x79, 0xff, 0x37, 0x44, 0x6a, 0xff, 0x2b, 0x37, 0x5c, 0xff, 0x28, 0x34, 0x58, 0xff, 0x2b, 0x37, 0x5b, 0xff, 0x32, 0x3e, 0x62, 0xff, 0x37, 0x43, 0x67, 0xff, 0x3b, 0x47, 0x6b, 0xff, 0x3e, 0x4a, 0x6c, 0xff, 0x33, 0x40, 0x62, 0xff, 0x24, 0x31, 0x52, 0xff, 0x1d, 0x28, 0x48, 0xff, 0x21, 0x2b, 0x4b, 0xff, 0x1e, 0x2a, 0x49, 0xff, 0x14, 0x20, 0x3c, 0xff, 0x0e, 0x19, 0x35, 0xff, 0x0f, 0x1b, 0x37, 0xff, 0x12, 0x22, 0x3d, 0xff, 0x13, 0x26, 0x41, 0xff, 0x13, 0x26, 0x41, 0xff, 0x0f, 0x25, 0x44, 0xff, 0x0d, 0x24, 0x43, 0xff, 0x0e, 0x22, 0x3a, 0xff, 0x18, 0x22, 0x30, 0xff, 0x1a, 0x15, 0x15, 0xff, 0x31, 0x1d, 0x12, 0xff, 0x57, 0x3d, 0x2e, 0xff, 0x56, 0x36, 0x24, 0xff, 0xa1, 0x80, 0x6e, 0xff, 0x8c, 0x78, 0x75, 0xff, 0x6f, 0x6d, 0x7c, 0xff, 0x2d, 0x32, 0x47, 0xff, 0x07, 0x11, 0x29, 0xff, 0x1f, 0x2c, 0x48, 0xff, 0x18, 0x24, 0x41, 0xff, 0x17, 0x23, 0x3d, 0xff, 0x13, 0x1c, 0x30, 0xff, 0x0d, 0x13, 0x25, 0xff, 0x0b, 0x12, 0x22, 0xff, 0x09, 0x10, 0x22, 0xff, 0x09, 0x10, 0x21, 0xff, 0x0a, 0x11, 0x22, 0xff, 0x0a, 0x11, 0x22, 0xff, 0x08, 0x0f, 0x21, 0xff, 0x08, 0x0e, 0x1e, 0xff, 0x0a, 0x0e, 0x1e, 0xff, 0x0f, 0x12, 0x21, 0xff, 0x00, 0x02, 0x0e, 0xff, 0x12, 0x12, 0x1d, 0xff, 0x5d, 0x5e, 0x69, 0xff, 0x43, 0x41, 0x4a, 0xff, 0x2f, 0x2c, 0x31, 0xff, 0x34, 0x35, 0x3a, 0xff, 0x31, 0x33, 0x37, 0xff, 0x2b, 0x28, 0x2d, 0xff, 0x39, 0x35, 0x3a, 0xff, 0x61, 0x58, 0x5c, 0xff, 0x6c, 0x62, 0x65, 0xff, 0x59, 0x51, 0x53, 0xff, 0x35, 0x2f, 0x30, 0xff, 0x2d, 0x29, 0x29, 0xff, 0x3b, 0x37, 0x37, 0xff, 0x1d, 0x1b, 0x1d, 0xff, 0x0d, 0x09, 0x0c, 0xff, 0x2b, 0x20, 0x1e, 0xff, 0x3e, 0x2b, 0x21, 0xff, 0x5e, 0x42, 0x32, 0xff, 0x8b, 0x68, 0x51, 0xff, 0x91, 0x6c, 0x5a, 0xff, 0x8b, 0x68, 0x5d, 0xff, 0x74, 0x56, 0x4e, 0xff, 0x67, 0x4c, 0x48, 0xff, 0x61, 0x48, 0x44, 0xff, 0x5d, 0x43, 0x3e, 0xff, 0x60, 0x49, 0x45, 0xff, 0x72, 0x58, 0x50, 0xff, 0x99, 0x77, 0x6a, 0xff, 0xaa, 0x7f, 0x71, 0xff, 0xc0, 0x9a, 0x8c, 0xff, 0xa4, 0x85, 0x77, 0xff, 0x34, 0x2c, 0x2a, 0xff, 0x0e, 0x14, 0x1c, 0xff, 0x47, 0x3a, 0x39, 0xff, 0x6c, 0x53, 0x4a, 0xff, 0x9a, 0x7a, 0x6d, 0xff, 0xbe, 0x99, 0x89, 0xff, 0x76, 0x59, 0x4e, 0xff, 0x6e, 0x57, 0x51, 0xff, 0xb4, 0x96, 0x89, 0xff, 0xcb, 0xa7, 0x95, 0xff, 0xd5, 0xac, 0x96, 0xff, 0xc7, 0x9a, 0x80, 0xff, 0xb9, 0x95, 0x84, 0xff, 0x78, 0x6a, 0x6c, 0xff, 0x46, 0x41, 0x45, 0xce, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x83, 0x9c, 0x46, 0x71, 0x88, 0xa1, 0xff, 0x8b, 0x9b, 0xa9, 0xff, 0x6e, 0x82, 0x93, 0xff, 0x53, 0x5e, 0x7c, 0xff, 0x87, 0x84, 0xa6, 0xff, 0xa5, 0x9f, 0xb8, 0xff, 0xb5, 0xb0, 0xc4, 0xff, 0x7b, 0x76, 0x91, 0xff, 0x4e, 0x52, 0x77, 0xff, 0x5e, 0x65, 0x8d, 0xff, 0x6f, 0x75, 0xa0, 0xff, 0x5d, 0x64, 0x91, 0xff, 0x58, 0x61, 0x8c, 0xff, 0x63, 0x70, 0x98, 0xff, 0x5d, 0x67, 0x8e, 0xff, 0x56, 0x5f, 0x87, 0xff, 0x51, 0x5b, 0x82, 0xff, 0x3f, 0x4b, 0x71, 0xff, 0x2f, 0x3d, 0x62, 0xff, 0x2a, 0x39, 0x5d, 0xff, 0x26, 0x32, 0x54, 0xff, 0x2a, 0x36, 0x58, 0xff, 0x34, 0x40, 0x63, 0xff, 0x39, 0x45, 0x67, 0xff, 0x3c, 0x48, 0x6a, 0xff, 0x35, 0x41, 0x63, 0xff, 0x2e, 0x3a, 0x5c, 0xff, 0x24, 0x30, 0x50, 0xff, 0x1a, 0x26, 0x42, 0xff, 0x15, 0x21, 0x3c, 0xff, 0x13, 0x1e, 0x38, 0xff, 0x0f, 0x19, 0x34, 0xff, 0x0a, 0x17, 0x31, 0xff, 0x0c, 0x19, 0x34, 0xff, 0x0e, 0x1c, 0x36, 0xff, 0x10, 0x1e, 0x39, 0xff, 0x13, 0x22, 0x3e, 0xff, 0x12, 0x22, 0x3d, 0xff, 0x0d, 0x24, 0x3f, 0xff, 0x06, 0x1f, 0x36, 0xff, 0x12, 0x20, 0x2e, 0xff, 0x1d, 0x1b, 0x21, 0xff, 0x26, 0x13, 0x0f, 0xff, 0x3e, 0x1b, 0x12, 0xff, 0x5f, 0x44, 0x36, 0xff, 0x5d, 0x41, 0x2d, 0xff, 0x89, 0x64, 0x4f, 0xff, 0x94, 0x7b, 0x74, 0xff, 0x66, 0x60, 0x6b, 0xff, 0x72, 0x74, 0x86, 0xff, 0x15, 0x17, 0x29, 0xff, 0x0b, 0x11, 0x23, 0xff, 0x1c, 0x25, 0x3c, 0xff, 0x19, 0x21, 0x39, 0xff, 0x13, 0x1c, 0x30, 0xff, 0x11, 0x17, 0x2a, 0xff, 0x0e, 0x15, 0x26, 0xff, 0x09, 0x10, 0x21, 0xff, 0x09, 0x10, 0x21, 0xff, 0x09, 0x10, 0x21, 0xff, 0x09, 0x10, 0x21, 0xff, 0x08, 0x0f, 0x20, 0xff, 0x06, 0x0d, 0x1d, 0xff, 0x0a, 0x10, 0x1e, 0xff, 0x05, 0x05, 0x14, 0xff, 0x0a, 0x08, 0x14, 0xff, 0x59, 0x58, 0x63, 0xff, 0x48, 0x4a, 0x53, 0xff, 0x27, 0x27, 0x2f, 0xff, 0x30, 0x30, 0x35, 0xff, 0x31, 0x30, 0x36, 0xff, 0x2d, 0x29, 0x2e, 0xff, 0x34, 0x2f, 0x34, 0xff, 0x54, 0x50, 0x52, 0xff, 0x67, 0x61, 0x63, 0xff, 0x54, 0x4d, 0x50, 0xff, 0x35, 0x2f, 0x32, 0xff, 0x2a, 0x25, 0x26, 0xff, 0x35, 0x30, 0x31, 0xff, 0x31, 0x2d, 0x2e, 0xff, 0x0c, 0x0b, 0x0b, 0xff, 0x16, 0x10, 0x11, 0xff, 0x30, 0x21, 0x1e, 0xff, 0x54, 0x3c, 0x32, 0xff, 0x80, 0x62, 0x51, 0xff, 0x9d, 0x7a, 0x63, 0xff, 0x97, 0x76, 0x65, 0xff, 0x77, 0x5a, 0x54, 0xff, 0x5e, 0x47, 0x42, 0xff, 0x55, 0x42, 0x40, 0xff, 0x4d, 0x3b, 0x39, 0xff, 0x4f, 0x3b, 0x37, 0xff, 0x56, 0x3d, 0x3b, 0xff, 0x72, 0x57, 0x54, 0xff, 0x9b, 0x7e, 0x71, 0xff, 0xab, 0x82, 0x73, 0xff, 0xbb, 0x91, 0x86, 0xff, 0x7e, 0x65, 0x5e, 0xff, 0x25, 0x26, 0x28, 0xff, 0x13, 0x17, 0x1f, 0xff, 0x4b, 0x3b, 0x39, 0xff, 0x9a, 0x7c, 0x73, 0xff, 0x96, 0x74, 0x67, 0xff, 0x73, 0x55, 0x49, 0xff, 0x7e, 0x61, 0x58, 0xff, 0xc0, 0xa1, 0x9a, 0xff, 0xc5, 0xa2, 0x96, 0xff, 0xb6, 0x8d, 0x7d, 0xff, 0xba, 0x90, 0x7c, 0xff, 0xc7, 0x98, 0x82, 0xff, 0xb7, 0x93, 0x87, 0xff, 0x63, 0x58, 0x5a, 0xff, 0x52, 0x4b, 0x47, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x93, 0xa7, 0xb4, 0x97, 0xa1, 0xa2, 0xff, 0x8b, 0xa0, 0xa5, 0xff, 0x48, 0x5b, 0x76, 0xff, 0x4e, 0x54, 0x7d, 0xff, 0xbf, 0xba, 0xd9, 0xff, 0xd1, 0xc3, 0xd1, 0xff, 0xdd, 0xc4, 0xce, 0xff, 0xab, 0xa8, 0xc7, 0xff, 0x58, 0x61, 0x89, 0xff, 0x5b, 0x5f, 0x8a, 0xff, 0x57, 0x5c, 0x88, 0xff, 0x60, 0x67, 0x91, 0xff, 0x62, 0x6a, 0x96, 0xff, 0x57, 0x61, 0x8a, 0xff, 0x4a, 0x54, 0x7c, 0xff, 0x3e, 0x4a, 0x70, 0xff, 0x2c, 0x39, 0x60, 0xff, 0x2b, 0x39, 0x5e, 0xff, 0x29, 0x38, 0x5c, 0xff, 0x2d, 0x3a, 0x5c, 0xff, 0x36, 0x41, 0x63, 0xff, 0x35, 0x41, 0x63, 0xff, 0x36, 0x42, 0x65, 0xff, 0x2e, 0x3a, 0x5c, 0xff, 0x21, 0x2d, 0x50, 0xff, 0x1e, 0x29, 0x4d, 0xff, 0x18, 0x23, 0x44, 0xff, 0x10, 0x1c, 0x36, 0xff, 0x0b, 0x19, 0x30, 0xff, 0x0a, 0x15, 0x2c, 0xff, 0x0b, 0x12, 0x2c, 0xff, 0x08, 0x17, 0x2f, 0xff, 0x08, 0x1b, 0x31, 0xff, 0x0c, 0x1d, 0x35, 0xff, 0x13, 0x21, 0x3c, 0xff, 0x0d, 0x1a, 0x39, 0xff, 0x00, 0x0e, 0x30, 0xff, 0x08, 0x12, 0x30, 0xff, 0x1f, 0x22, 0x36, 0xff, 0x19, 0x17, 0x22, 0xff, 0x1b, 0x10, 0x0f, 0xff, 0x2a, 0x18, 0x0f, 0xff, 0x35, 0x1e, 0x15, 0xff, 0x47, 0x31, 0x26, 0xff, 0x53, 0x37, 0x22, 0xff, 0x65, 0x41, 0x28, 0xff, 0x96, 0x7c, 0x73, 0xff, 0x6c, 0x64, 0x6f, 0xff, 0x8e, 0x8f, 0xa2, 0xff, 0x40, 0x3f, 0x49, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x11, 0x20, 0xff, 0x14, 0x1c, 0x32, 0xff, 0x11, 0x1a, 0x30, 0xff, 0x11, 0x17, 0x2d, 0xff, 0x0d, 0x13, 0x26, 0xff, 0x0a, 0x10, 0x21, 0xff, 0x08, 0x0f, 0x21, 0xff, 0x06, 0x0d, 0x1f, 0xff, 0x07, 0x0e, 0x20, 0xff, 0x07, 0x0f, 0x21, 0xff, 0x06, 0x0e, 0x1e, 0xff, 0x04, 0x08, 0x16, 0xff, 0x01, 0x01, 0x0e, 0xff, 0x51, 0x4d, 0x59, 0xff, 0x51, 0x4e, 0x5a, 0xff, 0x2b, 0x2a, 0x34, 0xff, 0x2b, 0x2f, 0x36, 0xff, 0x2b, 0x2e, 0x32, 0xff, 0x2e, 0x2c, 0x31, 0xff, 0x36, 0x30, 0x34, 0xff, 0x4d, 0x47, 0x49, 0xff, 0x68, 0x61, 0x64, 0xff, 0x52, 0x4f, 0x50, 0xff, 0x25, 0x25, 0x25, 0xff, 0x1d, 0x1b, 0x1d, 0xff, 0x2e, 0x29, 0x2c, 0xff, 0x3e, 0x39, 0x3b, 0xff, 0x1b, 0x15, 0x18, 0xff, 0x0a, 0x05, 0x06, 0xff, 0x1d, 0x15, 0x11, 0xff, 0x3d, 0x2b, 0x27, 0xff, 0x72, 0x58, 0x50, 0xff, 0x97, 0x77, 0x68, 0xff, 0x8e, 0x6c, 0x55, 0xff, 0x7a, 0x5b, 0x4c, 0xff, 0x66, 0x4d, 0x4a, 0xff, 0x4f, 0x3f, 0x3c, 0xff, 0x41, 0x36, 0x35, 0xff, 0x46, 0x3b, 0x39, 0xff, 0x49, 0x3a, 0x35, 0xff, 0x58, 0x3e, 0x40, 0xff, 0x6f, 0x59, 0x5a, 0xff, 0x8d, 0x78, 0x6e, 0xff, 0xb5, 0x8f, 0x81, 0xff, 0xb8, 0x8b, 0x83, 0xff, 0x59, 0x46, 0x44, 0xff, 0x14, 0x15, 0x1b, 0xff, 0x1c, 0x15, 0x1a, 0xff, 0x4d, 0x32, 0x2f, 0xff, 0x9b, 0x78, 0x6f, 0xff, 0xb2, 0x8b, 0x7e, 0xff, 0x7e, 0x60, 0x55, 0xff, 0x88, 0x72, 0x68, 0xff, 0x93, 0x7b, 0x6d, 0xff, 0x81, 0x64, 0x54, 0xff, 0xd3, 0xb1, 0x9e, 0xff, 0xc7, 0xa5, 0x90, 0xff, 0xbc, 0x98, 0x82, 0xff, 0x97, 0x7a, 0x70, 0xff, 0x5d, 0x4f, 0x53, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x9c, 0xa3, 0x27, 0x93, 0x9f, 0xa0, 0xfa, 0x8e, 0x9e, 0x9c, 0xff, 0x8d, 0x9e, 0xad, 0xff, 0x5c, 0x68, 0x8c, 0xff, 0x6b, 0x6f, 0x95, 0xff, 0xb8, 0xb2, 0xcb, 0xff, 0xe4, 0xd7, 0xe3, 0xff, 0x75, 0x73, 0x7f, 0xff, 0x31, 0x37, 0x47, 0xff, 0x39, 0x44, 0x5e, 0xff, 0x51, 0x5c, 0x89, 0xff, 0x55, 0x5d, 0x8f, 0xff, 0x5b, 0x62, 0x88, 0xff, 0x4c, 0x57, 0x79, 0xff, 0x3a, 0x45, 0x69, 0xff, 0x32, 0x3e, 0x60, 0xff, 0x2e, 0x3b, 0x5d, 0xff, 0x2c, 0x3b, 0x5c, 0xff, 0x29, 0x3a, 0x5c, 0xff, 0x2f, 0x3d, 0x5f, 0xff, 0x32, 0x3d, 0x5f, 0xff, 0x2d, 0x39, 0x5a, 0xff, 0x29, 0x36, 0x54, 0xff, 0x20, 0x2d, 0x4b, 0xff, 0x1a, 0x28, 0x45, 0xff, 0x12, 0x21, 0x3f, 0xff, 0x10, 0x1e, 0x39, 0xff, 0x12, 0x1b, 0x2f, 0xff, 0x10, 0x18, 0x29, 0xff, 0x10, 0x1a, 0x2f, 0xff, 0x0d, 0x16, 0x31, 0xff, 0x05, 0x19, 0x2f, 0xff, 0x07, 0x1e, 0x35, 0xff, 0x12, 0x24, 0x41, 0xff, 0x0e, 0x20, 0x3c, 0xff, 0x0a, 0x16, 0x2a, 0xff, 0x27, 0x28, 0x35, 0xff, 0x44, 0x34, 0x39, 0xff, 0x57, 0x43, 0x3f, 0xff, 0x2c, 0x1e, 0x1a, 0xff, 0x0d, 0x04, 0x02, 0xff, 0x1b, 0x13, 0x0f, 0xff, 0x25, 0x19, 0x0f, 0xff, 0x3f, 0x27, 0x16, 0xff, 0x6e, 0x4c, 0x31, 0xff, 0x7e, 0x54, 0x37, 0xff, 0xba, 0x93, 0x80, 0xff, 0x88, 0x74, 0x73, 0xff, 0x92, 0x8d, 0x9b, 0xff, 0x77, 0x7b, 0x8a, 0xff, 0x28, 0x2b, 0x38, 0xff, 0x00, 0x00, 0x00, 0xff, 0x09, 0x07, 0x14, 0xff, 0x14, 0x11, 0x20, 0xff, 0x0c, 0x12, 0x23, 0xff, 0x06, 0x11, 0x21, 0xff, 0x05, 0x0e, 0x1d, 0xff, 0x08, 0x0f, 0x1d, 0xff, 0x08, 0x0d, 0x1a, 0xff, 0x08, 0x0d, 0x1a, 0xff, 0x07, 0x0d, 0x1b, 0xff, 0x05, 0x0c, 0x19, 0xff, 0x00, 0x00, 0x08, 0xff, 0x4d, 0x47, 0x52, 0xff, 0x5f, 0x55, 0x61, 0xff, 0x2e, 0x28, 0x32, 0xff, 0x2a, 0x2f, 0x36, 0xff, 0x2a, 0x2c, 0x30, 0xff, 0x35, 0x30, 0x32, 0xff, 0x39, 0x35, 0x3a, 0xff, 0x48, 0x44, 0x48, 0xff, 0x5e, 0x5a, 0x5e, 0xff, 0x54, 0x4e, 0x53, 0xff, 0x2e, 0x2b, 0x2c, 0xff, 0x21, 0x1e, 0x1e, 0xff, 0x2b, 0x26, 0x28, 0xff, 0x3e, 0x39, 0x3a, 0xff, 0x32, 0x2d, 0x2e, 0xff, 0x05, 0x01, 0x05, 0xff, 0x11, 0x0c, 0x0b, 0xff, 0x27, 0x1a, 0x13, 0xff, 0x56, 0x40, 0x35, 0xff, 0x88, 0x6a, 0x5c, 0xff, 0x89, 0x69, 0x5a, 0xff, 0x7e, 0x5e, 0x51, 0xff, 0x6a, 0x50, 0x4a, 0xff, 0x52, 0x41, 0x3f, 0xff, 0x48, 0x3b, 0x38, 0xff, 0x41, 0x35, 0x34, 0xff, 0x44, 0x37, 0x37, 0xff, 0x44, 0x35, 0x35, 0xff, 0x5b, 0x42, 0x47, 0xff, 0x74, 0x5a, 0x59, 0xff, 0x8d, 0x77, 0x67, 0xff, 0xb6, 0x91, 0x85, 0xff, 0xa3, 0x7d, 0x7b, 0xff, 0x3c, 0x34, 0x38, 0xff, 0x11, 0x13, 0x14, 0xff, 0x1f, 0x17, 0x1a, 0xff, 0x47, 0x2f, 0x2e, 0xff, 0x9a, 0x71, 0x5f, 0xff, 0xa0, 0x82, 0x7c, 0xff, 0x6c, 0x61, 0x62, 0xff, 0x60, 0x4a, 0x43, 0xff, 0x75, 0x53, 0x4a, 0xff, 0xa7, 0x8a, 0x80, 0xff, 0xa5, 0x87, 0x7e, 0xff, 0xad, 0x91, 0x88, 0xff, 0x97, 0x7e, 0x78, 0xff, 0x73, 0x56, 0x4c, 0xfa, 0x7f, 0x66, 0x66, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x9b, 0xa3, 0x88, 0x96, 0xa2, 0xa5, 0xff, 0x8d, 0x98, 0xa5, 0xff, 0x62, 0x6d, 0x8e, 0xff, 0x34, 0x3d, 0x67, 0xff, 0x7b, 0x82, 0xa2, 0xff, 0x50, 0x54, 0x65, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3d, 0x40, 0x3f, 0xff, 0x21, 0x2c, 0x32, 0xff, 0x31, 0x3a, 0x5c, 0xff, 0x4c, 0x54, 0x84, 0xff, 0x48, 0x54, 0x74, 0xff, 0x36, 0x43, 0x62, 0xff, 0x31, 0x3e, 0x5f, 0xff, 0x2f, 0x3b, 0x5a, 0xff, 0x2b, 0x38, 0x57, 0xff, 0x29, 0x38, 0x58, 0xff, 0x26, 0x37, 0x57, 0xff, 0x27, 0x35, 0x57, 0xff, 0x28, 0x33, 0x55, 0xff, 0x21, 0x2f, 0x4d, 0xff, 0x1c, 0x2a, 0x45, 0xff, 0x18, 0x27, 0x41, 0xff, 0x13, 0x23, 0x3b, 0xff, 0x0c, 0x1d, 0x38, 0xff, 0x0c, 0x1b, 0x33, 0xff, 0x0e, 0x19, 0x2b, 0xff, 0x12, 0x1b, 0x2c, 0xff, 0x10, 0x1c, 0x32, 0xff, 0x0c, 0x1b, 0x36, 0xff, 0x06, 0x1c, 0x3a, 0xff, 0x0a, 0x1b, 0x3b, 0xff, 0x26, 0x2b, 0x4b, 0xff, 0x2a, 0x2e, 0x43, 0xff, 0x4c, 0x48, 0x49, 0xff, 0x93, 0x77, 0x6b, 0xff, 0x6f, 0x50, 0x43, 0xff, 0x5f, 0x47, 0x37, 0xff, 0x48, 0x36, 0x29, 0xff, 0x0b, 0x04, 0x04, 0xff, 0x0a, 0x04, 0x06, 0xff, 0x23, 0x16, 0x0d, 0xff, 0x68, 0x4b, 0x33, 0xff, 0x89, 0x62, 0x44, 0xff, 0x9f, 0x6f, 0x50, 0xff, 0xbd, 0x8d, 0x72, 0xff, 0xa3, 0x84, 0x78, 0xff, 0x86, 0x7e, 0x82, 0xff, 0xb4, 0xb4, 0xc5, 0xff, 0x75, 0x78, 0x87, 0xff, 0x0c, 0x0e, 0x15, 0xff, 0x00, 0x00, 0x00, 0xff, 0x09, 0x02, 0x0c, 0xff, 0x06, 0x0b, 0x18, 0xff, 0x03, 0x0e, 0x1c, 0xff, 0x03, 0x0b, 0x19, 0xff, 0x05, 0x0b, 0x18, 0xff, 0x08, 0x0c, 0x17, 0xff, 0x06, 0x0a, 0x14, 0xff, 0x05, 0x0a, 0x15, 0xff, 0x00, 0x00, 0x03, 0xff, 0x32, 0x31, 0x3a, 0xff, 0x60, 0x5b, 0x64, 0xff, 0x37, 0x2f, 0x38, 0xff, 0x35, 0x32, 0x38, 0xff, 0x28, 0x2c, 0x31, 0xff, 0x30, 0x2e, 0x32, 0xff, 0x3f, 0x37, 0x3b, 0xff, 0x48, 0x43, 0x48, 0xff, 0x5c, 0x58, 0x5e, 0xff, 0x52, 0x4e, 0x54, 0xff, 0x2d, 0x2a, 0x30, 0xff, 0x1c, 0x17, 0x1a, 0xff, 0x2b, 0x24, 0x24, 0xff, 0x37, 0x31, 0x32, 0xff, 0x43, 0x3d, 0x3e, 0xff, 0x19, 0x13, 0x14, 0xff, 0x04, 0x01, 0x03, 0xff, 0x18, 0x11, 0x0f, 0xff, 0x3b, 0x29, 0x20, 0xff, 0x6c, 0x53, 0x44, 0xff, 0x7f, 0x5e, 0x4d, 0xff, 0x6d, 0x4e, 0x42, 0xff, 0x62, 0x47, 0x44, 0xff, 0x4f, 0x3b, 0x3a, 0xff, 0x42, 0x37, 0x33, 0xff, 0x40, 0x34, 0x30, 0xff, 0x40, 0x33, 0x31, 0xff, 0x46, 0x37, 0x38, 0xff, 0x4e, 0x3c, 0x3f, 0xff, 0x63, 0x4b, 0x50, 0xff, 0x74, 0x57, 0x53, 0xff, 0x91, 0x74, 0x62, 0xff, 0xaf, 0x8b, 0x7f, 0xff, 0x85, 0x66, 0x68, 0xff, 0x2b, 0x2a, 0x2e, 0xff, 0x15, 0x16, 0x10, 0xff, 0x1d, 0x17, 0x19, 0xff, 0x42, 0x2f, 0x2f, 0xff, 0xac, 0x7f, 0x6a, 0xff, 0x8f, 0x76, 0x74, 0xff, 0x37, 0x35, 0x3e, 0xff, 0x6b, 0x54, 0x4e, 0xff, 0x96, 0x70, 0x6a, 0xff, 0x81, 0x62, 0x5e, 0xff, 0x8a, 0x6d, 0x6a, 0xff, 0x8b, 0x72, 0x71, 0xff, 0x7c, 0x65, 0x66, 0xff, 0x77, 0x62, 0x5e, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x8d, 0xaa, 0x09, 0x8e, 0x99, 0xab, 0xdb, 0x73, 0x7c, 0x97, 0xff, 0x64, 0x6e, 0x93, 0xff, 0x67, 0x70, 0x96, 0xff, 0x61, 0x66, 0x84, 0xff, 0x00, 0x00, 0x12, 0xff, 0x0c, 0x0c, 0x16, 0xff, 0x4b, 0x4a, 0x49, 0xff, 0x3e, 0x3a, 0x35, 0xff, 0x30, 0x2e, 0x38, 0xff, 0x39, 0x40, 0x5d, 0xff, 0x2f, 0x42, 0x66, 0xff, 0x31, 0x3f, 0x62, 0xff, 0x2e, 0x39, 0x5c, 0xff, 0x24, 0x30, 0x54, 0xff, 0x24, 0x31, 0x54, 0xff, 0x26, 0x34, 0x57, 0xff, 0x22, 0x32, 0x54, 0xff, 0x20, 0x2d, 0x4d, 0xff, 0x1c, 0x2a, 0x48, 0xff, 0x18, 0x26, 0x42, 0xff, 0x13, 0x21, 0x3e, 0xff, 0x12, 0x20, 0x3b, 0xff, 0x0e, 0x1e, 0x37, 0xff, 0x10, 0x1d, 0x38, 0xff, 0x0e, 0x19, 0x35, 0xff, 0x0c, 0x1a, 0x34, 0xff, 0x0e, 0x1d, 0x37, 0xff, 0x0c, 0x1e, 0x39, 0xff, 0x09, 0x1e, 0x3a, 0xff, 0x00, 0x0d, 0x30, 0xff, 0x20, 0x22, 0x41, 0xff, 0x5a, 0x4c, 0x5d, 0xff, 0x45, 0x32, 0x35, 0xff, 0x61, 0x4a, 0x41, 0xff, 0x9a, 0x72, 0x67, 0xff, 0x88, 0x66, 0x5e, 0xff, 0x59, 0x42, 0x37, 0xff, 0x3e, 0x2c, 0x22, 0xff, 0x17, 0x0e, 0x0e, 0xff, 0x11, 0x0a, 0x0b, 0xff, 0x2a, 0x1b, 0x12, 0xff, 0x6a, 0x4d, 0x36, 0xff, 0x96, 0x6e, 0x50, 0xff, 0xb1, 0x80, 0x63, 0xff, 0xa2, 0x73, 0x57, 0xff, 0xb1, 0x91, 0x81, 0xff, 0x8f, 0x81, 0x7e, 0xff, 0x90, 0x7f, 0x85, 0xff, 0xaa, 0xa1, 0xa6, 0xff, 0x6d, 0x74, 0x77, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x02, 0x12, 0xff, 0x04, 0x06, 0x16, 0xff, 0x06, 0x07, 0x16, 0xff, 0x04, 0x06, 0x15, 0xff, 0x07, 0x09, 0x18, 0xff, 0x07, 0x0a, 0x18, 0xff, 0x00, 0x00, 0x06, 0xff, 0x1d, 0x19, 0x23, 0xff, 0x5c, 0x55, 0x5f, 0xff, 0x2b, 0x2e, 0x36, 0xff, 0x32, 0x39, 0x3e, 0xff, 0x2e, 0x31, 0x37, 0xff, 0x30, 0x2b, 0x32, 0xff, 0x39, 0x34, 0x39, 0xff, 0x49, 0x45, 0x4a, 0xff, 0x5a, 0x56, 0x5b, 0xff, 0x50, 0x4c, 0x51, 0xff, 0x33, 0x2f, 0x34, 0xff, 0x20, 0x1c, 0x21, 0xff, 0x2a, 0x24, 0x28, 0xff, 0x36, 0x30, 0x31, 0xff, 0x46, 0x41, 0x42, 0xff, 0x2a, 0x24, 0x25, 0xff, 0x06, 0x01, 0x02, 0xff, 0x0c, 0x07, 0x0a, 0xff, 0x27, 0x1e, 0x19, 0xff, 0x60, 0x4e, 0x43, 0xff, 0x77, 0x5e, 0x52, 0xff, 0x6c, 0x4e, 0x44, 0xff, 0x5c, 0x43, 0x3b, 0xff, 0x51, 0x3b, 0x3b, 0xff, 0x49, 0x37, 0x37, 0xff, 0x43, 0x35, 0x32, 0xff, 0x3f, 0x32, 0x30, 0xff, 0x42, 0x36, 0x33, 0xff, 0x46, 0x37, 0x36, 0xff, 0x53, 0x3f, 0x40, 0xff, 0x68, 0x53, 0x56, 0xff, 0x73, 0x59, 0x56, 0xff, 0x94, 0x75, 0x65, 0xff, 0xab, 0x89, 0x7f, 0xff, 0x72, 0x58, 0x5b, 0xff, 0x25, 0x20, 0x23, 0xff, 0x14, 0x11, 0x0c, 0xff, 0x1d, 0x18, 0x18, 0xff, 0x42, 0x2f, 0x2c, 0xff, 0xa4, 0x78, 0x66, 0xff, 0x83, 0x66, 0x62, 0xff, 0x50, 0x46, 0x4b, 0xff, 0x74, 0x5e, 0x57, 0xff, 0x7f, 0x62, 0x5b, 0xff, 0x73, 0x59, 0x53, 0xff, 0x78, 0x61, 0x5b, 0xff, 0x6e, 0x59, 0x57, 0xff, 0x82, 0x6d, 0x6c, 0xdb, 0x55, 0x55, 0x55, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x85, 0xa0, 0x41, 0x62, 0x6b, 0x8f, 0xfe, 0x6a, 0x72, 0x9a, 0xff, 0x72, 0x7a, 0xa2, 0xff, 0x74, 0x7d, 0x9e, 0xff, 0x3b, 0x45, 0x5d, 0xff, 0x0a, 0x0c, 0x17, 0xff, 0x16, 0x12, 0x13, 0xff, 0x2e, 0x23, 0x1b, 0xff, 0x34, 0x2a, 0x25, 0xff, 0x27, 0x2b, 0x38, 0xff, 0x21, 0x33, 0x52, 0xff, 0x28, 0x35, 0x57, 0xff, 0x2e, 0x37, 0x59, 0xff, 0x29, 0x37, 0x5c, 0xff, 0x26, 0x36, 0x5b, 0xff, 0x1f, 0x2f, 0x51, 0xff, 0x17, 0x26, 0x46, 0xff, 0x16, 0x24, 0x40, 0xff, 0x12, 0x20, 0x3d, 0xff, 0x13, 0x21, 0x3d, 0xff, 0x10, 0x1e, 0x3a, 0xff, 0x0f, 0x1e, 0x38, 0xff, 0x0f, 0x1f, 0x38, 0xff, 0x13, 0x1f, 0x3a, 0xff, 0x12, 0x1d, 0x39, 0xff, 0x0f, 0x1d, 0x3c, 0xff, 0x0c, 0x1d, 0x3c, 0xff, 0x09, 0x1a, 0x36, 0xff, 0x00, 0x0e, 0x29, 0xff, 0x20, 0x21, 0x31, 0xff, 0x79, 0x69, 0x6d, 0xff, 0x66, 0x50, 0x4e, 0xff, 0x32, 0x1f, 0x19, 0xff, 0x4e, 0x3e, 0x39, 0xff, 0x75, 0x5d, 0x62, 0xff, 0x8c, 0x6e, 0x6c, 0xff, 0x68, 0x4b, 0x3f, 0xff, 0x3f, 0x29, 0x21, 0xff, 0x19, 0x0f, 0x0f, 0xff, 0x15, 0x0d, 0x0d, 0xff, 0x3a, 0x2a, 0x21, 0xff, 0x79, 0x59, 0x44, 0xff, 0x9c, 0x73, 0x58, 0xff, 0xa3, 0x75, 0x57, 0xff, 0xa7, 0x79, 0x5d, 0xff, 0xd3, 0xae, 0x9b, 0xff, 0xaf, 0x96, 0x89, 0xff, 0x93, 0x76, 0x72, 0xff, 0x82, 0x6f, 0x6c, 0xff, 0x82, 0x86, 0x83, 0xff, 0x57, 0x5c, 0x60, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0xff, 0x04, 0x01, 0x0e, 0xff, 0x05, 0x02, 0x0f, 0xff, 0x02, 0x02, 0x11, 0xff, 0x02, 0x03, 0x11, 0xff, 0x02, 0x03, 0x0c, 0xff, 0x02, 0x01, 0x06, 0xff, 0x58, 0x4e, 0x58, 0xff, 0x54, 0x4b, 0x55, 0xff, 0x41, 0x45, 0x4b, 0xff, 0x33, 0x3d, 0x40, 0xff, 0x26, 0x29, 0x2e, 0xff, 0x3c, 0x32, 0x37, 0xff, 0x4b, 0x44, 0x4a, 0xff, 0x56, 0x54, 0x59, 0xff, 0x51, 0x4d, 0x52, 0xff, 0x38, 0x34, 0x3a, 0xff, 0x27, 0x22, 0x26, 0xff, 0x25, 0x20, 0x22, 0xff, 0x33, 0x2d, 0x30, 0xff, 0x42, 0x3c, 0x3e, 0xff, 0x41, 0x3d, 0x3e, 0xff, 0x0c, 0x09, 0x0a, 0xff, 0x0c, 0x07, 0x07, 0xff, 0x18, 0x11, 0x13, 0xff, 0x3d, 0x31, 0x2c, 0xff, 0x63, 0x50, 0x45, 0xff, 0x5b, 0x45, 0x3d, 0xff, 0x5b, 0x42, 0x3d, 0xff, 0x59, 0x43, 0x42, 0xff, 0x48, 0x38, 0x3c, 0xff, 0x43, 0x34, 0x35, 0xff, 0x42, 0x33, 0x30, 0xff, 0x41, 0x34, 0x32, 0xff, 0x45, 0x37, 0x35, 0xff, 0x4e, 0x3b, 0x3a, 0xff, 0x5c, 0x46, 0x44, 0xff, 0x6e, 0x5a, 0x5b, 0xff, 0x6f, 0x56, 0x52, 0xff, 0xa8, 0x83, 0x77, 0xff, 0xa1, 0x82, 0x7b, 0xff, 0x57, 0x47, 0x49, 0xff, 0x1f, 0x19, 0x1e, 0xff, 0x19, 0x0f, 0x0b, 0xff, 0x1c, 0x15, 0x15, 0xff, 0x46, 0x32, 0x30, 0xff, 0xa8, 0x7d, 0x68, 0xff, 0x82, 0x65, 0x61, 0xff, 0x62, 0x51, 0x55, 0xff, 0x7b, 0x62, 0x5b, 0xff, 0x6e, 0x55, 0x4e, 0xff, 0x70, 0x5a, 0x54, 0xff, 0x4b, 0x37, 0x32, 0xff, 0x6c, 0x59, 0x56, 0xfe, 0x62, 0x52, 0x56, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x62, 0x8e, 0x8f, 0x6b, 0x74, 0x9e, 0xff, 0x6e, 0x77, 0xa1, 0xff, 0x6f, 0x79, 0x9e, 0xff, 0x63, 0x6f, 0x90, 0xff, 0x3f, 0x49, 0x5d, 0xff, 0x1d, 0x1d, 0x2e, 0xff, 0x0d, 0x05, 0x0e, 0xff, 0x15, 0x0f, 0x0b, 0xff, 0x14, 0x17, 0x18, 0xff, 0x1a, 0x23, 0x36, 0xff, 0x30, 0x39, 0x54, 0xff, 0x30, 0x3d, 0x5a, 0xff, 0x27, 0x38, 0x5b, 0xff, 0x1e, 0x31, 0x55, 0xff, 0x12, 0x24, 0x43, 0xff, 0x13, 0x1f, 0x3a, 0xff, 0x13, 0x21, 0x3b, 0xff, 0x10, 0x1f, 0x3a, 0xff, 0x10, 0x1e, 0x3a, 0xff, 0x10, 0x1f, 0x3a, 0xff, 0x11, 0x20, 0x39, 0xff, 0x0f, 0x1e, 0x38, 0xff, 0x11, 0x1e, 0x38, 0xff, 0x11, 0x1f, 0x3b, 0xff, 0x0d, 0x1d, 0x3d, 0xff, 0x0d, 0x1a, 0x3a, 0xff, 0x06, 0x0d, 0x22, 0xff, 0x2a, 0x2a, 0x38, 0xff, 0x8b, 0x78, 0x74, 0xff, 0x96, 0x7a, 0x6f, 0xff, 0x49, 0x34, 0x2e, 0xff, 0x26, 0x1f, 0x1d, 0xff, 0x34, 0x32, 0x36, 0xff, 0x55, 0x4a, 0x58, 0xff, 0x8f, 0x72, 0x73, 0xff, 0x81, 0x5e, 0x52, 0xff, 0x47, 0x2e, 0x26, 0xff, 0x1c, 0x11, 0x11, 0xff, 0x15, 0x0c, 0x0d, 0xff, 0x40, 0x30, 0x27, 0xff, 0x78, 0x58, 0x45, 0xff, 0x91, 0x6a, 0x53, 0xff, 0x98, 0x6f, 0x54, 0xff, 0xb4, 0x8a, 0x6f, 0xff, 0xe3, 0xbc, 0xa5, 0xff, 0xc5, 0xa2, 0x90, 0xff, 0xa3, 0x82, 0x76, 0xff, 0x92, 0x7d, 0x75, 0xff, 0x7b, 0x71, 0x6e, 0xff, 0x80, 0x76, 0x79, 0xff, 0x53, 0x48, 0x4d, 0xff, 0x04, 0x03, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x04, 0x02, 0x0b, 0xff, 0x01, 0x02, 0x0e, 0xff, 0x01, 0x02, 0x10, 0xff, 0x00, 0x00, 0x00, 0xff, 0x37, 0x2f, 0x33, 0xff, 0x6d, 0x63, 0x6a, 0xff, 0x4e, 0x48, 0x50, 0xff, 0x49, 0x48, 0x4e, 0xff, 0x27, 0x28, 0x2d, 0xff, 0x2c, 0x2b, 0x2e, 0xff, 0x54, 0x4e, 0x52, 0xff, 0x62, 0x5d, 0x65, 0xff, 0x49, 0x48, 0x50, 0xff, 0x31, 0x2e, 0x34, 0xff, 0x2a, 0x25, 0x2a, 0xff, 0x28, 0x23, 0x24, 0xff, 0x32, 0x2d, 0x2d, 0xff, 0x37, 0x31, 0x34, 0xff, 0x48, 0x42, 0x46, 0xff, 0x21, 0x20, 0x21, 0xff, 0x00, 0x00, 0x00, 0xff, 0x12, 0x0d, 0x0c, 0xff, 0x20, 0x16, 0x15, 0xff, 0x42, 0x34, 0x31, 0xff, 0x4b, 0x39, 0x36, 0xff, 0x46, 0x34, 0x32, 0xff, 0x47, 0x33, 0x32, 0xff, 0x4c, 0x3a, 0x3b, 0xff, 0x46, 0x37, 0x3b, 0xff, 0x45, 0x37, 0x38, 0xff, 0x46, 0x36, 0x37, 0xff, 0x45, 0x37, 0x37, 0xff, 0x48, 0x39, 0x37, 0xff, 0x4f, 0x3c, 0x3b, 0xff, 0x6a, 0x51, 0x4f, 0xff, 0x76, 0x62, 0x62, 0xff, 0x6d, 0x54, 0x4f, 0xff, 0xb4, 0x8a, 0x80, 0xff, 0x96, 0x7a, 0x76, 0xff, 0x47, 0x40, 0x43, 0xff, 0x1b, 0x15, 0x19, 0xff, 0x1a, 0x0c, 0x07, 0xff, 0x19, 0x12, 0x12, 0xff, 0x4d, 0x3a, 0x35, 0xff, 0xa8, 0x7f, 0x67, 0xff, 0x7d, 0x61, 0x5a, 0xff, 0x74, 0x5e, 0x63, 0xff, 0x7d, 0x60, 0x5a, 0xff, 0x7a, 0x62, 0x5b, 0xff, 0x80, 0x68, 0x63, 0xff, 0x5c, 0x46, 0x43, 0xff, 0x4d, 0x3a, 0x38, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6d, 0x91, 0x07, 0x71, 0x78, 0xa4, 0xd1, 0x68, 0x71, 0x9c, 0xff, 0x56, 0x62, 0x8c, 0xff, 0x43, 0x51, 0x7c, 0xff, 0x40, 0x51, 0x6e, 0xff, 0x46, 0x50, 0x72, 0xff, 0x26, 0x26, 0x46, 0xff, 0x00, 0x01, 0x02, 0xff, 0x08, 0x09, 0x02, 0xff, 0x16, 0x10, 0x19, 0xff, 0x1a, 0x22, 0x38, 0xff, 0x26, 0x37, 0x54, 0xff, 0x1b, 0x2e, 0x51, 0xff, 0x0b, 0x21, 0x44, 0xff, 0x0a, 0x1d, 0x39, 0xff, 0x12, 0x20, 0x34, 0xff, 0x10, 0x1e, 0x36, 0xff, 0x0f, 0x1e, 0x39, 0xff, 0x11, 0x21, 0x3b, 0xff, 0x10, 0x20, 0x3a, 0xff, 0x10, 0x1f, 0x3a, 0xff, 0x0e, 0x1b, 0x38, 0xff, 0x0e, 0x1e, 0x33, 0xff, 0x0c, 0x20, 0x38, 0xff, 0x05, 0x1b, 0x3c, 0xff, 0x00, 0x09, 0x29, 0xff, 0x32, 0x2e, 0x3d, 0xff, 0x79, 0x66, 0x64, 0xff, 0x8d, 0x6e, 0x65, 0xff, 0x6d, 0x4e, 0x4b, 0xff, 0x37, 0x27, 0x2e, 0xff, 0x22, 0x21, 0x2b, 0xff, 0x35, 0x30, 0x35, 0xff, 0x64, 0x49, 0x49, 0xff, 0x97, 0x70, 0x6c, 0xff, 0x9a, 0x78, 0x6e, 0xff, 0x57, 0x3e, 0x36, 0xff, 0x20, 0x12, 0x13, 0xff, 0x16, 0x0a, 0x0b, 0xff, 0x39, 0x28, 0x1e, 0xff, 0x6e, 0x4e, 0x40, 0xff, 0x84, 0x5f, 0x4e, 0xff, 0x96, 0x6e, 0x58, 0xff, 0xbf, 0x97, 0x7e, 0xff, 0xd8, 0xb2, 0x99, 0xff, 0xb3, 0x8b, 0x76, 0xff, 0xb3, 0x94, 0x86, 0xff, 0x84, 0x6f, 0x69, 0xff, 0x6e, 0x57, 0x57, 0xff, 0x7f, 0x61, 0x66, 0xff, 0x8a, 0x73, 0x75, 0xff, 0x48, 0x48, 0x43, 0xff, 0x03, 0x07, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x04, 0x0d, 0xff, 0x00, 0x00, 0x04, 0xff, 0x0f, 0x0b, 0x11, 0xff, 0x7d, 0x6a, 0x67, 0xff, 0x51, 0x4c, 0x4f, 0xff, 0x37, 0x3c, 0x44, 0xff, 0x2a, 0x24, 0x2b, 0xff, 0x2b, 0x21, 0x28, 0xff, 0x58, 0x53, 0x57, 0xff, 0x5d, 0x60, 0x62, 0xff, 0x43, 0x45, 0x4c, 0xff, 0x2d, 0x2c, 0x38, 0xff, 0x23, 0x22, 0x28, 0xff, 0x28, 0x23, 0x26, 0xff, 0x32, 0x2c, 0x2d, 0xff, 0x3f, 0x38, 0x37, 0xff, 0x4b, 0x42, 0x46, 0xff, 0x3e, 0x38, 0x3e, 0xff, 0x01, 0x02, 0x02, 0xff, 0x04, 0x08, 0x08, 0xff, 0x19, 0x15, 0x15, 0xff, 0x2a, 0x1d, 0x1a, 0xff, 0x35, 0x27, 0x27, 0xff, 0x39, 0x2d, 0x31, 0xff, 0x47, 0x37, 0x3c, 0xff, 0x45, 0x34, 0x38, 0xff, 0x3f, 0x2f, 0x31, 0xff, 0x42, 0x33, 0x33, 0xff, 0x44, 0x34, 0x36, 0xff, 0x48, 0x3a, 0x3d, 0xff, 0x49, 0x3c, 0x3c, 0xff, 0x4b, 0x3c, 0x38, 0xff, 0x56, 0x42, 0x3f, 0xff, 0x76, 0x59, 0x58, 0xff, 0x6a, 0x57, 0x56, 0xff, 0x6d, 0x54, 0x4f, 0xff, 0xbf, 0x8e, 0x88, 0xff, 0x88, 0x6d, 0x6b, 0xff, 0x3c, 0x3c, 0x3e, 0xff, 0x1c, 0x15, 0x19, 0xff, 0x1f, 0x0c, 0x06, 0xff, 0x14, 0x0b, 0x0b, 0xff, 0x4c, 0x3c, 0x37, 0xff, 0xaa, 0x80, 0x67, 0xff, 0x83, 0x64, 0x5d, 0xff, 0x76, 0x5d, 0x63, 0xff, 0x7c, 0x5b, 0x55, 0xff, 0x81, 0x65, 0x60, 0xff, 0x7c, 0x65, 0x60, 0xff, 0x73, 0x5f, 0x5b, 0xd1, 0x5f, 0x3f, 0x3f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x6d, 0x97, 0x2a, 0x51, 0x5d, 0x84, 0xf3, 0x3f, 0x49, 0x70, 0xff, 0x42, 0x4c, 0x75, 0xff, 0x48, 0x54, 0x78, 0xff, 0x4a, 0x57, 0x7d, 0xff, 0x45, 0x52, 0x77, 0xff, 0x1c, 0x28, 0x3b, 0xff, 0x00, 0x03, 0x08, 0xff, 0x0c, 0x05, 0x04, 0xff, 0x0b, 0x0d, 0x17, 0xff, 0x10, 0x1d, 0x2f, 0xff, 0x13, 0x23, 0x39, 0xff, 0x0c, 0x20, 0x38, 0xff, 0x0a, 0x1b, 0x36, 0xff, 0x0f, 0x1d, 0x36, 0xff, 0x0c, 0x1e, 0x36, 0xff, 0x0e, 0x1e, 0x36, 0xff, 0x13, 0x1d, 0x35, 0xff, 0x15, 0x1d, 0x36, 0xff, 0x10, 0x1d, 0x37, 0xff, 0x08, 0x1b, 0x36, 0xff, 0x04, 0x1c, 0x3d, 0xff, 0x00, 0x13, 0x32, 0xff, 0x00, 0x0a, 0x1e, 0xff, 0x32, 0x30, 0x3a, 0xff, 0x6f, 0x62, 0x64, 0xff, 0x6a, 0x56, 0x50, 0xff, 0x73, 0x59, 0x56, 0xff, 0x56, 0x3f, 0x42, 0xff, 0x36, 0x29, 0x30, 0xff, 0x31, 0x2a, 0x32, 0xff, 0x3f, 0x33, 0x36, 0xff, 0x61, 0x49, 0x46, 0xff, 0x9a, 0x77, 0x70, 0xff, 0xae, 0x88, 0x7c, 0xff, 0x6b, 0x4e, 0x44, 0xff, 0x1d, 0x13, 0x12, 0xff, 0x06, 0x02, 0x02, 0xff, 0x2d, 0x1d, 0x16, 0xff, 0x70, 0x4f, 0x3e, 0xff, 0x81, 0x5d, 0x49, 0xff, 0x92, 0x6e, 0x5a, 0xff, 0xc3, 0x9f, 0x88, 0xff, 0xe4, 0xbe, 0xa6, 0xff, 0x8d, 0x63, 0x48, 0xff, 0xa5, 0x83, 0x70, 0xff, 0xba, 0x9f, 0x93, 0xff, 0xa4, 0x88, 0x7e, 0xff, 0xb3, 0x92, 0x8e, 0xff, 0x87, 0x6c, 0x6a, 0xff, 0x73, 0x60, 0x5b, 0xff, 0x3e, 0x3b, 0x3b, 0xff, 0x00, 0x01, 0x06, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x55, 0x49, 0x4c, 0xff, 0x87, 0x75, 0x75, 0xff, 0x4d, 0x46, 0x46, 0xff, 0x2a, 0x2a, 0x2c, 0xff, 0x2b, 0x21, 0x24, 0xff, 0x69, 0x5c, 0x62, 0xff, 0x65, 0x5d, 0x65, 0xff, 0x3a, 0x3d, 0x42, 0xff, 0x26, 0x29, 0x2e, 0xff, 0x25, 0x21, 0x28, 0xff, 0x28, 0x23, 0x29, 0xff, 0x30, 0x2b, 0x2f, 0xff, 0x3a, 0x34, 0x38, 0xff, 0x3f, 0x3a, 0x3d, 0xff, 0x51, 0x4b, 0x4f, 0xff, 0x22, 0x1a, 0x21, 0xff, 0x01, 0x00, 0x00, 0xff, 0x11, 0x10, 0x10, 0xff, 0x20, 0x19, 0x18, 0xff, 0x3c, 0x30, 0x2b, 0xff, 0x44, 0x35, 0x34, 0xff, 0x3f, 0x2f, 0x2f, 0xff, 0x40, 0x31, 0x31, 0xff, 0x4b, 0x3a, 0x3a, 0xff, 0x47, 0x37, 0x37, 0xff, 0x40, 0x31, 0x30, 0xff, 0x42, 0x31, 0x2f, 0xff, 0x43, 0x32, 0x32, 0xff, 0x43, 0x35, 0x36, 0xff, 0x4a, 0x3a, 0x3b, 0xff, 0x5a, 0x45, 0x44, 0xff, 0x7e, 0x61, 0x5e, 0xff, 0x66, 0x4e, 0x4c, 0xff, 0x6d, 0x54, 0x50, 0xff, 0xb5, 0x8c, 0x86, 0xff, 0x79, 0x5d, 0x5d, 0xff, 0x3c, 0x34, 0x39, 0xff, 0x19, 0x14, 0x17, 0xff, 0x16, 0x0c, 0x0b, 0xff, 0x17, 0x0a, 0x0a, 0xff, 0x5e, 0x46, 0x3d, 0xff, 0xa2, 0x7f, 0x70, 0xff, 0x6e, 0x53, 0x50, 0xff, 0x6b, 0x55, 0x56, 0xff, 0x70, 0x5d, 0x55, 0xff, 0x78, 0x61, 0x5a, 0xff, 0x8d, 0x69, 0x6b, 0xf4, 0x5b, 0x42, 0x42, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x48, 0x6f, 0x55, 0x44, 0x4c, 0x71, 0xfe, 0x51, 0x59, 0x7d, 0xff, 0x58, 0x5e, 0x84, 0xff, 0x44, 0x50, 0x76, 0xff, 0x2d, 0x41, 0x64, 0xff, 0x39, 0x4c, 0x6a, 0xff, 0x1f, 0x28, 0x3a, 0xff, 0x01, 0x01, 0x06, 0xff, 0x0a, 0x0a, 0x0b, 0xff, 0x0d, 0x12, 0x17, 0xff, 0x0a, 0x14, 0x20, 0xff, 0x0f, 0x20, 0x31, 0xff, 0x0f, 0x1e, 0x38, 0xff, 0x0d, 0x1a, 0x38, 0xff, 0x0b, 0x1b, 0x34, 0xff, 0x0d, 0x1b, 0x32, 0xff, 0x0f, 0x19, 0x2f, 0xff, 0x0f, 0x1a, 0x30, 0xff, 0x10, 0x1b, 0x33, 0xff, 0x09, 0x1a, 0x32, 0xff, 0x00, 0x06, 0x26, 0xff, 0x01, 0x05, 0x1e, 0xff, 0x52, 0x47, 0x4b, 0xff, 0x79, 0x61, 0x5a, 0xff, 0x75, 0x5b, 0x55, 0xff, 0x72, 0x5a, 0x5a, 0xff, 0x73, 0x61, 0x61, 0xff, 0x3f, 0x32, 0x33, 0xff, 0x36, 0x2b, 0x2d, 0xff, 0x37, 0x2c, 0x2e, 0xff, 0x3a, 0x2c, 0x2f, 0xff, 0x56, 0x49, 0x4b, 0xff, 0x8f, 0x74, 0x6d, 0xff, 0xae, 0x86, 0x77, 0xff, 0x7a, 0x59, 0x4c, 0xff, 0x26, 0x1d, 0x19, 0xff, 0x00, 0x01, 0x01, 0xff, 0x26, 0x1a, 0x13, 0xff, 0x6b, 0x4b, 0x3b, 0xff, 0x86, 0x61, 0x4e, 0xff, 0x99, 0x78, 0x64, 0xff, 0xc6, 0xa3, 0x8e, 0xff, 0xe7, 0xc0, 0xa9, 0xff, 0xaa, 0x80, 0x63, 0xff, 0x74, 0x4e, 0x35, 0xff, 0xaf, 0x8a, 0x78, 0xff, 0xa8, 0x87, 0x76, 0xff, 0x66, 0x4c, 0x42, 0xff, 0x7b, 0x64, 0x60, 0xff, 0x7e, 0x61, 0x63, 0xff, 0x55, 0x4b, 0x53, 0xff, 0x38, 0x40, 0x47, 0xff, 0x00, 0x00, 0x00, 0xff, 0x27, 0x1a, 0x1b, 0xff, 0xa6, 0x8f, 0x91, 0xff, 0x60, 0x52, 0x53, 0xff, 0x23, 0x1d, 0x1c, 0xff, 0x34, 0x2c, 0x2d, 0xff, 0x6e, 0x64, 0x66, 0xff, 0x63, 0x5b, 0x5f, 0xff, 0x38, 0x31, 0x38, 0xff, 0x26, 0x25, 0x2f, 0xff, 0x27, 0x27, 0x2e, 0xff, 0x2e, 0x29, 0x2c, 0xff, 0x35, 0x2f, 0x34, 0xff, 0x3a, 0x33, 0x39, 0xff, 0x41, 0x3a, 0x40, 0xff, 0x50, 0x4f, 0x54, 0xff, 0x44, 0x41, 0x47, 0xff, 0x0f, 0x07, 0x0e, 0xff, 0x09, 0x02, 0x07, 0xff, 0x1e, 0x19, 0x19, 0xff, 0x2b, 0x21, 0x1e, 0xff, 0x38, 0x2e, 0x2a, 0xff, 0x4f, 0x3e, 0x3a, 0xff, 0x4b, 0x38, 0x34, 0xff, 0x47, 0x36, 0x31, 0xff, 0x49, 0x37, 0x33, 0xff, 0x48, 0x39, 0x37, 0xff, 0x42, 0x34, 0x32, 0xff, 0x43, 0x33, 0x2f, 0xff, 0x47, 0x34, 0x31, 0xff, 0x48, 0x37, 0x39, 0xff, 0x4b, 0x3b, 0x3e, 0xff, 0x5e, 0x49, 0x4a, 0xff, 0x84, 0x69, 0x62, 0xff, 0x69, 0x4e, 0x4c, 0xff, 0x73, 0x58, 0x55, 0xff, 0xa0, 0x7e, 0x76, 0xff, 0x6d, 0x51, 0x52, 0xff, 0x3e, 0x2f, 0x37, 0xff, 0x16, 0x11, 0x13, 0xff, 0x0e, 0x0c, 0x0e, 0xff, 0x18, 0x0a, 0x07, 0xff, 0x70, 0x51, 0x43, 0xff, 0x98, 0x78, 0x70, 0xff, 0x5e, 0x44, 0x43, 0xff, 0x6d, 0x59, 0x56, 0xff, 0x6b, 0x60, 0x59, 0xff, 0x7f, 0x71, 0x6b, 0xff, 0x79, 0x55, 0x58, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x58, 0x7c, 0x8d, 0x4d, 0x56, 0x7c, 0xff, 0x45, 0x4b, 0x72, 0xff, 0x37, 0x41, 0x6a, 0xff, 0x34, 0x46, 0x6d, 0xff, 0x37, 0x49, 0x6c, 0xff, 0x2c, 0x39, 0x53, 0xff, 0x12, 0x19, 0x2c, 0xff, 0x02, 0x02, 0x07, 0xff, 0x09, 0x0a, 0x0c, 0xff, 0x0c, 0x12, 0x1b, 0xff, 0x05, 0x11, 0x1f, 0xff, 0x12, 0x1f, 0x34, 0xff, 0x0f, 0x1c, 0x36, 0xff, 0x0d, 0x13, 0x2d, 0xff, 0x09, 0x14, 0x2c, 0xff, 0x05, 0x18, 0x2e, 0xff, 0x03, 0x18, 0x2d, 0xff, 0x08, 0x13, 0x28, 0xff, 0x02, 0x03, 0x19, 0xff, 0x2e, 0x1f, 0x29, 0xff, 0x83, 0x69, 0x68, 0xff, 0xa2, 0x84, 0x7d, 0xff, 0x84, 0x61, 0x57, 0xff, 0x7e, 0x5b, 0x55, 0xff, 0x75, 0x53, 0x53, 0xff, 0x57, 0x45, 0x44, 0xff, 0x3b, 0x33, 0x32, 0xff, 0x3d, 0x35, 0x36, 0xff, 0x35, 0x2d, 0x2e, 0xff, 0x41, 0x33, 0x34, 0xff, 0x5c, 0x49, 0x4b, 0xff, 0x8e, 0x72, 0x6c, 0xff, 0xaf, 0x8a, 0x7a, 0xff, 0x8b, 0x69, 0x5c, 0xff, 0x33, 0x26, 0x21, 0xff, 0x06, 0x04, 0x04, 0xff, 0x22, 0x17, 0x10, 0xff, 0x60, 0x43, 0x3b, 0xff, 0x78, 0x56, 0x4d, 0xff, 0x85, 0x65, 0x55, 0xff, 0xb9, 0x97, 0x82, 0xff, 0xdc, 0xb5, 0x9c, 0xff, 0xb2, 0x8c, 0x6e, 0xff, 0x79, 0x4f, 0x34, 0xff, 0xa3, 0x78, 0x61, 0xff, 0x9a, 0x76, 0x65, 0xff, 0x74, 0x59, 0x50, 0xff, 0x99, 0x87, 0x85, 0xff, 0x6b, 0x5d, 0x60, 0xff, 0x1c, 0x1b, 0x1c, 0xff, 0x1c, 0x1f, 0x1e, 0xff, 0x44, 0x38, 0x36, 0xff, 0x9d, 0x7f, 0x7d, 0xff, 0x93, 0x74, 0x71, 0xff, 0x39, 0x2d, 0x29, 0xff, 0x3f, 0x3c, 0x3b, 0xff, 0x6d, 0x67, 0x6a, 0xff, 0x54, 0x4b, 0x50, 0xff, 0x2d, 0x27, 0x2c, 0xff, 0x2c, 0x28, 0x2e, 0xff, 0x2b, 0x2a, 0x31, 0xff, 0x2d, 0x2d, 0x32, 0xff, 0x38, 0x34, 0x39, 0xff, 0x3d, 0x36, 0x3c, 0xff, 0x41, 0x3b, 0x40, 0xff, 0x4f, 0x49, 0x4e, 0xff, 0x57, 0x54, 0x58, 0xff, 0x25, 0x21, 0x27, 0xff, 0x0f, 0x08, 0x0e, 0xff, 0x0b, 0x07, 0x08, 0xff, 0x17, 0x13, 0x13, 0xff, 0x3d, 0x33, 0x33, 0xff, 0x3f, 0x33, 0x30, 0xff, 0x47, 0x36, 0x33, 0xff, 0x51, 0x3e, 0x3b, 0xff, 0x50, 0x3f, 0x3c, 0xff, 0x4a, 0x38, 0x36, 0xff, 0x41, 0x31, 0x2f, 0xff, 0x43, 0x34, 0x32, 0xff, 0x45, 0x35, 0x33, 0xff, 0x48, 0x36, 0x35, 0xff, 0x4a, 0x38, 0x38, 0xff, 0x53, 0x40, 0x41, 0xff, 0x6e, 0x58, 0x56, 0xff, 0x84, 0x6a, 0x65, 0xff, 0x5e, 0x44, 0x42, 0xff, 0x76, 0x5a, 0x57, 0xff, 0xa0, 0x7e, 0x77, 0xff, 0x6a, 0x51, 0x51, 0xff, 0x3c, 0x31, 0x38, 0xff, 0x14, 0x0f, 0x12, 0xff, 0x0e, 0x0b, 0x0a, 0xff, 0x17, 0x0c, 0x03, 0xff, 0x76, 0x59, 0x49, 0xff, 0x93, 0x70, 0x64, 0xff, 0x7f, 0x62, 0x5f, 0xff, 0x7c, 0x63, 0x5f, 0xff, 0x68, 0x54, 0x53, 0xff, 0x56, 0x44, 0x4b, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x3f, 0x4c, 0x71, 0xb1, 0x46, 0x4c, 0x76, 0xff, 0x49, 0x53, 0x7c, 0xff, 0x42, 0x54, 0x7b, 0xff, 0x2b, 0x3f, 0x63, 0xff, 0x16, 0x27, 0x47, 0xff, 0x0f, 0x1a, 0x37, 0xff, 0x0b, 0x0c, 0x16, 0xff, 0x04, 0x03, 0x05, 0xff, 0x08, 0x0c, 0x10, 0xff, 0x14, 0x1a, 0x21, 0xff, 0x08, 0x11, 0x1e, 0xff, 0x0a, 0x14, 0x27, 0xff, 0x11, 0x13, 0x2a, 0xff, 0x0a, 0x12, 0x27, 0xff, 0x00, 0x11, 0x25, 0xff, 0x00, 0x11, 0x22, 0xff, 0x09, 0x0c, 0x1b, 0xff, 0x49, 0x3a, 0x49, 0xff, 0xc1, 0xa0, 0x98, 0xff, 0xc3, 0x9d, 0x88, 0xff, 0x97, 0x72, 0x5f, 0xff, 0x88, 0x63, 0x52, 0xff, 0x81, 0x60, 0x58, 0xff, 0x71, 0x56, 0x54, 0xff, 0x56, 0x46, 0x43, 0xff, 0x48, 0x3e, 0x3c, 0xff, 0x3a, 0x30, 0x31, 0xff, 0x36, 0x2d, 0x2f, 0xff, 0x3e, 0x30, 0x30, 0xff, 0x59, 0x45, 0x46, 0xff, 0x84, 0x69, 0x62, 0xff, 0xb2, 0x8c, 0x7d, 0xff, 0x9a, 0x72, 0x64, 0xff, 0x42, 0x30, 0x2b, 0xff, 0x07, 0x03, 0x03, 0xff, 0x1e, 0x14, 0x0e, 0xff, 0x53, 0x3e, 0x3c, 0xff, 0x58, 0x3d, 0x3d, 0xff, 0x6e, 0x50, 0x45, 0xff, 0xb2, 0x90, 0x7c, 0xff, 0xdb, 0xb8, 0x9e, 0xff, 0xae, 0x8d, 0x70, 0xff, 0x9e, 0x72, 0x58, 0xff, 0xbd, 0x8f, 0x78, 0xff, 0xca, 0xa7, 0x95, 0xff, 0xb4, 0x9d, 0x93, 0xff, 0x76, 0x6b, 0x68, 0xff, 0x13, 0x10, 0x12, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0e, 0x0b, 0x09, 0xff, 0x99, 0x84, 0x82, 0xff, 0xa2, 0x7b, 0x7a, 0xff, 0x6b, 0x48, 0x46, 0xff, 0x62, 0x59, 0x54, 0xff, 0x69, 0x69, 0x68, 0xff, 0x3e, 0x39, 0x3e, 0xff, 0x25, 0x21, 0x25, 0xff, 0x2e, 0x2a, 0x30, 0xff, 0x33, 0x30, 0x37, 0xff, 0x36, 0x34, 0x3a, 0xff, 0x37, 0x37, 0x3b, 0xff, 0x3c, 0x38, 0x3d, 0xff, 0x47, 0x40, 0x45, 0xff, 0x55, 0x4f, 0x54, 0xff, 0x6b, 0x65, 0x6a, 0xff, 0x49, 0x46, 0x4b, 0xff, 0x10, 0x0d, 0x10, 0xff, 0x18, 0x11, 0x14, 0xff, 0x11, 0x0d, 0x0e, 0xff, 0x0c, 0x07, 0x08, 0xff, 0x39, 0x2f, 0x2f, 0xff, 0x59, 0x4d, 0x4d, 0xff, 0x48, 0x37, 0x36, 0xff, 0x49, 0x37, 0x33, 0xff, 0x4f, 0x3f, 0x3b, 0xff, 0x48, 0x37, 0x35, 0xff, 0x41, 0x31, 0x2f, 0xff, 0x3a, 0x2c, 0x2a, 0xff, 0x43, 0x33, 0x32, 0xff, 0x4a, 0x39, 0x37, 0xff, 0x4f, 0x3c, 0x3a, 0xff, 0x5a, 0x45, 0x42, 0xff, 0x75, 0x5e, 0x5a, 0xff, 0x83, 0x69, 0x65, 0xff, 0x5e, 0x44, 0x42, 0xff, 0x75, 0x59, 0x55, 0xff, 0x93, 0x74, 0x6b, 0xff, 0x61, 0x4b, 0x4b, 0xff, 0x37, 0x2f, 0x36, 0xff, 0x13, 0x0d, 0x11, 0xff, 0x0c, 0x07, 0x04, 0xff, 0x1e, 0x13, 0x07, 0xff, 0x82, 0x65, 0x51, 0xff, 0x91, 0x6e, 0x61, 0xff, 0x88, 0x6c, 0x6b, 0xff, 0x7e, 0x63, 0x62, 0xff, 0x63, 0x4c, 0x53, 0xb1, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x4c, 0x7f, 0x0a, 0x62, 0x6b, 0x97, 0xc8, 0x53, 0x5f, 0x8b, 0xff, 0x31, 0x41, 0x66, 0xff, 0x15, 0x27, 0x47, 0xff, 0x0a, 0x1a, 0x37, 0xff, 0x07, 0x14, 0x30, 0xff, 0x0f, 0x14, 0x27, 0xff, 0x0c, 0x0e, 0x17, 0xff, 0x01, 0x04, 0x09, 0xff, 0x08, 0x0b, 0x0f, 0xff, 0x0a, 0x0e, 0x15, 0xff, 0x08, 0x0e, 0x18, 0xff, 0x0a, 0x0e, 0x1f, 0xff, 0x09, 0x0f, 0x22, 0xff, 0x0b, 0x16, 0x27, 0xff, 0x12, 0x1a, 0x28, 0xff, 0x33, 0x2b, 0x31, 0xff, 0x86, 0x6f, 0x70, 0xff, 0xd3, 0xb1, 0x9f, 0xff, 0xb6, 0x94, 0x7b, 0xff, 0x9e, 0x7c, 0x69, 0xff, 0x87, 0x69, 0x58, 0xff, 0x6f, 0x55, 0x4c, 0xff, 0x65, 0x50, 0x4c, 0xff, 0x5b, 0x48, 0x46, 0xff, 0x4c, 0x39, 0x39, 0xff, 0x3b, 0x2d, 0x2e, 0xff, 0x3b, 0x31, 0x31, 0xff, 0x46, 0x37, 0x38, 0xff, 0x5a, 0x46, 0x46, 0xff, 0x82, 0x69, 0x62, 0xff, 0xaf, 0x87, 0x7a, 0xff, 0xa3, 0x77, 0x67, 0xff, 0x57, 0x3f, 0x39, 0xff, 0x0b, 0x04, 0x05, 0xff, 0x17, 0x10, 0x0e, 0xff, 0x43, 0x36, 0x38, 0xff, 0x49, 0x37, 0x38, 0xff, 0x5f, 0x46, 0x3b, 0xff, 0xae, 0x8f, 0x7d, 0xff, 0xe8, 0xc7, 0xb1, 0xff, 0xc0, 0x9f, 0x89, 0xff, 0xbb, 0x94, 0x7f, 0xff, 0xb8, 0x92, 0x7f, 0xff, 0xc2, 0xa5, 0x96, 0xff, 0x88, 0x76, 0x6e, 0xff, 0x10, 0x09, 0x08, 0xff, 0x00, 0x00, 0x00, 0xff, 0x08, 0x06, 0x07, 0xff, 0x69, 0x63, 0x64, 0xff, 0xa1, 0x92, 0x92, 0xff, 0x98, 0x7b, 0x7b, 0xff, 0x87, 0x6d, 0x6e, 0xff, 0x6a, 0x63, 0x63, 0xff, 0x3d, 0x3d, 0x41, 0xff, 0x31, 0x2e, 0x36, 0xff, 0x31, 0x32, 0x37, 0xff, 0x36, 0x36, 0x3c, 0xff, 0x39, 0x39, 0x3f, 0xff, 0x41, 0x3d, 0x44, 0xff, 0x44, 0x41, 0x46, 0xff, 0x48, 0x46, 0x49, 0xff, 0x57, 0x50, 0x55, 0xff, 0x5d, 0x57, 0x5c, 0xff, 0x65, 0x5f, 0x64, 0xff, 0x2b, 0x29, 0x2e, 0xff, 0x0d, 0x0a, 0x0d, 0xff, 0x1a, 0x15, 0x16, 0xff, 0x16, 0x12, 0x13, 0xff, 0x14, 0x0f, 0x10, 0xff, 0x25, 0x1b, 0x1b, 0xff, 0x57, 0x4b, 0x4c, 0xff, 0x63, 0x52, 0x50, 0xff, 0x4b, 0x39, 0x35, 0xff, 0x42, 0x31, 0x2e, 0xff, 0x4b, 0x39, 0x37, 0xff, 0x47, 0x37, 0x36, 0xff, 0x3f, 0x31, 0x2f, 0xff, 0x42, 0x34, 0x33, 0xff, 0x47, 0x37, 0x35, 0xff, 0x54, 0x3f, 0x3b, 0xff, 0x61, 0x4a, 0x44, 0xff, 0x7e, 0x64, 0x5d, 0xff, 0x81, 0x67, 0x63, 0xff, 0x5b, 0x41, 0x40, 0xff, 0x7a, 0x5c, 0x59, 0xff, 0x8e, 0x72, 0x69, 0xff, 0x5c, 0x4b, 0x49, 0xff, 0x30, 0x2a, 0x2f, 0xff, 0x0d, 0x08, 0x0c, 0xff, 0x0a, 0x04, 0x01, 0xff, 0x2e, 0x1f, 0x13, 0xff, 0x8e, 0x70, 0x5e, 0xff, 0x91, 0x70, 0x66, 0xff, 0x6d, 0x55, 0x58, 0xff, 0x5e, 0x4b, 0x4f, 0xc8, 0x66, 0x4c, 0x4c, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x6d, 0x9d, 0x15, 0x36, 0x45, 0x6f, 0xd7, 0x15, 0x25, 0x47, 0xff, 0x0a, 0x1b, 0x36, 0xff, 0x0c, 0x1a, 0x30, 0xff, 0x10, 0x1c, 0x2f, 0xff, 0x0c, 0x17, 0x31, 0xff, 0x09, 0x12, 0x27, 0xff, 0x08, 0x0d, 0x13, 0xff, 0x02, 0x05, 0x05, 0xff, 0x05, 0x07, 0x08, 0xff, 0x07, 0x09, 0x0e, 0xff, 0x00, 0x06, 0x12, 0xff, 0x10, 0x18, 0x27, 0xff, 0x24, 0x23, 0x35, 0xff, 0x2a, 0x22, 0x2d, 0xff, 0x49, 0x36, 0x35, 0xff, 0x7b, 0x62, 0x55, 0xff, 0xc2, 0x9e, 0x90, 0xff, 0xb4, 0x8f, 0x81, 0xff, 0xa1, 0x7f, 0x70, 0xff, 0x89, 0x69, 0x5e, 0xff, 0x69, 0x4d, 0x46, 0xff, 0x6c, 0x52, 0x4d, 0xff, 0x6b, 0x4c, 0x4b, 0xff, 0x5d, 0x3f, 0x3f, 0xff, 0x55, 0x42, 0x42, 0xff, 0x49, 0x3a, 0x3b, 0xff, 0x47, 0x38, 0x36, 0xff, 0x58, 0x48, 0x45, 0xff, 0x78, 0x62, 0x5a, 0xff, 0xa6, 0x7d, 0x6e, 0xff, 0xb8, 0x88, 0x78, 0xff, 0x68, 0x4c, 0x45, 0xff, 0x12, 0x0d, 0x0d, 0xff, 0x12, 0x0c, 0x0c, 0xff, 0x2e, 0x25, 0x28, 0xff, 0x39, 0x2e, 0x2d, 0xff, 0x47, 0x33, 0x29, 0xff, 0xbb, 0x9d, 0x8e, 0xff, 0xe9, 0xc8, 0xb8, 0xff, 0xd5, 0xb3, 0xa3, 0xff, 0xbd, 0x9f, 0x91, 0xff, 0xbb, 0xa2, 0x94, 0xff, 0x86, 0x72, 0x67, 0xff, 0x2b, 0x1d, 0x1b, 0xff, 0x08, 0x01, 0x04, 0xff, 0x0d, 0x09, 0x0c, 0xff, 0x55, 0x4b, 0x53, 0xff, 0x37, 0x31, 0x37, 0xff, 0x32, 0x32, 0x34, 0xff, 0x75, 0x6b, 0x6e, 0xff, 0x68, 0x58, 0x5e, 0xff, 0x48, 0x43, 0x4b, 0xff, 0x36, 0x34, 0x3e, 0xff, 0x40, 0x3e, 0x48, 0xff, 0x42, 0x46, 0x4d, 0xff, 0x44, 0x48, 0x4e, 0xff, 0x43, 0x45, 0x4c, 0xff, 0x4a, 0x48, 0x4f, 0xff, 0x4e, 0x4c, 0x53, 0xff, 0x57, 0x56, 0x5b, 0xff, 0x63, 0x5d, 0x63, 0xff, 0x6d, 0x66, 0x6c, 0xff, 0x5a, 0x53, 0x59, 0xff, 0x14, 0x12, 0x16, 0xff, 0x13, 0x10, 0x12, 0xff, 0x19, 0x13, 0x14, 0xff, 0x16, 0x12, 0x13, 0xff, 0x1b, 0x17, 0x18, 0xff, 0x1a, 0x10, 0x12, 0xff, 0x3a, 0x2b, 0x2f, 0xff, 0x65, 0x54, 0x52, 0xff, 0x5d, 0x4d, 0x48, 0xff, 0x49, 0x39, 0x36, 0xff, 0x40, 0x2e, 0x2e, 0xff, 0x45, 0x35, 0x35, 0xff, 0x4f, 0x41, 0x3e, 0xff, 0x4b, 0x3c, 0x3c, 0xff, 0x48, 0x39, 0x39, 0xff, 0x51, 0x3d, 0x37, 0xff, 0x69, 0x4f, 0x47, 0xff, 0x87, 0x6d, 0x64, 0xff, 0x7b, 0x60, 0x5b, 0xff, 0x5d, 0x43, 0x44, 0xff, 0x84, 0x66, 0x64, 0xff, 0x8c, 0x6e, 0x65, 0xff, 0x57, 0x47, 0x44, 0xff, 0x2d, 0x2a, 0x2f, 0xff, 0x0b, 0x07, 0x0a, 0xff, 0x02, 0x00, 0x00, 0xff, 0x3d, 0x2a, 0x21, 0xff, 0x9b, 0x7d, 0x6b, 0xff, 0x86, 0x67, 0x5f, 0xff, 0x5a, 0x46, 0x4d, 0xd8, 0x48, 0x48, 0x55, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x2d, 0x51, 0x1c, 0x0a, 0x1b, 0x38, 0xdc, 0x0b, 0x1a, 0x2f, 0xff, 0x0c, 0x16, 0x2a, 0xff, 0x0f, 0x15, 0x2a, 0xff, 0x0d, 0x16, 0x2c, 0xff, 0x0a, 0x12, 0x26, 0xff, 0x08, 0x0d, 0x1a, 0xff, 0x00, 0x03, 0x0b, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x05, 0xff, 0x00, 0x01, 0x06, 0xff, 0x1d, 0x1e, 0x24, 0xff, 0x39, 0x2f, 0x37, 0xff, 0x3d, 0x2a, 0x2e, 0xff, 0x59, 0x41, 0x3c, 0xff, 0x74, 0x5c, 0x4f, 0xff, 0xb8, 0x95, 0x84, 0xff, 0xb4, 0x8e, 0x7e, 0xff, 0xa4, 0x7f, 0x73, 0xff, 0x86, 0x64, 0x5c, 0xff, 0x71, 0x51, 0x4c, 0xff, 0x71, 0x54, 0x4e, 0xff, 0x69, 0x4a, 0x47, 0xff, 0x5e, 0x44, 0x42, 0xff, 0x4b, 0x3a, 0x39, 0xff, 0x3b, 0x2d, 0x2f, 0xff, 0x42, 0x34, 0x34, 0xff, 0x50, 0x3f, 0x41, 0xff, 0x71, 0x57, 0x51, 0xff, 0xa5, 0x7c, 0x6b, 0xff, 0xbc, 0x90, 0x7d, 0xff, 0x73, 0x56, 0x4e, 0xff, 0x1d, 0x14, 0x15, 0xff, 0x09, 0x04, 0x05, 0xff, 0x1c, 0x1b, 0x1f, 0xff, 0x15, 0x0f, 0x0c, 0xff, 0x7b, 0x62, 0x4f, 0xff, 0xe6, 0xc1, 0xa5, 0xff, 0xd5, 0xab, 0x97, 0xff, 0xd1, 0xac, 0xa1, 0xff, 0xbc, 0x9d, 0x92, 0xff, 0x87, 0x6d, 0x62, 0xff, 0x44, 0x2d, 0x27, 0xff, 0x3e, 0x29, 0x21, 0xff, 0x27, 0x19, 0x13, 0xff, 0x28, 0x24, 0x25, 0xff, 0x3a, 0x35, 0x3a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x0c, 0x0f, 0xff, 0x38, 0x33, 0x39, 0xff, 0x43, 0x41, 0x4a, 0xff, 0x48, 0x48, 0x4f, 0xff, 0x46, 0x47, 0x4e, 0xff, 0x44, 0x49, 0x4d, 0xff, 0x50, 0x55, 0x57, 0xff, 0x5c, 0x5a, 0x5d, 0xff, 0x5f, 0x57, 0x5a, 0xff, 0x6d, 0x65, 0x65, 0xff, 0x6e, 0x65, 0x65, 0xff, 0x6e, 0x65, 0x68, 0xff, 0x71, 0x6a, 0x6d, 0xff, 0x3b, 0x35, 0x3a, 0xff, 0x04, 0x03, 0x0a, 0xff, 0x18, 0x15, 0x19, 0xff, 0x1b, 0x16, 0x16, 0xff, 0x1e, 0x17, 0x18, 0xff, 0x20, 0x18, 0x18, 0xff, 0x24, 0x1a, 0x1b, 0xff, 0x24, 0x1b, 0x1e, 0xff, 0x56, 0x44, 0x46, 0xff, 0x6d, 0x53, 0x52, 0xff, 0x61, 0x4f, 0x4a, 0xff, 0x55, 0x46, 0x3f, 0xff, 0x44, 0x36, 0x30, 0xff, 0x44, 0x35, 0x33, 0xff, 0x4e, 0x3e, 0x3d, 0xff, 0x51, 0x3d, 0x38, 0xff, 0x5a, 0x40, 0x3b, 0xff, 0x73, 0x55, 0x50, 0xff, 0x86, 0x69, 0x66, 0xff, 0x66, 0x52, 0x4f, 0xff, 0x5e, 0x43, 0x3f, 0xff, 0x94, 0x75, 0x6d, 0xff, 0x7a, 0x64, 0x5f, 0xff, 0x49, 0x3a, 0x3d, 0xff, 0x31, 0x26, 0x2c, 0xff, 0x0c, 0x07, 0x0a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x53, 0x3e, 0x32, 0xff, 0xa1, 0x7f, 0x75, 0xff, 0x6a, 0x4f, 0x4d, 0xdd, 0x48, 0x3f, 0x48, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x17, 0x2e, 0x21, 0x06, 0x14, 0x27, 0xde, 0x0b, 0x14, 0x28, 0xff, 0x0f, 0x14, 0x2e, 0xff, 0x11, 0x17, 0x27, 0xff, 0x09, 0x13, 0x28, 0xff, 0x00, 0x08, 0x20, 0xff, 0x0b, 0x08, 0x11, 0xff, 0x37, 0x2d, 0x2a, 0xff, 0x02, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x1a, 0x1b, 0xff, 0x48, 0x3a, 0x3b, 0xff, 0x4c, 0x37, 0x37, 0xff, 0x5b, 0x44, 0x3f, 0xff, 0x69, 0x52, 0x4b, 0xff, 0xb1, 0x90, 0x7d, 0xff, 0xbd, 0x98, 0x83, 0xff, 0xa9, 0x85, 0x77, 0xff, 0x90, 0x6e, 0x64, 0xff, 0x76, 0x57, 0x50, 0xff, 0x67, 0x4c, 0x44, 0xff, 0x5e, 0x46, 0x40, 0xff, 0x54, 0x40, 0x3e, 0xff, 0x43, 0x34, 0x34, 0xff, 0x3e, 0x31, 0x33, 0xff, 0x38, 0x2a, 0x2e, 0xff, 0x4a, 0x39, 0x3d, 0xff, 0x79, 0x5a, 0x57, 0xff, 0xad, 0x84, 0x75, 0xff, 0xbb, 0x92, 0x80, 0xff, 0x7f, 0x5e, 0x56, 0xff, 0x2b, 0x1c, 0x1e, 0xff, 0x04, 0x02, 0x02, 0xff, 0x06, 0x03, 0x05, 0xff, 0x56, 0x45, 0x43, 0xff, 0xce, 0xb1, 0x9e, 0xff, 0xd5, 0xb0, 0x94, 0xff, 0xdc, 0xba, 0xa1, 0xff, 0xb2, 0x98, 0x8c, 0xff, 0x8e, 0x6e, 0x5f, 0xff, 0x78, 0x58, 0x4b, 0xff, 0x64, 0x49, 0x44, 0xff, 0x50, 0x35, 0x28, 0xff, 0x3e, 0x2c, 0x1f, 0xff, 0x27, 0x27, 0x27, 0xff, 0x17, 0x17, 0x19, 0xff, 0x17, 0x11, 0x11, 0xff, 0x0f, 0x0a, 0x0d, 0xff, 0x02, 0x00, 0x05, 0xff, 0x00, 0x00, 0x00, 0xff, 0x11, 0x13, 0x18, 0xff, 0x30, 0x2e, 0x35, 0xff, 0x47, 0x44, 0x4a, 0xff, 0x53, 0x52, 0x57, 0xff, 0x63, 0x5f, 0x62, 0xff, 0x6a, 0x61, 0x61, 0xff, 0x7f, 0x6e, 0x6f, 0xff, 0x81, 0x71, 0x6e, 0xff, 0x86, 0x78, 0x74, 0xff, 0x79, 0x6e, 0x6d, 0xff, 0x63, 0x5c, 0x5d, 0xff, 0x20, 0x1c, 0x20, 0xff, 0x0d, 0x0d, 0x15, 0xff, 0x1a, 0x17, 0x1c, 0xff, 0x1f, 0x18, 0x19, 0xff, 0x22, 0x18, 0x1a, 0xff, 0x26, 0x1a, 0x19, 0xff, 0x2b, 0x21, 0x21, 0xff, 0x20, 0x1c, 0x1e, 0xff, 0x3a, 0x2c, 0x30, 0xff, 0x69, 0x4f, 0x52, 0xff, 0x6b, 0x57, 0x50, 0xff, 0x63, 0x51, 0x46, 0xff, 0x5e, 0x4b, 0x43, 0xff, 0x48, 0x35, 0x35, 0xff, 0x42, 0x2f, 0x2d, 0xff, 0x57, 0x40, 0x39, 0xff, 0x65, 0x47, 0x44, 0xff, 0x7b, 0x59, 0x5a, 0xff, 0x7a, 0x5f, 0x5e, 0xff, 0x4e, 0x3f, 0x3f, 0xff, 0x5d, 0x41, 0x3b, 0xff, 0x9e, 0x7a, 0x6f, 0xff, 0x67, 0x59, 0x57, 0xff, 0x46, 0x38, 0x3f, 0xff, 0x37, 0x26, 0x2e, 0xff, 0x09, 0x06, 0x0a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x6b, 0x50, 0x43, 0xff, 0x96, 0x71, 0x6f, 0xde, 0x55, 0x3d, 0x45, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x13, 0x27, 0x1a, 0x0b, 0x16, 0x2a, 0xd7, 0x0d, 0x17, 0x31, 0xff, 0x10, 0x1a, 0x28, 0xff, 0x01, 0x16, 0x34, 0xff, 0x00, 0x00, 0x1c, 0xff, 0x4b, 0x36, 0x2e, 0xff, 0xbd, 0x95, 0x78, 0xff, 0x48, 0x33, 0x2b, 0xff, 0x19, 0x13, 0x12, 0xff, 0x42, 0x36, 0x35, 0xff, 0x4a, 0x3b, 0x3c, 0xff, 0x4c, 0x3a, 0x39, 0xff, 0x54, 0x3e, 0x39, 0xff, 0x59, 0x41, 0x3b, 0xff, 0xa5, 0x84, 0x74, 0xff, 0xc3, 0x9e, 0x8b, 0xff, 0xa2, 0x7d, 0x6e, 0xff, 0xa0, 0x7d, 0x71, 0xff, 0x80, 0x62, 0x59, 0xff, 0x66, 0x4b, 0x44, 0xff, 0x5e, 0x45, 0x40, 0xff, 0x54, 0x40, 0x3d, 0xff, 0x44, 0x35, 0x36, 0xff, 0x30, 0x24, 0x27, 0xff, 0x37, 0x2a, 0x2c, 0xff, 0x49, 0x3b, 0x3e, 0xff, 0x71, 0x58, 0x56, 0xff, 0xab, 0x84, 0x78, 0xff, 0xba, 0x8f, 0x7e, 0xff, 0x85, 0x63, 0x59, 0xff, 0x34, 0x26, 0x26, 0xff, 0x00, 0x00, 0x00, 0xff, 0x21, 0x11, 0x11, 0xff, 0xa9, 0x8f, 0x8e, 0xff, 0x95, 0x80, 0x7e, 0xff, 0x95, 0x81, 0x7a, 0xff, 0x96, 0x83, 0x76, 0xff, 0x77, 0x66, 0x55, 0xff, 0x87, 0x6b, 0x58, 0xff, 0x91, 0x71, 0x64, 0xff, 0x68, 0x4e, 0x48, 0xff, 0x51, 0x38, 0x2f, 0xff, 0x48, 0x37, 0x2f, 0xff, 0x2c, 0x2b, 0x2d, 0xff, 0x1a, 0x1a, 0x1f, 0xff, 0x1b, 0x16, 0x18, 0xff, 0x19, 0x16, 0x1a, 0xff, 0x16, 0x12, 0x17, 0xff, 0x15, 0x13, 0x18, 0xff, 0x0e, 0x0d, 0x12, 0xff, 0x08, 0x02, 0x0b, 0xff, 0x12, 0x09, 0x14, 0xff, 0x2b, 0x22, 0x2b, 0xff, 0x43, 0x3b, 0x41, 0xff, 0x68, 0x5c, 0x61, 0xff, 0x7d, 0x6d, 0x73, 0xff, 0x81, 0x72, 0x73, 0xff, 0x98, 0x8c, 0x8b, 0xff, 0x95, 0x8c, 0x8c, 0xff, 0x5d, 0x57, 0x59, 0xff, 0x0b, 0x07, 0x0c, 0xff, 0x15, 0x14, 0x1b, 0xff, 0x1a, 0x16, 0x1a, 0xff, 0x1c, 0x15, 0x16, 0xff, 0x20, 0x18, 0x18, 0xff, 0x27, 0x1d, 0x1d, 0xff, 0x2d, 0x22, 0x23, 0xff, 0x2a, 0x21, 0x23, 0xff, 0x22, 0x1e, 0x22, 0xff, 0x45, 0x3d, 0x3f, 0xff, 0x66, 0x50, 0x4d, 0xff, 0x6b, 0x4d, 0x47, 0xff, 0x65, 0x4a, 0x43, 0xff, 0x5f, 0x4c, 0x48, 0xff, 0x4e, 0x3e, 0x39, 0xff, 0x4b, 0x37, 0x33, 0xff, 0x63, 0x4a, 0x48, 0xff, 0x73, 0x57, 0x57, 0xff, 0x64, 0x4d, 0x4c, 0xff, 0x47, 0x3a, 0x3a, 0xff, 0x6c, 0x50, 0x4a, 0xff, 0x9a, 0x73, 0x6d, 0xff, 0x5d, 0x4f, 0x4e, 0xff, 0x40, 0x35, 0x3b, 0xff, 0x2a, 0x1e, 0x26, 0xff, 0x01, 0x02, 0x04, 0xff, 0x08, 0x00, 0x00, 0xff, 0x7c, 0x5c, 0x53, 0xd7, 0x7a, 0x5e, 0x55, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x17, 0x2e, 0x16, 0x0a, 0x14, 0x2e, 0xca, 0x0c, 0x1a, 0x29, 0xff, 0x00, 0x12, 0x30, 0xff, 0x06, 0x0a, 0x28, 0xff, 0xa3, 0x80, 0x6f, 0xff, 0xcd, 0x94, 0x6b, 0xff, 0x97, 0x73, 0x5f, 0xff, 0x68, 0x53, 0x4d, 0xff, 0x4f, 0x3c, 0x35, 0xff, 0x4c, 0x3a, 0x35, 0xff, 0x4a, 0x38, 0x34, 0xff, 0x46, 0x32, 0x2d, 0xff, 0x4c, 0x36, 0x31, 0xff, 0x9b, 0x7c, 0x6c, 0xff, 0xb6, 0x90, 0x7c, 0xff, 0xa7, 0x7e, 0x6d, 0xff, 0xb6, 0x8f, 0x7f, 0xff, 0x92, 0x71, 0x67, 0xff, 0x69, 0x4e, 0x48, 0xff, 0x59, 0x43, 0x3e, 0xff, 0x4c, 0x39, 0x38, 0xff, 0x38, 0x2b, 0x2c, 0xff, 0x31, 0x27, 0x29, 0xff, 0x39, 0x2c, 0x2f, 0xff, 0x41, 0x34, 0x37, 0xff, 0x69, 0x54, 0x54, 0xff, 0x9c, 0x7a, 0x6f, 0xff, 0xae, 0x83, 0x72, 0xff, 0x92, 0x6f, 0x63, 0xff, 0x43, 0x32, 0x31, 0xff, 0x09, 0x05, 0x06, 0xff, 0x12, 0x0a, 0x09, 0xff, 0x37, 0x2d, 0x2c, 0xff, 0x28, 0x22, 0x2a, 0xff, 0x2a, 0x21, 0x28, 0xff, 0x5a, 0x44, 0x41, 0xff, 0x97, 0x72, 0x63, 0xff, 0x8c, 0x6a, 0x58, 0xff, 0x80, 0x67, 0x5c, 0xff, 0x68, 0x50, 0x4a, 0xff, 0x5c, 0x43, 0x3c, 0xff, 0x48, 0x36, 0x2e, 0xff, 0x26, 0x22, 0x25, 0xff, 0x23, 0x21, 0x29, 0xff, 0x1d, 0x19, 0x1e, 0xff, 0x20, 0x1c, 0x21, 0xff, 0x1b, 0x17, 0x1c, 0xff, 0x19, 0x14, 0x19, 0xff, 0x1a, 0x13, 0x18, 0xff, 0x13, 0x0f, 0x16, 0xff, 0x0f, 0x0c, 0x15, 0xff, 0x08, 0x05, 0x0b, 0xff, 0x13, 0x10, 0x15, 0xff, 0x1a, 0x16, 0x1c, 0xff, 0x24, 0x21, 0x26, 0xff, 0x4b, 0x42, 0x45, 0xff, 0x74, 0x69, 0x69, 0xff, 0x83, 0x7b, 0x7e, 0xff, 0x3d, 0x37, 0x3a, 0xff, 0x0b, 0x07, 0x0c, 0xff, 0x15, 0x14, 0x1b, 0xff, 0x1b, 0x18, 0x1c, 0xff, 0x1d, 0x17, 0x18, 0xff, 0x23, 0x1a, 0x1b, 0xff, 0x2b, 0x1f, 0x20, 0xff, 0x2d, 0x23, 0x24, 0xff, 0x30, 0x26, 0x28, 0xff, 0x21, 0x23, 0x26, 0xff, 0x29, 0x2c, 0x2e, 0xff, 0x5e, 0x4b, 0x4c, 0xff, 0x70, 0x50, 0x4d, 0xff, 0x67, 0x47, 0x42, 0xff, 0x5d, 0x47, 0x40, 0xff, 0x5d, 0x4b, 0x46, 0xff, 0x59, 0x47, 0x44, 0xff, 0x60, 0x4c, 0x49, 0xff, 0x64, 0x4e, 0x4e, 0xff, 0x56, 0x41, 0x40, 0xff, 0x3f, 0x32, 0x31, 0xff, 0x6b, 0x4e, 0x4b, 0xff, 0x95, 0x70, 0x6c, 0xff, 0x51, 0x45, 0x46, 0xff, 0x33, 0x2d, 0x33, 0xff, 0x26, 0x1e, 0x24, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1f, 0x11, 0x0f, 0xca, 0x7f, 0x5c, 0x5c, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x2e, 0x0b, 0x04, 0x18, 0x31, 0xaf, 0x00, 0x00, 0x15, 0xff, 0x4f, 0x45, 0x51, 0xff, 0xd3, 0xac, 0x9d, 0xff, 0xbf, 0x8c, 0x6e, 0xff, 0xb2, 0x88, 0x6c, 0xff, 0x7b, 0x5b, 0x4d, 0xff, 0x51, 0x36, 0x2d, 0xff, 0x4e, 0x38, 0x30, 0xff, 0x4a, 0x37, 0x31, 0xff, 0x45, 0x32, 0x2d, 0xff, 0x4b, 0x35, 0x31, 0xff, 0x87, 0x68, 0x5b, 0xff, 0xb2, 0x8c, 0x78, 0xff, 0xb0, 0x86, 0x72, 0xff, 0xb3, 0x8a, 0x78, 0xff, 0x9a, 0x77, 0x6d, 0xff, 0x67, 0x4c, 0x47, 0xff, 0x53, 0x3e, 0x3c, 0xff, 0x49, 0x37, 0x37, 0xff, 0x39, 0x2d, 0x2f, 0xff, 0x34, 0x2c, 0x30, 0xff, 0x38, 0x2d, 0x31, 0xff, 0x40, 0x31, 0x36, 0xff, 0x66, 0x54, 0x56, 0xff, 0x89, 0x6a, 0x60, 0xff, 0xa6, 0x7b, 0x69, 0xff, 0xa5, 0x80, 0x71, 0xff, 0x4b, 0x38, 0x35, 0xff, 0x15, 0x0c, 0x0d, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x05, 0x06, 0xff, 0x0c, 0x0e, 0x15, 0xff, 0x30, 0x26, 0x2e, 0xff, 0x6c, 0x50, 0x51, 0xff, 0x9e, 0x6d, 0x62, 0xff, 0x7f, 0x5d, 0x51, 0xff, 0x6f, 0x5d, 0x5a, 0xff, 0x63, 0x4e, 0x4c, 0xff, 0x6b, 0x53, 0x4b, 0xff, 0x57, 0x42, 0x3a, 0xff, 0x2c, 0x21, 0x23, 0xff, 0x1f, 0x1b, 0x23, 0xff, 0x25, 0x22, 0x28, 0xff, 0x25, 0x20, 0x25, 0xff, 0x19, 0x12, 0x17, 0xff, 0x1c, 0x16, 0x1a, 0xff, 0x1c, 0x14, 0x17, 0xff, 0x0f, 0x0d, 0x0f, 0xff, 0x15, 0x16, 0x18, 0xff, 0x24, 0x22, 0x25, 0xff, 0x30, 0x2e, 0x30, 0xff, 0x1e, 0x1e, 0x20, 0xff, 0x00, 0x00, 0x00, 0xff, 0x09, 0x07, 0x09, 0xff, 0x35, 0x2a, 0x2d, 0xff, 0x39, 0x32, 0x36, 0xff, 0x24, 0x1e, 0x24, 0xff, 0x1a, 0x16, 0x1b, 0xff, 0x18, 0x17, 0x1d, 0xff, 0x1b, 0x18, 0x1c, 0xff, 0x1d, 0x17, 0x18, 0xff, 0x23, 0x1a, 0x1b, 0xff, 0x2a, 0x1f, 0x1f, 0xff, 0x30, 0x25, 0x26, 0xff, 0x33, 0x29, 0x2a, 0xff, 0x2d, 0x2b, 0x30, 0xff, 0x29, 0x28, 0x2e, 0xff, 0x4f, 0x42, 0x46, 0xff, 0x62, 0x4c, 0x4b, 0xff, 0x6a, 0x4f, 0x4a, 0xff, 0x68, 0x4b, 0x42, 0xff, 0x5c, 0x45, 0x3e, 0xff, 0x64, 0x51, 0x4f, 0xff, 0x72, 0x5e, 0x5d, 0xff, 0x6c, 0x59, 0x57, 0xff, 0x58, 0x45, 0x44, 0xff, 0x47, 0x36, 0x38, 0xff, 0x76, 0x59, 0x58, 0xff, 0x8f, 0x70, 0x6c, 0xff, 0x35, 0x2e, 0x2f, 0xff, 0x32, 0x2f, 0x35, 0xff, 0x34, 0x2c, 0x32, 0xff, 0x00, 0x00, 0x00, 0xb0, 0x45, 0x2e, 0x2e, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x03, 0x10, 0x0c, 0x1b, 0x8b, 0x7f, 0x5d, 0x54, 0xff, 0xb1, 0x8f, 0x8b, 0xff, 0xbc, 0x98, 0x90, 0xff, 0xb9, 0x90, 0x6b, 0xff, 0x91, 0x66, 0x4d, 0xff, 0x61, 0x40, 0x34, 0xff, 0x53, 0x3c, 0x30, 0xff, 0x49, 0x37, 0x30, 0xff, 0x44, 0x31, 0x2d, 0xff, 0x46, 0x2f, 0x2c, 0xff, 0x73, 0x53, 0x45, 0xff, 0xb8, 0x91, 0x7c, 0xff, 0xb0, 0x83, 0x6e, 0xff, 0xb4, 0x88, 0x74, 0xff, 0xa6, 0x82, 0x75, 0xff, 0x72, 0x56, 0x51, 0xff, 0x5b, 0x47, 0x44, 0xff, 0x4d, 0x3e, 0x3d, 0xff, 0x3d, 0x31, 0x34, 0xff, 0x2f, 0x29, 0x2f, 0xff, 0x2b, 0x22, 0x28, 0xff, 0x3d, 0x30, 0x34, 0xff, 0x5c, 0x4e, 0x52, 0xff, 0x7f, 0x62, 0x5a, 0xff, 0xb1, 0x85, 0x70, 0xff, 0xb0, 0x8b, 0x7b, 0xff, 0x5d, 0x4a, 0x47, 0xff, 0x1d, 0x12, 0x13, 0xff, 0x04, 0x02, 0x04, 0xff, 0x07, 0x04, 0x0b, 0xff, 0x21, 0x18, 0x1d, 0xff, 0x3b, 0x2b, 0x2d, 0xff, 0x68, 0x52, 0x4e, 0xff, 0x8c, 0x6c, 0x62, 0xff, 0x74, 0x5b, 0x56, 0xff, 0x5a, 0x49, 0x4d, 0xff, 0x5c, 0x49, 0x4c, 0xff, 0x7d, 0x67, 0x60, 0xff, 0x72, 0x5b, 0x51, 0xff, 0x37, 0x27, 0x23, 0xff, 0x26, 0x22, 0x27, 0xff, 0x15, 0x13, 0x1b, 0xff, 0x1d, 0x18, 0x1e, 0xff, 0x1d, 0x16, 0x1b, 0xff, 0x16, 0x10, 0x14, 0xff, 0x14, 0x0f, 0x12, 0xff, 0x1f, 0x18, 0x19, 0xff, 0x3a, 0x30, 0x31, 0xff, 0x45, 0x38, 0x3a, 0xff, 0x47, 0x3b, 0x3d, 0xff, 0x35, 0x2e, 0x30, 0xff, 0x0c, 0x0a, 0x0a, 0xff, 0x15, 0x12, 0x14, 0xff, 0x36, 0x2e, 0x35, 0xff, 0x3d, 0x38, 0x3f, 0xff, 0x31, 0x2d, 0x32, 0xff, 0x1b, 0x16, 0x1b, 0xff, 0x19, 0x17, 0x1c, 0xff, 0x18, 0x17, 0x1b, 0xff, 0x1d, 0x16, 0x18, 0xff, 0x23, 0x1b, 0x1b, 0xff, 0x2c, 0x20, 0x20, 0xff, 0x34, 0x29, 0x2b, 0xff, 0x32, 0x2c, 0x2c, 0xff, 0x33, 0x29, 0x32, 0xff, 0x33, 0x27, 0x32, 0xff, 0x3e, 0x38, 0x3c, 0xff, 0x55, 0x4c, 0x4a, 0xff, 0x64, 0x51, 0x49, 0xff, 0x72, 0x4f, 0x42, 0xff, 0x67, 0x48, 0x42, 0xff, 0x61, 0x4a, 0x4d, 0xff, 0x68, 0x52, 0x52, 0xff, 0x76, 0x62, 0x61, 0xff, 0x6e, 0x58, 0x5a, 0xff, 0x55, 0x40, 0x44, 0xff, 0x78, 0x5b, 0x5b, 0xff, 0x5a, 0x43, 0x3f, 0xff, 0x15, 0x14, 0x16, 0xff, 0x2f, 0x30, 0x37, 0xff, 0x3c, 0x31, 0x38, 0x8b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x8c, 0x6f, 0x57, 0x7d, 0x4f, 0x49, 0xf3, 0x94, 0x80, 0x85, 0xff, 0xbe, 0x93, 0x81, 0xff, 0xa5, 0x7c, 0x61, 0xff, 0x73, 0x58, 0x47, 0xff, 0x58, 0x3a, 0x31, 0xff, 0x43, 0x28, 0x25, 0xff, 0x40, 0x27, 0x25, 0xff, 0x3f, 0x2d, 0x27, 0xff, 0x68, 0x4d, 0x43, 0xff, 0xad, 0x88, 0x7a, 0xff, 0xa3, 0x79, 0x66, 0xff, 0xb7, 0x8c, 0x79, 0xff, 0xa9, 0x87, 0x7c, 0xff, 0x71, 0x58, 0x56, 0xff, 0x4e, 0x3d, 0x3e, 0xff, 0x3c, 0x2f, 0x30, 0xff, 0x36, 0x2e, 0x30, 0xff, 0x20, 0x1c, 0x1e, 0xff, 0x2b, 0x23, 0x27, 0xff, 0x44, 0x38, 0x3e, 0xff, 0x54, 0x42, 0x45, 0xff, 0x84, 0x66, 0x5e, 0xff, 0xac, 0x84, 0x70, 0xff, 0xbc, 0x91, 0x7f, 0xff, 0x6e, 0x51, 0x4c, 0xff, 0x1a, 0x11, 0x17, 0xff, 0x06, 0x02, 0x08, 0xff, 0x09, 0x03, 0x07, 0xff, 0x1f, 0x18, 0x1a, 0xff, 0x39, 0x2c, 0x2c, 0xff, 0x63, 0x50, 0x4f, 0xff, 0x6e, 0x5e, 0x5c, 0xff, 0x5e, 0x50, 0x50, 0xff, 0x45, 0x3a, 0x3d, 0xff, 0x52, 0x44, 0x46, 0xff, 0x90, 0x72, 0x6a, 0xff, 0x8a, 0x68, 0x5d, 0xff, 0x3f, 0x2d, 0x27, 0xff, 0x3b, 0x34, 0x39, 0xff, 0x20, 0x1b, 0x22, 0xff, 0x08, 0x03, 0x09, 0xff, 0x1d, 0x17, 0x1c, 0xff, 0x33, 0x2a, 0x2e, 0xff, 0x41, 0x34, 0x35, 0xff, 0x46, 0x37, 0x36, 0xff, 0x59, 0x48, 0x47, 0xff, 0x57, 0x44, 0x41, 0xff, 0x4a, 0x36, 0x33, 0xff, 0x49, 0x3a, 0x39, 0xff, 0x17, 0x11, 0x12, 0xff, 0x14, 0x0e, 0x12, 0xff, 0x43, 0x38, 0x3a, 0xff, 0x57, 0x4c, 0x4c, 0xff, 0x37, 0x2f, 0x33, 0xff, 0x19, 0x16, 0x1e, 0xff, 0x18, 0x18, 0x1c, 0xff, 0x1b, 0x18, 0x18, 0xff, 0x1d, 0x17, 0x17, 0xff, 0x23, 0x1c, 0x1c, 0xff, 0x2a, 0x22, 0x22, 0xff, 0x30, 0x28, 0x29, 0xff, 0x31, 0x2b, 0x2e, 0xff, 0x39, 0x2e, 0x33, 0xff, 0x3b, 0x2e, 0x36, 0xff, 0x35, 0x30, 0x36, 0xff, 0x50, 0x49, 0x4e, 0xff, 0x63, 0x51, 0x50, 0xff, 0x6f, 0x50, 0x44, 0xff, 0x6d, 0x4f, 0x46, 0xff, 0x6a, 0x51, 0x50, 0xff, 0x61, 0x4c, 0x4b, 0xff, 0x5f, 0x4c, 0x4e, 0xff, 0x78, 0x63, 0x67, 0xff, 0x70, 0x5a, 0x5b, 0xff, 0x6a, 0x51, 0x52, 0xff, 0x38, 0x29, 0x2a, 0xff, 0x12, 0x12, 0x17, 0xf3, 0x29, 0x26, 0x2b, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x5e, 0x4d, 0x2b, 0x3d, 0x30, 0x30, 0xd2, 0xa7, 0x89, 0x81, 0xff, 0xa9, 0x80, 0x6d, 0xff, 0x74, 0x56, 0x43, 0xff, 0x5b, 0x43, 0x37, 0xff, 0x45, 0x32, 0x29, 0xff, 0x39, 0x23, 0x1c, 0xff, 0x46, 0x2b, 0x26, 0xff, 0x5f, 0x42, 0x3b, 0xff, 0x87, 0x64, 0x58, 0xff, 0x98, 0x6f, 0x5d, 0xff, 0xc6, 0x9c, 0x88, 0xff, 0xac, 0x8a, 0x7a, 0xff, 0x78, 0x5c, 0x54, 0xff, 0x4b, 0x39, 0x3a, 0xff, 0x3d, 0x34, 0x36, 0xff, 0x32, 0x2d, 0x2d, 0xff, 0x1c, 0x19, 0x19, 0xff, 0x35, 0x2f, 0x32, 0xff, 0x33, 0x27, 0x30, 0xff, 0x4c, 0x36, 0x38, 0xff, 0x78, 0x5d, 0x55, 0xff, 0x9c, 0x7b, 0x69, 0xff, 0xb6, 0x87, 0x74, 0xff, 0x76, 0x50, 0x4a, 0xff, 0x21, 0x1b, 0x24, 0xff, 0x07, 0x06, 0x0c, 0xff, 0x05, 0x02, 0x02, 0xff, 0x12, 0x14, 0x15, 0xff, 0x31, 0x27, 0x2a, 0xff, 0x54, 0x42, 0x46, 0xff, 0x5a, 0x4d, 0x52, 0xff, 0x50, 0x46, 0x47, 0xff, 0x35, 0x30, 0x30, 0xff, 0x4c, 0x40, 0x3f, 0xff, 0x96, 0x74, 0x6b, 0xff, 0x94, 0x6c, 0x61, 0xff, 0x4c, 0x39, 0x34, 0xff, 0x44, 0x3c, 0x3f, 0xff, 0x3d, 0x34, 0x39, 0xff, 0x05, 0x00, 0x06, 0xff, 0x27, 0x21, 0x25, 0xff, 0x56, 0x4b, 0x4d, 0xff, 0x5a, 0x46, 0x46, 0xff, 0x60, 0x4c, 0x4a, 0xff, 0x74, 0x61, 0x5c, 0xff, 0x5f, 0x49, 0x41, 0xff, 0x47, 0x32, 0x29, 0xff, 0x4e, 0x3f, 0x39, 0xff, 0x28, 0x1f, 0x20, 0xff, 0x13, 0x0c, 0x0e, 0xff, 0x4a, 0x3b, 0x38, 0xff, 0x6c, 0x58, 0x52, 0xff, 0x3c, 0x30, 0x32, 0xff, 0x1b, 0x19, 0x23, 0xff, 0x1e, 0x1b, 0x20, 0xff, 0x1e, 0x19, 0x17, 0xff, 0x1d, 0x19, 0x17, 0xff, 0x22, 0x1d, 0x1e, 0xff, 0x29, 0x24, 0x26, 0xff, 0x2f, 0x2a, 0x2c, 0xff, 0x34, 0x2f, 0x32, 0xff, 0x3c, 0x33, 0x34, 0xff, 0x41, 0x36, 0x3a, 0xff, 0x37, 0x2f, 0x38, 0xff, 0x4d, 0x42, 0x4b, 0xff, 0x63, 0x51, 0x53, 0xff, 0x68, 0x4e, 0x47, 0xff, 0x6d, 0x50, 0x44, 0xff, 0x6f, 0x55, 0x4c, 0xff, 0x65, 0x50, 0x4d, 0xff, 0x5f, 0x4d, 0x4f, 0xff, 0x67, 0x54, 0x58, 0xff, 0x73, 0x5c, 0x5d, 0xff, 0x72, 0x5d, 0x5f, 0xff, 0x39, 0x2f, 0x33, 0xd2, 0x17, 0x11, 0x17, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x1f, 0x1f, 0x08, 0x41, 0x33, 0x21, 0x8f, 0x9f, 0x79, 0x70, 0xfe, 0x82, 0x58, 0x4f, 0xff, 0x4c, 0x3b, 0x28, 0xff, 0x3f, 0x35, 0x1d, 0xff, 0x3b, 0x27, 0x18, 0xff, 0x51, 0x2e, 0x2c, 0xff, 0x5e, 0x3d, 0x36, 0xff, 0x78, 0x59, 0x4a, 0xff, 0x96, 0x73, 0x62, 0xff, 0xaa, 0x86, 0x71, 0xff, 0xa1, 0x7d, 0x6a, 0xff, 0x86, 0x63, 0x52, 0xff, 0x50, 0x39, 0x36, 0xff, 0x34, 0x28, 0x2c, 0xff, 0x27, 0x20, 0x20, 0xff, 0x23, 0x1f, 0x20, 0xff, 0x28, 0x22, 0x27, 0xff, 0x2f, 0x25, 0x2d, 0xff, 0x5f, 0x4e, 0x53, 0xff, 0x67, 0x55, 0x4f, 0xff, 0x86, 0x6b, 0x5b, 0xff, 0xa8, 0x81, 0x70, 0xff, 0x79, 0x59, 0x52, 0xff, 0x25, 0x1e, 0x22, 0xff, 0x0b, 0x09, 0x0e, 0xff, 0x04, 0x01, 0x02, 0xff, 0x0e, 0x0e, 0x10, 0xff, 0x2d, 0x23, 0x27, 0xff, 0x46, 0x36, 0x39, 0xff, 0x46, 0x3b, 0x3f, 0xff, 0x48, 0x3e, 0x42, 0xff, 0x33, 0x2e, 0x31, 0xff, 0x48, 0x3d, 0x3e, 0xff, 0x93, 0x74, 0x6c, 0xff, 0x9b, 0x75, 0x6a, 0xff, 0x51, 0x3f, 0x3b, 0xff, 0x3f, 0x37, 0x39, 0xff, 0x51, 0x48, 0x4a, 0xff, 0x11, 0x0c, 0x0f, 0xff, 0x33, 0x2c, 0x2e, 0xff, 0x5e, 0x52, 0x52, 0xff, 0x5c, 0x4d, 0x4a, 0xff, 0x81, 0x68, 0x63, 0xff, 0x8d, 0x71, 0x6a, 0xff, 0x56, 0x3c, 0x34, 0xff, 0x49, 0x34, 0x2b, 0xff, 0x5f, 0x4e, 0x48, 0xff, 0x39, 0x29, 0x28, 0xff, 0x16, 0x09, 0x0b, 0xff, 0x48, 0x36, 0x35, 0xff, 0x76, 0x61, 0x5c, 0xff, 0x42, 0x33, 0x36, 0xff, 0x1f, 0x18, 0x20, 0xff, 0x22, 0x1b, 0x1f, 0xff, 0x1f, 0x19, 0x19, 0xff, 0x1f, 0x19, 0x18, 0xff, 0x24, 0x1d, 0x1e, 0xff, 0x2b, 0x25, 0x26, 0xff, 0x34, 0x2d, 0x2e, 0xff, 0x39, 0x33, 0x36, 0xff, 0x3e, 0x35, 0x38, 0xff, 0x44, 0x39, 0x3d, 0xff, 0x3e, 0x35, 0x3c, 0xff, 0x4b, 0x40, 0x45, 0xff, 0x65, 0x53, 0x53, 0xff, 0x6d, 0x54, 0x4f, 0xff, 0x70, 0x51, 0x45, 0xff, 0x72, 0x55, 0x47, 0xff, 0x72, 0x58, 0x53, 0xff, 0x6d, 0x56, 0x56, 0xff, 0x64, 0x4f, 0x51, 0xff, 0x61, 0x4c, 0x50, 0xfe, 0x73, 0x5e, 0x60, 0x8f, 0x3f, 0x3f, 0x3f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x2a, 0x26, 0x42, 0x82, 0x65, 0x60, 0xdb, 0x73, 0x4e, 0x3a, 0xff, 0x65, 0x40, 0x25, 0xff, 0x41, 0x24, 0x13, 0xff, 0x25, 0x16, 0x0e, 0xff, 0x33, 0x21, 0x1e, 0xff, 0x47, 0x32, 0x2f, 0xff, 0x31, 0x1f, 0x1a, 0xff, 0x3f, 0x2b, 0x23, 0xff, 0x9c, 0x82, 0x78, 0xff, 0x9b, 0x7b, 0x70, 0xff, 0x69, 0x50, 0x4c, 0xff, 0x4e, 0x3d, 0x3e, 0xff, 0x2d, 0x23, 0x24, 0xff, 0x19, 0x15, 0x17, 0xff, 0x19, 0x13, 0x18, 0xff, 0x26, 0x1e, 0x27, 0xff, 0x33, 0x2a, 0x32, 0xff, 0x45, 0x3a, 0x3a, 0xff, 0x6d, 0x58, 0x4f, 0xff, 0x81, 0x5f, 0x52, 0xff, 0x7c, 0x5d, 0x57, 0xff, 0x47, 0x3e, 0x3f, 0xff, 0x1d, 0x19, 0x1b, 0xff, 0x03, 0x00, 0x01, 0xff, 0x08, 0x08, 0x0a, 0xff, 0x27, 0x1e, 0x22, 0xff, 0x3d, 0x2e, 0x33, 0xff, 0x34, 0x2d, 0x33, 0xff, 0x38, 0x33, 0x38, 0xff, 0x2f, 0x2b, 0x31, 0xff, 0x44, 0x3c, 0x3f, 0xff, 0x90, 0x72, 0x6d, 0xff, 0x9e, 0x79, 0x6f, 0xff, 0x56, 0x45, 0x43, 0xff, 0x37, 0x2e, 0x2e, 0xff, 0x5b, 0x50, 0x4e, 0xff, 0x27, 0x1d, 0x1d, 0xff, 0x3c, 0x31, 0x31, 0xff, 0x77, 0x68, 0x64, 0xff, 0x72, 0x5f, 0x58, 0xff, 0x8b, 0x6c, 0x63, 0xff, 0x92, 0x70, 0x66, 0xff, 0x60, 0x48, 0x40, 0xff, 0x58, 0x44, 0x3d, 0xff, 0x51, 0x3f, 0x3a, 0xff, 0x47, 0x34, 0x31, 0xff, 0x1b, 0x0b, 0x0c, 0xff, 0x45, 0x33, 0x32, 0xff, 0x7c, 0x65, 0x5f, 0xff, 0x45, 0x34, 0x36, 0xff, 0x21, 0x19, 0x21, 0xff, 0x25, 0x1d, 0x1f, 0xff, 0x22, 0x1a, 0x1a, 0xff, 0x20, 0x18, 0x18, 0xff, 0x26, 0x1d, 0x1e, 0xff, 0x2d, 0x25, 0x25, 0xff, 0x36, 0x2e, 0x2f, 0xff, 0x3e, 0x35, 0x38, 0xff, 0x42, 0x39, 0x3c, 0xff, 0x45, 0x3c, 0x3f, 0xff, 0x43, 0x39, 0x3d, 0xff, 0x4c, 0x3f, 0x42, 0xff, 0x67, 0x56, 0x56, 0xff, 0x6e, 0x5a, 0x56, 0xff, 0x72, 0x55, 0x4a, 0xff, 0x76, 0x55, 0x45, 0xff, 0x76, 0x58, 0x4d, 0xff, 0x75, 0x59, 0x54, 0xff, 0x6f, 0x57, 0x57, 0xdb, 0x64, 0x4d, 0x51, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x09, 0x91, 0x64, 0x5a, 0x87, 0x94, 0x5e, 0x4e, 0xf9, 0x72, 0x50, 0x3e, 0xff, 0x25, 0x20, 0x0c, 0xff, 0x23, 0x18, 0x13, 0xff, 0x34, 0x26, 0x2b, 0xff, 0x12, 0x0e, 0x11, 0xff, 0x09, 0x05, 0x09, 0xff, 0x60, 0x52, 0x55, 0xff, 0xa3, 0x8a, 0x88, 0xff, 0x79, 0x5e, 0x5b, 0xff, 0x61, 0x4b, 0x4a, 0xff, 0x40, 0x35, 0x36, 0xff, 0x21, 0x1c, 0x1e, 0xff, 0x1f, 0x19, 0x21, 0xff, 0x21, 0x18, 0x23, 0xff, 0x27, 0x22, 0x2e, 0xff, 0x49, 0x42, 0x4a, 0xff, 0x5c, 0x4a, 0x46, 0xff, 0x89, 0x68, 0x61, 0xff, 0xa1, 0x82, 0x7d, 0xff, 0x66, 0x56, 0x55, 0xff, 0x28, 0x20, 0x21, 0xff, 0x07, 0x03, 0x04, 0xff, 0x04, 0x05, 0x07, 0xff, 0x21, 0x1b, 0x20, 0xff, 0x31, 0x25, 0x2d, 0xff, 0x22, 0x21, 0x27, 0xff, 0x2a, 0x29, 0x31, 0xff, 0x2d, 0x2b, 0x34, 0xff, 0x44, 0x3d, 0x43, 0xff, 0x93, 0x77, 0x72, 0xff, 0x99, 0x75, 0x6c, 0xff, 0x52, 0x42, 0x40, 0xff, 0x43, 0x35, 0x33, 0xff, 0x69, 0x55, 0x51, 0xff, 0x4a, 0x3a, 0x38, 0xff, 0x4f, 0x41, 0x3c, 0xff, 0x87, 0x73, 0x6c, 0xff, 0x77, 0x5c, 0x54, 0xff, 0x94, 0x71, 0x65, 0xff, 0x99, 0x78, 0x6c, 0xff, 0x6c, 0x57, 0x51, 0xff, 0x3a, 0x2d, 0x29, 0xff, 0x35, 0x28, 0x26, 0xff, 0x50, 0x3f, 0x3d, 0xff, 0x1c, 0x0c, 0x0d, 0xff, 0x44, 0x33, 0x30, 0xff, 0x81, 0x6a, 0x62, 0xff, 0x42, 0x32, 0x33, 0xff, 0x22, 0x1b, 0x22, 0xff, 0x28, 0x21, 0x23, 0xff, 0x25, 0x1e, 0x1d, 0xff, 0x20, 0x18, 0x18, 0xff, 0x25, 0x1d, 0x1e, 0xff, 0x2d, 0x26, 0x27, 0xff, 0x35, 0x2d, 0x2e, 0xff, 0x3c, 0x33, 0x36, 0xff, 0x43, 0x3a, 0x3e, 0xff, 0x49, 0x3f, 0x42, 0xff, 0x45, 0x3a, 0x3c, 0xff, 0x48, 0x39, 0x3b, 0xff, 0x64, 0x52, 0x51, 0xff, 0x74, 0x61, 0x60, 0xff, 0x6e, 0x54, 0x4d, 0xff, 0x71, 0x50, 0x43, 0xff, 0x6f, 0x4f, 0x43, 0xf9, 0x74, 0x54, 0x49, 0x88, 0x71, 0x55, 0x55, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x52, 0x44, 0x25, 0x6f, 0x52, 0x3e, 0xb7, 0x73, 0x51, 0x33, 0xff, 0x46, 0x2f, 0x1f, 0xff, 0x15, 0x0b, 0x0a, 0xff, 0x0a, 0x09, 0x0b, 0xff, 0x0d, 0x0d, 0x13, 0xff, 0x16, 0x0b, 0x0d, 0xff, 0x87, 0x6b, 0x67, 0xff, 0x95, 0x76, 0x73, 0xff, 0x5e, 0x47, 0x45, 0xff, 0x44, 0x36, 0x35, 0xff, 0x27, 0x22, 0x24, 0xff, 0x23, 0x1f, 0x28, 0xff, 0x2f, 0x27, 0x32, 0xff, 0x40, 0x3a, 0x4b, 0xff, 0x40, 0x3c, 0x48, 0xff, 0x5f, 0x4d, 0x4d, 0xff, 0xa4, 0x81, 0x7d, 0xff, 0xac, 0x88, 0x83, 0xff, 0x78, 0x63, 0x60, 0xff, 0x37, 0x2d, 0x2f, 0xff, 0x0c, 0x0b, 0x0b, 0xff, 0x00, 0x02, 0x04, 0xff, 0x1b, 0x15, 0x1b, 0xff, 0x26, 0x1d, 0x25, 0xff, 0x12, 0x13, 0x1d, 0xff, 0x1d, 0x1c, 0x27, 0xff, 0x23, 0x23, 0x2f, 0xff, 0x40, 0x3a, 0x43, 0xff, 0x8c, 0x6d, 0x69, 0xff, 0x96, 0x70, 0x67, 0xff, 0x55, 0x47, 0x46, 0xff, 0x55, 0x44, 0x42, 0xff, 0x76, 0x5b, 0x55, 0xff, 0x66, 0x53, 0x4f, 0xff, 0x6b, 0x57, 0x52, 0xff, 0x86, 0x6b, 0x64, 0xff, 0x98, 0x73, 0x69, 0xff, 0x9f, 0x78, 0x6a, 0xff, 0x8d, 0x6e, 0x62, 0xff, 0x49, 0x39, 0x33, 0xff, 0x1f, 0x1a, 0x18, 0xff, 0x2b, 0x27, 0x28, 0xff, 0x4d, 0x41, 0x44, 0xff, 0x20, 0x12, 0x13, 0xff, 0x49, 0x39, 0x34, 0xff, 0x80, 0x6d, 0x63, 0xff, 0x3c, 0x2e, 0x2d, 0xff, 0x25, 0x20, 0x26, 0xff, 0x26, 0x24, 0x22, 0xff, 0x27, 0x20, 0x1d, 0xff, 0x22, 0x18, 0x19, 0xff, 0x26, 0x1e, 0x1f, 0xff, 0x2c, 0x24, 0x25, 0xff, 0x33, 0x2a, 0x2c, 0xff, 0x3e, 0x33, 0x36, 0xff, 0x43, 0x3a, 0x3d, 0xff, 0x4a, 0x3f, 0x42, 0xff, 0x4a, 0x3d, 0x3e, 0xff, 0x4b, 0x39, 0x39, 0xff, 0x5b, 0x47, 0x46, 0xff, 0x70, 0x5d, 0x5f, 0xff, 0x6e, 0x56, 0x53, 0xff, 0x73, 0x55, 0x4b, 0xb7, 0x72, 0x57, 0x49, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x45, 0x36, 0x46, 0x62, 0x3d, 0x2d, 0xca, 0x3b, 0x24, 0x18, 0xff, 0x15, 0x0e, 0x08, 0xff, 0x0f, 0x0e, 0x0d, 0xff, 0x07, 0x00, 0x00, 0xff, 0x3a, 0x25, 0x25, 0xff, 0x9d, 0x7d, 0x7a, 0xff, 0x75, 0x5c, 0x59, 0xff, 0x42, 0x38, 0x38, 0xff, 0x28, 0x22, 0x26, 0xff, 0x25, 0x1f, 0x26, 0xff, 0x2e, 0x2a, 0x30, 0xff, 0x32, 0x2d, 0x39, 0xff, 0x36, 0x2d, 0x38, 0xff, 0x65, 0x54, 0x56, 0xff, 0x93, 0x76, 0x72, 0xff, 0xa5, 0x84, 0x7f, 0xff, 0x90, 0x71, 0x6a, 0xff, 0x4c, 0x3a, 0x39, 0xff, 0x12, 0x0d, 0x10, 0xff, 0x01, 0x02, 0x05, 0xff, 0x15, 0x10, 0x16, 0xff, 0x20, 0x17, 0x1d, 0xff, 0x12, 0x12, 0x18, 0xff, 0x14, 0x17, 0x20, 0xff, 0x21, 0x20, 0x2b, 0xff, 0x40, 0x36, 0x3f, 0xff, 0x7e, 0x64, 0x64, 0xff, 0x8c, 0x6f, 0x68, 0xff, 0x61, 0x50, 0x4a, 0xff, 0x63, 0x4c, 0x47, 0xff, 0x80, 0x61, 0x5a, 0xff, 0x7a, 0x60, 0x57, 0xff, 0x8a, 0x71, 0x69, 0xff, 0x92, 0x77, 0x6d, 0xff, 0x86, 0x6a, 0x5c, 0xff, 0x82, 0x65, 0x5b, 0xff, 0x67, 0x50, 0x4c, 0xff, 0x2c, 0x22, 0x21, 0xff, 0x26, 0x22, 0x25, 0xff, 0x28, 0x22, 0x24, 0xff, 0x5b, 0x4a, 0x4a, 0xff, 0x2e, 0x22, 0x21, 0xff, 0x47, 0x3a, 0x3a, 0xff, 0x7d, 0x65, 0x63, 0xff, 0x32, 0x26, 0x26, 0xff, 0x23, 0x25, 0x28, 0xff, 0x2b, 0x27, 0x2a, 0xff, 0x28, 0x1f, 0x1f, 0xff, 0x22, 0x19, 0x19, 0xff, 0x28, 0x1d, 0x1f, 0xff, 0x31, 0x24, 0x26, 0xff, 0x34, 0x28, 0x2a, 0xff, 0x39, 0x30, 0x33, 0xff, 0x3d, 0x34, 0x38, 0xff, 0x43, 0x39, 0x3d, 0xff, 0x49, 0x3e, 0x40, 0xff, 0x50, 0x42, 0x43, 0xff, 0x59, 0x48, 0x48, 0xff, 0x6b, 0x57, 0x59, 0xca, 0x74, 0x5e, 0x5e, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x34, 0x27, 0x4d, 0x30, 0x24, 0x1b, 0xcc, 0x19, 0x16, 0x12, 0xff, 0x19, 0x14, 0x16, 0xff, 0x04, 0x00, 0x02, 0xff, 0x6e, 0x53, 0x50, 0xff, 0x8c, 0x75, 0x6f, 0xff, 0x3e, 0x35, 0x38, 0xff, 0x2b, 0x24, 0x2a, 0xff, 0x2a, 0x21, 0x27, 0xff, 0x27, 0x26, 0x27, 0xff, 0x2c, 0x2a, 0x2f, 0xff, 0x40, 0x36, 0x3e, 0xff, 0x5b, 0x4d, 0x4f, 0xff, 0x79, 0x65, 0x62, 0xff, 0x98, 0x7d, 0x77, 0xff, 0xa6, 0x80, 0x75, 0xff, 0x63, 0x48, 0x48, 0xff, 0x1b, 0x13, 0x19, 0xff, 0x04, 0x03, 0x06, 0xff, 0x12, 0x0e, 0x12, 0xff, 0x1a, 0x13, 0x18, 0xff, 0x11, 0x12, 0x14, 0xff, 0x0f, 0x15, 0x1d, 0xff, 0x22, 0x1f, 0x29, 0xff, 0x41, 0x32, 0x39, 0xff, 0x6c, 0x57, 0x5a, 0xff, 0x77, 0x61, 0x5f, 0xff, 0x66, 0x53, 0x4b, 0xff, 0x76, 0x5c, 0x53, 0xff, 0x8b, 0x6b, 0x65, 0xff, 0x7f, 0x62, 0x59, 0xff, 0x8e, 0x74, 0x68, 0xff, 0x7f, 0x67, 0x5d, 0xff, 0x7d, 0x68, 0x5a, 0xff, 0x71, 0x5e, 0x57, 0xff, 0x43, 0x34, 0x36, 0xff, 0x2c, 0x26, 0x29, 0xff, 0x26, 0x23, 0x26, 0xff, 0x32, 0x29, 0x2a, 0xff, 0x67, 0x53, 0x4d, 0xff, 0x2f, 0x24, 0x20, 0xff, 0x48, 0x3b, 0x3e, 0xff, 0x76, 0x5b, 0x5e, 0xff, 0x29, 0x20, 0x21, 0xff, 0x24, 0x2a, 0x2a, 0xff, 0x34, 0x2c, 0x34, 0xff, 0x2b, 0x21, 0x25, 0xff, 0x1f, 0x1a, 0x19, 0xff, 0x28, 0x1c, 0x1e, 0xff, 0x33, 0x25, 0x27, 0xff, 0x35, 0x28, 0x2a, 0xff, 0x34, 0x2e, 0x31, 0xff, 0x3e, 0x35, 0x3a, 0xff, 0x42, 0x38, 0x3c, 0xff, 0x44, 0x3b, 0x3e, 0xff, 0x4d, 0x43, 0x47, 0xcc, 0x59, 0x4c, 0x4c, 0x4d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x17, 0x17, 0x41, 0x26, 0x1c, 0x20, 0xb4, 0x10, 0x0f, 0x16, 0xfe, 0x3c, 0x2b, 0x29, 0xff, 0x8c, 0x75, 0x70, 0xff, 0x4f, 0x3f, 0x42, 0xff, 0x35, 0x2b, 0x30, 0xff, 0x27, 0x20, 0x25, 0xff, 0x21, 0x1d, 0x22, 0xff, 0x2c, 0x27, 0x2e, 0xff, 0x44, 0x3c, 0x44, 0xff, 0x51, 0x44, 0x48, 0xff, 0x68, 0x54, 0x53, 0xff, 0x8d, 0x73, 0x6d, 0xff, 0xab, 0x87, 0x7e, 0xff, 0x78, 0x5f, 0x5e, 0xff, 0x2c, 0x25, 0x28, 0xff, 0x05, 0x05, 0x05, 0xff, 0x09, 0x07, 0x09, 0xff, 0x11, 0x0b, 0x0f, 0xff, 0x0d, 0x0f, 0x12, 0xff, 0x10, 0x15, 0x1d, 0xff, 0x23, 0x1f, 0x2a, 0xff, 0x3b, 0x2f, 0x36, 0xff, 0x5e, 0x4b, 0x4e, 0xff, 0x6c, 0x58, 0x58, 0xff, 0x64, 0x54, 0x4f, 0xff, 0x79, 0x60, 0x5b, 0xff, 0x8b, 0x6c, 0x67, 0xff, 0x70, 0x55, 0x4f, 0xff, 0x81, 0x67, 0x60, 0xff, 0x85, 0x6b, 0x64, 0xff, 0x73, 0x59, 0x4f, 0xff, 0x56, 0x46, 0x3e, 0xff, 0x3b, 0x32, 0x32, 0xff, 0x25, 0x21, 0x23, 0xff, 0x25, 0x22, 0x25, 0xff, 0x34, 0x2c, 0x2c, 0xff, 0x53, 0x44, 0x3f, 0xff, 0x3c, 0x30, 0x2b, 0xff, 0x50, 0x43, 0x41, 0xff, 0x5d, 0x4a, 0x4b, 0xff, 0x25, 0x1c, 0x1d, 0xff, 0x2f, 0x2e, 0x2f, 0xff, 0x3b, 0x32, 0x37, 0xff, 0x2b, 0x22, 0x24, 0xff, 0x20, 0x1a, 0x18, 0xff, 0x29, 0x1d, 0x1f, 0xff, 0x32, 0x24, 0x26, 0xff, 0x34, 0x29, 0x2c, 0xff, 0x32, 0x2b, 0x2e, 0xff, 0x3b, 0x31, 0x36, 0xfe, 0x42, 0x38, 0x3c, 0xb4, 0x42, 0x3a, 0x3a, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x2b, 0x33, 0x23, 0x12, 0x0d, 0x10, 0x88, 0x75, 0x60, 0x60, 0xe6, 0x7b, 0x64, 0x66, 0xff, 0x3a, 0x2e, 0x31, 0xff, 0x22, 0x1f, 0x21, 0xff, 0x22, 0x1b, 0x20, 0xff, 0x32, 0x29, 0x31, 0xff, 0x3c, 0x37, 0x3e, 0xff, 0x44, 0x3b, 0x40, 0xff, 0x5a, 0x4a, 0x4a, 0xff, 0x83, 0x6a, 0x67, 0xff, 0xa1, 0x7e, 0x74, 0xff, 0x84, 0x69, 0x66, 0xff, 0x3d, 0x34, 0x35, 0xff, 0x0e, 0x0e, 0x0d, 0xff, 0x09, 0x06, 0x07, 0xff, 0x10, 0x0b, 0x0d, 0xff, 0x0e, 0x11, 0x13, 0xff, 0x12, 0x16, 0x1d, 0xff, 0x21, 0x1e, 0x27, 0xff, 0x34, 0x2b, 0x32, 0xff, 0x4c, 0x40, 0x43, 0xff, 0x5b, 0x4d, 0x4e, 0xff, 0x58, 0x4b, 0x4b, 0xff, 0x65, 0x52, 0x51, 0xff, 0x74, 0x5c, 0x59, 0xff, 0x64, 0x4c, 0x49, 0xff, 0x78, 0x61, 0x5e, 0xff, 0x76, 0x60, 0x5b, 0xff, 0x61, 0x48, 0x42, 0xff, 0x58, 0x4b, 0x46, 0xff, 0x24, 0x21, 0x22, 0xff, 0x23, 0x1f, 0x22, 0xff, 0x25, 0x21, 0x24, 0xff, 0x30, 0x28, 0x28, 0xff, 0x63, 0x54, 0x4d, 0xff, 0x5b, 0x4a, 0x43, 0xff, 0x4c, 0x3e, 0x3d, 0xff, 0x46, 0x3c, 0x3d, 0xff, 0x20, 0x17, 0x1b, 0xff, 0x3e, 0x35, 0x3a, 0xff, 0x46, 0x3c, 0x3f, 0xff, 0x2c, 0x25, 0x25, 0xff, 0x21, 0x1b, 0x1a, 0xff, 0x29, 0x1d, 0x1f, 0xff, 0x34, 0x26, 0x28, 0xff, 0x33, 0x28, 0x2b, 0xe7, 0x32, 0x2b, 0x2e, 0x88, 0x33, 0x2b, 0x33, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x33, 0x33, 0x05, 0x94, 0x75, 0x78, 0x4a, 0x3c, 0x2c, 0x2c, 0xa0, 0x20, 0x21, 0x21, 0xef, 0x28, 0x20, 0x23, 0xff, 0x33, 0x2a, 0x30, 0xff, 0x36, 0x31, 0x38, 0xff, 0x3d, 0x35, 0x3c, 0xff, 0x50, 0x44, 0x48, 0xff, 0x7a, 0x64, 0x62, 0xff, 0x9f, 0x7f, 0x74, 0xff, 0x91, 0x73, 0x6c, 0xff, 0x56, 0x47, 0x45, 0xff, 0x1f, 0x1a, 0x18, 0xff, 0x0e, 0x07, 0x07, 0xff, 0x15, 0x0e, 0x0f, 0xff, 0x10, 0x10, 0x12, 0xff, 0x13, 0x13, 0x19, 0xff, 0x1f, 0x1c, 0x22, 0xff, 0x2a, 0x26, 0x2b, 0xff, 0x39, 0x30, 0x35, 0xff, 0x47, 0x3c, 0x41, 0xff, 0x4a, 0x3f, 0x44, 0xff, 0x54, 0x46, 0x48, 0xff, 0x60, 0x50, 0x51, 0xff, 0x54, 0x43, 0x43, 0xff, 0x64, 0x54, 0x52, 0xff, 0x7d, 0x6c, 0x6a, 0xff, 0x67, 0x54, 0x50, 0xff, 0x43, 0x3a, 0x37, 0xff, 0x1e, 0x1c, 0x1d, 0xff, 0x28, 0x23, 0x26, 0xff, 0x29, 0x20, 0x25, 0xff, 0x3e, 0x32, 0x31, 0xff, 0x66, 0x55, 0x4c, 0xff, 0x5f, 0x4a, 0x43, 0xff, 0x40, 0x33, 0x32, 0xff, 0x32, 0x30, 0x32, 0xff, 0x1f, 0x18, 0x1e, 0xff, 0x48, 0x37, 0x3f, 0xff, 0x4e, 0x42, 0x45, 0xff, 0x2f, 0x29, 0x29, 0xff, 0x23, 0x1b, 0x1b, 0xef, 0x29, 0x1e, 0x21, 0xa0, 0x33, 0x25, 0x25, 0x4a, 0x33, 0x33, 0x33, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x07, 0x2f, 0x24, 0x2b, 0x46, 0x30, 0x27, 0x2c, 0x8e, 0x33, 0x2e, 0x36, 0xd7, 0x3b, 0x34, 0x3f, 0xff, 0x4b, 0x3f, 0x46, 0xff, 0x72, 0x5c, 0x5a, 0xff, 0x99, 0x78, 0x6b, 0xff, 0x99, 0x78, 0x71, 0xff, 0x68, 0x54, 0x51, 0xff, 0x31, 0x27, 0x21, 0xff, 0x1c, 0x11, 0x10, 0xff, 0x1d, 0x10, 0x14, 0xff, 0x14, 0x11, 0x15, 0xff, 0x14, 0x13, 0x18, 0xff, 0x1e, 0x1a, 0x21, 0xff, 0x21, 0x1f, 0x24, 0xff, 0x28, 0x23, 0x2a, 0xff, 0x35, 0x2c, 0x33, 0xff, 0x42, 0x37, 0x40, 0xff, 0x45, 0x3a, 0x3f, 0xff, 0x4d, 0x44, 0x46, 0xff, 0x49, 0x42, 0x43, 0xff, 0x50, 0x47, 0x47, 0xff, 0x5e, 0x53, 0x53, 0xff, 0x37, 0x28, 0x27, 0xff, 0x2e, 0x27, 0x26, 0xff, 0x27, 0x25, 0x25, 0xff, 0x24, 0x1d, 0x22, 0xff, 0x2d, 0x20, 0x26, 0xff, 0x48, 0x35, 0x33, 0xff, 0x6a, 0x52, 0x48, 0xff, 0x7c, 0x63, 0x5a, 0xff, 0x3a, 0x2f, 0x2a, 0xff, 0x15, 0x1c, 0x1c, 0xff, 0x24, 0x1d, 0x27, 0xff, 0x54, 0x3d, 0x48, 0xd7, 0x54, 0x49, 0x4b, 0x8e, 0x2f, 0x2b, 0x2b, 0x46, 0x24, 0x24, 0x24, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x2f, 0x38, 0x1b, 0x42, 0x36, 0x3f, 0x55, 0x65, 0x52, 0x53, 0x8f, 0x8b, 0x6f, 0x69, 0xc2, 0x98, 0x76, 0x6c, 0xea, 0x7a, 0x60, 0x5b, 0xff, 0x3d, 0x32, 0x30, 0xff, 0x26, 0x1a, 0x1a, 0xff, 0x29, 0x1a, 0x18, 0xff, 0x28, 0x1d, 0x1d, 0xff, 0x1d, 0x17, 0x1a, 0xff, 0x1c, 0x17, 0x1c, 0xff, 0x1e, 0x19, 0x1f, 0xff, 0x23, 0x20, 0x25, 0xff, 0x2c, 0x27, 0x2e, 0xff, 0x39, 0x2f, 0x39, 0xff, 0x3a, 0x33, 0x39, 0xff, 0x40, 0x3a, 0x3b, 0xff, 0x53, 0x49, 0x4b, 0xff, 0x53, 0x46, 0x47, 0xff, 0x5b, 0x4e, 0x4f, 0xff, 0x3b, 0x31, 0x32, 0xff, 0x38, 0x31, 0x33, 0xff, 0x2a, 0x25, 0x27, 0xff, 0x24, 0x1c, 0x1f, 0xff, 0x31, 0x24, 0x27, 0xff, 0x5b, 0x4a, 0x4a, 0xff, 0x6b, 0x5a, 0x56, 0xea, 0x72, 0x5d, 0x55, 0xc2, 0x31, 0x27, 0x23, 0x8f, 0x0f, 0x12, 0x18, 0x55, 0x2f, 0x2f, 0x2f, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x69, 0x69, 0x11, 0x4a, 0x40, 0x45, 0x37, 0x25, 0x1d, 0x1a, 0x5f, 0x2f, 0x20, 0x18, 0x86, 0x32, 0x22, 0x1e, 0xa8, 0x1e, 0x12, 0x15, 0xc0, 0x1f, 0x18, 0x1a, 0xd3, 0x23, 0x1d, 0x23, 0xe6, 0x25, 0x22, 0x26, 0xee, 0x2a, 0x26, 0x2d, 0xf5, 0x30, 0x28, 0x33, 0xff, 0x33, 0x2d, 0x35, 0xff, 0x3e, 0x35, 0x38, 0xf5, 0x5c, 0x4c, 0x4d, 0xee, 0x5d, 0x4b, 0x4b, 0xe6, 0x6a, 0x59, 0x5b, 0xd3, 0x45, 0x3a, 0x3d, 0xc0, 0x24, 0x1e, 0x21, 0xa8, 0x20, 0x1a, 0x1e, 0x86, 0x25, 0x1d, 0x1d, 0x5f, 0x3c, 0x2e, 0x33, 0x37, 0x5a, 0x4b, 0x4b, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const lv_image_dsc_t img_multilang_avatar_13 = {
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .header.w = 128,
+    .header.h = 128,
+    .header.stride = 512,
+    .data = img_multilang_avatar_13_map,
+    .data_size = sizeof(img_multilang_avatar_13_map),
+};
+
+#endif
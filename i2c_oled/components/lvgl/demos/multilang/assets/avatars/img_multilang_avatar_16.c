@@ -0,0 +1,166 @@
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+#if LV_USE_DEMO_MULTILANG
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_16
+    #define LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_16
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_16 uint8_t
+img_multilang_avatar_16_map[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xb4, 0xb4, 0x11, 0xab, 0xb0, 0xb0, 0x37, 0xaa, 0xb0, 0xb0, 0x5e, 0xad, 0xaf, 0xaf, 0x86, 0xae, 0xb1, 0xb1, 0xa8, 0xad, 0xb0, 0xb1, 0xbf, 0xac, 0xb2, 0xb1, 0xd2, 0xac, 0xb2, 0xb1, 0xe5, 0xad, 0xb0, 0xb1, 0xee, 0xac, 0xb1, 0xb2, 0xf2, 0xad, 0xb1, 0xb1, 0xff, 0xad, 0xb2, 0xb1, 0xff, 0xac, 0xb2, 0xb1, 0xf2, 0xad, 0xb2, 0xb1, 0xee, 0xaf, 0xb5, 0xb4, 0xe5, 0xae, 0xb3, 0xb2, 0xd2, 0xae, 0xb4, 0xb2, 0xbf, 0xae, 0xb3, 0xb4, 0xa8, 0xaf, 0xb4, 0xb4, 0x86, 0xb0, 0xb5, 0xb3, 0x5e, 0xb0, 0xb4, 0xb4, 0x37, 0xb4, 0xb4, 0xb4, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xc1, 0xc1, 0x19, 0xba, 0xbd, 0xba, 0x55, 0xae, 0xb4, 0xb2, 0x8f, 0xa9, 0xae, 0xad, 0xc1, 0xa8, 0xae, 0xae, 0xe9, 0xab, 0xb0, 0xaf, 0xff, 0xac, 0xb0, 0xaf, 0xff, 0xac, 0xb1, 0xb0, 0xff, 0xad, 0xb2, 0xb1, 0xff, 0xad, 0xb2, 0xb1, 0xff, 0xad, 0xb2, 0xb1, 0xff, 0xad, 0xb1, 0xb1, 0xff, 0xad, 0xb2, 0xb2, 0xff, 0xae, 0xb2, 0xb2, 0xff, 0xae, 0xb2, 0xb3, 0xff, 0xad, 0xb1, 0xb3, 0xff, 0xad, 0xb1, 0xb2, 0xff, 0xae, 0xb3, 0xb2, 0xff, 0xaf, 0xb4, 0xb3, 0xff, 0xaf, 0xb3, 0xb3, 0xff, 0xaf, 0xb4, 0xb4, 0xff, 0xaf, 0xb4, 0xb3, 0xff, 0xaf, 0xb4, 0xb4, 0xff, 0xaf, 0xb4, 0xb4, 0xff, 0xaf, 0xb4, 0xb3, 0xff, 0xaf, 0xb4, 0xb3, 0xff, 0xb0, 0xb4, 0xb4, 0xff, 0xb0, 0xb3, 0xb4, 0xe9, 0xaf, 0xb3, 0xb5, 0xc1, 0xb0, 0xb2, 0xb4, 0x8f, 0xb1, 0xb4, 0xb4, 0x55, 0xad, 0xb7, 0xb7, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb6, 0xb6, 0x07, 0xb9, 0xbd, 0xbd, 0x46, 0xba, 0xbc, 0xbc, 0x8e, 0xbb, 0xbc, 0xbc, 0xd7, 0xbd, 0xbf, 0xbf, 0xff, 0xb9, 0xbd, 0xbd, 0xff, 0xae, 0xb4, 0xb4, 0xff, 0xa9, 0xac, 0xae, 0xff, 0xaa, 0xae, 0xaf, 0xff, 0xab, 0xb1, 0xaf, 0xff, 0xac, 0xb1, 0xb0, 0xff, 0xac, 0xb0, 0xb0, 0xff, 0xad, 0xb0, 0xb2, 0xff, 0xae, 0xb2, 0xb3, 0xff, 0xae, 0xb3, 0xb3, 0xff, 0xae, 0xb1, 0xb3, 0xff, 0xae, 0xb2, 0xb3, 0xff, 0xaf, 0xb3, 0xb3, 0xff, 0xb0, 0xb3, 0xb4, 0xff, 0xae, 0xb2, 0xb3, 0xff, 0xad, 0xb3, 0xb2, 0xff, 0xaf, 0xb4, 0xb3, 0xff, 0xaf, 0xb4, 0xb3, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb5, 0xb4, 0xff, 0xaf, 0xb4, 0xb3, 0xff, 0xb0, 0xb5, 0xb4, 0xff, 0xb1, 0xb6, 0xb5, 0xff, 0xb0, 0xb5, 0xb4, 0xff, 0xb0, 0xb4, 0xb3, 0xff, 0xb0, 0xb4, 0xb3, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb1, 0xb4, 0xb5, 0xff, 0xb1, 0xb5, 0xb5, 0xff, 0xb0, 0xb4, 0xb4, 0xff, 0xaf, 0xb4, 0xb4, 0xd7, 0xaf, 0xb3, 0xb5, 0x8e, 0xae, 0xb2, 0xb2, 0x46, 0xb6, 0xb6, 0xb6, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0x05, 0xbb, 0xbf, 0xbb, 0x48, 0xba, 0xbd, 0xbd, 0x9f, 0xba, 0xbc, 0xbc, 0xef, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbb, 0xbd, 0xbe, 0xff, 0xb1, 0xb4, 0xb4, 0xff, 0xaa, 0xaf, 0xae, 0xff, 0xab, 0xb0, 0xaf, 0xff, 0xad, 0xb2, 0xb1, 0xff, 0xaf, 0xb4, 0xb3, 0xff, 0xb0, 0xb5, 0xb5, 0xff, 0xb0, 0xb3, 0xb5, 0xff, 0xad, 0xb1, 0xb2, 0xff, 0xae, 0xb1, 0xb3, 0xff, 0xae, 0xb2, 0xb3, 0xff, 0xae, 0xb3, 0xb3, 0xff, 0xaf, 0xb4, 0xb3, 0xff, 0xb0, 0xb4, 0xb3, 0xff, 0xae, 0xb3, 0xb2, 0xff, 0xae, 0xb3, 0xb2, 0xff, 0xae, 0xb4, 0xb2, 0xff, 0xae, 0xb3, 0xb3, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb5, 0xb5, 0xff, 0xb1, 0xb6, 0xb5, 0xff, 0xb1, 0xb5, 0xb5, 0xff, 0xaf, 0xb5, 0xb4, 0xff, 0xb0, 0xb4, 0xb4, 0xff, 0xb1, 0xb3, 0xb3, 0xff, 0xb0, 0xb3, 0xb4, 0xff, 0xb1, 0xb4, 0xb4, 0xff, 0xaf, 0xb3, 0xb2, 0xff, 0xaf, 0xb4, 0xb3, 0xff, 0xaf, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb4, 0xff, 0xb0, 0xb5, 0xb3, 0xff, 0xb0, 0xb5, 0xb3, 0xef, 0xae, 0xb3, 0xb3, 0x9f, 0xad, 0xb4, 0xb4, 0x48, 0x99, 0xcc, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xbd, 0xbd, 0x23, 0xba, 0xbc, 0xbc, 0x86, 0xbb, 0xbc, 0xbc, 0xe5, 0xbb, 0xbf, 0xbf, 0xff, 0xba, 0xbf, 0xc0, 0xff, 0xba, 0xbf, 0xbf, 0xff, 0xba, 0xbf, 0xbe, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbd, 0xbe, 0xc0, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xad, 0xb3, 0xb1, 0xff, 0xb0, 0xb5, 0xb4, 0xff, 0xb0, 0xb6, 0xb4, 0xff, 0xaf, 0xb6, 0xb4, 0xff, 0xb1, 0xb7, 0xb6, 0xff, 0xb2, 0xb7, 0xb5, 0xff, 0xb0, 0xb5, 0xb4, 0xff, 0xae, 0xb3, 0xb2, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xaf, 0xb4, 0xb4, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xaf, 0xb4, 0xb4, 0xff, 0xaf, 0xb4, 0xb3, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb5, 0xb4, 0xff, 0xb0, 0xb5, 0xb4, 0xff, 0xb0, 0xb5, 0xb4, 0xff, 0xb1, 0xb6, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb5, 0xb5, 0xff, 0xb0, 0xb6, 0xb4, 0xff, 0xb0, 0xb5, 0xb4, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xb0, 0xb3, 0xb4, 0xff, 0xb0, 0xb4, 0xb3, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xb0, 0xb3, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xaf, 0xb4, 0xb4, 0xff, 0xb0, 0xb4, 0xb4, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xaf, 0xb3, 0xb4, 0xe5, 0xaf, 0xb2, 0xb2, 0x86, 0xae, 0xae, 0xb6, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xbc, 0xbc, 0x41, 0xb9, 0xbc, 0xbc, 0xb4, 0xbb, 0xbd, 0xbd, 0xfe, 0xbd, 0xbf, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xc0, 0xff, 0xbb, 0xbf, 0xc1, 0xff, 0xbb, 0xbf, 0xc0, 0xff, 0xbc, 0xc0, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbd, 0xbe, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb0, 0xb5, 0xb4, 0xff, 0xb3, 0xb9, 0xb8, 0xff, 0xb3, 0xb9, 0xb7, 0xff, 0xb1, 0xb5, 0xb4, 0xff, 0xaf, 0xb2, 0xb2, 0xff, 0xae, 0xb3, 0xb2, 0xff, 0xb0, 0xb5, 0xb4, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb0, 0xb4, 0xb6, 0xff, 0xae, 0xb2, 0xb4, 0xff, 0xaf, 0xb4, 0xb4, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb5, 0xb4, 0xff, 0xb0, 0xb5, 0xb4, 0xff, 0xb0, 0xb6, 0xb4, 0xff, 0xb1, 0xb6, 0xb5, 0xff, 0xb1, 0xb6, 0xb5, 0xff, 0xb0, 0xb5, 0xb5, 0xff, 0xb2, 0xb4, 0xb5, 0xff, 0xb1, 0xb6, 0xb5, 0xff, 0xb0, 0xb5, 0xb5, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb2, 0xb5, 0xb5, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb0, 0xb4, 0xb6, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb4, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xaf, 0xb2, 0xb4, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xb0, 0xb3, 0xb4, 0xff, 0xae, 0xb2, 0xb3, 0xfe, 0xaf, 0xb3, 0xb5, 0xb4, 0xb0, 0xb4, 0xb4, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbf, 0xbf, 0x4c, 0xbb, 0xbc, 0xbd, 0xcb, 0xbb, 0xbe, 0xbf, 0xff, 0xbb, 0xbe, 0xbd, 0xff, 0xbb, 0xbe, 0xbd, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbf, 0xbf, 0xff, 0xbb, 0xc0, 0xbf, 0xff, 0xbd, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc1, 0xc4, 0xc3, 0xff, 0xc5, 0xc8, 0xc9, 0xff, 0xc9, 0xcb, 0xcc, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xb3, 0xb8, 0xb7, 0xff, 0xb2, 0xb6, 0xb5, 0xff, 0xae, 0xb0, 0xb0, 0xff, 0xb6, 0xb7, 0xb8, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xbd, 0xc1, 0xc0, 0xff, 0xb7, 0xbb, 0xb9, 0xff, 0xb1, 0xb5, 0xb5, 0xff, 0xb3, 0xb8, 0xb7, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb1, 0xb5, 0xb4, 0xff, 0xb0, 0xb6, 0xb5, 0xff, 0xb0, 0xb5, 0xb6, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xaf, 0xb4, 0xb3, 0xff, 0xb0, 0xb5, 0xb4, 0xff, 0xb1, 0xb7, 0xb5, 0xff, 0xb0, 0xb6, 0xb4, 0xff, 0xb1, 0xb5, 0xb4, 0xff, 0xb1, 0xb6, 0xb6, 0xff, 0xb1, 0xb5, 0xb7, 0xff, 0xb2, 0xb6, 0xb6, 0xff, 0xb2, 0xb6, 0xb5, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb0, 0xb5, 0xb4, 0xff, 0xb2, 0xb5, 0xb5, 0xff, 0xb3, 0xb4, 0xb6, 0xff, 0xb0, 0xb4, 0xb4, 0xff, 0xb0, 0xb6, 0xb4, 0xff, 0xb1, 0xb5, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xaf, 0xb4, 0xb4, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xaf, 0xb4, 0xb3, 0xff, 0xb0, 0xb4, 0xb4, 0xff, 0xb0, 0xb3, 0xb5, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xae, 0xb3, 0xb2, 0xcb, 0xaf, 0xb2, 0xb2, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xbd, 0xbd, 0x46, 0xba, 0xbd, 0xbd, 0xc9, 0xbc, 0xbe, 0xbd, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc1, 0xc0, 0xff, 0xbc, 0xc1, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc2, 0xc1, 0xff, 0xbc, 0xc1, 0xc0, 0xff, 0xaa, 0xb0, 0xb0, 0xff, 0x8a, 0x90, 0x90, 0xff, 0x88, 0x8b, 0x8c, 0xff, 0xac, 0xae, 0xae, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xc5, 0xc6, 0xc7, 0xff, 0xc5, 0xc9, 0xc8, 0xff, 0xc5, 0xca, 0xca, 0xff, 0xc8, 0xcc, 0xcc, 0xff, 0xcc, 0xcf, 0xd1, 0xff, 0xd0, 0xd4, 0xd6, 0xff, 0xcd, 0xd3, 0xd2, 0xff, 0xcb, 0xce, 0xce, 0xff, 0xbe, 0xc1, 0xc0, 0xff, 0xac, 0xb2, 0xb0, 0xff, 0xab, 0xb0, 0xb0, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb2, 0xb6, 0xb6, 0xff, 0xb0, 0xb5, 0xb4, 0xff, 0xb0, 0xb6, 0xb4, 0xff, 0xb1, 0xb5, 0xb5, 0xff, 0xb1, 0xb6, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb2, 0xb6, 0xb6, 0xff, 0xb2, 0xb7, 0xb6, 0xff, 0xb0, 0xb6, 0xb5, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb2, 0xb6, 0xb6, 0xff, 0xb0, 0xb6, 0xb4, 0xff, 0xb2, 0xb5, 0xb5, 0xff, 0xb4, 0xb5, 0xb6, 0xff, 0xb2, 0xb4, 0xb6, 0xff, 0xb1, 0xb4, 0xb7, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb5, 0xb5, 0xff, 0xb0, 0xb5, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xaf, 0xb4, 0xb3, 0xff, 0xaf, 0xb4, 0xb4, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb4, 0xff, 0xaf, 0xb4, 0xb3, 0xff, 0xae, 0xb3, 0xb2, 0xff, 0xb0, 0xb4, 0xb2, 0xc9, 0xb2, 0xb2, 0xb2, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xbf, 0xbf, 0x24, 0xb9, 0xbc, 0xbc, 0xb4, 0xba, 0xbc, 0xbc, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbb, 0xbe, 0xbd, 0xff, 0xbc, 0xbd, 0xbf, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbf, 0xc0, 0xc0, 0xff, 0xbd, 0xc0, 0xc0, 0xff, 0xb9, 0xbf, 0xbe, 0xff, 0xc0, 0xc2, 0xc1, 0xff, 0xc4, 0xc7, 0xc7, 0xff, 0xae, 0xb3, 0xb3, 0xff, 0x84, 0x89, 0x8b, 0xff, 0x5e, 0x63, 0x63, 0xff, 0x62, 0x66, 0x65, 0xff, 0x98, 0x9b, 0x9c, 0xff, 0xb7, 0xba, 0xba, 0xff, 0xb7, 0xba, 0xb8, 0xff, 0xc9, 0xcc, 0xcb, 0xff, 0xc4, 0xc6, 0xc6, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc3, 0xc7, 0xc6, 0xff, 0xb4, 0xb5, 0xb4, 0xff, 0x95, 0x95, 0x97, 0xff, 0x85, 0x84, 0x86, 0xff, 0x89, 0x8c, 0x8b, 0xff, 0x97, 0x9d, 0x9d, 0xff, 0xb6, 0xbe, 0xbe, 0xff, 0xd0, 0xd7, 0xd6, 0xff, 0xc7, 0xca, 0xc9, 0xff, 0xad, 0xb1, 0xb2, 0xff, 0xae, 0xb2, 0xb4, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb6, 0xb6, 0xff, 0xb1, 0xb6, 0xb6, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb2, 0xb7, 0xb5, 0xff, 0xb1, 0xb6, 0xb5, 0xff, 0xb0, 0xb5, 0xb5, 0xff, 0xb1, 0xb5, 0xb7, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb1, 0xb7, 0xb4, 0xff, 0xb0, 0xb6, 0xb5, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb1, 0xb5, 0xb5, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xaf, 0xb4, 0xb4, 0xff, 0xb0, 0xb3, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xaf, 0xb4, 0xb3, 0xff, 0xaf, 0xb5, 0xb3, 0xff, 0xaf, 0xb4, 0xb3, 0xff, 0xae, 0xb5, 0xb3, 0xff, 0xaf, 0xb4, 0xb3, 0xff, 0xb0, 0xb1, 0xb4, 0xb5, 0xb1, 0xb1, 0xb1, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x09, 0xb9, 0xbc, 0xbc, 0x87, 0xbb, 0xbd, 0xbd, 0xf9, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbc, 0xbf, 0xc0, 0xff, 0xbd, 0xc0, 0xc0, 0xff, 0xbd, 0xc0, 0xc0, 0xff, 0xbd, 0xc0, 0xc0, 0xff, 0xbe, 0xc2, 0xc2, 0xff, 0xb9, 0xbe, 0xbd, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0x8f, 0x92, 0x94, 0xff, 0x78, 0x7d, 0x7f, 0xff, 0x6a, 0x6e, 0x70, 0xff, 0x70, 0x73, 0x73, 0xff, 0x97, 0x9a, 0x9a, 0xff, 0xbd, 0xc2, 0xc4, 0xff, 0xb2, 0xb7, 0xb9, 0xff, 0xb8, 0xbd, 0xbd, 0xff, 0xc0, 0xc5, 0xc5, 0xff, 0xc4, 0xc7, 0xc8, 0xff, 0xd0, 0xd3, 0xd3, 0xff, 0xda, 0xdd, 0xdd, 0xff, 0xdd, 0xdf, 0xdf, 0xff, 0xd1, 0xd0, 0xce, 0xff, 0xbe, 0xba, 0xb6, 0xff, 0x9a, 0x98, 0x95, 0xff, 0x77, 0x74, 0x74, 0xff, 0x67, 0x64, 0x67, 0xff, 0x7c, 0x7b, 0x7d, 0xff, 0xb4, 0xb9, 0xbd, 0xff, 0xd8, 0xdc, 0xdc, 0xff, 0xbd, 0xc0, 0xc0, 0xff, 0xae, 0xb2, 0xb2, 0xff, 0xb2, 0xb6, 0xb8, 0xff, 0xb4, 0xb8, 0xba, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xb2, 0xb7, 0xb6, 0xff, 0xb2, 0xb7, 0xb6, 0xff, 0xb2, 0xb6, 0xb6, 0xff, 0xb2, 0xb7, 0xb6, 0xff, 0xb2, 0xb6, 0xb5, 0xff, 0xb0, 0xb6, 0xb5, 0xff, 0xb0, 0xb5, 0xb6, 0xff, 0xb0, 0xb5, 0xb6, 0xff, 0xb1, 0xb6, 0xb5, 0xff, 0xb1, 0xb5, 0xb4, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb1, 0xb4, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb0, 0xb5, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xb0, 0xb3, 0xb4, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb1, 0xb4, 0xb4, 0xff, 0xb1, 0xb4, 0xb4, 0xff, 0xb0, 0xb5, 0xb4, 0xff, 0xaf, 0xb4, 0xb5, 0xff, 0xae, 0xb3, 0xb4, 0xff, 0xad, 0xb3, 0xb3, 0xff, 0xaf, 0xb4, 0xb3, 0xf9, 0xaf, 0xb3, 0xb3, 0x87, 0xaa, 0xaa, 0xaa, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbb, 0xbb, 0x40, 0xbc, 0xbc, 0xbd, 0xda, 0xbb, 0xbd, 0xbd, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbe, 0xbe, 0xff, 0xbc, 0xc0, 0xbf, 0xff, 0xbe, 0xc0, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbf, 0xc4, 0xc3, 0xff, 0xbb, 0xc1, 0xbf, 0xff, 0x83, 0x88, 0x87, 0xff, 0x53, 0x59, 0x58, 0xff, 0x5f, 0x65, 0x65, 0xff, 0x74, 0x78, 0x7a, 0xff, 0x7f, 0x83, 0x82, 0xff, 0x9e, 0xa2, 0xa2, 0xff, 0xac, 0xb1, 0xb2, 0xff, 0xac, 0xb1, 0xb4, 0xff, 0xae, 0xb2, 0xb5, 0xff, 0xa7, 0xab, 0xae, 0xff, 0xb2, 0xb6, 0xba, 0xff, 0xb1, 0xb6, 0xb9, 0xff, 0xb7, 0xba, 0xbd, 0xff, 0xc7, 0xcc, 0xce, 0xff, 0xd7, 0xdc, 0xde, 0xff, 0xe8, 0xec, 0xee, 0xff, 0xef, 0xf1, 0xf1, 0xff, 0xde, 0xe1, 0xde, 0xff, 0xb8, 0xb4, 0xb2, 0xff, 0x7b, 0x73, 0x72, 0xff, 0x66, 0x65, 0x64, 0xff, 0x82, 0x86, 0x87, 0xff, 0xc3, 0xc9, 0xcb, 0xff, 0xcd, 0xd3, 0xd2, 0xff, 0xb4, 0xb7, 0xb7, 0xff, 0xb0, 0xb5, 0xb5, 0xff, 0xb3, 0xb8, 0xb7, 0xff, 0xb3, 0xb8, 0xb7, 0xff, 0xb2, 0xb7, 0xb6, 0xff, 0xb2, 0xb7, 0xb6, 0xff, 0xb2, 0xb7, 0xb6, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb6, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb2, 0xb6, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb5, 0xb5, 0xff, 0xb0, 0xb5, 0xb6, 0xff, 0xb1, 0xb4, 0xb5, 0xff, 0xb1, 0xb3, 0xb5, 0xff, 0xaf, 0xb3, 0xb5, 0xff, 0xb0, 0xb3, 0xb5, 0xff, 0xaf, 0xb4, 0xb4, 0xff, 0xaf, 0xb4, 0xb3, 0xff, 0xaf, 0xb4, 0xb3, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xaf, 0xb2, 0xb5, 0xda, 0xb0, 0xb4, 0xb4, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb6, 0xb6, 0x07, 0xb8, 0xbc, 0xbc, 0x8e, 0xb9, 0xbc, 0xbb, 0xfe, 0xba, 0xbd, 0xbd, 0xff, 0xba, 0xbd, 0xbd, 0xff, 0xbb, 0xbe, 0xbe, 0xff, 0xba, 0xbe, 0xbd, 0xff, 0xbb, 0xbf, 0xbe, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xc0, 0xc0, 0xff, 0xbc, 0xc1, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xbe, 0xc0, 0xff, 0xc2, 0xc5, 0xc5, 0xff, 0xbf, 0xc4, 0xc3, 0xff, 0x92, 0x97, 0x96, 0xff, 0x6c, 0x71, 0x70, 0xff, 0x7e, 0x83, 0x82, 0xff, 0x95, 0x98, 0x99, 0xff, 0x75, 0x7a, 0x7a, 0xff, 0x7b, 0x7f, 0x7f, 0xff, 0x9c, 0xa0, 0xa2, 0xff, 0x97, 0x9d, 0xa1, 0xff, 0x8f, 0x96, 0x9a, 0xff, 0x7b, 0x82, 0x88, 0xff, 0x71, 0x78, 0x80, 0xff, 0x79, 0x7f, 0x87, 0xff, 0x7b, 0x83, 0x89, 0xff, 0x81, 0x88, 0x8c, 0xff, 0x87, 0x8d, 0x91, 0xff, 0x9c, 0xa2, 0xa7, 0xff, 0xb8, 0xbd, 0xc2, 0xff, 0xce, 0xd4, 0xd6, 0xff, 0xda, 0xdf, 0xde, 0xff, 0xe5, 0xe8, 0xe8, 0xff, 0xde, 0xdf, 0xdc, 0xff, 0xba, 0xb4, 0xaf, 0xff, 0x7c, 0x76, 0x74, 0xff, 0x66, 0x67, 0x67, 0xff, 0xa9, 0xae, 0xb0, 0xff, 0xd1, 0xd7, 0xd7, 0xff, 0xb6, 0xbb, 0xba, 0xff, 0xb2, 0xb8, 0xb6, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb2, 0xb7, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xaf, 0xb4, 0xb5, 0xff, 0xaf, 0xb4, 0xb5, 0xff, 0xaf, 0xb4, 0xb5, 0xff, 0xb1, 0xb3, 0xb4, 0xff, 0xb0, 0xb5, 0xb3, 0xff, 0xaf, 0xb4, 0xb4, 0xff, 0xae, 0xb2, 0xb4, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xae, 0xb4, 0xb4, 0xfe, 0xae, 0xb3, 0xb5, 0x8e, 0xb6, 0xb6, 0xb6, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xba, 0xc0, 0x29, 0xbb, 0xbd, 0xbd, 0xd1, 0xb9, 0xbc, 0xbc, 0xff, 0xb8, 0xbd, 0xbd, 0xff, 0xb9, 0xbe, 0xbe, 0xff, 0xb9, 0xbe, 0xbe, 0xff, 0xbb, 0xbe, 0xbe, 0xff, 0xbb, 0xbf, 0xbe, 0xff, 0xbb, 0xc0, 0xbf, 0xff, 0xbe, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbe, 0xc1, 0xc2, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc2, 0xc2, 0xff, 0xbd, 0xc1, 0xc1, 0xff, 0xc9, 0xcd, 0xcc, 0xff, 0x9e, 0xa3, 0xa2, 0xff, 0x68, 0x6d, 0x6c, 0xff, 0x8c, 0x90, 0x91, 0xff, 0xaf, 0xb2, 0xb5, 0xff, 0xb1, 0xb5, 0xb7, 0xff, 0x81, 0x89, 0x8a, 0xff, 0x82, 0x89, 0x8c, 0xff, 0x8c, 0x93, 0x96, 0xff, 0x7f, 0x86, 0x8e, 0xff, 0x62, 0x69, 0x76, 0xff, 0x5f, 0x68, 0x77, 0xff, 0x5d, 0x67, 0x76, 0xff, 0x4d, 0x56, 0x67, 0xff, 0x45, 0x4e, 0x5b, 0xff, 0x3c, 0x42, 0x4a, 0xff, 0x39, 0x3d, 0x41, 0xff, 0x44, 0x4a, 0x4c, 0xff, 0x5f, 0x66, 0x66, 0xff, 0x8d, 0x94, 0x96, 0xff, 0xc8, 0xcd, 0xd0, 0xff, 0xe4, 0xe8, 0xe8, 0xff, 0xe6, 0xe8, 0xe8, 0xff, 0xe5, 0xe7, 0xe7, 0xff, 0xdc, 0xd8, 0xd4, 0xff, 0x9b, 0x96, 0x95, 0xff, 0x65, 0x64, 0x65, 0xff, 0x9a, 0x9e, 0x9e, 0xff, 0xcf, 0xd4, 0xd3, 0xff, 0xbb, 0xbe, 0xbd, 0xff, 0xb3, 0xb8, 0xb7, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb7, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb2, 0xb6, 0xb6, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb4, 0xff, 0xb1, 0xb4, 0xb3, 0xff, 0xb1, 0xb5, 0xb4, 0xff, 0xb0, 0xb4, 0xb3, 0xff, 0xaf, 0xb4, 0xb2, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xb0, 0xb2, 0xb4, 0xff, 0xaf, 0xb4, 0xb4, 0xff, 0xaf, 0xb4, 0xb4, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xaf, 0xb4, 0xb4, 0xd1, 0xae, 0xb4, 0xb4, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xbd, 0xba, 0x56, 0xba, 0xbc, 0xbc, 0xf3, 0xba, 0xbc, 0xbc, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbb, 0xbd, 0xbf, 0xff, 0xbb, 0xbd, 0xbf, 0xff, 0xbb, 0xbd, 0xbf, 0xff, 0xbe, 0xbf, 0xbf, 0xff, 0xbe, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc4, 0xca, 0xc8, 0xff, 0xb4, 0xb7, 0xb7, 0xff, 0x6c, 0x70, 0x6f, 0xff, 0x8f, 0x94, 0x93, 0xff, 0xb8, 0xbc, 0xbe, 0xff, 0xb3, 0xb8, 0xbb, 0xff, 0xa6, 0xac, 0xae, 0xff, 0x7d, 0x88, 0x91, 0xff, 0x71, 0x7a, 0x89, 0xff, 0x73, 0x7c, 0x8d, 0xff, 0x69, 0x72, 0x87, 0xff, 0x5d, 0x6a, 0x85, 0xff, 0x5b, 0x6b, 0x8d, 0xff, 0x4b, 0x5c, 0x7a, 0xff, 0x40, 0x4e, 0x66, 0xff, 0x34, 0x3d, 0x4f, 0xff, 0x20, 0x25, 0x2f, 0xff, 0x12, 0x18, 0x1e, 0xff, 0x0b, 0x0e, 0x10, 0xff, 0x04, 0x05, 0x07, 0xff, 0x0f, 0x13, 0x19, 0xff, 0x40, 0x48, 0x4f, 0xff, 0xae, 0xb5, 0xba, 0xff, 0xf1, 0xf6, 0xf7, 0xff, 0xde, 0xe1, 0xdf, 0xff, 0xdf, 0xe0, 0xdf, 0xff, 0xe7, 0xe4, 0xe3, 0xff, 0xb1, 0xab, 0xa8, 0xff, 0x6a, 0x69, 0x67, 0xff, 0xa1, 0xa6, 0xa6, 0xff, 0xcd, 0xd0, 0xd2, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb3, 0xb8, 0xb7, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb1, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb4, 0xff, 0xaf, 0xb5, 0xb3, 0xff, 0xaf, 0xb4, 0xb3, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xb0, 0xb3, 0xb4, 0xff, 0xaf, 0xb4, 0xb3, 0xff, 0xaf, 0xb4, 0xb4, 0xff, 0xb1, 0xb4, 0xb6, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb5, 0xb6, 0xff, 0xb0, 0xb4, 0xb4, 0xf3, 0xae, 0xb4, 0xb4, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0xb8, 0xba, 0xba, 0x8a, 0xba, 0xbc, 0xbb, 0xfe, 0xba, 0xbc, 0xbc, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbd, 0xbe, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc1, 0xc1, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc1, 0xc4, 0xc3, 0xff, 0xc7, 0xcc, 0xcb, 0xff, 0x86, 0x8a, 0x89, 0xff, 0x86, 0x8a, 0x8a, 0xff, 0xaa, 0xae, 0xaf, 0xff, 0x97, 0x9b, 0x9e, 0xff, 0x88, 0x8d, 0x90, 0xff, 0x85, 0x8d, 0x92, 0xff, 0x71, 0x7c, 0x8e, 0xff, 0x5c, 0x6b, 0x84, 0xff, 0x5a, 0x6b, 0x8e, 0xff, 0x54, 0x6a, 0x94, 0xff, 0x54, 0x6d, 0x95, 0xff, 0x5c, 0x74, 0x9f, 0xff, 0x58, 0x6e, 0x96, 0xff, 0x5f, 0x75, 0x98, 0xff, 0x53, 0x67, 0x84, 0xff, 0x42, 0x51, 0x6a, 0xff, 0x25, 0x31, 0x47, 0xff, 0x0f, 0x16, 0x28, 0xff, 0x01, 0x08, 0x19, 0xff, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x0f, 0x16, 0xff, 0x88, 0x92, 0x99, 0xff, 0xec, 0xf0, 0xf0, 0xff, 0xce, 0xd1, 0xd0, 0xff, 0xe6, 0xe5, 0xe5, 0xff, 0xdf, 0xd9, 0xd8, 0xff, 0xa3, 0xa1, 0x9f, 0xff, 0x6d, 0x6f, 0x6d, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xcc, 0xd2, 0xd1, 0xff, 0xb0, 0xb5, 0xb4, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb3, 0xb7, 0xb9, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb1, 0xb5, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xaf, 0xb3, 0xb5, 0xff, 0xb0, 0xb4, 0xb4, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb5, 0xb4, 0xff, 0xb0, 0xb4, 0xb4, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb1, 0xb4, 0xb5, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb0, 0xb4, 0xb5, 0xfe, 0xb0, 0xb5, 0xb5, 0x8b, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xb9, 0xb9, 0x0b, 0xba, 0xbb, 0xbb, 0xae, 0xb9, 0xbc, 0xbb, 0xff, 0xba, 0xbd, 0xbd, 0xff, 0xba, 0xbc, 0xbe, 0xff, 0xbc, 0xbd, 0xbe, 0xff, 0xbd, 0xc0, 0xc0, 0xff, 0xbc, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc2, 0xc2, 0xff, 0xbf, 0xc2, 0xc2, 0xff, 0xc2, 0xc4, 0xc3, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xa3, 0xa9, 0xa7, 0xff, 0x7f, 0x84, 0x82, 0xff, 0x9c, 0xa1, 0xa1, 0xff, 0x83, 0x88, 0x8b, 0xff, 0x83, 0x87, 0x89, 0xff, 0x8a, 0x8e, 0x8f, 0xff, 0x86, 0x8d, 0x93, 0xff, 0x68, 0x75, 0x8c, 0xff, 0x52, 0x66, 0x86, 0xff, 0x4f, 0x67, 0x90, 0xff, 0x55, 0x72, 0xa1, 0xff, 0x60, 0x7e, 0xad, 0xff, 0x70, 0x8d, 0xc0, 0xff, 0x7d, 0x9b, 0xcb, 0xff, 0x7d, 0x9b, 0xcb, 0xff, 0x74, 0x94, 0xc4, 0xff, 0x71, 0x91, 0xc1, 0xff, 0x6a, 0x87, 0xb6, 0xff, 0x60, 0x7a, 0xa9, 0xff, 0x4a, 0x65, 0x96, 0xff, 0x31, 0x45, 0x70, 0xff, 0x16, 0x20, 0x39, 0xff, 0x00, 0x00, 0x00, 0xff, 0x06, 0x0b, 0x10, 0xff, 0x95, 0x9f, 0xa4, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xc8, 0xc8, 0xc7, 0xff, 0xd6, 0xd4, 0xd3, 0xff, 0xc2, 0xc1, 0xc0, 0xff, 0x9a, 0x97, 0x95, 0xff, 0x7c, 0x7e, 0x7a, 0xff, 0xc4, 0xca, 0xc8, 0xff, 0xc3, 0xc7, 0xc7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb4, 0xb8, 0xba, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb7, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb4, 0xb5, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb1, 0xb5, 0xb5, 0xff, 0xb1, 0xb4, 0xb4, 0xff, 0xaf, 0xb4, 0xb5, 0xff, 0xb1, 0xb4, 0xb5, 0xff, 0xb3, 0xb4, 0xb5, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb4, 0xff, 0xb1, 0xb6, 0xb4, 0xaf, 0xb9, 0xb9, 0xb9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xb9, 0xb9, 0x16, 0xba, 0xbd, 0xbd, 0xc9, 0xba, 0xbc, 0xbc, 0xff, 0xbb, 0xbe, 0xbd, 0xff, 0xb9, 0xc0, 0xbe, 0xff, 0xbb, 0xbe, 0xbf, 0xff, 0xbd, 0xbe, 0xbf, 0xff, 0xbc, 0xbf, 0xbe, 0xff, 0xbc, 0xbf, 0xbf, 0xff, 0xbf, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xc0, 0xc1, 0xc1, 0xff, 0xbf, 0xc2, 0xc1, 0xff, 0xc0, 0xc3, 0xc3, 0xff, 0xc4, 0xc6, 0xc6, 0xff, 0xc3, 0xc5, 0xc5, 0xff, 0xbf, 0xc3, 0xc2, 0xff, 0x8c, 0x92, 0x90, 0xff, 0x94, 0x98, 0x98, 0xff, 0x8c, 0x90, 0x91, 0xff, 0x83, 0x89, 0x8b, 0xff, 0x82, 0x86, 0x88, 0xff, 0x83, 0x8a, 0x8f, 0xff, 0x6d, 0x78, 0x86, 0xff, 0x5c, 0x70, 0x8b, 0xff, 0x56, 0x6f, 0x94, 0xff, 0x59, 0x76, 0xa4, 0xff, 0x69, 0x8b, 0xbc, 0xff, 0x74, 0x96, 0xc8, 0xff, 0x7f, 0xa0, 0xd2, 0xff, 0x85, 0xa7, 0xd9, 0xff, 0x86, 0xa8, 0xd9, 0xff, 0x82, 0xa4, 0xd7, 0xff, 0x85, 0xa7, 0xdc, 0xff, 0x8c, 0xae, 0xe3, 0xff, 0x8c, 0xae, 0xe3, 0xff, 0x84, 0xa7, 0xdd, 0xff, 0x6e, 0x92, 0xcb, 0xff, 0x48, 0x69, 0x9d, 0xff, 0x18, 0x27, 0x46, 0xff, 0x00, 0x01, 0x08, 0xff, 0x34, 0x36, 0x3b, 0xff, 0xc0, 0xc6, 0xca, 0xff, 0xe6, 0xe9, 0xe8, 0xff, 0xc0, 0xc2, 0xc0, 0xff, 0xd3, 0xd2, 0xd1, 0xff, 0xb9, 0xb5, 0xb5, 0xff, 0x82, 0x82, 0x7e, 0xff, 0x95, 0x98, 0x97, 0xff, 0xd2, 0xd6, 0xd7, 0xff, 0xb5, 0xba, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb7, 0xb9, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb4, 0xb6, 0xff, 0xb0, 0xb5, 0xb5, 0xff, 0xb1, 0xb5, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb2, 0xb4, 0xb5, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb0, 0xb5, 0xb6, 0xff, 0xb0, 0xb5, 0xb6, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb1, 0xb4, 0xb4, 0xff, 0xb0, 0xb5, 0xb4, 0xc9, 0xad, 0xb9, 0xb9, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xba, 0xba, 0x1a, 0xbb, 0xbd, 0xbd, 0xd6, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbc, 0xbe, 0xc0, 0xff, 0xb9, 0xbe, 0xbe, 0xff, 0xbc, 0xbf, 0xbe, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc1, 0xc1, 0xff, 0xbf, 0xc3, 0xc2, 0xff, 0xc2, 0xc3, 0xc3, 0xff, 0xc3, 0xc5, 0xc5, 0xff, 0xc3, 0xc5, 0xc5, 0xff, 0xc8, 0xc9, 0xca, 0xff, 0xae, 0xb1, 0xb1, 0xff, 0x8f, 0x94, 0x94, 0xff, 0x93, 0x97, 0x97, 0xff, 0x73, 0x77, 0x79, 0xff, 0x77, 0x7d, 0x81, 0xff, 0x77, 0x7d, 0x83, 0xff, 0x5f, 0x67, 0x75, 0xff, 0x4f, 0x5e, 0x75, 0xff, 0x64, 0x7f, 0xa3, 0xff, 0x69, 0x8a, 0xb7, 0xff, 0x6b, 0x8d, 0xbe, 0xff, 0x6c, 0x90, 0xc3, 0xff, 0x77, 0x99, 0xcd, 0xff, 0x80, 0xa1, 0xd4, 0xff, 0x84, 0xa5, 0xd7, 0xff, 0x86, 0xa7, 0xd9, 0xff, 0x88, 0xa9, 0xdb, 0xff, 0x8d, 0xae, 0xe0, 0xff, 0x8f, 0xb0, 0xe2, 0xff, 0x91, 0xb2, 0xe5, 0xff, 0x92, 0xb2, 0xe3, 0xff, 0x88, 0xad, 0xde, 0xff, 0x6e, 0x93, 0xcd, 0xff, 0x41, 0x62, 0x99, 0xff, 0x0e, 0x1f, 0x39, 0xff, 0x19, 0x19, 0x1c, 0xff, 0x4c, 0x53, 0x57, 0xff, 0xde, 0xe6, 0xe9, 0xff, 0xe1, 0xe2, 0xe1, 0xff, 0xcb, 0xca, 0xc9, 0xff, 0xbf, 0xbd, 0xbd, 0xff, 0xa8, 0xa7, 0xa6, 0xff, 0x76, 0x78, 0x78, 0xff, 0xaf, 0xb4, 0xb3, 0xff, 0xca, 0xce, 0xce, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb3, 0xb8, 0xb7, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb1, 0xb6, 0xb5, 0xff, 0xb1, 0xb6, 0xb5, 0xff, 0xb1, 0xb6, 0xb7, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb1, 0xb4, 0xb5, 0xff, 0xb1, 0xb4, 0xb6, 0xff, 0xb0, 0xb5, 0xb6, 0xff, 0xb0, 0xb4, 0xb6, 0xff, 0xb1, 0xb5, 0xb5, 0xff, 0xb1, 0xb6, 0xb5, 0xd6, 0xb0, 0xba, 0xb0, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xbf, 0xbf, 0x20, 0xbb, 0xbd, 0xbd, 0xde, 0xbc, 0xbd, 0xbe, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xba, 0xbd, 0xbe, 0xff, 0xb9, 0xbe, 0xbe, 0xff, 0xbc, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xc1, 0xff, 0xbe, 0xbf, 0xc1, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xc0, 0xbf, 0xff, 0xbe, 0xc2, 0xc1, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc3, 0xc4, 0xff, 0xbe, 0xc3, 0xc4, 0xff, 0xc0, 0xc4, 0xc5, 0xff, 0xc3, 0xc6, 0xc7, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc7, 0xc8, 0xc8, 0xff, 0xa3, 0xa5, 0xa6, 0xff, 0x85, 0x89, 0x8b, 0xff, 0x7b, 0x80, 0x80, 0xff, 0x80, 0x84, 0x87, 0xff, 0x8a, 0x8f, 0x95, 0xff, 0x6f, 0x79, 0x85, 0xff, 0x53, 0x5f, 0x76, 0xff, 0x5e, 0x73, 0x97, 0xff, 0x5f, 0x80, 0xb0, 0xff, 0x69, 0x8d, 0xbf, 0xff, 0x69, 0x8c, 0xbf, 0xff, 0x6d, 0x90, 0xc4, 0xff, 0x78, 0x9a, 0xd0, 0xff, 0x83, 0xa3, 0xd8, 0xff, 0x89, 0xa9, 0xdc, 0xff, 0x8f, 0xae, 0xe1, 0xff, 0x90, 0xb0, 0xe2, 0xff, 0x93, 0xb3, 0xe6, 0xff, 0x99, 0xb8, 0xeb, 0xff, 0x9a, 0xb9, 0xeb, 0xff, 0x99, 0xb7, 0xeb, 0xff, 0x97, 0xb8, 0xe8, 0xff, 0x90, 0xb0, 0xe2, 0xff, 0x7b, 0xa1, 0xdb, 0xff, 0x33, 0x55, 0x8d, 0xff, 0x0e, 0x18, 0x2c, 0xff, 0x19, 0x1b, 0x1f, 0xff, 0x88, 0x90, 0x95, 0xff, 0xf6, 0xfb, 0xfb, 0xff, 0xda, 0xda, 0xd9, 0xff, 0xcb, 0xc9, 0xc9, 0xff, 0xb7, 0xb5, 0xb5, 0xff, 0x89, 0x89, 0x89, 0xff, 0x7a, 0x7f, 0x7e, 0xff, 0xc6, 0xcb, 0xcb, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xba, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb6, 0xff, 0xb1, 0xb6, 0xb6, 0xff, 0xb1, 0xb5, 0xb5, 0xff, 0xb1, 0xb6, 0xb6, 0xff, 0xb2, 0xb6, 0xb5, 0xff, 0xb1, 0xb5, 0xb4, 0xff, 0xb1, 0xb5, 0xb4, 0xff, 0xb2, 0xb6, 0xb5, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb6, 0xb6, 0xff, 0xb0, 0xb5, 0xb5, 0xde, 0xaf, 0xb7, 0xb7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xbf, 0xbf, 0x1c, 0xbb, 0xbc, 0xbd, 0xdb, 0xbb, 0xbe, 0xbe, 0xff, 0xbb, 0xbe, 0xbf, 0xff, 0xbb, 0xbd, 0xbe, 0xff, 0xbb, 0xbc, 0xbc, 0xff, 0xba, 0xbd, 0xbc, 0xff, 0xbb, 0xbf, 0xbe, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc2, 0xc3, 0xc4, 0xff, 0xc0, 0xc4, 0xc5, 0xff, 0xc1, 0xc5, 0xc6, 0xff, 0xc3, 0xc6, 0xc7, 0xff, 0xc7, 0xc9, 0xca, 0xff, 0xbd, 0xbe, 0xbe, 0xff, 0x90, 0x94, 0x93, 0xff, 0x7f, 0x84, 0x85, 0xff, 0x85, 0x89, 0x8b, 0xff, 0x91, 0x95, 0x96, 0xff, 0x7a, 0x81, 0x8a, 0xff, 0x4e, 0x5f, 0x75, 0xff, 0x45, 0x5d, 0x81, 0xff, 0x58, 0x77, 0xa8, 0xff, 0x5d, 0x81, 0xb5, 0xff, 0x65, 0x89, 0xbc, 0xff, 0x63, 0x89, 0xbe, 0xff, 0x6b, 0x91, 0xc7, 0xff, 0x7b, 0x9e, 0xd4, 0xff, 0x86, 0xa6, 0xdb, 0xff, 0x90, 0xae, 0xe1, 0xff, 0x95, 0xb5, 0xe6, 0xff, 0x98, 0xb7, 0xe8, 0xff, 0x9a, 0xb8, 0xe8, 0xff, 0x9f, 0xbe, 0xed, 0xff, 0xa4, 0xc2, 0xf1, 0xff, 0xa1, 0xc0, 0xf0, 0xff, 0x9b, 0xbd, 0xed, 0xff, 0x9d, 0xbd, 0xee, 0xff, 0x9b, 0xbd, 0xec, 0xff, 0x72, 0x98, 0xd0, 0xff, 0x27, 0x43, 0x71, 0xff, 0x09, 0x0e, 0x16, 0xff, 0x40, 0x43, 0x45, 0xff, 0xd0, 0xd7, 0xd9, 0xff, 0xee, 0xf1, 0xee, 0xff, 0xcf, 0xce, 0xce, 0xff, 0xb9, 0xb5, 0xb6, 0xff, 0xac, 0xac, 0xaa, 0xff, 0x65, 0x68, 0x66, 0xff, 0x9e, 0xa2, 0xa4, 0xff, 0xc5, 0xc9, 0xcb, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb5, 0xba, 0xba, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb6, 0xb7, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb6, 0xb6, 0xff, 0xb1, 0xb6, 0xb5, 0xff, 0xb1, 0xb5, 0xb5, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb6, 0xb5, 0xff, 0xb1, 0xb6, 0xb5, 0xff, 0xb1, 0xb6, 0xb5, 0xff, 0xb1, 0xb6, 0xb5, 0xff, 0xb0, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb5, 0xff, 0xb1, 0xb4, 0xb4, 0xdc, 0xad, 0xb6, 0xb6, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xc2, 0xc2, 0x15, 0xbb, 0xbd, 0xbd, 0xd6, 0xba, 0xbd, 0xbd, 0xff, 0xbb, 0xbf, 0xbe, 0xff, 0xbb, 0xbf, 0xbe, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbd, 0xbd, 0xff, 0xbc, 0xbf, 0xbe, 0xff, 0xbb, 0xbe, 0xbe, 0xff, 0xbd, 0xbe, 0xbf, 0xff, 0xbe, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc4, 0xc5, 0xff, 0xc3, 0xc5, 0xc6, 0xff, 0xc4, 0xc5, 0xc6, 0xff, 0xcd, 0xcf, 0xd0, 0xff, 0xa5, 0xaa, 0xa9, 0xff, 0x7d, 0x81, 0x81, 0xff, 0x8d, 0x8f, 0x90, 0xff, 0x89, 0x8a, 0x8e, 0xff, 0x6d, 0x73, 0x75, 0xff, 0x50, 0x5b, 0x6a, 0xff, 0x3c, 0x4c, 0x6f, 0xff, 0x48, 0x66, 0x97, 0xff, 0x51, 0x75, 0xa7, 0xff, 0x59, 0x7e, 0xb1, 0xff, 0x64, 0x8b, 0xc0, 0xff, 0x66, 0x8e, 0xc1, 0xff, 0x6f, 0x95, 0xca, 0xff, 0x7c, 0x9e, 0xd4, 0xff, 0x89, 0xaa, 0xdd, 0xff, 0x97, 0xb6, 0xe6, 0xff, 0x9e, 0xbc, 0xea, 0xff, 0x9e, 0xbd, 0xea, 0xff, 0x9f, 0xbb, 0xe9, 0xff, 0xa4, 0xc0, 0xee, 0xff, 0xa7, 0xc5, 0xf1, 0xff, 0xa2, 0xc1, 0xef, 0xff, 0xa0, 0xc0, 0xef, 0xff, 0xa3, 0xc2, 0xf2, 0xff, 0xa0, 0xbf, 0xef, 0xff, 0x92, 0xb4, 0xe5, 0xff, 0x56, 0x7f, 0xb8, 0xff, 0x14, 0x26, 0x48, 0xff, 0x1e, 0x1f, 0x25, 0xff, 0x89, 0x8f, 0x95, 0xff, 0xe8, 0xef, 0xee, 0xff, 0xdb, 0xdd, 0xda, 0xff, 0xc7, 0xc3, 0xc3, 0xff, 0xaa, 0xa7, 0xa6, 0xff, 0x7e, 0x7e, 0x7d, 0xff, 0x7d, 0x7f, 0x7f, 0xff, 0xc6, 0xc9, 0xca, 0xff, 0xb4, 0xb6, 0xb8, 0xff, 0xb6, 0xba, 0xbc, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb5, 0xb9, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb1, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb2, 0xb6, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb1, 0xb6, 0xb5, 0xff, 0xb1, 0xb6, 0xb4, 0xff, 0xb1, 0xb6, 0xb5, 0xff, 0xb1, 0xb6, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb0, 0xb5, 0xb5, 0xff, 0xb0, 0xb5, 0xb4, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb0, 0xb5, 0xb5, 0xd7, 0xb6, 0xb6, 0xb6, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xb2, 0xb2, 0x0a, 0xbb, 0xbc, 0xbc, 0xc8, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbd, 0xbe, 0xbf, 0xff, 0xbc, 0xbf, 0xbf, 0xff, 0xbb, 0xbf, 0xbf, 0xff, 0xbe, 0xbf, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbd, 0xc0, 0xc0, 0xff, 0xbf, 0xc0, 0xc0, 0xff, 0xc0, 0xc1, 0xc2, 0xff, 0xc0, 0xc3, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc2, 0xc5, 0xc5, 0xff, 0xc3, 0xc5, 0xc6, 0xff, 0xcb, 0xcd, 0xce, 0xff, 0xbe, 0xc2, 0xc3, 0xff, 0x88, 0x8d, 0x8d, 0xff, 0x86, 0x8a, 0x89, 0xff, 0x8f, 0x90, 0x90, 0xff, 0x6c, 0x70, 0x71, 0xff, 0x57, 0x5b, 0x61, 0xff, 0x3d, 0x49, 0x59, 0xff, 0x3b, 0x54, 0x7d, 0xff, 0x4d, 0x6e, 0xa2, 0xff, 0x50, 0x71, 0xa4, 0xff, 0x58, 0x7d, 0xb3, 0xff, 0x65, 0x8d, 0xc2, 0xff, 0x72, 0x97, 0xca, 0xff, 0x78, 0x9c, 0xd1, 0xff, 0x7e, 0xa2, 0xd6, 0xff, 0x8d, 0xae, 0xdf, 0xff, 0x99, 0xb7, 0xe6, 0xff, 0x9e, 0xba, 0xe9, 0xff, 0xa0, 0xbd, 0xea, 0xff, 0xa2, 0xbe, 0xeb, 0xff, 0xa8, 0xc4, 0xf2, 0xff, 0xa7, 0xc5, 0xf1, 0xff, 0x9e, 0xbd, 0xeb, 0xff, 0xa1, 0xc0, 0xee, 0xff, 0xa1, 0xc0, 0xee, 0xff, 0xa0, 0xbe, 0xed, 0xff, 0x97, 0xb8, 0xe9, 0xff, 0x86, 0xac, 0xe1, 0xff, 0x4a, 0x69, 0xa0, 0xff, 0x09, 0x14, 0x2a, 0xff, 0x3c, 0x42, 0x42, 0xff, 0xd0, 0xd8, 0xdc, 0xff, 0xe1, 0xe4, 0xe3, 0xff, 0xc8, 0xc8, 0xc6, 0xff, 0xbe, 0xbc, 0xbb, 0xff, 0x9e, 0x9c, 0x9b, 0xff, 0x6a, 0x6c, 0x6b, 0xff, 0xaa, 0xae, 0xae, 0xff, 0xc2, 0xc3, 0xc4, 0xff, 0xb7, 0xb8, 0xb9, 0xff, 0xb6, 0xb9, 0xbb, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb5, 0xba, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb5, 0xba, 0xb8, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb5, 0xb8, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb7, 0xff, 0xb1, 0xb5, 0xb5, 0xff, 0xb2, 0xb7, 0xb5, 0xff, 0xb2, 0xb7, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb5, 0xff, 0xb1, 0xb5, 0xb5, 0xff, 0xb2, 0xb6, 0xb6, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xaf, 0xb5, 0xb6, 0xc8, 0xb2, 0xb2, 0xb2, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0xbb, 0xbc, 0xbe, 0xb1, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbd, 0xc0, 0xc0, 0xff, 0xbd, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc0, 0xc3, 0xc2, 0xff, 0xc0, 0xc3, 0xc3, 0xff, 0xc2, 0xc3, 0xc4, 0xff, 0xc2, 0xc5, 0xc5, 0xff, 0xc4, 0xc6, 0xc7, 0xff, 0xce, 0xd2, 0xd1, 0xff, 0xa6, 0xab, 0xaa, 0xff, 0x83, 0x85, 0x85, 0xff, 0x97, 0x99, 0x99, 0xff, 0x71, 0x75, 0x75, 0xff, 0x4f, 0x53, 0x55, 0xff, 0x51, 0x54, 0x5c, 0xff, 0x3b, 0x48, 0x62, 0xff, 0x3f, 0x5c, 0x8b, 0xff, 0x45, 0x68, 0x9a, 0xff, 0x4c, 0x70, 0xa4, 0xff, 0x5b, 0x80, 0xb7, 0xff, 0x68, 0x8f, 0xc4, 0xff, 0x75, 0x99, 0xcc, 0xff, 0x7c, 0x9d, 0xcf, 0xff, 0x86, 0xa9, 0xd9, 0xff, 0x8f, 0xb1, 0xdf, 0xff, 0x95, 0xb3, 0xe3, 0xff, 0x9a, 0xb7, 0xe7, 0xff, 0xa1, 0xbe, 0xec, 0xff, 0xa2, 0xbd, 0xeb, 0xff, 0xa8, 0xc2, 0xf0, 0xff, 0xa5, 0xc1, 0xee, 0xff, 0x9f, 0xbc, 0xeb, 0xff, 0xa6, 0xc3, 0xf0, 0xff, 0x9f, 0xbe, 0xed, 0xff, 0x9d, 0xbb, 0xec, 0xff, 0xa3, 0xbf, 0xee, 0xff, 0x9d, 0xbe, 0xee, 0xff, 0x82, 0xa9, 0xe1, 0xff, 0x33, 0x4c, 0x6e, 0xff, 0x0b, 0x11, 0x10, 0xff, 0x8d, 0x94, 0x97, 0xff, 0xea, 0xf0, 0xf2, 0xff, 0xd2, 0xd5, 0xd4, 0xff, 0xc7, 0xc4, 0xc2, 0xff, 0xa2, 0xa0, 0x9f, 0xff, 0x67, 0x68, 0x68, 0xff, 0x91, 0x93, 0x93, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb5, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xba, 0xff, 0xb6, 0xba, 0xba, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb8, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb5, 0xb7, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb5, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb6, 0xb6, 0xff, 0xb1, 0xb6, 0xb6, 0xff, 0xb2, 0xb6, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb0, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb5, 0xb1, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbd, 0xbd, 0x8d, 0xbc, 0xbe, 0xbf, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbb, 0xbd, 0xbe, 0xff, 0xbc, 0xbd, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc1, 0xc2, 0xc3, 0xff, 0xc1, 0xc4, 0xc4, 0xff, 0xc1, 0xc4, 0xc4, 0xff, 0xc3, 0xc5, 0xc5, 0xff, 0xc3, 0xc7, 0xc7, 0xff, 0xc4, 0xc8, 0xc9, 0xff, 0xc6, 0xcb, 0xca, 0xff, 0x94, 0x9a, 0x98, 0xff, 0x92, 0x96, 0x97, 0xff, 0x90, 0x92, 0x93, 0xff, 0x59, 0x5c, 0x5d, 0xff, 0x4f, 0x53, 0x53, 0xff, 0x3e, 0x44, 0x4d, 0xff, 0x3b, 0x4e, 0x6d, 0xff, 0x3c, 0x5b, 0x8a, 0xff, 0x44, 0x65, 0x98, 0xff, 0x4b, 0x71, 0xa5, 0xff, 0x5b, 0x82, 0xb6, 0xff, 0x6e, 0x96, 0xc9, 0xff, 0x7d, 0xa2, 0xd4, 0xff, 0x86, 0xa8, 0xd9, 0xff, 0x91, 0xb1, 0xe0, 0xff, 0x94, 0xb4, 0xe3, 0xff, 0x97, 0xb4, 0xe4, 0xff, 0xa5, 0xbf, 0xec, 0xff, 0xa6, 0xc1, 0xee, 0xff, 0xa8, 0xc1, 0xed, 0xff, 0xab, 0xc6, 0xf1, 0xff, 0xa8, 0xc3, 0xf0, 0xff, 0xaf, 0xc7, 0xf4, 0xff, 0xb2, 0xca, 0xf5, 0xff, 0xb6, 0xcd, 0xf5, 0xff, 0xc4, 0xda, 0xff, 0xff, 0xc4, 0xdb, 0xff, 0xff, 0xb4, 0xcd, 0xf9, 0xff, 0x9f, 0xbd, 0xed, 0xff, 0x74, 0x90, 0xc3, 0xff, 0x14, 0x1e, 0x33, 0xff, 0x4a, 0x4d, 0x4f, 0xff, 0xdd, 0xe5, 0xea, 0xff, 0xe7, 0xeb, 0xeb, 0xff, 0xc0, 0xbd, 0xbd, 0xff, 0xa9, 0xa7, 0xa8, 0xff, 0x84, 0x84, 0x84, 0xff, 0x6f, 0x70, 0x70, 0xff, 0xbe, 0xc1, 0xc1, 0xff, 0xbc, 0xbd, 0xbd, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xba, 0xbb, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb8, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb2, 0xb6, 0xb6, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb1, 0xb6, 0xb6, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb4, 0xb4, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xbd, 0xbd, 0x55, 0xbb, 0xbd, 0xbd, 0xfe, 0xbc, 0xbe, 0xbf, 0xff, 0xbc, 0xbe, 0xbd, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbd, 0xbd, 0xff, 0xbc, 0xbf, 0xbe, 0xff, 0xbc, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xbf, 0xff, 0xbd, 0xc0, 0xc0, 0xff, 0xbe, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc1, 0xc4, 0xc4, 0xff, 0xc3, 0xc5, 0xc6, 0xff, 0xc4, 0xc5, 0xc6, 0xff, 0xc3, 0xc6, 0xc7, 0xff, 0xc8, 0xcd, 0xce, 0xff, 0xba, 0xbf, 0xbf, 0xff, 0x91, 0x96, 0x95, 0xff, 0x94, 0x9a, 0x99, 0xff, 0x72, 0x76, 0x76, 0xff, 0x5e, 0x60, 0x5f, 0xff, 0x49, 0x4d, 0x4c, 0xff, 0x40, 0x46, 0x4c, 0xff, 0x39, 0x4e, 0x6a, 0xff, 0x3a, 0x59, 0x89, 0xff, 0x41, 0x63, 0x99, 0xff, 0x4c, 0x71, 0xa8, 0xff, 0x65, 0x8d, 0xc2, 0xff, 0x76, 0x9c, 0xcf, 0xff, 0x7b, 0x9e, 0xce, 0xff, 0x88, 0xa8, 0xd8, 0xff, 0x9d, 0xba, 0xe8, 0xff, 0xae, 0xc8, 0xf6, 0xff, 0xb8, 0xd2, 0xfe, 0xff, 0xb7, 0xd0, 0xf6, 0xff, 0xaf, 0xc6, 0xef, 0xff, 0xaf, 0xc6, 0xf2, 0xff, 0xb1, 0xca, 0xf4, 0xff, 0xb4, 0xcd, 0xf5, 0xff, 0xbc, 0xd4, 0xf7, 0xff, 0xc2, 0xda, 0xfd, 0xff, 0xba, 0xd1, 0xf7, 0xff, 0xa1, 0xb6, 0xda, 0xff, 0x7f, 0x92, 0xb4, 0xff, 0x65, 0x74, 0x99, 0xff, 0x64, 0x73, 0x9b, 0xff, 0x61, 0x76, 0xa9, 0xff, 0x24, 0x33, 0x59, 0xff, 0x13, 0x17, 0x18, 0xff, 0xb2, 0xb9, 0xbb, 0xff, 0xf4, 0xf9, 0xf9, 0xff, 0xd0, 0xd1, 0xd0, 0xff, 0xa7, 0xa6, 0xa6, 0xff, 0xa5, 0xa4, 0xa4, 0xff, 0x66, 0x68, 0x68, 0xff, 0xad, 0xb0, 0xb1, 0xff, 0xc5, 0xc6, 0xc6, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb6, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xba, 0xff, 0xb4, 0xb8, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xb2, 0xb7, 0xb5, 0xff, 0xb1, 0xb6, 0xb6, 0xff, 0xb1, 0xb5, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb6, 0xff, 0xb2, 0xb7, 0xb6, 0xff, 0xb3, 0xb6, 0xb8, 0xff, 0xb1, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xaf, 0xb5, 0xb4, 0xfe, 0xb1, 0xb4, 0xb4, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xba, 0xba, 0x29, 0xba, 0xbc, 0xbc, 0xf3, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbd, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbe, 0xbe, 0xff, 0xbd, 0xc0, 0xc0, 0xff, 0xbc, 0xc0, 0xbf, 0xff, 0xbe, 0xbf, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc1, 0xc3, 0xc3, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc2, 0xc4, 0xc4, 0xff, 0xc2, 0xc4, 0xc4, 0xff, 0xc3, 0xc5, 0xc5, 0xff, 0xc4, 0xc6, 0xc6, 0xff, 0xc5, 0xc7, 0xc7, 0xff, 0xcb, 0xce, 0xcf, 0xff, 0xb1, 0xb6, 0xb6, 0xff, 0x92, 0x97, 0x95, 0xff, 0x9b, 0x9e, 0x9e, 0xff, 0x6a, 0x6d, 0x6c, 0xff, 0x59, 0x5c, 0x5a, 0xff, 0x45, 0x48, 0x46, 0xff, 0x39, 0x42, 0x4d, 0xff, 0x35, 0x4d, 0x75, 0xff, 0x3f, 0x60, 0x98, 0xff, 0x44, 0x65, 0x9b, 0xff, 0x4e, 0x71, 0xa6, 0xff, 0x4a, 0x69, 0x96, 0xff, 0x40, 0x56, 0x82, 0xff, 0x3f, 0x52, 0x7d, 0xff, 0x51, 0x5f, 0x87, 0xff, 0x54, 0x63, 0x88, 0xff, 0x5c, 0x6e, 0x93, 0xff, 0x77, 0x8d, 0xb8, 0xff, 0xa2, 0xbb, 0xeb, 0xff, 0xb4, 0xcc, 0xf3, 0xff, 0xaf, 0xc7, 0xef, 0xff, 0xb2, 0xca, 0xf1, 0xff, 0xb8, 0xd1, 0xf4, 0xff, 0xc0, 0xd8, 0xf9, 0xff, 0xab, 0xc2, 0xeb, 0xff, 0x5a, 0x72, 0xa6, 0xff, 0x33, 0x47, 0x6f, 0xff, 0x4c, 0x5d, 0x7e, 0xff, 0x6f, 0x80, 0xa4, 0xff, 0x97, 0xa8, 0xcb, 0xff, 0xab, 0xc0, 0xe6, 0xff, 0x7a, 0x8f, 0xbb, 0xff, 0x02, 0x07, 0x19, 0xff, 0x6c, 0x71, 0x71, 0xff, 0xed, 0xf4, 0xf7, 0xff, 0xdd, 0xe0, 0xe1, 0xff, 0xb5, 0xb3, 0xb2, 0xff, 0xaa, 0xaa, 0xa7, 0xff, 0x6d, 0x6f, 0x6f, 0xff, 0x8d, 0x92, 0x93, 0xff, 0xcd, 0xce, 0xcf, 0xff, 0xb7, 0xb8, 0xb9, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xba, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb7, 0xb9, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb1, 0xb6, 0xb7, 0xff, 0xb1, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xb3, 0xb7, 0xb6, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb4, 0xb5, 0xb6, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb6, 0xb7, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb2, 0xb5, 0xb7, 0xff, 0xb0, 0xb6, 0xb5, 0xff, 0xb0, 0xb4, 0xb3, 0xf4, 0xb0, 0xb6, 0xb6, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb6, 0xb6, 0x07, 0xba, 0xbd, 0xbd, 0xd1, 0xbb, 0xbe, 0xbe, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc3, 0xff, 0xc2, 0xc4, 0xc4, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc3, 0xc5, 0xc6, 0xff, 0xc4, 0xc7, 0xc8, 0xff, 0xc7, 0xc9, 0xca, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xae, 0xb3, 0xb3, 0xff, 0x87, 0x8a, 0x8a, 0xff, 0x97, 0x99, 0x99, 0xff, 0x6d, 0x6e, 0x6e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x36, 0x38, 0x37, 0xff, 0x28, 0x38, 0x4f, 0xff, 0x3f, 0x60, 0x98, 0xff, 0x41, 0x64, 0x9a, 0xff, 0x46, 0x63, 0x96, 0xff, 0x2e, 0x44, 0x6b, 0xff, 0x3e, 0x52, 0x79, 0xff, 0x66, 0x77, 0xa1, 0xff, 0x76, 0x88, 0xb1, 0xff, 0x6e, 0x7f, 0xa1, 0xff, 0x56, 0x64, 0x8b, 0xff, 0x3c, 0x4a, 0x71, 0xff, 0x21, 0x33, 0x57, 0xff, 0x4b, 0x63, 0x95, 0xff, 0xa0, 0xbc, 0xeb, 0xff, 0xad, 0xc5, 0xef, 0xff, 0xad, 0xc6, 0xee, 0xff, 0xb5, 0xce, 0xf5, 0xff, 0xb5, 0xce, 0xf6, 0xff, 0x8b, 0xa4, 0xd1, 0xff, 0x5f, 0x79, 0xab, 0xff, 0x7b, 0x91, 0xbe, 0xff, 0x97, 0xb1, 0xe1, 0xff, 0x9f, 0xc1, 0xf1, 0xff, 0xa4, 0xc3, 0xf2, 0xff, 0xb6, 0xcf, 0xfb, 0xff, 0xc8, 0xe8, 0xff, 0xff, 0x3e, 0x51, 0x7a, 0xff, 0x1f, 0x22, 0x29, 0xff, 0xc8, 0xd0, 0xd4, 0xff, 0xf0, 0xf4, 0xf6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0x9e, 0x9e, 0x9c, 0xff, 0x70, 0x70, 0x70, 0xff, 0x70, 0x72, 0x74, 0xff, 0xcb, 0xce, 0xcf, 0xff, 0xc1, 0xc4, 0xc5, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xba, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb3, 0xb8, 0xb7, 0xff, 0xb3, 0xb8, 0xb7, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb6, 0xb8, 0xff, 0xb4, 0xb6, 0xb8, 0xff, 0xb5, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb6, 0xb6, 0xff, 0xaf, 0xb4, 0xb4, 0xd1, 0xb6, 0xb6, 0xb6, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xbc, 0xbc, 0x8e, 0xbb, 0xbd, 0xbd, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xc1, 0xc0, 0xff, 0xbd, 0xc1, 0xc0, 0xff, 0xc0, 0xc1, 0xc1, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc1, 0xc3, 0xc3, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc3, 0xc5, 0xc5, 0xff, 0xc3, 0xc5, 0xc5, 0xff, 0xc5, 0xc7, 0xc7, 0xff, 0xc8, 0xca, 0xca, 0xff, 0xca, 0xce, 0xcd, 0xff, 0xa3, 0xa8, 0xa8, 0xff, 0x84, 0x88, 0x88, 0xff, 0x9b, 0x9e, 0x9e, 0xff, 0x68, 0x6b, 0x6c, 0xff, 0x3d, 0x3f, 0x3e, 0xff, 0x1f, 0x20, 0x22, 0xff, 0x2f, 0x44, 0x66, 0xff, 0x43, 0x68, 0xa0, 0xff, 0x44, 0x66, 0x98, 0xff, 0x3a, 0x54, 0x7b, 0xff, 0x40, 0x58, 0x7f, 0xff, 0x82, 0xa2, 0xd4, 0xff, 0xa0, 0xbe, 0xed, 0xff, 0x9c, 0xbf, 0xee, 0xff, 0x9f, 0xc4, 0xf9, 0xff, 0x9f, 0xc0, 0xf3, 0xff, 0x8d, 0xa9, 0xdb, 0xff, 0x72, 0x8d, 0xba, 0xff, 0x54, 0x73, 0xa0, 0xff, 0x80, 0x9f, 0xcd, 0xff, 0x9b, 0xb7, 0xe4, 0xff, 0xa2, 0xbd, 0xe9, 0xff, 0xb5, 0xcf, 0xf5, 0xff, 0xb2, 0xcc, 0xf4, 0xff, 0x9b, 0xb9, 0xe5, 0xff, 0x9d, 0xb7, 0xe2, 0xff, 0x9c, 0xb5, 0xe6, 0xff, 0x74, 0x93, 0xcd, 0xff, 0x64, 0x87, 0xc2, 0xff, 0x62, 0x85, 0xbd, 0xff, 0x76, 0x99, 0xd2, 0xff, 0xa2, 0xc7, 0xfb, 0xff, 0x60, 0x80, 0xaf, 0xff, 0x00, 0x01, 0x13, 0xff, 0x99, 0xa2, 0xa4, 0xff, 0xf0, 0xf6, 0xf6, 0xff, 0xcc, 0xcd, 0xcd, 0xff, 0xb1, 0xae, 0xae, 0xff, 0x8e, 0x8c, 0x8d, 0xff, 0x59, 0x5a, 0x5b, 0xff, 0xbd, 0xc1, 0xc2, 0xff, 0xc9, 0xcd, 0xce, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb6, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb7, 0xb9, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb4, 0xb8, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb6, 0xb6, 0xff, 0xb2, 0xb5, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb6, 0xb5, 0xff, 0xb0, 0xb5, 0xb4, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbb, 0xbb, 0x40, 0xbb, 0xbd, 0xbd, 0xfe, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc1, 0xc2, 0xff, 0xbe, 0xc1, 0xc1, 0xff, 0xbf, 0xc0, 0xc0, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc2, 0xc3, 0xc3, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc2, 0xc5, 0xc6, 0xff, 0xc4, 0xc6, 0xc5, 0xff, 0xc5, 0xc7, 0xc6, 0xff, 0xc6, 0xc9, 0xc9, 0xff, 0xc9, 0xcd, 0xce, 0xff, 0x9c, 0xa0, 0xa1, 0xff, 0x8b, 0x8f, 0x90, 0xff, 0xa2, 0xa6, 0xa7, 0xff, 0x63, 0x67, 0x68, 0xff, 0x1a, 0x1c, 0x18, 0xff, 0x12, 0x15, 0x18, 0xff, 0x3a, 0x52, 0x7b, 0xff, 0x47, 0x6c, 0xa3, 0xff, 0x44, 0x65, 0x93, 0xff, 0x44, 0x5f, 0x8a, 0xff, 0x5f, 0x7f, 0xb1, 0xff, 0x70, 0x94, 0xc8, 0xff, 0x69, 0x8f, 0xca, 0xff, 0x4f, 0x6c, 0xa7, 0xff, 0x50, 0x6c, 0x9f, 0xff, 0x63, 0x86, 0xb7, 0xff, 0x71, 0x91, 0xc3, 0xff, 0x94, 0xaf, 0xe0, 0xff, 0x8a, 0xa8, 0xd7, 0xff, 0x5e, 0x81, 0xb3, 0xff, 0x79, 0x9a, 0xca, 0xff, 0x9a, 0xb5, 0xe4, 0xff, 0xb8, 0xd0, 0xf9, 0xff, 0xb4, 0xcf, 0xf8, 0xff, 0x9d, 0xb9, 0xe6, 0xff, 0x9a, 0xb1, 0xdf, 0xff, 0x4b, 0x69, 0xa0, 0xff, 0x2a, 0x3e, 0x65, 0xff, 0x4d, 0x56, 0x74, 0xff, 0x43, 0x4e, 0x66, 0xff, 0x29, 0x3e, 0x60, 0xff, 0x64, 0x83, 0xba, 0xff, 0x71, 0x93, 0xca, 0xff, 0x00, 0x03, 0x17, 0xff, 0x5d, 0x62, 0x62, 0xff, 0xe4, 0xed, 0xee, 0xff, 0xdf, 0xe2, 0xe3, 0xff, 0xb8, 0xb9, 0xb8, 0xff, 0xa1, 0xa0, 0xa0, 0xff, 0x54, 0x55, 0x55, 0xff, 0xaa, 0xae, 0xae, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb7, 0xbb, 0xbb, 0xff, 0xb6, 0xba, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb6, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xaf, 0xb4, 0xb5, 0xfe, 0xb0, 0xb4, 0xb4, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x09, 0xbb, 0xbd, 0xbd, 0xdb, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbd, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc2, 0xc4, 0xc4, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc1, 0xc4, 0xc5, 0xff, 0xc2, 0xc5, 0xc6, 0xff, 0xc5, 0xc6, 0xc6, 0xff, 0xc6, 0xc8, 0xc8, 0xff, 0xc5, 0xc8, 0xc9, 0xff, 0xc3, 0xc7, 0xc9, 0xff, 0x9a, 0x9f, 0xa0, 0xff, 0x8d, 0x91, 0x92, 0xff, 0xa5, 0xa7, 0xa8, 0xff, 0x4a, 0x4c, 0x4c, 0xff, 0x04, 0x03, 0x00, 0xff, 0x1e, 0x20, 0x26, 0xff, 0x3a, 0x54, 0x7c, 0xff, 0x46, 0x68, 0x9f, 0xff, 0x46, 0x65, 0x94, 0xff, 0x46, 0x64, 0x93, 0xff, 0x4f, 0x71, 0xa8, 0xff, 0x45, 0x6a, 0xa4, 0xff, 0x26, 0x3c, 0x6a, 0xff, 0x1c, 0x23, 0x37, 0xff, 0x19, 0x1f, 0x35, 0xff, 0x38, 0x37, 0x47, 0xff, 0x51, 0x53, 0x5f, 0xff, 0x61, 0x72, 0x96, 0xff, 0x86, 0x9e, 0xd0, 0xff, 0x59, 0x78, 0xaa, 0xff, 0x5c, 0x7c, 0xb1, 0xff, 0x95, 0xb2, 0xe2, 0xff, 0xba, 0xd1, 0xfd, 0xff, 0xb0, 0xcc, 0xf8, 0xff, 0x9d, 0xb6, 0xe2, 0xff, 0x75, 0x8c, 0xc4, 0xff, 0x3f, 0x4d, 0x7b, 0xff, 0x10, 0x12, 0x20, 0xff, 0x29, 0x21, 0x29, 0xff, 0x86, 0x80, 0x8e, 0xff, 0x3e, 0x4d, 0x67, 0xff, 0x30, 0x4a, 0x7b, 0xff, 0x62, 0x83, 0xc1, 0xff, 0x05, 0x16, 0x33, 0xff, 0x28, 0x2d, 0x34, 0xff, 0xd0, 0xda, 0xdd, 0xff, 0xe8, 0xed, 0xee, 0xff, 0xc4, 0xc7, 0xc7, 0xff, 0xa9, 0xa9, 0xa8, 0xff, 0x68, 0x68, 0x69, 0xff, 0x8e, 0x93, 0x93, 0xff, 0xd1, 0xd6, 0xd7, 0xff, 0xb7, 0xbc, 0xbd, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xbb, 0xba, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb1, 0xb6, 0xb7, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb2, 0xb5, 0xb7, 0xff, 0xb0, 0xb5, 0xb4, 0xdb, 0xaa, 0xaa, 0xaa, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbd, 0xbd, 0x88, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc1, 0xc3, 0xc2, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc1, 0xc4, 0xc4, 0xff, 0xc2, 0xc6, 0xc6, 0xff, 0xc5, 0xc7, 0xc8, 0xff, 0xc6, 0xc8, 0xc8, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0x88, 0x8c, 0x8e, 0xff, 0x76, 0x7c, 0x7c, 0xff, 0xa2, 0xa5, 0xa6, 0xff, 0x3b, 0x3d, 0x3e, 0xff, 0x08, 0x08, 0x04, 0xff, 0x2b, 0x2f, 0x38, 0xff, 0x3c, 0x57, 0x7f, 0xff, 0x47, 0x68, 0x9d, 0xff, 0x54, 0x75, 0xa6, 0xff, 0x48, 0x6d, 0x9f, 0xff, 0x42, 0x66, 0x9f, 0xff, 0x35, 0x4e, 0x8a, 0xff, 0x10, 0x1a, 0x3b, 0xff, 0x43, 0x4b, 0x5f, 0xff, 0x22, 0x27, 0x3d, 0xff, 0x0d, 0x0a, 0x18, 0xff, 0x93, 0x90, 0x92, 0xff, 0x83, 0x8b, 0xb1, 0xff, 0x5b, 0x6c, 0xa5, 0xff, 0x6a, 0x87, 0xb6, 0xff, 0x49, 0x6c, 0xa4, 0xff, 0x87, 0xa6, 0xd9, 0xff, 0xb3, 0xcd, 0xf8, 0xff, 0xad, 0xca, 0xf7, 0xff, 0xa7, 0xc1, 0xee, 0xff, 0x80, 0x92, 0xc7, 0xff, 0x67, 0x77, 0xaa, 0xff, 0x48, 0x5c, 0x88, 0xff, 0x43, 0x52, 0x79, 0xff, 0x75, 0x89, 0xaf, 0xff, 0x80, 0x9b, 0xc8, 0xff, 0x7a, 0x98, 0xc9, 0xff, 0x78, 0x9b, 0xcd, 0xff, 0x3c, 0x57, 0x86, 0xff, 0x00, 0x0a, 0x20, 0xff, 0xa1, 0xa9, 0xaf, 0xff, 0xea, 0xef, 0xf0, 0xff, 0xd4, 0xd7, 0xd7, 0xff, 0xc0, 0xc0, 0xbf, 0xff, 0x72, 0x72, 0x74, 0xff, 0x73, 0x77, 0x79, 0xff, 0xcf, 0xd4, 0xd5, 0xff, 0xbc, 0xc0, 0xc1, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbb, 0xff, 0xb6, 0xbb, 0xba, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb4, 0xb7, 0xb7, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb5, 0xb8, 0xb7, 0xff, 0xb3, 0xb8, 0xb7, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb1, 0xb6, 0xb5, 0xff, 0xb2, 0xb5, 0xb5, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbb, 0xbb, 0x26, 0xbb, 0xbd, 0xbd, 0xfa, 0xbc, 0xbe, 0xbe, 0xff, 0xbb, 0xbe, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc3, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc1, 0xc3, 0xc3, 0xff, 0xc2, 0xc4, 0xc4, 0xff, 0xc2, 0xc4, 0xc4, 0xff, 0xc1, 0xc5, 0xc4, 0xff, 0xc1, 0xc7, 0xc6, 0xff, 0xc5, 0xc8, 0xc7, 0xff, 0xc6, 0xc8, 0xc8, 0xff, 0xcf, 0xd2, 0xd1, 0xff, 0xb4, 0xb7, 0xb6, 0xff, 0x86, 0x8b, 0x8c, 0xff, 0x68, 0x6e, 0x6f, 0xff, 0x9f, 0xa4, 0xa7, 0xff, 0x49, 0x4c, 0x4e, 0xff, 0x0b, 0x0d, 0x09, 0xff, 0x2f, 0x37, 0x3f, 0xff, 0x35, 0x50, 0x79, 0xff, 0x45, 0x68, 0x9c, 0xff, 0x5e, 0x83, 0xb3, 0xff, 0x61, 0x87, 0xb8, 0xff, 0x5f, 0x81, 0xb5, 0xff, 0x5b, 0x77, 0xaf, 0xff, 0x3d, 0x57, 0x86, 0xff, 0x43, 0x59, 0x88, 0xff, 0x48, 0x5c, 0x89, 0xff, 0x51, 0x64, 0x8b, 0xff, 0x82, 0x99, 0xc1, 0xff, 0x8d, 0xa2, 0xd2, 0xff, 0x7e, 0x95, 0xc4, 0xff, 0x5d, 0x7b, 0xaf, 0xff, 0x4c, 0x6c, 0xa6, 0xff, 0x7d, 0x9d, 0xd1, 0xff, 0xad, 0xc9, 0xf6, 0xff, 0xa8, 0xc7, 0xf4, 0xff, 0xa2, 0xc0, 0xef, 0xff, 0xa0, 0xb9, 0xe4, 0xff, 0x8a, 0xa3, 0xd3, 0xff, 0x94, 0xae, 0xde, 0xff, 0x9e, 0xbb, 0xe5, 0xff, 0x9e, 0xbc, 0xe3, 0xff, 0x9e, 0xba, 0xe6, 0xff, 0x9c, 0xbb, 0xe8, 0xff, 0x96, 0xb8, 0xe4, 0xff, 0x90, 0xb1, 0xe7, 0xff, 0x16, 0x24, 0x44, 0xff, 0x65, 0x6b, 0x70, 0xff, 0xe5, 0xee, 0xf1, 0xff, 0xd6, 0xda, 0xdb, 0xff, 0xcc, 0xce, 0xcf, 0xff, 0x82, 0x83, 0x83, 0xff, 0x5f, 0x61, 0x61, 0xff, 0xc1, 0xc4, 0xc5, 0xff, 0xc2, 0xc5, 0xc6, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb8, 0xba, 0xbb, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb7, 0xb8, 0xb9, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb6, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb4, 0xb9, 0xb7, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb3, 0xb8, 0xb7, 0xff, 0xb2, 0xb7, 0xb8, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb5, 0xb6, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb0, 0xb4, 0xb4, 0xfa, 0xae, 0xb5, 0xb5, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xbd, 0xbd, 0xb3, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xc0, 0xc2, 0xc1, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc4, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc2, 0xc4, 0xc4, 0xff, 0xc2, 0xc4, 0xc4, 0xff, 0xc3, 0xc5, 0xc5, 0xff, 0xc4, 0xc6, 0xc6, 0xff, 0xc3, 0xc7, 0xc7, 0xff, 0xc5, 0xc8, 0xc8, 0xff, 0xc6, 0xc8, 0xc9, 0xff, 0xd3, 0xd6, 0xd6, 0xff, 0xa6, 0xaa, 0xa9, 0xff, 0x8c, 0x90, 0x91, 0xff, 0x6b, 0x6e, 0x70, 0xff, 0x9d, 0xa1, 0xa4, 0xff, 0x55, 0x58, 0x59, 0xff, 0x03, 0x06, 0x02, 0xff, 0x2a, 0x33, 0x40, 0xff, 0x35, 0x4e, 0x78, 0xff, 0x41, 0x63, 0x96, 0xff, 0x60, 0x84, 0xb6, 0xff, 0x74, 0x97, 0xc8, 0xff, 0x82, 0xa2, 0xd4, 0xff, 0x7e, 0xa0, 0xd3, 0xff, 0x70, 0x8e, 0xc5, 0xff, 0x6a, 0x86, 0xb8, 0xff, 0x88, 0xa2, 0xd2, 0xff, 0xa5, 0xc0, 0xed, 0xff, 0xa3, 0xbd, 0xe6, 0xff, 0xa0, 0xb8, 0xe1, 0xff, 0x84, 0xa3, 0xd2, 0xff, 0x59, 0x7b, 0xaf, 0xff, 0x4d, 0x6d, 0xa4, 0xff, 0x7b, 0x9a, 0xd0, 0xff, 0xa9, 0xc3, 0xf2, 0xff, 0xac, 0xc8, 0xf5, 0xff, 0x9e, 0xbd, 0xeb, 0xff, 0xa1, 0xc0, 0xed, 0xff, 0xa3, 0xbe, 0xed, 0xff, 0xa4, 0xc0, 0xeb, 0xff, 0xa7, 0xc5, 0xed, 0xff, 0xa5, 0xc3, 0xef, 0xff, 0xa3, 0xc1, 0xef, 0xff, 0x9e, 0xbc, 0xea, 0xff, 0x96, 0xb3, 0xe4, 0xff, 0xb0, 0xd1, 0xff, 0xff, 0x62, 0x7a, 0xa9, 0xff, 0x3a, 0x42, 0x53, 0xff, 0xd4, 0xdd, 0xe1, 0xff, 0xdf, 0xe4, 0xe4, 0xff, 0xcc, 0xce, 0xcf, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x56, 0x58, 0x57, 0xff, 0xb8, 0xbd, 0xbd, 0xff, 0xca, 0xcd, 0xce, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb9, 0xbd, 0xbe, 0xff, 0xb6, 0xbb, 0xbb, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xb9, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb7, 0xff, 0xb1, 0xb6, 0xb6, 0xff, 0xb1, 0xb3, 0xb5, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbb, 0xbb, 0x44, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbd, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbe, 0xc0, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc1, 0xc2, 0xc3, 0xff, 0xc2, 0xc3, 0xc5, 0xff, 0xc3, 0xc4, 0xc5, 0xff, 0xc2, 0xc5, 0xc5, 0xff, 0xc2, 0xc5, 0xc6, 0xff, 0xc2, 0xc6, 0xc8, 0xff, 0xc3, 0xc7, 0xc7, 0xff, 0xc5, 0xc8, 0xc8, 0xff, 0xc7, 0xc8, 0xc9, 0xff, 0xd3, 0xd6, 0xd6, 0xff, 0x95, 0x9c, 0x99, 0xff, 0x8c, 0x91, 0x93, 0xff, 0x6e, 0x71, 0x76, 0xff, 0x8e, 0x92, 0x93, 0xff, 0x67, 0x6e, 0x70, 0xff, 0x00, 0x01, 0x09, 0xff, 0x1d, 0x28, 0x3d, 0xff, 0x3a, 0x52, 0x7f, 0xff, 0x3d, 0x5a, 0x89, 0xff, 0x55, 0x79, 0xaf, 0xff, 0x71, 0x92, 0xc6, 0xff, 0x86, 0xa4, 0xd7, 0xff, 0x90, 0xad, 0xdf, 0xff, 0x96, 0xb4, 0xe5, 0xff, 0x9f, 0xbd, 0xed, 0xff, 0x9f, 0xbe, 0xeb, 0xff, 0x9f, 0xbd, 0xea, 0xff, 0x9f, 0xb9, 0xe6, 0xff, 0x9a, 0xb4, 0xe1, 0xff, 0x81, 0xa0, 0xd1, 0xff, 0x61, 0x83, 0xb8, 0xff, 0x48, 0x6a, 0xa1, 0xff, 0x70, 0x8e, 0xc5, 0xff, 0xa7, 0xc0, 0xf1, 0xff, 0xaf, 0xc9, 0xf6, 0xff, 0xa9, 0xc7, 0xf2, 0xff, 0xa6, 0xc4, 0xf2, 0xff, 0xac, 0xc7, 0xf5, 0xff, 0xa7, 0xc2, 0xf0, 0xff, 0x9f, 0xbc, 0xeb, 0xff, 0x9e, 0xbd, 0xec, 0xff, 0xa0, 0xbc, 0xeb, 0xff, 0xa3, 0xbc, 0xeb, 0xff, 0xad, 0xc6, 0xf4, 0xff, 0xaf, 0xcb, 0xfb, 0xff, 0x94, 0xb2, 0xea, 0xff, 0x31, 0x3d, 0x58, 0xff, 0xa3, 0xae, 0xb2, 0xff, 0xe3, 0xe9, 0xeb, 0xff, 0xd7, 0xd8, 0xd7, 0xff, 0xa7, 0xa8, 0xa8, 0xff, 0x49, 0x4d, 0x4c, 0xff, 0x9d, 0xa4, 0xa2, 0xff, 0xd0, 0xd4, 0xd4, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xbb, 0xbc, 0xff, 0xb5, 0xba, 0xbb, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb8, 0xb8, 0xba, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb0, 0xb6, 0xb4, 0xff, 0xb0, 0xb4, 0xb4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbc, 0xbb, 0xc8, 0xba, 0xbc, 0xbc, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xbf, 0xc1, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc1, 0xc2, 0xc3, 0xff, 0xc0, 0xc3, 0xc4, 0xff, 0xc0, 0xc3, 0xc4, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc3, 0xc5, 0xc6, 0xff, 0xc2, 0xc6, 0xc7, 0xff, 0xc3, 0xc7, 0xc7, 0xff, 0xc3, 0xc7, 0xc7, 0xff, 0xc6, 0xc8, 0xc7, 0xff, 0xc7, 0xc8, 0xc9, 0xff, 0xcd, 0xd1, 0xd0, 0xff, 0x83, 0x8a, 0x86, 0xff, 0x93, 0x98, 0x99, 0xff, 0x79, 0x7e, 0x83, 0xff, 0x7d, 0x82, 0x83, 0xff, 0x6c, 0x70, 0x79, 0xff, 0x00, 0x05, 0x1a, 0xff, 0x15, 0x23, 0x3b, 0xff, 0x3a, 0x51, 0x7e, 0xff, 0x38, 0x53, 0x82, 0xff, 0x4e, 0x6d, 0xa5, 0xff, 0x6d, 0x8d, 0xc4, 0xff, 0x83, 0xa1, 0xd6, 0xff, 0x93, 0xae, 0xe1, 0xff, 0xa2, 0xbb, 0xea, 0xff, 0xa8, 0xc1, 0xee, 0xff, 0xa5, 0xbf, 0xee, 0xff, 0xa0, 0xbc, 0xea, 0xff, 0xa7, 0xc0, 0xee, 0xff, 0xa6, 0xbe, 0xec, 0xff, 0x88, 0xa7, 0xd7, 0xff, 0x68, 0x8c, 0xbf, 0xff, 0x49, 0x69, 0xa1, 0xff, 0x67, 0x83, 0xbb, 0xff, 0xa0, 0xbb, 0xeb, 0xff, 0xaa, 0xc4, 0xf1, 0xff, 0xad, 0xc8, 0xf4, 0xff, 0xb0, 0xcc, 0xf8, 0xff, 0xb6, 0xcd, 0xf7, 0xff, 0xb4, 0xcc, 0xf7, 0xff, 0xad, 0xc6, 0xf3, 0xff, 0xa9, 0xc1, 0xf0, 0xff, 0xab, 0xc4, 0xf2, 0xff, 0xaf, 0xc7, 0xf5, 0xff, 0xb3, 0xc8, 0xf5, 0xff, 0xb0, 0xc8, 0xf7, 0xff, 0xaa, 0xcc, 0xff, 0xff, 0x36, 0x46, 0x65, 0xff, 0x7d, 0x87, 0x89, 0xff, 0xe4, 0xec, 0xf0, 0xff, 0xd9, 0xdc, 0xdd, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0x5b, 0x5f, 0x5d, 0xff, 0x85, 0x8a, 0x8b, 0xff, 0xce, 0xd3, 0xd5, 0xff, 0xb8, 0xbd, 0xbd, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb9, 0xbd, 0xbe, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb5, 0xba, 0xbb, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xba, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb7, 0xb7, 0xb8, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb6, 0xff, 0xb1, 0xb5, 0xb5, 0xff, 0xb1, 0xb6, 0xb5, 0xff, 0xb1, 0xb5, 0xb5, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xbc, 0xbc, 0x4d, 0xbb, 0xbd, 0xbd, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc1, 0xc2, 0xc3, 0xff, 0xc1, 0xc4, 0xc5, 0xff, 0xbf, 0xc4, 0xc4, 0xff, 0xc1, 0xc4, 0xc4, 0xff, 0xc3, 0xc5, 0xc6, 0xff, 0xc5, 0xc7, 0xc8, 0xff, 0xc5, 0xc7, 0xc7, 0xff, 0xc5, 0xc7, 0xc7, 0xff, 0xc5, 0xc7, 0xc7, 0xff, 0xc7, 0xc9, 0xc9, 0xff, 0xcc, 0xce, 0xce, 0xff, 0x87, 0x8c, 0x8a, 0xff, 0x8e, 0x92, 0x94, 0xff, 0x73, 0x78, 0x7c, 0xff, 0x7b, 0x7f, 0x82, 0xff, 0x6a, 0x6f, 0x77, 0xff, 0x13, 0x1c, 0x33, 0xff, 0x19, 0x27, 0x42, 0xff, 0x33, 0x4b, 0x72, 0xff, 0x35, 0x4f, 0x7d, 0xff, 0x48, 0x65, 0x9b, 0xff, 0x64, 0x84, 0xbe, 0xff, 0x7e, 0x99, 0xd2, 0xff, 0x8f, 0xa6, 0xdf, 0xff, 0x9d, 0xb1, 0xe7, 0xff, 0xaa, 0xbf, 0xef, 0xff, 0xb1, 0xc7, 0xf6, 0xff, 0xb7, 0xcc, 0xf7, 0xff, 0xb7, 0xce, 0xf5, 0xff, 0xb5, 0xcb, 0xf3, 0xff, 0x91, 0xad, 0xdd, 0xff, 0x59, 0x7b, 0xb0, 0xff, 0x4a, 0x67, 0xa1, 0xff, 0x74, 0x90, 0xc5, 0xff, 0xa1, 0xbb, 0xea, 0xff, 0xab, 0xc4, 0xf2, 0xff, 0xa3, 0xbf, 0xed, 0xff, 0xaa, 0xc5, 0xf1, 0xff, 0xb8, 0xd2, 0xf8, 0xff, 0xbe, 0xd6, 0xf9, 0xff, 0xb7, 0xce, 0xf5, 0xff, 0xb1, 0xc8, 0xf3, 0xff, 0xb5, 0xcd, 0xf8, 0xff, 0xb7, 0xce, 0xfa, 0xff, 0xb4, 0xca, 0xf9, 0xff, 0xaf, 0xc5, 0xf9, 0xff, 0xae, 0xce, 0xff, 0xff, 0x3c, 0x4a, 0x69, 0xff, 0x75, 0x7b, 0x7d, 0xff, 0xdf, 0xe9, 0xee, 0xff, 0xd5, 0xd9, 0xdb, 0xff, 0xc1, 0xc2, 0xc2, 0xff, 0x78, 0x7a, 0x78, 0xff, 0x77, 0x7b, 0x7b, 0xff, 0xc7, 0xcc, 0xcd, 0xff, 0xb9, 0xbe, 0xbe, 0xff, 0xb8, 0xbb, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb5, 0xb8, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb1, 0xb5, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb6, 0xb5, 0xff, 0xb1, 0xb6, 0xb5, 0xff, 0xaf, 0xb6, 0xb2, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xbd, 0xbe, 0xcd, 0xbb, 0xbd, 0xbf, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc1, 0xc2, 0xc4, 0xff, 0xc1, 0xc4, 0xc5, 0xff, 0xc0, 0xc6, 0xc4, 0xff, 0xc3, 0xc5, 0xc5, 0xff, 0xc4, 0xc5, 0xc6, 0xff, 0xc4, 0xc6, 0xc7, 0xff, 0xc5, 0xc6, 0xc7, 0xff, 0xc5, 0xc8, 0xc7, 0xff, 0xc6, 0xc8, 0xc7, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xc8, 0xca, 0xcb, 0xff, 0x84, 0x89, 0x88, 0xff, 0x90, 0x95, 0x98, 0xff, 0x6e, 0x73, 0x76, 0xff, 0x7b, 0x7f, 0x82, 0xff, 0x70, 0x77, 0x7c, 0xff, 0x15, 0x1d, 0x35, 0xff, 0x0e, 0x1b, 0x38, 0xff, 0x2e, 0x46, 0x66, 0xff, 0x36, 0x4e, 0x7a, 0xff, 0x43, 0x61, 0x93, 0xff, 0x5b, 0x78, 0xb5, 0xff, 0x74, 0x8d, 0xcd, 0xff, 0x8c, 0xa0, 0xde, 0xff, 0x9b, 0xaf, 0xe8, 0xff, 0xab, 0xc0, 0xf2, 0xff, 0xb3, 0xc8, 0xf8, 0xff, 0xbb, 0xcf, 0xfa, 0xff, 0xbf, 0xd2, 0xf8, 0xff, 0xb7, 0xcd, 0xf6, 0xff, 0x74, 0x90, 0xc4, 0xff, 0x42, 0x60, 0x9b, 0xff, 0x52, 0x6e, 0xaa, 0xff, 0x87, 0xa2, 0xd6, 0xff, 0xb3, 0xcc, 0xf7, 0xff, 0xba, 0xd2, 0xfa, 0xff, 0xbd, 0xd7, 0xfe, 0xff, 0xaf, 0xc6, 0xf3, 0xff, 0x99, 0xb4, 0xe3, 0xff, 0xa8, 0xc4, 0xef, 0xff, 0xc0, 0xd6, 0xfc, 0xff, 0xb9, 0xd0, 0xf8, 0xff, 0xb7, 0xcf, 0xfb, 0xff, 0xbc, 0xd4, 0xfd, 0xff, 0xb8, 0xcf, 0xfc, 0xff, 0xaf, 0xc7, 0xfb, 0xff, 0xa3, 0xc5, 0xff, 0xff, 0x27, 0x37, 0x56, 0xff, 0x64, 0x6c, 0x6e, 0xff, 0xd7, 0xe0, 0xe4, 0xff, 0xde, 0xe4, 0xe5, 0xff, 0xc3, 0xc4, 0xc4, 0xff, 0x81, 0x81, 0x82, 0xff, 0x70, 0x74, 0x74, 0xff, 0xc8, 0xcd, 0xce, 0xff, 0xbe, 0xc2, 0xc3, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb8, 0xbc, 0xbc, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb6, 0xb8, 0xb8, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb6, 0xb7, 0xb8, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb5, 0xff, 0xaf, 0xb5, 0xb4, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbb, 0xbb, 0x40, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbb, 0xbd, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc1, 0xc4, 0xc5, 0xff, 0xc0, 0xc4, 0xc5, 0xff, 0xc0, 0xc4, 0xc4, 0xff, 0xc3, 0xc5, 0xc6, 0xff, 0xc3, 0xc6, 0xc6, 0xff, 0xc2, 0xc6, 0xc6, 0xff, 0xc4, 0xc7, 0xc7, 0xff, 0xc5, 0xc7, 0xc8, 0xff, 0xc6, 0xc8, 0xc9, 0xff, 0xce, 0xd0, 0xd1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0x80, 0x85, 0x84, 0xff, 0x92, 0x96, 0x99, 0xff, 0x7a, 0x7e, 0x82, 0xff, 0x87, 0x8b, 0x8c, 0xff, 0x6d, 0x73, 0x76, 0xff, 0x35, 0x44, 0x60, 0xff, 0x1e, 0x31, 0x56, 0xff, 0x20, 0x37, 0x55, 0xff, 0x34, 0x4d, 0x75, 0xff, 0x42, 0x5c, 0x90, 0xff, 0x50, 0x6d, 0xaa, 0xff, 0x67, 0x84, 0xc4, 0xff, 0x81, 0x99, 0xd8, 0xff, 0x98, 0xae, 0xe7, 0xff, 0xa8, 0xbd, 0xf0, 0xff, 0xb2, 0xc8, 0xf8, 0xff, 0xbc, 0xd2, 0xfb, 0xff, 0xc4, 0xd9, 0xff, 0xff, 0x97, 0xb1, 0xe1, 0xff, 0x48, 0x65, 0x9f, 0xff, 0x59, 0x76, 0xaf, 0xff, 0x5b, 0x75, 0xaa, 0xff, 0x7e, 0x9a, 0xd2, 0xff, 0xa9, 0xc5, 0xf3, 0xff, 0xbe, 0xd7, 0xfc, 0xff, 0x96, 0xaf, 0xd8, 0xff, 0x8f, 0xaa, 0xdb, 0xff, 0xa6, 0xc3, 0xf0, 0xff, 0x82, 0xa2, 0xd6, 0xff, 0x9d, 0xba, 0xec, 0xff, 0xb8, 0xcf, 0xfa, 0xff, 0xb9, 0xcf, 0xfc, 0xff, 0xb9, 0xd1, 0xfc, 0xff, 0xb6, 0xce, 0xfc, 0xff, 0xac, 0xca, 0xfb, 0xff, 0x91, 0xb4, 0xef, 0xff, 0x12, 0x1f, 0x42, 0xff, 0x61, 0x6a, 0x6e, 0xff, 0xd0, 0xdc, 0xe1, 0xff, 0xe1, 0xe7, 0xe8, 0xff, 0xbe, 0xc1, 0xc2, 0xff, 0x85, 0x89, 0x8a, 0xff, 0x67, 0x6b, 0x6d, 0xff, 0xc7, 0xcc, 0xce, 0xff, 0xc0, 0xc4, 0xc5, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb8, 0xbd, 0xbb, 0xff, 0xb8, 0xbc, 0xbc, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb5, 0xb9, 0xb8, 0xff, 0xb5, 0xb8, 0xb8, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xaf, 0xb5, 0xb5, 0xff, 0xaf, 0xb3, 0xb3, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xbd, 0xbd, 0xb3, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xbf, 0xc2, 0xc3, 0xff, 0xc0, 0xc3, 0xc4, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc3, 0xc4, 0xc6, 0xff, 0xc3, 0xc5, 0xc7, 0xff, 0xc2, 0xc7, 0xc7, 0xff, 0xc5, 0xc7, 0xc8, 0xff, 0xc6, 0xc8, 0xc9, 0xff, 0xc5, 0xc9, 0xca, 0xff, 0xd2, 0xd5, 0xd7, 0xff, 0xb1, 0xb5, 0xb5, 0xff, 0x7d, 0x82, 0x81, 0xff, 0x99, 0x9e, 0xa0, 0xff, 0x7f, 0x84, 0x88, 0xff, 0x8f, 0x94, 0x95, 0xff, 0x78, 0x7e, 0x7d, 0xff, 0x4a, 0x5f, 0x78, 0xff, 0x3c, 0x5c, 0x8c, 0xff, 0x24, 0x39, 0x5c, 0xff, 0x2b, 0x42, 0x64, 0xff, 0x3d, 0x57, 0x89, 0xff, 0x4b, 0x68, 0xa2, 0xff, 0x5c, 0x7b, 0xb7, 0xff, 0x78, 0x94, 0xd1, 0xff, 0x90, 0xaa, 0xe4, 0xff, 0xa0, 0xb8, 0xed, 0xff, 0xab, 0xc1, 0xf4, 0xff, 0xb7, 0xce, 0xfa, 0xff, 0xb8, 0xcf, 0xfa, 0xff, 0x84, 0xa0, 0xd2, 0xff, 0x4c, 0x67, 0xa2, 0xff, 0x5d, 0x7b, 0xb2, 0xff, 0x1f, 0x26, 0x4a, 0xff, 0x2f, 0x46, 0x75, 0xff, 0x94, 0xb5, 0xec, 0xff, 0xaa, 0xc1, 0xf0, 0xff, 0x57, 0x63, 0x9d, 0xff, 0x59, 0x74, 0xb1, 0xff, 0xb4, 0xd1, 0xf9, 0xff, 0x9d, 0xb9, 0xe3, 0xff, 0x71, 0x95, 0xce, 0xff, 0x98, 0xb6, 0xeb, 0xff, 0xb0, 0xca, 0xf8, 0xff, 0xb5, 0xcd, 0xfb, 0xff, 0xb7, 0xce, 0xfc, 0xff, 0xad, 0xcd, 0xff, 0xff, 0x7a, 0x99, 0xd1, 0xff, 0x0a, 0x0f, 0x22, 0xff, 0x66, 0x6e, 0x74, 0xff, 0xc0, 0xcf, 0xd7, 0xff, 0xdc, 0xe4, 0xe6, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0x9b, 0x9e, 0x9f, 0xff, 0x62, 0x66, 0x67, 0xff, 0xae, 0xb3, 0xb4, 0xff, 0xca, 0xce, 0xd0, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb9, 0xbe, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xba, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xba, 0xff, 0xb5, 0xb8, 0xba, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb0, 0xb5, 0xb6, 0xff, 0xb2, 0xb4, 0xb6, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbb, 0xbb, 0x22, 0xba, 0xbc, 0xbc, 0xfe, 0xba, 0xbc, 0xbc, 0xff, 0xbc, 0xbe, 0xbd, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbb, 0xbd, 0xbe, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc0, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc0, 0xc2, 0xc1, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc1, 0xc3, 0xc3, 0xff, 0xc1, 0xc4, 0xc4, 0xff, 0xc3, 0xc5, 0xc6, 0xff, 0xc3, 0xc6, 0xc7, 0xff, 0xc3, 0xc6, 0xc7, 0xff, 0xc5, 0xc6, 0xc7, 0xff, 0xc4, 0xc7, 0xc8, 0xff, 0xc4, 0xc9, 0xca, 0xff, 0xc5, 0xc9, 0xca, 0xff, 0xd2, 0xd7, 0xd8, 0xff, 0xa3, 0xa7, 0xa8, 0xff, 0x7d, 0x83, 0x82, 0xff, 0x9a, 0x9f, 0xa1, 0xff, 0x80, 0x85, 0x89, 0xff, 0x9a, 0x9f, 0xa1, 0xff, 0x7e, 0x83, 0x85, 0xff, 0x3b, 0x48, 0x60, 0xff, 0x45, 0x63, 0x9a, 0xff, 0x45, 0x63, 0x95, 0xff, 0x27, 0x40, 0x61, 0xff, 0x38, 0x51, 0x79, 0xff, 0x49, 0x65, 0x9b, 0xff, 0x55, 0x73, 0xad, 0xff, 0x6f, 0x8c, 0xc6, 0xff, 0x88, 0xa5, 0xdd, 0xff, 0x99, 0xb4, 0xe8, 0xff, 0xa5, 0xbe, 0xf0, 0xff, 0xb1, 0xc9, 0xfa, 0xff, 0xa0, 0xb9, 0xea, 0xff, 0x83, 0x9d, 0xcf, 0xff, 0x6a, 0x84, 0xba, 0xff, 0x5c, 0x73, 0xad, 0xff, 0x50, 0x67, 0xa2, 0xff, 0x3e, 0x56, 0x88, 0xff, 0x68, 0x86, 0xba, 0xff, 0x97, 0xb1, 0xe3, 0xff, 0xb2, 0xc7, 0xf8, 0xff, 0xb2, 0xc9, 0xf5, 0xff, 0xb0, 0xc7, 0xf0, 0xff, 0xbd, 0xd3, 0xfa, 0xff, 0x94, 0xae, 0xdc, 0xff, 0x78, 0x97, 0xcd, 0xff, 0x96, 0xb6, 0xea, 0xff, 0xaa, 0xc6, 0xf5, 0xff, 0xb1, 0xca, 0xf8, 0xff, 0xaa, 0xcc, 0xff, 0xff, 0x5a, 0x75, 0xa7, 0xff, 0x04, 0x08, 0x16, 0xff, 0x67, 0x71, 0x7b, 0xff, 0xb6, 0xc2, 0xcc, 0xff, 0xd6, 0xdf, 0xe3, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xa1, 0xa4, 0xa5, 0xff, 0x74, 0x78, 0x7a, 0xff, 0x9b, 0xa0, 0xa1, 0xff, 0xcf, 0xd3, 0xd4, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb9, 0xbe, 0xbd, 0xff, 0xb9, 0xbd, 0xbe, 0xff, 0xb9, 0xbd, 0xbe, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbc, 0xbd, 0xff, 0xb6, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xba, 0xba, 0xff, 0xb6, 0xba, 0xba, 0xff, 0xb5, 0xba, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb4, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb0, 0xb4, 0xb5, 0xfe, 0xac, 0xb4, 0xb4, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xbc, 0xbc, 0x86, 0xba, 0xbc, 0xbc, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbb, 0xbd, 0xbe, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc2, 0xc4, 0xc3, 0xff, 0xc2, 0xc4, 0xc4, 0xff, 0xc3, 0xc4, 0xc6, 0xff, 0xc3, 0xc6, 0xc7, 0xff, 0xc3, 0xc6, 0xc7, 0xff, 0xc5, 0xc7, 0xc8, 0xff, 0xc4, 0xc7, 0xc8, 0xff, 0xc5, 0xc8, 0xca, 0xff, 0xc5, 0xc9, 0xca, 0xff, 0xd1, 0xd5, 0xd6, 0xff, 0xa0, 0xa4, 0xa4, 0xff, 0x73, 0x79, 0x78, 0xff, 0x9a, 0x9f, 0xa1, 0xff, 0x85, 0x8c, 0x8f, 0xff, 0x9b, 0xa0, 0xa2, 0xff, 0x7d, 0x81, 0x85, 0xff, 0x31, 0x3c, 0x56, 0xff, 0x42, 0x63, 0xa0, 0xff, 0x43, 0x63, 0x94, 0xff, 0x23, 0x3b, 0x5c, 0xff, 0x37, 0x50, 0x77, 0xff, 0x46, 0x5e, 0x90, 0xff, 0x4e, 0x68, 0xa0, 0xff, 0x63, 0x80, 0xb8, 0xff, 0x7d, 0x9d, 0xd2, 0xff, 0x90, 0xae, 0xe1, 0xff, 0x9e, 0xba, 0xec, 0xff, 0x9d, 0xba, 0xeb, 0xff, 0x90, 0xad, 0xde, 0xff, 0x83, 0x9d, 0xcf, 0xff, 0x82, 0x9c, 0xd1, 0xff, 0x7c, 0x97, 0xcd, 0xff, 0x7f, 0x9c, 0xcb, 0xff, 0x99, 0xb3, 0xe1, 0xff, 0x90, 0xab, 0xd9, 0xff, 0xa0, 0xba, 0xe5, 0xff, 0xaf, 0xc6, 0xef, 0xff, 0xaf, 0xc8, 0xf0, 0xff, 0xb0, 0xc9, 0xf5, 0xff, 0xb4, 0xcc, 0xf5, 0xff, 0xba, 0xd0, 0xf6, 0xff, 0x9a, 0xb7, 0xe3, 0xff, 0x7f, 0xa1, 0xd3, 0xff, 0x94, 0xb4, 0xe3, 0xff, 0x9f, 0xbe, 0xed, 0xff, 0x9f, 0xc3, 0xf5, 0xff, 0x47, 0x62, 0x91, 0xff, 0x01, 0x07, 0x1c, 0xff, 0x6f, 0x78, 0x82, 0xff, 0xc0, 0xc9, 0xd3, 0xff, 0xd3, 0xdb, 0xe1, 0xff, 0xc4, 0xc8, 0xca, 0xff, 0x96, 0x9a, 0x9a, 0xff, 0x84, 0x88, 0x89, 0xff, 0x9a, 0x9f, 0xa1, 0xff, 0xc3, 0xc8, 0xca, 0xff, 0xba, 0xbe, 0xbe, 0xff, 0xb9, 0xbe, 0xbc, 0xff, 0xb8, 0xbc, 0xbc, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb6, 0xb9, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xbb, 0xff, 0xb6, 0xb9, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xba, 0xbb, 0xff, 0xb5, 0xb8, 0xba, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb5, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x04, 0xb9, 0xbb, 0xbb, 0xe7, 0xbb, 0xbd, 0xbd, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xba, 0xbc, 0xbd, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbd, 0xbf, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc1, 0xc3, 0xc3, 0xff, 0xc1, 0xc3, 0xc3, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc1, 0xc3, 0xc3, 0xff, 0xc2, 0xc3, 0xc4, 0xff, 0xc2, 0xc4, 0xc4, 0xff, 0xc2, 0xc4, 0xc4, 0xff, 0xc3, 0xc5, 0xc6, 0xff, 0xc4, 0xc6, 0xc8, 0xff, 0xc5, 0xc7, 0xc7, 0xff, 0xc5, 0xc6, 0xc7, 0xff, 0xc6, 0xc8, 0xc9, 0xff, 0xc4, 0xc8, 0xca, 0xff, 0xc5, 0xc8, 0xc9, 0xff, 0xd6, 0xd9, 0xd8, 0xff, 0x94, 0x99, 0x98, 0xff, 0x65, 0x6a, 0x6b, 0xff, 0x9b, 0x9f, 0xa3, 0xff, 0x90, 0x97, 0x99, 0xff, 0x9b, 0x9f, 0xa2, 0xff, 0x7c, 0x82, 0x85, 0xff, 0x2e, 0x35, 0x3c, 0xff, 0x04, 0x0a, 0x19, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1c, 0x2d, 0x43, 0xff, 0x3e, 0x5c, 0x8d, 0xff, 0x47, 0x62, 0x92, 0xff, 0x4c, 0x64, 0x97, 0xff, 0x58, 0x76, 0xac, 0xff, 0x6f, 0x8e, 0xc4, 0xff, 0x82, 0xa2, 0xd5, 0xff, 0x89, 0xa9, 0xdb, 0xff, 0x86, 0xa6, 0xd6, 0xff, 0x88, 0xa7, 0xd6, 0xff, 0x82, 0x9e, 0xd3, 0xff, 0x86, 0xa2, 0xd5, 0xff, 0x8b, 0xaa, 0xd5, 0xff, 0x94, 0xb1, 0xda, 0xff, 0xaf, 0xcb, 0xef, 0xff, 0xb3, 0xcc, 0xf3, 0xff, 0x9b, 0xb8, 0xe5, 0xff, 0xab, 0xc7, 0xee, 0xff, 0xac, 0xc8, 0xef, 0xff, 0xb1, 0xcd, 0xf3, 0xff, 0xb6, 0xd0, 0xf7, 0xff, 0xb4, 0xcd, 0xf5, 0xff, 0xb4, 0xcc, 0xf5, 0xff, 0x93, 0xb2, 0xe0, 0xff, 0x91, 0xb3, 0xe2, 0xff, 0x9a, 0xbd, 0xeb, 0xff, 0x93, 0xb8, 0xea, 0xff, 0x41, 0x5c, 0x8c, 0xff, 0x13, 0x18, 0x2b, 0xff, 0x79, 0x82, 0x88, 0xff, 0xb9, 0xc3, 0xcb, 0xff, 0xd2, 0xda, 0xe0, 0xff, 0xcb, 0xd1, 0xd2, 0xff, 0xa5, 0xa8, 0xa8, 0xff, 0x83, 0x85, 0x86, 0xff, 0x89, 0x8f, 0x91, 0xff, 0xc4, 0xca, 0xce, 0xff, 0xbf, 0xc3, 0xc2, 0xff, 0xb9, 0xbe, 0xbd, 0xff, 0xb8, 0xbd, 0xbc, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbb, 0xbd, 0xff, 0xb9, 0xbd, 0xbe, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xba, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbb, 0xff, 0xb7, 0xbb, 0xbb, 0xff, 0xb6, 0xba, 0xba, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb9, 0xba, 0xff, 0xb4, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb5, 0xb6, 0xe7, 0xbf, 0xbf, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xbc, 0xbc, 0x49, 0xba, 0xbc, 0xbc, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbe, 0xc0, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc5, 0xff, 0xc1, 0xc4, 0xc5, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc4, 0xc6, 0xc7, 0xff, 0xc4, 0xc6, 0xc7, 0xff, 0xc5, 0xc7, 0xc8, 0xff, 0xc6, 0xc9, 0xc9, 0xff, 0xc4, 0xc8, 0xc9, 0xff, 0xc7, 0xc9, 0xc9, 0xff, 0xd5, 0xd8, 0xd9, 0xff, 0x84, 0x89, 0x89, 0xff, 0x5f, 0x63, 0x65, 0xff, 0x9b, 0xa0, 0xa7, 0xff, 0x9a, 0xa0, 0xa2, 0xff, 0x90, 0x98, 0x99, 0xff, 0x74, 0x7d, 0x82, 0xff, 0x49, 0x4c, 0x4e, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0f, 0x1a, 0x25, 0xff, 0x3c, 0x5b, 0x89, 0xff, 0x4d, 0x6c, 0xa0, 0xff, 0x4f, 0x6b, 0x9d, 0xff, 0x54, 0x72, 0xa6, 0xff, 0x6c, 0x8b, 0xc0, 0xff, 0x81, 0xa1, 0xd2, 0xff, 0x73, 0x96, 0xc5, 0xff, 0x7a, 0x9a, 0xc9, 0xff, 0x83, 0xa1, 0xd1, 0xff, 0x70, 0x95, 0xc9, 0xff, 0x74, 0x98, 0xcc, 0xff, 0x81, 0x9d, 0xd3, 0xff, 0x7a, 0x94, 0xd5, 0xff, 0x80, 0x97, 0xda, 0xff, 0x96, 0xa9, 0xe8, 0xff, 0x91, 0xa4, 0xe8, 0xff, 0x92, 0xa1, 0xe9, 0xff, 0x99, 0xa9, 0xed, 0xff, 0xa4, 0xbd, 0xf1, 0xff, 0xaa, 0xc7, 0xf2, 0xff, 0xa5, 0xc4, 0xeb, 0xff, 0x99, 0xb8, 0xe5, 0xff, 0x99, 0xb7, 0xe6, 0xff, 0xa3, 0xc4, 0xf1, 0xff, 0x9d, 0xc0, 0xec, 0xff, 0x93, 0xb7, 0xe9, 0xff, 0x3e, 0x5a, 0x89, 0xff, 0x10, 0x16, 0x25, 0xff, 0x7e, 0x86, 0x90, 0xff, 0xb1, 0xbc, 0xc3, 0xff, 0xcf, 0xd6, 0xd9, 0xff, 0xc8, 0xcd, 0xcf, 0xff, 0xb1, 0xb5, 0xb5, 0xff, 0x84, 0x86, 0x86, 0xff, 0x74, 0x79, 0x7c, 0xff, 0xc1, 0xc7, 0xcd, 0xff, 0xbf, 0xc4, 0xc6, 0xff, 0xb9, 0xbd, 0xbd, 0xff, 0xba, 0xbe, 0xbe, 0xff, 0xb9, 0xbd, 0xbe, 0xff, 0xb9, 0xbd, 0xbe, 0xff, 0xb9, 0xbd, 0xbe, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb9, 0xbc, 0xbd, 0xff, 0xb9, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xbb, 0xbb, 0xff, 0xb7, 0xbb, 0xbb, 0xff, 0xb6, 0xbb, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xba, 0xbb, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb3, 0xb6, 0xb6, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xbb, 0xbb, 0x9f, 0xb9, 0xbb, 0xbb, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc3, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xbf, 0xc2, 0xc3, 0xff, 0xc0, 0xc4, 0xc5, 0xff, 0xc1, 0xc5, 0xc6, 0xff, 0xc2, 0xc4, 0xc6, 0xff, 0xc2, 0xc4, 0xc4, 0xff, 0xc3, 0xc5, 0xc5, 0xff, 0xc4, 0xc6, 0xc7, 0xff, 0xc6, 0xc7, 0xc7, 0xff, 0xc5, 0xc8, 0xc8, 0xff, 0xc3, 0xc7, 0xc7, 0xff, 0xc8, 0xca, 0xcb, 0xff, 0xd1, 0xd4, 0xd5, 0xff, 0x81, 0x86, 0x86, 0xff, 0x5d, 0x62, 0x63, 0xff, 0x9b, 0xa1, 0xa7, 0xff, 0x99, 0x9e, 0xa1, 0xff, 0x89, 0x8e, 0x92, 0xff, 0x74, 0x79, 0x80, 0xff, 0x58, 0x5d, 0x63, 0xff, 0x10, 0x11, 0x13, 0xff, 0x00, 0x00, 0x00, 0xff, 0x03, 0x06, 0x07, 0xff, 0x36, 0x4f, 0x78, 0xff, 0x52, 0x71, 0xa9, 0xff, 0x57, 0x76, 0xac, 0xff, 0x54, 0x73, 0xa6, 0xff, 0x6c, 0x8d, 0xbf, 0xff, 0x8f, 0xb0, 0xdf, 0xff, 0x80, 0xa3, 0xd1, 0xff, 0x78, 0x99, 0xc7, 0xff, 0x68, 0x88, 0xb7, 0xff, 0x31, 0x4a, 0x7f, 0xff, 0x30, 0x3a, 0x7f, 0xff, 0x48, 0x50, 0xa5, 0xff, 0x4f, 0x57, 0xb3, 0xff, 0x48, 0x50, 0xb4, 0xff, 0x48, 0x4f, 0xb7, 0xff, 0x56, 0x58, 0xbd, 0xff, 0x54, 0x57, 0xc0, 0xff, 0x5e, 0x62, 0xc4, 0xff, 0x4e, 0x56, 0xb2, 0xff, 0x4b, 0x5b, 0xa9, 0xff, 0x84, 0xa3, 0xd3, 0xff, 0x98, 0xbd, 0xe5, 0xff, 0xa1, 0xc0, 0xed, 0xff, 0xaa, 0xc8, 0xf5, 0xff, 0x9d, 0xbd, 0xea, 0xff, 0x99, 0xbd, 0xf0, 0xff, 0x36, 0x52, 0x80, 0xff, 0x06, 0x0d, 0x1a, 0xff, 0x7d, 0x86, 0x93, 0xff, 0xb4, 0xc0, 0xc8, 0xff, 0xc7, 0xcf, 0xd3, 0xff, 0xcc, 0xd1, 0xd3, 0xff, 0xb0, 0xb6, 0xb5, 0xff, 0x8f, 0x93, 0x93, 0xff, 0x70, 0x74, 0x77, 0xff, 0xac, 0xb3, 0xb9, 0xff, 0xc4, 0xca, 0xcb, 0xff, 0xba, 0xbd, 0xbe, 0xff, 0xba, 0xbd, 0xbf, 0xff, 0xb9, 0xbd, 0xbe, 0xff, 0xb9, 0xbd, 0xbe, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb9, 0xbd, 0xbe, 0xff, 0xb9, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb8, 0xbb, 0xbc, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xba, 0xbb, 0xff, 0xb5, 0xba, 0xbb, 0xff, 0xb5, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb3, 0xb5, 0xb5, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb6, 0xb6, 0x07, 0xb8, 0xba, 0xba, 0xef, 0xb9, 0xbb, 0xbb, 0xff, 0xb9, 0xbb, 0xbc, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbd, 0xbf, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc0, 0xc2, 0xc1, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc1, 0xc3, 0xc3, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc2, 0xc5, 0xc6, 0xff, 0xc3, 0xc5, 0xc6, 0xff, 0xc3, 0xc6, 0xc7, 0xff, 0xc4, 0xc7, 0xc7, 0xff, 0xc5, 0xc7, 0xc6, 0xff, 0xc4, 0xc7, 0xc7, 0xff, 0xc3, 0xc9, 0xc9, 0xff, 0xc9, 0xcc, 0xcd, 0xff, 0xce, 0xd0, 0xd1, 0xff, 0x76, 0x7b, 0x7c, 0xff, 0x5f, 0x64, 0x64, 0xff, 0xa2, 0xa7, 0xaa, 0xff, 0x96, 0x9b, 0x9d, 0xff, 0x87, 0x8d, 0x91, 0xff, 0x75, 0x7b, 0x83, 0xff, 0x67, 0x6b, 0x6f, 0xff, 0x25, 0x26, 0x29, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x26, 0x39, 0x58, 0xff, 0x4e, 0x71, 0xad, 0xff, 0x5a, 0x7c, 0xb0, 0xff, 0x5d, 0x7e, 0xb2, 0xff, 0x5e, 0x7e, 0xb2, 0xff, 0x84, 0xa5, 0xd5, 0xff, 0x9a, 0xba, 0xe7, 0xff, 0x8a, 0xad, 0xd8, 0xff, 0x6e, 0x90, 0xbf, 0xff, 0x46, 0x56, 0x8e, 0xff, 0x2d, 0x29, 0x74, 0xff, 0x37, 0x32, 0x91, 0xff, 0x45, 0x41, 0xa9, 0xff, 0x60, 0x60, 0xc5, 0xff, 0x68, 0x6a, 0xd1, 0xff, 0x62, 0x5d, 0xcc, 0xff, 0x6d, 0x67, 0xd2, 0xff, 0x6e, 0x6c, 0xd2, 0xff, 0x6c, 0x70, 0xc3, 0xff, 0x8d, 0x9d, 0xd6, 0xff, 0xa7, 0xc7, 0xf0, 0xff, 0xa0, 0xc1, 0xec, 0xff, 0xa4, 0xc2, 0xf0, 0xff, 0xa4, 0xc4, 0xf1, 0xff, 0x9f, 0xbd, 0xeb, 0xff, 0x95, 0xbc, 0xf5, 0xff, 0x25, 0x3e, 0x69, 0xff, 0x0d, 0x10, 0x18, 0xff, 0x81, 0x90, 0x9e, 0xff, 0xb2, 0xbd, 0xc8, 0xff, 0xc4, 0xce, 0xd4, 0xff, 0xcd, 0xd3, 0xd6, 0xff, 0xae, 0xb2, 0xb4, 0xff, 0xa0, 0xa3, 0xa4, 0xff, 0x6e, 0x73, 0x75, 0xff, 0x9c, 0xa6, 0xa9, 0xff, 0xc4, 0xca, 0xca, 0xff, 0xb8, 0xbb, 0xbc, 0xff, 0xba, 0xbe, 0xbf, 0xff, 0xb9, 0xbd, 0xbe, 0xff, 0xb9, 0xbd, 0xbe, 0xff, 0xb9, 0xbd, 0xbe, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb7, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb5, 0xb5, 0xb6, 0xef, 0xb6, 0xb6, 0xb6, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xb9, 0xb9, 0x46, 0xb9, 0xbb, 0xbb, 0xff, 0xb9, 0xbb, 0xbc, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xba, 0xbc, 0xbd, 0xff, 0xbb, 0xbd, 0xbe, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xbf, 0xc1, 0xc3, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc0, 0xc2, 0xc1, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc2, 0xc3, 0xc4, 0xff, 0xc2, 0xc3, 0xc4, 0xff, 0xc3, 0xc6, 0xc7, 0xff, 0xc3, 0xc6, 0xc7, 0xff, 0xc2, 0xc5, 0xc6, 0xff, 0xc3, 0xc6, 0xc7, 0xff, 0xc5, 0xc7, 0xc7, 0xff, 0xc6, 0xc8, 0xc8, 0xff, 0xc5, 0xca, 0xcb, 0xff, 0xcb, 0xce, 0xcf, 0xff, 0xc6, 0xc8, 0xc9, 0xff, 0x6d, 0x71, 0x72, 0xff, 0x62, 0x66, 0x67, 0xff, 0xa1, 0xa6, 0xa6, 0xff, 0xa1, 0xa6, 0xa8, 0xff, 0x8b, 0x92, 0x98, 0xff, 0x78, 0x7e, 0x82, 0xff, 0x6b, 0x70, 0x72, 0xff, 0x4b, 0x4e, 0x51, 0xff, 0x07, 0x07, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x10, 0x18, 0x23, 0xff, 0x47, 0x69, 0xa1, 0xff, 0x55, 0x78, 0xb0, 0xff, 0x65, 0x8a, 0xbf, 0xff, 0x60, 0x81, 0xb6, 0xff, 0x69, 0x8b, 0xbe, 0xff, 0x91, 0xb2, 0xe2, 0xff, 0x90, 0xb2, 0xdf, 0xff, 0x74, 0x99, 0xc7, 0xff, 0x82, 0xa7, 0xd6, 0xff, 0x72, 0x8f, 0xcc, 0xff, 0x61, 0x70, 0xc1, 0xff, 0x6d, 0x73, 0xd0, 0xff, 0x80, 0x83, 0xe3, 0xff, 0x8a, 0x8c, 0xeb, 0xff, 0x90, 0x93, 0xed, 0xff, 0x99, 0xa2, 0xef, 0xff, 0xa4, 0xb5, 0xef, 0xff, 0xb2, 0xc8, 0xf4, 0xff, 0xb6, 0xd1, 0xf7, 0xff, 0xab, 0xc9, 0xf4, 0xff, 0xa6, 0xc4, 0xf2, 0xff, 0xa3, 0xc3, 0xef, 0xff, 0x9f, 0xc1, 0xed, 0xff, 0x9d, 0xbf, 0xeb, 0xff, 0x8f, 0xb6, 0xf1, 0xff, 0x11, 0x1e, 0x39, 0xff, 0x11, 0x14, 0x19, 0xff, 0x7f, 0x90, 0x9f, 0xff, 0xb1, 0xbb, 0xc5, 0xff, 0xbb, 0xc5, 0xca, 0xff, 0xc8, 0xcf, 0xd3, 0xff, 0xad, 0xb0, 0xb3, 0xff, 0xa2, 0xa6, 0xa6, 0xff, 0x78, 0x7c, 0x7f, 0xff, 0x8d, 0x95, 0x9b, 0xff, 0xc1, 0xc8, 0xca, 0xff, 0xba, 0xbd, 0xbd, 0xff, 0xbb, 0xbf, 0xc0, 0xff, 0xba, 0xbe, 0xbf, 0xff, 0xb8, 0xbd, 0xbe, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xb2, 0xb6, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb4, 0xb4, 0xb5, 0xff, 0xb4, 0xb5, 0xb6, 0xff, 0xb2, 0xb6, 0xb6, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xbd, 0xbd, 0x8d, 0xba, 0xbc, 0xbd, 0xff, 0xba, 0xbc, 0xbd, 0xff, 0xba, 0xbc, 0xbd, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xbb, 0xbd, 0xbe, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc3, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xbf, 0xc2, 0xc1, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xbf, 0xc3, 0xc4, 0xff, 0xc0, 0xc3, 0xc4, 0xff, 0xc1, 0xc4, 0xc5, 0xff, 0xc3, 0xc5, 0xc6, 0xff, 0xc4, 0xc6, 0xc7, 0xff, 0xc4, 0xc6, 0xc7, 0xff, 0xc4, 0xc6, 0xc7, 0xff, 0xc4, 0xc6, 0xc7, 0xff, 0xc8, 0xc9, 0xca, 0xff, 0xc9, 0xcb, 0xcc, 0xff, 0xce, 0xd1, 0xd1, 0xff, 0xbc, 0xbf, 0xbf, 0xff, 0x6b, 0x6f, 0x71, 0xff, 0x5e, 0x61, 0x64, 0xff, 0x98, 0x9d, 0x9d, 0xff, 0xa5, 0xab, 0xab, 0xff, 0x8d, 0x93, 0x97, 0xff, 0x7a, 0x7e, 0x81, 0xff, 0x6e, 0x74, 0x76, 0xff, 0x62, 0x67, 0x6b, 0xff, 0x20, 0x22, 0x22, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2e, 0x41, 0x66, 0xff, 0x54, 0x7a, 0xb9, 0xff, 0x63, 0x89, 0xbe, 0xff, 0x6c, 0x8e, 0xc3, 0xff, 0x6a, 0x8e, 0xc1, 0xff, 0x7c, 0xa0, 0xd0, 0xff, 0x85, 0xa4, 0xd6, 0xff, 0x7a, 0x9b, 0xcc, 0xff, 0x80, 0xa1, 0xd0, 0xff, 0x77, 0x98, 0xc9, 0xff, 0x71, 0x93, 0xc2, 0xff, 0x79, 0x9b, 0xc7, 0xff, 0x83, 0xa1, 0xd6, 0xff, 0x7f, 0x9b, 0xd6, 0xff, 0x88, 0xa7, 0xda, 0xff, 0x93, 0xb6, 0xe1, 0xff, 0xa3, 0xc5, 0xeb, 0xff, 0xa9, 0xc6, 0xf1, 0xff, 0xab, 0xc6, 0xf3, 0xff, 0xad, 0xca, 0xf5, 0xff, 0xa8, 0xc8, 0xf3, 0xff, 0xa2, 0xc3, 0xf0, 0xff, 0x9e, 0xbf, 0xec, 0xff, 0xac, 0xd1, 0xff, 0xff, 0x71, 0x92, 0xc4, 0xff, 0x00, 0x00, 0x00, 0xff, 0x19, 0x1f, 0x28, 0xff, 0x7f, 0x90, 0xa0, 0xff, 0xb5, 0xc0, 0xca, 0xff, 0xb6, 0xbf, 0xc5, 0xff, 0xca, 0xd1, 0xd4, 0xff, 0xad, 0xb0, 0xb1, 0xff, 0xa2, 0xa6, 0xa6, 0xff, 0x85, 0x89, 0x8d, 0xff, 0x82, 0x8a, 0x91, 0xff, 0xc1, 0xc8, 0xcd, 0xff, 0xbf, 0xc3, 0xc3, 0xff, 0xb9, 0xbd, 0xbe, 0xff, 0xba, 0xbe, 0xbf, 0xff, 0xb9, 0xbd, 0xbe, 0xff, 0xb9, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbb, 0xbc, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xba, 0xbb, 0xff, 0xb5, 0xba, 0xbb, 0xff, 0xb6, 0xb9, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb6, 0xbb, 0xb9, 0xff, 0xb5, 0xba, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb3, 0xb6, 0xb6, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbc, 0xbd, 0xd7, 0xba, 0xbc, 0xbe, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xb9, 0xbb, 0xbb, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xbb, 0xbd, 0xbc, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xbf, 0xc2, 0xc3, 0xff, 0xc0, 0xc3, 0xc4, 0xff, 0xc2, 0xc3, 0xc4, 0xff, 0xc0, 0xc3, 0xc4, 0xff, 0xbf, 0xc4, 0xc5, 0xff, 0xc0, 0xc4, 0xc5, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc3, 0xc5, 0xc6, 0xff, 0xc4, 0xc6, 0xc7, 0xff, 0xc5, 0xc7, 0xc8, 0xff, 0xc4, 0xc6, 0xc7, 0xff, 0xc6, 0xc8, 0xc8, 0xff, 0xc8, 0xca, 0xca, 0xff, 0xc9, 0xcb, 0xcc, 0xff, 0xd2, 0xd5, 0xd5, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0x6b, 0x70, 0x72, 0xff, 0x59, 0x5e, 0x62, 0xff, 0x96, 0x9b, 0x9e, 0xff, 0xb1, 0xb6, 0xb8, 0xff, 0x94, 0x99, 0x9c, 0xff, 0x75, 0x7a, 0x80, 0xff, 0x72, 0x77, 0x7b, 0xff, 0x6a, 0x6f, 0x73, 0xff, 0x38, 0x3b, 0x3d, 0xff, 0x01, 0x01, 0x01, 0xff, 0x03, 0x00, 0x00, 0xff, 0x05, 0x09, 0x0f, 0xff, 0x40, 0x5e, 0x8d, 0xff, 0x61, 0x84, 0xbe, 0xff, 0x6a, 0x90, 0xc6, 0xff, 0x72, 0x98, 0xcc, 0xff, 0x76, 0x99, 0xcc, 0xff, 0x78, 0x9b, 0xcd, 0xff, 0x7e, 0x9e, 0xcf, 0xff, 0x87, 0xa6, 0xd7, 0xff, 0x83, 0xa2, 0xd3, 0xff, 0x80, 0xa0, 0xd0, 0xff, 0x7f, 0x9f, 0xd0, 0xff, 0x8e, 0xaf, 0xdc, 0xff, 0x93, 0xb6, 0xe2, 0xff, 0x8a, 0xac, 0xdb, 0xff, 0x8f, 0xae, 0xde, 0xff, 0x9f, 0xbb, 0xea, 0xff, 0xa9, 0xc5, 0xf1, 0xff, 0xab, 0xc8, 0xf2, 0xff, 0xa8, 0xc8, 0xf3, 0xff, 0xa7, 0xc6, 0xf3, 0xff, 0xa2, 0xc2, 0xed, 0xff, 0xa4, 0xc6, 0xf4, 0xff, 0xaa, 0xd4, 0xff, 0xff, 0x2d, 0x3e, 0x53, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2a, 0x31, 0x3d, 0xff, 0x7d, 0x8c, 0x9d, 0xff, 0xaa, 0xb6, 0xc0, 0xff, 0xb7, 0xc0, 0xc4, 0xff, 0xc6, 0xcd, 0xd1, 0xff, 0xb3, 0xb8, 0xbb, 0xff, 0x9e, 0xa3, 0xa6, 0xff, 0x8c, 0x90, 0x93, 0xff, 0x78, 0x7f, 0x80, 0xff, 0xbd, 0xc4, 0xca, 0xff, 0xc4, 0xc9, 0xcc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xba, 0xbc, 0xbd, 0xff, 0xbd, 0xbd, 0xbe, 0xff, 0xbb, 0xbd, 0xbe, 0xff, 0xb7, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb8, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb6, 0xbc, 0xba, 0xff, 0xb6, 0xba, 0xb9, 0xff, 0xb5, 0xba, 0xba, 0xff, 0xb5, 0xb9, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xba, 0xb8, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb4, 0xb7, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb2, 0xb8, 0xb6, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb5, 0xb6, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xba, 0xba, 0xba, 0x1a, 0xbb, 0xbd, 0xbd, 0xff, 0xba, 0xbc, 0xbd, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xb9, 0xbb, 0xbb, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc0, 0xff, 0xc0, 0xc2, 0xc1, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xbf, 0xc1, 0xc3, 0xff, 0xc1, 0xc2, 0xc4, 0xff, 0xbf, 0xc3, 0xc4, 0xff, 0xc0, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc4, 0xc5, 0xff, 0xc0, 0xc4, 0xc5, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc3, 0xc5, 0xc6, 0xff, 0xc3, 0xc5, 0xc6, 0xff, 0xc4, 0xc6, 0xc6, 0xff, 0xc5, 0xc7, 0xc8, 0xff, 0xc4, 0xc7, 0xc9, 0xff, 0xc6, 0xc9, 0xc9, 0xff, 0xc8, 0xc9, 0xca, 0xff, 0xc8, 0xca, 0xcb, 0xff, 0xd1, 0xd5, 0xd6, 0xff, 0xaa, 0xae, 0xb0, 0xff, 0x6c, 0x71, 0x73, 0xff, 0x5d, 0x60, 0x63, 0xff, 0x94, 0x99, 0x9c, 0xff, 0xb0, 0xb4, 0xb8, 0xff, 0x9e, 0xa4, 0xa9, 0xff, 0x8a, 0x92, 0x98, 0xff, 0x71, 0x76, 0x7b, 0xff, 0x68, 0x6d, 0x70, 0xff, 0x4b, 0x50, 0x53, 0xff, 0x0c, 0x0e, 0x0d, 0xff, 0x03, 0x02, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x18, 0x2e, 0x4a, 0xff, 0x49, 0x6f, 0xa3, 0xff, 0x64, 0x8b, 0xc1, 0xff, 0x6b, 0x91, 0xc7, 0xff, 0x6d, 0x93, 0xc7, 0xff, 0x6b, 0x90, 0xc5, 0xff, 0x6e, 0x92, 0xc4, 0xff, 0x7c, 0x9d, 0xce, 0xff, 0x86, 0xa6, 0xd6, 0xff, 0x8f, 0xad, 0xdc, 0xff, 0x93, 0xb1, 0xdf, 0xff, 0x9c, 0xb9, 0xe5, 0xff, 0xa2, 0xbd, 0xe9, 0xff, 0xa1, 0xbb, 0xea, 0xff, 0xa3, 0xbd, 0xeb, 0xff, 0xa7, 0xc1, 0xeb, 0xff, 0xaa, 0xc3, 0xef, 0xff, 0xab, 0xc6, 0xf2, 0xff, 0xa3, 0xc3, 0xef, 0xff, 0xa0, 0xc1, 0xf0, 0xff, 0xa2, 0xc4, 0xf0, 0xff, 0xb6, 0xdf, 0xff, 0xff, 0x59, 0x76, 0x9e, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x36, 0x3d, 0x4f, 0xff, 0x83, 0x94, 0xa2, 0xff, 0xb0, 0xba, 0xc3, 0xff, 0xba, 0xc2, 0xc5, 0xff, 0xbe, 0xc7, 0xcc, 0xff, 0xbb, 0xc1, 0xc5, 0xff, 0x9c, 0x9f, 0xa3, 0xff, 0x9a, 0x9c, 0x9f, 0xff, 0x73, 0x78, 0x78, 0xff, 0xb0, 0xb7, 0xbd, 0xff, 0xc7, 0xcd, 0xd1, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xba, 0xbd, 0xbe, 0xff, 0xba, 0xbd, 0xbe, 0xff, 0xba, 0xbd, 0xbe, 0xff, 0xb9, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb7, 0xbc, 0xbd, 0xff, 0xb8, 0xbb, 0xbd, 0xff, 0xb7, 0xbb, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb7, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xba, 0xbb, 0xff, 0xb5, 0xba, 0xbb, 0xff, 0xb4, 0xb8, 0xba, 0xff, 0xb5, 0xba, 0xba, 0xff, 0xb6, 0xbb, 0xba, 0xff, 0xb6, 0xbb, 0xbb, 0xff, 0xb6, 0xba, 0xba, 0xff, 0xb5, 0xb8, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb3, 0xb3, 0xb3, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xbc, 0xbf, 0xbf, 0x58, 0xba, 0xbc, 0xbc, 0xff, 0xb9, 0xbb, 0xbb, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbe, 0xc0, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc1, 0xc2, 0xc3, 0xff, 0xbf, 0xc2, 0xc3, 0xff, 0xbf, 0xc2, 0xc3, 0xff, 0xc2, 0xc3, 0xc4, 0xff, 0xc1, 0xc4, 0xc5, 0xff, 0xc0, 0xc4, 0xc5, 0xff, 0xc3, 0xc5, 0xc6, 0xff, 0xc3, 0xc5, 0xc6, 0xff, 0xc2, 0xc5, 0xc5, 0xff, 0xc4, 0xc6, 0xc5, 0xff, 0xc5, 0xc7, 0xc8, 0xff, 0xc4, 0xc7, 0xc8, 0xff, 0xc5, 0xc9, 0xc9, 0xff, 0xc8, 0xca, 0xcb, 0xff, 0xca, 0xcb, 0xcc, 0xff, 0xd2, 0xd5, 0xd6, 0xff, 0xa1, 0xa6, 0xa7, 0xff, 0x6d, 0x72, 0x72, 0xff, 0x64, 0x69, 0x69, 0xff, 0x8f, 0x95, 0x99, 0xff, 0xa6, 0xab, 0xb0, 0xff, 0xa6, 0xaa, 0xae, 0xff, 0xa2, 0xa7, 0xac, 0xff, 0x75, 0x79, 0x7c, 0xff, 0x5b, 0x60, 0x62, 0xff, 0x56, 0x5c, 0x60, 0xff, 0x20, 0x25, 0x25, 0xff, 0x00, 0x01, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x0e, 0x20, 0x35, 0xff, 0x2d, 0x53, 0x86, 0xff, 0x4c, 0x6e, 0x9f, 0xff, 0x6a, 0x90, 0xc6, 0xff, 0x67, 0x8d, 0xc0, 0xff, 0x60, 0x84, 0xb7, 0xff, 0x61, 0x86, 0xba, 0xff, 0x69, 0x8c, 0xc0, 0xff, 0x74, 0x96, 0xc8, 0xff, 0x7e, 0x9e, 0xd2, 0xff, 0x89, 0xa7, 0xda, 0xff, 0x9e, 0xb9, 0xe6, 0xff, 0xad, 0xc4, 0xef, 0xff, 0xaf, 0xc6, 0xf1, 0xff, 0xb6, 0xcb, 0xf6, 0xff, 0xb6, 0xcc, 0xf5, 0xff, 0xad, 0xc4, 0xf1, 0xff, 0xa6, 0xc2, 0xf0, 0xff, 0xa4, 0xc3, 0xf0, 0xff, 0xa4, 0xc8, 0xf3, 0xff, 0xa0, 0xc6, 0xf9, 0xff, 0x5c, 0x7c, 0xaa, 0xff, 0x00, 0x03, 0x06, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2d, 0x37, 0x45, 0xff, 0x81, 0x93, 0xa2, 0xff, 0xba, 0xc5, 0xcb, 0xff, 0xbe, 0xc6, 0xc8, 0xff, 0xbf, 0xc8, 0xcc, 0xff, 0xbc, 0xc1, 0xc5, 0xff, 0x97, 0x9b, 0x9c, 0xff, 0x9d, 0xa2, 0xa4, 0xff, 0x81, 0x87, 0x8a, 0xff, 0xa3, 0xaa, 0xb0, 0xff, 0xc7, 0xcc, 0xcd, 0xff, 0xb7, 0xbb, 0xbb, 0xff, 0xb9, 0xbe, 0xbf, 0xff, 0xb8, 0xbd, 0xbe, 0xff, 0xb9, 0xbc, 0xbd, 0xff, 0xba, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb9, 0xba, 0xff, 0xb5, 0xba, 0xbb, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xba, 0xba, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xbb, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb4, 0xba, 0xb8, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb0, 0xb6, 0xb6, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xbb, 0xbd, 0xbd, 0x90, 0xba, 0xbc, 0xbc, 0xff, 0xb8, 0xba, 0xba, 0xff, 0xb9, 0xbb, 0xbb, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc4, 0xc5, 0xff, 0xc1, 0xc4, 0xc5, 0xff, 0xc3, 0xc4, 0xc5, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc3, 0xc5, 0xc6, 0xff, 0xc4, 0xc6, 0xc7, 0xff, 0xc5, 0xc7, 0xc8, 0xff, 0xc3, 0xc7, 0xc7, 0xff, 0xc4, 0xc9, 0xc9, 0xff, 0xc6, 0xca, 0xcb, 0xff, 0xc8, 0xcb, 0xcc, 0xff, 0xd0, 0xd3, 0xd4, 0xff, 0x9a, 0x9f, 0xa0, 0xff, 0x6f, 0x73, 0x74, 0xff, 0x68, 0x6e, 0x71, 0xff, 0x7e, 0x86, 0x8a, 0xff, 0x9e, 0xa4, 0xa7, 0xff, 0xab, 0xb0, 0xb3, 0xff, 0xa2, 0xa7, 0xaa, 0xff, 0x89, 0x8c, 0x90, 0xff, 0x60, 0x64, 0x68, 0xff, 0x57, 0x5d, 0x60, 0xff, 0x32, 0x36, 0x3a, 0xff, 0x02, 0x02, 0x03, 0xff, 0x00, 0x00, 0x00, 0xff, 0x12, 0x1f, 0x30, 0xff, 0x36, 0x5e, 0x94, 0xff, 0x2c, 0x4e, 0x7c, 0xff, 0x45, 0x67, 0x97, 0xff, 0x64, 0x86, 0xb8, 0xff, 0x63, 0x85, 0xb6, 0xff, 0x58, 0x7b, 0xad, 0xff, 0x5a, 0x7c, 0xb1, 0xff, 0x65, 0x86, 0xbc, 0xff, 0x68, 0x89, 0xc0, 0xff, 0x79, 0x98, 0xd0, 0xff, 0x95, 0xaf, 0xe2, 0xff, 0xaf, 0xc4, 0xf1, 0xff, 0xad, 0xc5, 0xf0, 0xff, 0xab, 0xc3, 0xf0, 0xff, 0xb6, 0xcc, 0xfa, 0xff, 0xac, 0xc5, 0xf3, 0xff, 0xa8, 0xc8, 0xf4, 0xff, 0xa7, 0xc8, 0xf4, 0xff, 0x82, 0xa5, 0xd2, 0xff, 0x44, 0x6d, 0xa4, 0xff, 0x0e, 0x29, 0x4c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x37, 0x42, 0x4f, 0xff, 0x7d, 0x8d, 0x9d, 0xff, 0xb7, 0xc1, 0xc7, 0xff, 0xb8, 0xc2, 0xc6, 0xff, 0xc1, 0xca, 0xd0, 0xff, 0xb4, 0xbb, 0xbe, 0xff, 0x8d, 0x91, 0x93, 0xff, 0x9e, 0xa2, 0xa4, 0xff, 0x80, 0x85, 0x88, 0xff, 0x93, 0x9b, 0x9f, 0xff, 0xc4, 0xcd, 0xd0, 0xff, 0xbb, 0xbe, 0xbf, 0xff, 0xba, 0xbd, 0xbe, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb7, 0xbc, 0xbc, 0xff, 0xb7, 0xbc, 0xbc, 0xff, 0xb7, 0xbc, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xbb, 0xba, 0xff, 0xb5, 0xba, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xba, 0xba, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xbb, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb6, 0xbb, 0xba, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xbb, 0xba, 0xff, 0xb6, 0xbb, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb7, 0xb8, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb6, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xba, 0xbd, 0xbe, 0xc6, 0xbb, 0xbd, 0xbe, 0xff, 0xb9, 0xbb, 0xbb, 0xff, 0xb8, 0xba, 0xba, 0xff, 0xb9, 0xbb, 0xbb, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc1, 0xc3, 0xc3, 0xff, 0xbf, 0xc3, 0xc3, 0xff, 0xc0, 0xc3, 0xc4, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc4, 0xc6, 0xc7, 0xff, 0xc5, 0xc6, 0xc7, 0xff, 0xc4, 0xc7, 0xc8, 0xff, 0xc3, 0xc8, 0xc8, 0xff, 0xc5, 0xca, 0xc9, 0xff, 0xc5, 0xca, 0xcc, 0xff, 0xc7, 0xca, 0xcb, 0xff, 0xd2, 0xd5, 0xd6, 0xff, 0x8f, 0x94, 0x95, 0xff, 0x6f, 0x74, 0x76, 0xff, 0x72, 0x77, 0x7a, 0xff, 0x74, 0x7a, 0x7c, 0xff, 0x9c, 0xa3, 0xa5, 0xff, 0xa5, 0xac, 0xae, 0xff, 0xa6, 0xab, 0xb0, 0xff, 0x95, 0x9a, 0x9f, 0xff, 0x73, 0x79, 0x7e, 0xff, 0x52, 0x5a, 0x60, 0xff, 0x3e, 0x41, 0x47, 0xff, 0x0e, 0x10, 0x11, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0b, 0x11, 0x16, 0xff, 0x42, 0x69, 0x97, 0xff, 0x3e, 0x64, 0x9b, 0xff, 0x26, 0x46, 0x76, 0xff, 0x37, 0x58, 0x83, 0xff, 0x52, 0x72, 0xa2, 0xff, 0x55, 0x75, 0xa6, 0xff, 0x5c, 0x7b, 0xac, 0xff, 0x64, 0x84, 0xb7, 0xff, 0x65, 0x86, 0xba, 0xff, 0x6f, 0x8f, 0xc5, 0xff, 0x84, 0xa1, 0xd8, 0xff, 0x9d, 0xb6, 0xe9, 0xff, 0xa1, 0xbb, 0xed, 0xff, 0x9e, 0xb9, 0xeb, 0xff, 0xac, 0xc4, 0xf4, 0xff, 0xab, 0xc8, 0xf6, 0xff, 0x98, 0xbb, 0xe8, 0xff, 0x73, 0x99, 0xc7, 0xff, 0x3c, 0x64, 0x96, 0xff, 0x32, 0x5e, 0x96, 0xff, 0x2b, 0x49, 0x6f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x44, 0x51, 0x60, 0xff, 0x84, 0x94, 0xa5, 0xff, 0xb4, 0xbd, 0xc4, 0xff, 0xb8, 0xc1, 0xc5, 0xff, 0xbd, 0xc6, 0xcb, 0xff, 0xae, 0xb4, 0xb8, 0xff, 0x8d, 0x92, 0x95, 0xff, 0x98, 0x9c, 0x9e, 0xff, 0x99, 0x9d, 0x9e, 0xff, 0x7f, 0x87, 0x8d, 0xff, 0xba, 0xc3, 0xca, 0xff, 0xc5, 0xc9, 0xcb, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb9, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb6, 0xb9, 0xbb, 0xff, 0xb6, 0xba, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xbb, 0xff, 0xb5, 0xba, 0xba, 0xff, 0xb6, 0xb9, 0xb9, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb6, 0xbb, 0xbc, 0xff, 0xb5, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xbb, 0xb9, 0xff, 0xb6, 0xbb, 0xba, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xba, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xba, 0xba, 0xff, 0xb4, 0xba, 0xb8, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb2, 0xb4, 0xb5, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb3, 0xb6, 0xb7, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x01, 0xbb, 0xbd, 0xbe, 0xf2, 0xbb, 0xbd, 0xbd, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xb9, 0xbb, 0xbb, 0xff, 0xb9, 0xbb, 0xbb, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc1, 0xc3, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc1, 0xc2, 0xc2, 0xff, 0xbf, 0xc3, 0xc2, 0xff, 0xbf, 0xc3, 0xc3, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc3, 0xc5, 0xc6, 0xff, 0xc5, 0xc7, 0xc8, 0xff, 0xc5, 0xc7, 0xc8, 0xff, 0xc2, 0xc7, 0xc7, 0xff, 0xc4, 0xc8, 0xc8, 0xff, 0xc5, 0xc9, 0xca, 0xff, 0xc7, 0xca, 0xcb, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0x84, 0x89, 0x89, 0xff, 0x6e, 0x73, 0x75, 0xff, 0x74, 0x79, 0x7b, 0xff, 0x74, 0x77, 0x77, 0xff, 0x9f, 0xa4, 0xa7, 0xff, 0x8b, 0x92, 0x97, 0xff, 0xa2, 0xa8, 0xae, 0xff, 0x97, 0x9d, 0xa2, 0xff, 0x77, 0x7d, 0x81, 0xff, 0x5b, 0x63, 0x6b, 0xff, 0x47, 0x50, 0x55, 0xff, 0x1b, 0x1e, 0x1f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x03, 0x03, 0x05, 0xff, 0x3b, 0x5e, 0x87, 0xff, 0x54, 0x80, 0xb6, 0xff, 0x40, 0x69, 0x9c, 0xff, 0x2e, 0x50, 0x82, 0xff, 0x37, 0x57, 0x89, 0xff, 0x47, 0x66, 0x95, 0xff, 0x4b, 0x6c, 0x99, 0xff, 0x53, 0x74, 0xa3, 0xff, 0x5e, 0x7f, 0xaf, 0xff, 0x69, 0x89, 0xbc, 0xff, 0x74, 0x92, 0xc7, 0xff, 0x83, 0xa2, 0xd5, 0xff, 0x8a, 0xa8, 0xdb, 0xff, 0x8d, 0xab, 0xdc, 0xff, 0x89, 0xa7, 0xd7, 0xff, 0x7d, 0xa0, 0xd0, 0xff, 0x6e, 0x96, 0xc6, 0xff, 0x58, 0x81, 0xb1, 0xff, 0x55, 0x80, 0xb1, 0xff, 0x60, 0x8e, 0xc7, 0xff, 0x33, 0x51, 0x7a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0xff, 0x43, 0x50, 0x61, 0xff, 0x8b, 0x98, 0xaa, 0xff, 0xaa, 0xb2, 0xb7, 0xff, 0xb5, 0xbd, 0xc0, 0xff, 0xc0, 0xc8, 0xcc, 0xff, 0xa9, 0xaf, 0xb4, 0xff, 0x97, 0x9b, 0x9f, 0xff, 0x97, 0x9c, 0x9d, 0xff, 0xa6, 0xab, 0xab, 0xff, 0x78, 0x7d, 0x80, 0xff, 0xab, 0xb2, 0xb6, 0xff, 0xc8, 0xce, 0xd2, 0xff, 0xb9, 0xbd, 0xbe, 0xff, 0xba, 0xbe, 0xbf, 0xff, 0xb9, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb8, 0xb9, 0xba, 0xff, 0xb8, 0xba, 0xba, 0xff, 0xb6, 0xb9, 0xbd, 0xff, 0xb5, 0xb9, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb7, 0xb9, 0xb9, 0xff, 0xb6, 0xb9, 0xbb, 0xff, 0xb5, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb8, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xbb, 0xb9, 0xff, 0xb6, 0xbb, 0xb9, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb8, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb5, 0xba, 0xb8, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb3, 0xb7, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb6, 0xb7, 0xf2, 0xff, 0xff, 0xff, 0x01,
+    0xb9, 0xb9, 0xb9, 0x21, 0xbc, 0xbe, 0xbe, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xba, 0xbc, 0xbd, 0xff, 0xbb, 0xbd, 0xbe, 0xff, 0xbb, 0xbd, 0xbe, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc1, 0xc3, 0xc3, 0xff, 0xc1, 0xc3, 0xc3, 0xff, 0xc1, 0xc3, 0xc3, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc1, 0xc3, 0xc2, 0xff, 0xc0, 0xc3, 0xc3, 0xff, 0xc0, 0xc4, 0xc5, 0xff, 0xc1, 0xc4, 0xc5, 0xff, 0xc2, 0xc6, 0xc7, 0xff, 0xc5, 0xc7, 0xc8, 0xff, 0xc5, 0xc7, 0xc8, 0xff, 0xc5, 0xc7, 0xc8, 0xff, 0xc5, 0xc7, 0xc7, 0xff, 0xc5, 0xc8, 0xc8, 0xff, 0xc7, 0xca, 0xcb, 0xff, 0xce, 0xd2, 0xd3, 0xff, 0x7c, 0x81, 0x82, 0xff, 0x66, 0x6b, 0x6d, 0xff, 0x6f, 0x74, 0x76, 0xff, 0x74, 0x79, 0x7a, 0xff, 0x98, 0x9f, 0xa2, 0xff, 0x88, 0x8d, 0x94, 0xff, 0x8f, 0x95, 0x9a, 0xff, 0x95, 0x9b, 0xa0, 0xff, 0x81, 0x86, 0x8e, 0xff, 0x5f, 0x66, 0x6d, 0xff, 0x51, 0x5b, 0x5f, 0xff, 0x2a, 0x2e, 0x30, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2b, 0x47, 0x6a, 0xff, 0x5f, 0x8f, 0xc4, 0xff, 0x5a, 0x85, 0xb7, 0xff, 0x4b, 0x72, 0xa6, 0xff, 0x3b, 0x5f, 0x91, 0xff, 0x42, 0x64, 0x95, 0xff, 0x43, 0x67, 0x96, 0xff, 0x40, 0x62, 0x92, 0xff, 0x44, 0x66, 0x97, 0xff, 0x4e, 0x72, 0xa5, 0xff, 0x56, 0x7b, 0xac, 0xff, 0x59, 0x80, 0xb1, 0xff, 0x59, 0x82, 0xb4, 0xff, 0x5f, 0x88, 0xba, 0xff, 0x70, 0x98, 0xc9, 0xff, 0x7b, 0xa1, 0xd2, 0xff, 0x7c, 0xa5, 0xd5, 0xff, 0x6f, 0x9a, 0xcb, 0xff, 0x76, 0x9e, 0xd0, 0xff, 0x6b, 0x98, 0xd0, 0xff, 0x3c, 0x59, 0x80, 0xff, 0x0a, 0x03, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x43, 0x4e, 0x5e, 0xff, 0x95, 0xa2, 0xb0, 0xff, 0xaa, 0xb1, 0xb5, 0xff, 0xb5, 0xbb, 0xbe, 0xff, 0xc2, 0xca, 0xce, 0xff, 0xa9, 0xb0, 0xb5, 0xff, 0x99, 0x9e, 0xa1, 0xff, 0x95, 0x9a, 0x9d, 0xff, 0x90, 0x95, 0x98, 0xff, 0x80, 0x85, 0x88, 0xff, 0xa5, 0xad, 0xb1, 0xff, 0xc5, 0xcc, 0xd0, 0xff, 0xba, 0xbe, 0xbf, 0xff, 0xba, 0xbe, 0xbe, 0xff, 0xb9, 0xbd, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb8, 0xba, 0xbb, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb5, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb8, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xb9, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb3, 0xb9, 0xb9, 0xff, 0xb4, 0xb9, 0xba, 0xff, 0xb6, 0xba, 0xb9, 0xff, 0xb6, 0xbb, 0xba, 0xff, 0xb6, 0xbb, 0xba, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xb2, 0xb6, 0xb8, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb1, 0xb9, 0xb9, 0x21,
+    0xbe, 0xbe, 0xbe, 0x4b, 0xbc, 0xbe, 0xbe, 0xff, 0xbb, 0xbd, 0xbe, 0xff, 0xb9, 0xbb, 0xbc, 0xff, 0xba, 0xbc, 0xbd, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xbf, 0xc2, 0xc3, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc1, 0xc3, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc4, 0xc6, 0xc7, 0xff, 0xc5, 0xc7, 0xc8, 0xff, 0xc5, 0xc7, 0xc8, 0xff, 0xc6, 0xc8, 0xc9, 0xff, 0xc6, 0xc8, 0xc8, 0xff, 0xc6, 0xc8, 0xc8, 0xff, 0xc9, 0xce, 0xcf, 0xff, 0xc4, 0xc8, 0xc9, 0xff, 0x75, 0x7a, 0x7b, 0xff, 0x65, 0x6b, 0x6f, 0xff, 0x72, 0x76, 0x7a, 0xff, 0x74, 0x79, 0x7d, 0xff, 0x8f, 0x98, 0x9c, 0xff, 0x8d, 0x94, 0x97, 0xff, 0x7d, 0x84, 0x87, 0xff, 0x98, 0xa0, 0xa4, 0xff, 0x95, 0x9c, 0xa4, 0xff, 0x6c, 0x75, 0x7d, 0xff, 0x4d, 0x56, 0x5d, 0xff, 0x31, 0x35, 0x3a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2a, 0x3f, 0x58, 0xff, 0x61, 0x92, 0xc9, 0xff, 0x69, 0x93, 0xc3, 0xff, 0x63, 0x8c, 0xbd, 0xff, 0x4f, 0x76, 0xa8, 0xff, 0x3f, 0x65, 0x97, 0xff, 0x48, 0x6d, 0x9f, 0xff, 0x4e, 0x74, 0xa5, 0xff, 0x4c, 0x72, 0xa3, 0xff, 0x55, 0x7b, 0xad, 0xff, 0x61, 0x8b, 0xbc, 0xff, 0x6d, 0x96, 0xc7, 0xff, 0x71, 0x99, 0xca, 0xff, 0x7f, 0xa7, 0xd6, 0xff, 0x93, 0xb8, 0xe7, 0xff, 0x95, 0xb8, 0xe7, 0xff, 0x85, 0xac, 0xdc, 0xff, 0x82, 0xac, 0xda, 0xff, 0x85, 0xad, 0xdb, 0xff, 0x6c, 0x99, 0xd1, 0xff, 0x46, 0x61, 0x89, 0xff, 0x27, 0x1c, 0x13, 0xff, 0x3d, 0x32, 0x30, 0xff, 0x28, 0x21, 0x20, 0xff, 0x3a, 0x46, 0x55, 0xff, 0x8c, 0x9a, 0xab, 0xff, 0xab, 0xb4, 0xb9, 0xff, 0xb6, 0xbe, 0xc4, 0xff, 0xba, 0xc3, 0xc7, 0xff, 0xa8, 0xaf, 0xb3, 0xff, 0x97, 0x9c, 0x9e, 0xff, 0x94, 0x98, 0x9d, 0xff, 0x91, 0x95, 0x9a, 0xff, 0x84, 0x8a, 0x8c, 0xff, 0x94, 0x9c, 0xa0, 0xff, 0xc0, 0xc6, 0xc7, 0xff, 0xbc, 0xbf, 0xbf, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb8, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb8, 0xba, 0xba, 0xff, 0xb6, 0xba, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb7, 0xb8, 0xba, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb4, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb6, 0xbb, 0xba, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb6, 0xbb, 0xba, 0xff, 0xb6, 0xbb, 0xba, 0xff, 0xb6, 0xbb, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb0, 0xb7, 0xb7, 0x4b,
+    0xbc, 0xbe, 0xbe, 0x6b, 0xbd, 0xbf, 0xbf, 0xff, 0xbb, 0xbd, 0xbe, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xba, 0xbc, 0xbd, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc3, 0xff, 0xc0, 0xc2, 0xc4, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc3, 0xc5, 0xc6, 0xff, 0xc4, 0xc6, 0xc7, 0xff, 0xc5, 0xc7, 0xc8, 0xff, 0xc5, 0xc7, 0xc8, 0xff, 0xc6, 0xc8, 0xc9, 0xff, 0xc7, 0xc9, 0xca, 0xff, 0xcb, 0xcf, 0xd1, 0xff, 0xbe, 0xc2, 0xc3, 0xff, 0x6c, 0x73, 0x75, 0xff, 0x6a, 0x72, 0x76, 0xff, 0x6f, 0x73, 0x76, 0xff, 0x6c, 0x71, 0x73, 0xff, 0x8a, 0x91, 0x94, 0xff, 0x93, 0x99, 0x9d, 0xff, 0x7b, 0x83, 0x87, 0xff, 0x8a, 0x92, 0x98, 0xff, 0x9e, 0xa5, 0xad, 0xff, 0x71, 0x7d, 0x87, 0xff, 0x54, 0x5f, 0x66, 0xff, 0x28, 0x2c, 0x2f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x4e, 0x40, 0x37, 0xff, 0x4f, 0x5e, 0x71, 0xff, 0x50, 0x7f, 0xb6, 0xff, 0x6e, 0x96, 0xc4, 0xff, 0x6f, 0x97, 0xc6, 0xff, 0x61, 0x8b, 0xbb, 0xff, 0x49, 0x72, 0xa3, 0xff, 0x4a, 0x70, 0xa3, 0xff, 0x56, 0x7f, 0xb0, 0xff, 0x65, 0x8d, 0xbe, 0xff, 0x73, 0x99, 0xca, 0xff, 0x82, 0xa9, 0xd8, 0xff, 0x93, 0xb6, 0xe5, 0xff, 0x97, 0xb9, 0xe7, 0xff, 0x98, 0xbc, 0xe8, 0xff, 0x9b, 0xbd, 0xe9, 0xff, 0x94, 0xb8, 0xe4, 0xff, 0x92, 0xb7, 0xe3, 0xff, 0x94, 0xb9, 0xe6, 0xff, 0x8b, 0xb1, 0xde, 0xff, 0x6e, 0x9c, 0xd4, 0xff, 0x4a, 0x67, 0x8f, 0xff, 0x3a, 0x2e, 0x23, 0xff, 0x59, 0x4e, 0x48, 0xff, 0x76, 0x6f, 0x6f, 0xff, 0x37, 0x42, 0x4c, 0xff, 0x86, 0x94, 0xa2, 0xff, 0xa7, 0xb0, 0xb5, 0xff, 0xb2, 0xba, 0xc0, 0xff, 0xb6, 0xc0, 0xc7, 0xff, 0xaa, 0xb2, 0xb8, 0xff, 0x90, 0x96, 0x99, 0xff, 0x9a, 0x9f, 0xa4, 0xff, 0x97, 0x9a, 0x9e, 0xff, 0x7d, 0x82, 0x86, 0xff, 0x7a, 0x82, 0x88, 0xff, 0xbb, 0xc2, 0xc5, 0xff, 0xbf, 0xc2, 0xc3, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb8, 0xbd, 0xbe, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb6, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb6, 0xb8, 0xba, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb8, 0xba, 0xbb, 0xff, 0xb6, 0xbb, 0xba, 0xff, 0xb6, 0xbb, 0xba, 0xff, 0xb6, 0xba, 0xba, 0xff, 0xb6, 0xba, 0xbc, 0xff, 0xb6, 0xbb, 0xba, 0xff, 0xb6, 0xbb, 0xb9, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb4, 0xb7, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb2, 0xb5, 0xb7, 0x6b,
+    0xbc, 0xbe, 0xbe, 0x8b, 0xbd, 0xbf, 0xbf, 0xff, 0xbb, 0xbd, 0xbe, 0xff, 0xbb, 0xbd, 0xbe, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc2, 0xc4, 0xc6, 0xff, 0xc3, 0xc5, 0xc6, 0xff, 0xc4, 0xc6, 0xc7, 0xff, 0xc4, 0xc6, 0xc7, 0xff, 0xc5, 0xc7, 0xc8, 0xff, 0xc6, 0xc8, 0xc9, 0xff, 0xc8, 0xca, 0xcb, 0xff, 0xcd, 0xcf, 0xd0, 0xff, 0xb8, 0xbb, 0xbc, 0xff, 0x6c, 0x74, 0x78, 0xff, 0x70, 0x79, 0x7f, 0xff, 0x71, 0x76, 0x78, 0xff, 0x60, 0x66, 0x66, 0xff, 0x82, 0x8a, 0x8e, 0xff, 0x95, 0x9c, 0xa1, 0xff, 0x76, 0x7e, 0x80, 0xff, 0x7a, 0x81, 0x86, 0xff, 0x93, 0x9b, 0xa0, 0xff, 0x78, 0x83, 0x8b, 0xff, 0x54, 0x61, 0x68, 0xff, 0x18, 0x1d, 0x22, 0xff, 0x33, 0x2a, 0x29, 0xff, 0xc1, 0xb0, 0xa7, 0xff, 0x40, 0x4f, 0x64, 0xff, 0x50, 0x7d, 0xb3, 0xff, 0x6a, 0x92, 0xc3, 0xff, 0x72, 0x9b, 0xcb, 0xff, 0x6e, 0x97, 0xc7, 0xff, 0x59, 0x81, 0xb2, 0xff, 0x52, 0x7a, 0xab, 0xff, 0x5c, 0x84, 0xb6, 0xff, 0x6e, 0x96, 0xc6, 0xff, 0x82, 0xa7, 0xd6, 0xff, 0x92, 0xb5, 0xe3, 0xff, 0x9b, 0xbc, 0xe8, 0xff, 0xa0, 0xc0, 0xee, 0xff, 0xa0, 0xc3, 0xef, 0xff, 0x9c, 0xbe, 0xeb, 0xff, 0x9a, 0xbd, 0xe9, 0xff, 0x9f, 0xc2, 0xee, 0xff, 0x9e, 0xc0, 0xed, 0xff, 0x8e, 0xb1, 0xdf, 0xff, 0x73, 0xa1, 0xd6, 0xff, 0x4f, 0x6f, 0x97, 0xff, 0x3f, 0x2e, 0x21, 0xff, 0x75, 0x6c, 0x63, 0xff, 0xb5, 0xb0, 0xb1, 0xff, 0x44, 0x4c, 0x53, 0xff, 0x80, 0x8d, 0x9b, 0xff, 0xa4, 0xad, 0xb3, 0xff, 0xae, 0xb5, 0xb8, 0xff, 0xaa, 0xb2, 0xb8, 0xff, 0xb0, 0xb8, 0xc0, 0xff, 0x87, 0x8e, 0x93, 0xff, 0x90, 0x96, 0x9a, 0xff, 0x90, 0x94, 0x96, 0xff, 0x89, 0x8d, 0x91, 0xff, 0x7b, 0x82, 0x87, 0xff, 0xa9, 0xb1, 0xb6, 0xff, 0xbd, 0xc0, 0xc5, 0xff, 0xb9, 0xbc, 0xbd, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xbb, 0xbc, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb8, 0xbb, 0xbc, 0xff, 0xb8, 0xbb, 0xbc, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb9, 0xba, 0xff, 0xb4, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xb9, 0xff, 0xb4, 0xba, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xbb, 0xff, 0xb6, 0xbb, 0xbb, 0xff, 0xb5, 0xbb, 0xb9, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb5, 0xb7, 0xb9, 0xff, 0xb5, 0xb5, 0xb7, 0x8b,
+    0xbb, 0xbe, 0xbe, 0xaa, 0xbc, 0xbe, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xbc, 0xbe, 0xbd, 0xff, 0xbc, 0xbe, 0xbd, 0xff, 0xbb, 0xbd, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc0, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc4, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc3, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc2, 0xc4, 0xc6, 0xff, 0xc4, 0xc6, 0xc7, 0xff, 0xc4, 0xc6, 0xc7, 0xff, 0xc4, 0xc6, 0xc7, 0xff, 0xc6, 0xc8, 0xc9, 0xff, 0xc7, 0xc9, 0xca, 0xff, 0xcd, 0xce, 0xcf, 0xff, 0xa9, 0xae, 0xaf, 0xff, 0x63, 0x6b, 0x6f, 0xff, 0x78, 0x80, 0x87, 0xff, 0x6e, 0x72, 0x74, 0xff, 0x57, 0x5d, 0x5d, 0xff, 0x7d, 0x86, 0x8e, 0xff, 0xa1, 0xa8, 0xae, 0xff, 0x7c, 0x82, 0x86, 0xff, 0x6f, 0x75, 0x78, 0xff, 0x80, 0x88, 0x8b, 0xff, 0x83, 0x8d, 0x92, 0xff, 0x4d, 0x59, 0x5d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x8c, 0x84, 0x80, 0xff, 0xdf, 0xd2, 0xcd, 0xff, 0x4a, 0x5e, 0x79, 0xff, 0x58, 0x83, 0xb8, 0xff, 0x6a, 0x93, 0xc3, 0xff, 0x74, 0x9d, 0xcb, 0xff, 0x78, 0x9f, 0xce, 0xff, 0x67, 0x8f, 0xc0, 0xff, 0x56, 0x7e, 0xaf, 0xff, 0x63, 0x8b, 0xbc, 0xff, 0x77, 0x9d, 0xcc, 0xff, 0x89, 0xac, 0xda, 0xff, 0x96, 0xb9, 0xe6, 0xff, 0xa2, 0xc3, 0xef, 0xff, 0xa9, 0xca, 0xf5, 0xff, 0xa7, 0xc8, 0xf3, 0xff, 0xa0, 0xc3, 0xed, 0xff, 0xa0, 0xc2, 0xed, 0xff, 0xa2, 0xc4, 0xef, 0xff, 0xa0, 0xc2, 0xed, 0xff, 0x92, 0xb4, 0xe2, 0xff, 0x7d, 0xa7, 0xdd, 0xff, 0x3f, 0x68, 0x93, 0xff, 0x2b, 0x26, 0x26, 0xff, 0xb4, 0xaa, 0xa8, 0xff, 0xce, 0xcb, 0xc7, 0xff, 0x64, 0x69, 0x6f, 0xff, 0x70, 0x7c, 0x8b, 0xff, 0xad, 0xb5, 0xb9, 0xff, 0xac, 0xb2, 0xb4, 0xff, 0xad, 0xb5, 0xb7, 0xff, 0xac, 0xb3, 0xb6, 0xff, 0x8d, 0x93, 0x98, 0xff, 0x8e, 0x93, 0x99, 0xff, 0x97, 0x9c, 0xa1, 0xff, 0x8d, 0x91, 0x97, 0xff, 0x89, 0x8f, 0x94, 0xff, 0x93, 0x9c, 0xa1, 0xff, 0xb7, 0xbc, 0xc1, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb8, 0xbc, 0xbc, 0xff, 0xb7, 0xbc, 0xbd, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb9, 0xba, 0xbb, 0xff, 0xb8, 0xb9, 0xba, 0xff, 0xb8, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb7, 0xb9, 0xb9, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb8, 0xb9, 0xba, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xb9, 0xff, 0xb5, 0xba, 0xba, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xba, 0xff, 0xb5, 0xbb, 0xb9, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb7, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xba, 0xba, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb5, 0xb9, 0xb8, 0xff, 0xb4, 0xb7, 0xb7, 0xab,
+    0xbd, 0xbe, 0xbe, 0xbe, 0xbd, 0xbf, 0xbf, 0xff, 0xbb, 0xbd, 0xbe, 0xff, 0xba, 0xbc, 0xbb, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbe, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc4, 0xff, 0xc1, 0xc3, 0xc3, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc4, 0xc5, 0xc6, 0xff, 0xc4, 0xc6, 0xc7, 0xff, 0xc4, 0xc6, 0xc7, 0xff, 0xc7, 0xc9, 0xca, 0xff, 0xcd, 0xcf, 0xd0, 0xff, 0x9d, 0xa2, 0xa2, 0xff, 0x59, 0x62, 0x65, 0xff, 0x78, 0x81, 0x89, 0xff, 0x6a, 0x70, 0x75, 0xff, 0x63, 0x68, 0x68, 0xff, 0x82, 0x8b, 0x8f, 0xff, 0x9b, 0xa1, 0xa7, 0xff, 0x7b, 0x81, 0x87, 0xff, 0x6c, 0x74, 0x76, 0xff, 0x71, 0x79, 0x7c, 0xff, 0x84, 0x8e, 0x94, 0xff, 0x41, 0x4c, 0x51, 0xff, 0x19, 0x1a, 0x18, 0xff, 0xd2, 0xca, 0xc3, 0xff, 0xec, 0xdf, 0xdd, 0xff, 0x61, 0x7a, 0x9d, 0xff, 0x5e, 0x88, 0xb9, 0xff, 0x71, 0x98, 0xc6, 0xff, 0x76, 0x9f, 0xcb, 0xff, 0x80, 0xa6, 0xd3, 0xff, 0x76, 0x9d, 0xcb, 0xff, 0x60, 0x86, 0xb6, 0xff, 0x67, 0x8d, 0xbe, 0xff, 0x7c, 0xa1, 0xcf, 0xff, 0x8c, 0xae, 0xdb, 0xff, 0x96, 0xb9, 0xe5, 0xff, 0xa2, 0xc5, 0xf0, 0xff, 0xac, 0xcd, 0xf4, 0xff, 0xa6, 0xc8, 0xef, 0xff, 0x9f, 0xc3, 0xea, 0xff, 0xa5, 0xc8, 0xf0, 0xff, 0xa7, 0xc9, 0xf1, 0xff, 0x9f, 0xc1, 0xeb, 0xff, 0x90, 0xb3, 0xe0, 0xff, 0x83, 0xac, 0xdf, 0xff, 0x28, 0x4f, 0x81, 0xff, 0x44, 0x4c, 0x60, 0xff, 0xf6, 0xea, 0xea, 0xff, 0xd3, 0xc8, 0xc2, 0xff, 0x83, 0x84, 0x88, 0xff, 0x71, 0x7d, 0x88, 0xff, 0xb4, 0xbc, 0xc2, 0xff, 0xb1, 0xb6, 0xba, 0xff, 0xa8, 0xb0, 0xb5, 0xff, 0xb0, 0xb8, 0xbb, 0xff, 0x97, 0x9d, 0xa1, 0xff, 0x83, 0x8a, 0x8f, 0xff, 0xa3, 0xa9, 0xad, 0xff, 0x7e, 0x85, 0x8a, 0xff, 0x8a, 0x91, 0x96, 0xff, 0x8e, 0x96, 0x9e, 0xff, 0xac, 0xb4, 0xb8, 0xff, 0xb7, 0xbb, 0xbb, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb9, 0xba, 0xff, 0xb7, 0xba, 0xbc, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb8, 0xb9, 0xba, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb8, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb7, 0xb9, 0xb9, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb4, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb8, 0xba, 0xbb, 0xff, 0xb9, 0xba, 0xbc, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb5, 0xbb, 0xba, 0xff, 0xb7, 0xba, 0xba, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xba, 0xb8, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb3, 0xb9, 0xb7, 0xbe,
+    0xbd, 0xc0, 0xc1, 0xd3, 0xbd, 0xbf, 0xc0, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc5, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc0, 0xc4, 0xc5, 0xff, 0xc0, 0xc5, 0xc6, 0xff, 0xc2, 0xc5, 0xc5, 0xff, 0xc3, 0xc5, 0xc6, 0xff, 0xc5, 0xc8, 0xc9, 0xff, 0xc8, 0xcc, 0xcc, 0xff, 0x95, 0x9a, 0x9c, 0xff, 0x5d, 0x66, 0x69, 0xff, 0x7b, 0x85, 0x8a, 0xff, 0x67, 0x6e, 0x74, 0xff, 0x63, 0x68, 0x6a, 0xff, 0x7f, 0x87, 0x8b, 0xff, 0x8b, 0x92, 0x95, 0xff, 0x73, 0x7a, 0x7e, 0xff, 0x68, 0x6e, 0x70, 0xff, 0x67, 0x6f, 0x73, 0xff, 0x74, 0x80, 0x89, 0xff, 0x39, 0x41, 0x44, 0xff, 0x6d, 0x69, 0x67, 0xff, 0xed, 0xe4, 0xe0, 0xff, 0xff, 0xfd, 0xf4, 0xff, 0x78, 0x92, 0xae, 0xff, 0x59, 0x83, 0xb6, 0xff, 0x7a, 0x9f, 0xca, 0xff, 0x79, 0xa0, 0xce, 0xff, 0x86, 0xa9, 0xd7, 0xff, 0x84, 0xa9, 0xd6, 0xff, 0x6d, 0x91, 0xc1, 0xff, 0x69, 0x8f, 0xbe, 0xff, 0x7b, 0xa0, 0xce, 0xff, 0x8c, 0xb0, 0xda, 0xff, 0x99, 0xbb, 0xe7, 0xff, 0x9f, 0xc1, 0xed, 0xff, 0xa3, 0xc6, 0xef, 0xff, 0xa0, 0xc3, 0xed, 0xff, 0xa0, 0xc4, 0xec, 0xff, 0xa7, 0xcb, 0xf1, 0xff, 0xac, 0xcc, 0xf4, 0xff, 0xa1, 0xc2, 0xec, 0xff, 0x89, 0xad, 0xda, 0xff, 0x77, 0xa2, 0xd6, 0xff, 0x22, 0x4a, 0x7c, 0xff, 0xa3, 0xa7, 0xb3, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe4, 0xd4, 0xcd, 0xff, 0xa1, 0x9e, 0xa3, 0xff, 0x7c, 0x86, 0x8f, 0xff, 0xab, 0xb2, 0xb9, 0xff, 0xb1, 0xb6, 0xbb, 0xff, 0xa1, 0xa8, 0xab, 0xff, 0xa9, 0xb2, 0xb7, 0xff, 0x9f, 0xa6, 0xab, 0xff, 0x7c, 0x82, 0x85, 0xff, 0x8a, 0x90, 0x94, 0xff, 0x91, 0x99, 0x9c, 0xff, 0x7d, 0x85, 0x8a, 0xff, 0x8f, 0x99, 0x9f, 0xff, 0xa2, 0xac, 0xb1, 0xff, 0xbc, 0xbf, 0xbe, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb6, 0xb9, 0xb9, 0xff, 0xb7, 0xb9, 0xb9, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb5, 0xb8, 0xba, 0xff, 0xb4, 0xb9, 0xba, 0xff, 0xb7, 0xb9, 0xb9, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb4, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb8, 0xb9, 0xba, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb9, 0xba, 0xbb, 0xff, 0xb8, 0xb9, 0xba, 0xff, 0xb8, 0xba, 0xba, 0xff, 0xb7, 0xba, 0xba, 0xff, 0xb8, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb7, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb7, 0xb8, 0xd3,
+    0xbc, 0xbe, 0xc1, 0xe7, 0xbd, 0xbf, 0xc0, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xc0, 0xff, 0xbf, 0xc1, 0xc3, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc1, 0xc3, 0xc3, 0xff, 0xc1, 0xc2, 0xc4, 0xff, 0xc1, 0xc3, 0xc3, 0xff, 0xc2, 0xc3, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc4, 0xc5, 0xc6, 0xff, 0xc2, 0xc6, 0xc8, 0xff, 0xc4, 0xc9, 0xc9, 0xff, 0x90, 0x95, 0x97, 0xff, 0x68, 0x70, 0x75, 0xff, 0x75, 0x7f, 0x83, 0xff, 0x6a, 0x72, 0x76, 0xff, 0x57, 0x5c, 0x61, 0xff, 0x79, 0x82, 0x87, 0xff, 0x92, 0x9a, 0x9d, 0xff, 0x6f, 0x76, 0x78, 0xff, 0x67, 0x6d, 0x70, 0xff, 0x5d, 0x69, 0x70, 0xff, 0x3b, 0x49, 0x4f, 0xff, 0x6d, 0x6b, 0x69, 0xff, 0xba, 0xb2, 0xb0, 0xff, 0xef, 0xe5, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa8, 0xb4, 0xc6, 0xff, 0x57, 0x7e, 0xb1, 0xff, 0x7e, 0xa4, 0xd0, 0xff, 0x76, 0x9c, 0xca, 0xff, 0x7f, 0xa6, 0xd1, 0xff, 0x8b, 0xb0, 0xdc, 0xff, 0x7c, 0x9f, 0xd0, 0xff, 0x71, 0x94, 0xc5, 0xff, 0x7c, 0xa0, 0xce, 0xff, 0x8c, 0xaf, 0xdb, 0xff, 0x99, 0xbb, 0xe8, 0xff, 0x9e, 0xbf, 0xed, 0xff, 0xa1, 0xc2, 0xed, 0xff, 0xa3, 0xc4, 0xed, 0xff, 0xa5, 0xc6, 0xee, 0xff, 0xa6, 0xc6, 0xf0, 0xff, 0xa9, 0xc8, 0xf1, 0xff, 0xa0, 0xc1, 0xec, 0xff, 0x8b, 0xb0, 0xe0, 0xff, 0x47, 0x75, 0xae, 0xff, 0x5e, 0x76, 0x9c, 0xff, 0xfb, 0xf0, 0xeb, 0xff, 0xfd, 0xf2, 0xe7, 0xff, 0xf8, 0xec, 0xe3, 0xff, 0xbd, 0xb7, 0xb5, 0xff, 0x8f, 0x93, 0x98, 0xff, 0xa8, 0xae, 0xb3, 0xff, 0xaf, 0xb6, 0xbc, 0xff, 0x9a, 0xa0, 0xa2, 0xff, 0x99, 0xa0, 0xa5, 0xff, 0x9c, 0xa4, 0xa9, 0xff, 0x88, 0x8f, 0x94, 0xff, 0x77, 0x80, 0x88, 0xff, 0x97, 0x9f, 0xa4, 0xff, 0x8d, 0x94, 0x99, 0xff, 0x87, 0x90, 0x96, 0xff, 0x91, 0x9a, 0xa2, 0xff, 0xb6, 0xbb, 0xbc, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb8, 0xb9, 0xb9, 0xff, 0xb7, 0xb8, 0xb9, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb8, 0xba, 0xbb, 0xff, 0xb8, 0xba, 0xbb, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb9, 0xba, 0xbb, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb4, 0xb9, 0xba, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xb5, 0xb8, 0xba, 0xff, 0xb5, 0xb9, 0xbb, 0xff, 0xb6, 0xbb, 0xba, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb9, 0xe6,
+    0xbe, 0xc0, 0xc1, 0xf0, 0xbc, 0xbe, 0xc0, 0xff, 0xbb, 0xbd, 0xbe, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xc3, 0xc4, 0xc5, 0xff, 0xc4, 0xc6, 0xc6, 0xff, 0xc4, 0xc7, 0xc8, 0xff, 0xc6, 0xca, 0xca, 0xff, 0x89, 0x8d, 0x90, 0xff, 0x6a, 0x72, 0x79, 0xff, 0x77, 0x81, 0x89, 0xff, 0x6b, 0x72, 0x78, 0xff, 0x51, 0x58, 0x5c, 0xff, 0x76, 0x7e, 0x84, 0xff, 0x95, 0x9e, 0xa2, 0xff, 0x5b, 0x62, 0x67, 0xff, 0x62, 0x6d, 0x73, 0xff, 0x2d, 0x39, 0x3c, 0xff, 0x62, 0x62, 0x60, 0xff, 0xb7, 0xb0, 0xb0, 0xff, 0xc9, 0xc3, 0xc1, 0xff, 0xf9, 0xee, 0xe8, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xc8, 0xcb, 0xd8, 0xff, 0x4c, 0x7a, 0xa9, 0xff, 0x79, 0xa0, 0xcd, 0xff, 0x78, 0x9e, 0xcb, 0xff, 0x7a, 0xa0, 0xce, 0xff, 0x8c, 0xaf, 0xdb, 0xff, 0x8c, 0xae, 0xdb, 0xff, 0x7b, 0xa0, 0xce, 0xff, 0x7e, 0xa1, 0xce, 0xff, 0x8a, 0xad, 0xd9, 0xff, 0x97, 0xb9, 0xe6, 0xff, 0xa1, 0xc1, 0xee, 0xff, 0xa7, 0xc6, 0xf0, 0xff, 0xa8, 0xc6, 0xef, 0xff, 0xa3, 0xc3, 0xed, 0xff, 0xa4, 0xc5, 0xf0, 0xff, 0xa9, 0xc9, 0xf1, 0xff, 0x9e, 0xc0, 0xe9, 0xff, 0x6e, 0x9b, 0xcf, 0xff, 0x30, 0x5b, 0x92, 0xff, 0xbe, 0xbd, 0xc7, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xf6, 0xec, 0xe6, 0xff, 0xf9, 0xee, 0xe5, 0xff, 0xe9, 0xde, 0xd6, 0xff, 0xa6, 0xa8, 0xa7, 0xff, 0xa9, 0xaf, 0xb2, 0xff, 0xa4, 0xaa, 0xad, 0xff, 0x93, 0x98, 0x9b, 0xff, 0x8b, 0x91, 0x94, 0xff, 0xa2, 0xac, 0xb0, 0xff, 0x7c, 0x85, 0x89, 0xff, 0x77, 0x80, 0x87, 0xff, 0x7f, 0x89, 0x91, 0xff, 0x9e, 0xa8, 0xac, 0xff, 0x8d, 0x96, 0x9c, 0xff, 0x7e, 0x89, 0x93, 0xff, 0xa8, 0xaf, 0xb2, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb8, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb6, 0xb7, 0xb8, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb6, 0xba, 0xbc, 0xff, 0xb6, 0xbb, 0xbc, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xba, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb4, 0xb8, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb8, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb5, 0xba, 0xb8, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xf0,
+    0xbb, 0xbd, 0xbe, 0xf3, 0xbc, 0xbe, 0xbf, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc1, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc5, 0xff, 0xc0, 0xc3, 0xc5, 0xff, 0xc0, 0xc3, 0xc4, 0xff, 0xc1, 0xc4, 0xc5, 0xff, 0xc2, 0xc5, 0xc6, 0xff, 0xc2, 0xc5, 0xc6, 0xff, 0xc2, 0xc6, 0xc7, 0xff, 0xc0, 0xc4, 0xc4, 0xff, 0x8a, 0x8f, 0x91, 0xff, 0x62, 0x6c, 0x73, 0xff, 0x7d, 0x86, 0x90, 0xff, 0x63, 0x6a, 0x6f, 0xff, 0x42, 0x49, 0x4c, 0xff, 0x76, 0x81, 0x87, 0xff, 0x7e, 0x89, 0x90, 0xff, 0x2c, 0x36, 0x3f, 0xff, 0x28, 0x30, 0x35, 0xff, 0x66, 0x63, 0x62, 0xff, 0xd6, 0xcb, 0xc8, 0xff, 0xbc, 0xb8, 0xb8, 0xff, 0xce, 0xc7, 0xc5, 0xff, 0xfa, 0xed, 0xe7, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xc5, 0xcc, 0xd6, 0xff, 0x4d, 0x7a, 0xa8, 0xff, 0x7c, 0xa3, 0xce, 0xff, 0x79, 0x9f, 0xcb, 0xff, 0x79, 0x9d, 0xcc, 0xff, 0x89, 0xab, 0xd9, 0xff, 0x90, 0xb2, 0xde, 0xff, 0x85, 0xaa, 0xd5, 0xff, 0x83, 0xa7, 0xd3, 0xff, 0x8a, 0xac, 0xd8, 0xff, 0x95, 0xb7, 0xe3, 0xff, 0xa2, 0xc2, 0xed, 0xff, 0xa7, 0xc7, 0xf0, 0xff, 0xa0, 0xc1, 0xee, 0xff, 0x9e, 0xc0, 0xed, 0xff, 0xa5, 0xc5, 0xf0, 0xff, 0xa7, 0xc6, 0xf1, 0xff, 0x7b, 0xa3, 0xd4, 0xff, 0x38, 0x67, 0xa0, 0xff, 0x91, 0xa0, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfd, 0xf3, 0xeb, 0xff, 0xf3, 0xe8, 0xe0, 0xff, 0xfe, 0xf3, 0xe8, 0xff, 0xd6, 0xd2, 0xce, 0xff, 0xbe, 0xc2, 0xc4, 0xff, 0xa6, 0xab, 0xaa, 0xff, 0x8c, 0x8e, 0x91, 0xff, 0x6e, 0x77, 0x7d, 0xff, 0x95, 0x9f, 0xa7, 0xff, 0x95, 0x9e, 0xa6, 0xff, 0x5c, 0x65, 0x6a, 0xff, 0x67, 0x72, 0x7c, 0xff, 0x89, 0x94, 0x9c, 0xff, 0x99, 0xa1, 0xa9, 0xff, 0x79, 0x85, 0x8e, 0xff, 0x8a, 0x92, 0x99, 0xff, 0xbb, 0xbe, 0xbf, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb6, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb6, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb7, 0xba, 0xbb, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb5, 0xba, 0xba, 0xff, 0xb5, 0xb9, 0xbb, 0xff, 0xb6, 0xba, 0xba, 0xff, 0xb5, 0xb9, 0xb8, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb4, 0xba, 0xb9, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb6, 0xba, 0xba, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb6, 0xbb, 0xb9, 0xff, 0xb5, 0xba, 0xb8, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb7, 0xb9, 0xf3,
+    0xbd, 0xbf, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc2, 0xff, 0xbe, 0xc0, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc1, 0xc3, 0xc3, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xc0, 0xc3, 0xc4, 0xff, 0xbe, 0xc3, 0xc4, 0xff, 0xbf, 0xc3, 0xc5, 0xff, 0xc1, 0xc3, 0xc5, 0xff, 0x86, 0x8c, 0x8d, 0xff, 0x5f, 0x6a, 0x70, 0xff, 0x7d, 0x86, 0x8f, 0xff, 0x57, 0x5d, 0x63, 0xff, 0x32, 0x3a, 0x3f, 0xff, 0x53, 0x61, 0x6b, 0xff, 0x5a, 0x63, 0x6a, 0xff, 0x65, 0x62, 0x61, 0xff, 0x86, 0x7b, 0x78, 0xff, 0xd6, 0xca, 0xc9, 0xff, 0xd5, 0xce, 0xcf, 0xff, 0xb6, 0xb2, 0xb0, 0xff, 0xe0, 0xd7, 0xd3, 0xff, 0xf9, 0xec, 0xe9, 0xff, 0xff, 0xfa, 0xf2, 0xff, 0xeb, 0xe8, 0xe6, 0xff, 0x6b, 0x8e, 0xb8, 0xff, 0x76, 0x9e, 0xcd, 0xff, 0x7f, 0xa2, 0xce, 0xff, 0x74, 0x99, 0xc7, 0xff, 0x82, 0xa7, 0xd3, 0xff, 0x91, 0xb4, 0xe0, 0xff, 0x8e, 0xb0, 0xdc, 0xff, 0x88, 0xab, 0xd7, 0xff, 0x8d, 0xb0, 0xdc, 0xff, 0x96, 0xb7, 0xe4, 0xff, 0x9f, 0xbf, 0xeb, 0xff, 0xa1, 0xc0, 0xec, 0xff, 0x9a, 0xbb, 0xe8, 0xff, 0x9a, 0xbb, 0xe8, 0xff, 0xa0, 0xc0, 0xeb, 0xff, 0x7a, 0xa2, 0xd5, 0xff, 0x36, 0x63, 0xa2, 0xff, 0x98, 0xa6, 0xc3, 0xff, 0xff, 0xf2, 0xe2, 0xff, 0xe7, 0xd6, 0xc4, 0xff, 0xf9, 0xf7, 0xf5, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xf8, 0xee, 0xe5, 0xff, 0xf4, 0xec, 0xe4, 0xff, 0xef, 0xe5, 0xe2, 0xff, 0xd8, 0xd6, 0xd4, 0xff, 0xcf, 0xd0, 0xd0, 0xff, 0xc5, 0xc0, 0xbe, 0xff, 0x88, 0x86, 0x89, 0xff, 0x70, 0x75, 0x7b, 0xff, 0x93, 0x9c, 0xa2, 0xff, 0x73, 0x7b, 0x82, 0xff, 0x4a, 0x51, 0x56, 0xff, 0x3e, 0x49, 0x4e, 0xff, 0x62, 0x71, 0x79, 0xff, 0x79, 0x84, 0x8e, 0xff, 0x74, 0x7f, 0x88, 0xff, 0xa4, 0xab, 0xae, 0xff, 0xbb, 0xbd, 0xbe, 0xff, 0xb0, 0xb4, 0xb6, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb0, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb1, 0xb5, 0xb7, 0xff, 0xb2, 0xb6, 0xb6, 0xff, 0xb1, 0xb6, 0xb5, 0xff, 0xb1, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb8, 0xff, 0xb2, 0xb6, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb4, 0xb9, 0xba, 0xff, 0xb6, 0xba, 0xbb, 0xff, 0xb6, 0xb9, 0xb9, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb8, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xba, 0xba, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb5, 0xba, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb4, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb8, 0xba, 0xff, 0xb5, 0xb9, 0xb9, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff,
+    0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc2, 0xc3, 0xff, 0xbf, 0xc1, 0xc3, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc1, 0xc1, 0xff, 0xc0, 0xc1, 0xc2, 0xff, 0xbe, 0xc2, 0xc3, 0xff, 0xc0, 0xc4, 0xc4, 0xff, 0x84, 0x8b, 0x8c, 0xff, 0x5f, 0x6b, 0x71, 0xff, 0x6d, 0x7b, 0x83, 0xff, 0x1d, 0x29, 0x2e, 0xff, 0x1a, 0x21, 0x26, 0xff, 0x81, 0x83, 0x89, 0xff, 0xc7, 0xbb, 0xbb, 0xff, 0xd7, 0xca, 0xc6, 0xff, 0xdd, 0xd5, 0xd2, 0xff, 0xd5, 0xcf, 0xcc, 0xff, 0xb3, 0xae, 0xaf, 0xff, 0xcc, 0xc8, 0xc7, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xf5, 0xea, 0xe7, 0xff, 0xff, 0xf4, 0xef, 0xff, 0xff, 0xfc, 0xf4, 0xff, 0x86, 0xa0, 0xc3, 0xff, 0x69, 0x92, 0xc7, 0xff, 0x86, 0xa7, 0xd2, 0xff, 0x6f, 0x95, 0xc3, 0xff, 0x79, 0xa0, 0xd0, 0xff, 0x92, 0xb4, 0xe1, 0xff, 0x94, 0xb6, 0xe2, 0xff, 0x8d, 0xaf, 0xdc, 0xff, 0x8c, 0xaf, 0xdb, 0xff, 0x90, 0xb2, 0xde, 0xff, 0x92, 0xb2, 0xdf, 0xff, 0x94, 0xb4, 0xe0, 0xff, 0x92, 0xb5, 0xdf, 0xff, 0x84, 0xab, 0xda, 0xff, 0x5e, 0x8d, 0xc7, 0xff, 0x49, 0x71, 0xab, 0xff, 0xb2, 0xbc, 0xd2, 0xff, 0xff, 0xf8, 0xe7, 0xff, 0xe4, 0xca, 0xa8, 0xff, 0xb8, 0x9d, 0x79, 0xff, 0xb8, 0xaa, 0x94, 0xff, 0xf6, 0xf5, 0xf4, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf8, 0xec, 0xe6, 0xff, 0xf1, 0xe9, 0xe3, 0xff, 0xe0, 0xdd, 0xd9, 0xff, 0xd6, 0xd4, 0xd5, 0xff, 0xf9, 0xf2, 0xec, 0xff, 0xf3, 0xea, 0xe7, 0xff, 0xd1, 0xca, 0xcb, 0xff, 0xcf, 0xc7, 0xc9, 0xff, 0xe1, 0xda, 0xdc, 0xff, 0xcc, 0xc6, 0xc6, 0xff, 0x9f, 0x9c, 0x9a, 0xff, 0x8e, 0x8e, 0x90, 0xff, 0x9e, 0xa2, 0xa7, 0xff, 0x89, 0x91, 0x97, 0xff, 0x6f, 0x77, 0x7e, 0xff, 0xa1, 0xa5, 0xac, 0xff, 0xb7, 0xba, 0xbe, 0xff, 0xaf, 0xb4, 0xb4, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xaf, 0xb3, 0xb4, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb2, 0xb5, 0xb5, 0xff, 0xb1, 0xb4, 0xb4, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb2, 0xb4, 0xb7, 0xff, 0xb1, 0xb5, 0xb7, 0xff, 0xb3, 0xb6, 0xb6, 0xff, 0xb4, 0xb5, 0xb6, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb5, 0xba, 0xb9, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xba, 0xff, 0xb5, 0xb8, 0xba, 0xff, 0xb5, 0xb8, 0xba, 0xff, 0xb4, 0xb9, 0xba, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb5, 0xb7, 0xb9, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb6, 0xb9, 0xb9, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb3, 0xb8, 0xb8, 0xff,
+    0xbb, 0xbd, 0xbd, 0xf3, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbd, 0xbf, 0xc1, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbe, 0xc1, 0xc2, 0xff, 0xbe, 0xc1, 0xc1, 0xff, 0xbe, 0xc1, 0xc1, 0xff, 0xbe, 0xc1, 0xc1, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xbe, 0xc1, 0xc0, 0xff, 0xbf, 0xc3, 0xc3, 0xff, 0x6f, 0x79, 0x7c, 0xff, 0x31, 0x41, 0x47, 0xff, 0x40, 0x4a, 0x4e, 0xff, 0x4a, 0x49, 0x4a, 0xff, 0xa4, 0xa0, 0xa1, 0xff, 0xed, 0xe4, 0xe4, 0xff, 0xe1, 0xd7, 0xd7, 0xff, 0xc1, 0xbb, 0xbe, 0xff, 0xd0, 0xc9, 0xc8, 0xff, 0xc7, 0xc0, 0xbd, 0xff, 0xc3, 0xbd, 0xbe, 0xff, 0xc0, 0xb8, 0xb0, 0xff, 0xca, 0xc5, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xee, 0xe6, 0xff, 0xff, 0xf5, 0xe8, 0xff, 0xd4, 0xd6, 0xe2, 0xff, 0x69, 0x90, 0xc7, 0xff, 0x7f, 0xa3, 0xd3, 0xff, 0x69, 0x8e, 0xbc, 0xff, 0x6b, 0x94, 0xc4, 0xff, 0x91, 0xb4, 0xe0, 0xff, 0x99, 0xb9, 0xe6, 0xff, 0x90, 0xb1, 0xde, 0xff, 0x8c, 0xad, 0xd8, 0xff, 0x8c, 0xad, 0xda, 0xff, 0x8a, 0xad, 0xd8, 0xff, 0x8b, 0xae, 0xd8, 0xff, 0x69, 0x94, 0xca, 0xff, 0x53, 0x80, 0xb8, 0xff, 0x7d, 0x9a, 0xbf, 0xff, 0xd2, 0xd5, 0xd9, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xe6, 0xd8, 0xc5, 0xff, 0xd3, 0xbc, 0xa2, 0xff, 0xba, 0xac, 0x95, 0xff, 0x9c, 0x87, 0x6d, 0xff, 0xb7, 0xa9, 0x95, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xf6, 0xff, 0xfa, 0xf1, 0xe8, 0xff, 0xed, 0xe5, 0xe3, 0xff, 0xd2, 0xd3, 0xd2, 0xff, 0xe2, 0xe1, 0xdf, 0xff, 0xff, 0xfa, 0xf5, 0xff, 0xf0, 0xeb, 0xeb, 0xff, 0xec, 0xe9, 0xeb, 0xff, 0xf6, 0xf0, 0xf0, 0xff, 0xfe, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xf2, 0xec, 0xec, 0xff, 0xe3, 0xe1, 0xe2, 0xff, 0xae, 0xb2, 0xb1, 0xff, 0x8b, 0x92, 0x92, 0xff, 0xa4, 0xa8, 0xa8, 0xff, 0xa6, 0xaa, 0xab, 0xff, 0xa8, 0xad, 0xae, 0xff, 0xab, 0xb0, 0xb1, 0xff, 0xb1, 0xb3, 0xb4, 0xff, 0xb2, 0xb4, 0xb5, 0xff, 0xaf, 0xb2, 0xb3, 0xff, 0xb2, 0xb3, 0xb4, 0xff, 0xb3, 0xb3, 0xb4, 0xff, 0xb2, 0xb3, 0xb3, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb5, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb3, 0xba, 0xb8, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb8, 0xb8, 0xff, 0xb5, 0xb9, 0xb8, 0xff, 0xb5, 0xb8, 0xb8, 0xff, 0xb6, 0xb9, 0xb8, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb9, 0xff, 0xb3, 0xb9, 0xb9, 0xff, 0xb5, 0xb9, 0xb8, 0xff, 0xb4, 0xb7, 0xb7, 0xf3,
+    0xbb, 0xbd, 0xbd, 0xf0, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xc1, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc3, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbc, 0xc0, 0xc1, 0xff, 0xbd, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbe, 0xc1, 0xc2, 0xff, 0xbe, 0xc1, 0xc2, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xc0, 0xc3, 0xc5, 0xff, 0xbb, 0xc0, 0xc1, 0xff, 0xa9, 0xaf, 0xb1, 0xff, 0x5e, 0x65, 0x66, 0xff, 0x7d, 0x7d, 0x7f, 0xff, 0xc5, 0xbe, 0xbd, 0xff, 0xea, 0xe0, 0xe0, 0xff, 0xe8, 0xe2, 0xe4, 0xff, 0xd9, 0xd4, 0xd5, 0xff, 0xcd, 0xc8, 0xc9, 0xff, 0xc5, 0xbe, 0xc1, 0xff, 0xcb, 0xc4, 0xc4, 0xff, 0xbd, 0xb5, 0xb5, 0xff, 0xe4, 0xdb, 0xd9, 0xff, 0x95, 0x8b, 0x7b, 0xff, 0x5b, 0x51, 0x3d, 0xff, 0xe4, 0xe1, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf0, 0xe9, 0xff, 0xff, 0xfd, 0xf1, 0xff, 0xbb, 0xc8, 0xdd, 0xff, 0x69, 0x94, 0xcd, 0xff, 0x55, 0x80, 0xb3, 0xff, 0x57, 0x7c, 0xb0, 0xff, 0x8d, 0xb1, 0xdf, 0xff, 0xa4, 0xc3, 0xee, 0xff, 0x90, 0xaf, 0xdd, 0xff, 0x87, 0xaa, 0xd8, 0xff, 0x8c, 0xad, 0xda, 0xff, 0x86, 0xa8, 0xd5, 0xff, 0x59, 0x81, 0xbd, 0xff, 0x5e, 0x7f, 0xb0, 0xff, 0xd0, 0xcd, 0xd2, 0xff, 0xff, 0xfd, 0xe9, 0xff, 0xff, 0xfe, 0xea, 0xff, 0xe6, 0xd8, 0xcc, 0xff, 0xdf, 0xce, 0xc2, 0xff, 0xd5, 0xc6, 0xba, 0xff, 0xd2, 0xc2, 0xb4, 0xff, 0xd1, 0xbe, 0xae, 0xff, 0xa2, 0x8b, 0x73, 0xff, 0xc5, 0xba, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xfd, 0xf0, 0xe9, 0xff, 0xf0, 0xe9, 0xe3, 0xff, 0xd0, 0xd0, 0xd1, 0xff, 0xd9, 0xd9, 0xda, 0xff, 0xe7, 0xe3, 0xe5, 0xff, 0xe6, 0xe3, 0xe3, 0xff, 0xea, 0xe9, 0xe9, 0xff, 0xf1, 0xec, 0xed, 0xff, 0xef, 0xea, 0xeb, 0xff, 0xeb, 0xe7, 0xe8, 0xff, 0xde, 0xdc, 0xde, 0xff, 0xe1, 0xdf, 0xe1, 0xff, 0xfd, 0xf9, 0xf9, 0xff, 0xe4, 0xe2, 0xe0, 0xff, 0xc7, 0xc7, 0xc6, 0xff, 0xbb, 0xbe, 0xbf, 0xff, 0xb3, 0xb6, 0xb6, 0xff, 0xac, 0xaf, 0xb0, 0xff, 0xa9, 0xaa, 0xac, 0xff, 0xa5, 0xa7, 0xa9, 0xff, 0xa5, 0xaa, 0xab, 0xff, 0xac, 0xb0, 0xb1, 0xff, 0xb0, 0xb3, 0xb4, 0xff, 0xb1, 0xb2, 0xb2, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb1, 0xb5, 0xb6, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb8, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb8, 0xb7, 0xff, 0xb5, 0xb8, 0xb8, 0xff, 0xb6, 0xb8, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb6, 0xb9, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb5, 0xb9, 0xb8, 0xff, 0xb5, 0xb8, 0xb8, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb4, 0xb7, 0xb9, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xf0,
+    0xbb, 0xbd, 0xbd, 0xe7, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbd, 0xbf, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbb, 0xc0, 0xc1, 0xff, 0xbb, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbd, 0xc0, 0xc1, 0xff, 0xbc, 0xc0, 0xc1, 0xff, 0xbc, 0xc0, 0xc1, 0xff, 0xbd, 0xc1, 0xc1, 0xff, 0xbd, 0xc1, 0xc2, 0xff, 0xab, 0xb0, 0xb1, 0xff, 0xa5, 0xa7, 0xa8, 0xff, 0xcf, 0xca, 0xca, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xf6, 0xf1, 0xf1, 0xff, 0xcc, 0xc8, 0xcc, 0xff, 0xc7, 0xc3, 0xc6, 0xff, 0xd6, 0xd0, 0xd2, 0xff, 0xd0, 0xca, 0xcb, 0xff, 0xc1, 0xbc, 0xbc, 0xff, 0xc5, 0xbf, 0xbf, 0xff, 0xce, 0xc6, 0xc7, 0xff, 0xd2, 0xca, 0xc3, 0xff, 0x84, 0x78, 0x6a, 0xff, 0x83, 0x76, 0x62, 0xff, 0x8a, 0x83, 0x72, 0xff, 0xdc, 0xd4, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xf9, 0xee, 0xff, 0xcc, 0xd1, 0xe0, 0xff, 0x66, 0x8b, 0xc0, 0xff, 0x2c, 0x5c, 0x9c, 0xff, 0x6b, 0x93, 0xc8, 0xff, 0xa9, 0xc8, 0xf2, 0xff, 0x93, 0xb4, 0xe1, 0xff, 0x81, 0xa2, 0xd3, 0xff, 0x78, 0x9a, 0xc9, 0xff, 0x48, 0x6f, 0xb1, 0xff, 0x71, 0x8c, 0xb9, 0xff, 0xf0, 0xed, 0xdd, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xf8, 0xe5, 0xff, 0xfe, 0xf1, 0xe4, 0xff, 0xf0, 0xe2, 0xdc, 0xff, 0xe4, 0xd4, 0xcf, 0xff, 0xe1, 0xd2, 0xc8, 0xff, 0xe4, 0xd4, 0xca, 0xff, 0xe0, 0xce, 0xc3, 0xff, 0xcb, 0xb8, 0xa5, 0xff, 0xa6, 0x94, 0x7c, 0xff, 0xd4, 0xcd, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf4, 0xec, 0xff, 0xff, 0xf5, 0xec, 0xff, 0xf6, 0xef, 0xe9, 0xff, 0xd5, 0xd5, 0xd4, 0xff, 0xd6, 0xd7, 0xda, 0xff, 0xe1, 0xdf, 0xe0, 0xff, 0xe7, 0xe6, 0xe5, 0xff, 0xf0, 0xed, 0xed, 0xff, 0xf1, 0xed, 0xee, 0xff, 0xe7, 0xe3, 0xe5, 0xff, 0xde, 0xdc, 0xde, 0xff, 0xdd, 0xdc, 0xde, 0xff, 0xe1, 0xe0, 0xe3, 0xff, 0xee, 0xed, 0xee, 0xff, 0xea, 0xe8, 0xe9, 0xff, 0xe3, 0xe2, 0xe3, 0xff, 0xe0, 0xe0, 0xdf, 0xff, 0xd9, 0xd8, 0xd9, 0xff, 0xd0, 0xcf, 0xd1, 0xff, 0xc6, 0xc7, 0xc8, 0xff, 0xb7, 0xb9, 0xba, 0xff, 0xa3, 0xa7, 0xa7, 0xff, 0xa5, 0xa9, 0xa9, 0xff, 0xb1, 0xb3, 0xb4, 0xff, 0xb2, 0xb3, 0xb4, 0xff, 0xb1, 0xb3, 0xb4, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb4, 0xb5, 0xb6, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb6, 0xb7, 0xb7, 0xff, 0xb6, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xba, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb4, 0xb7, 0xb7, 0xff, 0xb4, 0xb9, 0xb7, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb8, 0xe6,
+    0xba, 0xbc, 0xbc, 0xd3, 0xbc, 0xbe, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbe, 0xbd, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbc, 0xc0, 0xc1, 0xff, 0xbc, 0xc1, 0xc2, 0xff, 0xbc, 0xbf, 0xbf, 0xff, 0xba, 0xbc, 0xbc, 0xff, 0xb8, 0xba, 0xbb, 0xff, 0xb5, 0xb9, 0xba, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xbe, 0xbc, 0xbc, 0xff, 0xdf, 0xd9, 0xda, 0xff, 0xf5, 0xed, 0xef, 0xff, 0xe1, 0xdd, 0xdd, 0xff, 0xc6, 0xc3, 0xc4, 0xff, 0xc0, 0xbc, 0xbe, 0xff, 0xd5, 0xd1, 0xd2, 0xff, 0xda, 0xd3, 0xd6, 0xff, 0xca, 0xc4, 0xc7, 0xff, 0xc0, 0xbb, 0xbb, 0xff, 0xc1, 0xbd, 0xbc, 0xff, 0xdb, 0xd3, 0xd3, 0xff, 0xbc, 0xae, 0xa4, 0xff, 0x93, 0x84, 0x76, 0xff, 0xb6, 0xaa, 0x9c, 0xff, 0xa7, 0x97, 0x8b, 0xff, 0x91, 0x83, 0x7a, 0xff, 0xba, 0xb2, 0xa9, 0xff, 0xf1, 0xec, 0xea, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf1, 0xf0, 0xed, 0xff, 0x86, 0x9a, 0xb9, 0xff, 0x47, 0x71, 0xaa, 0xff, 0x7c, 0xa6, 0xdc, 0xff, 0x89, 0xab, 0xd9, 0xff, 0x7f, 0x9e, 0xcf, 0xff, 0x4e, 0x73, 0xb3, 0xff, 0x5e, 0x7c, 0xac, 0xff, 0xf5, 0xf4, 0xee, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xfc, 0xe9, 0xff, 0xfe, 0xfa, 0xec, 0xff, 0xfd, 0xf4, 0xea, 0xff, 0xf4, 0xe5, 0xe3, 0xff, 0xe8, 0xda, 0xd1, 0xff, 0xeb, 0xe0, 0xd5, 0xff, 0xed, 0xdf, 0xd8, 0xff, 0xe7, 0xd6, 0xce, 0xff, 0xdf, 0xd0, 0xc3, 0xff, 0xcb, 0xbb, 0xac, 0xff, 0xaf, 0x9d, 0x8f, 0xff, 0xe0, 0xd7, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf3, 0xec, 0xff, 0xff, 0xf7, 0xef, 0xff, 0xfa, 0xf2, 0xef, 0xff, 0xe9, 0xe3, 0xe5, 0xff, 0xdd, 0xdb, 0xdb, 0xff, 0xe1, 0xdf, 0xdf, 0xff, 0xf0, 0xef, 0xee, 0xff, 0xef, 0xed, 0xed, 0xff, 0xe3, 0xe0, 0xe2, 0xff, 0xe1, 0xe0, 0xe2, 0xff, 0xde, 0xdd, 0xde, 0xff, 0xdb, 0xda, 0xdc, 0xff, 0xe0, 0xde, 0xe1, 0xff, 0xe0, 0xdf, 0xe3, 0xff, 0xe0, 0xdf, 0xe2, 0xff, 0xde, 0xdd, 0xdf, 0xff, 0xe0, 0xdf, 0xe1, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xef, 0xed, 0xed, 0xff, 0xf0, 0xef, 0xef, 0xff, 0xdf, 0xde, 0xde, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0x9d, 0xa1, 0xa3, 0xff, 0xac, 0xb1, 0xb3, 0xff, 0xb3, 0xb3, 0xb4, 0xff, 0xb2, 0xb3, 0xb4, 0xff, 0xb0, 0xb4, 0xb5, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb5, 0xb6, 0xb7, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb4, 0xb7, 0xb7, 0xff, 0xb8, 0xb7, 0xb7, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb2, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb5, 0xb8, 0xb8, 0xff, 0xb6, 0xb7, 0xb7, 0xff, 0xb7, 0xb7, 0xb9, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb2, 0xb7, 0xb8, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb2, 0xb8, 0xb7, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb7, 0xb8, 0xd3,
+    0xba, 0xbd, 0xbd, 0xbe, 0xbc, 0xbe, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbe, 0xc0, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbb, 0xbf, 0xc0, 0xff, 0xb9, 0xbc, 0xbe, 0xff, 0xba, 0xbb, 0xbc, 0xff, 0xb9, 0xba, 0xba, 0xff, 0xbe, 0xbf, 0xbf, 0xff, 0xc0, 0xc1, 0xc2, 0xff, 0xcb, 0xc9, 0xcb, 0xff, 0xe9, 0xe2, 0xe3, 0xff, 0xef, 0xe9, 0xea, 0xff, 0xe3, 0xde, 0xdf, 0xff, 0xcf, 0xcc, 0xcc, 0xff, 0xc7, 0xc5, 0xc5, 0xff, 0xdc, 0xd6, 0xd8, 0xff, 0xe0, 0xda, 0xdc, 0xff, 0xd3, 0xce, 0xd2, 0xff, 0xc3, 0xbe, 0xc0, 0xff, 0xc3, 0xbd, 0xbd, 0xff, 0xc4, 0xc0, 0xbf, 0xff, 0xce, 0xc4, 0xbf, 0xff, 0xb3, 0xa4, 0x98, 0xff, 0xc3, 0xb5, 0xa9, 0xff, 0xc8, 0xbd, 0xb3, 0xff, 0xc4, 0xb7, 0xad, 0xff, 0xb5, 0xa8, 0x9e, 0xff, 0x9a, 0x90, 0x86, 0xff, 0xa6, 0x9d, 0x99, 0xff, 0xbb, 0xb6, 0xb7, 0xff, 0xcb, 0xc9, 0xc7, 0xff, 0xf1, 0xe8, 0xde, 0xff, 0xff, 0xf9, 0xe7, 0xff, 0xd9, 0xda, 0xde, 0xff, 0x74, 0x99, 0xd0, 0xff, 0x51, 0x7e, 0xbc, 0xff, 0x62, 0x87, 0xbd, 0xff, 0x5b, 0x79, 0xb0, 0xff, 0xe6, 0xe8, 0xe3, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xed, 0xef, 0xea, 0xff, 0xfd, 0xf5, 0xeb, 0xff, 0xfe, 0xf2, 0xea, 0xff, 0xfc, 0xf0, 0xea, 0xff, 0xed, 0xe1, 0xda, 0xff, 0xeb, 0xdf, 0xd7, 0xff, 0xf3, 0xe8, 0xe2, 0xff, 0xf7, 0xeb, 0xe7, 0xff, 0xf0, 0xe2, 0xdd, 0xff, 0xe2, 0xd5, 0xd0, 0xff, 0xe1, 0xd4, 0xcf, 0xff, 0xd1, 0xc4, 0xbd, 0xff, 0xad, 0xa2, 0x97, 0xff, 0xe1, 0xdc, 0xd2, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfb, 0xf3, 0xeb, 0xff, 0xf0, 0xea, 0xe8, 0xff, 0xe6, 0xe1, 0xe2, 0xff, 0xd8, 0xd6, 0xd5, 0xff, 0xe0, 0xde, 0xde, 0xff, 0xf1, 0xef, 0xef, 0xff, 0xf0, 0xee, 0xed, 0xff, 0xe7, 0xe6, 0xe5, 0xff, 0xdb, 0xda, 0xdd, 0xff, 0xd2, 0xd1, 0xd4, 0xff, 0xd6, 0xd5, 0xd7, 0xff, 0xe0, 0xdf, 0xe1, 0xff, 0xe3, 0xe2, 0xe4, 0xff, 0xdc, 0xdb, 0xdd, 0xff, 0xd8, 0xd8, 0xda, 0xff, 0xdd, 0xdc, 0xde, 0xff, 0xe0, 0xdf, 0xe2, 0xff, 0xd9, 0xda, 0xdd, 0xff, 0xe9, 0xe8, 0xe9, 0xff, 0xfe, 0xfa, 0xfa, 0xff, 0xfb, 0xf6, 0xf2, 0xff, 0xc6, 0xc4, 0xc3, 0xff, 0x9f, 0xa4, 0xa6, 0xff, 0xae, 0xb0, 0xb2, 0xff, 0xb2, 0xb2, 0xb3, 0xff, 0xb1, 0xb3, 0xb4, 0xff, 0xb2, 0xb4, 0xb5, 0xff, 0xb2, 0xb4, 0xb6, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb5, 0xb6, 0xb7, 0xff, 0xb4, 0xb7, 0xb6, 0xff, 0xb2, 0xb6, 0xb5, 0xff, 0xb4, 0xb7, 0xb6, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb4, 0xb7, 0xb7, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb9, 0xba, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb6, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb9, 0xb8, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb3, 0xb7, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb9, 0xb8, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xbe,
+    0xbb, 0xbe, 0xbe, 0xaa, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbd, 0xbf, 0xbe, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xc0, 0xc0, 0xff, 0xbd, 0xc0, 0xc0, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb3, 0xb4, 0xb6, 0xff, 0xbe, 0xbe, 0xc0, 0xff, 0xc8, 0xc9, 0xca, 0xff, 0xd1, 0xd1, 0xd0, 0xff, 0xda, 0xd7, 0xd7, 0xff, 0xde, 0xda, 0xdb, 0xff, 0xe9, 0xe4, 0xe5, 0xff, 0xeb, 0xe6, 0xe6, 0xff, 0xe0, 0xde, 0xde, 0xff, 0xd7, 0xd6, 0xd6, 0xff, 0xd5, 0xd2, 0xd3, 0xff, 0xdb, 0xd9, 0xd9, 0xff, 0xdd, 0xdb, 0xdc, 0xff, 0xcf, 0xcd, 0xcf, 0xff, 0xc6, 0xc3, 0xc5, 0xff, 0xc8, 0xc2, 0xc4, 0xff, 0xbd, 0xb7, 0xb9, 0xff, 0xd2, 0xcc, 0xc8, 0xff, 0xc8, 0xbd, 0xb4, 0xff, 0xbe, 0xb1, 0xa9, 0xff, 0xd8, 0xcd, 0xc6, 0xff, 0xd2, 0xca, 0xc2, 0xff, 0xc9, 0xbf, 0xb8, 0xff, 0xc1, 0xb6, 0xb0, 0xff, 0xbe, 0xb4, 0xac, 0xff, 0xb1, 0xa4, 0x9e, 0xff, 0x9d, 0x90, 0x92, 0xff, 0x97, 0x91, 0x99, 0xff, 0xa9, 0xa8, 0xae, 0xff, 0xca, 0xc2, 0xbe, 0xff, 0xef, 0xd9, 0xc7, 0xff, 0xe4, 0xd8, 0xd2, 0xff, 0x61, 0x82, 0xb8, 0xff, 0x12, 0x44, 0x92, 0xff, 0xa7, 0xb8, 0xcd, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xdd, 0xe6, 0xe2, 0xff, 0xde, 0xe9, 0xe6, 0xff, 0xfd, 0xf4, 0xec, 0xff, 0xff, 0xf3, 0xef, 0xff, 0xf3, 0xe6, 0xe4, 0xff, 0xe8, 0xde, 0xd5, 0xff, 0xf2, 0xe6, 0xe2, 0xff, 0xf3, 0xe7, 0xe6, 0xff, 0xf8, 0xed, 0xe9, 0xff, 0xfb, 0xef, 0xeb, 0xff, 0xf2, 0xe4, 0xe3, 0xff, 0xe8, 0xdc, 0xda, 0xff, 0xe9, 0xdd, 0xd9, 0xff, 0xd2, 0xc4, 0xbf, 0xff, 0xb5, 0xa9, 0xa1, 0xff, 0xe6, 0xde, 0xd5, 0xff, 0xfe, 0xf8, 0xf2, 0xff, 0xec, 0xe6, 0xe5, 0xff, 0xe0, 0xdb, 0xdd, 0xff, 0xd5, 0xd3, 0xd4, 0xff, 0xe2, 0xe2, 0xe1, 0xff, 0xef, 0xef, 0xef, 0xff, 0xef, 0xed, 0xec, 0xff, 0xe2, 0xe2, 0xe1, 0xff, 0xd0, 0xd0, 0xd3, 0xff, 0xcb, 0xca, 0xd1, 0xff, 0xdf, 0xde, 0xe1, 0xff, 0xe9, 0xe8, 0xe9, 0xff, 0xe4, 0xe3, 0xe5, 0xff, 0xdb, 0xd9, 0xdb, 0xff, 0xd8, 0xd7, 0xd9, 0xff, 0xe2, 0xe0, 0xe2, 0xff, 0xd1, 0xd1, 0xd5, 0xff, 0xd1, 0xd4, 0xd6, 0xff, 0xf4, 0xf1, 0xef, 0xff, 0xfd, 0xf8, 0xf2, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xc7, 0xc4, 0xc2, 0xff, 0x9f, 0xa3, 0xa4, 0xff, 0xaf, 0xb4, 0xb4, 0xff, 0xb0, 0xb2, 0xb2, 0xff, 0xb1, 0xb3, 0xb4, 0xff, 0xb2, 0xb3, 0xb5, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb2, 0xb7, 0xb8, 0xff, 0xb4, 0xb7, 0xb9, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb2, 0xb7, 0xb8, 0xff, 0xb3, 0xb9, 0xb8, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb2, 0xb6, 0xb8, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb7, 0xb8, 0xab,
+    0xbb, 0xbe, 0xbe, 0x8b, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbd, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xc1, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xb0, 0xb2, 0xb2, 0xff, 0xbc, 0xbb, 0xbb, 0xff, 0xcd, 0xc7, 0xc8, 0xff, 0xd8, 0xd4, 0xd5, 0xff, 0xe0, 0xde, 0xde, 0xff, 0xe5, 0xe2, 0xe2, 0xff, 0xe4, 0xe1, 0xe2, 0xff, 0xe3, 0xe1, 0xe2, 0xff, 0xe4, 0xe3, 0xe3, 0xff, 0xe2, 0xdf, 0xe0, 0xff, 0xdf, 0xdc, 0xdd, 0xff, 0xde, 0xdb, 0xdb, 0xff, 0xe4, 0xde, 0xe0, 0xff, 0xe6, 0xe1, 0xe2, 0xff, 0xdd, 0xdb, 0xdb, 0xff, 0xcd, 0xca, 0xcb, 0xff, 0xca, 0xc7, 0xc8, 0xff, 0xc6, 0xc3, 0xc4, 0xff, 0xbe, 0xba, 0xbb, 0xff, 0xcf, 0xc4, 0xbe, 0xff, 0xc9, 0xbc, 0xb3, 0xff, 0xd9, 0xce, 0xca, 0xff, 0xdc, 0xd0, 0xcd, 0xff, 0xd6, 0xcb, 0xc6, 0xff, 0xd0, 0xc6, 0xc2, 0xff, 0xd5, 0xc9, 0xc6, 0xff, 0xd6, 0xca, 0xc5, 0xff, 0xd1, 0xc6, 0xc0, 0xff, 0xc8, 0xbb, 0xb8, 0xff, 0xbb, 0xb1, 0xb0, 0xff, 0xb3, 0xaf, 0xb1, 0xff, 0xbb, 0xb8, 0xbc, 0xff, 0xc4, 0xb7, 0xb4, 0xff, 0xe4, 0xce, 0xb5, 0xff, 0xc7, 0xc0, 0xc5, 0xff, 0x4f, 0x6e, 0xa3, 0xff, 0xe7, 0xea, 0xe7, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xf3, 0xf2, 0xe8, 0xff, 0xfb, 0xf8, 0xec, 0xff, 0xff, 0xfc, 0xf0, 0xff, 0xfb, 0xf0, 0xea, 0xff, 0xe8, 0xdd, 0xd6, 0xff, 0xe9, 0xdf, 0xda, 0xff, 0xf4, 0xe8, 0xe7, 0xff, 0xf2, 0xe7, 0xe5, 0xff, 0xfa, 0xef, 0xeb, 0xff, 0xfb, 0xf0, 0xed, 0xff, 0xf8, 0xed, 0xeb, 0xff, 0xf4, 0xec, 0xe9, 0xff, 0xf3, 0xe9, 0xe6, 0xff, 0xef, 0xe3, 0xe1, 0xff, 0xdf, 0xd3, 0xce, 0xff, 0xdc, 0xd2, 0xcc, 0xff, 0xee, 0xe9, 0xe6, 0xff, 0xef, 0xeb, 0xeb, 0xff, 0xde, 0xd9, 0xdc, 0xff, 0xd2, 0xcf, 0xd1, 0xff, 0xe2, 0xe1, 0xe1, 0xff, 0xec, 0xed, 0xed, 0xff, 0xec, 0xeb, 0xeb, 0xff, 0xe4, 0xe2, 0xe4, 0xff, 0xd3, 0xd3, 0xd5, 0xff, 0xc8, 0xc9, 0xce, 0xff, 0xde, 0xdd, 0xe1, 0xff, 0xeb, 0xe9, 0xea, 0xff, 0xe4, 0xe3, 0xe4, 0xff, 0xd9, 0xd7, 0xda, 0xff, 0xd8, 0xd8, 0xda, 0xff, 0xd5, 0xd4, 0xd8, 0xff, 0xc2, 0xc4, 0xc8, 0xff, 0xeb, 0xe6, 0xe7, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xfc, 0xf6, 0xff, 0xf5, 0xf0, 0xee, 0xff, 0xf7, 0xf3, 0xf2, 0xff, 0xf2, 0xed, 0xec, 0xff, 0xaa, 0xab, 0xaa, 0xff, 0xa5, 0xaa, 0xaa, 0xff, 0xb1, 0xb2, 0xb3, 0xff, 0xaf, 0xb1, 0xb2, 0xff, 0xb1, 0xb3, 0xb4, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb4, 0xb6, 0xb8, 0xff, 0xb5, 0xb6, 0xb7, 0xff, 0xb4, 0xb8, 0xb6, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb1, 0xb6, 0xb6, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb7, 0xb7, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb6, 0xb7, 0xb8, 0xff, 0xb7, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb7, 0x8b,
+    0xbc, 0xbe, 0xbe, 0x6b, 0xbc, 0xbe, 0xbf, 0xff, 0xbb, 0xbd, 0xbe, 0xff, 0xbb, 0xbd, 0xbe, 0xff, 0xbd, 0xbf, 0xc1, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbe, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xba, 0xbe, 0xbe, 0xff, 0xae, 0xad, 0xad, 0xff, 0xb2, 0xad, 0xaf, 0xff, 0xcd, 0xc7, 0xc9, 0xff, 0xe7, 0xe1, 0xe2, 0xff, 0xe8, 0xe3, 0xe3, 0xff, 0xe9, 0xe4, 0xe5, 0xff, 0xea, 0xe5, 0xe6, 0xff, 0xeb, 0xe8, 0xe8, 0xff, 0xeb, 0xea, 0xea, 0xff, 0xe8, 0xe7, 0xe7, 0xff, 0xe7, 0xe5, 0xe5, 0xff, 0xe7, 0xe3, 0xe4, 0xff, 0xe4, 0xe2, 0xe2, 0xff, 0xe9, 0xe4, 0xe5, 0xff, 0xe7, 0xe1, 0xe2, 0xff, 0xe1, 0xdd, 0xdd, 0xff, 0xd8, 0xd4, 0xd4, 0xff, 0xcd, 0xcb, 0xcc, 0xff, 0xbc, 0xb8, 0xb8, 0xff, 0xc7, 0xc1, 0xbd, 0xff, 0xce, 0xbf, 0xb8, 0xff, 0xd9, 0xcb, 0xc3, 0xff, 0xe4, 0xd9, 0xd4, 0xff, 0xdf, 0xd3, 0xd1, 0xff, 0xdb, 0xce, 0xcd, 0xff, 0xd8, 0xcd, 0xca, 0xff, 0xde, 0xd2, 0xcf, 0xff, 0xda, 0xce, 0xcb, 0xff, 0xdf, 0xd2, 0xd1, 0xff, 0xe1, 0xd5, 0xd3, 0xff, 0xdb, 0xce, 0xca, 0xff, 0xd6, 0xca, 0xc9, 0xff, 0xce, 0xc6, 0xca, 0xff, 0xd0, 0xc7, 0xc6, 0xff, 0xd0, 0xc5, 0xbb, 0xff, 0xd8, 0xc7, 0xb6, 0xff, 0xe5, 0xdd, 0xd4, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfe, 0xfc, 0xef, 0xff, 0xff, 0xfc, 0xf0, 0xff, 0xff, 0xfb, 0xed, 0xff, 0xff, 0xf8, 0xea, 0xff, 0xf1, 0xe6, 0xde, 0xff, 0xe5, 0xd9, 0xd4, 0xff, 0xeb, 0xe1, 0xde, 0xff, 0xf2, 0xe9, 0xe7, 0xff, 0xf4, 0xeb, 0xe7, 0xff, 0xf9, 0xf0, 0xec, 0xff, 0xf8, 0xef, 0xeb, 0xff, 0xf2, 0xea, 0xe9, 0xff, 0xf0, 0xe9, 0xe8, 0xff, 0xf1, 0xea, 0xe9, 0xff, 0xf1, 0xea, 0xe8, 0xff, 0xf2, 0xea, 0xe8, 0xff, 0xf4, 0xee, 0xec, 0xff, 0xec, 0xe9, 0xe7, 0xff, 0xef, 0xea, 0xeb, 0xff, 0xdc, 0xd7, 0xd9, 0xff, 0xcf, 0xcc, 0xcf, 0xff, 0xdd, 0xdb, 0xdd, 0xff, 0xe7, 0xe8, 0xe7, 0xff, 0xec, 0xed, 0xec, 0xff, 0xe8, 0xe6, 0xe7, 0xff, 0xd1, 0xd1, 0xd5, 0xff, 0xc3, 0xc5, 0xc9, 0xff, 0xd8, 0xda, 0xdb, 0xff, 0xea, 0xe9, 0xe9, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xd4, 0xd3, 0xd5, 0xff, 0xd4, 0xd5, 0xd7, 0xff, 0xc2, 0xc4, 0xca, 0xff, 0xcd, 0xcd, 0xd0, 0xff, 0xfe, 0xf8, 0xf5, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf3, 0xee, 0xed, 0xff, 0xee, 0xea, 0xe9, 0xff, 0xf1, 0xee, 0xed, 0xff, 0xfc, 0xf9, 0xf8, 0xff, 0xda, 0xd6, 0xd5, 0xff, 0xa0, 0xa2, 0xa3, 0xff, 0xae, 0xaf, 0xb0, 0xff, 0xaf, 0xb2, 0xb3, 0xff, 0xb0, 0xb3, 0xb4, 0xff, 0xb1, 0xb3, 0xb4, 0xff, 0xb2, 0xb4, 0xb5, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb7, 0xff, 0xb1, 0xb8, 0xb6, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb6, 0xb7, 0xb8, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb4, 0xb7, 0xb7, 0xff, 0xb4, 0xb7, 0xb7, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb7, 0x6b,
+    0xbe, 0xbe, 0xbe, 0x4b, 0xbd, 0xbf, 0xc0, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbe, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xb5, 0xb6, 0xb7, 0xff, 0xc0, 0xbb, 0xbc, 0xff, 0xbc, 0xb4, 0xb5, 0xff, 0xc7, 0xc1, 0xc1, 0xff, 0xed, 0xe8, 0xe7, 0xff, 0xed, 0xe9, 0xe7, 0xff, 0xf0, 0xec, 0xec, 0xff, 0xef, 0xea, 0xec, 0xff, 0xed, 0xeb, 0xeb, 0xff, 0xed, 0xeb, 0xeb, 0xff, 0xea, 0xe9, 0xe9, 0xff, 0xe9, 0xe6, 0xe6, 0xff, 0xe9, 0xe5, 0xe5, 0xff, 0xe9, 0xe7, 0xe7, 0xff, 0xe8, 0xe3, 0xe4, 0xff, 0xea, 0xe4, 0xe5, 0xff, 0xe8, 0xe3, 0xe4, 0xff, 0xe6, 0xe1, 0xe2, 0xff, 0xcd, 0xcb, 0xcd, 0xff, 0xc7, 0xc2, 0xc2, 0xff, 0xe2, 0xd4, 0xcb, 0xff, 0xe7, 0xd9, 0xd4, 0xff, 0xe7, 0xde, 0xda, 0xff, 0xe1, 0xda, 0xd6, 0xff, 0xdb, 0xd4, 0xd2, 0xff, 0xde, 0xd5, 0xd3, 0xff, 0xde, 0xd4, 0xd2, 0xff, 0xe3, 0xda, 0xd6, 0xff, 0xe1, 0xd4, 0xd1, 0xff, 0xe5, 0xd8, 0xd6, 0xff, 0xe7, 0xdb, 0xd9, 0xff, 0xdf, 0xd2, 0xcf, 0xff, 0xdd, 0xd1, 0xd0, 0xff, 0xd9, 0xd1, 0xd1, 0xff, 0xcc, 0xc5, 0xc6, 0xff, 0xd5, 0xca, 0xc1, 0xff, 0xd8, 0xca, 0xb9, 0xff, 0xd8, 0xc8, 0xb7, 0xff, 0xf1, 0xeb, 0xe1, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf9, 0xee, 0xff, 0xff, 0xf8, 0xed, 0xff, 0xf6, 0xea, 0xdf, 0xff, 0xe3, 0xd8, 0xd1, 0xff, 0xe4, 0xda, 0xd8, 0xff, 0xf1, 0xe7, 0xe7, 0xff, 0xf7, 0xed, 0xee, 0xff, 0xf3, 0xed, 0xea, 0xff, 0xf4, 0xee, 0xeb, 0xff, 0xf5, 0xee, 0xeb, 0xff, 0xf0, 0xeb, 0xea, 0xff, 0xec, 0xe7, 0xe7, 0xff, 0xeb, 0xe6, 0xe6, 0xff, 0xea, 0xe5, 0xe6, 0xff, 0xea, 0xe5, 0xe6, 0xff, 0xf0, 0xeb, 0xec, 0xff, 0xed, 0xe8, 0xe9, 0xff, 0xed, 0xe7, 0xe8, 0xff, 0xd9, 0xd5, 0xd6, 0xff, 0xcf, 0xcd, 0xd0, 0xff, 0xd8, 0xd7, 0xd9, 0xff, 0xe6, 0xe5, 0xe6, 0xff, 0xee, 0xee, 0xed, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xcb, 0xcf, 0xd2, 0xff, 0xbe, 0xc2, 0xc7, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xef, 0xef, 0xef, 0xff, 0xe0, 0xe1, 0xe1, 0xff, 0xd2, 0xd1, 0xd3, 0xff, 0xcf, 0xcf, 0xd1, 0xff, 0xbb, 0xbf, 0xc0, 0xff, 0xe4, 0xe1, 0xdf, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfb, 0xf5, 0xf1, 0xff, 0xe9, 0xe4, 0xe4, 0xff, 0xef, 0xea, 0xeb, 0xff, 0xf3, 0xef, 0xef, 0xff, 0xf4, 0xf0, 0xef, 0xff, 0xff, 0xfa, 0xf9, 0xff, 0xc2, 0xc1, 0xc0, 0xff, 0xa0, 0xa3, 0xa3, 0xff, 0xaf, 0xb2, 0xb3, 0xff, 0xaf, 0xb2, 0xb4, 0xff, 0xb1, 0xb3, 0xb3, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb3, 0xb7, 0xb6, 0xff, 0xb2, 0xb8, 0xb6, 0xff, 0xb3, 0xb7, 0xb6, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb2, 0xb7, 0xb8, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb7, 0xb7, 0xb7, 0x4b,
+    0xb9, 0xc1, 0xc1, 0x21, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbf, 0xbe, 0xff, 0xbe, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xb6, 0xb8, 0xba, 0xff, 0xa9, 0xaa, 0xaa, 0xff, 0xdf, 0xdb, 0xd9, 0xff, 0xd2, 0xc9, 0xc8, 0xff, 0xc2, 0xba, 0xb7, 0xff, 0xe1, 0xdb, 0xd8, 0xff, 0xf3, 0xef, 0xeb, 0xff, 0xf1, 0xec, 0xec, 0xff, 0xf0, 0xeb, 0xed, 0xff, 0xee, 0xeb, 0xec, 0xff, 0xec, 0xeb, 0xeb, 0xff, 0xe7, 0xe5, 0xe5, 0xff, 0xe7, 0xe4, 0xe5, 0xff, 0xeb, 0xe8, 0xe9, 0xff, 0xe5, 0xe3, 0xe3, 0xff, 0xe7, 0xe2, 0xe3, 0xff, 0xeb, 0xe6, 0xe7, 0xff, 0xe9, 0xe5, 0xe5, 0xff, 0xe7, 0xe2, 0xe3, 0xff, 0xdd, 0xdb, 0xdc, 0xff, 0xd7, 0xd4, 0xd5, 0xff, 0xe7, 0xdf, 0xde, 0xff, 0xea, 0xe3, 0xe2, 0xff, 0xe0, 0xd8, 0xd8, 0xff, 0xdb, 0xd6, 0xd5, 0xff, 0xd4, 0xcf, 0xcf, 0xff, 0xdb, 0xd4, 0xd5, 0xff, 0xdb, 0xd3, 0xd2, 0xff, 0xe9, 0xe0, 0xdd, 0xff, 0xe5, 0xdc, 0xd9, 0xff, 0xeb, 0xe0, 0xde, 0xff, 0xf4, 0xe7, 0xe3, 0xff, 0xe3, 0xd8, 0xd7, 0xff, 0xdb, 0xd2, 0xd4, 0xff, 0xd8, 0xd1, 0xd2, 0xff, 0xcf, 0xc6, 0xc9, 0xff, 0xd0, 0xc5, 0xc2, 0xff, 0xdf, 0xd2, 0xc4, 0xff, 0xd5, 0xc7, 0xb6, 0xff, 0xd5, 0xc7, 0xba, 0xff, 0xfa, 0xf6, 0xea, 0xff, 0xff, 0xf8, 0xec, 0xff, 0xf8, 0xed, 0xe3, 0xff, 0xe4, 0xd9, 0xd2, 0xff, 0xdc, 0xd4, 0xd0, 0xff, 0xea, 0xe4, 0xe2, 0xff, 0xf3, 0xed, 0xed, 0xff, 0xf4, 0xed, 0xed, 0xff, 0xf1, 0xec, 0xeb, 0xff, 0xf2, 0xed, 0xec, 0xff, 0xf1, 0xed, 0xec, 0xff, 0xee, 0xe8, 0xe9, 0xff, 0xed, 0xe7, 0xe8, 0xff, 0xe9, 0xe3, 0xe5, 0xff, 0xe8, 0xe3, 0xe4, 0xff, 0xe8, 0xe4, 0xe6, 0xff, 0xed, 0xe7, 0xe9, 0xff, 0xeb, 0xe7, 0xe8, 0xff, 0xea, 0xe8, 0xe7, 0xff, 0xdb, 0xd9, 0xd9, 0xff, 0xcd, 0xcd, 0xcf, 0xff, 0xd2, 0xd3, 0xd6, 0xff, 0xe4, 0xe3, 0xe5, 0xff, 0xed, 0xed, 0xec, 0xff, 0xe8, 0xe9, 0xe8, 0xff, 0xc4, 0xc9, 0xcc, 0xff, 0xbe, 0xc3, 0xc7, 0xff, 0xe3, 0xe2, 0xe3, 0xff, 0xee, 0xed, 0xed, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xcf, 0xcf, 0xd1, 0xff, 0xc8, 0xc7, 0xca, 0xff, 0xc5, 0xc2, 0xc3, 0xff, 0xf6, 0xf1, 0xed, 0xff, 0xfe, 0xfa, 0xf5, 0xff, 0xf1, 0xec, 0xea, 0xff, 0xe9, 0xe4, 0xe6, 0xff, 0xf2, 0xed, 0xee, 0xff, 0xf5, 0xf0, 0xf1, 0xff, 0xf4, 0xf0, 0xf0, 0xff, 0xfd, 0xf9, 0xf7, 0xff, 0xe9, 0xe5, 0xe4, 0xff, 0xa5, 0xa8, 0xa7, 0xff, 0xaa, 0xae, 0xaf, 0xff, 0xae, 0xb1, 0xb2, 0xff, 0xb0, 0xb2, 0xb2, 0xff, 0xb1, 0xb3, 0xb4, 0xff, 0xb2, 0xb4, 0xb5, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb2, 0xb6, 0xb6, 0xff, 0xb1, 0xb7, 0xb6, 0xff, 0xb2, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb8, 0xb8, 0xff, 0xb2, 0xb8, 0xb7, 0xff, 0xb1, 0xb7, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb4, 0xb8, 0xb9, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb1, 0xb9, 0xb9, 0x21,
+    0xff, 0xff, 0xff, 0x01, 0xbc, 0xbe, 0xbf, 0xf2, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbd, 0xbf, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbf, 0xff, 0xc0, 0xc3, 0xc4, 0xff, 0xb2, 0xb4, 0xb5, 0xff, 0x9a, 0x98, 0x98, 0xff, 0xd5, 0xd0, 0xd0, 0xff, 0xee, 0xe7, 0xe6, 0xff, 0xc9, 0xc1, 0xc0, 0xff, 0xd4, 0xca, 0xc7, 0xff, 0xf8, 0xf1, 0xed, 0xff, 0xf4, 0xef, 0xec, 0xff, 0xf1, 0xec, 0xec, 0xff, 0xf2, 0xec, 0xee, 0xff, 0xed, 0xeb, 0xeb, 0xff, 0xea, 0xe7, 0xe7, 0xff, 0xea, 0xe7, 0xe7, 0xff, 0xe5, 0xe5, 0xe4, 0xff, 0xe3, 0xe1, 0xe1, 0xff, 0xea, 0xe4, 0xe5, 0xff, 0xec, 0xe7, 0xe8, 0xff, 0xec, 0xe6, 0xe8, 0xff, 0xe4, 0xe0, 0xe1, 0xff, 0xdd, 0xdc, 0xdb, 0xff, 0xd2, 0xd0, 0xd0, 0xff, 0xe0, 0xda, 0xdc, 0xff, 0xe5, 0xe0, 0xe2, 0xff, 0xdb, 0xd6, 0xd7, 0xff, 0xd7, 0xd1, 0xd3, 0xff, 0xd0, 0xcb, 0xcd, 0xff, 0xd7, 0xd2, 0xd2, 0xff, 0xd9, 0xd4, 0xd5, 0xff, 0xe5, 0xe0, 0xdd, 0xff, 0xe6, 0xde, 0xdd, 0xff, 0xec, 0xe3, 0xe0, 0xff, 0xfc, 0xf1, 0xec, 0xff, 0xf0, 0xe5, 0xe4, 0xff, 0xe1, 0xd9, 0xd8, 0xff, 0xd9, 0xd1, 0xd2, 0xff, 0xd0, 0xc7, 0xc8, 0xff, 0xce, 0xc3, 0xbf, 0xff, 0xdd, 0xd1, 0xc2, 0xff, 0xe3, 0xd2, 0xbf, 0xff, 0xd0, 0xc1, 0xb2, 0xff, 0xe4, 0xda, 0xce, 0xff, 0xf9, 0xef, 0xe6, 0xff, 0xed, 0xe3, 0xd9, 0xff, 0xe3, 0xd9, 0xd4, 0xff, 0xe5, 0xdc, 0xdd, 0xff, 0xec, 0xe6, 0xe7, 0xff, 0xf2, 0xee, 0xed, 0xff, 0xf0, 0xeb, 0xea, 0xff, 0xed, 0xe9, 0xe8, 0xff, 0xf0, 0xeb, 0xeb, 0xff, 0xf2, 0xec, 0xeb, 0xff, 0xed, 0xe8, 0xe8, 0xff, 0xea, 0xe5, 0xe6, 0xff, 0xe9, 0xe3, 0xe4, 0xff, 0xe9, 0xe6, 0xe6, 0xff, 0xe7, 0xe5, 0xe5, 0xff, 0xe9, 0xe7, 0xe6, 0xff, 0xe6, 0xe5, 0xe5, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xda, 0xd9, 0xda, 0xff, 0xcb, 0xcb, 0xce, 0xff, 0xca, 0xcc, 0xd1, 0xff, 0xde, 0xdd, 0xe0, 0xff, 0xee, 0xeb, 0xeb, 0xff, 0xe0, 0xe1, 0xe2, 0xff, 0xb7, 0xbe, 0xc1, 0xff, 0xd3, 0xd6, 0xd7, 0xff, 0xf0, 0xee, 0xef, 0xff, 0xea, 0xe9, 0xeb, 0xff, 0xce, 0xcf, 0xd0, 0xff, 0xca, 0xcb, 0xcd, 0xff, 0xcc, 0xc9, 0xcb, 0xff, 0xd5, 0xd0, 0xcf, 0xff, 0xf5, 0xf0, 0xec, 0xff, 0xf0, 0xeb, 0xe8, 0xff, 0xf0, 0xec, 0xeb, 0xff, 0xea, 0xe5, 0xe6, 0xff, 0xf5, 0xf1, 0xf0, 0xff, 0xf6, 0xf1, 0xf1, 0xff, 0xf4, 0xf0, 0xf0, 0xff, 0xf4, 0xf0, 0xef, 0xff, 0xff, 0xfa, 0xf8, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0x9f, 0xa3, 0xa3, 0xff, 0xaf, 0xb1, 0xb1, 0xff, 0xb0, 0xb2, 0xb2, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb3, 0xb6, 0xb6, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb2, 0xb6, 0xb6, 0xff, 0xb3, 0xb6, 0xb6, 0xff, 0xb4, 0xb7, 0xb7, 0xff, 0xb3, 0xb8, 0xb7, 0xff, 0xb4, 0xb7, 0xb7, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb4, 0xb9, 0xb8, 0xff, 0xb4, 0xb9, 0xb9, 0xff, 0xb3, 0xb7, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb8, 0xb9, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb5, 0xb6, 0xb8, 0xff, 0xb5, 0xb6, 0xb8, 0xff, 0xb6, 0xb7, 0xb9, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xf2, 0xff, 0xff, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0xbd, 0xbe, 0xbf, 0xc6, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xb9, 0xbc, 0xbc, 0xff, 0xa3, 0xa2, 0xa3, 0xff, 0xaa, 0xa5, 0xa7, 0xff, 0xc5, 0xc0, 0xc2, 0xff, 0xef, 0xeb, 0xeb, 0xff, 0xd9, 0xd5, 0xd5, 0xff, 0xc9, 0xc1, 0xbf, 0xff, 0xf0, 0xe8, 0xe2, 0xff, 0xf9, 0xf5, 0xef, 0xff, 0xf2, 0xed, 0xec, 0xff, 0xf2, 0xec, 0xed, 0xff, 0xef, 0xea, 0xeb, 0xff, 0xef, 0xe9, 0xea, 0xff, 0xec, 0xe7, 0xe8, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe5, 0xe3, 0xe3, 0xff, 0xeb, 0xe5, 0xe6, 0xff, 0xee, 0xe9, 0xea, 0xff, 0xeb, 0xe6, 0xe7, 0xff, 0xe1, 0xdd, 0xde, 0xff, 0xd9, 0xd8, 0xd8, 0xff, 0xdb, 0xd9, 0xd9, 0xff, 0xe5, 0xe1, 0xe2, 0xff, 0xe3, 0xde, 0xdf, 0xff, 0xdd, 0xd8, 0xd9, 0xff, 0xd6, 0xd1, 0xd4, 0xff, 0xce, 0xc9, 0xcc, 0xff, 0xd1, 0xcc, 0xcd, 0xff, 0xd7, 0xd3, 0xd4, 0xff, 0xe3, 0xde, 0xdd, 0xff, 0xe8, 0xe2, 0xe2, 0xff, 0xeb, 0xe4, 0xe2, 0xff, 0xf8, 0xef, 0xea, 0xff, 0xf7, 0xee, 0xea, 0xff, 0xe9, 0xe1, 0xdd, 0xff, 0xde, 0xd7, 0xd5, 0xff, 0xcf, 0xc7, 0xc8, 0xff, 0xd0, 0xc5, 0xc2, 0xff, 0xe1, 0xd5, 0xca, 0xff, 0xe0, 0xd1, 0xc2, 0xff, 0xd1, 0xc0, 0xb4, 0xff, 0xdf, 0xd2, 0xc8, 0xff, 0xfb, 0xf1, 0xe9, 0xff, 0xef, 0xe5, 0xdd, 0xff, 0xea, 0xe0, 0xdd, 0xff, 0xe7, 0xdf, 0xe0, 0xff, 0xed, 0xe8, 0xe7, 0xff, 0xf1, 0xed, 0xeb, 0xff, 0xee, 0xea, 0xe8, 0xff, 0xec, 0xe6, 0xe7, 0xff, 0xef, 0xe9, 0xea, 0xff, 0xf2, 0xec, 0xed, 0xff, 0xed, 0xe8, 0xe9, 0xff, 0xe7, 0xe2, 0xe3, 0xff, 0xe6, 0xe1, 0xe2, 0xff, 0xe5, 0xe2, 0xe2, 0xff, 0xe3, 0xe1, 0xe1, 0xff, 0xe3, 0xe2, 0xe1, 0xff, 0xe1, 0xe1, 0xe2, 0xff, 0xe1, 0xdf, 0xe2, 0xff, 0xdc, 0xda, 0xdc, 0xff, 0xce, 0xce, 0xd0, 0xff, 0xc3, 0xc6, 0xc9, 0xff, 0xd9, 0xd9, 0xdb, 0xff, 0xf0, 0xef, 0xee, 0xff, 0xd2, 0xd3, 0xd6, 0xff, 0xbb, 0xbf, 0xc4, 0xff, 0xed, 0xec, 0xed, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xe5, 0xe4, 0xe6, 0xff, 0xc0, 0xbf, 0xc2, 0xff, 0xd5, 0xd3, 0xd5, 0xff, 0xd9, 0xd5, 0xd5, 0xff, 0xe0, 0xdd, 0xd7, 0xff, 0xee, 0xe9, 0xe5, 0xff, 0xeb, 0xe6, 0xe4, 0xff, 0xf2, 0xee, 0xed, 0xff, 0xec, 0xe8, 0xe7, 0xff, 0xf7, 0xf4, 0xf2, 0xff, 0xf4, 0xef, 0xef, 0xff, 0xf4, 0xef, 0xf0, 0xff, 0xf2, 0xef, 0xee, 0xff, 0xff, 0xfb, 0xfa, 0xff, 0xd9, 0xd6, 0xd6, 0xff, 0x9f, 0xa1, 0xa1, 0xff, 0xae, 0xb0, 0xb0, 0xff, 0xb1, 0xb2, 0xb2, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb3, 0xb4, 0xb4, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb6, 0xb7, 0xb6, 0xff, 0xb4, 0xb5, 0xb6, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb2, 0xb8, 0xb7, 0xff, 0xb3, 0xb8, 0xb8, 0xff, 0xb3, 0xb6, 0xb8, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb6, 0xb9, 0xb9, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb5, 0xb8, 0xb8, 0xff, 0xb4, 0xb8, 0xb7, 0xff, 0xb5, 0xb8, 0xb8, 0xff, 0xb6, 0xb7, 0xb8, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x90, 0xbe, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xbf, 0xff, 0xbe, 0xc0, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbd, 0xff, 0xc1, 0xc4, 0xc3, 0xff, 0xb2, 0xb5, 0xb5, 0xff, 0x93, 0x8f, 0x92, 0xff, 0xb2, 0xab, 0xae, 0xff, 0xc9, 0xc3, 0xc5, 0xff, 0xea, 0xe3, 0xe4, 0xff, 0xeb, 0xe6, 0xe5, 0xff, 0xc3, 0xbc, 0xba, 0xff, 0xdb, 0xd1, 0xcd, 0xff, 0xff, 0xfa, 0xf4, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xef, 0xea, 0xe9, 0xff, 0xed, 0xe8, 0xea, 0xff, 0xef, 0xea, 0xec, 0xff, 0xec, 0xe7, 0xe8, 0xff, 0xe5, 0xe3, 0xe3, 0xff, 0xe6, 0xe4, 0xe4, 0xff, 0xeb, 0xe6, 0xe7, 0xff, 0xee, 0xe9, 0xea, 0xff, 0xe9, 0xe4, 0xe5, 0xff, 0xe1, 0xdd, 0xdd, 0xff, 0xde, 0xdc, 0xdc, 0xff, 0xdb, 0xd9, 0xd9, 0xff, 0xdf, 0xde, 0xdd, 0xff, 0xe0, 0xdb, 0xdc, 0xff, 0xe1, 0xdb, 0xdc, 0xff, 0xd7, 0xd1, 0xd4, 0xff, 0xcb, 0xc5, 0xc9, 0xff, 0xcd, 0xc8, 0xc9, 0xff, 0xd5, 0xcf, 0xd1, 0xff, 0xe1, 0xdc, 0xdc, 0xff, 0xe6, 0xe2, 0xe0, 0xff, 0xe6, 0xe0, 0xdf, 0xff, 0xf2, 0xea, 0xe6, 0xff, 0xf8, 0xef, 0xeb, 0xff, 0xee, 0xe6, 0xe2, 0xff, 0xe2, 0xdb, 0xda, 0xff, 0xcf, 0xc7, 0xc8, 0xff, 0xd4, 0xcb, 0xc7, 0xff, 0xe9, 0xde, 0xd5, 0xff, 0xe6, 0xd9, 0xcb, 0xff, 0xd4, 0xc4, 0xb7, 0xff, 0xda, 0xce, 0xc2, 0xff, 0xfb, 0xf2, 0xe8, 0xff, 0xf5, 0xe9, 0xe1, 0xff, 0xe7, 0xde, 0xdb, 0xff, 0xe4, 0xdd, 0xde, 0xff, 0xee, 0xe8, 0xe8, 0xff, 0xee, 0xe9, 0xe8, 0xff, 0xed, 0xe8, 0xe8, 0xff, 0xeb, 0xe5, 0xe6, 0xff, 0xef, 0xe9, 0xea, 0xff, 0xf2, 0xed, 0xee, 0xff, 0xee, 0xe9, 0xea, 0xff, 0xe8, 0xe2, 0xe3, 0xff, 0xe4, 0xe2, 0xe1, 0xff, 0xe2, 0xdf, 0xe1, 0xff, 0xe1, 0xde, 0xe0, 0xff, 0xdd, 0xdc, 0xde, 0xff, 0xe0, 0xdf, 0xe1, 0xff, 0xdf, 0xdf, 0xe1, 0xff, 0xdf, 0xdd, 0xe0, 0xff, 0xd1, 0xd1, 0xd2, 0xff, 0xc0, 0xc3, 0xc3, 0xff, 0xd1, 0xd1, 0xd2, 0xff, 0xeb, 0xea, 0xea, 0xff, 0xce, 0xd1, 0xd2, 0xff, 0xd0, 0xd2, 0xd4, 0xff, 0xf9, 0xf5, 0xf4, 0xff, 0xf1, 0xef, 0xef, 0xff, 0xd9, 0xd8, 0xda, 0xff, 0xbd, 0xbb, 0xbd, 0xff, 0xe5, 0xe1, 0xdf, 0xff, 0xdd, 0xd9, 0xd5, 0xff, 0xea, 0xe7, 0xe1, 0xff, 0xe7, 0xe2, 0xe0, 0xff, 0xec, 0xe7, 0xe6, 0xff, 0xf3, 0xef, 0xee, 0xff, 0xef, 0xeb, 0xea, 0xff, 0xf6, 0xf3, 0xf1, 0xff, 0xf2, 0xee, 0xef, 0xff, 0xf3, 0xed, 0xef, 0xff, 0xf3, 0xee, 0xef, 0xff, 0xf8, 0xf4, 0xf3, 0xff, 0xf0, 0xec, 0xeb, 0xff, 0xad, 0xae, 0xae, 0xff, 0xa7, 0xac, 0xab, 0xff, 0xb1, 0xb2, 0xb2, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb2, 0xb5, 0xb5, 0xff, 0xb3, 0xb6, 0xb6, 0xff, 0xb7, 0xb6, 0xb6, 0xff, 0xb5, 0xb6, 0xb6, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xb4, 0xb7, 0xb6, 0xff, 0xb4, 0xb7, 0xb7, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb6, 0xb7, 0xb8, 0xff, 0xb6, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb4, 0xba, 0xb8, 0xff, 0xb2, 0xb9, 0xb7, 0xff, 0xb2, 0xb9, 0xb7, 0xff, 0xb4, 0xb8, 0xb8, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x58, 0xbe, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xc3, 0xc6, 0xc7, 0xff, 0xad, 0xaf, 0xae, 0xff, 0xa1, 0x9e, 0x9f, 0xff, 0xa3, 0x9e, 0x9f, 0xff, 0xbe, 0xb9, 0xb9, 0xff, 0xe1, 0xdb, 0xdc, 0xff, 0xf8, 0xf2, 0xf0, 0xff, 0xd4, 0xce, 0xca, 0xff, 0xc4, 0xbd, 0xb7, 0xff, 0xfb, 0xf4, 0xee, 0xff, 0xf8, 0xf4, 0xef, 0xff, 0xf0, 0xeb, 0xe9, 0xff, 0xee, 0xea, 0xeb, 0xff, 0xef, 0xeb, 0xed, 0xff, 0xed, 0xe8, 0xe9, 0xff, 0xe9, 0xe3, 0xe4, 0xff, 0xe5, 0xe1, 0xe2, 0xff, 0xe9, 0xe6, 0xe7, 0xff, 0xee, 0xeb, 0xeb, 0xff, 0xe8, 0xe2, 0xe3, 0xff, 0xe2, 0xde, 0xdf, 0xff, 0xe1, 0xdf, 0xdf, 0xff, 0xdb, 0xd8, 0xd8, 0xff, 0xdf, 0xdd, 0xdd, 0xff, 0xdd, 0xd8, 0xd9, 0xff, 0xe4, 0xde, 0xdf, 0xff, 0xdb, 0xd5, 0xd6, 0xff, 0xca, 0xc5, 0xc7, 0xff, 0xcc, 0xc7, 0xc9, 0xff, 0xd5, 0xd0, 0xd2, 0xff, 0xdc, 0xd7, 0xd8, 0xff, 0xe2, 0xdd, 0xdd, 0xff, 0xe3, 0xde, 0xdf, 0xff, 0xf0, 0xe8, 0xe5, 0xff, 0xf9, 0xf1, 0xec, 0xff, 0xf1, 0xea, 0xe7, 0xff, 0xe5, 0xde, 0xde, 0xff, 0xd5, 0xcc, 0xcb, 0xff, 0xd7, 0xca, 0xc7, 0xff, 0xe7, 0xdd, 0xd5, 0xff, 0xf0, 0xe7, 0xd9, 0xff, 0xe4, 0xd4, 0xc7, 0xff, 0xd2, 0xc5, 0xb9, 0xff, 0xf0, 0xe7, 0xdb, 0xff, 0xfb, 0xef, 0xe4, 0xff, 0xde, 0xd6, 0xd2, 0xff, 0xdc, 0xd8, 0xd8, 0xff, 0xe8, 0xe3, 0xe4, 0xff, 0xec, 0xe6, 0xe7, 0xff, 0xeb, 0xe5, 0xe6, 0xff, 0xeb, 0xe6, 0xe7, 0xff, 0xed, 0xe8, 0xe9, 0xff, 0xf2, 0xec, 0xed, 0xff, 0xec, 0xe7, 0xe8, 0xff, 0xe4, 0xe1, 0xe2, 0xff, 0xdf, 0xdd, 0xdf, 0xff, 0xe0, 0xdf, 0xe0, 0xff, 0xdf, 0xde, 0xe0, 0xff, 0xdb, 0xd9, 0xdc, 0xff, 0xde, 0xde, 0xe0, 0xff, 0xde, 0xdf, 0xe0, 0xff, 0xdf, 0xde, 0xe0, 0xff, 0xd5, 0xd4, 0xd6, 0xff, 0xc2, 0xc4, 0xc5, 0xff, 0xcc, 0xcc, 0xce, 0xff, 0xe2, 0xe0, 0xe2, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xee, 0xea, 0xea, 0xff, 0xf8, 0xf2, 0xf3, 0xff, 0xf2, 0xed, 0xee, 0xff, 0xc7, 0xc7, 0xc8, 0xff, 0xc6, 0xc5, 0xc5, 0xff, 0xf1, 0xed, 0xe9, 0xff, 0xde, 0xd9, 0xd5, 0xff, 0xf5, 0xef, 0xea, 0xff, 0xe4, 0xde, 0xde, 0xff, 0xe9, 0xe3, 0xe4, 0xff, 0xf6, 0xf1, 0xf0, 0xff, 0xf2, 0xed, 0xed, 0xff, 0xf3, 0xee, 0xef, 0xff, 0xf3, 0xee, 0xee, 0xff, 0xf4, 0xef, 0xef, 0xff, 0xf5, 0xef, 0xf1, 0xff, 0xf4, 0xf0, 0xef, 0xff, 0xfd, 0xf7, 0xf6, 0xff, 0xbe, 0xbe, 0xbc, 0xff, 0x9f, 0xa5, 0xa4, 0xff, 0xb1, 0xb2, 0xb3, 0xff, 0xb2, 0xb4, 0xb5, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb1, 0xb6, 0xb6, 0xff, 0xb6, 0xb6, 0xb5, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb2, 0xb7, 0xb6, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb5, 0xb6, 0xb6, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb6, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb6, 0xb6, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x1b, 0xbf, 0xc1, 0xc1, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc1, 0xc0, 0xff, 0xbf, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbe, 0xc0, 0xc2, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0x9d, 0x9c, 0x9c, 0xff, 0xbb, 0xb6, 0xb8, 0xff, 0xae, 0xa9, 0xac, 0xff, 0xa4, 0x9f, 0xa0, 0xff, 0xc9, 0xc3, 0xc4, 0xff, 0xf1, 0xec, 0xeb, 0xff, 0xea, 0xe5, 0xe1, 0xff, 0xc2, 0xb9, 0xb1, 0xff, 0xed, 0xe5, 0xde, 0xff, 0xfe, 0xf9, 0xf5, 0xff, 0xf4, 0xef, 0xeb, 0xff, 0xf1, 0xec, 0xeb, 0xff, 0xf0, 0xeb, 0xec, 0xff, 0xec, 0xe7, 0xe8, 0xff, 0xe6, 0xe2, 0xe3, 0xff, 0xe4, 0xe2, 0xe2, 0xff, 0xea, 0xe6, 0xe7, 0xff, 0xec, 0xe7, 0xe8, 0xff, 0xe5, 0xe1, 0xe2, 0xff, 0xe1, 0xe0, 0xe0, 0xff, 0xe3, 0xe1, 0xe0, 0xff, 0xdf, 0xdd, 0xdd, 0xff, 0xdc, 0xdb, 0xdb, 0xff, 0xdc, 0xda, 0xda, 0xff, 0xe4, 0xe0, 0xe1, 0xff, 0xdd, 0xda, 0xda, 0xff, 0xcb, 0xc8, 0xc8, 0xff, 0xcb, 0xc6, 0xc9, 0xff, 0xd0, 0xcc, 0xce, 0xff, 0xd5, 0xd0, 0xd2, 0xff, 0xdf, 0xda, 0xdb, 0xff, 0xe6, 0xe1, 0xe1, 0xff, 0xf0, 0xea, 0xe7, 0xff, 0xf6, 0xef, 0xeb, 0xff, 0xf3, 0xec, 0xe8, 0xff, 0xe8, 0xe0, 0xe1, 0xff, 0xdb, 0xd2, 0xd1, 0xff, 0xdc, 0xd1, 0xcc, 0xff, 0xe8, 0xde, 0xd6, 0xff, 0xf1, 0xe6, 0xda, 0xff, 0xf7, 0xe7, 0xd9, 0xff, 0xdb, 0xcd, 0xbf, 0xff, 0xe2, 0xd8, 0xcd, 0xff, 0xed, 0xe3, 0xd9, 0xff, 0xd3, 0xcb, 0xc9, 0xff, 0xdc, 0xd7, 0xd8, 0xff, 0xe6, 0xe0, 0xe1, 0xff, 0xed, 0xe7, 0xe9, 0xff, 0xef, 0xe9, 0xea, 0xff, 0xed, 0xe8, 0xe9, 0xff, 0xec, 0xe7, 0xe8, 0xff, 0xef, 0xe9, 0xeb, 0xff, 0xeb, 0xe8, 0xe8, 0xff, 0xe0, 0xdf, 0xdf, 0xff, 0xdb, 0xda, 0xdc, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe0, 0xdf, 0xe0, 0xff, 0xdc, 0xdb, 0xdd, 0xff, 0xdf, 0xde, 0xe0, 0xff, 0xe1, 0xe0, 0xe2, 0xff, 0xde, 0xdd, 0xdf, 0xff, 0xda, 0xd9, 0xdb, 0xff, 0xc8, 0xc9, 0xcb, 0xff, 0xcb, 0xcc, 0xce, 0xff, 0xe0, 0xdf, 0xdf, 0xff, 0xf2, 0xf0, 0xef, 0xff, 0xf6, 0xf0, 0xf1, 0xff, 0xf7, 0xf1, 0xf3, 0xff, 0xe7, 0xe3, 0xe5, 0xff, 0xbd, 0xbd, 0xbe, 0xff, 0xdc, 0xda, 0xd8, 0xff, 0xef, 0xea, 0xe6, 0xff, 0xe3, 0xde, 0xdb, 0xff, 0xfb, 0xf4, 0xf0, 0xff, 0xdf, 0xd8, 0xd9, 0xff, 0xe7, 0xe1, 0xe2, 0xff, 0xf7, 0xf3, 0xf1, 0xff, 0xf1, 0xec, 0xee, 0xff, 0xf2, 0xec, 0xee, 0xff, 0xf3, 0xef, 0xee, 0xff, 0xf5, 0xf1, 0xf0, 0xff, 0xf5, 0xf0, 0xf1, 0xff, 0xf3, 0xee, 0xee, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xd0, 0xce, 0xcd, 0xff, 0x9d, 0xa1, 0xa1, 0xff, 0xb1, 0xb2, 0xb4, 0xff, 0xb1, 0xb3, 0xb4, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb2, 0xb5, 0xb5, 0xff, 0xb4, 0xb6, 0xb5, 0xff, 0xb5, 0xb6, 0xb5, 0xff, 0xb3, 0xb6, 0xb6, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb2, 0xb7, 0xb8, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb6, 0xb6, 0xb5, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb2, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb6, 0xb7, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb3, 0xb3, 0xb3, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xc1, 0xc1, 0xd7, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xc3, 0xc5, 0xc6, 0xff, 0xac, 0xb0, 0xb0, 0xff, 0x92, 0x8f, 0x8f, 0xff, 0xc3, 0xbe, 0xbf, 0xff, 0xcc, 0xc7, 0xc9, 0xff, 0xb2, 0xad, 0xb0, 0xff, 0xaa, 0xa5, 0xa6, 0xff, 0xd4, 0xce, 0xce, 0xff, 0xfb, 0xf3, 0xf2, 0xff, 0xcb, 0xc4, 0xbd, 0xff, 0xd5, 0xcd, 0xc7, 0xff, 0xff, 0xfa, 0xf6, 0xff, 0xf6, 0xf0, 0xeb, 0xff, 0xf3, 0xee, 0xeb, 0xff, 0xf2, 0xed, 0xed, 0xff, 0xec, 0xe8, 0xea, 0xff, 0xe8, 0xe7, 0xe6, 0xff, 0xe6, 0xe5, 0xe5, 0xff, 0xe6, 0xe3, 0xe3, 0xff, 0xe8, 0xe2, 0xe3, 0xff, 0xe9, 0xe5, 0xe5, 0xff, 0xe6, 0xe2, 0xe3, 0xff, 0xe4, 0xde, 0xe0, 0xff, 0xe2, 0xde, 0xde, 0xff, 0xde, 0xdc, 0xdc, 0xff, 0xda, 0xd9, 0xd8, 0xff, 0xe2, 0xe1, 0xe0, 0xff, 0xdf, 0xde, 0xde, 0xff, 0xcc, 0xca, 0xca, 0xff, 0xcd, 0xca, 0xcb, 0xff, 0xce, 0xcc, 0xce, 0xff, 0xd1, 0xcc, 0xce, 0xff, 0xdf, 0xda, 0xdb, 0xff, 0xe9, 0xe4, 0xe5, 0xff, 0xee, 0xe9, 0xe7, 0xff, 0xf4, 0xee, 0xe9, 0xff, 0xf4, 0xed, 0xea, 0xff, 0xeb, 0xe3, 0xe3, 0xff, 0xde, 0xd6, 0xd3, 0xff, 0xe0, 0xd5, 0xd0, 0xff, 0xef, 0xe3, 0xda, 0xff, 0xf2, 0xe7, 0xda, 0xff, 0xca, 0xce, 0xca, 0xff, 0xc8, 0xca, 0xc8, 0xff, 0xe1, 0xd7, 0xca, 0xff, 0xd9, 0xcf, 0xc6, 0xff, 0xd1, 0xca, 0xca, 0xff, 0xe1, 0xdc, 0xde, 0xff, 0xe8, 0xe2, 0xe3, 0xff, 0xef, 0xe9, 0xea, 0xff, 0xed, 0xe7, 0xe8, 0xff, 0xee, 0xe9, 0xea, 0xff, 0xec, 0xe7, 0xe8, 0xff, 0xec, 0xe8, 0xe8, 0xff, 0xea, 0xe8, 0xe7, 0xff, 0xe1, 0xdf, 0xe0, 0xff, 0xdd, 0xdc, 0xde, 0xff, 0xdf, 0xde, 0xe0, 0xff, 0xdc, 0xdc, 0xde, 0xff, 0xd9, 0xdc, 0xde, 0xff, 0xda, 0xdb, 0xdd, 0xff, 0xe1, 0xe0, 0xe2, 0xff, 0xe2, 0xe1, 0xe3, 0xff, 0xdf, 0xdd, 0xde, 0xff, 0xcd, 0xcc, 0xd0, 0xff, 0xcf, 0xcf, 0xd2, 0xff, 0xe4, 0xe2, 0xe1, 0xff, 0xf1, 0xed, 0xed, 0xff, 0xf4, 0xef, 0xf0, 0xff, 0xf5, 0xef, 0xf0, 0xff, 0xd5, 0xd0, 0xd3, 0xff, 0xc6, 0xc3, 0xc6, 0xff, 0xed, 0xe8, 0xe3, 0xff, 0xe6, 0xe1, 0xdc, 0xff, 0xeb, 0xe6, 0xe3, 0xff, 0xf8, 0xf2, 0xef, 0xff, 0xd9, 0xd2, 0xd4, 0xff, 0xe8, 0xe4, 0xe4, 0xff, 0xf8, 0xf5, 0xf2, 0xff, 0xf0, 0xeb, 0xed, 0xff, 0xf2, 0xed, 0xee, 0xff, 0xf4, 0xf0, 0xf0, 0xff, 0xf6, 0xf2, 0xf2, 0xff, 0xf6, 0xf1, 0xf2, 0xff, 0xf4, 0xef, 0xef, 0xff, 0xfe, 0xfa, 0xf9, 0xff, 0xe1, 0xdd, 0xdd, 0xff, 0xa4, 0xa6, 0xa6, 0xff, 0xae, 0xb1, 0xb2, 0xff, 0xb1, 0xb3, 0xb4, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb5, 0xb6, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb7, 0xb6, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb5, 0xb6, 0xb6, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb6, 0xb7, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xc0, 0xc0, 0x8e, 0xbf, 0xc0, 0xc1, 0xff, 0xbf, 0xc0, 0xc1, 0xff, 0xbf, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xc5, 0xc7, 0xc8, 0xff, 0xa2, 0xa2, 0xa2, 0xff, 0x98, 0x93, 0x94, 0xff, 0xc3, 0xbd, 0xbf, 0xff, 0xd7, 0xd1, 0xd2, 0xff, 0xcc, 0xc7, 0xc8, 0xff, 0xad, 0xa9, 0xaa, 0xff, 0xb6, 0xb0, 0xb2, 0xff, 0xea, 0xe4, 0xe2, 0xff, 0xe8, 0xe2, 0xdf, 0xff, 0xcd, 0xc5, 0xc0, 0xff, 0xfa, 0xf1, 0xea, 0xff, 0xf9, 0xf1, 0xec, 0xff, 0xf5, 0xf0, 0xeb, 0xff, 0xf2, 0xee, 0xeb, 0xff, 0xf0, 0xec, 0xed, 0xff, 0xeb, 0xe7, 0xe7, 0xff, 0xe7, 0xe3, 0xe4, 0xff, 0xe7, 0xe2, 0xe3, 0xff, 0xe9, 0xe4, 0xe5, 0xff, 0xeb, 0xe6, 0xe7, 0xff, 0xe6, 0xe1, 0xe2, 0xff, 0xe2, 0xdd, 0xdd, 0xff, 0xe3, 0xe0, 0xe1, 0xff, 0xe0, 0xdd, 0xdd, 0xff, 0xdc, 0xda, 0xda, 0xff, 0xe4, 0xe2, 0xe2, 0xff, 0xdf, 0xdd, 0xdd, 0xff, 0xce, 0xcc, 0xcc, 0xff, 0xcf, 0xcd, 0xcd, 0xff, 0xcd, 0xca, 0xcc, 0xff, 0xcc, 0xc8, 0xcc, 0xff, 0xdb, 0xd6, 0xd8, 0xff, 0xe6, 0xe2, 0xe1, 0xff, 0xec, 0xe8, 0xe7, 0xff, 0xf4, 0xed, 0xeb, 0xff, 0xf4, 0xed, 0xe9, 0xff, 0xef, 0xe8, 0xe8, 0xff, 0xde, 0xd7, 0xd6, 0xff, 0xdf, 0xd6, 0xd0, 0xff, 0xf9, 0xeb, 0xe0, 0xff, 0xe0, 0xdd, 0xd5, 0xff, 0x9b, 0xb1, 0xb7, 0xff, 0xb7, 0xc8, 0xcc, 0xff, 0xe4, 0xde, 0xd3, 0xff, 0xdb, 0xcf, 0xc8, 0xff, 0xc9, 0xc4, 0xc6, 0xff, 0xe6, 0xe1, 0xe1, 0xff, 0xea, 0xe5, 0xe5, 0xff, 0xec, 0xe7, 0xe8, 0xff, 0xeb, 0xe6, 0xe7, 0xff, 0xec, 0xe7, 0xe8, 0xff, 0xea, 0xe6, 0xe6, 0xff, 0xea, 0xe9, 0xe8, 0xff, 0xea, 0xe8, 0xe8, 0xff, 0xe0, 0xde, 0xde, 0xff, 0xdc, 0xdb, 0xdd, 0xff, 0xdd, 0xdc, 0xde, 0xff, 0xda, 0xdc, 0xdd, 0xff, 0xdb, 0xdc, 0xdf, 0xff, 0xdc, 0xdc, 0xdf, 0xff, 0xe0, 0xe0, 0xe1, 0xff, 0xe3, 0xe1, 0xe3, 0xff, 0xe2, 0xde, 0xdf, 0xff, 0xca, 0xca, 0xcf, 0xff, 0xd3, 0xd2, 0xd5, 0xff, 0xeb, 0xe8, 0xe7, 0xff, 0xf2, 0xec, 0xee, 0xff, 0xf6, 0xf1, 0xf2, 0xff, 0xea, 0xe6, 0xe6, 0xff, 0xc5, 0xc2, 0xc3, 0xff, 0xd7, 0xd3, 0xd2, 0xff, 0xf2, 0xec, 0xe6, 0xff, 0xe6, 0xe0, 0xdb, 0xff, 0xf4, 0xee, 0xea, 0xff, 0xef, 0xea, 0xe6, 0xff, 0xd4, 0xcf, 0xd0, 0xff, 0xee, 0xea, 0xea, 0xff, 0xf8, 0xf4, 0xf2, 0xff, 0xf0, 0xeb, 0xec, 0xff, 0xf3, 0xee, 0xef, 0xff, 0xf4, 0xf0, 0xee, 0xff, 0xf5, 0xf0, 0xf1, 0xff, 0xf6, 0xf1, 0xf1, 0xff, 0xf5, 0xf0, 0xf0, 0xff, 0xfb, 0xf7, 0xf6, 0xff, 0xed, 0xea, 0xe9, 0xff, 0xab, 0xac, 0xad, 0xff, 0xac, 0xae, 0xae, 0xff, 0xb1, 0xb3, 0xb4, 0xff, 0xb2, 0xb5, 0xb6, 0xff, 0xb5, 0xb5, 0xb7, 0xff, 0xb6, 0xb6, 0xb7, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb2, 0xb8, 0xb6, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb6, 0xb5, 0xb7, 0xff, 0xb5, 0xb6, 0xb6, 0xff, 0xb4, 0xb7, 0xb7, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb6, 0xb6, 0xb7, 0xff, 0xb5, 0xb6, 0xb8, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb7, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xc1, 0xc1, 0x46, 0xbd, 0xc0, 0xc0, 0xff, 0xbd, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc2, 0xff, 0x99, 0x98, 0x98, 0xff, 0xa5, 0xa0, 0xa1, 0xff, 0xbf, 0xba, 0xbc, 0xff, 0xd9, 0xd3, 0xd5, 0xff, 0xdb, 0xd3, 0xd6, 0xff, 0xc5, 0xc0, 0xc3, 0xff, 0xaf, 0xab, 0xac, 0xff, 0xce, 0xc8, 0xc7, 0xff, 0xfa, 0xf3, 0xf1, 0xff, 0xe0, 0xd9, 0xd4, 0xff, 0xee, 0xe5, 0xdd, 0xff, 0xfc, 0xf4, 0xed, 0xff, 0xf5, 0xef, 0xe8, 0xff, 0xf3, 0xef, 0xe9, 0xff, 0xf1, 0xec, 0xed, 0xff, 0xeb, 0xe6, 0xe7, 0xff, 0xe6, 0xe0, 0xe1, 0xff, 0xe9, 0xe4, 0xe5, 0xff, 0xe9, 0xe4, 0xe5, 0xff, 0xe8, 0xe3, 0xe4, 0xff, 0xe6, 0xe0, 0xe1, 0xff, 0xe3, 0xde, 0xdf, 0xff, 0xe5, 0xe1, 0xe2, 0xff, 0xe3, 0xde, 0xdf, 0xff, 0xe0, 0xde, 0xde, 0xff, 0xe2, 0xe0, 0xe0, 0xff, 0xde, 0xdc, 0xdc, 0xff, 0xd2, 0xd0, 0xd0, 0xff, 0xd0, 0xce, 0xcf, 0xff, 0xce, 0xcb, 0xce, 0xff, 0xcb, 0xc7, 0xc9, 0xff, 0xd6, 0xd0, 0xd2, 0xff, 0xe4, 0xe0, 0xe0, 0xff, 0xeb, 0xe7, 0xe6, 0xff, 0xf1, 0xeb, 0xe9, 0xff, 0xf5, 0xed, 0xea, 0xff, 0xf1, 0xeb, 0xea, 0xff, 0xde, 0xd8, 0xd9, 0xff, 0xe4, 0xdb, 0xd5, 0xff, 0xf8, 0xee, 0xe2, 0xff, 0xe9, 0xe4, 0xdd, 0xff, 0xb5, 0xc2, 0xc2, 0xff, 0xd7, 0xd9, 0xd6, 0xff, 0xe2, 0xd8, 0xce, 0xff, 0xd3, 0xcc, 0xc5, 0xff, 0xd1, 0xcb, 0xcd, 0xff, 0xeb, 0xe5, 0xe5, 0xff, 0xea, 0xe5, 0xe4, 0xff, 0xec, 0xe7, 0xe8, 0xff, 0xed, 0xe9, 0xea, 0xff, 0xeb, 0xe6, 0xe7, 0xff, 0xe4, 0xe2, 0xe2, 0xff, 0xe8, 0xe6, 0xe6, 0xff, 0xeb, 0xe9, 0xe9, 0xff, 0xe2, 0xe1, 0xe0, 0xff, 0xdc, 0xdb, 0xdc, 0xff, 0xe0, 0xdf, 0xe2, 0xff, 0xde, 0xde, 0xe0, 0xff, 0xde, 0xdd, 0xdf, 0xff, 0xe1, 0xdf, 0xe1, 0xff, 0xe1, 0xe0, 0xe2, 0xff, 0xe6, 0xe3, 0xe4, 0xff, 0xe2, 0xde, 0xe0, 0xff, 0xc7, 0xc7, 0xcc, 0xff, 0xda, 0xd9, 0xda, 0xff, 0xf0, 0xed, 0xec, 0xff, 0xf2, 0xed, 0xee, 0xff, 0xf6, 0xf1, 0xf1, 0xff, 0xdd, 0xd7, 0xd9, 0xff, 0xc7, 0xc3, 0xc3, 0xff, 0xe6, 0xe1, 0xdd, 0xff, 0xf0, 0xe9, 0xe4, 0xff, 0xe9, 0xe3, 0xdf, 0xff, 0xfa, 0xf3, 0xee, 0xff, 0xe4, 0xdf, 0xdc, 0xff, 0xd3, 0xcf, 0xd0, 0xff, 0xf3, 0xef, 0xee, 0xff, 0xf6, 0xf2, 0xf1, 0xff, 0xf0, 0xea, 0xec, 0xff, 0xf2, 0xed, 0xee, 0xff, 0xf4, 0xf0, 0xef, 0xff, 0xf5, 0xf1, 0xf0, 0xff, 0xf3, 0xef, 0xef, 0xff, 0xf5, 0xf1, 0xf0, 0xff, 0xfb, 0xf7, 0xf6, 0xff, 0xf2, 0xee, 0xec, 0xff, 0xae, 0xaf, 0xb0, 0xff, 0xab, 0xad, 0xae, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb2, 0xb4, 0xb5, 0xff, 0xb3, 0xb4, 0xb5, 0xff, 0xb5, 0xb6, 0xb8, 0xff, 0xb6, 0xb8, 0xb8, 0xff, 0xb3, 0xb6, 0xb6, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb3, 0xb8, 0xb6, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb6, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb6, 0xb6, 0x07, 0xbe, 0xc0, 0xc0, 0xef, 0xbf, 0xc0, 0xc0, 0xff, 0xbf, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0x95, 0x92, 0x93, 0xff, 0xb4, 0xaf, 0xb0, 0xff, 0xbc, 0xb9, 0xbb, 0xff, 0xd5, 0xce, 0xd0, 0xff, 0xe8, 0xe1, 0xe3, 0xff, 0xd8, 0xd0, 0xd3, 0xff, 0xb8, 0xb2, 0xb4, 0xff, 0xc6, 0xc0, 0xbf, 0xff, 0xf5, 0xed, 0xeb, 0xff, 0xe5, 0xdf, 0xdb, 0xff, 0xe3, 0xdc, 0xd7, 0xff, 0xfe, 0xf6, 0xf0, 0xff, 0xf7, 0xf1, 0xea, 0xff, 0xf6, 0xf0, 0xe9, 0xff, 0xf3, 0xee, 0xe9, 0xff, 0xe7, 0xe2, 0xe2, 0xff, 0xe7, 0xe2, 0xe3, 0xff, 0xe9, 0xe4, 0xe5, 0xff, 0xe7, 0xe2, 0xe3, 0xff, 0xe8, 0xe3, 0xe4, 0xff, 0xe4, 0xe0, 0xe0, 0xff, 0xe5, 0xe0, 0xe1, 0xff, 0xe6, 0xe1, 0xe2, 0xff, 0xe4, 0xde, 0xe0, 0xff, 0xe1, 0xdd, 0xde, 0xff, 0xdc, 0xda, 0xda, 0xff, 0xdd, 0xdb, 0xdb, 0xff, 0xd6, 0xd4, 0xd4, 0xff, 0xd3, 0xd0, 0xd2, 0xff, 0xcc, 0xc9, 0xcc, 0xff, 0xcc, 0xc8, 0xca, 0xff, 0xd2, 0xcd, 0xce, 0xff, 0xe1, 0xdc, 0xdd, 0xff, 0xe7, 0xe3, 0xe3, 0xff, 0xed, 0xe8, 0xe7, 0xff, 0xf3, 0xeb, 0xe8, 0xff, 0xf0, 0xeb, 0xe8, 0xff, 0xe2, 0xdd, 0xdd, 0xff, 0xe5, 0xdb, 0xd8, 0xff, 0xed, 0xe4, 0xd9, 0xff, 0xf3, 0xe8, 0xdf, 0xff, 0xed, 0xe2, 0xda, 0xff, 0xdf, 0xd7, 0xcc, 0xff, 0xd3, 0xca, 0xc1, 0xff, 0xd9, 0xcf, 0xc9, 0xff, 0xe1, 0xd9, 0xd8, 0xff, 0xe8, 0xe4, 0xe3, 0xff, 0xe8, 0xe3, 0xe3, 0xff, 0xe9, 0xe4, 0xe6, 0xff, 0xec, 0xe7, 0xe8, 0xff, 0xe9, 0xe4, 0xe5, 0xff, 0xe3, 0xe0, 0xe0, 0xff, 0xe7, 0xe5, 0xe5, 0xff, 0xeb, 0xe9, 0xe9, 0xff, 0xe4, 0xe2, 0xe2, 0xff, 0xe0, 0xdd, 0xde, 0xff, 0xe0, 0xde, 0xe1, 0xff, 0xdd, 0xdd, 0xdf, 0xff, 0xe1, 0xdf, 0xe1, 0xff, 0xe5, 0xe2, 0xe4, 0xff, 0xe5, 0xe2, 0xe4, 0xff, 0xe6, 0xe4, 0xe4, 0xff, 0xde, 0xdc, 0xde, 0xff, 0xcb, 0xc9, 0xce, 0xff, 0xe3, 0xe0, 0xe0, 0xff, 0xef, 0xed, 0xed, 0xff, 0xf5, 0xf0, 0xf0, 0xff, 0xf1, 0xec, 0xeb, 0xff, 0xd1, 0xcb, 0xcd, 0xff, 0xd3, 0xce, 0xcd, 0xff, 0xf0, 0xea, 0xe3, 0xff, 0xea, 0xe6, 0xe1, 0xff, 0xee, 0xea, 0xe5, 0xff, 0xf8, 0xf2, 0xec, 0xff, 0xd7, 0xd1, 0xd2, 0xff, 0xd9, 0xd5, 0xd7, 0xff, 0xf7, 0xf4, 0xf2, 0xff, 0xf4, 0xef, 0xf0, 0xff, 0xef, 0xeb, 0xeb, 0xff, 0xf3, 0xef, 0xef, 0xff, 0xf4, 0xf0, 0xf0, 0xff, 0xf5, 0xf1, 0xf0, 0xff, 0xf5, 0xf1, 0xf0, 0xff, 0xf4, 0xf0, 0xf0, 0xff, 0xf6, 0xf3, 0xf2, 0xff, 0xfb, 0xf7, 0xf3, 0xff, 0xb9, 0xba, 0xba, 0xff, 0xa5, 0xa8, 0xa9, 0xff, 0xb1, 0xb3, 0xb4, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb1, 0xb4, 0xb4, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb5, 0xb8, 0xb8, 0xff, 0xb4, 0xb7, 0xb7, 0xff, 0xb5, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb3, 0xb8, 0xb7, 0xff, 0xb2, 0xb8, 0xb7, 0xff, 0xb2, 0xb7, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb5, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb4, 0xb6, 0xb8, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xef, 0xb6, 0xb6, 0xb6, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0xa0, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbe, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xc0, 0xc3, 0xc3, 0xff, 0xb3, 0xb4, 0xb4, 0xff, 0x97, 0x94, 0x94, 0xff, 0xbe, 0xb8, 0xb9, 0xff, 0xc5, 0xc0, 0xc1, 0xff, 0xd0, 0xcb, 0xcc, 0xff, 0xed, 0xe7, 0xe7, 0xff, 0xe5, 0xdf, 0xe0, 0xff, 0xc6, 0xc0, 0xc1, 0xff, 0xbd, 0xb7, 0xb9, 0xff, 0xec, 0xe5, 0xe5, 0xff, 0xe7, 0xe0, 0xde, 0xff, 0xda, 0xd3, 0xcf, 0xff, 0xfc, 0xf4, 0xee, 0xff, 0xf8, 0xf2, 0xed, 0xff, 0xf8, 0xf2, 0xed, 0xff, 0xf7, 0xf1, 0xeb, 0xff, 0xee, 0xe8, 0xe6, 0xff, 0xec, 0xe8, 0xe8, 0xff, 0xe8, 0xe3, 0xe5, 0xff, 0xe8, 0xe2, 0xe4, 0xff, 0xe8, 0xe3, 0xe4, 0xff, 0xe4, 0xdf, 0xe0, 0xff, 0xe4, 0xdf, 0xe0, 0xff, 0xe4, 0xde, 0xdf, 0xff, 0xe0, 0xdd, 0xdd, 0xff, 0xe0, 0xde, 0xde, 0xff, 0xd9, 0xd8, 0xd7, 0xff, 0xdc, 0xda, 0xda, 0xff, 0xd8, 0xd6, 0xd6, 0xff, 0xd6, 0xd4, 0xd4, 0xff, 0xc9, 0xc7, 0xc9, 0xff, 0xcb, 0xc9, 0xca, 0xff, 0xd4, 0xd0, 0xd0, 0xff, 0xde, 0xd8, 0xda, 0xff, 0xe6, 0xe1, 0xe1, 0xff, 0xec, 0xe8, 0xe8, 0xff, 0xee, 0xe9, 0xe6, 0xff, 0xf2, 0xec, 0xe8, 0xff, 0xe8, 0xe2, 0xe0, 0xff, 0xe4, 0xdc, 0xd8, 0xff, 0xea, 0xde, 0xd7, 0xff, 0xf0, 0xe6, 0xdd, 0xff, 0xea, 0xde, 0xd6, 0xff, 0xcf, 0xc3, 0xbc, 0xff, 0xd3, 0xc8, 0xbf, 0xff, 0xe6, 0xda, 0xd4, 0xff, 0xe8, 0xe0, 0xde, 0xff, 0xe7, 0xe4, 0xe2, 0xff, 0xe9, 0xe4, 0xe3, 0xff, 0xeb, 0xe7, 0xe7, 0xff, 0xec, 0xe7, 0xe8, 0xff, 0xe9, 0xe3, 0xe4, 0xff, 0xe2, 0xdf, 0xe0, 0xff, 0xe5, 0xe4, 0xe4, 0xff, 0xeb, 0xe9, 0xe9, 0xff, 0xe5, 0xe3, 0xe3, 0xff, 0xde, 0xdd, 0xde, 0xff, 0xdd, 0xdc, 0xdf, 0xff, 0xdf, 0xdd, 0xdf, 0xff, 0xe2, 0xdf, 0xe1, 0xff, 0xe7, 0xe5, 0xe5, 0xff, 0xe7, 0xe4, 0xe4, 0xff, 0xe5, 0xe4, 0xe3, 0xff, 0xdc, 0xda, 0xdb, 0xff, 0xd1, 0xce, 0xd0, 0xff, 0xe7, 0xe4, 0xe3, 0xff, 0xf1, 0xec, 0xed, 0xff, 0xf3, 0xee, 0xf0, 0xff, 0xe5, 0xdf, 0xe0, 0xff, 0xcf, 0xc9, 0xc8, 0xff, 0xe1, 0xdb, 0xd6, 0xff, 0xf0, 0xea, 0xe4, 0xff, 0xe6, 0xe3, 0xdd, 0xff, 0xf3, 0xed, 0xe8, 0xff, 0xf7, 0xed, 0xe9, 0xff, 0xcf, 0xc7, 0xc9, 0xff, 0xdf, 0xd9, 0xdb, 0xff, 0xfa, 0xf6, 0xf4, 0xff, 0xf3, 0xee, 0xee, 0xff, 0xf0, 0xea, 0xea, 0xff, 0xf2, 0xee, 0xee, 0xff, 0xf2, 0xed, 0xef, 0xff, 0xf4, 0xf0, 0xf0, 0xff, 0xf7, 0xf3, 0xf1, 0xff, 0xf5, 0xf0, 0xf1, 0xff, 0xf3, 0xee, 0xf0, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xd3, 0xd1, 0xcf, 0xff, 0x9f, 0xa2, 0xa3, 0xff, 0xb1, 0xb3, 0xb5, 0xff, 0xb2, 0xb4, 0xb5, 0xff, 0xb2, 0xb4, 0xb5, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb6, 0xb8, 0xb8, 0xff, 0xb6, 0xb7, 0xb8, 0xff, 0xb5, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb8, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb2, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb7, 0xb6, 0xff, 0xb5, 0xb6, 0xb6, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb5, 0xb5, 0xb7, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x4a, 0xbe, 0xbf, 0xbf, 0xff, 0xbd, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbd, 0xc0, 0xc0, 0xff, 0xb8, 0xb6, 0xb6, 0xff, 0x99, 0x96, 0x97, 0xff, 0xc3, 0xbe, 0xbf, 0xff, 0xd1, 0xcc, 0xcd, 0xff, 0xcb, 0xc6, 0xc7, 0xff, 0xea, 0xe4, 0xe5, 0xff, 0xee, 0xe8, 0xe9, 0xff, 0xd7, 0xd1, 0xd2, 0xff, 0xbb, 0xb5, 0xb7, 0xff, 0xdb, 0xd5, 0xd4, 0xff, 0xf1, 0xe9, 0xe9, 0xff, 0xd5, 0xcd, 0xcb, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf8, 0xf2, 0xeb, 0xff, 0xf8, 0xf1, 0xec, 0xff, 0xf8, 0xf1, 0xed, 0xff, 0xf6, 0xef, 0xec, 0xff, 0xef, 0xea, 0xe8, 0xff, 0xeb, 0xe6, 0xe6, 0xff, 0xeb, 0xe5, 0xe7, 0xff, 0xe7, 0xe1, 0xe2, 0xff, 0xe2, 0xdd, 0xde, 0xff, 0xe2, 0xdd, 0xde, 0xff, 0xe0, 0xdb, 0xdc, 0xff, 0xe0, 0xdc, 0xdd, 0xff, 0xdf, 0xdd, 0xdd, 0xff, 0xd9, 0xd7, 0xd7, 0xff, 0xda, 0xd8, 0xd8, 0xff, 0xda, 0xd9, 0xd9, 0xff, 0xd5, 0xd3, 0xd3, 0xff, 0xcb, 0xc8, 0xca, 0xff, 0xcf, 0xcc, 0xcd, 0xff, 0xd3, 0xcf, 0xd0, 0xff, 0xd9, 0xd4, 0xd5, 0xff, 0xe0, 0xdb, 0xdd, 0xff, 0xeb, 0xe6, 0xe7, 0xff, 0xed, 0xe8, 0xe6, 0xff, 0xf2, 0xeb, 0xe7, 0xff, 0xec, 0xe5, 0xe3, 0xff, 0xe7, 0xdf, 0xde, 0xff, 0xed, 0xe4, 0xdd, 0xff, 0xed, 0xe3, 0xd8, 0xff, 0xdd, 0xd3, 0xc9, 0xff, 0xca, 0xbf, 0xb7, 0xff, 0xd8, 0xce, 0xc3, 0xff, 0xf1, 0xe6, 0xdf, 0xff, 0xe9, 0xe2, 0xdf, 0xff, 0xe5, 0xe1, 0xe0, 0xff, 0xe8, 0xe3, 0xe2, 0xff, 0xea, 0xe5, 0xe6, 0xff, 0xe7, 0xe2, 0xe3, 0xff, 0xe8, 0xe2, 0xe3, 0xff, 0xdd, 0xda, 0xda, 0xff, 0xe3, 0xe2, 0xe2, 0xff, 0xed, 0xec, 0xec, 0xff, 0xe5, 0xe3, 0xe3, 0xff, 0xdd, 0xdc, 0xdd, 0xff, 0xdc, 0xdb, 0xdd, 0xff, 0xe0, 0xdd, 0xe0, 0xff, 0xe4, 0xe1, 0xe2, 0xff, 0xe7, 0xe6, 0xe6, 0xff, 0xe8, 0xe7, 0xe6, 0xff, 0xe4, 0xe2, 0xe2, 0xff, 0xdd, 0xdb, 0xdb, 0xff, 0xd8, 0xd6, 0xd6, 0xff, 0xe9, 0xe5, 0xe6, 0xff, 0xf5, 0xee, 0xef, 0xff, 0xf1, 0xec, 0xed, 0xff, 0xda, 0xd6, 0xd6, 0xff, 0xd3, 0xcd, 0xca, 0xff, 0xe4, 0xde, 0xd8, 0xff, 0xf0, 0xea, 0xe5, 0xff, 0xe7, 0xe3, 0xde, 0xff, 0xf6, 0xef, 0xea, 0xff, 0xed, 0xe2, 0xdf, 0xff, 0xcb, 0xc3, 0xc6, 0xff, 0xe4, 0xde, 0xe0, 0xff, 0xfa, 0xf5, 0xf4, 0xff, 0xf3, 0xee, 0xec, 0xff, 0xf0, 0xea, 0xec, 0xff, 0xf0, 0xeb, 0xed, 0xff, 0xf3, 0xee, 0xf0, 0xff, 0xf6, 0xf2, 0xf1, 0xff, 0xf6, 0xf3, 0xf1, 0xff, 0xf6, 0xf2, 0xf2, 0xff, 0xf6, 0xf1, 0xf1, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xf1, 0xec, 0xeb, 0xff, 0xab, 0xac, 0xac, 0xff, 0xad, 0xaf, 0xaf, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb5, 0xb8, 0xb9, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb3, 0xb6, 0xb6, 0xff, 0xb3, 0xb6, 0xb6, 0xff, 0xb2, 0xb7, 0xb8, 0xff, 0xb2, 0xb9, 0xb8, 0xff, 0xb3, 0xb7, 0xb6, 0xff, 0xb3, 0xb6, 0xb6, 0xff, 0xb2, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb3, 0xb6, 0xb6, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x04, 0xbd, 0xc0, 0xc0, 0xe7, 0xbd, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbc, 0xbf, 0xbf, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xc0, 0xbc, 0xbd, 0xff, 0x9d, 0x97, 0x99, 0xff, 0xc1, 0xbb, 0xbc, 0xff, 0xe2, 0xdc, 0xdd, 0xff, 0xcd, 0xc8, 0xc9, 0xff, 0xe1, 0xdb, 0xdb, 0xff, 0xef, 0xe9, 0xea, 0xff, 0xe8, 0xe2, 0xe3, 0xff, 0xc1, 0xbb, 0xbd, 0xff, 0xce, 0xc8, 0xc7, 0xff, 0xf6, 0xee, 0xed, 0xff, 0xd4, 0xcb, 0xcb, 0xff, 0xe4, 0xdc, 0xd7, 0xff, 0xfb, 0xf5, 0xed, 0xff, 0xfb, 0xf2, 0xeb, 0xff, 0xf5, 0xef, 0xeb, 0xff, 0xf5, 0xee, 0xea, 0xff, 0xf2, 0xeb, 0xe6, 0xff, 0xed, 0xe9, 0xe8, 0xff, 0xec, 0xe6, 0xe7, 0xff, 0xe7, 0xe1, 0xe2, 0xff, 0xe3, 0xdc, 0xdd, 0xff, 0xe0, 0xd9, 0xda, 0xff, 0xde, 0xd9, 0xda, 0xff, 0xe1, 0xdc, 0xdd, 0xff, 0xe1, 0xdc, 0xdd, 0xff, 0xdd, 0xd9, 0xd9, 0xff, 0xdd, 0xd8, 0xd9, 0xff, 0xdd, 0xd9, 0xda, 0xff, 0xd4, 0xd0, 0xd0, 0xff, 0xce, 0xca, 0xcb, 0xff, 0xd4, 0xce, 0xd0, 0xff, 0xd4, 0xcf, 0xd0, 0xff, 0xd7, 0xd2, 0xd3, 0xff, 0xdf, 0xda, 0xdb, 0xff, 0xe7, 0xe3, 0xe3, 0xff, 0xed, 0xe8, 0xe6, 0xff, 0xf2, 0xeb, 0xe7, 0xff, 0xed, 0xe6, 0xe4, 0xff, 0xeb, 0xe2, 0xe0, 0xff, 0xf0, 0xe6, 0xde, 0xff, 0xe5, 0xd9, 0xce, 0xff, 0xdc, 0xcf, 0xc2, 0xff, 0xd2, 0xc7, 0xbb, 0xff, 0xde, 0xd4, 0xca, 0xff, 0xef, 0xe5, 0xde, 0xff, 0xe6, 0xde, 0xda, 0xff, 0xe5, 0xde, 0xe0, 0xff, 0xe2, 0xdc, 0xde, 0xff, 0xe7, 0xe2, 0xe3, 0xff, 0xe5, 0xe0, 0xe1, 0xff, 0xe9, 0xe4, 0xe5, 0xff, 0xde, 0xdc, 0xdc, 0xff, 0xe1, 0xdf, 0xdf, 0xff, 0xed, 0xea, 0xea, 0xff, 0xe6, 0xe5, 0xe4, 0xff, 0xde, 0xdd, 0xde, 0xff, 0xde, 0xdc, 0xdf, 0xff, 0xe1, 0xde, 0xdf, 0xff, 0xe5, 0xe3, 0xe3, 0xff, 0xe8, 0xe6, 0xe6, 0xff, 0xe7, 0xe5, 0xe5, 0xff, 0xe2, 0xe0, 0xe0, 0xff, 0xdc, 0xda, 0xda, 0xff, 0xdc, 0xdb, 0xdb, 0xff, 0xea, 0xe7, 0xe8, 0xff, 0xf4, 0xee, 0xee, 0xff, 0xef, 0xea, 0xe9, 0xff, 0xdb, 0xd6, 0xd4, 0xff, 0xd7, 0xd0, 0xcb, 0xff, 0xe4, 0xdf, 0xda, 0xff, 0xed, 0xe6, 0xe2, 0xff, 0xec, 0xe4, 0xe0, 0xff, 0xf9, 0xf1, 0xec, 0xff, 0xdc, 0xd5, 0xd4, 0xff, 0xca, 0xc4, 0xc5, 0xff, 0xeb, 0xe6, 0xe5, 0xff, 0xfa, 0xf6, 0xf4, 0xff, 0xf0, 0xea, 0xeb, 0xff, 0xef, 0xea, 0xeb, 0xff, 0xf2, 0xed, 0xef, 0xff, 0xf3, 0xee, 0xf0, 0xff, 0xf5, 0xf1, 0xf1, 0xff, 0xf7, 0xf3, 0xf0, 0xff, 0xf7, 0xf4, 0xf1, 0xff, 0xf7, 0xf3, 0xf2, 0xff, 0xfa, 0xf6, 0xf6, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xc0, 0xbf, 0xbd, 0xff, 0xa3, 0xa6, 0xa6, 0xff, 0xb1, 0xb3, 0xb3, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb6, 0xb7, 0xb9, 0xff, 0xb7, 0xb8, 0xba, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb4, 0xb6, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xb3, 0xb8, 0xb6, 0xff, 0xb2, 0xb6, 0xb6, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb5, 0xb5, 0xb6, 0xff, 0xb3, 0xb6, 0xb7, 0xe7, 0x99, 0xcc, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xc0, 0xc0, 0x87, 0xc0, 0xc1, 0xc1, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xbf, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xb9, 0xbe, 0xbd, 0xff, 0xbb, 0xbc, 0xbc, 0xff, 0xca, 0xc3, 0xc5, 0xff, 0xa0, 0x9a, 0x9d, 0xff, 0xb6, 0xb2, 0xb1, 0xff, 0xea, 0xe6, 0xe5, 0xff, 0xda, 0xd3, 0xd6, 0xff, 0xdd, 0xd6, 0xd8, 0xff, 0xe8, 0xe2, 0xe3, 0xff, 0xf2, 0xec, 0xec, 0xff, 0xcf, 0xc9, 0xcb, 0xff, 0xc9, 0xc2, 0xc4, 0xff, 0xf4, 0xed, 0xec, 0xff, 0xd9, 0xd0, 0xd0, 0xff, 0xd6, 0xcf, 0xcb, 0xff, 0xfc, 0xf5, 0xee, 0xff, 0xfc, 0xf2, 0xee, 0xff, 0xf6, 0xef, 0xeb, 0xff, 0xf6, 0xf0, 0xeb, 0xff, 0xf4, 0xec, 0xe8, 0xff, 0xed, 0xe8, 0xe6, 0xff, 0xeb, 0xe6, 0xe6, 0xff, 0xed, 0xe7, 0xe7, 0xff, 0xe6, 0xdf, 0xe0, 0xff, 0xdf, 0xd9, 0xda, 0xff, 0xdd, 0xd8, 0xd9, 0xff, 0xdd, 0xd8, 0xd9, 0xff, 0xe0, 0xdb, 0xdc, 0xff, 0xdf, 0xd9, 0xda, 0xff, 0xdf, 0xd9, 0xda, 0xff, 0xe0, 0xdb, 0xdc, 0xff, 0xd7, 0xd1, 0xd2, 0xff, 0xd3, 0xcd, 0xce, 0xff, 0xd5, 0xd0, 0xd2, 0xff, 0xd5, 0xd0, 0xd1, 0xff, 0xd5, 0xd0, 0xd1, 0xff, 0xde, 0xd9, 0xda, 0xff, 0xe2, 0xde, 0xde, 0xff, 0xe7, 0xe3, 0xe2, 0xff, 0xee, 0xe8, 0xe5, 0xff, 0xf2, 0xe9, 0xe6, 0xff, 0xf0, 0xe7, 0xe1, 0xff, 0xef, 0xe5, 0xdd, 0xff, 0xeb, 0xde, 0xd4, 0xff, 0xe2, 0xd2, 0xc5, 0xff, 0xdb, 0xce, 0xc0, 0xff, 0xe1, 0xd6, 0xc8, 0xff, 0xec, 0xe3, 0xdb, 0xff, 0xe7, 0xde, 0xda, 0xff, 0xe5, 0xdc, 0xde, 0xff, 0xe0, 0xda, 0xdc, 0xff, 0xe6, 0xe1, 0xe1, 0xff, 0xe4, 0xde, 0xdf, 0xff, 0xe9, 0xe5, 0xe5, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe3, 0xe0, 0xe1, 0xff, 0xed, 0xe8, 0xe9, 0xff, 0xea, 0xe7, 0xe7, 0xff, 0xe4, 0xe2, 0xe3, 0xff, 0xe1, 0xe0, 0xe1, 0xff, 0xe1, 0xdf, 0xde, 0xff, 0xe6, 0xe5, 0xe4, 0xff, 0xe8, 0xe5, 0xe5, 0xff, 0xe9, 0xe4, 0xe5, 0xff, 0xe3, 0xe0, 0xe0, 0xff, 0xdf, 0xdc, 0xdc, 0xff, 0xe2, 0xdf, 0xdf, 0xff, 0xee, 0xea, 0xea, 0xff, 0xf5, 0xf0, 0xee, 0xff, 0xed, 0xe8, 0xe8, 0xff, 0xdc, 0xd8, 0xd5, 0xff, 0xd7, 0xd0, 0xcb, 0xff, 0xe5, 0xdd, 0xd8, 0xff, 0xeb, 0xe3, 0xe0, 0xff, 0xf0, 0xe8, 0xe5, 0xff, 0xf5, 0xed, 0xe9, 0xff, 0xd1, 0xca, 0xcc, 0xff, 0xcb, 0xc5, 0xc7, 0xff, 0xed, 0xe8, 0xe8, 0xff, 0xf8, 0xf4, 0xf2, 0xff, 0xee, 0xe8, 0xe8, 0xff, 0xef, 0xea, 0xeb, 0xff, 0xf1, 0xec, 0xec, 0xff, 0xf4, 0xef, 0xee, 0xff, 0xf5, 0xf0, 0xf0, 0xff, 0xf7, 0xf3, 0xf1, 0xff, 0xf6, 0xf2, 0xf0, 0xff, 0xf6, 0xf2, 0xf1, 0xff, 0xf8, 0xf5, 0xf4, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xd6, 0xd2, 0xd1, 0xff, 0x9e, 0xa2, 0xa3, 0xff, 0xaf, 0xb2, 0xb2, 0xff, 0xb2, 0xb4, 0xb3, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb4, 0xb5, 0xb6, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb8, 0xb8, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb4, 0xb6, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb6, 0xb6, 0xb7, 0xff, 0xb6, 0xb6, 0xb7, 0xff, 0xb4, 0xb5, 0xb5, 0xff, 0xb4, 0xb5, 0xb5, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb7, 0xff, 0xb3, 0xb5, 0xb7, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xc3, 0xc3, 0x22, 0xbf, 0xc0, 0xc0, 0xfe, 0xc0, 0xc1, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc1, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbd, 0xbf, 0xbe, 0xff, 0xbc, 0xbe, 0xbe, 0xff, 0xbb, 0xbe, 0xbe, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xcd, 0xc6, 0xc7, 0xff, 0xa9, 0xa3, 0xa5, 0xff, 0xb1, 0xac, 0xab, 0xff, 0xeb, 0xe5, 0xe5, 0xff, 0xe4, 0xde, 0xe0, 0xff, 0xe2, 0xdc, 0xdd, 0xff, 0xde, 0xd8, 0xd9, 0xff, 0xf0, 0xeb, 0xeb, 0xff, 0xe8, 0xe3, 0xe4, 0xff, 0xca, 0xc4, 0xc6, 0xff, 0xe8, 0xe0, 0xe1, 0xff, 0xe2, 0xda, 0xda, 0xff, 0xd1, 0xc9, 0xc4, 0xff, 0xf6, 0xee, 0xe6, 0xff, 0xfa, 0xf2, 0xec, 0xff, 0xf8, 0xef, 0xe8, 0xff, 0xf5, 0xef, 0xe9, 0xff, 0xf5, 0xef, 0xeb, 0xff, 0xf1, 0xeb, 0xe8, 0xff, 0xed, 0xe9, 0xe7, 0xff, 0xeb, 0xe6, 0xe6, 0xff, 0xe0, 0xdb, 0xdc, 0xff, 0xdf, 0xda, 0xdb, 0xff, 0xde, 0xd9, 0xda, 0xff, 0xdc, 0xd7, 0xd8, 0xff, 0xdf, 0xda, 0xdb, 0xff, 0xdc, 0xd8, 0xd9, 0xff, 0xdf, 0xda, 0xdb, 0xff, 0xdf, 0xda, 0xdb, 0xff, 0xd5, 0xd0, 0xd1, 0xff, 0xd3, 0xcf, 0xcf, 0xff, 0xd7, 0xd2, 0xd3, 0xff, 0xd8, 0xd3, 0xd4, 0xff, 0xd7, 0xd2, 0xd3, 0xff, 0xdc, 0xd7, 0xd8, 0xff, 0xdd, 0xd7, 0xd8, 0xff, 0xe3, 0xde, 0xde, 0xff, 0xe9, 0xe4, 0xe2, 0xff, 0xf0, 0xe8, 0xe5, 0xff, 0xf2, 0xe9, 0xe4, 0xff, 0xf3, 0xe9, 0xe2, 0xff, 0xef, 0xe4, 0xd9, 0xff, 0xe6, 0xd7, 0xc9, 0xff, 0xe3, 0xd6, 0xc7, 0xff, 0xe4, 0xd8, 0xc7, 0xff, 0xea, 0xdf, 0xd6, 0xff, 0xeb, 0xe2, 0xdd, 0xff, 0xe2, 0xdc, 0xdb, 0xff, 0xdb, 0xd5, 0xd7, 0xff, 0xdf, 0xda, 0xdb, 0xff, 0xe1, 0xdc, 0xdd, 0xff, 0xe5, 0xe0, 0xe1, 0xff, 0xdd, 0xda, 0xda, 0xff, 0xe7, 0xe2, 0xe3, 0xff, 0xee, 0xe8, 0xe9, 0xff, 0xec, 0xe7, 0xe8, 0xff, 0xe5, 0xe1, 0xe2, 0xff, 0xe2, 0xe0, 0xe0, 0xff, 0xe2, 0xe0, 0xe0, 0xff, 0xe8, 0xe7, 0xe6, 0xff, 0xe9, 0xe5, 0xe6, 0xff, 0xe9, 0xe3, 0xe4, 0xff, 0xe6, 0xe0, 0xe1, 0xff, 0xe6, 0xe1, 0xe2, 0xff, 0xe8, 0xe2, 0xe4, 0xff, 0xef, 0xea, 0xeb, 0xff, 0xf5, 0xf0, 0xed, 0xff, 0xec, 0xe5, 0xe3, 0xff, 0xdc, 0xd6, 0xd3, 0xff, 0xd7, 0xd0, 0xca, 0xff, 0xe5, 0xdc, 0xd9, 0xff, 0xec, 0xe4, 0xde, 0xff, 0xf5, 0xef, 0xe7, 0xff, 0xec, 0xe4, 0xe1, 0xff, 0xcb, 0xc5, 0xc7, 0xff, 0xcc, 0xc7, 0xc9, 0xff, 0xef, 0xe9, 0xea, 0xff, 0xf6, 0xf1, 0xf1, 0xff, 0xed, 0xe7, 0xe8, 0xff, 0xf1, 0xeb, 0xed, 0xff, 0xf2, 0xed, 0xed, 0xff, 0xf5, 0xf0, 0xee, 0xff, 0xf4, 0xf0, 0xef, 0xff, 0xf6, 0xf3, 0xf2, 0xff, 0xf5, 0xf1, 0xf0, 0xff, 0xf6, 0xf2, 0xf1, 0xff, 0xf8, 0xf5, 0xf4, 0xff, 0xff, 0xfa, 0xf9, 0xff, 0xea, 0xe4, 0xe3, 0xff, 0xa6, 0xa9, 0xa8, 0xff, 0xac, 0xaf, 0xb0, 0xff, 0xb2, 0xb3, 0xb3, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb4, 0xb7, 0xb8, 0xff, 0xb5, 0xb8, 0xb8, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb5, 0xb7, 0xb6, 0xff, 0xb4, 0xb7, 0xb7, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb4, 0xb6, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb7, 0xb6, 0xb6, 0xff, 0xb4, 0xb5, 0xb5, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb5, 0xb6, 0xb7, 0xff, 0xb3, 0xb5, 0xb6, 0xfe, 0xb6, 0xb6, 0xb6, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xc0, 0xc0, 0xb4, 0xbf, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc1, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbc, 0xbe, 0xbf, 0xff, 0xbb, 0xbd, 0xbd, 0xff, 0xb9, 0xbd, 0xbd, 0xff, 0xba, 0xbb, 0xbb, 0xff, 0xd3, 0xcd, 0xce, 0xff, 0xb5, 0xb0, 0xb1, 0xff, 0xad, 0xa7, 0xa8, 0xff, 0xe7, 0xe3, 0xe2, 0xff, 0xea, 0xe5, 0xe4, 0xff, 0xec, 0xe7, 0xe7, 0xff, 0xdc, 0xd6, 0xd7, 0xff, 0xe0, 0xdb, 0xdc, 0xff, 0xf3, 0xef, 0xef, 0xff, 0xd8, 0xd3, 0xd5, 0xff, 0xde, 0xd7, 0xd7, 0xff, 0xec, 0xe4, 0xe4, 0xff, 0xce, 0xc5, 0xc2, 0xff, 0xed, 0xe3, 0xdb, 0xff, 0xf9, 0xf1, 0xeb, 0xff, 0xf8, 0xf0, 0xe9, 0xff, 0xf6, 0xee, 0xe8, 0xff, 0xf4, 0xee, 0xe9, 0xff, 0xf2, 0xeb, 0xe8, 0xff, 0xf0, 0xe9, 0xe7, 0xff, 0xe9, 0xe3, 0xe2, 0xff, 0xe0, 0xdb, 0xdc, 0xff, 0xe0, 0xdb, 0xdc, 0xff, 0xdd, 0xd7, 0xd8, 0xff, 0xdc, 0xd5, 0xd6, 0xff, 0xdc, 0xd6, 0xd7, 0xff, 0xdc, 0xd6, 0xd8, 0xff, 0xdf, 0xda, 0xdb, 0xff, 0xdf, 0xda, 0xdb, 0xff, 0xd9, 0xd3, 0xd4, 0xff, 0xd7, 0xd2, 0xd2, 0xff, 0xd8, 0xd2, 0xd3, 0xff, 0xd8, 0xd3, 0xd4, 0xff, 0xdb, 0xd6, 0xd7, 0xff, 0xdc, 0xd7, 0xd8, 0xff, 0xdb, 0xd6, 0xd7, 0xff, 0xe1, 0xdb, 0xdc, 0xff, 0xe4, 0xdf, 0xde, 0xff, 0xeb, 0xe5, 0xe2, 0xff, 0xf0, 0xe8, 0xe3, 0xff, 0xf5, 0xeb, 0xe3, 0xff, 0xf2, 0xe8, 0xdd, 0xff, 0xec, 0xe0, 0xd5, 0xff, 0xe9, 0xda, 0xcf, 0xff, 0xe5, 0xd8, 0xc8, 0xff, 0xed, 0xdf, 0xd6, 0xff, 0xeb, 0xe3, 0xdf, 0xff, 0xdf, 0xda, 0xd8, 0xff, 0xd8, 0xd2, 0xd3, 0xff, 0xda, 0xd5, 0xd6, 0xff, 0xe5, 0xdf, 0xe0, 0xff, 0xe4, 0xde, 0xdf, 0xff, 0xe1, 0xdc, 0xdd, 0xff, 0xeb, 0xe5, 0xe7, 0xff, 0xec, 0xe7, 0xe8, 0xff, 0xeb, 0xe7, 0xe8, 0xff, 0xe7, 0xe1, 0xe2, 0xff, 0xe6, 0xe1, 0xe2, 0xff, 0xe4, 0xdf, 0xe0, 0xff, 0xe9, 0xe3, 0xe4, 0xff, 0xeb, 0xe6, 0xe7, 0xff, 0xe8, 0xe3, 0xe4, 0xff, 0xe5, 0xe0, 0xe1, 0xff, 0xe4, 0xdf, 0xe0, 0xff, 0xe7, 0xe2, 0xe4, 0xff, 0xef, 0xea, 0xeb, 0xff, 0xf4, 0xee, 0xec, 0xff, 0xea, 0xe1, 0xdf, 0xff, 0xde, 0xd5, 0xd0, 0xff, 0xda, 0xd2, 0xcb, 0xff, 0xe7, 0xdd, 0xd9, 0xff, 0xee, 0xe6, 0xde, 0xff, 0xf5, 0xed, 0xe8, 0xff, 0xe4, 0xdb, 0xd7, 0xff, 0xcc, 0xc3, 0xc3, 0xff, 0xd0, 0xcb, 0xcc, 0xff, 0xf4, 0xef, 0xee, 0xff, 0xf4, 0xee, 0xef, 0xff, 0xee, 0xe7, 0xe9, 0xff, 0xf2, 0xec, 0xed, 0xff, 0xf5, 0xef, 0xef, 0xff, 0xf5, 0xef, 0xef, 0xff, 0xf4, 0xef, 0xef, 0xff, 0xf7, 0xf3, 0xf2, 0xff, 0xf5, 0xf1, 0xf0, 0xff, 0xf5, 0xf1, 0xef, 0xff, 0xf9, 0xf4, 0xf3, 0xff, 0xf2, 0xed, 0xed, 0xff, 0xf0, 0xec, 0xeb, 0xff, 0xb1, 0xb3, 0xb3, 0xff, 0xa9, 0xac, 0xac, 0xff, 0xb1, 0xb3, 0xb3, 0xff, 0xb2, 0xb4, 0xb3, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb4, 0xb7, 0xb7, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb8, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb5, 0xb7, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x40, 0xbf, 0xc0, 0xc1, 0xff, 0xbd, 0xbf, 0xc1, 0xff, 0xbe, 0xbf, 0xc0, 0xff, 0xbe, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc1, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbb, 0xbf, 0xbe, 0xff, 0xb7, 0xb8, 0xb7, 0xff, 0xd3, 0xcd, 0xcc, 0xff, 0xc6, 0xc0, 0xc1, 0xff, 0xa6, 0xa1, 0xa3, 0xff, 0xdb, 0xd5, 0xd5, 0xff, 0xee, 0xe9, 0xe8, 0xff, 0xf2, 0xed, 0xed, 0xff, 0xe6, 0xe0, 0xe1, 0xff, 0xd3, 0xce, 0xcf, 0xff, 0xe8, 0xe3, 0xe4, 0xff, 0xea, 0xe5, 0xe6, 0xff, 0xdf, 0xda, 0xda, 0xff, 0xf0, 0xe9, 0xea, 0xff, 0xcc, 0xc3, 0xc4, 0xff, 0xdf, 0xd4, 0xd2, 0xff, 0xfa, 0xf0, 0xeb, 0xff, 0xf9, 0xef, 0xec, 0xff, 0xf6, 0xed, 0xea, 0xff, 0xf4, 0xee, 0xe9, 0xff, 0xf2, 0xec, 0xe7, 0xff, 0xf1, 0xea, 0xe6, 0xff, 0xea, 0xe4, 0xe0, 0xff, 0xe3, 0xdd, 0xdd, 0xff, 0xde, 0xd9, 0xdb, 0xff, 0xda, 0xd4, 0xd5, 0xff, 0xd6, 0xd1, 0xd2, 0xff, 0xd8, 0xd2, 0xd2, 0xff, 0xdb, 0xd6, 0xd6, 0xff, 0xe0, 0xd9, 0xdb, 0xff, 0xe0, 0xda, 0xdb, 0xff, 0xde, 0xd8, 0xd9, 0xff, 0xd9, 0xd4, 0xd5, 0xff, 0xda, 0xd3, 0xd4, 0xff, 0xda, 0xd4, 0xd5, 0xff, 0xdd, 0xd8, 0xd9, 0xff, 0xdc, 0xd8, 0xd9, 0xff, 0xd9, 0xd3, 0xd4, 0xff, 0xde, 0xd8, 0xd9, 0xff, 0xe5, 0xe0, 0xdf, 0xff, 0xea, 0xe5, 0xe2, 0xff, 0xf1, 0xe9, 0xe5, 0xff, 0xf4, 0xeb, 0xe4, 0xff, 0xf1, 0xe8, 0xde, 0xff, 0xee, 0xe2, 0xd6, 0xff, 0xee, 0xe0, 0xd3, 0xff, 0xea, 0xdb, 0xce, 0xff, 0xed, 0xe2, 0xd7, 0xff, 0xe9, 0xe0, 0xdc, 0xff, 0xde, 0xd7, 0xd6, 0xff, 0xd2, 0xce, 0xcf, 0xff, 0xd3, 0xcf, 0xcf, 0xff, 0xe4, 0xdf, 0xe0, 0xff, 0xe6, 0xe1, 0xe2, 0xff, 0xe5, 0xe0, 0xe1, 0xff, 0xe9, 0xe4, 0xe5, 0xff, 0xe8, 0xe4, 0xe4, 0xff, 0xea, 0xe5, 0xe6, 0xff, 0xe9, 0xe4, 0xe5, 0xff, 0xe8, 0xe2, 0xe3, 0xff, 0xe6, 0xe0, 0xe1, 0xff, 0xe7, 0xe3, 0xe4, 0xff, 0xeb, 0xe7, 0xe8, 0xff, 0xe9, 0xe3, 0xe4, 0xff, 0xe6, 0xe1, 0xe3, 0xff, 0xe4, 0xdf, 0xe0, 0xff, 0xea, 0xe5, 0xe6, 0xff, 0xf1, 0xec, 0xed, 0xff, 0xf1, 0xec, 0xea, 0xff, 0xe6, 0xde, 0xdc, 0xff, 0xdc, 0xd3, 0xd0, 0xff, 0xdd, 0xd4, 0xcf, 0xff, 0xe5, 0xdd, 0xd7, 0xff, 0xf1, 0xe9, 0xe5, 0xff, 0xf9, 0xed, 0xe6, 0xff, 0xcd, 0xc8, 0xc9, 0xff, 0xb6, 0xb5, 0xbb, 0xff, 0xd4, 0xcd, 0xce, 0xff, 0xf6, 0xf2, 0xf0, 0xff, 0xf3, 0xed, 0xef, 0xff, 0xef, 0xe9, 0xeb, 0xff, 0xf3, 0xef, 0xed, 0xff, 0xf5, 0xef, 0xee, 0xff, 0xf7, 0xf0, 0xf1, 0xff, 0xf5, 0xf0, 0xf0, 0xff, 0xf5, 0xf1, 0xf0, 0xff, 0xf7, 0xf2, 0xf1, 0xff, 0xee, 0xe9, 0xe9, 0xff, 0xe3, 0xe0, 0xe0, 0xff, 0xfb, 0xf5, 0xf3, 0xff, 0xf0, 0xed, 0xec, 0xff, 0xab, 0xac, 0xac, 0xff, 0xad, 0xaf, 0xb1, 0xff, 0xb1, 0xb3, 0xb4, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb4, 0xb8, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb6, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb2, 0xb6, 0xb6, 0xff, 0xb3, 0xb7, 0xb7, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb3, 0xb6, 0xb7, 0xff, 0xb3, 0xb7, 0xb7, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xbf, 0xc0, 0xcd, 0xbd, 0xbf, 0xc1, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xbd, 0xc0, 0xc0, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xd4, 0xce, 0xcd, 0xff, 0xd9, 0xd2, 0xd2, 0xff, 0xac, 0xa4, 0xa8, 0xff, 0xc9, 0xc2, 0xc4, 0xff, 0xed, 0xe8, 0xe7, 0xff, 0xf5, 0xf0, 0xee, 0xff, 0xee, 0xe9, 0xe8, 0xff, 0xdb, 0xd5, 0xd6, 0xff, 0xdc, 0xd6, 0xd7, 0xff, 0xee, 0xe7, 0xe8, 0xff, 0xe9, 0xe4, 0xe4, 0xff, 0xf2, 0xed, 0xed, 0xff, 0xd0, 0xc9, 0xcb, 0xff, 0xd1, 0xc8, 0xc7, 0xff, 0xf9, 0xed, 0xe8, 0xff, 0xf9, 0xef, 0xeb, 0xff, 0xf9, 0xf0, 0xec, 0xff, 0xf7, 0xee, 0xea, 0xff, 0xf3, 0xec, 0xe7, 0xff, 0xef, 0xe8, 0xe3, 0xff, 0xe9, 0xe1, 0xe1, 0xff, 0xe2, 0xdc, 0xdd, 0xff, 0xdc, 0xd6, 0xd6, 0xff, 0xd7, 0xd1, 0xd2, 0xff, 0xd4, 0xd0, 0xd1, 0xff, 0xd8, 0xd3, 0xd3, 0xff, 0xda, 0xd5, 0xd5, 0xff, 0xdd, 0xd8, 0xd9, 0xff, 0xdf, 0xdb, 0xdb, 0xff, 0xdf, 0xda, 0xda, 0xff, 0xdc, 0xd6, 0xd8, 0xff, 0xdb, 0xd6, 0xd7, 0xff, 0xdb, 0xd6, 0xd7, 0xff, 0xdf, 0xda, 0xdc, 0xff, 0xe0, 0xdb, 0xdc, 0xff, 0xdb, 0xd5, 0xd6, 0xff, 0xd9, 0xd2, 0xd3, 0xff, 0xdf, 0xdb, 0xdb, 0xff, 0xe8, 0xe3, 0xe2, 0xff, 0xf0, 0xe9, 0xe5, 0xff, 0xf4, 0xed, 0xe5, 0xff, 0xf2, 0xea, 0xdf, 0xff, 0xf2, 0xe2, 0xd7, 0xff, 0xfa, 0xeb, 0xdd, 0xff, 0xf3, 0xe6, 0xd8, 0xff, 0xe8, 0xde, 0xd1, 0xff, 0xea, 0xdf, 0xda, 0xff, 0xe0, 0xd9, 0xd8, 0xff, 0xce, 0xca, 0xca, 0xff, 0xd4, 0xcf, 0xd1, 0xff, 0xe3, 0xde, 0xe0, 0xff, 0xe5, 0xe0, 0xe1, 0xff, 0xe3, 0xde, 0xdf, 0xff, 0xe7, 0xe2, 0xe2, 0xff, 0xe8, 0xe4, 0xe3, 0xff, 0xe8, 0xe3, 0xe4, 0xff, 0xe9, 0xe4, 0xe5, 0xff, 0xe8, 0xe3, 0xe4, 0xff, 0xe9, 0xe3, 0xe4, 0xff, 0xea, 0xe5, 0xe6, 0xff, 0xea, 0xe7, 0xe6, 0xff, 0xec, 0xe8, 0xe6, 0xff, 0xe8, 0xe4, 0xe3, 0xff, 0xe8, 0xe4, 0xe4, 0xff, 0xee, 0xe8, 0xe9, 0xff, 0xf1, 0xec, 0xeb, 0xff, 0xef, 0xea, 0xe8, 0xff, 0xe4, 0xdc, 0xd8, 0xff, 0xdc, 0xd1, 0xce, 0xff, 0xde, 0xd3, 0xcf, 0xff, 0xe6, 0xde, 0xd9, 0xff, 0xfb, 0xf1, 0xe5, 0xff, 0xd5, 0xcb, 0xcb, 0xff, 0x84, 0x98, 0xc9, 0xff, 0x85, 0x99, 0xc4, 0xff, 0xd0, 0xca, 0xd0, 0xff, 0xfd, 0xf7, 0xf2, 0xff, 0xf0, 0xea, 0xeb, 0xff, 0xf0, 0xea, 0xea, 0xff, 0xf3, 0xed, 0xee, 0xff, 0xf2, 0xef, 0xef, 0xff, 0xfa, 0xf4, 0xf0, 0xff, 0xf8, 0xf1, 0xef, 0xff, 0xf9, 0xf5, 0xf4, 0xff, 0xf0, 0xea, 0xea, 0xff, 0xd9, 0xd4, 0xd5, 0xff, 0xee, 0xea, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0x9e, 0xa1, 0xa1, 0xff, 0xb2, 0xb4, 0xb5, 0xff, 0xb1, 0xb3, 0xb4, 0xff, 0xb2, 0xb4, 0xb5, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb5, 0xb6, 0xb8, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb3, 0xb8, 0xb7, 0xff, 0xb4, 0xb7, 0xb7, 0xff, 0xb5, 0xb6, 0xb7, 0xff, 0xb3, 0xb5, 0xb5, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xc0, 0xc0, 0x51, 0xbd, 0xbf, 0xc0, 0xff, 0xbd, 0xbf, 0xc0, 0xff, 0xbe, 0xc0, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc0, 0xc3, 0xc3, 0xff, 0xaf, 0xae, 0xaf, 0xff, 0xd2, 0xcb, 0xcb, 0xff, 0xe6, 0xe0, 0xdf, 0xff, 0xbd, 0xb6, 0xb9, 0xff, 0xbb, 0xb4, 0xb7, 0xff, 0xe6, 0xe1, 0xdf, 0xff, 0xf8, 0xf0, 0xed, 0xff, 0xf5, 0xee, 0xee, 0xff, 0xe7, 0xe1, 0xe2, 0xff, 0xda, 0xd5, 0xd6, 0xff, 0xe9, 0xe4, 0xe3, 0xff, 0xef, 0xea, 0xe8, 0xff, 0xf4, 0xf0, 0xef, 0xff, 0xd8, 0xd1, 0xd2, 0xff, 0xcd, 0xc2, 0xc1, 0xff, 0xf3, 0xe7, 0xe3, 0xff, 0xf7, 0xef, 0xeb, 0xff, 0xfa, 0xf1, 0xed, 0xff, 0xf9, 0xef, 0xeb, 0xff, 0xf6, 0xee, 0xe9, 0xff, 0xee, 0xe8, 0xe4, 0xff, 0xea, 0xe3, 0xe2, 0xff, 0xe1, 0xdc, 0xdc, 0xff, 0xda, 0xd5, 0xd5, 0xff, 0xd5, 0xcf, 0xd1, 0xff, 0xd7, 0xd2, 0xd3, 0xff, 0xd6, 0xd0, 0xd1, 0xff, 0xd8, 0xd3, 0xd4, 0xff, 0xdd, 0xd8, 0xda, 0xff, 0xe0, 0xdb, 0xdb, 0xff, 0xe0, 0xdb, 0xdb, 0xff, 0xdd, 0xd8, 0xd9, 0xff, 0xda, 0xd6, 0xd7, 0xff, 0xd9, 0xd4, 0xd5, 0xff, 0xe0, 0xdb, 0xdc, 0xff, 0xde, 0xd9, 0xda, 0xff, 0xdb, 0xd5, 0xd7, 0xff, 0xd6, 0xd0, 0xd1, 0xff, 0xdb, 0xd5, 0xd4, 0xff, 0xe5, 0xde, 0xdd, 0xff, 0xed, 0xe7, 0xe3, 0xff, 0xf3, 0xec, 0xe5, 0xff, 0xf7, 0xed, 0xe2, 0xff, 0xf1, 0xe7, 0xe0, 0xff, 0xe2, 0xe0, 0xdb, 0xff, 0xe5, 0xdd, 0xd1, 0xff, 0xe4, 0xda, 0xce, 0xff, 0xef, 0xe5, 0xe1, 0xff, 0xdd, 0xd6, 0xd3, 0xff, 0xd2, 0xcf, 0xce, 0xff, 0xdb, 0xd6, 0xd7, 0xff, 0xe2, 0xdc, 0xde, 0xff, 0xe2, 0xdd, 0xde, 0xff, 0xe1, 0xdc, 0xdd, 0xff, 0xe8, 0xe4, 0xe4, 0xff, 0xe8, 0xe3, 0xe3, 0xff, 0xe6, 0xe0, 0xe2, 0xff, 0xe7, 0xe2, 0xe3, 0xff, 0xe9, 0xe4, 0xe5, 0xff, 0xe8, 0xe3, 0xe4, 0xff, 0xec, 0xe5, 0xe7, 0xff, 0xec, 0xe6, 0xe6, 0xff, 0xed, 0xe9, 0xe7, 0xff, 0xeb, 0xe7, 0xe6, 0xff, 0xec, 0xe7, 0xe6, 0xff, 0xef, 0xea, 0xeb, 0xff, 0xf1, 0xec, 0xec, 0xff, 0xee, 0xe9, 0xe8, 0xff, 0xe4, 0xdb, 0xd7, 0xff, 0xde, 0xd3, 0xcd, 0xff, 0xd8, 0xce, 0xcb, 0xff, 0xf6, 0xe9, 0xe1, 0xff, 0xe3, 0xd6, 0xc9, 0xff, 0x6c, 0x79, 0xa0, 0xff, 0x81, 0x9b, 0xe2, 0xff, 0x87, 0x9a, 0xd2, 0xff, 0xd2, 0xcf, 0xd4, 0xff, 0xfc, 0xf3, 0xef, 0xff, 0xf0, 0xe9, 0xea, 0xff, 0xfc, 0xf4, 0xf3, 0xff, 0xff, 0xfd, 0xf5, 0xff, 0xfc, 0xf4, 0xef, 0xff, 0xee, 0xe9, 0xea, 0xff, 0xf7, 0xf5, 0xf3, 0xff, 0xf1, 0xec, 0xec, 0xff, 0xdc, 0xd8, 0xd7, 0xff, 0xf3, 0xee, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xed, 0xe7, 0xff, 0xa4, 0xa5, 0xa4, 0xff, 0xaa, 0xac, 0xac, 0xff, 0xb0, 0xb2, 0xb3, 0xff, 0xb1, 0xb4, 0xb5, 0xff, 0xb2, 0xb4, 0xb6, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb5, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb3, 0xb8, 0xb7, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb4, 0xb5, 0xb7, 0xff, 0xb3, 0xb3, 0xb6, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xbc, 0xbd, 0xbe, 0xce, 0xbd, 0xbf, 0xc0, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xbf, 0xc2, 0xc3, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc4, 0xc6, 0xc6, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0xc4, 0xbf, 0xbd, 0xff, 0xed, 0xe6, 0xe4, 0xff, 0xd0, 0xca, 0xcb, 0xff, 0xb9, 0xb2, 0xb4, 0xff, 0xda, 0xd4, 0xd1, 0xff, 0xf8, 0xf3, 0xf0, 0xff, 0xf9, 0xf1, 0xf1, 0xff, 0xea, 0xe5, 0xe6, 0xff, 0xe0, 0xd9, 0xdb, 0xff, 0xea, 0xe4, 0xe3, 0xff, 0xf0, 0xea, 0xe9, 0xff, 0xf7, 0xf1, 0xf1, 0xff, 0xe0, 0xd9, 0xda, 0xff, 0xca, 0xc1, 0xc0, 0xff, 0xe9, 0xdf, 0xdb, 0xff, 0xf6, 0xec, 0xe7, 0xff, 0xfa, 0xf0, 0xec, 0xff, 0xf9, 0xf0, 0xeb, 0xff, 0xf6, 0xf0, 0xeb, 0xff, 0xf1, 0xec, 0xe7, 0xff, 0xea, 0xe5, 0xe0, 0xff, 0xde, 0xda, 0xd8, 0xff, 0xdb, 0xd6, 0xd5, 0xff, 0xd8, 0xd2, 0xd3, 0xff, 0xd6, 0xd1, 0xd2, 0xff, 0xd3, 0xcd, 0xce, 0xff, 0xd7, 0xd0, 0xd2, 0xff, 0xdd, 0xd7, 0xd8, 0xff, 0xe3, 0xde, 0xdd, 0xff, 0xe2, 0xdd, 0xdd, 0xff, 0xdf, 0xd9, 0xdb, 0xff, 0xdd, 0xd8, 0xd9, 0xff, 0xda, 0xd6, 0xd5, 0xff, 0xe3, 0xdf, 0xde, 0xff, 0xe3, 0xdf, 0xde, 0xff, 0xde, 0xda, 0xda, 0xff, 0xd9, 0xd3, 0xd3, 0xff, 0xda, 0xd5, 0xd4, 0xff, 0xe3, 0xdc, 0xdd, 0xff, 0xeb, 0xe4, 0xe3, 0xff, 0xf1, 0xea, 0xe4, 0xff, 0xf9, 0xef, 0xe5, 0xff, 0xca, 0xd0, 0xce, 0xff, 0xa5, 0xba, 0xc1, 0xff, 0xbd, 0xc3, 0xbf, 0xff, 0xe4, 0xda, 0xce, 0xff, 0xe9, 0xe0, 0xd9, 0xff, 0xd2, 0xcc, 0xc9, 0xff, 0xcf, 0xcb, 0xcc, 0xff, 0xe0, 0xdb, 0xdc, 0xff, 0xde, 0xd9, 0xd9, 0xff, 0xde, 0xd9, 0xda, 0xff, 0xe1, 0xdc, 0xdd, 0xff, 0xe4, 0xdf, 0xe0, 0xff, 0xe7, 0xe3, 0xe2, 0xff, 0xe8, 0xe3, 0xe3, 0xff, 0xe6, 0xe1, 0xe2, 0xff, 0xe7, 0xe2, 0xe4, 0xff, 0xe7, 0xe1, 0xe2, 0xff, 0xeb, 0xe4, 0xe5, 0xff, 0xed, 0xe8, 0xe9, 0xff, 0xee, 0xe8, 0xea, 0xff, 0xed, 0xe7, 0xe8, 0xff, 0xed, 0xe8, 0xe9, 0xff, 0xf0, 0xeb, 0xec, 0xff, 0xf1, 0xec, 0xec, 0xff, 0xef, 0xe7, 0xe6, 0xff, 0xe8, 0xdf, 0xdb, 0xff, 0xe2, 0xd6, 0xcf, 0xff, 0xda, 0xd1, 0xca, 0xff, 0xf7, 0xe8, 0xda, 0xff, 0x71, 0x77, 0xa0, 0xff, 0x49, 0x64, 0xaf, 0xff, 0x85, 0x98, 0xdf, 0xff, 0x80, 0x8c, 0xbd, 0xff, 0xff, 0xf5, 0xea, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xf7, 0xef, 0xff, 0xe4, 0xdd, 0xdf, 0xff, 0xc2, 0xc5, 0xd2, 0xff, 0xa2, 0xad, 0xd4, 0xff, 0x99, 0xac, 0xde, 0xff, 0xd6, 0xdc, 0xe6, 0xff, 0xea, 0xe1, 0xdb, 0xff, 0xf6, 0xf2, 0xee, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe6, 0xe2, 0xde, 0xff, 0xa1, 0xa1, 0xa2, 0xff, 0xae, 0xaf, 0xb0, 0xff, 0xb0, 0xb2, 0xb4, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb3, 0xb5, 0xb7, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb4, 0xb7, 0xb7, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb3, 0xb6, 0xb6, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb3, 0xb5, 0xb7, 0xce, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xbd, 0xbd, 0x46, 0xbd, 0xbf, 0xbf, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc2, 0xc3, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xc3, 0xc5, 0xc7, 0xff, 0xae, 0xaf, 0xb0, 0xff, 0xb8, 0xb2, 0xb2, 0xff, 0xef, 0xe6, 0xe6, 0xff, 0xe3, 0xdd, 0xdc, 0xff, 0xbe, 0xb9, 0xba, 0xff, 0xcf, 0xc6, 0xc9, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xf6, 0xf1, 0xed, 0xff, 0xe2, 0xdc, 0xdd, 0xff, 0xeb, 0xe3, 0xe4, 0xff, 0xf4, 0xec, 0xeb, 0xff, 0xf9, 0xf0, 0xf1, 0xff, 0xe9, 0xe1, 0xe2, 0xff, 0xc9, 0xc1, 0xc2, 0xff, 0xdf, 0xd5, 0xd3, 0xff, 0xf5, 0xea, 0xe5, 0xff, 0xf8, 0xee, 0xea, 0xff, 0xf4, 0xec, 0xe8, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xee, 0xe9, 0xff, 0xe8, 0xe1, 0xdf, 0xff, 0xde, 0xda, 0xd9, 0xff, 0xdc, 0xd7, 0xd7, 0xff, 0xd5, 0xd0, 0xcf, 0xff, 0xd1, 0xcc, 0xcb, 0xff, 0xd6, 0xd0, 0xd1, 0xff, 0xda, 0xd4, 0xd5, 0xff, 0xdb, 0xd6, 0xd6, 0xff, 0xe0, 0xdb, 0xda, 0xff, 0xe1, 0xdc, 0xdb, 0xff, 0xe1, 0xdc, 0xdc, 0xff, 0xe0, 0xdb, 0xdc, 0xff, 0xdd, 0xd8, 0xd8, 0xff, 0xe2, 0xdd, 0xdc, 0xff, 0xe4, 0xe0, 0xdf, 0xff, 0xe0, 0xdb, 0xda, 0xff, 0xda, 0xd5, 0xd4, 0xff, 0xda, 0xd4, 0xd4, 0xff, 0xe3, 0xdd, 0xdc, 0xff, 0xe9, 0xe1, 0xdf, 0xff, 0xee, 0xe6, 0xe3, 0xff, 0xf9, 0xee, 0xe8, 0xff, 0xce, 0xd2, 0xcf, 0xff, 0xbb, 0xc9, 0xcb, 0xff, 0xdc, 0xda, 0xd2, 0xff, 0xe1, 0xd7, 0xcc, 0xff, 0xe3, 0xda, 0xd0, 0xff, 0xd5, 0xce, 0xcb, 0xff, 0xcc, 0xc5, 0xc7, 0xff, 0xde, 0xd8, 0xda, 0xff, 0xdf, 0xda, 0xda, 0xff, 0xde, 0xd9, 0xda, 0xff, 0xe2, 0xdd, 0xde, 0xff, 0xe6, 0xe1, 0xe3, 0xff, 0xea, 0xe6, 0xe5, 0xff, 0xeb, 0xe7, 0xe7, 0xff, 0xe9, 0xe4, 0xe5, 0xff, 0xe9, 0xe3, 0xe4, 0xff, 0xea, 0xe4, 0xe5, 0xff, 0xea, 0xe4, 0xe5, 0xff, 0xee, 0xe8, 0xe9, 0xff, 0xef, 0xea, 0xea, 0xff, 0xef, 0xea, 0xe9, 0xff, 0xf0, 0xea, 0xeb, 0xff, 0xf1, 0xeb, 0xeb, 0xff, 0xf2, 0xed, 0xec, 0xff, 0xec, 0xe2, 0xe3, 0xff, 0xe6, 0xdc, 0xd7, 0xff, 0xdc, 0xd3, 0xce, 0xff, 0xf6, 0xe6, 0xd5, 0xff, 0x9c, 0x99, 0xa5, 0xff, 0x25, 0x43, 0x98, 0xff, 0x8c, 0xa5, 0xee, 0xff, 0x5c, 0x74, 0xb9, 0xff, 0xb2, 0xb4, 0xc0, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xae, 0xac, 0xbe, 0xff, 0x62, 0x77, 0xa6, 0xff, 0x5a, 0x77, 0xb6, 0xff, 0x70, 0x88, 0xc6, 0xff, 0x89, 0x9e, 0xde, 0xff, 0x8b, 0xa1, 0xeb, 0xff, 0xce, 0xcf, 0xe1, 0xff, 0xff, 0xf8, 0xed, 0xff, 0xff, 0xfc, 0xf8, 0xff, 0xfb, 0xf8, 0xf2, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xf3, 0xed, 0xea, 0xff, 0xaf, 0xad, 0xae, 0xff, 0xa9, 0xab, 0xac, 0xff, 0xb0, 0xb3, 0xb4, 0xff, 0xb1, 0xb3, 0xb3, 0xff, 0xb0, 0xb2, 0xb2, 0xff, 0xb1, 0xb3, 0xb3, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb4, 0xb6, 0xb5, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb6, 0xb5, 0xb5, 0xff, 0xb6, 0xb5, 0xb5, 0xff, 0xb3, 0xb3, 0xb3, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbf, 0xbf, 0xb4, 0xc0, 0xc2, 0xc2, 0xff, 0xc0, 0xc2, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc1, 0xc3, 0xc4, 0xff, 0xb5, 0xb5, 0xb7, 0xff, 0xb7, 0xb0, 0xaf, 0xff, 0xe3, 0xda, 0xd9, 0xff, 0xf0, 0xea, 0xe6, 0xff, 0xd4, 0xd0, 0xd0, 0xff, 0xca, 0xc2, 0xc1, 0xff, 0xca, 0xce, 0xd8, 0xff, 0xcb, 0xd1, 0xe8, 0xff, 0xf0, 0xec, 0xeb, 0xff, 0xfe, 0xf2, 0xe5, 0xff, 0xff, 0xf4, 0xea, 0xff, 0xf5, 0xef, 0xef, 0xff, 0xf5, 0xec, 0xee, 0xff, 0xf4, 0xeb, 0xeb, 0xff, 0xcc, 0xc5, 0xc6, 0xff, 0xd3, 0xca, 0xca, 0xff, 0xf5, 0xe8, 0xe4, 0xff, 0xf5, 0xec, 0xe8, 0xff, 0xf4, 0xeb, 0xe7, 0xff, 0xf7, 0xef, 0xeb, 0xff, 0xf5, 0xed, 0xe9, 0xff, 0xe6, 0xdf, 0xdc, 0xff, 0xe5, 0xde, 0xdd, 0xff, 0xdf, 0xda, 0xd9, 0xff, 0xd2, 0xcd, 0xcc, 0xff, 0xd1, 0xcc, 0xcb, 0xff, 0xdb, 0xd5, 0xd6, 0xff, 0xdc, 0xd6, 0xd6, 0xff, 0xdb, 0xd6, 0xd4, 0xff, 0xdf, 0xda, 0xda, 0xff, 0xe3, 0xde, 0xdc, 0xff, 0xe3, 0xde, 0xdd, 0xff, 0xe5, 0xde, 0xdf, 0xff, 0xe5, 0xdc, 0xdd, 0xff, 0xe1, 0xdc, 0xdb, 0xff, 0xe5, 0xe1, 0xe0, 0xff, 0xe3, 0xdf, 0xdd, 0xff, 0xdc, 0xd7, 0xd6, 0xff, 0xdd, 0xd4, 0xd4, 0xff, 0xe0, 0xd8, 0xd6, 0xff, 0xe6, 0xdf, 0xdc, 0xff, 0xef, 0xe6, 0xe3, 0xff, 0xf6, 0xee, 0xe9, 0xff, 0xf6, 0xed, 0xe5, 0xff, 0xf6, 0xee, 0xe4, 0xff, 0xf4, 0xe9, 0xd9, 0xff, 0xe6, 0xdc, 0xd0, 0xff, 0xe6, 0xdb, 0xd4, 0xff, 0xd4, 0xcb, 0xc7, 0xff, 0xce, 0xc5, 0xc7, 0xff, 0xd7, 0xd0, 0xd0, 0xff, 0xe9, 0xe4, 0xe4, 0xff, 0xe4, 0xdf, 0xe0, 0xff, 0xe0, 0xdb, 0xdd, 0xff, 0xe9, 0xe4, 0xe4, 0xff, 0xe8, 0xe4, 0xe4, 0xff, 0xea, 0xe5, 0xe6, 0xff, 0xe9, 0xe4, 0xe5, 0xff, 0xea, 0xe4, 0xe5, 0xff, 0xec, 0xe6, 0xe7, 0xff, 0xec, 0xe6, 0xe8, 0xff, 0xed, 0xe6, 0xe7, 0xff, 0xee, 0xe9, 0xe8, 0xff, 0xef, 0xea, 0xe9, 0xff, 0xf0, 0xeb, 0xea, 0xff, 0xf1, 0xec, 0xea, 0xff, 0xf2, 0xed, 0xec, 0xff, 0xe6, 0xdf, 0xdf, 0xff, 0xe0, 0xd5, 0xd4, 0xff, 0xed, 0xde, 0xd3, 0xff, 0xd0, 0xc5, 0xbf, 0xff, 0x4d, 0x63, 0x9e, 0xff, 0x66, 0x84, 0xd0, 0xff, 0x5c, 0x78, 0xc4, 0xff, 0x73, 0x7d, 0x9f, 0xff, 0xd3, 0xcd, 0xc9, 0xff, 0x77, 0x89, 0xb1, 0xff, 0x39, 0x59, 0x9f, 0xff, 0x45, 0x6a, 0xb6, 0xff, 0x87, 0xa7, 0xe6, 0xff, 0x98, 0xb2, 0xed, 0xff, 0x7c, 0x92, 0xdb, 0xff, 0xb2, 0xba, 0xe3, 0xff, 0xff, 0xf8, 0xf4, 0xff, 0xff, 0xf6, 0xf4, 0xff, 0xfa, 0xf5, 0xf2, 0xff, 0xfb, 0xf7, 0xf4, 0xff, 0xfd, 0xf5, 0xf4, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xbd, 0xbd, 0xbe, 0xff, 0xa2, 0xa5, 0xa7, 0xff, 0xaf, 0xb1, 0xb1, 0xff, 0xb0, 0xb2, 0xb2, 0xff, 0xb0, 0xb2, 0xb2, 0xff, 0xb1, 0xb3, 0xb3, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb5, 0xb7, 0xb6, 0xff, 0xb6, 0xb8, 0xb9, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb4, 0xb6, 0xb7, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb4, 0xb5, 0xb6, 0xff, 0xb5, 0xb3, 0xb5, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xbd, 0xbd, 0x27, 0xbf, 0xc1, 0xc1, 0xfa, 0xc0, 0xc2, 0xc2, 0xff, 0xbf, 0xc1, 0xc1, 0xff, 0xc0, 0xc1, 0xc1, 0xff, 0xbd, 0xbb, 0xbd, 0xff, 0xb7, 0xaf, 0xae, 0xff, 0xd0, 0xc6, 0xc4, 0xff, 0xe8, 0xe1, 0xdc, 0xff, 0xe8, 0xe2, 0xe0, 0xff, 0xcf, 0xc5, 0xc0, 0xff, 0x5c, 0x73, 0xb2, 0xff, 0x5b, 0x77, 0xcd, 0xff, 0x72, 0x86, 0xc2, 0xff, 0x89, 0x97, 0xc8, 0xff, 0xb9, 0xbe, 0xd3, 0xff, 0xf9, 0xf0, 0xe9, 0xff, 0xff, 0xfd, 0xf2, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xd3, 0xca, 0xcc, 0xff, 0xc9, 0xc2, 0xc3, 0xff, 0xed, 0xe2, 0xde, 0xff, 0xf3, 0xe8, 0xe3, 0xff, 0xf5, 0xed, 0xe9, 0xff, 0xf4, 0xea, 0xe7, 0xff, 0xf3, 0xe9, 0xe6, 0xff, 0xe6, 0xe0, 0xdb, 0xff, 0xea, 0xe3, 0xe0, 0xff, 0xe0, 0xda, 0xd8, 0xff, 0xd5, 0xcf, 0xcf, 0xff, 0xd4, 0xce, 0xce, 0xff, 0xde, 0xd8, 0xd9, 0xff, 0xdb, 0xd7, 0xd6, 0xff, 0xdc, 0xd6, 0xd7, 0xff, 0xe2, 0xdc, 0xdd, 0xff, 0xe3, 0xdd, 0xde, 0xff, 0xe5, 0xe0, 0xdf, 0xff, 0xe8, 0xe1, 0xde, 0xff, 0xe7, 0xde, 0xdd, 0xff, 0xe7, 0xe1, 0xe1, 0xff, 0xe6, 0xe1, 0xe0, 0xff, 0xe1, 0xdd, 0xdd, 0xff, 0xe1, 0xdb, 0xdb, 0xff, 0xe3, 0xdb, 0xd7, 0xff, 0xdc, 0xd4, 0xd1, 0xff, 0xe3, 0xdb, 0xd9, 0xff, 0xf1, 0xe8, 0xe2, 0xff, 0xf8, 0xf0, 0xe8, 0xff, 0xfb, 0xf2, 0xe8, 0xff, 0xfc, 0xf1, 0xe5, 0xff, 0xf0, 0xe3, 0xd5, 0xff, 0xf3, 0xe7, 0xdb, 0xff, 0xe5, 0xda, 0xd4, 0xff, 0xc6, 0xbc, 0xb8, 0xff, 0xd4, 0xcc, 0xcc, 0xff, 0xde, 0xd8, 0xd8, 0xff, 0xea, 0xe6, 0xe6, 0xff, 0xe7, 0xe2, 0xe3, 0xff, 0xe1, 0xdc, 0xdd, 0xff, 0xe8, 0xe3, 0xe4, 0xff, 0xe8, 0xe3, 0xe4, 0xff, 0xe8, 0xe3, 0xe5, 0xff, 0xe8, 0xe3, 0xe4, 0xff, 0xe9, 0xe4, 0xe5, 0xff, 0xeb, 0xe5, 0xe6, 0xff, 0xed, 0xe7, 0xe8, 0xff, 0xec, 0xe7, 0xe8, 0xff, 0xef, 0xea, 0xea, 0xff, 0xf0, 0xeb, 0xeb, 0xff, 0xef, 0xe9, 0xea, 0xff, 0xf1, 0xed, 0xec, 0xff, 0xf2, 0xec, 0xec, 0xff, 0xe2, 0xda, 0xdb, 0xff, 0xd5, 0xcb, 0xc8, 0xff, 0xf2, 0xde, 0xce, 0xff, 0x6f, 0x7f, 0xa7, 0xff, 0x6e, 0x8e, 0xd2, 0xff, 0x92, 0xaa, 0xe7, 0xff, 0x4e, 0x64, 0x98, 0xff, 0x8a, 0x8f, 0x9c, 0xff, 0x58, 0x75, 0xa8, 0xff, 0x63, 0x85, 0xc2, 0xff, 0xa7, 0xc0, 0xee, 0xff, 0x99, 0xb7, 0xec, 0xff, 0x61, 0x81, 0xc4, 0xff, 0x78, 0x8d, 0xc3, 0xff, 0xd5, 0xd3, 0xe6, 0xff, 0xff, 0xfb, 0xf2, 0xff, 0xfd, 0xf8, 0xf3, 0xff, 0xf6, 0xf0, 0xf1, 0xff, 0xfb, 0xf6, 0xf5, 0xff, 0xfc, 0xf6, 0xf6, 0xff, 0xf9, 0xf3, 0xf3, 0xff, 0xff, 0xfc, 0xf8, 0xff, 0xc9, 0xc6, 0xc5, 0xff, 0x9e, 0xa3, 0xa4, 0xff, 0xaf, 0xb0, 0xb0, 0xff, 0xaf, 0xb3, 0xb2, 0xff, 0xb1, 0xb3, 0xb3, 0xff, 0xb0, 0xb2, 0xb2, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb5, 0xb7, 0xb6, 0xff, 0xb6, 0xb8, 0xb8, 0xff, 0xb7, 0xb9, 0xb9, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb3, 0xb5, 0xb6, 0xff, 0xb2, 0xb5, 0xb6, 0xfa, 0xb2, 0xb8, 0xb8, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xc1, 0xc1, 0x88, 0xbf, 0xc2, 0xc1, 0xff, 0xbf, 0xc0, 0xc1, 0xff, 0xc2, 0xc5, 0xc5, 0xff, 0xb7, 0xb9, 0xb9, 0xff, 0xa9, 0xa1, 0xa0, 0xff, 0xcf, 0xc2, 0xc3, 0xff, 0xdd, 0xd3, 0xd2, 0xff, 0xe9, 0xe2, 0xe0, 0xff, 0xde, 0xd6, 0xcf, 0xff, 0x89, 0x89, 0xac, 0xff, 0x34, 0x47, 0xa5, 0xff, 0x4f, 0x6a, 0xc4, 0xff, 0x54, 0x72, 0xcc, 0xff, 0x5c, 0x7a, 0xc4, 0xff, 0x89, 0x9d, 0xcb, 0xff, 0xca, 0xca, 0xdc, 0xff, 0xff, 0xfd, 0xf6, 0xff, 0xf3, 0xe5, 0xda, 0xff, 0xc7, 0xbc, 0xbe, 0xff, 0xe4, 0xda, 0xda, 0xff, 0xf0, 0xe6, 0xe2, 0xff, 0xf4, 0xe9, 0xe6, 0xff, 0xf6, 0xee, 0xe9, 0xff, 0xf3, 0xec, 0xe8, 0xff, 0xeb, 0xe5, 0xe2, 0xff, 0xed, 0xe7, 0xe4, 0xff, 0xe1, 0xd9, 0xda, 0xff, 0xd9, 0xd3, 0xd2, 0xff, 0xd8, 0xd2, 0xd3, 0xff, 0xe0, 0xda, 0xdb, 0xff, 0xdf, 0xda, 0xd9, 0xff, 0xdf, 0xd9, 0xdb, 0xff, 0xe5, 0xdf, 0xe1, 0xff, 0xe5, 0xde, 0xe0, 0xff, 0xea, 0xe5, 0xe4, 0xff, 0xea, 0xe5, 0xe2, 0xff, 0xea, 0xe4, 0xe0, 0xff, 0xed, 0xe6, 0xe6, 0xff, 0xe9, 0xe2, 0xe2, 0xff, 0xde, 0xd8, 0xd9, 0xff, 0xe1, 0xdb, 0xdb, 0xff, 0xe4, 0xdd, 0xda, 0xff, 0xd9, 0xd1, 0xcf, 0xff, 0xde, 0xd7, 0xd4, 0xff, 0xf4, 0xeb, 0xe5, 0xff, 0xfa, 0xef, 0xe7, 0xff, 0xfb, 0xf2, 0xe9, 0xff, 0xf7, 0xee, 0xe5, 0xff, 0xf0, 0xe3, 0xd8, 0xff, 0xf8, 0xeb, 0xde, 0xff, 0xe0, 0xd6, 0xd1, 0xff, 0xcc, 0xc2, 0xc3, 0xff, 0xe5, 0xe0, 0xe0, 0xff, 0xe3, 0xdd, 0xde, 0xff, 0xe5, 0xe0, 0xe1, 0xff, 0xe5, 0xe0, 0xe1, 0xff, 0xe6, 0xe1, 0xe2, 0xff, 0xe6, 0xe2, 0xe3, 0xff, 0xe9, 0xe5, 0xe6, 0xff, 0xe9, 0xe5, 0xe6, 0xff, 0xe6, 0xe1, 0xe2, 0xff, 0xe7, 0xe2, 0xe3, 0xff, 0xe9, 0xe4, 0xe5, 0xff, 0xea, 0xe5, 0xe6, 0xff, 0xec, 0xe7, 0xe8, 0xff, 0xef, 0xea, 0xea, 0xff, 0xf2, 0xed, 0xeb, 0xff, 0xf1, 0xec, 0xeb, 0xff, 0xf0, 0xeb, 0xeb, 0xff, 0xf2, 0xeb, 0xec, 0xff, 0xdd, 0xd5, 0xd8, 0xff, 0xd8, 0xc8, 0xbb, 0xff, 0x9a, 0x9c, 0xaa, 0xff, 0x56, 0x75, 0xba, 0xff, 0x9a, 0xb4, 0xe7, 0xff, 0x58, 0x73, 0xae, 0xff, 0x4a, 0x65, 0x99, 0xff, 0x58, 0x7b, 0xb0, 0xff, 0x81, 0xa1, 0xd3, 0xff, 0xbf, 0xd1, 0xf3, 0xff, 0xa6, 0xc3, 0xf0, 0xff, 0x68, 0x89, 0xc9, 0xff, 0x89, 0x8e, 0xaf, 0xff, 0xec, 0xe4, 0xe2, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfc, 0xf6, 0xf3, 0xff, 0xf4, 0xf0, 0xf1, 0xff, 0xf8, 0xf3, 0xf2, 0xff, 0xfb, 0xf8, 0xf5, 0xff, 0xfc, 0xf4, 0xf4, 0xff, 0xf6, 0xef, 0xf1, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xd2, 0xcd, 0xca, 0xff, 0x9d, 0xa1, 0xa1, 0xff, 0xb0, 0xb1, 0xb1, 0xff, 0xaf, 0xb2, 0xb2, 0xff, 0xb1, 0xb3, 0xb3, 0xff, 0xb1, 0xb3, 0xb3, 0xff, 0xb1, 0xb3, 0xb3, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb5, 0xb7, 0xb6, 0xff, 0xb6, 0xb8, 0xb7, 0xff, 0xb6, 0xb8, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb1, 0xb3, 0xb3, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb4, 0xb6, 0xb8, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x09, 0xbd, 0xc0, 0xc0, 0xdb, 0xbe, 0xc0, 0xc0, 0xff, 0xc7, 0xcb, 0xcc, 0xff, 0xa9, 0xa9, 0xaa, 0xff, 0x9f, 0x97, 0x96, 0xff, 0xd2, 0xc9, 0xc9, 0xff, 0xd1, 0xc6, 0xc8, 0xff, 0xe4, 0xd9, 0xdb, 0xff, 0xf1, 0xea, 0xe6, 0xff, 0xe2, 0xd2, 0xc7, 0xff, 0x8b, 0x89, 0xa7, 0xff, 0x3a, 0x4e, 0xa0, 0xff, 0x3a, 0x5a, 0xb2, 0xff, 0x71, 0x8c, 0xd0, 0xff, 0x7d, 0x9e, 0xdb, 0xff, 0x62, 0x84, 0xc7, 0xff, 0x85, 0x96, 0xcb, 0xff, 0xc3, 0xc2, 0xd2, 0xff, 0xc7, 0xbe, 0xb9, 0xff, 0xe0, 0xd5, 0xd5, 0xff, 0xef, 0xe4, 0xe2, 0xff, 0xf2, 0xe7, 0xe3, 0xff, 0xf5, 0xee, 0xe9, 0xff, 0xf3, 0xed, 0xe8, 0xff, 0xf2, 0xe9, 0xe6, 0xff, 0xed, 0xe5, 0xe3, 0xff, 0xe5, 0xdd, 0xde, 0xff, 0xdb, 0xd6, 0xd6, 0xff, 0xdc, 0xd7, 0xd8, 0xff, 0xe2, 0xdd, 0xdc, 0xff, 0xe2, 0xde, 0xdc, 0xff, 0xe2, 0xdc, 0xde, 0xff, 0xe8, 0xe2, 0xe4, 0xff, 0xea, 0xe4, 0xe5, 0xff, 0xeb, 0xe6, 0xe6, 0xff, 0xea, 0xe5, 0xe4, 0xff, 0xeb, 0xe6, 0xe3, 0xff, 0xf0, 0xe9, 0xe9, 0xff, 0xee, 0xe6, 0xe5, 0xff, 0xe1, 0xda, 0xd8, 0xff, 0xe0, 0xdb, 0xdb, 0xff, 0xe0, 0xdb, 0xda, 0xff, 0xd9, 0xd1, 0xd2, 0xff, 0xdb, 0xd2, 0xd0, 0xff, 0xf3, 0xe8, 0xe3, 0xff, 0xfa, 0xf0, 0xe7, 0xff, 0xf9, 0xee, 0xe6, 0xff, 0xfb, 0xf0, 0xe7, 0xff, 0xf1, 0xe3, 0xd9, 0xff, 0xf1, 0xe4, 0xd6, 0xff, 0xe9, 0xde, 0xda, 0xff, 0xe1, 0xda, 0xdd, 0xff, 0xef, 0xea, 0xeb, 0xff, 0xde, 0xd8, 0xd9, 0xff, 0xe0, 0xdb, 0xdc, 0xff, 0xe6, 0xe1, 0xe2, 0xff, 0xee, 0xe8, 0xe9, 0xff, 0xeb, 0xe5, 0xe6, 0xff, 0xe8, 0xe3, 0xe4, 0xff, 0xe8, 0xe3, 0xe4, 0xff, 0xe7, 0xe2, 0xe3, 0xff, 0xe8, 0xe4, 0xe5, 0xff, 0xea, 0xe5, 0xe6, 0xff, 0xea, 0xe6, 0xe7, 0xff, 0xeb, 0xe7, 0xe8, 0xff, 0xee, 0xe9, 0xe9, 0xff, 0xf1, 0xec, 0xeb, 0xff, 0xf2, 0xed, 0xec, 0xff, 0xf1, 0xec, 0xeb, 0xff, 0xf3, 0xed, 0xee, 0xff, 0xdd, 0xd3, 0xd0, 0xff, 0x9a, 0x94, 0xa1, 0xff, 0x3b, 0x58, 0x9a, 0xff, 0x6d, 0x8d, 0xcd, 0xff, 0x5c, 0x77, 0xae, 0xff, 0x30, 0x4f, 0x83, 0xff, 0x58, 0x78, 0xb5, 0xff, 0x8d, 0xab, 0xdf, 0xff, 0xb4, 0xcc, 0xf5, 0xff, 0x94, 0xb4, 0xea, 0xff, 0x53, 0x77, 0xbc, 0xff, 0x97, 0x9e, 0xba, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf9, 0xf1, 0xef, 0xff, 0xfa, 0xf4, 0xf2, 0xff, 0xfa, 0xf3, 0xf1, 0xff, 0xfe, 0xf9, 0xf6, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfb, 0xf5, 0xf2, 0xff, 0xf0, 0xec, 0xec, 0xff, 0xfb, 0xf5, 0xf3, 0xff, 0xe6, 0xdf, 0xdc, 0xff, 0xa6, 0xa6, 0xa7, 0xff, 0xad, 0xb0, 0xb1, 0xff, 0xaf, 0xb2, 0xb2, 0xff, 0xb1, 0xb3, 0xb3, 0xff, 0xb1, 0xb3, 0xb3, 0xff, 0xb1, 0xb3, 0xb3, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb3, 0xb6, 0xb5, 0xff, 0xb5, 0xb6, 0xb7, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb8, 0xff, 0xb7, 0xb7, 0xb8, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb3, 0xb6, 0xb5, 0xff, 0xb4, 0xb5, 0xb5, 0xdb, 0xaa, 0xaa, 0xaa, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x41, 0xbd, 0xc0, 0xc0, 0xfe, 0xc4, 0xc9, 0xca, 0xff, 0xa3, 0xa1, 0xa2, 0xff, 0xae, 0xa5, 0xa4, 0xff, 0xcd, 0xc5, 0xc3, 0xff, 0xd0, 0xc5, 0xc7, 0xff, 0xc2, 0xb7, 0xb8, 0xff, 0xf2, 0xe9, 0xe6, 0xff, 0xf7, 0xeb, 0xe8, 0xff, 0xf8, 0xe6, 0xdd, 0xff, 0xb5, 0xaa, 0xb6, 0xff, 0x52, 0x60, 0x92, 0xff, 0x2a, 0x4c, 0x9f, 0xff, 0x6c, 0x8b, 0xc9, 0xff, 0x8b, 0xa7, 0xdd, 0xff, 0x59, 0x7a, 0xc8, 0xff, 0x57, 0x75, 0xcf, 0xff, 0x8d, 0x94, 0xc0, 0xff, 0xdf, 0xd4, 0xcf, 0xff, 0xeb, 0xe2, 0xdf, 0xff, 0xec, 0xe4, 0xe1, 0xff, 0xf3, 0xea, 0xe6, 0xff, 0xf6, 0xec, 0xe9, 0xff, 0xf0, 0xe8, 0xe5, 0xff, 0xeb, 0xe3, 0xe1, 0xff, 0xe6, 0xdf, 0xdf, 0xff, 0xdf, 0xd8, 0xda, 0xff, 0xdd, 0xd6, 0xd7, 0xff, 0xdf, 0xdb, 0xd9, 0xff, 0xe3, 0xde, 0xde, 0xff, 0xe5, 0xe0, 0xdf, 0xff, 0xea, 0xe5, 0xe4, 0xff, 0xeb, 0xe6, 0xe7, 0xff, 0xeb, 0xe6, 0xe6, 0xff, 0xea, 0xe5, 0xe5, 0xff, 0xe9, 0xe4, 0xe4, 0xff, 0xed, 0xe9, 0xe8, 0xff, 0xee, 0xe9, 0xe7, 0xff, 0xe2, 0xdb, 0xda, 0xff, 0xe0, 0xda, 0xd9, 0xff, 0xe2, 0xdc, 0xda, 0xff, 0xdc, 0xd3, 0xd2, 0xff, 0xd7, 0xcd, 0xcc, 0xff, 0xec, 0xe1, 0xdb, 0xff, 0xfa, 0xef, 0xe5, 0xff, 0xf8, 0xee, 0xe2, 0xff, 0xfa, 0xf0, 0xe7, 0xff, 0xf2, 0xe5, 0xdb, 0xff, 0xf3, 0xe7, 0xda, 0xff, 0xf3, 0xe8, 0xe3, 0xff, 0xea, 0xe3, 0xe1, 0xff, 0xf1, 0xeb, 0xeb, 0xff, 0xe3, 0xdc, 0xdd, 0xff, 0xdb, 0xd5, 0xd6, 0xff, 0xe6, 0xe0, 0xe1, 0xff, 0xee, 0xe8, 0xe9, 0xff, 0xef, 0xe9, 0xea, 0xff, 0xe8, 0xe3, 0xe4, 0xff, 0xe9, 0xe3, 0xe4, 0xff, 0xeb, 0xe5, 0xe6, 0xff, 0xec, 0xe7, 0xe8, 0xff, 0xeb, 0xe6, 0xe7, 0xff, 0xec, 0xe6, 0xe7, 0xff, 0xee, 0xe9, 0xea, 0xff, 0xf1, 0xec, 0xec, 0xff, 0xf2, 0xed, 0xeb, 0xff, 0xf1, 0xec, 0xeb, 0xff, 0xf2, 0xed, 0xed, 0xff, 0xee, 0xe7, 0xea, 0xff, 0xce, 0xc1, 0xbc, 0xff, 0x55, 0x5f, 0x87, 0xff, 0x43, 0x62, 0xb1, 0xff, 0x5f, 0x7d, 0xb9, 0xff, 0x2b, 0x48, 0x7d, 0xff, 0x44, 0x62, 0x9a, 0xff, 0x82, 0xa0, 0xd5, 0xff, 0x9f, 0xba, 0xe9, 0xff, 0x73, 0x96, 0xd1, 0xff, 0x4a, 0x67, 0xa9, 0xff, 0x9f, 0xa3, 0xbb, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xfe, 0xf3, 0xff, 0xff, 0xfd, 0xf7, 0xff, 0xff, 0xf7, 0xf2, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xec, 0xea, 0xeb, 0xff, 0xe2, 0xe4, 0xec, 0xff, 0xee, 0xea, 0xe9, 0xff, 0xf3, 0xed, 0xea, 0xff, 0xf6, 0xf1, 0xf0, 0xff, 0xf5, 0xf0, 0xed, 0xff, 0xaf, 0xb1, 0xb1, 0xff, 0xa7, 0xaa, 0xac, 0xff, 0xb0, 0xb3, 0xb3, 0xff, 0xb0, 0xb2, 0xb2, 0xff, 0xb0, 0xb2, 0xb2, 0xff, 0xb1, 0xb3, 0xb3, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb6, 0xb7, 0xb7, 0xff, 0xb7, 0xb6, 0xb6, 0xff, 0xb5, 0xb7, 0xb7, 0xff, 0xb4, 0xb6, 0xb6, 0xfe, 0xb4, 0xb4, 0xb4, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xc2, 0xc2, 0x8f, 0xc1, 0xc4, 0xc4, 0xff, 0x9f, 0x9d, 0x9d, 0xff, 0xc1, 0xb8, 0xb6, 0xff, 0xc9, 0xc1, 0xbf, 0xff, 0xd5, 0xcb, 0xcc, 0xff, 0xc8, 0xbd, 0xc0, 0xff, 0xc6, 0xbc, 0xbd, 0xff, 0xf0, 0xe7, 0xe4, 0xff, 0xf9, 0xf0, 0xed, 0xff, 0xff, 0xf8, 0xee, 0xff, 0xeb, 0xd9, 0xd0, 0xff, 0x74, 0x7c, 0xa3, 0xff, 0x26, 0x4d, 0x99, 0xff, 0x5b, 0x81, 0xc1, 0xff, 0x89, 0xa5, 0xdf, 0xff, 0x8d, 0xa6, 0xe6, 0xff, 0x74, 0x8b, 0xda, 0xff, 0xbe, 0xba, 0xcd, 0xff, 0xf4, 0xe7, 0xde, 0xff, 0xe5, 0xdd, 0xdf, 0xff, 0xef, 0xe5, 0xe1, 0xff, 0xf2, 0xec, 0xe6, 0xff, 0xec, 0xe6, 0xe2, 0xff, 0xef, 0xe8, 0xe5, 0xff, 0xed, 0xe5, 0xe4, 0xff, 0xe7, 0xde, 0xde, 0xff, 0xe5, 0xde, 0xdf, 0xff, 0xe2, 0xdc, 0xde, 0xff, 0xe5, 0xdf, 0xe0, 0xff, 0xea, 0xe4, 0xe4, 0xff, 0xea, 0xe5, 0xe4, 0xff, 0xef, 0xea, 0xe9, 0xff, 0xef, 0xea, 0xe8, 0xff, 0xeb, 0xe6, 0xe5, 0xff, 0xe9, 0xe4, 0xe3, 0xff, 0xe9, 0xe4, 0xe2, 0xff, 0xea, 0xe4, 0xe4, 0xff, 0xe5, 0xe0, 0xe0, 0xff, 0xe1, 0xdc, 0xdb, 0xff, 0xe3, 0xda, 0xd7, 0xff, 0xdf, 0xd6, 0xd1, 0xff, 0xd6, 0xce, 0xcc, 0xff, 0xe9, 0xdd, 0xd7, 0xff, 0xf7, 0xec, 0xe0, 0xff, 0xfc, 0xf1, 0xe4, 0xff, 0xfc, 0xf2, 0xe8, 0xff, 0xfa, 0xec, 0xe0, 0xff, 0xfb, 0xee, 0xe1, 0xff, 0xf5, 0xeb, 0xe3, 0xff, 0xef, 0xe6, 0xe4, 0xff, 0xf1, 0xea, 0xe8, 0xff, 0xe8, 0xe3, 0xe3, 0xff, 0xdc, 0xd5, 0xd7, 0xff, 0xe0, 0xda, 0xdb, 0xff, 0xed, 0xe8, 0xe9, 0xff, 0xf0, 0xeb, 0xea, 0xff, 0xea, 0xe4, 0xe4, 0xff, 0xec, 0xe6, 0xe7, 0xff, 0xec, 0xe6, 0xe7, 0xff, 0xed, 0xe7, 0xe8, 0xff, 0xee, 0xe7, 0xe8, 0xff, 0xee, 0xe8, 0xe9, 0xff, 0xef, 0xea, 0xe9, 0xff, 0xf1, 0xed, 0xeb, 0xff, 0xf2, 0xed, 0xec, 0xff, 0xf1, 0xec, 0xea, 0xff, 0xf2, 0xed, 0xeb, 0xff, 0xe6, 0xde, 0xe3, 0xff, 0xb7, 0xab, 0xae, 0xff, 0x58, 0x64, 0x8d, 0xff, 0x6a, 0x8b, 0xd0, 0xff, 0x53, 0x6e, 0xa7, 0xff, 0x3b, 0x58, 0x90, 0xff, 0x71, 0x8f, 0xc8, 0xff, 0xa1, 0xbd, 0xea, 0xff, 0x7c, 0xa2, 0xdf, 0xff, 0x4f, 0x6c, 0xa3, 0xff, 0xc3, 0xb7, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xed, 0xec, 0xff, 0xc8, 0xc7, 0xd4, 0xff, 0xac, 0xba, 0xcf, 0xff, 0x77, 0x8b, 0xb6, 0xff, 0x75, 0x8c, 0xc4, 0xff, 0x90, 0xa4, 0xd4, 0xff, 0x9d, 0xab, 0xda, 0xff, 0xa5, 0xb5, 0xeb, 0xff, 0xc0, 0xcf, 0xe9, 0xff, 0xf9, 0xf1, 0xed, 0xff, 0xf7, 0xef, 0xef, 0xff, 0xff, 0xfb, 0xf7, 0xff, 0xbf, 0xc1, 0xbe, 0xff, 0xa0, 0xa3, 0xa4, 0xff, 0xaf, 0xb1, 0xb2, 0xff, 0xb0, 0xb2, 0xb2, 0xff, 0xb1, 0xb3, 0xb3, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb4, 0xb6, 0xb6, 0xff, 0xb6, 0xb7, 0xb7, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb6, 0xb6, 0xff, 0xb5, 0xb6, 0xb6, 0xff, 0xb4, 0xb6, 0xb6, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb6, 0xb6, 0x07, 0xbf, 0xbf, 0xbf, 0xd1, 0xa0, 0x9b, 0x9c, 0xff, 0xc2, 0xb9, 0xb8, 0xff, 0xd9, 0xcf, 0xcf, 0xff, 0xcc, 0xc3, 0xc4, 0xff, 0xe3, 0xd7, 0xd9, 0xff, 0xc0, 0xb6, 0xb8, 0xff, 0xcb, 0xc1, 0xc0, 0xff, 0xf2, 0xe6, 0xe1, 0xff, 0xfe, 0xf5, 0xf2, 0xff, 0xfe, 0xf2, 0xed, 0xff, 0xf5, 0xe5, 0xdc, 0xff, 0x8e, 0x8f, 0xa4, 0xff, 0x27, 0x49, 0x8a, 0xff, 0x61, 0x88, 0xca, 0xff, 0xa3, 0xbe, 0xef, 0xff, 0xa2, 0xbb, 0xee, 0xff, 0x89, 0x9a, 0xd5, 0xff, 0xd2, 0xcb, 0xd6, 0xff, 0xe9, 0xdf, 0xdf, 0xff, 0xe3, 0xdc, 0xdc, 0xff, 0xe9, 0xe3, 0xe0, 0xff, 0xe9, 0xe2, 0xdf, 0xff, 0xf0, 0xe9, 0xe5, 0xff, 0xf0, 0xe9, 0xe5, 0xff, 0xec, 0xe3, 0xe3, 0xff, 0xea, 0xe4, 0xe3, 0xff, 0xe5, 0xe0, 0xe0, 0xff, 0xe7, 0xe1, 0xe2, 0xff, 0xee, 0xe8, 0xe9, 0xff, 0xec, 0xe7, 0xe5, 0xff, 0xf0, 0xeb, 0xea, 0xff, 0xef, 0xea, 0xe9, 0xff, 0xeb, 0xe6, 0xe5, 0xff, 0xec, 0xe5, 0xe5, 0xff, 0xeb, 0xe5, 0xe4, 0xff, 0xe9, 0xe3, 0xe5, 0xff, 0xe9, 0xe3, 0xe4, 0xff, 0xe3, 0xde, 0xde, 0xff, 0xe3, 0xdc, 0xdb, 0xff, 0xe2, 0xd9, 0xd6, 0xff, 0xd7, 0xcf, 0xcf, 0xff, 0xe9, 0xdc, 0xd7, 0xff, 0xf3, 0xe8, 0xdd, 0xff, 0xfb, 0xef, 0xe3, 0xff, 0xfe, 0xf4, 0xe7, 0xff, 0xfc, 0xf2, 0xe5, 0xff, 0xfb, 0xee, 0xe1, 0xff, 0xf8, 0xee, 0xe5, 0xff, 0xf0, 0xe5, 0xe2, 0xff, 0xee, 0xe7, 0xe5, 0xff, 0xe9, 0xe5, 0xe4, 0xff, 0xe5, 0xe0, 0xdf, 0xff, 0xde, 0xd7, 0xd8, 0xff, 0xea, 0xe5, 0xe7, 0xff, 0xee, 0xe9, 0xe9, 0xff, 0xe9, 0xe3, 0xe3, 0xff, 0xec, 0xe6, 0xe7, 0xff, 0xed, 0xe7, 0xe8, 0xff, 0xee, 0xe8, 0xe9, 0xff, 0xee, 0xe8, 0xe9, 0xff, 0xf0, 0xea, 0xeb, 0xff, 0xef, 0xea, 0xea, 0xff, 0xf2, 0xed, 0xec, 0xff, 0xf3, 0xee, 0xed, 0xff, 0xf1, 0xec, 0xea, 0xff, 0xf0, 0xeb, 0xea, 0xff, 0xe6, 0xde, 0xe1, 0xff, 0xae, 0xa3, 0xad, 0xff, 0x60, 0x75, 0xa2, 0xff, 0x6e, 0x90, 0xcd, 0xff, 0x50, 0x6a, 0xa1, 0xff, 0x56, 0x77, 0xb0, 0xff, 0x9e, 0xb9, 0xe8, 0xff, 0xa5, 0xc1, 0xf1, 0xff, 0x75, 0x9a, 0xd2, 0xff, 0x95, 0xa4, 0xba, 0xff, 0xd8, 0xd6, 0xdd, 0xff, 0x9b, 0xab, 0xcc, 0xff, 0x6c, 0x89, 0xbb, 0xff, 0x66, 0x87, 0xc2, 0xff, 0x74, 0x94, 0xcb, 0xff, 0x6d, 0x8e, 0xcc, 0xff, 0x75, 0x95, 0xd9, 0xff, 0x8b, 0xa9, 0xe8, 0xff, 0x98, 0xad, 0xec, 0xff, 0x95, 0xa7, 0xef, 0xff, 0xc8, 0xcd, 0xec, 0xff, 0xfd, 0xf5, 0xee, 0xff, 0xf8, 0xf2, 0xf2, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xde, 0xda, 0xd8, 0xff, 0xa2, 0xa5, 0xa5, 0xff, 0xaf, 0xb1, 0xb1, 0xff, 0xb0, 0xb2, 0xb2, 0xff, 0xb1, 0xb3, 0xb3, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb2, 0xb4, 0xb4, 0xff, 0xb5, 0xb6, 0xb6, 0xff, 0xb5, 0xb6, 0xb6, 0xff, 0xb5, 0xb6, 0xb6, 0xff, 0xb7, 0xb6, 0xb6, 0xff, 0xb5, 0xb6, 0xb6, 0xff, 0xb4, 0xb5, 0xb5, 0xd1, 0xbf, 0xbf, 0xbf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x2a, 0xa8, 0xa2, 0xa3, 0xf3, 0xbb, 0xb3, 0xb3, 0xff, 0xed, 0xe3, 0xe3, 0xff, 0xc8, 0xc1, 0xc2, 0xff, 0xd8, 0xcf, 0xd1, 0xff, 0xe4, 0xd9, 0xda, 0xff, 0xcd, 0xc4, 0xc7, 0xff, 0xd6, 0xc9, 0xc7, 0xff, 0xf5, 0xe6, 0xe0, 0xff, 0xff, 0xf5, 0xf3, 0xff, 0xfb, 0xef, 0xeb, 0xff, 0xf6, 0xe0, 0xd5, 0xff, 0x6f, 0x7d, 0xa2, 0xff, 0x3f, 0x67, 0xb2, 0xff, 0x8d, 0xaa, 0xdf, 0xff, 0xb4, 0xcb, 0xf3, 0xff, 0x90, 0xac, 0xea, 0xff, 0x97, 0xa2, 0xce, 0xff, 0xe1, 0xd6, 0xd9, 0xff, 0xdb, 0xd4, 0xd9, 0xff, 0xdf, 0xd8, 0xda, 0xff, 0xe6, 0xde, 0xdf, 0xff, 0xed, 0xe6, 0xe5, 0xff, 0xf0, 0xe9, 0xe6, 0xff, 0xed, 0xe5, 0xe5, 0xff, 0xea, 0xe3, 0xe3, 0xff, 0xe8, 0xe4, 0xe2, 0xff, 0xeb, 0xe6, 0xe5, 0xff, 0xee, 0xe9, 0xe9, 0xff, 0xed, 0xe7, 0xe8, 0xff, 0xf0, 0xea, 0xea, 0xff, 0xef, 0xe9, 0xe9, 0xff, 0xec, 0xe7, 0xe7, 0xff, 0xed, 0xe5, 0xe6, 0xff, 0xec, 0xe5, 0xe6, 0xff, 0xea, 0xe5, 0xe6, 0xff, 0xe8, 0xe3, 0xe4, 0xff, 0xe4, 0xdf, 0xe0, 0xff, 0xe6, 0xdf, 0xe0, 0xff, 0xe6, 0xdd, 0xdd, 0xff, 0xdb, 0xd3, 0xd3, 0xff, 0xe5, 0xd8, 0xd4, 0xff, 0xf1, 0xe5, 0xde, 0xff, 0xf7, 0xe9, 0xdf, 0xff, 0xfc, 0xf1, 0xe3, 0xff, 0xfd, 0xf5, 0xe7, 0xff, 0xfa, 0xed, 0xe0, 0xff, 0xf8, 0xed, 0xe4, 0xff, 0xed, 0xe2, 0xde, 0xff, 0xed, 0xe4, 0xe2, 0xff, 0xea, 0xe3, 0xe3, 0xff, 0xeb, 0xe4, 0xe3, 0xff, 0xe2, 0xda, 0xdb, 0xff, 0xea, 0xe4, 0xe5, 0xff, 0xed, 0xe8, 0xe8, 0xff, 0xea, 0xe4, 0xe4, 0xff, 0xec, 0xe6, 0xe8, 0xff, 0xed, 0xe7, 0xe8, 0xff, 0xec, 0xe6, 0xe7, 0xff, 0xed, 0xe7, 0xe8, 0xff, 0xf1, 0xea, 0xec, 0xff, 0xf1, 0xeb, 0xeb, 0xff, 0xf1, 0xed, 0xeb, 0xff, 0xf2, 0xee, 0xec, 0xff, 0xef, 0xea, 0xea, 0xff, 0xef, 0xe9, 0xea, 0xff, 0xe7, 0xdd, 0xde, 0xff, 0xa5, 0x9d, 0xae, 0xff, 0x5b, 0x75, 0xab, 0xff, 0x62, 0x82, 0xbb, 0xff, 0x4e, 0x6b, 0xa2, 0xff, 0x79, 0x97, 0xcb, 0xff, 0xa9, 0xc4, 0xf1, 0xff, 0x7b, 0x9b, 0xd3, 0xff, 0x54, 0x70, 0xa3, 0xff, 0x4e, 0x6b, 0x9c, 0xff, 0x48, 0x6f, 0xb3, 0xff, 0x53, 0x7c, 0xbf, 0xff, 0x88, 0xa7, 0xd9, 0xff, 0xb1, 0xc8, 0xec, 0xff, 0xaf, 0xcc, 0xf4, 0xff, 0x89, 0xa7, 0xde, 0xff, 0x6e, 0x86, 0xcb, 0xff, 0x89, 0x98, 0xd6, 0xff, 0x9b, 0xa4, 0xda, 0xff, 0xc1, 0xc3, 0xe3, 0xff, 0xfc, 0xf2, 0xf0, 0xff, 0xfa, 0xf3, 0xf1, 0xff, 0xf9, 0xf4, 0xf4, 0xff, 0xff, 0xf7, 0xf6, 0xff, 0xea, 0xe2, 0xe3, 0xff, 0xaa, 0xad, 0xad, 0xff, 0xab, 0xae, 0xad, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb3, 0xb4, 0xb4, 0xff, 0xb3, 0xb5, 0xb5, 0xff, 0xb5, 0xb6, 0xb6, 0xff, 0xb6, 0xb5, 0xb5, 0xff, 0xb5, 0xb6, 0xb6, 0xff, 0xb6, 0xb5, 0xb5, 0xff, 0xb4, 0xb5, 0xb5, 0xf4, 0xb6, 0xb6, 0xb6, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xb1, 0xb4, 0x55, 0xaa, 0xa6, 0xa4, 0xfe, 0xed, 0xe5, 0xe1, 0xff, 0xe0, 0xd7, 0xd8, 0xff, 0xc8, 0xbd, 0xc0, 0xff, 0xf7, 0xef, 0xeb, 0xff, 0xf9, 0xf1, 0xea, 0xff, 0xc5, 0xbc, 0xc1, 0xff, 0xd8, 0xcb, 0xcd, 0xff, 0xff, 0xef, 0xe4, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xfd, 0xee, 0xff, 0xb2, 0xad, 0xbb, 0xff, 0x45, 0x69, 0xac, 0xff, 0x77, 0x97, 0xcd, 0xff, 0x9e, 0xb8, 0xe5, 0xff, 0xae, 0xc6, 0xf5, 0xff, 0x81, 0x9d, 0xd7, 0xff, 0xbd, 0xbc, 0xcd, 0xff, 0xdc, 0xd2, 0xd9, 0xff, 0xd0, 0xcd, 0xd5, 0xff, 0xe4, 0xde, 0xdc, 0xff, 0xe9, 0xe2, 0xe2, 0xff, 0xf0, 0xe7, 0xe7, 0xff, 0xed, 0xe5, 0xe5, 0xff, 0xec, 0xe4, 0xe5, 0xff, 0xea, 0xe5, 0xe4, 0xff, 0xec, 0xe8, 0xe7, 0xff, 0xed, 0xe9, 0xe9, 0xff, 0xee, 0xe9, 0xea, 0xff, 0xf2, 0xec, 0xec, 0xff, 0xf0, 0xea, 0xea, 0xff, 0xed, 0xe7, 0xe8, 0xff, 0xed, 0xe5, 0xe6, 0xff, 0xec, 0xe4, 0xe5, 0xff, 0xea, 0xe5, 0xe6, 0xff, 0xe7, 0xe2, 0xe3, 0xff, 0xe9, 0xe3, 0xe3, 0xff, 0xe7, 0xe0, 0xe0, 0xff, 0xe6, 0xdd, 0xdd, 0xff, 0xe5, 0xd9, 0xd9, 0xff, 0xe6, 0xda, 0xd6, 0xff, 0xed, 0xe1, 0xdb, 0xff, 0xf5, 0xe9, 0xdd, 0xff, 0xf6, 0xe8, 0xde, 0xff, 0xff, 0xf5, 0xeb, 0xff, 0xf8, 0xeb, 0xde, 0xff, 0xf8, 0xec, 0xe3, 0xff, 0xf3, 0xe7, 0xe5, 0xff, 0xef, 0xe4, 0xe3, 0xff, 0xeb, 0xe3, 0xe3, 0xff, 0xeb, 0xe3, 0xe4, 0xff, 0xe5, 0xdf, 0xe0, 0xff, 0xe8, 0xe2, 0xe3, 0xff, 0xea, 0xe4, 0xe5, 0xff, 0xeb, 0xe5, 0xe6, 0xff, 0xed, 0xe7, 0xe7, 0xff, 0xed, 0xe7, 0xe8, 0xff, 0xed, 0xe7, 0xe9, 0xff, 0xee, 0xe9, 0xe9, 0xff, 0xf2, 0xeb, 0xeb, 0xff, 0xf1, 0xeb, 0xeb, 0xff, 0xf1, 0xec, 0xeb, 0xff, 0xf4, 0xed, 0xed, 0xff, 0xf1, 0xe9, 0xe9, 0xff, 0xef, 0xe7, 0xe7, 0xff, 0xe3, 0xd9, 0xdc, 0xff, 0x91, 0x8f, 0xa7, 0xff, 0x4e, 0x6b, 0xa6, 0xff, 0x56, 0x75, 0xab, 0xff, 0x50, 0x6d, 0xa4, 0xff, 0x91, 0xae, 0xe0, 0xff, 0x7c, 0x9a, 0xcd, 0xff, 0x37, 0x5a, 0x95, 0xff, 0x42, 0x65, 0x9e, 0xff, 0x42, 0x66, 0xa8, 0xff, 0x79, 0x9a, 0xd1, 0xff, 0x95, 0xb1, 0xde, 0xff, 0x98, 0xb5, 0xe3, 0xff, 0x7e, 0xa1, 0xda, 0xff, 0x6b, 0x8b, 0xca, 0xff, 0x8a, 0x96, 0xc6, 0xff, 0xbb, 0xb8, 0xd1, 0xff, 0xeb, 0xe3, 0xe7, 0xff, 0xff, 0xf9, 0xf0, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xfb, 0xf4, 0xf4, 0xff, 0xf5, 0xf0, 0xf3, 0xff, 0xf2, 0xec, 0xec, 0xff, 0xed, 0xe6, 0xe7, 0xff, 0xea, 0xe5, 0xe4, 0xff, 0xb3, 0xb4, 0xb3, 0xff, 0xa7, 0xa8, 0xa9, 0xff, 0xb2, 0xb0, 0xb0, 0xff, 0xb3, 0xb2, 0xb2, 0xff, 0xb4, 0xb5, 0xb5, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x9d, 0x9d, 0x8d, 0xda, 0xd5, 0xd2, 0xff, 0xff, 0xfc, 0xf5, 0xff, 0xe9, 0xd6, 0xcd, 0xff, 0xcd, 0xc4, 0xc2, 0xff, 0x80, 0x8d, 0xb2, 0xff, 0x5a, 0x75, 0xb4, 0xff, 0x74, 0x8c, 0xc0, 0xff, 0x95, 0xa6, 0xc6, 0xff, 0xb2, 0xb9, 0xd3, 0xff, 0xe5, 0xe6, 0xef, 0xff, 0xf4, 0xe1, 0xd6, 0xff, 0x7d, 0x8b, 0xae, 0xff, 0x5d, 0x83, 0xc4, 0xff, 0x79, 0x98, 0xce, 0xff, 0xa1, 0xb9, 0xe6, 0xff, 0x8f, 0xb0, 0xe8, 0xff, 0x93, 0xa3, 0xce, 0xff, 0xcb, 0xc3, 0xc8, 0xff, 0xc9, 0xc7, 0xd0, 0xff, 0xdd, 0xd5, 0xda, 0xff, 0xe2, 0xdb, 0xdd, 0xff, 0xec, 0xe4, 0xe5, 0xff, 0xec, 0xe4, 0xe5, 0xff, 0xee, 0xe5, 0xe6, 0xff, 0xee, 0xe5, 0xe7, 0xff, 0xed, 0xe8, 0xe7, 0xff, 0xef, 0xe9, 0xea, 0xff, 0xef, 0xe9, 0xea, 0xff, 0xef, 0xe9, 0xea, 0xff, 0xee, 0xe8, 0xe9, 0xff, 0xed, 0xe9, 0xe8, 0xff, 0xef, 0xe7, 0xe8, 0xff, 0xed, 0xe4, 0xe5, 0xff, 0xeb, 0xe3, 0xe4, 0xff, 0xe7, 0xe0, 0xe1, 0xff, 0xec, 0xe4, 0xe4, 0xff, 0xea, 0xe1, 0xe2, 0xff, 0xe7, 0xdd, 0xde, 0xff, 0xe8, 0xdd, 0xdc, 0xff, 0xec, 0xdf, 0xdd, 0xff, 0xec, 0xde, 0xdb, 0xff, 0xf1, 0xe7, 0xdf, 0xff, 0xfa, 0xe9, 0xe0, 0xff, 0xff, 0xf2, 0xe5, 0xff, 0xf8, 0xea, 0xdc, 0xff, 0xf7, 0xec, 0xe1, 0xff, 0xf6, 0xec, 0xe7, 0xff, 0xf1, 0xe6, 0xe3, 0xff, 0xec, 0xe3, 0xe2, 0xff, 0xea, 0xe2, 0xe2, 0xff, 0xe8, 0xe1, 0xe2, 0xff, 0xe8, 0xe2, 0xe3, 0xff, 0xe8, 0xe2, 0xe3, 0xff, 0xea, 0xe4, 0xe5, 0xff, 0xed, 0xe7, 0xe8, 0xff, 0xec, 0xe6, 0xe7, 0xff, 0xee, 0xe7, 0xe9, 0xff, 0xf2, 0xea, 0xea, 0xff, 0xf4, 0xeb, 0xeb, 0xff, 0xf2, 0xec, 0xeb, 0xff, 0xf2, 0xeb, 0xeb, 0xff, 0xf2, 0xe9, 0xea, 0xff, 0xef, 0xe8, 0xe9, 0xff, 0xed, 0xe4, 0xe5, 0xff, 0xde, 0xd3, 0xd9, 0xff, 0x85, 0x86, 0x9c, 0xff, 0x39, 0x5c, 0x95, 0xff, 0x4d, 0x6b, 0xa1, 0xff, 0x5d, 0x7b, 0xb1, 0xff, 0x84, 0xa2, 0xd7, 0xff, 0x44, 0x63, 0x9a, 0xff, 0x3e, 0x61, 0x9d, 0xff, 0x68, 0x8c, 0xc3, 0xff, 0x89, 0xa6, 0xd8, 0xff, 0x8d, 0xac, 0xdf, 0xff, 0x5b, 0x82, 0xc4, 0xff, 0x63, 0x82, 0xc3, 0xff, 0x93, 0xa2, 0xcc, 0xff, 0xcb, 0xc3, 0xd5, 0xff, 0xff, 0xf9, 0xf0, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfb, 0xf6, 0xf3, 0xff, 0xe1, 0xe2, 0xed, 0xff, 0xe7, 0xe7, 0xed, 0xff, 0xf5, 0xee, 0xed, 0xff, 0xe7, 0xe3, 0xe4, 0xff, 0xe9, 0xe3, 0xe5, 0xff, 0xf9, 0xf3, 0xf2, 0xff, 0xf0, 0xed, 0xeb, 0xff, 0xad, 0xae, 0xad, 0xff, 0xab, 0xab, 0xab, 0xff, 0xb1, 0xb0, 0xb0, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0xdc, 0xd3, 0xc9, 0xb1, 0xed, 0xe9, 0xe4, 0xff, 0x7a, 0x84, 0xa0, 0xff, 0x30, 0x49, 0x7c, 0xff, 0x3f, 0x60, 0xa9, 0xff, 0x86, 0xa2, 0xdc, 0xff, 0x8e, 0xac, 0xdd, 0xff, 0x7d, 0x9e, 0xd7, 0xff, 0x6e, 0x90, 0xcd, 0xff, 0x75, 0x96, 0xd0, 0xff, 0xad, 0xbc, 0xdd, 0xff, 0x90, 0x9d, 0xb8, 0xff, 0x45, 0x67, 0xa2, 0xff, 0x56, 0x75, 0xaf, 0xff, 0x76, 0x93, 0xc3, 0xff, 0x85, 0xa2, 0xd4, 0xff, 0x7d, 0x9d, 0xd6, 0xff, 0x8f, 0x9c, 0xc0, 0xff, 0xbf, 0xb9, 0xc2, 0xff, 0xd3, 0xcd, 0xd7, 0xff, 0xd6, 0xd0, 0xd8, 0xff, 0xe4, 0xdd, 0xde, 0xff, 0xe5, 0xe0, 0xe0, 0xff, 0xed, 0xe5, 0xe7, 0xff, 0xf0, 0xe7, 0xe8, 0xff, 0xf1, 0xea, 0xea, 0xff, 0xf0, 0xeb, 0xeb, 0xff, 0xef, 0xe9, 0xea, 0xff, 0xee, 0xe8, 0xe9, 0xff, 0xee, 0xe9, 0xe9, 0xff, 0xee, 0xe9, 0xe7, 0xff, 0xed, 0xe7, 0xe8, 0xff, 0xeb, 0xe5, 0xe6, 0xff, 0xee, 0xe7, 0xe8, 0xff, 0xea, 0xe4, 0xe4, 0xff, 0xe8, 0xe2, 0xe1, 0xff, 0xee, 0xe6, 0xe3, 0xff, 0xea, 0xe0, 0xe0, 0xff, 0xea, 0xdf, 0xdd, 0xff, 0xf0, 0xe2, 0xe1, 0xff, 0xee, 0xe2, 0xdf, 0xff, 0xf2, 0xe5, 0xde, 0xff, 0xd9, 0xd3, 0xce, 0xff, 0xeb, 0xe6, 0xdb, 0xff, 0xfd, 0xed, 0xe2, 0xff, 0xf4, 0xe8, 0xdf, 0xff, 0xf5, 0xeb, 0xe5, 0xff, 0xed, 0xe4, 0xe1, 0xff, 0xe8, 0xe1, 0xe1, 0xff, 0xe9, 0xe1, 0xe2, 0xff, 0xe6, 0xe0, 0xe0, 0xff, 0xe7, 0xe2, 0xe3, 0xff, 0xe8, 0xe2, 0xe3, 0xff, 0xe9, 0xe2, 0xe4, 0xff, 0xec, 0xe5, 0xe7, 0xff, 0xea, 0xe4, 0xe6, 0xff, 0xed, 0xe6, 0xe8, 0xff, 0xf1, 0xe8, 0xe9, 0xff, 0xf2, 0xeb, 0xea, 0xff, 0xf0, 0xea, 0xea, 0xff, 0xef, 0xe9, 0xea, 0xff, 0xee, 0xe7, 0xe8, 0xff, 0xee, 0xe5, 0xe7, 0xff, 0xe7, 0xdf, 0xe3, 0xff, 0xd1, 0xc5, 0xca, 0xff, 0x6c, 0x76, 0x96, 0xff, 0x31, 0x55, 0x8e, 0xff, 0x4e, 0x6c, 0xa2, 0xff, 0x66, 0x86, 0xba, 0xff, 0x5a, 0x77, 0xac, 0xff, 0x3b, 0x5a, 0x94, 0xff, 0x68, 0x89, 0xc2, 0xff, 0x98, 0xb1, 0xe1, 0xff, 0xab, 0xc5, 0xed, 0xff, 0x76, 0x99, 0xd2, 0xff, 0x7f, 0x91, 0xc0, 0xff, 0xf4, 0xea, 0xe7, 0xff, 0xfa, 0xec, 0xe6, 0xff, 0xba, 0xbb, 0xd0, 0xff, 0xa5, 0xb2, 0xd2, 0xff, 0x87, 0x9d, 0xd0, 0xff, 0x7f, 0x94, 0xce, 0xff, 0x8c, 0x9c, 0xd8, 0xff, 0xc3, 0xc7, 0xdd, 0xff, 0xf5, 0xeb, 0xe4, 0xff, 0xf1, 0xe9, 0xe8, 0xff, 0xfe, 0xfa, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xd5, 0xd4, 0xff, 0xa0, 0xa1, 0xa1, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xb1, 0xb1, 0xb0, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb5, 0xb5, 0xb5, 0xb1, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x0a, 0x4c, 0x63, 0x97, 0xc8, 0x47, 0x69, 0xa6, 0xff, 0x5c, 0x7d, 0xb6, 0xff, 0x6c, 0x8b, 0xc7, 0xff, 0x7c, 0x99, 0xce, 0xff, 0x9c, 0xb6, 0xe4, 0xff, 0xa9, 0xc0, 0xeb, 0xff, 0xb4, 0xca, 0xee, 0xff, 0xa4, 0xbc, 0xe5, 0xff, 0x86, 0xa5, 0xd6, 0xff, 0x83, 0xa4, 0xdb, 0xff, 0x78, 0x96, 0xcc, 0xff, 0x66, 0x85, 0xbe, 0xff, 0x5c, 0x7c, 0xb4, 0xff, 0x64, 0x82, 0xba, 0xff, 0x77, 0x93, 0xca, 0xff, 0x6e, 0x8b, 0xc7, 0xff, 0x89, 0x92, 0xba, 0xff, 0xc1, 0xbb, 0xc8, 0xff, 0xd3, 0xcd, 0xd5, 0xff, 0xd8, 0xd2, 0xd9, 0xff, 0xe4, 0xde, 0xdf, 0xff, 0xec, 0xe7, 0xe6, 0xff, 0xee, 0xe8, 0xe8, 0xff, 0xf0, 0xe9, 0xea, 0xff, 0xf0, 0xeb, 0xec, 0xff, 0xf0, 0xea, 0xeb, 0xff, 0xf0, 0xe9, 0xea, 0xff, 0xef, 0xe9, 0xea, 0xff, 0xed, 0xe7, 0xe8, 0xff, 0xed, 0xe7, 0xe8, 0xff, 0xea, 0xe4, 0xe5, 0xff, 0xeb, 0xe6, 0xe5, 0xff, 0xec, 0xe6, 0xe6, 0xff, 0xec, 0xe5, 0xe4, 0xff, 0xef, 0xe6, 0xe5, 0xff, 0xed, 0xe4, 0xe3, 0xff, 0xed, 0xe3, 0xe0, 0xff, 0xf1, 0xe5, 0xe3, 0xff, 0xf9, 0xeb, 0xe6, 0xff, 0xe6, 0xe0, 0xda, 0xff, 0x98, 0xab, 0xb4, 0xff, 0xb6, 0xc4, 0xcd, 0xff, 0xf5, 0xeb, 0xe2, 0xff, 0xf0, 0xe3, 0xd9, 0xff, 0xf4, 0xe8, 0xe4, 0xff, 0xec, 0xe2, 0xe0, 0xff, 0xe7, 0xdf, 0xdf, 0xff, 0xe7, 0xdf, 0xe1, 0xff, 0xe4, 0xdd, 0xde, 0xff, 0xe6, 0xe0, 0xe1, 0xff, 0xe8, 0xe2, 0xe3, 0xff, 0xe7, 0xe1, 0xe2, 0xff, 0xe9, 0xe3, 0xe4, 0xff, 0xea, 0xe4, 0xe5, 0xff, 0xeb, 0xe6, 0xe8, 0xff, 0xee, 0xe7, 0xe7, 0xff, 0xf0, 0xe8, 0xe8, 0xff, 0xee, 0xe9, 0xe9, 0xff, 0xee, 0xe7, 0xe8, 0xff, 0xed, 0xe6, 0xe7, 0xff, 0xea, 0xe3, 0xe2, 0xff, 0xe4, 0xdb, 0xe0, 0xff, 0xa1, 0x99, 0xa5, 0xff, 0x43, 0x58, 0x87, 0xff, 0x49, 0x6b, 0xa5, 0xff, 0x53, 0x74, 0xa8, 0xff, 0x51, 0x70, 0xa5, 0xff, 0x44, 0x63, 0x99, 0xff, 0x59, 0x78, 0xb0, 0xff, 0x88, 0xa3, 0xd1, 0xff, 0xb2, 0xc8, 0xf0, 0xff, 0x86, 0xa3, 0xdb, 0xff, 0x92, 0xa6, 0xc8, 0xff, 0xd1, 0xcd, 0xd7, 0xff, 0xb1, 0xb5, 0xcd, 0xff, 0x7f, 0x97, 0xc6, 0xff, 0x4c, 0x6f, 0xb7, 0xff, 0x3a, 0x62, 0xb9, 0xff, 0x6d, 0x8b, 0xce, 0xff, 0xae, 0xb6, 0xd4, 0xff, 0xe8, 0xdf, 0xe5, 0xff, 0xf9, 0xf0, 0xed, 0xff, 0xfb, 0xf7, 0xf1, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfb, 0xf6, 0xff, 0xff, 0xfb, 0xf6, 0xff, 0xbd, 0xbb, 0xbb, 0xff, 0xa2, 0xa4, 0xa4, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb5, 0xb5, 0xb5, 0xc8, 0xb2, 0xb2, 0xb2, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x79, 0xb6, 0x15, 0x6e, 0x8b, 0xc2, 0xd7, 0x5e, 0x7e, 0xbc, 0xff, 0x30, 0x50, 0x91, 0xff, 0x1c, 0x3d, 0x7e, 0xff, 0x40, 0x63, 0xa3, 0xff, 0x64, 0x85, 0xbf, 0xff, 0x8d, 0xa8, 0xd9, 0xff, 0xa7, 0xbe, 0xea, 0xff, 0x9e, 0xb4, 0xdf, 0xff, 0x8b, 0xa5, 0xd3, 0xff, 0x8d, 0xad, 0xdf, 0xff, 0x73, 0x93, 0xcc, 0xff, 0x6b, 0x8a, 0xc6, 0xff, 0x82, 0xa0, 0xda, 0xff, 0x80, 0x9a, 0xd0, 0xff, 0x7e, 0x97, 0xd0, 0xff, 0x72, 0x8c, 0xcb, 0xff, 0x83, 0x8e, 0xbc, 0xff, 0xb9, 0xb6, 0xc4, 0xff, 0xd5, 0xcf, 0xd4, 0xff, 0xe1, 0xda, 0xdd, 0xff, 0xea, 0xe5, 0xe5, 0xff, 0xee, 0xe9, 0xe9, 0xff, 0xf0, 0xea, 0xeb, 0xff, 0xf1, 0xeb, 0xec, 0xff, 0xf0, 0xea, 0xeb, 0xff, 0xf2, 0xeb, 0xec, 0xff, 0xf0, 0xe8, 0xe9, 0xff, 0xef, 0xe7, 0xe8, 0xff, 0xee, 0xe7, 0xe8, 0xff, 0xeb, 0xe4, 0xe5, 0xff, 0xe9, 0xe2, 0xe2, 0xff, 0xeb, 0xe3, 0xe3, 0xff, 0xef, 0xe6, 0xe7, 0xff, 0xf0, 0xe6, 0xe6, 0xff, 0xea, 0xe1, 0xe1, 0xff, 0xec, 0xe2, 0xe2, 0xff, 0xf4, 0xe9, 0xe6, 0xff, 0xfb, 0xef, 0xe8, 0xff, 0xf6, 0xea, 0xe5, 0xff, 0xa1, 0xb1, 0xba, 0xff, 0xac, 0xba, 0xc1, 0xff, 0xf7, 0xed, 0xe4, 0xff, 0xec, 0xe0, 0xd8, 0xff, 0xf3, 0xe8, 0xe3, 0xff, 0xf0, 0xe4, 0xe1, 0xff, 0xec, 0xe2, 0xe0, 0xff, 0xea, 0xe1, 0xe1, 0xff, 0xe6, 0xde, 0xdf, 0xff, 0xe9, 0xe2, 0xe3, 0xff, 0xea, 0xe3, 0xe4, 0xff, 0xe7, 0xe0, 0xe1, 0xff, 0xe8, 0xe2, 0xe3, 0xff, 0xea, 0xe4, 0xe5, 0xff, 0xec, 0xe6, 0xe7, 0xff, 0xec, 0xe5, 0xe4, 0xff, 0xee, 0xe6, 0xe6, 0xff, 0xef, 0xe7, 0xe8, 0xff, 0xec, 0xe5, 0xe6, 0xff, 0xea, 0xe2, 0xe3, 0xff, 0xe6, 0xde, 0xe3, 0xff, 0xd6, 0xcd, 0xd2, 0xff, 0x73, 0x75, 0x88, 0xff, 0x38, 0x52, 0x89, 0xff, 0x4f, 0x6c, 0xa7, 0xff, 0x4e, 0x6e, 0xa4, 0xff, 0x44, 0x64, 0x98, 0xff, 0x59, 0x78, 0xaa, 0xff, 0x82, 0x9d, 0xca, 0xff, 0xa7, 0xbf, 0xeb, 0xff, 0x73, 0x8e, 0xc0, 0xff, 0x36, 0x4e, 0x74, 0xff, 0x64, 0x76, 0xa1, 0xff, 0x64, 0x83, 0xc2, 0xff, 0x5e, 0x83, 0xc6, 0xff, 0x6f, 0x92, 0xd3, 0xff, 0x80, 0x97, 0xcf, 0xff, 0xaf, 0xb2, 0xcd, 0xff, 0xe9, 0xe1, 0xdc, 0xff, 0xfd, 0xf0, 0xe5, 0xff, 0xfc, 0xf2, 0xe7, 0xff, 0xf7, 0xf0, 0xed, 0xff, 0xfc, 0xf9, 0xf6, 0xff, 0xfd, 0xf9, 0xf4, 0xff, 0xff, 0xfb, 0xf6, 0xff, 0xf5, 0xec, 0xe9, 0xff, 0xac, 0xac, 0xac, 0xff, 0xab, 0xac, 0xac, 0xff, 0xaf, 0xaf, 0xb0, 0xff, 0xb0, 0xb0, 0xb1, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb3, 0xb3, 0xb3, 0xd8, 0xb6, 0xb6, 0xb6, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x3f, 0x7f, 0x1c, 0x3f, 0x54, 0x85, 0xdc, 0x53, 0x5c, 0x72, 0xff, 0x4d, 0x5a, 0x76, 0xff, 0x27, 0x42, 0x78, 0xff, 0x2e, 0x4c, 0x8a, 0xff, 0x33, 0x51, 0x8f, 0xff, 0x48, 0x66, 0xa1, 0xff, 0x65, 0x83, 0xb7, 0xff, 0x73, 0x91, 0xbf, 0xff, 0x77, 0x97, 0xc6, 0xff, 0x65, 0x85, 0xbc, 0xff, 0x76, 0x95, 0xcc, 0xff, 0x91, 0xaf, 0xe0, 0xff, 0x87, 0xa6, 0xdc, 0xff, 0x88, 0xa2, 0xda, 0xff, 0x85, 0x9f, 0xd3, 0xff, 0x77, 0x94, 0xce, 0xff, 0x7f, 0x8e, 0xbe, 0xff, 0xbb, 0xb6, 0xc2, 0xff, 0xe3, 0xda, 0xdb, 0xff, 0xe9, 0xe3, 0xe6, 0xff, 0xed, 0xe5, 0xe7, 0xff, 0xef, 0xe8, 0xe9, 0xff, 0xf0, 0xeb, 0xec, 0xff, 0xef, 0xe9, 0xea, 0xff, 0xf1, 0xea, 0xeb, 0xff, 0xf0, 0xe7, 0xe8, 0xff, 0xef, 0xe7, 0xe8, 0xff, 0xee, 0xe5, 0xe7, 0xff, 0xeb, 0xe1, 0xe3, 0xff, 0xee, 0xe4, 0xe4, 0xff, 0xea, 0xe2, 0xe2, 0xff, 0xea, 0xe2, 0xe3, 0xff, 0xef, 0xe5, 0xe5, 0xff, 0xeb, 0xe2, 0xe1, 0xff, 0xec, 0xe1, 0xe1, 0xff, 0xf2, 0xe6, 0xe6, 0xff, 0xf6, 0xe8, 0xe6, 0xff, 0xff, 0xef, 0xe8, 0xff, 0xde, 0xd8, 0xd4, 0xff, 0xe8, 0xe3, 0xdc, 0xff, 0xfb, 0xeb, 0xe1, 0xff, 0xef, 0xe3, 0xda, 0xff, 0xf5, 0xe9, 0xe2, 0xff, 0xf1, 0xe4, 0xe0, 0xff, 0xed, 0xe2, 0xe0, 0xff, 0xec, 0xe2, 0xe2, 0xff, 0xe6, 0xdd, 0xde, 0xff, 0xeb, 0xe2, 0xe3, 0xff, 0xe8, 0xe0, 0xe1, 0xff, 0xe5, 0xdd, 0xde, 0xff, 0xe7, 0xe1, 0xe2, 0xff, 0xe9, 0xe2, 0xe3, 0xff, 0xea, 0xe3, 0xe4, 0xff, 0xea, 0xe2, 0xe3, 0xff, 0xef, 0xe7, 0xe7, 0xff, 0xee, 0xe5, 0xe6, 0xff, 0xeb, 0xe1, 0xe3, 0xff, 0xe7, 0xe0, 0xe1, 0xff, 0xe7, 0xdd, 0xe0, 0xff, 0xab, 0xa2, 0xaf, 0xff, 0x4e, 0x60, 0x8f, 0xff, 0x4f, 0x69, 0xa3, 0xff, 0x50, 0x6b, 0xa3, 0xff, 0x48, 0x63, 0x9a, 0xff, 0x54, 0x73, 0xa9, 0xff, 0x7b, 0x97, 0xc6, 0xff, 0xac, 0xc3, 0xea, 0xff, 0x74, 0x8d, 0xbe, 0xff, 0x18, 0x31, 0x5f, 0xff, 0x38, 0x52, 0x81, 0xff, 0x2b, 0x51, 0x9b, 0xff, 0x64, 0x8a, 0xcd, 0xff, 0x77, 0x94, 0xd3, 0xff, 0x94, 0xa0, 0xc8, 0xff, 0xd7, 0xd2, 0xd3, 0xff, 0xfc, 0xee, 0xe1, 0xff, 0xfd, 0xf5, 0xed, 0xff, 0xf6, 0xeb, 0xea, 0xff, 0xef, 0xe5, 0xe4, 0xff, 0xee, 0xe7, 0xe6, 0xff, 0xfa, 0xf4, 0xf3, 0xff, 0xff, 0xf8, 0xf4, 0xff, 0xff, 0xfa, 0xf5, 0xff, 0xf5, 0xee, 0xe9, 0xff, 0xaf, 0xae, 0xae, 0xff, 0xac, 0xae, 0xae, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb4, 0xb4, 0xb4, 0xdd, 0xb6, 0xb6, 0xb6, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x64, 0x7b, 0x21, 0x68, 0x80, 0xac, 0xde, 0x75, 0x92, 0xc0, 0xff, 0x6b, 0x86, 0xbf, 0xff, 0x7a, 0x96, 0xcd, 0xff, 0x79, 0x95, 0xc7, 0xff, 0x6b, 0x88, 0xb9, 0xff, 0x6e, 0x8b, 0xbd, 0xff, 0x69, 0x89, 0xbc, 0xff, 0x63, 0x83, 0xbb, 0xff, 0x75, 0x92, 0xc7, 0xff, 0x7d, 0x9c, 0xcc, 0xff, 0x7e, 0x9b, 0xcc, 0xff, 0x7f, 0x9d, 0xce, 0xff, 0x85, 0xa4, 0xd4, 0xff, 0x8a, 0xa5, 0xd8, 0xff, 0x8c, 0xa6, 0xd7, 0xff, 0x7c, 0x98, 0xd0, 0xff, 0x7f, 0x90, 0xc2, 0xff, 0xc8, 0xc3, 0xcf, 0xff, 0xee, 0xe4, 0xe3, 0xff, 0xea, 0xe4, 0xe9, 0xff, 0xed, 0xe7, 0xe8, 0xff, 0xef, 0xe9, 0xea, 0xff, 0xf0, 0xea, 0xeb, 0xff, 0xf2, 0xeb, 0xeb, 0xff, 0xef, 0xe6, 0xe7, 0xff, 0xf0, 0xe6, 0xe8, 0xff, 0xf0, 0xe6, 0xe7, 0xff, 0xf0, 0xe4, 0xe6, 0xff, 0xf0, 0xe5, 0xe5, 0xff, 0xec, 0xe3, 0xe2, 0xff, 0xeb, 0xe1, 0xe1, 0xff, 0xeb, 0xe1, 0xe1, 0xff, 0xeb, 0xe0, 0xe0, 0xff, 0xed, 0xe2, 0xdf, 0xff, 0xf1, 0xe5, 0xe3, 0xff, 0xf0, 0xe4, 0xe2, 0xff, 0xf3, 0xe6, 0xe1, 0xff, 0xf8, 0xea, 0xe3, 0xff, 0xfb, 0xec, 0xe1, 0xff, 0xf3, 0xe5, 0xda, 0xff, 0xf5, 0xe8, 0xdf, 0xff, 0xf7, 0xeb, 0xe2, 0xff, 0xf0, 0xe2, 0xdf, 0xff, 0xeb, 0xe0, 0xdf, 0xff, 0xec, 0xe3, 0xe3, 0xff, 0xe7, 0xda, 0xdc, 0xff, 0xe5, 0xd9, 0xdb, 0xff, 0xe3, 0xdb, 0xdc, 0xff, 0xe0, 0xd8, 0xd9, 0xff, 0xe6, 0xde, 0xe0, 0xff, 0xe7, 0xdf, 0xdf, 0xff, 0xe8, 0xe1, 0xe2, 0xff, 0xe9, 0xe1, 0xe2, 0xff, 0xeb, 0xe3, 0xe3, 0xff, 0xea, 0xe1, 0xe2, 0xff, 0xe7, 0xdd, 0xdf, 0xff, 0xe7, 0xdf, 0xe1, 0xff, 0xd5, 0xc8, 0xc6, 0xff, 0x6d, 0x72, 0x92, 0xff, 0x43, 0x5d, 0x9d, 0xff, 0x58, 0x6e, 0xa2, 0xff, 0x50, 0x6c, 0xa5, 0xff, 0x50, 0x6e, 0xa9, 0xff, 0x6c, 0x8a, 0xc2, 0xff, 0x88, 0xa3, 0xd7, 0xff, 0x76, 0x91, 0xc8, 0xff, 0x10, 0x2f, 0x6e, 0xff, 0x4e, 0x66, 0x98, 0xff, 0x7c, 0x95, 0xc9, 0xff, 0x5d, 0x74, 0xb3, 0xff, 0x5c, 0x77, 0xb8, 0xff, 0x6f, 0x7f, 0xaa, 0xff, 0xd8, 0xcb, 0xc2, 0xff, 0xf2, 0xe3, 0xdc, 0xff, 0xe2, 0xdd, 0xde, 0xff, 0xee, 0xe9, 0xe6, 0xff, 0xfa, 0xf3, 0xee, 0xff, 0xf4, 0xea, 0xe9, 0xff, 0xea, 0xe0, 0xe2, 0xff, 0xf4, 0xed, 0xea, 0xff, 0xfe, 0xf7, 0xf4, 0xff, 0xff, 0xf9, 0xf6, 0xff, 0xf6, 0xee, 0xeb, 0xff, 0xb2, 0xb1, 0xb0, 0xff, 0xaa, 0xab, 0xab, 0xff, 0xb1, 0xb1, 0xb0, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb3, 0xb3, 0xb3, 0xde, 0xb1, 0xb1, 0xb1, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x93, 0xcd, 0x1a, 0x8d, 0xa7, 0xd6, 0xd7, 0x9a, 0xb3, 0xe2, 0xff, 0xab, 0xc0, 0xea, 0xff, 0xad, 0xbf, 0xe6, 0xff, 0x9e, 0xb2, 0xdc, 0xff, 0x8e, 0xa7, 0xd4, 0xff, 0x83, 0xa0, 0xd0, 0xff, 0x75, 0x93, 0xcb, 0xff, 0x96, 0xb0, 0xe3, 0xff, 0x9d, 0xb8, 0xe7, 0xff, 0x91, 0xad, 0xdd, 0xff, 0x91, 0xac, 0xd9, 0xff, 0x91, 0xa8, 0xd6, 0xff, 0x8d, 0xa5, 0xd5, 0xff, 0x92, 0xac, 0xdd, 0xff, 0x94, 0xac, 0xde, 0xff, 0x80, 0x9a, 0xd4, 0xff, 0x88, 0x9a, 0xcc, 0xff, 0xd4, 0xcb, 0xd6, 0xff, 0xf3, 0xe6, 0xe6, 0xff, 0xeb, 0xe5, 0xe7, 0xff, 0xec, 0xe5, 0xe8, 0xff, 0xf1, 0xea, 0xeb, 0xff, 0xf3, 0xeb, 0xeb, 0xff, 0xf1, 0xe7, 0xe9, 0xff, 0xef, 0xe3, 0xe5, 0xff, 0xec, 0xe2, 0xe3, 0xff, 0xed, 0xe2, 0xe5, 0xff, 0xec, 0xe2, 0xe3, 0xff, 0xea, 0xe0, 0xe0, 0xff, 0xec, 0xe2, 0xe3, 0xff, 0xed, 0xe3, 0xe3, 0xff, 0xec, 0xdf, 0xe0, 0xff, 0xec, 0xdf, 0xdf, 0xff, 0xef, 0xe3, 0xe0, 0xff, 0xef, 0xe4, 0xde, 0xff, 0xf2, 0xe5, 0xde, 0xff, 0xf7, 0xe6, 0xdf, 0xff, 0xf4, 0xe1, 0xd9, 0xff, 0xf0, 0xde, 0xd7, 0xff, 0xf7, 0xe9, 0xe1, 0xff, 0xf8, 0xec, 0xe5, 0xff, 0xef, 0xe1, 0xe0, 0xff, 0xe6, 0xda, 0xdc, 0xff, 0xe7, 0xdc, 0xdd, 0xff, 0xe2, 0xd5, 0xd7, 0xff, 0xde, 0xd3, 0xd5, 0xff, 0xe0, 0xd6, 0xd8, 0xff, 0xdb, 0xd2, 0xd4, 0xff, 0xdf, 0xd6, 0xd8, 0xff, 0xe1, 0xd9, 0xda, 0xff, 0xe6, 0xdd, 0xde, 0xff, 0xe8, 0xde, 0xe0, 0xff, 0xe7, 0xdc, 0xde, 0xff, 0xe5, 0xda, 0xdc, 0xff, 0xe4, 0xda, 0xdb, 0xff, 0xe1, 0xd7, 0xd8, 0xff, 0xa0, 0x94, 0xa3, 0xff, 0x46, 0x5b, 0x90, 0xff, 0x53, 0x6c, 0xa3, 0xff, 0x45, 0x5f, 0x9d, 0xff, 0x2f, 0x4f, 0x97, 0xff, 0x49, 0x67, 0xad, 0xff, 0x64, 0x7f, 0xbe, 0xff, 0x7b, 0x93, 0xcc, 0xff, 0x3a, 0x55, 0x99, 0xff, 0x6d, 0x79, 0x9d, 0xff, 0xe8, 0xe1, 0xdb, 0xff, 0xf9, 0xee, 0xe8, 0xff, 0xe6, 0xdf, 0xdf, 0xff, 0xcc, 0xc2, 0xc4, 0xff, 0xde, 0xd0, 0xca, 0xff, 0xe4, 0xd4, 0xcc, 0xff, 0xd6, 0xc7, 0xc0, 0xff, 0xe8, 0xdd, 0xd8, 0xff, 0xf2, 0xe9, 0xe4, 0xff, 0xfa, 0xf0, 0xed, 0xff, 0xf3, 0xea, 0xe8, 0xff, 0xe6, 0xdf, 0xdd, 0xff, 0xf4, 0xec, 0xe9, 0xff, 0xfb, 0xf3, 0xf0, 0xff, 0xfe, 0xf8, 0xf5, 0xff, 0xf7, 0xef, 0xec, 0xff, 0xb3, 0xb2, 0xb1, 0xff, 0xa9, 0xab, 0xab, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb1, 0xb1, 0xb1, 0xd7, 0xb3, 0xb3, 0xb3, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x8b, 0xc5, 0x16, 0x83, 0x9c, 0xcd, 0xca, 0x8f, 0xa7, 0xd4, 0xff, 0x98, 0xae, 0xda, 0xff, 0x83, 0x99, 0xc9, 0xff, 0x65, 0x7c, 0xb1, 0xff, 0x5a, 0x77, 0xab, 0xff, 0x62, 0x81, 0xb7, 0xff, 0x83, 0x9e, 0xd2, 0xff, 0x8f, 0xa9, 0xdb, 0xff, 0x8c, 0xa9, 0xd8, 0xff, 0x8e, 0xab, 0xd9, 0xff, 0x92, 0xad, 0xda, 0xff, 0x8c, 0xa6, 0xd4, 0xff, 0x8b, 0xa5, 0xd3, 0xff, 0x8e, 0xa7, 0xd8, 0xff, 0x91, 0xaa, 0xda, 0xff, 0x81, 0x9c, 0xd3, 0xff, 0x8e, 0xa1, 0xd1, 0xff, 0xda, 0xd2, 0xda, 0xff, 0xf5, 0xe9, 0xe7, 0xff, 0xe9, 0xe2, 0xe6, 0xff, 0xf1, 0xe8, 0xe9, 0xff, 0xf4, 0xea, 0xe9, 0xff, 0xee, 0xe3, 0xe5, 0xff, 0xed, 0xe3, 0xe4, 0xff, 0xea, 0xe1, 0xe1, 0xff, 0xea, 0xdf, 0xe1, 0xff, 0xeb, 0xe0, 0xe1, 0xff, 0xe6, 0xdb, 0xdd, 0xff, 0xe7, 0xdd, 0xde, 0xff, 0xed, 0xe3, 0xe2, 0xff, 0xec, 0xe0, 0xe0, 0xff, 0xe8, 0xdc, 0xdc, 0xff, 0xe9, 0xdc, 0xda, 0xff, 0xef, 0xe1, 0xdc, 0xff, 0xf2, 0xe3, 0xdc, 0xff, 0xf6, 0xe6, 0xdd, 0xff, 0xf2, 0xe0, 0xd8, 0xff, 0xea, 0xd8, 0xd0, 0xff, 0xf4, 0xe4, 0xdb, 0xff, 0xf7, 0xe9, 0xe2, 0xff, 0xe7, 0xda, 0xd7, 0xff, 0xd8, 0xca, 0xce, 0xff, 0xd6, 0xc9, 0xcc, 0xff, 0xd4, 0xc8, 0xca, 0xff, 0xdd, 0xd1, 0xd3, 0xff, 0xdf, 0xd3, 0xd6, 0xff, 0xdb, 0xcf, 0xd2, 0xff, 0xdb, 0xd0, 0xd2, 0xff, 0xdc, 0xd3, 0xd4, 0xff, 0xe2, 0xd6, 0xd7, 0xff, 0xe4, 0xd8, 0xdb, 0xff, 0xe4, 0xd9, 0xdb, 0xff, 0xe4, 0xd8, 0xd9, 0xff, 0xdc, 0xd3, 0xd3, 0xff, 0xb9, 0xab, 0xb1, 0xff, 0x4b, 0x54, 0x7e, 0xff, 0x26, 0x44, 0x8b, 0xff, 0x44, 0x5d, 0x97, 0xff, 0x5b, 0x71, 0xa3, 0xff, 0x80, 0x8d, 0xb1, 0xff, 0xad, 0xaf, 0xc4, 0xff, 0xcc, 0xc5, 0xce, 0xff, 0xd2, 0xcb, 0xcf, 0xff, 0xd1, 0xce, 0xd1, 0xff, 0xf9, 0xf1, 0xe5, 0xff, 0xf0, 0xe2, 0xd3, 0xff, 0xf3, 0xe5, 0xd9, 0xff, 0xff, 0xf5, 0xe6, 0xff, 0xfc, 0xf0, 0xe2, 0xff, 0xff, 0xf5, 0xe9, 0xff, 0xff, 0xfc, 0xee, 0xff, 0xec, 0xdd, 0xd1, 0xff, 0xd9, 0xc9, 0xc2, 0xff, 0xea, 0xde, 0xd8, 0xff, 0xfc, 0xf1, 0xee, 0xff, 0xf6, 0xec, 0xe9, 0xff, 0xe6, 0xdf, 0xdc, 0xff, 0xe4, 0xdd, 0xdb, 0xff, 0xf0, 0xe8, 0xe6, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xf6, 0xee, 0xeb, 0xff, 0xb3, 0xb2, 0xb1, 0xff, 0xaa, 0xab, 0xab, 0xff, 0xb2, 0xb1, 0xb2, 0xff, 0xb1, 0xb1, 0xb1, 0xca, 0xad, 0xad, 0xad, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x45, 0x73, 0x0b, 0x37, 0x4b, 0x81, 0xaf, 0x40, 0x56, 0x8d, 0xff, 0x40, 0x56, 0x8c, 0xff, 0x36, 0x50, 0x8d, 0xff, 0x47, 0x65, 0xa1, 0xff, 0x83, 0x9d, 0xd1, 0xff, 0x8d, 0xa5, 0xd6, 0xff, 0x86, 0xa0, 0xd0, 0xff, 0x89, 0xa5, 0xd4, 0xff, 0x8d, 0xa7, 0xd6, 0xff, 0x8d, 0xa6, 0xd5, 0xff, 0x94, 0xae, 0xdc, 0xff, 0x8c, 0xa7, 0xd5, 0xff, 0x84, 0xa0, 0xcf, 0xff, 0x88, 0xa3, 0xd3, 0xff, 0x8c, 0xa3, 0xd2, 0xff, 0x7f, 0x9a, 0xd2, 0xff, 0x8d, 0xa2, 0xd0, 0xff, 0xd0, 0xcd, 0xd9, 0xff, 0xf8, 0xea, 0xe4, 0xff, 0xff, 0xf2, 0xec, 0xff, 0xfc, 0xee, 0xed, 0xff, 0xed, 0xe1, 0xe4, 0xff, 0xef, 0xe3, 0xe4, 0xff, 0xee, 0xe2, 0xe2, 0xff, 0xea, 0xe0, 0xe2, 0xff, 0xe8, 0xdd, 0xde, 0xff, 0xe5, 0xda, 0xdc, 0xff, 0xe9, 0xdd, 0xe0, 0xff, 0xea, 0xdf, 0xdf, 0xff, 0xeb, 0xdf, 0xe0, 0xff, 0xeb, 0xdf, 0xe0, 0xff, 0xe5, 0xd7, 0xd5, 0xff, 0xef, 0xdf, 0xd9, 0xff, 0xf1, 0xe0, 0xd9, 0xff, 0xf1, 0xe0, 0xd7, 0xff, 0xed, 0xda, 0xd2, 0xff, 0xe7, 0xd6, 0xcf, 0xff, 0xeb, 0xda, 0xd3, 0xff, 0xf1, 0xe0, 0xd9, 0xff, 0xdf, 0xd1, 0xce, 0xff, 0xce, 0xbf, 0xc4, 0xff, 0xd5, 0xc8, 0xca, 0xff, 0xd4, 0xc7, 0xc9, 0xff, 0xde, 0xd2, 0xd3, 0xff, 0xe1, 0xd3, 0xd3, 0xff, 0xda, 0xce, 0xd0, 0xff, 0xd9, 0xcf, 0xd2, 0xff, 0xdd, 0xd2, 0xd2, 0xff, 0xe0, 0xd4, 0xd5, 0xff, 0xde, 0xd1, 0xd3, 0xff, 0xdc, 0xd0, 0xd3, 0xff, 0xd4, 0xc8, 0xcb, 0xff, 0xba, 0xaf, 0xb5, 0xff, 0x98, 0x8d, 0x9c, 0xff, 0x7e, 0x83, 0x9e, 0xff, 0x9a, 0xa4, 0xbb, 0xff, 0xb9, 0xba, 0xc4, 0xff, 0xe4, 0xda, 0xd4, 0xff, 0xff, 0xf0, 0xdf, 0xff, 0xfb, 0xec, 0xdb, 0xff, 0xfe, 0xef, 0xde, 0xff, 0xfd, 0xed, 0xe0, 0xff, 0xff, 0xf1, 0xe3, 0xff, 0xf6, 0xed, 0xe1, 0xff, 0xed, 0xe3, 0xdb, 0xff, 0xf2, 0xe5, 0xde, 0xff, 0xff, 0xf5, 0xed, 0xff, 0xff, 0xfa, 0xf1, 0xff, 0xfe, 0xf4, 0xea, 0xff, 0xfa, 0xef, 0xe0, 0xff, 0xff, 0xf4, 0xe7, 0xff, 0xed, 0xdd, 0xd4, 0xff, 0xda, 0xcd, 0xc7, 0xff, 0xed, 0xe1, 0xdf, 0xff, 0xfe, 0xf3, 0xf0, 0xff, 0xfa, 0xf2, 0xee, 0xff, 0xed, 0xe5, 0xe2, 0xff, 0xf8, 0xf1, 0xed, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xf3, 0xec, 0xe9, 0xff, 0xb1, 0xb0, 0xaf, 0xff, 0xab, 0xac, 0xac, 0xff, 0xb3, 0xb3, 0xb3, 0xb0, 0xb9, 0xb9, 0xb9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xaa, 0x03, 0x6a, 0x7e, 0xb5, 0x8b, 0x72, 0x87, 0xbd, 0xff, 0x64, 0x7e, 0xbb, 0xff, 0x6f, 0x89, 0xc7, 0xff, 0x9b, 0xb0, 0xe5, 0xff, 0xa5, 0xbb, 0xeb, 0xff, 0x9d, 0xb4, 0xe2, 0xff, 0x9b, 0xb3, 0xdf, 0xff, 0x9e, 0xb7, 0xe1, 0xff, 0x99, 0xb2, 0xde, 0xff, 0x97, 0xaf, 0xdc, 0xff, 0x94, 0xaf, 0xdc, 0xff, 0x91, 0xac, 0xda, 0xff, 0x8f, 0xa8, 0xd8, 0xff, 0x90, 0xa7, 0xd7, 0xff, 0x90, 0xa6, 0xd5, 0xff, 0x7f, 0x9a, 0xce, 0xff, 0x81, 0x97, 0xca, 0xff, 0xa9, 0xaf, 0xd0, 0xff, 0xd1, 0xce, 0xdb, 0xff, 0xf2, 0xe7, 0xe8, 0xff, 0xff, 0xf0, 0xeb, 0xff, 0xff, 0xec, 0xe7, 0xff, 0xfb, 0xea, 0xe6, 0xff, 0xf6, 0xe6, 0xe0, 0xff, 0xf3, 0xe1, 0xdd, 0xff, 0xf7, 0xe5, 0xe0, 0xff, 0xfa, 0xe8, 0xe1, 0xff, 0xf9, 0xe7, 0xe3, 0xff, 0xf6, 0xe4, 0xde, 0xff, 0xff, 0xee, 0xe4, 0xff, 0xfa, 0xe7, 0xdc, 0xff, 0xfb, 0xe1, 0xd4, 0xff, 0xff, 0xec, 0xdb, 0xff, 0xff, 0xef, 0xde, 0xff, 0xf9, 0xdf, 0xd1, 0xff, 0xfd, 0xe4, 0xd5, 0xff, 0xf8, 0xde, 0xcf, 0xff, 0xef, 0xd7, 0xca, 0xff, 0xef, 0xd9, 0xd1, 0xff, 0xe8, 0xd3, 0xcf, 0xff, 0xed, 0xdb, 0xd6, 0xff, 0xe8, 0xd5, 0xcf, 0xff, 0xee, 0xda, 0xd3, 0xff, 0xf1, 0xdc, 0xd4, 0xff, 0xeb, 0xd7, 0xd1, 0xff, 0xeb, 0xd8, 0xd2, 0xff, 0xda, 0xcd, 0xcc, 0xff, 0xd4, 0xc9, 0xcc, 0xff, 0xd8, 0xce, 0xce, 0xff, 0xd8, 0xce, 0xcd, 0xff, 0xd3, 0xcb, 0xcb, 0xff, 0xd1, 0xc7, 0xc8, 0xff, 0xde, 0xd4, 0xd1, 0xff, 0xf7, 0xeb, 0xe0, 0xff, 0xff, 0xf0, 0xe0, 0xff, 0xf9, 0xea, 0xde, 0xff, 0xf0, 0xe6, 0xda, 0xff, 0xf0, 0xe5, 0xde, 0xff, 0xf3, 0xe7, 0xe0, 0xff, 0xeb, 0xe0, 0xd8, 0xff, 0xf1, 0xe6, 0xde, 0xff, 0xf6, 0xeb, 0xe3, 0xff, 0xf8, 0xec, 0xe5, 0xff, 0xf9, 0xec, 0xe4, 0xff, 0xfd, 0xf1, 0xe9, 0xff, 0xfd, 0xf4, 0xeb, 0xff, 0xfd, 0xf5, 0xeb, 0xff, 0xfb, 0xf1, 0xe6, 0xff, 0xf6, 0xe5, 0xd9, 0xff, 0xff, 0xf7, 0xe9, 0xff, 0xff, 0xf7, 0xe9, 0xff, 0xdd, 0xcf, 0xc9, 0xff, 0xe7, 0xda, 0xd8, 0xff, 0xff, 0xf6, 0xf1, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfd, 0xf4, 0xf1, 0xff, 0xff, 0xf8, 0xf4, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xf1, 0xeb, 0xe7, 0xff, 0xb1, 0xaf, 0xb0, 0xff, 0xac, 0xae, 0xac, 0x8b, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x9e, 0xd3, 0x57, 0x89, 0x9b, 0xd3, 0xf3, 0x85, 0x9a, 0xd3, 0xff, 0x99, 0xaf, 0xe1, 0xff, 0xac, 0xc2, 0xee, 0xff, 0xa3, 0xb9, 0xe8, 0xff, 0x9d, 0xb3, 0xe2, 0xff, 0x9d, 0xb4, 0xe0, 0xff, 0x99, 0xb0, 0xdc, 0xff, 0x97, 0xae, 0xd9, 0xff, 0x9a, 0xb1, 0xdd, 0xff, 0x9a, 0xb3, 0xdf, 0xff, 0x97, 0xaf, 0xdd, 0xff, 0x95, 0xad, 0xdb, 0xff, 0x96, 0xad, 0xdc, 0xff, 0x95, 0xad, 0xdc, 0xff, 0x86, 0x9f, 0xd0, 0xff, 0x77, 0x92, 0xcc, 0xff, 0x75, 0x93, 0xca, 0xff, 0x8a, 0xa1, 0xce, 0xff, 0xaf, 0xb8, 0xd4, 0xff, 0xc8, 0xc5, 0xd3, 0xff, 0xd3, 0xcd, 0xd7, 0xff, 0xd0, 0xc9, 0xd1, 0xff, 0xc7, 0xc1, 0xce, 0xff, 0xc0, 0xc0, 0xd1, 0xff, 0xbc, 0xbe, 0xd2, 0xff, 0xb8, 0xba, 0xd0, 0xff, 0xaf, 0xb3, 0xc9, 0xff, 0xb1, 0xb4, 0xcb, 0xff, 0xb1, 0xb4, 0xcb, 0xff, 0xaa, 0xae, 0xc4, 0xff, 0xaf, 0xb3, 0xc6, 0xff, 0xbf, 0xbf, 0xd0, 0xff, 0xba, 0xb9, 0xc7, 0xff, 0xc2, 0xbe, 0xcc, 0xff, 0xc0, 0xb9, 0xc2, 0xff, 0xb8, 0xb1, 0xb8, 0xff, 0xc3, 0xbe, 0xc8, 0xff, 0xc0, 0xbe, 0xcb, 0xff, 0xbb, 0xbb, 0xc9, 0xff, 0xad, 0xaf, 0xc1, 0xff, 0xa6, 0xaa, 0xbe, 0xff, 0x9c, 0xa6, 0xc0, 0xff, 0x8f, 0x9d, 0xbd, 0xff, 0x96, 0x9d, 0xb6, 0xff, 0xe6, 0xdc, 0xd6, 0xff, 0xeb, 0xe1, 0xda, 0xff, 0xe0, 0xd7, 0xd4, 0xff, 0xe5, 0xdc, 0xd8, 0xff, 0xeb, 0xe2, 0xdc, 0xff, 0xf0, 0xe5, 0xdd, 0xff, 0xef, 0xe2, 0xda, 0xff, 0xed, 0xe2, 0xda, 0xff, 0xf1, 0xe9, 0xdd, 0xff, 0xef, 0xe5, 0xdd, 0xff, 0xec, 0xe1, 0xda, 0xff, 0xf0, 0xe6, 0xde, 0xff, 0xf8, 0xed, 0xe4, 0xff, 0xf2, 0xe7, 0xdf, 0xff, 0xf4, 0xe9, 0xe1, 0xff, 0xfb, 0xf0, 0xe8, 0xff, 0xfd, 0xf2, 0xea, 0xff, 0xfb, 0xf0, 0xe8, 0xff, 0xf8, 0xeb, 0xe3, 0xff, 0xfc, 0xf1, 0xe9, 0xff, 0xfd, 0xf0, 0xe9, 0xff, 0xfc, 0xf3, 0xe9, 0xff, 0xfd, 0xf0, 0xe7, 0xff, 0xef, 0xe0, 0xd6, 0xff, 0xe9, 0xde, 0xd1, 0xff, 0xf5, 0xec, 0xe0, 0xff, 0xf7, 0xeb, 0xe4, 0xff, 0xfb, 0xef, 0xeb, 0xff, 0xfd, 0xf1, 0xee, 0xff, 0xfd, 0xf3, 0xef, 0xff, 0xff, 0xf6, 0xf3, 0xff, 0xff, 0xf8, 0xf5, 0xff, 0xf0, 0xeb, 0xe6, 0xf3, 0xaf, 0xaf, 0xaf, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x9a, 0xd5, 0x2b, 0x96, 0xa8, 0xe3, 0xd2, 0xa0, 0xb6, 0xe9, 0xff, 0xa1, 0xb8, 0xe6, 0xff, 0xa8, 0xbd, 0xe8, 0xff, 0xa5, 0xb8, 0xe6, 0xff, 0x98, 0xb0, 0xe0, 0xff, 0x9b, 0xb2, 0xe1, 0xff, 0x9b, 0xb3, 0xde, 0xff, 0x9b, 0xb3, 0xdf, 0xff, 0x9a, 0xb3, 0xdf, 0xff, 0x99, 0xb1, 0xdf, 0xff, 0x9b, 0xb3, 0xe0, 0xff, 0x99, 0xb1, 0xdf, 0xff, 0x99, 0xb1, 0xdf, 0xff, 0x94, 0xad, 0xd8, 0xff, 0x8a, 0xa2, 0xce, 0xff, 0x81, 0x99, 0xcb, 0xff, 0x7a, 0x95, 0xca, 0xff, 0x65, 0x82, 0xb7, 0xff, 0x6c, 0x86, 0xb8, 0xff, 0x77, 0x8f, 0xbd, 0xff, 0x77, 0x8e, 0xbd, 0xff, 0x72, 0x8b, 0xbe, 0xff, 0x6d, 0x8a, 0xc0, 0xff, 0x6a, 0x89, 0xc1, 0xff, 0x65, 0x87, 0xbe, 0xff, 0x61, 0x84, 0xbc, 0xff, 0x5d, 0x7e, 0xba, 0xff, 0x5d, 0x81, 0xbb, 0xff, 0x5f, 0x85, 0xbf, 0xff, 0x5c, 0x82, 0xbc, 0xff, 0x5c, 0x81, 0xba, 0xff, 0x61, 0x87, 0xc0, 0xff, 0x64, 0x88, 0xc4, 0xff, 0x64, 0x87, 0xc2, 0xff, 0x68, 0x8b, 0xc3, 0xff, 0x65, 0x88, 0xbe, 0xff, 0x63, 0x87, 0xbd, 0xff, 0x60, 0x84, 0xbb, 0xff, 0x5f, 0x83, 0xbc, 0xff, 0x5c, 0x81, 0xba, 0xff, 0x55, 0x7e, 0xb6, 0xff, 0x56, 0x82, 0xba, 0xff, 0x47, 0x75, 0xb5, 0xff, 0x98, 0xa6, 0xc0, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xf1, 0xe7, 0xdf, 0xff, 0xf0, 0xe6, 0xe0, 0xff, 0xf3, 0xe9, 0xe3, 0xff, 0xf3, 0xeb, 0xe1, 0xff, 0xef, 0xe5, 0xdd, 0xff, 0xf3, 0xe9, 0xe1, 0xff, 0xf4, 0xea, 0xe1, 0xff, 0xf6, 0xeb, 0xe3, 0xff, 0xf7, 0xeb, 0xe4, 0xff, 0xf8, 0xed, 0xe5, 0xff, 0xf8, 0xed, 0xe5, 0xff, 0xfb, 0xf0, 0xe8, 0xff, 0xfb, 0xf0, 0xe8, 0xff, 0xf9, 0xee, 0xe6, 0xff, 0xf8, 0xed, 0xe5, 0xff, 0xfc, 0xf4, 0xeb, 0xff, 0xf8, 0xed, 0xe5, 0xff, 0xfa, 0xef, 0xe7, 0xff, 0xfb, 0xed, 0xe4, 0xff, 0xfb, 0xee, 0xe6, 0xff, 0xfb, 0xf1, 0xe9, 0xff, 0xe3, 0xd1, 0xc8, 0xff, 0xf3, 0xe5, 0xd8, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xfd, 0xf7, 0xeb, 0xff, 0xf9, 0xee, 0xe8, 0xff, 0xfc, 0xf2, 0xed, 0xff, 0xfc, 0xf3, 0xee, 0xff, 0xfd, 0xf4, 0xf0, 0xff, 0xff, 0xf7, 0xf5, 0xd2, 0xed, 0xe7, 0xe2, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x7f, 0xbf, 0x08, 0x8e, 0xa5, 0xe0, 0x8f, 0xa0, 0xb1, 0xe1, 0xfe, 0xa8, 0xba, 0xe6, 0xff, 0xae, 0xc4, 0xe7, 0xff, 0xab, 0xc0, 0xe5, 0xff, 0xa4, 0xbb, 0xe7, 0xff, 0x9f, 0xb9, 0xe7, 0xff, 0xa1, 0xb9, 0xe7, 0xff, 0x9e, 0xb5, 0xe3, 0xff, 0x9e, 0xb5, 0xe1, 0xff, 0xa1, 0xb7, 0xe3, 0xff, 0xa1, 0xb8, 0xe5, 0xff, 0x95, 0xad, 0xdb, 0xff, 0x83, 0x9b, 0xca, 0xff, 0x7e, 0x94, 0xc4, 0xff, 0x86, 0x9c, 0xcb, 0xff, 0x6b, 0x81, 0xb3, 0xff, 0x71, 0x86, 0xb5, 0xff, 0x93, 0xac, 0xd4, 0xff, 0x8f, 0xa8, 0xd3, 0xff, 0x87, 0x9f, 0xce, 0xff, 0x81, 0x99, 0xca, 0xff, 0x7b, 0x97, 0xc6, 0xff, 0x74, 0x92, 0xc2, 0xff, 0x6f, 0x8f, 0xc0, 0xff, 0x71, 0x91, 0xc3, 0xff, 0x71, 0x91, 0xc5, 0xff, 0x71, 0x91, 0xc5, 0xff, 0x73, 0x93, 0xc7, 0xff, 0x74, 0x93, 0xc6, 0xff, 0x75, 0x94, 0xc9, 0xff, 0x76, 0x95, 0xcb, 0xff, 0x78, 0x97, 0xcd, 0xff, 0x75, 0x96, 0xcc, 0xff, 0x77, 0x99, 0xcd, 0xff, 0x73, 0x96, 0xc9, 0xff, 0x73, 0x95, 0xc9, 0xff, 0x72, 0x93, 0xc8, 0xff, 0x73, 0x93, 0xc9, 0xff, 0x74, 0x95, 0xca, 0xff, 0x6f, 0x92, 0xc6, 0xff, 0x6f, 0x94, 0xc7, 0xff, 0x79, 0x9c, 0xcf, 0xff, 0x5a, 0x80, 0xb9, 0xff, 0xc6, 0xcc, 0xd6, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf1, 0xe8, 0xe1, 0xff, 0xf6, 0xec, 0xe3, 0xff, 0xf7, 0xed, 0xe4, 0xff, 0xf5, 0xeb, 0xe3, 0xff, 0xf7, 0xec, 0xe4, 0xff, 0xf8, 0xed, 0xe5, 0xff, 0xfa, 0xee, 0xe6, 0xff, 0xfa, 0xef, 0xe7, 0xff, 0xfa, 0xef, 0xe7, 0xff, 0xf8, 0xed, 0xe5, 0xff, 0xfb, 0xef, 0xe7, 0xff, 0xfb, 0xf0, 0xe8, 0xff, 0xfa, 0xef, 0xe7, 0xff, 0xfa, 0xef, 0xe7, 0xff, 0xfa, 0xee, 0xe6, 0xff, 0xf8, 0xee, 0xe6, 0xff, 0xfa, 0xf0, 0xe8, 0xff, 0xfa, 0xf0, 0xe7, 0xff, 0xf6, 0xe9, 0xe1, 0xff, 0xf9, 0xec, 0xe2, 0xff, 0xfb, 0xec, 0xdf, 0xff, 0xfc, 0xed, 0xdf, 0xff, 0xff, 0xf8, 0xea, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xfd, 0xf4, 0xeb, 0xff, 0xfc, 0xf0, 0xed, 0xff, 0xf9, 0xf0, 0xed, 0xfe, 0xfb, 0xf4, 0xf0, 0x8f, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x96, 0xd4, 0x42, 0x9a, 0xac, 0xd6, 0xdb, 0xb5, 0xc6, 0xe4, 0xff, 0xb4, 0xc6, 0xe8, 0xff, 0xaf, 0xc3, 0xe8, 0xff, 0xa8, 0xbe, 0xe6, 0xff, 0xa6, 0xbe, 0xe6, 0xff, 0xa5, 0xbe, 0xe7, 0xff, 0xa3, 0xbd, 0xe7, 0xff, 0xa1, 0xba, 0xe5, 0xff, 0x9a, 0xb2, 0xde, 0xff, 0x8b, 0xa3, 0xd1, 0xff, 0x89, 0xa1, 0xd0, 0xff, 0xa1, 0xb7, 0xe3, 0xff, 0x87, 0x9f, 0xd1, 0xff, 0x48, 0x63, 0x9b, 0xff, 0x93, 0xaa, 0xd4, 0xff, 0xbd, 0xd1, 0xf5, 0xff, 0xab, 0xc1, 0xe9, 0xff, 0xa2, 0xb7, 0xe5, 0xff, 0x92, 0xab, 0xd9, 0xff, 0x89, 0xa4, 0xd3, 0xff, 0x84, 0xa0, 0xd0, 0xff, 0x82, 0x9f, 0xcf, 0xff, 0x84, 0xa1, 0xd1, 0xff, 0x84, 0xa1, 0xd2, 0xff, 0x80, 0x9f, 0xd1, 0xff, 0x7f, 0xa1, 0xd2, 0xff, 0x80, 0xa0, 0xd2, 0xff, 0x7f, 0x9f, 0xd3, 0xff, 0x7f, 0x9f, 0xd3, 0xff, 0x82, 0xa2, 0xd3, 0xff, 0x85, 0xa5, 0xd6, 0xff, 0x82, 0xa3, 0xd5, 0xff, 0x7d, 0x9e, 0xd1, 0xff, 0x7c, 0x9c, 0xd1, 0xff, 0x7d, 0x9d, 0xd3, 0xff, 0x7a, 0x9a, 0xd0, 0xff, 0x7d, 0x9d, 0xd2, 0xff, 0x7b, 0x9c, 0xd0, 0xff, 0x7b, 0x9c, 0xd0, 0xff, 0x80, 0xa0, 0xd3, 0xff, 0x76, 0x9d, 0xd4, 0xff, 0x85, 0x9f, 0xc7, 0xff, 0xf9, 0xf1, 0xe6, 0xff, 0xff, 0xf7, 0xeb, 0xff, 0xf7, 0xee, 0xe5, 0xff, 0xfa, 0xee, 0xe6, 0xff, 0xfa, 0xee, 0xe7, 0xff, 0xf8, 0xec, 0xe4, 0xff, 0xf9, 0xef, 0xe7, 0xff, 0xf8, 0xee, 0xe6, 0xff, 0xf9, 0xef, 0xe7, 0xff, 0xfb, 0xf0, 0xe8, 0xff, 0xfa, 0xef, 0xe7, 0xff, 0xf9, 0xec, 0xe5, 0xff, 0xf7, 0xec, 0xe5, 0xff, 0xfa, 0xf0, 0xe7, 0xff, 0xfb, 0xf0, 0xe8, 0xff, 0xf9, 0xee, 0xe6, 0xff, 0xfa, 0xef, 0xe7, 0xff, 0xfa, 0xef, 0xe7, 0xff, 0xfd, 0xf2, 0xeb, 0xff, 0xfc, 0xf1, 0xe8, 0xff, 0xf7, 0xe7, 0xda, 0xff, 0xfe, 0xef, 0xe2, 0xff, 0xfc, 0xec, 0xdf, 0xff, 0xfb, 0xee, 0xe1, 0xff, 0xff, 0xf7, 0xe9, 0xff, 0xfe, 0xf7, 0xec, 0xff, 0xfc, 0xf3, 0xed, 0xdb, 0xff, 0xf3, 0xef, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x8d, 0xc6, 0x09, 0x97, 0xa8, 0xcf, 0x87, 0xae, 0xbf, 0xde, 0xf9, 0xbd, 0xcb, 0xe8, 0xff, 0xc1, 0xce, 0xec, 0xff, 0xbc, 0xcd, 0xec, 0xff, 0xb4, 0xca, 0xec, 0xff, 0xae, 0xc4, 0xea, 0xff, 0xa5, 0xbc, 0xe5, 0xff, 0x99, 0xb0, 0xd8, 0xff, 0xa1, 0xb4, 0xdc, 0xff, 0xb3, 0xc6, 0xea, 0xff, 0xbb, 0xd0, 0xf2, 0xff, 0x7e, 0x96, 0xc9, 0xff, 0x62, 0x7c, 0xb5, 0xff, 0xa7, 0xbb, 0xe4, 0xff, 0xb8, 0xcb, 0xed, 0xff, 0xb0, 0xc4, 0xed, 0xff, 0xab, 0xbf, 0xec, 0xff, 0xa2, 0xb9, 0xe7, 0xff, 0x9f, 0xb5, 0xe2, 0xff, 0x9c, 0xb4, 0xe1, 0xff, 0x98, 0xb0, 0xdf, 0xff, 0x98, 0xb0, 0xde, 0xff, 0x94, 0xac, 0xda, 0xff, 0x94, 0xad, 0xdb, 0xff, 0x93, 0xaf, 0xdf, 0xff, 0x92, 0xae, 0xdf, 0xff, 0x90, 0xac, 0xdb, 0xff, 0x8e, 0xac, 0xda, 0xff, 0x91, 0xad, 0xdc, 0xff, 0x91, 0xae, 0xdd, 0xff, 0x8b, 0xa8, 0xd8, 0xff, 0x88, 0xa5, 0xd8, 0xff, 0x89, 0xa6, 0xda, 0xff, 0x86, 0xa4, 0xd7, 0xff, 0x88, 0xa6, 0xd9, 0xff, 0x8a, 0xa8, 0xdb, 0xff, 0x8a, 0xa8, 0xda, 0xff, 0x88, 0xa7, 0xd8, 0xff, 0x87, 0xa9, 0xda, 0xff, 0x8b, 0xaa, 0xdd, 0xff, 0x78, 0x96, 0xd1, 0xff, 0xb1, 0xbf, 0xd5, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xfd, 0xf3, 0xe9, 0xff, 0xfb, 0xf0, 0xe8, 0xff, 0xfa, 0xef, 0xe7, 0xff, 0xfb, 0xf0, 0xe8, 0xff, 0xfc, 0xef, 0xe7, 0xff, 0xfb, 0xef, 0xe7, 0xff, 0xfb, 0xee, 0xe7, 0xff, 0xfb, 0xee, 0xe7, 0xff, 0xf9, 0xef, 0xe7, 0xff, 0xf9, 0xee, 0xe6, 0xff, 0xfa, 0xee, 0xe5, 0xff, 0xf9, 0xed, 0xe5, 0xff, 0xf9, 0xee, 0xe5, 0xff, 0xfb, 0xf2, 0xe8, 0xff, 0xfd, 0xf2, 0xea, 0xff, 0xfc, 0xf1, 0xe9, 0xff, 0xfd, 0xf3, 0xea, 0xff, 0xff, 0xf7, 0xef, 0xff, 0xfa, 0xef, 0xe4, 0xff, 0xf6, 0xe5, 0xd9, 0xff, 0xfc, 0xee, 0xdf, 0xff, 0xfc, 0xf3, 0xe6, 0xff, 0xff, 0xf7, 0xea, 0xf9, 0xff, 0xf9, 0xea, 0x88, 0xff, 0xff, 0xe2, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x90, 0xba, 0x25, 0x9d, 0xaf, 0xd2, 0xb7, 0xb9, 0xc8, 0xe5, 0xff, 0xc2, 0xcf, 0xed, 0xff, 0xc2, 0xd2, 0xef, 0xff, 0xbc, 0xcd, 0xee, 0xff, 0xaf, 0xc2, 0xe5, 0xff, 0xa8, 0xbb, 0xdf, 0xff, 0xb0, 0xc2, 0xe3, 0xff, 0xb4, 0xc5, 0xe8, 0xff, 0xa4, 0xb6, 0xde, 0xff, 0x93, 0xa9, 0xd6, 0xff, 0x9e, 0xb4, 0xe1, 0xff, 0xab, 0xbd, 0xe7, 0xff, 0xa9, 0xbc, 0xe4, 0xff, 0xaa, 0xc0, 0xe9, 0xff, 0xac, 0xc2, 0xeb, 0xff, 0xae, 0xc2, 0xec, 0xff, 0xb0, 0xc4, 0xed, 0xff, 0xaa, 0xc0, 0xea, 0xff, 0xa3, 0xbc, 0xe6, 0xff, 0xa1, 0xb8, 0xe5, 0xff, 0x9e, 0xb5, 0xe3, 0xff, 0xa1, 0xb9, 0xe5, 0xff, 0xa0, 0xb6, 0xe4, 0xff, 0xa0, 0xb6, 0xe4, 0xff, 0xa2, 0xb9, 0xe5, 0xff, 0x9f, 0xb6, 0xe3, 0xff, 0xa0, 0xb8, 0xe5, 0xff, 0x9d, 0xb5, 0xe1, 0xff, 0x98, 0xb2, 0xdf, 0xff, 0x98, 0xb2, 0xe0, 0xff, 0x95, 0xaf, 0xe0, 0xff, 0x95, 0xae, 0xde, 0xff, 0x94, 0xaf, 0xdf, 0xff, 0x90, 0xaf, 0xdf, 0xff, 0x8f, 0xab, 0xdd, 0xff, 0x92, 0xad, 0xe0, 0xff, 0x92, 0xb0, 0xdf, 0xff, 0x96, 0xaf, 0xdf, 0xff, 0x9a, 0xb3, 0xe7, 0xff, 0x87, 0xa3, 0xd4, 0xff, 0xd9, 0xdf, 0xe1, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xfb, 0xee, 0xe7, 0xff, 0xfb, 0xef, 0xe7, 0xff, 0xfb, 0xf0, 0xe8, 0xff, 0xfb, 0xef, 0xe8, 0xff, 0xf9, 0xed, 0xe6, 0xff, 0xf8, 0xec, 0xe4, 0xff, 0xfb, 0xee, 0xe4, 0xff, 0xfa, 0xee, 0xe5, 0xff, 0xfb, 0xf0, 0xe7, 0xff, 0xfc, 0xf2, 0xe8, 0xff, 0xfb, 0xf0, 0xe9, 0xff, 0xfb, 0xf1, 0xe7, 0xff, 0xfa, 0xf0, 0xe6, 0xff, 0xfd, 0xf2, 0xe9, 0xff, 0xfc, 0xf2, 0xe9, 0xff, 0xfc, 0xf3, 0xe8, 0xff, 0xfd, 0xf4, 0xed, 0xff, 0xff, 0xf6, 0xed, 0xff, 0xfa, 0xea, 0xdf, 0xff, 0xf8, 0xe5, 0xd8, 0xff, 0xfd, 0xf2, 0xe7, 0xb7, 0xff, 0xf8, 0xf1, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xa3, 0xcc, 0x46, 0xa5, 0xb8, 0xde, 0xca, 0xb4, 0xc4, 0xe2, 0xff, 0xb6, 0xc8, 0xe9, 0xff, 0xaf, 0xc1, 0xe6, 0xff, 0xa7, 0xbb, 0xdf, 0xff, 0xab, 0xbf, 0xe1, 0xff, 0xa9, 0xbc, 0xdf, 0xff, 0xa5, 0xb7, 0xdd, 0xff, 0xac, 0xbf, 0xe1, 0xff, 0xae, 0xc1, 0xe3, 0xff, 0xad, 0xc0, 0xe5, 0xff, 0xa9, 0xbc, 0xe5, 0xff, 0xa7, 0xba, 0xe4, 0xff, 0xa9, 0xbd, 0xe7, 0xff, 0xab, 0xbd, 0xe8, 0xff, 0xab, 0xbf, 0xe9, 0xff, 0xa6, 0xbd, 0xe7, 0xff, 0xa5, 0xbd, 0xe6, 0xff, 0xa6, 0xbe, 0xe7, 0xff, 0xa2, 0xba, 0xe4, 0xff, 0xa2, 0xb9, 0xe5, 0xff, 0xa2, 0xb9, 0xe7, 0xff, 0x9f, 0xb7, 0xe4, 0xff, 0xa3, 0xbb, 0xe7, 0xff, 0xa0, 0xb7, 0xe4, 0xff, 0xa3, 0xba, 0xe6, 0xff, 0xa1, 0xb9, 0xe2, 0xff, 0xa0, 0xb7, 0xe2, 0xff, 0x9d, 0xb5, 0xe1, 0xff, 0x9a, 0xb3, 0xe0, 0xff, 0x9d, 0xb7, 0xe3, 0xff, 0x96, 0xb1, 0xe0, 0xff, 0x96, 0xb1, 0xe0, 0xff, 0x97, 0xb1, 0xdf, 0xff, 0x96, 0xb0, 0xe0, 0xff, 0x9a, 0xb2, 0xe2, 0xff, 0x9f, 0xb5, 0xe2, 0xff, 0xa0, 0xb9, 0xe5, 0xff, 0x96, 0xb2, 0xe3, 0xff, 0xa7, 0xb7, 0xd7, 0xff, 0xfd, 0xf8, 0xed, 0xff, 0xff, 0xf6, 0xeb, 0xff, 0xfa, 0xee, 0xe7, 0xff, 0xf9, 0xed, 0xe6, 0xff, 0xfa, 0xef, 0xe7, 0xff, 0xf8, 0xed, 0xe4, 0xff, 0xf9, 0xef, 0xe4, 0xff, 0xfc, 0xf0, 0xe3, 0xff, 0xfb, 0xee, 0xe2, 0xff, 0xfa, 0xed, 0xe0, 0xff, 0xfb, 0xf1, 0xe5, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xfc, 0xf3, 0xe9, 0xff, 0xfc, 0xf1, 0xe6, 0xff, 0xfb, 0xef, 0xe5, 0xff, 0xfd, 0xf2, 0xe7, 0xff, 0xfc, 0xf3, 0xe8, 0xff, 0xfe, 0xf2, 0xe9, 0xff, 0xfd, 0xf4, 0xeb, 0xff, 0xfe, 0xf6, 0xec, 0xca, 0xfb, 0xe9, 0xde, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x98, 0xc6, 0x4d, 0x93, 0xa8, 0xd0, 0xcc, 0x97, 0xb0, 0xd9, 0xff, 0x96, 0xad, 0xd8, 0xff, 0x9b, 0xb0, 0xd6, 0xff, 0xa5, 0xb9, 0xda, 0xff, 0xa9, 0xbc, 0xda, 0xff, 0xa8, 0xba, 0xdb, 0xff, 0xab, 0xbc, 0xe0, 0xff, 0xa8, 0xb9, 0xe0, 0xff, 0xa7, 0xba, 0xe1, 0xff, 0xad, 0xbf, 0xe4, 0xff, 0xac, 0xbf, 0xe4, 0xff, 0xa1, 0xb5, 0xde, 0xff, 0x9b, 0xb0, 0xdb, 0xff, 0x99, 0xb0, 0xdb, 0xff, 0x9a, 0xb2, 0xdd, 0xff, 0x9d, 0xb5, 0xdf, 0xff, 0x9c, 0xb4, 0xde, 0xff, 0x9b, 0xb3, 0xdf, 0xff, 0x9d, 0xb4, 0xe2, 0xff, 0x98, 0xb0, 0xde, 0xff, 0x9a, 0xb3, 0xdf, 0xff, 0x9b, 0xb4, 0xe0, 0xff, 0x99, 0xb1, 0xde, 0xff, 0x9b, 0xb4, 0xe0, 0xff, 0x9b, 0xb1, 0xdd, 0xff, 0x98, 0xb0, 0xdb, 0xff, 0x98, 0xb2, 0xdd, 0xff, 0x9a, 0xb2, 0xdd, 0xff, 0x99, 0xb3, 0xdf, 0xff, 0x98, 0xb2, 0xdf, 0xff, 0x94, 0xae, 0xdb, 0xff, 0x94, 0xad, 0xdb, 0xff, 0x98, 0xaf, 0xde, 0xff, 0x96, 0xaf, 0xdf, 0xff, 0x94, 0xae, 0xde, 0xff, 0x9d, 0xb7, 0xe4, 0xff, 0x88, 0xa3, 0xd6, 0xff, 0xbe, 0xc7, 0xd8, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xfb, 0xef, 0xe6, 0xff, 0xfb, 0xef, 0xe7, 0xff, 0xfd, 0xf0, 0xe5, 0xff, 0xfb, 0xef, 0xe3, 0xff, 0xfb, 0xee, 0xe1, 0xff, 0xfe, 0xef, 0xe3, 0xff, 0xfd, 0xef, 0xe2, 0xff, 0xfc, 0xed, 0xe1, 0xff, 0xfa, 0xeb, 0xe0, 0xff, 0xfa, 0xec, 0xe3, 0xff, 0xfd, 0xf1, 0xe8, 0xff, 0xfe, 0xf3, 0xea, 0xff, 0xfe, 0xf2, 0xe9, 0xff, 0xfd, 0xee, 0xe3, 0xff, 0xfe, 0xf1, 0xe3, 0xff, 0xfc, 0xf2, 0xe6, 0xcc, 0xfb, 0xf1, 0xeb, 0x4d, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x8d, 0xc0, 0x41, 0x72, 0x8c, 0xc0, 0xb4, 0x7f, 0x95, 0xc1, 0xfe, 0x8c, 0xa0, 0xc4, 0xff, 0x96, 0xa9, 0xc9, 0xff, 0x99, 0xa8, 0xcc, 0xff, 0x9e, 0xae, 0xd2, 0xff, 0xa5, 0xb6, 0xd9, 0xff, 0xa5, 0xb5, 0xdb, 0xff, 0xa7, 0xb8, 0xde, 0xff, 0xab, 0xbe, 0xe0, 0xff, 0xa7, 0xba, 0xdf, 0xff, 0xa3, 0xb6, 0xdd, 0xff, 0x9f, 0xb3, 0xdb, 0xff, 0x9f, 0xb4, 0xdd, 0xff, 0x98, 0xad, 0xd9, 0xff, 0x97, 0xae, 0xd8, 0xff, 0x99, 0xb1, 0xda, 0xff, 0x95, 0xad, 0xda, 0xff, 0x90, 0xa9, 0xd7, 0xff, 0x8e, 0xa6, 0xd5, 0xff, 0x8f, 0xa7, 0xd5, 0xff, 0x8c, 0xa5, 0xd3, 0xff, 0x8d, 0xa7, 0xd5, 0xff, 0x91, 0xa9, 0xd7, 0xff, 0x8c, 0xa5, 0xd4, 0xff, 0x8f, 0xa8, 0xd6, 0xff, 0x91, 0xa9, 0xd6, 0xff, 0x93, 0xab, 0xd7, 0xff, 0x90, 0xa9, 0xd6, 0xff, 0x8e, 0xa8, 0xd6, 0xff, 0x8c, 0xa6, 0xd5, 0xff, 0x88, 0xa5, 0xd2, 0xff, 0x89, 0xa7, 0xd5, 0xff, 0x87, 0xa4, 0xd5, 0xff, 0x8c, 0xa7, 0xd7, 0xff, 0x89, 0xa8, 0xd9, 0xff, 0x77, 0x92, 0xbf, 0xff, 0xe5, 0xe6, 0xe0, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xfd, 0xf0, 0xe6, 0xff, 0xfc, 0xee, 0xe3, 0xff, 0xfd, 0xef, 0xe1, 0xff, 0xfa, 0xeb, 0xe1, 0xff, 0xfb, 0xec, 0xe2, 0xff, 0xfa, 0xeb, 0xdf, 0xff, 0xfa, 0xed, 0xe1, 0xff, 0xfc, 0xef, 0xe5, 0xff, 0xfa, 0xeb, 0xe1, 0xff, 0xf9, 0xe9, 0xdf, 0xff, 0xfb, 0xec, 0xe3, 0xff, 0xfc, 0xf1, 0xe7, 0xfe, 0xff, 0xf3, 0xe8, 0xb4, 0xfb, 0xef, 0xe3, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x8a, 0xb6, 0x23, 0x79, 0x8a, 0xb2, 0x88, 0x75, 0x86, 0xac, 0xe6, 0x6d, 0x7e, 0xa8, 0xff, 0x6d, 0x7f, 0xaf, 0xff, 0x86, 0x9a, 0xc1, 0xff, 0x98, 0xaa, 0xcd, 0xff, 0x9a, 0xab, 0xd1, 0xff, 0x9f, 0xb1, 0xd6, 0xff, 0xa2, 0xb5, 0xd9, 0xff, 0xa2, 0xb6, 0xda, 0xff, 0xa2, 0xb5, 0xdb, 0xff, 0xa8, 0xb9, 0xdf, 0xff, 0xa9, 0xba, 0xe0, 0xff, 0xa2, 0xb6, 0xdd, 0xff, 0xa4, 0xb9, 0xdf, 0xff, 0xa0, 0xb5, 0xdd, 0xff, 0x9b, 0xb4, 0xdc, 0xff, 0x96, 0xae, 0xdb, 0xff, 0x8f, 0xa6, 0xd6, 0xff, 0x8a, 0xa4, 0xd2, 0xff, 0x82, 0x9e, 0xcd, 0xff, 0x84, 0x9e, 0xce, 0xff, 0x80, 0x9c, 0xcc, 0xff, 0x80, 0x9b, 0xca, 0xff, 0x81, 0x9a, 0xca, 0xff, 0x83, 0x9c, 0xcc, 0xff, 0x84, 0x9f, 0xcd, 0xff, 0x81, 0x9e, 0xcb, 0xff, 0x7d, 0x9b, 0xc9, 0xff, 0x7c, 0x9a, 0xc9, 0xff, 0x7d, 0x9c, 0xcc, 0xff, 0x7f, 0x9d, 0xd0, 0xff, 0x7a, 0x99, 0xcb, 0xff, 0x7f, 0xa1, 0xd1, 0xff, 0x58, 0x7e, 0xb7, 0xff, 0x95, 0xa4, 0xbf, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xf6, 0xea, 0xff, 0xfc, 0xef, 0xe4, 0xff, 0xfd, 0xef, 0xe3, 0xff, 0xfc, 0xec, 0xe3, 0xff, 0xfa, 0xea, 0xe0, 0xff, 0xfa, 0xea, 0xde, 0xff, 0xf8, 0xe9, 0xdc, 0xff, 0xf8, 0xea, 0xdd, 0xff, 0xfc, 0xef, 0xe2, 0xff, 0xfa, 0xee, 0xe0, 0xe7, 0xf9, 0xea, 0xdd, 0x88, 0xf7, 0xe9, 0xda, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0x05, 0xb6, 0xaf, 0xba, 0x4a, 0xa5, 0xa4, 0xaf, 0xa0, 0x5c, 0x67, 0x87, 0xef, 0x3b, 0x51, 0x7f, 0xff, 0x69, 0x7a, 0xa7, 0xff, 0x8c, 0x9b, 0xc7, 0xff, 0x95, 0xa6, 0xcf, 0xff, 0x95, 0xa8, 0xce, 0xff, 0x99, 0xad, 0xd4, 0xff, 0x9f, 0xb1, 0xd9, 0xff, 0xa8, 0xba, 0xde, 0xff, 0xab, 0xbe, 0xe1, 0xff, 0xab, 0xbd, 0xe1, 0xff, 0xaa, 0xbc, 0xe1, 0xff, 0xa6, 0xbc, 0xdf, 0xff, 0xa4, 0xb9, 0xdf, 0xff, 0x9e, 0xb5, 0xdf, 0xff, 0x9a, 0xb2, 0xdd, 0xff, 0x94, 0xad, 0xda, 0xff, 0x8f, 0xa8, 0xd6, 0xff, 0x8a, 0xa3, 0xd1, 0xff, 0x87, 0xa1, 0xcf, 0xff, 0x82, 0x9f, 0xcc, 0xff, 0x7c, 0x98, 0xc6, 0xff, 0x7c, 0x98, 0xc8, 0xff, 0x7a, 0x98, 0xc8, 0xff, 0x75, 0x94, 0xc5, 0xff, 0x74, 0x93, 0xc4, 0xff, 0x73, 0x91, 0xc2, 0xff, 0x74, 0x94, 0xc6, 0xff, 0x70, 0x90, 0xc3, 0xff, 0x73, 0x92, 0xc6, 0xff, 0x67, 0x8b, 0xc0, 0xff, 0x42, 0x60, 0x96, 0xff, 0xd1, 0xd2, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xe7, 0xff, 0xfe, 0xf3, 0xe8, 0xff, 0xfd, 0xef, 0xe8, 0xff, 0xfc, 0xeb, 0xe1, 0xff, 0xfa, 0xea, 0xdd, 0xff, 0xf8, 0xe7, 0xdb, 0xef, 0xf8, 0xe7, 0xda, 0xa0, 0xf8, 0xe6, 0xdc, 0x4a, 0xff, 0xff, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6d, 0x91, 0x07, 0x2b, 0x4c, 0x86, 0x46, 0x2e, 0x49, 0x7f, 0x8e, 0x36, 0x50, 0x83, 0xd7, 0x51, 0x64, 0x93, 0xff, 0x72, 0x81, 0xad, 0xff, 0x8d, 0x9d, 0xc5, 0xff, 0x91, 0xa2, 0xca, 0xff, 0x95, 0xa8, 0xd1, 0xff, 0xa1, 0xb2, 0xd9, 0xff, 0xa5, 0xb6, 0xdc, 0xff, 0xa7, 0xb9, 0xdf, 0xff, 0xa7, 0xba, 0xdf, 0xff, 0xa8, 0xbb, 0xdf, 0xff, 0xa3, 0xb7, 0xde, 0xff, 0x9f, 0xb5, 0xdc, 0xff, 0x9f, 0xb5, 0xde, 0xff, 0x9b, 0xb3, 0xdd, 0xff, 0x97, 0xb0, 0xdc, 0xff, 0x97, 0xaf, 0xdc, 0xff, 0x97, 0xb0, 0xdd, 0xff, 0x91, 0xac, 0xda, 0xff, 0x8b, 0xa7, 0xd6, 0xff, 0x88, 0xa4, 0xd5, 0xff, 0x84, 0xa2, 0xd2, 0xff, 0x83, 0xa1, 0xd1, 0xff, 0x80, 0x9d, 0xcd, 0xff, 0x7c, 0x9a, 0xcb, 0xff, 0x7e, 0x9c, 0xce, 0xff, 0x7a, 0x99, 0xcc, 0xff, 0x76, 0x94, 0xc5, 0xff, 0x48, 0x6d, 0xa6, 0xff, 0x5b, 0x6d, 0x96, 0xff, 0xfd, 0xf9, 0xf5, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xfd, 0xf5, 0xe8, 0xff, 0xfd, 0xf4, 0xe8, 0xd7, 0xfd, 0xf0, 0xe5, 0x8e, 0xfb, 0xf0, 0xe1, 0x46, 0xfe, 0xfe, 0xda, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x5e, 0x97, 0x1b, 0x3c, 0x57, 0x8a, 0x55, 0x47, 0x5c, 0x8e, 0x8f, 0x5f, 0x6f, 0x9d, 0xc2, 0x7c, 0x8b, 0xb8, 0xea, 0x8c, 0x9e, 0xca, 0xff, 0x93, 0xa6, 0xcf, 0xff, 0x97, 0xaa, 0xd1, 0xff, 0x9e, 0xb1, 0xd5, 0xff, 0xa4, 0xb6, 0xdb, 0xff, 0xa1, 0xb5, 0xdc, 0xff, 0xa0, 0xb4, 0xda, 0xff, 0xa3, 0xb7, 0xdd, 0xff, 0x9c, 0xb1, 0xda, 0xff, 0x98, 0xad, 0xda, 0xff, 0x9b, 0xb1, 0xde, 0xff, 0x9b, 0xb1, 0xdf, 0xff, 0x9c, 0xb3, 0xe1, 0xff, 0x99, 0xb2, 0xe0, 0xff, 0x93, 0xad, 0xdb, 0xff, 0x9a, 0xb3, 0xe0, 0xff, 0x9a, 0xb4, 0xe0, 0xff, 0x95, 0xae, 0xde, 0xff, 0x8c, 0xa6, 0xd8, 0xff, 0x8b, 0xa7, 0xd7, 0xff, 0x87, 0xa2, 0xd3, 0xff, 0x7c, 0x99, 0xcb, 0xff, 0x76, 0x96, 0xc8, 0xea, 0x38, 0x59, 0x94, 0xc2, 0x83, 0x8e, 0xa9, 0x8f, 0xff, 0xff, 0xff, 0x55, 0xff, 0xf5, 0xec, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x78, 0xa5, 0x11, 0x73, 0x86, 0xb4, 0x37, 0x80, 0x90, 0xb9, 0x5f, 0x85, 0x9a, 0xbe, 0x86, 0x8b, 0x9f, 0xc5, 0xa8, 0x93, 0xa4, 0xcf, 0xc0, 0x97, 0xa9, 0xd1, 0xd3, 0x9d, 0xb0, 0xd3, 0xe6, 0x99, 0xad, 0xd7, 0xee, 0x96, 0xa9, 0xd5, 0xf5, 0x99, 0xab, 0xd7, 0xff, 0x9a, 0xae, 0xda, 0xff, 0x97, 0xae, 0xdc, 0xf5, 0x98, 0xae, 0xdc, 0xee, 0x9a, 0xaf, 0xdc, 0xe6, 0x99, 0xaf, 0xde, 0xd3, 0x9b, 0xb3, 0xdf, 0xc0, 0x9a, 0xb3, 0xe0, 0xa8, 0x94, 0xad, 0xda, 0x86, 0x8e, 0xa9, 0xd6, 0x5f, 0x86, 0xa2, 0xd5, 0x37, 0x87, 0xa5, 0xd2, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const lv_image_dsc_t img_multilang_avatar_16 = {
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .header.w = 128,
+    .header.h = 128,
+    .header.stride = 512,
+    .data = img_multilang_avatar_16_map,
+    .data_size = sizeof(img_multilang_avatar_16_map),
+};
+
+#endif
@@ -0,0 +1,166 @@
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+#if LV_USE_DEMO_MULTILANG
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_17
+    #define LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_17
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_17 uint8_t
+img_multilang_avatar_17_map[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xd2, 0xd2, 0x11, 0xd0, 0xd5, 0xd5, 0x37, 0xd0, 0xd3, 0xd3, 0x5e, 0xd1, 0xd3, 0xd3, 0x86, 0xd1, 0xd4, 0xd4, 0xa8, 0xd1, 0xd4, 0xd4, 0xbf, 0xd0, 0xd3, 0xd3, 0xd2, 0xd1, 0xd2, 0xd2, 0xe5, 0xd0, 0xd3, 0xd3, 0xee, 0xd0, 0xd2, 0xd2, 0xf2, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xf2, 0xd0, 0xd3, 0xd3, 0xee, 0xd1, 0xd2, 0xd2, 0xe5, 0xd0, 0xd3, 0xd3, 0xd2, 0xd1, 0xd4, 0xd4, 0xbf, 0xd1, 0xd4, 0xd4, 0xa8, 0xd1, 0xd3, 0xd3, 0x86, 0xd0, 0xd3, 0xd3, 0x5e, 0xd0, 0xd5, 0xd5, 0x37, 0xd2, 0xd2, 0xd2, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xd6, 0xd6, 0x19, 0xd2, 0xd2, 0xd2, 0x55, 0xd0, 0xd2, 0xd2, 0x8f, 0xd0, 0xd3, 0xd3, 0xc1, 0xd1, 0xd3, 0xd3, 0xe9, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xe9, 0xd0, 0xd3, 0xd3, 0xc1, 0xd0, 0xd2, 0xd2, 0x8f, 0xd2, 0xd2, 0xd2, 0x55, 0xcc, 0xd6, 0xd6, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xda, 0xda, 0x07, 0xd3, 0xd3, 0xd3, 0x46, 0xd2, 0xd3, 0xd3, 0x8e, 0xd0, 0xd3, 0xd3, 0xd7, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd4, 0xd4, 0xd7, 0xd0, 0xd2, 0xd2, 0x8e, 0xcf, 0xd3, 0xd3, 0x46, 0xda, 0xda, 0xda, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0x05, 0xd0, 0xd4, 0xd4, 0x48, 0xd0, 0xd3, 0xd3, 0x9f, 0xd1, 0xd3, 0xd3, 0xef, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xef, 0xd0, 0xd3, 0xd3, 0x9f, 0xd0, 0xd4, 0xd4, 0x48, 0xcc, 0xcc, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xd3, 0xd3, 0x23, 0xd1, 0xd3, 0xd3, 0x86, 0xd1, 0xd2, 0xd2, 0xe5, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd2, 0xd2, 0xe5, 0xd1, 0xd3, 0xd3, 0x86, 0xd3, 0xd3, 0xd3, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xd3, 0xd3, 0x41, 0xd1, 0xd3, 0xd3, 0xb4, 0xd0, 0xd2, 0xd2, 0xfe, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd7, 0xff, 0xd7, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd8, 0xff, 0xd7, 0xd8, 0xd7, 0xff, 0xd7, 0xd8, 0xd7, 0xff, 0xd6, 0xd7, 0xd6, 0xff, 0xd5, 0xd7, 0xd6, 0xff, 0xd4, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xfe, 0xd1, 0xd3, 0xd3, 0xb4, 0xcf, 0xd3, 0xd3, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xd3, 0xd3, 0x4c, 0xd0, 0xd3, 0xd3, 0xcb, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd6, 0xd6, 0xff, 0xd7, 0xd8, 0xd8, 0xff, 0xd7, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xda, 0xdb, 0xff, 0xd8, 0xda, 0xdb, 0xff, 0xdb, 0xdc, 0xd9, 0xff, 0xe0, 0xdf, 0xda, 0xff, 0xe8, 0xe2, 0xdc, 0xff, 0xec, 0xe5, 0xdd, 0xff, 0xea, 0xe5, 0xde, 0xff, 0xe9, 0xe4, 0xdf, 0xff, 0xe8, 0xe4, 0xde, 0xff, 0xe5, 0xe2, 0xdd, 0xff, 0xe7, 0xe4, 0xde, 0xff, 0xed, 0xe6, 0xe0, 0xff, 0xef, 0xe5, 0xe1, 0xff, 0xe1, 0xde, 0xd9, 0xff, 0xd7, 0xd8, 0xd7, 0xff, 0xd4, 0xd8, 0xd9, 0xff, 0xd6, 0xd7, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd3, 0xd3, 0xcb, 0xd0, 0xd3, 0xd3, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xd3, 0xd3, 0x46, 0xd1, 0xd2, 0xd2, 0xc9, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd7, 0xd8, 0xd8, 0xff, 0xdb, 0xdb, 0xda, 0xff, 0xde, 0xdd, 0xdc, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xd9, 0xdc, 0xdb, 0xff, 0xdb, 0xdd, 0xe0, 0xff, 0xde, 0xdc, 0xdb, 0xff, 0xe6, 0xe3, 0xdb, 0xff, 0xea, 0xe5, 0xe4, 0xff, 0xdb, 0xdf, 0xe1, 0xff, 0xbd, 0xd3, 0xde, 0xff, 0x9a, 0xbc, 0xd6, 0xff, 0x8c, 0xb2, 0xd1, 0xff, 0x96, 0xba, 0xd2, 0xff, 0x98, 0xba, 0xd1, 0xff, 0x88, 0xae, 0xcc, 0xff, 0x7d, 0xa5, 0xc7, 0xff, 0x83, 0xac, 0xc8, 0xff, 0x9a, 0xbb, 0xcd, 0xff, 0xd4, 0xdc, 0xde, 0xff, 0xf0, 0xeb, 0xe2, 0xff, 0xe2, 0xe0, 0xd9, 0xff, 0xd4, 0xd7, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd2, 0xd2, 0xc9, 0xcf, 0xd3, 0xd3, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xd4, 0xd4, 0x24, 0xd1, 0xd3, 0xd3, 0xb4, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xdf, 0xdf, 0xdd, 0xff, 0xe3, 0xe2, 0xe2, 0xff, 0xd8, 0xda, 0xde, 0xff, 0xd8, 0xda, 0xdb, 0xff, 0xd9, 0xdc, 0xdc, 0xff, 0xe5, 0xe2, 0xdf, 0xff, 0xf3, 0xed, 0xe1, 0xff, 0xcd, 0xdb, 0xdf, 0xff, 0x82, 0xb0, 0xd2, 0xff, 0x51, 0x91, 0xc6, 0xff, 0x3a, 0x87, 0xc1, 0xff, 0x3f, 0x8d, 0xc7, 0xff, 0x4b, 0x93, 0xcf, 0xff, 0x51, 0x94, 0xc7, 0xff, 0x4e, 0x92, 0xc4, 0xff, 0x4e, 0x8f, 0xc0, 0xff, 0x3e, 0x7f, 0xb5, 0xff, 0x2e, 0x74, 0xab, 0xff, 0x29, 0x72, 0xa8, 0xff, 0x4d, 0x89, 0xb7, 0xff, 0x97, 0xb6, 0xce, 0xff, 0xde, 0xe1, 0xdf, 0xff, 0xe9, 0xe9, 0xdb, 0xff, 0xd7, 0xd8, 0xda, 0xff, 0xd7, 0xd8, 0xd9, 0xff, 0xd6, 0xd8, 0xd7, 0xff, 0xd5, 0xd8, 0xd7, 0xff, 0xd4, 0xd7, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd3, 0xd3, 0xb5, 0xd4, 0xd4, 0xd4, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x09, 0xd1, 0xd3, 0xd3, 0x87, 0xd0, 0xd2, 0xd2, 0xf9, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd9, 0xda, 0xdb, 0xff, 0xdc, 0xe2, 0xdd, 0xff, 0xdd, 0xe1, 0xe2, 0xff, 0xb8, 0xc5, 0xd1, 0xff, 0xcd, 0xd1, 0xd6, 0xff, 0xe2, 0xe1, 0xe1, 0xff, 0xef, 0xe8, 0xe2, 0xff, 0xe6, 0xe9, 0xe7, 0xff, 0xa0, 0xbc, 0xd5, 0xff, 0x36, 0x71, 0xad, 0xff, 0x15, 0x5e, 0x9c, 0xff, 0x29, 0x6c, 0xa3, 0xff, 0x41, 0x7b, 0xb0, 0xff, 0x51, 0x89, 0xba, 0xff, 0x48, 0x82, 0xb2, 0xff, 0x32, 0x69, 0x9f, 0xff, 0x2a, 0x60, 0x97, 0xff, 0x29, 0x5b, 0x8d, 0xff, 0x2e, 0x5d, 0x88, 0xff, 0x4f, 0x7d, 0xa8, 0xff, 0x4e, 0x86, 0xb8, 0xff, 0x2a, 0x66, 0x9e, 0xff, 0x21, 0x61, 0xa1, 0xff, 0x55, 0x8f, 0xbe, 0xff, 0xc9, 0xd4, 0xdf, 0xff, 0xf2, 0xe9, 0xde, 0xff, 0xd7, 0xdb, 0xd8, 0xff, 0xd6, 0xd9, 0xdc, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd7, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xf9, 0xcf, 0xd1, 0xd1, 0x87, 0xc6, 0xc6, 0xc6, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xd3, 0xd3, 0x40, 0xd1, 0xd2, 0xd2, 0xda, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd8, 0xda, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xda, 0xda, 0xff, 0xe1, 0xdf, 0xdf, 0xff, 0xf8, 0xed, 0xeb, 0xff, 0xa9, 0xc1, 0xd1, 0xff, 0xa3, 0xbb, 0xce, 0xff, 0xe2, 0xe1, 0xe2, 0xff, 0xdf, 0xdd, 0xe0, 0xff, 0xd1, 0xdc, 0xe1, 0xff, 0x71, 0xa0, 0xc0, 0xff, 0x17, 0x52, 0x8c, 0xff, 0x24, 0x58, 0x8b, 0xff, 0x53, 0x7e, 0xa5, 0xff, 0x58, 0x86, 0xb3, 0xff, 0x56, 0x8f, 0xbd, 0xff, 0x55, 0x93, 0xc1, 0xff, 0x5a, 0x97, 0xc5, 0xff, 0x5a, 0x97, 0xc2, 0xff, 0x5e, 0x93, 0xc0, 0xff, 0x5d, 0x93, 0xbf, 0xff, 0x5a, 0x95, 0xbe, 0xff, 0x4d, 0x87, 0xb5, 0xff, 0x30, 0x68, 0x9a, 0xff, 0x22, 0x55, 0x88, 0xff, 0x24, 0x55, 0x8b, 0xff, 0x16, 0x52, 0x8c, 0xff, 0x45, 0x7e, 0xb2, 0xff, 0xc9, 0xd6, 0xdc, 0xff, 0xfc, 0xef, 0xde, 0xff, 0xe8, 0xe3, 0xdc, 0xff, 0xd9, 0xda, 0xdb, 0xff, 0xd6, 0xda, 0xdb, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd6, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd2, 0xd2, 0xda, 0xcf, 0xd3, 0xd3, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xda, 0xda, 0x07, 0xd0, 0xd2, 0xd2, 0x8e, 0xd0, 0xd2, 0xd2, 0xfe, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xdb, 0xff, 0xd6, 0xda, 0xda, 0xff, 0xe3, 0xe1, 0xdf, 0xff, 0xf1, 0xed, 0xe6, 0xff, 0xbf, 0xd1, 0xd8, 0xff, 0x65, 0x94, 0xbf, 0xff, 0x7a, 0xa0, 0xc3, 0xff, 0x81, 0xa9, 0xc2, 0xff, 0x82, 0xb0, 0xd0, 0xff, 0x75, 0xa7, 0xc8, 0xff, 0x2a, 0x5f, 0x8d, 0xff, 0x3d, 0x73, 0x9a, 0xff, 0x72, 0xa7, 0xd1, 0xff, 0x57, 0x94, 0xc2, 0xff, 0x42, 0x85, 0xbb, 0xff, 0x43, 0x89, 0xc2, 0xff, 0x54, 0x98, 0xcc, 0xff, 0x59, 0x9d, 0xcf, 0xff, 0x64, 0xa7, 0xd6, 0xff, 0x77, 0xb6, 0xe6, 0xff, 0x7b, 0xb8, 0xe9, 0xff, 0x6f, 0xae, 0xdd, 0xff, 0x58, 0x9d, 0xcd, 0xff, 0x46, 0x88, 0xbe, 0xff, 0x33, 0x68, 0xa0, 0xff, 0x26, 0x54, 0x8b, 0xff, 0x25, 0x50, 0x7a, 0xff, 0x1b, 0x50, 0x82, 0xff, 0x4a, 0x83, 0xb7, 0xff, 0xa0, 0xc5, 0xe1, 0xff, 0xc8, 0xd5, 0xdb, 0xff, 0xe9, 0xe5, 0xdd, 0xff, 0xed, 0xe4, 0xdd, 0xff, 0xe1, 0xdf, 0xdb, 0xff, 0xd7, 0xda, 0xd8, 0xff, 0xd5, 0xd9, 0xd9, 0xff, 0xd6, 0xd9, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xfe, 0xce, 0xd0, 0xd0, 0x8e, 0xda, 0xda, 0xda, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xd3, 0xd3, 0x29, 0xd0, 0xd3, 0xd3, 0xd1, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd9, 0xda, 0xdb, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe5, 0xe6, 0xe0, 0xff, 0x9e, 0xb7, 0xc5, 0xff, 0x34, 0x73, 0xa1, 0xff, 0x15, 0x49, 0x83, 0xff, 0x26, 0x5f, 0x95, 0xff, 0x37, 0x7f, 0xad, 0xff, 0x45, 0x8f, 0xc0, 0xff, 0x50, 0x8e, 0xbc, 0xff, 0x53, 0x87, 0xb0, 0xff, 0x52, 0x91, 0xbe, 0xff, 0x3d, 0x77, 0xa6, 0xff, 0x1e, 0x4e, 0x80, 0xff, 0x10, 0x42, 0x76, 0xff, 0x1a, 0x49, 0x7f, 0xff, 0x21, 0x50, 0x85, 0xff, 0x28, 0x5d, 0x91, 0xff, 0x35, 0x73, 0xa9, 0xff, 0x43, 0x86, 0xbc, 0xff, 0x51, 0x9a, 0xcf, 0xff, 0x55, 0x99, 0xd0, 0xff, 0x3a, 0x76, 0xad, 0xff, 0x27, 0x61, 0x94, 0xff, 0x24, 0x5e, 0x92, 0xff, 0x1e, 0x55, 0x89, 0xff, 0x22, 0x57, 0x86, 0xff, 0x23, 0x4d, 0x77, 0xff, 0x15, 0x41, 0x74, 0xff, 0x19, 0x63, 0xa5, 0xff, 0x68, 0xa3, 0xd2, 0xff, 0xb7, 0xce, 0xda, 0xff, 0xc9, 0xd4, 0xda, 0xff, 0xd8, 0xdc, 0xdb, 0xff, 0xe9, 0xe6, 0xde, 0xff, 0xe8, 0xde, 0xdb, 0xff, 0xd9, 0xd8, 0xd8, 0xff, 0xd2, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd3, 0xd3, 0xd1, 0xcd, 0xd3, 0xd3, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xd2, 0xd2, 0x56, 0xd0, 0xd2, 0xd2, 0xf3, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xdc, 0xdd, 0xdd, 0xff, 0xf3, 0xee, 0xe8, 0xff, 0xa1, 0xb7, 0xc9, 0xff, 0x21, 0x5d, 0x93, 0xff, 0x14, 0x4b, 0x89, 0xff, 0x04, 0x2a, 0x5c, 0xff, 0x18, 0x44, 0x74, 0xff, 0x2b, 0x52, 0x82, 0xff, 0x1a, 0x3e, 0x6d, 0xff, 0x27, 0x54, 0x86, 0xff, 0x53, 0x8d, 0xc0, 0xff, 0x22, 0x48, 0x75, 0xff, 0x00, 0x11, 0x2f, 0xff, 0x0e, 0x21, 0x41, 0xff, 0x0f, 0x22, 0x4a, 0xff, 0x0d, 0x25, 0x4e, 0xff, 0x17, 0x3a, 0x69, 0xff, 0x26, 0x57, 0x8d, 0xff, 0x33, 0x6c, 0xa0, 0xff, 0x3a, 0x7a, 0xab, 0xff, 0x3d, 0x7a, 0xaa, 0xff, 0x4e, 0x88, 0xb9, 0xff, 0x4b, 0x81, 0xb0, 0xff, 0x3f, 0x70, 0x9c, 0xff, 0x2d, 0x60, 0x8c, 0xff, 0x13, 0x40, 0x6a, 0xff, 0x24, 0x57, 0x8b, 0xff, 0x3a, 0x70, 0xa2, 0xff, 0x2d, 0x55, 0x81, 0xff, 0x1c, 0x48, 0x7a, 0xff, 0x17, 0x58, 0x99, 0xff, 0x31, 0x7b, 0xba, 0xff, 0x59, 0x99, 0xcc, 0xff, 0x78, 0xa6, 0xcf, 0xff, 0x9a, 0xbb, 0xd2, 0xff, 0xd2, 0xd6, 0xdb, 0xff, 0xed, 0xe1, 0xde, 0xff, 0xda, 0xda, 0xd8, 0xff, 0xd4, 0xd8, 0xd9, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xce, 0xd0, 0xd0, 0xf3, 0xcf, 0xcf, 0xcf, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0xd0, 0xd2, 0xd2, 0x8a, 0xd0, 0xd2, 0xd2, 0xfe, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xe2, 0xe0, 0xde, 0xff, 0xe9, 0xe9, 0xe6, 0xff, 0x6b, 0x92, 0xb2, 0xff, 0x18, 0x53, 0x8a, 0xff, 0x19, 0x42, 0x74, 0xff, 0x0c, 0x2d, 0x5a, 0xff, 0x0c, 0x2b, 0x52, 0xff, 0x0e, 0x1d, 0x39, 0xff, 0x0c, 0x15, 0x34, 0xff, 0x2b, 0x52, 0x7d, 0xff, 0x2a, 0x4f, 0x77, 0xff, 0x0a, 0x18, 0x34, 0xff, 0x13, 0x20, 0x39, 0xff, 0x0b, 0x1c, 0x33, 0xff, 0x10, 0x20, 0x43, 0xff, 0x18, 0x36, 0x5f, 0xff, 0x17, 0x43, 0x6b, 0xff, 0x28, 0x52, 0x7c, 0xff, 0x34, 0x58, 0x81, 0xff, 0x21, 0x43, 0x6c, 0xff, 0x1b, 0x3e, 0x6b, 0xff, 0x21, 0x4e, 0x7d, 0xff, 0x34, 0x6d, 0x9f, 0xff, 0x3d, 0x7d, 0xb2, 0xff, 0x44, 0x82, 0xb6, 0xff, 0x38, 0x72, 0xa4, 0xff, 0x29, 0x63, 0x93, 0xff, 0x34, 0x75, 0xa8, 0xff, 0x5d, 0x9d, 0xd3, 0xff, 0x5e, 0x96, 0xc8, 0xff, 0x2c, 0x64, 0x99, 0xff, 0x1a, 0x56, 0x92, 0xff, 0x40, 0x80, 0xba, 0xff, 0x4a, 0x95, 0xd3, 0xff, 0x44, 0x91, 0xcb, 0xff, 0x63, 0xa2, 0xd4, 0xff, 0xad, 0xc4, 0xd1, 0xff, 0xe8, 0xe3, 0xda, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd6, 0xd8, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xfe, 0xcf, 0xd1, 0xd1, 0x8b, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xd0, 0xd0, 0x0b, 0xd1, 0xd3, 0xd3, 0xae, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd8, 0xdb, 0xdb, 0xff, 0xf7, 0xf3, 0xed, 0xff, 0xb6, 0xc6, 0xd0, 0xff, 0x3d, 0x70, 0x94, 0xff, 0x3d, 0x77, 0xa4, 0xff, 0x19, 0x48, 0x78, 0xff, 0x0a, 0x29, 0x55, 0xff, 0x12, 0x29, 0x4f, 0xff, 0x08, 0x12, 0x24, 0xff, 0x11, 0x28, 0x3e, 0xff, 0x25, 0x57, 0x81, 0xff, 0x17, 0x33, 0x52, 0xff, 0x0e, 0x1b, 0x30, 0xff, 0x11, 0x28, 0x44, 0xff, 0x10, 0x2a, 0x4a, 0xff, 0x15, 0x36, 0x58, 0xff, 0x0e, 0x27, 0x45, 0xff, 0x0d, 0x1f, 0x3d, 0xff, 0x16, 0x2b, 0x4b, 0xff, 0x1e, 0x3f, 0x5e, 0xff, 0x2d, 0x59, 0x83, 0xff, 0x3f, 0x73, 0xa3, 0xff, 0x48, 0x7d, 0xb2, 0xff, 0x3c, 0x76, 0xb0, 0xff, 0x33, 0x72, 0xac, 0xff, 0x41, 0x7f, 0xb7, 0xff, 0x38, 0x7a, 0xb2, 0xff, 0x20, 0x5f, 0x99, 0xff, 0x13, 0x49, 0x81, 0xff, 0x22, 0x58, 0x8e, 0xff, 0x45, 0x7e, 0xb4, 0xff, 0x50, 0x85, 0xb8, 0xff, 0x37, 0x6c, 0x9e, 0xff, 0x2d, 0x60, 0x8c, 0xff, 0x39, 0x6e, 0x9d, 0xff, 0x3c, 0x79, 0xb6, 0xff, 0x2b, 0x74, 0xb9, 0xff, 0x3a, 0x88, 0xc8, 0xff, 0xb3, 0xcf, 0xdf, 0xff, 0xf9, 0xed, 0xdf, 0xff, 0xda, 0xd9, 0xdb, 0xff, 0xd4, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xce, 0xd0, 0xd0, 0xaf, 0xd0, 0xd0, 0xd0, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xd0, 0xd0, 0x16, 0xd1, 0xd2, 0xd2, 0xc9, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xda, 0xdd, 0xdd, 0xff, 0xe7, 0xe5, 0xe5, 0xff, 0xe7, 0xe9, 0xe9, 0xff, 0x56, 0x70, 0x86, 0xff, 0x25, 0x4c, 0x76, 0xff, 0x4a, 0x7b, 0xab, 0xff, 0x32, 0x61, 0x8e, 0xff, 0x1a, 0x3d, 0x6c, 0xff, 0x15, 0x35, 0x65, 0xff, 0x11, 0x27, 0x49, 0xff, 0x12, 0x2a, 0x47, 0xff, 0x2e, 0x54, 0x7b, 0xff, 0x1b, 0x36, 0x5c, 0xff, 0x12, 0x2f, 0x51, 0xff, 0x1e, 0x44, 0x73, 0xff, 0x1e, 0x41, 0x6d, 0xff, 0x0a, 0x21, 0x3c, 0xff, 0x07, 0x19, 0x33, 0xff, 0x15, 0x2b, 0x4d, 0xff, 0x11, 0x30, 0x5b, 0xff, 0x17, 0x44, 0x77, 0xff, 0x38, 0x73, 0xa6, 0xff, 0x5b, 0x98, 0xc3, 0xff, 0x68, 0xa4, 0xcd, 0xff, 0x59, 0x93, 0xc0, 0xff, 0x53, 0x8c, 0xbb, 0xff, 0x52, 0x90, 0xc4, 0xff, 0x43, 0x84, 0xb8, 0xff, 0x37, 0x6e, 0xa3, 0xff, 0x28, 0x57, 0x89, 0xff, 0x1d, 0x49, 0x78, 0xff, 0x1e, 0x49, 0x79, 0xff, 0x30, 0x5f, 0x92, 0xff, 0x2c, 0x5d, 0x92, 0xff, 0x10, 0x39, 0x67, 0xff, 0x27, 0x47, 0x6a, 0xff, 0x3e, 0x71, 0xa4, 0xff, 0x35, 0x6e, 0xa4, 0xff, 0x29, 0x64, 0x9d, 0xff, 0x3e, 0x7e, 0xb3, 0xff, 0xb2, 0xc8, 0xd9, 0xff, 0xee, 0xe5, 0xdd, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd2, 0xd6, 0xd6, 0xff, 0xd5, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd0, 0xd2, 0xd2, 0xc9, 0xd0, 0xd0, 0xd0, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xd7, 0xd7, 0x1a, 0xd0, 0xd2, 0xd2, 0xd6, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xda, 0xda, 0xff, 0xd9, 0xda, 0xdb, 0xff, 0xdc, 0xdd, 0xdd, 0xff, 0xe5, 0xe5, 0xe2, 0xff, 0xf2, 0xef, 0xed, 0xff, 0x75, 0x90, 0xad, 0xff, 0x0d, 0x2f, 0x55, 0xff, 0x2f, 0x4d, 0x71, 0xff, 0x36, 0x6a, 0x95, 0xff, 0x32, 0x67, 0x91, 0xff, 0x35, 0x63, 0x94, 0xff, 0x23, 0x58, 0x88, 0xff, 0x24, 0x52, 0x80, 0xff, 0x21, 0x3f, 0x68, 0xff, 0x2d, 0x53, 0x7b, 0xff, 0x22, 0x46, 0x74, 0xff, 0x38, 0x66, 0x94, 0xff, 0x37, 0x68, 0x9b, 0xff, 0x0d, 0x2e, 0x5e, 0xff, 0x09, 0x24, 0x4a, 0xff, 0x15, 0x32, 0x5d, 0xff, 0x12, 0x32, 0x5b, 0xff, 0x10, 0x2d, 0x56, 0xff, 0x13, 0x35, 0x62, 0xff, 0x19, 0x49, 0x82, 0xff, 0x31, 0x72, 0xaa, 0xff, 0x4b, 0x90, 0xc6, 0xff, 0x5f, 0xa1, 0xd3, 0xff, 0x6c, 0xab, 0xd8, 0xff, 0x6a, 0xa6, 0xd6, 0xff, 0x63, 0x9f, 0xcc, 0xff, 0x58, 0x8e, 0xb9, 0xff, 0x4e, 0x87, 0xb5, 0xff, 0x49, 0x83, 0xb5, 0xff, 0x3d, 0x73, 0xa3, 0xff, 0x34, 0x6d, 0x9a, 0xff, 0x47, 0x81, 0xaf, 0xff, 0x2b, 0x5b, 0x8b, 0xff, 0x1b, 0x41, 0x6a, 0xff, 0x2c, 0x58, 0x81, 0xff, 0x3e, 0x77, 0xa4, 0xff, 0x4e, 0x84, 0xad, 0xff, 0x1f, 0x5b, 0x8e, 0xff, 0x36, 0x7a, 0xb1, 0xff, 0xbe, 0xd1, 0xdc, 0xff, 0xf1, 0xe7, 0xdf, 0xff, 0xd9, 0xd9, 0xd6, 0xff, 0xd4, 0xd7, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd0, 0xd0, 0xd6, 0xcd, 0xcd, 0xcd, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xcf, 0xcf, 0x20, 0xd1, 0xd3, 0xd3, 0xde, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xe1, 0xe1, 0xdf, 0xff, 0xf4, 0xef, 0xeb, 0xff, 0xdd, 0xe7, 0xe8, 0xff, 0x5e, 0x85, 0xa1, 0xff, 0x2f, 0x60, 0x88, 0xff, 0x35, 0x5c, 0x80, 0xff, 0x1a, 0x3b, 0x5f, 0xff, 0x3b, 0x69, 0x96, 0xff, 0x49, 0x81, 0xaf, 0xff, 0x44, 0x7e, 0xab, 0xff, 0x38, 0x71, 0xa5, 0xff, 0x26, 0x64, 0x9a, 0xff, 0x39, 0x6b, 0x9d, 0xff, 0x45, 0x78, 0xa6, 0xff, 0x49, 0x84, 0xb9, 0xff, 0x2d, 0x69, 0xa2, 0xff, 0x1b, 0x4c, 0x89, 0xff, 0x12, 0x44, 0x7f, 0xff, 0x13, 0x39, 0x6a, 0xff, 0x17, 0x38, 0x6a, 0xff, 0x16, 0x39, 0x6a, 0xff, 0x17, 0x3e, 0x6f, 0xff, 0x1a, 0x4b, 0x7c, 0xff, 0x30, 0x63, 0x98, 0xff, 0x49, 0x85, 0xbd, 0xff, 0x6b, 0xb5, 0xeb, 0xff, 0x6f, 0xb6, 0xea, 0xff, 0x59, 0x9c, 0xd1, 0xff, 0x4e, 0x90, 0xc6, 0xff, 0x36, 0x78, 0xae, 0xff, 0x26, 0x59, 0x8d, 0xff, 0x27, 0x52, 0x82, 0xff, 0x49, 0x7d, 0xab, 0xff, 0x4f, 0x88, 0xb6, 0xff, 0x3a, 0x73, 0xa1, 0xff, 0x42, 0x7f, 0xb3, 0xff, 0x25, 0x4c, 0x76, 0xff, 0x16, 0x2d, 0x4a, 0xff, 0x2a, 0x56, 0x7a, 0xff, 0x3e, 0x75, 0xa6, 0xff, 0x49, 0x87, 0xb5, 0xff, 0x3d, 0x80, 0xae, 0xff, 0x64, 0x99, 0xc2, 0xff, 0xcc, 0xd5, 0xd9, 0xff, 0xe8, 0xe4, 0xdf, 0xff, 0xd4, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd1, 0xd1, 0xde, 0xcf, 0xcf, 0xcf, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xd1, 0xd1, 0x1c, 0xd0, 0xd1, 0xd1, 0xdb, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xdb, 0xdd, 0xdc, 0xff, 0xe0, 0xe2, 0xe1, 0xff, 0xc4, 0xce, 0xd5, 0xff, 0x8e, 0xa7, 0xbc, 0xff, 0x48, 0x6d, 0x8c, 0xff, 0x3a, 0x5f, 0x7c, 0xff, 0x49, 0x7a, 0x9c, 0xff, 0x36, 0x5d, 0x80, 0xff, 0x0f, 0x26, 0x48, 0xff, 0x26, 0x4e, 0x78, 0xff, 0x4f, 0x86, 0xb6, 0xff, 0x56, 0x8e, 0xbb, 0xff, 0x44, 0x82, 0xb5, 0xff, 0x37, 0x79, 0xb3, 0xff, 0x4f, 0x8c, 0xc0, 0xff, 0x68, 0xa3, 0xcf, 0xff, 0x5e, 0x99, 0xcc, 0xff, 0x48, 0x87, 0xc0, 0xff, 0x3d, 0x7d, 0xbf, 0xff, 0x29, 0x6a, 0xae, 0xff, 0x27, 0x61, 0xa4, 0xff, 0x1c, 0x50, 0x91, 0xff, 0x0e, 0x3e, 0x78, 0xff, 0x1e, 0x45, 0x7a, 0xff, 0x29, 0x4f, 0x7b, 0xff, 0x1c, 0x41, 0x6c, 0xff, 0x26, 0x4a, 0x75, 0xff, 0x3d, 0x64, 0x87, 0xff, 0x62, 0x95, 0xb8, 0xff, 0x68, 0xa9, 0xda, 0xff, 0x55, 0x9c, 0xd1, 0xff, 0x48, 0x8e, 0xc7, 0xff, 0x3a, 0x7e, 0xbc, 0xff, 0x21, 0x61, 0x9c, 0xff, 0x1d, 0x55, 0x8e, 0xff, 0x35, 0x6e, 0xa6, 0xff, 0x41, 0x75, 0xa6, 0xff, 0x38, 0x6a, 0x9b, 0xff, 0x34, 0x67, 0x96, 0xff, 0x17, 0x27, 0x40, 0xff, 0x16, 0x2b, 0x46, 0xff, 0x14, 0x34, 0x60, 0xff, 0x2a, 0x64, 0x94, 0xff, 0x46, 0x84, 0xaf, 0xff, 0x47, 0x7d, 0xb0, 0xff, 0x72, 0xa2, 0xc0, 0xff, 0xd6, 0xdb, 0xdb, 0xff, 0xdf, 0xdd, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd1, 0xd1, 0xdc, 0xd1, 0xd1, 0xd1, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0x15, 0xcf, 0xd0, 0xd0, 0xd6, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xde, 0xdf, 0xde, 0xff, 0xeb, 0xe8, 0xe6, 0xff, 0xaf, 0xc2, 0xd4, 0xff, 0x32, 0x60, 0x87, 0xff, 0x23, 0x48, 0x66, 0xff, 0x29, 0x42, 0x57, 0xff, 0x3e, 0x63, 0x84, 0xff, 0x3e, 0x74, 0x9f, 0xff, 0x35, 0x68, 0x98, 0xff, 0x2d, 0x62, 0x94, 0xff, 0x39, 0x6e, 0xa3, 0xff, 0x50, 0x8a, 0xbc, 0xff, 0x57, 0x92, 0xc2, 0xff, 0x5e, 0x97, 0xc9, 0xff, 0x79, 0xab, 0xd8, 0xff, 0x99, 0xc1, 0xe6, 0xff, 0x98, 0xbe, 0xe4, 0xff, 0x97, 0xbc, 0xe0, 0xff, 0x8d, 0xb8, 0xe6, 0xff, 0x85, 0xb1, 0xe0, 0xff, 0x74, 0xa4, 0xd7, 0xff, 0x58, 0x8c, 0xc5, 0xff, 0x44, 0x7a, 0xb3, 0xff, 0x41, 0x76, 0xad, 0xff, 0x34, 0x66, 0x99, 0xff, 0x2f, 0x5c, 0x8e, 0xff, 0x28, 0x4c, 0x77, 0xff, 0x00, 0x15, 0x36, 0xff, 0x17, 0x2e, 0x51, 0xff, 0x3b, 0x60, 0x87, 0xff, 0x50, 0x86, 0xb2, 0xff, 0x58, 0x98, 0xca, 0xff, 0x47, 0x8d, 0xc7, 0xff, 0x3b, 0x7a, 0xb5, 0xff, 0x1f, 0x55, 0x8a, 0xff, 0x07, 0x36, 0x6c, 0xff, 0x2a, 0x5d, 0x95, 0xff, 0x3a, 0x6d, 0x9b, 0xff, 0x46, 0x7c, 0xaf, 0xff, 0x36, 0x68, 0x97, 0xff, 0x27, 0x4c, 0x72, 0xff, 0x48, 0x77, 0x9c, 0xff, 0x51, 0x89, 0xb7, 0xff, 0x48, 0x81, 0xb3, 0xff, 0x43, 0x7e, 0xad, 0xff, 0x52, 0x8b, 0xb5, 0xff, 0xb2, 0xc5, 0xcf, 0xff, 0xe6, 0xe3, 0xde, 0xff, 0xd7, 0xd9, 0xda, 0xff, 0xd8, 0xd9, 0xda, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd0, 0xd0, 0xd7, 0xce, 0xce, 0xce, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0x0a, 0xcf, 0xd2, 0xd2, 0xc8, 0xd0, 0xd2, 0xd2, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xdc, 0xde, 0xde, 0xff, 0xdf, 0xe0, 0xdf, 0xff, 0xdb, 0xdc, 0xd8, 0xff, 0xac, 0xbd, 0xcc, 0xff, 0x49, 0x6e, 0x90, 0xff, 0x40, 0x68, 0x88, 0xff, 0x40, 0x6a, 0x8c, 0xff, 0x5c, 0x91, 0xb5, 0xff, 0x4c, 0x8f, 0xbd, 0xff, 0x2e, 0x6b, 0xa6, 0xff, 0x27, 0x5e, 0x9a, 0xff, 0x3b, 0x76, 0xab, 0xff, 0x58, 0x8f, 0xc1, 0xff, 0x7a, 0xa9, 0xd6, 0xff, 0x92, 0xb7, 0xe0, 0xff, 0xab, 0xc6, 0xea, 0xff, 0xbc, 0xd0, 0xf1, 0xff, 0xc1, 0xd3, 0xf1, 0xff, 0xcb, 0xd9, 0xef, 0xff, 0xcd, 0xdb, 0xf2, 0xff, 0xd1, 0xdf, 0xf5, 0xff, 0xc5, 0xd8, 0xf3, 0xff, 0xb1, 0xcc, 0xef, 0xff, 0xa4, 0xc2, 0xea, 0xff, 0x93, 0xb5, 0xe0, 0xff, 0x89, 0xb0, 0xd7, 0xff, 0x87, 0xac, 0xd5, 0xff, 0x71, 0x97, 0xc2, 0xff, 0x61, 0x89, 0xb7, 0xff, 0x48, 0x6f, 0xa0, 0xff, 0x20, 0x46, 0x74, 0xff, 0x1e, 0x45, 0x71, 0xff, 0x2a, 0x5c, 0x82, 0xff, 0x1f, 0x56, 0x80, 0xff, 0x2c, 0x62, 0x97, 0xff, 0x38, 0x70, 0xa9, 0xff, 0x24, 0x59, 0x90, 0xff, 0x10, 0x43, 0x7e, 0xff, 0x1b, 0x4e, 0x86, 0xff, 0x34, 0x67, 0x91, 0xff, 0x4b, 0x7c, 0xa9, 0xff, 0x33, 0x5f, 0x90, 0xff, 0x39, 0x77, 0x9f, 0xff, 0x5e, 0x98, 0xc3, 0xff, 0x61, 0x98, 0xc6, 0xff, 0x57, 0x92, 0xbf, 0xff, 0x94, 0xb3, 0xcc, 0xff, 0xbb, 0xc9, 0xd1, 0xff, 0xdb, 0xdc, 0xdc, 0xff, 0xd9, 0xd9, 0xd7, 0xff, 0xd6, 0xd9, 0xd8, 0xff, 0xd6, 0xd7, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd1, 0xd1, 0xc8, 0xcc, 0xcc, 0xcc, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0xcf, 0xd0, 0xd0, 0xb1, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xdc, 0xde, 0xde, 0xff, 0xe0, 0xe1, 0xdf, 0xff, 0xda, 0xdb, 0xde, 0xff, 0xa0, 0xb5, 0xc5, 0xff, 0x5b, 0x83, 0x9f, 0xff, 0x3e, 0x6a, 0x8d, 0xff, 0x5b, 0x91, 0xb8, 0xff, 0x59, 0x95, 0xc9, 0xff, 0x29, 0x66, 0x9f, 0xff, 0x1b, 0x56, 0x8f, 0xff, 0x35, 0x6a, 0xa1, 0xff, 0x5a, 0x90, 0xc0, 0xff, 0x80, 0xae, 0xd9, 0xff, 0x97, 0xbb, 0xe4, 0xff, 0xad, 0xc7, 0xec, 0xff, 0xb7, 0xce, 0xee, 0xff, 0xba, 0xce, 0xed, 0xff, 0xc6, 0xd4, 0xf1, 0xff, 0xcc, 0xd8, 0xf0, 0xff, 0xca, 0xd6, 0xee, 0xff, 0xcc, 0xd9, 0xf3, 0xff, 0xcd, 0xdb, 0xf2, 0xff, 0xcd, 0xda, 0xed, 0xff, 0xcd, 0xdb, 0xef, 0xff, 0xcc, 0xdb, 0xf2, 0xff, 0xce, 0xdd, 0xf4, 0xff, 0xcb, 0xd9, 0xf4, 0xff, 0xc3, 0xd5, 0xf0, 0xff, 0xb9, 0xd3, 0xee, 0xff, 0x9e, 0xbf, 0xe5, 0xff, 0x79, 0xa3, 0xd4, 0xff, 0x5d, 0x8d, 0xbd, 0xff, 0x43, 0x6e, 0x9d, 0xff, 0x22, 0x41, 0x66, 0xff, 0x09, 0x21, 0x40, 0xff, 0x10, 0x2c, 0x52, 0xff, 0x26, 0x53, 0x84, 0xff, 0x24, 0x5a, 0x8c, 0xff, 0x17, 0x3a, 0x75, 0xff, 0x0d, 0x31, 0x63, 0xff, 0x34, 0x66, 0x95, 0xff, 0x47, 0x7b, 0xa7, 0xff, 0x17, 0x43, 0x70, 0xff, 0x22, 0x54, 0x85, 0xff, 0x33, 0x72, 0xa3, 0xff, 0x43, 0x84, 0xb7, 0xff, 0x90, 0xb3, 0xcb, 0xff, 0xbf, 0xcf, 0xd4, 0xff, 0xd4, 0xd4, 0xd6, 0xff, 0xdf, 0xdd, 0xd9, 0xff, 0xd4, 0xd8, 0xd6, 0xff, 0xd7, 0xd8, 0xd9, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd0, 0xd0, 0xb1, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xd1, 0xd1, 0x8d, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xdc, 0xde, 0xde, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xdc, 0xdd, 0xdc, 0xff, 0xe3, 0xe2, 0xe2, 0xff, 0xaf, 0xc1, 0xce, 0xff, 0x51, 0x76, 0x92, 0xff, 0x51, 0x7c, 0x9f, 0xff, 0x5c, 0x9a, 0xca, 0xff, 0x2f, 0x6f, 0xad, 0xff, 0x24, 0x5d, 0x96, 0xff, 0x3e, 0x78, 0xab, 0xff, 0x5c, 0x92, 0xc4, 0xff, 0x7b, 0xa6, 0xd4, 0xff, 0x97, 0xbc, 0xe4, 0xff, 0xa8, 0xc6, 0xea, 0xff, 0xb2, 0xc9, 0xed, 0xff, 0xb9, 0xcc, 0xee, 0xff, 0xbd, 0xcf, 0xed, 0xff, 0xc2, 0xd3, 0xf0, 0xff, 0xc9, 0xd6, 0xef, 0xff, 0xc7, 0xd5, 0xee, 0xff, 0xc7, 0xd7, 0xf1, 0xff, 0xcb, 0xd9, 0xf1, 0xff, 0xcc, 0xda, 0xef, 0xff, 0xcc, 0xd9, 0xf0, 0xff, 0xcd, 0xd9, 0xf1, 0xff, 0xcf, 0xdb, 0xf3, 0xff, 0xd1, 0xda, 0xf3, 0xff, 0xd0, 0xdb, 0xf3, 0xff, 0xcd, 0xdb, 0xf2, 0xff, 0xc9, 0xd8, 0xf1, 0xff, 0xba, 0xd0, 0xf1, 0xff, 0xa1, 0xc1, 0xe9, 0xff, 0x8c, 0xb1, 0xe0, 0xff, 0x6f, 0x9c, 0xd0, 0xff, 0x42, 0x6c, 0x99, 0xff, 0x13, 0x34, 0x53, 0xff, 0x0e, 0x23, 0x40, 0xff, 0x21, 0x43, 0x6c, 0xff, 0x18, 0x40, 0x6c, 0xff, 0x07, 0x16, 0x3c, 0xff, 0x17, 0x3f, 0x6d, 0xff, 0x3c, 0x6e, 0x9f, 0xff, 0x25, 0x48, 0x72, 0xff, 0x1c, 0x41, 0x70, 0xff, 0x27, 0x60, 0x8f, 0xff, 0x3d, 0x7e, 0xad, 0xff, 0x55, 0x8c, 0xbe, 0xff, 0xb0, 0xc4, 0xd2, 0xff, 0xdf, 0xdc, 0xda, 0xff, 0xdd, 0xdc, 0xd9, 0xff, 0xd5, 0xd9, 0xd7, 0xff, 0xd6, 0xd8, 0xd9, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd1, 0xd1, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xd2, 0xd2, 0x55, 0xd0, 0xd2, 0xd2, 0xfe, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xdc, 0xde, 0xde, 0xff, 0xdc, 0xde, 0xdf, 0xff, 0xdd, 0xdf, 0xdf, 0xff, 0xe7, 0xe7, 0xe5, 0xff, 0xa3, 0xb6, 0xc2, 0xff, 0x44, 0x67, 0x86, 0xff, 0x60, 0x8d, 0xb3, 0xff, 0x48, 0x8a, 0xc1, 0xff, 0x24, 0x62, 0x9e, 0xff, 0x34, 0x70, 0xa3, 0xff, 0x5d, 0x92, 0xc3, 0xff, 0x74, 0xa3, 0xd2, 0xff, 0x8b, 0xb0, 0xdc, 0xff, 0xa2, 0xbf, 0xe4, 0xff, 0xad, 0xc8, 0xe9, 0xff, 0xb5, 0xcb, 0xea, 0xff, 0xbe, 0xcf, 0xea, 0xff, 0xc6, 0xd4, 0xec, 0xff, 0xca, 0xd7, 0xef, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcc, 0xd9, 0xf1, 0xff, 0xca, 0xd8, 0xf1, 0xff, 0xca, 0xd7, 0xf0, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcd, 0xda, 0xf3, 0xff, 0xcd, 0xda, 0xf2, 0xff, 0xcc, 0xd8, 0xf1, 0xff, 0xcb, 0xd8, 0xf1, 0xff, 0xcb, 0xd9, 0xf1, 0xff, 0xcc, 0xd9, 0xf2, 0xff, 0xc0, 0xd3, 0xf3, 0xff, 0xab, 0xc8, 0xec, 0xff, 0x99, 0xbd, 0xe7, 0xff, 0x82, 0xb0, 0xe0, 0xff, 0x4e, 0x83, 0xb8, 0xff, 0x21, 0x45, 0x6f, 0xff, 0x10, 0x29, 0x48, 0xff, 0x18, 0x39, 0x5c, 0xff, 0x0d, 0x17, 0x2d, 0xff, 0x00, 0x0f, 0x2c, 0xff, 0x2d, 0x65, 0x9b, 0xff, 0x35, 0x6e, 0x97, 0xff, 0x2f, 0x5b, 0x86, 0xff, 0x33, 0x65, 0x95, 0xff, 0x35, 0x72, 0xa0, 0xff, 0x39, 0x7c, 0xb0, 0xff, 0x9e, 0xb7, 0xcf, 0xff, 0xe7, 0xe4, 0xe2, 0xff, 0xdb, 0xda, 0xda, 0xff, 0xd9, 0xda, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xfe, 0xcf, 0xcf, 0xcf, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xd3, 0xd3, 0x29, 0xcf, 0xd1, 0xd1, 0xf3, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xdc, 0xde, 0xde, 0xff, 0xdb, 0xde, 0xdf, 0xff, 0xe4, 0xe2, 0xe0, 0xff, 0xd3, 0xda, 0xde, 0xff, 0x60, 0x88, 0xa5, 0xff, 0x44, 0x6f, 0x8c, 0xff, 0x58, 0x8b, 0xad, 0xff, 0x27, 0x64, 0x9c, 0xff, 0x1d, 0x55, 0x8e, 0xff, 0x42, 0x7d, 0xad, 0xff, 0x6f, 0x9e, 0xcb, 0xff, 0x8a, 0xaf, 0xda, 0xff, 0x9a, 0xb8, 0xe0, 0xff, 0xa6, 0xbe, 0xe5, 0xff, 0xb0, 0xc6, 0xe8, 0xff, 0xb6, 0xcb, 0xeb, 0xff, 0xc0, 0xd3, 0xed, 0xff, 0xc6, 0xd5, 0xec, 0xff, 0xcd, 0xd9, 0xf0, 0xff, 0xcd, 0xda, 0xf2, 0xff, 0xcd, 0xda, 0xf2, 0xff, 0xcd, 0xda, 0xf2, 0xff, 0xce, 0xdb, 0xf3, 0xff, 0xce, 0xda, 0xf2, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcd, 0xda, 0xf2, 0xff, 0xce, 0xdb, 0xf3, 0xff, 0xcd, 0xda, 0xf1, 0xff, 0xcb, 0xd8, 0xf1, 0xff, 0xc8, 0xd7, 0xf2, 0xff, 0xc9, 0xd7, 0xf0, 0xff, 0xc9, 0xd8, 0xf1, 0xff, 0xbd, 0xd5, 0xef, 0xff, 0xb1, 0xcd, 0xed, 0xff, 0x9f, 0xc1, 0xe6, 0xff, 0x83, 0xb1, 0xda, 0xff, 0x48, 0x7d, 0xb2, 0xff, 0x1e, 0x40, 0x72, 0xff, 0x13, 0x26, 0x43, 0xff, 0x19, 0x2c, 0x4a, 0xff, 0x03, 0x0b, 0x21, 0xff, 0x19, 0x3f, 0x6d, 0xff, 0x39, 0x75, 0xaf, 0xff, 0x3f, 0x6f, 0x9e, 0xff, 0x41, 0x75, 0xa5, 0xff, 0x3f, 0x77, 0xa8, 0xff, 0x30, 0x73, 0xa9, 0xff, 0x89, 0xab, 0xc5, 0xff, 0xe5, 0xe2, 0xe0, 0xff, 0xdd, 0xdc, 0xdc, 0xff, 0xd9, 0xd9, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcd, 0xcf, 0xcf, 0xf4, 0xce, 0xce, 0xce, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xda, 0xda, 0x07, 0xcf, 0xd0, 0xd0, 0xd1, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xdb, 0xdd, 0xdc, 0xff, 0xdc, 0xde, 0xdf, 0xff, 0xde, 0xde, 0xdf, 0xff, 0xec, 0xe8, 0xe5, 0xff, 0x93, 0xaf, 0xbd, 0xff, 0x33, 0x5f, 0x84, 0xff, 0x54, 0x7d, 0xa0, 0xff, 0x58, 0x8a, 0xb1, 0xff, 0x1c, 0x4f, 0x84, 0xff, 0x17, 0x4b, 0x7e, 0xff, 0x57, 0x8c, 0xbb, 0xff, 0x7c, 0xa3, 0xd1, 0xff, 0x90, 0xb3, 0xdb, 0xff, 0x9f, 0xbd, 0xe1, 0xff, 0xab, 0xc1, 0xe6, 0xff, 0xb2, 0xc4, 0xe6, 0xff, 0xb7, 0xcb, 0xe8, 0xff, 0xc2, 0xd5, 0xec, 0xff, 0xc9, 0xd7, 0xed, 0xff, 0xca, 0xd7, 0xf1, 0xff, 0xcb, 0xd8, 0xf2, 0xff, 0xcc, 0xd9, 0xf1, 0xff, 0xcd, 0xda, 0xf2, 0xff, 0xce, 0xdb, 0xf3, 0xff, 0xce, 0xdb, 0xf3, 0xff, 0xcd, 0xda, 0xf2, 0xff, 0xcd, 0xda, 0xf2, 0xff, 0xcd, 0xda, 0xf2, 0xff, 0xce, 0xdb, 0xf3, 0xff, 0xce, 0xda, 0xf2, 0xff, 0xcc, 0xd9, 0xf2, 0xff, 0xcb, 0xd8, 0xf3, 0xff, 0xca, 0xd7, 0xf1, 0xff, 0xc8, 0xd6, 0xee, 0xff, 0xc1, 0xd3, 0xee, 0xff, 0xb7, 0xd0, 0xee, 0xff, 0xac, 0xc9, 0xea, 0xff, 0xa0, 0xc2, 0xe5, 0xff, 0x7e, 0xab, 0xd8, 0xff, 0x3b, 0x6e, 0xa7, 0xff, 0x0e, 0x32, 0x5b, 0xff, 0x15, 0x2f, 0x53, 0xff, 0x0e, 0x19, 0x38, 0xff, 0x13, 0x31, 0x54, 0xff, 0x3a, 0x7a, 0xb0, 0xff, 0x49, 0x82, 0xb5, 0xff, 0x58, 0x8a, 0xb4, 0xff, 0x4f, 0x87, 0xb6, 0xff, 0x54, 0x8f, 0xb8, 0xff, 0x9b, 0xb8, 0xc7, 0xff, 0xe0, 0xde, 0xdb, 0xff, 0xdc, 0xdd, 0xdc, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd0, 0xd0, 0xd1, 0xda, 0xda, 0xda, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xd0, 0xd0, 0x8e, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xde, 0xff, 0xe3, 0xe1, 0xe2, 0xff, 0xe3, 0xe1, 0xe6, 0xff, 0x5a, 0x80, 0x9f, 0xff, 0x2f, 0x5a, 0x83, 0xff, 0x62, 0x8b, 0xaf, 0xff, 0x59, 0x86, 0xad, 0xff, 0x1e, 0x4b, 0x7a, 0xff, 0x1e, 0x4c, 0x7e, 0xff, 0x65, 0x92, 0xc4, 0xff, 0x85, 0xa7, 0xd8, 0xff, 0x96, 0xb7, 0xdf, 0xff, 0x9e, 0xbd, 0xe1, 0xff, 0xa9, 0xc0, 0xe4, 0xff, 0xaf, 0xc4, 0xe3, 0xff, 0xb6, 0xc8, 0xe5, 0xff, 0xc0, 0xce, 0xe8, 0xff, 0xc8, 0xd5, 0xed, 0xff, 0xc8, 0xd5, 0xef, 0xff, 0xc9, 0xd6, 0xf0, 0xff, 0xca, 0xd7, 0xef, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcc, 0xd9, 0xf1, 0xff, 0xcd, 0xda, 0xf2, 0xff, 0xcc, 0xd9, 0xf1, 0xff, 0xcc, 0xd9, 0xf1, 0xff, 0xcc, 0xd9, 0xf1, 0xff, 0xcd, 0xda, 0xf2, 0xff, 0xcc, 0xda, 0xf1, 0xff, 0xcb, 0xd8, 0xf1, 0xff, 0xcb, 0xd7, 0xf2, 0xff, 0xca, 0xd6, 0xf0, 0xff, 0xc6, 0xd5, 0xf0, 0xff, 0xbe, 0xcf, 0xef, 0xff, 0xb7, 0xcc, 0xed, 0xff, 0xb0, 0xc8, 0xeb, 0xff, 0xa3, 0xbc, 0xe5, 0xff, 0x9d, 0xbc, 0xe7, 0xff, 0x7d, 0xa9, 0xd8, 0xff, 0x27, 0x57, 0x85, 0xff, 0x0f, 0x2d, 0x4f, 0xff, 0x14, 0x2f, 0x55, 0xff, 0x23, 0x46, 0x6e, 0xff, 0x3d, 0x73, 0xa0, 0xff, 0x2b, 0x66, 0x98, 0xff, 0x55, 0x8a, 0xb5, 0xff, 0x8a, 0xaf, 0xc8, 0xff, 0xac, 0xc2, 0xcf, 0xff, 0xcd, 0xd4, 0xd5, 0xff, 0xdb, 0xdb, 0xd9, 0xff, 0xd9, 0xdc, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xcf, 0xcf, 0x40, 0xce, 0xd0, 0xd0, 0xfe, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xdb, 0xde, 0xde, 0xff, 0xdc, 0xdc, 0xdd, 0xff, 0xe5, 0xe1, 0xe0, 0xff, 0xcf, 0xd5, 0xe0, 0xff, 0x48, 0x70, 0x99, 0xff, 0x47, 0x76, 0xa1, 0xff, 0x5d, 0x88, 0xa7, 0xff, 0x3c, 0x64, 0x87, 0xff, 0x1d, 0x48, 0x74, 0xff, 0x2c, 0x58, 0x88, 0xff, 0x61, 0x8e, 0xbe, 0xff, 0x8d, 0xad, 0xdb, 0xff, 0xa0, 0xba, 0xe0, 0xff, 0xa5, 0xbd, 0xe2, 0xff, 0xaa, 0xc0, 0xe4, 0xff, 0xae, 0xc1, 0xe2, 0xff, 0xb0, 0xc1, 0xe4, 0xff, 0xb6, 0xc6, 0xe7, 0xff, 0xc1, 0xce, 0xea, 0xff, 0xc6, 0xd3, 0xed, 0xff, 0xc7, 0xd5, 0xef, 0xff, 0xc8, 0xd5, 0xee, 0xff, 0xc9, 0xd6, 0xef, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcb, 0xd8, 0xf1, 0xff, 0xca, 0xd7, 0xf0, 0xff, 0xc9, 0xd6, 0xef, 0xff, 0xc9, 0xd6, 0xf0, 0xff, 0xc8, 0xd5, 0xee, 0xff, 0xc5, 0xd3, 0xee, 0xff, 0xbc, 0xce, 0xed, 0xff, 0xb6, 0xca, 0xeb, 0xff, 0xb4, 0xc9, 0xec, 0xff, 0xaa, 0xc2, 0xe8, 0xff, 0x9d, 0xb8, 0xde, 0xff, 0x9d, 0xbf, 0xe9, 0xff, 0x66, 0x93, 0xc2, 0xff, 0x0f, 0x35, 0x5f, 0xff, 0x10, 0x37, 0x61, 0xff, 0x30, 0x5b, 0x89, 0xff, 0x39, 0x68, 0x95, 0xff, 0x23, 0x5c, 0x89, 0xff, 0x34, 0x6b, 0x99, 0xff, 0xb2, 0xc9, 0xd9, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xfe, 0xcf, 0xcf, 0xcf, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x09, 0xcf, 0xd0, 0xd0, 0xdb, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xdb, 0xdd, 0xde, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xe7, 0xe7, 0xe4, 0xff, 0x9a, 0xb4, 0xc1, 0xff, 0x3f, 0x70, 0x9c, 0xff, 0x51, 0x7c, 0xa4, 0xff, 0x39, 0x60, 0x83, 0xff, 0x2e, 0x54, 0x7c, 0xff, 0x29, 0x54, 0x7e, 0xff, 0x42, 0x70, 0x9b, 0xff, 0x61, 0x8d, 0xb8, 0xff, 0x88, 0xab, 0xd4, 0xff, 0x9e, 0xb8, 0xdd, 0xff, 0xa3, 0xba, 0xe0, 0xff, 0xa8, 0xbf, 0xe3, 0xff, 0xaf, 0xc1, 0xe7, 0xff, 0xac, 0xc0, 0xe5, 0xff, 0xb0, 0xc5, 0xe6, 0xff, 0xbc, 0xcb, 0xe7, 0xff, 0xc3, 0xd0, 0xed, 0xff, 0xc6, 0xd4, 0xf0, 0xff, 0xc7, 0xd4, 0xee, 0xff, 0xc8, 0xd5, 0xef, 0xff, 0xca, 0xd7, 0xf0, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcb, 0xd8, 0xf1, 0xff, 0xc9, 0xd6, 0xf1, 0xff, 0xc8, 0xd5, 0xef, 0xff, 0xc8, 0xd5, 0xef, 0xff, 0xc7, 0xd4, 0xee, 0xff, 0xc5, 0xd3, 0xee, 0xff, 0xbc, 0xce, 0xed, 0xff, 0xb6, 0xca, 0xec, 0xff, 0xb1, 0xc7, 0xeb, 0xff, 0xac, 0xc8, 0xe9, 0xff, 0x9e, 0xbd, 0xdf, 0xff, 0x93, 0xb4, 0xdb, 0xff, 0x8f, 0xb4, 0xdf, 0xff, 0x48, 0x6f, 0x9c, 0xff, 0x0b, 0x31, 0x5e, 0xff, 0x2d, 0x5e, 0x8a, 0xff, 0x4d, 0x82, 0xae, 0xff, 0x43, 0x78, 0xa1, 0xff, 0x34, 0x68, 0x92, 0xff, 0x91, 0xb0, 0xc8, 0xff, 0xdb, 0xde, 0xda, 0xff, 0xdd, 0xde, 0xdc, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xdb, 0xc6, 0xc6, 0xc6, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xd0, 0xd0, 0x88, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xda, 0xdc, 0xdd, 0xff, 0xd9, 0xda, 0xdc, 0xff, 0xda, 0xda, 0xdb, 0xff, 0xeb, 0xe7, 0xe3, 0xff, 0x85, 0xa3, 0xb9, 0xff, 0x40, 0x75, 0xa6, 0xff, 0x49, 0x73, 0x98, 0xff, 0x3f, 0x66, 0x88, 0xff, 0x3c, 0x64, 0x8b, 0xff, 0x3b, 0x66, 0x91, 0xff, 0x58, 0x82, 0xae, 0xff, 0x6e, 0x92, 0xbe, 0xff, 0x7f, 0xa2, 0xcd, 0xff, 0x8f, 0xb0, 0xdb, 0xff, 0x9b, 0xb6, 0xe1, 0xff, 0xa1, 0xbe, 0xe1, 0xff, 0xab, 0xc4, 0xe7, 0xff, 0xae, 0xc3, 0xe7, 0xff, 0xb4, 0xc8, 0xe8, 0xff, 0xbe, 0xce, 0xea, 0xff, 0xc4, 0xd1, 0xed, 0xff, 0xc6, 0xd4, 0xf0, 0xff, 0xc7, 0xd4, 0xee, 0xff, 0xc8, 0xd5, 0xef, 0xff, 0xca, 0xd7, 0xf0, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcb, 0xd8, 0xf1, 0xff, 0xca, 0xd7, 0xf1, 0xff, 0xc8, 0xd5, 0xef, 0xff, 0xc6, 0xd3, 0xed, 0xff, 0xc6, 0xd3, 0xec, 0xff, 0xc4, 0xd3, 0xee, 0xff, 0xbc, 0xcf, 0xed, 0xff, 0xb6, 0xca, 0xec, 0xff, 0xb1, 0xc7, 0xea, 0xff, 0xaa, 0xc6, 0xe7, 0xff, 0xa4, 0xc3, 0xe5, 0xff, 0x90, 0xb2, 0xda, 0xff, 0x96, 0xb8, 0xd9, 0xff, 0x87, 0xaf, 0xd2, 0xff, 0x34, 0x63, 0x96, 0xff, 0x18, 0x4d, 0x81, 0xff, 0x68, 0x98, 0xbf, 0xff, 0x74, 0x9e, 0xc4, 0xff, 0x53, 0x86, 0xab, 0xff, 0x89, 0xa9, 0xbf, 0xff, 0xdd, 0xe0, 0xde, 0xff, 0xdc, 0xdd, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xd0, 0xd0, 0x26, 0xcf, 0xd1, 0xd1, 0xfa, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xda, 0xdb, 0xdd, 0xff, 0xe6, 0xe1, 0xde, 0xff, 0x7e, 0x9d, 0xb8, 0xff, 0x32, 0x67, 0x95, 0xff, 0x41, 0x6b, 0x8e, 0xff, 0x46, 0x6f, 0x92, 0xff, 0x43, 0x6f, 0x98, 0xff, 0x51, 0x7e, 0xa7, 0xff, 0x6a, 0x91, 0xbb, 0xff, 0x72, 0x95, 0xc0, 0xff, 0x7a, 0x9e, 0xc9, 0xff, 0x8c, 0xac, 0xd9, 0xff, 0x9a, 0xb5, 0xe1, 0xff, 0xa2, 0xbc, 0xe3, 0xff, 0xac, 0xc3, 0xe4, 0xff, 0xb1, 0xc5, 0xe6, 0xff, 0xb4, 0xc8, 0xea, 0xff, 0xbd, 0xce, 0xf0, 0xff, 0xc5, 0xd1, 0xf1, 0xff, 0xc6, 0xd5, 0xf0, 0xff, 0xc8, 0xd6, 0xef, 0xff, 0xc9, 0xd6, 0xf0, 0xff, 0xcb, 0xd8, 0xf1, 0xff, 0xcc, 0xd9, 0xf1, 0xff, 0xcc, 0xd9, 0xf1, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcb, 0xd8, 0xf1, 0xff, 0xca, 0xd7, 0xf1, 0xff, 0xc7, 0xd4, 0xef, 0xff, 0xc5, 0xd3, 0xef, 0xff, 0xc5, 0xd3, 0xef, 0xff, 0xc0, 0xd1, 0xee, 0xff, 0xbc, 0xce, 0xeb, 0xff, 0xb7, 0xcb, 0xeb, 0xff, 0xb3, 0xc9, 0xed, 0xff, 0xaf, 0xc6, 0xe9, 0xff, 0xa6, 0xc3, 0xe6, 0xff, 0x9d, 0xba, 0xdd, 0xff, 0x9b, 0xb8, 0xda, 0xff, 0x9a, 0xba, 0xdd, 0xff, 0x6c, 0x96, 0xc1, 0xff, 0x3c, 0x6c, 0x9a, 0xff, 0x64, 0x93, 0xb6, 0xff, 0x7b, 0xac, 0xcc, 0xff, 0x62, 0x96, 0xbc, 0xff, 0xa9, 0xc0, 0xd2, 0xff, 0xe7, 0xe5, 0xe0, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd8, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xfa, 0xd0, 0xd0, 0xd0, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xcf, 0xcf, 0xb3, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xd6, 0xd9, 0xda, 0xff, 0x58, 0x81, 0xa4, 0xff, 0x37, 0x6b, 0x96, 0xff, 0x4b, 0x75, 0x98, 0xff, 0x49, 0x70, 0x93, 0xff, 0x43, 0x6c, 0x97, 0xff, 0x5a, 0x83, 0xad, 0xff, 0x79, 0x9a, 0xc6, 0xff, 0x79, 0x97, 0xc4, 0xff, 0x7e, 0xa1, 0xcb, 0xff, 0x90, 0xb1, 0xdd, 0xff, 0x9e, 0xb9, 0xe7, 0xff, 0xa6, 0xbf, 0xe8, 0xff, 0xb1, 0xc7, 0xe8, 0xff, 0xb6, 0xc9, 0xea, 0xff, 0xb5, 0xc9, 0xee, 0xff, 0xbc, 0xcd, 0xf2, 0xff, 0xc5, 0xd1, 0xf2, 0xff, 0xc6, 0xd5, 0xf0, 0xff, 0xc9, 0xd6, 0xf0, 0xff, 0xca, 0xd7, 0xf1, 0xff, 0xcc, 0xd9, 0xf2, 0xff, 0xcd, 0xda, 0xf1, 0xff, 0xcc, 0xd9, 0xf1, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcb, 0xd8, 0xf1, 0xff, 0xca, 0xd6, 0xf1, 0xff, 0xc7, 0xd5, 0xef, 0xff, 0xc6, 0xd4, 0xf0, 0xff, 0xc6, 0xd4, 0xf1, 0xff, 0xc0, 0xd3, 0xf1, 0xff, 0xbe, 0xd0, 0xec, 0xff, 0xb9, 0xce, 0xed, 0xff, 0xb5, 0xcb, 0xf0, 0xff, 0xb3, 0xc9, 0xed, 0xff, 0xab, 0xc6, 0xea, 0xff, 0xa2, 0xbd, 0xdf, 0xff, 0x9d, 0xb8, 0xdd, 0xff, 0x9b, 0xba, 0xdf, 0xff, 0x78, 0x9e, 0xc1, 0xff, 0x6d, 0x96, 0xb9, 0xff, 0x7c, 0xa6, 0xc3, 0xff, 0x7b, 0xaa, 0xc9, 0xff, 0x5e, 0x97, 0xbd, 0xff, 0xac, 0xc3, 0xd1, 0xff, 0xe6, 0xe1, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd8, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcd, 0xd0, 0xd0, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xd2, 0xd2, 0x44, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xda, 0xff, 0xe0, 0xde, 0xdc, 0xff, 0xcc, 0xd3, 0xd9, 0xff, 0x4e, 0x7c, 0xa2, 0xff, 0x4a, 0x78, 0xa0, 0xff, 0x53, 0x7f, 0x9f, 0xff, 0x3e, 0x69, 0x8c, 0xff, 0x33, 0x58, 0x84, 0xff, 0x61, 0x86, 0xb2, 0xff, 0x82, 0xa1, 0xcb, 0xff, 0x84, 0x9f, 0xc9, 0xff, 0x88, 0xa8, 0xd3, 0xff, 0x94, 0xb5, 0xe1, 0xff, 0xa2, 0xbe, 0xe7, 0xff, 0xab, 0xc5, 0xeb, 0xff, 0xb7, 0xca, 0xef, 0xff, 0xbb, 0xcc, 0xed, 0xff, 0xbc, 0xd0, 0xf0, 0xff, 0xc0, 0xd0, 0xf1, 0xff, 0xc6, 0xd1, 0xef, 0xff, 0xc8, 0xd5, 0xf1, 0xff, 0xc9, 0xd6, 0xf0, 0xff, 0xca, 0xd7, 0xf1, 0xff, 0xcb, 0xd8, 0xf1, 0xff, 0xcc, 0xd9, 0xf0, 0xff, 0xcc, 0xd9, 0xf1, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcc, 0xd9, 0xf1, 0xff, 0xcc, 0xd9, 0xf2, 0xff, 0xc9, 0xd6, 0xf0, 0xff, 0xc9, 0xd5, 0xf1, 0xff, 0xc9, 0xd5, 0xf3, 0xff, 0xc8, 0xd5, 0xf2, 0xff, 0xc6, 0xd5, 0xf2, 0xff, 0xc4, 0xd3, 0xf1, 0xff, 0xc0, 0xd2, 0xf3, 0xff, 0xb8, 0xce, 0xf1, 0xff, 0xb2, 0xcd, 0xee, 0xff, 0xad, 0xc8, 0xeb, 0xff, 0xa0, 0xbe, 0xe3, 0xff, 0x9e, 0xbb, 0xe1, 0xff, 0x9c, 0xbb, 0xde, 0xff, 0x6e, 0x96, 0xbc, 0xff, 0x51, 0x80, 0xa7, 0xff, 0x63, 0x8f, 0xb0, 0xff, 0x80, 0xa6, 0xc8, 0xff, 0x59, 0x93, 0xbc, 0xff, 0x92, 0xb3, 0xc8, 0xff, 0xe7, 0xe2, 0xde, 0xff, 0xdb, 0xdd, 0xdb, 0xff, 0xd9, 0xda, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xd1, 0xd1, 0xc8, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xda, 0xdc, 0xdd, 0xff, 0xd8, 0xda, 0xdb, 0xff, 0xd7, 0xd8, 0xd9, 0xff, 0xdf, 0xde, 0xdb, 0xff, 0xc6, 0xcd, 0xd4, 0xff, 0x5c, 0x89, 0xac, 0xff, 0x4c, 0x79, 0x9d, 0xff, 0x4c, 0x75, 0x94, 0xff, 0x2b, 0x51, 0x74, 0xff, 0x2c, 0x4f, 0x78, 0xff, 0x6f, 0x92, 0xba, 0xff, 0x85, 0xa4, 0xcc, 0xff, 0x88, 0xa6, 0xce, 0xff, 0x92, 0xb0, 0xdb, 0xff, 0x9f, 0xbb, 0xe4, 0xff, 0xae, 0xc6, 0xe7, 0xff, 0xbb, 0xcf, 0xeb, 0xff, 0xc1, 0xd3, 0xf1, 0xff, 0xc8, 0xd7, 0xf1, 0xff, 0xc9, 0xd8, 0xee, 0xff, 0xca, 0xd8, 0xf0, 0xff, 0xd0, 0xd9, 0xf3, 0xff, 0xcd, 0xd8, 0xf3, 0xff, 0xca, 0xd7, 0xf1, 0xff, 0xcc, 0xd9, 0xf4, 0xff, 0xcc, 0xd9, 0xf3, 0xff, 0xca, 0xd7, 0xef, 0xff, 0xc8, 0xd5, 0xed, 0xff, 0xcb, 0xd8, 0xf0, 0xff, 0xcc, 0xd9, 0xf1, 0xff, 0xcc, 0xd9, 0xf2, 0xff, 0xcb, 0xd9, 0xf2, 0xff, 0xcc, 0xd8, 0xf2, 0xff, 0xce, 0xd9, 0xf3, 0xff, 0xd3, 0xdd, 0xf6, 0xff, 0xd9, 0xe0, 0xf4, 0xff, 0xd3, 0xdc, 0xf4, 0xff, 0xcb, 0xda, 0xf6, 0xff, 0xc3, 0xd7, 0xf3, 0xff, 0xbc, 0xd1, 0xed, 0xff, 0xb1, 0xca, 0xe8, 0xff, 0xa2, 0xbe, 0xe4, 0xff, 0x9c, 0xb9, 0xdf, 0xff, 0x9d, 0xbc, 0xdf, 0xff, 0x77, 0x9f, 0xc6, 0xff, 0x31, 0x5e, 0x88, 0xff, 0x3b, 0x68, 0x8a, 0xff, 0x6e, 0x97, 0xb9, 0xff, 0x58, 0x8c, 0xb9, 0xff, 0x83, 0xa7, 0xc4, 0xff, 0xe3, 0xe0, 0xde, 0xff, 0xde, 0xdf, 0xdb, 0xff, 0xdb, 0xda, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xd0, 0xd0, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xd0, 0xd0, 0x4d, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xda, 0xdc, 0xdd, 0xff, 0xd8, 0xda, 0xdb, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xdc, 0xdb, 0xd8, 0xff, 0xc8, 0xce, 0xd5, 0xff, 0x64, 0x90, 0xb2, 0xff, 0x4a, 0x7a, 0x9f, 0xff, 0x43, 0x66, 0x87, 0xff, 0x1a, 0x34, 0x57, 0xff, 0x3e, 0x60, 0x83, 0xff, 0x7d, 0x9f, 0xc2, 0xff, 0x83, 0xa2, 0xc9, 0xff, 0x84, 0xa3, 0xcc, 0xff, 0x9b, 0xb7, 0xdc, 0xff, 0xb3, 0xcc, 0xec, 0xff, 0xb6, 0xcd, 0xed, 0xff, 0xaf, 0xc9, 0xeb, 0xff, 0x9c, 0xbe, 0xe0, 0xff, 0xa4, 0xc3, 0xe4, 0xff, 0xaf, 0xcb, 0xed, 0xff, 0xba, 0xd0, 0xf0, 0xff, 0xcc, 0xd9, 0xf4, 0xff, 0xcd, 0xd8, 0xf3, 0xff, 0xca, 0xd6, 0xef, 0xff, 0xca, 0xd7, 0xf0, 0xff, 0xcb, 0xd8, 0xef, 0xff, 0xc9, 0xd6, 0xee, 0xff, 0xc8, 0xd5, 0xed, 0xff, 0xcc, 0xd9, 0xf0, 0xff, 0xca, 0xd7, 0xee, 0xff, 0xc9, 0xd4, 0xed, 0xff, 0xcb, 0xd6, 0xf1, 0xff, 0xcf, 0xdb, 0xf3, 0xff, 0xd1, 0xde, 0xf2, 0xff, 0xcb, 0xda, 0xf0, 0xff, 0xbf, 0xd2, 0xea, 0xff, 0xb3, 0xcb, 0xea, 0xff, 0xae, 0xc9, 0xe8, 0xff, 0xc0, 0xd3, 0xee, 0xff, 0xcd, 0xd9, 0xf3, 0xff, 0xbd, 0xd2, 0xed, 0xff, 0xac, 0xc4, 0xe2, 0xff, 0x9c, 0xb8, 0xdb, 0xff, 0x99, 0xba, 0xdf, 0xff, 0x90, 0xb4, 0xda, 0xff, 0x3f, 0x64, 0x8c, 0xff, 0x21, 0x47, 0x6a, 0xff, 0x5b, 0x89, 0xab, 0xff, 0x54, 0x86, 0xb2, 0xff, 0x99, 0xb5, 0xcf, 0xff, 0xe5, 0xe3, 0xe0, 0xff, 0xdc, 0xdd, 0xdb, 0xff, 0xda, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xd0, 0xd0, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xd0, 0xd0, 0xcd, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xd8, 0xda, 0xdb, 0xff, 0xd7, 0xd9, 0xda, 0xff, 0xd4, 0xd9, 0xda, 0xff, 0xd7, 0xda, 0xd7, 0xff, 0xcc, 0xcf, 0xd6, 0xff, 0x60, 0x88, 0xa9, 0xff, 0x4a, 0x79, 0x9c, 0xff, 0x3d, 0x5d, 0x7e, 0xff, 0x11, 0x2c, 0x4e, 0xff, 0x59, 0x7b, 0x9e, 0xff, 0x85, 0xa5, 0xcd, 0xff, 0x7d, 0x9d, 0xc2, 0xff, 0x8f, 0xae, 0xd1, 0xff, 0x93, 0xb3, 0xd7, 0xff, 0x86, 0xab, 0xd0, 0xff, 0x7c, 0xa5, 0xd0, 0xff, 0x6c, 0x98, 0xc9, 0xff, 0x69, 0x95, 0xc7, 0xff, 0x69, 0x95, 0xc5, 0xff, 0x76, 0x9d, 0xcc, 0xff, 0x80, 0xa3, 0xd3, 0xff, 0x88, 0xaa, 0xd8, 0xff, 0xa3, 0xbb, 0xe5, 0xff, 0xb6, 0xc7, 0xe6, 0xff, 0xbf, 0xcc, 0xe4, 0xff, 0xc7, 0xd3, 0xea, 0xff, 0xc8, 0xd5, 0xeb, 0xff, 0xc7, 0xd4, 0xec, 0xff, 0xc9, 0xd6, 0xef, 0xff, 0xc7, 0xd3, 0xec, 0xff, 0xc2, 0xcf, 0xe9, 0xff, 0xbc, 0xca, 0xec, 0xff, 0xb4, 0xc8, 0xe8, 0xff, 0x9a, 0xb6, 0xd8, 0xff, 0x83, 0xa7, 0xd3, 0xff, 0x7b, 0xa2, 0xd0, 0xff, 0x71, 0x9b, 0xcf, 0xff, 0x72, 0x9f, 0xd1, 0xff, 0x7e, 0xa6, 0xd1, 0xff, 0x8d, 0xae, 0xd7, 0xff, 0x96, 0xb2, 0xdb, 0xff, 0x99, 0xb7, 0xdb, 0xff, 0x9c, 0xbc, 0xde, 0xff, 0x95, 0xb6, 0xdb, 0xff, 0x9e, 0xbe, 0xe1, 0xff, 0x6e, 0x8b, 0xae, 0xff, 0x1d, 0x3a, 0x5c, 0xff, 0x4a, 0x74, 0x98, 0xff, 0x51, 0x85, 0xb1, 0xff, 0xa3, 0xbb, 0xca, 0xff, 0xe8, 0xe3, 0xe1, 0xff, 0xd9, 0xdb, 0xda, 0xff, 0xd8, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xcf, 0xcf, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xcf, 0xcf, 0x40, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xd8, 0xda, 0xdb, 0xff, 0xd6, 0xd9, 0xda, 0xff, 0xd2, 0xd7, 0xd8, 0xff, 0xd7, 0xd9, 0xd6, 0xff, 0xd0, 0xd3, 0xda, 0xff, 0x59, 0x81, 0xa3, 0xff, 0x43, 0x72, 0x95, 0xff, 0x40, 0x62, 0x81, 0xff, 0x26, 0x40, 0x62, 0xff, 0x77, 0x93, 0xb6, 0xff, 0x85, 0x9f, 0xc9, 0xff, 0x84, 0xa1, 0xcd, 0xff, 0x7f, 0x9b, 0xc5, 0xff, 0x58, 0x7b, 0xaa, 0xff, 0x57, 0x81, 0xb2, 0xff, 0x71, 0x95, 0xbf, 0xff, 0x82, 0xa0, 0xc8, 0xff, 0x8d, 0xaa, 0xd2, 0xff, 0x7a, 0x98, 0xc6, 0xff, 0x67, 0x8a, 0xb9, 0xff, 0x63, 0x88, 0xba, 0xff, 0x69, 0x8b, 0xc1, 0xff, 0x7c, 0x9f, 0xcd, 0xff, 0x99, 0xb3, 0xd9, 0xff, 0xa9, 0xbe, 0xe1, 0xff, 0xbe, 0xcc, 0xe9, 0xff, 0xca, 0xd3, 0xec, 0xff, 0xc3, 0xd0, 0xec, 0xff, 0xbc, 0xce, 0xec, 0xff, 0xbb, 0xcb, 0xe7, 0xff, 0xaa, 0xc1, 0xe2, 0xff, 0x94, 0xb2, 0xda, 0xff, 0x7e, 0x9f, 0xcc, 0xff, 0x67, 0x8b, 0xbe, 0xff, 0x68, 0x8c, 0xbf, 0xff, 0x71, 0x94, 0xc6, 0xff, 0x81, 0xa0, 0xcf, 0xff, 0x91, 0xae, 0xd5, 0xff, 0x8d, 0xae, 0xd3, 0xff, 0x80, 0xa3, 0xd0, 0xff, 0x79, 0x9b, 0xcb, 0xff, 0x72, 0x97, 0xc1, 0xff, 0x8e, 0xb0, 0xd5, 0xff, 0x97, 0xb7, 0xdb, 0xff, 0x98, 0xb7, 0xdb, 0xff, 0x91, 0xae, 0xd1, 0xff, 0x33, 0x4f, 0x71, 0xff, 0x3b, 0x64, 0x88, 0xff, 0x58, 0x8c, 0xb8, 0xff, 0xa5, 0xbd, 0xcc, 0xff, 0xe8, 0xe4, 0xe2, 0xff, 0xd9, 0xdb, 0xda, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xcf, 0xcf, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xcf, 0xcf, 0xb3, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xdb, 0xff, 0xd7, 0xd9, 0xda, 0xff, 0xd5, 0xd8, 0xd9, 0xff, 0xd2, 0xd6, 0xd7, 0xff, 0xd7, 0xd9, 0xd7, 0xff, 0xca, 0xd1, 0xd2, 0xff, 0x58, 0x80, 0x9d, 0xff, 0x44, 0x73, 0x97, 0xff, 0x32, 0x58, 0x7a, 0xff, 0x3c, 0x58, 0x78, 0xff, 0x85, 0x9f, 0xc1, 0xff, 0x85, 0x9e, 0xc2, 0xff, 0x7e, 0x9b, 0xc3, 0xff, 0x66, 0x84, 0xb2, 0xff, 0x6a, 0x86, 0xb2, 0xff, 0x89, 0xa3, 0xc9, 0xff, 0x9f, 0xb6, 0xda, 0xff, 0xac, 0xbf, 0xe1, 0xff, 0xb6, 0xc7, 0xe4, 0xff, 0xaf, 0xbc, 0xe0, 0xff, 0x96, 0xac, 0xd7, 0xff, 0x7c, 0x9b, 0xc9, 0xff, 0x6f, 0x8b, 0xbc, 0xff, 0x69, 0x89, 0xb9, 0xff, 0x7c, 0x9a, 0xc6, 0xff, 0x97, 0xb2, 0xd9, 0xff, 0xa7, 0xbd, 0xe3, 0xff, 0xb7, 0xc7, 0xeb, 0xff, 0xc3, 0xcf, 0xeb, 0xff, 0xc0, 0xcd, 0xe8, 0xff, 0xb4, 0xc6, 0xe7, 0xff, 0x9d, 0xb6, 0xdd, 0xff, 0x7c, 0x9c, 0xca, 0xff, 0x67, 0x89, 0xbe, 0xff, 0x78, 0x95, 0xc6, 0xff, 0x93, 0xa8, 0xce, 0xff, 0xa1, 0xb5, 0xd8, 0xff, 0xaf, 0xc2, 0xe3, 0xff, 0xb9, 0xc7, 0xe4, 0xff, 0xb8, 0xc6, 0xe5, 0xff, 0xaa, 0xbf, 0xe6, 0xff, 0x96, 0xb4, 0xdc, 0xff, 0x86, 0xa5, 0xc8, 0xff, 0x85, 0xa6, 0xc8, 0xff, 0x93, 0xb3, 0xd8, 0xff, 0x94, 0xb4, 0xd7, 0xff, 0x9d, 0xba, 0xd8, 0xff, 0x4b, 0x6b, 0x8c, 0xff, 0x33, 0x5f, 0x84, 0xff, 0x4b, 0x7f, 0xaa, 0xff, 0x9d, 0xb5, 0xc5, 0xff, 0xea, 0xe6, 0xe4, 0xff, 0xdb, 0xdd, 0xdc, 0xff, 0xd8, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xcf, 0xcf, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xd2, 0xd2, 0x22, 0xcd, 0xcf, 0xcf, 0xfe, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xdb, 0xff, 0xd7, 0xd9, 0xda, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd0, 0xd4, 0xd5, 0xff, 0xd4, 0xd8, 0xd8, 0xff, 0xc8, 0xce, 0xce, 0xff, 0x56, 0x7b, 0x9a, 0xff, 0x39, 0x69, 0x92, 0xff, 0x2f, 0x54, 0x77, 0xff, 0x48, 0x64, 0x84, 0xff, 0x8a, 0xa5, 0xc8, 0xff, 0x81, 0x9d, 0xbe, 0xff, 0x7d, 0x9a, 0xba, 0xff, 0x7a, 0x95, 0xba, 0xff, 0x87, 0x9f, 0xca, 0xff, 0x90, 0xa6, 0xd3, 0xff, 0x9a, 0xb1, 0xde, 0xff, 0xa5, 0xbb, 0xe7, 0xff, 0xab, 0xc0, 0xe5, 0xff, 0xb5, 0xc3, 0xe8, 0xff, 0xbb, 0xc9, 0xee, 0xff, 0xb9, 0xca, 0xeb, 0xff, 0x9e, 0xb4, 0xda, 0xff, 0x72, 0x92, 0xc6, 0xff, 0x5e, 0x80, 0xb7, 0xff, 0x79, 0x97, 0xc7, 0xff, 0x93, 0xae, 0xda, 0xff, 0xab, 0xc1, 0xe7, 0xff, 0xc6, 0xd3, 0xee, 0xff, 0xc3, 0xcf, 0xea, 0xff, 0xac, 0xc1, 0xe7, 0xff, 0x8d, 0xa8, 0xd7, 0xff, 0x77, 0x92, 0xc3, 0xff, 0x83, 0x9c, 0xc8, 0xff, 0xa4, 0xb8, 0xdd, 0xff, 0xb6, 0xc7, 0xe8, 0xff, 0xb7, 0xc8, 0xe8, 0xff, 0xb3, 0xc6, 0xe7, 0xff, 0xb3, 0xc6, 0xe9, 0xff, 0xaf, 0xc2, 0xe8, 0xff, 0x9f, 0xb7, 0xe3, 0xff, 0x95, 0xb0, 0xdc, 0xff, 0x90, 0xad, 0xd4, 0xff, 0x96, 0xb3, 0xd3, 0xff, 0x9b, 0xb6, 0xd5, 0xff, 0x93, 0xb2, 0xd2, 0xff, 0xa1, 0xbd, 0xda, 0xff, 0x58, 0x78, 0x99, 0xff, 0x2d, 0x59, 0x7f, 0xff, 0x3c, 0x70, 0x9c, 0xff, 0x9e, 0xb5, 0xc4, 0xff, 0xeb, 0xe7, 0xe5, 0xff, 0xda, 0xdc, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xfe, 0xca, 0xd2, 0xd2, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xcf, 0xcf, 0x86, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xdb, 0xff, 0xd7, 0xd8, 0xd9, 0xff, 0xd4, 0xd7, 0xd8, 0xff, 0xd0, 0xd4, 0xd5, 0xff, 0xdc, 0xdc, 0xda, 0xff, 0xb3, 0xbe, 0xc7, 0xff, 0x2f, 0x57, 0x7e, 0xff, 0x36, 0x60, 0x86, 0xff, 0x3e, 0x67, 0x88, 0xff, 0x52, 0x70, 0x90, 0xff, 0x8d, 0xa6, 0xc6, 0xff, 0x85, 0x9e, 0xc0, 0xff, 0x83, 0x9c, 0xbc, 0xff, 0x7e, 0x95, 0xb8, 0xff, 0x7b, 0x93, 0xc0, 0xff, 0x7e, 0x9a, 0xce, 0xff, 0x7a, 0x96, 0xc9, 0xff, 0x7b, 0x98, 0xc4, 0xff, 0x99, 0xad, 0xd5, 0xff, 0xac, 0xbe, 0xe7, 0xff, 0xa5, 0xb9, 0xe5, 0xff, 0x93, 0xae, 0xdc, 0xff, 0x91, 0xae, 0xdd, 0xff, 0x9a, 0xb3, 0xdd, 0xff, 0x70, 0x8f, 0xbe, 0xff, 0x62, 0x85, 0xb6, 0xff, 0x95, 0xb0, 0xdc, 0xff, 0xbd, 0xcc, 0xef, 0xff, 0xc7, 0xd2, 0xee, 0xff, 0xbb, 0xcc, 0xec, 0xff, 0x9e, 0xb7, 0xe0, 0xff, 0x7b, 0x98, 0xcd, 0xff, 0x82, 0x9c, 0xcb, 0xff, 0x98, 0xb0, 0xd9, 0xff, 0x88, 0xa5, 0xd6, 0xff, 0x88, 0xa7, 0xd8, 0xff, 0xa5, 0xba, 0xe7, 0xff, 0xaf, 0xc1, 0xe8, 0xff, 0xa3, 0xb8, 0xdf, 0xff, 0x8f, 0xa9, 0xd5, 0xff, 0x91, 0xad, 0xd9, 0xff, 0x91, 0xab, 0xd9, 0xff, 0x8c, 0xa7, 0xd0, 0xff, 0x91, 0xad, 0xcd, 0xff, 0x9c, 0xb6, 0xd2, 0xff, 0x99, 0xb5, 0xd4, 0xff, 0x9f, 0xbb, 0xd7, 0xff, 0x61, 0x83, 0xa4, 0xff, 0x34, 0x60, 0x88, 0xff, 0x34, 0x66, 0x91, 0xff, 0x9b, 0xb3, 0xc3, 0xff, 0xed, 0xe7, 0xe4, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdc, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x04, 0xce, 0xcf, 0xcf, 0xe7, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xda, 0xff, 0xd6, 0xd7, 0xd8, 0xff, 0xd3, 0xd6, 0xd7, 0xff, 0xd0, 0xd5, 0xd5, 0xff, 0xe0, 0xde, 0xd9, 0xff, 0xa5, 0xb9, 0xc9, 0xff, 0x1e, 0x49, 0x77, 0xff, 0x2d, 0x51, 0x72, 0xff, 0x42, 0x71, 0x93, 0xff, 0x65, 0x83, 0xa5, 0xff, 0x97, 0xac, 0xc8, 0xff, 0x8c, 0xa1, 0xc3, 0xff, 0x77, 0x93, 0xb5, 0xff, 0x6c, 0x89, 0xae, 0xff, 0x6f, 0x8a, 0xb7, 0xff, 0x5e, 0x7a, 0xab, 0xff, 0x5b, 0x78, 0xa7, 0xff, 0x6c, 0x8a, 0xb4, 0xff, 0x7a, 0x90, 0xbc, 0xff, 0x7e, 0x91, 0xb3, 0xff, 0x79, 0x8b, 0xa9, 0xff, 0x52, 0x71, 0x9b, 0xff, 0x4a, 0x6e, 0xa6, 0xff, 0x63, 0x80, 0xb7, 0xff, 0x82, 0x9b, 0xc7, 0xff, 0x6a, 0x89, 0xba, 0xff, 0x8d, 0xaa, 0xdb, 0xff, 0xbc, 0xcd, 0xf3, 0xff, 0xc8, 0xd5, 0xf4, 0xff, 0xb8, 0xcc, 0xef, 0xff, 0x91, 0xae, 0xdc, 0xff, 0x81, 0x9b, 0xcd, 0xff, 0x8d, 0xa4, 0xd1, 0xff, 0x60, 0x80, 0xb6, 0xff, 0x45, 0x6a, 0xa6, 0xff, 0x4f, 0x70, 0x9e, 0xff, 0x7e, 0x93, 0xb6, 0xff, 0x94, 0xa6, 0xce, 0xff, 0x8a, 0xa2, 0xce, 0xff, 0x88, 0xa1, 0xd0, 0xff, 0x7c, 0x92, 0xbf, 0xff, 0x7c, 0x9b, 0xc5, 0xff, 0x8d, 0xa9, 0xcf, 0xff, 0x86, 0xa5, 0xc9, 0xff, 0x93, 0xb0, 0xd0, 0xff, 0xa0, 0xb9, 0xd7, 0xff, 0x9e, 0xb8, 0xd2, 0xff, 0x64, 0x8a, 0xaa, 0xff, 0x48, 0x74, 0x9a, 0xff, 0x30, 0x5e, 0x8a, 0xff, 0x84, 0xa2, 0xb9, 0xff, 0xec, 0xea, 0xe1, 0xff, 0xd9, 0xdc, 0xd7, 0xff, 0xd8, 0xdb, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xcf, 0xcf, 0xe7, 0xbf, 0xbf, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xd1, 0xd1, 0x49, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xda, 0xff, 0xd6, 0xd8, 0xd9, 0xff, 0xd3, 0xd5, 0xd6, 0xff, 0xcf, 0xd3, 0xd3, 0xff, 0xd6, 0xd7, 0xd3, 0xff, 0xb2, 0xc0, 0xd4, 0xff, 0x41, 0x65, 0x99, 0xff, 0x28, 0x52, 0x77, 0xff, 0x4a, 0x77, 0x96, 0xff, 0x74, 0x92, 0xb3, 0xff, 0x9b, 0xb1, 0xcd, 0xff, 0x8f, 0xa5, 0xc7, 0xff, 0x74, 0x94, 0xb6, 0xff, 0x53, 0x76, 0x9b, 0xff, 0x42, 0x60, 0x8c, 0xff, 0x41, 0x5b, 0x8b, 0xff, 0x53, 0x71, 0xa3, 0xff, 0x57, 0x77, 0xa5, 0xff, 0x1e, 0x34, 0x4a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x17, 0x17, 0x11, 0xff, 0x61, 0x6b, 0x73, 0xff, 0x80, 0x8c, 0xb2, 0xff, 0x31, 0x47, 0x7f, 0xff, 0x78, 0x93, 0xc0, 0xff, 0x83, 0xa1, 0xd1, 0xff, 0x7c, 0x9d, 0xd3, 0xff, 0xa9, 0xc4, 0xf5, 0xff, 0xbb, 0xcf, 0xf7, 0xff, 0xac, 0xc2, 0xeb, 0xff, 0x8a, 0xa9, 0xdd, 0xff, 0x99, 0xb6, 0xe3, 0xff, 0x83, 0x9a, 0xc6, 0xff, 0x2c, 0x4a, 0x85, 0xff, 0x76, 0x87, 0xac, 0xff, 0x56, 0x5e, 0x6f, 0xff, 0x06, 0x09, 0x09, 0xff, 0x08, 0x09, 0x0b, 0xff, 0x2c, 0x43, 0x60, 0xff, 0x6d, 0x8f, 0xc1, 0xff, 0x6a, 0x8b, 0xc1, 0xff, 0x5d, 0x7f, 0xaf, 0xff, 0x67, 0x87, 0xb3, 0xff, 0x81, 0xa0, 0xc5, 0xff, 0x96, 0xb2, 0xd2, 0xff, 0x9e, 0xb8, 0xd6, 0xff, 0xa0, 0xbb, 0xd5, 0xff, 0x6f, 0x94, 0xb2, 0xff, 0x4d, 0x7b, 0x9a, 0xff, 0x45, 0x72, 0x9e, 0xff, 0x8f, 0xaf, 0xd6, 0xff, 0xd6, 0xda, 0xe1, 0xff, 0xdf, 0xdf, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcb, 0xce, 0xce, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xd0, 0xd0, 0x9f, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd6, 0xd8, 0xd9, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd2, 0xd5, 0xd6, 0xff, 0xd0, 0xd3, 0xd3, 0xff, 0xd9, 0xdc, 0xd9, 0xff, 0x7f, 0x91, 0xb1, 0xff, 0x34, 0x4e, 0x86, 0xff, 0x46, 0x6d, 0x95, 0xff, 0x53, 0x7e, 0x9a, 0xff, 0x7a, 0x98, 0xb2, 0xff, 0x97, 0xaf, 0xc9, 0xff, 0x8e, 0xa9, 0xcc, 0xff, 0x8d, 0xac, 0xd3, 0xff, 0x67, 0x86, 0xb2, 0xff, 0x50, 0x6c, 0x9a, 0xff, 0x6c, 0x87, 0xb3, 0xff, 0x76, 0x92, 0xc0, 0xff, 0x88, 0xa0, 0xc8, 0xff, 0x8c, 0x98, 0xad, 0xff, 0x73, 0x75, 0x80, 0xff, 0x75, 0x7d, 0x8e, 0xff, 0xa7, 0xb8, 0xd7, 0xff, 0xb1, 0xc1, 0xe3, 0xff, 0x9e, 0xaa, 0xcb, 0xff, 0x9c, 0xb0, 0xd7, 0xff, 0x7a, 0x9c, 0xd7, 0xff, 0x77, 0x9c, 0xd9, 0xff, 0x9e, 0xc0, 0xf2, 0xff, 0xaf, 0xc9, 0xf5, 0xff, 0xa1, 0xbc, 0xed, 0xff, 0x88, 0xa9, 0xe2, 0xff, 0x94, 0xb4, 0xe6, 0xff, 0xa5, 0xb8, 0xda, 0xff, 0x8b, 0xa2, 0xc8, 0xff, 0xa2, 0xb6, 0xdf, 0xff, 0x9c, 0xab, 0xcc, 0xff, 0x6a, 0x70, 0x7f, 0xff, 0x63, 0x66, 0x6c, 0xff, 0x79, 0x8b, 0xa6, 0xff, 0x82, 0xa1, 0xc8, 0xff, 0x78, 0xa6, 0xcf, 0xff, 0x84, 0xa5, 0xcf, 0xff, 0x78, 0x99, 0xc3, 0xff, 0x92, 0xae, 0xd6, 0xff, 0xa1, 0xbd, 0xdf, 0xff, 0xa0, 0xba, 0xd9, 0xff, 0xa4, 0xba, 0xd5, 0xff, 0x77, 0x9c, 0xba, 0xff, 0x55, 0x83, 0xa5, 0xff, 0x5a, 0x85, 0xb5, 0xff, 0x7a, 0x9a, 0xd3, 0xff, 0xac, 0xb9, 0xd2, 0xff, 0xe7, 0xe3, 0xe0, 0xff, 0xda, 0xdc, 0xda, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xdc, 0xde, 0xde, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xce, 0xce, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xda, 0xda, 0x07, 0xcd, 0xd0, 0xd0, 0xef, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd6, 0xd8, 0xd9, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd2, 0xd5, 0xd6, 0xff, 0xcd, 0xd1, 0xd1, 0xff, 0xe3, 0xe3, 0xdb, 0xff, 0x73, 0x89, 0xac, 0xff, 0x00, 0x08, 0x46, 0xff, 0x38, 0x4e, 0x77, 0xff, 0x59, 0x85, 0xa7, 0xff, 0x72, 0x94, 0xb0, 0xff, 0x92, 0xab, 0xc3, 0xff, 0x8c, 0xa9, 0xcc, 0xff, 0x99, 0xb8, 0xdf, 0xff, 0x9e, 0xbb, 0xe8, 0xff, 0x9e, 0xba, 0xe7, 0xff, 0x91, 0xac, 0xd7, 0xff, 0x83, 0x9f, 0xcb, 0xff, 0x88, 0xa2, 0xcf, 0xff, 0x98, 0xb0, 0xde, 0xff, 0xa6, 0xbe, 0xee, 0xff, 0xa4, 0xbd, 0xf1, 0xff, 0x8f, 0xab, 0xe0, 0xff, 0x98, 0xb0, 0xdc, 0xff, 0xbe, 0xcd, 0xed, 0xff, 0x9e, 0xb8, 0xe7, 0xff, 0x6c, 0x93, 0xd2, 0xff, 0x7f, 0xa3, 0xe2, 0xff, 0x9c, 0xbc, 0xf5, 0xff, 0xab, 0xc4, 0xf4, 0xff, 0xa0, 0xbc, 0xed, 0xff, 0x8f, 0xaf, 0xe5, 0xff, 0x8b, 0xaa, 0xe2, 0xff, 0xaa, 0xc3, 0xf4, 0xff, 0xc2, 0xd2, 0xf8, 0xff, 0x9a, 0xb2, 0xd9, 0xff, 0x8e, 0xaa, 0xd9, 0xff, 0xa0, 0xba, 0xf0, 0xff, 0x9f, 0xbf, 0xf3, 0xff, 0x99, 0xb6, 0xe8, 0xff, 0x9c, 0xb4, 0xde, 0xff, 0x9b, 0xb5, 0xdd, 0xff, 0xa2, 0xbd, 0xe5, 0xff, 0xae, 0xc9, 0xf2, 0xff, 0xb0, 0xc9, 0xf2, 0xff, 0xa7, 0xc4, 0xe7, 0xff, 0xa2, 0xbc, 0xdb, 0xff, 0xa5, 0xba, 0xd5, 0xff, 0x79, 0xa0, 0xbc, 0xff, 0x6d, 0x96, 0xb7, 0xff, 0x38, 0x51, 0x8b, 0xff, 0x1f, 0x43, 0x89, 0xff, 0xa9, 0xb6, 0xcc, 0xff, 0xec, 0xe9, 0xe6, 0xff, 0xd9, 0xdb, 0xda, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xdc, 0xde, 0xde, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcc, 0xce, 0xce, 0xef, 0xda, 0xda, 0xda, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xcf, 0xcf, 0x46, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd5, 0xd6, 0xd7, 0xff, 0xd2, 0xd5, 0xd6, 0xff, 0xcc, 0xd0, 0xd2, 0xff, 0xd9, 0xda, 0xd0, 0xff, 0xb5, 0xc2, 0xce, 0xff, 0x17, 0x32, 0x7e, 0xff, 0x28, 0x3c, 0x75, 0xff, 0x59, 0x7e, 0xa1, 0xff, 0x68, 0x8f, 0xac, 0xff, 0x94, 0xab, 0xc4, 0xff, 0x8c, 0xa6, 0xca, 0xff, 0x94, 0xb3, 0xdc, 0xff, 0x9d, 0xbb, 0xe7, 0xff, 0xa7, 0xc2, 0xf1, 0xff, 0xb1, 0xc8, 0xf4, 0xff, 0xa4, 0xbb, 0xe4, 0xff, 0x91, 0xa9, 0xd7, 0xff, 0x84, 0x9e, 0xcf, 0xff, 0x7f, 0x99, 0xcd, 0xff, 0x89, 0xa2, 0xd5, 0xff, 0x9f, 0xb2, 0xdd, 0xff, 0xb5, 0xc6, 0xeb, 0xff, 0xb2, 0xc8, 0xf2, 0xff, 0x84, 0xa5, 0xdd, 0xff, 0x75, 0x98, 0xd4, 0xff, 0x8d, 0xaf, 0xe9, 0xff, 0xa1, 0xc1, 0xf9, 0xff, 0xaa, 0xc5, 0xf6, 0xff, 0xa0, 0xba, 0xee, 0xff, 0x93, 0xb1, 0xea, 0xff, 0x8e, 0xac, 0xeb, 0xff, 0x94, 0xb3, 0xef, 0xff, 0xb7, 0xcd, 0xf6, 0xff, 0xc6, 0xd3, 0xef, 0xff, 0xb0, 0xc0, 0xe2, 0xff, 0x93, 0xaa, 0xd9, 0xff, 0x8a, 0xa8, 0xd8, 0xff, 0x92, 0xad, 0xdd, 0xff, 0x9d, 0xb5, 0xe4, 0xff, 0xaa, 0xc0, 0xec, 0xff, 0xb2, 0xc8, 0xf4, 0xff, 0xb0, 0xc9, 0xf5, 0xff, 0xa8, 0xc5, 0xee, 0xff, 0xa5, 0xc1, 0xe6, 0xff, 0xa8, 0xbf, 0xe0, 0xff, 0xa4, 0xba, 0xd5, 0xff, 0x75, 0xa2, 0xc0, 0xff, 0x6b, 0x92, 0xb4, 0xff, 0x13, 0x2e, 0x78, 0xff, 0x3b, 0x5a, 0x9d, 0xff, 0xdb, 0xde, 0xe1, 0xff, 0xe3, 0xe1, 0xdc, 0xff, 0xd8, 0xdc, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xdc, 0xde, 0xde, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xcf, 0xcf, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xcf, 0xcf, 0x8d, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd5, 0xd6, 0xd7, 0xff, 0xd2, 0xd5, 0xd6, 0xff, 0xce, 0xd1, 0xd2, 0xff, 0xcb, 0xd1, 0xce, 0xff, 0xd1, 0xd8, 0xd3, 0xff, 0x57, 0x70, 0xa9, 0xff, 0x3c, 0x5a, 0x9a, 0xff, 0x4f, 0x6d, 0x95, 0xff, 0x69, 0x8b, 0xab, 0xff, 0x94, 0xab, 0xc5, 0xff, 0x8b, 0xa5, 0xca, 0xff, 0x8e, 0xac, 0xdb, 0xff, 0x9a, 0xb5, 0xe6, 0xff, 0xa2, 0xbd, 0xf0, 0xff, 0xad, 0xc6, 0xf5, 0xff, 0xbc, 0xd0, 0xf9, 0xff, 0xc7, 0xd7, 0xfa, 0xff, 0xc4, 0xd5, 0xf8, 0xff, 0xc1, 0xd5, 0xfa, 0xff, 0xc7, 0xd8, 0xfa, 0xff, 0xd4, 0xde, 0xf9, 0xff, 0xc5, 0xd5, 0xf9, 0xff, 0x95, 0xb5, 0xea, 0xff, 0x73, 0x96, 0xd0, 0xff, 0x7e, 0xa0, 0xda, 0xff, 0x9e, 0xbc, 0xf2, 0xff, 0xb0, 0xc7, 0xf8, 0xff, 0xb3, 0xca, 0xf8, 0xff, 0xa4, 0xc0, 0xf3, 0xff, 0x91, 0xb1, 0xe9, 0xff, 0x92, 0xb1, 0xee, 0xff, 0x96, 0xb3, 0xeb, 0xff, 0xa5, 0xc1, 0xf1, 0xff, 0xbf, 0xd2, 0xfc, 0xff, 0xcd, 0xdc, 0xff, 0xff, 0xca, 0xdb, 0xfd, 0xff, 0xc1, 0xd7, 0xf8, 0xff, 0xb8, 0xd1, 0xf8, 0xff, 0xb5, 0xcd, 0xfc, 0xff, 0xb7, 0xce, 0xfd, 0xff, 0xb6, 0xcc, 0xf9, 0xff, 0xaa, 0xc6, 0xf3, 0xff, 0xa3, 0xc2, 0xed, 0xff, 0xa4, 0xbe, 0xe6, 0xff, 0xac, 0xc1, 0xe0, 0xff, 0xa7, 0xbd, 0xd6, 0xff, 0x63, 0x8c, 0xb4, 0xff, 0x6c, 0x89, 0xb3, 0xff, 0x4b, 0x74, 0xbe, 0xff, 0x8f, 0xa7, 0xd2, 0xff, 0xee, 0xe9, 0xe1, 0xff, 0xdb, 0xd9, 0xda, 0xff, 0xd9, 0xdc, 0xda, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xdc, 0xde, 0xde, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xcf, 0xcf, 0xd7, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd5, 0xd6, 0xd7, 0xff, 0xd2, 0xd5, 0xd6, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xc8, 0xcc, 0xcf, 0xff, 0xd5, 0xd6, 0xce, 0xff, 0x9a, 0xaa, 0xc1, 0xff, 0x51, 0x72, 0xb1, 0xff, 0x27, 0x46, 0x78, 0xff, 0x60, 0x7a, 0x9e, 0xff, 0x9b, 0xb1, 0xc9, 0xff, 0x8a, 0xa4, 0xc9, 0xff, 0x82, 0xa0, 0xd1, 0xff, 0x93, 0xad, 0xe2, 0xff, 0x9c, 0xb9, 0xef, 0xff, 0xa6, 0xc3, 0xf5, 0xff, 0xb7, 0xce, 0xfb, 0xff, 0xc2, 0xd6, 0xfb, 0xff, 0xc2, 0xd5, 0xfa, 0xff, 0xc3, 0xd5, 0xfc, 0xff, 0xc5, 0xd5, 0xf9, 0xff, 0xc6, 0xd6, 0xf9, 0xff, 0xaf, 0xc9, 0xf8, 0xff, 0x7c, 0x9e, 0xdd, 0xff, 0x6d, 0x8f, 0xca, 0xff, 0x8a, 0xaa, 0xe2, 0xff, 0x9e, 0xbd, 0xf1, 0xff, 0xb3, 0xcb, 0xf8, 0xff, 0xb8, 0xcd, 0xf8, 0xff, 0xa9, 0xc6, 0xf3, 0xff, 0x99, 0xb8, 0xeb, 0xff, 0x8c, 0xad, 0xe2, 0xff, 0x8d, 0xab, 0xe3, 0xff, 0xa1, 0xb9, 0xf2, 0xff, 0xac, 0xcb, 0xfb, 0xff, 0xb5, 0xcd, 0xfb, 0xff, 0xc4, 0xd3, 0xfb, 0xff, 0xbc, 0xd4, 0xf8, 0xff, 0xb7, 0xd1, 0xfa, 0xff, 0xb9, 0xcf, 0xfa, 0xff, 0xbb, 0xd1, 0xfb, 0xff, 0xba, 0xd0, 0xfc, 0xff, 0xab, 0xc5, 0xf2, 0xff, 0xa2, 0xc0, 0xea, 0xff, 0x9f, 0xbb, 0xe2, 0xff, 0xa7, 0xbc, 0xd8, 0xff, 0xb4, 0xc4, 0xd8, 0xff, 0x57, 0x7a, 0xad, 0xff, 0x59, 0x78, 0xb7, 0xff, 0x82, 0xa1, 0xd9, 0xff, 0xbf, 0xcd, 0xd6, 0xff, 0xe2, 0xe2, 0xd8, 0xff, 0xd9, 0xd9, 0xdc, 0xff, 0xd9, 0xdc, 0xda, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xdc, 0xde, 0xde, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xcd, 0xcd, 0xcd, 0x1a, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd3, 0xd5, 0xd6, 0xff, 0xd1, 0xd4, 0xd5, 0xff, 0xcd, 0xd2, 0xd3, 0xff, 0xca, 0xcd, 0xce, 0xff, 0xce, 0xd2, 0xcc, 0xff, 0xb8, 0xc2, 0xca, 0xff, 0x6a, 0x86, 0xc2, 0xff, 0x28, 0x47, 0x84, 0xff, 0x5b, 0x74, 0x97, 0xff, 0xa2, 0xb4, 0xc9, 0xff, 0x88, 0xa4, 0xc6, 0xff, 0x7d, 0xa0, 0xce, 0xff, 0x8f, 0xb0, 0xe1, 0xff, 0x9f, 0xbd, 0xf1, 0xff, 0xb2, 0xca, 0xfa, 0xff, 0xb9, 0xd0, 0xfa, 0xff, 0xbb, 0xd1, 0xf7, 0xff, 0xc3, 0xd5, 0xfc, 0xff, 0xc8, 0xd5, 0xfa, 0xff, 0xc7, 0xd5, 0xfc, 0xff, 0xbe, 0xd4, 0xff, 0xff, 0x9f, 0xbe, 0xf0, 0xff, 0x70, 0x8d, 0xcf, 0xff, 0x79, 0x98, 0xd3, 0xff, 0x9a, 0xb8, 0xec, 0xff, 0xaa, 0xc4, 0xf1, 0xff, 0xc7, 0xd6, 0xfa, 0xff, 0xce, 0xd8, 0xfa, 0xff, 0xb5, 0xcd, 0xf7, 0xff, 0xa4, 0xbf, 0xf2, 0xff, 0x90, 0xad, 0xe6, 0xff, 0x83, 0xa2, 0xdd, 0xff, 0x91, 0xaf, 0xe5, 0xff, 0xac, 0xc9, 0xf8, 0xff, 0xb5, 0xcc, 0xfd, 0xff, 0xbe, 0xd0, 0xfc, 0xff, 0xb9, 0xd0, 0xfb, 0xff, 0xb6, 0xd1, 0xfc, 0xff, 0xbb, 0xd2, 0xfb, 0xff, 0xc1, 0xd5, 0xf9, 0xff, 0xc0, 0xd5, 0xfb, 0xff, 0xb2, 0xcb, 0xf7, 0xff, 0xaa, 0xc6, 0xef, 0xff, 0xa1, 0xbc, 0xdf, 0xff, 0xa1, 0xb6, 0xd3, 0xff, 0xbc, 0xc8, 0xdc, 0xff, 0x6d, 0x8f, 0xbe, 0xff, 0x5d, 0x85, 0xc7, 0xff, 0x93, 0xad, 0xdc, 0xff, 0xcd, 0xd3, 0xd6, 0xff, 0xdd, 0xdc, 0xd9, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xdc, 0xde, 0xde, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xcd, 0xcd, 0xcd, 0x58, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd3, 0xd5, 0xd6, 0xff, 0xd1, 0xd4, 0xd5, 0xff, 0xcd, 0xd2, 0xd3, 0xff, 0xca, 0xcd, 0xce, 0xff, 0xcc, 0xd0, 0xcb, 0xff, 0xb7, 0xc1, 0xcc, 0xff, 0x6a, 0x84, 0xc2, 0xff, 0x48, 0x67, 0xa3, 0xff, 0x79, 0x93, 0xb6, 0xff, 0x9c, 0xad, 0xc2, 0xff, 0x84, 0xa0, 0xc3, 0xff, 0x82, 0xa7, 0xd4, 0xff, 0x94, 0xb5, 0xe6, 0xff, 0xa0, 0xbe, 0xf2, 0xff, 0xb3, 0xcb, 0xfa, 0xff, 0xbb, 0xd1, 0xfb, 0xff, 0xbc, 0xd3, 0xf7, 0xff, 0xc3, 0xd4, 0xf9, 0xff, 0xc7, 0xd5, 0xfb, 0xff, 0xc1, 0xd3, 0xfd, 0xff, 0xb2, 0xc9, 0xf9, 0xff, 0x8e, 0xaa, 0xdf, 0xff, 0x7a, 0x99, 0xd2, 0xff, 0x82, 0xa4, 0xdb, 0xff, 0x95, 0xb6, 0xea, 0xff, 0xb7, 0xca, 0xf6, 0xff, 0xcb, 0xd5, 0xf8, 0xff, 0xcc, 0xda, 0xfa, 0xff, 0xbf, 0xd2, 0xfb, 0xff, 0x9e, 0xbf, 0xf2, 0xff, 0x8e, 0xb0, 0xeb, 0xff, 0x93, 0xaf, 0xea, 0xff, 0x92, 0xb2, 0xe8, 0xff, 0x9b, 0xbb, 0xef, 0xff, 0xa4, 0xbf, 0xf5, 0xff, 0xa9, 0xc6, 0xf6, 0xff, 0xb4, 0xcc, 0xfd, 0xff, 0xb9, 0xd0, 0xff, 0xff, 0xba, 0xd3, 0xfc, 0xff, 0xc0, 0xd4, 0xf9, 0xff, 0xbe, 0xd4, 0xf9, 0xff, 0xb4, 0xcd, 0xf9, 0xff, 0xae, 0xca, 0xf4, 0xff, 0xa6, 0xc0, 0xe3, 0xff, 0xa2, 0xb8, 0xd7, 0xff, 0xbc, 0xc7, 0xda, 0xff, 0x92, 0xab, 0xd0, 0xff, 0x6e, 0x93, 0xd2, 0xff, 0x93, 0xae, 0xdf, 0xff, 0xcd, 0xd4, 0xd9, 0xff, 0xdd, 0xdb, 0xd9, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xdc, 0xde, 0xde, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcd, 0xcd, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xcd, 0xcf, 0xcf, 0x90, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xda, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd3, 0xd6, 0xd7, 0xff, 0xd2, 0xd5, 0xd6, 0xff, 0xd0, 0xd3, 0xd4, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xca, 0xce, 0xd0, 0xff, 0xcd, 0xcf, 0xcb, 0xff, 0xb5, 0xc2, 0xcf, 0xff, 0x5e, 0x81, 0xbe, 0xff, 0x57, 0x7b, 0xb6, 0xff, 0x87, 0x9f, 0xbf, 0xff, 0x95, 0xaa, 0xbe, 0xff, 0x89, 0xa1, 0xc2, 0xff, 0x89, 0xa8, 0xd4, 0xff, 0x94, 0xb3, 0xe9, 0xff, 0xa2, 0xbc, 0xf0, 0xff, 0xab, 0xc3, 0xf3, 0xff, 0xba, 0xce, 0xfa, 0xff, 0xc1, 0xd3, 0xfb, 0xff, 0xbe, 0xcf, 0xfa, 0xff, 0xb1, 0xc5, 0xf7, 0xff, 0xa0, 0xbb, 0xf0, 0xff, 0x8d, 0xac, 0xe2, 0xff, 0x81, 0xa1, 0xdc, 0xff, 0x88, 0xac, 0xe6, 0xff, 0x7b, 0x9b, 0xd5, 0xff, 0x79, 0x95, 0xce, 0xff, 0x8f, 0xae, 0xe4, 0xff, 0xaa, 0xc5, 0xf3, 0xff, 0xae, 0xc5, 0xf4, 0xff, 0x9c, 0xb6, 0xe9, 0xff, 0x85, 0xa6, 0xe0, 0xff, 0x87, 0xab, 0xe9, 0xff, 0x9e, 0xbf, 0xf8, 0xff, 0x96, 0xb5, 0xef, 0xff, 0x89, 0xaa, 0xe0, 0xff, 0x9b, 0xb9, 0xe9, 0xff, 0x92, 0xb4, 0xe9, 0xff, 0xa0, 0xbf, 0xf5, 0xff, 0xb3, 0xce, 0xfe, 0xff, 0xbd, 0xd3, 0xfa, 0xff, 0xc5, 0xd6, 0xf9, 0xff, 0xbc, 0xd1, 0xfa, 0xff, 0xaf, 0xc9, 0xf4, 0xff, 0xab, 0xc6, 0xf0, 0xff, 0xa9, 0xc3, 0xe4, 0xff, 0xa5, 0xbc, 0xd9, 0xff, 0xb7, 0xc4, 0xd7, 0xff, 0x9c, 0xb1, 0xd3, 0xff, 0x71, 0x96, 0xd6, 0xff, 0x8e, 0xab, 0xe3, 0xff, 0xcc, 0xd1, 0xda, 0xff, 0xdd, 0xdd, 0xd8, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xdc, 0xde, 0xdd, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xcc, 0xcf, 0xcf, 0xc6, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd8, 0xda, 0xff, 0xd5, 0xd6, 0xd8, 0xff, 0xd2, 0xd6, 0xd7, 0xff, 0xd1, 0xd5, 0xd6, 0xff, 0xcf, 0xd3, 0xd4, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xca, 0xcf, 0xd1, 0xff, 0xd1, 0xd2, 0xce, 0xff, 0xa4, 0xb4, 0xc3, 0xff, 0x6e, 0x8f, 0xc4, 0xff, 0x6d, 0x8f, 0xc4, 0xff, 0x81, 0x9b, 0xb9, 0xff, 0x99, 0xaf, 0xc2, 0xff, 0x8d, 0xa2, 0xc0, 0xff, 0x86, 0xa2, 0xcf, 0xff, 0x8e, 0xac, 0xe4, 0xff, 0xa0, 0xba, 0xef, 0xff, 0xa1, 0xbc, 0xf1, 0xff, 0xae, 0xc3, 0xf2, 0xff, 0xb5, 0xc8, 0xf8, 0xff, 0xa8, 0xc0, 0xf6, 0xff, 0x8b, 0xab, 0xe6, 0xff, 0x86, 0xa7, 0xe3, 0xff, 0x87, 0xa8, 0xe3, 0xff, 0x5e, 0x7f, 0xbc, 0xff, 0x4f, 0x6b, 0xa9, 0xff, 0x38, 0x49, 0x7c, 0xff, 0x36, 0x41, 0x6d, 0xff, 0x5e, 0x7a, 0xb3, 0xff, 0x7a, 0x9c, 0xd9, 0xff, 0x80, 0xa0, 0xde, 0xff, 0x70, 0x8d, 0xc8, 0xff, 0x3e, 0x53, 0x7c, 0xff, 0x30, 0x40, 0x67, 0xff, 0x41, 0x5b, 0x92, 0xff, 0x5b, 0x75, 0xba, 0xff, 0x89, 0xa4, 0xdd, 0xff, 0xaf, 0xc8, 0xf3, 0xff, 0x9d, 0xb9, 0xea, 0xff, 0x83, 0xa8, 0xdf, 0xff, 0x8e, 0xb4, 0xec, 0xff, 0xaf, 0xcb, 0xf8, 0xff, 0xbc, 0xcf, 0xf5, 0xff, 0xb9, 0xcb, 0xf5, 0xff, 0xab, 0xc5, 0xf0, 0xff, 0xa3, 0xbe, 0xe7, 0xff, 0xa4, 0xbd, 0xdd, 0xff, 0xa3, 0xbb, 0xd6, 0xff, 0xb6, 0xc3, 0xd6, 0xff, 0xa1, 0xb4, 0xd7, 0xff, 0x85, 0xa7, 0xdc, 0xff, 0x8a, 0xab, 0xdc, 0xff, 0xc5, 0xcb, 0xd5, 0xff, 0xdf, 0xde, 0xd9, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xdc, 0xde, 0xdd, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xce, 0xce, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x01, 0xcd, 0xce, 0xce, 0xf2, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd8, 0xda, 0xff, 0xd5, 0xd6, 0xd8, 0xff, 0xd2, 0xd6, 0xd7, 0xff, 0xd1, 0xd5, 0xd6, 0xff, 0xcf, 0xd3, 0xd4, 0xff, 0xcc, 0xd0, 0xd0, 0xff, 0xca, 0xce, 0xd1, 0xff, 0xce, 0xcf, 0xcc, 0xff, 0xa7, 0xb4, 0xc5, 0xff, 0x89, 0xa4, 0xd1, 0xff, 0x84, 0xa2, 0xd0, 0xff, 0x75, 0x91, 0xb3, 0xff, 0x94, 0xab, 0xc1, 0xff, 0x86, 0x9f, 0xbf, 0xff, 0x7b, 0x96, 0xc3, 0xff, 0x84, 0xa0, 0xd9, 0xff, 0x90, 0xac, 0xe4, 0xff, 0x94, 0xb3, 0xe7, 0xff, 0x9e, 0xba, 0xed, 0xff, 0x99, 0xb4, 0xef, 0xff, 0x84, 0xa2, 0xe1, 0xff, 0x85, 0xa4, 0xdc, 0xff, 0xa1, 0xbc, 0xee, 0xff, 0x9b, 0xb4, 0xef, 0xff, 0x58, 0x72, 0xb1, 0xff, 0x19, 0x29, 0x58, 0xff, 0x0a, 0x15, 0x37, 0xff, 0x0f, 0x17, 0x33, 0xff, 0x27, 0x31, 0x5b, 0xff, 0x36, 0x49, 0x7c, 0xff, 0x3c, 0x5a, 0x88, 0xff, 0x3c, 0x55, 0x84, 0xff, 0x24, 0x35, 0x65, 0xff, 0x22, 0x2f, 0x62, 0xff, 0x1f, 0x36, 0x70, 0xff, 0x4d, 0x68, 0xa5, 0xff, 0x98, 0xb1, 0xe8, 0xff, 0xaa, 0xc1, 0xf1, 0xff, 0xa8, 0xc2, 0xef, 0xff, 0x8e, 0xaf, 0xe5, 0xff, 0x6b, 0x92, 0xcf, 0xff, 0x84, 0xa9, 0xe3, 0xff, 0xa0, 0xbd, 0xf1, 0xff, 0xae, 0xc4, 0xee, 0xff, 0xaa, 0xc3, 0xec, 0xff, 0x9a, 0xb5, 0xdf, 0xff, 0x93, 0xaf, 0xd1, 0xff, 0xa3, 0xba, 0xd5, 0xff, 0xb2, 0xbf, 0xd4, 0xff, 0x9d, 0xb4, 0xd7, 0xff, 0xa4, 0xbd, 0xe5, 0xff, 0x98, 0xb5, 0xdf, 0xff, 0xc4, 0xcc, 0xd8, 0xff, 0xdd, 0xdc, 0xd9, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xdc, 0xde, 0xdd, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xce, 0xce, 0xf2, 0xff, 0xff, 0xff, 0x01,
+    0xd0, 0xd0, 0xd0, 0x21, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xda, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd1, 0xd5, 0xd6, 0xff, 0xd0, 0xd4, 0xd5, 0xff, 0xce, 0xd2, 0xd3, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xca, 0xcc, 0xd0, 0xff, 0xcb, 0xcd, 0xcb, 0xff, 0xa6, 0xb5, 0xcf, 0xff, 0x84, 0xa4, 0xd4, 0xff, 0x7d, 0x9f, 0xcb, 0xff, 0x67, 0x84, 0xab, 0xff, 0x84, 0x9c, 0xbc, 0xff, 0x7d, 0x99, 0xbc, 0xff, 0x71, 0x8c, 0xb6, 0xff, 0x75, 0x91, 0xc5, 0xff, 0x75, 0x93, 0xce, 0xff, 0x7e, 0x9b, 0xd5, 0xff, 0x80, 0x9e, 0xd9, 0xff, 0x6b, 0x8a, 0xc7, 0xff, 0x6c, 0x8b, 0xc8, 0xff, 0x8d, 0xa8, 0xdf, 0xff, 0x9d, 0xb5, 0xe9, 0xff, 0x8b, 0xa8, 0xe0, 0xff, 0x77, 0x96, 0xd2, 0xff, 0x62, 0x76, 0xb0, 0xff, 0x55, 0x6b, 0xa7, 0xff, 0x50, 0x66, 0xa0, 0xff, 0x3a, 0x46, 0x75, 0xff, 0x26, 0x33, 0x5a, 0xff, 0x23, 0x3c, 0x63, 0xff, 0x45, 0x5f, 0x8c, 0xff, 0x6b, 0x85, 0xc1, 0xff, 0x73, 0x92, 0xcf, 0xff, 0x78, 0x96, 0xd2, 0xff, 0x8a, 0xa5, 0xda, 0xff, 0x9c, 0xb5, 0xe2, 0xff, 0x9c, 0xb6, 0xe7, 0xff, 0x91, 0xb1, 0xe4, 0xff, 0x8c, 0xb0, 0xe7, 0xff, 0x6e, 0x91, 0xca, 0xff, 0x50, 0x75, 0xaf, 0xff, 0x76, 0x9b, 0xd4, 0xff, 0x94, 0xb4, 0xe1, 0xff, 0x9a, 0xb5, 0xde, 0xff, 0x90, 0xac, 0xd6, 0xff, 0x88, 0xa5, 0xc8, 0xff, 0xa0, 0xb8, 0xd4, 0xff, 0xa6, 0xb6, 0xcf, 0xff, 0x8a, 0xa8, 0xd0, 0xff, 0xa5, 0xbb, 0xe3, 0xff, 0xa1, 0xba, 0xe9, 0xff, 0xc4, 0xcd, 0xdc, 0xff, 0xde, 0xdd, 0xd7, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xd9, 0xdb, 0xda, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xd0, 0xd0, 0xd0, 0x21,
+    0xcc, 0xcf, 0xcf, 0x4b, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xda, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd1, 0xd5, 0xd6, 0xff, 0xd0, 0xd4, 0xd5, 0xff, 0xce, 0xd2, 0xd3, 0xff, 0xcb, 0xd0, 0xd0, 0xff, 0xcd, 0xcd, 0xcf, 0xff, 0xcf, 0xcf, 0xc9, 0xff, 0x8c, 0xa5, 0xc9, 0xff, 0x77, 0x9f, 0xda, 0xff, 0x86, 0xa9, 0xd7, 0xff, 0x6f, 0x8e, 0xba, 0xff, 0x7c, 0x92, 0xb7, 0xff, 0x76, 0x90, 0xba, 0xff, 0x65, 0x82, 0xa9, 0xff, 0x5f, 0x7e, 0xa9, 0xff, 0x5c, 0x7b, 0xb2, 0xff, 0x62, 0x7f, 0xb8, 0xff, 0x4f, 0x6d, 0xa4, 0xff, 0x44, 0x63, 0x99, 0xff, 0x6d, 0x8d, 0xc4, 0xff, 0x8a, 0xa5, 0xdc, 0xff, 0x8c, 0xa5, 0xdb, 0xff, 0x8b, 0xa5, 0xd9, 0xff, 0x8a, 0xa3, 0xdc, 0xff, 0x87, 0x9f, 0xdf, 0xff, 0x82, 0x9d, 0xda, 0xff, 0x83, 0x98, 0xd1, 0xff, 0x77, 0x90, 0xc5, 0xff, 0x63, 0x80, 0xb4, 0xff, 0x67, 0x81, 0xb6, 0xff, 0x7b, 0x99, 0xcb, 0xff, 0x96, 0xae, 0xdd, 0xff, 0xa0, 0xb8, 0xe6, 0xff, 0xa0, 0xba, 0xe9, 0xff, 0xa0, 0xb7, 0xe4, 0xff, 0xa4, 0xb9, 0xe3, 0xff, 0xa1, 0xb7, 0xe1, 0xff, 0x99, 0xb3, 0xde, 0xff, 0x87, 0xa5, 0xd5, 0xff, 0x80, 0xa0, 0xd5, 0xff, 0x52, 0x72, 0xa6, 0xff, 0x40, 0x60, 0x94, 0xff, 0x69, 0x8b, 0xbe, 0xff, 0x7f, 0x9d, 0xcc, 0xff, 0x7e, 0x9b, 0xc6, 0xff, 0x86, 0xa2, 0xc2, 0xff, 0x96, 0xb0, 0xcf, 0xff, 0x9e, 0xb4, 0xd5, 0xff, 0x90, 0xae, 0xd9, 0xff, 0xa4, 0xbf, 0xe9, 0xff, 0x94, 0xb3, 0xeb, 0xff, 0xbb, 0xc5, 0xd7, 0xff, 0xe1, 0xdf, 0xd8, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xd9, 0xdb, 0xda, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xcf, 0xcf, 0x4b,
+    0xcc, 0xcf, 0xcf, 0x6b, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd1, 0xd5, 0xd6, 0xff, 0xd0, 0xd4, 0xd5, 0xff, 0xce, 0xd2, 0xd3, 0xff, 0xcc, 0xcf, 0xd0, 0xff, 0xc8, 0xcd, 0xce, 0xff, 0xcf, 0xd0, 0xca, 0xff, 0xa4, 0xb1, 0xbf, 0xff, 0x5f, 0x85, 0xbf, 0xff, 0x6b, 0x98, 0xd6, 0xff, 0x5f, 0x81, 0xb9, 0xff, 0x6f, 0x85, 0xad, 0xff, 0x76, 0x92, 0xb6, 0xff, 0x5b, 0x7d, 0xa4, 0xff, 0x51, 0x6d, 0x98, 0xff, 0x58, 0x77, 0xa6, 0xff, 0x4e, 0x72, 0x9e, 0xff, 0x33, 0x55, 0x83, 0xff, 0x5e, 0x79, 0xac, 0xff, 0x80, 0x9b, 0xce, 0xff, 0x8b, 0xa4, 0xda, 0xff, 0x92, 0xab, 0xdc, 0xff, 0x97, 0xb2, 0xdd, 0xff, 0x92, 0xad, 0xdd, 0xff, 0x8b, 0xa6, 0xdc, 0xff, 0x91, 0xac, 0xdd, 0xff, 0x96, 0xb0, 0xde, 0xff, 0x95, 0xaf, 0xe0, 0xff, 0x90, 0xa9, 0xda, 0xff, 0x95, 0xad, 0xdb, 0xff, 0xa4, 0xb7, 0xe4, 0xff, 0xb0, 0xc5, 0xe9, 0xff, 0xaf, 0xc5, 0xec, 0xff, 0xaa, 0xc1, 0xe8, 0xff, 0xac, 0xc2, 0xe7, 0xff, 0xab, 0xc0, 0xe5, 0xff, 0xac, 0xc3, 0xe2, 0xff, 0xa1, 0xb8, 0xdb, 0xff, 0x8e, 0xa7, 0xd1, 0xff, 0x80, 0x9b, 0xcb, 0xff, 0x60, 0x7a, 0xac, 0xff, 0x36, 0x53, 0x84, 0xff, 0x59, 0x7b, 0xac, 0xff, 0x72, 0x91, 0xbe, 0xff, 0x75, 0x95, 0xbc, 0xff, 0x82, 0xa1, 0xc3, 0xff, 0x94, 0xae, 0xcb, 0xff, 0x96, 0xb0, 0xd3, 0xff, 0x94, 0xb4, 0xe8, 0xff, 0x91, 0xb3, 0xee, 0xff, 0x88, 0xa7, 0xd7, 0xff, 0xca, 0xce, 0xd3, 0xff, 0xdc, 0xdb, 0xd9, 0xff, 0xd8, 0xda, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xcf, 0xcf, 0x6b,
+    0xcd, 0xcf, 0xcf, 0x8b, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd1, 0xd5, 0xd6, 0xff, 0xd0, 0xd4, 0xd5, 0xff, 0xce, 0xd2, 0xd3, 0xff, 0xca, 0xcd, 0xcf, 0xff, 0xc6, 0xcb, 0xcc, 0xff, 0xc3, 0xc9, 0xc8, 0xff, 0xcc, 0xca, 0xc5, 0xff, 0x94, 0xa0, 0xb3, 0xff, 0x47, 0x69, 0x9f, 0xff, 0x49, 0x61, 0x89, 0xff, 0x7e, 0x8f, 0xa8, 0xff, 0x70, 0x8c, 0xaf, 0xff, 0x62, 0x81, 0xa7, 0xff, 0x50, 0x6d, 0x98, 0xff, 0x5f, 0x7d, 0xac, 0xff, 0x6a, 0x8f, 0xbe, 0xff, 0x55, 0x77, 0xa5, 0xff, 0x6d, 0x89, 0xb7, 0xff, 0x63, 0x7f, 0xad, 0xff, 0x64, 0x80, 0xae, 0xff, 0x78, 0x93, 0xc6, 0xff, 0x84, 0xa1, 0xd4, 0xff, 0x81, 0xa0, 0xd1, 0xff, 0x7e, 0x9a, 0xcf, 0xff, 0x74, 0x8f, 0xcb, 0xff, 0x73, 0x90, 0xcc, 0xff, 0x89, 0x9f, 0xd8, 0xff, 0xa1, 0xb1, 0xe3, 0xff, 0xa1, 0xb6, 0xe4, 0xff, 0x9c, 0xb2, 0xe3, 0xff, 0x91, 0xa6, 0xdb, 0xff, 0x7b, 0x91, 0xcf, 0xff, 0x76, 0x91, 0xcf, 0xff, 0x80, 0x9a, 0xd1, 0xff, 0x82, 0x97, 0xcb, 0xff, 0x88, 0x9e, 0xd0, 0xff, 0x7f, 0x93, 0xc5, 0xff, 0x5f, 0x78, 0xa6, 0xff, 0x58, 0x76, 0xa0, 0xff, 0x70, 0x8c, 0xb8, 0xff, 0x7b, 0x9a, 0xc5, 0xff, 0x85, 0xa9, 0xd4, 0xff, 0x78, 0x98, 0xbd, 0xff, 0x6c, 0x8d, 0xb2, 0xff, 0x7e, 0x9e, 0xc2, 0xff, 0x9d, 0xb5, 0xce, 0xff, 0x82, 0x9a, 0xba, 0xff, 0x53, 0x7a, 0xb8, 0xff, 0x79, 0x96, 0xc9, 0xff, 0xb7, 0xc4, 0xd1, 0xff, 0xdc, 0xdd, 0xd7, 0xff, 0xd5, 0xd6, 0xd8, 0xff, 0xd8, 0xda, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0x8b,
+    0xcd, 0xcf, 0xcf, 0xaa, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd1, 0xd5, 0xd6, 0xff, 0xcf, 0xd3, 0xd4, 0xff, 0xcc, 0xd0, 0xd1, 0xff, 0xc9, 0xcd, 0xce, 0xff, 0xc7, 0xcb, 0xcb, 0xff, 0xbf, 0xc6, 0xc6, 0xff, 0xbc, 0xc3, 0xc6, 0xff, 0xc1, 0xc5, 0xbf, 0xff, 0xa0, 0xa7, 0xa9, 0xff, 0x9d, 0xa8, 0xa0, 0xff, 0x90, 0x9f, 0xad, 0xff, 0x62, 0x7b, 0xab, 0xff, 0x64, 0x83, 0xac, 0xff, 0x63, 0x7f, 0xac, 0xff, 0x68, 0x88, 0xb6, 0xff, 0x9d, 0xbc, 0xe3, 0xff, 0x8a, 0xab, 0xd8, 0xff, 0x6f, 0x8e, 0xbc, 0xff, 0x44, 0x61, 0x90, 0xff, 0x23, 0x3a, 0x64, 0xff, 0x2d, 0x3c, 0x65, 0xff, 0x2e, 0x3c, 0x6b, 0xff, 0x2f, 0x3e, 0x73, 0xff, 0x30, 0x3f, 0x7f, 0xff, 0x2d, 0x3f, 0x88, 0xff, 0x2e, 0x45, 0x95, 0xff, 0x37, 0x4d, 0xa5, 0xff, 0x47, 0x5d, 0xb7, 0xff, 0x5b, 0x77, 0xc6, 0xff, 0x50, 0x6b, 0xc2, 0xff, 0x41, 0x58, 0xb5, 0xff, 0x36, 0x4e, 0xa8, 0xff, 0x35, 0x49, 0x99, 0xff, 0x35, 0x42, 0x8e, 0xff, 0x30, 0x3c, 0x87, 0xff, 0x20, 0x2c, 0x6e, 0xff, 0x20, 0x30, 0x69, 0xff, 0x46, 0x5a, 0x8f, 0xff, 0x77, 0x96, 0xc4, 0xff, 0x97, 0xb8, 0xdf, 0xff, 0x98, 0xb8, 0xdf, 0xff, 0x90, 0xb4, 0xde, 0xff, 0x77, 0x9a, 0xc3, 0xff, 0x6c, 0x8d, 0xb1, 0xff, 0x7f, 0x9d, 0xc2, 0xff, 0x90, 0xa7, 0xc7, 0xff, 0xae, 0xb8, 0xc4, 0xff, 0xa6, 0xab, 0xb4, 0xff, 0xbe, 0xc2, 0xc2, 0xff, 0xd9, 0xda, 0xd8, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd8, 0xda, 0xdb, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xda, 0xdc, 0xdd, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xcf, 0xcf, 0xab,
+    0xcd, 0xce, 0xce, 0xbe, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd7, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd1, 0xd5, 0xd6, 0xff, 0xce, 0xd2, 0xd3, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xca, 0xcd, 0xce, 0xff, 0xc6, 0xcb, 0xcc, 0xff, 0xbe, 0xc7, 0xc7, 0xff, 0xb9, 0xc2, 0xc1, 0xff, 0xb2, 0xbc, 0xbb, 0xff, 0xb4, 0xbd, 0xb9, 0xff, 0xb0, 0xb9, 0xb0, 0xff, 0x8d, 0x99, 0xa5, 0xff, 0x5d, 0x74, 0x9e, 0xff, 0x57, 0x77, 0xa4, 0xff, 0x6f, 0x8b, 0xb8, 0xff, 0x6d, 0x8e, 0xbb, 0xff, 0xa5, 0xc0, 0xe2, 0xff, 0xae, 0xcb, 0xec, 0xff, 0x8e, 0xb0, 0xd9, 0xff, 0x77, 0x94, 0xc3, 0xff, 0x47, 0x5f, 0x8d, 0xff, 0x27, 0x36, 0x5f, 0xff, 0x23, 0x2f, 0x5b, 0xff, 0x2d, 0x3d, 0x78, 0xff, 0x3e, 0x4e, 0x9a, 0xff, 0x5c, 0x6e, 0xb4, 0xff, 0x6d, 0x80, 0xc7, 0xff, 0x6b, 0x7d, 0xcf, 0xff, 0x6f, 0x7f, 0xcf, 0xff, 0x7e, 0x8e, 0xce, 0xff, 0x88, 0x97, 0xd6, 0xff, 0x86, 0x99, 0xde, 0xff, 0x82, 0x92, 0xd7, 0xff, 0x74, 0x82, 0xca, 0xff, 0x5b, 0x6e, 0xbf, 0xff, 0x52, 0x65, 0xb4, 0xff, 0x47, 0x58, 0x94, 0xff, 0x5a, 0x6e, 0xa5, 0xff, 0x8c, 0xab, 0xd8, 0xff, 0xa0, 0xc0, 0xe2, 0xff, 0xa1, 0xbf, 0xe3, 0xff, 0x85, 0xa7, 0xd2, 0xff, 0x89, 0xa9, 0xd3, 0xff, 0x79, 0x9a, 0xc4, 0xff, 0x77, 0x95, 0xbc, 0xff, 0x7c, 0x99, 0xbf, 0xff, 0x89, 0xa2, 0xc1, 0xff, 0xc5, 0xc9, 0xca, 0xff, 0xdc, 0xda, 0xd0, 0xff, 0xd1, 0xd3, 0xd1, 0xff, 0xcc, 0xd0, 0xd0, 0xff, 0xd1, 0xd4, 0xd6, 0xff, 0xd6, 0xd7, 0xd8, 0xff, 0xd8, 0xda, 0xdb, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xda, 0xdc, 0xdd, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xce, 0xce, 0xbe,
+    0xcd, 0xce, 0xce, 0xd3, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd7, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd1, 0xd5, 0xd6, 0xff, 0xce, 0xd2, 0xd3, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xca, 0xcd, 0xce, 0xff, 0xc6, 0xcb, 0xcc, 0xff, 0xc0, 0xc7, 0xc7, 0xff, 0xbb, 0xc2, 0xc2, 0xff, 0xb3, 0xbc, 0xbc, 0xff, 0xab, 0xb6, 0xb5, 0xff, 0xa8, 0xaf, 0xad, 0xff, 0x9b, 0xa4, 0xa8, 0xff, 0x60, 0x74, 0x96, 0xff, 0x49, 0x67, 0x96, 0xff, 0x67, 0x85, 0xb2, 0xff, 0x67, 0x88, 0xb4, 0xff, 0x82, 0xa2, 0xc7, 0xff, 0xbd, 0xd3, 0xf0, 0xff, 0xa6, 0xc2, 0xe4, 0xff, 0x9b, 0xba, 0xe2, 0xff, 0x96, 0xb7, 0xe5, 0xff, 0x84, 0xa0, 0xcf, 0xff, 0x7d, 0x96, 0xc9, 0xff, 0x79, 0x91, 0xd3, 0xff, 0x71, 0x8a, 0xd8, 0xff, 0x71, 0x8f, 0xe3, 0xff, 0x7f, 0x98, 0xf0, 0xff, 0x9a, 0xaf, 0xf8, 0xff, 0xb4, 0xc9, 0xf5, 0xff, 0xb9, 0xc4, 0xf2, 0xff, 0xb2, 0xc1, 0xf4, 0xff, 0xa3, 0xba, 0xf5, 0xff, 0x8d, 0xa4, 0xec, 0xff, 0x79, 0x92, 0xe0, 0xff, 0x7a, 0x93, 0xdf, 0xff, 0x8d, 0xa3, 0xe0, 0xff, 0x9a, 0xb1, 0xe1, 0xff, 0xa7, 0xbd, 0xe6, 0xff, 0x9f, 0xbb, 0xe0, 0xff, 0x9f, 0xbd, 0xe1, 0xff, 0xa9, 0xc2, 0xe3, 0xff, 0xae, 0xc6, 0xe6, 0xff, 0x96, 0xb2, 0xd6, 0xff, 0x7a, 0x96, 0xba, 0xff, 0x79, 0x98, 0xc2, 0xff, 0x71, 0x91, 0xba, 0xff, 0x98, 0xab, 0xbd, 0xff, 0xcd, 0xcc, 0xc7, 0xff, 0xc9, 0xcc, 0xcb, 0xff, 0xc8, 0xcd, 0xcf, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xd2, 0xd5, 0xd6, 0xff, 0xd6, 0xd7, 0xd8, 0xff, 0xd8, 0xda, 0xdb, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xda, 0xdc, 0xdd, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xdb, 0xdd, 0xdd, 0xff, 0xda, 0xdc, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xce, 0xce, 0xd3,
+    0xcd, 0xcf, 0xcf, 0xe7, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd6, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd3, 0xd4, 0xd5, 0xff, 0xd0, 0xd4, 0xd5, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xca, 0xce, 0xcf, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xc6, 0xca, 0xcb, 0xff, 0xc2, 0xc6, 0xc7, 0xff, 0xbd, 0xc1, 0xc2, 0xff, 0xb5, 0xbc, 0xbc, 0xff, 0xae, 0xb7, 0xb6, 0xff, 0xa8, 0xb0, 0xb0, 0xff, 0xa5, 0xac, 0xad, 0xff, 0x72, 0x83, 0x97, 0xff, 0x42, 0x5d, 0x82, 0xff, 0x59, 0x74, 0x9d, 0xff, 0x5f, 0x81, 0xa8, 0xff, 0x62, 0x83, 0xa8, 0xff, 0xa2, 0xba, 0xdf, 0xff, 0xba, 0xcf, 0xf2, 0xff, 0x99, 0xb9, 0xe0, 0xff, 0x8a, 0xa8, 0xd0, 0xff, 0x8c, 0xa7, 0xcd, 0xff, 0x83, 0x9e, 0xc6, 0xff, 0x86, 0x9b, 0xc9, 0xff, 0x89, 0x9d, 0xcf, 0xff, 0x81, 0x9a, 0xd7, 0xff, 0x82, 0x9b, 0xe1, 0xff, 0x8d, 0xa6, 0xe5, 0xff, 0x95, 0xb0, 0xe6, 0xff, 0x92, 0xad, 0xe8, 0xff, 0x8b, 0xa6, 0xe9, 0xff, 0x86, 0xa1, 0xe4, 0xff, 0x82, 0x9f, 0xe2, 0xff, 0x87, 0xa2, 0xdc, 0xff, 0x94, 0xab, 0xd9, 0xff, 0x99, 0xae, 0xd9, 0xff, 0x95, 0xad, 0xd5, 0xff, 0x98, 0xb2, 0xd4, 0xff, 0xa0, 0xba, 0xdd, 0xff, 0xaa, 0xc5, 0xea, 0xff, 0xae, 0xc7, 0xe6, 0xff, 0xb8, 0xce, 0xe9, 0xff, 0x88, 0xa3, 0xc8, 0xff, 0x75, 0x8f, 0xb5, 0xff, 0x6c, 0x8d, 0xb3, 0xff, 0x6e, 0x89, 0xac, 0xff, 0xb1, 0xb7, 0xc1, 0xff, 0xcb, 0xcd, 0xca, 0xff, 0xc6, 0xca, 0xcc, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xce, 0xd2, 0xd3, 0xff, 0xd2, 0xd5, 0xd6, 0xff, 0xd6, 0xd8, 0xd9, 0xff, 0xd7, 0xd9, 0xda, 0xff, 0xd7, 0xd9, 0xda, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xe6,
+    0xcd, 0xcf, 0xcf, 0xf0, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd6, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd3, 0xd4, 0xd5, 0xff, 0xd0, 0xd4, 0xd5, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xca, 0xce, 0xcf, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xc6, 0xca, 0xcb, 0xff, 0xc2, 0xc6, 0xc7, 0xff, 0xbd, 0xc1, 0xc2, 0xff, 0xb5, 0xbc, 0xbc, 0xff, 0xae, 0xb6, 0xb6, 0xff, 0xa5, 0xb0, 0xaf, 0xff, 0xa4, 0xac, 0xa8, 0xff, 0x93, 0x9d, 0xa3, 0xff, 0x4e, 0x60, 0x7b, 0xff, 0x44, 0x59, 0x78, 0xff, 0x59, 0x72, 0x95, 0xff, 0x50, 0x6f, 0x95, 0xff, 0x71, 0x94, 0xb9, 0xff, 0xad, 0xc9, 0xec, 0xff, 0xaa, 0xc4, 0xec, 0xff, 0x8e, 0xaa, 0xd4, 0xff, 0x7a, 0x97, 0xc0, 0xff, 0x74, 0x90, 0xb9, 0xff, 0x7a, 0x92, 0xbe, 0xff, 0x79, 0x8f, 0xc0, 0xff, 0x75, 0x8f, 0xb9, 0xff, 0x7f, 0x99, 0xc4, 0xff, 0x87, 0x9f, 0xd0, 0xff, 0x89, 0x9f, 0xd3, 0xff, 0x8e, 0xa5, 0xd9, 0xff, 0x8b, 0xa4, 0xd9, 0xff, 0x83, 0x9c, 0xd3, 0xff, 0x83, 0x9d, 0xd0, 0xff, 0x8c, 0xa7, 0xcd, 0xff, 0x8f, 0xa7, 0xcb, 0xff, 0x8a, 0xa2, 0xcc, 0xff, 0x8d, 0xa7, 0xca, 0xff, 0x98, 0xb4, 0xd3, 0xff, 0xa5, 0xc1, 0xdf, 0xff, 0xad, 0xc8, 0xe6, 0xff, 0xa5, 0xc0, 0xe3, 0xff, 0x83, 0xa1, 0xc8, 0xff, 0x69, 0x85, 0xaa, 0xff, 0x64, 0x80, 0xa6, 0xff, 0x58, 0x72, 0x99, 0xff, 0x84, 0x95, 0xac, 0xff, 0xc7, 0xca, 0xc9, 0xff, 0xc7, 0xca, 0xc9, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xce, 0xd2, 0xd3, 0xff, 0xd2, 0xd5, 0xd6, 0xff, 0xd6, 0xd8, 0xd9, 0xff, 0xd7, 0xd9, 0xda, 0xff, 0xd7, 0xd9, 0xda, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xf0,
+    0xcc, 0xce, 0xce, 0xf3, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd3, 0xd5, 0xd6, 0xff, 0xd2, 0xd4, 0xd5, 0xff, 0xd1, 0xd5, 0xd6, 0xff, 0xd0, 0xd3, 0xd4, 0xff, 0xce, 0xd2, 0xd3, 0xff, 0xcc, 0xd0, 0xd1, 0xff, 0xca, 0xce, 0xcf, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xc5, 0xc9, 0xca, 0xff, 0xbf, 0xc6, 0xc6, 0xff, 0xbb, 0xc2, 0xc2, 0xff, 0xb5, 0xbc, 0xbc, 0xff, 0xae, 0xb6, 0xb6, 0xff, 0xa7, 0xb0, 0xb0, 0xff, 0x9f, 0xa9, 0xa7, 0xff, 0xa2, 0xab, 0xa8, 0xff, 0x76, 0x84, 0x90, 0xff, 0x39, 0x49, 0x65, 0xff, 0x43, 0x53, 0x76, 0xff, 0x47, 0x5c, 0x7c, 0xff, 0x48, 0x65, 0x86, 0xff, 0x91, 0xae, 0xd4, 0xff, 0xae, 0xc9, 0xee, 0xff, 0x7c, 0x9d, 0xca, 0xff, 0x72, 0x90, 0xb9, 0xff, 0x76, 0x90, 0xb6, 0xff, 0x6d, 0x87, 0xb3, 0xff, 0x71, 0x8b, 0xb8, 0xff, 0x6a, 0x86, 0xb1, 0xff, 0x66, 0x82, 0xac, 0xff, 0x6d, 0x85, 0xb3, 0xff, 0x77, 0x8c, 0xbd, 0xff, 0x82, 0x98, 0xc9, 0xff, 0x83, 0x99, 0xcd, 0xff, 0x80, 0x98, 0xc8, 0xff, 0x85, 0x9d, 0xc9, 0xff, 0x88, 0x9f, 0xc9, 0xff, 0x8d, 0xa5, 0xce, 0xff, 0x8a, 0xa5, 0xca, 0xff, 0x90, 0xad, 0xcc, 0xff, 0x9b, 0xb7, 0xd7, 0xff, 0x9f, 0xba, 0xdb, 0xff, 0x9c, 0xba, 0xdb, 0xff, 0x7c, 0x9b, 0xc0, 0xff, 0x56, 0x72, 0x9a, 0xff, 0x50, 0x69, 0x8d, 0xff, 0x4f, 0x66, 0x88, 0xff, 0x5d, 0x71, 0x8f, 0xff, 0xac, 0xb2, 0xbc, 0xff, 0xca, 0xcb, 0xca, 0xff, 0xc5, 0xc9, 0xc9, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xce, 0xd2, 0xd3, 0xff, 0xd2, 0xd5, 0xd6, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd7, 0xd9, 0xda, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcb, 0xcd, 0xcd, 0xf3,
+    0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd3, 0xd5, 0xd6, 0xff, 0xd2, 0xd4, 0xd5, 0xff, 0xd0, 0xd5, 0xd6, 0xff, 0xcf, 0xd3, 0xd4, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xcc, 0xd0, 0xd1, 0xff, 0xca, 0xce, 0xcf, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xc5, 0xc9, 0xca, 0xff, 0xbd, 0xc6, 0xc6, 0xff, 0xb9, 0xc2, 0xc2, 0xff, 0xb5, 0xbd, 0xbd, 0xff, 0xaf, 0xb7, 0xb7, 0xff, 0xaa, 0xb2, 0xb2, 0xff, 0xa0, 0xaa, 0xab, 0xff, 0x9b, 0xa4, 0xa3, 0xff, 0x94, 0xa2, 0xa5, 0xff, 0x5a, 0x67, 0x7d, 0xff, 0x34, 0x3f, 0x5d, 0xff, 0x3a, 0x49, 0x62, 0xff, 0x36, 0x4a, 0x61, 0xff, 0x5a, 0x78, 0x9d, 0xff, 0xb3, 0xcb, 0xf3, 0xff, 0xac, 0xc1, 0xe2, 0xff, 0x7a, 0x95, 0xbb, 0xff, 0x77, 0x93, 0xb9, 0xff, 0x73, 0x90, 0xb8, 0xff, 0x77, 0x94, 0xbb, 0xff, 0x82, 0x9b, 0xc7, 0xff, 0x7e, 0x95, 0xc1, 0xff, 0x7a, 0x91, 0xbf, 0xff, 0x7e, 0x94, 0xc5, 0xff, 0x81, 0x97, 0xc8, 0xff, 0x85, 0x9c, 0xcd, 0xff, 0x8d, 0xa7, 0xd2, 0xff, 0x92, 0xad, 0xd2, 0xff, 0x93, 0xac, 0xd0, 0xff, 0x90, 0xa9, 0xd1, 0xff, 0x88, 0xa3, 0xc9, 0xff, 0x8b, 0xa8, 0xc8, 0xff, 0x91, 0xad, 0xcf, 0xff, 0x95, 0xb1, 0xd5, 0xff, 0x7f, 0x9d, 0xbe, 0xff, 0x54, 0x6f, 0x8f, 0xff, 0x48, 0x5d, 0x7f, 0xff, 0x49, 0x5d, 0x7d, 0xff, 0x4d, 0x60, 0x7e, 0xff, 0x89, 0x97, 0xa7, 0xff, 0xc5, 0xc8, 0xc5, 0xff, 0xc0, 0xc5, 0xc6, 0xff, 0xc5, 0xc9, 0xca, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xce, 0xd2, 0xd3, 0xff, 0xd2, 0xd5, 0xd6, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd7, 0xd9, 0xda, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff,
+    0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd3, 0xd5, 0xd6, 0xff, 0xd2, 0xd4, 0xd5, 0xff, 0xd0, 0xd5, 0xd6, 0xff, 0xcf, 0xd3, 0xd4, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xcc, 0xd0, 0xd1, 0xff, 0xca, 0xce, 0xcf, 0xff, 0xc7, 0xcb, 0xcc, 0xff, 0xc5, 0xc9, 0xca, 0xff, 0xbf, 0xc6, 0xc6, 0xff, 0xbc, 0xc2, 0xc2, 0xff, 0xb7, 0xbe, 0xbe, 0xff, 0xb2, 0xba, 0xba, 0xff, 0xaa, 0xb3, 0xb3, 0xff, 0xa2, 0xac, 0xac, 0xff, 0x99, 0xa4, 0xa2, 0xff, 0x99, 0xa3, 0xa1, 0xff, 0x84, 0x90, 0x9b, 0xff, 0x47, 0x53, 0x6b, 0xff, 0x36, 0x45, 0x5f, 0xff, 0x3f, 0x51, 0x66, 0xff, 0x39, 0x50, 0x70, 0xff, 0x7b, 0x98, 0xbc, 0xff, 0xc6, 0xdc, 0xf8, 0xff, 0xa8, 0xc0, 0xe3, 0xff, 0x82, 0xa0, 0xc5, 0xff, 0x86, 0xa6, 0xc9, 0xff, 0x8d, 0xac, 0xcf, 0xff, 0x95, 0xb0, 0xd9, 0xff, 0x95, 0xaf, 0xdb, 0xff, 0x93, 0xac, 0xd9, 0xff, 0x91, 0xaa, 0xdb, 0xff, 0x94, 0xae, 0xdf, 0xff, 0x9a, 0xb1, 0xdd, 0xff, 0x9e, 0xb5, 0xdb, 0xff, 0xa1, 0xbb, 0xde, 0xff, 0x9b, 0xb6, 0xd8, 0xff, 0x91, 0xac, 0xd1, 0xff, 0x8c, 0xa9, 0xce, 0xff, 0x92, 0xb0, 0xd1, 0xff, 0x98, 0xb4, 0xd5, 0xff, 0x87, 0xa3, 0xc4, 0xff, 0x5f, 0x7b, 0x9c, 0xff, 0x56, 0x70, 0x90, 0xff, 0x5a, 0x70, 0x8d, 0xff, 0x49, 0x60, 0x7d, 0xff, 0x6a, 0x7b, 0x93, 0xff, 0xba, 0xc0, 0xc2, 0xff, 0xc4, 0xc8, 0xc2, 0xff, 0xbf, 0xc5, 0xc5, 0xff, 0xc4, 0xc8, 0xca, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xcd, 0xd2, 0xd3, 0xff, 0xd1, 0xd4, 0xd5, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd7, 0xd9, 0xda, 0xff, 0xd9, 0xdb, 0xdc, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd9, 0xdb, 0xdb, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff,
+    0xcc, 0xce, 0xce, 0xf3, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd5, 0xd7, 0xff, 0xd2, 0xd4, 0xd5, 0xff, 0xcf, 0xd4, 0xd5, 0xff, 0xce, 0xd2, 0xd3, 0xff, 0xcc, 0xd0, 0xd1, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xc9, 0xcd, 0xce, 0xff, 0xc6, 0xca, 0xcb, 0xff, 0xc4, 0xc8, 0xc9, 0xff, 0xc1, 0xc5, 0xc6, 0xff, 0xbf, 0xc1, 0xc2, 0xff, 0xb8, 0xbe, 0xbe, 0xff, 0xb2, 0xba, 0xba, 0xff, 0xac, 0xb4, 0xb4, 0xff, 0xa4, 0xaf, 0xac, 0xff, 0x9e, 0xa9, 0xa6, 0xff, 0x96, 0xa1, 0x9e, 0xff, 0x91, 0x9c, 0x9f, 0xff, 0x74, 0x82, 0x8d, 0xff, 0x43, 0x54, 0x68, 0xff, 0x46, 0x5a, 0x73, 0xff, 0x42, 0x59, 0x72, 0xff, 0x49, 0x64, 0x7f, 0xff, 0x8c, 0xa9, 0xcc, 0xff, 0xab, 0xc7, 0xe9, 0xff, 0x9d, 0xb9, 0xdb, 0xff, 0x98, 0xb7, 0xd9, 0xff, 0xa0, 0xbf, 0xe1, 0xff, 0xa4, 0xbd, 0xe6, 0xff, 0xa2, 0xb9, 0xe4, 0xff, 0x9f, 0xb7, 0xe0, 0xff, 0x95, 0xaf, 0xda, 0xff, 0x88, 0xa7, 0xd9, 0xff, 0x89, 0xa8, 0xda, 0xff, 0x99, 0xb1, 0xde, 0xff, 0xa4, 0xbd, 0xe3, 0xff, 0xa3, 0xbd, 0xe2, 0xff, 0x9c, 0xb8, 0xdb, 0xff, 0xa1, 0xbd, 0xdf, 0xff, 0xa2, 0xbd, 0xe0, 0xff, 0x97, 0xb2, 0xd2, 0xff, 0x7a, 0x96, 0xb4, 0xff, 0x67, 0x85, 0xa5, 0xff, 0x71, 0x8c, 0xac, 0xff, 0x5f, 0x79, 0x93, 0xff, 0x5c, 0x74, 0x8b, 0xff, 0xaa, 0xb4, 0xbd, 0xff, 0xc7, 0xc8, 0xc6, 0xff, 0xbd, 0xc1, 0xc2, 0xff, 0xc3, 0xc6, 0xc8, 0xff, 0xc5, 0xc9, 0xca, 0xff, 0xc7, 0xcb, 0xcc, 0xff, 0xca, 0xce, 0xcf, 0xff, 0xcc, 0xd1, 0xd2, 0xff, 0xd0, 0xd3, 0xd4, 0xff, 0xd3, 0xd5, 0xd6, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd6, 0xd8, 0xd9, 0xff, 0xd8, 0xda, 0xdb, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcb, 0xcd, 0xcd, 0xf3,
+    0xcd, 0xcf, 0xcf, 0xf0, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd5, 0xd7, 0xff, 0xd2, 0xd4, 0xd5, 0xff, 0xcf, 0xd4, 0xd5, 0xff, 0xce, 0xd2, 0xd3, 0xff, 0xcc, 0xd0, 0xd1, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xc9, 0xcd, 0xce, 0xff, 0xc6, 0xca, 0xcb, 0xff, 0xc4, 0xc8, 0xc9, 0xff, 0xc1, 0xc5, 0xc6, 0xff, 0xbe, 0xc1, 0xc2, 0xff, 0xb8, 0xbe, 0xbe, 0xff, 0xb1, 0xb9, 0xba, 0xff, 0xac, 0xb5, 0xb5, 0xff, 0xa7, 0xb2, 0xb0, 0xff, 0xa0, 0xab, 0xa9, 0xff, 0x93, 0xa4, 0xa3, 0xff, 0x8e, 0x99, 0x98, 0xff, 0x95, 0xa1, 0x9e, 0xff, 0x7d, 0x8e, 0x95, 0xff, 0x46, 0x53, 0x69, 0xff, 0x4f, 0x62, 0x77, 0xff, 0x50, 0x67, 0x80, 0xff, 0x55, 0x70, 0x91, 0xff, 0x87, 0xa6, 0xc9, 0xff, 0xa0, 0xbc, 0xdf, 0xff, 0xa5, 0xbc, 0xe0, 0xff, 0xa8, 0xc1, 0xe5, 0xff, 0xab, 0xc0, 0xe9, 0xff, 0xac, 0xc0, 0xeb, 0xff, 0xb0, 0xc3, 0xea, 0xff, 0xa5, 0xbb, 0xe0, 0xff, 0x8a, 0xa3, 0xcf, 0xff, 0x87, 0xa2, 0xd0, 0xff, 0x9e, 0xb6, 0xdf, 0xff, 0xa7, 0xbf, 0xe6, 0xff, 0xa5, 0xbf, 0xe5, 0xff, 0xa5, 0xbe, 0xe2, 0xff, 0xae, 0xc4, 0xe6, 0xff, 0xa6, 0xbc, 0xde, 0xff, 0x88, 0xa4, 0xc3, 0xff, 0x7a, 0x98, 0xb8, 0xff, 0x83, 0x9d, 0xbd, 0xff, 0x6f, 0x86, 0xa0, 0xff, 0x59, 0x6e, 0x86, 0xff, 0x9b, 0xa6, 0xb3, 0xff, 0xca, 0xca, 0xca, 0xff, 0xbc, 0xc0, 0xc1, 0xff, 0xbf, 0xc4, 0xc4, 0xff, 0xc3, 0xc7, 0xc8, 0xff, 0xc5, 0xc9, 0xca, 0xff, 0xc7, 0xcb, 0xcc, 0xff, 0xca, 0xce, 0xcf, 0xff, 0xcc, 0xd1, 0xd2, 0xff, 0xd0, 0xd3, 0xd4, 0xff, 0xd3, 0xd5, 0xd6, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd6, 0xd8, 0xd9, 0xff, 0xd8, 0xda, 0xdb, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xf0,
+    0xcd, 0xcf, 0xcf, 0xe7, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd5, 0xff, 0xd3, 0xd4, 0xd5, 0xff, 0xd0, 0xd3, 0xd4, 0xff, 0xce, 0xd2, 0xd3, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xc9, 0xcd, 0xce, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xc5, 0xc9, 0xca, 0xff, 0xc3, 0xc7, 0xc8, 0xff, 0xc1, 0xc5, 0xc6, 0xff, 0xbe, 0xc1, 0xc2, 0xff, 0xb7, 0xbe, 0xbe, 0xff, 0xb1, 0xb9, 0xba, 0xff, 0xae, 0xb6, 0xb6, 0xff, 0xa8, 0xb3, 0xb1, 0xff, 0xa1, 0xac, 0xaa, 0xff, 0x9a, 0xa5, 0xa5, 0xff, 0x9a, 0xa3, 0xa2, 0xff, 0x8f, 0x9a, 0x9a, 0xff, 0x67, 0x71, 0x75, 0xff, 0x54, 0x63, 0x76, 0xff, 0x42, 0x52, 0x67, 0xff, 0x52, 0x69, 0x80, 0xff, 0x4d, 0x67, 0x81, 0xff, 0x5b, 0x79, 0x95, 0xff, 0x87, 0xa5, 0xc7, 0xff, 0x9d, 0xb6, 0xdd, 0xff, 0xa1, 0xbb, 0xe0, 0xff, 0xa7, 0xc0, 0xe5, 0xff, 0xa6, 0xc0, 0xe5, 0xff, 0xaa, 0xc2, 0xe8, 0xff, 0xb0, 0xc3, 0xe8, 0xff, 0xb0, 0xc1, 0xe2, 0xff, 0xb3, 0xc5, 0xe7, 0xff, 0xab, 0xc1, 0xe9, 0xff, 0xa5, 0xbd, 0xe7, 0xff, 0xa1, 0xbb, 0xe1, 0xff, 0xa4, 0xbc, 0xe0, 0xff, 0xab, 0xbf, 0xe1, 0xff, 0x9d, 0xb5, 0xd2, 0xff, 0x82, 0x9e, 0xbb, 0xff, 0x7e, 0x98, 0xb5, 0xff, 0x6b, 0x81, 0x9f, 0xff, 0x4e, 0x61, 0x7a, 0xff, 0x68, 0x79, 0x8f, 0xff, 0xb7, 0xc5, 0xd2, 0xff, 0xd7, 0xdb, 0xdc, 0xff, 0xbe, 0xc2, 0xc3, 0xff, 0xbf, 0xc3, 0xc4, 0xff, 0xc3, 0xc7, 0xc8, 0xff, 0xc6, 0xca, 0xcb, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xce, 0xd2, 0xd3, 0xff, 0xd1, 0xd4, 0xd5, 0xff, 0xd3, 0xd5, 0xd6, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd6, 0xd8, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xe6,
+    0xcd, 0xce, 0xce, 0xd3, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd5, 0xff, 0xd3, 0xd4, 0xd5, 0xff, 0xd0, 0xd3, 0xd4, 0xff, 0xce, 0xd2, 0xd3, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xc9, 0xcd, 0xce, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xc5, 0xc9, 0xca, 0xff, 0xc3, 0xc7, 0xc8, 0xff, 0xc1, 0xc5, 0xc6, 0xff, 0xbd, 0xc1, 0xc2, 0xff, 0xb7, 0xbe, 0xbf, 0xff, 0xb3, 0xbb, 0xbc, 0xff, 0xaf, 0xb8, 0xb8, 0xff, 0xa8, 0xb4, 0xb2, 0xff, 0xa1, 0xad, 0xaa, 0xff, 0x9e, 0xa7, 0xa8, 0xff, 0xaa, 0xb8, 0xb9, 0xff, 0x49, 0x4a, 0x46, 0xff, 0x07, 0x04, 0x02, 0xff, 0x5e, 0x77, 0x8b, 0xff, 0x41, 0x53, 0x6a, 0xff, 0x34, 0x43, 0x51, 0xff, 0x45, 0x56, 0x69, 0xff, 0x48, 0x5d, 0x77, 0xff, 0x61, 0x7b, 0x9b, 0xff, 0x82, 0xa0, 0xc8, 0xff, 0x94, 0xb0, 0xd5, 0xff, 0x97, 0xb0, 0xdb, 0xff, 0x94, 0xac, 0xd7, 0xff, 0x94, 0xae, 0xdb, 0xff, 0x9e, 0xb7, 0xe0, 0xff, 0xb0, 0xc3, 0xe8, 0xff, 0xaa, 0xbf, 0xe7, 0xff, 0x96, 0xb2, 0xe0, 0xff, 0x92, 0xac, 0xda, 0xff, 0x98, 0xb2, 0xd8, 0xff, 0x9e, 0xb8, 0xdb, 0xff, 0x9e, 0xb4, 0xd7, 0xff, 0x7f, 0x9a, 0xb7, 0xff, 0x64, 0x80, 0x98, 0xff, 0x51, 0x66, 0x7e, 0xff, 0x3a, 0x4d, 0x62, 0xff, 0x4c, 0x62, 0x77, 0xff, 0x75, 0x94, 0xb4, 0xff, 0x7d, 0x8c, 0x99, 0xff, 0x9e, 0x9b, 0x90, 0xff, 0xcb, 0xd3, 0xd5, 0xff, 0xc3, 0xc7, 0xc9, 0xff, 0xc5, 0xc8, 0xc9, 0xff, 0xc6, 0xca, 0xcb, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xce, 0xd2, 0xd3, 0xff, 0xd1, 0xd4, 0xd5, 0xff, 0xd3, 0xd5, 0xd6, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd6, 0xd8, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd8, 0xda, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xcd, 0xcd, 0xd3,
+    0xcc, 0xcd, 0xcd, 0xbe, 0xcc, 0xce, 0xce, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd3, 0xd4, 0xff, 0xcf, 0xd2, 0xd3, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xcc, 0xd0, 0xd1, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xc9, 0xcd, 0xce, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xc6, 0xca, 0xcb, 0xff, 0xc4, 0xc8, 0xc9, 0xff, 0xc2, 0xc6, 0xc7, 0xff, 0xbe, 0xc2, 0xc3, 0xff, 0xb9, 0xc0, 0xc0, 0xff, 0xb4, 0xbc, 0xbc, 0xff, 0xb0, 0xb9, 0xb8, 0xff, 0xad, 0xb6, 0xb4, 0xff, 0xa3, 0xad, 0xae, 0xff, 0xab, 0xb7, 0xb5, 0xff, 0x8a, 0x94, 0x94, 0xff, 0x03, 0x00, 0x00, 0xff, 0x10, 0x0d, 0x07, 0xff, 0x5f, 0x7e, 0x94, 0xff, 0x4b, 0x60, 0x7a, 0xff, 0x2e, 0x3a, 0x49, 0xff, 0x29, 0x31, 0x3d, 0xff, 0x2e, 0x3c, 0x4e, 0xff, 0x3a, 0x4c, 0x67, 0xff, 0x54, 0x69, 0x8e, 0xff, 0x6c, 0x88, 0xb3, 0xff, 0x7a, 0x95, 0xc4, 0xff, 0x79, 0x93, 0xc2, 0xff, 0x78, 0x94, 0xc3, 0xff, 0x7d, 0x99, 0xc6, 0xff, 0x7f, 0x9a, 0xc6, 0xff, 0x72, 0x8f, 0xbd, 0xff, 0x66, 0x85, 0xb5, 0xff, 0x69, 0x85, 0xb3, 0xff, 0x6d, 0x88, 0xb3, 0xff, 0x6b, 0x86, 0xaf, 0xff, 0x60, 0x79, 0x9a, 0xff, 0x49, 0x5f, 0x76, 0xff, 0x37, 0x49, 0x5a, 0xff, 0x2b, 0x3b, 0x50, 0xff, 0x3d, 0x52, 0x69, 0xff, 0x5c, 0x7a, 0x92, 0xff, 0x8a, 0xad, 0xcf, 0xff, 0x46, 0x51, 0x5d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x86, 0x81, 0x7b, 0xff, 0xda, 0xe0, 0xe1, 0xff, 0xc3, 0xc8, 0xc8, 0xff, 0xc7, 0xcb, 0xcc, 0xff, 0xc9, 0xcd, 0xce, 0xff, 0xcc, 0xd0, 0xd1, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xd0, 0xd3, 0xd4, 0xff, 0xd4, 0xd5, 0xd6, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd4, 0xd6, 0xd8, 0xff, 0xd7, 0xd9, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xcd, 0xcd, 0xbe,
+    0xcc, 0xcd, 0xcd, 0xaa, 0xcc, 0xce, 0xce, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd4, 0xff, 0xcf, 0xd1, 0xd2, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xc9, 0xcd, 0xce, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xc7, 0xcb, 0xcc, 0xff, 0xc4, 0xc8, 0xc9, 0xff, 0xc2, 0xc6, 0xc7, 0xff, 0xbf, 0xc2, 0xc4, 0xff, 0xba, 0xc1, 0xc1, 0xff, 0xb4, 0xbe, 0xbe, 0xff, 0xb1, 0xb9, 0xb9, 0xff, 0xaf, 0xb6, 0xb5, 0xff, 0xa8, 0xb1, 0xb2, 0xff, 0xb5, 0xbd, 0xb7, 0xff, 0x5b, 0x5c, 0x60, 0xff, 0x03, 0x00, 0x00, 0xff, 0x1c, 0x21, 0x1e, 0xff, 0x60, 0x81, 0x9b, 0xff, 0x4f, 0x67, 0x85, 0xff, 0x3f, 0x4d, 0x66, 0xff, 0x2b, 0x33, 0x40, 0xff, 0x1d, 0x24, 0x2b, 0xff, 0x1d, 0x26, 0x32, 0xff, 0x22, 0x2d, 0x43, 0xff, 0x2d, 0x40, 0x5c, 0xff, 0x3d, 0x51, 0x72, 0xff, 0x42, 0x55, 0x77, 0xff, 0x3d, 0x4f, 0x70, 0xff, 0x3b, 0x4d, 0x6e, 0xff, 0x35, 0x48, 0x68, 0xff, 0x2c, 0x3e, 0x5c, 0xff, 0x2b, 0x3b, 0x58, 0xff, 0x2f, 0x40, 0x5a, 0xff, 0x2f, 0x42, 0x5c, 0xff, 0x2e, 0x3d, 0x57, 0xff, 0x2a, 0x35, 0x4a, 0xff, 0x26, 0x32, 0x3f, 0xff, 0x26, 0x34, 0x46, 0xff, 0x3a, 0x4b, 0x65, 0xff, 0x56, 0x70, 0x8d, 0xff, 0x6c, 0x8b, 0xa6, 0xff, 0x8f, 0xb0, 0xcf, 0xff, 0x4b, 0x5b, 0x6b, 0xff, 0x00, 0x00, 0x00, 0xff, 0x32, 0x1e, 0x09, 0xff, 0xbd, 0xbd, 0xb8, 0xff, 0xd1, 0xd9, 0xda, 0xff, 0xc7, 0xcb, 0xcc, 0xff, 0xca, 0xcf, 0xd0, 0xff, 0xcc, 0xd0, 0xd1, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xd0, 0xd3, 0xd4, 0xff, 0xd4, 0xd5, 0xd6, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd4, 0xd6, 0xd8, 0xff, 0xd7, 0xd9, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xcd, 0xcd, 0xab,
+    0xcb, 0xcd, 0xcd, 0x8b, 0xcc, 0xce, 0xce, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd0, 0xd3, 0xd4, 0xff, 0xce, 0xd1, 0xd2, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xc9, 0xcd, 0xce, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xc7, 0xcb, 0xcc, 0xff, 0xc4, 0xc8, 0xc9, 0xff, 0xc2, 0xc6, 0xc7, 0xff, 0xbf, 0xc2, 0xc3, 0xff, 0xbc, 0xc1, 0xc2, 0xff, 0xb7, 0xbe, 0xbf, 0xff, 0xb3, 0xba, 0xba, 0xff, 0xae, 0xb6, 0xb5, 0xff, 0xb2, 0xbb, 0xba, 0xff, 0xa1, 0xb0, 0xaf, 0xff, 0x41, 0x46, 0x4a, 0xff, 0x12, 0x08, 0x00, 0xff, 0x22, 0x2a, 0x2c, 0xff, 0x62, 0x85, 0xa3, 0xff, 0x52, 0x6d, 0x8c, 0xff, 0x47, 0x5c, 0x77, 0xff, 0x3e, 0x4f, 0x67, 0xff, 0x2b, 0x37, 0x49, 0xff, 0x1b, 0x24, 0x30, 0xff, 0x14, 0x1c, 0x25, 0xff, 0x13, 0x19, 0x1e, 0xff, 0x12, 0x16, 0x21, 0xff, 0x17, 0x1a, 0x27, 0xff, 0x19, 0x1f, 0x2c, 0xff, 0x17, 0x1f, 0x2e, 0xff, 0x17, 0x1e, 0x2e, 0xff, 0x18, 0x1d, 0x2d, 0xff, 0x14, 0x1b, 0x2b, 0xff, 0x16, 0x1f, 0x2d, 0xff, 0x15, 0x22, 0x2e, 0xff, 0x20, 0x29, 0x38, 0xff, 0x29, 0x2e, 0x41, 0xff, 0x29, 0x37, 0x4c, 0xff, 0x3c, 0x52, 0x6b, 0xff, 0x5d, 0x74, 0x91, 0xff, 0x70, 0x8c, 0xa9, 0xff, 0x79, 0x97, 0xb2, 0xff, 0x8a, 0xae, 0xd2, 0xff, 0x4a, 0x5b, 0x6d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0e, 0x03, 0x00, 0xff, 0x73, 0x79, 0x77, 0xff, 0xd3, 0xdc, 0xdd, 0xff, 0xca, 0xce, 0xcf, 0xff, 0xca, 0xcd, 0xce, 0xff, 0xcc, 0xd0, 0xd1, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xd0, 0xd3, 0xd4, 0xff, 0xd4, 0xd5, 0xd6, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd4, 0xd6, 0xd8, 0xff, 0xd7, 0xd9, 0xda, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcb, 0xcd, 0xcd, 0x8b,
+    0xcc, 0xcc, 0xcc, 0x6b, 0xcc, 0xce, 0xce, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd5, 0xff, 0xd3, 0xd4, 0xd5, 0xff, 0xd0, 0xd3, 0xd4, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xcc, 0xd0, 0xd1, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xc9, 0xcd, 0xce, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xc6, 0xca, 0xcb, 0xff, 0xc5, 0xc9, 0xca, 0xff, 0xc3, 0xc7, 0xc8, 0xff, 0xc0, 0xc4, 0xc5, 0xff, 0xbd, 0xc1, 0xc2, 0xff, 0xbb, 0xbe, 0xbf, 0xff, 0xb7, 0xbc, 0xbc, 0xff, 0xb1, 0xba, 0xba, 0xff, 0xc1, 0xc7, 0xc7, 0xff, 0x76, 0x79, 0x78, 0xff, 0x15, 0x20, 0x1f, 0xff, 0x0b, 0x0c, 0x0d, 0xff, 0x24, 0x32, 0x3e, 0xff, 0x55, 0x7d, 0xa1, 0xff, 0x53, 0x70, 0x8d, 0xff, 0x4b, 0x65, 0x85, 0xff, 0x40, 0x55, 0x74, 0xff, 0x3b, 0x4c, 0x67, 0xff, 0x32, 0x41, 0x56, 0xff, 0x26, 0x32, 0x40, 0xff, 0x1a, 0x22, 0x2c, 0xff, 0x15, 0x19, 0x1d, 0xff, 0x10, 0x13, 0x17, 0xff, 0x0f, 0x14, 0x16, 0xff, 0x0f, 0x15, 0x19, 0xff, 0x13, 0x15, 0x1f, 0xff, 0x16, 0x16, 0x20, 0xff, 0x16, 0x1d, 0x24, 0xff, 0x1d, 0x28, 0x33, 0xff, 0x27, 0x35, 0x48, 0xff, 0x34, 0x44, 0x5a, 0xff, 0x3d, 0x4e, 0x68, 0xff, 0x49, 0x61, 0x79, 0xff, 0x5f, 0x7c, 0x97, 0xff, 0x71, 0x8e, 0xa9, 0xff, 0x7a, 0x98, 0xb7, 0xff, 0x7a, 0x99, 0xbc, 0xff, 0x8a, 0xad, 0xcf, 0xff, 0x48, 0x66, 0x86, 0xff, 0x00, 0x02, 0x0a, 0xff, 0x14, 0x05, 0x00, 0xff, 0x2a, 0x18, 0x04, 0xff, 0xa5, 0xaa, 0xab, 0xff, 0xd9, 0xde, 0xe2, 0xff, 0xca, 0xce, 0xcf, 0xff, 0xcc, 0xd1, 0xd2, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xd0, 0xd3, 0xd4, 0xff, 0xd3, 0xd5, 0xd6, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd6, 0xd8, 0xd9, 0xff, 0xd6, 0xd8, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0x6b,
+    0xcc, 0xcf, 0xcf, 0x4b, 0xcc, 0xce, 0xce, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd5, 0xff, 0xd3, 0xd4, 0xd5, 0xff, 0xd0, 0xd3, 0xd4, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xcc, 0xd0, 0xd1, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xc9, 0xcd, 0xce, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xc6, 0xca, 0xcb, 0xff, 0xc5, 0xc9, 0xca, 0xff, 0xc3, 0xc7, 0xc8, 0xff, 0xbf, 0xc3, 0xc4, 0xff, 0xbe, 0xc2, 0xc3, 0xff, 0xbc, 0xc0, 0xc1, 0xff, 0xb7, 0xbd, 0xbe, 0xff, 0xb3, 0xbd, 0xbe, 0xff, 0xbe, 0xc0, 0xbb, 0xff, 0x56, 0x61, 0x64, 0xff, 0x12, 0x3b, 0x55, 0xff, 0x14, 0x26, 0x31, 0xff, 0x1f, 0x2e, 0x3b, 0xff, 0x46, 0x6c, 0x8d, 0xff, 0x51, 0x6e, 0x92, 0xff, 0x55, 0x6b, 0x91, 0xff, 0x4b, 0x65, 0x87, 0xff, 0x40, 0x5b, 0x77, 0xff, 0x3a, 0x51, 0x6a, 0xff, 0x33, 0x46, 0x5f, 0xff, 0x2e, 0x3e, 0x51, 0xff, 0x28, 0x34, 0x42, 0xff, 0x1c, 0x28, 0x36, 0xff, 0x1c, 0x26, 0x33, 0xff, 0x22, 0x28, 0x37, 0xff, 0x26, 0x2b, 0x3f, 0xff, 0x2a, 0x31, 0x45, 0xff, 0x33, 0x41, 0x52, 0xff, 0x3f, 0x51, 0x66, 0xff, 0x4a, 0x5f, 0x7a, 0xff, 0x4e, 0x65, 0x85, 0xff, 0x59, 0x71, 0x93, 0xff, 0x64, 0x82, 0xa3, 0xff, 0x6e, 0x8e, 0xaf, 0xff, 0x74, 0x95, 0xb5, 0xff, 0x7c, 0x9b, 0xbd, 0xff, 0x80, 0x9d, 0xbe, 0xff, 0x8b, 0xad, 0xcc, 0xff, 0x47, 0x67, 0x8a, 0xff, 0x02, 0x0d, 0x21, 0xff, 0x3f, 0x45, 0x4b, 0xff, 0x23, 0x24, 0x22, 0xff, 0x73, 0x75, 0x71, 0xff, 0xde, 0xe2, 0xe3, 0xff, 0xcb, 0xd0, 0xd1, 0xff, 0xcc, 0xd0, 0xd1, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xd0, 0xd3, 0xd4, 0xff, 0xd3, 0xd5, 0xd6, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd6, 0xd8, 0xd9, 0xff, 0xd6, 0xd8, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd7, 0xd9, 0xd9, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xcf, 0xcf, 0x4b,
+    0xc8, 0xd0, 0xd0, 0x21, 0xcc, 0xce, 0xce, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd4, 0xff, 0xd2, 0xd3, 0xd4, 0xff, 0xcf, 0xd2, 0xd3, 0xff, 0xcc, 0xd1, 0xd2, 0xff, 0xcd, 0xd1, 0xd2, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xca, 0xce, 0xcf, 0xff, 0xc9, 0xcd, 0xce, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xc7, 0xcb, 0xcc, 0xff, 0xc6, 0xca, 0xcb, 0xff, 0xc5, 0xc9, 0xca, 0xff, 0xc4, 0xc8, 0xc9, 0xff, 0xc0, 0xc4, 0xc5, 0xff, 0xbf, 0xc3, 0xc4, 0xff, 0xbd, 0xc0, 0xc1, 0xff, 0xb8, 0xbc, 0xbf, 0xff, 0xc0, 0xc9, 0xc9, 0xff, 0x9b, 0x9f, 0x9a, 0xff, 0x43, 0x63, 0x79, 0xff, 0x26, 0x4b, 0x68, 0xff, 0x12, 0x1c, 0x1f, 0xff, 0x0c, 0x18, 0x25, 0xff, 0x40, 0x5d, 0x7d, 0xff, 0x59, 0x78, 0x9e, 0xff, 0x56, 0x6f, 0x94, 0xff, 0x53, 0x6f, 0x92, 0xff, 0x4e, 0x6d, 0x8e, 0xff, 0x48, 0x64, 0x84, 0xff, 0x41, 0x57, 0x73, 0xff, 0x3d, 0x4e, 0x6a, 0xff, 0x39, 0x4a, 0x62, 0xff, 0x33, 0x46, 0x5d, 0xff, 0x35, 0x45, 0x5b, 0xff, 0x39, 0x46, 0x5f, 0xff, 0x3b, 0x4c, 0x69, 0xff, 0x3c, 0x52, 0x6f, 0xff, 0x44, 0x5b, 0x78, 0xff, 0x4c, 0x67, 0x83, 0xff, 0x59, 0x75, 0x94, 0xff, 0x60, 0x7c, 0x9f, 0xff, 0x62, 0x81, 0xa4, 0xff, 0x6b, 0x8b, 0xae, 0xff, 0x76, 0x96, 0xb7, 0xff, 0x7d, 0x9d, 0xbf, 0xff, 0x83, 0xa1, 0xc1, 0xff, 0x83, 0xa1, 0xc3, 0xff, 0x7f, 0xae, 0xd4, 0xff, 0x41, 0x5d, 0x78, 0xff, 0x14, 0x25, 0x3f, 0xff, 0x33, 0x65, 0x8d, 0xff, 0x2e, 0x60, 0x82, 0xff, 0x57, 0x74, 0x80, 0xff, 0xcb, 0xcd, 0xc7, 0xff, 0xd1, 0xd4, 0xd4, 0xff, 0xcd, 0xd0, 0xd1, 0xff, 0xcd, 0xd2, 0xd3, 0xff, 0xd0, 0xd3, 0xd4, 0xff, 0xd2, 0xd4, 0xd5, 0xff, 0xd3, 0xd5, 0xd6, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xc8, 0xc8, 0xc8, 0x21,
+    0xff, 0xff, 0xff, 0x01, 0xcc, 0xcd, 0xcd, 0xf2, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd3, 0xd4, 0xff, 0xd3, 0xd3, 0xd4, 0xff, 0xcf, 0xd2, 0xd3, 0xff, 0xcc, 0xd1, 0xd2, 0xff, 0xcd, 0xd1, 0xd3, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xca, 0xce, 0xcf, 0xff, 0xc9, 0xcd, 0xce, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xc7, 0xcb, 0xcc, 0xff, 0xc6, 0xca, 0xcb, 0xff, 0xc5, 0xc9, 0xca, 0xff, 0xc4, 0xc8, 0xc9, 0xff, 0xc1, 0xc5, 0xc7, 0xff, 0xbf, 0xc3, 0xc3, 0xff, 0xbb, 0xbf, 0xc0, 0xff, 0xba, 0xbc, 0xbd, 0xff, 0xcf, 0xd4, 0xd1, 0xff, 0x64, 0x71, 0x7a, 0xff, 0x25, 0x43, 0x61, 0xff, 0x31, 0x36, 0x3f, 0xff, 0x36, 0x23, 0x0f, 0xff, 0x4a, 0x46, 0x43, 0xff, 0x3e, 0x54, 0x6e, 0xff, 0x5b, 0x7e, 0xa6, 0xff, 0x5e, 0x7a, 0x9c, 0xff, 0x59, 0x76, 0x98, 0xff, 0x55, 0x71, 0x94, 0xff, 0x52, 0x6e, 0x90, 0xff, 0x50, 0x68, 0x88, 0xff, 0x48, 0x5a, 0x7c, 0xff, 0x43, 0x57, 0x74, 0xff, 0x43, 0x59, 0x75, 0xff, 0x45, 0x59, 0x72, 0xff, 0x48, 0x5e, 0x76, 0xff, 0x48, 0x62, 0x81, 0xff, 0x4b, 0x65, 0x86, 0xff, 0x54, 0x6d, 0x8e, 0xff, 0x5d, 0x7a, 0x95, 0xff, 0x62, 0x7f, 0x9c, 0xff, 0x65, 0x81, 0xa3, 0xff, 0x6b, 0x8b, 0xab, 0xff, 0x79, 0x98, 0xb9, 0xff, 0x81, 0xa0, 0xc2, 0xff, 0x83, 0xa2, 0xc5, 0xff, 0x85, 0xa2, 0xc1, 0xff, 0x82, 0xa9, 0xcf, 0xff, 0x79, 0x9d, 0xc2, 0xff, 0x6a, 0x6d, 0x77, 0xff, 0x41, 0x33, 0x29, 0xff, 0x2f, 0x34, 0x35, 0xff, 0x2b, 0x51, 0x6f, 0xff, 0x47, 0x76, 0x92, 0xff, 0xc4, 0xc9, 0xc8, 0xff, 0xd7, 0xd7, 0xd4, 0xff, 0xcb, 0xd0, 0xd2, 0xff, 0xcd, 0xd2, 0xd3, 0xff, 0xd0, 0xd3, 0xd4, 0xff, 0xd2, 0xd4, 0xd5, 0xff, 0xd3, 0xd5, 0xd6, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xca, 0xcc, 0xcc, 0xf2, 0xff, 0xff, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0xcb, 0xce, 0xce, 0xc6, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd3, 0xd3, 0xff, 0xd0, 0xd3, 0xd3, 0xff, 0xce, 0xd2, 0xd2, 0xff, 0xcc, 0xd1, 0xd1, 0xff, 0xcc, 0xd1, 0xd1, 0xff, 0xcb, 0xcf, 0xd0, 0xff, 0xca, 0xce, 0xcf, 0xff, 0xc9, 0xcd, 0xce, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xc7, 0xcb, 0xcc, 0xff, 0xc6, 0xca, 0xcb, 0xff, 0xc4, 0xc8, 0xc9, 0xff, 0xc3, 0xc7, 0xc8, 0xff, 0xc1, 0xc5, 0xc6, 0xff, 0xbf, 0xc2, 0xc4, 0xff, 0xc3, 0xc8, 0xc8, 0xff, 0xde, 0xe6, 0xe9, 0xff, 0xad, 0xb5, 0xb3, 0xff, 0x1c, 0x2f, 0x3e, 0xff, 0x1a, 0x34, 0x4d, 0xff, 0x3e, 0x3d, 0x37, 0xff, 0x5b, 0x56, 0x47, 0xff, 0x5c, 0x4c, 0x3f, 0xff, 0x2b, 0x23, 0x1f, 0xff, 0x54, 0x6c, 0x8a, 0xff, 0x69, 0x8a, 0xb2, 0xff, 0x6a, 0x85, 0xa8, 0xff, 0x61, 0x7f, 0xa0, 0xff, 0x58, 0x75, 0x97, 0xff, 0x53, 0x6f, 0x92, 0xff, 0x4c, 0x65, 0x88, 0xff, 0x4b, 0x64, 0x85, 0xff, 0x4c, 0x66, 0x85, 0xff, 0x4b, 0x65, 0x82, 0xff, 0x50, 0x6c, 0x8b, 0xff, 0x54, 0x71, 0x93, 0xff, 0x57, 0x73, 0x96, 0xff, 0x5d, 0x7a, 0x9d, 0xff, 0x63, 0x80, 0x9f, 0xff, 0x66, 0x82, 0xa1, 0xff, 0x6c, 0x88, 0xaa, 0xff, 0x72, 0x92, 0xb3, 0xff, 0x7c, 0x9b, 0xbc, 0xff, 0x81, 0x9e, 0xbe, 0xff, 0x8a, 0xa8, 0xc7, 0xff, 0x89, 0xae, 0xd5, 0xff, 0x5e, 0x76, 0x91, 0xff, 0x3c, 0x28, 0x1d, 0xff, 0x68, 0x57, 0x4d, 0xff, 0x91, 0x89, 0x7b, 0xff, 0x55, 0x2e, 0x0f, 0xff, 0x30, 0x38, 0x42, 0xff, 0x4a, 0x7f, 0x9e, 0xff, 0xca, 0xce, 0xca, 0xff, 0xe0, 0xe0, 0xdc, 0xff, 0xca, 0xce, 0xd2, 0xff, 0xcd, 0xd0, 0xd1, 0xff, 0xd0, 0xd3, 0xd4, 0xff, 0xd1, 0xd4, 0xd5, 0xff, 0xd2, 0xd5, 0xd6, 0xff, 0xd3, 0xd5, 0xd6, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd5, 0xd7, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xc9, 0xcc, 0xcc, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xcb, 0xcd, 0xcd, 0x90, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcc, 0xd2, 0xd1, 0xff, 0xcc, 0xd2, 0xd1, 0xff, 0xcd, 0xd2, 0xd1, 0xff, 0xcc, 0xd1, 0xd0, 0xff, 0xcb, 0xd0, 0xce, 0xff, 0xcc, 0xd0, 0xd1, 0xff, 0xca, 0xce, 0xcf, 0xff, 0xc9, 0xcd, 0xce, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xc7, 0xcb, 0xcc, 0xff, 0xc5, 0xc9, 0xca, 0xff, 0xc2, 0xc6, 0xc7, 0xff, 0xc1, 0xc4, 0xc5, 0xff, 0xc9, 0xcb, 0xca, 0xff, 0xdb, 0xdf, 0xe3, 0xff, 0xc5, 0xcb, 0xc8, 0xff, 0x94, 0x81, 0x6b, 0xff, 0x3f, 0x4c, 0x53, 0xff, 0x12, 0x5c, 0x90, 0xff, 0x13, 0x2c, 0x36, 0xff, 0x4b, 0x40, 0x32, 0xff, 0x58, 0x5c, 0x61, 0xff, 0x23, 0x11, 0x00, 0xff, 0x1d, 0x25, 0x27, 0xff, 0x35, 0x46, 0x5e, 0xff, 0x66, 0x87, 0xaf, 0xff, 0x6f, 0x8e, 0xb2, 0xff, 0x6c, 0x8e, 0xad, 0xff, 0x6b, 0x8a, 0xac, 0xff, 0x64, 0x80, 0xa4, 0xff, 0x57, 0x74, 0x98, 0xff, 0x4e, 0x69, 0x8e, 0xff, 0x4c, 0x68, 0x88, 0xff, 0x51, 0x6e, 0x8e, 0xff, 0x58, 0x74, 0x98, 0xff, 0x5f, 0x7b, 0x9d, 0xff, 0x63, 0x7f, 0xa1, 0xff, 0x68, 0x84, 0xa6, 0xff, 0x67, 0x83, 0xa6, 0xff, 0x67, 0x82, 0xa6, 0xff, 0x6c, 0x89, 0xab, 0xff, 0x74, 0x93, 0xb3, 0xff, 0x82, 0xa3, 0xc7, 0xff, 0x8d, 0xb5, 0xdb, 0xff, 0x78, 0x97, 0xb8, 0xff, 0x44, 0x59, 0x6c, 0xff, 0x20, 0x45, 0x6a, 0xff, 0x2b, 0x30, 0x33, 0xff, 0x36, 0x13, 0x00, 0xff, 0x6d, 0x61, 0x5c, 0xff, 0x72, 0x6b, 0x60, 0xff, 0x41, 0x40, 0x39, 0xff, 0x3c, 0x65, 0x80, 0xff, 0x85, 0x96, 0xa1, 0xff, 0xe9, 0xe6, 0xe6, 0xff, 0xdc, 0xde, 0xe1, 0xff, 0xd1, 0xd2, 0xd2, 0xff, 0xd0, 0xd3, 0xd4, 0xff, 0xcf, 0xd4, 0xd5, 0xff, 0xd1, 0xd5, 0xd6, 0xff, 0xd2, 0xd3, 0xd4, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xc9, 0xcb, 0xcb, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xca, 0xcd, 0xcd, 0x58, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcd, 0xd2, 0xd1, 0xff, 0xcd, 0xd2, 0xd1, 0xff, 0xcd, 0xd2, 0xd1, 0xff, 0xcc, 0xd1, 0xd0, 0xff, 0xcb, 0xd0, 0xcf, 0xff, 0xcc, 0xd0, 0xd1, 0xff, 0xca, 0xce, 0xcf, 0xff, 0xc9, 0xcd, 0xce, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xc7, 0xca, 0xcb, 0xff, 0xc4, 0xc8, 0xca, 0xff, 0xcd, 0xd5, 0xd7, 0xff, 0xdb, 0xe4, 0xeb, 0xff, 0xca, 0xcf, 0xd1, 0xff, 0x8e, 0x90, 0x90, 0xff, 0x3f, 0x5b, 0x71, 0xff, 0x1a, 0x06, 0x00, 0xff, 0x15, 0x37, 0x4d, 0xff, 0x1f, 0x87, 0xcd, 0xff, 0x18, 0x23, 0x23, 0xff, 0x36, 0x21, 0x0f, 0xff, 0x56, 0x5b, 0x5c, 0xff, 0x21, 0x24, 0x24, 0xff, 0x2e, 0x42, 0x56, 0xff, 0x1f, 0x3c, 0x55, 0xff, 0x48, 0x72, 0x97, 0xff, 0x7c, 0xa1, 0xc9, 0xff, 0x78, 0x98, 0xbb, 0xff, 0x75, 0x91, 0xb1, 0xff, 0x76, 0x8f, 0xb1, 0xff, 0x6b, 0x87, 0xaa, 0xff, 0x62, 0x7c, 0xa0, 0xff, 0x59, 0x74, 0x94, 0xff, 0x58, 0x75, 0x94, 0xff, 0x5b, 0x77, 0x99, 0xff, 0x5e, 0x7a, 0x9d, 0xff, 0x65, 0x81, 0xa3, 0xff, 0x68, 0x84, 0xa6, 0xff, 0x69, 0x85, 0xa6, 0xff, 0x6d, 0x86, 0xa6, 0xff, 0x74, 0x91, 0xb1, 0xff, 0x84, 0xaa, 0xd1, 0xff, 0x7a, 0x9d, 0xc0, 0xff, 0x5f, 0x65, 0x78, 0xff, 0x31, 0x4a, 0x5c, 0xff, 0x20, 0x41, 0x5b, 0xff, 0x2c, 0x3d, 0x4c, 0xff, 0x2c, 0x63, 0x89, 0xff, 0x33, 0x3b, 0x3d, 0xff, 0x34, 0x16, 0x00, 0xff, 0x59, 0x5c, 0x5e, 0xff, 0x4f, 0x43, 0x3c, 0xff, 0x24, 0x6a, 0x94, 0xff, 0x1e, 0x63, 0x95, 0xff, 0x7b, 0x69, 0x52, 0xff, 0xcf, 0xcc, 0xc5, 0xff, 0xe1, 0xe9, 0xf3, 0xff, 0xdd, 0xe4, 0xe9, 0xff, 0xd1, 0xd6, 0xd9, 0xff, 0xd1, 0xd4, 0xd4, 0xff, 0xd1, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd4, 0xd6, 0xd7, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd6, 0xd8, 0xd8, 0xff, 0xd5, 0xd7, 0xd7, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xca, 0xca, 0xca, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc6, 0xcf, 0xcf, 0x1b, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcc, 0xd1, 0xd0, 0xff, 0xcc, 0xd1, 0xd0, 0xff, 0xcb, 0xd0, 0xcf, 0xff, 0xcb, 0xd0, 0xcf, 0xff, 0xcb, 0xd0, 0xcf, 0xff, 0xca, 0xce, 0xcf, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xc7, 0xca, 0xcb, 0xff, 0xca, 0xd0, 0xd1, 0xff, 0xd6, 0xdc, 0xde, 0xff, 0xc4, 0xc3, 0xbe, 0xff, 0x90, 0x90, 0x8a, 0xff, 0x53, 0x68, 0x7f, 0xff, 0x1e, 0x2e, 0x40, 0xff, 0x17, 0x26, 0x33, 0xff, 0x2e, 0x3e, 0x52, 0xff, 0x26, 0x44, 0x5e, 0xff, 0x14, 0x6d, 0xa7, 0xff, 0x29, 0x45, 0x5a, 0xff, 0x2e, 0x24, 0x1c, 0xff, 0x3d, 0x32, 0x1e, 0xff, 0x24, 0x2b, 0x2e, 0xff, 0x20, 0x25, 0x30, 0xff, 0x32, 0x45, 0x55, 0xff, 0x2a, 0x31, 0x33, 0xff, 0x3d, 0x4c, 0x61, 0xff, 0x77, 0x93, 0xb7, 0xff, 0x89, 0xa9, 0xd0, 0xff, 0x76, 0x98, 0xbe, 0xff, 0x72, 0x90, 0xb2, 0xff, 0x72, 0x8e, 0xb0, 0xff, 0x6f, 0x8a, 0xac, 0xff, 0x69, 0x85, 0xa7, 0xff, 0x65, 0x81, 0xa3, 0xff, 0x63, 0x7f, 0xa1, 0xff, 0x63, 0x80, 0xa3, 0xff, 0x65, 0x82, 0xa5, 0xff, 0x66, 0x85, 0xa5, 0xff, 0x77, 0x9b, 0xbd, 0xff, 0x88, 0xb0, 0xdd, 0xff, 0x7b, 0x92, 0xb1, 0xff, 0x42, 0x3a, 0x32, 0xff, 0x0b, 0x00, 0x00, 0xff, 0x2e, 0x18, 0x03, 0xff, 0x33, 0x5b, 0x74, 0xff, 0x30, 0x58, 0x74, 0xff, 0x36, 0x40, 0x52, 0xff, 0x24, 0x4b, 0x62, 0xff, 0x1f, 0x12, 0x00, 0xff, 0x6a, 0x6e, 0x72, 0xff, 0x5a, 0x4a, 0x3e, 0xff, 0x1c, 0x55, 0x75, 0xff, 0x29, 0x78, 0xaa, 0xff, 0x44, 0x32, 0x1e, 0xff, 0x54, 0x50, 0x48, 0xff, 0x8a, 0x7d, 0x70, 0xff, 0xbf, 0xbe, 0xba, 0xff, 0xe4, 0xea, 0xef, 0xff, 0xe0, 0xea, 0xef, 0xff, 0xd0, 0xda, 0xd9, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd5, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xc6, 0xcf, 0xcf, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xce, 0xce, 0xd7, 0xcc, 0xce, 0xce, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcc, 0xd1, 0xd0, 0xff, 0xcc, 0xd1, 0xd0, 0xff, 0xcb, 0xd0, 0xcf, 0xff, 0xcb, 0xd0, 0xcf, 0xff, 0xcc, 0xd0, 0xcf, 0xff, 0xc8, 0xcc, 0xcd, 0xff, 0xc5, 0xc9, 0xca, 0xff, 0xc8, 0xcd, 0xcf, 0xff, 0xdb, 0xe3, 0xe8, 0xff, 0xd8, 0xe1, 0xe7, 0xff, 0xab, 0xa6, 0xa2, 0xff, 0x3f, 0x2a, 0x18, 0xff, 0x13, 0x00, 0x00, 0xff, 0x2d, 0x2e, 0x25, 0xff, 0x2d, 0x4f, 0x75, 0xff, 0x28, 0x2f, 0x38, 0xff, 0x27, 0x33, 0x37, 0xff, 0x24, 0x33, 0x3b, 0xff, 0x0f, 0x2a, 0x3d, 0xff, 0x41, 0x6b, 0x97, 0xff, 0x4e, 0x84, 0xa7, 0xff, 0x1e, 0x10, 0x00, 0xff, 0x2f, 0x4a, 0x5d, 0xff, 0x0e, 0x26, 0x37, 0xff, 0x21, 0x15, 0x08, 0xff, 0x1d, 0x01, 0x00, 0xff, 0x2d, 0x1c, 0x03, 0xff, 0x56, 0x56, 0x59, 0xff, 0x66, 0x84, 0xa7, 0xff, 0x85, 0xab, 0xd4, 0xff, 0x84, 0xa8, 0xd0, 0xff, 0x7e, 0x99, 0xbc, 0xff, 0x7f, 0x98, 0xbb, 0xff, 0x77, 0x94, 0xb6, 0xff, 0x77, 0x93, 0xb5, 0xff, 0x76, 0x93, 0xb5, 0xff, 0x71, 0x8f, 0xb2, 0xff, 0x71, 0x8e, 0xb1, 0xff, 0x83, 0xa4, 0xca, 0xff, 0x84, 0xa3, 0xc8, 0xff, 0x53, 0x59, 0x64, 0xff, 0x36, 0x2f, 0x2a, 0xff, 0x5d, 0x50, 0x45, 0xff, 0x4f, 0x48, 0x34, 0xff, 0x16, 0x08, 0x00, 0xff, 0x33, 0x1b, 0x0b, 0xff, 0x37, 0x5a, 0x7a, 0xff, 0x2a, 0x40, 0x4e, 0xff, 0x27, 0x35, 0x44, 0xff, 0x2c, 0x43, 0x5b, 0xff, 0x6a, 0x66, 0x62, 0xff, 0x6d, 0x63, 0x54, 0xff, 0x4b, 0x50, 0x62, 0xff, 0x28, 0x42, 0x54, 0xff, 0x33, 0x41, 0x58, 0xff, 0x37, 0x55, 0x72, 0xff, 0x4a, 0x29, 0x04, 0xff, 0x49, 0x27, 0x04, 0xff, 0x80, 0x6c, 0x55, 0xff, 0xc5, 0xc1, 0xc0, 0xff, 0xe5, 0xe9, 0xef, 0xff, 0xe4, 0xec, 0xef, 0xff, 0xd8, 0xdd, 0xde, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd5, 0xd5, 0xff, 0xd4, 0xd6, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xc9, 0xcc, 0xcc, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xce, 0xce, 0x8e, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd2, 0xd1, 0xff, 0xcd, 0xd2, 0xd0, 0xff, 0xcc, 0xd0, 0xd0, 0xff, 0xcc, 0xd1, 0xd0, 0xff, 0xcb, 0xd0, 0xcf, 0xff, 0xcb, 0xcf, 0xcf, 0xff, 0xca, 0xce, 0xcf, 0xff, 0xc8, 0xcc, 0xcc, 0xff, 0xc8, 0xcd, 0xcd, 0xff, 0xdc, 0xe3, 0xe7, 0xff, 0xd2, 0xdc, 0xe1, 0xff, 0xa7, 0xa2, 0x9a, 0xff, 0x64, 0x5e, 0x5c, 0xff, 0x4c, 0x44, 0x43, 0xff, 0x53, 0x41, 0x2e, 0xff, 0x1e, 0x11, 0x05, 0xff, 0x2f, 0x12, 0x00, 0xff, 0x2d, 0x2f, 0x34, 0xff, 0x1b, 0x3c, 0x5a, 0xff, 0x1f, 0x35, 0x4a, 0xff, 0x2f, 0x2b, 0x24, 0xff, 0x2f, 0x16, 0x0e, 0xff, 0x43, 0x77, 0x9c, 0xff, 0x35, 0x7b, 0xb5, 0xff, 0x0f, 0x10, 0x14, 0xff, 0x25, 0x27, 0x28, 0xff, 0x2b, 0x42, 0x5c, 0xff, 0x02, 0x0d, 0x16, 0xff, 0x2b, 0x1b, 0x0b, 0xff, 0x61, 0x57, 0x4c, 0xff, 0x36, 0x37, 0x39, 0xff, 0x2f, 0x1f, 0x0d, 0xff, 0x54, 0x49, 0x3f, 0xff, 0x84, 0x9c, 0xb9, 0xff, 0x8c, 0xb0, 0xd7, 0xff, 0x7f, 0x9d, 0xc0, 0xff, 0x84, 0xa0, 0xc3, 0xff, 0x86, 0xa1, 0xc3, 0xff, 0x81, 0x9e, 0xc0, 0xff, 0x7e, 0x9e, 0xc0, 0xff, 0x8c, 0xaa, 0xcc, 0xff, 0x70, 0x82, 0xa3, 0xff, 0x3a, 0x2c, 0x26, 0xff, 0x41, 0x18, 0x00, 0xff, 0x41, 0x25, 0x07, 0xff, 0x3c, 0x3f, 0x3e, 0xff, 0x64, 0x64, 0x61, 0xff, 0x44, 0x36, 0x29, 0xff, 0x14, 0x01, 0x00, 0xff, 0x2f, 0x26, 0x14, 0xff, 0x29, 0x37, 0x47, 0xff, 0x20, 0x3c, 0x5a, 0xff, 0x2e, 0x5e, 0x81, 0xff, 0x23, 0x08, 0x00, 0xff, 0x49, 0x51, 0x54, 0xff, 0x5a, 0x8f, 0xbb, 0xff, 0x27, 0x2b, 0x3b, 0xff, 0x36, 0x45, 0x58, 0xff, 0x2f, 0x6d, 0xa0, 0xff, 0x4c, 0x46, 0x46, 0xff, 0x6e, 0x4e, 0x33, 0xff, 0x52, 0x31, 0x17, 0xff, 0x56, 0x37, 0x17, 0xff, 0x90, 0x75, 0x5d, 0xff, 0xbb, 0xad, 0xa1, 0xff, 0xd9, 0xdf, 0xe2, 0xff, 0xe8, 0xf1, 0xf4, 0xff, 0xde, 0xdf, 0xe1, 0xff, 0xd4, 0xd6, 0xd5, 0xff, 0xd4, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd6, 0xd6, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xc9, 0xcc, 0xcc, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcf, 0xcf, 0x46, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd2, 0xd1, 0xff, 0xcc, 0xd2, 0xd0, 0xff, 0xca, 0xd0, 0xcf, 0xff, 0xcc, 0xd2, 0xd0, 0xff, 0xcb, 0xd0, 0xce, 0xff, 0xc9, 0xcd, 0xce, 0xff, 0xc6, 0xca, 0xcc, 0xff, 0xd0, 0xd9, 0xde, 0xff, 0xdf, 0xe8, 0xec, 0xff, 0xb8, 0xb1, 0xad, 0xff, 0x73, 0x60, 0x4e, 0xff, 0x43, 0x25, 0x02, 0xff, 0x3e, 0x18, 0x00, 0xff, 0x28, 0x29, 0x29, 0xff, 0x5a, 0x57, 0x5c, 0xff, 0x4d, 0x3e, 0x2f, 0xff, 0x15, 0x00, 0x00, 0xff, 0x2e, 0x29, 0x28, 0xff, 0x1d, 0x54, 0x7b, 0xff, 0x26, 0x46, 0x60, 0xff, 0x2d, 0x2c, 0x2f, 0xff, 0x65, 0x48, 0x3c, 0xff, 0x54, 0x68, 0x74, 0xff, 0x19, 0x2c, 0x46, 0xff, 0x14, 0x4d, 0x7e, 0xff, 0x00, 0x0d, 0x12, 0xff, 0x30, 0x3b, 0x43, 0xff, 0x1c, 0x40, 0x5f, 0xff, 0x21, 0x17, 0x08, 0xff, 0x2c, 0x2c, 0x27, 0xff, 0x32, 0x1f, 0x08, 0xff, 0x49, 0x23, 0x00, 0xff, 0x3f, 0x17, 0x00, 0xff, 0x32, 0x1b, 0x0b, 0xff, 0x85, 0x93, 0xaa, 0xff, 0xa1, 0xc2, 0xe1, 0xff, 0x8e, 0xaf, 0xd1, 0xff, 0x8e, 0xa9, 0xcc, 0xff, 0x91, 0xad, 0xd0, 0xff, 0x94, 0xb4, 0xdd, 0xff, 0x73, 0xa0, 0xd1, 0xff, 0x25, 0x4f, 0x7c, 0xff, 0x03, 0x06, 0x0b, 0xff, 0x42, 0x26, 0x0c, 0xff, 0x5e, 0x37, 0x0f, 0xff, 0x3a, 0x1f, 0x01, 0xff, 0x29, 0x2c, 0x2e, 0xff, 0x61, 0x5c, 0x55, 0xff, 0x31, 0x22, 0x0d, 0xff, 0x13, 0x03, 0x00, 0xff, 0x21, 0x35, 0x43, 0xff, 0x1a, 0x3b, 0x4f, 0xff, 0x11, 0x2a, 0x36, 0xff, 0x29, 0x10, 0x0c, 0xff, 0x43, 0x5b, 0x85, 0xff, 0x31, 0x78, 0xac, 0xff, 0x31, 0x4c, 0x66, 0xff, 0x40, 0x49, 0x54, 0xff, 0x2d, 0x66, 0x9c, 0xff, 0x34, 0x3b, 0x3c, 0xff, 0xa5, 0x90, 0x7c, 0xff, 0x8b, 0x7e, 0x81, 0xff, 0x35, 0x18, 0x00, 0xff, 0x45, 0x2c, 0x16, 0xff, 0x5c, 0x3c, 0x22, 0xff, 0x82, 0x60, 0x48, 0xff, 0xb0, 0xa5, 0x97, 0xff, 0xd4, 0xdd, 0xdd, 0xff, 0xe8, 0xf2, 0xf8, 0xff, 0xde, 0xe4, 0xe6, 0xff, 0xd3, 0xd5, 0xd4, 0xff, 0xd1, 0xd4, 0xd4, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd4, 0xd5, 0xd5, 0xff, 0xd3, 0xd5, 0xd5, 0xff, 0xd1, 0xd4, 0xd4, 0xff, 0xd2, 0xd4, 0xd4, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xc8, 0xcc, 0xcc, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xda, 0xda, 0x07, 0xca, 0xcc, 0xcc, 0xef, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xd0, 0xd2, 0xd2, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd2, 0xd1, 0xff, 0xcc, 0xd2, 0xd0, 0xff, 0xcc, 0xd0, 0xcf, 0xff, 0xce, 0xd0, 0xcf, 0xff, 0xc9, 0xce, 0xcf, 0xff, 0xd0, 0xd7, 0xda, 0xff, 0xe1, 0xe9, 0xee, 0xff, 0xc9, 0xcd, 0xce, 0xff, 0x84, 0x75, 0x69, 0xff, 0x47, 0x28, 0x07, 0xff, 0x3e, 0x19, 0x00, 0xff, 0x42, 0x26, 0x0a, 0xff, 0x3a, 0x19, 0x00, 0xff, 0x24, 0x24, 0x17, 0xff, 0x49, 0x59, 0x65, 0xff, 0x57, 0x49, 0x3a, 0xff, 0x12, 0x00, 0x00, 0xff, 0x34, 0x2f, 0x2e, 0xff, 0x27, 0x57, 0x83, 0xff, 0x29, 0x42, 0x55, 0xff, 0x2c, 0x27, 0x26, 0xff, 0x7f, 0x66, 0x5e, 0xff, 0x7d, 0x70, 0x63, 0xff, 0x19, 0x2d, 0x3b, 0xff, 0x06, 0x81, 0xda, 0xff, 0x0a, 0x50, 0x91, 0xff, 0x14, 0x15, 0x12, 0xff, 0x2d, 0x31, 0x2a, 0xff, 0x13, 0x15, 0x18, 0xff, 0x1c, 0x12, 0x06, 0xff, 0x31, 0x1a, 0x00, 0xff, 0x41, 0x29, 0x09, 0xff, 0x3b, 0x29, 0x09, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x23, 0x61, 0x98, 0xff, 0xb2, 0xd8, 0xfb, 0xff, 0xaf, 0xc4, 0xdc, 0xff, 0x9f, 0xb9, 0xdb, 0xff, 0xa0, 0xbd, 0xde, 0xff, 0x63, 0x84, 0xa6, 0xff, 0x4f, 0x84, 0xae, 0xff, 0x1e, 0x5c, 0x8a, 0xff, 0x00, 0x18, 0x33, 0xff, 0x13, 0x02, 0x00, 0xff, 0x45, 0x2b, 0x0c, 0xff, 0x34, 0x1b, 0x00, 0xff, 0x32, 0x21, 0x0b, 0xff, 0x45, 0x4a, 0x4e, 0xff, 0x42, 0x32, 0x1f, 0xff, 0x10, 0x00, 0x00, 0xff, 0x26, 0x52, 0x71, 0xff, 0x14, 0x3c, 0x4e, 0xff, 0x2e, 0x2e, 0x32, 0xff, 0x1c, 0x87, 0xc8, 0xff, 0x1a, 0x55, 0x73, 0xff, 0x37, 0x2a, 0x37, 0xff, 0x33, 0x67, 0x93, 0xff, 0x3d, 0x4e, 0x5e, 0xff, 0x2f, 0x65, 0x99, 0xff, 0x2a, 0x36, 0x35, 0xff, 0x75, 0x57, 0x33, 0xff, 0x83, 0x7a, 0x7b, 0xff, 0x44, 0x23, 0x05, 0xff, 0x30, 0x54, 0x76, 0xff, 0x38, 0x5a, 0x78, 0xff, 0x54, 0x3a, 0x26, 0xff, 0x5b, 0x36, 0x1e, 0xff, 0x77, 0x5e, 0x48, 0xff, 0xa6, 0x99, 0x84, 0xff, 0xcd, 0xc9, 0xc3, 0xff, 0xe1, 0xe6, 0xea, 0xff, 0xe4, 0xe6, 0xe6, 0xff, 0xe0, 0xe2, 0xe2, 0xff, 0xd2, 0xd8, 0xd9, 0xff, 0xd3, 0xd4, 0xd4, 0xff, 0xd5, 0xd3, 0xd4, 0xff, 0xd2, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xc9, 0xcb, 0xcb, 0xef, 0xda, 0xda, 0xda, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xcc, 0xcc, 0xa0, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd1, 0xd1, 0xff, 0xce, 0xd1, 0xd1, 0xff, 0xca, 0xcf, 0xcd, 0xff, 0xca, 0xcf, 0xcf, 0xff, 0xd1, 0xda, 0xdd, 0xff, 0xdd, 0xe7, 0xed, 0xff, 0xce, 0xd1, 0xd5, 0xff, 0x9f, 0x96, 0x89, 0xff, 0x5b, 0x41, 0x25, 0xff, 0x3a, 0x18, 0x00, 0xff, 0x45, 0x28, 0x03, 0xff, 0x3e, 0x24, 0x07, 0xff, 0x37, 0x1c, 0x03, 0xff, 0x38, 0x17, 0x00, 0xff, 0x2c, 0x27, 0x1d, 0xff, 0x55, 0x60, 0x6c, 0xff, 0x59, 0x4a, 0x3f, 0xff, 0x15, 0x00, 0x00, 0xff, 0x35, 0x40, 0x3f, 0xff, 0x2b, 0x59, 0x88, 0xff, 0x2d, 0x3d, 0x47, 0xff, 0x3d, 0x28, 0x15, 0xff, 0x84, 0x72, 0x6d, 0xff, 0x87, 0x70, 0x61, 0xff, 0x22, 0x1b, 0x22, 0xff, 0x17, 0x51, 0x7c, 0xff, 0x02, 0x96, 0xf6, 0xff, 0x0b, 0x49, 0x74, 0xff, 0x10, 0x00, 0x00, 0xff, 0x1b, 0x22, 0x23, 0xff, 0x20, 0x28, 0x2a, 0xff, 0x23, 0x11, 0x00, 0xff, 0x44, 0x29, 0x0b, 0xff, 0x13, 0x0b, 0x02, 0xff, 0x04, 0x1f, 0x30, 0xff, 0x00, 0x48, 0x89, 0xff, 0x3b, 0x82, 0xbc, 0xff, 0xc1, 0xd2, 0xe8, 0xff, 0xb5, 0xd5, 0xf6, 0xff, 0x76, 0x81, 0x9b, 0xff, 0x29, 0x16, 0x13, 0xff, 0x59, 0x53, 0x4d, 0xff, 0x1f, 0x16, 0x0a, 0xff, 0x0c, 0x00, 0x00, 0xff, 0x0e, 0x11, 0x17, 0xff, 0x31, 0x23, 0x0d, 0xff, 0x3d, 0x25, 0x02, 0xff, 0x34, 0x1d, 0x00, 0xff, 0x35, 0x23, 0x1a, 0xff, 0x25, 0x20, 0x1e, 0xff, 0x2d, 0x26, 0x1e, 0xff, 0x37, 0x40, 0x44, 0xff, 0x1d, 0x44, 0x5e, 0xff, 0x2c, 0x6d, 0x9b, 0xff, 0x00, 0x7a, 0xbd, 0xff, 0x1c, 0x16, 0x0e, 0xff, 0x3f, 0x2d, 0x24, 0xff, 0x36, 0x67, 0x95, 0xff, 0x3b, 0x4d, 0x57, 0xff, 0x2e, 0x5c, 0x83, 0xff, 0x35, 0x32, 0x39, 0xff, 0x5b, 0x2f, 0x0b, 0xff, 0x6c, 0x5b, 0x55, 0xff, 0x4e, 0x2a, 0x11, 0xff, 0x31, 0x5b, 0x7d, 0xff, 0x32, 0x5d, 0x84, 0xff, 0x44, 0x5d, 0x73, 0xff, 0x49, 0x6a, 0x8a, 0xff, 0x5c, 0x38, 0x1d, 0xff, 0x50, 0x24, 0x00, 0xff, 0x5c, 0x4e, 0x49, 0xff, 0xa3, 0xa4, 0xa4, 0xff, 0xce, 0xcd, 0xcb, 0xff, 0xc5, 0xc8, 0xcb, 0xff, 0xdf, 0xe1, 0xe0, 0xff, 0xec, 0xea, 0xe7, 0xff, 0xd8, 0xd7, 0xd7, 0xff, 0xd0, 0xd0, 0xcf, 0xff, 0xd2, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0xcb, 0xcb, 0x4a, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xcf, 0xff, 0xd0, 0xd1, 0xd0, 0xff, 0xd9, 0xe0, 0xe2, 0xff, 0xdb, 0xe6, 0xe8, 0xff, 0xc5, 0xc8, 0xc4, 0xff, 0x9f, 0x8f, 0x85, 0xff, 0x65, 0x49, 0x33, 0xff, 0x3f, 0x20, 0x00, 0xff, 0x49, 0x29, 0x04, 0xff, 0x4b, 0x30, 0x0d, 0xff, 0x41, 0x24, 0x09, 0xff, 0x35, 0x19, 0x00, 0xff, 0x38, 0x1e, 0x03, 0xff, 0x42, 0x1c, 0x00, 0xff, 0x28, 0x28, 0x24, 0xff, 0x65, 0x67, 0x6c, 0xff, 0x52, 0x40, 0x2f, 0xff, 0x19, 0x00, 0x00, 0xff, 0x35, 0x54, 0x69, 0xff, 0x2a, 0x59, 0x81, 0xff, 0x33, 0x31, 0x35, 0xff, 0x3e, 0x39, 0x3c, 0xff, 0x91, 0x9c, 0xa9, 0xff, 0x6e, 0x77, 0x86, 0xff, 0x2b, 0x0c, 0x08, 0xff, 0x1d, 0x36, 0x49, 0xff, 0x10, 0x80, 0xc9, 0xff, 0x16, 0x42, 0x68, 0xff, 0x08, 0x00, 0x00, 0xff, 0x25, 0x1f, 0x0d, 0xff, 0x29, 0x35, 0x34, 0xff, 0x19, 0x12, 0x09, 0xff, 0x30, 0x17, 0x06, 0xff, 0x01, 0x00, 0x00, 0xff, 0x29, 0x36, 0x37, 0xff, 0x8c, 0xa6, 0xb3, 0xff, 0x18, 0x3e, 0x5b, 0xff, 0x60, 0x8e, 0xba, 0xff, 0xb1, 0xdb, 0xff, 0xff, 0x62, 0x5e, 0x6e, 0xff, 0x51, 0x41, 0x4d, 0xff, 0xab, 0xa8, 0xb0, 0xff, 0x96, 0x8b, 0x86, 0xff, 0x6d, 0x66, 0x5d, 0xff, 0x35, 0x51, 0x69, 0xff, 0x29, 0x21, 0x15, 0xff, 0x2e, 0x18, 0x01, 0xff, 0x2b, 0x14, 0x00, 0xff, 0x16, 0x11, 0x06, 0xff, 0x47, 0x58, 0x6b, 0xff, 0x6d, 0x6a, 0x5b, 0xff, 0x04, 0x00, 0x00, 0xff, 0x24, 0x0f, 0x07, 0xff, 0x29, 0x7c, 0xb6, 0xff, 0x5f, 0x86, 0x9d, 0xff, 0x58, 0x3f, 0x35, 0xff, 0x45, 0x5c, 0x65, 0xff, 0x37, 0x85, 0xbb, 0xff, 0x3a, 0x5d, 0x7f, 0xff, 0x22, 0x66, 0x9d, 0xff, 0x1a, 0x4a, 0x67, 0xff, 0x46, 0x39, 0x38, 0xff, 0x6d, 0x67, 0x74, 0xff, 0x50, 0x2b, 0x10, 0xff, 0x35, 0x5d, 0x7f, 0xff, 0x33, 0x5a, 0x7c, 0xff, 0x3a, 0x4f, 0x6b, 0xff, 0x36, 0x72, 0xb0, 0xff, 0x45, 0x39, 0x23, 0xff, 0x58, 0x41, 0x21, 0xff, 0x60, 0x62, 0x65, 0xff, 0x60, 0x51, 0x47, 0xff, 0x4c, 0x38, 0x1f, 0xff, 0x47, 0x39, 0x21, 0xff, 0x82, 0x6f, 0x6b, 0xff, 0x9a, 0xab, 0xb9, 0xff, 0xd1, 0xde, 0xdd, 0xff, 0xea, 0xe5, 0xe3, 0xff, 0xd3, 0xd3, 0xd1, 0xff, 0xd0, 0xd3, 0xd2, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xd1, 0xd3, 0xd3, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x04, 0xcc, 0xce, 0xce, 0xe7, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xd3, 0xd5, 0xd2, 0xff, 0xdb, 0xe2, 0xe2, 0xff, 0xdd, 0xe5, 0xec, 0xff, 0xb5, 0xbe, 0xbf, 0xff, 0x8d, 0x7f, 0x6e, 0xff, 0x68, 0x48, 0x2f, 0xff, 0x45, 0x26, 0x07, 0xff, 0x45, 0x26, 0x03, 0xff, 0x58, 0x35, 0x19, 0xff, 0x51, 0x35, 0x17, 0xff, 0x42, 0x29, 0x07, 0xff, 0x30, 0x1b, 0x03, 0xff, 0x3a, 0x20, 0x02, 0xff, 0x45, 0x29, 0x06, 0xff, 0x44, 0x23, 0x00, 0xff, 0x33, 0x35, 0x39, 0xff, 0x6d, 0x68, 0x62, 0xff, 0x36, 0x2a, 0x11, 0xff, 0x28, 0x18, 0x03, 0xff, 0x36, 0x64, 0x86, 0xff, 0x30, 0x5a, 0x77, 0xff, 0x52, 0x50, 0x55, 0xff, 0x65, 0x61, 0x70, 0xff, 0xb3, 0xc6, 0xd4, 0xff, 0x87, 0x8f, 0x9d, 0xff, 0x46, 0x44, 0x45, 0xff, 0x3b, 0x63, 0x84, 0xff, 0x1d, 0x32, 0x4a, 0xff, 0x1d, 0x43, 0x65, 0xff, 0x48, 0x5e, 0x68, 0xff, 0x3d, 0x31, 0x26, 0xff, 0x12, 0x13, 0x11, 0xff, 0x27, 0x20, 0x12, 0xff, 0x1d, 0x12, 0x09, 0xff, 0x0a, 0x11, 0x1b, 0xff, 0x27, 0x3d, 0x4f, 0xff, 0xae, 0xca, 0xcf, 0xff, 0x56, 0x58, 0x52, 0xff, 0x00, 0x0c, 0x19, 0xff, 0x6e, 0x9f, 0xd1, 0xff, 0x99, 0x9d, 0xa1, 0xff, 0xa3, 0xa5, 0xa5, 0xff, 0xd4, 0xe0, 0xea, 0xff, 0xb5, 0xbe, 0xce, 0xff, 0x71, 0x67, 0x63, 0xff, 0x32, 0x40, 0x4a, 0xff, 0x19, 0x17, 0x14, 0xff, 0x3f, 0x23, 0x00, 0xff, 0x26, 0x11, 0x00, 0xff, 0x00, 0x06, 0x01, 0xff, 0x6d, 0x85, 0x9d, 0xff, 0x6c, 0x79, 0x7a, 0xff, 0x36, 0x2f, 0x21, 0xff, 0x27, 0x27, 0x23, 0xff, 0x17, 0x2b, 0x38, 0xff, 0x7f, 0x72, 0x6d, 0xff, 0x46, 0x43, 0x39, 0xff, 0x37, 0x38, 0x38, 0xff, 0x44, 0x8a, 0xb9, 0xff, 0x50, 0x7e, 0xa6, 0xff, 0x42, 0x8b, 0xc1, 0xff, 0x3f, 0x83, 0xb4, 0xff, 0x54, 0x4b, 0x4d, 0xff, 0x84, 0x89, 0x90, 0xff, 0x61, 0x49, 0x2b, 0xff, 0x2b, 0x4a, 0x6d, 0xff, 0x37, 0x54, 0x75, 0xff, 0x3f, 0x4e, 0x5c, 0xff, 0x32, 0x6e, 0xa3, 0xff, 0x38, 0x2b, 0x1d, 0xff, 0x4e, 0x29, 0x09, 0xff, 0x64, 0x5c, 0x58, 0xff, 0x41, 0x3f, 0x3f, 0xff, 0x48, 0x24, 0x00, 0xff, 0x53, 0x3a, 0x1e, 0xff, 0x43, 0x53, 0x64, 0xff, 0x35, 0x57, 0x77, 0xff, 0x60, 0x6c, 0x72, 0xff, 0xb5, 0xc0, 0xc7, 0xff, 0xe9, 0xee, 0xf2, 0xff, 0xd6, 0xdb, 0xd6, 0xff, 0xcf, 0xd0, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xe7, 0xcc, 0xcc, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcd, 0xcd, 0x87, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd1, 0xff, 0xcc, 0xcf, 0xd0, 0xff, 0xd2, 0xd2, 0xd1, 0xff, 0xe2, 0xe2, 0xdf, 0xff, 0xdc, 0xe0, 0xdf, 0xff, 0xbe, 0xc8, 0xca, 0xff, 0x92, 0x9d, 0x9f, 0xff, 0x62, 0x5c, 0x56, 0xff, 0x42, 0x3b, 0x37, 0xff, 0x45, 0x31, 0x18, 0xff, 0x51, 0x30, 0x07, 0xff, 0x57, 0x38, 0x17, 0xff, 0x51, 0x33, 0x10, 0xff, 0x3f, 0x25, 0x05, 0xff, 0x30, 0x1a, 0x00, 0xff, 0x34, 0x1e, 0x00, 0xff, 0x42, 0x28, 0x05, 0xff, 0x44, 0x26, 0x00, 0xff, 0x3e, 0x26, 0x06, 0xff, 0x48, 0x4a, 0x50, 0xff, 0x65, 0x5a, 0x4c, 0xff, 0x26, 0x0b, 0x00, 0xff, 0x34, 0x2b, 0x1e, 0xff, 0x22, 0x66, 0x9b, 0xff, 0x31, 0x60, 0x88, 0xff, 0x2f, 0x2a, 0x1a, 0xff, 0x41, 0x2e, 0x20, 0xff, 0x93, 0x9b, 0x98, 0xff, 0x5f, 0x54, 0x4d, 0xff, 0x29, 0x18, 0x08, 0xff, 0x20, 0x50, 0x77, 0xff, 0x19, 0x28, 0x32, 0xff, 0x29, 0x4d, 0x64, 0xff, 0x37, 0x79, 0xb0, 0xff, 0x2c, 0x24, 0x22, 0xff, 0x14, 0x02, 0x00, 0xff, 0x0b, 0x04, 0x00, 0xff, 0x13, 0x0a, 0x00, 0xff, 0x17, 0x1d, 0x19, 0xff, 0x0f, 0x11, 0x15, 0xff, 0x23, 0x3d, 0x47, 0xff, 0x42, 0x56, 0x5f, 0xff, 0x2a, 0x1e, 0x1b, 0xff, 0x3c, 0x4a, 0x5d, 0xff, 0x58, 0x5b, 0x5d, 0xff, 0x3c, 0x34, 0x3c, 0xff, 0x51, 0x50, 0x51, 0xff, 0x55, 0x4f, 0x4f, 0xff, 0x1a, 0x0b, 0x0b, 0xff, 0x0d, 0x05, 0x00, 0xff, 0x10, 0x0e, 0x0c, 0xff, 0x34, 0x1a, 0x01, 0xff, 0x4f, 0x41, 0x2a, 0xff, 0x7e, 0x83, 0x86, 0xff, 0x5d, 0x57, 0x48, 0xff, 0x13, 0x1d, 0x2c, 0xff, 0x54, 0x59, 0x59, 0xff, 0x4c, 0x41, 0x34, 0xff, 0x18, 0x26, 0x2a, 0xff, 0x5c, 0x5f, 0x62, 0xff, 0x35, 0x22, 0x0c, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x27, 0x40, 0x5a, 0xff, 0x29, 0x43, 0x5a, 0xff, 0x30, 0x52, 0x6c, 0xff, 0x35, 0x5f, 0x7c, 0xff, 0x29, 0x0f, 0x00, 0xff, 0x69, 0x5c, 0x55, 0xff, 0x82, 0x79, 0x6d, 0xff, 0x27, 0x68, 0x93, 0xff, 0x31, 0x6e, 0x9f, 0xff, 0x30, 0x5f, 0x80, 0xff, 0x18, 0x73, 0xb6, 0xff, 0x32, 0x33, 0x38, 0xff, 0x21, 0x0d, 0x03, 0xff, 0x51, 0x55, 0x5d, 0xff, 0x55, 0x4d, 0x49, 0xff, 0x55, 0x2b, 0x00, 0xff, 0x5f, 0x3e, 0x18, 0xff, 0x5d, 0x46, 0x2f, 0xff, 0x65, 0x4d, 0x42, 0xff, 0x3d, 0x4d, 0x5c, 0xff, 0x44, 0x6a, 0x86, 0xff, 0xa1, 0x97, 0x9e, 0xff, 0xdd, 0xde, 0xde, 0xff, 0xd7, 0xdc, 0xdc, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xcf, 0xd1, 0xd1, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xca, 0xca, 0x22, 0xca, 0xcc, 0xcc, 0xfe, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xce, 0xff, 0xce, 0xce, 0xcc, 0xff, 0xd8, 0xd8, 0xd3, 0xff, 0xdb, 0xe3, 0xe5, 0xff, 0xba, 0xbc, 0xc3, 0xff, 0x72, 0x69, 0x5a, 0xff, 0x3a, 0x2f, 0x19, 0xff, 0x29, 0x16, 0x04, 0xff, 0x6f, 0x53, 0x41, 0xff, 0x5a, 0x63, 0x6d, 0xff, 0x3a, 0x30, 0x1d, 0xff, 0x4b, 0x2d, 0x0d, 0xff, 0x48, 0x39, 0x2f, 0xff, 0x3c, 0x2f, 0x1c, 0xff, 0x30, 0x19, 0x00, 0xff, 0x30, 0x16, 0x00, 0xff, 0x40, 0x21, 0x00, 0xff, 0x44, 0x24, 0x00, 0xff, 0x41, 0x1d, 0x00, 0xff, 0x30, 0x27, 0x18, 0xff, 0x45, 0x5c, 0x6f, 0xff, 0x5c, 0x60, 0x63, 0xff, 0x27, 0x18, 0x19, 0xff, 0x48, 0x5b, 0x69, 0xff, 0x2c, 0x78, 0xae, 0xff, 0x24, 0x55, 0x80, 0xff, 0x29, 0x1e, 0x0e, 0xff, 0x4e, 0x47, 0x42, 0xff, 0x96, 0x9c, 0x9d, 0xff, 0x4b, 0x35, 0x29, 0xff, 0x24, 0x23, 0x1a, 0xff, 0x16, 0x6e, 0xab, 0xff, 0x2c, 0x54, 0x77, 0xff, 0x0e, 0x4d, 0x77, 0xff, 0x07, 0x4e, 0x89, 0xff, 0x2d, 0x31, 0x38, 0xff, 0x26, 0x0b, 0x00, 0xff, 0x5c, 0x60, 0x5b, 0xff, 0x68, 0x6c, 0x68, 0xff, 0x1d, 0x19, 0x10, 0xff, 0x10, 0x02, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x09, 0x0a, 0x0a, 0xff, 0x41, 0x3d, 0x3d, 0xff, 0x69, 0x6a, 0x66, 0xff, 0x2f, 0x1b, 0x03, 0xff, 0x12, 0x05, 0x00, 0xff, 0x20, 0x3f, 0x56, 0xff, 0x37, 0x40, 0x47, 0xff, 0x24, 0x63, 0x8f, 0xff, 0x1e, 0x32, 0x3d, 0xff, 0x03, 0x00, 0x00, 0xff, 0x11, 0x00, 0x00, 0xff, 0xa4, 0x9e, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x65, 0x66, 0x5f, 0xff, 0x16, 0x00, 0x00, 0xff, 0x31, 0x34, 0x35, 0xff, 0x36, 0x51, 0x6b, 0xff, 0x21, 0x6e, 0x9c, 0xff, 0x5d, 0x9d, 0xc6, 0xff, 0x44, 0x59, 0x66, 0xff, 0x27, 0x30, 0x36, 0xff, 0x28, 0x74, 0xa6, 0xff, 0x24, 0x67, 0x91, 0xff, 0x21, 0x4a, 0x69, 0xff, 0x1b, 0x43, 0x65, 0xff, 0x28, 0x12, 0x0c, 0xff, 0x6e, 0x7a, 0x92, 0xff, 0x95, 0xa4, 0xb0, 0xff, 0x3a, 0x71, 0x96, 0xff, 0x45, 0x86, 0xb4, 0xff, 0x56, 0x80, 0xa8, 0xff, 0x3b, 0xa0, 0xdf, 0xff, 0x4f, 0x67, 0x76, 0xff, 0x38, 0x37, 0x31, 0xff, 0x85, 0x8e, 0x95, 0xff, 0x7b, 0x87, 0x8d, 0xff, 0x47, 0x37, 0x26, 0xff, 0x44, 0x2d, 0x17, 0xff, 0x50, 0x36, 0x22, 0xff, 0x57, 0x3c, 0x27, 0xff, 0x59, 0x43, 0x37, 0xff, 0x52, 0x3c, 0x27, 0xff, 0x45, 0x27, 0x0f, 0xff, 0xa0, 0x96, 0x94, 0xff, 0xe6, 0xef, 0xee, 0xff, 0xd6, 0xd5, 0xd2, 0xff, 0xd0, 0xd0, 0xd1, 0xff, 0xce, 0xd1, 0xd2, 0xff, 0xcf, 0xd1, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xc9, 0xcb, 0xcb, 0xfe, 0xcc, 0xcc, 0xcc, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xcc, 0xcc, 0xb4, 0xcb, 0xcd, 0xcd, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xce, 0xcf, 0xff, 0xc7, 0xcf, 0xcc, 0xff, 0xdc, 0xdf, 0xd9, 0xff, 0xef, 0xde, 0xd8, 0xff, 0x82, 0x9c, 0xa6, 0xff, 0x3b, 0x57, 0x6c, 0xff, 0x3b, 0x40, 0x4c, 0xff, 0x3b, 0x2f, 0x22, 0xff, 0x20, 0x08, 0x00, 0xff, 0x64, 0x55, 0x45, 0xff, 0x54, 0x58, 0x66, 0xff, 0x54, 0x48, 0x43, 0xff, 0x6b, 0x5c, 0x58, 0xff, 0x5e, 0x5c, 0x5a, 0xff, 0x41, 0x3d, 0x39, 0xff, 0x2a, 0x22, 0x21, 0xff, 0x31, 0x28, 0x1f, 0xff, 0x3a, 0x2d, 0x20, 0xff, 0x41, 0x35, 0x2b, 0xff, 0x4d, 0x3c, 0x30, 0xff, 0x43, 0x50, 0x59, 0xff, 0x67, 0x8c, 0xa5, 0xff, 0x66, 0x6a, 0x6b, 0xff, 0x2a, 0x2a, 0x25, 0xff, 0x47, 0x50, 0x53, 0xff, 0x22, 0x7b, 0xb7, 0xff, 0x0b, 0x90, 0xd4, 0xff, 0x27, 0x51, 0x73, 0xff, 0x55, 0x82, 0xb3, 0xff, 0x97, 0xce, 0xf5, 0xff, 0x48, 0x68, 0x81, 0xff, 0x1b, 0x53, 0x79, 0xff, 0x03, 0xa3, 0xff, 0xff, 0x0f, 0x7e, 0xbd, 0xff, 0x0a, 0x8c, 0xe4, 0xff, 0x05, 0x64, 0xa0, 0xff, 0x12, 0x2f, 0x47, 0xff, 0x3e, 0x40, 0x3c, 0xff, 0xd1, 0xd9, 0xd2, 0xff, 0xd2, 0xe5, 0xef, 0xff, 0x46, 0x46, 0x41, 0xff, 0x06, 0x0d, 0x11, 0xff, 0x0c, 0x0a, 0x04, 0xff, 0x0e, 0x00, 0x00, 0xff, 0x0b, 0x03, 0x00, 0xff, 0x19, 0x15, 0x11, 0xff, 0x3c, 0x2e, 0x23, 0xff, 0x37, 0x55, 0x6d, 0xff, 0x07, 0x8e, 0xdf, 0xff, 0x11, 0x85, 0xc9, 0xff, 0x12, 0x80, 0xc3, 0xff, 0x12, 0x37, 0x53, 0xff, 0x07, 0x02, 0x04, 0xff, 0x14, 0x0a, 0x04, 0xff, 0x7b, 0x7a, 0x73, 0xff, 0xc6, 0xd8, 0xda, 0xff, 0x5b, 0x5b, 0x53, 0xff, 0x22, 0x06, 0x00, 0xff, 0x3c, 0x42, 0x4b, 0xff, 0x48, 0x58, 0x75, 0xff, 0x1b, 0x60, 0x90, 0xff, 0x5a, 0x96, 0xbf, 0xff, 0x3b, 0x58, 0x6e, 0xff, 0x1e, 0x3e, 0x57, 0xff, 0x0e, 0x97, 0xe9, 0xff, 0x0b, 0x9b, 0xe7, 0xff, 0x11, 0x8f, 0xd0, 0xff, 0x11, 0x96, 0xe4, 0xff, 0x29, 0x4a, 0x6c, 0xff, 0x54, 0x82, 0xb5, 0xff, 0x96, 0xc5, 0xe5, 0xff, 0x28, 0x5a, 0x82, 0xff, 0x1f, 0x3c, 0x52, 0xff, 0x32, 0x43, 0x50, 0xff, 0x35, 0x6d, 0x9f, 0xff, 0x43, 0x44, 0x41, 0xff, 0x24, 0x18, 0x0f, 0xff, 0x6e, 0x62, 0x56, 0xff, 0x57, 0x69, 0x72, 0xff, 0x49, 0x52, 0x58, 0xff, 0x5d, 0x56, 0x56, 0xff, 0x5f, 0x60, 0x62, 0xff, 0x69, 0x68, 0x69, 0xff, 0x73, 0x66, 0x5f, 0xff, 0x6e, 0x57, 0x44, 0xff, 0x5b, 0x43, 0x2b, 0xff, 0x50, 0x30, 0x14, 0xff, 0x9b, 0x99, 0x8e, 0xff, 0xe3, 0xec, 0xed, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xcc, 0xcf, 0xd0, 0xff, 0xce, 0xd0, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xc9, 0xcc, 0xcc, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0xcb, 0xcb, 0x40, 0xcb, 0xcd, 0xcd, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xce, 0xcf, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xca, 0xcc, 0xca, 0xff, 0xe5, 0xe3, 0xe7, 0xff, 0xd4, 0xd8, 0xe0, 0xff, 0x78, 0x7c, 0x7c, 0xff, 0x3b, 0x31, 0x27, 0xff, 0x2c, 0x3f, 0x46, 0xff, 0x27, 0x68, 0x9d, 0xff, 0x3c, 0x3d, 0x4b, 0xff, 0x3c, 0x34, 0x1f, 0xff, 0x7b, 0x8b, 0x94, 0xff, 0x5c, 0x73, 0x89, 0xff, 0x52, 0x4a, 0x3d, 0xff, 0x45, 0x39, 0x25, 0xff, 0x3c, 0x2e, 0x19, 0xff, 0x40, 0x2f, 0x1d, 0xff, 0x59, 0x4a, 0x44, 0xff, 0x64, 0x5c, 0x5f, 0xff, 0x5e, 0x56, 0x53, 0xff, 0x54, 0x50, 0x4a, 0xff, 0x55, 0x48, 0x39, 0xff, 0x41, 0x40, 0x40, 0xff, 0x59, 0x67, 0x74, 0xff, 0x3f, 0x31, 0x1d, 0xff, 0x0b, 0x00, 0x00, 0xff, 0x26, 0x2c, 0x38, 0xff, 0x0b, 0x89, 0xdc, 0xff, 0x13, 0x8a, 0xcb, 0xff, 0x2d, 0x36, 0x4a, 0xff, 0x5d, 0x7c, 0x9c, 0xff, 0x9b, 0xc4, 0xe8, 0xff, 0x45, 0x56, 0x73, 0xff, 0x23, 0x47, 0x64, 0xff, 0x0d, 0x91, 0xde, 0xff, 0x1c, 0x63, 0x92, 0xff, 0x0f, 0x6e, 0xaf, 0xff, 0x19, 0x72, 0xa7, 0xff, 0x1c, 0x22, 0x2f, 0xff, 0x28, 0x41, 0x60, 0xff, 0x72, 0x75, 0x74, 0xff, 0x66, 0x6a, 0x5d, 0xff, 0x3b, 0x2d, 0x1e, 0xff, 0x25, 0x27, 0x2a, 0xff, 0x25, 0x2d, 0x38, 0xff, 0x17, 0x18, 0x1a, 0xff, 0x08, 0x04, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1c, 0x21, 0x24, 0xff, 0x44, 0x5a, 0x77, 0xff, 0x0e, 0x98, 0xe3, 0xff, 0x07, 0x8d, 0xd4, 0xff, 0x10, 0x22, 0x2f, 0xff, 0x1e, 0x1c, 0x22, 0xff, 0x2f, 0x36, 0x41, 0xff, 0x15, 0x23, 0x32, 0xff, 0x56, 0x4f, 0x47, 0xff, 0x48, 0x39, 0x20, 0xff, 0x1e, 0x09, 0x00, 0xff, 0x33, 0x3d, 0x3c, 0xff, 0x44, 0x61, 0x87, 0xff, 0x39, 0x49, 0x5f, 0xff, 0x17, 0x60, 0x8a, 0xff, 0x67, 0x93, 0xb6, 0xff, 0x37, 0x4d, 0x60, 0xff, 0x20, 0x37, 0x48, 0xff, 0x17, 0x87, 0xc8, 0xff, 0x12, 0x80, 0xbe, 0xff, 0x12, 0x7d, 0xba, 0xff, 0x0e, 0x94, 0xe2, 0xff, 0x2e, 0x40, 0x5d, 0xff, 0x54, 0x68, 0x7e, 0xff, 0xa9, 0xc6, 0xde, 0xff, 0x3f, 0x8c, 0xc8, 0xff, 0x11, 0x5a, 0x82, 0xff, 0x23, 0x51, 0x6e, 0xff, 0x1b, 0x51, 0x83, 0xff, 0x21, 0x0a, 0x00, 0xff, 0x0e, 0x00, 0x00, 0xff, 0x5b, 0x49, 0x3d, 0xff, 0x39, 0x4b, 0x54, 0xff, 0x33, 0x2a, 0x1d, 0xff, 0x4d, 0x2e, 0x10, 0xff, 0x47, 0x2d, 0x0d, 0xff, 0x44, 0x2e, 0x13, 0xff, 0x41, 0x33, 0x1d, 0xff, 0x50, 0x45, 0x32, 0xff, 0x66, 0x5c, 0x4e, 0xff, 0x62, 0x44, 0x2b, 0xff, 0x42, 0x41, 0x3e, 0xff, 0x9e, 0xb9, 0xc6, 0xff, 0xe5, 0xe7, 0xe3, 0xff, 0xd1, 0xd1, 0xd0, 0xff, 0xce, 0xcf, 0xd0, 0xff, 0xcf, 0xd0, 0xd1, 0xff, 0xce, 0xd0, 0xcf, 0xff, 0xce, 0xd0, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xcc, 0xcc, 0xcd, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xce, 0xd0, 0xff, 0xc8, 0xcc, 0xcc, 0xff, 0xe0, 0xe5, 0xdf, 0xff, 0xca, 0xbe, 0xbb, 0xff, 0x4f, 0x5d, 0x6d, 0xff, 0x16, 0x66, 0x99, 0xff, 0x28, 0x68, 0x8e, 0xff, 0x44, 0x71, 0x94, 0xff, 0x3b, 0x91, 0xcb, 0xff, 0x40, 0x46, 0x4e, 0xff, 0x45, 0x3c, 0x2d, 0xff, 0x6f, 0x6e, 0x6d, 0xff, 0x3b, 0x3e, 0x44, 0xff, 0x39, 0x1f, 0x02, 0xff, 0x2f, 0x18, 0x00, 0xff, 0x17, 0x09, 0x00, 0xff, 0x15, 0x05, 0x00, 0xff, 0x37, 0x21, 0x0f, 0xff, 0x3f, 0x2d, 0x11, 0xff, 0x3a, 0x26, 0x03, 0xff, 0x30, 0x18, 0x00, 0xff, 0x2e, 0x0c, 0x00, 0xff, 0x1a, 0x0f, 0x01, 0xff, 0x40, 0x4d, 0x56, 0xff, 0x3f, 0x34, 0x31, 0xff, 0x1d, 0x1c, 0x1c, 0xff, 0x2e, 0x73, 0x9f, 0xff, 0x00, 0xa4, 0xfd, 0xff, 0x10, 0x80, 0xc8, 0xff, 0x28, 0x3b, 0x5d, 0xff, 0x64, 0x90, 0xb5, 0xff, 0x9e, 0xc6, 0xe9, 0xff, 0x3d, 0x52, 0x7a, 0xff, 0x18, 0x57, 0x81, 0xff, 0x00, 0xa6, 0xfc, 0xff, 0x11, 0x7d, 0xc1, 0xff, 0x03, 0x86, 0xcf, 0xff, 0x12, 0x8c, 0xcf, 0xff, 0x21, 0x3b, 0x52, 0xff, 0x06, 0x2e, 0x54, 0xff, 0x27, 0x35, 0x42, 0xff, 0x29, 0x03, 0x00, 0xff, 0x19, 0x14, 0x14, 0xff, 0x30, 0x55, 0x7d, 0xff, 0x2e, 0x57, 0x7c, 0xff, 0x29, 0x3d, 0x4b, 0xff, 0x18, 0x26, 0x35, 0xff, 0x05, 0x0b, 0x0e, 0xff, 0x07, 0x0a, 0x11, 0xff, 0x37, 0x3a, 0x48, 0xff, 0x1a, 0x76, 0xaf, 0xff, 0x06, 0x58, 0x90, 0xff, 0x1c, 0x2c, 0x3f, 0xff, 0x29, 0x48, 0x64, 0xff, 0x42, 0x63, 0x8a, 0xff, 0x27, 0x3e, 0x55, 0xff, 0x20, 0x18, 0x11, 0xff, 0x28, 0x15, 0x00, 0xff, 0x2a, 0x22, 0x1b, 0xff, 0x39, 0x5b, 0x7c, 0xff, 0x41, 0x5e, 0x73, 0xff, 0x37, 0x4d, 0x5e, 0xff, 0x21, 0x74, 0xad, 0xff, 0x62, 0x9a, 0xbf, 0xff, 0x2f, 0x53, 0x6b, 0xff, 0x22, 0x48, 0x64, 0xff, 0x0b, 0x98, 0xe0, 0xff, 0x05, 0x92, 0xdc, 0xff, 0x0e, 0x89, 0xd4, 0xff, 0x06, 0x9e, 0xea, 0xff, 0x1e, 0x4e, 0x7a, 0xff, 0x48, 0x75, 0xa4, 0xff, 0xa6, 0xc9, 0xe7, 0xff, 0x4b, 0x8d, 0xb7, 0xff, 0x0a, 0x81, 0xc9, 0xff, 0x16, 0x8f, 0xda, 0xff, 0x11, 0x9e, 0xe3, 0xff, 0x31, 0x4e, 0x5e, 0xff, 0x1e, 0x31, 0x3e, 0xff, 0x60, 0x77, 0x8c, 0xff, 0x32, 0x87, 0xbc, 0xff, 0x38, 0x63, 0x7e, 0xff, 0x3f, 0x3c, 0x3a, 0xff, 0x33, 0x25, 0x14, 0xff, 0x35, 0x2b, 0x1c, 0xff, 0x37, 0x2d, 0x21, 0xff, 0x37, 0x28, 0x16, 0xff, 0x3b, 0x22, 0x06, 0xff, 0x44, 0x32, 0x18, 0xff, 0x3f, 0x51, 0x68, 0xff, 0x44, 0x5f, 0x74, 0xff, 0xb1, 0xb3, 0xb0, 0xff, 0xe8, 0xe9, 0xe9, 0xff, 0xd2, 0xd2, 0xcf, 0xff, 0xce, 0xce, 0xd1, 0xff, 0xcc, 0xcf, 0xce, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xc9, 0xcc, 0xcc, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xcc, 0xcc, 0x51, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcb, 0xcc, 0xcc, 0xff, 0xc8, 0xcc, 0xcc, 0xff, 0xd9, 0xda, 0xd9, 0xff, 0xcc, 0xd0, 0xd6, 0xff, 0x3e, 0x4c, 0x51, 0xff, 0x20, 0x3a, 0x4d, 0xff, 0x20, 0x81, 0xb9, 0xff, 0x1d, 0x64, 0x98, 0xff, 0x2a, 0x46, 0x64, 0xff, 0x38, 0x5a, 0x7a, 0xff, 0x2b, 0x17, 0x08, 0xff, 0x31, 0x24, 0x0f, 0xff, 0x4b, 0x67, 0x72, 0xff, 0x24, 0x41, 0x5d, 0xff, 0x47, 0x55, 0x66, 0xff, 0x41, 0x4d, 0x61, 0xff, 0x28, 0x1a, 0x13, 0xff, 0x2f, 0x1c, 0x08, 0xff, 0x2f, 0x1c, 0x04, 0xff, 0x2c, 0x1c, 0x0a, 0xff, 0x32, 0x26, 0x16, 0xff, 0x3a, 0x31, 0x29, 0xff, 0x42, 0x33, 0x2d, 0xff, 0x27, 0x4f, 0x6b, 0xff, 0x4e, 0x90, 0xc0, 0xff, 0x3f, 0x51, 0x5f, 0xff, 0x12, 0x44, 0x63, 0xff, 0x2a, 0x77, 0xa5, 0xff, 0x0d, 0x8c, 0xcf, 0xff, 0x1a, 0x6a, 0x98, 0xff, 0x2f, 0x2f, 0x3a, 0xff, 0x74, 0x92, 0xac, 0xff, 0x95, 0xc5, 0xe3, 0xff, 0x35, 0x49, 0x63, 0xff, 0x27, 0x48, 0x5b, 0xff, 0x0e, 0x8a, 0xd4, 0xff, 0x1d, 0x65, 0x91, 0xff, 0x11, 0x6b, 0xa4, 0xff, 0x1d, 0x65, 0x8f, 0xff, 0x2e, 0x2c, 0x25, 0xff, 0x0a, 0x13, 0x16, 0xff, 0x26, 0x38, 0x3f, 0xff, 0x2d, 0x1b, 0x08, 0xff, 0x16, 0x11, 0x0e, 0xff, 0x3a, 0x47, 0x51, 0xff, 0x42, 0x4d, 0x56, 0xff, 0x3c, 0x4d, 0x58, 0xff, 0x2b, 0x42, 0x55, 0xff, 0x1d, 0x26, 0x30, 0xff, 0x2b, 0x1e, 0x11, 0xff, 0x17, 0x21, 0x26, 0xff, 0x06, 0x2c, 0x4f, 0xff, 0x1b, 0x2d, 0x44, 0xff, 0x27, 0x30, 0x3a, 0xff, 0x30, 0x37, 0x3b, 0xff, 0x46, 0x39, 0x26, 0xff, 0x3a, 0x2a, 0x0e, 0xff, 0x0d, 0x00, 0x00, 0xff, 0x08, 0x01, 0x00, 0xff, 0x35, 0x27, 0x16, 0xff, 0x56, 0x37, 0x26, 0xff, 0x48, 0x2d, 0x0d, 0xff, 0x43, 0x2b, 0x0a, 0xff, 0x47, 0x4b, 0x59, 0xff, 0x6e, 0x6b, 0x6f, 0xff, 0x33, 0x23, 0x15, 0xff, 0x37, 0x1f, 0x07, 0xff, 0x2c, 0x66, 0x92, 0xff, 0x23, 0x6c, 0x9f, 0xff, 0x1e, 0x6b, 0x99, 0xff, 0x14, 0x8b, 0xcc, 0xff, 0x2c, 0x42, 0x4a, 0xff, 0x52, 0x4c, 0x57, 0xff, 0xa9, 0xa8, 0xaa, 0xff, 0x60, 0x57, 0x54, 0xff, 0x25, 0x5a, 0x87, 0xff, 0x10, 0x8b, 0xd2, 0xff, 0x0f, 0x95, 0xdd, 0xff, 0x2e, 0x55, 0x72, 0xff, 0x1b, 0x3e, 0x54, 0xff, 0x5a, 0x81, 0x9f, 0xff, 0x2d, 0x73, 0xa2, 0xff, 0x36, 0x59, 0x6f, 0xff, 0x45, 0x5c, 0x73, 0xff, 0x3a, 0x61, 0x80, 0xff, 0x3e, 0x61, 0x81, 0xff, 0x43, 0x63, 0x88, 0xff, 0x44, 0x60, 0x7e, 0xff, 0x3f, 0x52, 0x61, 0xff, 0x4c, 0x64, 0x77, 0xff, 0x3a, 0x75, 0xa2, 0xff, 0x39, 0x31, 0x2f, 0xff, 0x48, 0x54, 0x5c, 0xff, 0xb2, 0xc3, 0xcc, 0xff, 0xe9, 0xe7, 0xe0, 0xff, 0xca, 0xce, 0xcb, 0xff, 0xcd, 0xcf, 0xd0, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xc9, 0xcc, 0xcc, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xc9, 0xcc, 0xcc, 0xce, 0xca, 0xcc, 0xcc, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xc9, 0xcc, 0xce, 0xff, 0xde, 0xe1, 0xda, 0xff, 0x75, 0x6d, 0x67, 0xff, 0x0e, 0x48, 0x6d, 0xff, 0x19, 0x8a, 0xc8, 0xff, 0x26, 0x49, 0x64, 0xff, 0x37, 0x26, 0x32, 0xff, 0x1d, 0x4c, 0x71, 0xff, 0x17, 0x59, 0x7a, 0xff, 0x19, 0x1b, 0x15, 0xff, 0x3c, 0x4c, 0x56, 0xff, 0x57, 0x9a, 0xcd, 0xff, 0x1f, 0x65, 0x9e, 0xff, 0x3f, 0x48, 0x5a, 0xff, 0x2f, 0x36, 0x45, 0xff, 0x29, 0x2e, 0x41, 0xff, 0x39, 0x55, 0x76, 0xff, 0x3d, 0x57, 0x6d, 0xff, 0x3e, 0x56, 0x71, 0xff, 0x3a, 0x5a, 0x7b, 0xff, 0x3a, 0x5b, 0x75, 0xff, 0x3b, 0x49, 0x5a, 0xff, 0x1e, 0x5a, 0x90, 0xff, 0x48, 0x8a, 0xba, 0xff, 0x3f, 0x45, 0x4f, 0xff, 0x1c, 0x4f, 0x76, 0xff, 0x37, 0x4b, 0x65, 0xff, 0x24, 0x61, 0x9a, 0xff, 0x31, 0x3f, 0x49, 0xff, 0x3a, 0x0e, 0x00, 0xff, 0x8a, 0x7a, 0x7c, 0xff, 0xa7, 0x96, 0xa0, 0xff, 0x44, 0x18, 0x0f, 0xff, 0x2f, 0x2e, 0x28, 0xff, 0x1d, 0x64, 0xa3, 0xff, 0x2f, 0x3e, 0x58, 0xff, 0x21, 0x4b, 0x75, 0xff, 0x2a, 0x49, 0x62, 0xff, 0x2b, 0x0b, 0x00, 0xff, 0x1c, 0x13, 0x05, 0xff, 0x35, 0x31, 0x2a, 0xff, 0x08, 0x13, 0x24, 0xff, 0x11, 0x04, 0x00, 0xff, 0x1f, 0x03, 0x00, 0xff, 0x47, 0x1f, 0x02, 0xff, 0x4f, 0x2d, 0x12, 0xff, 0x4f, 0x36, 0x23, 0xff, 0x37, 0x28, 0x1f, 0xff, 0x15, 0x0e, 0x0d, 0xff, 0x04, 0x13, 0x27, 0xff, 0x10, 0x34, 0x57, 0xff, 0x32, 0x23, 0x1f, 0xff, 0x2e, 0x11, 0x00, 0xff, 0x39, 0x20, 0x0c, 0xff, 0x39, 0x1e, 0x03, 0xff, 0x33, 0x1a, 0x02, 0xff, 0x38, 0x22, 0x18, 0xff, 0x30, 0x1e, 0x1a, 0xff, 0x4b, 0x30, 0x21, 0xff, 0x53, 0x3c, 0x28, 0xff, 0x4a, 0x34, 0x28, 0xff, 0x42, 0x31, 0x2b, 0xff, 0x43, 0x52, 0x66, 0xff, 0x77, 0x78, 0x7c, 0xff, 0x35, 0x31, 0x29, 0xff, 0x3c, 0x27, 0x19, 0xff, 0x35, 0x62, 0x8f, 0xff, 0x2e, 0x54, 0x7e, 0xff, 0x32, 0x47, 0x6b, 0xff, 0x24, 0x5f, 0x95, 0xff, 0x3d, 0x1d, 0x14, 0xff, 0x51, 0x33, 0x2e, 0xff, 0x9a, 0x9f, 0xad, 0xff, 0x74, 0x5f, 0x65, 0xff, 0x42, 0x45, 0x54, 0xff, 0x05, 0x93, 0xdf, 0xff, 0x08, 0xa3, 0xf4, 0xff, 0x30, 0x54, 0x71, 0xff, 0x21, 0x3a, 0x51, 0xff, 0x5c, 0x82, 0x9d, 0xff, 0x32, 0x69, 0x94, 0xff, 0x38, 0x59, 0x73, 0xff, 0x41, 0x5f, 0x81, 0xff, 0x3e, 0x62, 0x8a, 0xff, 0x38, 0x4d, 0x64, 0xff, 0x38, 0x42, 0x49, 0xff, 0x40, 0x4e, 0x5b, 0xff, 0x3c, 0x55, 0x71, 0xff, 0x47, 0x73, 0x92, 0xff, 0x68, 0x91, 0xb4, 0xff, 0x36, 0x51, 0x61, 0xff, 0x2d, 0x4c, 0x60, 0xff, 0x54, 0x50, 0x53, 0xff, 0xc5, 0xc0, 0xb8, 0xff, 0xd9, 0xe2, 0xe1, 0xff, 0xcc, 0xcc, 0xcd, 0xff, 0xcd, 0xcf, 0xcf, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xca, 0xcd, 0xcb, 0xff, 0xc9, 0xcd, 0xcb, 0xce, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xcc, 0xcc, 0x46, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xc9, 0xcc, 0xcb, 0xff, 0xd9, 0xd9, 0xde, 0xff, 0xb1, 0xb2, 0xab, 0xff, 0x3a, 0x24, 0x0c, 0xff, 0x2a, 0x5c, 0x7c, 0xff, 0x0b, 0x7f, 0xc6, 0xff, 0x21, 0x42, 0x65, 0xff, 0x89, 0x96, 0xa0, 0xff, 0x48, 0xab, 0xe8, 0xff, 0x02, 0x81, 0xcc, 0xff, 0x14, 0x29, 0x2d, 0xff, 0x45, 0x4a, 0x54, 0xff, 0x51, 0x8a, 0xad, 0xff, 0x19, 0x60, 0x90, 0xff, 0x3e, 0x44, 0x58, 0xff, 0x29, 0x21, 0x20, 0xff, 0x2e, 0x2d, 0x2f, 0xff, 0x39, 0x4e, 0x64, 0xff, 0x37, 0x4b, 0x60, 0xff, 0x36, 0x4b, 0x5e, 0xff, 0x3c, 0x4d, 0x61, 0xff, 0x39, 0x4b, 0x5a, 0xff, 0x3a, 0x3e, 0x48, 0xff, 0x26, 0x68, 0x9d, 0xff, 0x3f, 0x69, 0x85, 0xff, 0x37, 0x47, 0x58, 0xff, 0x49, 0x85, 0xb5, 0xff, 0x54, 0x78, 0x94, 0xff, 0x39, 0x92, 0xd4, 0xff, 0x4b, 0x65, 0x7d, 0xff, 0x50, 0x39, 0x36, 0xff, 0x90, 0x97, 0xa2, 0xff, 0xac, 0xad, 0xbc, 0xff, 0x5b, 0x48, 0x44, 0xff, 0x50, 0x66, 0x73, 0xff, 0x41, 0x9b, 0xdf, 0xff, 0x55, 0x75, 0x96, 0xff, 0x47, 0x85, 0xb6, 0xff, 0x4a, 0x7f, 0xa6, 0xff, 0x54, 0x4b, 0x44, 0xff, 0x5b, 0x5b, 0x5d, 0xff, 0x88, 0x89, 0x8f, 0xff, 0x52, 0x6c, 0x82, 0xff, 0x6d, 0x5f, 0x5a, 0xff, 0x49, 0x3b, 0x34, 0xff, 0x32, 0x25, 0x22, 0xff, 0x39, 0x2c, 0x25, 0xff, 0x64, 0x4c, 0x3c, 0xff, 0x36, 0x57, 0x64, 0xff, 0x0e, 0x33, 0x49, 0xff, 0x44, 0x71, 0x9e, 0xff, 0x6a, 0xa5, 0xd5, 0xff, 0x60, 0x5b, 0x58, 0xff, 0x4f, 0x46, 0x3a, 0xff, 0x78, 0x70, 0x68, 0xff, 0x6f, 0x64, 0x61, 0xff, 0x6e, 0x5e, 0x54, 0xff, 0x88, 0x7e, 0x76, 0xff, 0x92, 0x8a, 0x83, 0xff, 0x96, 0x8e, 0x84, 0xff, 0x92, 0x86, 0x7b, 0xff, 0x8e, 0x7f, 0x70, 0xff, 0x8c, 0x84, 0x7d, 0xff, 0x83, 0xa2, 0xb6, 0xff, 0xad, 0xb6, 0xb6, 0xff, 0x76, 0x78, 0x6d, 0xff, 0x7a, 0x76, 0x6b, 0xff, 0x7a, 0xb6, 0xdc, 0xff, 0x77, 0xab, 0xd0, 0xff, 0x77, 0x9e, 0xc5, 0xff, 0x5b, 0xac, 0xe5, 0xff, 0x6d, 0x6d, 0x72, 0xff, 0x8c, 0x83, 0x89, 0xff, 0xd1, 0xdd, 0xea, 0xff, 0xab, 0xaf, 0xb1, 0xff, 0x8a, 0x71, 0x64, 0xff, 0x2d, 0x68, 0x90, 0xff, 0x16, 0x7e, 0xbb, 0xff, 0x2b, 0x47, 0x5a, 0xff, 0x1d, 0x41, 0x59, 0xff, 0x60, 0x94, 0xb4, 0xff, 0x31, 0x68, 0x92, 0xff, 0x2f, 0x44, 0x56, 0xff, 0x41, 0x56, 0x6b, 0xff, 0x41, 0x5b, 0x6f, 0xff, 0x35, 0x52, 0x71, 0xff, 0x31, 0x4f, 0x73, 0xff, 0x3b, 0x5b, 0x7f, 0xff, 0x41, 0x69, 0x8a, 0xff, 0x27, 0x21, 0x22, 0xff, 0x45, 0x51, 0x51, 0xff, 0x53, 0xa6, 0xe0, 0xff, 0x3a, 0x60, 0x7e, 0xff, 0x34, 0x11, 0x00, 0xff, 0x60, 0x52, 0x40, 0xff, 0xdd, 0xe2, 0xe8, 0xff, 0xd1, 0xd3, 0xd2, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcd, 0xcb, 0xff, 0xc9, 0xcc, 0xcc, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xcc, 0xcc, 0xb4, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xc9, 0xcb, 0xcb, 0xff, 0xc9, 0xcb, 0xcb, 0xff, 0xc8, 0xca, 0xca, 0xff, 0xe6, 0xe9, 0xec, 0xff, 0x8d, 0x90, 0x86, 0xff, 0x00, 0x03, 0x00, 0xff, 0x23, 0x3a, 0x53, 0xff, 0x20, 0x26, 0x29, 0xff, 0x7c, 0x82, 0x8d, 0xff, 0x9b, 0xd7, 0xff, 0xff, 0x18, 0x72, 0xb7, 0xff, 0x08, 0x65, 0x9b, 0xff, 0x20, 0x1f, 0x27, 0xff, 0x43, 0x4d, 0x5e, 0xff, 0x47, 0x91, 0xc3, 0xff, 0x1e, 0x65, 0x8c, 0xff, 0x39, 0x3d, 0x47, 0xff, 0x1e, 0x24, 0x30, 0xff, 0x2d, 0x48, 0x62, 0xff, 0x33, 0x53, 0x73, 0xff, 0x33, 0x50, 0x74, 0xff, 0x32, 0x57, 0x7a, 0xff, 0x35, 0x58, 0x7b, 0xff, 0x33, 0x53, 0x70, 0xff, 0x32, 0x46, 0x57, 0xff, 0x29, 0x66, 0x8b, 0xff, 0x55, 0x60, 0x63, 0xff, 0x69, 0x93, 0xb0, 0xff, 0x7f, 0xba, 0xe5, 0xff, 0x85, 0xa3, 0xb5, 0xff, 0x6f, 0xc1, 0xf4, 0xff, 0x82, 0x96, 0xa0, 0xff, 0x8c, 0x7d, 0x71, 0xff, 0xc7, 0xd5, 0xd7, 0xff, 0xce, 0xda, 0xdd, 0xff, 0x8c, 0x7d, 0x73, 0xff, 0x80, 0x94, 0xa1, 0xff, 0x71, 0xc4, 0xfa, 0xff, 0x86, 0xa6, 0xbc, 0xff, 0x73, 0xb5, 0xdc, 0xff, 0x7a, 0xad, 0xcd, 0xff, 0x84, 0x75, 0x66, 0xff, 0x76, 0x7c, 0x72, 0xff, 0xb5, 0xbb, 0xba, 0xff, 0x83, 0x9d, 0xb0, 0xff, 0x8a, 0x83, 0x7d, 0xff, 0x94, 0x8a, 0x7d, 0xff, 0x80, 0x7a, 0x6e, 0xff, 0x62, 0x5b, 0x4d, 0xff, 0x32, 0x2e, 0x27, 0xff, 0x7f, 0x9b, 0xb6, 0xff, 0xbc, 0xce, 0xce, 0xff, 0x75, 0xb3, 0xde, 0xff, 0x61, 0x94, 0xc1, 0xff, 0x79, 0x6e, 0x5c, 0xff, 0x78, 0x74, 0x68, 0xff, 0x8e, 0x85, 0x7b, 0xff, 0x7a, 0x73, 0x6c, 0xff, 0x80, 0x78, 0x6e, 0xff, 0x7f, 0x77, 0x70, 0xff, 0x75, 0x6f, 0x68, 0xff, 0x74, 0x68, 0x65, 0xff, 0x71, 0x60, 0x61, 0xff, 0x6f, 0x5f, 0x5b, 0xff, 0x6d, 0x67, 0x67, 0xff, 0x60, 0x7e, 0x9b, 0xff, 0x88, 0x8c, 0x96, 0xff, 0x4f, 0x4a, 0x4a, 0xff, 0x51, 0x4a, 0x48, 0xff, 0x57, 0x96, 0xc6, 0xff, 0x65, 0xa1, 0xcd, 0xff, 0x6d, 0x96, 0xb3, 0xff, 0x63, 0xb5, 0xf0, 0xff, 0x7e, 0x86, 0x90, 0xff, 0x90, 0x8b, 0x8f, 0xff, 0xc2, 0xd2, 0xda, 0xff, 0x74, 0x72, 0x7f, 0xff, 0x52, 0x3f, 0x3a, 0xff, 0x4b, 0x68, 0x8c, 0xff, 0x2c, 0x54, 0x81, 0xff, 0x30, 0x18, 0x06, 0xff, 0x28, 0x17, 0x05, 0xff, 0x72, 0x6b, 0x67, 0xff, 0x3c, 0x3d, 0x43, 0xff, 0x39, 0x1a, 0x04, 0xff, 0x47, 0x24, 0x09, 0xff, 0x4a, 0x29, 0x08, 0xff, 0x44, 0x2c, 0x18, 0xff, 0x46, 0x37, 0x27, 0xff, 0x48, 0x39, 0x32, 0xff, 0x3a, 0x47, 0x50, 0xff, 0x35, 0x5e, 0x7b, 0xff, 0x11, 0x2e, 0x46, 0xff, 0x51, 0x73, 0x84, 0xff, 0x62, 0x70, 0x7b, 0xff, 0x1c, 0x0b, 0x00, 0xff, 0x39, 0x20, 0x02, 0xff, 0xb9, 0xb5, 0xb8, 0xff, 0xdd, 0xe2, 0xe8, 0xff, 0xcb, 0xcd, 0xcb, 0xff, 0xcb, 0xce, 0xcd, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xcb, 0xcd, 0xcd, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xca, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xca, 0xca, 0x27, 0xc8, 0xca, 0xca, 0xfa, 0xc9, 0xcb, 0xcb, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xc8, 0xca, 0xca, 0xff, 0xc6, 0xc8, 0xc8, 0xff, 0xc8, 0xc8, 0xc9, 0xff, 0xd6, 0xdb, 0xda, 0xff, 0x85, 0x88, 0x80, 0xff, 0x27, 0x43, 0x59, 0xff, 0x00, 0x14, 0x2a, 0xff, 0x20, 0x0c, 0x00, 0xff, 0x8e, 0x87, 0x7d, 0xff, 0x51, 0x50, 0x5e, 0xff, 0x15, 0x3f, 0x60, 0xff, 0x0b, 0x73, 0xb0, 0xff, 0x19, 0x2b, 0x3e, 0xff, 0x3f, 0x3c, 0x39, 0xff, 0x51, 0x6c, 0x7d, 0xff, 0x36, 0x34, 0x31, 0xff, 0x45, 0x19, 0x00, 0xff, 0x25, 0x1b, 0x09, 0xff, 0x32, 0x3b, 0x42, 0xff, 0x36, 0x3b, 0x41, 0xff, 0x38, 0x32, 0x2b, 0xff, 0x42, 0x35, 0x25, 0xff, 0x41, 0x32, 0x24, 0xff, 0x34, 0x25, 0x11, 0xff, 0x28, 0x19, 0x00, 0xff, 0x50, 0x4f, 0x4c, 0xff, 0x67, 0x58, 0x4d, 0xff, 0x44, 0x86, 0xbc, 0xff, 0x2f, 0x69, 0x9d, 0xff, 0x31, 0x54, 0x78, 0xff, 0x27, 0x83, 0xc9, 0xff, 0x40, 0x55, 0x60, 0xff, 0x51, 0x3e, 0x41, 0xff, 0xa9, 0xb0, 0xc2, 0xff, 0x94, 0x9c, 0xab, 0xff, 0x47, 0x2d, 0x2d, 0xff, 0x3c, 0x4f, 0x6a, 0xff, 0x29, 0x7a, 0xbb, 0xff, 0x3a, 0x5a, 0x79, 0xff, 0x25, 0x73, 0xaa, 0xff, 0x3a, 0x65, 0x8c, 0xff, 0x33, 0x1c, 0x16, 0xff, 0x2c, 0x2c, 0x27, 0xff, 0x72, 0x6f, 0x73, 0xff, 0x3c, 0x52, 0x6e, 0xff, 0x3e, 0x2f, 0x2d, 0xff, 0x4f, 0x38, 0x2e, 0xff, 0x59, 0x4c, 0x43, 0xff, 0x41, 0x25, 0x15, 0xff, 0x34, 0x31, 0x2d, 0xff, 0xe0, 0xe5, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xbf, 0xd7, 0xff, 0x1a, 0x3d, 0x60, 0xff, 0x3b, 0x20, 0x11, 0xff, 0x40, 0x30, 0x24, 0xff, 0x44, 0x2c, 0x1f, 0xff, 0x3a, 0x23, 0x14, 0xff, 0x48, 0x29, 0x12, 0xff, 0x44, 0x22, 0x08, 0xff, 0x41, 0x1f, 0x07, 0xff, 0x3f, 0x1f, 0x06, 0xff, 0x3d, 0x21, 0x04, 0xff, 0x41, 0x1d, 0x00, 0xff, 0x42, 0x25, 0x10, 0xff, 0x3e, 0x46, 0x55, 0xff, 0x72, 0x63, 0x58, 0xff, 0x2a, 0x1a, 0x08, 0xff, 0x37, 0x10, 0x00, 0xff, 0x30, 0x52, 0x78, 0xff, 0x27, 0x4f, 0x81, 0xff, 0x2f, 0x3d, 0x58, 0xff, 0x25, 0x62, 0x9c, 0xff, 0x35, 0x2d, 0x2b, 0xff, 0x4e, 0x30, 0x24, 0xff, 0xa8, 0xa3, 0xa6, 0xff, 0x6e, 0x5a, 0x5c, 0xff, 0x2a, 0x04, 0x00, 0xff, 0x41, 0x67, 0x85, 0xff, 0x70, 0xae, 0xde, 0xff, 0x68, 0x62, 0x61, 0xff, 0x43, 0x3c, 0x35, 0xff, 0x73, 0x70, 0x6f, 0xff, 0x38, 0x43, 0x56, 0xff, 0x51, 0x41, 0x3d, 0xff, 0x63, 0x50, 0x4d, 0xff, 0x5b, 0x48, 0x41, 0xff, 0x4f, 0x35, 0x23, 0xff, 0x41, 0x23, 0x08, 0xff, 0x42, 0x13, 0x00, 0xff, 0x38, 0x30, 0x29, 0xff, 0x0a, 0xab, 0xff, 0xff, 0x20, 0x63, 0x90, 0xff, 0x26, 0x07, 0x00, 0xff, 0x4a, 0x4a, 0x3f, 0xff, 0x37, 0x3e, 0x42, 0xff, 0x4d, 0x37, 0x1f, 0xff, 0x74, 0x6c, 0x66, 0xff, 0xd5, 0xd6, 0xdb, 0xff, 0xd1, 0xd5, 0xd3, 0xff, 0xcc, 0xcf, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcd, 0xcb, 0xff, 0xc9, 0xcd, 0xca, 0xfa, 0xcc, 0xcc, 0xcc, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xca, 0xca, 0x88, 0xc9, 0xcb, 0xcb, 0xff, 0xc8, 0xca, 0xca, 0xff, 0xc7, 0xc9, 0xc9, 0xff, 0xc6, 0xc8, 0xc7, 0xff, 0xd3, 0xd5, 0xd6, 0xff, 0xb6, 0xb3, 0xae, 0xff, 0x30, 0x49, 0x59, 0xff, 0x39, 0x71, 0x97, 0xff, 0x38, 0x43, 0x4a, 0xff, 0x4c, 0x46, 0x34, 0xff, 0x38, 0x38, 0x3d, 0xff, 0x24, 0x00, 0x00, 0xff, 0x2f, 0x3e, 0x51, 0xff, 0x1d, 0x54, 0x89, 0xff, 0x1d, 0x0f, 0x05, 0xff, 0x3b, 0x27, 0x0e, 0xff, 0x4e, 0x52, 0x5a, 0xff, 0x3b, 0x3a, 0x48, 0xff, 0x4c, 0x33, 0x28, 0xff, 0x25, 0x14, 0x04, 0xff, 0x37, 0x17, 0x00, 0xff, 0x3a, 0x18, 0x00, 0xff, 0x36, 0x18, 0x00, 0xff, 0x3d, 0x20, 0x09, 0xff, 0x47, 0x2a, 0x19, 0xff, 0x51, 0x36, 0x1e, 0xff, 0x63, 0x5f, 0x58, 0xff, 0x51, 0x52, 0x4b, 0xff, 0x38, 0x19, 0x00, 0xff, 0x29, 0x5a, 0x84, 0xff, 0x2a, 0x4d, 0x70, 0xff, 0x2c, 0x3f, 0x5a, 0xff, 0x21, 0x63, 0xa0, 0xff, 0x39, 0x29, 0x17, 0xff, 0x40, 0x1c, 0x09, 0xff, 0xa2, 0x97, 0x99, 0xff, 0x88, 0x7a, 0x78, 0xff, 0x3c, 0x0e, 0x00, 0xff, 0x32, 0x41, 0x4e, 0xff, 0x25, 0x63, 0x9b, 0xff, 0x37, 0x3c, 0x49, 0xff, 0x28, 0x5f, 0x92, 0xff, 0x3b, 0x50, 0x64, 0xff, 0x2c, 0x0d, 0x00, 0xff, 0x2f, 0x27, 0x17, 0xff, 0x71, 0x67, 0x5e, 0xff, 0x36, 0x41, 0x4c, 0xff, 0x39, 0x23, 0x0a, 0xff, 0x46, 0x25, 0x03, 0xff, 0x3b, 0x1a, 0x00, 0xff, 0x29, 0x14, 0x08, 0xff, 0x0f, 0x4d, 0x70, 0xff, 0x74, 0xb4, 0xd5, 0xff, 0xd2, 0xd8, 0xd3, 0xff, 0x5d, 0xa2, 0xd2, 0xff, 0x28, 0x42, 0x5a, 0xff, 0x2d, 0x13, 0x04, 0xff, 0x3c, 0x22, 0x03, 0xff, 0x43, 0x2d, 0x0e, 0xff, 0x45, 0x2e, 0x18, 0xff, 0x46, 0x32, 0x1f, 0xff, 0x40, 0x34, 0x21, 0xff, 0x42, 0x36, 0x22, 0xff, 0x3e, 0x32, 0x20, 0xff, 0x3c, 0x33, 0x23, 0xff, 0x45, 0x38, 0x2a, 0xff, 0x3c, 0x42, 0x41, 0xff, 0x32, 0x6a, 0x88, 0xff, 0x68, 0x83, 0x8e, 0xff, 0x26, 0x38, 0x40, 0xff, 0x32, 0x35, 0x36, 0xff, 0x22, 0x7a, 0xad, 0xff, 0x16, 0x78, 0xb2, 0xff, 0x29, 0x62, 0x88, 0xff, 0x10, 0x88, 0xc9, 0xff, 0x2e, 0x42, 0x4b, 0xff, 0x4b, 0x37, 0x38, 0xff, 0xa8, 0xb3, 0xbf, 0xff, 0x77, 0x80, 0x91, 0xff, 0x1f, 0x29, 0x3d, 0xff, 0x07, 0x82, 0xc2, 0xff, 0x44, 0xa2, 0xd3, 0xff, 0x83, 0x6c, 0x62, 0xff, 0x77, 0x7b, 0x77, 0xff, 0xad, 0xb6, 0xb6, 0xff, 0x74, 0x90, 0xa3, 0xff, 0x81, 0x7a, 0x71, 0xff, 0x8e, 0x85, 0x7c, 0xff, 0x8e, 0x88, 0x7c, 0xff, 0x86, 0x7c, 0x6b, 0xff, 0x75, 0x70, 0x63, 0xff, 0x8c, 0x71, 0x64, 0xff, 0x4e, 0x64, 0x78, 0xff, 0x00, 0x83, 0xcf, 0xff, 0x2a, 0x75, 0xa5, 0xff, 0x11, 0x00, 0x00, 0xff, 0x18, 0x0f, 0x00, 0xff, 0x79, 0x87, 0x8f, 0xff, 0x46, 0x49, 0x4f, 0xff, 0x3e, 0x22, 0x0b, 0xff, 0xad, 0xa9, 0x9e, 0xff, 0xdd, 0xe3, 0xe7, 0xff, 0xcc, 0xcd, 0xce, 0xff, 0xcc, 0xce, 0xce, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcd, 0xcb, 0xff, 0xca, 0xcc, 0xca, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x09, 0xc9, 0xca, 0xca, 0xdb, 0xc8, 0xca, 0xca, 0xff, 0xc6, 0xc8, 0xc9, 0xff, 0xc5, 0xc8, 0xc5, 0xff, 0xdc, 0xe4, 0xe1, 0xff, 0x88, 0x81, 0x7b, 0xff, 0x0c, 0x1b, 0x28, 0xff, 0x0a, 0x40, 0x63, 0xff, 0x36, 0x40, 0x49, 0xff, 0x84, 0x84, 0x86, 0xff, 0x49, 0x38, 0x25, 0xff, 0x13, 0x14, 0x10, 0xff, 0x00, 0x41, 0x70, 0xff, 0x22, 0x37, 0x54, 0xff, 0x1a, 0x09, 0x00, 0xff, 0x40, 0x38, 0x29, 0xff, 0x7d, 0x88, 0x9e, 0xff, 0x7b, 0x89, 0x8e, 0xff, 0x7f, 0x77, 0x60, 0xff, 0x4c, 0x41, 0x36, 0xff, 0x5c, 0x48, 0x41, 0xff, 0x60, 0x54, 0x50, 0xff, 0x65, 0x5b, 0x56, 0xff, 0x76, 0x70, 0x6a, 0xff, 0x8d, 0x83, 0x7b, 0xff, 0x75, 0x5f, 0x4a, 0xff, 0x6a, 0x66, 0x63, 0xff, 0x3b, 0x3d, 0x41, 0xff, 0x20, 0x41, 0x55, 0xff, 0x0b, 0x8c, 0xd1, 0xff, 0x14, 0x73, 0xa7, 0xff, 0x17, 0x6a, 0x9b, 0xff, 0x08, 0x89, 0xcf, 0xff, 0x30, 0x42, 0x4a, 0xff, 0x3a, 0x42, 0x4b, 0xff, 0x9c, 0xb9, 0xcd, 0xff, 0x74, 0x94, 0xaa, 0xff, 0x2c, 0x34, 0x48, 0xff, 0x16, 0x76, 0xac, 0xff, 0x05, 0x96, 0xe8, 0xff, 0x23, 0x6e, 0x9f, 0xff, 0x09, 0x93, 0xe3, 0xff, 0x23, 0x77, 0xac, 0xff, 0x22, 0x2c, 0x3a, 0xff, 0x2d, 0x52, 0x69, 0xff, 0x5b, 0x90, 0xb6, 0xff, 0x16, 0x6d, 0xa1, 0xff, 0x2d, 0x40, 0x51, 0xff, 0x32, 0x48, 0x57, 0xff, 0x2a, 0x3f, 0x4c, 0xff, 0x2d, 0x2a, 0x32, 0xff, 0x0c, 0x7c, 0xc2, 0xff, 0x00, 0x8f, 0xe6, 0xff, 0x0b, 0x77, 0xb4, 0xff, 0x00, 0x9f, 0xfb, 0xff, 0x1f, 0x64, 0x90, 0xff, 0x20, 0x32, 0x41, 0xff, 0x30, 0x4a, 0x60, 0xff, 0x33, 0x5b, 0x7a, 0xff, 0x36, 0x5f, 0x85, 0xff, 0x36, 0x64, 0x8e, 0xff, 0x37, 0x61, 0x8b, 0xff, 0x39, 0x5f, 0x88, 0xff, 0x34, 0x59, 0x83, 0xff, 0x31, 0x5f, 0x89, 0xff, 0x39, 0x5d, 0x86, 0xff, 0x2b, 0x63, 0x95, 0xff, 0x1f, 0x83, 0xc6, 0xff, 0x5e, 0x92, 0xb8, 0xff, 0x1e, 0x4a, 0x67, 0xff, 0x22, 0x46, 0x61, 0xff, 0x12, 0x95, 0xd9, 0xff, 0x06, 0x9a, 0xe3, 0xff, 0x1a, 0x81, 0xbd, 0xff, 0x00, 0xac, 0xff, 0xff, 0x21, 0x64, 0x96, 0xff, 0x2d, 0x59, 0x83, 0xff, 0x80, 0xcc, 0xf9, 0xff, 0x69, 0x9d, 0xcc, 0xff, 0x21, 0x35, 0x5a, 0xff, 0x08, 0x81, 0xc2, 0xff, 0x07, 0x81, 0xcd, 0xff, 0x2d, 0x15, 0x0c, 0xff, 0x46, 0x33, 0x24, 0xff, 0x89, 0x94, 0xa4, 0xff, 0x4d, 0x6c, 0x83, 0xff, 0x45, 0x38, 0x2e, 0xff, 0x51, 0x3c, 0x3a, 0xff, 0x57, 0x46, 0x46, 0xff, 0x5e, 0x50, 0x47, 0xff, 0x73, 0x67, 0x5b, 0xff, 0x97, 0x7d, 0x6e, 0xff, 0x4b, 0x81, 0xa1, 0xff, 0x16, 0x41, 0x61, 0xff, 0x11, 0x3e, 0x67, 0xff, 0x19, 0x29, 0x2d, 0xff, 0x46, 0x33, 0x12, 0xff, 0x66, 0x7c, 0x88, 0xff, 0x38, 0x4b, 0x60, 0xff, 0x35, 0x09, 0x00, 0xff, 0x88, 0x7c, 0x6b, 0xff, 0xdd, 0xe7, 0xe8, 0xff, 0xca, 0xcb, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xc9, 0xca, 0xca, 0xdb, 0xc6, 0xc6, 0xc6, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xc8, 0xc8, 0x41, 0xc6, 0xc8, 0xc8, 0xfe, 0xc7, 0xc7, 0xc8, 0xff, 0xc2, 0xc8, 0xc8, 0xff, 0xd0, 0xd7, 0xd0, 0xff, 0x5b, 0x58, 0x4d, 0xff, 0x1c, 0x1e, 0x2a, 0xff, 0x21, 0x1e, 0x1f, 0xff, 0x3a, 0x32, 0x35, 0xff, 0x49, 0x5a, 0x66, 0xff, 0x3e, 0x38, 0x2e, 0xff, 0x44, 0x78, 0x99, 0xff, 0x22, 0x5f, 0x8b, 0xff, 0x27, 0x3d, 0x4e, 0xff, 0x53, 0x54, 0x4b, 0xff, 0x72, 0x6e, 0x56, 0xff, 0x84, 0x99, 0xa7, 0xff, 0x48, 0x54, 0x61, 0xff, 0x56, 0x3a, 0x30, 0xff, 0x58, 0x4a, 0x3e, 0xff, 0x8b, 0x85, 0x7b, 0xff, 0x89, 0x85, 0x7b, 0xff, 0x79, 0x71, 0x66, 0xff, 0x79, 0x6a, 0x58, 0xff, 0x6e, 0x59, 0x43, 0xff, 0x47, 0x4c, 0x4e, 0xff, 0x43, 0x5d, 0x76, 0xff, 0x25, 0x39, 0x51, 0xff, 0x21, 0x5f, 0x8b, 0xff, 0x00, 0x9b, 0xf1, 0xff, 0x10, 0x79, 0xbb, 0xff, 0x10, 0x84, 0xc4, 0xff, 0x00, 0xa2, 0xf9, 0xff, 0x1d, 0x54, 0x7b, 0xff, 0x3e, 0x5f, 0x86, 0xff, 0x9c, 0xd0, 0xf7, 0xff, 0x64, 0x90, 0xbb, 0xff, 0x2a, 0x3c, 0x58, 0xff, 0x11, 0x82, 0xc5, 0xff, 0x06, 0x96, 0xdd, 0xff, 0x1c, 0x72, 0xa8, 0xff, 0x05, 0x9d, 0xf1, 0xff, 0x1d, 0x73, 0xa4, 0xff, 0x17, 0x2e, 0x43, 0xff, 0x3e, 0x5d, 0x77, 0xff, 0x56, 0x92, 0xb9, 0xff, 0x19, 0x6b, 0x9f, 0xff, 0x2e, 0x41, 0x57, 0xff, 0x2e, 0x45, 0x5c, 0xff, 0x2b, 0x48, 0x62, 0xff, 0x2f, 0x2a, 0x32, 0xff, 0x26, 0x73, 0xa3, 0xff, 0x14, 0x82, 0xc5, 0xff, 0x13, 0x67, 0xa3, 0xff, 0x04, 0x92, 0xdc, 0xff, 0x32, 0x59, 0x72, 0xff, 0x2e, 0x2a, 0x37, 0xff, 0x35, 0x44, 0x5c, 0xff, 0x3a, 0x4f, 0x65, 0xff, 0x38, 0x4d, 0x5f, 0xff, 0x37, 0x4b, 0x5b, 0xff, 0x3c, 0x4a, 0x53, 0xff, 0x3c, 0x46, 0x4d, 0xff, 0x3c, 0x45, 0x53, 0xff, 0x34, 0x4a, 0x57, 0xff, 0x40, 0x45, 0x49, 0xff, 0x3b, 0x4b, 0x5d, 0xff, 0x30, 0x6d, 0x98, 0xff, 0x6c, 0x84, 0x9c, 0xff, 0x24, 0x3d, 0x4f, 0xff, 0x2a, 0x33, 0x43, 0xff, 0x21, 0x80, 0xb9, 0xff, 0x11, 0x89, 0xcb, 0xff, 0x23, 0x6d, 0x9b, 0xff, 0x0f, 0x97, 0xe1, 0xff, 0x21, 0x55, 0x74, 0xff, 0x35, 0x3f, 0x56, 0xff, 0x91, 0xbb, 0xd3, 0xff, 0x72, 0x8e, 0xa8, 0xff, 0x2d, 0x25, 0x33, 0xff, 0x1a, 0x6a, 0x95, 0xff, 0x0d, 0xa2, 0xf2, 0xff, 0x1e, 0x46, 0x5b, 0xff, 0x3a, 0x1d, 0x03, 0xff, 0x65, 0x60, 0x62, 0xff, 0x2d, 0x2e, 0x36, 0xff, 0x36, 0x12, 0x00, 0xff, 0x3a, 0x1e, 0x01, 0xff, 0x39, 0x1b, 0x00, 0xff, 0x37, 0x18, 0x00, 0xff, 0x3f, 0x1e, 0x02, 0xff, 0x3f, 0x1b, 0x02, 0xff, 0x26, 0x37, 0x4a, 0xff, 0x0b, 0x19, 0x29, 0xff, 0x1d, 0x3d, 0x51, 0xff, 0x5e, 0x86, 0xa9, 0xff, 0x33, 0x31, 0x2e, 0xff, 0x39, 0x3e, 0x3b, 0xff, 0x64, 0x61, 0x62, 0xff, 0x26, 0x11, 0x00, 0xff, 0x6a, 0x52, 0x37, 0xff, 0xd2, 0xd6, 0xd8, 0xff, 0xce, 0xd1, 0xd4, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xc9, 0xcb, 0xcb, 0xfe, 0xc8, 0xcc, 0xcc, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xc7, 0xc7, 0x8f, 0xc3, 0xc6, 0xc5, 0xff, 0xca, 0xd2, 0xd5, 0xff, 0xb0, 0xb0, 0xa9, 0xff, 0x34, 0x2c, 0x20, 0xff, 0x20, 0x30, 0x37, 0xff, 0x1e, 0x11, 0x09, 0xff, 0x69, 0x57, 0x48, 0xff, 0x5b, 0x4b, 0x3e, 0xff, 0x00, 0x0b, 0x13, 0xff, 0x1c, 0x7b, 0xc7, 0xff, 0x53, 0x7a, 0x99, 0xff, 0x5b, 0x6e, 0x77, 0xff, 0x46, 0x4b, 0x4b, 0xff, 0x44, 0x3b, 0x31, 0xff, 0x45, 0x52, 0x5c, 0xff, 0x24, 0x1e, 0x16, 0xff, 0x3f, 0x15, 0x00, 0xff, 0x29, 0x15, 0x00, 0xff, 0x47, 0x35, 0x2d, 0xff, 0x45, 0x33, 0x2a, 0xff, 0x42, 0x2e, 0x1e, 0xff, 0x3e, 0x30, 0x27, 0xff, 0x29, 0x32, 0x3b, 0xff, 0x48, 0x79, 0xa6, 0xff, 0x52, 0x6e, 0x89, 0xff, 0x15, 0x1e, 0x26, 0xff, 0x27, 0x4a, 0x5b, 0xff, 0x07, 0x83, 0xc7, 0xff, 0x1f, 0x57, 0x8e, 0xff, 0x1b, 0x6d, 0xa6, 0xff, 0x13, 0x84, 0xcd, 0xff, 0x2f, 0x38, 0x4c, 0xff, 0x50, 0x5d, 0x77, 0xff, 0x9d, 0xc3, 0xdf, 0xff, 0x5a, 0x70, 0x94, 0xff, 0x2d, 0x34, 0x3d, 0xff, 0x0e, 0x82, 0xbc, 0xff, 0x18, 0x7e, 0xc1, 0xff, 0x24, 0x64, 0x91, 0xff, 0x0a, 0x91, 0xda, 0xff, 0x2b, 0x5c, 0x81, 0xff, 0x19, 0x1a, 0x23, 0xff, 0x4c, 0x56, 0x60, 0xff, 0x56, 0x8c, 0xaa, 0xff, 0x17, 0x54, 0x83, 0xff, 0x3f, 0x35, 0x3a, 0xff, 0x3a, 0x32, 0x2f, 0xff, 0x2b, 0x35, 0x3c, 0xff, 0x2b, 0x47, 0x67, 0xff, 0x0a, 0x8e, 0xd6, 0xff, 0x08, 0x90, 0xdc, 0xff, 0x13, 0x7c, 0xb7, 0xff, 0x02, 0xa1, 0xee, 0xff, 0x2a, 0x5e, 0x82, 0xff, 0x27, 0x2d, 0x3d, 0xff, 0x33, 0x43, 0x53, 0xff, 0x3e, 0x51, 0x65, 0xff, 0x37, 0x50, 0x6b, 0xff, 0x37, 0x53, 0x6c, 0xff, 0x36, 0x53, 0x6e, 0xff, 0x37, 0x4c, 0x6a, 0xff, 0x37, 0x51, 0x6a, 0xff, 0x3a, 0x57, 0x6f, 0xff, 0x39, 0x54, 0x75, 0xff, 0x2d, 0x64, 0x8c, 0xff, 0x1c, 0x89, 0xc4, 0xff, 0x58, 0x96, 0xc2, 0xff, 0x20, 0x53, 0x7a, 0xff, 0x24, 0x53, 0x73, 0xff, 0x0e, 0x99, 0xe5, 0xff, 0x00, 0xa5, 0xf7, 0xff, 0x10, 0x85, 0xc2, 0xff, 0x00, 0xae, 0xff, 0xff, 0x14, 0x72, 0xa5, 0xff, 0x33, 0x4e, 0x7a, 0xff, 0x8c, 0xc3, 0xf1, 0xff, 0x6d, 0xa8, 0xd1, 0xff, 0x1d, 0x3a, 0x66, 0xff, 0x13, 0x7f, 0xbe, 0xff, 0x03, 0xb2, 0xff, 0xff, 0x08, 0x80, 0xc1, 0xff, 0x3e, 0x6e, 0x8f, 0xff, 0x5d, 0x7d, 0x91, 0xff, 0x23, 0x4d, 0x65, 0xff, 0x39, 0x34, 0x32, 0xff, 0x2b, 0x3f, 0x45, 0xff, 0x34, 0x36, 0x31, 0xff, 0x38, 0x2c, 0x1c, 0xff, 0x43, 0x34, 0x25, 0xff, 0x40, 0x2b, 0x17, 0xff, 0x25, 0x17, 0x09, 0xff, 0x28, 0x3f, 0x49, 0xff, 0x4e, 0x72, 0x8d, 0xff, 0x25, 0x88, 0xd6, 0xff, 0x14, 0x20, 0x2f, 0xff, 0x2c, 0x13, 0x00, 0xff, 0x64, 0x62, 0x5c, 0xff, 0x32, 0x22, 0x0d, 0xff, 0x4b, 0x2d, 0x04, 0xff, 0xbd, 0xb9, 0xb7, 0xff, 0xd7, 0xdc, 0xe0, 0xff, 0xca, 0xcc, 0xcc, 0xff, 0xc9, 0xcb, 0xcb, 0xff, 0xc9, 0xcb, 0xcb, 0xff, 0xc9, 0xcb, 0xcb, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb6, 0xb6, 0x07, 0xbd, 0xc4, 0xc1, 0xd1, 0xd6, 0xdd, 0xde, 0xff, 0x86, 0x82, 0x76, 0xff, 0x16, 0x12, 0x0f, 0xff, 0x28, 0x2e, 0x31, 0xff, 0x25, 0x18, 0x0b, 0xff, 0x7d, 0x7b, 0x6c, 0xff, 0x56, 0x44, 0x33, 0xff, 0x09, 0x05, 0x06, 0xff, 0x15, 0x43, 0x5f, 0xff, 0x1a, 0x55, 0x7f, 0xff, 0x17, 0x67, 0xa7, 0xff, 0x0b, 0x03, 0x00, 0xff, 0x2b, 0x11, 0x01, 0xff, 0x48, 0x54, 0x5d, 0xff, 0x26, 0x37, 0x41, 0xff, 0x33, 0x38, 0x36, 0xff, 0x2a, 0x29, 0x22, 0xff, 0x39, 0x17, 0x00, 0xff, 0x3b, 0x28, 0x13, 0xff, 0x32, 0x37, 0x39, 0xff, 0x3b, 0x36, 0x33, 0xff, 0x17, 0x56, 0x7b, 0xff, 0x4b, 0x93, 0xcc, 0xff, 0x45, 0x6f, 0x83, 0xff, 0x0d, 0x2a, 0x40, 0xff, 0x16, 0x67, 0x98, 0xff, 0x00, 0xa4, 0xff, 0xff, 0x0b, 0x79, 0xbd, 0xff, 0x03, 0x92, 0xe1, 0xff, 0x07, 0x94, 0xe1, 0xff, 0x21, 0x46, 0x69, 0xff, 0x55, 0x81, 0xb6, 0xff, 0x93, 0xd1, 0xfd, 0xff, 0x46, 0x77, 0xa9, 0xff, 0x21, 0x54, 0x82, 0xff, 0x00, 0xa0, 0xf3, 0xff, 0x0c, 0x91, 0xdc, 0xff, 0x0f, 0x84, 0xc4, 0xff, 0x00, 0xad, 0xff, 0xff, 0x24, 0x6d, 0xa7, 0xff, 0x14, 0x31, 0x4e, 0xff, 0x4f, 0x75, 0x99, 0xff, 0x47, 0xa3, 0xdd, 0xff, 0x0b, 0x6f, 0xb4, 0xff, 0x3b, 0x50, 0x72, 0xff, 0x27, 0x4e, 0x72, 0xff, 0x27, 0x3f, 0x50, 0xff, 0x39, 0x3a, 0x40, 0xff, 0x10, 0x82, 0xc3, 0xff, 0x0f, 0x7f, 0xc2, 0xff, 0x1f, 0x7a, 0xb5, 0xff, 0x09, 0xa1, 0xf1, 0xff, 0x25, 0x58, 0x7a, 0xff, 0x24, 0x35, 0x43, 0xff, 0x34, 0x5a, 0x78, 0xff, 0x3a, 0x5a, 0x7b, 0xff, 0x37, 0x52, 0x6b, 0xff, 0x36, 0x56, 0x6e, 0xff, 0x3a, 0x56, 0x6d, 0xff, 0x3e, 0x4e, 0x67, 0xff, 0x3b, 0x54, 0x6d, 0xff, 0x45, 0x53, 0x64, 0xff, 0x42, 0x47, 0x50, 0xff, 0x38, 0x4f, 0x59, 0xff, 0x37, 0x65, 0x88, 0xff, 0x69, 0x6f, 0x77, 0xff, 0x27, 0x2d, 0x2f, 0xff, 0x32, 0x2c, 0x21, 0xff, 0x25, 0x6a, 0x90, 0xff, 0x17, 0x74, 0xae, 0xff, 0x2e, 0x5b, 0x7a, 0xff, 0x16, 0x80, 0xc0, 0xff, 0x2a, 0x51, 0x68, 0xff, 0x3d, 0x34, 0x39, 0xff, 0x90, 0xaf, 0xcd, 0xff, 0x7d, 0x9d, 0xb8, 0xff, 0x2e, 0x22, 0x27, 0xff, 0x26, 0x4d, 0x66, 0xff, 0x1c, 0x78, 0xb4, 0xff, 0x25, 0x54, 0x75, 0xff, 0x46, 0x86, 0xac, 0xff, 0x48, 0x90, 0xc9, 0xff, 0x13, 0x6a, 0xa4, 0xff, 0x32, 0x49, 0x66, 0xff, 0x2c, 0x4c, 0x6a, 0xff, 0x2f, 0x48, 0x65, 0xff, 0x30, 0x47, 0x62, 0xff, 0x32, 0x5d, 0x82, 0xff, 0x22, 0x46, 0x60, 0xff, 0x1f, 0x19, 0x1c, 0xff, 0x27, 0x75, 0xb2, 0xff, 0x1e, 0x5e, 0x8b, 0xff, 0x14, 0x54, 0x80, 0xff, 0x2a, 0x2b, 0x2f, 0xff, 0x17, 0x00, 0x00, 0xff, 0x4a, 0x46, 0x3f, 0xff, 0x46, 0x39, 0x28, 0xff, 0x2e, 0x10, 0x00, 0xff, 0xa4, 0x99, 0x90, 0xff, 0xdd, 0xe4, 0xe7, 0xff, 0xc9, 0xcb, 0xcb, 0xff, 0xc9, 0xcb, 0xcb, 0xff, 0xc9, 0xca, 0xca, 0xd1, 0xbf, 0xbf, 0xbf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xc2, 0xc2, 0x2a, 0xcf, 0xd5, 0xd1, 0xf3, 0x61, 0x58, 0x47, 0xff, 0x0d, 0x15, 0x1b, 0xff, 0x27, 0x1b, 0x1d, 0xff, 0x46, 0x36, 0x2b, 0xff, 0x8b, 0x88, 0x7c, 0xff, 0x34, 0x25, 0x1d, 0xff, 0x0f, 0x0d, 0x09, 0xff, 0x29, 0x21, 0x15, 0xff, 0x26, 0x44, 0x69, 0xff, 0x14, 0x62, 0x9d, 0xff, 0x12, 0x13, 0x08, 0xff, 0x2d, 0x19, 0x0d, 0xff, 0x3b, 0x6d, 0x92, 0xff, 0x14, 0x56, 0x8e, 0xff, 0x30, 0x4b, 0x69, 0xff, 0x25, 0x37, 0x50, 0xff, 0x25, 0x2c, 0x33, 0xff, 0x29, 0x2a, 0x31, 0xff, 0x15, 0x18, 0x13, 0xff, 0x18, 0x09, 0x01, 0xff, 0x16, 0x42, 0x61, 0xff, 0x59, 0x8e, 0xae, 0xff, 0x47, 0x54, 0x56, 0xff, 0x17, 0x0d, 0x0f, 0xff, 0x23, 0x4a, 0x6a, 0xff, 0x0f, 0x7e, 0xcb, 0xff, 0x24, 0x60, 0x82, 0xff, 0x16, 0x80, 0xba, 0xff, 0x1e, 0x6c, 0x9c, 0xff, 0x2b, 0x28, 0x2d, 0xff, 0x6c, 0x77, 0x86, 0xff, 0xa2, 0xb2, 0xbf, 0xff, 0x46, 0x43, 0x47, 0xff, 0x32, 0x32, 0x33, 0xff, 0x1b, 0x72, 0xb1, 0xff, 0x27, 0x5d, 0x84, 0xff, 0x25, 0x54, 0x79, 0xff, 0x1f, 0x7d, 0xbd, 0xff, 0x37, 0x3e, 0x42, 0xff, 0x11, 0x0c, 0x0f, 0xff, 0x58, 0x59, 0x55, 0xff, 0x56, 0x75, 0x88, 0xff, 0x2e, 0x44, 0x50, 0xff, 0x42, 0x34, 0x27, 0xff, 0x30, 0x34, 0x32, 0xff, 0x2a, 0x1e, 0x0d, 0xff, 0x37, 0x1b, 0x00, 0xff, 0x1f, 0x52, 0x75, 0xff, 0x23, 0x48, 0x66, 0xff, 0x2c, 0x42, 0x5b, 0xff, 0x17, 0x60, 0x94, 0xff, 0x2f, 0x2a, 0x20, 0xff, 0x28, 0x11, 0x00, 0xff, 0x3c, 0x2c, 0x17, 0xff, 0x42, 0x29, 0x0e, 0xff, 0x3b, 0x25, 0x04, 0xff, 0x37, 0x21, 0x01, 0xff, 0x35, 0x20, 0x02, 0xff, 0x38, 0x20, 0x03, 0xff, 0x3e, 0x22, 0x06, 0xff, 0x3a, 0x1f, 0x00, 0xff, 0x39, 0x18, 0x00, 0xff, 0x2c, 0x14, 0x00, 0xff, 0x26, 0x2e, 0x38, 0xff, 0x51, 0x42, 0x33, 0xff, 0x09, 0x00, 0x00, 0xff, 0x13, 0x00, 0x00, 0xff, 0x18, 0x33, 0x4c, 0xff, 0x10, 0x3d, 0x64, 0xff, 0x17, 0x25, 0x32, 0xff, 0x0b, 0x4b, 0x7d, 0xff, 0x13, 0x20, 0x21, 0xff, 0x25, 0x00, 0x00, 0xff, 0x7a, 0x78, 0x71, 0xff, 0x7c, 0x73, 0x6e, 0xff, 0x1b, 0x00, 0x00, 0xff, 0x0c, 0x25, 0x2f, 0xff, 0x0c, 0x4a, 0x7d, 0xff, 0x19, 0x25, 0x2c, 0xff, 0x17, 0x31, 0x46, 0xff, 0x1d, 0x62, 0x96, 0xff, 0x27, 0x5d, 0x82, 0xff, 0x3c, 0x38, 0x37, 0xff, 0x33, 0x38, 0x45, 0xff, 0x32, 0x2e, 0x37, 0xff, 0x2f, 0x32, 0x30, 0xff, 0x29, 0x35, 0x43, 0xff, 0x50, 0x56, 0x63, 0xff, 0x69, 0x71, 0x7e, 0xff, 0x05, 0x55, 0x95, 0xff, 0x1b, 0x45, 0x60, 0xff, 0x27, 0x33, 0x3f, 0xff, 0x26, 0x34, 0x42, 0xff, 0x1c, 0x04, 0x00, 0xff, 0x3b, 0x33, 0x26, 0xff, 0x4c, 0x3c, 0x2c, 0xff, 0x23, 0x06, 0x00, 0xff, 0x8b, 0x7f, 0x70, 0xff, 0xda, 0xe1, 0xe6, 0xff, 0xc9, 0xca, 0xcb, 0xff, 0xc7, 0xca, 0xc9, 0xf4, 0xc8, 0xc8, 0xc8, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xb4, 0xb1, 0x55, 0x38, 0x2d, 0x1d, 0xfe, 0x18, 0x1e, 0x21, 0xff, 0x1a, 0x12, 0x0c, 0xff, 0x66, 0x57, 0x4e, 0xff, 0x89, 0x84, 0x7c, 0xff, 0x22, 0x10, 0x0b, 0xff, 0x0e, 0x0c, 0x03, 0xff, 0x1f, 0x28, 0x32, 0xff, 0x25, 0x4b, 0x78, 0xff, 0x28, 0x34, 0x3b, 0xff, 0x1a, 0x13, 0x05, 0xff, 0x22, 0x37, 0x48, 0xff, 0x35, 0x57, 0x72, 0xff, 0x19, 0x32, 0x3f, 0xff, 0x39, 0x37, 0x2d, 0xff, 0x2f, 0x39, 0x43, 0xff, 0x28, 0x34, 0x47, 0xff, 0x1c, 0x23, 0x26, 0xff, 0x0d, 0x08, 0x00, 0xff, 0x0f, 0x08, 0x0a, 0xff, 0x14, 0x1f, 0x26, 0xff, 0x57, 0x57, 0x4e, 0xff, 0x35, 0x24, 0x11, 0xff, 0x04, 0x00, 0x00, 0xff, 0x18, 0x26, 0x35, 0xff, 0x17, 0x49, 0x76, 0xff, 0x22, 0x2e, 0x31, 0xff, 0x14, 0x47, 0x6c, 0xff, 0x1c, 0x2e, 0x3a, 0xff, 0x21, 0x00, 0x00, 0xff, 0x64, 0x5b, 0x51, 0xff, 0x86, 0x80, 0x7c, 0xff, 0x2a, 0x0b, 0x00, 0xff, 0x10, 0x0e, 0x00, 0xff, 0x07, 0x4b, 0x7a, 0xff, 0x14, 0x2d, 0x42, 0xff, 0x16, 0x2f, 0x42, 0xff, 0x17, 0x46, 0x68, 0xff, 0x19, 0x0e, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x43, 0x32, 0x1d, 0xff, 0x3a, 0x43, 0x42, 0xff, 0x14, 0x0f, 0x06, 0xff, 0x20, 0x03, 0x00, 0xff, 0x1e, 0x08, 0x00, 0xff, 0x17, 0x02, 0x00, 0xff, 0x28, 0x21, 0x18, 0xff, 0x19, 0x5b, 0x8a, 0xff, 0x22, 0x4a, 0x69, 0xff, 0x1e, 0x3f, 0x59, 0xff, 0x0d, 0x52, 0x82, 0xff, 0x1d, 0x1d, 0x14, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x1a, 0x04, 0x00, 0xff, 0x1a, 0x09, 0x00, 0xff, 0x17, 0x0d, 0x00, 0xff, 0x1c, 0x10, 0x00, 0xff, 0x21, 0x12, 0x00, 0xff, 0x23, 0x14, 0x00, 0xff, 0x20, 0x12, 0x00, 0xff, 0x23, 0x18, 0x05, 0xff, 0x33, 0x23, 0x0d, 0xff, 0x39, 0x30, 0x2c, 0xff, 0x44, 0x5c, 0x67, 0xff, 0x78, 0x70, 0x65, 0xff, 0x37, 0x2d, 0x22, 0xff, 0x44, 0x2c, 0x1f, 0xff, 0x45, 0x68, 0x87, 0xff, 0x43, 0x70, 0x9c, 0xff, 0x46, 0x57, 0x68, 0xff, 0x37, 0x7c, 0xb2, 0xff, 0x3a, 0x51, 0x5a, 0xff, 0x40, 0x2a, 0x1b, 0xff, 0x8d, 0x8e, 0x8e, 0xff, 0x85, 0x86, 0x83, 0xff, 0x33, 0x1f, 0x13, 0xff, 0x33, 0x4e, 0x5c, 0xff, 0x38, 0x78, 0xa9, 0xff, 0x2e, 0x4f, 0x67, 0xff, 0x1a, 0x42, 0x65, 0xff, 0x18, 0x36, 0x39, 0xff, 0x22, 0x4d, 0x69, 0xff, 0x2d, 0x58, 0x82, 0xff, 0x2e, 0x4d, 0x6b, 0xff, 0x2c, 0x39, 0x50, 0xff, 0x2a, 0x40, 0x52, 0xff, 0x1a, 0x2e, 0x44, 0xff, 0x76, 0x7b, 0x7f, 0xff, 0x9b, 0x98, 0x91, 0xff, 0x16, 0x2c, 0x44, 0xff, 0x1b, 0x41, 0x5c, 0xff, 0x1b, 0x2c, 0x3d, 0xff, 0x24, 0x41, 0x5b, 0xff, 0x27, 0x15, 0x01, 0xff, 0x28, 0x21, 0x0e, 0xff, 0x3d, 0x2d, 0x1a, 0xff, 0x29, 0x09, 0x00, 0xff, 0x70, 0x60, 0x47, 0xff, 0xd1, 0xd7, 0xde, 0xff, 0xcb, 0xcd, 0xcf, 0xff, 0xc6, 0xc9, 0xc6, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x10, 0x03, 0x8d, 0x1f, 0x22, 0x25, 0xff, 0x30, 0x1f, 0x17, 0xff, 0x7e, 0x7a, 0x6f, 0xff, 0x6d, 0x68, 0x64, 0xff, 0x16, 0x07, 0x00, 0xff, 0x10, 0x09, 0x00, 0xff, 0x1c, 0x2b, 0x37, 0xff, 0x22, 0x47, 0x6f, 0xff, 0x2e, 0x20, 0x10, 0xff, 0x14, 0x09, 0x03, 0xff, 0x12, 0x1b, 0x20, 0xff, 0x39, 0x4b, 0x55, 0xff, 0x17, 0x3c, 0x58, 0xff, 0x2e, 0x3b, 0x4b, 0xff, 0x32, 0x55, 0x75, 0xff, 0x25, 0x32, 0x45, 0xff, 0x2e, 0x44, 0x59, 0xff, 0x20, 0x2f, 0x47, 0xff, 0x0c, 0x04, 0x01, 0xff, 0x13, 0x28, 0x33, 0xff, 0x6d, 0x6e, 0x6d, 0xff, 0x3e, 0x3a, 0x30, 0xff, 0x1a, 0x13, 0x0d, 0xff, 0x24, 0x4a, 0x65, 0xff, 0x1f, 0x5b, 0x88, 0xff, 0x2d, 0x41, 0x51, 0xff, 0x1c, 0x5b, 0x93, 0xff, 0x30, 0x46, 0x52, 0xff, 0x3b, 0x27, 0x18, 0xff, 0x84, 0x87, 0x8c, 0xff, 0xa2, 0xa1, 0xa2, 0xff, 0x4c, 0x35, 0x29, 0xff, 0x3e, 0x43, 0x42, 0xff, 0x38, 0x80, 0xb7, 0xff, 0x4b, 0x63, 0x77, 0xff, 0x46, 0x68, 0x88, 0xff, 0x3b, 0x6d, 0x98, 0xff, 0x48, 0x3b, 0x2d, 0xff, 0x2d, 0x25, 0x11, 0xff, 0x78, 0x66, 0x55, 0xff, 0x5a, 0x6d, 0x7a, 0xff, 0x3d, 0x40, 0x41, 0xff, 0x47, 0x30, 0x1b, 0xff, 0x37, 0x29, 0x19, 0xff, 0x40, 0x28, 0x16, 0xff, 0x61, 0x5a, 0x59, 0xff, 0x48, 0x8d, 0xc5, 0xff, 0x52, 0x7a, 0x9a, 0xff, 0x53, 0x7d, 0x95, 0xff, 0x4a, 0x8e, 0xbe, 0xff, 0x51, 0x4a, 0x46, 0xff, 0x40, 0x29, 0x16, 0xff, 0x4b, 0x39, 0x21, 0xff, 0x55, 0x43, 0x2e, 0xff, 0x5b, 0x47, 0x34, 0xff, 0x5e, 0x4b, 0x38, 0xff, 0x5e, 0x4c, 0x3b, 0xff, 0x5c, 0x4a, 0x39, 0xff, 0x5e, 0x4d, 0x3f, 0xff, 0x63, 0x52, 0x46, 0xff, 0x6d, 0x59, 0x48, 0xff, 0x62, 0x63, 0x66, 0xff, 0x5e, 0x85, 0xa1, 0xff, 0x8b, 0x94, 0x9c, 0xff, 0x48, 0x4d, 0x52, 0xff, 0x55, 0x4e, 0x49, 0xff, 0x46, 0x8c, 0xbe, 0xff, 0x3b, 0x9a, 0xd9, 0xff, 0x4d, 0x7b, 0xa1, 0xff, 0x32, 0xa3, 0xeb, 0xff, 0x45, 0x70, 0x89, 0xff, 0x57, 0x48, 0x47, 0xff, 0xa7, 0xb4, 0xc4, 0xff, 0xa5, 0xb1, 0xbb, 0xff, 0x52, 0x43, 0x42, 0xff, 0x3d, 0x6a, 0x87, 0xff, 0x2d, 0x8c, 0xc8, 0xff, 0x27, 0x63, 0x94, 0xff, 0x2e, 0x6f, 0xa5, 0xff, 0x4e, 0x3e, 0x2d, 0xff, 0x37, 0x2d, 0x1f, 0xff, 0x35, 0x36, 0x39, 0xff, 0x3b, 0x37, 0x35, 0xff, 0x2c, 0x35, 0x37, 0xff, 0x35, 0x42, 0x4d, 0xff, 0x35, 0x44, 0x55, 0xff, 0x40, 0x60, 0x80, 0xff, 0x44, 0x4d, 0x4c, 0xff, 0x21, 0x27, 0x26, 0xff, 0x27, 0x43, 0x6a, 0xff, 0x22, 0x2f, 0x3f, 0xff, 0x1e, 0x51, 0x7a, 0xff, 0x36, 0x2d, 0x27, 0xff, 0x24, 0x11, 0x00, 0xff, 0x24, 0x24, 0x1b, 0xff, 0x2b, 0x10, 0x00, 0xff, 0x56, 0x3c, 0x1d, 0xff, 0xc4, 0xc6, 0xc1, 0xff, 0xcf, 0xd5, 0xd7, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x17, 0x1c, 0x22, 0xb1, 0x3e, 0x2f, 0x1f, 0xff, 0x89, 0x86, 0x79, 0xff, 0x53, 0x46, 0x45, 0xff, 0x16, 0x06, 0x00, 0xff, 0x0e, 0x0a, 0x00, 0xff, 0x17, 0x27, 0x32, 0xff, 0x26, 0x3f, 0x51, 0xff, 0x28, 0x13, 0x00, 0xff, 0x08, 0x00, 0x00, 0xff, 0x0d, 0x0c, 0x12, 0xff, 0x31, 0x52, 0x6c, 0xff, 0x16, 0x4c, 0x76, 0xff, 0x1d, 0x20, 0x27, 0xff, 0x42, 0x37, 0x2f, 0xff, 0x34, 0x2a, 0x1f, 0xff, 0x2a, 0x35, 0x44, 0xff, 0x30, 0x37, 0x3e, 0xff, 0x0c, 0x00, 0x00, 0xff, 0x28, 0x3a, 0x4a, 0xff, 0x93, 0x9f, 0xa2, 0xff, 0x4f, 0x57, 0x4d, 0xff, 0x3c, 0x33, 0x23, 0xff, 0x4a, 0x84, 0xad, 0xff, 0x46, 0x84, 0xb6, 0xff, 0x4c, 0x70, 0x88, 0xff, 0x38, 0x96, 0xd4, 0xff, 0x52, 0x6a, 0x7b, 0xff, 0x5c, 0x51, 0x49, 0xff, 0xa5, 0xb6, 0xc7, 0xff, 0xa3, 0xb1, 0xc4, 0xff, 0x58, 0x49, 0x4b, 0xff, 0x49, 0x6b, 0x80, 0xff, 0x33, 0xa6, 0xf1, 0xff, 0x48, 0x7d, 0xa7, 0xff, 0x34, 0x8c, 0xc5, 0xff, 0x3b, 0x8c, 0xc4, 0xff, 0x4e, 0x4c, 0x4a, 0xff, 0x35, 0x3f, 0x45, 0xff, 0x8c, 0x8c, 0x90, 0xff, 0x5d, 0x8a, 0xa5, 0xff, 0x4c, 0x60, 0x71, 0xff, 0x66, 0x5c, 0x56, 0xff, 0x61, 0x59, 0x51, 0xff, 0x47, 0x39, 0x2a, 0xff, 0x36, 0x45, 0x55, 0xff, 0x13, 0x7d, 0xc5, 0xff, 0x1f, 0x64, 0x93, 0xff, 0x23, 0x73, 0xa5, 0xff, 0x22, 0x90, 0xd9, 0xff, 0x43, 0x51, 0x5c, 0xff, 0x3c, 0x3a, 0x3a, 0xff, 0x53, 0x50, 0x4d, 0xff, 0x56, 0x52, 0x50, 0xff, 0x56, 0x54, 0x58, 0xff, 0x52, 0x52, 0x56, 0xff, 0x4c, 0x49, 0x4a, 0xff, 0x4a, 0x47, 0x46, 0xff, 0x51, 0x4f, 0x52, 0xff, 0x4a, 0x4c, 0x51, 0xff, 0x41, 0x3c, 0x3a, 0xff, 0x2f, 0x3e, 0x44, 0xff, 0x31, 0x5b, 0x7d, 0xff, 0x65, 0x6d, 0x73, 0xff, 0x20, 0x24, 0x27, 0xff, 0x24, 0x1d, 0x14, 0xff, 0x1c, 0x63, 0x92, 0xff, 0x11, 0x6d, 0xa7, 0xff, 0x1d, 0x4b, 0x68, 0xff, 0x09, 0x71, 0xb6, 0xff, 0x23, 0x44, 0x57, 0xff, 0x31, 0x1e, 0x17, 0xff, 0x84, 0x97, 0xab, 0xff, 0x8c, 0x98, 0xb0, 0xff, 0x2a, 0x19, 0x1d, 0xff, 0x1a, 0x44, 0x5d, 0xff, 0x09, 0x62, 0x9c, 0xff, 0x10, 0x4b, 0x7c, 0xff, 0x0d, 0x3c, 0x63, 0xff, 0x24, 0x22, 0x28, 0xff, 0x33, 0x31, 0x2d, 0xff, 0x27, 0x12, 0x00, 0xff, 0x22, 0x06, 0x00, 0xff, 0x2c, 0x15, 0x00, 0xff, 0x2f, 0x16, 0x00, 0xff, 0x36, 0x1e, 0x03, 0xff, 0x30, 0x28, 0x1c, 0xff, 0x28, 0x19, 0x0c, 0xff, 0x22, 0x17, 0x06, 0xff, 0x23, 0x44, 0x69, 0xff, 0x21, 0x31, 0x3e, 0xff, 0x1a, 0x4d, 0x73, 0xff, 0x2e, 0x48, 0x5c, 0xff, 0x32, 0x15, 0x01, 0xff, 0x25, 0x23, 0x24, 0xff, 0x29, 0x15, 0x00, 0xff, 0x3b, 0x20, 0x01, 0xff, 0xab, 0xa5, 0x9a, 0xb1, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x0a, 0x5a, 0x49, 0x39, 0xc8, 0x8a, 0x82, 0x7e, 0xff, 0x32, 0x24, 0x19, 0xff, 0x1c, 0x0d, 0x01, 0xff, 0x0f, 0x0f, 0x14, 0xff, 0x12, 0x1e, 0x2b, 0xff, 0x30, 0x2d, 0x28, 0xff, 0x1d, 0x08, 0x00, 0xff, 0x1a, 0x15, 0x0d, 0xff, 0x1a, 0x1e, 0x1d, 0xff, 0x26, 0x29, 0x25, 0xff, 0x26, 0x2e, 0x32, 0xff, 0x14, 0x08, 0x00, 0xff, 0x23, 0x0b, 0x00, 0xff, 0x23, 0x0d, 0x00, 0xff, 0x10, 0x00, 0x00, 0xff, 0x19, 0x05, 0x00, 0xff, 0x0b, 0x00, 0x00, 0xff, 0x1b, 0x22, 0x2d, 0xff, 0x5b, 0x6f, 0x78, 0xff, 0x1c, 0x1f, 0x1f, 0xff, 0x1d, 0x14, 0x16, 0xff, 0x16, 0x6d, 0xa8, 0xff, 0x17, 0x6c, 0xa2, 0xff, 0x1c, 0x55, 0x7a, 0xff, 0x06, 0x78, 0xba, 0xff, 0x21, 0x38, 0x45, 0xff, 0x33, 0x26, 0x27, 0xff, 0x89, 0x9b, 0xaa, 0xff, 0x74, 0x82, 0x91, 0xff, 0x2a, 0x1a, 0x17, 0xff, 0x1e, 0x46, 0x5d, 0xff, 0x0b, 0x74, 0xbd, 0xff, 0x21, 0x4a, 0x68, 0xff, 0x0e, 0x65, 0x9b, 0xff, 0x1c, 0x5c, 0x81, 0xff, 0x20, 0x1c, 0x15, 0xff, 0x19, 0x1e, 0x27, 0xff, 0x5f, 0x68, 0x6c, 0xff, 0x2e, 0x59, 0x76, 0xff, 0x2d, 0x36, 0x3c, 0xff, 0x32, 0x2c, 0x27, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x2e, 0x1c, 0x0c, 0xff, 0x3e, 0x32, 0x22, 0xff, 0x1f, 0x6a, 0xa4, 0xff, 0x24, 0x4e, 0x69, 0xff, 0x22, 0x51, 0x77, 0xff, 0x19, 0x6e, 0xae, 0xff, 0x2b, 0x32, 0x2b, 0xff, 0x1a, 0x18, 0x15, 0xff, 0x35, 0x2a, 0x20, 0xff, 0x38, 0x2c, 0x1e, 0xff, 0x3a, 0x2d, 0x1d, 0xff, 0x3e, 0x2d, 0x18, 0xff, 0x3d, 0x2c, 0x15, 0xff, 0x3c, 0x2b, 0x15, 0xff, 0x41, 0x2e, 0x15, 0xff, 0x41, 0x2e, 0x13, 0xff, 0x40, 0x24, 0x05, 0xff, 0x3d, 0x2b, 0x14, 0xff, 0x43, 0x49, 0x54, 0xff, 0x73, 0x60, 0x4d, 0xff, 0x24, 0x14, 0x00, 0xff, 0x36, 0x12, 0x00, 0xff, 0x38, 0x52, 0x6b, 0xff, 0x2d, 0x5a, 0x7e, 0xff, 0x33, 0x3f, 0x47, 0xff, 0x24, 0x63, 0x9b, 0xff, 0x31, 0x34, 0x31, 0xff, 0x3d, 0x13, 0x00, 0xff, 0x97, 0x8d, 0x8b, 0xff, 0x93, 0x8a, 0x89, 0xff, 0x3a, 0x13, 0x00, 0xff, 0x34, 0x35, 0x31, 0xff, 0x26, 0x57, 0x88, 0xff, 0x26, 0x45, 0x6a, 0xff, 0x1a, 0x22, 0x27, 0xff, 0x08, 0x01, 0x01, 0xff, 0x38, 0x3e, 0x45, 0xff, 0x4f, 0x52, 0x53, 0xff, 0x1f, 0x0f, 0x08, 0xff, 0x2b, 0x1e, 0x0e, 0xff, 0x27, 0x16, 0x06, 0xff, 0x16, 0x0e, 0x00, 0xff, 0x27, 0x0f, 0x00, 0xff, 0x2f, 0x14, 0x00, 0xff, 0x23, 0x16, 0x05, 0xff, 0x1e, 0x30, 0x43, 0xff, 0x1c, 0x26, 0x2e, 0xff, 0x23, 0x48, 0x67, 0xff, 0x21, 0x56, 0x8a, 0xff, 0x39, 0x2c, 0x1c, 0xff, 0x2f, 0x2b, 0x29, 0xff, 0x27, 0x17, 0x05, 0xff, 0x28, 0x0f, 0x00, 0xc8, 0x99, 0x7f, 0x7f, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x61, 0x55, 0x15, 0x7e, 0x75, 0x77, 0xd7, 0x25, 0x13, 0x01, 0xff, 0x1d, 0x16, 0x0a, 0xff, 0x12, 0x17, 0x22, 0xff, 0x14, 0x13, 0x11, 0xff, 0x24, 0x16, 0x0c, 0xff, 0x11, 0x04, 0x00, 0xff, 0x33, 0x2b, 0x1e, 0xff, 0x25, 0x1b, 0x14, 0xff, 0x0b, 0x00, 0x00, 0xff, 0x0d, 0x0c, 0x05, 0xff, 0x02, 0x03, 0x01, 0xff, 0x14, 0x0b, 0x03, 0xff, 0x3c, 0x30, 0x1d, 0xff, 0x4f, 0x3b, 0x24, 0xff, 0x35, 0x24, 0x16, 0xff, 0x32, 0x28, 0x1c, 0xff, 0x3d, 0x32, 0x27, 0xff, 0x5d, 0x51, 0x44, 0xff, 0x1c, 0x0f, 0x00, 0xff, 0x2e, 0x19, 0x07, 0xff, 0x27, 0x5d, 0x85, 0xff, 0x23, 0x4d, 0x6c, 0xff, 0x2c, 0x45, 0x57, 0xff, 0x25, 0x60, 0x95, 0xff, 0x34, 0x21, 0x10, 0xff, 0x43, 0x1f, 0x0c, 0xff, 0xa3, 0x9b, 0x91, 0xff, 0x74, 0x67, 0x5e, 0xff, 0x33, 0x08, 0x00, 0xff, 0x31, 0x41, 0x4c, 0xff, 0x29, 0x64, 0x95, 0xff, 0x3a, 0x3b, 0x3f, 0xff, 0x32, 0x5f, 0x88, 0xff, 0x3d, 0x4a, 0x59, 0xff, 0x27, 0x09, 0x00, 0xff, 0x2d, 0x1f, 0x0c, 0xff, 0x76, 0x64, 0x4e, 0xff, 0x3f, 0x40, 0x44, 0xff, 0x46, 0x28, 0x07, 0xff, 0x45, 0x20, 0x00, 0xff, 0x37, 0x1f, 0x00, 0xff, 0x3a, 0x15, 0x00, 0xff, 0x40, 0x2c, 0x1a, 0xff, 0x2c, 0x66, 0x95, 0xff, 0x35, 0x48, 0x58, 0xff, 0x32, 0x4d, 0x66, 0xff, 0x2f, 0x62, 0x92, 0xff, 0x37, 0x24, 0x0e, 0xff, 0x2a, 0x11, 0x00, 0xff, 0x41, 0x21, 0x00, 0xff, 0x41, 0x20, 0x00, 0xff, 0x40, 0x21, 0x00, 0xff, 0x40, 0x23, 0x00, 0xff, 0x40, 0x24, 0x00, 0xff, 0x41, 0x25, 0x00, 0xff, 0x42, 0x26, 0x01, 0xff, 0x43, 0x27, 0x02, 0xff, 0x47, 0x24, 0x00, 0xff, 0x3d, 0x2d, 0x17, 0xff, 0x3f, 0x4c, 0x57, 0xff, 0x6e, 0x60, 0x53, 0xff, 0x23, 0x18, 0x09, 0xff, 0x34, 0x18, 0x00, 0xff, 0x33, 0x54, 0x6e, 0xff, 0x2d, 0x60, 0x87, 0xff, 0x38, 0x46, 0x56, 0xff, 0x26, 0x6e, 0xa7, 0xff, 0x30, 0x3e, 0x3e, 0xff, 0x3c, 0x1a, 0x01, 0xff, 0x92, 0x8a, 0x8b, 0xff, 0x8d, 0x88, 0x88, 0xff, 0x3b, 0x18, 0x01, 0xff, 0x30, 0x38, 0x32, 0xff, 0x23, 0x65, 0x9a, 0xff, 0x1d, 0x3f, 0x5f, 0xff, 0x20, 0x1d, 0x19, 0xff, 0x02, 0x00, 0x00, 0xff, 0x27, 0x1a, 0x0f, 0xff, 0x57, 0x51, 0x44, 0xff, 0x50, 0x48, 0x44, 0xff, 0x52, 0x48, 0x3b, 0xff, 0x58, 0x4c, 0x3c, 0xff, 0x55, 0x48, 0x39, 0xff, 0x35, 0x36, 0x32, 0xff, 0x29, 0x1a, 0x0d, 0xff, 0x25, 0x11, 0x00, 0xff, 0x1a, 0x27, 0x34, 0xff, 0x23, 0x33, 0x47, 0xff, 0x2d, 0x40, 0x4c, 0xff, 0x20, 0x62, 0x9a, 0xff, 0x38, 0x39, 0x34, 0xff, 0x2f, 0x2e, 0x2b, 0xff, 0x23, 0x19, 0x10, 0xd8, 0x24, 0x0c, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x51, 0x51, 0x1c, 0x19, 0x03, 0x00, 0xdc, 0x17, 0x20, 0x24, 0xff, 0x0f, 0x23, 0x35, 0xff, 0x12, 0x0c, 0x03, 0xff, 0x19, 0x0b, 0x02, 0xff, 0x16, 0x0e, 0x01, 0xff, 0x4a, 0x42, 0x33, 0xff, 0x15, 0x12, 0x0d, 0xff, 0x06, 0x07, 0x05, 0xff, 0x3e, 0x38, 0x30, 0xff, 0x20, 0x29, 0x2f, 0xff, 0x13, 0x11, 0x08, 0xff, 0x40, 0x38, 0x2a, 0xff, 0x5a, 0x55, 0x54, 0xff, 0x47, 0x44, 0x41, 0xff, 0x25, 0x27, 0x24, 0xff, 0x40, 0x37, 0x31, 0xff, 0x5c, 0x52, 0x40, 0xff, 0x11, 0x0a, 0x00, 0xff, 0x30, 0x21, 0x0c, 0xff, 0x24, 0x5b, 0x89, 0xff, 0x27, 0x4b, 0x66, 0xff, 0x2c, 0x44, 0x56, 0xff, 0x27, 0x5c, 0x8d, 0xff, 0x32, 0x23, 0x0d, 0xff, 0x4d, 0x33, 0x25, 0xff, 0xa4, 0xa3, 0xa2, 0xff, 0x64, 0x5c, 0x57, 0xff, 0x34, 0x0e, 0x00, 0xff, 0x27, 0x50, 0x68, 0xff, 0x26, 0x65, 0x90, 0xff, 0x35, 0x3c, 0x4c, 0xff, 0x29, 0x60, 0x95, 0xff, 0x3a, 0x48, 0x54, 0xff, 0x23, 0x08, 0x00, 0xff, 0x35, 0x30, 0x1f, 0xff, 0x76, 0x6b, 0x62, 0xff, 0x32, 0x3d, 0x46, 0xff, 0x3c, 0x26, 0x0b, 0xff, 0x42, 0x23, 0x00, 0xff, 0x3f, 0x24, 0x01, 0xff, 0x37, 0x16, 0x00, 0xff, 0x3d, 0x34, 0x28, 0xff, 0x28, 0x65, 0x9b, 0xff, 0x2d, 0x47, 0x5a, 0xff, 0x2e, 0x53, 0x6c, 0xff, 0x30, 0x62, 0x8d, 0xff, 0x37, 0x27, 0x11, 0xff, 0x2b, 0x14, 0x00, 0xff, 0x3d, 0x24, 0x03, 0xff, 0x3f, 0x22, 0x00, 0xff, 0x3d, 0x23, 0x00, 0xff, 0x3e, 0x24, 0x01, 0xff, 0x3d, 0x24, 0x02, 0xff, 0x3f, 0x26, 0x04, 0xff, 0x43, 0x28, 0x06, 0xff, 0x46, 0x2a, 0x07, 0xff, 0x46, 0x25, 0x00, 0xff, 0x3a, 0x2d, 0x1a, 0xff, 0x40, 0x51, 0x5f, 0xff, 0x6b, 0x5c, 0x4f, 0xff, 0x24, 0x17, 0x06, 0xff, 0x2e, 0x16, 0x00, 0xff, 0x30, 0x4d, 0x66, 0xff, 0x2c, 0x5a, 0x80, 0xff, 0x30, 0x44, 0x55, 0xff, 0x1d, 0x69, 0x9e, 0xff, 0x2d, 0x37, 0x35, 0xff, 0x36, 0x14, 0x00, 0xff, 0x8d, 0x89, 0x8a, 0xff, 0x8d, 0x89, 0x85, 0xff, 0x37, 0x15, 0x00, 0xff, 0x2f, 0x39, 0x33, 0xff, 0x21, 0x5e, 0x8f, 0xff, 0x23, 0x3a, 0x4e, 0xff, 0x1d, 0x12, 0x0b, 0xff, 0x14, 0x07, 0x01, 0xff, 0x17, 0x0f, 0x03, 0xff, 0x12, 0x14, 0x17, 0xff, 0x37, 0x30, 0x2a, 0xff, 0x39, 0x2e, 0x22, 0xff, 0x3b, 0x3d, 0x36, 0xff, 0x48, 0x43, 0x3f, 0xff, 0x33, 0x55, 0x72, 0xff, 0x26, 0x37, 0x48, 0xff, 0x20, 0x06, 0x00, 0xff, 0x23, 0x27, 0x29, 0xff, 0x28, 0x48, 0x6d, 0xff, 0x30, 0x3b, 0x47, 0xff, 0x17, 0x51, 0x7b, 0xff, 0x32, 0x37, 0x35, 0xff, 0x38, 0x38, 0x35, 0xdd, 0x24, 0x1b, 0x12, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x21, 0x1b, 0x27, 0x32, 0xde, 0x13, 0x2d, 0x43, 0xff, 0x10, 0x0c, 0x03, 0xff, 0x0b, 0x01, 0x00, 0xff, 0x30, 0x25, 0x14, 0xff, 0x56, 0x4f, 0x42, 0xff, 0x13, 0x16, 0x18, 0xff, 0x1c, 0x18, 0x10, 0xff, 0x4c, 0x4b, 0x45, 0xff, 0x24, 0x3d, 0x53, 0xff, 0x00, 0x09, 0x13, 0xff, 0x00, 0x00, 0x01, 0xff, 0x17, 0x19, 0x1a, 0xff, 0x2a, 0x20, 0x16, 0xff, 0x17, 0x0e, 0x09, 0xff, 0x41, 0x41, 0x3c, 0xff, 0x52, 0x4b, 0x3c, 0xff, 0x0d, 0x00, 0x00, 0xff, 0x2f, 0x25, 0x19, 0xff, 0x23, 0x61, 0x95, 0xff, 0x2a, 0x4b, 0x5e, 0xff, 0x22, 0x42, 0x5e, 0xff, 0x28, 0x5a, 0x83, 0xff, 0x2f, 0x1b, 0x01, 0xff, 0x51, 0x3d, 0x30, 0xff, 0xa3, 0x9d, 0xa1, 0xff, 0x5c, 0x4e, 0x44, 0xff, 0x30, 0x15, 0x00, 0xff, 0x29, 0x52, 0x72, 0xff, 0x2a, 0x58, 0x81, 0xff, 0x31, 0x3f, 0x50, 0xff, 0x25, 0x65, 0x9e, 0xff, 0x3c, 0x40, 0x41, 0xff, 0x1f, 0x04, 0x00, 0xff, 0x3c, 0x34, 0x25, 0xff, 0x6a, 0x6a, 0x64, 0xff, 0x2f, 0x3b, 0x43, 0xff, 0x43, 0x23, 0x03, 0xff, 0x3e, 0x24, 0x00, 0xff, 0x3b, 0x22, 0x03, 0xff, 0x32, 0x12, 0x00, 0xff, 0x38, 0x35, 0x2c, 0xff, 0x21, 0x5f, 0x97, 0xff, 0x2f, 0x41, 0x55, 0xff, 0x29, 0x47, 0x60, 0xff, 0x29, 0x55, 0x78, 0xff, 0x30, 0x20, 0x0d, 0xff, 0x25, 0x10, 0x00, 0xff, 0x3a, 0x21, 0x01, 0xff, 0x41, 0x25, 0x03, 0xff, 0x3f, 0x24, 0x02, 0xff, 0x3d, 0x22, 0x00, 0xff, 0x40, 0x24, 0x01, 0xff, 0x43, 0x28, 0x04, 0xff, 0x43, 0x28, 0x05, 0xff, 0x43, 0x23, 0x00, 0xff, 0x45, 0x1e, 0x00, 0xff, 0x32, 0x24, 0x12, 0xff, 0x45, 0x58, 0x69, 0xff, 0x73, 0x65, 0x59, 0xff, 0x1a, 0x12, 0x04, 0xff, 0x32, 0x13, 0x00, 0xff, 0x34, 0x52, 0x6c, 0xff, 0x29, 0x5c, 0x89, 0xff, 0x2e, 0x46, 0x5a, 0xff, 0x1c, 0x64, 0x9b, 0xff, 0x2b, 0x2d, 0x29, 0xff, 0x36, 0x13, 0x00, 0xff, 0x93, 0x8f, 0x90, 0xff, 0x90, 0x8d, 0x88, 0xff, 0x39, 0x16, 0x00, 0xff, 0x2f, 0x33, 0x27, 0xff, 0x17, 0x54, 0x81, 0xff, 0x1f, 0x39, 0x4e, 0xff, 0x12, 0x06, 0x00, 0xff, 0x26, 0x16, 0x06, 0xff, 0x37, 0x2a, 0x1f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2d, 0x1a, 0x00, 0xff, 0x42, 0x25, 0x04, 0xff, 0x3f, 0x22, 0x02, 0xff, 0x2e, 0x17, 0x02, 0xff, 0x2c, 0x4a, 0x6d, 0xff, 0x36, 0x55, 0x6f, 0xff, 0x2b, 0x11, 0x00, 0xff, 0x23, 0x1c, 0x12, 0xff, 0x23, 0x54, 0x81, 0xff, 0x29, 0x3d, 0x4f, 0xff, 0x22, 0x31, 0x3a, 0xff, 0x25, 0x23, 0x1c, 0xde, 0x3d, 0x3d, 0x36, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x27, 0x31, 0x1a, 0x12, 0x1e, 0x27, 0xd7, 0x0d, 0x0d, 0x06, 0xff, 0x00, 0x00, 0x00, 0xff, 0x45, 0x36, 0x26, 0xff, 0x53, 0x4d, 0x43, 0xff, 0x14, 0x16, 0x17, 0xff, 0x03, 0x00, 0x00, 0xff, 0x25, 0x28, 0x25, 0xff, 0x3b, 0x3b, 0x38, 0xff, 0x08, 0x0b, 0x12, 0xff, 0x03, 0x00, 0x00, 0xff, 0x0f, 0x02, 0x00, 0xff, 0x27, 0x0b, 0x00, 0xff, 0x1d, 0x14, 0x09, 0xff, 0x4d, 0x50, 0x4a, 0xff, 0x4b, 0x41, 0x35, 0xff, 0x0e, 0x00, 0x00, 0xff, 0x2f, 0x28, 0x23, 0xff, 0x21, 0x5f, 0x94, 0xff, 0x23, 0x40, 0x52, 0xff, 0x1d, 0x43, 0x5f, 0xff, 0x29, 0x51, 0x73, 0xff, 0x2c, 0x14, 0x00, 0xff, 0x54, 0x46, 0x3d, 0xff, 0x98, 0x95, 0x95, 0xff, 0x55, 0x3e, 0x38, 0xff, 0x2e, 0x1a, 0x00, 0xff, 0x26, 0x55, 0x7d, 0xff, 0x28, 0x4e, 0x6d, 0xff, 0x32, 0x3b, 0x49, 0xff, 0x27, 0x6b, 0xa0, 0xff, 0x38, 0x3c, 0x3c, 0xff, 0x1a, 0x00, 0x00, 0xff, 0x45, 0x37, 0x26, 0xff, 0x63, 0x64, 0x61, 0xff, 0x2d, 0x36, 0x39, 0xff, 0x46, 0x22, 0x00, 0xff, 0x3a, 0x21, 0x00, 0xff, 0x2c, 0x1a, 0x03, 0xff, 0x32, 0x14, 0x00, 0xff, 0x3e, 0x3b, 0x34, 0xff, 0x29, 0x6b, 0xa2, 0xff, 0x31, 0x48, 0x59, 0xff, 0x26, 0x57, 0x7d, 0xff, 0x2f, 0x5a, 0x80, 0xff, 0x31, 0x1c, 0x06, 0xff, 0x24, 0x12, 0x00, 0xff, 0x3a, 0x20, 0x00, 0xff, 0x3b, 0x22, 0x02, 0xff, 0x3d, 0x24, 0x01, 0xff, 0x3d, 0x23, 0x01, 0xff, 0x3a, 0x24, 0x03, 0xff, 0x3d, 0x23, 0x01, 0xff, 0x3e, 0x1d, 0x00, 0xff, 0x2f, 0x28, 0x1b, 0xff, 0x36, 0x26, 0x14, 0xff, 0x57, 0x44, 0x30, 0xff, 0x44, 0x50, 0x58, 0xff, 0x5a, 0x4f, 0x3e, 0xff, 0x21, 0x0c, 0x00, 0xff, 0x39, 0x17, 0x00, 0xff, 0x32, 0x62, 0x85, 0xff, 0x2a, 0x60, 0x8c, 0xff, 0x2b, 0x3b, 0x45, 0xff, 0x1b, 0x60, 0x94, 0xff, 0x2b, 0x2e, 0x2b, 0xff, 0x3b, 0x1a, 0x06, 0xff, 0xa0, 0x9c, 0x9d, 0xff, 0x94, 0x8c, 0x85, 0xff, 0x30, 0x08, 0x00, 0xff, 0x31, 0x3a, 0x38, 0xff, 0x1e, 0x58, 0x82, 0xff, 0x2a, 0x2d, 0x2e, 0xff, 0x1a, 0x28, 0x37, 0xff, 0x3f, 0x47, 0x4c, 0xff, 0x45, 0x62, 0x76, 0xff, 0x01, 0x07, 0x0a, 0xff, 0x1f, 0x0b, 0x00, 0xff, 0x3b, 0x22, 0x01, 0xff, 0x44, 0x26, 0x00, 0xff, 0x42, 0x1d, 0x00, 0xff, 0x26, 0x30, 0x3b, 0xff, 0x39, 0x53, 0x63, 0xff, 0x44, 0x28, 0x19, 0xff, 0x1f, 0x0f, 0x03, 0xff, 0x18, 0x4f, 0x74, 0xff, 0x23, 0x4d, 0x71, 0xff, 0x29, 0x20, 0x15, 0xd7, 0x12, 0x12, 0x09, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 0x17, 0x16, 0x12, 0x15, 0x14, 0xca, 0x02, 0x00, 0x00, 0xff, 0x32, 0x29, 0x16, 0xff, 0x3d, 0x3e, 0x3f, 0xff, 0x27, 0x1c, 0x1b, 0xff, 0x0b, 0x00, 0x00, 0xff, 0x1a, 0x12, 0x08, 0xff, 0x42, 0x33, 0x21, 0xff, 0x18, 0x1a, 0x1d, 0xff, 0x08, 0x05, 0x05, 0xff, 0x07, 0x00, 0x00, 0xff, 0x0a, 0x00, 0x00, 0xff, 0x0d, 0x11, 0x0e, 0xff, 0x54, 0x55, 0x4f, 0xff, 0x48, 0x3a, 0x2b, 0xff, 0x0e, 0x00, 0x00, 0xff, 0x2e, 0x32, 0x2d, 0xff, 0x25, 0x5e, 0x90, 0xff, 0x2a, 0x38, 0x45, 0xff, 0x24, 0x4b, 0x63, 0xff, 0x24, 0x47, 0x60, 0xff, 0x2b, 0x0e, 0x00, 0xff, 0x5c, 0x50, 0x49, 0xff, 0x94, 0x96, 0x94, 0xff, 0x4b, 0x33, 0x26, 0xff, 0x2e, 0x1d, 0x02, 0xff, 0x20, 0x59, 0x85, 0xff, 0x29, 0x49, 0x68, 0xff, 0x2a, 0x3b, 0x49, 0xff, 0x26, 0x62, 0x94, 0xff, 0x37, 0x37, 0x2f, 0xff, 0x19, 0x00, 0x00, 0xff, 0x45, 0x37, 0x28, 0xff, 0x58, 0x5a, 0x59, 0xff, 0x26, 0x29, 0x28, 0xff, 0x42, 0x1e, 0x00, 0xff, 0x39, 0x21, 0x02, 0xff, 0x2c, 0x1a, 0x02, 0xff, 0x30, 0x14, 0x00, 0xff, 0x3c, 0x3c, 0x3a, 0xff, 0x24, 0x61, 0x93, 0xff, 0x30, 0x43, 0x50, 0xff, 0x2a, 0x58, 0x7b, 0xff, 0x32, 0x58, 0x77, 0xff, 0x30, 0x1a, 0x02, 0xff, 0x23, 0x13, 0x00, 0xff, 0x3f, 0x24, 0x02, 0xff, 0x3b, 0x22, 0x01, 0xff, 0x3f, 0x25, 0x01, 0xff, 0x3c, 0x24, 0x02, 0xff, 0x3d, 0x26, 0x05, 0xff, 0x33, 0x1a, 0x02, 0xff, 0x1e, 0x2a, 0x31, 0xff, 0x2c, 0x42, 0x54, 0xff, 0x75, 0x6a, 0x5c, 0xff, 0x5c, 0x4e, 0x3f, 0xff, 0x15, 0x0b, 0x06, 0xff, 0x2a, 0x10, 0x00, 0xff, 0x3c, 0x28, 0x0e, 0xff, 0x28, 0x3a, 0x4a, 0xff, 0x0b, 0x64, 0xa1, 0xff, 0x2b, 0x6c, 0x95, 0xff, 0x57, 0x63, 0x69, 0xff, 0x14, 0x57, 0x85, 0xff, 0x12, 0x37, 0x59, 0xff, 0x38, 0x28, 0x1e, 0xff, 0x51, 0x50, 0x53, 0xff, 0x43, 0x6c, 0x9a, 0xff, 0x72, 0x83, 0x93, 0xff, 0x61, 0x75, 0x8e, 0xff, 0x21, 0x39, 0x53, 0xff, 0x23, 0x4b, 0x60, 0xff, 0x19, 0x3a, 0x5c, 0xff, 0x2c, 0x45, 0x66, 0xff, 0x4d, 0x94, 0xc7, 0xff, 0x17, 0x21, 0x25, 0xff, 0x0d, 0x00, 0x00, 0xff, 0x39, 0x20, 0x01, 0xff, 0x41, 0x27, 0x01, 0xff, 0x3e, 0x22, 0x06, 0xff, 0x20, 0x27, 0x24, 0xff, 0x44, 0x52, 0x5d, 0xff, 0x50, 0x42, 0x3a, 0xff, 0x1e, 0x04, 0x00, 0xff, 0x22, 0x3e, 0x53, 0xff, 0x22, 0x54, 0x83, 0xca, 0x17, 0x17, 0x17, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x2e, 0x2e, 0x0b, 0x0e, 0x02, 0x00, 0xaf, 0x28, 0x20, 0x11, 0xff, 0x20, 0x28, 0x32, 0xff, 0x2b, 0x1a, 0x0e, 0xff, 0x19, 0x09, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2e, 0x21, 0x11, 0xff, 0x2e, 0x2f, 0x29, 0xff, 0x0d, 0x13, 0x19, 0xff, 0x08, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x09, 0x0f, 0x15, 0xff, 0x5b, 0x59, 0x4f, 0xff, 0x3b, 0x31, 0x26, 0xff, 0x15, 0x00, 0x00, 0xff, 0x34, 0x3c, 0x38, 0xff, 0x27, 0x63, 0x93, 0xff, 0x2f, 0x39, 0x40, 0xff, 0x1f, 0x48, 0x6b, 0xff, 0x27, 0x3f, 0x52, 0xff, 0x27, 0x0b, 0x00, 0xff, 0x5d, 0x52, 0x4b, 0xff, 0x93, 0x92, 0x8f, 0xff, 0x41, 0x29, 0x18, 0xff, 0x2c, 0x1f, 0x09, 0xff, 0x20, 0x5e, 0x8f, 0xff, 0x29, 0x46, 0x5f, 0xff, 0x2e, 0x44, 0x52, 0xff, 0x22, 0x5f, 0x92, 0xff, 0x35, 0x2c, 0x21, 0xff, 0x15, 0x00, 0x00, 0xff, 0x4d, 0x3e, 0x2c, 0xff, 0x58, 0x5a, 0x5a, 0xff, 0x1d, 0x23, 0x23, 0xff, 0x39, 0x1b, 0x00, 0xff, 0x3e, 0x25, 0x02, 0xff, 0x30, 0x1d, 0x02, 0xff, 0x34, 0x14, 0x00, 0xff, 0x3a, 0x42, 0x43, 0xff, 0x27, 0x66, 0x96, 0xff, 0x2f, 0x3f, 0x4d, 0xff, 0x23, 0x4c, 0x6e, 0xff, 0x2a, 0x45, 0x56, 0xff, 0x28, 0x15, 0x00, 0xff, 0x1f, 0x11, 0x01, 0xff, 0x37, 0x1e, 0x03, 0xff, 0x32, 0x1d, 0x02, 0xff, 0x35, 0x1f, 0x02, 0xff, 0x39, 0x21, 0x01, 0xff, 0x42, 0x24, 0x00, 0xff, 0x29, 0x1c, 0x0c, 0xff, 0x34, 0x3f, 0x44, 0xff, 0x73, 0x66, 0x53, 0xff, 0x51, 0x41, 0x30, 0xff, 0x0e, 0x0b, 0x00, 0xff, 0x1a, 0x01, 0x00, 0xff, 0x32, 0x19, 0x00, 0xff, 0x2c, 0x59, 0x74, 0xff, 0x1a, 0x56, 0x91, 0xff, 0x1c, 0x23, 0x2b, 0xff, 0x19, 0x45, 0x60, 0xff, 0x39, 0x92, 0xcf, 0xff, 0x47, 0x86, 0xb9, 0xff, 0x0d, 0x21, 0x31, 0xff, 0x12, 0x00, 0x00, 0xff, 0x1c, 0x0d, 0x0f, 0xff, 0x5e, 0x92, 0xbe, 0xff, 0x91, 0xde, 0xff, 0xff, 0x45, 0x42, 0x51, 0xff, 0x1f, 0x28, 0x33, 0xff, 0x00, 0x89, 0xdd, 0xff, 0x13, 0x33, 0x4a, 0xff, 0x1b, 0x40, 0x68, 0xff, 0x34, 0x4a, 0x69, 0xff, 0x1b, 0x11, 0x0a, 0xff, 0x06, 0x00, 0x00, 0xff, 0x2d, 0x18, 0x01, 0xff, 0x3f, 0x24, 0x00, 0xff, 0x33, 0x22, 0x10, 0xff, 0x18, 0x26, 0x35, 0xff, 0x47, 0x4c, 0x53, 0xff, 0x59, 0x53, 0x4a, 0xff, 0x23, 0x08, 0x00, 0xff, 0x25, 0x2b, 0x37, 0xb0, 0x17, 0x45, 0x5c, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x2c, 0x1d, 0x12, 0x8b, 0x1c, 0x1d, 0x1e, 0xff, 0x22, 0x14, 0x00, 0xff, 0x1c, 0x10, 0x00, 0xff, 0x05, 0x02, 0x00, 0xff, 0x22, 0x16, 0x0d, 0xff, 0x2d, 0x28, 0x1c, 0xff, 0x0d, 0x10, 0x14, 0xff, 0x0f, 0x03, 0x00, 0xff, 0x07, 0x00, 0x00, 0xff, 0x17, 0x20, 0x26, 0xff, 0x5a, 0x53, 0x48, 0xff, 0x2e, 0x25, 0x1c, 0xff, 0x1d, 0x03, 0x00, 0xff, 0x2e, 0x3c, 0x43, 0xff, 0x1f, 0x59, 0x89, 0xff, 0x2a, 0x39, 0x41, 0xff, 0x21, 0x4b, 0x71, 0xff, 0x29, 0x36, 0x45, 0xff, 0x25, 0x0a, 0x00, 0xff, 0x62, 0x58, 0x51, 0xff, 0x8d, 0x88, 0x85, 0xff, 0x3b, 0x20, 0x12, 0xff, 0x29, 0x1f, 0x0c, 0xff, 0x1e, 0x57, 0x87, 0xff, 0x2a, 0x43, 0x55, 0xff, 0x2c, 0x3a, 0x50, 0xff, 0x24, 0x5a, 0x8a, 0xff, 0x32, 0x2c, 0x1f, 0xff, 0x10, 0x00, 0x00, 0xff, 0x55, 0x45, 0x32, 0xff, 0x5a, 0x57, 0x59, 0xff, 0x22, 0x1f, 0x1e, 0xff, 0x3a, 0x1c, 0x00, 0xff, 0x3c, 0x22, 0x00, 0xff, 0x2f, 0x1b, 0x02, 0xff, 0x2e, 0x14, 0x00, 0xff, 0x2f, 0x32, 0x38, 0xff, 0x21, 0x48, 0x6f, 0xff, 0x2e, 0x3c, 0x48, 0xff, 0x27, 0x5c, 0x8b, 0xff, 0x32, 0x4e, 0x63, 0xff, 0x2c, 0x17, 0x00, 0xff, 0x25, 0x12, 0x01, 0xff, 0x2e, 0x17, 0x03, 0xff, 0x27, 0x15, 0x02, 0xff, 0x2c, 0x1a, 0x02, 0xff, 0x37, 0x20, 0x03, 0xff, 0x27, 0x13, 0x00, 0xff, 0x35, 0x23, 0x12, 0xff, 0x77, 0x62, 0x4b, 0xff, 0x3d, 0x2f, 0x21, 0xff, 0x05, 0x00, 0x00, 0xff, 0x29, 0x0d, 0x00, 0xff, 0x34, 0x28, 0x17, 0xff, 0x1f, 0x46, 0x65, 0xff, 0x18, 0x58, 0x8d, 0xff, 0x23, 0x33, 0x3d, 0xff, 0x2c, 0x15, 0x10, 0xff, 0x1c, 0x46, 0x66, 0xff, 0x00, 0x6d, 0xbe, 0xff, 0x35, 0x5b, 0x71, 0xff, 0x54, 0x36, 0x13, 0xff, 0x0a, 0x01, 0x0c, 0xff, 0x59, 0x55, 0x50, 0xff, 0x9c, 0x9a, 0x90, 0xff, 0x31, 0x51, 0x70, 0xff, 0x12, 0x14, 0x1b, 0xff, 0x15, 0x4b, 0x67, 0xff, 0x08, 0x51, 0x8a, 0xff, 0x03, 0x59, 0x9a, 0xff, 0x1f, 0x4e, 0x6c, 0xff, 0x30, 0x12, 0x04, 0xff, 0x0e, 0x01, 0x00, 0xff, 0x07, 0x05, 0x00, 0xff, 0x15, 0x0d, 0x00, 0xff, 0x1c, 0x10, 0x00, 0xff, 0x19, 0x10, 0x06, 0xff, 0x0d, 0x1e, 0x31, 0xff, 0x44, 0x41, 0x3b, 0xff, 0x6c, 0x5e, 0x4e, 0xff, 0x31, 0x16, 0x01, 0x8b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x14, 0x08, 0x57, 0x2b, 0x11, 0x00, 0xf3, 0x29, 0x15, 0x00, 0xff, 0x0e, 0x07, 0x01, 0xff, 0x0b, 0x02, 0x03, 0xff, 0x24, 0x1a, 0x11, 0xff, 0x10, 0x0a, 0x04, 0xff, 0x03, 0x00, 0x00, 0xff, 0x09, 0x06, 0x02, 0xff, 0x20, 0x2c, 0x2f, 0xff, 0x5c, 0x50, 0x47, 0xff, 0x23, 0x1a, 0x10, 0xff, 0x1b, 0x07, 0x00, 0xff, 0x27, 0x3e, 0x4d, 0xff, 0x24, 0x58, 0x85, 0xff, 0x2c, 0x37, 0x3e, 0xff, 0x20, 0x47, 0x67, 0xff, 0x22, 0x2e, 0x39, 0xff, 0x25, 0x08, 0x00, 0xff, 0x60, 0x56, 0x50, 0xff, 0x82, 0x7f, 0x7b, 0xff, 0x35, 0x1b, 0x0d, 0xff, 0x26, 0x1c, 0x0e, 0xff, 0x1d, 0x50, 0x7a, 0xff, 0x2b, 0x3e, 0x4e, 0xff, 0x29, 0x44, 0x5b, 0xff, 0x23, 0x52, 0x7b, 0xff, 0x30, 0x26, 0x14, 0xff, 0x10, 0x02, 0x00, 0xff, 0x55, 0x45, 0x32, 0xff, 0x4f, 0x51, 0x53, 0xff, 0x22, 0x1f, 0x1c, 0xff, 0x37, 0x1a, 0x00, 0xff, 0x3b, 0x20, 0x03, 0xff, 0x30, 0x18, 0x01, 0xff, 0x2f, 0x15, 0x00, 0xff, 0x2d, 0x3b, 0x45, 0xff, 0x22, 0x3d, 0x63, 0xff, 0x26, 0x2b, 0x32, 0xff, 0x1e, 0x49, 0x6a, 0xff, 0x25, 0x3a, 0x4a, 0xff, 0x1f, 0x0e, 0x00, 0xff, 0x1f, 0x10, 0x02, 0xff, 0x2d, 0x17, 0x02, 0xff, 0x2c, 0x18, 0x03, 0xff, 0x32, 0x1e, 0x05, 0xff, 0x33, 0x1d, 0x02, 0xff, 0x28, 0x14, 0x00, 0xff, 0x44, 0x2f, 0x18, 0xff, 0x36, 0x2e, 0x23, 0xff, 0x00, 0x00, 0x00, 0xff, 0x26, 0x0b, 0x00, 0xff, 0x36, 0x29, 0x20, 0xff, 0x20, 0x52, 0x7b, 0xff, 0x14, 0x5c, 0x90, 0xff, 0x27, 0x36, 0x48, 0xff, 0x27, 0x27, 0x27, 0xff, 0x1e, 0x3f, 0x56, 0xff, 0x20, 0x4c, 0x76, 0xff, 0x1c, 0x2d, 0x3a, 0xff, 0x15, 0x0f, 0x08, 0xff, 0x46, 0x46, 0x4b, 0xff, 0x97, 0x9b, 0x9b, 0xff, 0x85, 0x88, 0x83, 0xff, 0x2c, 0x25, 0x1a, 0xff, 0x15, 0x00, 0x00, 0xff, 0x0e, 0x4f, 0x7a, 0xff, 0x00, 0x7a, 0xcd, 0xff, 0x0e, 0x38, 0x5c, 0xff, 0x02, 0x76, 0xc7, 0xff, 0x1c, 0x38, 0x4f, 0xff, 0x1d, 0x00, 0x00, 0xff, 0x09, 0x07, 0x00, 0xff, 0x0b, 0x05, 0x03, 0xff, 0x0e, 0x08, 0x02, 0xff, 0x0d, 0x04, 0x00, 0xff, 0x06, 0x02, 0x00, 0xff, 0x10, 0x32, 0x4e, 0xff, 0x35, 0x3c, 0x3c, 0xf3, 0x72, 0x66, 0x57, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x17, 0x0b, 0x2b, 0x2e, 0x1b, 0x08, 0xd2, 0x13, 0x0a, 0x03, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1a, 0x10, 0x08, 0xff, 0x26, 0x1f, 0x13, 0xff, 0x03, 0x03, 0x04, 0xff, 0x0c, 0x0d, 0x0b, 0xff, 0x2c, 0x34, 0x35, 0xff, 0x5b, 0x4f, 0x42, 0xff, 0x17, 0x14, 0x0a, 0xff, 0x20, 0x0c, 0x00, 0xff, 0x2c, 0x41, 0x54, 0xff, 0x1e, 0x54, 0x7a, 0xff, 0x29, 0x32, 0x38, 0xff, 0x1e, 0x45, 0x69, 0xff, 0x1d, 0x2a, 0x34, 0xff, 0x22, 0x05, 0x00, 0xff, 0x58, 0x4e, 0x44, 0xff, 0x76, 0x75, 0x6d, 0xff, 0x2f, 0x18, 0x09, 0xff, 0x1e, 0x16, 0x0e, 0xff, 0x18, 0x48, 0x73, 0xff, 0x24, 0x33, 0x3c, 0xff, 0x27, 0x38, 0x4b, 0xff, 0x28, 0x49, 0x71, 0xff, 0x2a, 0x1f, 0x0c, 0xff, 0x0a, 0x02, 0x00, 0xff, 0x55, 0x42, 0x2a, 0xff, 0x47, 0x4f, 0x53, 0xff, 0x21, 0x1f, 0x23, 0xff, 0x2c, 0x11, 0x00, 0xff, 0x36, 0x20, 0x03, 0xff, 0x31, 0x1c, 0x00, 0xff, 0x28, 0x0f, 0x00, 0xff, 0x25, 0x37, 0x48, 0xff, 0x20, 0x3e, 0x61, 0xff, 0x21, 0x22, 0x24, 0xff, 0x21, 0x43, 0x62, 0xff, 0x26, 0x33, 0x3b, 0xff, 0x19, 0x08, 0x00, 0xff, 0x1d, 0x10, 0x00, 0xff, 0x2c, 0x1a, 0x02, 0xff, 0x29, 0x18, 0x01, 0xff, 0x2d, 0x19, 0x01, 0xff, 0x2e, 0x19, 0x01, 0xff, 0x3b, 0x23, 0x01, 0xff, 0x28, 0x16, 0x00, 0xff, 0x11, 0x04, 0x00, 0xff, 0x23, 0x08, 0x00, 0xff, 0x26, 0x21, 0x16, 0xff, 0x1d, 0x43, 0x65, 0xff, 0x1a, 0x44, 0x69, 0xff, 0x24, 0x2c, 0x2c, 0xff, 0x27, 0x2f, 0x39, 0xff, 0x1d, 0x48, 0x74, 0xff, 0x15, 0x38, 0x5a, 0xff, 0x27, 0x26, 0x2c, 0xff, 0x2b, 0x00, 0x00, 0xff, 0x2e, 0x1c, 0x1a, 0xff, 0x6f, 0x8f, 0xae, 0xff, 0xc2, 0xce, 0xd5, 0xff, 0x60, 0x5c, 0x59, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1a, 0x13, 0x14, 0xff, 0x1c, 0x64, 0x9c, 0xff, 0x06, 0x58, 0x8f, 0xff, 0x03, 0x5a, 0x9b, 0xff, 0x16, 0x48, 0x69, 0xff, 0x0b, 0x10, 0x0c, 0xff, 0x22, 0x31, 0x2e, 0xff, 0x1f, 0x20, 0x1c, 0xff, 0x06, 0x00, 0x00, 0xff, 0x0b, 0x02, 0x02, 0xff, 0x0c, 0x01, 0x00, 0xff, 0x12, 0x15, 0x18, 0xff, 0x19, 0x3b, 0x59, 0xd2, 0x1c, 0x28, 0x2e, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x08, 0x20, 0x18, 0x13, 0x8f, 0x0c, 0x08, 0x04, 0xfe, 0x08, 0x02, 0x00, 0xff, 0x1c, 0x17, 0x0c, 0xff, 0x0c, 0x05, 0x01, 0xff, 0x12, 0x12, 0x11, 0xff, 0x36, 0x3c, 0x3c, 0xff, 0x53, 0x47, 0x38, 0xff, 0x11, 0x0d, 0x02, 0xff, 0x32, 0x16, 0x00, 0xff, 0x2d, 0x4e, 0x68, 0xff, 0x21, 0x57, 0x81, 0xff, 0x29, 0x38, 0x43, 0xff, 0x1b, 0x51, 0x78, 0xff, 0x20, 0x34, 0x37, 0xff, 0x24, 0x07, 0x00, 0xff, 0x62, 0x58, 0x4f, 0xff, 0x7e, 0x7e, 0x75, 0xff, 0x2f, 0x18, 0x08, 0xff, 0x22, 0x19, 0x0f, 0xff, 0x1c, 0x4c, 0x78, 0xff, 0x23, 0x33, 0x3c, 0xff, 0x22, 0x34, 0x46, 0xff, 0x25, 0x47, 0x6e, 0xff, 0x25, 0x1b, 0x08, 0xff, 0x0c, 0x02, 0x00, 0xff, 0x57, 0x44, 0x2a, 0xff, 0x45, 0x4f, 0x55, 0xff, 0x2a, 0x23, 0x20, 0xff, 0x28, 0x10, 0x00, 0xff, 0x28, 0x18, 0x01, 0xff, 0x2b, 0x18, 0x00, 0xff, 0x32, 0x14, 0x00, 0xff, 0x2b, 0x48, 0x5c, 0xff, 0x1b, 0x58, 0x7f, 0xff, 0x23, 0x2b, 0x30, 0xff, 0x22, 0x4d, 0x78, 0xff, 0x2f, 0x44, 0x53, 0xff, 0x27, 0x0e, 0x00, 0xff, 0x23, 0x12, 0x00, 0xff, 0x36, 0x1e, 0x01, 0xff, 0x30, 0x1b, 0x00, 0xff, 0x2b, 0x19, 0x00, 0xff, 0x30, 0x1b, 0x00, 0xff, 0x34, 0x1c, 0x02, 0xff, 0x29, 0x15, 0x00, 0xff, 0x2a, 0x11, 0x00, 0xff, 0x26, 0x28, 0x23, 0xff, 0x15, 0x3d, 0x60, 0xff, 0x1a, 0x38, 0x55, 0xff, 0x28, 0x23, 0x23, 0xff, 0x29, 0x22, 0x1d, 0xff, 0x12, 0x4b, 0x74, 0xff, 0x20, 0x4d, 0x74, 0xff, 0x1a, 0x11, 0x14, 0xff, 0x1f, 0x00, 0x00, 0xff, 0x33, 0x22, 0x17, 0xff, 0x7e, 0x76, 0x6e, 0xff, 0xa6, 0xa0, 0xa1, 0xff, 0x39, 0x4d, 0x66, 0xff, 0x35, 0x20, 0x0d, 0xff, 0x40, 0x39, 0x33, 0xff, 0x00, 0x3c, 0x6c, 0xff, 0x15, 0x2f, 0x40, 0xff, 0x16, 0x35, 0x4b, 0xff, 0x07, 0x64, 0xa7, 0xff, 0x15, 0x09, 0x02, 0xff, 0x15, 0x19, 0x13, 0xff, 0x42, 0x6e, 0x8c, 0xff, 0x15, 0x1c, 0x24, 0xff, 0x04, 0x00, 0x00, 0xff, 0x08, 0x01, 0x00, 0xff, 0x09, 0x00, 0x00, 0xfe, 0x23, 0x27, 0x31, 0x8f, 0x1f, 0x1f, 0x3f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x13, 0x07, 0x42, 0x00, 0x00, 0x00, 0xdb, 0x08, 0x05, 0x04, 0xff, 0x20, 0x12, 0x03, 0xff, 0x17, 0x15, 0x11, 0xff, 0x3b, 0x3e, 0x3c, 0xff, 0x53, 0x45, 0x33, 0xff, 0x09, 0x05, 0x00, 0xff, 0x2a, 0x16, 0x03, 0xff, 0x29, 0x4e, 0x6d, 0xff, 0x24, 0x53, 0x7b, 0xff, 0x2e, 0x3b, 0x4a, 0xff, 0x1e, 0x5d, 0x8f, 0xff, 0x2c, 0x37, 0x39, 0xff, 0x27, 0x05, 0x00, 0xff, 0x6c, 0x62, 0x5a, 0xff, 0x8c, 0x87, 0x80, 0xff, 0x35, 0x18, 0x05, 0xff, 0x24, 0x1b, 0x12, 0xff, 0x20, 0x50, 0x7c, 0xff, 0x2b, 0x37, 0x41, 0xff, 0x27, 0x40, 0x56, 0xff, 0x27, 0x51, 0x74, 0xff, 0x24, 0x17, 0x06, 0xff, 0x08, 0x00, 0x00, 0xff, 0x5b, 0x49, 0x2f, 0xff, 0x49, 0x51, 0x59, 0xff, 0x24, 0x1f, 0x1c, 0xff, 0x30, 0x14, 0x00, 0xff, 0x2a, 0x18, 0x01, 0xff, 0x1c, 0x0e, 0x00, 0xff, 0x30, 0x12, 0x00, 0xff, 0x2f, 0x47, 0x59, 0xff, 0x27, 0x5a, 0x80, 0xff, 0x30, 0x32, 0x38, 0xff, 0x23, 0x3d, 0x63, 0xff, 0x2a, 0x35, 0x3f, 0xff, 0x1d, 0x0c, 0x00, 0xff, 0x25, 0x11, 0x00, 0xff, 0x34, 0x19, 0x00, 0xff, 0x32, 0x16, 0x00, 0xff, 0x33, 0x16, 0x00, 0xff, 0x35, 0x16, 0x00, 0xff, 0x35, 0x18, 0x00, 0xff, 0x28, 0x0d, 0x00, 0xff, 0x25, 0x2e, 0x31, 0xff, 0x23, 0x63, 0x91, 0xff, 0x22, 0x4e, 0x76, 0xff, 0x1f, 0x21, 0x22, 0xff, 0x28, 0x34, 0x46, 0xff, 0x19, 0x49, 0x73, 0xff, 0x21, 0x3a, 0x4b, 0xff, 0x26, 0x1b, 0x09, 0xff, 0x17, 0x00, 0x00, 0xff, 0x16, 0x0d, 0x0a, 0xff, 0x74, 0x73, 0x6f, 0xff, 0x96, 0x90, 0x86, 0xff, 0x48, 0x3b, 0x38, 0xff, 0x1e, 0x03, 0x00, 0xff, 0x0f, 0x1f, 0x2a, 0xff, 0x2e, 0x7e, 0xb0, 0xff, 0x2d, 0x5e, 0x7a, 0xff, 0x11, 0x12, 0x14, 0xff, 0x11, 0x33, 0x4f, 0xff, 0x12, 0x28, 0x2e, 0xff, 0x07, 0x0c, 0x12, 0xff, 0x49, 0x51, 0x5d, 0xff, 0x23, 0x50, 0x69, 0xff, 0x01, 0x08, 0x0e, 0xff, 0x0a, 0x00, 0x00, 0xff, 0x06, 0x02, 0x00, 0xdb, 0x0b, 0x03, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x87, 0x18, 0x0e, 0x05, 0xf9, 0x1b, 0x16, 0x10, 0xff, 0x3c, 0x38, 0x32, 0xff, 0x4e, 0x3a, 0x27, 0xff, 0x0a, 0x00, 0x00, 0xff, 0x26, 0x15, 0x03, 0xff, 0x23, 0x4a, 0x63, 0xff, 0x22, 0x42, 0x5d, 0xff, 0x2b, 0x2f, 0x3e, 0xff, 0x1a, 0x59, 0x8d, 0xff, 0x2b, 0x2a, 0x31, 0xff, 0x2c, 0x08, 0x00, 0xff, 0x69, 0x67, 0x67, 0xff, 0x7b, 0x83, 0x81, 0xff, 0x2d, 0x16, 0x0b, 0xff, 0x1c, 0x1c, 0x1e, 0xff, 0x0f, 0x4c, 0x7e, 0xff, 0x26, 0x38, 0x49, 0xff, 0x25, 0x41, 0x60, 0xff, 0x1e, 0x4e, 0x7b, 0xff, 0x22, 0x1d, 0x12, 0xff, 0x08, 0x04, 0x03, 0xff, 0x58, 0x52, 0x42, 0xff, 0x47, 0x55, 0x65, 0xff, 0x24, 0x25, 0x23, 0xff, 0x32, 0x15, 0x04, 0xff, 0x34, 0x19, 0x04, 0xff, 0x23, 0x14, 0x01, 0xff, 0x24, 0x1a, 0x0d, 0xff, 0x1c, 0x4b, 0x78, 0xff, 0x19, 0x56, 0x8b, 0xff, 0x22, 0x3b, 0x4b, 0xff, 0x11, 0x4c, 0x7e, 0xff, 0x23, 0x30, 0x3f, 0xff, 0x14, 0x06, 0x01, 0xff, 0x1d, 0x19, 0x11, 0xff, 0x25, 0x22, 0x1d, 0xff, 0x1e, 0x1c, 0x18, 0xff, 0x1e, 0x19, 0x14, 0xff, 0x1e, 0x1f, 0x1f, 0xff, 0x28, 0x23, 0x21, 0xff, 0x25, 0x20, 0x1f, 0xff, 0x1b, 0x48, 0x71, 0xff, 0x1f, 0x4e, 0x74, 0xff, 0x2c, 0x28, 0x21, 0xff, 0x25, 0x32, 0x3f, 0xff, 0x19, 0x55, 0x84, 0xff, 0x18, 0x4a, 0x6a, 0xff, 0x26, 0x11, 0x05, 0xff, 0x1c, 0x00, 0x00, 0xff, 0x33, 0x27, 0x22, 0xff, 0x6f, 0x69, 0x56, 0xff, 0x73, 0x6c, 0x5e, 0xff, 0x2d, 0x23, 0x23, 0xff, 0x0e, 0x00, 0x00, 0xff, 0x1a, 0x0b, 0x01, 0xff, 0x0e, 0x42, 0x72, 0xff, 0x00, 0x53, 0x8b, 0xff, 0x47, 0x55, 0x5a, 0xff, 0x22, 0x48, 0x6a, 0xff, 0x01, 0x10, 0x16, 0xff, 0x06, 0x00, 0x00, 0xff, 0x30, 0x4a, 0x56, 0xff, 0x38, 0x71, 0x9a, 0xff, 0x11, 0x2a, 0x3c, 0xff, 0x21, 0x16, 0x0e, 0xf9, 0x05, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x25, 0x09, 0x19, 0x21, 0xb7, 0x29, 0x41, 0x56, 0xff, 0x36, 0x3b, 0x3a, 0xff, 0x03, 0x04, 0x08, 0xff, 0x17, 0x19, 0x1a, 0xff, 0x06, 0x4e, 0x81, 0xff, 0x0a, 0x47, 0x70, 0xff, 0x0f, 0x40, 0x60, 0xff, 0x07, 0x69, 0xac, 0xff, 0x19, 0x39, 0x51, 0xff, 0x1f, 0x1a, 0x1e, 0xff, 0x5d, 0x75, 0x89, 0xff, 0x63, 0x84, 0x99, 0xff, 0x24, 0x23, 0x2a, 0xff, 0x1c, 0x34, 0x44, 0xff, 0x0b, 0x65, 0xa8, 0xff, 0x1a, 0x49, 0x6a, 0xff, 0x13, 0x5b, 0x89, 0xff, 0x16, 0x61, 0x99, 0xff, 0x26, 0x2b, 0x2e, 0xff, 0x0f, 0x15, 0x13, 0xff, 0x5c, 0x64, 0x62, 0xff, 0x3c, 0x61, 0x80, 0xff, 0x1f, 0x36, 0x45, 0xff, 0x2b, 0x27, 0x1e, 0xff, 0x27, 0x26, 0x24, 0xff, 0x29, 0x21, 0x19, 0xff, 0x3b, 0x39, 0x33, 0xff, 0x28, 0x68, 0x9d, 0xff, 0x20, 0x6c, 0xa5, 0xff, 0x27, 0x63, 0x85, 0xff, 0x18, 0x81, 0xc7, 0xff, 0x2b, 0x4b, 0x62, 0xff, 0x29, 0x1a, 0x10, 0xff, 0x2a, 0x30, 0x33, 0xff, 0x3c, 0x40, 0x44, 0xff, 0x3b, 0x3e, 0x3c, 0xff, 0x37, 0x39, 0x33, 0xff, 0x43, 0x42, 0x3e, 0xff, 0x4b, 0x41, 0x3c, 0xff, 0x37, 0x3d, 0x42, 0xff, 0x19, 0x35, 0x53, 0xff, 0x24, 0x24, 0x1f, 0xff, 0x23, 0x36, 0x3f, 0xff, 0x19, 0x4b, 0x7a, 0xff, 0x1d, 0x45, 0x62, 0xff, 0x28, 0x1b, 0x0e, 0xff, 0x16, 0x03, 0x00, 0xff, 0x3d, 0x32, 0x38, 0xff, 0x96, 0x8f, 0x88, 0xff, 0x80, 0x7b, 0x73, 0xff, 0x24, 0x13, 0x11, 0xff, 0x19, 0x00, 0x00, 0xff, 0x1d, 0x1e, 0x1b, 0xff, 0x1d, 0x4c, 0x75, 0xff, 0x28, 0x3d, 0x5c, 0xff, 0x1d, 0x25, 0x2a, 0xff, 0x06, 0x59, 0x95, 0xff, 0x34, 0x65, 0x89, 0xff, 0x20, 0x0e, 0x00, 0xff, 0x07, 0x00, 0x00, 0xff, 0x4b, 0x4f, 0x4d, 0xff, 0x11, 0x54, 0x80, 0xff, 0x1b, 0x2d, 0x3d, 0xb7, 0x1a, 0x14, 0x0d, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x6d, 0x7f, 0x46, 0x58, 0x5f, 0x58, 0xca, 0x28, 0x24, 0x1a, 0xff, 0x43, 0x46, 0x3f, 0xff, 0x2d, 0x75, 0xa7, 0xff, 0x37, 0x6b, 0x8f, 0xff, 0x3c, 0x67, 0x7e, 0xff, 0x2e, 0x84, 0xc3, 0xff, 0x40, 0x56, 0x5a, 0xff, 0x4c, 0x3b, 0x31, 0xff, 0x97, 0x9c, 0xa0, 0xff, 0x90, 0x94, 0x9c, 0xff, 0x40, 0x2f, 0x26, 0xff, 0x3e, 0x45, 0x45, 0xff, 0x34, 0x6d, 0x9f, 0xff, 0x38, 0x4f, 0x60, 0xff, 0x33, 0x60, 0x80, 0xff, 0x38, 0x62, 0x7e, 0xff, 0x3e, 0x36, 0x28, 0xff, 0x26, 0x21, 0x1b, 0xff, 0x76, 0x6b, 0x5e, 0xff, 0x60, 0x75, 0x81, 0xff, 0x43, 0x4d, 0x4f, 0xff, 0x52, 0x41, 0x2b, 0xff, 0x50, 0x46, 0x38, 0xff, 0x42, 0x34, 0x24, 0xff, 0x49, 0x37, 0x28, 0xff, 0x45, 0x6d, 0x90, 0xff, 0x44, 0x6b, 0x89, 0xff, 0x49, 0x63, 0x77, 0xff, 0x41, 0x84, 0xba, 0xff, 0x49, 0x56, 0x5a, 0xff, 0x3e, 0x30, 0x1b, 0xff, 0x41, 0x34, 0x22, 0xff, 0x47, 0x35, 0x21, 0xff, 0x42, 0x31, 0x1e, 0xff, 0x3f, 0x2e, 0x1a, 0xff, 0x38, 0x2b, 0x17, 0xff, 0x38, 0x1d, 0x11, 0xff, 0x24, 0x2b, 0x33, 0xff, 0x1e, 0x28, 0x22, 0xff, 0x27, 0x36, 0x43, 0xff, 0x1b, 0x4f, 0x82, 0xff, 0x1d, 0x39, 0x54, 0xff, 0x28, 0x16, 0x08, 0xff, 0x1e, 0x01, 0x00, 0xff, 0x3b, 0x30, 0x32, 0xff, 0x94, 0x92, 0x82, 0xff, 0x87, 0x7e, 0x77, 0xff, 0x30, 0x20, 0x22, 0xff, 0x23, 0x00, 0x00, 0xff, 0x2b, 0x24, 0x1b, 0xff, 0x20, 0x57, 0x80, 0xff, 0x19, 0x54, 0x84, 0xff, 0x23, 0x26, 0x27, 0xff, 0x26, 0x37, 0x47, 0xff, 0x0e, 0x4f, 0x82, 0xff, 0x26, 0x31, 0x3a, 0xff, 0x2e, 0x1e, 0x0c, 0xff, 0x37, 0x31, 0x22, 0xff, 0x25, 0x2e, 0x32, 0xca, 0x15, 0x1d, 0x24, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x09, 0x4d, 0x2b, 0x2a, 0x21, 0xcc, 0x25, 0x53, 0x73, 0xff, 0x24, 0x3f, 0x55, 0xff, 0x25, 0x3a, 0x42, 0xff, 0x1e, 0x51, 0x7c, 0xff, 0x22, 0x29, 0x2a, 0xff, 0x23, 0x14, 0x0c, 0xff, 0x63, 0x6c, 0x66, 0xff, 0x65, 0x69, 0x64, 0xff, 0x14, 0x08, 0x04, 0xff, 0x10, 0x18, 0x1b, 0xff, 0x0e, 0x35, 0x5b, 0xff, 0x13, 0x20, 0x28, 0xff, 0x14, 0x27, 0x3c, 0xff, 0x10, 0x2e, 0x49, 0xff, 0x0e, 0x0c, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x3f, 0x37, 0x2c, 0xff, 0x2e, 0x3f, 0x44, 0xff, 0x1b, 0x21, 0x20, 0xff, 0x21, 0x13, 0x0a, 0xff, 0x1d, 0x1a, 0x13, 0xff, 0x16, 0x0d, 0x07, 0xff, 0x0c, 0x03, 0x00, 0xff, 0x09, 0x29, 0x45, 0xff, 0x0e, 0x29, 0x3e, 0xff, 0x11, 0x20, 0x2c, 0xff, 0x04, 0x33, 0x5c, 0xff, 0x0d, 0x16, 0x1a, 0xff, 0x0a, 0x01, 0x00, 0xff, 0x0f, 0x08, 0x00, 0xff, 0x0c, 0x03, 0x00, 0xff, 0x09, 0x00, 0x00, 0xff, 0x0a, 0x00, 0x00, 0xff, 0x0d, 0x01, 0x00, 0xff, 0x12, 0x00, 0x00, 0xff, 0x18, 0x0d, 0x0b, 0xff, 0x10, 0x52, 0x7b, 0xff, 0x16, 0x52, 0x81, 0xff, 0x23, 0x31, 0x48, 0xff, 0x25, 0x10, 0x01, 0xff, 0x12, 0x00, 0x00, 0xff, 0x3b, 0x33, 0x32, 0xff, 0x95, 0x92, 0x83, 0xff, 0x7a, 0x76, 0x71, 0xff, 0x2f, 0x1f, 0x1d, 0xff, 0x22, 0x02, 0x00, 0xff, 0x28, 0x1f, 0x14, 0xff, 0x17, 0x45, 0x6c, 0xff, 0x12, 0x49, 0x74, 0xff, 0x22, 0x25, 0x24, 0xff, 0x1a, 0x33, 0x46, 0xff, 0x18, 0x4f, 0x7d, 0xff, 0x25, 0x1e, 0x17, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2e, 0x34, 0x34, 0xcc, 0x70, 0x70, 0x69, 0x4d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x2b, 0x4e, 0x41, 0x09, 0x18, 0x23, 0xb4, 0x0e, 0x14, 0x1d, 0xfe, 0x05, 0x2b, 0x49, 0xff, 0x0e, 0x09, 0x00, 0xff, 0x19, 0x00, 0x00, 0xff, 0x62, 0x5c, 0x51, 0xff, 0x5f, 0x54, 0x4b, 0xff, 0x14, 0x00, 0x00, 0xff, 0x12, 0x11, 0x08, 0xff, 0x0f, 0x2b, 0x45, 0xff, 0x1b, 0x16, 0x1c, 0xff, 0x16, 0x1f, 0x25, 0xff, 0x16, 0x25, 0x38, 0xff, 0x17, 0x06, 0x00, 0xff, 0x06, 0x00, 0x00, 0xff, 0x40, 0x2c, 0x19, 0xff, 0x2a, 0x2e, 0x2c, 0xff, 0x12, 0x0f, 0x0c, 0xff, 0x1a, 0x03, 0x00, 0xff, 0x12, 0x01, 0x00, 0xff, 0x11, 0x00, 0x00, 0xff, 0x26, 0x1d, 0x0b, 0xff, 0x16, 0x30, 0x43, 0xff, 0x16, 0x19, 0x21, 0xff, 0x17, 0x1a, 0x1b, 0xff, 0x12, 0x38, 0x55, 0xff, 0x1f, 0x1a, 0x13, 0xff, 0x11, 0x00, 0x00, 0xff, 0x1c, 0x0b, 0x00, 0xff, 0x28, 0x14, 0x00, 0xff, 0x26, 0x12, 0x00, 0xff, 0x25, 0x12, 0x01, 0xff, 0x29, 0x1a, 0x08, 0xff, 0x22, 0x10, 0x05, 0xff, 0x3b, 0x41, 0x42, 0xff, 0x17, 0x79, 0xc3, 0xff, 0x09, 0x46, 0x78, 0xff, 0x2b, 0x08, 0x00, 0xff, 0x11, 0x00, 0x00, 0xff, 0x37, 0x32, 0x35, 0xff, 0x93, 0x8b, 0x81, 0xff, 0x74, 0x71, 0x61, 0xff, 0x20, 0x13, 0x0d, 0xff, 0x20, 0x03, 0x00, 0xff, 0x23, 0x21, 0x14, 0xff, 0x19, 0x47, 0x66, 0xff, 0x1c, 0x49, 0x6d, 0xff, 0x22, 0x24, 0x29, 0xff, 0x20, 0x2e, 0x34, 0xff, 0x16, 0x59, 0x8a, 0xff, 0x25, 0x37, 0x43, 0xfe, 0x12, 0x00, 0x00, 0xb4, 0x0f, 0x07, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x41, 0x5e, 0x23, 0x0b, 0x5a, 0x92, 0x88, 0x24, 0x27, 0x26, 0xe6, 0x2d, 0x28, 0x24, 0xff, 0x7a, 0x91, 0x9d, 0xff, 0x65, 0x7b, 0x8e, 0xff, 0x24, 0x1c, 0x24, 0xff, 0x18, 0x33, 0x3e, 0xff, 0x09, 0x60, 0x98, 0xff, 0x19, 0x3e, 0x5f, 0xff, 0x11, 0x4a, 0x76, 0xff, 0x0c, 0x53, 0x86, 0xff, 0x1a, 0x22, 0x29, 0xff, 0x0e, 0x0e, 0x10, 0xff, 0x4e, 0x51, 0x4d, 0xff, 0x2e, 0x51, 0x68, 0xff, 0x19, 0x30, 0x3d, 0xff, 0x2d, 0x24, 0x19, 0xff, 0x2d, 0x24, 0x1b, 0xff, 0x1f, 0x17, 0x16, 0xff, 0x24, 0x41, 0x58, 0xff, 0x09, 0x7b, 0xc3, 0xff, 0x0d, 0x5a, 0x8b, 0xff, 0x11, 0x4b, 0x7d, 0xff, 0x0b, 0x68, 0xac, 0xff, 0x1f, 0x35, 0x48, 0xff, 0x14, 0x15, 0x14, 0xff, 0x22, 0x2b, 0x32, 0xff, 0x2a, 0x37, 0x42, 0xff, 0x20, 0x2b, 0x37, 0xff, 0x21, 0x30, 0x3f, 0xff, 0x20, 0x3a, 0x4b, 0xff, 0x1f, 0x30, 0x3e, 0xff, 0x16, 0x3b, 0x53, 0xff, 0x44, 0x6a, 0x7d, 0xff, 0x2f, 0x2b, 0x27, 0xff, 0x0d, 0x09, 0x0c, 0xff, 0x3a, 0x2f, 0x27, 0xff, 0x8f, 0x89, 0x77, 0xff, 0x70, 0x6b, 0x64, 0xff, 0x22, 0x12, 0x0c, 0xff, 0x1f, 0x02, 0x00, 0xff, 0x1f, 0x22, 0x1c, 0xff, 0x17, 0x49, 0x73, 0xff, 0x18, 0x47, 0x70, 0xff, 0x22, 0x29, 0x2c, 0xff, 0x20, 0x2c, 0x34, 0xff, 0x0f, 0x4c, 0x7e, 0xe7, 0x21, 0x41, 0x54, 0x88, 0x24, 0x0e, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x66, 0x05, 0x18, 0x48, 0x6a, 0x4a, 0x6a, 0xb2, 0xe3, 0xa0, 0x55, 0x97, 0xce, 0xef, 0x14, 0x30, 0x4b, 0xff, 0x0d, 0x50, 0x7f, 0xff, 0x00, 0x88, 0xea, 0xff, 0x07, 0x59, 0x9a, 0xff, 0x00, 0x63, 0xb1, 0xff, 0x03, 0x71, 0xc2, 0xff, 0x12, 0x3b, 0x59, 0xff, 0x08, 0x1c, 0x2c, 0xff, 0x45, 0x6c, 0x88, 0xff, 0x1d, 0x74, 0xb2, 0xff, 0x0b, 0x46, 0x70, 0xff, 0x22, 0x36, 0x48, 0xff, 0x25, 0x3e, 0x56, 0xff, 0x1c, 0x22, 0x2c, 0xff, 0x1a, 0x48, 0x67, 0xff, 0x00, 0x81, 0xe6, 0xff, 0x00, 0x38, 0x71, 0xff, 0x00, 0x39, 0x6b, 0xff, 0x00, 0x7e, 0xda, 0xff, 0x16, 0x40, 0x5c, 0xff, 0x17, 0x25, 0x34, 0xff, 0x1f, 0x35, 0x45, 0xff, 0x1f, 0x39, 0x4c, 0xff, 0x16, 0x29, 0x3d, 0xff, 0x1e, 0x2c, 0x3d, 0xff, 0x20, 0x2e, 0x3b, 0xff, 0x1d, 0x24, 0x2c, 0xff, 0x0f, 0x0e, 0x13, 0xff, 0x23, 0x12, 0x06, 0xff, 0x4a, 0x35, 0x28, 0xff, 0x3b, 0x55, 0x73, 0xff, 0x85, 0x99, 0xa7, 0xff, 0x68, 0x62, 0x50, 0xff, 0x19, 0x0b, 0x07, 0xff, 0x19, 0x00, 0x00, 0xff, 0x21, 0x1e, 0x1d, 0xff, 0x17, 0x44, 0x6c, 0xff, 0x17, 0x48, 0x75, 0xff, 0x21, 0x29, 0x2c, 0xef, 0x1b, 0x27, 0x2c, 0xa0, 0x18, 0x48, 0x78, 0x4a, 0x33, 0x33, 0x66, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6d, 0x91, 0x07, 0x20, 0x12, 0x12, 0x46, 0x17, 0x39, 0x50, 0x8e, 0x00, 0x64, 0xae, 0xd7, 0x12, 0x3e, 0x61, 0xff, 0x0c, 0x43, 0x74, 0xff, 0x0d, 0x4b, 0x84, 0xff, 0x14, 0x21, 0x26, 0xff, 0x0a, 0x0e, 0x0e, 0xff, 0x4b, 0x52, 0x5b, 0xff, 0x2b, 0x5b, 0x86, 0xff, 0x16, 0x33, 0x48, 0xff, 0x23, 0x22, 0x1b, 0xff, 0x1b, 0x24, 0x28, 0xff, 0x23, 0x17, 0x0d, 0xff, 0x14, 0x3a, 0x54, 0xff, 0x16, 0x6c, 0xaa, 0xff, 0x8e, 0x99, 0xa3, 0xff, 0x6e, 0x7e, 0x84, 0xff, 0x09, 0x5b, 0x95, 0xff, 0x19, 0x2c, 0x36, 0xff, 0x1c, 0x18, 0x19, 0xff, 0x20, 0x26, 0x23, 0xff, 0x23, 0x24, 0x23, 0xff, 0x24, 0x22, 0x22, 0xff, 0x21, 0x24, 0x26, 0xff, 0x19, 0x1d, 0x22, 0xff, 0x1f, 0x2a, 0x2f, 0xff, 0x19, 0x15, 0x09, 0xff, 0x00, 0x00, 0x00, 0xff, 0x46, 0x41, 0x44, 0xff, 0xbe, 0xc6, 0xbe, 0xff, 0x5b, 0x76, 0x90, 0xff, 0x11, 0x0e, 0x18, 0xff, 0x1b, 0x00, 0x00, 0xff, 0x21, 0x25, 0x26, 0xff, 0x1d, 0x42, 0x63, 0xd7, 0x15, 0x39, 0x62, 0x8e, 0x1d, 0x20, 0x20, 0x46, 0x24, 0x24, 0x24, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x4b, 0x71, 0x1b, 0x09, 0x51, 0x8a, 0x55, 0x07, 0x55, 0x94, 0x8f, 0x16, 0x24, 0x30, 0xc2, 0x0a, 0x12, 0x15, 0xea, 0x3a, 0x4d, 0x57, 0xff, 0x1e, 0x5d, 0x89, 0xff, 0x15, 0x37, 0x54, 0xff, 0x24, 0x23, 0x24, 0xff, 0x13, 0x20, 0x21, 0xff, 0x1b, 0x1e, 0x1b, 0xff, 0x02, 0x3e, 0x76, 0xff, 0x77, 0xab, 0xcf, 0xff, 0xff, 0xff, 0xed, 0xff, 0xea, 0xee, 0xed, 0xff, 0x48, 0x8c, 0xbd, 0xff, 0x01, 0x21, 0x41, 0xff, 0x12, 0x22, 0x2c, 0xff, 0x1e, 0x39, 0x4c, 0xff, 0x1e, 0x31, 0x4c, 0xff, 0x1c, 0x33, 0x4b, 0xff, 0x1a, 0x38, 0x4f, 0xff, 0x17, 0x37, 0x4e, 0xff, 0x25, 0x43, 0x59, 0xff, 0x1c, 0x1a, 0x21, 0xff, 0x31, 0x23, 0x1a, 0xff, 0x6b, 0x6d, 0x62, 0xff, 0x77, 0x7a, 0x77, 0xea, 0x40, 0x33, 0x2b, 0xc2, 0x10, 0x0a, 0x05, 0x8f, 0x15, 0x2a, 0x3c, 0x55, 0x1c, 0x38, 0x55, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x5a, 0x69, 0x11, 0x17, 0x66, 0x99, 0x37, 0x0a, 0x40, 0x68, 0x5f, 0x22, 0x31, 0x48, 0x86, 0x18, 0x2a, 0x36, 0xa8, 0x16, 0x1d, 0x22, 0xc0, 0x00, 0x37, 0x64, 0xd3, 0x5e, 0x92, 0xb4, 0xe6, 0xb8, 0xba, 0xad, 0xee, 0xb5, 0xbf, 0xc3, 0xf5, 0x41, 0x7f, 0xb0, 0xff, 0x00, 0x1f, 0x33, 0xff, 0x0f, 0x1d, 0x24, 0xf5, 0x24, 0x2a, 0x34, 0xee, 0x23, 0x27, 0x2e, 0xe6, 0x1a, 0x21, 0x29, 0xd3, 0x1b, 0x22, 0x22, 0xc0, 0x1e, 0x22, 0x1e, 0xa8, 0x1c, 0x11, 0x13, 0x86, 0x2a, 0x33, 0x43, 0x5f, 0x86, 0x8f, 0x8f, 0x37, 0x69, 0x69, 0x5a, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const lv_image_dsc_t img_multilang_avatar_17 = {
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .header.w = 128,
+    .header.h = 128,
+    .header.stride = 512,
+    .data = img_multilang_avatar_17_map,
+    .data_size = sizeof(img_multilang_avatar_17_map),
+};
+
+#endif
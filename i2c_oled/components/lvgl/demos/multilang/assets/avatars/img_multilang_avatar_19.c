@@ -0,0 +1,166 @@
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+#if LV_USE_DEMO_MULTILANG
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_19
+    #define LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_19
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_19 uint8_t
+img_multilang_avatar_19_map[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x11, 0x09, 0x09, 0x09, 0x37, 0x12, 0x12, 0x12, 0x5e, 0x1c, 0x1c, 0x1c, 0x86, 0x16, 0x16, 0x16, 0xa8, 0x11, 0x11, 0x11, 0xbf, 0x06, 0x06, 0x06, 0xd2, 0x0a, 0x0a, 0x0a, 0xe5, 0x0d, 0x0d, 0x0d, 0xee, 0x0f, 0x0f, 0x0f, 0xf2, 0x15, 0x15, 0x15, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x20, 0x20, 0x20, 0xf2, 0x26, 0x26, 0x26, 0xee, 0x2d, 0x2d, 0x2d, 0xe5, 0x3b, 0x3b, 0x3b, 0xd2, 0x39, 0x39, 0x39, 0xbf, 0x3f, 0x3f, 0x3f, 0xa8, 0x44, 0x44, 0x44, 0x86, 0x30, 0x30, 0x30, 0x5e, 0x29, 0x29, 0x29, 0x37, 0x2d, 0x2d, 0x2d, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x19, 0x09, 0x09, 0x09, 0x55, 0x11, 0x11, 0x11, 0x8f, 0x0b, 0x0b, 0x0b, 0xc1, 0x08, 0x08, 0x08, 0xe9, 0x06, 0x06, 0x06, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x16, 0x16, 0x16, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x08, 0x08, 0x08, 0xff, 0x09, 0x09, 0x09, 0xff, 0x11, 0x11, 0x11, 0xff, 0x12, 0x12, 0x12, 0xff, 0x16, 0x16, 0x16, 0xff, 0x23, 0x23, 0x23, 0xff, 0x25, 0x25, 0x25, 0xff, 0x20, 0x20, 0x20, 0xff, 0x18, 0x18, 0x18, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x31, 0x31, 0x31, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x25, 0x25, 0x25, 0xff, 0x38, 0x38, 0x38, 0xe9, 0x23, 0x23, 0x23, 0xc1, 0x2c, 0x2c, 0x2c, 0x8f, 0x2a, 0x2a, 0x2a, 0x55, 0x3d, 0x3d, 0x3d, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6d, 0x6d, 0x07, 0x3a, 0x3a, 0x3a, 0x46, 0x05, 0x05, 0x05, 0x8e, 0x05, 0x05, 0x05, 0xd7, 0x08, 0x08, 0x08, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x09, 0x09, 0x09, 0xff, 0x09, 0x09, 0x09, 0xff, 0x09, 0x09, 0x09, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x18, 0x18, 0x18, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x13, 0x13, 0x13, 0xff, 0x13, 0x13, 0x13, 0xff, 0x19, 0x19, 0x19, 0xff, 0x29, 0x29, 0x29, 0xff, 0x27, 0x27, 0x27, 0xff, 0x16, 0x16, 0x16, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x10, 0x10, 0x10, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x17, 0x17, 0x17, 0xff, 0x25, 0x25, 0x25, 0xff, 0x42, 0x42, 0x42, 0xff, 0x44, 0x44, 0x44, 0xff, 0x48, 0x48, 0x48, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x27, 0x27, 0x27, 0xff, 0x23, 0x23, 0x23, 0xff, 0x33, 0x33, 0x33, 0xff, 0x3c, 0x3c, 0x3c, 0xd7, 0x3d, 0x3d, 0x3d, 0x8e, 0x2f, 0x2f, 0x2f, 0x46, 0x24, 0x24, 0x24, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x05, 0x63, 0x63, 0x63, 0x48, 0x6b, 0x6b, 0x6b, 0x9f, 0x50, 0x50, 0x50, 0xef, 0x0e, 0x0e, 0x0e, 0xff, 0x03, 0x03, 0x03, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x09, 0x09, 0x09, 0xff, 0x09, 0x09, 0x09, 0xff, 0x04, 0x04, 0x04, 0xff, 0x17, 0x17, 0x17, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x10, 0x10, 0x10, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x11, 0x11, 0x11, 0xff, 0x12, 0x12, 0x12, 0xff, 0x17, 0x17, 0x17, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x24, 0x24, 0x24, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x03, 0x03, 0x03, 0xff, 0x09, 0x09, 0x09, 0xff, 0x16, 0x16, 0x16, 0xff, 0x23, 0x23, 0x23, 0xff, 0x22, 0x22, 0x22, 0xff, 0x19, 0x19, 0x19, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x37, 0x37, 0x37, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x56, 0x56, 0x56, 0xff, 0x60, 0x60, 0x60, 0xff, 0x53, 0x53, 0x53, 0xff, 0x40, 0x40, 0x40, 0xff, 0x41, 0x41, 0x41, 0xff, 0x46, 0x46, 0x46, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x3c, 0x3c, 0x3c, 0xef, 0x31, 0x31, 0x31, 0x9f, 0x31, 0x31, 0x31, 0x48, 0x33, 0x33, 0x33, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x50, 0x50, 0x23, 0x5d, 0x5d, 0x5d, 0x86, 0x63, 0x63, 0x63, 0xe5, 0x68, 0x68, 0x68, 0xff, 0x61, 0x61, 0x61, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x02, 0x02, 0x02, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x09, 0x09, 0x09, 0xff, 0x07, 0x07, 0x07, 0xff, 0x02, 0x02, 0x02, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x10, 0x10, 0x10, 0xff, 0x08, 0x08, 0x08, 0xff, 0x09, 0x09, 0x09, 0xff, 0x11, 0x11, 0x11, 0xff, 0x14, 0x14, 0x14, 0xff, 0x14, 0x14, 0x14, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x23, 0x23, 0x23, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x14, 0x14, 0x14, 0xff, 0x13, 0x13, 0x13, 0xff, 0x16, 0x16, 0x16, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x10, 0x10, 0x10, 0xff, 0x14, 0x14, 0x14, 0xff, 0x30, 0x30, 0x30, 0xff, 0x34, 0x34, 0x34, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x44, 0x44, 0x44, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x35, 0x35, 0x35, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x33, 0x33, 0x33, 0xff, 0x31, 0x31, 0x31, 0xff, 0x35, 0x35, 0x35, 0xff, 0x30, 0x30, 0x30, 0xff, 0x22, 0x22, 0x22, 0xff, 0x32, 0x32, 0x32, 0xe5, 0x68, 0x68, 0x68, 0x86, 0x99, 0x99, 0x99, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x46, 0x46, 0x41, 0x49, 0x49, 0x49, 0xb4, 0x50, 0x50, 0x50, 0xfe, 0x5e, 0x5e, 0x5e, 0xff, 0x64, 0x64, 0x64, 0xff, 0x66, 0x66, 0x66, 0xff, 0x34, 0x34, 0x34, 0xff, 0x04, 0x04, 0x04, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x17, 0x17, 0x17, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x06, 0x06, 0x06, 0xff, 0x09, 0x09, 0x09, 0xff, 0x12, 0x12, 0x12, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x26, 0x26, 0x26, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x07, 0x07, 0x07, 0xff, 0x09, 0x09, 0x09, 0xff, 0x13, 0x13, 0x13, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x14, 0x14, 0x14, 0xff, 0x29, 0x29, 0x29, 0xff, 0x28, 0x28, 0x28, 0xff, 0x16, 0x16, 0x16, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x42, 0x42, 0x42, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x37, 0x37, 0x37, 0xff, 0x32, 0x32, 0x32, 0xff, 0x29, 0x29, 0x29, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x16, 0x16, 0x16, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x72, 0x72, 0x72, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5e, 0x5e, 0x5e, 0xfe, 0x48, 0x48, 0x48, 0xb4, 0x46, 0x46, 0x46, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x43, 0x43, 0x4c, 0x43, 0x43, 0x43, 0xcb, 0x47, 0x47, 0x47, 0xff, 0x49, 0x49, 0x49, 0xff, 0x51, 0x51, 0x51, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x67, 0x67, 0x67, 0xff, 0x48, 0x48, 0x48, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x08, 0x08, 0x08, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x17, 0x17, 0x17, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x09, 0x09, 0x09, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x35, 0x35, 0x35, 0xff, 0x14, 0x14, 0x14, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x08, 0x08, 0x08, 0xff, 0x02, 0x02, 0x02, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x13, 0x13, 0x13, 0xff, 0x17, 0x17, 0x17, 0xff, 0x11, 0x11, 0x11, 0xff, 0x13, 0x13, 0x13, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x26, 0x26, 0x26, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x51, 0x51, 0x51, 0xff, 0x39, 0x39, 0x39, 0xff, 0x20, 0x20, 0x20, 0xff, 0x25, 0x25, 0x25, 0xff, 0x34, 0x34, 0x34, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x22, 0x22, 0x22, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x18, 0x18, 0x18, 0xff, 0x44, 0x44, 0x44, 0xff, 0x76, 0x76, 0x76, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x37, 0x37, 0x37, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x38, 0x38, 0x38, 0xff, 0x3b, 0x3b, 0x3b, 0xcb, 0x45, 0x45, 0x45, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x3d, 0x3d, 0x46, 0x41, 0x41, 0x41, 0xc9, 0x42, 0x42, 0x42, 0xff, 0x44, 0x44, 0x44, 0xff, 0x48, 0x48, 0x48, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x51, 0x51, 0x51, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x22, 0x22, 0x22, 0xff, 0x01, 0x01, 0x01, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x04, 0x04, 0x04, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x12, 0x12, 0x12, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x12, 0x12, 0x12, 0xff, 0x34, 0x34, 0x34, 0xff, 0x27, 0x27, 0x27, 0xff, 0x09, 0x09, 0x09, 0xff, 0x09, 0x09, 0x09, 0xff, 0x06, 0x06, 0x06, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x21, 0x21, 0x21, 0xff, 0x11, 0x11, 0x11, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x32, 0x32, 0x32, 0xff, 0x38, 0x38, 0x38, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x19, 0x19, 0x19, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x34, 0x34, 0x34, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x14, 0x14, 0x14, 0xff, 0x12, 0x12, 0x12, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x54, 0x54, 0x54, 0xff, 0x68, 0x68, 0x68, 0xff, 0x59, 0x59, 0x59, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x35, 0x35, 0x35, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x45, 0x45, 0x45, 0xff, 0x62, 0x62, 0x62, 0xff, 0x72, 0x72, 0x72, 0xc9, 0x50, 0x50, 0x50, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x24, 0x3b, 0x3b, 0x3b, 0xb4, 0x3f, 0x3f, 0x3f, 0xff, 0x42, 0x42, 0x42, 0xff, 0x42, 0x42, 0x42, 0xff, 0x44, 0x44, 0x44, 0xff, 0x47, 0x47, 0x47, 0xff, 0x49, 0x49, 0x49, 0xff, 0x52, 0x52, 0x52, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x09, 0x09, 0x09, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x06, 0x06, 0x06, 0xff, 0x03, 0x03, 0x03, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x12, 0x12, 0x12, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x09, 0x09, 0x09, 0xff, 0x21, 0x21, 0x21, 0xff, 0x32, 0x32, 0x32, 0xff, 0x12, 0x12, 0x12, 0xff, 0x09, 0x09, 0x09, 0xff, 0x04, 0x04, 0x04, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x09, 0x09, 0x09, 0xff, 0x12, 0x12, 0x12, 0xff, 0x16, 0x16, 0x16, 0xff, 0x14, 0x14, 0x14, 0xff, 0x12, 0x12, 0x12, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x30, 0x30, 0x30, 0xff, 0x13, 0x13, 0x13, 0xff, 0x20, 0x20, 0x20, 0xff, 0x40, 0x40, 0x40, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x62, 0x62, 0x62, 0xff, 0x63, 0x63, 0x63, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x31, 0x31, 0x31, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x72, 0x72, 0x72, 0xff, 0x71, 0x71, 0x71, 0xff, 0x61, 0x61, 0x61, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x2a, 0x2a, 0x2a, 0xb5, 0x38, 0x38, 0x38, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x09, 0x34, 0x34, 0x34, 0x87, 0x38, 0x38, 0x38, 0xf9, 0x3c, 0x3c, 0x3c, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x40, 0x40, 0x40, 0xff, 0x42, 0x42, 0x42, 0xff, 0x45, 0x45, 0x45, 0xff, 0x48, 0x48, 0x48, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x51, 0x51, 0x51, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x19, 0x19, 0x19, 0xff, 0x00, 0x00, 0x00, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x11, 0x11, 0x11, 0xff, 0x20, 0x20, 0x20, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x10, 0x10, 0x10, 0xff, 0x12, 0x12, 0x12, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x25, 0x25, 0x25, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x13, 0x13, 0x13, 0xff, 0x13, 0x13, 0x13, 0xff, 0x17, 0x17, 0x17, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x31, 0x31, 0x31, 0xff, 0x40, 0x40, 0x40, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x24, 0x24, 0x24, 0xff, 0x22, 0x22, 0x22, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x30, 0x30, 0x30, 0xff, 0x07, 0x07, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x54, 0x54, 0x54, 0xff, 0x68, 0x68, 0x68, 0xff, 0x65, 0x65, 0x65, 0xff, 0x64, 0x64, 0x64, 0xff, 0x58, 0x58, 0x58, 0xff, 0x54, 0x54, 0x54, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x65, 0x65, 0x65, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x69, 0x69, 0x69, 0xff, 0x58, 0x58, 0x58, 0xff, 0x49, 0x49, 0x49, 0xff, 0x47, 0x47, 0x47, 0xff, 0x49, 0x49, 0x49, 0xff, 0x4f, 0x4f, 0x4f, 0xf9, 0x45, 0x45, 0x45, 0x87, 0x38, 0x38, 0x38, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x2b, 0x40, 0x31, 0x31, 0x31, 0xda, 0x34, 0x34, 0x34, 0xff, 0x37, 0x37, 0x37, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x42, 0x42, 0x42, 0xff, 0x44, 0x44, 0x44, 0xff, 0x49, 0x49, 0x49, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x07, 0x07, 0x07, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x19, 0x19, 0x19, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x09, 0x09, 0x09, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x10, 0x10, 0x10, 0xff, 0x29, 0x29, 0x29, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x04, 0x04, 0x04, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x11, 0x11, 0x11, 0xff, 0x15, 0x15, 0x15, 0xff, 0x14, 0x14, 0x14, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x45, 0x45, 0x45, 0xff, 0x35, 0x35, 0x35, 0xff, 0x25, 0x25, 0x25, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x28, 0x28, 0x28, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x31, 0x31, 0x31, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x62, 0x62, 0x62, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x65, 0x65, 0x65, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x67, 0x67, 0x67, 0xff, 0x78, 0x78, 0x78, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x71, 0x71, 0x71, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x74, 0x74, 0x74, 0xff, 0x72, 0x72, 0x72, 0xff, 0x62, 0x62, 0x62, 0xff, 0x64, 0x64, 0x64, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x48, 0x48, 0x48, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x54, 0x54, 0x54, 0xda, 0x4a, 0x4a, 0x4a, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x07, 0x25, 0x25, 0x25, 0x8e, 0x2c, 0x2c, 0x2c, 0xfe, 0x31, 0x31, 0x31, 0xff, 0x34, 0x34, 0x34, 0xff, 0x37, 0x37, 0x37, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x42, 0x42, 0x42, 0xff, 0x44, 0x44, 0x44, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x12, 0x12, 0x12, 0xff, 0x03, 0x03, 0x03, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x07, 0x07, 0x07, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x06, 0x06, 0x06, 0xff, 0x16, 0x16, 0x16, 0xff, 0x21, 0x21, 0x21, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x17, 0x17, 0x17, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x05, 0x05, 0x05, 0xff, 0x10, 0x10, 0x10, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x14, 0x14, 0x14, 0xff, 0x28, 0x28, 0x28, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x01, 0x01, 0x01, 0xff, 0x04, 0x04, 0x04, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x08, 0x08, 0x08, 0xff, 0x12, 0x12, 0x12, 0xff, 0x16, 0x16, 0x16, 0xff, 0x14, 0x14, 0x14, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x35, 0x35, 0x35, 0xff, 0x39, 0x39, 0x39, 0xff, 0x28, 0x28, 0x28, 0xff, 0x29, 0x29, 0x29, 0xff, 0x23, 0x23, 0x23, 0xff, 0x34, 0x34, 0x34, 0xff, 0x37, 0x37, 0x37, 0xff, 0x04, 0x04, 0x04, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x56, 0x56, 0x56, 0xff, 0x59, 0x59, 0x59, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x67, 0x67, 0x67, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x74, 0x74, 0x74, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x87, 0x87, 0x87, 0xff, 0x79, 0x79, 0x79, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x79, 0x79, 0x79, 0xff, 0x73, 0x73, 0x73, 0xff, 0x68, 0x68, 0x68, 0xff, 0x69, 0x69, 0x69, 0xff, 0x63, 0x63, 0x63, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x57, 0x57, 0x57, 0xfe, 0x4b, 0x4b, 0x4b, 0x8e, 0x48, 0x48, 0x48, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x29, 0x1c, 0x1c, 0x1c, 0xd1, 0x24, 0x24, 0x24, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x30, 0x30, 0x30, 0xff, 0x33, 0x33, 0x33, 0xff, 0x36, 0x36, 0x36, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x40, 0x40, 0x40, 0xff, 0x42, 0x42, 0x42, 0xff, 0x46, 0x46, 0x46, 0xff, 0x49, 0x49, 0x49, 0xff, 0x43, 0x43, 0x43, 0xff, 0x22, 0x22, 0x22, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x05, 0x05, 0x05, 0xff, 0x02, 0x02, 0x02, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x16, 0x16, 0x16, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x15, 0x15, 0x15, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x06, 0x06, 0x06, 0xff, 0x00, 0x00, 0x00, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x12, 0x12, 0x12, 0xff, 0x14, 0x14, 0x14, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x28, 0x28, 0x28, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x32, 0x32, 0x32, 0xff, 0x23, 0x23, 0x23, 0xff, 0x26, 0x26, 0x26, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x37, 0x37, 0x37, 0xff, 0x12, 0x12, 0x12, 0xff, 0x18, 0x18, 0x18, 0xff, 0x46, 0x46, 0x46, 0xff, 0x52, 0x52, 0x52, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x62, 0x62, 0x62, 0xff, 0x66, 0x66, 0x66, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x74, 0x74, 0x74, 0xff, 0x78, 0x78, 0x78, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x81, 0x81, 0x81, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x94, 0x94, 0x94, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x94, 0x94, 0x94, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x92, 0x92, 0x92, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x84, 0x84, 0x84, 0xff, 0x75, 0x75, 0x75, 0xff, 0x82, 0x82, 0x82, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x71, 0x71, 0x71, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x55, 0x55, 0x55, 0xd1, 0x4a, 0x4a, 0x4a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x56, 0x16, 0x16, 0x16, 0xf3, 0x1b, 0x1b, 0x1b, 0xff, 0x23, 0x23, 0x23, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x30, 0x30, 0x30, 0xff, 0x33, 0x33, 0x33, 0xff, 0x36, 0x36, 0x36, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x41, 0x41, 0x41, 0xff, 0x45, 0x45, 0x45, 0xff, 0x48, 0x48, 0x48, 0xff, 0x35, 0x35, 0x35, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x08, 0x08, 0x08, 0xff, 0x07, 0x07, 0x07, 0xff, 0x02, 0x02, 0x02, 0xff, 0x05, 0x05, 0x05, 0xff, 0x09, 0x09, 0x09, 0xff, 0x13, 0x13, 0x13, 0xff, 0x22, 0x22, 0x22, 0xff, 0x14, 0x14, 0x14, 0xff, 0x10, 0x10, 0x10, 0xff, 0x21, 0x21, 0x21, 0xff, 0x11, 0x11, 0x11, 0xff, 0x15, 0x15, 0x15, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x10, 0x10, 0x10, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x12, 0x12, 0x12, 0xff, 0x02, 0x02, 0x02, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x29, 0x29, 0x29, 0xff, 0x33, 0x33, 0x33, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x29, 0x29, 0x29, 0xff, 0x23, 0x23, 0x23, 0xff, 0x29, 0x29, 0x29, 0xff, 0x39, 0x39, 0x39, 0xff, 0x25, 0x25, 0x25, 0xff, 0x24, 0x24, 0x24, 0xff, 0x47, 0x47, 0x47, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x68, 0x68, 0x68, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x82, 0x82, 0x82, 0xff, 0x88, 0x88, 0x88, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x91, 0x91, 0x91, 0xff, 0x97, 0x97, 0x97, 0xff, 0x95, 0x95, 0x95, 0xff, 0x98, 0x98, 0x98, 0xff, 0x9a, 0x9a, 0x9a, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9d, 0x9d, 0x9d, 0xff, 0x98, 0x98, 0x98, 0xff, 0x98, 0x98, 0x98, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x82, 0x82, 0x82, 0xff, 0x91, 0x91, 0x91, 0xff, 0x91, 0x91, 0x91, 0xff, 0x86, 0x86, 0x86, 0xff, 0x86, 0x86, 0x86, 0xff, 0x79, 0x79, 0x79, 0xff, 0x6b, 0x6b, 0x6b, 0xf3, 0x58, 0x58, 0x58, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x0c, 0x0c, 0x8a, 0x12, 0x12, 0x12, 0xfe, 0x16, 0x16, 0x16, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x23, 0x23, 0x23, 0xff, 0x29, 0x29, 0x29, 0xff, 0x30, 0x30, 0x30, 0xff, 0x33, 0x33, 0x33, 0xff, 0x36, 0x36, 0x36, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x41, 0x41, 0x41, 0xff, 0x44, 0x44, 0x44, 0xff, 0x40, 0x40, 0x40, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x03, 0x03, 0x03, 0xff, 0x00, 0x00, 0x00, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x24, 0x24, 0x24, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x15, 0x15, 0x15, 0xff, 0x18, 0x18, 0x18, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x04, 0x04, 0x04, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x14, 0x14, 0x14, 0xff, 0x28, 0x28, 0x28, 0xff, 0x33, 0x33, 0x33, 0xff, 0x35, 0x35, 0x35, 0xff, 0x39, 0x39, 0x39, 0xff, 0x24, 0x24, 0x24, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x40, 0x40, 0x40, 0xff, 0x35, 0x35, 0x35, 0xff, 0x42, 0x42, 0x42, 0xff, 0x45, 0x45, 0x45, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x53, 0x53, 0x53, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x83, 0x83, 0x83, 0xff, 0x89, 0x89, 0x89, 0xff, 0x89, 0x89, 0x89, 0xff, 0x88, 0x88, 0x88, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x93, 0x93, 0x93, 0xff, 0x99, 0x99, 0x99, 0xff, 0x9c, 0x9c, 0x9c, 0xff, 0x99, 0x99, 0x99, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0xa6, 0xa6, 0xa6, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa2, 0xa2, 0xa2, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9f, 0x9f, 0x9f, 0xff, 0x9d, 0x9d, 0x9d, 0xff, 0x9a, 0x9a, 0x9a, 0xff, 0x98, 0x98, 0x98, 0xff, 0x89, 0x89, 0x89, 0xff, 0x7a, 0x7a, 0x7a, 0xfe, 0x5d, 0x5d, 0x5d, 0x8b, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x08, 0x08, 0x08, 0xae, 0x0d, 0x0d, 0x0d, 0xff, 0x12, 0x12, 0x12, 0xff, 0x15, 0x15, 0x15, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x21, 0x21, 0x21, 0xff, 0x29, 0x29, 0x29, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x33, 0x33, 0x33, 0xff, 0x37, 0x37, 0x37, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x42, 0x42, 0x42, 0xff, 0x40, 0x40, 0x40, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x05, 0x05, 0x05, 0xff, 0x09, 0x09, 0x09, 0xff, 0x06, 0x06, 0x06, 0xff, 0x01, 0x01, 0x01, 0xff, 0x04, 0x04, 0x04, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x24, 0x24, 0x24, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x08, 0x08, 0x08, 0xff, 0x24, 0x24, 0x24, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x20, 0x20, 0x20, 0xff, 0x13, 0x13, 0x13, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x17, 0x17, 0x17, 0xff, 0x07, 0x07, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x13, 0x13, 0x13, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x29, 0x29, 0x29, 0xff, 0x31, 0x31, 0x31, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x24, 0x24, 0x24, 0xff, 0x28, 0x28, 0x28, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x43, 0x43, 0x43, 0xff, 0x49, 0x49, 0x49, 0xff, 0x60, 0x60, 0x60, 0xff, 0x71, 0x71, 0x71, 0xff, 0x58, 0x58, 0x58, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x84, 0x84, 0x84, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x91, 0x91, 0x91, 0xff, 0x91, 0x91, 0x91, 0xff, 0x90, 0x90, 0x90, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x93, 0x93, 0x93, 0xff, 0x94, 0x94, 0x94, 0xff, 0x95, 0x95, 0x95, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0x9f, 0x9f, 0x9f, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xad, 0xad, 0xad, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xae, 0xae, 0xae, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x91, 0x91, 0x91, 0xff, 0x82, 0x82, 0x82, 0xff, 0x6b, 0x6b, 0x6b, 0xaf, 0x45, 0x45, 0x45, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x05, 0x05, 0x05, 0xc9, 0x09, 0x09, 0x09, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x11, 0x11, 0x11, 0xff, 0x14, 0x14, 0x14, 0xff, 0x19, 0x19, 0x19, 0xff, 0x20, 0x20, 0x20, 0xff, 0x28, 0x28, 0x28, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x32, 0x32, 0x32, 0xff, 0x36, 0x36, 0x36, 0xff, 0x39, 0x39, 0x39, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x41, 0x41, 0x41, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x20, 0x20, 0x20, 0xff, 0x07, 0x07, 0x07, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x04, 0x04, 0x04, 0xff, 0x01, 0x01, 0x01, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x19, 0x19, 0x19, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x13, 0x13, 0x13, 0xff, 0x24, 0x24, 0x24, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x25, 0x25, 0x25, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x09, 0x09, 0x09, 0xff, 0x16, 0x16, 0x16, 0xff, 0x13, 0x13, 0x13, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x07, 0x07, 0x07, 0xff, 0x10, 0x10, 0x10, 0xff, 0x15, 0x15, 0x15, 0xff, 0x14, 0x14, 0x14, 0xff, 0x26, 0x26, 0x26, 0xff, 0x25, 0x25, 0x25, 0xff, 0x21, 0x21, 0x21, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x26, 0x26, 0x26, 0xff, 0x24, 0x24, 0x24, 0xff, 0x33, 0x33, 0x33, 0xff, 0x49, 0x49, 0x49, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x43, 0x43, 0x43, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x50, 0x50, 0x50, 0xff, 0x62, 0x62, 0x62, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x85, 0x85, 0x85, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x96, 0x96, 0x96, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0x97, 0x97, 0x97, 0xff, 0x93, 0x93, 0x93, 0xff, 0x95, 0x95, 0x95, 0xff, 0x95, 0x95, 0x95, 0xff, 0x98, 0x98, 0x98, 0xff, 0x9f, 0x9f, 0x9f, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xac, 0xac, 0xac, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xab, 0xab, 0xab, 0xff, 0xab, 0xab, 0xab, 0xff, 0xac, 0xac, 0xac, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0x95, 0x95, 0x95, 0xff, 0x86, 0x86, 0x86, 0xff, 0x70, 0x70, 0x70, 0xc9, 0x51, 0x51, 0x51, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x1a, 0x03, 0x03, 0x03, 0xd6, 0x05, 0x05, 0x05, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x13, 0x13, 0x13, 0xff, 0x18, 0x18, 0x18, 0xff, 0x20, 0x20, 0x20, 0xff, 0x27, 0x27, 0x27, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x30, 0x30, 0x30, 0xff, 0x34, 0x34, 0x34, 0xff, 0x38, 0x38, 0x38, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x39, 0x39, 0x39, 0xff, 0x31, 0x31, 0x31, 0xff, 0x11, 0x11, 0x11, 0xff, 0x09, 0x09, 0x09, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x07, 0x07, 0x07, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x24, 0x24, 0x24, 0xff, 0x27, 0x27, 0x27, 0xff, 0x04, 0x04, 0x04, 0xff, 0x20, 0x20, 0x20, 0xff, 0x27, 0x27, 0x27, 0xff, 0x22, 0x22, 0x22, 0xff, 0x21, 0x21, 0x21, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x08, 0x08, 0x08, 0xff, 0x12, 0x12, 0x12, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x14, 0x14, 0x14, 0xff, 0x13, 0x13, 0x13, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x32, 0x32, 0x32, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x30, 0x30, 0x30, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x45, 0x45, 0x45, 0xff, 0x43, 0x43, 0x43, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x62, 0x62, 0x62, 0xff, 0x40, 0x40, 0x40, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x87, 0x87, 0x87, 0xff, 0x90, 0x90, 0x90, 0xff, 0x96, 0x96, 0x96, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0x9a, 0x9a, 0x9a, 0xff, 0x99, 0x99, 0x99, 0xff, 0x97, 0x97, 0x97, 0xff, 0x97, 0x97, 0x97, 0xff, 0x9c, 0x9c, 0x9c, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0x92, 0x92, 0x92, 0xff, 0x90, 0x90, 0x90, 0xff, 0x62, 0x62, 0x62, 0xd6, 0x4e, 0x4e, 0x4e, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x20, 0x04, 0x04, 0x04, 0xde, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x14, 0x14, 0x14, 0xff, 0x18, 0x18, 0x18, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x26, 0x26, 0x26, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x31, 0x31, 0x31, 0xff, 0x34, 0x34, 0x34, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x39, 0x39, 0x39, 0xff, 0x39, 0x39, 0x39, 0xff, 0x21, 0x21, 0x21, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x03, 0x03, 0x03, 0xff, 0x00, 0x00, 0x00, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x12, 0x12, 0x12, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x06, 0x06, 0x06, 0xff, 0x25, 0x25, 0x25, 0xff, 0x26, 0x26, 0x26, 0xff, 0x24, 0x24, 0x24, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x11, 0x11, 0x11, 0xff, 0x06, 0x06, 0x06, 0xff, 0x02, 0x02, 0x02, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x13, 0x13, 0x13, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x30, 0x30, 0x30, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x20, 0x20, 0x20, 0xff, 0x24, 0x24, 0x24, 0xff, 0x48, 0x48, 0x48, 0xff, 0x51, 0x51, 0x51, 0xff, 0x40, 0x40, 0x40, 0xff, 0x51, 0x51, 0x51, 0xff, 0x62, 0x62, 0x62, 0xff, 0x46, 0x46, 0x46, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x76, 0x76, 0x76, 0xff, 0x77, 0x77, 0x77, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x95, 0x95, 0x95, 0xff, 0x99, 0x99, 0x99, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0x9c, 0x9c, 0x9c, 0xff, 0x9c, 0x9c, 0x9c, 0xff, 0x9c, 0x9c, 0x9c, 0xff, 0x9d, 0x9d, 0x9d, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xba, 0xba, 0xba, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xae, 0xae, 0xae, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xae, 0xae, 0xae, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0x95, 0x95, 0x95, 0xff, 0x80, 0x80, 0x80, 0xff, 0x51, 0x51, 0x51, 0xde, 0x5f, 0x5f, 0x5f, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x1c, 0x06, 0x06, 0x06, 0xdb, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x13, 0x13, 0x13, 0xff, 0x18, 0x18, 0x18, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x26, 0x26, 0x26, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x32, 0x32, 0x32, 0xff, 0x34, 0x34, 0x34, 0xff, 0x38, 0x38, 0x38, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x38, 0x38, 0x38, 0xff, 0x31, 0x31, 0x31, 0xff, 0x14, 0x14, 0x14, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x09, 0x09, 0x09, 0xff, 0x07, 0x07, 0x07, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x32, 0x32, 0x32, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x23, 0x23, 0x23, 0xff, 0x26, 0x26, 0x26, 0xff, 0x28, 0x28, 0x28, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x14, 0x14, 0x14, 0xff, 0x16, 0x16, 0x16, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x26, 0x26, 0x26, 0xff, 0x21, 0x21, 0x21, 0xff, 0x37, 0x37, 0x37, 0xff, 0x24, 0x24, 0x24, 0xff, 0x41, 0x41, 0x41, 0xff, 0x48, 0x48, 0x48, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x56, 0x56, 0x56, 0xff, 0x47, 0x47, 0x47, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x71, 0x71, 0x71, 0xff, 0x72, 0x72, 0x72, 0xff, 0x78, 0x78, 0x78, 0xff, 0x86, 0x86, 0x86, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x92, 0x92, 0x92, 0xff, 0x9a, 0x9a, 0x9a, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0xa2, 0xa2, 0xa2, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xae, 0xae, 0xae, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0x90, 0x90, 0x90, 0xff, 0x75, 0x75, 0x75, 0xff, 0x62, 0x62, 0x62, 0xdc, 0x51, 0x51, 0x51, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x15, 0x08, 0x08, 0x08, 0xd6, 0x07, 0x07, 0x07, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x13, 0x13, 0x13, 0xff, 0x17, 0x17, 0x17, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x26, 0x26, 0x26, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x32, 0x32, 0x32, 0xff, 0x35, 0x35, 0x35, 0xff, 0x36, 0x36, 0x36, 0xff, 0x38, 0x38, 0x38, 0xff, 0x37, 0x37, 0x37, 0xff, 0x22, 0x22, 0x22, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x03, 0x03, 0x03, 0xff, 0x01, 0x01, 0x01, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x09, 0x09, 0x09, 0xff, 0x27, 0x27, 0x27, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x07, 0x07, 0x07, 0xff, 0x14, 0x14, 0x14, 0xff, 0x21, 0x21, 0x21, 0xff, 0x29, 0x29, 0x29, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x16, 0x16, 0x16, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x04, 0x04, 0x04, 0xff, 0x07, 0x07, 0x07, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x14, 0x14, 0x14, 0xff, 0x15, 0x15, 0x15, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x31, 0x31, 0x31, 0xff, 0x35, 0x35, 0x35, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x46, 0x46, 0x46, 0xff, 0x47, 0x47, 0x47, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x43, 0x43, 0x43, 0xff, 0x59, 0x59, 0x59, 0xff, 0x68, 0x68, 0x68, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x73, 0x73, 0x73, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x88, 0x88, 0x88, 0xff, 0x89, 0x89, 0x89, 0xff, 0x93, 0x93, 0x93, 0xff, 0x9d, 0x9d, 0x9d, 0xff, 0xa2, 0xa2, 0xa2, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0xac, 0xac, 0xac, 0xff, 0xae, 0xae, 0xae, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xa6, 0xa6, 0xa6, 0xff, 0x97, 0x97, 0x97, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x65, 0x65, 0x65, 0xff, 0x5c, 0x5c, 0x5c, 0xd7, 0x3c, 0x3c, 0x3c, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x06, 0x06, 0x06, 0xc8, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x11, 0x11, 0x11, 0xff, 0x16, 0x16, 0x16, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x26, 0x26, 0x26, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x32, 0x32, 0x32, 0xff, 0x33, 0x33, 0x33, 0xff, 0x36, 0x36, 0x36, 0xff, 0x37, 0x37, 0x37, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x15, 0x15, 0x15, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x09, 0x09, 0x09, 0xff, 0x09, 0x09, 0x09, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x11, 0x11, 0x11, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x21, 0x21, 0x21, 0xff, 0x05, 0x05, 0x05, 0xff, 0x19, 0x19, 0x19, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x24, 0x24, 0x24, 0xff, 0x13, 0x13, 0x13, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x03, 0x03, 0x03, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x11, 0x11, 0x11, 0xff, 0x17, 0x17, 0x17, 0xff, 0x14, 0x14, 0x14, 0xff, 0x28, 0x28, 0x28, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x31, 0x31, 0x31, 0xff, 0x36, 0x36, 0x36, 0xff, 0x34, 0x34, 0x34, 0xff, 0x54, 0x54, 0x54, 0xff, 0x58, 0x58, 0x58, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x41, 0x41, 0x41, 0xff, 0x53, 0x53, 0x53, 0xff, 0x64, 0x64, 0x64, 0xff, 0x67, 0x67, 0x67, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x76, 0x76, 0x76, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x86, 0x86, 0x86, 0xff, 0x89, 0x89, 0x89, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x97, 0x97, 0x97, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xab, 0xab, 0xab, 0xff, 0xac, 0xac, 0xac, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xad, 0xad, 0xad, 0xff, 0x9c, 0x9c, 0x9c, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x71, 0x71, 0x71, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x46, 0x46, 0x46, 0xc8, 0x19, 0x19, 0x19, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x07, 0x07, 0xb1, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x11, 0x11, 0x11, 0xff, 0x16, 0x16, 0x16, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x25, 0x25, 0x25, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x30, 0x30, 0x30, 0xff, 0x34, 0x34, 0x34, 0xff, 0x34, 0x34, 0x34, 0xff, 0x34, 0x34, 0x34, 0xff, 0x23, 0x23, 0x23, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x08, 0x08, 0x08, 0xff, 0x06, 0x06, 0x06, 0xff, 0x00, 0x00, 0x00, 0xff, 0x04, 0x04, 0x04, 0xff, 0x09, 0x09, 0x09, 0xff, 0x05, 0x05, 0x05, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x30, 0x30, 0x30, 0xff, 0x19, 0x19, 0x19, 0xff, 0x09, 0x09, 0x09, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x32, 0x32, 0x32, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x20, 0x20, 0x20, 0xff, 0x11, 0x11, 0x11, 0xff, 0x02, 0x02, 0x02, 0xff, 0x06, 0x06, 0x06, 0xff, 0x03, 0x03, 0x03, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x17, 0x17, 0x17, 0xff, 0x15, 0x15, 0x15, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x33, 0x33, 0x33, 0xff, 0x23, 0x23, 0x23, 0xff, 0x21, 0x21, 0x21, 0xff, 0x33, 0x33, 0x33, 0xff, 0x36, 0x36, 0x36, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x66, 0x66, 0x66, 0xff, 0x58, 0x58, 0x58, 0xff, 0x41, 0x41, 0x41, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x63, 0x63, 0x63, 0xff, 0x65, 0x65, 0x65, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x77, 0x77, 0x77, 0xff, 0x84, 0x84, 0x84, 0xff, 0x88, 0x88, 0x88, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x93, 0x93, 0x93, 0xff, 0x9d, 0x9d, 0x9d, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xac, 0xac, 0xac, 0xff, 0xac, 0xac, 0xac, 0xff, 0xad, 0xad, 0xad, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0x9d, 0x9d, 0x9d, 0xff, 0x83, 0x83, 0x83, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x64, 0x64, 0x64, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x19, 0x19, 0x19, 0xb1, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x8d, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x11, 0x11, 0x11, 0xff, 0x15, 0x15, 0x15, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x24, 0x24, 0x24, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x32, 0x32, 0x32, 0xff, 0x33, 0x33, 0x33, 0xff, 0x29, 0x29, 0x29, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x08, 0x08, 0x08, 0xff, 0x03, 0x03, 0x03, 0xff, 0x00, 0x00, 0x00, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x06, 0x06, 0x06, 0xff, 0x26, 0x26, 0x26, 0xff, 0x26, 0x26, 0x26, 0xff, 0x13, 0x13, 0x13, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x32, 0x32, 0x32, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x21, 0x21, 0x21, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x01, 0x01, 0x01, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x13, 0x13, 0x13, 0xff, 0x16, 0x16, 0x16, 0xff, 0x10, 0x10, 0x10, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x32, 0x32, 0x32, 0xff, 0x20, 0x20, 0x20, 0xff, 0x24, 0x24, 0x24, 0xff, 0x37, 0x37, 0x37, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x67, 0x67, 0x67, 0xff, 0x46, 0x46, 0x46, 0xff, 0x52, 0x52, 0x52, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x61, 0x61, 0x61, 0xff, 0x65, 0x65, 0x65, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x78, 0x78, 0x78, 0xff, 0x84, 0x84, 0x84, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x92, 0x92, 0x92, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0xab, 0xab, 0xab, 0xff, 0xad, 0xad, 0xad, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0x9f, 0x9f, 0x9f, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x77, 0x77, 0x77, 0xff, 0x56, 0x56, 0x56, 0xff, 0x43, 0x43, 0x43, 0xff, 0x22, 0x22, 0x22, 0xff, 0x1c, 0x1c, 0x1c, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x55, 0x07, 0x07, 0x07, 0xfe, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x10, 0x10, 0x10, 0xff, 0x14, 0x14, 0x14, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x24, 0x24, 0x24, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x05, 0x05, 0x05, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x07, 0x07, 0x07, 0xff, 0x05, 0x05, 0x05, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x32, 0x32, 0x32, 0xff, 0x21, 0x21, 0x21, 0xff, 0x11, 0x11, 0x11, 0xff, 0x16, 0x16, 0x16, 0xff, 0x26, 0x26, 0x26, 0xff, 0x31, 0x31, 0x31, 0xff, 0x28, 0x28, 0x28, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x06, 0x06, 0x06, 0xff, 0x02, 0x02, 0x02, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x11, 0x11, 0x11, 0xff, 0x11, 0x11, 0x11, 0xff, 0x10, 0x10, 0x10, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x31, 0x31, 0x31, 0xff, 0x22, 0x22, 0x22, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x27, 0x27, 0x27, 0xff, 0x36, 0x36, 0x36, 0xff, 0x41, 0x41, 0x41, 0xff, 0x69, 0x69, 0x69, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x65, 0x65, 0x65, 0xff, 0x70, 0x70, 0x70, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x89, 0x89, 0x89, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x95, 0x95, 0x95, 0xff, 0x9f, 0x9f, 0x9f, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0xae, 0xae, 0xae, 0xff, 0xac, 0xac, 0xac, 0xff, 0xae, 0xae, 0xae, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xce, 0xce, 0xce, 0xff, 0xca, 0xca, 0xca, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0x97, 0x97, 0x97, 0xff, 0x78, 0x78, 0x78, 0xff, 0x46, 0x46, 0x46, 0xff, 0x40, 0x40, 0x40, 0xff, 0x31, 0x31, 0x31, 0xff, 0x18, 0x18, 0x18, 0xfe, 0x18, 0x18, 0x18, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x29, 0x07, 0x07, 0x07, 0xf3, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x14, 0x14, 0x14, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x24, 0x24, 0x24, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x27, 0x27, 0x27, 0xff, 0x13, 0x13, 0x13, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x09, 0x09, 0x09, 0xff, 0x05, 0x05, 0x05, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x07, 0x07, 0x07, 0xff, 0x16, 0x16, 0x16, 0xff, 0x33, 0x33, 0x33, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x19, 0x19, 0x19, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x34, 0x34, 0x34, 0xff, 0x23, 0x23, 0x23, 0xff, 0x18, 0x18, 0x18, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x05, 0x05, 0x05, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x17, 0x17, 0x17, 0xff, 0x17, 0x17, 0x17, 0xff, 0x19, 0x19, 0x19, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x32, 0x32, 0x32, 0xff, 0x16, 0x16, 0x16, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x60, 0x60, 0x60, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x60, 0x60, 0x60, 0xff, 0x65, 0x65, 0x65, 0xff, 0x67, 0x67, 0x67, 0xff, 0x63, 0x63, 0x63, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x65, 0x65, 0x65, 0xff, 0x71, 0x71, 0x71, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x82, 0x82, 0x82, 0xff, 0x88, 0x88, 0x88, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x93, 0x93, 0x93, 0xff, 0x98, 0x98, 0x98, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0xa2, 0xa2, 0xa2, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0xab, 0xab, 0xab, 0xff, 0xab, 0xab, 0xab, 0xff, 0xad, 0xad, 0xad, 0xff, 0xae, 0xae, 0xae, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xba, 0xba, 0xba, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xca, 0xca, 0xca, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x79, 0x79, 0x79, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x27, 0x27, 0x27, 0xff, 0x27, 0x27, 0x27, 0xff, 0x22, 0x22, 0x22, 0xf4, 0x12, 0x12, 0x12, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x06, 0x06, 0x06, 0xd1, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x13, 0x13, 0x13, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x24, 0x24, 0x24, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x29, 0x29, 0x29, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x09, 0x09, 0x09, 0xff, 0x08, 0x08, 0x08, 0xff, 0x05, 0x05, 0x05, 0xff, 0x01, 0x01, 0x01, 0xff, 0x04, 0x04, 0x04, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x02, 0x02, 0x02, 0xff, 0x21, 0x21, 0x21, 0xff, 0x32, 0x32, 0x32, 0xff, 0x15, 0x15, 0x15, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x37, 0x37, 0x37, 0xff, 0x24, 0x24, 0x24, 0xff, 0x16, 0x16, 0x16, 0xff, 0x01, 0x01, 0x01, 0xff, 0x04, 0x04, 0x04, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x15, 0x15, 0x15, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x14, 0x14, 0x14, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x39, 0x39, 0x39, 0xff, 0x41, 0x41, 0x41, 0xff, 0x64, 0x64, 0x64, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x67, 0x67, 0x67, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x69, 0x69, 0x69, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x62, 0x62, 0x62, 0xff, 0x62, 0x62, 0x62, 0xff, 0x71, 0x71, 0x71, 0xff, 0x81, 0x81, 0x81, 0xff, 0x83, 0x83, 0x83, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x93, 0x93, 0x93, 0xff, 0x95, 0x95, 0x95, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0x9f, 0x9f, 0x9f, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xac, 0xac, 0xac, 0xff, 0xad, 0xad, 0xad, 0xff, 0xae, 0xae, 0xae, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0x77, 0x77, 0x77, 0xff, 0x32, 0x32, 0x32, 0xff, 0x21, 0x21, 0x21, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x28, 0x28, 0x28, 0xff, 0x24, 0x24, 0x24, 0xd1, 0x24, 0x24, 0x24, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x8e, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x13, 0x13, 0x13, 0xff, 0x19, 0x19, 0x19, 0xff, 0x24, 0x24, 0x24, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x27, 0x27, 0x27, 0xff, 0x25, 0x25, 0x25, 0xff, 0x16, 0x16, 0x16, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x07, 0x07, 0x07, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x02, 0x02, 0x02, 0xff, 0x27, 0x27, 0x27, 0xff, 0x30, 0x30, 0x30, 0xff, 0x11, 0x11, 0x11, 0xff, 0x16, 0x16, 0x16, 0xff, 0x23, 0x23, 0x23, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x39, 0x39, 0x39, 0xff, 0x20, 0x20, 0x20, 0xff, 0x12, 0x12, 0x12, 0xff, 0x01, 0x01, 0x01, 0xff, 0x08, 0x08, 0x08, 0xff, 0x10, 0x10, 0x10, 0xff, 0x15, 0x15, 0x15, 0xff, 0x19, 0x19, 0x19, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x20, 0x20, 0x20, 0xff, 0x15, 0x15, 0x15, 0xff, 0x25, 0x25, 0x25, 0xff, 0x30, 0x30, 0x30, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x65, 0x65, 0x65, 0xff, 0x77, 0x77, 0x77, 0xff, 0x61, 0x61, 0x61, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x67, 0x67, 0x67, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x65, 0x65, 0x65, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x80, 0x80, 0x80, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x91, 0x91, 0x91, 0xff, 0x96, 0x96, 0x96, 0xff, 0x97, 0x97, 0x97, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0xa6, 0xa6, 0xa6, 0xff, 0xab, 0xab, 0xab, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xae, 0xae, 0xae, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xa6, 0xa6, 0xa6, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x24, 0x24, 0x24, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x14, 0x14, 0x14, 0xff, 0x15, 0x15, 0x15, 0xff, 0x29, 0x29, 0x29, 0xff, 0x1e, 0x1e, 0x1e, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x40, 0x05, 0x05, 0x05, 0xfe, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x11, 0x11, 0x11, 0xff, 0x19, 0x19, 0x19, 0xff, 0x24, 0x24, 0x24, 0xff, 0x25, 0x25, 0x25, 0xff, 0x27, 0x27, 0x27, 0xff, 0x21, 0x21, 0x21, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x09, 0x09, 0x09, 0xff, 0x06, 0x06, 0x06, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x09, 0x09, 0x09, 0xff, 0x07, 0x07, 0x07, 0xff, 0x04, 0x04, 0x04, 0xff, 0x29, 0x29, 0x29, 0xff, 0x28, 0x28, 0x28, 0xff, 0x14, 0x14, 0x14, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x24, 0x24, 0x24, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x32, 0x32, 0x32, 0xff, 0x20, 0x20, 0x20, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x07, 0x07, 0x07, 0xff, 0x16, 0x16, 0x16, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x10, 0x10, 0x10, 0xff, 0x10, 0x10, 0x10, 0xff, 0x24, 0x24, 0x24, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x13, 0x13, 0x13, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x33, 0x33, 0x33, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x57, 0x57, 0x57, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x53, 0x53, 0x53, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x66, 0x66, 0x66, 0xff, 0x68, 0x68, 0x68, 0xff, 0x69, 0x69, 0x69, 0xff, 0x71, 0x71, 0x71, 0xff, 0x83, 0x83, 0x83, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x95, 0x95, 0x95, 0xff, 0x9a, 0x9a, 0x9a, 0xff, 0x9c, 0x9c, 0x9c, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0xa6, 0xa6, 0xa6, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0xac, 0xac, 0xac, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0x62, 0x62, 0x62, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x30, 0x30, 0x30, 0xff, 0x17, 0x17, 0x17, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x24, 0x24, 0x24, 0xff, 0x24, 0x24, 0x24, 0xfe, 0x1b, 0x1b, 0x1b, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x03, 0x03, 0x03, 0xdb, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x10, 0x10, 0x10, 0xff, 0x19, 0x19, 0x19, 0xff, 0x21, 0x21, 0x21, 0xff, 0x22, 0x22, 0x22, 0xff, 0x25, 0x25, 0x25, 0xff, 0x18, 0x18, 0x18, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x07, 0x07, 0x07, 0xff, 0x05, 0x05, 0x05, 0xff, 0x02, 0x02, 0x02, 0xff, 0x04, 0x04, 0x04, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x02, 0x02, 0x02, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x23, 0x23, 0x23, 0xff, 0x13, 0x13, 0x13, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x27, 0x27, 0x27, 0xff, 0x21, 0x21, 0x21, 0xff, 0x17, 0x17, 0x17, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x16, 0x16, 0x16, 0xff, 0x32, 0x32, 0x32, 0xff, 0x29, 0x29, 0x29, 0xff, 0x10, 0x10, 0x10, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x43, 0x43, 0x43, 0xff, 0x66, 0x66, 0x66, 0xff, 0x73, 0x73, 0x73, 0xff, 0x20, 0x20, 0x20, 0xff, 0x19, 0x19, 0x19, 0xff, 0x24, 0x24, 0x24, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x41, 0x41, 0x41, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x62, 0x62, 0x62, 0xff, 0x67, 0x67, 0x67, 0xff, 0x75, 0x75, 0x75, 0xff, 0x83, 0x83, 0x83, 0xff, 0x89, 0x89, 0x89, 0xff, 0x99, 0x99, 0x99, 0xff, 0xa2, 0xa2, 0xa2, 0xff, 0x9d, 0x9d, 0x9d, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xad, 0xad, 0xad, 0xff, 0xad, 0xad, 0xad, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x14, 0x14, 0x14, 0xff, 0x15, 0x15, 0x15, 0xff, 0x33, 0x33, 0x33, 0xff, 0x21, 0x21, 0x21, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x1f, 0x1f, 0x1f, 0xdb, 0x55, 0x55, 0x55, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x88, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x11, 0x11, 0x11, 0xff, 0x19, 0x19, 0x19, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x22, 0x22, 0x22, 0xff, 0x22, 0x22, 0x22, 0xff, 0x10, 0x10, 0x10, 0xff, 0x09, 0x09, 0x09, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x09, 0x09, 0x09, 0xff, 0x09, 0x09, 0x09, 0xff, 0x06, 0x06, 0x06, 0xff, 0x01, 0x01, 0x01, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x16, 0x16, 0x16, 0xff, 0x30, 0x30, 0x30, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x25, 0x25, 0x25, 0xff, 0x32, 0x32, 0x32, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x22, 0x22, 0x22, 0xff, 0x25, 0x25, 0x25, 0xff, 0x15, 0x15, 0x15, 0xff, 0x01, 0x01, 0x01, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x22, 0x22, 0x22, 0xff, 0x38, 0x38, 0x38, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x54, 0x54, 0x54, 0xff, 0x79, 0x79, 0x79, 0xff, 0x55, 0x55, 0x55, 0xff, 0x10, 0x10, 0x10, 0xff, 0x24, 0x24, 0x24, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x28, 0x28, 0x28, 0xff, 0x32, 0x32, 0x32, 0xff, 0x46, 0x46, 0x46, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x72, 0x72, 0x72, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x89, 0x89, 0x89, 0xff, 0x98, 0x98, 0x98, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa2, 0xa2, 0xa2, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0xae, 0xae, 0xae, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0x54, 0x54, 0x54, 0xff, 0x16, 0x16, 0x16, 0xff, 0x17, 0x17, 0x17, 0xff, 0x30, 0x30, 0x30, 0xff, 0x25, 0x25, 0x25, 0xff, 0x11, 0x11, 0x11, 0xff, 0x13, 0x13, 0x13, 0xff, 0x28, 0x28, 0x28, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x4e, 0x4e, 0x4e, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x02, 0x02, 0x02, 0xfa, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x11, 0x11, 0x11, 0xff, 0x19, 0x19, 0x19, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x23, 0x23, 0x23, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x09, 0x09, 0x09, 0xff, 0x05, 0x05, 0x05, 0xff, 0x01, 0x01, 0x01, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x11, 0x11, 0x11, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x37, 0x37, 0x37, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x23, 0x23, 0x23, 0xff, 0x21, 0x21, 0x21, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x05, 0x05, 0x05, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x10, 0x10, 0x10, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x15, 0x15, 0x15, 0xff, 0x35, 0x35, 0x35, 0xff, 0x66, 0x66, 0x66, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x49, 0x49, 0x49, 0xff, 0x35, 0x35, 0x35, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x20, 0x20, 0x20, 0xff, 0x23, 0x23, 0x23, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x57, 0x57, 0x57, 0xff, 0x74, 0x74, 0x74, 0xff, 0x89, 0x89, 0x89, 0xff, 0x91, 0x91, 0x91, 0xff, 0x9d, 0x9d, 0x9d, 0xff, 0xa6, 0xa6, 0xa6, 0xff, 0xa2, 0xa2, 0xa2, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xae, 0xae, 0xae, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x19, 0x19, 0x19, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x29, 0x29, 0x29, 0xff, 0x19, 0x19, 0x19, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x28, 0x28, 0x28, 0xff, 0x39, 0x39, 0x39, 0xff, 0x60, 0x60, 0x60, 0xfa, 0x5d, 0x5d, 0x5d, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0xb3, 0x02, 0x02, 0x02, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x11, 0x11, 0x11, 0xff, 0x19, 0x19, 0x19, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x21, 0x21, 0x21, 0xff, 0x14, 0x14, 0x14, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x10, 0x10, 0x10, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x09, 0x09, 0x09, 0xff, 0x05, 0x05, 0x05, 0xff, 0x02, 0x02, 0x02, 0xff, 0x08, 0x08, 0x08, 0xff, 0x09, 0x09, 0x09, 0xff, 0x01, 0x01, 0x01, 0xff, 0x22, 0x22, 0x22, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x17, 0x17, 0x17, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x31, 0x31, 0x31, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x23, 0x23, 0x23, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x10, 0x10, 0x10, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x17, 0x17, 0x17, 0xff, 0x37, 0x37, 0x37, 0xff, 0x29, 0x29, 0x29, 0xff, 0x20, 0x20, 0x20, 0xff, 0x16, 0x16, 0x16, 0xff, 0x16, 0x16, 0x16, 0xff, 0x54, 0x54, 0x54, 0xff, 0x79, 0x79, 0x79, 0xff, 0x79, 0x79, 0x79, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x62, 0x62, 0x62, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x22, 0x22, 0x22, 0xff, 0x25, 0x25, 0x25, 0xff, 0x28, 0x28, 0x28, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x36, 0x36, 0x36, 0xff, 0x53, 0x53, 0x53, 0xff, 0x77, 0x77, 0x77, 0xff, 0x92, 0x92, 0x92, 0xff, 0x98, 0x98, 0x98, 0xff, 0x9c, 0x9c, 0x9c, 0xff, 0x9f, 0x9f, 0x9f, 0xff, 0x9c, 0x9c, 0x9c, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xad, 0xad, 0xad, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0x97, 0x97, 0x97, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x21, 0x21, 0x21, 0xff, 0x21, 0x21, 0x21, 0xff, 0x28, 0x28, 0x28, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x07, 0x07, 0x07, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x49, 0x49, 0x49, 0xff, 0x69, 0x69, 0x69, 0xff, 0x56, 0x56, 0x56, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x44, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x13, 0x13, 0x13, 0xff, 0x18, 0x18, 0x18, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x10, 0x10, 0x10, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x12, 0x12, 0x12, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x09, 0x09, 0x09, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x05, 0x05, 0x05, 0xff, 0x03, 0x03, 0x03, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x08, 0x08, 0x08, 0xff, 0x03, 0x03, 0x03, 0xff, 0x29, 0x29, 0x29, 0xff, 0x29, 0x29, 0x29, 0xff, 0x16, 0x16, 0x16, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x35, 0x35, 0x35, 0xff, 0x33, 0x33, 0x33, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x12, 0x12, 0x12, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x25, 0x25, 0x25, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x27, 0x27, 0x27, 0xff, 0x66, 0x66, 0x66, 0xff, 0x85, 0x85, 0x85, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x48, 0x48, 0x48, 0xff, 0x61, 0x61, 0x61, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x62, 0x62, 0x62, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x44, 0x44, 0x44, 0xff, 0x30, 0x30, 0x30, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x58, 0x58, 0x58, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x90, 0x90, 0x90, 0xff, 0x92, 0x92, 0x92, 0xff, 0x97, 0x97, 0x97, 0xff, 0x9c, 0x9c, 0x9c, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0xa6, 0xa6, 0xa6, 0xff, 0xac, 0xac, 0xac, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xae, 0xae, 0xae, 0xff, 0xae, 0xae, 0xae, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xce, 0xce, 0xce, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0x88, 0x88, 0x88, 0xff, 0x30, 0x30, 0x30, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x26, 0x26, 0x26, 0xff, 0x19, 0x19, 0x19, 0xff, 0x27, 0x27, 0x27, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x58, 0x58, 0x58, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x47, 0x47, 0x47, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0xc8, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x12, 0x12, 0x12, 0xff, 0x17, 0x17, 0x17, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x17, 0x17, 0x17, 0xff, 0x10, 0x10, 0x10, 0xff, 0x13, 0x13, 0x13, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x09, 0x09, 0x09, 0xff, 0x07, 0x07, 0x07, 0xff, 0x08, 0x08, 0x08, 0xff, 0x07, 0x07, 0x07, 0xff, 0x05, 0x05, 0x05, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x04, 0x04, 0x04, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x20, 0x20, 0x20, 0xff, 0x13, 0x13, 0x13, 0xff, 0x28, 0x28, 0x28, 0xff, 0x37, 0x37, 0x37, 0xff, 0x34, 0x34, 0x34, 0xff, 0x25, 0x25, 0x25, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x17, 0x17, 0x17, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x12, 0x12, 0x12, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x31, 0x31, 0x31, 0xff, 0x37, 0x37, 0x37, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x15, 0x15, 0x15, 0xff, 0x10, 0x10, 0x10, 0xff, 0x46, 0x46, 0x46, 0xff, 0x70, 0x70, 0x70, 0xff, 0x79, 0x79, 0x79, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x38, 0x38, 0x38, 0xff, 0x45, 0x45, 0x45, 0xff, 0x45, 0x45, 0x45, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x56, 0x56, 0x56, 0xff, 0x58, 0x58, 0x58, 0xff, 0x50, 0x50, 0x50, 0xff, 0x42, 0x42, 0x42, 0xff, 0x36, 0x36, 0x36, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x36, 0x36, 0x36, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x68, 0x68, 0x68, 0xff, 0x77, 0x77, 0x77, 0xff, 0x80, 0x80, 0x80, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x99, 0x99, 0x99, 0xff, 0xa2, 0xa2, 0xa2, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xad, 0xad, 0xad, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xae, 0xae, 0xae, 0xff, 0xab, 0xab, 0xab, 0xff, 0xad, 0xad, 0xad, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0x76, 0x76, 0x76, 0xff, 0x24, 0x24, 0x24, 0xff, 0x24, 0x24, 0x24, 0xff, 0x22, 0x22, 0x22, 0xff, 0x17, 0x17, 0x17, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x62, 0x62, 0x62, 0xff, 0x61, 0x61, 0x61, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x4a, 0x4a, 0x4a, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x4d, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x03, 0x03, 0x03, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x10, 0x10, 0x10, 0xff, 0x11, 0x11, 0x11, 0xff, 0x17, 0x17, 0x17, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x12, 0x12, 0x12, 0xff, 0x13, 0x13, 0x13, 0xff, 0x10, 0x10, 0x10, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x09, 0x09, 0x09, 0xff, 0x08, 0x08, 0x08, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x08, 0x08, 0x08, 0xff, 0x05, 0x05, 0x05, 0xff, 0x13, 0x13, 0x13, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x15, 0x15, 0x15, 0xff, 0x30, 0x30, 0x30, 0xff, 0x34, 0x34, 0x34, 0xff, 0x35, 0x35, 0x35, 0xff, 0x28, 0x28, 0x28, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x19, 0x19, 0x19, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x13, 0x13, 0x13, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x48, 0x48, 0x48, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x17, 0x17, 0x17, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x24, 0x24, 0x24, 0xff, 0x59, 0x59, 0x59, 0xff, 0x84, 0x84, 0x84, 0xff, 0x63, 0x63, 0x63, 0xff, 0x16, 0x16, 0x16, 0xff, 0x27, 0x27, 0x27, 0xff, 0x27, 0x27, 0x27, 0xff, 0x31, 0x31, 0x31, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x45, 0x45, 0x45, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x59, 0x59, 0x59, 0xff, 0x45, 0x45, 0x45, 0xff, 0x48, 0x48, 0x48, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x46, 0x46, 0x46, 0xff, 0x55, 0x55, 0x55, 0xff, 0x59, 0x59, 0x59, 0xff, 0x66, 0x66, 0x66, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x9c, 0x9c, 0x9c, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xac, 0xac, 0xac, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0xab, 0xab, 0xab, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x21, 0x21, 0x21, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x19, 0x19, 0x19, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x15, 0x15, 0x15, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x59, 0x59, 0x59, 0xff, 0x56, 0x56, 0x56, 0xff, 0x62, 0x62, 0x62, 0xff, 0x42, 0x42, 0x42, 0xff, 0x4f, 0x4f, 0x4f, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0xcd, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x08, 0x08, 0x08, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x10, 0x10, 0x10, 0xff, 0x10, 0x10, 0x10, 0xff, 0x17, 0x17, 0x17, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x08, 0x08, 0x08, 0xff, 0x07, 0x07, 0x07, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x09, 0x09, 0x09, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x18, 0x18, 0x18, 0xff, 0x27, 0x27, 0x27, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x19, 0x19, 0x19, 0xff, 0x32, 0x32, 0x32, 0xff, 0x35, 0x35, 0x35, 0xff, 0x35, 0x35, 0x35, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x19, 0x19, 0x19, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x12, 0x12, 0x12, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x27, 0x27, 0x27, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x24, 0x24, 0x24, 0xff, 0x10, 0x10, 0x10, 0xff, 0x16, 0x16, 0x16, 0xff, 0x46, 0x46, 0x46, 0xff, 0x60, 0x60, 0x60, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x38, 0x38, 0x38, 0xff, 0x17, 0x17, 0x17, 0xff, 0x21, 0x21, 0x21, 0xff, 0x20, 0x20, 0x20, 0xff, 0x34, 0x34, 0x34, 0xff, 0x41, 0x41, 0x41, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x55, 0x55, 0x55, 0xff, 0x55, 0x55, 0x55, 0xff, 0x53, 0x53, 0x53, 0xff, 0x43, 0x43, 0x43, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x58, 0x58, 0x58, 0xff, 0x70, 0x70, 0x70, 0xff, 0x84, 0x84, 0x84, 0xff, 0x96, 0x96, 0x96, 0xff, 0x9f, 0x9f, 0x9f, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xab, 0xab, 0xab, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xad, 0xad, 0xad, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0x44, 0x44, 0x44, 0xff, 0x26, 0x26, 0x26, 0xff, 0x32, 0x32, 0x32, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x23, 0x23, 0x23, 0xff, 0x32, 0x32, 0x32, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x21, 0x21, 0x21, 0xff, 0x51, 0x51, 0x51, 0xff, 0x52, 0x52, 0x52, 0xff, 0x53, 0x53, 0x53, 0xff, 0x57, 0x57, 0x57, 0xff, 0x47, 0x47, 0x47, 0xff, 0x52, 0x52, 0x52, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x40, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x09, 0x09, 0x09, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x10, 0x10, 0x10, 0xff, 0x10, 0x10, 0x10, 0xff, 0x19, 0x19, 0x19, 0xff, 0x15, 0x15, 0x15, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x06, 0x06, 0x06, 0xff, 0x08, 0x08, 0x08, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x04, 0x04, 0x04, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x25, 0x25, 0x25, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x31, 0x31, 0x31, 0xff, 0x38, 0x38, 0x38, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x10, 0x10, 0x10, 0xff, 0x31, 0x31, 0x31, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x22, 0x22, 0x22, 0xff, 0x14, 0x14, 0x14, 0xff, 0x34, 0x34, 0x34, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x21, 0x21, 0x21, 0xff, 0x24, 0x24, 0x24, 0xff, 0x16, 0x16, 0x16, 0xff, 0x17, 0x17, 0x17, 0xff, 0x21, 0x21, 0x21, 0xff, 0x33, 0x33, 0x33, 0xff, 0x36, 0x36, 0x36, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x60, 0x60, 0x60, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x42, 0x42, 0x42, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x54, 0x54, 0x54, 0xff, 0x52, 0x52, 0x52, 0xff, 0x51, 0x51, 0x51, 0xff, 0x58, 0x58, 0x58, 0xff, 0x70, 0x70, 0x70, 0xff, 0x85, 0x85, 0x85, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9f, 0x9f, 0x9f, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0xae, 0xae, 0xae, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0x90, 0x90, 0x90, 0xff, 0x32, 0x32, 0x32, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x36, 0x36, 0x36, 0xff, 0x21, 0x21, 0x21, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x31, 0x31, 0x31, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x35, 0x35, 0x35, 0xff, 0x61, 0x61, 0x61, 0xff, 0x58, 0x58, 0x58, 0xff, 0x57, 0x57, 0x57, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x48, 0x48, 0x48, 0xff, 0x6b, 0x6b, 0x6b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0xb3, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x14, 0x14, 0x14, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x10, 0x10, 0x10, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x08, 0x08, 0x08, 0xff, 0x11, 0x11, 0x11, 0xff, 0x16, 0x16, 0x16, 0xff, 0x21, 0x21, 0x21, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x41, 0x41, 0x41, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x10, 0x10, 0x10, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x33, 0x33, 0x33, 0xff, 0x28, 0x28, 0x28, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x47, 0x47, 0x47, 0xff, 0x71, 0x71, 0x71, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x17, 0x17, 0x17, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x25, 0x25, 0x25, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x03, 0x03, 0x03, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x39, 0x39, 0x39, 0xff, 0x60, 0x60, 0x60, 0xff, 0x61, 0x61, 0x61, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x48, 0x48, 0x48, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x55, 0x55, 0x55, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x9a, 0x9a, 0x9a, 0xff, 0x98, 0x98, 0x98, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0x9c, 0x9c, 0x9c, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x99, 0x99, 0x99, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x82, 0x82, 0x82, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x89, 0x89, 0x89, 0xff, 0x88, 0x88, 0x88, 0xff, 0x85, 0x85, 0x85, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x92, 0x92, 0x92, 0xff, 0x96, 0x96, 0x96, 0xff, 0xad, 0xad, 0xad, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0x70, 0x70, 0x70, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x35, 0x35, 0x35, 0xff, 0x33, 0x33, 0x33, 0xff, 0x28, 0x28, 0x28, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x27, 0x27, 0x27, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x63, 0x63, 0x63, 0xff, 0x42, 0x42, 0x42, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x62, 0x62, 0x62, 0xff, 0x44, 0x44, 0x44, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x77, 0x77, 0x77, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x22, 0x04, 0x04, 0x04, 0xfe, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x16, 0x16, 0x16, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x11, 0x11, 0x11, 0xff, 0x10, 0x10, 0x10, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x09, 0x09, 0x09, 0xff, 0x05, 0x05, 0x05, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x15, 0x15, 0x15, 0xff, 0x14, 0x14, 0x14, 0xff, 0x20, 0x20, 0x20, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x41, 0x41, 0x41, 0xff, 0x42, 0x42, 0x42, 0xff, 0x34, 0x34, 0x34, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x29, 0x29, 0x29, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x33, 0x33, 0x33, 0xff, 0x32, 0x32, 0x32, 0xff, 0x34, 0x34, 0x34, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x52, 0x52, 0x52, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x19, 0x19, 0x19, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x34, 0x34, 0x34, 0xff, 0x33, 0x33, 0x33, 0xff, 0x00, 0x00, 0x00, 0xff, 0x67, 0x67, 0x67, 0xff, 0x60, 0x60, 0x60, 0xff, 0x25, 0x25, 0x25, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x68, 0x68, 0x68, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x45, 0x45, 0x45, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x60, 0x60, 0x60, 0xff, 0x72, 0x72, 0x72, 0xff, 0x87, 0x87, 0x87, 0xff, 0x94, 0x94, 0x94, 0xff, 0x9c, 0x9c, 0x9c, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xac, 0xac, 0xac, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x93, 0x93, 0x93, 0xff, 0x88, 0x88, 0x88, 0xff, 0x83, 0x83, 0x83, 0xff, 0x78, 0x78, 0x78, 0xff, 0x64, 0x64, 0x64, 0xff, 0x58, 0x58, 0x58, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x51, 0x51, 0x51, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x50, 0x50, 0x50, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x50, 0x50, 0x50, 0xff, 0x59, 0x59, 0x59, 0xff, 0x74, 0x74, 0x74, 0xff, 0xac, 0xac, 0xac, 0xff, 0x60, 0x60, 0x60, 0xff, 0x25, 0x25, 0x25, 0xff, 0x30, 0x30, 0x30, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x36, 0x36, 0x36, 0xff, 0x24, 0x24, 0x24, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x33, 0x33, 0x33, 0xff, 0x50, 0x50, 0x50, 0xff, 0x58, 0x58, 0x58, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x65, 0x65, 0x65, 0xff, 0x43, 0x43, 0x43, 0xff, 0x50, 0x50, 0x50, 0xff, 0x74, 0x74, 0x74, 0xfe, 0x7f, 0x7f, 0x7f, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x86, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x14, 0x14, 0x14, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x04, 0x04, 0x04, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x19, 0x19, 0x19, 0xff, 0x19, 0x19, 0x19, 0xff, 0x21, 0x21, 0x21, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x22, 0x22, 0x22, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x44, 0x44, 0x44, 0xff, 0x37, 0x37, 0x37, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x27, 0x27, 0x27, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x15, 0x15, 0x15, 0xff, 0x37, 0x37, 0x37, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x37, 0x37, 0x37, 0xff, 0x37, 0x37, 0x37, 0xff, 0x37, 0x37, 0x37, 0xff, 0x42, 0x42, 0x42, 0xff, 0x59, 0x59, 0x59, 0xff, 0x67, 0x67, 0x67, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x30, 0x30, 0x30, 0xff, 0x44, 0x44, 0x44, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x47, 0x47, 0x47, 0xff, 0x75, 0x75, 0x75, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x39, 0x39, 0x39, 0xff, 0x30, 0x30, 0x30, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x53, 0x53, 0x53, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x87, 0x87, 0x87, 0xff, 0x95, 0x95, 0x95, 0xff, 0xa2, 0xa2, 0xa2, 0xff, 0xab, 0xab, 0xab, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xae, 0xae, 0xae, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0x9d, 0x9d, 0x9d, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x84, 0x84, 0x84, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x76, 0x76, 0x76, 0xff, 0x68, 0x68, 0x68, 0xff, 0x54, 0x54, 0x54, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x51, 0x51, 0x51, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x51, 0x51, 0x51, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x61, 0x61, 0x61, 0xff, 0x55, 0x55, 0x55, 0xff, 0x72, 0x72, 0x72, 0xff, 0x52, 0x52, 0x52, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x30, 0x30, 0x30, 0xff, 0x23, 0x23, 0x23, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x49, 0x49, 0x49, 0xff, 0x58, 0x58, 0x58, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x63, 0x63, 0x63, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x66, 0x66, 0x66, 0xff, 0x6d, 0x6d, 0x6d, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x05, 0xe7, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x18, 0x18, 0x18, 0xff, 0x16, 0x16, 0x16, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x10, 0x10, 0x10, 0xff, 0x10, 0x10, 0x10, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x08, 0x08, 0x08, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x09, 0x09, 0x09, 0xff, 0x02, 0x02, 0x02, 0xff, 0x10, 0x10, 0x10, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x18, 0x18, 0x18, 0xff, 0x23, 0x23, 0x23, 0xff, 0x20, 0x20, 0x20, 0xff, 0x25, 0x25, 0x25, 0xff, 0x41, 0x41, 0x41, 0xff, 0x43, 0x43, 0x43, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x28, 0x28, 0x28, 0xff, 0x29, 0x29, 0x29, 0xff, 0x20, 0x20, 0x20, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x21, 0x21, 0x21, 0xff, 0x38, 0x38, 0x38, 0xff, 0x33, 0x33, 0x33, 0xff, 0x42, 0x42, 0x42, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x38, 0x38, 0x38, 0xff, 0x49, 0x49, 0x49, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x64, 0x64, 0x64, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x30, 0x30, 0x30, 0xff, 0x38, 0x38, 0x38, 0xff, 0x39, 0x39, 0x39, 0xff, 0x35, 0x35, 0x35, 0xff, 0x47, 0x47, 0x47, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0x72, 0x72, 0x72, 0xff, 0x26, 0x26, 0x26, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x27, 0x27, 0x27, 0xff, 0x28, 0x28, 0x28, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x44, 0x44, 0x44, 0xff, 0x65, 0x65, 0x65, 0xff, 0x84, 0x84, 0x84, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xab, 0xab, 0xab, 0xff, 0x9f, 0x9f, 0x9f, 0xff, 0x98, 0x98, 0x98, 0xff, 0x91, 0x91, 0x91, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x81, 0x81, 0x81, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0x99, 0x99, 0x99, 0xff, 0x78, 0x78, 0x78, 0xff, 0x37, 0x37, 0x37, 0xff, 0x21, 0x21, 0x21, 0xff, 0x28, 0x28, 0x28, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x32, 0x32, 0x32, 0xff, 0x25, 0x25, 0x25, 0xff, 0x30, 0x30, 0x30, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x44, 0x44, 0x44, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x54, 0x54, 0x54, 0xff, 0x36, 0x36, 0x36, 0xff, 0x66, 0x66, 0x66, 0xff, 0x65, 0x65, 0x65, 0xff, 0x5a, 0x5a, 0x5a, 0xe7, 0x7f, 0x7f, 0x7f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x49, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x10, 0x10, 0x10, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x12, 0x12, 0x12, 0xff, 0x10, 0x10, 0x10, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x07, 0x07, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x14, 0x14, 0x14, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x15, 0x15, 0x15, 0xff, 0x21, 0x21, 0x21, 0xff, 0x24, 0x24, 0x24, 0xff, 0x28, 0x28, 0x28, 0xff, 0x43, 0x43, 0x43, 0xff, 0x41, 0x41, 0x41, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x29, 0x29, 0x29, 0xff, 0x24, 0x24, 0x24, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x06, 0x06, 0x06, 0xff, 0x09, 0x09, 0x09, 0xff, 0x10, 0x10, 0x10, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x35, 0x35, 0x35, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x39, 0x39, 0x39, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x61, 0x61, 0x61, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x37, 0x37, 0x37, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x31, 0x31, 0x31, 0xff, 0x41, 0x41, 0x41, 0xff, 0x50, 0x50, 0x50, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x64, 0x64, 0x64, 0xff, 0x75, 0x75, 0x75, 0xff, 0x79, 0x79, 0x79, 0xff, 0x21, 0x21, 0x21, 0xff, 0x34, 0x34, 0x34, 0xff, 0x75, 0x75, 0x75, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x25, 0x25, 0x25, 0xff, 0x27, 0x27, 0x27, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x65, 0x65, 0x65, 0xff, 0x89, 0x89, 0x89, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0x94, 0x94, 0x94, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x62, 0x62, 0x62, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x56, 0x56, 0x56, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x95, 0x95, 0x95, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0x92, 0x92, 0x92, 0xff, 0x21, 0x21, 0x21, 0xff, 0x23, 0x23, 0x23, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x32, 0x32, 0x32, 0xff, 0x29, 0x29, 0x29, 0xff, 0x23, 0x23, 0x23, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x43, 0x43, 0x43, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x52, 0x52, 0x52, 0xff, 0x38, 0x38, 0x38, 0xff, 0x73, 0x73, 0x73, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x50, 0x50, 0x50, 0xff, 0x78, 0x78, 0x78, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x9f, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x13, 0x13, 0x13, 0xff, 0x19, 0x19, 0x19, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x11, 0x11, 0x11, 0xff, 0x12, 0x12, 0x12, 0xff, 0x12, 0x12, 0x12, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x09, 0x09, 0x09, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x06, 0x06, 0x06, 0xff, 0x00, 0x00, 0x00, 0xff, 0x17, 0x17, 0x17, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x14, 0x14, 0x14, 0xff, 0x21, 0x21, 0x21, 0xff, 0x26, 0x26, 0x26, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x44, 0x44, 0x44, 0xff, 0x42, 0x42, 0x42, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x29, 0x29, 0x29, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x24, 0x24, 0x24, 0xff, 0x12, 0x12, 0x12, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x17, 0x17, 0x17, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x26, 0x26, 0x26, 0xff, 0x45, 0x45, 0x45, 0xff, 0x42, 0x42, 0x42, 0xff, 0x35, 0x35, 0x35, 0xff, 0x43, 0x43, 0x43, 0xff, 0x57, 0x57, 0x57, 0xff, 0x72, 0x72, 0x72, 0xff, 0x62, 0x62, 0x62, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x46, 0x46, 0x46, 0xff, 0x43, 0x43, 0x43, 0xff, 0x47, 0x47, 0x47, 0xff, 0x47, 0x47, 0x47, 0xff, 0x56, 0x56, 0x56, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x78, 0x78, 0x78, 0xff, 0x75, 0x75, 0x75, 0xff, 0x62, 0x62, 0x62, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x52, 0x52, 0x52, 0xff, 0x25, 0x25, 0x25, 0xff, 0x25, 0x25, 0x25, 0xff, 0x28, 0x28, 0x28, 0xff, 0x37, 0x37, 0x37, 0xff, 0x62, 0x62, 0x62, 0xff, 0x91, 0x91, 0x91, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0x95, 0x95, 0x95, 0xff, 0x80, 0x80, 0x80, 0xff, 0x59, 0x59, 0x59, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x39, 0x39, 0x39, 0xff, 0x46, 0x46, 0x46, 0xff, 0x69, 0x69, 0x69, 0xff, 0x67, 0x67, 0x67, 0xff, 0x63, 0x63, 0x63, 0xff, 0x9a, 0x9a, 0x9a, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0x79, 0x79, 0x79, 0xff, 0x12, 0x12, 0x12, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x39, 0x39, 0x39, 0xff, 0x26, 0x26, 0x26, 0xff, 0x21, 0x21, 0x21, 0xff, 0x25, 0x25, 0x25, 0xff, 0x45, 0x45, 0x45, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x53, 0x53, 0x53, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x62, 0x62, 0x62, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x43, 0x43, 0x43, 0xff, 0x72, 0x72, 0x72, 0xff, 0x65, 0x65, 0x65, 0xff, 0x58, 0x58, 0x58, 0xff, 0x69, 0x69, 0x69, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x05, 0x05, 0x05, 0xef, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x04, 0x04, 0x04, 0xff, 0x06, 0x06, 0x06, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x19, 0x19, 0x19, 0xff, 0x18, 0x18, 0x18, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x12, 0x12, 0x12, 0xff, 0x16, 0x16, 0x16, 0xff, 0x12, 0x12, 0x12, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x09, 0x09, 0x09, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x09, 0x09, 0x09, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x13, 0x13, 0x13, 0xff, 0x23, 0x23, 0x23, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x35, 0x35, 0x35, 0xff, 0x42, 0x42, 0x42, 0xff, 0x41, 0x41, 0x41, 0xff, 0x42, 0x42, 0x42, 0xff, 0x25, 0x25, 0x25, 0xff, 0x24, 0x24, 0x24, 0xff, 0x22, 0x22, 0x22, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x19, 0x19, 0x19, 0xff, 0x21, 0x21, 0x21, 0xff, 0x22, 0x22, 0x22, 0xff, 0x31, 0x31, 0x31, 0xff, 0x47, 0x47, 0x47, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x31, 0x31, 0x31, 0xff, 0x48, 0x48, 0x48, 0xff, 0x65, 0x65, 0x65, 0xff, 0x70, 0x70, 0x70, 0xff, 0x69, 0x69, 0x69, 0xff, 0x62, 0x62, 0x62, 0xff, 0x64, 0x64, 0x64, 0xff, 0x63, 0x63, 0x63, 0xff, 0x62, 0x62, 0x62, 0xff, 0x61, 0x61, 0x61, 0xff, 0x62, 0x62, 0x62, 0xff, 0x64, 0x64, 0x64, 0xff, 0x66, 0x66, 0x66, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x67, 0x67, 0x67, 0xff, 0x77, 0x77, 0x77, 0xff, 0x72, 0x72, 0x72, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x29, 0x29, 0x29, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x39, 0x39, 0x39, 0xff, 0x64, 0x64, 0x64, 0xff, 0x96, 0x96, 0x96, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0x92, 0x92, 0x92, 0xff, 0x65, 0x65, 0x65, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x31, 0x31, 0x31, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x29, 0x29, 0x29, 0xff, 0x30, 0x30, 0x30, 0xff, 0x35, 0x35, 0x35, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x51, 0x51, 0x51, 0xff, 0x66, 0x66, 0x66, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x86, 0x86, 0x86, 0xff, 0x9f, 0x9f, 0x9f, 0xff, 0xae, 0xae, 0xae, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0x55, 0x55, 0x55, 0xff, 0x14, 0x14, 0x14, 0xff, 0x19, 0x19, 0x19, 0xff, 0x28, 0x28, 0x28, 0xff, 0x28, 0x28, 0x28, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x43, 0x43, 0x43, 0xff, 0x55, 0x55, 0x55, 0xff, 0x49, 0x49, 0x49, 0xff, 0x41, 0x41, 0x41, 0xff, 0x60, 0x60, 0x60, 0xff, 0x48, 0x48, 0x48, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x57, 0x57, 0x57, 0xff, 0x65, 0x65, 0x65, 0xff, 0x68, 0x68, 0x68, 0xef, 0x91, 0x91, 0x91, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x46, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x06, 0x06, 0x06, 0xff, 0x09, 0x09, 0x09, 0xff, 0x11, 0x11, 0x11, 0xff, 0x18, 0x18, 0x18, 0xff, 0x14, 0x14, 0x14, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x14, 0x14, 0x14, 0xff, 0x17, 0x17, 0x17, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x09, 0x09, 0x09, 0xff, 0x06, 0x06, 0x06, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x08, 0x08, 0x08, 0xff, 0x03, 0x03, 0x03, 0xff, 0x09, 0x09, 0x09, 0xff, 0x21, 0x21, 0x21, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x20, 0x20, 0x20, 0xff, 0x31, 0x31, 0x31, 0xff, 0x37, 0x37, 0x37, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x28, 0x28, 0x28, 0xff, 0x24, 0x24, 0x24, 0xff, 0x26, 0x26, 0x26, 0xff, 0x04, 0x04, 0x04, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x21, 0x21, 0x21, 0xff, 0x29, 0x29, 0x29, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x33, 0x33, 0x33, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x33, 0x33, 0x33, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x72, 0x72, 0x72, 0xff, 0x72, 0x72, 0x72, 0xff, 0x73, 0x73, 0x73, 0xff, 0x75, 0x75, 0x75, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x79, 0x79, 0x79, 0xff, 0x75, 0x75, 0x75, 0xff, 0x72, 0x72, 0x72, 0xff, 0x75, 0x75, 0x75, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x62, 0x62, 0x62, 0xff, 0x50, 0x50, 0x50, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x30, 0x30, 0x30, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x43, 0x43, 0x43, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x9a, 0x9a, 0x9a, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x53, 0x53, 0x53, 0xff, 0x30, 0x30, 0x30, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x29, 0x29, 0x29, 0xff, 0x00, 0x00, 0x00, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x47, 0x47, 0x47, 0xff, 0x37, 0x37, 0x37, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x49, 0x49, 0x49, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x47, 0x47, 0x47, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0x98, 0x98, 0x98, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x19, 0x19, 0x19, 0xff, 0x13, 0x13, 0x13, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x59, 0x59, 0x59, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x64, 0x64, 0x64, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x57, 0x57, 0x57, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x50, 0x50, 0x50, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x62, 0x62, 0x62, 0xff, 0x74, 0x74, 0x74, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x8d, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x06, 0x06, 0x06, 0xff, 0x09, 0x09, 0x09, 0xff, 0x11, 0x11, 0x11, 0xff, 0x17, 0x17, 0x17, 0xff, 0x12, 0x12, 0x12, 0xff, 0x13, 0x13, 0x13, 0xff, 0x16, 0x16, 0x16, 0xff, 0x15, 0x15, 0x15, 0xff, 0x10, 0x10, 0x10, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x05, 0x05, 0x05, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x23, 0x23, 0x23, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x39, 0x39, 0x39, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x23, 0x23, 0x23, 0xff, 0x27, 0x27, 0x27, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x13, 0x13, 0x13, 0xff, 0x25, 0x25, 0x25, 0xff, 0x40, 0x40, 0x40, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x31, 0x31, 0x31, 0xff, 0x37, 0x37, 0x37, 0xff, 0x52, 0x52, 0x52, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x75, 0x75, 0x75, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x80, 0x80, 0x80, 0xff, 0x83, 0x83, 0x83, 0xff, 0x86, 0x86, 0x86, 0xff, 0x86, 0x86, 0x86, 0xff, 0x89, 0x89, 0x89, 0xff, 0x87, 0x87, 0x87, 0xff, 0x84, 0x84, 0x84, 0xff, 0x82, 0x82, 0x82, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x46, 0x46, 0x46, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x35, 0x35, 0x35, 0xff, 0x34, 0x34, 0x34, 0xff, 0x37, 0x37, 0x37, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x76, 0x76, 0x76, 0xff, 0x9d, 0x9d, 0x9d, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0x80, 0x80, 0x80, 0xff, 0x33, 0x33, 0x33, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x38, 0x38, 0x38, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0x90, 0x90, 0x90, 0xff, 0x02, 0x02, 0x02, 0xff, 0x28, 0x28, 0x28, 0xff, 0x44, 0x44, 0x44, 0xff, 0x70, 0x70, 0x70, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0x76, 0x76, 0x76, 0xff, 0x32, 0x32, 0x32, 0xff, 0x10, 0x10, 0x10, 0xff, 0x12, 0x12, 0x12, 0xff, 0x17, 0x17, 0x17, 0xff, 0x13, 0x13, 0x13, 0xff, 0x27, 0x27, 0x27, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x32, 0x32, 0x32, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x56, 0x56, 0x56, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x65, 0x65, 0x65, 0xff, 0x40, 0x40, 0x40, 0xff, 0x62, 0x62, 0x62, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x53, 0x53, 0x53, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x65, 0x65, 0x65, 0xff, 0x6e, 0x6e, 0x6e, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0xd7, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x06, 0x06, 0x06, 0xff, 0x09, 0x09, 0x09, 0xff, 0x15, 0x15, 0x15, 0xff, 0x18, 0x18, 0x18, 0xff, 0x14, 0x14, 0x14, 0xff, 0x11, 0x11, 0x11, 0xff, 0x14, 0x14, 0x14, 0xff, 0x15, 0x15, 0x15, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x10, 0x10, 0x10, 0xff, 0x11, 0x11, 0x11, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x13, 0x13, 0x13, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x18, 0x18, 0x18, 0xff, 0x23, 0x23, 0x23, 0xff, 0x22, 0x22, 0x22, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x40, 0x40, 0x40, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x45, 0x45, 0x45, 0xff, 0x33, 0x33, 0x33, 0xff, 0x25, 0x25, 0x25, 0xff, 0x22, 0x22, 0x22, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x18, 0x18, 0x18, 0xff, 0x33, 0x33, 0x33, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x22, 0x22, 0x22, 0xff, 0x30, 0x30, 0x30, 0xff, 0x31, 0x31, 0x31, 0xff, 0x39, 0x39, 0x39, 0xff, 0x60, 0x60, 0x60, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x83, 0x83, 0x83, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x89, 0x89, 0x89, 0xff, 0x87, 0x87, 0x87, 0xff, 0x85, 0x85, 0x85, 0xff, 0x86, 0x86, 0x86, 0xff, 0x86, 0x86, 0x86, 0xff, 0x86, 0x86, 0x86, 0xff, 0x82, 0x82, 0x82, 0xff, 0x82, 0x82, 0x82, 0xff, 0x80, 0x80, 0x80, 0xff, 0x76, 0x76, 0x76, 0xff, 0x67, 0x67, 0x67, 0xff, 0x52, 0x52, 0x52, 0xff, 0x46, 0x46, 0x46, 0xff, 0x40, 0x40, 0x40, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x38, 0x38, 0x38, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x50, 0x50, 0x50, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0x99, 0x99, 0x99, 0xff, 0x75, 0x75, 0x75, 0xff, 0x63, 0x63, 0x63, 0xff, 0x57, 0x57, 0x57, 0xff, 0x47, 0x47, 0x47, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x63, 0x63, 0x63, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0x58, 0x58, 0x58, 0xff, 0x06, 0x06, 0x06, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x54, 0x54, 0x54, 0xff, 0x78, 0x78, 0x78, 0xff, 0x96, 0x96, 0x96, 0xff, 0x62, 0x62, 0x62, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x10, 0x10, 0x10, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x46, 0x46, 0x46, 0xff, 0x55, 0x55, 0x55, 0xff, 0x24, 0x24, 0x24, 0xff, 0x53, 0x53, 0x53, 0xff, 0x56, 0x56, 0x56, 0xff, 0x47, 0x47, 0x47, 0xff, 0x63, 0x63, 0x63, 0xff, 0x45, 0x45, 0x45, 0xff, 0x64, 0x64, 0x64, 0xff, 0x61, 0x61, 0x61, 0xff, 0x64, 0x64, 0x64, 0xff, 0x65, 0x65, 0x65, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x6d, 0x6d, 0x6d, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x1a, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x19, 0x19, 0x19, 0xff, 0x17, 0x17, 0x17, 0xff, 0x11, 0x11, 0x11, 0xff, 0x11, 0x11, 0x11, 0xff, 0x17, 0x17, 0x17, 0xff, 0x14, 0x14, 0x14, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x10, 0x10, 0x10, 0xff, 0x10, 0x10, 0x10, 0xff, 0x06, 0x06, 0x06, 0xff, 0x09, 0x09, 0x09, 0xff, 0x09, 0x09, 0x09, 0xff, 0x10, 0x10, 0x10, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x24, 0x24, 0x24, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x46, 0x46, 0x46, 0xff, 0x33, 0x33, 0x33, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x33, 0x33, 0x33, 0xff, 0x25, 0x25, 0x25, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x41, 0x41, 0x41, 0xff, 0x67, 0x67, 0x67, 0xff, 0x71, 0x71, 0x71, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x90, 0x90, 0x90, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x88, 0x88, 0x88, 0xff, 0x88, 0x88, 0x88, 0xff, 0x84, 0x84, 0x84, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x76, 0x76, 0x76, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x46, 0x46, 0x46, 0xff, 0x40, 0x40, 0x40, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x53, 0x53, 0x53, 0xff, 0x82, 0x82, 0x82, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xa2, 0xa2, 0xa2, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x69, 0x69, 0x69, 0xff, 0x71, 0x71, 0x71, 0xff, 0x62, 0x62, 0x62, 0xff, 0x73, 0x73, 0x73, 0xff, 0x9c, 0x9c, 0x9c, 0xff, 0x89, 0x89, 0x89, 0xff, 0x78, 0x78, 0x78, 0xff, 0x65, 0x65, 0x65, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x23, 0x23, 0x23, 0xff, 0x54, 0x54, 0x54, 0xff, 0x89, 0x89, 0x89, 0xff, 0x93, 0x93, 0x93, 0xff, 0x58, 0x58, 0x58, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x15, 0x15, 0x15, 0xff, 0x17, 0x17, 0x17, 0xff, 0x10, 0x10, 0x10, 0xff, 0x04, 0x04, 0x04, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x48, 0x48, 0x48, 0xff, 0x43, 0x43, 0x43, 0xff, 0x28, 0x28, 0x28, 0xff, 0x59, 0x59, 0x59, 0xff, 0x56, 0x56, 0x56, 0xff, 0x54, 0x54, 0x54, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x61, 0x61, 0x61, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x62, 0x62, 0x62, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x71, 0x71, 0x71, 0xff, 0x7a, 0x7a, 0x7a, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x58, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x14, 0x14, 0x14, 0xff, 0x10, 0x10, 0x10, 0xff, 0x13, 0x13, 0x13, 0xff, 0x17, 0x17, 0x17, 0xff, 0x14, 0x14, 0x14, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x10, 0x10, 0x10, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x09, 0x09, 0x09, 0xff, 0x11, 0x11, 0x11, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x23, 0x23, 0x23, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x59, 0x59, 0x59, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x34, 0x34, 0x34, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x23, 0x23, 0x23, 0xff, 0x32, 0x32, 0x32, 0xff, 0x16, 0x16, 0x16, 0xff, 0x21, 0x21, 0x21, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x28, 0x28, 0x28, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x73, 0x73, 0x73, 0xff, 0x75, 0x75, 0x75, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x89, 0x89, 0x89, 0xff, 0x89, 0x89, 0x89, 0xff, 0x90, 0x90, 0x90, 0xff, 0x91, 0x91, 0x91, 0xff, 0x90, 0x90, 0x90, 0xff, 0x86, 0x86, 0x86, 0xff, 0x86, 0x86, 0x86, 0xff, 0x81, 0x81, 0x81, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x77, 0x77, 0x77, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x62, 0x62, 0x62, 0xff, 0x54, 0x54, 0x54, 0xff, 0x49, 0x49, 0x49, 0xff, 0x43, 0x43, 0x43, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x55, 0x55, 0x55, 0xff, 0x81, 0x81, 0x81, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xa2, 0xa2, 0xa2, 0xff, 0x97, 0x97, 0x97, 0xff, 0x73, 0x73, 0x73, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x78, 0x78, 0x78, 0xff, 0x84, 0x84, 0x84, 0xff, 0x71, 0x71, 0x71, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x48, 0x48, 0x48, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x50, 0x50, 0x50, 0xff, 0x76, 0x76, 0x76, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0x90, 0x90, 0x90, 0xff, 0x47, 0x47, 0x47, 0xff, 0x18, 0x18, 0x18, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x16, 0x16, 0x16, 0xff, 0x09, 0x09, 0x09, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x50, 0x50, 0x50, 0xff, 0x45, 0x45, 0x45, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x52, 0x52, 0x52, 0xff, 0x53, 0x53, 0x53, 0xff, 0x59, 0x59, 0x59, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x79, 0x79, 0x79, 0xff, 0x53, 0x53, 0x53, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x68, 0x68, 0x68, 0xff, 0x65, 0x65, 0x65, 0xff, 0x71, 0x71, 0x71, 0xff, 0x7f, 0x7f, 0x7f, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x90, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x13, 0x13, 0x13, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x14, 0x14, 0x14, 0xff, 0x17, 0x17, 0x17, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x10, 0x10, 0x10, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x10, 0x10, 0x10, 0xff, 0x15, 0x15, 0x15, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x20, 0x20, 0x20, 0xff, 0x26, 0x26, 0x26, 0xff, 0x22, 0x22, 0x22, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x30, 0x30, 0x30, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x56, 0x56, 0x56, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x25, 0x25, 0x25, 0xff, 0x19, 0x19, 0x19, 0xff, 0x18, 0x18, 0x18, 0xff, 0x27, 0x27, 0x27, 0xff, 0x28, 0x28, 0x28, 0xff, 0x24, 0x24, 0x24, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x57, 0x57, 0x57, 0xff, 0x75, 0x75, 0x75, 0xff, 0x75, 0x75, 0x75, 0xff, 0x78, 0x78, 0x78, 0xff, 0x82, 0x82, 0x82, 0xff, 0x86, 0x86, 0x86, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x86, 0x86, 0x86, 0xff, 0x81, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x75, 0x75, 0x75, 0xff, 0x67, 0x67, 0x67, 0xff, 0x59, 0x59, 0x59, 0xff, 0x48, 0x48, 0x48, 0xff, 0x42, 0x42, 0x42, 0xff, 0x40, 0x40, 0x40, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x40, 0x40, 0x40, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x41, 0x41, 0x41, 0xff, 0x59, 0x59, 0x59, 0xff, 0x83, 0x83, 0x83, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xad, 0xad, 0xad, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x88, 0x88, 0x88, 0xff, 0x97, 0x97, 0x97, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0x96, 0x96, 0x96, 0xff, 0x92, 0x92, 0x92, 0xff, 0x73, 0x73, 0x73, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x86, 0x86, 0x86, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa6, 0xa6, 0xa6, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0x88, 0x88, 0x88, 0xff, 0x35, 0x35, 0x35, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x13, 0x13, 0x13, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x28, 0x28, 0x28, 0xff, 0x54, 0x54, 0x54, 0xff, 0x45, 0x45, 0x45, 0xff, 0x26, 0x26, 0x26, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x54, 0x54, 0x54, 0xff, 0x56, 0x56, 0x56, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x61, 0x61, 0x61, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x45, 0x45, 0x45, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x61, 0x61, 0x61, 0xff, 0x73, 0x73, 0x73, 0xff, 0x81, 0x81, 0x81, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0xc6, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x13, 0x13, 0x13, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x15, 0x15, 0x15, 0xff, 0x15, 0x15, 0x15, 0xff, 0x11, 0x11, 0x11, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x16, 0x16, 0x16, 0xff, 0x11, 0x11, 0x11, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x08, 0x08, 0x08, 0xff, 0x12, 0x12, 0x12, 0xff, 0x22, 0x22, 0x22, 0xff, 0x29, 0x29, 0x29, 0xff, 0x21, 0x21, 0x21, 0xff, 0x17, 0x17, 0x17, 0xff, 0x35, 0x35, 0x35, 0xff, 0x53, 0x53, 0x53, 0xff, 0x55, 0x55, 0x55, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x45, 0x45, 0x45, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x31, 0x31, 0x31, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x17, 0x17, 0x17, 0xff, 0x18, 0x18, 0x18, 0xff, 0x27, 0x27, 0x27, 0xff, 0x20, 0x20, 0x20, 0xff, 0x23, 0x23, 0x23, 0xff, 0x39, 0x39, 0x39, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x76, 0x76, 0x76, 0xff, 0x73, 0x73, 0x73, 0xff, 0x74, 0x74, 0x74, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x83, 0x83, 0x83, 0xff, 0x87, 0x87, 0x87, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x87, 0x87, 0x87, 0xff, 0x86, 0x86, 0x86, 0xff, 0x85, 0x85, 0x85, 0xff, 0x81, 0x81, 0x81, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x71, 0x71, 0x71, 0xff, 0x61, 0x61, 0x61, 0xff, 0x50, 0x50, 0x50, 0xff, 0x40, 0x40, 0x40, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x45, 0x45, 0x45, 0xff, 0x63, 0x63, 0x63, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xae, 0xae, 0xae, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xad, 0xad, 0xad, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xad, 0xad, 0xad, 0xff, 0xad, 0xad, 0xad, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0xab, 0xab, 0xab, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xa6, 0xa6, 0xa6, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x20, 0x20, 0x20, 0xff, 0x12, 0x12, 0x12, 0xff, 0x07, 0x07, 0x07, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x28, 0x28, 0x28, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x28, 0x28, 0x28, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x67, 0x67, 0x67, 0xff, 0x45, 0x45, 0x45, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x71, 0x71, 0x71, 0xff, 0x7f, 0x7f, 0x7f, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x06, 0x06, 0x06, 0xf2, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x10, 0x10, 0x10, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x17, 0x17, 0x17, 0xff, 0x11, 0x11, 0x11, 0xff, 0x14, 0x14, 0x14, 0xff, 0x13, 0x13, 0x13, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x13, 0x13, 0x13, 0xff, 0x17, 0x17, 0x17, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x08, 0x08, 0x08, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x25, 0x25, 0x25, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x18, 0x18, 0x18, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x52, 0x52, 0x52, 0xff, 0x56, 0x56, 0x56, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x41, 0x41, 0x41, 0xff, 0x40, 0x40, 0x40, 0xff, 0x45, 0x45, 0x45, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x14, 0x14, 0x14, 0xff, 0x12, 0x12, 0x12, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x16, 0x16, 0x16, 0xff, 0x22, 0x22, 0x22, 0xff, 0x42, 0x42, 0x42, 0xff, 0x63, 0x63, 0x63, 0xff, 0x79, 0x79, 0x79, 0xff, 0x74, 0x74, 0x74, 0xff, 0x71, 0x71, 0x71, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x87, 0x87, 0x87, 0xff, 0x86, 0x86, 0x86, 0xff, 0x86, 0x86, 0x86, 0xff, 0x85, 0x85, 0x85, 0xff, 0x86, 0x86, 0x86, 0xff, 0x80, 0x80, 0x80, 0xff, 0x77, 0x77, 0x77, 0xff, 0x69, 0x69, 0x69, 0xff, 0x59, 0x59, 0x59, 0xff, 0x47, 0x47, 0x47, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x38, 0x38, 0x38, 0xff, 0x37, 0x37, 0x37, 0xff, 0x39, 0x39, 0x39, 0xff, 0x48, 0x48, 0x48, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x94, 0x94, 0x94, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xad, 0xad, 0xad, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xba, 0xba, 0xba, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x00, 0x00, 0x00, 0xff, 0x25, 0x25, 0x25, 0xff, 0x39, 0x39, 0x39, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x29, 0x29, 0x29, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x43, 0x43, 0x43, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x63, 0x63, 0x63, 0xff, 0x63, 0x63, 0x63, 0xff, 0x55, 0x55, 0x55, 0xff, 0x75, 0x75, 0x75, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x49, 0x49, 0x49, 0xff, 0x77, 0x77, 0x77, 0xff, 0x72, 0x72, 0x72, 0xff, 0x57, 0x57, 0x57, 0xff, 0x69, 0x69, 0x69, 0xff, 0x7e, 0x7e, 0x7e, 0xf2, 0xff, 0xff, 0xff, 0x01,
+    0x07, 0x07, 0x07, 0x21, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x13, 0x13, 0x13, 0xff, 0x19, 0x19, 0x19, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x10, 0x10, 0x10, 0xff, 0x17, 0x17, 0x17, 0xff, 0x12, 0x12, 0x12, 0xff, 0x15, 0x15, 0x15, 0xff, 0x14, 0x14, 0x14, 0xff, 0x10, 0x10, 0x10, 0xff, 0x15, 0x15, 0x15, 0xff, 0x15, 0x15, 0x15, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x27, 0x27, 0x27, 0xff, 0x22, 0x22, 0x22, 0xff, 0x19, 0x19, 0x19, 0xff, 0x39, 0x39, 0x39, 0xff, 0x57, 0x57, 0x57, 0xff, 0x58, 0x58, 0x58, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x41, 0x41, 0x41, 0xff, 0x43, 0x43, 0x43, 0xff, 0x41, 0x41, 0x41, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x11, 0x11, 0x11, 0xff, 0x25, 0x25, 0x25, 0xff, 0x24, 0x24, 0x24, 0xff, 0x15, 0x15, 0x15, 0xff, 0x24, 0x24, 0x24, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x71, 0x71, 0x71, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x71, 0x71, 0x71, 0xff, 0x72, 0x72, 0x72, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x80, 0x80, 0x80, 0xff, 0x83, 0x83, 0x83, 0xff, 0x84, 0x84, 0x84, 0xff, 0x87, 0x87, 0x87, 0xff, 0x88, 0x88, 0x88, 0xff, 0x86, 0x86, 0x86, 0xff, 0x80, 0x80, 0x80, 0xff, 0x76, 0x76, 0x76, 0xff, 0x63, 0x63, 0x63, 0xff, 0x52, 0x52, 0x52, 0xff, 0x42, 0x42, 0x42, 0xff, 0x38, 0x38, 0x38, 0xff, 0x36, 0x36, 0x36, 0xff, 0x33, 0x33, 0x33, 0xff, 0x34, 0x34, 0x34, 0xff, 0x38, 0x38, 0x38, 0xff, 0x41, 0x41, 0x41, 0xff, 0x53, 0x53, 0x53, 0xff, 0x74, 0x74, 0x74, 0xff, 0x9a, 0x9a, 0x9a, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0x54, 0x54, 0x54, 0xff, 0x02, 0x02, 0x02, 0xff, 0x06, 0x06, 0x06, 0xff, 0x02, 0x02, 0x02, 0xff, 0x22, 0x22, 0x22, 0xff, 0x34, 0x34, 0x34, 0xff, 0x13, 0x13, 0x13, 0xff, 0x27, 0x27, 0x27, 0xff, 0x45, 0x45, 0x45, 0xff, 0x40, 0x40, 0x40, 0xff, 0x39, 0x39, 0x39, 0xff, 0x47, 0x47, 0x47, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x65, 0x65, 0x65, 0xff, 0x58, 0x58, 0x58, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x50, 0x50, 0x50, 0xff, 0x78, 0x78, 0x78, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x69, 0x69, 0x69, 0xff, 0x82, 0x82, 0x82, 0xff, 0x83, 0x83, 0x83, 0x21,
+    0x03, 0x03, 0x03, 0x4b, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x06, 0x06, 0x06, 0xff, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x15, 0x15, 0x15, 0xff, 0x17, 0x17, 0x17, 0xff, 0x13, 0x13, 0x13, 0xff, 0x15, 0x15, 0x15, 0xff, 0x17, 0x17, 0x17, 0xff, 0x13, 0x13, 0x13, 0xff, 0x12, 0x12, 0x12, 0xff, 0x13, 0x13, 0x13, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x15, 0x15, 0x15, 0xff, 0x21, 0x21, 0x21, 0xff, 0x24, 0x24, 0x24, 0xff, 0x27, 0x27, 0x27, 0xff, 0x27, 0x27, 0x27, 0xff, 0x18, 0x18, 0x18, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x66, 0x66, 0x66, 0xff, 0x54, 0x54, 0x54, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x42, 0x42, 0x42, 0xff, 0x43, 0x43, 0x43, 0xff, 0x34, 0x34, 0x34, 0xff, 0x11, 0x11, 0x11, 0xff, 0x16, 0x16, 0x16, 0xff, 0x27, 0x27, 0x27, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x16, 0x16, 0x16, 0xff, 0x28, 0x28, 0x28, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x74, 0x74, 0x74, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x72, 0x72, 0x72, 0xff, 0x74, 0x74, 0x74, 0xff, 0x77, 0x77, 0x77, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x87, 0x87, 0x87, 0xff, 0x89, 0x89, 0x89, 0xff, 0x88, 0x88, 0x88, 0xff, 0x87, 0x87, 0x87, 0xff, 0x82, 0x82, 0x82, 0xff, 0x75, 0x75, 0x75, 0xff, 0x61, 0x61, 0x61, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x33, 0x33, 0x33, 0xff, 0x30, 0x30, 0x30, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x54, 0x54, 0x54, 0xff, 0x67, 0x67, 0x67, 0xff, 0x80, 0x80, 0x80, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x37, 0x37, 0x37, 0xff, 0x02, 0x02, 0x02, 0xff, 0x08, 0x08, 0x08, 0xff, 0x04, 0x04, 0x04, 0xff, 0x22, 0x22, 0x22, 0xff, 0x38, 0x38, 0x38, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x29, 0x29, 0x29, 0xff, 0x44, 0x44, 0x44, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x41, 0x41, 0x41, 0xff, 0x76, 0x76, 0x76, 0xff, 0x58, 0x58, 0x58, 0xff, 0x63, 0x63, 0x63, 0xff, 0x72, 0x72, 0x72, 0xff, 0x48, 0x48, 0x48, 0xff, 0x49, 0x49, 0x49, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x83, 0x83, 0x83, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x62, 0x62, 0x62, 0xff, 0x83, 0x83, 0x83, 0xff, 0x84, 0x84, 0x84, 0x4b,
+    0x04, 0x04, 0x04, 0x6b, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x18, 0x18, 0x18, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x14, 0x14, 0x14, 0xff, 0x15, 0x15, 0x15, 0xff, 0x18, 0x18, 0x18, 0xff, 0x16, 0x16, 0x16, 0xff, 0x16, 0x16, 0x16, 0xff, 0x11, 0x11, 0x11, 0xff, 0x13, 0x13, 0x13, 0xff, 0x15, 0x15, 0x15, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x13, 0x13, 0x13, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x21, 0x21, 0x21, 0xff, 0x21, 0x21, 0x21, 0xff, 0x27, 0x27, 0x27, 0xff, 0x29, 0x29, 0x29, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x64, 0x64, 0x64, 0xff, 0x53, 0x53, 0x53, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x44, 0x44, 0x44, 0xff, 0x44, 0x44, 0x44, 0xff, 0x37, 0x37, 0x37, 0xff, 0x11, 0x11, 0x11, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x24, 0x24, 0x24, 0xff, 0x20, 0x20, 0x20, 0xff, 0x19, 0x19, 0x19, 0xff, 0x28, 0x28, 0x28, 0xff, 0x65, 0x65, 0x65, 0xff, 0x85, 0x85, 0x85, 0xff, 0x71, 0x71, 0x71, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x70, 0x70, 0x70, 0xff, 0x71, 0x71, 0x71, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x87, 0x87, 0x87, 0xff, 0x87, 0x87, 0x87, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x82, 0x82, 0x82, 0xff, 0x71, 0x71, 0x71, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x46, 0x46, 0x46, 0xff, 0x30, 0x30, 0x30, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x28, 0x28, 0x28, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x93, 0x93, 0x93, 0xff, 0xa6, 0xa6, 0xa6, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xba, 0xba, 0xba, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x20, 0x20, 0x20, 0xff, 0x02, 0x02, 0x02, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x02, 0x02, 0x02, 0xff, 0x26, 0x26, 0x26, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x21, 0x21, 0x21, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x30, 0x30, 0x30, 0xff, 0x34, 0x34, 0x34, 0xff, 0x47, 0x47, 0x47, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x48, 0x48, 0x48, 0xff, 0x45, 0x45, 0x45, 0xff, 0x68, 0x68, 0x68, 0xff, 0x86, 0x86, 0x86, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x63, 0x63, 0x63, 0xff, 0x85, 0x85, 0x85, 0xff, 0x85, 0x85, 0x85, 0x6b,
+    0x05, 0x05, 0x05, 0x8b, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x06, 0x06, 0x06, 0xff, 0x04, 0x04, 0x04, 0xff, 0x16, 0x16, 0x16, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x14, 0x14, 0x14, 0xff, 0x17, 0x17, 0x17, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x10, 0x10, 0x10, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x13, 0x13, 0x13, 0xff, 0x19, 0x19, 0x19, 0xff, 0x13, 0x13, 0x13, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x19, 0x19, 0x19, 0xff, 0x21, 0x21, 0x21, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x28, 0x28, 0x28, 0xff, 0x13, 0x13, 0x13, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x61, 0x61, 0x61, 0xff, 0x54, 0x54, 0x54, 0xff, 0x53, 0x53, 0x53, 0xff, 0x49, 0x49, 0x49, 0xff, 0x46, 0x46, 0x46, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x34, 0x34, 0x34, 0xff, 0x13, 0x13, 0x13, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x21, 0x21, 0x21, 0xff, 0x21, 0x21, 0x21, 0xff, 0x29, 0x29, 0x29, 0xff, 0x68, 0x68, 0x68, 0xff, 0x84, 0x84, 0x84, 0xff, 0x74, 0x74, 0x74, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x86, 0x86, 0x86, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x83, 0x83, 0x83, 0xff, 0x72, 0x72, 0x72, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x25, 0x25, 0x25, 0xff, 0x29, 0x29, 0x29, 0xff, 0x32, 0x32, 0x32, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x39, 0x39, 0x39, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x9a, 0x9a, 0x9a, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xae, 0xae, 0xae, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0x74, 0x74, 0x74, 0xff, 0x09, 0x09, 0x09, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x05, 0x05, 0x05, 0xff, 0x24, 0x24, 0x24, 0xff, 0x35, 0x35, 0x35, 0xff, 0x22, 0x22, 0x22, 0xff, 0x34, 0x34, 0x34, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x35, 0x35, 0x35, 0xff, 0x50, 0x50, 0x50, 0xff, 0x62, 0x62, 0x62, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x54, 0x54, 0x54, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x64, 0x64, 0x64, 0xff, 0x86, 0x86, 0x86, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x68, 0x68, 0x68, 0xff, 0x86, 0x86, 0x86, 0xff, 0x84, 0x84, 0x84, 0x8b,
+    0x04, 0x04, 0x04, 0xaa, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x04, 0x04, 0x04, 0xff, 0x01, 0x01, 0x01, 0xff, 0x15, 0x15, 0x15, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x17, 0x17, 0x17, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x13, 0x13, 0x13, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x12, 0x12, 0x12, 0xff, 0x17, 0x17, 0x17, 0xff, 0x11, 0x11, 0x11, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x10, 0x10, 0x10, 0xff, 0x25, 0x25, 0x25, 0xff, 0x24, 0x24, 0x24, 0xff, 0x11, 0x11, 0x11, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x24, 0x24, 0x24, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x44, 0x44, 0x44, 0xff, 0x61, 0x61, 0x61, 0xff, 0x50, 0x50, 0x50, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x48, 0x48, 0x48, 0xff, 0x49, 0x49, 0x49, 0xff, 0x36, 0x36, 0x36, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x21, 0x21, 0x21, 0xff, 0x20, 0x20, 0x20, 0xff, 0x28, 0x28, 0x28, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x74, 0x74, 0x74, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x68, 0x68, 0x68, 0xff, 0x68, 0x68, 0x68, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x77, 0x77, 0x77, 0xff, 0x83, 0x83, 0x83, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x91, 0x91, 0x91, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x71, 0x71, 0x71, 0xff, 0x55, 0x55, 0x55, 0xff, 0x33, 0x33, 0x33, 0xff, 0x22, 0x22, 0x22, 0xff, 0x32, 0x32, 0x32, 0xff, 0x39, 0x39, 0x39, 0xff, 0x32, 0x32, 0x32, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x37, 0x37, 0x37, 0xff, 0x56, 0x56, 0x56, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x9a, 0x9a, 0x9a, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0x54, 0x54, 0x54, 0xff, 0x01, 0x01, 0x01, 0xff, 0x09, 0x09, 0x09, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x25, 0x25, 0x25, 0xff, 0x29, 0x29, 0x29, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x42, 0x42, 0x42, 0xff, 0x33, 0x33, 0x33, 0xff, 0x36, 0x36, 0x36, 0xff, 0x50, 0x50, 0x50, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x56, 0x56, 0x56, 0xff, 0x90, 0x90, 0x90, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x58, 0x58, 0x58, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x82, 0x82, 0x82, 0xff, 0x60, 0x60, 0x60, 0xff, 0x69, 0x69, 0x69, 0xff, 0x85, 0x85, 0x85, 0xff, 0x86, 0x86, 0x86, 0xab,
+    0x04, 0x04, 0x04, 0xbe, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x14, 0x14, 0x14, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x17, 0x17, 0x17, 0xff, 0x15, 0x15, 0x15, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x10, 0x10, 0x10, 0xff, 0x16, 0x16, 0x16, 0xff, 0x18, 0x18, 0x18, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x12, 0x12, 0x12, 0xff, 0x11, 0x11, 0x11, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x12, 0x12, 0x12, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x28, 0x28, 0x28, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x22, 0x22, 0x22, 0xff, 0x41, 0x41, 0x41, 0xff, 0x60, 0x60, 0x60, 0xff, 0x56, 0x56, 0x56, 0xff, 0x52, 0x52, 0x52, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x21, 0x21, 0x21, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x28, 0x28, 0x28, 0xff, 0x74, 0x74, 0x74, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x70, 0x70, 0x70, 0xff, 0x68, 0x68, 0x68, 0xff, 0x65, 0x65, 0x65, 0xff, 0x67, 0x67, 0x67, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x77, 0x77, 0x77, 0xff, 0x86, 0x86, 0x86, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x90, 0x90, 0x90, 0xff, 0x98, 0x98, 0x98, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x72, 0x72, 0x72, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x24, 0x24, 0x24, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x36, 0x36, 0x36, 0xff, 0x30, 0x30, 0x30, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x37, 0x37, 0x37, 0xff, 0x51, 0x51, 0x51, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x9c, 0x9c, 0x9c, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xca, 0xca, 0xca, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xa2, 0xa2, 0xa2, 0xff, 0x31, 0x31, 0x31, 0xff, 0x05, 0x05, 0x05, 0xff, 0x09, 0x09, 0x09, 0xff, 0x05, 0x05, 0x05, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x25, 0x25, 0x25, 0xff, 0x25, 0x25, 0x25, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x30, 0x30, 0x30, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x82, 0x82, 0x82, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x31, 0x31, 0x31, 0xff, 0x61, 0x61, 0x61, 0xff, 0x59, 0x59, 0x59, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x65, 0x65, 0x65, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x87, 0x87, 0x87, 0xff, 0x87, 0x87, 0x87, 0xbe,
+    0x03, 0x03, 0x03, 0xd3, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x15, 0x15, 0x15, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x10, 0x10, 0x10, 0xff, 0x19, 0x19, 0x19, 0xff, 0x16, 0x16, 0x16, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x12, 0x12, 0x12, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x28, 0x28, 0x28, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x13, 0x13, 0x13, 0xff, 0x19, 0x19, 0x19, 0xff, 0x22, 0x22, 0x22, 0xff, 0x24, 0x24, 0x24, 0xff, 0x34, 0x34, 0x34, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x40, 0x40, 0x40, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x59, 0x59, 0x59, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x47, 0x47, 0x47, 0xff, 0x47, 0x47, 0x47, 0xff, 0x51, 0x51, 0x51, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x22, 0x22, 0x22, 0xff, 0x22, 0x22, 0x22, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x75, 0x75, 0x75, 0xff, 0x78, 0x78, 0x78, 0xff, 0x70, 0x70, 0x70, 0xff, 0x65, 0x65, 0x65, 0xff, 0x65, 0x65, 0x65, 0xff, 0x66, 0x66, 0x66, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x77, 0x77, 0x77, 0xff, 0x85, 0x85, 0x85, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x93, 0x93, 0x93, 0xff, 0x98, 0x98, 0x98, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x75, 0x75, 0x75, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x20, 0x20, 0x20, 0xff, 0x31, 0x31, 0x31, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x45, 0x45, 0x45, 0xff, 0x43, 0x43, 0x43, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x70, 0x70, 0x70, 0xff, 0x98, 0x98, 0x98, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xba, 0xba, 0xba, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0x78, 0x78, 0x78, 0xff, 0x10, 0x10, 0x10, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x08, 0x08, 0x08, 0xff, 0x02, 0x02, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x14, 0x14, 0x14, 0xff, 0x27, 0x27, 0x27, 0xff, 0x25, 0x25, 0x25, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x41, 0x41, 0x41, 0xff, 0x24, 0x24, 0x24, 0xff, 0x33, 0x33, 0x33, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x58, 0x58, 0x58, 0xff, 0x76, 0x76, 0x76, 0xff, 0x66, 0x66, 0x66, 0xff, 0x28, 0x28, 0x28, 0xff, 0x30, 0x30, 0x30, 0xff, 0x57, 0x57, 0x57, 0xff, 0x57, 0x57, 0x57, 0xff, 0x71, 0x71, 0x71, 0xff, 0x64, 0x64, 0x64, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x8c, 0x8c, 0x8c, 0xd3,
+    0x04, 0x04, 0x04, 0xe7, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x11, 0x11, 0x11, 0xff, 0x20, 0x20, 0x20, 0xff, 0x10, 0x10, 0x10, 0xff, 0x17, 0x17, 0x17, 0xff, 0x17, 0x17, 0x17, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x11, 0x11, 0x11, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x18, 0x18, 0x18, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x23, 0x23, 0x23, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x26, 0x26, 0x26, 0xff, 0x12, 0x12, 0x12, 0xff, 0x24, 0x24, 0x24, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x13, 0x13, 0x13, 0xff, 0x32, 0x32, 0x32, 0xff, 0x24, 0x24, 0x24, 0xff, 0x44, 0x44, 0x44, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x54, 0x54, 0x54, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x45, 0x45, 0x45, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x51, 0x51, 0x51, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x18, 0x18, 0x18, 0xff, 0x21, 0x21, 0x21, 0xff, 0x24, 0x24, 0x24, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x37, 0x37, 0x37, 0xff, 0x76, 0x76, 0x76, 0xff, 0x78, 0x78, 0x78, 0xff, 0x78, 0x78, 0x78, 0xff, 0x63, 0x63, 0x63, 0xff, 0x64, 0x64, 0x64, 0xff, 0x65, 0x65, 0x65, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x74, 0x74, 0x74, 0xff, 0x84, 0x84, 0x84, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x93, 0x93, 0x93, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x87, 0x87, 0x87, 0xff, 0x78, 0x78, 0x78, 0xff, 0x52, 0x52, 0x52, 0xff, 0x21, 0x21, 0x21, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x76, 0x76, 0x76, 0xff, 0x56, 0x56, 0x56, 0xff, 0x26, 0x26, 0x26, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x45, 0x45, 0x45, 0xff, 0x43, 0x43, 0x43, 0xff, 0x57, 0x57, 0x57, 0xff, 0x90, 0x90, 0x90, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xae, 0xae, 0xae, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xba, 0xba, 0xba, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xac, 0xac, 0xac, 0xff, 0xad, 0xad, 0xad, 0xff, 0x43, 0x43, 0x43, 0xff, 0x01, 0x01, 0x01, 0xff, 0x11, 0x11, 0x11, 0xff, 0x09, 0x09, 0x09, 0xff, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x31, 0x31, 0x31, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x29, 0x29, 0x29, 0xff, 0x36, 0x36, 0x36, 0xff, 0x53, 0x53, 0x53, 0xff, 0x61, 0x61, 0x61, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x56, 0x56, 0x56, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x56, 0x56, 0x56, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x63, 0x63, 0x63, 0xff, 0x63, 0x63, 0x63, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x8c, 0x8c, 0x8c, 0xe6,
+    0x04, 0x04, 0x04, 0xf0, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x02, 0x02, 0x02, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x13, 0x13, 0x13, 0xff, 0x15, 0x15, 0x15, 0xff, 0x13, 0x13, 0x13, 0xff, 0x11, 0x11, 0x11, 0xff, 0x11, 0x11, 0x11, 0xff, 0x11, 0x11, 0x11, 0xff, 0x22, 0x22, 0x22, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x12, 0x12, 0x12, 0xff, 0x20, 0x20, 0x20, 0xff, 0x27, 0x27, 0x27, 0xff, 0x34, 0x34, 0x34, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x13, 0x13, 0x13, 0xff, 0x28, 0x28, 0x28, 0xff, 0x30, 0x30, 0x30, 0xff, 0x51, 0x51, 0x51, 0xff, 0x62, 0x62, 0x62, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x51, 0x51, 0x51, 0xff, 0x51, 0x51, 0x51, 0xff, 0x44, 0x44, 0x44, 0xff, 0x22, 0x22, 0x22, 0xff, 0x16, 0x16, 0x16, 0xff, 0x20, 0x20, 0x20, 0xff, 0x22, 0x22, 0x22, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x42, 0x42, 0x42, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x73, 0x73, 0x73, 0xff, 0x78, 0x78, 0x78, 0xff, 0x63, 0x63, 0x63, 0xff, 0x60, 0x60, 0x60, 0xff, 0x64, 0x64, 0x64, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x71, 0x71, 0x71, 0xff, 0x82, 0x82, 0x82, 0xff, 0x89, 0x89, 0x89, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x84, 0x84, 0x84, 0xff, 0x79, 0x79, 0x79, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x59, 0x59, 0x59, 0xff, 0x35, 0x35, 0x35, 0xff, 0x27, 0x27, 0x27, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x22, 0x22, 0x22, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x19, 0x19, 0x19, 0xff, 0x34, 0x34, 0x34, 0xff, 0x57, 0x57, 0x57, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xae, 0xae, 0xae, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x18, 0x18, 0x18, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x12, 0x12, 0x12, 0xff, 0x32, 0x32, 0x32, 0xff, 0x31, 0x31, 0x31, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x37, 0x37, 0x37, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x87, 0x87, 0x87, 0xff, 0x53, 0x53, 0x53, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x40, 0x40, 0x40, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x63, 0x63, 0x63, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x60, 0x60, 0x60, 0xff, 0x72, 0x72, 0x72, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x8a, 0x8a, 0x8a, 0xf0,
+    0x04, 0x04, 0x04, 0xf3, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x05, 0x05, 0x05, 0xff, 0x02, 0x02, 0x02, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x09, 0x09, 0x09, 0xff, 0x21, 0x21, 0x21, 0xff, 0x16, 0x16, 0x16, 0xff, 0x15, 0x15, 0x15, 0xff, 0x14, 0x14, 0x14, 0xff, 0x13, 0x13, 0x13, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x14, 0x14, 0x14, 0xff, 0x27, 0x27, 0x27, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x19, 0x19, 0x19, 0xff, 0x20, 0x20, 0x20, 0xff, 0x32, 0x32, 0x32, 0xff, 0x30, 0x30, 0x30, 0xff, 0x18, 0x18, 0x18, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x28, 0x28, 0x28, 0xff, 0x25, 0x25, 0x25, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x24, 0x24, 0x24, 0xff, 0x30, 0x30, 0x30, 0xff, 0x53, 0x53, 0x53, 0xff, 0x66, 0x66, 0x66, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x48, 0x48, 0x48, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x47, 0x47, 0x47, 0xff, 0x27, 0x27, 0x27, 0xff, 0x16, 0x16, 0x16, 0xff, 0x23, 0x23, 0x23, 0xff, 0x25, 0x25, 0x25, 0xff, 0x19, 0x19, 0x19, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x69, 0x69, 0x69, 0xff, 0x70, 0x70, 0x70, 0xff, 0x63, 0x63, 0x63, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xff, 0x64, 0x64, 0x64, 0xff, 0x70, 0x70, 0x70, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x78, 0x78, 0x78, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x66, 0x66, 0x66, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x24, 0x24, 0x24, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x34, 0x34, 0x34, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x70, 0x70, 0x70, 0xff, 0x94, 0x94, 0x94, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0x9d, 0x9d, 0x9d, 0xff, 0x70, 0x70, 0x70, 0xff, 0x9a, 0x9a, 0x9a, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xa6, 0xa6, 0xa6, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0x55, 0x55, 0x55, 0xff, 0x06, 0x06, 0x06, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x02, 0x02, 0x02, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x27, 0x27, 0x27, 0xff, 0x19, 0x19, 0x19, 0xff, 0x31, 0x31, 0x31, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x36, 0x36, 0x36, 0xff, 0x20, 0x20, 0x20, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x53, 0x53, 0x53, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x85, 0x85, 0x85, 0xff, 0x53, 0x53, 0x53, 0xff, 0x28, 0x28, 0x28, 0xff, 0x36, 0x36, 0x36, 0xff, 0x58, 0x58, 0x58, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x74, 0x74, 0x74, 0xff, 0x91, 0x91, 0x91, 0xff, 0x89, 0x89, 0x89, 0xf3,
+    0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x15, 0x15, 0x15, 0xff, 0x16, 0x16, 0x16, 0xff, 0x14, 0x14, 0x14, 0xff, 0x11, 0x11, 0x11, 0xff, 0x17, 0x17, 0x17, 0xff, 0x25, 0x25, 0x25, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x28, 0x28, 0x28, 0xff, 0x21, 0x21, 0x21, 0xff, 0x33, 0x33, 0x33, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x20, 0x20, 0x20, 0xff, 0x19, 0x19, 0x19, 0xff, 0x31, 0x31, 0x31, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x69, 0x69, 0x69, 0xff, 0x47, 0x47, 0x47, 0xff, 0x58, 0x58, 0x58, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x49, 0x49, 0x49, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x43, 0x43, 0x43, 0xff, 0x24, 0x24, 0x24, 0xff, 0x18, 0x18, 0x18, 0xff, 0x23, 0x23, 0x23, 0xff, 0x24, 0x24, 0x24, 0xff, 0x18, 0x18, 0x18, 0xff, 0x52, 0x52, 0x52, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x70, 0x70, 0x70, 0xff, 0x60, 0x60, 0x60, 0xff, 0x61, 0x61, 0x61, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x67, 0x67, 0x67, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x73, 0x73, 0x73, 0xff, 0x71, 0x71, 0x71, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x67, 0x67, 0x67, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x29, 0x29, 0x29, 0xff, 0x20, 0x20, 0x20, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x57, 0x57, 0x57, 0xff, 0x56, 0x56, 0x56, 0xff, 0x81, 0x81, 0x81, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x74, 0x74, 0x74, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xad, 0xad, 0xad, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xae, 0xae, 0xae, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xae, 0xae, 0xae, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0x88, 0x88, 0x88, 0xff, 0x21, 0x21, 0x21, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x01, 0x01, 0x01, 0xff, 0x09, 0x09, 0x09, 0xff, 0x38, 0x38, 0x38, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x33, 0x33, 0x33, 0xff, 0x31, 0x31, 0x31, 0xff, 0x31, 0x31, 0x31, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x42, 0x42, 0x42, 0xff, 0x52, 0x52, 0x52, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x34, 0x34, 0x34, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x52, 0x52, 0x52, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x94, 0x94, 0x94, 0xff, 0x8a, 0x8a, 0x8a, 0xff,
+    0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x04, 0x04, 0x04, 0xff, 0x08, 0x08, 0x08, 0xff, 0x06, 0x06, 0x06, 0xff, 0x16, 0x16, 0x16, 0xff, 0x27, 0x27, 0x27, 0xff, 0x19, 0x19, 0x19, 0xff, 0x17, 0x17, 0x17, 0xff, 0x19, 0x19, 0x19, 0xff, 0x16, 0x16, 0x16, 0xff, 0x17, 0x17, 0x17, 0xff, 0x21, 0x21, 0x21, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x24, 0x24, 0x24, 0xff, 0x36, 0x36, 0x36, 0xff, 0x34, 0x34, 0x34, 0xff, 0x22, 0x22, 0x22, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x30, 0x30, 0x30, 0xff, 0x16, 0x16, 0x16, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x25, 0x25, 0x25, 0xff, 0x16, 0x16, 0x16, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x54, 0x54, 0x54, 0xff, 0x64, 0x64, 0x64, 0xff, 0x40, 0x40, 0x40, 0xff, 0x56, 0x56, 0x56, 0xff, 0x52, 0x52, 0x52, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x46, 0x46, 0x46, 0xff, 0x24, 0x24, 0x24, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x25, 0x25, 0x25, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x17, 0x17, 0x17, 0xff, 0x52, 0x52, 0x52, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x60, 0x60, 0x60, 0xff, 0x53, 0x53, 0x53, 0xff, 0x56, 0x56, 0x56, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x66, 0x66, 0x66, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x68, 0x68, 0x68, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x52, 0x52, 0x52, 0xff, 0x49, 0x49, 0x49, 0xff, 0x39, 0x39, 0x39, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x85, 0x85, 0x85, 0xff, 0x93, 0x93, 0x93, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x90, 0x90, 0x90, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xac, 0xac, 0xac, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x03, 0x03, 0x03, 0xff, 0x17, 0x17, 0x17, 0xff, 0x08, 0x08, 0x08, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x25, 0x25, 0x25, 0xff, 0x31, 0x31, 0x31, 0xff, 0x36, 0x36, 0x36, 0xff, 0x37, 0x37, 0x37, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x42, 0x42, 0x42, 0xff, 0x53, 0x53, 0x53, 0xff, 0x81, 0x81, 0x81, 0xff, 0x88, 0x88, 0x88, 0xff, 0x47, 0x47, 0x47, 0xff, 0x37, 0x37, 0x37, 0xff, 0x30, 0x30, 0x30, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x66, 0x66, 0x66, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x91, 0x91, 0x91, 0xff, 0x8b, 0x8b, 0x8b, 0xff,
+    0x04, 0x04, 0x04, 0xf3, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x23, 0x23, 0x23, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x19, 0x19, 0x19, 0xff, 0x19, 0x19, 0x19, 0xff, 0x10, 0x10, 0x10, 0xff, 0x10, 0x10, 0x10, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x27, 0x27, 0x27, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x24, 0x24, 0x24, 0xff, 0x35, 0x35, 0x35, 0xff, 0x26, 0x26, 0x26, 0xff, 0x17, 0x17, 0x17, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x15, 0x15, 0x15, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x49, 0x49, 0x49, 0xff, 0x67, 0x67, 0x67, 0xff, 0x39, 0x39, 0x39, 0xff, 0x54, 0x54, 0x54, 0xff, 0x53, 0x53, 0x53, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x54, 0x54, 0x54, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x17, 0x17, 0x17, 0xff, 0x23, 0x23, 0x23, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x59, 0x59, 0x59, 0xff, 0x78, 0x78, 0x78, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x59, 0x59, 0x59, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x54, 0x54, 0x54, 0xff, 0x60, 0x60, 0x60, 0xff, 0x68, 0x68, 0x68, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x71, 0x71, 0x71, 0xff, 0x70, 0x70, 0x70, 0xff, 0x65, 0x65, 0x65, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x56, 0x56, 0x56, 0xff, 0x51, 0x51, 0x51, 0xff, 0x44, 0x44, 0x44, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x68, 0x68, 0x68, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xae, 0xae, 0xae, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x80, 0x80, 0x80, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xba, 0xba, 0xba, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xae, 0xae, 0xae, 0xff, 0xa6, 0xa6, 0xa6, 0xff, 0x85, 0x85, 0x85, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x11, 0x11, 0x11, 0xff, 0x11, 0x11, 0x11, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x40, 0x40, 0x40, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x22, 0x22, 0x22, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x43, 0x43, 0x43, 0xff, 0x55, 0x55, 0x55, 0xff, 0x86, 0x86, 0x86, 0xff, 0x84, 0x84, 0x84, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x33, 0x33, 0x33, 0xff, 0x38, 0x38, 0x38, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x63, 0x63, 0x63, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x77, 0x77, 0x77, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x8d, 0x8d, 0x8d, 0xf3,
+    0x04, 0x04, 0x04, 0xf0, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x08, 0x08, 0x08, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x19, 0x19, 0x19, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x34, 0x34, 0x34, 0xff, 0x38, 0x38, 0x38, 0xff, 0x26, 0x26, 0x26, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x34, 0x34, 0x34, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x21, 0x21, 0x21, 0xff, 0x16, 0x16, 0x16, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x32, 0x32, 0x32, 0xff, 0x71, 0x71, 0x71, 0xff, 0x39, 0x39, 0x39, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x52, 0x52, 0x52, 0xff, 0x48, 0x48, 0x48, 0xff, 0x57, 0x57, 0x57, 0xff, 0x57, 0x57, 0x57, 0xff, 0x31, 0x31, 0x31, 0xff, 0x17, 0x17, 0x17, 0xff, 0x23, 0x23, 0x23, 0xff, 0x23, 0x23, 0x23, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x77, 0x77, 0x77, 0xff, 0x72, 0x72, 0x72, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x51, 0x51, 0x51, 0xff, 0x59, 0x59, 0x59, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x53, 0x53, 0x53, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x68, 0x68, 0x68, 0xff, 0x70, 0x70, 0x70, 0xff, 0x71, 0x71, 0x71, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x60, 0x60, 0x60, 0xff, 0x57, 0x57, 0x57, 0xff, 0x55, 0x55, 0x55, 0xff, 0x53, 0x53, 0x53, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x80, 0x80, 0x80, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0x62, 0x62, 0x62, 0xff, 0x71, 0x71, 0x71, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x15, 0x15, 0x15, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x10, 0x10, 0x10, 0xff, 0x16, 0x16, 0x16, 0xff, 0x12, 0x12, 0x12, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x09, 0x09, 0x09, 0xff, 0x32, 0x32, 0x32, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x45, 0x45, 0x45, 0xff, 0x56, 0x56, 0x56, 0xff, 0x83, 0x83, 0x83, 0xff, 0x71, 0x71, 0x71, 0xff, 0x60, 0x60, 0x60, 0xff, 0x34, 0x34, 0x34, 0xff, 0x35, 0x35, 0x35, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x59, 0x59, 0x59, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x89, 0x89, 0x89, 0xff, 0x8f, 0x8f, 0x8f, 0xf0,
+    0x04, 0x04, 0x04, 0xe7, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x05, 0x05, 0x05, 0xff, 0x18, 0x18, 0x18, 0xff, 0x28, 0x28, 0x28, 0xff, 0x21, 0x21, 0x21, 0xff, 0x17, 0x17, 0x17, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x12, 0x12, 0x12, 0xff, 0x21, 0x21, 0x21, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x43, 0x43, 0x43, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x22, 0x22, 0x22, 0xff, 0x38, 0x38, 0x38, 0xff, 0x35, 0x35, 0x35, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x22, 0x22, 0x22, 0xff, 0x23, 0x23, 0x23, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x00, 0x00, 0x00, 0xff, 0x19, 0x19, 0x19, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x53, 0x53, 0x53, 0xff, 0x23, 0x23, 0x23, 0xff, 0x56, 0x56, 0x56, 0xff, 0x48, 0x48, 0x48, 0xff, 0x53, 0x53, 0x53, 0xff, 0x54, 0x54, 0x54, 0xff, 0x35, 0x35, 0x35, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x23, 0x23, 0x23, 0xff, 0x23, 0x23, 0x23, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x73, 0x73, 0x73, 0xff, 0x76, 0x76, 0x76, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x56, 0x56, 0x56, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x55, 0x55, 0x55, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x56, 0x56, 0x56, 0xff, 0x54, 0x54, 0x54, 0xff, 0x50, 0x50, 0x50, 0xff, 0x52, 0x52, 0x52, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x90, 0x90, 0x90, 0xff, 0xba, 0xba, 0xba, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xba, 0xba, 0xba, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0x84, 0x84, 0x84, 0xff, 0x11, 0x11, 0x11, 0xff, 0x07, 0x07, 0x07, 0xff, 0x11, 0x11, 0x11, 0xff, 0x18, 0x18, 0x18, 0xff, 0x14, 0x14, 0x14, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x18, 0x18, 0x18, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x09, 0x09, 0x09, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x37, 0x37, 0x37, 0xff, 0x26, 0x26, 0x26, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x69, 0x69, 0x69, 0xff, 0x43, 0x43, 0x43, 0xff, 0x36, 0x36, 0x36, 0xff, 0x49, 0x49, 0x49, 0xff, 0x68, 0x68, 0x68, 0xff, 0x58, 0x58, 0x58, 0xff, 0x61, 0x61, 0x61, 0xff, 0x67, 0x67, 0x67, 0xff, 0x80, 0x80, 0x80, 0xff, 0x8a, 0x8a, 0x8a, 0xe6,
+    0x03, 0x03, 0x03, 0xd3, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x25, 0x25, 0x25, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x44, 0x44, 0x44, 0xff, 0x29, 0x29, 0x29, 0xff, 0x26, 0x26, 0x26, 0xff, 0x38, 0x38, 0x38, 0xff, 0x33, 0x33, 0x33, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x24, 0x24, 0x24, 0xff, 0x22, 0x22, 0x22, 0xff, 0x11, 0x11, 0x11, 0xff, 0x04, 0x04, 0x04, 0xff, 0x18, 0x18, 0x18, 0xff, 0x58, 0x58, 0x58, 0xff, 0x73, 0x73, 0x73, 0xff, 0x26, 0x26, 0x26, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x50, 0x50, 0x50, 0xff, 0x59, 0x59, 0x59, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x26, 0x26, 0x26, 0xff, 0x25, 0x25, 0x25, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x71, 0x71, 0x71, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x59, 0x59, 0x59, 0xff, 0x51, 0x51, 0x51, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x75, 0x75, 0x75, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x52, 0x52, 0x52, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x53, 0x53, 0x53, 0xff, 0x60, 0x60, 0x60, 0xff, 0x68, 0x68, 0x68, 0xff, 0x74, 0x74, 0x74, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0xac, 0xac, 0xac, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0x92, 0x92, 0x92, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xba, 0xba, 0xba, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0x45, 0x45, 0x45, 0xff, 0x00, 0x00, 0x00, 0xff, 0x13, 0x13, 0x13, 0xff, 0x10, 0x10, 0x10, 0xff, 0x18, 0x18, 0x18, 0xff, 0x19, 0x19, 0x19, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x10, 0x10, 0x10, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x34, 0x34, 0x34, 0xff, 0x39, 0x39, 0x39, 0xff, 0x36, 0x36, 0x36, 0xff, 0x27, 0x27, 0x27, 0xff, 0x24, 0x24, 0x24, 0xff, 0x47, 0x47, 0x47, 0xff, 0x61, 0x61, 0x61, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x45, 0x45, 0x45, 0xff, 0x57, 0x57, 0x57, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x37, 0x37, 0x37, 0xff, 0x46, 0x46, 0x46, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x68, 0x68, 0x68, 0xff, 0x74, 0x74, 0x74, 0xff, 0x86, 0x86, 0x86, 0xd3,
+    0x04, 0x04, 0x04, 0xbe, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x08, 0x08, 0x08, 0xff, 0x09, 0x09, 0x09, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x26, 0x26, 0x26, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x12, 0x12, 0x12, 0xff, 0x10, 0x10, 0x10, 0xff, 0x19, 0x19, 0x19, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x28, 0x28, 0x28, 0xff, 0x25, 0x25, 0x25, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x27, 0x27, 0x27, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x11, 0x11, 0x11, 0xff, 0x08, 0x08, 0x08, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x43, 0x43, 0x43, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x33, 0x33, 0x33, 0xff, 0x32, 0x32, 0x32, 0xff, 0x55, 0x55, 0x55, 0xff, 0x49, 0x49, 0x49, 0xff, 0x58, 0x58, 0x58, 0xff, 0x47, 0x47, 0x47, 0xff, 0x20, 0x20, 0x20, 0xff, 0x23, 0x23, 0x23, 0xff, 0x27, 0x27, 0x27, 0xff, 0x23, 0x23, 0x23, 0xff, 0x74, 0x74, 0x74, 0xff, 0x70, 0x70, 0x70, 0xff, 0x80, 0x80, 0x80, 0xff, 0x69, 0x69, 0x69, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x71, 0x71, 0x71, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x72, 0x72, 0x72, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x45, 0x45, 0x45, 0xff, 0x44, 0x44, 0x44, 0xff, 0x41, 0x41, 0x41, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x57, 0x57, 0x57, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x65, 0x65, 0x65, 0xff, 0x86, 0x86, 0x86, 0xff, 0xa6, 0xa6, 0xa6, 0xff, 0x89, 0x89, 0x89, 0xff, 0x9a, 0x9a, 0x9a, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0x83, 0x83, 0x83, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x12, 0x12, 0x12, 0xff, 0x12, 0x12, 0x12, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x26, 0x26, 0x26, 0xff, 0x16, 0x16, 0x16, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x15, 0x15, 0x15, 0xff, 0x34, 0x34, 0x34, 0xff, 0x35, 0x35, 0x35, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x19, 0x19, 0x19, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x48, 0x48, 0x48, 0xff, 0x72, 0x72, 0x72, 0xff, 0x88, 0x88, 0x88, 0xff, 0x43, 0x43, 0x43, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x37, 0x37, 0x37, 0xff, 0x46, 0x46, 0x46, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x75, 0x75, 0x75, 0xff, 0x68, 0x68, 0x68, 0xff, 0x69, 0x69, 0x69, 0xff, 0x83, 0x83, 0x83, 0xbe,
+    0x04, 0x04, 0x04, 0xaa, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x09, 0x09, 0x09, 0xff, 0x07, 0x07, 0x07, 0xff, 0x09, 0x09, 0x09, 0xff, 0x18, 0x18, 0x18, 0xff, 0x24, 0x24, 0x24, 0xff, 0x18, 0x18, 0x18, 0xff, 0x11, 0x11, 0x11, 0xff, 0x16, 0x16, 0x16, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x31, 0x31, 0x31, 0xff, 0x18, 0x18, 0x18, 0xff, 0x20, 0x20, 0x20, 0xff, 0x29, 0x29, 0x29, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x29, 0x29, 0x29, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x75, 0x75, 0x75, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x52, 0x52, 0x52, 0xff, 0x47, 0x47, 0x47, 0xff, 0x59, 0x59, 0x59, 0xff, 0x59, 0x59, 0x59, 0xff, 0x26, 0x26, 0x26, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x25, 0x25, 0x25, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x84, 0x84, 0x84, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x54, 0x54, 0x54, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x63, 0x63, 0x63, 0xff, 0x64, 0x64, 0x64, 0xff, 0x79, 0x79, 0x79, 0xff, 0x57, 0x57, 0x57, 0xff, 0x25, 0x25, 0x25, 0xff, 0x27, 0x27, 0x27, 0xff, 0x38, 0x38, 0x38, 0xff, 0x47, 0x47, 0x47, 0xff, 0x58, 0x58, 0x58, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x66, 0x66, 0x66, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x67, 0x67, 0x67, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x76, 0x76, 0x76, 0xff, 0x80, 0x80, 0x80, 0xff, 0x89, 0x89, 0x89, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xba, 0xba, 0xba, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x00, 0x00, 0x00, 0xff, 0x03, 0x03, 0x03, 0xff, 0x11, 0x11, 0x11, 0xff, 0x16, 0x16, 0x16, 0xff, 0x17, 0x17, 0x17, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x34, 0x34, 0x34, 0xff, 0x17, 0x17, 0x17, 0xff, 0x08, 0x08, 0x08, 0xff, 0x19, 0x19, 0x19, 0xff, 0x32, 0x32, 0x32, 0xff, 0x40, 0x40, 0x40, 0xff, 0x30, 0x30, 0x30, 0xff, 0x11, 0x11, 0x11, 0xff, 0x27, 0x27, 0x27, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x77, 0x77, 0x77, 0xff, 0x85, 0x85, 0x85, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x69, 0x69, 0x69, 0xff, 0x71, 0x71, 0x71, 0xff, 0x69, 0x69, 0x69, 0xff, 0x65, 0x65, 0x65, 0xff, 0x84, 0x84, 0x84, 0xab,
+    0x03, 0x03, 0x03, 0x8b, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x21, 0x21, 0x21, 0xff, 0x13, 0x13, 0x13, 0xff, 0x18, 0x18, 0x18, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x30, 0x30, 0x30, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x23, 0x23, 0x23, 0xff, 0x23, 0x23, 0x23, 0xff, 0x23, 0x23, 0x23, 0xff, 0x24, 0x24, 0x24, 0xff, 0x14, 0x14, 0x14, 0xff, 0x12, 0x12, 0x12, 0xff, 0x33, 0x33, 0x33, 0xff, 0x20, 0x20, 0x20, 0xff, 0x50, 0x50, 0x50, 0xff, 0x80, 0x80, 0x80, 0xff, 0x16, 0x16, 0x16, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x50, 0x50, 0x50, 0xff, 0x64, 0x64, 0x64, 0xff, 0x31, 0x31, 0x31, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x26, 0x26, 0x26, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x88, 0x88, 0x88, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x56, 0x56, 0x56, 0xff, 0x62, 0x62, 0x62, 0xff, 0x66, 0x66, 0x66, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x17, 0x17, 0x17, 0xff, 0x06, 0x06, 0x06, 0xff, 0x17, 0x17, 0x17, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x43, 0x43, 0x43, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x43, 0x43, 0x43, 0xff, 0x61, 0x61, 0x61, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x87, 0x87, 0x87, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xff, 0x71, 0x71, 0x71, 0xff, 0x88, 0x88, 0x88, 0xff, 0x83, 0x83, 0x83, 0xff, 0x81, 0x81, 0x81, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0x82, 0x82, 0x82, 0xff, 0x13, 0x13, 0x13, 0xff, 0x01, 0x01, 0x01, 0xff, 0x08, 0x08, 0x08, 0xff, 0x12, 0x12, 0x12, 0xff, 0x17, 0x17, 0x17, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x38, 0x38, 0x38, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x41, 0x41, 0x41, 0xff, 0x40, 0x40, 0x40, 0xff, 0x20, 0x20, 0x20, 0xff, 0x15, 0x15, 0x15, 0xff, 0x34, 0x34, 0x34, 0xff, 0x56, 0x56, 0x56, 0xff, 0x79, 0x79, 0x79, 0xff, 0x74, 0x74, 0x74, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x70, 0x70, 0x70, 0xff, 0x49, 0x49, 0x49, 0xff, 0x34, 0x34, 0x34, 0xff, 0x62, 0x62, 0x62, 0xff, 0x67, 0x67, 0x67, 0xff, 0x58, 0x58, 0x58, 0xff, 0x67, 0x67, 0x67, 0xff, 0x67, 0x67, 0x67, 0xff, 0x7e, 0x7e, 0x7e, 0x8b,
+    0x04, 0x04, 0x04, 0x6b, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x18, 0x18, 0x18, 0xff, 0x39, 0x39, 0x39, 0xff, 0x32, 0x32, 0x32, 0xff, 0x31, 0x31, 0x31, 0xff, 0x29, 0x29, 0x29, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x22, 0x22, 0x22, 0xff, 0x26, 0x26, 0x26, 0xff, 0x24, 0x24, 0x24, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x18, 0x18, 0x18, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x33, 0x33, 0x33, 0xff, 0x14, 0x14, 0x14, 0xff, 0x29, 0x29, 0x29, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x12, 0x12, 0x12, 0xff, 0x68, 0x68, 0x68, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x18, 0x18, 0x18, 0xff, 0x23, 0x23, 0x23, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x57, 0x57, 0x57, 0xff, 0x55, 0x55, 0x55, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x69, 0x69, 0x69, 0xff, 0x56, 0x56, 0x56, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x61, 0x61, 0x61, 0xff, 0x52, 0x52, 0x52, 0xff, 0x48, 0x48, 0x48, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x20, 0x20, 0x20, 0xff, 0x21, 0x21, 0x21, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x36, 0x36, 0x36, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x63, 0x63, 0x63, 0xff, 0x64, 0x64, 0x64, 0xff, 0x27, 0x27, 0x27, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x55, 0x55, 0x55, 0xff, 0x43, 0x43, 0x43, 0xff, 0x72, 0x72, 0x72, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x83, 0x83, 0x83, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x00, 0x00, 0x00, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x14, 0x14, 0x14, 0xff, 0x16, 0x16, 0x16, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x29, 0x29, 0x29, 0xff, 0x34, 0x34, 0x34, 0xff, 0x11, 0x11, 0x11, 0xff, 0x26, 0x26, 0x26, 0xff, 0x51, 0x51, 0x51, 0xff, 0x31, 0x31, 0x31, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x19, 0x19, 0x19, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x79, 0x79, 0x79, 0xff, 0x63, 0x63, 0x63, 0xff, 0x51, 0x51, 0x51, 0xff, 0x37, 0x37, 0x37, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x61, 0x61, 0x61, 0xff, 0x30, 0x30, 0x30, 0xff, 0x56, 0x56, 0x56, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x49, 0x49, 0x49, 0xff, 0x60, 0x60, 0x60, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x74, 0x74, 0x74, 0x6b,
+    0x03, 0x03, 0x03, 0x4b, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x19, 0x19, 0x19, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x37, 0x37, 0x37, 0xff, 0x33, 0x33, 0x33, 0xff, 0x27, 0x27, 0x27, 0xff, 0x20, 0x20, 0x20, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x24, 0x24, 0x24, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x16, 0x16, 0x16, 0xff, 0x11, 0x11, 0x11, 0xff, 0x25, 0x25, 0x25, 0xff, 0x36, 0x36, 0x36, 0xff, 0x10, 0x10, 0x10, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x70, 0x70, 0x70, 0xff, 0x76, 0x76, 0x76, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x48, 0x48, 0x48, 0xff, 0x58, 0x58, 0x58, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x52, 0x52, 0x52, 0xff, 0x20, 0x20, 0x20, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x38, 0x38, 0x38, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x51, 0x51, 0x51, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x67, 0x67, 0x67, 0xff, 0x55, 0x55, 0x55, 0xff, 0x55, 0x55, 0x55, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x50, 0x50, 0x50, 0xff, 0x48, 0x48, 0x48, 0xff, 0x42, 0x42, 0x42, 0xff, 0x39, 0x39, 0x39, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x36, 0x36, 0x36, 0xff, 0x42, 0x42, 0x42, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xff, 0x54, 0x54, 0x54, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x47, 0x47, 0x47, 0xff, 0x50, 0x50, 0x50, 0xff, 0x30, 0x30, 0x30, 0xff, 0x10, 0x10, 0x10, 0xff, 0x39, 0x39, 0x39, 0xff, 0x59, 0x59, 0x59, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x87, 0x87, 0x87, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x95, 0x95, 0x95, 0xff, 0xad, 0xad, 0xad, 0xff, 0xae, 0xae, 0xae, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x07, 0x07, 0x07, 0xff, 0x05, 0x05, 0x05, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x16, 0x16, 0x16, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x10, 0x10, 0x10, 0xff, 0x15, 0x15, 0x15, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x25, 0x25, 0x25, 0xff, 0x50, 0x50, 0x50, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x19, 0x19, 0x19, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x66, 0x66, 0x66, 0xff, 0x80, 0x80, 0x80, 0xff, 0x48, 0x48, 0x48, 0xff, 0x37, 0x37, 0x37, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x57, 0x57, 0x57, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x53, 0x53, 0x53, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x53, 0x53, 0x53, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x6c, 0x6c, 0x6c, 0x4b,
+    0x07, 0x07, 0x07, 0x21, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x08, 0x08, 0x08, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x15, 0x15, 0x15, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x17, 0x17, 0x17, 0xff, 0x38, 0x38, 0x38, 0xff, 0x46, 0x46, 0x46, 0xff, 0x35, 0x35, 0x35, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x26, 0x26, 0x26, 0xff, 0x21, 0x21, 0x21, 0xff, 0x19, 0x19, 0x19, 0xff, 0x24, 0x24, 0x24, 0xff, 0x20, 0x20, 0x20, 0xff, 0x13, 0x13, 0x13, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x29, 0x29, 0x29, 0xff, 0x10, 0x10, 0x10, 0xff, 0x05, 0x05, 0x05, 0xff, 0x44, 0x44, 0x44, 0xff, 0x86, 0x86, 0x86, 0xff, 0x47, 0x47, 0x47, 0xff, 0x22, 0x22, 0x22, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x27, 0x27, 0x27, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x52, 0x52, 0x52, 0xff, 0x90, 0x90, 0x90, 0xff, 0x65, 0x65, 0x65, 0xff, 0x56, 0x56, 0x56, 0xff, 0x51, 0x51, 0x51, 0xff, 0x59, 0x59, 0x59, 0xff, 0x53, 0x53, 0x53, 0xff, 0x48, 0x48, 0x48, 0xff, 0x44, 0x44, 0x44, 0xff, 0x38, 0x38, 0x38, 0xff, 0x31, 0x31, 0x31, 0xff, 0x30, 0x30, 0x30, 0xff, 0x31, 0x31, 0x31, 0xff, 0x37, 0x37, 0x37, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x86, 0x86, 0x86, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x90, 0x90, 0x90, 0xff, 0x78, 0x78, 0x78, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x85, 0x85, 0x85, 0xff, 0x79, 0x79, 0x79, 0xff, 0x71, 0x71, 0x71, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x64, 0x64, 0x64, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x55, 0x55, 0x55, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0xae, 0xae, 0xae, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xac, 0xac, 0xac, 0xff, 0xac, 0xac, 0xac, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x01, 0x01, 0x01, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x11, 0x11, 0x11, 0xff, 0x16, 0x16, 0x16, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x14, 0x14, 0x14, 0xff, 0x13, 0x13, 0x13, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x23, 0x23, 0x23, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x33, 0x33, 0x33, 0xff, 0x35, 0x35, 0x35, 0xff, 0x47, 0x47, 0x47, 0xff, 0x21, 0x21, 0x21, 0xff, 0x16, 0x16, 0x16, 0xff, 0x28, 0x28, 0x28, 0xff, 0x59, 0x59, 0x59, 0xff, 0x65, 0x65, 0x65, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x35, 0x35, 0x35, 0xff, 0x24, 0x24, 0x24, 0xff, 0x46, 0x46, 0x46, 0xff, 0x49, 0x49, 0x49, 0xff, 0x71, 0x71, 0x71, 0xff, 0x36, 0x36, 0x36, 0xff, 0x51, 0x51, 0x51, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x6c, 0x6c, 0x6c, 0x21,
+    0x00, 0x00, 0x00, 0x01, 0x04, 0x04, 0x04, 0xf2, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x09, 0x09, 0x09, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x13, 0x13, 0x13, 0xff, 0x19, 0x19, 0x19, 0xff, 0x20, 0x20, 0x20, 0xff, 0x24, 0x24, 0x24, 0xff, 0x41, 0x41, 0x41, 0xff, 0x45, 0x45, 0x45, 0xff, 0x34, 0x34, 0x34, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x25, 0x25, 0x25, 0xff, 0x29, 0x29, 0x29, 0xff, 0x29, 0x29, 0x29, 0xff, 0x21, 0x21, 0x21, 0xff, 0x20, 0x20, 0x20, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x17, 0x17, 0x17, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x06, 0x06, 0x06, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x62, 0x62, 0x62, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x33, 0x33, 0x33, 0xff, 0x21, 0x21, 0x21, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x59, 0x59, 0x59, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x58, 0x58, 0x58, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x58, 0x58, 0x58, 0xff, 0x59, 0x59, 0x59, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x44, 0x44, 0x44, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x38, 0x38, 0x38, 0xff, 0x37, 0x37, 0x37, 0xff, 0x38, 0x38, 0x38, 0xff, 0x46, 0x46, 0x46, 0xff, 0x61, 0x61, 0x61, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x89, 0x89, 0x89, 0xff, 0x93, 0x93, 0x93, 0xff, 0x99, 0x99, 0x99, 0xff, 0x91, 0x91, 0x91, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0x93, 0x93, 0x93, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xad, 0xad, 0xad, 0xff, 0x9a, 0x9a, 0x9a, 0xff, 0x9f, 0x9f, 0x9f, 0xff, 0xad, 0xad, 0xad, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xae, 0xae, 0xae, 0xff, 0xac, 0xac, 0xac, 0xff, 0x9c, 0x9c, 0x9c, 0xff, 0x39, 0x39, 0x39, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x09, 0x09, 0x09, 0xff, 0x12, 0x12, 0x12, 0xff, 0x13, 0x13, 0x13, 0xff, 0x16, 0x16, 0x16, 0xff, 0x17, 0x17, 0x17, 0xff, 0x17, 0x17, 0x17, 0xff, 0x10, 0x10, 0x10, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x22, 0x22, 0x22, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x36, 0x36, 0x36, 0xff, 0x42, 0x42, 0x42, 0xff, 0x43, 0x43, 0x43, 0xff, 0x14, 0x14, 0x14, 0xff, 0x12, 0x12, 0x12, 0xff, 0x31, 0x31, 0x31, 0xff, 0x54, 0x54, 0x54, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x71, 0x71, 0x71, 0xff, 0x28, 0x28, 0x28, 0xff, 0x15, 0x15, 0x15, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x70, 0x70, 0x70, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x51, 0x51, 0x51, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x5f, 0x5f, 0x5f, 0xf2, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0xc6, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x09, 0x09, 0x09, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x10, 0x10, 0x10, 0xff, 0x11, 0x11, 0x11, 0xff, 0x23, 0x23, 0x23, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x26, 0x26, 0x26, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x44, 0x44, 0x44, 0xff, 0x35, 0x35, 0x35, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x22, 0x22, 0x22, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x23, 0x23, 0x23, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x12, 0x12, 0x12, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x06, 0x06, 0x06, 0xff, 0x20, 0x20, 0x20, 0xff, 0x43, 0x43, 0x43, 0xff, 0x73, 0x73, 0x73, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x47, 0x47, 0x47, 0xff, 0x47, 0x47, 0x47, 0xff, 0x36, 0x36, 0x36, 0xff, 0x25, 0x25, 0x25, 0xff, 0x43, 0x43, 0x43, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x91, 0x91, 0x91, 0xff, 0x72, 0x72, 0x72, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x45, 0x45, 0x45, 0xff, 0x55, 0x55, 0x55, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x51, 0x51, 0x51, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x58, 0x58, 0x58, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x85, 0x85, 0x85, 0xff, 0x90, 0x90, 0x90, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x86, 0x86, 0x86, 0xff, 0x9a, 0x9a, 0x9a, 0xff, 0x9d, 0x9d, 0x9d, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0x93, 0x93, 0x93, 0xff, 0xab, 0xab, 0xab, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xab, 0xab, 0xab, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xac, 0xac, 0xac, 0xff, 0xae, 0xae, 0xae, 0xff, 0xab, 0xab, 0xab, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0x49, 0x49, 0x49, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x12, 0x12, 0x12, 0xff, 0x16, 0x16, 0x16, 0xff, 0x14, 0x14, 0x14, 0xff, 0x17, 0x17, 0x17, 0xff, 0x12, 0x12, 0x12, 0xff, 0x18, 0x18, 0x18, 0xff, 0x25, 0x25, 0x25, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x49, 0x49, 0x49, 0xff, 0x37, 0x37, 0x37, 0xff, 0x28, 0x28, 0x28, 0xff, 0x17, 0x17, 0x17, 0xff, 0x39, 0x39, 0x39, 0xff, 0x57, 0x57, 0x57, 0xff, 0x80, 0x80, 0x80, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x22, 0x22, 0x22, 0xff, 0x10, 0x10, 0x10, 0xff, 0x33, 0x33, 0x33, 0xff, 0x39, 0x39, 0x39, 0xff, 0x60, 0x60, 0x60, 0xff, 0x58, 0x58, 0x58, 0xff, 0x54, 0x54, 0x54, 0xff, 0x77, 0x77, 0x77, 0xff, 0x43, 0x43, 0x43, 0xff, 0x28, 0x28, 0x28, 0xff, 0x4b, 0x4b, 0x4b, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x90, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x08, 0x08, 0x08, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x27, 0x27, 0x27, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x34, 0x34, 0x34, 0xff, 0x48, 0x48, 0x48, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x31, 0x31, 0x31, 0xff, 0x27, 0x27, 0x27, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x13, 0x13, 0x13, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x04, 0x04, 0xff, 0x27, 0x27, 0x27, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x74, 0x74, 0x74, 0xff, 0x54, 0x54, 0x54, 0xff, 0x34, 0x34, 0x34, 0xff, 0x43, 0x43, 0x43, 0xff, 0x30, 0x30, 0x30, 0xff, 0x31, 0x31, 0x31, 0xff, 0x49, 0x49, 0x49, 0xff, 0x55, 0x55, 0x55, 0xff, 0x52, 0x52, 0x52, 0xff, 0x9a, 0x9a, 0x9a, 0xff, 0x74, 0x74, 0x74, 0xff, 0x59, 0x59, 0x59, 0xff, 0x47, 0x47, 0x47, 0xff, 0x54, 0x54, 0x54, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x55, 0x55, 0x55, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x59, 0x59, 0x59, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x63, 0x63, 0x63, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x88, 0x88, 0x88, 0xff, 0x84, 0x84, 0x84, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x96, 0x96, 0x96, 0xff, 0x97, 0x97, 0x97, 0xff, 0x98, 0x98, 0x98, 0xff, 0x99, 0x99, 0x99, 0xff, 0xa6, 0xa6, 0xa6, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0xa6, 0xa6, 0xa6, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x02, 0x02, 0x02, 0xff, 0x10, 0x10, 0x10, 0xff, 0x09, 0x09, 0x09, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x14, 0x14, 0x14, 0xff, 0x14, 0x14, 0x14, 0xff, 0x19, 0x19, 0x19, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x17, 0x17, 0x17, 0xff, 0x14, 0x14, 0x14, 0xff, 0x26, 0x26, 0x26, 0xff, 0x23, 0x23, 0x23, 0xff, 0x26, 0x26, 0x26, 0xff, 0x46, 0x46, 0x46, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x35, 0x35, 0x35, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x42, 0x42, 0x42, 0xff, 0x62, 0x62, 0x62, 0xff, 0x82, 0x82, 0x82, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x14, 0x14, 0x14, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x51, 0x51, 0x51, 0xff, 0x68, 0x68, 0x68, 0xff, 0x59, 0x59, 0x59, 0xff, 0x79, 0x79, 0x79, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x29, 0x29, 0x29, 0xff, 0x41, 0x41, 0x41, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x58, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x08, 0x08, 0x08, 0xff, 0x09, 0x09, 0x09, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x10, 0x10, 0x10, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x14, 0x14, 0x14, 0xff, 0x23, 0x23, 0x23, 0xff, 0x25, 0x25, 0x25, 0xff, 0x23, 0x23, 0x23, 0xff, 0x31, 0x31, 0x31, 0xff, 0x38, 0x38, 0x38, 0xff, 0x34, 0x34, 0x34, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x22, 0x22, 0x22, 0xff, 0x18, 0x18, 0x18, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x09, 0x09, 0x09, 0xff, 0x16, 0x16, 0x16, 0xff, 0x06, 0x06, 0x06, 0xff, 0x03, 0x03, 0x03, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x39, 0x39, 0x39, 0xff, 0x50, 0x50, 0x50, 0xff, 0x69, 0x69, 0x69, 0xff, 0x50, 0x50, 0x50, 0xff, 0x34, 0x34, 0x34, 0xff, 0x29, 0x29, 0x29, 0xff, 0x30, 0x30, 0x30, 0xff, 0x58, 0x58, 0x58, 0xff, 0x50, 0x50, 0x50, 0xff, 0x53, 0x53, 0x53, 0xff, 0x9d, 0x9d, 0x9d, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x51, 0x51, 0x51, 0xff, 0x61, 0x61, 0x61, 0xff, 0x54, 0x54, 0x54, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x56, 0x56, 0x56, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x65, 0x65, 0x65, 0xff, 0x67, 0x67, 0x67, 0xff, 0x74, 0x74, 0x74, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x84, 0x84, 0x84, 0xff, 0x88, 0x88, 0x88, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x79, 0x79, 0x79, 0xff, 0x78, 0x78, 0x78, 0xff, 0x85, 0x85, 0x85, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x93, 0x93, 0x93, 0xff, 0x9d, 0x9d, 0x9d, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xad, 0xad, 0xad, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x06, 0x06, 0x06, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x16, 0x16, 0x16, 0xff, 0x10, 0x10, 0x10, 0xff, 0x26, 0x26, 0x26, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x16, 0x16, 0x16, 0xff, 0x21, 0x21, 0x21, 0xff, 0x19, 0x19, 0x19, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x25, 0x25, 0x25, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x32, 0x32, 0x32, 0xff, 0x43, 0x43, 0x43, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x80, 0x80, 0x80, 0xff, 0x48, 0x48, 0x48, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x17, 0x17, 0x17, 0xff, 0x37, 0x37, 0x37, 0xff, 0x51, 0x51, 0x51, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x61, 0x61, 0x61, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x37, 0x37, 0x37, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x08, 0x08, 0x08, 0xff, 0x07, 0x07, 0x07, 0xff, 0x05, 0x05, 0x05, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x26, 0x26, 0x26, 0xff, 0x23, 0x23, 0x23, 0xff, 0x27, 0x27, 0x27, 0xff, 0x24, 0x24, 0x24, 0xff, 0x26, 0x26, 0x26, 0xff, 0x23, 0x23, 0x23, 0xff, 0x22, 0x22, 0x22, 0xff, 0x15, 0x15, 0x15, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x11, 0x11, 0x11, 0xff, 0x06, 0x06, 0x06, 0xff, 0x12, 0x12, 0x12, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x28, 0x28, 0x28, 0xff, 0x28, 0x28, 0x28, 0xff, 0x38, 0x38, 0x38, 0xff, 0x46, 0x46, 0x46, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x55, 0x55, 0x55, 0xff, 0x52, 0x52, 0x52, 0xff, 0x96, 0x96, 0x96, 0xff, 0x64, 0x64, 0x64, 0xff, 0x61, 0x61, 0x61, 0xff, 0x49, 0x49, 0x49, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x52, 0x52, 0x52, 0xff, 0x57, 0x57, 0x57, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x74, 0x74, 0x74, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x84, 0x84, 0x84, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x84, 0x84, 0x84, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x95, 0x95, 0x95, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xae, 0xae, 0xae, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0xac, 0xac, 0xac, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0x40, 0x40, 0x40, 0xff, 0x00, 0x00, 0x00, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x17, 0x17, 0x17, 0xff, 0x12, 0x12, 0x12, 0xff, 0x37, 0x37, 0x37, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x30, 0x30, 0x30, 0xff, 0x14, 0x14, 0x14, 0xff, 0x16, 0x16, 0x16, 0xff, 0x14, 0x14, 0x14, 0xff, 0x43, 0x43, 0x43, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x27, 0x27, 0x27, 0xff, 0x32, 0x32, 0x32, 0xff, 0x31, 0x31, 0x31, 0xff, 0x47, 0x47, 0x47, 0xff, 0x72, 0x72, 0x72, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x18, 0x18, 0x18, 0xff, 0x19, 0x19, 0x19, 0xff, 0x12, 0x12, 0x12, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x63, 0x63, 0x63, 0xff, 0x62, 0x62, 0x62, 0xff, 0x62, 0x62, 0x62, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x25, 0x25, 0x25, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0xd7, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x07, 0x07, 0x07, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x13, 0x13, 0x13, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x24, 0x24, 0x24, 0xff, 0x20, 0x20, 0x20, 0xff, 0x28, 0x28, 0x28, 0xff, 0x21, 0x21, 0x21, 0xff, 0x13, 0x13, 0x13, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x24, 0x24, 0x24, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x07, 0x07, 0x07, 0xff, 0x15, 0x15, 0x15, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x23, 0x23, 0x23, 0xff, 0x29, 0x29, 0x29, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x39, 0x39, 0x39, 0xff, 0x46, 0x46, 0x46, 0xff, 0x39, 0x39, 0x39, 0xff, 0x32, 0x32, 0x32, 0xff, 0x54, 0x54, 0x54, 0xff, 0x52, 0x52, 0x52, 0xff, 0x55, 0x55, 0x55, 0xff, 0x97, 0x97, 0x97, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x41, 0x41, 0x41, 0xff, 0x58, 0x58, 0x58, 0xff, 0x60, 0x60, 0x60, 0xff, 0x57, 0x57, 0x57, 0xff, 0x58, 0x58, 0x58, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x73, 0x73, 0x73, 0xff, 0x73, 0x73, 0x73, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x97, 0x97, 0x97, 0xff, 0x9d, 0x9d, 0x9d, 0xff, 0x9a, 0x9a, 0x9a, 0xff, 0x96, 0x96, 0x96, 0xff, 0x96, 0x96, 0x96, 0xff, 0x9f, 0x9f, 0x9f, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0xab, 0xab, 0xab, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x30, 0x30, 0x30, 0xff, 0x00, 0x00, 0x00, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x15, 0x15, 0x15, 0xff, 0x14, 0x14, 0x14, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x39, 0x39, 0x39, 0xff, 0x13, 0x13, 0x13, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x21, 0x21, 0x21, 0xff, 0x44, 0x44, 0x44, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x34, 0x34, 0x34, 0xff, 0x29, 0x29, 0x29, 0xff, 0x29, 0x29, 0x29, 0xff, 0x56, 0x56, 0x56, 0xff, 0x84, 0x84, 0x84, 0xff, 0x74, 0x74, 0x74, 0xff, 0x22, 0x22, 0x22, 0xff, 0x13, 0x13, 0x13, 0xff, 0x23, 0x23, 0x23, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x78, 0x78, 0x78, 0xff, 0x60, 0x60, 0x60, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x53, 0x53, 0x53, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x8e, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x20, 0x20, 0x20, 0xff, 0x21, 0x21, 0x21, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x25, 0x25, 0x25, 0xff, 0x14, 0x14, 0x14, 0xff, 0x10, 0x10, 0x10, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x03, 0x03, 0x03, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x10, 0x10, 0x10, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x13, 0x13, 0x13, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x22, 0x22, 0x22, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x38, 0x38, 0x38, 0xff, 0x35, 0x35, 0x35, 0xff, 0x57, 0x57, 0x57, 0xff, 0x50, 0x50, 0x50, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x96, 0x96, 0x96, 0xff, 0x71, 0x71, 0x71, 0xff, 0x73, 0x73, 0x73, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x52, 0x52, 0x52, 0xff, 0x60, 0x60, 0x60, 0xff, 0x58, 0x58, 0x58, 0xff, 0x59, 0x59, 0x59, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x68, 0x68, 0x68, 0xff, 0x70, 0x70, 0x70, 0xff, 0x72, 0x72, 0x72, 0xff, 0x84, 0x84, 0x84, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xac, 0xac, 0xac, 0xff, 0xac, 0xac, 0xac, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x20, 0x20, 0x20, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x08, 0x08, 0x08, 0xff, 0x03, 0x03, 0x03, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x11, 0x11, 0x11, 0xff, 0x07, 0x07, 0x07, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x13, 0x13, 0x13, 0xff, 0x15, 0x15, 0x15, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x51, 0x51, 0x51, 0xff, 0x46, 0x46, 0x46, 0xff, 0x31, 0x31, 0x31, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x11, 0x11, 0x11, 0xff, 0x25, 0x25, 0x25, 0xff, 0x46, 0x46, 0x46, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x34, 0x34, 0x34, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x34, 0x34, 0x34, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x90, 0x90, 0x90, 0xff, 0x63, 0x63, 0x63, 0xff, 0x19, 0x19, 0x19, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x17, 0x17, 0x17, 0xff, 0x16, 0x16, 0x16, 0xff, 0x38, 0x38, 0x38, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x65, 0x65, 0x65, 0xff, 0x62, 0x62, 0x62, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x46, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x23, 0x23, 0x23, 0xff, 0x17, 0x17, 0x17, 0xff, 0x16, 0x16, 0x16, 0xff, 0x20, 0x20, 0x20, 0xff, 0x15, 0x15, 0x15, 0xff, 0x18, 0x18, 0x18, 0xff, 0x17, 0x17, 0x17, 0xff, 0x11, 0x11, 0x11, 0xff, 0x16, 0x16, 0x16, 0xff, 0x14, 0x14, 0x14, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x06, 0x06, 0x06, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x01, 0x01, 0x01, 0xff, 0x10, 0x10, 0x10, 0xff, 0x19, 0x19, 0x19, 0xff, 0x14, 0x14, 0x14, 0xff, 0x20, 0x20, 0x20, 0xff, 0x27, 0x27, 0x27, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x25, 0x25, 0x25, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x65, 0x65, 0x65, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x65, 0x65, 0x65, 0xff, 0x67, 0x67, 0x67, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x47, 0x47, 0x47, 0xff, 0x47, 0x47, 0x47, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x59, 0x59, 0x59, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x69, 0x69, 0x69, 0xff, 0x74, 0x74, 0x74, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x99, 0x99, 0x99, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xae, 0xae, 0xae, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0x9c, 0x9c, 0x9c, 0xff, 0x39, 0x39, 0x39, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x04, 0x04, 0x04, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x12, 0x12, 0x12, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x42, 0x42, 0x42, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x23, 0x23, 0x23, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x11, 0x11, 0x11, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x25, 0x25, 0x25, 0xff, 0x24, 0x24, 0x24, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x99, 0x99, 0x99, 0xff, 0x51, 0x51, 0x51, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x07, 0x07, 0x07, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x17, 0x17, 0x17, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x78, 0x78, 0x78, 0xff, 0x58, 0x58, 0x58, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x61, 0x61, 0x61, 0xff, 0x69, 0x69, 0x69, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x04, 0x04, 0xef, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x09, 0x09, 0x09, 0xff, 0x07, 0x07, 0x07, 0xff, 0x05, 0x05, 0x05, 0xff, 0x12, 0x12, 0x12, 0xff, 0x28, 0x28, 0x28, 0xff, 0x20, 0x20, 0x20, 0xff, 0x15, 0x15, 0x15, 0xff, 0x16, 0x16, 0x16, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x15, 0x15, 0x15, 0xff, 0x13, 0x13, 0x13, 0xff, 0x13, 0x13, 0x13, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x12, 0x12, 0x12, 0xff, 0x14, 0x14, 0x14, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x06, 0x06, 0x06, 0xff, 0x11, 0x11, 0x11, 0xff, 0x19, 0x19, 0x19, 0xff, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x18, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x21, 0x21, 0x21, 0xff, 0x27, 0x27, 0x27, 0xff, 0x28, 0x28, 0x28, 0xff, 0x43, 0x43, 0x43, 0xff, 0x53, 0x53, 0x53, 0xff, 0x68, 0x68, 0x68, 0xff, 0x82, 0x82, 0x82, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x62, 0x62, 0x62, 0xff, 0x77, 0x77, 0x77, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x52, 0x52, 0x52, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x68, 0x68, 0x68, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xad, 0xad, 0xad, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xba, 0xba, 0xba, 0xff, 0x90, 0x90, 0x90, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x01, 0x01, 0x01, 0xff, 0x07, 0x07, 0x07, 0xff, 0x04, 0x04, 0x04, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x15, 0x15, 0x15, 0xff, 0x25, 0x25, 0x25, 0xff, 0x33, 0x33, 0x33, 0xff, 0x25, 0x25, 0x25, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x20, 0x20, 0x20, 0xff, 0x30, 0x30, 0x30, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x36, 0x36, 0x36, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x26, 0x26, 0x26, 0xff, 0x23, 0x23, 0x23, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x46, 0x46, 0x46, 0xff, 0x81, 0x81, 0x81, 0xff, 0x96, 0x96, 0x96, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x30, 0x30, 0x30, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x06, 0x06, 0x06, 0xff, 0x15, 0x15, 0x15, 0xff, 0x43, 0x43, 0x43, 0xff, 0x72, 0x72, 0x72, 0xff, 0x65, 0x65, 0x65, 0xff, 0x35, 0x35, 0x35, 0xff, 0x5d, 0x5d, 0x5d, 0xef, 0x6d, 0x6d, 0x6d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0xa0, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x29, 0x29, 0x29, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x16, 0x16, 0x16, 0xff, 0x18, 0x18, 0x18, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x14, 0x14, 0x14, 0xff, 0x11, 0x11, 0x11, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x14, 0x14, 0x14, 0xff, 0x14, 0x14, 0x14, 0xff, 0x15, 0x15, 0x15, 0xff, 0x09, 0x09, 0x09, 0xff, 0x08, 0x08, 0x08, 0xff, 0x07, 0x07, 0x07, 0xff, 0x03, 0x03, 0x03, 0xff, 0x05, 0x05, 0x05, 0xff, 0x10, 0x10, 0x10, 0xff, 0x19, 0x19, 0x19, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x17, 0x17, 0x17, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x20, 0x20, 0x20, 0xff, 0x29, 0x29, 0x29, 0xff, 0x28, 0x28, 0x28, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x66, 0x66, 0x66, 0xff, 0x84, 0x84, 0x84, 0xff, 0x72, 0x72, 0x72, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x74, 0x74, 0x74, 0xff, 0x76, 0x76, 0x76, 0xff, 0x46, 0x46, 0x46, 0xff, 0x45, 0x45, 0x45, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x60, 0x60, 0x60, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x86, 0x86, 0x86, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xad, 0xad, 0xad, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0x98, 0x98, 0x98, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0xba, 0xba, 0xba, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0x94, 0x94, 0x94, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x04, 0x04, 0x04, 0xff, 0x04, 0x04, 0x04, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x11, 0x11, 0x11, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x25, 0x25, 0x25, 0xff, 0x24, 0x24, 0x24, 0xff, 0x22, 0x22, 0x22, 0xff, 0x28, 0x28, 0x28, 0xff, 0x24, 0x24, 0x24, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x43, 0x43, 0x43, 0xff, 0x46, 0x46, 0x46, 0xff, 0x21, 0x21, 0x21, 0xff, 0x22, 0x22, 0x22, 0xff, 0x31, 0x31, 0x31, 0xff, 0x55, 0x55, 0x55, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0x85, 0x85, 0x85, 0xff, 0x32, 0x32, 0x32, 0xff, 0x34, 0x34, 0x34, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x48, 0x48, 0x48, 0xff, 0x71, 0x71, 0x71, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x34, 0x34, 0x34, 0xff, 0x54, 0x54, 0x54, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x4a, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x09, 0x09, 0x09, 0xff, 0x09, 0x09, 0x09, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x18, 0x18, 0x18, 0xff, 0x28, 0x28, 0x28, 0xff, 0x25, 0x25, 0x25, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x16, 0x16, 0x16, 0xff, 0x17, 0x17, 0x17, 0xff, 0x18, 0x18, 0x18, 0xff, 0x15, 0x15, 0x15, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x10, 0x10, 0x10, 0xff, 0x15, 0x15, 0x15, 0xff, 0x12, 0x12, 0x12, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x09, 0x09, 0x09, 0xff, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xff, 0x12, 0x12, 0x12, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x19, 0x19, 0x19, 0xff, 0x18, 0x18, 0x18, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x28, 0x28, 0x28, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x55, 0x55, 0x55, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x75, 0x75, 0x75, 0xff, 0x79, 0x79, 0x79, 0xff, 0x74, 0x74, 0x74, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x79, 0x79, 0x79, 0xff, 0x67, 0x67, 0x67, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x58, 0x58, 0x58, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x68, 0x68, 0x68, 0xff, 0x79, 0x79, 0x79, 0xff, 0x94, 0x94, 0x94, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0xab, 0xab, 0xab, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0x94, 0x94, 0x94, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0x99, 0x99, 0x99, 0xff, 0x78, 0x78, 0x78, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x58, 0x58, 0x58, 0xff, 0x48, 0x48, 0x48, 0xff, 0x26, 0x26, 0x26, 0xff, 0x11, 0x11, 0x11, 0xff, 0x04, 0x04, 0x04, 0xff, 0x02, 0x02, 0x02, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x14, 0x14, 0x14, 0xff, 0x22, 0x22, 0x22, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x31, 0x31, 0x31, 0xff, 0x43, 0x43, 0x43, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x67, 0x67, 0x67, 0xff, 0x63, 0x63, 0x63, 0xff, 0x44, 0x44, 0x44, 0xff, 0x40, 0x40, 0x40, 0xff, 0x23, 0x23, 0x23, 0xff, 0x27, 0x27, 0x27, 0xff, 0x34, 0x34, 0x34, 0xff, 0x63, 0x63, 0x63, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0x74, 0x74, 0x74, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x34, 0x34, 0x34, 0xff, 0x19, 0x19, 0x19, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x12, 0x12, 0x12, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x66, 0x66, 0x66, 0xff, 0x68, 0x68, 0x68, 0xff, 0x38, 0x38, 0x38, 0xff, 0x52, 0x52, 0x52, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0xe7, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x08, 0x08, 0x08, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x11, 0x11, 0x11, 0xff, 0x19, 0x19, 0x19, 0xff, 0x23, 0x23, 0x23, 0xff, 0x28, 0x28, 0x28, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x14, 0x14, 0x14, 0xff, 0x16, 0x16, 0x16, 0xff, 0x18, 0x18, 0x18, 0xff, 0x17, 0x17, 0x17, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x14, 0x14, 0x14, 0xff, 0x19, 0x19, 0x19, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x14, 0x14, 0x14, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x06, 0x06, 0x06, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x13, 0x13, 0x13, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x17, 0x17, 0x17, 0xff, 0x18, 0x18, 0x18, 0xff, 0x19, 0x19, 0x19, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x29, 0x29, 0x29, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x56, 0x56, 0x56, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x86, 0x86, 0x86, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x63, 0x63, 0x63, 0xff, 0x70, 0x70, 0x70, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x58, 0x58, 0x58, 0xff, 0x48, 0x48, 0x48, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x81, 0x81, 0x81, 0xff, 0x96, 0x96, 0x96, 0xff, 0xab, 0xab, 0xab, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0x9a, 0x9a, 0x9a, 0xff, 0x93, 0x93, 0x93, 0xff, 0x96, 0x96, 0x96, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x84, 0x84, 0x84, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x67, 0x67, 0x67, 0xff, 0x58, 0x58, 0x58, 0xff, 0x50, 0x50, 0x50, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x34, 0x34, 0x34, 0xff, 0x22, 0x22, 0x22, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x14, 0x14, 0x14, 0xff, 0x23, 0x23, 0x23, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x37, 0x37, 0x37, 0xff, 0x45, 0x45, 0x45, 0xff, 0x51, 0x51, 0x51, 0xff, 0x61, 0x61, 0x61, 0xff, 0x48, 0x48, 0x48, 0xff, 0x60, 0x60, 0x60, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x46, 0x46, 0x46, 0xff, 0x33, 0x33, 0x33, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x77, 0x77, 0x77, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x33, 0x33, 0x33, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x11, 0x11, 0x11, 0xff, 0x20, 0x20, 0x20, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x62, 0x62, 0x62, 0xff, 0x71, 0x71, 0x71, 0xff, 0x40, 0x40, 0x40, 0xe7, 0x66, 0x66, 0x66, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x87, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x13, 0x13, 0x13, 0xff, 0x26, 0x26, 0x26, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x17, 0x17, 0x17, 0xff, 0x12, 0x12, 0x12, 0xff, 0x17, 0x17, 0x17, 0xff, 0x18, 0x18, 0x18, 0xff, 0x17, 0x17, 0x17, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x17, 0x17, 0x17, 0xff, 0x13, 0x13, 0x13, 0xff, 0x08, 0x08, 0x08, 0xff, 0x10, 0x10, 0x10, 0xff, 0x15, 0x15, 0x15, 0xff, 0x09, 0x09, 0x09, 0xff, 0x03, 0x03, 0x03, 0xff, 0x01, 0x01, 0x01, 0xff, 0x03, 0x03, 0x03, 0xff, 0x14, 0x14, 0x14, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x17, 0x17, 0x17, 0xff, 0x16, 0x16, 0x16, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x26, 0x26, 0x26, 0xff, 0x28, 0x28, 0x28, 0xff, 0x51, 0x51, 0x51, 0xff, 0x62, 0x62, 0x62, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x51, 0x51, 0x51, 0xff, 0x84, 0x84, 0x84, 0xff, 0x79, 0x79, 0x79, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x67, 0x67, 0x67, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x93, 0x93, 0x93, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0x98, 0x98, 0x98, 0xff, 0x94, 0x94, 0x94, 0xff, 0x91, 0x91, 0x91, 0xff, 0x99, 0x99, 0x99, 0xff, 0xad, 0xad, 0xad, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0x98, 0x98, 0x98, 0xff, 0x83, 0x83, 0x83, 0xff, 0x88, 0x88, 0x88, 0xff, 0x88, 0x88, 0x88, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x66, 0x66, 0x66, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x57, 0x57, 0x57, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x12, 0x12, 0x12, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x44, 0x44, 0x44, 0xff, 0x50, 0x50, 0x50, 0xff, 0x51, 0x51, 0x51, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x60, 0x60, 0x60, 0xff, 0x65, 0x65, 0x65, 0xff, 0x51, 0x51, 0x51, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x54, 0x54, 0x54, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x19, 0x19, 0x19, 0xff, 0x30, 0x30, 0x30, 0xff, 0x44, 0x44, 0x44, 0xff, 0x89, 0x89, 0x89, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0x54, 0x54, 0x54, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x27, 0x27, 0x27, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x14, 0x14, 0x14, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x41, 0x41, 0x41, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x51, 0x51, 0x51, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x22, 0x03, 0x03, 0x03, 0xfe, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x09, 0x09, 0x09, 0xff, 0x08, 0x08, 0x08, 0xff, 0x06, 0x06, 0x06, 0xff, 0x16, 0x16, 0x16, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x25, 0x25, 0x25, 0xff, 0x13, 0x13, 0x13, 0xff, 0x16, 0x16, 0x16, 0xff, 0x14, 0x14, 0x14, 0xff, 0x17, 0x17, 0x17, 0xff, 0x15, 0x15, 0x15, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x14, 0x14, 0x14, 0xff, 0x09, 0x09, 0x09, 0xff, 0x08, 0x08, 0x08, 0xff, 0x10, 0x10, 0x10, 0xff, 0x11, 0x11, 0x11, 0xff, 0x06, 0x06, 0x06, 0xff, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x04, 0x04, 0x04, 0xff, 0x15, 0x15, 0x15, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x18, 0x18, 0x18, 0xff, 0x16, 0x16, 0x16, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x29, 0x29, 0x29, 0xff, 0x25, 0x25, 0x25, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x66, 0x66, 0x66, 0xff, 0x66, 0x66, 0x66, 0xff, 0x55, 0x55, 0x55, 0xff, 0x77, 0x77, 0x77, 0xff, 0x84, 0x84, 0x84, 0xff, 0x66, 0x66, 0x66, 0xff, 0x65, 0x65, 0x65, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x89, 0x89, 0x89, 0xff, 0x77, 0x77, 0x77, 0xff, 0x75, 0x75, 0x75, 0xff, 0x78, 0x78, 0x78, 0xff, 0x80, 0x80, 0x80, 0xff, 0x89, 0x89, 0x89, 0xff, 0x86, 0x86, 0x86, 0xff, 0x84, 0x84, 0x84, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x9a, 0x9a, 0x9a, 0xff, 0xa6, 0xa6, 0xa6, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0x92, 0x92, 0x92, 0xff, 0x88, 0x88, 0x88, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x88, 0x88, 0x88, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x36, 0x36, 0x36, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x39, 0x39, 0x39, 0xff, 0x34, 0x34, 0x34, 0xff, 0x29, 0x29, 0x29, 0xff, 0x22, 0x22, 0x22, 0xff, 0x34, 0x34, 0x34, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x51, 0x51, 0x51, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x51, 0x51, 0x51, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x62, 0x62, 0x62, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x47, 0x47, 0x47, 0xff, 0x50, 0x50, 0x50, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x53, 0x53, 0x53, 0xff, 0xa2, 0xa2, 0xa2, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x46, 0x46, 0x46, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x47, 0x47, 0x47, 0xff, 0x26, 0x26, 0x26, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x19, 0x19, 0x19, 0xff, 0x18, 0x18, 0x18, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x6f, 0x6f, 0x6f, 0xfe, 0x57, 0x57, 0x57, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0xb4, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x31, 0x31, 0x31, 0xff, 0x20, 0x20, 0x20, 0xff, 0x11, 0x11, 0x11, 0xff, 0x16, 0x16, 0x16, 0xff, 0x14, 0x14, 0x14, 0xff, 0x16, 0x16, 0x16, 0xff, 0x13, 0x13, 0x13, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x11, 0x11, 0x11, 0xff, 0x09, 0x09, 0x09, 0xff, 0x05, 0x05, 0x05, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x05, 0x05, 0x05, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x06, 0x06, 0x06, 0xff, 0x18, 0x18, 0x18, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x18, 0x18, 0x18, 0xff, 0x16, 0x16, 0x16, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x66, 0x66, 0x66, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x54, 0x54, 0x54, 0xff, 0x61, 0x61, 0x61, 0xff, 0x92, 0x92, 0x92, 0xff, 0x67, 0x67, 0x67, 0xff, 0x65, 0x65, 0x65, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x71, 0x71, 0x71, 0xff, 0x90, 0x90, 0x90, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x81, 0x81, 0x81, 0xff, 0x85, 0x85, 0x85, 0xff, 0x81, 0x81, 0x81, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x80, 0x80, 0x80, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x82, 0x82, 0x82, 0xff, 0x91, 0x91, 0x91, 0xff, 0x9c, 0x9c, 0x9c, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0x9f, 0x9f, 0x9f, 0xff, 0x95, 0x95, 0x95, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x86, 0x86, 0x86, 0xff, 0x74, 0x74, 0x74, 0xff, 0x63, 0x63, 0x63, 0xff, 0x66, 0x66, 0x66, 0xff, 0x60, 0x60, 0x60, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x48, 0x48, 0x48, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x39, 0x39, 0x39, 0xff, 0x36, 0x36, 0x36, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x31, 0x31, 0x31, 0xff, 0x37, 0x37, 0x37, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x45, 0x45, 0x45, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x38, 0x38, 0x38, 0xff, 0x50, 0x50, 0x50, 0xff, 0x36, 0x36, 0x36, 0xff, 0x28, 0x28, 0x28, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x47, 0x47, 0x47, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x23, 0x23, 0x23, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x16, 0x16, 0x16, 0xff, 0x17, 0x17, 0x17, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x65, 0x65, 0x65, 0xff, 0x62, 0x62, 0x62, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x40, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x08, 0x08, 0x08, 0xff, 0x09, 0x09, 0x09, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x13, 0x13, 0x13, 0xff, 0x15, 0x15, 0x15, 0xff, 0x15, 0x15, 0x15, 0xff, 0x12, 0x12, 0x12, 0xff, 0x12, 0x12, 0x12, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x06, 0x06, 0x06, 0xff, 0x02, 0x02, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x09, 0x09, 0x09, 0xff, 0x19, 0x19, 0x19, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x18, 0x18, 0x18, 0xff, 0x16, 0x16, 0x16, 0xff, 0x19, 0x19, 0x19, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x27, 0x27, 0x27, 0xff, 0x29, 0x29, 0x29, 0xff, 0x52, 0x52, 0x52, 0xff, 0x64, 0x64, 0x64, 0xff, 0x62, 0x62, 0x62, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x58, 0x58, 0x58, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x66, 0x66, 0x66, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x91, 0x91, 0x91, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x86, 0x86, 0x86, 0xff, 0x87, 0x87, 0x87, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x89, 0x89, 0x89, 0xff, 0x87, 0x87, 0x87, 0xff, 0x87, 0x87, 0x87, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x86, 0x86, 0x86, 0xff, 0x89, 0x89, 0x89, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x93, 0x93, 0x93, 0xff, 0x91, 0x91, 0x91, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x83, 0x83, 0x83, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x67, 0x67, 0x67, 0xff, 0x68, 0x68, 0x68, 0xff, 0x61, 0x61, 0x61, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x41, 0x41, 0x41, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x33, 0x33, 0x33, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x27, 0x27, 0x27, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x28, 0x28, 0x28, 0xff, 0x33, 0x33, 0x33, 0xff, 0x40, 0x40, 0x40, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x39, 0x39, 0x39, 0xff, 0x50, 0x50, 0x50, 0xff, 0x41, 0x41, 0x41, 0xff, 0x31, 0x31, 0x31, 0xff, 0x34, 0x34, 0x34, 0xff, 0x83, 0x83, 0x83, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0x57, 0x57, 0x57, 0xff, 0x48, 0x48, 0x48, 0xff, 0x46, 0x46, 0x46, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x22, 0x22, 0x22, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x11, 0x11, 0x11, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x69, 0x69, 0x69, 0xff, 0x59, 0x59, 0x59, 0xff, 0x5b, 0x5b, 0x5b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0xcd, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x09, 0x09, 0x09, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x21, 0x21, 0x21, 0xff, 0x28, 0x28, 0x28, 0xff, 0x13, 0x13, 0x13, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x16, 0x16, 0x16, 0xff, 0x16, 0x16, 0x16, 0xff, 0x14, 0x14, 0x14, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x08, 0x08, 0x08, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x08, 0x08, 0x08, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x18, 0x18, 0x18, 0xff, 0x16, 0x16, 0x16, 0xff, 0x18, 0x18, 0x18, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x48, 0x48, 0x48, 0xff, 0x66, 0x66, 0x66, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x64, 0x64, 0x64, 0xff, 0x56, 0x56, 0x56, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x70, 0x70, 0x70, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x81, 0x81, 0x81, 0xff, 0x95, 0x95, 0x95, 0xff, 0x87, 0x87, 0x87, 0xff, 0x81, 0x81, 0x81, 0xff, 0x87, 0x87, 0x87, 0xff, 0x86, 0x86, 0x86, 0xff, 0x87, 0x87, 0x87, 0xff, 0x88, 0x88, 0x88, 0xff, 0x88, 0x88, 0x88, 0xff, 0x86, 0x86, 0x86, 0xff, 0x87, 0x87, 0x87, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x90, 0x90, 0x90, 0xff, 0x91, 0x91, 0x91, 0xff, 0x91, 0x91, 0x91, 0xff, 0x91, 0x91, 0x91, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x70, 0x70, 0x70, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x11, 0x11, 0x11, 0xff, 0x45, 0x45, 0x45, 0xff, 0x46, 0x46, 0x46, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x21, 0x21, 0x21, 0xff, 0x30, 0x30, 0x30, 0xff, 0x33, 0x33, 0x33, 0xff, 0x27, 0x27, 0x27, 0xff, 0x29, 0x29, 0x29, 0xff, 0x32, 0x32, 0x32, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x54, 0x54, 0x54, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x54, 0x54, 0x54, 0xff, 0x40, 0x40, 0x40, 0xff, 0x31, 0x31, 0x31, 0xff, 0x49, 0x49, 0x49, 0xff, 0x9c, 0x9c, 0x9c, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0x43, 0x43, 0x43, 0xff, 0x41, 0x41, 0x41, 0xff, 0x49, 0x49, 0x49, 0xff, 0x44, 0x44, 0x44, 0xff, 0x18, 0x18, 0x18, 0xff, 0x14, 0x14, 0x14, 0xff, 0x18, 0x18, 0x18, 0xff, 0x25, 0x25, 0x25, 0xff, 0x71, 0x71, 0x71, 0xff, 0x50, 0x50, 0x50, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x51, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x08, 0x08, 0x08, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x22, 0x22, 0x22, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x13, 0x13, 0x13, 0xff, 0x17, 0x17, 0x17, 0xff, 0x16, 0x16, 0x16, 0xff, 0x14, 0x14, 0x14, 0xff, 0x10, 0x10, 0x10, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x09, 0x09, 0x09, 0xff, 0x09, 0x09, 0x09, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x11, 0x11, 0x11, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x18, 0x18, 0x18, 0xff, 0x16, 0x16, 0x16, 0xff, 0x18, 0x18, 0x18, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x30, 0x30, 0x30, 0xff, 0x43, 0x43, 0x43, 0xff, 0x63, 0x63, 0x63, 0xff, 0x61, 0x61, 0x61, 0xff, 0x67, 0x67, 0x67, 0xff, 0x55, 0x55, 0x55, 0xff, 0x76, 0x76, 0x76, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x72, 0x72, 0x72, 0xff, 0x76, 0x76, 0x76, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x80, 0x80, 0x80, 0xff, 0x96, 0x96, 0x96, 0xff, 0x85, 0x85, 0x85, 0xff, 0x85, 0x85, 0x85, 0xff, 0x86, 0x86, 0x86, 0xff, 0x84, 0x84, 0x84, 0xff, 0x82, 0x82, 0x82, 0xff, 0x82, 0x82, 0x82, 0xff, 0x85, 0x85, 0x85, 0xff, 0x88, 0x88, 0x88, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x91, 0x91, 0x91, 0xff, 0x90, 0x90, 0x90, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x90, 0x90, 0x90, 0xff, 0x88, 0x88, 0x88, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x74, 0x74, 0x74, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x56, 0x56, 0x56, 0xff, 0x19, 0x19, 0x19, 0xff, 0x07, 0x07, 0x07, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x33, 0x33, 0x33, 0xff, 0x20, 0x20, 0x20, 0xff, 0x26, 0x26, 0x26, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x33, 0x33, 0x33, 0xff, 0x24, 0x24, 0x24, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x29, 0x29, 0x29, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x36, 0x36, 0x36, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x39, 0x39, 0x39, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x05, 0x05, 0x05, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x26, 0x26, 0x26, 0xff, 0x39, 0x39, 0x39, 0xff, 0x82, 0x82, 0x82, 0xff, 0x48, 0x48, 0x48, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0xce, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x06, 0x06, 0x06, 0xff, 0x08, 0x08, 0x08, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x15, 0x15, 0x15, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x12, 0x12, 0x12, 0xff, 0x14, 0x14, 0x14, 0xff, 0x16, 0x16, 0x16, 0xff, 0x14, 0x14, 0x14, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x09, 0x09, 0x09, 0xff, 0x03, 0x03, 0x03, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x03, 0x03, 0x03, 0xff, 0x14, 0x14, 0x14, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x18, 0x18, 0x18, 0xff, 0x16, 0x16, 0x16, 0xff, 0x18, 0x18, 0x18, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x30, 0x30, 0x30, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x63, 0x63, 0x63, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x64, 0x64, 0x64, 0xff, 0x50, 0x50, 0x50, 0xff, 0x71, 0x71, 0x71, 0xff, 0x70, 0x70, 0x70, 0xff, 0x68, 0x68, 0x68, 0xff, 0x64, 0x64, 0x64, 0xff, 0x68, 0x68, 0x68, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x78, 0x78, 0x78, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x81, 0x81, 0x81, 0xff, 0x92, 0x92, 0x92, 0xff, 0x83, 0x83, 0x83, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x81, 0x81, 0x81, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x83, 0x83, 0x83, 0xff, 0x89, 0x89, 0x89, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x90, 0x90, 0x90, 0xff, 0x90, 0x90, 0x90, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x86, 0x86, 0x86, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x75, 0x75, 0x75, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x54, 0x54, 0x54, 0xff, 0x19, 0x19, 0x19, 0xff, 0x06, 0x06, 0x06, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x40, 0x40, 0x40, 0xff, 0x29, 0x29, 0x29, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x32, 0x32, 0x32, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x27, 0x27, 0x27, 0xff, 0x27, 0x27, 0x27, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x25, 0x25, 0x25, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x23, 0x23, 0x23, 0xff, 0x38, 0x38, 0x38, 0xff, 0x78, 0x78, 0x78, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0x63, 0x63, 0x63, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x58, 0x58, 0x58, 0xff, 0x29, 0x29, 0x29, 0xff, 0x05, 0x05, 0x05, 0xff, 0x19, 0x19, 0x19, 0xff, 0x24, 0x24, 0x24, 0xff, 0x67, 0x67, 0x67, 0xff, 0x84, 0x84, 0x84, 0xce, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x46, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x08, 0x08, 0x08, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x14, 0x14, 0x14, 0xff, 0x16, 0x16, 0x16, 0xff, 0x12, 0x12, 0x12, 0xff, 0x11, 0x11, 0x11, 0xff, 0x15, 0x15, 0x15, 0xff, 0x15, 0x15, 0x15, 0xff, 0x12, 0x12, 0x12, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x09, 0x09, 0x09, 0xff, 0x06, 0x06, 0x06, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x06, 0x06, 0x06, 0xff, 0x18, 0x18, 0x18, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x19, 0x19, 0x19, 0xff, 0x16, 0x16, 0x16, 0xff, 0x17, 0x17, 0x17, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x29, 0x29, 0x29, 0xff, 0x31, 0x31, 0x31, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x65, 0x65, 0x65, 0xff, 0x65, 0x65, 0x65, 0xff, 0x65, 0x65, 0x65, 0xff, 0x50, 0x50, 0x50, 0xff, 0x70, 0x70, 0x70, 0xff, 0x76, 0x76, 0x76, 0xff, 0x69, 0x69, 0x69, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x68, 0x68, 0x68, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x79, 0x79, 0x79, 0xff, 0x74, 0x74, 0x74, 0xff, 0x84, 0x84, 0x84, 0xff, 0x90, 0x90, 0x90, 0xff, 0x86, 0x86, 0x86, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x81, 0x81, 0x81, 0xff, 0x84, 0x84, 0x84, 0xff, 0x87, 0x87, 0x87, 0xff, 0x89, 0x89, 0x89, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x92, 0x92, 0x92, 0xff, 0x93, 0x93, 0x93, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x88, 0x88, 0x88, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x75, 0x75, 0x75, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x68, 0x68, 0x68, 0xff, 0x54, 0x54, 0x54, 0xff, 0x19, 0x19, 0x19, 0xff, 0x09, 0x09, 0x09, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x42, 0x42, 0x42, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x22, 0x22, 0x22, 0xff, 0x21, 0x21, 0x21, 0xff, 0x42, 0x42, 0x42, 0xff, 0x33, 0x33, 0x33, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x29, 0x29, 0x29, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x33, 0x33, 0x33, 0xff, 0x30, 0x30, 0x30, 0xff, 0x24, 0x24, 0x24, 0xff, 0x21, 0x21, 0x21, 0xff, 0x58, 0x58, 0x58, 0xff, 0x36, 0x36, 0x36, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x97, 0x97, 0x97, 0xff, 0x9a, 0x9a, 0x9a, 0xff, 0x41, 0x41, 0x41, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x14, 0x14, 0x14, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x29, 0x29, 0x29, 0xff, 0x67, 0x67, 0x67, 0xff, 0x64, 0x64, 0x64, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0xb4, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x08, 0x08, 0x08, 0xff, 0x09, 0x09, 0x09, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x15, 0x15, 0x15, 0xff, 0x13, 0x13, 0x13, 0xff, 0x13, 0x13, 0x13, 0xff, 0x18, 0x18, 0x18, 0xff, 0x14, 0x14, 0x14, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x09, 0x09, 0x09, 0xff, 0x09, 0x09, 0x09, 0xff, 0x08, 0x08, 0x08, 0xff, 0x03, 0x03, 0x03, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x17, 0x17, 0x17, 0xff, 0x17, 0x17, 0x17, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x26, 0x26, 0x26, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x66, 0x66, 0x66, 0xff, 0x58, 0x58, 0x58, 0xff, 0x74, 0x74, 0x74, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x67, 0x67, 0x67, 0xff, 0x70, 0x70, 0x70, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x65, 0x65, 0x65, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x80, 0x80, 0x80, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x84, 0x84, 0x84, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x86, 0x86, 0x86, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x81, 0x81, 0x81, 0xff, 0x83, 0x83, 0x83, 0xff, 0x85, 0x85, 0x85, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x90, 0x90, 0x90, 0xff, 0x93, 0x93, 0x93, 0xff, 0x93, 0x93, 0x93, 0xff, 0x92, 0x92, 0x92, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x85, 0x85, 0x85, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x75, 0x75, 0x75, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x66, 0x66, 0x66, 0xff, 0x53, 0x53, 0x53, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x34, 0x34, 0x34, 0xff, 0x40, 0x40, 0x40, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x28, 0x28, 0x28, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x37, 0x37, 0x37, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x35, 0x35, 0x35, 0xff, 0x28, 0x28, 0x28, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x58, 0x58, 0x58, 0xff, 0x29, 0x29, 0x29, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x60, 0x60, 0x60, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0x72, 0x72, 0x72, 0xff, 0x21, 0x21, 0x21, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x32, 0x32, 0x32, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x23, 0x23, 0x23, 0xff, 0x26, 0x26, 0x26, 0xff, 0x28, 0x28, 0x28, 0xff, 0x38, 0x38, 0x38, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x01, 0x01, 0x01, 0xfa, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x11, 0x11, 0x11, 0xff, 0x12, 0x12, 0x12, 0xff, 0x10, 0x10, 0x10, 0xff, 0x14, 0x14, 0x14, 0xff, 0x15, 0x15, 0x15, 0xff, 0x10, 0x10, 0x10, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0xff, 0x05, 0x05, 0x05, 0xff, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xff, 0x14, 0x14, 0x14, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x19, 0x19, 0x19, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x19, 0x19, 0x19, 0xff, 0x17, 0x17, 0x17, 0xff, 0x17, 0x17, 0x17, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x24, 0x24, 0x24, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x40, 0x40, 0x40, 0xff, 0x55, 0x55, 0x55, 0xff, 0x68, 0x68, 0x68, 0xff, 0x63, 0x63, 0x63, 0xff, 0x57, 0x57, 0x57, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x66, 0x66, 0x66, 0xff, 0x69, 0x69, 0x69, 0xff, 0x76, 0x76, 0x76, 0xff, 0x69, 0x69, 0x69, 0xff, 0x62, 0x62, 0x62, 0xff, 0x72, 0x72, 0x72, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x80, 0x80, 0x80, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x86, 0x86, 0x86, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x80, 0x80, 0x80, 0xff, 0x87, 0x87, 0x87, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x90, 0x90, 0x90, 0xff, 0x93, 0x93, 0x93, 0xff, 0x94, 0x94, 0x94, 0xff, 0x92, 0x92, 0x92, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x82, 0x82, 0x82, 0xff, 0x79, 0x79, 0x79, 0xff, 0x72, 0x72, 0x72, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x63, 0x63, 0x63, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x46, 0x46, 0x46, 0xff, 0x20, 0x20, 0x20, 0xff, 0x34, 0x34, 0x34, 0xff, 0x41, 0x41, 0x41, 0xff, 0x25, 0x25, 0x25, 0xff, 0x25, 0x25, 0x25, 0xff, 0x37, 0x37, 0x37, 0xff, 0x41, 0x41, 0x41, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x34, 0x34, 0x34, 0xff, 0x25, 0x25, 0x25, 0xff, 0x34, 0x34, 0x34, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x26, 0x26, 0x26, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x80, 0x80, 0x80, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0x41, 0x41, 0x41, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x12, 0x12, 0x12, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x29, 0x29, 0x29, 0xff, 0x26, 0x26, 0x26, 0xff, 0x22, 0x22, 0x22, 0xfa, 0x26, 0x26, 0x26, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x88, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x04, 0x04, 0x04, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x13, 0x13, 0x13, 0xff, 0x12, 0x12, 0x12, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x15, 0x15, 0x15, 0xff, 0x14, 0x14, 0x14, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x07, 0x07, 0x07, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x08, 0x08, 0x08, 0xff, 0x19, 0x19, 0x19, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x17, 0x17, 0x17, 0xff, 0x17, 0x17, 0x17, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x22, 0x22, 0x22, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x43, 0x43, 0x43, 0xff, 0x54, 0x54, 0x54, 0xff, 0x68, 0x68, 0x68, 0xff, 0x62, 0x62, 0x62, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x60, 0x60, 0x60, 0xff, 0x78, 0x78, 0x78, 0xff, 0x74, 0x74, 0x74, 0xff, 0x66, 0x66, 0x66, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x72, 0x72, 0x72, 0xff, 0x66, 0x66, 0x66, 0xff, 0x70, 0x70, 0x70, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x84, 0x84, 0x84, 0xff, 0x82, 0x82, 0x82, 0xff, 0x83, 0x83, 0x83, 0xff, 0x87, 0x87, 0x87, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x90, 0x90, 0x90, 0xff, 0x92, 0x92, 0x92, 0xff, 0x92, 0x92, 0x92, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x85, 0x85, 0x85, 0xff, 0x80, 0x80, 0x80, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x70, 0x70, 0x70, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x60, 0x60, 0x60, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x44, 0x44, 0x44, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x32, 0x32, 0x32, 0xff, 0x31, 0x31, 0x31, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x33, 0x33, 0x33, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x55, 0x55, 0x55, 0xff, 0x23, 0x23, 0x23, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0x86, 0x86, 0x86, 0xff, 0x29, 0x29, 0x29, 0xff, 0x40, 0x40, 0x40, 0xff, 0x25, 0x25, 0x25, 0xff, 0x10, 0x10, 0x10, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x25, 0x25, 0x25, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x25, 0x25, 0x25, 0xff, 0x1b, 0x1b, 0x1b, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x01, 0x01, 0xdb, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x05, 0x05, 0x05, 0xff, 0x11, 0x11, 0x11, 0xff, 0x16, 0x16, 0x16, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x07, 0x07, 0x07, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x10, 0x10, 0x10, 0xff, 0x10, 0x10, 0x10, 0xff, 0x13, 0x13, 0x13, 0xff, 0x16, 0x16, 0x16, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x04, 0x04, 0x04, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x01, 0x01, 0x01, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x18, 0x18, 0x18, 0xff, 0x16, 0x16, 0x16, 0xff, 0x18, 0x18, 0x18, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x30, 0x30, 0x30, 0xff, 0x43, 0x43, 0x43, 0xff, 0x53, 0x53, 0x53, 0xff, 0x71, 0x71, 0x71, 0xff, 0x66, 0x66, 0x66, 0xff, 0x63, 0x63, 0x63, 0xff, 0x60, 0x60, 0x60, 0xff, 0x74, 0x74, 0x74, 0xff, 0x79, 0x79, 0x79, 0xff, 0x71, 0x71, 0x71, 0xff, 0x66, 0x66, 0x66, 0xff, 0x79, 0x79, 0x79, 0xff, 0x80, 0x80, 0x80, 0xff, 0x73, 0x73, 0x73, 0xff, 0x67, 0x67, 0x67, 0xff, 0x72, 0x72, 0x72, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x79, 0x79, 0x79, 0xff, 0x78, 0x78, 0x78, 0xff, 0x85, 0x85, 0x85, 0xff, 0x85, 0x85, 0x85, 0xff, 0x85, 0x85, 0x85, 0xff, 0x88, 0x88, 0x88, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x92, 0x92, 0x92, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x88, 0x88, 0x88, 0xff, 0x84, 0x84, 0x84, 0xff, 0x81, 0x81, 0x81, 0xff, 0x78, 0x78, 0x78, 0xff, 0x71, 0x71, 0x71, 0xff, 0x66, 0x66, 0x66, 0xff, 0x60, 0x60, 0x60, 0xff, 0x49, 0x49, 0x49, 0xff, 0x21, 0x21, 0x21, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x22, 0x22, 0x22, 0xff, 0x46, 0x46, 0x46, 0xff, 0x27, 0x27, 0x27, 0xff, 0x22, 0x22, 0x22, 0xff, 0x27, 0x27, 0x27, 0xff, 0x15, 0x15, 0x15, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x45, 0x45, 0x45, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x33, 0x33, 0x33, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x30, 0x30, 0x30, 0xff, 0x72, 0x72, 0x72, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x56, 0x56, 0x56, 0xff, 0x36, 0x36, 0x36, 0xff, 0x29, 0x29, 0x29, 0xff, 0x18, 0x18, 0x18, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x26, 0x26, 0x26, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x23, 0x23, 0x23, 0xff, 0x1f, 0x1f, 0x1f, 0xdb, 0x1c, 0x1c, 0x1c, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x02, 0x02, 0x02, 0xfe, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x05, 0x05, 0x05, 0xff, 0x16, 0x16, 0x16, 0xff, 0x23, 0x23, 0x23, 0xff, 0x11, 0x11, 0x11, 0xff, 0x04, 0x04, 0x04, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x10, 0x10, 0x10, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x10, 0x10, 0x10, 0xff, 0x15, 0x15, 0x15, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x08, 0x08, 0x08, 0xff, 0x05, 0x05, 0x05, 0xff, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x03, 0x03, 0x03, 0xff, 0x14, 0x14, 0x14, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x18, 0x18, 0x18, 0xff, 0x16, 0x16, 0x16, 0xff, 0x15, 0x15, 0x15, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x44, 0x44, 0x44, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x65, 0x65, 0x65, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x66, 0x66, 0x66, 0xff, 0x71, 0x71, 0x71, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x76, 0x76, 0x76, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x78, 0x78, 0x78, 0xff, 0x73, 0x73, 0x73, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x69, 0x69, 0x69, 0xff, 0x72, 0x72, 0x72, 0xff, 0x76, 0x76, 0x76, 0xff, 0x76, 0x76, 0x76, 0xff, 0x77, 0x77, 0x77, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x81, 0x81, 0x81, 0xff, 0x85, 0x85, 0x85, 0xff, 0x88, 0x88, 0x88, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x88, 0x88, 0x88, 0xff, 0x86, 0x86, 0x86, 0xff, 0x86, 0x86, 0x86, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x78, 0x78, 0x78, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x64, 0x64, 0x64, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x48, 0x48, 0x48, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x11, 0x11, 0x11, 0xff, 0x10, 0x10, 0x10, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x39, 0x39, 0x39, 0xff, 0x17, 0x17, 0x17, 0xff, 0x18, 0x18, 0x18, 0xff, 0x19, 0x19, 0x19, 0xff, 0x20, 0x20, 0x20, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x35, 0x35, 0x35, 0xff, 0x25, 0x25, 0x25, 0xff, 0x55, 0x55, 0x55, 0xff, 0x46, 0x46, 0x46, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x97, 0x97, 0x97, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x31, 0x31, 0x31, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x28, 0x28, 0x28, 0xff, 0x33, 0x33, 0x33, 0xff, 0x24, 0x24, 0x24, 0xff, 0x19, 0x19, 0x19, 0xfe, 0x23, 0x23, 0x23, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x8f, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x12, 0x12, 0x12, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x14, 0x14, 0x14, 0xff, 0x16, 0x16, 0x16, 0xff, 0x18, 0x18, 0x18, 0xff, 0x15, 0x15, 0x15, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x09, 0x09, 0x09, 0xff, 0x09, 0x09, 0x09, 0xff, 0x05, 0x05, 0x05, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x06, 0x06, 0x06, 0xff, 0x09, 0x09, 0x09, 0xff, 0x04, 0x04, 0x04, 0xff, 0x09, 0x09, 0x09, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x19, 0x19, 0x19, 0xff, 0x17, 0x17, 0x17, 0xff, 0x16, 0x16, 0x16, 0xff, 0x17, 0x17, 0x17, 0xff, 0x33, 0x33, 0x33, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x66, 0x66, 0x66, 0xff, 0x72, 0x72, 0x72, 0xff, 0x67, 0x67, 0x67, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x71, 0x71, 0x71, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x78, 0x78, 0x78, 0xff, 0x74, 0x74, 0x74, 0xff, 0x65, 0x65, 0x65, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x64, 0x64, 0x64, 0xff, 0x65, 0x65, 0x65, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x73, 0x73, 0x73, 0xff, 0x74, 0x74, 0x74, 0xff, 0x75, 0x75, 0x75, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x83, 0x83, 0x83, 0xff, 0x89, 0x89, 0x89, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x86, 0x86, 0x86, 0xff, 0x84, 0x84, 0x84, 0xff, 0x87, 0x87, 0x87, 0xff, 0x81, 0x81, 0x81, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x75, 0x75, 0x75, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x62, 0x62, 0x62, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x32, 0x32, 0x32, 0xff, 0x17, 0x17, 0x17, 0xff, 0x13, 0x13, 0x13, 0xff, 0x08, 0x08, 0x08, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x21, 0x21, 0x21, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x13, 0x13, 0x13, 0xff, 0x14, 0x14, 0x14, 0xff, 0x26, 0x26, 0x26, 0xff, 0x42, 0x42, 0x42, 0xff, 0x44, 0x44, 0x44, 0xff, 0x38, 0x38, 0x38, 0xff, 0x33, 0x33, 0x33, 0xff, 0x54, 0x54, 0x54, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x73, 0x73, 0x73, 0xff, 0x96, 0x96, 0x96, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x21, 0x21, 0x21, 0xff, 0x19, 0x19, 0x19, 0xff, 0x24, 0x24, 0x24, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x25, 0x25, 0x25, 0xff, 0x19, 0x19, 0x19, 0xff, 0x23, 0x23, 0x23, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x02, 0x02, 0xd1, 0x03, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x31, 0x31, 0x31, 0xff, 0x16, 0x16, 0x16, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x13, 0x13, 0x13, 0xff, 0x28, 0x28, 0x28, 0xff, 0x22, 0x22, 0x22, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x09, 0x09, 0x09, 0xff, 0x06, 0x06, 0x06, 0xff, 0x02, 0x02, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x04, 0x04, 0x04, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x03, 0x03, 0x03, 0xff, 0x10, 0x10, 0x10, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x20, 0x20, 0x20, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x19, 0x19, 0x19, 0xff, 0x18, 0x18, 0x18, 0xff, 0x14, 0x14, 0x14, 0xff, 0x18, 0x18, 0x18, 0xff, 0x38, 0x38, 0x38, 0xff, 0x44, 0x44, 0x44, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x67, 0x67, 0x67, 0xff, 0x71, 0x71, 0x71, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x70, 0x70, 0x70, 0xff, 0x73, 0x73, 0x73, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x74, 0x74, 0x74, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x66, 0x66, 0x66, 0xff, 0x68, 0x68, 0x68, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x63, 0x63, 0x63, 0xff, 0x66, 0x66, 0x66, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x71, 0x71, 0x71, 0xff, 0x76, 0x76, 0x76, 0xff, 0x79, 0x79, 0x79, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x80, 0x80, 0x80, 0xff, 0x84, 0x84, 0x84, 0xff, 0x80, 0x80, 0x80, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x80, 0x80, 0x80, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x75, 0x75, 0x75, 0xff, 0x68, 0x68, 0x68, 0xff, 0x62, 0x62, 0x62, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x58, 0x58, 0x58, 0xff, 0x50, 0x50, 0x50, 0xff, 0x40, 0x40, 0x40, 0xff, 0x24, 0x24, 0x24, 0xff, 0x13, 0x13, 0x13, 0xff, 0x13, 0x13, 0x13, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x18, 0x18, 0x18, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x21, 0x21, 0x21, 0xff, 0x14, 0x14, 0x14, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x51, 0x51, 0x51, 0xff, 0x49, 0x49, 0x49, 0xff, 0x90, 0x90, 0x90, 0xff, 0x67, 0x67, 0x67, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x17, 0x17, 0x17, 0xff, 0x22, 0x22, 0x22, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x23, 0x23, 0x23, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x23, 0x23, 0x23, 0xd1, 0x1f, 0x1f, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x02, 0x02, 0x02, 0xf3, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x08, 0x08, 0x08, 0xff, 0x24, 0x24, 0x24, 0xff, 0x35, 0x35, 0x35, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x12, 0x12, 0x12, 0xff, 0x19, 0x19, 0x19, 0xff, 0x25, 0x25, 0x25, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x06, 0x06, 0x06, 0xff, 0x02, 0x02, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xff, 0x05, 0x05, 0x05, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x17, 0x17, 0x17, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x20, 0x20, 0x20, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x18, 0x18, 0x18, 0xff, 0x17, 0x17, 0x17, 0xff, 0x25, 0x25, 0x25, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x54, 0x54, 0x54, 0xff, 0x63, 0x63, 0x63, 0xff, 0x70, 0x70, 0x70, 0xff, 0x72, 0x72, 0x72, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x73, 0x73, 0x73, 0xff, 0x64, 0x64, 0x64, 0xff, 0x62, 0x62, 0x62, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x63, 0x63, 0x63, 0xff, 0x69, 0x69, 0x69, 0xff, 0x66, 0x66, 0x66, 0xff, 0x69, 0x69, 0x69, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x72, 0x72, 0x72, 0xff, 0x74, 0x74, 0x74, 0xff, 0x75, 0x75, 0x75, 0xff, 0x78, 0x78, 0x78, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x77, 0x77, 0x77, 0xff, 0x71, 0x71, 0x71, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x63, 0x63, 0x63, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x56, 0x56, 0x56, 0xff, 0x56, 0x56, 0x56, 0xff, 0x57, 0x57, 0x57, 0xff, 0x57, 0x57, 0x57, 0xff, 0x57, 0x57, 0x57, 0xff, 0x41, 0x41, 0x41, 0xff, 0x19, 0x19, 0x19, 0xff, 0x15, 0x15, 0x15, 0xff, 0x11, 0x11, 0x11, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x27, 0x27, 0x27, 0xff, 0x16, 0x16, 0x16, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x09, 0x09, 0x09, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x52, 0x52, 0x52, 0xff, 0x57, 0x57, 0x57, 0xff, 0x70, 0x70, 0x70, 0xff, 0x71, 0x71, 0x71, 0xff, 0x21, 0x21, 0x21, 0xff, 0x12, 0x12, 0x12, 0xff, 0x25, 0x25, 0x25, 0xff, 0x26, 0x26, 0x26, 0xff, 0x26, 0x26, 0x26, 0xff, 0x27, 0x27, 0x27, 0xff, 0x22, 0x22, 0x22, 0xff, 0x27, 0x27, 0x27, 0xf4, 0x2a, 0x2a, 0x2a, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x55, 0x02, 0x02, 0x02, 0xfe, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x24, 0x24, 0x24, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x18, 0x18, 0x18, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x12, 0x12, 0x12, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x09, 0x09, 0x09, 0xff, 0x06, 0x06, 0x06, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x04, 0x04, 0x04, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x05, 0x05, 0x05, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x20, 0x20, 0x20, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x19, 0x19, 0x19, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x23, 0x23, 0x23, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x54, 0x54, 0x54, 0xff, 0x60, 0x60, 0x60, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x74, 0x74, 0x74, 0xff, 0x70, 0x70, 0x70, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x70, 0x70, 0x70, 0xff, 0x73, 0x73, 0x73, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x57, 0x57, 0x57, 0xff, 0x57, 0x57, 0x57, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x64, 0x64, 0x64, 0xff, 0x65, 0x65, 0x65, 0xff, 0x65, 0x65, 0x65, 0xff, 0x69, 0x69, 0x69, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x73, 0x73, 0x73, 0xff, 0x79, 0x79, 0x79, 0xff, 0x78, 0x78, 0x78, 0xff, 0x75, 0x75, 0x75, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x67, 0x67, 0x67, 0xff, 0x60, 0x60, 0x60, 0xff, 0x55, 0x55, 0x55, 0xff, 0x57, 0x57, 0x57, 0xff, 0x60, 0x60, 0x60, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x60, 0x60, 0x60, 0xff, 0x64, 0x64, 0x64, 0xff, 0x65, 0x65, 0x65, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x11, 0x11, 0x11, 0xff, 0x13, 0x13, 0x13, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x31, 0x31, 0x31, 0xff, 0x24, 0x24, 0x24, 0xff, 0x28, 0x28, 0x28, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x12, 0x12, 0x12, 0xff, 0x11, 0x11, 0x11, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x31, 0x31, 0x31, 0xff, 0x13, 0x13, 0x13, 0xff, 0x25, 0x25, 0x25, 0xff, 0x24, 0x24, 0x24, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x33, 0x33, 0x33, 0xff, 0x2f, 0x2f, 0x2f, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x8d, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x22, 0x22, 0x22, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x16, 0x16, 0x16, 0xff, 0x19, 0x19, 0x19, 0xff, 0x16, 0x16, 0x16, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x03, 0x03, 0x03, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x08, 0x08, 0x08, 0xff, 0x09, 0x09, 0x09, 0xff, 0x16, 0x16, 0x16, 0xff, 0x22, 0x22, 0x22, 0xff, 0x23, 0x23, 0x23, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x16, 0x16, 0x16, 0xff, 0x22, 0x22, 0x22, 0xff, 0x40, 0x40, 0x40, 0xff, 0x54, 0x54, 0x54, 0xff, 0x60, 0x60, 0x60, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x72, 0x72, 0x72, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x60, 0x60, 0x60, 0xff, 0x68, 0x68, 0x68, 0xff, 0x51, 0x51, 0x51, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x51, 0x51, 0x51, 0xff, 0x57, 0x57, 0x57, 0xff, 0x56, 0x56, 0x56, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x64, 0x64, 0x64, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x64, 0x64, 0x64, 0xff, 0x69, 0x69, 0x69, 0xff, 0x71, 0x71, 0x71, 0xff, 0x77, 0x77, 0x77, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x66, 0x66, 0x66, 0xff, 0x63, 0x63, 0x63, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x58, 0x58, 0x58, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x62, 0x62, 0x62, 0xff, 0x68, 0x68, 0x68, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x69, 0x69, 0x69, 0xff, 0x75, 0x75, 0x75, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x32, 0x32, 0x32, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x27, 0x27, 0x27, 0xff, 0x25, 0x25, 0x25, 0xff, 0x19, 0x19, 0x19, 0xff, 0x12, 0x12, 0x12, 0xff, 0x53, 0x53, 0x53, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x65, 0x65, 0x65, 0xff, 0x36, 0x36, 0x36, 0xff, 0x17, 0x17, 0x17, 0xff, 0x21, 0x21, 0x21, 0xff, 0x26, 0x26, 0x26, 0xff, 0x23, 0x23, 0x23, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x35, 0x35, 0x35, 0xff, 0x37, 0x37, 0x37, 0xff, 0x29, 0x29, 0x29, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x01, 0xb1, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x06, 0x06, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x03, 0x03, 0x03, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x11, 0x11, 0x11, 0xff, 0x12, 0x12, 0x12, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x10, 0x10, 0x10, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x11, 0x11, 0x11, 0xff, 0x12, 0x12, 0x12, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x24, 0x24, 0x24, 0xff, 0x23, 0x23, 0x23, 0xff, 0x21, 0x21, 0x21, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x21, 0x21, 0x21, 0xff, 0x21, 0x21, 0x21, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x18, 0x18, 0x18, 0xff, 0x22, 0x22, 0x22, 0xff, 0x42, 0x42, 0x42, 0xff, 0x57, 0x57, 0x57, 0xff, 0x65, 0x65, 0x65, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x65, 0x65, 0x65, 0xff, 0x54, 0x54, 0x54, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x49, 0x49, 0x49, 0xff, 0x53, 0x53, 0x53, 0xff, 0x58, 0x58, 0x58, 0xff, 0x57, 0x57, 0x57, 0xff, 0x57, 0x57, 0x57, 0xff, 0x57, 0x57, 0x57, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x71, 0x71, 0x71, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x67, 0x67, 0x67, 0xff, 0x63, 0x63, 0x63, 0xff, 0x61, 0x61, 0x61, 0xff, 0x63, 0x63, 0x63, 0xff, 0x63, 0x63, 0x63, 0xff, 0x61, 0x61, 0x61, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x62, 0x62, 0x62, 0xff, 0x63, 0x63, 0x63, 0xff, 0x68, 0x68, 0x68, 0xff, 0x77, 0x77, 0x77, 0xff, 0x78, 0x78, 0x78, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x64, 0x64, 0x64, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x05, 0x05, 0x05, 0xff, 0x24, 0x24, 0x24, 0xff, 0x69, 0x69, 0x69, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x45, 0x45, 0x45, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x26, 0x26, 0x26, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x75, 0x75, 0x75, 0xff, 0x69, 0x69, 0x69, 0xff, 0x39, 0x39, 0x39, 0xff, 0x21, 0x21, 0x21, 0xff, 0x26, 0x26, 0x26, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x31, 0x31, 0x31, 0xff, 0x24, 0x24, 0x24, 0xff, 0x18, 0x18, 0x18, 0xb1, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x02, 0x02, 0x02, 0xc8, 0x04, 0x04, 0x04, 0xff, 0x03, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x02, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x09, 0x09, 0x09, 0xff, 0x10, 0x10, 0x10, 0xff, 0x15, 0x15, 0x15, 0xff, 0x14, 0x14, 0x14, 0xff, 0x11, 0x11, 0x11, 0xff, 0x11, 0x11, 0x11, 0xff, 0x11, 0x11, 0x11, 0xff, 0x12, 0x12, 0x12, 0xff, 0x13, 0x13, 0x13, 0xff, 0x14, 0x14, 0x14, 0xff, 0x12, 0x12, 0x12, 0xff, 0x11, 0x11, 0x11, 0xff, 0x11, 0x11, 0x11, 0xff, 0x13, 0x13, 0x13, 0xff, 0x16, 0x16, 0x16, 0xff, 0x11, 0x11, 0x11, 0xff, 0x09, 0x09, 0x09, 0xff, 0x09, 0x09, 0x09, 0xff, 0x16, 0x16, 0x16, 0xff, 0x23, 0x23, 0x23, 0xff, 0x25, 0x25, 0x25, 0xff, 0x23, 0x23, 0x23, 0xff, 0x21, 0x21, 0x21, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x22, 0x22, 0x22, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x27, 0x27, 0x27, 0xff, 0x44, 0x44, 0x44, 0xff, 0x58, 0x58, 0x58, 0xff, 0x67, 0x67, 0x67, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x68, 0x68, 0x68, 0xff, 0x66, 0x66, 0x66, 0xff, 0x58, 0x58, 0x58, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x51, 0x51, 0x51, 0xff, 0x43, 0x43, 0x43, 0xff, 0x47, 0x47, 0x47, 0xff, 0x51, 0x51, 0x51, 0xff, 0x53, 0x53, 0x53, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x50, 0x50, 0x50, 0xff, 0x58, 0x58, 0x58, 0xff, 0x63, 0x63, 0x63, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x71, 0x71, 0x71, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x66, 0x66, 0x66, 0xff, 0x67, 0x67, 0x67, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x72, 0x72, 0x72, 0xff, 0x72, 0x72, 0x72, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x56, 0x56, 0x56, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x81, 0x81, 0x81, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x11, 0x11, 0x11, 0xff, 0x62, 0x62, 0x62, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x60, 0x60, 0x60, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x28, 0x28, 0x28, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x79, 0x79, 0x79, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x45, 0x45, 0x45, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x31, 0x31, 0x31, 0xff, 0x26, 0x26, 0x26, 0xff, 0x32, 0x32, 0x32, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x26, 0x26, 0x26, 0xff, 0x27, 0x27, 0x27, 0xc8, 0x33, 0x33, 0x33, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x29, 0x29, 0x29, 0xff, 0x30, 0x30, 0x30, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x29, 0x29, 0x29, 0xff, 0x23, 0x23, 0x23, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x24, 0x24, 0x24, 0xff, 0x24, 0x24, 0x24, 0xff, 0x22, 0x22, 0x22, 0xff, 0x20, 0x20, 0x20, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x17, 0x17, 0x17, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x20, 0x20, 0x20, 0xff, 0x25, 0x25, 0x25, 0xff, 0x25, 0x25, 0x25, 0xff, 0x24, 0x24, 0x24, 0xff, 0x22, 0x22, 0x22, 0xff, 0x20, 0x20, 0x20, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x21, 0x21, 0x21, 0xff, 0x22, 0x22, 0x22, 0xff, 0x27, 0x27, 0x27, 0xff, 0x28, 0x28, 0x28, 0xff, 0x26, 0x26, 0x26, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x47, 0x47, 0x47, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x66, 0x66, 0x66, 0xff, 0x69, 0x69, 0x69, 0xff, 0x64, 0x64, 0x64, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x46, 0x46, 0x46, 0xff, 0x43, 0x43, 0x43, 0xff, 0x54, 0x54, 0x54, 0xff, 0x50, 0x50, 0x50, 0xff, 0x45, 0x45, 0x45, 0xff, 0x49, 0x49, 0x49, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x49, 0x49, 0x49, 0xff, 0x54, 0x54, 0x54, 0xff, 0x60, 0x60, 0x60, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x70, 0x70, 0x70, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x68, 0x68, 0x68, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x71, 0x71, 0x71, 0xff, 0x79, 0x79, 0x79, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x83, 0x83, 0x83, 0xff, 0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x55, 0x55, 0x55, 0xff, 0x47, 0x47, 0x47, 0xff, 0x56, 0x56, 0x56, 0xff, 0x67, 0x67, 0x67, 0xff, 0x38, 0x38, 0x38, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x51, 0x51, 0x51, 0xff, 0x69, 0x69, 0x69, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x40, 0x40, 0x40, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x66, 0x66, 0x66, 0xff, 0x37, 0x37, 0x37, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x31, 0x31, 0x31, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x31, 0x31, 0x31, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x43, 0x43, 0x43, 0xff, 0x4f, 0x4f, 0x4f, 0xd8, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x0d, 0x0d, 0x0d, 0xdc, 0x1d, 0x1d, 0x1d, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x35, 0x35, 0x35, 0xff, 0x37, 0x37, 0x37, 0xff, 0x39, 0x39, 0x39, 0xff, 0x35, 0x35, 0x35, 0xff, 0x30, 0x30, 0x30, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x31, 0x31, 0x31, 0xff, 0x31, 0x31, 0x31, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x26, 0x26, 0x26, 0xff, 0x23, 0x23, 0x23, 0xff, 0x20, 0x20, 0x20, 0xff, 0x13, 0x13, 0x13, 0xff, 0x09, 0x09, 0x09, 0xff, 0x09, 0x09, 0x09, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x26, 0x26, 0x26, 0xff, 0x24, 0x24, 0x24, 0xff, 0x24, 0x24, 0x24, 0xff, 0x24, 0x24, 0x24, 0xff, 0x22, 0x22, 0x22, 0xff, 0x21, 0x21, 0x21, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x22, 0x22, 0x22, 0xff, 0x27, 0x27, 0x27, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x32, 0x32, 0x32, 0xff, 0x34, 0x34, 0x34, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x49, 0x49, 0x49, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x65, 0x65, 0x65, 0xff, 0x65, 0x65, 0x65, 0xff, 0x60, 0x60, 0x60, 0xff, 0x56, 0x56, 0x56, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x47, 0x47, 0x47, 0xff, 0x45, 0x45, 0x45, 0xff, 0x49, 0x49, 0x49, 0xff, 0x50, 0x50, 0x50, 0xff, 0x44, 0x44, 0x44, 0xff, 0x41, 0x41, 0x41, 0xff, 0x42, 0x42, 0x42, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x60, 0x60, 0x60, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x70, 0x70, 0x70, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x73, 0x73, 0x73, 0xff, 0x77, 0x77, 0x77, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x85, 0x85, 0x85, 0xff, 0x87, 0x87, 0x87, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x61, 0x61, 0x61, 0xff, 0x47, 0x47, 0x47, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x39, 0x39, 0x39, 0xff, 0x32, 0x32, 0x32, 0xff, 0x32, 0x32, 0x32, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x65, 0x65, 0x65, 0xff, 0x61, 0x61, 0x61, 0xff, 0x48, 0x48, 0x48, 0xff, 0x44, 0x44, 0x44, 0xff, 0x43, 0x43, 0x43, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x41, 0x41, 0x41, 0xff, 0x47, 0x47, 0x47, 0xdd, 0x48, 0x48, 0x48, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x2e, 0x2e, 0x21, 0x34, 0x34, 0x34, 0xde, 0x33, 0x33, 0x33, 0xff, 0x35, 0x35, 0x35, 0xff, 0x37, 0x37, 0x37, 0xff, 0x36, 0x36, 0x36, 0xff, 0x32, 0x32, 0x32, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x33, 0x33, 0x33, 0xff, 0x35, 0x35, 0x35, 0xff, 0x32, 0x32, 0x32, 0xff, 0x30, 0x30, 0x30, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x28, 0x28, 0x28, 0xff, 0x27, 0x27, 0x27, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x07, 0x07, 0x07, 0xff, 0x12, 0x12, 0x12, 0xff, 0x25, 0x25, 0x25, 0xff, 0x26, 0x26, 0x26, 0xff, 0x26, 0x26, 0x26, 0xff, 0x27, 0x27, 0x27, 0xff, 0x25, 0x25, 0x25, 0xff, 0x24, 0x24, 0x24, 0xff, 0x23, 0x23, 0x23, 0xff, 0x24, 0x24, 0x24, 0xff, 0x21, 0x21, 0x21, 0xff, 0x23, 0x23, 0x23, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x37, 0x37, 0x37, 0xff, 0x45, 0x45, 0x45, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x54, 0x54, 0x54, 0xff, 0x50, 0x50, 0x50, 0xff, 0x50, 0x50, 0x50, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x59, 0x59, 0x59, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x49, 0x49, 0x49, 0xff, 0x44, 0x44, 0x44, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x48, 0x48, 0x48, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x41, 0x41, 0x41, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x43, 0x43, 0x43, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x69, 0x69, 0x69, 0xff, 0x71, 0x71, 0x71, 0xff, 0x70, 0x70, 0x70, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x74, 0x74, 0x74, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x80, 0x80, 0x80, 0xff, 0x83, 0x83, 0x83, 0xff, 0x86, 0x86, 0x86, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x90, 0x90, 0x90, 0xff, 0x96, 0x96, 0x96, 0xff, 0x97, 0x97, 0x97, 0xff, 0x93, 0x93, 0x93, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x84, 0x84, 0x84, 0xff, 0x69, 0x69, 0x69, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x39, 0x39, 0x39, 0xff, 0x21, 0x21, 0x21, 0xff, 0x24, 0x24, 0x24, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x66, 0x66, 0x66, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x68, 0x68, 0x68, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x57, 0x57, 0x57, 0xff, 0x57, 0x57, 0x57, 0xff, 0x56, 0x56, 0x56, 0xff, 0x55, 0x55, 0x55, 0xff, 0x50, 0x50, 0x50, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x48, 0x48, 0x48, 0xde, 0x45, 0x45, 0x45, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x31, 0x31, 0x1a, 0x34, 0x34, 0x34, 0xd7, 0x35, 0x35, 0x35, 0xff, 0x36, 0x36, 0x36, 0xff, 0x34, 0x34, 0x34, 0xff, 0x31, 0x31, 0x31, 0xff, 0x30, 0x30, 0x30, 0xff, 0x33, 0x33, 0x33, 0xff, 0x36, 0x36, 0x36, 0xff, 0x37, 0x37, 0x37, 0xff, 0x34, 0x34, 0x34, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x27, 0x27, 0x27, 0xff, 0x24, 0x24, 0x24, 0xff, 0x13, 0x13, 0x13, 0xff, 0x09, 0x09, 0x09, 0xff, 0x09, 0x09, 0x09, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x28, 0x28, 0x28, 0xff, 0x29, 0x29, 0x29, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x27, 0x27, 0x27, 0xff, 0x27, 0x27, 0x27, 0xff, 0x27, 0x27, 0x27, 0xff, 0x27, 0x27, 0x27, 0xff, 0x28, 0x28, 0x28, 0xff, 0x26, 0x26, 0x26, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x42, 0x42, 0x42, 0xff, 0x58, 0x58, 0x58, 0xff, 0x68, 0x68, 0x68, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x69, 0x69, 0x69, 0xff, 0x62, 0x62, 0x62, 0xff, 0x60, 0x60, 0x60, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x58, 0x58, 0x58, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x45, 0x45, 0x45, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x49, 0x49, 0x49, 0xff, 0x47, 0x47, 0x47, 0xff, 0x42, 0x42, 0x42, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x60, 0x60, 0x60, 0xff, 0x65, 0x65, 0x65, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x68, 0x68, 0x68, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x70, 0x70, 0x70, 0xff, 0x75, 0x75, 0x75, 0xff, 0x79, 0x79, 0x79, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x83, 0x83, 0x83, 0xff, 0x86, 0x86, 0x86, 0xff, 0x89, 0x89, 0x89, 0xff, 0x90, 0x90, 0x90, 0xff, 0x91, 0x91, 0x91, 0xff, 0x96, 0x96, 0x96, 0xff, 0x99, 0x99, 0x99, 0xff, 0x96, 0x96, 0x96, 0xff, 0x92, 0x92, 0x92, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x89, 0x89, 0x89, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x50, 0x50, 0x50, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x01, 0x01, 0x01, 0xff, 0x23, 0x23, 0x23, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x89, 0x89, 0x89, 0xff, 0x81, 0x81, 0x81, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x76, 0x76, 0x76, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x65, 0x65, 0x65, 0xff, 0x60, 0x60, 0x60, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x59, 0x59, 0x59, 0xff, 0x54, 0x54, 0x54, 0xd7, 0x55, 0x55, 0x55, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x2e, 0x2e, 0x16, 0x37, 0x37, 0x37, 0xca, 0x37, 0x37, 0x37, 0xff, 0x34, 0x34, 0x34, 0xff, 0x33, 0x33, 0x33, 0xff, 0x34, 0x34, 0x34, 0xff, 0x36, 0x36, 0x36, 0xff, 0x37, 0x37, 0x37, 0xff, 0x36, 0x36, 0x36, 0xff, 0x34, 0x34, 0x34, 0xff, 0x31, 0x31, 0x31, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x28, 0x28, 0x28, 0xff, 0x28, 0x28, 0x28, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x08, 0x08, 0x08, 0xff, 0x14, 0x14, 0x14, 0xff, 0x26, 0x26, 0x26, 0xff, 0x28, 0x28, 0x28, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x29, 0x29, 0x29, 0xff, 0x29, 0x29, 0x29, 0xff, 0x29, 0x29, 0x29, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x36, 0x36, 0x36, 0xff, 0x48, 0x48, 0x48, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x70, 0x70, 0x70, 0xff, 0x75, 0x75, 0x75, 0xff, 0x72, 0x72, 0x72, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x65, 0x65, 0x65, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x52, 0x52, 0x52, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x46, 0x46, 0x46, 0xff, 0x46, 0x46, 0x46, 0xff, 0x47, 0x47, 0x47, 0xff, 0x44, 0x44, 0x44, 0xff, 0x43, 0x43, 0x43, 0xff, 0x53, 0x53, 0x53, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x61, 0x61, 0x61, 0xff, 0x61, 0x61, 0x61, 0xff, 0x64, 0x64, 0x64, 0xff, 0x69, 0x69, 0x69, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x72, 0x72, 0x72, 0xff, 0x75, 0x75, 0x75, 0xff, 0x79, 0x79, 0x79, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x82, 0x82, 0x82, 0xff, 0x88, 0x88, 0x88, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x91, 0x91, 0x91, 0xff, 0x95, 0x95, 0x95, 0xff, 0x96, 0x96, 0x96, 0xff, 0x94, 0x94, 0x94, 0xff, 0x91, 0x91, 0x91, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x85, 0x85, 0x85, 0xff, 0x83, 0x83, 0x83, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x15, 0x15, 0x15, 0xff, 0x78, 0x78, 0x78, 0xff, 0x95, 0x95, 0x95, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x84, 0x84, 0x84, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x75, 0x75, 0x75, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x6b, 0x6b, 0x6b, 0xca, 0x68, 0x68, 0x68, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x2e, 0x2e, 0x0b, 0x37, 0x37, 0x37, 0xaf, 0x36, 0x36, 0x36, 0xff, 0x37, 0x37, 0x37, 0xff, 0x38, 0x38, 0x38, 0xff, 0x39, 0x39, 0x39, 0xff, 0x38, 0x38, 0x38, 0xff, 0x35, 0x35, 0x35, 0xff, 0x32, 0x32, 0x32, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x24, 0x24, 0x24, 0xff, 0x14, 0x14, 0x14, 0xff, 0x09, 0x09, 0x09, 0xff, 0x08, 0x08, 0x08, 0xff, 0x20, 0x20, 0x20, 0xff, 0x27, 0x27, 0x27, 0xff, 0x27, 0x27, 0x27, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x29, 0x29, 0x29, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x34, 0x34, 0x34, 0xff, 0x40, 0x40, 0x40, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x73, 0x73, 0x73, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x66, 0x66, 0x66, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x57, 0x57, 0x57, 0xff, 0x50, 0x50, 0x50, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x49, 0x49, 0x49, 0xff, 0x48, 0x48, 0x48, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x53, 0x53, 0x53, 0xff, 0x58, 0x58, 0x58, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x61, 0x61, 0x61, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x73, 0x73, 0x73, 0xff, 0x78, 0x78, 0x78, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x87, 0x87, 0x87, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x91, 0x91, 0x91, 0xff, 0x92, 0x92, 0x92, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x86, 0x86, 0x86, 0xff, 0x84, 0x84, 0x84, 0xff, 0x80, 0x80, 0x80, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x05, 0x05, 0x05, 0xff, 0x09, 0x09, 0x09, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0x92, 0x92, 0x92, 0xff, 0x93, 0x93, 0x93, 0xff, 0x95, 0x95, 0x95, 0xff, 0x94, 0x94, 0x94, 0xff, 0x90, 0x90, 0x90, 0xff, 0x88, 0x88, 0x88, 0xff, 0x83, 0x83, 0x83, 0xff, 0x82, 0x82, 0x82, 0xb0, 0x73, 0x73, 0x73, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x38, 0x38, 0x38, 0x8b, 0x38, 0x38, 0x38, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x39, 0x39, 0x39, 0xff, 0x36, 0x36, 0x36, 0xff, 0x33, 0x33, 0x33, 0xff, 0x31, 0x31, 0x31, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x29, 0x29, 0x29, 0xff, 0x28, 0x28, 0x28, 0xff, 0x1b, 0x1b, 0x1b, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x05, 0x05, 0x05, 0xff, 0x10, 0x10, 0x10, 0xff, 0x23, 0x23, 0x23, 0xff, 0x25, 0x25, 0x25, 0xff, 0x28, 0x28, 0x28, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x30, 0x30, 0x30, 0xff, 0x31, 0x31, 0x31, 0xff, 0x33, 0x33, 0x33, 0xff, 0x37, 0x37, 0x37, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x41, 0x41, 0x41, 0xff, 0x49, 0x49, 0x49, 0xff, 0x55, 0x55, 0x55, 0xff, 0x62, 0x62, 0x62, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x65, 0x65, 0x65, 0xff, 0x63, 0x63, 0x63, 0xff, 0x62, 0x62, 0x62, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x59, 0x59, 0x59, 0xff, 0x57, 0x57, 0x57, 0xff, 0x51, 0x51, 0x51, 0xff, 0x51, 0x51, 0x51, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x53, 0x53, 0x53, 0xff, 0x59, 0x59, 0x59, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x66, 0x66, 0x66, 0xff, 0x70, 0x70, 0x70, 0xff, 0x70, 0x70, 0x70, 0xff, 0x72, 0x72, 0x72, 0xff, 0x78, 0x78, 0x78, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x79, 0x79, 0x79, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x86, 0x86, 0x86, 0xff, 0x87, 0x87, 0x87, 0xff, 0x87, 0x87, 0x87, 0xff, 0x85, 0x85, 0x85, 0xff, 0x81, 0x81, 0x81, 0xff, 0x65, 0x65, 0x65, 0xff, 0x15, 0x15, 0x15, 0xff, 0x00, 0x00, 0x00, 0xff, 0x59, 0x59, 0x59, 0xff, 0x9f, 0x9f, 0x9f, 0xff, 0x97, 0x97, 0x97, 0xff, 0x99, 0x99, 0x99, 0xff, 0x98, 0x98, 0x98, 0xff, 0x99, 0x99, 0x99, 0xff, 0x99, 0x99, 0x99, 0xff, 0x94, 0x94, 0x94, 0xff, 0x8f, 0x8f, 0x8f, 0x8b, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x3a, 0x3a, 0x57, 0x38, 0x38, 0x38, 0xf3, 0x36, 0x36, 0x36, 0xff, 0x34, 0x34, 0x34, 0xff, 0x31, 0x31, 0x31, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x28, 0x28, 0x28, 0xff, 0x23, 0x23, 0x23, 0xff, 0x15, 0x15, 0x15, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x06, 0x06, 0x06, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0x25, 0x25, 0x25, 0xff, 0x24, 0x24, 0x24, 0xff, 0x27, 0x27, 0x27, 0xff, 0x28, 0x28, 0x28, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x30, 0x30, 0x30, 0xff, 0x32, 0x32, 0x32, 0xff, 0x33, 0x33, 0x33, 0xff, 0x36, 0x36, 0x36, 0xff, 0x38, 0x38, 0x38, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x47, 0x47, 0x47, 0xff, 0x52, 0x52, 0x52, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x64, 0x64, 0x64, 0xff, 0x69, 0x69, 0x69, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x69, 0x69, 0x69, 0xff, 0x65, 0x65, 0x65, 0xff, 0x63, 0x63, 0x63, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x58, 0x58, 0x58, 0xff, 0x55, 0x55, 0x55, 0xff, 0x55, 0x55, 0x55, 0xff, 0x52, 0x52, 0x52, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x51, 0x51, 0x51, 0xff, 0x57, 0x57, 0x57, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x67, 0x67, 0x67, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x71, 0x71, 0x71, 0xff, 0x77, 0x77, 0x77, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x80, 0x80, 0x80, 0xff, 0x85, 0x85, 0x85, 0xff, 0x86, 0x86, 0x86, 0xff, 0x88, 0x88, 0x88, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x88, 0x88, 0x88, 0xff, 0x88, 0x88, 0x88, 0xff, 0x89, 0x89, 0x89, 0xff, 0x89, 0x89, 0x89, 0xff, 0x85, 0x85, 0x85, 0xff, 0x85, 0x85, 0x85, 0xff, 0x85, 0x85, 0x85, 0xff, 0x87, 0x87, 0x87, 0xff, 0x85, 0x85, 0x85, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x77, 0x77, 0x77, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x47, 0x47, 0x47, 0xff, 0x9f, 0x9f, 0x9f, 0xff, 0x99, 0x99, 0x99, 0xff, 0x9c, 0x9c, 0x9c, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0x9d, 0x9d, 0x9d, 0xff, 0x9c, 0x9c, 0x9c, 0xf3, 0x98, 0x98, 0x98, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x3b, 0x3b, 0x2b, 0x35, 0x35, 0x35, 0xd2, 0x33, 0x33, 0x33, 0xff, 0x30, 0x30, 0x30, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x28, 0x28, 0x28, 0xff, 0x28, 0x28, 0x28, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x10, 0x10, 0x10, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x21, 0x21, 0x21, 0xff, 0x25, 0x25, 0x25, 0xff, 0x25, 0x25, 0x25, 0xff, 0x26, 0x26, 0x26, 0xff, 0x29, 0x29, 0x29, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x31, 0x31, 0x31, 0xff, 0x34, 0x34, 0x34, 0xff, 0x35, 0x35, 0x35, 0xff, 0x33, 0x33, 0x33, 0xff, 0x33, 0x33, 0x33, 0xff, 0x35, 0x35, 0x35, 0xff, 0x38, 0x38, 0x38, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x52, 0x52, 0x52, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x63, 0x63, 0x63, 0xff, 0x68, 0x68, 0x68, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x65, 0x65, 0x65, 0xff, 0x65, 0x65, 0x65, 0xff, 0x65, 0x65, 0x65, 0xff, 0x61, 0x61, 0x61, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x59, 0x59, 0x59, 0xff, 0x55, 0x55, 0x55, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x54, 0x54, 0x54, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x60, 0x60, 0x60, 0xff, 0x69, 0x69, 0x69, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x73, 0x73, 0x73, 0xff, 0x78, 0x78, 0x78, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x81, 0x81, 0x81, 0xff, 0x82, 0x82, 0x82, 0xff, 0x82, 0x82, 0x82, 0xff, 0x85, 0x85, 0x85, 0xff, 0x85, 0x85, 0x85, 0xff, 0x87, 0x87, 0x87, 0xff, 0x86, 0x86, 0x86, 0xff, 0x81, 0x81, 0x81, 0xff, 0x84, 0x84, 0x84, 0xff, 0x82, 0x82, 0x82, 0xff, 0x83, 0x83, 0x83, 0xff, 0x81, 0x81, 0x81, 0xff, 0x83, 0x83, 0x83, 0xff, 0x87, 0x87, 0x87, 0xff, 0x85, 0x85, 0x85, 0xff, 0x83, 0x83, 0x83, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x42, 0x42, 0x42, 0xff, 0x00, 0x00, 0x00, 0xff, 0x34, 0x34, 0x34, 0xff, 0x99, 0x99, 0x99, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0x9e, 0x9e, 0x9e, 0xff, 0x9d, 0x9d, 0x9d, 0xd2, 0x9c, 0x9c, 0x9c, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x08, 0x31, 0x31, 0x31, 0x8f, 0x2d, 0x2d, 0x2d, 0xfe, 0x2a, 0x2a, 0x2a, 0xff, 0x28, 0x28, 0x28, 0xff, 0x24, 0x24, 0x24, 0xff, 0x14, 0x14, 0x14, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x08, 0x08, 0x08, 0xff, 0x15, 0x15, 0x15, 0xff, 0x23, 0x23, 0x23, 0xff, 0x23, 0x23, 0x23, 0xff, 0x26, 0x26, 0x26, 0xff, 0x27, 0x27, 0x27, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x32, 0x32, 0x32, 0xff, 0x33, 0x33, 0x33, 0xff, 0x34, 0x34, 0x34, 0xff, 0x33, 0x33, 0x33, 0xff, 0x34, 0x34, 0x34, 0xff, 0x33, 0x33, 0x33, 0xff, 0x36, 0x36, 0x36, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x44, 0x44, 0x44, 0xff, 0x53, 0x53, 0x53, 0xff, 0x60, 0x60, 0x60, 0xff, 0x67, 0x67, 0x67, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x68, 0x68, 0x68, 0xff, 0x64, 0x64, 0x64, 0xff, 0x60, 0x60, 0x60, 0xff, 0x65, 0x65, 0x65, 0xff, 0x63, 0x63, 0x63, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x58, 0x58, 0x58, 0xff, 0x57, 0x57, 0x57, 0xff, 0x55, 0x55, 0x55, 0xff, 0x55, 0x55, 0x55, 0xff, 0x53, 0x53, 0x53, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x65, 0x65, 0x65, 0xff, 0x65, 0x65, 0x65, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x73, 0x73, 0x73, 0xff, 0x75, 0x75, 0x75, 0xff, 0x79, 0x79, 0x79, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x81, 0x81, 0x81, 0xff, 0x81, 0x81, 0x81, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x83, 0x83, 0x83, 0xff, 0x80, 0x80, 0x80, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x81, 0x81, 0x81, 0xff, 0x81, 0x81, 0x81, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x84, 0x84, 0x84, 0xff, 0x87, 0x87, 0x87, 0xff, 0x89, 0x89, 0x89, 0xff, 0x89, 0x89, 0x89, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x58, 0x58, 0x58, 0xff, 0x03, 0x03, 0x03, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x91, 0x91, 0x91, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0x9b, 0x9b, 0x9b, 0xfe, 0x9e, 0x9e, 0x9e, 0x8f, 0x9f, 0x9f, 0x9f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x2a, 0x2a, 0x42, 0x28, 0x28, 0x28, 0xdb, 0x27, 0x27, 0x27, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x10, 0x10, 0x10, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x25, 0x25, 0x25, 0xff, 0x25, 0x25, 0x25, 0xff, 0x27, 0x27, 0x27, 0xff, 0x28, 0x28, 0x28, 0xff, 0x2a, 0x2a, 0x2a, 0xff, 0x31, 0x31, 0x31, 0xff, 0x33, 0x33, 0x33, 0xff, 0x32, 0x32, 0x32, 0xff, 0x33, 0x33, 0x33, 0xff, 0x33, 0x33, 0x33, 0xff, 0x34, 0x34, 0x34, 0xff, 0x34, 0x34, 0x34, 0xff, 0x38, 0x38, 0x38, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x48, 0x48, 0x48, 0xff, 0x59, 0x59, 0x59, 0xff, 0x66, 0x66, 0x66, 0xff, 0x71, 0x71, 0x71, 0xff, 0x75, 0x75, 0x75, 0xff, 0x70, 0x70, 0x70, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x67, 0x67, 0x67, 0xff, 0x62, 0x62, 0x62, 0xff, 0x66, 0x66, 0x66, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x59, 0x59, 0x59, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x57, 0x57, 0x57, 0xff, 0x55, 0x55, 0x55, 0xff, 0x56, 0x56, 0x56, 0xff, 0x55, 0x55, 0x55, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x67, 0x67, 0x67, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x70, 0x70, 0x70, 0xff, 0x74, 0x74, 0x74, 0xff, 0x79, 0x79, 0x79, 0xff, 0x79, 0x79, 0x79, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x80, 0x80, 0x80, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x81, 0x81, 0x81, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0xff, 0x87, 0x87, 0x87, 0xff, 0x87, 0x87, 0x87, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x84, 0x84, 0x84, 0xff, 0x68, 0x68, 0x68, 0xff, 0x14, 0x14, 0x14, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x85, 0x85, 0x85, 0xff, 0xa6, 0xa6, 0xa6, 0xdb, 0x9e, 0x9e, 0x9e, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x09, 0x25, 0x25, 0x25, 0x87, 0x16, 0x16, 0x16, 0xf9, 0x0f, 0x0f, 0x0f, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x13, 0x13, 0x13, 0xff, 0x27, 0x27, 0x27, 0xff, 0x27, 0x27, 0x27, 0xff, 0x26, 0x26, 0x26, 0xff, 0x27, 0x27, 0x27, 0xff, 0x29, 0x29, 0x29, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x31, 0x31, 0x31, 0xff, 0x34, 0x34, 0x34, 0xff, 0x34, 0x34, 0x34, 0xff, 0x32, 0x32, 0x32, 0xff, 0x34, 0x34, 0x34, 0xff, 0x37, 0x37, 0x37, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0x42, 0x42, 0x42, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x69, 0x69, 0x69, 0xff, 0x73, 0x73, 0x73, 0xff, 0x78, 0x78, 0x78, 0xff, 0x71, 0x71, 0x71, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x66, 0x66, 0x66, 0xff, 0x63, 0x63, 0x63, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x59, 0x59, 0x59, 0xff, 0x56, 0x56, 0x56, 0xff, 0x56, 0x56, 0x56, 0xff, 0x56, 0x56, 0x56, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x60, 0x60, 0x60, 0xff, 0x60, 0x60, 0x60, 0xff, 0x68, 0x68, 0x68, 0xff, 0x71, 0x71, 0x71, 0xff, 0x71, 0x71, 0x71, 0xff, 0x74, 0x74, 0x74, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x79, 0x79, 0x79, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x79, 0x79, 0x79, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x80, 0x80, 0x80, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x85, 0x85, 0x85, 0xff, 0x87, 0x87, 0x87, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x90, 0x90, 0x90, 0xff, 0x93, 0x93, 0x93, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x28, 0x28, 0x28, 0xff, 0x00, 0x00, 0x00, 0xf9, 0x74, 0x74, 0x74, 0x88, 0xaa, 0xaa, 0xaa, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x25, 0x0f, 0x0f, 0x0f, 0xb7, 0x0b, 0x0b, 0x0b, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x29, 0x29, 0x29, 0xff, 0x26, 0x26, 0x26, 0xff, 0x26, 0x26, 0x26, 0xff, 0x28, 0x28, 0x28, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x32, 0x32, 0x32, 0xff, 0x33, 0x33, 0x33, 0xff, 0x33, 0x33, 0x33, 0xff, 0x36, 0x36, 0x36, 0xff, 0x39, 0x39, 0x39, 0xff, 0x43, 0x43, 0x43, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x52, 0x52, 0x52, 0xff, 0x61, 0x61, 0x61, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x71, 0x71, 0x71, 0xff, 0x74, 0x74, 0x74, 0xff, 0x72, 0x72, 0x72, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x64, 0x64, 0x64, 0xff, 0x62, 0x62, 0x62, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x56, 0x56, 0x56, 0xff, 0x56, 0x56, 0x56, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x63, 0x63, 0x63, 0xff, 0x64, 0x64, 0x64, 0xff, 0x65, 0x65, 0x65, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x71, 0x71, 0x71, 0xff, 0x71, 0x71, 0x71, 0xff, 0x75, 0x75, 0x75, 0xff, 0x76, 0x76, 0x76, 0xff, 0x78, 0x78, 0x78, 0xff, 0x78, 0x78, 0x78, 0xff, 0x75, 0x75, 0x75, 0xff, 0x77, 0x77, 0x77, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x83, 0x83, 0x83, 0xff, 0x89, 0x89, 0x89, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x93, 0x93, 0x93, 0xff, 0x94, 0x94, 0x94, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x3a, 0x3a, 0x3a, 0xb7, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x12, 0x46, 0x28, 0x28, 0x28, 0xca, 0x29, 0x29, 0x29, 0xff, 0x27, 0x27, 0x27, 0xff, 0x28, 0x28, 0x28, 0xff, 0x29, 0x29, 0x29, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x30, 0x30, 0x30, 0xff, 0x32, 0x32, 0x32, 0xff, 0x34, 0x34, 0x34, 0xff, 0x35, 0x35, 0x35, 0xff, 0x35, 0x35, 0x35, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x48, 0x48, 0x48, 0xff, 0x50, 0x50, 0x50, 0xff, 0x59, 0x59, 0x59, 0xff, 0x63, 0x63, 0x63, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x72, 0x72, 0x72, 0xff, 0x73, 0x73, 0x73, 0xff, 0x71, 0x71, 0x71, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x65, 0x65, 0x65, 0xff, 0x60, 0x60, 0x60, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x59, 0x59, 0x59, 0xff, 0x57, 0x57, 0x57, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x62, 0x62, 0x62, 0xff, 0x64, 0x64, 0x64, 0xff, 0x63, 0x63, 0x63, 0xff, 0x67, 0x67, 0x67, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x71, 0x71, 0x71, 0xff, 0x73, 0x73, 0x73, 0xff, 0x76, 0x76, 0x76, 0xff, 0x75, 0x75, 0x75, 0xff, 0x79, 0x79, 0x79, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x84, 0x84, 0x84, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x81, 0x81, 0x81, 0xff, 0x87, 0x87, 0x87, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x95, 0x95, 0x95, 0xff, 0x98, 0x98, 0x98, 0xff, 0x98, 0x98, 0x98, 0xff, 0x8f, 0x8f, 0x8f, 0xca, 0x74, 0x74, 0x74, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x27, 0x27, 0x4d, 0x29, 0x29, 0x29, 0xcc, 0x2c, 0x2c, 0x2c, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x32, 0x32, 0x32, 0xff, 0x35, 0x35, 0x35, 0xff, 0x34, 0x34, 0x34, 0xff, 0x36, 0x36, 0x36, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x47, 0x47, 0x47, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x54, 0x54, 0x54, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x61, 0x61, 0x61, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x73, 0x73, 0x73, 0xff, 0x76, 0x76, 0x76, 0xff, 0x73, 0x73, 0x73, 0xff, 0x72, 0x72, 0x72, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x69, 0x69, 0x69, 0xff, 0x61, 0x61, 0x61, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x59, 0x59, 0x59, 0xff, 0x54, 0x54, 0x54, 0xff, 0x58, 0x58, 0x58, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x62, 0x62, 0x62, 0xff, 0x63, 0x63, 0x63, 0xff, 0x64, 0x64, 0x64, 0xff, 0x64, 0x64, 0x64, 0xff, 0x65, 0x65, 0x65, 0xff, 0x69, 0x69, 0x69, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x70, 0x70, 0x70, 0xff, 0x72, 0x72, 0x72, 0xff, 0x76, 0x76, 0x76, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0xff, 0x83, 0x83, 0x83, 0xff, 0x89, 0x89, 0x89, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x93, 0x93, 0x93, 0xff, 0x94, 0x94, 0x94, 0xff, 0x97, 0x97, 0x97, 0xcc, 0x9b, 0x9b, 0x9b, 0x4d, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x2f, 0x2f, 0x41, 0x30, 0x30, 0x30, 0xb4, 0x31, 0x31, 0x31, 0xfe, 0x33, 0x33, 0x33, 0xff, 0x34, 0x34, 0x34, 0xff, 0x36, 0x36, 0x36, 0xff, 0x37, 0x37, 0x37, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x44, 0x44, 0x44, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x52, 0x52, 0x52, 0xff, 0x59, 0x59, 0x59, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x65, 0x65, 0x65, 0xff, 0x68, 0x68, 0x68, 0xff, 0x6e, 0x6e, 0x6e, 0xff, 0x72, 0x72, 0x72, 0xff, 0x72, 0x72, 0x72, 0xff, 0x75, 0x75, 0x75, 0xff, 0x71, 0x71, 0x71, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x66, 0x66, 0x66, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x57, 0x57, 0x57, 0xff, 0x58, 0x58, 0x58, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x60, 0x60, 0x60, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x60, 0x60, 0x60, 0xff, 0x63, 0x63, 0x63, 0xff, 0x62, 0x62, 0x62, 0xff, 0x61, 0x61, 0x61, 0xff, 0x62, 0x62, 0x62, 0xff, 0x65, 0x65, 0x65, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x76, 0x76, 0x76, 0xff, 0x78, 0x78, 0x78, 0xff, 0x79, 0x79, 0x79, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x81, 0x81, 0x81, 0xff, 0x83, 0x83, 0x83, 0xff, 0x86, 0x86, 0x86, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x8c, 0x8c, 0x8c, 0xfe, 0x93, 0x93, 0x93, 0xb4, 0x99, 0x99, 0x99, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x23, 0x34, 0x34, 0x34, 0x88, 0x37, 0x37, 0x37, 0xe6, 0x3a, 0x3a, 0x3a, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x43, 0x43, 0x43, 0xff, 0x45, 0x45, 0x45, 0xff, 0x48, 0x48, 0x48, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x58, 0x58, 0x58, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x65, 0x65, 0x65, 0xff, 0x68, 0x68, 0x68, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x72, 0x72, 0x72, 0xff, 0x70, 0x70, 0x70, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x65, 0x65, 0x65, 0xff, 0x62, 0x62, 0x62, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x58, 0x58, 0x58, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x60, 0x60, 0x60, 0xff, 0x60, 0x60, 0x60, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x60, 0x60, 0x60, 0xff, 0x64, 0x64, 0x64, 0xff, 0x64, 0x64, 0x64, 0xff, 0x67, 0x67, 0x67, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x75, 0x75, 0x75, 0xff, 0x77, 0x77, 0x77, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x81, 0x81, 0x81, 0xff, 0x87, 0x87, 0x87, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x8e, 0x8e, 0x8e, 0xe7, 0x94, 0x94, 0x94, 0x88, 0x91, 0x91, 0x91, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x05, 0x3a, 0x3a, 0x3a, 0x4a, 0x41, 0x41, 0x41, 0xa0, 0x48, 0x48, 0x48, 0xef, 0x4d, 0x4d, 0x4d, 0xff, 0x50, 0x50, 0x50, 0xff, 0x54, 0x54, 0x54, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x63, 0x63, 0x63, 0xff, 0x65, 0x65, 0x65, 0xff, 0x65, 0x65, 0x65, 0xff, 0x68, 0x68, 0x68, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x66, 0x66, 0x66, 0xff, 0x67, 0x67, 0x67, 0xff, 0x64, 0x64, 0x64, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x60, 0x60, 0x60, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x60, 0x60, 0x60, 0xff, 0x63, 0x63, 0x63, 0xff, 0x65, 0x65, 0x65, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x71, 0x71, 0x71, 0xff, 0x75, 0x75, 0x75, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x81, 0x81, 0x81, 0xff, 0x87, 0x87, 0x87, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x8c, 0x8c, 0x8c, 0xef, 0x91, 0x91, 0x91, 0xa0, 0x90, 0x90, 0x90, 0x4a, 0x99, 0x99, 0x99, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x48, 0x48, 0x07, 0x53, 0x53, 0x53, 0x46, 0x54, 0x54, 0x54, 0x8e, 0x5a, 0x5a, 0x5a, 0xd7, 0x5e, 0x5e, 0x5e, 0xff, 0x60, 0x60, 0x60, 0xff, 0x62, 0x62, 0x62, 0xff, 0x62, 0x62, 0x62, 0xff, 0x60, 0x60, 0x60, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x64, 0x64, 0x64, 0xff, 0x67, 0x67, 0x67, 0xff, 0x68, 0x68, 0x68, 0xff, 0x69, 0x69, 0x69, 0xff, 0x67, 0x67, 0x67, 0xff, 0x64, 0x64, 0x64, 0xff, 0x60, 0x60, 0x60, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x60, 0x60, 0x60, 0xff, 0x67, 0x67, 0x67, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x75, 0x75, 0x75, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x85, 0x85, 0x85, 0xff, 0x88, 0x88, 0x88, 0xd7, 0x8a, 0x8a, 0x8a, 0x8e, 0x8e, 0x8e, 0x8e, 0x46, 0x91, 0x91, 0x91, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x5e, 0x5e, 0x1b, 0x60, 0x60, 0x60, 0x55, 0x62, 0x62, 0x62, 0x8f, 0x62, 0x62, 0x62, 0xc2, 0x5d, 0x5d, 0x5d, 0xea, 0x5c, 0x5c, 0x5c, 0xff, 0x65, 0x65, 0x65, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x66, 0x66, 0x66, 0xff, 0x67, 0x67, 0x67, 0xff, 0x68, 0x68, 0x68, 0xff, 0x61, 0x61, 0x61, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x60, 0x60, 0x60, 0xff, 0x66, 0x66, 0x66, 0xff, 0x6b, 0x6b, 0x6b, 0xea, 0x6e, 0x6e, 0x6e, 0xc2, 0x79, 0x79, 0x79, 0x8f, 0x7e, 0x7e, 0x7e, 0x55, 0x84, 0x84, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x5a, 0x11, 0x66, 0x66, 0x66, 0x37, 0x66, 0x66, 0x66, 0x5f, 0x62, 0x62, 0x62, 0x86, 0x65, 0x65, 0x65, 0xa8, 0x64, 0x64, 0x64, 0xc0, 0x60, 0x60, 0x60, 0xd3, 0x60, 0x60, 0x60, 0xe6, 0x5f, 0x5f, 0x5f, 0xee, 0x5e, 0x5e, 0x5e, 0xf5, 0x60, 0x60, 0x60, 0xff, 0x61, 0x61, 0x61, 0xff, 0x5f, 0x5f, 0x5f, 0xf5, 0x60, 0x60, 0x60, 0xee, 0x5d, 0x5d, 0x5d, 0xe6, 0x5e, 0x5e, 0x5e, 0xd3, 0x5f, 0x5f, 0x5f, 0xc0, 0x5e, 0x5e, 0x5e, 0xa8, 0x5d, 0x5d, 0x5d, 0x86, 0x60, 0x60, 0x60, 0x5f, 0x61, 0x61, 0x61, 0x37, 0x69, 0x69, 0x69, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const lv_image_dsc_t img_multilang_avatar_19 = {
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .header.w = 128,
+    .header.h = 128,
+    .header.stride = 512,
+    .data = img_multilang_avatar_19_map,
+    .data_size = sizeof(img_multilang_avatar_19_map),
+};
+
+#endif
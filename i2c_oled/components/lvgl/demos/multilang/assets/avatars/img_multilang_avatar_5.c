@@ -0,0 +1,166 @@
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+#if LV_USE_DEMO_MULTILANG
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_5
+    #define LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_5
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_5 uint8_t
+img_multilang_avatar_5_map[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x1e, 0x1e, 0x11, 0x33, 0x25, 0x29, 0x37, 0x3b, 0x30, 0x33, 0x5e, 0x40, 0x37, 0x37, 0x86, 0x3b, 0x2f, 0x2d, 0xa8, 0x2c, 0x20, 0x1d, 0xbf, 0x31, 0x26, 0x22, 0xd2, 0x23, 0x18, 0x14, 0xe5, 0x36, 0x28, 0x26, 0xee, 0x4a, 0x3b, 0x3d, 0xf2, 0x61, 0x4f, 0x4f, 0xff, 0x5f, 0x4d, 0x4b, 0xff, 0x65, 0x54, 0x51, 0xf2, 0x4d, 0x3c, 0x38, 0xee, 0x30, 0x20, 0x1c, 0xe5, 0x46, 0x34, 0x33, 0xd2, 0x50, 0x3d, 0x3d, 0xbf, 0x5f, 0x4a, 0x4d, 0xa8, 0x77, 0x62, 0x64, 0x86, 0x8f, 0x7f, 0x82, 0x5e, 0x6a, 0x58, 0x61, 0x37, 0x78, 0x69, 0x69, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x51, 0x51, 0x19, 0x48, 0x39, 0x36, 0x55, 0x2e, 0x20, 0x1e, 0x8f, 0x3b, 0x2f, 0x2e, 0xc1, 0x3c, 0x31, 0x2f, 0xe9, 0x2d, 0x22, 0x20, 0xff, 0x4c, 0x40, 0x3e, 0xff, 0x37, 0x2b, 0x2c, 0xff, 0x26, 0x19, 0x1b, 0xff, 0x2d, 0x21, 0x1e, 0xff, 0x3a, 0x2f, 0x2c, 0xff, 0x2f, 0x24, 0x1f, 0xff, 0x2a, 0x1e, 0x19, 0xff, 0x32, 0x24, 0x22, 0xff, 0x44, 0x33, 0x35, 0xff, 0x56, 0x44, 0x45, 0xff, 0x5e, 0x4c, 0x4b, 0xff, 0x66, 0x55, 0x52, 0xff, 0x49, 0x38, 0x34, 0xff, 0x2b, 0x1b, 0x18, 0xff, 0x59, 0x46, 0x45, 0xff, 0x79, 0x67, 0x67, 0xff, 0x82, 0x70, 0x71, 0xff, 0x91, 0x7d, 0x80, 0xff, 0x7f, 0x71, 0x74, 0xff, 0x5a, 0x4c, 0x50, 0xff, 0x86, 0x74, 0x76, 0xff, 0x8e, 0x78, 0x77, 0xe9, 0x75, 0x5f, 0x5c, 0xc1, 0x7e, 0x6e, 0x6a, 0x8f, 0x69, 0x5d, 0x5d, 0x55, 0x47, 0x3d, 0x3d, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x07, 0x5b, 0x4c, 0x50, 0x46, 0x72, 0x64, 0x66, 0x8e, 0x4e, 0x40, 0x3d, 0xd7, 0x35, 0x28, 0x26, 0xff, 0x38, 0x2a, 0x28, 0xff, 0x4a, 0x3c, 0x3a, 0xff, 0x44, 0x38, 0x36, 0xff, 0x34, 0x29, 0x27, 0xff, 0x40, 0x36, 0x32, 0xff, 0x45, 0x39, 0x36, 0xff, 0x37, 0x28, 0x29, 0xff, 0x36, 0x26, 0x28, 0xff, 0x27, 0x1b, 0x1a, 0xff, 0x27, 0x1c, 0x18, 0xff, 0x31, 0x26, 0x21, 0xff, 0x3b, 0x2f, 0x2a, 0xff, 0x41, 0x33, 0x31, 0xff, 0x45, 0x33, 0x36, 0xff, 0x50, 0x3e, 0x3e, 0xff, 0x73, 0x61, 0x5f, 0xff, 0x61, 0x50, 0x4d, 0xff, 0x41, 0x31, 0x2e, 0xff, 0x61, 0x50, 0x4d, 0xff, 0x69, 0x56, 0x54, 0xff, 0x64, 0x54, 0x53, 0xff, 0x79, 0x69, 0x6a, 0xff, 0x8d, 0x7c, 0x7e, 0xff, 0x54, 0x48, 0x4a, 0xff, 0x40, 0x34, 0x37, 0xff, 0x6d, 0x5e, 0x5e, 0xff, 0x86, 0x72, 0x70, 0xff, 0x7c, 0x69, 0x66, 0xff, 0x96, 0x87, 0x85, 0xff, 0x71, 0x67, 0x67, 0xff, 0x3c, 0x33, 0x33, 0xff, 0x3b, 0x29, 0x29, 0xd7, 0x6f, 0x59, 0x5b, 0x8e, 0x9c, 0x8e, 0x8e, 0x46, 0x91, 0x91, 0x91, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x05, 0x38, 0x2a, 0x2e, 0x48, 0x1e, 0x10, 0x11, 0x9f, 0x50, 0x42, 0x41, 0xef, 0x64, 0x56, 0x55, 0xff, 0x5c, 0x4c, 0x4a, 0xff, 0x4e, 0x3e, 0x3c, 0xff, 0x40, 0x32, 0x30, 0xff, 0x4b, 0x41, 0x3e, 0xff, 0x4d, 0x43, 0x41, 0xff, 0x38, 0x2c, 0x2a, 0xff, 0x51, 0x44, 0x42, 0xff, 0x4d, 0x43, 0x40, 0xff, 0x32, 0x28, 0x25, 0xff, 0x48, 0x38, 0x35, 0xff, 0x4b, 0x37, 0x33, 0xff, 0x38, 0x2b, 0x25, 0xff, 0x1e, 0x15, 0x11, 0xff, 0x23, 0x19, 0x15, 0xff, 0x2f, 0x24, 0x1f, 0xff, 0x35, 0x28, 0x26, 0xff, 0x44, 0x34, 0x36, 0xff, 0x41, 0x31, 0x31, 0xff, 0x69, 0x5a, 0x57, 0xff, 0x4e, 0x3e, 0x3b, 0xff, 0x4a, 0x38, 0x35, 0xff, 0x8a, 0x79, 0x76, 0xff, 0x78, 0x67, 0x65, 0xff, 0x5a, 0x4b, 0x4a, 0xff, 0x63, 0x53, 0x54, 0xff, 0x41, 0x32, 0x34, 0xff, 0x24, 0x18, 0x18, 0xff, 0x11, 0x06, 0x06, 0xff, 0x39, 0x2a, 0x2a, 0xff, 0x7b, 0x67, 0x65, 0xff, 0x8b, 0x77, 0x74, 0xff, 0xa5, 0x96, 0x93, 0xff, 0x72, 0x67, 0x65, 0xff, 0x41, 0x39, 0x36, 0xff, 0x3f, 0x2f, 0x2f, 0xff, 0x80, 0x69, 0x6c, 0xff, 0xa0, 0x90, 0x91, 0xff, 0x84, 0x78, 0x79, 0xef, 0x70, 0x60, 0x61, 0x9f, 0x74, 0x63, 0x5f, 0x48, 0x66, 0x66, 0x66, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x3a, 0x3a, 0x23, 0x4e, 0x40, 0x40, 0x86, 0x33, 0x24, 0x24, 0xe5, 0x1a, 0x0c, 0x0d, 0xff, 0x3c, 0x2f, 0x2e, 0xff, 0x72, 0x65, 0x63, 0xff, 0x58, 0x4a, 0x48, 0xff, 0x54, 0x43, 0x42, 0xff, 0x56, 0x45, 0x43, 0xff, 0x51, 0x44, 0x42, 0xff, 0x44, 0x3a, 0x38, 0xff, 0x3e, 0x34, 0x31, 0xff, 0x4b, 0x3f, 0x3d, 0xff, 0x5c, 0x4f, 0x4d, 0xff, 0x47, 0x3d, 0x3a, 0xff, 0x3e, 0x34, 0x30, 0xff, 0x4f, 0x3e, 0x39, 0xff, 0x52, 0x3d, 0x37, 0xff, 0x44, 0x35, 0x2f, 0xff, 0x2a, 0x21, 0x1d, 0xff, 0x12, 0x07, 0x04, 0xff, 0x2b, 0x21, 0x1c, 0xff, 0x2a, 0x1d, 0x1b, 0xff, 0x2c, 0x1b, 0x1e, 0xff, 0x51, 0x43, 0x42, 0xff, 0x81, 0x73, 0x70, 0xff, 0x6b, 0x5a, 0x57, 0xff, 0x69, 0x57, 0x53, 0xff, 0x97, 0x86, 0x83, 0xff, 0x8d, 0x7d, 0x7b, 0xff, 0x8d, 0x7f, 0x7e, 0xff, 0x63, 0x55, 0x56, 0xff, 0x24, 0x18, 0x18, 0xff, 0x25, 0x1a, 0x19, 0xff, 0x2d, 0x21, 0x20, 0xff, 0x66, 0x57, 0x55, 0xff, 0x6a, 0x55, 0x53, 0xff, 0x93, 0x7d, 0x7a, 0xff, 0xb5, 0xa3, 0xa1, 0xff, 0x66, 0x5a, 0x58, 0xff, 0x3b, 0x31, 0x2d, 0xff, 0x51, 0x42, 0x41, 0xff, 0x84, 0x6e, 0x71, 0xff, 0xa4, 0x96, 0x96, 0xff, 0x93, 0x8a, 0x8a, 0xff, 0x61, 0x4f, 0x52, 0xff, 0x6a, 0x55, 0x53, 0xff, 0x6d, 0x59, 0x53, 0xe5, 0x85, 0x72, 0x6e, 0x86, 0xa0, 0x8a, 0x8a, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x0f, 0x0f, 0x41, 0x37, 0x2b, 0x2d, 0xb4, 0x37, 0x2a, 0x29, 0xfe, 0x28, 0x1c, 0x1a, 0xff, 0x25, 0x1a, 0x15, 0xff, 0x34, 0x28, 0x24, 0xff, 0x67, 0x5a, 0x57, 0xff, 0x5e, 0x51, 0x4f, 0xff, 0x5d, 0x4e, 0x4c, 0xff, 0x62, 0x51, 0x50, 0xff, 0x56, 0x45, 0x43, 0xff, 0x5d, 0x4f, 0x4d, 0xff, 0x43, 0x3b, 0x38, 0xff, 0x41, 0x37, 0x35, 0xff, 0x3e, 0x31, 0x30, 0xff, 0x42, 0x36, 0x34, 0xff, 0x47, 0x3c, 0x38, 0xff, 0x49, 0x3e, 0x37, 0xff, 0x49, 0x39, 0x31, 0xff, 0x55, 0x41, 0x3a, 0xff, 0x57, 0x48, 0x42, 0xff, 0x33, 0x2a, 0x26, 0xff, 0x1d, 0x12, 0x0f, 0xff, 0x32, 0x27, 0x22, 0xff, 0x27, 0x1b, 0x19, 0xff, 0x2f, 0x1f, 0x23, 0xff, 0x7a, 0x6b, 0x6b, 0xff, 0x99, 0x8a, 0x88, 0xff, 0x6d, 0x5d, 0x59, 0xff, 0x7b, 0x69, 0x66, 0xff, 0x8c, 0x7a, 0x77, 0xff, 0x9a, 0x8a, 0x88, 0xff, 0x93, 0x86, 0x84, 0xff, 0x46, 0x3a, 0x3a, 0xff, 0x44, 0x39, 0x3a, 0xff, 0x53, 0x4a, 0x4a, 0xff, 0x5d, 0x51, 0x4f, 0xff, 0x67, 0x57, 0x53, 0xff, 0x80, 0x6a, 0x65, 0xff, 0xad, 0x95, 0x92, 0xff, 0x8c, 0x78, 0x76, 0xff, 0x4b, 0x3f, 0x3c, 0xff, 0x4b, 0x3f, 0x3c, 0xff, 0x6b, 0x59, 0x58, 0xff, 0x74, 0x62, 0x63, 0xff, 0x6f, 0x64, 0x63, 0xff, 0x9c, 0x92, 0x93, 0xff, 0x7a, 0x67, 0x6b, 0xff, 0x54, 0x3f, 0x3c, 0xff, 0x71, 0x5d, 0x57, 0xff, 0x83, 0x6f, 0x6a, 0xff, 0x98, 0x84, 0x7f, 0xfe, 0xb2, 0xa1, 0x9a, 0xb4, 0xbc, 0xa8, 0xa0, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0d, 0x0d, 0x4c, 0x16, 0x0f, 0x0b, 0xcb, 0x25, 0x1b, 0x1a, 0xff, 0x2e, 0x22, 0x21, 0xff, 0x23, 0x16, 0x14, 0xff, 0x38, 0x28, 0x26, 0xff, 0x37, 0x27, 0x25, 0xff, 0x59, 0x4d, 0x49, 0xff, 0x5d, 0x52, 0x4f, 0xff, 0x41, 0x35, 0x33, 0xff, 0x66, 0x59, 0x57, 0xff, 0x66, 0x58, 0x56, 0xff, 0x7a, 0x6c, 0x6a, 0xff, 0x56, 0x49, 0x47, 0xff, 0x35, 0x2b, 0x28, 0xff, 0x2c, 0x22, 0x1e, 0xff, 0x42, 0x35, 0x33, 0xff, 0x5d, 0x4d, 0x4c, 0xff, 0x46, 0x39, 0x33, 0xff, 0x44, 0x37, 0x2f, 0xff, 0x52, 0x3d, 0x37, 0xff, 0x58, 0x40, 0x3b, 0xff, 0x5f, 0x51, 0x4c, 0xff, 0x47, 0x3f, 0x3b, 0xff, 0x30, 0x25, 0x22, 0xff, 0x38, 0x2a, 0x27, 0xff, 0x27, 0x19, 0x17, 0xff, 0x64, 0x55, 0x56, 0xff, 0x8a, 0x7d, 0x7b, 0xff, 0x83, 0x75, 0x71, 0xff, 0x6f, 0x5f, 0x5c, 0xff, 0x73, 0x60, 0x5d, 0xff, 0x79, 0x65, 0x63, 0xff, 0x8f, 0x7e, 0x7c, 0xff, 0x84, 0x75, 0x74, 0xff, 0x52, 0x46, 0x46, 0xff, 0x56, 0x4d, 0x4d, 0xff, 0x56, 0x4c, 0x4c, 0xff, 0x6f, 0x60, 0x5e, 0xff, 0x6d, 0x59, 0x57, 0xff, 0xa0, 0x8a, 0x87, 0xff, 0x8b, 0x74, 0x73, 0xff, 0x6f, 0x5a, 0x59, 0xff, 0x51, 0x40, 0x3f, 0xff, 0x59, 0x49, 0x49, 0xff, 0x66, 0x54, 0x56, 0xff, 0x61, 0x4f, 0x52, 0xff, 0x82, 0x75, 0x75, 0xff, 0x81, 0x76, 0x78, 0xff, 0x81, 0x74, 0x76, 0xff, 0x6b, 0x59, 0x58, 0xff, 0x5d, 0x49, 0x46, 0xff, 0x64, 0x51, 0x4c, 0xff, 0x8f, 0x7a, 0x76, 0xff, 0xa3, 0x8e, 0x88, 0xff, 0xaf, 0x9c, 0x95, 0xff, 0x79, 0x6a, 0x61, 0xcb, 0x66, 0x56, 0x4f, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0a, 0x0e, 0x46, 0x19, 0x11, 0x13, 0xc9, 0x1c, 0x13, 0x13, 0xff, 0x26, 0x1c, 0x19, 0xff, 0x29, 0x1d, 0x1a, 0xff, 0x2f, 0x22, 0x20, 0xff, 0x45, 0x37, 0x35, 0xff, 0x54, 0x41, 0x3f, 0xff, 0x40, 0x2d, 0x2c, 0xff, 0x59, 0x4c, 0x4a, 0xff, 0x3f, 0x34, 0x32, 0xff, 0x57, 0x4c, 0x4a, 0xff, 0x66, 0x59, 0x57, 0xff, 0x6d, 0x60, 0x5e, 0xff, 0x63, 0x57, 0x55, 0xff, 0x30, 0x24, 0x22, 0xff, 0x2e, 0x22, 0x20, 0xff, 0x1d, 0x11, 0x0d, 0xff, 0x5d, 0x50, 0x4c, 0xff, 0x62, 0x4e, 0x4c, 0xff, 0x4f, 0x3d, 0x39, 0xff, 0x46, 0x36, 0x30, 0xff, 0x53, 0x3a, 0x37, 0xff, 0x69, 0x50, 0x4b, 0xff, 0x6d, 0x5f, 0x59, 0xff, 0x40, 0x38, 0x34, 0xff, 0x1f, 0x13, 0x11, 0xff, 0x45, 0x36, 0x34, 0xff, 0x4d, 0x3d, 0x3c, 0xff, 0x85, 0x76, 0x73, 0xff, 0x79, 0x6c, 0x68, 0xff, 0x73, 0x65, 0x61, 0xff, 0x5f, 0x4f, 0x4c, 0xff, 0x66, 0x52, 0x50, 0xff, 0x82, 0x6d, 0x6a, 0xff, 0x8d, 0x7c, 0x7a, 0xff, 0x66, 0x56, 0x55, 0xff, 0x45, 0x38, 0x39, 0xff, 0x1b, 0x15, 0x15, 0xff, 0x32, 0x28, 0x27, 0xff, 0x89, 0x79, 0x78, 0xff, 0x7a, 0x68, 0x67, 0xff, 0x63, 0x4e, 0x4e, 0xff, 0x8d, 0x79, 0x78, 0xff, 0x85, 0x72, 0x71, 0xff, 0x70, 0x5f, 0x5d, 0xff, 0x3f, 0x2e, 0x2f, 0xff, 0x3e, 0x2d, 0x32, 0xff, 0x5e, 0x4d, 0x50, 0xff, 0x7f, 0x6e, 0x72, 0xff, 0x7e, 0x72, 0x74, 0xff, 0x75, 0x6c, 0x6e, 0xff, 0x76, 0x67, 0x68, 0xff, 0x5c, 0x48, 0x47, 0xff, 0x59, 0x45, 0x43, 0xff, 0x7b, 0x67, 0x62, 0xff, 0xa9, 0x93, 0x8f, 0xff, 0x8a, 0x76, 0x71, 0xff, 0x63, 0x55, 0x4e, 0xff, 0x82, 0x74, 0x6b, 0xff, 0xc0, 0xb0, 0xa7, 0xc9, 0xc4, 0xb2, 0xa7, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x15, 0x15, 0x24, 0x20, 0x16, 0x18, 0xb4, 0x21, 0x18, 0x19, 0xff, 0x23, 0x1a, 0x1b, 0xff, 0x25, 0x1a, 0x19, 0xff, 0x2c, 0x20, 0x1e, 0xff, 0x2e, 0x22, 0x20, 0xff, 0x54, 0x48, 0x46, 0xff, 0x4a, 0x3e, 0x3b, 0xff, 0x4f, 0x3d, 0x3c, 0xff, 0x61, 0x4e, 0x4d, 0xff, 0x50, 0x42, 0x40, 0xff, 0x3e, 0x32, 0x30, 0xff, 0x5e, 0x52, 0x50, 0xff, 0x60, 0x52, 0x50, 0xff, 0x6f, 0x60, 0x5e, 0xff, 0x39, 0x2c, 0x2a, 0xff, 0x1f, 0x13, 0x11, 0xff, 0x15, 0x0a, 0x08, 0xff, 0x31, 0x27, 0x23, 0xff, 0x67, 0x5a, 0x56, 0xff, 0x48, 0x36, 0x33, 0xff, 0x50, 0x3e, 0x39, 0xff, 0x45, 0x35, 0x2f, 0xff, 0x57, 0x43, 0x3e, 0xff, 0x6d, 0x59, 0x53, 0xff, 0x65, 0x56, 0x50, 0xff, 0x23, 0x1b, 0x17, 0xff, 0x2d, 0x22, 0x20, 0xff, 0x50, 0x40, 0x3e, 0xff, 0x68, 0x58, 0x56, 0xff, 0x6b, 0x5b, 0x59, 0xff, 0x5a, 0x4e, 0x4a, 0xff, 0x5e, 0x4e, 0x4c, 0xff, 0x52, 0x40, 0x3d, 0xff, 0x76, 0x62, 0x5f, 0xff, 0x76, 0x63, 0x60, 0xff, 0x48, 0x3a, 0x37, 0xff, 0x47, 0x38, 0x37, 0xff, 0x2c, 0x1e, 0x1f, 0xff, 0x33, 0x2b, 0x2b, 0xff, 0x4a, 0x3f, 0x3f, 0xff, 0x50, 0x44, 0x42, 0xff, 0x25, 0x17, 0x16, 0xff, 0x3c, 0x2a, 0x29, 0xff, 0x80, 0x6f, 0x6d, 0xff, 0x86, 0x77, 0x75, 0xff, 0x63, 0x57, 0x54, 0xff, 0x2d, 0x1e, 0x1f, 0xff, 0x58, 0x46, 0x4a, 0xff, 0x7a, 0x68, 0x6c, 0xff, 0x72, 0x61, 0x64, 0xff, 0x73, 0x66, 0x68, 0xff, 0x64, 0x58, 0x5a, 0xff, 0x76, 0x64, 0x66, 0xff, 0x64, 0x50, 0x4f, 0xff, 0x4f, 0x3b, 0x38, 0xff, 0x82, 0x6e, 0x69, 0xff, 0x8d, 0x79, 0x74, 0xff, 0x79, 0x65, 0x5f, 0xff, 0xb6, 0xa3, 0x9d, 0xff, 0xf5, 0xe3, 0xdb, 0xff, 0xff, 0xef, 0xe5, 0xff, 0xff, 0xef, 0xe3, 0xff, 0xf5, 0xe0, 0xd3, 0xb5, 0xa2, 0x8d, 0x7f, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x09, 0x25, 0x1c, 0x1c, 0x87, 0x28, 0x1f, 0x1e, 0xf9, 0x2d, 0x24, 0x23, 0xff, 0x25, 0x1b, 0x1b, 0xff, 0x22, 0x18, 0x19, 0xff, 0x31, 0x25, 0x25, 0xff, 0x2b, 0x1d, 0x1c, 0xff, 0x57, 0x4b, 0x49, 0xff, 0x54, 0x48, 0x46, 0xff, 0x48, 0x3a, 0x38, 0xff, 0x56, 0x44, 0x42, 0xff, 0x4e, 0x3b, 0x3a, 0xff, 0x5c, 0x4f, 0x4d, 0xff, 0x50, 0x43, 0x41, 0xff, 0x4b, 0x3d, 0x3b, 0xff, 0x57, 0x46, 0x44, 0xff, 0x67, 0x57, 0x55, 0xff, 0x1a, 0x0f, 0x0d, 0xff, 0x21, 0x16, 0x14, 0xff, 0x25, 0x18, 0x16, 0xff, 0x4c, 0x40, 0x3d, 0xff, 0x59, 0x4b, 0x48, 0xff, 0x43, 0x31, 0x2f, 0xff, 0x4a, 0x38, 0x33, 0xff, 0x4b, 0x3b, 0x35, 0xff, 0x59, 0x49, 0x44, 0xff, 0x67, 0x56, 0x51, 0xff, 0x3a, 0x2c, 0x27, 0xff, 0x3b, 0x32, 0x2f, 0xff, 0x4e, 0x42, 0x40, 0xff, 0x3d, 0x2f, 0x2d, 0xff, 0x5f, 0x50, 0x4e, 0xff, 0x60, 0x52, 0x50, 0xff, 0x67, 0x5b, 0x57, 0xff, 0x47, 0x3a, 0x36, 0xff, 0x4d, 0x3e, 0x3b, 0xff, 0x6e, 0x5c, 0x5a, 0xff, 0x5a, 0x49, 0x47, 0xff, 0x2e, 0x1f, 0x1d, 0xff, 0x52, 0x44, 0x43, 0xff, 0x51, 0x44, 0x45, 0xff, 0x2b, 0x21, 0x21, 0xff, 0x40, 0x36, 0x36, 0xff, 0x27, 0x1f, 0x1d, 0xff, 0x0d, 0x02, 0x01, 0xff, 0x45, 0x37, 0x34, 0xff, 0x7f, 0x72, 0x70, 0xff, 0x8a, 0x7e, 0x7c, 0xff, 0x43, 0x38, 0x36, 0xff, 0x40, 0x32, 0x33, 0xff, 0x70, 0x60, 0x63, 0xff, 0x8a, 0x7b, 0x7d, 0xff, 0x6c, 0x5c, 0x5e, 0xff, 0x54, 0x47, 0x48, 0xff, 0x77, 0x68, 0x6a, 0xff, 0x86, 0x72, 0x73, 0xff, 0x71, 0x5d, 0x5b, 0xff, 0x50, 0x3d, 0x39, 0xff, 0x8a, 0x76, 0x71, 0xff, 0x7d, 0x6a, 0x65, 0xff, 0x90, 0x7c, 0x77, 0xff, 0xc4, 0xae, 0xa8, 0xff, 0xd2, 0xbe, 0xb3, 0xff, 0xcf, 0xbd, 0xaf, 0xff, 0xe6, 0xd3, 0xc5, 0xff, 0xfd, 0xe7, 0xd9, 0xff, 0xff, 0xee, 0xdf, 0xf9, 0xaf, 0x9a, 0x8b, 0x87, 0xaa, 0x8d, 0x8d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0b, 0x0b, 0x40, 0x20, 0x18, 0x19, 0xda, 0x2e, 0x24, 0x24, 0xff, 0x37, 0x2a, 0x28, 0xff, 0x2a, 0x1e, 0x1c, 0xff, 0x23, 0x17, 0x15, 0xff, 0x38, 0x2e, 0x2f, 0xff, 0x2e, 0x23, 0x23, 0xff, 0x46, 0x3a, 0x38, 0xff, 0x57, 0x4a, 0x48, 0xff, 0x45, 0x36, 0x34, 0xff, 0x5c, 0x4a, 0x49, 0xff, 0x37, 0x24, 0x23, 0xff, 0x40, 0x2f, 0x2d, 0xff, 0x54, 0x46, 0x44, 0xff, 0x5f, 0x52, 0x4f, 0xff, 0x48, 0x36, 0x34, 0xff, 0x48, 0x33, 0x32, 0xff, 0x56, 0x47, 0x45, 0xff, 0x22, 0x1a, 0x17, 0xff, 0x2f, 0x24, 0x22, 0xff, 0x38, 0x29, 0x27, 0xff, 0x55, 0x46, 0x43, 0xff, 0x44, 0x34, 0x31, 0xff, 0x4a, 0x3c, 0x39, 0xff, 0x3f, 0x2f, 0x2a, 0xff, 0x48, 0x36, 0x31, 0xff, 0x5f, 0x4f, 0x4e, 0xff, 0x4e, 0x41, 0x3f, 0xff, 0x3b, 0x30, 0x2f, 0xff, 0x65, 0x59, 0x57, 0xff, 0x43, 0x37, 0x35, 0xff, 0x36, 0x29, 0x27, 0xff, 0x4a, 0x3d, 0x3b, 0xff, 0x5d, 0x50, 0x4e, 0xff, 0x58, 0x4c, 0x48, 0xff, 0x3d, 0x31, 0x2c, 0xff, 0x40, 0x35, 0x31, 0xff, 0x47, 0x3b, 0x37, 0xff, 0x5a, 0x4c, 0x49, 0xff, 0x4a, 0x3c, 0x39, 0xff, 0x55, 0x48, 0x47, 0xff, 0x4b, 0x40, 0x40, 0xff, 0x17, 0x0c, 0x0c, 0xff, 0x37, 0x2e, 0x2e, 0xff, 0x21, 0x1c, 0x18, 0xff, 0x21, 0x19, 0x16, 0xff, 0x24, 0x17, 0x15, 0xff, 0x8e, 0x80, 0x7f, 0xff, 0xa4, 0x98, 0x95, 0xff, 0x2f, 0x24, 0x22, 0xff, 0x46, 0x3d, 0x3b, 0xff, 0x6b, 0x60, 0x5f, 0xff, 0x86, 0x79, 0x79, 0xff, 0x5c, 0x4f, 0x50, 0xff, 0x42, 0x33, 0x34, 0xff, 0x86, 0x75, 0x75, 0xff, 0x94, 0x82, 0x81, 0xff, 0x71, 0x5e, 0x5c, 0xff, 0x6f, 0x5b, 0x58, 0xff, 0x7e, 0x6b, 0x66, 0xff, 0x81, 0x6f, 0x6a, 0xff, 0x7d, 0x6a, 0x65, 0xff, 0x81, 0x6b, 0x63, 0xff, 0xaa, 0x95, 0x86, 0xff, 0xcc, 0xb9, 0xa9, 0xff, 0xcd, 0xba, 0xab, 0xff, 0xd0, 0xbc, 0xac, 0xff, 0xf7, 0xe2, 0xd2, 0xff, 0xf1, 0xdd, 0xcf, 0xff, 0xa0, 0x8a, 0x7f, 0xda, 0xc8, 0xb0, 0xa4, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x07, 0x17, 0x13, 0x11, 0x8e, 0x24, 0x1c, 0x1e, 0xfe, 0x2d, 0x26, 0x26, 0xff, 0x33, 0x28, 0x28, 0xff, 0x36, 0x29, 0x26, 0xff, 0x22, 0x15, 0x13, 0xff, 0x3e, 0x31, 0x2f, 0xff, 0x42, 0x36, 0x37, 0xff, 0x3d, 0x31, 0x31, 0xff, 0x4e, 0x41, 0x3f, 0xff, 0x44, 0x37, 0x35, 0xff, 0x4e, 0x40, 0x3e, 0xff, 0x3c, 0x2a, 0x29, 0xff, 0x37, 0x24, 0x23, 0xff, 0x51, 0x40, 0x3e, 0xff, 0x48, 0x3a, 0x38, 0xff, 0x65, 0x58, 0x56, 0xff, 0x51, 0x40, 0x3e, 0xff, 0x55, 0x3f, 0x3f, 0xff, 0x46, 0x37, 0x35, 0xff, 0x2c, 0x24, 0x21, 0xff, 0x32, 0x27, 0x25, 0xff, 0x42, 0x33, 0x31, 0xff, 0x56, 0x46, 0x43, 0xff, 0x44, 0x35, 0x32, 0xff, 0x50, 0x41, 0x3e, 0xff, 0x40, 0x30, 0x2b, 0xff, 0x51, 0x40, 0x3a, 0xff, 0x54, 0x44, 0x41, 0xff, 0x3a, 0x2d, 0x2b, 0xff, 0x43, 0x38, 0x36, 0xff, 0x5d, 0x52, 0x50, 0xff, 0x36, 0x2b, 0x29, 0xff, 0x26, 0x1a, 0x18, 0xff, 0x3d, 0x30, 0x2e, 0xff, 0x5e, 0x50, 0x4f, 0xff, 0x3d, 0x30, 0x2d, 0xff, 0x2f, 0x23, 0x1f, 0xff, 0x45, 0x38, 0x34, 0xff, 0x33, 0x27, 0x22, 0xff, 0x53, 0x49, 0x43, 0xff, 0x52, 0x46, 0x43, 0xff, 0x48, 0x3b, 0x3a, 0xff, 0x43, 0x37, 0x37, 0xff, 0x2b, 0x20, 0x20, 0xff, 0x25, 0x1c, 0x1c, 0xff, 0x18, 0x11, 0x0e, 0xff, 0x2b, 0x21, 0x1f, 0xff, 0x3b, 0x2e, 0x2c, 0xff, 0x85, 0x78, 0x75, 0xff, 0x95, 0x88, 0x86, 0xff, 0x5c, 0x51, 0x4f, 0xff, 0x3e, 0x34, 0x33, 0xff, 0x56, 0x4a, 0x4a, 0xff, 0x98, 0x8b, 0x8b, 0xff, 0x7d, 0x6f, 0x71, 0xff, 0x57, 0x48, 0x4a, 0xff, 0x8a, 0x79, 0x79, 0xff, 0x9a, 0x87, 0x86, 0xff, 0x77, 0x65, 0x63, 0xff, 0x6d, 0x5c, 0x58, 0xff, 0x73, 0x62, 0x5c, 0xff, 0x83, 0x71, 0x6b, 0xff, 0x7d, 0x68, 0x64, 0xff, 0x73, 0x5b, 0x53, 0xff, 0x83, 0x6c, 0x5d, 0xff, 0x9b, 0x85, 0x76, 0xff, 0x98, 0x82, 0x72, 0xff, 0x99, 0x83, 0x73, 0xff, 0xd5, 0xc0, 0xb0, 0xff, 0xf9, 0xe4, 0xd5, 0xff, 0xd1, 0xbb, 0xaf, 0xff, 0x98, 0x82, 0x78, 0xfe, 0xd5, 0xc0, 0xb5, 0x8e, 0xfe, 0xda, 0xda, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x12, 0x18, 0x29, 0x18, 0x15, 0x13, 0xd1, 0x2d, 0x28, 0x26, 0xff, 0x28, 0x21, 0x23, 0xff, 0x28, 0x20, 0x21, 0xff, 0x39, 0x2f, 0x2e, 0xff, 0x38, 0x2a, 0x28, 0xff, 0x40, 0x33, 0x31, 0xff, 0x49, 0x3c, 0x3b, 0xff, 0x3a, 0x2d, 0x2f, 0xff, 0x4c, 0x3e, 0x3e, 0xff, 0x4a, 0x3b, 0x39, 0xff, 0x4c, 0x3e, 0x3c, 0xff, 0x43, 0x34, 0x32, 0xff, 0x37, 0x25, 0x24, 0xff, 0x53, 0x41, 0x40, 0xff, 0x4c, 0x3c, 0x3a, 0xff, 0x35, 0x26, 0x24, 0xff, 0x59, 0x4c, 0x4a, 0xff, 0x5e, 0x4d, 0x4b, 0xff, 0x5b, 0x47, 0x46, 0xff, 0x54, 0x45, 0x43, 0xff, 0x31, 0x29, 0x26, 0xff, 0x35, 0x2a, 0x28, 0xff, 0x55, 0x47, 0x44, 0xff, 0x50, 0x42, 0x3f, 0xff, 0x3e, 0x30, 0x2d, 0xff, 0x3c, 0x2d, 0x2a, 0xff, 0x48, 0x37, 0x32, 0xff, 0x56, 0x45, 0x40, 0xff, 0x4a, 0x39, 0x37, 0xff, 0x44, 0x36, 0x34, 0xff, 0x57, 0x4b, 0x49, 0xff, 0x5f, 0x52, 0x50, 0xff, 0x1b, 0x0f, 0x0d, 0xff, 0x3d, 0x30, 0x2e, 0xff, 0x54, 0x47, 0x45, 0xff, 0x60, 0x53, 0x51, 0xff, 0x3f, 0x33, 0x30, 0xff, 0x30, 0x25, 0x22, 0xff, 0x38, 0x2b, 0x28, 0xff, 0x30, 0x24, 0x20, 0xff, 0x55, 0x4a, 0x46, 0xff, 0x3c, 0x30, 0x2d, 0xff, 0x3f, 0x32, 0x31, 0xff, 0x43, 0x37, 0x37, 0xff, 0x23, 0x17, 0x18, 0xff, 0x13, 0x09, 0x09, 0xff, 0x30, 0x26, 0x23, 0xff, 0x36, 0x2a, 0x28, 0xff, 0x4a, 0x3c, 0x3a, 0xff, 0x7f, 0x71, 0x6f, 0xff, 0x7d, 0x70, 0x6e, 0xff, 0x81, 0x75, 0x72, 0xff, 0x40, 0x35, 0x34, 0xff, 0x5e, 0x52, 0x53, 0xff, 0xae, 0xa1, 0xa1, 0xff, 0x7d, 0x6f, 0x70, 0xff, 0x40, 0x31, 0x32, 0xff, 0x6d, 0x5c, 0x5c, 0xff, 0xad, 0x9a, 0x99, 0xff, 0x7a, 0x68, 0x67, 0xff, 0x54, 0x43, 0x40, 0xff, 0x66, 0x56, 0x50, 0xff, 0x81, 0x6e, 0x69, 0xff, 0x8c, 0x75, 0x71, 0xff, 0xa6, 0x8c, 0x86, 0xff, 0xa0, 0x88, 0x7a, 0xff, 0x9f, 0x89, 0x79, 0xff, 0xc3, 0xac, 0x9d, 0xff, 0x9f, 0x89, 0x7a, 0xff, 0x75, 0x61, 0x51, 0xff, 0xda, 0xc5, 0xb7, 0xff, 0xf2, 0xdc, 0xd1, 0xff, 0xa0, 0x89, 0x7f, 0xff, 0x9d, 0x86, 0x7c, 0xff, 0xf2, 0xdc, 0xd0, 0xd1, 0xec, 0xd9, 0xc7, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x26, 0x29, 0x56, 0x35, 0x2d, 0x2e, 0xf3, 0x31, 0x28, 0x2a, 0xff, 0x22, 0x1c, 0x1c, 0xff, 0x13, 0x0e, 0x0d, 0xff, 0x2d, 0x26, 0x26, 0xff, 0x34, 0x2a, 0x2a, 0xff, 0x43, 0x37, 0x37, 0xff, 0x4a, 0x3e, 0x3e, 0xff, 0x40, 0x34, 0x34, 0xff, 0x42, 0x34, 0x36, 0xff, 0x58, 0x47, 0x49, 0xff, 0x58, 0x44, 0x43, 0xff, 0x46, 0x34, 0x31, 0xff, 0x3b, 0x2b, 0x28, 0xff, 0x57, 0x48, 0x44, 0xff, 0x38, 0x2c, 0x28, 0xff, 0x28, 0x1c, 0x18, 0xff, 0x40, 0x33, 0x30, 0xff, 0x65, 0x56, 0x53, 0xff, 0x35, 0x25, 0x22, 0xff, 0x56, 0x47, 0x44, 0xff, 0x61, 0x52, 0x4f, 0xff, 0x2b, 0x20, 0x1c, 0xff, 0x3e, 0x33, 0x2f, 0xff, 0x54, 0x49, 0x45, 0xff, 0x4b, 0x41, 0x3e, 0xff, 0x3e, 0x32, 0x30, 0xff, 0x37, 0x2b, 0x28, 0xff, 0x4b, 0x3c, 0x3a, 0xff, 0x50, 0x3d, 0x3d, 0xff, 0x50, 0x3b, 0x3a, 0xff, 0x48, 0x35, 0x34, 0xff, 0x50, 0x41, 0x3f, 0xff, 0x3e, 0x31, 0x2f, 0xff, 0x2d, 0x20, 0x1e, 0xff, 0x48, 0x39, 0x37, 0xff, 0x58, 0x4b, 0x49, 0xff, 0x55, 0x49, 0x47, 0xff, 0x33, 0x2b, 0x28, 0xff, 0x30, 0x2a, 0x27, 0xff, 0x26, 0x20, 0x1d, 0xff, 0x35, 0x2b, 0x29, 0xff, 0x5f, 0x52, 0x50, 0xff, 0x47, 0x3b, 0x39, 0xff, 0x4b, 0x40, 0x3e, 0xff, 0x2a, 0x1f, 0x1d, 0xff, 0x1a, 0x0e, 0x0b, 0xff, 0x32, 0x26, 0x21, 0xff, 0x46, 0x3b, 0x33, 0xff, 0x58, 0x4d, 0x48, 0xff, 0x60, 0x55, 0x54, 0xff, 0x69, 0x5e, 0x5e, 0xff, 0x70, 0x63, 0x62, 0xff, 0x95, 0x87, 0x84, 0xff, 0x60, 0x52, 0x50, 0xff, 0x4c, 0x40, 0x3e, 0xff, 0x9a, 0x8d, 0x8b, 0xff, 0x70, 0x62, 0x60, 0xff, 0x3a, 0x2b, 0x29, 0xff, 0x53, 0x44, 0x42, 0xff, 0x93, 0x84, 0x81, 0xff, 0x8b, 0x79, 0x76, 0xff, 0x48, 0x35, 0x32, 0xff, 0x55, 0x40, 0x3e, 0xff, 0x7b, 0x67, 0x65, 0xff, 0x85, 0x6f, 0x6d, 0xff, 0x7b, 0x65, 0x61, 0xff, 0x73, 0x5d, 0x53, 0xff, 0x8e, 0x78, 0x6c, 0xff, 0xcd, 0xb6, 0xab, 0xff, 0xd9, 0xc3, 0xb7, 0xff, 0x7b, 0x65, 0x5a, 0xff, 0x7e, 0x68, 0x5f, 0xff, 0xea, 0xd5, 0xcd, 0xff, 0xd6, 0xc2, 0xbb, 0xff, 0x8d, 0x77, 0x71, 0xff, 0xc7, 0xaf, 0xa9, 0xff, 0xe8, 0xce, 0xc7, 0xf3, 0xc3, 0xab, 0xa6, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x55, 0x03, 0x39, 0x31, 0x33, 0x8a, 0x44, 0x3c, 0x3c, 0xfe, 0x36, 0x2f, 0x2f, 0xff, 0x1b, 0x12, 0x14, 0xff, 0x05, 0x00, 0x00, 0xff, 0x19, 0x12, 0x12, 0xff, 0x4a, 0x40, 0x42, 0xff, 0x5a, 0x4e, 0x4f, 0xff, 0x46, 0x39, 0x3a, 0xff, 0x3b, 0x2e, 0x2f, 0xff, 0x47, 0x3b, 0x3c, 0xff, 0x44, 0x37, 0x38, 0xff, 0x57, 0x48, 0x48, 0xff, 0x53, 0x40, 0x40, 0xff, 0x34, 0x23, 0x20, 0xff, 0x48, 0x3a, 0x36, 0xff, 0x4d, 0x40, 0x3d, 0xff, 0x20, 0x16, 0x13, 0xff, 0x33, 0x27, 0x25, 0xff, 0x4e, 0x41, 0x3f, 0xff, 0x57, 0x49, 0x47, 0xff, 0x22, 0x13, 0x12, 0xff, 0x54, 0x46, 0x44, 0xff, 0x61, 0x53, 0x51, 0xff, 0x3b, 0x2f, 0x2d, 0xff, 0x48, 0x3c, 0x3a, 0xff, 0x3f, 0x33, 0x31, 0xff, 0x48, 0x3d, 0x3b, 0xff, 0x3b, 0x2f, 0x2d, 0xff, 0x36, 0x29, 0x27, 0xff, 0x49, 0x3a, 0x39, 0xff, 0x56, 0x46, 0x44, 0xff, 0x5a, 0x47, 0x46, 0xff, 0x48, 0x36, 0x35, 0xff, 0x4a, 0x3a, 0x38, 0xff, 0x34, 0x27, 0x25, 0xff, 0x3a, 0x2c, 0x2a, 0xff, 0x39, 0x2a, 0x28, 0xff, 0x65, 0x58, 0x56, 0xff, 0x54, 0x48, 0x46, 0xff, 0x28, 0x21, 0x1e, 0xff, 0x24, 0x1e, 0x1b, 0xff, 0x1e, 0x18, 0x15, 0xff, 0x43, 0x39, 0x37, 0xff, 0x45, 0x38, 0x36, 0xff, 0x49, 0x3c, 0x3a, 0xff, 0x53, 0x48, 0x46, 0xff, 0x21, 0x16, 0x14, 0xff, 0x2f, 0x23, 0x20, 0xff, 0x3b, 0x2f, 0x2a, 0xff, 0x49, 0x3e, 0x36, 0xff, 0x5c, 0x50, 0x4c, 0xff, 0x5b, 0x50, 0x4e, 0xff, 0x43, 0x38, 0x39, 0xff, 0x54, 0x47, 0x46, 0xff, 0x7d, 0x6f, 0x6c, 0xff, 0x5b, 0x4d, 0x4a, 0xff, 0x4d, 0x40, 0x3e, 0xff, 0x76, 0x6a, 0x68, 0xff, 0x79, 0x6b, 0x69, 0xff, 0x52, 0x43, 0x40, 0xff, 0x40, 0x31, 0x2f, 0xff, 0x80, 0x71, 0x6f, 0xff, 0x82, 0x72, 0x6f, 0xff, 0x57, 0x44, 0x41, 0xff, 0x56, 0x42, 0x40, 0xff, 0x6f, 0x5c, 0x5a, 0xff, 0x73, 0x5f, 0x5d, 0xff, 0x65, 0x51, 0x4d, 0xff, 0x5b, 0x45, 0x3e, 0xff, 0x47, 0x30, 0x27, 0xff, 0x67, 0x51, 0x4a, 0xff, 0x9c, 0x85, 0x7d, 0xff, 0xb9, 0xa3, 0x9b, 0xff, 0x5f, 0x48, 0x43, 0xff, 0xaa, 0x96, 0x92, 0xff, 0xf7, 0xe4, 0xe0, 0xff, 0xaa, 0x96, 0x92, 0xff, 0x8e, 0x79, 0x75, 0xff, 0xd3, 0xbd, 0xb9, 0xff, 0xc2, 0xae, 0xa8, 0xfe, 0x9b, 0x8d, 0x85, 0x8b, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x45, 0x5c, 0x0b, 0x3f, 0x33, 0x3c, 0xae, 0x53, 0x4b, 0x4b, 0xff, 0x34, 0x2c, 0x2c, 0xff, 0x11, 0x09, 0x0a, 0xff, 0x12, 0x0a, 0x0b, 0xff, 0x24, 0x1c, 0x1e, 0xff, 0x54, 0x4a, 0x4c, 0xff, 0x5d, 0x50, 0x53, 0xff, 0x41, 0x34, 0x36, 0xff, 0x44, 0x37, 0x3a, 0xff, 0x54, 0x46, 0x48, 0xff, 0x44, 0x36, 0x39, 0xff, 0x3d, 0x32, 0x33, 0xff, 0x58, 0x4b, 0x4b, 0xff, 0x39, 0x29, 0x27, 0xff, 0x34, 0x24, 0x22, 0xff, 0x62, 0x55, 0x53, 0xff, 0x2a, 0x1d, 0x1b, 0xff, 0x34, 0x29, 0x28, 0xff, 0x36, 0x2d, 0x2d, 0xff, 0x49, 0x3d, 0x3d, 0xff, 0x5b, 0x4e, 0x4e, 0xff, 0x37, 0x29, 0x2a, 0xff, 0x52, 0x44, 0x45, 0xff, 0x56, 0x48, 0x49, 0xff, 0x43, 0x37, 0x37, 0xff, 0x43, 0x36, 0x36, 0xff, 0x3b, 0x2f, 0x2f, 0xff, 0x41, 0x36, 0x33, 0xff, 0x2e, 0x22, 0x20, 0xff, 0x41, 0x34, 0x32, 0xff, 0x50, 0x43, 0x41, 0xff, 0x54, 0x47, 0x45, 0xff, 0x49, 0x38, 0x36, 0xff, 0x40, 0x2f, 0x2d, 0xff, 0x69, 0x5a, 0x58, 0xff, 0x3e, 0x31, 0x2f, 0xff, 0x22, 0x14, 0x12, 0xff, 0x3a, 0x2b, 0x29, 0xff, 0x5c, 0x4f, 0x4d, 0xff, 0x4a, 0x3e, 0x3c, 0xff, 0x25, 0x1d, 0x1a, 0xff, 0x0f, 0x0a, 0x06, 0xff, 0x25, 0x1f, 0x1c, 0xff, 0x33, 0x29, 0x27, 0xff, 0x3c, 0x2e, 0x2d, 0xff, 0x44, 0x37, 0x35, 0xff, 0x40, 0x35, 0x33, 0xff, 0x30, 0x25, 0x23, 0xff, 0x3d, 0x32, 0x2e, 0xff, 0x37, 0x2c, 0x26, 0xff, 0x53, 0x48, 0x40, 0xff, 0x6b, 0x5f, 0x5b, 0xff, 0x3b, 0x30, 0x2e, 0xff, 0x2c, 0x21, 0x22, 0xff, 0x42, 0x35, 0x34, 0xff, 0x7a, 0x6c, 0x69, 0xff, 0x60, 0x52, 0x4f, 0xff, 0x58, 0x4c, 0x4a, 0xff, 0x59, 0x4c, 0x4b, 0xff, 0x69, 0x5b, 0x59, 0xff, 0x5a, 0x4a, 0x48, 0xff, 0x2e, 0x1f, 0x1d, 0xff, 0x62, 0x53, 0x50, 0xff, 0x6b, 0x5c, 0x59, 0xff, 0x5d, 0x4d, 0x4a, 0xff, 0x47, 0x35, 0x32, 0xff, 0x6a, 0x58, 0x56, 0xff, 0x72, 0x5f, 0x5c, 0xff, 0x78, 0x65, 0x60, 0xff, 0x64, 0x4f, 0x4a, 0xff, 0x4e, 0x37, 0x32, 0xff, 0x53, 0x3e, 0x39, 0xff, 0x67, 0x50, 0x4b, 0xff, 0x8b, 0x74, 0x70, 0xff, 0x6b, 0x56, 0x52, 0xff, 0x5b, 0x48, 0x46, 0xff, 0xe4, 0xd4, 0xd3, 0xff, 0xe5, 0xd3, 0xd1, 0xff, 0x90, 0x7a, 0x7a, 0xff, 0xb3, 0xa0, 0x9d, 0xff, 0xd1, 0xc1, 0xbe, 0xff, 0x9a, 0x8b, 0x89, 0xff, 0xb3, 0xa1, 0x9d, 0xaf, 0xd0, 0xb9, 0xb9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x73, 0x73, 0x16, 0x57, 0x49, 0x56, 0xc9, 0x56, 0x49, 0x52, 0xff, 0x41, 0x37, 0x39, 0xff, 0x24, 0x1a, 0x1a, 0xff, 0x20, 0x17, 0x16, 0xff, 0x2c, 0x23, 0x24, 0xff, 0x3f, 0x33, 0x35, 0xff, 0x56, 0x48, 0x4b, 0xff, 0x3d, 0x32, 0x34, 0xff, 0x38, 0x2d, 0x2e, 0xff, 0x45, 0x39, 0x3b, 0xff, 0x36, 0x2b, 0x2d, 0xff, 0x3c, 0x31, 0x33, 0xff, 0x47, 0x3f, 0x3f, 0xff, 0x45, 0x3a, 0x39, 0xff, 0x2b, 0x1d, 0x1d, 0xff, 0x52, 0x44, 0x44, 0xff, 0x45, 0x38, 0x38, 0xff, 0x2a, 0x1e, 0x1e, 0xff, 0x43, 0x39, 0x39, 0xff, 0x19, 0x12, 0x12, 0xff, 0x3f, 0x35, 0x35, 0xff, 0x5d, 0x51, 0x51, 0xff, 0x2e, 0x22, 0x22, 0xff, 0x41, 0x35, 0x35, 0xff, 0x45, 0x39, 0x39, 0xff, 0x3e, 0x33, 0x33, 0xff, 0x46, 0x3c, 0x3b, 0xff, 0x3d, 0x32, 0x32, 0xff, 0x28, 0x1e, 0x1d, 0xff, 0x30, 0x25, 0x25, 0xff, 0x4f, 0x45, 0x45, 0xff, 0x4f, 0x44, 0x42, 0xff, 0x44, 0x37, 0x35, 0xff, 0x3e, 0x2e, 0x2c, 0xff, 0x41, 0x30, 0x2e, 0xff, 0x51, 0x43, 0x41, 0xff, 0x3d, 0x30, 0x2e, 0xff, 0x26, 0x1a, 0x18, 0xff, 0x4e, 0x41, 0x3f, 0xff, 0x4f, 0x43, 0x41, 0xff, 0x2c, 0x20, 0x1e, 0xff, 0x1c, 0x11, 0x0e, 0xff, 0x36, 0x2b, 0x29, 0xff, 0x31, 0x26, 0x25, 0xff, 0x2a, 0x1f, 0x1d, 0xff, 0x41, 0x38, 0x35, 0xff, 0x3d, 0x31, 0x2f, 0xff, 0x34, 0x28, 0x27, 0xff, 0x3d, 0x31, 0x30, 0xff, 0x32, 0x26, 0x23, 0xff, 0x4f, 0x42, 0x3d, 0xff, 0x68, 0x5c, 0x55, 0xff, 0x3b, 0x2f, 0x2b, 0xff, 0x3c, 0x30, 0x2f, 0xff, 0x2d, 0x21, 0x21, 0xff, 0x5c, 0x50, 0x4e, 0xff, 0x8b, 0x7d, 0x79, 0xff, 0x55, 0x47, 0x44, 0xff, 0x4c, 0x40, 0x3d, 0xff, 0x4f, 0x44, 0x41, 0xff, 0x5d, 0x50, 0x4d, 0xff, 0x5b, 0x4c, 0x49, 0xff, 0x30, 0x21, 0x1e, 0xff, 0x42, 0x33, 0x31, 0xff, 0x56, 0x46, 0x44, 0xff, 0x5c, 0x4d, 0x4a, 0xff, 0x42, 0x33, 0x31, 0xff, 0x49, 0x37, 0x36, 0xff, 0x66, 0x53, 0x53, 0xff, 0x76, 0x62, 0x61, 0xff, 0x58, 0x45, 0x43, 0xff, 0x3c, 0x29, 0x26, 0xff, 0x4a, 0x37, 0x34, 0xff, 0x46, 0x33, 0x2f, 0xff, 0x4c, 0x39, 0x35, 0xff, 0x68, 0x55, 0x52, 0xff, 0x41, 0x2f, 0x2e, 0xff, 0x75, 0x65, 0x67, 0xff, 0xf1, 0xe1, 0xe3, 0xff, 0xb8, 0xa7, 0xa8, 0xff, 0x80, 0x70, 0x70, 0xff, 0xc4, 0xb2, 0xb1, 0xff, 0xa9, 0x9a, 0x96, 0xff, 0xb9, 0xac, 0xa7, 0xff, 0xd0, 0xbf, 0xbb, 0xc9, 0xdc, 0xc5, 0xb9, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x93, 0x93, 0x1a, 0x9c, 0x8e, 0x94, 0xd6, 0x5b, 0x4c, 0x59, 0xff, 0x4c, 0x3f, 0x47, 0xff, 0x2c, 0x21, 0x22, 0xff, 0x39, 0x2f, 0x2f, 0xff, 0x39, 0x2f, 0x2f, 0xff, 0x37, 0x2b, 0x2e, 0xff, 0x2a, 0x1d, 0x20, 0xff, 0x3d, 0x30, 0x33, 0xff, 0x51, 0x49, 0x4a, 0xff, 0x37, 0x30, 0x31, 0xff, 0x28, 0x21, 0x23, 0xff, 0x3a, 0x33, 0x35, 0xff, 0x46, 0x3f, 0x40, 0xff, 0x33, 0x2d, 0x2d, 0xff, 0x23, 0x19, 0x19, 0xff, 0x51, 0x43, 0x44, 0xff, 0x5a, 0x4b, 0x4d, 0xff, 0x26, 0x19, 0x1a, 0xff, 0x3b, 0x30, 0x30, 0xff, 0x31, 0x2a, 0x29, 0xff, 0x04, 0x00, 0x00, 0xff, 0x3e, 0x36, 0x36, 0xff, 0x5a, 0x50, 0x50, 0xff, 0x2d, 0x22, 0x23, 0xff, 0x41, 0x36, 0x37, 0xff, 0x3e, 0x33, 0x34, 0xff, 0x31, 0x27, 0x27, 0xff, 0x31, 0x27, 0x28, 0xff, 0x26, 0x1c, 0x1d, 0xff, 0x2d, 0x23, 0x24, 0xff, 0x3d, 0x33, 0x33, 0xff, 0x4d, 0x43, 0x44, 0xff, 0x56, 0x4c, 0x4b, 0xff, 0x3f, 0x34, 0x31, 0xff, 0x41, 0x31, 0x30, 0xff, 0x4b, 0x3a, 0x39, 0xff, 0x3b, 0x2d, 0x2b, 0xff, 0x3a, 0x2e, 0x2c, 0xff, 0x57, 0x4c, 0x4a, 0xff, 0x49, 0x3e, 0x3c, 0xff, 0x3a, 0x2e, 0x2c, 0xff, 0x26, 0x1a, 0x18, 0xff, 0x30, 0x23, 0x21, 0xff, 0x58, 0x4b, 0x49, 0xff, 0x33, 0x26, 0x24, 0xff, 0x26, 0x1c, 0x1a, 0xff, 0x3a, 0x32, 0x2f, 0xff, 0x2c, 0x21, 0x1e, 0xff, 0x33, 0x26, 0x25, 0xff, 0x53, 0x46, 0x44, 0xff, 0x37, 0x28, 0x26, 0xff, 0x5f, 0x50, 0x4c, 0xff, 0x67, 0x5b, 0x54, 0xff, 0x38, 0x2c, 0x28, 0xff, 0x1a, 0x0f, 0x0e, 0xff, 0x4d, 0x42, 0x40, 0xff, 0x78, 0x6c, 0x68, 0xff, 0x50, 0x42, 0x3e, 0xff, 0x3d, 0x2f, 0x2c, 0xff, 0x3e, 0x32, 0x2e, 0xff, 0x52, 0x46, 0x42, 0xff, 0x55, 0x48, 0x44, 0xff, 0x48, 0x39, 0x35, 0xff, 0x39, 0x2a, 0x26, 0xff, 0x38, 0x29, 0x27, 0xff, 0x3f, 0x30, 0x2e, 0xff, 0x4a, 0x3c, 0x3a, 0xff, 0x40, 0x32, 0x30, 0xff, 0x41, 0x31, 0x2f, 0xff, 0x54, 0x43, 0x42, 0xff, 0x6d, 0x5d, 0x5c, 0xff, 0x62, 0x51, 0x4f, 0xff, 0x3e, 0x2d, 0x2b, 0xff, 0x3f, 0x2e, 0x2c, 0xff, 0x46, 0x36, 0x32, 0xff, 0x2f, 0x1f, 0x19, 0xff, 0x3d, 0x2c, 0x28, 0xff, 0x54, 0x42, 0x41, 0xff, 0x3f, 0x2e, 0x2f, 0xff, 0xba, 0xaa, 0xac, 0xff, 0xf0, 0xe2, 0xe3, 0xff, 0x81, 0x72, 0x72, 0xff, 0x9b, 0x88, 0x87, 0xff, 0xb0, 0xa0, 0x9c, 0xff, 0xc1, 0xb5, 0xb4, 0xff, 0xc6, 0xb9, 0xb8, 0xff, 0xd0, 0xbe, 0xbb, 0xd6, 0xd7, 0xc4, 0xba, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x8f, 0x97, 0x20, 0xdc, 0xd4, 0xd2, 0xde, 0x86, 0x7e, 0x81, 0xff, 0x4e, 0x41, 0x4c, 0xff, 0x2d, 0x21, 0x26, 0xff, 0x40, 0x36, 0x36, 0xff, 0x45, 0x3c, 0x3b, 0xff, 0x28, 0x1e, 0x1e, 0xff, 0x25, 0x1a, 0x1b, 0xff, 0x22, 0x16, 0x19, 0xff, 0x4d, 0x43, 0x46, 0xff, 0x42, 0x3a, 0x3d, 0xff, 0x2b, 0x25, 0x28, 0xff, 0x35, 0x31, 0x33, 0xff, 0x38, 0x33, 0x36, 0xff, 0x30, 0x2c, 0x2e, 0xff, 0x25, 0x21, 0x20, 0xff, 0x2e, 0x25, 0x25, 0xff, 0x57, 0x49, 0x49, 0xff, 0x39, 0x2b, 0x2c, 0xff, 0x32, 0x27, 0x27, 0xff, 0x37, 0x2d, 0x2c, 0xff, 0x17, 0x10, 0x11, 0xff, 0x0e, 0x0a, 0x0c, 0xff, 0x3e, 0x37, 0x38, 0xff, 0x4a, 0x42, 0x43, 0xff, 0x39, 0x2f, 0x31, 0xff, 0x3e, 0x34, 0x36, 0xff, 0x3a, 0x30, 0x32, 0xff, 0x36, 0x2b, 0x2d, 0xff, 0x30, 0x24, 0x26, 0xff, 0x30, 0x25, 0x27, 0xff, 0x3f, 0x34, 0x35, 0xff, 0x43, 0x38, 0x38, 0xff, 0x42, 0x38, 0x38, 0xff, 0x40, 0x38, 0x36, 0xff, 0x33, 0x2a, 0x27, 0xff, 0x37, 0x29, 0x27, 0xff, 0x50, 0x40, 0x3c, 0xff, 0x4d, 0x3e, 0x3b, 0xff, 0x4c, 0x3f, 0x3c, 0xff, 0x56, 0x49, 0x47, 0xff, 0x2e, 0x22, 0x20, 0xff, 0x31, 0x25, 0x23, 0xff, 0x60, 0x54, 0x52, 0xff, 0x59, 0x4d, 0x4b, 0xff, 0x48, 0x3d, 0x3b, 0xff, 0x3c, 0x30, 0x2e, 0xff, 0x27, 0x1d, 0x1b, 0xff, 0x28, 0x20, 0x1d, 0xff, 0x3e, 0x33, 0x31, 0xff, 0x4e, 0x41, 0x40, 0xff, 0x46, 0x37, 0x36, 0xff, 0x59, 0x48, 0x46, 0xff, 0x62, 0x52, 0x4e, 0xff, 0x53, 0x48, 0x3f, 0xff, 0x31, 0x25, 0x20, 0xff, 0x3a, 0x2e, 0x2e, 0xff, 0x54, 0x49, 0x48, 0xff, 0x3c, 0x30, 0x2d, 0xff, 0x43, 0x34, 0x31, 0xff, 0x39, 0x2b, 0x27, 0xff, 0x31, 0x26, 0x21, 0xff, 0x3c, 0x31, 0x2c, 0xff, 0x4a, 0x3d, 0x39, 0xff, 0x51, 0x42, 0x3f, 0xff, 0x40, 0x30, 0x2e, 0xff, 0x2e, 0x1f, 0x1d, 0xff, 0x33, 0x28, 0x25, 0xff, 0x3d, 0x31, 0x30, 0xff, 0x45, 0x37, 0x36, 0xff, 0x43, 0x35, 0x32, 0xff, 0x3e, 0x30, 0x2e, 0xff, 0x55, 0x47, 0x45, 0xff, 0x6c, 0x5d, 0x5a, 0xff, 0x3c, 0x2c, 0x29, 0xff, 0x39, 0x29, 0x27, 0xff, 0x42, 0x34, 0x30, 0xff, 0x37, 0x29, 0x22, 0xff, 0x31, 0x21, 0x1e, 0xff, 0x44, 0x33, 0x32, 0xff, 0x3e, 0x2b, 0x2a, 0xff, 0x83, 0x73, 0x72, 0xff, 0xe5, 0xd9, 0xd8, 0xff, 0xa3, 0x97, 0x91, 0xff, 0x86, 0x74, 0x70, 0xff, 0xb9, 0xa7, 0xa6, 0xff, 0xd1, 0xc5, 0xc5, 0xff, 0xc9, 0xbc, 0xbd, 0xff, 0xc8, 0xb5, 0xb6, 0xff, 0xcb, 0xb6, 0xb6, 0xde, 0xd7, 0xbf, 0xc7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x9a, 0xa3, 0x1c, 0xde, 0xd5, 0xd6, 0xdb, 0xa4, 0x99, 0x9b, 0xff, 0x66, 0x58, 0x5e, 0xff, 0x4b, 0x3c, 0x45, 0xff, 0x4d, 0x3f, 0x44, 0xff, 0x52, 0x48, 0x46, 0xff, 0x32, 0x27, 0x25, 0xff, 0x24, 0x18, 0x1a, 0xff, 0x24, 0x18, 0x1d, 0xff, 0x38, 0x30, 0x33, 0xff, 0x45, 0x3e, 0x41, 0xff, 0x3d, 0x36, 0x39, 0xff, 0x3a, 0x34, 0x36, 0xff, 0x2d, 0x29, 0x2b, 0xff, 0x24, 0x1f, 0x21, 0xff, 0x1e, 0x19, 0x1c, 0xff, 0x2c, 0x27, 0x27, 0xff, 0x46, 0x3f, 0x3f, 0xff, 0x3b, 0x33, 0x33, 0xff, 0x29, 0x21, 0x20, 0xff, 0x2b, 0x24, 0x24, 0xff, 0x13, 0x0d, 0x0c, 0xff, 0x12, 0x0d, 0x0b, 0xff, 0x21, 0x1d, 0x1c, 0xff, 0x2f, 0x28, 0x28, 0xff, 0x36, 0x2e, 0x2f, 0xff, 0x43, 0x3b, 0x3c, 0xff, 0x40, 0x37, 0x39, 0xff, 0x30, 0x27, 0x29, 0xff, 0x32, 0x27, 0x2a, 0xff, 0x34, 0x2a, 0x2c, 0xff, 0x39, 0x2f, 0x30, 0xff, 0x3f, 0x35, 0x36, 0xff, 0x39, 0x2f, 0x2f, 0xff, 0x3f, 0x35, 0x36, 0xff, 0x33, 0x2a, 0x28, 0xff, 0x2e, 0x24, 0x20, 0xff, 0x37, 0x2c, 0x2a, 0xff, 0x3e, 0x32, 0x32, 0xff, 0x54, 0x49, 0x48, 0xff, 0x44, 0x3a, 0x39, 0xff, 0x28, 0x1e, 0x1d, 0xff, 0x22, 0x17, 0x15, 0xff, 0x44, 0x37, 0x36, 0xff, 0x70, 0x63, 0x61, 0xff, 0x61, 0x53, 0x51, 0xff, 0x4e, 0x40, 0x3e, 0xff, 0x49, 0x3b, 0x39, 0xff, 0x29, 0x1d, 0x1a, 0xff, 0x29, 0x1f, 0x1b, 0xff, 0x48, 0x3c, 0x39, 0xff, 0x34, 0x28, 0x24, 0xff, 0x36, 0x29, 0x26, 0xff, 0x5d, 0x50, 0x4c, 0xff, 0x4c, 0x3e, 0x3a, 0xff, 0x34, 0x28, 0x24, 0xff, 0x45, 0x39, 0x36, 0xff, 0x51, 0x45, 0x43, 0xff, 0x29, 0x1d, 0x1b, 0xff, 0x24, 0x18, 0x16, 0xff, 0x41, 0x35, 0x32, 0xff, 0x31, 0x25, 0x22, 0xff, 0x3a, 0x2f, 0x2b, 0xff, 0x2f, 0x23, 0x1d, 0xff, 0x41, 0x32, 0x2d, 0xff, 0x59, 0x48, 0x44, 0xff, 0x46, 0x35, 0x31, 0xff, 0x31, 0x20, 0x1c, 0xff, 0x38, 0x2a, 0x27, 0xff, 0x47, 0x3a, 0x37, 0xff, 0x3c, 0x30, 0x2c, 0xff, 0x2a, 0x1e, 0x1b, 0xff, 0x36, 0x2a, 0x28, 0xff, 0x44, 0x37, 0x36, 0xff, 0x6a, 0x5d, 0x5b, 0xff, 0x50, 0x42, 0x3f, 0xff, 0x31, 0x22, 0x1e, 0xff, 0x32, 0x21, 0x1c, 0xff, 0x3e, 0x2f, 0x2a, 0xff, 0x2d, 0x20, 0x1e, 0xff, 0x37, 0x28, 0x26, 0xff, 0x45, 0x31, 0x30, 0xff, 0x3e, 0x2c, 0x2b, 0xff, 0xc7, 0xba, 0xb7, 0xff, 0xb6, 0xa7, 0xa5, 0xff, 0x52, 0x42, 0x41, 0xff, 0xbd, 0xae, 0xaf, 0xff, 0xdb, 0xce, 0xd2, 0xff, 0xcc, 0xbf, 0xc4, 0xff, 0xc2, 0xb6, 0xb9, 0xff, 0xb4, 0xa9, 0xaa, 0xff, 0xaa, 0x9c, 0x9c, 0xdc, 0xb6, 0xa3, 0x9a, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x15, 0xed, 0xeb, 0xef, 0xd6, 0xc2, 0xbc, 0xc0, 0xff, 0x7e, 0x70, 0x78, 0xff, 0x4f, 0x3c, 0x46, 0xff, 0x47, 0x37, 0x3f, 0xff, 0x5f, 0x52, 0x56, 0xff, 0x39, 0x31, 0x2e, 0xff, 0x21, 0x17, 0x14, 0xff, 0x24, 0x18, 0x1c, 0xff, 0x32, 0x27, 0x2e, 0xff, 0x52, 0x4b, 0x4e, 0xff, 0x3f, 0x3a, 0x3d, 0xff, 0x28, 0x21, 0x24, 0xff, 0x23, 0x1c, 0x1f, 0xff, 0x1f, 0x17, 0x1b, 0xff, 0x10, 0x08, 0x0c, 0xff, 0x2a, 0x23, 0x26, 0xff, 0x47, 0x41, 0x43, 0xff, 0x46, 0x40, 0x41, 0xff, 0x24, 0x1f, 0x20, 0xff, 0x19, 0x15, 0x15, 0xff, 0x1a, 0x15, 0x15, 0xff, 0x13, 0x0e, 0x0e, 0xff, 0x1c, 0x18, 0x17, 0xff, 0x27, 0x23, 0x21, 0xff, 0x28, 0x21, 0x21, 0xff, 0x33, 0x2a, 0x2c, 0xff, 0x40, 0x36, 0x39, 0xff, 0x3c, 0x32, 0x35, 0xff, 0x24, 0x1a, 0x1e, 0xff, 0x1e, 0x15, 0x18, 0xff, 0x38, 0x2f, 0x31, 0xff, 0x45, 0x3d, 0x3e, 0xff, 0x46, 0x3e, 0x3f, 0xff, 0x44, 0x3c, 0x3d, 0xff, 0x31, 0x28, 0x29, 0xff, 0x20, 0x16, 0x13, 0xff, 0x37, 0x2d, 0x28, 0xff, 0x31, 0x29, 0x28, 0xff, 0x45, 0x3e, 0x3f, 0xff, 0x3a, 0x33, 0x33, 0xff, 0x26, 0x1f, 0x20, 0xff, 0x1e, 0x17, 0x17, 0xff, 0x33, 0x29, 0x26, 0xff, 0x5c, 0x4f, 0x4d, 0xff, 0x5b, 0x4e, 0x4c, 0xff, 0x71, 0x62, 0x60, 0xff, 0x60, 0x51, 0x4f, 0xff, 0x42, 0x32, 0x30, 0xff, 0x35, 0x27, 0x24, 0xff, 0x4c, 0x40, 0x3b, 0xff, 0x32, 0x26, 0x22, 0xff, 0x3f, 0x34, 0x30, 0xff, 0x55, 0x4b, 0x46, 0xff, 0x3f, 0x35, 0x30, 0xff, 0x31, 0x27, 0x23, 0xff, 0x3f, 0x35, 0x33, 0xff, 0x4d, 0x43, 0x41, 0xff, 0x34, 0x2a, 0x27, 0xff, 0x1a, 0x0f, 0x0c, 0xff, 0x28, 0x1c, 0x1a, 0xff, 0x51, 0x45, 0x43, 0xff, 0x2e, 0x23, 0x21, 0xff, 0x2a, 0x1e, 0x1b, 0xff, 0x33, 0x27, 0x22, 0xff, 0x47, 0x38, 0x31, 0xff, 0x4a, 0x39, 0x32, 0xff, 0x4a, 0x38, 0x32, 0xff, 0x40, 0x30, 0x2a, 0xff, 0x36, 0x26, 0x23, 0xff, 0x4d, 0x3f, 0x3c, 0xff, 0x42, 0x37, 0x32, 0xff, 0x28, 0x1c, 0x19, 0xff, 0x31, 0x25, 0x23, 0xff, 0x34, 0x28, 0x26, 0xff, 0x59, 0x4c, 0x4c, 0xff, 0x60, 0x51, 0x51, 0xff, 0x43, 0x34, 0x2d, 0xff, 0x27, 0x16, 0x0f, 0xff, 0x3a, 0x2b, 0x28, 0xff, 0x27, 0x1d, 0x1b, 0xff, 0x33, 0x25, 0x23, 0xff, 0x50, 0x3c, 0x3c, 0xff, 0x2e, 0x1e, 0x1c, 0xff, 0x87, 0x77, 0x74, 0xff, 0xcd, 0xbd, 0xbf, 0xff, 0x60, 0x52, 0x54, 0xff, 0xab, 0x9e, 0xa0, 0xff, 0xcf, 0xc4, 0xca, 0xff, 0xc1, 0xb7, 0xc0, 0xff, 0xbd, 0xb4, 0xba, 0xff, 0xa5, 0x9d, 0xa0, 0xff, 0x92, 0x87, 0x83, 0xff, 0x89, 0x7b, 0x73, 0xd7, 0x85, 0x79, 0x6d, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xb2, 0xcc, 0x0a, 0xef, 0xf0, 0xf3, 0xc8, 0xe2, 0xe3, 0xe7, 0xff, 0xc4, 0xc1, 0xc5, 0xff, 0x7f, 0x75, 0x7c, 0xff, 0x56, 0x47, 0x51, 0xff, 0x43, 0x35, 0x3d, 0xff, 0x51, 0x47, 0x4b, 0xff, 0x34, 0x2e, 0x2a, 0xff, 0x2b, 0x23, 0x1f, 0xff, 0x43, 0x3a, 0x3c, 0xff, 0x59, 0x51, 0x57, 0xff, 0x49, 0x42, 0x46, 0xff, 0x26, 0x1f, 0x21, 0xff, 0x1f, 0x18, 0x1b, 0xff, 0x20, 0x19, 0x1c, 0xff, 0x13, 0x0b, 0x0e, 0xff, 0x2b, 0x23, 0x27, 0xff, 0x3d, 0x36, 0x39, 0xff, 0x45, 0x3f, 0x40, 0xff, 0x2b, 0x25, 0x26, 0xff, 0x0b, 0x05, 0x06, 0xff, 0x16, 0x0f, 0x11, 0xff, 0x19, 0x12, 0x13, 0xff, 0x1e, 0x16, 0x17, 0xff, 0x1f, 0x1b, 0x1c, 0xff, 0x1e, 0x1a, 0x1c, 0xff, 0x22, 0x1c, 0x20, 0xff, 0x35, 0x2d, 0x32, 0xff, 0x41, 0x39, 0x3d, 0xff, 0x2d, 0x25, 0x2a, 0xff, 0x16, 0x0e, 0x12, 0xff, 0x3e, 0x36, 0x39, 0xff, 0x53, 0x4c, 0x4e, 0xff, 0x40, 0x39, 0x39, 0xff, 0x35, 0x2e, 0x30, 0xff, 0x22, 0x1b, 0x1c, 0xff, 0x13, 0x0d, 0x0d, 0xff, 0x24, 0x1a, 0x17, 0xff, 0x33, 0x28, 0x23, 0xff, 0x35, 0x2c, 0x2b, 0xff, 0x42, 0x3a, 0x3b, 0xff, 0x2d, 0x25, 0x25, 0xff, 0x25, 0x1d, 0x1d, 0xff, 0x34, 0x2c, 0x2d, 0xff, 0x46, 0x3b, 0x39, 0xff, 0x5a, 0x4d, 0x4b, 0xff, 0x6a, 0x5d, 0x5b, 0xff, 0x6f, 0x60, 0x5e, 0xff, 0x61, 0x50, 0x4e, 0xff, 0x49, 0x38, 0x36, 0xff, 0x57, 0x4a, 0x48, 0xff, 0x3d, 0x32, 0x30, 0xff, 0x2b, 0x1f, 0x1d, 0xff, 0x30, 0x24, 0x22, 0xff, 0x2e, 0x25, 0x21, 0xff, 0x2c, 0x22, 0x1f, 0xff, 0x20, 0x17, 0x14, 0xff, 0x3a, 0x32, 0x2f, 0xff, 0x39, 0x31, 0x2e, 0xff, 0x1f, 0x17, 0x14, 0xff, 0x1e, 0x12, 0x10, 0xff, 0x40, 0x33, 0x31, 0xff, 0x4b, 0x3e, 0x3c, 0xff, 0x29, 0x1e, 0x1d, 0xff, 0x23, 0x19, 0x18, 0xff, 0x30, 0x25, 0x22, 0xff, 0x41, 0x34, 0x2f, 0xff, 0x34, 0x24, 0x1c, 0xff, 0x43, 0x34, 0x2e, 0xff, 0x53, 0x44, 0x3e, 0xff, 0x3d, 0x2e, 0x2b, 0xff, 0x45, 0x37, 0x34, 0xff, 0x48, 0x3c, 0x38, 0xff, 0x2c, 0x20, 0x1d, 0xff, 0x2a, 0x1e, 0x1d, 0xff, 0x2e, 0x23, 0x21, 0xff, 0x52, 0x46, 0x45, 0xff, 0x5c, 0x4d, 0x4b, 0xff, 0x47, 0x37, 0x32, 0xff, 0x2a, 0x19, 0x13, 0xff, 0x32, 0x26, 0x23, 0xff, 0x28, 0x1f, 0x1c, 0xff, 0x27, 0x1a, 0x19, 0xff, 0x43, 0x31, 0x2f, 0xff, 0x3b, 0x2c, 0x2a, 0xff, 0x42, 0x35, 0x33, 0xff, 0xa3, 0x97, 0x96, 0xff, 0x7e, 0x71, 0x72, 0xff, 0x9b, 0x8e, 0x8f, 0xff, 0xc4, 0xbc, 0xc0, 0xff, 0xbd, 0xb8, 0xbf, 0xff, 0xba, 0xb1, 0xb7, 0xff, 0xae, 0xa3, 0xa4, 0xff, 0x97, 0x87, 0x80, 0xff, 0x8c, 0x78, 0x6d, 0xff, 0x92, 0x80, 0x77, 0xc8, 0x99, 0x7f, 0x7f, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0xe3, 0xe3, 0xe7, 0xb1, 0xe0, 0xe4, 0xe9, 0xff, 0xe0, 0xe3, 0xea, 0xff, 0xd7, 0xd5, 0xdc, 0xff, 0x8c, 0x85, 0x8f, 0xff, 0x4f, 0x43, 0x4e, 0xff, 0x50, 0x43, 0x4b, 0xff, 0x48, 0x3e, 0x42, 0xff, 0x2e, 0x28, 0x26, 0xff, 0x46, 0x40, 0x3e, 0xff, 0x57, 0x4f, 0x53, 0xff, 0x49, 0x42, 0x48, 0xff, 0x26, 0x20, 0x23, 0xff, 0x2d, 0x27, 0x2a, 0xff, 0x20, 0x19, 0x1c, 0xff, 0x1d, 0x16, 0x19, 0xff, 0x34, 0x2e, 0x31, 0xff, 0x44, 0x3e, 0x41, 0xff, 0x32, 0x2c, 0x2e, 0xff, 0x27, 0x22, 0x22, 0xff, 0x10, 0x0b, 0x0c, 0xff, 0x0f, 0x09, 0x0a, 0xff, 0x17, 0x10, 0x13, 0xff, 0x1f, 0x18, 0x1c, 0xff, 0x21, 0x1b, 0x1f, 0xff, 0x27, 0x23, 0x26, 0xff, 0x23, 0x1f, 0x24, 0xff, 0x25, 0x1f, 0x26, 0xff, 0x3e, 0x37, 0x3d, 0xff, 0x37, 0x31, 0x37, 0xff, 0x24, 0x1d, 0x23, 0xff, 0x41, 0x3a, 0x3f, 0xff, 0x43, 0x3c, 0x40, 0xff, 0x2f, 0x29, 0x2b, 0xff, 0x26, 0x20, 0x21, 0xff, 0x1a, 0x15, 0x16, 0xff, 0x12, 0x0d, 0x0d, 0xff, 0x14, 0x11, 0x10, 0xff, 0x29, 0x23, 0x20, 0xff, 0x2e, 0x25, 0x22, 0xff, 0x2a, 0x21, 0x20, 0xff, 0x2b, 0x22, 0x22, 0xff, 0x23, 0x1a, 0x19, 0xff, 0x32, 0x29, 0x28, 0xff, 0x33, 0x2b, 0x2a, 0xff, 0x43, 0x38, 0x36, 0xff, 0x63, 0x57, 0x55, 0xff, 0x7d, 0x71, 0x6f, 0xff, 0x4d, 0x3e, 0x3c, 0xff, 0x52, 0x44, 0x42, 0xff, 0x5d, 0x4d, 0x4c, 0xff, 0x50, 0x43, 0x41, 0xff, 0x1c, 0x12, 0x0f, 0xff, 0x19, 0x10, 0x0d, 0xff, 0x20, 0x17, 0x14, 0xff, 0x2a, 0x21, 0x1f, 0xff, 0x1c, 0x13, 0x11, 0xff, 0x2c, 0x23, 0x21, 0xff, 0x28, 0x21, 0x1e, 0xff, 0x15, 0x0e, 0x0b, 0xff, 0x22, 0x1b, 0x19, 0xff, 0x31, 0x27, 0x25, 0xff, 0x41, 0x36, 0x34, 0xff, 0x3e, 0x33, 0x30, 0xff, 0x29, 0x1f, 0x1e, 0xff, 0x20, 0x16, 0x17, 0xff, 0x30, 0x24, 0x24, 0xff, 0x37, 0x2b, 0x28, 0xff, 0x34, 0x27, 0x22, 0xff, 0x33, 0x25, 0x20, 0xff, 0x44, 0x36, 0x31, 0xff, 0x41, 0x31, 0x2f, 0xff, 0x47, 0x3a, 0x36, 0xff, 0x4b, 0x3f, 0x3b, 0xff, 0x2b, 0x1f, 0x1d, 0xff, 0x25, 0x1b, 0x18, 0xff, 0x36, 0x2a, 0x28, 0xff, 0x54, 0x46, 0x46, 0xff, 0x67, 0x58, 0x57, 0xff, 0x53, 0x43, 0x3e, 0xff, 0x25, 0x15, 0x0f, 0xff, 0x33, 0x26, 0x23, 0xff, 0x34, 0x2c, 0x29, 0xff, 0x21, 0x15, 0x14, 0xff, 0x37, 0x28, 0x27, 0xff, 0x42, 0x35, 0x34, 0xff, 0x37, 0x2a, 0x29, 0xff, 0x6e, 0x62, 0x61, 0xff, 0x8c, 0x81, 0x81, 0xff, 0xa0, 0x96, 0x97, 0xff, 0xb3, 0xad, 0xb2, 0xff, 0xaa, 0xa6, 0xad, 0xff, 0xba, 0xb1, 0xb6, 0xff, 0xb6, 0xaa, 0xab, 0xff, 0x96, 0x84, 0x7d, 0xff, 0x91, 0x7d, 0x70, 0xff, 0x9b, 0x88, 0x7c, 0xff, 0x9d, 0x8e, 0x84, 0xb1, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xdc, 0xdc, 0x8d, 0xe5, 0xe9, 0xed, 0xff, 0xe0, 0xe6, 0xec, 0xff, 0xf0, 0xf5, 0xfe, 0xff, 0xd1, 0xce, 0xda, 0xff, 0x4e, 0x44, 0x55, 0xff, 0x4a, 0x3f, 0x4b, 0xff, 0x59, 0x4c, 0x57, 0xff, 0x2e, 0x25, 0x2a, 0xff, 0x1b, 0x16, 0x16, 0xff, 0x2a, 0x25, 0x25, 0xff, 0x35, 0x2d, 0x33, 0xff, 0x2d, 0x25, 0x2c, 0xff, 0x1d, 0x18, 0x1a, 0xff, 0x27, 0x22, 0x24, 0xff, 0x22, 0x1e, 0x1f, 0xff, 0x36, 0x31, 0x33, 0xff, 0x3b, 0x36, 0x38, 0xff, 0x2d, 0x28, 0x2a, 0xff, 0x23, 0x1f, 0x21, 0xff, 0x14, 0x0f, 0x10, 0xff, 0x0c, 0x07, 0x08, 0xff, 0x16, 0x11, 0x14, 0xff, 0x19, 0x12, 0x16, 0xff, 0x22, 0x1b, 0x20, 0xff, 0x22, 0x1e, 0x24, 0xff, 0x2f, 0x2b, 0x34, 0xff, 0x23, 0x1f, 0x27, 0xff, 0x24, 0x22, 0x27, 0xff, 0x27, 0x25, 0x2a, 0xff, 0x1f, 0x1a, 0x21, 0xff, 0x28, 0x22, 0x28, 0xff, 0x37, 0x30, 0x34, 0xff, 0x2f, 0x28, 0x2b, 0xff, 0x28, 0x21, 0x23, 0xff, 0x1c, 0x16, 0x17, 0xff, 0x18, 0x13, 0x13, 0xff, 0x1a, 0x15, 0x13, 0xff, 0x1a, 0x15, 0x14, 0xff, 0x29, 0x25, 0x24, 0xff, 0x29, 0x24, 0x24, 0xff, 0x2e, 0x25, 0x26, 0xff, 0x28, 0x1f, 0x1e, 0xff, 0x23, 0x19, 0x15, 0xff, 0x3b, 0x32, 0x2f, 0xff, 0x44, 0x3a, 0x37, 0xff, 0x54, 0x48, 0x46, 0xff, 0x4b, 0x3f, 0x3d, 0xff, 0x41, 0x35, 0x33, 0xff, 0x4e, 0x42, 0x40, 0xff, 0x5a, 0x4d, 0x4b, 0xff, 0x38, 0x2b, 0x29, 0xff, 0x27, 0x1d, 0x1b, 0xff, 0x24, 0x1d, 0x1b, 0xff, 0x21, 0x19, 0x16, 0xff, 0x28, 0x21, 0x1f, 0xff, 0x27, 0x1e, 0x1f, 0xff, 0x2a, 0x21, 0x22, 0xff, 0x32, 0x29, 0x2a, 0xff, 0x1c, 0x15, 0x12, 0xff, 0x1c, 0x15, 0x12, 0xff, 0x2a, 0x23, 0x20, 0xff, 0x33, 0x2b, 0x28, 0xff, 0x39, 0x31, 0x2d, 0xff, 0x38, 0x2f, 0x2c, 0xff, 0x29, 0x21, 0x20, 0xff, 0x17, 0x0f, 0x0f, 0xff, 0x29, 0x1e, 0x1e, 0xff, 0x2f, 0x23, 0x23, 0xff, 0x39, 0x2d, 0x2b, 0xff, 0x28, 0x19, 0x18, 0xff, 0x33, 0x23, 0x22, 0xff, 0x43, 0x33, 0x30, 0xff, 0x43, 0x35, 0x32, 0xff, 0x4f, 0x44, 0x3f, 0xff, 0x43, 0x37, 0x34, 0xff, 0x37, 0x2f, 0x2c, 0xff, 0x45, 0x3a, 0x37, 0xff, 0x4a, 0x38, 0x38, 0xff, 0x5c, 0x49, 0x48, 0xff, 0x5d, 0x4d, 0x47, 0xff, 0x34, 0x23, 0x1d, 0xff, 0x2a, 0x1c, 0x1a, 0xff, 0x3b, 0x32, 0x30, 0xff, 0x26, 0x1b, 0x1c, 0xff, 0x2b, 0x20, 0x20, 0xff, 0x36, 0x2b, 0x2b, 0xff, 0x35, 0x2a, 0x2a, 0xff, 0x46, 0x3a, 0x3a, 0xff, 0x8b, 0x80, 0x81, 0xff, 0xae, 0xa3, 0xa6, 0xff, 0xb1, 0xab, 0xb0, 0xff, 0xaa, 0xa5, 0xaa, 0xff, 0xbb, 0xb0, 0xb3, 0xff, 0xad, 0xa0, 0xa2, 0xff, 0x93, 0x82, 0x7f, 0xff, 0x94, 0x80, 0x75, 0xff, 0x98, 0x85, 0x7a, 0xff, 0x9b, 0x89, 0x80, 0xff, 0xa4, 0x94, 0x94, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xf9, 0xf6, 0x55, 0xf1, 0xf0, 0xf1, 0xfe, 0xed, 0xed, 0xf1, 0xff, 0xec, 0xf0, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xb9, 0xc6, 0xff, 0x39, 0x2e, 0x40, 0xff, 0x57, 0x4a, 0x58, 0xff, 0x51, 0x46, 0x4f, 0xff, 0x1c, 0x15, 0x1a, 0xff, 0x0f, 0x0a, 0x0a, 0xff, 0x13, 0x10, 0x0f, 0xff, 0x21, 0x1c, 0x21, 0xff, 0x20, 0x1b, 0x21, 0xff, 0x15, 0x11, 0x13, 0xff, 0x18, 0x13, 0x15, 0xff, 0x35, 0x30, 0x32, 0xff, 0x35, 0x2f, 0x31, 0xff, 0x29, 0x23, 0x25, 0xff, 0x1e, 0x19, 0x1c, 0xff, 0x17, 0x12, 0x15, 0xff, 0x12, 0x0d, 0x0e, 0xff, 0x15, 0x0f, 0x11, 0xff, 0x18, 0x14, 0x15, 0xff, 0x1d, 0x17, 0x1a, 0xff, 0x24, 0x1b, 0x22, 0xff, 0x30, 0x29, 0x31, 0xff, 0x2d, 0x29, 0x33, 0xff, 0x19, 0x15, 0x22, 0xff, 0x24, 0x21, 0x2a, 0xff, 0x1b, 0x18, 0x20, 0xff, 0x17, 0x13, 0x1c, 0xff, 0x2a, 0x25, 0x2c, 0xff, 0x2f, 0x29, 0x2e, 0xff, 0x2a, 0x24, 0x27, 0xff, 0x1f, 0x1a, 0x1b, 0xff, 0x21, 0x1c, 0x1d, 0xff, 0x21, 0x1d, 0x1c, 0xff, 0x1b, 0x17, 0x15, 0xff, 0x23, 0x1f, 0x1e, 0xff, 0x29, 0x25, 0x24, 0xff, 0x28, 0x21, 0x21, 0xff, 0x30, 0x27, 0x28, 0xff, 0x24, 0x1c, 0x1a, 0xff, 0x33, 0x2a, 0x26, 0xff, 0x48, 0x3f, 0x3c, 0xff, 0x59, 0x50, 0x4d, 0xff, 0x49, 0x3d, 0x3b, 0xff, 0x29, 0x1c, 0x1a, 0xff, 0x28, 0x1d, 0x1b, 0xff, 0x56, 0x4a, 0x49, 0xff, 0x65, 0x58, 0x57, 0xff, 0x27, 0x19, 0x17, 0xff, 0x24, 0x1b, 0x1a, 0xff, 0x28, 0x22, 0x22, 0xff, 0x28, 0x21, 0x20, 0xff, 0x24, 0x1d, 0x1c, 0xff, 0x21, 0x1a, 0x1a, 0xff, 0x1e, 0x17, 0x17, 0xff, 0x17, 0x10, 0x0f, 0xff, 0x1a, 0x13, 0x10, 0xff, 0x2a, 0x23, 0x20, 0xff, 0x28, 0x21, 0x1e, 0xff, 0x2c, 0x24, 0x21, 0xff, 0x2d, 0x23, 0x20, 0xff, 0x33, 0x29, 0x26, 0xff, 0x1e, 0x17, 0x15, 0xff, 0x14, 0x0e, 0x0e, 0xff, 0x2e, 0x25, 0x26, 0xff, 0x2d, 0x22, 0x21, 0xff, 0x33, 0x27, 0x24, 0xff, 0x24, 0x17, 0x15, 0xff, 0x2e, 0x20, 0x1e, 0xff, 0x3b, 0x2b, 0x28, 0xff, 0x41, 0x34, 0x30, 0xff, 0x46, 0x3a, 0x36, 0xff, 0x44, 0x38, 0x35, 0xff, 0x3c, 0x34, 0x30, 0xff, 0x47, 0x3c, 0x3a, 0xff, 0x52, 0x40, 0x40, 0xff, 0x48, 0x35, 0x35, 0xff, 0x5b, 0x4b, 0x45, 0xff, 0x43, 0x34, 0x2c, 0xff, 0x1a, 0x0f, 0x0b, 0xff, 0x2b, 0x25, 0x23, 0xff, 0x29, 0x20, 0x20, 0xff, 0x22, 0x18, 0x18, 0xff, 0x2e, 0x25, 0x25, 0xff, 0x32, 0x29, 0x28, 0xff, 0x35, 0x2b, 0x2d, 0xff, 0x82, 0x78, 0x7a, 0xff, 0xbb, 0xaf, 0xb1, 0xff, 0xb9, 0xad, 0xae, 0xff, 0xb5, 0xab, 0xab, 0xff, 0xb5, 0xaa, 0xab, 0xff, 0xa3, 0x97, 0x98, 0xff, 0x91, 0x82, 0x7f, 0xff, 0xa3, 0x90, 0x89, 0xff, 0xa7, 0x94, 0x8f, 0xff, 0xa5, 0x92, 0x8e, 0xff, 0xb3, 0xa5, 0xa3, 0xfe, 0xcc, 0xc3, 0xc0, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x29, 0xfd, 0xfd, 0xfc, 0xf3, 0xf9, 0xf7, 0xf8, 0xff, 0xef, 0xed, 0xf2, 0xff, 0xf5, 0xf5, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0x8f, 0x9d, 0xff, 0x2b, 0x22, 0x33, 0xff, 0x4c, 0x40, 0x4f, 0xff, 0x42, 0x3a, 0x43, 0xff, 0x19, 0x13, 0x17, 0xff, 0x0b, 0x06, 0x05, 0xff, 0x17, 0x15, 0x13, 0xff, 0x26, 0x23, 0x27, 0xff, 0x18, 0x14, 0x1a, 0xff, 0x13, 0x10, 0x11, 0xff, 0x25, 0x21, 0x21, 0xff, 0x2e, 0x2a, 0x2b, 0xff, 0x2b, 0x27, 0x28, 0xff, 0x1f, 0x1b, 0x1c, 0xff, 0x0d, 0x08, 0x09, 0xff, 0x10, 0x0b, 0x0c, 0xff, 0x12, 0x0e, 0x0f, 0xff, 0x15, 0x11, 0x13, 0xff, 0x18, 0x13, 0x16, 0xff, 0x26, 0x1f, 0x26, 0xff, 0x2c, 0x25, 0x2f, 0xff, 0x37, 0x32, 0x3d, 0xff, 0x25, 0x22, 0x2f, 0xff, 0x1d, 0x1b, 0x29, 0xff, 0x22, 0x21, 0x2c, 0xff, 0x1b, 0x1a, 0x25, 0xff, 0x1a, 0x18, 0x21, 0xff, 0x23, 0x1f, 0x28, 0xff, 0x25, 0x20, 0x25, 0xff, 0x24, 0x1f, 0x21, 0xff, 0x24, 0x1f, 0x20, 0xff, 0x21, 0x1c, 0x1d, 0xff, 0x18, 0x13, 0x13, 0xff, 0x1a, 0x16, 0x15, 0xff, 0x2f, 0x2b, 0x2a, 0xff, 0x22, 0x1d, 0x1c, 0xff, 0x28, 0x21, 0x21, 0xff, 0x2e, 0x25, 0x27, 0xff, 0x2a, 0x21, 0x21, 0xff, 0x46, 0x3d, 0x3a, 0xff, 0x3e, 0x34, 0x32, 0xff, 0x3a, 0x30, 0x2e, 0xff, 0x41, 0x35, 0x32, 0xff, 0x35, 0x29, 0x26, 0xff, 0x3e, 0x32, 0x2f, 0xff, 0x5f, 0x54, 0x52, 0xff, 0x4a, 0x40, 0x3d, 0xff, 0x2c, 0x21, 0x1e, 0xff, 0x24, 0x1d, 0x1b, 0xff, 0x1c, 0x17, 0x17, 0xff, 0x24, 0x1f, 0x1f, 0xff, 0x1f, 0x1a, 0x19, 0xff, 0x15, 0x11, 0x0f, 0xff, 0x18, 0x13, 0x12, 0xff, 0x1c, 0x17, 0x15, 0xff, 0x24, 0x1d, 0x19, 0xff, 0x29, 0x21, 0x1e, 0xff, 0x2b, 0x23, 0x20, 0xff, 0x26, 0x1e, 0x1b, 0xff, 0x24, 0x1a, 0x17, 0xff, 0x2d, 0x23, 0x20, 0xff, 0x1f, 0x18, 0x16, 0xff, 0x1e, 0x19, 0x19, 0xff, 0x22, 0x1a, 0x1b, 0xff, 0x26, 0x1d, 0x1c, 0xff, 0x30, 0x25, 0x22, 0xff, 0x25, 0x19, 0x17, 0xff, 0x34, 0x27, 0x25, 0xff, 0x33, 0x24, 0x21, 0xff, 0x44, 0x37, 0x34, 0xff, 0x43, 0x37, 0x33, 0xff, 0x36, 0x2a, 0x27, 0xff, 0x3a, 0x31, 0x2f, 0xff, 0x41, 0x35, 0x33, 0xff, 0x5d, 0x4c, 0x4d, 0xff, 0x54, 0x42, 0x41, 0xff, 0x57, 0x46, 0x41, 0xff, 0x40, 0x2f, 0x2a, 0xff, 0x1a, 0x0f, 0x0c, 0xff, 0x21, 0x1b, 0x19, 0xff, 0x28, 0x21, 0x21, 0xff, 0x22, 0x1a, 0x1a, 0xff, 0x2d, 0x24, 0x24, 0xff, 0x28, 0x20, 0x20, 0xff, 0x35, 0x2d, 0x2f, 0xff, 0x73, 0x69, 0x6c, 0xff, 0xb5, 0xa8, 0xaa, 0xff, 0xb6, 0xa9, 0xa6, 0xff, 0xb6, 0xa8, 0xa5, 0xff, 0xb1, 0xa4, 0xa5, 0xff, 0xa2, 0x95, 0x97, 0xff, 0x9a, 0x8b, 0x8a, 0xff, 0xb6, 0xa2, 0x9f, 0xff, 0xb7, 0xa2, 0xa2, 0xff, 0xba, 0xa6, 0xa5, 0xff, 0xc5, 0xb7, 0xb2, 0xff, 0xd5, 0xcc, 0xc4, 0xf4, 0xe0, 0xda, 0xd4, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x07, 0xfc, 0xfc, 0xfc, 0xd1, 0xfc, 0xfd, 0xfc, 0xff, 0xf6, 0xf4, 0xf7, 0xff, 0xed, 0xe7, 0xf0, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xdd, 0xd6, 0xe3, 0xff, 0x7a, 0x75, 0x7e, 0xff, 0x34, 0x2f, 0x38, 0xff, 0x30, 0x2b, 0x35, 0xff, 0x2c, 0x29, 0x32, 0xff, 0x17, 0x13, 0x17, 0xff, 0x0c, 0x06, 0x06, 0xff, 0x1f, 0x1c, 0x19, 0xff, 0x26, 0x20, 0x24, 0xff, 0x1d, 0x16, 0x1b, 0xff, 0x1c, 0x18, 0x18, 0xff, 0x2f, 0x2d, 0x2e, 0xff, 0x20, 0x1f, 0x22, 0xff, 0x17, 0x18, 0x19, 0xff, 0x12, 0x12, 0x11, 0xff, 0x0e, 0x09, 0x07, 0xff, 0x12, 0x0c, 0x09, 0xff, 0x17, 0x14, 0x13, 0xff, 0x12, 0x0d, 0x12, 0xff, 0x1a, 0x13, 0x1e, 0xff, 0x28, 0x21, 0x2f, 0xff, 0x2b, 0x2b, 0x3a, 0xff, 0x30, 0x33, 0x43, 0xff, 0x29, 0x2a, 0x39, 0xff, 0x20, 0x20, 0x2f, 0xff, 0x27, 0x29, 0x3a, 0xff, 0x1b, 0x1e, 0x2f, 0xff, 0x21, 0x22, 0x2f, 0xff, 0x26, 0x23, 0x2b, 0xff, 0x1d, 0x17, 0x1a, 0xff, 0x2b, 0x26, 0x26, 0xff, 0x2b, 0x25, 0x26, 0xff, 0x1e, 0x18, 0x18, 0xff, 0x15, 0x0e, 0x0f, 0xff, 0x21, 0x1b, 0x1b, 0xff, 0x2d, 0x29, 0x26, 0xff, 0x23, 0x1d, 0x1c, 0xff, 0x25, 0x1e, 0x20, 0xff, 0x2d, 0x23, 0x27, 0xff, 0x37, 0x2d, 0x31, 0xff, 0x4d, 0x44, 0x45, 0xff, 0x2f, 0x24, 0x25, 0xff, 0x3c, 0x30, 0x2f, 0xff, 0x43, 0x35, 0x33, 0xff, 0x36, 0x2a, 0x26, 0xff, 0x6a, 0x5f, 0x5b, 0xff, 0x5d, 0x55, 0x52, 0xff, 0x2a, 0x24, 0x21, 0xff, 0x25, 0x21, 0x1d, 0xff, 0x19, 0x15, 0x13, 0xff, 0x1d, 0x18, 0x17, 0xff, 0x17, 0x12, 0x12, 0xff, 0x17, 0x12, 0x11, 0xff, 0x1b, 0x16, 0x15, 0xff, 0x1d, 0x18, 0x17, 0xff, 0x21, 0x1c, 0x1a, 0xff, 0x25, 0x1d, 0x19, 0xff, 0x22, 0x1a, 0x16, 0xff, 0x2a, 0x22, 0x1d, 0xff, 0x1e, 0x17, 0x14, 0xff, 0x20, 0x19, 0x16, 0xff, 0x20, 0x19, 0x16, 0xff, 0x1a, 0x14, 0x13, 0xff, 0x1d, 0x17, 0x18, 0xff, 0x19, 0x12, 0x10, 0xff, 0x21, 0x19, 0x15, 0xff, 0x2e, 0x25, 0x22, 0xff, 0x2a, 0x1f, 0x1d, 0xff, 0x38, 0x2b, 0x29, 0xff, 0x2e, 0x23, 0x20, 0xff, 0x3a, 0x2d, 0x2c, 0xff, 0x3b, 0x2f, 0x2f, 0xff, 0x33, 0x27, 0x27, 0xff, 0x45, 0x38, 0x38, 0xff, 0x47, 0x3b, 0x3b, 0xff, 0x4e, 0x40, 0x41, 0xff, 0x4c, 0x3d, 0x3e, 0xff, 0x4d, 0x3d, 0x3e, 0xff, 0x3f, 0x2f, 0x30, 0xff, 0x1f, 0x11, 0x12, 0xff, 0x1c, 0x11, 0x11, 0xff, 0x27, 0x1e, 0x1e, 0xff, 0x27, 0x20, 0x20, 0xff, 0x29, 0x21, 0x22, 0xff, 0x22, 0x19, 0x1b, 0xff, 0x3d, 0x33, 0x36, 0xff, 0x5d, 0x51, 0x58, 0xff, 0x9e, 0x93, 0x98, 0xff, 0xb0, 0xa5, 0xa5, 0xff, 0xa7, 0x9b, 0x9b, 0xff, 0xa7, 0x99, 0x9a, 0xff, 0x9c, 0x8c, 0x8d, 0xff, 0xa8, 0x95, 0x97, 0xff, 0xb8, 0xa3, 0xa5, 0xff, 0xb6, 0xa0, 0xa2, 0xff, 0xba, 0xaa, 0xa8, 0xff, 0xd1, 0xc4, 0xbd, 0xff, 0xe4, 0xda, 0xd0, 0xff, 0xec, 0xe6, 0xdb, 0xd1, 0xda, 0xda, 0xda, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x8e, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xf7, 0xf5, 0xf8, 0xff, 0xe5, 0xe1, 0xe8, 0xff, 0xef, 0xe8, 0xf3, 0xff, 0xe2, 0xdb, 0xe6, 0xff, 0x9e, 0x99, 0xa1, 0xff, 0x2d, 0x28, 0x30, 0xff, 0x20, 0x1c, 0x24, 0xff, 0x33, 0x30, 0x3b, 0xff, 0x1a, 0x15, 0x1d, 0xff, 0x10, 0x09, 0x0c, 0xff, 0x1d, 0x18, 0x18, 0xff, 0x22, 0x1d, 0x1e, 0xff, 0x1f, 0x1a, 0x1c, 0xff, 0x2a, 0x23, 0x2a, 0xff, 0x30, 0x29, 0x32, 0xff, 0x1e, 0x1a, 0x21, 0xff, 0x1c, 0x1b, 0x1f, 0xff, 0x12, 0x10, 0x10, 0xff, 0x11, 0x0c, 0x0c, 0xff, 0x18, 0x13, 0x10, 0xff, 0x19, 0x15, 0x11, 0xff, 0x13, 0x0d, 0x0e, 0xff, 0x27, 0x1f, 0x26, 0xff, 0x2d, 0x26, 0x31, 0xff, 0x24, 0x25, 0x30, 0xff, 0x2c, 0x2c, 0x38, 0xff, 0x27, 0x25, 0x34, 0xff, 0x27, 0x25, 0x39, 0xff, 0x3b, 0x3a, 0x4e, 0xff, 0x21, 0x21, 0x36, 0xff, 0x23, 0x23, 0x35, 0xff, 0x28, 0x25, 0x35, 0xff, 0x1e, 0x19, 0x24, 0xff, 0x31, 0x2d, 0x2f, 0xff, 0x23, 0x1e, 0x21, 0xff, 0x1f, 0x19, 0x1c, 0xff, 0x18, 0x11, 0x14, 0xff, 0x1e, 0x18, 0x19, 0xff, 0x27, 0x22, 0x21, 0xff, 0x27, 0x22, 0x22, 0xff, 0x23, 0x1e, 0x1e, 0xff, 0x25, 0x1e, 0x20, 0xff, 0x42, 0x3a, 0x3c, 0xff, 0x3b, 0x34, 0x34, 0xff, 0x23, 0x1b, 0x19, 0xff, 0x4b, 0x41, 0x3e, 0xff, 0x38, 0x2b, 0x2a, 0xff, 0x42, 0x36, 0x34, 0xff, 0x62, 0x59, 0x56, 0xff, 0x31, 0x29, 0x26, 0xff, 0x21, 0x1b, 0x17, 0xff, 0x23, 0x1d, 0x1a, 0xff, 0x1b, 0x16, 0x14, 0xff, 0x18, 0x13, 0x12, 0xff, 0x17, 0x12, 0x11, 0xff, 0x1a, 0x15, 0x14, 0xff, 0x21, 0x1c, 0x1b, 0xff, 0x1a, 0x15, 0x14, 0xff, 0x1f, 0x1a, 0x19, 0xff, 0x20, 0x19, 0x16, 0xff, 0x25, 0x1e, 0x1a, 0xff, 0x1f, 0x18, 0x15, 0xff, 0x1e, 0x17, 0x14, 0xff, 0x20, 0x19, 0x16, 0xff, 0x1c, 0x14, 0x11, 0xff, 0x15, 0x0f, 0x0e, 0xff, 0x19, 0x13, 0x13, 0xff, 0x1d, 0x15, 0x13, 0xff, 0x1f, 0x17, 0x13, 0xff, 0x30, 0x27, 0x24, 0xff, 0x2e, 0x23, 0x21, 0xff, 0x32, 0x26, 0x23, 0xff, 0x2a, 0x20, 0x1c, 0xff, 0x2d, 0x22, 0x20, 0xff, 0x33, 0x27, 0x28, 0xff, 0x30, 0x25, 0x25, 0xff, 0x40, 0x35, 0x35, 0xff, 0x4b, 0x3f, 0x40, 0xff, 0x3f, 0x34, 0x34, 0xff, 0x47, 0x3a, 0x3b, 0xff, 0x4c, 0x3d, 0x3e, 0xff, 0x40, 0x30, 0x31, 0xff, 0x25, 0x19, 0x19, 0xff, 0x17, 0x0e, 0x0e, 0xff, 0x24, 0x1d, 0x1d, 0xff, 0x30, 0x28, 0x29, 0xff, 0x26, 0x1e, 0x1f, 0xff, 0x1f, 0x16, 0x19, 0xff, 0x3c, 0x31, 0x35, 0xff, 0x57, 0x4a, 0x52, 0xff, 0x8c, 0x80, 0x85, 0xff, 0xb2, 0xa9, 0xa9, 0xff, 0x9c, 0x93, 0x93, 0xff, 0x9d, 0x91, 0x92, 0xff, 0x96, 0x88, 0x89, 0xff, 0xa2, 0x94, 0x95, 0xff, 0xb5, 0xa5, 0xa7, 0xff, 0xb0, 0x9e, 0xa1, 0xff, 0xba, 0xac, 0xaa, 0xff, 0xdc, 0xd1, 0xcc, 0xff, 0xec, 0xe5, 0xdb, 0xff, 0xf8, 0xf0, 0xe7, 0xff, 0xfb, 0xf2, 0xed, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xfb, 0xfb, 0x40, 0xfc, 0xfc, 0xfc, 0xfe, 0xfd, 0xfd, 0xfd, 0xff, 0xfb, 0xfc, 0xfc, 0xff, 0xfa, 0xf8, 0xfa, 0xff, 0xef, 0xea, 0xef, 0xff, 0xe9, 0xe4, 0xed, 0xff, 0xfb, 0xf5, 0xff, 0xff, 0xa9, 0xa4, 0xad, 0xff, 0x0e, 0x09, 0x12, 0xff, 0x29, 0x24, 0x2e, 0xff, 0x3c, 0x37, 0x46, 0xff, 0x20, 0x19, 0x25, 0xff, 0x14, 0x0c, 0x12, 0xff, 0x21, 0x1b, 0x1e, 0xff, 0x1c, 0x18, 0x16, 0xff, 0x1f, 0x1a, 0x1c, 0xff, 0x30, 0x26, 0x31, 0xff, 0x26, 0x1d, 0x27, 0xff, 0x1d, 0x19, 0x1c, 0xff, 0x19, 0x16, 0x16, 0xff, 0x13, 0x0d, 0x0f, 0xff, 0x1a, 0x14, 0x15, 0xff, 0x17, 0x13, 0x12, 0xff, 0x11, 0x0d, 0x0c, 0xff, 0x1c, 0x18, 0x1a, 0xff, 0x2b, 0x24, 0x2d, 0xff, 0x23, 0x1b, 0x23, 0xff, 0x22, 0x20, 0x26, 0xff, 0x27, 0x21, 0x29, 0xff, 0x1d, 0x16, 0x24, 0xff, 0x20, 0x1e, 0x2e, 0xff, 0x3a, 0x39, 0x4a, 0xff, 0x31, 0x31, 0x43, 0xff, 0x2a, 0x2a, 0x3a, 0xff, 0x25, 0x25, 0x35, 0xff, 0x20, 0x1e, 0x2d, 0xff, 0x24, 0x21, 0x27, 0xff, 0x24, 0x20, 0x25, 0xff, 0x1d, 0x16, 0x1d, 0xff, 0x16, 0x0f, 0x13, 0xff, 0x25, 0x1e, 0x21, 0xff, 0x31, 0x2b, 0x2d, 0xff, 0x22, 0x1e, 0x1c, 0xff, 0x1f, 0x1b, 0x19, 0xff, 0x21, 0x1b, 0x1c, 0xff, 0x40, 0x3a, 0x3a, 0xff, 0x20, 0x1c, 0x1a, 0xff, 0x2e, 0x28, 0x24, 0xff, 0x37, 0x2f, 0x2b, 0xff, 0x36, 0x2a, 0x2a, 0xff, 0x52, 0x49, 0x48, 0xff, 0x47, 0x3f, 0x3f, 0xff, 0x23, 0x1b, 0x18, 0xff, 0x21, 0x19, 0x16, 0xff, 0x24, 0x1e, 0x1b, 0xff, 0x19, 0x15, 0x13, 0xff, 0x1b, 0x16, 0x16, 0xff, 0x1f, 0x1a, 0x19, 0xff, 0x25, 0x20, 0x1f, 0xff, 0x1c, 0x17, 0x16, 0xff, 0x23, 0x1e, 0x1d, 0xff, 0x22, 0x1d, 0x1c, 0xff, 0x1b, 0x16, 0x15, 0xff, 0x24, 0x1f, 0x1e, 0xff, 0x1a, 0x16, 0x15, 0xff, 0x1b, 0x15, 0x12, 0xff, 0x22, 0x1b, 0x18, 0xff, 0x1c, 0x14, 0x11, 0xff, 0x12, 0x0c, 0x0b, 0xff, 0x18, 0x12, 0x12, 0xff, 0x18, 0x10, 0x0f, 0xff, 0x20, 0x17, 0x14, 0xff, 0x31, 0x28, 0x25, 0xff, 0x2d, 0x21, 0x1f, 0xff, 0x2e, 0x22, 0x20, 0xff, 0x30, 0x27, 0x23, 0xff, 0x2c, 0x24, 0x21, 0xff, 0x1e, 0x15, 0x15, 0xff, 0x27, 0x1d, 0x1d, 0xff, 0x34, 0x29, 0x29, 0xff, 0x39, 0x30, 0x30, 0xff, 0x36, 0x2c, 0x2c, 0xff, 0x37, 0x2b, 0x2b, 0xff, 0x46, 0x38, 0x39, 0xff, 0x3d, 0x2f, 0x30, 0xff, 0x24, 0x19, 0x19, 0xff, 0x19, 0x11, 0x11, 0xff, 0x1a, 0x15, 0x14, 0xff, 0x2c, 0x24, 0x25, 0xff, 0x29, 0x21, 0x22, 0xff, 0x25, 0x1c, 0x1e, 0xff, 0x33, 0x28, 0x2c, 0xff, 0x56, 0x4a, 0x50, 0xff, 0x91, 0x85, 0x8a, 0xff, 0xcc, 0xc5, 0xc5, 0xff, 0xc0, 0xba, 0xbb, 0xff, 0xba, 0xb1, 0xb2, 0xff, 0xbb, 0xb2, 0xb3, 0xff, 0xc4, 0xbb, 0xbc, 0xff, 0xd2, 0xc6, 0xc8, 0xff, 0xcc, 0xbe, 0xc0, 0xff, 0xd1, 0xc5, 0xc5, 0xff, 0xe7, 0xde, 0xda, 0xff, 0xed, 0xe7, 0xdf, 0xff, 0xfa, 0xf3, 0xea, 0xff, 0xff, 0xf7, 0xf0, 0xfe, 0xf7, 0xf3, 0xeb, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x09, 0xfc, 0xfc, 0xfc, 0xdb, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfc, 0xfa, 0xfc, 0xff, 0xf9, 0xf4, 0xfa, 0xff, 0xf0, 0xeb, 0xf3, 0xff, 0xfc, 0xf5, 0xff, 0xff, 0xa6, 0xa1, 0xaa, 0xff, 0x35, 0x31, 0x39, 0xff, 0x59, 0x55, 0x62, 0xff, 0x30, 0x2c, 0x40, 0xff, 0x25, 0x21, 0x2d, 0xff, 0x17, 0x11, 0x17, 0xff, 0x24, 0x1e, 0x21, 0xff, 0x1d, 0x18, 0x18, 0xff, 0x21, 0x20, 0x1f, 0xff, 0x2d, 0x28, 0x2d, 0xff, 0x2a, 0x22, 0x28, 0xff, 0x1d, 0x18, 0x18, 0xff, 0x15, 0x12, 0x0f, 0xff, 0x19, 0x17, 0x14, 0xff, 0x16, 0x15, 0x14, 0xff, 0x0f, 0x0e, 0x13, 0xff, 0x10, 0x0e, 0x17, 0xff, 0x1d, 0x1a, 0x26, 0xff, 0x24, 0x20, 0x30, 0xff, 0x1f, 0x1c, 0x2b, 0xff, 0x21, 0x1c, 0x29, 0xff, 0x1b, 0x16, 0x20, 0xff, 0x15, 0x12, 0x1d, 0xff, 0x1b, 0x1a, 0x25, 0xff, 0x29, 0x28, 0x34, 0xff, 0x2d, 0x2c, 0x37, 0xff, 0x27, 0x29, 0x36, 0xff, 0x2b, 0x2f, 0x40, 0xff, 0x21, 0x22, 0x2f, 0xff, 0x1e, 0x1d, 0x27, 0xff, 0x1f, 0x1d, 0x26, 0xff, 0x14, 0x0f, 0x15, 0xff, 0x1c, 0x17, 0x1c, 0xff, 0x34, 0x2c, 0x30, 0xff, 0x37, 0x2e, 0x30, 0xff, 0x18, 0x16, 0x14, 0xff, 0x16, 0x15, 0x12, 0xff, 0x22, 0x1d, 0x1e, 0xff, 0x2a, 0x25, 0x25, 0xff, 0x1c, 0x17, 0x17, 0xff, 0x2a, 0x25, 0x23, 0xff, 0x3b, 0x36, 0x33, 0xff, 0x31, 0x2b, 0x2a, 0xff, 0x1e, 0x19, 0x18, 0xff, 0x32, 0x2c, 0x2b, 0xff, 0x24, 0x1e, 0x1d, 0xff, 0x23, 0x1e, 0x1d, 0xff, 0x24, 0x20, 0x1e, 0xff, 0x1c, 0x17, 0x15, 0xff, 0x1e, 0x19, 0x18, 0xff, 0x28, 0x23, 0x22, 0xff, 0x22, 0x1d, 0x1c, 0xff, 0x1d, 0x18, 0x17, 0xff, 0x2b, 0x26, 0x25, 0xff, 0x1e, 0x19, 0x18, 0xff, 0x1d, 0x18, 0x17, 0xff, 0x1c, 0x17, 0x16, 0xff, 0x19, 0x14, 0x13, 0xff, 0x1c, 0x16, 0x15, 0xff, 0x1a, 0x14, 0x13, 0xff, 0x17, 0x11, 0x0f, 0xff, 0x14, 0x0f, 0x0e, 0xff, 0x17, 0x10, 0x11, 0xff, 0x17, 0x0f, 0x0e, 0xff, 0x28, 0x20, 0x1d, 0xff, 0x31, 0x28, 0x25, 0xff, 0x2e, 0x22, 0x20, 0xff, 0x32, 0x2a, 0x27, 0xff, 0x30, 0x29, 0x25, 0xff, 0x1e, 0x16, 0x14, 0xff, 0x17, 0x0e, 0x0e, 0xff, 0x27, 0x1e, 0x1f, 0xff, 0x2a, 0x21, 0x21, 0xff, 0x1e, 0x15, 0x15, 0xff, 0x32, 0x29, 0x2a, 0xff, 0x32, 0x28, 0x28, 0xff, 0x39, 0x2d, 0x2d, 0xff, 0x34, 0x28, 0x28, 0xff, 0x20, 0x16, 0x16, 0xff, 0x19, 0x12, 0x12, 0xff, 0x14, 0x0f, 0x0e, 0xff, 0x25, 0x1e, 0x1e, 0xff, 0x2a, 0x24, 0x25, 0xff, 0x26, 0x20, 0x22, 0xff, 0x2c, 0x22, 0x25, 0xff, 0x4b, 0x41, 0x46, 0xff, 0x8a, 0x7f, 0x86, 0xff, 0xda, 0xd2, 0xd9, 0xff, 0xec, 0xe7, 0xeb, 0xff, 0xe3, 0xdf, 0xe0, 0xff, 0xdd, 0xd7, 0xd9, 0xff, 0xe6, 0xdf, 0xe1, 0xff, 0xe9, 0xe3, 0xe2, 0xff, 0xe4, 0xdc, 0xdf, 0xff, 0xe4, 0xdc, 0xde, 0xff, 0xeb, 0xe5, 0xe4, 0xff, 0xf5, 0xef, 0xeb, 0xff, 0xfb, 0xf5, 0xf0, 0xff, 0xfd, 0xf7, 0xf4, 0xff, 0xfb, 0xf6, 0xf4, 0xdb, 0xff, 0xe2, 0xe2, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xfb, 0xfb, 0x88, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xf6, 0xf1, 0xf9, 0xff, 0xfd, 0xf7, 0xff, 0xff, 0xc2, 0xbe, 0xc5, 0xff, 0x5d, 0x5a, 0x60, 0xff, 0x63, 0x60, 0x6d, 0xff, 0x22, 0x1f, 0x32, 0xff, 0x27, 0x24, 0x31, 0xff, 0x28, 0x23, 0x2a, 0xff, 0x29, 0x23, 0x27, 0xff, 0x1a, 0x15, 0x1a, 0xff, 0x28, 0x26, 0x2b, 0xff, 0x32, 0x2f, 0x35, 0xff, 0x22, 0x1d, 0x23, 0xff, 0x17, 0x12, 0x15, 0xff, 0x1b, 0x18, 0x19, 0xff, 0x14, 0x15, 0x16, 0xff, 0x12, 0x15, 0x1b, 0xff, 0x23, 0x26, 0x39, 0xff, 0x2e, 0x32, 0x50, 0xff, 0x3b, 0x40, 0x5e, 0xff, 0x42, 0x47, 0x66, 0xff, 0x3b, 0x3f, 0x5b, 0xff, 0x30, 0x2e, 0x47, 0xff, 0x20, 0x1e, 0x33, 0xff, 0x18, 0x1a, 0x2c, 0xff, 0x14, 0x16, 0x28, 0xff, 0x17, 0x18, 0x28, 0xff, 0x1d, 0x1f, 0x2b, 0xff, 0x20, 0x24, 0x33, 0xff, 0x2c, 0x31, 0x44, 0xff, 0x27, 0x29, 0x37, 0xff, 0x1c, 0x1c, 0x2a, 0xff, 0x1f, 0x1e, 0x29, 0xff, 0x26, 0x22, 0x2a, 0xff, 0x27, 0x23, 0x29, 0xff, 0x35, 0x2e, 0x33, 0xff, 0x2c, 0x24, 0x27, 0xff, 0x18, 0x16, 0x16, 0xff, 0x16, 0x16, 0x16, 0xff, 0x28, 0x24, 0x26, 0xff, 0x22, 0x1c, 0x20, 0xff, 0x19, 0x14, 0x15, 0xff, 0x1a, 0x16, 0x16, 0xff, 0x3d, 0x39, 0x38, 0xff, 0x1f, 0x1b, 0x1a, 0xff, 0x0e, 0x0a, 0x0a, 0xff, 0x1f, 0x1a, 0x1a, 0xff, 0x1f, 0x1a, 0x1a, 0xff, 0x27, 0x22, 0x21, 0xff, 0x1c, 0x17, 0x16, 0xff, 0x1c, 0x17, 0x16, 0xff, 0x2a, 0x25, 0x24, 0xff, 0x2e, 0x29, 0x28, 0xff, 0x1a, 0x15, 0x14, 0xff, 0x27, 0x22, 0x21, 0xff, 0x22, 0x1d, 0x1c, 0xff, 0x1b, 0x15, 0x14, 0xff, 0x1a, 0x15, 0x14, 0xff, 0x1f, 0x1a, 0x19, 0xff, 0x1b, 0x16, 0x15, 0xff, 0x1f, 0x1a, 0x1a, 0xff, 0x14, 0x0f, 0x0e, 0xff, 0x14, 0x0f, 0x0e, 0xff, 0x19, 0x14, 0x14, 0xff, 0x18, 0x12, 0x12, 0xff, 0x18, 0x10, 0x0e, 0xff, 0x2a, 0x23, 0x1f, 0xff, 0x30, 0x27, 0x24, 0xff, 0x26, 0x1a, 0x18, 0xff, 0x2d, 0x26, 0x22, 0xff, 0x28, 0x24, 0x1f, 0xff, 0x18, 0x12, 0x10, 0xff, 0x18, 0x12, 0x11, 0xff, 0x2b, 0x25, 0x24, 0xff, 0x27, 0x21, 0x21, 0xff, 0x1b, 0x15, 0x14, 0xff, 0x30, 0x29, 0x29, 0xff, 0x2b, 0x23, 0x23, 0xff, 0x2a, 0x20, 0x20, 0xff, 0x2c, 0x21, 0x21, 0xff, 0x1e, 0x17, 0x17, 0xff, 0x19, 0x14, 0x13, 0xff, 0x1a, 0x16, 0x14, 0xff, 0x22, 0x1c, 0x1c, 0xff, 0x2c, 0x26, 0x27, 0xff, 0x28, 0x22, 0x24, 0xff, 0x33, 0x2b, 0x2d, 0xff, 0x45, 0x3c, 0x40, 0xff, 0x90, 0x86, 0x8e, 0xff, 0xe7, 0xdd, 0xe6, 0xff, 0xf1, 0xeb, 0xf2, 0xff, 0xf3, 0xee, 0xf2, 0xff, 0xf3, 0xee, 0xf2, 0xff, 0xf1, 0xeb, 0xec, 0xff, 0xf4, 0xf0, 0xee, 0xff, 0xf3, 0xed, 0xf1, 0xff, 0xf1, 0xeb, 0xef, 0xff, 0xf4, 0xef, 0xef, 0xff, 0xfa, 0xf6, 0xf3, 0xff, 0xfd, 0xfa, 0xf7, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfa, 0xfc, 0xff, 0xfb, 0xf7, 0xf5, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x26, 0xfb, 0xfb, 0xfb, 0xfa, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xfc, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xd3, 0xd8, 0xff, 0x9a, 0x98, 0x9d, 0xff, 0x5d, 0x5b, 0x66, 0xff, 0x14, 0x13, 0x21, 0xff, 0x30, 0x2d, 0x38, 0xff, 0x33, 0x2c, 0x35, 0xff, 0x25, 0x1f, 0x27, 0xff, 0x15, 0x11, 0x19, 0xff, 0x2e, 0x2b, 0x35, 0xff, 0x37, 0x33, 0x3e, 0xff, 0x1b, 0x15, 0x22, 0xff, 0x29, 0x24, 0x30, 0xff, 0x1c, 0x17, 0x26, 0xff, 0x10, 0x0d, 0x20, 0xff, 0x34, 0x35, 0x4d, 0xff, 0x3d, 0x42, 0x69, 0xff, 0x3d, 0x47, 0x7a, 0xff, 0x58, 0x64, 0x93, 0xff, 0x5f, 0x6d, 0x99, 0xff, 0x53, 0x61, 0x89, 0xff, 0x4a, 0x50, 0x75, 0xff, 0x4d, 0x50, 0x72, 0xff, 0x4a, 0x4e, 0x71, 0xff, 0x26, 0x28, 0x4a, 0xff, 0x25, 0x26, 0x40, 0xff, 0x2c, 0x29, 0x40, 0xff, 0x1c, 0x1c, 0x35, 0xff, 0x22, 0x24, 0x41, 0xff, 0x22, 0x21, 0x39, 0xff, 0x1e, 0x1f, 0x2d, 0xff, 0x21, 0x20, 0x2d, 0xff, 0x24, 0x21, 0x2d, 0xff, 0x24, 0x22, 0x29, 0xff, 0x24, 0x1d, 0x23, 0xff, 0x1b, 0x13, 0x17, 0xff, 0x15, 0x14, 0x15, 0xff, 0x20, 0x21, 0x22, 0xff, 0x2d, 0x29, 0x2f, 0xff, 0x1e, 0x18, 0x20, 0xff, 0x16, 0x12, 0x15, 0xff, 0x18, 0x16, 0x17, 0xff, 0x2a, 0x26, 0x27, 0xff, 0x1e, 0x18, 0x1a, 0xff, 0x1f, 0x1a, 0x1b, 0xff, 0x1c, 0x18, 0x19, 0xff, 0x1c, 0x18, 0x16, 0xff, 0x23, 0x1e, 0x1c, 0xff, 0x1e, 0x19, 0x18, 0xff, 0x25, 0x20, 0x1f, 0xff, 0x25, 0x20, 0x20, 0xff, 0x1d, 0x18, 0x17, 0xff, 0x24, 0x1e, 0x1d, 0xff, 0x20, 0x19, 0x1a, 0xff, 0x1a, 0x14, 0x14, 0xff, 0x1a, 0x15, 0x13, 0xff, 0x1b, 0x17, 0x16, 0xff, 0x20, 0x1c, 0x1b, 0xff, 0x1c, 0x17, 0x16, 0xff, 0x1d, 0x19, 0x19, 0xff, 0x16, 0x12, 0x12, 0xff, 0x14, 0x11, 0x10, 0xff, 0x17, 0x12, 0x12, 0xff, 0x1a, 0x13, 0x13, 0xff, 0x16, 0x0d, 0x0c, 0xff, 0x32, 0x2a, 0x26, 0xff, 0x37, 0x2c, 0x29, 0xff, 0x22, 0x15, 0x12, 0xff, 0x2f, 0x28, 0x24, 0xff, 0x22, 0x20, 0x1a, 0xff, 0x16, 0x13, 0x0f, 0xff, 0x1b, 0x18, 0x16, 0xff, 0x30, 0x2c, 0x2b, 0xff, 0x27, 0x23, 0x22, 0xff, 0x16, 0x13, 0x11, 0xff, 0x2d, 0x29, 0x28, 0xff, 0x29, 0x22, 0x22, 0xff, 0x27, 0x1d, 0x1e, 0xff, 0x27, 0x1e, 0x1e, 0xff, 0x1c, 0x17, 0x16, 0xff, 0x17, 0x13, 0x12, 0xff, 0x18, 0x14, 0x13, 0xff, 0x1e, 0x19, 0x18, 0xff, 0x2a, 0x25, 0x25, 0xff, 0x28, 0x21, 0x24, 0xff, 0x3b, 0x31, 0x34, 0xff, 0x3f, 0x35, 0x3a, 0xff, 0x7f, 0x74, 0x7a, 0xff, 0xef, 0xe5, 0xef, 0xff, 0xf8, 0xf0, 0xf9, 0xff, 0xf9, 0xf1, 0xf8, 0xff, 0xfc, 0xf5, 0xfb, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfd, 0xf9, 0xf7, 0xff, 0xfc, 0xf6, 0xfb, 0xff, 0xf9, 0xf6, 0xfc, 0xff, 0xf6, 0xf4, 0xf6, 0xff, 0xfa, 0xfa, 0xf8, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xfd, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfd, 0xff, 0xfd, 0xfc, 0xfd, 0xfa, 0xff, 0xf8, 0xf8, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfd, 0xb3, 0xfc, 0xfc, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfe, 0xfc, 0xfd, 0xff, 0xfe, 0xfc, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfb, 0xfd, 0xff, 0xfe, 0xfb, 0xfc, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xd5, 0xd9, 0xff, 0xc6, 0xc1, 0xc4, 0xff, 0x8d, 0x89, 0x8e, 0xff, 0x1d, 0x19, 0x28, 0xff, 0x32, 0x2a, 0x3c, 0xff, 0x38, 0x31, 0x3b, 0xff, 0x20, 0x1e, 0x1e, 0xff, 0x1b, 0x19, 0x23, 0xff, 0x3e, 0x38, 0x54, 0xff, 0x2e, 0x2e, 0x4a, 0xff, 0x35, 0x38, 0x51, 0xff, 0x45, 0x45, 0x61, 0xff, 0x0c, 0x09, 0x28, 0xff, 0x3b, 0x3c, 0x5f, 0xff, 0x49, 0x51, 0x7a, 0xff, 0x3f, 0x4a, 0x7e, 0xff, 0x4f, 0x60, 0x94, 0xff, 0x6c, 0x7b, 0xac, 0xff, 0x6f, 0x7b, 0xab, 0xff, 0x57, 0x63, 0x90, 0xff, 0x62, 0x66, 0x8f, 0xff, 0x71, 0x73, 0x99, 0xff, 0x69, 0x6f, 0x98, 0xff, 0x4d, 0x54, 0x7e, 0xff, 0x49, 0x4d, 0x73, 0xff, 0x59, 0x5c, 0x81, 0xff, 0x3c, 0x40, 0x65, 0xff, 0x2b, 0x30, 0x57, 0xff, 0x2c, 0x2e, 0x53, 0xff, 0x1b, 0x1b, 0x33, 0xff, 0x1f, 0x1e, 0x2f, 0xff, 0x21, 0x21, 0x2a, 0xff, 0x1f, 0x1e, 0x23, 0xff, 0x1e, 0x1c, 0x21, 0xff, 0x1c, 0x1a, 0x21, 0xff, 0x15, 0x15, 0x1b, 0xff, 0x20, 0x1e, 0x28, 0xff, 0x2e, 0x2d, 0x37, 0xff, 0x1a, 0x1b, 0x1e, 0xff, 0x17, 0x14, 0x16, 0xff, 0x1d, 0x19, 0x1b, 0xff, 0x24, 0x23, 0x23, 0xff, 0x17, 0x14, 0x14, 0xff, 0x19, 0x15, 0x15, 0xff, 0x1a, 0x14, 0x15, 0xff, 0x1c, 0x15, 0x16, 0xff, 0x1b, 0x17, 0x16, 0xff, 0x2e, 0x29, 0x28, 0xff, 0x36, 0x31, 0x2f, 0xff, 0x19, 0x14, 0x12, 0xff, 0x1b, 0x1a, 0x17, 0xff, 0x1a, 0x1b, 0x18, 0xff, 0x13, 0x11, 0x0e, 0xff, 0x1c, 0x19, 0x15, 0xff, 0x1c, 0x18, 0x18, 0xff, 0x1f, 0x1b, 0x1e, 0xff, 0x1e, 0x1b, 0x1a, 0xff, 0x1c, 0x19, 0x16, 0xff, 0x1f, 0x1d, 0x16, 0xff, 0x17, 0x14, 0x0e, 0xff, 0x18, 0x15, 0x10, 0xff, 0x1a, 0x17, 0x15, 0xff, 0x17, 0x12, 0x12, 0xff, 0x0f, 0x0a, 0x09, 0xff, 0x28, 0x22, 0x20, 0xff, 0x21, 0x1a, 0x19, 0xff, 0x18, 0x10, 0x0f, 0xff, 0x1e, 0x18, 0x16, 0xff, 0x1f, 0x18, 0x16, 0xff, 0x1f, 0x19, 0x17, 0xff, 0x1f, 0x18, 0x18, 0xff, 0x36, 0x30, 0x30, 0xff, 0x33, 0x2d, 0x2d, 0xff, 0x19, 0x13, 0x13, 0xff, 0x25, 0x1f, 0x1e, 0xff, 0x27, 0x22, 0x21, 0xff, 0x26, 0x1f, 0x1f, 0xff, 0x20, 0x1a, 0x1a, 0xff, 0x19, 0x14, 0x13, 0xff, 0x14, 0x10, 0x0e, 0xff, 0x11, 0x0d, 0x0d, 0xff, 0x1c, 0x15, 0x18, 0xff, 0x28, 0x21, 0x23, 0xff, 0x29, 0x23, 0x24, 0xff, 0x41, 0x39, 0x3d, 0xff, 0x39, 0x31, 0x36, 0xff, 0x75, 0x6c, 0x73, 0xff, 0xed, 0xe4, 0xec, 0xff, 0xfa, 0xf1, 0xf9, 0xff, 0xfd, 0xf5, 0xfc, 0xff, 0xfc, 0xf6, 0xfb, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfb, 0xfc, 0xff, 0xfb, 0xfa, 0xfc, 0xff, 0xfb, 0xfa, 0xfb, 0xff, 0xfc, 0xfc, 0xfb, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfd, 0xfc, 0xfc, 0xff, 0xfd, 0xfb, 0xfc, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xf0, 0xf7, 0x44, 0xf8, 0xf7, 0xfb, 0xff, 0xf9, 0xf8, 0xfc, 0xff, 0xfa, 0xf9, 0xfe, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xfd, 0xfa, 0xfc, 0xff, 0xfe, 0xfa, 0xfd, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xfc, 0xfa, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xe0, 0xe2, 0xff, 0xeb, 0xe4, 0xe6, 0xff, 0xc7, 0xc1, 0xc2, 0xff, 0x37, 0x31, 0x3d, 0xff, 0x2c, 0x22, 0x3a, 0xff, 0x36, 0x30, 0x3f, 0xff, 0x17, 0x18, 0x1a, 0xff, 0x35, 0x37, 0x44, 0xff, 0x59, 0x55, 0x7e, 0xff, 0x41, 0x46, 0x6f, 0xff, 0x67, 0x73, 0x93, 0xff, 0x2b, 0x32, 0x56, 0xff, 0x2b, 0x31, 0x56, 0xff, 0x6a, 0x74, 0x9c, 0xff, 0x56, 0x67, 0x93, 0xff, 0x68, 0x78, 0xa7, 0xff, 0x7e, 0x91, 0xbc, 0xff, 0x88, 0x99, 0xc5, 0xff, 0x7c, 0x87, 0xb5, 0xff, 0x6b, 0x75, 0xa3, 0xff, 0x6f, 0x76, 0xa3, 0xff, 0x6c, 0x71, 0x9e, 0xff, 0x69, 0x73, 0x9c, 0xff, 0x5f, 0x6b, 0x92, 0xff, 0x56, 0x5f, 0x88, 0xff, 0x61, 0x6a, 0x94, 0xff, 0x59, 0x63, 0x8a, 0xff, 0x4b, 0x52, 0x7b, 0xff, 0x4b, 0x51, 0x7a, 0xff, 0x33, 0x35, 0x58, 0xff, 0x22, 0x25, 0x3d, 0xff, 0x25, 0x28, 0x36, 0xff, 0x1d, 0x1f, 0x27, 0xff, 0x1c, 0x20, 0x29, 0xff, 0x1c, 0x21, 0x2d, 0xff, 0x15, 0x18, 0x27, 0xff, 0x1d, 0x1a, 0x32, 0xff, 0x32, 0x32, 0x46, 0xff, 0x1a, 0x1f, 0x24, 0xff, 0x14, 0x13, 0x14, 0xff, 0x1b, 0x15, 0x16, 0xff, 0x1c, 0x1b, 0x1b, 0xff, 0x10, 0x0f, 0x0f, 0xff, 0x17, 0x13, 0x14, 0xff, 0x1d, 0x17, 0x18, 0xff, 0x19, 0x12, 0x15, 0xff, 0x1a, 0x18, 0x1a, 0xff, 0x28, 0x26, 0x25, 0xff, 0x2e, 0x28, 0x27, 0xff, 0x1e, 0x19, 0x18, 0xff, 0x18, 0x19, 0x17, 0xff, 0x11, 0x14, 0x12, 0xff, 0x14, 0x14, 0x11, 0xff, 0x1b, 0x18, 0x15, 0xff, 0x1c, 0x17, 0x1b, 0xff, 0x23, 0x20, 0x26, 0xff, 0x21, 0x1e, 0x20, 0xff, 0x1d, 0x19, 0x17, 0xff, 0x1c, 0x19, 0x14, 0xff, 0x17, 0x13, 0x0f, 0xff, 0x21, 0x1c, 0x1b, 0xff, 0x1b, 0x17, 0x16, 0xff, 0x12, 0x0f, 0x0e, 0xff, 0x12, 0x0f, 0x0e, 0xff, 0x18, 0x14, 0x13, 0xff, 0x12, 0x0d, 0x0c, 0xff, 0x15, 0x11, 0x10, 0xff, 0x15, 0x10, 0x0f, 0xff, 0x1b, 0x12, 0x12, 0xff, 0x24, 0x1a, 0x1b, 0xff, 0x1b, 0x11, 0x12, 0xff, 0x34, 0x2b, 0x2b, 0xff, 0x39, 0x30, 0x31, 0xff, 0x1a, 0x11, 0x11, 0xff, 0x21, 0x1b, 0x1a, 0xff, 0x2a, 0x26, 0x25, 0xff, 0x22, 0x1d, 0x1c, 0xff, 0x1e, 0x1a, 0x19, 0xff, 0x1e, 0x19, 0x18, 0xff, 0x15, 0x10, 0x0e, 0xff, 0x0f, 0x09, 0x08, 0xff, 0x15, 0x0e, 0x11, 0xff, 0x29, 0x22, 0x25, 0xff, 0x2e, 0x27, 0x29, 0xff, 0x40, 0x3a, 0x3e, 0xff, 0x23, 0x1c, 0x23, 0xff, 0x6a, 0x63, 0x6a, 0xff, 0xef, 0xe7, 0xee, 0xff, 0xf3, 0xec, 0xf2, 0xff, 0xfe, 0xf8, 0xfd, 0xff, 0xfd, 0xf9, 0xfd, 0xff, 0xfe, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfe, 0xfc, 0xfb, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xfe, 0xfc, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfc, 0xfc, 0xff, 0xfe, 0xfc, 0xfc, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xe9, 0xf2, 0xc8, 0xf8, 0xf4, 0xf9, 0xff, 0xfa, 0xf6, 0xfb, 0xff, 0xfb, 0xf7, 0xfd, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xfd, 0xfa, 0xfc, 0xff, 0xfe, 0xfa, 0xfd, 0xff, 0xfd, 0xfc, 0xfe, 0xff, 0xfc, 0xfc, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfb, 0xfd, 0xff, 0xef, 0xec, 0xeb, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xe9, 0xe7, 0xe5, 0xff, 0x44, 0x41, 0x46, 0xff, 0x17, 0x10, 0x27, 0xff, 0x41, 0x3b, 0x54, 0xff, 0x15, 0x15, 0x27, 0xff, 0x52, 0x58, 0x71, 0xff, 0x6c, 0x75, 0x9c, 0xff, 0x62, 0x70, 0x9a, 0xff, 0x66, 0x73, 0x9d, 0xff, 0x48, 0x52, 0x7b, 0xff, 0x69, 0x73, 0x9a, 0xff, 0x78, 0x86, 0xb0, 0xff, 0x71, 0x7f, 0xad, 0xff, 0x4c, 0x57, 0x7e, 0xff, 0x4b, 0x53, 0x75, 0xff, 0x6d, 0x77, 0x9b, 0xff, 0x79, 0x84, 0xa9, 0xff, 0x7f, 0x8c, 0xb7, 0xff, 0x75, 0x83, 0xb9, 0xff, 0x68, 0x78, 0xab, 0xff, 0x73, 0x81, 0xaa, 0xff, 0x6c, 0x78, 0xa0, 0xff, 0x60, 0x68, 0x92, 0xff, 0x64, 0x6c, 0x96, 0xff, 0x67, 0x72, 0x99, 0xff, 0x59, 0x61, 0x88, 0xff, 0x52, 0x58, 0x81, 0xff, 0x49, 0x4f, 0x7a, 0xff, 0x2b, 0x30, 0x54, 0xff, 0x1f, 0x23, 0x3e, 0xff, 0x2b, 0x2e, 0x46, 0xff, 0x27, 0x2a, 0x43, 0xff, 0x1f, 0x24, 0x3e, 0xff, 0x23, 0x29, 0x48, 0xff, 0x2a, 0x2b, 0x51, 0xff, 0x36, 0x37, 0x57, 0xff, 0x1b, 0x20, 0x30, 0xff, 0x11, 0x12, 0x13, 0xff, 0x1b, 0x17, 0x12, 0xff, 0x17, 0x12, 0x11, 0xff, 0x14, 0x12, 0x11, 0xff, 0x1a, 0x16, 0x16, 0xff, 0x19, 0x13, 0x14, 0xff, 0x16, 0x11, 0x12, 0xff, 0x17, 0x18, 0x18, 0xff, 0x21, 0x1f, 0x22, 0xff, 0x26, 0x20, 0x24, 0xff, 0x23, 0x1f, 0x20, 0xff, 0x1e, 0x1b, 0x1c, 0xff, 0x1a, 0x16, 0x17, 0xff, 0x1b, 0x17, 0x15, 0xff, 0x1d, 0x16, 0x15, 0xff, 0x23, 0x1b, 0x20, 0xff, 0x26, 0x22, 0x28, 0xff, 0x21, 0x1c, 0x20, 0xff, 0x1d, 0x16, 0x1b, 0xff, 0x1a, 0x11, 0x16, 0xff, 0x1f, 0x17, 0x19, 0xff, 0x20, 0x18, 0x1a, 0xff, 0x1c, 0x16, 0x16, 0xff, 0x12, 0x0f, 0x0d, 0xff, 0x19, 0x15, 0x14, 0xff, 0x1c, 0x17, 0x16, 0xff, 0x14, 0x0f, 0x0e, 0xff, 0x16, 0x11, 0x10, 0xff, 0x19, 0x14, 0x13, 0xff, 0x17, 0x11, 0x10, 0xff, 0x19, 0x12, 0x12, 0xff, 0x12, 0x0c, 0x0b, 0xff, 0x25, 0x1d, 0x1d, 0xff, 0x2f, 0x26, 0x26, 0xff, 0x1a, 0x11, 0x11, 0xff, 0x1b, 0x15, 0x14, 0xff, 0x2a, 0x25, 0x24, 0xff, 0x25, 0x20, 0x1f, 0xff, 0x19, 0x14, 0x13, 0xff, 0x1c, 0x17, 0x16, 0xff, 0x18, 0x13, 0x12, 0xff, 0x11, 0x0c, 0x0b, 0xff, 0x10, 0x0c, 0x0a, 0xff, 0x29, 0x23, 0x25, 0xff, 0x38, 0x30, 0x36, 0xff, 0x3f, 0x38, 0x3d, 0xff, 0x1b, 0x14, 0x19, 0xff, 0x67, 0x5f, 0x66, 0xff, 0xed, 0xe5, 0xec, 0xff, 0xf4, 0xed, 0xf3, 0xff, 0xf9, 0xf5, 0xfa, 0xff, 0xfb, 0xf9, 0xfe, 0xff, 0xfe, 0xfa, 0xff, 0xff, 0xfd, 0xfb, 0xfc, 0xff, 0xfd, 0xfb, 0xfb, 0xff, 0xfc, 0xf9, 0xfb, 0xff, 0xfb, 0xf9, 0xfb, 0xff, 0xfc, 0xfa, 0xfc, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xfe, 0xfc, 0xfd, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xfc, 0xf8, 0xfc, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xeb, 0xf8, 0x4d, 0xf5, 0xee, 0xf9, 0xff, 0xf9, 0xf6, 0xf9, 0xff, 0xfb, 0xf7, 0xfb, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xfe, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xfb, 0xfc, 0xfe, 0xff, 0xf9, 0xfd, 0xfe, 0xff, 0xfc, 0xfc, 0xfd, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xf6, 0xf4, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf6, 0xff, 0x80, 0x7f, 0x7e, 0xff, 0x21, 0x1a, 0x2e, 0xff, 0x59, 0x55, 0x73, 0xff, 0x51, 0x53, 0x70, 0xff, 0x6c, 0x75, 0x95, 0xff, 0x7c, 0x8b, 0xb3, 0xff, 0x70, 0x82, 0xb1, 0xff, 0x6a, 0x7a, 0xa9, 0xff, 0x70, 0x81, 0xab, 0xff, 0x7a, 0x88, 0xb0, 0xff, 0x8e, 0x98, 0xc6, 0xff, 0x63, 0x6c, 0x9e, 0xff, 0x0d, 0x10, 0x2f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x27, 0x29, 0x3f, 0xff, 0x65, 0x6c, 0x86, 0xff, 0x6a, 0x73, 0x97, 0xff, 0x75, 0x81, 0xb2, 0xff, 0x7f, 0x8e, 0xbf, 0xff, 0x7d, 0x8c, 0xb7, 0xff, 0x75, 0x82, 0xac, 0xff, 0x6c, 0x77, 0xa2, 0xff, 0x71, 0x7b, 0xa6, 0xff, 0x76, 0x7f, 0xa8, 0xff, 0x66, 0x6f, 0x97, 0xff, 0x65, 0x6d, 0x98, 0xff, 0x65, 0x6c, 0x9c, 0xff, 0x4d, 0x54, 0x80, 0xff, 0x25, 0x2a, 0x52, 0xff, 0x33, 0x36, 0x5d, 0xff, 0x44, 0x48, 0x70, 0xff, 0x1e, 0x24, 0x4c, 0xff, 0x33, 0x3c, 0x65, 0xff, 0x38, 0x3e, 0x6e, 0xff, 0x37, 0x3b, 0x65, 0xff, 0x20, 0x23, 0x3c, 0xff, 0x11, 0x13, 0x18, 0xff, 0x14, 0x10, 0x0c, 0xff, 0x18, 0x12, 0x11, 0xff, 0x16, 0x13, 0x16, 0xff, 0x16, 0x13, 0x13, 0xff, 0x18, 0x12, 0x13, 0xff, 0x16, 0x12, 0x13, 0xff, 0x1b, 0x1c, 0x1f, 0xff, 0x2b, 0x29, 0x31, 0xff, 0x22, 0x1e, 0x25, 0xff, 0x1c, 0x1a, 0x1e, 0xff, 0x1f, 0x1a, 0x1f, 0xff, 0x24, 0x1e, 0x23, 0xff, 0x20, 0x1b, 0x1e, 0xff, 0x1f, 0x19, 0x1b, 0xff, 0x24, 0x1f, 0x23, 0xff, 0x24, 0x23, 0x28, 0xff, 0x1d, 0x19, 0x21, 0xff, 0x1b, 0x15, 0x1c, 0xff, 0x1e, 0x15, 0x17, 0xff, 0x1e, 0x15, 0x13, 0xff, 0x1d, 0x15, 0x13, 0xff, 0x1a, 0x15, 0x14, 0xff, 0x17, 0x14, 0x13, 0xff, 0x15, 0x11, 0x10, 0xff, 0x14, 0x10, 0x0f, 0xff, 0x1a, 0x15, 0x14, 0xff, 0x1b, 0x16, 0x15, 0xff, 0x1b, 0x16, 0x15, 0xff, 0x13, 0x0e, 0x0d, 0xff, 0x13, 0x0f, 0x0e, 0xff, 0x0f, 0x0c, 0x0a, 0xff, 0x1d, 0x17, 0x16, 0xff, 0x23, 0x1c, 0x1c, 0xff, 0x1a, 0x13, 0x12, 0xff, 0x1c, 0x17, 0x16, 0xff, 0x22, 0x1d, 0x1c, 0xff, 0x1d, 0x18, 0x17, 0xff, 0x18, 0x13, 0x12, 0xff, 0x1b, 0x16, 0x15, 0xff, 0x13, 0x0e, 0x0d, 0xff, 0x14, 0x0f, 0x0e, 0xff, 0x13, 0x0e, 0x0c, 0xff, 0x21, 0x1a, 0x1d, 0xff, 0x40, 0x38, 0x3f, 0xff, 0x3d, 0x35, 0x3b, 0xff, 0x0d, 0x06, 0x0c, 0xff, 0x79, 0x71, 0x78, 0xff, 0xee, 0xe7, 0xee, 0xff, 0xed, 0xe9, 0xef, 0xff, 0xf7, 0xf3, 0xf9, 0xff, 0xfc, 0xf9, 0xfe, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xfb, 0xf7, 0xfa, 0xff, 0xfa, 0xf6, 0xf8, 0xff, 0xf9, 0xf5, 0xf8, 0xff, 0xf8, 0xf3, 0xf6, 0xff, 0xf9, 0xf6, 0xf8, 0xff, 0xfc, 0xfa, 0xfc, 0xff, 0xfe, 0xfb, 0xfd, 0xff, 0xfe, 0xfb, 0xfd, 0xff, 0xfd, 0xf8, 0xfb, 0xff, 0xfa, 0xf5, 0xfa, 0xff, 0xf7, 0xf3, 0xf8, 0xff, 0xf5, 0xee, 0xf5, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xf2, 0xff, 0xcd, 0xfd, 0xf5, 0xff, 0xff, 0xfe, 0xfa, 0xfc, 0xff, 0xfd, 0xfa, 0xfb, 0xff, 0xfe, 0xfb, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xfb, 0xfd, 0xfd, 0xff, 0xf9, 0xfd, 0xfe, 0xff, 0xfa, 0xfb, 0xfd, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xfd, 0xf9, 0xfc, 0xff, 0xfd, 0xf9, 0xfc, 0xff, 0xf7, 0xf5, 0xf6, 0xff, 0xf1, 0xf0, 0xef, 0xff, 0xb6, 0xb0, 0xbc, 0xff, 0x70, 0x6b, 0x84, 0xff, 0x84, 0x87, 0xa6, 0xff, 0x8b, 0x92, 0xb5, 0xff, 0x87, 0x92, 0xb9, 0xff, 0x7c, 0x8b, 0xb7, 0xff, 0x72, 0x84, 0xb1, 0xff, 0x71, 0x83, 0xac, 0xff, 0x77, 0x89, 0xb2, 0xff, 0x8a, 0x96, 0xc2, 0xff, 0x58, 0x64, 0x96, 0xff, 0x31, 0x30, 0x4e, 0xff, 0x30, 0x22, 0x28, 0xff, 0x69, 0x65, 0x6b, 0xff, 0xa0, 0xa3, 0xb2, 0xff, 0x5d, 0x63, 0x7b, 0xff, 0x4e, 0x54, 0x78, 0xff, 0x67, 0x6e, 0x9e, 0xff, 0x80, 0x8c, 0xbc, 0xff, 0x80, 0x8e, 0xba, 0xff, 0x76, 0x84, 0xad, 0xff, 0x7a, 0x86, 0xb0, 0xff, 0x7f, 0x89, 0xb4, 0xff, 0x71, 0x7c, 0xa7, 0xff, 0x7a, 0x84, 0xb0, 0xff, 0x7a, 0x85, 0xb0, 0xff, 0x7a, 0x83, 0xaf, 0xff, 0x55, 0x5c, 0x88, 0xff, 0x50, 0x56, 0x82, 0xff, 0x5c, 0x66, 0x91, 0xff, 0x30, 0x3f, 0x68, 0xff, 0x4e, 0x5b, 0x87, 0xff, 0x49, 0x53, 0x87, 0xff, 0x33, 0x39, 0x6b, 0xff, 0x2e, 0x31, 0x51, 0xff, 0x16, 0x18, 0x26, 0xff, 0x12, 0x0e, 0x11, 0xff, 0x19, 0x14, 0x14, 0xff, 0x19, 0x15, 0x1a, 0xff, 0x17, 0x15, 0x15, 0xff, 0x1a, 0x18, 0x18, 0xff, 0x16, 0x12, 0x15, 0xff, 0x1f, 0x1e, 0x28, 0xff, 0x2b, 0x2b, 0x37, 0xff, 0x19, 0x19, 0x21, 0xff, 0x19, 0x19, 0x20, 0xff, 0x1c, 0x17, 0x21, 0xff, 0x25, 0x1f, 0x2b, 0xff, 0x1e, 0x1b, 0x27, 0xff, 0x1a, 0x18, 0x22, 0xff, 0x1e, 0x1e, 0x27, 0xff, 0x22, 0x25, 0x2d, 0xff, 0x1b, 0x1c, 0x26, 0xff, 0x13, 0x11, 0x17, 0xff, 0x1a, 0x14, 0x14, 0xff, 0x1c, 0x17, 0x10, 0xff, 0x19, 0x15, 0x0e, 0xff, 0x1c, 0x18, 0x15, 0xff, 0x19, 0x15, 0x15, 0xff, 0x0e, 0x0a, 0x09, 0xff, 0x13, 0x0f, 0x0e, 0xff, 0x18, 0x14, 0x13, 0xff, 0x17, 0x13, 0x12, 0xff, 0x18, 0x14, 0x13, 0xff, 0x13, 0x0e, 0x0d, 0xff, 0x17, 0x11, 0x10, 0xff, 0x16, 0x11, 0x10, 0xff, 0x18, 0x13, 0x12, 0xff, 0x1d, 0x18, 0x17, 0xff, 0x1a, 0x16, 0x15, 0xff, 0x1d, 0x18, 0x17, 0xff, 0x1e, 0x18, 0x18, 0xff, 0x1a, 0x15, 0x14, 0xff, 0x1a, 0x15, 0x14, 0xff, 0x1c, 0x17, 0x16, 0xff, 0x12, 0x0d, 0x0c, 0xff, 0x10, 0x0b, 0x0a, 0xff, 0x17, 0x12, 0x11, 0xff, 0x1b, 0x14, 0x18, 0xff, 0x3d, 0x35, 0x3d, 0xff, 0x36, 0x2e, 0x36, 0xff, 0x10, 0x08, 0x0f, 0xff, 0x8e, 0x87, 0x8c, 0xff, 0xeb, 0xe6, 0xeb, 0xff, 0xec, 0xe9, 0xee, 0xff, 0xf4, 0xee, 0xf2, 0xff, 0xfa, 0xf3, 0xf6, 0xff, 0xfb, 0xf5, 0xf6, 0xff, 0xfb, 0xf5, 0xf7, 0xff, 0xf4, 0xef, 0xf0, 0xff, 0xf0, 0xea, 0xeb, 0xff, 0xee, 0xe7, 0xe9, 0xff, 0xf2, 0xec, 0xee, 0xff, 0xf5, 0xf1, 0xf2, 0xff, 0xf9, 0xf4, 0xf5, 0xff, 0xf6, 0xef, 0xf2, 0xff, 0xf2, 0xea, 0xea, 0xff, 0xf1, 0xe8, 0xea, 0xff, 0xf0, 0xe9, 0xed, 0xff, 0xed, 0xe7, 0xe9, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0xff, 0x40, 0xfc, 0xf4, 0xfd, 0xff, 0xfc, 0xf6, 0xfb, 0xff, 0xff, 0xfa, 0xfc, 0xff, 0xfd, 0xf8, 0xfa, 0xff, 0xfc, 0xf7, 0xf9, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfc, 0xf5, 0xf8, 0xff, 0xfe, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xda, 0xdc, 0xff, 0x64, 0x61, 0x6a, 0xff, 0x35, 0x36, 0x4a, 0xff, 0x82, 0x83, 0xa6, 0xff, 0xa6, 0xab, 0xd3, 0xff, 0x84, 0x91, 0xb7, 0xff, 0x7b, 0x8b, 0xb4, 0xff, 0x70, 0x81, 0xab, 0xff, 0x71, 0x84, 0xae, 0xff, 0x86, 0x95, 0xc0, 0xff, 0x3d, 0x4b, 0x7f, 0xff, 0x5e, 0x5e, 0x81, 0xff, 0x5c, 0x51, 0x59, 0xff, 0x78, 0x74, 0x7c, 0xff, 0xc2, 0xc3, 0xcf, 0xff, 0x93, 0x99, 0xab, 0xff, 0x66, 0x6d, 0x8d, 0xff, 0x44, 0x4b, 0x78, 0xff, 0x49, 0x55, 0x85, 0xff, 0x6c, 0x7c, 0xaa, 0xff, 0x7a, 0x86, 0xb2, 0xff, 0x7f, 0x8b, 0xb6, 0xff, 0x82, 0x90, 0xba, 0xff, 0x7a, 0x89, 0xb0, 0xff, 0x81, 0x91, 0xb5, 0xff, 0x84, 0x94, 0xb7, 0xff, 0x81, 0x8d, 0xb4, 0xff, 0x81, 0x8a, 0xb3, 0xff, 0x7e, 0x88, 0xb3, 0xff, 0x6f, 0x7c, 0xa9, 0xff, 0x5d, 0x6e, 0x99, 0xff, 0x64, 0x76, 0xa1, 0xff, 0x5f, 0x6d, 0x9e, 0xff, 0x49, 0x51, 0x84, 0xff, 0x38, 0x3c, 0x5f, 0xff, 0x21, 0x23, 0x34, 0xff, 0x15, 0x13, 0x1b, 0xff, 0x16, 0x14, 0x18, 0xff, 0x19, 0x17, 0x1b, 0xff, 0x18, 0x16, 0x15, 0xff, 0x1d, 0x1b, 0x1a, 0xff, 0x17, 0x15, 0x19, 0xff, 0x29, 0x2b, 0x35, 0xff, 0x2d, 0x2e, 0x3b, 0xff, 0x20, 0x1f, 0x27, 0xff, 0x23, 0x22, 0x2a, 0xff, 0x1c, 0x19, 0x24, 0xff, 0x20, 0x1d, 0x2c, 0xff, 0x1e, 0x1d, 0x30, 0xff, 0x1d, 0x20, 0x35, 0xff, 0x18, 0x1f, 0x34, 0xff, 0x22, 0x26, 0x3b, 0xff, 0x1a, 0x19, 0x31, 0xff, 0x05, 0x02, 0x15, 0xff, 0x00, 0x00, 0x05, 0xff, 0x01, 0x00, 0x00, 0xff, 0x11, 0x0f, 0x08, 0xff, 0x23, 0x1f, 0x1b, 0xff, 0x19, 0x15, 0x14, 0xff, 0x0c, 0x09, 0x08, 0xff, 0x11, 0x0d, 0x0c, 0xff, 0x11, 0x0d, 0x0c, 0xff, 0x14, 0x11, 0x10, 0xff, 0x0f, 0x0c, 0x0b, 0xff, 0x0d, 0x09, 0x08, 0xff, 0x15, 0x10, 0x0f, 0xff, 0x16, 0x12, 0x11, 0xff, 0x14, 0x10, 0x0f, 0xff, 0x17, 0x13, 0x12, 0xff, 0x1a, 0x15, 0x14, 0xff, 0x1d, 0x19, 0x18, 0xff, 0x20, 0x1b, 0x1a, 0xff, 0x19, 0x14, 0x13, 0xff, 0x1c, 0x17, 0x16, 0xff, 0x1c, 0x17, 0x16, 0xff, 0x16, 0x11, 0x10, 0xff, 0x12, 0x0d, 0x0b, 0xff, 0x14, 0x0e, 0x0e, 0xff, 0x17, 0x0f, 0x13, 0xff, 0x36, 0x2d, 0x36, 0xff, 0x34, 0x2a, 0x35, 0xff, 0x30, 0x29, 0x2f, 0xff, 0xa1, 0x9b, 0x9d, 0xff, 0xd3, 0xcd, 0xce, 0xff, 0xe9, 0xe2, 0xe4, 0xff, 0xec, 0xe4, 0xe4, 0xff, 0xed, 0xe4, 0xe4, 0xff, 0xea, 0xe1, 0xde, 0xff, 0xed, 0xe4, 0xe2, 0xff, 0xea, 0xe0, 0xde, 0xff, 0xe2, 0xd9, 0xd7, 0xff, 0xdc, 0xd3, 0xd1, 0xff, 0xdd, 0xd4, 0xd1, 0xff, 0xe1, 0xd9, 0xd6, 0xff, 0xe4, 0xdc, 0xd9, 0xff, 0xe0, 0xd6, 0xd4, 0xff, 0xdc, 0xcf, 0xce, 0xff, 0xdf, 0xd3, 0xd3, 0xff, 0xe4, 0xd9, 0xd9, 0xff, 0xe4, 0xda, 0xdb, 0xff, 0xd3, 0xcb, 0xcf, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xf6, 0xfa, 0xb3, 0xfa, 0xf5, 0xf9, 0xff, 0xfb, 0xf7, 0xf7, 0xff, 0xfd, 0xf6, 0xf9, 0xff, 0xf8, 0xf0, 0xf4, 0xff, 0xf3, 0xec, 0xf1, 0xff, 0xf6, 0xf0, 0xf2, 0xff, 0xfb, 0xf5, 0xf6, 0xff, 0xfd, 0xf7, 0xf8, 0xff, 0xfc, 0xf8, 0xfa, 0xff, 0xfc, 0xf8, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfb, 0xff, 0xfb, 0xf4, 0xf8, 0xff, 0xf9, 0xf2, 0xf5, 0xff, 0xf9, 0xf1, 0xf7, 0xff, 0xf3, 0xea, 0xf0, 0xff, 0xdd, 0xd6, 0xd1, 0xff, 0x98, 0x95, 0x94, 0xff, 0x2f, 0x2e, 0x3b, 0xff, 0x95, 0x92, 0xb5, 0xff, 0xab, 0xab, 0xd5, 0xff, 0x8d, 0x94, 0xba, 0xff, 0x80, 0x8e, 0xb4, 0xff, 0x76, 0x86, 0xae, 0xff, 0x79, 0x8a, 0xb4, 0xff, 0x7c, 0x8c, 0xb7, 0xff, 0x20, 0x2c, 0x5f, 0xff, 0x3a, 0x3c, 0x64, 0xff, 0x73, 0x72, 0x89, 0xff, 0x9f, 0xa4, 0xb8, 0xff, 0xa5, 0xac, 0xc3, 0xff, 0x98, 0xa0, 0xbc, 0xff, 0x8c, 0x94, 0xb9, 0xff, 0x68, 0x73, 0x9d, 0xff, 0x42, 0x4f, 0x7c, 0xff, 0x4c, 0x59, 0x88, 0xff, 0x6a, 0x75, 0xa3, 0xff, 0x77, 0x81, 0xae, 0xff, 0x81, 0x8f, 0xb9, 0xff, 0x87, 0x95, 0xbc, 0xff, 0x8b, 0x9a, 0xbd, 0xff, 0x8c, 0x9e, 0xbd, 0xff, 0x8c, 0x9a, 0xbd, 0xff, 0x8d, 0x98, 0xbf, 0xff, 0x8a, 0x93, 0xbc, 0xff, 0x82, 0x8e, 0xb6, 0xff, 0x81, 0x90, 0xb7, 0xff, 0x7a, 0x8b, 0xb0, 0xff, 0x71, 0x83, 0xae, 0xff, 0x6b, 0x7a, 0xa8, 0xff, 0x51, 0x5a, 0x80, 0xff, 0x29, 0x2e, 0x46, 0xff, 0x19, 0x18, 0x24, 0xff, 0x17, 0x15, 0x1d, 0xff, 0x1d, 0x19, 0x1f, 0xff, 0x18, 0x16, 0x15, 0xff, 0x19, 0x17, 0x16, 0xff, 0x1e, 0x1c, 0x21, 0xff, 0x34, 0x34, 0x40, 0xff, 0x29, 0x2b, 0x39, 0xff, 0x22, 0x20, 0x29, 0xff, 0x2e, 0x2a, 0x34, 0xff, 0x1e, 0x1c, 0x2e, 0xff, 0x1d, 0x1d, 0x35, 0xff, 0x2e, 0x32, 0x4e, 0xff, 0x38, 0x42, 0x61, 0xff, 0x1b, 0x24, 0x48, 0xff, 0x15, 0x16, 0x3d, 0xff, 0x2f, 0x2e, 0x57, 0xff, 0x50, 0x4e, 0x75, 0xff, 0x4d, 0x4c, 0x6a, 0xff, 0x32, 0x32, 0x43, 0xff, 0x05, 0x06, 0x0a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x12, 0x0c, 0x0a, 0xff, 0x13, 0x0f, 0x0d, 0xff, 0x11, 0x0e, 0x0e, 0xff, 0x15, 0x11, 0x11, 0xff, 0x13, 0x0e, 0x0e, 0xff, 0x12, 0x0c, 0x0c, 0xff, 0x12, 0x0e, 0x0d, 0xff, 0x12, 0x0e, 0x0d, 0xff, 0x15, 0x11, 0x10, 0xff, 0x16, 0x13, 0x12, 0xff, 0x15, 0x11, 0x10, 0xff, 0x1a, 0x16, 0x15, 0xff, 0x1c, 0x17, 0x16, 0xff, 0x1b, 0x16, 0x15, 0xff, 0x19, 0x14, 0x13, 0xff, 0x1c, 0x17, 0x16, 0xff, 0x1b, 0x16, 0x15, 0xff, 0x1a, 0x15, 0x14, 0xff, 0x15, 0x10, 0x0f, 0xff, 0x0f, 0x0a, 0x09, 0xff, 0x1b, 0x15, 0x17, 0xff, 0x33, 0x2c, 0x34, 0xff, 0x22, 0x1a, 0x24, 0xff, 0x45, 0x3d, 0x41, 0xff, 0xa7, 0xa1, 0x9e, 0xff, 0xbc, 0xb6, 0xb2, 0xff, 0xd8, 0xd1, 0xcd, 0xff, 0xd7, 0xcf, 0xc9, 0xff, 0xcb, 0xbf, 0xb9, 0xff, 0xc7, 0xba, 0xb3, 0xff, 0xc6, 0xba, 0xb2, 0xff, 0xcb, 0xbe, 0xb6, 0xff, 0xcd, 0xc0, 0xb7, 0xff, 0xc8, 0xbb, 0xb4, 0xff, 0xc5, 0xb8, 0xb1, 0xff, 0xbe, 0xb3, 0xac, 0xff, 0xbf, 0xb4, 0xad, 0xff, 0xc1, 0xb5, 0xad, 0xff, 0xc1, 0xb2, 0xad, 0xff, 0xc9, 0xba, 0xb7, 0xff, 0xd4, 0xc7, 0xc6, 0xff, 0xdb, 0xce, 0xd0, 0xff, 0xc8, 0xbd, 0xc1, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xf0, 0xf0, 0x22, 0xf1, 0xec, 0xed, 0xfe, 0xed, 0xe9, 0xe7, 0xff, 0xed, 0xe8, 0xe7, 0xff, 0xed, 0xe7, 0xe7, 0xff, 0xe9, 0xe2, 0xe3, 0xff, 0xde, 0xd7, 0xd9, 0xff, 0xdb, 0xd4, 0xd2, 0xff, 0xe1, 0xd9, 0xd8, 0xff, 0xeb, 0xe1, 0xe2, 0xff, 0xed, 0xe7, 0xe8, 0xff, 0xe8, 0xe6, 0xe7, 0xff, 0xe7, 0xe2, 0xe4, 0xff, 0xe5, 0xdd, 0xe1, 0xff, 0xe3, 0xdb, 0xdf, 0xff, 0xe5, 0xdb, 0xde, 0xff, 0xe2, 0xd8, 0xd7, 0xff, 0xdd, 0xd6, 0xce, 0xff, 0xdf, 0xd5, 0xd0, 0xff, 0x90, 0x88, 0x8c, 0xff, 0x8f, 0x8c, 0x9c, 0xff, 0xbf, 0xc2, 0xdf, 0xff, 0x97, 0x9a, 0xc1, 0xff, 0x8f, 0x95, 0xbd, 0xff, 0x86, 0x8f, 0xb6, 0xff, 0x84, 0x8c, 0xb4, 0xff, 0x85, 0x8e, 0xb8, 0xff, 0x7b, 0x86, 0xb1, 0xff, 0x67, 0x6f, 0x9b, 0xff, 0x69, 0x6f, 0x99, 0xff, 0x83, 0x8a, 0xad, 0xff, 0x93, 0x9b, 0xbf, 0xff, 0x82, 0x89, 0xaf, 0xff, 0x84, 0x8b, 0xb2, 0xff, 0x7e, 0x83, 0xb0, 0xff, 0x7d, 0x81, 0xaf, 0xff, 0x7b, 0x81, 0xac, 0xff, 0x76, 0x7e, 0xa6, 0xff, 0x7b, 0x83, 0xac, 0xff, 0x7f, 0x87, 0xb0, 0xff, 0x86, 0x8e, 0xb5, 0xff, 0x93, 0x9b, 0xc3, 0xff, 0x98, 0xa0, 0xc7, 0xff, 0x97, 0xa0, 0xc5, 0xff, 0x96, 0x9f, 0xc4, 0xff, 0x95, 0xa1, 0xc5, 0xff, 0x93, 0x9e, 0xc3, 0xff, 0x8c, 0x9b, 0xc0, 0xff, 0x8d, 0x99, 0xbf, 0xff, 0x8a, 0x94, 0xb9, 0xff, 0x7d, 0x8e, 0xb4, 0xff, 0x75, 0x8b, 0xb2, 0xff, 0x63, 0x76, 0xa1, 0xff, 0x3d, 0x47, 0x6a, 0xff, 0x22, 0x22, 0x32, 0xff, 0x1b, 0x16, 0x1f, 0xff, 0x1c, 0x16, 0x1f, 0xff, 0x1a, 0x17, 0x18, 0xff, 0x18, 0x16, 0x15, 0xff, 0x26, 0x25, 0x28, 0xff, 0x36, 0x35, 0x3c, 0xff, 0x1f, 0x20, 0x2b, 0xff, 0x1f, 0x1d, 0x28, 0xff, 0x2f, 0x2c, 0x40, 0xff, 0x27, 0x28, 0x4a, 0xff, 0x36, 0x3d, 0x61, 0xff, 0x4d, 0x5b, 0x82, 0xff, 0x45, 0x54, 0x81, 0xff, 0x47, 0x4d, 0x80, 0xff, 0x77, 0x7b, 0xab, 0xff, 0xa4, 0xad, 0xdc, 0xff, 0xba, 0xc6, 0xf8, 0xff, 0xc3, 0xcf, 0xfe, 0xff, 0xc8, 0xce, 0xf9, 0xff, 0xac, 0xb0, 0xd0, 0xff, 0x54, 0x52, 0x64, 0xff, 0x01, 0x00, 0x00, 0xff, 0x0d, 0x08, 0x03, 0xff, 0x16, 0x13, 0x11, 0xff, 0x11, 0x0d, 0x11, 0xff, 0x15, 0x0d, 0x0e, 0xff, 0x1b, 0x11, 0x10, 0xff, 0x1a, 0x11, 0x11, 0xff, 0x16, 0x10, 0x0f, 0xff, 0x14, 0x10, 0x0f, 0xff, 0x16, 0x12, 0x11, 0xff, 0x19, 0x15, 0x14, 0xff, 0x1c, 0x18, 0x17, 0xff, 0x20, 0x1b, 0x1a, 0xff, 0x1a, 0x15, 0x14, 0xff, 0x1a, 0x15, 0x14, 0xff, 0x1a, 0x15, 0x14, 0xff, 0x18, 0x13, 0x12, 0xff, 0x15, 0x10, 0x0f, 0xff, 0x10, 0x0c, 0x0a, 0xff, 0x11, 0x0f, 0x0c, 0xff, 0x1c, 0x1b, 0x1c, 0xff, 0x30, 0x2f, 0x35, 0xff, 0x1c, 0x18, 0x1c, 0xff, 0x43, 0x38, 0x38, 0xff, 0xb8, 0xac, 0xa4, 0xff, 0xb2, 0xab, 0xa0, 0xff, 0xb7, 0xaf, 0xa3, 0xff, 0xb1, 0xa7, 0x98, 0xff, 0xaa, 0x9d, 0x8d, 0xff, 0xa8, 0x98, 0x8b, 0xff, 0xa8, 0x9c, 0x8c, 0xff, 0xb9, 0xad, 0x9b, 0xff, 0xbe, 0xb0, 0x9f, 0xff, 0xb9, 0xab, 0x9f, 0xff, 0xb7, 0xaa, 0xa2, 0xff, 0xa6, 0x9b, 0x93, 0xff, 0xa3, 0x99, 0x8f, 0xff, 0xab, 0xa2, 0x95, 0xff, 0xaa, 0x9d, 0x91, 0xff, 0xba, 0xab, 0xa4, 0xff, 0xcd, 0xc3, 0xc0, 0xff, 0xd9, 0xcd, 0xd1, 0xff, 0xd5, 0xc7, 0xcb, 0xfe, 0xc3, 0xbb, 0xc3, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xcf, 0xd1, 0x86, 0xd6, 0xd0, 0xcb, 0xff, 0xd1, 0xcb, 0xc5, 0xff, 0xce, 0xc8, 0xc0, 0xff, 0xca, 0xc5, 0xbd, 0xff, 0xc9, 0xc5, 0xbc, 0xff, 0xc8, 0xc4, 0xbb, 0xff, 0xc6, 0xbf, 0xb8, 0xff, 0xc6, 0xbc, 0xb8, 0xff, 0xc9, 0xbf, 0xbc, 0xff, 0xc9, 0xc2, 0xc0, 0xff, 0xc5, 0xbf, 0xbd, 0xff, 0xc2, 0xba, 0xb6, 0xff, 0xbf, 0xb6, 0xb1, 0xff, 0xba, 0xb2, 0xac, 0xff, 0xbd, 0xb4, 0xad, 0xff, 0xc2, 0xb9, 0xaf, 0xff, 0xc4, 0xbd, 0xad, 0xff, 0xbc, 0xb4, 0xad, 0xff, 0xb8, 0xb1, 0xbb, 0xff, 0xc9, 0xc5, 0xdc, 0xff, 0xaa, 0xad, 0xcd, 0xff, 0x98, 0x9f, 0xc3, 0xff, 0x91, 0x99, 0xbe, 0xff, 0x8c, 0x95, 0xba, 0xff, 0x8a, 0x91, 0xb8, 0xff, 0x8b, 0x91, 0xba, 0xff, 0x8d, 0x94, 0xbe, 0xff, 0x96, 0x9d, 0xc6, 0xff, 0x96, 0x9e, 0xc6, 0xff, 0x8a, 0x93, 0xb8, 0xff, 0x84, 0x8d, 0xb3, 0xff, 0x86, 0x8e, 0xb7, 0xff, 0x86, 0x8d, 0xb6, 0xff, 0x85, 0x8a, 0xb7, 0xff, 0x89, 0x8f, 0xbb, 0xff, 0x90, 0x98, 0xbe, 0xff, 0x91, 0x9a, 0xc0, 0xff, 0x94, 0x9d, 0xc3, 0xff, 0x96, 0x9f, 0xc5, 0xff, 0x98, 0xa1, 0xc6, 0xff, 0x9c, 0xa5, 0xca, 0xff, 0x9c, 0xa5, 0xca, 0xff, 0x9c, 0xa5, 0xca, 0xff, 0x9c, 0xa5, 0xca, 0xff, 0x9a, 0xa5, 0xc9, 0xff, 0x98, 0xa3, 0xc8, 0xff, 0x91, 0xa2, 0xc6, 0xff, 0x93, 0xa0, 0xc5, 0xff, 0x93, 0x9b, 0xc2, 0xff, 0x89, 0x98, 0xbe, 0xff, 0x80, 0x93, 0xbb, 0xff, 0x7b, 0x8c, 0xb9, 0xff, 0x54, 0x5e, 0x82, 0xff, 0x2a, 0x29, 0x3b, 0xff, 0x20, 0x1b, 0x25, 0xff, 0x1e, 0x1a, 0x20, 0xff, 0x20, 0x1d, 0x1e, 0xff, 0x1e, 0x1a, 0x1d, 0xff, 0x2a, 0x28, 0x2b, 0xff, 0x26, 0x27, 0x2e, 0xff, 0x13, 0x16, 0x21, 0xff, 0x23, 0x28, 0x3b, 0xff, 0x3f, 0x44, 0x64, 0xff, 0x45, 0x4b, 0x76, 0xff, 0x54, 0x5f, 0x8a, 0xff, 0x5d, 0x6d, 0x98, 0xff, 0x6b, 0x78, 0xab, 0xff, 0x9c, 0xa6, 0xdf, 0xff, 0xb6, 0xc0, 0xf7, 0xff, 0xa8, 0xb6, 0xed, 0xff, 0x97, 0xa9, 0xe1, 0xff, 0x9b, 0xaa, 0xe2, 0xff, 0xaf, 0xb9, 0xf2, 0xff, 0xd1, 0xd8, 0xff, 0xff, 0xe3, 0xe7, 0xff, 0xff, 0x7f, 0x7e, 0x99, 0xff, 0x02, 0x00, 0x04, 0xff, 0x14, 0x0e, 0x0b, 0xff, 0x13, 0x0f, 0x10, 0xff, 0x18, 0x12, 0x12, 0xff, 0x1a, 0x12, 0x12, 0xff, 0x16, 0x0e, 0x0e, 0xff, 0x13, 0x0d, 0x0d, 0xff, 0x14, 0x10, 0x0f, 0xff, 0x14, 0x10, 0x0f, 0xff, 0x19, 0x15, 0x14, 0xff, 0x1f, 0x1b, 0x1a, 0xff, 0x22, 0x1d, 0x1c, 0xff, 0x1a, 0x15, 0x14, 0xff, 0x18, 0x13, 0x12, 0xff, 0x1d, 0x18, 0x17, 0xff, 0x16, 0x11, 0x10, 0xff, 0x0e, 0x09, 0x08, 0xff, 0x10, 0x0b, 0x09, 0xff, 0x16, 0x16, 0x11, 0xff, 0x24, 0x22, 0x23, 0xff, 0x28, 0x27, 0x2d, 0xff, 0x1a, 0x16, 0x1b, 0xff, 0x55, 0x49, 0x4a, 0xff, 0xcd, 0xc0, 0xbb, 0xff, 0xa6, 0x9e, 0x92, 0xff, 0x85, 0x7d, 0x6e, 0xff, 0x8a, 0x7f, 0x6d, 0xff, 0x8d, 0x81, 0x6e, 0xff, 0x8d, 0x81, 0x6e, 0xff, 0x90, 0x88, 0x74, 0xff, 0xa0, 0x96, 0x86, 0xff, 0xaf, 0xa1, 0x94, 0xff, 0xac, 0xa0, 0x93, 0xff, 0xa2, 0x97, 0x8d, 0xff, 0x8e, 0x84, 0x79, 0xff, 0x8f, 0x87, 0x79, 0xff, 0x95, 0x8c, 0x7d, 0xff, 0x8e, 0x84, 0x76, 0xff, 0xa2, 0x97, 0x8c, 0xff, 0xc3, 0xb9, 0xb1, 0xff, 0xc5, 0xba, 0xb5, 0xff, 0xc4, 0xb9, 0xb4, 0xff, 0xca, 0xc0, 0xb9, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x04, 0xc2, 0xb8, 0xb0, 0xe7, 0xc3, 0xb9, 0xb1, 0xff, 0xc1, 0xb8, 0xae, 0xff, 0xbf, 0xb6, 0xac, 0xff, 0xb8, 0xb3, 0xa8, 0xff, 0xb9, 0xb3, 0xaa, 0xff, 0xbe, 0xb8, 0xaf, 0xff, 0xc0, 0xb9, 0xae, 0xff, 0xbd, 0xb5, 0xab, 0xff, 0xb7, 0xaf, 0xa6, 0xff, 0xb4, 0xab, 0xa5, 0xff, 0xb2, 0xa8, 0xa2, 0xff, 0xaf, 0xa4, 0x9a, 0xff, 0xa9, 0xa0, 0x92, 0xff, 0xa8, 0xa0, 0x91, 0xff, 0xb0, 0xa7, 0x96, 0xff, 0xb9, 0xb0, 0x9d, 0xff, 0xb1, 0xa8, 0x96, 0xff, 0xbe, 0xb1, 0xb1, 0xff, 0xd9, 0xcf, 0xe8, 0xff, 0xbd, 0xb8, 0xd9, 0xff, 0xa6, 0xaa, 0xcd, 0xff, 0x9a, 0xa4, 0xc6, 0xff, 0x96, 0x9f, 0xc1, 0xff, 0x95, 0x9c, 0xc1, 0xff, 0x92, 0x99, 0xbf, 0xff, 0x94, 0x99, 0xc0, 0xff, 0x99, 0x9c, 0xc5, 0xff, 0x92, 0x98, 0xbf, 0xff, 0x92, 0x9b, 0xc1, 0xff, 0x91, 0x9c, 0xc3, 0xff, 0x91, 0x9b, 0xc4, 0xff, 0x8e, 0x98, 0xc3, 0xff, 0x91, 0x98, 0xc4, 0xff, 0x92, 0x98, 0xc7, 0xff, 0x94, 0x9b, 0xc5, 0xff, 0x94, 0x9f, 0xc2, 0xff, 0x98, 0xa1, 0xc5, 0xff, 0x9d, 0xa6, 0xca, 0xff, 0x9f, 0xa9, 0xcc, 0xff, 0xa1, 0xab, 0xcc, 0xff, 0xa0, 0xaa, 0xcc, 0xff, 0x9f, 0xa9, 0xcb, 0xff, 0x9f, 0xa7, 0xcc, 0xff, 0x9d, 0xa7, 0xcc, 0xff, 0x9b, 0xa7, 0xcb, 0xff, 0x9b, 0xa5, 0xcb, 0xff, 0x95, 0xa5, 0xca, 0xff, 0x96, 0xa4, 0xc9, 0xff, 0x9a, 0xa0, 0xc7, 0xff, 0x92, 0x9e, 0xc5, 0xff, 0x88, 0x99, 0xc2, 0xff, 0x85, 0x94, 0xc2, 0xff, 0x5e, 0x67, 0x8d, 0xff, 0x37, 0x37, 0x49, 0xff, 0x28, 0x23, 0x2d, 0xff, 0x27, 0x24, 0x27, 0xff, 0x25, 0x21, 0x23, 0xff, 0x24, 0x1f, 0x24, 0xff, 0x28, 0x24, 0x2c, 0xff, 0x1b, 0x1b, 0x29, 0xff, 0x1b, 0x1f, 0x34, 0xff, 0x37, 0x41, 0x60, 0xff, 0x62, 0x6f, 0x9b, 0xff, 0x60, 0x6c, 0x9f, 0xff, 0x63, 0x73, 0xa5, 0xff, 0x76, 0x85, 0xb6, 0xff, 0x96, 0x9f, 0xd8, 0xff, 0x90, 0x9c, 0xdb, 0xff, 0x6d, 0x7d, 0xbc, 0xff, 0x67, 0x7a, 0xb9, 0xff, 0x5f, 0x75, 0xb6, 0xff, 0x5e, 0x70, 0xb3, 0xff, 0x63, 0x70, 0xb7, 0xff, 0x73, 0x7f, 0xc6, 0xff, 0x9e, 0xab, 0xeb, 0xff, 0xda, 0xe6, 0xff, 0xff, 0x64, 0x67, 0x7d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1b, 0x18, 0x12, 0xff, 0x13, 0x10, 0x0f, 0xff, 0x17, 0x13, 0x13, 0xff, 0x18, 0x0f, 0x10, 0xff, 0x11, 0x0b, 0x0a, 0xff, 0x17, 0x13, 0x11, 0xff, 0x19, 0x15, 0x14, 0xff, 0x19, 0x15, 0x14, 0xff, 0x1b, 0x17, 0x16, 0xff, 0x1a, 0x15, 0x14, 0xff, 0x1c, 0x16, 0x15, 0xff, 0x18, 0x13, 0x12, 0xff, 0x1a, 0x15, 0x14, 0xff, 0x17, 0x12, 0x11, 0xff, 0x0f, 0x0a, 0x09, 0xff, 0x13, 0x0f, 0x0c, 0xff, 0x1e, 0x1c, 0x18, 0xff, 0x22, 0x20, 0x21, 0xff, 0x17, 0x16, 0x1c, 0xff, 0x16, 0x12, 0x18, 0xff, 0x95, 0x88, 0x8b, 0xff, 0xef, 0xe2, 0xe0, 0xff, 0xb0, 0xa8, 0x9a, 0xff, 0x75, 0x6c, 0x58, 0xff, 0x79, 0x6c, 0x59, 0xff, 0x7f, 0x74, 0x5c, 0xff, 0x7f, 0x78, 0x5e, 0xff, 0x83, 0x7d, 0x68, 0xff, 0x8b, 0x83, 0x73, 0xff, 0xa0, 0x93, 0x89, 0xff, 0xab, 0xa1, 0x95, 0xff, 0x93, 0x8b, 0x7e, 0xff, 0x7b, 0x72, 0x64, 0xff, 0x76, 0x6d, 0x5e, 0xff, 0x80, 0x78, 0x66, 0xff, 0x88, 0x81, 0x71, 0xff, 0x8f, 0x86, 0x79, 0xff, 0xae, 0xa5, 0x98, 0xff, 0xbf, 0xb6, 0xa9, 0xff, 0xb4, 0xac, 0x9c, 0xff, 0xb5, 0xac, 0x9a, 0xe7, 0xbf, 0xbf, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xa4, 0x99, 0x49, 0xb5, 0xab, 0xa3, 0xff, 0xba, 0xb1, 0xa6, 0xff, 0xb6, 0xae, 0x9f, 0xff, 0xb6, 0xac, 0xa3, 0xff, 0xb3, 0xab, 0xa5, 0xff, 0xb3, 0xaa, 0xa3, 0xff, 0xb1, 0xa8, 0x9e, 0xff, 0xab, 0xa2, 0x99, 0xff, 0xab, 0xa2, 0x98, 0xff, 0xa4, 0x9a, 0x90, 0xff, 0xa3, 0x95, 0x8b, 0xff, 0xa4, 0x96, 0x89, 0xff, 0xa1, 0x95, 0x85, 0xff, 0xa1, 0x9a, 0x84, 0xff, 0xa4, 0x9b, 0x86, 0xff, 0xad, 0xa2, 0x8c, 0xff, 0x9d, 0x94, 0x80, 0xff, 0xa3, 0x9a, 0x90, 0xff, 0xd5, 0xcd, 0xd6, 0xff, 0xc6, 0xc0, 0xe0, 0xff, 0xb4, 0xb0, 0xd9, 0xff, 0xaa, 0xab, 0xd1, 0xff, 0xa2, 0xa9, 0xca, 0xff, 0x9c, 0xa5, 0xc8, 0xff, 0x9b, 0xa3, 0xc9, 0xff, 0x9b, 0xa3, 0xc8, 0xff, 0x9b, 0xa3, 0xc8, 0xff, 0x9d, 0xa4, 0xcb, 0xff, 0x96, 0x9e, 0xc5, 0xff, 0x91, 0x9a, 0xc2, 0xff, 0x92, 0x9d, 0xc5, 0xff, 0x92, 0x9e, 0xc6, 0xff, 0x93, 0x9f, 0xc8, 0xff, 0x95, 0xa0, 0xca, 0xff, 0x97, 0xa1, 0xcb, 0xff, 0x97, 0xa2, 0xcc, 0xff, 0x9b, 0xa6, 0xcb, 0xff, 0xa0, 0xab, 0xca, 0xff, 0xa2, 0xad, 0xce, 0xff, 0xa3, 0xad, 0xce, 0xff, 0xa2, 0xad, 0xce, 0xff, 0xa2, 0xac, 0xce, 0xff, 0xa2, 0xac, 0xcd, 0xff, 0xa0, 0xa9, 0xce, 0xff, 0x9e, 0xa7, 0xcd, 0xff, 0x9d, 0xa9, 0xcd, 0xff, 0x9c, 0xa7, 0xcd, 0xff, 0x9b, 0xa6, 0xcd, 0xff, 0x9a, 0xa4, 0xcb, 0xff, 0x96, 0xa2, 0xca, 0xff, 0x92, 0xa2, 0xc7, 0xff, 0x8e, 0x9f, 0xc4, 0xff, 0x87, 0x95, 0xbf, 0xff, 0x61, 0x69, 0x90, 0xff, 0x3f, 0x3f, 0x58, 0xff, 0x2d, 0x29, 0x33, 0xff, 0x32, 0x2b, 0x30, 0xff, 0x28, 0x24, 0x27, 0xff, 0x2b, 0x27, 0x2e, 0xff, 0x1d, 0x1c, 0x27, 0xff, 0x1f, 0x24, 0x35, 0xff, 0x3b, 0x42, 0x5f, 0xff, 0x67, 0x73, 0x9d, 0xff, 0x70, 0x81, 0xb5, 0xff, 0x6a, 0x7c, 0xb3, 0xff, 0x76, 0x8a, 0xbc, 0xff, 0x87, 0x97, 0xca, 0xff, 0x88, 0x91, 0xcf, 0xff, 0x48, 0x55, 0x9b, 0xff, 0x42, 0x56, 0x9c, 0xff, 0x53, 0x69, 0xac, 0xff, 0x56, 0x70, 0xae, 0xff, 0x54, 0x6c, 0xae, 0xff, 0x4c, 0x59, 0xa6, 0xff, 0x3c, 0x49, 0x99, 0xff, 0x55, 0x66, 0xb4, 0xff, 0x9b, 0xac, 0xf2, 0xff, 0xbc, 0xc5, 0xec, 0xff, 0x26, 0x22, 0x28, 0xff, 0x0e, 0x08, 0x00, 0xff, 0x10, 0x11, 0x0f, 0xff, 0x10, 0x10, 0x11, 0xff, 0x16, 0x12, 0x10, 0xff, 0x12, 0x0e, 0x0d, 0xff, 0x19, 0x15, 0x14, 0xff, 0x1a, 0x15, 0x14, 0xff, 0x1a, 0x15, 0x14, 0xff, 0x1d, 0x18, 0x17, 0xff, 0x1a, 0x15, 0x14, 0xff, 0x1b, 0x16, 0x15, 0xff, 0x1a, 0x15, 0x14, 0xff, 0x18, 0x13, 0x12, 0xff, 0x14, 0x0f, 0x0e, 0xff, 0x12, 0x0d, 0x0c, 0xff, 0x1a, 0x16, 0x14, 0xff, 0x1d, 0x1b, 0x1c, 0xff, 0x1c, 0x19, 0x1c, 0xff, 0x0c, 0x09, 0x0e, 0xff, 0x3c, 0x37, 0x3d, 0xff, 0xd8, 0xce, 0xd5, 0xff, 0xf9, 0xec, 0xf0, 0xff, 0xd2, 0xc8, 0xbf, 0xff, 0xa3, 0x9a, 0x89, 0xff, 0x75, 0x6c, 0x55, 0xff, 0x75, 0x6d, 0x50, 0xff, 0x7b, 0x74, 0x58, 0xff, 0x80, 0x7a, 0x64, 0xff, 0x8b, 0x84, 0x72, 0xff, 0x92, 0x8b, 0x7c, 0xff, 0x95, 0x8d, 0x7f, 0xff, 0x8e, 0x84, 0x77, 0xff, 0x82, 0x7a, 0x69, 0xff, 0x73, 0x6d, 0x59, 0xff, 0x71, 0x6c, 0x54, 0xff, 0x84, 0x80, 0x67, 0xff, 0x89, 0x82, 0x6e, 0xff, 0x93, 0x88, 0x77, 0xff, 0xac, 0xa0, 0x91, 0xff, 0xad, 0xa4, 0x90, 0xff, 0x88, 0x81, 0x69, 0xff, 0x8d, 0x7f, 0x6e, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x93, 0x88, 0x9f, 0xa6, 0x9e, 0x93, 0xff, 0xad, 0xa5, 0x98, 0xff, 0xab, 0xa3, 0x94, 0xff, 0xa7, 0x9f, 0x94, 0xff, 0xa5, 0x9d, 0x96, 0xff, 0xa4, 0x9b, 0x92, 0xff, 0xa0, 0x97, 0x8b, 0xff, 0x97, 0x8f, 0x81, 0xff, 0x91, 0x88, 0x78, 0xff, 0x8d, 0x83, 0x72, 0xff, 0x8e, 0x82, 0x6e, 0xff, 0x92, 0x86, 0x6e, 0xff, 0x96, 0x8e, 0x72, 0xff, 0x97, 0x93, 0x74, 0xff, 0x9a, 0x94, 0x79, 0xff, 0x90, 0x88, 0x6e, 0xff, 0x8a, 0x84, 0x7a, 0xff, 0xd0, 0xc9, 0xd5, 0xff, 0xd2, 0xce, 0xe4, 0xff, 0xb5, 0xb4, 0xd8, 0xff, 0xb1, 0xb2, 0xd9, 0xff, 0xae, 0xb1, 0xd4, 0xff, 0xa7, 0xad, 0xcd, 0xff, 0xa0, 0xa8, 0xca, 0xff, 0x9f, 0xa7, 0xcb, 0xff, 0x9f, 0xa7, 0xca, 0xff, 0xa0, 0xa7, 0xcb, 0xff, 0xa0, 0xa7, 0xcb, 0xff, 0x9b, 0xa3, 0xc9, 0xff, 0x97, 0xa0, 0xc7, 0xff, 0x97, 0xa3, 0xc9, 0xff, 0x9c, 0xa7, 0xcd, 0xff, 0x9d, 0xa9, 0xcf, 0xff, 0x9c, 0xa8, 0xce, 0xff, 0x9e, 0xa9, 0xd0, 0xff, 0x9e, 0xaa, 0xd1, 0xff, 0xa2, 0xac, 0xd1, 0xff, 0xa6, 0xaf, 0xd3, 0xff, 0xa7, 0xb0, 0xd4, 0xff, 0xa6, 0xb0, 0xd4, 0xff, 0xa6, 0xaf, 0xd3, 0xff, 0xa5, 0xaf, 0xd2, 0xff, 0xa5, 0xaf, 0xd3, 0xff, 0xa4, 0xac, 0xd1, 0xff, 0xa1, 0xaa, 0xcf, 0xff, 0x9f, 0xab, 0xcf, 0xff, 0x9e, 0xa9, 0xcf, 0xff, 0x9e, 0xa8, 0xce, 0xff, 0x9b, 0xa3, 0xcc, 0xff, 0x95, 0xa1, 0xcb, 0xff, 0x94, 0xa3, 0xc8, 0xff, 0x91, 0xa1, 0xc5, 0xff, 0x8b, 0x98, 0xc0, 0xff, 0x5d, 0x64, 0x8c, 0xff, 0x36, 0x38, 0x54, 0xff, 0x32, 0x31, 0x3e, 0xff, 0x2c, 0x24, 0x2d, 0xff, 0x28, 0x25, 0x2c, 0xff, 0x29, 0x2a, 0x35, 0xff, 0x23, 0x26, 0x3a, 0xff, 0x38, 0x3e, 0x5d, 0xff, 0x62, 0x6c, 0x94, 0xff, 0x86, 0x96, 0xc2, 0xff, 0x74, 0x86, 0xb8, 0xff, 0x74, 0x89, 0xbe, 0xff, 0x7b, 0x92, 0xc2, 0xff, 0x84, 0x98, 0xcb, 0xff, 0x52, 0x5f, 0x9f, 0xff, 0x23, 0x31, 0x7a, 0xff, 0x53, 0x69, 0xad, 0xff, 0x6e, 0x85, 0xc3, 0xff, 0x79, 0x91, 0xc7, 0xff, 0x75, 0x8d, 0xc5, 0xff, 0x6b, 0x7c, 0xbf, 0xff, 0x5d, 0x6b, 0xb3, 0xff, 0x4e, 0x5d, 0xa9, 0xff, 0x50, 0x64, 0xb4, 0xff, 0xae, 0xbf, 0xfb, 0xff, 0x68, 0x6a, 0x82, 0xff, 0x02, 0x00, 0x00, 0xff, 0x17, 0x17, 0x13, 0xff, 0x12, 0x14, 0x12, 0xff, 0x10, 0x0e, 0x0d, 0xff, 0x19, 0x16, 0x15, 0xff, 0x14, 0x0f, 0x0e, 0xff, 0x1a, 0x14, 0x13, 0xff, 0x1e, 0x19, 0x18, 0xff, 0x1b, 0x16, 0x15, 0xff, 0x1d, 0x18, 0x17, 0xff, 0x1b, 0x17, 0x16, 0xff, 0x1b, 0x16, 0x15, 0xff, 0x18, 0x13, 0x12, 0xff, 0x0f, 0x0a, 0x09, 0xff, 0x11, 0x0c, 0x0b, 0xff, 0x1c, 0x17, 0x16, 0xff, 0x1e, 0x1a, 0x1b, 0xff, 0x1b, 0x17, 0x19, 0xff, 0x0c, 0x07, 0x0c, 0xff, 0x76, 0x70, 0x76, 0xff, 0xf3, 0xea, 0xf5, 0xff, 0xe7, 0xdc, 0xe5, 0xff, 0xd8, 0xce, 0xcf, 0xff, 0xcb, 0xc2, 0xb9, 0xff, 0x92, 0x89, 0x74, 0xff, 0x7b, 0x71, 0x54, 0xff, 0x88, 0x7e, 0x60, 0xff, 0x8c, 0x83, 0x68, 0xff, 0x91, 0x8a, 0x71, 0xff, 0x93, 0x8f, 0x77, 0xff, 0x94, 0x8c, 0x77, 0xff, 0x93, 0x88, 0x75, 0xff, 0x8f, 0x84, 0x71, 0xff, 0x8f, 0x85, 0x6e, 0xff, 0x81, 0x79, 0x5e, 0xff, 0x86, 0x7f, 0x62, 0xff, 0x96, 0x8d, 0x73, 0xff, 0x91, 0x85, 0x70, 0xff, 0x92, 0x87, 0x73, 0xff, 0x96, 0x8f, 0x76, 0xff, 0x8c, 0x87, 0x6b, 0xff, 0x7b, 0x73, 0x59, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x6d, 0x07, 0x98, 0x95, 0x86, 0xef, 0x99, 0x94, 0x84, 0xff, 0x99, 0x91, 0x85, 0xff, 0x97, 0x8e, 0x86, 0xff, 0x95, 0x8e, 0x80, 0xff, 0x94, 0x8e, 0x7a, 0xff, 0x93, 0x8d, 0x78, 0xff, 0x8c, 0x85, 0x70, 0xff, 0x80, 0x7b, 0x62, 0xff, 0x77, 0x72, 0x56, 0xff, 0x78, 0x71, 0x54, 0xff, 0x7c, 0x73, 0x57, 0xff, 0x7e, 0x75, 0x58, 0xff, 0x82, 0x7c, 0x5a, 0xff, 0x86, 0x83, 0x62, 0xff, 0x80, 0x7a, 0x61, 0xff, 0x7a, 0x74, 0x5b, 0xff, 0xc6, 0xbe, 0xc4, 0xff, 0xd1, 0xcf, 0xee, 0xff, 0xb5, 0xb8, 0xd6, 0xff, 0xb2, 0xb9, 0xd8, 0xff, 0xae, 0xb6, 0xd7, 0xff, 0xab, 0xb1, 0xd4, 0xff, 0xa8, 0xb0, 0xce, 0xff, 0xa5, 0xac, 0xcc, 0xff, 0xa4, 0xaa, 0xcc, 0xff, 0xa4, 0xaa, 0xcc, 0xff, 0xa5, 0xaa, 0xcc, 0xff, 0xa4, 0xa8, 0xcb, 0xff, 0xa1, 0xa8, 0xcd, 0xff, 0x9e, 0xa6, 0xcc, 0xff, 0x9b, 0xa4, 0xca, 0xff, 0x9f, 0xa9, 0xce, 0xff, 0xa2, 0xac, 0xd2, 0xff, 0xa4, 0xad, 0xd1, 0xff, 0xa5, 0xae, 0xd2, 0xff, 0xa7, 0xb0, 0xd4, 0xff, 0xa6, 0xaf, 0xd5, 0xff, 0xa7, 0xb0, 0xd6, 0xff, 0xa8, 0xb1, 0xd6, 0xff, 0xa7, 0xb0, 0xd6, 0xff, 0xa7, 0xb0, 0xd5, 0xff, 0xa6, 0xaf, 0xd5, 0xff, 0xa7, 0xaf, 0xd5, 0xff, 0xa7, 0xaf, 0xd3, 0xff, 0xa3, 0xac, 0xd0, 0xff, 0x9f, 0xac, 0xcf, 0xff, 0x9e, 0xaa, 0xce, 0xff, 0x9d, 0xa7, 0xce, 0xff, 0x99, 0xa3, 0xcb, 0xff, 0x97, 0xa0, 0xca, 0xff, 0x97, 0xa3, 0xc8, 0xff, 0x94, 0xa0, 0xc4, 0xff, 0x8e, 0x97, 0xc0, 0xff, 0x5a, 0x60, 0x86, 0xff, 0x35, 0x39, 0x56, 0xff, 0x3a, 0x3c, 0x4b, 0xff, 0x30, 0x2b, 0x34, 0xff, 0x20, 0x20, 0x2a, 0xff, 0x20, 0x26, 0x36, 0xff, 0x52, 0x58, 0x72, 0xff, 0x6b, 0x72, 0x9d, 0xff, 0x7e, 0x8e, 0xbb, 0xff, 0x7f, 0x94, 0xbc, 0xff, 0x79, 0x8d, 0xbc, 0xff, 0x77, 0x8e, 0xbf, 0xff, 0x7b, 0x94, 0xc3, 0xff, 0x74, 0x8b, 0xc0, 0xff, 0x4b, 0x5a, 0x9c, 0xff, 0x3b, 0x4d, 0x97, 0xff, 0x4f, 0x67, 0xa9, 0xff, 0x73, 0x8a, 0xc2, 0xff, 0x83, 0x97, 0xc7, 0xff, 0x83, 0x9a, 0xc7, 0xff, 0x74, 0x8c, 0xc4, 0xff, 0x67, 0x79, 0xb9, 0xff, 0x65, 0x6e, 0xb2, 0xff, 0x49, 0x5d, 0xb2, 0xff, 0x78, 0x92, 0xdd, 0xff, 0x8b, 0x92, 0xb8, 0xff, 0x15, 0x0b, 0x0c, 0xff, 0x16, 0x10, 0x0a, 0xff, 0x15, 0x15, 0x12, 0xff, 0x14, 0x13, 0x11, 0xff, 0x19, 0x17, 0x16, 0xff, 0x18, 0x14, 0x12, 0xff, 0x1e, 0x19, 0x18, 0xff, 0x1b, 0x16, 0x15, 0xff, 0x20, 0x1b, 0x1a, 0xff, 0x1f, 0x1a, 0x19, 0xff, 0x1b, 0x16, 0x15, 0xff, 0x1b, 0x16, 0x15, 0xff, 0x19, 0x14, 0x13, 0xff, 0x0f, 0x0a, 0x09, 0xff, 0x11, 0x0c, 0x0b, 0xff, 0x1d, 0x18, 0x16, 0xff, 0x1b, 0x15, 0x16, 0xff, 0x17, 0x10, 0x13, 0xff, 0x1f, 0x18, 0x1c, 0xff, 0xbe, 0xb6, 0xbb, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xeb, 0xe2, 0xef, 0xff, 0xe2, 0xda, 0xe4, 0xff, 0xd6, 0xce, 0xce, 0xff, 0xa7, 0x9e, 0x8c, 0xff, 0x8a, 0x7e, 0x60, 0xff, 0x90, 0x84, 0x63, 0xff, 0x8f, 0x85, 0x66, 0xff, 0x8c, 0x84, 0x66, 0xff, 0x8f, 0x89, 0x6b, 0xff, 0x95, 0x8c, 0x70, 0xff, 0x95, 0x8a, 0x70, 0xff, 0x91, 0x82, 0x6c, 0xff, 0x92, 0x82, 0x6a, 0xff, 0x9a, 0x8d, 0x70, 0xff, 0x9d, 0x90, 0x71, 0xff, 0x9f, 0x93, 0x75, 0xff, 0xa5, 0x98, 0x7d, 0xff, 0xa3, 0x9a, 0x80, 0xff, 0x9c, 0x95, 0x80, 0xff, 0x9f, 0x96, 0x82, 0xff, 0x95, 0x8d, 0x72, 0xef, 0x91, 0x91, 0x6d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x8a, 0x7b, 0x46, 0x92, 0x8e, 0x7b, 0xff, 0x92, 0x8d, 0x78, 0xff, 0x91, 0x89, 0x78, 0xff, 0x8f, 0x86, 0x77, 0xff, 0x8c, 0x83, 0x71, 0xff, 0x89, 0x83, 0x6a, 0xff, 0x85, 0x7e, 0x62, 0xff, 0x80, 0x78, 0x59, 0xff, 0x7e, 0x75, 0x54, 0xff, 0x78, 0x70, 0x4e, 0xff, 0x70, 0x66, 0x45, 0xff, 0x6e, 0x67, 0x46, 0xff, 0x70, 0x69, 0x50, 0xff, 0x79, 0x71, 0x55, 0xff, 0x7e, 0x76, 0x50, 0xff, 0x6c, 0x63, 0x48, 0xff, 0xb3, 0xb1, 0xb0, 0xff, 0xd7, 0xd6, 0xf5, 0xff, 0xba, 0xba, 0xdf, 0xff, 0xb8, 0xba, 0xdc, 0xff, 0xb4, 0xb8, 0xd8, 0xff, 0xaf, 0xb5, 0xd5, 0xff, 0xa9, 0xb0, 0xd1, 0xff, 0xa7, 0xaf, 0xce, 0xff, 0xa7, 0xae, 0xcf, 0xff, 0xa6, 0xac, 0xcf, 0xff, 0xa6, 0xac, 0xce, 0xff, 0xa7, 0xad, 0xcf, 0xff, 0xa6, 0xab, 0xcf, 0xff, 0xa6, 0xac, 0xd0, 0xff, 0xa5, 0xac, 0xd0, 0xff, 0xa3, 0xab, 0xd0, 0xff, 0xa3, 0xac, 0xd1, 0xff, 0xa6, 0xae, 0xd3, 0xff, 0xa5, 0xb0, 0xd3, 0xff, 0xa6, 0xb1, 0xd4, 0xff, 0xa7, 0xb2, 0xd5, 0xff, 0xa8, 0xb1, 0xd6, 0xff, 0xa8, 0xb0, 0xd6, 0xff, 0xa7, 0xb0, 0xd5, 0xff, 0xa7, 0xb0, 0xd5, 0xff, 0xa7, 0xb0, 0xd5, 0xff, 0xa7, 0xaf, 0xd5, 0xff, 0xa6, 0xae, 0xd4, 0xff, 0xa4, 0xae, 0xd4, 0xff, 0xa1, 0xab, 0xd2, 0xff, 0x9f, 0xaa, 0xd0, 0xff, 0x9e, 0xa9, 0xd0, 0xff, 0x9b, 0xa5, 0xcd, 0xff, 0x97, 0xa3, 0xca, 0xff, 0x93, 0x9f, 0xc9, 0xff, 0x91, 0x9d, 0xc7, 0xff, 0x8e, 0x9b, 0xc5, 0xff, 0x87, 0x91, 0xbb, 0xff, 0x5d, 0x65, 0x8b, 0xff, 0x45, 0x4a, 0x6d, 0xff, 0x40, 0x41, 0x58, 0xff, 0x2e, 0x2b, 0x3b, 0xff, 0x1b, 0x1f, 0x33, 0xff, 0x37, 0x41, 0x5b, 0xff, 0x7c, 0x89, 0xa8, 0xff, 0x7e, 0x8f, 0xb6, 0xff, 0x81, 0x95, 0xbf, 0xff, 0x79, 0x90, 0xb8, 0xff, 0x75, 0x8d, 0xb9, 0xff, 0x74, 0x8e, 0xbd, 0xff, 0x79, 0x94, 0xc5, 0xff, 0x68, 0x7d, 0xb5, 0xff, 0x5d, 0x6f, 0xae, 0xff, 0x68, 0x7c, 0xbb, 0xff, 0x6d, 0x85, 0xbe, 0xff, 0x78, 0x8d, 0xc4, 0xff, 0x86, 0x9a, 0xc8, 0xff, 0x8d, 0xa2, 0xcc, 0xff, 0x80, 0x92, 0xc8, 0xff, 0x6e, 0x7a, 0xba, 0xff, 0x6e, 0x75, 0xb8, 0xff, 0x55, 0x67, 0xb1, 0xff, 0x72, 0x85, 0xd3, 0xff, 0x9c, 0xa4, 0xd6, 0xff, 0x21, 0x22, 0x25, 0xff, 0x0e, 0x0a, 0x00, 0xff, 0x18, 0x14, 0x11, 0xff, 0x19, 0x14, 0x13, 0xff, 0x19, 0x13, 0x12, 0xff, 0x1d, 0x17, 0x16, 0xff, 0x1b, 0x14, 0x14, 0xff, 0x24, 0x1d, 0x1d, 0xff, 0x25, 0x1e, 0x1e, 0xff, 0x1f, 0x19, 0x18, 0xff, 0x1b, 0x16, 0x15, 0xff, 0x19, 0x14, 0x13, 0xff, 0x15, 0x10, 0x10, 0xff, 0x0e, 0x09, 0x09, 0xff, 0x15, 0x11, 0x10, 0xff, 0x20, 0x1a, 0x1b, 0xff, 0x1b, 0x13, 0x19, 0xff, 0x0a, 0x02, 0x08, 0xff, 0x47, 0x3e, 0x46, 0xff, 0xe7, 0xe1, 0xe9, 0xff, 0xfc, 0xf4, 0xff, 0xff, 0xf8, 0xed, 0xfd, 0xff, 0xf0, 0xe6, 0xf8, 0xff, 0xe0, 0xd7, 0xdc, 0xff, 0xbe, 0xb5, 0xa4, 0xff, 0x93, 0x89, 0x69, 0xff, 0x8f, 0x84, 0x60, 0xff, 0x94, 0x8a, 0x64, 0xff, 0x94, 0x8a, 0x63, 0xff, 0x90, 0x88, 0x5f, 0xff, 0x8d, 0x84, 0x5e, 0xff, 0x8b, 0x81, 0x5d, 0xff, 0x90, 0x82, 0x64, 0xff, 0x9f, 0x91, 0x74, 0xff, 0xa7, 0x98, 0x7c, 0xff, 0xaa, 0x9c, 0x7d, 0xff, 0xa5, 0x99, 0x78, 0xff, 0xa6, 0x9a, 0x7e, 0xff, 0xad, 0xa3, 0x88, 0xff, 0xac, 0xa5, 0x8e, 0xff, 0xab, 0xa4, 0x90, 0xff, 0xa6, 0xa0, 0x89, 0xff, 0x9c, 0x95, 0x74, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x92, 0x80, 0x8d, 0x96, 0x91, 0x77, 0xff, 0x96, 0x91, 0x74, 0xff, 0x94, 0x8d, 0x72, 0xff, 0x92, 0x89, 0x6e, 0xff, 0x8d, 0x82, 0x67, 0xff, 0x8a, 0x81, 0x63, 0xff, 0x88, 0x80, 0x5e, 0xff, 0x8a, 0x82, 0x5c, 0xff, 0x8a, 0x81, 0x5a, 0xff, 0x81, 0x78, 0x53, 0xff, 0x7d, 0x72, 0x4e, 0xff, 0x7a, 0x73, 0x53, 0xff, 0x77, 0x71, 0x56, 0xff, 0x7a, 0x70, 0x56, 0xff, 0x6d, 0x63, 0x42, 0xff, 0xa9, 0xa2, 0x8f, 0xff, 0xd9, 0xd9, 0xf1, 0xff, 0xb8, 0xb9, 0xe6, 0xff, 0xb9, 0xb9, 0xdd, 0xff, 0xba, 0xba, 0xdc, 0xff, 0xb6, 0xb6, 0xd9, 0xff, 0xaf, 0xb1, 0xd3, 0xff, 0xa9, 0xaf, 0xd1, 0xff, 0xa7, 0xae, 0xd0, 0xff, 0xa6, 0xad, 0xd0, 0xff, 0xa6, 0xab, 0xcf, 0xff, 0xa7, 0xad, 0xd0, 0xff, 0xa8, 0xae, 0xd2, 0xff, 0xa8, 0xae, 0xd4, 0xff, 0xa8, 0xae, 0xd3, 0xff, 0xa8, 0xae, 0xd3, 0xff, 0xa7, 0xaf, 0xd4, 0xff, 0xa7, 0xb0, 0xd4, 0xff, 0xa6, 0xb1, 0xd5, 0xff, 0xa5, 0xb1, 0xd6, 0xff, 0xa5, 0xb2, 0xd6, 0xff, 0xa6, 0xb3, 0xd6, 0xff, 0xa7, 0xb1, 0xd6, 0xff, 0xa7, 0xaf, 0xd4, 0xff, 0xa5, 0xae, 0xd3, 0xff, 0xa6, 0xae, 0xd3, 0xff, 0xa7, 0xb0, 0xd5, 0xff, 0xa6, 0xae, 0xd3, 0xff, 0xa3, 0xab, 0xd1, 0xff, 0x9f, 0xaa, 0xd2, 0xff, 0x9f, 0xa9, 0xd1, 0xff, 0x9e, 0xa8, 0xd0, 0xff, 0x9b, 0xa6, 0xce, 0xff, 0x98, 0xa3, 0xcc, 0xff, 0x93, 0xa2, 0xc9, 0xff, 0x8e, 0x9f, 0xc8, 0xff, 0x8a, 0x99, 0xc6, 0xff, 0x85, 0x96, 0xc3, 0xff, 0x7f, 0x8c, 0xb6, 0xff, 0x65, 0x6e, 0x96, 0xff, 0x4c, 0x53, 0x7a, 0xff, 0x40, 0x3f, 0x5c, 0xff, 0x38, 0x36, 0x4d, 0xff, 0x2c, 0x32, 0x4e, 0xff, 0x55, 0x60, 0x83, 0xff, 0x87, 0x98, 0xbc, 0xff, 0x80, 0x94, 0xb8, 0xff, 0x80, 0x93, 0xbb, 0xff, 0x7a, 0x8f, 0xb9, 0xff, 0x72, 0x8a, 0xb5, 0xff, 0x6c, 0x86, 0xb6, 0xff, 0x7c, 0x95, 0xca, 0xff, 0x52, 0x65, 0x9f, 0xff, 0x33, 0x47, 0x83, 0xff, 0x69, 0x7d, 0xb5, 0xff, 0x7e, 0x94, 0xcc, 0xff, 0x7e, 0x90, 0xcb, 0xff, 0x87, 0x9a, 0xce, 0xff, 0x93, 0xa6, 0xd4, 0xff, 0x8f, 0x9c, 0xd0, 0xff, 0x7c, 0x85, 0xc4, 0xff, 0x71, 0x78, 0xbc, 0xff, 0x61, 0x71, 0xb3, 0xff, 0x72, 0x80, 0xcb, 0xff, 0x95, 0x9d, 0xd4, 0xff, 0x24, 0x2d, 0x2f, 0xff, 0x0f, 0x0e, 0x02, 0xff, 0x18, 0x10, 0x12, 0xff, 0x1d, 0x14, 0x15, 0xff, 0x1f, 0x16, 0x16, 0xff, 0x1b, 0x13, 0x13, 0xff, 0x1e, 0x15, 0x16, 0xff, 0x2e, 0x25, 0x26, 0xff, 0x23, 0x19, 0x1a, 0xff, 0x1f, 0x19, 0x18, 0xff, 0x19, 0x15, 0x13, 0xff, 0x19, 0x14, 0x13, 0xff, 0x16, 0x11, 0x10, 0xff, 0x10, 0x0b, 0x0c, 0xff, 0x18, 0x13, 0x15, 0xff, 0x1b, 0x16, 0x18, 0xff, 0x1d, 0x19, 0x1b, 0xff, 0x09, 0x03, 0x08, 0xff, 0x96, 0x90, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf3, 0xfd, 0xff, 0xf8, 0xed, 0xfd, 0xff, 0xee, 0xe1, 0xf5, 0xff, 0xe8, 0xdb, 0xe2, 0xff, 0xcd, 0xc3, 0xb2, 0xff, 0x9e, 0x96, 0x72, 0xff, 0x92, 0x8a, 0x5e, 0xff, 0x9b, 0x90, 0x65, 0xff, 0x9b, 0x8f, 0x62, 0xff, 0x95, 0x8b, 0x5b, 0xff, 0x8f, 0x85, 0x58, 0xff, 0x83, 0x78, 0x4e, 0xff, 0x87, 0x7b, 0x55, 0xff, 0x98, 0x8a, 0x68, 0xff, 0x9f, 0x91, 0x71, 0xff, 0xaf, 0xa2, 0x80, 0xff, 0xae, 0xa3, 0x7e, 0xff, 0xa5, 0x9a, 0x77, 0xff, 0xa8, 0x9f, 0x7e, 0xff, 0xad, 0xa5, 0x88, 0xff, 0xb1, 0xaa, 0x90, 0xff, 0xaa, 0xa3, 0x8c, 0xff, 0xaa, 0xa2, 0x84, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x95, 0x78, 0xd7, 0x98, 0x90, 0x6d, 0xff, 0x93, 0x8c, 0x66, 0xff, 0x8e, 0x87, 0x62, 0xff, 0x8f, 0x87, 0x60, 0xff, 0x90, 0x87, 0x5e, 0xff, 0x91, 0x87, 0x60, 0xff, 0x93, 0x8c, 0x63, 0xff, 0x93, 0x8d, 0x64, 0xff, 0x94, 0x8c, 0x65, 0xff, 0x8d, 0x85, 0x62, 0xff, 0x89, 0x7e, 0x61, 0xff, 0x7f, 0x76, 0x5f, 0xff, 0x7f, 0x77, 0x54, 0xff, 0x76, 0x6c, 0x48, 0xff, 0x90, 0x87, 0x7d, 0xff, 0xe0, 0xd8, 0xe9, 0xff, 0xc1, 0xbd, 0xe2, 0xff, 0xb7, 0xb6, 0xdc, 0xff, 0xb8, 0xb8, 0xda, 0xff, 0xb7, 0xb8, 0xda, 0xff, 0xb4, 0xb7, 0xd8, 0xff, 0xae, 0xb1, 0xd5, 0xff, 0xa7, 0xac, 0xd1, 0xff, 0xa3, 0xaa, 0xcf, 0xff, 0xa2, 0xaa, 0xcd, 0xff, 0xa4, 0xae, 0xce, 0xff, 0xa7, 0xb0, 0xd1, 0xff, 0xa6, 0xaf, 0xd1, 0xff, 0xa6, 0xae, 0xd3, 0xff, 0xa7, 0xaf, 0xd4, 0xff, 0xa7, 0xaf, 0xd4, 0xff, 0xa7, 0xb0, 0xd5, 0xff, 0xa6, 0xb1, 0xd5, 0xff, 0xa4, 0xb2, 0xd5, 0xff, 0xa7, 0xb3, 0xd7, 0xff, 0xa8, 0xb4, 0xd7, 0xff, 0xa6, 0xb2, 0xd6, 0xff, 0xa7, 0xb2, 0xd7, 0xff, 0xa8, 0xb1, 0xd7, 0xff, 0xa4, 0xae, 0xd4, 0xff, 0xa3, 0xad, 0xd3, 0xff, 0xa3, 0xad, 0xd3, 0xff, 0xa3, 0xab, 0xd1, 0xff, 0x9f, 0xa9, 0xcf, 0xff, 0x9d, 0xa9, 0xd1, 0xff, 0x9c, 0xa8, 0xd1, 0xff, 0x99, 0xa4, 0xcc, 0xff, 0x95, 0xa2, 0xc9, 0xff, 0x94, 0xa3, 0xca, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x8b, 0x9d, 0xc5, 0xff, 0x87, 0x98, 0xc4, 0xff, 0x80, 0x91, 0xbd, 0xff, 0x7a, 0x8a, 0xb4, 0xff, 0x6a, 0x77, 0xa1, 0xff, 0x57, 0x61, 0x87, 0xff, 0x47, 0x49, 0x65, 0xff, 0x37, 0x37, 0x51, 0xff, 0x45, 0x4b, 0x6b, 0xff, 0x68, 0x74, 0x9a, 0xff, 0x8e, 0x9b, 0xc4, 0xff, 0x85, 0x96, 0xbf, 0xff, 0x80, 0x95, 0xbc, 0xff, 0x7e, 0x93, 0xbc, 0xff, 0x73, 0x89, 0xb6, 0xff, 0x67, 0x7f, 0xae, 0xff, 0x73, 0x8a, 0xbe, 0xff, 0x57, 0x6a, 0xa6, 0xff, 0x21, 0x33, 0x71, 0xff, 0x29, 0x3d, 0x7a, 0xff, 0x40, 0x54, 0x94, 0xff, 0x68, 0x79, 0xba, 0xff, 0x82, 0x91, 0xcb, 0xff, 0x8d, 0x9e, 0xd1, 0xff, 0x94, 0xa5, 0xd4, 0xff, 0x84, 0x91, 0xca, 0xff, 0x75, 0x7b, 0xbe, 0xff, 0x66, 0x75, 0xb8, 0xff, 0x70, 0x7f, 0xc8, 0xff, 0x8c, 0x91, 0xc6, 0xff, 0x23, 0x26, 0x2c, 0xff, 0x11, 0x0d, 0x05, 0xff, 0x18, 0x0f, 0x11, 0xff, 0x1a, 0x12, 0x12, 0xff, 0x1e, 0x15, 0x15, 0xff, 0x20, 0x17, 0x17, 0xff, 0x1e, 0x15, 0x15, 0xff, 0x25, 0x1c, 0x1c, 0xff, 0x29, 0x20, 0x20, 0xff, 0x1f, 0x19, 0x18, 0xff, 0x20, 0x1b, 0x1a, 0xff, 0x1b, 0x16, 0x15, 0xff, 0x15, 0x10, 0x10, 0xff, 0x16, 0x11, 0x13, 0xff, 0x1f, 0x19, 0x1a, 0xff, 0x1e, 0x18, 0x18, 0xff, 0x0a, 0x08, 0x0a, 0xff, 0x3b, 0x39, 0x3d, 0xff, 0xef, 0xec, 0xf1, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf9, 0xf3, 0xfc, 0xff, 0xf2, 0xe9, 0xf6, 0xff, 0xef, 0xe3, 0xf0, 0xff, 0xe9, 0xdc, 0xdb, 0xff, 0xcb, 0xbf, 0xa8, 0xff, 0xa1, 0x97, 0x6e, 0xff, 0x96, 0x8d, 0x5e, 0xff, 0x9e, 0x93, 0x65, 0xff, 0x9f, 0x94, 0x63, 0xff, 0x9a, 0x90, 0x5c, 0xff, 0x96, 0x8c, 0x5b, 0xff, 0x87, 0x7b, 0x4d, 0xff, 0x82, 0x74, 0x4b, 0xff, 0x8e, 0x80, 0x5a, 0xff, 0x98, 0x89, 0x65, 0xff, 0xab, 0x9c, 0x75, 0xff, 0xb2, 0xa5, 0x79, 0xff, 0xa9, 0x9f, 0x71, 0xff, 0xa8, 0x9f, 0x73, 0xff, 0xaa, 0xa0, 0x79, 0xff, 0xb1, 0xa8, 0x84, 0xff, 0xae, 0xa6, 0x84, 0xff, 0xab, 0xa2, 0x82, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x93, 0x93, 0x6b, 0x1a, 0x9a, 0x8f, 0x6a, 0xff, 0x96, 0x8d, 0x63, 0xff, 0x93, 0x8d, 0x5e, 0xff, 0x93, 0x8e, 0x5d, 0xff, 0x98, 0x92, 0x63, 0xff, 0x9c, 0x93, 0x69, 0xff, 0x9f, 0x92, 0x6e, 0xff, 0x9f, 0x95, 0x70, 0xff, 0x9c, 0x95, 0x70, 0xff, 0x97, 0x91, 0x70, 0xff, 0x8f, 0x88, 0x6c, 0xff, 0x85, 0x7b, 0x67, 0xff, 0x7b, 0x70, 0x5f, 0xff, 0x82, 0x7a, 0x50, 0xff, 0x7e, 0x79, 0x50, 0xff, 0xc7, 0xbf, 0xc5, 0xff, 0xd1, 0xca, 0xf6, 0xff, 0xb6, 0xb3, 0xe2, 0xff, 0xb6, 0xba, 0xd9, 0xff, 0xb4, 0xb8, 0xd9, 0xff, 0xb4, 0xb7, 0xda, 0xff, 0xb0, 0xb5, 0xd7, 0xff, 0xac, 0xb0, 0xd5, 0xff, 0xa7, 0xac, 0xd2, 0xff, 0xa1, 0xa7, 0xcc, 0xff, 0x9e, 0xa6, 0xca, 0xff, 0xa2, 0xab, 0xce, 0xff, 0xa5, 0xae, 0xd1, 0xff, 0xa5, 0xae, 0xd2, 0xff, 0xa8, 0xaf, 0xd5, 0xff, 0xa9, 0xb1, 0xd7, 0xff, 0xab, 0xb3, 0xd8, 0xff, 0xaa, 0xb3, 0xd8, 0xff, 0xa7, 0xb3, 0xd7, 0xff, 0xa4, 0xb2, 0xd7, 0xff, 0xa5, 0xb2, 0xd7, 0xff, 0xa5, 0xb2, 0xd6, 0xff, 0xa5, 0xb1, 0xd6, 0xff, 0xa3, 0xaf, 0xd5, 0xff, 0xa2, 0xae, 0xd4, 0xff, 0xa0, 0xac, 0xd3, 0xff, 0x9e, 0xab, 0xd1, 0xff, 0x9e, 0xaa, 0xd0, 0xff, 0x9d, 0xa9, 0xcf, 0xff, 0x9b, 0xa8, 0xce, 0xff, 0x9b, 0xa7, 0xcf, 0xff, 0x99, 0xa6, 0xcd, 0xff, 0x94, 0xa1, 0xca, 0xff, 0x92, 0xa1, 0xc9, 0xff, 0x92, 0xa2, 0xca, 0xff, 0x8d, 0x9d, 0xc5, 0xff, 0x88, 0x98, 0xc2, 0xff, 0x85, 0x96, 0xc1, 0xff, 0x7f, 0x90, 0xbb, 0xff, 0x77, 0x86, 0xb2, 0xff, 0x6b, 0x78, 0xa3, 0xff, 0x60, 0x6c, 0x92, 0xff, 0x48, 0x4e, 0x6e, 0xff, 0x37, 0x39, 0x57, 0xff, 0x57, 0x5f, 0x83, 0xff, 0x70, 0x7e, 0xa8, 0xff, 0x8c, 0x9a, 0xc7, 0xff, 0x87, 0x97, 0xc2, 0xff, 0x83, 0x96, 0xbf, 0xff, 0x83, 0x95, 0xbd, 0xff, 0x80, 0x93, 0xbd, 0xff, 0x6c, 0x82, 0xb3, 0xff, 0x67, 0x7d, 0xb2, 0xff, 0x63, 0x75, 0xb4, 0xff, 0x32, 0x43, 0x86, 0xff, 0x39, 0x4c, 0x8a, 0xff, 0x3a, 0x4d, 0x8e, 0xff, 0x44, 0x53, 0x98, 0xff, 0x63, 0x74, 0xb3, 0xff, 0x84, 0x96, 0xcc, 0xff, 0x99, 0xa9, 0xd7, 0xff, 0x89, 0x95, 0xca, 0xff, 0x78, 0x7e, 0xbf, 0xff, 0x68, 0x76, 0xb7, 0xff, 0x80, 0x8e, 0xd5, 0xff, 0x88, 0x8d, 0xbe, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x15, 0x0f, 0x0b, 0xff, 0x19, 0x0f, 0x13, 0xff, 0x19, 0x12, 0x12, 0xff, 0x1d, 0x16, 0x16, 0xff, 0x1b, 0x14, 0x14, 0xff, 0x18, 0x11, 0x11, 0xff, 0x1e, 0x17, 0x16, 0xff, 0x24, 0x1d, 0x1c, 0xff, 0x1f, 0x19, 0x18, 0xff, 0x29, 0x25, 0x24, 0xff, 0x21, 0x1c, 0x1b, 0xff, 0x15, 0x10, 0x10, 0xff, 0x1a, 0x16, 0x15, 0xff, 0x21, 0x1c, 0x1c, 0xff, 0x1c, 0x18, 0x1c, 0xff, 0x04, 0x00, 0x08, 0xff, 0x8f, 0x8b, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xed, 0xfd, 0xff, 0xf0, 0xe8, 0xf5, 0xff, 0xeb, 0xe4, 0xee, 0xff, 0xef, 0xe2, 0xe6, 0xff, 0xd8, 0xcb, 0xc0, 0xff, 0xb2, 0xa7, 0x85, 0xff, 0x9d, 0x93, 0x63, 0xff, 0xa1, 0x97, 0x63, 0xff, 0xa3, 0x99, 0x66, 0xff, 0xa4, 0x99, 0x65, 0xff, 0xa0, 0x96, 0x5f, 0xff, 0x9b, 0x90, 0x5c, 0xff, 0x8f, 0x83, 0x51, 0xff, 0x84, 0x78, 0x49, 0xff, 0x8f, 0x81, 0x55, 0xff, 0x9d, 0x8f, 0x65, 0xff, 0xaa, 0x9b, 0x6e, 0xff, 0xaa, 0x9c, 0x6b, 0xff, 0xa5, 0x9a, 0x65, 0xff, 0xa6, 0x9c, 0x67, 0xff, 0xa8, 0x9c, 0x6c, 0xff, 0xaa, 0x9f, 0x71, 0xff, 0xae, 0xa3, 0x7b, 0xff, 0xac, 0xa4, 0x80, 0xff, 0xaa, 0xa0, 0x7a, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x96, 0x8d, 0x5f, 0x58, 0x9a, 0x90, 0x61, 0xff, 0x99, 0x93, 0x62, 0xff, 0x97, 0x93, 0x60, 0xff, 0x9d, 0x98, 0x66, 0xff, 0xa2, 0x9b, 0x71, 0xff, 0xa8, 0x9e, 0x7c, 0xff, 0xab, 0x9e, 0x83, 0xff, 0xa6, 0x9a, 0x7d, 0xff, 0xa0, 0x96, 0x78, 0xff, 0x95, 0x8d, 0x71, 0xff, 0x8e, 0x85, 0x6c, 0xff, 0x88, 0x7d, 0x6a, 0xff, 0x82, 0x76, 0x5f, 0xff, 0x7c, 0x73, 0x48, 0xff, 0x9b, 0x95, 0x7a, 0xff, 0xd2, 0xce, 0xe0, 0xff, 0xac, 0xb2, 0xe2, 0xff, 0xb0, 0xb2, 0xde, 0xff, 0xb1, 0xb4, 0xd2, 0xff, 0xac, 0xb3, 0xd6, 0xff, 0xae, 0xb4, 0xd7, 0xff, 0xaf, 0xb5, 0xd8, 0xff, 0xad, 0xb2, 0xd7, 0xff, 0xa8, 0xae, 0xd3, 0xff, 0xa4, 0xa9, 0xce, 0xff, 0xa1, 0xa8, 0xcd, 0xff, 0x9e, 0xa7, 0xcd, 0xff, 0xa1, 0xaa, 0xce, 0xff, 0xa7, 0xae, 0xd4, 0xff, 0xab, 0xb1, 0xd9, 0xff, 0xac, 0xb2, 0xd9, 0xff, 0xab, 0xb2, 0xda, 0xff, 0xac, 0xb4, 0xda, 0xff, 0xa8, 0xb3, 0xd9, 0xff, 0xa6, 0xb2, 0xd8, 0xff, 0xa3, 0xb1, 0xd7, 0xff, 0xa2, 0xaf, 0xd5, 0xff, 0xa3, 0xb0, 0xd6, 0xff, 0x9f, 0xad, 0xd4, 0xff, 0x9d, 0xac, 0xd1, 0xff, 0x9d, 0xab, 0xd1, 0xff, 0x9c, 0xaa, 0xcf, 0xff, 0x9a, 0xa8, 0xcd, 0xff, 0x98, 0xa6, 0xcc, 0xff, 0x97, 0xa5, 0xcb, 0xff, 0x97, 0xa3, 0xca, 0xff, 0x95, 0xa2, 0xca, 0xff, 0x93, 0xa2, 0xcc, 0xff, 0x91, 0xa1, 0xcc, 0xff, 0x8c, 0x9c, 0xc6, 0xff, 0x89, 0x98, 0xc3, 0xff, 0x86, 0x95, 0xbf, 0xff, 0x82, 0x92, 0xbc, 0xff, 0x7e, 0x90, 0xbb, 0xff, 0x75, 0x86, 0xb2, 0xff, 0x6a, 0x77, 0xa2, 0xff, 0x66, 0x71, 0x9a, 0xff, 0x44, 0x4e, 0x74, 0xff, 0x3d, 0x42, 0x65, 0xff, 0x62, 0x6c, 0x92, 0xff, 0x74, 0x85, 0xb0, 0xff, 0x87, 0x98, 0xc5, 0xff, 0x86, 0x97, 0xc3, 0xff, 0x87, 0x96, 0xc0, 0xff, 0x8a, 0x9a, 0xbf, 0xff, 0x8f, 0xa1, 0xc9, 0xff, 0x89, 0x9e, 0xcf, 0xff, 0x5a, 0x6f, 0xa6, 0xff, 0x5e, 0x6f, 0xb1, 0xff, 0x5a, 0x6a, 0xb2, 0xff, 0x4d, 0x60, 0x9d, 0xff, 0x54, 0x65, 0xa3, 0xff, 0x4f, 0x5e, 0xa6, 0xff, 0x51, 0x63, 0xa8, 0xff, 0x6c, 0x81, 0xba, 0xff, 0x99, 0xa7, 0xd7, 0xff, 0x90, 0x98, 0xcc, 0xff, 0x78, 0x7f, 0xbd, 0xff, 0x6d, 0x7a, 0xb8, 0xff, 0x93, 0x9e, 0xe1, 0xff, 0x77, 0x7c, 0xa8, 0xff, 0x0b, 0x0b, 0x0e, 0xff, 0x1a, 0x13, 0x0f, 0xff, 0x18, 0x11, 0x14, 0xff, 0x1b, 0x17, 0x16, 0xff, 0x1e, 0x19, 0x18, 0xff, 0x19, 0x14, 0x13, 0xff, 0x1a, 0x15, 0x14, 0xff, 0x18, 0x13, 0x12, 0xff, 0x19, 0x14, 0x13, 0xff, 0x26, 0x21, 0x20, 0xff, 0x27, 0x22, 0x21, 0xff, 0x1f, 0x1a, 0x19, 0xff, 0x19, 0x13, 0x13, 0xff, 0x1b, 0x17, 0x15, 0xff, 0x1d, 0x19, 0x17, 0xff, 0x04, 0x00, 0x04, 0xff, 0x4f, 0x46, 0x4f, 0xff, 0xf4, 0xe9, 0xf5, 0xff, 0xfd, 0xf1, 0xff, 0xff, 0xf3, 0xe6, 0xf8, 0xff, 0xea, 0xe1, 0xef, 0xff, 0xe2, 0xda, 0xdd, 0xff, 0xdf, 0xd3, 0xca, 0xff, 0xbc, 0xb1, 0x98, 0xff, 0x9c, 0x93, 0x68, 0xff, 0xa4, 0x9b, 0x64, 0xff, 0xa9, 0xa0, 0x67, 0xff, 0xa8, 0x9d, 0x69, 0xff, 0xa7, 0x9c, 0x68, 0xff, 0xa6, 0x9c, 0x66, 0xff, 0x9e, 0x94, 0x5f, 0xff, 0x91, 0x87, 0x54, 0xff, 0x87, 0x7b, 0x4a, 0xff, 0x8b, 0x7f, 0x4f, 0xff, 0x9b, 0x8e, 0x60, 0xff, 0xa9, 0x9c, 0x6c, 0xff, 0xab, 0x9d, 0x6b, 0xff, 0xac, 0x9e, 0x68, 0xff, 0xab, 0xa0, 0x68, 0xff, 0xa9, 0xa0, 0x69, 0xff, 0xa8, 0x9d, 0x67, 0xff, 0xab, 0x9e, 0x71, 0xff, 0xa9, 0xa1, 0x78, 0xff, 0xa8, 0x9f, 0x76, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x9f, 0x94, 0x64, 0x90, 0xa0, 0x98, 0x66, 0xff, 0x9e, 0x98, 0x66, 0xff, 0xa0, 0x9c, 0x6b, 0xff, 0xa4, 0x9e, 0x75, 0xff, 0xa7, 0x9d, 0x7b, 0xff, 0xa6, 0x9a, 0x80, 0xff, 0xa3, 0x98, 0x83, 0xff, 0xa2, 0x98, 0x7f, 0xff, 0xa1, 0x96, 0x7a, 0xff, 0x9a, 0x90, 0x72, 0xff, 0x92, 0x88, 0x6a, 0xff, 0x85, 0x7a, 0x5d, 0xff, 0x81, 0x79, 0x54, 0xff, 0x88, 0x79, 0x54, 0xff, 0xae, 0x9d, 0x96, 0xff, 0xbf, 0xc2, 0xda, 0xff, 0x96, 0xa9, 0xd3, 0xff, 0x9f, 0xa7, 0xcb, 0xff, 0xa8, 0xa9, 0xc7, 0xff, 0xa7, 0xaf, 0xd2, 0xff, 0xa6, 0xb0, 0xd2, 0xff, 0xab, 0xb3, 0xd6, 0xff, 0xae, 0xb4, 0xd9, 0xff, 0xa9, 0xae, 0xd5, 0xff, 0xa4, 0xaa, 0xd1, 0xff, 0xa0, 0xa8, 0xce, 0xff, 0x9b, 0xa4, 0xc9, 0xff, 0x9e, 0xa7, 0xcc, 0xff, 0xa6, 0xae, 0xd4, 0xff, 0xa8, 0xb0, 0xd7, 0xff, 0xa9, 0xb1, 0xd8, 0xff, 0xaa, 0xb2, 0xd9, 0xff, 0xab, 0xb4, 0xda, 0xff, 0xa9, 0xb3, 0xd9, 0xff, 0xa6, 0xb3, 0xd9, 0xff, 0xa3, 0xb0, 0xd6, 0xff, 0xa1, 0xae, 0xd4, 0xff, 0xa1, 0xad, 0xd3, 0xff, 0x9e, 0xac, 0xd2, 0xff, 0x9c, 0xab, 0xd1, 0xff, 0x99, 0xa9, 0xcf, 0xff, 0x98, 0xa7, 0xcd, 0xff, 0x97, 0xa5, 0xcb, 0xff, 0x95, 0xa4, 0xca, 0xff, 0x94, 0xa4, 0xc9, 0xff, 0x95, 0xa4, 0xc9, 0xff, 0x92, 0xa1, 0xc8, 0xff, 0x8e, 0x9f, 0xc8, 0xff, 0x8a, 0x9b, 0xc6, 0xff, 0x86, 0x96, 0xc1, 0xff, 0x86, 0x97, 0xc2, 0xff, 0x84, 0x95, 0xbf, 0xff, 0x7f, 0x91, 0xba, 0xff, 0x78, 0x8c, 0xb6, 0xff, 0x6d, 0x81, 0xae, 0xff, 0x6c, 0x7d, 0xaa, 0xff, 0x67, 0x76, 0x9f, 0xff, 0x42, 0x4e, 0x73, 0xff, 0x47, 0x50, 0x76, 0xff, 0x6a, 0x78, 0x9f, 0xff, 0x82, 0x94, 0xbd, 0xff, 0x8b, 0x9d, 0xc7, 0xff, 0x8a, 0x9b, 0xc5, 0xff, 0x8b, 0x9b, 0xc2, 0xff, 0x8e, 0x9f, 0xc4, 0xff, 0x96, 0xa7, 0xd0, 0xff, 0x9b, 0xb0, 0xe1, 0xff, 0x3e, 0x54, 0x8b, 0xff, 0x2d, 0x3d, 0x7f, 0xff, 0x56, 0x64, 0xad, 0xff, 0x58, 0x6a, 0xa7, 0xff, 0x65, 0x78, 0xb3, 0xff, 0x5c, 0x6b, 0xb4, 0xff, 0x55, 0x67, 0xaf, 0xff, 0x5a, 0x6c, 0xab, 0xff, 0x8d, 0x9a, 0xcd, 0xff, 0x9c, 0xa4, 0xd9, 0xff, 0x7a, 0x84, 0xc0, 0xff, 0x76, 0x85, 0xbf, 0xff, 0xa4, 0xae, 0xeb, 0xff, 0x63, 0x65, 0x8c, 0xff, 0x02, 0x00, 0x00, 0xff, 0x1a, 0x14, 0x0b, 0xff, 0x1b, 0x16, 0x17, 0xff, 0x19, 0x16, 0x15, 0xff, 0x18, 0x14, 0x12, 0xff, 0x19, 0x15, 0x14, 0xff, 0x19, 0x15, 0x14, 0xff, 0x17, 0x13, 0x12, 0xff, 0x1d, 0x19, 0x18, 0xff, 0x2d, 0x29, 0x28, 0xff, 0x2b, 0x25, 0x24, 0xff, 0x1e, 0x18, 0x17, 0xff, 0x18, 0x13, 0x11, 0xff, 0x1a, 0x16, 0x17, 0xff, 0x09, 0x05, 0x06, 0xff, 0x23, 0x1d, 0x19, 0xff, 0xc8, 0xbe, 0xbb, 0xff, 0xff, 0xf9, 0xfa, 0xff, 0xeb, 0xe0, 0xe3, 0xff, 0xef, 0xe3, 0xe7, 0xff, 0xe7, 0xde, 0xdd, 0xff, 0xda, 0xd1, 0xc9, 0xff, 0xcd, 0xc4, 0xa9, 0xff, 0xb1, 0xa8, 0x80, 0xff, 0xa3, 0x99, 0x65, 0xff, 0xac, 0xa1, 0x65, 0xff, 0xac, 0xa2, 0x68, 0xff, 0xac, 0xa0, 0x6d, 0xff, 0xab, 0x9e, 0x6e, 0xff, 0xaa, 0x9d, 0x6a, 0xff, 0xa4, 0x97, 0x65, 0xff, 0x96, 0x89, 0x58, 0xff, 0x8c, 0x80, 0x4f, 0xff, 0x8e, 0x82, 0x52, 0xff, 0x99, 0x8c, 0x5e, 0xff, 0xac, 0x9e, 0x70, 0xff, 0xb5, 0xa6, 0x76, 0xff, 0xb0, 0xa3, 0x6f, 0xff, 0xae, 0xa3, 0x6b, 0xff, 0xae, 0xa4, 0x68, 0xff, 0xaf, 0xa5, 0x68, 0xff, 0xab, 0xa1, 0x6a, 0xff, 0xa8, 0x9f, 0x71, 0xff, 0xa8, 0x9f, 0x78, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xa6, 0x9a, 0x69, 0xc6, 0xa7, 0x9f, 0x6f, 0xff, 0xaa, 0xa2, 0x77, 0xff, 0xa7, 0xa0, 0x79, 0xff, 0xa4, 0x9c, 0x7a, 0xff, 0xa1, 0x98, 0x7b, 0xff, 0xa2, 0x97, 0x7f, 0xff, 0xa1, 0x99, 0x82, 0xff, 0xa3, 0x9b, 0x7c, 0xff, 0xa1, 0x99, 0x73, 0xff, 0x9b, 0x91, 0x69, 0xff, 0x91, 0x87, 0x5d, 0xff, 0x86, 0x7e, 0x53, 0xff, 0x91, 0x89, 0x5e, 0xff, 0xa1, 0x90, 0x6e, 0xff, 0xa9, 0x9c, 0x8f, 0xff, 0xaf, 0xb6, 0xc2, 0xff, 0x8c, 0x9e, 0xc2, 0xff, 0x8a, 0x9a, 0xbe, 0xff, 0x8b, 0x95, 0xb9, 0xff, 0x9f, 0xa8, 0xca, 0xff, 0xab, 0xb2, 0xd1, 0xff, 0xa6, 0xaf, 0xce, 0xff, 0xa8, 0xb1, 0xd7, 0xff, 0xa9, 0xb1, 0xd9, 0xff, 0xa4, 0xab, 0xd3, 0xff, 0x9d, 0xa5, 0xcb, 0xff, 0x9b, 0xa4, 0xc9, 0xff, 0x9c, 0xa6, 0xca, 0xff, 0xa2, 0xac, 0xd1, 0xff, 0xa7, 0xb1, 0xd6, 0xff, 0xa8, 0xb2, 0xd7, 0xff, 0xa8, 0xb2, 0xd7, 0xff, 0xa9, 0xb2, 0xd8, 0xff, 0xa6, 0xb1, 0xd7, 0xff, 0xa4, 0xb0, 0xd6, 0xff, 0xa1, 0xaf, 0xd5, 0xff, 0x9f, 0xad, 0xd3, 0xff, 0x9f, 0xab, 0xd1, 0xff, 0x9a, 0xa9, 0xcf, 0xff, 0x97, 0xa7, 0xcf, 0xff, 0x94, 0xa4, 0xcb, 0xff, 0x93, 0xa3, 0xcb, 0xff, 0x93, 0xa3, 0xcb, 0xff, 0x91, 0xa1, 0xc9, 0xff, 0x91, 0xa1, 0xc9, 0xff, 0x90, 0xa1, 0xc7, 0xff, 0x8c, 0x9d, 0xc6, 0xff, 0x89, 0x9a, 0xc4, 0xff, 0x87, 0x99, 0xc4, 0xff, 0x87, 0x98, 0xc3, 0xff, 0x83, 0x94, 0xbf, 0xff, 0x82, 0x93, 0xbd, 0xff, 0x81, 0x94, 0xbd, 0xff, 0x77, 0x8b, 0xb6, 0xff, 0x6a, 0x7f, 0xaa, 0xff, 0x68, 0x7c, 0xa9, 0xff, 0x61, 0x72, 0x9c, 0xff, 0x48, 0x58, 0x80, 0xff, 0x5d, 0x6b, 0x93, 0xff, 0x71, 0x81, 0xa9, 0xff, 0x89, 0x9c, 0xc5, 0xff, 0x8c, 0x9e, 0xc8, 0xff, 0x8b, 0x9d, 0xc5, 0xff, 0x89, 0x9b, 0xc1, 0xff, 0x8a, 0x9c, 0xc0, 0xff, 0x96, 0xa9, 0xd2, 0xff, 0x86, 0x9c, 0xcc, 0xff, 0x3b, 0x50, 0x89, 0xff, 0x2c, 0x3e, 0x82, 0xff, 0x37, 0x47, 0x91, 0xff, 0x48, 0x5a, 0x9e, 0xff, 0x52, 0x63, 0xa3, 0xff, 0x5c, 0x6a, 0xb5, 0xff, 0x61, 0x71, 0xbb, 0xff, 0x56, 0x67, 0xa7, 0xff, 0x84, 0x91, 0xc6, 0xff, 0x99, 0xa3, 0xd8, 0xff, 0x7d, 0x86, 0xc1, 0xff, 0x7e, 0x8f, 0xc7, 0xff, 0xa4, 0xae, 0xe6, 0xff, 0x44, 0x43, 0x62, 0xff, 0x03, 0x00, 0x00, 0xff, 0x1e, 0x16, 0x0f, 0xff, 0x1e, 0x1a, 0x1b, 0xff, 0x17, 0x14, 0x13, 0xff, 0x17, 0x13, 0x12, 0xff, 0x18, 0x15, 0x14, 0xff, 0x17, 0x13, 0x12, 0xff, 0x1c, 0x18, 0x17, 0xff, 0x1b, 0x18, 0x16, 0xff, 0x26, 0x1f, 0x20, 0xff, 0x27, 0x20, 0x21, 0xff, 0x1b, 0x17, 0x16, 0xff, 0x19, 0x16, 0x17, 0xff, 0x11, 0x0d, 0x12, 0xff, 0x05, 0x00, 0x00, 0xff, 0x7d, 0x74, 0x66, 0xff, 0xe6, 0xdc, 0xc6, 0xff, 0xdd, 0xd3, 0xc2, 0xff, 0xe1, 0xd4, 0xc8, 0xff, 0xe3, 0xd6, 0xca, 0xff, 0xd4, 0xcb, 0xbb, 0xff, 0xd2, 0xc9, 0xb1, 0xff, 0xc3, 0xba, 0x96, 0xff, 0xab, 0xa2, 0x75, 0xff, 0xaa, 0x9f, 0x68, 0xff, 0xb0, 0xa4, 0x68, 0xff, 0xb0, 0xa5, 0x6a, 0xff, 0xb0, 0xa3, 0x6e, 0xff, 0xae, 0x9f, 0x6f, 0xff, 0xac, 0x9d, 0x6d, 0xff, 0xa7, 0x98, 0x69, 0xff, 0x98, 0x89, 0x5b, 0xff, 0x8c, 0x80, 0x50, 0xff, 0x8e, 0x82, 0x53, 0xff, 0x9c, 0x8f, 0x61, 0xff, 0xb1, 0xa3, 0x75, 0xff, 0xbc, 0xad, 0x7f, 0xff, 0xb9, 0xac, 0x7b, 0xff, 0xb6, 0xa9, 0x77, 0xff, 0xb1, 0xa4, 0x6e, 0xff, 0xb1, 0xa5, 0x6c, 0xff, 0xae, 0xa2, 0x6b, 0xff, 0xa8, 0x9d, 0x6c, 0xff, 0xa2, 0x98, 0x72, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x01, 0xa9, 0xa3, 0x70, 0xf2, 0xaa, 0xa3, 0x77, 0xff, 0xa9, 0x9e, 0x7c, 0xff, 0xa4, 0x99, 0x7d, 0xff, 0xa0, 0x98, 0x7b, 0xff, 0xa1, 0x99, 0x78, 0xff, 0xa3, 0x9b, 0x79, 0xff, 0xa0, 0x99, 0x75, 0xff, 0xa1, 0x99, 0x6e, 0xff, 0xa5, 0x9b, 0x69, 0xff, 0xa6, 0x98, 0x67, 0xff, 0x9d, 0x91, 0x5f, 0xff, 0x9b, 0x91, 0x65, 0xff, 0x9e, 0x92, 0x71, 0xff, 0xa4, 0x9a, 0x76, 0xff, 0xa7, 0xa3, 0x84, 0xff, 0xb5, 0xb0, 0xa9, 0xff, 0x9a, 0x9e, 0xb8, 0xff, 0x79, 0x8a, 0xb3, 0xff, 0x6c, 0x82, 0xb1, 0xff, 0x6c, 0x7e, 0xa9, 0xff, 0x94, 0x98, 0xba, 0xff, 0xaf, 0xb5, 0xd7, 0xff, 0x9d, 0xad, 0xd6, 0xff, 0x9c, 0xaa, 0xd3, 0xff, 0xa1, 0xa8, 0xcf, 0xff, 0x9c, 0xa3, 0xc9, 0xff, 0x99, 0xa1, 0xc6, 0xff, 0x97, 0xa2, 0xc7, 0xff, 0x9e, 0xaa, 0xcf, 0xff, 0xa5, 0xb0, 0xd5, 0xff, 0xa6, 0xb1, 0xd6, 0xff, 0xa5, 0xb1, 0xd5, 0xff, 0xa6, 0xb2, 0xd6, 0xff, 0xa5, 0xb0, 0xd5, 0xff, 0xa4, 0xae, 0xd4, 0xff, 0x9d, 0xab, 0xd2, 0xff, 0x9c, 0xac, 0xd3, 0xff, 0x9b, 0xaa, 0xd1, 0xff, 0x97, 0xa6, 0xcd, 0xff, 0x96, 0xa5, 0xcc, 0xff, 0x92, 0xa4, 0xca, 0xff, 0x90, 0xa2, 0xca, 0xff, 0x90, 0x9f, 0xcc, 0xff, 0x8d, 0x9d, 0xc9, 0xff, 0x8c, 0x9d, 0xc9, 0xff, 0x8b, 0x9c, 0xc8, 0xff, 0x89, 0x9b, 0xc7, 0xff, 0x87, 0x98, 0xc4, 0xff, 0x88, 0x99, 0xc4, 0xff, 0x88, 0x99, 0xc4, 0xff, 0x83, 0x94, 0xbf, 0xff, 0x82, 0x92, 0xbe, 0xff, 0x81, 0x92, 0xbd, 0xff, 0x7a, 0x8b, 0xb6, 0xff, 0x71, 0x82, 0xad, 0xff, 0x6d, 0x7e, 0xa9, 0xff, 0x5a, 0x6b, 0x96, 0xff, 0x4b, 0x5d, 0x87, 0xff, 0x65, 0x77, 0xa0, 0xff, 0x77, 0x89, 0xb2, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x89, 0x9a, 0xc5, 0xff, 0x8a, 0x9b, 0xc5, 0xff, 0x87, 0x98, 0xc2, 0xff, 0x80, 0x96, 0xba, 0xff, 0x8d, 0xa5, 0xcd, 0xff, 0x78, 0x8d, 0xc2, 0xff, 0x45, 0x58, 0x98, 0xff, 0x3f, 0x53, 0x98, 0xff, 0x3e, 0x51, 0x98, 0xff, 0x40, 0x50, 0xa1, 0xff, 0x42, 0x4e, 0x9e, 0xff, 0x57, 0x65, 0xad, 0xff, 0x66, 0x77, 0xb7, 0xff, 0x63, 0x72, 0xac, 0xff, 0x8e, 0x9c, 0xd3, 0xff, 0x8f, 0x9d, 0xd1, 0xff, 0x7e, 0x88, 0xbf, 0xff, 0x95, 0xa3, 0xe1, 0xff, 0x89, 0x95, 0xc3, 0xff, 0x17, 0x14, 0x24, 0xff, 0x14, 0x0d, 0x07, 0xff, 0x1f, 0x19, 0x1a, 0xff, 0x1d, 0x1b, 0x1d, 0xff, 0x15, 0x12, 0x10, 0xff, 0x1a, 0x16, 0x15, 0xff, 0x17, 0x13, 0x12, 0xff, 0x1c, 0x17, 0x16, 0xff, 0x29, 0x24, 0x23, 0xff, 0x1c, 0x18, 0x17, 0xff, 0x22, 0x16, 0x18, 0xff, 0x1f, 0x18, 0x16, 0xff, 0x18, 0x1c, 0x19, 0xff, 0x14, 0x13, 0x1b, 0xff, 0x13, 0x0b, 0x10, 0xff, 0x57, 0x49, 0x39, 0xff, 0xa7, 0x9c, 0x78, 0xff, 0xb9, 0xaf, 0x84, 0xff, 0xc2, 0xb5, 0x92, 0xff, 0xc7, 0xb8, 0x9c, 0xff, 0xc3, 0xb5, 0x9a, 0xff, 0xbf, 0xb1, 0x96, 0xff, 0xbe, 0xb1, 0x96, 0xff, 0xb3, 0xa6, 0x86, 0xff, 0xad, 0xa2, 0x77, 0xff, 0xaf, 0xa6, 0x71, 0xff, 0xaf, 0xa6, 0x6a, 0xff, 0xb2, 0xa7, 0x6b, 0xff, 0xb2, 0xa5, 0x6d, 0xff, 0xb1, 0xa3, 0x6e, 0xff, 0xad, 0x9f, 0x6c, 0xff, 0xa6, 0x98, 0x67, 0xff, 0x99, 0x8a, 0x5d, 0xff, 0x88, 0x7a, 0x4d, 0xff, 0x8b, 0x7e, 0x50, 0xff, 0xa0, 0x92, 0x63, 0xff, 0xb0, 0xa3, 0x74, 0xff, 0xba, 0xad, 0x7f, 0xff, 0xbc, 0xb0, 0x82, 0xff, 0xbd, 0xaf, 0x83, 0xff, 0xbb, 0xab, 0x7d, 0xff, 0xb7, 0xa8, 0x77, 0xff, 0xb1, 0xa2, 0x71, 0xff, 0xa9, 0x9e, 0x70, 0xff, 0xa4, 0x96, 0x77, 0xf2, 0xff, 0xff, 0xff, 0x01,
+    0xa2, 0xa2, 0x73, 0x21, 0xa4, 0x9d, 0x74, 0xff, 0xa4, 0x9c, 0x79, 0xff, 0xa7, 0x9b, 0x7c, 0xff, 0xaa, 0x9c, 0x7e, 0xff, 0xa7, 0x9c, 0x79, 0xff, 0xa3, 0x99, 0x71, 0xff, 0x9f, 0x97, 0x6a, 0xff, 0xa3, 0x99, 0x6b, 0xff, 0xa8, 0x9e, 0x6d, 0xff, 0xad, 0xa3, 0x6e, 0xff, 0xaf, 0xa2, 0x71, 0xff, 0xa8, 0x9d, 0x72, 0xff, 0xa0, 0x97, 0x6f, 0xff, 0x9c, 0x94, 0x71, 0xff, 0xa6, 0x9a, 0x7e, 0xff, 0xb2, 0xa6, 0x8d, 0xff, 0xb2, 0xac, 0x91, 0xff, 0xa9, 0xaa, 0x9c, 0xff, 0x92, 0x98, 0xa7, 0xff, 0x70, 0x84, 0xb3, 0xff, 0x30, 0x4d, 0x86, 0xff, 0x32, 0x44, 0x76, 0xff, 0x68, 0x76, 0xa5, 0xff, 0x91, 0xa1, 0xcf, 0xff, 0x95, 0xa3, 0xce, 0xff, 0x97, 0x9e, 0xc9, 0xff, 0x95, 0x9c, 0xc4, 0xff, 0x8e, 0x97, 0xbd, 0xff, 0x94, 0x9f, 0xc5, 0xff, 0x9e, 0xa9, 0xcf, 0xff, 0xa3, 0xae, 0xd4, 0xff, 0xa6, 0xb1, 0xd7, 0xff, 0xa6, 0xb1, 0xd7, 0xff, 0xa4, 0xb0, 0xd4, 0xff, 0xa3, 0xae, 0xd3, 0xff, 0xa1, 0xac, 0xd2, 0xff, 0x9d, 0xab, 0xd1, 0xff, 0x9a, 0xaa, 0xd1, 0xff, 0x98, 0xa7, 0xce, 0xff, 0x96, 0xa5, 0xcc, 0xff, 0x95, 0xa4, 0xcb, 0xff, 0x91, 0xa3, 0xc9, 0xff, 0x8f, 0xa0, 0xc8, 0xff, 0x8e, 0x9e, 0xc9, 0xff, 0x8c, 0x9d, 0xc8, 0xff, 0x8a, 0x9b, 0xc6, 0xff, 0x8b, 0x9c, 0xc7, 0xff, 0x8a, 0x9b, 0xc6, 0xff, 0x88, 0x99, 0xc4, 0xff, 0x88, 0x99, 0xc4, 0xff, 0x87, 0x98, 0xc3, 0xff, 0x86, 0x97, 0xc2, 0xff, 0x84, 0x95, 0xc0, 0xff, 0x80, 0x91, 0xbc, 0xff, 0x7d, 0x8d, 0xb9, 0xff, 0x74, 0x86, 0xb0, 0xff, 0x6f, 0x80, 0xab, 0xff, 0x56, 0x66, 0x92, 0xff, 0x52, 0x64, 0x8e, 0xff, 0x70, 0x82, 0xab, 0xff, 0x7f, 0x91, 0xba, 0xff, 0x86, 0x98, 0xc1, 0xff, 0x87, 0x9a, 0xc2, 0xff, 0x87, 0x98, 0xc3, 0xff, 0x86, 0x95, 0xc2, 0xff, 0x82, 0x95, 0xc2, 0xff, 0x7a, 0x90, 0xbf, 0xff, 0x60, 0x72, 0xa9, 0xff, 0x59, 0x67, 0xa5, 0xff, 0x5a, 0x67, 0xa8, 0xff, 0x50, 0x5d, 0x9f, 0xff, 0x45, 0x51, 0x98, 0xff, 0x44, 0x53, 0x9c, 0xff, 0x58, 0x68, 0xaa, 0xff, 0x5e, 0x6d, 0xab, 0xff, 0x7f, 0x8d, 0xc8, 0xff, 0x98, 0xa5, 0xde, 0xff, 0x79, 0x86, 0xbd, 0xff, 0x86, 0x93, 0xca, 0xff, 0xb0, 0xbe, 0xf2, 0xff, 0x4e, 0x56, 0x77, 0xff, 0x00, 0x00, 0x01, 0xff, 0x1a, 0x14, 0x0e, 0xff, 0x1c, 0x17, 0x16, 0xff, 0x17, 0x16, 0x17, 0xff, 0x15, 0x12, 0x10, 0xff, 0x17, 0x12, 0x11, 0xff, 0x19, 0x15, 0x14, 0xff, 0x22, 0x1d, 0x1c, 0xff, 0x2c, 0x26, 0x25, 0xff, 0x1e, 0x19, 0x19, 0xff, 0x1c, 0x17, 0x12, 0xff, 0x18, 0x18, 0x0e, 0xff, 0x1d, 0x1e, 0x1c, 0xff, 0x0d, 0x09, 0x0b, 0xff, 0x45, 0x3c, 0x31, 0xff, 0xa0, 0x94, 0x6a, 0xff, 0xa3, 0x99, 0x60, 0xff, 0xa6, 0x9b, 0x67, 0xff, 0xb3, 0xa6, 0x78, 0xff, 0xb6, 0xa9, 0x7d, 0xff, 0xb5, 0xaa, 0x80, 0xff, 0xbc, 0xb1, 0x88, 0xff, 0xbb, 0xaf, 0x89, 0xff, 0xb7, 0xaa, 0x85, 0xff, 0xb1, 0xa4, 0x7c, 0xff, 0xb2, 0xa6, 0x75, 0xff, 0xb3, 0xa7, 0x6e, 0xff, 0xb4, 0xa8, 0x6c, 0xff, 0xb5, 0xa7, 0x71, 0xff, 0xb4, 0xa6, 0x72, 0xff, 0xaf, 0xa3, 0x6c, 0xff, 0xa8, 0x9c, 0x67, 0xff, 0x99, 0x8c, 0x59, 0xff, 0x89, 0x7b, 0x49, 0xff, 0x8b, 0x7d, 0x4c, 0xff, 0x9b, 0x8c, 0x5d, 0xff, 0xae, 0xa1, 0x73, 0xff, 0xba, 0xad, 0x80, 0xff, 0xbd, 0xb0, 0x82, 0xff, 0xbf, 0xb1, 0x84, 0xff, 0xbd, 0xaf, 0x81, 0xff, 0xb2, 0xa7, 0x79, 0xff, 0xb2, 0xa6, 0x7f, 0xff, 0xc4, 0xba, 0x99, 0xff, 0xd2, 0xc7, 0xb0, 0xff, 0xe0, 0xd8, 0xc8, 0x21,
+    0x9c, 0x95, 0x70, 0x4b, 0x9e, 0x98, 0x74, 0xff, 0xa2, 0x9a, 0x78, 0xff, 0xab, 0x9f, 0x7b, 0xff, 0xaf, 0x9f, 0x7b, 0xff, 0xab, 0x9c, 0x74, 0xff, 0xa7, 0x9c, 0x6c, 0xff, 0xab, 0xa1, 0x6a, 0xff, 0xb1, 0xa6, 0x6c, 0xff, 0xb0, 0xa5, 0x6d, 0xff, 0xb0, 0xa5, 0x6f, 0xff, 0xb0, 0xa5, 0x74, 0xff, 0xaa, 0x9e, 0x78, 0xff, 0xa1, 0x98, 0x74, 0xff, 0x9c, 0x97, 0x6f, 0xff, 0xa6, 0x9b, 0x7d, 0xff, 0xb5, 0xa6, 0x8a, 0xff, 0xb0, 0xaa, 0x7c, 0xff, 0xa9, 0xa6, 0x78, 0xff, 0xb6, 0xb0, 0x93, 0xff, 0x8f, 0x99, 0xa7, 0xff, 0x67, 0x7f, 0xae, 0xff, 0x6c, 0x7f, 0xb5, 0xff, 0x48, 0x59, 0x91, 0xff, 0x57, 0x68, 0x99, 0xff, 0x8e, 0x9c, 0xcb, 0xff, 0x93, 0x9b, 0xca, 0xff, 0x8d, 0x93, 0xbe, 0xff, 0x89, 0x91, 0xb8, 0xff, 0x97, 0xa0, 0xc8, 0xff, 0x9f, 0xaa, 0xd1, 0xff, 0xa3, 0xad, 0xd5, 0xff, 0xa5, 0xae, 0xd7, 0xff, 0xa3, 0xae, 0xd5, 0xff, 0xa2, 0xaf, 0xd2, 0xff, 0xa1, 0xad, 0xd1, 0xff, 0xa0, 0xab, 0xd1, 0xff, 0x9d, 0xab, 0xd1, 0xff, 0x98, 0xa8, 0xcf, 0xff, 0x96, 0xa5, 0xcc, 0xff, 0x95, 0xa4, 0xcb, 0xff, 0x94, 0xa3, 0xca, 0xff, 0x90, 0xa1, 0xc7, 0xff, 0x8e, 0x9f, 0xc7, 0xff, 0x8e, 0x9e, 0xca, 0xff, 0x8d, 0x9d, 0xc8, 0xff, 0x89, 0x9a, 0xc5, 0xff, 0x89, 0x9a, 0xc5, 0xff, 0x8a, 0x9b, 0xc6, 0xff, 0x88, 0x99, 0xc4, 0xff, 0x88, 0x99, 0xc4, 0xff, 0x86, 0x97, 0xc2, 0xff, 0x88, 0x99, 0xc4, 0xff, 0x86, 0x97, 0xc2, 0xff, 0x83, 0x94, 0xbf, 0xff, 0x80, 0x91, 0xbc, 0xff, 0x7a, 0x8b, 0xb6, 0xff, 0x6d, 0x7e, 0xa9, 0xff, 0x57, 0x67, 0x93, 0xff, 0x64, 0x75, 0xa0, 0xff, 0x78, 0x8a, 0xb3, 0xff, 0x80, 0x92, 0xbb, 0xff, 0x87, 0x99, 0xc2, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x84, 0x95, 0xc0, 0xff, 0x85, 0x93, 0xc3, 0xff, 0x80, 0x91, 0xc5, 0xff, 0x5a, 0x6d, 0xa4, 0xff, 0x59, 0x67, 0xa1, 0xff, 0x69, 0x74, 0xae, 0xff, 0x69, 0x75, 0xa9, 0xff, 0x74, 0x80, 0xb2, 0xff, 0x65, 0x70, 0xaa, 0xff, 0x54, 0x64, 0xa5, 0xff, 0x6b, 0x7b, 0xb9, 0xff, 0x8a, 0x99, 0xd3, 0xff, 0x97, 0xa5, 0xdf, 0xff, 0x77, 0x84, 0xbf, 0xff, 0x77, 0x82, 0xbd, 0xff, 0xa1, 0xae, 0xe7, 0xff, 0x88, 0x96, 0xc2, 0xff, 0x11, 0x15, 0x29, 0xff, 0x0c, 0x09, 0x0e, 0xff, 0x17, 0x12, 0x0b, 0xff, 0x19, 0x14, 0x10, 0xff, 0x15, 0x14, 0x13, 0xff, 0x14, 0x10, 0x0e, 0xff, 0x13, 0x0f, 0x0e, 0xff, 0x1a, 0x16, 0x15, 0xff, 0x20, 0x1c, 0x1b, 0xff, 0x23, 0x1e, 0x1d, 0xff, 0x1f, 0x1a, 0x19, 0xff, 0x1b, 0x18, 0x16, 0xff, 0x19, 0x1a, 0x1a, 0xff, 0x12, 0x0f, 0x0f, 0xff, 0x29, 0x22, 0x1b, 0xff, 0x8c, 0x82, 0x66, 0xff, 0xa4, 0x97, 0x5f, 0xff, 0xa5, 0x96, 0x59, 0xff, 0xae, 0xa1, 0x6c, 0xff, 0xb7, 0xa9, 0x76, 0xff, 0xbb, 0xad, 0x7b, 0xff, 0xbe, 0xb3, 0x81, 0xff, 0xbe, 0xb2, 0x84, 0xff, 0xbe, 0xb0, 0x87, 0xff, 0xba, 0xad, 0x83, 0xff, 0xb4, 0xa7, 0x78, 0xff, 0xb3, 0xa8, 0x71, 0xff, 0xb7, 0xab, 0x70, 0xff, 0xb7, 0xab, 0x71, 0xff, 0xb5, 0xa7, 0x72, 0xff, 0xb1, 0xa3, 0x70, 0xff, 0xae, 0xa0, 0x6e, 0xff, 0xaa, 0x9d, 0x6a, 0xff, 0x9a, 0x8c, 0x58, 0xff, 0x8d, 0x80, 0x4a, 0xff, 0x8e, 0x7f, 0x4d, 0xff, 0x99, 0x89, 0x5a, 0xff, 0xac, 0x9d, 0x70, 0xff, 0xb8, 0xab, 0x7e, 0xff, 0xbe, 0xb2, 0x83, 0xff, 0xbf, 0xb2, 0x84, 0xff, 0xb9, 0xad, 0x80, 0xff, 0xaf, 0xa5, 0x7d, 0xff, 0xc0, 0xb6, 0x9a, 0xff, 0xd8, 0xcc, 0xbd, 0xff, 0xeb, 0xe0, 0xd8, 0xff, 0xf1, 0xe7, 0xe7, 0x4b,
+    0x9d, 0x91, 0x6b, 0x6b, 0xa1, 0x99, 0x72, 0xff, 0xa5, 0x9d, 0x73, 0xff, 0xaa, 0x9e, 0x74, 0xff, 0xad, 0x9f, 0x73, 0xff, 0xaf, 0xa0, 0x6f, 0xff, 0xb1, 0xa4, 0x6e, 0xff, 0xb5, 0xa9, 0x6c, 0xff, 0xb4, 0xa9, 0x69, 0xff, 0xb1, 0xa7, 0x6c, 0xff, 0xb2, 0xa8, 0x73, 0xff, 0xae, 0xa7, 0x76, 0xff, 0xa4, 0x9e, 0x74, 0xff, 0x9c, 0x93, 0x74, 0xff, 0x9d, 0x91, 0x73, 0xff, 0xa2, 0x97, 0x6b, 0xff, 0xac, 0xa3, 0x6e, 0xff, 0xb7, 0xab, 0x78, 0xff, 0xbb, 0xab, 0x7e, 0xff, 0xb3, 0xa9, 0x78, 0xff, 0xa3, 0xa2, 0x85, 0xff, 0x99, 0x9a, 0xaa, 0xff, 0x98, 0x9f, 0xc2, 0xff, 0x85, 0x91, 0xbe, 0xff, 0x72, 0x81, 0xac, 0xff, 0x7e, 0x8f, 0xbf, 0xff, 0x7c, 0x89, 0xbc, 0xff, 0x83, 0x89, 0xb5, 0xff, 0x93, 0x9a, 0xc1, 0xff, 0x9f, 0xa8, 0xd0, 0xff, 0xa1, 0xab, 0xd3, 0xff, 0xa3, 0xad, 0xd5, 0xff, 0xa2, 0xad, 0xd5, 0xff, 0xa0, 0xad, 0xd5, 0xff, 0x9e, 0xae, 0xd3, 0xff, 0x9d, 0xac, 0xd2, 0xff, 0x9c, 0xaa, 0xd1, 0xff, 0x98, 0xa8, 0xd2, 0xff, 0x95, 0xa5, 0xcf, 0xff, 0x94, 0xa4, 0xcd, 0xff, 0x94, 0xa2, 0xcc, 0xff, 0x92, 0xa0, 0xca, 0xff, 0x8f, 0x9f, 0xc8, 0xff, 0x8f, 0x9e, 0xca, 0xff, 0x8e, 0x9d, 0xcb, 0xff, 0x8c, 0x9c, 0xca, 0xff, 0x8b, 0x9b, 0xc8, 0xff, 0x89, 0x9a, 0xc5, 0xff, 0x8a, 0x9b, 0xc6, 0xff, 0x89, 0x9a, 0xc5, 0xff, 0x89, 0x9a, 0xc5, 0xff, 0x88, 0x99, 0xc4, 0xff, 0x88, 0x99, 0xc4, 0xff, 0x88, 0x99, 0xc3, 0xff, 0x86, 0x97, 0xc1, 0xff, 0x82, 0x94, 0xbd, 0xff, 0x7f, 0x91, 0xba, 0xff, 0x71, 0x83, 0xac, 0xff, 0x65, 0x77, 0xa0, 0xff, 0x74, 0x86, 0xaf, 0xff, 0x77, 0x88, 0xb3, 0xff, 0x7e, 0x8f, 0xba, 0xff, 0x86, 0x97, 0xc2, 0xff, 0x84, 0x95, 0xc1, 0xff, 0x82, 0x92, 0xc0, 0xff, 0x87, 0x96, 0xc5, 0xff, 0x74, 0x85, 0xb8, 0xff, 0x4f, 0x61, 0x98, 0xff, 0x58, 0x65, 0x9f, 0xff, 0x67, 0x72, 0xab, 0xff, 0x92, 0x9e, 0xcd, 0xff, 0xb1, 0xbc, 0xe8, 0xff, 0xa3, 0xad, 0xdd, 0xff, 0x88, 0x96, 0xce, 0xff, 0x88, 0x95, 0xcf, 0xff, 0x8c, 0x98, 0xd1, 0xff, 0x73, 0x80, 0xbb, 0xff, 0x6c, 0x7b, 0xb6, 0xff, 0x8f, 0x9f, 0xdb, 0xff, 0x9e, 0xaf, 0xe5, 0xff, 0x49, 0x53, 0x78, 0xff, 0x05, 0x06, 0x13, 0xff, 0x13, 0x0f, 0x0f, 0xff, 0x15, 0x11, 0x0e, 0xff, 0x17, 0x13, 0x10, 0xff, 0x1b, 0x16, 0x13, 0xff, 0x13, 0x0f, 0x0e, 0xff, 0x16, 0x12, 0x11, 0xff, 0x1e, 0x1a, 0x19, 0xff, 0x1b, 0x18, 0x14, 0xff, 0x1d, 0x19, 0x18, 0xff, 0x1f, 0x19, 0x1a, 0xff, 0x1c, 0x19, 0x1c, 0xff, 0x1f, 0x1b, 0x21, 0xff, 0x1e, 0x13, 0x13, 0xff, 0x6f, 0x60, 0x53, 0xff, 0xa8, 0x9b, 0x75, 0xff, 0xa0, 0x91, 0x5b, 0xff, 0xa7, 0x94, 0x5f, 0xff, 0xb0, 0xa0, 0x70, 0xff, 0xba, 0xac, 0x7b, 0xff, 0xbf, 0xb0, 0x7f, 0xff, 0xc0, 0xb0, 0x80, 0xff, 0xbe, 0xad, 0x83, 0xff, 0xbd, 0xad, 0x82, 0xff, 0xb9, 0xad, 0x7a, 0xff, 0xb4, 0xaa, 0x74, 0xff, 0xb2, 0xa8, 0x72, 0xff, 0xb3, 0xa8, 0x70, 0xff, 0xb5, 0xa7, 0x71, 0xff, 0xb4, 0xa6, 0x74, 0xff, 0xbb, 0xae, 0x80, 0xff, 0xb4, 0xa7, 0x7c, 0xff, 0xa9, 0x9b, 0x6d, 0xff, 0x9c, 0x8e, 0x5c, 0xff, 0x8f, 0x83, 0x4e, 0xff, 0x8f, 0x81, 0x50, 0xff, 0x9d, 0x8c, 0x5e, 0xff, 0xad, 0x9e, 0x70, 0xff, 0xbb, 0xab, 0x7a, 0xff, 0xc0, 0xaf, 0x7b, 0xff, 0xb9, 0xac, 0x7d, 0xff, 0xb5, 0xab, 0x81, 0xff, 0xb4, 0xa9, 0x8c, 0xff, 0xcb, 0xc0, 0xb1, 0xff, 0xe0, 0xd7, 0xd0, 0xff, 0xef, 0xe5, 0xe7, 0xff, 0xf0, 0xe4, 0xf0, 0x6b,
+    0xa3, 0x96, 0x68, 0x8b, 0xa8, 0x9b, 0x6c, 0xff, 0xab, 0x9f, 0x6e, 0xff, 0xaf, 0xa3, 0x71, 0xff, 0xb1, 0xa4, 0x70, 0xff, 0xb4, 0xa6, 0x70, 0xff, 0xb4, 0xa7, 0x6f, 0xff, 0xb3, 0xa5, 0x6d, 0xff, 0xb5, 0xa9, 0x6e, 0xff, 0xb7, 0xac, 0x76, 0xff, 0xb2, 0xaa, 0x78, 0xff, 0xad, 0xa8, 0x78, 0xff, 0xa6, 0xa0, 0x73, 0xff, 0x9b, 0x91, 0x6b, 0xff, 0x9a, 0x8c, 0x6a, 0xff, 0x9d, 0x92, 0x61, 0xff, 0xa7, 0xa0, 0x5e, 0xff, 0xb3, 0xa8, 0x6f, 0xff, 0xb9, 0xa7, 0x7e, 0xff, 0xb5, 0xa9, 0x70, 0xff, 0xb0, 0xa4, 0x70, 0xff, 0xb7, 0xaa, 0x9b, 0xff, 0xac, 0xac, 0xbe, 0xff, 0x93, 0x9d, 0xc0, 0xff, 0x8d, 0x97, 0xbb, 0xff, 0x84, 0x90, 0xb7, 0xff, 0x81, 0x8c, 0xb9, 0xff, 0x95, 0x9d, 0xc6, 0xff, 0xa4, 0xac, 0xd2, 0xff, 0xa4, 0xae, 0xd4, 0xff, 0xa2, 0xad, 0xd3, 0xff, 0xa3, 0xae, 0xd4, 0xff, 0xa2, 0xae, 0xd5, 0xff, 0xa0, 0xae, 0xd4, 0xff, 0x9c, 0xad, 0xd1, 0xff, 0x9b, 0xab, 0xd0, 0xff, 0x9a, 0xa9, 0xd0, 0xff, 0x97, 0xa7, 0xd1, 0xff, 0x95, 0xa5, 0xd0, 0xff, 0x93, 0xa3, 0xce, 0xff, 0x94, 0xa2, 0xcc, 0xff, 0x92, 0xa0, 0xca, 0xff, 0x8f, 0x9f, 0xca, 0xff, 0x8f, 0x9f, 0xcb, 0xff, 0x8e, 0x9d, 0xcc, 0xff, 0x8d, 0x9c, 0xcb, 0xff, 0x8b, 0x9c, 0xca, 0xff, 0x89, 0x9a, 0xc5, 0xff, 0x8a, 0x9b, 0xc6, 0xff, 0x89, 0x9a, 0xc5, 0xff, 0x89, 0x9a, 0xc5, 0xff, 0x89, 0x9a, 0xc5, 0xff, 0x88, 0x99, 0xc4, 0xff, 0x88, 0x99, 0xc3, 0xff, 0x86, 0x98, 0xc1, 0xff, 0x85, 0x97, 0xc0, 0xff, 0x83, 0x95, 0xbd, 0xff, 0x78, 0x8a, 0xb3, 0xff, 0x77, 0x89, 0xb2, 0xff, 0x79, 0x8b, 0xb4, 0xff, 0x78, 0x89, 0xb4, 0xff, 0x81, 0x91, 0xbd, 0xff, 0x83, 0x94, 0xbf, 0xff, 0x82, 0x92, 0xbf, 0xff, 0x82, 0x92, 0xc1, 0xff, 0x80, 0x8f, 0xbe, 0xff, 0x7d, 0x90, 0xbf, 0xff, 0x7d, 0x90, 0xc1, 0xff, 0x79, 0x88, 0xbc, 0xff, 0x8d, 0x9a, 0xcf, 0xff, 0x9f, 0xad, 0xdc, 0xff, 0x99, 0xa6, 0xd2, 0xff, 0x9a, 0xa5, 0xd4, 0xff, 0x94, 0xa0, 0xd5, 0xff, 0x7a, 0x86, 0xbe, 0xff, 0x6a, 0x76, 0xb0, 0xff, 0x72, 0x7f, 0xba, 0xff, 0x8e, 0x9e, 0xd7, 0xff, 0x97, 0xaa, 0xe3, 0xff, 0x75, 0x86, 0xbb, 0xff, 0x2f, 0x35, 0x56, 0xff, 0x11, 0x0d, 0x16, 0xff, 0x10, 0x0b, 0x0b, 0xff, 0x15, 0x10, 0x11, 0xff, 0x15, 0x10, 0x0e, 0xff, 0x1a, 0x14, 0x12, 0xff, 0x17, 0x13, 0x12, 0xff, 0x1d, 0x19, 0x18, 0xff, 0x22, 0x1e, 0x1d, 0xff, 0x18, 0x14, 0x13, 0xff, 0x20, 0x1c, 0x1c, 0xff, 0x24, 0x20, 0x1f, 0xff, 0x21, 0x1c, 0x23, 0xff, 0x14, 0x09, 0x12, 0xff, 0x3d, 0x30, 0x24, 0xff, 0xab, 0x9f, 0x7a, 0xff, 0xa8, 0x9f, 0x66, 0xff, 0x9e, 0x8f, 0x5f, 0xff, 0xa4, 0x91, 0x67, 0xff, 0xb0, 0xa1, 0x6f, 0xff, 0xbb, 0xad, 0x7a, 0xff, 0xbf, 0xb2, 0x7a, 0xff, 0xbb, 0xaf, 0x77, 0xff, 0xbd, 0xb0, 0x7f, 0xff, 0xb9, 0xac, 0x80, 0xff, 0xb6, 0xab, 0x7e, 0xff, 0xc3, 0xb9, 0x8c, 0xff, 0xc8, 0xbd, 0x92, 0xff, 0xbe, 0xb1, 0x87, 0xff, 0xb9, 0xa9, 0x84, 0xff, 0xcf, 0xc2, 0x9f, 0xff, 0xdf, 0xd2, 0xb4, 0xff, 0xd7, 0xca, 0xad, 0xff, 0xba, 0xae, 0x88, 0xff, 0x9b, 0x91, 0x62, 0xff, 0x8d, 0x83, 0x51, 0xff, 0x90, 0x84, 0x53, 0xff, 0x9e, 0x90, 0x60, 0xff, 0xb0, 0xa1, 0x70, 0xff, 0xbc, 0xac, 0x76, 0xff, 0xbd, 0xac, 0x76, 0xff, 0xba, 0xad, 0x7d, 0xff, 0xb9, 0xad, 0x8b, 0xff, 0xb9, 0xaf, 0x9e, 0xff, 0xd2, 0xca, 0xc4, 0xff, 0xe8, 0xe0, 0xe1, 0xff, 0xf0, 0xe6, 0xee, 0xff, 0xec, 0xe3, 0xf2, 0x8b,
+    0xae, 0x9f, 0x6a, 0xaa, 0xb5, 0xa6, 0x6d, 0xff, 0xb6, 0xa9, 0x6d, 0xff, 0xb4, 0xab, 0x6d, 0xff, 0xb4, 0xab, 0x6b, 0xff, 0xb6, 0xaa, 0x6d, 0xff, 0xb6, 0xa9, 0x71, 0xff, 0xb5, 0xa6, 0x73, 0xff, 0xb6, 0xa8, 0x78, 0xff, 0xb4, 0xaa, 0x7a, 0xff, 0xb0, 0xa9, 0x79, 0xff, 0xac, 0xa8, 0x79, 0xff, 0xa7, 0xa1, 0x71, 0xff, 0x9e, 0x92, 0x63, 0xff, 0x9a, 0x8d, 0x5c, 0xff, 0xa0, 0x92, 0x62, 0xff, 0xaa, 0x9c, 0x68, 0xff, 0xae, 0xa5, 0x66, 0xff, 0xb5, 0xaa, 0x6e, 0xff, 0xba, 0xad, 0x74, 0xff, 0xb4, 0xa6, 0x76, 0xff, 0xb5, 0xab, 0x98, 0xff, 0xa6, 0xae, 0xc3, 0xff, 0x96, 0xa1, 0xc8, 0xff, 0x98, 0x9e, 0xbe, 0xff, 0xa0, 0xa2, 0xbe, 0xff, 0xa2, 0xaa, 0xca, 0xff, 0xa2, 0xad, 0xd3, 0xff, 0xa5, 0xad, 0xd3, 0xff, 0xa3, 0xae, 0xd3, 0xff, 0xa4, 0xb0, 0xd4, 0xff, 0xa6, 0xb2, 0xd6, 0xff, 0xa3, 0xb0, 0xd5, 0xff, 0xa0, 0xae, 0xd2, 0xff, 0x9c, 0xac, 0xd1, 0xff, 0x9b, 0xab, 0xd1, 0xff, 0x9a, 0xa9, 0xcf, 0xff, 0x97, 0xa7, 0xd0, 0xff, 0x94, 0xa4, 0xcf, 0xff, 0x92, 0xa3, 0xcc, 0xff, 0x93, 0xa2, 0xcc, 0xff, 0x92, 0xa0, 0xca, 0xff, 0x8e, 0x9e, 0xc8, 0xff, 0x8e, 0x9e, 0xca, 0xff, 0x8f, 0x9e, 0xcd, 0xff, 0x8d, 0x9d, 0xcc, 0xff, 0x8c, 0x9c, 0xca, 0xff, 0x89, 0x9a, 0xc5, 0xff, 0x8b, 0x9c, 0xc7, 0xff, 0x8b, 0x9c, 0xc8, 0xff, 0x8b, 0x9c, 0xc7, 0xff, 0x8a, 0x9c, 0xc7, 0xff, 0x8a, 0x9b, 0xc7, 0xff, 0x8a, 0x9c, 0xc6, 0xff, 0x89, 0x9b, 0xc3, 0xff, 0x87, 0x99, 0xc2, 0xff, 0x86, 0x98, 0xc1, 0xff, 0x7f, 0x91, 0xba, 0xff, 0x7e, 0x90, 0xb9, 0xff, 0x7f, 0x91, 0xba, 0xff, 0x7f, 0x90, 0xbc, 0xff, 0x82, 0x93, 0xbe, 0xff, 0x81, 0x92, 0xbd, 0xff, 0x82, 0x93, 0xc0, 0xff, 0x82, 0x92, 0xc0, 0xff, 0x7c, 0x8b, 0xbb, 0xff, 0x7f, 0x93, 0xc0, 0xff, 0x92, 0xa7, 0xd2, 0xff, 0x97, 0xa8, 0xd7, 0xff, 0x8d, 0x9b, 0xcd, 0xff, 0x83, 0x93, 0xc2, 0xff, 0x89, 0x9a, 0xc4, 0xff, 0x9c, 0xa9, 0xd6, 0xff, 0xa3, 0xab, 0xdc, 0xff, 0x96, 0xa0, 0xd6, 0xff, 0x91, 0x9c, 0xd8, 0xff, 0x97, 0xa5, 0xdf, 0xff, 0x94, 0xa4, 0xdc, 0xff, 0x7e, 0x92, 0xc9, 0xff, 0x4b, 0x5d, 0x93, 0xff, 0x27, 0x29, 0x46, 0xff, 0x15, 0x0d, 0x10, 0xff, 0x11, 0x0d, 0x0d, 0xff, 0x12, 0x0d, 0x0f, 0xff, 0x16, 0x0f, 0x11, 0xff, 0x17, 0x12, 0x12, 0xff, 0x17, 0x13, 0x13, 0xff, 0x21, 0x1c, 0x1c, 0xff, 0x1c, 0x17, 0x16, 0xff, 0x1c, 0x17, 0x18, 0xff, 0x21, 0x1d, 0x1e, 0xff, 0x21, 0x20, 0x1f, 0xff, 0x0b, 0x06, 0x08, 0xff, 0x20, 0x15, 0x13, 0xff, 0x8f, 0x85, 0x65, 0xff, 0xbe, 0xb6, 0x79, 0xff, 0xa5, 0x9e, 0x58, 0xff, 0x9a, 0x8a, 0x5e, 0xff, 0xa2, 0x8f, 0x6a, 0xff, 0xb2, 0xa4, 0x6d, 0xff, 0xbb, 0xb0, 0x73, 0xff, 0xbd, 0xb4, 0x73, 0xff, 0xba, 0xb1, 0x73, 0xff, 0xba, 0xb3, 0x77, 0xff, 0xb8, 0xad, 0x7e, 0xff, 0xc9, 0xbb, 0x9d, 0xff, 0xde, 0xd0, 0xb8, 0xff, 0xe3, 0xd3, 0xbc, 0xff, 0xe5, 0xd4, 0xc0, 0xff, 0xe0, 0xce, 0xbd, 0xff, 0xe6, 0xd5, 0xc8, 0xff, 0xe8, 0xd8, 0xcf, 0xff, 0xec, 0xdd, 0xd0, 0xff, 0xd6, 0xcb, 0xb2, 0xff, 0xa0, 0x9a, 0x72, 0xff, 0x8a, 0x81, 0x52, 0xff, 0x8f, 0x86, 0x54, 0xff, 0x9c, 0x91, 0x5f, 0xff, 0xad, 0xa1, 0x6a, 0xff, 0xbb, 0xad, 0x71, 0xff, 0xc2, 0xb3, 0x79, 0xff, 0xc4, 0xb6, 0x85, 0xff, 0xc9, 0xbb, 0xa0, 0xff, 0xd0, 0xc5, 0xc0, 0xff, 0xda, 0xd5, 0xd5, 0xff, 0xe5, 0xdf, 0xe2, 0xff, 0xe9, 0xe3, 0xeb, 0xff, 0xe1, 0xdc, 0xe8, 0xab,
+    0xba, 0xaa, 0x76, 0xbe, 0xbb, 0xac, 0x73, 0xff, 0xb9, 0xac, 0x71, 0xff, 0xb7, 0xac, 0x6f, 0xff, 0xb6, 0xac, 0x6e, 0xff, 0xb8, 0xad, 0x71, 0xff, 0xb9, 0xac, 0x74, 0xff, 0xb6, 0xa9, 0x75, 0xff, 0xb5, 0xa9, 0x78, 0xff, 0xb4, 0xa7, 0x79, 0xff, 0xb3, 0xa7, 0x7c, 0xff, 0xb1, 0xa6, 0x7a, 0xff, 0xab, 0xa2, 0x6e, 0xff, 0xa1, 0x93, 0x61, 0xff, 0x9a, 0x8c, 0x5f, 0xff, 0x9d, 0x96, 0x5d, 0xff, 0xa8, 0x9f, 0x60, 0xff, 0xb8, 0xa3, 0x75, 0xff, 0xbd, 0xab, 0x74, 0xff, 0xba, 0xaf, 0x68, 0xff, 0xaf, 0xa8, 0x83, 0xff, 0xaa, 0xab, 0xae, 0xff, 0xa8, 0xad, 0xc7, 0xff, 0x9f, 0xa5, 0xd0, 0xff, 0xa0, 0xa6, 0xc7, 0xff, 0xa7, 0xac, 0xc8, 0xff, 0xa5, 0xab, 0xcc, 0xff, 0xa3, 0xab, 0xcf, 0xff, 0xa4, 0xac, 0xd1, 0xff, 0xa6, 0xaf, 0xd4, 0xff, 0xa7, 0xb2, 0xd6, 0xff, 0xa5, 0xb0, 0xd5, 0xff, 0xa2, 0xaf, 0xd4, 0xff, 0x9f, 0xae, 0xd3, 0xff, 0x9d, 0xad, 0xd2, 0xff, 0x9c, 0xab, 0xd2, 0xff, 0x9c, 0xaa, 0xd2, 0xff, 0x98, 0xa6, 0xd1, 0xff, 0x95, 0xa3, 0xcf, 0xff, 0x94, 0xa2, 0xce, 0xff, 0x94, 0xa2, 0xcd, 0xff, 0x92, 0xa2, 0xcb, 0xff, 0x8f, 0xa0, 0xca, 0xff, 0x8e, 0x9e, 0xc9, 0xff, 0x8e, 0x9e, 0xc9, 0xff, 0x8d, 0x9d, 0xc9, 0xff, 0x8d, 0x9d, 0xc8, 0xff, 0x8d, 0x9d, 0xc8, 0xff, 0x8d, 0x9d, 0xc8, 0xff, 0x8c, 0x9c, 0xc7, 0xff, 0x8c, 0x9d, 0xc7, 0xff, 0x8c, 0x9d, 0xc7, 0xff, 0x8c, 0x9c, 0xc7, 0xff, 0x8b, 0x9d, 0xc6, 0xff, 0x8b, 0x9d, 0xc6, 0xff, 0x8a, 0x9c, 0xc5, 0xff, 0x87, 0x99, 0xc2, 0xff, 0x86, 0x98, 0xc1, 0xff, 0x84, 0x96, 0xbf, 0xff, 0x84, 0x97, 0xbf, 0xff, 0x85, 0x96, 0xc0, 0xff, 0x84, 0x94, 0xc0, 0xff, 0x82, 0x92, 0xbf, 0xff, 0x81, 0x92, 0xc0, 0xff, 0x80, 0x91, 0xc0, 0xff, 0x7b, 0x8c, 0xbc, 0xff, 0x7b, 0x8d, 0xbb, 0xff, 0x8a, 0x9b, 0xc7, 0xff, 0x95, 0xa6, 0xd0, 0xff, 0x98, 0xa8, 0xd3, 0xff, 0x9f, 0xaa, 0xd6, 0xff, 0x9c, 0xa7, 0xd1, 0xff, 0x97, 0xa4, 0xcf, 0xff, 0x9e, 0xa9, 0xda, 0xff, 0xa7, 0xb2, 0xe9, 0xff, 0x9e, 0xa9, 0xe5, 0xff, 0x94, 0x9f, 0xd9, 0xff, 0x84, 0x93, 0xc8, 0xff, 0x5f, 0x70, 0xa3, 0xff, 0x3d, 0x4e, 0x7e, 0xff, 0x1c, 0x1f, 0x39, 0xff, 0x14, 0x0c, 0x0d, 0xff, 0x15, 0x0e, 0x0c, 0xff, 0x15, 0x11, 0x11, 0xff, 0x14, 0x11, 0x11, 0xff, 0x16, 0x11, 0x11, 0xff, 0x18, 0x14, 0x12, 0xff, 0x18, 0x19, 0x14, 0xff, 0x17, 0x15, 0x15, 0xff, 0x25, 0x1f, 0x25, 0xff, 0x19, 0x12, 0x18, 0xff, 0x1a, 0x11, 0x0e, 0xff, 0x47, 0x3b, 0x2a, 0xff, 0xa1, 0x95, 0x78, 0xff, 0xd0, 0xc8, 0x98, 0xff, 0xb3, 0xac, 0x6e, 0xff, 0x9f, 0x94, 0x59, 0xff, 0x99, 0x8a, 0x5d, 0xff, 0xa1, 0x90, 0x65, 0xff, 0xae, 0x9d, 0x6d, 0xff, 0xba, 0xa9, 0x73, 0xff, 0xc0, 0xb2, 0x71, 0xff, 0xbe, 0xb4, 0x70, 0xff, 0xb8, 0xb0, 0x73, 0xff, 0xc4, 0xba, 0x8f, 0xff, 0xe3, 0xd4, 0xbd, 0xff, 0xef, 0xdf, 0xd1, 0xff, 0xf4, 0xe4, 0xe0, 0xff, 0xf6, 0xe7, 0xe7, 0xff, 0xee, 0xe2, 0xe0, 0xff, 0xee, 0xe1, 0xde, 0xff, 0xee, 0xe1, 0xde, 0xff, 0xeb, 0xdf, 0xdc, 0xff, 0xdc, 0xd1, 0xbc, 0xff, 0xad, 0xa1, 0x7a, 0xff, 0x8c, 0x7f, 0x4f, 0xff, 0x8f, 0x81, 0x50, 0xff, 0x9c, 0x8f, 0x5d, 0xff, 0xaf, 0xa4, 0x6a, 0xff, 0xbe, 0xb1, 0x73, 0xff, 0xc4, 0xb4, 0x7e, 0xff, 0xca, 0xbd, 0x92, 0xff, 0xd8, 0xce, 0xb8, 0xff, 0xe1, 0xdb, 0xdb, 0xff, 0xe2, 0xdf, 0xe6, 0xff, 0xe5, 0xdf, 0xe7, 0xff, 0xe6, 0xe0, 0xe8, 0xff, 0xe0, 0xd9, 0xe0, 0xbe,
+    0xbb, 0xae, 0x77, 0xd3, 0xb9, 0xac, 0x75, 0xff, 0xba, 0xae, 0x75, 0xff, 0xbb, 0xae, 0x75, 0xff, 0xbb, 0xaf, 0x74, 0xff, 0xb9, 0xae, 0x74, 0xff, 0xb9, 0xad, 0x76, 0xff, 0xb9, 0xac, 0x78, 0xff, 0xba, 0xae, 0x7c, 0xff, 0xb7, 0xaa, 0x7c, 0xff, 0xbc, 0xad, 0x83, 0xff, 0xbf, 0xb2, 0x86, 0xff, 0xb6, 0xab, 0x77, 0xff, 0xa7, 0x99, 0x65, 0xff, 0x9b, 0x8e, 0x61, 0xff, 0x9c, 0x98, 0x5d, 0xff, 0xa7, 0xa5, 0x5b, 0xff, 0xb9, 0xa1, 0x79, 0xff, 0xc0, 0xab, 0x7e, 0xff, 0xb5, 0xab, 0x68, 0xff, 0xb3, 0xad, 0x99, 0xff, 0xb3, 0xb5, 0xc8, 0xff, 0xb3, 0xb4, 0xcd, 0xff, 0xa6, 0xa9, 0xca, 0xff, 0xa3, 0xac, 0xca, 0xff, 0xa2, 0xab, 0xca, 0xff, 0xa5, 0xab, 0xce, 0xff, 0xa7, 0xad, 0xd2, 0xff, 0xa7, 0xaf, 0xd4, 0xff, 0xa8, 0xb0, 0xd5, 0xff, 0xa6, 0xaf, 0xd4, 0xff, 0xa3, 0xad, 0xd4, 0xff, 0xa1, 0xad, 0xd3, 0xff, 0x9f, 0xac, 0xd2, 0xff, 0x9d, 0xac, 0xd2, 0xff, 0x9c, 0xab, 0xd3, 0xff, 0x9c, 0xaa, 0xd4, 0xff, 0x99, 0xa6, 0xd2, 0xff, 0x96, 0xa3, 0xcf, 0xff, 0x95, 0xa2, 0xce, 0xff, 0x94, 0xa2, 0xcd, 0xff, 0x91, 0xa2, 0xcb, 0xff, 0x91, 0xa1, 0xcb, 0xff, 0x90, 0xa0, 0xca, 0xff, 0x8f, 0x9f, 0xc9, 0xff, 0x8f, 0x9f, 0xc9, 0xff, 0x8f, 0x9f, 0xc9, 0xff, 0x8f, 0x9f, 0xc8, 0xff, 0x8d, 0x9d, 0xc7, 0xff, 0x8d, 0x9c, 0xc6, 0xff, 0x8c, 0x9c, 0xc6, 0xff, 0x8c, 0x9c, 0xc6, 0xff, 0x8c, 0x9c, 0xc6, 0xff, 0x8b, 0x9d, 0xc6, 0xff, 0x8b, 0x9d, 0xc6, 0xff, 0x8b, 0x9d, 0xc6, 0xff, 0x89, 0x9b, 0xc4, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x89, 0x9b, 0xc4, 0xff, 0x87, 0x99, 0xc2, 0xff, 0x87, 0x99, 0xc2, 0xff, 0x86, 0x96, 0xc2, 0xff, 0x83, 0x92, 0xc1, 0xff, 0x80, 0x93, 0xc0, 0xff, 0x7e, 0x92, 0xc0, 0xff, 0x7a, 0x8b, 0xbc, 0xff, 0x7e, 0x8f, 0xc0, 0xff, 0x8d, 0x9c, 0xcb, 0xff, 0x9a, 0xaa, 0xd6, 0xff, 0xa1, 0xb1, 0xdc, 0xff, 0xab, 0xb4, 0xe2, 0xff, 0xa7, 0xaf, 0xdc, 0xff, 0x97, 0xa5, 0xd2, 0xff, 0x97, 0xa7, 0xd9, 0xff, 0x98, 0xa5, 0xdb, 0xff, 0x8f, 0x9a, 0xd3, 0xff, 0x80, 0x8a, 0xc3, 0xff, 0x61, 0x72, 0xa3, 0xff, 0x5b, 0x6c, 0x9a, 0xff, 0x3c, 0x4a, 0x74, 0xff, 0x0f, 0x12, 0x29, 0xff, 0x18, 0x10, 0x11, 0xff, 0x1b, 0x13, 0x0f, 0xff, 0x16, 0x14, 0x12, 0xff, 0x11, 0x10, 0x0f, 0xff, 0x14, 0x0f, 0x0e, 0xff, 0x1b, 0x18, 0x16, 0xff, 0x14, 0x17, 0x12, 0xff, 0x1e, 0x1c, 0x1d, 0xff, 0x1c, 0x18, 0x19, 0xff, 0x17, 0x0f, 0x09, 0xff, 0x80, 0x72, 0x5f, 0xff, 0xd4, 0xc4, 0xa4, 0xff, 0xd5, 0xc6, 0xa0, 0xff, 0xd0, 0xc5, 0x9c, 0xff, 0xd1, 0xc6, 0x9d, 0xff, 0xc1, 0xb4, 0x91, 0xff, 0xb8, 0xa9, 0x8b, 0xff, 0xb7, 0xa9, 0x87, 0xff, 0xba, 0xa8, 0x85, 0xff, 0xc6, 0xb1, 0x88, 0xff, 0xc8, 0xb5, 0x7d, 0xff, 0xbe, 0xb2, 0x73, 0xff, 0xbd, 0xb3, 0x7c, 0xff, 0xd0, 0xc6, 0xa2, 0xff, 0xe9, 0xdb, 0xc7, 0xff, 0xf7, 0xe9, 0xe0, 0xff, 0xfc, 0xf0, 0xf3, 0xff, 0xee, 0xe4, 0xee, 0xff, 0xe3, 0xdc, 0xe1, 0xff, 0xec, 0xe4, 0xe4, 0xff, 0xf3, 0xe9, 0xea, 0xff, 0xf1, 0xe5, 0xe4, 0xff, 0xdc, 0xcf, 0xba, 0xff, 0xaa, 0x9b, 0x73, 0xff, 0x8c, 0x7c, 0x4b, 0xff, 0x8e, 0x7e, 0x4d, 0xff, 0x9d, 0x8e, 0x5c, 0xff, 0xaf, 0xa4, 0x6a, 0xff, 0xbc, 0xb0, 0x75, 0xff, 0xc4, 0xb3, 0x85, 0xff, 0xd8, 0xc9, 0xa9, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xea, 0xe3, 0xea, 0xff, 0xeb, 0xe4, 0xef, 0xff, 0xe9, 0xe1, 0xe9, 0xff, 0xe3, 0xda, 0xdf, 0xff, 0xdd, 0xd2, 0xd3, 0xd3,
+    0xbb, 0xaf, 0x75, 0xe7, 0xbb, 0xae, 0x76, 0xff, 0xbc, 0xaf, 0x77, 0xff, 0xbd, 0xb1, 0x76, 0xff, 0xba, 0xaf, 0x74, 0xff, 0xb9, 0xae, 0x75, 0xff, 0xbf, 0xb2, 0x7d, 0xff, 0xc3, 0xb5, 0x85, 0xff, 0xbf, 0xb4, 0x85, 0xff, 0xc3, 0xb8, 0x8a, 0xff, 0xc4, 0xb8, 0x8a, 0xff, 0xbf, 0xb7, 0x87, 0xff, 0xba, 0xb1, 0x82, 0xff, 0xae, 0xa6, 0x6e, 0xff, 0xa0, 0x95, 0x5c, 0xff, 0x9d, 0x94, 0x60, 0xff, 0xa7, 0xa3, 0x64, 0xff, 0xb7, 0xa8, 0x73, 0xff, 0xb5, 0xac, 0x6d, 0xff, 0xc0, 0xb3, 0x91, 0xff, 0xc8, 0xbd, 0xd5, 0xff, 0xb0, 0xae, 0xd3, 0xff, 0xb4, 0xb2, 0xd7, 0xff, 0xaf, 0xb3, 0xd0, 0xff, 0xa7, 0xb1, 0xc7, 0xff, 0xa6, 0xaf, 0xc9, 0xff, 0xa7, 0xad, 0xd1, 0xff, 0xa7, 0xae, 0xd4, 0xff, 0xa7, 0xaf, 0xd4, 0xff, 0xa7, 0xaf, 0xd4, 0xff, 0xa5, 0xae, 0xd4, 0xff, 0xa2, 0xad, 0xd3, 0xff, 0xa0, 0xac, 0xd2, 0xff, 0x9e, 0xac, 0xd2, 0xff, 0x9d, 0xac, 0xd3, 0xff, 0x9c, 0xab, 0xd3, 0xff, 0x9c, 0xaa, 0xd3, 0xff, 0x9b, 0xa8, 0xd4, 0xff, 0x98, 0xa5, 0xd1, 0xff, 0x97, 0xa3, 0xcf, 0xff, 0x94, 0xa2, 0xcd, 0xff, 0x91, 0xa2, 0xcb, 0xff, 0x92, 0xa2, 0xcc, 0xff, 0x92, 0xa2, 0xcc, 0xff, 0x91, 0xa1, 0xcb, 0xff, 0x90, 0xa0, 0xca, 0xff, 0x90, 0xa0, 0xca, 0xff, 0x8f, 0x9f, 0xc9, 0xff, 0x8e, 0x9e, 0xc8, 0xff, 0x8d, 0x9d, 0xc7, 0xff, 0x8c, 0x9c, 0xc6, 0xff, 0x8c, 0x9c, 0xc6, 0xff, 0x8c, 0x9c, 0xc6, 0xff, 0x8b, 0x9c, 0xc6, 0xff, 0x8b, 0x9e, 0xc7, 0xff, 0x8c, 0x9e, 0xc7, 0xff, 0x8a, 0x9c, 0xc5, 0xff, 0x89, 0x9b, 0xc4, 0xff, 0x89, 0x9b, 0xc4, 0xff, 0x88, 0x9a, 0xc2, 0xff, 0x88, 0x99, 0xc3, 0xff, 0x86, 0x96, 0xc2, 0xff, 0x83, 0x93, 0xc1, 0xff, 0x82, 0x95, 0xc2, 0xff, 0x7b, 0x8e, 0xbd, 0xff, 0x76, 0x87, 0xb7, 0xff, 0x81, 0x93, 0xc3, 0xff, 0x89, 0x9c, 0xcb, 0xff, 0x93, 0xa2, 0xd4, 0xff, 0x98, 0xa7, 0xda, 0xff, 0x9c, 0xa8, 0xde, 0xff, 0x9f, 0xa9, 0xdf, 0xff, 0x95, 0xa4, 0xd9, 0xff, 0x8d, 0x9f, 0xd2, 0xff, 0x82, 0x94, 0xc8, 0xff, 0x77, 0x89, 0xbc, 0xff, 0x63, 0x76, 0xa8, 0xff, 0x5d, 0x72, 0xa1, 0xff, 0x5d, 0x71, 0x9b, 0xff, 0x2c, 0x39, 0x60, 0xff, 0x11, 0x11, 0x25, 0xff, 0x1b, 0x11, 0x12, 0xff, 0x1b, 0x14, 0x13, 0xff, 0x18, 0x15, 0x14, 0xff, 0x11, 0x10, 0x0f, 0xff, 0x0f, 0x0b, 0x0a, 0xff, 0x19, 0x14, 0x15, 0xff, 0x19, 0x19, 0x1a, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x0d, 0x0d, 0x01, 0xff, 0x73, 0x69, 0x4c, 0xff, 0xd3, 0xc4, 0x98, 0xff, 0xc6, 0xb7, 0x8b, 0xff, 0xcc, 0xbb, 0x9b, 0xff, 0xde, 0xcc, 0xb9, 0xff, 0xe6, 0xd4, 0xc8, 0xff, 0xed, 0xdb, 0xd4, 0xff, 0xdf, 0xd0, 0xcb, 0xff, 0xd2, 0xc9, 0xbd, 0xff, 0xd6, 0xcd, 0xba, 0xff, 0xd7, 0xc9, 0xb1, 0xff, 0xd2, 0xc2, 0x9e, 0xff, 0xca, 0xbc, 0x8c, 0xff, 0xc7, 0xbc, 0x92, 0xff, 0xd9, 0xcf, 0xb3, 0xff, 0xea, 0xde, 0xd3, 0xff, 0xf4, 0xe9, 0xe7, 0xff, 0xf4, 0xeb, 0xf1, 0xff, 0xeb, 0xe2, 0xee, 0xff, 0xe5, 0xdd, 0xe8, 0xff, 0xdf, 0xd7, 0xde, 0xff, 0xde, 0xd5, 0xdb, 0xff, 0xe4, 0xd8, 0xd7, 0xff, 0xda, 0xce, 0xb8, 0xff, 0xac, 0x9e, 0x75, 0xff, 0x8e, 0x81, 0x4f, 0xff, 0x93, 0x87, 0x54, 0xff, 0xa3, 0x96, 0x62, 0xff, 0xb3, 0xa8, 0x70, 0xff, 0xbe, 0xb0, 0x7c, 0xff, 0xc5, 0xb4, 0x8c, 0xff, 0xde, 0xcd, 0xb6, 0xff, 0xeb, 0xde, 0xdb, 0xff, 0xee, 0xe3, 0xed, 0xff, 0xf3, 0xe9, 0xf0, 0xff, 0xec, 0xe4, 0xe3, 0xff, 0xe0, 0xd5, 0xd4, 0xff, 0xdc, 0xd0, 0xcc, 0xe6,
+    0xbf, 0xb3, 0x77, 0xf0, 0xbe, 0xb3, 0x78, 0xff, 0xbd, 0xb0, 0x78, 0xff, 0xbd, 0xb2, 0x77, 0xff, 0xbb, 0xb0, 0x75, 0xff, 0xbc, 0xb0, 0x79, 0xff, 0xc5, 0xb7, 0x84, 0xff, 0xc5, 0xb7, 0x87, 0xff, 0xbc, 0xb2, 0x84, 0xff, 0xc7, 0xbf, 0x8f, 0xff, 0xc9, 0xc0, 0x8e, 0xff, 0xc0, 0xb8, 0x86, 0xff, 0xbc, 0xb3, 0x84, 0xff, 0xb3, 0xac, 0x75, 0xff, 0xa3, 0x9a, 0x5b, 0xff, 0xa1, 0x95, 0x61, 0xff, 0xa8, 0xa1, 0x68, 0xff, 0xb8, 0xac, 0x70, 0xff, 0xb4, 0xb1, 0x66, 0xff, 0xc1, 0xb4, 0xa3, 0xff, 0xa6, 0x97, 0xcd, 0xff, 0x86, 0x81, 0xbc, 0xff, 0x96, 0x93, 0xc4, 0xff, 0xb0, 0xb4, 0xd4, 0xff, 0xae, 0xb9, 0xce, 0xff, 0xa7, 0xb1, 0xcb, 0xff, 0xa6, 0xac, 0xcf, 0xff, 0xa4, 0xab, 0xd1, 0xff, 0xa4, 0xad, 0xd2, 0xff, 0xa4, 0xad, 0xd2, 0xff, 0xa4, 0xad, 0xd3, 0xff, 0xa2, 0xad, 0xd3, 0xff, 0xa0, 0xac, 0xd2, 0xff, 0x9d, 0xab, 0xd1, 0xff, 0x9d, 0xac, 0xd2, 0xff, 0x9c, 0xab, 0xd3, 0xff, 0x9b, 0xaa, 0xd3, 0xff, 0x9b, 0xa9, 0xd4, 0xff, 0x9a, 0xa6, 0xd3, 0xff, 0x97, 0xa4, 0xd0, 0xff, 0x93, 0xa2, 0xcd, 0xff, 0x91, 0xa2, 0xcc, 0xff, 0x93, 0xa3, 0xcd, 0xff, 0x92, 0xa2, 0xcc, 0xff, 0x90, 0xa0, 0xca, 0xff, 0x90, 0xa0, 0xca, 0xff, 0x90, 0xa0, 0xca, 0xff, 0x8f, 0x9f, 0xc9, 0xff, 0x8e, 0x9e, 0xc8, 0xff, 0x8c, 0x9c, 0xc6, 0xff, 0x8c, 0x9c, 0xc6, 0xff, 0x8c, 0x9c, 0xc6, 0xff, 0x8c, 0x9c, 0xc6, 0xff, 0x8b, 0x9c, 0xc6, 0xff, 0x8b, 0x9e, 0xc6, 0xff, 0x8c, 0x9e, 0xc7, 0xff, 0x8c, 0x9e, 0xc7, 0xff, 0x8a, 0x9c, 0xc5, 0xff, 0x89, 0x9b, 0xc4, 0xff, 0x89, 0x9b, 0xc4, 0xff, 0x88, 0x9a, 0xc2, 0xff, 0x85, 0x97, 0xc0, 0xff, 0x80, 0x91, 0xbe, 0xff, 0x81, 0x93, 0xc0, 0xff, 0x78, 0x8a, 0xb8, 0xff, 0x6b, 0x7d, 0xad, 0xff, 0x7e, 0x91, 0xc1, 0xff, 0x82, 0x96, 0xc6, 0xff, 0x84, 0x94, 0xc9, 0xff, 0x84, 0x93, 0xca, 0xff, 0x84, 0x91, 0xcc, 0xff, 0x87, 0x92, 0xce, 0xff, 0x83, 0x92, 0xca, 0xff, 0x7c, 0x8f, 0xc1, 0xff, 0x72, 0x85, 0xb7, 0xff, 0x66, 0x7b, 0xaa, 0xff, 0x66, 0x7c, 0xa9, 0xff, 0x65, 0x7e, 0xa8, 0xff, 0x4f, 0x64, 0x8e, 0xff, 0x26, 0x30, 0x51, 0xff, 0x12, 0x12, 0x22, 0xff, 0x18, 0x11, 0x10, 0xff, 0x16, 0x12, 0x0e, 0xff, 0x18, 0x16, 0x15, 0xff, 0x13, 0x11, 0x11, 0xff, 0x13, 0x0e, 0x0b, 0xff, 0x16, 0x10, 0x11, 0xff, 0x1c, 0x1c, 0x22, 0xff, 0x0a, 0x0b, 0x08, 0xff, 0x48, 0x48, 0x2f, 0xff, 0xcc, 0xbf, 0x92, 0xff, 0xca, 0xb9, 0x81, 0xff, 0xbd, 0xaf, 0x7c, 0xff, 0xca, 0xbb, 0x97, 0xff, 0xe1, 0xcf, 0xc4, 0xff, 0xe9, 0xd6, 0xd9, 0xff, 0xf1, 0xe1, 0xe9, 0xff, 0xeb, 0xdf, 0xe6, 0xff, 0xe2, 0xdd, 0xdd, 0xff, 0xe6, 0xe4, 0xe1, 0xff, 0xe4, 0xdc, 0xd4, 0xff, 0xe2, 0xd6, 0xc1, 0xff, 0xe0, 0xd2, 0xb2, 0xff, 0xce, 0xc0, 0xa4, 0xff, 0xdc, 0xcf, 0xbf, 0xff, 0xec, 0xe0, 0xde, 0xff, 0xec, 0xe2, 0xe8, 0xff, 0xea, 0xe2, 0xee, 0xff, 0xe7, 0xe1, 0xef, 0xff, 0xe7, 0xe0, 0xee, 0xff, 0xde, 0xd7, 0xe3, 0xff, 0xd9, 0xd1, 0xd8, 0xff, 0xdb, 0xd0, 0xcc, 0xff, 0xd3, 0xc7, 0xb1, 0xff, 0xb2, 0xa5, 0x7d, 0xff, 0x95, 0x89, 0x58, 0xff, 0x97, 0x8c, 0x5a, 0xff, 0xa2, 0x98, 0x66, 0xff, 0xb8, 0xad, 0x76, 0xff, 0xc0, 0xb3, 0x80, 0xff, 0xb9, 0xa9, 0x87, 0xff, 0xd1, 0xbf, 0xae, 0xff, 0xe3, 0xd3, 0xd0, 0xff, 0xf1, 0xe5, 0xe9, 0xff, 0xf2, 0xe5, 0xe7, 0xff, 0xe3, 0xd8, 0xd1, 0xff, 0xe2, 0xd7, 0xce, 0xff, 0xe7, 0xdb, 0xd4, 0xf0,
+    0xbe, 0xb4, 0x78, 0xf3, 0xc0, 0xb4, 0x7a, 0xff, 0xbf, 0xb3, 0x79, 0xff, 0xbf, 0xb3, 0x79, 0xff, 0xbe, 0xb1, 0x79, 0xff, 0xbe, 0xb2, 0x7d, 0xff, 0xc6, 0xb8, 0x87, 0xff, 0xc5, 0xb7, 0x88, 0xff, 0xc3, 0xb7, 0x87, 0xff, 0xcc, 0xc1, 0x8f, 0xff, 0xcd, 0xc4, 0x8c, 0xff, 0xc5, 0xbb, 0x85, 0xff, 0xc2, 0xb6, 0x85, 0xff, 0xb3, 0xaa, 0x74, 0xff, 0xa0, 0x97, 0x58, 0xff, 0xa3, 0x97, 0x61, 0xff, 0xab, 0x9f, 0x68, 0xff, 0xba, 0xaa, 0x70, 0xff, 0xbd, 0xb9, 0x72, 0xff, 0xb6, 0xac, 0x9a, 0xff, 0x85, 0x7c, 0xb3, 0xff, 0x79, 0x79, 0xbd, 0xff, 0x75, 0x76, 0xb2, 0xff, 0x7d, 0x86, 0xb3, 0xff, 0x9b, 0xa6, 0xc8, 0xff, 0xa6, 0xaf, 0xd1, 0xff, 0xa3, 0xaa, 0xcf, 0xff, 0xa0, 0xa7, 0xcc, 0xff, 0xa1, 0xa9, 0xce, 0xff, 0xa3, 0xac, 0xd0, 0xff, 0xa1, 0xab, 0xd0, 0xff, 0x9f, 0xaa, 0xd0, 0xff, 0x9f, 0xab, 0xd1, 0xff, 0x9c, 0xaa, 0xd0, 0xff, 0x9c, 0xab, 0xd1, 0xff, 0x9c, 0xab, 0xd2, 0xff, 0x9b, 0xa9, 0xd3, 0xff, 0x9a, 0xa7, 0xd3, 0xff, 0x99, 0xa6, 0xd2, 0xff, 0x97, 0xa4, 0xd0, 0xff, 0x95, 0xa4, 0xcf, 0xff, 0x93, 0xa4, 0xce, 0xff, 0x92, 0xa2, 0xcc, 0xff, 0x91, 0xa1, 0xcb, 0xff, 0x90, 0xa0, 0xca, 0xff, 0x90, 0xa0, 0xca, 0xff, 0x90, 0xa0, 0xca, 0xff, 0x90, 0xa0, 0xca, 0xff, 0x8e, 0x9e, 0xc8, 0xff, 0x8c, 0x9c, 0xc6, 0xff, 0x8d, 0x9d, 0xc7, 0xff, 0x8d, 0x9d, 0xc7, 0xff, 0x8d, 0x9d, 0xc7, 0xff, 0x8c, 0x9d, 0xc6, 0xff, 0x8b, 0x9d, 0xc6, 0xff, 0x8b, 0x9d, 0xc6, 0xff, 0x8c, 0x9e, 0xc7, 0xff, 0x8a, 0x9c, 0xc5, 0xff, 0x89, 0x9a, 0xc4, 0xff, 0x89, 0x9b, 0xc4, 0xff, 0x89, 0x9c, 0xc2, 0xff, 0x86, 0x98, 0xbf, 0xff, 0x82, 0x94, 0xbd, 0xff, 0x82, 0x92, 0xbe, 0xff, 0x78, 0x89, 0xb7, 0xff, 0x69, 0x7d, 0xab, 0xff, 0x72, 0x87, 0xb6, 0xff, 0x7b, 0x8f, 0xc0, 0xff, 0x7c, 0x90, 0xc4, 0xff, 0x7b, 0x8d, 0xc2, 0xff, 0x7c, 0x8b, 0xc4, 0xff, 0x75, 0x85, 0xbe, 0xff, 0x6e, 0x81, 0xb2, 0xff, 0x6d, 0x81, 0xaf, 0xff, 0x6d, 0x82, 0xae, 0xff, 0x6d, 0x82, 0xae, 0xff, 0x6b, 0x80, 0xab, 0xff, 0x62, 0x7b, 0xa4, 0xff, 0x4c, 0x61, 0x8f, 0xff, 0x23, 0x2a, 0x45, 0xff, 0x0b, 0x0e, 0x19, 0xff, 0x17, 0x12, 0x10, 0xff, 0x17, 0x14, 0x0f, 0xff, 0x18, 0x17, 0x18, 0xff, 0x14, 0x11, 0x12, 0xff, 0x18, 0x14, 0x0e, 0xff, 0x1c, 0x17, 0x17, 0xff, 0x16, 0x12, 0x18, 0xff, 0x23, 0x1e, 0x15, 0xff, 0xa4, 0x9e, 0x7b, 0xff, 0xd9, 0xcb, 0x99, 0xff, 0xd6, 0xc5, 0x96, 0xff, 0xca, 0xbf, 0x94, 0xff, 0xcf, 0xc3, 0xa3, 0xff, 0xeb, 0xdb, 0xd1, 0xff, 0xf3, 0xe5, 0xe9, 0xff, 0xf1, 0xea, 0xf2, 0xff, 0xe9, 0xe4, 0xeb, 0xff, 0xe3, 0xe3, 0xe7, 0xff, 0xe9, 0xe5, 0xed, 0xff, 0xf3, 0xe9, 0xed, 0xff, 0xf7, 0xe9, 0xe1, 0xff, 0xef, 0xe1, 0xce, 0xff, 0xe4, 0xd4, 0xc3, 0xff, 0xed, 0xde, 0xd7, 0xff, 0xe9, 0xdd, 0xe0, 0xff, 0xe6, 0xdd, 0xe6, 0xff, 0xe9, 0xe0, 0xed, 0xff, 0xe5, 0xde, 0xeb, 0xff, 0xe0, 0xd9, 0xe6, 0xff, 0xe1, 0xd8, 0xe5, 0xff, 0xe5, 0xdd, 0xe3, 0xff, 0xe5, 0xdc, 0xd4, 0xff, 0xc7, 0xbc, 0xa6, 0xff, 0xa9, 0x9d, 0x78, 0xff, 0x9a, 0x8d, 0x60, 0xff, 0x99, 0x8c, 0x62, 0xff, 0xa7, 0x9d, 0x75, 0xff, 0xb3, 0xa9, 0x7b, 0xff, 0xb6, 0xaa, 0x82, 0xff, 0xc7, 0xb9, 0xa3, 0xff, 0xdf, 0xcf, 0xc4, 0xff, 0xe6, 0xd8, 0xd3, 0xff, 0xe8, 0xdf, 0xdd, 0xff, 0xe0, 0xd4, 0xd2, 0xff, 0xd7, 0xc9, 0xc3, 0xff, 0xdc, 0xd3, 0xc7, 0xff, 0xe6, 0xdd, 0xd5, 0xf3,
+    0xc1, 0xb5, 0x7c, 0xff, 0xc1, 0xb5, 0x7c, 0xff, 0xc1, 0xb5, 0x7b, 0xff, 0xc1, 0xb5, 0x7a, 0xff, 0xc0, 0xb4, 0x7a, 0xff, 0xc0, 0xb4, 0x7e, 0xff, 0xc5, 0xb7, 0x86, 0xff, 0xc7, 0xb9, 0x8a, 0xff, 0xca, 0xbb, 0x8a, 0xff, 0xc8, 0xba, 0x85, 0xff, 0xc4, 0xb9, 0x7f, 0xff, 0xc5, 0xba, 0x7f, 0xff, 0xc0, 0xb2, 0x7e, 0xff, 0xac, 0x9f, 0x69, 0xff, 0x9f, 0x93, 0x5b, 0xff, 0xa1, 0x96, 0x62, 0xff, 0xb0, 0xa3, 0x66, 0xff, 0xc2, 0xab, 0x72, 0xff, 0xbf, 0xb4, 0x78, 0xff, 0xb9, 0xb5, 0x93, 0xff, 0x86, 0x88, 0xaf, 0xff, 0x64, 0x6f, 0xb2, 0xff, 0x7b, 0x81, 0xc5, 0xff, 0x6a, 0x73, 0xb6, 0xff, 0x6d, 0x77, 0xab, 0xff, 0x8c, 0x96, 0xc0, 0xff, 0x9a, 0xa3, 0xcb, 0xff, 0x9b, 0xa2, 0xc7, 0xff, 0x9d, 0xa5, 0xc8, 0xff, 0xa1, 0xa9, 0xcd, 0xff, 0x9d, 0xa6, 0xcc, 0xff, 0x9d, 0xa8, 0xce, 0xff, 0x9e, 0xaa, 0xd0, 0xff, 0x9d, 0xaa, 0xd0, 0xff, 0x9b, 0xaa, 0xd1, 0xff, 0x9b, 0xaa, 0xd2, 0xff, 0x9a, 0xa8, 0xd2, 0xff, 0x9a, 0xa7, 0xd4, 0xff, 0x9a, 0xa6, 0xd3, 0xff, 0x99, 0xa5, 0xd1, 0xff, 0x97, 0xa5, 0xd0, 0xff, 0x94, 0xa4, 0xce, 0xff, 0x93, 0xa2, 0xcc, 0xff, 0x92, 0xa2, 0xcc, 0xff, 0x91, 0xa2, 0xcb, 0xff, 0x91, 0xa0, 0xcb, 0xff, 0x91, 0xa1, 0xcb, 0xff, 0x8e, 0x9e, 0xc8, 0xff, 0x8c, 0x9c, 0xc6, 0xff, 0x8d, 0x9c, 0xc6, 0xff, 0x8e, 0x9d, 0xc7, 0xff, 0x8d, 0x9d, 0xc7, 0xff, 0x8d, 0x9d, 0xc7, 0xff, 0x8d, 0x9e, 0xc8, 0xff, 0x8d, 0x9f, 0xc8, 0xff, 0x8d, 0x9f, 0xc8, 0xff, 0x8d, 0x9f, 0xc8, 0xff, 0x8a, 0x9c, 0xc5, 0xff, 0x89, 0x9b, 0xc4, 0xff, 0x89, 0x9b, 0xc4, 0xff, 0x89, 0x9c, 0xc2, 0xff, 0x86, 0x99, 0xc1, 0xff, 0x83, 0x94, 0xbf, 0xff, 0x82, 0x93, 0xbe, 0xff, 0x7a, 0x8c, 0xb8, 0xff, 0x70, 0x84, 0xb1, 0xff, 0x67, 0x7c, 0xad, 0xff, 0x69, 0x7f, 0xb0, 0xff, 0x6b, 0x81, 0xb1, 0xff, 0x6b, 0x81, 0xaf, 0xff, 0x68, 0x7d, 0xab, 0xff, 0x64, 0x79, 0xa9, 0xff, 0x69, 0x80, 0xaa, 0xff, 0x72, 0x87, 0xb0, 0xff, 0x74, 0x89, 0xb0, 0xff, 0x6d, 0x84, 0xa9, 0xff, 0x6b, 0x7f, 0xa7, 0xff, 0x65, 0x7a, 0xa9, 0xff, 0x4f, 0x62, 0x91, 0xff, 0x1e, 0x24, 0x3c, 0xff, 0x0b, 0x0a, 0x12, 0xff, 0x18, 0x13, 0x12, 0xff, 0x19, 0x16, 0x13, 0xff, 0x18, 0x17, 0x17, 0xff, 0x17, 0x14, 0x14, 0xff, 0x16, 0x15, 0x0f, 0xff, 0x1d, 0x1a, 0x1b, 0xff, 0x14, 0x04, 0x07, 0xff, 0x76, 0x65, 0x52, 0xff, 0xd5, 0xc8, 0x9d, 0xff, 0xe1, 0xd3, 0xac, 0xff, 0xe6, 0xd8, 0xbf, 0xff, 0xe3, 0xd5, 0xc2, 0xff, 0xed, 0xde, 0xd0, 0xff, 0xf0, 0xe2, 0xdf, 0xff, 0xf5, 0xeb, 0xee, 0xff, 0xef, 0xe9, 0xf2, 0xff, 0xe9, 0xe4, 0xf2, 0xff, 0xe3, 0xe3, 0xee, 0xff, 0xe1, 0xdd, 0xea, 0xff, 0xf1, 0xe5, 0xf1, 0xff, 0xf9, 0xe8, 0xea, 0xff, 0xf3, 0xe4, 0xda, 0xff, 0xf2, 0xe3, 0xd9, 0xff, 0xf1, 0xe4, 0xe4, 0xff, 0xf0, 0xe5, 0xe9, 0xff, 0xec, 0xe3, 0xe7, 0xff, 0xe8, 0xe3, 0xe9, 0xff, 0xe7, 0xe1, 0xe9, 0xff, 0xe9, 0xe2, 0xeb, 0xff, 0xea, 0xe2, 0xeb, 0xff, 0xe4, 0xdc, 0xdd, 0xff, 0xe1, 0xd8, 0xcf, 0xff, 0xbe, 0xb3, 0x9e, 0xff, 0xab, 0x9e, 0x7c, 0xff, 0xb0, 0xa1, 0x7c, 0xff, 0xaf, 0xa0, 0x80, 0xff, 0xa8, 0x99, 0x7d, 0xff, 0xa0, 0x94, 0x79, 0xff, 0xc4, 0xb9, 0xa4, 0xff, 0xf0, 0xe2, 0xdd, 0xff, 0xf3, 0xe3, 0xe6, 0xff, 0xee, 0xe2, 0xe6, 0xff, 0xe3, 0xda, 0xdd, 0xff, 0xdf, 0xd3, 0xd2, 0xff, 0xd9, 0xcd, 0xc8, 0xff, 0xdb, 0xd0, 0xc8, 0xff, 0xec, 0xe2, 0xdd, 0xff,
+    0xc3, 0xb5, 0x7d, 0xff, 0xc4, 0xb7, 0x7d, 0xff, 0xc3, 0xb7, 0x7c, 0xff, 0xc2, 0xb6, 0x7c, 0xff, 0xc2, 0xb5, 0x7d, 0xff, 0xbf, 0xb2, 0x7e, 0xff, 0xc2, 0xb4, 0x84, 0xff, 0xc5, 0xb6, 0x87, 0xff, 0xc6, 0xb7, 0x81, 0xff, 0xc3, 0xb5, 0x7c, 0xff, 0xc0, 0xb4, 0x79, 0xff, 0xc0, 0xb4, 0x78, 0xff, 0xba, 0xac, 0x74, 0xff, 0xae, 0x9f, 0x69, 0xff, 0xa5, 0x96, 0x62, 0xff, 0xa4, 0x98, 0x64, 0xff, 0xb0, 0xa4, 0x64, 0xff, 0xc2, 0xaa, 0x74, 0xff, 0xc4, 0xb2, 0x7c, 0xff, 0xc3, 0xbd, 0x85, 0xff, 0xa4, 0xa4, 0xaf, 0xff, 0x68, 0x6d, 0xb4, 0xff, 0x54, 0x5b, 0xa9, 0xff, 0x57, 0x64, 0x9f, 0xff, 0x66, 0x71, 0xa2, 0xff, 0x68, 0x6f, 0xa5, 0xff, 0x7f, 0x88, 0xba, 0xff, 0x8d, 0x95, 0xc0, 0xff, 0x94, 0x9b, 0xc1, 0xff, 0x9a, 0xa2, 0xc8, 0xff, 0x9a, 0xa5, 0xc9, 0xff, 0x9a, 0xa6, 0xcc, 0xff, 0x9a, 0xa7, 0xcd, 0xff, 0x9b, 0xa8, 0xce, 0xff, 0x9a, 0xaa, 0xd0, 0xff, 0x9b, 0xaa, 0xd1, 0xff, 0x9a, 0xa8, 0xd1, 0xff, 0x98, 0xa6, 0xd1, 0xff, 0x98, 0xa5, 0xd1, 0xff, 0x97, 0xa4, 0xd0, 0xff, 0x95, 0xa4, 0xcf, 0xff, 0x94, 0xa4, 0xce, 0xff, 0x94, 0xa4, 0xce, 0xff, 0x92, 0xa3, 0xce, 0xff, 0x91, 0xa2, 0xcb, 0xff, 0x91, 0xa1, 0xcb, 0xff, 0x91, 0xa1, 0xcb, 0xff, 0x8e, 0x9f, 0xc9, 0xff, 0x8d, 0x9d, 0xc7, 0xff, 0x8e, 0x9f, 0xc9, 0xff, 0x8d, 0x9e, 0xc8, 0xff, 0x8d, 0x9e, 0xc7, 0xff, 0x8e, 0x9e, 0xc8, 0xff, 0x8d, 0x9f, 0xc7, 0xff, 0x8d, 0x9f, 0xc7, 0xff, 0x8d, 0x9f, 0xc7, 0xff, 0x8d, 0x9f, 0xc7, 0xff, 0x8a, 0x9d, 0xc5, 0xff, 0x89, 0x9b, 0xc3, 0xff, 0x89, 0x9b, 0xc2, 0xff, 0x87, 0x9a, 0xc0, 0xff, 0x85, 0x97, 0xbf, 0xff, 0x82, 0x93, 0xbd, 0xff, 0x82, 0x93, 0xbc, 0xff, 0x7c, 0x8e, 0xb8, 0xff, 0x72, 0x85, 0xb1, 0xff, 0x6b, 0x81, 0xb1, 0xff, 0x64, 0x7b, 0xab, 0xff, 0x61, 0x79, 0xa7, 0xff, 0x62, 0x7b, 0xa6, 0xff, 0x64, 0x7d, 0xa7, 0xff, 0x6b, 0x83, 0xaf, 0xff, 0x73, 0x8c, 0xb2, 0xff, 0x79, 0x8d, 0xb3, 0xff, 0x77, 0x8b, 0xb1, 0xff, 0x75, 0x8b, 0xae, 0xff, 0x72, 0x85, 0xab, 0xff, 0x68, 0x7a, 0xad, 0xff, 0x4a, 0x5c, 0x8b, 0xff, 0x18, 0x1c, 0x2f, 0xff, 0x09, 0x06, 0x0b, 0xff, 0x1a, 0x14, 0x12, 0xff, 0x19, 0x17, 0x16, 0xff, 0x13, 0x12, 0x13, 0xff, 0x18, 0x14, 0x15, 0xff, 0x17, 0x16, 0x11, 0xff, 0x13, 0x11, 0x10, 0xff, 0x4c, 0x37, 0x36, 0xff, 0xc9, 0xaf, 0x97, 0xff, 0xe0, 0xcc, 0xa4, 0xff, 0xe5, 0xd6, 0xbb, 0xff, 0xea, 0xdc, 0xd3, 0xff, 0xf2, 0xe2, 0xe1, 0xff, 0xf8, 0xe9, 0xea, 0xff, 0xf2, 0xe8, 0xec, 0xff, 0xf5, 0xed, 0xf4, 0xff, 0xf0, 0xe7, 0xf4, 0xff, 0xeb, 0xe2, 0xf4, 0xff, 0xe5, 0xdf, 0xef, 0xff, 0xdf, 0xdb, 0xe6, 0xff, 0xe7, 0xdb, 0xe7, 0xff, 0xee, 0xdf, 0xe4, 0xff, 0xed, 0xe0, 0xdb, 0xff, 0xee, 0xe1, 0xd9, 0xff, 0xed, 0xe2, 0xde, 0xff, 0xf6, 0xec, 0xed, 0xff, 0xf2, 0xe8, 0xea, 0xff, 0xeb, 0xe5, 0xe6, 0xff, 0xeb, 0xe6, 0xe8, 0xff, 0xee, 0xe6, 0xed, 0xff, 0xf3, 0xe9, 0xf0, 0xff, 0xee, 0xe4, 0xe4, 0xff, 0xe7, 0xdd, 0xd5, 0xff, 0xc5, 0xb8, 0xa6, 0xff, 0xb4, 0xa4, 0x87, 0xff, 0xb7, 0xa7, 0x8a, 0xff, 0xa9, 0x99, 0x84, 0xff, 0xac, 0x9c, 0x8d, 0xff, 0xc9, 0xbd, 0xb2, 0xff, 0xe9, 0xdf, 0xdd, 0xff, 0xf4, 0xe9, 0xf0, 0xff, 0xf4, 0xe7, 0xf6, 0xff, 0xf4, 0xea, 0xfa, 0xff, 0xe8, 0xe0, 0xeb, 0xff, 0xe5, 0xd9, 0xdf, 0xff, 0xe4, 0xd8, 0xda, 0xff, 0xea, 0xe0, 0xdf, 0xff, 0xf2, 0xe8, 0xe8, 0xff,
+    0xc2, 0xb4, 0x7b, 0xf3, 0xc4, 0xb7, 0x7b, 0xff, 0xc4, 0xb7, 0x7c, 0xff, 0xc3, 0xb6, 0x7f, 0xff, 0xc2, 0xb6, 0x83, 0xff, 0xc0, 0xb2, 0x82, 0xff, 0xc2, 0xb3, 0x82, 0xff, 0xc3, 0xb4, 0x81, 0xff, 0xc2, 0xb6, 0x7c, 0xff, 0xc3, 0xb7, 0x7c, 0xff, 0xc4, 0xb7, 0x7d, 0xff, 0xc1, 0xb4, 0x7a, 0xff, 0xbb, 0xaf, 0x75, 0xff, 0xaf, 0xa2, 0x69, 0xff, 0xa7, 0x98, 0x63, 0xff, 0xa7, 0x98, 0x64, 0xff, 0xad, 0xa1, 0x68, 0xff, 0xb8, 0xab, 0x71, 0xff, 0xc0, 0xb3, 0x7b, 0xff, 0xc7, 0xb9, 0x7c, 0xff, 0xc2, 0xb7, 0x91, 0xff, 0x90, 0x8b, 0xb1, 0xff, 0x29, 0x2d, 0x87, 0xff, 0x28, 0x37, 0x6b, 0xff, 0x7c, 0x82, 0xa6, 0xff, 0x5d, 0x5b, 0x9a, 0xff, 0x48, 0x51, 0x89, 0xff, 0x61, 0x6c, 0x9e, 0xff, 0x82, 0x89, 0xb9, 0xff, 0x93, 0x9d, 0xc6, 0xff, 0x96, 0xa3, 0xc6, 0xff, 0x95, 0xa4, 0xc8, 0xff, 0x97, 0xa3, 0xca, 0xff, 0x9a, 0xa7, 0xce, 0xff, 0x9a, 0xaa, 0xcf, 0xff, 0x9b, 0xab, 0xd0, 0xff, 0x9b, 0xaa, 0xd1, 0xff, 0x99, 0xa8, 0xce, 0xff, 0x97, 0xa6, 0xce, 0xff, 0x95, 0xa5, 0xd0, 0xff, 0x94, 0xa5, 0xd0, 0xff, 0x93, 0xa4, 0xcf, 0xff, 0x92, 0xa3, 0xce, 0xff, 0x91, 0xa3, 0xcd, 0xff, 0x90, 0xa2, 0xcb, 0xff, 0x90, 0xa2, 0xcb, 0xff, 0x8f, 0xa1, 0xca, 0xff, 0x8e, 0xa0, 0xc9, 0xff, 0x8e, 0xa0, 0xc9, 0xff, 0x8e, 0xa0, 0xc9, 0xff, 0x8b, 0x9d, 0xc6, 0xff, 0x8b, 0x9d, 0xc6, 0xff, 0x8d, 0x9f, 0xc9, 0xff, 0x8d, 0x9f, 0xc6, 0xff, 0x8c, 0x9f, 0xc3, 0xff, 0x8c, 0x9f, 0xc4, 0xff, 0x8c, 0x9f, 0xc4, 0xff, 0x8a, 0x9e, 0xc3, 0xff, 0x89, 0x9c, 0xc1, 0xff, 0x89, 0x9c, 0xc1, 0xff, 0x88, 0x9b, 0xc0, 0xff, 0x86, 0x99, 0xbf, 0xff, 0x83, 0x95, 0xbb, 0xff, 0x80, 0x92, 0xb8, 0xff, 0x7c, 0x8f, 0xb6, 0xff, 0x75, 0x87, 0xb1, 0xff, 0x6f, 0x85, 0xb1, 0xff, 0x6b, 0x84, 0xb1, 0xff, 0x6c, 0x83, 0xb2, 0xff, 0x6d, 0x85, 0xb3, 0xff, 0x6f, 0x86, 0xb4, 0xff, 0x74, 0x8b, 0xb6, 0xff, 0x78, 0x8d, 0xb7, 0xff, 0x7f, 0x8f, 0xbb, 0xff, 0x7f, 0x90, 0xb9, 0xff, 0x7a, 0x8d, 0xb3, 0xff, 0x75, 0x86, 0xaf, 0xff, 0x6f, 0x80, 0xb0, 0xff, 0x50, 0x60, 0x8c, 0xff, 0x18, 0x19, 0x2b, 0xff, 0x0e, 0x09, 0x0c, 0xff, 0x20, 0x1a, 0x16, 0xff, 0x1b, 0x17, 0x18, 0xff, 0x10, 0x0e, 0x11, 0xff, 0x16, 0x11, 0x11, 0xff, 0x23, 0x1e, 0x1d, 0xff, 0x0c, 0x07, 0x05, 0xff, 0x82, 0x74, 0x6e, 0xff, 0xff, 0xe8, 0xd7, 0xff, 0xe5, 0xd1, 0xb6, 0xff, 0xe2, 0xd5, 0xba, 0xff, 0xf1, 0xe4, 0xd5, 0xff, 0xf7, 0xe9, 0xe7, 0xff, 0xf3, 0xe7, 0xeb, 0xff, 0xf5, 0xea, 0xf4, 0xff, 0xf5, 0xed, 0xfc, 0xff, 0xf0, 0xea, 0xf9, 0xff, 0xe9, 0xe4, 0xef, 0xff, 0xe0, 0xd9, 0xe4, 0xff, 0xe1, 0xd6, 0xe3, 0xff, 0xdd, 0xd2, 0xdc, 0xff, 0xd8, 0xcd, 0xd5, 0xff, 0xe0, 0xd4, 0xd7, 0xff, 0xe3, 0xd8, 0xd3, 0xff, 0xed, 0xe1, 0xda, 0xff, 0xf5, 0xe8, 0xe6, 0xff, 0xf3, 0xe8, 0xe9, 0xff, 0xec, 0xe5, 0xe5, 0xff, 0xe4, 0xde, 0xe0, 0xff, 0xe5, 0xdc, 0xe4, 0xff, 0xf0, 0xe3, 0xef, 0xff, 0xf1, 0xe5, 0xeb, 0xff, 0xe6, 0xdb, 0xd7, 0xff, 0xcb, 0xbe, 0xb3, 0xff, 0xb9, 0xa8, 0x98, 0xff, 0xae, 0x9c, 0x8a, 0xff, 0xb0, 0xa2, 0x95, 0xff, 0xd7, 0xcd, 0xc6, 0xff, 0xed, 0xe3, 0xe6, 0xff, 0xf0, 0xe7, 0xf0, 0xff, 0xf6, 0xee, 0xfb, 0xff, 0xf2, 0xec, 0xfd, 0xff, 0xf4, 0xef, 0xff, 0xff, 0xe9, 0xe2, 0xf1, 0xff, 0xe2, 0xd9, 0xe7, 0xff, 0xee, 0xe4, 0xf1, 0xff, 0xf3, 0xeb, 0xf5, 0xff, 0xf0, 0xe7, 0xef, 0xf3,
+    0xc2, 0xb3, 0x7d, 0xf0, 0xc2, 0xb5, 0x7f, 0xff, 0xc5, 0xb8, 0x84, 0xff, 0xc4, 0xb9, 0x86, 0xff, 0xc4, 0xba, 0x89, 0xff, 0xc2, 0xb5, 0x85, 0xff, 0xc1, 0xb4, 0x7f, 0xff, 0xc3, 0xb6, 0x7f, 0xff, 0xc3, 0xb7, 0x7d, 0xff, 0xc3, 0xb7, 0x7d, 0xff, 0xc3, 0xb7, 0x7d, 0xff, 0xc1, 0xb5, 0x7b, 0xff, 0xbd, 0xb1, 0x77, 0xff, 0xb0, 0xa3, 0x6b, 0xff, 0xa8, 0x9b, 0x65, 0xff, 0xa9, 0x9c, 0x68, 0xff, 0xaf, 0xa2, 0x6d, 0xff, 0xb8, 0xad, 0x70, 0xff, 0xbc, 0xb1, 0x7c, 0xff, 0xc3, 0xb1, 0x7e, 0xff, 0xbd, 0xbe, 0x75, 0xff, 0xa8, 0xb0, 0x9d, 0xff, 0x5a, 0x53, 0xa6, 0xff, 0x3a, 0x37, 0x89, 0xff, 0x49, 0x42, 0x82, 0xff, 0x48, 0x42, 0x85, 0xff, 0x33, 0x3c, 0x66, 0xff, 0x31, 0x3b, 0x67, 0xff, 0x51, 0x58, 0x89, 0xff, 0x82, 0x8c, 0xb5, 0xff, 0x98, 0xa5, 0xc8, 0xff, 0x94, 0xa2, 0xc6, 0xff, 0x96, 0xa3, 0xc9, 0xff, 0x98, 0xa4, 0xcc, 0xff, 0x98, 0xa8, 0xce, 0xff, 0x99, 0xa8, 0xd0, 0xff, 0x99, 0xa7, 0xd2, 0xff, 0x99, 0xa7, 0xcf, 0xff, 0x97, 0xa6, 0xce, 0xff, 0x94, 0xa4, 0xcf, 0xff, 0x93, 0xa4, 0xcf, 0xff, 0x92, 0xa3, 0xce, 0xff, 0x91, 0xa2, 0xcd, 0xff, 0x91, 0xa2, 0xcd, 0xff, 0x90, 0xa3, 0xcb, 0xff, 0x8f, 0xa1, 0xca, 0xff, 0x8e, 0xa0, 0xc9, 0xff, 0x8d, 0x9f, 0xc8, 0xff, 0x8d, 0x9f, 0xc8, 0xff, 0x8c, 0x9e, 0xc7, 0xff, 0x8c, 0x9e, 0xc7, 0xff, 0x8c, 0x9e, 0xc7, 0xff, 0x8a, 0x9c, 0xc6, 0xff, 0x8a, 0x9c, 0xc4, 0xff, 0x8a, 0x9d, 0xc4, 0xff, 0x8a, 0x9d, 0xc4, 0xff, 0x8a, 0x9d, 0xc4, 0xff, 0x88, 0x9b, 0xc1, 0xff, 0x88, 0x9b, 0xc1, 0xff, 0x89, 0x9b, 0xc2, 0xff, 0x86, 0x99, 0xc0, 0xff, 0x86, 0x98, 0xbf, 0xff, 0x83, 0x95, 0xbc, 0xff, 0x80, 0x93, 0xb8, 0xff, 0x7e, 0x90, 0xb7, 0xff, 0x78, 0x8a, 0xb4, 0xff, 0x72, 0x87, 0xb3, 0xff, 0x6f, 0x86, 0xb3, 0xff, 0x70, 0x87, 0xb3, 0xff, 0x72, 0x88, 0xb6, 0xff, 0x75, 0x8b, 0xb9, 0xff, 0x7b, 0x90, 0xbc, 0xff, 0x7f, 0x92, 0xbd, 0xff, 0x7f, 0x91, 0xba, 0xff, 0x80, 0x93, 0xb9, 0xff, 0x7e, 0x92, 0xb7, 0xff, 0x78, 0x8a, 0xb0, 0xff, 0x75, 0x87, 0xb3, 0xff, 0x50, 0x62, 0x8c, 0xff, 0x15, 0x17, 0x2a, 0xff, 0x13, 0x0e, 0x12, 0xff, 0x1e, 0x18, 0x13, 0xff, 0x19, 0x16, 0x16, 0xff, 0x14, 0x13, 0x15, 0xff, 0x17, 0x12, 0x12, 0xff, 0x26, 0x20, 0x20, 0xff, 0x0e, 0x08, 0x08, 0xff, 0x9f, 0x92, 0x8e, 0xff, 0xff, 0xf6, 0xe5, 0xff, 0xe8, 0xd7, 0xbd, 0xff, 0xe3, 0xd6, 0xbe, 0xff, 0xee, 0xe2, 0xd6, 0xff, 0xf1, 0xe4, 0xe3, 0xff, 0xec, 0xdf, 0xe2, 0xff, 0xf4, 0xe7, 0xee, 0xff, 0xf0, 0xe5, 0xf0, 0xff, 0xed, 0xe4, 0xf0, 0xff, 0xe8, 0xe2, 0xec, 0xff, 0xe0, 0xda, 0xe6, 0xff, 0xdf, 0xd4, 0xe3, 0xff, 0xd2, 0xc8, 0xd5, 0xff, 0xcd, 0xc2, 0xce, 0xff, 0xc9, 0xbe, 0xc7, 0xff, 0xd5, 0xcb, 0xcd, 0xff, 0xe8, 0xdc, 0xdc, 0xff, 0xe7, 0xdb, 0xdd, 0xff, 0xe8, 0xe1, 0xe3, 0xff, 0xe4, 0xe0, 0xe3, 0xff, 0xd9, 0xd4, 0xda, 0xff, 0xde, 0xd6, 0xe2, 0xff, 0xe9, 0xdf, 0xee, 0xff, 0xe5, 0xdc, 0xe6, 0xff, 0xdd, 0xd4, 0xd7, 0xff, 0xd9, 0xcf, 0xcd, 0xff, 0xc7, 0xbc, 0xb6, 0xff, 0xc4, 0xb7, 0xb0, 0xff, 0xd8, 0xcc, 0xc9, 0xff, 0xed, 0xe2, 0xe4, 0xff, 0xf0, 0xe6, 0xef, 0xff, 0xf3, 0xeb, 0xf9, 0xff, 0xf6, 0xf1, 0xff, 0xff, 0xee, 0xeb, 0xfc, 0xff, 0xeb, 0xe7, 0xf8, 0xff, 0xe2, 0xdd, 0xed, 0xff, 0xe7, 0xe0, 0xef, 0xff, 0xf2, 0xe9, 0xf3, 0xff, 0xf7, 0xed, 0xf8, 0xff, 0xf9, 0xef, 0xfa, 0xf0,
+    0xc1, 0xb2, 0x7c, 0xe7, 0xc3, 0xb6, 0x86, 0xff, 0xc9, 0xbe, 0x91, 0xff, 0xc4, 0xbc, 0x8d, 0xff, 0xc3, 0xbb, 0x8b, 0xff, 0xc3, 0xb8, 0x87, 0xff, 0xc2, 0xb8, 0x81, 0xff, 0xc2, 0xb7, 0x7b, 0xff, 0xc2, 0xb7, 0x7c, 0xff, 0xc3, 0xb7, 0x7d, 0xff, 0xc3, 0xb7, 0x7d, 0xff, 0xc2, 0xb7, 0x7c, 0xff, 0xbe, 0xb2, 0x78, 0xff, 0xb3, 0xa6, 0x6d, 0xff, 0xab, 0x9d, 0x68, 0xff, 0xaa, 0x9d, 0x6a, 0xff, 0xaf, 0xa3, 0x6e, 0xff, 0xb7, 0xac, 0x74, 0xff, 0xbb, 0xb1, 0x7d, 0xff, 0xc3, 0xb4, 0x7c, 0xff, 0xbc, 0xb5, 0x83, 0xff, 0xc1, 0xba, 0xbe, 0xff, 0xae, 0xa1, 0xe2, 0xff, 0x98, 0x92, 0xd6, 0xff, 0x8e, 0x85, 0xc3, 0xff, 0x87, 0x7f, 0xbf, 0xff, 0x74, 0x76, 0xaa, 0xff, 0x67, 0x6d, 0xa0, 0xff, 0x64, 0x6d, 0x9b, 0xff, 0x88, 0x92, 0xba, 0xff, 0x94, 0xa0, 0xc4, 0xff, 0x92, 0xa0, 0xc4, 0xff, 0x96, 0xa2, 0xc9, 0xff, 0x96, 0xa3, 0xca, 0xff, 0x96, 0xa4, 0xcc, 0xff, 0x97, 0xa6, 0xcf, 0xff, 0x97, 0xa5, 0xd1, 0xff, 0x97, 0xa5, 0xcd, 0xff, 0x95, 0xa4, 0xcc, 0xff, 0x92, 0xa2, 0xcd, 0xff, 0x92, 0xa3, 0xce, 0xff, 0x91, 0xa3, 0xce, 0xff, 0x90, 0xa1, 0xcd, 0xff, 0x91, 0xa2, 0xcd, 0xff, 0x91, 0xa3, 0xcc, 0xff, 0x8e, 0xa0, 0xc9, 0xff, 0x8c, 0x9e, 0xc7, 0xff, 0x8c, 0x9e, 0xc7, 0xff, 0x8c, 0x9e, 0xc7, 0xff, 0x8b, 0x9d, 0xc6, 0xff, 0x8d, 0x9f, 0xc8, 0xff, 0x8c, 0x9e, 0xc7, 0xff, 0x89, 0x9b, 0xc4, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x86, 0x98, 0xc1, 0xff, 0x86, 0x98, 0xc1, 0xff, 0x85, 0x97, 0xc0, 0xff, 0x85, 0x97, 0xc0, 0xff, 0x83, 0x94, 0xbe, 0xff, 0x80, 0x93, 0xb9, 0xff, 0x7f, 0x91, 0xb8, 0xff, 0x7a, 0x8d, 0xb7, 0xff, 0x76, 0x8b, 0xb5, 0xff, 0x74, 0x8b, 0xb4, 0xff, 0x76, 0x8c, 0xb5, 0xff, 0x78, 0x8e, 0xb9, 0xff, 0x79, 0x8e, 0xbc, 0xff, 0x7c, 0x90, 0xbc, 0xff, 0x7f, 0x91, 0xbc, 0xff, 0x83, 0x96, 0xbc, 0xff, 0x85, 0x98, 0xbd, 0xff, 0x83, 0x97, 0xbc, 0xff, 0x7e, 0x91, 0xb5, 0xff, 0x76, 0x89, 0xb4, 0xff, 0x50, 0x62, 0x8b, 0xff, 0x13, 0x15, 0x27, 0xff, 0x13, 0x0e, 0x12, 0xff, 0x21, 0x1b, 0x16, 0xff, 0x18, 0x15, 0x15, 0xff, 0x1c, 0x1b, 0x1c, 0xff, 0x24, 0x1e, 0x1f, 0xff, 0x1e, 0x18, 0x18, 0xff, 0x28, 0x21, 0x23, 0xff, 0xbe, 0xb1, 0xae, 0xff, 0xff, 0xf0, 0xe0, 0xff, 0xe4, 0xd4, 0xbd, 0xff, 0xe2, 0xd4, 0xbf, 0xff, 0xe6, 0xd9, 0xd0, 0xff, 0xe7, 0xdb, 0xdb, 0xff, 0xe2, 0xd5, 0xd7, 0xff, 0xeb, 0xdc, 0xe0, 0xff, 0xed, 0xde, 0xe6, 0xff, 0xe6, 0xda, 0xe4, 0xff, 0xe0, 0xd9, 0xe4, 0xff, 0xe3, 0xde, 0xea, 0xff, 0xe4, 0xdb, 0xeb, 0xff, 0xce, 0xc4, 0xd4, 0xff, 0xc8, 0xbd, 0xce, 0xff, 0xc4, 0xba, 0xc9, 0xff, 0xcf, 0xc6, 0xce, 0xff, 0xe0, 0xd5, 0xdd, 0xff, 0xe2, 0xd9, 0xdf, 0xff, 0xe1, 0xdb, 0xe0, 0xff, 0xd5, 0xd2, 0xd8, 0xff, 0xd6, 0xd4, 0xdd, 0xff, 0xe0, 0xda, 0xe8, 0xff, 0xe3, 0xdb, 0xeb, 0xff, 0xe2, 0xdb, 0xe6, 0xff, 0xe2, 0xdb, 0xe4, 0xff, 0xe1, 0xda, 0xe2, 0xff, 0xd9, 0xd2, 0xd7, 0xff, 0xde, 0xd3, 0xd9, 0xff, 0xe7, 0xdb, 0xe4, 0xff, 0xee, 0xe3, 0xed, 0xff, 0xf6, 0xec, 0xfb, 0xff, 0xf7, 0xf0, 0xff, 0xff, 0xe9, 0xe6, 0xf9, 0xff, 0xdc, 0xda, 0xee, 0xff, 0xd4, 0xd1, 0xe4, 0xff, 0xd0, 0xcc, 0xde, 0xff, 0xe0, 0xda, 0xe9, 0xff, 0xe6, 0xde, 0xe7, 0xff, 0xf7, 0xed, 0xf8, 0xff, 0xff, 0xf5, 0xff, 0xe6,
+    0xc2, 0xb5, 0x7d, 0xd3, 0xc3, 0xb7, 0x8b, 0xff, 0xc5, 0xbd, 0x94, 0xff, 0xc4, 0xbc, 0x91, 0xff, 0xc3, 0xbc, 0x8e, 0xff, 0xc2, 0xbb, 0x87, 0xff, 0xc1, 0xb8, 0x7d, 0xff, 0xc3, 0xb7, 0x7d, 0xff, 0xc4, 0xb7, 0x7f, 0xff, 0xc3, 0xb6, 0x7e, 0xff, 0xc3, 0xb6, 0x7e, 0xff, 0xc2, 0xb5, 0x7d, 0xff, 0xbe, 0xb1, 0x79, 0xff, 0xb5, 0xa7, 0x71, 0xff, 0xad, 0x9e, 0x6b, 0xff, 0xac, 0x9f, 0x6b, 0xff, 0xb1, 0xa4, 0x6f, 0xff, 0xb8, 0xa8, 0x77, 0xff, 0xbc, 0xb0, 0x7e, 0xff, 0xc1, 0xb6, 0x79, 0xff, 0xca, 0xbb, 0xa7, 0xff, 0xc3, 0xb1, 0xde, 0xff, 0xac, 0x9e, 0xe0, 0xff, 0x99, 0x92, 0xca, 0xff, 0x8e, 0x8b, 0xb9, 0xff, 0x89, 0x85, 0xbe, 0xff, 0x91, 0x8f, 0xcb, 0xff, 0x96, 0x9c, 0xcf, 0xff, 0x9b, 0xa5, 0xd0, 0xff, 0x97, 0xa0, 0xca, 0xff, 0x92, 0x9d, 0xc3, 0xff, 0x92, 0x9e, 0xc4, 0xff, 0x93, 0xa1, 0xc7, 0xff, 0x94, 0xa4, 0xc9, 0xff, 0x91, 0xa2, 0xc9, 0xff, 0x93, 0xa3, 0xcd, 0xff, 0x93, 0xa3, 0xcf, 0xff, 0x92, 0xa2, 0xcd, 0xff, 0x92, 0xa2, 0xcd, 0xff, 0x93, 0xa3, 0xce, 0xff, 0x91, 0xa2, 0xcd, 0xff, 0x90, 0xa1, 0xcc, 0xff, 0x90, 0xa1, 0xcd, 0xff, 0x90, 0xa1, 0xcb, 0xff, 0x8e, 0xa0, 0xc9, 0xff, 0x8c, 0x9e, 0xc7, 0xff, 0x8b, 0x9d, 0xc6, 0xff, 0x8b, 0x9d, 0xc6, 0xff, 0x8b, 0x9d, 0xc6, 0xff, 0x8a, 0x9c, 0xc5, 0xff, 0x8b, 0x9d, 0xc6, 0xff, 0x8a, 0x9c, 0xc5, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x87, 0x99, 0xc2, 0xff, 0x87, 0x99, 0xc2, 0xff, 0x87, 0x9a, 0xc2, 0xff, 0x88, 0x9a, 0xc2, 0xff, 0x86, 0x98, 0xc1, 0xff, 0x85, 0x97, 0xc0, 0xff, 0x84, 0x96, 0xbf, 0xff, 0x84, 0x96, 0xbf, 0xff, 0x82, 0x95, 0xbd, 0xff, 0x80, 0x92, 0xba, 0xff, 0x7f, 0x91, 0xba, 0xff, 0x7e, 0x90, 0xb8, 0xff, 0x7a, 0x8e, 0xb8, 0xff, 0x78, 0x8f, 0xb9, 0xff, 0x79, 0x8f, 0xb9, 0xff, 0x7a, 0x91, 0xbb, 0xff, 0x7a, 0x92, 0xbd, 0xff, 0x7d, 0x93, 0xbe, 0xff, 0x82, 0x94, 0xbf, 0xff, 0x88, 0x99, 0xc0, 0xff, 0x8a, 0x9c, 0xc0, 0xff, 0x86, 0x9a, 0xbd, 0xff, 0x83, 0x95, 0xb8, 0xff, 0x7a, 0x8d, 0xb7, 0xff, 0x53, 0x63, 0x8e, 0xff, 0x14, 0x16, 0x28, 0xff, 0x14, 0x11, 0x12, 0xff, 0x2a, 0x23, 0x1f, 0xff, 0x18, 0x15, 0x15, 0xff, 0x1b, 0x19, 0x1b, 0xff, 0x28, 0x22, 0x24, 0xff, 0x0c, 0x05, 0x08, 0xff, 0x66, 0x5e, 0x64, 0xff, 0xee, 0xe1, 0xe2, 0xff, 0xf0, 0xe0, 0xd4, 0xff, 0xde, 0xd1, 0xbb, 0xff, 0xdd, 0xce, 0xba, 0xff, 0xe6, 0xd5, 0xd0, 0xff, 0xe2, 0xd7, 0xdb, 0xff, 0xd8, 0xce, 0xce, 0xff, 0xdc, 0xce, 0xcb, 0xff, 0xe2, 0xd3, 0xd3, 0xff, 0xd6, 0xca, 0xcf, 0xff, 0xd1, 0xc9, 0xd3, 0xff, 0xdd, 0xd8, 0xe2, 0xff, 0xd8, 0xd2, 0xdd, 0xff, 0xca, 0xc3, 0xd1, 0xff, 0xca, 0xc2, 0xd3, 0xff, 0xd3, 0xc9, 0xdc, 0xff, 0xd3, 0xca, 0xd9, 0xff, 0xd6, 0xcd, 0xd8, 0xff, 0xe4, 0xdc, 0xe6, 0xff, 0xe1, 0xda, 0xe3, 0xff, 0xd2, 0xcf, 0xd8, 0xff, 0xd7, 0xd5, 0xe0, 0xff, 0xdf, 0xdb, 0xe8, 0xff, 0xdd, 0xd7, 0xe4, 0xff, 0xe9, 0xe2, 0xef, 0xff, 0xed, 0xe6, 0xf4, 0xff, 0xe1, 0xdb, 0xe8, 0xff, 0xe3, 0xe0, 0xeb, 0xff, 0xe8, 0xe1, 0xee, 0xff, 0xea, 0xdf, 0xee, 0xff, 0xf1, 0xe8, 0xf8, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xef, 0xeb, 0xff, 0xff, 0xd7, 0xd6, 0xea, 0xff, 0xcd, 0xca, 0xdf, 0xff, 0xc4, 0xc1, 0xd7, 0xff, 0xc0, 0xbe, 0xce, 0xff, 0xd4, 0xca, 0xd6, 0xff, 0xe9, 0xdb, 0xe7, 0xff, 0xf6, 0xed, 0xf8, 0xff, 0xf2, 0xee, 0xfa, 0xd3,
+    0xc6, 0xb9, 0x82, 0xbe, 0xc6, 0xba, 0x8d, 0xff, 0xc5, 0xbd, 0x92, 0xff, 0xc7, 0xbe, 0x90, 0xff, 0xc9, 0xbf, 0x91, 0xff, 0xc2, 0xb9, 0x84, 0xff, 0xc4, 0xb9, 0x7e, 0xff, 0xc6, 0xb8, 0x80, 0xff, 0xc5, 0xb7, 0x80, 0xff, 0xc4, 0xb7, 0x7f, 0xff, 0xc4, 0xb7, 0x7f, 0xff, 0xc3, 0xb6, 0x7e, 0xff, 0xc1, 0xb4, 0x7c, 0xff, 0xbb, 0xad, 0x77, 0xff, 0xb3, 0xa6, 0x72, 0xff, 0xb1, 0xa5, 0x71, 0xff, 0xb5, 0xa9, 0x75, 0xff, 0xb9, 0xad, 0x79, 0xff, 0xbc, 0xb1, 0x7d, 0xff, 0xc4, 0xb4, 0x81, 0xff, 0xc0, 0xb4, 0xae, 0xff, 0xa2, 0x97, 0xd2, 0xff, 0x8e, 0x83, 0xcb, 0xff, 0x85, 0x7f, 0xc1, 0xff, 0x83, 0x87, 0xb6, 0xff, 0x86, 0x8d, 0xb9, 0xff, 0x90, 0x97, 0xc2, 0xff, 0x97, 0xa0, 0xc9, 0xff, 0x96, 0xa0, 0xca, 0xff, 0x95, 0x9f, 0xc7, 0xff, 0x94, 0x9e, 0xc5, 0xff, 0x93, 0x9f, 0xc5, 0xff, 0x93, 0xa1, 0xc6, 0xff, 0x92, 0xa3, 0xc8, 0xff, 0x90, 0xa1, 0xc8, 0xff, 0x90, 0xa1, 0xca, 0xff, 0x90, 0xa1, 0xcb, 0xff, 0x92, 0xa2, 0xcd, 0xff, 0x92, 0xa2, 0xcd, 0xff, 0x91, 0xa1, 0xcc, 0xff, 0x91, 0xa2, 0xcd, 0xff, 0x8f, 0xa0, 0xcb, 0xff, 0x8e, 0x9f, 0xca, 0xff, 0x8c, 0x9e, 0xc8, 0xff, 0x8b, 0x9d, 0xc6, 0xff, 0x8b, 0x9d, 0xc6, 0xff, 0x8b, 0x9d, 0xc6, 0xff, 0x89, 0x9b, 0xc4, 0xff, 0x89, 0x9b, 0xc4, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x87, 0x99, 0xc2, 0xff, 0x87, 0x99, 0xc2, 0xff, 0x87, 0x99, 0xc2, 0xff, 0x87, 0x99, 0xc2, 0xff, 0x86, 0x98, 0xc1, 0xff, 0x85, 0x97, 0xc0, 0xff, 0x86, 0x98, 0xc1, 0xff, 0x85, 0x97, 0xc1, 0xff, 0x84, 0x95, 0xbf, 0xff, 0x82, 0x94, 0xbe, 0xff, 0x82, 0x94, 0xbe, 0xff, 0x82, 0x94, 0xbd, 0xff, 0x80, 0x92, 0xbc, 0xff, 0x80, 0x92, 0xbc, 0xff, 0x7f, 0x91, 0xbb, 0xff, 0x7e, 0x8f, 0xb9, 0xff, 0x7c, 0x90, 0xb9, 0xff, 0x7c, 0x92, 0xbb, 0xff, 0x7b, 0x90, 0xba, 0xff, 0x7a, 0x90, 0xba, 0xff, 0x7a, 0x92, 0xbb, 0xff, 0x80, 0x94, 0xbe, 0xff, 0x83, 0x96, 0xc0, 0xff, 0x87, 0x98, 0xbe, 0xff, 0x89, 0x9b, 0xbf, 0xff, 0x86, 0x99, 0xbc, 0xff, 0x86, 0x98, 0xbb, 0xff, 0x7f, 0x92, 0xbd, 0xff, 0x55, 0x65, 0x90, 0xff, 0x14, 0x15, 0x27, 0xff, 0x0d, 0x09, 0x0a, 0xff, 0x24, 0x1e, 0x1a, 0xff, 0x1b, 0x17, 0x18, 0xff, 0x1e, 0x1c, 0x1f, 0xff, 0x2d, 0x27, 0x29, 0xff, 0x12, 0x0b, 0x0e, 0xff, 0x90, 0x88, 0x8f, 0xff, 0xf8, 0xed, 0xef, 0xff, 0xe0, 0xd3, 0xc9, 0xff, 0xc8, 0xbc, 0xa7, 0xff, 0xcf, 0xbf, 0xae, 0xff, 0xe0, 0xd0, 0xca, 0xff, 0xdb, 0xd0, 0xd1, 0xff, 0xd1, 0xca, 0xc2, 0xff, 0xc5, 0xba, 0xac, 0xff, 0xc8, 0xbb, 0xb1, 0xff, 0xc5, 0xb9, 0xb8, 0xff, 0xc9, 0xc1, 0xc6, 0xff, 0xc2, 0xbc, 0xc1, 0xff, 0xc2, 0xbc, 0xc2, 0xff, 0xd4, 0xcd, 0xd6, 0xff, 0xcb, 0xc2, 0xd0, 0xff, 0xcd, 0xc3, 0xd3, 0xff, 0xd7, 0xcd, 0xdb, 0xff, 0xda, 0xd1, 0xdd, 0xff, 0xdd, 0xd4, 0xde, 0xff, 0xe0, 0xd7, 0xe2, 0xff, 0xe2, 0xdd, 0xe8, 0xff, 0xe2, 0xde, 0xe9, 0xff, 0xda, 0xd6, 0xe2, 0xff, 0xe6, 0xdf, 0xeb, 0xff, 0xf3, 0xea, 0xf7, 0xff, 0xef, 0xe8, 0xf5, 0xff, 0xed, 0xe8, 0xf6, 0xff, 0xef, 0xeb, 0xfa, 0xff, 0xef, 0xe9, 0xf7, 0xff, 0xf2, 0xe7, 0xf8, 0xff, 0xf5, 0xea, 0xfb, 0xff, 0xee, 0xe6, 0xfa, 0xff, 0xe4, 0xde, 0xf4, 0xff, 0xd4, 0xd1, 0xe5, 0xff, 0xc8, 0xc4, 0xd8, 0xff, 0xc5, 0xc1, 0xd3, 0xff, 0xc6, 0xc3, 0xcf, 0xff, 0xda, 0xcf, 0xd9, 0xff, 0xed, 0xde, 0xe8, 0xff, 0xec, 0xe3, 0xee, 0xff, 0xec, 0xe8, 0xf5, 0xbe,
+    0xc3, 0xb5, 0x81, 0xaa, 0xc2, 0xb6, 0x87, 0xff, 0xc2, 0xb8, 0x88, 0xff, 0xc3, 0xb9, 0x88, 0xff, 0xc0, 0xb7, 0x86, 0xff, 0xbf, 0xb3, 0x80, 0xff, 0xc2, 0xb6, 0x7a, 0xff, 0xc4, 0xb4, 0x7a, 0xff, 0xc1, 0xb2, 0x7a, 0xff, 0xc0, 0xb2, 0x7a, 0xff, 0xbf, 0xb2, 0x7a, 0xff, 0xc0, 0xb4, 0x7a, 0xff, 0xc0, 0xb2, 0x79, 0xff, 0xb7, 0xa9, 0x72, 0xff, 0xb0, 0xa3, 0x6e, 0xff, 0xae, 0xa4, 0x70, 0xff, 0xb1, 0xa5, 0x70, 0xff, 0xb1, 0xa7, 0x73, 0xff, 0xb6, 0xac, 0x7a, 0xff, 0xbe, 0xad, 0x7a, 0xff, 0xa9, 0xa9, 0xa3, 0xff, 0x82, 0x89, 0xc1, 0xff, 0x7e, 0x80, 0xb3, 0xff, 0x81, 0x86, 0xba, 0xff, 0x78, 0x87, 0xb2, 0xff, 0x83, 0x94, 0xb5, 0xff, 0x8c, 0x98, 0xc0, 0xff, 0x91, 0x9b, 0xc3, 0xff, 0x94, 0x9f, 0xc4, 0xff, 0x95, 0x9f, 0xc8, 0xff, 0x96, 0x9f, 0xc8, 0xff, 0x95, 0xa1, 0xc7, 0xff, 0x93, 0xa0, 0xc6, 0xff, 0x91, 0xa1, 0xc6, 0xff, 0x8f, 0xa0, 0xc7, 0xff, 0x8d, 0x9d, 0xc7, 0xff, 0x8d, 0x9d, 0xc8, 0xff, 0x90, 0xa0, 0xcb, 0xff, 0x8f, 0x9f, 0xca, 0xff, 0x8e, 0x9d, 0xc8, 0xff, 0x8d, 0x9d, 0xc9, 0xff, 0x8d, 0x9d, 0xc9, 0xff, 0x8c, 0x9d, 0xc8, 0xff, 0x8b, 0x9c, 0xc7, 0xff, 0x8a, 0x9c, 0xc5, 0xff, 0x89, 0x9b, 0xc4, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x89, 0x9b, 0xc3, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x87, 0x99, 0xc2, 0xff, 0x86, 0x98, 0xc0, 0xff, 0x85, 0x98, 0xc0, 0xff, 0x83, 0x95, 0xbf, 0xff, 0x81, 0x93, 0xbe, 0xff, 0x82, 0x93, 0xbe, 0xff, 0x81, 0x92, 0xbe, 0xff, 0x80, 0x91, 0xbc, 0xff, 0x81, 0x92, 0xbd, 0xff, 0x81, 0x92, 0xbd, 0xff, 0x81, 0x92, 0xbe, 0xff, 0x81, 0x92, 0xbe, 0xff, 0x7f, 0x90, 0xbb, 0xff, 0x80, 0x90, 0xbc, 0xff, 0x80, 0x91, 0xbc, 0xff, 0x7f, 0x8f, 0xbb, 0xff, 0x7e, 0x90, 0xba, 0xff, 0x7e, 0x93, 0xbc, 0xff, 0x7f, 0x92, 0xbb, 0xff, 0x7f, 0x93, 0xbc, 0xff, 0x80, 0x95, 0xbe, 0xff, 0x83, 0x96, 0xc0, 0xff, 0x85, 0x97, 0xc0, 0xff, 0x86, 0x98, 0xbe, 0xff, 0x8a, 0x9c, 0xc1, 0xff, 0x89, 0x9c, 0xbf, 0xff, 0x89, 0x9b, 0xbe, 0xff, 0x84, 0x96, 0xc2, 0xff, 0x61, 0x70, 0x9b, 0xff, 0x12, 0x13, 0x23, 0xff, 0x14, 0x10, 0x11, 0xff, 0x29, 0x23, 0x1f, 0xff, 0x1c, 0x19, 0x1a, 0xff, 0x1e, 0x1e, 0x1f, 0xff, 0x28, 0x24, 0x26, 0xff, 0x28, 0x20, 0x24, 0xff, 0xaf, 0xa5, 0xad, 0xff, 0xe7, 0xdb, 0xe0, 0xff, 0xc5, 0xbc, 0xb3, 0xff, 0xa9, 0x9e, 0x8c, 0xff, 0xbd, 0xae, 0x9e, 0xff, 0xd8, 0xca, 0xc3, 0xff, 0xd4, 0xc9, 0xc9, 0xff, 0xbf, 0xb5, 0xad, 0xff, 0xa8, 0x9c, 0x89, 0xff, 0xb0, 0xa4, 0x8f, 0xff, 0xb7, 0xac, 0x9e, 0xff, 0xb8, 0xae, 0xae, 0xff, 0xb7, 0xb1, 0xb2, 0xff, 0xbe, 0xb7, 0xb8, 0xff, 0xc6, 0xbd, 0xc2, 0xff, 0xba, 0xb0, 0xb9, 0xff, 0xcb, 0xc1, 0xcc, 0xff, 0xe2, 0xd7, 0xe3, 0xff, 0xea, 0xdf, 0xeb, 0xff, 0xe1, 0xd5, 0xe0, 0xff, 0xdf, 0xd4, 0xde, 0xff, 0xe2, 0xdb, 0xe6, 0xff, 0xda, 0xd5, 0xe1, 0xff, 0xdd, 0xd6, 0xe2, 0xff, 0xe8, 0xe0, 0xeb, 0xff, 0xeb, 0xe1, 0xed, 0xff, 0xed, 0xe6, 0xf2, 0xff, 0xf4, 0xed, 0xfd, 0xff, 0xee, 0xe9, 0xfd, 0xff, 0xeb, 0xe8, 0xf8, 0xff, 0xf6, 0xeb, 0xfc, 0xff, 0xf9, 0xe9, 0xfe, 0xff, 0xee, 0xe4, 0xf9, 0xff, 0xe6, 0xdf, 0xf3, 0xff, 0xd9, 0xd5, 0xe9, 0xff, 0xcd, 0xc7, 0xdb, 0xff, 0xc8, 0xc4, 0xd2, 0xff, 0xc9, 0xc6, 0xce, 0xff, 0xe2, 0xd7, 0xdd, 0xff, 0xec, 0xdf, 0xe5, 0xff, 0xea, 0xe0, 0xec, 0xff, 0xf0, 0xe8, 0xfa, 0xab,
+    0xb9, 0xaa, 0x77, 0x8b, 0xb4, 0xa9, 0x76, 0xff, 0xb3, 0xaa, 0x76, 0xff, 0xb3, 0xa9, 0x76, 0xff, 0xaf, 0xa5, 0x73, 0xff, 0xb0, 0xa5, 0x71, 0xff, 0xb1, 0xa6, 0x6f, 0xff, 0xb2, 0xa6, 0x6e, 0xff, 0xb0, 0xa7, 0x6e, 0xff, 0xae, 0xa4, 0x6c, 0xff, 0xb0, 0xa5, 0x6c, 0xff, 0xb0, 0xa5, 0x6e, 0xff, 0xad, 0xa2, 0x6b, 0xff, 0xa8, 0x9c, 0x65, 0xff, 0xa2, 0x97, 0x63, 0xff, 0x9f, 0x95, 0x62, 0xff, 0x9f, 0x95, 0x61, 0xff, 0xa2, 0x97, 0x67, 0xff, 0xa9, 0x9d, 0x6e, 0xff, 0xac, 0x9e, 0x70, 0xff, 0x9c, 0x97, 0x7d, 0xff, 0x91, 0x94, 0x9f, 0xff, 0x80, 0x86, 0xa9, 0xff, 0x7a, 0x89, 0xb1, 0xff, 0x76, 0x8b, 0xac, 0xff, 0x81, 0x92, 0xb5, 0xff, 0x8d, 0x98, 0xc4, 0xff, 0x8f, 0x9a, 0xc4, 0xff, 0x93, 0xa0, 0xc4, 0xff, 0x96, 0xa2, 0xc9, 0xff, 0x94, 0xa0, 0xc8, 0xff, 0x92, 0xa0, 0xc7, 0xff, 0x90, 0xa0, 0xc6, 0xff, 0x8d, 0x9e, 0xc5, 0xff, 0x8e, 0x9e, 0xc7, 0xff, 0x8c, 0x9c, 0xc6, 0xff, 0x8d, 0x9d, 0xc7, 0xff, 0x8c, 0x9d, 0xc7, 0xff, 0x8a, 0x9b, 0xc7, 0xff, 0x89, 0x9a, 0xc6, 0xff, 0x89, 0x9a, 0xc5, 0xff, 0x89, 0x9b, 0xc4, 0xff, 0x89, 0x9b, 0xc4, 0xff, 0x89, 0x9a, 0xc4, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x87, 0x99, 0xc2, 0xff, 0x86, 0x98, 0xc1, 0xff, 0x86, 0x98, 0xc1, 0xff, 0x86, 0x97, 0xc1, 0xff, 0x85, 0x96, 0xbf, 0xff, 0x85, 0x96, 0xc0, 0xff, 0x84, 0x94, 0xc0, 0xff, 0x82, 0x93, 0xbd, 0xff, 0x81, 0x91, 0xbd, 0xff, 0x80, 0x8f, 0xbd, 0xff, 0x7f, 0x8f, 0xbb, 0xff, 0x80, 0x90, 0xbb, 0xff, 0x81, 0x91, 0xbc, 0xff, 0x81, 0x91, 0xbc, 0xff, 0x81, 0x92, 0xbc, 0xff, 0x80, 0x92, 0xbb, 0xff, 0x80, 0x91, 0xbb, 0xff, 0x7f, 0x91, 0xba, 0xff, 0x7f, 0x90, 0xba, 0xff, 0x80, 0x91, 0xbb, 0xff, 0x80, 0x91, 0xbb, 0xff, 0x7e, 0x92, 0xbc, 0xff, 0x7e, 0x94, 0xbe, 0xff, 0x7f, 0x94, 0xbe, 0xff, 0x81, 0x96, 0xbf, 0xff, 0x83, 0x96, 0xbd, 0xff, 0x85, 0x98, 0xbf, 0xff, 0x87, 0x98, 0xbf, 0xff, 0x88, 0x98, 0xc1, 0xff, 0x8b, 0x9c, 0xc3, 0xff, 0x8a, 0x9c, 0xc1, 0xff, 0x8b, 0x9d, 0xc2, 0xff, 0x84, 0x97, 0xc1, 0xff, 0x67, 0x79, 0xa1, 0xff, 0x16, 0x20, 0x38, 0xff, 0x1b, 0x17, 0x1a, 0xff, 0x2a, 0x20, 0x1a, 0xff, 0x1e, 0x1a, 0x1d, 0xff, 0x1d, 0x1a, 0x1f, 0xff, 0x24, 0x1c, 0x1f, 0xff, 0x4a, 0x3c, 0x40, 0xff, 0xce, 0xbf, 0xca, 0xff, 0xd0, 0xc6, 0xc9, 0xff, 0x9c, 0x96, 0x8f, 0xff, 0x7f, 0x78, 0x6d, 0xff, 0x97, 0x8c, 0x83, 0xff, 0xb5, 0xa7, 0xa3, 0xff, 0xb0, 0xa3, 0xa1, 0xff, 0x8c, 0x80, 0x7c, 0xff, 0x85, 0x79, 0x74, 0xff, 0x9e, 0x94, 0x8d, 0xff, 0xa8, 0xa3, 0x9d, 0xff, 0xb0, 0xac, 0xab, 0xff, 0xc2, 0xbc, 0xbc, 0xff, 0xb8, 0xae, 0xb0, 0xff, 0xa1, 0x97, 0x99, 0xff, 0xbe, 0xb3, 0xb6, 0xff, 0xe1, 0xd7, 0xde, 0xff, 0xec, 0xe3, 0xee, 0xff, 0xe6, 0xe0, 0xed, 0xff, 0xea, 0xe2, 0xee, 0xff, 0xec, 0xe2, 0xed, 0xff, 0xe1, 0xd7, 0xe2, 0xff, 0xd5, 0xcc, 0xd6, 0xff, 0xd4, 0xcc, 0xd5, 0xff, 0xd8, 0xcf, 0xda, 0xff, 0xe2, 0xd9, 0xe5, 0xff, 0xef, 0xe9, 0xf6, 0xff, 0xf0, 0xe9, 0xfb, 0xff, 0xeb, 0xe4, 0xfa, 0xff, 0xef, 0xe7, 0xfc, 0xff, 0xf4, 0xeb, 0xfe, 0xff, 0xf7, 0xee, 0xfc, 0xff, 0xf4, 0xeb, 0xf9, 0xff, 0xec, 0xe2, 0xf1, 0xff, 0xe3, 0xdc, 0xe9, 0xff, 0xe0, 0xd8, 0xe5, 0xff, 0xd7, 0xd0, 0xd9, 0xff, 0xcb, 0xc5, 0xcb, 0xff, 0xd9, 0xd1, 0xd5, 0xff, 0xea, 0xdf, 0xe5, 0xff, 0xeb, 0xe4, 0xef, 0xff, 0xe1, 0xdf, 0xee, 0x8b,
+    0x9d, 0x93, 0x61, 0x6b, 0xa0, 0x96, 0x66, 0xff, 0xa2, 0x99, 0x6d, 0xff, 0xa2, 0x97, 0x6d, 0xff, 0x9f, 0x94, 0x6a, 0xff, 0x9b, 0x91, 0x66, 0xff, 0x99, 0x90, 0x64, 0xff, 0x96, 0x8e, 0x60, 0xff, 0x92, 0x8c, 0x5c, 0xff, 0x92, 0x8a, 0x5b, 0xff, 0x96, 0x8b, 0x5c, 0xff, 0x98, 0x8d, 0x61, 0xff, 0x97, 0x8d, 0x61, 0xff, 0x96, 0x8d, 0x60, 0xff, 0x92, 0x89, 0x5c, 0xff, 0x8f, 0x86, 0x5c, 0xff, 0x95, 0x8c, 0x63, 0xff, 0x9c, 0x93, 0x6b, 0xff, 0xa4, 0x99, 0x71, 0xff, 0xa6, 0x99, 0x76, 0xff, 0x98, 0x8d, 0x6b, 0xff, 0x9b, 0x95, 0x86, 0xff, 0x94, 0x96, 0xb2, 0xff, 0x81, 0x8c, 0xb9, 0xff, 0x8e, 0x9c, 0xbe, 0xff, 0x8e, 0x9b, 0xbe, 0xff, 0x8f, 0x9a, 0xc4, 0xff, 0x91, 0x9e, 0xc6, 0xff, 0x93, 0xa0, 0xc6, 0xff, 0x95, 0xa2, 0xc7, 0xff, 0x92, 0xa0, 0xc6, 0xff, 0x91, 0xa0, 0xc7, 0xff, 0x8f, 0x9f, 0xc6, 0xff, 0x8c, 0x9d, 0xc4, 0xff, 0x8b, 0x9b, 0xc6, 0xff, 0x8a, 0x9a, 0xc4, 0xff, 0x8a, 0x9a, 0xc4, 0xff, 0x89, 0x9a, 0xc5, 0xff, 0x88, 0x99, 0xc5, 0xff, 0x88, 0x99, 0xc4, 0xff, 0x88, 0x9a, 0xc4, 0xff, 0x88, 0x99, 0xc3, 0xff, 0x86, 0x97, 0xc1, 0xff, 0x86, 0x97, 0xc1, 0xff, 0x87, 0x98, 0xc2, 0xff, 0x87, 0x98, 0xc2, 0xff, 0x86, 0x97, 0xc1, 0xff, 0x83, 0x94, 0xbf, 0xff, 0x83, 0x94, 0xbf, 0xff, 0x82, 0x93, 0xbd, 0xff, 0x81, 0x92, 0xbd, 0xff, 0x80, 0x91, 0xbd, 0xff, 0x7f, 0x90, 0xbb, 0xff, 0x7e, 0x8d, 0xbb, 0xff, 0x7e, 0x8c, 0xbc, 0xff, 0x7c, 0x8c, 0xb8, 0xff, 0x7e, 0x8e, 0xb8, 0xff, 0x80, 0x90, 0xbb, 0xff, 0x81, 0x91, 0xbc, 0xff, 0x81, 0x91, 0xbc, 0xff, 0x7f, 0x92, 0xba, 0xff, 0x7e, 0x90, 0xb9, 0xff, 0x7f, 0x90, 0xb9, 0xff, 0x80, 0x92, 0xbb, 0xff, 0x80, 0x92, 0xbb, 0xff, 0x80, 0x93, 0xba, 0xff, 0x80, 0x94, 0xbd, 0xff, 0x81, 0x95, 0xc1, 0xff, 0x83, 0x97, 0xc3, 0xff, 0x85, 0x99, 0xc2, 0xff, 0x84, 0x99, 0xbe, 0xff, 0x86, 0x99, 0xbf, 0xff, 0x88, 0x99, 0xc0, 0xff, 0x88, 0x98, 0xc3, 0xff, 0x8b, 0x9b, 0xc4, 0xff, 0x8e, 0x9e, 0xc5, 0xff, 0x8e, 0xa0, 0xc5, 0xff, 0x88, 0x9c, 0xc2, 0xff, 0x74, 0x86, 0xad, 0xff, 0x25, 0x32, 0x53, 0xff, 0x15, 0x13, 0x1f, 0xff, 0x28, 0x20, 0x1b, 0xff, 0x1b, 0x17, 0x17, 0xff, 0x1d, 0x18, 0x1d, 0xff, 0x2f, 0x25, 0x28, 0xff, 0x90, 0x81, 0x85, 0xff, 0xe1, 0xd3, 0xde, 0xff, 0xcb, 0xc2, 0xc6, 0xff, 0x8f, 0x8a, 0x88, 0xff, 0x66, 0x63, 0x5e, 0xff, 0x76, 0x6f, 0x6c, 0xff, 0x8b, 0x7e, 0x7e, 0xff, 0x8f, 0x82, 0x7f, 0xff, 0x81, 0x75, 0x73, 0xff, 0x80, 0x75, 0x79, 0xff, 0x96, 0x8d, 0x95, 0xff, 0xb0, 0xad, 0xb3, 0xff, 0xc1, 0xc1, 0xc4, 0xff, 0xc8, 0xc1, 0xc5, 0xff, 0xa7, 0x9b, 0x9f, 0xff, 0x92, 0x86, 0x8b, 0xff, 0xc9, 0xbd, 0xc0, 0xff, 0xe5, 0xda, 0xe2, 0xff, 0xee, 0xe6, 0xf0, 0xff, 0xec, 0xe8, 0xf5, 0xff, 0xf0, 0xe9, 0xfa, 0xff, 0xf1, 0xe6, 0xf5, 0xff, 0xe8, 0xdd, 0xe7, 0xff, 0xe0, 0xd6, 0xdc, 0xff, 0xbe, 0xb6, 0xbb, 0xff, 0xaa, 0xa2, 0xaa, 0xff, 0xce, 0xc7, 0xd0, 0xff, 0xe7, 0xe1, 0xed, 0xff, 0xe4, 0xdd, 0xee, 0xff, 0xef, 0xe5, 0xfa, 0xff, 0xf5, 0xeb, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf1, 0xed, 0xf7, 0xff, 0xef, 0xe9, 0xf4, 0xff, 0xe8, 0xe0, 0xed, 0xff, 0xe0, 0xd8, 0xe3, 0xff, 0xdc, 0xd4, 0xde, 0xff, 0xcd, 0xc5, 0xce, 0xff, 0xc2, 0xba, 0xc1, 0xff, 0xcb, 0xc3, 0xc9, 0xff, 0xda, 0xd3, 0xdc, 0xff, 0xde, 0xda, 0xe4, 0xff, 0xd4, 0xd4, 0xe2, 0x6b,
+    0x95, 0x88, 0x69, 0x4b, 0xa0, 0x94, 0x79, 0xff, 0xa5, 0x98, 0x83, 0xff, 0xa8, 0x9a, 0x86, 0xff, 0xa5, 0x97, 0x84, 0xff, 0xa1, 0x94, 0x7f, 0xff, 0x9f, 0x93, 0x7b, 0xff, 0x9b, 0x8f, 0x76, 0xff, 0x94, 0x8a, 0x70, 0xff, 0x8e, 0x83, 0x6a, 0xff, 0x91, 0x83, 0x6b, 0xff, 0x99, 0x8c, 0x74, 0xff, 0x9e, 0x92, 0x79, 0xff, 0x99, 0x8c, 0x74, 0xff, 0x91, 0x86, 0x6d, 0xff, 0x94, 0x8b, 0x73, 0xff, 0xa0, 0x95, 0x80, 0xff, 0xa7, 0x9d, 0x87, 0xff, 0xa7, 0x9c, 0x86, 0xff, 0xa6, 0x96, 0x83, 0xff, 0x9e, 0x92, 0x7b, 0xff, 0x9d, 0x95, 0x8a, 0xff, 0xa4, 0xa5, 0xb8, 0xff, 0x94, 0x9c, 0xc4, 0xff, 0x97, 0x9f, 0xc1, 0xff, 0x97, 0xa0, 0xc1, 0xff, 0x95, 0x9e, 0xc7, 0xff, 0x93, 0x9f, 0xc7, 0xff, 0x91, 0xa0, 0xc6, 0xff, 0x93, 0xa0, 0xc6, 0xff, 0x92, 0xa0, 0xc7, 0xff, 0x90, 0xa0, 0xc7, 0xff, 0x8d, 0x9d, 0xc4, 0xff, 0x8b, 0x9d, 0xc4, 0xff, 0x8a, 0x9a, 0xc4, 0xff, 0x89, 0x99, 0xc3, 0xff, 0x89, 0x99, 0xc3, 0xff, 0x89, 0x9a, 0xc5, 0xff, 0x88, 0x99, 0xc4, 0xff, 0x88, 0x99, 0xc4, 0xff, 0x87, 0x98, 0xc4, 0xff, 0x87, 0x97, 0xc5, 0xff, 0x87, 0x97, 0xc5, 0xff, 0x87, 0x97, 0xc4, 0xff, 0x86, 0x96, 0xc4, 0xff, 0x85, 0x95, 0xc2, 0xff, 0x83, 0x93, 0xc0, 0xff, 0x7f, 0x91, 0xbe, 0xff, 0x7f, 0x92, 0xbe, 0xff, 0x7e, 0x90, 0xbd, 0xff, 0x7c, 0x8f, 0xba, 0xff, 0x7b, 0x8e, 0xb8, 0xff, 0x7a, 0x8c, 0xb6, 0xff, 0x7b, 0x8b, 0xb8, 0xff, 0x7c, 0x8b, 0xba, 0xff, 0x7a, 0x8b, 0xb6, 0xff, 0x7c, 0x8d, 0xb7, 0xff, 0x7d, 0x8e, 0xb8, 0xff, 0x7e, 0x8f, 0xb9, 0xff, 0x7e, 0x8f, 0xba, 0xff, 0x7c, 0x8e, 0xb7, 0xff, 0x7c, 0x8e, 0xb7, 0xff, 0x7f, 0x91, 0xba, 0xff, 0x80, 0x92, 0xbb, 0xff, 0x7f, 0x91, 0xba, 0xff, 0x82, 0x94, 0xbd, 0xff, 0x87, 0x98, 0xc3, 0xff, 0x87, 0x98, 0xc5, 0xff, 0x89, 0x9a, 0xc7, 0xff, 0x8a, 0x9d, 0xc7, 0xff, 0x86, 0x9c, 0xc1, 0xff, 0x87, 0x9a, 0xc0, 0xff, 0x8b, 0x9c, 0xc4, 0xff, 0x8b, 0x9b, 0xc6, 0xff, 0x8d, 0x9d, 0xc6, 0xff, 0x92, 0xa3, 0xc9, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x8e, 0xa3, 0xc4, 0xff, 0x86, 0x96, 0xbe, 0xff, 0x3f, 0x44, 0x70, 0xff, 0x13, 0x11, 0x2a, 0xff, 0x1f, 0x1c, 0x19, 0xff, 0x21, 0x1f, 0x15, 0xff, 0x27, 0x21, 0x22, 0xff, 0x37, 0x2c, 0x32, 0xff, 0xac, 0x9f, 0xa9, 0xff, 0xdb, 0xd2, 0xdd, 0xff, 0xd3, 0xcd, 0xd4, 0xff, 0xb5, 0xb0, 0xb3, 0xff, 0x8c, 0x88, 0x89, 0xff, 0x86, 0x80, 0x81, 0xff, 0x97, 0x8e, 0x8f, 0xff, 0xa7, 0x9d, 0x9a, 0xff, 0xaf, 0xa5, 0xa3, 0xff, 0xae, 0xa3, 0xab, 0xff, 0xaf, 0xa3, 0xaf, 0xff, 0xbd, 0xb6, 0xc2, 0xff, 0xd1, 0xcc, 0xd8, 0xff, 0xcb, 0xc2, 0xce, 0xff, 0xbc, 0xae, 0xb5, 0xff, 0xb8, 0xab, 0xb2, 0xff, 0xd7, 0xca, 0xd1, 0xff, 0xe8, 0xdc, 0xe7, 0xff, 0xf1, 0xe7, 0xf5, 0xff, 0xf0, 0xeb, 0xf9, 0xff, 0xec, 0xe2, 0xf7, 0xff, 0xec, 0xdf, 0xf2, 0xff, 0xed, 0xe2, 0xed, 0xff, 0xe8, 0xdf, 0xe3, 0xff, 0xb9, 0xb3, 0xb4, 0xff, 0x92, 0x8c, 0x90, 0xff, 0xac, 0xa6, 0xab, 0xff, 0xcf, 0xc7, 0xd0, 0xff, 0xdc, 0xd3, 0xe1, 0xff, 0xe9, 0xde, 0xf1, 0xff, 0xed, 0xe5, 0xf5, 0xff, 0xec, 0xe5, 0xf4, 0xff, 0xe9, 0xe2, 0xee, 0xff, 0xe5, 0xde, 0xec, 0xff, 0xdb, 0xd4, 0xe4, 0xff, 0xcc, 0xc6, 0xd4, 0xff, 0xc2, 0xbb, 0xc7, 0xff, 0xb3, 0xab, 0xb5, 0xff, 0xb5, 0xac, 0xb6, 0xff, 0xbb, 0xb2, 0xbb, 0xff, 0xc1, 0xbc, 0xc6, 0xff, 0xca, 0xc6, 0xd3, 0xff, 0xd2, 0xd2, 0xe0, 0x4b,
+    0x9a, 0x8b, 0x83, 0x21, 0xab, 0x9d, 0x98, 0xff, 0xb8, 0xaa, 0xa7, 0xff, 0xc1, 0xb2, 0xb0, 0xff, 0xc1, 0xb2, 0xb1, 0xff, 0xbb, 0xac, 0xaa, 0xff, 0xb4, 0xa6, 0xa2, 0xff, 0xac, 0x9e, 0x99, 0xff, 0xa5, 0x99, 0x93, 0xff, 0xa2, 0x96, 0x8f, 0xff, 0xa7, 0x99, 0x91, 0xff, 0xa9, 0x9a, 0x92, 0xff, 0xa7, 0x99, 0x91, 0xff, 0xa3, 0x94, 0x8c, 0xff, 0x9d, 0x90, 0x88, 0xff, 0x9d, 0x92, 0x8a, 0xff, 0xa3, 0x97, 0x91, 0xff, 0xa6, 0x9b, 0x95, 0xff, 0xa8, 0x9a, 0x97, 0xff, 0xa7, 0x95, 0x94, 0xff, 0xaa, 0x9d, 0x90, 0xff, 0xb0, 0xa5, 0x9d, 0xff, 0xb0, 0xad, 0xbd, 0xff, 0xa7, 0xab, 0xcb, 0xff, 0xa0, 0xa3, 0xc3, 0xff, 0x9f, 0xa6, 0xc6, 0xff, 0x9c, 0xa7, 0xca, 0xff, 0x99, 0xa4, 0xca, 0xff, 0x97, 0xa3, 0xc9, 0xff, 0x96, 0xa2, 0xc8, 0xff, 0x95, 0xa1, 0xc7, 0xff, 0x91, 0x9e, 0xc5, 0xff, 0x8e, 0x9d, 0xc4, 0xff, 0x8c, 0x9d, 0xc4, 0xff, 0x8a, 0x9a, 0xc4, 0xff, 0x89, 0x99, 0xc3, 0xff, 0x89, 0x99, 0xc4, 0xff, 0x88, 0x98, 0xc4, 0xff, 0x86, 0x97, 0xc2, 0xff, 0x86, 0x97, 0xc2, 0xff, 0x86, 0x96, 0xc3, 0xff, 0x84, 0x94, 0xc3, 0xff, 0x84, 0x94, 0xc2, 0xff, 0x84, 0x94, 0xc2, 0xff, 0x83, 0x93, 0xc2, 0xff, 0x81, 0x91, 0xc0, 0xff, 0x7f, 0x8f, 0xbe, 0xff, 0x7c, 0x8f, 0xbd, 0xff, 0x7b, 0x8e, 0xbc, 0xff, 0x79, 0x8d, 0xbb, 0xff, 0x78, 0x8c, 0xb8, 0xff, 0x77, 0x8a, 0xb6, 0xff, 0x75, 0x89, 0xb4, 0xff, 0x77, 0x88, 0xb6, 0xff, 0x78, 0x88, 0xb8, 0xff, 0x76, 0x87, 0xb5, 0xff, 0x77, 0x88, 0xb5, 0xff, 0x78, 0x8a, 0xb6, 0xff, 0x78, 0x89, 0xb5, 0xff, 0x79, 0x8a, 0xb5, 0xff, 0x7a, 0x8c, 0xb5, 0xff, 0x7d, 0x8f, 0xb8, 0xff, 0x80, 0x92, 0xbb, 0xff, 0x80, 0x92, 0xbb, 0xff, 0x81, 0x93, 0xbc, 0xff, 0x85, 0x97, 0xc0, 0xff, 0x89, 0x9b, 0xc3, 0xff, 0x8a, 0x9b, 0xc4, 0xff, 0x8a, 0x9c, 0xc5, 0xff, 0x8c, 0x9e, 0xc5, 0xff, 0x8a, 0x9e, 0xc4, 0xff, 0x89, 0x9d, 0xc2, 0xff, 0x8c, 0x9e, 0xc5, 0xff, 0x8e, 0x9f, 0xc7, 0xff, 0x90, 0xa0, 0xc7, 0xff, 0x93, 0xa3, 0xc9, 0xff, 0x96, 0xa7, 0xc9, 0xff, 0x97, 0xa8, 0xca, 0xff, 0x95, 0xa2, 0xc9, 0xff, 0x5a, 0x5f, 0x8f, 0xff, 0x15, 0x18, 0x3b, 0xff, 0x0f, 0x13, 0x17, 0xff, 0x26, 0x25, 0x1a, 0xff, 0x2e, 0x25, 0x20, 0xff, 0x3f, 0x35, 0x39, 0xff, 0xb8, 0xad, 0xbb, 0xff, 0xe5, 0xdc, 0xe9, 0xff, 0xd2, 0xcd, 0xd6, 0xff, 0xbc, 0xba, 0xc0, 0xff, 0xae, 0xaa, 0xb0, 0xff, 0xb1, 0xad, 0xaf, 0xff, 0xc5, 0xbe, 0xbf, 0xff, 0xd5, 0xcc, 0xcb, 0xff, 0xd4, 0xca, 0xcb, 0xff, 0xcc, 0xc2, 0xcd, 0xff, 0xc6, 0xbb, 0xcb, 0xff, 0xcc, 0xc2, 0xd3, 0xff, 0xd8, 0xd0, 0xe0, 0xff, 0xda, 0xd0, 0xdf, 0xff, 0xdb, 0xcf, 0xd8, 0xff, 0xe0, 0xd4, 0xdc, 0xff, 0xe5, 0xd9, 0xe1, 0xff, 0xec, 0xe2, 0xeb, 0xff, 0xe7, 0xde, 0xeb, 0xff, 0xe0, 0xda, 0xeb, 0xff, 0xe1, 0xd9, 0xf0, 0xff, 0xeb, 0xdf, 0xf5, 0xff, 0xee, 0xe3, 0xef, 0xff, 0xe6, 0xdd, 0xe1, 0xff, 0xc0, 0xbb, 0xba, 0xff, 0x92, 0x8c, 0x8e, 0xff, 0x95, 0x8f, 0x93, 0xff, 0xbc, 0xb5, 0xba, 0xff, 0xd7, 0xce, 0xd8, 0xff, 0xdc, 0xd3, 0xe1, 0xff, 0xdb, 0xd4, 0xe2, 0xff, 0xda, 0xd5, 0xdf, 0xff, 0xdc, 0xd7, 0xe2, 0xff, 0xd9, 0xd3, 0xe5, 0xff, 0xcb, 0xc5, 0xd8, 0xff, 0xc4, 0xbe, 0xcd, 0xff, 0xc7, 0xc0, 0xcd, 0xff, 0xcc, 0xc3, 0xce, 0xff, 0xc8, 0xbe, 0xc9, 0xff, 0xc0, 0xb9, 0xc4, 0xff, 0xc6, 0xc5, 0xd0, 0xff, 0xcb, 0xc9, 0xd7, 0xff, 0xd0, 0xd0, 0xe0, 0x21,
+    0xff, 0xff, 0xff, 0x01, 0xc7, 0xb9, 0xbd, 0xf2, 0xd8, 0xca, 0xd0, 0xff, 0xdb, 0xcc, 0xd4, 0xff, 0xdc, 0xcd, 0xd5, 0xff, 0xd7, 0xc8, 0xce, 0xff, 0xcd, 0xbf, 0xc4, 0xff, 0xc4, 0xb6, 0xba, 0xff, 0xbb, 0xae, 0xb1, 0xff, 0xbc, 0xb0, 0xb1, 0xff, 0xbb, 0xad, 0xad, 0xff, 0xb6, 0xa6, 0xa7, 0xff, 0xb2, 0xa2, 0xa4, 0xff, 0xb3, 0xa3, 0xa4, 0xff, 0xb0, 0xa2, 0xa2, 0xff, 0xab, 0x9f, 0x9f, 0xff, 0xae, 0xa1, 0xa1, 0xff, 0xb1, 0xa5, 0xa3, 0xff, 0xb3, 0xa7, 0xa5, 0xff, 0xb2, 0xa4, 0xa4, 0xff, 0xb8, 0xa9, 0xa2, 0xff, 0xb8, 0xad, 0xa6, 0xff, 0xba, 0xb6, 0xc4, 0xff, 0xb6, 0xb7, 0xd6, 0xff, 0xaa, 0xab, 0xce, 0xff, 0xa9, 0xae, 0xd0, 0xff, 0xa1, 0xad, 0xcd, 0xff, 0x9e, 0xab, 0xce, 0xff, 0x9e, 0xa8, 0xcf, 0xff, 0x9a, 0xa5, 0xca, 0xff, 0x97, 0xa1, 0xc8, 0xff, 0x95, 0x9f, 0xc8, 0xff, 0x92, 0x9e, 0xc6, 0xff, 0x8f, 0x9e, 0xc5, 0xff, 0x8d, 0x9d, 0xc8, 0xff, 0x8a, 0x9a, 0xc5, 0xff, 0x87, 0x97, 0xc2, 0xff, 0x86, 0x97, 0xc2, 0xff, 0x86, 0x97, 0xc2, 0xff, 0x84, 0x95, 0xc0, 0xff, 0x82, 0x93, 0xbf, 0xff, 0x82, 0x91, 0xc0, 0xff, 0x81, 0x91, 0xbf, 0xff, 0x81, 0x91, 0xbf, 0xff, 0x80, 0x90, 0xbe, 0xff, 0x7e, 0x8e, 0xbc, 0xff, 0x7c, 0x8d, 0xba, 0xff, 0x7a, 0x8d, 0xba, 0xff, 0x78, 0x8a, 0xb7, 0xff, 0x77, 0x8a, 0xb7, 0xff, 0x75, 0x88, 0xb6, 0xff, 0x72, 0x85, 0xb3, 0xff, 0x72, 0x85, 0xb2, 0xff, 0x72, 0x85, 0xb3, 0xff, 0x71, 0x84, 0xb3, 0xff, 0x6f, 0x83, 0xb2, 0xff, 0x6e, 0x81, 0xb1, 0xff, 0x6e, 0x83, 0xb2, 0xff, 0x71, 0x84, 0xb1, 0xff, 0x76, 0x86, 0xb1, 0xff, 0x7b, 0x8d, 0xb6, 0xff, 0x80, 0x92, 0xbb, 0xff, 0x80, 0x92, 0xbb, 0xff, 0x81, 0x93, 0xbc, 0xff, 0x84, 0x96, 0xbf, 0xff, 0x87, 0x99, 0xc2, 0xff, 0x89, 0x9c, 0xc3, 0xff, 0x8a, 0x9e, 0xc2, 0xff, 0x89, 0x9c, 0xc2, 0xff, 0x8b, 0x9e, 0xc3, 0xff, 0x8e, 0xa0, 0xc5, 0xff, 0x8e, 0xa1, 0xc6, 0xff, 0x8f, 0xa1, 0xc7, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x93, 0xa4, 0xc8, 0xff, 0x95, 0xa5, 0xc9, 0xff, 0x96, 0xa7, 0xc9, 0xff, 0x9b, 0xa9, 0xcd, 0xff, 0x9d, 0xa9, 0xce, 0xff, 0x78, 0x83, 0xad, 0xff, 0x35, 0x40, 0x66, 0xff, 0x14, 0x1a, 0x2c, 0xff, 0x26, 0x23, 0x22, 0xff, 0x2e, 0x24, 0x1d, 0xff, 0x4d, 0x43, 0x45, 0xff, 0xd0, 0xc8, 0xd6, 0xff, 0xeb, 0xe3, 0xf1, 0xff, 0xcd, 0xc6, 0xd0, 0xff, 0xc6, 0xc2, 0xcb, 0xff, 0xc3, 0xbf, 0xc7, 0xff, 0xd3, 0xce, 0xd0, 0xff, 0xe2, 0xdb, 0xdc, 0xff, 0xee, 0xe5, 0xe6, 0xff, 0xe8, 0xdf, 0xe3, 0xff, 0xda, 0xd0, 0xdc, 0xff, 0xd6, 0xcc, 0xdc, 0xff, 0xd8, 0xce, 0xde, 0xff, 0xdc, 0xd3, 0xe2, 0xff, 0xe6, 0xdc, 0xeb, 0xff, 0xe6, 0xdb, 0xe7, 0xff, 0xeb, 0xe0, 0xe9, 0xff, 0xec, 0xe1, 0xe8, 0xff, 0xee, 0xe5, 0xed, 0xff, 0xe1, 0xd9, 0xe6, 0xff, 0xd8, 0xd2, 0xe4, 0xff, 0xd9, 0xd4, 0xe8, 0xff, 0xdd, 0xd5, 0xe7, 0xff, 0xe5, 0xdc, 0xe7, 0xff, 0xd6, 0xce, 0xd2, 0xff, 0xb8, 0xb0, 0xb2, 0xff, 0xa1, 0x98, 0x9d, 0xff, 0xa3, 0x9a, 0xa0, 0xff, 0xb1, 0xa9, 0xad, 0xff, 0xcb, 0xc3, 0xcb, 0xff, 0xd7, 0xcf, 0xda, 0xff, 0xcb, 0xc4, 0xd1, 0xff, 0xc8, 0xc3, 0xcc, 0xff, 0xc4, 0xc1, 0xcc, 0xff, 0xc1, 0xbb, 0xd2, 0xff, 0xbb, 0xb4, 0xcc, 0xff, 0xcb, 0xc4, 0xd8, 0xff, 0xdb, 0xd4, 0xe4, 0xff, 0xe8, 0xdc, 0xea, 0xff, 0xee, 0xe0, 0xee, 0xff, 0xe4, 0xde, 0xe9, 0xff, 0xd7, 0xd4, 0xe1, 0xff, 0xd4, 0xd0, 0xe1, 0xf2, 0xff, 0xff, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0xd8, 0xcb, 0xcf, 0xc6, 0xe1, 0xd2, 0xd9, 0xff, 0xe6, 0xd7, 0xe0, 0xff, 0xe9, 0xd9, 0xe3, 0xff, 0xe4, 0xd5, 0xdd, 0xff, 0xda, 0xcb, 0xd1, 0xff, 0xd2, 0xc4, 0xc8, 0xff, 0xcb, 0xbe, 0xc2, 0xff, 0xc7, 0xb9, 0xbc, 0xff, 0xc5, 0xb5, 0xb8, 0xff, 0xc1, 0xb0, 0xb1, 0xff, 0xbc, 0xac, 0xac, 0xff, 0xbe, 0xad, 0xae, 0xff, 0xb9, 0xaa, 0xab, 0xff, 0xb2, 0xa6, 0xa6, 0xff, 0xb3, 0xa6, 0xa7, 0xff, 0xb9, 0xac, 0xac, 0xff, 0xbb, 0xb1, 0xac, 0xff, 0xb8, 0xad, 0xa7, 0xff, 0xbb, 0xac, 0xa9, 0xff, 0xba, 0xad, 0xac, 0xff, 0xbb, 0xb9, 0xc3, 0xff, 0xb7, 0xb9, 0xd6, 0xff, 0xae, 0xad, 0xd6, 0xff, 0xab, 0xaf, 0xd6, 0xff, 0xa3, 0xb0, 0xcf, 0xff, 0x9f, 0xad, 0xcf, 0xff, 0x9f, 0xa9, 0xd1, 0xff, 0x9c, 0xa7, 0xcd, 0xff, 0x9a, 0xa5, 0xcb, 0xff, 0x97, 0xa1, 0xca, 0xff, 0x93, 0xa0, 0xc7, 0xff, 0x90, 0xa0, 0xc6, 0xff, 0x8c, 0x9d, 0xc7, 0xff, 0x89, 0x99, 0xc4, 0xff, 0x88, 0x98, 0xc3, 0xff, 0x87, 0x98, 0xc3, 0xff, 0x84, 0x95, 0xc0, 0xff, 0x81, 0x93, 0xbd, 0xff, 0x81, 0x92, 0xbe, 0xff, 0x82, 0x91, 0xc0, 0xff, 0x7f, 0x8f, 0xbe, 0xff, 0x7e, 0x8d, 0xbc, 0xff, 0x7c, 0x8c, 0xbb, 0xff, 0x7b, 0x8a, 0xb9, 0xff, 0x79, 0x89, 0xb8, 0xff, 0x73, 0x87, 0xb6, 0xff, 0x70, 0x85, 0xb3, 0xff, 0x70, 0x84, 0xb3, 0xff, 0x6d, 0x82, 0xb0, 0xff, 0x6a, 0x7f, 0xab, 0xff, 0x6b, 0x7f, 0xab, 0xff, 0x6b, 0x80, 0xae, 0xff, 0x6a, 0x80, 0xaf, 0xff, 0x69, 0x7f, 0xad, 0xff, 0x68, 0x7f, 0xae, 0xff, 0x6a, 0x81, 0xae, 0xff, 0x71, 0x85, 0xb1, 0xff, 0x77, 0x8a, 0xb4, 0xff, 0x7d, 0x8f, 0xb8, 0xff, 0x81, 0x93, 0xbc, 0xff, 0x81, 0x93, 0xbc, 0xff, 0x83, 0x95, 0xbe, 0xff, 0x85, 0x97, 0xc0, 0xff, 0x87, 0x99, 0xc2, 0xff, 0x89, 0x9a, 0xc2, 0xff, 0x8b, 0x9b, 0xc2, 0xff, 0x8d, 0x9e, 0xc5, 0xff, 0x8f, 0xa1, 0xc7, 0xff, 0x8f, 0xa2, 0xc7, 0xff, 0x90, 0xa3, 0xc8, 0xff, 0x90, 0xa4, 0xc9, 0xff, 0x92, 0xa4, 0xca, 0xff, 0x94, 0xa6, 0xcb, 0xff, 0x96, 0xa6, 0xca, 0xff, 0x9a, 0xa8, 0xcc, 0xff, 0xa1, 0xad, 0xd1, 0xff, 0xa5, 0xaf, 0xd1, 0xff, 0x92, 0x9e, 0xbf, 0xff, 0x55, 0x67, 0x8c, 0xff, 0x2c, 0x35, 0x51, 0xff, 0x29, 0x23, 0x2b, 0xff, 0x2b, 0x1d, 0x1c, 0xff, 0x5b, 0x51, 0x54, 0xff, 0xc1, 0xbb, 0xc3, 0xff, 0xdb, 0xd1, 0xdc, 0xff, 0xda, 0xd1, 0xdc, 0xff, 0xd7, 0xd1, 0xdd, 0xff, 0xda, 0xd3, 0xdd, 0xff, 0xe9, 0xe3, 0xe4, 0xff, 0xef, 0xe5, 0xe5, 0xff, 0xf4, 0xe8, 0xec, 0xff, 0xf3, 0xe7, 0xf0, 0xff, 0xe6, 0xdb, 0xe7, 0xff, 0xd8, 0xce, 0xdb, 0xff, 0xd7, 0xcd, 0xda, 0xff, 0xe3, 0xd9, 0xe6, 0xff, 0xea, 0xdf, 0xed, 0xff, 0xeb, 0xde, 0xec, 0xff, 0xef, 0xe3, 0xef, 0xff, 0xee, 0xe3, 0xed, 0xff, 0xf0, 0xe6, 0xf1, 0xff, 0xe7, 0xde, 0xec, 0xff, 0xe1, 0xdc, 0xeb, 0xff, 0xda, 0xd5, 0xe5, 0xff, 0xd7, 0xd1, 0xde, 0xff, 0xd8, 0xcf, 0xda, 0xff, 0xbf, 0xb5, 0xbd, 0xff, 0xbb, 0xb0, 0xb7, 0xff, 0xc4, 0xb9, 0xc2, 0xff, 0xcd, 0xc2, 0xcc, 0xff, 0xc9, 0xbd, 0xc7, 0xff, 0xc7, 0xbd, 0xc7, 0xff, 0xd7, 0xcf, 0xd8, 0xff, 0xd3, 0xcc, 0xd7, 0xff, 0xd5, 0xcf, 0xda, 0xff, 0xca, 0xc3, 0xd4, 0xff, 0xc5, 0xbf, 0xd9, 0xff, 0xce, 0xc9, 0xe2, 0xff, 0xde, 0xd9, 0xee, 0xff, 0xe5, 0xdf, 0xf1, 0xff, 0xf1, 0xe5, 0xf6, 0xff, 0xfd, 0xf0, 0xfe, 0xff, 0xf6, 0xef, 0xfb, 0xff, 0xe9, 0xe1, 0xf0, 0xff, 0xde, 0xd5, 0xe7, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xd6, 0xc9, 0xc9, 0x90, 0xdd, 0xd1, 0xd5, 0xff, 0xe4, 0xd8, 0xdc, 0xff, 0xe5, 0xd9, 0xde, 0xff, 0xe1, 0xd5, 0xd9, 0xff, 0xda, 0xcd, 0xd1, 0xff, 0xd0, 0xc3, 0xc5, 0xff, 0xca, 0xbd, 0xbd, 0xff, 0xc3, 0xb6, 0xb5, 0xff, 0xc3, 0xb5, 0xb3, 0xff, 0xc0, 0xb1, 0xad, 0xff, 0xbc, 0xaf, 0xaa, 0xff, 0xbb, 0xad, 0xa9, 0xff, 0xae, 0xa3, 0x9e, 0xff, 0xab, 0xa2, 0x9c, 0xff, 0xae, 0xa4, 0x9e, 0xff, 0xaf, 0xa6, 0xa1, 0xff, 0xae, 0xa6, 0x9e, 0xff, 0xab, 0xa2, 0x98, 0xff, 0xaa, 0x9c, 0x9d, 0xff, 0xaa, 0x9d, 0xa1, 0xff, 0xb9, 0xb8, 0xc1, 0xff, 0xb3, 0xb7, 0xd1, 0xff, 0xab, 0xa9, 0xd2, 0xff, 0xa8, 0xab, 0xd2, 0xff, 0xa2, 0xac, 0xcd, 0xff, 0x9f, 0xa9, 0xcd, 0xff, 0x9d, 0xa7, 0xce, 0xff, 0x9b, 0xa6, 0xcc, 0xff, 0x9a, 0xa5, 0xcb, 0xff, 0x98, 0xa2, 0xcb, 0xff, 0x93, 0x9f, 0xc8, 0xff, 0x90, 0x9d, 0xc6, 0xff, 0x8c, 0x9a, 0xc7, 0xff, 0x88, 0x97, 0xc4, 0xff, 0x85, 0x94, 0xc1, 0xff, 0x83, 0x94, 0xc0, 0xff, 0x80, 0x91, 0xbd, 0xff, 0x7e, 0x8f, 0xbb, 0xff, 0x7d, 0x8e, 0xbc, 0xff, 0x7d, 0x8d, 0xbc, 0xff, 0x7b, 0x8b, 0xbb, 0xff, 0x78, 0x88, 0xb8, 0xff, 0x76, 0x87, 0xb4, 0xff, 0x74, 0x85, 0xb3, 0xff, 0x71, 0x82, 0xb1, 0xff, 0x6c, 0x80, 0xaf, 0xff, 0x6a, 0x7e, 0xae, 0xff, 0x6a, 0x7e, 0xad, 0xff, 0x69, 0x7e, 0xab, 0xff, 0x66, 0x7b, 0xa8, 0xff, 0x65, 0x7a, 0xa7, 0xff, 0x66, 0x7c, 0xab, 0xff, 0x65, 0x7e, 0xac, 0xff, 0x66, 0x7e, 0xac, 0xff, 0x69, 0x7f, 0xad, 0xff, 0x6b, 0x81, 0xae, 0xff, 0x71, 0x87, 0xb3, 0xff, 0x79, 0x8d, 0xb7, 0xff, 0x7d, 0x8f, 0xb8, 0xff, 0x82, 0x94, 0xbd, 0xff, 0x83, 0x95, 0xbe, 0xff, 0x84, 0x96, 0xbf, 0xff, 0x86, 0x98, 0xc1, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x8b, 0x9d, 0xc4, 0xff, 0x8b, 0x9d, 0xc3, 0xff, 0x8e, 0x9e, 0xc6, 0xff, 0x90, 0xa1, 0xc8, 0xff, 0x8f, 0xa2, 0xc7, 0xff, 0x90, 0xa3, 0xc8, 0xff, 0x92, 0xa4, 0xca, 0xff, 0x93, 0xa4, 0xcb, 0xff, 0x95, 0xa7, 0xcc, 0xff, 0x98, 0xa8, 0xcd, 0xff, 0x9b, 0xa9, 0xce, 0xff, 0xa2, 0xae, 0xd1, 0xff, 0xa7, 0xb2, 0xd2, 0xff, 0x9f, 0xac, 0xcb, 0xff, 0x74, 0x85, 0xad, 0xff, 0x5d, 0x64, 0x89, 0xff, 0x49, 0x3f, 0x51, 0xff, 0x35, 0x27, 0x2d, 0xff, 0x84, 0x7a, 0x7d, 0xff, 0xbc, 0xb6, 0xbb, 0xff, 0xd7, 0xd0, 0xd7, 0xff, 0xdf, 0xd7, 0xdf, 0xff, 0xdd, 0xd4, 0xe0, 0xff, 0xe5, 0xdd, 0xe7, 0xff, 0xf0, 0xe9, 0xeb, 0xff, 0xf0, 0xe6, 0xe7, 0xff, 0xf5, 0xe8, 0xf0, 0xff, 0xed, 0xe2, 0xee, 0xff, 0xdb, 0xd1, 0xde, 0xff, 0xd1, 0xc7, 0xd5, 0xff, 0xd2, 0xc8, 0xd5, 0xff, 0xe0, 0xd7, 0xe1, 0xff, 0xe2, 0xd9, 0xe3, 0xff, 0xdb, 0xcf, 0xdc, 0xff, 0xde, 0xd1, 0xdd, 0xff, 0xe1, 0xd5, 0xdf, 0xff, 0xe6, 0xdb, 0xe7, 0xff, 0xe5, 0xdc, 0xe9, 0xff, 0xe1, 0xdc, 0xeb, 0xff, 0xda, 0xd6, 0xe3, 0xff, 0xd9, 0xd3, 0xdd, 0xff, 0xba, 0xb1, 0xb9, 0xff, 0x9e, 0x92, 0x9a, 0xff, 0xc1, 0xb3, 0xbc, 0xff, 0xd7, 0xca, 0xd5, 0xff, 0xe0, 0xd3, 0xdf, 0xff, 0xe5, 0xd8, 0xe2, 0xff, 0xd6, 0xcb, 0xd5, 0xff, 0xd8, 0xd0, 0xd8, 0xff, 0xe1, 0xda, 0xe4, 0xff, 0xda, 0xd5, 0xe0, 0xff, 0xd7, 0xd1, 0xe1, 0xff, 0xdf, 0xda, 0xf2, 0xff, 0xe1, 0xdf, 0xf5, 0xff, 0xe4, 0xdf, 0xf3, 0xff, 0xef, 0xe8, 0xf9, 0xff, 0xf7, 0xeb, 0xfb, 0xff, 0xfd, 0xf2, 0xff, 0xff, 0xf9, 0xf1, 0xfe, 0xff, 0xf3, 0xe9, 0xfa, 0xff, 0xe4, 0xd9, 0xeb, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc7, 0xbc, 0xbc, 0x58, 0xd1, 0xc6, 0xc8, 0xff, 0xd8, 0xcd, 0xce, 0xff, 0xdc, 0xd1, 0xd1, 0xff, 0xd6, 0xc9, 0xcb, 0xff, 0xc7, 0xba, 0xbc, 0xff, 0xbf, 0xb3, 0xb3, 0xff, 0xbf, 0xb2, 0xae, 0xff, 0xb2, 0xa7, 0xa2, 0xff, 0xaa, 0xa0, 0x9c, 0xff, 0xa9, 0x9e, 0x9a, 0xff, 0xa6, 0x9c, 0x98, 0xff, 0xa1, 0x9a, 0x95, 0xff, 0x98, 0x92, 0x8c, 0xff, 0x9c, 0x95, 0x8e, 0xff, 0x9f, 0x99, 0x92, 0xff, 0x9c, 0x95, 0x8e, 0xff, 0x99, 0x93, 0x88, 0xff, 0x96, 0x8f, 0x84, 0xff, 0x94, 0x8b, 0x87, 0xff, 0x90, 0x8a, 0x8c, 0xff, 0xaf, 0xae, 0xba, 0xff, 0xaf, 0xb3, 0xcc, 0xff, 0xa6, 0xa9, 0xca, 0xff, 0xa3, 0xa7, 0xc9, 0xff, 0xa2, 0xa7, 0xc9, 0xff, 0xa1, 0xa8, 0xcb, 0xff, 0x9f, 0xa8, 0xcc, 0xff, 0x9a, 0xa4, 0xc9, 0xff, 0x97, 0xa2, 0xc9, 0xff, 0x97, 0xa0, 0xca, 0xff, 0x93, 0x9d, 0xc8, 0xff, 0x8e, 0x9a, 0xc6, 0xff, 0x8b, 0x97, 0xc3, 0xff, 0x86, 0x94, 0xc1, 0xff, 0x81, 0x90, 0xbf, 0xff, 0x7e, 0x8f, 0xba, 0xff, 0x7a, 0x8c, 0xb6, 0xff, 0x7b, 0x8a, 0xb7, 0xff, 0x77, 0x88, 0xb6, 0xff, 0x73, 0x85, 0xb4, 0xff, 0x72, 0x84, 0xb3, 0xff, 0x6e, 0x80, 0xaf, 0xff, 0x6b, 0x7e, 0xac, 0xff, 0x69, 0x7c, 0xa9, 0xff, 0x65, 0x78, 0xa6, 0xff, 0x66, 0x78, 0xa7, 0xff, 0x66, 0x78, 0xa7, 0xff, 0x66, 0x77, 0xa6, 0xff, 0x66, 0x77, 0xa6, 0xff, 0x64, 0x78, 0xa7, 0xff, 0x65, 0x7b, 0xaa, 0xff, 0x64, 0x7c, 0xaa, 0xff, 0x64, 0x7c, 0xaa, 0xff, 0x69, 0x7e, 0xad, 0xff, 0x6d, 0x80, 0xaf, 0xff, 0x6d, 0x83, 0xb0, 0xff, 0x74, 0x88, 0xb4, 0xff, 0x7a, 0x8d, 0xb7, 0xff, 0x7c, 0x8e, 0xb7, 0xff, 0x81, 0x93, 0xbc, 0xff, 0x85, 0x97, 0xc0, 0xff, 0x85, 0x97, 0xc0, 0xff, 0x87, 0x99, 0xc2, 0xff, 0x89, 0x9b, 0xc4, 0xff, 0x8b, 0x9e, 0xc5, 0xff, 0x8c, 0xa0, 0xc5, 0xff, 0x8e, 0x9f, 0xc6, 0xff, 0x8f, 0xa0, 0xc6, 0xff, 0x91, 0xa3, 0xc8, 0xff, 0x92, 0xa2, 0xc7, 0xff, 0x96, 0xa6, 0xcb, 0xff, 0x97, 0xa6, 0xcb, 0xff, 0x95, 0xa6, 0xcb, 0xff, 0x96, 0xa8, 0xce, 0xff, 0x99, 0xaa, 0xce, 0xff, 0x9e, 0xad, 0xd2, 0xff, 0xa8, 0xb5, 0xd7, 0xff, 0xa8, 0xb4, 0xd7, 0xff, 0x93, 0x9c, 0xc4, 0xff, 0x84, 0x83, 0xa7, 0xff, 0x73, 0x6c, 0x82, 0xff, 0x4c, 0x42, 0x4d, 0xff, 0x93, 0x88, 0x8d, 0xff, 0xc3, 0xbb, 0xc2, 0xff, 0xda, 0xd4, 0xd9, 0xff, 0xd7, 0xd1, 0xd6, 0xff, 0xdc, 0xd5, 0xdd, 0xff, 0xe8, 0xe0, 0xe8, 0xff, 0xeb, 0xe4, 0xe6, 0xff, 0xe7, 0xe1, 0xe2, 0xff, 0xe5, 0xde, 0xe6, 0xff, 0xd6, 0xcf, 0xda, 0xff, 0xca, 0xc2, 0xce, 0xff, 0xce, 0xc5, 0xd2, 0xff, 0xc8, 0xc0, 0xcb, 0xff, 0xc6, 0xc0, 0xc5, 0xff, 0xbb, 0xb6, 0xb8, 0xff, 0xa7, 0xa0, 0xa6, 0xff, 0xab, 0xa1, 0xa9, 0xff, 0xc7, 0xb9, 0xc1, 0xff, 0xd4, 0xc8, 0xd2, 0xff, 0xdc, 0xd3, 0xe0, 0xff, 0xdd, 0xd8, 0xe5, 0xff, 0xd4, 0xcf, 0xdb, 0xff, 0xcb, 0xc3, 0xcb, 0xff, 0x9a, 0x93, 0x92, 0xff, 0x8e, 0x82, 0x83, 0xff, 0xbb, 0xad, 0xb3, 0xff, 0xd3, 0xc5, 0xd0, 0xff, 0xdc, 0xd0, 0xdb, 0xff, 0xe0, 0xd5, 0xdc, 0xff, 0xcf, 0xc6, 0xd0, 0xff, 0xd2, 0xc9, 0xd7, 0xff, 0xdf, 0xd5, 0xe4, 0xff, 0xd7, 0xd0, 0xd9, 0xff, 0xd6, 0xd1, 0xdb, 0xff, 0xd7, 0xd4, 0xe3, 0xff, 0xd3, 0xd0, 0xe1, 0xff, 0xdd, 0xd8, 0xe8, 0xff, 0xef, 0xe7, 0xf4, 0xff, 0xf5, 0xeb, 0xf8, 0xff, 0xf6, 0xeb, 0xfc, 0xff, 0xf2, 0xe9, 0xfb, 0xff, 0xe6, 0xe0, 0xef, 0xff, 0xd9, 0xd0, 0xe2, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xbc, 0xaa, 0xaa, 0x1b, 0xc7, 0xbb, 0xb8, 0xff, 0xcc, 0xc1, 0xbd, 0xff, 0xc8, 0xbc, 0xb8, 0xff, 0xbb, 0xb0, 0xac, 0xff, 0xb0, 0xa5, 0xa1, 0xff, 0xb6, 0xab, 0xa7, 0xff, 0xb4, 0xa8, 0xa2, 0xff, 0xad, 0xa3, 0x9d, 0xff, 0xa4, 0x9d, 0x96, 0xff, 0x9b, 0x93, 0x8d, 0xff, 0x9c, 0x95, 0x8f, 0xff, 0x9c, 0x97, 0x91, 0xff, 0x9e, 0x99, 0x91, 0xff, 0x9e, 0x9a, 0x91, 0xff, 0xa0, 0x9c, 0x94, 0xff, 0x9f, 0x9b, 0x92, 0xff, 0xa0, 0x99, 0x91, 0xff, 0x9c, 0x97, 0x8e, 0xff, 0x9a, 0x95, 0x8a, 0xff, 0x94, 0x8e, 0x88, 0xff, 0xab, 0xa9, 0xb4, 0xff, 0xac, 0xae, 0xcb, 0xff, 0xa0, 0xa3, 0xc8, 0xff, 0x9e, 0xa3, 0xc6, 0xff, 0x9c, 0xa4, 0xc3, 0xff, 0x9c, 0xa5, 0xc5, 0xff, 0x98, 0xa3, 0xc6, 0xff, 0x95, 0xa2, 0xc6, 0xff, 0x93, 0x9f, 0xc5, 0xff, 0x91, 0x9c, 0xc3, 0xff, 0x8c, 0x98, 0xc1, 0xff, 0x87, 0x96, 0xbf, 0xff, 0x84, 0x95, 0xba, 0xff, 0x80, 0x92, 0xb7, 0xff, 0x7c, 0x8f, 0xb5, 0xff, 0x78, 0x8c, 0xb1, 0xff, 0x73, 0x87, 0xad, 0xff, 0x71, 0x83, 0xac, 0xff, 0x6f, 0x7f, 0xad, 0xff, 0x6c, 0x7c, 0xad, 0xff, 0x6a, 0x7b, 0xaa, 0xff, 0x67, 0x78, 0xa7, 0xff, 0x64, 0x77, 0xa6, 0xff, 0x64, 0x76, 0xa5, 0xff, 0x63, 0x75, 0xa4, 0xff, 0x62, 0x74, 0xa3, 0xff, 0x63, 0x75, 0xa4, 0xff, 0x64, 0x76, 0xa5, 0xff, 0x64, 0x76, 0xa5, 0xff, 0x64, 0x77, 0xa6, 0xff, 0x65, 0x7b, 0xa9, 0xff, 0x66, 0x7e, 0xac, 0xff, 0x66, 0x7e, 0xac, 0xff, 0x6a, 0x7f, 0xae, 0xff, 0x6e, 0x81, 0xb0, 0xff, 0x6f, 0x84, 0xb2, 0xff, 0x77, 0x8b, 0xb7, 0xff, 0x7b, 0x8e, 0xb9, 0xff, 0x80, 0x92, 0xbb, 0xff, 0x81, 0x93, 0xbc, 0xff, 0x85, 0x97, 0xc0, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x8b, 0x9d, 0xc6, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x88, 0x9b, 0xc2, 0xff, 0x8d, 0xa0, 0xc5, 0xff, 0x90, 0xa1, 0xc8, 0xff, 0x8f, 0xa0, 0xc6, 0xff, 0x91, 0xa4, 0xc8, 0xff, 0x93, 0xa4, 0xc9, 0xff, 0x96, 0xa5, 0xca, 0xff, 0x97, 0xa6, 0xcb, 0xff, 0x97, 0xa8, 0xcd, 0xff, 0x99, 0xab, 0xd0, 0xff, 0x9b, 0xab, 0xd0, 0xff, 0x9f, 0xae, 0xd2, 0xff, 0xa7, 0xb4, 0xd7, 0xff, 0xab, 0xb7, 0xd7, 0xff, 0xa4, 0xaf, 0xd2, 0xff, 0x92, 0x95, 0xb7, 0xff, 0x8a, 0x88, 0x9c, 0xff, 0x7d, 0x76, 0x7f, 0xff, 0x99, 0x8e, 0x94, 0xff, 0xb5, 0xac, 0xb3, 0xff, 0xca, 0xc3, 0xcc, 0xff, 0xdd, 0xd6, 0xde, 0xff, 0xdf, 0xd9, 0xdf, 0xff, 0xe1, 0xda, 0xde, 0xff, 0xdf, 0xda, 0xd9, 0xff, 0xd6, 0xd2, 0xd0, 0xff, 0xc9, 0xc3, 0xc5, 0xff, 0xc4, 0xbe, 0xc2, 0xff, 0xbc, 0xb4, 0xbb, 0xff, 0xad, 0xa5, 0xad, 0xff, 0xa0, 0x99, 0xa0, 0xff, 0x8d, 0x87, 0x8c, 0xff, 0x8f, 0x89, 0x8e, 0xff, 0xa6, 0x9e, 0xa5, 0xff, 0xb4, 0xac, 0xb3, 0xff, 0xc0, 0xb7, 0xbe, 0xff, 0xc0, 0xb7, 0xc0, 0xff, 0xc4, 0xbc, 0xc5, 0xff, 0xc7, 0xc2, 0xc9, 0xff, 0xbc, 0xb7, 0xbd, 0xff, 0xa9, 0xa3, 0xa7, 0xff, 0x87, 0x7f, 0x80, 0xff, 0x82, 0x76, 0x78, 0xff, 0xa1, 0x95, 0x99, 0xff, 0xcb, 0xc1, 0xc8, 0xff, 0xd9, 0xd0, 0xd9, 0xff, 0xcb, 0xbf, 0xc9, 0xff, 0xbd, 0xb3, 0xbe, 0xff, 0xcd, 0xc3, 0xd3, 0xff, 0xdf, 0xd6, 0xe5, 0xff, 0xe1, 0xd9, 0xe2, 0xff, 0xd2, 0xca, 0xd5, 0xff, 0xc2, 0xb9, 0xca, 0xff, 0xc4, 0xbb, 0xcc, 0xff, 0xdb, 0xd3, 0xe1, 0xff, 0xe0, 0xd9, 0xe5, 0xff, 0xe4, 0xdd, 0xeb, 0xff, 0xe7, 0xdf, 0xee, 0xff, 0xe7, 0xde, 0xef, 0xff, 0xd8, 0xd0, 0xe2, 0xff, 0xc6, 0xbc, 0xcf, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xa4, 0x9c, 0xd7, 0xaf, 0xa4, 0x9c, 0xff, 0xa9, 0x9f, 0x96, 0xff, 0xa7, 0x9e, 0x94, 0xff, 0xab, 0xa2, 0x98, 0xff, 0xb2, 0xa9, 0xa0, 0xff, 0xad, 0xa5, 0x9c, 0xff, 0xac, 0xa5, 0x9d, 0xff, 0xac, 0xa7, 0x9f, 0xff, 0xa4, 0x9f, 0x97, 0xff, 0x9e, 0x99, 0x91, 0xff, 0xa6, 0xa3, 0x9b, 0xff, 0xa6, 0xa5, 0x9b, 0xff, 0xa3, 0xa2, 0x98, 0xff, 0xa6, 0xa4, 0x9b, 0xff, 0xa8, 0xa6, 0x9b, 0xff, 0xa6, 0xa1, 0x98, 0xff, 0xa3, 0x9e, 0x96, 0xff, 0xa2, 0x9f, 0x8e, 0xff, 0x9a, 0x95, 0x89, 0xff, 0xa6, 0xa3, 0xac, 0xff, 0xa9, 0xa7, 0xc8, 0xff, 0x98, 0x9c, 0xc5, 0xff, 0x96, 0x9e, 0xc2, 0xff, 0x95, 0x9e, 0xbd, 0xff, 0x92, 0x9e, 0xbc, 0xff, 0x8c, 0x9a, 0xbb, 0xff, 0x8c, 0x9c, 0xbe, 0xff, 0x8a, 0x98, 0xbd, 0xff, 0x87, 0x95, 0xba, 0xff, 0x83, 0x93, 0xb9, 0xff, 0x7f, 0x90, 0xb7, 0xff, 0x7b, 0x8e, 0xb3, 0xff, 0x78, 0x8b, 0xb1, 0xff, 0x73, 0x87, 0xae, 0xff, 0x70, 0x82, 0xad, 0xff, 0x6c, 0x7d, 0xaa, 0xff, 0x6a, 0x7a, 0xa9, 0xff, 0x68, 0x78, 0xa6, 0xff, 0x64, 0x73, 0xa3, 0xff, 0x65, 0x74, 0xa4, 0xff, 0x65, 0x75, 0xa5, 0xff, 0x62, 0x73, 0xa4, 0xff, 0x62, 0x73, 0xa3, 0xff, 0x63, 0x74, 0xa5, 0xff, 0x64, 0x76, 0xa5, 0xff, 0x65, 0x77, 0xa6, 0xff, 0x67, 0x79, 0xa8, 0xff, 0x66, 0x78, 0xa7, 0xff, 0x65, 0x78, 0xa7, 0xff, 0x65, 0x7c, 0xaa, 0xff, 0x67, 0x7f, 0xad, 0xff, 0x69, 0x81, 0xae, 0xff, 0x6c, 0x82, 0xb0, 0xff, 0x70, 0x84, 0xb3, 0xff, 0x75, 0x8a, 0xb8, 0xff, 0x7b, 0x8f, 0xbb, 0xff, 0x7c, 0x8f, 0xb9, 0xff, 0x81, 0x93, 0xbc, 0xff, 0x84, 0x96, 0xbf, 0xff, 0x85, 0x97, 0xc0, 0xff, 0x89, 0x9b, 0xc4, 0xff, 0x89, 0x9b, 0xc4, 0xff, 0x89, 0x9b, 0xc4, 0xff, 0x89, 0x9c, 0xc3, 0xff, 0x8a, 0x9d, 0xc2, 0xff, 0x8e, 0x9f, 0xc6, 0xff, 0x8f, 0xa0, 0xc6, 0xff, 0x90, 0xa3, 0xc7, 0xff, 0x93, 0xa4, 0xc9, 0xff, 0x94, 0xa4, 0xc9, 0xff, 0x95, 0xa5, 0xca, 0xff, 0x97, 0xa8, 0xcd, 0xff, 0x99, 0xab, 0xd1, 0xff, 0x9c, 0xac, 0xd1, 0xff, 0xa0, 0xaf, 0xd3, 0xff, 0xa7, 0xb5, 0xd8, 0xff, 0xac, 0xb9, 0xd6, 0xff, 0xaa, 0xb6, 0xd6, 0xff, 0xa5, 0xab, 0xcd, 0xff, 0x9b, 0x9d, 0xb2, 0xff, 0x93, 0x90, 0x99, 0xff, 0xb0, 0xa7, 0xab, 0xff, 0xb6, 0xac, 0xb4, 0xff, 0xbb, 0xb2, 0xbf, 0xff, 0xd2, 0xca, 0xd4, 0xff, 0xd7, 0xd0, 0xd7, 0xff, 0xd0, 0xca, 0xcc, 0xff, 0xce, 0xca, 0xc5, 0xff, 0xbc, 0xb8, 0xb3, 0xff, 0xa5, 0xa0, 0x9e, 0xff, 0x9d, 0x97, 0x98, 0xff, 0x92, 0x8b, 0x8d, 0xff, 0x86, 0x7f, 0x81, 0xff, 0x7a, 0x73, 0x76, 0xff, 0x78, 0x71, 0x76, 0xff, 0xb8, 0xb1, 0xb6, 0xff, 0xe2, 0xd8, 0xe0, 0xff, 0xe4, 0xdc, 0xe3, 0xff, 0xdc, 0xd7, 0xdd, 0xff, 0xca, 0xc5, 0xcd, 0xff, 0xb3, 0xad, 0xb3, 0xff, 0xa7, 0xa2, 0xa4, 0xff, 0x99, 0x96, 0x97, 0xff, 0x90, 0x8b, 0x8d, 0xff, 0x7c, 0x74, 0x75, 0xff, 0x60, 0x55, 0x56, 0xff, 0x82, 0x79, 0x7b, 0xff, 0xb2, 0xab, 0xb0, 0xff, 0xc3, 0xbc, 0xc3, 0xff, 0xbf, 0xb4, 0xbf, 0xff, 0xc9, 0xbe, 0xcb, 0xff, 0xdd, 0xd3, 0xe4, 0xff, 0xe1, 0xd8, 0xe7, 0xff, 0xdf, 0xd7, 0xe1, 0xff, 0xc8, 0xbc, 0xc9, 0xff, 0xad, 0x9f, 0xb0, 0xff, 0xc6, 0xb9, 0xc8, 0xff, 0xd6, 0xcc, 0xd8, 0xff, 0xd7, 0xd0, 0xdb, 0xff, 0xd9, 0xd3, 0xe0, 0xff, 0xc8, 0xc2, 0xd0, 0xff, 0xc4, 0xbd, 0xcf, 0xff, 0xbd, 0xb5, 0xca, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x96, 0x8d, 0x8e, 0xa1, 0x97, 0x8d, 0xff, 0xa1, 0x98, 0x8e, 0xff, 0xa0, 0x97, 0x8d, 0xff, 0xa9, 0x9f, 0x95, 0xff, 0xb1, 0xa7, 0x9d, 0xff, 0xb1, 0xa9, 0x9f, 0xff, 0xad, 0xa5, 0x9b, 0xff, 0xb4, 0xab, 0xa1, 0xff, 0xae, 0xa6, 0x9d, 0xff, 0xa2, 0x9c, 0x91, 0xff, 0xa8, 0xa4, 0x9a, 0xff, 0xa9, 0xa6, 0x9b, 0xff, 0xa9, 0xa7, 0x9c, 0xff, 0xac, 0xa7, 0x9c, 0xff, 0xac, 0xa6, 0x9c, 0xff, 0xa7, 0xa1, 0x99, 0xff, 0xa6, 0x9e, 0x94, 0xff, 0xa6, 0x9e, 0x91, 0xff, 0xa1, 0x9a, 0x8e, 0xff, 0x9e, 0x99, 0x9c, 0xff, 0xa7, 0xa2, 0xbd, 0xff, 0x9b, 0x9d, 0xbd, 0xff, 0x8e, 0x97, 0xb7, 0xff, 0x8d, 0x97, 0xb6, 0xff, 0x87, 0x92, 0xb0, 0xff, 0x82, 0x91, 0xb1, 0xff, 0x81, 0x91, 0xb2, 0xff, 0x7f, 0x8f, 0xb3, 0xff, 0x7e, 0x8e, 0xb3, 0xff, 0x7c, 0x8c, 0xb2, 0xff, 0x75, 0x85, 0xab, 0xff, 0x6d, 0x80, 0xa8, 0xff, 0x6f, 0x7f, 0xab, 0xff, 0x6c, 0x7a, 0xa8, 0xff, 0x69, 0x76, 0xa4, 0xff, 0x69, 0x74, 0xa6, 0xff, 0x68, 0x75, 0xa6, 0xff, 0x67, 0x73, 0x9f, 0xff, 0x67, 0x74, 0xa1, 0xff, 0x68, 0x78, 0xa6, 0xff, 0x66, 0x76, 0xa6, 0xff, 0x66, 0x75, 0xa8, 0xff, 0x65, 0x76, 0xa7, 0xff, 0x63, 0x77, 0xa6, 0xff, 0x64, 0x76, 0xa5, 0xff, 0x66, 0x78, 0xa7, 0xff, 0x67, 0x79, 0xa8, 0xff, 0x64, 0x79, 0xa8, 0xff, 0x64, 0x7b, 0xa9, 0xff, 0x69, 0x80, 0xae, 0xff, 0x69, 0x81, 0xaf, 0xff, 0x6a, 0x82, 0xb0, 0xff, 0x70, 0x86, 0xb4, 0xff, 0x74, 0x88, 0xb7, 0xff, 0x75, 0x8a, 0xb7, 0xff, 0x79, 0x8d, 0xba, 0xff, 0x7e, 0x90, 0xbb, 0xff, 0x81, 0x93, 0xbc, 0xff, 0x85, 0x97, 0xbf, 0xff, 0x87, 0x99, 0xc2, 0xff, 0x87, 0x99, 0xc2, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x8a, 0x9c, 0xc6, 0xff, 0x8a, 0x9c, 0xc4, 0xff, 0x88, 0x9c, 0xc1, 0xff, 0x8b, 0x9c, 0xc3, 0xff, 0x8e, 0x9f, 0xc6, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x94, 0xa4, 0xc9, 0xff, 0x96, 0xa5, 0xca, 0xff, 0x96, 0xa7, 0xcc, 0xff, 0x96, 0xa8, 0xcd, 0xff, 0x9b, 0xae, 0xd1, 0xff, 0xa1, 0xb0, 0xd6, 0xff, 0xa6, 0xb2, 0xd5, 0xff, 0xab, 0xb7, 0xd5, 0xff, 0xac, 0xb6, 0xd9, 0xff, 0xb0, 0xb5, 0xda, 0xff, 0xb0, 0xb3, 0xcb, 0xff, 0x9b, 0x9e, 0xa7, 0xff, 0xb4, 0xad, 0xb3, 0xff, 0xc4, 0xb9, 0xc6, 0xff, 0xbe, 0xb4, 0xc5, 0xff, 0xc3, 0xba, 0xc7, 0xff, 0xc5, 0xbd, 0xc7, 0xff, 0xbc, 0xb6, 0xb9, 0xff, 0xae, 0xaa, 0xa8, 0xff, 0x9a, 0x96, 0x93, 0xff, 0x7e, 0x78, 0x76, 0xff, 0x70, 0x68, 0x68, 0xff, 0x7d, 0x75, 0x74, 0xff, 0x7a, 0x73, 0x72, 0xff, 0x75, 0x70, 0x70, 0xff, 0xac, 0xa6, 0xa9, 0xff, 0xec, 0xe3, 0xea, 0xff, 0xf4, 0xe8, 0xf3, 0xff, 0xf4, 0xec, 0xf7, 0xff, 0xea, 0xe7, 0xf2, 0xff, 0xdf, 0xda, 0xe5, 0xff, 0xca, 0xc1, 0xc8, 0xff, 0xa4, 0x9f, 0x9f, 0xff, 0x91, 0x8e, 0x8e, 0xff, 0x90, 0x8a, 0x8d, 0xff, 0x7b, 0x73, 0x75, 0xff, 0x6e, 0x65, 0x67, 0xff, 0x8e, 0x85, 0x89, 0xff, 0xae, 0xa6, 0xae, 0xff, 0xbe, 0xb6, 0xc0, 0xff, 0xcd, 0xc7, 0xd1, 0xff, 0xe1, 0xda, 0xe5, 0xff, 0xea, 0xe0, 0xed, 0xff, 0xe7, 0xdd, 0xeb, 0xff, 0xe6, 0xdc, 0xe8, 0xff, 0xc5, 0xba, 0xc4, 0xff, 0xa7, 0x98, 0xa3, 0xff, 0xd0, 0xc3, 0xce, 0xff, 0xdd, 0xd3, 0xdd, 0xff, 0xdc, 0xd4, 0xdf, 0xff, 0xc3, 0xc1, 0xcc, 0xff, 0xa7, 0xa6, 0xb4, 0xff, 0xa3, 0x9f, 0xb0, 0xff, 0x91, 0x88, 0x9c, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x9c, 0x91, 0x46, 0xa6, 0x9c, 0x90, 0xff, 0xa6, 0x9a, 0x8f, 0xff, 0xa6, 0x9b, 0x90, 0xff, 0xa6, 0x9c, 0x8f, 0xff, 0xb1, 0xa7, 0x9b, 0xff, 0xb4, 0xa9, 0x9f, 0xff, 0xb4, 0xa9, 0x9f, 0xff, 0xb5, 0xaa, 0xa0, 0xff, 0xa9, 0x9e, 0x94, 0xff, 0xa3, 0x9a, 0x8f, 0xff, 0xa5, 0x9e, 0x93, 0xff, 0xa7, 0xa2, 0x97, 0xff, 0xaa, 0xa4, 0x99, 0xff, 0xac, 0xa4, 0x99, 0xff, 0xa8, 0x9f, 0x94, 0xff, 0xa5, 0x9c, 0x93, 0xff, 0xa9, 0x9f, 0x96, 0xff, 0xad, 0xa0, 0x98, 0xff, 0xae, 0xa2, 0x97, 0xff, 0xa0, 0x9b, 0x94, 0xff, 0x9f, 0x9c, 0xa2, 0xff, 0x9b, 0x9d, 0xae, 0xff, 0x8b, 0x93, 0xad, 0xff, 0x88, 0x91, 0xb0, 0xff, 0x85, 0x8e, 0xab, 0xff, 0x80, 0x8b, 0xa9, 0xff, 0x7b, 0x88, 0xa6, 0xff, 0x78, 0x85, 0xa7, 0xff, 0x78, 0x83, 0xa9, 0xff, 0x71, 0x7c, 0xa3, 0xff, 0x6a, 0x74, 0x9c, 0xff, 0x67, 0x73, 0x9c, 0xff, 0x67, 0x72, 0x9b, 0xff, 0x66, 0x6f, 0x98, 0xff, 0x67, 0x6f, 0x97, 0xff, 0x69, 0x70, 0x99, 0xff, 0x6c, 0x73, 0x9c, 0xff, 0x6e, 0x77, 0x9d, 0xff, 0x70, 0x7b, 0xa4, 0xff, 0x6a, 0x79, 0xa2, 0xff, 0x68, 0x78, 0xa3, 0xff, 0x68, 0x78, 0xa6, 0xff, 0x68, 0x7b, 0xa9, 0xff, 0x66, 0x7a, 0xa9, 0xff, 0x64, 0x79, 0xa8, 0xff, 0x65, 0x79, 0xa8, 0xff, 0x66, 0x7a, 0xa9, 0xff, 0x64, 0x7b, 0xa9, 0xff, 0x65, 0x7d, 0xab, 0xff, 0x69, 0x80, 0xae, 0xff, 0x6a, 0x82, 0xb0, 0xff, 0x6c, 0x84, 0xb2, 0xff, 0x73, 0x89, 0xb7, 0xff, 0x77, 0x8b, 0xba, 0xff, 0x78, 0x8d, 0xba, 0xff, 0x7b, 0x8f, 0xbb, 0xff, 0x80, 0x92, 0xbd, 0xff, 0x84, 0x96, 0xbf, 0xff, 0x87, 0x99, 0xc2, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x8b, 0x9d, 0xc6, 0xff, 0x8a, 0x9c, 0xc5, 0xff, 0x88, 0x9b, 0xc2, 0xff, 0x89, 0x9c, 0xc2, 0xff, 0x8b, 0x9c, 0xc4, 0xff, 0x8d, 0x9e, 0xc5, 0xff, 0x8d, 0xa0, 0xc5, 0xff, 0x91, 0xa2, 0xc7, 0xff, 0x94, 0xa4, 0xc9, 0xff, 0x96, 0xa6, 0xcb, 0xff, 0x97, 0xa8, 0xcd, 0xff, 0x97, 0xa9, 0xce, 0xff, 0x9a, 0xad, 0xd0, 0xff, 0x9f, 0xae, 0xd4, 0xff, 0xa4, 0xb0, 0xd3, 0xff, 0xab, 0xb6, 0xd4, 0xff, 0xae, 0xb8, 0xdd, 0xff, 0xb0, 0xb6, 0xdf, 0xff, 0xc2, 0xc6, 0xe4, 0xff, 0xb5, 0xb8, 0xc6, 0xff, 0xc2, 0xbc, 0xc4, 0xff, 0xda, 0xcf, 0xdd, 0xff, 0xcc, 0xc2, 0xd1, 0xff, 0xc3, 0xbb, 0xc7, 0xff, 0xc4, 0xbc, 0xc6, 0xff, 0xb0, 0xa9, 0xad, 0xff, 0x8e, 0x88, 0x89, 0xff, 0x7f, 0x7a, 0x79, 0xff, 0x77, 0x70, 0x6f, 0xff, 0x63, 0x5b, 0x5b, 0xff, 0x65, 0x5d, 0x5d, 0xff, 0x69, 0x62, 0x62, 0xff, 0x87, 0x80, 0x82, 0xff, 0xd0, 0xc7, 0xcd, 0xff, 0xed, 0xe3, 0xeb, 0xff, 0xf8, 0xee, 0xf6, 0xff, 0xfb, 0xf4, 0xff, 0xff, 0xed, 0xea, 0xfb, 0xff, 0xe0, 0xde, 0xee, 0xff, 0xd2, 0xc9, 0xd5, 0xff, 0xaf, 0xa7, 0xad, 0xff, 0x9a, 0x95, 0x98, 0xff, 0x95, 0x8f, 0x93, 0xff, 0x7f, 0x75, 0x7b, 0xff, 0x87, 0x7c, 0x85, 0xff, 0xb2, 0xa8, 0xb3, 0xff, 0xca, 0xc1, 0xcc, 0xff, 0xcd, 0xc6, 0xd0, 0xff, 0xd2, 0xce, 0xd6, 0xff, 0xd6, 0xcf, 0xd9, 0xff, 0xde, 0xd4, 0xe1, 0xff, 0xe9, 0xdf, 0xeb, 0xff, 0xdd, 0xd2, 0xdc, 0xff, 0xa6, 0x9b, 0xa2, 0xff, 0xa6, 0x98, 0x9f, 0xff, 0xd6, 0xc9, 0xd2, 0xff, 0xe3, 0xdb, 0xe3, 0xff, 0xd6, 0xd1, 0xda, 0xff, 0xae, 0xb0, 0xbb, 0xff, 0x9f, 0xa5, 0xb1, 0xff, 0x9d, 0x9d, 0xad, 0xff, 0x95, 0x8e, 0xa0, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x91, 0x91, 0x07, 0xa7, 0x9a, 0x8c, 0xef, 0xa5, 0x99, 0x8c, 0xff, 0xa7, 0x9b, 0x8d, 0xff, 0xa5, 0x99, 0x8a, 0xff, 0xa5, 0x99, 0x8b, 0xff, 0xa8, 0x9a, 0x8e, 0xff, 0xae, 0xa0, 0x94, 0xff, 0xab, 0x9d, 0x91, 0xff, 0xa6, 0x99, 0x8d, 0xff, 0xa3, 0x97, 0x8b, 0xff, 0x9f, 0x95, 0x88, 0xff, 0xa1, 0x99, 0x8c, 0xff, 0x9d, 0x95, 0x88, 0xff, 0xa1, 0x96, 0x89, 0xff, 0xa3, 0x97, 0x8c, 0xff, 0xa3, 0x98, 0x90, 0xff, 0xb0, 0xa2, 0x9b, 0xff, 0xb5, 0xa1, 0x9e, 0xff, 0xb3, 0x9e, 0x9a, 0xff, 0xad, 0xa3, 0x9a, 0xff, 0x9e, 0x9c, 0x93, 0xff, 0x98, 0x99, 0x9c, 0xff, 0x8c, 0x93, 0xa6, 0xff, 0x7e, 0x89, 0xa6, 0xff, 0x7b, 0x84, 0xa2, 0xff, 0x79, 0x7f, 0x9d, 0xff, 0x71, 0x79, 0x98, 0xff, 0x6a, 0x74, 0x95, 0xff, 0x67, 0x71, 0x93, 0xff, 0x65, 0x6f, 0x93, 0xff, 0x65, 0x6e, 0x93, 0xff, 0x6d, 0x75, 0x96, 0xff, 0x70, 0x77, 0x95, 0xff, 0x77, 0x7c, 0x99, 0xff, 0x7d, 0x82, 0x9e, 0xff, 0x7d, 0x84, 0x9a, 0xff, 0x7b, 0x80, 0x97, 0xff, 0x6e, 0x75, 0x98, 0xff, 0x62, 0x6d, 0x95, 0xff, 0x69, 0x75, 0x9c, 0xff, 0x6f, 0x7f, 0xa5, 0xff, 0x6b, 0x7e, 0xa5, 0xff, 0x6b, 0x7e, 0xa9, 0xff, 0x68, 0x7d, 0xac, 0xff, 0x68, 0x7f, 0xad, 0xff, 0x68, 0x7e, 0xac, 0xff, 0x68, 0x7e, 0xac, 0xff, 0x68, 0x7f, 0xad, 0xff, 0x68, 0x7f, 0xad, 0xff, 0x6c, 0x82, 0xb0, 0xff, 0x6b, 0x83, 0xb1, 0xff, 0x6d, 0x85, 0xb3, 0xff, 0x76, 0x8b, 0xbb, 0xff, 0x7a, 0x8e, 0xbe, 0xff, 0x7a, 0x90, 0xbd, 0xff, 0x7d, 0x91, 0xbe, 0xff, 0x81, 0x93, 0xbf, 0xff, 0x85, 0x97, 0xc0, 0xff, 0x88, 0x9a, 0xc2, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x89, 0x9b, 0xc4, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x88, 0x9a, 0xc4, 0xff, 0x8a, 0x9d, 0xc4, 0xff, 0x89, 0x9c, 0xc2, 0xff, 0x8a, 0x9b, 0xc3, 0xff, 0x8b, 0x9c, 0xc3, 0xff, 0x8b, 0x9d, 0xc2, 0xff, 0x90, 0xa1, 0xc6, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x95, 0xa5, 0xca, 0xff, 0x96, 0xa7, 0xcc, 0xff, 0x96, 0xa8, 0xcd, 0xff, 0x9a, 0xae, 0xd0, 0xff, 0xa0, 0xaf, 0xd5, 0xff, 0xa5, 0xb1, 0xd4, 0xff, 0xac, 0xb6, 0xd4, 0xff, 0xac, 0xb5, 0xdd, 0xff, 0xad, 0xb4, 0xe2, 0xff, 0xc5, 0xca, 0xee, 0xff, 0xc9, 0xca, 0xde, 0xff, 0xc6, 0xc0, 0xca, 0xff, 0xdd, 0xd3, 0xe1, 0xff, 0xd0, 0xc7, 0xd5, 0xff, 0xc1, 0xb9, 0xc4, 0xff, 0xbe, 0xb8, 0xbf, 0xff, 0xab, 0xa4, 0xa8, 0xff, 0x95, 0x8e, 0x91, 0xff, 0x85, 0x7f, 0x81, 0xff, 0x84, 0x7d, 0x7d, 0xff, 0x7a, 0x71, 0x71, 0xff, 0x6e, 0x67, 0x66, 0xff, 0x71, 0x69, 0x69, 0xff, 0x96, 0x8b, 0x90, 0xff, 0xd6, 0xc9, 0xd3, 0xff, 0xef, 0xe3, 0xed, 0xff, 0xf7, 0xee, 0xf5, 0xff, 0xf0, 0xea, 0xf7, 0xff, 0xe2, 0xe0, 0xf5, 0xff, 0xdd, 0xde, 0xf2, 0xff, 0xdb, 0xd4, 0xe5, 0xff, 0xc0, 0xb5, 0xc2, 0xff, 0x95, 0x8e, 0x94, 0xff, 0x7a, 0x73, 0x79, 0xff, 0x81, 0x75, 0x82, 0xff, 0xa1, 0x94, 0xa4, 0xff, 0xba, 0xaf, 0xc0, 0xff, 0xc5, 0xbd, 0xca, 0xff, 0xc8, 0xc3, 0xcc, 0xff, 0xbe, 0xbb, 0xbf, 0xff, 0xb4, 0xae, 0xb6, 0xff, 0xc0, 0xb6, 0xc2, 0xff, 0xc1, 0xba, 0xc0, 0xff, 0x8b, 0x82, 0x87, 0xff, 0x74, 0x6b, 0x6e, 0xff, 0xb1, 0xa3, 0xa8, 0xff, 0xd0, 0xc3, 0xca, 0xff, 0xd5, 0xd2, 0xd6, 0xff, 0xc4, 0xc6, 0xcc, 0xff, 0x9c, 0xa4, 0xae, 0xff, 0x8e, 0x9a, 0xa6, 0xff, 0x99, 0x9e, 0xad, 0xef, 0xb6, 0xb6, 0xb6, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x95, 0x8a, 0xa0, 0xa1, 0x97, 0x8c, 0xff, 0xa2, 0x98, 0x8d, 0xff, 0xa0, 0x98, 0x8c, 0xff, 0x9d, 0x94, 0x88, 0xff, 0xa2, 0x95, 0x8a, 0xff, 0xa6, 0x99, 0x8e, 0xff, 0xa6, 0x98, 0x8d, 0xff, 0xa8, 0x9b, 0x90, 0xff, 0xa6, 0x99, 0x8f, 0xff, 0x9f, 0x92, 0x88, 0xff, 0x9c, 0x92, 0x86, 0xff, 0x9c, 0x93, 0x87, 0xff, 0x9f, 0x93, 0x89, 0xff, 0xa1, 0x95, 0x8b, 0xff, 0xab, 0x9e, 0x97, 0xff, 0xb1, 0xa3, 0x9e, 0xff, 0xb0, 0xa2, 0x9f, 0xff, 0xb0, 0xa2, 0xa3, 0xff, 0xb1, 0xa7, 0xa5, 0xff, 0xac, 0xa5, 0xa2, 0xff, 0xa4, 0x9f, 0x9f, 0xff, 0x9d, 0x9c, 0xa2, 0xff, 0x96, 0x96, 0xa2, 0xff, 0x92, 0x92, 0xa0, 0xff, 0x92, 0x91, 0x9f, 0xff, 0x90, 0x90, 0x9e, 0xff, 0x8f, 0x8f, 0x9e, 0xff, 0x94, 0x93, 0xa3, 0xff, 0x9a, 0x98, 0xa9, 0xff, 0xa0, 0x9e, 0xaf, 0xff, 0xa9, 0xa8, 0xb3, 0xff, 0xb2, 0xb0, 0xba, 0xff, 0xbd, 0xbb, 0xc4, 0xff, 0xc4, 0xc4, 0xcc, 0xff, 0xcc, 0xcc, 0xd2, 0xff, 0xd2, 0xcf, 0xd5, 0xff, 0xcc, 0xc9, 0xd7, 0xff, 0xb1, 0xb3, 0xc4, 0xff, 0x7a, 0x83, 0x9b, 0xff, 0x6d, 0x7c, 0x9c, 0xff, 0x74, 0x85, 0xac, 0xff, 0x6a, 0x7f, 0xad, 0xff, 0x6c, 0x81, 0xb1, 0xff, 0x6b, 0x83, 0xb1, 0xff, 0x6a, 0x82, 0xb0, 0xff, 0x6a, 0x82, 0xb0, 0xff, 0x6b, 0x82, 0xb0, 0xff, 0x6c, 0x83, 0xb1, 0xff, 0x6d, 0x85, 0xb3, 0xff, 0x6f, 0x86, 0xb4, 0xff, 0x73, 0x88, 0xb6, 0xff, 0x7a, 0x8e, 0xba, 0xff, 0x7d, 0x8f, 0xbc, 0xff, 0x7f, 0x91, 0xbc, 0xff, 0x83, 0x95, 0xbe, 0xff, 0x84, 0x97, 0xbf, 0xff, 0x86, 0x98, 0xc2, 0xff, 0x88, 0x99, 0xc4, 0xff, 0x89, 0x9a, 0xc5, 0xff, 0x8a, 0x9b, 0xc5, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x8a, 0x9c, 0xc2, 0xff, 0x8b, 0x9d, 0xc1, 0xff, 0x8a, 0x9c, 0xc1, 0xff, 0x8b, 0x9c, 0xc2, 0xff, 0x8c, 0x9e, 0xc3, 0xff, 0x90, 0xa3, 0xc8, 0xff, 0x94, 0xa5, 0xca, 0xff, 0x93, 0xa4, 0xc9, 0xff, 0x93, 0xa5, 0xca, 0xff, 0x97, 0xa9, 0xce, 0xff, 0x9b, 0xad, 0xd1, 0xff, 0xa0, 0xaf, 0xd4, 0xff, 0xa2, 0xb1, 0xd6, 0xff, 0xa7, 0xb5, 0xd7, 0xff, 0xab, 0xb7, 0xd7, 0xff, 0xaf, 0xb8, 0xdb, 0xff, 0xc7, 0xd0, 0xf4, 0xff, 0xc9, 0xca, 0xe5, 0xff, 0xc5, 0xbb, 0xcb, 0xff, 0xdc, 0xcf, 0xd9, 0xff, 0xcb, 0xc4, 0xcc, 0xff, 0xc1, 0xbb, 0xc2, 0xff, 0xb6, 0xb0, 0xb5, 0xff, 0xa6, 0xa0, 0xa3, 0xff, 0x9e, 0x98, 0x9a, 0xff, 0x97, 0x92, 0x93, 0xff, 0x99, 0x94, 0x93, 0xff, 0xa2, 0x9c, 0x9c, 0xff, 0x96, 0x90, 0x91, 0xff, 0x83, 0x7a, 0x7d, 0xff, 0xa3, 0x98, 0x9b, 0xff, 0xcd, 0xc2, 0xc7, 0xff, 0xe1, 0xd8, 0xdf, 0xff, 0xe0, 0xda, 0xe4, 0xff, 0xd5, 0xd1, 0xdf, 0xff, 0xd7, 0xd6, 0xe7, 0xff, 0xdb, 0xdc, 0xef, 0xff, 0xd1, 0xcf, 0xe1, 0xff, 0xb4, 0xb1, 0xc1, 0xff, 0x92, 0x8d, 0x98, 0xff, 0x7a, 0x72, 0x7a, 0xff, 0x82, 0x77, 0x80, 0xff, 0x9c, 0x90, 0x99, 0xff, 0xb0, 0xa7, 0xb0, 0xff, 0xc3, 0xbc, 0xc4, 0xff, 0xcb, 0xc3, 0xcd, 0xff, 0xc7, 0xbf, 0xc8, 0xff, 0xc0, 0xb8, 0xc1, 0xff, 0xb2, 0xa8, 0xb3, 0xff, 0x88, 0x81, 0x87, 0xff, 0x61, 0x5a, 0x5d, 0xff, 0x64, 0x5c, 0x5d, 0xff, 0x9a, 0x8f, 0x8f, 0xff, 0xb8, 0xb0, 0xb2, 0xff, 0xc0, 0xc1, 0xc4, 0xff, 0xb9, 0xbe, 0xc5, 0xff, 0xa0, 0xa7, 0xb3, 0xff, 0x9d, 0xa5, 0xb1, 0xff, 0xad, 0xaf, 0xbd, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x9e, 0x97, 0x4a, 0xaa, 0xa2, 0x98, 0xff, 0xab, 0xa2, 0x99, 0xff, 0xaa, 0xa2, 0x98, 0xff, 0xab, 0xa2, 0x99, 0xff, 0xb2, 0xa7, 0x9f, 0xff, 0xb5, 0xaa, 0xa2, 0xff, 0xb1, 0xa6, 0x9e, 0xff, 0xb2, 0xa7, 0x9f, 0xff, 0xb3, 0xa8, 0xa0, 0xff, 0xad, 0xa1, 0x9a, 0xff, 0xaa, 0xa0, 0x97, 0xff, 0xaf, 0xa6, 0x9c, 0xff, 0xb2, 0xa7, 0xa0, 0xff, 0xb1, 0xa6, 0xa0, 0xff, 0xb7, 0xac, 0xa7, 0xff, 0xbd, 0xb2, 0xae, 0xff, 0xbe, 0xb3, 0xb0, 0xff, 0xbf, 0xb6, 0xb7, 0xff, 0xc0, 0xb7, 0xb8, 0xff, 0xbd, 0xb4, 0xb5, 0xff, 0xb8, 0xb3, 0xaf, 0xff, 0xb7, 0xb2, 0xae, 0xff, 0xb6, 0xb1, 0xaf, 0xff, 0xb6, 0xb2, 0xb4, 0xff, 0xb9, 0xb6, 0xb9, 0xff, 0xbc, 0xb9, 0xbb, 0xff, 0xc0, 0xbd, 0xbe, 0xff, 0xc7, 0xc2, 0xc3, 0xff, 0xca, 0xc4, 0xc6, 0xff, 0xcd, 0xc8, 0xc8, 0xff, 0xd4, 0xcf, 0xcd, 0xff, 0xd9, 0xd4, 0xd3, 0xff, 0xde, 0xd9, 0xd8, 0xff, 0xe1, 0xde, 0xdc, 0xff, 0xe9, 0xe4, 0xe3, 0xff, 0xf1, 0xea, 0xe9, 0xff, 0xfd, 0xf7, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xe2, 0xec, 0xff, 0x84, 0x90, 0xa9, 0xff, 0x74, 0x82, 0xa8, 0xff, 0x73, 0x88, 0xb7, 0xff, 0x6f, 0x86, 0xb6, 0xff, 0x6c, 0x83, 0xb1, 0xff, 0x6c, 0x84, 0xb2, 0xff, 0x6c, 0x84, 0xb2, 0xff, 0x6f, 0x86, 0xb4, 0xff, 0x71, 0x89, 0xb7, 0xff, 0x71, 0x8a, 0xb8, 0xff, 0x74, 0x8a, 0xb9, 0xff, 0x79, 0x8d, 0xbb, 0xff, 0x7c, 0x90, 0xbb, 0xff, 0x7f, 0x91, 0xbc, 0xff, 0x84, 0x95, 0xbe, 0xff, 0x87, 0x9a, 0xc0, 0xff, 0x88, 0x9b, 0xc1, 0xff, 0x89, 0x9b, 0xc4, 0xff, 0x89, 0x9a, 0xc5, 0xff, 0x88, 0x9a, 0xc4, 0xff, 0x89, 0x9c, 0xc3, 0xff, 0x89, 0x9c, 0xc3, 0xff, 0x88, 0x9b, 0xc3, 0xff, 0x89, 0x9c, 0xc1, 0xff, 0x8c, 0x9e, 0xc2, 0xff, 0x8b, 0x9d, 0xc2, 0xff, 0x8d, 0xa0, 0xc4, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x91, 0xa3, 0xc8, 0xff, 0x92, 0xa4, 0xc9, 0xff, 0x93, 0xa4, 0xc9, 0xff, 0x96, 0xa8, 0xcd, 0xff, 0x9d, 0xad, 0xd2, 0xff, 0x9f, 0xaf, 0xd4, 0xff, 0xa1, 0xb1, 0xd7, 0xff, 0xa2, 0xb4, 0xd9, 0xff, 0xaa, 0xb8, 0xd5, 0xff, 0xb1, 0xba, 0xd9, 0xff, 0xc9, 0xd4, 0xf6, 0xff, 0xcc, 0xd0, 0xec, 0xff, 0xbd, 0xb4, 0xc6, 0xff, 0xc8, 0xbd, 0xc3, 0xff, 0xbe, 0xb6, 0xbc, 0xff, 0xb6, 0xb0, 0xb5, 0xff, 0xab, 0xa5, 0xa9, 0xff, 0xa0, 0x9b, 0x9d, 0xff, 0x9e, 0x99, 0x9a, 0xff, 0xa0, 0x9b, 0x9c, 0xff, 0xa5, 0xa0, 0xa1, 0xff, 0xac, 0xa7, 0xa8, 0xff, 0xa1, 0x9b, 0x9d, 0xff, 0x8f, 0x87, 0x8a, 0xff, 0xa3, 0x9b, 0x9d, 0xff, 0xb5, 0xaf, 0xb2, 0xff, 0xbf, 0xb9, 0xbf, 0xff, 0xc7, 0xc1, 0xcc, 0xff, 0xcd, 0xca, 0xd7, 0xff, 0xd2, 0xd2, 0xe1, 0xff, 0xd1, 0xd1, 0xe2, 0xff, 0xc0, 0xc2, 0xd2, 0xff, 0xb2, 0xb4, 0xc4, 0xff, 0xab, 0xa7, 0xb3, 0xff, 0x99, 0x91, 0x99, 0xff, 0x74, 0x6a, 0x70, 0xff, 0x8b, 0x7f, 0x84, 0xff, 0xc4, 0xb9, 0xbf, 0xff, 0xd5, 0xcd, 0xd4, 0xff, 0xd7, 0xce, 0xd9, 0xff, 0xda, 0xd1, 0xdc, 0xff, 0xe4, 0xdb, 0xe5, 0xff, 0xdf, 0xd6, 0xe0, 0xff, 0xbd, 0xb6, 0xbe, 0xff, 0x92, 0x8c, 0x91, 0xff, 0x6e, 0x67, 0x69, 0xff, 0x71, 0x68, 0x67, 0xff, 0xa8, 0xa1, 0xa2, 0xff, 0xb8, 0xb6, 0xbc, 0xff, 0xbe, 0xc0, 0xca, 0xff, 0xb3, 0xb7, 0xc3, 0xff, 0xb2, 0xb5, 0xc0, 0xff, 0xc4, 0xc0, 0xce, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x04, 0xc1, 0xb7, 0xaf, 0xe7, 0xc1, 0xb8, 0xaf, 0xff, 0xc0, 0xb6, 0xad, 0xff, 0xbf, 0xb6, 0xad, 0xff, 0xc0, 0xb7, 0xb2, 0xff, 0xc5, 0xbb, 0xb7, 0xff, 0xc3, 0xba, 0xb5, 0xff, 0xc3, 0xb9, 0xb5, 0xff, 0xc2, 0xb8, 0xb4, 0xff, 0xbf, 0xb5, 0xb1, 0xff, 0xbf, 0xb7, 0xb0, 0xff, 0xc1, 0xba, 0xb2, 0xff, 0xc3, 0xbc, 0xb7, 0xff, 0xc4, 0xbc, 0xb8, 0xff, 0xc5, 0xbe, 0xba, 0xff, 0xc9, 0xc0, 0xbf, 0xff, 0xcd, 0xc3, 0xc4, 0xff, 0xce, 0xc3, 0xc3, 0xff, 0xcc, 0xc3, 0xc3, 0xff, 0xc9, 0xc1, 0xc1, 0xff, 0xc9, 0xc2, 0xc2, 0xff, 0xc8, 0xc3, 0xc3, 0xff, 0xc7, 0xc3, 0xc3, 0xff, 0xc5, 0xc3, 0xc3, 0xff, 0xc7, 0xc5, 0xc5, 0xff, 0xca, 0xc9, 0xc8, 0xff, 0xcd, 0xcb, 0xca, 0xff, 0xd1, 0xcd, 0xcd, 0xff, 0xd3, 0xcf, 0xcf, 0xff, 0xd6, 0xd2, 0xd2, 0xff, 0xde, 0xd8, 0xd9, 0xff, 0xe3, 0xdd, 0xdd, 0xff, 0xe6, 0xe1, 0xe1, 0xff, 0xe9, 0xe5, 0xe4, 0xff, 0xef, 0xeb, 0xea, 0xff, 0xf6, 0xf1, 0xf1, 0xff, 0xfb, 0xf4, 0xf5, 0xff, 0xf9, 0xf3, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xca, 0xd5, 0xff, 0x78, 0x85, 0xa7, 0xff, 0x7b, 0x90, 0xbb, 0xff, 0x71, 0x89, 0xb9, 0xff, 0x6d, 0x85, 0xb4, 0xff, 0x6f, 0x88, 0xb6, 0xff, 0x71, 0x8a, 0xb8, 0xff, 0x75, 0x8c, 0xba, 0xff, 0x77, 0x8e, 0xbc, 0xff, 0x78, 0x90, 0xbe, 0xff, 0x79, 0x8f, 0xbd, 0xff, 0x7b, 0x90, 0xbd, 0xff, 0x7e, 0x91, 0xbd, 0xff, 0x82, 0x94, 0xbf, 0xff, 0x87, 0x98, 0xc3, 0xff, 0x88, 0x9b, 0xc3, 0xff, 0x89, 0x9c, 0xc2, 0xff, 0x8a, 0x9d, 0xc3, 0xff, 0x89, 0x9c, 0xc3, 0xff, 0x88, 0x9b, 0xc2, 0xff, 0x88, 0x9b, 0xc1, 0xff, 0x89, 0x9c, 0xc1, 0xff, 0x89, 0x9c, 0xc2, 0xff, 0x8b, 0x9d, 0xc2, 0xff, 0x8c, 0x9e, 0xc3, 0xff, 0x8b, 0x9d, 0xc2, 0xff, 0x8c, 0x9e, 0xc3, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x91, 0xa3, 0xc8, 0xff, 0x95, 0xa7, 0xcc, 0xff, 0x97, 0xa9, 0xce, 0xff, 0x9c, 0xac, 0xd1, 0xff, 0x9f, 0xaf, 0xd4, 0xff, 0xa2, 0xb1, 0xd7, 0xff, 0xa1, 0xb4, 0xd8, 0xff, 0xa6, 0xb6, 0xd7, 0xff, 0xb0, 0xb9, 0xdc, 0xff, 0xc9, 0xd5, 0xfa, 0xff, 0xd3, 0xda, 0xf8, 0xff, 0xa9, 0xa4, 0xb3, 0xff, 0xa2, 0x9b, 0x9d, 0xff, 0x9d, 0x95, 0x9a, 0xff, 0x99, 0x91, 0x96, 0xff, 0x9c, 0x95, 0x97, 0xff, 0x99, 0x92, 0x95, 0xff, 0x96, 0x8f, 0x91, 0xff, 0xa5, 0x9e, 0x9e, 0xff, 0xad, 0xa7, 0xa7, 0xff, 0xa8, 0xa3, 0xa4, 0xff, 0x9c, 0x95, 0x99, 0xff, 0x98, 0x8f, 0x94, 0xff, 0xa3, 0x9b, 0x9f, 0xff, 0xba, 0xb4, 0xb9, 0xff, 0xc5, 0xbe, 0xc5, 0xff, 0xca, 0xc4, 0xcf, 0xff, 0xd5, 0xd2, 0xdf, 0xff, 0xd7, 0xd7, 0xe7, 0xff, 0xcd, 0xcd, 0xdc, 0xff, 0xbc, 0xbb, 0xca, 0xff, 0xbd, 0xbb, 0xc9, 0xff, 0xbe, 0xb9, 0xc4, 0xff, 0xbf, 0xb7, 0xbf, 0xff, 0xab, 0xa1, 0xa7, 0xff, 0xb7, 0xab, 0xb1, 0xff, 0xd9, 0xce, 0xd8, 0xff, 0xda, 0xd0, 0xdb, 0xff, 0xe0, 0xd8, 0xe2, 0xff, 0xea, 0xe2, 0xed, 0xff, 0xf5, 0xed, 0xf8, 0xff, 0xf9, 0xf2, 0xfd, 0xff, 0xef, 0xe9, 0xf3, 0xff, 0xba, 0xb3, 0xba, 0xff, 0x7a, 0x73, 0x76, 0xff, 0x7e, 0x76, 0x76, 0xff, 0xa8, 0xa0, 0xa3, 0xff, 0xb9, 0xb3, 0xbb, 0xff, 0xcc, 0xc7, 0xd3, 0xff, 0xc2, 0xc1, 0xcd, 0xff, 0xbc, 0xbb, 0xc7, 0xe7, 0xcc, 0xcc, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xc8, 0xc0, 0x87, 0xd1, 0xc9, 0xc0, 0xff, 0xd1, 0xc9, 0xbf, 0xff, 0xcf, 0xc7, 0xbe, 0xff, 0xcd, 0xc6, 0xc1, 0xff, 0xcf, 0xc8, 0xc4, 0xff, 0xd0, 0xc9, 0xc5, 0xff, 0xcf, 0xc8, 0xc3, 0xff, 0xcc, 0xc5, 0xc0, 0xff, 0xcf, 0xc7, 0xc2, 0xff, 0xd1, 0xca, 0xc6, 0xff, 0xd1, 0xcb, 0xc6, 0xff, 0xd2, 0xcb, 0xc8, 0xff, 0xd2, 0xcb, 0xca, 0xff, 0xd2, 0xcb, 0xcb, 0xff, 0xd4, 0xcc, 0xcd, 0xff, 0xd7, 0xcf, 0xd0, 0xff, 0xd7, 0xce, 0xce, 0xff, 0xd7, 0xce, 0xce, 0xff, 0xd6, 0xce, 0xce, 0xff, 0xd6, 0xce, 0xce, 0xff, 0xd4, 0xce, 0xcd, 0xff, 0xd3, 0xce, 0xcd, 0xff, 0xd3, 0xd0, 0xce, 0xff, 0xd5, 0xd2, 0xd0, 0xff, 0xd7, 0xd5, 0xd3, 0xff, 0xd9, 0xd6, 0xd5, 0xff, 0xdb, 0xd6, 0xd7, 0xff, 0xde, 0xd9, 0xd8, 0xff, 0xe0, 0xdb, 0xdc, 0xff, 0xe4, 0xde, 0xe0, 0xff, 0xe7, 0xe1, 0xe3, 0xff, 0xea, 0xe4, 0xe6, 0xff, 0xec, 0xe7, 0xe9, 0xff, 0xf2, 0xed, 0xef, 0xff, 0xfa, 0xf2, 0xf5, 0xff, 0xfe, 0xf5, 0xf4, 0xff, 0xfe, 0xf7, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xed, 0xf5, 0xff, 0x8f, 0x99, 0xb4, 0xff, 0x78, 0x8d, 0xb8, 0xff, 0x75, 0x8d, 0xbd, 0xff, 0x74, 0x8b, 0xb9, 0xff, 0x76, 0x8d, 0xba, 0xff, 0x78, 0x8f, 0xbd, 0xff, 0x7a, 0x90, 0xbe, 0xff, 0x7c, 0x92, 0xc0, 0xff, 0x7c, 0x92, 0xc0, 0xff, 0x7d, 0x93, 0xc1, 0xff, 0x7e, 0x93, 0xc0, 0xff, 0x7f, 0x92, 0xbe, 0xff, 0x82, 0x94, 0xbf, 0xff, 0x88, 0x99, 0xc4, 0xff, 0x8a, 0x9c, 0xc4, 0xff, 0x8b, 0x9e, 0xc4, 0xff, 0x8b, 0x9e, 0xc4, 0xff, 0x8a, 0x9e, 0xc3, 0xff, 0x8a, 0x9d, 0xc3, 0xff, 0x89, 0x9c, 0xc1, 0xff, 0x88, 0x9b, 0xc1, 0xff, 0x88, 0x9b, 0xc1, 0xff, 0x8b, 0x9d, 0xc2, 0xff, 0x8e, 0xa0, 0xc5, 0xff, 0x8e, 0xa0, 0xc5, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x8e, 0xa0, 0xc5, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x92, 0xa4, 0xc9, 0xff, 0x92, 0xa4, 0xc9, 0xff, 0x93, 0xa5, 0xca, 0xff, 0x96, 0xa9, 0xce, 0xff, 0x9a, 0xaa, 0xcf, 0xff, 0x9d, 0xac, 0xd1, 0xff, 0x9e, 0xae, 0xd3, 0xff, 0xa2, 0xb2, 0xd8, 0xff, 0xa7, 0xb5, 0xd6, 0xff, 0xb1, 0xbc, 0xde, 0xff, 0xc7, 0xd4, 0xfa, 0xff, 0xe0, 0xea, 0xff, 0xff, 0xa0, 0xa1, 0xb0, 0xff, 0x82, 0x7f, 0x82, 0xff, 0x91, 0x8a, 0x8d, 0xff, 0x93, 0x8d, 0x8f, 0xff, 0x97, 0x91, 0x94, 0xff, 0x95, 0x8e, 0x92, 0xff, 0x97, 0x8e, 0x91, 0xff, 0xa1, 0x9a, 0x9c, 0xff, 0xa7, 0xa3, 0xa5, 0xff, 0x9f, 0x9a, 0x9e, 0xff, 0x94, 0x8e, 0x95, 0xff, 0x96, 0x91, 0x98, 0xff, 0x9e, 0x98, 0x9e, 0xff, 0xbd, 0xb4, 0xbd, 0xff, 0xd5, 0xce, 0xd8, 0xff, 0xd9, 0xd4, 0xe0, 0xff, 0xda, 0xd7, 0xe5, 0xff, 0xde, 0xdc, 0xec, 0xff, 0xcd, 0xcd, 0xde, 0xff, 0xc3, 0xc0, 0xcf, 0xff, 0xcd, 0xc8, 0xd5, 0xff, 0xd1, 0xcb, 0xd5, 0xff, 0xdd, 0xd4, 0xde, 0xff, 0xdb, 0xd0, 0xd8, 0xff, 0xdb, 0xce, 0xd7, 0xff, 0xe7, 0xdc, 0xe7, 0xff, 0xe7, 0xde, 0xeb, 0xff, 0xeb, 0xe4, 0xf1, 0xff, 0xf7, 0xf0, 0xfd, 0xff, 0xfb, 0xf4, 0xff, 0xff, 0xfb, 0xf4, 0xff, 0xff, 0xf6, 0xf1, 0xfd, 0xff, 0xcd, 0xc9, 0xd2, 0xff, 0x90, 0x89, 0x8f, 0xff, 0x95, 0x8d, 0x8f, 0xff, 0xb0, 0xa8, 0xab, 0xff, 0xc8, 0xbf, 0xc8, 0xff, 0xd9, 0xd0, 0xdd, 0xff, 0xd9, 0xd2, 0xdf, 0xff, 0xcf, 0xca, 0xd5, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xd2, 0xca, 0x22, 0xd9, 0xd3, 0xca, 0xfe, 0xda, 0xd4, 0xcb, 0xff, 0xda, 0xd3, 0xca, 0xff, 0xd8, 0xd1, 0xcc, 0xff, 0xd8, 0xd1, 0xcc, 0xff, 0xd9, 0xd2, 0xcc, 0xff, 0xd8, 0xd2, 0xca, 0xff, 0xd8, 0xd2, 0xca, 0xff, 0xda, 0xd3, 0xcc, 0xff, 0xdb, 0xd5, 0xce, 0xff, 0xdb, 0xd5, 0xd1, 0xff, 0xdc, 0xd6, 0xd2, 0xff, 0xde, 0xd6, 0xd5, 0xff, 0xde, 0xd6, 0xd6, 0xff, 0xdf, 0xd7, 0xd6, 0xff, 0xdf, 0xd7, 0xd6, 0xff, 0xdf, 0xd7, 0xd7, 0xff, 0xdf, 0xd7, 0xd6, 0xff, 0xde, 0xd6, 0xd6, 0xff, 0xdf, 0xd6, 0xd3, 0xff, 0xdc, 0xd5, 0xd1, 0xff, 0xdb, 0xd5, 0xd1, 0xff, 0xdb, 0xd6, 0xd4, 0xff, 0xdb, 0xd7, 0xd7, 0xff, 0xdd, 0xd9, 0xd8, 0xff, 0xdf, 0xdb, 0xda, 0xff, 0xdf, 0xdc, 0xda, 0xff, 0xe1, 0xdd, 0xdc, 0xff, 0xe3, 0xdf, 0xde, 0xff, 0xe5, 0xe0, 0xe1, 0xff, 0xe8, 0xe3, 0xe4, 0xff, 0xeb, 0xe6, 0xe7, 0xff, 0xee, 0xe9, 0xec, 0xff, 0xf4, 0xef, 0xf1, 0xff, 0xfa, 0xf4, 0xf4, 0xff, 0xfb, 0xf5, 0xf3, 0xff, 0xfe, 0xf9, 0xf4, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xb2, 0xc5, 0xff, 0x74, 0x89, 0xb3, 0xff, 0x79, 0x91, 0xc0, 0xff, 0x7b, 0x90, 0xbd, 0xff, 0x7c, 0x90, 0xbd, 0xff, 0x7f, 0x93, 0xc0, 0xff, 0x7d, 0x92, 0xbf, 0xff, 0x7f, 0x94, 0xc0, 0xff, 0x81, 0x96, 0xc2, 0xff, 0x7e, 0x93, 0xc1, 0xff, 0x7e, 0x93, 0xc0, 0xff, 0x82, 0x95, 0xc1, 0xff, 0x85, 0x97, 0xc2, 0xff, 0x88, 0x99, 0xc3, 0xff, 0x8b, 0x9e, 0xc5, 0xff, 0x8d, 0xa0, 0xc5, 0xff, 0x8d, 0xa0, 0xc6, 0xff, 0x8b, 0x9e, 0xc5, 0xff, 0x8a, 0x9d, 0xc3, 0xff, 0x89, 0x9c, 0xc2, 0xff, 0x87, 0x9a, 0xc0, 0xff, 0x89, 0x9c, 0xc2, 0xff, 0x8c, 0x9f, 0xc4, 0xff, 0x91, 0xa3, 0xc8, 0xff, 0x8e, 0xa0, 0xc5, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x92, 0xa4, 0xc9, 0xff, 0x92, 0xa4, 0xc9, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x94, 0xa6, 0xcb, 0xff, 0x9b, 0xab, 0xd0, 0xff, 0x9d, 0xad, 0xd2, 0xff, 0x9e, 0xaf, 0xd4, 0xff, 0xa3, 0xb2, 0xd8, 0xff, 0xa9, 0xb4, 0xd6, 0xff, 0xb5, 0xc1, 0xe2, 0xff, 0xc3, 0xd3, 0xf9, 0xff, 0xe6, 0xf4, 0xff, 0xff, 0xb2, 0xba, 0xc7, 0xff, 0x76, 0x77, 0x7b, 0xff, 0x94, 0x90, 0x90, 0xff, 0x92, 0x8e, 0x91, 0xff, 0x93, 0x8e, 0x94, 0xff, 0x8f, 0x8a, 0x8f, 0xff, 0x8c, 0x84, 0x89, 0xff, 0x81, 0x7d, 0x82, 0xff, 0x81, 0x82, 0x86, 0xff, 0x82, 0x82, 0x88, 0xff, 0x7d, 0x7d, 0x86, 0xff, 0x84, 0x83, 0x8d, 0xff, 0x9c, 0x96, 0xa0, 0xff, 0xc0, 0xb6, 0xc2, 0xff, 0xda, 0xd2, 0xdf, 0xff, 0xe7, 0xe3, 0xee, 0xff, 0xea, 0xe6, 0xf4, 0xff, 0xe4, 0xe1, 0xf1, 0xff, 0xd7, 0xd5, 0xe7, 0xff, 0xd5, 0xd1, 0xe0, 0xff, 0xe0, 0xd8, 0xe4, 0xff, 0xdd, 0xd4, 0xde, 0xff, 0xdf, 0xd5, 0xdf, 0xff, 0xdf, 0xd3, 0xdd, 0xff, 0xe5, 0xd9, 0xe4, 0xff, 0xf2, 0xe8, 0xf4, 0xff, 0xe8, 0xe0, 0xef, 0xff, 0xe0, 0xda, 0xec, 0xff, 0xec, 0xe5, 0xf5, 0xff, 0xf6, 0xef, 0xff, 0xff, 0xfc, 0xf5, 0xff, 0xff, 0xef, 0xeb, 0xf8, 0xff, 0xd4, 0xd1, 0xdc, 0xff, 0xb5, 0xb0, 0xb8, 0xff, 0xa3, 0x9d, 0xa1, 0xff, 0xb2, 0xab, 0xb0, 0xff, 0xd0, 0xc8, 0xd2, 0xff, 0xda, 0xd2, 0xde, 0xff, 0xdf, 0xd6, 0xe3, 0xfe, 0xda, 0xd3, 0xe1, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xda, 0xd3, 0xb4, 0xe2, 0xda, 0xd3, 0xff, 0xe1, 0xda, 0xd2, 0xff, 0xe1, 0xda, 0xd0, 0xff, 0xe2, 0xda, 0xd1, 0xff, 0xe2, 0xdb, 0xd1, 0xff, 0xe2, 0xda, 0xd1, 0xff, 0xe2, 0xda, 0xd1, 0xff, 0xe2, 0xda, 0xd1, 0xff, 0xe1, 0xd9, 0xd1, 0xff, 0xe1, 0xda, 0xd3, 0xff, 0xe3, 0xdb, 0xd6, 0xff, 0xe5, 0xdc, 0xd9, 0xff, 0xe6, 0xde, 0xdb, 0xff, 0xe6, 0xdd, 0xd9, 0xff, 0xe5, 0xdc, 0xd9, 0xff, 0xe3, 0xdd, 0xd9, 0xff, 0xe3, 0xdd, 0xd9, 0xff, 0xe2, 0xdc, 0xd8, 0xff, 0xe5, 0xda, 0xd7, 0xff, 0xe3, 0xd9, 0xd6, 0xff, 0xe1, 0xda, 0xd6, 0xff, 0xdf, 0xda, 0xd8, 0xff, 0xdf, 0xdb, 0xd9, 0xff, 0xe1, 0xdc, 0xda, 0xff, 0xe1, 0xdc, 0xdb, 0xff, 0xe2, 0xdd, 0xdc, 0xff, 0xe4, 0xdf, 0xdd, 0xff, 0xe6, 0xe1, 0xe0, 0xff, 0xe7, 0xe2, 0xe3, 0xff, 0xe9, 0xe5, 0xe6, 0xff, 0xec, 0xe7, 0xe8, 0xff, 0xf1, 0xec, 0xed, 0xff, 0xf6, 0xf2, 0xf1, 0xff, 0xf7, 0xf5, 0xf5, 0xff, 0xf5, 0xf5, 0xf9, 0xff, 0xfb, 0xf7, 0xfb, 0xff, 0xff, 0xfa, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xc8, 0xd7, 0xff, 0x7a, 0x8b, 0xb2, 0xff, 0x81, 0x95, 0xc4, 0xff, 0x81, 0x94, 0xc2, 0xff, 0x80, 0x94, 0xc1, 0xff, 0x83, 0x96, 0xc3, 0xff, 0x82, 0x96, 0xc3, 0xff, 0x81, 0x95, 0xc3, 0xff, 0x84, 0x98, 0xc5, 0xff, 0x82, 0x96, 0xc4, 0xff, 0x82, 0x97, 0xc6, 0xff, 0x85, 0x99, 0xc5, 0xff, 0x86, 0x98, 0xc3, 0xff, 0x88, 0x9a, 0xc4, 0xff, 0x8c, 0x9e, 0xc6, 0xff, 0x8d, 0xa0, 0xc6, 0xff, 0x8e, 0xa1, 0xc7, 0xff, 0x8c, 0x9f, 0xc4, 0xff, 0x88, 0x9c, 0xc1, 0xff, 0x89, 0x9c, 0xc2, 0xff, 0x89, 0x9d, 0xc3, 0xff, 0x89, 0x9d, 0xc3, 0xff, 0x8e, 0xa1, 0xc6, 0xff, 0x90, 0xa1, 0xc6, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x91, 0xa3, 0xc8, 0xff, 0x91, 0xa3, 0xc8, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x94, 0xa6, 0xcb, 0xff, 0x9a, 0xaa, 0xcf, 0xff, 0x9c, 0xac, 0xd1, 0xff, 0x9e, 0xaf, 0xd3, 0xff, 0xa1, 0xb2, 0xd8, 0xff, 0xa8, 0xb5, 0xd9, 0xff, 0xb7, 0xc2, 0xe8, 0xff, 0xc3, 0xd5, 0xfc, 0xff, 0xdf, 0xf0, 0xff, 0xff, 0xd6, 0xe0, 0xed, 0xff, 0x72, 0x75, 0x77, 0xff, 0x6e, 0x6d, 0x6e, 0xff, 0x7a, 0x79, 0x7d, 0xff, 0x76, 0x75, 0x7b, 0xff, 0x67, 0x67, 0x6f, 0xff, 0x5f, 0x5c, 0x64, 0xff, 0x5f, 0x5d, 0x66, 0xff, 0x64, 0x6e, 0x74, 0xff, 0x63, 0x71, 0x77, 0xff, 0x71, 0x7a, 0x81, 0xff, 0x81, 0x85, 0x8e, 0xff, 0xa4, 0x9f, 0xa9, 0xff, 0xd5, 0xc8, 0xd5, 0xff, 0xe6, 0xdb, 0xe9, 0xff, 0xee, 0xea, 0xf6, 0xff, 0xed, 0xea, 0xf9, 0xff, 0xe6, 0xe4, 0xf5, 0xff, 0xe1, 0xde, 0xee, 0xff, 0xd6, 0xd1, 0xdf, 0xff, 0xda, 0xd2, 0xdd, 0xff, 0xd7, 0xcd, 0xd9, 0xff, 0xd0, 0xc6, 0xd2, 0xff, 0xd7, 0xcc, 0xd6, 0xff, 0xe3, 0xd6, 0xe1, 0xff, 0xea, 0xdf, 0xee, 0xff, 0xe1, 0xd8, 0xe9, 0xff, 0xdf, 0xd9, 0xec, 0xff, 0xe8, 0xe1, 0xf1, 0xff, 0xef, 0xe8, 0xf8, 0xff, 0xf0, 0xe8, 0xfa, 0xff, 0xdb, 0xd5, 0xe6, 0xff, 0xd0, 0xcc, 0xd9, 0xff, 0xbf, 0xbd, 0xc7, 0xff, 0xa6, 0xa6, 0xac, 0xff, 0xb5, 0xb3, 0xb9, 0xff, 0xd4, 0xcc, 0xd8, 0xff, 0xdd, 0xd4, 0xe0, 0xff, 0xde, 0xd6, 0xe1, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xdf, 0xd7, 0x40, 0xe7, 0xde, 0xd7, 0xff, 0xe6, 0xde, 0xd7, 0xff, 0xe8, 0xde, 0xd5, 0xff, 0xe7, 0xde, 0xd5, 0xff, 0xe8, 0xdf, 0xd5, 0xff, 0xe6, 0xde, 0xd5, 0xff, 0xe7, 0xdf, 0xd6, 0xff, 0xe6, 0xde, 0xd5, 0xff, 0xe4, 0xdd, 0xd4, 0xff, 0xe4, 0xdd, 0xd4, 0xff, 0xe6, 0xdd, 0xd7, 0xff, 0xe7, 0xde, 0xda, 0xff, 0xe7, 0xde, 0xda, 0xff, 0xe7, 0xde, 0xda, 0xff, 0xe8, 0xdf, 0xdb, 0xff, 0xe5, 0xdf, 0xda, 0xff, 0xe4, 0xde, 0xda, 0xff, 0xe4, 0xde, 0xd9, 0xff, 0xe6, 0xdc, 0xd9, 0xff, 0xe5, 0xdc, 0xd9, 0xff, 0xe4, 0xdc, 0xd8, 0xff, 0xe3, 0xdc, 0xda, 0xff, 0xe3, 0xdd, 0xdd, 0xff, 0xe3, 0xde, 0xde, 0xff, 0xe3, 0xde, 0xde, 0xff, 0xe4, 0xdf, 0xde, 0xff, 0xe4, 0xdf, 0xde, 0xff, 0xe6, 0xe1, 0xe0, 0xff, 0xe6, 0xe0, 0xe1, 0xff, 0xe9, 0xe3, 0xe4, 0xff, 0xec, 0xe8, 0xe9, 0xff, 0xf2, 0xed, 0xed, 0xff, 0xf6, 0xf2, 0xf2, 0xff, 0xf6, 0xf4, 0xf5, 0xff, 0xf5, 0xf5, 0xfb, 0xff, 0xfa, 0xf9, 0xfd, 0xff, 0xff, 0xfa, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xd8, 0xe1, 0xff, 0x7e, 0x90, 0xb4, 0xff, 0x85, 0x96, 0xc5, 0xff, 0x85, 0x97, 0xc4, 0xff, 0x84, 0x97, 0xc3, 0xff, 0x86, 0x97, 0xc5, 0xff, 0x87, 0x99, 0xc6, 0xff, 0x85, 0x98, 0xc3, 0xff, 0x83, 0x95, 0xc1, 0xff, 0x84, 0x97, 0xc4, 0xff, 0x85, 0x99, 0xc6, 0xff, 0x86, 0x99, 0xc5, 0xff, 0x86, 0x98, 0xc3, 0xff, 0x89, 0x9b, 0xc5, 0xff, 0x8c, 0x9f, 0xc7, 0xff, 0x8d, 0xa0, 0xc6, 0xff, 0x8d, 0xa0, 0xc5, 0xff, 0x8d, 0x9f, 0xc4, 0xff, 0x8d, 0x9f, 0xc4, 0xff, 0x8d, 0xa0, 0xc6, 0xff, 0x8c, 0x9f, 0xc4, 0xff, 0x8c, 0x9f, 0xc5, 0xff, 0x8e, 0xa1, 0xc6, 0xff, 0x8e, 0xa0, 0xc5, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x91, 0xa3, 0xc8, 0xff, 0x93, 0xa5, 0xca, 0xff, 0x92, 0xa4, 0xc9, 0xff, 0x92, 0xa3, 0xc8, 0xff, 0x91, 0xa2, 0xc7, 0xff, 0x94, 0xa6, 0xcb, 0xff, 0x9a, 0xaa, 0xcf, 0xff, 0x9d, 0xad, 0xd2, 0xff, 0x9e, 0xae, 0xd3, 0xff, 0xa1, 0xb1, 0xd7, 0xff, 0xa7, 0xb6, 0xdc, 0xff, 0xb7, 0xc6, 0xec, 0xff, 0xc4, 0xd8, 0xfc, 0xff, 0xd3, 0xe8, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0x83, 0x8b, 0x8f, 0xff, 0x43, 0x45, 0x4a, 0xff, 0x5f, 0x5f, 0x65, 0xff, 0x59, 0x58, 0x5e, 0xff, 0x4f, 0x4f, 0x5a, 0xff, 0x48, 0x48, 0x53, 0xff, 0x50, 0x52, 0x5c, 0xff, 0x5c, 0x6a, 0x70, 0xff, 0x69, 0x7c, 0x80, 0xff, 0x7c, 0x8a, 0x92, 0xff, 0x80, 0x87, 0x92, 0xff, 0xa5, 0xa1, 0xae, 0xff, 0xdd, 0xd0, 0xdf, 0xff, 0xea, 0xde, 0xec, 0xff, 0xf0, 0xeb, 0xf6, 0xff, 0xed, 0xe8, 0xf6, 0xff, 0xec, 0xe8, 0xf7, 0xff, 0xe3, 0xde, 0xec, 0xff, 0xd5, 0xce, 0xd9, 0xff, 0xca, 0xc2, 0xca, 0xff, 0xb2, 0xaa, 0xb0, 0xff, 0xb2, 0xaa, 0xb0, 0xff, 0xbd, 0xb2, 0xbb, 0xff, 0xd0, 0xc4, 0xd0, 0xff, 0xdc, 0xd0, 0xdf, 0xff, 0xdd, 0xd3, 0xe7, 0xff, 0xe0, 0xd8, 0xee, 0xff, 0xe5, 0xdb, 0xee, 0xff, 0xe7, 0xdd, 0xef, 0xff, 0xe7, 0xdd, 0xed, 0xff, 0xce, 0xc6, 0xd6, 0xff, 0xbf, 0xbc, 0xc8, 0xff, 0xa9, 0xaa, 0xb2, 0xff, 0xa1, 0xa5, 0xab, 0xff, 0xb6, 0xb7, 0xbf, 0xff, 0xcf, 0xc9, 0xd5, 0xff, 0xdd, 0xd3, 0xe1, 0xff, 0xdf, 0xd7, 0xe7, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xdd, 0xd7, 0xcd, 0xe7, 0xdd, 0xd6, 0xff, 0xe8, 0xdd, 0xd7, 0xff, 0xe7, 0xdd, 0xd6, 0xff, 0xe7, 0xdd, 0xd6, 0xff, 0xe4, 0xdd, 0xd6, 0xff, 0xe4, 0xde, 0xd8, 0xff, 0xe3, 0xde, 0xd7, 0xff, 0xe4, 0xdd, 0xd5, 0xff, 0xe5, 0xdd, 0xd5, 0xff, 0xe5, 0xdc, 0xd7, 0xff, 0xe6, 0xdc, 0xd9, 0xff, 0xe6, 0xdc, 0xd9, 0xff, 0xe6, 0xdc, 0xda, 0xff, 0xe7, 0xde, 0xdb, 0xff, 0xe5, 0xde, 0xdb, 0xff, 0xe4, 0xdd, 0xda, 0xff, 0xe4, 0xdd, 0xda, 0xff, 0xe4, 0xdd, 0xda, 0xff, 0xe4, 0xdd, 0xda, 0xff, 0xe3, 0xdc, 0xd9, 0xff, 0xe3, 0xdb, 0xda, 0xff, 0xe4, 0xdb, 0xdd, 0xff, 0xe4, 0xde, 0xde, 0xff, 0xe4, 0xe0, 0xdf, 0xff, 0xe5, 0xe1, 0xe0, 0xff, 0xe4, 0xe1, 0xdf, 0xff, 0xe6, 0xe2, 0xe1, 0xff, 0xea, 0xe1, 0xe1, 0xff, 0xeb, 0xe2, 0xe2, 0xff, 0xec, 0xe7, 0xe5, 0xff, 0xf1, 0xea, 0xec, 0xff, 0xf6, 0xef, 0xf3, 0xff, 0xf9, 0xf3, 0xf6, 0xff, 0xfb, 0xf7, 0xf9, 0xff, 0xfc, 0xfa, 0xfb, 0xff, 0xfd, 0xfb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xe8, 0xee, 0xff, 0x86, 0x9b, 0xb9, 0xff, 0x84, 0x97, 0xc3, 0xff, 0x89, 0x9a, 0xc4, 0xff, 0x87, 0x98, 0xc3, 0xff, 0x87, 0x97, 0xc5, 0xff, 0x89, 0x98, 0xc8, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x87, 0x99, 0xc0, 0xff, 0x85, 0x96, 0xc0, 0xff, 0x85, 0x96, 0xc0, 0xff, 0x86, 0x97, 0xc2, 0xff, 0x88, 0x99, 0xc4, 0xff, 0x8c, 0x9d, 0xc8, 0xff, 0x8b, 0x9e, 0xc6, 0xff, 0x8c, 0x9f, 0xc4, 0xff, 0x8d, 0x9f, 0xc4, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x91, 0xa2, 0xc7, 0xff, 0x8e, 0xa0, 0xc5, 0xff, 0x8e, 0xa0, 0xc5, 0xff, 0x8e, 0xa0, 0xc5, 0xff, 0x8e, 0xa0, 0xc4, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x8e, 0xa0, 0xc5, 0xff, 0x8e, 0xa0, 0xc5, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x91, 0xa3, 0xc8, 0xff, 0x92, 0xa3, 0xc8, 0xff, 0x94, 0xa4, 0xc9, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x96, 0xa6, 0xcb, 0xff, 0x99, 0xa9, 0xce, 0xff, 0x9c, 0xac, 0xd1, 0xff, 0x9f, 0xaf, 0xd4, 0xff, 0xa2, 0xb2, 0xd6, 0xff, 0xa7, 0xb8, 0xdf, 0xff, 0xb8, 0xcb, 0xf0, 0xff, 0xc7, 0xdd, 0xf9, 0xff, 0xd1, 0xe7, 0xfb, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xbc, 0xc6, 0xcd, 0xff, 0x45, 0x49, 0x52, 0xff, 0x44, 0x45, 0x4c, 0xff, 0x47, 0x43, 0x49, 0xff, 0x45, 0x42, 0x48, 0xff, 0x3a, 0x3c, 0x40, 0xff, 0x34, 0x38, 0x3a, 0xff, 0x61, 0x6a, 0x69, 0xff, 0x8e, 0x98, 0x99, 0xff, 0x99, 0xa2, 0xaa, 0xff, 0x96, 0x9b, 0xa9, 0xff, 0xb4, 0xaf, 0xbf, 0xff, 0xdf, 0xd4, 0xe2, 0xff, 0xeb, 0xe2, 0xed, 0xff, 0xf3, 0xea, 0xf4, 0xff, 0xf0, 0xe8, 0xf2, 0xff, 0xed, 0xe5, 0xef, 0xff, 0xe4, 0xdb, 0xe6, 0xff, 0xd4, 0xcc, 0xd3, 0xff, 0xaf, 0xa9, 0xaa, 0xff, 0x73, 0x6c, 0x68, 0xff, 0x5d, 0x54, 0x51, 0xff, 0x90, 0x85, 0x8a, 0xff, 0xb2, 0xa6, 0xb0, 0xff, 0xc1, 0xb6, 0xc2, 0xff, 0xce, 0xc3, 0xd5, 0xff, 0xd9, 0xce, 0xe4, 0xff, 0xe0, 0xd7, 0xea, 0xff, 0xdc, 0xd2, 0xe2, 0xff, 0xd4, 0xcb, 0xd8, 0xff, 0xb5, 0xb2, 0xbc, 0xff, 0x8f, 0x93, 0x97, 0xff, 0x85, 0x8c, 0x8f, 0xff, 0x98, 0x9e, 0xa5, 0xff, 0xbc, 0xbe, 0xc8, 0xff, 0xd1, 0xcf, 0xdc, 0xff, 0xde, 0xd8, 0xe8, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xdf, 0xd6, 0x51, 0xe8, 0xde, 0xd7, 0xff, 0xe6, 0xdd, 0xd6, 0xff, 0xe8, 0xde, 0xd7, 0xff, 0xe9, 0xdf, 0xd8, 0xff, 0xe5, 0xdf, 0xd8, 0xff, 0xe3, 0xdd, 0xd6, 0xff, 0xe3, 0xdd, 0xd6, 0xff, 0xe3, 0xdd, 0xd6, 0xff, 0xe4, 0xdd, 0xd5, 0xff, 0xe4, 0xdd, 0xd8, 0xff, 0xe5, 0xde, 0xd9, 0xff, 0xe5, 0xde, 0xd9, 0xff, 0xe5, 0xde, 0xda, 0xff, 0xe4, 0xdc, 0xda, 0xff, 0xe5, 0xde, 0xdb, 0xff, 0xe5, 0xdd, 0xda, 0xff, 0xe5, 0xdd, 0xda, 0xff, 0xe5, 0xdd, 0xda, 0xff, 0xe6, 0xdd, 0xda, 0xff, 0xe5, 0xdc, 0xd9, 0xff, 0xe4, 0xdb, 0xd9, 0xff, 0xe4, 0xdb, 0xdb, 0xff, 0xe4, 0xde, 0xdc, 0xff, 0xe4, 0xe0, 0xde, 0xff, 0xe7, 0xe2, 0xe1, 0xff, 0xe5, 0xe1, 0xe0, 0xff, 0xe7, 0xe2, 0xe1, 0xff, 0xeb, 0xe2, 0xe2, 0xff, 0xeb, 0xe3, 0xe3, 0xff, 0xeb, 0xe6, 0xe5, 0xff, 0xee, 0xe8, 0xea, 0xff, 0xf4, 0xee, 0xf0, 0xff, 0xf8, 0xf3, 0xf4, 0xff, 0xfa, 0xf6, 0xf8, 0xff, 0xfd, 0xfb, 0xfb, 0xff, 0xfd, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf6, 0xfa, 0xff, 0x98, 0xa6, 0xc2, 0xff, 0x82, 0x95, 0xbe, 0xff, 0x88, 0x9a, 0xc4, 0xff, 0x86, 0x97, 0xc3, 0xff, 0x87, 0x97, 0xc5, 0xff, 0x88, 0x98, 0xc7, 0xff, 0x88, 0x9a, 0xc3, 0xff, 0x88, 0x9b, 0xc2, 0xff, 0x87, 0x98, 0xc4, 0xff, 0x87, 0x98, 0xc3, 0xff, 0x87, 0x98, 0xc3, 0xff, 0x88, 0x99, 0xc5, 0xff, 0x8a, 0x9b, 0xc6, 0xff, 0x89, 0x9b, 0xc3, 0xff, 0x8b, 0x9e, 0xc4, 0xff, 0x8d, 0x9f, 0xc4, 0xff, 0x8e, 0xa0, 0xc5, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x8d, 0x9f, 0xc4, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x8e, 0xa0, 0xc5, 0xff, 0x8c, 0x9e, 0xc3, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x91, 0xa2, 0xc7, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x98, 0xa7, 0xcc, 0xff, 0x99, 0xa9, 0xce, 0xff, 0x9c, 0xac, 0xd1, 0xff, 0x9e, 0xae, 0xd3, 0xff, 0xa3, 0xb3, 0xd8, 0xff, 0xac, 0xbc, 0xe3, 0xff, 0xb9, 0xcc, 0xf0, 0xff, 0xc7, 0xde, 0xfa, 0xff, 0xd7, 0xea, 0xfe, 0xff, 0xea, 0xf9, 0xff, 0xff, 0xf3, 0xfc, 0xfe, 0xff, 0xa4, 0xa6, 0xb1, 0xff, 0x75, 0x75, 0x7f, 0xff, 0x67, 0x62, 0x6a, 0xff, 0x4c, 0x47, 0x49, 0xff, 0x26, 0x22, 0x22, 0xff, 0x50, 0x4d, 0x4a, 0xff, 0x9c, 0x9a, 0x9c, 0xff, 0xb5, 0xb4, 0xbb, 0xff, 0xc0, 0xbd, 0xc6, 0xff, 0xbb, 0xb8, 0xc5, 0xff, 0xcc, 0xc4, 0xd2, 0xff, 0xe5, 0xd8, 0xe5, 0xff, 0xef, 0xe4, 0xef, 0xff, 0xec, 0xe4, 0xee, 0xff, 0xe8, 0xe0, 0xea, 0xff, 0xe5, 0xdd, 0xe8, 0xff, 0xdb, 0xd3, 0xdf, 0xff, 0xc7, 0xc0, 0xc8, 0xff, 0xac, 0xa7, 0xa9, 0xff, 0x74, 0x6d, 0x6b, 0xff, 0x2a, 0x1f, 0x1e, 0xff, 0x35, 0x29, 0x2b, 0xff, 0x70, 0x64, 0x69, 0xff, 0x9c, 0x92, 0x9b, 0xff, 0xb1, 0xa8, 0xb4, 0xff, 0xc8, 0xc2, 0xcf, 0xff, 0xd4, 0xd0, 0xdd, 0xff, 0xc2, 0xc0, 0xca, 0xff, 0xaf, 0xae, 0xb5, 0xff, 0x7f, 0x83, 0x88, 0xff, 0x4d, 0x56, 0x56, 0xff, 0x64, 0x70, 0x72, 0xff, 0x92, 0x9c, 0xa4, 0xff, 0xb9, 0xbe, 0xc9, 0xff, 0xc4, 0xc4, 0xd2, 0xff, 0xd6, 0xd2, 0xe2, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xe7, 0xdd, 0xd7, 0xce, 0xea, 0xe0, 0xd9, 0xff, 0xea, 0xe0, 0xd9, 0xff, 0xea, 0xdf, 0xd9, 0xff, 0xe6, 0xe0, 0xd8, 0xff, 0xe3, 0xdd, 0xd6, 0xff, 0xe2, 0xdc, 0xd5, 0xff, 0xe3, 0xdd, 0xd5, 0xff, 0xe2, 0xdc, 0xd4, 0xff, 0xe2, 0xdc, 0xd6, 0xff, 0xe3, 0xde, 0xd9, 0xff, 0xe7, 0xe2, 0xdc, 0xff, 0xe6, 0xe1, 0xdd, 0xff, 0xe4, 0xdd, 0xda, 0xff, 0xe7, 0xdd, 0xda, 0xff, 0xe6, 0xdd, 0xda, 0xff, 0xe6, 0xdd, 0xda, 0xff, 0xe6, 0xdd, 0xda, 0xff, 0xe6, 0xdd, 0xda, 0xff, 0xe5, 0xdc, 0xd9, 0xff, 0xe4, 0xdb, 0xd8, 0xff, 0xe4, 0xdd, 0xda, 0xff, 0xe4, 0xde, 0xdb, 0xff, 0xe4, 0xdf, 0xdd, 0xff, 0xe5, 0xe0, 0xdf, 0xff, 0xe5, 0xe1, 0xdf, 0xff, 0xe7, 0xe2, 0xe0, 0xff, 0xea, 0xe1, 0xe1, 0xff, 0xea, 0xe2, 0xe2, 0xff, 0xed, 0xe7, 0xe6, 0xff, 0xee, 0xe9, 0xea, 0xff, 0xf4, 0xee, 0xef, 0xff, 0xf9, 0xf4, 0xf5, 0xff, 0xfb, 0xf7, 0xf9, 0xff, 0xfc, 0xfa, 0xfb, 0xff, 0xfe, 0xfc, 0xfc, 0xff, 0xff, 0xfd, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xb3, 0xcd, 0xff, 0x7e, 0x91, 0xb7, 0xff, 0x87, 0x99, 0xc3, 0xff, 0x87, 0x97, 0xc3, 0xff, 0x87, 0x96, 0xc5, 0xff, 0x86, 0x96, 0xc5, 0xff, 0x87, 0x99, 0xc1, 0xff, 0x87, 0x9a, 0xc1, 0xff, 0x87, 0x98, 0xc3, 0xff, 0x86, 0x97, 0xc2, 0xff, 0x86, 0x97, 0xc2, 0xff, 0x86, 0x97, 0xc2, 0xff, 0x87, 0x98, 0xc2, 0xff, 0x88, 0x9a, 0xc2, 0xff, 0x8d, 0xa0, 0xc5, 0xff, 0x8e, 0xa0, 0xc5, 0xff, 0x8e, 0xa0, 0xc5, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x8e, 0xa0, 0xc5, 0xff, 0x8e, 0xa0, 0xc5, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x91, 0xa3, 0xc8, 0xff, 0x91, 0xa3, 0xc8, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x91, 0xa3, 0xc8, 0xff, 0x91, 0xa3, 0xc8, 0xff, 0x92, 0xa4, 0xc9, 0xff, 0x94, 0xa4, 0xc9, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x96, 0xa6, 0xcb, 0xff, 0x99, 0xa9, 0xce, 0xff, 0x9c, 0xac, 0xd1, 0xff, 0x9f, 0xaf, 0xd3, 0xff, 0xa1, 0xb1, 0xd6, 0xff, 0xab, 0xbc, 0xe4, 0xff, 0xbc, 0xcf, 0xf4, 0xff, 0xca, 0xdf, 0xfb, 0xff, 0xd8, 0xea, 0xfc, 0xff, 0xe7, 0xf6, 0xfd, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xe1, 0xe2, 0xe9, 0xff, 0xb4, 0xb4, 0xc0, 0xff, 0xa6, 0xa0, 0xab, 0xff, 0x73, 0x6b, 0x71, 0xff, 0x45, 0x3b, 0x3e, 0xff, 0x88, 0x7c, 0x7d, 0xff, 0xc7, 0xb9, 0xbf, 0xff, 0xda, 0xcc, 0xd7, 0xff, 0xe1, 0xd3, 0xde, 0xff, 0xd6, 0xc9, 0xd5, 0xff, 0xd7, 0xca, 0xd7, 0xff, 0xe9, 0xd9, 0xe5, 0xff, 0xed, 0xe2, 0xec, 0xff, 0xe8, 0xe1, 0xeb, 0xff, 0xe0, 0xd8, 0xe2, 0xff, 0xe0, 0xd8, 0xe3, 0xff, 0xdb, 0xd3, 0xdf, 0xff, 0xcc, 0xc5, 0xcd, 0xff, 0xbf, 0xba, 0xbc, 0xff, 0xa5, 0x9b, 0x9c, 0xff, 0x50, 0x43, 0x43, 0xff, 0x1d, 0x11, 0x10, 0xff, 0x35, 0x29, 0x2c, 0xff, 0x71, 0x69, 0x6f, 0xff, 0x80, 0x7a, 0x7f, 0xff, 0x87, 0x82, 0x89, 0xff, 0xa1, 0x9c, 0xa4, 0xff, 0xa1, 0x9d, 0xa2, 0xff, 0x98, 0x95, 0x97, 0xff, 0x7e, 0x7f, 0x81, 0xff, 0x4d, 0x53, 0x52, 0xff, 0x5b, 0x63, 0x65, 0xff, 0x85, 0x8f, 0x97, 0xff, 0xae, 0xb6, 0xc1, 0xff, 0xc1, 0xc3, 0xd3, 0xce, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xde, 0xda, 0x46, 0xec, 0xe0, 0xda, 0xff, 0xeb, 0xdf, 0xd9, 0xff, 0xea, 0xde, 0xd8, 0xff, 0xe6, 0xdd, 0xd7, 0xff, 0xe3, 0xdb, 0xd4, 0xff, 0xe2, 0xd9, 0xd3, 0xff, 0xe2, 0xdb, 0xd3, 0xff, 0xe1, 0xdc, 0xd3, 0xff, 0xe1, 0xdb, 0xd5, 0xff, 0xe5, 0xdf, 0xdb, 0xff, 0xe8, 0xe2, 0xdd, 0xff, 0xe6, 0xe0, 0xdc, 0xff, 0xe6, 0xdf, 0xdc, 0xff, 0xe7, 0xdf, 0xdb, 0xff, 0xe6, 0xdd, 0xda, 0xff, 0xe5, 0xdd, 0xda, 0xff, 0xe5, 0xdc, 0xd9, 0xff, 0xe4, 0xdc, 0xd9, 0xff, 0xe3, 0xdc, 0xd9, 0xff, 0xe2, 0xdc, 0xd9, 0xff, 0xe3, 0xdd, 0xdb, 0xff, 0xe5, 0xde, 0xdb, 0xff, 0xe6, 0xde, 0xdb, 0xff, 0xe8, 0xe0, 0xde, 0xff, 0xea, 0xe3, 0xe0, 0xff, 0xeb, 0xe3, 0xe0, 0xff, 0xec, 0xe3, 0xe0, 0xff, 0xed, 0xe4, 0xe1, 0xff, 0xef, 0xe6, 0xe3, 0xff, 0xf2, 0xe9, 0xe9, 0xff, 0xf8, 0xf1, 0xf1, 0xff, 0xfc, 0xf3, 0xf4, 0xff, 0xfd, 0xf6, 0xf7, 0xff, 0xfc, 0xf9, 0xfe, 0xff, 0xfd, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xc2, 0xd4, 0xff, 0x7e, 0x90, 0xb3, 0xff, 0x86, 0x99, 0xc2, 0xff, 0x85, 0x96, 0xc1, 0xff, 0x85, 0x96, 0xc2, 0xff, 0x85, 0x96, 0xc1, 0xff, 0x86, 0x99, 0xc0, 0xff, 0x86, 0x99, 0xbe, 0xff, 0x87, 0x98, 0xc0, 0xff, 0x89, 0x98, 0xc3, 0xff, 0x88, 0x98, 0xc3, 0xff, 0x88, 0x98, 0xc1, 0xff, 0x89, 0x9a, 0xc1, 0xff, 0x8a, 0x9c, 0xc1, 0xff, 0x8b, 0x9d, 0xc2, 0xff, 0x8d, 0x9f, 0xc4, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x93, 0xa5, 0xca, 0xff, 0x91, 0xa3, 0xc8, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x91, 0xa3, 0xc8, 0xff, 0x92, 0xa4, 0xc9, 0xff, 0x92, 0xa4, 0xc9, 0xff, 0x94, 0xa4, 0xc9, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x96, 0xa6, 0xcb, 0xff, 0x99, 0xa9, 0xce, 0xff, 0x9a, 0xaa, 0xcf, 0xff, 0x9c, 0xac, 0xd1, 0xff, 0xa2, 0xb1, 0xd7, 0xff, 0xab, 0xbe, 0xe6, 0xff, 0xbf, 0xd5, 0xf8, 0xff, 0xce, 0xe2, 0xfc, 0xff, 0xd9, 0xee, 0xfb, 0xff, 0xe7, 0xf6, 0xfd, 0xff, 0xf4, 0xfd, 0xff, 0xff, 0xf8, 0xfc, 0xff, 0xff, 0xcb, 0xcc, 0xd5, 0xff, 0xb5, 0xb1, 0xbd, 0xff, 0x9c, 0x94, 0x9e, 0xff, 0x8f, 0x81, 0x89, 0xff, 0xa0, 0x91, 0x94, 0xff, 0xca, 0xbc, 0xc2, 0xff, 0xe8, 0xd7, 0xe1, 0xff, 0xe3, 0xd4, 0xdc, 0xff, 0xd5, 0xc4, 0xce, 0xff, 0xdb, 0xca, 0xd6, 0xff, 0xe0, 0xd4, 0xe0, 0xff, 0xdf, 0xd5, 0xe1, 0xff, 0xdb, 0xd4, 0xde, 0xff, 0xd7, 0xcf, 0xdb, 0xff, 0xde, 0xd5, 0xe2, 0xff, 0xe1, 0xd8, 0xe4, 0xff, 0xd6, 0xd0, 0xd9, 0xff, 0xc4, 0xbc, 0xc2, 0xff, 0xab, 0x9d, 0xa0, 0xff, 0x75, 0x66, 0x67, 0xff, 0x5e, 0x51, 0x53, 0xff, 0x76, 0x6a, 0x6f, 0xff, 0x81, 0x78, 0x7f, 0xff, 0x79, 0x75, 0x7d, 0xff, 0x7c, 0x75, 0x7e, 0xff, 0xa0, 0x97, 0x9c, 0xff, 0xaa, 0xa0, 0xa7, 0xff, 0x9f, 0x94, 0x9d, 0xff, 0x98, 0x8f, 0x96, 0xff, 0x7c, 0x7b, 0x7c, 0xff, 0x6e, 0x72, 0x74, 0xff, 0x7d, 0x83, 0x8b, 0xff, 0xa2, 0xa7, 0xb3, 0xff, 0xbe, 0xc1, 0xd0, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xe2, 0xdd, 0xb4, 0xee, 0xe2, 0xdc, 0xff, 0xee, 0xe2, 0xdc, 0xff, 0xeb, 0xe1, 0xda, 0xff, 0xe7, 0xdf, 0xd7, 0xff, 0xe6, 0xdd, 0xd6, 0xff, 0xe6, 0xde, 0xd6, 0xff, 0xe6, 0xde, 0xd6, 0xff, 0xe8, 0xdf, 0xd9, 0xff, 0xec, 0xe2, 0xdf, 0xff, 0xed, 0xe3, 0xdf, 0xff, 0xec, 0xe1, 0xde, 0xff, 0xeb, 0xe0, 0xde, 0xff, 0xe9, 0xde, 0xdc, 0xff, 0xe7, 0xdd, 0xdb, 0xff, 0xe9, 0xdf, 0xdc, 0xff, 0xe8, 0xdd, 0xdb, 0xff, 0xe7, 0xdd, 0xdb, 0xff, 0xe6, 0xde, 0xdb, 0xff, 0xe3, 0xde, 0xda, 0xff, 0xe3, 0xde, 0xda, 0xff, 0xe6, 0xdf, 0xdb, 0xff, 0xea, 0xe2, 0xde, 0xff, 0xed, 0xe4, 0xe0, 0xff, 0xed, 0xe4, 0xe0, 0xff, 0xec, 0xe3, 0xdf, 0xff, 0xeb, 0xe2, 0xe0, 0xff, 0xed, 0xe4, 0xe1, 0xff, 0xf0, 0xe6, 0xe3, 0xff, 0xf2, 0xe9, 0xe9, 0xff, 0xf7, 0xef, 0xf0, 0xff, 0xfb, 0xf3, 0xf4, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfc, 0xf9, 0xfe, 0xff, 0xfc, 0xfa, 0xfd, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xd5, 0xe1, 0xff, 0x87, 0x95, 0xb4, 0xff, 0x85, 0x99, 0xc1, 0xff, 0x82, 0x93, 0xbd, 0xff, 0x86, 0x97, 0xc2, 0xff, 0x87, 0x98, 0xc2, 0xff, 0x86, 0x98, 0xc0, 0xff, 0x87, 0x9a, 0xbf, 0xff, 0x88, 0x99, 0xc1, 0xff, 0x89, 0x98, 0xc3, 0xff, 0x8a, 0x9a, 0xc4, 0xff, 0x8a, 0x9a, 0xc3, 0xff, 0x8a, 0x9b, 0xc2, 0xff, 0x8a, 0x9c, 0xc1, 0xff, 0x8a, 0x9c, 0xc1, 0xff, 0x8b, 0x9d, 0xc2, 0xff, 0x8e, 0xa0, 0xc5, 0xff, 0x91, 0xa3, 0xc8, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x90, 0xa3, 0xc8, 0xff, 0x90, 0xa3, 0xc8, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x8c, 0x9e, 0xc3, 0xff, 0x8e, 0xa0, 0xc5, 0xff, 0x92, 0xa4, 0xc9, 0xff, 0x94, 0xa4, 0xc9, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x96, 0xa6, 0xcb, 0xff, 0x99, 0xa9, 0xce, 0xff, 0x9a, 0xaa, 0xcf, 0xff, 0x9d, 0xad, 0xd1, 0xff, 0xa4, 0xb4, 0xda, 0xff, 0xb1, 0xc5, 0xec, 0xff, 0xc2, 0xd8, 0xfc, 0xff, 0xce, 0xe1, 0xfc, 0xff, 0xd8, 0xec, 0xfa, 0xff, 0xe8, 0xf6, 0xfa, 0xff, 0xf2, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xea, 0xef, 0xff, 0xba, 0xba, 0xc6, 0xff, 0xb2, 0xac, 0xba, 0xff, 0xbc, 0xaf, 0xba, 0xff, 0xc3, 0xb7, 0xbe, 0xff, 0xcf, 0xc5, 0xcc, 0xff, 0xde, 0xd2, 0xdb, 0xff, 0xd0, 0xc4, 0xcb, 0xff, 0xc3, 0xb7, 0xbd, 0xff, 0xce, 0xc0, 0xc9, 0xff, 0xca, 0xbf, 0xc9, 0xff, 0xcd, 0xc5, 0xd0, 0xff, 0xcc, 0xc5, 0xcf, 0xff, 0xcd, 0xc5, 0xd1, 0xff, 0xdf, 0xd5, 0xe3, 0xff, 0xe5, 0xdc, 0xe8, 0xff, 0xd3, 0xce, 0xd7, 0xff, 0xbf, 0xb6, 0xbd, 0xff, 0xb0, 0xa4, 0xa7, 0xff, 0x97, 0x8b, 0x8e, 0xff, 0xa1, 0x95, 0x9e, 0xff, 0xbc, 0xb0, 0xbd, 0xff, 0xb1, 0xa9, 0xb7, 0xff, 0xb2, 0xaf, 0xbf, 0xff, 0xb8, 0xb3, 0xc4, 0xff, 0xbc, 0xb3, 0xc1, 0xff, 0xc1, 0xb8, 0xc5, 0xff, 0xbc, 0xb3, 0xc0, 0xff, 0xa7, 0xa1, 0xab, 0xff, 0x95, 0x94, 0x99, 0xff, 0x87, 0x89, 0x8f, 0xff, 0x82, 0x85, 0x8f, 0xff, 0x90, 0x93, 0xa1, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xe4, 0xde, 0x27, 0xf1, 0xe5, 0xe0, 0xfa, 0xf1, 0xe5, 0xe0, 0xff, 0xf1, 0xe6, 0xe0, 0xff, 0xee, 0xe5, 0xde, 0xff, 0xed, 0xe3, 0xdc, 0xff, 0xef, 0xe4, 0xdc, 0xff, 0xef, 0xe3, 0xdc, 0xff, 0xf0, 0xe3, 0xde, 0xff, 0xf3, 0xe6, 0xe3, 0xff, 0xf2, 0xe6, 0xe2, 0xff, 0xf1, 0xe4, 0xe1, 0xff, 0xf0, 0xe3, 0xe2, 0xff, 0xee, 0xe2, 0xe0, 0xff, 0xec, 0xe0, 0xde, 0xff, 0xed, 0xe1, 0xdf, 0xff, 0xeb, 0xdd, 0xdc, 0xff, 0xea, 0xdd, 0xdc, 0xff, 0xe9, 0xdf, 0xdc, 0xff, 0xe4, 0xe0, 0xdb, 0xff, 0xe2, 0xdf, 0xd8, 0xff, 0xe6, 0xe1, 0xdc, 0xff, 0xec, 0xe5, 0xe0, 0xff, 0xef, 0xe5, 0xe1, 0xff, 0xef, 0xe5, 0xe1, 0xff, 0xee, 0xe4, 0xe0, 0xff, 0xed, 0xe4, 0xe1, 0xff, 0xef, 0xe6, 0xe3, 0xff, 0xf1, 0xe8, 0xe5, 0xff, 0xf4, 0xeb, 0xea, 0xff, 0xf8, 0xef, 0xf0, 0xff, 0xfd, 0xf4, 0xf5, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfb, 0xf9, 0xfe, 0xff, 0xfc, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xe9, 0xef, 0xff, 0x96, 0xa0, 0xbc, 0xff, 0x84, 0x98, 0xbf, 0xff, 0x82, 0x96, 0xbd, 0xff, 0x84, 0x97, 0xbf, 0xff, 0x86, 0x98, 0xc2, 0xff, 0x84, 0x97, 0xbe, 0xff, 0x85, 0x99, 0xbd, 0xff, 0x88, 0x98, 0xc1, 0xff, 0x88, 0x96, 0xc2, 0xff, 0x89, 0x98, 0xc3, 0xff, 0x8b, 0x9b, 0xc5, 0xff, 0x8b, 0x9c, 0xc2, 0xff, 0x8a, 0x9b, 0xc1, 0xff, 0x89, 0x9b, 0xbf, 0xff, 0x89, 0x9c, 0xc0, 0xff, 0x8d, 0x9f, 0xc4, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x91, 0xa3, 0xc8, 0xff, 0x91, 0xa3, 0xc8, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x8f, 0xa1, 0xc6, 0xff, 0x8e, 0xa0, 0xc5, 0xff, 0x8e, 0xa0, 0xc5, 0xff, 0x8d, 0x9f, 0xc4, 0xff, 0x8e, 0xa1, 0xc6, 0xff, 0x90, 0xa2, 0xc7, 0xff, 0x94, 0xa3, 0xc8, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x95, 0xa5, 0xca, 0xff, 0x99, 0xa9, 0xce, 0xff, 0x9b, 0xab, 0xd0, 0xff, 0x9e, 0xae, 0xd2, 0xff, 0xa7, 0xb7, 0xdd, 0xff, 0xb3, 0xc7, 0xee, 0xff, 0xc1, 0xd7, 0xfb, 0xff, 0xcd, 0xdf, 0xfc, 0xff, 0xdd, 0xed, 0xfc, 0xff, 0xeb, 0xf8, 0xfa, 0xff, 0xf4, 0xfc, 0xf9, 0xff, 0xf8, 0xfe, 0xfc, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xd5, 0xd9, 0xe5, 0xff, 0xbf, 0xbd, 0xcf, 0xff, 0xd8, 0xcc, 0xdd, 0xff, 0xe3, 0xd7, 0xe3, 0xff, 0xce, 0xc9, 0xd2, 0xff, 0xc4, 0xbe, 0xc8, 0xff, 0xb4, 0xa9, 0xaf, 0xff, 0xa5, 0x98, 0x9c, 0xff, 0xaf, 0xa4, 0xab, 0xff, 0xb0, 0xa9, 0xb0, 0xff, 0xb2, 0xac, 0xb5, 0xff, 0xb6, 0xaf, 0xba, 0xff, 0xc8, 0xc0, 0xcd, 0xff, 0xdc, 0xd2, 0xe0, 0xff, 0xdd, 0xd4, 0xe0, 0xff, 0xc6, 0xc2, 0xcb, 0xff, 0xb9, 0xb0, 0xb7, 0xff, 0xac, 0xa2, 0xa4, 0xff, 0xa6, 0x9e, 0xa2, 0xff, 0xc5, 0xba, 0xc8, 0xff, 0xc6, 0xba, 0xce, 0xff, 0xc2, 0xbd, 0xd2, 0xff, 0xcd, 0xcd, 0xe3, 0xff, 0xc7, 0xc5, 0xde, 0xff, 0xc8, 0xc6, 0xdc, 0xff, 0xd6, 0xd5, 0xe7, 0xff, 0xc8, 0xc7, 0xd6, 0xff, 0xae, 0xb3, 0xbe, 0xff, 0x9c, 0xa4, 0xaa, 0xff, 0x95, 0x9d, 0xa5, 0xff, 0x91, 0x95, 0xa2, 0xfa, 0x92, 0x92, 0x9f, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xea, 0xe2, 0x88, 0xf6, 0xe9, 0xe2, 0xff, 0xf5, 0xe8, 0xe1, 0xff, 0xf1, 0xe5, 0xdd, 0xff, 0xf1, 0xe5, 0xdd, 0xff, 0xf3, 0xe6, 0xde, 0xff, 0xf2, 0xe5, 0xde, 0xff, 0xf3, 0xe6, 0xdf, 0xff, 0xf3, 0xe6, 0xe0, 0xff, 0xf2, 0xe6, 0xdf, 0xff, 0xf1, 0xe5, 0xdf, 0xff, 0xf0, 0xe4, 0xde, 0xff, 0xf1, 0xe5, 0xe0, 0xff, 0xf1, 0xe5, 0xe0, 0xff, 0xef, 0xe3, 0xde, 0xff, 0xee, 0xe2, 0xdd, 0xff, 0xed, 0xe1, 0xdc, 0xff, 0xed, 0xe0, 0xdb, 0xff, 0xea, 0xe0, 0xdc, 0xff, 0xe8, 0xe0, 0xdd, 0xff, 0xe8, 0xe0, 0xdd, 0xff, 0xeb, 0xe1, 0xde, 0xff, 0xef, 0xe4, 0xe1, 0xff, 0xf0, 0xe5, 0xe2, 0xff, 0xef, 0xe4, 0xe1, 0xff, 0xf2, 0xe7, 0xe5, 0xff, 0xf4, 0xe9, 0xe6, 0xff, 0xf6, 0xeb, 0xe9, 0xff, 0xf7, 0xf0, 0xef, 0xff, 0xf7, 0xf4, 0xf4, 0xff, 0xfb, 0xf7, 0xfa, 0xff, 0xfd, 0xf8, 0xfd, 0xff, 0xfd, 0xf9, 0xfc, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf6, 0xf5, 0xff, 0xae, 0xb2, 0xc2, 0xff, 0x89, 0x94, 0xb9, 0xff, 0x85, 0x94, 0xbb, 0xff, 0x85, 0x96, 0xc0, 0xff, 0x83, 0x96, 0xc1, 0xff, 0x82, 0x97, 0xbc, 0xff, 0x84, 0x97, 0xbc, 0xff, 0x85, 0x98, 0xbf, 0xff, 0x85, 0x97, 0xbe, 0xff, 0x89, 0x99, 0xc1, 0xff, 0x8b, 0x9c, 0xc3, 0xff, 0x8b, 0x9c, 0xc3, 0xff, 0x8c, 0x9c, 0xc3, 0xff, 0x8c, 0x9b, 0xc1, 0xff, 0x8b, 0x9b, 0xc2, 0xff, 0x8c, 0x9d, 0xc3, 0xff, 0x90, 0xa1, 0xc6, 0xff, 0x92, 0xa2, 0xc7, 0xff, 0x92, 0xa3, 0xc7, 0xff, 0x91, 0xa2, 0xc6, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x92, 0xa3, 0xc8, 0xff, 0x91, 0xa1, 0xc6, 0xff, 0x90, 0xa0, 0xc5, 0xff, 0x91, 0xa2, 0xc7, 0xff, 0x92, 0xa3, 0xc8, 0xff, 0x91, 0xa1, 0xc6, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x95, 0xa5, 0xca, 0xff, 0x96, 0xa6, 0xcb, 0xff, 0x98, 0xaa, 0xce, 0xff, 0x9b, 0xac, 0xd1, 0xff, 0x9d, 0xaf, 0xd5, 0xff, 0xa8, 0xb8, 0xdf, 0xff, 0xb7, 0xca, 0xf1, 0xff, 0xc4, 0xdb, 0xfd, 0xff, 0xd1, 0xe4, 0xfd, 0xff, 0xe0, 0xf2, 0xfe, 0xff, 0xeb, 0xf7, 0xfd, 0xff, 0xf4, 0xfb, 0xfa, 0xff, 0xfa, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xfb, 0xff, 0xdc, 0xd9, 0xe7, 0xff, 0xe9, 0xe2, 0xf3, 0xff, 0xe8, 0xdd, 0xf2, 0xff, 0xc5, 0xbf, 0xd2, 0xff, 0xa9, 0xa2, 0xad, 0xff, 0x8c, 0x7b, 0x7f, 0xff, 0x77, 0x60, 0x65, 0xff, 0x82, 0x74, 0x7d, 0xff, 0x90, 0x8c, 0x93, 0xff, 0x89, 0x85, 0x8f, 0xff, 0xa4, 0x9a, 0xa7, 0xff, 0xc3, 0xba, 0xc8, 0xff, 0xd3, 0xca, 0xda, 0xff, 0xcd, 0xc2, 0xd1, 0xff, 0xba, 0xb0, 0xb9, 0xff, 0xa1, 0x97, 0x9e, 0xff, 0x9d, 0x92, 0x9c, 0xff, 0xba, 0xb2, 0xbf, 0xff, 0xc8, 0xc4, 0xd9, 0xff, 0xc3, 0xbe, 0xd7, 0xff, 0xcd, 0xcb, 0xe5, 0xff, 0xcd, 0xcf, 0xea, 0xff, 0xcc, 0xce, 0xe7, 0xff, 0xd4, 0xd7, 0xef, 0xff, 0xd3, 0xd6, 0xea, 0xff, 0xc5, 0xc7, 0xd7, 0xff, 0xb1, 0xb8, 0xc3, 0xff, 0x9b, 0xa6, 0xb0, 0xff, 0x91, 0xa0, 0xab, 0xff, 0x8d, 0x98, 0xa7, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe2, 0xe2, 0x09, 0xf8, 0xed, 0xe5, 0xdb, 0xf6, 0xeb, 0xe3, 0xff, 0xf4, 0xe8, 0xe0, 0xff, 0xf4, 0xe8, 0xe0, 0xff, 0xf4, 0xe8, 0xe0, 0xff, 0xf4, 0xe8, 0xe0, 0xff, 0xf4, 0xe9, 0xe1, 0xff, 0xf4, 0xe9, 0xe1, 0xff, 0xf4, 0xe9, 0xe0, 0xff, 0xf3, 0xe8, 0xdf, 0xff, 0xf2, 0xe7, 0xde, 0xff, 0xf1, 0xe5, 0xdf, 0xff, 0xf1, 0xe5, 0xdf, 0xff, 0xf0, 0xe4, 0xde, 0xff, 0xf0, 0xe4, 0xde, 0xff, 0xef, 0xe3, 0xdd, 0xff, 0xf0, 0xe3, 0xdd, 0xff, 0xef, 0xe3, 0xde, 0xff, 0xeb, 0xe0, 0xdd, 0xff, 0xed, 0xe1, 0xde, 0xff, 0xf0, 0xe4, 0xe1, 0xff, 0xee, 0xe3, 0xe0, 0xff, 0xf0, 0xe4, 0xe1, 0xff, 0xf4, 0xe8, 0xe5, 0xff, 0xf6, 0xea, 0xe6, 0xff, 0xf5, 0xea, 0xe8, 0xff, 0xfa, 0xf1, 0xf1, 0xff, 0xfc, 0xf6, 0xf8, 0xff, 0xf8, 0xf9, 0xfa, 0xff, 0xfb, 0xfa, 0xfe, 0xff, 0xfe, 0xfc, 0xfb, 0xff, 0xff, 0xfd, 0xfa, 0xff, 0xff, 0xf9, 0xfd, 0xff, 0xfc, 0xf7, 0xfd, 0xff, 0xfd, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xc1, 0xd1, 0xff, 0x91, 0x98, 0xbb, 0xff, 0x83, 0x90, 0xb5, 0xff, 0x80, 0x91, 0xbb, 0xff, 0x80, 0x93, 0xbe, 0xff, 0x80, 0x95, 0xba, 0xff, 0x85, 0x97, 0xbb, 0xff, 0x87, 0x99, 0xbf, 0xff, 0x86, 0x99, 0xbf, 0xff, 0x88, 0x99, 0xc0, 0xff, 0x8b, 0x9b, 0xc2, 0xff, 0x8c, 0x9e, 0xc5, 0xff, 0x8d, 0x9c, 0xc4, 0xff, 0x8c, 0x9a, 0xc2, 0xff, 0x8b, 0x9a, 0xc1, 0xff, 0x8a, 0x9a, 0xc0, 0xff, 0x8e, 0x9e, 0xc3, 0xff, 0x91, 0xa0, 0xc4, 0xff, 0x93, 0xa3, 0xc6, 0xff, 0x92, 0xa1, 0xc5, 0xff, 0x92, 0xa1, 0xc6, 0xff, 0x94, 0xa3, 0xc8, 0xff, 0x93, 0xa2, 0xc7, 0xff, 0x90, 0xa1, 0xc6, 0xff, 0x91, 0xa0, 0xc5, 0xff, 0x92, 0xa1, 0xc6, 0xff, 0x95, 0xa4, 0xc9, 0xff, 0x95, 0xa5, 0xca, 0xff, 0x96, 0xa6, 0xcb, 0xff, 0x97, 0xa6, 0xcb, 0xff, 0x96, 0xa9, 0xcc, 0xff, 0x99, 0xac, 0xd0, 0xff, 0xa0, 0xb1, 0xd8, 0xff, 0xab, 0xbb, 0xe2, 0xff, 0xba, 0xce, 0xf4, 0xff, 0xc7, 0xde, 0xff, 0xff, 0xd3, 0xe7, 0xfd, 0xff, 0xdf, 0xf0, 0xfd, 0xff, 0xea, 0xf6, 0xfe, 0xff, 0xf4, 0xfb, 0xfc, 0xff, 0xfc, 0xfd, 0xfc, 0xff, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf6, 0xfd, 0xff, 0xed, 0xe8, 0xf8, 0xff, 0xe9, 0xe0, 0xf7, 0xff, 0xd1, 0xc4, 0xdc, 0xff, 0x90, 0x86, 0x93, 0xff, 0x5c, 0x59, 0x5a, 0xff, 0x58, 0x54, 0x57, 0xff, 0x5c, 0x56, 0x5d, 0xff, 0x62, 0x5c, 0x61, 0xff, 0x78, 0x6b, 0x72, 0xff, 0xa9, 0x9b, 0xa6, 0xff, 0xc4, 0xba, 0xc5, 0xff, 0xcb, 0xc1, 0xce, 0xff, 0xc7, 0xba, 0xc6, 0xff, 0xaf, 0xa3, 0xa9, 0xff, 0x9a, 0x8e, 0x95, 0xff, 0xab, 0xa0, 0xad, 0xff, 0xc5, 0xbe, 0xd0, 0xff, 0xc6, 0xc6, 0xdd, 0xff, 0xc5, 0xc7, 0xe1, 0xff, 0xbf, 0xc3, 0xe0, 0xff, 0xbb, 0xc2, 0xe1, 0xff, 0xc2, 0xc7, 0xe1, 0xff, 0xc9, 0xcb, 0xe0, 0xff, 0xc4, 0xc3, 0xd7, 0xff, 0xc0, 0xbe, 0xd0, 0xff, 0xaf, 0xb0, 0xbf, 0xff, 0x9d, 0xa2, 0xb0, 0xff, 0x96, 0x9e, 0xab, 0xdb, 0xaa, 0xaa, 0xaa, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xef, 0xe7, 0x41, 0xf6, 0xed, 0xe4, 0xfe, 0xf7, 0xed, 0xe4, 0xff, 0xf6, 0xed, 0xe4, 0xff, 0xf5, 0xeb, 0xe2, 0xff, 0xf5, 0xeb, 0xe2, 0xff, 0xf5, 0xec, 0xe3, 0xff, 0xf6, 0xec, 0xe4, 0xff, 0xf6, 0xeb, 0xe3, 0xff, 0xf5, 0xea, 0xe2, 0xff, 0xf4, 0xe9, 0xe1, 0xff, 0xf4, 0xe8, 0xe2, 0xff, 0xf3, 0xe7, 0xe1, 0xff, 0xf2, 0xe6, 0xe0, 0xff, 0xf2, 0xe5, 0xe0, 0xff, 0xef, 0xe3, 0xdd, 0xff, 0xef, 0xe3, 0xdd, 0xff, 0xef, 0xe3, 0xdd, 0xff, 0xee, 0xe2, 0xdd, 0xff, 0xef, 0xe3, 0xdd, 0xff, 0xf0, 0xe5, 0xdf, 0xff, 0xef, 0xe4, 0xdf, 0xff, 0xf1, 0xe6, 0xe0, 0xff, 0xf6, 0xeb, 0xe5, 0xff, 0xf8, 0xec, 0xe5, 0xff, 0xf7, 0xee, 0xec, 0xff, 0xfb, 0xf5, 0xf7, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xf9, 0xfa, 0xff, 0xff, 0xf8, 0xfb, 0xfd, 0xff, 0xfd, 0xfc, 0xf9, 0xff, 0xff, 0xfe, 0xf9, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xc1, 0xd2, 0xff, 0x98, 0x9e, 0xbf, 0xff, 0x8e, 0x99, 0xbe, 0xff, 0x80, 0x91, 0xb9, 0xff, 0x80, 0x92, 0xbd, 0xff, 0x82, 0x95, 0xba, 0xff, 0x86, 0x96, 0xba, 0xff, 0x87, 0x98, 0xbe, 0xff, 0x85, 0x99, 0xbf, 0xff, 0x88, 0x99, 0xc0, 0xff, 0x8a, 0x9b, 0xc2, 0xff, 0x8b, 0x9d, 0xc4, 0xff, 0x8d, 0x9d, 0xc4, 0xff, 0x8f, 0x9d, 0xc4, 0xff, 0x8d, 0x9c, 0xc3, 0xff, 0x8a, 0x99, 0xbf, 0xff, 0x8a, 0x9a, 0xbf, 0xff, 0x8e, 0x9e, 0xc2, 0xff, 0x91, 0xa1, 0xc5, 0xff, 0x91, 0xa1, 0xc5, 0xff, 0x92, 0xa2, 0xc7, 0xff, 0x91, 0xa1, 0xc6, 0xff, 0x90, 0xa0, 0xc5, 0xff, 0x91, 0xa1, 0xc6, 0xff, 0x8f, 0x9f, 0xc4, 0xff, 0x8f, 0x9f, 0xc4, 0xff, 0x92, 0xa2, 0xc7, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x95, 0xa5, 0xca, 0xff, 0x96, 0xa6, 0xcb, 0xff, 0x93, 0xa6, 0xc9, 0xff, 0x96, 0xa9, 0xcd, 0xff, 0xa2, 0xb3, 0xd9, 0xff, 0xb3, 0xc3, 0xe9, 0xff, 0xbf, 0xd3, 0xf9, 0xff, 0xc6, 0xdd, 0xfe, 0xff, 0xd1, 0xe5, 0xfc, 0xff, 0xdc, 0xed, 0xfa, 0xff, 0xeb, 0xf7, 0xfe, 0xff, 0xf6, 0xfc, 0xfd, 0xff, 0xfa, 0xfc, 0xfc, 0xff, 0xfa, 0xfc, 0xfc, 0xff, 0xfa, 0xfc, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf7, 0xff, 0xff, 0xe4, 0xdd, 0xed, 0xff, 0xc6, 0xb8, 0xcb, 0xff, 0x8f, 0x83, 0x8d, 0xff, 0x7b, 0x7b, 0x7a, 0xff, 0x75, 0x79, 0x76, 0xff, 0x7d, 0x74, 0x74, 0xff, 0x78, 0x5f, 0x5f, 0xff, 0xa8, 0x8c, 0x89, 0xff, 0xd3, 0xbf, 0xbb, 0xff, 0xdb, 0xc8, 0xc7, 0xff, 0xdc, 0xca, 0xcb, 0xff, 0xdf, 0xcd, 0xcd, 0xff, 0xd3, 0xc3, 0xbf, 0xff, 0xd2, 0xbf, 0xbf, 0xff, 0xc8, 0xb9, 0xc0, 0xff, 0xc0, 0xb8, 0xc3, 0xff, 0xcb, 0xc7, 0xd6, 0xff, 0xc4, 0xc5, 0xdc, 0xff, 0xad, 0xb5, 0xd3, 0xff, 0xaa, 0xb3, 0xd1, 0xff, 0xb1, 0xb8, 0xd1, 0xff, 0xbd, 0xbd, 0xd1, 0xff, 0xbd, 0xbb, 0xd0, 0xff, 0xb5, 0xb3, 0xc8, 0xff, 0xad, 0xa9, 0xbe, 0xff, 0xa8, 0xa7, 0xb9, 0xfe, 0xac, 0xac, 0xb8, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xf0, 0xe7, 0x8f, 0xfa, 0xf1, 0xe8, 0xff, 0xf9, 0xf0, 0xe7, 0xff, 0xf8, 0xf0, 0xe6, 0xff, 0xf8, 0xf0, 0xe6, 0xff, 0xf9, 0xf0, 0xe7, 0xff, 0xf9, 0xf0, 0xe7, 0xff, 0xf9, 0xef, 0xe6, 0xff, 0xf7, 0xed, 0xe5, 0xff, 0xf6, 0xec, 0xe4, 0xff, 0xf6, 0xeb, 0xe4, 0xff, 0xf6, 0xeb, 0xe4, 0xff, 0xf4, 0xe8, 0xe1, 0xff, 0xf3, 0xe7, 0xe0, 0xff, 0xf1, 0xe6, 0xdf, 0xff, 0xf1, 0xe5, 0xde, 0xff, 0xf0, 0xe4, 0xde, 0xff, 0xf0, 0xe4, 0xde, 0xff, 0xf0, 0xe4, 0xde, 0xff, 0xf0, 0xe4, 0xde, 0xff, 0xf3, 0xe6, 0xe0, 0xff, 0xf5, 0xe7, 0xe1, 0xff, 0xf5, 0xe8, 0xe1, 0xff, 0xf9, 0xef, 0xe5, 0xff, 0xfc, 0xf5, 0xf1, 0xff, 0xfb, 0xf7, 0xfb, 0xff, 0xfd, 0xfa, 0xfe, 0xff, 0xfd, 0xfb, 0xfe, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xf7, 0xee, 0xff, 0xc4, 0xbe, 0xc8, 0xff, 0x95, 0xa0, 0xc1, 0xff, 0x99, 0xa4, 0xc5, 0xff, 0x8b, 0x99, 0xbe, 0xff, 0x88, 0x98, 0xbf, 0xff, 0x83, 0x94, 0xba, 0xff, 0x84, 0x96, 0xbc, 0xff, 0x85, 0x98, 0xbe, 0xff, 0x85, 0x98, 0xbe, 0xff, 0x8a, 0x9b, 0xc2, 0xff, 0x8c, 0x9c, 0xc3, 0xff, 0x8b, 0x9c, 0xc3, 0xff, 0x8f, 0x9f, 0xc6, 0xff, 0x90, 0x9f, 0xc6, 0xff, 0x8e, 0x9d, 0xc5, 0xff, 0x89, 0x99, 0xbf, 0xff, 0x88, 0x99, 0xbd, 0xff, 0x8b, 0x9b, 0xc0, 0xff, 0x8e, 0x9e, 0xc2, 0xff, 0x90, 0xa0, 0xc4, 0xff, 0x93, 0xa3, 0xc7, 0xff, 0x90, 0xa0, 0xc5, 0xff, 0x90, 0xa0, 0xc5, 0xff, 0x91, 0xa1, 0xc6, 0xff, 0x8f, 0x9f, 0xc4, 0xff, 0x8f, 0x9f, 0xc4, 0xff, 0x8d, 0x9d, 0xc2, 0xff, 0x90, 0xa0, 0xc5, 0xff, 0x92, 0xa2, 0xc7, 0xff, 0x94, 0xa3, 0xc8, 0xff, 0x94, 0xa6, 0xc9, 0xff, 0x99, 0xac, 0xd0, 0xff, 0xa6, 0xb8, 0xde, 0xff, 0xb6, 0xc6, 0xed, 0xff, 0xc0, 0xd3, 0xfa, 0xff, 0xc6, 0xdd, 0xfd, 0xff, 0xd3, 0xe7, 0xfd, 0xff, 0xde, 0xf0, 0xfd, 0xff, 0xea, 0xf8, 0xfe, 0xff, 0xf6, 0xfd, 0xfe, 0xff, 0xfa, 0xfc, 0xfb, 0xff, 0xfb, 0xfd, 0xfc, 0xff, 0xfa, 0xfd, 0xfb, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf4, 0xf9, 0xff, 0xbb, 0xb1, 0xb8, 0xff, 0xbc, 0xab, 0xab, 0xff, 0xdb, 0xc5, 0xbe, 0xff, 0xd8, 0xbb, 0xb6, 0xff, 0xe5, 0xc5, 0xbe, 0xff, 0xf2, 0xd4, 0xc6, 0xff, 0xf7, 0xde, 0xcf, 0xff, 0xfe, 0xe1, 0xd7, 0xff, 0xff, 0xe8, 0xdd, 0xff, 0xfe, 0xe9, 0xdd, 0xff, 0xfd, 0xea, 0xdc, 0xff, 0xfa, 0xe3, 0xd8, 0xff, 0xff, 0xe6, 0xe0, 0xff, 0xee, 0xda, 0xd9, 0xff, 0xde, 0xd0, 0xd3, 0xff, 0xdf, 0xd4, 0xdc, 0xff, 0xca, 0xc3, 0xd1, 0xff, 0xb9, 0xbb, 0xd1, 0xff, 0xb6, 0xbb, 0xd4, 0xff, 0xb6, 0xb8, 0xcd, 0xff, 0xb6, 0xb3, 0xc5, 0xff, 0xb9, 0xb5, 0xc9, 0xff, 0xba, 0xb5, 0xcb, 0xff, 0xbd, 0xb6, 0xcc, 0xff, 0xc6, 0xbd, 0xcf, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xda, 0x07, 0xfa, 0xf1, 0xe7, 0xd1, 0xf9, 0xf0, 0xe7, 0xff, 0xf9, 0xf0, 0xe7, 0xff, 0xf9, 0xf0, 0xe7, 0xff, 0xf9, 0xf0, 0xe7, 0xff, 0xf9, 0xf0, 0xe7, 0xff, 0xf9, 0xf1, 0xe7, 0xff, 0xf9, 0xf1, 0xe7, 0xff, 0xf9, 0xf0, 0xe7, 0xff, 0xf8, 0xed, 0xe5, 0xff, 0xf6, 0xeb, 0xe3, 0xff, 0xf4, 0xea, 0xe1, 0xff, 0xf4, 0xe9, 0xe1, 0xff, 0xf3, 0xe8, 0xe0, 0xff, 0xf3, 0xe8, 0xe0, 0xff, 0xf3, 0xe7, 0xe0, 0xff, 0xf2, 0xe5, 0xe0, 0xff, 0xf2, 0xe6, 0xe0, 0xff, 0xf4, 0xe8, 0xe2, 0xff, 0xf7, 0xe8, 0xe2, 0xff, 0xf8, 0xe9, 0xe3, 0xff, 0xf7, 0xe9, 0xe2, 0xff, 0xfa, 0xf0, 0xe7, 0xff, 0xfc, 0xf7, 0xf3, 0xff, 0xfc, 0xf9, 0xfc, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xf4, 0xe4, 0xdd, 0xff, 0xd9, 0xbc, 0xaa, 0xff, 0xd8, 0xb3, 0xa2, 0xff, 0xd3, 0xa5, 0x8b, 0xff, 0xbc, 0xa6, 0xa7, 0xff, 0x98, 0xa8, 0xc8, 0xff, 0x9d, 0xa8, 0xc7, 0xff, 0x98, 0xa3, 0xc5, 0xff, 0x8e, 0x9c, 0xc0, 0xff, 0x87, 0x97, 0xbe, 0xff, 0x84, 0x99, 0xbf, 0xff, 0x85, 0x9a, 0xbf, 0xff, 0x89, 0x9b, 0xc1, 0xff, 0x8c, 0x9e, 0xc4, 0xff, 0x8b, 0x9c, 0xc3, 0xff, 0x8c, 0x9d, 0xc4, 0xff, 0x90, 0x9f, 0xc6, 0xff, 0x8f, 0x9e, 0xc5, 0xff, 0x8d, 0x9c, 0xc4, 0xff, 0x8a, 0x9a, 0xc0, 0xff, 0x8a, 0x9a, 0xbf, 0xff, 0x8a, 0x9a, 0xbe, 0xff, 0x8a, 0x9a, 0xbe, 0xff, 0x8d, 0x9d, 0xc1, 0xff, 0x90, 0xa0, 0xc5, 0xff, 0x8d, 0x9d, 0xc2, 0xff, 0x8d, 0x9d, 0xc2, 0xff, 0x8d, 0x9d, 0xc2, 0xff, 0x8e, 0x9e, 0xc3, 0xff, 0x90, 0xa0, 0xc5, 0xff, 0x8f, 0x9f, 0xc4, 0xff, 0x91, 0xa1, 0xc6, 0xff, 0x92, 0xa2, 0xc7, 0xff, 0x94, 0xa4, 0xc9, 0xff, 0x97, 0xa9, 0xcd, 0xff, 0x9e, 0xb0, 0xd5, 0xff, 0xaa, 0xbb, 0xe1, 0xff, 0xb7, 0xc6, 0xee, 0xff, 0xc0, 0xd4, 0xfa, 0xff, 0xc6, 0xde, 0xfc, 0xff, 0xd1, 0xe5, 0xfb, 0xff, 0xe0, 0xf1, 0xfe, 0xff, 0xea, 0xf7, 0xfc, 0xff, 0xf4, 0xfb, 0xfd, 0xff, 0xfa, 0xfc, 0xfd, 0xff, 0xfb, 0xfd, 0xfd, 0xff, 0xfb, 0xfe, 0xfc, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf6, 0xff, 0xe9, 0xdc, 0xd4, 0xff, 0xe9, 0xc4, 0xbb, 0xff, 0xfa, 0xc5, 0xc3, 0xff, 0xfb, 0xce, 0xc6, 0xff, 0xed, 0xcf, 0xbb, 0xff, 0xec, 0xd3, 0xc2, 0xff, 0xfb, 0xe1, 0xd8, 0xff, 0xfb, 0xe3, 0xd6, 0xff, 0xec, 0xd4, 0xc3, 0xff, 0xf5, 0xdc, 0xc7, 0xff, 0xf3, 0xd2, 0xc0, 0xff, 0xee, 0xcb, 0xbd, 0xff, 0xf3, 0xd4, 0xc9, 0xff, 0xf3, 0xd8, 0xcf, 0xff, 0xf0, 0xd7, 0xd3, 0xff, 0xe8, 0xd4, 0xd2, 0xff, 0xd7, 0xca, 0xce, 0xff, 0xcd, 0xc5, 0xcf, 0xff, 0xcb, 0xc3, 0xcd, 0xff, 0xc3, 0xbc, 0xc9, 0xff, 0xbf, 0xb7, 0xc7, 0xff, 0xc3, 0xb9, 0xce, 0xff, 0xca, 0xc1, 0xd5, 0xd1, 0xdf, 0xbf, 0xdf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xf2, 0xe6, 0x2a, 0xf6, 0xf0, 0xe6, 0xf3, 0xf7, 0xf0, 0xe7, 0xff, 0xf7, 0xf0, 0xe7, 0xff, 0xf7, 0xf0, 0xe7, 0xff, 0xf8, 0xf0, 0xe7, 0xff, 0xfa, 0xf0, 0xe7, 0xff, 0xf9, 0xf0, 0xe7, 0xff, 0xf9, 0xf0, 0xe7, 0xff, 0xf9, 0xed, 0xe5, 0xff, 0xf6, 0xeb, 0xe3, 0xff, 0xf7, 0xec, 0xe3, 0xff, 0xf7, 0xed, 0xe5, 0xff, 0xf5, 0xeb, 0xe3, 0xff, 0xf5, 0xea, 0xe3, 0xff, 0xf6, 0xea, 0xe3, 0xff, 0xf7, 0xea, 0xe2, 0xff, 0xf7, 0xeb, 0xe3, 0xff, 0xf9, 0xec, 0xe4, 0xff, 0xfb, 0xeb, 0xe6, 0xff, 0xfc, 0xed, 0xe6, 0xff, 0xfc, 0xee, 0xe6, 0xff, 0xf9, 0xf1, 0xea, 0xff, 0xfd, 0xf7, 0xf5, 0xff, 0xff, 0xfa, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xee, 0xe7, 0xff, 0xd9, 0xc7, 0xbb, 0xff, 0xe1, 0xc6, 0xb5, 0xff, 0xca, 0x9c, 0x85, 0xff, 0x97, 0x60, 0x40, 0xff, 0xb2, 0x7a, 0x5e, 0xff, 0x8a, 0x4f, 0x31, 0xff, 0x94, 0x77, 0x79, 0xff, 0xa7, 0xb6, 0xd5, 0xff, 0x9d, 0xa7, 0xc4, 0xff, 0x9a, 0xa5, 0xc2, 0xff, 0x95, 0xa0, 0xc5, 0xff, 0x8d, 0x9d, 0xc4, 0xff, 0x89, 0x9b, 0xc2, 0xff, 0x87, 0x9a, 0xc0, 0xff, 0x8a, 0x9d, 0xc3, 0xff, 0x8b, 0x9d, 0xc4, 0xff, 0x8a, 0x9b, 0xc2, 0xff, 0x8c, 0x9d, 0xc4, 0xff, 0x8e, 0x9d, 0xc4, 0xff, 0x90, 0x9e, 0xc5, 0xff, 0x8e, 0x9d, 0xc5, 0xff, 0x8c, 0x9b, 0xc1, 0xff, 0x88, 0x98, 0xbd, 0xff, 0x89, 0x99, 0xbe, 0xff, 0x88, 0x98, 0xbc, 0xff, 0x89, 0x99, 0xbc, 0xff, 0x8d, 0x9d, 0xc2, 0xff, 0x8d, 0x9d, 0xc2, 0xff, 0x8d, 0x9d, 0xc2, 0xff, 0x8f, 0x9f, 0xc4, 0xff, 0x8f, 0x9f, 0xc4, 0xff, 0x90, 0xa1, 0xc6, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x94, 0xa4, 0xc9, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x95, 0xa4, 0xc9, 0xff, 0x96, 0xa9, 0xcc, 0xff, 0x9d, 0xaf, 0xd3, 0xff, 0xa8, 0xba, 0xe0, 0xff, 0xb7, 0xc6, 0xee, 0xff, 0xc3, 0xd7, 0xfd, 0xff, 0xc8, 0xe0, 0xfe, 0xff, 0xd2, 0xe5, 0xfb, 0xff, 0xde, 0xee, 0xfd, 0xff, 0xeb, 0xf8, 0xfc, 0xff, 0xf4, 0xfa, 0xfc, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xfd, 0xff, 0xfd, 0xfc, 0xfc, 0xff, 0xfd, 0xfb, 0xfc, 0xff, 0xfd, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xe1, 0xd4, 0xd0, 0xff, 0xbc, 0xa2, 0xa5, 0xff, 0xa1, 0x82, 0x82, 0xff, 0x9f, 0x83, 0x77, 0xff, 0xba, 0x9e, 0x96, 0xff, 0xf4, 0xd9, 0xd5, 0xff, 0xf2, 0xd8, 0xcd, 0xff, 0xe8, 0xcd, 0xbb, 0xff, 0xf2, 0xd3, 0xbc, 0xff, 0xfb, 0xd1, 0xba, 0xff, 0xe0, 0xb2, 0x9d, 0xff, 0xe6, 0xba, 0xa5, 0xff, 0xe9, 0xc0, 0xaa, 0xff, 0xe5, 0xbc, 0xa8, 0xff, 0xf5, 0xd0, 0xbf, 0xff, 0xf6, 0xd7, 0xc9, 0xff, 0xee, 0xd3, 0xca, 0xff, 0xde, 0xcc, 0xce, 0xff, 0xce, 0xc5, 0xce, 0xff, 0xc1, 0xb8, 0xc6, 0xff, 0xbf, 0xb5, 0xc9, 0xf4, 0xc8, 0xc2, 0xd4, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xf0, 0xe7, 0x55, 0xf6, 0xef, 0xe6, 0xfe, 0xf7, 0xf0, 0xe7, 0xff, 0xf7, 0xf0, 0xe7, 0xff, 0xf8, 0xf0, 0xe7, 0xff, 0xfa, 0xf1, 0xe8, 0xff, 0xf8, 0xf1, 0xe8, 0xff, 0xf7, 0xf0, 0xe7, 0xff, 0xf8, 0xee, 0xe6, 0xff, 0xf9, 0xef, 0xe7, 0xff, 0xfa, 0xed, 0xe6, 0xff, 0xfa, 0xee, 0xe5, 0xff, 0xfa, 0xed, 0xe3, 0xff, 0xf8, 0xed, 0xe4, 0xff, 0xfb, 0xee, 0xe4, 0xff, 0xfc, 0xee, 0xe5, 0xff, 0xfb, 0xed, 0xe5, 0xff, 0xfc, 0xee, 0xe7, 0xff, 0xfc, 0xee, 0xe7, 0xff, 0xfc, 0xee, 0xe9, 0xff, 0xfa, 0xef, 0xea, 0xff, 0xf6, 0xf1, 0xee, 0xff, 0xfc, 0xf7, 0xf3, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe1, 0xd2, 0xff, 0xb7, 0x9e, 0x8c, 0xff, 0xb1, 0x87, 0x74, 0xff, 0xc8, 0x99, 0x7f, 0xff, 0xb5, 0x82, 0x61, 0xff, 0x84, 0x4a, 0x2a, 0xff, 0x6a, 0x31, 0x1a, 0xff, 0x7b, 0x4d, 0x37, 0xff, 0xd0, 0xbe, 0xc1, 0xff, 0xa5, 0xb0, 0xca, 0xff, 0x9a, 0xa4, 0xbe, 0xff, 0x97, 0xa4, 0xc0, 0xff, 0x96, 0xa0, 0xc5, 0xff, 0x91, 0x9e, 0xc5, 0xff, 0x8e, 0x9d, 0xc4, 0xff, 0x8b, 0x9d, 0xc3, 0xff, 0x8a, 0x9d, 0xc3, 0xff, 0x89, 0x9a, 0xc1, 0xff, 0x89, 0x9a, 0xc1, 0xff, 0x89, 0x9a, 0xc1, 0xff, 0x8b, 0x9a, 0xc1, 0xff, 0x8b, 0x9a, 0xc1, 0xff, 0x8b, 0x9b, 0xc2, 0xff, 0x89, 0x99, 0xbf, 0xff, 0x86, 0x97, 0xbc, 0xff, 0x88, 0x99, 0xbd, 0xff, 0x86, 0x96, 0xba, 0xff, 0x85, 0x96, 0xba, 0xff, 0x8a, 0x9b, 0xbf, 0xff, 0x8f, 0xa0, 0xc5, 0xff, 0x92, 0xa2, 0xc7, 0xff, 0x90, 0xa0, 0xc5, 0xff, 0x8f, 0x9e, 0xc4, 0xff, 0x90, 0x9f, 0xc4, 0xff, 0x92, 0xa1, 0xc7, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x96, 0xa8, 0xcc, 0xff, 0x9e, 0xb1, 0xd5, 0xff, 0xaa, 0xbc, 0xe2, 0xff, 0xb7, 0xc7, 0xee, 0xff, 0xc0, 0xd3, 0xf9, 0xff, 0xc7, 0xde, 0xfd, 0xff, 0xd0, 0xe5, 0xfb, 0xff, 0xdb, 0xee, 0xfc, 0xff, 0xeb, 0xf8, 0xfe, 0xff, 0xf5, 0xfa, 0xfd, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xf9, 0xfe, 0xfc, 0xff, 0xfa, 0xfe, 0xfb, 0xff, 0xfa, 0xfd, 0xfb, 0xff, 0xfc, 0xfc, 0xfd, 0xff, 0xf7, 0xfa, 0xfb, 0xff, 0xf8, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfb, 0xfc, 0xff, 0xd5, 0xcf, 0xd4, 0xff, 0xaa, 0x9d, 0xa3, 0xff, 0xbc, 0xa3, 0xa6, 0xff, 0xf5, 0xd8, 0xd1, 0xff, 0xf4, 0xd6, 0xca, 0xff, 0xe8, 0xc9, 0xb8, 0xff, 0xc9, 0xa5, 0x8f, 0xff, 0xd5, 0xa9, 0x93, 0xff, 0xd7, 0xa8, 0x91, 0xff, 0xe5, 0xb7, 0x9f, 0xff, 0xe9, 0xbc, 0xa4, 0xff, 0xe2, 0xb5, 0x9e, 0xff, 0xea, 0xc0, 0xab, 0xff, 0xe9, 0xc2, 0xae, 0xff, 0xf5, 0xd0, 0xbf, 0xff, 0xee, 0xd3, 0xcc, 0xff, 0xdb, 0xc9, 0xc8, 0xff, 0xce, 0xbd, 0xc3, 0xff, 0xc3, 0xb4, 0xc3, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xf0, 0xe7, 0x8d, 0xf9, 0xef, 0xe6, 0xff, 0xf9, 0xef, 0xe6, 0xff, 0xf9, 0xf0, 0xe6, 0xff, 0xf9, 0xf1, 0xe8, 0xff, 0xf9, 0xf1, 0xe8, 0xff, 0xf9, 0xf1, 0xe8, 0xff, 0xf7, 0xf0, 0xe7, 0xff, 0xf9, 0xef, 0xe6, 0xff, 0xfd, 0xed, 0xe6, 0xff, 0xfc, 0xee, 0xe4, 0xff, 0xf9, 0xef, 0xe4, 0xff, 0xf8, 0xf0, 0xe5, 0xff, 0xf9, 0xf0, 0xe4, 0xff, 0xfb, 0xf0, 0xe5, 0xff, 0xf8, 0xee, 0xe5, 0xff, 0xf6, 0xed, 0xe6, 0xff, 0xf7, 0xef, 0xe9, 0xff, 0xf5, 0xee, 0xeb, 0xff, 0xf6, 0xf0, 0xef, 0xff, 0xfc, 0xf5, 0xf1, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xfd, 0xeb, 0xdd, 0xff, 0xe7, 0xcd, 0xbb, 0xff, 0xc0, 0x9f, 0x86, 0xff, 0xbf, 0x98, 0x7f, 0xff, 0xca, 0x9e, 0x8d, 0xff, 0xbf, 0x91, 0x78, 0xff, 0x90, 0x5e, 0x40, 0xff, 0x3f, 0x05, 0x00, 0xff, 0x5c, 0x31, 0x2a, 0xff, 0xf1, 0xe6, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xa4, 0xba, 0xff, 0x93, 0xa0, 0xb9, 0xff, 0x92, 0xa1, 0xc0, 0xff, 0x95, 0x9f, 0xc3, 0xff, 0x95, 0xa0, 0xc4, 0xff, 0x91, 0x9e, 0xc4, 0xff, 0x8a, 0x9b, 0xc1, 0xff, 0x89, 0x9a, 0xc1, 0xff, 0x87, 0x98, 0xbf, 0xff, 0x86, 0x97, 0xbe, 0xff, 0x87, 0x98, 0xbf, 0xff, 0x87, 0x98, 0xbf, 0xff, 0x86, 0x98, 0xbe, 0xff, 0x85, 0x97, 0xbc, 0xff, 0x84, 0x96, 0xbb, 0xff, 0x84, 0x96, 0xbb, 0xff, 0x87, 0x99, 0xbe, 0xff, 0x87, 0x99, 0xbe, 0xff, 0x86, 0x98, 0xbd, 0xff, 0x85, 0x97, 0xbc, 0xff, 0x89, 0x9b, 0xc0, 0xff, 0x90, 0xa1, 0xc5, 0xff, 0x92, 0xa0, 0xc6, 0xff, 0x91, 0x9d, 0xc4, 0xff, 0x93, 0x9f, 0xc5, 0xff, 0x96, 0xa3, 0xc9, 0xff, 0x94, 0xa4, 0xc9, 0xff, 0x92, 0xa2, 0xc7, 0xff, 0x95, 0xa5, 0xca, 0xff, 0x98, 0xaa, 0xce, 0xff, 0xa1, 0xb4, 0xd8, 0xff, 0xac, 0xbd, 0xe3, 0xff, 0xb6, 0xc7, 0xee, 0xff, 0xc2, 0xd3, 0xfa, 0xff, 0xc8, 0xdc, 0xfe, 0xff, 0xcb, 0xe4, 0xfa, 0xff, 0xd6, 0xec, 0xfc, 0xff, 0xe5, 0xf3, 0xff, 0xff, 0xf0, 0xf8, 0xff, 0xff, 0xf6, 0xf9, 0xff, 0xff, 0xf7, 0xfc, 0xfc, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0xf5, 0xfd, 0xfa, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xf8, 0xe0, 0xdf, 0xff, 0xec, 0xcd, 0xbb, 0xff, 0xe2, 0xc0, 0xaf, 0xff, 0xc4, 0xa0, 0x90, 0xff, 0xc8, 0xa1, 0x8c, 0xff, 0xd5, 0xad, 0x96, 0xff, 0xb9, 0x90, 0x78, 0xff, 0xbd, 0x93, 0x7c, 0xff, 0xcc, 0xa2, 0x8d, 0xff, 0xcc, 0xa4, 0x90, 0xff, 0xcd, 0xa5, 0x93, 0xff, 0xc6, 0x9e, 0x8c, 0xff, 0xcb, 0xa6, 0x92, 0xff, 0xe5, 0xc2, 0xac, 0xff, 0xf2, 0xd0, 0xbe, 0xff, 0xe9, 0xc8, 0xbd, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xf9, 0xf0, 0xe6, 0xb1, 0xf9, 0xf0, 0xe7, 0xff, 0xfa, 0xf0, 0xe7, 0xff, 0xfb, 0xf1, 0xe8, 0xff, 0xfb, 0xf1, 0xe8, 0xff, 0xf9, 0xf0, 0xe7, 0xff, 0xf8, 0xef, 0xe6, 0xff, 0xf9, 0xee, 0xe6, 0xff, 0xf9, 0xed, 0xe5, 0xff, 0xf7, 0xee, 0xe5, 0xff, 0xf5, 0xef, 0xe6, 0xff, 0xf4, 0xef, 0xe6, 0xff, 0xf3, 0xef, 0xe7, 0xff, 0xf3, 0xf0, 0xe5, 0xff, 0xf6, 0xf0, 0xe5, 0xff, 0xf6, 0xee, 0xe6, 0xff, 0xf6, 0xf0, 0xe8, 0xff, 0xfe, 0xf4, 0xec, 0xff, 0xff, 0xf1, 0xea, 0xff, 0xfd, 0xe5, 0xd9, 0xff, 0xee, 0xd0, 0xc1, 0xff, 0xe0, 0xba, 0xab, 0xff, 0xd7, 0xad, 0x99, 0xff, 0xd9, 0xac, 0x97, 0xff, 0xde, 0xad, 0x95, 0xff, 0xde, 0xad, 0x8e, 0xff, 0x99, 0x6a, 0x4b, 0xff, 0x28, 0x00, 0x00, 0xff, 0x4d, 0x21, 0x20, 0xff, 0xea, 0xda, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xef, 0xf8, 0xff, 0xa9, 0xab, 0xc2, 0xff, 0x91, 0x9b, 0xb7, 0xff, 0x94, 0xa1, 0xc2, 0xff, 0x93, 0x9d, 0xc1, 0xff, 0x8f, 0x9a, 0xbf, 0xff, 0x8e, 0x9c, 0xc1, 0xff, 0x89, 0x9a, 0xc0, 0xff, 0x84, 0x95, 0xbd, 0xff, 0x84, 0x95, 0xbc, 0xff, 0x83, 0x94, 0xbb, 0xff, 0x84, 0x95, 0xbc, 0xff, 0x84, 0x95, 0xbd, 0xff, 0x86, 0x97, 0xbe, 0xff, 0x84, 0x96, 0xbb, 0xff, 0x85, 0x97, 0xbc, 0xff, 0x88, 0x9a, 0xbf, 0xff, 0x87, 0x99, 0xbe, 0xff, 0x89, 0x9b, 0xc0, 0xff, 0x88, 0x9a, 0xbf, 0xff, 0x86, 0x98, 0xbd, 0xff, 0x85, 0x98, 0xbd, 0xff, 0x8a, 0x9b, 0xc0, 0xff, 0x8f, 0x9e, 0xc3, 0xff, 0x92, 0x9e, 0xc4, 0xff, 0x94, 0xa0, 0xc6, 0xff, 0x94, 0xa2, 0xc7, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x96, 0xa6, 0xcb, 0xff, 0x9a, 0xad, 0xd0, 0xff, 0xa2, 0xb5, 0xd9, 0xff, 0xab, 0xbd, 0xe3, 0xff, 0xb7, 0xc8, 0xef, 0xff, 0xc3, 0xd4, 0xfc, 0xff, 0xc7, 0xdc, 0xfd, 0xff, 0xcd, 0xe4, 0xfb, 0xff, 0xd6, 0xea, 0xfc, 0xff, 0xe0, 0xf0, 0xfc, 0xff, 0xe8, 0xf6, 0xfd, 0xff, 0xea, 0xfb, 0xff, 0xff, 0xf4, 0xfc, 0xfe, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xf9, 0xfb, 0xfd, 0xff, 0xee, 0xfb, 0xff, 0xff, 0xf3, 0xfd, 0xff, 0xff, 0xfd, 0xf8, 0xf9, 0xff, 0xf2, 0xdb, 0xcf, 0xff, 0xef, 0xcd, 0xbc, 0xff, 0xdd, 0xb9, 0xaa, 0xff, 0xcc, 0xa8, 0x97, 0xff, 0xbf, 0x9a, 0x88, 0xff, 0xc3, 0x9e, 0x89, 0xff, 0xd8, 0xb2, 0x9b, 0xff, 0xd1, 0xa9, 0x92, 0xff, 0xb4, 0x8b, 0x72, 0xff, 0xb6, 0x8e, 0x75, 0xff, 0xac, 0x85, 0x6d, 0xff, 0xaf, 0x89, 0x74, 0xff, 0xbd, 0x98, 0x82, 0xff, 0xb9, 0x93, 0x7d, 0xff, 0xce, 0xa7, 0x90, 0xff, 0xe3, 0xb9, 0xa1, 0xb1, 0xff, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe5, 0xe5, 0x0a, 0xf9, 0xf0, 0xe8, 0xc8, 0xfa, 0xf0, 0xe8, 0xff, 0xfa, 0xee, 0xe7, 0xff, 0xf8, 0xed, 0xe5, 0xff, 0xf8, 0xed, 0xe5, 0xff, 0xf9, 0xee, 0xe6, 0xff, 0xf7, 0xec, 0xe4, 0xff, 0xf7, 0xed, 0xe5, 0xff, 0xf6, 0xeb, 0xe5, 0xff, 0xf6, 0xea, 0xe6, 0xff, 0xf6, 0xec, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe5, 0xff, 0xfa, 0xf0, 0xe6, 0xff, 0xff, 0xf5, 0xe9, 0xff, 0xff, 0xf2, 0xe4, 0xff, 0xfa, 0xe0, 0xd0, 0xff, 0xed, 0xcb, 0xba, 0xff, 0xe8, 0xc0, 0xac, 0xff, 0xe5, 0xbd, 0xa9, 0xff, 0xea, 0xc3, 0xaf, 0xff, 0xed, 0xc2, 0xae, 0xff, 0xeb, 0xbc, 0xac, 0xff, 0xe9, 0xba, 0xa4, 0xff, 0xb8, 0x8b, 0x6e, 0xff, 0x5b, 0x34, 0x20, 0xff, 0x7b, 0x5b, 0x58, 0xff, 0xed, 0xde, 0xe1, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xd9, 0xce, 0xdf, 0xff, 0x92, 0x93, 0xad, 0xff, 0x97, 0xa1, 0xbe, 0xff, 0x94, 0xa0, 0xc3, 0xff, 0x94, 0x9e, 0xc3, 0xff, 0x8d, 0x99, 0xbd, 0xff, 0x89, 0x98, 0xbc, 0xff, 0x86, 0x97, 0xbd, 0xff, 0x84, 0x95, 0xbc, 0xff, 0x81, 0x92, 0xb9, 0xff, 0x80, 0x91, 0xb8, 0xff, 0x83, 0x94, 0xbb, 0xff, 0x85, 0x96, 0xbd, 0xff, 0x84, 0x95, 0xbc, 0xff, 0x85, 0x97, 0xbc, 0xff, 0x85, 0x97, 0xbc, 0xff, 0x87, 0x99, 0xbe, 0xff, 0x88, 0x9a, 0xbf, 0xff, 0x86, 0x98, 0xbd, 0xff, 0x86, 0x98, 0xbd, 0xff, 0x87, 0x99, 0xbe, 0xff, 0x84, 0x96, 0xbb, 0xff, 0x84, 0x95, 0xba, 0xff, 0x8b, 0x9a, 0xc0, 0xff, 0x91, 0x9e, 0xc4, 0xff, 0x93, 0xa0, 0xc6, 0xff, 0x93, 0xa1, 0xc7, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x98, 0xa8, 0xcd, 0xff, 0x9a, 0xac, 0xcf, 0xff, 0xa2, 0xb4, 0xd9, 0xff, 0xad, 0xbf, 0xe5, 0xff, 0xba, 0xca, 0xf2, 0xff, 0xc4, 0xd6, 0xfc, 0xff, 0xc7, 0xdc, 0xfd, 0xff, 0xcd, 0xe3, 0xfb, 0xff, 0xd5, 0xe9, 0xfb, 0xff, 0xdc, 0xee, 0xfc, 0xff, 0xe3, 0xf3, 0xfc, 0xff, 0xe6, 0xf8, 0xfd, 0xff, 0xf0, 0xf8, 0xfe, 0xff, 0xf8, 0xf8, 0xfe, 0xff, 0xf8, 0xf9, 0xfe, 0xff, 0xf4, 0xfa, 0xfe, 0xff, 0xf0, 0xfb, 0xfc, 0xff, 0xf1, 0xfa, 0xfc, 0xff, 0xf8, 0xfc, 0xff, 0xff, 0xf6, 0xf7, 0xfe, 0xff, 0xea, 0xe4, 0xe8, 0xff, 0xe8, 0xcf, 0xc6, 0xff, 0xeb, 0xc2, 0xab, 0xff, 0xdc, 0xb1, 0x9d, 0xff, 0xd7, 0xae, 0x9f, 0xff, 0xca, 0xa3, 0x91, 0xff, 0xc3, 0x9d, 0x8a, 0xff, 0xc3, 0x9f, 0x89, 0xff, 0xb6, 0x91, 0x7a, 0xff, 0xc3, 0x9e, 0x86, 0xff, 0xbf, 0x98, 0x7d, 0xff, 0xb7, 0x90, 0x73, 0xff, 0xb7, 0x91, 0x76, 0xff, 0xd6, 0xb3, 0x99, 0xff, 0xcd, 0xa8, 0x90, 0xff, 0xd2, 0xaa, 0x93, 0xff, 0xe5, 0xbb, 0xa3, 0xc8, 0xe5, 0xb2, 0x99, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf2, 0xe6, 0x15, 0xf9, 0xee, 0xe6, 0xd7, 0xf8, 0xef, 0xe6, 0xff, 0xf6, 0xeb, 0xe3, 0xff, 0xf7, 0xea, 0xe2, 0xff, 0xf7, 0xea, 0xe2, 0xff, 0xf5, 0xe8, 0xe0, 0xff, 0xf7, 0xeb, 0xe4, 0xff, 0xf7, 0xeb, 0xe4, 0xff, 0xf7, 0xe8, 0xe2, 0xff, 0xfd, 0xec, 0xe6, 0xff, 0xff, 0xee, 0xe6, 0xff, 0xff, 0xeb, 0xe0, 0xff, 0xfe, 0xe6, 0xd7, 0xff, 0xf7, 0xde, 0xcd, 0xff, 0xed, 0xcb, 0xba, 0xff, 0xe3, 0xba, 0xa7, 0xff, 0xe3, 0xbb, 0xa6, 0xff, 0xf0, 0xc9, 0xb0, 0xff, 0xf2, 0xcc, 0xb3, 0xff, 0xee, 0xc9, 0xb1, 0xff, 0xed, 0xc4, 0xae, 0xff, 0xf1, 0xc6, 0xb0, 0xff, 0xce, 0xa8, 0x91, 0xff, 0x8e, 0x6e, 0x5e, 0xff, 0xb2, 0x93, 0x93, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xf4, 0xf7, 0xff, 0xfe, 0xe9, 0xea, 0xff, 0xff, 0xf3, 0xfd, 0xff, 0x8c, 0x7f, 0x94, 0xff, 0x85, 0x86, 0xa3, 0xff, 0x9d, 0xa6, 0xc5, 0xff, 0x94, 0x9d, 0xc1, 0xff, 0x97, 0x9e, 0xc3, 0xff, 0x8f, 0x9a, 0xbf, 0xff, 0x84, 0x98, 0xbc, 0xff, 0x81, 0x94, 0xba, 0xff, 0x82, 0x92, 0xba, 0xff, 0x82, 0x93, 0xba, 0xff, 0x81, 0x92, 0xb9, 0xff, 0x81, 0x92, 0xb9, 0xff, 0x83, 0x94, 0xbb, 0xff, 0x84, 0x95, 0xbc, 0xff, 0x85, 0x97, 0xbc, 0xff, 0x87, 0x99, 0xbe, 0xff, 0x87, 0x99, 0xbe, 0xff, 0x88, 0x9a, 0xbf, 0xff, 0x87, 0x99, 0xbe, 0xff, 0x86, 0x98, 0xbd, 0xff, 0x85, 0x98, 0xbd, 0xff, 0x85, 0x98, 0xbd, 0xff, 0x83, 0x96, 0xbb, 0xff, 0x83, 0x94, 0xb9, 0xff, 0x89, 0x98, 0xbd, 0xff, 0x8c, 0x9c, 0xc1, 0xff, 0x92, 0xa2, 0xc7, 0xff, 0x94, 0xa4, 0xc9, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x99, 0xa9, 0xce, 0xff, 0x9b, 0xad, 0xd2, 0xff, 0xa4, 0xb6, 0xdb, 0xff, 0xb1, 0xc3, 0xe7, 0xff, 0xb9, 0xcc, 0xf2, 0xff, 0xc2, 0xd6, 0xfb, 0xff, 0xc9, 0xdc, 0xfd, 0xff, 0xcf, 0xe1, 0xfc, 0xff, 0xd5, 0xe8, 0xfb, 0xff, 0xdd, 0xed, 0xfd, 0xff, 0xe0, 0xf0, 0xfc, 0xff, 0xe4, 0xf1, 0xfb, 0xff, 0xe9, 0xf3, 0xfd, 0xff, 0xec, 0xf6, 0xff, 0xff, 0xea, 0xf8, 0xff, 0xff, 0xe2, 0xf8, 0xfa, 0xff, 0xe2, 0xf8, 0xfd, 0xff, 0xee, 0xf9, 0xff, 0xff, 0xfa, 0xf6, 0xf9, 0xff, 0xf4, 0xdb, 0xd1, 0xff, 0xe3, 0xbf, 0xaa, 0xff, 0xd6, 0xb0, 0x9a, 0xff, 0xd8, 0xb3, 0xa1, 0xff, 0xcd, 0xa7, 0x97, 0xff, 0xda, 0xaf, 0x9c, 0xff, 0xde, 0xb6, 0xa2, 0xff, 0xbf, 0x9a, 0x86, 0xff, 0xd1, 0xac, 0x97, 0xff, 0xb4, 0x8f, 0x79, 0xff, 0xa5, 0x7f, 0x68, 0xff, 0xb0, 0x88, 0x6d, 0xff, 0xa7, 0x80, 0x61, 0xff, 0xca, 0xa4, 0x88, 0xff, 0xd0, 0xa9, 0x90, 0xff, 0xc7, 0x9e, 0x87, 0xff, 0xc3, 0x9a, 0x84, 0xd8, 0xc2, 0x9d, 0x85, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xec, 0xe3, 0x1c, 0xf6, 0xec, 0xe4, 0xdc, 0xf7, 0xeb, 0xe3, 0xff, 0xf7, 0xe9, 0xe1, 0xff, 0xf7, 0xe8, 0xe1, 0xff, 0xfa, 0xea, 0xe3, 0xff, 0xfd, 0xed, 0xe3, 0xff, 0xfe, 0xec, 0xe3, 0xff, 0xff, 0xf0, 0xe6, 0xff, 0xff, 0xeb, 0xde, 0xff, 0xfc, 0xde, 0xcd, 0xff, 0xef, 0xcc, 0xba, 0xff, 0xe5, 0xbf, 0xac, 0xff, 0xde, 0xb6, 0xa1, 0xff, 0xe1, 0xb3, 0x9e, 0xff, 0xef, 0xbd, 0xa8, 0xff, 0xf4, 0xc6, 0xb0, 0xff, 0xf0, 0xc8, 0xb1, 0xff, 0xeb, 0xc3, 0xac, 0xff, 0xe6, 0xbe, 0xa8, 0xff, 0xe8, 0xc0, 0xab, 0xff, 0xf7, 0xce, 0xb6, 0xff, 0xd4, 0xaf, 0x96, 0xff, 0xab, 0x8f, 0x85, 0xff, 0xe6, 0xd0, 0xd7, 0xff, 0xff, 0xe8, 0xef, 0xff, 0xfc, 0xe5, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xaf, 0xc2, 0xff, 0x64, 0x5b, 0x79, 0xff, 0xa6, 0xa6, 0xc3, 0xff, 0x90, 0x99, 0xb8, 0xff, 0x95, 0x9e, 0xc1, 0xff, 0x95, 0x9c, 0xc2, 0xff, 0x91, 0x9b, 0xc0, 0xff, 0x86, 0x9a, 0xbe, 0xff, 0x82, 0x96, 0xbc, 0xff, 0x84, 0x94, 0xbc, 0xff, 0x84, 0x95, 0xbc, 0xff, 0x82, 0x93, 0xba, 0xff, 0x81, 0x92, 0xb9, 0xff, 0x84, 0x95, 0xbc, 0xff, 0x86, 0x97, 0xbe, 0xff, 0x86, 0x98, 0xbd, 0xff, 0x88, 0x9a, 0xbf, 0xff, 0x88, 0x9a, 0xbf, 0xff, 0x86, 0x98, 0xbd, 0xff, 0x86, 0x98, 0xbd, 0xff, 0x87, 0x99, 0xbe, 0xff, 0x85, 0x98, 0xbd, 0xff, 0x85, 0x99, 0xbd, 0xff, 0x83, 0x96, 0xbb, 0xff, 0x7e, 0x90, 0xb5, 0xff, 0x82, 0x92, 0xb7, 0xff, 0x86, 0x96, 0xbb, 0xff, 0x8c, 0x9c, 0xc1, 0xff, 0x91, 0xa1, 0xc5, 0xff, 0x93, 0xa3, 0xc8, 0xff, 0x98, 0xa8, 0xcd, 0xff, 0x9d, 0xaf, 0xd4, 0xff, 0xa7, 0xb9, 0xde, 0xff, 0xb3, 0xc5, 0xea, 0xff, 0xba, 0xce, 0xf4, 0xff, 0xc3, 0xd7, 0xfc, 0xff, 0xcb, 0xdd, 0xfe, 0xff, 0xd1, 0xe2, 0xfe, 0xff, 0xd4, 0xe5, 0xfb, 0xff, 0xd8, 0xe8, 0xf9, 0xff, 0xdc, 0xea, 0xf8, 0xff, 0xe2, 0xed, 0xfe, 0xff, 0xe0, 0xf3, 0xff, 0xff, 0xdc, 0xf4, 0xfd, 0xff, 0xe1, 0xf3, 0xfb, 0xff, 0xee, 0xfa, 0xff, 0xff, 0xf2, 0xf6, 0xf7, 0xff, 0xeb, 0xe0, 0xe2, 0xff, 0xe2, 0xc7, 0xc1, 0xff, 0xe2, 0xb4, 0x9c, 0xff, 0xf7, 0xc5, 0xa6, 0xff, 0xe6, 0xbf, 0xa5, 0xff, 0xd0, 0xae, 0x9a, 0xff, 0xd2, 0xb2, 0xa2, 0xff, 0xd2, 0xab, 0x96, 0xff, 0xd1, 0xa9, 0x94, 0xff, 0xcf, 0xa8, 0x93, 0xff, 0xc0, 0x9c, 0x86, 0xff, 0xb0, 0x8a, 0x74, 0xff, 0xa8, 0x81, 0x6a, 0xff, 0xc9, 0x9f, 0x85, 0xff, 0xd2, 0xa9, 0x8d, 0xff, 0xb7, 0x8e, 0x75, 0xff, 0xbe, 0x95, 0x7e, 0xff, 0xce, 0xa6, 0x8f, 0xdd, 0xbf, 0x9a, 0x7f, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xef, 0xe7, 0x21, 0xfa, 0xeb, 0xe4, 0xde, 0xfb, 0xeb, 0xe6, 0xff, 0xfc, 0xeb, 0xe6, 0xff, 0xfd, 0xec, 0xe4, 0xff, 0xff, 0xf0, 0xe3, 0xff, 0xff, 0xe9, 0xdd, 0xff, 0xf4, 0xd9, 0xca, 0xff, 0xe6, 0xc4, 0xb1, 0xff, 0xd9, 0xb2, 0x99, 0xff, 0xda, 0xb0, 0x95, 0xff, 0xe5, 0xba, 0xa2, 0xff, 0xe1, 0xb9, 0x9e, 0xff, 0xe6, 0xbf, 0xa1, 0xff, 0xec, 0xc1, 0xa7, 0xff, 0xe5, 0xbe, 0xa6, 0xff, 0xe2, 0xb9, 0xa3, 0xff, 0xe6, 0xbb, 0xa6, 0xff, 0xe2, 0xb9, 0xa4, 0xff, 0xda, 0xad, 0x99, 0xff, 0xea, 0xbc, 0xa6, 0xff, 0xef, 0xc4, 0xae, 0xff, 0xe5, 0xc3, 0xb5, 0xff, 0xf7, 0xdc, 0xde, 0xff, 0xf6, 0xdf, 0xe2, 0xff, 0xff, 0xf3, 0xe9, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0x61, 0x5e, 0x80, 0xff, 0x71, 0x6e, 0x9a, 0xff, 0xb1, 0xb1, 0xce, 0xff, 0x8b, 0x94, 0xb2, 0xff, 0x90, 0x99, 0xbd, 0xff, 0x94, 0x9b, 0xc1, 0xff, 0x92, 0x9e, 0xc2, 0xff, 0x88, 0x9b, 0xc0, 0xff, 0x84, 0x97, 0xbd, 0xff, 0x85, 0x96, 0xbd, 0xff, 0x85, 0x96, 0xbd, 0xff, 0x85, 0x96, 0xbd, 0xff, 0x84, 0x95, 0xbd, 0xff, 0x85, 0x96, 0xbd, 0xff, 0x85, 0x96, 0xbd, 0xff, 0x84, 0x96, 0xbb, 0xff, 0x86, 0x98, 0xbd, 0xff, 0x86, 0x98, 0xbd, 0xff, 0x86, 0x98, 0xbd, 0xff, 0x86, 0x98, 0xbd, 0xff, 0x85, 0x98, 0xbc, 0xff, 0x83, 0x95, 0xbb, 0xff, 0x81, 0x95, 0xba, 0xff, 0x82, 0x95, 0xba, 0xff, 0x83, 0x94, 0xba, 0xff, 0x85, 0x95, 0xba, 0xff, 0x82, 0x92, 0xb8, 0xff, 0x83, 0x94, 0xb9, 0xff, 0x88, 0x98, 0xbe, 0xff, 0x8e, 0x9e, 0xc3, 0xff, 0x94, 0xa4, 0xca, 0xff, 0x9d, 0xaf, 0xd3, 0xff, 0xa7, 0xb9, 0xde, 0xff, 0xb3, 0xc3, 0xe8, 0xff, 0xba, 0xcd, 0xf3, 0xff, 0xc4, 0xd8, 0xfd, 0xff, 0xcb, 0xde, 0xff, 0xff, 0xd1, 0xe2, 0xff, 0xff, 0xd2, 0xe3, 0xfb, 0xff, 0xd6, 0xe5, 0xf9, 0xff, 0xdb, 0xe9, 0xfb, 0xff, 0xdc, 0xed, 0xff, 0xff, 0xd9, 0xf5, 0xff, 0xff, 0xdf, 0xf6, 0xfe, 0xff, 0xef, 0xf6, 0xf9, 0xff, 0xfb, 0xe7, 0xeb, 0xff, 0xf5, 0xcc, 0xc9, 0xff, 0xe7, 0xb9, 0xa4, 0xff, 0xe7, 0xba, 0xa1, 0xff, 0xe2, 0xb6, 0xa3, 0xff, 0xe2, 0xb9, 0xa6, 0xff, 0xdd, 0xb7, 0x9f, 0xff, 0xbd, 0x98, 0x7e, 0xff, 0xc3, 0xa1, 0x86, 0xff, 0xd3, 0xaf, 0x98, 0xff, 0xc1, 0x9a, 0x83, 0xff, 0xcf, 0xa5, 0x8e, 0xff, 0xb9, 0x91, 0x7b, 0xff, 0xb4, 0x8c, 0x76, 0xff, 0xcd, 0xa4, 0x8d, 0xff, 0xcf, 0xa3, 0x8b, 0xff, 0xd5, 0xa8, 0x90, 0xff, 0xc7, 0x9d, 0x86, 0xff, 0xc5, 0x9b, 0x85, 0xde, 0xc1, 0x9a, 0x83, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xeb, 0xe1, 0x1a, 0xf9, 0xed, 0xe4, 0xd7, 0xfd, 0xec, 0xe2, 0xff, 0xff, 0xe8, 0xd7, 0xff, 0xf5, 0xd8, 0xc1, 0xff, 0xe0, 0xbd, 0xa6, 0xff, 0xcf, 0xac, 0x93, 0xff, 0xd1, 0xae, 0x91, 0xff, 0xde, 0xb6, 0x98, 0xff, 0xe8, 0xbd, 0xa0, 0xff, 0xe0, 0xb6, 0x98, 0xff, 0xe1, 0xb7, 0x9b, 0xff, 0xe4, 0xba, 0x9e, 0xff, 0xde, 0xb7, 0x9c, 0xff, 0xd8, 0xb1, 0x99, 0xff, 0xe0, 0xb8, 0xa2, 0xff, 0xe1, 0xb8, 0xa2, 0xff, 0xd3, 0xa9, 0x93, 0xff, 0xd3, 0xa8, 0x91, 0xff, 0xd1, 0xa8, 0x8b, 0xff, 0xe6, 0xba, 0xa1, 0xff, 0xf4, 0xca, 0xbe, 0xff, 0xfa, 0xdb, 0xd2, 0xff, 0xfd, 0xe9, 0xe1, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xae, 0xa8, 0xb7, 0xff, 0x36, 0x3b, 0x61, 0xff, 0x99, 0x9c, 0xc3, 0xff, 0xac, 0xab, 0xc7, 0xff, 0x92, 0x96, 0xb4, 0xff, 0x8c, 0x94, 0xb6, 0xff, 0x8d, 0x9a, 0xba, 0xff, 0x8c, 0x9c, 0xbd, 0xff, 0x88, 0x9b, 0xbf, 0xff, 0x84, 0x98, 0xbc, 0xff, 0x84, 0x97, 0xbb, 0xff, 0x84, 0x97, 0xbb, 0xff, 0x83, 0x98, 0xbc, 0xff, 0x82, 0x98, 0xbd, 0xff, 0x82, 0x98, 0xbc, 0xff, 0x81, 0x97, 0xbb, 0xff, 0x85, 0x98, 0xbd, 0xff, 0x86, 0x98, 0xbd, 0xff, 0x85, 0x9a, 0xbd, 0xff, 0x86, 0x99, 0xbd, 0xff, 0x86, 0x97, 0xbb, 0xff, 0x84, 0x96, 0xb9, 0xff, 0x80, 0x91, 0xb8, 0xff, 0x80, 0x91, 0xb9, 0xff, 0x81, 0x93, 0xbb, 0xff, 0x84, 0x94, 0xbb, 0xff, 0x87, 0x94, 0xbb, 0xff, 0x86, 0x93, 0xb9, 0xff, 0x86, 0x93, 0xbb, 0xff, 0x84, 0x94, 0xc0, 0xff, 0x88, 0x99, 0xc1, 0xff, 0x8d, 0xa0, 0xc3, 0xff, 0x94, 0xa6, 0xc9, 0xff, 0x9f, 0xb1, 0xd2, 0xff, 0xaf, 0xbf, 0xde, 0xff, 0xbb, 0xcb, 0xec, 0xff, 0xc5, 0xd7, 0xf7, 0xff, 0xcd, 0xde, 0xfd, 0xff, 0xce, 0xe1, 0xfd, 0xff, 0xd5, 0xe4, 0xfd, 0xff, 0xd5, 0xea, 0xff, 0xff, 0xe2, 0xef, 0xff, 0xff, 0xee, 0xf0, 0xff, 0xff, 0xea, 0xe7, 0xf3, 0xff, 0xf5, 0xe7, 0xe6, 0xff, 0xf5, 0xdb, 0xd0, 0xff, 0xe7, 0xbb, 0xad, 0xff, 0xe8, 0xb4, 0xa4, 0xff, 0xdb, 0xae, 0x95, 0xff, 0xd4, 0xab, 0x90, 0xff, 0xd8, 0xb0, 0x9e, 0xff, 0xd4, 0xad, 0x9b, 0xff, 0xe3, 0xba, 0xa4, 0xff, 0xd2, 0xa9, 0x91, 0xff, 0xbf, 0x97, 0x7e, 0xff, 0xd4, 0xae, 0x97, 0xff, 0xc8, 0xa2, 0x8b, 0xff, 0xa5, 0x7e, 0x67, 0xff, 0xbe, 0x95, 0x7f, 0xff, 0xd7, 0xae, 0x97, 0xff, 0xcd, 0xa3, 0x8b, 0xff, 0xc1, 0x93, 0x7a, 0xff, 0xb2, 0x82, 0x67, 0xff, 0xb6, 0x89, 0x6f, 0xd7, 0xb3, 0x84, 0x71, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xdc, 0xd0, 0x16, 0xed, 0xcd, 0xbc, 0xca, 0xde, 0xba, 0xa4, 0xff, 0xd5, 0xaa, 0x8f, 0xff, 0xd0, 0xa3, 0x87, 0xff, 0xd8, 0xac, 0x90, 0xff, 0xdf, 0xb6, 0x99, 0xff, 0xde, 0xb5, 0x98, 0xff, 0xd4, 0xa9, 0x8e, 0xff, 0xd0, 0xa6, 0x89, 0xff, 0xe0, 0xb6, 0x9a, 0xff, 0xe4, 0xba, 0xa0, 0xff, 0xe0, 0xb7, 0x9e, 0xff, 0xde, 0xb6, 0x9f, 0xff, 0xda, 0xb3, 0x9e, 0xff, 0xd1, 0xa9, 0x93, 0xff, 0xc8, 0x9f, 0x87, 0xff, 0xc3, 0x9a, 0x81, 0xff, 0xa3, 0x7c, 0x61, 0xff, 0xb4, 0x89, 0x71, 0xff, 0xd9, 0xaf, 0x99, 0xff, 0xf4, 0xd2, 0xbd, 0xff, 0xff, 0xf6, 0xe9, 0xff, 0xf1, 0xdc, 0xe1, 0xff, 0x56, 0x48, 0x64, 0xff, 0x59, 0x57, 0x84, 0xff, 0xab, 0xae, 0xd7, 0xff, 0xa4, 0xa8, 0xc0, 0xff, 0x94, 0x9b, 0xb6, 0xff, 0x8e, 0x99, 0xb7, 0xff, 0x8c, 0x97, 0xb6, 0xff, 0x8c, 0x96, 0xb8, 0xff, 0x8c, 0x97, 0xbc, 0xff, 0x85, 0x95, 0xbb, 0xff, 0x81, 0x94, 0xba, 0xff, 0x84, 0x95, 0xbb, 0xff, 0x84, 0x95, 0xbb, 0xff, 0x82, 0x94, 0xb9, 0xff, 0x83, 0x95, 0xb9, 0xff, 0x82, 0x94, 0xb9, 0xff, 0x84, 0x95, 0xbd, 0xff, 0x86, 0x98, 0xbe, 0xff, 0x88, 0x9b, 0xbf, 0xff, 0x87, 0x97, 0xbc, 0xff, 0x86, 0x96, 0xba, 0xff, 0x84, 0x94, 0xb8, 0xff, 0x84, 0x94, 0xb8, 0xff, 0x86, 0x95, 0xb9, 0xff, 0x84, 0x94, 0xb8, 0xff, 0x87, 0x95, 0xb9, 0xff, 0x8a, 0x96, 0xba, 0xff, 0x8a, 0x97, 0xbb, 0xff, 0x8e, 0x98, 0xbc, 0xff, 0x94, 0x9b, 0xbd, 0xff, 0x93, 0x9e, 0xc2, 0xff, 0x92, 0xa2, 0xc7, 0xff, 0x97, 0xa7, 0xcd, 0xff, 0x9d, 0xaf, 0xd6, 0xff, 0xa4, 0xba, 0xe4, 0xff, 0xaf, 0xc7, 0xf5, 0xff, 0xbe, 0xd2, 0xfb, 0xff, 0xd0, 0xdc, 0xfc, 0xff, 0xd8, 0xe4, 0xfe, 0xff, 0xe7, 0xef, 0xff, 0xff, 0xeb, 0xf1, 0xfc, 0xff, 0xef, 0xe7, 0xee, 0xff, 0xf0, 0xd6, 0xd6, 0xff, 0xdc, 0xbb, 0xb2, 0xff, 0xd1, 0xab, 0x96, 0xff, 0xe2, 0xb6, 0xa2, 0xff, 0xe5, 0xb7, 0xa5, 0xff, 0xe2, 0xbd, 0xa9, 0xff, 0xe8, 0xc3, 0xad, 0xff, 0xce, 0xa5, 0x8d, 0xff, 0xdc, 0xb3, 0x9c, 0xff, 0xd6, 0xad, 0x97, 0xff, 0xc6, 0x9d, 0x88, 0xff, 0xda, 0xb1, 0x9c, 0xff, 0xdf, 0xb6, 0xa1, 0xff, 0xc2, 0x9a, 0x83, 0xff, 0xbf, 0x97, 0x80, 0xff, 0xb6, 0x8f, 0x78, 0xff, 0xcc, 0xa4, 0x8c, 0xff, 0xdc, 0xb2, 0x99, 0xff, 0xbd, 0x92, 0x78, 0xff, 0xa1, 0x73, 0x57, 0xff, 0xaf, 0x7f, 0x63, 0xca, 0xc5, 0x96, 0x73, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xa2, 0x73, 0x0b, 0xc0, 0x93, 0x77, 0xaf, 0xd1, 0x9d, 0x83, 0xff, 0xcc, 0x9a, 0x7e, 0xff, 0xce, 0xa1, 0x85, 0xff, 0xdb, 0xb1, 0x98, 0xff, 0xd6, 0xae, 0x95, 0xff, 0xca, 0xa1, 0x88, 0xff, 0xd9, 0xb1, 0x97, 0xff, 0xe3, 0xba, 0xa0, 0xff, 0xe2, 0xb9, 0xa0, 0xff, 0xe1, 0xba, 0xa2, 0xff, 0xe1, 0xba, 0xa4, 0xff, 0xd4, 0xad, 0x98, 0xff, 0xc3, 0x9a, 0x84, 0xff, 0xb9, 0x8f, 0x78, 0xff, 0xac, 0x85, 0x6d, 0xff, 0xaa, 0x80, 0x6c, 0xff, 0xbb, 0x8e, 0x76, 0xff, 0xc8, 0x9b, 0x7b, 0xff, 0xd0, 0xa8, 0x8a, 0xff, 0xe5, 0xc6, 0xb4, 0xff, 0xc3, 0xa8, 0xa6, 0xff, 0x78, 0x5e, 0x75, 0xff, 0x9b, 0x89, 0xb5, 0xff, 0xad, 0xae, 0xd1, 0xff, 0x9d, 0xa8, 0xc0, 0xff, 0x97, 0x9f, 0xba, 0xff, 0x94, 0x9b, 0xb9, 0xff, 0x8f, 0x96, 0xb8, 0xff, 0x8b, 0x92, 0xb7, 0xff, 0x89, 0x91, 0xba, 0xff, 0x83, 0x8f, 0xb8, 0xff, 0x81, 0x8f, 0xb6, 0xff, 0x83, 0x90, 0xb7, 0xff, 0x83, 0x91, 0xb8, 0xff, 0x82, 0x90, 0xb9, 0xff, 0x83, 0x91, 0xb9, 0xff, 0x82, 0x90, 0xb8, 0xff, 0x85, 0x91, 0xbc, 0xff, 0x85, 0x91, 0xbb, 0xff, 0x85, 0x91, 0xb8, 0xff, 0x86, 0x93, 0xba, 0xff, 0x87, 0x94, 0xbc, 0xff, 0x83, 0x91, 0xb9, 0xff, 0x87, 0x94, 0xba, 0xff, 0x86, 0x92, 0xb6, 0xff, 0x88, 0x94, 0xb9, 0xff, 0x8e, 0x98, 0xbe, 0xff, 0x8c, 0x96, 0xbc, 0xff, 0x8d, 0x98, 0xbf, 0xff, 0x91, 0x9a, 0xbf, 0xff, 0x98, 0x9f, 0xc1, 0xff, 0x9c, 0xa6, 0xc9, 0xff, 0x9d, 0xab, 0xd1, 0xff, 0xa3, 0xaf, 0xd9, 0xff, 0xa8, 0xb5, 0xdf, 0xff, 0xae, 0xbf, 0xed, 0xff, 0xba, 0xce, 0xfd, 0xff, 0xce, 0xde, 0xff, 0xff, 0xe1, 0xe7, 0xff, 0xff, 0xec, 0xeb, 0xfc, 0xff, 0xf5, 0xe6, 0xea, 0xff, 0xe8, 0xd6, 0xce, 0xff, 0xe2, 0xbf, 0xac, 0xff, 0xca, 0x9e, 0x85, 0xff, 0xcd, 0xa1, 0x87, 0xff, 0xc2, 0x94, 0x78, 0xff, 0xe4, 0xbb, 0xa0, 0xff, 0xea, 0xc4, 0xb6, 0xff, 0xcf, 0xa9, 0x9a, 0xff, 0xd2, 0xa6, 0x8c, 0xff, 0xe3, 0xb5, 0x9b, 0xff, 0xda, 0xb2, 0x99, 0xff, 0xcb, 0xa5, 0x8e, 0xff, 0xcb, 0xa5, 0x91, 0xff, 0xc4, 0x9e, 0x8a, 0xff, 0xb6, 0x90, 0x7b, 0xff, 0x9e, 0x75, 0x5d, 0xff, 0xb3, 0x89, 0x72, 0xff, 0xce, 0xa5, 0x8e, 0xff, 0xd1, 0xa9, 0x90, 0xff, 0xc1, 0x96, 0x7c, 0xff, 0xb2, 0x86, 0x6a, 0xff, 0x9c, 0x6e, 0x52, 0xb0, 0xa2, 0x73, 0x5c, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0xc9, 0x9d, 0x80, 0x8b, 0xcb, 0x9f, 0x84, 0xff, 0xcf, 0xa6, 0x89, 0xff, 0xd5, 0xae, 0x93, 0xff, 0xde, 0xb6, 0x9e, 0xff, 0xdc, 0xb2, 0x9a, 0xff, 0xe1, 0xb8, 0xa0, 0xff, 0xdd, 0xb4, 0x9c, 0xff, 0xda, 0xb0, 0x99, 0xff, 0xd3, 0xab, 0x95, 0xff, 0xce, 0xa6, 0x90, 0xff, 0xcb, 0xa3, 0x8c, 0xff, 0xcc, 0xa4, 0x8c, 0xff, 0xb9, 0x91, 0x78, 0xff, 0xb1, 0x88, 0x71, 0xff, 0xc1, 0x99, 0x83, 0xff, 0xc3, 0x98, 0x80, 0xff, 0xb7, 0x87, 0x69, 0xff, 0xb1, 0x85, 0x66, 0xff, 0xbb, 0x98, 0x7f, 0xff, 0xcb, 0xa8, 0x9a, 0xff, 0xc6, 0xa5, 0xa2, 0xff, 0xc8, 0xb1, 0xb9, 0xff, 0xbe, 0xb3, 0xc7, 0xff, 0xa7, 0xa5, 0xbc, 0xff, 0xa1, 0xa1, 0xbc, 0xff, 0x99, 0x9b, 0xb9, 0xff, 0x8f, 0x96, 0xb8, 0xff, 0x85, 0x92, 0xb9, 0xff, 0x7d, 0x8d, 0xb4, 0xff, 0x7f, 0x8c, 0xaf, 0xff, 0x7f, 0x8c, 0xae, 0xff, 0x7e, 0x8c, 0xaf, 0xff, 0x7d, 0x8d, 0xb1, 0xff, 0x7b, 0x8d, 0xb2, 0xff, 0x7b, 0x8d, 0xb3, 0xff, 0x7d, 0x8e, 0xb4, 0xff, 0x82, 0x8e, 0xb7, 0xff, 0x81, 0x8e, 0xb7, 0xff, 0x82, 0x91, 0xb7, 0xff, 0x85, 0x93, 0xba, 0xff, 0x87, 0x95, 0xbc, 0xff, 0x86, 0x94, 0xba, 0xff, 0x87, 0x93, 0xb9, 0xff, 0x89, 0x93, 0xb9, 0xff, 0x89, 0x94, 0xba, 0xff, 0x8b, 0x96, 0xbd, 0xff, 0x8f, 0x96, 0xc0, 0xff, 0x91, 0x96, 0xc0, 0xff, 0x8d, 0x99, 0xc2, 0xff, 0x8f, 0x9e, 0xc8, 0xff, 0xa3, 0xaf, 0xd7, 0xff, 0xb4, 0xbd, 0xe3, 0xff, 0xbd, 0xc4, 0xe7, 0xff, 0xc8, 0xcb, 0xf0, 0xff, 0xd9, 0xd9, 0xf5, 0xff, 0xe7, 0xe1, 0xf2, 0xff, 0xe9, 0xdc, 0xe6, 0xff, 0xea, 0xd8, 0xda, 0xff, 0xdd, 0xc4, 0xbf, 0xff, 0xd0, 0xae, 0xa3, 0xff, 0xc9, 0xa5, 0x91, 0xff, 0xc9, 0x9e, 0x85, 0xff, 0xc3, 0x98, 0x83, 0xff, 0xcb, 0xa0, 0x8a, 0xff, 0xd4, 0xa8, 0x8f, 0xff, 0xda, 0xb2, 0x98, 0xff, 0xd4, 0xad, 0x99, 0xff, 0xca, 0xa0, 0x8e, 0xff, 0xbb, 0x8f, 0x75, 0xff, 0xc7, 0x9b, 0x82, 0xff, 0xd7, 0xae, 0x97, 0xff, 0xcf, 0xaa, 0x96, 0xff, 0xdf, 0xbc, 0xa9, 0xff, 0xcb, 0xa6, 0x92, 0xff, 0x9d, 0x76, 0x60, 0xff, 0xaa, 0x81, 0x69, 0xff, 0xc3, 0x99, 0x80, 0xff, 0xcc, 0xa2, 0x88, 0xff, 0xd4, 0xa8, 0x8f, 0xff, 0xbd, 0x90, 0x75, 0xff, 0xbb, 0x8f, 0x71, 0x8b, 0xaa, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xa4, 0x86, 0x57, 0xd2, 0xae, 0x91, 0xf3, 0xda, 0xb4, 0x97, 0xff, 0xdb, 0xb3, 0x98, 0xff, 0xdd, 0xb4, 0x9b, 0xff, 0xd6, 0xae, 0x94, 0xff, 0xcb, 0xa2, 0x89, 0xff, 0xc8, 0x9f, 0x88, 0xff, 0xd0, 0xa6, 0x8f, 0xff, 0xcb, 0xa2, 0x8a, 0xff, 0xc6, 0x9e, 0x84, 0xff, 0xc2, 0x9a, 0x80, 0xff, 0xc0, 0x98, 0x7f, 0xff, 0xc6, 0x9d, 0x85, 0xff, 0xb0, 0x8a, 0x72, 0xff, 0xb7, 0x8f, 0x78, 0xff, 0xbc, 0x8a, 0x74, 0xff, 0xbc, 0x90, 0x77, 0xff, 0xcb, 0xa6, 0x8a, 0xff, 0xb6, 0x8d, 0x71, 0xff, 0xb0, 0x8b, 0x69, 0xff, 0xc6, 0xac, 0x8e, 0xff, 0xcd, 0xb4, 0xac, 0xff, 0xc3, 0xa5, 0xaf, 0xff, 0xb5, 0xa2, 0xb1, 0xff, 0xab, 0xa2, 0xb5, 0xff, 0x99, 0x9b, 0xb1, 0xff, 0x82, 0x8c, 0xaa, 0xff, 0x7e, 0x8b, 0xaa, 0xff, 0x83, 0x90, 0xa9, 0xff, 0x7e, 0x8c, 0xa5, 0xff, 0x78, 0x87, 0xa3, 0xff, 0x77, 0x88, 0xa5, 0xff, 0x7a, 0x8c, 0xa9, 0xff, 0x7b, 0x8b, 0xa9, 0xff, 0x7a, 0x8a, 0xab, 0xff, 0x7d, 0x8c, 0xb2, 0xff, 0x7d, 0x8e, 0xb2, 0xff, 0x80, 0x92, 0xb4, 0xff, 0x86, 0x95, 0xb5, 0xff, 0x8a, 0x97, 0xb6, 0xff, 0x8f, 0x9a, 0xb7, 0xff, 0x8e, 0x97, 0xb9, 0xff, 0x8e, 0x95, 0xbd, 0xff, 0x90, 0x95, 0xba, 0xff, 0x91, 0x96, 0xb8, 0xff, 0x95, 0x95, 0xb6, 0xff, 0x9b, 0x99, 0xba, 0xff, 0x9b, 0xa0, 0xbf, 0xff, 0xa2, 0xa9, 0xcc, 0xff, 0xbe, 0xbf, 0xdd, 0xff, 0xd6, 0xd0, 0xe5, 0xff, 0xd7, 0xcd, 0xdc, 0xff, 0xda, 0xcb, 0xd9, 0xff, 0xd5, 0xbd, 0xbc, 0xff, 0xcf, 0xaa, 0x9a, 0xff, 0xd7, 0xae, 0x9c, 0xff, 0xcc, 0xa4, 0x92, 0xff, 0xba, 0x91, 0x80, 0xff, 0xc1, 0x99, 0x87, 0xff, 0xbe, 0x97, 0x83, 0xff, 0xc5, 0xa0, 0x8d, 0xff, 0xd0, 0xaa, 0x9d, 0xff, 0xd6, 0xaf, 0x9c, 0xff, 0xd9, 0xb2, 0x9c, 0xff, 0xd1, 0xa8, 0x92, 0xff, 0xc5, 0x9b, 0x83, 0xff, 0xd0, 0xa8, 0x8f, 0xff, 0xc5, 0x9d, 0x86, 0xff, 0xb2, 0x89, 0x73, 0xff, 0xd6, 0xaf, 0x99, 0xff, 0xd0, 0xa9, 0x95, 0xff, 0xb9, 0x92, 0x7e, 0xff, 0xb2, 0x8a, 0x74, 0xff, 0xba, 0x90, 0x7a, 0xff, 0xcd, 0xa4, 0x8c, 0xff, 0xc4, 0x9a, 0x80, 0xff, 0xbe, 0x91, 0x75, 0xff, 0xba, 0x8d, 0x72, 0xf3, 0xb2, 0x83, 0x69, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xb1, 0x9a, 0x2b, 0xd4, 0xab, 0x8c, 0xd2, 0xc8, 0x9d, 0x80, 0xff, 0xc7, 0x9d, 0x81, 0xff, 0xd1, 0xa7, 0x8a, 0xff, 0xd1, 0xa8, 0x8e, 0xff, 0xca, 0xa2, 0x8a, 0xff, 0xd0, 0xa7, 0x8f, 0xff, 0xcf, 0xa6, 0x8d, 0xff, 0xba, 0x92, 0x79, 0xff, 0xaf, 0x87, 0x6e, 0xff, 0xc4, 0x9c, 0x82, 0xff, 0xbf, 0x97, 0x80, 0xff, 0xab, 0x87, 0x72, 0xff, 0xb1, 0x8a, 0x74, 0xff, 0xc4, 0x98, 0x83, 0xff, 0xbf, 0x97, 0x80, 0xff, 0xba, 0x95, 0x78, 0xff, 0xa5, 0x77, 0x5a, 0xff, 0xac, 0x7b, 0x61, 0xff, 0xb3, 0x89, 0x70, 0xff, 0xbc, 0x95, 0x7e, 0xff, 0xc4, 0x9a, 0x87, 0xff, 0xbc, 0x96, 0x8a, 0xff, 0xb4, 0x97, 0x90, 0xff, 0xa4, 0x90, 0x91, 0xff, 0xa3, 0x93, 0x97, 0xff, 0x99, 0x90, 0x9a, 0xff, 0x91, 0x91, 0xa7, 0xff, 0x88, 0x8b, 0xa6, 0xff, 0x81, 0x83, 0x9e, 0xff, 0x79, 0x7f, 0x9c, 0xff, 0x75, 0x80, 0x9f, 0xff, 0x75, 0x83, 0xa2, 0xff, 0x74, 0x84, 0xa5, 0xff, 0x7c, 0x89, 0xa9, 0xff, 0x82, 0x8d, 0xaa, 0xff, 0x84, 0x8e, 0xaa, 0xff, 0x8d, 0x8f, 0xb0, 0xff, 0x94, 0x92, 0xb4, 0xff, 0x98, 0x95, 0xb5, 0xff, 0x97, 0x95, 0xb4, 0xff, 0x9c, 0x9a, 0xb6, 0xff, 0x9f, 0x9a, 0xb1, 0xff, 0xa8, 0x9d, 0xb0, 0xff, 0xb6, 0xa8, 0xb6, 0xff, 0xb5, 0xa4, 0xae, 0xff, 0xc1, 0xa7, 0xae, 0xff, 0xca, 0xaf, 0xaf, 0xff, 0xc2, 0xa3, 0x9f, 0xff, 0xc3, 0xa1, 0x97, 0xff, 0xba, 0x97, 0x89, 0xff, 0xbd, 0x9c, 0x88, 0xff, 0xaf, 0x87, 0x6e, 0xff, 0xa1, 0x74, 0x58, 0xff, 0xb6, 0x8a, 0x6d, 0xff, 0xbb, 0x90, 0x76, 0xff, 0xbe, 0x94, 0x7c, 0xff, 0xca, 0xa1, 0x8a, 0xff, 0xb8, 0x8f, 0x7a, 0xff, 0xce, 0xa4, 0x90, 0xff, 0xcb, 0x9e, 0x88, 0xff, 0xc3, 0x99, 0x83, 0xff, 0xcc, 0xa4, 0x8e, 0xff, 0xcb, 0xa2, 0x8c, 0xff, 0xc5, 0x9d, 0x86, 0xff, 0xcb, 0xa2, 0x8b, 0xff, 0xde, 0xb6, 0xa3, 0xff, 0xc0, 0x9a, 0x89, 0xff, 0xc6, 0xa0, 0x8a, 0xff, 0xcc, 0xa4, 0x8d, 0xff, 0xba, 0x90, 0x78, 0xff, 0xbc, 0x90, 0x76, 0xff, 0xc3, 0x96, 0x7c, 0xff, 0xad, 0x81, 0x66, 0xff, 0xb4, 0x87, 0x6b, 0xff, 0xbb, 0x8c, 0x6f, 0xd2, 0xa8, 0x79, 0x5c, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x9f, 0x7f, 0x08, 0xc9, 0x9e, 0x80, 0x8f, 0xc7, 0x9d, 0x82, 0xfe, 0xd1, 0xa6, 0x89, 0xff, 0xdb, 0xaf, 0x93, 0xff, 0xc7, 0x9b, 0x82, 0xff, 0xba, 0x91, 0x76, 0xff, 0xb9, 0x92, 0x77, 0xff, 0xab, 0x83, 0x6b, 0xff, 0xb6, 0x8e, 0x76, 0xff, 0xb7, 0x8e, 0x76, 0xff, 0xa2, 0x7b, 0x65, 0xff, 0xab, 0x87, 0x70, 0xff, 0xb4, 0x8d, 0x77, 0xff, 0xad, 0x85, 0x6c, 0xff, 0xb9, 0x92, 0x76, 0xff, 0xb6, 0x8d, 0x72, 0xff, 0xae, 0x7f, 0x67, 0xff, 0xa8, 0x76, 0x63, 0xff, 0xa2, 0x73, 0x5e, 0xff, 0xb6, 0x8b, 0x71, 0xff, 0xb4, 0x8b, 0x6c, 0xff, 0xa7, 0x7d, 0x62, 0xff, 0xb7, 0x8c, 0x75, 0xff, 0xbb, 0x92, 0x81, 0xff, 0xbd, 0x95, 0x85, 0xff, 0xb4, 0x91, 0x85, 0xff, 0xa7, 0x8e, 0x8d, 0xff, 0x9f, 0x8a, 0x8e, 0xff, 0xa2, 0x8c, 0x8f, 0xff, 0x9e, 0x89, 0x8d, 0xff, 0x93, 0x81, 0x86, 0xff, 0x91, 0x83, 0x88, 0xff, 0x95, 0x8a, 0x95, 0xff, 0x98, 0x90, 0x9e, 0xff, 0x9f, 0x94, 0xa2, 0xff, 0xa0, 0x92, 0x9f, 0xff, 0xa5, 0x92, 0x9f, 0xff, 0xad, 0x98, 0xa3, 0xff, 0xac, 0x97, 0xa0, 0xff, 0xb3, 0x9e, 0xa2, 0xff, 0xb7, 0xa0, 0x9f, 0xff, 0xb9, 0x9e, 0x9a, 0xff, 0xb9, 0x9a, 0x91, 0xff, 0xc1, 0xa0, 0x96, 0xff, 0xbb, 0x99, 0x8b, 0xff, 0xb5, 0x8a, 0x79, 0xff, 0xbf, 0x90, 0x76, 0xff, 0xa6, 0x78, 0x5e, 0xff, 0xa9, 0x79, 0x62, 0xff, 0xbe, 0x8d, 0x73, 0xff, 0xb7, 0x8a, 0x6e, 0xff, 0xbc, 0x91, 0x78, 0xff, 0xa5, 0x7b, 0x64, 0xff, 0xae, 0x84, 0x6e, 0xff, 0xc0, 0x92, 0x7c, 0xff, 0xcb, 0xa0, 0x8a, 0xff, 0xc4, 0x9e, 0x88, 0xff, 0xbc, 0x94, 0x7c, 0xff, 0xbb, 0x8f, 0x77, 0xff, 0xc6, 0x98, 0x7e, 0xff, 0xd1, 0xa4, 0x8a, 0xff, 0xc2, 0x96, 0x7a, 0xff, 0xce, 0xa3, 0x8a, 0xff, 0xc7, 0x9c, 0x83, 0xff, 0xbe, 0x92, 0x78, 0xff, 0xd7, 0xb1, 0x9c, 0xff, 0xc6, 0xa2, 0x8f, 0xff, 0xa3, 0x7c, 0x66, 0xff, 0xa8, 0x81, 0x69, 0xff, 0xc7, 0x9d, 0x84, 0xff, 0xe9, 0xbf, 0xa6, 0xff, 0xc2, 0x99, 0x7f, 0xff, 0xa6, 0x7f, 0x66, 0xfe, 0xb5, 0x8c, 0x70, 0x8f, 0x9f, 0x7f, 0x5f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x9a, 0x83, 0x42, 0xc8, 0x98, 0x7d, 0xdb, 0xcf, 0x9d, 0x81, 0xff, 0xcc, 0x9d, 0x80, 0xff, 0xbb, 0x91, 0x74, 0xff, 0xb1, 0x8b, 0x6d, 0xff, 0xb6, 0x8f, 0x75, 0xff, 0xbd, 0x95, 0x7d, 0xff, 0xb6, 0x8d, 0x77, 0xff, 0xb0, 0x8a, 0x72, 0xff, 0xa8, 0x81, 0x69, 0xff, 0xa6, 0x7d, 0x67, 0xff, 0xa3, 0x79, 0x5f, 0xff, 0xb1, 0x85, 0x69, 0xff, 0xb2, 0x86, 0x6b, 0xff, 0xac, 0x81, 0x67, 0xff, 0xa1, 0x75, 0x5e, 0xff, 0xa6, 0x7d, 0x64, 0xff, 0xae, 0x85, 0x6d, 0xff, 0x9e, 0x76, 0x5d, 0xff, 0xa1, 0x78, 0x5e, 0xff, 0xb9, 0x8d, 0x73, 0xff, 0xbd, 0x91, 0x77, 0xff, 0xc2, 0x99, 0x7f, 0xff, 0xbc, 0x94, 0x79, 0xff, 0xaf, 0x84, 0x67, 0xff, 0xae, 0x7f, 0x64, 0xff, 0xc0, 0x93, 0x79, 0xff, 0xc8, 0x98, 0x80, 0xff, 0xbf, 0x8e, 0x77, 0xff, 0xc3, 0x96, 0x7f, 0xff, 0xc2, 0x97, 0x89, 0xff, 0xb4, 0x90, 0x87, 0xff, 0xb8, 0x93, 0x88, 0xff, 0xc3, 0x9b, 0x8e, 0xff, 0xb3, 0x89, 0x7a, 0xff, 0xbb, 0x91, 0x7f, 0xff, 0xb1, 0x87, 0x71, 0xff, 0xc2, 0x98, 0x7f, 0xff, 0xbb, 0x8d, 0x73, 0xff, 0xc1, 0x91, 0x74, 0xff, 0xb5, 0x85, 0x66, 0xff, 0xa3, 0x73, 0x56, 0xff, 0xa7, 0x79, 0x5c, 0xff, 0x89, 0x5e, 0x42, 0xff, 0xa4, 0x7d, 0x61, 0xff, 0x9f, 0x76, 0x5a, 0xff, 0xa9, 0x7b, 0x61, 0xff, 0xb7, 0x87, 0x6d, 0xff, 0xab, 0x7b, 0x63, 0xff, 0xb7, 0x8a, 0x74, 0xff, 0xb6, 0x8c, 0x74, 0xff, 0xc0, 0x97, 0x7f, 0xff, 0xce, 0xa5, 0x8e, 0xff, 0xbc, 0x93, 0x7e, 0xff, 0xb7, 0x90, 0x7a, 0xff, 0xcd, 0xa7, 0x91, 0xff, 0xc3, 0x9d, 0x87, 0xff, 0xbb, 0x93, 0x7e, 0xff, 0xbe, 0x95, 0x7d, 0xff, 0xc9, 0x9e, 0x82, 0xff, 0xdb, 0xb0, 0x94, 0xff, 0xd7, 0xac, 0x90, 0xff, 0xba, 0x8d, 0x71, 0xff, 0xac, 0x83, 0x6a, 0xff, 0xba, 0x94, 0x7c, 0xff, 0xcb, 0xa5, 0x8c, 0xff, 0xcc, 0xa5, 0x8d, 0xff, 0xd3, 0xac, 0x96, 0xff, 0xce, 0xaa, 0x95, 0xff, 0xc4, 0xa3, 0x8e, 0xdb, 0xd8, 0xb1, 0x9e, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xaa, 0x8d, 0x09, 0xcf, 0xa0, 0x84, 0x87, 0xc2, 0x97, 0x79, 0xf9, 0xc1, 0x98, 0x7a, 0xff, 0xb1, 0x88, 0x6a, 0xff, 0xaf, 0x85, 0x67, 0xff, 0xb5, 0x8b, 0x6e, 0xff, 0xb0, 0x85, 0x6b, 0xff, 0xa8, 0x7f, 0x67, 0xff, 0xb2, 0x88, 0x70, 0xff, 0xa7, 0x7a, 0x64, 0xff, 0xae, 0x82, 0x69, 0xff, 0xaa, 0x7f, 0x63, 0xff, 0xae, 0x84, 0x68, 0xff, 0xaa, 0x7e, 0x64, 0xff, 0x9b, 0x6f, 0x56, 0xff, 0xa0, 0x76, 0x5c, 0xff, 0xaa, 0x82, 0x67, 0xff, 0xa1, 0x78, 0x5f, 0xff, 0xa5, 0x79, 0x62, 0xff, 0xa3, 0x75, 0x5e, 0xff, 0xa6, 0x7d, 0x61, 0xff, 0xc3, 0x9c, 0x7f, 0xff, 0xb0, 0x8b, 0x6d, 0xff, 0x9e, 0x78, 0x5d, 0xff, 0xa2, 0x79, 0x60, 0xff, 0xb6, 0x8c, 0x75, 0xff, 0xc0, 0x97, 0x7f, 0xff, 0xb6, 0x8c, 0x75, 0xff, 0xb8, 0x8f, 0x7b, 0xff, 0xad, 0x85, 0x6f, 0xff, 0xa9, 0x7f, 0x67, 0xff, 0xb1, 0x84, 0x6b, 0xff, 0xb3, 0x84, 0x6a, 0xff, 0xa6, 0x76, 0x59, 0xff, 0xc0, 0x90, 0x72, 0xff, 0xa4, 0x71, 0x52, 0xff, 0xa5, 0x75, 0x59, 0xff, 0xa4, 0x76, 0x5c, 0xff, 0xb3, 0x83, 0x63, 0xff, 0xaf, 0x7c, 0x5c, 0xff, 0xa3, 0x72, 0x54, 0xff, 0x97, 0x67, 0x49, 0xff, 0x87, 0x58, 0x3a, 0xff, 0xb7, 0x8a, 0x6d, 0xff, 0xa3, 0x76, 0x5a, 0xff, 0x92, 0x65, 0x49, 0xff, 0x93, 0x65, 0x49, 0xff, 0xa8, 0x7a, 0x5f, 0xff, 0xbe, 0x91, 0x7a, 0xff, 0xbc, 0x92, 0x7a, 0xff, 0xbe, 0x94, 0x7d, 0xff, 0xd4, 0xab, 0x94, 0xff, 0xb9, 0x91, 0x7b, 0xff, 0xaa, 0x83, 0x6d, 0xff, 0xbe, 0x98, 0x82, 0xff, 0xcb, 0xa4, 0x8f, 0xff, 0xb7, 0x8d, 0x78, 0xff, 0xb4, 0x8c, 0x74, 0xff, 0xb3, 0x8c, 0x74, 0xff, 0xbb, 0x91, 0x7a, 0xff, 0xbf, 0x94, 0x7c, 0xff, 0xb3, 0x89, 0x71, 0xff, 0xcf, 0xa8, 0x90, 0xff, 0xd0, 0xab, 0x93, 0xff, 0xd2, 0xac, 0x94, 0xff, 0xe7, 0xc2, 0xaa, 0xff, 0xe0, 0xbb, 0xa5, 0xf9, 0xb7, 0x92, 0x7b, 0x88, 0xaa, 0x8d, 0x71, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x97, 0x7c, 0x25, 0xb6, 0x8b, 0x6f, 0xb7, 0xa9, 0x7c, 0x5f, 0xff, 0xa5, 0x79, 0x59, 0xff, 0xb2, 0x85, 0x67, 0xff, 0xae, 0x81, 0x64, 0xff, 0xa9, 0x7d, 0x63, 0xff, 0xae, 0x82, 0x6a, 0xff, 0xb8, 0x8a, 0x71, 0xff, 0xad, 0x80, 0x66, 0xff, 0xa0, 0x75, 0x5a, 0xff, 0xa0, 0x75, 0x5a, 0xff, 0x95, 0x6a, 0x4f, 0xff, 0x98, 0x6d, 0x51, 0xff, 0x97, 0x6e, 0x52, 0xff, 0xa1, 0x7a, 0x5e, 0xff, 0xa6, 0x7b, 0x62, 0xff, 0xa3, 0x76, 0x5e, 0xff, 0x98, 0x6a, 0x51, 0xff, 0xac, 0x7f, 0x66, 0xff, 0xba, 0x8f, 0x76, 0xff, 0xad, 0x83, 0x6a, 0xff, 0xaf, 0x87, 0x6d, 0xff, 0xa5, 0x7d, 0x65, 0xff, 0xa5, 0x7d, 0x66, 0xff, 0x9e, 0x78, 0x61, 0xff, 0x8e, 0x67, 0x52, 0xff, 0xa2, 0x78, 0x65, 0xff, 0xb3, 0x8a, 0x71, 0xff, 0xa6, 0x7b, 0x61, 0xff, 0xa0, 0x73, 0x58, 0xff, 0x9f, 0x6f, 0x52, 0xff, 0x9e, 0x6f, 0x4f, 0xff, 0xb6, 0x87, 0x66, 0xff, 0x9a, 0x69, 0x49, 0xff, 0x90, 0x61, 0x45, 0xff, 0x8b, 0x5e, 0x42, 0xff, 0xac, 0x7c, 0x5b, 0xff, 0xa7, 0x76, 0x55, 0xff, 0x98, 0x68, 0x4b, 0xff, 0x93, 0x64, 0x47, 0xff, 0x92, 0x63, 0x46, 0xff, 0xb8, 0x86, 0x68, 0xff, 0xa4, 0x74, 0x56, 0xff, 0x94, 0x67, 0x48, 0xff, 0xa9, 0x7c, 0x5f, 0xff, 0xbb, 0x8e, 0x72, 0xff, 0xbe, 0x92, 0x78, 0xff, 0xb8, 0x8e, 0x75, 0xff, 0x93, 0x69, 0x51, 0xff, 0xac, 0x82, 0x6b, 0xff, 0xb7, 0x8f, 0x79, 0xff, 0xb9, 0x92, 0x7c, 0xff, 0xaf, 0x88, 0x72, 0xff, 0xa6, 0x7f, 0x68, 0xff, 0x9f, 0x76, 0x5f, 0xff, 0xa5, 0x7d, 0x67, 0xff, 0x9f, 0x7a, 0x64, 0xff, 0xbf, 0x99, 0x83, 0xff, 0xcb, 0xa3, 0x8e, 0xff, 0xcf, 0xa7, 0x93, 0xff, 0xe3, 0xbc, 0xa6, 0xff, 0xd0, 0xab, 0x92, 0xff, 0xb0, 0x89, 0x71, 0xff, 0xb6, 0x92, 0x7a, 0xb7, 0xae, 0x8c, 0x78, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x7f, 0x62, 0x46, 0xae, 0x82, 0x61, 0xca, 0xa9, 0x7d, 0x5e, 0xff, 0xb2, 0x86, 0x68, 0xff, 0x9d, 0x71, 0x54, 0xff, 0xa1, 0x76, 0x59, 0xff, 0xb7, 0x8c, 0x6f, 0xff, 0xab, 0x80, 0x65, 0xff, 0xa6, 0x7b, 0x61, 0xff, 0x96, 0x6b, 0x50, 0xff, 0xa1, 0x76, 0x5b, 0xff, 0xad, 0x83, 0x67, 0xff, 0x9c, 0x71, 0x56, 0xff, 0x9b, 0x70, 0x55, 0xff, 0xa1, 0x77, 0x5c, 0xff, 0xa4, 0x78, 0x5d, 0xff, 0x9d, 0x6f, 0x53, 0xff, 0xa1, 0x73, 0x59, 0xff, 0x9b, 0x6e, 0x54, 0xff, 0xa1, 0x74, 0x59, 0xff, 0x90, 0x63, 0x49, 0xff, 0xa4, 0x78, 0x5f, 0xff, 0x9f, 0x77, 0x5c, 0xff, 0xa0, 0x7a, 0x61, 0xff, 0x96, 0x6c, 0x57, 0xff, 0xa9, 0x78, 0x64, 0xff, 0x99, 0x6c, 0x56, 0xff, 0xa7, 0x80, 0x65, 0xff, 0x9d, 0x73, 0x59, 0xff, 0xa4, 0x78, 0x5f, 0xff, 0x98, 0x6b, 0x4e, 0xff, 0xa8, 0x7a, 0x5b, 0xff, 0x94, 0x66, 0x48, 0xff, 0xa3, 0x75, 0x58, 0xff, 0x93, 0x64, 0x47, 0xff, 0xac, 0x7d, 0x5d, 0xff, 0xae, 0x7f, 0x5d, 0xff, 0x9d, 0x6e, 0x4f, 0xff, 0xac, 0x7c, 0x62, 0xff, 0x95, 0x67, 0x4a, 0xff, 0x9f, 0x6e, 0x51, 0xff, 0xa5, 0x75, 0x59, 0xff, 0xa4, 0x78, 0x5a, 0xff, 0xc1, 0x95, 0x7a, 0xff, 0xac, 0x7f, 0x64, 0xff, 0xa2, 0x74, 0x59, 0xff, 0x9c, 0x6f, 0x56, 0xff, 0x8b, 0x5f, 0x47, 0xff, 0xa2, 0x79, 0x60, 0xff, 0xc8, 0x9f, 0x86, 0xff, 0xb0, 0x85, 0x6f, 0xff, 0x81, 0x58, 0x41, 0xff, 0x7f, 0x57, 0x40, 0xff, 0xb4, 0x8e, 0x76, 0xff, 0xb8, 0x91, 0x7b, 0xff, 0xbf, 0x97, 0x82, 0xff, 0xd8, 0xb3, 0x9d, 0xff, 0xe7, 0xc2, 0xac, 0xff, 0xd6, 0xb1, 0x9b, 0xff, 0xb8, 0x93, 0x7c, 0xff, 0xb0, 0x8a, 0x72, 0xca, 0xb2, 0x8a, 0x70, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x73, 0x56, 0x4d, 0x98, 0x6c, 0x51, 0xcc, 0x8a, 0x60, 0x45, 0xff, 0xaf, 0x85, 0x6b, 0xff, 0xb0, 0x87, 0x6d, 0xff, 0xb3, 0x89, 0x6e, 0xff, 0xac, 0x81, 0x66, 0xff, 0xa2, 0x77, 0x5c, 0xff, 0xa1, 0x75, 0x5a, 0xff, 0x9a, 0x6e, 0x53, 0xff, 0x9c, 0x6f, 0x54, 0xff, 0x91, 0x64, 0x49, 0xff, 0x9f, 0x73, 0x58, 0xff, 0x96, 0x67, 0x4c, 0xff, 0x97, 0x67, 0x4b, 0xff, 0x96, 0x66, 0x4b, 0xff, 0x90, 0x61, 0x46, 0xff, 0x95, 0x68, 0x4c, 0xff, 0x8f, 0x60, 0x46, 0xff, 0x97, 0x67, 0x50, 0xff, 0x8e, 0x63, 0x4b, 0xff, 0x9a, 0x73, 0x5a, 0xff, 0x8c, 0x60, 0x4a, 0xff, 0x88, 0x56, 0x40, 0xff, 0x8d, 0x5d, 0x47, 0xff, 0x8d, 0x63, 0x4b, 0xff, 0x8d, 0x61, 0x4a, 0xff, 0xa8, 0x7a, 0x63, 0xff, 0x96, 0x68, 0x4d, 0xff, 0x93, 0x65, 0x4a, 0xff, 0x82, 0x54, 0x39, 0xff, 0xae, 0x81, 0x66, 0xff, 0x99, 0x6a, 0x4f, 0xff, 0x9a, 0x6a, 0x4e, 0xff, 0xad, 0x7e, 0x5e, 0xff, 0x9b, 0x6d, 0x51, 0xff, 0xaa, 0x7d, 0x65, 0xff, 0x9f, 0x75, 0x5a, 0xff, 0xa6, 0x7b, 0x5e, 0xff, 0xab, 0x7f, 0x63, 0xff, 0x92, 0x66, 0x4a, 0xff, 0xac, 0x7e, 0x65, 0xff, 0x9f, 0x71, 0x5a, 0xff, 0x7d, 0x4f, 0x36, 0xff, 0x8d, 0x60, 0x47, 0xff, 0x95, 0x69, 0x51, 0xff, 0x93, 0x69, 0x50, 0xff, 0x9b, 0x72, 0x59, 0xff, 0xa1, 0x77, 0x60, 0xff, 0xaa, 0x80, 0x69, 0xff, 0xaf, 0x86, 0x70, 0xff, 0xca, 0xa3, 0x8e, 0xff, 0xd8, 0xb2, 0x9c, 0xff, 0xcd, 0xa7, 0x8f, 0xff, 0xc7, 0xa0, 0x86, 0xff, 0xbf, 0x98, 0x7e, 0xff, 0xc0, 0x99, 0x7f, 0xcc, 0xc0, 0x9b, 0x81, 0x4d, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x71, 0x5a, 0x41, 0xa7, 0x7f, 0x67, 0xb4, 0xa4, 0x7e, 0x65, 0xfe, 0x9b, 0x71, 0x58, 0xff, 0xa5, 0x79, 0x5e, 0xff, 0xa7, 0x7d, 0x62, 0xff, 0xaa, 0x7e, 0x63, 0xff, 0xa7, 0x78, 0x5d, 0xff, 0xaf, 0x80, 0x65, 0xff, 0xb0, 0x82, 0x67, 0xff, 0xa0, 0x72, 0x57, 0xff, 0x9a, 0x6a, 0x4f, 0xff, 0x9c, 0x6a, 0x50, 0xff, 0x97, 0x67, 0x4c, 0xff, 0xa1, 0x72, 0x57, 0xff, 0x9d, 0x6e, 0x52, 0xff, 0xa0, 0x70, 0x56, 0xff, 0x9a, 0x68, 0x51, 0xff, 0x90, 0x62, 0x4a, 0xff, 0x9d, 0x73, 0x5a, 0xff, 0x78, 0x4b, 0x33, 0xff, 0x7c, 0x48, 0x32, 0xff, 0x93, 0x60, 0x49, 0xff, 0xa3, 0x72, 0x56, 0xff, 0x91, 0x5f, 0x42, 0xff, 0xa3, 0x6e, 0x52, 0xff, 0x90, 0x5d, 0x40, 0xff, 0x9a, 0x69, 0x4b, 0xff, 0x8c, 0x59, 0x3b, 0xff, 0xb3, 0x84, 0x68, 0xff, 0xa7, 0x7c, 0x61, 0xff, 0x9b, 0x6c, 0x50, 0xff, 0xad, 0x80, 0x63, 0xff, 0x82, 0x58, 0x3f, 0xff, 0x99, 0x6e, 0x5a, 0xff, 0xa7, 0x7f, 0x67, 0xff, 0x9f, 0x79, 0x5d, 0xff, 0xab, 0x82, 0x66, 0xff, 0x8d, 0x61, 0x46, 0xff, 0x8d, 0x5e, 0x47, 0xff, 0x96, 0x67, 0x50, 0xff, 0x8a, 0x5b, 0x44, 0xff, 0x99, 0x6b, 0x54, 0xff, 0x97, 0x6b, 0x53, 0xff, 0x8f, 0x65, 0x4c, 0xff, 0x92, 0x68, 0x50, 0xff, 0xab, 0x80, 0x69, 0xff, 0xd5, 0xab, 0x94, 0xff, 0xd9, 0xb0, 0x9a, 0xff, 0xb7, 0x8f, 0x7d, 0xff, 0xb5, 0x8f, 0x79, 0xff, 0xd1, 0xac, 0x91, 0xfe, 0xbc, 0x93, 0x77, 0xb4, 0x91, 0x69, 0x4e, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x74, 0x57, 0x23, 0xa6, 0x7b, 0x5b, 0x88, 0xa2, 0x7b, 0x5c, 0xe6, 0x9c, 0x70, 0x53, 0xff, 0xbb, 0x8b, 0x71, 0xff, 0xa0, 0x70, 0x55, 0xff, 0x99, 0x69, 0x4e, 0xff, 0x9b, 0x6b, 0x50, 0xff, 0x9d, 0x6e, 0x52, 0xff, 0xaa, 0x7c, 0x63, 0xff, 0xa0, 0x73, 0x5d, 0xff, 0x97, 0x6b, 0x54, 0xff, 0x92, 0x65, 0x4e, 0xff, 0x9b, 0x6c, 0x53, 0xff, 0x91, 0x62, 0x4a, 0xff, 0x94, 0x66, 0x50, 0xff, 0x87, 0x58, 0x42, 0xff, 0x9d, 0x6f, 0x59, 0xff, 0x8c, 0x5d, 0x47, 0xff, 0x95, 0x64, 0x4d, 0xff, 0x7d, 0x4c, 0x32, 0xff, 0x9e, 0x6c, 0x4f, 0xff, 0x93, 0x62, 0x44, 0xff, 0x9c, 0x6a, 0x4d, 0xff, 0x8f, 0x5d, 0x40, 0xff, 0xa7, 0x76, 0x58, 0xff, 0x99, 0x67, 0x49, 0xff, 0xa4, 0x76, 0x57, 0xff, 0xa7, 0x7c, 0x5d, 0xff, 0x8a, 0x5c, 0x40, 0xff, 0xaa, 0x7d, 0x62, 0xff, 0x98, 0x6f, 0x55, 0xff, 0x90, 0x67, 0x4d, 0xff, 0x9c, 0x73, 0x5a, 0xff, 0x91, 0x68, 0x4f, 0xff, 0x9b, 0x70, 0x55, 0xff, 0x81, 0x52, 0x37, 0xff, 0x7f, 0x51, 0x35, 0xff, 0x94, 0x64, 0x46, 0xff, 0x9d, 0x6b, 0x50, 0xff, 0xaf, 0x7e, 0x68, 0xff, 0xc3, 0x96, 0x7f, 0xff, 0xc9, 0xa1, 0x89, 0xff, 0xc0, 0x9a, 0x81, 0xff, 0xcb, 0xa4, 0x8b, 0xff, 0xc2, 0x97, 0x7f, 0xff, 0x9b, 0x6e, 0x57, 0xff, 0xa0, 0x73, 0x5d, 0xe7, 0xbd, 0x94, 0x7d, 0x88, 0xb6, 0x8a, 0x74, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x66, 0x05, 0x9e, 0x71, 0x52, 0x4a, 0x91, 0x62, 0x47, 0xa0, 0x87, 0x57, 0x3c, 0xef, 0x9c, 0x6e, 0x53, 0xff, 0x9c, 0x6d, 0x52, 0xff, 0x7f, 0x51, 0x34, 0xff, 0x97, 0x6a, 0x50, 0xff, 0x8d, 0x62, 0x4c, 0xff, 0x8d, 0x61, 0x4b, 0xff, 0x91, 0x62, 0x4b, 0xff, 0x8a, 0x5a, 0x40, 0xff, 0x8b, 0x5b, 0x43, 0xff, 0x9a, 0x6b, 0x55, 0xff, 0x79, 0x4a, 0x32, 0xff, 0x8d, 0x5d, 0x46, 0xff, 0x98, 0x66, 0x4f, 0xff, 0x8e, 0x5c, 0x45, 0xff, 0x87, 0x55, 0x3d, 0xff, 0x9f, 0x6f, 0x55, 0xff, 0xa6, 0x76, 0x5c, 0xff, 0xc2, 0x92, 0x78, 0xff, 0xb1, 0x81, 0x66, 0xff, 0xb1, 0x81, 0x66, 0xff, 0xb2, 0x83, 0x68, 0xff, 0xb3, 0x82, 0x66, 0xff, 0xb3, 0x81, 0x64, 0xff, 0x88, 0x55, 0x3a, 0xff, 0x93, 0x62, 0x47, 0xff, 0x94, 0x65, 0x49, 0xff, 0x91, 0x62, 0x45, 0xff, 0x98, 0x69, 0x4e, 0xff, 0x8c, 0x5e, 0x47, 0xff, 0x9a, 0x6c, 0x53, 0xff, 0x9b, 0x6d, 0x51, 0xff, 0xae, 0x82, 0x65, 0xff, 0xb0, 0x82, 0x61, 0xff, 0x9e, 0x70, 0x54, 0xff, 0x91, 0x68, 0x51, 0xff, 0xaa, 0x87, 0x6f, 0xff, 0xbf, 0x9e, 0x86, 0xff, 0xa7, 0x87, 0x6f, 0xff, 0x8d, 0x6c, 0x53, 0xef, 0x9d, 0x75, 0x5e, 0xa0, 0x90, 0x67, 0x4f, 0x4a, 0x99, 0x66, 0x66, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x91, 0x6d, 0x07, 0x99, 0x6d, 0x53, 0x46, 0x98, 0x6b, 0x50, 0x8e, 0x99, 0x6b, 0x4b, 0xd7, 0xa1, 0x75, 0x58, 0xff, 0x8d, 0x62, 0x49, 0xff, 0xa1, 0x73, 0x5b, 0xff, 0x93, 0x62, 0x49, 0xff, 0x8a, 0x5b, 0x3f, 0xff, 0x7d, 0x4d, 0x31, 0xff, 0x91, 0x5f, 0x44, 0xff, 0x8a, 0x5a, 0x3f, 0xff, 0x8c, 0x58, 0x3d, 0xff, 0x94, 0x5d, 0x42, 0xff, 0xa1, 0x6b, 0x54, 0xff, 0xab, 0x77, 0x61, 0xff, 0xa9, 0x79, 0x63, 0xff, 0xa8, 0x78, 0x62, 0xff, 0xab, 0x7b, 0x65, 0xff, 0x8c, 0x5c, 0x45, 0xff, 0x85, 0x56, 0x3d, 0xff, 0x95, 0x67, 0x50, 0xff, 0x8b, 0x59, 0x43, 0xff, 0x94, 0x5f, 0x47, 0xff, 0x87, 0x55, 0x3a, 0xff, 0x91, 0x5f, 0x43, 0xff, 0x95, 0x64, 0x49, 0xff, 0xab, 0x7a, 0x5e, 0xff, 0xb6, 0x85, 0x6a, 0xff, 0xbb, 0x8a, 0x73, 0xff, 0xb6, 0x88, 0x6d, 0xff, 0xb4, 0x89, 0x6c, 0xff, 0xba, 0x91, 0x75, 0xff, 0xb6, 0x8c, 0x6e, 0xff, 0xb8, 0x93, 0x77, 0xff, 0xa4, 0x86, 0x6e, 0xff, 0x93, 0x75, 0x5e, 0xd7, 0x91, 0x74, 0x5d, 0x8e, 0xa7, 0x8a, 0x70, 0x46, 0x91, 0x6d, 0x48, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x71, 0x55, 0x1b, 0xa8, 0x7b, 0x63, 0x55, 0xb9, 0x8b, 0x72, 0x8f, 0xbe, 0x90, 0x72, 0xc2, 0xb0, 0x80, 0x63, 0xea, 0x9a, 0x69, 0x4c, 0xff, 0x9f, 0x6c, 0x4e, 0xff, 0x9e, 0x6d, 0x4e, 0xff, 0x9b, 0x68, 0x4a, 0xff, 0x9c, 0x65, 0x48, 0xff, 0xa2, 0x6b, 0x4f, 0xff, 0x7b, 0x48, 0x30, 0xff, 0x53, 0x24, 0x0f, 0xff, 0x64, 0x35, 0x20, 0xff, 0x60, 0x31, 0x1a, 0xff, 0x64, 0x34, 0x20, 0xff, 0x5c, 0x2c, 0x17, 0xff, 0x65, 0x35, 0x20, 0xff, 0x63, 0x35, 0x1d, 0xff, 0x7c, 0x4f, 0x35, 0xff, 0x9c, 0x6f, 0x55, 0xff, 0xb7, 0x8b, 0x6f, 0xff, 0xb1, 0x87, 0x67, 0xff, 0xb2, 0x86, 0x68, 0xff, 0xb3, 0x87, 0x6b, 0xff, 0x96, 0x68, 0x50, 0xff, 0x99, 0x6d, 0x54, 0xff, 0xae, 0x84, 0x69, 0xea, 0xa6, 0x7f, 0x66, 0xc2, 0x95, 0x6e, 0x53, 0x8f, 0xb1, 0x8d, 0x72, 0x55, 0xbc, 0x97, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x87, 0x69, 0x11, 0xb0, 0x81, 0x61, 0x37, 0xae, 0x80, 0x63, 0x5f, 0xad, 0x81, 0x62, 0x86, 0xa8, 0x77, 0x59, 0xa8, 0xb5, 0x84, 0x64, 0xc0, 0x9f, 0x71, 0x58, 0xd3, 0x85, 0x56, 0x41, 0xe6, 0x7d, 0x4f, 0x38, 0xee, 0x88, 0x59, 0x43, 0xf5, 0xa1, 0x73, 0x5e, 0xff, 0xa0, 0x72, 0x5c, 0xff, 0x96, 0x69, 0x52, 0xf5, 0xab, 0x7f, 0x65, 0xee, 0xa8, 0x7f, 0x62, 0xe6, 0xa9, 0x7d, 0x64, 0xd3, 0xa7, 0x7e, 0x60, 0xc0, 0x9f, 0x77, 0x56, 0xa8, 0x94, 0x6a, 0x4c, 0x86, 0xa1, 0x78, 0x5d, 0x5f, 0x8b, 0x5c, 0x45, 0x37, 0x78, 0x5a, 0x3c, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const lv_image_dsc_t img_multilang_avatar_5 = {
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .header.w = 128,
+    .header.h = 128,
+    .header.stride = 512,
+    .data = img_multilang_avatar_5_map,
+    .data_size = sizeof(img_multilang_avatar_5_map),
+};
+
+#endif
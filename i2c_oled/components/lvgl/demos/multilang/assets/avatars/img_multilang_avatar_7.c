@@ -0,0 +1,166 @@
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+#if LV_USE_DEMO_MULTILANG
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_7
+    #define LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_7
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_7 uint8_t
+img_multilang_avatar_7_map[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x5a, 0x4b, 0x11, 0x4e, 0x5c, 0x53, 0x37, 0x33, 0x43, 0x38, 0x5e, 0x37, 0x4a, 0x3c, 0x86, 0x45, 0x59, 0x4a, 0xa8, 0x31, 0x44, 0x36, 0xbf, 0x5b, 0x6d, 0x5d, 0xd2, 0x3d, 0x47, 0x35, 0xe5, 0x0d, 0x16, 0x08, 0xee, 0x04, 0x09, 0x03, 0xf2, 0x01, 0x03, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x00, 0x00, 0xf2, 0x04, 0x00, 0x00, 0xee, 0x08, 0x04, 0x04, 0xe5, 0x29, 0x2c, 0x24, 0xd2, 0x21, 0x24, 0x1c, 0xbf, 0x0f, 0x10, 0x0a, 0xa8, 0x07, 0x09, 0x05, 0x86, 0x10, 0x12, 0x10, 0x5e, 0x09, 0x09, 0x04, 0x37, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x3d, 0x33, 0x19, 0x09, 0x0f, 0x09, 0x55, 0x30, 0x37, 0x2e, 0x8f, 0x32, 0x3b, 0x30, 0xc1, 0x23, 0x2c, 0x24, 0xe9, 0x17, 0x25, 0x18, 0xff, 0x1b, 0x24, 0x1b, 0xff, 0x21, 0x2d, 0x22, 0xff, 0x33, 0x40, 0x35, 0xff, 0x33, 0x3f, 0x34, 0xff, 0x25, 0x30, 0x27, 0xff, 0x1e, 0x2a, 0x1e, 0xff, 0x1f, 0x25, 0x1b, 0xff, 0x08, 0x0d, 0x06, 0xff, 0x00, 0x01, 0x01, 0xff, 0x00, 0x02, 0x02, 0xff, 0x03, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x00, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x14, 0x15, 0x13, 0xff, 0x0d, 0x0e, 0x0c, 0xff, 0x0c, 0x0d, 0x0b, 0xff, 0x04, 0x05, 0x04, 0xff, 0x05, 0x06, 0x04, 0xff, 0x03, 0x03, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1b, 0x1d, 0x1a, 0xe9, 0x1a, 0x1f, 0x19, 0xc1, 0x00, 0x01, 0x00, 0x8f, 0x06, 0x0c, 0x06, 0x55, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x48, 0x24, 0x07, 0x2f, 0x3a, 0x2b, 0x46, 0x29, 0x30, 0x25, 0x8e, 0x1e, 0x27, 0x1c, 0xd7, 0x23, 0x29, 0x23, 0xff, 0x0f, 0x13, 0x0f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x02, 0x00, 0xff, 0x0b, 0x0f, 0x0a, 0xff, 0x0e, 0x11, 0x0e, 0xff, 0x17, 0x1d, 0x17, 0xff, 0x37, 0x3c, 0x35, 0xff, 0x2f, 0x34, 0x2b, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x03, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x05, 0x06, 0x03, 0xff, 0x04, 0x04, 0x05, 0xff, 0x03, 0x02, 0x04, 0xff, 0x04, 0x02, 0x03, 0xff, 0x04, 0x01, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x01, 0xff, 0x05, 0x04, 0x04, 0xff, 0x06, 0x05, 0x06, 0xff, 0x04, 0x02, 0x04, 0xff, 0x05, 0x04, 0x05, 0xff, 0x03, 0x03, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x03, 0x01, 0x02, 0xff, 0x05, 0x06, 0x03, 0xff, 0x04, 0x08, 0x03, 0xff, 0x03, 0x04, 0x01, 0xff, 0x04, 0x05, 0x03, 0xff, 0x02, 0x00, 0x00, 0xff, 0x07, 0x03, 0x02, 0xd7, 0x07, 0x03, 0x03, 0x8e, 0x07, 0x03, 0x03, 0x46, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x05, 0x26, 0x2e, 0x1f, 0x48, 0x29, 0x33, 0x23, 0x9f, 0x26, 0x2c, 0x20, 0xef, 0x10, 0x15, 0x0c, 0xff, 0x05, 0x09, 0x03, 0xff, 0x00, 0x03, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x01, 0x02, 0xff, 0x01, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x05, 0x04, 0x00, 0xff, 0x07, 0x05, 0x00, 0xff, 0x08, 0x05, 0x00, 0xff, 0x09, 0x07, 0x01, 0xff, 0x04, 0x03, 0x00, 0xff, 0x01, 0x02, 0x00, 0xff, 0x02, 0x03, 0x01, 0xff, 0x02, 0x01, 0x01, 0xff, 0x04, 0x01, 0x02, 0xff, 0x03, 0x00, 0x02, 0xff, 0x02, 0x00, 0x02, 0xff, 0x02, 0x00, 0x02, 0xff, 0x03, 0x00, 0x02, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x06, 0x03, 0x03, 0xff, 0x03, 0x00, 0x01, 0xff, 0x04, 0x01, 0x02, 0xff, 0x01, 0x00, 0x01, 0xff, 0x00, 0x01, 0x00, 0xff, 0x03, 0x04, 0x01, 0xff, 0x03, 0x02, 0x01, 0xff, 0x04, 0x01, 0x00, 0xff, 0x06, 0x01, 0x01, 0xff, 0x05, 0x02, 0x02, 0xff, 0x03, 0x02, 0x02, 0xff, 0x03, 0x02, 0x02, 0xef, 0x03, 0x03, 0x01, 0x9f, 0x03, 0x03, 0x00, 0x48, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x1d, 0x0e, 0x23, 0x24, 0x29, 0x1e, 0x86, 0x22, 0x26, 0x1b, 0xe5, 0x1e, 0x22, 0x17, 0xff, 0x12, 0x16, 0x0d, 0xff, 0x01, 0x03, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x05, 0x07, 0x03, 0xff, 0x15, 0x19, 0x11, 0xff, 0x1a, 0x1a, 0x15, 0xff, 0x14, 0x11, 0x0f, 0xff, 0x12, 0x10, 0x10, 0xff, 0x0d, 0x0a, 0x0b, 0xff, 0x05, 0x01, 0x00, 0xff, 0x07, 0x04, 0x00, 0xff, 0x07, 0x03, 0x00, 0xff, 0x05, 0x02, 0x00, 0xff, 0x09, 0x05, 0x02, 0xff, 0x0f, 0x0b, 0x07, 0xff, 0x0b, 0x07, 0x04, 0xff, 0x08, 0x05, 0x01, 0xff, 0x05, 0x04, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x01, 0x02, 0xff, 0x04, 0x01, 0x03, 0xff, 0x04, 0x01, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x01, 0x02, 0xff, 0x04, 0x01, 0x03, 0xff, 0x05, 0x04, 0x03, 0xff, 0x05, 0x04, 0x04, 0xff, 0x06, 0x04, 0x04, 0xff, 0x08, 0x06, 0x06, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x02, 0x02, 0xff, 0x01, 0x03, 0x02, 0xff, 0x01, 0x03, 0x01, 0xff, 0x01, 0x02, 0x01, 0xff, 0x03, 0x04, 0x02, 0xe5, 0x18, 0x18, 0x18, 0x86, 0x07, 0x0e, 0x07, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x41, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0xfe, 0x04, 0x04, 0x01, 0xff, 0x08, 0x09, 0x05, 0xff, 0x07, 0x08, 0x05, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x12, 0x12, 0x10, 0xff, 0x20, 0x21, 0x1d, 0xff, 0x22, 0x22, 0x1d, 0xff, 0x18, 0x16, 0x13, 0xff, 0x09, 0x07, 0x07, 0xff, 0x06, 0x04, 0x04, 0xff, 0x05, 0x01, 0x01, 0xff, 0x06, 0x03, 0x02, 0xff, 0x07, 0x03, 0x02, 0xff, 0x06, 0x02, 0x02, 0xff, 0x09, 0x05, 0x04, 0xff, 0x08, 0x05, 0x04, 0xff, 0x08, 0x04, 0x03, 0xff, 0x0e, 0x0a, 0x08, 0xff, 0x13, 0x10, 0x0a, 0xff, 0x0e, 0x0b, 0x06, 0xff, 0x08, 0x04, 0x03, 0xff, 0x06, 0x02, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x02, 0x03, 0xff, 0x06, 0x04, 0x04, 0xff, 0x06, 0x04, 0x03, 0xff, 0x04, 0x02, 0x02, 0xff, 0x0a, 0x07, 0x07, 0xff, 0x11, 0x0f, 0x0d, 0xff, 0x0a, 0x09, 0x07, 0xff, 0x03, 0x00, 0x00, 0xff, 0x05, 0x00, 0x01, 0xff, 0x05, 0x00, 0x00, 0xff, 0x05, 0x00, 0x01, 0xff, 0x04, 0x00, 0x01, 0xff, 0x03, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x02, 0x02, 0x01, 0xff, 0x03, 0x06, 0x03, 0xff, 0x07, 0x08, 0x06, 0xff, 0x04, 0x03, 0x02, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xfe, 0x07, 0x04, 0x02, 0xb4, 0x07, 0x03, 0x03, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x00, 0x4c, 0x01, 0x02, 0x00, 0xcb, 0x06, 0x07, 0x06, 0xff, 0x04, 0x05, 0x03, 0xff, 0x02, 0x03, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x05, 0x05, 0x06, 0xff, 0x05, 0x05, 0x07, 0xff, 0x05, 0x05, 0x06, 0xff, 0x02, 0x03, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x05, 0x03, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x07, 0x05, 0x04, 0xff, 0x0d, 0x0b, 0x0b, 0xff, 0x0c, 0x0a, 0x08, 0xff, 0x0d, 0x0a, 0x06, 0xff, 0x0a, 0x07, 0x04, 0xff, 0x08, 0x03, 0x02, 0xff, 0x05, 0x02, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x02, 0xff, 0x08, 0x06, 0x05, 0xff, 0x0b, 0x09, 0x08, 0xff, 0x04, 0x01, 0x01, 0xff, 0x05, 0x04, 0x01, 0xff, 0x0d, 0x0c, 0x08, 0xff, 0x10, 0x11, 0x0a, 0xff, 0x06, 0x03, 0x01, 0xff, 0x04, 0x00, 0x00, 0xff, 0x05, 0x00, 0x01, 0xff, 0x05, 0x00, 0x01, 0xff, 0x04, 0x00, 0x01, 0xff, 0x03, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x04, 0x02, 0xff, 0x04, 0x05, 0x03, 0xff, 0x07, 0x05, 0x04, 0xff, 0x03, 0x01, 0x00, 0xff, 0x06, 0x03, 0x02, 0xff, 0x09, 0x05, 0x05, 0xff, 0x08, 0x03, 0x04, 0xff, 0x07, 0x02, 0x02, 0xff, 0x02, 0x00, 0x00, 0xcb, 0x09, 0x06, 0x06, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x46, 0x03, 0x01, 0x00, 0xc9, 0x03, 0x00, 0x00, 0xff, 0x02, 0x01, 0x00, 0xff, 0x02, 0x02, 0x01, 0xff, 0x04, 0x04, 0x02, 0xff, 0x04, 0x03, 0x02, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x01, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x05, 0x03, 0x04, 0xff, 0x02, 0x01, 0x01, 0xff, 0x03, 0x02, 0x01, 0xff, 0x04, 0x04, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x07, 0x05, 0x04, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x07, 0x05, 0x04, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x0b, 0x09, 0x08, 0xff, 0x0f, 0x0d, 0x0b, 0xff, 0x01, 0x01, 0x00, 0xff, 0x03, 0x03, 0x00, 0xff, 0x0c, 0x0d, 0x05, 0xff, 0x0b, 0x0b, 0x07, 0xff, 0x02, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x03, 0x02, 0xff, 0x06, 0x05, 0x03, 0xff, 0x05, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x04, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x02, 0x03, 0xff, 0x04, 0x03, 0x03, 0xff, 0x07, 0x03, 0x03, 0xc9, 0x07, 0x03, 0x03, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00, 0xb4, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x02, 0x02, 0xff, 0x04, 0x01, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x00, 0xff, 0x04, 0x01, 0x00, 0xff, 0x04, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x05, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x02, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x07, 0x05, 0x04, 0xff, 0x06, 0x04, 0x03, 0xff, 0x06, 0x04, 0x03, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x14, 0x13, 0x0e, 0xff, 0x0f, 0x0e, 0x0a, 0xff, 0x0a, 0x0a, 0x05, 0xff, 0x07, 0x07, 0x01, 0xff, 0x07, 0x07, 0x04, 0xff, 0x05, 0x03, 0x04, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x03, 0xff, 0x06, 0x04, 0x04, 0xff, 0x0c, 0x0b, 0x09, 0xff, 0x05, 0x03, 0x03, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x02, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x01, 0x01, 0xb5, 0x07, 0x00, 0x07, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x05, 0x03, 0x01, 0x87, 0x05, 0x03, 0x02, 0xf9, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x06, 0x04, 0x03, 0xff, 0x06, 0x04, 0x03, 0xff, 0x07, 0x05, 0x04, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x07, 0x05, 0x04, 0xff, 0x06, 0x04, 0x02, 0xff, 0x09, 0x08, 0x03, 0xff, 0x18, 0x17, 0x13, 0xff, 0x16, 0x16, 0x10, 0xff, 0x11, 0x11, 0x0a, 0xff, 0x0a, 0x09, 0x06, 0xff, 0x07, 0x04, 0x05, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x05, 0x03, 0x03, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x05, 0x03, 0x03, 0xff, 0x0d, 0x0b, 0x0a, 0xff, 0x14, 0x12, 0x11, 0xff, 0x05, 0x03, 0x03, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x03, 0x03, 0xff, 0x16, 0x15, 0x15, 0xf9, 0x22, 0x20, 0x20, 0x87, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x40, 0x03, 0x01, 0x00, 0xda, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x06, 0x04, 0x03, 0xff, 0x06, 0x04, 0x03, 0xff, 0x06, 0x04, 0x03, 0xff, 0x07, 0x05, 0x04, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x05, 0x03, 0x02, 0xff, 0x08, 0x06, 0x04, 0xff, 0x0c, 0x0b, 0x07, 0xff, 0x12, 0x11, 0x0d, 0xff, 0x15, 0x15, 0x0f, 0xff, 0x0f, 0x10, 0x08, 0xff, 0x13, 0x12, 0x0f, 0xff, 0x0b, 0x08, 0x09, 0xff, 0x03, 0x01, 0x01, 0xff, 0x07, 0x05, 0x05, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x06, 0x04, 0x04, 0xff, 0x11, 0x0f, 0x0f, 0xff, 0x10, 0x0e, 0x0d, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x01, 0x01, 0xff, 0x06, 0x05, 0x05, 0xff, 0x27, 0x25, 0x25, 0xff, 0x15, 0x12, 0x12, 0xda, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x01, 0x01, 0x8e, 0x03, 0x02, 0x02, 0xfe, 0x05, 0x03, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x06, 0x04, 0x03, 0xff, 0x07, 0x05, 0x04, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x07, 0x05, 0x04, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x07, 0x05, 0x04, 0xff, 0x06, 0x04, 0x03, 0xff, 0x06, 0x04, 0x03, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x00, 0xff, 0x04, 0x02, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x06, 0x05, 0x02, 0xff, 0x0d, 0x0c, 0x07, 0xff, 0x1b, 0x1a, 0x16, 0xff, 0x1b, 0x1a, 0x15, 0xff, 0x16, 0x16, 0x10, 0xff, 0x0b, 0x0a, 0x07, 0xff, 0x0e, 0x0c, 0x0d, 0xff, 0x07, 0x05, 0x05, 0xff, 0x05, 0x03, 0x03, 0xff, 0x06, 0x04, 0x04, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x02, 0x01, 0xff, 0x06, 0x04, 0x04, 0xff, 0x14, 0x12, 0x12, 0xff, 0x0d, 0x0b, 0x09, 0xff, 0x03, 0x01, 0x00, 0xff, 0x05, 0x03, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x05, 0x03, 0x03, 0xff, 0x01, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x08, 0x06, 0x05, 0xff, 0x00, 0x00, 0x00, 0xfe, 0x13, 0x19, 0x15, 0x8e, 0x24, 0x48, 0x48, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x29, 0x02, 0x02, 0x02, 0xd1, 0x02, 0x02, 0x02, 0xff, 0x05, 0x03, 0x04, 0xff, 0x05, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x06, 0x04, 0x03, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x02, 0xff, 0x07, 0x05, 0x04, 0xff, 0x04, 0x02, 0x01, 0xff, 0x01, 0x00, 0x00, 0xff, 0x08, 0x06, 0x05, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x07, 0x05, 0x03, 0xff, 0x04, 0x02, 0x01, 0xff, 0x07, 0x05, 0x04, 0xff, 0x06, 0x04, 0x03, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x06, 0x04, 0x02, 0xff, 0x08, 0x07, 0x02, 0xff, 0x10, 0x10, 0x0c, 0xff, 0x1e, 0x1d, 0x19, 0xff, 0x1c, 0x1c, 0x15, 0xff, 0x0b, 0x0a, 0x07, 0xff, 0x09, 0x07, 0x08, 0xff, 0x0c, 0x0a, 0x0a, 0xff, 0x04, 0x02, 0x02, 0xff, 0x06, 0x04, 0x04, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x06, 0x04, 0x03, 0xff, 0x0f, 0x0d, 0x0c, 0xff, 0x08, 0x06, 0x05, 0xff, 0x08, 0x06, 0x05, 0xff, 0x04, 0x02, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x09, 0x07, 0x07, 0xff, 0x09, 0x07, 0x07, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x06, 0x04, 0x04, 0xff, 0x06, 0x04, 0x04, 0xff, 0x06, 0x04, 0x04, 0xff, 0x01, 0x01, 0x01, 0xff, 0x06, 0x06, 0x06, 0xff, 0x32, 0x39, 0x34, 0xd1, 0x37, 0x44, 0x3e, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x02, 0x02, 0x56, 0x07, 0x03, 0x04, 0xf3, 0x03, 0x02, 0x02, 0xff, 0x02, 0x02, 0x03, 0xff, 0x04, 0x02, 0x03, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x08, 0x06, 0x05, 0xff, 0x0e, 0x0c, 0x0b, 0xff, 0x0c, 0x0a, 0x09, 0xff, 0x08, 0x06, 0x06, 0xff, 0x02, 0x00, 0x00, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x08, 0x06, 0x05, 0xff, 0x06, 0x04, 0x03, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x09, 0x07, 0x06, 0xff, 0x09, 0x07, 0x06, 0xff, 0x07, 0x05, 0x05, 0xff, 0x06, 0x04, 0x04, 0xff, 0x06, 0x04, 0x05, 0xff, 0x05, 0x03, 0x04, 0xff, 0x04, 0x02, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x06, 0x05, 0x03, 0xff, 0x0b, 0x0b, 0x06, 0xff, 0x0b, 0x0b, 0x07, 0xff, 0x16, 0x17, 0x0f, 0xff, 0x14, 0x13, 0x10, 0xff, 0x07, 0x05, 0x06, 0xff, 0x05, 0x03, 0x03, 0xff, 0x06, 0x04, 0x04, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x06, 0x04, 0x03, 0xff, 0x0f, 0x0d, 0x0c, 0xff, 0x07, 0x05, 0x04, 0xff, 0x02, 0x00, 0x00, 0xff, 0x08, 0x06, 0x06, 0xff, 0x0d, 0x0b, 0x0b, 0xff, 0x09, 0x07, 0x07, 0xff, 0x07, 0x05, 0x05, 0xff, 0x06, 0x04, 0x04, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x06, 0x04, 0x04, 0xff, 0x05, 0x04, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x14, 0x10, 0xff, 0x35, 0x43, 0x3b, 0xf3, 0x35, 0x47, 0x3e, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0e, 0x0b, 0x05, 0x8a, 0x06, 0x02, 0x00, 0xfe, 0x05, 0x01, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x02, 0x02, 0x03, 0xff, 0x02, 0x00, 0x01, 0xff, 0x04, 0x02, 0x00, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x06, 0x04, 0x03, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x05, 0x04, 0x03, 0xff, 0x0e, 0x0c, 0x0b, 0xff, 0x0d, 0x0b, 0x0a, 0xff, 0x09, 0x07, 0x06, 0xff, 0x03, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x06, 0x04, 0x03, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x08, 0x06, 0x04, 0xff, 0x08, 0x06, 0x05, 0xff, 0x08, 0x06, 0x05, 0xff, 0x06, 0x04, 0x03, 0xff, 0x08, 0x07, 0x05, 0xff, 0x0c, 0x0a, 0x09, 0xff, 0x0b, 0x09, 0x08, 0xff, 0x08, 0x06, 0x05, 0xff, 0x07, 0x05, 0x06, 0xff, 0x09, 0x07, 0x06, 0xff, 0x06, 0x04, 0x03, 0xff, 0x02, 0x01, 0x01, 0xff, 0x0a, 0x09, 0x07, 0xff, 0x0c, 0x0b, 0x08, 0xff, 0x08, 0x07, 0x02, 0xff, 0x0c, 0x0a, 0x08, 0xff, 0x0b, 0x09, 0x09, 0xff, 0x06, 0x04, 0x04, 0xff, 0x05, 0x03, 0x03, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x08, 0x06, 0x06, 0xff, 0x05, 0x03, 0x02, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x09, 0x07, 0x06, 0xff, 0x0e, 0x0c, 0x0b, 0xff, 0x0b, 0x09, 0x07, 0xff, 0x04, 0x02, 0x02, 0xff, 0x09, 0x07, 0x07, 0xff, 0x06, 0x04, 0x04, 0xff, 0x06, 0x04, 0x04, 0xff, 0x0b, 0x09, 0x09, 0xff, 0x09, 0x07, 0x07, 0xff, 0x03, 0x01, 0x01, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x02, 0x02, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x02, 0x03, 0xff, 0x03, 0x02, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x15, 0x21, 0x1d, 0xff, 0x36, 0x48, 0x40, 0xfe, 0x33, 0x49, 0x3e, 0x8b, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 0x00, 0x0b, 0x17, 0x11, 0x04, 0xae, 0x11, 0x0b, 0x07, 0xff, 0x06, 0x01, 0x01, 0xff, 0x05, 0x01, 0x02, 0xff, 0x03, 0x02, 0x02, 0xff, 0x01, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x05, 0x03, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x05, 0x03, 0x02, 0xff, 0x0f, 0x0d, 0x0c, 0xff, 0x0d, 0x0b, 0x0b, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x07, 0x05, 0x04, 0xff, 0x07, 0x05, 0x04, 0xff, 0x07, 0x05, 0x03, 0xff, 0x07, 0x06, 0x01, 0xff, 0x07, 0x07, 0x02, 0xff, 0x06, 0x06, 0x01, 0xff, 0x05, 0x04, 0x00, 0xff, 0x07, 0x06, 0x01, 0xff, 0x07, 0x06, 0x01, 0xff, 0x07, 0x06, 0x01, 0xff, 0x08, 0x07, 0x04, 0xff, 0x08, 0x06, 0x07, 0xff, 0x06, 0x04, 0x04, 0xff, 0x07, 0x05, 0x04, 0xff, 0x08, 0x06, 0x05, 0xff, 0x02, 0x00, 0x00, 0xff, 0x06, 0x04, 0x04, 0xff, 0x09, 0x07, 0x06, 0xff, 0x04, 0x02, 0x02, 0xff, 0x07, 0x05, 0x05, 0xff, 0x09, 0x07, 0x07, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x02, 0x01, 0xff, 0x07, 0x05, 0x03, 0xff, 0x0e, 0x0c, 0x0b, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x08, 0x06, 0x05, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x08, 0x06, 0x05, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x05, 0x03, 0x03, 0xff, 0x0a, 0x08, 0x08, 0xff, 0x09, 0x07, 0x07, 0xff, 0x06, 0x04, 0x04, 0xff, 0x06, 0x04, 0x04, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x02, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x03, 0x00, 0x02, 0xff, 0x05, 0x02, 0x03, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x06, 0x05, 0xff, 0x2b, 0x3a, 0x32, 0xff, 0x36, 0x49, 0x41, 0xff, 0x33, 0x4a, 0x40, 0xaf, 0x2e, 0x45, 0x45, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x0b, 0x00, 0x16, 0x18, 0x0f, 0x01, 0xc9, 0x17, 0x11, 0x05, 0xff, 0x10, 0x0b, 0x07, 0xff, 0x05, 0x00, 0x01, 0xff, 0x04, 0x00, 0x01, 0xff, 0x02, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x07, 0x05, 0x03, 0xff, 0x07, 0x05, 0x04, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x0b, 0x09, 0x08, 0xff, 0x08, 0x06, 0x05, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x07, 0x05, 0x04, 0xff, 0x08, 0x06, 0x05, 0xff, 0x06, 0x04, 0x03, 0xff, 0x03, 0x01, 0x00, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x07, 0x05, 0x04, 0xff, 0x08, 0x06, 0x04, 0xff, 0x0a, 0x09, 0x04, 0xff, 0x0d, 0x0c, 0x07, 0xff, 0x0f, 0x0f, 0x0a, 0xff, 0x11, 0x10, 0x0b, 0xff, 0x0e, 0x0d, 0x09, 0xff, 0x08, 0x08, 0x03, 0xff, 0x04, 0x04, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x06, 0x04, 0x04, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x0e, 0x0c, 0x0b, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x09, 0x07, 0x06, 0xff, 0x07, 0x05, 0x04, 0xff, 0x05, 0x03, 0x03, 0xff, 0x08, 0x06, 0x05, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x07, 0x05, 0x04, 0xff, 0x0e, 0x0c, 0x0c, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x03, 0xff, 0x07, 0x01, 0x02, 0xff, 0x05, 0x01, 0x01, 0xff, 0x01, 0x03, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1b, 0x24, 0x1f, 0xff, 0x35, 0x46, 0x3f, 0xff, 0x32, 0x49, 0x3e, 0xff, 0x36, 0x4c, 0x3f, 0xc9, 0x39, 0x45, 0x39, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x09, 0x00, 0x1a, 0x16, 0x10, 0x05, 0xd6, 0x17, 0x11, 0x04, 0xff, 0x17, 0x13, 0x09, 0xff, 0x0c, 0x08, 0x04, 0xff, 0x04, 0x00, 0x00, 0xff, 0x04, 0x01, 0x01, 0xff, 0x04, 0x03, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x05, 0x03, 0x02, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x09, 0x07, 0x06, 0xff, 0x05, 0x03, 0x02, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x07, 0x05, 0x04, 0xff, 0x09, 0x07, 0x06, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x07, 0x05, 0x04, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x04, 0x02, 0xff, 0x05, 0x04, 0x01, 0xff, 0x04, 0x03, 0x01, 0xff, 0x07, 0x06, 0x03, 0xff, 0x0b, 0x09, 0x07, 0xff, 0x07, 0x06, 0x04, 0xff, 0x05, 0x03, 0x01, 0xff, 0x03, 0x02, 0x01, 0xff, 0x04, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x03, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x0e, 0x0c, 0x0b, 0xff, 0x05, 0x03, 0x03, 0xff, 0x03, 0x01, 0x00, 0xff, 0x09, 0x07, 0x06, 0xff, 0x08, 0x06, 0x05, 0xff, 0x05, 0x03, 0x03, 0xff, 0x07, 0x05, 0x04, 0xff, 0x03, 0x01, 0x02, 0xff, 0x06, 0x04, 0x04, 0xff, 0x10, 0x0e, 0x0c, 0xff, 0x0d, 0x0b, 0x0b, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x05, 0x03, 0x03, 0xff, 0x06, 0x04, 0x04, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x08, 0x02, 0x03, 0xff, 0x05, 0x00, 0x00, 0xff, 0x02, 0x02, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x13, 0x1c, 0x17, 0xff, 0x34, 0x45, 0x3e, 0xff, 0x2e, 0x44, 0x39, 0xff, 0x36, 0x4c, 0x40, 0xff, 0x35, 0x4c, 0x40, 0xd6, 0x31, 0x4e, 0x3a, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x07, 0x00, 0x20, 0x0c, 0x08, 0x02, 0xde, 0x16, 0x11, 0x09, 0xff, 0x16, 0x14, 0x07, 0xff, 0x15, 0x12, 0x09, 0xff, 0x08, 0x02, 0x01, 0xff, 0x05, 0x00, 0x01, 0xff, 0x05, 0x02, 0x02, 0xff, 0x05, 0x04, 0x04, 0xff, 0x01, 0x02, 0x02, 0xff, 0x06, 0x06, 0x05, 0xff, 0x05, 0x03, 0x02, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x07, 0x05, 0x03, 0xff, 0x0b, 0x09, 0x08, 0xff, 0x06, 0x04, 0x03, 0xff, 0x04, 0x02, 0x01, 0xff, 0x06, 0x04, 0x03, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x07, 0x05, 0x04, 0xff, 0x11, 0x0f, 0x0e, 0xff, 0x08, 0x06, 0x04, 0xff, 0x05, 0x03, 0x02, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x07, 0x05, 0x04, 0xff, 0x04, 0x02, 0x01, 0xff, 0x09, 0x07, 0x06, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x06, 0x04, 0x03, 0xff, 0x09, 0x07, 0x06, 0xff, 0x03, 0x01, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x07, 0x05, 0x05, 0xff, 0x09, 0x07, 0x07, 0xff, 0x09, 0x07, 0x07, 0xff, 0x07, 0x05, 0x05, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x02, 0x02, 0xff, 0x08, 0x01, 0x01, 0xff, 0x07, 0x01, 0x01, 0xff, 0x02, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0f, 0x16, 0x11, 0xff, 0x30, 0x3f, 0x38, 0xff, 0x2d, 0x42, 0x37, 0xff, 0x34, 0x4a, 0x3e, 0xff, 0x36, 0x4c, 0x40, 0xff, 0x34, 0x4a, 0x3f, 0xde, 0x37, 0x47, 0x3f, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x00, 0x1c, 0x0a, 0x08, 0x01, 0xdb, 0x09, 0x07, 0x01, 0xff, 0x11, 0x0f, 0x06, 0xff, 0x12, 0x11, 0x06, 0xff, 0x10, 0x0d, 0x06, 0xff, 0x06, 0x01, 0x01, 0xff, 0x04, 0x00, 0x01, 0xff, 0x03, 0x00, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x0a, 0x0a, 0x09, 0xff, 0x0e, 0x0c, 0x0c, 0xff, 0x03, 0x01, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x06, 0x04, 0x03, 0xff, 0x07, 0x05, 0x04, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x07, 0x05, 0x04, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x01, 0x00, 0xff, 0x02, 0x02, 0x00, 0xff, 0x03, 0x03, 0x01, 0xff, 0x04, 0x03, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x0d, 0x0b, 0x0a, 0xff, 0x08, 0x06, 0x04, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x04, 0xff, 0x0c, 0x0a, 0x09, 0xff, 0x09, 0x07, 0x06, 0xff, 0x05, 0x03, 0x02, 0xff, 0x0b, 0x09, 0x08, 0xff, 0x06, 0x04, 0x03, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x06, 0x04, 0x03, 0xff, 0x08, 0x06, 0x06, 0xff, 0x0f, 0x0d, 0x0d, 0xff, 0x0d, 0x0b, 0x0b, 0xff, 0x0a, 0x08, 0x08, 0xff, 0x08, 0x06, 0x06, 0xff, 0x0a, 0x08, 0x08, 0xff, 0x0b, 0x05, 0x06, 0xff, 0x09, 0x02, 0x02, 0xff, 0x03, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x12, 0x19, 0x14, 0xff, 0x2e, 0x3d, 0x35, 0xff, 0x2b, 0x3f, 0x33, 0xff, 0x35, 0x49, 0x3c, 0xff, 0x35, 0x4b, 0x3f, 0xff, 0x35, 0x4b, 0x3f, 0xff, 0x35, 0x4b, 0x3e, 0xdc, 0x36, 0x48, 0x3f, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x15, 0x09, 0x05, 0x02, 0xd6, 0x0a, 0x07, 0x02, 0xff, 0x04, 0x04, 0x00, 0xff, 0x08, 0x08, 0x01, 0xff, 0x10, 0x0d, 0x05, 0xff, 0x09, 0x05, 0x02, 0xff, 0x04, 0x00, 0x00, 0xff, 0x04, 0x01, 0x00, 0xff, 0x05, 0x04, 0x04, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x0d, 0x0b, 0x09, 0xff, 0x09, 0x07, 0x06, 0xff, 0x02, 0x00, 0x00, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x06, 0x04, 0x03, 0xff, 0x06, 0x04, 0x03, 0xff, 0x06, 0x04, 0x03, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x04, 0x03, 0xff, 0x06, 0x05, 0x04, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x08, 0x06, 0x05, 0xff, 0x0d, 0x0b, 0x0a, 0xff, 0x06, 0x04, 0x02, 0xff, 0x07, 0x05, 0x05, 0xff, 0x01, 0x00, 0x00, 0xff, 0x12, 0x10, 0x10, 0xff, 0x14, 0x12, 0x12, 0xff, 0x02, 0x00, 0x00, 0xff, 0x08, 0x06, 0x06, 0xff, 0x05, 0x03, 0x04, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x08, 0x06, 0x04, 0xff, 0x09, 0x07, 0x06, 0xff, 0x08, 0x06, 0x05, 0xff, 0x0d, 0x0b, 0x0a, 0xff, 0x0b, 0x09, 0x09, 0xff, 0x06, 0x05, 0x05, 0xff, 0x07, 0x05, 0x05, 0xff, 0x07, 0x02, 0x03, 0xff, 0x06, 0x01, 0x01, 0xff, 0x02, 0x02, 0x01, 0xff, 0x0c, 0x11, 0x0d, 0xff, 0x29, 0x33, 0x2e, 0xff, 0x2f, 0x3f, 0x38, 0xff, 0x28, 0x3d, 0x32, 0xff, 0x32, 0x49, 0x3c, 0xff, 0x36, 0x4c, 0x40, 0xff, 0x36, 0x4c, 0x40, 0xff, 0x36, 0x4c, 0x40, 0xff, 0x36, 0x4b, 0x40, 0xd7, 0x30, 0x48, 0x3c, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x00, 0x0a, 0x11, 0x0f, 0x07, 0xc8, 0x0c, 0x09, 0x06, 0xff, 0x06, 0x06, 0x04, 0xff, 0x02, 0x03, 0x04, 0xff, 0x03, 0x02, 0x01, 0xff, 0x09, 0x06, 0x01, 0xff, 0x04, 0x01, 0x00, 0xff, 0x05, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x07, 0x05, 0x05, 0xff, 0x0a, 0x08, 0x06, 0xff, 0x06, 0x04, 0x03, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x06, 0x04, 0x03, 0xff, 0x06, 0x04, 0x02, 0xff, 0x04, 0x01, 0x01, 0xff, 0x04, 0x01, 0x01, 0xff, 0x06, 0x04, 0x03, 0xff, 0x09, 0x07, 0x07, 0xff, 0x05, 0x03, 0x03, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x02, 0xff, 0x06, 0x04, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x01, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x09, 0x07, 0x06, 0xff, 0x08, 0x06, 0x05, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x01, 0x00, 0xff, 0x05, 0x01, 0x01, 0xff, 0x07, 0x03, 0x03, 0xff, 0x06, 0x02, 0x02, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x01, 0x00, 0xff, 0x05, 0x03, 0x02, 0xff, 0x07, 0x05, 0x05, 0xff, 0x07, 0x05, 0x05, 0xff, 0x07, 0x05, 0x05, 0xff, 0x06, 0x04, 0x03, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x0c, 0x0a, 0x09, 0xff, 0x10, 0x0e, 0x0d, 0xff, 0x07, 0x05, 0x04, 0xff, 0x06, 0x04, 0x03, 0xff, 0x01, 0x00, 0x00, 0xff, 0x0a, 0x08, 0x08, 0xff, 0x15, 0x13, 0x13, 0xff, 0x09, 0x07, 0x07, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x06, 0x04, 0x03, 0xff, 0x07, 0x05, 0x04, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x0b, 0x09, 0x08, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x07, 0x05, 0x04, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x01, 0x02, 0x01, 0xff, 0x25, 0x2e, 0x28, 0xff, 0x36, 0x44, 0x3d, 0xff, 0x29, 0x3d, 0x34, 0xff, 0x27, 0x41, 0x36, 0xff, 0x2f, 0x47, 0x3c, 0xff, 0x37, 0x4d, 0x41, 0xff, 0x35, 0x4b, 0x3f, 0xff, 0x36, 0x4b, 0x3f, 0xff, 0x36, 0x4b, 0x3f, 0xff, 0x35, 0x4c, 0x3f, 0xc8, 0x33, 0x4c, 0x33, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0x17, 0x0b, 0xb1, 0x19, 0x16, 0x0c, 0xff, 0x13, 0x10, 0x08, 0xff, 0x0a, 0x09, 0x03, 0xff, 0x04, 0x05, 0x00, 0xff, 0x02, 0x02, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x06, 0x04, 0x04, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x03, 0x00, 0xff, 0x04, 0x03, 0x00, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x02, 0x00, 0xff, 0x09, 0x08, 0x05, 0xff, 0x0c, 0x0a, 0x08, 0xff, 0x08, 0x07, 0x04, 0xff, 0x05, 0x03, 0x01, 0xff, 0x07, 0x05, 0x04, 0xff, 0x08, 0x06, 0x04, 0xff, 0x05, 0x03, 0x01, 0xff, 0x04, 0x02, 0x03, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x02, 0x00, 0xff, 0x08, 0x06, 0x03, 0xff, 0x0c, 0x0a, 0x07, 0xff, 0x02, 0x01, 0x01, 0xff, 0x04, 0x01, 0x02, 0xff, 0x04, 0x03, 0x02, 0xff, 0x02, 0x02, 0x00, 0xff, 0x03, 0x02, 0x01, 0xff, 0x02, 0x02, 0x01, 0xff, 0x01, 0x02, 0x00, 0xff, 0x04, 0x04, 0x02, 0xff, 0x0b, 0x0c, 0x09, 0xff, 0x0a, 0x0b, 0x09, 0xff, 0x07, 0x06, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x04, 0x04, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x03, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x03, 0x02, 0x02, 0xff, 0x04, 0x03, 0x03, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x0f, 0x0d, 0x0c, 0xff, 0x06, 0x04, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x08, 0x06, 0x06, 0xff, 0x0b, 0x09, 0x09, 0xff, 0x05, 0x03, 0x03, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x03, 0x01, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x06, 0x03, 0x02, 0xff, 0x07, 0x05, 0x04, 0xff, 0x05, 0x02, 0x03, 0xff, 0x02, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x25, 0x2d, 0x28, 0xff, 0x3c, 0x4a, 0x41, 0xff, 0x2c, 0x40, 0x37, 0xff, 0x2d, 0x46, 0x3c, 0xff, 0x34, 0x4c, 0x42, 0xff, 0x37, 0x4e, 0x44, 0xff, 0x36, 0x4e, 0x43, 0xff, 0x36, 0x4d, 0x43, 0xff, 0x36, 0x4d, 0x43, 0xff, 0x35, 0x4d, 0x42, 0xff, 0x35, 0x4c, 0x42, 0xb1, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x20, 0x13, 0x8d, 0x1f, 0x20, 0x13, 0xff, 0x1f, 0x1f, 0x11, 0xff, 0x1e, 0x1d, 0x0e, 0xff, 0x16, 0x14, 0x09, 0xff, 0x0d, 0x0d, 0x03, 0xff, 0x09, 0x08, 0x03, 0xff, 0x03, 0x01, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x06, 0x04, 0x04, 0xff, 0x07, 0x05, 0x04, 0xff, 0x06, 0x04, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x06, 0x04, 0x04, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x02, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x06, 0x04, 0x03, 0xff, 0x0d, 0x0d, 0x08, 0xff, 0x0a, 0x0a, 0x05, 0xff, 0x06, 0x05, 0x01, 0xff, 0x07, 0x06, 0x01, 0xff, 0x09, 0x08, 0x06, 0xff, 0x07, 0x05, 0x05, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x02, 0x04, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x08, 0x07, 0x04, 0xff, 0x0c, 0x0b, 0x07, 0xff, 0x03, 0x02, 0x00, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x01, 0x03, 0xff, 0x02, 0x03, 0x01, 0xff, 0x02, 0x04, 0x02, 0xff, 0x00, 0x02, 0x00, 0xff, 0x05, 0x07, 0x05, 0xff, 0x0e, 0x0f, 0x0d, 0xff, 0x14, 0x15, 0x13, 0xff, 0x12, 0x14, 0x11, 0xff, 0x13, 0x15, 0x12, 0xff, 0x14, 0x14, 0x15, 0xff, 0x11, 0x11, 0x11, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x09, 0x09, 0x09, 0xff, 0x03, 0x03, 0x03, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x0b, 0x09, 0x08, 0xff, 0x0a, 0x08, 0x08, 0xff, 0x04, 0x02, 0x00, 0xff, 0x04, 0x02, 0x02, 0xff, 0x07, 0x05, 0x06, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x08, 0x06, 0x06, 0xff, 0x06, 0x04, 0x04, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x03, 0xff, 0x02, 0x01, 0x01, 0xff, 0x08, 0x06, 0x05, 0xff, 0x10, 0x0e, 0x0d, 0xff, 0x0f, 0x0d, 0x0c, 0xff, 0x09, 0x08, 0x05, 0xff, 0x04, 0x02, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x06, 0x01, 0x02, 0xff, 0x06, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0c, 0x13, 0x0e, 0xff, 0x35, 0x42, 0x39, 0xff, 0x37, 0x48, 0x3e, 0xff, 0x33, 0x4a, 0x3f, 0xff, 0x37, 0x4f, 0x45, 0xff, 0x38, 0x50, 0x47, 0xff, 0x37, 0x4f, 0x45, 0xff, 0x37, 0x4f, 0x45, 0xff, 0x36, 0x4e, 0x44, 0xff, 0x36, 0x4e, 0x44, 0xff, 0x35, 0x4d, 0x44, 0xff, 0x34, 0x4b, 0x42, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x2d, 0x1e, 0x55, 0x2a, 0x2c, 0x1e, 0xfe, 0x2b, 0x2e, 0x1f, 0xff, 0x29, 0x2c, 0x1c, 0xff, 0x28, 0x2c, 0x1c, 0xff, 0x25, 0x27, 0x1b, 0xff, 0x20, 0x23, 0x18, 0xff, 0x12, 0x12, 0x0d, 0xff, 0x07, 0x05, 0x05, 0xff, 0x02, 0x01, 0x00, 0xff, 0x05, 0x03, 0x04, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x00, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x04, 0xff, 0x04, 0x02, 0x03, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x01, 0x00, 0x00, 0xff, 0x0a, 0x08, 0x05, 0xff, 0x10, 0x10, 0x0b, 0xff, 0x08, 0x07, 0x04, 0xff, 0x02, 0x01, 0x00, 0xff, 0x05, 0x04, 0x01, 0xff, 0x0b, 0x0a, 0x07, 0xff, 0x08, 0x06, 0x05, 0xff, 0x04, 0x02, 0x03, 0xff, 0x03, 0x01, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x02, 0x00, 0x01, 0xff, 0x03, 0x02, 0x02, 0xff, 0x08, 0x06, 0x05, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x07, 0x06, 0x02, 0xff, 0x05, 0x03, 0x01, 0xff, 0x05, 0x02, 0x03, 0xff, 0x03, 0x01, 0x03, 0xff, 0x03, 0x04, 0x02, 0xff, 0x01, 0x03, 0x00, 0xff, 0x0d, 0x0e, 0x0c, 0xff, 0x1b, 0x1c, 0x1a, 0xff, 0x18, 0x19, 0x17, 0xff, 0x12, 0x13, 0x11, 0xff, 0x12, 0x13, 0x11, 0xff, 0x0d, 0x0f, 0x0c, 0xff, 0x16, 0x16, 0x16, 0xff, 0x19, 0x19, 0x19, 0xff, 0x16, 0x16, 0x16, 0xff, 0x14, 0x14, 0x14, 0xff, 0x14, 0x14, 0x14, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x05, 0x05, 0x05, 0xff, 0x02, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x05, 0x03, 0x02, 0xff, 0x0c, 0x0a, 0x09, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x08, 0x06, 0x06, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x06, 0x04, 0x04, 0xff, 0x02, 0x00, 0x00, 0xff, 0x06, 0x04, 0x04, 0xff, 0x06, 0x04, 0x04, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x02, 0xff, 0x07, 0x05, 0x06, 0xff, 0x0c, 0x0a, 0x0a, 0xff, 0x0d, 0x0b, 0x0b, 0xff, 0x0c, 0x0b, 0x08, 0xff, 0x0a, 0x09, 0x04, 0xff, 0x06, 0x05, 0x03, 0xff, 0x06, 0x01, 0x01, 0xff, 0x04, 0x00, 0x01, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x06, 0x00, 0xff, 0x23, 0x32, 0x27, 0xff, 0x3d, 0x4e, 0x42, 0xff, 0x38, 0x50, 0x45, 0xff, 0x37, 0x50, 0x46, 0xff, 0x39, 0x51, 0x47, 0xff, 0x38, 0x50, 0x46, 0xff, 0x37, 0x4f, 0x45, 0xff, 0x37, 0x4f, 0x45, 0xff, 0x37, 0x4f, 0x45, 0xff, 0x36, 0x4e, 0x44, 0xff, 0x35, 0x4e, 0x44, 0xfe, 0x36, 0x4e, 0x42, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x37, 0x2b, 0x29, 0x37, 0x3a, 0x2b, 0xf3, 0x37, 0x3b, 0x2a, 0xff, 0x39, 0x3c, 0x2b, 0xff, 0x37, 0x3d, 0x2b, 0xff, 0x33, 0x3c, 0x2c, 0xff, 0x37, 0x3d, 0x2f, 0xff, 0x28, 0x2d, 0x23, 0xff, 0x23, 0x25, 0x1d, 0xff, 0x2a, 0x2a, 0x22, 0xff, 0x0c, 0x0d, 0x07, 0xff, 0x02, 0x02, 0x00, 0xff, 0x06, 0x04, 0x03, 0xff, 0x04, 0x02, 0x03, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x01, 0x00, 0x00, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x13, 0x11, 0x0e, 0xff, 0x07, 0x06, 0x03, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x02, 0x02, 0xff, 0x0e, 0x0b, 0x0a, 0xff, 0x0b, 0x09, 0x08, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x01, 0xff, 0x07, 0x04, 0x05, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x03, 0x01, 0x00, 0xff, 0x06, 0x04, 0x00, 0xff, 0x09, 0x07, 0x05, 0xff, 0x03, 0x00, 0x02, 0xff, 0x03, 0x00, 0x02, 0xff, 0x04, 0x04, 0x03, 0xff, 0x0d, 0x0f, 0x0e, 0xff, 0x16, 0x17, 0x16, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x05, 0x05, 0x04, 0xff, 0x05, 0x05, 0x05, 0xff, 0x10, 0x10, 0x10, 0xff, 0x14, 0x14, 0x14, 0xff, 0x14, 0x14, 0x14, 0xff, 0x12, 0x12, 0x12, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x05, 0x05, 0x05, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0x08, 0x09, 0x09, 0xff, 0x06, 0x05, 0x05, 0xff, 0x06, 0x04, 0x04, 0xff, 0x06, 0x04, 0x04, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x07, 0x05, 0x05, 0xff, 0x05, 0x03, 0x03, 0xff, 0x01, 0x00, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x06, 0x04, 0x03, 0xff, 0x08, 0x06, 0x05, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x06, 0x04, 0x04, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x02, 0x03, 0xff, 0x0b, 0x09, 0x0a, 0xff, 0x11, 0x10, 0x0d, 0xff, 0x10, 0x10, 0x0b, 0xff, 0x09, 0x07, 0x04, 0xff, 0x06, 0x01, 0x02, 0xff, 0x05, 0x00, 0x01, 0xff, 0x01, 0x03, 0x01, 0xff, 0x00, 0x09, 0x02, 0xff, 0x1d, 0x2f, 0x24, 0xff, 0x3b, 0x50, 0x44, 0xff, 0x39, 0x51, 0x46, 0xff, 0x37, 0x50, 0x46, 0xff, 0x39, 0x51, 0x47, 0xff, 0x39, 0x51, 0x47, 0xff, 0x39, 0x51, 0x47, 0xff, 0x39, 0x51, 0x47, 0xff, 0x38, 0x50, 0x46, 0xff, 0x37, 0x4f, 0x45, 0xff, 0x37, 0x4f, 0x45, 0xff, 0x36, 0x4d, 0x42, 0xf4, 0x36, 0x4e, 0x42, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x48, 0x24, 0x07, 0x45, 0x4a, 0x35, 0xd1, 0x45, 0x4b, 0x39, 0xff, 0x45, 0x4e, 0x3a, 0xff, 0x45, 0x51, 0x3a, 0xff, 0x45, 0x53, 0x3c, 0xff, 0x46, 0x53, 0x40, 0xff, 0x3e, 0x48, 0x39, 0xff, 0x31, 0x3a, 0x2f, 0xff, 0x3b, 0x3f, 0x33, 0xff, 0x36, 0x37, 0x2b, 0xff, 0x13, 0x14, 0x0c, 0xff, 0x02, 0x02, 0x00, 0xff, 0x0b, 0x09, 0x08, 0xff, 0x0a, 0x08, 0x08, 0xff, 0x08, 0x06, 0x07, 0xff, 0x05, 0x02, 0x05, 0xff, 0x04, 0x02, 0x03, 0xff, 0x05, 0x03, 0x03, 0xff, 0x03, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0b, 0x09, 0x09, 0xff, 0x15, 0x12, 0x11, 0xff, 0x07, 0x06, 0x04, 0xff, 0x03, 0x02, 0x00, 0xff, 0x06, 0x04, 0x02, 0xff, 0x0a, 0x07, 0x07, 0xff, 0x08, 0x06, 0x05, 0xff, 0x03, 0x01, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x06, 0x03, 0x03, 0xff, 0x04, 0x02, 0x01, 0xff, 0x0a, 0x09, 0x05, 0xff, 0x07, 0x06, 0x04, 0xff, 0x03, 0x00, 0x02, 0xff, 0x06, 0x03, 0x05, 0xff, 0x09, 0x08, 0x08, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x06, 0x06, 0x06, 0xff, 0x04, 0x04, 0x04, 0xff, 0x09, 0x09, 0x09, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x04, 0x04, 0x05, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x08, 0x08, 0x08, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x06, 0x06, 0x06, 0xff, 0x01, 0x00, 0x00, 0xff, 0x04, 0x05, 0x04, 0xff, 0x07, 0x06, 0x06, 0xff, 0x06, 0x04, 0x04, 0xff, 0x06, 0x04, 0x04, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x03, 0xff, 0x03, 0x01, 0x01, 0xff, 0x06, 0x04, 0x04, 0xff, 0x08, 0x05, 0x05, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x06, 0x04, 0x03, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x05, 0x03, 0x03, 0xff, 0x03, 0x01, 0x01, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x03, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x02, 0xff, 0x03, 0x01, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x08, 0x07, 0x03, 0xff, 0x0a, 0x0a, 0x04, 0xff, 0x0a, 0x08, 0x05, 0xff, 0x08, 0x03, 0x04, 0xff, 0x06, 0x01, 0x02, 0xff, 0x03, 0x06, 0x03, 0xff, 0x21, 0x2f, 0x27, 0xff, 0x32, 0x47, 0x3b, 0xff, 0x32, 0x49, 0x3c, 0xff, 0x35, 0x4d, 0x42, 0xff, 0x39, 0x53, 0x49, 0xff, 0x3a, 0x52, 0x48, 0xff, 0x3a, 0x51, 0x47, 0xff, 0x3a, 0x52, 0x48, 0xff, 0x39, 0x51, 0x47, 0xff, 0x39, 0x51, 0x47, 0xff, 0x38, 0x50, 0x46, 0xff, 0x38, 0x50, 0x46, 0xff, 0x37, 0x4e, 0x44, 0xff, 0x34, 0x4c, 0x40, 0xd1, 0x24, 0x48, 0x48, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x56, 0x42, 0x8e, 0x50, 0x5c, 0x47, 0xff, 0x53, 0x62, 0x4c, 0xff, 0x52, 0x63, 0x4c, 0xff, 0x53, 0x66, 0x4e, 0xff, 0x56, 0x69, 0x53, 0xff, 0x5d, 0x6c, 0x5a, 0xff, 0x4c, 0x56, 0x48, 0xff, 0x3c, 0x42, 0x36, 0xff, 0x1c, 0x1f, 0x16, 0xff, 0x05, 0x05, 0x00, 0xff, 0x0a, 0x08, 0x03, 0xff, 0x0b, 0x0a, 0x05, 0xff, 0x08, 0x06, 0x05, 0xff, 0x05, 0x03, 0x04, 0xff, 0x06, 0x04, 0x05, 0xff, 0x07, 0x04, 0x06, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x02, 0x02, 0xff, 0x01, 0x00, 0x00, 0xff, 0x05, 0x03, 0x03, 0xff, 0x13, 0x11, 0x11, 0xff, 0x09, 0x07, 0x06, 0xff, 0x02, 0x01, 0x00, 0xff, 0x05, 0x04, 0x00, 0xff, 0x08, 0x06, 0x05, 0xff, 0x09, 0x07, 0x07, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x05, 0x01, 0x03, 0xff, 0x07, 0x05, 0x04, 0xff, 0x05, 0x04, 0x03, 0xff, 0x04, 0x04, 0x01, 0xff, 0x11, 0x10, 0x0d, 0xff, 0x0c, 0x0a, 0x0a, 0xff, 0x06, 0x03, 0x04, 0xff, 0x09, 0x07, 0x09, 0xff, 0x04, 0x06, 0x06, 0xff, 0x02, 0x03, 0x03, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x06, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x04, 0x04, 0x03, 0xff, 0x02, 0x02, 0x01, 0xff, 0x06, 0x07, 0x06, 0xff, 0x06, 0x07, 0x07, 0xff, 0x07, 0x08, 0x08, 0xff, 0x07, 0x07, 0x07, 0xff, 0x0d, 0x0e, 0x0e, 0xff, 0x13, 0x13, 0x14, 0xff, 0x08, 0x09, 0x0a, 0xff, 0x04, 0x05, 0x06, 0xff, 0x04, 0x04, 0x04, 0xff, 0x06, 0x04, 0x04, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x03, 0x03, 0xff, 0x02, 0x02, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x06, 0x06, 0xff, 0x07, 0x07, 0x05, 0xff, 0x03, 0x02, 0x01, 0xff, 0x05, 0x04, 0x03, 0xff, 0x03, 0x02, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x03, 0x01, 0x02, 0xff, 0x03, 0x01, 0x02, 0xff, 0x06, 0x04, 0x04, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x08, 0x06, 0x05, 0xff, 0x0f, 0x0e, 0x0a, 0xff, 0x11, 0x11, 0x0c, 0xff, 0x0a, 0x09, 0x06, 0xff, 0x06, 0x01, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x00, 0x02, 0x00, 0xff, 0x29, 0x3c, 0x34, 0xff, 0x3e, 0x57, 0x4a, 0xff, 0x2e, 0x47, 0x3a, 0xff, 0x35, 0x4e, 0x43, 0xff, 0x3a, 0x53, 0x4a, 0xff, 0x3a, 0x52, 0x48, 0xff, 0x3a, 0x52, 0x48, 0xff, 0x3a, 0x52, 0x48, 0xff, 0x3a, 0x52, 0x48, 0xff, 0x39, 0x52, 0x48, 0xff, 0x38, 0x51, 0x47, 0xff, 0x37, 0x50, 0x47, 0xff, 0x37, 0x50, 0x45, 0xff, 0x36, 0x4e, 0x42, 0xff, 0x35, 0x4c, 0x40, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x5f, 0x4f, 0x40, 0x5a, 0x67, 0x55, 0xfe, 0x61, 0x70, 0x5c, 0xff, 0x63, 0x75, 0x61, 0xff, 0x63, 0x77, 0x63, 0xff, 0x66, 0x7d, 0x68, 0xff, 0x66, 0x7d, 0x6a, 0xff, 0x70, 0x80, 0x71, 0xff, 0x40, 0x47, 0x3e, 0xff, 0x0f, 0x0f, 0x0c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x09, 0x08, 0x07, 0xff, 0x0d, 0x0a, 0x07, 0xff, 0x0b, 0x06, 0x02, 0xff, 0x0a, 0x07, 0x05, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x05, 0x03, 0x03, 0xff, 0x13, 0x11, 0x11, 0xff, 0x0b, 0x09, 0x08, 0xff, 0x02, 0x00, 0x00, 0xff, 0x05, 0x04, 0x00, 0xff, 0x04, 0x04, 0x00, 0xff, 0x08, 0x07, 0x06, 0xff, 0x03, 0x01, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x01, 0x02, 0xff, 0x03, 0x00, 0x02, 0xff, 0x04, 0x01, 0x03, 0xff, 0x06, 0x04, 0x04, 0xff, 0x08, 0x06, 0x05, 0xff, 0x08, 0x06, 0x03, 0xff, 0x15, 0x13, 0x12, 0xff, 0x0d, 0x0b, 0x0b, 0xff, 0x05, 0x04, 0x03, 0xff, 0x05, 0x04, 0x04, 0xff, 0x02, 0x02, 0x01, 0xff, 0x04, 0x04, 0x04, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xff, 0x04, 0x05, 0x04, 0xff, 0x02, 0x03, 0x04, 0xff, 0x04, 0x05, 0x05, 0xff, 0x02, 0x03, 0x03, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x06, 0x05, 0x06, 0xff, 0x06, 0x06, 0x06, 0xff, 0x0c, 0x0d, 0x0d, 0xff, 0x0a, 0x0a, 0x09, 0xff, 0x04, 0x01, 0x00, 0xff, 0x09, 0x07, 0x06, 0xff, 0x07, 0x06, 0x05, 0xff, 0x05, 0x02, 0x02, 0xff, 0x06, 0x02, 0x03, 0xff, 0x08, 0x04, 0x05, 0xff, 0x04, 0x00, 0x01, 0xff, 0x08, 0x05, 0x04, 0xff, 0x06, 0x05, 0x03, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x02, 0x01, 0xff, 0x05, 0x02, 0x01, 0xff, 0x06, 0x03, 0x02, 0xff, 0x05, 0x02, 0x01, 0xff, 0x06, 0x02, 0x01, 0xff, 0x05, 0x02, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x08, 0x06, 0x07, 0xff, 0x06, 0x04, 0x05, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x07, 0x06, 0x03, 0xff, 0x0f, 0x0e, 0x0a, 0xff, 0x0b, 0x09, 0x05, 0xff, 0x07, 0x02, 0x03, 0xff, 0x02, 0x01, 0x01, 0xff, 0x0c, 0x16, 0x11, 0xff, 0x32, 0x49, 0x3f, 0xff, 0x3a, 0x56, 0x48, 0xff, 0x31, 0x4c, 0x3e, 0xff, 0x35, 0x4f, 0x43, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3a, 0x52, 0x48, 0xff, 0x3a, 0x52, 0x48, 0xff, 0x3a, 0x52, 0x48, 0xff, 0x3a, 0x52, 0x48, 0xff, 0x39, 0x52, 0x48, 0xff, 0x38, 0x51, 0x47, 0xff, 0x37, 0x51, 0x47, 0xff, 0x37, 0x50, 0x45, 0xff, 0x37, 0x4f, 0x43, 0xff, 0x35, 0x4d, 0x41, 0xfe, 0x36, 0x4e, 0x42, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x71, 0x55, 0x09, 0x60, 0x70, 0x5f, 0xdb, 0x6a, 0x7a, 0x68, 0xff, 0x6f, 0x80, 0x6f, 0xff, 0x6d, 0x83, 0x70, 0xff, 0x75, 0x8b, 0x78, 0xff, 0x75, 0x8f, 0x7b, 0xff, 0x7c, 0x96, 0x81, 0xff, 0x52, 0x64, 0x54, 0xff, 0x05, 0x0b, 0x05, 0xff, 0x00, 0x00, 0x00, 0xff, 0x14, 0x0f, 0x0f, 0xff, 0x0f, 0x0d, 0x0e, 0xff, 0x04, 0x02, 0x03, 0xff, 0x0e, 0x09, 0x0b, 0xff, 0x11, 0x0e, 0x0c, 0xff, 0x0d, 0x0d, 0x08, 0xff, 0x08, 0x07, 0x03, 0xff, 0x04, 0x04, 0x00, 0xff, 0x04, 0x03, 0x02, 0xff, 0x02, 0x00, 0x01, 0xff, 0x0e, 0x0c, 0x0c, 0xff, 0x10, 0x0e, 0x0e, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x0b, 0x09, 0x06, 0xff, 0x06, 0x04, 0x03, 0xff, 0x01, 0x00, 0x00, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x01, 0x03, 0xff, 0x02, 0x00, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x0b, 0x05, 0x07, 0xff, 0x0a, 0x03, 0x05, 0xff, 0x14, 0x11, 0x0d, 0xff, 0x0a, 0x07, 0x05, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x01, 0x03, 0xff, 0x05, 0x00, 0x01, 0xff, 0x03, 0x00, 0x01, 0xff, 0x06, 0x05, 0x06, 0xff, 0x07, 0x07, 0x07, 0xff, 0x06, 0x07, 0x07, 0xff, 0x04, 0x04, 0x04, 0xff, 0x00, 0x00, 0x01, 0xff, 0x06, 0x04, 0x07, 0xff, 0x0b, 0x08, 0x08, 0xff, 0x0a, 0x08, 0x08, 0xff, 0x06, 0x07, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0a, 0x09, 0x08, 0xff, 0x16, 0x14, 0x13, 0xff, 0x06, 0x04, 0x02, 0xff, 0x06, 0x03, 0x02, 0xff, 0x07, 0x06, 0x04, 0xff, 0x07, 0x04, 0x04, 0xff, 0x08, 0x02, 0x03, 0xff, 0x06, 0x02, 0x02, 0xff, 0x07, 0x03, 0x03, 0xff, 0x09, 0x05, 0x04, 0xff, 0x09, 0x05, 0x04, 0xff, 0x05, 0x02, 0x01, 0xff, 0x04, 0x00, 0x00, 0xff, 0x07, 0x04, 0x03, 0xff, 0x08, 0x04, 0x03, 0xff, 0x06, 0x02, 0x01, 0xff, 0x06, 0x02, 0x01, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x04, 0x04, 0xff, 0x07, 0x04, 0x04, 0xff, 0x0a, 0x06, 0x04, 0xff, 0x06, 0x04, 0x04, 0xff, 0x03, 0x02, 0x02, 0xff, 0x03, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x0a, 0x07, 0x06, 0xff, 0x09, 0x07, 0x07, 0xff, 0x05, 0x03, 0x02, 0xff, 0x0b, 0x0a, 0x05, 0xff, 0x0b, 0x06, 0x07, 0xff, 0x04, 0x02, 0x01, 0xff, 0x2e, 0x38, 0x33, 0xff, 0x3c, 0x52, 0x49, 0xff, 0x34, 0x4f, 0x41, 0xff, 0x37, 0x51, 0x43, 0xff, 0x39, 0x53, 0x47, 0xff, 0x3a, 0x53, 0x4a, 0xff, 0x3a, 0x53, 0x49, 0xff, 0x3a, 0x53, 0x49, 0xff, 0x3a, 0x53, 0x49, 0xff, 0x3a, 0x53, 0x49, 0xff, 0x39, 0x52, 0x48, 0xff, 0x39, 0x52, 0x48, 0xff, 0x38, 0x51, 0x47, 0xff, 0x37, 0x50, 0x45, 0xff, 0x37, 0x4f, 0x43, 0xff, 0x37, 0x4e, 0x42, 0xff, 0x35, 0x4e, 0x42, 0xdb, 0x38, 0x55, 0x38, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x74, 0x63, 0x88, 0x68, 0x7f, 0x6e, 0xff, 0x72, 0x8a, 0x77, 0xff, 0x74, 0x8f, 0x7e, 0xff, 0x74, 0x95, 0x84, 0xff, 0x7a, 0x96, 0x83, 0xff, 0x87, 0xa0, 0x8c, 0xff, 0x88, 0x9d, 0x88, 0xff, 0x31, 0x3f, 0x31, 0xff, 0x00, 0x04, 0x00, 0xff, 0x11, 0x0a, 0x0c, 0xff, 0x10, 0x0c, 0x0d, 0xff, 0x03, 0x04, 0x02, 0xff, 0x0b, 0x09, 0x09, 0xff, 0x10, 0x0e, 0x0e, 0xff, 0x18, 0x14, 0x14, 0xff, 0x13, 0x0f, 0x0e, 0xff, 0x07, 0x03, 0x03, 0xff, 0x03, 0x00, 0x00, 0xff, 0x03, 0x00, 0x01, 0xff, 0x07, 0x05, 0x06, 0xff, 0x10, 0x0e, 0x0e, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x09, 0x07, 0x07, 0xff, 0x10, 0x0e, 0x0d, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x03, 0xff, 0x04, 0x01, 0x04, 0xff, 0x07, 0x02, 0x01, 0xff, 0x07, 0x02, 0x00, 0xff, 0x0a, 0x06, 0x05, 0xff, 0x09, 0x08, 0x05, 0xff, 0x0f, 0x0c, 0x05, 0xff, 0x0b, 0x07, 0x02, 0xff, 0x07, 0x02, 0x02, 0xff, 0x03, 0x01, 0x02, 0xff, 0x02, 0x03, 0x07, 0xff, 0x02, 0x03, 0x09, 0xff, 0x06, 0x04, 0x0c, 0xff, 0x09, 0x05, 0x0f, 0xff, 0x05, 0x04, 0x10, 0xff, 0x05, 0x03, 0x0a, 0xff, 0x06, 0x04, 0x05, 0xff, 0x04, 0x02, 0x01, 0xff, 0x02, 0x01, 0x01, 0xff, 0x07, 0x08, 0x08, 0xff, 0x10, 0x14, 0x14, 0xff, 0x11, 0x15, 0x14, 0xff, 0x0a, 0x0d, 0x0b, 0xff, 0x03, 0x05, 0x04, 0xff, 0x02, 0x02, 0x04, 0xff, 0x07, 0x08, 0x0a, 0xff, 0x05, 0x08, 0x09, 0xff, 0x00, 0x00, 0x01, 0xff, 0x00, 0x01, 0x03, 0xff, 0x09, 0x0a, 0x0c, 0xff, 0x08, 0x0b, 0x0d, 0xff, 0x02, 0x05, 0x07, 0xff, 0x00, 0x03, 0x06, 0xff, 0x04, 0x05, 0x04, 0xff, 0x08, 0x06, 0x02, 0xff, 0x08, 0x07, 0x04, 0xff, 0x03, 0x03, 0x00, 0xff, 0x03, 0x03, 0x02, 0xff, 0x03, 0x05, 0x05, 0xff, 0x00, 0x02, 0x03, 0xff, 0x01, 0x04, 0x05, 0xff, 0x01, 0x03, 0x05, 0xff, 0x0d, 0x0e, 0x11, 0xff, 0x0c, 0x0c, 0x0d, 0xff, 0x06, 0x05, 0x05, 0xff, 0x07, 0x04, 0x04, 0xff, 0x08, 0x04, 0x03, 0xff, 0x06, 0x03, 0x02, 0xff, 0x07, 0x04, 0x03, 0xff, 0x05, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x06, 0x04, 0x03, 0xff, 0x0e, 0x0c, 0x0b, 0xff, 0x0e, 0x0c, 0x0b, 0xff, 0x07, 0x05, 0x03, 0xff, 0x08, 0x02, 0x03, 0xff, 0x03, 0x01, 0x00, 0xff, 0x2d, 0x38, 0x32, 0xff, 0x38, 0x50, 0x45, 0xff, 0x30, 0x4e, 0x3f, 0xff, 0x37, 0x53, 0x45, 0xff, 0x3a, 0x55, 0x4a, 0xff, 0x39, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3a, 0x53, 0x49, 0xff, 0x39, 0x52, 0x48, 0xff, 0x38, 0x51, 0x48, 0xff, 0x38, 0x51, 0x46, 0xff, 0x37, 0x50, 0x44, 0xff, 0x37, 0x50, 0x44, 0xff, 0x37, 0x50, 0x44, 0xff, 0x36, 0x4e, 0x43, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x78, 0x64, 0x26, 0x63, 0x7f, 0x6d, 0xfa, 0x6f, 0x8a, 0x78, 0xff, 0x77, 0x93, 0x80, 0xff, 0x79, 0x99, 0x87, 0xff, 0x7a, 0xa0, 0x8f, 0xff, 0x80, 0x9e, 0x8c, 0xff, 0x9f, 0xb5, 0xa2, 0xff, 0x77, 0x88, 0x75, 0xff, 0x11, 0x1b, 0x0f, 0xff, 0x13, 0x16, 0x12, 0xff, 0x10, 0x0c, 0x10, 0xff, 0x01, 0x00, 0x02, 0xff, 0x02, 0x04, 0x00, 0xff, 0x05, 0x04, 0x03, 0xff, 0x0f, 0x0e, 0x0c, 0xff, 0x17, 0x15, 0x14, 0xff, 0x0b, 0x06, 0x08, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x00, 0x01, 0xff, 0x05, 0x02, 0x02, 0xff, 0x0c, 0x0a, 0x0a, 0xff, 0x0a, 0x08, 0x08, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x07, 0x05, 0x05, 0xff, 0x10, 0x0e, 0x0d, 0xff, 0x06, 0x04, 0x03, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x01, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x04, 0xff, 0x04, 0x03, 0x02, 0xff, 0x04, 0x02, 0x03, 0xff, 0x04, 0x01, 0x03, 0xff, 0x0c, 0x05, 0x02, 0xff, 0x0a, 0x04, 0x02, 0xff, 0x08, 0x0a, 0x08, 0xff, 0x0a, 0x0f, 0x0c, 0xff, 0x0a, 0x06, 0x03, 0xff, 0x09, 0x04, 0x01, 0xff, 0x04, 0x01, 0x02, 0xff, 0x04, 0x03, 0x09, 0xff, 0x01, 0x06, 0x15, 0xff, 0x00, 0x02, 0x0c, 0xff, 0x02, 0x00, 0x04, 0xff, 0x05, 0x03, 0x06, 0xff, 0x01, 0x01, 0x09, 0xff, 0x01, 0x01, 0x08, 0xff, 0x08, 0x06, 0x07, 0xff, 0x07, 0x04, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x03, 0x01, 0xff, 0x05, 0x0b, 0x08, 0xff, 0x09, 0x0f, 0x0d, 0xff, 0x10, 0x14, 0x12, 0xff, 0x0f, 0x11, 0x15, 0xff, 0x04, 0x05, 0x0d, 0xff, 0x05, 0x06, 0x0d, 0xff, 0x0d, 0x0f, 0x14, 0xff, 0x08, 0x0b, 0x11, 0xff, 0x06, 0x0b, 0x0f, 0xff, 0x08, 0x0f, 0x13, 0xff, 0x03, 0x0b, 0x10, 0xff, 0x14, 0x1c, 0x21, 0xff, 0x0c, 0x0e, 0x13, 0xff, 0x02, 0x04, 0x07, 0xff, 0x05, 0x09, 0x09, 0xff, 0x04, 0x08, 0x0a, 0xff, 0x09, 0x0c, 0x0b, 0xff, 0x04, 0x07, 0x09, 0xff, 0x03, 0x06, 0x0b, 0xff, 0x02, 0x03, 0x06, 0xff, 0x05, 0x07, 0x0a, 0xff, 0x07, 0x09, 0x0e, 0xff, 0x08, 0x0d, 0x12, 0xff, 0x06, 0x0a, 0x0c, 0xff, 0x01, 0x02, 0x03, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x0a, 0x05, 0x04, 0xff, 0x08, 0x03, 0x02, 0xff, 0x07, 0x02, 0x01, 0xff, 0x05, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x05, 0x03, 0x02, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x07, 0x06, 0x05, 0xff, 0x05, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x24, 0x30, 0x29, 0xff, 0x3d, 0x53, 0x47, 0xff, 0x36, 0x52, 0x43, 0xff, 0x37, 0x53, 0x46, 0xff, 0x39, 0x54, 0x4a, 0xff, 0x39, 0x55, 0x4b, 0xff, 0x3b, 0x55, 0x4b, 0xff, 0x3a, 0x54, 0x4a, 0xff, 0x3a, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3a, 0x53, 0x49, 0xff, 0x39, 0x52, 0x48, 0xff, 0x39, 0x52, 0x48, 0xff, 0x38, 0x52, 0x47, 0xff, 0x38, 0x52, 0x45, 0xff, 0x38, 0x52, 0x45, 0xff, 0x37, 0x52, 0x45, 0xff, 0x37, 0x50, 0x44, 0xfa, 0x35, 0x50, 0x43, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x7e, 0x6d, 0xb3, 0x6d, 0x8a, 0x76, 0xff, 0x76, 0x93, 0x7f, 0xff, 0x7c, 0x99, 0x85, 0xff, 0x7e, 0x9f, 0x8d, 0xff, 0x7f, 0xa1, 0x91, 0xff, 0x8c, 0xa8, 0x98, 0xff, 0xa4, 0xba, 0xa8, 0xff, 0x58, 0x67, 0x58, 0xff, 0x00, 0x05, 0x00, 0xff, 0x09, 0x0c, 0x07, 0xff, 0x04, 0x02, 0x07, 0xff, 0x02, 0x02, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0a, 0x0c, 0x0b, 0xff, 0x1d, 0x20, 0x1d, 0xff, 0x0b, 0x0d, 0x0c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x01, 0x01, 0xff, 0x03, 0x03, 0x03, 0xff, 0x05, 0x04, 0x03, 0xff, 0x0a, 0x08, 0x06, 0xff, 0x07, 0x05, 0x03, 0xff, 0x03, 0x01, 0x00, 0xff, 0x09, 0x07, 0x05, 0xff, 0x11, 0x0f, 0x0d, 0xff, 0x06, 0x04, 0x03, 0xff, 0x01, 0x00, 0x00, 0xff, 0x06, 0x04, 0x01, 0xff, 0x05, 0x03, 0x01, 0xff, 0x03, 0x02, 0x00, 0xff, 0x07, 0x05, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x07, 0x04, 0x04, 0xff, 0x06, 0x03, 0x04, 0xff, 0x06, 0x03, 0x03, 0xff, 0x0b, 0x08, 0x03, 0xff, 0x06, 0x06, 0x06, 0xff, 0x04, 0x0b, 0x0d, 0xff, 0x06, 0x0d, 0x0e, 0xff, 0x07, 0x04, 0x03, 0xff, 0x05, 0x01, 0x01, 0xff, 0x00, 0x00, 0x02, 0xff, 0x07, 0x0a, 0x17, 0xff, 0x08, 0x0a, 0x1f, 0xff, 0x0c, 0x0c, 0x13, 0xff, 0x10, 0x12, 0x07, 0xff, 0x08, 0x0e, 0x00, 0xff, 0x00, 0x06, 0x00, 0xff, 0x00, 0x02, 0x01, 0xff, 0x02, 0x00, 0x04, 0xff, 0x0a, 0x03, 0x08, 0xff, 0x0a, 0x07, 0x07, 0xff, 0x08, 0x07, 0x07, 0xff, 0x04, 0x05, 0x05, 0xff, 0x07, 0x09, 0x0a, 0xff, 0x05, 0x0a, 0x0d, 0xff, 0x05, 0x08, 0x13, 0xff, 0x00, 0x00, 0x11, 0xff, 0x02, 0x01, 0x11, 0xff, 0x05, 0x06, 0x15, 0xff, 0x09, 0x0c, 0x19, 0xff, 0x10, 0x15, 0x21, 0xff, 0x1a, 0x20, 0x2b, 0xff, 0x16, 0x1b, 0x26, 0xff, 0x0c, 0x11, 0x1a, 0xff, 0x05, 0x07, 0x0f, 0xff, 0x0a, 0x0f, 0x1a, 0xff, 0x0e, 0x19, 0x26, 0xff, 0x11, 0x1a, 0x27, 0xff, 0x03, 0x03, 0x0d, 0xff, 0x07, 0x09, 0x10, 0xff, 0x10, 0x10, 0x16, 0xff, 0x0b, 0x06, 0x07, 0xff, 0x09, 0x03, 0x04, 0xff, 0x0b, 0x0c, 0x12, 0xff, 0x0c, 0x13, 0x1a, 0xff, 0x08, 0x0d, 0x0e, 0xff, 0x08, 0x07, 0x07, 0xff, 0x09, 0x06, 0x05, 0xff, 0x07, 0x06, 0x04, 0xff, 0x06, 0x03, 0x02, 0xff, 0x05, 0x01, 0x00, 0xff, 0x04, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x07, 0x05, 0x04, 0xff, 0x04, 0x02, 0x01, 0xff, 0x07, 0x04, 0x03, 0xff, 0x05, 0x01, 0x01, 0xff, 0x00, 0x01, 0x00, 0xff, 0x15, 0x21, 0x19, 0xff, 0x38, 0x4b, 0x3f, 0xff, 0x3d, 0x57, 0x49, 0xff, 0x3a, 0x56, 0x49, 0xff, 0x3a, 0x55, 0x4b, 0xff, 0x39, 0x54, 0x4c, 0xff, 0x3a, 0x55, 0x4b, 0xff, 0x39, 0x55, 0x4b, 0xff, 0x3a, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3a, 0x53, 0x49, 0xff, 0x3a, 0x53, 0x49, 0xff, 0x39, 0x52, 0x47, 0xff, 0x38, 0x53, 0x45, 0xff, 0x38, 0x52, 0x45, 0xff, 0x37, 0x51, 0x44, 0xff, 0x37, 0x51, 0x44, 0xff, 0x35, 0x4f, 0x42, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x7b, 0x6c, 0x44, 0x6a, 0x83, 0x74, 0xff, 0x74, 0x8f, 0x7f, 0xff, 0x7b, 0x97, 0x87, 0xff, 0x7f, 0x9c, 0x8c, 0xff, 0x82, 0xa1, 0x92, 0xff, 0x83, 0xa2, 0x95, 0xff, 0x8d, 0xa5, 0x98, 0xff, 0x92, 0xa6, 0x97, 0xff, 0x49, 0x57, 0x4a, 0xff, 0x01, 0x03, 0x01, 0xff, 0x01, 0x02, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x01, 0x01, 0xff, 0x0c, 0x10, 0x0e, 0xff, 0x26, 0x2a, 0x28, 0xff, 0x22, 0x26, 0x24, 0xff, 0x0b, 0x0c, 0x0b, 0xff, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x02, 0xff, 0x04, 0x03, 0x03, 0xff, 0x09, 0x07, 0x06, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x11, 0x0f, 0x0e, 0xff, 0x0d, 0x0b, 0x0a, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x01, 0x01, 0xff, 0x06, 0x06, 0x01, 0xff, 0x04, 0x05, 0x00, 0xff, 0x09, 0x09, 0x04, 0xff, 0x0f, 0x0f, 0x09, 0xff, 0x0b, 0x0a, 0x06, 0xff, 0x0d, 0x0b, 0x09, 0xff, 0x09, 0x07, 0x06, 0xff, 0x0e, 0x0b, 0x09, 0xff, 0x0d, 0x0d, 0x09, 0xff, 0x05, 0x0a, 0x07, 0xff, 0x03, 0x0b, 0x0c, 0xff, 0x04, 0x0c, 0x0b, 0xff, 0x07, 0x07, 0x02, 0xff, 0x01, 0x00, 0x00, 0xff, 0x00, 0x02, 0x07, 0xff, 0x09, 0x10, 0x1e, 0xff, 0x0e, 0x11, 0x20, 0xff, 0x12, 0x14, 0x19, 0xff, 0x0b, 0x0f, 0x09, 0xff, 0x00, 0x06, 0x00, 0xff, 0x01, 0x08, 0x06, 0xff, 0x00, 0x05, 0x0a, 0xff, 0x01, 0x03, 0x0c, 0xff, 0x04, 0x03, 0x0d, 0xff, 0x0e, 0x0e, 0x1a, 0xff, 0x0f, 0x10, 0x1d, 0xff, 0x16, 0x17, 0x25, 0xff, 0x0d, 0x12, 0x20, 0xff, 0x00, 0x07, 0x19, 0xff, 0x0c, 0x18, 0x31, 0xff, 0x1d, 0x2a, 0x46, 0xff, 0x23, 0x2f, 0x4c, 0xff, 0x10, 0x1a, 0x39, 0xff, 0x02, 0x0a, 0x26, 0xff, 0x00, 0x04, 0x21, 0xff, 0x05, 0x0b, 0x26, 0xff, 0x09, 0x0c, 0x26, 0xff, 0x00, 0x00, 0x19, 0xff, 0x05, 0x0e, 0x24, 0xff, 0x0a, 0x1a, 0x34, 0xff, 0x0f, 0x26, 0x43, 0xff, 0x31, 0x42, 0x5d, 0xff, 0x18, 0x23, 0x3b, 0xff, 0x06, 0x0c, 0x1d, 0xff, 0x0d, 0x0e, 0x18, 0xff, 0x05, 0x02, 0x08, 0xff, 0x11, 0x0b, 0x0c, 0xff, 0x0a, 0x0c, 0x16, 0xff, 0x0d, 0x18, 0x25, 0xff, 0x0d, 0x14, 0x1a, 0xff, 0x09, 0x0a, 0x0a, 0xff, 0x09, 0x06, 0x06, 0xff, 0x07, 0x05, 0x05, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x02, 0x02, 0xff, 0x03, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x07, 0x05, 0x04, 0xff, 0x07, 0x05, 0x04, 0xff, 0x06, 0x02, 0x02, 0xff, 0x05, 0x07, 0x03, 0xff, 0x1b, 0x27, 0x1f, 0xff, 0x2d, 0x40, 0x35, 0xff, 0x3d, 0x57, 0x49, 0xff, 0x3b, 0x57, 0x4a, 0xff, 0x3a, 0x55, 0x4b, 0xff, 0x3a, 0x55, 0x4c, 0xff, 0x3a, 0x55, 0x4b, 0xff, 0x3a, 0x55, 0x4b, 0xff, 0x3b, 0x55, 0x4b, 0xff, 0x3c, 0x55, 0x4b, 0xff, 0x3c, 0x55, 0x4b, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3a, 0x53, 0x49, 0xff, 0x3a, 0x53, 0x48, 0xff, 0x39, 0x53, 0x46, 0xff, 0x3a, 0x54, 0x47, 0xff, 0x39, 0x53, 0x46, 0xff, 0x38, 0x52, 0x45, 0xff, 0x37, 0x51, 0x44, 0xff, 0x34, 0x4e, 0x43, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x7f, 0x71, 0xc8, 0x6b, 0x86, 0x78, 0xff, 0x75, 0x90, 0x83, 0xff, 0x7c, 0x98, 0x8a, 0xff, 0x7f, 0x9c, 0x8e, 0xff, 0x80, 0x9e, 0x91, 0xff, 0x82, 0x9f, 0x96, 0xff, 0x85, 0x9c, 0x91, 0xff, 0x83, 0x94, 0x88, 0xff, 0x60, 0x6d, 0x62, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x0c, 0x0b, 0xff, 0x00, 0x00, 0x00, 0xff, 0x10, 0x16, 0x14, 0xff, 0x33, 0x38, 0x36, 0xff, 0x31, 0x37, 0x34, 0xff, 0x18, 0x1b, 0x1a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xff, 0x02, 0x03, 0x04, 0xff, 0x05, 0x04, 0x03, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x0b, 0x09, 0x07, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x04, 0x02, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x09, 0x06, 0x06, 0xff, 0x07, 0x07, 0x02, 0xff, 0x06, 0x07, 0x00, 0xff, 0x1d, 0x1e, 0x14, 0xff, 0x1e, 0x1f, 0x15, 0xff, 0x1a, 0x1a, 0x13, 0xff, 0x12, 0x12, 0x0c, 0xff, 0x07, 0x07, 0x02, 0xff, 0x10, 0x10, 0x0b, 0xff, 0x12, 0x11, 0x08, 0xff, 0x0f, 0x10, 0x08, 0xff, 0x07, 0x0b, 0x07, 0xff, 0x0d, 0x0e, 0x0a, 0xff, 0x0d, 0x0b, 0x03, 0xff, 0x02, 0x01, 0x00, 0xff, 0x04, 0x05, 0x0d, 0xff, 0x0c, 0x13, 0x21, 0xff, 0x05, 0x0e, 0x1a, 0xff, 0x00, 0x05, 0x13, 0xff, 0x00, 0x01, 0x15, 0xff, 0x03, 0x08, 0x22, 0xff, 0x0c, 0x17, 0x39, 0xff, 0x13, 0x20, 0x3b, 0xff, 0x07, 0x0d, 0x19, 0xff, 0x08, 0x0d, 0x16, 0xff, 0x1b, 0x27, 0x45, 0xff, 0x1d, 0x28, 0x47, 0xff, 0x1c, 0x28, 0x48, 0xff, 0x0d, 0x1d, 0x3d, 0xff, 0x1b, 0x2e, 0x53, 0xff, 0x35, 0x4c, 0x77, 0xff, 0x37, 0x54, 0x82, 0xff, 0x3f, 0x5c, 0x8a, 0xff, 0x51, 0x6b, 0x99, 0xff, 0x48, 0x61, 0x8d, 0xff, 0x38, 0x4f, 0x7b, 0xff, 0x35, 0x4a, 0x75, 0xff, 0x39, 0x4c, 0x76, 0xff, 0x39, 0x4f, 0x78, 0xff, 0x47, 0x5c, 0x83, 0xff, 0x34, 0x4e, 0x79, 0xff, 0x26, 0x45, 0x75, 0xff, 0x3a, 0x54, 0x7f, 0xff, 0x3e, 0x52, 0x75, 0xff, 0x0c, 0x18, 0x35, 0xff, 0x00, 0x06, 0x1c, 0xff, 0x00, 0x00, 0x0e, 0xff, 0x0f, 0x08, 0x11, 0xff, 0x19, 0x20, 0x32, 0xff, 0x19, 0x29, 0x3e, 0xff, 0x0e, 0x18, 0x24, 0xff, 0x0a, 0x0d, 0x14, 0xff, 0x09, 0x07, 0x07, 0xff, 0x05, 0x04, 0x03, 0xff, 0x02, 0x03, 0x03, 0xff, 0x01, 0x03, 0x03, 0xff, 0x04, 0x03, 0x03, 0xff, 0x04, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x08, 0x06, 0x05, 0xff, 0x08, 0x05, 0x04, 0xff, 0x06, 0x02, 0x01, 0xff, 0x04, 0x06, 0x03, 0xff, 0x2d, 0x3a, 0x32, 0xff, 0x3b, 0x4f, 0x43, 0xff, 0x39, 0x53, 0x45, 0xff, 0x3c, 0x56, 0x49, 0xff, 0x3c, 0x57, 0x4e, 0xff, 0x3c, 0x56, 0x4e, 0xff, 0x3b, 0x56, 0x4c, 0xff, 0x3b, 0x56, 0x4c, 0xff, 0x3c, 0x56, 0x4c, 0xff, 0x3c, 0x55, 0x4b, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3a, 0x53, 0x49, 0xff, 0x39, 0x53, 0x48, 0xff, 0x39, 0x53, 0x46, 0xff, 0x39, 0x53, 0x46, 0xff, 0x38, 0x52, 0x45, 0xff, 0x38, 0x52, 0x45, 0xff, 0x37, 0x51, 0x44, 0xff, 0x36, 0x51, 0x44, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x7a, 0x6d, 0x4d, 0x65, 0x80, 0x74, 0xff, 0x6a, 0x86, 0x7a, 0xff, 0x73, 0x8f, 0x83, 0xff, 0x7b, 0x96, 0x8b, 0xff, 0x7c, 0x98, 0x8d, 0xff, 0x7b, 0x98, 0x8d, 0xff, 0x7f, 0x99, 0x8f, 0xff, 0x7d, 0x93, 0x88, 0xff, 0x72, 0x7f, 0x75, 0xff, 0x6a, 0x74, 0x6b, 0xff, 0x1b, 0x21, 0x1a, 0xff, 0x06, 0x0b, 0x04, 0xff, 0x2c, 0x2f, 0x25, 0xff, 0x11, 0x15, 0x0e, 0xff, 0x00, 0x01, 0x00, 0xff, 0x3c, 0x40, 0x3e, 0xff, 0x3e, 0x41, 0x41, 0xff, 0x03, 0x05, 0x05, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x02, 0x02, 0xff, 0x01, 0x03, 0x02, 0xff, 0x03, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x06, 0x04, 0x03, 0xff, 0x08, 0x06, 0x05, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x08, 0x05, 0x05, 0xff, 0x06, 0x06, 0x00, 0xff, 0x11, 0x12, 0x07, 0xff, 0x28, 0x29, 0x21, 0xff, 0x22, 0x22, 0x1b, 0xff, 0x1c, 0x1c, 0x15, 0xff, 0x0c, 0x0c, 0x06, 0xff, 0x04, 0x04, 0x00, 0xff, 0x0f, 0x0f, 0x09, 0xff, 0x1a, 0x15, 0x09, 0xff, 0x1c, 0x16, 0x0d, 0xff, 0x0a, 0x08, 0x03, 0xff, 0x0e, 0x0c, 0x04, 0xff, 0x0f, 0x0a, 0x04, 0xff, 0x08, 0x02, 0x00, 0xff, 0x03, 0x00, 0x07, 0xff, 0x09, 0x0c, 0x21, 0xff, 0x02, 0x11, 0x27, 0xff, 0x08, 0x14, 0x32, 0xff, 0x1a, 0x22, 0x51, 0xff, 0x22, 0x2b, 0x68, 0xff, 0x2c, 0x3d, 0x7d, 0xff, 0x34, 0x49, 0x78, 0xff, 0x1c, 0x29, 0x3c, 0xff, 0x09, 0x15, 0x22, 0xff, 0x29, 0x43, 0x70, 0xff, 0x17, 0x30, 0x5d, 0xff, 0x17, 0x2f, 0x5c, 0xff, 0x3a, 0x51, 0x7f, 0xff, 0x54, 0x6d, 0x9c, 0xff, 0x63, 0x80, 0xb3, 0xff, 0x61, 0x84, 0xb9, 0xff, 0x59, 0x7e, 0xb2, 0xff, 0x6a, 0x8d, 0xc0, 0xff, 0x69, 0x8d, 0xbf, 0xff, 0x65, 0x89, 0xbb, 0xff, 0x6d, 0x91, 0xc4, 0xff, 0x6e, 0x90, 0xc7, 0xff, 0x73, 0x95, 0xcb, 0xff, 0x57, 0x7a, 0xad, 0xff, 0x47, 0x6c, 0xa0, 0xff, 0x4c, 0x73, 0xa8, 0xff, 0x54, 0x75, 0xa5, 0xff, 0x4c, 0x66, 0x91, 0xff, 0x16, 0x2e, 0x53, 0xff, 0x07, 0x19, 0x3a, 0xff, 0x00, 0x04, 0x20, 0xff, 0x11, 0x16, 0x2c, 0xff, 0x26, 0x37, 0x56, 0xff, 0x18, 0x2d, 0x4f, 0xff, 0x0f, 0x1b, 0x31, 0xff, 0x0a, 0x0d, 0x1b, 0xff, 0x02, 0x02, 0x05, 0xff, 0x05, 0x06, 0x03, 0xff, 0x03, 0x03, 0x04, 0xff, 0x01, 0x02, 0x03, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x08, 0x06, 0x05, 0xff, 0x07, 0x05, 0x04, 0xff, 0x08, 0x04, 0x04, 0xff, 0x01, 0x01, 0x01, 0xff, 0x24, 0x30, 0x27, 0xff, 0x44, 0x57, 0x4a, 0xff, 0x3b, 0x55, 0x48, 0xff, 0x39, 0x56, 0x49, 0xff, 0x3b, 0x58, 0x4c, 0xff, 0x3b, 0x57, 0x4e, 0xff, 0x3c, 0x56, 0x4d, 0xff, 0x3b, 0x56, 0x4c, 0xff, 0x3c, 0x56, 0x4c, 0xff, 0x3d, 0x56, 0x4c, 0xff, 0x3c, 0x54, 0x4a, 0xff, 0x3b, 0x53, 0x49, 0xff, 0x3b, 0x53, 0x49, 0xff, 0x3a, 0x53, 0x48, 0xff, 0x3a, 0x52, 0x46, 0xff, 0x39, 0x52, 0x46, 0xff, 0x39, 0x51, 0x45, 0xff, 0x38, 0x51, 0x45, 0xff, 0x38, 0x52, 0x45, 0xff, 0x38, 0x52, 0x45, 0xff, 0x42, 0x5c, 0x4f, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x77, 0x6e, 0xcd, 0x66, 0x7e, 0x76, 0xff, 0x6c, 0x84, 0x7d, 0xff, 0x71, 0x8b, 0x82, 0xff, 0x78, 0x91, 0x89, 0xff, 0x78, 0x91, 0x8a, 0xff, 0x7a, 0x93, 0x89, 0xff, 0x7a, 0x94, 0x86, 0xff, 0x73, 0x8a, 0x7d, 0xff, 0x65, 0x75, 0x69, 0xff, 0x57, 0x60, 0x54, 0xff, 0x57, 0x5f, 0x53, 0xff, 0x46, 0x4e, 0x3f, 0xff, 0x35, 0x3d, 0x2a, 0xff, 0x1c, 0x20, 0x16, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x23, 0x23, 0xff, 0x2f, 0x32, 0x31, 0xff, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x06, 0x04, 0x03, 0xff, 0x0b, 0x09, 0x08, 0xff, 0x08, 0x06, 0x06, 0xff, 0x08, 0x08, 0x02, 0xff, 0x18, 0x19, 0x0f, 0xff, 0x1a, 0x1b, 0x14, 0xff, 0x13, 0x14, 0x0e, 0xff, 0x16, 0x15, 0x10, 0xff, 0x08, 0x07, 0x03, 0xff, 0x06, 0x04, 0x02, 0xff, 0x0e, 0x0c, 0x0a, 0xff, 0x17, 0x13, 0x0a, 0xff, 0x18, 0x13, 0x0d, 0xff, 0x08, 0x05, 0x02, 0xff, 0x08, 0x08, 0x02, 0xff, 0x06, 0x04, 0x04, 0xff, 0x04, 0x00, 0x06, 0xff, 0x02, 0x03, 0x18, 0xff, 0x04, 0x11, 0x39, 0xff, 0x0e, 0x27, 0x5a, 0xff, 0x26, 0x3e, 0x72, 0xff, 0x39, 0x52, 0x8a, 0xff, 0x40, 0x5c, 0x9a, 0xff, 0x45, 0x64, 0xa1, 0xff, 0x5a, 0x79, 0xae, 0xff, 0x45, 0x5d, 0x82, 0xff, 0x0b, 0x23, 0x46, 0xff, 0x37, 0x59, 0x93, 0xff, 0x4e, 0x6d, 0xa3, 0xff, 0x5c, 0x76, 0xa7, 0xff, 0x6e, 0x86, 0xb6, 0xff, 0x72, 0x91, 0xbe, 0xff, 0x8a, 0xac, 0xd9, 0xff, 0x89, 0xb0, 0xdd, 0xff, 0x8a, 0xb1, 0xdd, 0xff, 0x82, 0xa5, 0xce, 0xff, 0x78, 0x9d, 0xca, 0xff, 0x73, 0x98, 0xc8, 0xff, 0x6a, 0x90, 0xc2, 0xff, 0x5f, 0x86, 0xbc, 0xff, 0x5c, 0x84, 0xbe, 0xff, 0x4f, 0x78, 0xb0, 0xff, 0x5d, 0x87, 0xbd, 0xff, 0x64, 0x8d, 0xbf, 0xff, 0x66, 0x8d, 0xbe, 0xff, 0x5d, 0x81, 0xb4, 0xff, 0x42, 0x66, 0x95, 0xff, 0x32, 0x52, 0x7d, 0xff, 0x27, 0x42, 0x6e, 0xff, 0x23, 0x41, 0x6a, 0xff, 0x2f, 0x50, 0x80, 0xff, 0x13, 0x32, 0x62, 0xff, 0x0a, 0x1c, 0x3f, 0xff, 0x06, 0x0c, 0x22, 0xff, 0x05, 0x08, 0x12, 0xff, 0x07, 0x09, 0x07, 0xff, 0x02, 0x01, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x04, 0x03, 0x02, 0xff, 0x06, 0x03, 0x03, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x07, 0x05, 0x04, 0xff, 0x09, 0x07, 0x06, 0xff, 0x05, 0x03, 0x02, 0xff, 0x07, 0x02, 0x02, 0xff, 0x02, 0x03, 0x01, 0xff, 0x26, 0x33, 0x29, 0xff, 0x45, 0x58, 0x4b, 0xff, 0x3d, 0x55, 0x49, 0xff, 0x3b, 0x58, 0x4a, 0xff, 0x3b, 0x59, 0x4c, 0xff, 0x3d, 0x57, 0x4d, 0xff, 0x3c, 0x57, 0x4d, 0xff, 0x3c, 0x57, 0x4d, 0xff, 0x3d, 0x57, 0x4d, 0xff, 0x3d, 0x56, 0x4c, 0xff, 0x3d, 0x55, 0x4b, 0xff, 0x3c, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3b, 0x53, 0x48, 0xff, 0x3b, 0x53, 0x46, 0xff, 0x3a, 0x53, 0x46, 0xff, 0x3a, 0x53, 0x46, 0xff, 0x39, 0x52, 0x45, 0xff, 0x39, 0x53, 0x46, 0xff, 0x37, 0x51, 0x43, 0xff, 0x39, 0x54, 0x44, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x6b, 0x67, 0x40, 0x5a, 0x71, 0x6c, 0xff, 0x61, 0x77, 0x73, 0xff, 0x69, 0x7f, 0x7a, 0xff, 0x6f, 0x86, 0x7f, 0xff, 0x74, 0x8b, 0x84, 0xff, 0x75, 0x8c, 0x86, 0xff, 0x73, 0x8c, 0x82, 0xff, 0x70, 0x8b, 0x7c, 0xff, 0x6a, 0x82, 0x73, 0xff, 0x5d, 0x6f, 0x61, 0xff, 0x4a, 0x56, 0x49, 0xff, 0x4e, 0x57, 0x49, 0xff, 0x56, 0x5e, 0x4e, 0xff, 0x58, 0x61, 0x4c, 0xff, 0x27, 0x2a, 0x20, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1e, 0x21, 0x1c, 0xff, 0x11, 0x0e, 0x0c, 0xff, 0x02, 0x00, 0x00, 0xff, 0x06, 0x00, 0x01, 0xff, 0x07, 0x01, 0x02, 0xff, 0x05, 0x02, 0x02, 0xff, 0x05, 0x04, 0x03, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x09, 0x07, 0x06, 0xff, 0x0b, 0x09, 0x08, 0xff, 0x07, 0x06, 0x05, 0xff, 0x0d, 0x0c, 0x07, 0xff, 0x11, 0x11, 0x0b, 0xff, 0x0c, 0x0c, 0x06, 0xff, 0x0c, 0x0c, 0x07, 0xff, 0x0e, 0x0c, 0x0a, 0xff, 0x04, 0x02, 0x01, 0xff, 0x09, 0x07, 0x07, 0xff, 0x0c, 0x0a, 0x0a, 0xff, 0x10, 0x0c, 0x09, 0xff, 0x0c, 0x0a, 0x08, 0xff, 0x01, 0x01, 0x02, 0xff, 0x03, 0x05, 0x09, 0xff, 0x0f, 0x0d, 0x16, 0xff, 0x03, 0x03, 0x18, 0xff, 0x14, 0x20, 0x45, 0xff, 0x2d, 0x45, 0x7f, 0xff, 0x2a, 0x46, 0xa1, 0xff, 0x41, 0x61, 0xaa, 0xff, 0x50, 0x79, 0xa7, 0xff, 0x62, 0x95, 0xb8, 0xff, 0x60, 0x96, 0xc0, 0xff, 0x65, 0x92, 0xc4, 0xff, 0x56, 0x72, 0xaa, 0xff, 0x2d, 0x44, 0x80, 0xff, 0x67, 0x8c, 0xc9, 0xff, 0x82, 0xa4, 0xd9, 0xff, 0x7e, 0x9b, 0xca, 0xff, 0x91, 0xab, 0xd3, 0xff, 0xa2, 0xbd, 0xdf, 0xff, 0x99, 0xb7, 0xd7, 0xff, 0x93, 0xb6, 0xd3, 0xff, 0x94, 0xb8, 0xd5, 0xff, 0x97, 0xb9, 0xd8, 0xff, 0x94, 0xb6, 0xda, 0xff, 0x89, 0xaa, 0xd3, 0xff, 0x7e, 0xa2, 0xcc, 0xff, 0x72, 0x9a, 0xc7, 0xff, 0x6c, 0x94, 0xc7, 0xff, 0x65, 0x8d, 0xc4, 0xff, 0x6e, 0x96, 0xcb, 0xff, 0x69, 0x91, 0xc1, 0xff, 0x6e, 0x97, 0xcb, 0xff, 0x6f, 0x9a, 0xd0, 0xff, 0x67, 0x92, 0xc8, 0xff, 0x5b, 0x85, 0xba, 0xff, 0x57, 0x83, 0xba, 0xff, 0x4e, 0x7c, 0xb4, 0xff, 0x40, 0x67, 0xa3, 0xff, 0x29, 0x49, 0x83, 0xff, 0x20, 0x3a, 0x61, 0xff, 0x1a, 0x29, 0x3a, 0xff, 0x11, 0x18, 0x22, 0xff, 0x0c, 0x0f, 0x11, 0xff, 0x02, 0x01, 0x00, 0xff, 0x03, 0x05, 0x05, 0xff, 0x04, 0x04, 0x03, 0xff, 0x06, 0x02, 0x03, 0xff, 0x06, 0x04, 0x05, 0xff, 0x07, 0x04, 0x05, 0xff, 0x0a, 0x08, 0x08, 0xff, 0x09, 0x07, 0x06, 0xff, 0x09, 0x07, 0x06, 0xff, 0x06, 0x03, 0x03, 0xff, 0x07, 0x03, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1d, 0x2a, 0x23, 0xff, 0x40, 0x56, 0x4a, 0xff, 0x3d, 0x57, 0x49, 0xff, 0x3f, 0x5a, 0x4d, 0xff, 0x3f, 0x5a, 0x50, 0xff, 0x40, 0x58, 0x4e, 0xff, 0x3d, 0x58, 0x4e, 0xff, 0x3c, 0x57, 0x4d, 0xff, 0x3d, 0x57, 0x4d, 0xff, 0x3e, 0x57, 0x4d, 0xff, 0x3c, 0x56, 0x4c, 0xff, 0x3c, 0x55, 0x4b, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3a, 0x54, 0x49, 0xff, 0x3a, 0x54, 0x46, 0xff, 0x3a, 0x54, 0x46, 0xff, 0x3a, 0x54, 0x45, 0xff, 0x38, 0x52, 0x43, 0xff, 0x38, 0x52, 0x44, 0xff, 0x38, 0x53, 0x44, 0xff, 0x38, 0x53, 0x44, 0xff, 0x37, 0x4f, 0x43, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x66, 0x5c, 0xb3, 0x54, 0x6b, 0x63, 0xff, 0x5b, 0x72, 0x6a, 0xff, 0x62, 0x79, 0x70, 0xff, 0x6a, 0x80, 0x77, 0xff, 0x6f, 0x85, 0x7c, 0xff, 0x6f, 0x86, 0x7e, 0xff, 0x6c, 0x82, 0x78, 0xff, 0x69, 0x7d, 0x72, 0xff, 0x63, 0x76, 0x6b, 0xff, 0x57, 0x64, 0x58, 0xff, 0x4e, 0x56, 0x4a, 0xff, 0x4d, 0x56, 0x4a, 0xff, 0x4d, 0x54, 0x46, 0xff, 0x5f, 0x66, 0x55, 0xff, 0x3a, 0x3c, 0x31, 0xff, 0x0b, 0x09, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x05, 0x02, 0x03, 0xff, 0x08, 0x04, 0x05, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x01, 0x01, 0xff, 0x04, 0x00, 0x02, 0xff, 0x05, 0x02, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x0b, 0x09, 0x08, 0xff, 0x0e, 0x0c, 0x0b, 0xff, 0x07, 0x05, 0x04, 0xff, 0x05, 0x03, 0x03, 0xff, 0x0a, 0x09, 0x06, 0xff, 0x09, 0x08, 0x04, 0xff, 0x09, 0x07, 0x04, 0xff, 0x0c, 0x0a, 0x08, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x07, 0x05, 0x05, 0xff, 0x0a, 0x08, 0x09, 0xff, 0x06, 0x04, 0x05, 0xff, 0x10, 0x08, 0x04, 0xff, 0x07, 0x05, 0x02, 0xff, 0x00, 0x00, 0x06, 0xff, 0x09, 0x0f, 0x24, 0xff, 0x17, 0x20, 0x38, 0xff, 0x09, 0x1a, 0x3e, 0xff, 0x1e, 0x3a, 0x6e, 0xff, 0x3b, 0x5e, 0xa1, 0xff, 0x4c, 0x74, 0xc2, 0xff, 0x5e, 0x85, 0xc3, 0xff, 0x6e, 0x96, 0xbf, 0xff, 0x7e, 0xaa, 0xc8, 0xff, 0x7b, 0xaa, 0xca, 0xff, 0x6f, 0x9c, 0xc8, 0xff, 0x57, 0x7a, 0xb1, 0xff, 0x42, 0x62, 0x99, 0xff, 0x8d, 0xb5, 0xe0, 0xff, 0x82, 0xa7, 0xd2, 0xff, 0x82, 0xa3, 0xcf, 0xff, 0x93, 0xaf, 0xdb, 0xff, 0xa1, 0xb9, 0xe0, 0xff, 0x9c, 0xb7, 0xda, 0xff, 0x9a, 0xbc, 0xd9, 0xff, 0xa0, 0xc0, 0xdc, 0xff, 0xa4, 0xc0, 0xe0, 0xff, 0xa0, 0xbd, 0xdf, 0xff, 0x9d, 0xbb, 0xde, 0xff, 0x91, 0xb2, 0xd6, 0xff, 0x91, 0xb4, 0xdc, 0xff, 0x85, 0xaa, 0xd7, 0xff, 0x79, 0xa2, 0xce, 0xff, 0x82, 0xab, 0xdb, 0xff, 0x70, 0x99, 0xcc, 0xff, 0x69, 0x94, 0xc7, 0xff, 0x79, 0xa6, 0xd8, 0xff, 0x7c, 0xa7, 0xda, 0xff, 0x6d, 0x9b, 0xce, 0xff, 0x66, 0x96, 0xc8, 0xff, 0x70, 0x9c, 0xce, 0xff, 0x58, 0x82, 0xb6, 0xff, 0x3e, 0x6b, 0xa1, 0xff, 0x34, 0x5c, 0x8d, 0xff, 0x1d, 0x38, 0x5c, 0xff, 0x11, 0x1e, 0x31, 0xff, 0x12, 0x15, 0x15, 0xff, 0x0b, 0x09, 0x07, 0xff, 0x04, 0x08, 0x06, 0xff, 0x06, 0x07, 0x04, 0xff, 0x07, 0x04, 0x01, 0xff, 0x06, 0x04, 0x01, 0xff, 0x08, 0x07, 0x03, 0xff, 0x0d, 0x0b, 0x0a, 0xff, 0x0d, 0x0a, 0x0a, 0xff, 0x09, 0x06, 0x05, 0xff, 0x07, 0x04, 0x04, 0xff, 0x08, 0x03, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x1d, 0x2b, 0x24, 0xff, 0x3b, 0x52, 0x48, 0xff, 0x3c, 0x5a, 0x4d, 0xff, 0x3b, 0x5b, 0x50, 0xff, 0x3b, 0x5a, 0x4f, 0xff, 0x3e, 0x58, 0x4f, 0xff, 0x3d, 0x58, 0x4e, 0xff, 0x3b, 0x57, 0x4d, 0xff, 0x3c, 0x56, 0x4c, 0xff, 0x3e, 0x56, 0x4c, 0xff, 0x3d, 0x56, 0x4c, 0xff, 0x3c, 0x55, 0x4b, 0xff, 0x3b, 0x54, 0x4b, 0xff, 0x3b, 0x54, 0x49, 0xff, 0x3b, 0x54, 0x49, 0xff, 0x3a, 0x54, 0x48, 0xff, 0x39, 0x53, 0x48, 0xff, 0x39, 0x52, 0x47, 0xff, 0x3a, 0x53, 0x48, 0xff, 0x39, 0x53, 0x48, 0xff, 0x3a, 0x53, 0x48, 0xff, 0x37, 0x51, 0x47, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x5a, 0x4b, 0x22, 0x4a, 0x5e, 0x55, 0xfe, 0x4e, 0x63, 0x5a, 0xff, 0x54, 0x69, 0x60, 0xff, 0x5b, 0x6f, 0x66, 0xff, 0x64, 0x78, 0x6f, 0xff, 0x68, 0x7b, 0x72, 0xff, 0x67, 0x7b, 0x72, 0xff, 0x64, 0x76, 0x6d, 0xff, 0x62, 0x73, 0x68, 0xff, 0x5c, 0x6b, 0x61, 0xff, 0x53, 0x5e, 0x54, 0xff, 0x50, 0x59, 0x4e, 0xff, 0x50, 0x59, 0x4c, 0xff, 0x51, 0x59, 0x4a, 0xff, 0x4e, 0x54, 0x42, 0xff, 0x2e, 0x32, 0x23, 0xff, 0x20, 0x1f, 0x17, 0xff, 0x0d, 0x0b, 0x09, 0xff, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x02, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x03, 0x02, 0xff, 0x03, 0x01, 0x00, 0xff, 0x0b, 0x09, 0x08, 0xff, 0x11, 0x0f, 0x0e, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x09, 0x07, 0x04, 0xff, 0x08, 0x07, 0x02, 0xff, 0x07, 0x06, 0x02, 0xff, 0x08, 0x06, 0x04, 0xff, 0x06, 0x04, 0x04, 0xff, 0x06, 0x04, 0x04, 0xff, 0x08, 0x06, 0x06, 0xff, 0x06, 0x04, 0x02, 0xff, 0x0c, 0x06, 0x00, 0xff, 0x05, 0x01, 0x00, 0xff, 0x03, 0x05, 0x14, 0xff, 0x13, 0x20, 0x3b, 0xff, 0x0b, 0x1c, 0x3e, 0xff, 0x0c, 0x25, 0x52, 0xff, 0x2c, 0x51, 0x8d, 0xff, 0x44, 0x70, 0xb3, 0xff, 0x53, 0x83, 0xba, 0xff, 0x66, 0x91, 0xc2, 0xff, 0x84, 0xa8, 0xd6, 0xff, 0x83, 0xa3, 0xcd, 0xff, 0x83, 0xa3, 0xc8, 0xff, 0x83, 0xa7, 0xd2, 0xff, 0x4c, 0x75, 0xa8, 0xff, 0x55, 0x80, 0xb1, 0xff, 0x9e, 0xc6, 0xe9, 0xff, 0x8c, 0xb0, 0xd6, 0xff, 0x92, 0xb4, 0xde, 0xff, 0x9c, 0xba, 0xe8, 0xff, 0x99, 0xb7, 0xe3, 0xff, 0x9f, 0xbe, 0xe7, 0xff, 0x9a, 0xbf, 0xe3, 0xff, 0x9d, 0xbf, 0xe0, 0xff, 0xa6, 0xc0, 0xe0, 0xff, 0x9d, 0xb9, 0xdb, 0xff, 0x9d, 0xba, 0xdc, 0xff, 0x96, 0xb5, 0xd8, 0xff, 0x93, 0xb6, 0xdd, 0xff, 0x86, 0xac, 0xd7, 0xff, 0x8a, 0xb3, 0xdc, 0xff, 0x78, 0xa5, 0xd0, 0xff, 0x71, 0xa0, 0xcf, 0xff, 0x76, 0xa3, 0xd1, 0xff, 0x82, 0xad, 0xda, 0xff, 0x82, 0xad, 0xda, 0xff, 0x78, 0xa4, 0xd0, 0xff, 0x7b, 0xa6, 0xd2, 0xff, 0x7e, 0xa6, 0xd1, 0xff, 0x63, 0x92, 0xbc, 0xff, 0x48, 0x7d, 0xae, 0xff, 0x38, 0x68, 0xa2, 0xff, 0x20, 0x42, 0x78, 0xff, 0x17, 0x26, 0x41, 0xff, 0x1a, 0x1c, 0x1c, 0xff, 0x13, 0x13, 0x0f, 0xff, 0x06, 0x0d, 0x0c, 0xff, 0x0a, 0x0c, 0x08, 0xff, 0x0e, 0x0c, 0x07, 0xff, 0x05, 0x05, 0x01, 0xff, 0x08, 0x06, 0x04, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x08, 0x06, 0x05, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x00, 0x00, 0xff, 0x07, 0x09, 0x04, 0xff, 0x2a, 0x39, 0x30, 0xff, 0x3b, 0x55, 0x4b, 0xff, 0x3b, 0x5b, 0x51, 0xff, 0x39, 0x5b, 0x50, 0xff, 0x3b, 0x59, 0x4e, 0xff, 0x40, 0x58, 0x4f, 0xff, 0x3e, 0x58, 0x4e, 0xff, 0x3c, 0x57, 0x4d, 0xff, 0x3c, 0x56, 0x4c, 0xff, 0x3c, 0x56, 0x4c, 0xff, 0x3c, 0x56, 0x4c, 0xff, 0x3b, 0x56, 0x4c, 0xff, 0x3b, 0x55, 0x4b, 0xff, 0x3a, 0x55, 0x4b, 0xff, 0x3a, 0x54, 0x4a, 0xff, 0x3a, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3a, 0x53, 0x49, 0xff, 0x39, 0x52, 0x49, 0xff, 0x39, 0x52, 0x49, 0xff, 0x39, 0x52, 0x48, 0xfe, 0x34, 0x52, 0x4b, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x4f, 0x42, 0x86, 0x43, 0x55, 0x4b, 0xff, 0x48, 0x59, 0x50, 0xff, 0x4d, 0x5e, 0x55, 0xff, 0x52, 0x63, 0x5a, 0xff, 0x59, 0x6b, 0x62, 0xff, 0x5c, 0x6e, 0x64, 0xff, 0x5b, 0x6d, 0x64, 0xff, 0x58, 0x68, 0x5e, 0xff, 0x54, 0x63, 0x56, 0xff, 0x4c, 0x5a, 0x4c, 0xff, 0x48, 0x54, 0x47, 0xff, 0x49, 0x54, 0x46, 0xff, 0x4e, 0x56, 0x47, 0xff, 0x4c, 0x53, 0x42, 0xff, 0x46, 0x4d, 0x39, 0xff, 0x37, 0x3b, 0x2b, 0xff, 0x11, 0x11, 0x0b, 0xff, 0x09, 0x07, 0x05, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x03, 0xff, 0x03, 0x00, 0x02, 0xff, 0x03, 0x00, 0x00, 0xff, 0x08, 0x06, 0x04, 0xff, 0x08, 0x06, 0x04, 0xff, 0x03, 0x01, 0x01, 0xff, 0x09, 0x07, 0x05, 0xff, 0x10, 0x0e, 0x0d, 0xff, 0x0c, 0x0a, 0x09, 0xff, 0x05, 0x03, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x08, 0x05, 0x05, 0xff, 0x08, 0x06, 0x03, 0xff, 0x04, 0x03, 0x00, 0xff, 0x07, 0x05, 0x02, 0xff, 0x07, 0x05, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x07, 0x04, 0x04, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x04, 0x01, 0xff, 0x07, 0x03, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0b, 0x10, 0x24, 0xff, 0x1a, 0x2a, 0x47, 0xff, 0x0f, 0x20, 0x45, 0xff, 0x09, 0x20, 0x4e, 0xff, 0x36, 0x59, 0x92, 0xff, 0x5a, 0x86, 0xc6, 0xff, 0x63, 0x93, 0xc9, 0xff, 0x70, 0x9d, 0xce, 0xff, 0x7b, 0xa1, 0xce, 0xff, 0x8b, 0xae, 0xd7, 0xff, 0x90, 0xb1, 0xdc, 0xff, 0x7b, 0x9f, 0xcd, 0xff, 0x4b, 0x72, 0xa6, 0xff, 0x78, 0xa1, 0xd4, 0xff, 0x93, 0xbb, 0xe0, 0xff, 0x97, 0xbc, 0xe3, 0xff, 0x9d, 0xbe, 0xe7, 0xff, 0x9b, 0xb9, 0xe3, 0xff, 0x99, 0xb7, 0xdf, 0xff, 0x99, 0xb9, 0xde, 0xff, 0x9a, 0xbc, 0xdf, 0xff, 0x9a, 0xba, 0xd9, 0xff, 0xa0, 0xbc, 0xda, 0xff, 0x9f, 0xbd, 0xdf, 0xff, 0xa2, 0xc0, 0xe4, 0xff, 0x9c, 0xbb, 0xe1, 0xff, 0x90, 0xb3, 0xdb, 0xff, 0x85, 0xae, 0xd9, 0xff, 0x8a, 0xb4, 0xe0, 0xff, 0x80, 0xae, 0xd7, 0xff, 0x7e, 0xb1, 0xd8, 0xff, 0x80, 0xb1, 0xd8, 0xff, 0x80, 0xae, 0xd8, 0xff, 0x7b, 0xa8, 0xd1, 0xff, 0x79, 0xa7, 0xce, 0xff, 0x7a, 0xa8, 0xd0, 0xff, 0x74, 0xa3, 0xca, 0xff, 0x69, 0x99, 0xc5, 0xff, 0x5e, 0x8e, 0xc1, 0xff, 0x47, 0x76, 0xae, 0xff, 0x24, 0x48, 0x76, 0xff, 0x0d, 0x1f, 0x3c, 0xff, 0x12, 0x16, 0x1e, 0xff, 0x15, 0x17, 0x15, 0xff, 0x0f, 0x15, 0x14, 0xff, 0x10, 0x11, 0x0e, 0xff, 0x0e, 0x0c, 0x08, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x08, 0x06, 0x06, 0xff, 0x08, 0x06, 0x05, 0xff, 0x06, 0x04, 0x03, 0xff, 0x06, 0x04, 0x03, 0xff, 0x06, 0x03, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x0b, 0x06, 0xff, 0x2f, 0x3e, 0x35, 0xff, 0x37, 0x53, 0x49, 0xff, 0x39, 0x5b, 0x50, 0xff, 0x3b, 0x5c, 0x51, 0xff, 0x3c, 0x59, 0x4f, 0xff, 0x41, 0x59, 0x4f, 0xff, 0x3f, 0x59, 0x4f, 0xff, 0x3d, 0x58, 0x4e, 0xff, 0x3d, 0x58, 0x4e, 0xff, 0x3c, 0x57, 0x4d, 0xff, 0x3c, 0x57, 0x4d, 0xff, 0x3b, 0x56, 0x4c, 0xff, 0x3a, 0x55, 0x4b, 0xff, 0x3a, 0x55, 0x4b, 0xff, 0x39, 0x54, 0x4a, 0xff, 0x39, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3a, 0x53, 0x49, 0xff, 0x3a, 0x53, 0x49, 0xff, 0x39, 0x52, 0x48, 0xff, 0x3a, 0x53, 0x49, 0xff, 0x38, 0x51, 0x47, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x04, 0x38, 0x45, 0x3a, 0xe7, 0x3c, 0x4c, 0x41, 0xff, 0x40, 0x50, 0x45, 0xff, 0x44, 0x54, 0x49, 0xff, 0x49, 0x59, 0x4e, 0xff, 0x4e, 0x5d, 0x52, 0xff, 0x4f, 0x5f, 0x54, 0xff, 0x4c, 0x5c, 0x52, 0xff, 0x4a, 0x58, 0x4c, 0xff, 0x48, 0x52, 0x46, 0xff, 0x40, 0x4a, 0x3c, 0xff, 0x3c, 0x46, 0x37, 0xff, 0x3e, 0x47, 0x38, 0xff, 0x44, 0x4a, 0x3a, 0xff, 0x43, 0x49, 0x38, 0xff, 0x46, 0x4b, 0x38, 0xff, 0x28, 0x2a, 0x1e, 0xff, 0x00, 0x00, 0x00, 0xff, 0x08, 0x07, 0x04, 0xff, 0x14, 0x13, 0x0f, 0xff, 0x09, 0x07, 0x06, 0xff, 0x01, 0x00, 0x00, 0xff, 0x07, 0x05, 0x05, 0xff, 0x1c, 0x1a, 0x18, 0xff, 0x07, 0x04, 0x04, 0xff, 0x03, 0x01, 0x00, 0xff, 0x0c, 0x0a, 0x09, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x05, 0x03, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x08, 0x06, 0x05, 0xff, 0x0a, 0x07, 0x07, 0xff, 0x04, 0x04, 0x01, 0xff, 0x05, 0x04, 0x01, 0xff, 0x05, 0x04, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x04, 0x04, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x08, 0x11, 0xff, 0x0e, 0x1c, 0x37, 0xff, 0x12, 0x26, 0x4c, 0xff, 0x10, 0x25, 0x51, 0xff, 0x0e, 0x2a, 0x5b, 0xff, 0x39, 0x5e, 0x99, 0xff, 0x4d, 0x79, 0xb9, 0xff, 0x5c, 0x8c, 0xbf, 0xff, 0x70, 0x9d, 0xca, 0xff, 0x7e, 0xa6, 0xd2, 0xff, 0x94, 0xba, 0xe3, 0xff, 0x8a, 0xae, 0xd9, 0xff, 0x5f, 0x84, 0xb2, 0xff, 0x64, 0x89, 0xbc, 0xff, 0x89, 0xae, 0xe0, 0xff, 0x8b, 0xb1, 0xd7, 0xff, 0x8e, 0xb2, 0xd7, 0xff, 0x99, 0xb8, 0xdf, 0xff, 0x9b, 0xb8, 0xdf, 0xff, 0x9c, 0xb9, 0xde, 0xff, 0x9c, 0xb9, 0xde, 0xff, 0x9b, 0xba, 0xdc, 0xff, 0xa2, 0xc2, 0xe2, 0xff, 0xa5, 0xc3, 0xe3, 0xff, 0xa1, 0xc0, 0xe3, 0xff, 0xa3, 0xc3, 0xe7, 0xff, 0x99, 0xba, 0xe0, 0xff, 0x92, 0xb6, 0xdf, 0xff, 0x8a, 0xb3, 0xe0, 0xff, 0x88, 0xb1, 0xde, 0xff, 0x85, 0xb3, 0xdc, 0xff, 0x84, 0xb7, 0xdd, 0xff, 0x7d, 0xaf, 0xd7, 0xff, 0x7d, 0xaf, 0xd8, 0xff, 0x7d, 0xaf, 0xd8, 0xff, 0x77, 0xa9, 0xd2, 0xff, 0x78, 0xaa, 0xd3, 0xff, 0x69, 0x9b, 0xc3, 0xff, 0x67, 0x9a, 0xc6, 0xff, 0x69, 0x9a, 0xcc, 0xff, 0x5a, 0x8b, 0xc1, 0xff, 0x2b, 0x52, 0x83, 0xff, 0x27, 0x42, 0x67, 0xff, 0x2e, 0x3b, 0x4e, 0xff, 0x12, 0x19, 0x1f, 0xff, 0x0b, 0x0e, 0x0f, 0xff, 0x0c, 0x0a, 0x07, 0xff, 0x09, 0x06, 0x05, 0xff, 0x0d, 0x0b, 0x0a, 0xff, 0x09, 0x07, 0x06, 0xff, 0x07, 0x05, 0x04, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x02, 0x01, 0xff, 0x00, 0x01, 0x00, 0xff, 0x0c, 0x16, 0x0f, 0xff, 0x36, 0x48, 0x3e, 0xff, 0x3c, 0x57, 0x4c, 0xff, 0x3a, 0x5a, 0x4f, 0xff, 0x3b, 0x5c, 0x50, 0xff, 0x3b, 0x5a, 0x4f, 0xff, 0x3f, 0x59, 0x4f, 0xff, 0x3f, 0x59, 0x4f, 0xff, 0x3e, 0x59, 0x4f, 0xff, 0x3d, 0x58, 0x4e, 0xff, 0x3c, 0x57, 0x4d, 0xff, 0x3c, 0x57, 0x4d, 0xff, 0x3c, 0x57, 0x4d, 0xff, 0x3b, 0x56, 0x4c, 0xff, 0x3a, 0x55, 0x4b, 0xff, 0x3a, 0x55, 0x4b, 0xff, 0x3a, 0x55, 0x4b, 0xff, 0x3a, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3a, 0x53, 0x49, 0xff, 0x3a, 0x52, 0x48, 0xe7, 0x3f, 0x3f, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x34, 0x2d, 0x49, 0x32, 0x3b, 0x31, 0xff, 0x35, 0x42, 0x36, 0xff, 0x38, 0x46, 0x3a, 0xff, 0x3c, 0x49, 0x3d, 0xff, 0x41, 0x4e, 0x42, 0xff, 0x44, 0x51, 0x45, 0xff, 0x44, 0x51, 0x45, 0xff, 0x40, 0x4d, 0x42, 0xff, 0x3d, 0x49, 0x3d, 0xff, 0x39, 0x43, 0x35, 0xff, 0x32, 0x3a, 0x2c, 0xff, 0x30, 0x37, 0x28, 0xff, 0x35, 0x3a, 0x29, 0xff, 0x37, 0x3e, 0x2b, 0xff, 0x37, 0x3b, 0x2a, 0xff, 0x39, 0x3b, 0x29, 0xff, 0x15, 0x16, 0x0b, 0xff, 0x03, 0x02, 0x01, 0xff, 0x13, 0x13, 0x0d, 0xff, 0x1f, 0x1f, 0x18, 0xff, 0x10, 0x0f, 0x0a, 0xff, 0x01, 0x00, 0x00, 0xff, 0x0c, 0x0a, 0x09, 0xff, 0x12, 0x10, 0x0f, 0xff, 0x04, 0x03, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x06, 0x04, 0x03, 0xff, 0x02, 0x00, 0x00, 0xff, 0x06, 0x04, 0x03, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x05, 0x03, 0xff, 0x07, 0x08, 0x06, 0xff, 0x04, 0x05, 0x03, 0xff, 0x02, 0x03, 0x01, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x01, 0x00, 0xff, 0x03, 0x02, 0x09, 0xff, 0x08, 0x10, 0x24, 0xff, 0x0c, 0x1f, 0x43, 0xff, 0x1b, 0x31, 0x63, 0xff, 0x17, 0x2e, 0x62, 0xff, 0x14, 0x2f, 0x66, 0xff, 0x4b, 0x71, 0xaf, 0xff, 0x4e, 0x7a, 0xba, 0xff, 0x60, 0x90, 0xc3, 0xff, 0x76, 0xa2, 0xd3, 0xff, 0x89, 0xb2, 0xe0, 0xff, 0x78, 0x9f, 0xcb, 0xff, 0x6b, 0x91, 0xbd, 0xff, 0x76, 0x9a, 0xc8, 0xff, 0x7e, 0xa0, 0xd3, 0xff, 0x8c, 0xad, 0xde, 0xff, 0x8e, 0xb3, 0xd8, 0xff, 0x99, 0xbc, 0xe1, 0xff, 0x9f, 0xbe, 0xe3, 0xff, 0xa3, 0xc0, 0xe4, 0xff, 0xac, 0xc7, 0xea, 0xff, 0xaa, 0xc6, 0xe9, 0xff, 0xa4, 0xc4, 0xe5, 0xff, 0xaa, 0xc9, 0xe9, 0xff, 0xa8, 0xc8, 0xe9, 0xff, 0xa6, 0xc5, 0xe9, 0xff, 0xa1, 0xc2, 0xe7, 0xff, 0x9f, 0xc0, 0xe7, 0xff, 0x9a, 0xc0, 0xe8, 0xff, 0x90, 0xba, 0xe6, 0xff, 0x86, 0xaf, 0xdc, 0xff, 0x85, 0xb1, 0xdf, 0xff, 0x80, 0xb2, 0xe1, 0xff, 0x76, 0xa7, 0xd7, 0xff, 0x74, 0xa6, 0xd5, 0xff, 0x78, 0xaa, 0xdb, 0xff, 0x73, 0xa5, 0xd6, 0xff, 0x6b, 0x9c, 0xcd, 0xff, 0x66, 0x98, 0xc8, 0xff, 0x67, 0x99, 0xca, 0xff, 0x69, 0x99, 0xc9, 0xff, 0x62, 0x93, 0xc8, 0xff, 0x58, 0x84, 0xb6, 0xff, 0x56, 0x76, 0xa2, 0xff, 0x3f, 0x53, 0x6e, 0xff, 0x16, 0x20, 0x2c, 0xff, 0x07, 0x0a, 0x0a, 0xff, 0x06, 0x02, 0x00, 0xff, 0x08, 0x06, 0x05, 0xff, 0x08, 0x06, 0x06, 0xff, 0x05, 0x03, 0x04, 0xff, 0x07, 0x04, 0x04, 0xff, 0x06, 0x04, 0x03, 0xff, 0x06, 0x04, 0x03, 0xff, 0x01, 0x00, 0x00, 0xff, 0x01, 0x08, 0x04, 0xff, 0x24, 0x32, 0x2a, 0xff, 0x3b, 0x4f, 0x46, 0xff, 0x3c, 0x56, 0x4c, 0xff, 0x3d, 0x5b, 0x4f, 0xff, 0x3c, 0x5d, 0x51, 0xff, 0x3c, 0x5c, 0x51, 0xff, 0x3f, 0x5b, 0x51, 0xff, 0x3e, 0x59, 0x4f, 0xff, 0x3f, 0x5a, 0x50, 0xff, 0x3e, 0x59, 0x4f, 0xff, 0x3c, 0x57, 0x4d, 0xff, 0x3d, 0x58, 0x4e, 0xff, 0x3c, 0x57, 0x4d, 0xff, 0x3b, 0x56, 0x4c, 0xff, 0x3b, 0x56, 0x4c, 0xff, 0x3b, 0x56, 0x4c, 0xff, 0x3a, 0x55, 0x4b, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3a, 0x53, 0x49, 0xff, 0x3a, 0x53, 0x49, 0xff, 0x3a, 0x52, 0x48, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x30, 0x24, 0x9f, 0x2b, 0x33, 0x29, 0xff, 0x2e, 0x37, 0x2c, 0xff, 0x31, 0x3a, 0x2e, 0xff, 0x34, 0x3d, 0x32, 0xff, 0x37, 0x40, 0x35, 0xff, 0x38, 0x41, 0x36, 0xff, 0x38, 0x41, 0x36, 0xff, 0x34, 0x3e, 0x33, 0xff, 0x30, 0x38, 0x2c, 0xff, 0x2b, 0x32, 0x22, 0xff, 0x25, 0x2a, 0x1b, 0xff, 0x25, 0x2a, 0x1b, 0xff, 0x29, 0x2e, 0x1d, 0xff, 0x28, 0x2e, 0x1c, 0xff, 0x27, 0x2a, 0x1a, 0xff, 0x28, 0x29, 0x17, 0xff, 0x09, 0x09, 0x01, 0xff, 0x08, 0x07, 0x05, 0xff, 0x17, 0x17, 0x12, 0xff, 0x1f, 0x20, 0x17, 0xff, 0x13, 0x14, 0x0d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x06, 0x06, 0xff, 0x04, 0x02, 0x02, 0xff, 0x07, 0x05, 0x04, 0xff, 0x09, 0x07, 0x06, 0xff, 0x06, 0x04, 0x03, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x0a, 0x08, 0x06, 0xff, 0x06, 0x04, 0x03, 0xff, 0x04, 0x02, 0x01, 0xff, 0x0b, 0x0a, 0x07, 0xff, 0x06, 0x06, 0x03, 0xff, 0x05, 0x05, 0x03, 0xff, 0x02, 0x03, 0x02, 0xff, 0x02, 0x02, 0x01, 0xff, 0x02, 0x02, 0x01, 0xff, 0x02, 0x01, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x06, 0x12, 0xff, 0x0f, 0x19, 0x39, 0xff, 0x0a, 0x1e, 0x50, 0xff, 0x2b, 0x48, 0x81, 0xff, 0x1f, 0x38, 0x72, 0xff, 0x18, 0x2d, 0x68, 0xff, 0x54, 0x80, 0xbc, 0xff, 0x61, 0x91, 0xcf, 0xff, 0x69, 0x93, 0xcd, 0xff, 0x77, 0xa1, 0xd6, 0xff, 0x6f, 0x98, 0xc8, 0xff, 0x5f, 0x88, 0xb4, 0xff, 0x7a, 0x9f, 0xcc, 0xff, 0x83, 0xa6, 0xd3, 0xff, 0x89, 0xaa, 0xd9, 0xff, 0x91, 0xb2, 0xe0, 0xff, 0x96, 0xba, 0xe0, 0xff, 0xa0, 0xc0, 0xe5, 0xff, 0xa7, 0xc5, 0xe7, 0xff, 0xb1, 0xce, 0xee, 0xff, 0xb3, 0xd0, 0xef, 0xff, 0xac, 0xc8, 0xe9, 0xff, 0xb0, 0xcb, 0xee, 0xff, 0xad, 0xca, 0xed, 0xff, 0xa8, 0xc9, 0xeb, 0xff, 0xa2, 0xc4, 0xe6, 0xff, 0x9d, 0xbf, 0xe4, 0xff, 0xa0, 0xc0, 0xea, 0xff, 0x95, 0xbb, 0xe6, 0xff, 0x85, 0xb2, 0xdd, 0xff, 0x80, 0xaf, 0xdb, 0xff, 0x74, 0xa3, 0xd3, 0xff, 0x71, 0xa1, 0xd4, 0xff, 0x73, 0xa4, 0xd8, 0xff, 0x6b, 0x9c, 0xd2, 0xff, 0x6e, 0xa0, 0xd5, 0xff, 0x68, 0x9b, 0xd0, 0xff, 0x62, 0x94, 0xcc, 0xff, 0x64, 0x96, 0xd1, 0xff, 0x6b, 0x9c, 0xd4, 0xff, 0x63, 0x94, 0xc5, 0xff, 0x60, 0x92, 0xc5, 0xff, 0x63, 0x91, 0xc4, 0xff, 0x5e, 0x85, 0xb6, 0xff, 0x39, 0x58, 0x7d, 0xff, 0x09, 0x18, 0x2a, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x07, 0x03, 0x01, 0xff, 0x07, 0x03, 0x03, 0xff, 0x06, 0x02, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x05, 0x04, 0x03, 0xff, 0x07, 0x04, 0x03, 0xff, 0x08, 0x04, 0x03, 0xff, 0x00, 0x00, 0x00, 0xff, 0x15, 0x24, 0x1c, 0xff, 0x3f, 0x52, 0x48, 0xff, 0x3b, 0x53, 0x47, 0xff, 0x3d, 0x59, 0x4d, 0xff, 0x3e, 0x5d, 0x54, 0xff, 0x3b, 0x5c, 0x52, 0xff, 0x3e, 0x5b, 0x51, 0xff, 0x42, 0x5c, 0x52, 0xff, 0x3f, 0x59, 0x4f, 0xff, 0x40, 0x5a, 0x50, 0xff, 0x3f, 0x59, 0x4f, 0xff, 0x3d, 0x57, 0x4d, 0xff, 0x3d, 0x58, 0x4e, 0xff, 0x3d, 0x58, 0x4e, 0xff, 0x3c, 0x57, 0x4d, 0xff, 0x3b, 0x56, 0x4c, 0xff, 0x3b, 0x57, 0x4b, 0xff, 0x3a, 0x56, 0x4b, 0xff, 0x3b, 0x56, 0x4a, 0xff, 0x3c, 0x55, 0x4a, 0xff, 0x3b, 0x54, 0x49, 0xff, 0x3b, 0x54, 0x49, 0xff, 0x3b, 0x54, 0x49, 0xff, 0x3b, 0x54, 0x49, 0xff, 0x3b, 0x54, 0x49, 0xff, 0x39, 0x53, 0x48, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x07, 0x1d, 0x24, 0x1a, 0xef, 0x23, 0x2a, 0x20, 0xff, 0x29, 0x2f, 0x24, 0xff, 0x2b, 0x31, 0x26, 0xff, 0x2c, 0x33, 0x28, 0xff, 0x2f, 0x36, 0x2a, 0xff, 0x2e, 0x35, 0x29, 0xff, 0x2e, 0x35, 0x29, 0xff, 0x2a, 0x31, 0x26, 0xff, 0x28, 0x2d, 0x21, 0xff, 0x26, 0x27, 0x18, 0xff, 0x1f, 0x21, 0x12, 0xff, 0x1c, 0x1e, 0x0f, 0xff, 0x1f, 0x20, 0x13, 0xff, 0x1f, 0x1f, 0x13, 0xff, 0x1d, 0x1d, 0x11, 0xff, 0x1a, 0x19, 0x0c, 0xff, 0x07, 0x05, 0x00, 0xff, 0x04, 0x03, 0x02, 0xff, 0x14, 0x14, 0x0d, 0xff, 0x14, 0x16, 0x09, 0xff, 0x0e, 0x11, 0x06, 0xff, 0x01, 0x02, 0x00, 0xff, 0x03, 0x02, 0x01, 0xff, 0x05, 0x03, 0x04, 0xff, 0x07, 0x05, 0x05, 0xff, 0x09, 0x07, 0x05, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x08, 0x06, 0x05, 0xff, 0x07, 0x05, 0x03, 0xff, 0x07, 0x05, 0x04, 0xff, 0x06, 0x04, 0x03, 0xff, 0x05, 0x05, 0x04, 0xff, 0x05, 0x05, 0x04, 0xff, 0x04, 0x04, 0x05, 0xff, 0x03, 0x03, 0x03, 0xff, 0x02, 0x03, 0x06, 0xff, 0x01, 0x02, 0x05, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x05, 0x0a, 0x17, 0xff, 0x0d, 0x1c, 0x41, 0xff, 0x18, 0x32, 0x6c, 0xff, 0x2a, 0x4e, 0x8f, 0xff, 0x09, 0x29, 0x69, 0xff, 0x24, 0x40, 0x7f, 0xff, 0x53, 0x80, 0xbd, 0xff, 0x50, 0x82, 0xbf, 0xff, 0x62, 0x8a, 0xc9, 0xff, 0x55, 0x7c, 0xb6, 0xff, 0x50, 0x7a, 0xac, 0xff, 0x6e, 0x97, 0xc5, 0xff, 0x89, 0xaf, 0xdb, 0xff, 0x90, 0xb4, 0xdc, 0xff, 0x9b, 0xbd, 0xe5, 0xff, 0x9d, 0xbf, 0xe7, 0xff, 0x9d, 0xc0, 0xe6, 0xff, 0xa5, 0xc5, 0xe9, 0xff, 0xaf, 0xcb, 0xed, 0xff, 0xb3, 0xd0, 0xed, 0xff, 0xb1, 0xce, 0xeb, 0xff, 0xb0, 0xcd, 0xeb, 0xff, 0xb3, 0xcc, 0xec, 0xff, 0xac, 0xc9, 0xeb, 0xff, 0x9d, 0xc5, 0xe6, 0xff, 0x9c, 0xc2, 0xe2, 0xff, 0x9c, 0xc1, 0xe5, 0xff, 0x99, 0xbb, 0xe5, 0xff, 0x90, 0xb6, 0xe2, 0xff, 0x84, 0xb1, 0xdc, 0xff, 0x78, 0xaa, 0xd6, 0xff, 0x70, 0xa2, 0xd0, 0xff, 0x6f, 0x9f, 0xce, 0xff, 0x75, 0xa7, 0xd8, 0xff, 0x75, 0xa8, 0xdb, 0xff, 0x70, 0xa4, 0xd8, 0xff, 0x5f, 0x95, 0xca, 0xff, 0x5f, 0x95, 0xcb, 0xff, 0x60, 0x96, 0xce, 0xff, 0x5e, 0x96, 0xcc, 0xff, 0x57, 0x8a, 0xbe, 0xff, 0x5b, 0x8a, 0xbb, 0xff, 0x5a, 0x8c, 0xbf, 0xff, 0x5a, 0x8e, 0xc2, 0xff, 0x3f, 0x68, 0x96, 0xff, 0x07, 0x1b, 0x32, 0xff, 0x0a, 0x07, 0x08, 0xff, 0x08, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x02, 0x02, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x07, 0x03, 0x02, 0xff, 0x06, 0x03, 0x02, 0xff, 0x02, 0x01, 0x00, 0xff, 0x07, 0x04, 0x01, 0xff, 0x33, 0x43, 0x3a, 0xff, 0x42, 0x5b, 0x51, 0xff, 0x3b, 0x53, 0x49, 0xff, 0x42, 0x5c, 0x52, 0xff, 0x43, 0x5f, 0x53, 0xff, 0x3e, 0x5e, 0x51, 0xff, 0x3f, 0x5c, 0x52, 0xff, 0x40, 0x5b, 0x51, 0xff, 0x40, 0x5a, 0x50, 0xff, 0x40, 0x5a, 0x50, 0xff, 0x3f, 0x59, 0x4f, 0xff, 0x3d, 0x58, 0x4e, 0xff, 0x3d, 0x58, 0x4e, 0xff, 0x3d, 0x58, 0x4e, 0xff, 0x3c, 0x57, 0x4d, 0xff, 0x3c, 0x57, 0x4d, 0xff, 0x3c, 0x57, 0x4d, 0xff, 0x3c, 0x56, 0x4c, 0xff, 0x3c, 0x55, 0x4b, 0xff, 0x3c, 0x55, 0x4b, 0xff, 0x3c, 0x54, 0x4b, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3b, 0x54, 0x4a, 0xff, 0x3a, 0x54, 0x49, 0xef, 0x48, 0x48, 0x48, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x1d, 0x12, 0x46, 0x19, 0x1d, 0x14, 0xff, 0x1e, 0x23, 0x18, 0xff, 0x23, 0x29, 0x1c, 0xff, 0x24, 0x2a, 0x1d, 0xff, 0x24, 0x2a, 0x1e, 0xff, 0x26, 0x2c, 0x1f, 0xff, 0x26, 0x2c, 0x20, 0xff, 0x26, 0x2c, 0x1f, 0xff, 0x23, 0x2a, 0x1d, 0xff, 0x22, 0x27, 0x1a, 0xff, 0x1f, 0x1f, 0x13, 0xff, 0x19, 0x1a, 0x0e, 0xff, 0x17, 0x17, 0x0c, 0xff, 0x18, 0x18, 0x0d, 0xff, 0x18, 0x16, 0x0d, 0xff, 0x18, 0x16, 0x0d, 0xff, 0x16, 0x13, 0x08, 0xff, 0x0d, 0x0b, 0x04, 0xff, 0x07, 0x06, 0x03, 0xff, 0x08, 0x09, 0x02, 0xff, 0x0d, 0x0f, 0x03, 0xff, 0x0a, 0x0c, 0x01, 0xff, 0x06, 0x05, 0x00, 0xff, 0x04, 0x02, 0x00, 0xff, 0x06, 0x03, 0x04, 0xff, 0x07, 0x04, 0x05, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x07, 0x05, 0x04, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x02, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x09, 0x07, 0x06, 0xff, 0x02, 0x03, 0x04, 0xff, 0x00, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x03, 0x03, 0x03, 0xff, 0x05, 0x02, 0x04, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x02, 0x01, 0xff, 0x0c, 0x0a, 0x09, 0xff, 0x09, 0x11, 0x27, 0xff, 0x10, 0x20, 0x4a, 0xff, 0x2e, 0x48, 0x84, 0xff, 0x1c, 0x39, 0x81, 0xff, 0x08, 0x27, 0x6e, 0xff, 0x42, 0x6a, 0xab, 0xff, 0x50, 0x7d, 0xb8, 0xff, 0x54, 0x85, 0xbe, 0xff, 0x36, 0x63, 0xa0, 0xff, 0x50, 0x7a, 0xb5, 0xff, 0x71, 0x9a, 0xd0, 0xff, 0x7e, 0xa6, 0xd8, 0xff, 0x83, 0xab, 0xd5, 0xff, 0x94, 0xba, 0xde, 0xff, 0xa2, 0xc5, 0xe8, 0xff, 0xa2, 0xc3, 0xe8, 0xff, 0x9d, 0xbe, 0xe5, 0xff, 0xa6, 0xc6, 0xe9, 0xff, 0xb0, 0xcd, 0xee, 0xff, 0xac, 0xc9, 0xe6, 0xff, 0xab, 0xc7, 0xe4, 0xff, 0xb3, 0xcf, 0xed, 0xff, 0xae, 0xc9, 0xe9, 0xff, 0xa8, 0xc8, 0xe9, 0xff, 0x9e, 0xc4, 0xe5, 0xff, 0x95, 0xbc, 0xdc, 0xff, 0x96, 0xbc, 0xe0, 0xff, 0x96, 0xba, 0xe3, 0xff, 0x8e, 0xb4, 0xdf, 0xff, 0x8d, 0xbb, 0xe5, 0xff, 0x82, 0xb3, 0xdf, 0xff, 0x7b, 0xac, 0xd9, 0xff, 0x7b, 0xac, 0xd8, 0xff, 0x7a, 0xae, 0xda, 0xff, 0x77, 0xac, 0xd9, 0xff, 0x6f, 0xa4, 0xd4, 0xff, 0x67, 0xa0, 0xd2, 0xff, 0x60, 0x98, 0xca, 0xff, 0x5d, 0x96, 0xc8, 0xff, 0x53, 0x8e, 0xc0, 0xff, 0x58, 0x8d, 0xbf, 0xff, 0x61, 0x8f, 0xc0, 0xff, 0x51, 0x88, 0xb9, 0xff, 0x4a, 0x81, 0xbe, 0xff, 0x54, 0x7e, 0xb4, 0xff, 0x22, 0x37, 0x50, 0xff, 0x01, 0x00, 0x00, 0xff, 0x06, 0x01, 0x00, 0xff, 0x00, 0x00, 0x02, 0xff, 0x00, 0x01, 0x02, 0xff, 0x04, 0x02, 0x01, 0xff, 0x06, 0x02, 0x01, 0xff, 0x04, 0x03, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1f, 0x1d, 0x17, 0xff, 0x3e, 0x52, 0x4a, 0xff, 0x3e, 0x58, 0x4f, 0xff, 0x43, 0x5a, 0x53, 0xff, 0x44, 0x5c, 0x54, 0xff, 0x44, 0x5e, 0x50, 0xff, 0x45, 0x63, 0x57, 0xff, 0x42, 0x63, 0x57, 0xff, 0x3d, 0x5b, 0x50, 0xff, 0x40, 0x5b, 0x51, 0xff, 0x40, 0x5a, 0x50, 0xff, 0x3f, 0x5a, 0x50, 0xff, 0x3e, 0x59, 0x4f, 0xff, 0x3e, 0x59, 0x4f, 0xff, 0x3e, 0x58, 0x4e, 0xff, 0x3d, 0x58, 0x4e, 0xff, 0x3d, 0x57, 0x4d, 0xff, 0x3d, 0x57, 0x4e, 0xff, 0x3e, 0x57, 0x4d, 0xff, 0x3d, 0x55, 0x4d, 0xff, 0x3c, 0x55, 0x4c, 0xff, 0x3c, 0x55, 0x4c, 0xff, 0x3c, 0x54, 0x4c, 0xff, 0x3c, 0x54, 0x4b, 0xff, 0x3c, 0x54, 0x4b, 0xff, 0x3b, 0x54, 0x4b, 0xff, 0x3b, 0x54, 0x4b, 0xff, 0x3a, 0x53, 0x48, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x1b, 0x0e, 0x8d, 0x18, 0x1d, 0x11, 0xff, 0x1b, 0x1f, 0x14, 0xff, 0x1e, 0x21, 0x15, 0xff, 0x1f, 0x22, 0x16, 0xff, 0x20, 0x24, 0x18, 0xff, 0x21, 0x24, 0x18, 0xff, 0x1f, 0x22, 0x16, 0xff, 0x1e, 0x21, 0x15, 0xff, 0x1e, 0x21, 0x15, 0xff, 0x1c, 0x20, 0x14, 0xff, 0x17, 0x1b, 0x11, 0xff, 0x14, 0x17, 0x0d, 0xff, 0x13, 0x17, 0x0d, 0xff, 0x13, 0x17, 0x0c, 0xff, 0x14, 0x17, 0x0c, 0xff, 0x15, 0x17, 0x0d, 0xff, 0x11, 0x12, 0x08, 0xff, 0x13, 0x12, 0x09, 0xff, 0x13, 0x10, 0x0a, 0xff, 0x07, 0x04, 0x01, 0xff, 0x08, 0x05, 0x04, 0xff, 0x09, 0x05, 0x04, 0xff, 0x07, 0x02, 0x01, 0xff, 0x05, 0x02, 0x00, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x04, 0x03, 0xff, 0x05, 0x03, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x06, 0x04, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x07, 0x05, 0x04, 0xff, 0x09, 0x06, 0x05, 0xff, 0x0a, 0x08, 0x07, 0xff, 0x08, 0x08, 0x07, 0xff, 0x04, 0x04, 0x03, 0xff, 0x07, 0x04, 0x01, 0xff, 0x07, 0x04, 0x00, 0xff, 0x06, 0x03, 0x01, 0xff, 0x05, 0x05, 0x08, 0xff, 0x07, 0x0c, 0x17, 0xff, 0x0c, 0x13, 0x25, 0xff, 0x0f, 0x1e, 0x42, 0xff, 0x20, 0x36, 0x65, 0xff, 0x2c, 0x47, 0x84, 0xff, 0x07, 0x1a, 0x65, 0xff, 0x28, 0x47, 0x8f, 0xff, 0x43, 0x75, 0xb4, 0xff, 0x7a, 0xaa, 0xe0, 0xff, 0x52, 0x87, 0xb9, 0xff, 0x34, 0x66, 0x9f, 0xff, 0x72, 0xa1, 0xd8, 0xff, 0x73, 0x9d, 0xd2, 0xff, 0x7c, 0xa5, 0xd6, 0xff, 0x82, 0xaa, 0xd6, 0xff, 0x8e, 0xb4, 0xda, 0xff, 0x97, 0xba, 0xdc, 0xff, 0x9b, 0xb9, 0xde, 0xff, 0x9d, 0xbe, 0xe4, 0xff, 0xa4, 0xc2, 0xe5, 0xff, 0xa7, 0xc4, 0xe3, 0xff, 0xaa, 0xc5, 0xe4, 0xff, 0xa6, 0xc3, 0xe3, 0xff, 0xa8, 0xc6, 0xe7, 0xff, 0xa6, 0xc6, 0xea, 0xff, 0xa8, 0xc7, 0xeb, 0xff, 0xa6, 0xc3, 0xe5, 0xff, 0xa4, 0xc3, 0xe4, 0xff, 0xa2, 0xbd, 0xe4, 0xff, 0xa1, 0xbf, 0xea, 0xff, 0x92, 0xba, 0xe5, 0xff, 0x89, 0xb8, 0xe2, 0xff, 0x84, 0xb5, 0xe2, 0xff, 0x84, 0xb6, 0xe3, 0xff, 0x84, 0xb9, 0xe3, 0xff, 0x7f, 0xb5, 0xdf, 0xff, 0x7a, 0xb2, 0xdb, 0xff, 0x76, 0xad, 0xd5, 0xff, 0x70, 0xa5, 0xd1, 0xff, 0x64, 0x99, 0xca, 0xff, 0x67, 0x9a, 0xd0, 0xff, 0x66, 0x99, 0xcd, 0xff, 0x5f, 0x92, 0xc1, 0xff, 0x5c, 0x90, 0xbf, 0xff, 0x58, 0x8b, 0xbe, 0xff, 0x53, 0x82, 0xb7, 0xff, 0x6a, 0x8f, 0xbd, 0xff, 0x49, 0x5b, 0x7c, 0xff, 0x00, 0x00, 0x06, 0xff, 0x00, 0x00, 0x00, 0xff, 0x05, 0x01, 0x00, 0xff, 0x08, 0x01, 0x05, 0xff, 0x02, 0x06, 0x01, 0xff, 0x00, 0x05, 0x01, 0xff, 0x09, 0x04, 0x03, 0xff, 0x03, 0x02, 0x00, 0xff, 0x2b, 0x39, 0x2c, 0xff, 0x42, 0x5f, 0x4f, 0xff, 0x3f, 0x5c, 0x4e, 0xff, 0x45, 0x5f, 0x51, 0xff, 0x44, 0x5c, 0x51, 0xff, 0x40, 0x5a, 0x56, 0xff, 0x41, 0x60, 0x5a, 0xff, 0x44, 0x61, 0x56, 0xff, 0x41, 0x5b, 0x4f, 0xff, 0x40, 0x5b, 0x51, 0xff, 0x3f, 0x5b, 0x51, 0xff, 0x3d, 0x59, 0x4f, 0xff, 0x3e, 0x5a, 0x50, 0xff, 0x41, 0x5a, 0x50, 0xff, 0x40, 0x59, 0x4f, 0xff, 0x3f, 0x58, 0x4e, 0xff, 0x3f, 0x58, 0x4e, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x57, 0x4a, 0xff, 0x3e, 0x56, 0x4a, 0xff, 0x3d, 0x57, 0x4a, 0xff, 0x3c, 0x56, 0x49, 0xff, 0x3c, 0x56, 0x49, 0xff, 0x3c, 0x56, 0x49, 0xff, 0x3b, 0x55, 0x48, 0xff, 0x3b, 0x55, 0x48, 0xff, 0x3b, 0x55, 0x48, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x16, 0x0d, 0xd7, 0x16, 0x19, 0x10, 0xff, 0x18, 0x1b, 0x11, 0xff, 0x19, 0x1e, 0x13, 0xff, 0x1a, 0x1f, 0x13, 0xff, 0x1b, 0x1f, 0x14, 0xff, 0x1b, 0x1f, 0x14, 0xff, 0x19, 0x1e, 0x13, 0xff, 0x18, 0x1d, 0x11, 0xff, 0x17, 0x1c, 0x10, 0xff, 0x17, 0x1c, 0x11, 0xff, 0x14, 0x1a, 0x10, 0xff, 0x11, 0x17, 0x0d, 0xff, 0x11, 0x16, 0x0c, 0xff, 0x10, 0x16, 0x0b, 0xff, 0x10, 0x16, 0x0b, 0xff, 0x13, 0x18, 0x0c, 0xff, 0x11, 0x16, 0x0a, 0xff, 0x0f, 0x12, 0x08, 0xff, 0x15, 0x14, 0x0f, 0xff, 0x12, 0x0e, 0x0d, 0xff, 0x08, 0x02, 0x04, 0xff, 0x06, 0x00, 0x02, 0xff, 0x06, 0x00, 0x02, 0xff, 0x04, 0x01, 0x00, 0xff, 0x04, 0x03, 0x00, 0xff, 0x04, 0x04, 0x01, 0xff, 0x06, 0x03, 0x04, 0xff, 0x06, 0x04, 0x04, 0xff, 0x05, 0x03, 0x03, 0xff, 0x07, 0x05, 0x05, 0xff, 0x08, 0x06, 0x06, 0xff, 0x07, 0x05, 0x05, 0xff, 0x06, 0x03, 0x03, 0xff, 0x05, 0x05, 0x05, 0xff, 0x05, 0x04, 0x02, 0xff, 0x0a, 0x05, 0x02, 0xff, 0x0d, 0x07, 0x04, 0xff, 0x08, 0x05, 0x04, 0xff, 0x06, 0x08, 0x14, 0xff, 0x08, 0x12, 0x27, 0xff, 0x07, 0x17, 0x34, 0xff, 0x18, 0x31, 0x5c, 0xff, 0x1d, 0x3b, 0x6e, 0xff, 0x11, 0x31, 0x6d, 0xff, 0x31, 0x51, 0x97, 0xff, 0x44, 0x6d, 0xb2, 0xff, 0x52, 0x83, 0xc0, 0xff, 0x75, 0xa6, 0xd9, 0xff, 0x45, 0x78, 0xa7, 0xff, 0x65, 0x96, 0xcb, 0xff, 0x6d, 0x9d, 0xd3, 0xff, 0x7a, 0xa6, 0xda, 0xff, 0x8c, 0xb5, 0xe4, 0xff, 0x8d, 0xb2, 0xe0, 0xff, 0x99, 0xbb, 0xe5, 0xff, 0x9b, 0xbc, 0xe1, 0xff, 0x9e, 0xbf, 0xe2, 0xff, 0x9d, 0xc0, 0xe3, 0xff, 0xa2, 0xc1, 0xe4, 0xff, 0xa4, 0xc1, 0xe0, 0xff, 0xa9, 0xc5, 0xe4, 0xff, 0xa2, 0xc0, 0xe1, 0xff, 0xa1, 0xc2, 0xe3, 0xff, 0xa7, 0xc9, 0xed, 0xff, 0xa8, 0xc7, 0xeb, 0xff, 0xaf, 0xc8, 0xeb, 0xff, 0xb0, 0xcb, 0xed, 0xff, 0xae, 0xc8, 0xeb, 0xff, 0x9f, 0xbf, 0xe4, 0xff, 0x93, 0xba, 0xe1, 0xff, 0x92, 0xbb, 0xe3, 0xff, 0x8b, 0xb9, 0xe5, 0xff, 0x8f, 0xba, 0xe3, 0xff, 0x95, 0xbe, 0xe2, 0xff, 0x8c, 0xba, 0xdd, 0xff, 0x8b, 0xbc, 0xe1, 0xff, 0x84, 0xb5, 0xdb, 0xff, 0x78, 0xab, 0xd3, 0xff, 0x6c, 0xa1, 0xce, 0xff, 0x69, 0x9d, 0xcf, 0xff, 0x64, 0x95, 0xc5, 0xff, 0x63, 0x95, 0xc2, 0xff, 0x5c, 0x92, 0xc1, 0xff, 0x53, 0x8a, 0xbe, 0xff, 0x57, 0x88, 0xb6, 0xff, 0x63, 0x89, 0xb3, 0xff, 0x65, 0x7e, 0xa6, 0xff, 0x18, 0x21, 0x47, 0xff, 0x06, 0x0a, 0x10, 0xff, 0x03, 0x02, 0x04, 0xff, 0x07, 0x00, 0x03, 0xff, 0x00, 0x07, 0x01, 0xff, 0x00, 0x04, 0x07, 0xff, 0x0a, 0x02, 0x06, 0xff, 0x04, 0x06, 0x00, 0xff, 0x36, 0x4a, 0x47, 0xff, 0x44, 0x66, 0x66, 0xff, 0x3c, 0x5b, 0x55, 0xff, 0x44, 0x5d, 0x53, 0xff, 0x47, 0x60, 0x52, 0xff, 0x3f, 0x5e, 0x58, 0xff, 0x3d, 0x5d, 0x56, 0xff, 0x42, 0x5e, 0x52, 0xff, 0x44, 0x5c, 0x4f, 0xff, 0x3f, 0x5d, 0x52, 0xff, 0x42, 0x61, 0x56, 0xff, 0x41, 0x5d, 0x53, 0xff, 0x40, 0x5a, 0x50, 0xff, 0x3f, 0x5a, 0x50, 0xff, 0x40, 0x59, 0x4f, 0xff, 0x3f, 0x58, 0x4e, 0xff, 0x3f, 0x58, 0x4e, 0xff, 0x3f, 0x59, 0x4b, 0xff, 0x3e, 0x58, 0x4a, 0xff, 0x3e, 0x57, 0x4a, 0xff, 0x3d, 0x57, 0x49, 0xff, 0x3d, 0x57, 0x49, 0xff, 0x3d, 0x57, 0x49, 0xff, 0x3c, 0x56, 0x48, 0xff, 0x3c, 0x56, 0x49, 0xff, 0x3c, 0x56, 0x49, 0xff, 0x3b, 0x55, 0x47, 0xff, 0x3a, 0x55, 0x47, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x09, 0x1a, 0x12, 0x15, 0x0d, 0xff, 0x14, 0x16, 0x0e, 0xff, 0x16, 0x19, 0x10, 0xff, 0x16, 0x1c, 0x11, 0xff, 0x16, 0x1c, 0x11, 0xff, 0x15, 0x1b, 0x10, 0xff, 0x15, 0x1b, 0x10, 0xff, 0x16, 0x1c, 0x11, 0xff, 0x16, 0x1c, 0x11, 0xff, 0x15, 0x1b, 0x11, 0xff, 0x16, 0x1c, 0x11, 0xff, 0x13, 0x1a, 0x0e, 0xff, 0x11, 0x18, 0x0d, 0xff, 0x14, 0x1a, 0x0f, 0xff, 0x13, 0x19, 0x0f, 0xff, 0x13, 0x19, 0x0f, 0xff, 0x14, 0x19, 0x0e, 0xff, 0x15, 0x19, 0x0d, 0xff, 0x14, 0x18, 0x0f, 0xff, 0x13, 0x15, 0x11, 0xff, 0x11, 0x0f, 0x0d, 0xff, 0x08, 0x02, 0x03, 0xff, 0x06, 0x00, 0x01, 0xff, 0x06, 0x01, 0x02, 0xff, 0x05, 0x02, 0x01, 0xff, 0x03, 0x03, 0x00, 0xff, 0x04, 0x03, 0x01, 0xff, 0x06, 0x03, 0x04, 0xff, 0x06, 0x04, 0x04, 0xff, 0x06, 0x04, 0x04, 0xff, 0x06, 0x04, 0x04, 0xff, 0x06, 0x04, 0x04, 0xff, 0x06, 0x04, 0x04, 0xff, 0x06, 0x04, 0x04, 0xff, 0x04, 0x04, 0x05, 0xff, 0x08, 0x06, 0x06, 0xff, 0x0a, 0x06, 0x05, 0xff, 0x06, 0x03, 0x02, 0xff, 0x04, 0x04, 0x09, 0xff, 0x05, 0x09, 0x1c, 0xff, 0x05, 0x10, 0x29, 0xff, 0x0d, 0x20, 0x3f, 0xff, 0x16, 0x32, 0x63, 0xff, 0x00, 0x1c, 0x53, 0xff, 0x2e, 0x52, 0x8a, 0xff, 0x4a, 0x75, 0xaf, 0xff, 0x4d, 0x7c, 0xb7, 0xff, 0x7d, 0xab, 0xe4, 0xff, 0x5b, 0x89, 0xc1, 0xff, 0x48, 0x75, 0xab, 0xff, 0x7c, 0xa9, 0xdb, 0xff, 0x7d, 0xaa, 0xde, 0xff, 0x86, 0xb1, 0xe1, 0xff, 0x90, 0xb7, 0xe3, 0xff, 0x9d, 0xbf, 0xea, 0xff, 0xa5, 0xc3, 0xec, 0xff, 0xa4, 0xc2, 0xe5, 0xff, 0xa7, 0xc8, 0xe8, 0xff, 0xa0, 0xc1, 0xe3, 0xff, 0xa4, 0xc4, 0xe4, 0xff, 0xaa, 0xc9, 0xe7, 0xff, 0xb0, 0xcd, 0xeb, 0xff, 0xad, 0xcb, 0xe9, 0xff, 0xaa, 0xc8, 0xe8, 0xff, 0xaa, 0xca, 0xec, 0xff, 0xa6, 0xc5, 0xe8, 0xff, 0xab, 0xc8, 0xea, 0xff, 0xa7, 0xc3, 0xe6, 0xff, 0xac, 0xc9, 0xeb, 0xff, 0xaa, 0xc7, 0xea, 0xff, 0xa3, 0xc1, 0xe5, 0xff, 0xa4, 0xc5, 0xea, 0xff, 0x9f, 0xc4, 0xed, 0xff, 0xa4, 0xc2, 0xe5, 0xff, 0xab, 0xc2, 0xde, 0xff, 0xa7, 0xc5, 0xe6, 0xff, 0xa1, 0xc1, 0xea, 0xff, 0x94, 0xb8, 0xe7, 0xff, 0x8a, 0xb6, 0xe3, 0xff, 0x71, 0xa3, 0xcd, 0xff, 0x69, 0xa0, 0xc9, 0xff, 0x69, 0x9b, 0xc6, 0xff, 0x67, 0x96, 0xc3, 0xff, 0x5f, 0x93, 0xc3, 0xff, 0x51, 0x89, 0xbc, 0xff, 0x4d, 0x84, 0xb6, 0xff, 0x53, 0x83, 0xb3, 0xff, 0x5a, 0x82, 0xad, 0xff, 0x56, 0x78, 0xa1, 0xff, 0x4c, 0x67, 0x86, 0xff, 0x19, 0x20, 0x33, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x02, 0x00, 0xff, 0x03, 0x02, 0x0e, 0xff, 0x0c, 0x03, 0x02, 0xff, 0x03, 0x06, 0x00, 0xff, 0x25, 0x34, 0x4c, 0xff, 0x39, 0x57, 0x7a, 0xff, 0x3c, 0x59, 0x6b, 0xff, 0x41, 0x5b, 0x5a, 0xff, 0x44, 0x60, 0x52, 0xff, 0x41, 0x61, 0x55, 0xff, 0x3d, 0x5d, 0x52, 0xff, 0x41, 0x5e, 0x50, 0xff, 0x45, 0x5e, 0x52, 0xff, 0x41, 0x5f, 0x54, 0xff, 0x41, 0x5f, 0x55, 0xff, 0x42, 0x5c, 0x52, 0xff, 0x42, 0x5b, 0x51, 0xff, 0x3f, 0x5a, 0x50, 0xff, 0x40, 0x59, 0x4f, 0xff, 0x40, 0x59, 0x4f, 0xff, 0x3f, 0x58, 0x4e, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3d, 0x57, 0x4a, 0xff, 0x3d, 0x57, 0x4a, 0xff, 0x3c, 0x56, 0x49, 0xff, 0x3c, 0x56, 0x49, 0xff, 0x3c, 0x56, 0x49, 0xff, 0x3c, 0x56, 0x49, 0xff, 0x38, 0x55, 0x4b, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x17, 0x0e, 0x58, 0x12, 0x17, 0x0e, 0xff, 0x13, 0x18, 0x0f, 0xff, 0x14, 0x19, 0x10, 0xff, 0x14, 0x1c, 0x10, 0xff, 0x15, 0x1d, 0x12, 0xff, 0x15, 0x1c, 0x11, 0xff, 0x14, 0x1c, 0x10, 0xff, 0x16, 0x1e, 0x12, 0xff, 0x16, 0x1e, 0x13, 0xff, 0x16, 0x1e, 0x13, 0xff, 0x16, 0x1e, 0x13, 0xff, 0x14, 0x1c, 0x11, 0xff, 0x13, 0x1b, 0x10, 0xff, 0x17, 0x1f, 0x14, 0xff, 0x15, 0x1d, 0x12, 0xff, 0x17, 0x1c, 0x13, 0xff, 0x12, 0x17, 0x0e, 0xff, 0x10, 0x15, 0x0b, 0xff, 0x1d, 0x20, 0x18, 0xff, 0x1b, 0x1e, 0x19, 0xff, 0x0a, 0x0a, 0x07, 0xff, 0x02, 0x00, 0x00, 0xff, 0x07, 0x01, 0x03, 0xff, 0x06, 0x01, 0x02, 0xff, 0x05, 0x01, 0x01, 0xff, 0x03, 0x03, 0x00, 0xff, 0x04, 0x03, 0x01, 0xff, 0x06, 0x03, 0x04, 0xff, 0x06, 0x04, 0x04, 0xff, 0x06, 0x04, 0x04, 0xff, 0x05, 0x03, 0x03, 0xff, 0x06, 0x04, 0x04, 0xff, 0x07, 0x05, 0x05, 0xff, 0x08, 0x06, 0x06, 0xff, 0x05, 0x05, 0x05, 0xff, 0x04, 0x03, 0x03, 0xff, 0x02, 0x00, 0x01, 0xff, 0x01, 0x01, 0x06, 0xff, 0x03, 0x09, 0x13, 0xff, 0x0b, 0x14, 0x2c, 0xff, 0x05, 0x16, 0x35, 0xff, 0x0b, 0x20, 0x47, 0xff, 0x11, 0x2c, 0x64, 0xff, 0x32, 0x54, 0x8c, 0xff, 0x52, 0x7b, 0xaf, 0xff, 0x4e, 0x7c, 0xac, 0xff, 0x7b, 0xaa, 0xdb, 0xff, 0x5b, 0x88, 0xbc, 0xff, 0x3c, 0x66, 0x9e, 0xff, 0x76, 0x9d, 0xd6, 0xff, 0x8c, 0xb2, 0xe3, 0xff, 0x8b, 0xb2, 0xe1, 0xff, 0x96, 0xba, 0xe7, 0xff, 0x9a, 0xbb, 0xe4, 0xff, 0x9e, 0xbe, 0xe2, 0xff, 0xa7, 0xc3, 0xe6, 0xff, 0xad, 0xc6, 0xe7, 0xff, 0xab, 0xc6, 0xe4, 0xff, 0xae, 0xca, 0xea, 0xff, 0xb2, 0xce, 0xec, 0xff, 0xb4, 0xd0, 0xee, 0xff, 0xb5, 0xd1, 0xef, 0xff, 0xb7, 0xd2, 0xf1, 0xff, 0xb5, 0xd0, 0xef, 0xff, 0xac, 0xc8, 0xe7, 0xff, 0xa8, 0xc6, 0xe5, 0xff, 0xa6, 0xc6, 0xe5, 0xff, 0xa7, 0xc4, 0xe4, 0xff, 0xaf, 0xc9, 0xe9, 0xff, 0xb8, 0xcf, 0xf0, 0xff, 0xb8, 0xcd, 0xef, 0xff, 0xb7, 0xcf, 0xf0, 0xff, 0xb2, 0xcd, 0xf0, 0xff, 0xb2, 0xcb, 0xe7, 0xff, 0xb7, 0xcd, 0xe6, 0xff, 0xb7, 0xce, 0xef, 0xff, 0xaf, 0xc5, 0xf2, 0xff, 0x9f, 0xb7, 0xeb, 0xff, 0x92, 0xb3, 0xe5, 0xff, 0x7d, 0xa5, 0xd1, 0xff, 0x6f, 0x9d, 0xc3, 0xff, 0x79, 0xa2, 0xcb, 0xff, 0x72, 0x99, 0xc5, 0xff, 0x63, 0x8e, 0xbc, 0xff, 0x5b, 0x87, 0xb6, 0xff, 0x4b, 0x7b, 0xad, 0xff, 0x4a, 0x7b, 0xae, 0xff, 0x4f, 0x7e, 0xaf, 0xff, 0x47, 0x76, 0xa7, 0xff, 0x4b, 0x73, 0xad, 0xff, 0x34, 0x46, 0x68, 0xff, 0x00, 0x02, 0x00, 0xff, 0x04, 0x00, 0x00, 0xff, 0x06, 0x00, 0x0d, 0xff, 0x10, 0x07, 0x00, 0xff, 0x02, 0x03, 0x00, 0xff, 0x27, 0x36, 0x68, 0xff, 0x4b, 0x66, 0xac, 0xff, 0x45, 0x60, 0x8c, 0xff, 0x3e, 0x58, 0x62, 0xff, 0x3f, 0x5f, 0x50, 0xff, 0x3f, 0x62, 0x4e, 0xff, 0x3e, 0x60, 0x4f, 0xff, 0x41, 0x5e, 0x51, 0xff, 0x45, 0x5e, 0x54, 0xff, 0x42, 0x60, 0x55, 0xff, 0x40, 0x5e, 0x53, 0xff, 0x40, 0x5b, 0x51, 0xff, 0x44, 0x5d, 0x53, 0xff, 0x40, 0x5b, 0x51, 0xff, 0x40, 0x5a, 0x50, 0xff, 0x40, 0x59, 0x4f, 0xff, 0x40, 0x59, 0x4e, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3d, 0x57, 0x4a, 0xff, 0x3d, 0x57, 0x4a, 0xff, 0x3d, 0x57, 0x4a, 0xff, 0x3c, 0x56, 0x49, 0xff, 0x3c, 0x56, 0x49, 0xff, 0x3c, 0x56, 0x48, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x1a, 0x0f, 0x90, 0x13, 0x1a, 0x10, 0xff, 0x15, 0x1c, 0x12, 0xff, 0x15, 0x1d, 0x13, 0xff, 0x15, 0x1d, 0x13, 0xff, 0x16, 0x1f, 0x14, 0xff, 0x17, 0x1f, 0x15, 0xff, 0x16, 0x1f, 0x15, 0xff, 0x17, 0x1f, 0x15, 0xff, 0x16, 0x1f, 0x14, 0xff, 0x16, 0x1f, 0x14, 0xff, 0x15, 0x1d, 0x14, 0xff, 0x15, 0x1c, 0x16, 0xff, 0x16, 0x1d, 0x17, 0xff, 0x16, 0x1d, 0x17, 0xff, 0x17, 0x1f, 0x18, 0xff, 0x17, 0x1c, 0x15, 0xff, 0x18, 0x1b, 0x14, 0xff, 0x15, 0x19, 0x13, 0xff, 0x11, 0x16, 0x0f, 0xff, 0x0e, 0x14, 0x0e, 0xff, 0x05, 0x07, 0x04, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x01, 0x02, 0xff, 0x07, 0x01, 0x02, 0xff, 0x07, 0x04, 0x03, 0xff, 0x04, 0x04, 0x01, 0xff, 0x04, 0x03, 0x01, 0xff, 0x06, 0x04, 0x04, 0xff, 0x06, 0x04, 0x04, 0xff, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x06, 0x05, 0x04, 0xff, 0x08, 0x06, 0x06, 0xff, 0x07, 0x05, 0x05, 0xff, 0x04, 0x04, 0x03, 0xff, 0x02, 0x01, 0x00, 0xff, 0x02, 0x02, 0x06, 0xff, 0x0b, 0x0e, 0x17, 0xff, 0x0b, 0x11, 0x1e, 0xff, 0x0d, 0x16, 0x30, 0xff, 0x11, 0x24, 0x44, 0xff, 0x2a, 0x42, 0x6b, 0xff, 0x41, 0x60, 0x97, 0xff, 0x61, 0x85, 0xbb, 0xff, 0x6c, 0x94, 0xc6, 0xff, 0x5a, 0x87, 0xb6, 0xff, 0x46, 0x72, 0x9e, 0xff, 0x45, 0x6e, 0x9c, 0xff, 0x74, 0x99, 0xcb, 0xff, 0x90, 0xb2, 0xe4, 0xff, 0x95, 0xb8, 0xe5, 0xff, 0x86, 0xa9, 0xd6, 0xff, 0x9e, 0xbe, 0xe9, 0xff, 0xa8, 0xc6, 0xea, 0xff, 0xa3, 0xc0, 0xe1, 0xff, 0xb7, 0xd1, 0xf0, 0xff, 0xb9, 0xcf, 0xed, 0xff, 0xb0, 0xc8, 0xe5, 0xff, 0xb4, 0xcd, 0xea, 0xff, 0xb8, 0xd1, 0xef, 0xff, 0xb7, 0xd1, 0xef, 0xff, 0xb5, 0xcf, 0xed, 0xff, 0xb5, 0xd0, 0xee, 0xff, 0xb0, 0xca, 0xe8, 0xff, 0xaf, 0xc6, 0xe5, 0xff, 0xb4, 0xcf, 0xeb, 0xff, 0xad, 0xcd, 0xe7, 0xff, 0xb2, 0xcc, 0xe7, 0xff, 0xb9, 0xce, 0xea, 0xff, 0xc4, 0xd7, 0xf3, 0xff, 0xc1, 0xd4, 0xf2, 0xff, 0xbe, 0xd3, 0xef, 0xff, 0xc4, 0xd6, 0xf2, 0xff, 0xb4, 0xd1, 0xed, 0xff, 0xa7, 0xcf, 0xeb, 0xff, 0xac, 0xcc, 0xef, 0xff, 0xa8, 0xc0, 0xef, 0xff, 0xa2, 0xb7, 0xec, 0xff, 0xa0, 0xb7, 0xe9, 0xff, 0x8b, 0xa6, 0xd4, 0xff, 0x7c, 0x98, 0xc1, 0xff, 0x7d, 0x95, 0xbc, 0xff, 0x84, 0x9d, 0xc5, 0xff, 0x77, 0x95, 0xbf, 0xff, 0x61, 0x7e, 0xab, 0xff, 0x50, 0x71, 0xa2, 0xff, 0x4f, 0x74, 0xa7, 0xff, 0x4b, 0x73, 0xa9, 0xff, 0x37, 0x66, 0x9e, 0xff, 0x34, 0x66, 0xa7, 0xff, 0x31, 0x4f, 0x73, 0xff, 0x05, 0x0c, 0x04, 0xff, 0x03, 0x02, 0x00, 0xff, 0x08, 0x01, 0x09, 0xff, 0x11, 0x06, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x40, 0x54, 0x8e, 0xff, 0x60, 0x7d, 0xd9, 0xff, 0x4f, 0x6a, 0xa7, 0xff, 0x41, 0x5e, 0x6f, 0xff, 0x3a, 0x5c, 0x4f, 0xff, 0x40, 0x64, 0x4a, 0xff, 0x3f, 0x62, 0x4e, 0xff, 0x42, 0x5e, 0x53, 0xff, 0x44, 0x5b, 0x54, 0xff, 0x41, 0x5e, 0x53, 0xff, 0x40, 0x5e, 0x53, 0xff, 0x42, 0x5c, 0x52, 0xff, 0x43, 0x5c, 0x52, 0xff, 0x40, 0x5b, 0x51, 0xff, 0x41, 0x5a, 0x50, 0xff, 0x41, 0x59, 0x50, 0xff, 0x40, 0x59, 0x4e, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3d, 0x57, 0x4a, 0xff, 0x3c, 0x56, 0x49, 0xff, 0x3d, 0x57, 0x4a, 0xff, 0x3d, 0x57, 0x4a, 0xff, 0x3c, 0x56, 0x49, 0xff, 0x3c, 0x56, 0x4a, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x1b, 0x13, 0xc6, 0x13, 0x1b, 0x14, 0xff, 0x14, 0x1d, 0x15, 0xff, 0x15, 0x1e, 0x16, 0xff, 0x16, 0x1f, 0x17, 0xff, 0x17, 0x1f, 0x18, 0xff, 0x17, 0x1f, 0x18, 0xff, 0x17, 0x20, 0x18, 0xff, 0x17, 0x1f, 0x18, 0xff, 0x17, 0x1f, 0x18, 0xff, 0x16, 0x1f, 0x17, 0xff, 0x15, 0x1e, 0x17, 0xff, 0x13, 0x1d, 0x16, 0xff, 0x15, 0x1f, 0x18, 0xff, 0x16, 0x1d, 0x18, 0xff, 0x13, 0x1b, 0x14, 0xff, 0x14, 0x1c, 0x15, 0xff, 0x17, 0x1e, 0x17, 0xff, 0x14, 0x1b, 0x14, 0xff, 0x12, 0x1c, 0x15, 0xff, 0x07, 0x10, 0x0a, 0xff, 0x00, 0x02, 0x00, 0xff, 0x05, 0x02, 0x02, 0xff, 0x05, 0x00, 0x01, 0xff, 0x06, 0x00, 0x01, 0xff, 0x07, 0x04, 0x04, 0xff, 0x04, 0x03, 0x01, 0xff, 0x04, 0x02, 0x01, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x02, 0x04, 0xff, 0x04, 0x03, 0x03, 0xff, 0x06, 0x02, 0x03, 0xff, 0x08, 0x04, 0x05, 0xff, 0x03, 0x02, 0x03, 0xff, 0x04, 0x01, 0x03, 0xff, 0x02, 0x02, 0x05, 0xff, 0x01, 0x01, 0x02, 0xff, 0x08, 0x0a, 0x0e, 0xff, 0x0b, 0x0e, 0x1b, 0xff, 0x07, 0x0c, 0x20, 0xff, 0x13, 0x1e, 0x38, 0xff, 0x27, 0x38, 0x59, 0xff, 0x31, 0x48, 0x70, 0xff, 0x25, 0x40, 0x72, 0xff, 0x34, 0x53, 0x87, 0xff, 0x49, 0x6a, 0x9b, 0xff, 0x4e, 0x71, 0xa0, 0xff, 0x61, 0x89, 0xb2, 0xff, 0x94, 0xb9, 0xe2, 0xff, 0x98, 0xb9, 0xe3, 0xff, 0xa3, 0xc2, 0xeb, 0xff, 0xa6, 0xc3, 0xeb, 0xff, 0x98, 0xb5, 0xdc, 0xff, 0xac, 0xc7, 0xec, 0xff, 0xb4, 0xcf, 0xf1, 0xff, 0xba, 0xd3, 0xf2, 0xff, 0xc3, 0xd8, 0xf6, 0xff, 0xbc, 0xce, 0xeb, 0xff, 0xb9, 0xcf, 0xe9, 0xff, 0xbb, 0xd3, 0xec, 0xff, 0xb6, 0xcd, 0xe8, 0xff, 0xb4, 0xcc, 0xe9, 0xff, 0xb2, 0xca, 0xe8, 0xff, 0xb5, 0xcd, 0xea, 0xff, 0xbb, 0xd2, 0xee, 0xff, 0xbd, 0xd3, 0xee, 0xff, 0xbd, 0xd6, 0xef, 0xff, 0xb7, 0xd3, 0xeb, 0xff, 0xba, 0xd2, 0xec, 0xff, 0xc2, 0xd8, 0xf1, 0xff, 0xc3, 0xd4, 0xf1, 0xff, 0xc4, 0xd3, 0xf2, 0xff, 0xbe, 0xd1, 0xed, 0xff, 0xbe, 0xce, 0xea, 0xff, 0xaa, 0xca, 0xe9, 0xff, 0x9e, 0xcc, 0xee, 0xff, 0xa8, 0xc9, 0xed, 0xff, 0x9d, 0xb5, 0xde, 0xff, 0x8b, 0x9d, 0xc8, 0xff, 0x69, 0x7b, 0xa5, 0xff, 0x44, 0x56, 0x80, 0xff, 0x3c, 0x4d, 0x76, 0xff, 0x2a, 0x3b, 0x61, 0xff, 0x31, 0x42, 0x67, 0xff, 0x3e, 0x4f, 0x77, 0xff, 0x2d, 0x3f, 0x68, 0xff, 0x3c, 0x52, 0x7b, 0xff, 0x47, 0x60, 0x90, 0xff, 0x49, 0x6a, 0xa1, 0xff, 0x37, 0x62, 0x9a, 0xff, 0x32, 0x65, 0xa5, 0xff, 0x2c, 0x4e, 0x7a, 0xff, 0x0a, 0x11, 0x0e, 0xff, 0x01, 0x02, 0x00, 0xff, 0x09, 0x05, 0x05, 0xff, 0x0f, 0x04, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2f, 0x43, 0x7b, 0xff, 0x5c, 0x7d, 0xdc, 0xff, 0x65, 0x81, 0xbf, 0xff, 0x4e, 0x6a, 0x7b, 0xff, 0x3b, 0x58, 0x4d, 0xff, 0x43, 0x64, 0x4d, 0xff, 0x3f, 0x60, 0x50, 0xff, 0x42, 0x5d, 0x54, 0xff, 0x44, 0x5b, 0x54, 0xff, 0x40, 0x5e, 0x53, 0xff, 0x40, 0x5e, 0x53, 0xff, 0x40, 0x5d, 0x52, 0xff, 0x41, 0x5b, 0x51, 0xff, 0x42, 0x5b, 0x51, 0xff, 0x42, 0x5b, 0x51, 0xff, 0x42, 0x5a, 0x50, 0xff, 0x41, 0x5a, 0x4f, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3d, 0x57, 0x4a, 0xff, 0x3d, 0x57, 0x4a, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3c, 0x56, 0x49, 0xff, 0x3b, 0x55, 0x48, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x11, 0x1a, 0x12, 0xf2, 0x13, 0x1b, 0x14, 0xff, 0x14, 0x1c, 0x15, 0xff, 0x15, 0x1d, 0x16, 0xff, 0x16, 0x1e, 0x17, 0xff, 0x18, 0x1f, 0x19, 0xff, 0x17, 0x1f, 0x18, 0xff, 0x18, 0x20, 0x19, 0xff, 0x17, 0x1f, 0x18, 0xff, 0x18, 0x1f, 0x19, 0xff, 0x17, 0x1e, 0x18, 0xff, 0x16, 0x1e, 0x17, 0xff, 0x13, 0x1e, 0x18, 0xff, 0x15, 0x1f, 0x18, 0xff, 0x18, 0x22, 0x1c, 0xff, 0x19, 0x21, 0x1b, 0xff, 0x10, 0x18, 0x11, 0xff, 0x0b, 0x13, 0x0c, 0xff, 0x10, 0x18, 0x12, 0xff, 0x11, 0x1b, 0x14, 0xff, 0x0d, 0x16, 0x10, 0xff, 0x06, 0x0a, 0x07, 0xff, 0x03, 0x02, 0x02, 0xff, 0x05, 0x00, 0x00, 0xff, 0x06, 0x00, 0x01, 0xff, 0x04, 0x01, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x03, 0x02, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x05, 0x03, 0x01, 0xff, 0x08, 0x02, 0x03, 0xff, 0x07, 0x02, 0x05, 0xff, 0x05, 0x03, 0x02, 0xff, 0x02, 0x01, 0x00, 0xff, 0x09, 0x05, 0x07, 0xff, 0x02, 0x02, 0x0a, 0xff, 0x09, 0x0e, 0x13, 0xff, 0x12, 0x18, 0x20, 0xff, 0x08, 0x0a, 0x1a, 0xff, 0x06, 0x0d, 0x21, 0xff, 0x1f, 0x2c, 0x42, 0xff, 0x28, 0x38, 0x57, 0xff, 0x1a, 0x2d, 0x54, 0xff, 0x21, 0x33, 0x5f, 0xff, 0x3d, 0x53, 0x80, 0xff, 0x57, 0x72, 0xa1, 0xff, 0x78, 0x98, 0xc9, 0xff, 0x8a, 0xaa, 0xd9, 0xff, 0x8b, 0xaa, 0xd4, 0xff, 0x9f, 0xbe, 0xe0, 0xff, 0xa8, 0xc7, 0xe4, 0xff, 0xb1, 0xc8, 0xed, 0xff, 0xa9, 0xbf, 0xe3, 0xff, 0xb3, 0xc9, 0xea, 0xff, 0xb3, 0xca, 0xe9, 0xff, 0xba, 0xcf, 0xe9, 0xff, 0xc5, 0xd7, 0xf1, 0xff, 0xc4, 0xd5, 0xf0, 0xff, 0xc2, 0xd6, 0xf0, 0xff, 0xc6, 0xdc, 0xf3, 0xff, 0xbb, 0xd0, 0xea, 0xff, 0xba, 0xd0, 0xea, 0xff, 0xb6, 0xce, 0xea, 0xff, 0xb7, 0xce, 0xea, 0xff, 0xc2, 0xd8, 0xf2, 0xff, 0xc4, 0xda, 0xf2, 0xff, 0xc3, 0xd6, 0xee, 0xff, 0xc8, 0xd8, 0xf2, 0xff, 0xc7, 0xd8, 0xf2, 0xff, 0xc8, 0xd9, 0xf5, 0xff, 0xc7, 0xd6, 0xf2, 0xff, 0xc3, 0xd4, 0xf0, 0xff, 0xb7, 0xcb, 0xe9, 0xff, 0xb0, 0xc8, 0xe8, 0xff, 0xa5, 0xc0, 0xe2, 0xff, 0x9e, 0xb8, 0xdb, 0xff, 0x7d, 0x90, 0xaf, 0xff, 0x63, 0x6f, 0x8c, 0xff, 0x3b, 0x48, 0x5e, 0xff, 0x08, 0x15, 0x2b, 0xff, 0x04, 0x11, 0x2f, 0xff, 0x00, 0x0b, 0x2f, 0xff, 0x0e, 0x23, 0x45, 0xff, 0x1c, 0x2f, 0x4f, 0xff, 0x07, 0x13, 0x33, 0xff, 0x00, 0x01, 0x1d, 0xff, 0x00, 0x08, 0x28, 0xff, 0x15, 0x2a, 0x51, 0xff, 0x3d, 0x5b, 0x8f, 0xff, 0x36, 0x5f, 0x96, 0xff, 0x34, 0x63, 0xa1, 0xff, 0x43, 0x59, 0x93, 0xff, 0x16, 0x13, 0x22, 0xff, 0x00, 0x00, 0x00, 0xff, 0x04, 0x04, 0x03, 0xff, 0x0e, 0x05, 0x05, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1e, 0x34, 0x6a, 0xff, 0x6b, 0x8d, 0xdd, 0xff, 0x79, 0x94, 0xcc, 0xff, 0x58, 0x6e, 0x83, 0xff, 0x3e, 0x56, 0x4e, 0xff, 0x44, 0x63, 0x50, 0xff, 0x41, 0x62, 0x50, 0xff, 0x43, 0x5e, 0x54, 0xff, 0x45, 0x5b, 0x58, 0xff, 0x40, 0x5e, 0x53, 0xff, 0x40, 0x5e, 0x53, 0xff, 0x40, 0x5c, 0x52, 0xff, 0x40, 0x5b, 0x52, 0xff, 0x43, 0x5c, 0x52, 0xff, 0x43, 0x5b, 0x52, 0xff, 0x42, 0x5b, 0x51, 0xff, 0x41, 0x5a, 0x50, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x3d, 0x57, 0x4a, 0xff, 0x3e, 0x58, 0x4a, 0xf2, 0x00, 0x00, 0x00, 0x01,
+    0x0f, 0x17, 0x0f, 0x21, 0x11, 0x19, 0x12, 0xff, 0x12, 0x1a, 0x13, 0xff, 0x13, 0x1b, 0x15, 0xff, 0x15, 0x1c, 0x16, 0xff, 0x15, 0x1e, 0x17, 0xff, 0x15, 0x1e, 0x17, 0xff, 0x16, 0x1f, 0x18, 0xff, 0x16, 0x1f, 0x18, 0xff, 0x17, 0x20, 0x18, 0xff, 0x16, 0x1f, 0x18, 0xff, 0x16, 0x1e, 0x17, 0xff, 0x14, 0x1e, 0x17, 0xff, 0x12, 0x1e, 0x18, 0xff, 0x14, 0x1e, 0x18, 0xff, 0x17, 0x22, 0x1c, 0xff, 0x1a, 0x23, 0x1e, 0xff, 0x18, 0x1e, 0x1a, 0xff, 0x15, 0x1c, 0x17, 0xff, 0x15, 0x1c, 0x17, 0xff, 0x12, 0x1a, 0x13, 0xff, 0x14, 0x1c, 0x16, 0xff, 0x17, 0x1c, 0x18, 0xff, 0x0a, 0x0c, 0x0b, 0xff, 0x03, 0x01, 0x01, 0xff, 0x05, 0x02, 0x03, 0xff, 0x04, 0x00, 0x01, 0xff, 0x06, 0x01, 0x00, 0xff, 0x06, 0x04, 0x03, 0xff, 0x04, 0x03, 0x04, 0xff, 0x02, 0x00, 0x00, 0xff, 0x06, 0x02, 0x00, 0xff, 0x01, 0x02, 0x01, 0xff, 0x03, 0x02, 0x02, 0xff, 0x11, 0x0b, 0x0b, 0xff, 0x0f, 0x0b, 0x0c, 0xff, 0x01, 0x01, 0x06, 0xff, 0x08, 0x0c, 0x13, 0xff, 0x0c, 0x12, 0x1c, 0xff, 0x04, 0x09, 0x17, 0xff, 0x0e, 0x18, 0x2d, 0xff, 0x1f, 0x2d, 0x44, 0xff, 0x1f, 0x2b, 0x48, 0xff, 0x17, 0x24, 0x45, 0xff, 0x34, 0x49, 0x6a, 0xff, 0x4d, 0x62, 0x89, 0xff, 0x37, 0x4c, 0x7d, 0xff, 0x34, 0x4b, 0x83, 0xff, 0x52, 0x70, 0xa4, 0xff, 0x86, 0xa3, 0xcc, 0xff, 0x9b, 0xb8, 0xd2, 0xff, 0xb2, 0xce, 0xe0, 0xff, 0xba, 0xd2, 0xf0, 0xff, 0xaf, 0xc7, 0xe6, 0xff, 0xa7, 0xbf, 0xdd, 0xff, 0xaf, 0xc5, 0xe3, 0xff, 0xc0, 0xd4, 0xf0, 0xff, 0xc9, 0xd8, 0xf3, 0xff, 0xce, 0xd9, 0xf2, 0xff, 0xd0, 0xdd, 0xf4, 0xff, 0xca, 0xdd, 0xf2, 0xff, 0xc6, 0xdb, 0xf3, 0xff, 0xc1, 0xd7, 0xf2, 0xff, 0xb8, 0xd0, 0xeb, 0xff, 0xb9, 0xd0, 0xeb, 0xff, 0xbd, 0xd3, 0xed, 0xff, 0xc5, 0xd8, 0xf1, 0xff, 0xca, 0xd9, 0xf2, 0xff, 0xce, 0xdb, 0xf3, 0xff, 0xcb, 0xd8, 0xef, 0xff, 0xc6, 0xd1, 0xec, 0xff, 0xc0, 0xcd, 0xea, 0xff, 0xb8, 0xcd, 0xeb, 0xff, 0xb8, 0xce, 0xf2, 0xff, 0xa4, 0xc3, 0xe5, 0xff, 0x86, 0x95, 0xbb, 0xff, 0x4e, 0x4d, 0x71, 0xff, 0x07, 0x0e, 0x25, 0xff, 0x00, 0x00, 0x03, 0xff, 0x08, 0x13, 0x16, 0xff, 0x19, 0x22, 0x2a, 0xff, 0x19, 0x26, 0x35, 0xff, 0x4a, 0x5d, 0x72, 0xff, 0x60, 0x78, 0x94, 0xff, 0x45, 0x5d, 0x7c, 0xff, 0x5c, 0x6d, 0x89, 0xff, 0x56, 0x5e, 0x79, 0xff, 0x1b, 0x26, 0x42, 0xff, 0x06, 0x1b, 0x3d, 0xff, 0x31, 0x4f, 0x7a, 0xff, 0x3b, 0x62, 0x96, 0xff, 0x30, 0x5b, 0x97, 0xff, 0x41, 0x54, 0x98, 0xff, 0x20, 0x1c, 0x3b, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x02, 0x00, 0xff, 0x12, 0x03, 0x10, 0xff, 0x0f, 0x0b, 0x20, 0xff, 0x30, 0x4a, 0x82, 0xff, 0x77, 0x9a, 0xe2, 0xff, 0x87, 0xa3, 0xd7, 0xff, 0x57, 0x6e, 0x7d, 0xff, 0x3f, 0x58, 0x4c, 0xff, 0x44, 0x61, 0x51, 0xff, 0x42, 0x61, 0x53, 0xff, 0x42, 0x5f, 0x54, 0xff, 0x44, 0x5d, 0x57, 0xff, 0x41, 0x5f, 0x53, 0xff, 0x42, 0x5e, 0x53, 0xff, 0x42, 0x5c, 0x51, 0xff, 0x41, 0x5c, 0x51, 0xff, 0x42, 0x5d, 0x52, 0xff, 0x42, 0x5d, 0x52, 0xff, 0x42, 0x5b, 0x50, 0xff, 0x42, 0x5b, 0x50, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3d, 0x55, 0x4d, 0x21,
+    0x11, 0x14, 0x11, 0x4b, 0x0e, 0x15, 0x10, 0xff, 0x10, 0x17, 0x12, 0xff, 0x12, 0x18, 0x14, 0xff, 0x13, 0x1a, 0x15, 0xff, 0x12, 0x1d, 0x15, 0xff, 0x12, 0x1d, 0x15, 0xff, 0x13, 0x1e, 0x16, 0xff, 0x13, 0x1e, 0x16, 0xff, 0x13, 0x1e, 0x16, 0xff, 0x13, 0x1e, 0x16, 0xff, 0x14, 0x1f, 0x17, 0xff, 0x13, 0x1f, 0x17, 0xff, 0x11, 0x1f, 0x17, 0xff, 0x12, 0x1f, 0x17, 0xff, 0x16, 0x21, 0x1a, 0xff, 0x17, 0x21, 0x1a, 0xff, 0x15, 0x1b, 0x17, 0xff, 0x13, 0x1a, 0x15, 0xff, 0x12, 0x19, 0x14, 0xff, 0x14, 0x1b, 0x15, 0xff, 0x14, 0x1b, 0x15, 0xff, 0x13, 0x19, 0x14, 0xff, 0x0b, 0x0f, 0x0d, 0xff, 0x03, 0x03, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x00, 0x00, 0xff, 0x05, 0x00, 0x00, 0xff, 0x06, 0x04, 0x00, 0xff, 0x04, 0x02, 0x07, 0xff, 0x02, 0x00, 0x0b, 0xff, 0x00, 0x05, 0x00, 0xff, 0x00, 0x08, 0x00, 0xff, 0x0b, 0x06, 0x0d, 0xff, 0x18, 0x0b, 0x1b, 0xff, 0x07, 0x03, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x02, 0x04, 0x0a, 0xff, 0x0a, 0x0c, 0x17, 0xff, 0x07, 0x0c, 0x17, 0xff, 0x0f, 0x12, 0x1e, 0xff, 0x0f, 0x11, 0x1a, 0xff, 0x0a, 0x0d, 0x12, 0xff, 0x11, 0x15, 0x18, 0xff, 0x13, 0x24, 0x35, 0xff, 0x0f, 0x22, 0x35, 0xff, 0x1a, 0x26, 0x32, 0xff, 0x19, 0x20, 0x28, 0xff, 0x0f, 0x19, 0x23, 0xff, 0x26, 0x34, 0x42, 0xff, 0x61, 0x77, 0x8a, 0xff, 0x88, 0xa3, 0xb8, 0xff, 0xa3, 0xc6, 0xd8, 0xff, 0xb0, 0xd2, 0xe8, 0xff, 0xad, 0xcb, 0xe9, 0xff, 0xab, 0xc6, 0xeb, 0xff, 0xb4, 0xc9, 0xed, 0xff, 0xc5, 0xd1, 0xf0, 0xff, 0xd4, 0xd5, 0xed, 0xff, 0xda, 0xdd, 0xf0, 0xff, 0xc7, 0xd7, 0xec, 0xff, 0xc3, 0xd7, 0xed, 0xff, 0xbf, 0xd6, 0xef, 0xff, 0xb8, 0xcf, 0xe9, 0xff, 0xbb, 0xd3, 0xed, 0xff, 0xbf, 0xd4, 0xee, 0xff, 0xcb, 0xda, 0xf2, 0xff, 0xcb, 0xdc, 0xf4, 0xff, 0xc1, 0xd9, 0xee, 0xff, 0xbf, 0xd3, 0xe3, 0xff, 0xc3, 0xd0, 0xe8, 0xff, 0xc9, 0xcd, 0xf6, 0xff, 0xad, 0xaf, 0xe1, 0xff, 0x75, 0x7c, 0x9f, 0xff, 0x39, 0x4c, 0x4c, 0xff, 0x0f, 0x18, 0x1b, 0xff, 0x00, 0x00, 0x09, 0xff, 0x0e, 0x13, 0x27, 0xff, 0x33, 0x40, 0x50, 0xff, 0x62, 0x74, 0x88, 0xff, 0x6c, 0x82, 0x9a, 0xff, 0x6f, 0x89, 0x9f, 0xff, 0x9a, 0xb6, 0xcc, 0xff, 0x84, 0x9e, 0xbb, 0xff, 0x6c, 0x86, 0xa9, 0xff, 0x72, 0x8c, 0xaf, 0xff, 0x6f, 0x87, 0xaa, 0xff, 0x55, 0x6a, 0x8c, 0xff, 0x33, 0x4a, 0x6b, 0xff, 0x30, 0x4e, 0x74, 0xff, 0x3f, 0x62, 0x92, 0xff, 0x34, 0x61, 0x9d, 0xff, 0x38, 0x5b, 0x9c, 0xff, 0x27, 0x2d, 0x4c, 0xff, 0x03, 0x00, 0x00, 0xff, 0x07, 0x01, 0x00, 0xff, 0x00, 0x01, 0x18, 0xff, 0x26, 0x43, 0x76, 0xff, 0x79, 0x8f, 0xcd, 0xff, 0x85, 0xa0, 0xf2, 0xff, 0x7e, 0xa0, 0xd0, 0xff, 0x45, 0x65, 0x64, 0xff, 0x3f, 0x5c, 0x49, 0xff, 0x46, 0x60, 0x54, 0xff, 0x41, 0x5b, 0x5a, 0xff, 0x41, 0x5e, 0x56, 0xff, 0x43, 0x62, 0x4d, 0xff, 0x43, 0x60, 0x51, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x42, 0x5e, 0x51, 0xff, 0x43, 0x5d, 0x50, 0xff, 0x41, 0x5d, 0x50, 0xff, 0x40, 0x5d, 0x4f, 0xff, 0x42, 0x5c, 0x4f, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3d, 0x58, 0x4a, 0x4b,
+    0x0b, 0x13, 0x0b, 0x6b, 0x0e, 0x14, 0x0e, 0xff, 0x0f, 0x15, 0x10, 0xff, 0x11, 0x17, 0x11, 0xff, 0x12, 0x18, 0x12, 0xff, 0x10, 0x1a, 0x14, 0xff, 0x11, 0x1b, 0x15, 0xff, 0x12, 0x1c, 0x15, 0xff, 0x12, 0x1c, 0x16, 0xff, 0x12, 0x1c, 0x16, 0xff, 0x12, 0x1c, 0x16, 0xff, 0x13, 0x1d, 0x17, 0xff, 0x13, 0x1e, 0x17, 0xff, 0x11, 0x1e, 0x16, 0xff, 0x12, 0x1f, 0x17, 0xff, 0x15, 0x21, 0x19, 0xff, 0x14, 0x1e, 0x16, 0xff, 0x0f, 0x16, 0x11, 0xff, 0x0e, 0x14, 0x0f, 0xff, 0x0c, 0x13, 0x0e, 0xff, 0x0d, 0x13, 0x0f, 0xff, 0x0f, 0x15, 0x10, 0xff, 0x0f, 0x16, 0x10, 0xff, 0x10, 0x15, 0x12, 0xff, 0x08, 0x09, 0x08, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x01, 0x01, 0xff, 0x03, 0x03, 0x00, 0xff, 0x05, 0x06, 0x0c, 0xff, 0x0b, 0x0b, 0x26, 0xff, 0x13, 0x19, 0x26, 0xff, 0x07, 0x0f, 0x07, 0xff, 0x07, 0x03, 0x06, 0xff, 0x0a, 0x02, 0x0c, 0xff, 0x06, 0x00, 0x01, 0xff, 0x04, 0x01, 0x01, 0xff, 0x02, 0x02, 0x02, 0xff, 0x0c, 0x0d, 0x14, 0xff, 0x04, 0x08, 0x14, 0xff, 0x04, 0x04, 0x10, 0xff, 0x05, 0x04, 0x11, 0xff, 0x00, 0x00, 0x07, 0xff, 0x00, 0x00, 0x04, 0xff, 0x02, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x11, 0x0f, 0x12, 0xff, 0x13, 0x10, 0x15, 0xff, 0x05, 0x00, 0x05, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x0b, 0x18, 0xff, 0x2c, 0x34, 0x42, 0xff, 0x5a, 0x67, 0x7b, 0xff, 0x89, 0x9a, 0xb7, 0xff, 0xaa, 0xbd, 0xe1, 0xff, 0xac, 0xc4, 0xe6, 0xff, 0xb0, 0xcc, 0xe8, 0xff, 0xbc, 0xda, 0xf0, 0xff, 0xc2, 0xda, 0xef, 0xff, 0xc3, 0xd2, 0xea, 0xff, 0xbd, 0xd1, 0xe9, 0xff, 0xbd, 0xd4, 0xed, 0xff, 0xc0, 0xd7, 0xf1, 0xff, 0xbe, 0xd5, 0xf0, 0xff, 0xbe, 0xd2, 0xed, 0xff, 0xc4, 0xd3, 0xee, 0xff, 0xc5, 0xd7, 0xf2, 0xff, 0xbb, 0xd6, 0xf2, 0xff, 0xb8, 0xcd, 0xec, 0xff, 0x9d, 0xb0, 0xcf, 0xff, 0x60, 0x6d, 0x90, 0xff, 0x22, 0x2a, 0x49, 0xff, 0x00, 0x00, 0x06, 0xff, 0x00, 0x00, 0x0a, 0xff, 0x1f, 0x32, 0x45, 0xff, 0x51, 0x65, 0x7e, 0xff, 0x85, 0x9a, 0xba, 0xff, 0x96, 0xaf, 0xd1, 0xff, 0x8a, 0xa9, 0xcd, 0xff, 0x84, 0xa5, 0xce, 0xff, 0x96, 0xb3, 0xdd, 0xff, 0x88, 0xa2, 0xcc, 0xff, 0x7d, 0x99, 0xbf, 0xff, 0x74, 0x92, 0xbb, 0xff, 0x69, 0x8a, 0xb6, 0xff, 0x69, 0x8a, 0xb7, 0xff, 0x63, 0x81, 0xa9, 0xff, 0x47, 0x63, 0x8a, 0xff, 0x3c, 0x5c, 0x89, 0xff, 0x3a, 0x5d, 0x94, 0xff, 0x35, 0x62, 0xa2, 0xff, 0x3f, 0x67, 0xa3, 0xff, 0x27, 0x35, 0x54, 0xff, 0x09, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xff, 0x10, 0x2a, 0x46, 0xff, 0x46, 0x70, 0xac, 0xff, 0x83, 0x9a, 0xdb, 0xff, 0x8f, 0xab, 0xfb, 0xff, 0x6e, 0x8f, 0xbd, 0xff, 0x3a, 0x5a, 0x56, 0xff, 0x42, 0x61, 0x46, 0xff, 0x46, 0x60, 0x52, 0xff, 0x41, 0x5b, 0x5c, 0xff, 0x40, 0x5e, 0x57, 0xff, 0x42, 0x62, 0x4b, 0xff, 0x43, 0x60, 0x51, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x42, 0x5e, 0x51, 0xff, 0x41, 0x5d, 0x50, 0xff, 0x41, 0x5d, 0x50, 0xff, 0x41, 0x5d, 0x50, 0xff, 0x40, 0x5c, 0x4f, 0xff, 0x40, 0x5b, 0x4e, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3d, 0x58, 0x49, 0x6b,
+    0x09, 0x10, 0x0b, 0x8b, 0x0b, 0x10, 0x0d, 0xff, 0x0c, 0x12, 0x0e, 0xff, 0x0e, 0x13, 0x10, 0xff, 0x0f, 0x15, 0x11, 0xff, 0x0d, 0x18, 0x11, 0xff, 0x0e, 0x19, 0x13, 0xff, 0x10, 0x1a, 0x15, 0xff, 0x12, 0x1c, 0x16, 0xff, 0x11, 0x1b, 0x15, 0xff, 0x10, 0x1a, 0x14, 0xff, 0x12, 0x1b, 0x16, 0xff, 0x12, 0x1d, 0x16, 0xff, 0x12, 0x1f, 0x16, 0xff, 0x14, 0x1f, 0x17, 0xff, 0x13, 0x1f, 0x15, 0xff, 0x11, 0x1a, 0x13, 0xff, 0x0b, 0x11, 0x0d, 0xff, 0x07, 0x0c, 0x08, 0xff, 0x07, 0x0b, 0x0a, 0xff, 0x07, 0x0c, 0x09, 0xff, 0x0a, 0x10, 0x0a, 0xff, 0x0c, 0x11, 0x0c, 0xff, 0x10, 0x14, 0x10, 0xff, 0x0b, 0x0d, 0x0b, 0xff, 0x02, 0x03, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x06, 0x03, 0x03, 0xff, 0x02, 0x03, 0x00, 0xff, 0x10, 0x13, 0x20, 0xff, 0x2e, 0x2d, 0x67, 0xff, 0x35, 0x37, 0x6a, 0xff, 0x0f, 0x17, 0x23, 0xff, 0x00, 0x00, 0x00, 0xff, 0x04, 0x01, 0x00, 0xff, 0x08, 0x03, 0x03, 0xff, 0x08, 0x01, 0x00, 0xff, 0x06, 0x00, 0x00, 0xff, 0x0d, 0x0a, 0x0f, 0xff, 0x05, 0x08, 0x16, 0xff, 0x02, 0x0b, 0x1d, 0xff, 0x12, 0x1e, 0x36, 0xff, 0x12, 0x1f, 0x3a, 0xff, 0x12, 0x1c, 0x36, 0xff, 0x2d, 0x33, 0x3c, 0xff, 0x39, 0x41, 0x4f, 0xff, 0x44, 0x56, 0x71, 0xff, 0x57, 0x6f, 0x93, 0xff, 0x50, 0x66, 0x8d, 0xff, 0x38, 0x4b, 0x6b, 0xff, 0x28, 0x32, 0x48, 0xff, 0x18, 0x17, 0x26, 0xff, 0x00, 0x00, 0x12, 0xff, 0x00, 0x00, 0x13, 0xff, 0x00, 0x07, 0x27, 0xff, 0x2c, 0x3c, 0x5c, 0xff, 0x79, 0x93, 0xb2, 0xff, 0xa3, 0xc5, 0xe3, 0xff, 0xaa, 0xd2, 0xf0, 0xff, 0xb1, 0xd3, 0xf1, 0xff, 0xbf, 0xd2, 0xed, 0xff, 0xbb, 0xcf, 0xeb, 0xff, 0xb1, 0xc7, 0xe4, 0xff, 0xb8, 0xcd, 0xea, 0xff, 0xba, 0xd0, 0xed, 0xff, 0xb8, 0xcd, 0xeb, 0xff, 0xb8, 0xca, 0xe9, 0xff, 0xb6, 0xcc, 0xeb, 0xff, 0x9f, 0xb8, 0xe0, 0xff, 0x85, 0x9a, 0xca, 0xff, 0x4a, 0x5f, 0x89, 0xff, 0x00, 0x19, 0x30, 0xff, 0x0a, 0x28, 0x32, 0xff, 0x42, 0x57, 0x6c, 0xff, 0x66, 0x70, 0xaf, 0xff, 0x65, 0x7e, 0xbc, 0xff, 0x6e, 0x96, 0xbb, 0xff, 0x6d, 0x91, 0xba, 0xff, 0x69, 0x8b, 0xb6, 0xff, 0x67, 0x89, 0xb3, 0xff, 0x62, 0x80, 0xb0, 0xff, 0x5d, 0x79, 0xaf, 0xff, 0x63, 0x7d, 0xb6, 0xff, 0x78, 0x95, 0xc5, 0xff, 0x7c, 0x9f, 0xca, 0xff, 0x6d, 0x93, 0xc4, 0xff, 0x58, 0x7f, 0xaf, 0xff, 0x4d, 0x70, 0x9c, 0xff, 0x56, 0x79, 0xa4, 0xff, 0x50, 0x77, 0xa7, 0xff, 0x35, 0x62, 0x99, 0xff, 0x35, 0x63, 0xa1, 0xff, 0x47, 0x6d, 0xa6, 0xff, 0x2d, 0x3f, 0x5f, 0xff, 0x05, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x41, 0x5f, 0x81, 0xff, 0x5f, 0x86, 0xc6, 0xff, 0x75, 0x91, 0xd6, 0xff, 0x8c, 0xaa, 0xee, 0xff, 0x57, 0x77, 0x9c, 0xff, 0x38, 0x55, 0x53, 0xff, 0x46, 0x62, 0x4e, 0xff, 0x45, 0x60, 0x53, 0xff, 0x41, 0x5e, 0x5a, 0xff, 0x40, 0x5f, 0x57, 0xff, 0x43, 0x61, 0x4d, 0xff, 0x43, 0x60, 0x51, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x41, 0x5d, 0x50, 0xff, 0x3f, 0x5c, 0x4f, 0xff, 0x41, 0x5d, 0x50, 0xff, 0x40, 0x5c, 0x4f, 0xff, 0x3f, 0x5c, 0x4f, 0xff, 0x3f, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3c, 0x56, 0x49, 0x8b,
+    0x0a, 0x0f, 0x0c, 0xaa, 0x09, 0x0d, 0x0c, 0xff, 0x0a, 0x0f, 0x0d, 0xff, 0x0b, 0x10, 0x0f, 0xff, 0x0c, 0x11, 0x10, 0xff, 0x0d, 0x15, 0x0f, 0xff, 0x0f, 0x16, 0x11, 0xff, 0x11, 0x18, 0x13, 0xff, 0x12, 0x1a, 0x14, 0xff, 0x12, 0x19, 0x14, 0xff, 0x12, 0x19, 0x14, 0xff, 0x13, 0x19, 0x15, 0xff, 0x12, 0x1b, 0x15, 0xff, 0x12, 0x1d, 0x15, 0xff, 0x13, 0x1c, 0x15, 0xff, 0x10, 0x19, 0x12, 0xff, 0x0e, 0x15, 0x0f, 0xff, 0x09, 0x0d, 0x09, 0xff, 0x02, 0x05, 0x04, 0xff, 0x03, 0x04, 0x03, 0xff, 0x01, 0x06, 0x02, 0xff, 0x04, 0x0b, 0x06, 0xff, 0x0b, 0x0f, 0x09, 0xff, 0x0b, 0x0e, 0x0b, 0xff, 0x0b, 0x0c, 0x0b, 0xff, 0x07, 0x08, 0x06, 0xff, 0x03, 0x04, 0x02, 0xff, 0x07, 0x05, 0x05, 0xff, 0x01, 0x03, 0x00, 0xff, 0x0a, 0x0e, 0x21, 0xff, 0x2f, 0x2c, 0x7b, 0xff, 0x2b, 0x2c, 0x81, 0xff, 0x12, 0x18, 0x44, 0xff, 0x00, 0x00, 0x02, 0xff, 0x02, 0x01, 0x00, 0xff, 0x04, 0x02, 0x01, 0xff, 0x0c, 0x03, 0x01, 0xff, 0x06, 0x00, 0x00, 0xff, 0x00, 0x00, 0x09, 0xff, 0x04, 0x0b, 0x1f, 0xff, 0x12, 0x23, 0x41, 0xff, 0x32, 0x48, 0x6d, 0xff, 0x38, 0x4e, 0x79, 0xff, 0x56, 0x6a, 0x98, 0xff, 0x61, 0x83, 0xaf, 0xff, 0x6e, 0x98, 0xc6, 0xff, 0x6d, 0x9c, 0xd0, 0xff, 0x5e, 0x91, 0xca, 0xff, 0x5a, 0x8c, 0xc5, 0xff, 0x54, 0x80, 0xb4, 0xff, 0x55, 0x78, 0xa6, 0xff, 0x5a, 0x7b, 0xa4, 0xff, 0x58, 0x77, 0x9e, 0xff, 0x54, 0x6f, 0x97, 0xff, 0x2b, 0x41, 0x6a, 0xff, 0x0e, 0x1f, 0x48, 0xff, 0x2c, 0x3e, 0x66, 0xff, 0x68, 0x7b, 0xa2, 0xff, 0x99, 0xae, 0xd5, 0xff, 0xb2, 0xcb, 0xee, 0xff, 0xb6, 0xcf, 0xef, 0xff, 0xb2, 0xc9, 0xea, 0xff, 0xab, 0xc1, 0xe3, 0xff, 0xaf, 0xc6, 0xe7, 0xff, 0xb3, 0xc9, 0xea, 0xff, 0xb5, 0xcb, 0xed, 0xff, 0xb1, 0xc8, 0xeb, 0xff, 0x95, 0xaf, 0xd4, 0xff, 0x70, 0x8b, 0xb9, 0xff, 0x52, 0x6d, 0xa1, 0xff, 0x34, 0x51, 0x83, 0xff, 0x4b, 0x6f, 0x92, 0xff, 0x7d, 0xa6, 0xc2, 0xff, 0x67, 0x8b, 0xb4, 0xff, 0x3b, 0x4f, 0x94, 0xff, 0x42, 0x57, 0x90, 0xff, 0x3f, 0x5d, 0x7d, 0xff, 0x3a, 0x55, 0x73, 0xff, 0x37, 0x51, 0x70, 0xff, 0x41, 0x57, 0x74, 0xff, 0x38, 0x4b, 0x6d, 0xff, 0x38, 0x4f, 0x7a, 0xff, 0x40, 0x59, 0x89, 0xff, 0x2d, 0x48, 0x7a, 0xff, 0x47, 0x69, 0x96, 0xff, 0x5f, 0x84, 0xb7, 0xff, 0x4e, 0x78, 0xaa, 0xff, 0x4f, 0x74, 0xa3, 0xff, 0x5f, 0x83, 0xaf, 0xff, 0x56, 0x81, 0xaf, 0xff, 0x46, 0x77, 0xaa, 0xff, 0x3e, 0x6c, 0xa5, 0xff, 0x40, 0x65, 0x9e, 0xff, 0x34, 0x48, 0x6d, 0xff, 0x00, 0x00, 0x04, 0xff, 0x06, 0x06, 0x0d, 0xff, 0x61, 0x83, 0xab, 0xff, 0x5a, 0x85, 0xca, 0xff, 0x80, 0xa0, 0xe6, 0xff, 0x85, 0xa5, 0xd6, 0xff, 0x3f, 0x5d, 0x73, 0xff, 0x3c, 0x58, 0x53, 0xff, 0x48, 0x62, 0x53, 0xff, 0x44, 0x61, 0x54, 0xff, 0x40, 0x5f, 0x58, 0xff, 0x42, 0x5f, 0x57, 0xff, 0x44, 0x61, 0x50, 0xff, 0x43, 0x5f, 0x51, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x42, 0x5e, 0x51, 0xff, 0x41, 0x5d, 0x50, 0xff, 0x41, 0x5d, 0x50, 0xff, 0x40, 0x5c, 0x4f, 0xff, 0x3f, 0x5c, 0x4f, 0xff, 0x3f, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3d, 0x56, 0x4a, 0xab,
+    0x09, 0x0c, 0x0a, 0xbe, 0x08, 0x0d, 0x0b, 0xff, 0x09, 0x0e, 0x0d, 0xff, 0x0a, 0x0f, 0x0e, 0xff, 0x0b, 0x11, 0x0f, 0xff, 0x0e, 0x14, 0x0f, 0xff, 0x10, 0x16, 0x10, 0xff, 0x11, 0x17, 0x12, 0xff, 0x12, 0x18, 0x13, 0xff, 0x12, 0x18, 0x13, 0xff, 0x13, 0x19, 0x14, 0xff, 0x14, 0x1a, 0x15, 0xff, 0x13, 0x1a, 0x15, 0xff, 0x11, 0x18, 0x13, 0xff, 0x10, 0x16, 0x12, 0xff, 0x0e, 0x14, 0x10, 0xff, 0x0b, 0x10, 0x0b, 0xff, 0x06, 0x09, 0x07, 0xff, 0x02, 0x05, 0x04, 0xff, 0x03, 0x03, 0x02, 0xff, 0x02, 0x04, 0x01, 0xff, 0x03, 0x08, 0x02, 0xff, 0x06, 0x0a, 0x05, 0xff, 0x0b, 0x0e, 0x0a, 0xff, 0x0a, 0x0c, 0x0b, 0xff, 0x08, 0x09, 0x07, 0xff, 0x04, 0x05, 0x03, 0xff, 0x04, 0x04, 0x04, 0xff, 0x01, 0x03, 0x00, 0xff, 0x01, 0x04, 0x12, 0xff, 0x2b, 0x2a, 0x77, 0xff, 0x2a, 0x2a, 0x8f, 0xff, 0x1f, 0x25, 0x68, 0xff, 0x0b, 0x0f, 0x18, 0xff, 0x00, 0x00, 0x00, 0xff, 0x04, 0x01, 0x04, 0xff, 0x03, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x04, 0x09, 0x1c, 0xff, 0x0d, 0x1d, 0x3c, 0xff, 0x29, 0x40, 0x6a, 0xff, 0x42, 0x5f, 0x8f, 0xff, 0x44, 0x63, 0x97, 0xff, 0x57, 0x77, 0xac, 0xff, 0x4e, 0x71, 0xb4, 0xff, 0x36, 0x58, 0x98, 0xff, 0x41, 0x5d, 0x91, 0xff, 0x41, 0x5c, 0x87, 0xff, 0x42, 0x5b, 0x80, 0xff, 0x4a, 0x5f, 0x8a, 0xff, 0x38, 0x4e, 0x81, 0xff, 0x34, 0x53, 0x8b, 0xff, 0x2b, 0x5e, 0x8e, 0xff, 0x2f, 0x5d, 0x8d, 0xff, 0x66, 0x89, 0xbe, 0xff, 0x68, 0x85, 0xbc, 0xff, 0x59, 0x70, 0xa2, 0xff, 0x50, 0x60, 0x8f, 0xff, 0x6b, 0x79, 0xa4, 0xff, 0x98, 0xac, 0xd3, 0xff, 0xa2, 0xbf, 0xe4, 0xff, 0xac, 0xc6, 0xeb, 0xff, 0xad, 0xc3, 0xe7, 0xff, 0xab, 0xc1, 0xe4, 0xff, 0xb1, 0xc6, 0xe9, 0xff, 0xaf, 0xc6, 0xec, 0xff, 0xa2, 0xbb, 0xe4, 0xff, 0x81, 0x9d, 0xc9, 0xff, 0x68, 0x89, 0xb3, 0xff, 0x62, 0x85, 0xae, 0xff, 0x6f, 0x93, 0xc7, 0xff, 0x74, 0x96, 0xd5, 0xff, 0x40, 0x5e, 0x9f, 0xff, 0x0b, 0x2b, 0x66, 0xff, 0x1d, 0x3a, 0x5f, 0xff, 0x2c, 0x32, 0x41, 0xff, 0x15, 0x15, 0x20, 0xff, 0x00, 0x00, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x04, 0x05, 0xff, 0x31, 0x39, 0x3d, 0xff, 0x1d, 0x27, 0x34, 0xff, 0x26, 0x32, 0x44, 0xff, 0x36, 0x4a, 0x75, 0xff, 0x1f, 0x3b, 0x6d, 0xff, 0x3e, 0x5f, 0x91, 0xff, 0x43, 0x69, 0x9a, 0xff, 0x59, 0x7b, 0xa8, 0xff, 0x6b, 0x8c, 0xb6, 0xff, 0x63, 0x8a, 0xb4, 0xff, 0x51, 0x7e, 0xab, 0xff, 0x40, 0x6e, 0xa2, 0xff, 0x3c, 0x62, 0x9a, 0xff, 0x34, 0x49, 0x71, 0xff, 0x00, 0x00, 0x09, 0xff, 0x09, 0x0a, 0x15, 0xff, 0x6f, 0x91, 0xbd, 0xff, 0x60, 0x8c, 0xd2, 0xff, 0x84, 0xa4, 0xe7, 0xff, 0x6c, 0x8d, 0xad, 0xff, 0x36, 0x55, 0x5d, 0xff, 0x45, 0x60, 0x56, 0xff, 0x48, 0x62, 0x52, 0xff, 0x42, 0x61, 0x55, 0xff, 0x40, 0x60, 0x57, 0xff, 0x43, 0x5f, 0x55, 0xff, 0x47, 0x60, 0x52, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x42, 0x5e, 0x51, 0xff, 0x42, 0x5e, 0x51, 0xff, 0x41, 0x5d, 0x50, 0xff, 0x40, 0x5c, 0x4f, 0xff, 0x40, 0x5c, 0x4f, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3c, 0x57, 0x49, 0xbe,
+    0x08, 0x0a, 0x09, 0xd3, 0x07, 0x0b, 0x08, 0xff, 0x09, 0x0d, 0x09, 0xff, 0x0c, 0x0f, 0x0c, 0xff, 0x0d, 0x11, 0x0e, 0xff, 0x0d, 0x14, 0x0f, 0xff, 0x0f, 0x16, 0x11, 0xff, 0x0f, 0x16, 0x11, 0xff, 0x10, 0x17, 0x12, 0xff, 0x10, 0x17, 0x12, 0xff, 0x10, 0x17, 0x12, 0xff, 0x11, 0x18, 0x13, 0xff, 0x11, 0x18, 0x13, 0xff, 0x10, 0x17, 0x10, 0xff, 0x0d, 0x14, 0x0e, 0xff, 0x0b, 0x11, 0x0b, 0xff, 0x09, 0x0d, 0x09, 0xff, 0x07, 0x08, 0x06, 0xff, 0x04, 0x06, 0x03, 0xff, 0x05, 0x02, 0x03, 0xff, 0x03, 0x04, 0x02, 0xff, 0x01, 0x07, 0x00, 0xff, 0x04, 0x08, 0x02, 0xff, 0x07, 0x0b, 0x06, 0xff, 0x08, 0x0b, 0x08, 0xff, 0x05, 0x08, 0x07, 0xff, 0x02, 0x04, 0x04, 0xff, 0x00, 0x03, 0x03, 0xff, 0x02, 0x03, 0x00, 0xff, 0x00, 0x00, 0x01, 0xff, 0x1d, 0x22, 0x5c, 0xff, 0x2e, 0x34, 0x93, 0xff, 0x28, 0x2f, 0x7e, 0xff, 0x1c, 0x24, 0x3e, 0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x04, 0x09, 0xff, 0x0c, 0x0d, 0x1c, 0xff, 0x19, 0x20, 0x37, 0xff, 0x1e, 0x31, 0x51, 0xff, 0x22, 0x3d, 0x65, 0xff, 0x33, 0x51, 0x80, 0xff, 0x2b, 0x4c, 0x81, 0xff, 0x3b, 0x5c, 0x95, 0xff, 0x40, 0x60, 0x9a, 0xff, 0x1f, 0x3d, 0x73, 0xff, 0x2f, 0x45, 0x70, 0xff, 0x22, 0x2d, 0x43, 0xff, 0x21, 0x24, 0x27, 0xff, 0x23, 0x23, 0x20, 0xff, 0x20, 0x22, 0x25, 0xff, 0x06, 0x0a, 0x1a, 0xff, 0x0c, 0x13, 0x25, 0xff, 0x23, 0x36, 0x5c, 0xff, 0x0d, 0x28, 0x59, 0xff, 0x20, 0x3a, 0x71, 0xff, 0x49, 0x68, 0xa6, 0xff, 0x64, 0x89, 0xc7, 0xff, 0x62, 0x89, 0xbd, 0xff, 0x4a, 0x73, 0x9e, 0xff, 0x6c, 0x94, 0xbd, 0xff, 0x99, 0xbb, 0xe4, 0xff, 0xa9, 0xc7, 0xee, 0xff, 0xac, 0xc5, 0xe9, 0xff, 0xb2, 0xc6, 0xe9, 0xff, 0xb6, 0xca, 0xed, 0xff, 0xad, 0xc6, 0xed, 0xff, 0x90, 0xae, 0xdc, 0xff, 0x76, 0x99, 0xc8, 0xff, 0x72, 0x99, 0xbd, 0xff, 0x6f, 0x95, 0xb6, 0xff, 0x63, 0x86, 0xbf, 0xff, 0x2e, 0x4d, 0xa0, 0xff, 0x00, 0x11, 0x67, 0xff, 0x3d, 0x4e, 0x8a, 0xff, 0x59, 0x78, 0x7a, 0xff, 0x0b, 0x18, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x52, 0x4d, 0x39, 0xff, 0x5a, 0x54, 0x3b, 0xff, 0x0b, 0x0c, 0x00, 0xff, 0x88, 0x8e, 0x78, 0xff, 0xb6, 0xb9, 0xbc, 0xff, 0x2a, 0x31, 0x30, 0xff, 0x0e, 0x11, 0x27, 0xff, 0x2a, 0x37, 0x68, 0xff, 0x39, 0x56, 0x8d, 0xff, 0x47, 0x68, 0x9b, 0xff, 0x59, 0x7c, 0xa9, 0xff, 0x6c, 0x8f, 0xb8, 0xff, 0x70, 0x96, 0xbb, 0xff, 0x5f, 0x88, 0xb1, 0xff, 0x4b, 0x79, 0xac, 0xff, 0x38, 0x63, 0x9c, 0xff, 0x2c, 0x43, 0x6f, 0xff, 0x00, 0x00, 0x08, 0xff, 0x05, 0x0a, 0x14, 0xff, 0x72, 0x95, 0xc8, 0xff, 0x74, 0x9f, 0xe2, 0xff, 0x7e, 0x9c, 0xd8, 0xff, 0x55, 0x74, 0x85, 0xff, 0x35, 0x56, 0x4f, 0xff, 0x47, 0x62, 0x54, 0xff, 0x4a, 0x62, 0x55, 0xff, 0x43, 0x61, 0x54, 0xff, 0x3f, 0x61, 0x53, 0xff, 0x43, 0x60, 0x53, 0xff, 0x46, 0x60, 0x53, 0xff, 0x44, 0x5f, 0x52, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x42, 0x5e, 0x51, 0xff, 0x42, 0x5e, 0x51, 0xff, 0x41, 0x5d, 0x50, 0xff, 0x40, 0x5c, 0x4f, 0xff, 0x40, 0x5b, 0x4f, 0xff, 0x42, 0x5a, 0x4e, 0xff, 0x42, 0x5a, 0x4e, 0xff, 0x42, 0x5a, 0x4e, 0xff, 0x43, 0x5b, 0x4f, 0xff, 0x41, 0x59, 0x4d, 0xff, 0x41, 0x59, 0x4d, 0xff, 0x41, 0x59, 0x4d, 0xff, 0x40, 0x59, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3c, 0x57, 0x49, 0xd3,
+    0x05, 0x08, 0x06, 0xe7, 0x07, 0x08, 0x08, 0xff, 0x09, 0x0b, 0x0b, 0xff, 0x0c, 0x0d, 0x0d, 0xff, 0x0d, 0x0f, 0x0f, 0xff, 0x0d, 0x13, 0x0f, 0xff, 0x0f, 0x15, 0x11, 0xff, 0x0f, 0x15, 0x11, 0xff, 0x0f, 0x15, 0x10, 0xff, 0x0e, 0x15, 0x10, 0xff, 0x0f, 0x16, 0x11, 0xff, 0x0f, 0x15, 0x10, 0xff, 0x0e, 0x15, 0x10, 0xff, 0x0d, 0x16, 0x0f, 0xff, 0x0b, 0x12, 0x0d, 0xff, 0x06, 0x0d, 0x08, 0xff, 0x05, 0x09, 0x06, 0xff, 0x06, 0x07, 0x04, 0xff, 0x03, 0x02, 0x01, 0xff, 0x04, 0x00, 0x01, 0xff, 0x02, 0x03, 0x01, 0xff, 0x00, 0x05, 0x00, 0xff, 0x04, 0x07, 0x03, 0xff, 0x05, 0x08, 0x05, 0xff, 0x06, 0x09, 0x06, 0xff, 0x01, 0x05, 0x04, 0xff, 0x00, 0x03, 0x03, 0xff, 0x00, 0x03, 0x03, 0xff, 0x07, 0x02, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x10, 0x2b, 0xff, 0x2c, 0x3d, 0x8b, 0xff, 0x31, 0x36, 0x8c, 0xff, 0x1c, 0x1f, 0x48, 0xff, 0x00, 0x00, 0x00, 0xff, 0x09, 0x05, 0x05, 0xff, 0x24, 0x33, 0x52, 0xff, 0x31, 0x4e, 0x78, 0xff, 0x30, 0x4f, 0x7d, 0xff, 0x32, 0x55, 0x88, 0xff, 0x34, 0x59, 0x8f, 0xff, 0x2c, 0x52, 0x89, 0xff, 0x35, 0x58, 0x8e, 0xff, 0x16, 0x32, 0x66, 0xff, 0x19, 0x27, 0x42, 0xff, 0x0b, 0x13, 0x1c, 0xff, 0x1a, 0x22, 0x22, 0xff, 0x24, 0x30, 0x22, 0xff, 0x0c, 0x17, 0x02, 0xff, 0x04, 0x0d, 0x00, 0xff, 0x28, 0x2b, 0x18, 0xff, 0x37, 0x35, 0x19, 0xff, 0x18, 0x17, 0x15, 0xff, 0x65, 0x71, 0x84, 0xff, 0x2f, 0x44, 0x69, 0xff, 0x12, 0x33, 0x6d, 0xff, 0x1b, 0x41, 0x86, 0xff, 0x3d, 0x69, 0xa5, 0xff, 0x46, 0x74, 0xa9, 0xff, 0x5e, 0x89, 0xb8, 0xff, 0x96, 0xbc, 0xe3, 0xff, 0xa2, 0xc3, 0xe8, 0xff, 0xa8, 0xc6, 0xe6, 0xff, 0xb0, 0xcb, 0xea, 0xff, 0xb1, 0xcb, 0xed, 0xff, 0xa4, 0xc1, 0xe8, 0xff, 0x83, 0xa4, 0xd3, 0xff, 0x7d, 0x9f, 0xc9, 0xff, 0x75, 0x98, 0xbe, 0xff, 0x52, 0x78, 0xb1, 0xff, 0x27, 0x4b, 0x91, 0xff, 0x0d, 0x29, 0x78, 0xff, 0x28, 0x3d, 0x7e, 0xff, 0xa8, 0xbc, 0xd1, 0xff, 0xbb, 0xce, 0xc3, 0xff, 0x4b, 0x5e, 0x48, 0xff, 0x13, 0x1c, 0x1a, 0xff, 0x64, 0x71, 0x4c, 0xff, 0x82, 0x87, 0x64, 0xff, 0x67, 0x69, 0x3e, 0xff, 0xad, 0xb0, 0x94, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xb3, 0xc7, 0xc7, 0xff, 0x43, 0x47, 0x6b, 0xff, 0x00, 0x04, 0x35, 0xff, 0x16, 0x32, 0x6f, 0xff, 0x3a, 0x5d, 0x98, 0xff, 0x5e, 0x82, 0xb7, 0xff, 0x72, 0x98, 0xc5, 0xff, 0x6b, 0x96, 0xbf, 0xff, 0x5f, 0x8f, 0xbc, 0xff, 0x52, 0x7e, 0xb3, 0xff, 0x3d, 0x67, 0x9e, 0xff, 0x33, 0x51, 0x7c, 0xff, 0x00, 0x00, 0x0d, 0xff, 0x1d, 0x23, 0x33, 0xff, 0x84, 0xa7, 0xd7, 0xff, 0x7a, 0xa1, 0xe3, 0xff, 0x73, 0x90, 0xc8, 0xff, 0x42, 0x63, 0x65, 0xff, 0x3c, 0x5d, 0x4d, 0xff, 0x47, 0x62, 0x53, 0xff, 0x48, 0x60, 0x55, 0xff, 0x44, 0x61, 0x55, 0xff, 0x40, 0x61, 0x53, 0xff, 0x43, 0x60, 0x53, 0xff, 0x46, 0x60, 0x53, 0xff, 0x44, 0x5f, 0x52, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x42, 0x5e, 0x51, 0xff, 0x42, 0x5e, 0x51, 0xff, 0x40, 0x5d, 0x50, 0xff, 0x40, 0x5c, 0x4f, 0xff, 0x40, 0x5c, 0x4f, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x42, 0x5c, 0x4f, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3c, 0x56, 0x4a, 0xe6,
+    0x05, 0x06, 0x05, 0xf0, 0x05, 0x07, 0x07, 0xff, 0x08, 0x0a, 0x0a, 0xff, 0x0c, 0x0d, 0x0e, 0xff, 0x0d, 0x10, 0x0f, 0xff, 0x0d, 0x13, 0x0d, 0xff, 0x0f, 0x15, 0x0f, 0xff, 0x0f, 0x15, 0x0f, 0xff, 0x0f, 0x15, 0x10, 0xff, 0x0f, 0x15, 0x10, 0xff, 0x0f, 0x14, 0x0f, 0xff, 0x0e, 0x14, 0x0f, 0xff, 0x0d, 0x12, 0x0e, 0xff, 0x0c, 0x11, 0x0e, 0xff, 0x0a, 0x0f, 0x0c, 0xff, 0x08, 0x0a, 0x09, 0xff, 0x05, 0x06, 0x05, 0xff, 0x04, 0x03, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x00, 0x01, 0xff, 0x02, 0x02, 0x00, 0xff, 0x04, 0x03, 0x02, 0xff, 0x06, 0x04, 0x04, 0xff, 0x05, 0x06, 0x04, 0xff, 0x02, 0x05, 0x03, 0xff, 0x00, 0x01, 0x01, 0xff, 0x00, 0x02, 0x02, 0xff, 0x07, 0x01, 0x03, 0xff, 0x04, 0x00, 0x01, 0xff, 0x00, 0x03, 0x0c, 0xff, 0x1d, 0x2a, 0x66, 0xff, 0x38, 0x44, 0x9a, 0xff, 0x1d, 0x21, 0x57, 0xff, 0x00, 0x00, 0x01, 0xff, 0x06, 0x01, 0x03, 0xff, 0x1f, 0x35, 0x63, 0xff, 0x31, 0x59, 0x94, 0xff, 0x3d, 0x64, 0x9b, 0xff, 0x3c, 0x67, 0x9e, 0xff, 0x31, 0x5d, 0x92, 0xff, 0x2e, 0x56, 0x8b, 0xff, 0x2d, 0x4b, 0x7c, 0xff, 0x11, 0x22, 0x4b, 0xff, 0x04, 0x00, 0x0d, 0xff, 0x1b, 0x15, 0x20, 0xff, 0xaf, 0xb4, 0xbd, 0xff, 0x71, 0x80, 0x7e, 0xff, 0x33, 0x3f, 0x34, 0xff, 0x20, 0x25, 0x17, 0xff, 0x88, 0x82, 0x68, 0xff, 0xa8, 0x9d, 0x78, 0xff, 0x57, 0x5d, 0x35, 0xff, 0xc2, 0xcf, 0xc0, 0xff, 0xac, 0xc1, 0xd4, 0xff, 0x45, 0x65, 0x9b, 0xff, 0x31, 0x53, 0x98, 0xff, 0x13, 0x35, 0x7c, 0xff, 0x28, 0x3e, 0x88, 0xff, 0x44, 0x59, 0x98, 0xff, 0x79, 0xa4, 0xcd, 0xff, 0xab, 0xd0, 0xf5, 0xff, 0xb4, 0xcf, 0xf1, 0xff, 0xb7, 0xcd, 0xee, 0xff, 0xb4, 0xcd, 0xef, 0xff, 0xa2, 0xc0, 0xe7, 0xff, 0x85, 0xaa, 0xd7, 0xff, 0x80, 0xa5, 0xcf, 0xff, 0x66, 0x88, 0xb5, 0xff, 0x38, 0x59, 0x9f, 0xff, 0x2f, 0x4c, 0x9e, 0xff, 0x50, 0x69, 0xac, 0xff, 0x97, 0xb1, 0xce, 0xff, 0xe4, 0xf8, 0xfa, 0xff, 0xf8, 0xf2, 0xec, 0xff, 0x72, 0x86, 0x74, 0xff, 0x2d, 0x5c, 0x4c, 0xff, 0x4c, 0x6f, 0x45, 0xff, 0x66, 0x78, 0x55, 0xff, 0x76, 0x84, 0x5e, 0xff, 0xd9, 0xea, 0xcf, 0xff, 0xda, 0xeb, 0xf1, 0xff, 0xb7, 0xc9, 0xda, 0xff, 0x77, 0x88, 0xc0, 0xff, 0x1b, 0x35, 0x73, 0xff, 0x24, 0x43, 0x83, 0xff, 0x3a, 0x60, 0xa1, 0xff, 0x63, 0x89, 0xc5, 0xff, 0x70, 0x98, 0xcb, 0xff, 0x69, 0x95, 0xc2, 0xff, 0x5e, 0x90, 0xc1, 0xff, 0x50, 0x83, 0xb3, 0xff, 0x4b, 0x75, 0xac, 0xff, 0x49, 0x61, 0x90, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x45, 0x4f, 0x64, 0xff, 0x94, 0xbc, 0xe9, 0xff, 0x7f, 0xa3, 0xe0, 0xff, 0x66, 0x82, 0xb0, 0xff, 0x3e, 0x5f, 0x55, 0xff, 0x41, 0x61, 0x4e, 0xff, 0x45, 0x60, 0x53, 0xff, 0x46, 0x61, 0x55, 0xff, 0x43, 0x61, 0x55, 0xff, 0x40, 0x61, 0x53, 0xff, 0x43, 0x60, 0x53, 0xff, 0x46, 0x60, 0x53, 0xff, 0x44, 0x5f, 0x52, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x42, 0x5e, 0x51, 0xff, 0x43, 0x5e, 0x51, 0xff, 0x42, 0x5d, 0x50, 0xff, 0x41, 0x5c, 0x4f, 0xff, 0x41, 0x5c, 0x4f, 0xff, 0x42, 0x5c, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3d, 0x58, 0x4b, 0xf0,
+    0x08, 0x08, 0x07, 0xf3, 0x07, 0x0a, 0x07, 0xff, 0x09, 0x0d, 0x0a, 0xff, 0x0f, 0x11, 0x0f, 0xff, 0x10, 0x14, 0x11, 0xff, 0x0d, 0x17, 0x0f, 0xff, 0x0e, 0x18, 0x10, 0xff, 0x0e, 0x18, 0x0f, 0xff, 0x0d, 0x15, 0x0f, 0xff, 0x0e, 0x13, 0x10, 0xff, 0x0c, 0x11, 0x0f, 0xff, 0x0a, 0x10, 0x0d, 0xff, 0x0c, 0x0f, 0x0d, 0xff, 0x0f, 0x0d, 0x0c, 0xff, 0x0b, 0x0b, 0x0a, 0xff, 0x0a, 0x06, 0x07, 0xff, 0x07, 0x03, 0x04, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x02, 0x01, 0xff, 0x03, 0x00, 0x01, 0xff, 0x04, 0x00, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x05, 0x02, 0x02, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x03, 0x02, 0xff, 0x04, 0x04, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x03, 0x03, 0x00, 0xff, 0x02, 0x02, 0x0c, 0xff, 0x07, 0x00, 0x13, 0xff, 0x0d, 0x00, 0x00, 0xff, 0x07, 0x12, 0x1f, 0xff, 0x25, 0x3c, 0x8c, 0xff, 0x2a, 0x33, 0x82, 0xff, 0x00, 0x01, 0x0c, 0xff, 0x05, 0x02, 0x01, 0xff, 0x28, 0x3c, 0x6a, 0xff, 0x3a, 0x5f, 0x9e, 0xff, 0x49, 0x73, 0xa8, 0xff, 0x46, 0x77, 0xa9, 0xff, 0x37, 0x69, 0x97, 0xff, 0x32, 0x5a, 0x88, 0xff, 0x16, 0x2d, 0x59, 0xff, 0x00, 0x00, 0x1c, 0xff, 0x15, 0x1b, 0x52, 0xff, 0x6e, 0x76, 0xa9, 0xff, 0xc3, 0xc8, 0xdb, 0xff, 0x98, 0x9c, 0x98, 0xff, 0x38, 0x41, 0x2d, 0xff, 0x4f, 0x5d, 0x4e, 0xff, 0x63, 0x7a, 0x77, 0xff, 0x50, 0x68, 0x65, 0xff, 0x79, 0x83, 0x68, 0xff, 0xf4, 0xfb, 0xe9, 0xff, 0xf1, 0xfa, 0xff, 0xff, 0xb3, 0xc6, 0xea, 0xff, 0x86, 0xa1, 0xd4, 0xff, 0x4f, 0x70, 0xae, 0xff, 0x06, 0x21, 0x67, 0xff, 0x0f, 0x2a, 0x6b, 0xff, 0x5d, 0x8b, 0xb9, 0xff, 0xa7, 0xc9, 0xf4, 0xff, 0xbb, 0xcd, 0xf4, 0xff, 0xc6, 0xd1, 0xf5, 0xff, 0xbd, 0xcd, 0xf1, 0xff, 0xaa, 0xc4, 0xeb, 0xff, 0x84, 0xad, 0xd6, 0xff, 0x71, 0x9b, 0xce, 0xff, 0x54, 0x75, 0xb0, 0xff, 0x61, 0x7f, 0xad, 0xff, 0x91, 0xad, 0xd8, 0xff, 0x82, 0xa4, 0xd5, 0xff, 0x93, 0xb6, 0xe6, 0xff, 0xa6, 0xbe, 0xdc, 0xff, 0xea, 0xee, 0xf3, 0xff, 0xe1, 0xe8, 0xda, 0xff, 0x86, 0x9e, 0x83, 0xff, 0x6f, 0x83, 0x5f, 0xff, 0x83, 0x8f, 0x6b, 0xff, 0xc4, 0xcf, 0xb5, 0xff, 0xe4, 0xf3, 0xef, 0xff, 0xb1, 0xc6, 0xde, 0xff, 0x85, 0x9f, 0xc5, 0xff, 0x4a, 0x6c, 0xa5, 0xff, 0x33, 0x58, 0x98, 0xff, 0x53, 0x77, 0xb5, 0xff, 0x58, 0x82, 0xbd, 0xff, 0x5f, 0x8b, 0xc4, 0xff, 0x6c, 0x97, 0xca, 0xff, 0x74, 0x9e, 0xcd, 0xff, 0x69, 0x95, 0xc6, 0xff, 0x4e, 0x8e, 0xb6, 0xff, 0x4e, 0x79, 0xb2, 0xff, 0x55, 0x5d, 0x93, 0xff, 0x06, 0x0b, 0x0d, 0xff, 0x61, 0x71, 0xa2, 0xff, 0x8f, 0xb7, 0xfe, 0xff, 0x7c, 0xa0, 0xdd, 0xff, 0x5d, 0x79, 0x95, 0xff, 0x40, 0x60, 0x51, 0xff, 0x45, 0x62, 0x53, 0xff, 0x45, 0x61, 0x55, 0xff, 0x44, 0x62, 0x53, 0xff, 0x42, 0x61, 0x53, 0xff, 0x40, 0x61, 0x53, 0xff, 0x43, 0x60, 0x53, 0xff, 0x46, 0x60, 0x53, 0xff, 0x44, 0x5f, 0x52, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x43, 0x5e, 0x51, 0xff, 0x44, 0x5e, 0x51, 0xff, 0x44, 0x5d, 0x50, 0xff, 0x42, 0x5c, 0x4f, 0xff, 0x42, 0x5c, 0x4f, 0xff, 0x42, 0x5c, 0x4f, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3d, 0x58, 0x4a, 0xf3,
+    0x0a, 0x0b, 0x09, 0xff, 0x09, 0x0d, 0x0a, 0xff, 0x0b, 0x11, 0x0b, 0xff, 0x10, 0x15, 0x10, 0xff, 0x11, 0x17, 0x12, 0xff, 0x0f, 0x1a, 0x12, 0xff, 0x0e, 0x1a, 0x11, 0xff, 0x0c, 0x16, 0x10, 0xff, 0x0c, 0x13, 0x0e, 0xff, 0x0b, 0x11, 0x0d, 0xff, 0x09, 0x0e, 0x0e, 0xff, 0x09, 0x0c, 0x0b, 0xff, 0x0a, 0x0c, 0x0a, 0xff, 0x0c, 0x09, 0x09, 0xff, 0x09, 0x06, 0x06, 0xff, 0x07, 0x04, 0x04, 0xff, 0x05, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x02, 0x02, 0xff, 0x03, 0x02, 0x02, 0xff, 0x03, 0x03, 0x03, 0xff, 0x00, 0x00, 0x00, 0xff, 0x03, 0x03, 0x00, 0xff, 0x00, 0x03, 0x0e, 0xff, 0x04, 0x03, 0x15, 0xff, 0x10, 0x0a, 0x09, 0xff, 0x00, 0x02, 0x0f, 0xff, 0x13, 0x26, 0x68, 0xff, 0x3e, 0x4e, 0xa0, 0xff, 0x0e, 0x14, 0x32, 0xff, 0x00, 0x00, 0x00, 0xff, 0x28, 0x3c, 0x5f, 0xff, 0x46, 0x6b, 0xa2, 0xff, 0x4e, 0x77, 0xab, 0xff, 0x4e, 0x80, 0xb4, 0xff, 0x4b, 0x7d, 0xb2, 0xff, 0x39, 0x62, 0x97, 0xff, 0x13, 0x2d, 0x64, 0xff, 0x04, 0x0f, 0x49, 0xff, 0x1b, 0x38, 0x7c, 0xff, 0x6d, 0x8d, 0xc1, 0xff, 0xa4, 0xbb, 0xcb, 0xff, 0xdb, 0xed, 0xdb, 0xff, 0x8c, 0xa1, 0x7c, 0xff, 0x51, 0x6d, 0x41, 0xff, 0x37, 0x5a, 0x2e, 0xff, 0x50, 0x74, 0x53, 0xff, 0xd6, 0xe2, 0xde, 0xff, 0xee, 0xf5, 0xf8, 0xff, 0xb7, 0xc3, 0xd9, 0xff, 0x8d, 0xa0, 0xc5, 0xff, 0x53, 0x74, 0xa2, 0xff, 0x88, 0xad, 0xe8, 0xff, 0x3d, 0x61, 0xa2, 0xff, 0x06, 0x2a, 0x65, 0xff, 0x4c, 0x76, 0xa8, 0xff, 0xa0, 0xc0, 0xed, 0xff, 0xb3, 0xc7, 0xed, 0xff, 0xbf, 0xce, 0xf0, 0xff, 0xb9, 0xce, 0xef, 0xff, 0xa6, 0xc3, 0xe9, 0xff, 0x81, 0xa9, 0xd1, 0xff, 0x5f, 0x88, 0xbb, 0xff, 0x58, 0x77, 0xad, 0xff, 0x96, 0xb3, 0xd2, 0xff, 0xc4, 0xe1, 0xfc, 0xff, 0x82, 0xa4, 0xd0, 0xff, 0x5d, 0x81, 0xbd, 0xff, 0x65, 0x84, 0xba, 0xff, 0x92, 0xaa, 0xc5, 0xff, 0xc5, 0xcf, 0xe4, 0xff, 0xd1, 0xd6, 0xf4, 0xff, 0xb0, 0xb5, 0xcf, 0xff, 0xc6, 0xcb, 0xdf, 0xff, 0xca, 0xd1, 0xec, 0xff, 0x90, 0x9a, 0xc1, 0xff, 0x6d, 0x7f, 0xb3, 0xff, 0x6c, 0x85, 0xc9, 0xff, 0x62, 0x84, 0xbd, 0xff, 0x60, 0x88, 0xb8, 0xff, 0x67, 0x91, 0xc3, 0xff, 0x71, 0x9c, 0xce, 0xff, 0x5d, 0x8c, 0xbd, 0xff, 0x5f, 0x8f, 0xbe, 0xff, 0x76, 0xa3, 0xcf, 0xff, 0x6e, 0x98, 0xc3, 0xff, 0x5d, 0x97, 0xc6, 0xff, 0x5d, 0x87, 0xb4, 0xff, 0x47, 0x50, 0x80, 0xff, 0x17, 0x23, 0x3c, 0xff, 0x83, 0xa1, 0xcd, 0xff, 0x8a, 0xaf, 0xf2, 0xff, 0x7c, 0x9b, 0xdb, 0xff, 0x59, 0x73, 0x84, 0xff, 0x42, 0x61, 0x50, 0xff, 0x45, 0x63, 0x55, 0xff, 0x44, 0x62, 0x55, 0xff, 0x42, 0x60, 0x53, 0xff, 0x42, 0x60, 0x53, 0xff, 0x43, 0x61, 0x54, 0xff, 0x43, 0x61, 0x54, 0xff, 0x42, 0x60, 0x53, 0xff, 0x41, 0x5f, 0x52, 0xff, 0x42, 0x5f, 0x52, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x43, 0x5e, 0x51, 0xff, 0x44, 0x5e, 0x51, 0xff, 0x43, 0x5e, 0x50, 0xff, 0x43, 0x5c, 0x50, 0xff, 0x42, 0x5b, 0x4f, 0xff, 0x40, 0x5c, 0x4f, 0xff, 0x3f, 0x5b, 0x4e, 0xff, 0x3f, 0x5b, 0x4e, 0xff, 0x3f, 0x5b, 0x4e, 0xff, 0x3e, 0x5a, 0x4d, 0xff, 0x3e, 0x5a, 0x4d, 0xff, 0x3e, 0x5a, 0x4d, 0xff, 0x3e, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff,
+    0x0a, 0x0b, 0x0a, 0xff, 0x0a, 0x0f, 0x0a, 0xff, 0x0d, 0x13, 0x0e, 0xff, 0x11, 0x17, 0x12, 0xff, 0x12, 0x1a, 0x13, 0xff, 0x10, 0x1c, 0x14, 0xff, 0x0f, 0x1a, 0x12, 0xff, 0x0d, 0x15, 0x0f, 0xff, 0x0c, 0x12, 0x0e, 0xff, 0x0b, 0x11, 0x0c, 0xff, 0x09, 0x0c, 0x0c, 0xff, 0x07, 0x09, 0x09, 0xff, 0x07, 0x08, 0x07, 0xff, 0x09, 0x06, 0x07, 0xff, 0x07, 0x05, 0x05, 0xff, 0x05, 0x03, 0x03, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x05, 0x02, 0x02, 0xff, 0x03, 0x02, 0x02, 0xff, 0x01, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xff, 0x04, 0x03, 0x02, 0xff, 0x06, 0x06, 0x0b, 0xff, 0x00, 0x0d, 0x12, 0xff, 0x04, 0x14, 0x1a, 0xff, 0x01, 0x06, 0x23, 0xff, 0x00, 0x0b, 0x3a, 0xff, 0x34, 0x4d, 0x8e, 0xff, 0x1e, 0x2e, 0x64, 0xff, 0x00, 0x00, 0x01, 0xff, 0x28, 0x3a, 0x55, 0xff, 0x49, 0x6e, 0x9e, 0xff, 0x50, 0x7a, 0xab, 0xff, 0x50, 0x80, 0xb5, 0xff, 0x52, 0x86, 0xbf, 0xff, 0x4d, 0x7b, 0xb8, 0xff, 0x3f, 0x61, 0xa2, 0xff, 0x2d, 0x47, 0x8d, 0xff, 0x0e, 0x2c, 0x7e, 0xff, 0x45, 0x65, 0xae, 0xff, 0x7b, 0x98, 0xc7, 0xff, 0xa2, 0xbd, 0xd4, 0xff, 0xd3, 0xeb, 0xf1, 0xff, 0xb9, 0xce, 0xc8, 0xff, 0xaf, 0xbf, 0xb0, 0xff, 0xd4, 0xe4, 0xda, 0xff, 0xc6, 0xdb, 0xed, 0xff, 0xa4, 0xb8, 0xd3, 0xff, 0x98, 0xac, 0xd0, 0xff, 0x85, 0xa0, 0xce, 0xff, 0x67, 0x8a, 0xbe, 0xff, 0x8a, 0xb1, 0xea, 0xff, 0x68, 0x8d, 0xc8, 0xff, 0x18, 0x3c, 0x74, 0xff, 0x40, 0x66, 0x9d, 0xff, 0x9b, 0xbf, 0xee, 0xff, 0xa8, 0xc9, 0xef, 0xff, 0xae, 0xcc, 0xee, 0xff, 0xaf, 0xcd, 0xef, 0xff, 0xa4, 0xc5, 0xed, 0xff, 0x87, 0xaa, 0xd8, 0xff, 0x6f, 0x91, 0xc2, 0xff, 0x6d, 0x8b, 0xb3, 0xff, 0x9c, 0xb6, 0xd1, 0xff, 0xbf, 0xd7, 0xf1, 0xff, 0xb5, 0xd0, 0xf6, 0xff, 0x94, 0xb6, 0xea, 0xff, 0x74, 0x98, 0xd4, 0xff, 0x76, 0xa0, 0xd3, 0xff, 0x8d, 0xa6, 0xd7, 0xff, 0xa3, 0xaa, 0xe1, 0xff, 0x97, 0xa5, 0xd7, 0xff, 0x8e, 0xa0, 0xcc, 0xff, 0x74, 0x8c, 0xb3, 0xff, 0x78, 0x95, 0xbc, 0xff, 0x82, 0xa1, 0xc9, 0xff, 0x87, 0xa8, 0xd3, 0xff, 0x84, 0xa8, 0xd0, 0xff, 0x7b, 0xa3, 0xc9, 0xff, 0x78, 0xa2, 0xcc, 0xff, 0x75, 0xa0, 0xcc, 0xff, 0x73, 0xa2, 0xcd, 0xff, 0x6b, 0x9c, 0xc6, 0xff, 0x6e, 0x9d, 0xc5, 0xff, 0x6d, 0x9b, 0xc3, 0xff, 0x62, 0x94, 0xc5, 0xff, 0x5d, 0x86, 0xaa, 0xff, 0x31, 0x4a, 0x6c, 0xff, 0x3c, 0x52, 0x89, 0xff, 0x7b, 0xa6, 0xc8, 0xff, 0x7c, 0xa7, 0xdd, 0xff, 0x76, 0x94, 0xcc, 0xff, 0x51, 0x6a, 0x69, 0xff, 0x48, 0x65, 0x52, 0xff, 0x43, 0x62, 0x54, 0xff, 0x44, 0x62, 0x55, 0xff, 0x43, 0x61, 0x54, 0xff, 0x43, 0x61, 0x54, 0xff, 0x43, 0x61, 0x54, 0xff, 0x43, 0x61, 0x54, 0xff, 0x42, 0x60, 0x53, 0xff, 0x41, 0x5f, 0x52, 0xff, 0x42, 0x5f, 0x52, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x43, 0x5e, 0x51, 0xff, 0x44, 0x5e, 0x51, 0xff, 0x43, 0x5e, 0x50, 0xff, 0x43, 0x5c, 0x50, 0xff, 0x42, 0x5b, 0x4f, 0xff, 0x40, 0x5c, 0x4f, 0xff, 0x3f, 0x5b, 0x4e, 0xff, 0x3f, 0x5b, 0x4e, 0xff, 0x3f, 0x5b, 0x4e, 0xff, 0x3e, 0x5a, 0x4d, 0xff, 0x3e, 0x5a, 0x4d, 0xff, 0x3e, 0x5a, 0x4d, 0xff, 0x3e, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff,
+    0x0a, 0x0b, 0x09, 0xf3, 0x0e, 0x12, 0x0c, 0xff, 0x11, 0x17, 0x12, 0xff, 0x15, 0x1b, 0x15, 0xff, 0x14, 0x1c, 0x15, 0xff, 0x11, 0x1c, 0x14, 0xff, 0x11, 0x1a, 0x12, 0xff, 0x0e, 0x15, 0x0f, 0xff, 0x0b, 0x11, 0x0c, 0xff, 0x0a, 0x0e, 0x0a, 0xff, 0x08, 0x09, 0x09, 0xff, 0x04, 0x06, 0x06, 0xff, 0x05, 0x06, 0x04, 0xff, 0x07, 0x04, 0x05, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x02, 0x02, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x01, 0x01, 0xff, 0x02, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x03, 0x02, 0x02, 0xff, 0x0b, 0x08, 0x09, 0xff, 0x05, 0x1a, 0x19, 0xff, 0x02, 0x1f, 0x2d, 0xff, 0x0d, 0x14, 0x37, 0xff, 0x00, 0x08, 0x21, 0xff, 0x17, 0x38, 0x66, 0xff, 0x2f, 0x48, 0x97, 0xff, 0x01, 0x00, 0x1f, 0xff, 0x1c, 0x2c, 0x47, 0xff, 0x48, 0x6a, 0x98, 0xff, 0x54, 0x7d, 0xac, 0xff, 0x4e, 0x80, 0xb2, 0xff, 0x49, 0x81, 0xb6, 0xff, 0x59, 0x8d, 0xc5, 0xff, 0x58, 0x87, 0xc0, 0xff, 0x55, 0x7e, 0xb9, 0xff, 0x39, 0x5a, 0xa7, 0xff, 0x38, 0x59, 0xa5, 0xff, 0x58, 0x79, 0xbb, 0xff, 0x62, 0x7f, 0xbb, 0xff, 0x6f, 0x86, 0xbf, 0xff, 0x8d, 0x9a, 0xd1, 0xff, 0xa6, 0xa9, 0xdb, 0xff, 0x9e, 0xa3, 0xd1, 0xff, 0x8b, 0xa7, 0xce, 0xff, 0xa1, 0xb9, 0xe0, 0xff, 0xa8, 0xbd, 0xe7, 0xff, 0xac, 0xc6, 0xf2, 0xff, 0xa5, 0xc7, 0xf4, 0xff, 0x86, 0xaf, 0xdc, 0xff, 0x57, 0x7f, 0xad, 0xff, 0x2b, 0x4d, 0x82, 0xff, 0x43, 0x66, 0xa3, 0xff, 0x86, 0xab, 0xdf, 0xff, 0x9a, 0xc1, 0xe9, 0xff, 0x9e, 0xc7, 0xe7, 0xff, 0xa1, 0xc7, 0xe8, 0xff, 0x95, 0xb8, 0xe2, 0xff, 0x80, 0x9f, 0xd3, 0xff, 0x7d, 0x9c, 0xd0, 0xff, 0x7a, 0x9b, 0xc0, 0xff, 0x8f, 0xac, 0xc6, 0xff, 0xb4, 0xca, 0xe0, 0xff, 0xbe, 0xd3, 0xee, 0xff, 0xa9, 0xc0, 0xe9, 0xff, 0x86, 0xa4, 0xda, 0xff, 0x76, 0x9f, 0xdd, 0xff, 0x89, 0xa6, 0xd7, 0xff, 0xa3, 0xb6, 0xd6, 0xff, 0xa0, 0xbb, 0xdd, 0xff, 0x9b, 0xbd, 0xdb, 0xff, 0x90, 0xb6, 0xd0, 0xff, 0x93, 0xbb, 0xcf, 0xff, 0xa3, 0xc9, 0xda, 0xff, 0x98, 0xc0, 0xc6, 0xff, 0x8f, 0xb6, 0xcc, 0xff, 0x86, 0xae, 0xd2, 0xff, 0x82, 0xad, 0xd3, 0xff, 0x7b, 0xa6, 0xd2, 0xff, 0x7f, 0xaa, 0xd8, 0xff, 0x72, 0x9f, 0xcd, 0xff, 0x6b, 0x97, 0xc4, 0xff, 0x6a, 0x98, 0xc2, 0xff, 0x5e, 0x8b, 0xb7, 0xff, 0x44, 0x68, 0x91, 0xff, 0x34, 0x54, 0x74, 0xff, 0x6c, 0x88, 0xc8, 0xff, 0x74, 0xa2, 0xca, 0xff, 0x78, 0xa3, 0xd2, 0xff, 0x66, 0x86, 0x9f, 0xff, 0x57, 0x6f, 0x5f, 0xff, 0x4a, 0x66, 0x54, 0xff, 0x43, 0x62, 0x55, 0xff, 0x44, 0x62, 0x55, 0xff, 0x43, 0x61, 0x54, 0xff, 0x43, 0x61, 0x54, 0xff, 0x43, 0x61, 0x54, 0xff, 0x43, 0x61, 0x54, 0xff, 0x41, 0x5f, 0x52, 0xff, 0x41, 0x5f, 0x52, 0xff, 0x42, 0x5f, 0x52, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x43, 0x5e, 0x51, 0xff, 0x44, 0x5e, 0x51, 0xff, 0x43, 0x5e, 0x50, 0xff, 0x43, 0x5c, 0x50, 0xff, 0x42, 0x5b, 0x4f, 0xff, 0x40, 0x5c, 0x4f, 0xff, 0x3f, 0x5b, 0x4e, 0xff, 0x3f, 0x5b, 0x4e, 0xff, 0x3f, 0x5b, 0x4e, 0xff, 0x3e, 0x5a, 0x4d, 0xff, 0x3e, 0x5a, 0x4d, 0xff, 0x3e, 0x5a, 0x4d, 0xff, 0x3e, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3d, 0x58, 0x4a, 0xf3,
+    0x0c, 0x0c, 0x09, 0xf0, 0x0f, 0x13, 0x0e, 0xff, 0x13, 0x1a, 0x14, 0xff, 0x17, 0x1e, 0x16, 0xff, 0x16, 0x1d, 0x16, 0xff, 0x13, 0x1b, 0x14, 0xff, 0x11, 0x1a, 0x12, 0xff, 0x0d, 0x15, 0x0f, 0xff, 0x0a, 0x0e, 0x0a, 0xff, 0x09, 0x0d, 0x07, 0xff, 0x06, 0x08, 0x08, 0xff, 0x05, 0x06, 0x04, 0xff, 0x04, 0x04, 0x03, 0xff, 0x05, 0x02, 0x03, 0xff, 0x04, 0x02, 0x02, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x01, 0xff, 0x0a, 0x09, 0x09, 0xff, 0x07, 0x1e, 0x1c, 0xff, 0x06, 0x23, 0x38, 0xff, 0x16, 0x20, 0x43, 0xff, 0x08, 0x13, 0x20, 0xff, 0x01, 0x24, 0x45, 0xff, 0x3c, 0x56, 0xac, 0xff, 0x1f, 0x24, 0x5b, 0xff, 0x0c, 0x1b, 0x42, 0xff, 0x48, 0x63, 0x98, 0xff, 0x55, 0x7d, 0xae, 0xff, 0x4c, 0x7f, 0xae, 0xff, 0x52, 0x8d, 0xb9, 0xff, 0x5b, 0x95, 0xc0, 0xff, 0x63, 0x9b, 0xc2, 0xff, 0x5e, 0x95, 0xba, 0xff, 0x60, 0x86, 0xaf, 0xff, 0x64, 0x89, 0xb3, 0xff, 0x78, 0x9f, 0xcb, 0xff, 0x83, 0xa7, 0xd8, 0xff, 0x78, 0x98, 0xc7, 0xff, 0x83, 0x9b, 0xcf, 0xff, 0x95, 0xa6, 0xde, 0xff, 0x9c, 0xaf, 0xe6, 0xff, 0x99, 0xb3, 0xe1, 0xff, 0x9c, 0xb0, 0xd7, 0xff, 0xa2, 0xb1, 0xd6, 0xff, 0xaa, 0xbf, 0xe2, 0xff, 0xa1, 0xc3, 0xe4, 0xff, 0x81, 0xa8, 0xcb, 0xff, 0x55, 0x7a, 0xa0, 0xff, 0x3d, 0x5d, 0x90, 0xff, 0x41, 0x63, 0xa6, 0xff, 0x7a, 0x9f, 0xd6, 0xff, 0x97, 0xbe, 0xe9, 0xff, 0x9e, 0xc5, 0xe7, 0xff, 0xa6, 0xcb, 0xeb, 0xff, 0x99, 0xbc, 0xe5, 0xff, 0x86, 0xa6, 0xdb, 0xff, 0x78, 0x99, 0xd2, 0xff, 0x79, 0x9d, 0xcc, 0xff, 0x90, 0xb3, 0xd3, 0xff, 0xab, 0xc7, 0xdc, 0xff, 0xb8, 0xcb, 0xdd, 0xff, 0xba, 0xc6, 0xdf, 0xff, 0xb0, 0xbf, 0xe4, 0xff, 0xa0, 0xb7, 0xe6, 0xff, 0x9f, 0xb7, 0xdd, 0xff, 0xaa, 0xbe, 0xdb, 0xff, 0xab, 0xc3, 0xe4, 0xff, 0xa9, 0xc5, 0xe8, 0xff, 0xa3, 0xbe, 0xe3, 0xff, 0x9f, 0xb9, 0xdc, 0xff, 0xaa, 0xc4, 0xe3, 0xff, 0xad, 0xc6, 0xe1, 0xff, 0x9d, 0xbe, 0xdc, 0xff, 0x93, 0xba, 0xde, 0xff, 0x8f, 0xb5, 0xe0, 0xff, 0x7c, 0xa3, 0xd5, 0xff, 0x6f, 0x96, 0xcc, 0xff, 0x65, 0x8c, 0xc3, 0xff, 0x68, 0x92, 0xc6, 0xff, 0x66, 0x91, 0xc5, 0xff, 0x59, 0x85, 0xaa, 0xff, 0x3d, 0x5c, 0x90, 0xff, 0x36, 0x56, 0x7d, 0xff, 0x72, 0x93, 0xc6, 0xff, 0x7e, 0xa3, 0xd9, 0xff, 0x73, 0x97, 0xc2, 0xff, 0x5a, 0x7f, 0x75, 0xff, 0x5e, 0x74, 0x63, 0xff, 0x49, 0x64, 0x58, 0xff, 0x43, 0x62, 0x55, 0xff, 0x44, 0x62, 0x55, 0xff, 0x42, 0x60, 0x53, 0xff, 0x43, 0x61, 0x54, 0xff, 0x43, 0x61, 0x54, 0xff, 0x42, 0x60, 0x53, 0xff, 0x41, 0x5f, 0x52, 0xff, 0x41, 0x5f, 0x52, 0xff, 0x42, 0x5f, 0x52, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x43, 0x5e, 0x51, 0xff, 0x44, 0x5e, 0x51, 0xff, 0x43, 0x5e, 0x50, 0xff, 0x43, 0x5c, 0x50, 0xff, 0x42, 0x5b, 0x4f, 0xff, 0x40, 0x5c, 0x4f, 0xff, 0x3f, 0x5b, 0x4e, 0xff, 0x3f, 0x5b, 0x4e, 0xff, 0x3f, 0x5b, 0x4e, 0xff, 0x3e, 0x5a, 0x4d, 0xff, 0x3e, 0x5a, 0x4d, 0xff, 0x3e, 0x5a, 0x4d, 0xff, 0x3e, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3d, 0x58, 0x4b, 0xf0,
+    0x0e, 0x0f, 0x0b, 0xe7, 0x10, 0x15, 0x0f, 0xff, 0x14, 0x1b, 0x14, 0xff, 0x18, 0x1f, 0x19, 0xff, 0x18, 0x20, 0x17, 0xff, 0x14, 0x1c, 0x15, 0xff, 0x11, 0x1a, 0x12, 0xff, 0x0e, 0x15, 0x0f, 0xff, 0x08, 0x0e, 0x09, 0xff, 0x07, 0x0b, 0x06, 0xff, 0x06, 0x08, 0x06, 0xff, 0x04, 0x05, 0x03, 0xff, 0x04, 0x04, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x00, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x0a, 0x07, 0xff, 0x07, 0x19, 0x1d, 0xff, 0x0c, 0x22, 0x37, 0xff, 0x14, 0x28, 0x42, 0xff, 0x0b, 0x21, 0x32, 0xff, 0x00, 0x17, 0x34, 0xff, 0x2d, 0x43, 0x85, 0xff, 0x3e, 0x50, 0x94, 0xff, 0x14, 0x27, 0x5f, 0xff, 0x3e, 0x58, 0x8e, 0xff, 0x52, 0x78, 0xaa, 0xff, 0x51, 0x80, 0xb0, 0xff, 0x5b, 0x91, 0xbb, 0xff, 0x68, 0x9e, 0xc4, 0xff, 0x72, 0xa8, 0xc7, 0xff, 0x62, 0x96, 0xb2, 0xff, 0x66, 0x88, 0xb1, 0xff, 0x8c, 0xac, 0xd5, 0xff, 0x8f, 0xb1, 0xd7, 0xff, 0x9b, 0xbf, 0xe1, 0xff, 0x9f, 0xc3, 0xe1, 0xff, 0xa5, 0xc9, 0xe7, 0xff, 0xa4, 0xc7, 0xe5, 0xff, 0xa0, 0xc3, 0xe2, 0xff, 0xa7, 0xbf, 0xe7, 0xff, 0xb3, 0xc4, 0xe7, 0xff, 0xb8, 0xc7, 0xe5, 0xff, 0xb4, 0xc9, 0xe3, 0xff, 0xa2, 0xc1, 0xdc, 0xff, 0x73, 0x9a, 0xbe, 0xff, 0x5a, 0x84, 0xaf, 0xff, 0x42, 0x68, 0x9f, 0xff, 0x38, 0x5e, 0xa5, 0xff, 0x74, 0x99, 0xd7, 0xff, 0x98, 0xbb, 0xea, 0xff, 0xa6, 0xc7, 0xea, 0xff, 0xab, 0xca, 0xed, 0xff, 0xa2, 0xc0, 0xeb, 0xff, 0x86, 0xa6, 0xde, 0xff, 0x75, 0x98, 0xd5, 0xff, 0x6f, 0x99, 0xce, 0xff, 0x77, 0xa5, 0xd2, 0xff, 0x9b, 0xbf, 0xdc, 0xff, 0xb3, 0xca, 0xde, 0xff, 0xbe, 0xcb, 0xe1, 0xff, 0xc0, 0xc6, 0xe0, 0xff, 0xb4, 0xc3, 0xe4, 0xff, 0xb0, 0xc8, 0xe7, 0xff, 0xba, 0xcf, 0xeb, 0xff, 0xb7, 0xca, 0xe9, 0xff, 0xb9, 0xcb, 0xed, 0xff, 0xba, 0xcc, 0xee, 0xff, 0xb8, 0xca, 0xec, 0xff, 0xb5, 0xc9, 0xec, 0xff, 0xad, 0xc1, 0xe6, 0xff, 0xa3, 0xc1, 0xe4, 0xff, 0x99, 0xbd, 0xe4, 0xff, 0x8f, 0xb2, 0xe2, 0xff, 0x84, 0xa7, 0xde, 0xff, 0x78, 0x9c, 0xd8, 0xff, 0x70, 0x96, 0xd1, 0xff, 0x62, 0x8a, 0xc1, 0xff, 0x59, 0x80, 0xb7, 0xff, 0x59, 0x81, 0xa7, 0xff, 0x3e, 0x5e, 0x90, 0xff, 0x27, 0x4a, 0x71, 0xff, 0x70, 0x91, 0xbb, 0xff, 0x89, 0xa4, 0xe0, 0xff, 0x6d, 0x8b, 0xac, 0xff, 0x5b, 0x81, 0x63, 0xff, 0x5b, 0x75, 0x5f, 0xff, 0x48, 0x64, 0x59, 0xff, 0x42, 0x61, 0x54, 0xff, 0x44, 0x62, 0x55, 0xff, 0x42, 0x61, 0x54, 0xff, 0x44, 0x62, 0x55, 0xff, 0x43, 0x61, 0x54, 0xff, 0x42, 0x60, 0x53, 0xff, 0x41, 0x5f, 0x52, 0xff, 0x40, 0x5f, 0x52, 0xff, 0x42, 0x5f, 0x52, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x43, 0x5e, 0x51, 0xff, 0x44, 0x5e, 0x51, 0xff, 0x43, 0x5e, 0x50, 0xff, 0x43, 0x5c, 0x50, 0xff, 0x42, 0x5b, 0x4f, 0xff, 0x40, 0x5c, 0x4f, 0xff, 0x40, 0x5c, 0x4f, 0xff, 0x3f, 0x5b, 0x4e, 0xff, 0x3f, 0x5b, 0x4e, 0xff, 0x3e, 0x5a, 0x4d, 0xff, 0x3e, 0x5a, 0x4d, 0xff, 0x3e, 0x5a, 0x4d, 0xff, 0x3e, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x57, 0x4b, 0xe6,
+    0x0e, 0x0e, 0x0a, 0xd3, 0x10, 0x15, 0x0f, 0xff, 0x14, 0x1b, 0x14, 0xff, 0x18, 0x1f, 0x19, 0xff, 0x19, 0x20, 0x18, 0xff, 0x13, 0x1c, 0x14, 0xff, 0x10, 0x17, 0x0f, 0xff, 0x0b, 0x11, 0x0c, 0xff, 0x06, 0x0d, 0x07, 0xff, 0x05, 0x09, 0x04, 0xff, 0x05, 0x06, 0x04, 0xff, 0x03, 0x04, 0x02, 0xff, 0x02, 0x02, 0x01, 0xff, 0x03, 0x00, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x00, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x00, 0x09, 0x03, 0xff, 0x07, 0x12, 0x1f, 0xff, 0x17, 0x22, 0x31, 0xff, 0x15, 0x31, 0x3d, 0xff, 0x0d, 0x2d, 0x4a, 0xff, 0x09, 0x20, 0x33, 0xff, 0x1d, 0x2e, 0x50, 0xff, 0x3c, 0x53, 0xa5, 0xff, 0x23, 0x3e, 0x80, 0xff, 0x33, 0x51, 0x7e, 0xff, 0x4f, 0x73, 0xa7, 0xff, 0x57, 0x7f, 0xb4, 0xff, 0x64, 0x8e, 0xc1, 0xff, 0x79, 0xa3, 0xd3, 0xff, 0x83, 0xaa, 0xd4, 0xff, 0x7f, 0xa6, 0xcc, 0xff, 0x7d, 0xa4, 0xd4, 0xff, 0x92, 0xb6, 0xe4, 0xff, 0xa4, 0xc0, 0xe5, 0xff, 0xac, 0xc4, 0xe2, 0xff, 0xb0, 0xc9, 0xe4, 0xff, 0xaf, 0xcb, 0xe6, 0xff, 0xa9, 0xc9, 0xe4, 0xff, 0xa5, 0xc6, 0xe3, 0xff, 0xac, 0xc5, 0xeb, 0xff, 0xb9, 0xca, 0xeb, 0xff, 0xba, 0xc9, 0xe3, 0xff, 0xbe, 0xd2, 0xe9, 0xff, 0x9f, 0xbf, 0xda, 0xff, 0x63, 0x8e, 0xb9, 0xff, 0x4e, 0x80, 0xbd, 0xff, 0x30, 0x62, 0xa8, 0xff, 0x35, 0x62, 0xab, 0xff, 0x63, 0x89, 0xca, 0xff, 0x90, 0xac, 0xde, 0xff, 0xaf, 0xc5, 0xee, 0xff, 0xb1, 0xcb, 0xf3, 0xff, 0xa0, 0xbd, 0xea, 0xff, 0x82, 0xa5, 0xdd, 0xff, 0x78, 0x9d, 0xd9, 0xff, 0x6e, 0x97, 0xcd, 0xff, 0x66, 0x98, 0xcb, 0xff, 0x88, 0xb9, 0xdf, 0xff, 0xa1, 0xc4, 0xe0, 0xff, 0xbc, 0xcf, 0xe8, 0xff, 0xba, 0xc5, 0xe3, 0xff, 0xad, 0xbd, 0xe1, 0xff, 0xa8, 0xc2, 0xe4, 0xff, 0xb4, 0xce, 0xea, 0xff, 0xbf, 0xd0, 0xec, 0xff, 0xc9, 0xd2, 0xec, 0xff, 0xc5, 0xcf, 0xe3, 0xff, 0xc3, 0xd3, 0xe7, 0xff, 0xb6, 0xce, 0xe7, 0xff, 0xa0, 0xbf, 0xdb, 0xff, 0x98, 0xba, 0xd8, 0xff, 0x9a, 0xbb, 0xdf, 0xff, 0x94, 0xb8, 0xe6, 0xff, 0x86, 0xad, 0xe3, 0xff, 0x6e, 0x94, 0xd0, 0xff, 0x78, 0xa0, 0xd8, 0xff, 0x73, 0x9c, 0xce, 0xff, 0x5d, 0x88, 0xb7, 0xff, 0x51, 0x7d, 0xab, 0xff, 0x2f, 0x5b, 0x79, 0xff, 0x1f, 0x42, 0x65, 0xff, 0x87, 0x9e, 0xd0, 0xff, 0x9f, 0xb1, 0xea, 0xff, 0x6b, 0x88, 0x91, 0xff, 0x62, 0x80, 0x6a, 0xff, 0x5d, 0x76, 0x60, 0xff, 0x47, 0x63, 0x55, 0xff, 0x42, 0x5f, 0x53, 0xff, 0x45, 0x62, 0x55, 0xff, 0x45, 0x62, 0x55, 0xff, 0x45, 0x62, 0x55, 0xff, 0x44, 0x61, 0x54, 0xff, 0x43, 0x60, 0x53, 0xff, 0x43, 0x60, 0x53, 0xff, 0x40, 0x5f, 0x52, 0xff, 0x41, 0x5e, 0x51, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x43, 0x5e, 0x51, 0xff, 0x44, 0x5e, 0x51, 0xff, 0x43, 0x5d, 0x50, 0xff, 0x43, 0x5d, 0x50, 0xff, 0x42, 0x5b, 0x4f, 0xff, 0x40, 0x5c, 0x4f, 0xff, 0x3f, 0x5b, 0x4e, 0xff, 0x3f, 0x5b, 0x4e, 0xff, 0x3f, 0x5b, 0x4e, 0xff, 0x3e, 0x5a, 0x4d, 0xff, 0x3e, 0x5a, 0x4d, 0xff, 0x3d, 0x5a, 0x4d, 0xff, 0x3e, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x59, 0x4c, 0xd3,
+    0x0d, 0x0e, 0x0c, 0xbe, 0x11, 0x15, 0x10, 0xff, 0x14, 0x1c, 0x14, 0xff, 0x17, 0x1e, 0x18, 0xff, 0x17, 0x1f, 0x17, 0xff, 0x13, 0x1a, 0x12, 0xff, 0x0d, 0x14, 0x0d, 0xff, 0x08, 0x0e, 0x09, 0xff, 0x05, 0x0a, 0x05, 0xff, 0x03, 0x07, 0x02, 0xff, 0x03, 0x04, 0x03, 0xff, 0x03, 0x04, 0x02, 0xff, 0x02, 0x02, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x00, 0x05, 0x00, 0xff, 0x09, 0x0e, 0x18, 0xff, 0x1a, 0x25, 0x2f, 0xff, 0x18, 0x39, 0x43, 0xff, 0x1a, 0x38, 0x5c, 0xff, 0x1b, 0x30, 0x46, 0xff, 0x12, 0x2b, 0x39, 0xff, 0x20, 0x3b, 0x88, 0xff, 0x22, 0x3c, 0x83, 0xff, 0x30, 0x4b, 0x7a, 0xff, 0x4e, 0x70, 0xa3, 0xff, 0x58, 0x7f, 0xb1, 0xff, 0x6b, 0x93, 0xc6, 0xff, 0x7d, 0xa3, 0xd8, 0xff, 0x81, 0xa2, 0xd9, 0xff, 0x88, 0xa7, 0xdf, 0xff, 0x8b, 0xb8, 0xe1, 0xff, 0x8f, 0xbb, 0xdb, 0xff, 0xa6, 0xc8, 0xe0, 0xff, 0xae, 0xca, 0xdd, 0xff, 0xb9, 0xcf, 0xe2, 0xff, 0xb7, 0xcc, 0xe6, 0xff, 0xb3, 0xc7, 0xea, 0xff, 0xb1, 0xc6, 0xed, 0xff, 0xaa, 0xc7, 0xe7, 0xff, 0xa8, 0xbe, 0xdc, 0xff, 0xb5, 0xc6, 0xe3, 0xff, 0xbf, 0xd5, 0xf3, 0xff, 0x93, 0xb7, 0xdb, 0xff, 0x60, 0x8d, 0xc1, 0xff, 0x45, 0x76, 0xbc, 0xff, 0x2f, 0x5f, 0xae, 0xff, 0x31, 0x60, 0xaa, 0xff, 0x5c, 0x83, 0xc3, 0xff, 0x9b, 0xb4, 0xe6, 0xff, 0xbe, 0xcf, 0xf5, 0xff, 0xbf, 0xd3, 0xf6, 0xff, 0xa5, 0xbf, 0xea, 0xff, 0x84, 0xa6, 0xdf, 0xff, 0x69, 0x8d, 0xcc, 0xff, 0x76, 0x9d, 0xd6, 0xff, 0x6e, 0x9c, 0xd7, 0xff, 0x6f, 0xa3, 0xd9, 0xff, 0x88, 0xb1, 0xda, 0xff, 0xad, 0xc4, 0xe4, 0xff, 0xb8, 0xce, 0xf1, 0xff, 0xa3, 0xbe, 0xe3, 0xff, 0x9d, 0xb8, 0xe4, 0xff, 0x9c, 0xb3, 0xdf, 0xff, 0xa7, 0xba, 0xdb, 0xff, 0xb4, 0xc4, 0xdc, 0xff, 0xb7, 0xc6, 0xde, 0xff, 0xb5, 0xc6, 0xe2, 0xff, 0xaf, 0xc8, 0xe7, 0xff, 0xa8, 0xc9, 0xeb, 0xff, 0xa4, 0xc4, 0xe5, 0xff, 0xa2, 0xc0, 0xe2, 0xff, 0xa0, 0xc1, 0xeb, 0xff, 0x94, 0xb5, 0xe6, 0xff, 0x80, 0xa4, 0xd8, 0xff, 0x82, 0xa8, 0xda, 0xff, 0x76, 0x9e, 0xcb, 0xff, 0x5f, 0x8a, 0xb5, 0xff, 0x4a, 0x70, 0xa9, 0xff, 0x26, 0x50, 0x6e, 0xff, 0x30, 0x4c, 0x73, 0xff, 0x73, 0x82, 0xb6, 0xff, 0x8a, 0x96, 0xc0, 0xff, 0x76, 0x8f, 0x86, 0xff, 0x68, 0x81, 0x73, 0xff, 0x5a, 0x72, 0x66, 0xff, 0x47, 0x63, 0x54, 0xff, 0x43, 0x5f, 0x53, 0xff, 0x46, 0x62, 0x55, 0xff, 0x47, 0x62, 0x55, 0xff, 0x45, 0x61, 0x54, 0xff, 0x45, 0x61, 0x54, 0xff, 0x44, 0x60, 0x53, 0xff, 0x45, 0x60, 0x53, 0xff, 0x41, 0x60, 0x53, 0xff, 0x41, 0x5e, 0x51, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x44, 0x5e, 0x51, 0xff, 0x43, 0x5d, 0x50, 0xff, 0x43, 0x5d, 0x50, 0xff, 0x44, 0x5c, 0x50, 0xff, 0x41, 0x5c, 0x4f, 0xff, 0x40, 0x5b, 0x4e, 0xff, 0x40, 0x5b, 0x4e, 0xff, 0x3f, 0x5a, 0x4d, 0xff, 0x3f, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3f, 0x58, 0x4c, 0xbe,
+    0x0a, 0x0f, 0x0a, 0xaa, 0x11, 0x14, 0x0f, 0xff, 0x14, 0x1a, 0x13, 0xff, 0x15, 0x1d, 0x16, 0xff, 0x15, 0x1c, 0x14, 0xff, 0x12, 0x19, 0x11, 0xff, 0x0b, 0x13, 0x0c, 0xff, 0x08, 0x0d, 0x08, 0xff, 0x05, 0x09, 0x03, 0xff, 0x01, 0x05, 0x01, 0xff, 0x02, 0x04, 0x01, 0xff, 0x01, 0x02, 0x00, 0xff, 0x01, 0x01, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x0d, 0x0a, 0xff, 0x13, 0x23, 0x2c, 0xff, 0x1a, 0x38, 0x4a, 0xff, 0x20, 0x45, 0x5b, 0xff, 0x1d, 0x40, 0x5f, 0xff, 0x17, 0x34, 0x51, 0xff, 0x1f, 0x39, 0x51, 0xff, 0x33, 0x46, 0x7c, 0xff, 0x38, 0x4e, 0x8c, 0xff, 0x4d, 0x6f, 0xa1, 0xff, 0x56, 0x80, 0xac, 0xff, 0x6c, 0x9b, 0xc6, 0xff, 0x72, 0x9c, 0xcd, 0xff, 0x74, 0x98, 0xd2, 0xff, 0x8c, 0xab, 0xec, 0xff, 0x80, 0xa7, 0xdb, 0xff, 0x7a, 0xa1, 0xcd, 0xff, 0x9c, 0xbf, 0xe6, 0xff, 0xa2, 0xc3, 0xe4, 0xff, 0xa8, 0xc5, 0xe3, 0xff, 0xaa, 0xc5, 0xe4, 0xff, 0xa5, 0xc1, 0xe0, 0xff, 0xa2, 0xbc, 0xdc, 0xff, 0xb1, 0xc2, 0xe0, 0xff, 0xb3, 0xc5, 0xe4, 0xff, 0xad, 0xcc, 0xed, 0xff, 0x88, 0xb0, 0xd6, 0xff, 0x7c, 0xa5, 0xd3, 0xff, 0x6a, 0x95, 0xcf, 0xff, 0x49, 0x71, 0xb7, 0xff, 0x41, 0x66, 0xb2, 0xff, 0x36, 0x63, 0xab, 0xff, 0x6d, 0x94, 0xd1, 0xff, 0xa0, 0xbd, 0xeb, 0xff, 0xbe, 0xd0, 0xee, 0xff, 0xcc, 0xda, 0xf5, 0xff, 0xb0, 0xc3, 0xeb, 0xff, 0x78, 0x96, 0xd1, 0xff, 0x6c, 0x8f, 0xcf, 0xff, 0x78, 0x9c, 0xd7, 0xff, 0x70, 0x98, 0xd7, 0xff, 0x69, 0x94, 0xd2, 0xff, 0x75, 0x9f, 0xd9, 0xff, 0x90, 0xb4, 0xe7, 0xff, 0xad, 0xca, 0xf1, 0xff, 0xba, 0xd0, 0xed, 0xff, 0xaf, 0xc7, 0xe3, 0xff, 0x9b, 0xb8, 0xd8, 0xff, 0x98, 0xb3, 0xd4, 0xff, 0xa1, 0xbd, 0xdd, 0xff, 0xa9, 0xc4, 0xe5, 0xff, 0xab, 0xc5, 0xe7, 0xff, 0xae, 0xc9, 0xec, 0xff, 0xb0, 0xcb, 0xee, 0xff, 0xa9, 0xc5, 0xeb, 0xff, 0xa4, 0xc0, 0xe9, 0xff, 0xa1, 0xbd, 0xe7, 0xff, 0x9f, 0xb9, 0xe5, 0xff, 0x9a, 0xb9, 0xe5, 0xff, 0x84, 0xa7, 0xd3, 0xff, 0x78, 0x9e, 0xc9, 0xff, 0x58, 0x82, 0xad, 0xff, 0x40, 0x5f, 0x9b, 0xff, 0x27, 0x43, 0x72, 0xff, 0x46, 0x5b, 0x87, 0xff, 0x6f, 0x7d, 0xaa, 0xff, 0x7a, 0x8a, 0x99, 0xff, 0x7c, 0x99, 0x7f, 0xff, 0x6a, 0x88, 0x6e, 0xff, 0x58, 0x72, 0x65, 0xff, 0x4b, 0x67, 0x59, 0xff, 0x47, 0x63, 0x57, 0xff, 0x47, 0x63, 0x56, 0xff, 0x46, 0x62, 0x55, 0xff, 0x45, 0x61, 0x54, 0xff, 0x45, 0x61, 0x54, 0xff, 0x44, 0x60, 0x53, 0xff, 0x44, 0x60, 0x53, 0xff, 0x42, 0x60, 0x53, 0xff, 0x41, 0x5e, 0x51, 0xff, 0x42, 0x5e, 0x51, 0xff, 0x42, 0x5e, 0x51, 0xff, 0x43, 0x5d, 0x50, 0xff, 0x43, 0x5d, 0x50, 0xff, 0x43, 0x5d, 0x50, 0xff, 0x44, 0x5c, 0x50, 0xff, 0x42, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x57, 0x4a, 0xab,
+    0x09, 0x0e, 0x09, 0x8b, 0x0d, 0x11, 0x0b, 0xff, 0x12, 0x16, 0x10, 0xff, 0x14, 0x19, 0x13, 0xff, 0x12, 0x19, 0x13, 0xff, 0x0f, 0x17, 0x0f, 0xff, 0x0a, 0x11, 0x0a, 0xff, 0x08, 0x0c, 0x06, 0xff, 0x04, 0x07, 0x02, 0xff, 0x00, 0x05, 0x00, 0xff, 0x01, 0x03, 0x01, 0xff, 0x01, 0x02, 0x00, 0xff, 0x01, 0x01, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x00, 0x01, 0xff, 0x00, 0x02, 0x00, 0xff, 0x03, 0x0c, 0x08, 0xff, 0x0e, 0x20, 0x28, 0xff, 0x1e, 0x3c, 0x4d, 0xff, 0x27, 0x4d, 0x62, 0xff, 0x32, 0x59, 0x70, 0xff, 0x36, 0x54, 0x6b, 0xff, 0x33, 0x4b, 0x5a, 0xff, 0x3d, 0x50, 0x83, 0xff, 0x33, 0x49, 0x8d, 0xff, 0x43, 0x62, 0x9b, 0xff, 0x4e, 0x75, 0xab, 0xff, 0x65, 0x93, 0xc2, 0xff, 0x71, 0x9d, 0xcb, 0xff, 0x77, 0xa0, 0xcd, 0xff, 0x94, 0xb8, 0xe6, 0xff, 0x7b, 0xa3, 0xd4, 0xff, 0x81, 0xa7, 0xd5, 0xff, 0x99, 0xba, 0xe4, 0xff, 0x9d, 0xbb, 0xe1, 0xff, 0xa3, 0xbf, 0xe2, 0xff, 0xa5, 0xc1, 0xe0, 0xff, 0x9c, 0xbb, 0xd8, 0xff, 0x95, 0xb0, 0xd1, 0xff, 0xa9, 0xba, 0xda, 0xff, 0xbe, 0xd3, 0xf3, 0xff, 0xa5, 0xc6, 0xe9, 0xff, 0x7f, 0xaa, 0xd1, 0xff, 0x7b, 0xa8, 0xd7, 0xff, 0x5f, 0x8a, 0xc3, 0xff, 0x49, 0x6f, 0xb2, 0xff, 0x42, 0x66, 0xae, 0xff, 0x37, 0x62, 0xa9, 0xff, 0x67, 0x8f, 0xcc, 0xff, 0x9a, 0xb9, 0xe4, 0xff, 0xbd, 0xd2, 0xed, 0xff, 0xcf, 0xdd, 0xf2, 0xff, 0xb4, 0xc7, 0xe8, 0xff, 0x8e, 0xab, 0xe2, 0xff, 0x7a, 0xa0, 0xde, 0xff, 0x79, 0x9f, 0xd6, 0xff, 0x77, 0x9e, 0xd7, 0xff, 0x6b, 0x94, 0xd0, 0xff, 0x6d, 0x97, 0xd3, 0xff, 0x79, 0xa2, 0xd6, 0xff, 0x91, 0xb3, 0xdd, 0xff, 0xae, 0xc5, 0xe4, 0xff, 0xb5, 0xcd, 0xeb, 0xff, 0xb3, 0xcf, 0xf1, 0xff, 0x9f, 0xbb, 0xde, 0xff, 0x93, 0xaf, 0xd6, 0xff, 0xa7, 0xc3, 0xe6, 0xff, 0xaa, 0xc6, 0xe6, 0xff, 0xb2, 0xce, 0xef, 0xff, 0xad, 0xc9, 0xe9, 0xff, 0xa3, 0xbf, 0xe8, 0xff, 0x97, 0xb4, 0xe3, 0xff, 0x95, 0xb2, 0xdf, 0xff, 0x96, 0xb4, 0xe0, 0xff, 0x93, 0xb3, 0xdf, 0xff, 0x83, 0xa8, 0xd3, 0xff, 0x71, 0x99, 0xc5, 0xff, 0x54, 0x7f, 0xad, 0xff, 0x3e, 0x5f, 0x91, 0xff, 0x1f, 0x3a, 0x61, 0xff, 0x47, 0x5c, 0x7b, 0xff, 0x83, 0x95, 0xaa, 0xff, 0x87, 0x9c, 0x98, 0xff, 0x7c, 0x9d, 0x76, 0xff, 0x6a, 0x8b, 0x62, 0xff, 0x5c, 0x74, 0x63, 0xff, 0x54, 0x6f, 0x64, 0xff, 0x50, 0x6c, 0x5f, 0xff, 0x47, 0x63, 0x56, 0xff, 0x46, 0x62, 0x55, 0xff, 0x45, 0x61, 0x54, 0xff, 0x45, 0x61, 0x54, 0xff, 0x45, 0x61, 0x54, 0xff, 0x44, 0x60, 0x53, 0xff, 0x41, 0x5f, 0x52, 0xff, 0x41, 0x5e, 0x51, 0xff, 0x42, 0x5e, 0x51, 0xff, 0x42, 0x5d, 0x50, 0xff, 0x43, 0x5d, 0x50, 0xff, 0x43, 0x5d, 0x50, 0xff, 0x44, 0x5d, 0x50, 0xff, 0x44, 0x5c, 0x50, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0x8b,
+    0x09, 0x0b, 0x07, 0x6b, 0x0d, 0x10, 0x09, 0xff, 0x11, 0x15, 0x0e, 0xff, 0x13, 0x17, 0x11, 0xff, 0x11, 0x16, 0x0f, 0xff, 0x0b, 0x13, 0x0b, 0xff, 0x08, 0x0d, 0x07, 0xff, 0x06, 0x0a, 0x05, 0xff, 0x02, 0x06, 0x01, 0xff, 0x01, 0x03, 0x02, 0xff, 0x01, 0x02, 0x00, 0xff, 0x01, 0x02, 0x00, 0xff, 0x01, 0x01, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x00, 0x01, 0x00, 0xff, 0x02, 0x09, 0x09, 0xff, 0x0f, 0x1e, 0x27, 0xff, 0x20, 0x3d, 0x4b, 0xff, 0x34, 0x58, 0x6a, 0xff, 0x4c, 0x70, 0x81, 0xff, 0x52, 0x72, 0x81, 0xff, 0x4f, 0x68, 0x73, 0xff, 0x45, 0x57, 0x85, 0xff, 0x2c, 0x42, 0x82, 0xff, 0x3a, 0x59, 0x93, 0xff, 0x4c, 0x72, 0xad, 0xff, 0x60, 0x88, 0xc1, 0xff, 0x72, 0x9a, 0xcd, 0xff, 0x84, 0xae, 0xd5, 0xff, 0x92, 0xbc, 0xd9, 0xff, 0x91, 0xb8, 0xe7, 0xff, 0x92, 0xb6, 0xe8, 0xff, 0x90, 0xb2, 0xdd, 0xff, 0x9f, 0xbf, 0xe8, 0xff, 0xa6, 0xc3, 0xe8, 0xff, 0xa5, 0xc3, 0xe4, 0xff, 0xa3, 0xc1, 0xe1, 0xff, 0xaf, 0xcb, 0xee, 0xff, 0xae, 0xc8, 0xea, 0xff, 0xa7, 0xc4, 0xe5, 0xff, 0xa0, 0xc5, 0xea, 0xff, 0x88, 0xb4, 0xde, 0xff, 0x6f, 0x9b, 0xcd, 0xff, 0x58, 0x83, 0xbd, 0xff, 0x4c, 0x71, 0xb5, 0xff, 0x44, 0x68, 0xb0, 0xff, 0x3a, 0x63, 0xad, 0xff, 0x68, 0x8d, 0xce, 0xff, 0xa0, 0xbe, 0xea, 0xff, 0xc0, 0xd4, 0xed, 0xff, 0xce, 0xdd, 0xf0, 0xff, 0xb7, 0xcb, 0xea, 0xff, 0x9d, 0xbd, 0xee, 0xff, 0x7b, 0xa3, 0xdd, 0xff, 0x7e, 0xa5, 0xda, 0xff, 0x7d, 0xa5, 0xdb, 0xff, 0x6e, 0x98, 0xd2, 0xff, 0x62, 0x8e, 0xc6, 0xff, 0x74, 0x9f, 0xd2, 0xff, 0x85, 0xab, 0xd6, 0xff, 0x9c, 0xbc, 0xde, 0xff, 0xa8, 0xc5, 0xe5, 0xff, 0xae, 0xc8, 0xea, 0xff, 0xa9, 0xc5, 0xe8, 0xff, 0xa3, 0xbf, 0xe2, 0xff, 0xa6, 0xc1, 0xe5, 0xff, 0xa0, 0xbc, 0xdf, 0xff, 0xa4, 0xc0, 0xe4, 0xff, 0xa9, 0xc7, 0xea, 0xff, 0xa5, 0xc3, 0xed, 0xff, 0x9e, 0xbd, 0xed, 0xff, 0x91, 0xb1, 0xe0, 0xff, 0x85, 0xa7, 0xd5, 0xff, 0x8c, 0xaf, 0xde, 0xff, 0x7e, 0xa2, 0xd2, 0xff, 0x65, 0x8b, 0xbb, 0xff, 0x54, 0x7d, 0xb0, 0xff, 0x3d, 0x5d, 0x86, 0xff, 0x22, 0x40, 0x50, 0xff, 0x5b, 0x76, 0x78, 0xff, 0x8e, 0xa4, 0xa1, 0xff, 0x8a, 0xa4, 0x8f, 0xff, 0x7c, 0x9e, 0x6f, 0xff, 0x6a, 0x8a, 0x61, 0xff, 0x5a, 0x71, 0x62, 0xff, 0x52, 0x6c, 0x62, 0xff, 0x4e, 0x6b, 0x5e, 0xff, 0x46, 0x62, 0x55, 0xff, 0x44, 0x60, 0x53, 0xff, 0x45, 0x61, 0x54, 0xff, 0x45, 0x61, 0x54, 0xff, 0x45, 0x61, 0x54, 0xff, 0x44, 0x60, 0x53, 0xff, 0x41, 0x5f, 0x52, 0xff, 0x42, 0x5f, 0x52, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x42, 0x5d, 0x50, 0xff, 0x44, 0x5e, 0x51, 0xff, 0x43, 0x5d, 0x50, 0xff, 0x44, 0x5d, 0x50, 0xff, 0x43, 0x5c, 0x50, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3e, 0x58, 0x4b, 0xff, 0x3d, 0x58, 0x49, 0x6b,
+    0x06, 0x0a, 0x03, 0x4b, 0x0c, 0x0e, 0x09, 0xff, 0x0f, 0x11, 0x0c, 0xff, 0x10, 0x14, 0x0f, 0xff, 0x0f, 0x13, 0x0e, 0xff, 0x0b, 0x10, 0x0a, 0xff, 0x07, 0x0b, 0x06, 0xff, 0x04, 0x08, 0x03, 0xff, 0x02, 0x04, 0x01, 0xff, 0x03, 0x03, 0x02, 0xff, 0x01, 0x02, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x01, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x03, 0x06, 0x0b, 0xff, 0x0f, 0x1e, 0x27, 0xff, 0x1f, 0x3a, 0x47, 0xff, 0x3c, 0x5f, 0x6d, 0xff, 0x5e, 0x82, 0x8d, 0xff, 0x6c, 0x8d, 0x93, 0xff, 0x6d, 0x86, 0x86, 0xff, 0x64, 0x79, 0x8f, 0xff, 0x2e, 0x48, 0x71, 0xff, 0x2c, 0x4a, 0x7d, 0xff, 0x4d, 0x6f, 0xaa, 0xff, 0x5d, 0x81, 0xc0, 0xff, 0x75, 0x9a, 0xd3, 0xff, 0x85, 0xad, 0xd8, 0xff, 0x8e, 0xb7, 0xd8, 0xff, 0x96, 0xb9, 0xec, 0xff, 0x98, 0xba, 0xee, 0xff, 0x92, 0xb5, 0xe4, 0xff, 0x95, 0xb8, 0xe4, 0xff, 0xa0, 0xc0, 0xeb, 0xff, 0xa7, 0xc6, 0xed, 0xff, 0xa2, 0xc0, 0xe4, 0xff, 0xa8, 0xc6, 0xea, 0xff, 0xaf, 0xcd, 0xf0, 0xff, 0x99, 0xb9, 0xdd, 0xff, 0x9a, 0xc1, 0xea, 0xff, 0x77, 0xa4, 0xd3, 0xff, 0x58, 0x84, 0xb9, 0xff, 0x5e, 0x88, 0xc5, 0xff, 0x46, 0x6b, 0xad, 0xff, 0x43, 0x66, 0xac, 0xff, 0x49, 0x6f, 0xbc, 0xff, 0x71, 0x95, 0xd5, 0xff, 0xa4, 0xbf, 0xeb, 0xff, 0xb9, 0xcc, 0xe5, 0xff, 0xc9, 0xd7, 0xeb, 0xff, 0xb5, 0xc9, 0xe5, 0xff, 0x8c, 0xad, 0xda, 0xff, 0x79, 0xa1, 0xd9, 0xff, 0x80, 0xa6, 0xdb, 0xff, 0x7b, 0xa3, 0xd8, 0xff, 0x73, 0x9c, 0xd2, 0xff, 0x69, 0x95, 0xcc, 0xff, 0x71, 0x9d, 0xcf, 0xff, 0x90, 0xb8, 0xe5, 0xff, 0xa1, 0xc5, 0xec, 0xff, 0xa3, 0xc1, 0xe5, 0xff, 0xa5, 0xbe, 0xe1, 0xff, 0xaa, 0xc5, 0xe9, 0xff, 0xab, 0xc7, 0xe9, 0xff, 0xa8, 0xc4, 0xe9, 0xff, 0xa3, 0xc1, 0xe7, 0xff, 0x9c, 0xbb, 0xe1, 0xff, 0xa3, 0xc2, 0xe8, 0xff, 0x99, 0xb8, 0xe6, 0xff, 0x90, 0xaf, 0xe3, 0xff, 0x8e, 0xb1, 0xe2, 0xff, 0x86, 0xad, 0xdd, 0xff, 0x81, 0xa9, 0xd9, 0xff, 0x7e, 0xa4, 0xd5, 0xff, 0x64, 0x8a, 0xbb, 0xff, 0x47, 0x6d, 0xa2, 0xff, 0x39, 0x51, 0x7b, 0xff, 0x27, 0x42, 0x47, 0xff, 0x74, 0x92, 0x7f, 0xff, 0x94, 0xae, 0x99, 0xff, 0x8d, 0xa5, 0x87, 0xff, 0x81, 0xa0, 0x6e, 0xff, 0x6e, 0x8a, 0x66, 0xff, 0x59, 0x6f, 0x64, 0xff, 0x48, 0x63, 0x58, 0xff, 0x43, 0x60, 0x53, 0xff, 0x45, 0x61, 0x54, 0xff, 0x44, 0x61, 0x54, 0xff, 0x45, 0x61, 0x54, 0xff, 0x45, 0x61, 0x54, 0xff, 0x45, 0x61, 0x54, 0xff, 0x44, 0x60, 0x53, 0xff, 0x42, 0x60, 0x53, 0xff, 0x45, 0x62, 0x55, 0xff, 0x45, 0x61, 0x54, 0xff, 0x43, 0x5f, 0x52, 0xff, 0x44, 0x5e, 0x51, 0xff, 0x44, 0x5e, 0x51, 0xff, 0x43, 0x5d, 0x50, 0xff, 0x43, 0x5b, 0x4f, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x57, 0x4b, 0xff, 0x3f, 0x57, 0x4b, 0xff, 0x3f, 0x57, 0x4b, 0xff, 0x3f, 0x57, 0x4b, 0xff, 0x40, 0x58, 0x4a, 0x4b,
+    0x07, 0x07, 0x07, 0x21, 0x0a, 0x0b, 0x06, 0xff, 0x0c, 0x0d, 0x09, 0xff, 0x0d, 0x10, 0x0b, 0xff, 0x0c, 0x10, 0x0a, 0xff, 0x0a, 0x0d, 0x09, 0xff, 0x06, 0x0a, 0x06, 0xff, 0x05, 0x07, 0x03, 0xff, 0x04, 0x04, 0x03, 0xff, 0x02, 0x03, 0x01, 0xff, 0x02, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x03, 0x03, 0x09, 0xff, 0x0b, 0x17, 0x20, 0xff, 0x1e, 0x39, 0x45, 0xff, 0x42, 0x65, 0x6f, 0xff, 0x69, 0x8c, 0x92, 0xff, 0x7f, 0x9f, 0xa0, 0xff, 0x7f, 0x99, 0x94, 0xff, 0x7b, 0x92, 0x92, 0xff, 0x4e, 0x67, 0x74, 0xff, 0x21, 0x3e, 0x60, 0xff, 0x3f, 0x5f, 0x94, 0xff, 0x57, 0x78, 0xb9, 0xff, 0x72, 0x94, 0xd3, 0xff, 0x81, 0xa6, 0xdd, 0xff, 0x87, 0xac, 0xde, 0xff, 0x8a, 0xac, 0xe1, 0xff, 0x91, 0xb3, 0xe6, 0xff, 0x90, 0xb2, 0xe2, 0xff, 0x91, 0xb4, 0xe1, 0xff, 0x9b, 0xbb, 0xea, 0xff, 0xa0, 0xc1, 0xeb, 0xff, 0xa3, 0xc2, 0xea, 0xff, 0xa4, 0xc1, 0xe7, 0xff, 0xad, 0xcb, 0xef, 0xff, 0xab, 0xcb, 0xf1, 0xff, 0x99, 0xbe, 0xe9, 0xff, 0x7d, 0xa7, 0xd9, 0xff, 0x65, 0x8f, 0xc8, 0xff, 0x4e, 0x78, 0xb6, 0xff, 0x3a, 0x5f, 0xa0, 0xff, 0x3c, 0x5e, 0xa4, 0xff, 0x48, 0x6c, 0xba, 0xff, 0x75, 0x98, 0xda, 0xff, 0xa2, 0xbd, 0xea, 0xff, 0xbe, 0xd1, 0xec, 0xff, 0xd1, 0xe0, 0xf7, 0xff, 0xb9, 0xcd, 0xed, 0xff, 0x89, 0xaa, 0xda, 0xff, 0x7c, 0xa4, 0xdc, 0xff, 0x7f, 0xa4, 0xd8, 0xff, 0x74, 0x9a, 0xd0, 0xff, 0x73, 0x9c, 0xd3, 0xff, 0x77, 0xa0, 0xd7, 0xff, 0x78, 0xa1, 0xd4, 0xff, 0x8b, 0xb2, 0xe1, 0xff, 0x98, 0xbd, 0xe9, 0xff, 0xa4, 0xc3, 0xe9, 0xff, 0xac, 0xc4, 0xe7, 0xff, 0xa4, 0xbf, 0xe2, 0xff, 0xa9, 0xc4, 0xe8, 0xff, 0xa4, 0xc0, 0xe7, 0xff, 0x97, 0xb6, 0xdf, 0xff, 0x9c, 0xbb, 0xe5, 0xff, 0x99, 0xb9, 0xe2, 0xff, 0x95, 0xb4, 0xe4, 0xff, 0x88, 0xa7, 0xdb, 0xff, 0x88, 0xad, 0xe0, 0xff, 0x84, 0xae, 0xdf, 0xff, 0x82, 0xac, 0xdb, 0xff, 0x76, 0x9d, 0xcd, 0xff, 0x5a, 0x7e, 0xaf, 0xff, 0x48, 0x6b, 0x9e, 0xff, 0x31, 0x45, 0x71, 0xff, 0x2d, 0x43, 0x49, 0xff, 0x84, 0xa0, 0x88, 0xff, 0x96, 0xae, 0x94, 0xff, 0x8f, 0xa3, 0x8a, 0xff, 0x83, 0x9d, 0x76, 0xff, 0x6f, 0x89, 0x6b, 0xff, 0x58, 0x6d, 0x66, 0xff, 0x49, 0x63, 0x58, 0xff, 0x45, 0x61, 0x54, 0xff, 0x47, 0x62, 0x55, 0xff, 0x47, 0x62, 0x55, 0xff, 0x46, 0x62, 0x55, 0xff, 0x46, 0x62, 0x55, 0xff, 0x45, 0x62, 0x55, 0xff, 0x45, 0x61, 0x54, 0xff, 0x42, 0x60, 0x53, 0xff, 0x45, 0x62, 0x55, 0xff, 0x47, 0x62, 0x55, 0xff, 0x43, 0x5e, 0x51, 0xff, 0x44, 0x5e, 0x51, 0xff, 0x44, 0x5e, 0x51, 0xff, 0x44, 0x5d, 0x50, 0xff, 0x42, 0x5b, 0x4f, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x57, 0x4b, 0xff, 0x3f, 0x57, 0x4b, 0xff, 0x3f, 0x57, 0x4b, 0xff, 0x3e, 0x56, 0x4a, 0xff, 0x3d, 0x55, 0x45, 0x21,
+    0x00, 0x00, 0x00, 0x01, 0x09, 0x09, 0x06, 0xf2, 0x09, 0x0b, 0x06, 0xff, 0x0b, 0x0c, 0x07, 0xff, 0x0b, 0x0d, 0x07, 0xff, 0x09, 0x0a, 0x08, 0xff, 0x07, 0x08, 0x06, 0xff, 0x05, 0x06, 0x04, 0xff, 0x03, 0x03, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x00, 0x01, 0x04, 0xff, 0x06, 0x13, 0x19, 0xff, 0x1c, 0x36, 0x40, 0xff, 0x41, 0x62, 0x6c, 0xff, 0x6c, 0x8b, 0x91, 0xff, 0x85, 0x9f, 0xa0, 0xff, 0x89, 0x9f, 0x9c, 0xff, 0x84, 0x98, 0x8b, 0xff, 0x6c, 0x7d, 0x77, 0xff, 0x27, 0x3e, 0x4d, 0xff, 0x25, 0x43, 0x6c, 0xff, 0x4c, 0x6c, 0xa6, 0xff, 0x6a, 0x8d, 0xcd, 0xff, 0x74, 0x9b, 0xd8, 0xff, 0x78, 0x9d, 0xd8, 0xff, 0x87, 0xa9, 0xde, 0xff, 0x8c, 0xaf, 0xe0, 0xff, 0x8b, 0xae, 0xe0, 0xff, 0x92, 0xb4, 0xe5, 0xff, 0x91, 0xb3, 0xe4, 0xff, 0x9a, 0xbb, 0xea, 0xff, 0xa6, 0xc5, 0xf1, 0xff, 0xa9, 0xc6, 0xef, 0xff, 0xa9, 0xc6, 0xe8, 0xff, 0xa9, 0xc8, 0xed, 0xff, 0x99, 0xbd, 0xeb, 0xff, 0x77, 0x9f, 0xd5, 0xff, 0x5c, 0x82, 0xc1, 0xff, 0x3e, 0x65, 0xa8, 0xff, 0x38, 0x5a, 0xa4, 0xff, 0x40, 0x60, 0xac, 0xff, 0x42, 0x6a, 0xb6, 0xff, 0x6f, 0x92, 0xda, 0xff, 0x98, 0xb5, 0xe7, 0xff, 0xbc, 0xd1, 0xee, 0xff, 0xd2, 0xe2, 0xfb, 0xff, 0xb1, 0xc6, 0xed, 0xff, 0x8b, 0xaf, 0xea, 0xff, 0x7b, 0xa5, 0xe3, 0xff, 0x76, 0x9a, 0xd2, 0xff, 0x75, 0x9a, 0xd2, 0xff, 0x6f, 0x95, 0xce, 0xff, 0x75, 0x9c, 0xd3, 0xff, 0x82, 0xa8, 0xda, 0xff, 0x8d, 0xb1, 0xe0, 0xff, 0x94, 0xb9, 0xe7, 0xff, 0xa5, 0xc2, 0xea, 0xff, 0xb0, 0xc7, 0xea, 0xff, 0xa5, 0xc0, 0xe5, 0xff, 0xa9, 0xc3, 0xeb, 0xff, 0xa2, 0xbf, 0xe8, 0xff, 0x92, 0xb2, 0xdd, 0xff, 0x94, 0xb5, 0xe3, 0xff, 0x92, 0xb4, 0xe0, 0xff, 0x9a, 0xb9, 0xe9, 0xff, 0x96, 0xb2, 0xe7, 0xff, 0x81, 0xa6, 0xd7, 0xff, 0x73, 0x9d, 0xce, 0xff, 0x7d, 0xa6, 0xd4, 0xff, 0x6f, 0x93, 0xc4, 0xff, 0x56, 0x75, 0xa8, 0xff, 0x40, 0x5d, 0x8d, 0xff, 0x20, 0x31, 0x5a, 0xff, 0x40, 0x54, 0x59, 0xff, 0x91, 0xac, 0x8f, 0xff, 0x96, 0xac, 0x92, 0xff, 0x8f, 0xa2, 0x90, 0xff, 0x81, 0x99, 0x7d, 0xff, 0x6c, 0x88, 0x6d, 0xff, 0x56, 0x70, 0x63, 0xff, 0x4a, 0x65, 0x5a, 0xff, 0x47, 0x62, 0x55, 0xff, 0x47, 0x62, 0x55, 0xff, 0x47, 0x62, 0x55, 0xff, 0x46, 0x62, 0x55, 0xff, 0x46, 0x62, 0x55, 0xff, 0x45, 0x61, 0x54, 0xff, 0x44, 0x61, 0x54, 0xff, 0x41, 0x5f, 0x52, 0xff, 0x43, 0x60, 0x53, 0xff, 0x44, 0x60, 0x53, 0xff, 0x43, 0x5d, 0x51, 0xff, 0x44, 0x5e, 0x51, 0xff, 0x44, 0x5e, 0x51, 0xff, 0x44, 0x5d, 0x50, 0xff, 0x42, 0x5b, 0x4f, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x40, 0x59, 0x4d, 0xff, 0x3f, 0x57, 0x4b, 0xff, 0x3f, 0x57, 0x4b, 0xff, 0x3f, 0x57, 0x4b, 0xff, 0x3f, 0x57, 0x4a, 0xf2, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x07, 0x06, 0xc6, 0x07, 0x08, 0x06, 0xff, 0x08, 0x09, 0x06, 0xff, 0x09, 0x0a, 0x07, 0xff, 0x07, 0x08, 0x06, 0xff, 0x05, 0x06, 0x04, 0xff, 0x02, 0x04, 0x02, 0xff, 0x02, 0x02, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x00, 0x04, 0x06, 0xff, 0x01, 0x0f, 0x15, 0xff, 0x13, 0x2d, 0x37, 0xff, 0x38, 0x5a, 0x65, 0xff, 0x64, 0x83, 0x8c, 0xff, 0x80, 0x98, 0x99, 0xff, 0x88, 0x9b, 0x97, 0xff, 0x87, 0x93, 0x83, 0xff, 0x68, 0x6f, 0x6b, 0xff, 0x2f, 0x3f, 0x4e, 0xff, 0x17, 0x32, 0x51, 0xff, 0x38, 0x5e, 0x89, 0xff, 0x5b, 0x83, 0xbc, 0xff, 0x6e, 0x96, 0xce, 0xff, 0x72, 0x97, 0xcf, 0xff, 0x85, 0xa5, 0xda, 0xff, 0x92, 0xb3, 0xe8, 0xff, 0x84, 0xa9, 0xe0, 0xff, 0x84, 0xaa, 0xe3, 0xff, 0x8f, 0xb5, 0xe8, 0xff, 0x97, 0xb9, 0xea, 0xff, 0x99, 0xba, 0xe9, 0xff, 0xa3, 0xc2, 0xec, 0xff, 0xac, 0xc6, 0xe3, 0xff, 0xac, 0xc9, 0xeb, 0xff, 0xa1, 0xc4, 0xf5, 0xff, 0x7d, 0xa4, 0xe0, 0xff, 0x4c, 0x74, 0xb5, 0xff, 0x34, 0x5a, 0xa3, 0xff, 0x35, 0x57, 0xa4, 0xff, 0x3d, 0x5e, 0xad, 0xff, 0x34, 0x5b, 0xaf, 0xff, 0x5f, 0x84, 0xce, 0xff, 0x92, 0xad, 0xe2, 0xff, 0xba, 0xcc, 0xec, 0xff, 0xc8, 0xd7, 0xf2, 0xff, 0x9a, 0xaf, 0xdb, 0xff, 0x6f, 0x93, 0xd7, 0xff, 0x70, 0x9b, 0xe5, 0xff, 0x78, 0x9f, 0xdb, 0xff, 0x73, 0x99, 0xd3, 0xff, 0x6a, 0x8f, 0xc6, 0xff, 0x6e, 0x92, 0xc6, 0xff, 0x87, 0xab, 0xdb, 0xff, 0x92, 0xb3, 0xe1, 0xff, 0x99, 0xb9, 0xe3, 0xff, 0xa6, 0xc2, 0xe8, 0xff, 0xac, 0xc6, 0xeb, 0xff, 0xa6, 0xc1, 0xe9, 0xff, 0x9f, 0xbc, 0xe4, 0xff, 0x9e, 0xbe, 0xe8, 0xff, 0x96, 0xb9, 0xe6, 0xff, 0x95, 0xb6, 0xe6, 0xff, 0x9a, 0xbe, 0xec, 0xff, 0x97, 0xb7, 0xea, 0xff, 0x8a, 0xa7, 0xdd, 0xff, 0x83, 0xa7, 0xd6, 0xff, 0x7d, 0xa6, 0xd4, 0xff, 0x75, 0x9d, 0xca, 0xff, 0x60, 0x84, 0xb2, 0xff, 0x3a, 0x59, 0x88, 0xff, 0x2d, 0x47, 0x78, 0xff, 0x1a, 0x2d, 0x50, 0xff, 0x50, 0x67, 0x62, 0xff, 0x93, 0xb2, 0x8f, 0xff, 0x96, 0xae, 0x93, 0xff, 0x8f, 0xa0, 0x93, 0xff, 0x80, 0x97, 0x7d, 0xff, 0x6b, 0x89, 0x67, 0xff, 0x58, 0x76, 0x5b, 0xff, 0x4a, 0x66, 0x59, 0xff, 0x45, 0x61, 0x55, 0xff, 0x46, 0x62, 0x55, 0xff, 0x46, 0x62, 0x55, 0xff, 0x46, 0x62, 0x55, 0xff, 0x46, 0x62, 0x55, 0xff, 0x45, 0x61, 0x54, 0xff, 0x45, 0x61, 0x54, 0xff, 0x41, 0x5f, 0x52, 0xff, 0x40, 0x5f, 0x52, 0xff, 0x41, 0x5f, 0x52, 0xff, 0x43, 0x5f, 0x51, 0xff, 0x44, 0x5e, 0x51, 0xff, 0x44, 0x5e, 0x51, 0xff, 0x44, 0x5d, 0x50, 0xff, 0x42, 0x5b, 0x4f, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x5a, 0x4c, 0xff, 0x40, 0x59, 0x4d, 0xff, 0x3f, 0x57, 0x4b, 0xff, 0x3e, 0x56, 0x4a, 0xff, 0x3f, 0x57, 0x4b, 0xff, 0x3e, 0x55, 0x4a, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0x03, 0x90, 0x08, 0x06, 0x06, 0xff, 0x07, 0x06, 0x05, 0xff, 0x07, 0x06, 0x05, 0xff, 0x07, 0x06, 0x05, 0xff, 0x05, 0x04, 0x03, 0xff, 0x03, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x00, 0x01, 0x03, 0xff, 0x01, 0x0b, 0x12, 0xff, 0x0e, 0x24, 0x2e, 0xff, 0x2d, 0x4c, 0x57, 0xff, 0x56, 0x73, 0x7c, 0xff, 0x74, 0x89, 0x8f, 0xff, 0x79, 0x8a, 0x8f, 0xff, 0x76, 0x7a, 0x7a, 0xff, 0x60, 0x62, 0x63, 0xff, 0x31, 0x3e, 0x44, 0xff, 0x10, 0x27, 0x3d, 0xff, 0x2f, 0x4c, 0x75, 0xff, 0x4d, 0x6e, 0xa7, 0xff, 0x63, 0x8a, 0xc2, 0xff, 0x76, 0x9f, 0xd0, 0xff, 0x87, 0xa9, 0xdb, 0xff, 0x8f, 0xb1, 0xe3, 0xff, 0x8b, 0xaf, 0xe4, 0xff, 0x8b, 0xb1, 0xe6, 0xff, 0x93, 0xb8, 0xea, 0xff, 0x96, 0xb8, 0xe8, 0xff, 0x98, 0xb8, 0xe6, 0xff, 0xa3, 0xc1, 0xeb, 0xff, 0xb5, 0xca, 0xec, 0xff, 0xb4, 0xcd, 0xeb, 0xff, 0xa5, 0xc2, 0xe9, 0xff, 0x90, 0xb2, 0xe6, 0xff, 0x60, 0x86, 0xc5, 0xff, 0x32, 0x56, 0xa2, 0xff, 0x31, 0x52, 0xa1, 0xff, 0x37, 0x58, 0xa6, 0xff, 0x3a, 0x5e, 0xb0, 0xff, 0x69, 0x8d, 0xd4, 0xff, 0x98, 0xb6, 0xec, 0xff, 0xb0, 0xc6, 0xef, 0xff, 0xae, 0xc1, 0xe8, 0xff, 0x9a, 0xb0, 0xe2, 0xff, 0x77, 0x9a, 0xdd, 0xff, 0x5a, 0x83, 0xca, 0xff, 0x75, 0x9a, 0xd7, 0xff, 0x6f, 0x94, 0xcf, 0xff, 0x5e, 0x83, 0xbd, 0xff, 0x55, 0x79, 0xb1, 0xff, 0x82, 0xa2, 0xd6, 0xff, 0x97, 0xb6, 0xe5, 0xff, 0x9d, 0xb7, 0xe2, 0xff, 0xa9, 0xc2, 0xe8, 0xff, 0xaf, 0xca, 0xed, 0xff, 0xac, 0xc7, 0xed, 0xff, 0xa3, 0xc0, 0xe6, 0xff, 0x9c, 0xbc, 0xe5, 0xff, 0x97, 0xb9, 0xe5, 0xff, 0x94, 0xb5, 0xe4, 0xff, 0x92, 0xb5, 0xe3, 0xff, 0x97, 0xb9, 0xe8, 0xff, 0x8f, 0xaf, 0xe0, 0xff, 0x87, 0xaa, 0xdb, 0xff, 0x87, 0xac, 0xdd, 0xff, 0x74, 0x9b, 0xc8, 0xff, 0x4e, 0x73, 0x9d, 0xff, 0x2b, 0x47, 0x73, 0xff, 0x2a, 0x3e, 0x72, 0xff, 0x1a, 0x2f, 0x48, 0xff, 0x5d, 0x79, 0x6d, 0xff, 0x92, 0xb0, 0x93, 0xff, 0x95, 0xad, 0x93, 0xff, 0x90, 0xa5, 0x90, 0xff, 0x81, 0x97, 0x7d, 0xff, 0x6a, 0x87, 0x69, 0xff, 0x57, 0x75, 0x5d, 0xff, 0x4a, 0x66, 0x58, 0xff, 0x46, 0x62, 0x55, 0xff, 0x46, 0x62, 0x55, 0xff, 0x46, 0x62, 0x55, 0xff, 0x46, 0x62, 0x55, 0xff, 0x46, 0x62, 0x55, 0xff, 0x45, 0x60, 0x54, 0xff, 0x44, 0x60, 0x53, 0xff, 0x42, 0x61, 0x52, 0xff, 0x42, 0x60, 0x51, 0xff, 0x43, 0x60, 0x51, 0xff, 0x43, 0x60, 0x51, 0xff, 0x44, 0x5e, 0x51, 0xff, 0x44, 0x5e, 0x51, 0xff, 0x44, 0x5d, 0x50, 0xff, 0x42, 0x5b, 0x4f, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x41, 0x5b, 0x4e, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x40, 0x58, 0x4b, 0xff, 0x3f, 0x58, 0x4b, 0xff, 0x3f, 0x57, 0x4b, 0xff, 0x3f, 0x56, 0x4a, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x02, 0x58, 0x06, 0x04, 0x04, 0xff, 0x06, 0x04, 0x04, 0xff, 0x06, 0x04, 0x03, 0xff, 0x07, 0x05, 0x05, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x02, 0x09, 0x0e, 0xff, 0x0b, 0x1c, 0x25, 0xff, 0x22, 0x38, 0x43, 0xff, 0x48, 0x5d, 0x69, 0xff, 0x5f, 0x71, 0x7f, 0xff, 0x60, 0x70, 0x80, 0xff, 0x57, 0x65, 0x6e, 0xff, 0x49, 0x54, 0x4f, 0xff, 0x2e, 0x3a, 0x2f, 0xff, 0x15, 0x1e, 0x2a, 0xff, 0x21, 0x30, 0x5b, 0xff, 0x3f, 0x56, 0x95, 0xff, 0x5a, 0x7f, 0xb8, 0xff, 0x73, 0x9f, 0xcb, 0xff, 0x80, 0xa5, 0xd4, 0xff, 0x88, 0xac, 0xdb, 0xff, 0x96, 0xb9, 0xe6, 0xff, 0x92, 0xb4, 0xe2, 0xff, 0x95, 0xb7, 0xe5, 0xff, 0x9c, 0xbe, 0xeb, 0xff, 0x9a, 0xb8, 0xe4, 0xff, 0xa6, 0xc1, 0xec, 0xff, 0xba, 0xce, 0xf5, 0xff, 0xb9, 0xcf, 0xec, 0xff, 0xaf, 0xc9, 0xe4, 0xff, 0x9e, 0xbb, 0xe3, 0xff, 0x6c, 0x90, 0xce, 0xff, 0x2c, 0x4d, 0x9a, 0xff, 0x2f, 0x4e, 0x9b, 0xff, 0x45, 0x63, 0xad, 0xff, 0x58, 0x7a, 0xc6, 0xff, 0x76, 0x9b, 0xde, 0xff, 0x8e, 0xb0, 0xe7, 0xff, 0x9e, 0xba, 0xea, 0xff, 0xa5, 0xbc, 0xec, 0xff, 0x9b, 0xb5, 0xe9, 0xff, 0x82, 0xa6, 0xe3, 0xff, 0x78, 0xa0, 0xde, 0xff, 0x75, 0x99, 0xd4, 0xff, 0x6a, 0x8f, 0xcc, 0xff, 0x57, 0x7f, 0xbd, 0xff, 0x48, 0x6f, 0xab, 0xff, 0x6b, 0x8e, 0xc4, 0xff, 0x98, 0xb7, 0xe8, 0xff, 0xa6, 0xc0, 0xed, 0xff, 0xb1, 0xc9, 0xef, 0xff, 0xac, 0xc6, 0xe6, 0xff, 0xa7, 0xc3, 0xe5, 0xff, 0xad, 0xc8, 0xeb, 0xff, 0xa1, 0xbf, 0xe5, 0xff, 0x9b, 0xbb, 0xe5, 0xff, 0x95, 0xb5, 0xe1, 0xff, 0x93, 0xb5, 0xe1, 0xff, 0x98, 0xba, 0xe5, 0xff, 0x8f, 0xb0, 0xdd, 0xff, 0x88, 0xa9, 0xdb, 0xff, 0x7e, 0xa1, 0xd6, 0xff, 0x6f, 0x94, 0xc2, 0xff, 0x49, 0x6d, 0x94, 0xff, 0x2e, 0x49, 0x73, 0xff, 0x25, 0x38, 0x6c, 0xff, 0x17, 0x30, 0x3f, 0xff, 0x68, 0x85, 0x7a, 0xff, 0x95, 0xaf, 0x9d, 0xff, 0x95, 0xae, 0x93, 0xff, 0x90, 0xa8, 0x8a, 0xff, 0x81, 0x99, 0x7c, 0xff, 0x6b, 0x85, 0x6e, 0xff, 0x56, 0x70, 0x62, 0xff, 0x48, 0x65, 0x58, 0xff, 0x45, 0x62, 0x55, 0xff, 0x43, 0x60, 0x53, 0xff, 0x44, 0x61, 0x54, 0xff, 0x46, 0x62, 0x55, 0xff, 0x45, 0x61, 0x54, 0xff, 0x44, 0x60, 0x53, 0xff, 0x44, 0x60, 0x53, 0xff, 0x45, 0x60, 0x51, 0xff, 0x45, 0x5f, 0x51, 0xff, 0x46, 0x5f, 0x51, 0xff, 0x45, 0x5e, 0x50, 0xff, 0x44, 0x5e, 0x51, 0xff, 0x44, 0x5e, 0x51, 0xff, 0x44, 0x5d, 0x50, 0xff, 0x42, 0x5b, 0x4f, 0xff, 0x41, 0x5b, 0x4d, 0xff, 0x41, 0x5b, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x40, 0x5a, 0x4d, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x59, 0x4c, 0xff, 0x3f, 0x58, 0x4b, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x41, 0x5a, 0x4b, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x3f, 0x59, 0x4b, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x1b, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x03, 0xff, 0x05, 0x03, 0x03, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x07, 0x09, 0xff, 0x07, 0x16, 0x1d, 0xff, 0x18, 0x28, 0x35, 0xff, 0x30, 0x40, 0x50, 0xff, 0x41, 0x53, 0x63, 0xff, 0x45, 0x54, 0x67, 0xff, 0x42, 0x4e, 0x5a, 0xff, 0x36, 0x3d, 0x3c, 0xff, 0x28, 0x2f, 0x25, 0xff, 0x16, 0x1f, 0x21, 0xff, 0x12, 0x1e, 0x3d, 0xff, 0x1e, 0x34, 0x6d, 0xff, 0x43, 0x64, 0x9f, 0xff, 0x6d, 0x91, 0xc5, 0xff, 0x7b, 0x9f, 0xcf, 0xff, 0x85, 0xa9, 0xd8, 0xff, 0x90, 0xb2, 0xe0, 0xff, 0x91, 0xb3, 0xe0, 0xff, 0x94, 0xb5, 0xe1, 0xff, 0x95, 0xb4, 0xe1, 0xff, 0x9d, 0xbc, 0xe8, 0xff, 0xa8, 0xc4, 0xf1, 0xff, 0xae, 0xc6, 0xec, 0xff, 0xb2, 0xc7, 0xe7, 0xff, 0xb4, 0xcf, 0xe8, 0xff, 0xa0, 0xc0, 0xe6, 0xff, 0x67, 0x89, 0xca, 0xff, 0x23, 0x44, 0x94, 0xff, 0x30, 0x4e, 0x98, 0xff, 0x4f, 0x6a, 0xb4, 0xff, 0x5b, 0x81, 0xd0, 0xff, 0x6d, 0x97, 0xdc, 0xff, 0x83, 0xa7, 0xe0, 0xff, 0x9a, 0xb6, 0xe8, 0xff, 0x9e, 0xb4, 0xe6, 0xff, 0x94, 0xac, 0xe1, 0xff, 0x83, 0xa5, 0xe2, 0xff, 0x80, 0xa9, 0xe5, 0xff, 0x7c, 0xa3, 0xd8, 0xff, 0x6d, 0x92, 0xce, 0xff, 0x54, 0x7b, 0xbe, 0xff, 0x48, 0x6d, 0xb0, 0xff, 0x5a, 0x7f, 0xb9, 0xff, 0x90, 0xb0, 0xe2, 0xff, 0xa6, 0xc1, 0xe9, 0xff, 0xab, 0xc4, 0xe7, 0xff, 0xab, 0xc3, 0xe5, 0xff, 0xab, 0xc6, 0xe9, 0xff, 0xac, 0xc8, 0xeb, 0xff, 0x9f, 0xbe, 0xe4, 0xff, 0x9b, 0xbd, 0xe5, 0xff, 0x97, 0xba, 0xe4, 0xff, 0x95, 0xba, 0xe5, 0xff, 0x91, 0xb5, 0xdf, 0xff, 0x8a, 0xab, 0xd7, 0xff, 0x90, 0xb2, 0xe2, 0xff, 0x73, 0x98, 0xc8, 0xff, 0x60, 0x83, 0xb0, 0xff, 0x40, 0x60, 0x8a, 0xff, 0x2f, 0x49, 0x74, 0xff, 0x16, 0x2b, 0x5d, 0xff, 0x23, 0x3d, 0x48, 0xff, 0x7b, 0x96, 0x8b, 0xff, 0x97, 0xb1, 0xa0, 0xff, 0x96, 0xad, 0x95, 0xff, 0x8e, 0xa6, 0x86, 0xff, 0x81, 0x99, 0x7d, 0xff, 0x6c, 0x84, 0x70, 0xff, 0x57, 0x71, 0x61, 0xff, 0x47, 0x65, 0x58, 0xff, 0x44, 0x62, 0x56, 0xff, 0x42, 0x61, 0x54, 0xff, 0x44, 0x62, 0x55, 0xff, 0x45, 0x61, 0x54, 0xff, 0x45, 0x61, 0x54, 0xff, 0x46, 0x61, 0x54, 0xff, 0x46, 0x60, 0x53, 0xff, 0x46, 0x5f, 0x51, 0xff, 0x46, 0x5f, 0x51, 0xff, 0x46, 0x5f, 0x51, 0xff, 0x45, 0x5e, 0x50, 0xff, 0x45, 0x5e, 0x50, 0xff, 0x45, 0x5e, 0x50, 0xff, 0x45, 0x5e, 0x50, 0xff, 0x43, 0x5c, 0x4e, 0xff, 0x42, 0x5b, 0x4d, 0xff, 0x42, 0x5b, 0x4d, 0xff, 0x41, 0x5a, 0x4c, 0xff, 0x41, 0x5a, 0x4c, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3f, 0x58, 0x49, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x42, 0x55, 0x4b, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x02, 0xd7, 0x04, 0x02, 0x02, 0xff, 0x04, 0x02, 0x02, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x00, 0x03, 0x05, 0xff, 0x03, 0x0d, 0x14, 0xff, 0x0d, 0x1a, 0x28, 0xff, 0x18, 0x28, 0x39, 0xff, 0x27, 0x38, 0x48, 0xff, 0x2b, 0x3b, 0x4e, 0xff, 0x2a, 0x32, 0x41, 0xff, 0x28, 0x29, 0x2d, 0xff, 0x28, 0x2b, 0x1e, 0xff, 0x1f, 0x24, 0x1b, 0xff, 0x0f, 0x1a, 0x2b, 0xff, 0x0b, 0x1f, 0x4a, 0xff, 0x29, 0x46, 0x7c, 0xff, 0x5b, 0x78, 0xb0, 0xff, 0x72, 0x94, 0xc7, 0xff, 0x82, 0xa7, 0xd7, 0xff, 0x8c, 0xad, 0xde, 0xff, 0x94, 0xb5, 0xe5, 0xff, 0x8f, 0xb1, 0xde, 0xff, 0x8b, 0xac, 0xd9, 0xff, 0x8e, 0xaf, 0xdc, 0xff, 0x95, 0xb4, 0xe2, 0xff, 0xa7, 0xbf, 0xe6, 0xff, 0xb5, 0xcb, 0xeb, 0xff, 0xb0, 0xcc, 0xe5, 0xff, 0x99, 0xb7, 0xde, 0xff, 0x5e, 0x80, 0xc0, 0xff, 0x2c, 0x4d, 0x9b, 0xff, 0x31, 0x4f, 0x98, 0xff, 0x49, 0x65, 0xae, 0xff, 0x63, 0x8c, 0xda, 0xff, 0x77, 0xa3, 0xe5, 0xff, 0x8a, 0xb1, 0xe6, 0xff, 0x9a, 0xb5, 0xe5, 0xff, 0xa4, 0xb6, 0xe4, 0xff, 0x9d, 0xb2, 0xe3, 0xff, 0x8a, 0xa7, 0xe2, 0xff, 0x81, 0xa6, 0xdd, 0xff, 0x7c, 0xa4, 0xd0, 0xff, 0x75, 0x9a, 0xd4, 0xff, 0x5a, 0x7c, 0xc4, 0xff, 0x47, 0x66, 0xb3, 0xff, 0x56, 0x76, 0xba, 0xff, 0x82, 0xa1, 0xd5, 0xff, 0xa3, 0xc1, 0xe2, 0xff, 0xa8, 0xc3, 0xe1, 0xff, 0xab, 0xc5, 0xe8, 0xff, 0xa6, 0xc1, 0xe6, 0xff, 0xa6, 0xc3, 0xe8, 0xff, 0xa3, 0xc2, 0xea, 0xff, 0x9b, 0xbc, 0xe7, 0xff, 0x9b, 0xbe, 0xe9, 0xff, 0x97, 0xbc, 0xe8, 0xff, 0x8f, 0xb3, 0xdc, 0xff, 0x8e, 0xb1, 0xdb, 0xff, 0x8a, 0xae, 0xda, 0xff, 0x6a, 0x8f, 0xbc, 0xff, 0x51, 0x73, 0xa2, 0xff, 0x31, 0x50, 0x7f, 0xff, 0x35, 0x4c, 0x7b, 0xff, 0x19, 0x2b, 0x5a, 0xff, 0x3a, 0x54, 0x5c, 0xff, 0x88, 0xa4, 0x95, 0xff, 0x95, 0xad, 0x9b, 0xff, 0x97, 0xad, 0x93, 0xff, 0x8f, 0xa6, 0x87, 0xff, 0x81, 0x98, 0x7c, 0xff, 0x6d, 0x85, 0x6f, 0xff, 0x59, 0x72, 0x60, 0xff, 0x47, 0x66, 0x58, 0xff, 0x45, 0x64, 0x57, 0xff, 0x43, 0x61, 0x54, 0xff, 0x44, 0x62, 0x55, 0xff, 0x45, 0x61, 0x54, 0xff, 0x46, 0x61, 0x54, 0xff, 0x47, 0x61, 0x54, 0xff, 0x47, 0x61, 0x54, 0xff, 0x46, 0x5f, 0x51, 0xff, 0x46, 0x5f, 0x51, 0xff, 0x46, 0x5f, 0x51, 0xff, 0x45, 0x5e, 0x50, 0xff, 0x45, 0x5e, 0x50, 0xff, 0x45, 0x5e, 0x50, 0xff, 0x44, 0x5d, 0x4f, 0xff, 0x43, 0x5c, 0x4e, 0xff, 0x42, 0x5b, 0x4d, 0xff, 0x42, 0x5b, 0x4d, 0xff, 0x41, 0x5a, 0x4c, 0xff, 0x41, 0x5a, 0x4c, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3e, 0x57, 0x49, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x40, 0x58, 0x4a, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x8e, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xff, 0x06, 0x00, 0x00, 0xff, 0x01, 0x00, 0x01, 0xff, 0x00, 0x03, 0x0c, 0xff, 0x08, 0x0f, 0x1c, 0xff, 0x10, 0x1b, 0x28, 0xff, 0x15, 0x24, 0x31, 0xff, 0x17, 0x25, 0x36, 0xff, 0x1b, 0x22, 0x2e, 0xff, 0x23, 0x21, 0x25, 0xff, 0x2a, 0x27, 0x19, 0xff, 0x28, 0x27, 0x18, 0xff, 0x18, 0x1f, 0x21, 0xff, 0x0a, 0x1b, 0x38, 0xff, 0x14, 0x2b, 0x5d, 0xff, 0x43, 0x59, 0x96, 0xff, 0x60, 0x80, 0xb7, 0xff, 0x76, 0x9a, 0xcc, 0xff, 0x87, 0xa8, 0xda, 0xff, 0x8f, 0xaf, 0xe1, 0xff, 0x99, 0xba, 0xe8, 0xff, 0x8e, 0xb0, 0xdd, 0xff, 0x85, 0xa9, 0xd5, 0xff, 0x9b, 0xbd, 0xeb, 0xff, 0xa8, 0xc1, 0xe9, 0xff, 0xb5, 0xcb, 0xec, 0xff, 0xad, 0xc8, 0xe3, 0xff, 0x94, 0xb5, 0xdc, 0xff, 0x59, 0x7a, 0xba, 0xff, 0x2d, 0x4d, 0x99, 0xff, 0x33, 0x50, 0x99, 0xff, 0x56, 0x72, 0xb9, 0xff, 0x71, 0x98, 0xde, 0xff, 0x82, 0xaa, 0xe2, 0xff, 0x94, 0xb7, 0xe1, 0xff, 0xac, 0xc3, 0xe6, 0xff, 0xb6, 0xc4, 0xe6, 0xff, 0xb5, 0xc4, 0xeb, 0xff, 0xa6, 0xbb, 0xea, 0xff, 0x8e, 0xac, 0xdb, 0xff, 0x82, 0xa8, 0xd4, 0xff, 0x7a, 0x9c, 0xd6, 0xff, 0x5e, 0x7c, 0xc7, 0xff, 0x56, 0x71, 0xc3, 0xff, 0x60, 0x7b, 0xc3, 0xff, 0x7e, 0x9b, 0xd0, 0xff, 0xa8, 0xc6, 0xe5, 0xff, 0xaa, 0xc7, 0xe3, 0xff, 0xa9, 0xc3, 0xe8, 0xff, 0xa3, 0xbf, 0xe4, 0xff, 0xa4, 0xc3, 0xea, 0xff, 0x9e, 0xbd, 0xe8, 0xff, 0x94, 0xb6, 0xe2, 0xff, 0x8f, 0xb1, 0xde, 0xff, 0x8e, 0xb3, 0xe1, 0xff, 0x90, 0xb3, 0xde, 0xff, 0x89, 0xac, 0xd2, 0xff, 0x8a, 0xae, 0xd6, 0xff, 0x75, 0x9c, 0xc5, 0xff, 0x37, 0x5b, 0x88, 0xff, 0x26, 0x44, 0x73, 0xff, 0x36, 0x4d, 0x7b, 0xff, 0x18, 0x2a, 0x52, 0xff, 0x4b, 0x65, 0x67, 0xff, 0x91, 0xad, 0x9c, 0xff, 0x96, 0xaf, 0x9b, 0xff, 0x96, 0xac, 0x92, 0xff, 0x90, 0xa6, 0x88, 0xff, 0x81, 0x97, 0x7b, 0xff, 0x6e, 0x85, 0x6e, 0xff, 0x5a, 0x73, 0x5f, 0xff, 0x4a, 0x67, 0x58, 0xff, 0x46, 0x64, 0x56, 0xff, 0x46, 0x64, 0x54, 0xff, 0x46, 0x63, 0x54, 0xff, 0x46, 0x61, 0x53, 0xff, 0x47, 0x61, 0x53, 0xff, 0x47, 0x61, 0x52, 0xff, 0x47, 0x61, 0x52, 0xff, 0x47, 0x60, 0x52, 0xff, 0x46, 0x5f, 0x51, 0xff, 0x46, 0x5f, 0x51, 0xff, 0x45, 0x5e, 0x50, 0xff, 0x45, 0x5e, 0x50, 0xff, 0x45, 0x5e, 0x50, 0xff, 0x44, 0x5d, 0x4f, 0xff, 0x43, 0x5c, 0x4e, 0xff, 0x42, 0x5b, 0x4d, 0xff, 0x41, 0x5a, 0x4c, 0xff, 0x41, 0x5a, 0x4c, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x3e, 0x57, 0x49, 0xff, 0x3e, 0x57, 0x49, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x40, 0x59, 0x4b, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x46, 0x03, 0x01, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x05, 0x01, 0x00, 0xff, 0x08, 0x01, 0x00, 0xff, 0x03, 0x00, 0x01, 0xff, 0x00, 0x00, 0x05, 0xff, 0x03, 0x06, 0x0f, 0xff, 0x0a, 0x11, 0x18, 0xff, 0x0e, 0x17, 0x1f, 0xff, 0x12, 0x1a, 0x23, 0xff, 0x17, 0x1d, 0x23, 0xff, 0x21, 0x1d, 0x1d, 0xff, 0x2e, 0x25, 0x17, 0xff, 0x32, 0x2c, 0x1c, 0xff, 0x20, 0x23, 0x1c, 0xff, 0x12, 0x20, 0x31, 0xff, 0x0f, 0x23, 0x4e, 0xff, 0x2b, 0x3b, 0x7a, 0xff, 0x4e, 0x6d, 0xa6, 0xff, 0x6a, 0x8e, 0xc2, 0xff, 0x83, 0xa5, 0xd8, 0xff, 0x8c, 0xae, 0xe0, 0xff, 0x94, 0xb5, 0xe4, 0xff, 0x9b, 0xbc, 0xea, 0xff, 0x99, 0xbc, 0xe9, 0xff, 0x9c, 0xbe, 0xec, 0xff, 0xaa, 0xc3, 0xed, 0xff, 0xb0, 0xc8, 0xea, 0xff, 0xab, 0xc7, 0xe2, 0xff, 0x93, 0xb2, 0xdc, 0xff, 0x4f, 0x71, 0xaf, 0xff, 0x2e, 0x4e, 0x9b, 0xff, 0x31, 0x4f, 0x9a, 0xff, 0x61, 0x7a, 0xbf, 0xff, 0x82, 0xa3, 0xdc, 0xff, 0x90, 0xb2, 0xe0, 0xff, 0x9e, 0xb8, 0xd9, 0xff, 0xbe, 0xcd, 0xe6, 0xff, 0xd0, 0xda, 0xf2, 0xff, 0xd2, 0xdb, 0xf6, 0xff, 0xc2, 0xd0, 0xf0, 0xff, 0xa0, 0xbc, 0xe1, 0xff, 0x8c, 0xb1, 0xde, 0xff, 0x78, 0x99, 0xd2, 0xff, 0x58, 0x76, 0xbd, 0xff, 0x5a, 0x76, 0xc4, 0xff, 0x62, 0x7f, 0xc5, 0xff, 0x7d, 0x9a, 0xcf, 0xff, 0xae, 0xcb, 0xed, 0xff, 0xab, 0xc7, 0xe7, 0xff, 0xa6, 0xc1, 0xe7, 0xff, 0xa1, 0xbf, 0xe6, 0xff, 0xa1, 0xc0, 0xe9, 0xff, 0x9e, 0xbf, 0xe9, 0xff, 0x96, 0xb9, 0xe5, 0xff, 0x8f, 0xb4, 0xe1, 0xff, 0x81, 0xa8, 0xd8, 0xff, 0x81, 0xa5, 0xd2, 0xff, 0x88, 0xac, 0xd0, 0xff, 0x8a, 0xb2, 0xd3, 0xff, 0x64, 0x8a, 0xb1, 0xff, 0x26, 0x48, 0x76, 0xff, 0x2b, 0x47, 0x78, 0xff, 0x31, 0x46, 0x6e, 0xff, 0x19, 0x2e, 0x4a, 0xff, 0x5b, 0x76, 0x71, 0xff, 0x96, 0xb2, 0x9e, 0xff, 0x99, 0xb3, 0x9c, 0xff, 0x98, 0xae, 0x92, 0xff, 0x90, 0xa5, 0x88, 0xff, 0x81, 0x97, 0x7c, 0xff, 0x6e, 0x85, 0x6d, 0xff, 0x5a, 0x74, 0x5d, 0xff, 0x4b, 0x67, 0x58, 0xff, 0x46, 0x64, 0x55, 0xff, 0x48, 0x64, 0x55, 0xff, 0x48, 0x64, 0x55, 0xff, 0x48, 0x61, 0x53, 0xff, 0x47, 0x61, 0x53, 0xff, 0x47, 0x60, 0x52, 0xff, 0x47, 0x60, 0x52, 0xff, 0x48, 0x61, 0x53, 0xff, 0x47, 0x60, 0x52, 0xff, 0x46, 0x5f, 0x51, 0xff, 0x45, 0x5e, 0x50, 0xff, 0x45, 0x5e, 0x50, 0xff, 0x44, 0x5d, 0x4f, 0xff, 0x43, 0x5c, 0x4e, 0xff, 0x44, 0x5d, 0x4f, 0xff, 0x42, 0x5b, 0x4d, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x41, 0x5a, 0x4c, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3e, 0x57, 0x49, 0xff, 0x3e, 0x57, 0x49, 0xff, 0x3e, 0x57, 0x49, 0xff, 0x3d, 0x57, 0x48, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x01, 0x01, 0xef, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xff, 0x06, 0x02, 0x01, 0xff, 0x04, 0x02, 0x02, 0xff, 0x01, 0x00, 0x02, 0xff, 0x01, 0x01, 0x05, 0xff, 0x08, 0x09, 0x0d, 0xff, 0x0e, 0x0e, 0x12, 0xff, 0x11, 0x14, 0x16, 0xff, 0x14, 0x1b, 0x19, 0xff, 0x21, 0x20, 0x17, 0xff, 0x33, 0x27, 0x1b, 0xff, 0x3a, 0x30, 0x22, 0xff, 0x29, 0x28, 0x1f, 0xff, 0x17, 0x26, 0x2b, 0xff, 0x14, 0x2a, 0x4b, 0xff, 0x1b, 0x2b, 0x63, 0xff, 0x36, 0x54, 0x8b, 0xff, 0x5a, 0x7d, 0xb3, 0xff, 0x76, 0x98, 0xce, 0xff, 0x85, 0xa9, 0xdb, 0xff, 0x87, 0xa8, 0xda, 0xff, 0x99, 0xba, 0xeb, 0xff, 0x94, 0xb7, 0xe5, 0xff, 0x88, 0xa9, 0xd7, 0xff, 0xa4, 0xbd, 0xea, 0xff, 0xad, 0xc9, 0xe8, 0xff, 0xa9, 0xc9, 0xe2, 0xff, 0x8a, 0xa9, 0xd4, 0xff, 0x49, 0x6b, 0xa9, 0xff, 0x38, 0x59, 0xa4, 0xff, 0x2d, 0x4c, 0x94, 0xff, 0x60, 0x7a, 0xbc, 0xff, 0x89, 0xa6, 0xdd, 0xff, 0x94, 0xb2, 0xe1, 0xff, 0xb1, 0xc8, 0xe9, 0xff, 0xcb, 0xd9, 0xf1, 0xff, 0xd9, 0xe0, 0xf7, 0xff, 0xd9, 0xdd, 0xf7, 0xff, 0xc6, 0xd4, 0xf1, 0xff, 0x9f, 0xbe, 0xdf, 0xff, 0x94, 0xb7, 0xe2, 0xff, 0x7a, 0x9a, 0xd2, 0xff, 0x6d, 0x8c, 0xcc, 0xff, 0x78, 0x98, 0xda, 0xff, 0x66, 0x85, 0xc3, 0xff, 0x81, 0x9f, 0xd0, 0xff, 0xb1, 0xca, 0xf0, 0xff, 0xad, 0xc8, 0xec, 0xff, 0x90, 0xae, 0xd5, 0xff, 0x9d, 0xbc, 0xe4, 0xff, 0xa5, 0xc3, 0xec, 0xff, 0x9c, 0xbe, 0xe8, 0xff, 0x8d, 0xb2, 0xde, 0xff, 0x88, 0xaf, 0xdd, 0xff, 0x79, 0xa4, 0xd4, 0xff, 0x7f, 0xa2, 0xd5, 0xff, 0x8a, 0xae, 0xd7, 0xff, 0x77, 0xa3, 0xc0, 0xff, 0x51, 0x78, 0x9a, 0xff, 0x32, 0x52, 0x81, 0xff, 0x32, 0x4b, 0x7f, 0xff, 0x2a, 0x40, 0x66, 0xff, 0x1e, 0x37, 0x47, 0xff, 0x6c, 0x89, 0x7e, 0xff, 0x96, 0xb4, 0x9e, 0xff, 0x9b, 0xb3, 0x9b, 0xff, 0x99, 0xb0, 0x93, 0xff, 0x91, 0xa4, 0x88, 0xff, 0x83, 0x97, 0x7c, 0xff, 0x6f, 0x86, 0x6d, 0xff, 0x5d, 0x74, 0x5d, 0xff, 0x4c, 0x68, 0x59, 0xff, 0x46, 0x64, 0x56, 0xff, 0x48, 0x63, 0x55, 0xff, 0x4a, 0x63, 0x55, 0xff, 0x48, 0x61, 0x53, 0xff, 0x48, 0x61, 0x53, 0xff, 0x49, 0x61, 0x53, 0xff, 0x48, 0x61, 0x53, 0xff, 0x48, 0x61, 0x53, 0xff, 0x46, 0x5f, 0x51, 0xff, 0x46, 0x5f, 0x51, 0xff, 0x46, 0x5f, 0x51, 0xff, 0x45, 0x5e, 0x50, 0xff, 0x44, 0x5d, 0x4f, 0xff, 0x44, 0x5d, 0x4f, 0xff, 0x43, 0x5c, 0x4e, 0xff, 0x42, 0x5b, 0x4d, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x41, 0x5a, 0x4c, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3e, 0x57, 0x49, 0xff, 0x3e, 0x57, 0x49, 0xff, 0x3d, 0x56, 0x48, 0xff, 0x3c, 0x56, 0x47, 0xef, 0x48, 0x48, 0x48, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0xa0, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x01, 0x00, 0xff, 0x02, 0x03, 0x01, 0xff, 0x04, 0x03, 0x03, 0xff, 0x05, 0x03, 0x04, 0xff, 0x06, 0x03, 0x04, 0xff, 0x0a, 0x06, 0x07, 0xff, 0x0c, 0x0b, 0x09, 0xff, 0x11, 0x10, 0x0e, 0xff, 0x13, 0x1e, 0x0f, 0xff, 0x21, 0x28, 0x15, 0xff, 0x32, 0x28, 0x1e, 0xff, 0x3b, 0x2f, 0x27, 0xff, 0x30, 0x30, 0x27, 0xff, 0x16, 0x23, 0x29, 0xff, 0x11, 0x27, 0x43, 0xff, 0x13, 0x2a, 0x58, 0xff, 0x23, 0x41, 0x76, 0xff, 0x4e, 0x6e, 0xa6, 0xff, 0x6d, 0x8d, 0xc3, 0xff, 0x81, 0xa3, 0xd5, 0xff, 0x72, 0x95, 0xc8, 0xff, 0x83, 0xa7, 0xd8, 0xff, 0x8e, 0xb3, 0xe2, 0xff, 0x89, 0xad, 0xdb, 0xff, 0xa0, 0xb8, 0xe4, 0xff, 0xac, 0xc4, 0xe5, 0xff, 0xac, 0xc8, 0xe4, 0xff, 0x97, 0xb3, 0xdd, 0xff, 0x52, 0x70, 0xaf, 0xff, 0x40, 0x5e, 0xab, 0xff, 0x34, 0x50, 0x97, 0xff, 0x47, 0x60, 0xa2, 0xff, 0x84, 0xa1, 0xdf, 0xff, 0x95, 0xb4, 0xe7, 0xff, 0xaa, 0xc7, 0xe8, 0xff, 0xc5, 0xdb, 0xf2, 0xff, 0xd2, 0xda, 0xf3, 0xff, 0xcb, 0xd7, 0xf0, 0xff, 0xb4, 0xcc, 0xe9, 0xff, 0xa1, 0xc0, 0xe3, 0xff, 0x81, 0xa1, 0xcb, 0xff, 0x67, 0x87, 0xb8, 0xff, 0x76, 0x97, 0xcb, 0xff, 0x6f, 0x90, 0xc5, 0xff, 0x65, 0x83, 0xb9, 0xff, 0x95, 0xb1, 0xdf, 0xff, 0xaf, 0xc7, 0xef, 0xff, 0xab, 0xc6, 0xec, 0xff, 0xa0, 0xc0, 0xe7, 0xff, 0x9e, 0xbe, 0xe6, 0xff, 0x95, 0xb6, 0xdf, 0xff, 0x91, 0xb4, 0xe0, 0xff, 0x92, 0xb7, 0xe5, 0xff, 0x8b, 0xb2, 0xe2, 0xff, 0x7d, 0xa6, 0xd7, 0xff, 0x81, 0xa3, 0xd9, 0xff, 0x82, 0xa5, 0xd5, 0xff, 0x67, 0x93, 0xb4, 0xff, 0x45, 0x6f, 0x8d, 0xff, 0x2f, 0x53, 0x7c, 0xff, 0x30, 0x48, 0x7f, 0xff, 0x27, 0x3a, 0x64, 0xff, 0x2f, 0x4a, 0x53, 0xff, 0x7e, 0x9c, 0x8c, 0xff, 0x98, 0xb3, 0x9e, 0xff, 0x9c, 0xb3, 0x9b, 0xff, 0x99, 0xae, 0x92, 0xff, 0x90, 0xa3, 0x88, 0xff, 0x82, 0x97, 0x7c, 0xff, 0x70, 0x86, 0x6d, 0xff, 0x5d, 0x75, 0x5e, 0xff, 0x4e, 0x6a, 0x5b, 0xff, 0x49, 0x65, 0x57, 0xff, 0x49, 0x62, 0x55, 0xff, 0x49, 0x63, 0x55, 0xff, 0x49, 0x62, 0x54, 0xff, 0x49, 0x62, 0x54, 0xff, 0x49, 0x62, 0x54, 0xff, 0x48, 0x61, 0x53, 0xff, 0x48, 0x61, 0x53, 0xff, 0x46, 0x5f, 0x51, 0xff, 0x46, 0x5f, 0x51, 0xff, 0x46, 0x5f, 0x51, 0xff, 0x46, 0x5f, 0x51, 0xff, 0x44, 0x5d, 0x4f, 0xff, 0x43, 0x5c, 0x4e, 0xff, 0x42, 0x5b, 0x4e, 0xff, 0x44, 0x5d, 0x4f, 0xff, 0x46, 0x5f, 0x51, 0xff, 0x41, 0x5a, 0x4c, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3e, 0x57, 0x49, 0xff, 0x3e, 0x57, 0x4a, 0xff, 0x3f, 0x57, 0x4a, 0xff, 0x3e, 0x57, 0x49, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x4a, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x02, 0x01, 0xff, 0x04, 0x03, 0x02, 0xff, 0x08, 0x04, 0x04, 0xff, 0x0c, 0x05, 0x06, 0xff, 0x0e, 0x05, 0x04, 0xff, 0x0f, 0x08, 0x03, 0xff, 0x11, 0x0e, 0x05, 0xff, 0x18, 0x15, 0x09, 0xff, 0x1e, 0x20, 0x0e, 0xff, 0x2b, 0x29, 0x19, 0xff, 0x37, 0x2f, 0x22, 0xff, 0x41, 0x39, 0x28, 0xff, 0x3a, 0x39, 0x2a, 0xff, 0x20, 0x28, 0x28, 0xff, 0x12, 0x24, 0x3d, 0xff, 0x15, 0x2a, 0x58, 0xff, 0x1a, 0x38, 0x6f, 0xff, 0x45, 0x64, 0x9c, 0xff, 0x6a, 0x89, 0xbf, 0xff, 0x85, 0xa6, 0xd8, 0xff, 0x89, 0xad, 0xdb, 0xff, 0x89, 0xad, 0xdc, 0xff, 0x8b, 0xae, 0xe2, 0xff, 0x87, 0xa9, 0xdc, 0xff, 0x92, 0xac, 0xda, 0xff, 0xa4, 0xbd, 0xe4, 0xff, 0xa4, 0xc3, 0xe4, 0xff, 0x92, 0xb0, 0xdb, 0xff, 0x68, 0x86, 0xc4, 0xff, 0x3b, 0x59, 0xa9, 0xff, 0x36, 0x53, 0xa2, 0xff, 0x32, 0x49, 0x95, 0xff, 0x61, 0x7a, 0xbd, 0xff, 0x96, 0xad, 0xe8, 0xff, 0xa8, 0xc0, 0xec, 0xff, 0xb3, 0xcb, 0xed, 0xff, 0xbc, 0xd1, 0xf0, 0xff, 0xb3, 0xc9, 0xea, 0xff, 0xa3, 0xbc, 0xe2, 0xff, 0x79, 0x94, 0xc6, 0xff, 0x46, 0x5f, 0xa0, 0xff, 0x39, 0x55, 0x95, 0xff, 0x3f, 0x60, 0x9d, 0xff, 0x52, 0x73, 0xac, 0xff, 0x7f, 0x9f, 0xd3, 0xff, 0x9a, 0xb9, 0xe7, 0xff, 0xa2, 0xbe, 0xe5, 0xff, 0xa6, 0xc3, 0xe8, 0xff, 0xa7, 0xc7, 0xf0, 0xff, 0x97, 0xb8, 0xe2, 0xff, 0x96, 0xb8, 0xe3, 0xff, 0x8e, 0xb3, 0xde, 0xff, 0x8b, 0xb3, 0xe0, 0xff, 0x7a, 0xa1, 0xce, 0xff, 0x7c, 0xa4, 0xd2, 0xff, 0x85, 0xa8, 0xd7, 0xff, 0x7c, 0x9e, 0xca, 0xff, 0x59, 0x7f, 0xa7, 0xff, 0x3d, 0x61, 0x8a, 0xff, 0x29, 0x48, 0x7b, 0xff, 0x38, 0x51, 0x82, 0xff, 0x25, 0x3c, 0x57, 0xff, 0x43, 0x60, 0x61, 0xff, 0x8e, 0xac, 0x9a, 0xff, 0x9b, 0xb6, 0x9f, 0xff, 0x9c, 0xb4, 0x9c, 0xff, 0x98, 0xac, 0x92, 0xff, 0x91, 0xa3, 0x88, 0xff, 0x81, 0x96, 0x7b, 0xff, 0x6f, 0x86, 0x6c, 0xff, 0x5e, 0x75, 0x5e, 0xff, 0x4f, 0x6a, 0x5b, 0xff, 0x4a, 0x64, 0x57, 0xff, 0x49, 0x63, 0x55, 0xff, 0x49, 0x63, 0x55, 0xff, 0x4a, 0x63, 0x55, 0xff, 0x49, 0x62, 0x54, 0xff, 0x49, 0x62, 0x54, 0xff, 0x49, 0x62, 0x54, 0xff, 0x49, 0x62, 0x53, 0xff, 0x47, 0x60, 0x51, 0xff, 0x46, 0x60, 0x50, 0xff, 0x46, 0x60, 0x50, 0xff, 0x45, 0x5f, 0x4f, 0xff, 0x44, 0x5d, 0x4e, 0xff, 0x44, 0x5e, 0x4e, 0xff, 0x42, 0x5c, 0x4d, 0xff, 0x48, 0x61, 0x53, 0xff, 0x4f, 0x68, 0x5a, 0xff, 0x44, 0x5d, 0x4f, 0xff, 0x3e, 0x57, 0x49, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3d, 0x57, 0x49, 0xff, 0x3f, 0x57, 0x49, 0xff, 0x41, 0x57, 0x49, 0xff, 0x3e, 0x56, 0x48, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0xe7, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x02, 0x02, 0xff, 0x05, 0x03, 0x02, 0xff, 0x07, 0x04, 0x02, 0xff, 0x0d, 0x06, 0x04, 0xff, 0x10, 0x05, 0x06, 0xff, 0x15, 0x0a, 0x06, 0xff, 0x18, 0x0f, 0x06, 0xff, 0x18, 0x12, 0x07, 0xff, 0x1e, 0x1a, 0x0a, 0xff, 0x29, 0x22, 0x13, 0xff, 0x35, 0x2c, 0x20, 0xff, 0x3d, 0x37, 0x26, 0xff, 0x43, 0x3f, 0x25, 0xff, 0x46, 0x42, 0x2c, 0xff, 0x30, 0x32, 0x2c, 0xff, 0x17, 0x22, 0x38, 0xff, 0x16, 0x29, 0x54, 0xff, 0x17, 0x35, 0x69, 0xff, 0x3a, 0x58, 0x90, 0xff, 0x65, 0x83, 0xba, 0xff, 0x80, 0xa2, 0xd3, 0xff, 0x7e, 0xa3, 0xcd, 0xff, 0x81, 0xa7, 0xd3, 0xff, 0x87, 0xab, 0xdf, 0xff, 0x85, 0xa6, 0xde, 0xff, 0x8c, 0xae, 0xdd, 0xff, 0x90, 0xb3, 0xdd, 0xff, 0x91, 0xba, 0xdf, 0xff, 0x86, 0xad, 0xda, 0xff, 0x75, 0x96, 0xd2, 0xff, 0x48, 0x67, 0xb6, 0xff, 0x2b, 0x49, 0x9d, 0xff, 0x1e, 0x39, 0x8b, 0xff, 0x23, 0x3b, 0x88, 0xff, 0x53, 0x68, 0xae, 0xff, 0x7c, 0x92, 0xce, 0xff, 0x98, 0xb2, 0xe4, 0xff, 0x9b, 0xb9, 0xe7, 0xff, 0x8f, 0xab, 0xdd, 0xff, 0x64, 0x7e, 0xb3, 0xff, 0x3c, 0x53, 0x97, 0xff, 0x43, 0x58, 0xad, 0xff, 0x3a, 0x52, 0xa4, 0xff, 0x47, 0x63, 0xb0, 0xff, 0x76, 0x96, 0xd8, 0xff, 0x93, 0xb4, 0xea, 0xff, 0x93, 0xb3, 0xe4, 0xff, 0x99, 0xb9, 0xe2, 0xff, 0x9d, 0xbe, 0xe3, 0xff, 0x9c, 0xbf, 0xe6, 0xff, 0x98, 0xba, 0xe4, 0xff, 0x97, 0xba, 0xe5, 0xff, 0x92, 0xb7, 0xe3, 0xff, 0x89, 0xb0, 0xdc, 0xff, 0x7b, 0xa2, 0xcd, 0xff, 0x7e, 0xa6, 0xd2, 0xff, 0x83, 0xa7, 0xcf, 0xff, 0x76, 0x98, 0xc0, 0xff, 0x4c, 0x6e, 0x9c, 0xff, 0x3a, 0x58, 0x8d, 0xff, 0x35, 0x4f, 0x88, 0xff, 0x35, 0x4e, 0x77, 0xff, 0x20, 0x3a, 0x48, 0xff, 0x5e, 0x7c, 0x76, 0xff, 0x97, 0xb5, 0xa1, 0xff, 0x9b, 0xb8, 0x9e, 0xff, 0x9e, 0xb5, 0x9c, 0xff, 0x9b, 0xaf, 0x94, 0xff, 0x93, 0xa7, 0x8a, 0xff, 0x83, 0x98, 0x7d, 0xff, 0x6f, 0x86, 0x6e, 0xff, 0x5e, 0x76, 0x60, 0xff, 0x51, 0x6a, 0x5b, 0xff, 0x4a, 0x64, 0x57, 0xff, 0x49, 0x63, 0x54, 0xff, 0x49, 0x62, 0x54, 0xff, 0x4a, 0x63, 0x55, 0xff, 0x4a, 0x63, 0x55, 0xff, 0x4a, 0x62, 0x55, 0xff, 0x49, 0x62, 0x53, 0xff, 0x49, 0x63, 0x53, 0xff, 0x47, 0x62, 0x51, 0xff, 0x47, 0x61, 0x51, 0xff, 0x47, 0x61, 0x51, 0xff, 0x47, 0x61, 0x51, 0xff, 0x45, 0x5f, 0x4f, 0xff, 0x45, 0x60, 0x4f, 0xff, 0x41, 0x5c, 0x4b, 0xff, 0x44, 0x5d, 0x4f, 0xff, 0x45, 0x5e, 0x50, 0xff, 0x41, 0x5a, 0x4c, 0xff, 0x41, 0x5a, 0x4c, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3d, 0x57, 0x49, 0xff, 0x3e, 0x57, 0x48, 0xff, 0x40, 0x57, 0x47, 0xe7, 0x33, 0x66, 0x33, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x87, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x02, 0xff, 0x05, 0x03, 0x01, 0xff, 0x08, 0x06, 0x00, 0xff, 0x0e, 0x09, 0x03, 0xff, 0x13, 0x0a, 0x06, 0xff, 0x1a, 0x10, 0x08, 0xff, 0x1e, 0x14, 0x0a, 0xff, 0x1e, 0x17, 0x0a, 0xff, 0x23, 0x1f, 0x0f, 0xff, 0x2e, 0x27, 0x15, 0xff, 0x38, 0x32, 0x22, 0xff, 0x41, 0x3e, 0x2a, 0xff, 0x4a, 0x48, 0x2c, 0xff, 0x50, 0x4a, 0x30, 0xff, 0x41, 0x3e, 0x32, 0xff, 0x20, 0x27, 0x31, 0xff, 0x15, 0x26, 0x46, 0xff, 0x12, 0x2d, 0x5d, 0xff, 0x2e, 0x48, 0x80, 0xff, 0x5e, 0x78, 0xb1, 0xff, 0x70, 0x91, 0xc5, 0xff, 0x78, 0x9b, 0xc8, 0xff, 0x7e, 0xa6, 0xd1, 0xff, 0x82, 0xaa, 0xd8, 0xff, 0x8c, 0xac, 0xe2, 0xff, 0x8c, 0xac, 0xdf, 0xff, 0x8b, 0xb1, 0xdb, 0xff, 0x8b, 0xb2, 0xdc, 0xff, 0x83, 0xab, 0xd9, 0xff, 0x76, 0x9a, 0xd6, 0xff, 0x66, 0x86, 0xce, 0xff, 0x4f, 0x6e, 0xbd, 0xff, 0x38, 0x5a, 0xa7, 0xff, 0x2a, 0x4c, 0x98, 0xff, 0x28, 0x4b, 0x90, 0xff, 0x38, 0x5a, 0x94, 0xff, 0x56, 0x78, 0xac, 0xff, 0x65, 0x8a, 0xbb, 0xff, 0x5b, 0x7f, 0xb4, 0xff, 0x4b, 0x6e, 0xa6, 0xff, 0x62, 0x81, 0xc0, 0xff, 0x7c, 0x96, 0xdb, 0xff, 0x75, 0x91, 0xd3, 0xff, 0x78, 0x97, 0xd7, 0xff, 0x7f, 0xa0, 0xdc, 0xff, 0x8e, 0xaf, 0xe4, 0xff, 0x91, 0xb1, 0xe2, 0xff, 0x95, 0xb4, 0xe1, 0xff, 0x92, 0xb4, 0xdb, 0xff, 0x94, 0xb9, 0xde, 0xff, 0x9a, 0xbe, 0xe5, 0xff, 0x95, 0xb7, 0xe2, 0xff, 0x90, 0xb2, 0xe0, 0xff, 0x8d, 0xb2, 0xdf, 0xff, 0x89, 0xb0, 0xdc, 0xff, 0x7e, 0xa5, 0xd1, 0xff, 0x74, 0x98, 0xc4, 0xff, 0x5f, 0x80, 0xad, 0xff, 0x43, 0x65, 0x94, 0xff, 0x3c, 0x5b, 0x8e, 0xff, 0x38, 0x53, 0x84, 0xff, 0x24, 0x3c, 0x5f, 0xff, 0x2d, 0x46, 0x4f, 0xff, 0x83, 0x9f, 0x92, 0xff, 0x99, 0xb8, 0xa0, 0xff, 0x9c, 0xb8, 0x9f, 0xff, 0x9d, 0xb3, 0x99, 0xff, 0x9c, 0xb0, 0x92, 0xff, 0x94, 0xa9, 0x89, 0xff, 0x83, 0x99, 0x7b, 0xff, 0x6e, 0x87, 0x6d, 0xff, 0x5d, 0x77, 0x62, 0xff, 0x53, 0x6c, 0x5d, 0xff, 0x4c, 0x64, 0x57, 0xff, 0x49, 0x62, 0x54, 0xff, 0x4a, 0x63, 0x55, 0xff, 0x4a, 0x63, 0x55, 0xff, 0x4a, 0x63, 0x55, 0xff, 0x4a, 0x62, 0x55, 0xff, 0x49, 0x62, 0x53, 0xff, 0x48, 0x62, 0x52, 0xff, 0x48, 0x62, 0x52, 0xff, 0x47, 0x61, 0x51, 0xff, 0x47, 0x61, 0x51, 0xff, 0x45, 0x5f, 0x4f, 0xff, 0x44, 0x5e, 0x4e, 0xff, 0x44, 0x5e, 0x4d, 0xff, 0x41, 0x5b, 0x4b, 0xff, 0x3f, 0x58, 0x4b, 0xff, 0x42, 0x5b, 0x4d, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3e, 0x57, 0x49, 0xff, 0x3e, 0x57, 0x48, 0xff, 0x3e, 0x55, 0x45, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x02, 0x00, 0x00, 0xfe, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x02, 0xff, 0x06, 0x04, 0x02, 0xff, 0x0b, 0x07, 0x03, 0xff, 0x12, 0x0c, 0x06, 0xff, 0x1b, 0x12, 0x0a, 0xff, 0x1f, 0x15, 0x0a, 0xff, 0x20, 0x18, 0x09, 0xff, 0x24, 0x1c, 0x0c, 0xff, 0x28, 0x23, 0x11, 0xff, 0x31, 0x2b, 0x19, 0xff, 0x3c, 0x37, 0x25, 0xff, 0x47, 0x44, 0x2f, 0xff, 0x52, 0x4f, 0x32, 0xff, 0x56, 0x50, 0x31, 0xff, 0x51, 0x4d, 0x38, 0xff, 0x2c, 0x2f, 0x2e, 0xff, 0x19, 0x23, 0x34, 0xff, 0x1b, 0x30, 0x59, 0xff, 0x1f, 0x33, 0x69, 0xff, 0x45, 0x5c, 0x96, 0xff, 0x68, 0x86, 0xbd, 0xff, 0x6e, 0x91, 0xc0, 0xff, 0x80, 0xa7, 0xd2, 0xff, 0x80, 0xa7, 0xd4, 0xff, 0x82, 0xa3, 0xd6, 0xff, 0x84, 0xa5, 0xdc, 0xff, 0x8b, 0xb1, 0xe0, 0xff, 0x8a, 0xb2, 0xde, 0xff, 0x7a, 0xa2, 0xd3, 0xff, 0x73, 0x98, 0xd3, 0xff, 0x74, 0x98, 0xda, 0xff, 0x74, 0x98, 0xdd, 0xff, 0x66, 0x8c, 0xd2, 0xff, 0x56, 0x7f, 0xca, 0xff, 0x4a, 0x73, 0xb7, 0xff, 0x51, 0x79, 0xb4, 0xff, 0x50, 0x78, 0xac, 0xff, 0x56, 0x7f, 0xb0, 0xff, 0x6c, 0x95, 0xca, 0xff, 0x7a, 0xa2, 0xda, 0xff, 0x81, 0xa5, 0xdd, 0xff, 0x8a, 0xa9, 0xdd, 0xff, 0x85, 0xa7, 0xda, 0xff, 0x86, 0xaa, 0xdd, 0xff, 0x86, 0xaa, 0xde, 0xff, 0x8b, 0xaf, 0xe1, 0xff, 0x90, 0xb2, 0xe1, 0xff, 0x91, 0xb2, 0xdf, 0xff, 0x92, 0xb5, 0xdd, 0xff, 0x92, 0xb7, 0xdc, 0xff, 0x97, 0xbb, 0xe2, 0xff, 0x95, 0xb9, 0xe0, 0xff, 0x8d, 0xb1, 0xda, 0xff, 0x8a, 0xb0, 0xda, 0xff, 0x82, 0xaa, 0xd5, 0xff, 0x7d, 0xa5, 0xd1, 0xff, 0x7b, 0xa0, 0xd0, 0xff, 0x4a, 0x6d, 0x9d, 0xff, 0x3e, 0x60, 0x8d, 0xff, 0x32, 0x4f, 0x7c, 0xff, 0x35, 0x4d, 0x77, 0xff, 0x1b, 0x32, 0x4d, 0xff, 0x4e, 0x66, 0x67, 0xff, 0x99, 0xb6, 0xa1, 0xff, 0x9b, 0xb8, 0xa2, 0xff, 0x9b, 0xb6, 0xa1, 0xff, 0x9e, 0xb4, 0x9a, 0xff, 0x9c, 0xb1, 0x93, 0xff, 0x93, 0xa8, 0x86, 0xff, 0x81, 0x98, 0x77, 0xff, 0x6e, 0x87, 0x6a, 0xff, 0x5e, 0x79, 0x60, 0xff, 0x51, 0x6a, 0x5b, 0xff, 0x4b, 0x64, 0x57, 0xff, 0x4b, 0x64, 0x56, 0xff, 0x4a, 0x63, 0x55, 0xff, 0x4a, 0x63, 0x55, 0xff, 0x4a, 0x63, 0x55, 0xff, 0x49, 0x62, 0x55, 0xff, 0x49, 0x62, 0x54, 0xff, 0x49, 0x63, 0x53, 0xff, 0x48, 0x62, 0x52, 0xff, 0x47, 0x61, 0x51, 0xff, 0x46, 0x60, 0x50, 0xff, 0x45, 0x5f, 0x4f, 0xff, 0x46, 0x60, 0x50, 0xff, 0x41, 0x5b, 0x4b, 0xff, 0x4d, 0x67, 0x57, 0xff, 0x47, 0x60, 0x52, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3e, 0x57, 0x49, 0xff, 0x3e, 0x56, 0x48, 0xfe, 0x41, 0x57, 0x48, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x01, 0xb4, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x02, 0x02, 0xff, 0x06, 0x04, 0x03, 0xff, 0x0b, 0x07, 0x02, 0xff, 0x13, 0x0e, 0x05, 0xff, 0x1e, 0x16, 0x09, 0xff, 0x21, 0x19, 0x08, 0xff, 0x25, 0x1d, 0x0a, 0xff, 0x28, 0x21, 0x0e, 0xff, 0x2c, 0x26, 0x11, 0xff, 0x33, 0x2f, 0x1c, 0xff, 0x3e, 0x3b, 0x29, 0xff, 0x4e, 0x4b, 0x34, 0xff, 0x5a, 0x55, 0x37, 0xff, 0x5c, 0x55, 0x34, 0xff, 0x5a, 0x54, 0x39, 0xff, 0x48, 0x46, 0x39, 0xff, 0x22, 0x26, 0x27, 0xff, 0x21, 0x32, 0x50, 0xff, 0x1f, 0x31, 0x61, 0xff, 0x25, 0x3a, 0x71, 0xff, 0x4b, 0x68, 0x9e, 0xff, 0x65, 0x88, 0xb6, 0xff, 0x76, 0x9e, 0xc9, 0xff, 0x7c, 0xa4, 0xcf, 0xff, 0x82, 0xa5, 0xd5, 0xff, 0x88, 0xab, 0xe4, 0xff, 0x84, 0xad, 0xdc, 0xff, 0x81, 0xad, 0xd7, 0xff, 0x75, 0xa0, 0xce, 0xff, 0x6e, 0x95, 0xcf, 0xff, 0x74, 0x9b, 0xda, 0xff, 0x70, 0x99, 0xd4, 0xff, 0x68, 0x95, 0xce, 0xff, 0x5d, 0x88, 0xcb, 0xff, 0x60, 0x8a, 0xc6, 0xff, 0x7a, 0xa3, 0xd8, 0xff, 0x86, 0xaf, 0xdf, 0xff, 0x7e, 0xa7, 0xd2, 0xff, 0x83, 0xab, 0xda, 0xff, 0x8a, 0xb2, 0xe3, 0xff, 0x88, 0xaf, 0xdc, 0xff, 0x8d, 0xb1, 0xd5, 0xff, 0x89, 0xae, 0xd7, 0xff, 0x8a, 0xaf, 0xd9, 0xff, 0x88, 0xaf, 0xdb, 0xff, 0x8b, 0xb4, 0xe0, 0xff, 0x8c, 0xb1, 0xdd, 0xff, 0x8e, 0xb0, 0xdd, 0xff, 0x90, 0xb2, 0xdb, 0xff, 0x8c, 0xaf, 0xd4, 0xff, 0x90, 0xb6, 0xdb, 0xff, 0x91, 0xb7, 0xdb, 0xff, 0x8d, 0xb4, 0xd8, 0xff, 0x83, 0xaa, 0xd0, 0xff, 0x72, 0x9a, 0xc5, 0xff, 0x80, 0xa7, 0xd5, 0xff, 0x74, 0x99, 0xce, 0xff, 0x49, 0x6d, 0xa2, 0xff, 0x34, 0x56, 0x82, 0xff, 0x35, 0x50, 0x79, 0xff, 0x33, 0x4b, 0x6d, 0xff, 0x23, 0x3a, 0x4f, 0xff, 0x76, 0x8c, 0x88, 0xff, 0xa0, 0xba, 0xa0, 0xff, 0x9b, 0xb7, 0xa1, 0xff, 0x9b, 0xb5, 0xa2, 0xff, 0x9e, 0xb3, 0x99, 0xff, 0x9b, 0xb0, 0x90, 0xff, 0x91, 0xa6, 0x85, 0xff, 0x81, 0x97, 0x79, 0xff, 0x6f, 0x88, 0x6c, 0xff, 0x5e, 0x78, 0x5e, 0xff, 0x51, 0x6b, 0x5a, 0xff, 0x4c, 0x65, 0x57, 0xff, 0x4e, 0x68, 0x58, 0xff, 0x53, 0x6d, 0x5d, 0xff, 0x4b, 0x65, 0x55, 0xff, 0x4a, 0x64, 0x54, 0xff, 0x4a, 0x64, 0x54, 0xff, 0x49, 0x63, 0x53, 0xff, 0x48, 0x62, 0x52, 0xff, 0x48, 0x62, 0x52, 0xff, 0x47, 0x61, 0x51, 0xff, 0x47, 0x60, 0x50, 0xff, 0x45, 0x5f, 0x4f, 0xff, 0x45, 0x5f, 0x4f, 0xff, 0x42, 0x5c, 0x4c, 0xff, 0x4b, 0x65, 0x55, 0xff, 0x45, 0x5e, 0x50, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3e, 0x57, 0x49, 0xff, 0x3f, 0x57, 0x47, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x40, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x02, 0x02, 0xff, 0x07, 0x03, 0x03, 0xff, 0x0c, 0x06, 0x03, 0xff, 0x14, 0x0e, 0x04, 0xff, 0x1d, 0x17, 0x07, 0xff, 0x24, 0x1c, 0x09, 0xff, 0x27, 0x1f, 0x0a, 0xff, 0x29, 0x24, 0x0e, 0xff, 0x2c, 0x28, 0x14, 0xff, 0x36, 0x32, 0x1e, 0xff, 0x42, 0x3f, 0x2c, 0xff, 0x52, 0x51, 0x39, 0xff, 0x61, 0x5f, 0x40, 0xff, 0x69, 0x60, 0x3e, 0xff, 0x64, 0x5b, 0x3d, 0xff, 0x65, 0x60, 0x4f, 0xff, 0x3c, 0x3e, 0x39, 0xff, 0x1b, 0x26, 0x3d, 0xff, 0x23, 0x30, 0x5a, 0xff, 0x1c, 0x2f, 0x63, 0xff, 0x2d, 0x4b, 0x7f, 0xff, 0x58, 0x7d, 0xab, 0xff, 0x68, 0x91, 0xbc, 0xff, 0x76, 0x9c, 0xc9, 0xff, 0x86, 0xa7, 0xd9, 0xff, 0x78, 0x9f, 0xd4, 0xff, 0x7d, 0xa7, 0xd5, 0xff, 0x7c, 0xa8, 0xd1, 0xff, 0x6a, 0x97, 0xc3, 0xff, 0x6b, 0x94, 0xcb, 0xff, 0x73, 0x9d, 0xd6, 0xff, 0x66, 0x92, 0xc8, 0xff, 0x6a, 0x98, 0xcb, 0xff, 0x6c, 0x95, 0xcc, 0xff, 0x6d, 0x95, 0xc8, 0xff, 0x81, 0xaa, 0xd7, 0xff, 0x98, 0xc0, 0xe6, 0xff, 0x99, 0xc0, 0xe2, 0xff, 0x88, 0xaf, 0xd2, 0xff, 0x85, 0xa9, 0xd0, 0xff, 0xa1, 0xc5, 0xeb, 0xff, 0x90, 0xb6, 0xd5, 0xff, 0x8d, 0xb5, 0xd8, 0xff, 0x84, 0xad, 0xd5, 0xff, 0x82, 0xab, 0xd6, 0xff, 0x88, 0xad, 0xda, 0xff, 0x84, 0xa9, 0xd4, 0xff, 0x85, 0xa7, 0xd6, 0xff, 0x8a, 0xae, 0xd7, 0xff, 0x8b, 0xb0, 0xd2, 0xff, 0x88, 0xae, 0xd1, 0xff, 0x8c, 0xb2, 0xd4, 0xff, 0x8b, 0xb2, 0xd5, 0xff, 0x7b, 0xa4, 0xca, 0xff, 0x77, 0x9e, 0xca, 0xff, 0x7e, 0xa3, 0xd3, 0xff, 0x67, 0x8a, 0xbf, 0xff, 0x47, 0x6a, 0x9d, 0xff, 0x3c, 0x5b, 0x85, 0xff, 0x3d, 0x57, 0x7a, 0xff, 0x25, 0x3b, 0x5a, 0xff, 0x3e, 0x53, 0x66, 0xff, 0x8f, 0xa4, 0xa0, 0xff, 0x92, 0xad, 0x95, 0xff, 0x90, 0xad, 0x98, 0xff, 0x96, 0xb1, 0x9f, 0xff, 0x9c, 0xb2, 0x9a, 0xff, 0x99, 0xae, 0x90, 0xff, 0x90, 0xa2, 0x85, 0xff, 0x80, 0x96, 0x79, 0xff, 0x6f, 0x8a, 0x6d, 0xff, 0x5e, 0x79, 0x60, 0xff, 0x52, 0x6d, 0x5b, 0xff, 0x4b, 0x66, 0x56, 0xff, 0x4d, 0x67, 0x57, 0xff, 0x55, 0x70, 0x5f, 0xff, 0x4b, 0x66, 0x55, 0xff, 0x4a, 0x64, 0x54, 0xff, 0x4a, 0x64, 0x54, 0xff, 0x49, 0x63, 0x53, 0xff, 0x47, 0x62, 0x52, 0xff, 0x47, 0x62, 0x52, 0xff, 0x46, 0x61, 0x51, 0xff, 0x46, 0x61, 0x51, 0xff, 0x45, 0x60, 0x50, 0xff, 0x44, 0x5f, 0x4f, 0xff, 0x43, 0x5e, 0x4e, 0xff, 0x41, 0x5b, 0x4c, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x41, 0x5a, 0x4c, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3e, 0x57, 0x49, 0xff, 0x3f, 0x57, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x01, 0xcd, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x03, 0x02, 0xff, 0x08, 0x03, 0x05, 0xff, 0x0d, 0x04, 0x07, 0xff, 0x15, 0x0e, 0x07, 0xff, 0x1e, 0x17, 0x09, 0xff, 0x22, 0x1a, 0x07, 0xff, 0x25, 0x1f, 0x08, 0xff, 0x28, 0x23, 0x0b, 0xff, 0x2b, 0x25, 0x11, 0xff, 0x39, 0x32, 0x1e, 0xff, 0x47, 0x42, 0x2f, 0xff, 0x57, 0x54, 0x40, 0xff, 0x69, 0x65, 0x4f, 0xff, 0x74, 0x6f, 0x51, 0xff, 0x75, 0x6f, 0x52, 0xff, 0x69, 0x64, 0x52, 0xff, 0x36, 0x39, 0x31, 0xff, 0x0d, 0x15, 0x20, 0xff, 0x25, 0x30, 0x4d, 0xff, 0x22, 0x35, 0x61, 0xff, 0x1d, 0x3b, 0x6f, 0xff, 0x40, 0x63, 0x99, 0xff, 0x59, 0x81, 0xb1, 0xff, 0x6e, 0x94, 0xc4, 0xff, 0x7f, 0xa1, 0xd5, 0xff, 0x75, 0x9b, 0xce, 0xff, 0x7d, 0xa5, 0xd3, 0xff, 0x73, 0x9d, 0xc7, 0xff, 0x6d, 0x95, 0xc3, 0xff, 0x65, 0x8b, 0xc3, 0xff, 0x6e, 0x95, 0xce, 0xff, 0x72, 0x9d, 0xd2, 0xff, 0x6e, 0x9b, 0xcc, 0xff, 0x70, 0x99, 0xcd, 0xff, 0x73, 0x9a, 0xcd, 0xff, 0x7a, 0xa0, 0xcb, 0xff, 0x92, 0xb5, 0xdb, 0xff, 0xa1, 0xbf, 0xe6, 0xff, 0x9f, 0xc0, 0xe3, 0xff, 0x92, 0xb2, 0xd6, 0xff, 0x96, 0xb7, 0xde, 0xff, 0x8d, 0xb2, 0xd9, 0xff, 0x8f, 0xb5, 0xdc, 0xff, 0x85, 0xac, 0xd4, 0xff, 0x84, 0xab, 0xd7, 0xff, 0x80, 0xa8, 0xd4, 0xff, 0x82, 0xab, 0xd3, 0xff, 0x7e, 0xa6, 0xd1, 0xff, 0x88, 0xad, 0xd7, 0xff, 0x89, 0xad, 0xd0, 0xff, 0x87, 0xac, 0xcf, 0xff, 0x89, 0xad, 0xcf, 0xff, 0x88, 0xaf, 0xd1, 0xff, 0x82, 0xab, 0xd0, 0xff, 0x85, 0xac, 0xd8, 0xff, 0x6d, 0x93, 0xc7, 0xff, 0x52, 0x74, 0xa9, 0xff, 0x42, 0x62, 0x91, 0xff, 0x3a, 0x58, 0x7d, 0xff, 0x30, 0x48, 0x66, 0xff, 0x1d, 0x31, 0x4d, 0xff, 0x42, 0x54, 0x68, 0xff, 0x83, 0x96, 0x9a, 0xff, 0x87, 0xa0, 0x96, 0xff, 0x81, 0x9b, 0x8c, 0xff, 0x89, 0xa0, 0x93, 0xff, 0x94, 0xa7, 0x98, 0xff, 0x96, 0xa8, 0x93, 0xff, 0x90, 0xa3, 0x89, 0xff, 0x80, 0x96, 0x79, 0xff, 0x6f, 0x88, 0x6b, 0xff, 0x61, 0x7c, 0x62, 0xff, 0x55, 0x6e, 0x5f, 0xff, 0x4d, 0x67, 0x58, 0xff, 0x4a, 0x64, 0x55, 0xff, 0x4a, 0x64, 0x55, 0xff, 0x49, 0x63, 0x54, 0xff, 0x4a, 0x64, 0x54, 0xff, 0x4a, 0x64, 0x55, 0xff, 0x49, 0x63, 0x54, 0xff, 0x47, 0x62, 0x52, 0xff, 0x46, 0x61, 0x51, 0xff, 0x46, 0x61, 0x51, 0xff, 0x45, 0x60, 0x50, 0xff, 0x45, 0x60, 0x50, 0xff, 0x43, 0x5e, 0x4e, 0xff, 0x42, 0x5e, 0x4d, 0xff, 0x42, 0x5c, 0x4d, 0xff, 0x41, 0x5a, 0x4c, 0xff, 0x41, 0x5a, 0x4c, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3e, 0x57, 0x49, 0xff, 0x3b, 0x54, 0x48, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x51, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x03, 0x01, 0x01, 0xff, 0x04, 0x03, 0x02, 0xff, 0x07, 0x02, 0x06, 0xff, 0x0b, 0x04, 0x07, 0xff, 0x13, 0x0b, 0x06, 0xff, 0x1c, 0x13, 0x07, 0xff, 0x21, 0x1b, 0x08, 0xff, 0x24, 0x1f, 0x06, 0xff, 0x23, 0x1d, 0x07, 0xff, 0x2b, 0x21, 0x0f, 0xff, 0x38, 0x31, 0x1a, 0xff, 0x43, 0x41, 0x29, 0xff, 0x5a, 0x58, 0x44, 0xff, 0x6d, 0x69, 0x55, 0xff, 0x6f, 0x6c, 0x4f, 0xff, 0x5c, 0x54, 0x39, 0xff, 0x2c, 0x26, 0x14, 0xff, 0x09, 0x0a, 0x00, 0xff, 0x00, 0x07, 0x0a, 0xff, 0x18, 0x24, 0x39, 0xff, 0x23, 0x36, 0x60, 0xff, 0x1d, 0x39, 0x73, 0xff, 0x2e, 0x4e, 0x88, 0xff, 0x51, 0x77, 0xad, 0xff, 0x68, 0x8f, 0xc3, 0xff, 0x75, 0x9a, 0xcd, 0xff, 0x81, 0xa4, 0xd5, 0xff, 0x78, 0x9d, 0xca, 0xff, 0x6f, 0x96, 0xc2, 0xff, 0x73, 0x99, 0xc7, 0xff, 0x5d, 0x81, 0xbb, 0xff, 0x61, 0x85, 0xc0, 0xff, 0x7e, 0xa6, 0xdb, 0xff, 0x6c, 0x98, 0xca, 0xff, 0x66, 0x92, 0xc9, 0xff, 0x78, 0xa0, 0xd7, 0xff, 0x76, 0x99, 0xcb, 0xff, 0x8c, 0xaa, 0xd8, 0xff, 0xa6, 0xc1, 0xef, 0xff, 0x9c, 0xbc, 0xe3, 0xff, 0x8a, 0xad, 0xd2, 0xff, 0x9a, 0xbc, 0xdf, 0xff, 0xa1, 0xbe, 0xe0, 0xff, 0x9c, 0xbc, 0xe3, 0xff, 0x8d, 0xb1, 0xd9, 0xff, 0x82, 0xab, 0xd5, 0xff, 0x7f, 0xad, 0xd8, 0xff, 0x83, 0xaf, 0xd4, 0xff, 0x7e, 0xab, 0xd0, 0xff, 0x85, 0xab, 0xcf, 0xff, 0x89, 0xab, 0xcc, 0xff, 0x8c, 0xb2, 0xd1, 0xff, 0x86, 0xaf, 0xca, 0xff, 0x83, 0xab, 0xc8, 0xff, 0x86, 0xad, 0xd1, 0xff, 0x72, 0x99, 0xc5, 0xff, 0x54, 0x7e, 0xb3, 0xff, 0x49, 0x6a, 0xa0, 0xff, 0x40, 0x5c, 0x8a, 0xff, 0x31, 0x4e, 0x71, 0xff, 0x28, 0x40, 0x5b, 0xff, 0x1b, 0x2e, 0x49, 0xff, 0x1a, 0x2a, 0x41, 0xff, 0x42, 0x53, 0x5a, 0xff, 0x76, 0x8d, 0x85, 0xff, 0x82, 0x9b, 0x8d, 0xff, 0x81, 0x98, 0x8a, 0xff, 0x86, 0x99, 0x89, 0xff, 0x88, 0x9b, 0x84, 0xff, 0x81, 0x96, 0x7d, 0xff, 0x6f, 0x85, 0x6b, 0xff, 0x61, 0x77, 0x5e, 0xff, 0x59, 0x70, 0x5c, 0xff, 0x51, 0x67, 0x5a, 0xff, 0x4f, 0x66, 0x5a, 0xff, 0x4e, 0x65, 0x57, 0xff, 0x4b, 0x62, 0x55, 0xff, 0x4d, 0x63, 0x56, 0xff, 0x4d, 0x63, 0x56, 0xff, 0x4d, 0x63, 0x56, 0xff, 0x4c, 0x62, 0x55, 0xff, 0x48, 0x62, 0x52, 0xff, 0x47, 0x62, 0x51, 0xff, 0x47, 0x61, 0x51, 0xff, 0x46, 0x60, 0x50, 0xff, 0x46, 0x5f, 0x4f, 0xff, 0x45, 0x5f, 0x4f, 0xff, 0x44, 0x5e, 0x4d, 0xff, 0x42, 0x5c, 0x4d, 0xff, 0x41, 0x5a, 0x4c, 0xff, 0x41, 0x5a, 0x4c, 0xff, 0x40, 0x59, 0x4b, 0xff, 0x3f, 0x58, 0x4a, 0xff, 0x3e, 0x57, 0x49, 0xff, 0x3d, 0x56, 0x48, 0xff, 0x3b, 0x55, 0x48, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0xce, 0x03, 0x01, 0x01, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x02, 0x02, 0xff, 0x04, 0x02, 0x04, 0xff, 0x0a, 0x04, 0x05, 0xff, 0x12, 0x0b, 0x03, 0xff, 0x18, 0x0f, 0x01, 0xff, 0x32, 0x2a, 0x17, 0xff, 0x29, 0x24, 0x0e, 0xff, 0x1d, 0x1a, 0x06, 0xff, 0x1e, 0x1b, 0x0d, 0xff, 0x1f, 0x1b, 0x0c, 0xff, 0x23, 0x21, 0x11, 0xff, 0x2d, 0x2e, 0x1e, 0xff, 0x37, 0x38, 0x25, 0xff, 0x2f, 0x2a, 0x14, 0xff, 0x18, 0x11, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x07, 0x08, 0xff, 0x04, 0x08, 0x0f, 0xff, 0x09, 0x10, 0x20, 0xff, 0x19, 0x29, 0x49, 0xff, 0x1d, 0x36, 0x65, 0xff, 0x30, 0x4f, 0x82, 0xff, 0x55, 0x76, 0xac, 0xff, 0x63, 0x85, 0xbd, 0xff, 0x68, 0x89, 0xbe, 0xff, 0x71, 0x98, 0xc1, 0xff, 0x73, 0x9c, 0xc1, 0xff, 0x78, 0xa3, 0xca, 0xff, 0x68, 0x92, 0xbd, 0xff, 0x61, 0x8d, 0xbb, 0xff, 0x70, 0x9e, 0xce, 0xff, 0x69, 0x98, 0xc9, 0xff, 0x61, 0x94, 0xc2, 0xff, 0x6c, 0xa4, 0xcf, 0xff, 0x77, 0xaa, 0xdb, 0xff, 0x75, 0xa3, 0xd7, 0xff, 0x76, 0xa5, 0xd5, 0xff, 0x9a, 0xc8, 0xf2, 0xff, 0xa3, 0xce, 0xf4, 0xff, 0x9e, 0xc3, 0xe5, 0xff, 0x7d, 0xa3, 0xd6, 0xff, 0x61, 0x8d, 0xd9, 0xff, 0x6a, 0x91, 0xd9, 0xff, 0x7c, 0xa4, 0xe1, 0xff, 0x86, 0xaf, 0xe1, 0xff, 0x8a, 0xb4, 0xde, 0xff, 0x89, 0xb2, 0xd4, 0xff, 0x88, 0xb0, 0xcb, 0xff, 0x7e, 0xa1, 0xc5, 0xff, 0x70, 0x91, 0xbe, 0xff, 0x76, 0x9c, 0xc3, 0xff, 0x7e, 0xaa, 0xcb, 0xff, 0x83, 0xb0, 0xd2, 0xff, 0x7b, 0xa6, 0xcc, 0xff, 0x6a, 0x91, 0xbd, 0xff, 0x53, 0x7a, 0xac, 0xff, 0x47, 0x66, 0x94, 0xff, 0x34, 0x4e, 0x75, 0xff, 0x27, 0x43, 0x64, 0xff, 0x21, 0x36, 0x56, 0xff, 0x1e, 0x2d, 0x46, 0xff, 0x18, 0x27, 0x3a, 0xff, 0x0d, 0x1f, 0x32, 0xff, 0x2a, 0x42, 0x53, 0xff, 0x5d, 0x7a, 0x7e, 0xff, 0x7c, 0x95, 0x91, 0xff, 0x84, 0x96, 0x89, 0xff, 0x82, 0x90, 0x77, 0xff, 0x76, 0x84, 0x6a, 0xff, 0x60, 0x72, 0x59, 0xff, 0x4c, 0x64, 0x4f, 0xff, 0x45, 0x5f, 0x4f, 0xff, 0x46, 0x5d, 0x4d, 0xff, 0x4c, 0x61, 0x50, 0xff, 0x4c, 0x62, 0x51, 0xff, 0x4f, 0x65, 0x54, 0xff, 0x51, 0x65, 0x55, 0xff, 0x50, 0x63, 0x53, 0xff, 0x4f, 0x62, 0x52, 0xff, 0x4d, 0x61, 0x51, 0xff, 0x48, 0x63, 0x53, 0xff, 0x47, 0x63, 0x52, 0xff, 0x47, 0x61, 0x51, 0xff, 0x46, 0x60, 0x50, 0xff, 0x44, 0x5f, 0x4f, 0xff, 0x44, 0x5f, 0x4f, 0xff, 0x43, 0x5d, 0x4d, 0xff, 0x42, 0x5c, 0x4c, 0xff, 0x43, 0x5a, 0x4c, 0xff, 0x43, 0x5a, 0x4c, 0xff, 0x42, 0x59, 0x4b, 0xff, 0x41, 0x58, 0x4a, 0xff, 0x40, 0x57, 0x49, 0xff, 0x3f, 0x55, 0x47, 0xce, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x46, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x02, 0x01, 0x01, 0xff, 0x04, 0x03, 0x04, 0xff, 0x08, 0x04, 0x03, 0xff, 0x11, 0x0a, 0x02, 0xff, 0x1c, 0x12, 0x05, 0xff, 0x23, 0x19, 0x08, 0xff, 0x1f, 0x18, 0x07, 0xff, 0x17, 0x15, 0x07, 0xff, 0x08, 0x0b, 0x01, 0xff, 0x06, 0x04, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x02, 0x02, 0x00, 0xff, 0x09, 0x08, 0x00, 0xff, 0x07, 0x05, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x00, 0x05, 0x0c, 0xff, 0x00, 0x0f, 0x21, 0xff, 0x0b, 0x0f, 0x19, 0xff, 0x03, 0x09, 0x11, 0xff, 0x0a, 0x1a, 0x2d, 0xff, 0x12, 0x2b, 0x4a, 0xff, 0x23, 0x3f, 0x6a, 0xff, 0x41, 0x61, 0x93, 0xff, 0x5a, 0x7a, 0xb2, 0xff, 0x66, 0x86, 0xbe, 0xff, 0x67, 0x8e, 0xb6, 0xff, 0x75, 0xa0, 0xc3, 0xff, 0x7c, 0xa7, 0xcc, 0xff, 0x6f, 0x99, 0xc1, 0xff, 0x69, 0x95, 0xbd, 0xff, 0x62, 0x8e, 0xbd, 0xff, 0x6b, 0x98, 0xcc, 0xff, 0x6e, 0x99, 0xd3, 0xff, 0x6c, 0x95, 0xdb, 0xff, 0x52, 0x7a, 0xc9, 0xff, 0x45, 0x6c, 0xc2, 0xff, 0x3a, 0x62, 0xb9, 0xff, 0x45, 0x6d, 0xc0, 0xff, 0x73, 0x96, 0xeb, 0xff, 0x5f, 0x77, 0xcf, 0xff, 0x26, 0x4a, 0xa8, 0xff, 0x24, 0x5c, 0xbe, 0xff, 0x42, 0x6d, 0xc9, 0xff, 0x3d, 0x61, 0xb2, 0xff, 0x3e, 0x5c, 0xa1, 0xff, 0x49, 0x61, 0x9e, 0xff, 0x4e, 0x66, 0xa2, 0xff, 0x5e, 0x73, 0xaf, 0xff, 0x41, 0x5b, 0x95, 0xff, 0x32, 0x54, 0x8b, 0xff, 0x50, 0x76, 0xa8, 0xff, 0x74, 0x9d, 0xcb, 0xff, 0x6f, 0x9d, 0xc5, 0xff, 0x6a, 0x98, 0xbf, 0xff, 0x6a, 0x91, 0xbc, 0xff, 0x52, 0x75, 0xa3, 0xff, 0x3a, 0x57, 0x7e, 0xff, 0x2c, 0x46, 0x67, 0xff, 0x22, 0x3c, 0x60, 0xff, 0x17, 0x2d, 0x4f, 0xff, 0x2d, 0x3e, 0x54, 0xff, 0x1b, 0x2a, 0x40, 0xff, 0x12, 0x24, 0x45, 0xff, 0x05, 0x1c, 0x48, 0xff, 0x0e, 0x2b, 0x48, 0xff, 0x3a, 0x55, 0x63, 0xff, 0x53, 0x64, 0x69, 0xff, 0x54, 0x5e, 0x57, 0xff, 0x55, 0x60, 0x50, 0xff, 0x58, 0x67, 0x56, 0xff, 0x4b, 0x60, 0x52, 0xff, 0x38, 0x53, 0x48, 0xff, 0x3c, 0x52, 0x42, 0xff, 0x42, 0x56, 0x45, 0xff, 0x44, 0x59, 0x47, 0xff, 0x49, 0x5e, 0x4c, 0xff, 0x4a, 0x5d, 0x4c, 0xff, 0x47, 0x5a, 0x49, 0xff, 0x49, 0x5b, 0x4b, 0xff, 0x4c, 0x5f, 0x4f, 0xff, 0x48, 0x61, 0x52, 0xff, 0x48, 0x62, 0x52, 0xff, 0x47, 0x61, 0x51, 0xff, 0x46, 0x60, 0x50, 0xff, 0x46, 0x5d, 0x4e, 0xff, 0x45, 0x5e, 0x4e, 0xff, 0x42, 0x5c, 0x4c, 0xff, 0x41, 0x5b, 0x4b, 0xff, 0x43, 0x5a, 0x4c, 0xff, 0x43, 0x5a, 0x4c, 0xff, 0x42, 0x59, 0x4a, 0xff, 0x41, 0x58, 0x49, 0xff, 0x40, 0x57, 0x49, 0xff, 0x40, 0x56, 0x47, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xb4, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x07, 0x04, 0x05, 0xff, 0x08, 0x03, 0x04, 0xff, 0x0e, 0x06, 0x01, 0xff, 0x1a, 0x10, 0x06, 0xff, 0x1b, 0x11, 0x04, 0xff, 0x14, 0x0d, 0x01, 0xff, 0x0c, 0x0a, 0x02, 0xff, 0x07, 0x07, 0x01, 0xff, 0x06, 0x04, 0x00, 0xff, 0x03, 0x02, 0x00, 0xff, 0x06, 0x05, 0x01, 0xff, 0x0a, 0x06, 0x00, 0xff, 0x0a, 0x07, 0x00, 0xff, 0x05, 0x05, 0x02, 0xff, 0x03, 0x0b, 0x16, 0xff, 0x06, 0x17, 0x2f, 0xff, 0x0b, 0x14, 0x20, 0xff, 0x04, 0x0a, 0x13, 0xff, 0x02, 0x0c, 0x1d, 0xff, 0x0f, 0x1f, 0x36, 0xff, 0x19, 0x2d, 0x50, 0xff, 0x33, 0x4d, 0x7a, 0xff, 0x50, 0x73, 0xa9, 0xff, 0x5b, 0x80, 0xbb, 0xff, 0x65, 0x8d, 0xbc, 0xff, 0x6f, 0x97, 0xc0, 0xff, 0x7b, 0xa2, 0xc8, 0xff, 0x6f, 0x95, 0xbc, 0xff, 0x56, 0x78, 0xa3, 0xff, 0x3a, 0x57, 0x8f, 0xff, 0x2d, 0x44, 0x8e, 0xff, 0x2d, 0x41, 0x8e, 0xff, 0x2d, 0x3f, 0x89, 0xff, 0x29, 0x3d, 0x91, 0xff, 0x3e, 0x53, 0xb1, 0xff, 0x3c, 0x56, 0xb7, 0xff, 0x27, 0x45, 0xa7, 0xff, 0x38, 0x56, 0xbb, 0xff, 0x3a, 0x5a, 0xc8, 0xff, 0x3a, 0x54, 0xbf, 0xff, 0x40, 0x53, 0xad, 0xff, 0x2c, 0x40, 0x97, 0xff, 0x26, 0x37, 0x8b, 0xff, 0x3f, 0x4d, 0xa2, 0xff, 0x4a, 0x53, 0xab, 0xff, 0x44, 0x4d, 0xa6, 0xff, 0x3f, 0x43, 0xa5, 0xff, 0x4d, 0x62, 0xac, 0xff, 0x71, 0x9c, 0xc8, 0xff, 0x6f, 0x98, 0xc6, 0xff, 0x6f, 0x9b, 0xc6, 0xff, 0x64, 0x95, 0xbd, 0xff, 0x65, 0x94, 0xbc, 0xff, 0x5f, 0x88, 0xb2, 0xff, 0x3a, 0x5f, 0x8c, 0xff, 0x2e, 0x49, 0x6f, 0xff, 0x2a, 0x41, 0x65, 0xff, 0x11, 0x2a, 0x52, 0xff, 0x25, 0x3d, 0x5e, 0xff, 0x33, 0x46, 0x63, 0xff, 0x12, 0x23, 0x40, 0xff, 0x19, 0x2e, 0x50, 0xff, 0x17, 0x32, 0x5c, 0xff, 0x08, 0x23, 0x4c, 0xff, 0x0a, 0x24, 0x48, 0xff, 0x15, 0x2c, 0x49, 0xff, 0x1b, 0x2d, 0x41, 0xff, 0x17, 0x29, 0x35, 0xff, 0x28, 0x38, 0x3b, 0xff, 0x40, 0x4c, 0x4a, 0xff, 0x40, 0x4f, 0x49, 0xff, 0x3d, 0x4e, 0x41, 0xff, 0x3e, 0x4e, 0x40, 0xff, 0x42, 0x53, 0x45, 0xff, 0x3f, 0x52, 0x43, 0xff, 0x3a, 0x4e, 0x3f, 0xff, 0x3a, 0x4d, 0x3f, 0xff, 0x3d, 0x51, 0x42, 0xff, 0x42, 0x56, 0x47, 0xff, 0x43, 0x59, 0x4a, 0xff, 0x45, 0x5b, 0x4c, 0xff, 0x46, 0x5d, 0x4e, 0xff, 0x46, 0x5e, 0x4f, 0xff, 0x47, 0x5f, 0x4f, 0xff, 0x46, 0x5f, 0x4f, 0xff, 0x42, 0x5d, 0x4d, 0xff, 0x41, 0x5b, 0x4b, 0xff, 0x42, 0x5a, 0x4a, 0xff, 0x42, 0x59, 0x4a, 0xff, 0x41, 0x58, 0x49, 0xff, 0x41, 0x58, 0x49, 0xff, 0x3f, 0x56, 0x48, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x02, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x02, 0x01, 0xff, 0x05, 0x01, 0x02, 0xff, 0x08, 0x03, 0x03, 0xff, 0x0e, 0x07, 0x04, 0xff, 0x14, 0x0b, 0x03, 0xff, 0x15, 0x0c, 0x02, 0xff, 0x0e, 0x08, 0x00, 0xff, 0x0a, 0x06, 0x01, 0xff, 0x0b, 0x09, 0x04, 0xff, 0x08, 0x04, 0x00, 0xff, 0x08, 0x05, 0x01, 0xff, 0x0b, 0x09, 0x06, 0xff, 0x0a, 0x07, 0x02, 0xff, 0x0b, 0x08, 0x02, 0xff, 0x01, 0x04, 0x05, 0xff, 0x0b, 0x15, 0x26, 0xff, 0x10, 0x24, 0x43, 0xff, 0x06, 0x12, 0x24, 0xff, 0x04, 0x0a, 0x15, 0xff, 0x06, 0x0c, 0x17, 0xff, 0x10, 0x17, 0x24, 0xff, 0x13, 0x1e, 0x36, 0xff, 0x20, 0x34, 0x5a, 0xff, 0x38, 0x58, 0x8c, 0xff, 0x3e, 0x62, 0x9d, 0xff, 0x44, 0x70, 0xa8, 0xff, 0x60, 0x8b, 0xba, 0xff, 0x7a, 0xa3, 0xcb, 0xff, 0x62, 0x89, 0xaf, 0xff, 0x49, 0x69, 0x97, 0xff, 0x38, 0x4d, 0x90, 0xff, 0x13, 0x1b, 0x78, 0xff, 0x14, 0x17, 0x77, 0xff, 0x25, 0x26, 0x7b, 0xff, 0x29, 0x2b, 0x8a, 0xff, 0x22, 0x27, 0x8e, 0xff, 0x1b, 0x24, 0x8d, 0xff, 0x26, 0x36, 0x9f, 0xff, 0x49, 0x5c, 0xc7, 0xff, 0x3c, 0x54, 0xc9, 0xff, 0x3c, 0x45, 0xbd, 0xff, 0x50, 0x41, 0xb4, 0xff, 0x3e, 0x36, 0xa3, 0xff, 0x64, 0x5e, 0xc5, 0xff, 0x8c, 0x8d, 0xeb, 0xff, 0x85, 0x90, 0xe5, 0xff, 0x75, 0x80, 0xd2, 0xff, 0x55, 0x61, 0xb3, 0xff, 0x73, 0x8f, 0xcf, 0xff, 0x81, 0xaf, 0xdb, 0xff, 0x72, 0x9e, 0xcd, 0xff, 0x64, 0x95, 0xc1, 0xff, 0x5c, 0x8f, 0xb8, 0xff, 0x55, 0x84, 0xad, 0xff, 0x43, 0x6d, 0x99, 0xff, 0x29, 0x50, 0x7d, 0xff, 0x27, 0x42, 0x69, 0xff, 0x1e, 0x34, 0x5b, 0xff, 0x23, 0x3c, 0x67, 0xff, 0x3f, 0x57, 0x7e, 0xff, 0x27, 0x3b, 0x5e, 0xff, 0x10, 0x23, 0x47, 0xff, 0x15, 0x2c, 0x56, 0xff, 0x27, 0x47, 0x78, 0xff, 0x29, 0x45, 0x7d, 0xff, 0x1c, 0x37, 0x71, 0xff, 0x17, 0x36, 0x6b, 0xff, 0x18, 0x3a, 0x69, 0xff, 0x0d, 0x29, 0x4e, 0xff, 0x04, 0x16, 0x2c, 0xff, 0x1b, 0x21, 0x26, 0xff, 0x34, 0x34, 0x2d, 0xff, 0x37, 0x3e, 0x31, 0xff, 0x39, 0x43, 0x36, 0xff, 0x3b, 0x46, 0x39, 0xff, 0x39, 0x46, 0x39, 0xff, 0x34, 0x44, 0x37, 0xff, 0x35, 0x47, 0x39, 0xff, 0x38, 0x4a, 0x3c, 0xff, 0x39, 0x4b, 0x3d, 0xff, 0x3c, 0x4f, 0x40, 0xff, 0x3e, 0x53, 0x44, 0xff, 0x44, 0x59, 0x4a, 0xff, 0x45, 0x5b, 0x4c, 0xff, 0x43, 0x5e, 0x4e, 0xff, 0x44, 0x5e, 0x4e, 0xff, 0x42, 0x5e, 0x4e, 0xff, 0x41, 0x5b, 0x4c, 0xff, 0x42, 0x59, 0x4a, 0xff, 0x41, 0x58, 0x49, 0xff, 0x40, 0x57, 0x48, 0xff, 0x40, 0x56, 0x48, 0xfa, 0x3f, 0x59, 0x46, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x02, 0x01, 0x01, 0xff, 0x06, 0x02, 0x03, 0xff, 0x0b, 0x05, 0x07, 0xff, 0x10, 0x0a, 0x08, 0xff, 0x12, 0x0a, 0x05, 0xff, 0x10, 0x08, 0x03, 0xff, 0x0c, 0x06, 0x02, 0xff, 0x0c, 0x08, 0x05, 0xff, 0x0c, 0x09, 0x07, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0a, 0x06, 0x04, 0xff, 0x0c, 0x0a, 0x0b, 0xff, 0x0b, 0x09, 0x08, 0xff, 0x0b, 0x08, 0x04, 0xff, 0x00, 0x01, 0x03, 0xff, 0x0f, 0x19, 0x2e, 0xff, 0x18, 0x2c, 0x50, 0xff, 0x06, 0x13, 0x29, 0xff, 0x05, 0x0c, 0x18, 0xff, 0x0a, 0x10, 0x19, 0xff, 0x10, 0x15, 0x1f, 0xff, 0x0f, 0x17, 0x29, 0xff, 0x0e, 0x1f, 0x40, 0xff, 0x27, 0x43, 0x72, 0xff, 0x40, 0x62, 0x9b, 0xff, 0x33, 0x63, 0x9b, 0xff, 0x40, 0x71, 0xa2, 0xff, 0x63, 0x94, 0xbf, 0xff, 0x67, 0x97, 0xc0, 0xff, 0x74, 0x99, 0xce, 0xff, 0x6d, 0x84, 0xcf, 0xff, 0x40, 0x45, 0xaa, 0xff, 0x4b, 0x47, 0xb5, 0xff, 0x65, 0x61, 0xc8, 0xff, 0x70, 0x6c, 0xd7, 0xff, 0x6e, 0x69, 0xd8, 0xff, 0x66, 0x64, 0xce, 0xff, 0x53, 0x55, 0xb6, 0xff, 0x5b, 0x5e, 0xc0, 0xff, 0x4d, 0x51, 0xbb, 0xff, 0x76, 0x74, 0xd4, 0xff, 0xb2, 0xa8, 0xf3, 0xff, 0xa5, 0xa1, 0xf3, 0xff, 0x8c, 0x8b, 0xe2, 0xff, 0x82, 0x87, 0xdf, 0xff, 0x6c, 0x7a, 0xcf, 0xff, 0x5f, 0x71, 0xc5, 0xff, 0x54, 0x6a, 0xc0, 0xff, 0x6e, 0x91, 0xd1, 0xff, 0x74, 0x9e, 0xca, 0xff, 0x69, 0x94, 0xc4, 0xff, 0x62, 0x91, 0xc0, 0xff, 0x59, 0x88, 0xb5, 0xff, 0x50, 0x7b, 0xa7, 0xff, 0x34, 0x5b, 0x87, 0xff, 0x26, 0x4b, 0x77, 0xff, 0x22, 0x3e, 0x63, 0xff, 0x22, 0x39, 0x5f, 0xff, 0x49, 0x60, 0x90, 0xff, 0x39, 0x50, 0x7f, 0xff, 0x1e, 0x34, 0x5a, 0xff, 0x0b, 0x22, 0x47, 0xff, 0x15, 0x32, 0x5f, 0xff, 0x3e, 0x64, 0x97, 0xff, 0x48, 0x6b, 0xa3, 0xff, 0x3a, 0x5d, 0x9b, 0xff, 0x2f, 0x56, 0x94, 0xff, 0x2b, 0x55, 0x91, 0xff, 0x23, 0x47, 0x76, 0xff, 0x0d, 0x22, 0x3c, 0xff, 0x09, 0x0c, 0x0f, 0xff, 0x1a, 0x13, 0x05, 0xff, 0x1b, 0x19, 0x0d, 0xff, 0x1d, 0x1f, 0x14, 0xff, 0x13, 0x19, 0x0e, 0xff, 0x14, 0x1b, 0x10, 0xff, 0x25, 0x2d, 0x22, 0xff, 0x31, 0x3b, 0x2f, 0xff, 0x37, 0x43, 0x37, 0xff, 0x36, 0x45, 0x39, 0xff, 0x36, 0x48, 0x39, 0xff, 0x39, 0x4d, 0x3e, 0xff, 0x3f, 0x52, 0x43, 0xff, 0x42, 0x57, 0x48, 0xff, 0x41, 0x58, 0x49, 0xff, 0x42, 0x5a, 0x4b, 0xff, 0x42, 0x5b, 0x4b, 0xff, 0x43, 0x5b, 0x4d, 0xff, 0x45, 0x5a, 0x4b, 0xff, 0x44, 0x59, 0x4b, 0xff, 0x43, 0x57, 0x49, 0xff, 0x41, 0x55, 0x48, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x02, 0x00, 0x00, 0xdb, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x04, 0x01, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x05, 0x02, 0x02, 0xff, 0x09, 0x06, 0x04, 0xff, 0x0a, 0x06, 0x04, 0xff, 0x0d, 0x07, 0x05, 0xff, 0x11, 0x0b, 0x08, 0xff, 0x0e, 0x09, 0x05, 0xff, 0x0a, 0x04, 0x02, 0xff, 0x0c, 0x08, 0x05, 0xff, 0x0d, 0x08, 0x06, 0xff, 0x09, 0x04, 0x01, 0xff, 0x0a, 0x07, 0x05, 0xff, 0x0c, 0x0a, 0x0a, 0xff, 0x0c, 0x09, 0x07, 0xff, 0x0b, 0x07, 0x03, 0xff, 0x01, 0x00, 0x02, 0xff, 0x0a, 0x13, 0x25, 0xff, 0x1e, 0x31, 0x50, 0xff, 0x0e, 0x1e, 0x32, 0xff, 0x03, 0x0c, 0x1b, 0xff, 0x07, 0x0e, 0x1d, 0xff, 0x11, 0x18, 0x26, 0xff, 0x0d, 0x18, 0x2b, 0xff, 0x03, 0x13, 0x32, 0xff, 0x15, 0x2c, 0x55, 0xff, 0x3f, 0x5d, 0x8c, 0xff, 0x3b, 0x69, 0xa2, 0xff, 0x30, 0x62, 0x97, 0xff, 0x44, 0x77, 0xa7, 0xff, 0x5e, 0x92, 0xc2, 0xff, 0x6f, 0x9c, 0xd5, 0xff, 0x60, 0x81, 0xcc, 0xff, 0x40, 0x4f, 0xb2, 0xff, 0x39, 0x44, 0xa8, 0xff, 0x4f, 0x61, 0xb0, 0xff, 0x70, 0x7c, 0xce, 0xff, 0x84, 0x8d, 0xdb, 0xff, 0xa4, 0xaa, 0xed, 0xff, 0xb3, 0xb8, 0xf0, 0xff, 0xb0, 0xb4, 0xe6, 0xff, 0xa9, 0xa8, 0xdc, 0xff, 0xb5, 0xb4, 0xe9, 0xff, 0xb7, 0xc2, 0xf1, 0xff, 0x9d, 0xac, 0xe4, 0xff, 0x78, 0x8b, 0xc9, 0xff, 0x64, 0x7b, 0xc3, 0xff, 0x59, 0x73, 0xc3, 0xff, 0x52, 0x72, 0xbc, 0xff, 0x61, 0x86, 0xd4, 0xff, 0x6b, 0x93, 0xd1, 0xff, 0x6f, 0x97, 0xc4, 0xff, 0x68, 0x91, 0xc2, 0xff, 0x5d, 0x8c, 0xbb, 0xff, 0x5f, 0x8d, 0xba, 0xff, 0x4f, 0x78, 0xa5, 0xff, 0x33, 0x57, 0x83, 0xff, 0x28, 0x46, 0x73, 0xff, 0x1a, 0x32, 0x5b, 0xff, 0x3d, 0x57, 0x81, 0xff, 0x54, 0x71, 0xa0, 0xff, 0x34, 0x51, 0x80, 0xff, 0x1e, 0x37, 0x62, 0xff, 0x0a, 0x22, 0x4c, 0xff, 0x1b, 0x3c, 0x69, 0xff, 0x49, 0x73, 0xa5, 0xff, 0x55, 0x7f, 0xb1, 0xff, 0x55, 0x7f, 0xaf, 0xff, 0x4f, 0x7e, 0xb5, 0xff, 0x4d, 0x7c, 0xb5, 0xff, 0x49, 0x6f, 0x98, 0xff, 0x1e, 0x37, 0x4a, 0xff, 0x06, 0x0a, 0x06, 0xff, 0x18, 0x10, 0x00, 0xff, 0x13, 0x0f, 0x04, 0xff, 0x0f, 0x0c, 0x04, 0xff, 0x04, 0x04, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x08, 0x0c, 0x02, 0xff, 0x17, 0x1b, 0x12, 0xff, 0x27, 0x2c, 0x22, 0xff, 0x34, 0x3a, 0x30, 0xff, 0x33, 0x40, 0x33, 0xff, 0x37, 0x44, 0x37, 0xff, 0x39, 0x49, 0x3b, 0xff, 0x3b, 0x4c, 0x3e, 0xff, 0x3d, 0x50, 0x42, 0xff, 0x41, 0x54, 0x45, 0xff, 0x3f, 0x54, 0x46, 0xff, 0x3f, 0x57, 0x47, 0xff, 0x42, 0x58, 0x47, 0xff, 0x44, 0x5a, 0x49, 0xff, 0x43, 0x58, 0x49, 0xdb, 0x38, 0x55, 0x55, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x41, 0x02, 0x00, 0x00, 0xfe, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0xff, 0x01, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xff, 0x05, 0x01, 0x00, 0xff, 0x06, 0x02, 0x00, 0xff, 0x07, 0x03, 0x02, 0xff, 0x09, 0x04, 0x03, 0xff, 0x0a, 0x05, 0x04, 0xff, 0x0d, 0x08, 0x08, 0xff, 0x0b, 0x07, 0x03, 0xff, 0x08, 0x04, 0x00, 0xff, 0x0a, 0x05, 0x02, 0xff, 0x0d, 0x09, 0x06, 0xff, 0x0d, 0x08, 0x05, 0xff, 0x0a, 0x05, 0x02, 0xff, 0x0d, 0x08, 0x05, 0xff, 0x0d, 0x08, 0x05, 0xff, 0x0a, 0x06, 0x02, 0xff, 0x0a, 0x07, 0x06, 0xff, 0x0c, 0x09, 0x08, 0xff, 0x0b, 0x07, 0x02, 0xff, 0x0c, 0x06, 0x01, 0xff, 0x06, 0x03, 0x02, 0xff, 0x03, 0x0a, 0x18, 0xff, 0x1b, 0x2b, 0x45, 0xff, 0x10, 0x21, 0x35, 0xff, 0x00, 0x0b, 0x1e, 0xff, 0x02, 0x0c, 0x22, 0xff, 0x0e, 0x1b, 0x2f, 0xff, 0x12, 0x1e, 0x36, 0xff, 0x0a, 0x16, 0x31, 0xff, 0x07, 0x15, 0x33, 0xff, 0x27, 0x38, 0x60, 0xff, 0x39, 0x57, 0x92, 0xff, 0x38, 0x5d, 0x95, 0xff, 0x39, 0x64, 0x99, 0xff, 0x48, 0x74, 0xad, 0xff, 0x57, 0x83, 0xc2, 0xff, 0x53, 0x79, 0xc2, 0xff, 0x40, 0x5c, 0xb0, 0xff, 0x2a, 0x44, 0x9a, 0xff, 0x42, 0x5d, 0xb3, 0xff, 0x56, 0x68, 0xc4, 0xff, 0x64, 0x72, 0xc6, 0xff, 0x8b, 0x96, 0xdc, 0xff, 0xa1, 0xa9, 0xe6, 0xff, 0xa2, 0xab, 0xe4, 0xff, 0x9b, 0xa1, 0xdc, 0xff, 0x94, 0x99, 0xdf, 0xff, 0x8b, 0x96, 0xe5, 0xff, 0x74, 0x83, 0xd3, 0xff, 0x63, 0x79, 0xc9, 0xff, 0x57, 0x74, 0xbc, 0xff, 0x54, 0x7b, 0xb4, 0xff, 0x61, 0x8c, 0xb9, 0xff, 0x64, 0x97, 0xb5, 0xff, 0x5e, 0x8e, 0xb3, 0xff, 0x60, 0x8b, 0xbc, 0xff, 0x58, 0x81, 0xb3, 0xff, 0x5a, 0x86, 0xb8, 0xff, 0x51, 0x7c, 0xaf, 0xff, 0x37, 0x5f, 0x90, 0xff, 0x36, 0x55, 0x85, 0xff, 0x2b, 0x40, 0x6d, 0xff, 0x20, 0x39, 0x61, 0xff, 0x50, 0x70, 0x9b, 0xff, 0x4a, 0x6b, 0x9c, 0xff, 0x3a, 0x5a, 0x8e, 0xff, 0x31, 0x4a, 0x78, 0xff, 0x13, 0x2c, 0x57, 0xff, 0x1e, 0x40, 0x6a, 0xff, 0x4c, 0x78, 0xa3, 0xff, 0x5c, 0x8c, 0xb8, 0xff, 0x60, 0x90, 0xba, 0xff, 0x59, 0x8e, 0xbe, 0xff, 0x61, 0x91, 0xc0, 0xff, 0x68, 0x8e, 0xb1, 0xff, 0x28, 0x3b, 0x4e, 0xff, 0x07, 0x05, 0x00, 0xff, 0x1f, 0x12, 0x00, 0xff, 0x17, 0x13, 0x07, 0xff, 0x0f, 0x0d, 0x06, 0xff, 0x0e, 0x0a, 0x03, 0xff, 0x07, 0x04, 0x00, 0xff, 0x07, 0x06, 0x00, 0xff, 0x0b, 0x0a, 0x02, 0xff, 0x13, 0x11, 0x09, 0xff, 0x24, 0x23, 0x1a, 0xff, 0x2c, 0x34, 0x27, 0xff, 0x34, 0x3d, 0x30, 0xff, 0x37, 0x41, 0x34, 0xff, 0x35, 0x42, 0x35, 0xff, 0x37, 0x48, 0x3a, 0xff, 0x3a, 0x4c, 0x3e, 0xff, 0x3a, 0x4e, 0x3f, 0xff, 0x3b, 0x50, 0x40, 0xff, 0x3d, 0x52, 0x40, 0xff, 0x42, 0x56, 0x44, 0xfe, 0x42, 0x56, 0x46, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x8f, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xff, 0x07, 0x03, 0x01, 0xff, 0x09, 0x05, 0x05, 0xff, 0x0d, 0x09, 0x08, 0xff, 0x0e, 0x0a, 0x09, 0xff, 0x0a, 0x06, 0x06, 0xff, 0x0c, 0x08, 0x07, 0xff, 0x0e, 0x09, 0x09, 0xff, 0x0b, 0x07, 0x04, 0xff, 0x0a, 0x07, 0x01, 0xff, 0x0b, 0x07, 0x02, 0xff, 0x0a, 0x05, 0x02, 0xff, 0x0b, 0x06, 0x03, 0xff, 0x0b, 0x06, 0x02, 0xff, 0x0e, 0x09, 0x06, 0xff, 0x10, 0x0b, 0x08, 0xff, 0x0a, 0x05, 0x02, 0xff, 0x09, 0x07, 0x03, 0xff, 0x0b, 0x0a, 0x07, 0xff, 0x0c, 0x0a, 0x01, 0xff, 0x0f, 0x0a, 0x00, 0xff, 0x09, 0x05, 0x00, 0xff, 0x00, 0x03, 0x0a, 0xff, 0x14, 0x21, 0x35, 0xff, 0x11, 0x1f, 0x34, 0xff, 0x00, 0x0d, 0x21, 0xff, 0x01, 0x0e, 0x28, 0xff, 0x0b, 0x1e, 0x3d, 0xff, 0x1d, 0x2c, 0x4a, 0xff, 0x1a, 0x26, 0x3e, 0xff, 0x09, 0x13, 0x25, 0xff, 0x15, 0x1d, 0x38, 0xff, 0x2b, 0x39, 0x75, 0xff, 0x3a, 0x4e, 0x8d, 0xff, 0x33, 0x4f, 0x90, 0xff, 0x33, 0x55, 0x9a, 0xff, 0x40, 0x67, 0xac, 0xff, 0x46, 0x69, 0xb2, 0xff, 0x46, 0x66, 0xae, 0xff, 0x3b, 0x5b, 0xa6, 0xff, 0x41, 0x5c, 0xba, 0xff, 0x44, 0x5b, 0xbd, 0xff, 0x5a, 0x6e, 0xcd, 0xff, 0x77, 0x8a, 0xdd, 0xff, 0x7d, 0x92, 0xd7, 0xff, 0x7c, 0x93, 0xdc, 0xff, 0x75, 0x8d, 0xdd, 0xff, 0x75, 0x8a, 0xdd, 0xff, 0x72, 0x81, 0xd4, 0xff, 0x60, 0x72, 0xcb, 0xff, 0x58, 0x6d, 0xc9, 0xff, 0x56, 0x70, 0xc8, 0xff, 0x55, 0x75, 0xc0, 0xff, 0x60, 0x86, 0xbd, 0xff, 0x62, 0x89, 0xae, 0xff, 0x5d, 0x87, 0xad, 0xff, 0x58, 0x86, 0xb6, 0xff, 0x61, 0x8e, 0xbe, 0xff, 0x5c, 0x86, 0xba, 0xff, 0x49, 0x6e, 0xa5, 0xff, 0x35, 0x56, 0x8a, 0xff, 0x3c, 0x54, 0x84, 0xff, 0x23, 0x36, 0x63, 0xff, 0x3b, 0x59, 0x80, 0xff, 0x52, 0x79, 0xa3, 0xff, 0x43, 0x66, 0x97, 0xff, 0x3d, 0x5c, 0x91, 0xff, 0x34, 0x4e, 0x7d, 0xff, 0x12, 0x2d, 0x55, 0xff, 0x1e, 0x42, 0x69, 0xff, 0x4e, 0x7a, 0xa3, 0xff, 0x61, 0x95, 0xbc, 0xff, 0x67, 0x9d, 0xc4, 0xff, 0x67, 0x9c, 0xc8, 0xff, 0x79, 0xa5, 0xcb, 0xff, 0x67, 0x8a, 0xa9, 0xff, 0x10, 0x22, 0x31, 0xff, 0x08, 0x04, 0x00, 0xff, 0x1a, 0x10, 0x00, 0xff, 0x13, 0x0d, 0x04, 0xff, 0x12, 0x0e, 0x07, 0xff, 0x12, 0x0d, 0x06, 0xff, 0x0e, 0x09, 0x02, 0xff, 0x11, 0x0b, 0x05, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x0f, 0x09, 0x02, 0xff, 0x11, 0x0c, 0x05, 0xff, 0x19, 0x1f, 0x12, 0xff, 0x27, 0x2d, 0x20, 0xff, 0x2f, 0x36, 0x29, 0xff, 0x32, 0x3b, 0x2e, 0xff, 0x32, 0x3e, 0x31, 0xff, 0x33, 0x42, 0x34, 0xff, 0x35, 0x45, 0x37, 0xff, 0x39, 0x49, 0x3a, 0xff, 0x39, 0x4b, 0x3a, 0xff, 0x3d, 0x4f, 0x3f, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0xd1, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x05, 0x00, 0x00, 0xff, 0x07, 0x03, 0x00, 0xff, 0x07, 0x04, 0x01, 0xff, 0x0a, 0x06, 0x03, 0xff, 0x0e, 0x09, 0x07, 0xff, 0x0e, 0x09, 0x06, 0xff, 0x0e, 0x09, 0x06, 0xff, 0x0d, 0x08, 0x06, 0xff, 0x0a, 0x05, 0x03, 0xff, 0x0b, 0x06, 0x04, 0xff, 0x0b, 0x06, 0x05, 0xff, 0x0b, 0x07, 0x02, 0xff, 0x0b, 0x07, 0x00, 0xff, 0x0a, 0x07, 0x01, 0xff, 0x0a, 0x06, 0x02, 0xff, 0x0b, 0x07, 0x02, 0xff, 0x0b, 0x07, 0x02, 0xff, 0x0e, 0x0a, 0x05, 0xff, 0x12, 0x0e, 0x09, 0xff, 0x0c, 0x07, 0x04, 0xff, 0x08, 0x06, 0x03, 0xff, 0x0c, 0x0c, 0x05, 0xff, 0x0f, 0x0e, 0x02, 0xff, 0x0b, 0x0b, 0x00, 0xff, 0x08, 0x09, 0x01, 0xff, 0x03, 0x03, 0x01, 0xff, 0x15, 0x18, 0x20, 0xff, 0x11, 0x20, 0x31, 0xff, 0x03, 0x13, 0x25, 0xff, 0x0a, 0x16, 0x31, 0xff, 0x13, 0x20, 0x46, 0xff, 0x1a, 0x2c, 0x5a, 0xff, 0x21, 0x2f, 0x5d, 0xff, 0x15, 0x21, 0x40, 0xff, 0x06, 0x14, 0x27, 0xff, 0x1d, 0x2e, 0x5b, 0xff, 0x34, 0x4a, 0x7e, 0xff, 0x27, 0x40, 0x7d, 0xff, 0x22, 0x3f, 0x84, 0xff, 0x3c, 0x5c, 0xa1, 0xff, 0x3d, 0x5c, 0xa2, 0xff, 0x41, 0x61, 0xa3, 0xff, 0x41, 0x63, 0xa3, 0xff, 0x36, 0x59, 0xa5, 0xff, 0x39, 0x5a, 0xa7, 0xff, 0x4f, 0x6e, 0xbc, 0xff, 0x60, 0x7f, 0xc9, 0xff, 0x59, 0x79, 0xc3, 0xff, 0x5a, 0x7b, 0xc8, 0xff, 0x62, 0x83, 0xd3, 0xff, 0x6a, 0x8a, 0xd6, 0xff, 0x5c, 0x7a, 0xbf, 0xff, 0x52, 0x70, 0xb8, 0xff, 0x4a, 0x6c, 0xb0, 0xff, 0x45, 0x68, 0xaa, 0xff, 0x52, 0x75, 0xb6, 0xff, 0x5c, 0x82, 0xba, 0xff, 0x64, 0x8b, 0xc1, 0xff, 0x63, 0x85, 0xbb, 0xff, 0x60, 0x84, 0xb8, 0xff, 0x5b, 0x8c, 0xbd, 0xff, 0x56, 0x87, 0xb7, 0xff, 0x4e, 0x75, 0xa3, 0xff, 0x41, 0x5c, 0x8a, 0xff, 0x2e, 0x43, 0x72, 0xff, 0x2a, 0x44, 0x72, 0xff, 0x54, 0x79, 0xa5, 0xff, 0x4b, 0x75, 0xa4, 0xff, 0x45, 0x6a, 0x9c, 0xff, 0x3b, 0x5a, 0x8b, 0xff, 0x2c, 0x4b, 0x79, 0xff, 0x11, 0x32, 0x5d, 0xff, 0x21, 0x48, 0x71, 0xff, 0x54, 0x83, 0xae, 0xff, 0x6b, 0x9c, 0xbb, 0xff, 0x73, 0xa7, 0xc4, 0xff, 0x74, 0xa9, 0xd2, 0xff, 0x8e, 0xb7, 0xda, 0xff, 0x54, 0x6e, 0x82, 0xff, 0x00, 0x04, 0x08, 0xff, 0x11, 0x0a, 0x02, 0xff, 0x18, 0x0f, 0x06, 0xff, 0x12, 0x0b, 0x07, 0xff, 0x14, 0x0e, 0x09, 0xff, 0x0f, 0x08, 0x03, 0xff, 0x0f, 0x08, 0x04, 0xff, 0x16, 0x0e, 0x0a, 0xff, 0x15, 0x0d, 0x09, 0xff, 0x10, 0x08, 0x04, 0xff, 0x0c, 0x05, 0x00, 0xff, 0x0b, 0x0a, 0x01, 0xff, 0x13, 0x13, 0x0a, 0xff, 0x1f, 0x21, 0x18, 0xff, 0x27, 0x2c, 0x22, 0xff, 0x2c, 0x35, 0x27, 0xff, 0x30, 0x3a, 0x2c, 0xff, 0x32, 0x3d, 0x30, 0xff, 0x32, 0x40, 0x32, 0xff, 0x32, 0x44, 0x34, 0xd1, 0x3f, 0x3f, 0x3f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x02, 0x00, 0x01, 0xf3, 0x01, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x06, 0x02, 0x01, 0xff, 0x0b, 0x08, 0x03, 0xff, 0x0e, 0x0b, 0x06, 0xff, 0x0e, 0x0a, 0x05, 0xff, 0x0e, 0x0a, 0x06, 0xff, 0x11, 0x0b, 0x08, 0xff, 0x0f, 0x09, 0x06, 0xff, 0x0b, 0x06, 0x03, 0xff, 0x09, 0x04, 0x01, 0xff, 0x0b, 0x06, 0x03, 0xff, 0x0c, 0x07, 0x04, 0xff, 0x0b, 0x06, 0x04, 0xff, 0x0b, 0x07, 0x02, 0xff, 0x0b, 0x07, 0x02, 0xff, 0x0b, 0x07, 0x02, 0xff, 0x0d, 0x09, 0x03, 0xff, 0x0d, 0x09, 0x04, 0xff, 0x0b, 0x07, 0x02, 0xff, 0x0e, 0x0a, 0x05, 0xff, 0x11, 0x0d, 0x08, 0xff, 0x0e, 0x0a, 0x06, 0xff, 0x08, 0x05, 0x02, 0xff, 0x0c, 0x0a, 0x04, 0xff, 0x0f, 0x0d, 0x04, 0xff, 0x0a, 0x0c, 0x02, 0xff, 0x09, 0x0a, 0x03, 0xff, 0x05, 0x03, 0x00, 0xff, 0x0e, 0x0e, 0x0d, 0xff, 0x0a, 0x1a, 0x2b, 0xff, 0x02, 0x12, 0x26, 0xff, 0x0c, 0x1a, 0x2f, 0xff, 0x12, 0x1f, 0x46, 0xff, 0x15, 0x28, 0x60, 0xff, 0x20, 0x32, 0x70, 0xff, 0x27, 0x39, 0x6a, 0xff, 0x0a, 0x1f, 0x39, 0xff, 0x0e, 0x28, 0x47, 0xff, 0x2d, 0x48, 0x71, 0xff, 0x2d, 0x48, 0x7c, 0xff, 0x26, 0x41, 0x7e, 0xff, 0x31, 0x4e, 0x91, 0xff, 0x37, 0x56, 0x99, 0xff, 0x3b, 0x5b, 0x9d, 0xff, 0x3e, 0x62, 0xa0, 0xff, 0x39, 0x5f, 0x9a, 0xff, 0x2f, 0x55, 0x92, 0xff, 0x2e, 0x53, 0x90, 0xff, 0x3d, 0x61, 0xa1, 0xff, 0x3d, 0x5f, 0xa6, 0xff, 0x32, 0x53, 0x9b, 0xff, 0x2a, 0x4a, 0x94, 0xff, 0x3e, 0x5d, 0xa5, 0xff, 0x3b, 0x5b, 0xa0, 0xff, 0x3b, 0x5e, 0x9c, 0xff, 0x48, 0x6e, 0xa3, 0xff, 0x5e, 0x88, 0xb5, 0xff, 0x67, 0x91, 0xbb, 0xff, 0x69, 0x93, 0xbf, 0xff, 0x69, 0x95, 0xc3, 0xff, 0x66, 0x89, 0xbf, 0xff, 0x66, 0x88, 0xc0, 0xff, 0x51, 0x82, 0xb3, 0xff, 0x52, 0x83, 0xb0, 0xff, 0x43, 0x67, 0x92, 0xff, 0x34, 0x4b, 0x76, 0xff, 0x23, 0x3b, 0x67, 0xff, 0x48, 0x69, 0x94, 0xff, 0x4b, 0x74, 0xa4, 0xff, 0x4b, 0x74, 0xa7, 0xff, 0x46, 0x6a, 0x9b, 0xff, 0x34, 0x53, 0x84, 0xff, 0x27, 0x48, 0x76, 0xff, 0x22, 0x46, 0x73, 0xff, 0x33, 0x5c, 0x87, 0xff, 0x59, 0x88, 0xb3, 0xff, 0x6f, 0x9f, 0xbb, 0xff, 0x76, 0xa8, 0xc3, 0xff, 0x82, 0xb5, 0xdc, 0xff, 0x8b, 0xb0, 0xd1, 0xff, 0x28, 0x37, 0x42, 0xff, 0x03, 0x00, 0x00, 0xff, 0x19, 0x0f, 0x02, 0xff, 0x15, 0x0d, 0x04, 0xff, 0x13, 0x0d, 0x07, 0xff, 0x13, 0x0d, 0x07, 0xff, 0x0d, 0x07, 0x01, 0xff, 0x0d, 0x07, 0x01, 0xff, 0x11, 0x0b, 0x05, 0xff, 0x0f, 0x09, 0x03, 0xff, 0x0d, 0x08, 0x02, 0xff, 0x0d, 0x07, 0x01, 0xff, 0x0a, 0x05, 0x02, 0xff, 0x0a, 0x06, 0x02, 0xff, 0x10, 0x0f, 0x07, 0xff, 0x16, 0x17, 0x0e, 0xff, 0x19, 0x20, 0x14, 0xff, 0x23, 0x2b, 0x1f, 0xff, 0x2e, 0x36, 0x29, 0xff, 0x33, 0x3d, 0x30, 0xf4, 0x30, 0x3c, 0x30, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x55, 0x06, 0x03, 0x02, 0xfe, 0x0d, 0x09, 0x07, 0xff, 0x0f, 0x0c, 0x08, 0xff, 0x0e, 0x0c, 0x07, 0xff, 0x0f, 0x0d, 0x08, 0xff, 0x0d, 0x0a, 0x03, 0xff, 0x0d, 0x08, 0x03, 0xff, 0x10, 0x0b, 0x08, 0xff, 0x11, 0x0c, 0x09, 0xff, 0x0e, 0x09, 0x06, 0xff, 0x0b, 0x06, 0x02, 0xff, 0x0c, 0x07, 0x04, 0xff, 0x0d, 0x08, 0x05, 0xff, 0x0c, 0x07, 0x03, 0xff, 0x0d, 0x09, 0x04, 0xff, 0x0e, 0x0a, 0x05, 0xff, 0x0e, 0x0a, 0x05, 0xff, 0x0d, 0x09, 0x04, 0xff, 0x0e, 0x0a, 0x05, 0xff, 0x0d, 0x09, 0x04, 0xff, 0x0e, 0x0a, 0x05, 0xff, 0x0e, 0x0a, 0x05, 0xff, 0x0c, 0x09, 0x05, 0xff, 0x09, 0x06, 0x02, 0xff, 0x0b, 0x08, 0x02, 0xff, 0x0f, 0x0d, 0x05, 0xff, 0x0d, 0x0d, 0x05, 0xff, 0x09, 0x09, 0x03, 0xff, 0x08, 0x06, 0x03, 0xff, 0x05, 0x05, 0x04, 0xff, 0x08, 0x14, 0x2a, 0xff, 0x0d, 0x1b, 0x36, 0xff, 0x0c, 0x1e, 0x32, 0xff, 0x08, 0x1d, 0x3f, 0xff, 0x0e, 0x25, 0x58, 0xff, 0x1f, 0x38, 0x70, 0xff, 0x31, 0x4c, 0x81, 0xff, 0x25, 0x3f, 0x69, 0xff, 0x02, 0x1e, 0x3f, 0xff, 0x24, 0x40, 0x6a, 0xff, 0x46, 0x60, 0x93, 0xff, 0x2e, 0x49, 0x83, 0xff, 0x1e, 0x3c, 0x7b, 0xff, 0x3a, 0x5a, 0x9b, 0xff, 0x42, 0x64, 0xa5, 0xff, 0x44, 0x68, 0xa7, 0xff, 0x46, 0x6c, 0xa5, 0xff, 0x44, 0x6a, 0xa5, 0xff, 0x4b, 0x70, 0xac, 0xff, 0x4d, 0x70, 0xae, 0xff, 0x49, 0x6b, 0xaa, 0xff, 0x4e, 0x6d, 0xae, 0xff, 0x49, 0x67, 0xab, 0xff, 0x59, 0x76, 0xb8, 0xff, 0x68, 0x88, 0xc4, 0xff, 0x68, 0x8a, 0xc2, 0xff, 0x73, 0x98, 0xcb, 0xff, 0x7b, 0xa0, 0xd2, 0xff, 0x71, 0x97, 0xc9, 0xff, 0x71, 0x98, 0xca, 0xff, 0x6f, 0x97, 0xc7, 0xff, 0x6b, 0x92, 0xc6, 0xff, 0x5d, 0x87, 0xbd, 0xff, 0x50, 0x7d, 0xae, 0xff, 0x4a, 0x70, 0xa0, 0xff, 0x3b, 0x58, 0x84, 0xff, 0x18, 0x2e, 0x5a, 0xff, 0x34, 0x50, 0x7c, 0xff, 0x52, 0x7a, 0xa3, 0xff, 0x45, 0x70, 0xa0, 0xff, 0x4f, 0x75, 0xaa, 0xff, 0x44, 0x67, 0x98, 0xff, 0x2f, 0x4f, 0x80, 0xff, 0x2c, 0x4b, 0x7c, 0xff, 0x30, 0x53, 0x83, 0xff, 0x3c, 0x65, 0x92, 0xff, 0x5c, 0x88, 0xb4, 0xff, 0x6b, 0x9f, 0xc2, 0xff, 0x76, 0xaa, 0xca, 0xff, 0x8e, 0xbc, 0xde, 0xff, 0x64, 0x7f, 0x95, 0xff, 0x00, 0x07, 0x0b, 0xff, 0x0e, 0x07, 0x00, 0xff, 0x19, 0x12, 0x06, 0xff, 0x11, 0x0e, 0x07, 0xff, 0x14, 0x0e, 0x08, 0xff, 0x12, 0x0c, 0x04, 0xff, 0x0e, 0x08, 0x00, 0xff, 0x10, 0x0a, 0x02, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x10, 0x0a, 0x02, 0xff, 0x0d, 0x07, 0x00, 0xff, 0x0c, 0x06, 0x00, 0xff, 0x09, 0x05, 0x01, 0xff, 0x09, 0x05, 0x00, 0xff, 0x09, 0x07, 0x00, 0xff, 0x0a, 0x09, 0x00, 0xff, 0x0a, 0x0a, 0x01, 0xff, 0x0e, 0x10, 0x06, 0xff, 0x1d, 0x21, 0x15, 0xff, 0x2c, 0x35, 0x26, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0a, 0x07, 0x8d, 0x10, 0x0d, 0x09, 0xff, 0x0e, 0x0a, 0x06, 0xff, 0x0d, 0x0a, 0x03, 0xff, 0x0f, 0x0c, 0x05, 0xff, 0x0f, 0x0c, 0x03, 0xff, 0x0d, 0x0a, 0x03, 0xff, 0x0e, 0x0a, 0x06, 0xff, 0x0f, 0x0b, 0x05, 0xff, 0x0d, 0x09, 0x04, 0xff, 0x0d, 0x09, 0x04, 0xff, 0x0d, 0x09, 0x04, 0xff, 0x0d, 0x09, 0x04, 0xff, 0x0c, 0x08, 0x03, 0xff, 0x0a, 0x07, 0x01, 0xff, 0x0d, 0x09, 0x04, 0xff, 0x10, 0x0c, 0x07, 0xff, 0x10, 0x0c, 0x07, 0xff, 0x0e, 0x0a, 0x05, 0xff, 0x0d, 0x09, 0x04, 0xff, 0x0e, 0x0a, 0x05, 0xff, 0x0f, 0x0b, 0x06, 0xff, 0x0c, 0x09, 0x04, 0xff, 0x09, 0x06, 0x02, 0xff, 0x0a, 0x07, 0x02, 0xff, 0x10, 0x0d, 0x07, 0xff, 0x10, 0x0c, 0x07, 0xff, 0x0a, 0x08, 0x03, 0xff, 0x09, 0x07, 0x03, 0xff, 0x05, 0x02, 0x01, 0xff, 0x0a, 0x0d, 0x25, 0xff, 0x1a, 0x26, 0x44, 0xff, 0x0a, 0x21, 0x37, 0xff, 0x03, 0x1c, 0x3c, 0xff, 0x09, 0x24, 0x51, 0xff, 0x1e, 0x3a, 0x71, 0xff, 0x28, 0x45, 0x87, 0xff, 0x2e, 0x50, 0x8d, 0xff, 0x20, 0x3e, 0x64, 0xff, 0x13, 0x30, 0x59, 0xff, 0x36, 0x55, 0x83, 0xff, 0x3f, 0x5d, 0x90, 0xff, 0x2c, 0x4a, 0x83, 0xff, 0x35, 0x54, 0x91, 0xff, 0x45, 0x68, 0xa6, 0xff, 0x62, 0x88, 0xc3, 0xff, 0x72, 0x99, 0xcc, 0xff, 0x72, 0x98, 0xcb, 0xff, 0x79, 0x9d, 0xd3, 0xff, 0x7b, 0x9e, 0xd4, 0xff, 0x7e, 0xa0, 0xd5, 0xff, 0x7e, 0x9f, 0xd7, 0xff, 0x80, 0x9e, 0xd8, 0xff, 0x8a, 0xa8, 0xe1, 0xff, 0x80, 0xa0, 0xd4, 0xff, 0x87, 0xa8, 0xdb, 0xff, 0x81, 0xa4, 0xd4, 0xff, 0x73, 0x96, 0xc7, 0xff, 0x79, 0x9c, 0xce, 0xff, 0x7b, 0x9f, 0xd1, 0xff, 0x79, 0x9d, 0xce, 0xff, 0x6c, 0x97, 0xcb, 0xff, 0x57, 0x86, 0xba, 0xff, 0x57, 0x7d, 0xae, 0xff, 0x49, 0x66, 0x96, 0xff, 0x28, 0x3d, 0x6b, 0xff, 0x21, 0x38, 0x66, 0xff, 0x55, 0x75, 0xa3, 0xff, 0x50, 0x7f, 0xa9, 0xff, 0x53, 0x80, 0xaf, 0xff, 0x4f, 0x72, 0xa8, 0xff, 0x3b, 0x5e, 0x91, 0xff, 0x2d, 0x4e, 0x7f, 0xff, 0x32, 0x53, 0x84, 0xff, 0x34, 0x58, 0x88, 0xff, 0x40, 0x69, 0x97, 0xff, 0x62, 0x8c, 0xb9, 0xff, 0x6b, 0xa0, 0xcb, 0xff, 0x86, 0xb8, 0xda, 0xff, 0x8a, 0xae, 0xc5, 0xff, 0x25, 0x33, 0x39, 0xff, 0x00, 0x00, 0x00, 0xff, 0x18, 0x0f, 0x04, 0xff, 0x17, 0x10, 0x08, 0xff, 0x11, 0x0d, 0x0b, 0xff, 0x16, 0x10, 0x0b, 0xff, 0x11, 0x0b, 0x03, 0xff, 0x10, 0x0a, 0x02, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x14, 0x0e, 0x07, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x0f, 0x09, 0x02, 0xff, 0x0f, 0x09, 0x02, 0xff, 0x0e, 0x08, 0x03, 0xff, 0x0f, 0x0a, 0x03, 0xff, 0x0c, 0x09, 0x01, 0xff, 0x0b, 0x07, 0x00, 0xff, 0x0c, 0x07, 0x00, 0xff, 0x0a, 0x07, 0x00, 0xff, 0x0a, 0x09, 0x01, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0b, 0x08, 0x01, 0xb1, 0x0a, 0x06, 0x00, 0xff, 0x0c, 0x0a, 0x01, 0xff, 0x0f, 0x0d, 0x03, 0xff, 0x10, 0x0e, 0x03, 0xff, 0x10, 0x0b, 0x04, 0xff, 0x0d, 0x09, 0x05, 0xff, 0x0c, 0x08, 0x03, 0xff, 0x0d, 0x09, 0x05, 0xff, 0x0d, 0x09, 0x04, 0xff, 0x0d, 0x09, 0x04, 0xff, 0x0d, 0x09, 0x04, 0xff, 0x0e, 0x0a, 0x06, 0xff, 0x0d, 0x09, 0x04, 0xff, 0x0c, 0x08, 0x03, 0xff, 0x0f, 0x0b, 0x06, 0xff, 0x10, 0x0c, 0x07, 0xff, 0x0e, 0x0a, 0x05, 0xff, 0x0b, 0x07, 0x02, 0xff, 0x0d, 0x09, 0x04, 0xff, 0x10, 0x0c, 0x06, 0xff, 0x0d, 0x09, 0x04, 0xff, 0x09, 0x05, 0x00, 0xff, 0x09, 0x05, 0x00, 0xff, 0x10, 0x0c, 0x06, 0xff, 0x10, 0x0c, 0x08, 0xff, 0x0b, 0x08, 0x04, 0xff, 0x07, 0x06, 0x01, 0xff, 0x03, 0x01, 0x00, 0xff, 0x06, 0x06, 0x16, 0xff, 0x18, 0x24, 0x3d, 0xff, 0x0c, 0x26, 0x3c, 0xff, 0x02, 0x20, 0x3e, 0xff, 0x09, 0x24, 0x50, 0xff, 0x1d, 0x38, 0x6e, 0xff, 0x24, 0x44, 0x8b, 0xff, 0x21, 0x49, 0x91, 0xff, 0x36, 0x54, 0x81, 0xff, 0x1b, 0x38, 0x63, 0xff, 0x15, 0x34, 0x63, 0xff, 0x34, 0x52, 0x83, 0xff, 0x37, 0x56, 0x8a, 0xff, 0x3c, 0x5d, 0x96, 0xff, 0x46, 0x6c, 0xa7, 0xff, 0x5c, 0x83, 0xba, 0xff, 0x76, 0x9a, 0xcb, 0xff, 0x83, 0xa6, 0xd8, 0xff, 0x84, 0xa5, 0xdc, 0xff, 0x81, 0xa2, 0xd6, 0xff, 0x85, 0xa6, 0xd6, 0xff, 0x88, 0xa8, 0xdb, 0xff, 0x81, 0x9f, 0xd5, 0xff, 0x80, 0x9e, 0xd2, 0xff, 0x85, 0xa4, 0xd5, 0xff, 0x85, 0xa4, 0xd4, 0xff, 0x80, 0xa0, 0xd1, 0xff, 0x7d, 0x9e, 0xd0, 0xff, 0x87, 0xa8, 0xda, 0xff, 0x81, 0xa2, 0xd4, 0xff, 0x73, 0x93, 0xc6, 0xff, 0x63, 0x8d, 0xc0, 0xff, 0x5e, 0x8d, 0xc0, 0xff, 0x68, 0x8a, 0xbb, 0xff, 0x48, 0x61, 0x90, 0xff, 0x1c, 0x32, 0x60, 0xff, 0x47, 0x62, 0x90, 0xff, 0x61, 0x87, 0xb2, 0xff, 0x56, 0x87, 0xb0, 0xff, 0x55, 0x80, 0xb0, 0xff, 0x49, 0x6b, 0xa2, 0xff, 0x32, 0x54, 0x87, 0xff, 0x2b, 0x4d, 0x7f, 0xff, 0x35, 0x58, 0x88, 0xff, 0x3c, 0x62, 0x8e, 0xff, 0x4d, 0x76, 0xa1, 0xff, 0x61, 0x8d, 0xb7, 0xff, 0x72, 0xa4, 0xd0, 0xff, 0x96, 0xc0, 0xdf, 0xff, 0x4f, 0x68, 0x76, 0xff, 0x00, 0x00, 0x00, 0xff, 0x16, 0x0f, 0x00, 0xff, 0x21, 0x14, 0x07, 0xff, 0x17, 0x11, 0x09, 0xff, 0x0f, 0x0c, 0x09, 0xff, 0x14, 0x0e, 0x09, 0xff, 0x0e, 0x08, 0x00, 0xff, 0x0f, 0x09, 0x02, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x14, 0x0e, 0x07, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x14, 0x0c, 0x05, 0xff, 0x15, 0x0e, 0x07, 0xff, 0x14, 0x0d, 0x06, 0xff, 0x0f, 0x0a, 0x04, 0xff, 0x0e, 0x07, 0x00, 0xff, 0x0e, 0x0a, 0x01, 0xb1, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x0a, 0x0b, 0x07, 0x02, 0xc8, 0x0c, 0x09, 0x01, 0xff, 0x0e, 0x0c, 0x03, 0xff, 0x11, 0x0c, 0x04, 0xff, 0x10, 0x0b, 0x03, 0xff, 0x0c, 0x0a, 0x03, 0xff, 0x0d, 0x0a, 0x03, 0xff, 0x0f, 0x0c, 0x05, 0xff, 0x0f, 0x0c, 0x05, 0xff, 0x0e, 0x0b, 0x04, 0xff, 0x0e, 0x0b, 0x04, 0xff, 0x0e, 0x0b, 0x04, 0xff, 0x0f, 0x0b, 0x05, 0xff, 0x0d, 0x09, 0x05, 0xff, 0x0e, 0x0a, 0x06, 0xff, 0x10, 0x0c, 0x08, 0xff, 0x0e, 0x0a, 0x06, 0xff, 0x0b, 0x07, 0x03, 0xff, 0x0c, 0x07, 0x03, 0xff, 0x0d, 0x09, 0x05, 0xff, 0x0d, 0x0a, 0x03, 0xff, 0x0a, 0x06, 0x00, 0xff, 0x08, 0x05, 0x00, 0xff, 0x0b, 0x06, 0x03, 0xff, 0x0f, 0x0b, 0x08, 0xff, 0x0e, 0x0b, 0x06, 0xff, 0x0c, 0x09, 0x04, 0xff, 0x06, 0x03, 0x00, 0xff, 0x00, 0x01, 0x04, 0xff, 0x12, 0x1c, 0x2f, 0xff, 0x14, 0x2b, 0x48, 0xff, 0x05, 0x21, 0x45, 0xff, 0x0d, 0x25, 0x50, 0xff, 0x1f, 0x38, 0x6b, 0xff, 0x23, 0x44, 0x86, 0xff, 0x24, 0x4e, 0x95, 0xff, 0x32, 0x56, 0x89, 0xff, 0x34, 0x53, 0x84, 0xff, 0x11, 0x30, 0x61, 0xff, 0x14, 0x35, 0x62, 0xff, 0x35, 0x54, 0x84, 0xff, 0x38, 0x57, 0x8c, 0xff, 0x43, 0x65, 0x9d, 0xff, 0x4b, 0x70, 0xa5, 0xff, 0x62, 0x85, 0xb5, 0xff, 0x7f, 0xa2, 0xd3, 0xff, 0x7a, 0x9d, 0xd0, 0xff, 0x7c, 0x9e, 0xd0, 0xff, 0x83, 0xa4, 0xd5, 0xff, 0x81, 0xa2, 0xd3, 0xff, 0x80, 0xa0, 0xd2, 0xff, 0x81, 0xa1, 0xd2, 0xff, 0x84, 0xa4, 0xd6, 0xff, 0x84, 0xa3, 0xd7, 0xff, 0x88, 0xa8, 0xdc, 0xff, 0x7d, 0x9d, 0xd1, 0xff, 0x7c, 0x9d, 0xd1, 0xff, 0x77, 0x99, 0xcb, 0xff, 0x74, 0x96, 0xc5, 0xff, 0x6a, 0x8e, 0xbf, 0xff, 0x68, 0x8d, 0xbe, 0xff, 0x61, 0x82, 0xb1, 0xff, 0x25, 0x40, 0x6e, 0xff, 0x2d, 0x4a, 0x77, 0xff, 0x5f, 0x84, 0xb1, 0xff, 0x63, 0x8e, 0xb8, 0xff, 0x5f, 0x89, 0xb3, 0xff, 0x52, 0x75, 0xa7, 0xff, 0x43, 0x65, 0x9c, 0xff, 0x32, 0x55, 0x86, 0xff, 0x2f, 0x54, 0x83, 0xff, 0x3a, 0x62, 0x8d, 0xff, 0x49, 0x72, 0x9b, 0xff, 0x56, 0x82, 0xa9, 0xff, 0x60, 0x90, 0xb6, 0xff, 0x86, 0xb3, 0xd9, 0xff, 0x74, 0x95, 0xad, 0xff, 0x0b, 0x18, 0x1c, 0xff, 0x08, 0x03, 0x00, 0xff, 0x1d, 0x13, 0x02, 0xff, 0x22, 0x15, 0x0b, 0xff, 0x19, 0x12, 0x0a, 0xff, 0x0f, 0x0d, 0x06, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x0f, 0x08, 0x01, 0xff, 0x0d, 0x07, 0x01, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x14, 0x0e, 0x07, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x12, 0x0a, 0x03, 0xff, 0x13, 0x0b, 0x04, 0xff, 0x12, 0x0a, 0x05, 0xff, 0x0f, 0x07, 0x03, 0xff, 0x0c, 0x06, 0x02, 0xc8, 0x19, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x15, 0x0f, 0x0b, 0x07, 0xd7, 0x10, 0x0c, 0x08, 0xff, 0x12, 0x0b, 0x07, 0xff, 0x0e, 0x09, 0x03, 0xff, 0x0b, 0x09, 0x00, 0xff, 0x0c, 0x09, 0x01, 0xff, 0x0e, 0x0c, 0x03, 0xff, 0x10, 0x0e, 0x05, 0xff, 0x10, 0x0e, 0x05, 0xff, 0x0f, 0x0c, 0x04, 0xff, 0x0f, 0x0c, 0x02, 0xff, 0x0e, 0x0b, 0x05, 0xff, 0x0e, 0x0a, 0x06, 0xff, 0x0e, 0x0a, 0x05, 0xff, 0x10, 0x0c, 0x07, 0xff, 0x10, 0x0c, 0x07, 0xff, 0x0e, 0x0a, 0x05, 0xff, 0x0e, 0x0a, 0x05, 0xff, 0x0d, 0x09, 0x05, 0xff, 0x0e, 0x0c, 0x02, 0xff, 0x0d, 0x0b, 0x00, 0xff, 0x0a, 0x06, 0x03, 0xff, 0x09, 0x03, 0x04, 0xff, 0x0d, 0x07, 0x09, 0xff, 0x10, 0x0c, 0x0b, 0xff, 0x0d, 0x0a, 0x06, 0xff, 0x0c, 0x07, 0x02, 0xff, 0x06, 0x01, 0x00, 0xff, 0x0c, 0x17, 0x24, 0xff, 0x13, 0x2d, 0x4f, 0xff, 0x09, 0x23, 0x50, 0xff, 0x14, 0x25, 0x53, 0xff, 0x24, 0x34, 0x61, 0xff, 0x25, 0x44, 0x7a, 0xff, 0x22, 0x52, 0x95, 0xff, 0x29, 0x54, 0x93, 0xff, 0x34, 0x57, 0x93, 0xff, 0x30, 0x4d, 0x81, 0xff, 0x16, 0x30, 0x5c, 0xff, 0x33, 0x4e, 0x7a, 0xff, 0x44, 0x5d, 0x8e, 0xff, 0x33, 0x4f, 0x86, 0xff, 0x45, 0x67, 0x9f, 0xff, 0x66, 0x8c, 0xbf, 0xff, 0x77, 0x9c, 0xd0, 0xff, 0x77, 0x9e, 0xd0, 0xff, 0x7b, 0xa1, 0xd4, 0xff, 0x85, 0xa8, 0xdb, 0xff, 0x80, 0xa2, 0xd5, 0xff, 0x82, 0xa4, 0xd7, 0xff, 0x82, 0xa3, 0xd5, 0xff, 0x7f, 0xa1, 0xd1, 0xff, 0x82, 0xa2, 0xd5, 0xff, 0x7e, 0xa0, 0xd5, 0xff, 0x77, 0x98, 0xce, 0xff, 0x71, 0x91, 0xc6, 0xff, 0x68, 0x8c, 0xbe, 0xff, 0x6d, 0x92, 0xbf, 0xff, 0x73, 0x97, 0xc7, 0xff, 0x61, 0x7e, 0xb2, 0xff, 0x2e, 0x44, 0x74, 0xff, 0x27, 0x3e, 0x6b, 0xff, 0x4f, 0x77, 0xa0, 0xff, 0x5b, 0x90, 0xb8, 0xff, 0x62, 0x91, 0xbc, 0xff, 0x5e, 0x7f, 0xaf, 0xff, 0x4f, 0x71, 0xa3, 0xff, 0x3d, 0x63, 0x95, 0xff, 0x2e, 0x55, 0x83, 0xff, 0x32, 0x59, 0x84, 0xff, 0x41, 0x6b, 0x94, 0xff, 0x54, 0x7f, 0xa4, 0xff, 0x60, 0x8a, 0xad, 0xff, 0x6f, 0x9c, 0xbf, 0xff, 0x85, 0xa9, 0xc4, 0xff, 0x30, 0x41, 0x4e, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1c, 0x11, 0x00, 0xff, 0x1c, 0x13, 0x06, 0xff, 0x18, 0x13, 0x0b, 0xff, 0x14, 0x10, 0x07, 0xff, 0x1a, 0x13, 0x06, 0xff, 0x11, 0x0a, 0x02, 0xff, 0x0d, 0x07, 0x00, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x10, 0x0b, 0x03, 0xff, 0x0f, 0x0c, 0x03, 0xff, 0x0f, 0x0c, 0x03, 0xff, 0x0c, 0x08, 0x00, 0xff, 0x0a, 0x07, 0x00, 0xd8, 0x0c, 0x0c, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x09, 0x09, 0x1c, 0x10, 0x0a, 0x08, 0xdc, 0x0f, 0x07, 0x05, 0xff, 0x0c, 0x06, 0x02, 0xff, 0x0c, 0x0b, 0x01, 0xff, 0x0f, 0x0c, 0x04, 0xff, 0x10, 0x0d, 0x05, 0xff, 0x12, 0x0f, 0x07, 0xff, 0x0f, 0x0c, 0x04, 0xff, 0x0e, 0x0c, 0x04, 0xff, 0x11, 0x0e, 0x06, 0xff, 0x0e, 0x0a, 0x04, 0xff, 0x0c, 0x07, 0x04, 0xff, 0x0d, 0x09, 0x04, 0xff, 0x0e, 0x0a, 0x05, 0xff, 0x0e, 0x0a, 0x05, 0xff, 0x0e, 0x0a, 0x06, 0xff, 0x0e, 0x0a, 0x05, 0xff, 0x0f, 0x0b, 0x07, 0xff, 0x0e, 0x0d, 0x03, 0xff, 0x0e, 0x0c, 0x02, 0xff, 0x0d, 0x08, 0x05, 0xff, 0x0b, 0x05, 0x06, 0xff, 0x0a, 0x05, 0x06, 0xff, 0x0e, 0x0b, 0x0a, 0xff, 0x0c, 0x0a, 0x06, 0xff, 0x11, 0x0c, 0x07, 0xff, 0x0f, 0x06, 0x00, 0xff, 0x03, 0x0e, 0x11, 0xff, 0x11, 0x2d, 0x49, 0xff, 0x14, 0x2b, 0x5c, 0xff, 0x19, 0x26, 0x59, 0xff, 0x21, 0x2e, 0x5a, 0xff, 0x24, 0x41, 0x70, 0xff, 0x1c, 0x4c, 0x87, 0xff, 0x26, 0x52, 0x98, 0xff, 0x2b, 0x52, 0x94, 0xff, 0x3a, 0x58, 0x91, 0xff, 0x31, 0x46, 0x77, 0xff, 0x1f, 0x35, 0x62, 0xff, 0x3b, 0x51, 0x7f, 0xff, 0x32, 0x4a, 0x7d, 0xff, 0x39, 0x57, 0x90, 0xff, 0x4c, 0x73, 0xaa, 0xff, 0x65, 0x8c, 0xc2, 0xff, 0x73, 0x9a, 0xd0, 0xff, 0x79, 0x9f, 0xd3, 0xff, 0x76, 0x9b, 0xcf, 0xff, 0x76, 0x99, 0xcd, 0xff, 0x7a, 0x9d, 0xd1, 0xff, 0x80, 0xa1, 0xd4, 0xff, 0x82, 0xa2, 0xd5, 0xff, 0x79, 0x9a, 0xcf, 0xff, 0x71, 0x91, 0xcb, 0xff, 0x77, 0x98, 0xd1, 0xff, 0x6d, 0x91, 0xc5, 0xff, 0x64, 0x8a, 0xbb, 0xff, 0x60, 0x8a, 0xb7, 0xff, 0x56, 0x7d, 0xac, 0xff, 0x2a, 0x40, 0x75, 0xff, 0x17, 0x27, 0x59, 0xff, 0x56, 0x71, 0x9d, 0xff, 0x5d, 0x8e, 0xb6, 0xff, 0x56, 0x92, 0xb9, 0xff, 0x58, 0x89, 0xb4, 0xff, 0x57, 0x77, 0xa8, 0xff, 0x4b, 0x6a, 0x9a, 0xff, 0x39, 0x5e, 0x8c, 0xff, 0x2d, 0x53, 0x80, 0xff, 0x37, 0x5f, 0x8b, 0xff, 0x4e, 0x78, 0xa0, 0xff, 0x5b, 0x87, 0xab, 0xff, 0x66, 0x95, 0xb5, 0xff, 0x76, 0xa5, 0xc3, 0xff, 0x40, 0x62, 0x79, 0xff, 0x00, 0x02, 0x0d, 0xff, 0x10, 0x07, 0x02, 0xff, 0x20, 0x15, 0x02, 0xff, 0x19, 0x11, 0x07, 0xff, 0x0f, 0x0f, 0x08, 0xff, 0x15, 0x15, 0x0b, 0xff, 0x1f, 0x13, 0x05, 0xff, 0x0e, 0x06, 0x00, 0xff, 0x0d, 0x07, 0x01, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x0e, 0x08, 0x01, 0xff, 0x0e, 0x08, 0x01, 0xff, 0x0e, 0x08, 0x01, 0xff, 0x0e, 0x09, 0x02, 0xff, 0x0d, 0x0c, 0x02, 0xff, 0x0c, 0x0a, 0x02, 0xff, 0x0b, 0x0a, 0x01, 0xdd, 0x09, 0x09, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x21, 0x0c, 0x06, 0x03, 0xde, 0x0e, 0x08, 0x02, 0xff, 0x0e, 0x0c, 0x03, 0xff, 0x10, 0x0d, 0x05, 0xff, 0x10, 0x0c, 0x05, 0xff, 0x10, 0x0c, 0x04, 0xff, 0x0e, 0x0a, 0x03, 0xff, 0x0f, 0x0b, 0x03, 0xff, 0x11, 0x0d, 0x05, 0xff, 0x0e, 0x0a, 0x03, 0xff, 0x0a, 0x07, 0x01, 0xff, 0x0c, 0x08, 0x03, 0xff, 0x0f, 0x0b, 0x06, 0xff, 0x10, 0x0c, 0x06, 0xff, 0x0c, 0x08, 0x02, 0xff, 0x0e, 0x0a, 0x04, 0xff, 0x11, 0x0d, 0x07, 0xff, 0x0e, 0x0a, 0x05, 0xff, 0x0e, 0x0a, 0x05, 0xff, 0x0c, 0x08, 0x03, 0xff, 0x0d, 0x09, 0x04, 0xff, 0x09, 0x06, 0x02, 0xff, 0x09, 0x06, 0x02, 0xff, 0x0d, 0x0a, 0x04, 0xff, 0x12, 0x10, 0x07, 0xff, 0x0f, 0x0c, 0x01, 0xff, 0x00, 0x03, 0x02, 0xff, 0x10, 0x1f, 0x35, 0xff, 0x1d, 0x33, 0x5d, 0xff, 0x15, 0x2b, 0x5d, 0xff, 0x12, 0x2c, 0x5f, 0xff, 0x19, 0x37, 0x69, 0xff, 0x29, 0x4a, 0x7b, 0xff, 0x2a, 0x52, 0x90, 0xff, 0x29, 0x55, 0x96, 0xff, 0x2c, 0x56, 0x94, 0xff, 0x36, 0x57, 0x92, 0xff, 0x22, 0x3c, 0x6e, 0xff, 0x0d, 0x25, 0x51, 0xff, 0x39, 0x4e, 0x7b, 0xff, 0x47, 0x60, 0x93, 0xff, 0x3f, 0x63, 0x9a, 0xff, 0x59, 0x7d, 0xb2, 0xff, 0x6e, 0x93, 0xc5, 0xff, 0x74, 0x99, 0xc9, 0xff, 0x75, 0x97, 0xc6, 0xff, 0x74, 0x95, 0xc4, 0xff, 0x75, 0x97, 0xc2, 0xff, 0x7e, 0x9b, 0xd0, 0xff, 0x7c, 0x95, 0xd8, 0xff, 0x75, 0x92, 0xd1, 0xff, 0x6d, 0x8a, 0xc8, 0xff, 0x64, 0x88, 0xc1, 0xff, 0x61, 0x90, 0xc3, 0xff, 0x5a, 0x88, 0xb9, 0xff, 0x51, 0x87, 0xb4, 0xff, 0x30, 0x55, 0x81, 0xff, 0x08, 0x1a, 0x47, 0xff, 0x3f, 0x5e, 0x8d, 0xff, 0x61, 0x8b, 0xbc, 0xff, 0x5b, 0x8e, 0xbe, 0xff, 0x58, 0x8f, 0xbd, 0xff, 0x52, 0x82, 0xaf, 0xff, 0x55, 0x78, 0xa4, 0xff, 0x50, 0x67, 0x94, 0xff, 0x3f, 0x58, 0x85, 0xff, 0x36, 0x59, 0x85, 0xff, 0x3d, 0x69, 0x93, 0xff, 0x50, 0x83, 0xa8, 0xff, 0x58, 0x8d, 0xad, 0xff, 0x77, 0xa1, 0xc0, 0xff, 0x5e, 0x78, 0x99, 0xff, 0x0b, 0x11, 0x1a, 0xff, 0x05, 0x00, 0x00, 0xff, 0x16, 0x0f, 0x06, 0xff, 0x19, 0x12, 0x09, 0xff, 0x15, 0x11, 0x07, 0xff, 0x14, 0x0f, 0x07, 0xff, 0x18, 0x14, 0x09, 0xff, 0x11, 0x0e, 0x01, 0xff, 0x0e, 0x08, 0x01, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x0e, 0x08, 0x01, 0xff, 0x0e, 0x08, 0x01, 0xff, 0x0e, 0x08, 0x01, 0xff, 0x0d, 0x07, 0x00, 0xff, 0x0e, 0x08, 0x01, 0xff, 0x0f, 0x0b, 0x06, 0xff, 0x0c, 0x08, 0x04, 0xde, 0x0f, 0x07, 0x07, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x00, 0x1a, 0x0f, 0x0a, 0x04, 0xd7, 0x12, 0x0c, 0x04, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x11, 0x0a, 0x03, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x12, 0x0e, 0x05, 0xff, 0x0d, 0x0a, 0x02, 0xff, 0x0d, 0x0a, 0x02, 0xff, 0x11, 0x0e, 0x05, 0xff, 0x11, 0x0e, 0x06, 0xff, 0x0d, 0x0b, 0x02, 0xff, 0x0e, 0x0c, 0x03, 0xff, 0x10, 0x0d, 0x05, 0xff, 0x0e, 0x09, 0x06, 0xff, 0x0e, 0x08, 0x06, 0xff, 0x0c, 0x07, 0x03, 0xff, 0x0e, 0x09, 0x05, 0xff, 0x0c, 0x07, 0x03, 0xff, 0x09, 0x04, 0x01, 0xff, 0x0b, 0x07, 0x03, 0xff, 0x11, 0x0d, 0x08, 0xff, 0x0e, 0x0d, 0x02, 0xff, 0x02, 0x04, 0x00, 0xff, 0x01, 0x06, 0x13, 0xff, 0x1b, 0x2b, 0x4a, 0xff, 0x1b, 0x33, 0x5f, 0xff, 0x11, 0x2f, 0x63, 0xff, 0x13, 0x32, 0x69, 0xff, 0x22, 0x41, 0x72, 0xff, 0x29, 0x4e, 0x86, 0xff, 0x2a, 0x55, 0x94, 0xff, 0x2a, 0x56, 0x95, 0xff, 0x33, 0x59, 0x94, 0xff, 0x38, 0x55, 0x86, 0xff, 0x09, 0x20, 0x4b, 0xff, 0x0d, 0x21, 0x4b, 0xff, 0x2e, 0x47, 0x77, 0xff, 0x37, 0x5a, 0x92, 0xff, 0x54, 0x74, 0xac, 0xff, 0x5a, 0x7d, 0xb3, 0xff, 0x68, 0x90, 0xc4, 0xff, 0x6c, 0x93, 0xc7, 0xff, 0x69, 0x92, 0xc8, 0xff, 0x6a, 0x91, 0xcb, 0xff, 0x6a, 0x92, 0xcd, 0xff, 0x68, 0x94, 0xce, 0xff, 0x6a, 0x92, 0xcb, 0xff, 0x60, 0x85, 0xbb, 0xff, 0x66, 0x8a, 0xbc, 0xff, 0x5d, 0x7d, 0xae, 0xff, 0x58, 0x72, 0xa3, 0xff, 0x50, 0x6b, 0x99, 0xff, 0x05, 0x1e, 0x4a, 0xff, 0x28, 0x41, 0x6e, 0xff, 0x5f, 0x86, 0xb4, 0xff, 0x59, 0x88, 0xba, 0xff, 0x5c, 0x90, 0xbf, 0xff, 0x54, 0x87, 0xb5, 0xff, 0x51, 0x7c, 0xaa, 0xff, 0x4a, 0x6f, 0x9b, 0xff, 0x44, 0x61, 0x8c, 0xff, 0x43, 0x5e, 0x8a, 0xff, 0x3d, 0x62, 0x8f, 0xff, 0x44, 0x70, 0x9b, 0xff, 0x53, 0x87, 0xac, 0xff, 0x6a, 0x9c, 0xba, 0xff, 0x72, 0x91, 0xa9, 0xff, 0x1e, 0x25, 0x3d, 0xff, 0x02, 0x00, 0x00, 0xff, 0x13, 0x0b, 0x00, 0xff, 0x14, 0x0f, 0x05, 0xff, 0x16, 0x12, 0x0c, 0xff, 0x19, 0x15, 0x0b, 0xff, 0x17, 0x11, 0x08, 0xff, 0x12, 0x0c, 0x03, 0xff, 0x0d, 0x0b, 0x01, 0xff, 0x10, 0x0b, 0x04, 0xff, 0x10, 0x09, 0x02, 0xff, 0x0f, 0x09, 0x02, 0xff, 0x0d, 0x07, 0x00, 0xff, 0x0f, 0x09, 0x02, 0xff, 0x10, 0x0a, 0x02, 0xff, 0x0e, 0x07, 0x00, 0xff, 0x0e, 0x08, 0x01, 0xff, 0x0e, 0x08, 0x04, 0xd7, 0x09, 0x09, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x0b, 0x0b, 0x16, 0x11, 0x0c, 0x03, 0xca, 0x11, 0x0b, 0x04, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x12, 0x0e, 0x07, 0xff, 0x10, 0x0e, 0x06, 0xff, 0x0e, 0x0b, 0x03, 0xff, 0x0e, 0x0b, 0x03, 0xff, 0x10, 0x0d, 0x05, 0xff, 0x0f, 0x0c, 0x04, 0xff, 0x10, 0x0d, 0x05, 0xff, 0x0f, 0x0c, 0x04, 0xff, 0x0f, 0x0b, 0x06, 0xff, 0x0e, 0x0a, 0x06, 0xff, 0x0e, 0x0a, 0x06, 0xff, 0x0f, 0x0a, 0x07, 0xff, 0x10, 0x0b, 0x08, 0xff, 0x0b, 0x06, 0x02, 0xff, 0x07, 0x02, 0x00, 0xff, 0x0f, 0x0a, 0x07, 0xff, 0x10, 0x0d, 0x04, 0xff, 0x0a, 0x08, 0x02, 0xff, 0x00, 0x00, 0x04, 0xff, 0x09, 0x0f, 0x25, 0xff, 0x21, 0x31, 0x52, 0xff, 0x1c, 0x35, 0x61, 0xff, 0x15, 0x37, 0x6d, 0xff, 0x18, 0x3e, 0x75, 0xff, 0x25, 0x48, 0x7d, 0xff, 0x2f, 0x56, 0x91, 0xff, 0x32, 0x5a, 0x96, 0xff, 0x34, 0x58, 0x90, 0xff, 0x3c, 0x5a, 0x8a, 0xff, 0x36, 0x4e, 0x79, 0xff, 0x12, 0x28, 0x54, 0xff, 0x02, 0x1c, 0x4a, 0xff, 0x11, 0x29, 0x55, 0xff, 0x2e, 0x45, 0x74, 0xff, 0x42, 0x5e, 0x8e, 0xff, 0x51, 0x73, 0xa3, 0xff, 0x55, 0x7a, 0xae, 0xff, 0x5d, 0x86, 0xbe, 0xff, 0x5c, 0x84, 0xc7, 0xff, 0x55, 0x81, 0xbb, 0xff, 0x55, 0x8a, 0xae, 0xff, 0x5c, 0x87, 0xaf, 0xff, 0x5d, 0x85, 0xac, 0xff, 0x63, 0x84, 0xab, 0xff, 0x49, 0x5c, 0x86, 0xff, 0x42, 0x48, 0x73, 0xff, 0x1f, 0x17, 0x43, 0xff, 0x23, 0x32, 0x5e, 0xff, 0x50, 0x7b, 0xa9, 0xff, 0x5e, 0x86, 0xb3, 0xff, 0x5e, 0x8b, 0xb7, 0xff, 0x5f, 0x8d, 0xb9, 0xff, 0x57, 0x85, 0xae, 0xff, 0x48, 0x73, 0x9c, 0xff, 0x3d, 0x68, 0x8f, 0xff, 0x3d, 0x67, 0x92, 0xff, 0x3c, 0x64, 0x95, 0xff, 0x3e, 0x66, 0x96, 0xff, 0x4d, 0x77, 0xa5, 0xff, 0x62, 0x8d, 0xb6, 0xff, 0x68, 0x8f, 0xab, 0xff, 0x26, 0x3c, 0x4a, 0xff, 0x00, 0x00, 0x03, 0xff, 0x0c, 0x07, 0x02, 0xff, 0x14, 0x0f, 0x04, 0xff, 0x16, 0x11, 0x08, 0xff, 0x16, 0x11, 0x08, 0xff, 0x1a, 0x15, 0x0c, 0xff, 0x16, 0x11, 0x08, 0xff, 0x0e, 0x09, 0x00, 0xff, 0x10, 0x0a, 0x02, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x13, 0x0e, 0x07, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x0e, 0x08, 0x01, 0xff, 0x0d, 0x07, 0x00, 0xff, 0x0c, 0x06, 0x00, 0xff, 0x0c, 0x06, 0x00, 0xff, 0x0c, 0x07, 0x01, 0xca, 0x0b, 0x0b, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x0b, 0x10, 0x0a, 0x02, 0xaf, 0x12, 0x0c, 0x05, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x0f, 0x09, 0x02, 0xff, 0x0f, 0x09, 0x02, 0xff, 0x12, 0x0b, 0x04, 0xff, 0x12, 0x0e, 0x07, 0xff, 0x0f, 0x0d, 0x04, 0xff, 0x0d, 0x0a, 0x02, 0xff, 0x0d, 0x0a, 0x02, 0xff, 0x0f, 0x0c, 0x04, 0xff, 0x10, 0x0d, 0x05, 0xff, 0x11, 0x0e, 0x06, 0xff, 0x11, 0x0e, 0x06, 0xff, 0x10, 0x0d, 0x05, 0xff, 0x0d, 0x0a, 0x03, 0xff, 0x0f, 0x0c, 0x04, 0xff, 0x0f, 0x0c, 0x05, 0xff, 0x0f, 0x0c, 0x04, 0xff, 0x11, 0x0e, 0x06, 0xff, 0x0a, 0x07, 0x01, 0xff, 0x0a, 0x07, 0x00, 0xff, 0x0f, 0x0b, 0x06, 0xff, 0x0e, 0x09, 0x03, 0xff, 0x08, 0x04, 0x03, 0xff, 0x00, 0x00, 0x06, 0xff, 0x0e, 0x14, 0x24, 0xff, 0x23, 0x34, 0x55, 0xff, 0x1d, 0x3c, 0x6e, 0xff, 0x1b, 0x42, 0x77, 0xff, 0x2c, 0x4d, 0x7d, 0xff, 0x2f, 0x56, 0x8d, 0xff, 0x2e, 0x58, 0x96, 0xff, 0x31, 0x59, 0x96, 0xff, 0x3a, 0x5d, 0x94, 0xff, 0x44, 0x63, 0x93, 0xff, 0x3f, 0x60, 0x92, 0xff, 0x22, 0x40, 0x6f, 0xff, 0x15, 0x1f, 0x3c, 0xff, 0x0e, 0x1c, 0x3a, 0xff, 0x1d, 0x2c, 0x4b, 0xff, 0x28, 0x38, 0x58, 0xff, 0x3a, 0x4e, 0x72, 0xff, 0x4d, 0x67, 0x8e, 0xff, 0x57, 0x72, 0x9f, 0xff, 0x5c, 0x75, 0x9f, 0xff, 0x54, 0x6c, 0x8c, 0xff, 0x4f, 0x66, 0x88, 0xff, 0x4a, 0x61, 0x84, 0xff, 0x25, 0x3b, 0x5e, 0xff, 0x04, 0x17, 0x3b, 0xff, 0x07, 0x1a, 0x3e, 0xff, 0x34, 0x4c, 0x70, 0xff, 0x57, 0x7d, 0xa4, 0xff, 0x50, 0x84, 0xaf, 0xff, 0x5b, 0x87, 0xb1, 0xff, 0x69, 0x91, 0xbb, 0xff, 0x6c, 0x91, 0xba, 0xff, 0x58, 0x80, 0xa6, 0xff, 0x47, 0x73, 0x96, 0xff, 0x46, 0x76, 0x95, 0xff, 0x3e, 0x71, 0x9a, 0xff, 0x37, 0x68, 0x9a, 0xff, 0x3f, 0x68, 0x97, 0xff, 0x5d, 0x80, 0xad, 0xff, 0x68, 0x88, 0xab, 0xff, 0x29, 0x40, 0x55, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x07, 0x00, 0xff, 0x18, 0x11, 0x06, 0xff, 0x16, 0x12, 0x09, 0xff, 0x14, 0x0f, 0x06, 0xff, 0x16, 0x11, 0x08, 0xff, 0x17, 0x11, 0x0a, 0xff, 0x0f, 0x09, 0x02, 0xff, 0x0e, 0x08, 0x01, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x14, 0x0e, 0x07, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x0c, 0x06, 0x00, 0xff, 0x0e, 0x08, 0x01, 0xb0, 0x17, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x10, 0x0b, 0x03, 0x8b, 0x11, 0x0b, 0x04, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x11, 0x0a, 0x03, 0xff, 0x12, 0x0e, 0x06, 0xff, 0x0e, 0x0c, 0x03, 0xff, 0x0f, 0x0c, 0x04, 0xff, 0x0d, 0x0b, 0x03, 0xff, 0x0c, 0x0a, 0x01, 0xff, 0x10, 0x0d, 0x05, 0xff, 0x12, 0x0f, 0x07, 0xff, 0x12, 0x0f, 0x07, 0xff, 0x10, 0x0d, 0x05, 0xff, 0x0d, 0x0b, 0x02, 0xff, 0x0e, 0x0b, 0x03, 0xff, 0x0f, 0x0c, 0x04, 0xff, 0x0f, 0x0c, 0x04, 0xff, 0x12, 0x10, 0x07, 0xff, 0x10, 0x0d, 0x04, 0xff, 0x09, 0x06, 0x00, 0xff, 0x09, 0x06, 0x03, 0xff, 0x10, 0x0c, 0x04, 0xff, 0x0f, 0x09, 0x01, 0xff, 0x08, 0x03, 0x00, 0xff, 0x00, 0x00, 0x02, 0xff, 0x0c, 0x15, 0x2d, 0xff, 0x1c, 0x37, 0x61, 0xff, 0x24, 0x45, 0x72, 0xff, 0x2e, 0x4f, 0x7e, 0xff, 0x30, 0x58, 0x91, 0xff, 0x2c, 0x5b, 0x9d, 0xff, 0x2b, 0x5a, 0x9c, 0xff, 0x33, 0x5d, 0x9c, 0xff, 0x39, 0x5f, 0x97, 0xff, 0x35, 0x60, 0x98, 0xff, 0x37, 0x5d, 0x95, 0xff, 0x3a, 0x4c, 0x74, 0xff, 0x25, 0x3b, 0x5f, 0xff, 0x17, 0x29, 0x49, 0xff, 0x0a, 0x12, 0x2f, 0xff, 0x0d, 0x1e, 0x3a, 0xff, 0x19, 0x2e, 0x49, 0xff, 0x1f, 0x33, 0x4d, 0xff, 0x1e, 0x28, 0x48, 0xff, 0x13, 0x14, 0x3d, 0xff, 0x17, 0x22, 0x49, 0xff, 0x0e, 0x20, 0x48, 0xff, 0x0a, 0x23, 0x49, 0xff, 0x1f, 0x42, 0x67, 0xff, 0x42, 0x75, 0x99, 0xff, 0x55, 0x92, 0xb6, 0xff, 0x50, 0x8a, 0xb0, 0xff, 0x59, 0x8b, 0xb3, 0xff, 0x60, 0x8c, 0xb4, 0xff, 0x67, 0x8d, 0xb4, 0xff, 0x66, 0x8a, 0xb0, 0xff, 0x61, 0x86, 0xac, 0xff, 0x58, 0x82, 0xa5, 0xff, 0x50, 0x7d, 0x9c, 0xff, 0x3e, 0x76, 0x9b, 0xff, 0x3e, 0x74, 0xa0, 0xff, 0x54, 0x79, 0xa3, 0xff, 0x65, 0x7f, 0xa5, 0xff, 0x31, 0x42, 0x5d, 0xff, 0x00, 0x00, 0x07, 0xff, 0x09, 0x04, 0x00, 0xff, 0x1c, 0x13, 0x00, 0xff, 0x1a, 0x13, 0x06, 0xff, 0x17, 0x12, 0x0a, 0xff, 0x18, 0x13, 0x0a, 0xff, 0x14, 0x0f, 0x06, 0xff, 0x0e, 0x08, 0x02, 0xff, 0x0b, 0x05, 0x00, 0xff, 0x0d, 0x07, 0x01, 0xff, 0x10, 0x0a, 0x04, 0xff, 0x0e, 0x08, 0x01, 0xff, 0x0c, 0x06, 0x00, 0xff, 0x0f, 0x09, 0x02, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x0e, 0x09, 0x01, 0x8b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0b, 0x05, 0x57, 0x14, 0x0e, 0x08, 0xf3, 0x13, 0x0d, 0x06, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x10, 0x0b, 0x03, 0xff, 0x0e, 0x09, 0x02, 0xff, 0x0e, 0x08, 0x01, 0xff, 0x10, 0x0b, 0x03, 0xff, 0x13, 0x0e, 0x07, 0xff, 0x13, 0x0e, 0x06, 0xff, 0x0f, 0x0a, 0x03, 0xff, 0x10, 0x0b, 0x04, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x10, 0x0b, 0x03, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x0f, 0x0a, 0x02, 0xff, 0x08, 0x05, 0x02, 0xff, 0x0a, 0x07, 0x02, 0xff, 0x10, 0x0b, 0x02, 0xff, 0x13, 0x0d, 0x02, 0xff, 0x06, 0x03, 0x00, 0xff, 0x00, 0x00, 0x05, 0xff, 0x07, 0x12, 0x29, 0xff, 0x28, 0x39, 0x5c, 0xff, 0x39, 0x53, 0x83, 0xff, 0x39, 0x5e, 0x94, 0xff, 0x34, 0x60, 0xa0, 0xff, 0x32, 0x62, 0xa7, 0xff, 0x34, 0x63, 0xa4, 0xff, 0x3a, 0x65, 0xa1, 0xff, 0x34, 0x5f, 0x9a, 0xff, 0x32, 0x60, 0xa1, 0xff, 0x33, 0x63, 0xa8, 0xff, 0x36, 0x64, 0xa3, 0xff, 0x32, 0x5c, 0x95, 0xff, 0x2c, 0x52, 0x86, 0xff, 0x23, 0x4b, 0x76, 0xff, 0x25, 0x47, 0x71, 0xff, 0x2a, 0x49, 0x71, 0xff, 0x1a, 0x37, 0x5f, 0xff, 0x23, 0x3e, 0x68, 0xff, 0x36, 0x56, 0x7f, 0xff, 0x45, 0x66, 0x8f, 0xff, 0x59, 0x7f, 0xa9, 0xff, 0x5f, 0x8a, 0xb4, 0xff, 0x64, 0x91, 0xbb, 0xff, 0x60, 0x8e, 0xba, 0xff, 0x64, 0x93, 0xbb, 0xff, 0x64, 0x92, 0xb7, 0xff, 0x68, 0x95, 0xb9, 0xff, 0x6b, 0x93, 0xb7, 0xff, 0x6b, 0x93, 0xb6, 0xff, 0x67, 0x91, 0xb5, 0xff, 0x5f, 0x8b, 0xaf, 0xff, 0x56, 0x84, 0xa9, 0xff, 0x4c, 0x81, 0xa6, 0xff, 0x59, 0x86, 0xac, 0xff, 0x5f, 0x79, 0x99, 0xff, 0x29, 0x37, 0x4c, 0xff, 0x00, 0x00, 0x05, 0xff, 0x03, 0x01, 0x00, 0xff, 0x13, 0x10, 0x07, 0xff, 0x1b, 0x11, 0x02, 0xff, 0x18, 0x12, 0x06, 0xff, 0x15, 0x11, 0x09, 0xff, 0x16, 0x11, 0x08, 0xff, 0x0d, 0x08, 0x00, 0xff, 0x0a, 0x04, 0x00, 0xff, 0x0c, 0x06, 0x01, 0xff, 0x0b, 0x05, 0x01, 0xff, 0x0d, 0x06, 0x03, 0xff, 0x0e, 0x08, 0x02, 0xff, 0x0d, 0x07, 0x00, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x0f, 0x0a, 0x03, 0xf3, 0x0e, 0x08, 0x02, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0b, 0x05, 0x2b, 0x13, 0x0d, 0x06, 0xd2, 0x10, 0x0b, 0x04, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x0f, 0x09, 0x02, 0xff, 0x0f, 0x09, 0x02, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x0d, 0x07, 0x00, 0xff, 0x12, 0x0b, 0x04, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x13, 0x0c, 0x06, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x10, 0x09, 0x03, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x12, 0x0b, 0x04, 0xff, 0x13, 0x0c, 0x05, 0xff, 0x0d, 0x0a, 0x09, 0xff, 0x05, 0x03, 0x02, 0xff, 0x0a, 0x07, 0x02, 0xff, 0x12, 0x0f, 0x07, 0xff, 0x0c, 0x0b, 0x04, 0xff, 0x04, 0x04, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0c, 0x0e, 0x1d, 0xff, 0x29, 0x3f, 0x5e, 0xff, 0x3e, 0x62, 0x90, 0xff, 0x3c, 0x66, 0x9f, 0xff, 0x3e, 0x67, 0xa4, 0xff, 0x3f, 0x6a, 0xa2, 0xff, 0x49, 0x73, 0xa9, 0xff, 0x4a, 0x74, 0xa9, 0xff, 0x3c, 0x6a, 0xa6, 0xff, 0x2e, 0x65, 0xad, 0xff, 0x31, 0x67, 0xaa, 0xff, 0x33, 0x6a, 0xa7, 0xff, 0x37, 0x6d, 0xa5, 0xff, 0x3b, 0x6c, 0x9e, 0xff, 0x3e, 0x6b, 0x9f, 0xff, 0x47, 0x73, 0xa9, 0xff, 0x4e, 0x7d, 0xad, 0xff, 0x54, 0x88, 0xac, 0xff, 0x56, 0x86, 0xac, 0xff, 0x5a, 0x88, 0xae, 0xff, 0x5f, 0x88, 0xb0, 0xff, 0x67, 0x8a, 0xb5, 0xff, 0x6e, 0x91, 0xbb, 0xff, 0x76, 0x95, 0xc0, 0xff, 0x7b, 0x9b, 0xc5, 0xff, 0x78, 0x9c, 0xc3, 0xff, 0x75, 0x9e, 0xc3, 0xff, 0x70, 0x9c, 0xbf, 0xff, 0x66, 0x95, 0xb8, 0xff, 0x63, 0x94, 0xb8, 0xff, 0x61, 0x8e, 0xb8, 0xff, 0x5c, 0x88, 0xb8, 0xff, 0x68, 0x93, 0xb9, 0xff, 0x5a, 0x78, 0x96, 0xff, 0x20, 0x26, 0x39, 0xff, 0x00, 0x00, 0x01, 0xff, 0x06, 0x04, 0x00, 0xff, 0x0c, 0x0f, 0x03, 0xff, 0x11, 0x0f, 0x06, 0xff, 0x13, 0x0c, 0x0a, 0xff, 0x16, 0x10, 0x0a, 0xff, 0x13, 0x0e, 0x04, 0xff, 0x11, 0x0c, 0x04, 0xff, 0x11, 0x0a, 0x04, 0xff, 0x0f, 0x08, 0x05, 0xff, 0x0e, 0x08, 0x05, 0xff, 0x0e, 0x07, 0x05, 0xff, 0x0e, 0x06, 0x06, 0xff, 0x0f, 0x09, 0x03, 0xff, 0x10, 0x0a, 0x02, 0xff, 0x0e, 0x08, 0x01, 0xd2, 0x11, 0x0b, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x08, 0x13, 0x0e, 0x07, 0x8f, 0x13, 0x0d, 0x06, 0xfe, 0x10, 0x0a, 0x03, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x0e, 0x08, 0x01, 0xff, 0x0e, 0x08, 0x01, 0xff, 0x12, 0x0b, 0x03, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x0c, 0x0a, 0x09, 0xff, 0x08, 0x07, 0x07, 0xff, 0x06, 0x05, 0x02, 0xff, 0x09, 0x08, 0x03, 0xff, 0x0f, 0x0e, 0x08, 0xff, 0x0e, 0x0a, 0x05, 0xff, 0x09, 0x04, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x00, 0x04, 0x17, 0xff, 0x18, 0x2b, 0x51, 0xff, 0x32, 0x56, 0x88, 0xff, 0x44, 0x6d, 0xa2, 0xff, 0x4b, 0x74, 0xa6, 0xff, 0x4e, 0x77, 0xab, 0xff, 0x51, 0x7b, 0xad, 0xff, 0x53, 0x7b, 0xab, 0xff, 0x55, 0x7a, 0xaa, 0xff, 0x56, 0x7c, 0xaa, 0xff, 0x54, 0x7d, 0xa9, 0xff, 0x54, 0x7e, 0xa8, 0xff, 0x52, 0x7c, 0xa8, 0xff, 0x52, 0x79, 0xa8, 0xff, 0x50, 0x78, 0xa9, 0xff, 0x52, 0x7f, 0xac, 0xff, 0x57, 0x88, 0xad, 0xff, 0x5d, 0x8c, 0xb2, 0xff, 0x63, 0x91, 0xb8, 0xff, 0x6c, 0x97, 0xbd, 0xff, 0x72, 0x9c, 0xbe, 0xff, 0x77, 0xa0, 0xc2, 0xff, 0x7a, 0xa2, 0xc3, 0xff, 0x80, 0xa3, 0xc8, 0xff, 0x7d, 0x9f, 0xc6, 0xff, 0x71, 0x9b, 0xbe, 0xff, 0x69, 0x9b, 0xbb, 0xff, 0x61, 0x96, 0xb6, 0xff, 0x65, 0x97, 0xbb, 0xff, 0x65, 0x90, 0xbe, 0xff, 0x59, 0x84, 0xbd, 0xff, 0x44, 0x60, 0x8d, 0xff, 0x10, 0x18, 0x2d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x10, 0x0b, 0x01, 0xff, 0x15, 0x13, 0x01, 0xff, 0x14, 0x13, 0x01, 0xff, 0x12, 0x0f, 0x07, 0xff, 0x10, 0x0b, 0x10, 0xff, 0x0f, 0x0a, 0x05, 0xff, 0x11, 0x0b, 0x01, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x12, 0x0b, 0x07, 0xff, 0x12, 0x0b, 0x08, 0xff, 0x12, 0x0b, 0x08, 0xff, 0x10, 0x08, 0x07, 0xff, 0x10, 0x09, 0x03, 0xfe, 0x10, 0x0a, 0x03, 0x8f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0f, 0x07, 0x42, 0x13, 0x0d, 0x06, 0xdb, 0x11, 0x0b, 0x04, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x14, 0x0e, 0x07, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x0f, 0x09, 0x02, 0xff, 0x0d, 0x07, 0x00, 0xff, 0x0d, 0x07, 0x00, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x0c, 0x08, 0x05, 0xff, 0x0d, 0x0a, 0x07, 0xff, 0x0c, 0x09, 0x04, 0xff, 0x06, 0x04, 0x00, 0xff, 0x07, 0x07, 0x02, 0xff, 0x10, 0x0c, 0x07, 0xff, 0x0f, 0x0c, 0x05, 0xff, 0x0f, 0x09, 0x03, 0xff, 0x09, 0x02, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x03, 0x0e, 0x19, 0xff, 0x25, 0x39, 0x53, 0xff, 0x45, 0x64, 0x8a, 0xff, 0x58, 0x80, 0xb2, 0xff, 0x4e, 0x80, 0xc1, 0xff, 0x4f, 0x82, 0xbc, 0xff, 0x5e, 0x8c, 0xaa, 0xff, 0x64, 0x90, 0xaf, 0xff, 0x65, 0x8f, 0xb1, 0xff, 0x67, 0x92, 0xb2, 0xff, 0x67, 0x94, 0xb3, 0xff, 0x6b, 0x92, 0xb0, 0xff, 0x6e, 0x98, 0xb3, 0xff, 0x6f, 0x96, 0xb1, 0xff, 0x7a, 0x9a, 0xb7, 0xff, 0x7b, 0xa0, 0xbc, 0xff, 0x7a, 0xa3, 0xbe, 0xff, 0x7b, 0xa3, 0xc1, 0xff, 0x7c, 0xa4, 0xc3, 0xff, 0x7b, 0xa5, 0xc4, 0xff, 0x75, 0xa4, 0xbf, 0xff, 0x72, 0x9e, 0xc4, 0xff, 0x75, 0x9d, 0xd0, 0xff, 0x71, 0xa0, 0xcd, 0xff, 0x69, 0x9f, 0xca, 0xff, 0x64, 0x9b, 0xc2, 0xff, 0x61, 0x8f, 0xb0, 0xff, 0x48, 0x65, 0x81, 0xff, 0x20, 0x2e, 0x47, 0xff, 0x00, 0x01, 0x0b, 0xff, 0x03, 0x00, 0x00, 0xff, 0x0b, 0x09, 0x00, 0xff, 0x0f, 0x0c, 0x00, 0xff, 0x17, 0x11, 0x08, 0xff, 0x16, 0x11, 0x08, 0xff, 0x11, 0x0e, 0x06, 0xff, 0x0c, 0x08, 0x05, 0xff, 0x0f, 0x09, 0x04, 0xff, 0x13, 0x0d, 0x05, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x0d, 0x07, 0x01, 0xff, 0x0d, 0x07, 0x00, 0xff, 0x0f, 0x09, 0x03, 0xff, 0x11, 0x0c, 0x05, 0xff, 0x0f, 0x09, 0x03, 0xdb, 0x0f, 0x07, 0x03, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x00, 0x09, 0x14, 0x0d, 0x07, 0x87, 0x11, 0x0b, 0x04, 0xf9, 0x10, 0x0a, 0x03, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x17, 0x11, 0x0a, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x0f, 0x09, 0x02, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x11, 0x0c, 0x08, 0xff, 0x0d, 0x09, 0x06, 0xff, 0x0e, 0x0a, 0x06, 0xff, 0x0f, 0x0a, 0x07, 0xff, 0x0a, 0x05, 0x02, 0xff, 0x07, 0x03, 0x00, 0xff, 0x0b, 0x06, 0x03, 0xff, 0x11, 0x0c, 0x08, 0xff, 0x12, 0x0d, 0x04, 0xff, 0x0d, 0x08, 0x01, 0xff, 0x01, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0b, 0x11, 0x25, 0xff, 0x27, 0x38, 0x57, 0xff, 0x3c, 0x5c, 0x88, 0xff, 0x50, 0x79, 0xab, 0xff, 0x5e, 0x8e, 0xb8, 0xff, 0x6c, 0x9a, 0xc4, 0xff, 0x70, 0x9d, 0xc8, 0xff, 0x74, 0xa1, 0xcc, 0xff, 0x73, 0xa1, 0xc9, 0xff, 0x72, 0x9f, 0xc6, 0xff, 0x7a, 0xa5, 0xca, 0xff, 0x7c, 0xa5, 0xca, 0xff, 0x82, 0xa8, 0xcd, 0xff, 0x81, 0xaa, 0xce, 0xff, 0x7e, 0xab, 0xcd, 0xff, 0x7b, 0xa7, 0xce, 0xff, 0x7e, 0xa8, 0xd4, 0xff, 0x7e, 0xaa, 0xd5, 0xff, 0x78, 0xab, 0xd6, 0xff, 0x81, 0xaa, 0xd1, 0xff, 0x84, 0xa2, 0xc5, 0xff, 0x68, 0x8a, 0xaf, 0xff, 0x48, 0x6b, 0x91, 0xff, 0x2b, 0x48, 0x69, 0xff, 0x11, 0x22, 0x38, 0xff, 0x00, 0x03, 0x0e, 0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x02, 0x00, 0xff, 0x13, 0x0f, 0x00, 0xff, 0x12, 0x0f, 0x03, 0xff, 0x10, 0x0d, 0x04, 0xff, 0x12, 0x0e, 0x08, 0xff, 0x0e, 0x0a, 0x03, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x0c, 0x09, 0x00, 0xff, 0x12, 0x0d, 0x06, 0xff, 0x13, 0x0c, 0x05, 0xff, 0x0e, 0x08, 0x02, 0xff, 0x0d, 0x07, 0x01, 0xff, 0x0d, 0x07, 0x01, 0xff, 0x0e, 0x08, 0x02, 0xf9, 0x12, 0x0b, 0x03, 0x88, 0x1c, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0d, 0x06, 0x25, 0x0f, 0x08, 0x01, 0xb7, 0x0f, 0x09, 0x02, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x15, 0x0f, 0x08, 0xff, 0x14, 0x0e, 0x07, 0xff, 0x0f, 0x09, 0x02, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x16, 0x10, 0x09, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x0f, 0x09, 0x02, 0xff, 0x0f, 0x09, 0x02, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x10, 0x0b, 0x06, 0xff, 0x0d, 0x09, 0x05, 0xff, 0x0f, 0x0b, 0x06, 0xff, 0x0e, 0x0a, 0x06, 0xff, 0x0f, 0x0b, 0x06, 0xff, 0x0d, 0x08, 0x04, 0xff, 0x09, 0x05, 0x00, 0xff, 0x07, 0x04, 0x00, 0xff, 0x08, 0x0b, 0x07, 0xff, 0x10, 0x12, 0x10, 0xff, 0x11, 0x11, 0x0f, 0xff, 0x0c, 0x0a, 0x09, 0xff, 0x01, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x03, 0x05, 0x0c, 0xff, 0x17, 0x1d, 0x2d, 0xff, 0x1c, 0x2e, 0x53, 0xff, 0x2c, 0x45, 0x68, 0xff, 0x3d, 0x59, 0x7c, 0xff, 0x4e, 0x6b, 0x90, 0xff, 0x58, 0x76, 0x9c, 0xff, 0x60, 0x7e, 0xa4, 0xff, 0x6c, 0x88, 0xac, 0xff, 0x6e, 0x8c, 0xb1, 0xff, 0x6f, 0x93, 0xb6, 0xff, 0x70, 0x94, 0xb7, 0xff, 0x70, 0x95, 0xb7, 0xff, 0x6f, 0x91, 0xb5, 0xff, 0x6a, 0x8c, 0xb3, 0xff, 0x63, 0x86, 0xab, 0xff, 0x4a, 0x72, 0x9b, 0xff, 0x3e, 0x57, 0x71, 0xff, 0x32, 0x35, 0x3f, 0xff, 0x10, 0x15, 0x22, 0xff, 0x00, 0x00, 0x10, 0xff, 0x00, 0x00, 0x05, 0xff, 0x00, 0x00, 0x00, 0xff, 0x09, 0x02, 0x00, 0xff, 0x15, 0x0a, 0x05, 0xff, 0x15, 0x0e, 0x08, 0xff, 0x12, 0x10, 0x09, 0xff, 0x0f, 0x0c, 0x06, 0xff, 0x0b, 0x08, 0x02, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x0c, 0x0a, 0x02, 0xff, 0x0e, 0x0b, 0x03, 0xff, 0x0f, 0x0d, 0x05, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x0f, 0x09, 0x02, 0xff, 0x0f, 0x09, 0x01, 0xb7, 0x0d, 0x06, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x07, 0x00, 0x46, 0x11, 0x0c, 0x05, 0xca, 0x13, 0x0d, 0x06, 0xff, 0x14, 0x0e, 0x07, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x14, 0x0e, 0x07, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x13, 0x0e, 0x06, 0xff, 0x10, 0x0d, 0x05, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x0d, 0x0b, 0x03, 0xff, 0x11, 0x0e, 0x06, 0xff, 0x11, 0x0d, 0x05, 0xff, 0x0a, 0x08, 0x01, 0xff, 0x00, 0x02, 0x01, 0xff, 0x05, 0x05, 0x03, 0xff, 0x0f, 0x0b, 0x06, 0xff, 0x17, 0x10, 0x08, 0xff, 0x15, 0x0e, 0x05, 0xff, 0x15, 0x0d, 0x04, 0xff, 0x11, 0x06, 0x00, 0xff, 0x08, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0xff, 0x00, 0x02, 0x0b, 0xff, 0x07, 0x0a, 0x12, 0xff, 0x0e, 0x10, 0x19, 0xff, 0x10, 0x14, 0x1d, 0xff, 0x0d, 0x17, 0x1d, 0xff, 0x0c, 0x15, 0x1c, 0xff, 0x0d, 0x16, 0x1d, 0xff, 0x0f, 0x16, 0x1e, 0xff, 0x0e, 0x12, 0x1b, 0xff, 0x03, 0x0a, 0x12, 0xff, 0x00, 0x00, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0xff, 0x0e, 0x01, 0x00, 0xff, 0x14, 0x04, 0x03, 0xff, 0x18, 0x0a, 0x04, 0xff, 0x1b, 0x0e, 0x03, 0xff, 0x1e, 0x10, 0x03, 0xff, 0x14, 0x0b, 0x04, 0xff, 0x09, 0x06, 0x03, 0xff, 0x08, 0x03, 0x00, 0xff, 0x09, 0x04, 0x00, 0xff, 0x0e, 0x0a, 0x03, 0xff, 0x11, 0x0d, 0x05, 0xff, 0x11, 0x0d, 0x05, 0xff, 0x10, 0x0b, 0x04, 0xff, 0x0f, 0x0a, 0x03, 0xff, 0x0f, 0x09, 0x02, 0xff, 0x0c, 0x07, 0x01, 0xca, 0x0e, 0x07, 0x03, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x09, 0x4d, 0x14, 0x0d, 0x07, 0xcc, 0x14, 0x0e, 0x07, 0xff, 0x14, 0x0e, 0x07, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x13, 0x0c, 0x06, 0xff, 0x10, 0x0c, 0x04, 0xff, 0x0e, 0x0c, 0x03, 0xff, 0x0f, 0x0c, 0x04, 0xff, 0x10, 0x0d, 0x04, 0xff, 0x13, 0x11, 0x08, 0xff, 0x14, 0x12, 0x09, 0xff, 0x13, 0x10, 0x08, 0xff, 0x13, 0x10, 0x08, 0xff, 0x11, 0x0d, 0x07, 0xff, 0x0c, 0x07, 0x02, 0xff, 0x0d, 0x05, 0x00, 0xff, 0x0d, 0x05, 0x00, 0xff, 0x12, 0x09, 0x02, 0xff, 0x17, 0x11, 0x0a, 0xff, 0x12, 0x0f, 0x0a, 0xff, 0x10, 0x0b, 0x04, 0xff, 0x18, 0x0e, 0x00, 0xff, 0x17, 0x0b, 0x00, 0xff, 0x13, 0x08, 0x00, 0xff, 0x0f, 0x05, 0x00, 0xff, 0x0e, 0x04, 0x00, 0xff, 0x0a, 0x00, 0x00, 0xff, 0x05, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0xff, 0x09, 0x00, 0x00, 0xff, 0x0c, 0x00, 0x00, 0xff, 0x14, 0x02, 0x00, 0xff, 0x0d, 0x09, 0x00, 0xff, 0x06, 0x0d, 0x01, 0xff, 0x11, 0x0e, 0x05, 0xff, 0x1b, 0x0f, 0x07, 0xff, 0x1a, 0x0c, 0x05, 0xff, 0x17, 0x0c, 0x03, 0xff, 0x11, 0x0d, 0x02, 0xff, 0x0a, 0x0a, 0x00, 0xff, 0x0d, 0x09, 0x01, 0xff, 0x0f, 0x09, 0x02, 0xff, 0x13, 0x0d, 0x05, 0xff, 0x16, 0x10, 0x08, 0xff, 0x15, 0x0f, 0x07, 0xff, 0x14, 0x0e, 0x07, 0xff, 0x14, 0x0d, 0x06, 0xff, 0x13, 0x0c, 0x05, 0xff, 0x11, 0x0a, 0x02, 0xcc, 0x0d, 0x06, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x0f, 0x07, 0x41, 0x16, 0x0f, 0x08, 0xb4, 0x11, 0x0b, 0x04, 0xfe, 0x0f, 0x09, 0x02, 0xff, 0x0e, 0x08, 0x01, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x14, 0x0e, 0x07, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x16, 0x10, 0x09, 0xff, 0x17, 0x11, 0x0a, 0xff, 0x11, 0x0c, 0x05, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x12, 0x0d, 0x06, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x10, 0x0a, 0x04, 0xff, 0x17, 0x0f, 0x05, 0xff, 0x1b, 0x14, 0x09, 0xff, 0x18, 0x12, 0x07, 0xff, 0x11, 0x0c, 0x02, 0xff, 0x0c, 0x09, 0x02, 0xff, 0x07, 0x05, 0x02, 0xff, 0x03, 0x03, 0x08, 0xff, 0x05, 0x06, 0x09, 0xff, 0x0e, 0x0c, 0x04, 0xff, 0x13, 0x11, 0x09, 0xff, 0x11, 0x11, 0x09, 0xff, 0x0e, 0x0d, 0x07, 0xff, 0x0d, 0x0c, 0x07, 0xff, 0x0c, 0x0d, 0x07, 0xff, 0x08, 0x0c, 0x06, 0xff, 0x07, 0x08, 0x04, 0xff, 0x09, 0x04, 0x04, 0xff, 0x09, 0x05, 0x04, 0xff, 0x0d, 0x0a, 0x06, 0xff, 0x10, 0x0c, 0x08, 0xff, 0x11, 0x0a, 0x07, 0xff, 0x14, 0x0b, 0x08, 0xff, 0x18, 0x0e, 0x09, 0xff, 0x12, 0x0f, 0x0a, 0xff, 0x0d, 0x0f, 0x09, 0xff, 0x10, 0x0f, 0x06, 0xff, 0x10, 0x0d, 0x05, 0xff, 0x0e, 0x0b, 0x03, 0xff, 0x0b, 0x08, 0x00, 0xff, 0x07, 0x09, 0x00, 0xff, 0x06, 0x0d, 0x04, 0xff, 0x10, 0x0f, 0x06, 0xff, 0x14, 0x0d, 0x04, 0xff, 0x15, 0x10, 0x06, 0xff, 0x13, 0x0e, 0x05, 0xff, 0x10, 0x0b, 0x02, 0xff, 0x13, 0x0e, 0x06, 0xfe, 0x15, 0x0f, 0x08, 0xb4, 0x13, 0x0f, 0x03, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x07, 0x23, 0x0f, 0x09, 0x01, 0x88, 0x0f, 0x08, 0x02, 0xe6, 0x13, 0x0d, 0x06, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x14, 0x0e, 0x07, 0xff, 0x15, 0x0f, 0x08, 0xff, 0x13, 0x0c, 0x06, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x12, 0x0b, 0x04, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x11, 0x0b, 0x04, 0xff, 0x10, 0x0a, 0x03, 0xff, 0x0f, 0x0b, 0x02, 0xff, 0x11, 0x0c, 0x02, 0xff, 0x17, 0x10, 0x05, 0xff, 0x1a, 0x12, 0x06, 0xff, 0x16, 0x11, 0x08, 0xff, 0x0f, 0x0a, 0x04, 0xff, 0x09, 0x05, 0x03, 0xff, 0x05, 0x03, 0x04, 0xff, 0x01, 0x02, 0x04, 0xff, 0x03, 0x05, 0x06, 0xff, 0x06, 0x09, 0x0a, 0xff, 0x06, 0x09, 0x0a, 0xff, 0x07, 0x09, 0x0a, 0xff, 0x0e, 0x0c, 0x0d, 0xff, 0x11, 0x0f, 0x0f, 0xff, 0x10, 0x0f, 0x10, 0xff, 0x0f, 0x0e, 0x10, 0xff, 0x0f, 0x0e, 0x0f, 0xff, 0x0f, 0x0e, 0x0f, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x0d, 0x0d, 0x0b, 0xff, 0x0c, 0x0c, 0x0a, 0xff, 0x09, 0x0a, 0x08, 0xff, 0x10, 0x0b, 0x08, 0xff, 0x14, 0x0a, 0x04, 0xff, 0x0d, 0x09, 0x01, 0xff, 0x0c, 0x0a, 0x02, 0xff, 0x0e, 0x0e, 0x04, 0xff, 0x10, 0x0f, 0x05, 0xff, 0x10, 0x0e, 0x04, 0xff, 0x10, 0x0c, 0x03, 0xff, 0x11, 0x0c, 0x03, 0xff, 0x15, 0x0f, 0x07, 0xff, 0x11, 0x0c, 0x03, 0xff, 0x0f, 0x09, 0x01, 0xe7, 0x12, 0x0d, 0x03, 0x88, 0x15, 0x0e, 0x07, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x14, 0x11, 0x0a, 0x4a, 0x14, 0x0e, 0x06, 0xa0, 0x12, 0x0b, 0x05, 0xef, 0x14, 0x0e, 0x07, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x0f, 0x09, 0x02, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x14, 0x0d, 0x06, 0xff, 0x12, 0x0d, 0x06, 0xff, 0x10, 0x0e, 0x06, 0xff, 0x12, 0x0d, 0x06, 0xff, 0x18, 0x10, 0x07, 0xff, 0x19, 0x11, 0x08, 0xff, 0x14, 0x0d, 0x03, 0xff, 0x15, 0x0d, 0x05, 0xff, 0x18, 0x10, 0x09, 0xff, 0x15, 0x0f, 0x09, 0xff, 0x0e, 0x09, 0x06, 0xff, 0x0e, 0x08, 0x03, 0xff, 0x0c, 0x06, 0x01, 0xff, 0x0a, 0x05, 0x00, 0xff, 0x0d, 0x06, 0x00, 0xff, 0x10, 0x06, 0x01, 0xff, 0x12, 0x07, 0x03, 0xff, 0x13, 0x08, 0x04, 0xff, 0x10, 0x09, 0x04, 0xff, 0x0f, 0x09, 0x02, 0xff, 0x0f, 0x08, 0x01, 0xff, 0x0e, 0x08, 0x01, 0xff, 0x0d, 0x0b, 0x01, 0xff, 0x0e, 0x0b, 0x00, 0xff, 0x0f, 0x0c, 0x00, 0xff, 0x14, 0x0a, 0x01, 0xff, 0x19, 0x0b, 0x06, 0xff, 0x18, 0x11, 0x0a, 0xff, 0x15, 0x13, 0x09, 0xff, 0x11, 0x11, 0x06, 0xff, 0x0d, 0x0c, 0x02, 0xff, 0x11, 0x0b, 0x02, 0xff, 0x17, 0x0d, 0x04, 0xff, 0x17, 0x10, 0x07, 0xef, 0x14, 0x11, 0x07, 0xa0, 0x11, 0x0a, 0x03, 0x4a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x07, 0x12, 0x0a, 0x03, 0x46, 0x10, 0x0a, 0x03, 0x8e, 0x0d, 0x07, 0x00, 0xd7, 0x0c, 0x06, 0x00, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x12, 0x0c, 0x05, 0xff, 0x0f, 0x09, 0x02, 0xff, 0x14, 0x0c, 0x07, 0xff, 0x13, 0x0d, 0x06, 0xff, 0x0f, 0x0a, 0x03, 0xff, 0x10, 0x0c, 0x04, 0xff, 0x15, 0x0d, 0x06, 0xff, 0x15, 0x0c, 0x05, 0xff, 0x16, 0x0d, 0x06, 0xff, 0x15, 0x0e, 0x05, 0xff, 0x12, 0x0d, 0x04, 0xff, 0x17, 0x10, 0x07, 0xff, 0x19, 0x11, 0x08, 0xff, 0x19, 0x11, 0x08, 0xff, 0x18, 0x11, 0x07, 0xff, 0x13, 0x0d, 0x04, 0xff, 0x10, 0x0d, 0x03, 0xff, 0x11, 0x0c, 0x04, 0xff, 0x11, 0x09, 0x03, 0xff, 0x11, 0x0a, 0x03, 0xff, 0x15, 0x0e, 0x06, 0xff, 0x16, 0x11, 0x07, 0xff, 0x14, 0x10, 0x05, 0xff, 0x14, 0x11, 0x05, 0xff, 0x16, 0x13, 0x05, 0xff, 0x15, 0x0e, 0x04, 0xff, 0x16, 0x0c, 0x07, 0xff, 0x17, 0x11, 0x08, 0xff, 0x14, 0x0f, 0x06, 0xff, 0x0f, 0x0b, 0x02, 0xff, 0x0e, 0x09, 0x02, 0xd7, 0x11, 0x0c, 0x03, 0x8e, 0x15, 0x0e, 0x07, 0x46, 0x24, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x09, 0x00, 0x1b, 0x0f, 0x09, 0x00, 0x55, 0x0e, 0x07, 0x01, 0x8f, 0x0e, 0x09, 0x02, 0xc2, 0x12, 0x0b, 0x06, 0xea, 0x0e, 0x08, 0x01, 0xff, 0x0c, 0x07, 0x00, 0xff, 0x12, 0x0d, 0x06, 0xff, 0x14, 0x0e, 0x07, 0xff, 0x13, 0x0c, 0x05, 0xff, 0x11, 0x0a, 0x04, 0xff, 0x0f, 0x0a, 0x02, 0xff, 0x10, 0x0b, 0x02, 0xff, 0x0f, 0x0b, 0x02, 0xff, 0x14, 0x0f, 0x07, 0xff, 0x1a, 0x15, 0x0c, 0xff, 0x17, 0x13, 0x0a, 0xff, 0x16, 0x13, 0x09, 0xff, 0x14, 0x11, 0x07, 0xff, 0x12, 0x0e, 0x05, 0xff, 0x16, 0x10, 0x0a, 0xff, 0x13, 0x0e, 0x07, 0xff, 0x11, 0x0c, 0x06, 0xff, 0x13, 0x10, 0x06, 0xff, 0x18, 0x13, 0x0a, 0xff, 0x19, 0x15, 0x0a, 0xff, 0x16, 0x13, 0x09, 0xff, 0x15, 0x11, 0x07, 0xea, 0x17, 0x12, 0x0a, 0xc2, 0x13, 0x0e, 0x05, 0x8f, 0x0f, 0x09, 0x00, 0x55, 0x12, 0x09, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x11, 0x12, 0x0d, 0x04, 0x37, 0x15, 0x10, 0x08, 0x5f, 0x11, 0x0b, 0x05, 0x86, 0x12, 0x0c, 0x04, 0xa8, 0x12, 0x0d, 0x06, 0xc0, 0x12, 0x0d, 0x06, 0xd3, 0x15, 0x0f, 0x05, 0xe6, 0x13, 0x0d, 0x05, 0xee, 0x12, 0x0e, 0x05, 0xf5, 0x13, 0x0e, 0x05, 0xff, 0x12, 0x0d, 0x04, 0xff, 0x13, 0x0d, 0x06, 0xf5, 0x16, 0x12, 0x08, 0xee, 0x13, 0x0e, 0x05, 0xe6, 0x14, 0x0e, 0x07, 0xd3, 0x12, 0x0d, 0x06, 0xc0, 0x13, 0x0d, 0x06, 0xa8, 0x14, 0x0f, 0x07, 0x86, 0x18, 0x12, 0x08, 0x5f, 0x17, 0x17, 0x09, 0x37, 0x1e, 0x0f, 0x0f, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const lv_image_dsc_t img_multilang_avatar_7 = {
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .header.w = 128,
+    .header.h = 128,
+    .header.stride = 512,
+    .data = img_multilang_avatar_7_map,
+    .data_size = sizeof(img_multilang_avatar_7_map),
+};
+
+#endif
@@ -0,0 +1,166 @@
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+#if LV_USE_DEMO_MULTILANG
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_9
+    #define LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_9
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_MULTILANG_AVATAR_9 uint8_t
+img_multilang_avatar_9_map[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x87, 0x4b, 0x11, 0xa6, 0x8b, 0x53, 0x37, 0xa5, 0x8a, 0x51, 0x5e, 0xa5, 0x8a, 0x51, 0x86, 0xa5, 0x8a, 0x50, 0xa8, 0xa5, 0x89, 0x51, 0xbf, 0xa5, 0x8a, 0x51, 0xd2, 0xa4, 0x8a, 0x51, 0xe5, 0xa5, 0x8a, 0x51, 0xee, 0xa5, 0x8a, 0x51, 0xf2, 0xa5, 0x8a, 0x51, 0xff, 0xa5, 0x8a, 0x51, 0xff, 0xa5, 0x8a, 0x51, 0xf2, 0xa7, 0x8c, 0x52, 0xee, 0xa7, 0x8c, 0x53, 0xe5, 0xa7, 0x8b, 0x52, 0xd2, 0xa6, 0x8c, 0x52, 0xbf, 0xa6, 0x8b, 0x53, 0xa8, 0xa7, 0x8c, 0x53, 0x86, 0xa8, 0x8d, 0x54, 0x5e, 0xa6, 0x8b, 0x53, 0x37, 0xa5, 0x87, 0x5a, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x8e, 0x51, 0x19, 0xa8, 0x8d, 0x54, 0x55, 0xa5, 0x89, 0x50, 0x8f, 0xa5, 0x89, 0x50, 0xc1, 0xa5, 0x89, 0x50, 0xe9, 0xa6, 0x8b, 0x52, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa6, 0x8b, 0x52, 0xff, 0xa6, 0x8b, 0x52, 0xff, 0xa6, 0x8b, 0x52, 0xff, 0xa6, 0x8b, 0x52, 0xff, 0xa6, 0x8b, 0x52, 0xff, 0xa6, 0x8b, 0x52, 0xff, 0xa6, 0x8b, 0x52, 0xff, 0xa6, 0x8b, 0x52, 0xff, 0xa6, 0x8b, 0x52, 0xff, 0xa6, 0x8b, 0x52, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xe9, 0xa7, 0x8d, 0x54, 0xc1, 0xa7, 0x8c, 0x53, 0x8f, 0xa8, 0x8d, 0x54, 0x55, 0xa3, 0x8e, 0x51, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x91, 0x48, 0x07, 0xa7, 0x8a, 0x53, 0x46, 0xa7, 0x8c, 0x52, 0x8e, 0xa7, 0x8b, 0x53, 0xd7, 0xa7, 0x8c, 0x53, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa6, 0x8b, 0x52, 0xff, 0xa6, 0x8b, 0x52, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xd7, 0xa8, 0x8d, 0x54, 0x8e, 0xa7, 0x8e, 0x53, 0x46, 0xb6, 0x91, 0x48, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x66, 0x05, 0xa6, 0x8d, 0x55, 0x48, 0xa8, 0x8d, 0x53, 0x9f, 0xa6, 0x8a, 0x52, 0xef, 0xa6, 0x8b, 0x52, 0xff, 0xa6, 0x8b, 0x52, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa6, 0x8b, 0x52, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa7, 0x8c, 0x54, 0xef, 0xa8, 0x8e, 0x55, 0x9f, 0xaa, 0x91, 0x58, 0x48, 0x99, 0x99, 0x66, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x8a, 0x57, 0x23, 0xa7, 0x8c, 0x53, 0x86, 0xa8, 0x8d, 0x53, 0xe5, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa6, 0x8b, 0x52, 0xff, 0xa6, 0x8b, 0x52, 0xff, 0xa6, 0x8b, 0x52, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x8f, 0x56, 0xe5, 0xa9, 0x8e, 0x55, 0x86, 0xa7, 0x91, 0x57, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x8d, 0x52, 0x41, 0xa8, 0x8d, 0x53, 0xb4, 0xa7, 0x8c, 0x54, 0xfe, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa6, 0x8b, 0x52, 0xff, 0xa6, 0x8b, 0x52, 0xff, 0xa6, 0x8b, 0x52, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xa9, 0x8e, 0x56, 0xfe, 0xaa, 0x8f, 0x56, 0xb4, 0xa8, 0x8d, 0x56, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x8c, 0x53, 0x4c, 0xa7, 0x8b, 0x52, 0xcb, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa6, 0x8b, 0x52, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8f, 0x55, 0xcb, 0xac, 0x8e, 0x56, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x8e, 0x53, 0x46, 0xa7, 0x8c, 0x53, 0xc9, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x90, 0x57, 0xff, 0xac, 0x91, 0x58, 0xff, 0xad, 0x92, 0x59, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xc9, 0xab, 0x91, 0x57, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x8d, 0x55, 0x24, 0xa8, 0x8d, 0x53, 0xb4, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xad, 0x92, 0x59, 0xff, 0xac, 0x91, 0x58, 0xff, 0xab, 0x90, 0x57, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xac, 0x91, 0x58, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x57, 0xb5, 0xaa, 0x8d, 0x55, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x8d, 0x55, 0x09, 0xa8, 0x8d, 0x53, 0x87, 0xa7, 0x8d, 0x53, 0xf9, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xac, 0x91, 0x58, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xac, 0x91, 0x58, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xf9, 0xab, 0x8f, 0x56, 0x87, 0xaa, 0x8d, 0x55, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x8b, 0x53, 0x40, 0xa8, 0x8d, 0x54, 0xda, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x90, 0x57, 0xff, 0xac, 0x91, 0x58, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xac, 0x91, 0x58, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xa9, 0x8e, 0x56, 0xda, 0xac, 0x91, 0x56, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x91, 0x48, 0x07, 0xa8, 0x8d, 0x54, 0x8e, 0xa7, 0x8c, 0x54, 0xfe, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xa9, 0x8f, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x90, 0x58, 0xff, 0xac, 0x91, 0x59, 0xff, 0xab, 0x8f, 0x58, 0xff, 0xac, 0x90, 0x58, 0xff, 0xac, 0x8f, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x8f, 0x58, 0xff, 0xab, 0x8f, 0x58, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xac, 0x90, 0x57, 0xff, 0xab, 0x8f, 0x57, 0xff, 0xac, 0x90, 0x59, 0xff, 0xad, 0x91, 0x59, 0xff, 0xab, 0x91, 0x58, 0xff, 0xac, 0x90, 0x58, 0xff, 0xac, 0x8f, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x8f, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xad, 0x92, 0x59, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x57, 0xfe, 0xaa, 0x8f, 0x56, 0x8e, 0xb6, 0x91, 0x48, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x8f, 0x57, 0x29, 0xa9, 0x8d, 0x55, 0xd1, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x8f, 0x57, 0xff, 0xab, 0x8f, 0x57, 0xff, 0xaa, 0x8e, 0x56, 0xff, 0xaa, 0x8e, 0x55, 0xff, 0xad, 0x90, 0x53, 0xff, 0xab, 0x8f, 0x54, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xac, 0x90, 0x55, 0xff, 0xae, 0x92, 0x54, 0xff, 0xad, 0x93, 0x54, 0xff, 0xab, 0x92, 0x54, 0xff, 0xaa, 0x93, 0x55, 0xff, 0xab, 0x91, 0x55, 0xff, 0xad, 0x92, 0x55, 0xff, 0xad, 0x93, 0x55, 0xff, 0xab, 0x8f, 0x56, 0xff, 0xab, 0x91, 0x58, 0xff, 0xa9, 0x90, 0x59, 0xff, 0xaa, 0x90, 0x59, 0xff, 0xad, 0x93, 0x55, 0xff, 0xaa, 0x93, 0x54, 0xff, 0xaa, 0x94, 0x56, 0xff, 0xaf, 0x94, 0x5a, 0xff, 0xaa, 0x91, 0x55, 0xff, 0xa8, 0x92, 0x58, 0xff, 0xab, 0x90, 0x59, 0xff, 0xab, 0x90, 0x57, 0xff, 0xac, 0x92, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xad, 0x92, 0x59, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xad, 0x92, 0x59, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xad, 0x92, 0x59, 0xd1, 0xae, 0x8f, 0x57, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x8b, 0x53, 0x56, 0xa8, 0x8d, 0x55, 0xf3, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa8, 0x8d, 0x54, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x91, 0x56, 0xff, 0xa9, 0x91, 0x52, 0xff, 0xaa, 0x91, 0x53, 0xff, 0xa9, 0x92, 0x54, 0xff, 0xa6, 0x91, 0x57, 0xff, 0xa8, 0x92, 0x57, 0xff, 0xaa, 0x93, 0x56, 0xff, 0xaa, 0x95, 0x52, 0xff, 0xab, 0x94, 0x53, 0xff, 0xac, 0x92, 0x56, 0xff, 0xac, 0x91, 0x54, 0xff, 0xa7, 0x8f, 0x52, 0xff, 0xaa, 0x94, 0x5d, 0xff, 0xae, 0x96, 0x5a, 0xff, 0xb0, 0x99, 0x50, 0xff, 0xb1, 0x9b, 0x54, 0xff, 0xb2, 0x97, 0x5c, 0xff, 0xae, 0x95, 0x56, 0xff, 0xac, 0x94, 0x55, 0xff, 0xa7, 0x8e, 0x56, 0xff, 0xab, 0x92, 0x58, 0xff, 0xab, 0x91, 0x56, 0xff, 0xad, 0x90, 0x55, 0xff, 0xb9, 0x94, 0x59, 0xff, 0xb9, 0x99, 0x59, 0xff, 0xb1, 0x97, 0x56, 0xff, 0xab, 0x93, 0x54, 0xff, 0xac, 0x94, 0x55, 0xff, 0xae, 0x94, 0x57, 0xff, 0xac, 0x91, 0x57, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xab, 0x90, 0x57, 0xff, 0xac, 0x91, 0x58, 0xff, 0xad, 0x92, 0x59, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x91, 0x59, 0xf3, 0xab, 0x91, 0x58, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x55, 0x03, 0xa6, 0x8c, 0x53, 0x8a, 0xa6, 0x8b, 0x53, 0xfe, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x8f, 0x56, 0xff, 0xab, 0x8f, 0x57, 0xff, 0xac, 0x91, 0x59, 0xff, 0xac, 0x91, 0x59, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x90, 0x57, 0xff, 0xaa, 0x91, 0x56, 0xff, 0xa6, 0x93, 0x54, 0xff, 0xa7, 0x94, 0x54, 0xff, 0xab, 0x96, 0x57, 0xff, 0xad, 0x92, 0x57, 0xff, 0xb0, 0x95, 0x57, 0xff, 0xb4, 0x99, 0x56, 0xff, 0xb8, 0x9a, 0x56, 0xff, 0xb3, 0x96, 0x5a, 0xff, 0xa7, 0x8c, 0x59, 0xff, 0x99, 0x82, 0x5a, 0xff, 0x91, 0x7c, 0x59, 0xff, 0x90, 0x7c, 0x5d, 0xff, 0xa0, 0x8c, 0x66, 0xff, 0x9a, 0x89, 0x55, 0xff, 0x95, 0x83, 0x55, 0xff, 0x9d, 0x87, 0x5c, 0xff, 0xa8, 0x90, 0x56, 0xff, 0xb0, 0x95, 0x57, 0xff, 0xaf, 0x93, 0x57, 0xff, 0xa7, 0x91, 0x53, 0xff, 0xad, 0x93, 0x5a, 0xff, 0xb1, 0x90, 0x5b, 0xff, 0xa2, 0x86, 0x53, 0xff, 0x9c, 0x89, 0x54, 0xff, 0xb3, 0x9a, 0x54, 0xff, 0xb8, 0x9d, 0x58, 0xff, 0xaf, 0x95, 0x57, 0xff, 0xab, 0x92, 0x55, 0xff, 0xae, 0x93, 0x59, 0xff, 0xad, 0x92, 0x5a, 0xff, 0xad, 0x92, 0x5a, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x92, 0x58, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xad, 0x92, 0x5a, 0xfe, 0xae, 0x92, 0x59, 0x8b, 0xaa, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x8b, 0x5c, 0x0b, 0xa8, 0x8c, 0x53, 0xae, 0xa7, 0x8c, 0x53, 0xff, 0xa7, 0x8c, 0x53, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xa8, 0x8f, 0x56, 0xff, 0xa9, 0x90, 0x56, 0xff, 0xae, 0x93, 0x58, 0xff, 0xaf, 0x94, 0x5a, 0xff, 0xac, 0x91, 0x58, 0xff, 0xae, 0x92, 0x58, 0xff, 0xac, 0x90, 0x58, 0xff, 0xab, 0x93, 0x5b, 0xff, 0xa6, 0x91, 0x57, 0xff, 0x9d, 0x87, 0x4f, 0xff, 0xa5, 0x8c, 0x5d, 0xff, 0x8e, 0x7c, 0x5c, 0xff, 0x7b, 0x6f, 0x5c, 0xff, 0x78, 0x66, 0x57, 0xff, 0x68, 0x5c, 0x4a, 0xff, 0x69, 0x64, 0x4f, 0xff, 0x6c, 0x66, 0x54, 0xff, 0x73, 0x6c, 0x5e, 0xff, 0x5b, 0x58, 0x4c, 0xff, 0x57, 0x4e, 0x46, 0xff, 0x73, 0x69, 0x5d, 0xff, 0x60, 0x58, 0x4e, 0xff, 0x5a, 0x4c, 0x42, 0xff, 0x80, 0x6f, 0x53, 0xff, 0x8f, 0x79, 0x57, 0xff, 0xa4, 0x87, 0x5e, 0xff, 0xae, 0x93, 0x67, 0xff, 0x91, 0x84, 0x60, 0xff, 0x75, 0x6e, 0x57, 0xff, 0x55, 0x55, 0x53, 0xff, 0x34, 0x39, 0x36, 0xff, 0x5c, 0x52, 0x3a, 0xff, 0xa5, 0x84, 0x5a, 0xff, 0xb5, 0x99, 0x61, 0xff, 0xaf, 0x96, 0x53, 0xff, 0xb0, 0x95, 0x5b, 0xff, 0xae, 0x93, 0x5b, 0xff, 0xad, 0x93, 0x59, 0xff, 0xae, 0x92, 0x59, 0xff, 0xaf, 0x92, 0x5a, 0xff, 0xaf, 0x93, 0x5b, 0xff, 0xaf, 0x93, 0x5b, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xae, 0x94, 0x5a, 0xaf, 0xb9, 0x8b, 0x5c, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x8b, 0x51, 0x16, 0xa8, 0x8e, 0x55, 0xc9, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xac, 0x90, 0x57, 0xff, 0xa6, 0x8e, 0x56, 0xff, 0xa9, 0x93, 0x53, 0xff, 0xb0, 0x93, 0x52, 0xff, 0xad, 0x8f, 0x52, 0xff, 0xaa, 0x92, 0x52, 0xff, 0xab, 0x92, 0x58, 0xff, 0xaa, 0x91, 0x59, 0xff, 0xa3, 0x8c, 0x5a, 0xff, 0x97, 0x82, 0x5b, 0xff, 0x83, 0x75, 0x59, 0xff, 0x6d, 0x6c, 0x5a, 0xff, 0x4d, 0x4e, 0x4d, 0xff, 0x39, 0x3c, 0x4b, 0xff, 0x3b, 0x3a, 0x49, 0xff, 0x2d, 0x2e, 0x37, 0xff, 0x35, 0x38, 0x3d, 0xff, 0x32, 0x32, 0x35, 0xff, 0x2f, 0x31, 0x34, 0xff, 0x23, 0x2a, 0x2c, 0xff, 0x26, 0x2a, 0x2e, 0xff, 0x3c, 0x3c, 0x42, 0xff, 0x2d, 0x2f, 0x34, 0xff, 0x27, 0x27, 0x2c, 0xff, 0x3e, 0x38, 0x3a, 0xff, 0x57, 0x4b, 0x45, 0xff, 0x6a, 0x5b, 0x50, 0xff, 0x71, 0x69, 0x5f, 0xff, 0x4e, 0x4e, 0x4a, 0xff, 0x43, 0x48, 0x4b, 0xff, 0x4e, 0x50, 0x4f, 0xff, 0x51, 0x4d, 0x44, 0xff, 0x48, 0x3c, 0x39, 0xff, 0x59, 0x4a, 0x3b, 0xff, 0x95, 0x85, 0x52, 0xff, 0xbc, 0xa2, 0x5d, 0xff, 0xb5, 0x9a, 0x58, 0xff, 0xb1, 0x98, 0x53, 0xff, 0xb2, 0x96, 0x57, 0xff, 0xb3, 0x96, 0x5d, 0xff, 0xb1, 0x95, 0x5b, 0xff, 0xb0, 0x94, 0x59, 0xff, 0xae, 0x93, 0x59, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xc9, 0xad, 0x96, 0x5c, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x89, 0x58, 0x1a, 0xa9, 0x8d, 0x54, 0xd6, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x90, 0x57, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xad, 0x91, 0x58, 0xff, 0xad, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xaf, 0x92, 0x58, 0xff, 0xae, 0x92, 0x52, 0xff, 0xb2, 0x92, 0x57, 0xff, 0xaf, 0x92, 0x5d, 0xff, 0x9a, 0x87, 0x53, 0xff, 0x8f, 0x7d, 0x52, 0xff, 0x7e, 0x74, 0x55, 0xff, 0x5e, 0x5c, 0x4d, 0xff, 0x58, 0x4f, 0x51, 0xff, 0x56, 0x4f, 0x5c, 0xff, 0x32, 0x34, 0x41, 0xff, 0x25, 0x2a, 0x34, 0xff, 0x20, 0x28, 0x31, 0xff, 0x29, 0x28, 0x37, 0xff, 0x32, 0x30, 0x3d, 0xff, 0x36, 0x35, 0x3e, 0xff, 0x28, 0x27, 0x30, 0xff, 0x22, 0x23, 0x2e, 0xff, 0x2f, 0x33, 0x3c, 0xff, 0x2f, 0x36, 0x3f, 0xff, 0x26, 0x2d, 0x38, 0xff, 0x25, 0x2c, 0x37, 0xff, 0x1a, 0x1f, 0x29, 0xff, 0x2c, 0x2d, 0x37, 0xff, 0x40, 0x3e, 0x44, 0xff, 0x39, 0x3a, 0x44, 0xff, 0x22, 0x28, 0x36, 0xff, 0x2c, 0x30, 0x38, 0xff, 0x39, 0x38, 0x38, 0xff, 0x44, 0x3c, 0x2f, 0xff, 0x62, 0x58, 0x47, 0xff, 0x56, 0x4c, 0x45, 0xff, 0x34, 0x35, 0x38, 0xff, 0x62, 0x5a, 0x4a, 0xff, 0x93, 0x7f, 0x55, 0xff, 0x9e, 0x8b, 0x4d, 0xff, 0xb3, 0x9f, 0x58, 0xff, 0xbb, 0x9e, 0x5e, 0xff, 0xb3, 0x98, 0x5b, 0xff, 0xac, 0x95, 0x56, 0xff, 0xad, 0x96, 0x57, 0xff, 0xad, 0x94, 0x59, 0xff, 0xaf, 0x93, 0x5b, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x93, 0x5a, 0xd6, 0xb0, 0x93, 0x58, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x8f, 0x57, 0x20, 0xa8, 0x8e, 0x55, 0xde, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xac, 0x91, 0x58, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xac, 0x92, 0x5a, 0xff, 0xab, 0x92, 0x59, 0xff, 0xac, 0x91, 0x59, 0xff, 0xae, 0x94, 0x58, 0xff, 0xae, 0x98, 0x56, 0xff, 0xa8, 0x94, 0x57, 0xff, 0x97, 0x86, 0x61, 0xff, 0x74, 0x6b, 0x5c, 0xff, 0x5b, 0x57, 0x51, 0xff, 0x3f, 0x41, 0x47, 0xff, 0x32, 0x36, 0x41, 0xff, 0x37, 0x39, 0x44, 0xff, 0x35, 0x35, 0x42, 0xff, 0x2f, 0x31, 0x42, 0xff, 0x1a, 0x1b, 0x2a, 0xff, 0x20, 0x20, 0x2e, 0xff, 0x30, 0x31, 0x3d, 0xff, 0x3d, 0x3f, 0x48, 0xff, 0x43, 0x46, 0x4b, 0xff, 0x37, 0x39, 0x3f, 0xff, 0x31, 0x36, 0x3c, 0xff, 0x29, 0x31, 0x37, 0xff, 0x2c, 0x31, 0x38, 0xff, 0x2d, 0x31, 0x39, 0xff, 0x26, 0x2a, 0x32, 0xff, 0x23, 0x25, 0x2d, 0xff, 0x2d, 0x2e, 0x36, 0xff, 0x2f, 0x32, 0x3d, 0xff, 0x27, 0x29, 0x36, 0xff, 0x18, 0x17, 0x26, 0xff, 0x21, 0x22, 0x2e, 0xff, 0x26, 0x27, 0x30, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x2c, 0x30, 0x34, 0xff, 0x20, 0x23, 0x2e, 0xff, 0x1c, 0x1f, 0x23, 0xff, 0x30, 0x2d, 0x36, 0xff, 0x39, 0x37, 0x33, 0xff, 0x63, 0x5b, 0x43, 0xff, 0x99, 0x8b, 0x5d, 0xff, 0xa8, 0x94, 0x59, 0xff, 0xae, 0x98, 0x58, 0xff, 0xb1, 0x9a, 0x59, 0xff, 0xb0, 0x98, 0x59, 0xff, 0xb1, 0x97, 0x5c, 0xff, 0xaf, 0x93, 0x5b, 0xff, 0xad, 0x92, 0x5a, 0xff, 0xae, 0x93, 0x5b, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xae, 0x94, 0x5a, 0xde, 0xaf, 0x97, 0x57, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x91, 0x51, 0x1c, 0xaa, 0x8f, 0x56, 0xdb, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x90, 0x57, 0xff, 0xac, 0x91, 0x58, 0xff, 0xab, 0x90, 0x57, 0xff, 0xac, 0x91, 0x58, 0xff, 0xad, 0x91, 0x59, 0xff, 0xaa, 0x94, 0x5c, 0xff, 0xa8, 0x95, 0x55, 0xff, 0xaf, 0x95, 0x56, 0xff, 0xae, 0x92, 0x5a, 0xff, 0xb5, 0x95, 0x58, 0xff, 0x9f, 0x8b, 0x59, 0xff, 0x6a, 0x68, 0x5c, 0xff, 0x47, 0x49, 0x52, 0xff, 0x36, 0x3b, 0x45, 0xff, 0x2d, 0x34, 0x41, 0xff, 0x33, 0x3a, 0x45, 0xff, 0x29, 0x2c, 0x35, 0xff, 0x1a, 0x1b, 0x24, 0xff, 0x1f, 0x20, 0x29, 0xff, 0x25, 0x25, 0x30, 0xff, 0x2e, 0x2e, 0x39, 0xff, 0x3b, 0x3c, 0x46, 0xff, 0x2d, 0x2e, 0x37, 0xff, 0x2a, 0x2c, 0x35, 0xff, 0x3f, 0x41, 0x49, 0xff, 0x36, 0x38, 0x41, 0xff, 0x26, 0x28, 0x32, 0xff, 0x29, 0x2a, 0x33, 0xff, 0x22, 0x23, 0x2a, 0xff, 0x1a, 0x1d, 0x20, 0xff, 0x12, 0x15, 0x18, 0xff, 0x0c, 0x0f, 0x13, 0xff, 0x22, 0x24, 0x2d, 0xff, 0x31, 0x31, 0x3b, 0xff, 0x37, 0x36, 0x40, 0xff, 0x31, 0x32, 0x3c, 0xff, 0x28, 0x2a, 0x35, 0xff, 0x25, 0x28, 0x34, 0xff, 0x21, 0x24, 0x31, 0xff, 0x1e, 0x21, 0x2d, 0xff, 0x19, 0x1d, 0x21, 0xff, 0x16, 0x19, 0x1f, 0xff, 0x18, 0x1d, 0x26, 0xff, 0x3c, 0x3c, 0x43, 0xff, 0x52, 0x4c, 0x48, 0xff, 0x59, 0x51, 0x40, 0xff, 0x70, 0x60, 0x44, 0xff, 0x96, 0x7f, 0x58, 0xff, 0xac, 0x8f, 0x5d, 0xff, 0xae, 0x92, 0x57, 0xff, 0xb1, 0x98, 0x5c, 0xff, 0xb2, 0x98, 0x5a, 0xff, 0xad, 0x93, 0x55, 0xff, 0xaf, 0x96, 0x58, 0xff, 0xae, 0x95, 0x57, 0xff, 0xaf, 0x95, 0x59, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb0, 0x95, 0x5b, 0xdc, 0xad, 0x91, 0x5b, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x91, 0x55, 0x15, 0xaa, 0x8e, 0x55, 0xd6, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x90, 0x57, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xab, 0x90, 0x57, 0xff, 0xac, 0x91, 0x58, 0xff, 0xad, 0x92, 0x59, 0xff, 0xac, 0x91, 0x58, 0xff, 0xad, 0x91, 0x59, 0xff, 0xae, 0x92, 0x5a, 0xff, 0xae, 0x95, 0x57, 0xff, 0xaf, 0x97, 0x51, 0xff, 0xb4, 0x98, 0x57, 0xff, 0xac, 0x90, 0x5d, 0xff, 0xa0, 0x85, 0x5c, 0xff, 0x81, 0x6c, 0x5d, 0xff, 0x50, 0x4c, 0x58, 0xff, 0x3b, 0x40, 0x50, 0xff, 0x31, 0x32, 0x40, 0xff, 0x27, 0x2b, 0x37, 0xff, 0x29, 0x31, 0x39, 0xff, 0x21, 0x23, 0x2e, 0xff, 0x26, 0x27, 0x31, 0xff, 0x27, 0x2a, 0x30, 0xff, 0x1e, 0x20, 0x27, 0xff, 0x28, 0x2a, 0x31, 0xff, 0x24, 0x27, 0x2d, 0xff, 0x16, 0x18, 0x1f, 0xff, 0x0a, 0x0c, 0x13, 0xff, 0x21, 0x23, 0x2b, 0xff, 0x2a, 0x2c, 0x34, 0xff, 0x33, 0x35, 0x3c, 0xff, 0x35, 0x36, 0x40, 0xff, 0x1a, 0x1c, 0x25, 0xff, 0x06, 0x08, 0x0c, 0xff, 0x0a, 0x0d, 0x10, 0xff, 0x10, 0x13, 0x17, 0xff, 0x18, 0x1a, 0x21, 0xff, 0x1f, 0x20, 0x2a, 0xff, 0x2b, 0x2c, 0x37, 0xff, 0x34, 0x35, 0x3f, 0xff, 0x2f, 0x30, 0x3a, 0xff, 0x29, 0x29, 0x34, 0xff, 0x1d, 0x1e, 0x28, 0xff, 0x21, 0x21, 0x2b, 0xff, 0x2b, 0x2c, 0x37, 0xff, 0x1f, 0x21, 0x2b, 0xff, 0x1d, 0x1e, 0x29, 0xff, 0x22, 0x25, 0x38, 0xff, 0x15, 0x18, 0x2a, 0xff, 0x1b, 0x1e, 0x28, 0xff, 0x30, 0x29, 0x35, 0xff, 0x48, 0x3d, 0x3d, 0xff, 0x5f, 0x56, 0x41, 0xff, 0x81, 0x70, 0x48, 0xff, 0x9f, 0x87, 0x52, 0xff, 0xac, 0x94, 0x55, 0xff, 0xb5, 0x9b, 0x59, 0xff, 0xae, 0x95, 0x57, 0xff, 0xad, 0x95, 0x56, 0xff, 0xb1, 0x97, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb0, 0x95, 0x5c, 0xd7, 0xb6, 0x91, 0x61, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x99, 0x4c, 0x0a, 0xa9, 0x8e, 0x55, 0xc8, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xac, 0x91, 0x58, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xac, 0x91, 0x58, 0xff, 0xad, 0x92, 0x59, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xad, 0x92, 0x59, 0xff, 0xae, 0x92, 0x5a, 0xff, 0xaf, 0x93, 0x5b, 0xff, 0xac, 0x94, 0x58, 0xff, 0xaa, 0x97, 0x56, 0xff, 0xad, 0x99, 0x5c, 0xff, 0x96, 0x83, 0x62, 0xff, 0x6c, 0x64, 0x5b, 0xff, 0x4d, 0x50, 0x55, 0xff, 0x39, 0x42, 0x50, 0xff, 0x26, 0x30, 0x3e, 0xff, 0x21, 0x25, 0x2d, 0xff, 0x26, 0x2a, 0x30, 0xff, 0x24, 0x2b, 0x34, 0xff, 0x20, 0x22, 0x2d, 0xff, 0x28, 0x29, 0x32, 0xff, 0x1b, 0x1e, 0x21, 0xff, 0x0d, 0x11, 0x14, 0xff, 0x0e, 0x11, 0x14, 0xff, 0x09, 0x0c, 0x10, 0xff, 0x09, 0x0c, 0x10, 0xff, 0x14, 0x18, 0x1b, 0xff, 0x17, 0x1a, 0x1e, 0xff, 0x12, 0x15, 0x19, 0xff, 0x27, 0x2b, 0x2d, 0xff, 0x2b, 0x2d, 0x35, 0xff, 0x0f, 0x10, 0x19, 0xff, 0x05, 0x07, 0x0b, 0xff, 0x13, 0x17, 0x1a, 0xff, 0x29, 0x2c, 0x31, 0xff, 0x1f, 0x21, 0x29, 0xff, 0x0d, 0x0d, 0x19, 0xff, 0x0f, 0x10, 0x1b, 0xff, 0x28, 0x29, 0x33, 0xff, 0x33, 0x34, 0x3e, 0xff, 0x28, 0x29, 0x34, 0xff, 0x1c, 0x1d, 0x28, 0xff, 0x19, 0x1a, 0x25, 0xff, 0x18, 0x1a, 0x20, 0xff, 0x0b, 0x0e, 0x13, 0xff, 0x11, 0x13, 0x19, 0xff, 0x1d, 0x22, 0x2d, 0xff, 0x18, 0x1e, 0x2a, 0xff, 0x1c, 0x26, 0x2e, 0xff, 0x31, 0x35, 0x3e, 0xff, 0x31, 0x31, 0x37, 0xff, 0x2b, 0x31, 0x2e, 0xff, 0x3d, 0x38, 0x34, 0xff, 0x60, 0x4e, 0x42, 0xff, 0x82, 0x70, 0x4e, 0xff, 0xab, 0x94, 0x5c, 0xff, 0xb2, 0x98, 0x56, 0xff, 0xb1, 0x98, 0x5a, 0xff, 0xb0, 0x97, 0x59, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x96, 0x5e, 0xc8, 0xb2, 0x99, 0x66, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x55, 0x03, 0xaa, 0x8e, 0x56, 0xb1, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xa9, 0x8e, 0x55, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xac, 0x91, 0x58, 0xff, 0xad, 0x92, 0x59, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xab, 0x94, 0x5a, 0xff, 0xab, 0x94, 0x5a, 0xff, 0xaa, 0x93, 0x59, 0xff, 0xaf, 0x92, 0x59, 0xff, 0xab, 0x95, 0x5a, 0xff, 0x91, 0x89, 0x60, 0xff, 0x5e, 0x5b, 0x59, 0xff, 0x40, 0x3f, 0x4d, 0xff, 0x33, 0x3b, 0x42, 0xff, 0x26, 0x30, 0x38, 0xff, 0x1b, 0x21, 0x2c, 0xff, 0x27, 0x2b, 0x34, 0xff, 0x1c, 0x22, 0x29, 0xff, 0x1b, 0x21, 0x2a, 0xff, 0x27, 0x29, 0x33, 0xff, 0x26, 0x26, 0x30, 0xff, 0x05, 0x06, 0x0a, 0xff, 0x04, 0x06, 0x0a, 0xff, 0x04, 0x05, 0x09, 0xff, 0x01, 0x03, 0x04, 0xff, 0x00, 0x00, 0x01, 0xff, 0x0e, 0x10, 0x11, 0xff, 0x10, 0x12, 0x13, 0xff, 0x04, 0x06, 0x07, 0xff, 0x07, 0x0a, 0x0a, 0xff, 0x1e, 0x1f, 0x23, 0xff, 0x25, 0x25, 0x2b, 0xff, 0x17, 0x17, 0x1f, 0xff, 0x1f, 0x20, 0x29, 0xff, 0x2d, 0x2f, 0x37, 0xff, 0x27, 0x2a, 0x2f, 0xff, 0x19, 0x1c, 0x21, 0xff, 0x12, 0x15, 0x1a, 0xff, 0x1d, 0x1f, 0x27, 0xff, 0x33, 0x35, 0x3e, 0xff, 0x25, 0x27, 0x2c, 0xff, 0x11, 0x14, 0x19, 0xff, 0x1b, 0x1e, 0x22, 0xff, 0x21, 0x23, 0x25, 0xff, 0x0a, 0x0c, 0x0e, 0xff, 0x0a, 0x0c, 0x0e, 0xff, 0x1c, 0x20, 0x2a, 0xff, 0x22, 0x25, 0x32, 0xff, 0x27, 0x29, 0x35, 0xff, 0x25, 0x25, 0x31, 0xff, 0x24, 0x22, 0x2f, 0xff, 0x2d, 0x2e, 0x3b, 0xff, 0x38, 0x34, 0x40, 0xff, 0x33, 0x2c, 0x30, 0xff, 0x4e, 0x48, 0x35, 0xff, 0x8c, 0x7a, 0x54, 0xff, 0xb5, 0x9a, 0x5c, 0xff, 0xb3, 0x97, 0x57, 0xff, 0xb0, 0x95, 0x5b, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5d, 0xb1, 0xaa, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x8e, 0x56, 0x8d, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x90, 0x57, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x90, 0x57, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xad, 0x92, 0x59, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xad, 0x92, 0x59, 0xff, 0xaa, 0x94, 0x5a, 0xff, 0xaa, 0x94, 0x5a, 0xff, 0xa8, 0x93, 0x58, 0xff, 0xab, 0x91, 0x55, 0xff, 0xa4, 0x8e, 0x60, 0xff, 0x70, 0x68, 0x64, 0xff, 0x3a, 0x3d, 0x4f, 0xff, 0x27, 0x2a, 0x36, 0xff, 0x24, 0x27, 0x30, 0xff, 0x1e, 0x22, 0x2c, 0xff, 0x22, 0x26, 0x31, 0xff, 0x2c, 0x2f, 0x3b, 0xff, 0x1e, 0x23, 0x2e, 0xff, 0x23, 0x2a, 0x32, 0xff, 0x2a, 0x2c, 0x36, 0xff, 0x22, 0x22, 0x2b, 0xff, 0x0f, 0x10, 0x14, 0xff, 0x05, 0x05, 0x09, 0xff, 0x07, 0x08, 0x0c, 0xff, 0x0d, 0x0e, 0x10, 0xff, 0x0f, 0x11, 0x13, 0xff, 0x05, 0x06, 0x08, 0xff, 0x02, 0x02, 0x05, 0xff, 0x02, 0x03, 0x05, 0xff, 0x03, 0x04, 0x07, 0xff, 0x10, 0x12, 0x14, 0xff, 0x23, 0x23, 0x28, 0xff, 0x1e, 0x1d, 0x26, 0xff, 0x23, 0x22, 0x2d, 0xff, 0x10, 0x12, 0x1b, 0xff, 0x0d, 0x10, 0x15, 0xff, 0x14, 0x17, 0x19, 0xff, 0x10, 0x13, 0x16, 0xff, 0x21, 0x24, 0x2b, 0xff, 0x28, 0x2a, 0x33, 0xff, 0x1a, 0x1e, 0x21, 0xff, 0x03, 0x06, 0x08, 0xff, 0x0f, 0x11, 0x14, 0xff, 0x2c, 0x2c, 0x31, 0xff, 0x0e, 0x0e, 0x12, 0xff, 0x02, 0x03, 0x07, 0xff, 0x19, 0x20, 0x27, 0xff, 0x30, 0x35, 0x3e, 0xff, 0x19, 0x19, 0x23, 0xff, 0x00, 0x00, 0x03, 0xff, 0x02, 0x01, 0x0a, 0xff, 0x20, 0x21, 0x28, 0xff, 0x35, 0x33, 0x35, 0xff, 0x22, 0x20, 0x21, 0xff, 0x1e, 0x16, 0x15, 0xff, 0x74, 0x5f, 0x4b, 0xff, 0xb3, 0x9b, 0x5c, 0xff, 0xb3, 0x97, 0x57, 0xff, 0xae, 0x95, 0x5c, 0xff, 0xb1, 0x97, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb1, 0x96, 0x5e, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x90, 0x57, 0x55, 0xa9, 0x8e, 0x56, 0xfe, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xaa, 0x8f, 0x56, 0xff, 0xab, 0x90, 0x57, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb0, 0x94, 0x5b, 0xff, 0xb0, 0x94, 0x5b, 0xff, 0xb0, 0x94, 0x5b, 0xff, 0xaa, 0x94, 0x5a, 0xff, 0xaa, 0x93, 0x5a, 0xff, 0xa9, 0x93, 0x56, 0xff, 0xa6, 0x95, 0x57, 0xff, 0x97, 0x85, 0x63, 0xff, 0x52, 0x4e, 0x51, 0xff, 0x29, 0x34, 0x44, 0xff, 0x2f, 0x37, 0x44, 0xff, 0x28, 0x29, 0x38, 0xff, 0x27, 0x28, 0x35, 0xff, 0x2b, 0x30, 0x3a, 0xff, 0x27, 0x2a, 0x36, 0xff, 0x26, 0x2b, 0x35, 0xff, 0x33, 0x3a, 0x42, 0xff, 0x2c, 0x2e, 0x39, 0xff, 0x1d, 0x1d, 0x26, 0xff, 0x11, 0x12, 0x15, 0xff, 0x11, 0x12, 0x15, 0xff, 0x0e, 0x0f, 0x13, 0xff, 0x10, 0x0f, 0x18, 0xff, 0x15, 0x14, 0x1d, 0xff, 0x1d, 0x1c, 0x24, 0xff, 0x11, 0x10, 0x18, 0xff, 0x0b, 0x0a, 0x13, 0xff, 0x0f, 0x0d, 0x16, 0xff, 0x10, 0x11, 0x15, 0xff, 0x07, 0x09, 0x0c, 0xff, 0x11, 0x0f, 0x18, 0xff, 0x1c, 0x1c, 0x26, 0xff, 0x1f, 0x21, 0x29, 0xff, 0x10, 0x13, 0x18, 0xff, 0x07, 0x0a, 0x0d, 0xff, 0x15, 0x18, 0x1c, 0xff, 0x37, 0x39, 0x42, 0xff, 0x2d, 0x2f, 0x39, 0xff, 0x11, 0x14, 0x17, 0xff, 0x01, 0x03, 0x07, 0xff, 0x0d, 0x0f, 0x13, 0xff, 0x23, 0x25, 0x29, 0xff, 0x0a, 0x0b, 0x0e, 0xff, 0x00, 0x01, 0x04, 0xff, 0x1e, 0x25, 0x2e, 0xff, 0x33, 0x38, 0x42, 0xff, 0x26, 0x27, 0x32, 0xff, 0x27, 0x27, 0x2f, 0xff, 0x0f, 0x0f, 0x14, 0xff, 0x0d, 0x0f, 0x11, 0xff, 0x19, 0x1b, 0x19, 0xff, 0x24, 0x25, 0x25, 0xff, 0x1c, 0x16, 0x16, 0xff, 0x60, 0x4e, 0x38, 0xff, 0xb4, 0xa0, 0x5e, 0xff, 0xad, 0x97, 0x56, 0xff, 0xab, 0x95, 0x5b, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb1, 0x96, 0x5e, 0xfe, 0xb1, 0x96, 0x5d, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x8f, 0x57, 0x29, 0xab, 0x8f, 0x57, 0xf3, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xad, 0x92, 0x59, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xad, 0x95, 0x59, 0xff, 0xad, 0x96, 0x59, 0xff, 0xac, 0x95, 0x59, 0xff, 0xa7, 0x95, 0x58, 0xff, 0xa8, 0x99, 0x56, 0xff, 0xb5, 0x9b, 0x5f, 0xff, 0xac, 0x90, 0x62, 0xff, 0x62, 0x59, 0x4d, 0xff, 0x2e, 0x33, 0x40, 0xff, 0x2c, 0x34, 0x42, 0xff, 0x31, 0x36, 0x45, 0xff, 0x2f, 0x31, 0x3d, 0xff, 0x37, 0x3a, 0x45, 0xff, 0x28, 0x2c, 0x37, 0xff, 0x28, 0x2c, 0x37, 0xff, 0x32, 0x37, 0x42, 0xff, 0x2c, 0x33, 0x3c, 0xff, 0x28, 0x2a, 0x34, 0xff, 0x2d, 0x2d, 0x37, 0xff, 0x1b, 0x1b, 0x25, 0xff, 0x1d, 0x1e, 0x26, 0xff, 0x12, 0x15, 0x1a, 0xff, 0x0c, 0x0e, 0x11, 0xff, 0x18, 0x19, 0x1f, 0xff, 0x1d, 0x1e, 0x25, 0xff, 0x1d, 0x1e, 0x25, 0xff, 0x0e, 0x0f, 0x16, 0xff, 0x0d, 0x0e, 0x14, 0xff, 0x13, 0x14, 0x1b, 0xff, 0x0f, 0x0f, 0x18, 0xff, 0x1e, 0x1f, 0x28, 0xff, 0x1b, 0x1c, 0x27, 0xff, 0x26, 0x28, 0x31, 0xff, 0x28, 0x2b, 0x30, 0xff, 0x06, 0x09, 0x0c, 0xff, 0x17, 0x19, 0x1c, 0xff, 0x24, 0x26, 0x2c, 0xff, 0x10, 0x11, 0x17, 0xff, 0x05, 0x06, 0x0a, 0xff, 0x05, 0x07, 0x0b, 0xff, 0x15, 0x17, 0x1b, 0xff, 0x13, 0x14, 0x18, 0xff, 0x07, 0x08, 0x0c, 0xff, 0x09, 0x0a, 0x0e, 0xff, 0x0d, 0x10, 0x15, 0xff, 0x29, 0x2a, 0x32, 0xff, 0x41, 0x41, 0x4b, 0xff, 0x2e, 0x2d, 0x37, 0xff, 0x15, 0x15, 0x1c, 0xff, 0x14, 0x16, 0x18, 0xff, 0x08, 0x0a, 0x0e, 0xff, 0x19, 0x17, 0x18, 0xff, 0x3f, 0x39, 0x2a, 0xff, 0x6e, 0x5d, 0x41, 0xff, 0xb5, 0x9e, 0x60, 0xff, 0xb3, 0x9a, 0x5a, 0xff, 0xae, 0x94, 0x60, 0xff, 0xaa, 0x94, 0x5a, 0xff, 0xad, 0x98, 0x5d, 0xff, 0xae, 0x98, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb1, 0x96, 0x5e, 0xf4, 0xb0, 0x97, 0x5b, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x91, 0x48, 0x07, 0xaa, 0x8f, 0x56, 0xd1, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xaa, 0x96, 0x58, 0xff, 0xaa, 0x96, 0x57, 0xff, 0xaa, 0x96, 0x58, 0xff, 0xaf, 0x96, 0x5a, 0xff, 0xb1, 0x9c, 0x5c, 0xff, 0xad, 0x91, 0x69, 0xff, 0x7c, 0x65, 0x5d, 0xff, 0x30, 0x34, 0x46, 0xff, 0x26, 0x33, 0x47, 0xff, 0x30, 0x34, 0x43, 0xff, 0x23, 0x24, 0x33, 0xff, 0x2b, 0x30, 0x3a, 0xff, 0x32, 0x38, 0x40, 0xff, 0x24, 0x27, 0x33, 0xff, 0x2a, 0x2e, 0x39, 0xff, 0x2c, 0x31, 0x3b, 0xff, 0x1b, 0x22, 0x2a, 0xff, 0x0e, 0x10, 0x1a, 0xff, 0x16, 0x17, 0x21, 0xff, 0x22, 0x22, 0x2f, 0xff, 0x19, 0x1b, 0x24, 0xff, 0x06, 0x0a, 0x0f, 0xff, 0x05, 0x09, 0x0a, 0xff, 0x14, 0x17, 0x1a, 0xff, 0x1c, 0x1f, 0x26, 0xff, 0x1a, 0x1d, 0x22, 0xff, 0x07, 0x0a, 0x0e, 0xff, 0x0b, 0x10, 0x12, 0xff, 0x14, 0x16, 0x1e, 0xff, 0x28, 0x28, 0x34, 0xff, 0x2c, 0x2d, 0x37, 0xff, 0x25, 0x26, 0x31, 0xff, 0x11, 0x12, 0x1b, 0xff, 0x15, 0x18, 0x1d, 0xff, 0x0e, 0x10, 0x14, 0xff, 0x14, 0x14, 0x18, 0xff, 0x11, 0x12, 0x15, 0xff, 0x05, 0x06, 0x09, 0xff, 0x03, 0x04, 0x08, 0xff, 0x19, 0x1a, 0x1e, 0xff, 0x27, 0x28, 0x2c, 0xff, 0x11, 0x12, 0x16, 0xff, 0x00, 0x00, 0x04, 0xff, 0x05, 0x06, 0x0a, 0xff, 0x06, 0x06, 0x08, 0xff, 0x0b, 0x0b, 0x10, 0xff, 0x2a, 0x28, 0x32, 0xff, 0x20, 0x1f, 0x2a, 0xff, 0x1a, 0x19, 0x22, 0xff, 0x20, 0x21, 0x26, 0xff, 0x15, 0x16, 0x1b, 0xff, 0x2d, 0x28, 0x28, 0xff, 0x3e, 0x37, 0x2b, 0xff, 0x55, 0x42, 0x35, 0xff, 0x94, 0x7c, 0x54, 0xff, 0xaf, 0x98, 0x61, 0xff, 0xb7, 0x9b, 0x63, 0xff, 0xb3, 0x99, 0x5f, 0xff, 0xaf, 0x97, 0x5d, 0xff, 0xb1, 0x98, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5d, 0xd1, 0xb6, 0x91, 0x6d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x8f, 0x56, 0x8e, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xab, 0x90, 0x57, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xaf, 0x95, 0x5b, 0xff, 0xab, 0x96, 0x58, 0xff, 0xaa, 0x96, 0x56, 0xff, 0xaa, 0x96, 0x59, 0xff, 0xb3, 0x96, 0x5c, 0xff, 0xab, 0x8c, 0x5c, 0xff, 0x6d, 0x63, 0x5e, 0xff, 0x3d, 0x43, 0x5a, 0xff, 0x3f, 0x48, 0x5a, 0xff, 0x3a, 0x41, 0x4d, 0xff, 0x2c, 0x30, 0x40, 0xff, 0x29, 0x2b, 0x3b, 0xff, 0x20, 0x25, 0x2f, 0xff, 0x24, 0x29, 0x33, 0xff, 0x23, 0x27, 0x33, 0xff, 0x1a, 0x1e, 0x2a, 0xff, 0x10, 0x16, 0x20, 0xff, 0x08, 0x10, 0x18, 0xff, 0x08, 0x0a, 0x14, 0xff, 0x1c, 0x1c, 0x27, 0xff, 0x28, 0x2b, 0x31, 0xff, 0x11, 0x15, 0x17, 0xff, 0x05, 0x0a, 0x09, 0xff, 0x11, 0x15, 0x18, 0xff, 0x1e, 0x20, 0x28, 0xff, 0x26, 0x25, 0x31, 0xff, 0x18, 0x18, 0x21, 0xff, 0x0d, 0x0f, 0x17, 0xff, 0x0f, 0x11, 0x19, 0xff, 0x16, 0x17, 0x21, 0xff, 0x1d, 0x1e, 0x29, 0xff, 0x14, 0x14, 0x1f, 0xff, 0x15, 0x16, 0x21, 0xff, 0x0c, 0x0d, 0x17, 0xff, 0x17, 0x1b, 0x1e, 0xff, 0x1b, 0x1d, 0x20, 0xff, 0x0b, 0x0b, 0x0f, 0xff, 0x10, 0x11, 0x15, 0xff, 0x1d, 0x1e, 0x22, 0xff, 0x0b, 0x0c, 0x10, 0xff, 0x0a, 0x0b, 0x0f, 0xff, 0x16, 0x17, 0x1b, 0xff, 0x09, 0x0a, 0x0e, 0xff, 0x05, 0x05, 0x08, 0xff, 0x05, 0x06, 0x0a, 0xff, 0x05, 0x06, 0x08, 0xff, 0x03, 0x02, 0x08, 0xff, 0x18, 0x17, 0x22, 0xff, 0x2c, 0x2b, 0x36, 0xff, 0x2c, 0x2a, 0x33, 0xff, 0x20, 0x21, 0x25, 0xff, 0x35, 0x35, 0x34, 0xff, 0x46, 0x40, 0x3f, 0xff, 0x3f, 0x38, 0x38, 0xff, 0x3f, 0x33, 0x37, 0xff, 0x45, 0x42, 0x3d, 0xff, 0x57, 0x4f, 0x42, 0xff, 0xa1, 0x89, 0x55, 0xff, 0xba, 0xa0, 0x5f, 0xff, 0xaf, 0x97, 0x5e, 0xff, 0xb0, 0x97, 0x5e, 0xff, 0xb2, 0x96, 0x5d, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x8f, 0x57, 0x40, 0xab, 0x90, 0x58, 0xfe, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xac, 0x91, 0x58, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xad, 0x92, 0x59, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xaf, 0x96, 0x5b, 0xff, 0xab, 0x96, 0x59, 0xff, 0xae, 0x96, 0x5b, 0xff, 0xb3, 0x99, 0x56, 0xff, 0xac, 0x95, 0x5a, 0xff, 0x8f, 0x79, 0x5f, 0xff, 0x56, 0x55, 0x5a, 0xff, 0x30, 0x40, 0x52, 0xff, 0x38, 0x3f, 0x4e, 0xff, 0x35, 0x38, 0x46, 0xff, 0x2c, 0x30, 0x3d, 0xff, 0x2c, 0x30, 0x3c, 0xff, 0x23, 0x27, 0x31, 0xff, 0x21, 0x27, 0x30, 0xff, 0x18, 0x1d, 0x27, 0xff, 0x16, 0x18, 0x23, 0xff, 0x11, 0x14, 0x1e, 0xff, 0x10, 0x14, 0x1d, 0xff, 0x09, 0x0b, 0x15, 0xff, 0x17, 0x18, 0x21, 0xff, 0x20, 0x22, 0x29, 0xff, 0x0a, 0x0c, 0x12, 0xff, 0x04, 0x07, 0x0b, 0xff, 0x1d, 0x1f, 0x27, 0xff, 0x2a, 0x2c, 0x36, 0xff, 0x23, 0x26, 0x31, 0xff, 0x1a, 0x1e, 0x28, 0xff, 0x19, 0x1b, 0x25, 0xff, 0x13, 0x13, 0x1e, 0xff, 0x10, 0x11, 0x19, 0xff, 0x0a, 0x0d, 0x13, 0xff, 0x10, 0x12, 0x19, 0xff, 0x08, 0x09, 0x11, 0xff, 0x09, 0x0b, 0x11, 0xff, 0x1b, 0x21, 0x25, 0xff, 0x1a, 0x1f, 0x22, 0xff, 0x07, 0x07, 0x0b, 0xff, 0x0e, 0x0f, 0x13, 0xff, 0x28, 0x29, 0x2d, 0xff, 0x17, 0x18, 0x1c, 0xff, 0x01, 0x01, 0x05, 0xff, 0x03, 0x04, 0x08, 0xff, 0x0b, 0x0a, 0x0f, 0xff, 0x15, 0x17, 0x1c, 0xff, 0x0f, 0x11, 0x15, 0xff, 0x04, 0x06, 0x0a, 0xff, 0x03, 0x04, 0x09, 0xff, 0x0d, 0x0b, 0x13, 0xff, 0x21, 0x21, 0x2a, 0xff, 0x26, 0x26, 0x30, 0xff, 0x1d, 0x1f, 0x27, 0xff, 0x23, 0x23, 0x26, 0xff, 0x29, 0x26, 0x27, 0xff, 0x38, 0x34, 0x3a, 0xff, 0x36, 0x33, 0x37, 0xff, 0x26, 0x29, 0x2b, 0xff, 0x13, 0x10, 0x18, 0xff, 0x61, 0x53, 0x38, 0xff, 0xb3, 0x9d, 0x64, 0xff, 0xb5, 0x9e, 0x61, 0xff, 0xab, 0x96, 0x5c, 0xff, 0xb1, 0x97, 0x5e, 0xff, 0xb4, 0x98, 0x5f, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb1, 0x96, 0x5e, 0xfe, 0xb0, 0x95, 0x5e, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x8d, 0x55, 0x09, 0xad, 0x91, 0x58, 0xdb, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb0, 0x94, 0x5c, 0xff, 0xae, 0x94, 0x59, 0xff, 0xab, 0x97, 0x59, 0xff, 0xaf, 0x95, 0x5d, 0xff, 0xb9, 0x99, 0x54, 0xff, 0xa7, 0x95, 0x65, 0xff, 0x6d, 0x67, 0x62, 0xff, 0x50, 0x4b, 0x4e, 0xff, 0x2e, 0x36, 0x42, 0xff, 0x33, 0x3a, 0x4f, 0xff, 0x1f, 0x28, 0x39, 0xff, 0x16, 0x1d, 0x25, 0xff, 0x1d, 0x21, 0x29, 0xff, 0x1f, 0x24, 0x2d, 0xff, 0x1d, 0x24, 0x2c, 0xff, 0x1b, 0x21, 0x2a, 0xff, 0x1c, 0x1e, 0x28, 0xff, 0x27, 0x26, 0x30, 0xff, 0x14, 0x14, 0x1e, 0xff, 0x15, 0x16, 0x20, 0xff, 0x16, 0x17, 0x21, 0xff, 0x12, 0x13, 0x1e, 0xff, 0x15, 0x15, 0x21, 0xff, 0x1a, 0x1a, 0x26, 0xff, 0x19, 0x19, 0x25, 0xff, 0x17, 0x19, 0x23, 0xff, 0x12, 0x1b, 0x23, 0xff, 0x17, 0x20, 0x29, 0xff, 0x18, 0x1d, 0x26, 0xff, 0x15, 0x15, 0x20, 0xff, 0x07, 0x0a, 0x0f, 0xff, 0x04, 0x07, 0x09, 0xff, 0x0c, 0x0f, 0x12, 0xff, 0x07, 0x0a, 0x0e, 0xff, 0x09, 0x0b, 0x12, 0xff, 0x17, 0x1f, 0x25, 0xff, 0x1a, 0x21, 0x26, 0xff, 0x0b, 0x0b, 0x0e, 0xff, 0x12, 0x13, 0x17, 0xff, 0x24, 0x25, 0x29, 0xff, 0x18, 0x19, 0x1d, 0xff, 0x0f, 0x10, 0x15, 0xff, 0x11, 0x11, 0x16, 0xff, 0x1c, 0x1c, 0x23, 0xff, 0x1a, 0x1c, 0x24, 0xff, 0x1c, 0x22, 0x28, 0xff, 0x0c, 0x12, 0x18, 0xff, 0x0b, 0x0e, 0x15, 0xff, 0x05, 0x05, 0x0c, 0xff, 0x01, 0x01, 0x0a, 0xff, 0x0b, 0x0c, 0x17, 0xff, 0x10, 0x11, 0x1d, 0xff, 0x0d, 0x0e, 0x16, 0xff, 0x1e, 0x20, 0x24, 0xff, 0x1f, 0x23, 0x29, 0xff, 0x17, 0x19, 0x19, 0xff, 0x3c, 0x35, 0x34, 0xff, 0x32, 0x2c, 0x2a, 0xff, 0x37, 0x33, 0x26, 0xff, 0x9b, 0x85, 0x5b, 0xff, 0xbd, 0x9e, 0x5e, 0xff, 0xae, 0x98, 0x5b, 0xff, 0xb2, 0x98, 0x60, 0xff, 0xb4, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xdb, 0xaa, 0x8d, 0x55, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x92, 0x58, 0x88, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xad, 0x97, 0x59, 0xff, 0xa9, 0x95, 0x58, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0x8c, 0x7d, 0x67, 0xff, 0x3e, 0x48, 0x50, 0xff, 0x3d, 0x3f, 0x48, 0xff, 0x31, 0x37, 0x45, 0xff, 0x20, 0x27, 0x3b, 0xff, 0x1d, 0x24, 0x35, 0xff, 0x15, 0x1c, 0x24, 0xff, 0x14, 0x19, 0x21, 0xff, 0x16, 0x1b, 0x23, 0xff, 0x1d, 0x23, 0x2c, 0xff, 0x25, 0x2b, 0x35, 0xff, 0x18, 0x19, 0x24, 0xff, 0x18, 0x19, 0x23, 0xff, 0x11, 0x12, 0x1c, 0xff, 0x15, 0x16, 0x20, 0xff, 0x10, 0x11, 0x1b, 0xff, 0x0a, 0x0b, 0x14, 0xff, 0x12, 0x12, 0x1c, 0xff, 0x25, 0x25, 0x30, 0xff, 0x1e, 0x1e, 0x29, 0xff, 0x1a, 0x1b, 0x26, 0xff, 0x15, 0x1c, 0x25, 0xff, 0x14, 0x1d, 0x25, 0xff, 0x18, 0x1d, 0x25, 0xff, 0x16, 0x17, 0x20, 0xff, 0x07, 0x08, 0x0f, 0xff, 0x07, 0x08, 0x0e, 0xff, 0x0a, 0x0a, 0x10, 0xff, 0x0a, 0x0a, 0x13, 0xff, 0x0a, 0x0a, 0x16, 0xff, 0x17, 0x1e, 0x28, 0xff, 0x11, 0x16, 0x1e, 0xff, 0x0b, 0x0a, 0x0d, 0xff, 0x0a, 0x0b, 0x0f, 0xff, 0x0f, 0x0f, 0x14, 0xff, 0x0d, 0x0e, 0x12, 0xff, 0x14, 0x16, 0x1a, 0xff, 0x18, 0x19, 0x1e, 0xff, 0x18, 0x1a, 0x24, 0xff, 0x1d, 0x21, 0x2c, 0xff, 0x2a, 0x33, 0x3d, 0xff, 0x21, 0x2c, 0x34, 0xff, 0x1f, 0x25, 0x2e, 0xff, 0x19, 0x1b, 0x25, 0xff, 0x0b, 0x0b, 0x16, 0xff, 0x00, 0x00, 0x09, 0xff, 0x08, 0x08, 0x13, 0xff, 0x10, 0x12, 0x1c, 0xff, 0x16, 0x1b, 0x22, 0xff, 0x12, 0x16, 0x1f, 0xff, 0x14, 0x18, 0x1e, 0xff, 0x21, 0x22, 0x27, 0xff, 0x23, 0x23, 0x29, 0xff, 0x32, 0x32, 0x27, 0xff, 0x8a, 0x7a, 0x52, 0xff, 0xb8, 0x9c, 0x5d, 0xff, 0xb0, 0x99, 0x5a, 0xff, 0xb2, 0x97, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9b, 0x61, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x93, 0x57, 0x26, 0xad, 0x91, 0x58, 0xfa, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xad, 0x92, 0x59, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xac, 0x95, 0x59, 0xff, 0xb0, 0x9c, 0x5a, 0xff, 0xa9, 0x94, 0x64, 0xff, 0x56, 0x50, 0x4e, 0xff, 0x2a, 0x3a, 0x4d, 0xff, 0x3f, 0x46, 0x53, 0xff, 0x30, 0x36, 0x44, 0xff, 0x14, 0x1c, 0x2d, 0xff, 0x1d, 0x24, 0x34, 0xff, 0x19, 0x1e, 0x28, 0xff, 0x1a, 0x1d, 0x26, 0xff, 0x1c, 0x1f, 0x29, 0xff, 0x1c, 0x22, 0x2a, 0xff, 0x15, 0x1c, 0x24, 0xff, 0x12, 0x15, 0x1d, 0xff, 0x09, 0x0b, 0x13, 0xff, 0x16, 0x16, 0x21, 0xff, 0x0f, 0x10, 0x1a, 0xff, 0x10, 0x11, 0x1c, 0xff, 0x11, 0x13, 0x20, 0xff, 0x11, 0x13, 0x1e, 0xff, 0x13, 0x16, 0x1e, 0xff, 0x13, 0x15, 0x1f, 0xff, 0x1d, 0x1f, 0x28, 0xff, 0x15, 0x1b, 0x23, 0xff, 0x0e, 0x14, 0x1f, 0xff, 0x19, 0x1d, 0x28, 0xff, 0x0f, 0x12, 0x1e, 0xff, 0x10, 0x13, 0x20, 0xff, 0x11, 0x14, 0x22, 0xff, 0x08, 0x0d, 0x1a, 0xff, 0x09, 0x0d, 0x18, 0xff, 0x0e, 0x0f, 0x19, 0xff, 0x10, 0x14, 0x1f, 0xff, 0x10, 0x16, 0x1e, 0xff, 0x08, 0x0a, 0x0d, 0xff, 0x02, 0x05, 0x08, 0xff, 0x04, 0x06, 0x0a, 0xff, 0x0d, 0x0e, 0x12, 0xff, 0x12, 0x13, 0x16, 0xff, 0x13, 0x14, 0x18, 0xff, 0x20, 0x22, 0x2d, 0xff, 0x21, 0x26, 0x32, 0xff, 0x1a, 0x21, 0x2c, 0xff, 0x12, 0x1b, 0x25, 0xff, 0x1c, 0x23, 0x2e, 0xff, 0x28, 0x2c, 0x37, 0xff, 0x2c, 0x2f, 0x39, 0xff, 0x0f, 0x10, 0x1b, 0xff, 0x03, 0x04, 0x0d, 0xff, 0x05, 0x07, 0x0d, 0xff, 0x0b, 0x10, 0x19, 0xff, 0x14, 0x17, 0x21, 0xff, 0x1e, 0x24, 0x2a, 0xff, 0x1a, 0x1e, 0x25, 0xff, 0x0f, 0x13, 0x18, 0xff, 0x1c, 0x20, 0x1c, 0xff, 0x6f, 0x62, 0x44, 0xff, 0xb6, 0x9c, 0x60, 0xff, 0xb5, 0x9c, 0x5c, 0xff, 0xb1, 0x97, 0x5e, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9b, 0x61, 0xfa, 0xb5, 0x9a, 0x64, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x91, 0x58, 0xb3, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb2, 0x97, 0x5c, 0xff, 0xac, 0x97, 0x5a, 0xff, 0xb9, 0x9e, 0x5b, 0xff, 0x96, 0x87, 0x5e, 0xff, 0x40, 0x44, 0x49, 0xff, 0x2b, 0x31, 0x46, 0xff, 0x2b, 0x36, 0x43, 0xff, 0x21, 0x27, 0x38, 0xff, 0x19, 0x21, 0x2f, 0xff, 0x1b, 0x23, 0x32, 0xff, 0x21, 0x24, 0x31, 0xff, 0x18, 0x19, 0x22, 0xff, 0x11, 0x12, 0x1d, 0xff, 0x13, 0x17, 0x20, 0xff, 0x02, 0x09, 0x0d, 0xff, 0x07, 0x0f, 0x14, 0xff, 0x08, 0x0e, 0x13, 0xff, 0x03, 0x06, 0x0b, 0xff, 0x08, 0x0b, 0x0f, 0xff, 0x13, 0x16, 0x1d, 0xff, 0x15, 0x16, 0x25, 0xff, 0x0e, 0x10, 0x1a, 0xff, 0x06, 0x0a, 0x0f, 0xff, 0x0a, 0x0d, 0x12, 0xff, 0x0d, 0x0f, 0x14, 0xff, 0x12, 0x14, 0x19, 0xff, 0x1f, 0x1e, 0x29, 0xff, 0x27, 0x27, 0x34, 0xff, 0x11, 0x15, 0x20, 0xff, 0x15, 0x1a, 0x2b, 0xff, 0x1e, 0x24, 0x36, 0xff, 0x1b, 0x26, 0x37, 0xff, 0x14, 0x1f, 0x2b, 0xff, 0x0e, 0x0f, 0x16, 0xff, 0x0b, 0x09, 0x11, 0xff, 0x08, 0x0c, 0x0f, 0xff, 0x0b, 0x0f, 0x0f, 0xff, 0x01, 0x06, 0x06, 0xff, 0x0b, 0x0d, 0x0e, 0xff, 0x13, 0x11, 0x12, 0xff, 0x10, 0x0d, 0x0e, 0xff, 0x11, 0x10, 0x12, 0xff, 0x17, 0x19, 0x24, 0xff, 0x22, 0x24, 0x30, 0xff, 0x15, 0x16, 0x21, 0xff, 0x0f, 0x12, 0x1e, 0xff, 0x14, 0x17, 0x22, 0xff, 0x17, 0x1b, 0x26, 0xff, 0x26, 0x2d, 0x36, 0xff, 0x1d, 0x22, 0x2f, 0xff, 0x0c, 0x0f, 0x16, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0b, 0x0c, 0x15, 0xff, 0x20, 0x22, 0x2a, 0xff, 0x14, 0x17, 0x1c, 0xff, 0x18, 0x19, 0x23, 0xff, 0x0f, 0x13, 0x1a, 0xff, 0x04, 0x08, 0x0e, 0xff, 0x44, 0x3a, 0x31, 0xff, 0xa4, 0x8b, 0x62, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb6, 0x9b, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x92, 0x5a, 0x44, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb2, 0x96, 0x5c, 0xff, 0xae, 0x99, 0x5c, 0xff, 0xb9, 0x9f, 0x5c, 0xff, 0x93, 0x82, 0x57, 0xff, 0x47, 0x4b, 0x4d, 0xff, 0x2b, 0x33, 0x47, 0xff, 0x28, 0x32, 0x3f, 0xff, 0x24, 0x2a, 0x3b, 0xff, 0x1b, 0x23, 0x31, 0xff, 0x19, 0x21, 0x31, 0xff, 0x19, 0x1d, 0x29, 0xff, 0x15, 0x16, 0x1f, 0xff, 0x0f, 0x11, 0x1c, 0xff, 0x0e, 0x12, 0x1b, 0xff, 0x0e, 0x14, 0x1c, 0xff, 0x12, 0x17, 0x21, 0xff, 0x14, 0x1a, 0x22, 0xff, 0x05, 0x0b, 0x0f, 0xff, 0x01, 0x06, 0x09, 0xff, 0x06, 0x0b, 0x0f, 0xff, 0x0d, 0x11, 0x1b, 0xff, 0x0e, 0x12, 0x1e, 0xff, 0x12, 0x14, 0x21, 0xff, 0x0c, 0x0d, 0x17, 0xff, 0x03, 0x04, 0x0e, 0xff, 0x0a, 0x0b, 0x15, 0xff, 0x0f, 0x0f, 0x1c, 0xff, 0x1a, 0x1c, 0x29, 0xff, 0x18, 0x1e, 0x2a, 0xff, 0x1c, 0x22, 0x31, 0xff, 0x20, 0x27, 0x3a, 0xff, 0x20, 0x27, 0x3f, 0xff, 0x26, 0x35, 0x4e, 0xff, 0x14, 0x1e, 0x34, 0xff, 0x01, 0x02, 0x11, 0xff, 0x00, 0x00, 0x07, 0xff, 0x04, 0x08, 0x0a, 0xff, 0x09, 0x0c, 0x11, 0xff, 0x0c, 0x0f, 0x14, 0xff, 0x0e, 0x11, 0x17, 0xff, 0x13, 0x15, 0x1b, 0xff, 0x0a, 0x0d, 0x12, 0xff, 0x04, 0x06, 0x11, 0xff, 0x0d, 0x0f, 0x1a, 0xff, 0x18, 0x1a, 0x24, 0xff, 0x16, 0x1a, 0x25, 0xff, 0x0c, 0x10, 0x1b, 0xff, 0x11, 0x14, 0x1f, 0xff, 0x10, 0x16, 0x1f, 0xff, 0x16, 0x1a, 0x27, 0xff, 0x11, 0x13, 0x1a, 0xff, 0x02, 0x06, 0x06, 0xff, 0x1b, 0x1d, 0x26, 0xff, 0x25, 0x27, 0x2f, 0xff, 0x16, 0x18, 0x1f, 0xff, 0x17, 0x16, 0x25, 0xff, 0x17, 0x19, 0x23, 0xff, 0x0b, 0x0c, 0x15, 0xff, 0x1a, 0x14, 0x16, 0xff, 0x66, 0x58, 0x41, 0xff, 0x9e, 0x87, 0x56, 0xff, 0xbd, 0xa0, 0x66, 0xff, 0xb7, 0x9c, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb4, 0x99, 0x61, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x92, 0x59, 0xc8, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xad, 0x92, 0x59, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x97, 0x5c, 0xff, 0xac, 0x98, 0x5b, 0xff, 0xb9, 0xa0, 0x5f, 0xff, 0x98, 0x87, 0x60, 0xff, 0x4b, 0x4b, 0x4e, 0xff, 0x31, 0x36, 0x4b, 0xff, 0x2c, 0x34, 0x42, 0xff, 0x28, 0x2f, 0x3e, 0xff, 0x1d, 0x24, 0x32, 0xff, 0x1d, 0x23, 0x32, 0xff, 0x11, 0x15, 0x21, 0xff, 0x1b, 0x1d, 0x27, 0xff, 0x16, 0x18, 0x21, 0xff, 0x15, 0x18, 0x24, 0xff, 0x14, 0x19, 0x26, 0xff, 0x0f, 0x13, 0x1d, 0xff, 0x0b, 0x10, 0x1a, 0xff, 0x0c, 0x11, 0x1e, 0xff, 0x12, 0x17, 0x25, 0xff, 0x0e, 0x15, 0x24, 0xff, 0x08, 0x16, 0x25, 0xff, 0x15, 0x21, 0x38, 0xff, 0x13, 0x1e, 0x3a, 0xff, 0x14, 0x1f, 0x38, 0xff, 0x11, 0x1c, 0x34, 0xff, 0x0a, 0x14, 0x2d, 0xff, 0x13, 0x1b, 0x35, 0xff, 0x1b, 0x26, 0x3f, 0xff, 0x19, 0x2b, 0x41, 0xff, 0x22, 0x34, 0x4b, 0xff, 0x27, 0x38, 0x56, 0xff, 0x21, 0x31, 0x57, 0xff, 0x2d, 0x45, 0x72, 0xff, 0x26, 0x3e, 0x68, 0xff, 0x0d, 0x1a, 0x3a, 0xff, 0x0d, 0x1a, 0x31, 0xff, 0x0a, 0x16, 0x29, 0xff, 0x0c, 0x18, 0x2c, 0xff, 0x1c, 0x28, 0x3a, 0xff, 0x18, 0x25, 0x37, 0xff, 0x19, 0x26, 0x39, 0xff, 0x0b, 0x15, 0x28, 0xff, 0x10, 0x12, 0x1d, 0xff, 0x13, 0x16, 0x20, 0xff, 0x14, 0x18, 0x23, 0xff, 0x12, 0x15, 0x21, 0xff, 0x17, 0x1b, 0x26, 0xff, 0x1d, 0x21, 0x2d, 0xff, 0x0f, 0x15, 0x1e, 0xff, 0x0d, 0x10, 0x1c, 0xff, 0x03, 0x05, 0x0d, 0xff, 0x04, 0x08, 0x09, 0xff, 0x14, 0x16, 0x1d, 0xff, 0x0f, 0x10, 0x18, 0xff, 0x14, 0x17, 0x1b, 0xff, 0x1c, 0x1f, 0x25, 0xff, 0x0f, 0x13, 0x16, 0xff, 0x0e, 0x12, 0x13, 0xff, 0x06, 0x08, 0x0a, 0xff, 0x3c, 0x3a, 0x28, 0xff, 0x8f, 0x7d, 0x4b, 0xff, 0xba, 0x9d, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb4, 0x99, 0x60, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x95, 0x59, 0x4d, 0xaf, 0x94, 0x5b, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x96, 0x5e, 0xff, 0xb1, 0x99, 0x5e, 0xff, 0xb2, 0x97, 0x5d, 0xff, 0xb7, 0x9d, 0x5c, 0xff, 0x9a, 0x8c, 0x66, 0xff, 0x53, 0x51, 0x55, 0xff, 0x23, 0x27, 0x3f, 0xff, 0x20, 0x28, 0x3a, 0xff, 0x25, 0x2d, 0x39, 0xff, 0x15, 0x1b, 0x29, 0xff, 0x16, 0x19, 0x23, 0xff, 0x16, 0x1b, 0x24, 0xff, 0x16, 0x1c, 0x25, 0xff, 0x13, 0x15, 0x1e, 0xff, 0x15, 0x14, 0x21, 0xff, 0x0e, 0x0c, 0x1a, 0xff, 0x05, 0x07, 0x0f, 0xff, 0x07, 0x0a, 0x10, 0xff, 0x0a, 0x0c, 0x18, 0xff, 0x1e, 0x22, 0x38, 0xff, 0x22, 0x2a, 0x47, 0xff, 0x1d, 0x2c, 0x4d, 0xff, 0x34, 0x44, 0x6c, 0xff, 0x39, 0x4a, 0x78, 0xff, 0x37, 0x4a, 0x77, 0xff, 0x31, 0x45, 0x71, 0xff, 0x2a, 0x3d, 0x6a, 0xff, 0x28, 0x37, 0x63, 0xff, 0x2c, 0x3c, 0x65, 0xff, 0x32, 0x45, 0x6a, 0xff, 0x2b, 0x3e, 0x64, 0xff, 0x2c, 0x41, 0x6d, 0xff, 0x43, 0x5c, 0x8e, 0xff, 0x3a, 0x54, 0x89, 0xff, 0x2e, 0x46, 0x79, 0xff, 0x2a, 0x41, 0x71, 0xff, 0x21, 0x35, 0x61, 0xff, 0x2d, 0x3e, 0x67, 0xff, 0x16, 0x29, 0x4c, 0xff, 0x1d, 0x2f, 0x45, 0xff, 0x2a, 0x35, 0x4c, 0xff, 0x20, 0x2e, 0x46, 0xff, 0x1b, 0x1f, 0x37, 0xff, 0x13, 0x17, 0x24, 0xff, 0x20, 0x28, 0x34, 0xff, 0x10, 0x18, 0x27, 0xff, 0x08, 0x09, 0x16, 0xff, 0x22, 0x23, 0x2e, 0xff, 0x17, 0x1e, 0x28, 0xff, 0x0e, 0x11, 0x1c, 0xff, 0x13, 0x15, 0x1e, 0xff, 0x07, 0x09, 0x14, 0xff, 0x00, 0x00, 0x07, 0xff, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x03, 0xff, 0x0b, 0x0c, 0x12, 0xff, 0x11, 0x15, 0x1c, 0xff, 0x04, 0x0a, 0x0d, 0xff, 0x04, 0x08, 0x09, 0xff, 0x13, 0x15, 0x13, 0xff, 0x37, 0x32, 0x20, 0xff, 0x8d, 0x79, 0x4a, 0xff, 0xbc, 0xa0, 0x64, 0xff, 0xb6, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x60, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x94, 0x5a, 0xcd, 0xaf, 0x94, 0x5b, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x98, 0x5d, 0xff, 0xb7, 0x97, 0x5c, 0xff, 0xba, 0xa0, 0x5e, 0xff, 0x83, 0x7a, 0x57, 0xff, 0x2f, 0x34, 0x43, 0xff, 0x19, 0x28, 0x3c, 0xff, 0x15, 0x22, 0x33, 0xff, 0x23, 0x2a, 0x39, 0xff, 0x1e, 0x24, 0x31, 0xff, 0x08, 0x09, 0x14, 0xff, 0x08, 0x0c, 0x15, 0xff, 0x06, 0x0d, 0x15, 0xff, 0x07, 0x08, 0x13, 0xff, 0x0c, 0x09, 0x11, 0xff, 0x0c, 0x09, 0x10, 0xff, 0x07, 0x08, 0x15, 0xff, 0x09, 0x0f, 0x21, 0xff, 0x11, 0x1b, 0x35, 0xff, 0x25, 0x30, 0x51, 0xff, 0x36, 0x46, 0x73, 0xff, 0x42, 0x5a, 0x94, 0xff, 0x50, 0x6a, 0xa7, 0xff, 0x58, 0x74, 0xb3, 0xff, 0x5b, 0x76, 0xb6, 0xff, 0x54, 0x6f, 0xae, 0xff, 0x52, 0x6d, 0xad, 0xff, 0x47, 0x61, 0x9f, 0xff, 0x39, 0x4e, 0x8a, 0xff, 0x44, 0x52, 0x8a, 0xff, 0x35, 0x45, 0x7d, 0xff, 0x48, 0x5d, 0x99, 0xff, 0x60, 0x7a, 0xbc, 0xff, 0x47, 0x65, 0xa8, 0xff, 0x3c, 0x5c, 0x9d, 0xff, 0x55, 0x71, 0xb2, 0xff, 0x3b, 0x55, 0x8e, 0xff, 0x3d, 0x51, 0x85, 0xff, 0x37, 0x48, 0x77, 0xff, 0x20, 0x2f, 0x4d, 0xff, 0x1d, 0x2c, 0x45, 0xff, 0x1e, 0x31, 0x4c, 0xff, 0x1d, 0x26, 0x41, 0xff, 0x14, 0x1b, 0x32, 0xff, 0x13, 0x1a, 0x2e, 0xff, 0x14, 0x1a, 0x2b, 0xff, 0x07, 0x08, 0x12, 0xff, 0x0c, 0x0f, 0x16, 0xff, 0x16, 0x1e, 0x26, 0xff, 0x18, 0x1c, 0x26, 0xff, 0x17, 0x18, 0x22, 0xff, 0x10, 0x12, 0x1d, 0xff, 0x03, 0x04, 0x0b, 0xff, 0x01, 0x01, 0x04, 0xff, 0x04, 0x05, 0x08, 0xff, 0x11, 0x12, 0x16, 0xff, 0x07, 0x07, 0x0c, 0xff, 0x00, 0x00, 0x01, 0xff, 0x02, 0x03, 0x04, 0xff, 0x1c, 0x17, 0x12, 0xff, 0x50, 0x47, 0x29, 0xff, 0xa2, 0x89, 0x59, 0xff, 0xbb, 0x9e, 0x64, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x93, 0x57, 0x40, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb3, 0x96, 0x5e, 0xff, 0xb1, 0x99, 0x5c, 0xff, 0xb4, 0xa0, 0x5d, 0xff, 0xa2, 0x91, 0x5b, 0xff, 0x46, 0x43, 0x40, 0xff, 0x1f, 0x25, 0x41, 0xff, 0x2b, 0x38, 0x47, 0xff, 0x2e, 0x33, 0x44, 0xff, 0x1f, 0x23, 0x34, 0xff, 0x19, 0x1f, 0x2b, 0xff, 0x0e, 0x0f, 0x1a, 0xff, 0x05, 0x0a, 0x13, 0xff, 0x08, 0x0e, 0x17, 0xff, 0x05, 0x06, 0x10, 0xff, 0x06, 0x07, 0x0d, 0xff, 0x07, 0x0b, 0x14, 0xff, 0x14, 0x1d, 0x35, 0xff, 0x1b, 0x2c, 0x52, 0xff, 0x31, 0x4a, 0x7b, 0xff, 0x46, 0x62, 0x9a, 0xff, 0x5b, 0x79, 0xba, 0xff, 0x62, 0x87, 0xce, 0xff, 0x69, 0x91, 0xd5, 0xff, 0x70, 0x9a, 0xdc, 0xff, 0x77, 0x9e, 0xe1, 0xff, 0x77, 0x9e, 0xe1, 0xff, 0x6d, 0x94, 0xd7, 0xff, 0x64, 0x88, 0xcb, 0xff, 0x56, 0x7b, 0xbc, 0xff, 0x53, 0x7d, 0xba, 0xff, 0x51, 0x76, 0xb2, 0xff, 0x61, 0x85, 0xc3, 0xff, 0x6e, 0x99, 0xdd, 0xff, 0x68, 0x93, 0xda, 0xff, 0x67, 0x8e, 0xd3, 0xff, 0x6c, 0x93, 0xd5, 0xff, 0x64, 0x87, 0xc6, 0xff, 0x52, 0x6c, 0xa9, 0xff, 0x44, 0x54, 0x8e, 0xff, 0x28, 0x35, 0x5d, 0xff, 0x1d, 0x2f, 0x4c, 0xff, 0x20, 0x35, 0x52, 0xff, 0x28, 0x33, 0x52, 0xff, 0x29, 0x34, 0x55, 0xff, 0x13, 0x1b, 0x35, 0xff, 0x10, 0x13, 0x25, 0xff, 0x07, 0x09, 0x0f, 0xff, 0x00, 0x00, 0x02, 0xff, 0x0a, 0x13, 0x16, 0xff, 0x18, 0x1d, 0x25, 0xff, 0x1b, 0x1d, 0x27, 0xff, 0x1c, 0x1e, 0x2a, 0xff, 0x0f, 0x11, 0x18, 0xff, 0x04, 0x05, 0x08, 0xff, 0x00, 0x00, 0x04, 0xff, 0x10, 0x11, 0x15, 0xff, 0x10, 0x0f, 0x10, 0xff, 0x02, 0x04, 0x01, 0xff, 0x0a, 0x08, 0x08, 0xff, 0x17, 0x0e, 0x05, 0xff, 0x71, 0x66, 0x3e, 0xff, 0xb2, 0x94, 0x62, 0xff, 0xb5, 0x98, 0x60, 0xff, 0xb5, 0x9b, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb3, 0x9b, 0x5f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x92, 0x59, 0xb3, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb0, 0x95, 0x5b, 0xff, 0xb6, 0x9f, 0x61, 0xff, 0x97, 0x86, 0x58, 0xff, 0x35, 0x35, 0x39, 0xff, 0x1d, 0x2c, 0x3e, 0xff, 0x30, 0x39, 0x4c, 0xff, 0x29, 0x2e, 0x3c, 0xff, 0x1e, 0x22, 0x30, 0xff, 0x19, 0x1e, 0x2e, 0xff, 0x13, 0x18, 0x26, 0xff, 0x0b, 0x13, 0x23, 0xff, 0x08, 0x12, 0x21, 0xff, 0x06, 0x0d, 0x19, 0xff, 0x07, 0x12, 0x1b, 0xff, 0x12, 0x1d, 0x33, 0xff, 0x25, 0x34, 0x59, 0xff, 0x3d, 0x5c, 0x89, 0xff, 0x58, 0x7c, 0xbd, 0xff, 0x63, 0x8b, 0xd1, 0xff, 0x6c, 0x9b, 0xdf, 0xff, 0x76, 0xa0, 0xe6, 0xff, 0x80, 0xa7, 0xea, 0xff, 0x8a, 0xb0, 0xef, 0xff, 0x8a, 0xaf, 0xef, 0xff, 0x87, 0xac, 0xed, 0xff, 0x82, 0xa7, 0xe8, 0xff, 0x7d, 0xa3, 0xe3, 0xff, 0x7b, 0xa3, 0xe4, 0xff, 0x73, 0x9d, 0xe2, 0xff, 0x74, 0x9b, 0xdc, 0xff, 0x7d, 0xa4, 0xe2, 0xff, 0x7b, 0xa7, 0xe6, 0xff, 0x82, 0xac, 0xed, 0xff, 0x87, 0xad, 0xee, 0xff, 0x80, 0xa7, 0xe7, 0xff, 0x7d, 0xa5, 0xe7, 0xff, 0x73, 0x9a, 0xdd, 0xff, 0x65, 0x85, 0xc5, 0xff, 0x4d, 0x65, 0x9f, 0xff, 0x2b, 0x3a, 0x69, 0xff, 0x17, 0x25, 0x49, 0xff, 0x1a, 0x26, 0x44, 0xff, 0x23, 0x35, 0x56, 0xff, 0x24, 0x31, 0x4c, 0xff, 0x09, 0x10, 0x23, 0xff, 0x00, 0x00, 0x06, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x06, 0x08, 0xff, 0x01, 0x07, 0x0f, 0xff, 0x0b, 0x12, 0x1c, 0xff, 0x26, 0x2d, 0x37, 0xff, 0x1a, 0x1f, 0x26, 0xff, 0x07, 0x09, 0x0d, 0xff, 0x02, 0x05, 0x0a, 0xff, 0x04, 0x07, 0x0a, 0xff, 0x0c, 0x0e, 0x0d, 0xff, 0x0b, 0x0d, 0x08, 0xff, 0x16, 0x12, 0x0f, 0xff, 0x20, 0x17, 0x0d, 0xff, 0x75, 0x62, 0x3e, 0xff, 0xb8, 0x97, 0x65, 0xff, 0xb4, 0x9c, 0x62, 0xff, 0xb2, 0x9d, 0x63, 0xff, 0xb1, 0x9b, 0x61, 0xff, 0xb4, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x96, 0x5a, 0x22, 0xad, 0x92, 0x5a, 0xfe, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5f, 0xff, 0xb2, 0x97, 0x5b, 0xff, 0xb1, 0x9b, 0x64, 0xff, 0x52, 0x4f, 0x40, 0xff, 0x15, 0x1f, 0x2d, 0xff, 0x24, 0x2a, 0x40, 0xff, 0x1a, 0x21, 0x2f, 0xff, 0x2a, 0x32, 0x3f, 0xff, 0x1b, 0x23, 0x32, 0xff, 0x0e, 0x16, 0x24, 0xff, 0x13, 0x1c, 0x2e, 0xff, 0x1b, 0x26, 0x3c, 0xff, 0x17, 0x23, 0x38, 0xff, 0x0b, 0x1e, 0x36, 0xff, 0x20, 0x34, 0x60, 0xff, 0x40, 0x57, 0x92, 0xff, 0x58, 0x81, 0xbf, 0xff, 0x69, 0x95, 0xde, 0xff, 0x6c, 0x9a, 0xe6, 0xff, 0x72, 0xa4, 0xe9, 0xff, 0x81, 0xac, 0xed, 0xff, 0x8b, 0xb2, 0xf1, 0xff, 0x91, 0xb5, 0xf2, 0xff, 0x8e, 0xb2, 0xf0, 0xff, 0x88, 0xad, 0xeb, 0xff, 0x89, 0xae, 0xec, 0xff, 0x8f, 0xb1, 0xef, 0xff, 0x8e, 0xae, 0xee, 0xff, 0x87, 0xa5, 0xea, 0xff, 0x8a, 0xa6, 0xea, 0xff, 0x91, 0xaf, 0xef, 0xff, 0x8d, 0xae, 0xee, 0xff, 0x88, 0xad, 0xed, 0xff, 0x83, 0xa9, 0xea, 0xff, 0x86, 0xab, 0xeb, 0xff, 0x7e, 0xa7, 0xeb, 0xff, 0x72, 0xa0, 0xe9, 0xff, 0x75, 0x9e, 0xe8, 0xff, 0x71, 0x96, 0xde, 0xff, 0x58, 0x78, 0xb8, 0xff, 0x36, 0x52, 0x8c, 0xff, 0x1b, 0x35, 0x67, 0xff, 0x14, 0x29, 0x50, 0xff, 0x1d, 0x2c, 0x4b, 0xff, 0x1a, 0x23, 0x3c, 0xff, 0x03, 0x07, 0x19, 0xff, 0x00, 0x00, 0x05, 0xff, 0x04, 0x04, 0x0b, 0xff, 0x00, 0x05, 0x0d, 0xff, 0x06, 0x0b, 0x11, 0xff, 0x10, 0x17, 0x1d, 0xff, 0x13, 0x16, 0x1a, 0xff, 0x05, 0x06, 0x07, 0xff, 0x02, 0x04, 0x06, 0xff, 0x02, 0x05, 0x06, 0xff, 0x03, 0x06, 0x05, 0xff, 0x07, 0x08, 0x07, 0xff, 0x0c, 0x08, 0x08, 0xff, 0x38, 0x2a, 0x1a, 0xff, 0x99, 0x83, 0x54, 0xff, 0xb9, 0x9f, 0x67, 0xff, 0xb1, 0x9c, 0x62, 0xff, 0xb2, 0x9d, 0x63, 0xff, 0xb0, 0x9b, 0x61, 0xff, 0xb4, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x61, 0xfe, 0xb4, 0x9d, 0x61, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x92, 0x59, 0x86, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb4, 0x99, 0x5f, 0xff, 0xb3, 0x99, 0x62, 0xff, 0xb2, 0x96, 0x5a, 0xff, 0xbc, 0xa3, 0x62, 0xff, 0x82, 0x79, 0x58, 0xff, 0x2e, 0x2e, 0x3d, 0xff, 0x21, 0x22, 0x3b, 0xff, 0x24, 0x2c, 0x3a, 0xff, 0x23, 0x2f, 0x3a, 0xff, 0x12, 0x1e, 0x2c, 0xff, 0x17, 0x22, 0x2e, 0xff, 0x20, 0x2a, 0x3c, 0xff, 0x19, 0x25, 0x40, 0xff, 0x1a, 0x2c, 0x4b, 0xff, 0x28, 0x40, 0x65, 0xff, 0x45, 0x5b, 0x93, 0xff, 0x58, 0x72, 0xbc, 0xff, 0x5d, 0x8a, 0xd2, 0xff, 0x68, 0x94, 0xdd, 0xff, 0x73, 0x9e, 0xe6, 0xff, 0x80, 0xac, 0xea, 0xff, 0x84, 0xaf, 0xed, 0xff, 0x8b, 0xb2, 0xef, 0xff, 0x8e, 0xb4, 0xed, 0xff, 0x8e, 0xb4, 0xed, 0xff, 0x8e, 0xb4, 0xed, 0xff, 0x8d, 0xb2, 0xec, 0xff, 0x8d, 0xb3, 0xed, 0xff, 0x8c, 0xb2, 0xee, 0xff, 0x88, 0xad, 0xec, 0xff, 0x88, 0xaa, 0xea, 0xff, 0x8b, 0xae, 0xee, 0xff, 0x88, 0xb0, 0xef, 0xff, 0x85, 0xac, 0xec, 0xff, 0x83, 0xa8, 0xe9, 0xff, 0x81, 0xa7, 0xe8, 0xff, 0x7e, 0xa4, 0xe5, 0xff, 0x74, 0x9c, 0xde, 0xff, 0x6a, 0x90, 0xd9, 0xff, 0x62, 0x8b, 0xd5, 0xff, 0x5b, 0x89, 0xce, 0xff, 0x5b, 0x82, 0xc9, 0xff, 0x4d, 0x70, 0xb5, 0xff, 0x36, 0x55, 0x90, 0xff, 0x23, 0x3d, 0x6e, 0xff, 0x17, 0x2b, 0x55, 0xff, 0x15, 0x20, 0x41, 0xff, 0x0b, 0x0c, 0x1d, 0xff, 0x02, 0x02, 0x0e, 0xff, 0x01, 0x03, 0x09, 0xff, 0x03, 0x06, 0x09, 0xff, 0x03, 0x07, 0x0c, 0xff, 0x08, 0x09, 0x0a, 0xff, 0x03, 0x02, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x03, 0x05, 0x04, 0xff, 0x02, 0x05, 0x04, 0xff, 0x00, 0x00, 0x05, 0xff, 0x00, 0x00, 0x02, 0xff, 0x64, 0x53, 0x39, 0xff, 0xbc, 0xa3, 0x62, 0xff, 0xb2, 0x9f, 0x60, 0xff, 0xaf, 0x9a, 0x61, 0xff, 0xb1, 0x9c, 0x62, 0xff, 0xb0, 0x9a, 0x60, 0xff, 0xb4, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x60, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x7f, 0x3f, 0x04, 0xaf, 0x95, 0x5b, 0xe7, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb4, 0x98, 0x5f, 0xff, 0xb2, 0x98, 0x60, 0xff, 0xb4, 0x9a, 0x5f, 0xff, 0xba, 0x9e, 0x5f, 0xff, 0x9d, 0x88, 0x58, 0xff, 0x3b, 0x3d, 0x3f, 0xff, 0x1e, 0x2b, 0x40, 0xff, 0x1c, 0x2a, 0x3d, 0xff, 0x0e, 0x1b, 0x2c, 0xff, 0x12, 0x1d, 0x2a, 0xff, 0x1a, 0x27, 0x35, 0xff, 0x19, 0x29, 0x3b, 0xff, 0x17, 0x2a, 0x46, 0xff, 0x28, 0x3e, 0x69, 0xff, 0x41, 0x5b, 0x93, 0xff, 0x54, 0x71, 0xb1, 0xff, 0x56, 0x79, 0xbd, 0xff, 0x5b, 0x85, 0xcc, 0xff, 0x67, 0x91, 0xda, 0xff, 0x74, 0x9e, 0xe3, 0xff, 0x80, 0xaa, 0xeb, 0xff, 0x89, 0xb2, 0xf1, 0xff, 0x8c, 0xb2, 0xf0, 0xff, 0x8e, 0xb2, 0xee, 0xff, 0x8f, 0xb4, 0xef, 0xff, 0x91, 0xb6, 0xf1, 0xff, 0x8e, 0xb3, 0xef, 0xff, 0x8a, 0xae, 0xec, 0xff, 0x87, 0xad, 0xeb, 0xff, 0x84, 0xac, 0xea, 0xff, 0x82, 0xaa, 0xe9, 0xff, 0x82, 0xa9, 0xe8, 0xff, 0x81, 0xaa, 0xe8, 0xff, 0x82, 0xa9, 0xe8, 0xff, 0x82, 0xa8, 0xe9, 0xff, 0x7f, 0xa5, 0xe6, 0xff, 0x7a, 0xa1, 0xe0, 0xff, 0x6f, 0x96, 0xd4, 0xff, 0x64, 0x8b, 0xce, 0xff, 0x5f, 0x87, 0xcd, 0xff, 0x54, 0x7d, 0xc6, 0xff, 0x55, 0x7a, 0xc1, 0xff, 0x52, 0x75, 0xba, 0xff, 0x4d, 0x6f, 0xb3, 0xff, 0x4b, 0x67, 0xa4, 0xff, 0x30, 0x46, 0x7d, 0xff, 0x1c, 0x2f, 0x57, 0xff, 0x18, 0x24, 0x40, 0xff, 0x09, 0x11, 0x22, 0xff, 0x00, 0x00, 0x07, 0xff, 0x02, 0x00, 0x00, 0xff, 0x04, 0x05, 0x03, 0xff, 0x00, 0x03, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x05, 0x01, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x04, 0x03, 0xff, 0x01, 0x02, 0x05, 0xff, 0x01, 0x00, 0x03, 0xff, 0x63, 0x58, 0x3a, 0xff, 0xbb, 0xa6, 0x64, 0xff, 0xb3, 0x9f, 0x5f, 0xff, 0xb7, 0x9f, 0x65, 0xff, 0xb7, 0x9c, 0x64, 0xff, 0xb5, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9b, 0x63, 0xe7, 0xbf, 0x7f, 0x7f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x96, 0x5a, 0x49, 0xb0, 0x95, 0x5c, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb4, 0x98, 0x5f, 0xff, 0xb1, 0x98, 0x5f, 0xff, 0xb1, 0x98, 0x5d, 0xff, 0xba, 0x9d, 0x60, 0xff, 0xae, 0x96, 0x63, 0xff, 0x41, 0x43, 0x3c, 0xff, 0x16, 0x24, 0x33, 0xff, 0x24, 0x2f, 0x42, 0xff, 0x20, 0x29, 0x38, 0xff, 0x14, 0x1c, 0x27, 0xff, 0x15, 0x21, 0x32, 0xff, 0x18, 0x2b, 0x47, 0xff, 0x2d, 0x44, 0x68, 0xff, 0x3f, 0x5a, 0x8d, 0xff, 0x47, 0x66, 0xa5, 0xff, 0x4f, 0x73, 0xb7, 0xff, 0x50, 0x78, 0xbb, 0xff, 0x53, 0x7e, 0xc6, 0xff, 0x60, 0x8c, 0xd9, 0xff, 0x6c, 0x9a, 0xe2, 0xff, 0x78, 0xa5, 0xec, 0xff, 0x86, 0xb0, 0xf3, 0xff, 0x89, 0xb0, 0xf1, 0xff, 0x8b, 0xb0, 0xee, 0xff, 0x8b, 0xb1, 0xf0, 0xff, 0x8b, 0xb0, 0xf0, 0xff, 0x89, 0xaf, 0xee, 0xff, 0x86, 0xa8, 0xea, 0xff, 0x83, 0xa6, 0xe8, 0xff, 0x7f, 0xa7, 0xe7, 0xff, 0x7e, 0xa8, 0xe8, 0xff, 0x7f, 0xa8, 0xe8, 0xff, 0x7e, 0xa6, 0xe6, 0xff, 0x7c, 0xa4, 0xe5, 0xff, 0x79, 0xa1, 0xe4, 0xff, 0x76, 0x9e, 0xe0, 0xff, 0x6f, 0x98, 0xd9, 0xff, 0x69, 0x91, 0xd4, 0xff, 0x62, 0x89, 0xce, 0xff, 0x5e, 0x84, 0xcd, 0xff, 0x58, 0x7e, 0xc9, 0xff, 0x4f, 0x73, 0xb9, 0xff, 0x46, 0x68, 0xad, 0xff, 0x40, 0x63, 0xaa, 0xff, 0x45, 0x65, 0xaa, 0xff, 0x45, 0x61, 0xa3, 0xff, 0x2d, 0x4b, 0x81, 0xff, 0x22, 0x3c, 0x68, 0xff, 0x10, 0x25, 0x47, 0xff, 0x00, 0x07, 0x19, 0xff, 0x02, 0x01, 0x02, 0xff, 0x03, 0x03, 0x00, 0xff, 0x00, 0x02, 0x05, 0xff, 0x00, 0x01, 0x04, 0xff, 0x02, 0x01, 0x00, 0xff, 0x03, 0x01, 0x00, 0xff, 0x04, 0x05, 0x05, 0xff, 0x02, 0x04, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x4c, 0x42, 0x27, 0xff, 0xbf, 0xa6, 0x6e, 0xff, 0xb7, 0x9e, 0x66, 0xff, 0xb6, 0x9c, 0x61, 0xff, 0xb6, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb6, 0x9b, 0x63, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x95, 0x5b, 0x9f, 0xb0, 0x95, 0x5c, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xae, 0x93, 0x5a, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb4, 0x98, 0x5f, 0xff, 0xb1, 0x97, 0x5f, 0xff, 0xb1, 0x98, 0x5e, 0xff, 0xbc, 0x9f, 0x62, 0xff, 0xa1, 0x8a, 0x59, 0xff, 0x22, 0x1f, 0x16, 0xff, 0x14, 0x1c, 0x24, 0xff, 0x24, 0x29, 0x36, 0xff, 0x1a, 0x1c, 0x26, 0xff, 0x0f, 0x12, 0x1c, 0xff, 0x14, 0x1e, 0x31, 0xff, 0x27, 0x3a, 0x62, 0xff, 0x36, 0x4e, 0x81, 0xff, 0x3c, 0x5d, 0x93, 0xff, 0x44, 0x67, 0xa5, 0xff, 0x49, 0x6d, 0xb2, 0xff, 0x4a, 0x74, 0xba, 0xff, 0x47, 0x76, 0xc0, 0xff, 0x4f, 0x7f, 0xcf, 0xff, 0x5d, 0x8d, 0xd9, 0xff, 0x6b, 0x9b, 0xe2, 0xff, 0x7b, 0xa8, 0xec, 0xff, 0x7e, 0xa8, 0xe9, 0xff, 0x7f, 0xa7, 0xe7, 0xff, 0x7c, 0xa5, 0xe6, 0xff, 0x7b, 0xa5, 0xe6, 0xff, 0x78, 0xa3, 0xe3, 0xff, 0x7a, 0xa0, 0xe3, 0xff, 0x78, 0x9f, 0xe3, 0xff, 0x73, 0x9f, 0xe1, 0xff, 0x73, 0x9e, 0xe1, 0xff, 0x74, 0x9e, 0xe1, 0xff, 0x74, 0x9e, 0xe1, 0xff, 0x71, 0x9b, 0xdf, 0xff, 0x6d, 0x97, 0xdd, 0xff, 0x67, 0x91, 0xd7, 0xff, 0x62, 0x8a, 0xcf, 0xff, 0x61, 0x87, 0xcc, 0xff, 0x5b, 0x80, 0xcb, 0xff, 0x55, 0x7a, 0xc7, 0xff, 0x50, 0x77, 0xc2, 0xff, 0x4b, 0x70, 0xb7, 0xff, 0x45, 0x68, 0xac, 0xff, 0x38, 0x58, 0x9b, 0xff, 0x34, 0x54, 0x99, 0xff, 0x3a, 0x5c, 0xa2, 0xff, 0x38, 0x59, 0x99, 0xff, 0x33, 0x50, 0x84, 0xff, 0x24, 0x3b, 0x67, 0xff, 0x0b, 0x1d, 0x39, 0xff, 0x00, 0x07, 0x0f, 0xff, 0x00, 0x01, 0x00, 0xff, 0x01, 0x06, 0x09, 0xff, 0x03, 0x08, 0x0f, 0xff, 0x02, 0x06, 0x08, 0xff, 0x05, 0x04, 0x04, 0xff, 0x06, 0x02, 0x01, 0xff, 0x02, 0x01, 0x02, 0xff, 0x04, 0x01, 0x06, 0xff, 0x6d, 0x64, 0x3f, 0xff, 0xc5, 0xa8, 0x6a, 0xff, 0xb9, 0x9c, 0x64, 0xff, 0xb5, 0x9b, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb6, 0x9b, 0x63, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x91, 0x6d, 0x07, 0xae, 0x94, 0x5a, 0xef, 0xaf, 0x94, 0x5b, 0xff, 0xaf, 0x94, 0x5b, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x98, 0x5f, 0xff, 0xb2, 0x98, 0x60, 0xff, 0xb3, 0x9a, 0x5e, 0xff, 0xbb, 0xa0, 0x5f, 0xff, 0x97, 0x85, 0x57, 0xff, 0x15, 0x14, 0x0a, 0xff, 0x01, 0x03, 0x0e, 0xff, 0x24, 0x28, 0x2e, 0xff, 0x0a, 0x0e, 0x14, 0xff, 0x01, 0x01, 0x08, 0xff, 0x11, 0x1e, 0x37, 0xff, 0x2c, 0x43, 0x6f, 0xff, 0x3b, 0x54, 0x88, 0xff, 0x3f, 0x5d, 0x95, 0xff, 0x44, 0x63, 0xa7, 0xff, 0x48, 0x6c, 0xb6, 0xff, 0x4a, 0x73, 0xbc, 0xff, 0x48, 0x70, 0xbc, 0xff, 0x4d, 0x75, 0xc3, 0xff, 0x56, 0x80, 0xcd, 0xff, 0x62, 0x8e, 0xd9, 0xff, 0x6c, 0x98, 0xe2, 0xff, 0x71, 0x9c, 0xe4, 0xff, 0x6f, 0x9a, 0xdf, 0xff, 0x6f, 0x97, 0xd8, 0xff, 0x6f, 0x96, 0xd8, 0xff, 0x71, 0x97, 0xdb, 0xff, 0x71, 0x98, 0xde, 0xff, 0x70, 0x99, 0xdd, 0xff, 0x70, 0x98, 0xdd, 0xff, 0x6e, 0x98, 0xdd, 0xff, 0x6a, 0x95, 0xda, 0xff, 0x68, 0x93, 0xd8, 0xff, 0x65, 0x8f, 0xd5, 0xff, 0x61, 0x8b, 0xd1, 0xff, 0x5d, 0x88, 0xcd, 0xff, 0x56, 0x80, 0xc6, 0xff, 0x54, 0x7b, 0xc1, 0xff, 0x53, 0x78, 0xbf, 0xff, 0x4a, 0x6e, 0xb4, 0xff, 0x44, 0x6b, 0xaf, 0xff, 0x43, 0x67, 0xab, 0xff, 0x40, 0x61, 0xa3, 0xff, 0x3d, 0x5a, 0x9a, 0xff, 0x36, 0x53, 0x93, 0xff, 0x36, 0x56, 0x95, 0xff, 0x37, 0x53, 0x8f, 0xff, 0x38, 0x4f, 0x87, 0xff, 0x2b, 0x43, 0x6f, 0xff, 0x18, 0x2a, 0x4d, 0xff, 0x0d, 0x18, 0x2b, 0xff, 0x0b, 0x11, 0x17, 0xff, 0x06, 0x09, 0x12, 0xff, 0x09, 0x0c, 0x15, 0xff, 0x0b, 0x0c, 0x11, 0xff, 0x09, 0x09, 0x0d, 0xff, 0x06, 0x04, 0x0c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x20, 0x1c, 0x10, 0xff, 0x9a, 0x89, 0x51, 0xff, 0xb4, 0x9d, 0x5c, 0xff, 0xb6, 0x9d, 0x61, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9b, 0x63, 0xef, 0xb6, 0x91, 0x6d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x95, 0x5e, 0x46, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb0, 0x95, 0x5c, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb2, 0x97, 0x5f, 0xff, 0xb4, 0x9a, 0x5d, 0xff, 0xb5, 0x9e, 0x5c, 0xff, 0x9c, 0x88, 0x56, 0xff, 0x47, 0x43, 0x34, 0xff, 0x0d, 0x11, 0x22, 0xff, 0x1a, 0x1e, 0x25, 0xff, 0x00, 0x03, 0x06, 0xff, 0x00, 0x02, 0x0b, 0xff, 0x15, 0x25, 0x44, 0xff, 0x2e, 0x47, 0x74, 0xff, 0x38, 0x53, 0x85, 0xff, 0x3d, 0x59, 0x93, 0xff, 0x42, 0x60, 0xa6, 0xff, 0x46, 0x67, 0xb3, 0xff, 0x46, 0x6b, 0xb4, 0xff, 0x46, 0x6a, 0xb3, 0xff, 0x4f, 0x6f, 0xb9, 0xff, 0x4f, 0x75, 0xbe, 0xff, 0x57, 0x7f, 0xca, 0xff, 0x5c, 0x85, 0xd3, 0xff, 0x61, 0x8b, 0xd6, 0xff, 0x5e, 0x8b, 0xd1, 0xff, 0x64, 0x89, 0xcb, 0xff, 0x66, 0x8a, 0xcd, 0xff, 0x69, 0x8b, 0xd3, 0xff, 0x6c, 0x92, 0xd9, 0xff, 0x6e, 0x95, 0xda, 0xff, 0x6f, 0x95, 0xda, 0xff, 0x6e, 0x97, 0xdc, 0xff, 0x67, 0x91, 0xd6, 0xff, 0x61, 0x8b, 0xd0, 0xff, 0x5d, 0x85, 0xca, 0xff, 0x58, 0x80, 0xc4, 0xff, 0x57, 0x7e, 0xc3, 0xff, 0x4e, 0x76, 0xbc, 0xff, 0x48, 0x6f, 0xb5, 0xff, 0x4a, 0x6e, 0xb0, 0xff, 0x42, 0x66, 0xa5, 0xff, 0x3e, 0x62, 0xa3, 0xff, 0x3e, 0x5e, 0x9f, 0xff, 0x3a, 0x57, 0x99, 0xff, 0x35, 0x51, 0x95, 0xff, 0x34, 0x52, 0x94, 0xff, 0x35, 0x54, 0x92, 0xff, 0x36, 0x51, 0x8c, 0xff, 0x3a, 0x51, 0x8d, 0xff, 0x2c, 0x47, 0x76, 0xff, 0x1e, 0x32, 0x56, 0xff, 0x1a, 0x28, 0x3f, 0xff, 0x10, 0x1a, 0x27, 0xff, 0x0e, 0x12, 0x20, 0xff, 0x0b, 0x0d, 0x18, 0xff, 0x0b, 0x0b, 0x14, 0xff, 0x10, 0x12, 0x1a, 0xff, 0x08, 0x0a, 0x16, 0xff, 0x00, 0x00, 0x02, 0xff, 0x31, 0x2f, 0x18, 0xff, 0xab, 0x93, 0x56, 0xff, 0xb3, 0xa0, 0x61, 0xff, 0xb4, 0x9b, 0x62, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb6, 0x9c, 0x62, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x96, 0x5c, 0x8d, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb3, 0x99, 0x60, 0xff, 0xb3, 0x97, 0x5e, 0xff, 0xb4, 0x9b, 0x5c, 0xff, 0xad, 0x9b, 0x5e, 0xff, 0xb5, 0x97, 0x59, 0xff, 0x72, 0x64, 0x4c, 0xff, 0x27, 0x30, 0x4a, 0xff, 0x19, 0x20, 0x2d, 0xff, 0x00, 0x02, 0x07, 0xff, 0x17, 0x1c, 0x28, 0xff, 0x2c, 0x3e, 0x5e, 0xff, 0x31, 0x4c, 0x7d, 0xff, 0x38, 0x54, 0x8b, 0xff, 0x37, 0x57, 0x96, 0xff, 0x3e, 0x5f, 0xa4, 0xff, 0x40, 0x5e, 0xa6, 0xff, 0x3c, 0x60, 0xa5, 0xff, 0x3c, 0x5f, 0xa5, 0xff, 0x45, 0x64, 0xad, 0xff, 0x48, 0x6c, 0xb3, 0xff, 0x4c, 0x74, 0xbb, 0xff, 0x52, 0x79, 0xc2, 0xff, 0x56, 0x7e, 0xc4, 0xff, 0x5a, 0x83, 0xc5, 0xff, 0x5f, 0x86, 0xc6, 0xff, 0x61, 0x86, 0xc9, 0xff, 0x64, 0x87, 0xcf, 0xff, 0x65, 0x8b, 0xd2, 0xff, 0x67, 0x8f, 0xd4, 0xff, 0x69, 0x91, 0xd6, 0xff, 0x6c, 0x92, 0xd8, 0xff, 0x64, 0x8a, 0xd0, 0xff, 0x5a, 0x81, 0xc5, 0xff, 0x56, 0x7b, 0xc0, 0xff, 0x54, 0x76, 0xbc, 0xff, 0x4f, 0x72, 0xb7, 0xff, 0x46, 0x6a, 0xb1, 0xff, 0x41, 0x65, 0xac, 0xff, 0x43, 0x64, 0xa8, 0xff, 0x41, 0x61, 0xa3, 0xff, 0x3a, 0x5b, 0x9d, 0xff, 0x37, 0x53, 0x97, 0xff, 0x34, 0x4e, 0x92, 0xff, 0x32, 0x4f, 0x93, 0xff, 0x2e, 0x4c, 0x8e, 0xff, 0x2b, 0x4b, 0x89, 0xff, 0x30, 0x4d, 0x8c, 0xff, 0x36, 0x4f, 0x8f, 0xff, 0x35, 0x52, 0x84, 0xff, 0x2c, 0x43, 0x69, 0xff, 0x1a, 0x2a, 0x42, 0xff, 0x15, 0x21, 0x31, 0xff, 0x1a, 0x21, 0x33, 0xff, 0x0a, 0x0f, 0x1e, 0xff, 0x05, 0x07, 0x11, 0xff, 0x14, 0x16, 0x1e, 0xff, 0x13, 0x12, 0x1e, 0xff, 0x00, 0x01, 0x0a, 0xff, 0x40, 0x3c, 0x24, 0xff, 0xb0, 0x99, 0x5c, 0xff, 0xae, 0x9b, 0x5e, 0xff, 0xb4, 0x9a, 0x60, 0xff, 0xb7, 0x9c, 0x64, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb6, 0x9b, 0x63, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x95, 0x5c, 0xd7, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb1, 0x96, 0x5d, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x98, 0x5f, 0xff, 0xb3, 0x9a, 0x5e, 0xff, 0xb0, 0x9a, 0x5f, 0xff, 0xc4, 0xa3, 0x62, 0xff, 0x85, 0x75, 0x55, 0xff, 0x1f, 0x29, 0x3d, 0xff, 0x14, 0x1e, 0x29, 0xff, 0x08, 0x10, 0x17, 0xff, 0x25, 0x2f, 0x3f, 0xff, 0x35, 0x48, 0x69, 0xff, 0x34, 0x4f, 0x7e, 0xff, 0x3c, 0x5b, 0x91, 0xff, 0x39, 0x5a, 0x97, 0xff, 0x3d, 0x5c, 0x9e, 0xff, 0x3b, 0x5a, 0x9c, 0xff, 0x37, 0x59, 0x9a, 0xff, 0x39, 0x5a, 0x9b, 0xff, 0x42, 0x60, 0xa4, 0xff, 0x48, 0x69, 0xad, 0xff, 0x48, 0x6a, 0xb1, 0xff, 0x49, 0x6d, 0xb6, 0xff, 0x53, 0x78, 0xbe, 0xff, 0x5b, 0x80, 0xc4, 0xff, 0x5e, 0x83, 0xc7, 0xff, 0x5c, 0x81, 0xc4, 0xff, 0x5d, 0x81, 0xc6, 0xff, 0x5f, 0x85, 0xc9, 0xff, 0x64, 0x8b, 0xce, 0xff, 0x69, 0x8f, 0xd3, 0xff, 0x69, 0x8e, 0xd2, 0xff, 0x60, 0x85, 0xc9, 0xff, 0x58, 0x7b, 0xc2, 0xff, 0x56, 0x78, 0xbe, 0xff, 0x56, 0x76, 0xbc, 0xff, 0x4e, 0x6f, 0xb5, 0xff, 0x48, 0x68, 0xaf, 0xff, 0x45, 0x63, 0xa8, 0xff, 0x41, 0x5f, 0xa2, 0xff, 0x40, 0x5d, 0x9e, 0xff, 0x39, 0x55, 0x98, 0xff, 0x32, 0x4d, 0x8e, 0xff, 0x32, 0x4d, 0x8d, 0xff, 0x31, 0x4d, 0x8f, 0xff, 0x2f, 0x4c, 0x8c, 0xff, 0x30, 0x4e, 0x8a, 0xff, 0x32, 0x4f, 0x8d, 0xff, 0x33, 0x51, 0x90, 0xff, 0x3a, 0x58, 0x8c, 0xff, 0x33, 0x4b, 0x75, 0xff, 0x21, 0x32, 0x4f, 0xff, 0x21, 0x2a, 0x3a, 0xff, 0x15, 0x1b, 0x26, 0xff, 0x04, 0x0e, 0x1a, 0xff, 0x04, 0x0b, 0x1a, 0xff, 0x17, 0x1b, 0x26, 0xff, 0x18, 0x1c, 0x22, 0xff, 0x00, 0x02, 0x09, 0xff, 0x24, 0x26, 0x1a, 0xff, 0xa4, 0x92, 0x5c, 0xff, 0xb7, 0xa1, 0x5d, 0xff, 0xb4, 0x9d, 0x62, 0xff, 0xb8, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb6, 0x9c, 0x62, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb0, 0x93, 0x58, 0x1a, 0xb1, 0x96, 0x5d, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb7, 0x9b, 0x61, 0xff, 0xbe, 0xa0, 0x61, 0xff, 0x8b, 0x7c, 0x59, 0xff, 0x1a, 0x23, 0x2c, 0xff, 0x09, 0x12, 0x18, 0xff, 0x16, 0x21, 0x29, 0xff, 0x2b, 0x3a, 0x4f, 0xff, 0x29, 0x3f, 0x5f, 0xff, 0x38, 0x51, 0x80, 0xff, 0x3d, 0x60, 0x95, 0xff, 0x3a, 0x5b, 0x95, 0xff, 0x3c, 0x59, 0x99, 0xff, 0x37, 0x58, 0x99, 0xff, 0x32, 0x52, 0x93, 0xff, 0x34, 0x55, 0x94, 0xff, 0x3d, 0x5e, 0x9d, 0xff, 0x48, 0x67, 0xa9, 0xff, 0x48, 0x66, 0xae, 0xff, 0x45, 0x68, 0xb5, 0xff, 0x53, 0x77, 0xbf, 0xff, 0x59, 0x7e, 0xc4, 0xff, 0x5b, 0x7f, 0xc7, 0xff, 0x58, 0x7d, 0xc1, 0xff, 0x5a, 0x81, 0xc1, 0xff, 0x62, 0x88, 0xc8, 0xff, 0x66, 0x8c, 0xcc, 0xff, 0x69, 0x8e, 0xcf, 0xff, 0x66, 0x8c, 0xcc, 0xff, 0x60, 0x86, 0xc8, 0xff, 0x5c, 0x81, 0xc7, 0xff, 0x59, 0x7b, 0xc3, 0xff, 0x59, 0x7b, 0xc0, 0xff, 0x52, 0x76, 0xbc, 0xff, 0x4e, 0x6d, 0xb3, 0xff, 0x49, 0x64, 0xa9, 0xff, 0x44, 0x61, 0xa2, 0xff, 0x3e, 0x5c, 0x9d, 0xff, 0x38, 0x54, 0x98, 0xff, 0x32, 0x51, 0x91, 0xff, 0x31, 0x4f, 0x8d, 0xff, 0x2f, 0x4a, 0x8b, 0xff, 0x35, 0x51, 0x90, 0xff, 0x3f, 0x5b, 0x96, 0xff, 0x3b, 0x5a, 0x94, 0xff, 0x36, 0x5a, 0x96, 0xff, 0x39, 0x58, 0x8d, 0xff, 0x2e, 0x46, 0x74, 0xff, 0x1f, 0x30, 0x53, 0xff, 0x18, 0x1d, 0x2d, 0xff, 0x08, 0x0c, 0x0f, 0xff, 0x06, 0x14, 0x1f, 0xff, 0x15, 0x20, 0x34, 0xff, 0x2a, 0x31, 0x3d, 0xff, 0x23, 0x2b, 0x2e, 0xff, 0x0f, 0x14, 0x19, 0xff, 0x0b, 0x12, 0x18, 0xff, 0x87, 0x7a, 0x4d, 0xff, 0xc5, 0xaa, 0x61, 0xff, 0xb2, 0x9d, 0x63, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb3, 0xa0, 0x67, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb0, 0x96, 0x5c, 0x58, 0xb1, 0x96, 0x5d, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb4, 0x98, 0x5f, 0xff, 0xb6, 0x9a, 0x60, 0xff, 0xc0, 0x9f, 0x61, 0xff, 0x8d, 0x7f, 0x60, 0xff, 0x1f, 0x29, 0x34, 0xff, 0x0a, 0x12, 0x19, 0xff, 0x18, 0x25, 0x30, 0xff, 0x2d, 0x3e, 0x56, 0xff, 0x26, 0x3e, 0x61, 0xff, 0x3a, 0x57, 0x88, 0xff, 0x40, 0x64, 0x9d, 0xff, 0x3f, 0x62, 0xa0, 0xff, 0x40, 0x5f, 0xa1, 0xff, 0x37, 0x59, 0x9d, 0xff, 0x2f, 0x51, 0x95, 0xff, 0x2f, 0x54, 0x94, 0xff, 0x38, 0x5c, 0x9b, 0xff, 0x45, 0x66, 0xa8, 0xff, 0x4c, 0x6e, 0xb5, 0xff, 0x4a, 0x71, 0xbd, 0xff, 0x52, 0x7a, 0xc3, 0xff, 0x5a, 0x83, 0xc8, 0xff, 0x61, 0x84, 0xcc, 0xff, 0x63, 0x87, 0xcb, 0xff, 0x66, 0x8c, 0xcc, 0xff, 0x68, 0x8e, 0xce, 0xff, 0x69, 0x8e, 0xcf, 0xff, 0x67, 0x8c, 0xcd, 0xff, 0x64, 0x8a, 0xcb, 0xff, 0x65, 0x8a, 0xcc, 0xff, 0x63, 0x86, 0xcc, 0xff, 0x5e, 0x82, 0xc9, 0xff, 0x5a, 0x82, 0xc7, 0xff, 0x55, 0x7d, 0xc2, 0xff, 0x55, 0x79, 0xc1, 0xff, 0x51, 0x6d, 0xb8, 0xff, 0x47, 0x67, 0xac, 0xff, 0x3e, 0x5e, 0xa2, 0xff, 0x37, 0x56, 0x9d, 0xff, 0x34, 0x54, 0x98, 0xff, 0x32, 0x53, 0x94, 0xff, 0x34, 0x52, 0x96, 0xff, 0x3d, 0x5a, 0x9c, 0xff, 0x40, 0x5d, 0x9d, 0xff, 0x3c, 0x5d, 0x9b, 0xff, 0x37, 0x5c, 0x9d, 0xff, 0x33, 0x57, 0x8d, 0xff, 0x30, 0x4a, 0x79, 0xff, 0x1f, 0x31, 0x56, 0xff, 0x0f, 0x17, 0x2a, 0xff, 0x0e, 0x13, 0x1f, 0xff, 0x18, 0x26, 0x3a, 0xff, 0x21, 0x32, 0x43, 0xff, 0x22, 0x2b, 0x35, 0xff, 0x1d, 0x21, 0x2b, 0xff, 0x18, 0x1b, 0x25, 0xff, 0x10, 0x16, 0x1c, 0xff, 0x7f, 0x70, 0x46, 0xff, 0xc7, 0xab, 0x68, 0xff, 0xb4, 0x9e, 0x67, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb6, 0x9c, 0x65, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb1, 0x96, 0x5d, 0x90, 0xb1, 0x96, 0x5d, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb1, 0x99, 0x5f, 0xff, 0xb4, 0x9b, 0x61, 0xff, 0xbe, 0xa2, 0x62, 0xff, 0x85, 0x74, 0x50, 0xff, 0x18, 0x20, 0x2b, 0xff, 0x14, 0x1f, 0x26, 0xff, 0x1b, 0x25, 0x2f, 0xff, 0x1b, 0x2d, 0x45, 0xff, 0x25, 0x3d, 0x64, 0xff, 0x3b, 0x58, 0x8e, 0xff, 0x49, 0x6e, 0xaa, 0xff, 0x45, 0x6a, 0xac, 0xff, 0x41, 0x65, 0xa9, 0xff, 0x3b, 0x5f, 0xa4, 0xff, 0x37, 0x59, 0xa0, 0xff, 0x34, 0x57, 0x9a, 0xff, 0x37, 0x5b, 0x9a, 0xff, 0x43, 0x67, 0xa8, 0xff, 0x4e, 0x74, 0xb8, 0xff, 0x50, 0x79, 0xc2, 0xff, 0x55, 0x7f, 0xc6, 0xff, 0x5d, 0x87, 0xcd, 0xff, 0x65, 0x8b, 0xd2, 0xff, 0x6a, 0x90, 0xd5, 0xff, 0x6a, 0x90, 0xd3, 0xff, 0x6a, 0x91, 0xd2, 0xff, 0x6a, 0x92, 0xd3, 0xff, 0x68, 0x8f, 0xd0, 0xff, 0x66, 0x8e, 0xcf, 0xff, 0x68, 0x8f, 0xd3, 0xff, 0x67, 0x8c, 0xd3, 0xff, 0x64, 0x8c, 0xd2, 0xff, 0x63, 0x8d, 0xd1, 0xff, 0x61, 0x8a, 0xcc, 0xff, 0x60, 0x86, 0xcb, 0xff, 0x5a, 0x7b, 0xc5, 0xff, 0x53, 0x75, 0xbc, 0xff, 0x4b, 0x6d, 0xb5, 0xff, 0x40, 0x63, 0xac, 0xff, 0x3d, 0x60, 0xa5, 0xff, 0x41, 0x64, 0xa7, 0xff, 0x45, 0x64, 0xac, 0xff, 0x46, 0x67, 0xab, 0xff, 0x43, 0x64, 0xa3, 0xff, 0x36, 0x57, 0x98, 0xff, 0x2f, 0x52, 0x94, 0xff, 0x2d, 0x4d, 0x89, 0xff, 0x2e, 0x4b, 0x7d, 0xff, 0x1c, 0x33, 0x58, 0xff, 0x15, 0x20, 0x33, 0xff, 0x1d, 0x26, 0x33, 0xff, 0x21, 0x2f, 0x42, 0xff, 0x19, 0x27, 0x35, 0xff, 0x10, 0x17, 0x21, 0xff, 0x0e, 0x12, 0x1d, 0xff, 0x0f, 0x14, 0x1f, 0xff, 0x1d, 0x20, 0x25, 0xff, 0x8f, 0x7e, 0x52, 0xff, 0xc2, 0xa6, 0x66, 0xff, 0xb4, 0x9d, 0x66, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x63, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb1, 0x96, 0x5e, 0xc6, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x99, 0x60, 0xff, 0xad, 0x9a, 0x60, 0xff, 0xad, 0x9b, 0x61, 0xff, 0xbc, 0xa7, 0x65, 0xff, 0x98, 0x82, 0x54, 0xff, 0x1b, 0x21, 0x2a, 0xff, 0x0b, 0x18, 0x21, 0xff, 0x18, 0x1a, 0x20, 0xff, 0x10, 0x23, 0x37, 0xff, 0x23, 0x3b, 0x64, 0xff, 0x46, 0x61, 0x9a, 0xff, 0x51, 0x73, 0xb3, 0xff, 0x43, 0x68, 0xac, 0xff, 0x40, 0x6a, 0xb2, 0xff, 0x45, 0x6e, 0xb9, 0xff, 0x45, 0x69, 0xb5, 0xff, 0x3e, 0x61, 0xaa, 0xff, 0x3f, 0x66, 0xaa, 0xff, 0x4a, 0x74, 0xb8, 0xff, 0x54, 0x80, 0xc4, 0xff, 0x5a, 0x85, 0xc8, 0xff, 0x60, 0x8a, 0xcd, 0xff, 0x63, 0x8e, 0xd1, 0xff, 0x63, 0x8f, 0xd1, 0xff, 0x6b, 0x95, 0xd8, 0xff, 0x6e, 0x92, 0xd8, 0xff, 0x6a, 0x93, 0xd5, 0xff, 0x6a, 0x94, 0xd5, 0xff, 0x66, 0x90, 0xd1, 0xff, 0x67, 0x90, 0xd3, 0xff, 0x6b, 0x94, 0xd9, 0xff, 0x69, 0x92, 0xd5, 0xff, 0x65, 0x8f, 0xd5, 0xff, 0x66, 0x91, 0xd7, 0xff, 0x6b, 0x93, 0xd5, 0xff, 0x66, 0x8c, 0xce, 0xff, 0x63, 0x89, 0xcf, 0xff, 0x65, 0x8a, 0xd3, 0xff, 0x61, 0x87, 0xd1, 0xff, 0x58, 0x83, 0xcb, 0xff, 0x59, 0x83, 0xc8, 0xff, 0x57, 0x7f, 0xc6, 0xff, 0x58, 0x7b, 0xca, 0xff, 0x49, 0x76, 0xbd, 0xff, 0x47, 0x71, 0xb0, 0xff, 0x3e, 0x5d, 0x9e, 0xff, 0x33, 0x4e, 0x8f, 0xff, 0x31, 0x4a, 0x8b, 0xff, 0x2b, 0x4a, 0x7d, 0xff, 0x1c, 0x39, 0x5c, 0xff, 0x0b, 0x1e, 0x33, 0xff, 0x0f, 0x1f, 0x2c, 0xff, 0x1f, 0x2b, 0x36, 0xff, 0x1c, 0x22, 0x2c, 0xff, 0x0e, 0x0f, 0x1a, 0xff, 0x0a, 0x0f, 0x17, 0xff, 0x02, 0x08, 0x11, 0xff, 0x1b, 0x1a, 0x19, 0xff, 0x9f, 0x8b, 0x59, 0xff, 0xc2, 0xa8, 0x6a, 0xff, 0xb5, 0x9e, 0x63, 0xff, 0xb9, 0x9d, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x65, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x01, 0xb2, 0x96, 0x5d, 0xf2, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb1, 0x9a, 0x60, 0xff, 0xb1, 0x9a, 0x61, 0xff, 0xbd, 0xa4, 0x62, 0xff, 0xa8, 0x90, 0x5c, 0xff, 0x23, 0x28, 0x2d, 0xff, 0x01, 0x09, 0x14, 0xff, 0x08, 0x0c, 0x17, 0xff, 0x0b, 0x20, 0x36, 0xff, 0x34, 0x4e, 0x79, 0xff, 0x50, 0x6a, 0xa3, 0xff, 0x50, 0x6f, 0xab, 0xff, 0x49, 0x6a, 0xaa, 0xff, 0x48, 0x71, 0xb6, 0xff, 0x52, 0x80, 0xca, 0xff, 0x5a, 0x84, 0xce, 0xff, 0x61, 0x89, 0xd2, 0xff, 0x6a, 0x90, 0xd5, 0xff, 0x67, 0x92, 0xd9, 0xff, 0x67, 0x94, 0xd9, 0xff, 0x6c, 0x96, 0xd8, 0xff, 0x70, 0x9a, 0xda, 0xff, 0x6c, 0x96, 0xd6, 0xff, 0x69, 0x93, 0xd5, 0xff, 0x6a, 0x91, 0xd3, 0xff, 0x6d, 0x90, 0xd2, 0xff, 0x6a, 0x90, 0xd1, 0xff, 0x69, 0x90, 0xd1, 0xff, 0x68, 0x8e, 0xcf, 0xff, 0x68, 0x8f, 0xcf, 0xff, 0x6c, 0x92, 0xd3, 0xff, 0x66, 0x8d, 0xce, 0xff, 0x67, 0x90, 0xd4, 0xff, 0x6d, 0x96, 0xde, 0xff, 0x6f, 0x97, 0xda, 0xff, 0x70, 0x95, 0xd9, 0xff, 0x73, 0x95, 0xdc, 0xff, 0x75, 0x9b, 0xdc, 0xff, 0x77, 0x9d, 0xd9, 0xff, 0x77, 0x9c, 0xd8, 0xff, 0x73, 0x9c, 0xdd, 0xff, 0x6e, 0x97, 0xde, 0xff, 0x6b, 0x94, 0xe0, 0xff, 0x57, 0x88, 0xd1, 0xff, 0x4c, 0x77, 0xbb, 0xff, 0x47, 0x67, 0xa5, 0xff, 0x3f, 0x5e, 0x98, 0xff, 0x38, 0x53, 0x8e, 0xff, 0x32, 0x4c, 0x82, 0xff, 0x2e, 0x46, 0x72, 0xff, 0x0e, 0x23, 0x45, 0xff, 0x10, 0x1e, 0x37, 0xff, 0x19, 0x22, 0x33, 0xff, 0x18, 0x1f, 0x2a, 0xff, 0x10, 0x12, 0x1b, 0xff, 0x0b, 0x11, 0x1a, 0xff, 0x01, 0x08, 0x12, 0xff, 0x12, 0x11, 0x11, 0xff, 0x99, 0x86, 0x56, 0xff, 0xc1, 0xa7, 0x68, 0xff, 0xb4, 0x9e, 0x62, 0xff, 0xba, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xf2, 0xff, 0xff, 0x00, 0x01,
+    0xb1, 0x9a, 0x5c, 0x21, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x9a, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xbb, 0x9f, 0x5e, 0xff, 0xb2, 0x9b, 0x60, 0xff, 0x31, 0x34, 0x36, 0xff, 0x00, 0x04, 0x12, 0xff, 0x06, 0x0c, 0x16, 0xff, 0x17, 0x2f, 0x4a, 0xff, 0x4a, 0x66, 0x98, 0xff, 0x52, 0x6b, 0xa4, 0xff, 0x5a, 0x74, 0xac, 0xff, 0x5d, 0x7e, 0xbb, 0xff, 0x58, 0x82, 0xc6, 0xff, 0x6c, 0x98, 0xdd, 0xff, 0x78, 0xa0, 0xe5, 0xff, 0x81, 0xa5, 0xe8, 0xff, 0x7c, 0xa0, 0xe0, 0xff, 0x72, 0x99, 0xd7, 0xff, 0x71, 0x9b, 0xda, 0xff, 0x70, 0x9a, 0xdb, 0xff, 0x6b, 0x94, 0xd8, 0xff, 0x61, 0x89, 0xce, 0xff, 0x5c, 0x81, 0xc0, 0xff, 0x57, 0x7a, 0xb8, 0xff, 0x5a, 0x7a, 0xba, 0xff, 0x5d, 0x7d, 0xc1, 0xff, 0x5f, 0x7f, 0xc4, 0xff, 0x60, 0x80, 0xc5, 0xff, 0x5c, 0x7f, 0xc1, 0xff, 0x54, 0x77, 0xb7, 0xff, 0x50, 0x73, 0xb3, 0xff, 0x5a, 0x7c, 0xb8, 0xff, 0x57, 0x76, 0xad, 0xff, 0x51, 0x6f, 0xa2, 0xff, 0x59, 0x71, 0xa4, 0xff, 0x60, 0x74, 0xa6, 0xff, 0x5d, 0x76, 0x9c, 0xff, 0x55, 0x6d, 0x8d, 0xff, 0x4d, 0x62, 0x88, 0xff, 0x50, 0x69, 0x96, 0xff, 0x5a, 0x78, 0xab, 0xff, 0x66, 0x8e, 0xc8, 0xff, 0x6e, 0x9c, 0xd9, 0xff, 0x5d, 0x85, 0xcf, 0xff, 0x4d, 0x6c, 0xb1, 0xff, 0x4e, 0x69, 0xa6, 0xff, 0x42, 0x5f, 0x95, 0xff, 0x3c, 0x56, 0x8c, 0xff, 0x3e, 0x56, 0x8a, 0xff, 0x2c, 0x44, 0x72, 0xff, 0x17, 0x28, 0x4b, 0xff, 0x0f, 0x16, 0x2d, 0xff, 0x12, 0x18, 0x23, 0xff, 0x11, 0x15, 0x1d, 0xff, 0x0e, 0x10, 0x16, 0xff, 0x02, 0x04, 0x0d, 0xff, 0x13, 0x17, 0x1b, 0xff, 0xa2, 0x91, 0x5e, 0xff, 0xc1, 0xa4, 0x66, 0xff, 0xb5, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9a, 0x64, 0x21,
+    0xb0, 0x95, 0x5f, 0x4b, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x60, 0xff, 0xb5, 0x9c, 0x5e, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xba, 0x9d, 0x60, 0xff, 0xb7, 0xa5, 0x63, 0xff, 0x47, 0x47, 0x3c, 0xff, 0x00, 0x01, 0x10, 0xff, 0x11, 0x1b, 0x20, 0xff, 0x3b, 0x55, 0x7d, 0xff, 0x5c, 0x79, 0xb5, 0xff, 0x58, 0x73, 0xa8, 0xff, 0x6a, 0x84, 0xb6, 0xff, 0x64, 0x8c, 0xcd, 0xff, 0x67, 0x96, 0xe0, 0xff, 0x6f, 0x92, 0xcd, 0xff, 0x5d, 0x77, 0xa7, 0xff, 0x4e, 0x5f, 0x85, 0xff, 0x49, 0x57, 0x77, 0xff, 0x48, 0x59, 0x75, 0xff, 0x3d, 0x4e, 0x66, 0xff, 0x30, 0x41, 0x5b, 0xff, 0x36, 0x4a, 0x6f, 0xff, 0x42, 0x58, 0x85, 0xff, 0x40, 0x5b, 0x89, 0xff, 0x3d, 0x58, 0x8a, 0xff, 0x46, 0x61, 0x99, 0xff, 0x4e, 0x6a, 0xa9, 0xff, 0x53, 0x6f, 0xb1, 0xff, 0x52, 0x6e, 0xb0, 0xff, 0x4d, 0x68, 0xa9, 0xff, 0x3a, 0x53, 0x8c, 0xff, 0x38, 0x4e, 0x7f, 0xff, 0x37, 0x4c, 0x75, 0xff, 0x20, 0x34, 0x54, 0xff, 0x10, 0x1e, 0x3a, 0xff, 0x0f, 0x18, 0x2e, 0xff, 0x14, 0x1a, 0x2b, 0xff, 0x10, 0x17, 0x25, 0xff, 0x13, 0x18, 0x25, 0xff, 0x1f, 0x20, 0x33, 0xff, 0x2b, 0x2e, 0x44, 0xff, 0x2d, 0x33, 0x4b, 0xff, 0x2d, 0x3a, 0x53, 0xff, 0x3a, 0x50, 0x70, 0xff, 0x58, 0x72, 0xae, 0xff, 0x60, 0x7d, 0xc4, 0xff, 0x54, 0x69, 0xaa, 0xff, 0x47, 0x62, 0x98, 0xff, 0x47, 0x66, 0x98, 0xff, 0x47, 0x65, 0x9d, 0xff, 0x41, 0x5d, 0x92, 0xff, 0x31, 0x44, 0x70, 0xff, 0x15, 0x21, 0x41, 0xff, 0x10, 0x16, 0x23, 0xff, 0x0e, 0x14, 0x1a, 0xff, 0x0c, 0x0e, 0x12, 0xff, 0x00, 0x00, 0x05, 0xff, 0x44, 0x45, 0x2a, 0xff, 0xd1, 0xb2, 0x66, 0xff, 0xc7, 0xa4, 0x60, 0xff, 0xb7, 0x9f, 0x5d, 0xff, 0xb6, 0x9f, 0x5d, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9f, 0x64, 0xff, 0xb9, 0x9f, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb7, 0x9c, 0x66, 0x4b,
+    0xb2, 0x96, 0x5c, 0x6b, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x60, 0xff, 0xb5, 0x9c, 0x5e, 0xff, 0xb4, 0x9a, 0x62, 0xff, 0xb9, 0x9b, 0x61, 0xff, 0xbe, 0xa8, 0x60, 0xff, 0x69, 0x61, 0x40, 0xff, 0x06, 0x05, 0x10, 0xff, 0x1c, 0x26, 0x34, 0xff, 0x53, 0x6e, 0x9c, 0xff, 0x65, 0x84, 0xc0, 0xff, 0x5e, 0x7f, 0xb1, 0xff, 0x68, 0x8b, 0xc2, 0xff, 0x6f, 0x8f, 0xd2, 0xff, 0x5a, 0x74, 0xa8, 0xff, 0x26, 0x37, 0x4f, 0xff, 0x11, 0x1a, 0x27, 0xff, 0x19, 0x1b, 0x27, 0xff, 0x20, 0x22, 0x39, 0xff, 0x20, 0x25, 0x37, 0xff, 0x11, 0x14, 0x21, 0xff, 0x08, 0x08, 0x11, 0xff, 0x05, 0x0d, 0x1b, 0xff, 0x17, 0x26, 0x3a, 0xff, 0x23, 0x37, 0x59, 0xff, 0x24, 0x3b, 0x64, 0xff, 0x30, 0x4c, 0x7a, 0xff, 0x3f, 0x5d, 0x91, 0xff, 0x44, 0x61, 0x98, 0xff, 0x3d, 0x5b, 0x91, 0xff, 0x3c, 0x54, 0x8a, 0xff, 0x2c, 0x40, 0x6f, 0xff, 0x23, 0x33, 0x59, 0xff, 0x21, 0x2f, 0x50, 0xff, 0x18, 0x26, 0x43, 0xff, 0x0d, 0x18, 0x33, 0xff, 0x08, 0x12, 0x29, 0xff, 0x0e, 0x19, 0x32, 0xff, 0x1e, 0x28, 0x4d, 0xff, 0x34, 0x41, 0x6e, 0xff, 0x43, 0x58, 0x85, 0xff, 0x41, 0x5a, 0x89, 0xff, 0x3d, 0x55, 0x86, 0xff, 0x3b, 0x44, 0x6f, 0xff, 0x19, 0x24, 0x4a, 0xff, 0x0d, 0x1e, 0x3f, 0xff, 0x3c, 0x57, 0x7b, 0xff, 0x5b, 0x79, 0xa8, 0xff, 0x4c, 0x68, 0xa4, 0xff, 0x48, 0x65, 0x9e, 0xff, 0x48, 0x69, 0xa3, 0xff, 0x4d, 0x6b, 0xa3, 0xff, 0x4f, 0x63, 0x92, 0xff, 0x31, 0x40, 0x63, 0xff, 0x0e, 0x17, 0x27, 0xff, 0x12, 0x12, 0x18, 0xff, 0x02, 0x0d, 0x1c, 0xff, 0x00, 0x03, 0x0b, 0xff, 0x8c, 0x73, 0x3b, 0xff, 0xc6, 0xab, 0x78, 0xff, 0xa0, 0x99, 0x74, 0xff, 0xb3, 0xa5, 0x5c, 0xff, 0xbb, 0xa3, 0x5d, 0xff, 0xb9, 0x9e, 0x66, 0xff, 0xb9, 0x9f, 0x64, 0xff, 0xb9, 0x9f, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9d, 0x64, 0x6b,
+    0xb1, 0x96, 0x5d, 0x8b, 0xb2, 0x97, 0x5e, 0xff, 0xb2, 0x97, 0x5e, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x60, 0xff, 0xb7, 0x9d, 0x5d, 0xff, 0xb7, 0x9a, 0x5d, 0xff, 0xb8, 0x99, 0x5b, 0xff, 0xbf, 0xa5, 0x60, 0xff, 0x98, 0x87, 0x54, 0xff, 0x25, 0x1d, 0x1b, 0xff, 0x23, 0x2d, 0x45, 0xff, 0x60, 0x7e, 0xb0, 0xff, 0x69, 0x8d, 0xc6, 0xff, 0x6d, 0x8c, 0xc0, 0xff, 0x79, 0x95, 0xce, 0xff, 0x43, 0x54, 0x7a, 0xff, 0x0b, 0x11, 0x29, 0xff, 0x16, 0x21, 0x40, 0xff, 0x35, 0x45, 0x68, 0xff, 0x50, 0x64, 0x90, 0xff, 0x55, 0x6d, 0xa4, 0xff, 0x45, 0x5e, 0x91, 0xff, 0x33, 0x4c, 0x79, 0xff, 0x1f, 0x32, 0x59, 0xff, 0x0b, 0x1b, 0x44, 0xff, 0x0f, 0x1a, 0x43, 0xff, 0x18, 0x20, 0x46, 0xff, 0x17, 0x27, 0x51, 0xff, 0x1d, 0x37, 0x65, 0xff, 0x32, 0x4c, 0x82, 0xff, 0x3c, 0x55, 0x8d, 0xff, 0x35, 0x4f, 0x86, 0xff, 0x33, 0x4c, 0x82, 0xff, 0x26, 0x3d, 0x6c, 0xff, 0x1c, 0x30, 0x56, 0xff, 0x18, 0x28, 0x4a, 0xff, 0x13, 0x22, 0x45, 0xff, 0x0f, 0x1f, 0x44, 0xff, 0x18, 0x2b, 0x55, 0xff, 0x2e, 0x45, 0x77, 0xff, 0x42, 0x60, 0x94, 0xff, 0x49, 0x6b, 0xa3, 0xff, 0x4b, 0x6b, 0xa6, 0xff, 0x46, 0x68, 0xa5, 0xff, 0x4c, 0x71, 0xaf, 0xff, 0x51, 0x6f, 0xac, 0xff, 0x43, 0x59, 0x97, 0xff, 0x22, 0x37, 0x64, 0xff, 0x0d, 0x20, 0x45, 0xff, 0x37, 0x55, 0x83, 0xff, 0x55, 0x72, 0xab, 0xff, 0x50, 0x6c, 0xa7, 0xff, 0x49, 0x6d, 0xa8, 0xff, 0x50, 0x70, 0xa9, 0xff, 0x59, 0x70, 0xa0, 0xff, 0x41, 0x52, 0x77, 0xff, 0x12, 0x1e, 0x30, 0xff, 0x11, 0x15, 0x1e, 0xff, 0x0e, 0x14, 0x14, 0xff, 0x24, 0x1c, 0x19, 0xff, 0x75, 0x68, 0x65, 0xff, 0x59, 0x7c, 0xb5, 0xff, 0x62, 0x89, 0xc5, 0xff, 0xa8, 0x9e, 0x80, 0xff, 0xc3, 0xa5, 0x5b, 0xff, 0xbb, 0x9f, 0x66, 0xff, 0xba, 0x9f, 0x64, 0xff, 0xb9, 0x9e, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9d, 0x64, 0x8b,
+    0xb4, 0x99, 0x60, 0xaa, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9b, 0x5f, 0xff, 0xb4, 0x97, 0x63, 0xff, 0xba, 0x98, 0x56, 0xff, 0xb4, 0xae, 0x78, 0xff, 0x92, 0xa3, 0xcc, 0xff, 0x6d, 0x79, 0x93, 0xff, 0x2a, 0x2a, 0x20, 0xff, 0x1f, 0x31, 0x45, 0xff, 0x70, 0x8f, 0xb4, 0xff, 0x71, 0x94, 0xc9, 0xff, 0x7d, 0x9a, 0xcf, 0xff, 0x5b, 0x6f, 0x99, 0xff, 0x08, 0x14, 0x34, 0xff, 0x21, 0x30, 0x56, 0xff, 0x59, 0x70, 0xa2, 0xff, 0x5d, 0x75, 0xac, 0xff, 0x3e, 0x5b, 0x94, 0xff, 0x3d, 0x5e, 0x93, 0xff, 0x40, 0x5f, 0x91, 0xff, 0x34, 0x4f, 0x82, 0xff, 0x25, 0x35, 0x6b, 0xff, 0x1e, 0x29, 0x56, 0xff, 0x17, 0x27, 0x54, 0xff, 0x10, 0x23, 0x4b, 0xff, 0x11, 0x25, 0x4f, 0xff, 0x20, 0x34, 0x63, 0xff, 0x31, 0x46, 0x7d, 0xff, 0x36, 0x51, 0x8a, 0xff, 0x39, 0x50, 0x89, 0xff, 0x32, 0x47, 0x80, 0xff, 0x25, 0x3c, 0x72, 0xff, 0x19, 0x2f, 0x5f, 0xff, 0x10, 0x24, 0x4e, 0xff, 0x0e, 0x1f, 0x3d, 0xff, 0x14, 0x25, 0x50, 0xff, 0x17, 0x30, 0x5b, 0xff, 0x16, 0x28, 0x50, 0xff, 0x16, 0x29, 0x4f, 0xff, 0x22, 0x34, 0x55, 0xff, 0x2e, 0x3d, 0x5c, 0xff, 0x2c, 0x3c, 0x60, 0xff, 0x21, 0x2f, 0x58, 0xff, 0x20, 0x38, 0x64, 0xff, 0x40, 0x54, 0x88, 0xff, 0x43, 0x5c, 0x94, 0xff, 0x1f, 0x3b, 0x74, 0xff, 0x1b, 0x32, 0x63, 0xff, 0x44, 0x5e, 0x8b, 0xff, 0x52, 0x71, 0xa5, 0xff, 0x51, 0x6d, 0xa7, 0xff, 0x53, 0x6e, 0xa3, 0xff, 0x54, 0x6d, 0x9c, 0xff, 0x47, 0x5b, 0x80, 0xff, 0x1f, 0x2d, 0x39, 0xff, 0x14, 0x1c, 0x1e, 0xff, 0x13, 0x17, 0x1a, 0xff, 0x2b, 0x35, 0x47, 0xff, 0x50, 0x6d, 0xaa, 0xff, 0x55, 0x76, 0xcb, 0xff, 0x29, 0x3d, 0x84, 0xff, 0x65, 0x68, 0x6a, 0xff, 0xca, 0xaa, 0x61, 0xff, 0xbd, 0xa2, 0x64, 0xff, 0xb9, 0xa0, 0x67, 0xff, 0xbc, 0x9f, 0x63, 0xff, 0xb9, 0x9e, 0x66, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb7, 0x9c, 0x63, 0xab,
+    0xb3, 0x99, 0x60, 0xbe, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x62, 0xff, 0xb6, 0x9a, 0x5f, 0xff, 0xb6, 0x98, 0x61, 0xff, 0xb7, 0x9c, 0x59, 0xff, 0x94, 0x9b, 0x8c, 0xff, 0x6b, 0x96, 0xe8, 0xff, 0x5e, 0x81, 0xd0, 0xff, 0x23, 0x2e, 0x4f, 0xff, 0x24, 0x29, 0x3e, 0xff, 0x7f, 0x92, 0xb3, 0xff, 0x83, 0x9d, 0xd2, 0xff, 0x6e, 0x8c, 0xc3, 0xff, 0x30, 0x4a, 0x76, 0xff, 0x32, 0x48, 0x78, 0xff, 0x57, 0x6e, 0xa5, 0xff, 0x32, 0x49, 0x78, 0xff, 0x10, 0x26, 0x53, 0xff, 0x10, 0x23, 0x47, 0xff, 0x1f, 0x2d, 0x45, 0xff, 0x1e, 0x2c, 0x42, 0xff, 0x11, 0x1a, 0x31, 0xff, 0x0a, 0x0d, 0x25, 0xff, 0x0d, 0x12, 0x27, 0xff, 0x16, 0x24, 0x42, 0xff, 0x12, 0x28, 0x4d, 0xff, 0x10, 0x26, 0x52, 0xff, 0x25, 0x3d, 0x71, 0xff, 0x3c, 0x56, 0x91, 0xff, 0x41, 0x63, 0x9f, 0xff, 0x48, 0x67, 0xa2, 0xff, 0x40, 0x59, 0x96, 0xff, 0x30, 0x49, 0x85, 0xff, 0x1d, 0x36, 0x6b, 0xff, 0x0e, 0x25, 0x53, 0xff, 0x12, 0x25, 0x48, 0xff, 0x1a, 0x29, 0x56, 0xff, 0x09, 0x17, 0x2e, 0xff, 0x00, 0x00, 0x02, 0xff, 0x03, 0x07, 0x0e, 0xff, 0x1f, 0x22, 0x25, 0xff, 0x18, 0x1a, 0x1c, 0xff, 0x0c, 0x10, 0x16, 0xff, 0x09, 0x0e, 0x1b, 0xff, 0x07, 0x0f, 0x2a, 0xff, 0x18, 0x1f, 0x46, 0xff, 0x2a, 0x3b, 0x6d, 0xff, 0x31, 0x4a, 0x80, 0xff, 0x2f, 0x44, 0x71, 0xff, 0x32, 0x4c, 0x79, 0xff, 0x4b, 0x6c, 0x9f, 0xff, 0x50, 0x6a, 0xa3, 0xff, 0x50, 0x6a, 0x9d, 0xff, 0x53, 0x6c, 0x9a, 0xff, 0x48, 0x5c, 0x81, 0xff, 0x28, 0x36, 0x44, 0xff, 0x18, 0x1b, 0x22, 0xff, 0x11, 0x19, 0x31, 0xff, 0x40, 0x5f, 0x96, 0xff, 0x62, 0x82, 0xcc, 0xff, 0x35, 0x38, 0x67, 0xff, 0x00, 0x00, 0x0b, 0xff, 0x38, 0x35, 0x43, 0xff, 0xc4, 0xaf, 0x70, 0xff, 0xbb, 0xa5, 0x62, 0xff, 0xb0, 0x9f, 0x64, 0xff, 0xba, 0x9f, 0x63, 0xff, 0xba, 0x9e, 0x66, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x64, 0xbe,
+    0xb4, 0x99, 0x5f, 0xd3, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9c, 0x5e, 0xff, 0xc8, 0xac, 0x5c, 0xff, 0x6d, 0x60, 0x62, 0xff, 0x2c, 0x42, 0x7b, 0xff, 0x70, 0x92, 0xdf, 0xff, 0x48, 0x5f, 0x8d, 0xff, 0x30, 0x2c, 0x39, 0xff, 0x77, 0x88, 0xac, 0xff, 0x7e, 0x9f, 0xd4, 0xff, 0x57, 0x76, 0xa8, 0xff, 0x3e, 0x53, 0x7c, 0xff, 0x49, 0x62, 0x96, 0xff, 0x2c, 0x40, 0x74, 0xff, 0x06, 0x0e, 0x2e, 0xff, 0x07, 0x0d, 0x1d, 0xff, 0x0f, 0x11, 0x15, 0xff, 0x0d, 0x0a, 0x08, 0xff, 0x08, 0x05, 0x02, 0xff, 0x1a, 0x15, 0x10, 0xff, 0x02, 0x01, 0x00, 0xff, 0x03, 0x04, 0x04, 0xff, 0x07, 0x12, 0x27, 0xff, 0x17, 0x2a, 0x4e, 0xff, 0x18, 0x2f, 0x5c, 0xff, 0x22, 0x3f, 0x79, 0xff, 0x41, 0x64, 0xa3, 0xff, 0x59, 0x85, 0xc4, 0xff, 0x65, 0x8d, 0xcc, 0xff, 0x57, 0x77, 0xb9, 0xff, 0x3b, 0x57, 0x97, 0xff, 0x1e, 0x3b, 0x75, 0xff, 0x19, 0x32, 0x63, 0xff, 0x28, 0x3d, 0x67, 0xff, 0x14, 0x1c, 0x47, 0xff, 0x18, 0x17, 0x1d, 0xff, 0x63, 0x60, 0x5a, 0xff, 0x1f, 0x1a, 0x14, 0xff, 0x06, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x03, 0xff, 0x02, 0x04, 0x18, 0xff, 0x09, 0x1a, 0x3e, 0xff, 0x2b, 0x3e, 0x6a, 0xff, 0x38, 0x49, 0x71, 0xff, 0x33, 0x4e, 0x7d, 0xff, 0x40, 0x61, 0x96, 0xff, 0x49, 0x64, 0x9d, 0xff, 0x4e, 0x68, 0x9c, 0xff, 0x53, 0x6d, 0x98, 0xff, 0x4b, 0x5f, 0x84, 0xff, 0x2e, 0x38, 0x4e, 0xff, 0x15, 0x18, 0x27, 0xff, 0x26, 0x38, 0x58, 0xff, 0x54, 0x72, 0xaa, 0xff, 0x34, 0x46, 0x7e, 0xff, 0x00, 0x00, 0x19, 0xff, 0x00, 0x00, 0x1c, 0xff, 0x36, 0x3c, 0x62, 0xff, 0xb7, 0xa5, 0x72, 0xff, 0xc2, 0xa4, 0x5d, 0xff, 0xb5, 0x9e, 0x64, 0xff, 0xba, 0x9e, 0x65, 0xff, 0xb9, 0x9f, 0x66, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xba, 0x9f, 0x65, 0xd3,
+    0xb2, 0x98, 0x5e, 0xe7, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb7, 0x9b, 0x61, 0xff, 0xb6, 0x9b, 0x65, 0xff, 0xaf, 0x9c, 0x61, 0xff, 0xc8, 0xaf, 0x64, 0xff, 0x76, 0x6b, 0x63, 0xff, 0x00, 0x00, 0x35, 0xff, 0x3d, 0x54, 0x8c, 0xff, 0x5a, 0x7c, 0xb7, 0xff, 0x30, 0x43, 0x5c, 0xff, 0x6b, 0x7d, 0xa1, 0xff, 0x7f, 0x9c, 0xcd, 0xff, 0x54, 0x73, 0xa2, 0xff, 0x47, 0x5a, 0x8b, 0xff, 0x2a, 0x3f, 0x70, 0xff, 0x00, 0x0d, 0x32, 0xff, 0x03, 0x04, 0x1a, 0xff, 0x08, 0x0a, 0x13, 0xff, 0x14, 0x1c, 0x1f, 0xff, 0x15, 0x1a, 0x1c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0c, 0x0c, 0x09, 0xff, 0x0b, 0x0e, 0x0b, 0xff, 0x38, 0x3a, 0x44, 0xff, 0x22, 0x24, 0x3d, 0xff, 0x32, 0x3f, 0x66, 0xff, 0x39, 0x55, 0x8e, 0xff, 0x2e, 0x52, 0x96, 0xff, 0x51, 0x75, 0xbe, 0xff, 0x77, 0x9c, 0xdd, 0xff, 0x7e, 0xa7, 0xe7, 0xff, 0x62, 0x89, 0xd3, 0xff, 0x3f, 0x65, 0xb1, 0xff, 0x26, 0x4c, 0x90, 0xff, 0x31, 0x4c, 0x85, 0xff, 0x43, 0x57, 0x8b, 0xff, 0x1b, 0x27, 0x54, 0xff, 0x42, 0x48, 0x65, 0xff, 0x80, 0x88, 0x9d, 0xff, 0x3d, 0x43, 0x54, 0xff, 0x14, 0x1a, 0x26, 0xff, 0x21, 0x29, 0x3b, 0xff, 0x2d, 0x36, 0x50, 0xff, 0x32, 0x3c, 0x5d, 0xff, 0x24, 0x31, 0x51, 0xff, 0x21, 0x2f, 0x52, 0xff, 0x1a, 0x2a, 0x50, 0xff, 0x15, 0x24, 0x4b, 0xff, 0x28, 0x3b, 0x64, 0xff, 0x3d, 0x58, 0x86, 0xff, 0x40, 0x5f, 0x95, 0xff, 0x44, 0x60, 0x96, 0xff, 0x4c, 0x65, 0x94, 0xff, 0x53, 0x69, 0x97, 0xff, 0x55, 0x65, 0x88, 0xff, 0x3f, 0x48, 0x5a, 0xff, 0x21, 0x2e, 0x42, 0xff, 0x35, 0x4b, 0x73, 0xff, 0x2e, 0x47, 0x75, 0xff, 0x03, 0x1f, 0x42, 0xff, 0x0e, 0x1a, 0x41, 0xff, 0x00, 0x00, 0x3b, 0xff, 0x2c, 0x40, 0x67, 0xff, 0xb3, 0xa2, 0x6d, 0xff, 0xc0, 0xa5, 0x5f, 0xff, 0xbb, 0xa2, 0x66, 0xff, 0xbc, 0x9f, 0x67, 0xff, 0xba, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0x9f, 0x67, 0xe6,
+    0xb2, 0x97, 0x5e, 0xf0, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb7, 0x9c, 0x62, 0xff, 0xb6, 0x9b, 0x64, 0xff, 0xb7, 0x9d, 0x65, 0xff, 0xc4, 0xa6, 0x61, 0xff, 0x8f, 0x87, 0x7d, 0xff, 0x02, 0x07, 0x53, 0xff, 0x00, 0x08, 0x3b, 0xff, 0x41, 0x5a, 0x8d, 0xff, 0x39, 0x55, 0x74, 0xff, 0x68, 0x7c, 0xa6, 0xff, 0x7f, 0x98, 0xcc, 0xff, 0x5b, 0x7a, 0xae, 0xff, 0x3d, 0x56, 0x91, 0xff, 0x1b, 0x33, 0x6a, 0xff, 0x21, 0x3b, 0x68, 0xff, 0x3a, 0x54, 0x85, 0xff, 0x45, 0x5e, 0x95, 0xff, 0x44, 0x5a, 0x90, 0xff, 0x41, 0x53, 0x83, 0xff, 0x40, 0x4f, 0x7c, 0xff, 0x40, 0x4e, 0x7b, 0xff, 0x40, 0x4c, 0x80, 0xff, 0x4d, 0x5b, 0x8f, 0xff, 0x3c, 0x4b, 0x7a, 0xff, 0x3f, 0x53, 0x86, 0xff, 0x49, 0x6d, 0xb1, 0xff, 0x43, 0x6e, 0xba, 0xff, 0x5e, 0x87, 0xd2, 0xff, 0x84, 0xa6, 0xe7, 0xff, 0x88, 0xad, 0xed, 0xff, 0x6a, 0x92, 0xdd, 0xff, 0x48, 0x71, 0xc3, 0xff, 0x3e, 0x69, 0xb2, 0xff, 0x46, 0x6a, 0xae, 0xff, 0x44, 0x60, 0xa3, 0xff, 0x39, 0x50, 0x88, 0xff, 0x3f, 0x56, 0x8f, 0xff, 0x2d, 0x45, 0x81, 0xff, 0x34, 0x4c, 0x81, 0xff, 0x42, 0x57, 0x87, 0xff, 0x4c, 0x5e, 0x91, 0xff, 0x53, 0x67, 0x9e, 0xff, 0x4e, 0x63, 0x9f, 0xff, 0x44, 0x5d, 0x9a, 0xff, 0x4b, 0x66, 0xa1, 0xff, 0x55, 0x6d, 0xa7, 0xff, 0x45, 0x5f, 0x97, 0xff, 0x3c, 0x5c, 0x95, 0xff, 0x45, 0x6a, 0xa4, 0xff, 0x4e, 0x6f, 0xa8, 0xff, 0x49, 0x65, 0x98, 0xff, 0x47, 0x5f, 0x8b, 0xff, 0x4f, 0x63, 0x91, 0xff, 0x56, 0x64, 0x87, 0xff, 0x45, 0x51, 0x64, 0xff, 0x2e, 0x41, 0x5b, 0xff, 0x25, 0x38, 0x60, 0xff, 0x11, 0x25, 0x4f, 0xff, 0x20, 0x43, 0x68, 0xff, 0x3c, 0x4e, 0x81, 0xff, 0x05, 0x10, 0x51, 0xff, 0x24, 0x35, 0x57, 0xff, 0xb8, 0xa4, 0x6c, 0xff, 0xc3, 0xa9, 0x66, 0xff, 0xb8, 0xa3, 0x65, 0xff, 0xbc, 0x9f, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xf0,
+    0xb3, 0x98, 0x5f, 0xf3, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb7, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x64, 0xff, 0xb7, 0xa0, 0x64, 0xff, 0xc5, 0xa8, 0x5f, 0xff, 0x97, 0x8f, 0x8a, 0xff, 0x09, 0x20, 0x72, 0xff, 0x07, 0x16, 0x4f, 0xff, 0x30, 0x4b, 0x80, 0xff, 0x32, 0x48, 0x5f, 0xff, 0x71, 0x81, 0xa5, 0xff, 0x85, 0x99, 0xc9, 0xff, 0x61, 0x7f, 0xb4, 0xff, 0x4b, 0x69, 0xaa, 0xff, 0x56, 0x76, 0xb7, 0xff, 0x66, 0x8e, 0xcc, 0xff, 0x5d, 0x86, 0xc7, 0xff, 0x58, 0x78, 0xb7, 0xff, 0x54, 0x6f, 0xae, 0xff, 0x4e, 0x65, 0xa5, 0xff, 0x44, 0x5a, 0x95, 0xff, 0x33, 0x47, 0x83, 0xff, 0x29, 0x39, 0x7f, 0xff, 0x23, 0x34, 0x78, 0xff, 0x34, 0x48, 0x85, 0xff, 0x4b, 0x6b, 0xad, 0xff, 0x4c, 0x79, 0xc9, 0xff, 0x4f, 0x7f, 0xd3, 0xff, 0x60, 0x93, 0xdd, 0xff, 0x7f, 0xa9, 0xe8, 0xff, 0x85, 0xa9, 0xe9, 0xff, 0x74, 0x97, 0xdf, 0xff, 0x58, 0x80, 0xd2, 0xff, 0x50, 0x7f, 0xcd, 0xff, 0x54, 0x7e, 0xca, 0xff, 0x4e, 0x72, 0xbe, 0xff, 0x43, 0x62, 0xa1, 0xff, 0x2c, 0x40, 0x7d, 0xff, 0x22, 0x2a, 0x6c, 0xff, 0x1b, 0x26, 0x61, 0xff, 0x19, 0x24, 0x5c, 0xff, 0x1a, 0x2c, 0x63, 0xff, 0x1e, 0x34, 0x68, 0xff, 0x24, 0x3a, 0x6e, 0xff, 0x36, 0x4c, 0x86, 0xff, 0x43, 0x5d, 0x9f, 0xff, 0x54, 0x73, 0xbb, 0xff, 0x61, 0x87, 0xce, 0xff, 0x57, 0x7f, 0xc2, 0xff, 0x4b, 0x75, 0xb6, 0xff, 0x52, 0x74, 0xae, 0xff, 0x56, 0x70, 0xa3, 0xff, 0x4b, 0x64, 0x93, 0xff, 0x4c, 0x5e, 0x8b, 0xff, 0x51, 0x5f, 0x82, 0xff, 0x49, 0x5c, 0x76, 0xff, 0x26, 0x3f, 0x61, 0xff, 0x12, 0x22, 0x43, 0xff, 0x25, 0x34, 0x53, 0xff, 0x2c, 0x50, 0x7b, 0xff, 0x3c, 0x59, 0x92, 0xff, 0x28, 0x47, 0x83, 0xff, 0x38, 0x48, 0x6b, 0xff, 0xc2, 0xa1, 0x6c, 0xff, 0xc5, 0xa7, 0x64, 0xff, 0xb5, 0xa2, 0x65, 0xff, 0xbd, 0xa0, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xba, 0x9f, 0x66, 0xf3,
+    0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9b, 0x63, 0xff, 0xb8, 0x9c, 0x64, 0xff, 0xb5, 0x9c, 0x60, 0xff, 0xc1, 0xa5, 0x5a, 0xff, 0x9a, 0x91, 0x79, 0xff, 0x11, 0x2f, 0x74, 0xff, 0x1e, 0x40, 0x7c, 0xff, 0x44, 0x5f, 0x93, 0xff, 0x25, 0x37, 0x5c, 0xff, 0x62, 0x6f, 0x8b, 0xff, 0x8a, 0x9f, 0xc3, 0xff, 0x61, 0x82, 0xb2, 0xff, 0x54, 0x7a, 0xbc, 0xff, 0x5f, 0x89, 0xd0, 0xff, 0x60, 0x88, 0xce, 0xff, 0x55, 0x75, 0xb9, 0xff, 0x44, 0x5f, 0x9a, 0xff, 0x2e, 0x42, 0x77, 0xff, 0x22, 0x31, 0x63, 0xff, 0x15, 0x25, 0x56, 0xff, 0x10, 0x1e, 0x4f, 0xff, 0x15, 0x20, 0x5b, 0xff, 0x2d, 0x41, 0x82, 0xff, 0x51, 0x6f, 0xb4, 0xff, 0x59, 0x85, 0xd2, 0xff, 0x59, 0x89, 0xde, 0xff, 0x60, 0x91, 0xe4, 0xff, 0x6c, 0x9c, 0xe4, 0xff, 0x7f, 0xaa, 0xe8, 0xff, 0x86, 0xac, 0xeb, 0xff, 0x76, 0x9d, 0xe3, 0xff, 0x66, 0x93, 0xdf, 0xff, 0x68, 0x94, 0xe1, 0xff, 0x5e, 0x8f, 0xdf, 0xff, 0x53, 0x86, 0xd9, 0xff, 0x54, 0x81, 0xd1, 0xff, 0x55, 0x76, 0xc3, 0xff, 0x40, 0x52, 0x99, 0xff, 0x24, 0x33, 0x72, 0xff, 0x1a, 0x25, 0x5c, 0xff, 0x1b, 0x27, 0x5d, 0xff, 0x19, 0x2c, 0x62, 0xff, 0x20, 0x38, 0x6e, 0xff, 0x40, 0x59, 0x97, 0xff, 0x59, 0x7a, 0xbb, 0xff, 0x61, 0x8a, 0xce, 0xff, 0x5d, 0x86, 0xcd, 0xff, 0x5c, 0x82, 0xc5, 0xff, 0x55, 0x78, 0xb6, 0xff, 0x51, 0x70, 0xaa, 0xff, 0x58, 0x73, 0xa6, 0xff, 0x57, 0x6d, 0x99, 0xff, 0x4e, 0x60, 0x88, 0xff, 0x4e, 0x5b, 0x7b, 0xff, 0x4f, 0x5e, 0x79, 0xff, 0x26, 0x39, 0x57, 0xff, 0x00, 0x03, 0x1e, 0xff, 0x02, 0x04, 0x1f, 0xff, 0x0c, 0x21, 0x49, 0xff, 0x23, 0x3e, 0x77, 0xff, 0x2d, 0x50, 0x91, 0xff, 0x59, 0x63, 0x7d, 0xff, 0xc1, 0xa0, 0x6a, 0xff, 0xc4, 0xa4, 0x60, 0xff, 0xb6, 0xa2, 0x64, 0xff, 0xba, 0xa0, 0x68, 0xff, 0xbc, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff,
+    0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb9, 0x9c, 0x62, 0xff, 0xb6, 0x9c, 0x65, 0xff, 0xbc, 0xa0, 0x5e, 0xff, 0xaa, 0x98, 0x6a, 0xff, 0x4a, 0x5d, 0x8c, 0xff, 0x2d, 0x51, 0x91, 0xff, 0x1d, 0x33, 0x5e, 0xff, 0x04, 0x09, 0x29, 0xff, 0x49, 0x52, 0x6a, 0xff, 0x8b, 0xa8, 0xcb, 0xff, 0x65, 0x89, 0xba, 0xff, 0x51, 0x79, 0xb7, 0xff, 0x51, 0x7e, 0xc4, 0xff, 0x60, 0x89, 0xd3, 0xff, 0x63, 0x89, 0xd7, 0xff, 0x55, 0x76, 0xc3, 0xff, 0x44, 0x5f, 0xa6, 0xff, 0x3b, 0x52, 0x91, 0xff, 0x38, 0x50, 0x90, 0xff, 0x3e, 0x56, 0x97, 0xff, 0x4f, 0x67, 0xae, 0xff, 0x5e, 0x82, 0xce, 0xff, 0x5c, 0x8c, 0xdc, 0xff, 0x5d, 0x93, 0xe7, 0xff, 0x61, 0x93, 0xeb, 0xff, 0x64, 0x96, 0xea, 0xff, 0x72, 0xa1, 0xee, 0xff, 0x7c, 0xab, 0xef, 0xff, 0x83, 0xaf, 0xf5, 0xff, 0x79, 0xa6, 0xee, 0xff, 0x6d, 0x9c, 0xe2, 0xff, 0x71, 0x9c, 0xe6, 0xff, 0x69, 0x99, 0xe8, 0xff, 0x5d, 0x92, 0xe2, 0xff, 0x5d, 0x8d, 0xe0, 0xff, 0x62, 0x91, 0xe3, 0xff, 0x61, 0x8f, 0xda, 0xff, 0x5c, 0x83, 0xc5, 0xff, 0x58, 0x77, 0xb4, 0xff, 0x57, 0x74, 0xb7, 0xff, 0x53, 0x76, 0xbc, 0xff, 0x55, 0x7d, 0xc6, 0xff, 0x61, 0x90, 0xda, 0xff, 0x6d, 0x9c, 0xe5, 0xff, 0x67, 0x94, 0xdc, 0xff, 0x55, 0x7f, 0xc7, 0xff, 0x55, 0x7a, 0xbe, 0xff, 0x54, 0x74, 0xb4, 0xff, 0x4f, 0x6d, 0xa8, 0xff, 0x51, 0x6d, 0xa0, 0xff, 0x56, 0x6a, 0x94, 0xff, 0x4f, 0x5f, 0x85, 0xff, 0x4f, 0x5a, 0x79, 0xff, 0x57, 0x62, 0x7e, 0xff, 0x27, 0x37, 0x55, 0xff, 0x00, 0x00, 0x1c, 0xff, 0x00, 0x00, 0x23, 0xff, 0x00, 0x0a, 0x36, 0xff, 0x1f, 0x38, 0x6e, 0xff, 0x27, 0x4b, 0x90, 0xff, 0x63, 0x67, 0x79, 0xff, 0xbf, 0xa3, 0x66, 0xff, 0xc1, 0xa4, 0x62, 0xff, 0xb9, 0xa1, 0x64, 0xff, 0xb9, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff,
+    0xb3, 0x98, 0x5f, 0xf3, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9b, 0x64, 0xff, 0xb9, 0x9d, 0x5f, 0xff, 0xb0, 0x9d, 0x65, 0xff, 0xb8, 0x9e, 0x64, 0xff, 0xbf, 0xa1, 0x5d, 0xff, 0x6d, 0x79, 0x8d, 0xff, 0x2f, 0x4e, 0x96, 0xff, 0x09, 0x20, 0x57, 0xff, 0x00, 0x00, 0x21, 0xff, 0x2c, 0x38, 0x5c, 0xff, 0x7e, 0x98, 0xc1, 0xff, 0x61, 0x82, 0xb2, 0xff, 0x4d, 0x76, 0xb3, 0xff, 0x57, 0x81, 0xc8, 0xff, 0x65, 0x8f, 0xd6, 0xff, 0x67, 0x96, 0xe0, 0xff, 0x70, 0x9e, 0xec, 0xff, 0x74, 0x9f, 0xef, 0xff, 0x76, 0xa0, 0xec, 0xff, 0x74, 0x9e, 0xe8, 0xff, 0x72, 0x9e, 0xe9, 0xff, 0x71, 0xa0, 0xf0, 0xff, 0x68, 0x98, 0xe7, 0xff, 0x61, 0x92, 0xe1, 0xff, 0x5b, 0x8d, 0xda, 0xff, 0x5c, 0x8a, 0xe0, 0xff, 0x6a, 0x99, 0xeb, 0xff, 0x74, 0xa5, 0xf3, 0xff, 0x79, 0xac, 0xf0, 0xff, 0x7e, 0xab, 0xf2, 0xff, 0x7b, 0xa7, 0xf1, 0xff, 0x6c, 0x9a, 0xe2, 0xff, 0x61, 0x8e, 0xd8, 0xff, 0x5b, 0x86, 0xd4, 0xff, 0x5d, 0x89, 0xd8, 0xff, 0x61, 0x92, 0xe0, 0xff, 0x61, 0x95, 0xe4, 0xff, 0x68, 0x9c, 0xe8, 0xff, 0x6d, 0x9f, 0xe9, 0xff, 0x72, 0xa1, 0xe9, 0xff, 0x76, 0xa6, 0xeb, 0xff, 0x77, 0xa5, 0xef, 0xff, 0x78, 0xa4, 0xf2, 0xff, 0x75, 0xa3, 0xf0, 0xff, 0x72, 0xa1, 0xed, 0xff, 0x61, 0x91, 0xdd, 0xff, 0x4c, 0x78, 0xc4, 0xff, 0x46, 0x6d, 0xb4, 0xff, 0x44, 0x69, 0xab, 0xff, 0x49, 0x69, 0xa5, 0xff, 0x4c, 0x67, 0x9a, 0xff, 0x4d, 0x63, 0x8e, 0xff, 0x4d, 0x5d, 0x83, 0xff, 0x4e, 0x5a, 0x79, 0xff, 0x50, 0x61, 0x83, 0xff, 0x2e, 0x49, 0x72, 0xff, 0x17, 0x2b, 0x56, 0xff, 0x1e, 0x31, 0x62, 0xff, 0x0f, 0x2a, 0x61, 0xff, 0x30, 0x4f, 0x89, 0xff, 0x37, 0x5d, 0x9f, 0xff, 0x68, 0x6e, 0x78, 0xff, 0xc2, 0xa6, 0x5d, 0xff, 0xb9, 0xa4, 0x65, 0xff, 0xbc, 0xa1, 0x64, 0xff, 0xbc, 0xa0, 0x65, 0xff, 0xbb, 0xa0, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xba, 0x9f, 0x66, 0xf3,
+    0xb2, 0x97, 0x5e, 0xf0, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x64, 0xff, 0xba, 0x9f, 0x62, 0xff, 0xb2, 0x9c, 0x64, 0xff, 0xb5, 0x9c, 0x67, 0xff, 0xc2, 0xa6, 0x56, 0xff, 0x7f, 0x7f, 0x85, 0xff, 0x3f, 0x67, 0xb8, 0xff, 0x2c, 0x4e, 0x92, 0xff, 0x0c, 0x27, 0x65, 0xff, 0x32, 0x45, 0x74, 0xff, 0x72, 0x86, 0xad, 0xff, 0x55, 0x76, 0xa7, 0xff, 0x51, 0x79, 0xb9, 0xff, 0x64, 0x8b, 0xd1, 0xff, 0x6f, 0x99, 0xdb, 0xff, 0x71, 0x9d, 0xe1, 0xff, 0x78, 0xa5, 0xec, 0xff, 0x81, 0xad, 0xf4, 0xff, 0x86, 0xaf, 0xf3, 0xff, 0x7e, 0xa7, 0xee, 0xff, 0x74, 0xa1, 0xeb, 0xff, 0x6e, 0x9e, 0xed, 0xff, 0x70, 0x99, 0xe5, 0xff, 0x5a, 0x7e, 0xc8, 0xff, 0x42, 0x69, 0xb3, 0xff, 0x52, 0x7a, 0xc7, 0xff, 0x78, 0xa2, 0xe9, 0xff, 0x92, 0xb9, 0xf8, 0xff, 0xa0, 0xc2, 0xfd, 0xff, 0x9f, 0xc1, 0xfb, 0xff, 0x86, 0xb0, 0xf1, 0xff, 0x65, 0x93, 0xdb, 0xff, 0x4d, 0x7b, 0xc8, 0xff, 0x4c, 0x73, 0xc1, 0xff, 0x4b, 0x6a, 0xb7, 0xff, 0x52, 0x75, 0xc0, 0xff, 0x6a, 0x95, 0xde, 0xff, 0x73, 0xa2, 0xed, 0xff, 0x77, 0xa3, 0xeb, 0xff, 0x81, 0xac, 0xf2, 0xff, 0x86, 0xaf, 0xf1, 0xff, 0x88, 0xb0, 0xf3, 0xff, 0x88, 0xac, 0xf1, 0xff, 0x84, 0xa8, 0xee, 0xff, 0x7d, 0xa6, 0xec, 0xff, 0x6e, 0x9d, 0xe4, 0xff, 0x5f, 0x8d, 0xd5, 0xff, 0x4a, 0x73, 0xbc, 0xff, 0x40, 0x63, 0xa7, 0xff, 0x4a, 0x67, 0xa2, 0xff, 0x4b, 0x63, 0x95, 0xff, 0x4c, 0x60, 0x89, 0xff, 0x4e, 0x5a, 0x7a, 0xff, 0x4e, 0x58, 0x74, 0xff, 0x44, 0x57, 0x7a, 0xff, 0x37, 0x52, 0x80, 0xff, 0x33, 0x4d, 0x83, 0xff, 0x3b, 0x52, 0x8d, 0xff, 0x22, 0x40, 0x7c, 0xff, 0x3c, 0x64, 0xa1, 0xff, 0x45, 0x6f, 0xb5, 0xff, 0x7a, 0x78, 0x7f, 0xff, 0xc5, 0xa9, 0x59, 0xff, 0xb8, 0xa3, 0x62, 0xff, 0xba, 0xa2, 0x64, 0xff, 0xbc, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xf0,
+    0xb3, 0x99, 0x60, 0xe7, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb5, 0x9d, 0x65, 0xff, 0xba, 0xa4, 0x57, 0xff, 0x98, 0x8c, 0x83, 0xff, 0x57, 0x82, 0xcc, 0xff, 0x3f, 0x69, 0xae, 0xff, 0x1e, 0x3d, 0x80, 0xff, 0x4b, 0x5d, 0x8e, 0xff, 0x6e, 0x7e, 0xa8, 0xff, 0x52, 0x74, 0xa7, 0xff, 0x5c, 0x7e, 0xc0, 0xff, 0x6d, 0x92, 0xd6, 0xff, 0x71, 0x9e, 0xe0, 0xff, 0x78, 0xa5, 0xea, 0xff, 0x7c, 0xa9, 0xed, 0xff, 0x80, 0xac, 0xed, 0xff, 0x83, 0xaf, 0xed, 0xff, 0x7c, 0xa6, 0xe9, 0xff, 0x75, 0xa0, 0xe8, 0xff, 0x6c, 0x97, 0xe2, 0xff, 0x52, 0x79, 0xc2, 0xff, 0x52, 0x75, 0xc0, 0xff, 0x5f, 0x8b, 0xdb, 0xff, 0x5d, 0x8d, 0xda, 0xff, 0x6d, 0x9e, 0xe7, 0xff, 0x89, 0xb4, 0xf3, 0xff, 0xa0, 0xbf, 0xfe, 0xff, 0x94, 0xb9, 0xf7, 0xff, 0x79, 0xa5, 0xe7, 0xff, 0x65, 0x91, 0xdd, 0xff, 0x59, 0x87, 0xda, 0xff, 0x6d, 0x9a, 0xeb, 0xff, 0x66, 0x8b, 0xdc, 0xff, 0x43, 0x63, 0xb3, 0xff, 0x50, 0x75, 0xbe, 0xff, 0x6d, 0x96, 0xe1, 0xff, 0x78, 0xa1, 0xe6, 0xff, 0x80, 0xa9, 0xec, 0xff, 0x8a, 0xaf, 0xf4, 0xff, 0x8c, 0xb2, 0xf2, 0xff, 0x8a, 0xb2, 0xee, 0xff, 0x83, 0xae, 0xee, 0xff, 0x7d, 0xa7, 0xec, 0xff, 0x7b, 0xa1, 0xe9, 0xff, 0x6c, 0x96, 0xdc, 0xff, 0x55, 0x81, 0xc9, 0xff, 0x4d, 0x6c, 0xae, 0xff, 0x49, 0x63, 0x9b, 0xff, 0x46, 0x5c, 0x8c, 0xff, 0x4c, 0x5d, 0x82, 0xff, 0x51, 0x5b, 0x74, 0xff, 0x52, 0x5c, 0x78, 0xff, 0x42, 0x53, 0x77, 0xff, 0x28, 0x41, 0x6e, 0xff, 0x2e, 0x4c, 0x8a, 0xff, 0x3e, 0x57, 0x98, 0xff, 0x2b, 0x47, 0x82, 0xff, 0x53, 0x7d, 0xbe, 0xff, 0x3d, 0x68, 0xb2, 0xff, 0x87, 0x7f, 0x7f, 0xff, 0xc9, 0xab, 0x5c, 0xff, 0xbc, 0xa3, 0x61, 0xff, 0xb6, 0xa3, 0x63, 0xff, 0xba, 0x9f, 0x6a, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0x9f, 0x67, 0xe6,
+    0xb4, 0x99, 0x5f, 0xd3, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x65, 0xff, 0xb8, 0x9f, 0x63, 0xff, 0xb5, 0xa0, 0x60, 0xff, 0xba, 0xa2, 0x5b, 0xff, 0x9c, 0x94, 0x77, 0xff, 0x60, 0x88, 0xc9, 0xff, 0x53, 0x7d, 0xc5, 0xff, 0x1f, 0x39, 0x81, 0xff, 0x3e, 0x53, 0x93, 0xff, 0x63, 0x79, 0xa5, 0xff, 0x52, 0x70, 0x9b, 0xff, 0x5a, 0x7a, 0xba, 0xff, 0x65, 0x8e, 0xd6, 0xff, 0x68, 0x98, 0xdf, 0xff, 0x70, 0x9f, 0xe8, 0xff, 0x75, 0xa3, 0xec, 0xff, 0x77, 0xa7, 0xf0, 0xff, 0x76, 0xa7, 0xee, 0xff, 0x74, 0xa2, 0xe7, 0xff, 0x6b, 0x94, 0xd8, 0xff, 0x4c, 0x71, 0xb3, 0xff, 0x3b, 0x67, 0xae, 0xff, 0x72, 0xa5, 0xf3, 0xff, 0x94, 0xc6, 0xff, 0xff, 0x6e, 0x9e, 0xee, 0xff, 0x4f, 0x7f, 0xcf, 0xff, 0x56, 0x82, 0xd3, 0xff, 0x63, 0x87, 0xd8, 0xff, 0x57, 0x80, 0xd1, 0xff, 0x4f, 0x75, 0xc5, 0xff, 0x51, 0x74, 0xc6, 0xff, 0x6f, 0x9a, 0xef, 0xff, 0x93, 0xbf, 0xff, 0xff, 0x7e, 0xb0, 0xff, 0xff, 0x55, 0x87, 0xd1, 0xff, 0x3c, 0x59, 0x9f, 0xff, 0x50, 0x64, 0xac, 0xff, 0x62, 0x87, 0xce, 0xff, 0x6d, 0x9a, 0xe3, 0xff, 0x79, 0xa3, 0xec, 0xff, 0x80, 0xa9, 0xeb, 0xff, 0x82, 0xad, 0xed, 0xff, 0x7f, 0xac, 0xf1, 0xff, 0x76, 0xa2, 0xeb, 0xff, 0x6e, 0x97, 0xe3, 0xff, 0x62, 0x8b, 0xd9, 0xff, 0x56, 0x81, 0xcc, 0xff, 0x52, 0x76, 0xb2, 0xff, 0x45, 0x63, 0x96, 0xff, 0x40, 0x5a, 0x86, 0xff, 0x48, 0x5c, 0x7b, 0xff, 0x4d, 0x5a, 0x74, 0xff, 0x4e, 0x5b, 0x7b, 0xff, 0x3c, 0x50, 0x76, 0xff, 0x13, 0x31, 0x5d, 0xff, 0x3a, 0x5a, 0x97, 0xff, 0x4b, 0x67, 0xac, 0xff, 0x4a, 0x68, 0xa6, 0xff, 0x44, 0x65, 0xa8, 0xff, 0x2d, 0x50, 0x9b, 0xff, 0x96, 0x91, 0x84, 0xff, 0xc7, 0xa7, 0x5e, 0xff, 0xbc, 0xa1, 0x66, 0xff, 0xb7, 0xa4, 0x61, 0xff, 0xba, 0x9f, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0x9f, 0x66, 0xd3,
+    0xb3, 0x99, 0x60, 0xbe, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xba, 0x9d, 0x65, 0xff, 0xb7, 0x9e, 0x60, 0xff, 0xb1, 0x9f, 0x5f, 0xff, 0xbc, 0x9e, 0x5d, 0xff, 0xaa, 0xa1, 0x73, 0xff, 0x52, 0x7c, 0xbc, 0xff, 0x4e, 0x74, 0xbd, 0xff, 0x55, 0x71, 0xb8, 0xff, 0x4a, 0x67, 0xb0, 0xff, 0x51, 0x6b, 0x9b, 0xff, 0x55, 0x6c, 0x93, 0xff, 0x5a, 0x7a, 0xb5, 0xff, 0x5c, 0x88, 0xd0, 0xff, 0x5d, 0x8e, 0xd9, 0xff, 0x67, 0x97, 0xe2, 0xff, 0x6b, 0x9c, 0xe5, 0xff, 0x6d, 0x9d, 0xe8, 0xff, 0x66, 0x92, 0xe3, 0xff, 0x62, 0x86, 0xd5, 0xff, 0x53, 0x6c, 0xb3, 0xff, 0x32, 0x45, 0x89, 0xff, 0x48, 0x68, 0xb2, 0xff, 0x67, 0x8a, 0xd4, 0xff, 0x5e, 0x75, 0xb3, 0xff, 0x5c, 0x6e, 0xae, 0xff, 0x49, 0x5f, 0xa9, 0xff, 0x3e, 0x59, 0xa6, 0xff, 0x3f, 0x55, 0xa1, 0xff, 0x3a, 0x53, 0x9f, 0xff, 0x3d, 0x58, 0xa0, 0xff, 0x46, 0x5f, 0x9f, 0xff, 0x43, 0x5a, 0x8e, 0xff, 0x3a, 0x4e, 0x81, 0xff, 0x44, 0x66, 0xaa, 0xff, 0x48, 0x73, 0xbb, 0xff, 0x2f, 0x43, 0x82, 0xff, 0x26, 0x30, 0x6c, 0xff, 0x3a, 0x53, 0x96, 0xff, 0x56, 0x7c, 0xc1, 0xff, 0x69, 0x92, 0xdb, 0xff, 0x6f, 0x9a, 0xe4, 0xff, 0x72, 0x9f, 0xe6, 0xff, 0x6c, 0x9c, 0xe4, 0xff, 0x66, 0x95, 0xe0, 0xff, 0x5f, 0x8e, 0xdb, 0xff, 0x59, 0x84, 0xd2, 0xff, 0x52, 0x7a, 0xc5, 0xff, 0x53, 0x74, 0xaf, 0xff, 0x4e, 0x69, 0x9a, 0xff, 0x44, 0x5d, 0x87, 0xff, 0x4b, 0x5f, 0x7e, 0xff, 0x4b, 0x59, 0x74, 0xff, 0x48, 0x58, 0x79, 0xff, 0x2b, 0x41, 0x6c, 0xff, 0x29, 0x47, 0x7f, 0xff, 0x5b, 0x7c, 0xbe, 0xff, 0x71, 0x8e, 0xcf, 0xff, 0x55, 0x6d, 0xa7, 0xff, 0x2a, 0x44, 0x8c, 0xff, 0x43, 0x66, 0xa8, 0xff, 0xa0, 0x96, 0x76, 0xff, 0xc7, 0xa2, 0x61, 0xff, 0xb9, 0xa2, 0x64, 0xff, 0xb8, 0xa3, 0x62, 0xff, 0xbb, 0x9f, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xba, 0x9f, 0x67, 0xbe,
+    0xb2, 0x97, 0x5e, 0xaa, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb3, 0x98, 0x5f, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x65, 0xff, 0xba, 0x9e, 0x65, 0xff, 0xb5, 0x9e, 0x60, 0xff, 0xae, 0x9e, 0x62, 0xff, 0xc2, 0x9d, 0x62, 0xff, 0xb1, 0xa2, 0x6c, 0xff, 0x5d, 0x80, 0xb5, 0xff, 0x49, 0x69, 0xae, 0xff, 0x7a, 0xa0, 0xdc, 0xff, 0x67, 0x91, 0xd6, 0xff, 0x55, 0x70, 0xa3, 0xff, 0x5a, 0x69, 0x91, 0xff, 0x55, 0x73, 0xa8, 0xff, 0x50, 0x7d, 0xc0, 0xff, 0x57, 0x80, 0xcc, 0xff, 0x5e, 0x8e, 0xd6, 0xff, 0x60, 0x92, 0xda, 0xff, 0x61, 0x8d, 0xd5, 0xff, 0x56, 0x7e, 0xca, 0xff, 0x4f, 0x68, 0xb8, 0xff, 0x3a, 0x48, 0x87, 0xff, 0x2b, 0x39, 0x6d, 0xff, 0x33, 0x4a, 0x7e, 0xff, 0x2d, 0x37, 0x5f, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x0d, 0x07, 0x19, 0xff, 0x20, 0x28, 0x49, 0xff, 0x2c, 0x38, 0x5c, 0xff, 0x34, 0x3f, 0x5f, 0xff, 0x3c, 0x48, 0x64, 0xff, 0x32, 0x3f, 0x60, 0xff, 0x16, 0x1d, 0x3a, 0xff, 0x02, 0x00, 0x0a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1c, 0x20, 0x42, 0xff, 0x2c, 0x41, 0x7a, 0xff, 0x25, 0x38, 0x67, 0xff, 0x38, 0x47, 0x7a, 0xff, 0x2e, 0x3d, 0x76, 0xff, 0x3c, 0x52, 0x89, 0xff, 0x58, 0x75, 0xba, 0xff, 0x5a, 0x84, 0xd3, 0xff, 0x5e, 0x8a, 0xd8, 0xff, 0x59, 0x88, 0xd2, 0xff, 0x57, 0x86, 0xd0, 0xff, 0x52, 0x81, 0xcc, 0xff, 0x4b, 0x75, 0xbe, 0xff, 0x4b, 0x6c, 0xae, 0xff, 0x4f, 0x68, 0xa5, 0xff, 0x4d, 0x64, 0x97, 0xff, 0x4b, 0x60, 0x8a, 0xff, 0x4b, 0x5e, 0x80, 0xff, 0x4b, 0x5a, 0x76, 0xff, 0x42, 0x54, 0x73, 0xff, 0x2c, 0x46, 0x79, 0xff, 0x3e, 0x5a, 0xa0, 0xff, 0x4f, 0x6f, 0xb4, 0xff, 0x6c, 0x8f, 0xcb, 0xff, 0x6c, 0x88, 0xca, 0xff, 0x54, 0x77, 0xcc, 0xff, 0x5e, 0x7c, 0x97, 0xff, 0xb6, 0x9a, 0x5f, 0xff, 0xc6, 0xa2, 0x67, 0xff, 0xb3, 0xa6, 0x5e, 0xff, 0xbb, 0xa0, 0x66, 0xff, 0xbc, 0x9f, 0x69, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xba, 0x9f, 0x66, 0xab,
+    0xb3, 0x98, 0x5f, 0x8b, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x66, 0xff, 0xb6, 0xa0, 0x63, 0xff, 0xb8, 0xa1, 0x60, 0xff, 0xba, 0xa1, 0x61, 0xff, 0xb3, 0x9b, 0x5a, 0xff, 0x89, 0x92, 0xa0, 0xff, 0x7e, 0xa5, 0xe9, 0xff, 0x78, 0x9f, 0xe0, 0xff, 0x54, 0x80, 0xc8, 0xff, 0x59, 0x77, 0xae, 0xff, 0x60, 0x6f, 0x97, 0xff, 0x53, 0x6e, 0xa0, 0xff, 0x4b, 0x6e, 0xb0, 0xff, 0x54, 0x74, 0xbe, 0xff, 0x59, 0x81, 0xc7, 0xff, 0x51, 0x7d, 0xc3, 0xff, 0x52, 0x74, 0xba, 0xff, 0x50, 0x6b, 0xa8, 0xff, 0x39, 0x4e, 0x84, 0xff, 0x25, 0x30, 0x64, 0xff, 0x3e, 0x4e, 0x85, 0xff, 0x45, 0x5f, 0x94, 0xff, 0x18, 0x24, 0x4f, 0xff, 0x00, 0x04, 0x23, 0xff, 0x02, 0x12, 0x2a, 0xff, 0x06, 0x13, 0x34, 0xff, 0x0d, 0x0f, 0x32, 0xff, 0x0e, 0x0f, 0x2d, 0xff, 0x09, 0x0c, 0x28, 0xff, 0x05, 0x05, 0x1d, 0xff, 0x06, 0x06, 0x21, 0xff, 0x13, 0x19, 0x3b, 0xff, 0x14, 0x19, 0x3b, 0xff, 0x06, 0x0d, 0x32, 0xff, 0x0a, 0x16, 0x42, 0xff, 0x41, 0x50, 0x80, 0xff, 0x56, 0x72, 0xaf, 0xff, 0x39, 0x57, 0x93, 0xff, 0x2d, 0x3e, 0x73, 0xff, 0x41, 0x54, 0x91, 0xff, 0x4f, 0x6e, 0xb6, 0xff, 0x53, 0x74, 0xbb, 0xff, 0x52, 0x75, 0xbb, 0xff, 0x51, 0x75, 0xbb, 0xff, 0x4c, 0x70, 0xb6, 0xff, 0x49, 0x68, 0xae, 0xff, 0x43, 0x60, 0x9e, 0xff, 0x40, 0x5e, 0x92, 0xff, 0x46, 0x5e, 0x8d, 0xff, 0x50, 0x62, 0x89, 0xff, 0x4f, 0x5e, 0x7b, 0xff, 0x4a, 0x59, 0x75, 0xff, 0x28, 0x3d, 0x60, 0xff, 0x35, 0x50, 0x82, 0xff, 0x4a, 0x64, 0xa5, 0xff, 0x51, 0x6f, 0xb1, 0xff, 0x5a, 0x82, 0xc7, 0xff, 0x51, 0x7f, 0xd7, 0xff, 0x4d, 0x6c, 0xae, 0xff, 0x91, 0x8c, 0x6a, 0xff, 0xc8, 0xa8, 0x60, 0xff, 0xb6, 0xa3, 0x68, 0xff, 0xb7, 0xa2, 0x64, 0xff, 0xbb, 0xa1, 0x64, 0xff, 0xba, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0x9f, 0x66, 0x8b,
+    0xb5, 0x9a, 0x61, 0x6b, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb6, 0x9e, 0x66, 0xff, 0xb3, 0x9e, 0x63, 0xff, 0xbb, 0xa0, 0x5f, 0xff, 0xb1, 0xa1, 0x5f, 0xff, 0xbf, 0x9f, 0x58, 0xff, 0xa8, 0x98, 0x84, 0xff, 0x66, 0x92, 0xdb, 0xff, 0x56, 0x8a, 0xdb, 0xff, 0x54, 0x82, 0xc6, 0xff, 0x61, 0x7d, 0xaf, 0xff, 0x5e, 0x70, 0x94, 0xff, 0x4a, 0x64, 0x93, 0xff, 0x42, 0x5d, 0x9e, 0xff, 0x4a, 0x63, 0xab, 0xff, 0x4c, 0x6d, 0xb1, 0xff, 0x46, 0x68, 0xad, 0xff, 0x47, 0x60, 0xa5, 0xff, 0x3b, 0x50, 0x89, 0xff, 0x1e, 0x34, 0x61, 0xff, 0x33, 0x47, 0x7e, 0xff, 0x4a, 0x6b, 0xb0, 0xff, 0x4c, 0x74, 0xb5, 0xff, 0x3f, 0x5a, 0x93, 0xff, 0x2b, 0x46, 0x7f, 0xff, 0x2a, 0x50, 0x83, 0xff, 0x39, 0x56, 0x8d, 0xff, 0x3b, 0x4d, 0x86, 0xff, 0x35, 0x48, 0x7c, 0xff, 0x27, 0x3c, 0x6d, 0xff, 0x2b, 0x41, 0x71, 0xff, 0x39, 0x53, 0x84, 0xff, 0x30, 0x4c, 0x81, 0xff, 0x2d, 0x48, 0x80, 0xff, 0x28, 0x3f, 0x76, 0xff, 0x33, 0x49, 0x7e, 0xff, 0x51, 0x68, 0xa3, 0xff, 0x4f, 0x71, 0xb0, 0xff, 0x49, 0x70, 0xac, 0xff, 0x3d, 0x4f, 0x82, 0xff, 0x34, 0x40, 0x76, 0xff, 0x3e, 0x55, 0x94, 0xff, 0x49, 0x63, 0xa1, 0xff, 0x4a, 0x64, 0xa4, 0xff, 0x48, 0x63, 0xa4, 0xff, 0x44, 0x5e, 0xa0, 0xff, 0x42, 0x59, 0x99, 0xff, 0x3c, 0x54, 0x8d, 0xff, 0x3a, 0x54, 0x84, 0xff, 0x41, 0x56, 0x83, 0xff, 0x48, 0x5a, 0x83, 0xff, 0x52, 0x61, 0x80, 0xff, 0x50, 0x5d, 0x78, 0xff, 0x13, 0x23, 0x45, 0xff, 0x1f, 0x38, 0x77, 0xff, 0x45, 0x6c, 0xbe, 0xff, 0x46, 0x73, 0xc1, 0xff, 0x37, 0x5b, 0xa7, 0xff, 0x2a, 0x43, 0x87, 0xff, 0x76, 0x74, 0x70, 0xff, 0xca, 0xad, 0x5f, 0xff, 0xb8, 0xa2, 0x62, 0xff, 0xac, 0xa1, 0x6a, 0xff, 0xbb, 0xa0, 0x68, 0xff, 0xbb, 0xa2, 0x64, 0xff, 0xba, 0xa1, 0x66, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xb9, 0x9f, 0x66, 0x6b,
+    0xb4, 0x99, 0x5f, 0x4b, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9e, 0x65, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb5, 0x9f, 0x66, 0xff, 0xb4, 0xa0, 0x65, 0xff, 0xbc, 0xa4, 0x5e, 0xff, 0xbf, 0xa4, 0x66, 0xff, 0x64, 0x73, 0x87, 0xff, 0x2e, 0x5b, 0xb0, 0xff, 0x4f, 0x76, 0xcc, 0xff, 0x61, 0x7a, 0xc3, 0xff, 0x53, 0x6a, 0x8f, 0xff, 0x43, 0x5a, 0x82, 0xff, 0x39, 0x4f, 0x86, 0xff, 0x3e, 0x54, 0x92, 0xff, 0x45, 0x5c, 0x9a, 0xff, 0x43, 0x5b, 0x9a, 0xff, 0x44, 0x57, 0x92, 0xff, 0x2e, 0x3d, 0x71, 0xff, 0x22, 0x3b, 0x71, 0xff, 0x45, 0x66, 0x9e, 0xff, 0x5b, 0x7d, 0xb8, 0xff, 0x51, 0x72, 0xac, 0xff, 0x50, 0x70, 0xa8, 0xff, 0x4b, 0x6a, 0xa0, 0xff, 0x46, 0x63, 0x9d, 0xff, 0x49, 0x65, 0xa2, 0xff, 0x50, 0x6f, 0xab, 0xff, 0x5a, 0x7a, 0xb5, 0xff, 0x5b, 0x7b, 0xb6, 0xff, 0x50, 0x6c, 0xab, 0xff, 0x49, 0x63, 0xa2, 0xff, 0x42, 0x5e, 0x98, 0xff, 0x41, 0x5b, 0x92, 0xff, 0x4b, 0x66, 0x9c, 0xff, 0x4d, 0x6d, 0xa7, 0xff, 0x50, 0x6d, 0xaa, 0xff, 0x57, 0x70, 0xaa, 0xff, 0x4f, 0x6e, 0xa4, 0xff, 0x41, 0x5d, 0x90, 0xff, 0x2d, 0x41, 0x71, 0xff, 0x2c, 0x40, 0x70, 0xff, 0x3c, 0x51, 0x82, 0xff, 0x3a, 0x53, 0x87, 0xff, 0x3a, 0x53, 0x8b, 0xff, 0x38, 0x50, 0x8a, 0xff, 0x37, 0x4a, 0x82, 0xff, 0x36, 0x45, 0x7a, 0xff, 0x38, 0x45, 0x79, 0xff, 0x3b, 0x4c, 0x74, 0xff, 0x3b, 0x53, 0x78, 0xff, 0x3b, 0x55, 0x7d, 0xff, 0x64, 0x6a, 0x6c, 0xff, 0x82, 0x75, 0x56, 0xff, 0x40, 0x47, 0x5b, 0xff, 0x28, 0x45, 0x84, 0xff, 0x38, 0x51, 0x8c, 0xff, 0x54, 0x61, 0x6e, 0xff, 0x9a, 0x85, 0x5d, 0xff, 0xcb, 0xa8, 0x65, 0xff, 0xc5, 0xa5, 0x68, 0xff, 0xba, 0x9e, 0x66, 0xff, 0xba, 0xa0, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0x9f, 0x66, 0x4b,
+    0xb1, 0x9a, 0x5c, 0x21, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9e, 0x65, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb5, 0x9f, 0x66, 0xff, 0xb6, 0xa2, 0x67, 0xff, 0xb1, 0x9e, 0x66, 0xff, 0xbf, 0xa2, 0x5f, 0xff, 0xb7, 0x9b, 0x61, 0xff, 0x7a, 0x73, 0x6c, 0xff, 0x3a, 0x50, 0x89, 0xff, 0x34, 0x56, 0x97, 0xff, 0x4c, 0x61, 0x8c, 0xff, 0x44, 0x54, 0x7a, 0xff, 0x32, 0x45, 0x75, 0xff, 0x33, 0x47, 0x79, 0xff, 0x3c, 0x51, 0x83, 0xff, 0x3a, 0x4f, 0x82, 0xff, 0x32, 0x47, 0x77, 0xff, 0x2d, 0x42, 0x6e, 0xff, 0x37, 0x4d, 0x7e, 0xff, 0x46, 0x5f, 0x93, 0xff, 0x5b, 0x76, 0xac, 0xff, 0x61, 0x7c, 0xb5, 0xff, 0x54, 0x72, 0xac, 0xff, 0x4e, 0x6c, 0xa6, 0xff, 0x48, 0x65, 0xa2, 0xff, 0x4e, 0x6a, 0xab, 0xff, 0x57, 0x75, 0xb4, 0xff, 0x5c, 0x7c, 0xbb, 0xff, 0x5c, 0x7d, 0xbb, 0xff, 0x59, 0x75, 0xb6, 0xff, 0x51, 0x6b, 0xaa, 0xff, 0x48, 0x65, 0x9f, 0xff, 0x47, 0x63, 0x9d, 0xff, 0x4a, 0x65, 0xa0, 0xff, 0x4f, 0x6c, 0xa8, 0xff, 0x56, 0x71, 0xaa, 0xff, 0x54, 0x6c, 0xa0, 0xff, 0x49, 0x5f, 0x90, 0xff, 0x3a, 0x4e, 0x7d, 0xff, 0x2d, 0x3e, 0x6a, 0xff, 0x27, 0x37, 0x62, 0xff, 0x2c, 0x3d, 0x68, 0xff, 0x30, 0x46, 0x74, 0xff, 0x34, 0x4a, 0x7c, 0xff, 0x34, 0x49, 0x7f, 0xff, 0x33, 0x45, 0x77, 0xff, 0x30, 0x3f, 0x6e, 0xff, 0x2e, 0x3b, 0x68, 0xff, 0x2f, 0x3e, 0x6a, 0xff, 0x37, 0x49, 0x76, 0xff, 0x3c, 0x4f, 0x7d, 0xff, 0x71, 0x69, 0x64, 0xff, 0xd0, 0xb1, 0x69, 0xff, 0xba, 0x9f, 0x63, 0xff, 0x9c, 0x85, 0x5a, 0xff, 0xa5, 0x8d, 0x60, 0xff, 0xbd, 0xab, 0x63, 0xff, 0xcc, 0xb0, 0x62, 0xff, 0xbf, 0xa4, 0x68, 0xff, 0xb8, 0x9f, 0x67, 0xff, 0xb8, 0x9f, 0x65, 0xff, 0xbb, 0xa0, 0x66, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xb9, 0xa2, 0x64, 0x21,
+    0xff, 0xff, 0x00, 0x01, 0xb4, 0x98, 0x5f, 0xf2, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb4, 0x99, 0x60, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9e, 0x65, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb7, 0xa1, 0x65, 0xff, 0xb4, 0x9e, 0x68, 0xff, 0xb1, 0x9e, 0x63, 0xff, 0xbf, 0xa7, 0x5e, 0xff, 0xc6, 0xad, 0x61, 0xff, 0xad, 0x91, 0x5d, 0xff, 0x8e, 0x8a, 0x62, 0xff, 0x54, 0x61, 0x81, 0xff, 0x36, 0x45, 0x73, 0xff, 0x30, 0x41, 0x67, 0xff, 0x2f, 0x41, 0x6a, 0xff, 0x32, 0x44, 0x6d, 0xff, 0x30, 0x42, 0x6a, 0xff, 0x2b, 0x40, 0x67, 0xff, 0x36, 0x4e, 0x76, 0xff, 0x31, 0x46, 0x72, 0xff, 0x32, 0x43, 0x72, 0xff, 0x4b, 0x5f, 0x8e, 0xff, 0x5c, 0x77, 0xae, 0xff, 0x64, 0x85, 0xc2, 0xff, 0x64, 0x85, 0xc3, 0xff, 0x63, 0x82, 0xc1, 0xff, 0x5e, 0x7d, 0xbf, 0xff, 0x61, 0x81, 0xc5, 0xff, 0x6c, 0x8e, 0xd2, 0xff, 0x6c, 0x8e, 0xd3, 0xff, 0x65, 0x84, 0xc8, 0xff, 0x5d, 0x7a, 0xbd, 0xff, 0x5a, 0x79, 0xb8, 0xff, 0x5b, 0x7b, 0xbc, 0xff, 0x5d, 0x7c, 0xbe, 0xff, 0x5e, 0x78, 0xb8, 0xff, 0x4c, 0x67, 0x9f, 0xff, 0x3d, 0x59, 0x89, 0xff, 0x37, 0x4b, 0x7b, 0xff, 0x2d, 0x3c, 0x68, 0xff, 0x29, 0x36, 0x5f, 0xff, 0x26, 0x33, 0x5a, 0xff, 0x27, 0x33, 0x5a, 0xff, 0x29, 0x3b, 0x64, 0xff, 0x31, 0x42, 0x6f, 0xff, 0x34, 0x44, 0x74, 0xff, 0x31, 0x41, 0x6e, 0xff, 0x2d, 0x3d, 0x66, 0xff, 0x2f, 0x3b, 0x62, 0xff, 0x30, 0x3e, 0x67, 0xff, 0x37, 0x49, 0x70, 0xff, 0x3f, 0x4b, 0x6d, 0xff, 0x80, 0x76, 0x6c, 0xff, 0xbf, 0xaa, 0x63, 0xff, 0xc4, 0xa6, 0x66, 0xff, 0xcb, 0xab, 0x6c, 0xff, 0xc6, 0xae, 0x60, 0xff, 0xbb, 0xa4, 0x61, 0xff, 0xb6, 0x9f, 0x6c, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x64, 0xff, 0xba, 0xa3, 0x69, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xba, 0xa0, 0x67, 0xf2, 0xff, 0xff, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0xb5, 0x9a, 0x60, 0xc6, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb7, 0x9d, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb5, 0x9f, 0x62, 0xff, 0xb3, 0xa0, 0x63, 0xff, 0xb2, 0xa0, 0x62, 0xff, 0xb5, 0x9f, 0x62, 0xff, 0xca, 0xa8, 0x67, 0xff, 0xd0, 0xb2, 0x64, 0xff, 0x6c, 0x72, 0x74, 0xff, 0x2a, 0x43, 0x77, 0xff, 0x34, 0x41, 0x61, 0xff, 0x27, 0x39, 0x5f, 0xff, 0x28, 0x39, 0x60, 0xff, 0x27, 0x36, 0x60, 0xff, 0x28, 0x38, 0x65, 0xff, 0x30, 0x44, 0x6e, 0xff, 0x22, 0x33, 0x58, 0xff, 0x20, 0x30, 0x50, 0xff, 0x3f, 0x52, 0x77, 0xff, 0x54, 0x6c, 0x9d, 0xff, 0x64, 0x80, 0xbc, 0xff, 0x6a, 0x83, 0xbd, 0xff, 0x60, 0x78, 0xb2, 0xff, 0x4b, 0x62, 0xa0, 0xff, 0x40, 0x57, 0x94, 0xff, 0x51, 0x66, 0xa2, 0xff, 0x5e, 0x6e, 0xad, 0xff, 0x47, 0x58, 0x93, 0xff, 0x3d, 0x50, 0x86, 0xff, 0x49, 0x59, 0x8d, 0xff, 0x4f, 0x63, 0x96, 0xff, 0x4f, 0x64, 0x98, 0xff, 0x50, 0x61, 0x92, 0xff, 0x49, 0x5d, 0x88, 0xff, 0x3e, 0x58, 0x7e, 0xff, 0x30, 0x43, 0x69, 0xff, 0x1e, 0x2c, 0x4d, 0xff, 0x1d, 0x2c, 0x4c, 0xff, 0x1f, 0x32, 0x59, 0xff, 0x23, 0x34, 0x58, 0xff, 0x28, 0x38, 0x61, 0xff, 0x2e, 0x3f, 0x6b, 0xff, 0x30, 0x42, 0x70, 0xff, 0x2e, 0x40, 0x6b, 0xff, 0x2a, 0x3d, 0x61, 0xff, 0x2a, 0x3c, 0x65, 0xff, 0x2f, 0x40, 0x67, 0xff, 0x32, 0x49, 0x68, 0xff, 0x44, 0x4f, 0x66, 0xff, 0xa1, 0x8e, 0x64, 0xff, 0xc1, 0xaa, 0x60, 0xff, 0xba, 0xa5, 0x64, 0xff, 0xb9, 0x9f, 0x66, 0xff, 0xbc, 0x9f, 0x67, 0xff, 0xbc, 0xa2, 0x66, 0xff, 0xbb, 0xa1, 0x66, 0xff, 0xbd, 0x9f, 0x67, 0xff, 0xbf, 0xa1, 0x68, 0xff, 0xbf, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x66, 0xc4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb4, 0x9a, 0x61, 0x90, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb7, 0x9d, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb5, 0x9f, 0x66, 0xff, 0xb6, 0x9f, 0x66, 0xff, 0xb4, 0x9e, 0x66, 0xff, 0xb5, 0xa0, 0x65, 0xff, 0xb9, 0x9f, 0x63, 0xff, 0xc5, 0xad, 0x62, 0xff, 0x8e, 0x86, 0x6d, 0xff, 0x31, 0x42, 0x70, 0xff, 0x2d, 0x3e, 0x6a, 0xff, 0x28, 0x3a, 0x60, 0xff, 0x2b, 0x3e, 0x5f, 0xff, 0x29, 0x3b, 0x61, 0xff, 0x23, 0x34, 0x5b, 0xff, 0x24, 0x37, 0x59, 0xff, 0x20, 0x30, 0x4c, 0xff, 0x10, 0x20, 0x35, 0xff, 0x1c, 0x2a, 0x3b, 0xff, 0x2c, 0x31, 0x47, 0xff, 0x2f, 0x2e, 0x47, 0xff, 0x26, 0x29, 0x48, 0xff, 0x25, 0x27, 0x4a, 0xff, 0x29, 0x2a, 0x50, 0xff, 0x27, 0x2e, 0x50, 0xff, 0x28, 0x2f, 0x4f, 0xff, 0x2f, 0x32, 0x53, 0xff, 0x2b, 0x28, 0x4e, 0xff, 0x29, 0x25, 0x4c, 0xff, 0x29, 0x29, 0x4b, 0xff, 0x1d, 0x20, 0x41, 0xff, 0x17, 0x18, 0x3a, 0xff, 0x19, 0x18, 0x38, 0xff, 0x1f, 0x1d, 0x38, 0xff, 0x1d, 0x1d, 0x32, 0xff, 0x17, 0x17, 0x28, 0xff, 0x10, 0x10, 0x1e, 0xff, 0x1e, 0x26, 0x3f, 0xff, 0x2c, 0x42, 0x6b, 0xff, 0x34, 0x4d, 0x7b, 0xff, 0x37, 0x4d, 0x7c, 0xff, 0x2f, 0x43, 0x72, 0xff, 0x30, 0x43, 0x70, 0xff, 0x2e, 0x3f, 0x68, 0xff, 0x2a, 0x3d, 0x5e, 0xff, 0x2a, 0x3d, 0x64, 0xff, 0x31, 0x3f, 0x69, 0xff, 0x31, 0x40, 0x66, 0xff, 0x55, 0x5a, 0x64, 0xff, 0xb9, 0x9f, 0x66, 0xff, 0xc7, 0xa9, 0x66, 0xff, 0xbc, 0xa3, 0x64, 0xff, 0xbb, 0xa1, 0x64, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0x9f, 0x66, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb3, 0x99, 0x5f, 0x58, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb7, 0x9d, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb7, 0x9d, 0x65, 0xff, 0xbf, 0x9d, 0x67, 0xff, 0xbe, 0xa4, 0x65, 0xff, 0xb7, 0x9a, 0x68, 0xff, 0x49, 0x51, 0x68, 0xff, 0x17, 0x36, 0x64, 0xff, 0x29, 0x3c, 0x60, 0xff, 0x2c, 0x3d, 0x63, 0xff, 0x31, 0x42, 0x6d, 0xff, 0x32, 0x41, 0x6c, 0xff, 0x2b, 0x38, 0x5a, 0xff, 0x17, 0x23, 0x40, 0xff, 0x0a, 0x16, 0x2c, 0xff, 0x0e, 0x1b, 0x2e, 0xff, 0x0f, 0x14, 0x31, 0xff, 0x15, 0x11, 0x39, 0xff, 0x15, 0x10, 0x3e, 0xff, 0x19, 0x13, 0x44, 0xff, 0x21, 0x1b, 0x4e, 0xff, 0x1a, 0x1a, 0x4b, 0xff, 0x14, 0x14, 0x44, 0xff, 0x18, 0x14, 0x44, 0xff, 0x23, 0x1c, 0x53, 0xff, 0x26, 0x23, 0x5d, 0xff, 0x22, 0x2c, 0x5e, 0xff, 0x29, 0x35, 0x65, 0xff, 0x31, 0x37, 0x68, 0xff, 0x2e, 0x31, 0x60, 0xff, 0x27, 0x29, 0x57, 0xff, 0x23, 0x28, 0x55, 0xff, 0x1f, 0x2b, 0x52, 0xff, 0x18, 0x26, 0x4a, 0xff, 0x20, 0x32, 0x5e, 0xff, 0x37, 0x52, 0x88, 0xff, 0x48, 0x61, 0x98, 0xff, 0x3d, 0x58, 0x8f, 0xff, 0x32, 0x49, 0x7b, 0xff, 0x30, 0x42, 0x6d, 0xff, 0x2e, 0x3b, 0x61, 0xff, 0x2c, 0x3c, 0x5a, 0xff, 0x2d, 0x3d, 0x61, 0xff, 0x36, 0x40, 0x69, 0xff, 0x36, 0x3d, 0x64, 0xff, 0x72, 0x72, 0x63, 0xff, 0xc8, 0xae, 0x64, 0xff, 0xbf, 0xa4, 0x65, 0xff, 0xba, 0xa2, 0x63, 0xff, 0xbc, 0xa2, 0x66, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0x9f, 0x68, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb3, 0x97, 0x5e, 0x1b, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb7, 0x9d, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb7, 0x9f, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb7, 0x9d, 0x65, 0xff, 0xbb, 0x9f, 0x65, 0xff, 0xbb, 0x9e, 0x67, 0xff, 0xc8, 0xa8, 0x6d, 0xff, 0x76, 0x71, 0x69, 0xff, 0x1b, 0x2d, 0x54, 0xff, 0x25, 0x33, 0x5b, 0xff, 0x2b, 0x38, 0x63, 0xff, 0x36, 0x44, 0x73, 0xff, 0x3d, 0x4e, 0x7d, 0xff, 0x33, 0x49, 0x74, 0xff, 0x1e, 0x32, 0x5a, 0xff, 0x27, 0x3a, 0x60, 0xff, 0x3b, 0x4c, 0x7a, 0xff, 0x47, 0x5b, 0x93, 0xff, 0x53, 0x67, 0xaa, 0xff, 0x5c, 0x69, 0xb7, 0xff, 0x73, 0x82, 0xcd, 0xff, 0x7f, 0x91, 0xd9, 0xff, 0x72, 0x83, 0xc8, 0xff, 0x60, 0x6d, 0xb3, 0xff, 0x5f, 0x69, 0xb0, 0xff, 0x77, 0x81, 0xc8, 0xff, 0x8c, 0x9c, 0xe2, 0xff, 0x8a, 0xa0, 0xe2, 0xff, 0x81, 0x96, 0xdd, 0xff, 0x70, 0x80, 0xca, 0xff, 0x5d, 0x6d, 0xaf, 0xff, 0x54, 0x66, 0xa4, 0xff, 0x42, 0x5b, 0x95, 0xff, 0x32, 0x51, 0x8a, 0xff, 0x31, 0x50, 0x89, 0xff, 0x35, 0x4e, 0x87, 0xff, 0x43, 0x60, 0x95, 0xff, 0x47, 0x64, 0x95, 0xff, 0x3b, 0x55, 0x86, 0xff, 0x30, 0x46, 0x73, 0xff, 0x2c, 0x3f, 0x67, 0xff, 0x29, 0x39, 0x60, 0xff, 0x2b, 0x39, 0x62, 0xff, 0x2f, 0x3b, 0x60, 0xff, 0x37, 0x42, 0x64, 0xff, 0x38, 0x42, 0x61, 0xff, 0x92, 0x84, 0x64, 0xff, 0xc5, 0xb1, 0x65, 0xff, 0xb9, 0xa4, 0x61, 0xff, 0xbb, 0xa1, 0x64, 0xff, 0xba, 0xa2, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0xa0, 0x67, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x9a, 0x61, 0xd7, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb6, 0x9d, 0x64, 0xff, 0xb2, 0x9e, 0x64, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb3, 0x9f, 0x64, 0xff, 0xb2, 0xa2, 0x61, 0xff, 0xb3, 0x9e, 0x68, 0xff, 0xc2, 0xa9, 0x62, 0xff, 0xb3, 0x9f, 0x6d, 0xff, 0x44, 0x43, 0x5a, 0xff, 0x1d, 0x2b, 0x54, 0xff, 0x23, 0x35, 0x58, 0xff, 0x28, 0x3a, 0x5e, 0xff, 0x31, 0x48, 0x72, 0xff, 0x34, 0x50, 0x82, 0xff, 0x35, 0x52, 0x85, 0xff, 0x42, 0x5e, 0x91, 0xff, 0x47, 0x5e, 0x91, 0xff, 0x46, 0x5f, 0x95, 0xff, 0x5c, 0x75, 0xb0, 0xff, 0x60, 0x76, 0xbe, 0xff, 0x65, 0x77, 0xc4, 0xff, 0x7c, 0x8c, 0xde, 0xff, 0x8a, 0x9d, 0xed, 0xff, 0x95, 0xa8, 0xf7, 0xff, 0x9a, 0xa8, 0xf8, 0xff, 0x95, 0xa3, 0xf0, 0xff, 0x86, 0x96, 0xe1, 0xff, 0x6d, 0x80, 0xcb, 0xff, 0x59, 0x66, 0xb7, 0xff, 0x53, 0x5c, 0xac, 0xff, 0x50, 0x63, 0x9f, 0xff, 0x4c, 0x64, 0x97, 0xff, 0x40, 0x5b, 0x91, 0xff, 0x43, 0x61, 0x97, 0xff, 0x43, 0x62, 0x98, 0xff, 0x42, 0x5a, 0x8f, 0xff, 0x43, 0x5b, 0x8b, 0xff, 0x3c, 0x56, 0x82, 0xff, 0x39, 0x4d, 0x77, 0xff, 0x2f, 0x40, 0x68, 0xff, 0x2b, 0x3c, 0x60, 0xff, 0x2a, 0x3c, 0x62, 0xff, 0x30, 0x3c, 0x68, 0xff, 0x35, 0x3f, 0x63, 0xff, 0x3a, 0x47, 0x62, 0xff, 0x46, 0x4d, 0x5f, 0xff, 0xa8, 0x92, 0x67, 0xff, 0xc0, 0xae, 0x68, 0xff, 0xb6, 0xa2, 0x62, 0xff, 0xb9, 0x9e, 0x64, 0xff, 0xb7, 0xa0, 0x66, 0xff, 0xbc, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x9a, 0x60, 0x8e, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xba, 0x9d, 0x64, 0xff, 0xb6, 0x9d, 0x64, 0xff, 0xb3, 0x9e, 0x64, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb6, 0x9f, 0x66, 0xff, 0xb5, 0xa0, 0x61, 0xff, 0xb3, 0x9b, 0x67, 0xff, 0xb6, 0xa3, 0x62, 0xff, 0xcb, 0xaf, 0x66, 0xff, 0x93, 0x85, 0x65, 0xff, 0x25, 0x33, 0x48, 0xff, 0x21, 0x2e, 0x52, 0xff, 0x2a, 0x36, 0x50, 0xff, 0x2b, 0x3b, 0x5d, 0xff, 0x33, 0x44, 0x73, 0xff, 0x39, 0x4f, 0x82, 0xff, 0x41, 0x5d, 0x93, 0xff, 0x47, 0x68, 0x99, 0xff, 0x42, 0x5e, 0x8d, 0xff, 0x4b, 0x63, 0x94, 0xff, 0x52, 0x6a, 0xa7, 0xff, 0x41, 0x52, 0x94, 0xff, 0x31, 0x39, 0x7d, 0xff, 0x34, 0x3b, 0x80, 0xff, 0x44, 0x4b, 0x8f, 0xff, 0x4b, 0x4d, 0x92, 0xff, 0x43, 0x44, 0x88, 0xff, 0x39, 0x3e, 0x7f, 0xff, 0x39, 0x41, 0x83, 0xff, 0x44, 0x4a, 0x88, 0xff, 0x4e, 0x58, 0x8d, 0xff, 0x49, 0x5e, 0x8b, 0xff, 0x43, 0x5b, 0x8a, 0xff, 0x49, 0x61, 0x98, 0xff, 0x4c, 0x68, 0x9f, 0xff, 0x3f, 0x5f, 0x94, 0xff, 0x34, 0x52, 0x81, 0xff, 0x33, 0x4a, 0x78, 0xff, 0x33, 0x45, 0x71, 0xff, 0x35, 0x42, 0x6b, 0xff, 0x35, 0x3f, 0x66, 0xff, 0x37, 0x3f, 0x63, 0xff, 0x36, 0x42, 0x65, 0xff, 0x3b, 0x45, 0x6e, 0xff, 0x45, 0x4d, 0x70, 0xff, 0x3d, 0x49, 0x60, 0xff, 0x51, 0x51, 0x57, 0xff, 0xb8, 0x9f, 0x66, 0xff, 0xba, 0xa8, 0x67, 0xff, 0xb7, 0x9f, 0x6c, 0xff, 0xba, 0x9f, 0x65, 0xff, 0xb8, 0xa1, 0x65, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xba, 0x9f, 0x66, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x99, 0x62, 0x46, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb7, 0x9e, 0x64, 0xff, 0xb5, 0x9e, 0x64, 0xff, 0xb6, 0x9e, 0x64, 0xff, 0xb5, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb7, 0x9e, 0x65, 0xff, 0xb7, 0x9e, 0x65, 0xff, 0xb7, 0x9e, 0x65, 0xff, 0xb7, 0x9e, 0x65, 0xff, 0xb7, 0x9e, 0x65, 0xff, 0xb7, 0x9e, 0x65, 0xff, 0xb8, 0x9f, 0x66, 0xff, 0xb7, 0x9f, 0x63, 0xff, 0xb7, 0x9d, 0x65, 0xff, 0xb3, 0xa0, 0x67, 0xff, 0xb9, 0xa1, 0x62, 0xff, 0xc9, 0xae, 0x6d, 0xff, 0x80, 0x76, 0x5f, 0xff, 0x23, 0x2b, 0x4b, 0xff, 0x26, 0x31, 0x51, 0xff, 0x31, 0x38, 0x4e, 0xff, 0x2c, 0x3b, 0x58, 0xff, 0x30, 0x42, 0x6c, 0xff, 0x33, 0x49, 0x7a, 0xff, 0x45, 0x60, 0x8e, 0xff, 0x4a, 0x62, 0x8f, 0xff, 0x37, 0x4d, 0x78, 0xff, 0x3a, 0x50, 0x74, 0xff, 0x3b, 0x4e, 0x6d, 0xff, 0x37, 0x43, 0x5f, 0xff, 0x30, 0x39, 0x56, 0xff, 0x2c, 0x34, 0x52, 0xff, 0x2c, 0x33, 0x50, 0xff, 0x2d, 0x33, 0x4f, 0xff, 0x30, 0x37, 0x54, 0xff, 0x37, 0x44, 0x60, 0xff, 0x3d, 0x4c, 0x6d, 0xff, 0x3b, 0x4c, 0x74, 0xff, 0x37, 0x4e, 0x7b, 0xff, 0x41, 0x5c, 0x90, 0xff, 0x4a, 0x67, 0x9f, 0xff, 0x48, 0x65, 0x9a, 0xff, 0x3c, 0x58, 0x8b, 0xff, 0x33, 0x4b, 0x79, 0xff, 0x2d, 0x41, 0x6e, 0xff, 0x2f, 0x3e, 0x69, 0xff, 0x31, 0x3e, 0x65, 0xff, 0x33, 0x40, 0x66, 0xff, 0x3a, 0x47, 0x6a, 0xff, 0x3c, 0x49, 0x6b, 0xff, 0x46, 0x52, 0x6f, 0xff, 0x4c, 0x55, 0x70, 0xff, 0x22, 0x2b, 0x4d, 0xff, 0x5a, 0x56, 0x54, 0xff, 0xc4, 0xaa, 0x6e, 0xff, 0xbe, 0xa5, 0x65, 0xff, 0xba, 0xa0, 0x6b, 0xff, 0xbc, 0xa0, 0x67, 0xff, 0xba, 0xa1, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xb9, 0xa0, 0x66, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x91, 0x6d, 0x07, 0xb5, 0x99, 0x61, 0xef, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb6, 0x9e, 0x64, 0xff, 0xb2, 0x9e, 0x64, 0xff, 0xb3, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xba, 0x9e, 0x65, 0xff, 0xba, 0x9e, 0x65, 0xff, 0xba, 0x9e, 0x65, 0xff, 0xba, 0x9e, 0x65, 0xff, 0xba, 0x9e, 0x65, 0xff, 0xba, 0x9e, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb3, 0x9f, 0x66, 0xff, 0xb5, 0xa0, 0x65, 0xff, 0xb5, 0x9f, 0x64, 0xff, 0xb1, 0x9d, 0x62, 0xff, 0xbc, 0xa5, 0x60, 0xff, 0xc9, 0xaf, 0x68, 0xff, 0x7c, 0x72, 0x5e, 0xff, 0x28, 0x34, 0x51, 0xff, 0x25, 0x32, 0x54, 0xff, 0x2c, 0x37, 0x5a, 0xff, 0x28, 0x3a, 0x5e, 0xff, 0x2a, 0x3f, 0x65, 0xff, 0x37, 0x4b, 0x76, 0xff, 0x47, 0x5e, 0x8c, 0xff, 0x44, 0x5d, 0x8d, 0xff, 0x3b, 0x51, 0x7a, 0xff, 0x31, 0x45, 0x6c, 0xff, 0x32, 0x43, 0x6c, 0xff, 0x38, 0x48, 0x6e, 0xff, 0x37, 0x47, 0x6c, 0xff, 0x31, 0x43, 0x68, 0xff, 0x30, 0x40, 0x64, 0xff, 0x2f, 0x41, 0x66, 0xff, 0x2d, 0x41, 0x6a, 0xff, 0x31, 0x48, 0x74, 0xff, 0x3a, 0x53, 0x83, 0xff, 0x42, 0x5c, 0x8e, 0xff, 0x4b, 0x68, 0x9d, 0xff, 0x47, 0x66, 0x9d, 0xff, 0x3d, 0x58, 0x8b, 0xff, 0x37, 0x4e, 0x7e, 0xff, 0x38, 0x4b, 0x79, 0xff, 0x31, 0x42, 0x6e, 0xff, 0x2c, 0x3c, 0x66, 0xff, 0x31, 0x3f, 0x66, 0xff, 0x35, 0x44, 0x68, 0xff, 0x3b, 0x4c, 0x6d, 0xff, 0x49, 0x55, 0x76, 0xff, 0x4f, 0x5c, 0x71, 0xff, 0x23, 0x2e, 0x48, 0xff, 0x0b, 0x17, 0x41, 0xff, 0x72, 0x6c, 0x62, 0xff, 0xc8, 0xad, 0x71, 0xff, 0xc0, 0xa2, 0x65, 0xff, 0xbb, 0xa0, 0x66, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xba, 0xa0, 0x67, 0xef, 0xb6, 0x91, 0x6d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x9a, 0x61, 0xa0, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb6, 0x9e, 0x64, 0xff, 0xb2, 0x9e, 0x64, 0xff, 0xb3, 0x9e, 0x64, 0xff, 0xb3, 0x9e, 0x64, 0xff, 0xb3, 0x9e, 0x64, 0xff, 0xb5, 0xa0, 0x66, 0xff, 0xb5, 0xa0, 0x66, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xba, 0x9e, 0x65, 0xff, 0xba, 0x9e, 0x65, 0xff, 0xba, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb3, 0x9d, 0x64, 0xff, 0xb5, 0xa0, 0x63, 0xff, 0xb4, 0xa1, 0x62, 0xff, 0xbe, 0xa7, 0x5e, 0xff, 0xcc, 0xac, 0x6b, 0xff, 0x8d, 0x7d, 0x6a, 0xff, 0x30, 0x3a, 0x52, 0xff, 0x20, 0x2d, 0x4f, 0xff, 0x26, 0x35, 0x50, 0xff, 0x28, 0x3a, 0x56, 0xff, 0x32, 0x43, 0x66, 0xff, 0x45, 0x59, 0x84, 0xff, 0x53, 0x6c, 0x9f, 0xff, 0x4e, 0x6b, 0x9c, 0xff, 0x43, 0x61, 0x96, 0xff, 0x47, 0x66, 0xa0, 0xff, 0x4e, 0x6d, 0xa7, 0xff, 0x4b, 0x6b, 0xa4, 0xff, 0x46, 0x66, 0x9f, 0xff, 0x43, 0x63, 0x9b, 0xff, 0x43, 0x61, 0x9b, 0xff, 0x49, 0x60, 0xa1, 0xff, 0x4b, 0x66, 0xa4, 0xff, 0x4c, 0x6c, 0xa3, 0xff, 0x55, 0x71, 0xa6, 0xff, 0x54, 0x6f, 0xa3, 0xff, 0x49, 0x62, 0x95, 0xff, 0x37, 0x50, 0x7f, 0xff, 0x35, 0x4b, 0x78, 0xff, 0x3a, 0x4c, 0x77, 0xff, 0x33, 0x43, 0x6c, 0xff, 0x31, 0x3f, 0x66, 0xff, 0x36, 0x41, 0x64, 0xff, 0x3e, 0x49, 0x69, 0xff, 0x4e, 0x5b, 0x79, 0xff, 0x4e, 0x57, 0x72, 0xff, 0x1d, 0x26, 0x3c, 0xff, 0x01, 0x0f, 0x30, 0xff, 0x16, 0x2a, 0x4f, 0xff, 0x8a, 0x81, 0x6a, 0xff, 0xcd, 0xac, 0x6b, 0xff, 0xbb, 0x9f, 0x66, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xba, 0x9f, 0x67, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x9b, 0x60, 0x4a, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb7, 0x9e, 0x64, 0xff, 0xb5, 0x9e, 0x64, 0xff, 0xb6, 0x9e, 0x64, 0xff, 0xb6, 0x9e, 0x64, 0xff, 0xb6, 0x9e, 0x64, 0xff, 0xb8, 0xa0, 0x66, 0xff, 0xb7, 0xa0, 0x66, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb7, 0x9e, 0x65, 0xff, 0xb7, 0x9e, 0x65, 0xff, 0xb7, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0xa0, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb6, 0x9e, 0x69, 0xff, 0xb5, 0x9f, 0x6a, 0xff, 0xbe, 0xa4, 0x65, 0xff, 0xcc, 0xae, 0x6f, 0xff, 0x92, 0x88, 0x65, 0xff, 0x3c, 0x42, 0x4e, 0xff, 0x20, 0x2d, 0x45, 0xff, 0x2b, 0x36, 0x51, 0xff, 0x38, 0x3f, 0x5f, 0xff, 0x3c, 0x53, 0x7e, 0xff, 0x4c, 0x6a, 0x99, 0xff, 0x54, 0x74, 0xa7, 0xff, 0x56, 0x77, 0xb2, 0xff, 0x56, 0x79, 0xbb, 0xff, 0x57, 0x7c, 0xbe, 0xff, 0x5b, 0x81, 0xc1, 0xff, 0x5a, 0x7f, 0xbf, 0xff, 0x54, 0x7f, 0xbf, 0xff, 0x53, 0x7d, 0xbe, 0xff, 0x57, 0x79, 0xbd, 0xff, 0x5a, 0x7d, 0xbe, 0xff, 0x56, 0x7c, 0xb7, 0xff, 0x54, 0x76, 0xae, 0xff, 0x4e, 0x6c, 0xa0, 0xff, 0x41, 0x5b, 0x8c, 0xff, 0x37, 0x4f, 0x7d, 0xff, 0x39, 0x4c, 0x79, 0xff, 0x36, 0x45, 0x70, 0xff, 0x33, 0x41, 0x67, 0xff, 0x36, 0x42, 0x65, 0xff, 0x3e, 0x47, 0x6c, 0xff, 0x50, 0x59, 0x7a, 0xff, 0x44, 0x4b, 0x68, 0xff, 0x14, 0x1a, 0x32, 0xff, 0x00, 0x0d, 0x22, 0xff, 0x11, 0x21, 0x44, 0xff, 0x26, 0x38, 0x56, 0xff, 0x9b, 0x8d, 0x66, 0xff, 0xc9, 0xab, 0x69, 0xff, 0xb9, 0x9f, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xba, 0x9e, 0x67, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x7f, 0x7f, 0x04, 0xb5, 0x9a, 0x61, 0xe7, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xbb, 0x9f, 0x66, 0xff, 0xb9, 0x9f, 0x66, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb7, 0xa2, 0x67, 0xff, 0xb7, 0xa1, 0x68, 0xff, 0xb5, 0xa0, 0x67, 0xff, 0xb7, 0xa1, 0x63, 0xff, 0xc9, 0xaf, 0x69, 0xff, 0xad, 0x98, 0x71, 0xff, 0x52, 0x53, 0x57, 0xff, 0x2c, 0x33, 0x52, 0xff, 0x35, 0x38, 0x58, 0xff, 0x2f, 0x45, 0x6c, 0xff, 0x40, 0x5e, 0x86, 0xff, 0x4e, 0x70, 0xa5, 0xff, 0x59, 0x7c, 0xba, 0xff, 0x60, 0x83, 0xc6, 0xff, 0x5b, 0x83, 0xc6, 0xff, 0x5b, 0x85, 0xc7, 0xff, 0x5e, 0x86, 0xc9, 0xff, 0x5c, 0x85, 0xca, 0xff, 0x5a, 0x84, 0xc8, 0xff, 0x5e, 0x84, 0xc5, 0xff, 0x5e, 0x83, 0xc3, 0xff, 0x54, 0x77, 0xb6, 0xff, 0x49, 0x6b, 0xa8, 0xff, 0x42, 0x62, 0x98, 0xff, 0x3b, 0x55, 0x82, 0xff, 0x35, 0x4b, 0x77, 0xff, 0x33, 0x42, 0x6f, 0xff, 0x33, 0x40, 0x69, 0xff, 0x39, 0x44, 0x67, 0xff, 0x44, 0x4f, 0x6d, 0xff, 0x4f, 0x57, 0x76, 0xff, 0x32, 0x3a, 0x54, 0xff, 0x06, 0x0d, 0x22, 0xff, 0x00, 0x08, 0x24, 0xff, 0x0c, 0x21, 0x42, 0xff, 0x16, 0x27, 0x50, 0xff, 0x38, 0x42, 0x5b, 0xff, 0xad, 0x96, 0x66, 0xff, 0xc3, 0xa9, 0x69, 0xff, 0xb8, 0x9f, 0x68, 0xff, 0xbc, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xba, 0xa0, 0x66, 0xe7, 0xcc, 0x99, 0x66, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x9a, 0x60, 0x87, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb5, 0x9a, 0x61, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xb9, 0x9f, 0x66, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xba, 0x9e, 0x65, 0xff, 0xba, 0x9e, 0x65, 0xff, 0xba, 0x9e, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb3, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb7, 0xa1, 0x67, 0xff, 0xb8, 0xa2, 0x68, 0xff, 0xb7, 0xa1, 0x67, 0xff, 0xb4, 0x9e, 0x66, 0xff, 0xb6, 0xa2, 0x60, 0xff, 0xd0, 0xb2, 0x67, 0xff, 0xa7, 0x96, 0x6a, 0xff, 0x3d, 0x47, 0x5e, 0xff, 0x3b, 0x40, 0x5d, 0xff, 0x34, 0x3f, 0x59, 0xff, 0x32, 0x49, 0x71, 0xff, 0x3f, 0x5f, 0x95, 0xff, 0x4e, 0x6e, 0xa8, 0xff, 0x5c, 0x7d, 0xbd, 0xff, 0x5d, 0x83, 0xc8, 0xff, 0x55, 0x7d, 0xc2, 0xff, 0x51, 0x79, 0xbc, 0xff, 0x54, 0x78, 0xbf, 0xff, 0x58, 0x79, 0xbf, 0xff, 0x56, 0x74, 0xb7, 0xff, 0x50, 0x6f, 0xad, 0xff, 0x47, 0x66, 0xa1, 0xff, 0x43, 0x5f, 0x9a, 0xff, 0x3f, 0x5a, 0x8b, 0xff, 0x3a, 0x51, 0x77, 0xff, 0x38, 0x47, 0x6f, 0xff, 0x39, 0x44, 0x6b, 0xff, 0x40, 0x4c, 0x6f, 0xff, 0x4b, 0x57, 0x74, 0xff, 0x43, 0x4e, 0x65, 0xff, 0x21, 0x25, 0x36, 0xff, 0x00, 0x04, 0x15, 0xff, 0x02, 0x10, 0x24, 0xff, 0x11, 0x20, 0x40, 0xff, 0x12, 0x28, 0x4e, 0xff, 0x17, 0x28, 0x58, 0xff, 0x40, 0x49, 0x63, 0xff, 0xb4, 0x9d, 0x69, 0xff, 0xc6, 0xa8, 0x64, 0xff, 0xbb, 0xa1, 0x66, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0xa0, 0x67, 0xff, 0xbe, 0xa2, 0x69, 0xff, 0xbe, 0xa2, 0x69, 0xff, 0xbd, 0xa1, 0x68, 0xff, 0xbd, 0xa1, 0x68, 0xff, 0xbd, 0xa1, 0x68, 0xff, 0xbd, 0xa1, 0x68, 0xff, 0xbd, 0xa1, 0x68, 0xff, 0xbd, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbb, 0xa0, 0x67, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x9d, 0x61, 0x22, 0xb4, 0x99, 0x61, 0xfe, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb6, 0x9b, 0x62, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb7, 0x9d, 0x64, 0xff, 0xb7, 0x9d, 0x64, 0xff, 0xb7, 0x9d, 0x64, 0xff, 0xb7, 0x9d, 0x64, 0xff, 0xb7, 0x9d, 0x64, 0xff, 0xb7, 0x9e, 0x65, 0xff, 0xb8, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xba, 0x9f, 0x66, 0xff, 0xb9, 0x9f, 0x66, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb8, 0x9e, 0x65, 0xff, 0xb8, 0x9e, 0x65, 0xff, 0xb8, 0x9e, 0x65, 0xff, 0xb7, 0x9f, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb7, 0xa1, 0x67, 0xff, 0xb7, 0xa1, 0x67, 0xff, 0xb7, 0xa1, 0x65, 0xff, 0xb2, 0x9d, 0x6a, 0xff, 0xc1, 0xa6, 0x68, 0xff, 0xbd, 0xa8, 0x63, 0xff, 0x44, 0x49, 0x55, 0xff, 0x2e, 0x39, 0x56, 0xff, 0x57, 0x58, 0x6c, 0xff, 0x3f, 0x4a, 0x6b, 0xff, 0x31, 0x47, 0x6f, 0xff, 0x3c, 0x54, 0x81, 0xff, 0x41, 0x5b, 0x8e, 0xff, 0x49, 0x68, 0xa0, 0xff, 0x4b, 0x6c, 0xa5, 0xff, 0x46, 0x68, 0xa2, 0xff, 0x42, 0x62, 0x9e, 0xff, 0x45, 0x63, 0x9f, 0xff, 0x43, 0x60, 0x99, 0xff, 0x3e, 0x5a, 0x8f, 0xff, 0x3a, 0x54, 0x85, 0xff, 0x38, 0x51, 0x80, 0xff, 0x3f, 0x53, 0x80, 0xff, 0x3c, 0x4d, 0x76, 0xff, 0x3e, 0x4f, 0x73, 0xff, 0x4a, 0x58, 0x78, 0xff, 0x47, 0x52, 0x70, 0xff, 0x2c, 0x37, 0x50, 0xff, 0x09, 0x0f, 0x22, 0xff, 0x00, 0x00, 0x11, 0xff, 0x07, 0x0f, 0x29, 0xff, 0x11, 0x20, 0x3d, 0xff, 0x16, 0x29, 0x48, 0xff, 0x1b, 0x30, 0x4f, 0xff, 0x15, 0x2d, 0x57, 0xff, 0x3f, 0x4d, 0x62, 0xff, 0xbb, 0x9f, 0x6a, 0xff, 0xc7, 0xa6, 0x64, 0xff, 0xba, 0xa1, 0x6d, 0xff, 0xbc, 0xa1, 0x66, 0xff, 0xbb, 0xa0, 0x66, 0xff, 0xba, 0x9f, 0x67, 0xff, 0xba, 0xa0, 0x67, 0xff, 0xbc, 0xa2, 0x69, 0xff, 0xbc, 0xa2, 0x69, 0xff, 0xbb, 0xa1, 0x68, 0xff, 0xbb, 0xa1, 0x68, 0xff, 0xbb, 0xa1, 0x68, 0xff, 0xbb, 0xa1, 0x68, 0xff, 0xbb, 0xa1, 0x68, 0xff, 0xbb, 0xa1, 0x68, 0xff, 0xbc, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x69, 0xfe, 0xbd, 0xa0, 0x66, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x9a, 0x60, 0xb4, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb5, 0x9e, 0x64, 0xff, 0xb3, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb5, 0xa0, 0x66, 0xff, 0xb7, 0x9f, 0x66, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9e, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb8, 0x9e, 0x65, 0xff, 0xbb, 0x9e, 0x65, 0xff, 0xba, 0x9e, 0x65, 0xff, 0xb7, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb6, 0xa1, 0x66, 0xff, 0xba, 0x9f, 0x6a, 0xff, 0xb8, 0xa3, 0x64, 0xff, 0xc4, 0xb2, 0x6b, 0xff, 0x60, 0x5f, 0x61, 0xff, 0x03, 0x19, 0x3d, 0xff, 0x31, 0x35, 0x50, 0xff, 0x4e, 0x54, 0x68, 0xff, 0x48, 0x54, 0x6b, 0xff, 0x36, 0x46, 0x64, 0xff, 0x2a, 0x40, 0x63, 0xff, 0x33, 0x48, 0x70, 0xff, 0x37, 0x4e, 0x79, 0xff, 0x34, 0x4f, 0x7c, 0xff, 0x35, 0x4c, 0x7a, 0xff, 0x38, 0x4b, 0x79, 0xff, 0x37, 0x4c, 0x79, 0xff, 0x37, 0x4b, 0x7a, 0xff, 0x37, 0x48, 0x77, 0xff, 0x3b, 0x4a, 0x75, 0xff, 0x46, 0x54, 0x80, 0xff, 0x52, 0x5f, 0x88, 0xff, 0x4d, 0x5a, 0x78, 0xff, 0x33, 0x3d, 0x53, 0xff, 0x13, 0x18, 0x2d, 0xff, 0x00, 0x00, 0x0e, 0xff, 0x00, 0x00, 0x13, 0xff, 0x07, 0x13, 0x2f, 0xff, 0x0f, 0x1e, 0x3d, 0xff, 0x14, 0x24, 0x47, 0xff, 0x18, 0x28, 0x53, 0xff, 0x24, 0x2f, 0x58, 0xff, 0x19, 0x33, 0x5e, 0xff, 0x39, 0x4d, 0x6b, 0xff, 0xb2, 0x9a, 0x72, 0xff, 0xce, 0xad, 0x64, 0xff, 0xb6, 0x9f, 0x67, 0xff, 0xbc, 0xa1, 0x66, 0xff, 0xbc, 0xa1, 0x65, 0xff, 0xb9, 0xa1, 0x66, 0xff, 0xb6, 0xa1, 0x67, 0xff, 0xb9, 0xa3, 0x69, 0xff, 0xb9, 0xa3, 0x69, 0xff, 0xb8, 0xa2, 0x68, 0xff, 0xb8, 0xa2, 0x68, 0xff, 0xb8, 0xa2, 0x68, 0xff, 0xb8, 0xa2, 0x68, 0xff, 0xb8, 0xa2, 0x68, 0xff, 0xb8, 0xa2, 0x68, 0xff, 0xbb, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa2, 0x69, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x9b, 0x5f, 0x40, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb5, 0x9e, 0x64, 0xff, 0xb2, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0xa0, 0x66, 0xff, 0xb7, 0x9f, 0x66, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9e, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb8, 0x9e, 0x65, 0xff, 0xbb, 0x9e, 0x65, 0xff, 0xbb, 0x9e, 0x65, 0xff, 0xb7, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb7, 0xa1, 0x67, 0xff, 0xb7, 0xa0, 0x67, 0xff, 0xb2, 0x9e, 0x63, 0xff, 0xcb, 0xb0, 0x67, 0xff, 0x8a, 0x80, 0x6a, 0xff, 0x14, 0x28, 0x4e, 0xff, 0x09, 0x1b, 0x38, 0xff, 0x18, 0x24, 0x3c, 0xff, 0x3d, 0x41, 0x55, 0xff, 0x51, 0x56, 0x6c, 0xff, 0x48, 0x4f, 0x67, 0xff, 0x3b, 0x44, 0x5e, 0xff, 0x35, 0x41, 0x5f, 0xff, 0x32, 0x41, 0x61, 0xff, 0x34, 0x42, 0x63, 0xff, 0x38, 0x43, 0x64, 0xff, 0x3b, 0x46, 0x67, 0xff, 0x3f, 0x4e, 0x71, 0xff, 0x4b, 0x5c, 0x81, 0xff, 0x55, 0x63, 0x84, 0xff, 0x4a, 0x59, 0x76, 0xff, 0x35, 0x40, 0x57, 0xff, 0x1e, 0x1c, 0x2d, 0xff, 0x07, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x0b, 0xff, 0x01, 0x05, 0x18, 0xff, 0x09, 0x12, 0x2a, 0xff, 0x10, 0x20, 0x41, 0xff, 0x16, 0x29, 0x4d, 0xff, 0x16, 0x2b, 0x51, 0xff, 0x1d, 0x2d, 0x5b, 0xff, 0x1f, 0x2e, 0x63, 0xff, 0x28, 0x3b, 0x64, 0xff, 0x33, 0x42, 0x68, 0xff, 0x6e, 0x6f, 0x6d, 0xff, 0xbe, 0xa8, 0x68, 0xff, 0xc4, 0xa7, 0x5c, 0xff, 0xb9, 0x9e, 0x68, 0xff, 0xbd, 0xa1, 0x6a, 0xff, 0xbb, 0xa3, 0x65, 0xff, 0xb6, 0xa1, 0x67, 0xff, 0xb9, 0xa4, 0x6a, 0xff, 0xb9, 0xa4, 0x69, 0xff, 0xb8, 0xa3, 0x68, 0xff, 0xb8, 0xa3, 0x68, 0xff, 0xb8, 0xa2, 0x68, 0xff, 0xb8, 0xa2, 0x68, 0xff, 0xb8, 0xa2, 0x68, 0xff, 0xb8, 0xa2, 0x68, 0xff, 0xbb, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbb, 0xa3, 0x67, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x9b, 0x63, 0xcd, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb5, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb7, 0x9f, 0x66, 0xff, 0xb8, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9e, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb8, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb7, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb7, 0xa0, 0x67, 0xff, 0xb4, 0xa1, 0x66, 0xff, 0xb4, 0xa1, 0x68, 0xff, 0xce, 0xac, 0x65, 0xff, 0xa7, 0x95, 0x6a, 0xff, 0x2e, 0x37, 0x5c, 0xff, 0x17, 0x28, 0x48, 0xff, 0x16, 0x20, 0x3c, 0xff, 0x0d, 0x13, 0x2d, 0xff, 0x22, 0x28, 0x40, 0xff, 0x3e, 0x41, 0x57, 0xff, 0x46, 0x4e, 0x64, 0xff, 0x4b, 0x56, 0x6f, 0xff, 0x4c, 0x57, 0x73, 0xff, 0x4b, 0x57, 0x73, 0xff, 0x4d, 0x59, 0x75, 0xff, 0x50, 0x5c, 0x78, 0xff, 0x53, 0x60, 0x7b, 0xff, 0x46, 0x54, 0x6c, 0xff, 0x27, 0x33, 0x4a, 0xff, 0x0c, 0x12, 0x26, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x0a, 0xff, 0x00, 0x01, 0x13, 0xff, 0x06, 0x0c, 0x22, 0xff, 0x09, 0x15, 0x32, 0xff, 0x0c, 0x1d, 0x40, 0xff, 0x14, 0x28, 0x4e, 0xff, 0x18, 0x2d, 0x56, 0xff, 0x17, 0x2f, 0x59, 0xff, 0x24, 0x36, 0x62, 0xff, 0x25, 0x3b, 0x6c, 0xff, 0x2e, 0x3f, 0x5b, 0xff, 0x39, 0x45, 0x62, 0xff, 0x32, 0x47, 0x6a, 0xff, 0x71, 0x6e, 0x6e, 0xff, 0xca, 0xac, 0x6e, 0xff, 0xc7, 0xa6, 0x60, 0xff, 0xb4, 0x95, 0x54, 0xff, 0xb2, 0x9b, 0x52, 0xff, 0xb7, 0xa0, 0x63, 0xff, 0xbb, 0xa3, 0x69, 0xff, 0xb8, 0xa1, 0x6c, 0xff, 0xb7, 0xa1, 0x6a, 0xff, 0xb7, 0xa0, 0x69, 0xff, 0xb9, 0xa2, 0x69, 0xff, 0xb8, 0xa2, 0x67, 0xff, 0xb8, 0xa2, 0x68, 0xff, 0xb8, 0xa2, 0x68, 0xff, 0xbb, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa1, 0x68, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x9d, 0x61, 0x51, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xbb, 0x9f, 0x66, 0xff, 0xb8, 0x9f, 0x66, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb7, 0xa1, 0x67, 0xff, 0xb6, 0xa0, 0x68, 0xff, 0xb4, 0xa2, 0x61, 0xff, 0xc1, 0xa7, 0x6d, 0xff, 0xb4, 0xa2, 0x6b, 0xff, 0x42, 0x4d, 0x5d, 0xff, 0x15, 0x2a, 0x4b, 0xff, 0x19, 0x2d, 0x48, 0xff, 0x14, 0x25, 0x43, 0xff, 0x0b, 0x17, 0x31, 0xff, 0x09, 0x16, 0x29, 0xff, 0x15, 0x21, 0x32, 0xff, 0x23, 0x2c, 0x3c, 0xff, 0x2d, 0x33, 0x40, 0xff, 0x2e, 0x37, 0x46, 0xff, 0x29, 0x34, 0x46, 0xff, 0x21, 0x2b, 0x3d, 0xff, 0x12, 0x1a, 0x2a, 0xff, 0x02, 0x08, 0x15, 0xff, 0x00, 0x00, 0x0a, 0xff, 0x00, 0x00, 0x0b, 0xff, 0x01, 0x06, 0x15, 0xff, 0x04, 0x0a, 0x1e, 0xff, 0x01, 0x0c, 0x21, 0xff, 0x05, 0x14, 0x2e, 0xff, 0x10, 0x20, 0x40, 0xff, 0x18, 0x2a, 0x4f, 0xff, 0x1b, 0x31, 0x5a, 0xff, 0x1f, 0x35, 0x5e, 0xff, 0x26, 0x3c, 0x65, 0xff, 0x2f, 0x41, 0x70, 0xff, 0x2b, 0x41, 0x70, 0xff, 0x2a, 0x3d, 0x5e, 0xff, 0x38, 0x47, 0x62, 0xff, 0x34, 0x4c, 0x77, 0xff, 0x47, 0x58, 0x81, 0xff, 0x82, 0x79, 0x78, 0xff, 0xb3, 0xa0, 0x78, 0xff, 0xcc, 0xba, 0x8f, 0xff, 0xbd, 0xaf, 0x84, 0xff, 0xb0, 0x9a, 0x5c, 0xff, 0xb5, 0x97, 0x50, 0xff, 0xbc, 0xa1, 0x61, 0xff, 0xbf, 0xa0, 0x69, 0xff, 0xb8, 0x9e, 0x6a, 0xff, 0xb7, 0xa1, 0x6a, 0xff, 0xb7, 0xa2, 0x67, 0xff, 0xb8, 0xa2, 0x68, 0xff, 0xb8, 0xa2, 0x68, 0xff, 0xbb, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xb9, 0xa0, 0x67, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0xb7, 0x9b, 0x63, 0xce, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xbc, 0x9f, 0x66, 0xff, 0xb8, 0x9f, 0x66, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb6, 0xa1, 0x67, 0xff, 0xb9, 0xa2, 0x69, 0xff, 0xb4, 0xa2, 0x62, 0xff, 0xb7, 0xa0, 0x68, 0xff, 0xc4, 0xaa, 0x67, 0xff, 0x57, 0x5c, 0x65, 0xff, 0x11, 0x28, 0x51, 0xff, 0x1e, 0x32, 0x4f, 0xff, 0x1c, 0x2f, 0x4f, 0xff, 0x19, 0x29, 0x45, 0xff, 0x13, 0x23, 0x38, 0xff, 0x0c, 0x16, 0x25, 0xff, 0x03, 0x09, 0x15, 0xff, 0x00, 0x02, 0x0a, 0xff, 0x00, 0x01, 0x0b, 0xff, 0x00, 0x00, 0x0b, 0xff, 0x00, 0x00, 0x09, 0xff, 0x00, 0x00, 0x0a, 0xff, 0x01, 0x05, 0x11, 0xff, 0x07, 0x0b, 0x16, 0xff, 0x04, 0x09, 0x17, 0xff, 0x01, 0x0a, 0x1f, 0xff, 0x05, 0x0f, 0x26, 0xff, 0x09, 0x17, 0x31, 0xff, 0x0c, 0x20, 0x3e, 0xff, 0x14, 0x28, 0x4b, 0xff, 0x1b, 0x30, 0x59, 0xff, 0x22, 0x3a, 0x66, 0xff, 0x28, 0x40, 0x6c, 0xff, 0x2d, 0x45, 0x70, 0xff, 0x2c, 0x42, 0x6f, 0xff, 0x22, 0x3c, 0x6c, 0xff, 0x2a, 0x3e, 0x67, 0xff, 0x38, 0x45, 0x68, 0xff, 0x40, 0x55, 0x82, 0xff, 0x49, 0x68, 0x9d, 0xff, 0x30, 0x52, 0x85, 0xff, 0x49, 0x63, 0x7d, 0xff, 0xd0, 0xda, 0xe7, 0xff, 0xf1, 0xef, 0xff, 0xff, 0xe0, 0xd2, 0xce, 0xff, 0xc3, 0xb2, 0x8a, 0xff, 0xae, 0x95, 0x57, 0xff, 0xb2, 0x94, 0x54, 0xff, 0xba, 0xa4, 0x61, 0xff, 0xb8, 0xa3, 0x69, 0xff, 0xb8, 0xa2, 0x69, 0xff, 0xb8, 0xa2, 0x68, 0xff, 0xb8, 0xa2, 0x68, 0xff, 0xbb, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xba, 0x9f, 0x66, 0xce, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x9c, 0x62, 0x46, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xbb, 0x9f, 0x66, 0xff, 0xb8, 0x9f, 0x66, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0xa0, 0x65, 0xff, 0xb5, 0x9f, 0x63, 0xff, 0xb5, 0xa1, 0x66, 0xff, 0xb8, 0xa1, 0x64, 0xff, 0xb4, 0xa4, 0x64, 0xff, 0xb7, 0xa0, 0x66, 0xff, 0xce, 0xaa, 0x54, 0xff, 0x6c, 0x68, 0x69, 0xff, 0x12, 0x2a, 0x5c, 0xff, 0x20, 0x31, 0x50, 0xff, 0x21, 0x35, 0x54, 0xff, 0x1d, 0x2f, 0x4f, 0xff, 0x1d, 0x2d, 0x45, 0xff, 0x17, 0x26, 0x3b, 0xff, 0x0f, 0x1d, 0x30, 0xff, 0x0c, 0x17, 0x29, 0xff, 0x04, 0x0d, 0x1d, 0xff, 0x01, 0x08, 0x19, 0xff, 0x01, 0x0a, 0x1b, 0xff, 0x01, 0x0a, 0x1d, 0xff, 0x04, 0x0d, 0x21, 0xff, 0x03, 0x0c, 0x1f, 0xff, 0x05, 0x10, 0x25, 0xff, 0x06, 0x12, 0x2d, 0xff, 0x08, 0x16, 0x32, 0xff, 0x10, 0x22, 0x41, 0xff, 0x15, 0x2c, 0x4f, 0xff, 0x18, 0x30, 0x59, 0xff, 0x1d, 0x35, 0x64, 0xff, 0x24, 0x3d, 0x6c, 0xff, 0x27, 0x40, 0x6e, 0xff, 0x22, 0x3b, 0x68, 0xff, 0x24, 0x3e, 0x68, 0xff, 0x26, 0x42, 0x72, 0xff, 0x2d, 0x41, 0x71, 0xff, 0x3e, 0x49, 0x7a, 0xff, 0x48, 0x59, 0x8b, 0xff, 0x3c, 0x5e, 0x96, 0xff, 0x36, 0x56, 0x8d, 0xff, 0x8d, 0x9d, 0xb7, 0xff, 0xe9, 0xf0, 0xf5, 0xff, 0xf1, 0xf6, 0xfd, 0xff, 0xee, 0xf7, 0xff, 0xff, 0xe9, 0xf1, 0xfd, 0xff, 0xd1, 0xc9, 0xc6, 0xff, 0xbf, 0xb2, 0x8f, 0xff, 0xaf, 0x9e, 0x5d, 0xff, 0xba, 0x9b, 0x63, 0xff, 0xbb, 0xa3, 0x6b, 0xff, 0xb8, 0xa2, 0x69, 0xff, 0xb7, 0xa2, 0x67, 0xff, 0xbb, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xba, 0xa1, 0x68, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x9b, 0x63, 0xb4, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb6, 0x9d, 0x64, 0xff, 0xb5, 0x9e, 0x64, 0xff, 0xb7, 0xa0, 0x66, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9e, 0x64, 0xff, 0xb7, 0xa0, 0x67, 0xff, 0xb7, 0xa0, 0x6a, 0xff, 0xb6, 0x9f, 0x66, 0xff, 0xb7, 0xa1, 0x64, 0xff, 0xb1, 0x9d, 0x5a, 0xff, 0xb3, 0x9b, 0x5b, 0xff, 0xd6, 0xc0, 0x93, 0xff, 0x78, 0x79, 0x89, 0xff, 0x1a, 0x2f, 0x5b, 0xff, 0x1f, 0x32, 0x52, 0xff, 0x1f, 0x31, 0x50, 0xff, 0x19, 0x2d, 0x4c, 0xff, 0x1a, 0x2f, 0x4a, 0xff, 0x1c, 0x2d, 0x49, 0xff, 0x17, 0x25, 0x3f, 0xff, 0x12, 0x1f, 0x35, 0xff, 0x0d, 0x1a, 0x30, 0xff, 0x07, 0x13, 0x2a, 0xff, 0x03, 0x10, 0x26, 0xff, 0x05, 0x12, 0x29, 0xff, 0x09, 0x16, 0x2d, 0xff, 0x09, 0x16, 0x2c, 0xff, 0x0a, 0x18, 0x30, 0xff, 0x0e, 0x1c, 0x39, 0xff, 0x10, 0x21, 0x3f, 0xff, 0x13, 0x26, 0x48, 0xff, 0x18, 0x2f, 0x53, 0xff, 0x1b, 0x34, 0x5a, 0xff, 0x1f, 0x39, 0x63, 0xff, 0x26, 0x3c, 0x6a, 0xff, 0x29, 0x3d, 0x6c, 0xff, 0x27, 0x3c, 0x6a, 0xff, 0x2d, 0x41, 0x6f, 0xff, 0x33, 0x48, 0x7a, 0xff, 0x3a, 0x4e, 0x83, 0xff, 0x40, 0x5a, 0x8b, 0xff, 0x35, 0x50, 0x92, 0xff, 0x2d, 0x44, 0x80, 0xff, 0x98, 0xa5, 0xc1, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf3, 0xf5, 0xf8, 0xff, 0xec, 0xec, 0xef, 0xff, 0xe7, 0xee, 0xed, 0xff, 0xea, 0xf0, 0xf7, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xf8, 0xfc, 0xff, 0xff, 0xd2, 0xc8, 0xb6, 0xff, 0xb1, 0x94, 0x60, 0xff, 0xbd, 0x9b, 0x5e, 0xff, 0xbb, 0xa2, 0x6a, 0xff, 0xb8, 0xa4, 0x69, 0xff, 0xbb, 0xa1, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x9c, 0x62, 0x27, 0xb6, 0x9c, 0x62, 0xfa, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb6, 0x9d, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb7, 0xa1, 0x67, 0xff, 0xb7, 0xa1, 0x65, 0xff, 0xb2, 0x98, 0x5b, 0xff, 0xab, 0x90, 0x55, 0xff, 0xaf, 0x9b, 0x56, 0xff, 0xce, 0xc4, 0x95, 0xff, 0xb6, 0xaf, 0xd9, 0xff, 0x51, 0x5e, 0x90, 0xff, 0x1f, 0x40, 0x54, 0xff, 0x1d, 0x33, 0x59, 0xff, 0x1d, 0x2e, 0x55, 0xff, 0x18, 0x2c, 0x4b, 0xff, 0x15, 0x2c, 0x48, 0xff, 0x19, 0x2b, 0x48, 0xff, 0x1b, 0x29, 0x45, 0xff, 0x1a, 0x27, 0x3f, 0xff, 0x16, 0x23, 0x3b, 0xff, 0x10, 0x1e, 0x36, 0xff, 0x0d, 0x1a, 0x33, 0xff, 0x0c, 0x19, 0x31, 0xff, 0x0b, 0x18, 0x30, 0xff, 0x0c, 0x19, 0x30, 0xff, 0x0b, 0x19, 0x32, 0xff, 0x0b, 0x1b, 0x3a, 0xff, 0x0e, 0x21, 0x42, 0xff, 0x11, 0x24, 0x48, 0xff, 0x15, 0x29, 0x4f, 0xff, 0x1a, 0x31, 0x5a, 0xff, 0x21, 0x39, 0x65, 0xff, 0x28, 0x3e, 0x6e, 0xff, 0x2d, 0x41, 0x71, 0xff, 0x2f, 0x43, 0x73, 0xff, 0x33, 0x47, 0x77, 0xff, 0x3a, 0x4f, 0x81, 0xff, 0x41, 0x58, 0x8c, 0xff, 0x2d, 0x52, 0x8d, 0xff, 0x34, 0x52, 0x90, 0xff, 0xa0, 0xac, 0xd0, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xf4, 0xf8, 0xf3, 0xff, 0xef, 0xee, 0xed, 0xff, 0xf0, 0xed, 0xf1, 0xff, 0xf1, 0xf1, 0xf6, 0xff, 0xf2, 0xf1, 0xf6, 0xff, 0xf1, 0xf5, 0xf3, 0xff, 0xed, 0xf3, 0xff, 0xff, 0xf6, 0xf2, 0xff, 0xff, 0xc3, 0xbd, 0x98, 0xff, 0xab, 0x91, 0x4c, 0xff, 0xc0, 0xa0, 0x61, 0xff, 0xbd, 0xa0, 0x68, 0xff, 0xbb, 0xa0, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa2, 0x69, 0xfa, 0xbf, 0x9f, 0x66, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x9b, 0x63, 0x88, 0xb7, 0x9c, 0x63, 0xff, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb6, 0x9d, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb5, 0x9f, 0x66, 0xff, 0xb5, 0xa0, 0x66, 0xff, 0xb6, 0x9d, 0x58, 0xff, 0xb1, 0x97, 0x55, 0xff, 0xb8, 0xa7, 0x7d, 0xff, 0xc6, 0xbb, 0xa3, 0xff, 0xec, 0xe3, 0xd4, 0xff, 0xb9, 0xbf, 0xce, 0xff, 0x47, 0x62, 0x8d, 0xff, 0x38, 0x55, 0x7d, 0xff, 0x2b, 0x40, 0x60, 0xff, 0x25, 0x34, 0x5c, 0xff, 0x21, 0x31, 0x59, 0xff, 0x1d, 0x2f, 0x53, 0xff, 0x17, 0x2a, 0x4b, 0xff, 0x13, 0x27, 0x47, 0xff, 0x14, 0x26, 0x44, 0xff, 0x17, 0x26, 0x42, 0xff, 0x14, 0x23, 0x3d, 0xff, 0x0e, 0x1f, 0x39, 0xff, 0x0e, 0x1e, 0x38, 0xff, 0x0d, 0x1e, 0x38, 0xff, 0x0b, 0x1c, 0x37, 0xff, 0x0b, 0x1b, 0x35, 0xff, 0x09, 0x1a, 0x36, 0xff, 0x09, 0x1c, 0x3e, 0xff, 0x0d, 0x22, 0x46, 0xff, 0x11, 0x26, 0x4d, 0xff, 0x19, 0x2c, 0x56, 0xff, 0x1d, 0x33, 0x5f, 0xff, 0x21, 0x39, 0x68, 0xff, 0x2a, 0x42, 0x74, 0xff, 0x30, 0x47, 0x78, 0xff, 0x31, 0x49, 0x7a, 0xff, 0x37, 0x4e, 0x7d, 0xff, 0x3b, 0x54, 0x86, 0xff, 0x2a, 0x49, 0x82, 0xff, 0x40, 0x5d, 0x97, 0xff, 0xb6, 0xc2, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf6, 0xee, 0xff, 0xec, 0xed, 0xef, 0xff, 0xed, 0xed, 0xf5, 0xff, 0xf0, 0xf1, 0xf4, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf4, 0xf7, 0xff, 0xf1, 0xef, 0xf4, 0xff, 0xf2, 0xee, 0xf7, 0xff, 0xec, 0xf2, 0xfa, 0xff, 0xe5, 0xeb, 0xec, 0xff, 0xb9, 0xac, 0x85, 0xff, 0xb1, 0x92, 0x4e, 0xff, 0xba, 0xa0, 0x61, 0xff, 0xbb, 0xa2, 0x6b, 0xff, 0xbc, 0xa0, 0x68, 0xff, 0xbc, 0xa1, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa1, 0x68, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x55, 0x09, 0xb6, 0x9c, 0x62, 0xdb, 0xb7, 0x9c, 0x63, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb6, 0x9d, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb5, 0xa0, 0x65, 0xff, 0xb6, 0x9d, 0x65, 0xff, 0xb5, 0xa0, 0x68, 0xff, 0xaf, 0x95, 0x58, 0xff, 0xb4, 0x95, 0x60, 0xff, 0xce, 0xc3, 0xb0, 0xff, 0xe6, 0xe8, 0xf0, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf1, 0xf0, 0xff, 0xff, 0x5d, 0x69, 0x95, 0xff, 0x36, 0x55, 0x7d, 0xff, 0x45, 0x5e, 0x81, 0xff, 0x2f, 0x3d, 0x63, 0xff, 0x24, 0x37, 0x5a, 0xff, 0x20, 0x34, 0x58, 0xff, 0x1f, 0x32, 0x56, 0xff, 0x17, 0x2b, 0x4f, 0xff, 0x12, 0x26, 0x48, 0xff, 0x14, 0x25, 0x44, 0xff, 0x14, 0x23, 0x3e, 0xff, 0x13, 0x22, 0x3e, 0xff, 0x12, 0x20, 0x3e, 0xff, 0x0f, 0x1e, 0x3c, 0xff, 0x0f, 0x1e, 0x3a, 0xff, 0x0e, 0x1d, 0x39, 0xff, 0x0a, 0x1c, 0x39, 0xff, 0x0a, 0x1b, 0x3c, 0xff, 0x0f, 0x1e, 0x43, 0xff, 0x11, 0x24, 0x48, 0xff, 0x16, 0x29, 0x4f, 0xff, 0x1f, 0x30, 0x5a, 0xff, 0x24, 0x36, 0x63, 0xff, 0x27, 0x3c, 0x6a, 0xff, 0x29, 0x44, 0x74, 0xff, 0x2b, 0x48, 0x81, 0xff, 0x36, 0x4e, 0x87, 0xff, 0x2e, 0x4b, 0x84, 0xff, 0x20, 0x46, 0x7e, 0xff, 0x5a, 0x75, 0x9f, 0xff, 0xcd, 0xd2, 0xe7, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xf3, 0xf1, 0xf3, 0xff, 0xee, 0xef, 0xf0, 0xff, 0xed, 0xf0, 0xf2, 0xff, 0xee, 0xf1, 0xf7, 0xff, 0xf2, 0xf5, 0xf8, 0xff, 0xf6, 0xf7, 0xf9, 0xff, 0xf2, 0xf5, 0xf6, 0xff, 0xf1, 0xf0, 0xf5, 0xff, 0xf1, 0xef, 0xf3, 0xff, 0xea, 0xef, 0xee, 0xff, 0xf5, 0xf7, 0xff, 0xff, 0xef, 0xf1, 0xf1, 0xff, 0xba, 0xb2, 0x94, 0xff, 0xb0, 0x95, 0x52, 0xff, 0xb5, 0x9c, 0x57, 0xff, 0xbe, 0xa4, 0x6a, 0xff, 0xbf, 0x9f, 0x6b, 0xff, 0xba, 0x9e, 0x67, 0xff, 0xbb, 0xa1, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xdb, 0xc6, 0xaa, 0x71, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x9c, 0x62, 0x41, 0xb6, 0x9b, 0x63, 0xfe, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb6, 0x9d, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb5, 0xa0, 0x66, 0xff, 0xb3, 0x9f, 0x67, 0xff, 0xb5, 0x99, 0x51, 0xff, 0xb8, 0xa1, 0x70, 0xff, 0xd8, 0xd7, 0xd2, 0xff, 0xe5, 0xf2, 0xfe, 0xff, 0xe7, 0xf1, 0xfd, 0xff, 0xfa, 0xfa, 0xf9, 0xff, 0xc9, 0xcd, 0xd7, 0xff, 0x30, 0x41, 0x5d, 0xff, 0x46, 0x5d, 0x8e, 0xff, 0x4c, 0x61, 0x8e, 0xff, 0x34, 0x47, 0x67, 0xff, 0x1c, 0x36, 0x58, 0xff, 0x1a, 0x32, 0x58, 0xff, 0x1b, 0x31, 0x57, 0xff, 0x17, 0x2d, 0x54, 0xff, 0x15, 0x28, 0x4c, 0xff, 0x15, 0x26, 0x47, 0xff, 0x14, 0x23, 0x40, 0xff, 0x14, 0x22, 0x41, 0xff, 0x13, 0x21, 0x43, 0xff, 0x10, 0x1f, 0x40, 0xff, 0x11, 0x1f, 0x3e, 0xff, 0x0f, 0x1f, 0x3c, 0xff, 0x0a, 0x1e, 0x3f, 0xff, 0x0d, 0x1e, 0x44, 0xff, 0x14, 0x22, 0x4a, 0xff, 0x14, 0x27, 0x4d, 0xff, 0x1a, 0x2d, 0x53, 0xff, 0x23, 0x34, 0x5e, 0xff, 0x22, 0x35, 0x63, 0xff, 0x26, 0x3b, 0x69, 0xff, 0x2e, 0x47, 0x76, 0xff, 0x26, 0x46, 0x81, 0xff, 0x29, 0x45, 0x82, 0xff, 0x4d, 0x64, 0x96, 0xff, 0x8e, 0xa7, 0xc8, 0xff, 0xe8, 0xeb, 0xf3, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xec, 0xeb, 0xf1, 0xff, 0xed, 0xed, 0xf6, 0xff, 0xf1, 0xf1, 0xf6, 0xff, 0xf2, 0xf5, 0xf4, 0xff, 0xf4, 0xf6, 0xf5, 0xff, 0xf6, 0xf8, 0xf8, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf0, 0xf2, 0xf3, 0xff, 0xf2, 0xf5, 0xf6, 0xff, 0xee, 0xf0, 0xf4, 0xff, 0xed, 0xed, 0xf2, 0xff, 0xf2, 0xf2, 0xf5, 0xff, 0xf9, 0xfa, 0xff, 0xff, 0xef, 0xf3, 0xfe, 0xff, 0xd2, 0xc7, 0xb4, 0xff, 0xb5, 0x9c, 0x62, 0xff, 0xae, 0x98, 0x55, 0xff, 0xba, 0xa6, 0x5e, 0xff, 0xbc, 0xa3, 0x66, 0xff, 0xbc, 0x9f, 0x69, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x68, 0xfe, 0xbc, 0xa0, 0x69, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x9b, 0x63, 0x8f, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xb9, 0x9d, 0x64, 0xff, 0xba, 0x9c, 0x64, 0xff, 0xb6, 0x9c, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb5, 0x9e, 0x65, 0xff, 0xb7, 0xa1, 0x67, 0xff, 0xb3, 0x9e, 0x64, 0xff, 0xb7, 0x9f, 0x65, 0xff, 0xa8, 0x97, 0x51, 0xff, 0xad, 0x9a, 0x62, 0xff, 0xe5, 0xda, 0xd7, 0xff, 0xea, 0xf0, 0xff, 0xff, 0xe1, 0xe4, 0xf1, 0xff, 0xea, 0xed, 0xef, 0xff, 0xfa, 0xfc, 0xfe, 0xff, 0xc6, 0xcc, 0xdd, 0xff, 0x29, 0x3c, 0x61, 0xff, 0x35, 0x50, 0x82, 0xff, 0x48, 0x5f, 0x8b, 0xff, 0x3a, 0x4f, 0x70, 0xff, 0x23, 0x3e, 0x64, 0xff, 0x17, 0x30, 0x5b, 0xff, 0x1d, 0x35, 0x5f, 0xff, 0x1e, 0x37, 0x61, 0xff, 0x18, 0x2f, 0x55, 0xff, 0x13, 0x27, 0x4a, 0xff, 0x13, 0x25, 0x44, 0xff, 0x13, 0x25, 0x45, 0xff, 0x12, 0x23, 0x46, 0xff, 0x13, 0x24, 0x47, 0xff, 0x14, 0x24, 0x45, 0xff, 0x12, 0x24, 0x43, 0xff, 0x0f, 0x24, 0x47, 0xff, 0x13, 0x26, 0x4c, 0xff, 0x1d, 0x2a, 0x55, 0xff, 0x1a, 0x2e, 0x56, 0xff, 0x1b, 0x30, 0x5a, 0xff, 0x23, 0x35, 0x63, 0xff, 0x21, 0x37, 0x67, 0xff, 0x1f, 0x38, 0x6d, 0xff, 0x24, 0x40, 0x79, 0xff, 0x3d, 0x58, 0x89, 0xff, 0x8b, 0x9b, 0xb8, 0xff, 0xde, 0xdf, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf9, 0xf6, 0xff, 0xeb, 0xeb, 0xed, 0xff, 0xf0, 0xf2, 0xf4, 0xff, 0xf3, 0xf5, 0xf7, 0xff, 0xf0, 0xf2, 0xf3, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf1, 0xf3, 0xf4, 0xff, 0xee, 0xf1, 0xf1, 0xff, 0xf1, 0xf3, 0xf3, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf1, 0xf2, 0xf7, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xeb, 0xec, 0xf1, 0xff, 0xf0, 0xf0, 0xf8, 0xff, 0xf4, 0xf6, 0xff, 0xff, 0xf5, 0xfa, 0xff, 0xff, 0xe4, 0xde, 0xd9, 0xff, 0xb2, 0xa4, 0x7f, 0xff, 0xa7, 0x95, 0x50, 0xff, 0xbb, 0x9f, 0x5d, 0xff, 0xbf, 0xa0, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbe, 0xa2, 0x69, 0xff, 0xbd, 0xa0, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xbb, 0xa1, 0x68, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x91, 0x6d, 0x07, 0xb8, 0x9d, 0x64, 0xd1, 0xb9, 0x9e, 0x65, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb6, 0x9e, 0x64, 0xff, 0xb6, 0x9e, 0x64, 0xff, 0xb6, 0x9e, 0x64, 0xff, 0xb6, 0x9e, 0x64, 0xff, 0xb6, 0x9e, 0x64, 0xff, 0xb7, 0x9f, 0x65, 0xff, 0xb6, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x63, 0xff, 0xb6, 0x9e, 0x65, 0xff, 0xb2, 0xa1, 0x64, 0xff, 0xb2, 0x9f, 0x66, 0xff, 0xb6, 0x9c, 0x5e, 0xff, 0xa7, 0x92, 0x4d, 0xff, 0xaf, 0xa2, 0x6b, 0xff, 0xe0, 0xdb, 0xd4, 0xff, 0xf0, 0xee, 0xff, 0xff, 0xe6, 0xe2, 0xeb, 0xff, 0xed, 0xeb, 0xee, 0xff, 0xf0, 0xf0, 0xf2, 0xff, 0xec, 0xef, 0xf4, 0xff, 0xef, 0xf0, 0xfa, 0xff, 0x5d, 0x69, 0x88, 0xff, 0x11, 0x30, 0x67, 0xff, 0x44, 0x62, 0x94, 0xff, 0x40, 0x59, 0x84, 0xff, 0x38, 0x4f, 0x75, 0xff, 0x27, 0x3e, 0x65, 0xff, 0x24, 0x3a, 0x62, 0xff, 0x2b, 0x3f, 0x67, 0xff, 0x24, 0x39, 0x61, 0xff, 0x1d, 0x30, 0x58, 0xff, 0x19, 0x2c, 0x52, 0xff, 0x18, 0x2b, 0x51, 0xff, 0x18, 0x2c, 0x52, 0xff, 0x17, 0x29, 0x50, 0xff, 0x13, 0x29, 0x4f, 0xff, 0x12, 0x2a, 0x50, 0xff, 0x17, 0x2b, 0x51, 0xff, 0x1b, 0x2e, 0x5a, 0xff, 0x1d, 0x32, 0x65, 0xff, 0x20, 0x38, 0x64, 0xff, 0x23, 0x3f, 0x6b, 0xff, 0x1a, 0x38, 0x6d, 0xff, 0x19, 0x37, 0x6a, 0xff, 0x3d, 0x59, 0x8b, 0xff, 0x7f, 0x90, 0xb8, 0xff, 0xc7, 0xcf, 0xe5, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xf3, 0xf1, 0xef, 0xff, 0xec, 0xef, 0xf3, 0xff, 0xf0, 0xf3, 0xf7, 0xff, 0xf4, 0xf6, 0xf5, 0xff, 0xf4, 0xf7, 0xf7, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf1, 0xf3, 0xf4, 0xff, 0xee, 0xf0, 0xf2, 0xff, 0xf0, 0xf2, 0xf4, 0xff, 0xf2, 0xf4, 0xf7, 0xff, 0xf3, 0xf4, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xee, 0xf0, 0xf3, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf4, 0xf8, 0xfd, 0xff, 0xf6, 0xfd, 0xff, 0xff, 0xf9, 0xf4, 0xfa, 0xff, 0xd0, 0xc5, 0xad, 0xff, 0xb0, 0x9e, 0x6c, 0xff, 0xaf, 0x92, 0x55, 0xff, 0xbc, 0x9c, 0x62, 0xff, 0xba, 0xa3, 0x69, 0xff, 0xb6, 0xa4, 0x63, 0xff, 0xb6, 0xa1, 0x68, 0xff, 0xbb, 0xa1, 0x6d, 0xff, 0xbe, 0xa3, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0xa0, 0x67, 0xff, 0xba, 0x9f, 0x66, 0xd1, 0xbf, 0x9f, 0x5f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x9d, 0x61, 0x2a, 0xb8, 0x9e, 0x64, 0xf3, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb3, 0x9e, 0x64, 0xff, 0xb3, 0x9e, 0x64, 0xff, 0xb3, 0x9e, 0x64, 0xff, 0xb3, 0x9e, 0x64, 0xff, 0xb5, 0xa1, 0x66, 0xff, 0xb6, 0xa1, 0x66, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb1, 0x9d, 0x65, 0xff, 0xbc, 0x9f, 0x62, 0xff, 0xb9, 0xa1, 0x5b, 0xff, 0xa8, 0x93, 0x4d, 0xff, 0xa9, 0x90, 0x59, 0xff, 0xc7, 0xb4, 0x97, 0xff, 0xf3, 0xec, 0xeb, 0xff, 0xf1, 0xf4, 0xff, 0xff, 0xdf, 0xe8, 0xee, 0xff, 0xe6, 0xeb, 0xe8, 0xff, 0xed, 0xed, 0xf2, 0xff, 0xf1, 0xf1, 0xf6, 0xff, 0xe9, 0xea, 0xed, 0xff, 0xf5, 0xf4, 0xef, 0xff, 0xd7, 0xdc, 0xe5, 0xff, 0x4c, 0x64, 0x8e, 0xff, 0x1e, 0x3e, 0x7a, 0xff, 0x32, 0x53, 0x94, 0xff, 0x45, 0x60, 0x97, 0xff, 0x3b, 0x58, 0x80, 0xff, 0x27, 0x43, 0x6b, 0xff, 0x33, 0x4b, 0x74, 0xff, 0x35, 0x4b, 0x76, 0xff, 0x27, 0x3d, 0x6a, 0xff, 0x20, 0x37, 0x64, 0xff, 0x1e, 0x34, 0x60, 0xff, 0x1f, 0x36, 0x60, 0xff, 0x1d, 0x34, 0x5f, 0xff, 0x1e, 0x34, 0x5c, 0xff, 0x1b, 0x32, 0x58, 0xff, 0x23, 0x38, 0x67, 0xff, 0x26, 0x41, 0x73, 0xff, 0x1a, 0x3c, 0x72, 0xff, 0x18, 0x32, 0x6e, 0xff, 0x25, 0x3d, 0x79, 0xff, 0x4a, 0x63, 0x90, 0xff, 0x89, 0x98, 0xb9, 0xff, 0xcd, 0xd1, 0xe5, 0xff, 0xff, 0xf9, 0xfc, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xef, 0xed, 0xef, 0xff, 0xec, 0xee, 0xf2, 0xff, 0xef, 0xf0, 0xf6, 0xff, 0xf2, 0xf2, 0xf7, 0xff, 0xf3, 0xf4, 0xf5, 0xff, 0xf3, 0xf5, 0xf5, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf0, 0xf2, 0xf3, 0xff, 0xef, 0xf0, 0xf2, 0xff, 0xf2, 0xf2, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf2, 0xf3, 0xf8, 0xff, 0xf2, 0xf4, 0xf7, 0xff, 0xef, 0xf1, 0xf2, 0xff, 0xef, 0xf2, 0xf2, 0xff, 0xef, 0xf2, 0xef, 0xff, 0xef, 0xf5, 0xf1, 0xff, 0xfb, 0xf7, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xeb, 0xec, 0xe1, 0xff, 0xc7, 0xbc, 0x97, 0xff, 0xae, 0x9a, 0x62, 0xff, 0xa9, 0x90, 0x54, 0xff, 0xb7, 0x9c, 0x5b, 0xff, 0xc3, 0xa4, 0x65, 0xff, 0xc0, 0xa0, 0x69, 0xff, 0xba, 0xa0, 0x67, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x69, 0xff, 0xbc, 0xa1, 0x68, 0xff, 0xbb, 0x9f, 0x67, 0xf4, 0xbc, 0x9d, 0x67, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x9f, 0x66, 0x55, 0xb7, 0x9c, 0x64, 0xfe, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb5, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0xa0, 0x65, 0xff, 0xb6, 0xa0, 0x65, 0xff, 0xb5, 0x9e, 0x66, 0xff, 0xb5, 0x9f, 0x66, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x66, 0xff, 0xb5, 0xa0, 0x67, 0xff, 0xb4, 0x9e, 0x61, 0xff, 0xb3, 0x98, 0x50, 0xff, 0xad, 0x91, 0x55, 0xff, 0xb6, 0xa7, 0x7f, 0xff, 0xda, 0xd9, 0xcd, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf5, 0xf4, 0xff, 0xff, 0xe3, 0xec, 0xf2, 0xff, 0xe3, 0xec, 0xef, 0xff, 0xe9, 0xeb, 0xed, 0xff, 0xf0, 0xf0, 0xf4, 0xff, 0xf1, 0xf1, 0xf6, 0xff, 0xe9, 0xec, 0xed, 0xff, 0xe1, 0xe6, 0xe4, 0xff, 0xf5, 0xf8, 0xf6, 0xff, 0xe6, 0xe8, 0xed, 0xff, 0x8a, 0x96, 0xb5, 0xff, 0x42, 0x62, 0x98, 0xff, 0x31, 0x58, 0x96, 0xff, 0x30, 0x56, 0x8f, 0xff, 0x31, 0x52, 0x89, 0xff, 0x3b, 0x57, 0x8d, 0xff, 0x41, 0x5a, 0x8e, 0xff, 0x38, 0x53, 0x85, 0xff, 0x33, 0x4d, 0x80, 0xff, 0x2d, 0x47, 0x78, 0xff, 0x2a, 0x45, 0x75, 0xff, 0x2a, 0x46, 0x77, 0xff, 0x23, 0x3f, 0x74, 0xff, 0x19, 0x36, 0x70, 0xff, 0x16, 0x3d, 0x78, 0xff, 0x2a, 0x4f, 0x88, 0xff, 0x4c, 0x66, 0x94, 0xff, 0x73, 0x88, 0xa8, 0xff, 0xa9, 0xb7, 0xc8, 0xff, 0xe2, 0xe6, 0xea, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xf9, 0xf3, 0xff, 0xf7, 0xf0, 0xef, 0xff, 0xf1, 0xef, 0xf2, 0xff, 0xea, 0xf0, 0xf4, 0xff, 0xf0, 0xf2, 0xf6, 0xff, 0xf3, 0xf3, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf6, 0xff, 0xf2, 0xf5, 0xf5, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf1, 0xf3, 0xf4, 0xff, 0xf0, 0xf1, 0xf3, 0xff, 0xf2, 0xf3, 0xf8, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf4, 0xf4, 0xf9, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf1, 0xf3, 0xf4, 0xff, 0xef, 0xf1, 0xf1, 0xff, 0xee, 0xee, 0xf4, 0xff, 0xf4, 0xf2, 0xfe, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xe4, 0xe0, 0xdf, 0xff, 0xd0, 0xc2, 0xa6, 0xff, 0xbd, 0xa6, 0x7b, 0xff, 0xad, 0x95, 0x53, 0xff, 0xb2, 0x96, 0x4b, 0xff, 0xbb, 0x9c, 0x60, 0xff, 0xbe, 0xa2, 0x68, 0xff, 0xbc, 0xa1, 0x69, 0xff, 0xbb, 0xa1, 0x68, 0xff, 0xbd, 0xa2, 0x68, 0xff, 0xbe, 0xa1, 0x67, 0xff, 0xbe, 0xa2, 0x69, 0xff, 0xbd, 0xa1, 0x68, 0xff, 0xba, 0xa0, 0x67, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x9d, 0x63, 0x8d, 0xb8, 0x9d, 0x64, 0xff, 0xb8, 0x9d, 0x64, 0xff, 0xb5, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb6, 0x9e, 0x64, 0xff, 0xb4, 0x9c, 0x66, 0xff, 0xb1, 0x9d, 0x66, 0xff, 0xb3, 0xa3, 0x61, 0xff, 0xb4, 0xa1, 0x63, 0xff, 0xb8, 0x9f, 0x63, 0xff, 0xb5, 0x9c, 0x5a, 0xff, 0xac, 0x90, 0x52, 0xff, 0xac, 0x92, 0x56, 0xff, 0xb4, 0xa5, 0x72, 0xff, 0xce, 0xcc, 0xb3, 0xff, 0xf2, 0xf6, 0xfa, 0xff, 0xf5, 0xfe, 0xff, 0xff, 0xeb, 0xf6, 0xfb, 0xff, 0xec, 0xef, 0xf0, 0xff, 0xe9, 0xed, 0xed, 0xff, 0xed, 0xee, 0xf0, 0xff, 0xef, 0xed, 0xf3, 0xff, 0xf0, 0xf2, 0xf5, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xed, 0xef, 0xf2, 0xff, 0xe4, 0xe7, 0xec, 0xff, 0xe3, 0xe3, 0xe6, 0xff, 0xfc, 0xf5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0xd3, 0xe8, 0xff, 0x8a, 0x9e, 0xc1, 0xff, 0x5e, 0x78, 0xaa, 0xff, 0x44, 0x60, 0x9a, 0xff, 0x39, 0x57, 0x96, 0xff, 0x36, 0x58, 0x96, 0xff, 0x33, 0x57, 0x94, 0xff, 0x30, 0x53, 0x90, 0xff, 0x25, 0x4b, 0x88, 0xff, 0x23, 0x4a, 0x83, 0xff, 0x29, 0x4c, 0x81, 0xff, 0x35, 0x53, 0x87, 0xff, 0x5b, 0x71, 0x9e, 0xff, 0x84, 0x95, 0xb6, 0xff, 0xb2, 0xbc, 0xcd, 0xff, 0xe1, 0xe1, 0xe6, 0xff, 0xfb, 0xf6, 0xf9, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xf8, 0xf5, 0xf7, 0xff, 0xec, 0xec, 0xf2, 0xff, 0xea, 0xed, 0xf5, 0xff, 0xed, 0xf0, 0xf7, 0xff, 0xf1, 0xf4, 0xf9, 0xff, 0xf0, 0xf4, 0xf7, 0xff, 0xf4, 0xf6, 0xfa, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf3, 0xf5, 0xf7, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf1, 0xf3, 0xf5, 0xff, 0xf2, 0xf3, 0xf5, 0xff, 0xf3, 0xf6, 0xf6, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf3, 0xf4, 0xf6, 0xff, 0xf4, 0xf5, 0xf8, 0xff, 0xf4, 0xf6, 0xf8, 0xff, 0xf4, 0xf5, 0xf8, 0xff, 0xf4, 0xf5, 0xf8, 0xff, 0xf4, 0xf5, 0xf8, 0xff, 0xf4, 0xf6, 0xf8, 0xff, 0xf4, 0xf6, 0xf8, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf5, 0xf6, 0xf8, 0xff, 0xf0, 0xf3, 0xf2, 0xff, 0xee, 0xf3, 0xf3, 0xff, 0xf0, 0xf0, 0xf2, 0xff, 0xf0, 0xf3, 0xfc, 0xff, 0xf8, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xf2, 0xee, 0xff, 0xd9, 0xd5, 0xc7, 0xff, 0xc4, 0xb9, 0x91, 0xff, 0xb6, 0x9d, 0x66, 0xff, 0xab, 0x92, 0x50, 0xff, 0xba, 0x9d, 0x59, 0xff, 0xc1, 0xa3, 0x6a, 0xff, 0xb8, 0x9f, 0x68, 0xff, 0xb7, 0xa1, 0x6b, 0xff, 0xbc, 0xa3, 0x69, 0xff, 0xba, 0xa0, 0x68, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x55, 0x03, 0xb8, 0x9d, 0x63, 0xb1, 0xb9, 0x9e, 0x65, 0xff, 0xb5, 0x9e, 0x64, 0xff, 0xb3, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb3, 0x9f, 0x65, 0xff, 0xb5, 0x9e, 0x63, 0xff, 0xbb, 0x9b, 0x67, 0xff, 0xbf, 0x9e, 0x69, 0xff, 0xba, 0xa1, 0x5d, 0xff, 0xb0, 0x97, 0x56, 0xff, 0xa9, 0x95, 0x50, 0xff, 0xac, 0x9e, 0x5f, 0xff, 0xc0, 0xb1, 0x89, 0xff, 0xdd, 0xd0, 0xc5, 0xff, 0xf3, 0xed, 0xf6, 0xff, 0xf7, 0xfd, 0xff, 0xff, 0xf2, 0xf7, 0xfa, 0xff, 0xf1, 0xf2, 0xf2, 0xff, 0xf3, 0xf4, 0xf4, 0xff, 0xf0, 0xf2, 0xf4, 0xff, 0xed, 0xed, 0xf3, 0xff, 0xeb, 0xec, 0xf0, 0xff, 0xed, 0xef, 0xf2, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xea, 0xeb, 0xef, 0xff, 0xe4, 0xe5, 0xeb, 0xff, 0xe9, 0xea, 0xed, 0xff, 0xef, 0xf0, 0xed, 0xff, 0xf6, 0xf6, 0xf7, 0xff, 0xf7, 0xf7, 0xfd, 0xff, 0xe8, 0xe5, 0xf0, 0xff, 0xcd, 0xcf, 0xdf, 0xff, 0xba, 0xc2, 0xd7, 0xff, 0xa0, 0xb0, 0xcc, 0xff, 0x93, 0xa4, 0xc3, 0xff, 0x8b, 0x9b, 0xb9, 0xff, 0x87, 0x99, 0xbb, 0xff, 0x97, 0xa6, 0xc3, 0xff, 0xb3, 0xb8, 0xcb, 0xff, 0xcf, 0xd0, 0xda, 0xff, 0xec, 0xeb, 0xee, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0xff, 0xfa, 0xf6, 0xff, 0xf3, 0xf2, 0xf3, 0xff, 0xee, 0xee, 0xf1, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xed, 0xee, 0xf3, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf2, 0xf3, 0xf6, 0xff, 0xf3, 0xf3, 0xf7, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf1, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf5, 0xff, 0xf2, 0xf4, 0xf4, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf3, 0xf5, 0xf5, 0xff, 0xf2, 0xf5, 0xf5, 0xff, 0xf3, 0xf5, 0xf5, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf6, 0xff, 0xf5, 0xf8, 0xf8, 0xff, 0xf5, 0xf8, 0xf7, 0xff, 0xf4, 0xf6, 0xf5, 0xff, 0xee, 0xf3, 0xf5, 0xff, 0xf4, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xea, 0xe6, 0xe0, 0xff, 0xcf, 0xc5, 0xad, 0xff, 0xb5, 0x9d, 0x6e, 0xff, 0xb3, 0x91, 0x52, 0xff, 0xb7, 0x9e, 0x5f, 0xff, 0xb6, 0xa4, 0x65, 0xff, 0xb8, 0xa2, 0x69, 0xb1, 0xaa, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x99, 0x66, 0x0a, 0xb8, 0x9e, 0x64, 0xc8, 0xb5, 0x9e, 0x64, 0xff, 0xb2, 0x9e, 0x64, 0xff, 0xb3, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb6, 0xa0, 0x66, 0xff, 0xb4, 0x9f, 0x65, 0xff, 0xb5, 0xa0, 0x66, 0xff, 0xb4, 0x9f, 0x66, 0xff, 0xb1, 0x9f, 0x64, 0xff, 0xb8, 0xa1, 0x67, 0xff, 0xbb, 0x9d, 0x5d, 0xff, 0xb2, 0x94, 0x4e, 0xff, 0xad, 0x92, 0x5a, 0xff, 0xba, 0xa6, 0x77, 0xff, 0xce, 0xc5, 0xac, 0xff, 0xe4, 0xe0, 0xdd, 0xff, 0xf5, 0xf9, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf3, 0xf5, 0xff, 0xff, 0xf2, 0xf1, 0xf4, 0xff, 0xf1, 0xf2, 0xf1, 0xff, 0xf1, 0xf3, 0xf4, 0xff, 0xf0, 0xf2, 0xf3, 0xff, 0xef, 0xf0, 0xf3, 0xff, 0xed, 0xed, 0xf2, 0xff, 0xea, 0xeb, 0xef, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xeb, 0xec, 0xf0, 0xff, 0xe8, 0xe9, 0xee, 0xff, 0xe8, 0xe9, 0xf1, 0xff, 0xea, 0xe8, 0xf1, 0xff, 0xed, 0xe9, 0xf2, 0xff, 0xef, 0xed, 0xf3, 0xff, 0xfa, 0xf5, 0xf8, 0xff, 0xff, 0xf9, 0xf8, 0xff, 0xf9, 0xf7, 0xfb, 0xff, 0xf3, 0xf4, 0xfa, 0xff, 0xf3, 0xf3, 0xf9, 0xff, 0xf5, 0xf3, 0xfa, 0xff, 0xfc, 0xf7, 0xfc, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xf9, 0xf2, 0xf1, 0xff, 0xef, 0xf0, 0xf0, 0xff, 0xe8, 0xeb, 0xf1, 0xff, 0xe8, 0xeb, 0xf2, 0xff, 0xeb, 0xeb, 0xef, 0xff, 0xec, 0xed, 0xf1, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf3, 0xf3, 0xf8, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf2, 0xf4, 0xf6, 0xff, 0xf3, 0xf5, 0xf5, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf8, 0xfa, 0xfb, 0xff, 0xf7, 0xf9, 0xfb, 0xff, 0xf5, 0xf7, 0xf5, 0xff, 0xf2, 0xf6, 0xf2, 0xff, 0xee, 0xf2, 0xf3, 0xff, 0xed, 0xf3, 0xf8, 0xff, 0xf5, 0xfc, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xee, 0xee, 0xeb, 0xff, 0xc7, 0xb9, 0x97, 0xff, 0xaa, 0x95, 0x60, 0xff, 0xac, 0x92, 0x4f, 0xc8, 0xb2, 0x99, 0x66, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x9d, 0x61, 0x15, 0xb5, 0x9d, 0x63, 0xd7, 0xb4, 0x9e, 0x64, 0xff, 0xb5, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb4, 0x9e, 0x64, 0xff, 0xb5, 0x9f, 0x65, 0xff, 0xb6, 0xa0, 0x64, 0xff, 0xb7, 0xa0, 0x64, 0xff, 0xb4, 0x9e, 0x63, 0xff, 0xb3, 0x9f, 0x64, 0xff, 0xb8, 0x9e, 0x65, 0xff, 0xb2, 0x93, 0x59, 0xff, 0xaa, 0x95, 0x5b, 0xff, 0xbe, 0xb8, 0x94, 0xff, 0xdc, 0xd6, 0xce, 0xff, 0xf1, 0xf2, 0xf0, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xf1, 0xf7, 0xf8, 0xff, 0xf1, 0xf4, 0xf2, 0xff, 0xf1, 0xf1, 0xf6, 0xff, 0xf0, 0xf2, 0xf3, 0xff, 0xf3, 0xf5, 0xf5, 0xff, 0xf1, 0xf3, 0xf5, 0xff, 0xef, 0xf1, 0xf2, 0xff, 0xed, 0xef, 0xf2, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xec, 0xed, 0xf1, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf0, 0xf4, 0xff, 0xe7, 0xe8, 0xec, 0xff, 0xe6, 0xe8, 0xee, 0xff, 0xec, 0xea, 0xee, 0xff, 0xef, 0xea, 0xed, 0xff, 0xec, 0xec, 0xf1, 0xff, 0xe8, 0xea, 0xf1, 0xff, 0xe6, 0xe8, 0xf2, 0xff, 0xea, 0xec, 0xf2, 0xff, 0xea, 0xeb, 0xf0, 0xff, 0xea, 0xeb, 0xf1, 0xff, 0xe8, 0xeb, 0xf0, 0xff, 0xe8, 0xec, 0xf0, 0xff, 0xe8, 0xeb, 0xee, 0xff, 0xe7, 0xeb, 0xef, 0xff, 0xe8, 0xec, 0xf0, 0xff, 0xe9, 0xec, 0xee, 0xff, 0xed, 0xee, 0xf1, 0xff, 0xee, 0xef, 0xf4, 0xff, 0xef, 0xef, 0xf3, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf2, 0xf4, 0xf7, 0xff, 0xf3, 0xf4, 0xf7, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf3, 0xf4, 0xf6, 0xff, 0xf2, 0xf4, 0xf5, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf2, 0xf4, 0xf5, 0xff, 0xf2, 0xf4, 0xf5, 0xff, 0xf2, 0xf4, 0xf5, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf8, 0xfa, 0xfc, 0xff, 0xf9, 0xfa, 0xf9, 0xff, 0xf4, 0xf7, 0xf7, 0xff, 0xef, 0xf6, 0xf9, 0xff, 0xef, 0xf5, 0xf6, 0xff, 0xf0, 0xf3, 0xf4, 0xff, 0xee, 0xf3, 0xf9, 0xff, 0xf3, 0xfb, 0xff, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xe1, 0xe0, 0xd6, 0xd8, 0xce, 0xb6, 0x9d, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x9a, 0x64, 0x1c, 0xb8, 0x9c, 0x63, 0xdc, 0xb8, 0x9d, 0x64, 0xff, 0xb5, 0x9e, 0x64, 0xff, 0xb4, 0x9f, 0x64, 0xff, 0xb5, 0xa0, 0x65, 0xff, 0xb4, 0x9f, 0x66, 0xff, 0xbc, 0x9d, 0x6a, 0xff, 0xbb, 0x9a, 0x63, 0xff, 0xac, 0x96, 0x53, 0xff, 0xac, 0x94, 0x52, 0xff, 0xbb, 0xa5, 0x78, 0xff, 0xdb, 0xd7, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf9, 0xff, 0xff, 0xf0, 0xf3, 0xf7, 0xff, 0xf1, 0xf3, 0xf6, 0xff, 0xf0, 0xf1, 0xf4, 0xff, 0xf0, 0xf0, 0xf5, 0xff, 0xf1, 0xf1, 0xf6, 0xff, 0xf0, 0xf0, 0xf6, 0xff, 0xf0, 0xf1, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xee, 0xef, 0xf4, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xeb, 0xec, 0xf0, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xec, 0xee, 0xf0, 0xff, 0xeb, 0xed, 0xef, 0xff, 0xec, 0xed, 0xf0, 0xff, 0xef, 0xf0, 0xf2, 0xff, 0xed, 0xed, 0xf0, 0xff, 0xec, 0xed, 0xf1, 0xff, 0xed, 0xed, 0xf0, 0xff, 0xed, 0xed, 0xf0, 0xff, 0xec, 0xed, 0xf0, 0xff, 0xec, 0xed, 0xef, 0xff, 0xec, 0xed, 0xf0, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xeb, 0xec, 0xef, 0xff, 0xef, 0xef, 0xf2, 0xff, 0xf2, 0xf2, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf3, 0xf4, 0xf6, 0xff, 0xf4, 0xf6, 0xf6, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xfa, 0xff, 0xf7, 0xf8, 0xfb, 0xff, 0xf6, 0xf8, 0xfa, 0xff, 0xf7, 0xf8, 0xfa, 0xff, 0xf6, 0xf7, 0xf8, 0xff, 0xf4, 0xf5, 0xf7, 0xff, 0xf1, 0xf3, 0xf4, 0xff, 0xf0, 0xf3, 0xf5, 0xdd, 0xfe, 0xfe, 0xfe, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x9a, 0x64, 0x21, 0xb7, 0x9d, 0x63, 0xde, 0xb5, 0x9d, 0x64, 0xff, 0xb3, 0x9f, 0x64, 0xff, 0xb6, 0xa0, 0x67, 0xff, 0xb8, 0xa3, 0x69, 0xff, 0xb2, 0x9a, 0x57, 0xff, 0xac, 0x92, 0x51, 0xff, 0xb5, 0xa3, 0x78, 0xff, 0xd5, 0xd0, 0xba, 0xff, 0xf3, 0xf6, 0xf5, 0xff, 0xf9, 0xfd, 0xff, 0xff, 0xf3, 0xf2, 0xff, 0xff, 0xf2, 0xf4, 0xf7, 0xff, 0xf4, 0xf6, 0xf5, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf2, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xec, 0xed, 0xf1, 0xff, 0xea, 0xeb, 0xef, 0xff, 0xeb, 0xec, 0xf0, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xef, 0xef, 0xf3, 0xff, 0xee, 0xee, 0xf2, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xee, 0xee, 0xf2, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf7, 0xff, 0xf1, 0xf2, 0xf7, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xec, 0xed, 0xf1, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf0, 0xf0, 0xf5, 0xff, 0xf0, 0xf1, 0xf6, 0xff, 0xf3, 0xf4, 0xf6, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf3, 0xf5, 0xf6, 0xde, 0xef, 0xf7, 0xf7, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x9c, 0x62, 0x1a, 0xb5, 0xa0, 0x64, 0xd7, 0xb5, 0x9e, 0x67, 0xff, 0xb1, 0x9b, 0x5e, 0xff, 0xa7, 0x8f, 0x50, 0xff, 0xb1, 0x9c, 0x63, 0xff, 0xce, 0xc6, 0xa7, 0xff, 0xf5, 0xf2, 0xf7, 0xff, 0xfa, 0xfe, 0xff, 0xff, 0xf0, 0xfa, 0xff, 0xff, 0xf0, 0xf3, 0xfc, 0xff, 0xec, 0xf4, 0xf7, 0xff, 0xf3, 0xf8, 0xf4, 0xff, 0xf4, 0xf3, 0xf8, 0xff, 0xf5, 0xf5, 0xfa, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xec, 0xed, 0xf1, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xef, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xeb, 0xec, 0xf0, 0xff, 0xeb, 0xec, 0xf0, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf3, 0xf5, 0xf7, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf2, 0xf4, 0xf5, 0xff, 0xf2, 0xf4, 0xf5, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf6, 0xf7, 0xd7, 0xf5, 0xf5, 0xf5, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0xa2, 0x68, 0x16, 0xb7, 0x9c, 0x5f, 0xca, 0xab, 0x94, 0x56, 0xff, 0xbb, 0xb0, 0x89, 0xff, 0xe9, 0xe7, 0xe0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xff, 0xf2, 0xf5, 0xfa, 0xff, 0xf1, 0xf3, 0xf4, 0xff, 0xf4, 0xf5, 0xf6, 0xff, 0xf2, 0xf4, 0xf6, 0xff, 0xf2, 0xf4, 0xf6, 0xff, 0xf3, 0xf3, 0xf8, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xec, 0xed, 0xf1, 0xff, 0xed, 0xef, 0xf3, 0xff, 0xea, 0xed, 0xf1, 0xff, 0xe8, 0xeb, 0xef, 0xff, 0xe9, 0xeb, 0xef, 0xff, 0xec, 0xed, 0xf1, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xea, 0xeb, 0xef, 0xff, 0xe9, 0xea, 0xee, 0xff, 0xea, 0xea, 0xee, 0xff, 0xeb, 0xec, 0xf0, 0xff, 0xea, 0xed, 0xf1, 0xff, 0xeb, 0xee, 0xf2, 0xff, 0xed, 0xf0, 0xf4, 0xff, 0xec, 0xef, 0xf3, 0xff, 0xeb, 0xee, 0xf2, 0xff, 0xe9, 0xed, 0xf1, 0xff, 0xe9, 0xeb, 0xef, 0xff, 0xeb, 0xeb, 0xef, 0xff, 0xec, 0xed, 0xf1, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xec, 0xed, 0xf1, 0xff, 0xeb, 0xec, 0xf0, 0xff, 0xec, 0xed, 0xf1, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf2, 0xf4, 0xf5, 0xff, 0xf1, 0xf3, 0xf4, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf3, 0xf6, 0xf7, 0xca, 0xf3, 0xf3, 0xf3, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xa2, 0x45, 0x0b, 0xb9, 0xa7, 0x7d, 0xaf, 0xf9, 0xfb, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xef, 0xf0, 0xf6, 0xff, 0xf2, 0xf2, 0xf6, 0xff, 0xf3, 0xf4, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf2, 0xf2, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xec, 0xed, 0xf1, 0xff, 0xeb, 0xec, 0xf0, 0xff, 0xea, 0xec, 0xf0, 0xff, 0xe6, 0xe9, 0xed, 0xff, 0xe6, 0xea, 0xee, 0xff, 0xeb, 0xed, 0xf1, 0xff, 0xf1, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xeb, 0xeb, 0xef, 0xff, 0xe7, 0xe8, 0xec, 0xff, 0xe6, 0xe9, 0xed, 0xff, 0xe6, 0xea, 0xee, 0xff, 0xe7, 0xea, 0xee, 0xff, 0xe6, 0xe9, 0xed, 0xff, 0xe5, 0xe8, 0xec, 0xff, 0xe5, 0xe9, 0xed, 0xff, 0xe7, 0xe9, 0xed, 0xff, 0xeb, 0xec, 0xf0, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xec, 0xed, 0xf1, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf7, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf6, 0xf7, 0xf9, 0xb0, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0xaa, 0x03, 0xff, 0xff, 0xff, 0x8b, 0xf6, 0xf4, 0xfa, 0xff, 0xf4, 0xf2, 0xf2, 0xff, 0xeb, 0xef, 0xf4, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xec, 0xed, 0xf1, 0xff, 0xed, 0xef, 0xf3, 0xff, 0xea, 0xed, 0xf1, 0xff, 0xe8, 0xeb, 0xef, 0xff, 0xe9, 0xeb, 0xef, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xeb, 0xee, 0xf2, 0xff, 0xe9, 0xed, 0xf1, 0xff, 0xe9, 0xec, 0xf0, 0xff, 0xe7, 0xea, 0xee, 0xff, 0xe8, 0xeb, 0xef, 0xff, 0xea, 0xed, 0xf1, 0xff, 0xea, 0xec, 0xf0, 0xff, 0xeb, 0xeb, 0xef, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xec, 0xed, 0xf1, 0xff, 0xec, 0xed, 0xf1, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf6, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf5, 0xf7, 0xf7, 0x8b, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xf3, 0xf6, 0x57, 0xf2, 0xf3, 0xf3, 0xf3, 0xe8, 0xeb, 0xee, 0xff, 0xf0, 0xf1, 0xf6, 0xff, 0xf5, 0xf6, 0xfa, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xee, 0xf0, 0xf4, 0xff, 0xec, 0xf0, 0xf4, 0xff, 0xe9, 0xec, 0xf0, 0xff, 0xe8, 0xeb, 0xef, 0xff, 0xec, 0xec, 0xf0, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf0, 0xf2, 0xf6, 0xff, 0xee, 0xf0, 0xf4, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xed, 0xef, 0xf3, 0xff, 0xec, 0xed, 0xf1, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xec, 0xed, 0xf1, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf4, 0xf5, 0xf8, 0xff, 0xf3, 0xf4, 0xf6, 0xff, 0xf1, 0xf3, 0xf4, 0xff, 0xf0, 0xf2, 0xf4, 0xff, 0xf3, 0xf5, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xf3, 0xf6, 0xf9, 0xf9, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xed, 0xf3, 0x2b, 0xe9, 0xeb, 0xeb, 0xd2, 0xf1, 0xf1, 0xf6, 0xff, 0xf5, 0xf6, 0xfa, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xed, 0xef, 0xf3, 0xff, 0xec, 0xf0, 0xf4, 0xff, 0xea, 0xed, 0xf1, 0xff, 0xe9, 0xec, 0xf0, 0xff, 0xed, 0xed, 0xf1, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf2, 0xf2, 0xf6, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xee, 0xf0, 0xf1, 0xff, 0xf1, 0xf3, 0xf4, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf6, 0xf7, 0xd2, 0xf9, 0xf9, 0xf9, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xdf, 0xdf, 0x08, 0xf0, 0xf0, 0xf6, 0x8f, 0xf4, 0xf5, 0xf9, 0xfe, 0xf4, 0xf5, 0xf9, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf3, 0xf4, 0xf9, 0xff, 0xf3, 0xf3, 0xf8, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xed, 0xef, 0xf3, 0xff, 0xec, 0xf0, 0xf4, 0xff, 0xe9, 0xed, 0xf1, 0xff, 0xe9, 0xeb, 0xef, 0xff, 0xed, 0xed, 0xf1, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf4, 0xf5, 0xfa, 0xff, 0xf3, 0xf3, 0xf8, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf3, 0xf4, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xfe, 0xf4, 0xf7, 0xf7, 0x8f, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xf3, 0xf7, 0x42, 0xf3, 0xf4, 0xf6, 0xdb, 0xf4, 0xf6, 0xf8, 0xff, 0xf5, 0xf6, 0xf8, 0xff, 0xf7, 0xf8, 0xfa, 0xff, 0xf3, 0xf4, 0xf6, 0xff, 0xef, 0xf1, 0xf3, 0xff, 0xf2, 0xf3, 0xf5, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xef, 0xf1, 0xf5, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xea, 0xeb, 0xef, 0xff, 0xec, 0xed, 0xf1, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf5, 0xf6, 0xfa, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf4, 0xf5, 0xf7, 0xff, 0xf3, 0xf4, 0xf6, 0xff, 0xf3, 0xf4, 0xf6, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf9, 0xfb, 0xfc, 0xff, 0xf8, 0xfa, 0xfb, 0xff, 0xf4, 0xf6, 0xf8, 0xdb, 0xf3, 0xf7, 0xf7, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x09, 0xf3, 0xf5, 0xf7, 0x87, 0xf4, 0xf6, 0xf7, 0xf9, 0xf6, 0xf8, 0xf8, 0xff, 0xf0, 0xf2, 0xf2, 0xff, 0xee, 0xf0, 0xf1, 0xff, 0xf2, 0xf4, 0xf5, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf2, 0xf7, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf5, 0xf6, 0xfa, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf1, 0xf5, 0xff, 0xf0, 0xf0, 0xf4, 0xff, 0xeb, 0xec, 0xf0, 0xff, 0xe9, 0xea, 0xee, 0xff, 0xeb, 0xec, 0xf0, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf4, 0xf5, 0xf8, 0xff, 0xf2, 0xf4, 0xf4, 0xff, 0xf1, 0xf3, 0xf4, 0xff, 0xf2, 0xf4, 0xf5, 0xff, 0xf4, 0xf6, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf8, 0xfa, 0xfb, 0xff, 0xfa, 0xfc, 0xfd, 0xff, 0xf9, 0xfb, 0xfc, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf2, 0xf4, 0xf5, 0xff, 0xf2, 0xf4, 0xf5, 0xff, 0xf4, 0xf6, 0xf7, 0xf9, 0xf7, 0xf9, 0xf9, 0x88, 0xff, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xf8, 0xf8, 0x25, 0xf2, 0xf3, 0xf5, 0xb7, 0xee, 0xf0, 0xf1, 0xff, 0xf2, 0xf4, 0xf4, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf9, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xeb, 0xec, 0xf0, 0xff, 0xeb, 0xec, 0xf0, 0xff, 0xec, 0xed, 0xf1, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf2, 0xf3, 0xf8, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xef, 0xf0, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf2, 0xf3, 0xf8, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf2, 0xf2, 0xf8, 0xff, 0xf1, 0xf2, 0xf5, 0xff, 0xf1, 0xf3, 0xf3, 0xff, 0xf1, 0xf3, 0xf4, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf2, 0xf4, 0xf5, 0xff, 0xf2, 0xf5, 0xf6, 0xb7, 0xf1, 0xf8, 0xf8, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xf0, 0xf0, 0x46, 0xf2, 0xf2, 0xf6, 0xca, 0xf1, 0xf2, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf3, 0xf4, 0xf7, 0xff, 0xf3, 0xf4, 0xf7, 0xff, 0xf3, 0xf5, 0xf7, 0xff, 0xf2, 0xf4, 0xf6, 0xff, 0xf2, 0xf4, 0xf6, 0xff, 0xf2, 0xf4, 0xf6, 0xff, 0xf3, 0xf4, 0xf7, 0xff, 0xf4, 0xf6, 0xf8, 0xff, 0xf4, 0xf6, 0xf8, 0xff, 0xf4, 0xf6, 0xf8, 0xff, 0xf5, 0xf6, 0xf8, 0xff, 0xf4, 0xf5, 0xf8, 0xff, 0xf3, 0xf4, 0xf6, 0xff, 0xf2, 0xf4, 0xf5, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf2, 0xf4, 0xf6, 0xca, 0xf4, 0xf4, 0xf7, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xee, 0xf5, 0x4d, 0xed, 0xee, 0xf2, 0xcc, 0xef, 0xf0, 0xf4, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xec, 0xed, 0xf1, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf2, 0xf4, 0xf4, 0xff, 0xf2, 0xf4, 0xf4, 0xff, 0xf1, 0xf4, 0xf4, 0xff, 0xf2, 0xf4, 0xf4, 0xff, 0xf2, 0xf4, 0xf5, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf7, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf2, 0xf4, 0xf5, 0xff, 0xf1, 0xf3, 0xf4, 0xff, 0xf2, 0xf4, 0xf5, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf5, 0xf7, 0xf7, 0xcc, 0xf5, 0xf8, 0xf8, 0x4d, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xf3, 0xf7, 0x41, 0xef, 0xf0, 0xf5, 0xb4, 0xef, 0xf0, 0xf4, 0xfe, 0xf0, 0xf1, 0xf5, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf3, 0xf5, 0xf5, 0xff, 0xf2, 0xf5, 0xf5, 0xff, 0xf2, 0xf4, 0xf5, 0xff, 0xf2, 0xf4, 0xf5, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf1, 0xf3, 0xf4, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xfe, 0xf5, 0xf6, 0xf7, 0xb4, 0xf3, 0xf7, 0xf7, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf7, 0x23, 0xf3, 0xf3, 0xf7, 0x88, 0xf3, 0xf5, 0xf9, 0xe6, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf4, 0xf5, 0xf9, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf2, 0xf4, 0xff, 0xf1, 0xf3, 0xf5, 0xff, 0xf3, 0xf4, 0xf6, 0xff, 0xf2, 0xf4, 0xf6, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xe7, 0xf5, 0xf7, 0xf9, 0x88, 0xf7, 0xf7, 0xf7, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x05, 0xf4, 0xf4, 0xf8, 0x4a, 0xf2, 0xf2, 0xf7, 0xa0, 0xf2, 0xf3, 0xf7, 0xef, 0xf3, 0xf4, 0xf8, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xee, 0xef, 0xf3, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xef, 0xf0, 0xf4, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf1, 0xf6, 0xff, 0xf3, 0xf3, 0xf8, 0xff, 0xf5, 0xf6, 0xfb, 0xff, 0xf4, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf7, 0xf9, 0xfa, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf6, 0xf7, 0xf8, 0xef, 0xf5, 0xf7, 0xf8, 0xa0, 0xf4, 0xf4, 0xf8, 0x4a, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x07, 0xf4, 0xf4, 0xf7, 0x46, 0xf4, 0xf4, 0xf9, 0x8e, 0xef, 0xf0, 0xf5, 0xd7, 0xee, 0xef, 0xf3, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf6, 0xf7, 0xfb, 0xff, 0xf5, 0xf6, 0xfa, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf2, 0xf3, 0xf7, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf3, 0xf4, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf1, 0xf3, 0xf4, 0xff, 0xf2, 0xf4, 0xf5, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf6, 0xf8, 0xf9, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf1, 0xf4, 0xf5, 0xd7, 0xf2, 0xf4, 0xf6, 0x8e, 0xf4, 0xf7, 0xf7, 0x46, 0xfe, 0xfe, 0xfe, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xec, 0xf5, 0x1b, 0xf3, 0xf3, 0xf6, 0x55, 0xf6, 0xf7, 0xfb, 0x8f, 0xf4, 0xf4, 0xf8, 0xc2, 0xf3, 0xf4, 0xf8, 0xea, 0xf2, 0xf3, 0xf7, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf1, 0xf2, 0xf6, 0xff, 0xf0, 0xf1, 0xf5, 0xff, 0xf2, 0xf4, 0xf5, 0xff, 0xf3, 0xf6, 0xf6, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf0, 0xf2, 0xf3, 0xff, 0xf1, 0xf3, 0xf4, 0xff, 0xf3, 0xf5, 0xf6, 0xff, 0xf5, 0xf7, 0xf8, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xea, 0xf4, 0xf5, 0xf7, 0xc2, 0xf2, 0xf4, 0xf6, 0x8f, 0xf3, 0xf6, 0xf6, 0x55, 0xf5, 0xf5, 0xf5, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0x11, 0xf1, 0xf1, 0xf5, 0x37, 0xf1, 0xf4, 0xf6, 0x5f, 0xf1, 0xf3, 0xf7, 0x86, 0xf1, 0xf2, 0xf7, 0xa8, 0xf1, 0xf4, 0xf4, 0xc0, 0xf2, 0xf5, 0xf5, 0xd3, 0xf3, 0xf6, 0xf7, 0xe6, 0xf4, 0xf6, 0xf7, 0xee, 0xf3, 0xf5, 0xf6, 0xf5, 0xf4, 0xf6, 0xf7, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xf3, 0xf5, 0xf6, 0xf5, 0xf4, 0xf6, 0xf7, 0xee, 0xf3, 0xf6, 0xf7, 0xe6, 0xf4, 0xf6, 0xf6, 0xd3, 0xf1, 0xf4, 0xf4, 0xc0, 0xf1, 0xf4, 0xf4, 0xa8, 0xf3, 0xf5, 0xf5, 0x86, 0xf4, 0xf4, 0xf6, 0x5f, 0xf1, 0xf5, 0xf5, 0x37, 0xf0, 0xf0, 0xf0, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const lv_image_dsc_t img_multilang_avatar_9 = {
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .header.w = 128,
+    .header.h = 128,
+    .header.stride = 512,
+    .data = img_multilang_avatar_9_map,
+    .data_size = sizeof(img_multilang_avatar_9_map),
+};
+
+#endif
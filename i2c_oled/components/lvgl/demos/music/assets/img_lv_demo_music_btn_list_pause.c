@@ -0,0 +1,82 @@
+#include "../lv_demo_music.h"
+#if LV_USE_DEMO_MUSIC  && !LV_DEMO_MUSIC_LARGE
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t img_lv_demo_music_btn_list_pause_map[] = {
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2c, 0xf2, 0x6a, 0x9f, 0x34, 0xf4, 0x7d, 0x83, 0x57, 0xf5, 0x83, 0x7a, 0x70, 0xf5, 0x84, 0x77, 0x7b, 0xf5, 0x82, 0x7b, 0x74, 0xf4, 0x7c, 0x84, 0x63, 0xf2, 0x6e, 0x9a, 0x44, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf5, 0x82, 0x7b, 0x5f, 0xf6, 0x8c, 0x6d, 0x97, 0xf7, 0x90, 0x65, 0xd4, 0xf7, 0x92, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x91, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xf7, 0x8f, 0x67, 0xff, 0xf7, 0x8f, 0x68, 0xff, 0xf7, 0x8b, 0x6d, 0xdc, 0xf5, 0x86, 0x75, 0xa8, 0xf4, 0x7e, 0x81, 0x7c, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf6, 0x8b, 0x6e, 0x83, 0xf7, 0x91, 0x63, 0xd3, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xf7, 0x90, 0x66, 0xff, 0xf7, 0x8f, 0x67, 0xff, 0xf7, 0x8e, 0x68, 0xff, 0xf7, 0x8e, 0x69, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6b, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x89, 0x72, 0xdf, 0xf5, 0x81, 0x7d, 0x9b, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf5, 0x81, 0x7d, 0x53, 0xf6, 0x90, 0x65, 0xbf, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x91, 0x63, 0xff, 0xf7, 0x93, 0x67, 0xff, 0xf8, 0xa2, 0x7e, 0xff, 0xf9, 0xaf, 0x91, 0xff, 0xfa, 0xb4, 0x9a, 0xff, 0xf9, 0xb0, 0x95, 0xff, 0xf8, 0xa4, 0x88, 0xff, 0xf6, 0x92, 0x72, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8a, 0x6e, 0xff, 0xf6, 0x89, 0x6f, 0xff, 0xf6, 0x89, 0x71, 0xff, 0xf6, 0x85, 0x76, 0xdb, 0xf4, 0x7c, 0x84, 0x8f, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x27, 0xf7, 0x8b, 0x6d, 0x84, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x94, 0x64, 0xff, 0xfa, 0xb7, 0x98, 0xff, 0xfd, 0xde, 0xd0, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf8, 0xf5, 0xf2, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfd, 0xe5, 0xde, 0xff, 0xfa, 0xbd, 0xae, 0xff, 0xf6, 0x8f, 0x77, 0xff, 0xf6, 0x88, 0x71, 0xff, 0xf6, 0x88, 0x72, 0xff, 0xf6, 0x87, 0x74, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf4, 0x7f, 0x7f, 0xb7, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x27, 0xf7, 0x8f, 0x67, 0xa3, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xfb, 0xc4, 0xab, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf9, 0xf5, 0xf1, 0xff, 0xf1, 0xeb, 0xe3, 0xff, 0xec, 0xe2, 0xd8, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd4, 0xff, 0xea, 0xe0, 0xd4, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xeb, 0xe1, 0xd5, 0xff, 0xeb, 0xe1, 0xd7, 0xff, 0xf0, 0xe9, 0xe0, 0xff, 0xf7, 0xf2, 0xee, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfb, 0xc4, 0xba, 0xff, 0xf6, 0x89, 0x77, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x84, 0x78, 0xff, 0xf4, 0x7f, 0x80, 0xc8, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x27, 0xf6, 0x8e, 0x69, 0xa0, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf9, 0xad, 0x88, 0xff, 0xfc, 0xd9, 0xc9, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe4, 0xd9, 0xcb, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe7, 0xdd, 0xd1, 0xff, 0xea, 0xe1, 0xd6, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xf9, 0xb6, 0xad, 0xff, 0xf5, 0x84, 0x78, 0xff, 0xf5, 0x83, 0x7a, 0xff, 0xf5, 0x82, 0x7b, 0xff, 0xf4, 0x7d, 0x82, 0xcb, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x24, 0xf6, 0x89, 0x6f, 0x7f, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xfa, 0xbb, 0x9e, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xf3, 0xed, 0xe6, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xe7, 0xdc, 0xce, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe6, 0xda, 0xcc, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xf0, 0xe9, 0xe0, 0xff, 0xfc, 0xfb, 0xfa, 0xff, 0xfa, 0xc1, 0xbc, 0xff, 0xf5, 0x82, 0x7b, 0xff, 0xf5, 0x81, 0x7d, 0xff, 0xf5, 0x80, 0x7e, 0xff, 0xf4, 0x79, 0x88, 0xb8, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x23, 0xf3, 0x79, 0x88, 0x40, 0xf7, 0x92, 0x61, 0xf0, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xfa, 0xbb, 0x9d, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xf1, 0xea, 0xe2, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe7, 0xdc, 0xd0, 0xff, 0xec, 0xe2, 0xd8, 0xff, 0xef, 0xe6, 0xde, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfa, 0xc1, 0xbf, 0xff, 0xf5, 0x80, 0x7e, 0xff, 0xf4, 0x7f, 0x80, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xf3, 0x74, 0x90, 0x9b, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x28, 0xf6, 0x8d, 0x69, 0xa8, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf8, 0xa3, 0x7d, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xf1, 0xeb, 0xe4, 0xff, 0xea, 0xe1, 0xd5, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe8, 0xde, 0xd1, 0xff, 0xec, 0xe4, 0xd9, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xf8, 0xb0, 0xb1, 0xff, 0xf4, 0x7e, 0x82, 0xff, 0xf4, 0x7d, 0x83, 0xff, 0xf4, 0x7a, 0x87, 0xe3, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x24, 0xf5, 0x84, 0x78, 0x67, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xfc, 0xd1, 0xbf, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xf1, 0xeb, 0xe5, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf4, 0x83, 0x88, 0xff, 0xf4, 0x7c, 0x85, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xf3, 0x73, 0x91, 0xaf, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x28, 0xf6, 0x8b, 0x6c, 0x9f, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xfa, 0xb4, 0x97, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xeb, 0xe2, 0xd6, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xf8, 0xf5, 0xf0, 0xff, 0xfa, 0xbf, 0xc4, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xf4, 0x7a, 0x88, 0xff, 0xf4, 0x77, 0x8c, 0xe4, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x23, 0xf2, 0x6b, 0x9e, 0x33, 0xf7, 0x90, 0x64, 0xf0, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xfd, 0xe2, 0xd7, 0xff, 0xf4, 0xee, 0xe8, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xd5, 0xc7, 0xbf, 0xff, 0x86, 0x6b, 0x6b, 0xff, 0x80, 0x63, 0x64, 0xff, 0xc7, 0xb6, 0xaf, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xd3, 0xc5, 0xbc, 0xff, 0x86, 0x6a, 0x6a, 0xff, 0x81, 0x64, 0x65, 0xff, 0xca, 0xba, 0xb3, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd6, 0xff, 0xee, 0xe5, 0xdc, 0xff, 0xf1, 0xeb, 0xe3, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf5, 0x7f, 0x8e, 0xff, 0xf4, 0x79, 0x89, 0xff, 0xf3, 0x78, 0x8b, 0xff, 0xf2, 0x6e, 0x9a, 0x94, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x27, 0xf5, 0x82, 0x7b, 0x6b, 0xf7, 0x90, 0x65, 0xff, 0xf7, 0x90, 0x66, 0xff, 0xf8, 0xa1, 0x7f, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0x91, 0x77, 0x76, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x7a, 0x5d, 0x5e, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0x8d, 0x72, 0x72, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x80, 0x63, 0x64, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xf0, 0xea, 0xe3, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf8, 0xae, 0xb9, 0xff, 0xf3, 0x77, 0x8b, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf2, 0x71, 0x96, 0xbb, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x2b, 0xf6, 0x89, 0x70, 0x9c, 0xf7, 0x90, 0x66, 0xff, 0xf7, 0x8f, 0x67, 0xff, 0xfb, 0xc6, 0xb3, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0x84, 0x68, 0x68, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0x7c, 0x5f, 0x60, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x75, 0x56, 0x58, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xee, 0xe5, 0xdb, 0xff, 0xf1, 0xea, 0xe2, 0xff, 0xf5, 0xf1, 0xeb, 0xff, 0xfc, 0xdb, 0xe1, 0xff, 0xf3, 0x76, 0x8d, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x73, 0x92, 0xe3, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x2f, 0xf7, 0x8c, 0x6b, 0xcf, 0xf7, 0x8f, 0x67, 0xff, 0xf7, 0x8e, 0x69, 0xff, 0xfd, 0xe2, 0xd9, 0xff, 0xf6, 0xf2, 0xec, 0xff, 0xef, 0xe8, 0xe0, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0x84, 0x68, 0x69, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0x7c, 0x5f, 0x61, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x75, 0x56, 0x58, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xf1, 0xea, 0xe2, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x78, 0x91, 0xff, 0xf3, 0x74, 0x90, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf1, 0x67, 0xa5, 0x74, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x30, 0xf7, 0x8d, 0x69, 0xf0, 0xf7, 0x8e, 0x69, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xfe, 0xf6, 0xf3, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xef, 0xe9, 0xe0, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0x84, 0x68, 0x69, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0x7c, 0x5f, 0x61, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x75, 0x56, 0x58, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xf1, 0xeb, 0xe4, 0xff, 0xf3, 0xee, 0xe8, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xf5, 0x8a, 0xa2, 0xff, 0xf3, 0x73, 0x91, 0xff, 0xf3, 0x73, 0x93, 0xff, 0xf2, 0x6a, 0xa1, 0x8c, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x68, 0xa3, 0x34, 0xf7, 0x8d, 0x69, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8d, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0x84, 0x69, 0x6a, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0x7c, 0x5f, 0x61, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x75, 0x56, 0x59, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf4, 0xf0, 0xea, 0xff, 0xfc, 0xfb, 0xfa, 0xff, 0xf6, 0x96, 0xad, 0xff, 0xf3, 0x72, 0x93, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf2, 0x6b, 0x9f, 0x9c, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x28, 0xf2, 0x6d, 0x9a, 0x3f, 0xf6, 0x8c, 0x6b, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x90, 0x73, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xf5, 0xf0, 0xeb, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0x84, 0x69, 0x6a, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0x7d, 0x60, 0x61, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x75, 0x56, 0x59, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf4, 0xee, 0xe8, 0xff, 0xf6, 0xf1, 0xec, 0xff, 0xfc, 0xfb, 0xfa, 0xff, 0xf6, 0x9a, 0xb2, 0xff, 0xf3, 0x71, 0x95, 0xff, 0xf2, 0x71, 0x96, 0xff, 0xf1, 0x6b, 0x9f, 0xa3, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x34, 0xf6, 0x8b, 0x6c, 0xff, 0xf6, 0x8b, 0x6e, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf3, 0xed, 0xe8, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0x85, 0x69, 0x6b, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0x7d, 0x60, 0x62, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x75, 0x56, 0x59, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf6, 0xf2, 0xee, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xf6, 0x91, 0xad, 0xff, 0xf2, 0x70, 0x96, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf1, 0x69, 0xa1, 0x9c, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x37, 0xf6, 0x89, 0x70, 0xe4, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xfe, 0xee, 0xeb, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf5, 0xf0, 0xeb, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0x85, 0x6a, 0x6b, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0x7d, 0x60, 0x62, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x75, 0x57, 0x59, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xf3, 0x7f, 0xa1, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf1, 0x68, 0xa4, 0x8f, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x34, 0xf5, 0x85, 0x77, 0xc0, 0xf6, 0x88, 0x71, 0xff, 0xf6, 0x88, 0x72, 0xff, 0xfc, 0xd6, 0xcf, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0x85, 0x6a, 0x6c, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0x7d, 0x60, 0x62, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x75, 0x57, 0x59, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xed, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xfe, 0xf1, 0xf5, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x99, 0xff, 0xf2, 0x6e, 0x9b, 0xf4, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x34, 0xf5, 0x7f, 0x7f, 0x93, 0xf6, 0x87, 0x73, 0xff, 0xf6, 0x87, 0x74, 0xff, 0xf9, 0xb5, 0xaa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0x85, 0x6a, 0x6c, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0x7d, 0x61, 0x63, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x75, 0x57, 0x59, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf8, 0xf4, 0xf0, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfa, 0xc9, 0xd9, 0xff, 0xf2, 0x6e, 0x99, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6b, 0x9d, 0xdb, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x33, 0xf3, 0x76, 0x8e, 0x64, 0xf6, 0x86, 0x74, 0xff, 0xf5, 0x85, 0x76, 0xff, 0xf6, 0x8c, 0x7e, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0x89, 0x6f, 0x70, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x70, 0x51, 0x54, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0x83, 0x67, 0x69, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x77, 0x5a, 0x5c, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xf5, 0x94, 0xb5, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x69, 0xa1, 0xbf, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x3c, 0xf5, 0x83, 0x79, 0xdf, 0xf5, 0x84, 0x77, 0xff, 0xf5, 0x83, 0x79, 0xff, 0xfb, 0xc8, 0xc4, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xb7, 0xa6, 0xa6, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x9e, 0x89, 0x8a, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xb3, 0xa1, 0xa1, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xa4, 0x8f, 0x90, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xfa, 0xf7, 0xf4, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xe2, 0xeb, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf1, 0x67, 0xa4, 0x9b, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x38, 0xf4, 0x7d, 0x82, 0xa3, 0xf5, 0x83, 0x79, 0xff, 0xf5, 0x82, 0x7a, 0xff, 0xf6, 0x93, 0x8e, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfb, 0xfa, 0xf9, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xd8, 0xce, 0xcd, 0xff, 0xd0, 0xc5, 0xc4, 0xff, 0xf8, 0xf5, 0xf2, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xd6, 0xcc, 0xcb, 0xff, 0xd1, 0xc6, 0xc5, 0xff, 0xf8, 0xf5, 0xf2, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfb, 0xfa, 0xf7, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xf7, 0xa6, 0xc2, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6a, 0xa0, 0xd4, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x34, 0xf2, 0x6d, 0x9b, 0x53, 0xf5, 0x81, 0x7d, 0xef, 0xf5, 0x81, 0x7c, 0xff, 0xf5, 0x80, 0x7d, 0xff, 0xfa, 0xc0, 0xc0, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xfa, 0xc2, 0xd6, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf1, 0x68, 0xa3, 0xb3, 0xf1, 0x66, 0xa6, 0x7b, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x3c, 0xf4, 0x7a, 0x88, 0x9c, 0xf5, 0x80, 0x7e, 0xff, 0xf5, 0x7f, 0x7f, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xfa, 0xc9, 0xcb, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfc, 0xfc, 0xfa, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x80, 0xaa, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x69, 0xa2, 0xd3, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x44, 0xf4, 0x7c, 0x85, 0xc8, 0xf4, 0x7e, 0x81, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf5, 0x84, 0x8b, 0xff, 0xfa, 0xc9, 0xcd, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfc, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x96, 0xb9, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xf4, 0xf1, 0x66, 0xa5, 0x93, 0xf1, 0x66, 0xa6, 0x7b, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x3f, 0xf2, 0x6b, 0x9e, 0x58, 0xf4, 0x7b, 0x85, 0xe3, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x7b, 0x85, 0xff, 0xf5, 0x81, 0x8e, 0xff, 0xfa, 0xc7, 0xce, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x92, 0xb8, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf1, 0x68, 0xa3, 0xb7, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x44, 0xf2, 0x71, 0x96, 0x7b, 0xf4, 0x79, 0x88, 0xe3, 0xf4, 0x7a, 0x87, 0xff, 0xf4, 0x79, 0x88, 0xff, 0xf4, 0x78, 0x8a, 0xff, 0xf9, 0xba, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xbd, 0xd3, 0xff, 0xf3, 0x73, 0xa3, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf1, 0x69, 0xa1, 0xff, 0xf1, 0x68, 0xa4, 0xc3, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x48, 0xf2, 0x6f, 0x98, 0x7c, 0xf4, 0x78, 0x8b, 0xe3, 0xf4, 0x78, 0x8a, 0xff, 0xf3, 0x77, 0x8b, 0xff, 0xf3, 0x76, 0x8d, 0xff, 0xf4, 0x84, 0x9a, 0xff, 0xf9, 0xbe, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xc9, 0xdb, 0xff, 0xf5, 0x8d, 0xb3, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf1, 0x69, 0xa1, 0xff, 0xf1, 0x68, 0xa4, 0xc0, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x69, 0xa2, 0x60, 0xf3, 0x74, 0x90, 0xcb, 0xf3, 0x76, 0x8d, 0xff, 0xf3, 0x75, 0x8e, 0xff, 0xf3, 0x75, 0x90, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x78, 0x96, 0xff, 0xf7, 0xa2, 0xb7, 0xff, 0xfa, 0xc7, 0xd5, 0xff, 0xfc, 0xe2, 0xe9, 0xff, 0xfe, 0xf4, 0xf7, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfd, 0xe7, 0xee, 0xff, 0xfb, 0xcd, 0xdd, 0xff, 0xf7, 0xa9, 0xc5, 0xff, 0xf3, 0x79, 0xa5, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf1, 0x69, 0xa2, 0xec, 0xf1, 0x68, 0xa4, 0xb7, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x58, 0xf2, 0x70, 0x97, 0xa7, 0xf3, 0x73, 0x91, 0xec, 0xf3, 0x73, 0x91, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf3, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x96, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x99, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf1, 0x69, 0xa1, 0xff, 0xf1, 0x68, 0xa3, 0xc8, 0xf1, 0x66, 0xa6, 0x88, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x67, 0xa4, 0x67, 0xf2, 0x6e, 0x99, 0xb0, 0xf3, 0x71, 0x96, 0xe3, 0xf3, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x96, 0xff, 0xf2, 0x6f, 0x97, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6c, 0x9e, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa1, 0xef, 0xf1, 0x68, 0xa3, 0xc8, 0xf1, 0x67, 0xa5, 0x9c, 0xf1, 0x66, 0xa6, 0x80, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x69, 0xa2, 0x80, 0xf2, 0x6b, 0x9e, 0xa8, 0xf2, 0x6d, 0x9c, 0xcc, 0xf2, 0x6d, 0x9b, 0xe7, 0xf2, 0x6d, 0x9b, 0xf7, 0xf2, 0x6d, 0x9c, 0xfb, 0xf2, 0x6c, 0x9d, 0xf8, 0xf2, 0x6b, 0x9f, 0xec, 0xf2, 0x6a, 0xa1, 0xd8, 0xf2, 0x68, 0xa3, 0xbc, 0xf1, 0x67, 0xa4, 0x9f, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+};
+
+const lv_image_dsc_t img_lv_demo_music_btn_list_pause = {
+    .header.w = 58,
+    .header.h = 60,
+    .header.stride = 232,
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .data = img_lv_demo_music_btn_list_pause_map,
+    .data_size = sizeof(img_lv_demo_music_btn_list_pause_map),
+};
+
+#endif /*LV_USE_DEMO_MUSIC*/
+
+
@@ -0,0 +1,131 @@
+#include "../lv_demo_music.h"
+#if LV_USE_DEMO_MUSIC && LV_DEMO_MUSIC_LARGE
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_IMG_LV_DEMO_MUSIC_BTN_LIST_PAUSE
+    #define LV_ATTRIBUTE_IMAGE_IMG_LV_DEMO_MUSIC_BTN_LIST_PAUSE
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_LV_DEMO_MUSIC_BTN_LIST_PAUSE uint8_t
+img_lv_demo_music_btn_list_pause_map[] = {
+    /*Pixel format:  Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha: 8 bit*/
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf8, 0x98, 0x59, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x67, 0xa5, 0x3c, 0xf3, 0x76, 0x8d, 0x54, 0xf5, 0x80, 0x7d, 0x74, 0xf5, 0x85, 0x75, 0x8c, 0xf5, 0x87, 0x74, 0x97, 0xf6, 0x87, 0x73, 0x9c, 0xf6, 0x86, 0x74, 0x9b, 0xf5, 0x84, 0x78, 0x90, 0xf5, 0x80, 0x7e, 0x80, 0xf3, 0x77, 0x8c, 0x64, 0xf1, 0x69, 0xa1, 0x4b, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x38, 0xf5, 0x84, 0x79, 0x77, 0xf6, 0x8b, 0x6c, 0xa4, 0xf7, 0x90, 0x66, 0xd3, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xf7, 0x90, 0x66, 0xff, 0xf7, 0x8f, 0x66, 0xff, 0xf7, 0x8f, 0x67, 0xff, 0xf7, 0x8c, 0x6c, 0xdb, 0xf6, 0x86, 0x74, 0xb0, 0xf5, 0x7e, 0x81, 0x87, 0xf2, 0x6b, 0x9e, 0x54, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x37, 0xf5, 0x88, 0x72, 0x84, 0xf6, 0x90, 0x65, 0xc8, 0xf7, 0x94, 0x61, 0xfb, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xf7, 0x90, 0x66, 0xff, 0xf7, 0x8f, 0x66, 0xff, 0xf7, 0x8f, 0x67, 0xff, 0xf7, 0x8e, 0x68, 0xff, 0xf7, 0x8e, 0x68, 0xff, 0xf7, 0x8e, 0x69, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x89, 0x70, 0xdb, 0xf5, 0x81, 0x7d, 0xa0, 0xf2, 0x6f, 0x99, 0x60, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x33, 0xf3, 0x70, 0x96, 0x40, 0xf7, 0x8c, 0x6a, 0xa4, 0xf7, 0x94, 0x5f, 0xfc, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xf7, 0x90, 0x66, 0xff, 0xf7, 0x8f, 0x67, 0xff, 0xf7, 0x8f, 0x67, 0xff, 0xf7, 0x8e, 0x68, 0xff, 0xf7, 0x8e, 0x68, 0xff, 0xf7, 0x8e, 0x69, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6b, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x8b, 0x6c, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf5, 0x86, 0x76, 0xc7, 0xf4, 0x7b, 0x86, 0x8b, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x34, 0xf7, 0x8d, 0x6a, 0x9f, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf8, 0x9e, 0x77, 0xff, 0xf9, 0xaf, 0x8e, 0xff, 0xfa, 0xbc, 0xa1, 0xff, 0xfb, 0xc1, 0xaa, 0xff, 0xfb, 0xc3, 0xad, 0xff, 0xfb, 0xc2, 0xad, 0xff, 0xfa, 0xbc, 0xa4, 0xff, 0xfa, 0xb1, 0x97, 0xff, 0xf8, 0xa0, 0x81, 0xff, 0xf7, 0x90, 0x6d, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8d, 0x6b, 0xff, 0xf6, 0x8c, 0x6b, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8a, 0x6e, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x6f, 0xff, 0xf5, 0x84, 0x78, 0xcb, 0xf4, 0x79, 0x88, 0x8b, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x30, 0xf6, 0x88, 0x72, 0x7c, 0xf8, 0x94, 0x60, 0xec, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf8, 0xa6, 0x7f, 0xff, 0xfb, 0xc3, 0xa9, 0xff, 0xfd, 0xe6, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe7, 0xe0, 0xff, 0xfb, 0xc7, 0xb8, 0xff, 0xf8, 0xa9, 0x91, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8b, 0x6e, 0xff, 0xf6, 0x8a, 0x6e, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf6, 0x88, 0x71, 0xff, 0xf6, 0x88, 0x72, 0xff, 0xf5, 0x80, 0x7e, 0xb3, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x33, 0xf7, 0x8f, 0x68, 0xab, 0xf8, 0x94, 0x5e, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x98, 0x68, 0xff, 0xfb, 0xc4, 0xaa, 0xff, 0xfe, 0xef, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xf4, 0xff, 0xfb, 0xcb, 0xbf, 0xff, 0xf7, 0x9b, 0x84, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf6, 0x89, 0x71, 0xff, 0xf6, 0x88, 0x71, 0xff, 0xf6, 0x88, 0x72, 0xff, 0xf6, 0x87, 0x73, 0xff, 0xf6, 0x87, 0x73, 0xff, 0xf5, 0x81, 0x7b, 0xd0, 0xf2, 0x6c, 0x9d, 0x6b, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf4, 0x7a, 0x87, 0x4c, 0xf8, 0x93, 0x62, 0xd8, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf8, 0x9f, 0x73, 0xff, 0xfb, 0xcb, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfb, 0xfa, 0xff, 0xfa, 0xf7, 0xf4, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf1, 0xec, 0xff, 0xf6, 0xf1, 0xed, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xfc, 0xfa, 0xf9, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe5, 0xe0, 0xff, 0xf8, 0xa3, 0x91, 0xff, 0xf6, 0x88, 0x72, 0xff, 0xf6, 0x87, 0x73, 0xff, 0xf6, 0x87, 0x74, 0xff, 0xf6, 0x86, 0x74, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x84, 0x78, 0xef, 0xf3, 0x76, 0x8d, 0x90, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf5, 0x82, 0x7b, 0x63, 0xf8, 0x94, 0x60, 0xeb, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xfa, 0xbd, 0x9f, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xfc, 0xff, 0xf7, 0xf2, 0xee, 0xff, 0xf1, 0xeb, 0xe4, 0xff, 0xec, 0xe3, 0xda, 0xff, 0xeb, 0xe1, 0xd7, 0xff, 0xeb, 0xe1, 0xd7, 0xff, 0xeb, 0xe1, 0xd7, 0xff, 0xeb, 0xe1, 0xd7, 0xff, 0xeb, 0xe1, 0xd7, 0xff, 0xeb, 0xe1, 0xd7, 0xff, 0xeb, 0xe1, 0xd7, 0xff, 0xeb, 0xe1, 0xd7, 0xff, 0xeb, 0xe1, 0xd7, 0xff, 0xec, 0xe2, 0xd8, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xf5, 0xf0, 0xeb, 0xff, 0xfc, 0xfa, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe4, 0xdf, 0xff, 0xf8, 0x9d, 0x8d, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x76, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x84, 0x77, 0xff, 0xf4, 0x7a, 0x88, 0xa8, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf6, 0x85, 0x77, 0x6c, 0xf8, 0x93, 0x5f, 0xef, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf9, 0xac, 0x85, 0xff, 0xfe, 0xec, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xf2, 0xeb, 0xe3, 0xff, 0xec, 0xe3, 0xd8, 0xff, 0xec, 0xe2, 0xd7, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xea, 0xe1, 0xd5, 0xff, 0xea, 0xe0, 0xd4, 0xff, 0xea, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xea, 0xdf, 0xd4, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xeb, 0xe1, 0xd5, 0xff, 0xeb, 0xe2, 0xd6, 0xff, 0xec, 0xe2, 0xd7, 0xff, 0xec, 0xe2, 0xd7, 0xff, 0xec, 0xe2, 0xd7, 0xff, 0xf0, 0xe8, 0xdf, 0xff, 0xf8, 0xf4, 0xf0, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xf6, 0xff, 0xf8, 0xac, 0xa1, 0xff, 0xf5, 0x85, 0x76, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x84, 0x78, 0xff, 0xf5, 0x84, 0x78, 0xff, 0xf5, 0x83, 0x79, 0xff, 0xf4, 0x7b, 0x86, 0xb8, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf5, 0x83, 0x7a, 0x64, 0xf7, 0x93, 0x60, 0xf0, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xfa, 0xbb, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf9, 0xf6, 0xff, 0xf1, 0xea, 0xe1, 0xff, 0xec, 0xe3, 0xd8, 0xff, 0xec, 0xe3, 0xd8, 0xff, 0xeb, 0xe2, 0xd6, 0xff, 0xe9, 0xe0, 0xd4, 0xff, 0xe7, 0xdc, 0xce, 0xff, 0xe5, 0xd9, 0xca, 0xff, 0xe4, 0xd8, 0xc9, 0xff, 0xe4, 0xd8, 0xc9, 0xff, 0xe4, 0xd8, 0xc9, 0xff, 0xe4, 0xd8, 0xc9, 0xff, 0xe4, 0xd8, 0xc9, 0xff, 0xe4, 0xd8, 0xc9, 0xff, 0xe4, 0xd8, 0xc9, 0xff, 0xe4, 0xd8, 0xc9, 0xff, 0xe4, 0xd8, 0xc9, 0xff, 0xe5, 0xda, 0xcb, 0xff, 0xe8, 0xde, 0xd1, 0xff, 0xea, 0xe1, 0xd5, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xec, 0xe3, 0xd8, 0xff, 0xec, 0xe3, 0xd8, 0xff, 0xee, 0xe7, 0xdd, 0xff, 0xf8, 0xf4, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xc6, 0xc0, 0xff, 0xf5, 0x84, 0x78, 0xff, 0xf5, 0x83, 0x79, 0xff, 0xf5, 0x83, 0x79, 0xff, 0xf5, 0x82, 0x7a, 0xff, 0xf5, 0x82, 0x7b, 0xff, 0xf4, 0x7a, 0x87, 0xb8, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf4, 0x7a, 0x88, 0x4c, 0xf7, 0x93, 0x61, 0xeb, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xfb, 0xc6, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xf3, 0xee, 0xe8, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xeb, 0xe3, 0xd9, 0xff, 0xea, 0xe1, 0xd6, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe4, 0xd9, 0xcb, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe5, 0xda, 0xcd, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xd7, 0xd4, 0xff, 0xf5, 0x83, 0x7a, 0xff, 0xf5, 0x82, 0x7a, 0xff, 0xf5, 0x82, 0x7b, 0xff, 0xf5, 0x81, 0x7c, 0xff, 0xf5, 0x81, 0x7d, 0xff, 0xf3, 0x74, 0x90, 0x9b, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf7, 0x92, 0x63, 0xd7, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xfb, 0xcb, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xee, 0xe7, 0xde, 0xff, 0xec, 0xe4, 0xd9, 0xff, 0xec, 0xe3, 0xd8, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe6, 0xdb, 0xcd, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe4, 0xd9, 0xff, 0xed, 0xe5, 0xdb, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe2, 0xe0, 0xff, 0xf7, 0x98, 0x92, 0xff, 0xf5, 0x81, 0x7c, 0xff, 0xf5, 0x81, 0x7d, 0xff, 0xf5, 0x80, 0x7e, 0xff, 0xf5, 0x7f, 0x80, 0xf4, 0xf2, 0x6c, 0x9c, 0x7f, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf6, 0x8e, 0x68, 0xab, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xfb, 0xc6, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xed, 0xe5, 0xdb, 0xff, 0xec, 0xe3, 0xda, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xe6, 0xda, 0xce, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe7, 0xdc, 0xd0, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xec, 0xe4, 0xda, 0xff, 0xec, 0xe4, 0xda, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe2, 0xe1, 0xff, 0xf5, 0x81, 0x7d, 0xff, 0xf5, 0x80, 0x7e, 0xff, 0xf5, 0x80, 0x7f, 0xff, 0xf5, 0x7f, 0x7f, 0xff, 0xf4, 0x7c, 0x85, 0xdf, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf5, 0x87, 0x72, 0x7b, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xfa, 0xba, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xed, 0xe4, 0xdc, 0xff, 0xed, 0xe4, 0xdb, 0xff, 0xea, 0xe0, 0xd4, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe7, 0xdc, 0xd0, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xed, 0xe4, 0xdb, 0xff, 0xed, 0xe4, 0xdb, 0xff, 0xf4, 0xef, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xc8, 0xc7, 0xff, 0xf5, 0x7f, 0x7f, 0xff, 0xf4, 0x7f, 0x80, 0xff, 0xf4, 0x7e, 0x80, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xf3, 0x78, 0x8c, 0xc0, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x33, 0xf7, 0x93, 0x62, 0xe8, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf9, 0xab, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdb, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe7, 0xdc, 0xd0, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xad, 0xae, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf4, 0x7d, 0x83, 0xff, 0xf3, 0x71, 0x95, 0xa0, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf6, 0x8c, 0x6c, 0x9c, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xfe, 0xeb, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xef, 0xe7, 0xdd, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xea, 0xe1, 0xd6, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe8, 0xdd, 0xd0, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xee, 0xe6, 0xdc, 0xff, 0xee, 0xe6, 0xdc, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x98, 0x9b, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf4, 0x7d, 0x83, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x79, 0x88, 0xe0, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf2, 0x71, 0x95, 0x3f, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xfa, 0xbc, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe8, 0xdf, 0xd2, 0xff, 0xec, 0xe4, 0xda, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xef, 0xe7, 0xde, 0xff, 0xfc, 0xfa, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe4, 0xe5, 0xff, 0xf4, 0x7d, 0x83, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x7c, 0x85, 0xff, 0xf4, 0x7b, 0x85, 0xff, 0xf3, 0x71, 0x95, 0xa8, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x30, 0xf6, 0x8c, 0x6c, 0xa4, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf8, 0x9f, 0x75, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf0, 0xeb, 0xff, 0xee, 0xe6, 0xde, 0xff, 0xec, 0xe3, 0xda, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xde, 0xff, 0xf1, 0xea, 0xe4, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xa4, 0xa9, 0xff, 0xf4, 0x7b, 0x85, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xf4, 0x7a, 0x86, 0xff, 0xf4, 0x78, 0x8b, 0xe4, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x33, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x63, 0xff, 0xfb, 0xcb, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe6, 0xdd, 0xff, 0xea, 0xdf, 0xd4, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xef, 0xe7, 0xde, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe9, 0xea, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf4, 0x79, 0x88, 0xff, 0xf2, 0x6f, 0x98, 0xa4, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf5, 0x87, 0x73, 0x83, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x63, 0xff, 0xf7, 0x97, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xef, 0xe8, 0xe0, 0xff, 0xec, 0xe4, 0xda, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xde, 0xd3, 0xff, 0xca, 0xba, 0xb3, 0xff, 0xbc, 0xaa, 0xa4, 0xff, 0xd3, 0xc5, 0xbd, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xd6, 0xc9, 0xc0, 0xff, 0xbc, 0xaa, 0xa4, 0xff, 0xc9, 0xb9, 0xb2, 0xff, 0xe7, 0xdd, 0xd2, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xea, 0xe0, 0xd6, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xef, 0xe8, 0xe0, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9f, 0xa8, 0xff, 0xf4, 0x7a, 0x88, 0xff, 0xf4, 0x79, 0x88, 0xff, 0xf4, 0x79, 0x89, 0xff, 0xf3, 0x74, 0x91, 0xcc, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x33, 0xf6, 0x8e, 0x68, 0xc7, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xfb, 0xc4, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xef, 0xe7, 0xde, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xe3, 0xd7, 0xcd, 0xff, 0x89, 0x6e, 0x6e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x9e, 0x87, 0x84, 0xff, 0xea, 0xdf, 0xd4, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xa6, 0x90, 0x8d, 0xff, 0x6d, 0x4e, 0x51, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x85, 0x69, 0x69, 0xff, 0xdf, 0xd3, 0xc9, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe3, 0xe6, 0xff, 0xf4, 0x79, 0x89, 0xff, 0xf4, 0x79, 0x89, 0xff, 0xf4, 0x78, 0x8a, 0xff, 0xf3, 0x78, 0x8c, 0xfb, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x34, 0xf7, 0x91, 0x63, 0xfb, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xfe, 0xee, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf1, 0xe9, 0xe1, 0xff, 0xee, 0xe5, 0xdc, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0x9c, 0x85, 0x82, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xba, 0xa7, 0xa1, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xc1, 0xb0, 0xaa, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x95, 0x7b, 0x7a, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xec, 0xe2, 0xd7, 0xff, 0xef, 0xe7, 0xde, 0xff, 0xf1, 0xe9, 0xe1, 0xff, 0xf2, 0xeb, 0xe3, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x83, 0x93, 0xff, 0xf4, 0x78, 0x8a, 0xff, 0xf3, 0x78, 0x8b, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf2, 0x6e, 0x9a, 0xa7, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x30, 0xf5, 0x83, 0x79, 0x73, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xf8, 0xa4, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xf1, 0xea, 0xe4, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xeb, 0xe2, 0xd9, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0x75, 0x56, 0x59, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x91, 0x77, 0x76, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0x99, 0x82, 0x80, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6f, 0x4f, 0x52, 0xff, 0xe9, 0xdf, 0xd5, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xed, 0xe6, 0xdd, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xb3, 0xbd, 0xff, 0xf3, 0x77, 0x8b, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x76, 0x8d, 0xff, 0xf2, 0x71, 0x95, 0xc7, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x33, 0xf6, 0x8a, 0x6f, 0xa4, 0xf7, 0x90, 0x65, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xf7, 0x90, 0x66, 0xff, 0xfb, 0xc2, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf1, 0xeb, 0xe4, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8b, 0x70, 0x70, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0x92, 0x79, 0x78, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xe5, 0xda, 0xd1, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xed, 0xe5, 0xdb, 0xff, 0xf1, 0xea, 0xe2, 0xff, 0xf1, 0xeb, 0xe4, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe0, 0xe5, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x76, 0x8d, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x73, 0x91, 0xe4, 0xf1, 0x66, 0xa6, 0x80, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x34, 0xf7, 0x8d, 0x69, 0xd3, 0xf7, 0x90, 0x65, 0xff, 0xf7, 0x90, 0x66, 0xff, 0xf7, 0x8f, 0x67, 0xff, 0xfd, 0xe6, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf2, 0xec, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xef, 0xe7, 0xde, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8b, 0x71, 0x70, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0x93, 0x79, 0x79, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xe5, 0xdb, 0xd2, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xf0, 0xe9, 0xe0, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf3, 0xed, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x77, 0x8e, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x67, 0xa4, 0x38, 0xf7, 0x90, 0x66, 0xff, 0xf7, 0x8f, 0x66, 0xff, 0xf7, 0x8f, 0x67, 0xff, 0xf7, 0x90, 0x68, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xed, 0xe8, 0xff, 0xf2, 0xec, 0xe5, 0xff, 0xed, 0xe6, 0xdd, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8b, 0x71, 0x71, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0x93, 0x7a, 0x79, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xe5, 0xdc, 0xd4, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xef, 0xe9, 0xe1, 0xff, 0xf2, 0xec, 0xe6, 0xff, 0xf2, 0xec, 0xe6, 0xff, 0xfd, 0xfb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x90, 0xa4, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x74, 0x90, 0xff, 0xf2, 0x6a, 0x9f, 0x9f, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf3, 0x76, 0x8d, 0x50, 0xf7, 0x8f, 0x66, 0xff, 0xf7, 0x8f, 0x67, 0xff, 0xf7, 0x8e, 0x68, 0xff, 0xf8, 0x9c, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xf3, 0xed, 0xe6, 0xff, 0xf2, 0xec, 0xe5, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8b, 0x71, 0x71, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0x93, 0x7a, 0x79, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xe6, 0xdd, 0xd5, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xf3, 0xed, 0xe6, 0xff, 0xf3, 0xed, 0xe6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xa8, 0xb9, 0xff, 0xf3, 0x74, 0x90, 0xff, 0xf3, 0x74, 0x90, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf2, 0x6d, 0x9c, 0xb7, 0xf1, 0x66, 0xa6, 0x80, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x33, 0xf5, 0x80, 0x7f, 0x70, 0xf7, 0x8f, 0x67, 0xff, 0xf7, 0x8e, 0x68, 0xff, 0xf7, 0x8e, 0x68, 0xff, 0xf9, 0xad, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfa, 0xf9, 0xff, 0xf3, 0xee, 0xe8, 0xff, 0xf3, 0xec, 0xe6, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8c, 0x71, 0x72, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0x93, 0x7a, 0x7a, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xe7, 0xde, 0xd7, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf3, 0xed, 0xe8, 0xff, 0xf3, 0xee, 0xe8, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xbd, 0xca, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x73, 0x91, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf2, 0x6f, 0x99, 0xc8, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x33, 0xf5, 0x84, 0x78, 0x88, 0xf7, 0x8e, 0x68, 0xff, 0xf7, 0x8e, 0x69, 0xff, 0xf7, 0x8d, 0x69, 0xff, 0xfa, 0xba, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xf4, 0xee, 0xe9, 0xff, 0xf3, 0xed, 0xe6, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8c, 0x71, 0x72, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0x94, 0x7b, 0x7a, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xe8, 0xdf, 0xd8, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf1, 0xe9, 0xe2, 0xff, 0xf4, 0xee, 0xe8, 0xff, 0xf4, 0xee, 0xe9, 0xff, 0xf8, 0xf4, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xce, 0xd9, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x72, 0x93, 0xff, 0xf3, 0x6f, 0x98, 0xd8, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x34, 0xf6, 0x85, 0x76, 0x93, 0xf7, 0x8e, 0x69, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xfa, 0xbf, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xf4, 0xef, 0xea, 0xff, 0xf3, 0xed, 0xe8, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8c, 0x72, 0x72, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0x94, 0x7b, 0x7b, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xe8, 0xe0, 0xd9, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf4, 0xee, 0xe9, 0xff, 0xf4, 0xef, 0xea, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xd6, 0xdf, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x72, 0x93, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf3, 0x6f, 0x97, 0xdf, 0xf1, 0x66, 0xa6, 0x87, 0xf1, 0x66, 0xa6, 0x7b, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x34, 0xf6, 0x86, 0x76, 0x98, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6b, 0xff, 0xfa, 0xc2, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xf5, 0xf0, 0xeb, 0xff, 0xf4, 0xee, 0xe8, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8c, 0x72, 0x73, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0x94, 0x7b, 0x7b, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xe9, 0xe1, 0xda, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf5, 0xf0, 0xeb, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0xe5, 0xff, 0xf3, 0x72, 0x93, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf3, 0x71, 0x95, 0xff, 0xf3, 0x6f, 0x98, 0xe4, 0xf1, 0x66, 0xa6, 0x88, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x37, 0xf5, 0x84, 0x77, 0x97, 0xf6, 0x8d, 0x6b, 0xff, 0xf6, 0x8c, 0x6b, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xfa, 0xc0, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf9, 0xf6, 0xff, 0xf6, 0xf1, 0xec, 0xff, 0xf5, 0xf0, 0xe9, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8c, 0x72, 0x73, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0x94, 0x7c, 0x7c, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xea, 0xe3, 0xdb, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf3, 0xed, 0xe5, 0xff, 0xf5, 0xf1, 0xea, 0xff, 0xf6, 0xf1, 0xec, 0xff, 0xf9, 0xf5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xd7, 0xe1, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf3, 0x71, 0x95, 0xff, 0xf3, 0x71, 0x95, 0xff, 0xf2, 0x6e, 0x99, 0xe0, 0xf1, 0x66, 0xa6, 0x88, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x37, 0xf5, 0x82, 0x7b, 0x8c, 0xf6, 0x8c, 0x6b, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xfa, 0xba, 0xa9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf5, 0xf1, 0xeb, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8c, 0x73, 0x73, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0x94, 0x7c, 0x7c, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xea, 0xe4, 0xdd, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf3, 0xee, 0xe8, 0xff, 0xf5, 0xf2, 0xec, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xd0, 0xdc, 0xff, 0xf3, 0x71, 0x95, 0xff, 0xf2, 0x71, 0x96, 0xff, 0xf2, 0x70, 0x96, 0xff, 0xf2, 0x6e, 0x9a, 0xdc, 0xf1, 0x66, 0xa6, 0x8b, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x37, 0xf4, 0x7e, 0x81, 0x7b, 0xf6, 0x8b, 0x6c, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8b, 0x6e, 0xff, 0xf9, 0xae, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfb, 0xfa, 0xff, 0xf6, 0xf3, 0xee, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8d, 0x73, 0x74, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0x94, 0x7c, 0x7c, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xeb, 0xe5, 0xde, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf4, 0xf0, 0xe9, 0xff, 0xf6, 0xf3, 0xee, 0xff, 0xf6, 0xf3, 0xee, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xc1, 0xd1, 0xff, 0xf2, 0x70, 0x96, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6c, 0x9c, 0xd0, 0xf1, 0x66, 0xa6, 0x8b, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x37, 0xf3, 0x76, 0x8d, 0x5f, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8a, 0x6e, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf7, 0x9d, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8d, 0x73, 0x74, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0x95, 0x7d, 0x7d, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xec, 0xe5, 0xe0, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xab, 0xc1, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6b, 0x9f, 0xc0, 0xf1, 0x66, 0xa6, 0x8b, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x69, 0xa2, 0x43, 0xf6, 0x8a, 0x6e, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf6, 0x8b, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf4, 0xf0, 0xff, 0xf8, 0xf4, 0xf0, 0xff, 0xf5, 0xf1, 0xeb, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8d, 0x73, 0x74, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0x95, 0x7d, 0x7d, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xed, 0xe6, 0xe1, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf8, 0xf4, 0xf0, 0xff, 0xf8, 0xf4, 0xf0, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x93, 0xb1, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf1, 0x69, 0xa1, 0xaf, 0xf1, 0x66, 0xa6, 0x88, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3f, 0xf6, 0x87, 0x73, 0xd7, 0xf6, 0x89, 0x70, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf6, 0x88, 0x71, 0xff, 0xfd, 0xe5, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf7, 0xf4, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf6, 0xf3, 0xef, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8d, 0x74, 0x75, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0x95, 0x7d, 0x7e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xed, 0xe7, 0xe3, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xed, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x74, 0x9b, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x99, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf1, 0x66, 0xa5, 0x97, 0xf1, 0x66, 0xa6, 0x88, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3c, 0xf5, 0x83, 0x7a, 0xab, 0xf6, 0x89, 0x71, 0xff, 0xf6, 0x88, 0x71, 0xff, 0xf6, 0x88, 0x72, 0xff, 0xfb, 0xc5, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8d, 0x74, 0x75, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0x95, 0x7e, 0x7e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xee, 0xe8, 0xe4, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf8, 0xf5, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xfb, 0xf8, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe2, 0xea, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf2, 0x6e, 0x99, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9c, 0xeb, 0xf1, 0x66, 0xa6, 0x93, 0xf1, 0x66, 0xa6, 0x87, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3c, 0xf4, 0x7b, 0x85, 0x7f, 0xf6, 0x88, 0x72, 0xff, 0xf6, 0x88, 0x72, 0xff, 0xf6, 0x87, 0x73, 0xff, 0xf8, 0xa5, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf7, 0xf4, 0xef, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8d, 0x74, 0x75, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0x96, 0x7e, 0x7e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xef, 0xe9, 0xe5, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xfd, 0xfb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xb8, 0xcd, 0xff, 0xf2, 0x6e, 0x99, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6b, 0x9f, 0xd3, 0xf1, 0x66, 0xa6, 0x90, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x7b, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x3b, 0xf2, 0x6b, 0x9e, 0x4c, 0xf6, 0x87, 0x73, 0xff, 0xf6, 0x87, 0x73, 0xff, 0xf6, 0x86, 0x74, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xfe, 0xf6, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf9, 0xf6, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf8, 0xf6, 0xf3, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8d, 0x74, 0x76, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0x96, 0x7e, 0x7f, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xef, 0xea, 0xe7, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x87, 0xab, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf1, 0x69, 0xa2, 0xbb, 0xf1, 0x66, 0xa6, 0x8f, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x40, 0xf6, 0x85, 0x77, 0xd7, 0xf6, 0x86, 0x74, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x76, 0xff, 0xfb, 0xc9, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xf8, 0xf6, 0xf2, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0x7d, 0x61, 0x63, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x9c, 0x86, 0x87, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xa6, 0x92, 0x92, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x75, 0x57, 0x59, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe7, 0xee, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf1, 0x66, 0xa5, 0x9b, 0xf1, 0x66, 0xa6, 0x8b, 0xf1, 0x66, 0xa6, 0x80, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x3f, 0xf5, 0x7e, 0x81, 0x9b, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x76, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf7, 0x97, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfa, 0xf7, 0xff, 0xfb, 0xf9, 0xf6, 0xff, 0xfa, 0xf8, 0xf4, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xb8, 0xa7, 0xa6, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6f, 0x4f, 0x52, 0xff, 0xd6, 0xcc, 0xca, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xde, 0xd5, 0xd2, 0xff, 0x70, 0x51, 0x54, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xaf, 0x9d, 0x9d, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf7, 0xf3, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfb, 0xf9, 0xf6, 0xff, 0xfb, 0xf9, 0xf6, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xa5, 0xc1, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6b, 0x9f, 0xe3, 0xf1, 0x66, 0xa6, 0x93, 0xf1, 0x66, 0xa6, 0x88, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3c, 0xf2, 0x6f, 0x99, 0x57, 0xf5, 0x85, 0x76, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x84, 0x78, 0xff, 0xf5, 0x84, 0x78, 0xff, 0xfd, 0xe5, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf8, 0xf6, 0xf3, 0xff, 0xb3, 0xa2, 0xa2, 0xff, 0x74, 0x55, 0x58, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x7c, 0x5f, 0x61, 0xff, 0xc9, 0xbc, 0xbb, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xcf, 0xc4, 0xc3, 0xff, 0x7f, 0x63, 0x65, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x72, 0x54, 0x56, 0xff, 0xac, 0x9a, 0x9a, 0xff, 0xf7, 0xf4, 0xf1, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfd, 0xfb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf2, 0xf6, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf1, 0x69, 0xa2, 0xbf, 0xf1, 0x66, 0xa6, 0x8f, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x7b, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x43, 0xf5, 0x80, 0x7d, 0xc7, 0xf5, 0x84, 0x78, 0xff, 0xf5, 0x84, 0x79, 0xff, 0xf5, 0x83, 0x79, 0xff, 0xf7, 0xa0, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfb, 0xfa, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xfa, 0xf7, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xf7, 0xf4, 0xf1, 0xff, 0xee, 0xe9, 0xe7, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xee, 0xe9, 0xe7, 0xff, 0xf6, 0xf3, 0xf0, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfb, 0xf9, 0xf6, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xa6, 0xc2, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xf7, 0xf1, 0x66, 0xa6, 0x94, 0xf1, 0x66, 0xa6, 0x8b, 0xf1, 0x66, 0xa6, 0x80, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x40, 0xf3, 0x79, 0x89, 0x83, 0xf5, 0x83, 0x79, 0xff, 0xf5, 0x83, 0x7a, 0xff, 0xf5, 0x82, 0x7a, 0xff, 0xf5, 0x82, 0x7b, 0xff, 0xfd, 0xe2, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfc, 0xfa, 0xf9, 0xff, 0xfc, 0xfa, 0xf9, 0xff, 0xfc, 0xf9, 0xf8, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf9, 0xff, 0xfc, 0xfa, 0xf9, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xea, 0xf1, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x69, 0xa1, 0xc7, 0xf1, 0x66, 0xa6, 0x90, 0xf1, 0x66, 0xa6, 0x87, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x44, 0xf4, 0x7f, 0x80, 0xc3, 0xf5, 0x82, 0x7b, 0xff, 0xf5, 0x82, 0x7b, 0xff, 0xf5, 0x81, 0x7c, 0xff, 0xf7, 0x97, 0x94, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf8, 0xff, 0xfc, 0xfa, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfd, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x96, 0xb8, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xf7, 0xf1, 0x66, 0xa6, 0x97, 0xf1, 0x66, 0xa6, 0x8c, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x43, 0xf3, 0x76, 0x8d, 0x80, 0xf5, 0x82, 0x7b, 0xff, 0xf5, 0x81, 0x7c, 0xff, 0xf5, 0x81, 0x7d, 0xff, 0xf5, 0x80, 0x7e, 0xff, 0xf8, 0xa9, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfd, 0xfb, 0xfa, 0xff, 0xfd, 0xfb, 0xfa, 0xff, 0xfd, 0xfb, 0xf9, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf9, 0xff, 0xfd, 0xfb, 0xfa, 0xff, 0xfd, 0xfb, 0xfa, 0xff, 0xfd, 0xfb, 0xfa, 0xff, 0xfe, 0xfc, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xb8, 0xd0, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x68, 0xa2, 0xc0, 0xf1, 0x66, 0xa6, 0x90, 0xf1, 0x66, 0xa6, 0x87, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x47, 0xf4, 0x7b, 0x85, 0xac, 0xf5, 0x80, 0x7d, 0xff, 0xf5, 0x80, 0x7e, 0xff, 0xf5, 0x80, 0x7f, 0xff, 0xf5, 0x7f, 0x7f, 0xff, 0xfa, 0xc3, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe0, 0xea, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x69, 0xa1, 0xdc, 0xf1, 0x66, 0xa6, 0x94, 0xf1, 0x66, 0xa6, 0x8b, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x4b, 0xf4, 0x7d, 0x83, 0xc8, 0xf5, 0x7f, 0x7f, 0xff, 0xf4, 0x7f, 0x80, 0xff, 0xf4, 0x7e, 0x80, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xfc, 0xd7, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfb, 0xff, 0xfe, 0xfd, 0xfb, 0xff, 0xfe, 0xfd, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfd, 0xfb, 0xff, 0xfe, 0xfd, 0xfb, 0xff, 0xfe, 0xfd, 0xfb, 0xff, 0xfe, 0xfd, 0xfb, 0xff, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf2, 0xf7, 0xff, 0xf5, 0x89, 0xb0, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xf4, 0xf1, 0x66, 0xa6, 0x9c, 0xf1, 0x66, 0xa6, 0x8f, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x47, 0xf2, 0x6c, 0x9d, 0x5f, 0xf4, 0x7e, 0x82, 0xec, 0xf4, 0x7e, 0x81, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf4, 0x7d, 0x83, 0xff, 0xfc, 0xe1, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfc, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xf5, 0x8d, 0xb4, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf1, 0x68, 0xa3, 0xbb, 0xf1, 0x66, 0xa6, 0x90, 0xf1, 0x66, 0xa6, 0x88, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x4b, 0xf3, 0x73, 0x91, 0x87, 0xf4, 0x7e, 0x82, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf4, 0x7d, 0x83, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf6, 0x93, 0x9b, 0xff, 0xfc, 0xe0, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf2, 0xf6, 0xff, 0xf5, 0x8c, 0xb4, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf2, 0x69, 0xa2, 0xd3, 0xf1, 0x66, 0xa6, 0x93, 0xf1, 0x66, 0xa6, 0x8b, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x4f, 0xf3, 0x76, 0x8d, 0xa3, 0xf4, 0x7c, 0x83, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x7c, 0x85, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xfa, 0xc8, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe0, 0xea, 0xff, 0xf5, 0x88, 0xb1, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf2, 0x69, 0xa1, 0xdf, 0xf1, 0x66, 0xa6, 0x94, 0xf1, 0x66, 0xa6, 0x8c, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x7b, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x50, 0xf3, 0x77, 0x8c, 0xb0, 0xf4, 0x7b, 0x85, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf4, 0x79, 0x88, 0xff, 0xf8, 0xab, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xb9, 0xd1, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf1, 0x68, 0xa2, 0xe3, 0xf1, 0x66, 0xa6, 0x94, 0xf1, 0x66, 0xa6, 0x8c, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x53, 0xf3, 0x76, 0x8e, 0xb3, 0xf4, 0x7a, 0x87, 0xff, 0xf4, 0x7a, 0x88, 0xff, 0xf4, 0x79, 0x88, 0xff, 0xf4, 0x79, 0x89, 0xff, 0xf4, 0x78, 0x8a, 0xff, 0xf6, 0x93, 0xa1, 0xff, 0xfd, 0xe3, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe8, 0xf0, 0xff, 0xf6, 0x94, 0xb9, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf1, 0x68, 0xa2, 0xdf, 0xf1, 0x66, 0xa6, 0x94, 0xf1, 0x66, 0xa6, 0x8c, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x54, 0xf3, 0x72, 0x94, 0x94, 0xf4, 0x79, 0x8a, 0xf4, 0xf4, 0x79, 0x89, 0xff, 0xf4, 0x78, 0x8a, 0xff, 0xf3, 0x78, 0x8b, 0xff, 0xf3, 0x77, 0x8b, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf7, 0xa0, 0xb0, 0xff, 0xfd, 0xea, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf3, 0xf7, 0xff, 0xf7, 0xa3, 0xc2, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf1, 0x68, 0xa3, 0xd0, 0xf1, 0x66, 0xa6, 0x93, 0xf1, 0x66, 0xa6, 0x8c, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x57, 0xf2, 0x6c, 0x9d, 0x73, 0xf4, 0x76, 0x8d, 0xdc, 0xf3, 0x78, 0x8b, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x76, 0x8d, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x75, 0x8e, 0xff, 0xf6, 0x9d, 0xaf, 0xff, 0xfd, 0xe2, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe7, 0xef, 0xff, 0xf7, 0xa4, 0xc3, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf1, 0x6a, 0xa1, 0xf7, 0xf1, 0x67, 0xa4, 0xb8, 0xf1, 0x66, 0xa6, 0x90, 0xf1, 0x66, 0xa6, 0x8b, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x5c, 0xf3, 0x73, 0x92, 0xbb, 0xf3, 0x76, 0x8d, 0xff, 0xf3, 0x76, 0x8d, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x74, 0x90, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf4, 0x7e, 0x9a, 0xff, 0xf8, 0xb0, 0xc1, 0xff, 0xfc, 0xdf, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe1, 0xeb, 0xff, 0xf9, 0xb7, 0xce, 0xff, 0xf4, 0x86, 0xae, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf1, 0x68, 0xa2, 0xdb, 0xf1, 0x66, 0xa6, 0x9b, 0xf1, 0x66, 0xa6, 0x8f, 0xf1, 0x66, 0xa6, 0x88, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x7b, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x5c, 0xf2, 0x6f, 0x99, 0x97, 0xf3, 0x73, 0x91, 0xdf, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x75, 0x90, 0xff, 0xf3, 0x74, 0x90, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x72, 0x93, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf3, 0x72, 0x95, 0xff, 0xf5, 0x8c, 0xa9, 0xff, 0xf7, 0xa6, 0xbe, 0xff, 0xf9, 0xbb, 0xcd, 0xff, 0xfa, 0xcd, 0xda, 0xff, 0xfb, 0xd3, 0xdf, 0xff, 0xfc, 0xd9, 0xe4, 0xff, 0xfb, 0xd5, 0xe1, 0xff, 0xfb, 0xce, 0xdd, 0xff, 0xf9, 0xbf, 0xd3, 0xff, 0xf7, 0xa9, 0xc4, 0xff, 0xf5, 0x90, 0xb3, 0xff, 0xf2, 0x72, 0x9f, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf2, 0x6a, 0xa0, 0xf7, 0xf1, 0x68, 0xa3, 0xbc, 0xf1, 0x66, 0xa6, 0x90, 0xf1, 0x66, 0xa6, 0x8b, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x63, 0xf2, 0x6e, 0x99, 0xa0, 0xf3, 0x73, 0x93, 0xe4, 0xf3, 0x73, 0x91, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x73, 0x93, 0xff, 0xf3, 0x72, 0x93, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf3, 0x71, 0x95, 0xff, 0xf3, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x96, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x99, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf2, 0x6a, 0xa0, 0xf7, 0xf1, 0x68, 0xa3, 0xc4, 0xf1, 0x66, 0xa6, 0x90, 0xf1, 0x66, 0xa6, 0x8c, 0xf1, 0x66, 0xa6, 0x87, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x67, 0xf2, 0x6d, 0x9b, 0x9b, 0xf3, 0x6f, 0x97, 0xc7, 0xf3, 0x72, 0x93, 0xfb, 0xf3, 0x72, 0x94, 0xff, 0xf3, 0x71, 0x95, 0xff, 0xf3, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x96, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf2, 0x6e, 0x99, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x69, 0xa1, 0xe0, 0xf2, 0x68, 0xa3, 0xbb, 0xf1, 0x66, 0xa6, 0x8f, 0xf1, 0x66, 0xa6, 0x8b, 0xf1, 0x66, 0xa6, 0x87, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x6c, 0xf2, 0x6b, 0x9e, 0x9c, 0xf2, 0x6e, 0x9b, 0xc0, 0xf2, 0x6f, 0x98, 0xe0, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf2, 0x6e, 0x99, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6a, 0x9f, 0xe8, 0xf2, 0x69, 0xa1, 0xcf, 0xf1, 0x68, 0xa3, 0xb4, 0xf1, 0x66, 0xa6, 0x93, 0xf1, 0x66, 0xa6, 0x8b, 0xf1, 0x66, 0xa6, 0x88, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x80, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x69, 0xa1, 0x93, 0xf2, 0x6a, 0x9f, 0xaf, 0xf2, 0x6b, 0x9e, 0xc3, 0xf2, 0x6c, 0x9d, 0xd3, 0xf2, 0x6c, 0x9d, 0xdb, 0xf2, 0x6c, 0x9d, 0xdf, 0xf2, 0x6c, 0x9e, 0xdc, 0xf2, 0x6b, 0x9e, 0xd7, 0xf2, 0x6a, 0xa0, 0xcc, 0xf2, 0x69, 0xa2, 0xbb, 0xf1, 0x68, 0xa3, 0xa7, 0xf1, 0x66, 0xa6, 0x8c, 0xf1, 0x66, 0xa6, 0x88, 0xf1, 0x66, 0xa6, 0x87, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x80, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x7b, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x7b, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x7b, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
+};
+
+const lv_image_dsc_t img_lv_demo_music_btn_list_pause = {
+    .header.w = 106,
+    .header.h = 105,
+    .header.stride = 424,
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .data = img_lv_demo_music_btn_list_pause_map,
+    .data_size = sizeof(img_lv_demo_music_btn_list_pause_map),
+};
+#endif
+
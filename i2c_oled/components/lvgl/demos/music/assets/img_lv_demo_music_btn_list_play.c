@@ -0,0 +1,82 @@
+#include "../lv_demo_music.h"
+#if LV_USE_DEMO_MUSIC  && !LV_DEMO_MUSIC_LARGE
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t img_lv_demo_music_btn_list_play_map[] = {
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x07, 0xfd, 0xb8, 0xcc, 0x14, 0xfd, 0xb8, 0xcc, 0x20, 0xfd, 0xb8, 0xcc, 0x28, 0xfd, 0xb8, 0xcc, 0x24, 0xfd, 0xb8, 0xcc, 0x1b, 0xfd, 0xb8, 0xcc, 0x08, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x0f, 0xfd, 0xb8, 0xcc, 0x33, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x18, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x1b, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfb, 0xba, 0xcc, 0x38, 0xf2, 0xc7, 0xcc, 0x54, 0xee, 0xcd, 0xcb, 0x6b, 0xec, 0xcf, 0xcb, 0x78, 0xed, 0xcd, 0xcb, 0x6f, 0xf0, 0xc9, 0xcb, 0x5c, 0xf9, 0xbd, 0xcc, 0x3c, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x20, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x03, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfb, 0xba, 0xcc, 0x38, 0xec, 0xcf, 0xcb, 0x78, 0xe7, 0xd6, 0xcb, 0xc0, 0xe5, 0xda, 0xcc, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xee, 0xe6, 0xdc, 0xff, 0xec, 0xe4, 0xda, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe7, 0xd7, 0xcb, 0xd0, 0xea, 0xd2, 0xcb, 0x8b, 0xf8, 0xbf, 0xcc, 0x40, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x17, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x18, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xea, 0xd2, 0xcb, 0x90, 0xe5, 0xda, 0xcc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xf6, 0xf2, 0xee, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xf8, 0xf5, 0xf2, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe9, 0xd4, 0xcb, 0x9f, 0xf8, 0xbf, 0xcc, 0x40, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x23, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x1b, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xef, 0xcb, 0xcb, 0x64, 0xe7, 0xd6, 0xcb, 0xb7, 0xed, 0xe5, 0xdb, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfc, 0xfc, 0xfb, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xe6, 0xda, 0xcc, 0xff, 0xeb, 0xd1, 0xcb, 0x83, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x28, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x17, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xeb, 0xd0, 0xcb, 0x80, 0xe6, 0xdb, 0xcd, 0xff, 0xf5, 0xf0, 0xeb, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xe8, 0xde, 0xd1, 0xff, 0xe9, 0xd3, 0xcb, 0x98, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x23, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xeb, 0xd0, 0xcb, 0x80, 0xe7, 0xdb, 0xce, 0xff, 0xf8, 0xf4, 0xf1, 0xff, 0xfc, 0xfc, 0xfa, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfb, 0xf9, 0xf6, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xd3, 0xcb, 0x9c, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x17, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x2b, 0xfd, 0xb8, 0xcc, 0x37, 0xf2, 0xc7, 0xcc, 0x57, 0xe6, 0xda, 0xcc, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfc, 0xfb, 0xfa, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xeb, 0xd1, 0xcb, 0x83, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x0b, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xe8, 0xd5, 0xcb, 0xab, 0xf2, 0xec, 0xe5, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xf6, 0xf3, 0xef, 0xff, 0xe5, 0xda, 0xcc, 0xff, 0xf9, 0xbd, 0xcc, 0x3f, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x20, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xec, 0xcf, 0xcb, 0x77, 0xea, 0xe0, 0xd4, 0xff, 0xfa, 0xf9, 0xf7, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf8, 0xf5, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xe9, 0xd4, 0xcb, 0x9c, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xe7, 0xd7, 0xcb, 0xc8, 0xf4, 0xf0, 0xea, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0x9c, 0x86, 0x87, 0xff, 0x7e, 0x61, 0x64, 0xff, 0xc1, 0xb2, 0xb1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf9, 0xf7, 0xf3, 0xff, 0xf8, 0xf6, 0xf2, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xf8, 0xbe, 0xcc, 0x3f, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x14, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x1f, 0xfd, 0xb8, 0xcc, 0x37, 0xf2, 0xc7, 0xcc, 0x57, 0xe8, 0xde, 0xd1, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x89, 0x6e, 0x70, 0xff, 0xce, 0xc2, 0xc0, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf8, 0xf4, 0xf1, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xed, 0xe4, 0xdb, 0xff, 0xeb, 0xd1, 0xcb, 0x87, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xe9, 0xd3, 0xcb, 0x98, 0xef, 0xe7, 0xde, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0x7a, 0x5d, 0x5f, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x95, 0x7d, 0x7e, 0xff, 0xdb, 0xd2, 0xce, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xee, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf4, 0xee, 0xe8, 0xff, 0xe7, 0xd7, 0xcb, 0xc8, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xe7, 0xd7, 0xcb, 0xcb, 0xf3, 0xed, 0xe6, 0xff, 0xf6, 0xf1, 0xec, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0x7a, 0x5d, 0x5f, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xa1, 0x8c, 0x8b, 0xff, 0xe7, 0xdf, 0xda, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf7, 0xf2, 0xed, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xe5, 0xda, 0xcc, 0xff, 0xfb, 0xbb, 0xcc, 0x3b, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x07, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xe5, 0xd8, 0xcb, 0xef, 0xf5, 0xf0, 0xeb, 0xff, 0xf3, 0xee, 0xe9, 0xff, 0xf3, 0xee, 0xe8, 0xff, 0xf3, 0xee, 0xe8, 0xff, 0xf3, 0xee, 0xe8, 0xff, 0xf3, 0xee, 0xe8, 0xff, 0xf3, 0xee, 0xe8, 0xff, 0xf3, 0xee, 0xe8, 0xff, 0xf3, 0xee, 0xe8, 0xff, 0x7a, 0x5d, 0x5f, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x72, 0x53, 0x56, 0xff, 0xb0, 0x9e, 0x9c, 0xff, 0xf0, 0xea, 0xe4, 0xff, 0xf3, 0xee, 0xe8, 0xff, 0xf3, 0xee, 0xe8, 0xff, 0xf3, 0xee, 0xe8, 0xff, 0xf3, 0xee, 0xe8, 0xff, 0xf3, 0xee, 0xe8, 0xff, 0xf5, 0xf0, 0xeb, 0xff, 0xf6, 0xf3, 0xee, 0xff, 0xe8, 0xdd, 0xd0, 0xff, 0xf2, 0xc7, 0xcc, 0x57, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x17, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xb8, 0xcc, 0x07, 0xfd, 0xb8, 0xcc, 0x37, 0xfc, 0xb9, 0xcc, 0x38, 0xe5, 0xd9, 0xcb, 0xff, 0xf5, 0xf1, 0xeb, 0xff, 0xf2, 0xec, 0xe5, 0xff, 0xf2, 0xec, 0xe5, 0xff, 0xf2, 0xec, 0xe5, 0xff, 0xf2, 0xec, 0xe5, 0xff, 0xf2, 0xec, 0xe5, 0xff, 0xf2, 0xec, 0xe5, 0xff, 0xf2, 0xec, 0xe5, 0xff, 0xf2, 0xec, 0xe5, 0xff, 0x7a, 0x5d, 0x5f, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x7d, 0x60, 0x62, 0xff, 0xc0, 0xb1, 0xad, 0xff, 0xf2, 0xec, 0xe5, 0xff, 0xf2, 0xec, 0xe5, 0xff, 0xf2, 0xec, 0xe5, 0xff, 0xf2, 0xec, 0xe5, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf6, 0xf1, 0xec, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xef, 0xcc, 0xcb, 0x68, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x1f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xb8, 0xcc, 0x08, 0xfd, 0xb8, 0xcc, 0x37, 0xf9, 0xbe, 0xcc, 0x3f, 0xe6, 0xda, 0xcc, 0xff, 0xf4, 0xef, 0xea, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0x7a, 0x5c, 0x5e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf5, 0xf0, 0xeb, 0xff, 0xea, 0xe0, 0xd4, 0xff, 0xed, 0xcd, 0xcb, 0x70, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x24, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xb8, 0xcc, 0x07, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xe5, 0xd9, 0xcb, 0xfc, 0xf4, 0xef, 0xe9, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0x7a, 0x5c, 0x5e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x75, 0x57, 0x59, 0xff, 0xb6, 0xa4, 0xa1, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xf2, 0xec, 0xe5, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xe8, 0xde, 0xd2, 0xff, 0xef, 0xcb, 0xcb, 0x64, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x1c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xe6, 0xd8, 0xcb, 0xe3, 0xf1, 0xeb, 0xe3, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xef, 0xe7, 0xde, 0xff, 0xef, 0xe7, 0xde, 0xff, 0xef, 0xe7, 0xde, 0xff, 0xef, 0xe7, 0xde, 0xff, 0xef, 0xe7, 0xde, 0xff, 0xef, 0xe7, 0xde, 0xff, 0xef, 0xe7, 0xde, 0xff, 0x7a, 0x5c, 0x5e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xa5, 0x8f, 0x8d, 0xff, 0xe5, 0xdb, 0xd3, 0xff, 0xef, 0xe7, 0xde, 0xff, 0xef, 0xe7, 0xde, 0xff, 0xef, 0xe7, 0xde, 0xff, 0xef, 0xe7, 0xde, 0xff, 0xef, 0xe7, 0xde, 0xff, 0xf2, 0xeb, 0xe3, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xf4, 0xc4, 0xcc, 0x4b, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x10, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xe7, 0xd6, 0xcb, 0xbb, 0xee, 0xe6, 0xdd, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0x7a, 0x5c, 0x5e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x98, 0x80, 0x7f, 0xff, 0xd7, 0xcb, 0xc4, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xf1, 0xeb, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xe5, 0xd8, 0xcb, 0xec, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x33, 0xfd, 0xb8, 0xcc, 0x37, 0xeb, 0xd1, 0xcb, 0x84, 0xea, 0xe0, 0xd5, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0x79, 0x5b, 0x5d, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x89, 0x6f, 0x6f, 0xff, 0xcb, 0xbc, 0xb5, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xee, 0xe6, 0xdc, 0xff, 0xf1, 0xeb, 0xe3, 0xff, 0xed, 0xe4, 0xdb, 0xff, 0xe8, 0xd5, 0xcb, 0xb4, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x14, 0xfd, 0xb8, 0xcc, 0x37, 0xf7, 0xc0, 0xcc, 0x43, 0xe6, 0xda, 0xcc, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xec, 0xe4, 0xda, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x7e, 0x61, 0x63, 0xff, 0xbd, 0xac, 0xa6, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xeb, 0xe3, 0xd8, 0xff, 0xef, 0xe7, 0xde, 0xff, 0xf1, 0xea, 0xe2, 0xff, 0xe8, 0xde, 0xd1, 0xff, 0xee, 0xcd, 0xcb, 0x6c, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x2f, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xe8, 0xd4, 0xcb, 0xa7, 0xeb, 0xe2, 0xd7, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0x93, 0x7a, 0x79, 0xff, 0x7a, 0x5c, 0x5e, 0xff, 0xaf, 0x9b, 0x96, 0xff, 0xea, 0xdf, 0xd4, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xfd, 0xb9, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x07, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x27, 0xfd, 0xb8, 0xcc, 0x37, 0xf2, 0xc7, 0xcc, 0x54, 0xe6, 0xda, 0xcc, 0xff, 0xee, 0xe6, 0xde, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xe9, 0xde, 0xd3, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xea, 0xdf, 0xd4, 0xff, 0xee, 0xe5, 0xdc, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xe7, 0xdc, 0xd0, 0xff, 0xeb, 0xd1, 0xcb, 0x84, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xe9, 0xd4, 0xcb, 0x9c, 0xe8, 0xdd, 0xd1, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xe8, 0xde, 0xd1, 0xff, 0xe8, 0xdd, 0xd0, 0xff, 0xe8, 0xdd, 0xd0, 0xff, 0xe8, 0xdd, 0xd0, 0xff, 0xe8, 0xdd, 0xd0, 0xff, 0xe8, 0xdd, 0xd0, 0xff, 0xe8, 0xdd, 0xd0, 0xff, 0xe8, 0xdd, 0xd0, 0xff, 0xe8, 0xdd, 0xd0, 0xff, 0xe8, 0xdd, 0xd0, 0xff, 0xe8, 0xdd, 0xd0, 0xff, 0xe8, 0xdd, 0xd0, 0xff, 0xe8, 0xdd, 0xd0, 0xff, 0xe8, 0xdd, 0xd0, 0xff, 0xe8, 0xdd, 0xd0, 0xff, 0xe8, 0xdd, 0xd0, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xe8, 0xd5, 0xcb, 0xab, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x14, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x20, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xe8, 0xd5, 0xcb, 0xab, 0xea, 0xdf, 0xd4, 0xff, 0xed, 0xe4, 0xdb, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xe8, 0xdc, 0xd0, 0xff, 0xe7, 0xdb, 0xce, 0xff, 0xe7, 0xdb, 0xce, 0xff, 0xe7, 0xdb, 0xce, 0xff, 0xe7, 0xdb, 0xce, 0xff, 0xe7, 0xdb, 0xce, 0xff, 0xe7, 0xdb, 0xce, 0xff, 0xe7, 0xdb, 0xce, 0xff, 0xe7, 0xdb, 0xce, 0xff, 0xe7, 0xdb, 0xce, 0xff, 0xe7, 0xdb, 0xce, 0xff, 0xe7, 0xdb, 0xce, 0xff, 0xe7, 0xdb, 0xce, 0xff, 0xe7, 0xdb, 0xce, 0xff, 0xe8, 0xdd, 0xd0, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xee, 0xe5, 0xdc, 0xff, 0xec, 0xe2, 0xd7, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xf2, 0xc7, 0xcc, 0x53, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x2f, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xf5, 0xc3, 0xcc, 0x4b, 0xe8, 0xd5, 0xcb, 0xac, 0xe9, 0xde, 0xd3, 0xff, 0xed, 0xe4, 0xdb, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe7, 0xdb, 0xcf, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xec, 0xe2, 0xd8, 0xff, 0xed, 0xe4, 0xdb, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xed, 0xcf, 0xcb, 0x77, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xf7, 0xc1, 0xcc, 0x44, 0xe8, 0xd5, 0xcb, 0xab, 0xe7, 0xdc, 0xcf, 0xff, 0xeb, 0xe3, 0xd8, 0xff, 0xec, 0xe3, 0xd8, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe7, 0xdb, 0xce, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe6, 0xda, 0xcc, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe8, 0xde, 0xd2, 0xff, 0xea, 0xe1, 0xd6, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe4, 0xd9, 0xff, 0xe8, 0xde, 0xd2, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xed, 0xcd, 0xcb, 0x6f, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x17, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xe9, 0xd3, 0xcb, 0x9b, 0xe5, 0xda, 0xcc, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xec, 0xe2, 0xd7, 0xff, 0xec, 0xe3, 0xd8, 0xff, 0xeb, 0xe2, 0xd6, 0xff, 0xea, 0xe0, 0xd4, 0xff, 0xe9, 0xdf, 0xd2, 0xff, 0xe8, 0xde, 0xd2, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xea, 0xe1, 0xd5, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xec, 0xe3, 0xd8, 0xff, 0xec, 0xe3, 0xd8, 0xff, 0xea, 0xdf, 0xd3, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe8, 0xd4, 0xcb, 0xa8, 0xf7, 0xc0, 0xcc, 0x43, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x18, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x34, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xf4, 0xc4, 0xcc, 0x4c, 0xe9, 0xd4, 0xcb, 0xa0, 0xe5, 0xd9, 0xcb, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe9, 0xdf, 0xd2, 0xff, 0xeb, 0xe0, 0xd5, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xec, 0xe2, 0xd7, 0xff, 0xec, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd5, 0xff, 0xea, 0xdf, 0xd3, 0xff, 0xe8, 0xdd, 0xd0, 0xff, 0xe6, 0xda, 0xcc, 0xff, 0xe7, 0xd6, 0xcb, 0xb8, 0xef, 0xcc, 0xcb, 0x64, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x14, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x1f, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xf9, 0xbd, 0xcc, 0x3c, 0xec, 0xd0, 0xcb, 0x7b, 0xe8, 0xd5, 0xcb, 0xb3, 0xe6, 0xd7, 0xcb, 0xd8, 0xe5, 0xd8, 0xcb, 0xf0, 0xe5, 0xd9, 0xcb, 0xfc, 0xe5, 0xd9, 0xcb, 0xf3, 0xe6, 0xd8, 0xcb, 0xe0, 0xe7, 0xd6, 0xcb, 0xbc, 0xeb, 0xd1, 0xcb, 0x8b, 0xf5, 0xc2, 0xcc, 0x48, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x27, 0xeb, 0xe1, 0xd7, 0x00, 0xeb, 0xe1, 0xd7, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x23, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x30, 0xfd, 0xb8, 0xcc, 0x03, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x10, 0xfd, 0xb8, 0xcc, 0x2c, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x37, 0xfd, 0xb8, 0xcc, 0x33, 0xfd, 0xb8, 0xcc, 0x17, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x07, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xe5, 0xd9, 0xcb, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xfd, 0xb8, 0xcc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+};
+
+const lv_image_dsc_t img_lv_demo_music_btn_list_play = {
+    .header.w = 58,
+    .header.h = 60,
+    .header.stride = 232,
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .data = img_lv_demo_music_btn_list_play_map,
+    .data_size = sizeof(img_lv_demo_music_btn_list_play_map),
+};
+
+
+#endif /*LV_USE_DEMO_MUSIC*/
+
@@ -0,0 +1,84 @@
+#include "../lv_demo_music.h"
+#if LV_USE_DEMO_MUSIC  && !LV_DEMO_MUSIC_LARGE
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t img_lv_demo_music_btn_next_map[] = {
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xf9, 0xbc, 0xd2, 0x30, 0xfd, 0xe7, 0xef, 0x67, 0xfe, 0xf1, 0xf6, 0x88, 0xfe, 0xf3, 0xf7, 0x94, 0xfe, 0xf3, 0xf7, 0x94, 0xfe, 0xf1, 0xf5, 0x87, 0xfd, 0xe7, 0xef, 0x63, 0xf9, 0xb7, 0xce, 0x2c, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf6, 0x96, 0xb8, 0x20, 0xfd, 0xed, 0xf3, 0x78, 0xff, 0xfc, 0xfd, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfc, 0xcc, 0xfd, 0xec, 0xf2, 0x73, 0xf5, 0x8b, 0xb1, 0x1c, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfd, 0xe6, 0xee, 0x64, 0xff, 0xfd, 0xfe, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xe3, 0xfd, 0xe3, 0xec, 0x5f, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf5, 0x8b, 0xb1, 0x1c, 0xfe, 0xf6, 0xf9, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf5, 0xf8, 0x9c, 0xf3, 0x7c, 0xa7, 0x1b, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf5, 0x8b, 0xb1, 0x1c, 0xff, 0xfa, 0xfc, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xfa, 0xb4, 0xf3, 0x7c, 0xa7, 0x1b, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfe, 0xf6, 0xf9, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf5, 0xf8, 0x9c, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfd, 0xea, 0xf1, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe6, 0xee, 0x63, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf7, 0xaa, 0xc6, 0x27, 0xff, 0xfe, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xe7, 0xf6, 0x96, 0xb8, 0x20, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfe, 0xf1, 0xf6, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xee, 0xf4, 0x7c, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf3, 0x78, 0xa4, 0x1b, 0xff, 0xfd, 0xfe, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xc2, 0xc3, 0xff, 0xe1, 0xdb, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xd8, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x17, 0xfc, 0xd8, 0xe5, 0x47, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 0x6c, 0x6e, 0xff, 0x93, 0x7b, 0x7d, 0xff, 0xea, 0xe5, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x50, 0x53, 0xff, 0x9a, 0x83, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xcc, 0xdd, 0x3b, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfe, 0xef, 0xf4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6e, 0x4e, 0x51, 0xff, 0xb5, 0xa4, 0xa6, 0xff, 0xfb, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x98, 0x81, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xeb, 0xf2, 0x70, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfe, 0xf6, 0xf9, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0x5c, 0x5e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x7e, 0x61, 0x64, 0xff, 0xc6, 0xba, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x98, 0x81, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf4, 0xf8, 0x94, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfe, 0xf9, 0xfb, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0x5c, 0x5e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x90, 0x78, 0x7a, 0xff, 0xda, 0xd2, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x98, 0x81, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xf9, 0xa7, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfe, 0xf9, 0xfb, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0x5c, 0x5e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x98, 0x81, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xf9, 0xa8, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfe, 0xf6, 0xf9, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0x5c, 0x5e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x89, 0x6f, 0x72, 0xff, 0xd3, 0xc9, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x98, 0x81, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf5, 0xf8, 0x9b, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfe, 0xf1, 0xf5, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0x5c, 0x5e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x7a, 0x5c, 0x5f, 0xff, 0xc0, 0xb2, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x98, 0x81, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xed, 0xf3, 0x78, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfc, 0xdf, 0xe9, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xad, 0x9b, 0x9d, 0xff, 0xf7, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x98, 0x81, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xd7, 0xe4, 0x44, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf5, 0x8f, 0xb3, 0x1f, 0xff, 0xfe, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x69, 0x6b, 0xff, 0x8e, 0x75, 0x77, 0xff, 0xe3, 0xdd, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x51, 0x54, 0xff, 0x9b, 0x85, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xe7, 0xf3, 0x78, 0xa4, 0x1b, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfe, 0xf5, 0xf8, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xd2, 0xd3, 0xff, 0xeb, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf3, 0xf7, 0x8f, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfa, 0xc4, 0xd7, 0x34, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf4, 0xf8, 0xb4, 0xcd, 0x2b, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfe, 0xf1, 0xf6, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xef, 0xf4, 0x7f, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf4, 0x81, 0xaa, 0x1c, 0xff, 0xfa, 0xfc, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfc, 0xbf, 0xf3, 0x78, 0xa4, 0x1b, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf8, 0xb4, 0xcd, 0x2b, 0xff, 0xfc, 0xfd, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xd4, 0xf7, 0xa6, 0xc3, 0x27, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf8, 0xb2, 0xcb, 0x2c, 0xff, 0xfb, 0xfc, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfc, 0xc3, 0xf7, 0xaa, 0xc6, 0x27, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf4, 0x85, 0xad, 0x1c, 0xfe, 0xf3, 0xf7, 0x90, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf7, 0xfe, 0xf1, 0xf5, 0x87, 0xf3, 0x7c, 0xa7, 0x1b, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xfa, 0xc7, 0xd9, 0x37, 0xfe, 0xf6, 0xf9, 0xa4, 0xff, 0xfe, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xf3, 0xfe, 0xf5, 0xf8, 0x9f, 0xfa, 0xc1, 0xd5, 0x33, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf6, 0x98, 0xba, 0x20, 0xfd, 0xe3, 0xec, 0x5c, 0xfe, 0xf3, 0xf7, 0x90, 0xfe, 0xf8, 0xfa, 0xb0, 0xff, 0xfa, 0xfc, 0xc3, 0xff, 0xfa, 0xfc, 0xc3, 0xfe, 0xf8, 0xfa, 0xaf, 0xfe, 0xf2, 0xf6, 0x8c, 0xfd, 0xe3, 0xec, 0x58, 0xf5, 0x92, 0xb6, 0x1f, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+    0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
+};
+
+const lv_image_dsc_t img_lv_demo_music_btn_next = {
+    .header.w = 62,
+    .header.h = 62,
+    .header.stride = 248,
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .data = img_lv_demo_music_btn_next_map,
+    .data_size = sizeof(img_lv_demo_music_btn_next_map),
+};
+
+#endif /*LV_USE_DEMO_MUSIC*/
+
+
@@ -0,0 +1,195 @@
+#include "../lv_demo_music.h"
+#if LV_USE_DEMO_MUSIC  && !LV_DEMO_MUSIC_LARGE
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t img_lv_demo_music_cover_1_map[] = {
+  /*Pixel format: Fix 0xFF: 8 bit, Red: 8 bit, Green: 8 bit, Blue: 8 bit*/
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xf9,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf8,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfd,0xf2,0xf6,0x00,0xfd,0xf1,0xf6,0x00,0xfd,0xf0,0xf6,0x00,0xfd,0xf0,0xf6,0x00,0xfd,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xed,0xf3,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf6,0xfa,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x05,0xff,0xff,0xff,0x17,0xff,0xff,0xff,0x36,0xff,0xff,0xff,0x50,0xff,0xff,0xff,0x69,0xff,0xff,0xff,0x86,0xff,0xff,0xff,0x99,0xff,0xff,0xff,0xaa,0xfd,0xfd,0xfd,0xb7,0xfd,0xfe,0xfd,0xc2,0xfd,0xfd,0xfd,0xca,0xfe,0xfe,0xfe,0xcf,0xfc,0xfc,0xfc,0xd0,0xfc,0xfd,0xfd,0xcc,0xff,0xff,0xff,0xc6,0xfc,0xfb,0xfb,0xbc,0xfe,0xfd,0xfd,0xaf,0xff,0xff,0xff,0xa0,0xff,0xff,0xff,0x8e,0xff,0xff,0xff,0x75,0xff,0xff,0xff,0x59,0xff,0xff,0xff,0x40,0xff,0xff,0xff,0x22,0xff,0xff,0xff,0x0b,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf2,0xf7,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xf0,0xf5,0x00,0xfd,0xf0,0xf6,0x00,0xfd,0xf0,0xf6,0x00,0xfd,0xf1,0xf6,0x00,0xfd,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xef,0x00,0xfd,0xe5,0xee,0x00,0xfd,0xe4,0xee,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xeb,0xf2,0x00,0xfe,0xf0,0xf6,0x00,0xff,0xf7,0xfa,0x00,0xff,0xfc,0xfe,0x00,0xff,0xff,0xff,0x04,0xff,0xff,0xff,0x24,0xff,0xff,0xff,0x51,0xff,0xff,0xff,0x82,0xff,0xff,0xff,0xaf,0xfd,0xfc,0xfc,0xd3,0xf7,0xf8,0xf8,0xee,0xeb,0xec,0xec,0xff,0xdf,0xdf,0xdf,0xff,0xde,0xe0,0xe0,0xff,0xe7,0xec,0xec,0xff,0xdf,0xe4,0xe4,0xff,0xd5,0xdb,0xd9,0xff,0x72,0x6e,0x6c,0xff,0x86,0x89,0x85,0xff,0xab,0xb3,0xb1,0xff,0xcc,0xd6,0xd6,0xff,0xab,0xb2,0xb2,0xff,0xd2,0xd7,0xd8,0xff,0xdf,0xe6,0xe6,0xff,0x92,0x8a,0x7c,0xff,0x74,0x62,0x4f,0xff,0x83,0x75,0x64,0xff,0x8d,0x80,0x71,0xff,0x99,0x8d,0x80,0xff,0xa9,0x9f,0x95,0xff,0xbe,0xb7,0xaf,0xff,0xcf,0xcb,0xc5,0xf7,0xe3,0xe1,0xdd,0xdd,0xf7,0xf6,0xf5,0xc0,0xff,0xff,0xff,0x92,0xff,0xff,0xff,0x65,0xff,0xff,0xff,0x33,0xff,0xff,0xff,0x0f,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xf8,0xfb,0x00,0xfe,0xf1,0xf6,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe4,0xee,0x00,0xfd,0xe5,0xee,0x00,0xfd,0xe7,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xed,0xf3,0x00,0xfe,0xf3,0xf8,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0x5a,0xff,0xff,0xff,0x9b,0xf9,0xf9,0xf8,0xd0,0xe9,0xe9,0xe8,0xf7,0xcf,0xc8,0xc3,0xff,0xad,0x99,0x7f,0xff,0xab,0x9f,0x8a,0xff,0xb9,0xbb,0xbb,0xff,0xbf,0xc7,0xc7,0xff,0xa9,0xac,0xaa,0xff,0x98,0x99,0x96,0xff,0xac,0xb3,0xb1,0xff,0xce,0xd7,0xd6,0xff,0xcf,0xd7,0xd8,0xff,0xc3,0xcc,0xcc,0xff,0x3e,0x39,0x38,0xff,0x5b,0x5e,0x5b,0xff,0xa8,0xb3,0xb1,0xff,0xa4,0xae,0xab,0xff,0x91,0x98,0x94,0xff,0x8d,0x93,0x8f,0xff,0xa9,0xb5,0xb3,0xff,0x79,0x71,0x63,0xff,0x3a,0x22,0x06,0xff,0x3f,0x2a,0x13,0xff,0x40,0x2a,0x13,0xff,0x3e,0x29,0x11,0xff,0x3d,0x28,0x10,0xff,0x41,0x2e,0x16,0xff,0x48,0x37,0x20,0xff,0x53,0x42,0x2d,0xff,0x67,0x5a,0x46,0xff,0x81,0x77,0x68,0xff,0x9f,0x97,0x8c,0xff,0xc3,0xbe,0xb8,0xfd,0xdf,0xdc,0xd8,0xe2,0xf8,0xf7,0xf6,0xb1,0xff,0xff,0xff,0x72,0xff,0xff,0xff,0x34,0xff,0xff,0xff,0x08,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xee,0xf4,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xea,0xf2,0x00,0xfe,0xf3,0xf8,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x2b,0xff,0xff,0xff,0x75,0xfe,0xfe,0xfd,0xbf,0xee,0xef,0xee,0xf3,0xc5,0xc5,0xc3,0xff,0x8e,0x88,0x7e,0xff,0x63,0x5a,0x4b,0xff,0x61,0x56,0x42,0xff,0x56,0x38,0x1c,0xff,0x58,0x2c,0x00,0xff,0x87,0x7a,0x60,0xff,0xa4,0xad,0xae,0xff,0xb1,0xba,0xb8,0xff,0x9c,0xa0,0x9d,0xff,0x8c,0x8d,0x89,0xff,0xa9,0xae,0xab,0xff,0xcc,0xd4,0xd2,0xff,0xd6,0xe0,0xe0,0xff,0xd0,0xd9,0xda,0xff,0x52,0x54,0x52,0xff,0x5c,0x5e,0x5a,0xff,0x7e,0x84,0x82,0xff,0x53,0x57,0x53,0xff,0x75,0x7b,0x78,0xff,0xac,0xb6,0xb2,0xff,0xd4,0xe0,0xde,0xff,0x8d,0x88,0x7e,0xff,0x41,0x28,0x10,0xff,0x49,0x34,0x1f,0xff,0x48,0x34,0x1d,0xff,0x46,0x33,0x1c,0xff,0x46,0x33,0x1c,0xff,0x45,0x32,0x1c,0xff,0x43,0x30,0x1a,0xff,0x40,0x2d,0x16,0xff,0x3d,0x2c,0x14,0xff,0x3b,0x2a,0x14,0xff,0x3b,0x2c,0x16,0xff,0x41,0x32,0x1c,0xff,0x4e,0x40,0x2c,0xff,0x6a,0x5f,0x4e,0xff,0x8d,0x84,0x77,0xff,0xb9,0xb5,0xad,0xfc,0xe3,0xe1,0xde,0xd7,0xfd,0xfd,0xfd,0x93,0xff,0xff,0xff,0x46,0xff,0xff,0xff,0x0b,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf5,0xf9,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfe,0xee,0xf4,0x00,0xff,0xf7,0xfa,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x1e,0xff,0xff,0xff,0x6e,0xfd,0xfd,0xfc,0xc4,0xe6,0xde,0xd7,0xf9,0xcb,0xb2,0x96,0xff,0x9a,0x88,0x6e,0xff,0x6b,0x6f,0x6c,0xff,0x41,0x3b,0x2f,0xff,0x46,0x37,0x22,0xff,0x52,0x44,0x30,0xff,0x51,0x3a,0x1b,0xff,0x58,0x2b,0x00,0xff,0x75,0x4f,0x22,0xff,0x9c,0x9b,0x95,0xff,0xab,0xb2,0xb1,0xff,0xac,0xb6,0xb4,0xff,0x9a,0x9d,0x9a,0xff,0x82,0x81,0x7c,0xff,0xa1,0xa5,0xa1,0xff,0xc8,0xcf,0xce,0xff,0xd3,0xdd,0xdd,0xff,0xd9,0xe1,0xe1,0xff,0x6b,0x6e,0x6d,0xff,0x4c,0x4d,0x49,0xff,0xa4,0xab,0xa7,0xff,0xc8,0xd0,0xd0,0xff,0xcf,0xd9,0xd8,0xff,0xd4,0xe0,0xde,0xff,0xe1,0xed,0xec,0xff,0xa8,0xa7,0x9e,0xff,0x3e,0x28,0x12,0xff,0x48,0x34,0x1e,0xff,0x48,0x34,0x1e,0xff,0x47,0x34,0x1e,0xff,0x45,0x32,0x1d,0xff,0x45,0x32,0x1e,0xff,0x45,0x33,0x1e,0xff,0x42,0x32,0x1c,0xff,0x41,0x31,0x1c,0xff,0x41,0x33,0x1d,0xff,0x43,0x35,0x20,0xff,0x40,0x31,0x1d,0xff,0x3f,0x30,0x1b,0xff,0x3c,0x2d,0x19,0xff,0x38,0x2a,0x16,0xff,0x3e,0x31,0x1d,0xff,0x50,0x45,0x35,0xff,0x77,0x6e,0x62,0xff,0xab,0xa6,0x9e,0xff,0xdb,0xd9,0xd6,0xde,0xfb,0xfb,0xfa,0x90,0xff,0xff,0xff,0x39,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x00,0xff,0xf9,0xfb,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe9,0xf1,0x00,0xfe,0xf2,0xf6,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x04,0xff,0xff,0xff,0x43,0xff,0xff,0xff,0xa5,0xf1,0xec,0xe6,0xf0,0xcf,0xb9,0xa0,0xff,0x9d,0x79,0x50,0xff,0x74,0x47,0x16,0xff,0x6e,0x3e,0x00,0xff,0x53,0x4c,0x33,0xff,0x3c,0x38,0x25,0xff,0x3b,0x2d,0x14,0xff,0x5e,0x4d,0x35,0xff,0x74,0x61,0x48,0xff,0x5b,0x32,0x0d,0xff,0x6c,0x3c,0x05,0xff,0x84,0x71,0x5a,0xff,0x9d,0xa2,0xa2,0xff,0xa6,0xac,0xaa,0xff,0xa3,0xa9,0xa7,0xff,0x9a,0x9a,0x98,0xff,0x7f,0x7c,0x77,0xff,0x9e,0xa0,0x9d,0xff,0xc4,0xcb,0xcc,0xff,0xd1,0xdb,0xdc,0xff,0xd6,0xe0,0xe0,0xff,0x84,0x89,0x88,0xff,0x44,0x44,0x3e,0xff,0x5a,0x5e,0x59,0xff,0xb0,0xbb,0xbb,0xff,0xc8,0xd3,0xd2,0xff,0xca,0xd3,0xd1,0xff,0xda,0xe4,0xe3,0xff,0xbb,0xbe,0xb8,0xff,0x44,0x31,0x1e,0xff,0x47,0x33,0x1c,0xff,0x47,0x33,0x1f,0xff,0x48,0x35,0x20,0xff,0x43,0x32,0x1d,0xff,0x44,0x33,0x1e,0xff,0x44,0x34,0x1f,0xff,0x42,0x34,0x1e,0xff,0x41,0x33,0x1d,0xff,0x41,0x32,0x1e,0xff,0x40,0x32,0x1f,0xff,0x42,0x34,0x21,0xff,0x42,0x35,0x22,0xff,0x41,0x35,0x22,0xff,0x3f,0x33,0x21,0xff,0x3f,0x32,0x22,0xff,0x3d,0x32,0x21,0xff,0x38,0x2d,0x1c,0xff,0x3a,0x2f,0x20,0xff,0x4a,0x41,0x33,0xff,0x71,0x6a,0x60,0xff,0xad,0xaa,0xa4,0xfd,0xe6,0xe4,0xe3,0xc8,0xff,0xff,0xff,0x68,0xff,0xff,0xff,0x13,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf3,0xf7,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xe9,0xf1,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x0b,0xff,0xff,0xff,0x5f,0xfc,0xfb,0xfb,0xc8,0xea,0xda,0xc8,0xfe,0xb3,0x97,0x73,0xff,0x87,0x5c,0x26,0xff,0x84,0x46,0x01,0xff,0x70,0x37,0x00,0xff,0x72,0x3b,0x00,0xff,0x52,0x3f,0x18,0xff,0x3b,0x3c,0x2b,0xff,0x28,0x19,0x00,0xff,0x42,0x2d,0x08,0xff,0x62,0x4c,0x24,0xff,0x54,0x39,0x16,0xff,0x62,0x2f,0x00,0xff,0x74,0x55,0x27,0xff,0x89,0x8a,0x7f,0xff,0x96,0x99,0x96,0xff,0x9d,0xa2,0xa0,0xff,0x9e,0xa3,0xa0,0xff,0x94,0x93,0x90,0xff,0x85,0x82,0x7e,0xff,0x99,0x9c,0x99,0xff,0xbd,0xc5,0xc4,0xff,0xd7,0xdf,0xdf,0xff,0xd4,0xdd,0xdd,0xff,0x9b,0xa0,0x9e,0xff,0x4e,0x4f,0x49,0xff,0x46,0x4a,0x46,0xff,0x88,0x92,0x8e,0xff,0xb1,0xbc,0xb9,0xff,0xbf,0xc8,0xc6,0xff,0xd0,0xdb,0xd9,0xff,0xcc,0xd3,0xd1,0xff,0x50,0x40,0x2d,0xff,0x43,0x30,0x1a,0xff,0x48,0x36,0x21,0xff,0x46,0x35,0x20,0xff,0x45,0x34,0x20,0xff,0x43,0x33,0x1f,0xff,0x43,0x34,0x20,0xff,0x42,0x34,0x20,0xff,0x43,0x35,0x21,0xff,0x41,0x33,0x20,0xff,0x40,0x34,0x20,0xff,0x42,0x35,0x23,0xff,0x42,0x36,0x25,0xff,0x41,0x36,0x24,0xff,0x40,0x35,0x24,0xff,0x3f,0x34,0x24,0xff,0x3f,0x35,0x25,0xff,0x3f,0x36,0x28,0xff,0x3f,0x36,0x27,0xff,0x3c,0x33,0x25,0xff,0x35,0x2d,0x20,0xff,0x39,0x32,0x25,0xff,0x52,0x4c,0x42,0xff,0x8b,0x87,0x80,0xff,0xcc,0xcb,0xc8,0xe5,0xf9,0xf8,0xf8,0x8a,0xff,0xff,0xff,0x23,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xea,0xf2,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xfc,0xfe,0x00,0xff,0xff,0xff,0x0e,0xff,0xff,0xff,0x6a,0xfa,0xf9,0xf8,0xd9,0xc6,0xbc,0xb3,0xff,0x90,0x74,0x50,0xff,0x98,0x5c,0x0f,0xff,0x6f,0x3c,0x00,0xff,0x7d,0x43,0x00,0xff,0x89,0x49,0x00,0xff,0x80,0x45,0x01,0xff,0x64,0x3a,0x07,0xff,0x33,0x33,0x1e,0xff,0x1c,0x16,0x09,0xff,0x2e,0x1b,0x00,0xff,0x4e,0x34,0x03,0xff,0x4c,0x31,0x07,0xff,0x59,0x2d,0x00,0xff,0x72,0x45,0x06,0xff,0x81,0x75,0x61,0xff,0x80,0x81,0x7b,0xff,0x80,0x80,0x7a,0xff,0x93,0x94,0x90,0xff,0x97,0x99,0x95,0xff,0x92,0x8f,0x8b,0xff,0x96,0x93,0x8f,0xff,0x9d,0xa1,0x9f,0xff,0xb4,0xba,0xb9,0xff,0xd4,0xdd,0xdb,0xff,0xda,0xe2,0xe1,0xff,0xb3,0xb8,0xb7,0xff,0x72,0x77,0x74,0xff,0x87,0x92,0x8e,0xff,0x9a,0xa6,0xa1,0xff,0xa8,0xb4,0xaf,0xff,0xb5,0xbf,0xbd,0xff,0xc6,0xd0,0xce,0xff,0xd9,0xe2,0xe3,0xff,0x68,0x5a,0x49,0xff,0x42,0x2f,0x19,0xff,0x48,0x38,0x22,0xff,0x48,0x37,0x24,0xff,0x44,0x35,0x21,0xff,0x45,0x36,0x22,0xff,0x44,0x36,0x23,0xff,0x43,0x36,0x23,0xff,0x43,0x36,0x24,0xff,0x42,0x35,0x23,0xff,0x41,0x35,0x23,0xff,0x42,0x36,0x25,0xff,0x42,0x37,0x26,0xff,0x41,0x37,0x28,0xff,0x41,0x37,0x27,0xff,0x40,0x37,0x26,0xff,0x3e,0x35,0x26,0xff,0x3f,0x36,0x27,0xff,0x41,0x38,0x29,0xff,0x41,0x39,0x2b,0xff,0x3d,0x37,0x2a,0xff,0x3c,0x37,0x2b,0xff,0x38,0x32,0x27,0xff,0x39,0x32,0x26,0xff,0x44,0x3f,0x34,0xff,0x6e,0x6b,0x63,0xff,0xb9,0xb8,0xb4,0xf3,0xf5,0xf5,0xf4,0x98,0xff,0xff,0xff,0x28,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf2,0xf7,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf4,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xef,0xf4,0x00,0xfe,0xfa,0xfc,0x00,0xff,0xff,0xff,0x08,0xff,0xff,0xff,0x64,0xf9,0xf7,0xf5,0xda,0xc7,0xb9,0xac,0xff,0x7a,0x61,0x46,0xff,0x42,0x23,0x06,0xff,0x50,0x29,0x00,0xff,0x86,0x4d,0x00,0xff,0x76,0x42,0x01,0xff,0x8c,0x4e,0x01,0xff,0x89,0x4b,0x01,0xff,0x79,0x42,0x01,0xff,0x38,0x2c,0x0e,0xff,0x19,0x16,0x0d,0xff,0x25,0x15,0x00,0xff,0x4e,0x2c,0x02,0xff,0x49,0x28,0x00,0xff,0x50,0x2a,0x00,0xff,0x71,0x3e,0x00,0xff,0x71,0x56,0x30,0xff,0x84,0x86,0x82,0xff,0x7b,0x7a,0x72,0xff,0x78,0x74,0x69,0xff,0x8c,0x87,0x7f,0xff,0x91,0x8f,0x87,0xff,0x8a,0x87,0x80,0xff,0x99,0x99,0x96,0xff,0x9e,0xa1,0xa1,0xff,0xae,0xb4,0xb3,0xff,0xcb,0xd4,0xd2,0xff,0xdb,0xe2,0xe2,0xff,0xcb,0xd2,0xd1,0xff,0x7f,0x87,0x84,0xff,0x75,0x80,0x7d,0xff,0x9c,0xa8,0xa4,0xff,0xa9,0xb4,0xb0,0xff,0xb6,0xc1,0xbf,0xff,0xc1,0xcb,0xc9,0xff,0xdb,0xe3,0xe6,0xff,0x7f,0x78,0x6c,0xff,0x3e,0x2d,0x17,0xff,0x48,0x39,0x24,0xff,0x47,0x39,0x25,0xff,0x46,0x38,0x26,0xff,0x43,0x36,0x24,0xff,0x42,0x35,0x23,0xff,0x43,0x36,0x26,0xff,0x41,0x35,0x26,0xff,0x41,0x36,0x26,0xff,0x41,0x37,0x26,0xff,0x3f,0x36,0x25,0xff,0x42,0x39,0x29,0xff,0x41,0x38,0x2a,0xff,0x40,0x38,0x2a,0xff,0x3e,0x36,0x27,0xff,0x3e,0x37,0x28,0xff,0x3f,0x38,0x2a,0xff,0x3f,0x37,0x2a,0xff,0x3f,0x38,0x2b,0xff,0x3e,0x38,0x2c,0xff,0x3e,0x3a,0x2f,0xff,0x3d,0x38,0x2d,0xff,0x3e,0x39,0x2e,0xff,0x3b,0x36,0x2b,0xff,0x36,0x32,0x26,0xff,0x39,0x37,0x2b,0xff,0x65,0x64,0x5a,0xff,0xb3,0xb2,0xad,0xf4,0xf2,0xf2,0xf2,0x95,0xff,0xff,0xff,0x21,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf1,0xf6,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xeb,0xf3,0x00,0xff,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x4a,0xfd,0xfc,0xfc,0xcc,0xd3,0xc3,0xb5,0xff,0x88,0x65,0x42,0xff,0x55,0x2a,0x03,0xff,0x44,0x1f,0x00,0xff,0x3d,0x1e,0x01,0xff,0x4e,0x2c,0x02,0xff,0x7d,0x47,0x04,0xff,0x7e,0x47,0x01,0xff,0x8e,0x50,0x02,0xff,0x8c,0x4e,0x02,0xff,0x4c,0x2e,0x04,0xff,0x0e,0x11,0x02,0xff,0x1d,0x12,0x00,0xff,0x4d,0x2b,0x02,0xff,0x51,0x2c,0x00,0xff,0x56,0x2d,0x01,0xff,0x76,0x3f,0x00,0xff,0x66,0x42,0x0b,0xff,0x66,0x5c,0x4d,0xff,0x75,0x72,0x6d,0xff,0x6f,0x6b,0x61,0xff,0x70,0x6a,0x5b,0xff,0x82,0x7a,0x6e,0xff,0x89,0x82,0x79,0xff,0x90,0x8c,0x83,0xff,0x9f,0x9f,0x9b,0xff,0xa1,0xa6,0xa6,0xff,0xaa,0xb1,0xb0,0xff,0xc1,0xca,0xc9,0xff,0xdb,0xe3,0xe2,0xff,0xd0,0xd8,0xd9,0xff,0x8f,0x99,0x96,0xff,0x85,0x90,0x8d,0xff,0xa8,0xb3,0xb0,0xff,0xa3,0xae,0xab,0xff,0xb1,0xbc,0xba,0xff,0xbf,0xc9,0xc8,0xff,0xd7,0xe1,0xe2,0xff,0x93,0x91,0x88,0xff,0x3d,0x2e,0x18,0xff,0x48,0x3a,0x26,0xff,0x47,0x39,0x26,0xff,0x44,0x37,0x25,0xff,0x42,0x36,0x25,0xff,0x44,0x38,0x27,0xff,0x43,0x38,0x29,0xff,0x42,0x37,0x29,0xff,0x41,0x37,0x29,0xff,0x41,0x38,0x29,0xff,0x41,0x38,0x28,0xff,0x41,0x39,0x29,0xff,0x3f,0x38,0x2a,0xff,0x3f,0x38,0x29,0xff,0x40,0x39,0x2b,0xff,0x3e,0x39,0x2a,0xff,0x3f,0x39,0x2c,0xff,0x3f,0x3a,0x2d,0xff,0x3f,0x3b,0x2e,0xff,0x3e,0x3a,0x2e,0xff,0x3f,0x3b,0x2f,0xff,0x3e,0x3a,0x2e,0xff,0x3e,0x3a,0x2f,0xff,0x3d,0x3a,0x2e,0xff,0x3c,0x3a,0x2f,0xff,0x3b,0x39,0x2d,0xff,0x36,0x33,0x27,0xff,0x39,0x37,0x2c,0xff,0x62,0x62,0x58,0xff,0xb9,0xb9,0xb4,0xed,0xf9,0xf9,0xf8,0x7e,0xff,0xff,0xff,0x0f,0xff,0xff,0xff,0x00,0xff,0xf9,0xfb,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfc,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfe,0xf3,0xf8,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x26,0xff,0xff,0xff,0xac,0xe2,0xd4,0xc9,0xff,0xa2,0x7b,0x57,0xff,0x6d,0x37,0x07,0xff,0x5a,0x27,0x00,0xff,0x57,0x2b,0x00,0xff,0x4f,0x2a,0x01,0xff,0x41,0x22,0x01,0xff,0x48,0x25,0x01,0xff,0x77,0x46,0x03,0xff,0x86,0x4d,0x01,0xff,0x94,0x53,0x01,0xff,0x76,0x41,0x04,0xff,0x14,0x10,0x01,0xff,0x0f,0x0e,0x01,0xff,0x44,0x29,0x02,0xff,0x5f,0x34,0x02,0xff,0x63,0x34,0x02,0xff,0x70,0x3b,0x01,0xff,0x5c,0x3a,0x04,0xff,0x46,0x38,0x17,0xff,0x56,0x4d,0x3c,0xff,0x63,0x59,0x4b,0xff,0x68,0x5d,0x4d,0xff,0x74,0x6a,0x5b,0xff,0x82,0x78,0x6a,0xff,0x82,0x79,0x6e,0xff,0x91,0x8d,0x86,0xff,0x97,0x96,0x91,0xff,0xa5,0xaa,0xa8,0xff,0xae,0xb5,0xb3,0xff,0xbc,0xc4,0xc2,0xff,0xd7,0xdf,0xdf,0xff,0xd6,0xdd,0xdc,0xff,0x8d,0x95,0x94,0xff,0x88,0x93,0x90,0xff,0xaf,0xba,0xb7,0xff,0xb1,0xbb,0xba,0xff,0xaf,0xb9,0xb8,0xff,0xb5,0xc0,0xbe,0xff,0xcf,0xda,0xda,0xff,0xa2,0xa3,0x9b,0xff,0x3d,0x31,0x1c,0xff,0x46,0x3b,0x28,0xff,0x46,0x3a,0x28,0xff,0x44,0x38,0x27,0xff,0x43,0x38,0x28,0xff,0x43,0x39,0x29,0xff,0x43,0x39,0x2b,0xff,0x41,0x38,0x29,0xff,0x40,0x38,0x2a,0xff,0x40,0x38,0x2a,0xff,0x41,0x39,0x2b,0xff,0x42,0x39,0x2b,0xff,0x40,0x39,0x2c,0xff,0x40,0x3b,0x2d,0xff,0x3f,0x3a,0x2d,0xff,0x3f,0x3a,0x2d,0xff,0x3e,0x39,0x2c,0xff,0x3d,0x39,0x2c,0xff,0x3e,0x3b,0x2d,0xff,0x3f,0x3c,0x2d,0xff,0x3d,0x3a,0x2c,0xff,0x3e,0x3a,0x2f,0xff,0x3f,0x3b,0x30,0xff,0x3e,0x3b,0x30,0xff,0x3c,0x3a,0x2f,0xff,0x3d,0x3b,0x30,0xff,0x3d,0x3b,0x2f,0xff,0x3b,0x3a,0x2e,0xff,0x33,0x33,0x27,0xff,0x39,0x39,0x2d,0xff,0x71,0x71,0x68,0xff,0xc9,0xc9,0xc7,0xd9,0xfe,0xfe,0xfe,0x53,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xfe,0xf5,0xf9,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xeb,0xf3,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x05,0xff,0xff,0xff,0x72,0xf5,0xee,0xe9,0xed,0xbc,0x97,0x77,0xff,0x84,0x46,0x12,0xff,0x6e,0x2f,0x00,0xff,0x6c,0x32,0x00,0xff,0x65,0x31,0x01,0xff,0x59,0x2c,0x01,0xff,0x4f,0x28,0x00,0xff,0x47,0x23,0x02,0xff,0x4a,0x27,0x02,0xff,0x74,0x44,0x01,0xff,0x87,0x4f,0x02,0xff,0x92,0x50,0x03,0xff,0x30,0x22,0x02,0xff,0x08,0x0a,0x00,0xff,0x3e,0x25,0x01,0xff,0x68,0x38,0x01,0xff,0x72,0x3d,0x01,0xff,0x71,0x3b,0x02,0xff,0x57,0x31,0x00,0xff,0x4a,0x38,0x0a,0xff,0x50,0x42,0x26,0xff,0x5b,0x4d,0x37,0xff,0x64,0x55,0x42,0xff,0x6c,0x5b,0x46,0xff,0x71,0x60,0x4b,0xff,0x7e,0x71,0x60,0xff,0x87,0x7f,0x71,0xff,0x99,0x98,0x92,0xff,0x93,0x93,0x8d,0xff,0xa3,0xa8,0xa4,0xff,0xad,0xb5,0xb2,0xff,0xbb,0xc3,0xc2,0xff,0xd1,0xd9,0xd9,0xff,0xdc,0xe3,0xe3,0xff,0x9c,0xa4,0xa3,0xff,0x8d,0x98,0x96,0xff,0xb0,0xbc,0xb9,0xff,0xaf,0xb9,0xb8,0xff,0xb5,0xbf,0xbe,0xff,0xb8,0xc2,0xc1,0xff,0xc6,0xd1,0xd1,0xff,0xa7,0xaa,0xa3,0xff,0x3f,0x36,0x23,0xff,0x45,0x3b,0x2a,0xff,0x44,0x3a,0x2a,0xff,0x44,0x3a,0x2b,0xff,0x43,0x39,0x2a,0xff,0x41,0x38,0x2a,0xff,0x41,0x39,0x2b,0xff,0x42,0x39,0x2c,0xff,0x41,0x39,0x2c,0xff,0x40,0x3a,0x2c,0xff,0x41,0x3b,0x2d,0xff,0x3f,0x3a,0x2c,0xff,0x40,0x3a,0x2e,0xff,0x41,0x3b,0x2f,0xff,0x40,0x3b,0x2f,0xff,0x3e,0x3b,0x2e,0xff,0x3e,0x3b,0x2e,0xff,0x3f,0x3b,0x2d,0xff,0x3c,0x3a,0x2c,0xff,0x3c,0x3b,0x2d,0xff,0x3d,0x3b,0x2d,0xff,0x3e,0x3b,0x2f,0xff,0x3d,0x3b,0x30,0xff,0x3e,0x3c,0x30,0xff,0x3d,0x3c,0x30,0xff,0x3e,0x3c,0x30,0xff,0x3c,0x3a,0x30,0xff,0x3b,0x3a,0x2e,0xff,0x3b,0x3a,0x2e,0xff,0x38,0x38,0x2c,0xff,0x35,0x33,0x27,0xff,0x42,0x40,0x35,0xff,0x88,0x86,0x81,0xff,0xe5,0xe5,0xe3,0xab,0xff,0xff,0xff,0x21,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xed,0xf4,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe7,0xef,0x00,0xfe,0xf2,0xf6,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x2c,0xfe,0xfd,0xfc,0xc0,0xda,0xc0,0xac,0xff,0xa1,0x63,0x30,0xff,0x82,0x38,0x00,0xff,0x7c,0x37,0x00,0xff,0x75,0x37,0x01,0xff,0x6e,0x34,0x02,0xff,0x66,0x30,0x01,0xff,0x5a,0x2b,0x01,0xff,0x50,0x28,0x02,0xff,0x43,0x20,0x02,0xff,0x4f,0x2a,0x05,0xff,0x78,0x45,0x03,0xff,0x8d,0x51,0x02,0xff,0x68,0x3e,0x04,0xff,0x0f,0x0f,0x00,0xff,0x3e,0x28,0x02,0xff,0x70,0x3e,0x01,0xff,0x7a,0x41,0x03,0xff,0x71,0x3e,0x01,0xff,0x60,0x34,0x00,0xff,0x58,0x44,0x1a,0xff,0x5f,0x4f,0x2f,0xff,0x5f,0x4e,0x2f,0xff,0x60,0x4b,0x2f,0xff,0x6f,0x5c,0x44,0xff,0x77,0x66,0x50,0xff,0x6f,0x5e,0x44,0xff,0x74,0x66,0x4e,0xff,0x84,0x7c,0x6c,0xff,0xa4,0xa6,0x9f,0xff,0x97,0x97,0x93,0xff,0x9f,0xa3,0xa0,0xff,0xb3,0xba,0xb8,0xff,0xb8,0xbf,0xbe,0xff,0xcb,0xd3,0xd2,0xff,0xdf,0xe6,0xe5,0xff,0xa2,0xab,0xa9,0xff,0x8f,0x9a,0x97,0xff,0xb4,0xbf,0xbc,0xff,0xb4,0xbe,0xbc,0xff,0xaf,0xba,0xb8,0xff,0xac,0xb7,0xb6,0xff,0xbe,0xc8,0xc8,0xff,0xb1,0xb7,0xb1,0xff,0x43,0x3c,0x2a,0xff,0x44,0x3b,0x2b,0xff,0x46,0x3d,0x2e,0xff,0x44,0x3b,0x2d,0xff,0x43,0x3b,0x2c,0xff,0x41,0x3b,0x2c,0xff,0x42,0x3a,0x2d,0xff,0x41,0x3a,0x2e,0xff,0x3f,0x3a,0x2d,0xff,0x40,0x3a,0x2d,0xff,0x3f,0x3a,0x2d,0xff,0x3f,0x3a,0x2d,0xff,0x3e,0x3b,0x2e,0xff,0x40,0x3b,0x31,0xff,0x40,0x3b,0x31,0xff,0x40,0x3b,0x31,0xff,0x3e,0x3a,0x30,0xff,0x3f,0x3c,0x2e,0xff,0x3c,0x3b,0x2d,0xff,0x3c,0x3a,0x2c,0xff,0x3e,0x3c,0x2f,0xff,0x3d,0x3b,0x2f,0xff,0x3e,0x3c,0x30,0xff,0x3c,0x3a,0x2e,0xff,0x3c,0x3a,0x2f,0xff,0x3b,0x3a,0x2e,0xff,0x3d,0x3a,0x2f,0xff,0x3c,0x39,0x2d,0xff,0x3b,0x39,0x2e,0xff,0x3a,0x39,0x2c,0xff,0x3b,0x39,0x2d,0xff,0x38,0x36,0x2a,0xff,0x35,0x33,0x27,0xff,0x53,0x51,0x47,0xff,0xb0,0xaf,0xaa,0xe9,0xf9,0xf9,0xf9,0x61,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xfe,0xf4,0xf8,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe9,0xf1,0x00,0xff,0xf8,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x69,0xf5,0xec,0xe5,0xf0,0xc1,0x8f,0x67,0xff,0x93,0x42,0x07,0xff,0x8a,0x39,0x00,0xff,0x8b,0x3f,0x01,0xff,0x82,0x3b,0x01,0xff,0x76,0x37,0x01,0xff,0x6c,0x32,0x01,0xff,0x65,0x2e,0x01,0xff,0x5c,0x2a,0x02,0xff,0x52,0x26,0x02,0xff,0x4d,0x25,0x01,0xff,0x65,0x35,0x04,0xff,0x81,0x4a,0x03,0xff,0x91,0x54,0x03,0xff,0x3c,0x26,0x03,0xff,0x44,0x29,0x02,0xff,0x7c,0x46,0x03,0xff,0x81,0x49,0x02,0xff,0x7a,0x44,0x02,0xff,0x6b,0x3a,0x00,0xff,0x61,0x3b,0x04,0xff,0x73,0x63,0x44,0xff,0x71,0x68,0x58,0xff,0x62,0x4f,0x2d,0xff,0x60,0x48,0x23,0xff,0x6f,0x5b,0x40,0xff,0x78,0x66,0x50,0xff,0x75,0x61,0x48,0xff,0x7c,0x6e,0x55,0xff,0x7b,0x74,0x62,0xff,0x94,0x96,0x90,0xff,0x97,0x98,0x95,0xff,0x9a,0x9d,0x99,0xff,0xb2,0xb8,0xb5,0xff,0xb5,0xbc,0xba,0xff,0xc5,0xce,0xcc,0xff,0xde,0xe6,0xe5,0xff,0xa6,0xae,0xac,0xff,0x88,0x94,0x90,0xff,0xb5,0xc0,0xbe,0xff,0xaf,0xb9,0xb7,0xff,0xa3,0xae,0xaa,0xff,0xa6,0xb3,0xaf,0xff,0xc4,0xcd,0xcd,0xff,0xbd,0xc5,0xc0,0xff,0x48,0x42,0x31,0xff,0x45,0x3c,0x2d,0xff,0x46,0x3e,0x2f,0xff,0x46,0x3e,0x2f,0xff,0x43,0x3c,0x2d,0xff,0x43,0x3c,0x2e,0xff,0x41,0x3b,0x2c,0xff,0x41,0x3a,0x2e,0xff,0x41,0x3b,0x30,0xff,0x40,0x3b,0x30,0xff,0x3f,0x3b,0x2e,0xff,0x40,0x3d,0x2f,0xff,0x40,0x3c,0x2f,0xff,0x3d,0x3a,0x2e,0xff,0x3f,0x3d,0x32,0xff,0x3f,0x3a,0x31,0xff,0x41,0x3c,0x33,0xff,0x3d,0x3b,0x2f,0xff,0x3c,0x3a,0x2e,0xff,0x3c,0x3a,0x2d,0xff,0x3c,0x3a,0x2e,0xff,0x3b,0x39,0x2e,0xff,0x3c,0x3a,0x2f,0xff,0x3c,0x3a,0x2f,0xff,0x3b,0x39,0x2e,0xff,0x3a,0x38,0x2d,0xff,0x3b,0x38,0x2d,0xff,0x3b,0x39,0x2e,0xff,0x3a,0x38,0x2c,0xff,0x39,0x37,0x2b,0xff,0x38,0x36,0x2b,0xff,0x39,0x37,0x2b,0xff,0x38,0x36,0x2a,0xff,0x31,0x2f,0x23,0xff,0x35,0x33,0x28,0xff,0x78,0x77,0x6f,0xff,0xe0,0xdf,0xde,0xa7,0xff,0xff,0xff,0x17,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfe,0xed,0xf4,0x00,0xff,0xfb,0xfc,0x00,0xff,0xff,0xff,0x13,0xff,0xff,0xff,0xa5,0xe5,0xcb,0xb8,0xff,0xb0,0x67,0x31,0xff,0x95,0x3c,0x00,0xff,0x93,0x40,0x00,0xff,0x91,0x41,0x02,0xff,0x8c,0x3f,0x02,0xff,0x85,0x3c,0x02,0xff,0x7a,0x38,0x01,0xff,0x70,0x35,0x01,0xff,0x68,0x31,0x01,0xff,0x64,0x2f,0x02,0xff,0x62,0x2f,0x03,0xff,0x56,0x28,0x01,0xff,0x70,0x3a,0x03,0xff,0xa0,0x58,0x02,0xff,0x89,0x4f,0x03,0xff,0x56,0x35,0x01,0xff,0x87,0x4b,0x02,0xff,0x78,0x46,0x03,0xff,0x50,0x35,0x02,0xff,0x4b,0x33,0x00,0xff,0x6f,0x41,0x00,0xff,0x65,0x40,0x06,0xff,0x6a,0x5a,0x3d,0xff,0x6c,0x5d,0x45,0xff,0x61,0x4b,0x1e,0xff,0x6c,0x53,0x28,0xff,0x79,0x66,0x49,0xff,0x74,0x62,0x47,0xff,0x65,0x51,0x33,0xff,0x81,0x76,0x5f,0xff,0x89,0x82,0x77,0xff,0x97,0x96,0x91,0xff,0x93,0x94,0x8f,0xff,0x94,0x98,0x94,0xff,0xaa,0xaf,0xad,0xff,0xb2,0xba,0xb9,0xff,0xbf,0xc8,0xc6,0xff,0xde,0xe6,0xe5,0xff,0xa6,0xae,0xac,0xff,0x80,0x8b,0x88,0xff,0xb3,0xbe,0xbc,0xff,0xac,0xb7,0xb7,0xff,0xaa,0xb5,0xb4,0xff,0xba,0xc5,0xc3,0xff,0xca,0xd3,0xd4,0xff,0xc4,0xcd,0xca,0xff,0x4f,0x48,0x3a,0xff,0x43,0x3b,0x2d,0xff,0x45,0x3e,0x30,0xff,0x46,0x3e,0x31,0xff,0x44,0x3d,0x30,0xff,0x42,0x3b,0x2e,0xff,0x40,0x3b,0x2e,0xff,0x41,0x3c,0x30,0xff,0x41,0x3c,0x31,0xff,0x42,0x3d,0x33,0xff,0x3f,0x3c,0x31,0xff,0x3e,0x3c,0x2f,0xff,0x40,0x3d,0x31,0xff,0x3e,0x3c,0x30,0xff,0x40,0x3e,0x33,0xff,0x40,0x3c,0x32,0xff,0x3f,0x3a,0x31,0xff,0x3d,0x3a,0x2f,0xff,0x3d,0x3a,0x2f,0xff,0x3e,0x3b,0x2f,0xff,0x3c,0x3a,0x2e,0xff,0x3b,0x39,0x2d,0xff,0x3b,0x39,0x2e,0xff,0x3c,0x3a,0x2e,0xff,0x3c,0x39,0x2d,0xff,0x3a,0x37,0x2d,0xff,0x37,0x35,0x29,0xff,0x3a,0x38,0x2c,0xff,0x3a,0x37,0x2c,0xff,0x38,0x35,0x29,0xff,0x39,0x36,0x29,0xff,0x39,0x35,0x28,0xff,0x36,0x34,0x26,0xff,0x37,0x36,0x28,0xff,0x34,0x33,0x24,0xff,0x2d,0x2c,0x1e,0xff,0x4f,0x4e,0x43,0xff,0xb7,0xb6,0xb1,0xda,0xfd,0xfd,0xfd,0x40,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf0,0xf5,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x33,0xfd,0xfb,0xfa,0xd3,0xd4,0xa7,0x86,0xff,0xa4,0x4d,0x0d,0xff,0x98,0x3d,0x00,0xff,0x98,0x43,0x01,0xff,0x94,0x42,0x01,0xff,0x90,0x42,0x01,0xff,0x8a,0x3f,0x01,0xff,0x83,0x3d,0x02,0xff,0x7a,0x3a,0x01,0xff,0x73,0x37,0x01,0xff,0x6c,0x34,0x01,0xff,0x5f,0x2e,0x01,0xff,0x56,0x29,0x01,0xff,0x44,0x1f,0x01,0xff,0x64,0x35,0x04,0xff,0xa8,0x5e,0x03,0xff,0x81,0x4d,0x03,0xff,0x70,0x45,0x03,0xff,0x55,0x38,0x03,0xff,0x22,0x1d,0x01,0xff,0x28,0x22,0x01,0xff,0x5d,0x3c,0x01,0xff,0x8a,0x52,0x02,0xff,0x62,0x40,0x03,0xff,0x52,0x40,0x19,0xff,0x5d,0x45,0x18,0xff,0x63,0x4a,0x0f,0xff,0x6b,0x4f,0x21,0xff,0x7c,0x6a,0x4c,0xff,0x82,0x71,0x58,0xff,0x69,0x54,0x32,0xff,0x80,0x75,0x5d,0xff,0x94,0x8e,0x83,0xff,0x9c,0x9b,0x95,0xff,0x9f,0x9f,0x9b,0xff,0x9c,0x9f,0x9e,0xff,0xa9,0xad,0xac,0xff,0xb2,0xba,0xb8,0xff,0xb5,0xbd,0xbd,0xff,0xd9,0xe0,0xe2,0xff,0xa2,0xa9,0xa9,0xff,0x75,0x7f,0x7e,0xff,0xaf,0xb9,0xb9,0xff,0xb2,0xbc,0xbc,0xff,0xb9,0xc2,0xc4,0xff,0xc5,0xcf,0xcf,0xff,0xcd,0xd6,0xd7,0xff,0xc9,0xd3,0xd2,0xff,0x54,0x4e,0x43,0xff,0x42,0x3a,0x2d,0xff,0x45,0x3e,0x31,0xff,0x45,0x3d,0x31,0xff,0x44,0x3d,0x30,0xff,0x42,0x3d,0x30,0xff,0x42,0x3d,0x30,0xff,0x40,0x3d,0x30,0xff,0x3f,0x3c,0x31,0xff,0x40,0x3d,0x33,0xff,0x3f,0x3e,0x32,0xff,0x3f,0x3d,0x32,0xff,0x3f,0x3d,0x31,0xff,0x3e,0x3c,0x30,0xff,0x3e,0x3c,0x31,0xff,0x3f,0x3b,0x32,0xff,0x40,0x3b,0x31,0xff,0x3d,0x39,0x2e,0xff,0x3d,0x39,0x2d,0xff,0x3d,0x39,0x2d,0xff,0x3b,0x39,0x2d,0xff,0x3b,0x3a,0x2e,0xff,0x3b,0x39,0x2d,0xff,0x3b,0x38,0x2d,0xff,0x3c,0x37,0x2c,0xff,0x3b,0x36,0x2c,0xff,0x3a,0x36,0x2a,0xff,0x38,0x35,0x27,0xff,0x39,0x36,0x29,0xff,0x3a,0x36,0x29,0xff,0x38,0x33,0x26,0xff,0x38,0x34,0x27,0xff,0x36,0x33,0x26,0xff,0x36,0x33,0x26,0xff,0x36,0x33,0x26,0xff,0x35,0x32,0x25,0xff,0x2f,0x2c,0x1e,0xff,0x37,0x34,0x27,0xff,0x8c,0x8b,0x83,0xf8,0xf3,0xf3,0xf2,0x6f,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf3,0xf7,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xfb,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x55,0xf6,0xea,0xe0,0xef,0xc3,0x86,0x59,0xff,0x9f,0x42,0x00,0xff,0x9c,0x41,0x00,0xff,0x9a,0x45,0x01,0xff,0x95,0x44,0x00,0xff,0x92,0x42,0x01,0xff,0x8b,0x40,0x01,0xff,0x86,0x3f,0x01,0xff,0x81,0x3d,0x01,0xff,0x77,0x39,0x02,0xff,0x6f,0x36,0x02,0xff,0x6b,0x33,0x02,0xff,0x5f,0x2f,0x02,0xff,0x52,0x29,0x00,0xff,0x44,0x21,0x01,0xff,0x4b,0x24,0x01,0xff,0x85,0x4c,0x03,0xff,0x66,0x41,0x01,0xff,0x35,0x26,0x01,0xff,0x0d,0x11,0x01,0xff,0x32,0x25,0x02,0xff,0x76,0x46,0x02,0xff,0x8c,0x51,0x00,0xff,0x83,0x4f,0x01,0xff,0x51,0x34,0x05,0xff,0x55,0x40,0x14,0xff,0x59,0x3d,0x07,0xff,0x53,0x36,0x01,0xff,0x54,0x36,0x08,0xff,0x69,0x50,0x2c,0xff,0x70,0x5c,0x3f,0xff,0x73,0x5c,0x3a,0xff,0x87,0x79,0x62,0xff,0x9f,0x9b,0x90,0xff,0xa4,0xa2,0x9d,0xff,0xad,0xae,0xad,0xff,0xad,0xb0,0xb0,0xff,0xb9,0xbe,0xbe,0xff,0xbe,0xc5,0xc6,0xff,0xb9,0xc2,0xc4,0xff,0xd6,0xdc,0xdd,0xff,0xb1,0xb8,0xb7,0xff,0x73,0x7c,0x7a,0xff,0xa9,0xb4,0xb2,0xff,0xb7,0xc1,0xc0,0xff,0xc4,0xce,0xcd,0xff,0xcb,0xd5,0xd5,0xff,0xc3,0xce,0xce,0xff,0xcc,0xd4,0xd2,0xff,0x57,0x53,0x48,0xff,0x41,0x3a,0x2e,0xff,0x45,0x3f,0x32,0xff,0x43,0x3d,0x30,0xff,0x44,0x3e,0x30,0xff,0x43,0x3d,0x2f,0xff,0x41,0x3b,0x2f,0xff,0x41,0x3d,0x31,0xff,0x41,0x3d,0x31,0xff,0x41,0x3c,0x33,0xff,0x40,0x3d,0x33,0xff,0x3f,0x3d,0x32,0xff,0x3d,0x3b,0x2f,0xff,0x3c,0x3a,0x2e,0xff,0x3d,0x3b,0x2f,0xff,0x3e,0x3b,0x30,0xff,0x3f,0x3a,0x2f,0xff,0x3d,0x39,0x2d,0xff,0x3e,0x3a,0x2e,0xff,0x3d,0x39,0x2d,0xff,0x3b,0x37,0x2c,0xff,0x3a,0x36,0x2b,0xff,0x3b,0x37,0x2c,0xff,0x3b,0x36,0x2b,0xff,0x3a,0x36,0x2a,0xff,0x39,0x36,0x28,0xff,0x3a,0x35,0x28,0xff,0x3a,0x35,0x28,0xff,0x3a,0x34,0x27,0xff,0x38,0x33,0x26,0xff,0x37,0x32,0x25,0xff,0x37,0x31,0x24,0xff,0x37,0x32,0x25,0xff,0x34,0x31,0x24,0xff,0x34,0x31,0x23,0xff,0x35,0x32,0x24,0xff,0x36,0x32,0x24,0xff,0x33,0x2e,0x21,0xff,0x2e,0x29,0x1c,0xff,0x69,0x66,0x5c,0xff,0xdb,0xda,0xd7,0x9a,0xff,0xff,0xff,0x08,0xff,0xff,0xff,0x00,0xfe,0xf6,0xf9,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xfb,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf1,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x76,0xd8,0xce,0xce,0xfc,0xa3,0x62,0x38,0xff,0xa2,0x43,0x00,0xff,0x9d,0x43,0x00,0xff,0x9a,0x44,0x01,0xff,0x97,0x45,0x01,0xff,0x94,0x44,0x01,0xff,0x90,0x43,0x01,0xff,0x8a,0x41,0x01,0xff,0x83,0x3f,0x01,0xff,0x7c,0x3b,0x01,0xff,0x70,0x36,0x01,0xff,0x67,0x32,0x02,0xff,0x61,0x30,0x01,0xff,0x5b,0x2d,0x01,0xff,0x53,0x2c,0x01,0xff,0x4f,0x29,0x01,0xff,0x53,0x2b,0x01,0xff,0x71,0x42,0x03,0xff,0x2c,0x21,0x01,0xff,0x0f,0x14,0x00,0xff,0x3f,0x2d,0x03,0xff,0x82,0x4c,0x02,0xff,0x91,0x4f,0x01,0xff,0x89,0x4d,0x02,0xff,0x71,0x44,0x02,0xff,0x43,0x2a,0x01,0xff,0x40,0x26,0x01,0xff,0x41,0x26,0x00,0xff,0x3f,0x26,0x00,0xff,0x4a,0x2e,0x00,0xff,0x65,0x4b,0x20,0xff,0x6f,0x58,0x37,0xff,0x7f,0x68,0x47,0xff,0x92,0x80,0x68,0xff,0xa6,0xa0,0x95,0xff,0xa9,0xa8,0xa2,0xff,0xa5,0xa7,0xa4,0xff,0x9d,0xa2,0x9f,0xff,0x9a,0xa1,0x9d,0xff,0x9b,0xa2,0x9f,0xff,0xa5,0xac,0xa8,0xff,0xc2,0xc7,0xc2,0xff,0xd2,0xda,0xd8,0xff,0x9d,0xa9,0xa8,0xff,0xb1,0xbc,0xba,0xff,0xc2,0xcc,0xcb,0xff,0xc7,0xd2,0xd0,0xff,0xc6,0xd0,0xd0,0xff,0xbb,0xc6,0xc6,0xff,0xd1,0xda,0xda,0xff,0x5d,0x5c,0x52,0xff,0x41,0x3d,0x2e,0xff,0x46,0x41,0x33,0xff,0x44,0x3e,0x31,0xff,0x44,0x3e,0x31,0xff,0x42,0x3c,0x2f,0xff,0x41,0x3c,0x2f,0xff,0x40,0x3c,0x30,0xff,0x3e,0x3a,0x2f,0xff,0x40,0x3c,0x32,0xff,0x3f,0x3a,0x31,0xff,0x3f,0x3a,0x2f,0xff,0x3e,0x3a,0x2f,0xff,0x3c,0x3a,0x2e,0xff,0x3c,0x3a,0x2d,0xff,0x3c,0x39,0x2b,0xff,0x3c,0x37,0x2a,0xff,0x3c,0x38,0x2b,0xff,0x3d,0x39,0x2c,0xff,0x3b,0x37,0x2a,0xff,0x39,0x36,0x29,0xff,0x3a,0x36,0x29,0xff,0x3a,0x36,0x29,0xff,0x3a,0x35,0x29,0xff,0x3a,0x35,0x28,0xff,0x37,0x33,0x26,0xff,0x38,0x33,0x25,0xff,0x39,0x33,0x26,0xff,0x38,0x32,0x25,0xff,0x37,0x31,0x24,0xff,0x36,0x31,0x23,0xff,0x36,0x31,0x23,0xff,0x37,0x31,0x23,0xff,0x37,0x32,0x22,0xff,0x34,0x30,0x21,0xff,0x35,0x30,0x21,0xff,0x35,0x30,0x22,0xff,0x35,0x30,0x23,0xff,0x33,0x2e,0x21,0xff,0x2a,0x24,0x15,0xff,0x4f,0x4b,0x3e,0xff,0xc8,0xc7,0xc3,0xba,0xff,0xff,0xff,0x19,0xff,0xff,0xff,0x00,0xff,0xf9,0xfb,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xfb,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xff,0xf7,0xfa,0x00,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x90,0xce,0xb9,0xb3,0xff,0x66,0x2e,0x1e,0xff,0x5a,0x16,0x00,0xff,0xa2,0x48,0x03,0xff,0x9c,0x47,0x00,0xff,0x97,0x45,0x01,0xff,0x94,0x46,0x02,0xff,0x94,0x46,0x02,0xff,0x92,0x46,0x00,0xff,0x89,0x43,0x01,0xff,0x80,0x3e,0x02,0xff,0x78,0x3a,0x01,0xff,0x6f,0x36,0x01,0xff,0x67,0x33,0x02,0xff,0x5f,0x30,0x01,0xff,0x55,0x2a,0x00,0xff,0x50,0x28,0x01,0xff,0x49,0x23,0x01,0xff,0x5b,0x32,0x03,0xff,0x4d,0x32,0x03,0xff,0x13,0x14,0x00,0xff,0x43,0x2e,0x01,0xff,0x86,0x4c,0x02,0xff,0x8f,0x4e,0x01,0xff,0x89,0x4e,0x04,0xff,0x80,0x49,0x02,0xff,0x60,0x3a,0x02,0xff,0x43,0x28,0x00,0xff,0x3a,0x20,0x01,0xff,0x45,0x27,0x01,0xff,0x51,0x2d,0x00,0xff,0x61,0x3d,0x03,0xff,0x7b,0x5b,0x25,0xff,0x88,0x69,0x42,0xff,0x80,0x68,0x47,0xff,0x71,0x63,0x4b,0xff,0x5d,0x5a,0x4b,0xff,0x44,0x43,0x39,0xff,0x2c,0x2b,0x24,0xff,0x1d,0x1d,0x16,0xff,0x16,0x15,0x0e,0xff,0x13,0x11,0x0a,0xff,0x13,0x11,0x0c,0xff,0x1a,0x19,0x15,0xff,0x7c,0x81,0x7e,0xff,0xd5,0xe2,0xe1,0xff,0xc2,0xce,0xcd,0xff,0xc4,0xd0,0xce,0xff,0xc2,0xce,0xcc,0xff,0xb7,0xc2,0xc2,0xff,0xbf,0xcb,0xc8,0xff,0xd4,0xe0,0xe1,0xff,0x6b,0x6c,0x69,0xff,0x3f,0x3a,0x30,0xff,0x44,0x40,0x32,0xff,0x44,0x3d,0x31,0xff,0x44,0x3e,0x31,0xff,0x43,0x3e,0x30,0xff,0x41,0x3d,0x2f,0xff,0x40,0x3c,0x2f,0xff,0x3f,0x3b,0x2f,0xff,0x40,0x3b,0x31,0xff,0x40,0x3b,0x2f,0xff,0x40,0x3a,0x2f,0xff,0x3f,0x3a,0x2d,0xff,0x3d,0x39,0x2c,0xff,0x3c,0x38,0x2a,0xff,0x3b,0x36,0x29,0xff,0x3c,0x36,0x29,0xff,0x3b,0x35,0x29,0xff,0x3a,0x35,0x26,0xff,0x3a,0x36,0x27,0xff,0x3a,0x35,0x27,0xff,0x3a,0x34,0x27,0xff,0x39,0x34,0x27,0xff,0x3b,0x34,0x27,0xff,0x39,0x32,0x25,0xff,0x39,0x33,0x24,0xff,0x38,0x32,0x23,0xff,0x38,0x32,0x22,0xff,0x36,0x30,0x21,0xff,0x39,0x32,0x23,0xff,0x37,0x30,0x22,0xff,0x36,0x30,0x21,0xff,0x35,0x2f,0x20,0xff,0x36,0x2f,0x21,0xff,0x35,0x2e,0x20,0xff,0x36,0x2f,0x20,0xff,0x35,0x2f,0x20,0xff,0x35,0x2e,0x20,0xff,0x35,0x2f,0x20,0xff,0x33,0x2d,0x1e,0xff,0x2d,0x26,0x16,0xff,0x40,0x3a,0x2d,0xff,0xb0,0xad,0xa8,0xd0,0xff,0xff,0xff,0x27,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfe,0xf8,0xfa,0x00,0xff,0xff,0xff,0x06,0xff,0xff,0xff,0xa1,0xc0,0xa6,0xa0,0xff,0x5e,0x22,0x13,0xff,0x53,0x10,0x00,0xff,0x4b,0x13,0x02,0xff,0x7e,0x37,0x03,0xff,0x9f,0x4a,0x01,0xff,0x96,0x46,0x01,0xff,0x90,0x44,0x01,0xff,0x96,0x47,0x01,0xff,0x92,0x48,0x01,0xff,0x82,0x40,0x02,0xff,0x7a,0x3a,0x01,0xff,0x7a,0x3d,0x01,0xff,0x73,0x39,0x01,0xff,0x6c,0x36,0x01,0xff,0x5e,0x2f,0x00,0xff,0x56,0x2b,0x01,0xff,0x53,0x29,0x01,0xff,0x4c,0x27,0x01,0xff,0x64,0x39,0x04,0xff,0x2e,0x22,0x01,0xff,0x2e,0x27,0x01,0xff,0x83,0x4c,0x02,0xff,0x93,0x4d,0x01,0xff,0x8c,0x4d,0x01,0xff,0x8d,0x4e,0x01,0xff,0x79,0x44,0x01,0xff,0x58,0x34,0x02,0xff,0x49,0x2a,0x01,0xff,0x4e,0x2d,0x01,0xff,0x66,0x38,0x01,0xff,0x78,0x44,0x02,0xff,0x79,0x4e,0x08,0xff,0x69,0x4c,0x14,0xff,0x46,0x34,0x0f,0xff,0x34,0x2e,0x17,0xff,0x26,0x26,0x1e,0xff,0x08,0x08,0x03,0xff,0x0b,0x0a,0x06,0xff,0x1b,0x19,0x15,0xff,0x37,0x37,0x32,0xff,0x53,0x57,0x53,0xff,0x64,0x6a,0x66,0xff,0x4f,0x53,0x50,0xff,0x26,0x25,0x24,0xff,0x4f,0x52,0x4f,0xff,0xc6,0xd2,0xcf,0xff,0xd0,0xdc,0xda,0xff,0xbf,0xca,0xc9,0xff,0xb4,0xc0,0xbf,0xff,0xb5,0xc1,0xbf,0xff,0xca,0xd5,0xd3,0xff,0xcf,0xda,0xdb,0xff,0x60,0x62,0x65,0xff,0x44,0x41,0x3c,0xff,0x44,0x41,0x32,0xff,0x44,0x3d,0x31,0xff,0x42,0x3b,0x2f,0xff,0x44,0x3d,0x30,0xff,0x42,0x3b,0x2e,0xff,0x40,0x39,0x2d,0xff,0x41,0x3a,0x2d,0xff,0x3f,0x3a,0x2d,0xff,0x3e,0x38,0x2c,0xff,0x3e,0x38,0x2c,0xff,0x3e,0x38,0x2c,0xff,0x3e,0x38,0x2b,0xff,0x3d,0x37,0x29,0xff,0x3b,0x35,0x28,0xff,0x3b,0x34,0x27,0xff,0x3b,0x34,0x26,0xff,0x3a,0x34,0x25,0xff,0x3a,0x34,0x26,0xff,0x39,0x33,0x26,0xff,0x38,0x32,0x25,0xff,0x38,0x33,0x25,0xff,0x38,0x31,0x23,0xff,0x39,0x32,0x23,0xff,0x37,0x30,0x21,0xff,0x37,0x30,0x20,0xff,0x38,0x31,0x21,0xff,0x36,0x2f,0x20,0xff,0x39,0x30,0x22,0xff,0x38,0x30,0x21,0xff,0x36,0x2f,0x1f,0xff,0x36,0x2e,0x1f,0xff,0x36,0x2e,0x1f,0xff,0x36,0x2e,0x1e,0xff,0x36,0x2e,0x1e,0xff,0x34,0x2d,0x1d,0xff,0x34,0x2d,0x1e,0xff,0x34,0x2c,0x1e,0xff,0x32,0x2b,0x1c,0xff,0x32,0x2c,0x1c,0xff,0x2d,0x26,0x16,0xff,0x37,0x30,0x22,0xff,0x9f,0x9c,0x96,0xdf,0xfb,0xfb,0xfb,0x30,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfe,0xf8,0xfb,0x00,0xff,0xff,0xff,0x08,0xff,0xff,0xff,0xac,0xb2,0x97,0x91,0xff,0x55,0x1a,0x0d,0xff,0x51,0x0e,0x00,0xff,0x58,0x17,0x00,0xff,0x4e,0x16,0x03,0xff,0x4b,0x1a,0x03,0xff,0x92,0x45,0x03,0xff,0x95,0x47,0x00,0xff,0x8f,0x42,0x02,0xff,0x94,0x48,0x02,0xff,0x91,0x48,0x01,0xff,0x7e,0x3e,0x00,0xff,0x7c,0x3f,0x02,0xff,0x7f,0x41,0x02,0xff,0x72,0x3b,0x01,0xff,0x69,0x36,0x01,0xff,0x64,0x34,0x02,0xff,0x5c,0x2f,0x01,0xff,0x59,0x2d,0x02,0xff,0x61,0x31,0x02,0xff,0x63,0x3a,0x05,0xff,0x2a,0x22,0x01,0xff,0x6b,0x40,0x02,0xff,0x9f,0x52,0x03,0xff,0x92,0x4e,0x02,0xff,0x94,0x4d,0x02,0xff,0x8d,0x4c,0x01,0xff,0x75,0x40,0x02,0xff,0x5c,0x35,0x02,0xff,0x66,0x38,0x02,0xff,0x7b,0x41,0x02,0xff,0x6e,0x3d,0x03,0xff,0x48,0x2b,0x00,0xff,0x21,0x14,0x00,0xff,0x0e,0x0a,0x00,0xff,0x23,0x17,0x00,0xff,0x6a,0x63,0x53,0xff,0xaa,0xb5,0xb4,0xff,0x96,0xa0,0x9b,0xff,0x7f,0x86,0x83,0xff,0x80,0x84,0x81,0xff,0x90,0x94,0x92,0xff,0xab,0xb4,0xb1,0xff,0xc5,0xd3,0xd0,0xff,0xbc,0xc6,0xc4,0xff,0x97,0x9f,0x9c,0xff,0x4d,0x50,0x4b,0xff,0x50,0x53,0x52,0xff,0xad,0xb7,0xb8,0xff,0xc9,0xd5,0xd5,0xff,0xbe,0xca,0xc8,0xff,0xc6,0xd1,0xce,0xff,0xcc,0xd7,0xd6,0xff,0xcc,0xd6,0xd6,0xff,0x52,0x58,0x5a,0xff,0x2c,0x2a,0x2d,0xff,0x50,0x4a,0x44,0xff,0x45,0x3e,0x2f,0xff,0x45,0x3d,0x30,0xff,0x42,0x3b,0x2f,0xff,0x42,0x3b,0x2e,0xff,0x41,0x39,0x2d,0xff,0x40,0x39,0x2c,0xff,0x3f,0x3a,0x2a,0xff,0x3f,0x38,0x2b,0xff,0x3e,0x37,0x2a,0xff,0x3f,0x37,0x2a,0xff,0x3d,0x36,0x28,0xff,0x3c,0x35,0x26,0xff,0x3c,0x35,0x27,0xff,0x3a,0x33,0x24,0xff,0x3b,0x34,0x25,0xff,0x3b,0x33,0x25,0xff,0x3c,0x35,0x26,0xff,0x3a,0x32,0x25,0xff,0x39,0x32,0x24,0xff,0x39,0x32,0x23,0xff,0x37,0x30,0x21,0xff,0x37,0x30,0x20,0xff,0x39,0x31,0x21,0xff,0x38,0x30,0x20,0xff,0x37,0x30,0x20,0xff,0x36,0x2d,0x1e,0xff,0x38,0x2f,0x20,0xff,0x37,0x2e,0x1f,0xff,0x37,0x2e,0x1f,0xff,0x38,0x2e,0x20,0xff,0x36,0x2d,0x1e,0xff,0x36,0x2e,0x1d,0xff,0x35,0x2d,0x1b,0xff,0x34,0x2d,0x1c,0xff,0x33,0x2d,0x1d,0xff,0x32,0x2b,0x1d,0xff,0x32,0x2b,0x1d,0xff,0x31,0x2a,0x1b,0xff,0x31,0x2b,0x1c,0xff,0x2e,0x27,0x18,0xff,0x32,0x2a,0x1c,0xff,0x91,0x8c,0x85,0xe7,0xfa,0xfa,0xfa,0x36,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfe,0xf8,0xfa,0x00,0xff,0xff,0xff,0x07,0xff,0xff,0xfe,0xac,0xe0,0xac,0x8b,0xff,0x62,0x1d,0x08,0xff,0x47,0x0b,0x00,0xff,0x54,0x15,0x01,0xff,0x55,0x16,0x02,0xff,0x59,0x1a,0x01,0xff,0x41,0x12,0x02,0xff,0x6b,0x2d,0x02,0xff,0x98,0x49,0x02,0xff,0x8f,0x44,0x02,0xff,0x98,0x49,0x03,0xff,0x99,0x4d,0x02,0xff,0x84,0x40,0x00,0xff,0x79,0x3b,0x01,0xff,0x7c,0x3e,0x02,0xff,0x6e,0x37,0x00,0xff,0x63,0x34,0x01,0xff,0x65,0x35,0x02,0xff,0x60,0x32,0x01,0xff,0x59,0x2f,0x02,0xff,0x5d,0x2f,0x01,0xff,0x55,0x33,0x03,0xff,0x47,0x2e,0x01,0xff,0xa2,0x56,0x03,0xff,0xb1,0x5c,0x02,0xff,0x9b,0x4e,0x02,0xff,0x8d,0x49,0x02,0xff,0x8a,0x4a,0x02,0xff,0x7a,0x41,0x01,0xff,0x79,0x40,0x03,0xff,0x7a,0x42,0x03,0xff,0x4a,0x28,0x02,0xff,0x18,0x0f,0x01,0xff,0x0c,0x08,0x03,0xff,0x2d,0x1c,0x06,0xff,0x56,0x38,0x01,0xff,0x72,0x52,0x15,0xff,0x87,0x80,0x70,0xff,0xb0,0xb8,0xb7,0xff,0xd0,0xdb,0xdd,0xff,0xb9,0xc1,0xc2,0xff,0x84,0x85,0x87,0xff,0x88,0x89,0x89,0xff,0xa1,0xa9,0xa7,0xff,0xbe,0xca,0xc9,0xff,0xc5,0xce,0xcd,0xff,0x97,0xa1,0x9d,0xff,0x3b,0x3d,0x39,0xff,0x12,0x0d,0x0c,0xff,0x4d,0x4f,0x50,0xff,0xa4,0xaf,0xaf,0xff,0xca,0xd6,0xd5,0xff,0xce,0xd8,0xd6,0xff,0xc6,0xd0,0xd0,0xff,0xc9,0xd3,0xd3,0xff,0x60,0x66,0x65,0xff,0x04,0x03,0x06,0xff,0x45,0x41,0x40,0xff,0x47,0x40,0x32,0xff,0x45,0x3d,0x2f,0xff,0x43,0x3a,0x2d,0xff,0x42,0x3a,0x2d,0xff,0x42,0x38,0x2c,0xff,0x40,0x38,0x2a,0xff,0x3f,0x38,0x2a,0xff,0x3e,0x37,0x28,0xff,0x3c,0x36,0x26,0xff,0x3c,0x35,0x26,0xff,0x3c,0x35,0x26,0xff,0x3d,0x36,0x27,0xff,0x3c,0x34,0x26,0xff,0x3b,0x33,0x25,0xff,0x3a,0x32,0x24,0xff,0x3b,0x33,0x24,0xff,0x3b,0x33,0x25,0xff,0x39,0x32,0x23,0xff,0x39,0x32,0x23,0xff,0x38,0x31,0x21,0xff,0x38,0x31,0x20,0xff,0x37,0x2f,0x1f,0xff,0x39,0x31,0x20,0xff,0x38,0x31,0x1f,0xff,0x37,0x2e,0x1f,0xff,0x37,0x2e,0x1f,0xff,0x37,0x2e,0x20,0xff,0x37,0x2d,0x1f,0xff,0x37,0x2d,0x1f,0xff,0x36,0x2d,0x1f,0xff,0x36,0x2c,0x1e,0xff,0x35,0x2c,0x1c,0xff,0x35,0x2c,0x1c,0xff,0x34,0x2c,0x1b,0xff,0x34,0x2d,0x1d,0xff,0x33,0x2b,0x1c,0xff,0x33,0x2a,0x1c,0xff,0x31,0x29,0x1a,0xff,0x32,0x2a,0x1b,0xff,0x31,0x29,0x1a,0xff,0x2f,0x25,0x16,0xff,0x2f,0x26,0x16,0xff,0x8c,0x86,0x7e,0xe8,0xf9,0xf8,0xf8,0x35,0xff,0xff,0xff,0x00,0xfe,0xfa,0xfc,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xf8,0xfb,0x00,0xff,0xff,0xff,0x04,0xff,0xff,0xff,0xa6,0xec,0xb2,0x8a,0xff,0xd1,0x58,0x06,0xff,0x72,0x23,0x00,0xff,0x4b,0x10,0x01,0xff,0x4d,0x14,0x02,0xff,0x55,0x16,0x01,0xff,0x55,0x19,0x02,0xff,0x4d,0x16,0x03,0xff,0x40,0x15,0x03,0xff,0x8a,0x42,0x03,0xff,0x94,0x46,0x02,0xff,0x98,0x49,0x02,0xff,0x9d,0x4e,0x02,0xff,0x8a,0x42,0x02,0xff,0x74,0x36,0x01,0xff,0x74,0x39,0x02,0xff,0x6b,0x34,0x01,0xff,0x5f,0x30,0x01,0xff,0x60,0x32,0x01,0xff,0x60,0x32,0x02,0xff,0x57,0x2d,0x02,0xff,0x46,0x24,0x01,0xff,0x4f,0x2f,0x02,0xff,0x81,0x48,0x02,0xff,0x96,0x53,0x04,0xff,0x4f,0x2c,0x02,0xff,0x76,0x3d,0x04,0xff,0x8a,0x47,0x02,0xff,0x8b,0x45,0x03,0xff,0x81,0x46,0x02,0xff,0x61,0x35,0x02,0xff,0x2d,0x1d,0x02,0xff,0x2f,0x1b,0x04,0xff,0x4a,0x29,0x01,0xff,0x6c,0x44,0x12,0xff,0x95,0x6a,0x37,0xff,0x90,0x74,0x43,0xff,0x8a,0x78,0x57,0xff,0x8f,0x8c,0x80,0xff,0x9d,0xa5,0xa1,0xff,0xb2,0xb9,0xba,0xff,0xbc,0xc5,0xc6,0xff,0x8b,0x8f,0x8d,0xff,0x86,0x89,0x86,0xff,0xa8,0xae,0xac,0xff,0xc9,0xd3,0xd2,0xff,0xd4,0xdc,0xdc,0xff,0xd9,0xe1,0xdf,0xff,0x64,0x67,0x64,0xff,0x12,0x0d,0x0b,0xff,0x23,0x1f,0x1d,0xff,0x53,0x58,0x57,0xff,0xa5,0xb1,0xb1,0xff,0xcd,0xd7,0xd7,0xff,0xce,0xd7,0xd6,0xff,0xce,0xda,0xda,0xff,0x64,0x6b,0x6b,0xff,0x00,0x00,0x00,0xff,0x1d,0x1c,0x1f,0xff,0x56,0x50,0x51,0xff,0x45,0x3b,0x2e,0xff,0x41,0x37,0x2b,0xff,0x42,0x37,0x2c,0xff,0x41,0x37,0x2a,0xff,0x3f,0x36,0x27,0xff,0x3e,0x36,0x27,0xff,0x3f,0x36,0x26,0xff,0x3d,0x35,0x25,0xff,0x3c,0x34,0x24,0xff,0x3b,0x33,0x24,0xff,0x3b,0x33,0x24,0xff,0x3b,0x33,0x24,0xff,0x3a,0x32,0x22,0xff,0x3b,0x32,0x22,0xff,0x3b,0x32,0x23,0xff,0x3a,0x30,0x23,0xff,0x3a,0x31,0x22,0xff,0x38,0x30,0x20,0xff,0x3a,0x32,0x22,0xff,0x38,0x31,0x1f,0xff,0x39,0x31,0x1f,0xff,0x37,0x2e,0x1e,0xff,0x36,0x2e,0x1d,0xff,0x37,0x2f,0x1f,0xff,0x35,0x2c,0x1d,0xff,0x37,0x2d,0x1e,0xff,0x38,0x2d,0x1e,0xff,0x37,0x2c,0x1d,0xff,0x36,0x2b,0x1c,0xff,0x36,0x2a,0x1c,0xff,0x35,0x2b,0x1a,0xff,0x35,0x2b,0x1a,0xff,0x34,0x2b,0x1b,0xff,0x33,0x2b,0x1c,0xff,0x32,0x29,0x1b,0xff,0x33,0x2a,0x1c,0xff,0x33,0x2a,0x1b,0xff,0x33,0x2a,0x1b,0xff,0x31,0x28,0x19,0xff,0x31,0x29,0x19,0xff,0x2c,0x24,0x14,0xff,0x2c,0x23,0x13,0xff,0x8b,0x86,0x7d,0xe4,0xfa,0xfa,0xfa,0x2f,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xf6,0xfa,0x00,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x99,0xf0,0xb8,0x91,0xff,0xc8,0x56,0x07,0xff,0xcc,0x53,0x00,0xff,0x98,0x3b,0x03,0xff,0x4d,0x12,0x01,0xff,0x4e,0x13,0x01,0xff,0x51,0x15,0x02,0xff,0x53,0x19,0x01,0xff,0x53,0x1a,0x01,0xff,0x40,0x11,0x02,0xff,0x58,0x23,0x02,0xff,0x9a,0x48,0x02,0xff,0x94,0x45,0x01,0xff,0x98,0x49,0x00,0xff,0x91,0x47,0x02,0xff,0x75,0x35,0x01,0xff,0x6b,0x2e,0x01,0xff,0x68,0x30,0x01,0xff,0x61,0x30,0x02,0xff,0x60,0x31,0x01,0xff,0x5e,0x31,0x02,0xff,0x55,0x2d,0x01,0xff,0x3b,0x20,0x01,0xff,0x4c,0x2b,0x03,0xff,0x9e,0x55,0x04,0xff,0x3f,0x26,0x02,0xff,0x00,0x03,0x00,0xff,0x6d,0x3f,0x02,0xff,0x89,0x4b,0x02,0xff,0x5e,0x35,0x02,0xff,0x2f,0x1a,0x02,0xff,0x05,0x05,0x01,0xff,0x2c,0x1e,0x02,0xff,0x6e,0x3c,0x03,0xff,0x70,0x3c,0x02,0xff,0x85,0x44,0x01,0xff,0x88,0x4d,0x10,0xff,0x7a,0x62,0x44,0xff,0x6b,0x62,0x51,0xff,0x72,0x70,0x62,0xff,0x90,0x93,0x8f,0xff,0x9f,0xa4,0xa3,0xff,0xb6,0xbe,0xbd,0xff,0x9d,0xa1,0x9e,0xff,0x8f,0x93,0x91,0xff,0xa5,0xad,0xac,0xff,0xc2,0xcd,0xcc,0xff,0xc3,0xcd,0xcd,0xff,0xd5,0xdf,0xdf,0xff,0xaf,0xb6,0xb4,0xff,0x1d,0x1a,0x18,0xff,0x1a,0x16,0x14,0xff,0x27,0x26,0x24,0xff,0x61,0x68,0x66,0xff,0xae,0xb9,0xba,0xff,0xd7,0xe1,0xe1,0xff,0xd4,0xde,0xdf,0xff,0x70,0x76,0x78,0xff,0x06,0x05,0x04,0xff,0x07,0x05,0x06,0xff,0x33,0x30,0x35,0xff,0x4b,0x42,0x3a,0xff,0x41,0x36,0x28,0xff,0x42,0x37,0x2a,0xff,0x3f,0x36,0x28,0xff,0x3e,0x35,0x27,0xff,0x3e,0x35,0x26,0xff,0x3e,0x35,0x25,0xff,0x3c,0x33,0x23,0xff,0x3b,0x33,0x23,0xff,0x3b,0x33,0x22,0xff,0x3c,0x34,0x23,0xff,0x3b,0x32,0x22,0xff,0x39,0x31,0x1f,0xff,0x38,0x30,0x1f,0xff,0x3a,0x31,0x22,0xff,0x3b,0x32,0x24,0xff,0x39,0x30,0x20,0xff,0x38,0x30,0x1f,0xff,0x37,0x2f,0x1e,0xff,0x38,0x31,0x1e,0xff,0x39,0x31,0x20,0xff,0x37,0x2e,0x1e,0xff,0x37,0x2e,0x1d,0xff,0x37,0x2d,0x1d,0xff,0x37,0x2d,0x1d,0xff,0x36,0x2b,0x1c,0xff,0x35,0x2a,0x1a,0xff,0x35,0x2b,0x1a,0xff,0x37,0x2e,0x1c,0xff,0x36,0x2c,0x1b,0xff,0x34,0x2a,0x1a,0xff,0x35,0x2b,0x1b,0xff,0x33,0x2a,0x19,0xff,0x33,0x2a,0x1a,0xff,0x32,0x29,0x18,0xff,0x32,0x29,0x19,0xff,0x31,0x28,0x18,0xff,0x31,0x28,0x18,0xff,0x30,0x27,0x17,0xff,0x30,0x27,0x17,0xff,0x2f,0x27,0x16,0xff,0x2d,0x24,0x13,0xff,0x2d,0x23,0x12,0xff,0x90,0x8b,0x82,0xdc,0xfb,0xfb,0xfb,0x26,0xff,0xff,0xff,0x00,0xff,0xf9,0xfb,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf8,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf4,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x83,0xf7,0xc3,0xa1,0xff,0xde,0x60,0x0c,0xff,0xb9,0x4b,0x00,0xff,0xba,0x4f,0x01,0xff,0xb9,0x4e,0x03,0xff,0x5d,0x19,0x02,0xff,0x4e,0x13,0x01,0xff,0x51,0x15,0x01,0xff,0x53,0x17,0x00,0xff,0x50,0x18,0x01,0xff,0x51,0x1a,0x01,0xff,0x3e,0x12,0x02,0xff,0x7b,0x37,0x03,0xff,0x99,0x47,0x02,0xff,0x94,0x44,0x01,0xff,0x95,0x47,0x02,0xff,0x81,0x3b,0x02,0xff,0x70,0x2f,0x01,0xff,0x6b,0x30,0x02,0xff,0x66,0x30,0x02,0xff,0x65,0x32,0x02,0xff,0x5f,0x30,0x00,0xff,0x59,0x2f,0x01,0xff,0x41,0x22,0x01,0xff,0x2c,0x19,0x01,0xff,0x52,0x2d,0x03,0xff,0x12,0x0c,0x01,0xff,0x23,0x13,0x03,0xff,0x9c,0x59,0x04,0xff,0x40,0x27,0x02,0xff,0x15,0x0e,0x01,0xff,0x17,0x0b,0x02,0xff,0x43,0x24,0x04,0xff,0x77,0x38,0x02,0xff,0x86,0x3b,0x02,0xff,0x8b,0x3f,0x04,0xff,0x90,0x45,0x01,0xff,0x64,0x3a,0x04,0xff,0x5e,0x4d,0x34,0xff,0x71,0x68,0x5b,0xff,0x67,0x62,0x54,0xff,0x7c,0x7d,0x76,0xff,0x8f,0x92,0x8f,0xff,0xa4,0xaa,0xa8,0xff,0xa7,0xaa,0xaa,0xff,0xa2,0xa8,0xa5,0xff,0xad,0xb6,0xb3,0xff,0xbd,0xc7,0xc6,0xff,0xc0,0xc9,0xc8,0xff,0xc3,0xcd,0xcc,0xff,0xc8,0xd1,0xce,0xff,0x4f,0x51,0x4e,0xff,0x10,0x0c,0x0c,0xff,0x1d,0x19,0x1a,0xff,0x31,0x31,0x31,0xff,0x76,0x7f,0x7b,0xff,0xc8,0xd4,0xd2,0xff,0xd9,0xe3,0xe0,0xff,0x5d,0x62,0x60,0xff,0x11,0x11,0x12,0xff,0x09,0x07,0x07,0xff,0x08,0x06,0x08,0xff,0x41,0x3b,0x3c,0xff,0x48,0x3e,0x33,0xff,0x3f,0x36,0x26,0xff,0x40,0x36,0x27,0xff,0x40,0x36,0x27,0xff,0x3f,0x34,0x24,0xff,0x3d,0x33,0x23,0xff,0x3d,0x33,0x23,0xff,0x3b,0x31,0x21,0xff,0x3b,0x31,0x21,0xff,0x3c,0x32,0x22,0xff,0x3b,0x30,0x20,0xff,0x3a,0x2f,0x1f,0xff,0x3a,0x30,0x20,0xff,0x39,0x2f,0x1f,0xff,0x39,0x2f,0x1f,0xff,0x38,0x30,0x1f,0xff,0x37,0x2f,0x1e,0xff,0x36,0x2e,0x1d,0xff,0x39,0x2f,0x1f,0xff,0x38,0x2e,0x1e,0xff,0x36,0x2d,0x1c,0xff,0x37,0x2d,0x1c,0xff,0x37,0x2d,0x1c,0xff,0x36,0x2c,0x1a,0xff,0x36,0x2c,0x1b,0xff,0x35,0x2b,0x1a,0xff,0x34,0x2a,0x19,0xff,0x35,0x2b,0x19,0xff,0x34,0x29,0x19,0xff,0x33,0x29,0x18,0xff,0x34,0x2a,0x19,0xff,0x33,0x28,0x17,0xff,0x33,0x28,0x18,0xff,0x31,0x26,0x17,0xff,0x31,0x26,0x17,0xff,0x30,0x26,0x16,0xff,0x30,0x26,0x16,0xff,0x30,0x27,0x16,0xff,0x30,0x25,0x15,0xff,0x30,0x26,0x15,0xff,0x31,0x27,0x16,0xff,0x2d,0x23,0x12,0xff,0x2f,0x24,0x14,0xff,0x9c,0x97,0x8f,0xcc,0xff,0xff,0xff,0x17,0xff,0xff,0xff,0x00,0xfe,0xf7,0xf9,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf0,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x66,0xd3,0xc5,0xb8,0xff,0xd7,0x65,0x15,0xff,0xd8,0x54,0x00,0xff,0xb5,0x4e,0x02,0xff,0xab,0x47,0x00,0xff,0xbb,0x4f,0x02,0xff,0x7f,0x2d,0x02,0xff,0x4e,0x11,0x02,0xff,0x55,0x15,0x01,0xff,0x56,0x17,0x01,0xff,0x52,0x17,0x01,0xff,0x52,0x19,0x01,0xff,0x45,0x14,0x03,0xff,0x4a,0x1a,0x03,0xff,0x93,0x45,0x03,0xff,0x98,0x46,0x02,0xff,0x96,0x45,0x00,0xff,0x91,0x43,0x02,0xff,0x80,0x37,0x01,0xff,0x6c,0x2b,0x01,0xff,0x61,0x27,0x01,0xff,0x68,0x2d,0x02,0xff,0x68,0x2e,0x01,0xff,0x64,0x2f,0x01,0xff,0x4e,0x27,0x01,0xff,0x45,0x22,0x01,0xff,0x60,0x2d,0x03,0xff,0x2b,0x16,0x03,0xff,0x4b,0x2a,0x05,0xff,0x5c,0x34,0x06,0xff,0x2e,0x1f,0x07,0xff,0x44,0x27,0x07,0xff,0x70,0x3e,0x04,0xff,0x73,0x3c,0x03,0xff,0x68,0x35,0x03,0xff,0x5d,0x30,0x02,0xff,0x51,0x2c,0x01,0xff,0x37,0x22,0x01,0xff,0x22,0x19,0x00,0xff,0x3e,0x33,0x15,0xff,0x6f,0x65,0x4f,0xff,0x96,0x96,0x89,0xff,0xa5,0xa5,0xa2,0xff,0x98,0x98,0x94,0xff,0x9a,0x9e,0x9a,0xff,0xa5,0xa9,0xa8,0xff,0xa9,0xae,0xab,0xff,0xa0,0xa6,0xa2,0xff,0x91,0x98,0x95,0xff,0x8d,0x92,0x90,0xff,0x7d,0x84,0x81,0xff,0x8e,0x99,0x94,0xff,0x77,0x7e,0x78,0xff,0x2b,0x2a,0x29,0xff,0x1b,0x18,0x18,0xff,0x1d,0x1c,0x1b,0xff,0x3d,0x40,0x3c,0xff,0x98,0xa2,0xa1,0xff,0xd4,0xde,0xdd,0xff,0x41,0x44,0x42,0xff,0x23,0x23,0x22,0xff,0x09,0x06,0x07,0xff,0x08,0x07,0x06,0xff,0x16,0x15,0x1a,0xff,0x4b,0x48,0x49,0xff,0x40,0x36,0x28,0xff,0x41,0x34,0x27,0xff,0x3f,0x34,0x25,0xff,0x3e,0x35,0x23,0xff,0x3d,0x32,0x21,0xff,0x3d,0x33,0x22,0xff,0x3b,0x31,0x20,0xff,0x3c,0x30,0x1f,0xff,0x3c,0x30,0x1f,0xff,0x3a,0x2e,0x1e,0xff,0x3a,0x2f,0x1f,0xff,0x3a,0x30,0x20,0xff,0x3a,0x30,0x1e,0xff,0x38,0x2e,0x1c,0xff,0x38,0x2e,0x1e,0xff,0x38,0x2d,0x1c,0xff,0x39,0x2f,0x1e,0xff,0x37,0x2d,0x1d,0xff,0x37,0x2c,0x1c,0xff,0x36,0x2c,0x1a,0xff,0x35,0x2c,0x19,0xff,0x36,0x2c,0x19,0xff,0x36,0x2c,0x1a,0xff,0x35,0x2b,0x18,0xff,0x33,0x2a,0x17,0xff,0x33,0x2a,0x18,0xff,0x33,0x2a,0x18,0xff,0x33,0x28,0x18,0xff,0x32,0x27,0x17,0xff,0x33,0x29,0x19,0xff,0x32,0x28,0x16,0xff,0x31,0x27,0x16,0xff,0x31,0x27,0x16,0xff,0x31,0x26,0x15,0xff,0x30,0x27,0x15,0xff,0x2f,0x25,0x13,0xff,0x31,0x26,0x15,0xff,0x31,0x26,0x16,0xff,0x30,0x26,0x15,0xff,0x30,0x26,0x15,0xff,0x2e,0x24,0x13,0xff,0x2a,0x1f,0x0e,0xff,0x32,0x28,0x17,0xff,0xac,0xa7,0xa0,0xb5,0xff,0xff,0xff,0x07,0xff,0xff,0xff,0x00,0xfe,0xf3,0xf7,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xec,0xf3,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x44,0xd9,0xd5,0xd1,0xf6,0x73,0x4e,0x2e,0xff,0xca,0x53,0x00,0xff,0xcd,0x56,0x00,0xff,0xb9,0x4e,0x02,0xff,0xbd,0x52,0x02,0xff,0xc6,0x57,0x02,0xff,0xab,0x44,0x03,0xff,0x5b,0x15,0x02,0xff,0x58,0x15,0x01,0xff,0x56,0x16,0x01,0xff,0x54,0x16,0x01,0xff,0x53,0x19,0x01,0xff,0x50,0x19,0x01,0xff,0x3c,0x10,0x03,0xff,0x65,0x28,0x03,0xff,0x9e,0x49,0x03,0xff,0x94,0x44,0x01,0xff,0x93,0x45,0x02,0xff,0x8c,0x3e,0x01,0xff,0x7c,0x32,0x01,0xff,0x69,0x28,0x02,0xff,0x62,0x22,0x02,0xff,0x69,0x2a,0x02,0xff,0x6b,0x2b,0x01,0xff,0x6f,0x2d,0x00,0xff,0x79,0x32,0x01,0xff,0x8e,0x3c,0x01,0xff,0x85,0x3d,0x03,0xff,0x66,0x37,0x04,0xff,0x62,0x35,0x08,0xff,0x25,0x18,0x05,0xff,0x3b,0x29,0x05,0xff,0x2c,0x1e,0x03,0xff,0x0e,0x11,0x01,0xff,0x0d,0x11,0x01,0xff,0x0c,0x11,0x00,0xff,0x11,0x15,0x01,0xff,0x15,0x15,0x02,0xff,0x15,0x15,0x01,0xff,0x19,0x18,0x00,0xff,0x20,0x17,0x00,0xff,0x50,0x38,0x19,0xff,0x93,0x91,0x88,0xff,0x93,0x96,0x91,0xff,0x89,0x89,0x86,0xff,0x6f,0x71,0x6d,0xff,0x4a,0x4c,0x47,0xff,0x35,0x38,0x30,0xff,0x47,0x4b,0x44,0xff,0x91,0x9b,0x96,0xff,0xa1,0xad,0xa9,0xff,0xba,0xc6,0xc3,0xff,0xd6,0xe0,0xde,0xff,0x65,0x6b,0x68,0xff,0x23,0x23,0x21,0xff,0x18,0x17,0x16,0xff,0x21,0x1f,0x1d,0xff,0x52,0x5a,0x52,0xff,0xc3,0xce,0xcc,0xff,0x7c,0x81,0x80,0xff,0x23,0x23,0x21,0xff,0x08,0x06,0x07,0xff,0x0c,0x0a,0x0a,0xff,0x06,0x04,0x05,0xff,0x22,0x1f,0x20,0xff,0x46,0x3d,0x34,0xff,0x3e,0x32,0x23,0xff,0x3f,0x34,0x24,0xff,0x3d,0x33,0x22,0xff,0x3e,0x32,0x22,0xff,0x3c,0x31,0x21,0xff,0x3c,0x30,0x20,0xff,0x3d,0x30,0x20,0xff,0x3b,0x2f,0x1e,0xff,0x3b,0x2f,0x1f,0xff,0x3a,0x2f,0x1e,0xff,0x38,0x2e,0x1e,0xff,0x38,0x2e,0x1d,0xff,0x38,0x2f,0x1c,0xff,0x38,0x2e,0x1d,0xff,0x37,0x2c,0x1c,0xff,0x38,0x2d,0x1d,0xff,0x36,0x2d,0x1a,0xff,0x37,0x2d,0x19,0xff,0x36,0x2c,0x19,0xff,0x34,0x2b,0x19,0xff,0x35,0x2b,0x19,0xff,0x34,0x2a,0x18,0xff,0x32,0x29,0x16,0xff,0x33,0x29,0x17,0xff,0x32,0x28,0x16,0xff,0x32,0x28,0x16,0xff,0x31,0x28,0x15,0xff,0x31,0x27,0x16,0xff,0x31,0x27,0x17,0xff,0x32,0x27,0x15,0xff,0x31,0x25,0x13,0xff,0x31,0x26,0x14,0xff,0x30,0x26,0x13,0xff,0x30,0x26,0x14,0xff,0x30,0x25,0x13,0xff,0x2f,0x25,0x13,0xff,0x30,0x25,0x15,0xff,0x2f,0x25,0x15,0xff,0x30,0x25,0x15,0xff,0x2e,0x24,0x12,0xff,0x2e,0x24,0x12,0xff,0x27,0x1d,0x09,0xff,0x38,0x2d,0x1b,0xff,0xc1,0xbe,0xb9,0x93,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x21,0xec,0xe8,0xe5,0xe0,0x72,0x5f,0x4a,0xff,0x5b,0x31,0x0e,0xff,0xce,0x5c,0x02,0xff,0xc9,0x54,0x00,0xff,0xbd,0x4f,0x01,0xff,0xd5,0x5e,0x01,0xff,0xc2,0x55,0x02,0xff,0xba,0x4b,0x02,0xff,0x80,0x25,0x03,0xff,0x58,0x14,0x02,0xff,0x56,0x15,0x01,0xff,0x55,0x16,0x01,0xff,0x56,0x19,0x01,0xff,0x54,0x19,0x01,0xff,0x49,0x16,0x01,0xff,0x38,0x0e,0x02,0xff,0x86,0x3a,0x02,0xff,0xa1,0x48,0x02,0xff,0x9b,0x46,0x01,0xff,0x95,0x42,0x01,0xff,0x8b,0x3d,0x01,0xff,0x7f,0x35,0x01,0xff,0x74,0x2b,0x01,0xff,0x74,0x2d,0x01,0xff,0x78,0x2e,0x00,0xff,0x84,0x34,0x01,0xff,0x8a,0x38,0x00,0xff,0x84,0x36,0x02,0xff,0x6d,0x2f,0x03,0xff,0x4e,0x29,0x04,0xff,0x31,0x1a,0x03,0xff,0x35,0x1e,0x05,0xff,0x34,0x1d,0x04,0xff,0x2a,0x17,0x01,0xff,0x30,0x20,0x02,0xff,0x3a,0x27,0x01,0xff,0x41,0x2c,0x01,0xff,0x44,0x2f,0x01,0xff,0x49,0x30,0x01,0xff,0x56,0x32,0x02,0xff,0x5e,0x36,0x03,0xff,0x6b,0x3a,0x01,0xff,0x64,0x39,0x00,0xff,0x49,0x46,0x30,0xff,0x44,0x45,0x3f,0xff,0x2b,0x2b,0x24,0xff,0x32,0x34,0x2e,0xff,0x1f,0x21,0x1d,0xff,0x12,0x0f,0x08,0xff,0x68,0x6f,0x64,0xff,0x8d,0x98,0x94,0xff,0x70,0x73,0x72,0xff,0x6b,0x6b,0x65,0xff,0xce,0xd9,0xd5,0xff,0xb7,0xc4,0xc2,0xff,0x65,0x6a,0x67,0xff,0x21,0x20,0x1e,0xff,0x19,0x17,0x16,0xff,0x2a,0x2d,0x28,0xff,0x82,0x89,0x89,0xff,0xc8,0xd2,0xd2,0xff,0x40,0x43,0x43,0xff,0x04,0x00,0x01,0xff,0x0c,0x0a,0x0a,0xff,0x0a,0x08,0x09,0xff,0x05,0x03,0x05,0xff,0x33,0x2f,0x2e,0xff,0x42,0x39,0x2b,0xff,0x41,0x33,0x20,0xff,0x3d,0x32,0x21,0xff,0x3e,0x32,0x21,0xff,0x3d,0x31,0x20,0xff,0x3d,0x30,0x20,0xff,0x3d,0x2f,0x1f,0xff,0x3c,0x2f,0x1f,0xff,0x3b,0x2e,0x1e,0xff,0x3c,0x2f,0x1f,0xff,0x3a,0x2d,0x1e,0xff,0x3a,0x2e,0x1d,0xff,0x3a,0x2e,0x1c,0xff,0x38,0x2d,0x1b,0xff,0x38,0x2c,0x1a,0xff,0x38,0x2c,0x1a,0xff,0x37,0x2c,0x1a,0xff,0x36,0x2b,0x18,0xff,0x36,0x2a,0x18,0xff,0x35,0x2a,0x18,0xff,0x35,0x29,0x17,0xff,0x35,0x2a,0x18,0xff,0x35,0x29,0x17,0xff,0x35,0x2a,0x18,0xff,0x34,0x28,0x16,0xff,0x32,0x27,0x14,0xff,0x31,0x27,0x15,0xff,0x31,0x27,0x15,0xff,0x31,0x26,0x15,0xff,0x32,0x27,0x15,0xff,0x31,0x26,0x14,0xff,0x32,0x26,0x14,0xff,0x31,0x25,0x13,0xff,0x30,0x25,0x13,0xff,0x30,0x24,0x12,0xff,0x31,0x25,0x13,0xff,0x31,0x25,0x12,0xff,0x30,0x24,0x14,0xff,0x30,0x24,0x14,0xff,0x31,0x25,0x13,0xff,0x2f,0x23,0x11,0xff,0x2f,0x23,0x11,0xff,0x27,0x1a,0x08,0xff,0x4b,0x41,0x31,0xff,0xd8,0xd5,0xd2,0x68,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf6,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xff,0xf7,0xfa,0x00,0xff,0xff,0xff,0x07,0xfa,0xf9,0xf9,0xbb,0x8f,0x7b,0x6b,0xff,0x45,0x2e,0x15,0xff,0x67,0x3d,0x1c,0xff,0xd0,0x5c,0x02,0xff,0xc4,0x51,0x01,0xff,0xc5,0x54,0x00,0xff,0xd3,0x5e,0x02,0xff,0xab,0x44,0x01,0xff,0xa9,0x43,0x02,0xff,0xaa,0x43,0x03,0xff,0x62,0x17,0x02,0xff,0x5c,0x18,0x02,0xff,0x57,0x17,0x02,0xff,0x59,0x1a,0x01,0xff,0x56,0x1a,0x02,0xff,0x53,0x19,0x01,0xff,0x44,0x11,0x02,0xff,0x50,0x1a,0x03,0xff,0xa4,0x4a,0x03,0xff,0xa7,0x4a,0x01,0xff,0x9d,0x47,0x01,0xff,0x91,0x41,0x01,0xff,0x89,0x3c,0x02,0xff,0x83,0x37,0x02,0xff,0x81,0x36,0x02,0xff,0x84,0x37,0x02,0xff,0x81,0x35,0x02,0xff,0x78,0x33,0x01,0xff,0x6f,0x2e,0x01,0xff,0x5b,0x25,0x01,0xff,0x2b,0x18,0x04,0xff,0x45,0x27,0x05,0xff,0x8a,0x53,0x04,0xff,0x61,0x30,0x03,0xff,0x54,0x2a,0x03,0xff,0x5f,0x2e,0x03,0xff,0x60,0x2f,0x01,0xff,0x6a,0x35,0x01,0xff,0x6d,0x37,0x02,0xff,0x76,0x3b,0x00,0xff,0x7f,0x41,0x02,0xff,0x6d,0x3a,0x04,0xff,0x48,0x28,0x02,0xff,0x1d,0x15,0x00,0xff,0x07,0x07,0x00,0xff,0x09,0x09,0x01,0xff,0x2f,0x30,0x24,0xff,0x89,0x92,0x89,0xff,0xa0,0xaa,0xa4,0xff,0x14,0x12,0x10,0xff,0x4a,0x4d,0x46,0xff,0x6d,0x71,0x6e,0xff,0x6a,0x67,0x67,0xff,0x30,0x20,0x17,0xff,0x88,0x87,0x79,0xff,0xd1,0xdc,0xda,0xff,0xc5,0xce,0xcb,0xff,0x5a,0x5d,0x5b,0xff,0x20,0x21,0x20,0xff,0x21,0x20,0x1d,0xff,0x48,0x4b,0x47,0xff,0xb0,0xbe,0xba,0xff,0x97,0x9e,0x9f,0xff,0x08,0x04,0x04,0xff,0x0b,0x07,0x07,0xff,0x09,0x07,0x07,0xff,0x05,0x06,0x05,0xff,0x0e,0x0f,0x12,0xff,0x4c,0x48,0x4b,0xff,0x44,0x36,0x29,0xff,0x3c,0x2f,0x1c,0xff,0x3c,0x31,0x1f,0xff,0x3b,0x30,0x1e,0xff,0x3d,0x2f,0x1d,0xff,0x3e,0x2f,0x1e,0xff,0x3c,0x2e,0x1e,0xff,0x3c,0x2d,0x1d,0xff,0x3b,0x2e,0x1e,0xff,0x3a,0x2d,0x1d,0xff,0x39,0x2c,0x1c,0xff,0x39,0x2d,0x1b,0xff,0x39,0x2e,0x1b,0xff,0x36,0x2b,0x19,0xff,0x38,0x2c,0x19,0xff,0x38,0x2c,0x1a,0xff,0x36,0x2b,0x19,0xff,0x36,0x2a,0x18,0xff,0x35,0x29,0x17,0xff,0x34,0x28,0x16,0xff,0x35,0x29,0x17,0xff,0x34,0x28,0x16,0xff,0x35,0x29,0x17,0xff,0x32,0x26,0x14,0xff,0x34,0x28,0x15,0xff,0x35,0x29,0x15,0xff,0x32,0x26,0x14,0xff,0x32,0x26,0x14,0xff,0x33,0x26,0x14,0xff,0x31,0x25,0x13,0xff,0x32,0x25,0x13,0xff,0x31,0x25,0x13,0xff,0x30,0x24,0x12,0xff,0x30,0x24,0x12,0xff,0x30,0x25,0x12,0xff,0x31,0x24,0x12,0xff,0x30,0x24,0x12,0xff,0x30,0x24,0x13,0xff,0x2f,0x23,0x11,0xff,0x2e,0x22,0x10,0xff,0x2f,0x23,0x11,0xff,0x2e,0x21,0x0f,0xff,0x25,0x18,0x05,0xff,0x60,0x56,0x49,0xf4,0xee,0xed,0xec,0x3b,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x86,0xb0,0xa2,0x9a,0xff,0x54,0x37,0x20,0xff,0x4d,0x36,0x24,0xff,0x6b,0x41,0x1e,0xff,0xcc,0x59,0x02,0xff,0xbe,0x4b,0x01,0xff,0xd6,0x5e,0x01,0xff,0xc1,0x53,0x01,0xff,0xaa,0x45,0x01,0xff,0xb1,0x47,0x01,0xff,0xc9,0x56,0x02,0xff,0x81,0x2b,0x02,0xff,0x5a,0x16,0x01,0xff,0x59,0x17,0x01,0xff,0x5a,0x19,0x01,0xff,0x5c,0x1b,0x01,0xff,0x58,0x19,0x01,0xff,0x55,0x19,0x03,0xff,0x39,0x0e,0x03,0xff,0x74,0x2d,0x03,0xff,0xb1,0x4d,0x01,0xff,0x9d,0x44,0x03,0xff,0x82,0x3c,0x02,0xff,0x73,0x33,0x01,0xff,0x71,0x32,0x01,0xff,0x71,0x32,0x00,0xff,0x71,0x30,0x01,0xff,0x75,0x32,0x02,0xff,0x74,0x32,0x02,0xff,0x69,0x2b,0x01,0xff,0x65,0x2c,0x01,0xff,0x31,0x17,0x04,0xff,0x66,0x3c,0x06,0xff,0x97,0x5b,0x02,0xff,0x7f,0x48,0x02,0xff,0x6a,0x38,0x05,0xff,0x7d,0x41,0x03,0xff,0x68,0x31,0x01,0xff,0x6f,0x36,0x02,0xff,0x76,0x3a,0x02,0xff,0x61,0x33,0x01,0xff,0x3e,0x25,0x03,0xff,0x1a,0x12,0x02,0xff,0x07,0x08,0x03,0xff,0x1f,0x22,0x1f,0xff,0x2e,0x30,0x28,0xff,0x15,0x16,0x09,0xff,0x16,0x17,0x08,0xff,0x2d,0x2f,0x22,0xff,0x8c,0x90,0x8b,0xff,0x71,0x75,0x72,0xff,0x12,0x0e,0x0a,0xff,0x6d,0x6d,0x69,0xff,0x43,0x3c,0x35,0xff,0x49,0x33,0x16,0xff,0x67,0x5f,0x53,0xff,0x68,0x65,0x63,0xff,0xcc,0xd5,0xd1,0xff,0xba,0xc0,0xbf,0xff,0x55,0x59,0x55,0xff,0x2a,0x28,0x26,0xff,0x33,0x33,0x31,0xff,0x7a,0x85,0x83,0xff,0xc7,0xd4,0xd5,0xff,0x34,0x36,0x34,0xff,0x05,0x01,0x02,0xff,0x13,0x13,0x19,0xff,0x15,0x18,0x1e,0xff,0x13,0x14,0x1d,0xff,0x2c,0x2f,0x3b,0xff,0x59,0x57,0x5c,0xff,0x43,0x36,0x27,0xff,0x3d,0x2e,0x1a,0xff,0x3d,0x2f,0x1d,0xff,0x3d,0x2f,0x1e,0xff,0x3c,0x2e,0x1d,0xff,0x3b,0x2d,0x1d,0xff,0x3b,0x2d,0x1d,0xff,0x3a,0x2b,0x1b,0xff,0x39,0x2b,0x1a,0xff,0x39,0x2b,0x1a,0xff,0x39,0x2b,0x1a,0xff,0x38,0x2a,0x19,0xff,0x38,0x2a,0x19,0xff,0x38,0x2a,0x18,0xff,0x36,0x29,0x17,0xff,0x35,0x29,0x17,0xff,0x35,0x29,0x17,0xff,0x35,0x29,0x17,0xff,0x34,0x28,0x16,0xff,0x34,0x28,0x16,0xff,0x34,0x28,0x16,0xff,0x33,0x28,0x16,0xff,0x31,0x25,0x13,0xff,0x33,0x27,0x15,0xff,0x32,0x26,0x14,0xff,0x32,0x27,0x15,0xff,0x31,0x25,0x13,0xff,0x33,0x25,0x13,0xff,0x33,0x24,0x13,0xff,0x32,0x24,0x13,0xff,0x32,0x25,0x12,0xff,0x31,0x24,0x10,0xff,0x31,0x24,0x10,0xff,0x32,0x26,0x13,0xff,0x30,0x24,0x12,0xff,0x2f,0x23,0x11,0xff,0x30,0x24,0x12,0xff,0x2f,0x23,0x11,0xff,0x2d,0x21,0x0f,0xff,0x2d,0x21,0x0f,0xff,0x2e,0x22,0x0e,0xff,0x2c,0x20,0x0c,0xff,0x24,0x19,0x04,0xff,0x84,0x7d,0x72,0xd3,0xfe,0xfe,0xfe,0x13,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf9,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xec,0xf3,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x49,0xcf,0xc8,0xc3,0xfc,0x5e,0x44,0x33,0xff,0x53,0x38,0x23,0xff,0x4f,0x39,0x2a,0xff,0x70,0x47,0x26,0xff,0xc8,0x58,0x03,0xff,0xc8,0x51,0x00,0xff,0xd7,0x5e,0x01,0xff,0xb7,0x4a,0x01,0xff,0xad,0x44,0x01,0xff,0xce,0x55,0x03,0xff,0xcd,0x54,0x02,0xff,0xad,0x42,0x02,0xff,0x63,0x1a,0x01,0xff,0x59,0x18,0x00,0xff,0x59,0x18,0x02,0xff,0x59,0x19,0x02,0xff,0x59,0x19,0x02,0xff,0x5a,0x1c,0x02,0xff,0x45,0x14,0x02,0xff,0x40,0x12,0x03,0xff,0xa4,0x45,0x03,0xff,0x9c,0x44,0x01,0xff,0x77,0x34,0x02,0xff,0x68,0x30,0x02,0xff,0x63,0x2d,0x02,0xff,0x64,0x2d,0x02,0xff,0x6b,0x30,0x02,0xff,0x72,0x33,0x02,0xff,0x78,0x34,0x02,0xff,0x78,0x33,0x02,0xff,0x61,0x2a,0x02,0xff,0x30,0x19,0x04,0xff,0x6f,0x42,0x06,0xff,0x90,0x56,0x02,0xff,0x7c,0x47,0x00,0xff,0x6b,0x3c,0x03,0xff,0x8c,0x4e,0x02,0xff,0x8a,0x4b,0x01,0xff,0x62,0x34,0x04,0xff,0x2c,0x1b,0x02,0xff,0x0a,0x09,0x00,0xff,0x00,0x04,0x00,0xff,0x06,0x06,0x00,0xff,0x2d,0x27,0x13,0xff,0x6e,0x6f,0x65,0xff,0x8c,0x90,0x8c,0xff,0x6c,0x6f,0x68,0xff,0x46,0x47,0x3e,0xff,0x30,0x2f,0x26,0xff,0x25,0x23,0x1e,0xff,0x51,0x4d,0x46,0xff,0x3c,0x38,0x30,0xff,0x63,0x5d,0x53,0xff,0x36,0x28,0x13,0xff,0x43,0x32,0x19,0xff,0x6b,0x65,0x59,0xff,0x15,0x0a,0x07,0xff,0x64,0x65,0x62,0xff,0xd9,0xe2,0xe2,0xff,0xa7,0xb1,0xb1,0xff,0x52,0x57,0x56,0xff,0x2b,0x2a,0x2a,0xff,0x53,0x58,0x57,0xff,0xb6,0xc4,0xc3,0xff,0x77,0x7d,0x7d,0xff,0x09,0x09,0x11,0xff,0x1b,0x1e,0x27,0xff,0x18,0x1a,0x24,0xff,0x18,0x19,0x24,0xff,0x08,0x0b,0x0e,0xff,0x20,0x24,0x2c,0xff,0x52,0x50,0x4f,0xff,0x3d,0x2d,0x1a,0xff,0x3f,0x2f,0x1b,0xff,0x3c,0x2e,0x1b,0xff,0x3b,0x2e,0x1b,0xff,0x3c,0x2e,0x1c,0xff,0x3a,0x2d,0x1b,0xff,0x3a,0x2c,0x1b,0xff,0x39,0x2b,0x1a,0xff,0x38,0x2a,0x18,0xff,0x38,0x2a,0x18,0xff,0x38,0x2a,0x18,0xff,0x38,0x2a,0x18,0xff,0x38,0x2a,0x18,0xff,0x35,0x29,0x17,0xff,0x36,0x29,0x17,0xff,0x34,0x28,0x16,0xff,0x35,0x29,0x17,0xff,0x33,0x28,0x16,0xff,0x33,0x27,0x15,0xff,0x33,0x26,0x15,0xff,0x33,0x27,0x15,0xff,0x32,0x27,0x14,0xff,0x33,0x26,0x14,0xff,0x33,0x26,0x14,0xff,0x34,0x26,0x13,0xff,0x32,0x25,0x12,0xff,0x33,0x25,0x13,0xff,0x34,0x26,0x13,0xff,0x33,0x26,0x13,0xff,0x32,0x25,0x12,0xff,0x33,0x26,0x11,0xff,0x32,0x24,0x10,0xff,0x31,0x25,0x11,0xff,0x30,0x25,0x13,0xff,0x30,0x24,0x12,0xff,0x2f,0x23,0x11,0xff,0x2f,0x23,0x10,0xff,0x2e,0x22,0x0f,0xff,0x2e,0x22,0x0e,0xff,0x2e,0x21,0x0d,0xff,0x2e,0x22,0x0e,0xff,0x2c,0x1f,0x0b,0xff,0x2d,0x20,0x0c,0xff,0xae,0xa8,0xa1,0x9c,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf5,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x15,0xee,0xec,0xea,0xd7,0x77,0x62,0x54,0xff,0x4e,0x34,0x23,0xff,0x56,0x3c,0x2a,0xff,0x52,0x3b,0x2f,0xff,0x6d,0x45,0x27,0xff,0xc7,0x58,0x03,0xff,0xc4,0x50,0x00,0xff,0xc7,0x55,0x00,0xff,0xc3,0x51,0x00,0xff,0xbe,0x4e,0x00,0xff,0xd4,0x57,0x02,0xff,0xb7,0x47,0x02,0xff,0xb4,0x44,0x02,0xff,0x87,0x2d,0x02,0xff,0x57,0x16,0x02,0xff,0x56,0x17,0x00,0xff,0x56,0x18,0x01,0xff,0x5d,0x1d,0x02,0xff,0x57,0x1a,0x00,0xff,0x53,0x18,0x02,0xff,0x3b,0x0f,0x02,0xff,0x62,0x24,0x05,0xff,0xa0,0x43,0x03,0xff,0x6e,0x30,0x02,0xff,0x5e,0x2a,0x01,0xff,0x72,0x34,0x01,0xff,0x7d,0x38,0x02,0xff,0x7a,0x34,0x03,0xff,0x87,0x3a,0x01,0xff,0x99,0x45,0x02,0xff,0x78,0x36,0x03,0xff,0x37,0x19,0x02,0xff,0x0a,0x09,0x01,0xff,0x4a,0x2c,0x03,0xff,0x84,0x50,0x02,0xff,0x7b,0x49,0x02,0xff,0x6d,0x3f,0x02,0xff,0x95,0x58,0x02,0xff,0x50,0x30,0x01,0xff,0x0a,0x08,0x01,0xff,0x00,0x04,0x02,0xff,0x05,0x09,0x01,0xff,0x15,0x11,0x02,0xff,0x24,0x1a,0x00,0xff,0x33,0x26,0x05,0xff,0x4d,0x44,0x2a,0xff,0x77,0x75,0x64,0xff,0x96,0x97,0x8d,0xff,0x99,0x9a,0x92,0xff,0xa8,0xaa,0xa6,0xff,0x74,0x72,0x6b,0xff,0x44,0x3d,0x36,0xff,0x50,0x4a,0x3e,0xff,0x4d,0x44,0x33,0xff,0x45,0x40,0x36,0xff,0x1d,0x15,0x0d,0xff,0x6e,0x69,0x5c,0xff,0x21,0x1a,0x18,0xff,0x43,0x3f,0x3c,0xff,0x89,0x92,0x91,0xff,0xd4,0xe0,0xe1,0xff,0x9a,0xa5,0xa3,0xff,0x47,0x4d,0x4a,0xff,0x30,0x31,0x2f,0xff,0x7f,0x8a,0x88,0xff,0xac,0xb5,0xb6,0xff,0x19,0x1a,0x21,0xff,0x0b,0x0c,0x11,0xff,0x13,0x14,0x1b,0xff,0x14,0x17,0x1e,0xff,0x0d,0x10,0x15,0xff,0x05,0x06,0x0c,0xff,0x32,0x36,0x3c,0xff,0x49,0x44,0x3b,0xff,0x3a,0x2c,0x18,0xff,0x3e,0x2e,0x1b,0xff,0x39,0x2b,0x19,0xff,0x39,0x2b,0x18,0xff,0x39,0x2c,0x17,0xff,0x3a,0x2b,0x18,0xff,0x3a,0x2a,0x19,0xff,0x39,0x2a,0x19,0xff,0x38,0x29,0x17,0xff,0x38,0x2a,0x17,0xff,0x37,0x2a,0x16,0xff,0x37,0x29,0x15,0xff,0x35,0x28,0x15,0xff,0x35,0x27,0x15,0xff,0x35,0x28,0x15,0xff,0x34,0x27,0x14,0xff,0x32,0x27,0x14,0xff,0x31,0x25,0x12,0xff,0x32,0x25,0x13,0xff,0x34,0x27,0x14,0xff,0x34,0x26,0x13,0xff,0x33,0x25,0x12,0xff,0x34,0x27,0x13,0xff,0x33,0x26,0x12,0xff,0x33,0x26,0x12,0xff,0x33,0x25,0x12,0xff,0x33,0x27,0x12,0xff,0x33,0x26,0x12,0xff,0x33,0x25,0x12,0xff,0x33,0x25,0x11,0xff,0x34,0x25,0x11,0xff,0x31,0x23,0x10,0xff,0x30,0x23,0x12,0xff,0x31,0x24,0x12,0xff,0x31,0x23,0x11,0xff,0x2f,0x21,0x0d,0xff,0x30,0x22,0x0e,0xff,0x2f,0x22,0x0e,0xff,0x2f,0x22,0x0e,0xff,0x2f,0x22,0x0e,0xff,0x2e,0x21,0x0d,0xff,0x27,0x19,0x05,0xff,0x44,0x38,0x27,0xff,0xd9,0xd7,0xd4,0x58,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf5,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x96,0x9d,0x8f,0x85,0xff,0x50,0x37,0x25,0xff,0x55,0x3d,0x2e,0xff,0x55,0x3f,0x2e,0xff,0x50,0x3d,0x2f,0xff,0x66,0x42,0x28,0xff,0xbb,0x51,0x03,0xff,0xbc,0x4c,0x01,0xff,0xbe,0x50,0x01,0xff,0xcb,0x56,0x01,0xff,0xda,0x5b,0x01,0xff,0xd1,0x56,0x01,0xff,0xac,0x41,0x02,0xff,0xaf,0x42,0x01,0xff,0xb4,0x47,0x04,0xff,0x69,0x21,0x03,0xff,0x55,0x17,0x01,0xff,0x58,0x1c,0x01,0xff,0x5d,0x1f,0x02,0xff,0x56,0x1a,0x01,0xff,0x52,0x1a,0x02,0xff,0x4b,0x19,0x03,0xff,0x2b,0x0d,0x01,0xff,0x6c,0x2b,0x04,0xff,0x70,0x30,0x02,0xff,0x72,0x32,0x03,0xff,0x8a,0x3c,0x02,0xff,0x8e,0x3e,0x01,0xff,0x95,0x41,0x02,0xff,0xab,0x4a,0x02,0xff,0x9d,0x41,0x02,0xff,0x43,0x1e,0x02,0xff,0x09,0x0a,0x01,0xff,0x04,0x05,0x01,0xff,0x13,0x0e,0x02,0xff,0x62,0x3b,0x04,0xff,0x7b,0x4c,0x02,0xff,0x79,0x47,0x03,0xff,0x78,0x4a,0x03,0xff,0x0d,0x0b,0x01,0xff,0x05,0x05,0x01,0xff,0x12,0x0f,0x02,0xff,0x2c,0x21,0x03,0xff,0x2d,0x22,0x04,0xff,0x24,0x1c,0x02,0xff,0x24,0x19,0x05,0xff,0x21,0x19,0x0a,0xff,0x27,0x21,0x0f,0xff,0x2c,0x26,0x12,0xff,0x2f,0x2a,0x1a,0xff,0x48,0x44,0x3a,0xff,0x6b,0x68,0x60,0xff,0x5b,0x58,0x53,0xff,0x27,0x1a,0x11,0xff,0x69,0x57,0x3b,0xff,0x2d,0x27,0x23,0xff,0x2f,0x24,0x1a,0xff,0x85,0x85,0x7d,0xff,0x31,0x29,0x26,0xff,0x75,0x77,0x73,0xff,0x50,0x56,0x53,0xff,0xaf,0xb8,0xb6,0xff,0xd1,0xdc,0xdb,0xff,0x9e,0xa9,0xa6,0xff,0x43,0x47,0x47,0xff,0x41,0x45,0x44,0xff,0xa4,0xb1,0xb0,0xff,0x32,0x33,0x3a,0xff,0x06,0x06,0x09,0xff,0x10,0x12,0x14,0xff,0x10,0x12,0x15,0xff,0x0f,0x11,0x18,0xff,0x13,0x14,0x1a,0xff,0x11,0x14,0x1b,0xff,0x49,0x4e,0x51,0xff,0x3f,0x34,0x23,0xff,0x3a,0x2a,0x16,0xff,0x3c,0x2d,0x1a,0xff,0x3a,0x2c,0x18,0xff,0x3a,0x2b,0x17,0xff,0x3b,0x2b,0x17,0xff,0x3a,0x2a,0x18,0xff,0x3a,0x2b,0x17,0xff,0x3a,0x2a,0x17,0xff,0x35,0x28,0x14,0xff,0x36,0x28,0x15,0xff,0x35,0x28,0x14,0xff,0x35,0x28,0x14,0xff,0x35,0x27,0x13,0xff,0x35,0x28,0x14,0xff,0x34,0x27,0x13,0xff,0x33,0x27,0x12,0xff,0x33,0x27,0x12,0xff,0x33,0x27,0x12,0xff,0x33,0x25,0x11,0xff,0x34,0x26,0x13,0xff,0x33,0x26,0x13,0xff,0x32,0x25,0x11,0xff,0x33,0x25,0x10,0xff,0x35,0x26,0x11,0xff,0x34,0x26,0x13,0xff,0x36,0x26,0x13,0xff,0x33,0x27,0x13,0xff,0x33,0x26,0x11,0xff,0x33,0x26,0x11,0xff,0x33,0x26,0x12,0xff,0x32,0x25,0x12,0xff,0x32,0x25,0x13,0xff,0x31,0x25,0x11,0xff,0x34,0x24,0x11,0xff,0x30,0x24,0x0e,0xff,0x30,0x21,0x0e,0xff,0x2f,0x21,0x0e,0xff,0x2e,0x22,0x0d,0xff,0x2f,0x21,0x0d,0xff,0x2f,0x22,0x0d,0xff,0x2f,0x21,0x0d,0xff,0x25,0x16,0x03,0xff,0x6d,0x63,0x57,0xdf,0xf8,0xf7,0xf7,0x1b,0xff,0xff,0xff,0x00,0xff,0xf6,0xf9,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf5,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xea,0xf2,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x49,0xca,0xc2,0xbd,0xfe,0x5b,0x43,0x33,0xff,0x55,0x3c,0x2c,0xff,0x56,0x3e,0x2e,0xff,0x56,0x3f,0x2f,0xff,0x52,0x3d,0x2e,0xff,0x61,0x43,0x2c,0xff,0xad,0x4b,0x08,0xff,0xb7,0x46,0x00,0xff,0xc1,0x50,0x02,0xff,0xc5,0x50,0x00,0xff,0xda,0x5d,0x02,0xff,0xc6,0x52,0x02,0xff,0xaf,0x44,0x01,0xff,0xb8,0x4c,0x01,0xff,0xcc,0x55,0x02,0xff,0x9c,0x3d,0x04,0xff,0x53,0x19,0x01,0xff,0x58,0x1d,0x02,0xff,0x55,0x1b,0x01,0xff,0x50,0x1a,0x02,0xff,0x4e,0x18,0x00,0xff,0x4e,0x1a,0x02,0xff,0x3b,0x15,0x01,0xff,0x20,0x0b,0x02,0xff,0x53,0x21,0x04,0xff,0x76,0x32,0x02,0xff,0x8e,0x3d,0x01,0xff,0x9e,0x44,0x01,0xff,0xad,0x4b,0x01,0xff,0xa6,0x48,0x02,0xff,0x52,0x26,0x01,0xff,0x0a,0x0a,0x01,0xff,0x07,0x07,0x00,0xff,0x09,0x08,0x01,0xff,0x04,0x05,0x03,0xff,0x48,0x2d,0x05,0xff,0x66,0x3c,0x03,0xff,0x62,0x3d,0x03,0xff,0x4c,0x32,0x02,0xff,0x05,0x06,0x01,0xff,0x12,0x12,0x01,0xff,0x38,0x2b,0x01,0xff,0x41,0x31,0x01,0xff,0x3a,0x2d,0x09,0xff,0x35,0x28,0x10,0xff,0x40,0x35,0x24,0xff,0x57,0x49,0x2f,0xff,0x6c,0x5d,0x41,0xff,0x60,0x54,0x3b,0xff,0x3c,0x32,0x1a,0xff,0x3b,0x33,0x21,0xff,0x31,0x2c,0x20,0xff,0x18,0x14,0x0e,0xff,0x38,0x1b,0x00,0xff,0x71,0x5a,0x36,0xff,0x40,0x3f,0x3c,0xff,0x47,0x44,0x38,0xff,0x7b,0x7c,0x78,0xff,0x4b,0x47,0x41,0xff,0x62,0x69,0x65,0xff,0x83,0x8e,0x8a,0xff,0xbc,0xc6,0xc5,0xff,0xcf,0xda,0xdb,0xff,0xcf,0xda,0xd8,0xff,0xa5,0xb0,0xae,0xff,0x46,0x4c,0x49,0xff,0x7f,0x88,0x85,0xff,0x59,0x60,0x65,0xff,0x0a,0x0a,0x0f,0xff,0x0f,0x10,0x13,0xff,0x15,0x15,0x1a,0xff,0x14,0x14,0x19,0xff,0x0e,0x0f,0x15,0xff,0x0e,0x10,0x16,0xff,0x1c,0x21,0x26,0xff,0x47,0x46,0x40,0xff,0x3b,0x2a,0x14,0xff,0x3a,0x2b,0x17,0xff,0x3a,0x2b,0x16,0xff,0x39,0x29,0x15,0xff,0x39,0x2b,0x16,0xff,0x39,0x2a,0x16,0xff,0x38,0x28,0x15,0xff,0x38,0x28,0x14,0xff,0x37,0x29,0x15,0xff,0x37,0x28,0x15,0xff,0x37,0x28,0x15,0xff,0x34,0x26,0x13,0xff,0x35,0x27,0x13,0xff,0x34,0x26,0x12,0xff,0x34,0x27,0x11,0xff,0x32,0x26,0x0f,0xff,0x31,0x25,0x0f,0xff,0x32,0x25,0x10,0xff,0x32,0x25,0x11,0xff,0x33,0x26,0x12,0xff,0x33,0x25,0x13,0xff,0x34,0x26,0x13,0xff,0x35,0x26,0x11,0xff,0x36,0x27,0x13,0xff,0x31,0x23,0x0f,0xff,0x2e,0x1e,0x08,0xff,0x31,0x21,0x0c,0xff,0x33,0x25,0x12,0xff,0x2d,0x22,0x0d,0xff,0x30,0x25,0x11,0xff,0x32,0x26,0x12,0xff,0x30,0x24,0x12,0xff,0x31,0x23,0x10,0xff,0x2e,0x1f,0x0b,0xff,0x32,0x24,0x0c,0xff,0x30,0x25,0x0d,0xff,0x31,0x22,0x0f,0xff,0x2f,0x20,0x0c,0xff,0x2e,0x21,0x0d,0xff,0x30,0x22,0x0e,0xff,0x2d,0x20,0x0c,0xff,0x2b,0x1e,0x0a,0xff,0x29,0x1b,0x08,0xff,0xa3,0x9c,0x94,0x9d,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xff,0xf7,0xfa,0x00,0xff,0xff,0xff,0x0c,0xf1,0xef,0xee,0xce,0x7a,0x65,0x5a,0xff,0x54,0x39,0x2a,0xff,0x59,0x40,0x30,0xff,0x58,0x41,0x31,0xff,0x57,0x3f,0x2f,0xff,0x55,0x3e,0x2f,0xff,0x58,0x40,0x2d,0xff,0xa6,0x4d,0x0c,0xff,0xc2,0x4f,0x00,0xff,0xcb,0x57,0x01,0xff,0xbf,0x4f,0x00,0xff,0xcd,0x58,0x01,0xff,0xb6,0x4c,0x01,0xff,0xb1,0x48,0x01,0xff,0xc5,0x54,0x01,0xff,0xb1,0x4b,0x01,0xff,0x8e,0x3c,0x02,0xff,0x68,0x27,0x02,0xff,0x53,0x1b,0x01,0xff,0x4f,0x1b,0x01,0xff,0x4c,0x1b,0x01,0xff,0x4a,0x1a,0x02,0xff,0x4b,0x19,0x02,0xff,0x4a,0x1b,0x01,0xff,0x29,0x0f,0x03,0xff,0x0d,0x03,0x00,0xff,0x5e,0x22,0x01,0xff,0x9f,0x42,0x02,0xff,0xa9,0x49,0x01,0xff,0xaa,0x49,0x03,0xff,0x66,0x2f,0x02,0xff,0x09,0x0b,0x02,0xff,0x06,0x06,0x02,0xff,0x0a,0x07,0x01,0xff,0x06,0x06,0x01,0xff,0x0b,0x08,0x00,0xff,0x3c,0x27,0x04,0xff,0x66,0x3e,0x03,0xff,0x68,0x3f,0x02,0xff,0x49,0x32,0x03,0xff,0x1b,0x17,0x02,0xff,0x4c,0x35,0x02,0xff,0x5b,0x3e,0x02,0xff,0x48,0x31,0x03,0xff,0x36,0x2c,0x07,0xff,0x2c,0x26,0x05,0xff,0x29,0x20,0x05,0xff,0x34,0x27,0x02,0xff,0x36,0x2c,0x0a,0xff,0x36,0x2e,0x1b,0xff,0x26,0x20,0x0c,0xff,0x1a,0x14,0x04,0xff,0x0b,0x08,0x01,0xff,0x15,0x10,0x01,0xff,0x4b,0x32,0x05,0xff,0x1a,0x12,0x03,0xff,0x0f,0x0c,0x07,0xff,0x61,0x65,0x59,0xff,0x46,0x46,0x3e,0xff,0x46,0x47,0x41,0xff,0x65,0x6c,0x69,0xff,0xaf,0xbc,0xbc,0xff,0xd2,0xdf,0xe0,0xff,0xdc,0xe6,0xea,0xff,0xc1,0xcd,0xcc,0xff,0xd2,0xdc,0xdc,0xff,0x95,0xa0,0x9f,0xff,0x6b,0x75,0x70,0xff,0x79,0x81,0x83,0xff,0x0d,0x0d,0x12,0xff,0x13,0x13,0x17,0xff,0x16,0x16,0x1c,0xff,0x14,0x15,0x1b,0xff,0x0f,0x0f,0x15,0xff,0x11,0x13,0x18,0xff,0x0b,0x0d,0x13,0xff,0x31,0x34,0x3b,0xff,0x47,0x3d,0x32,0xff,0x39,0x28,0x11,0xff,0x3c,0x2c,0x17,0xff,0x3b,0x2a,0x14,0xff,0x38,0x28,0x12,0xff,0x39,0x29,0x14,0xff,0x37,0x29,0x13,0xff,0x37,0x28,0x13,0xff,0x37,0x28,0x12,0xff,0x36,0x27,0x12,0xff,0x36,0x27,0x12,0xff,0x34,0x25,0x10,0xff,0x36,0x26,0x12,0xff,0x35,0x26,0x11,0xff,0x33,0x26,0x10,0xff,0x32,0x25,0x0f,0xff,0x33,0x26,0x10,0xff,0x33,0x25,0x10,0xff,0x32,0x24,0x11,0xff,0x32,0x25,0x11,0xff,0x33,0x25,0x13,0xff,0x35,0x25,0x14,0xff,0x35,0x25,0x13,0xff,0x31,0x21,0x11,0xff,0x3c,0x32,0x22,0xff,0x49,0x46,0x34,0xff,0x41,0x36,0x22,0xff,0x37,0x26,0x11,0xff,0x40,0x35,0x25,0xff,0x36,0x21,0x12,0xff,0x30,0x21,0x0f,0xff,0x32,0x25,0x13,0xff,0x31,0x23,0x10,0xff,0x3f,0x39,0x27,0xff,0x30,0x24,0x0f,0xff,0x2f,0x22,0x0b,0xff,0x2f,0x24,0x11,0xff,0x30,0x23,0x0f,0xff,0x2f,0x22,0x0e,0xff,0x2e,0x21,0x0d,0xff,0x2d,0x20,0x0b,0xff,0x2d,0x20,0x0b,0xff,0x26,0x19,0x04,0xff,0x43,0x38,0x26,0xff,0xdd,0xdb,0xd8,0x49,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xf9,0xfc,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xef,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x77,0xaa,0x9d,0x96,0xff,0x56,0x3b,0x2d,0xff,0x59,0x3f,0x31,0xff,0x59,0x40,0x31,0xff,0x59,0x41,0x31,0xff,0x58,0x40,0x30,0xff,0x56,0x3e,0x2e,0xff,0x53,0x3f,0x2d,0xff,0x97,0x49,0x0e,0xff,0xc4,0x4e,0x00,0xff,0xcf,0x59,0x02,0xff,0xc0,0x51,0x02,0xff,0xc5,0x55,0x02,0xff,0xaf,0x4b,0x02,0xff,0xb3,0x4d,0x01,0xff,0xb5,0x4e,0x02,0xff,0x78,0x36,0x01,0xff,0x6e,0x2f,0x01,0xff,0x95,0x44,0x04,0xff,0x5a,0x1f,0x02,0xff,0x4c,0x1a,0x01,0xff,0x4b,0x1b,0x02,0xff,0x46,0x18,0x01,0xff,0x46,0x19,0x02,0xff,0x47,0x1c,0x01,0xff,0x4a,0x1a,0x03,0xff,0x10,0x06,0x01,0xff,0x28,0x0d,0x01,0xff,0x9c,0x40,0x01,0xff,0xab,0x47,0x01,0xff,0x72,0x34,0x02,0xff,0x15,0x0d,0x02,0xff,0x05,0x03,0x03,0xff,0x08,0x06,0x01,0xff,0x08,0x06,0x00,0xff,0x16,0x12,0x02,0xff,0x37,0x22,0x01,0xff,0x60,0x35,0x04,0xff,0x7d,0x4e,0x04,0xff,0x6a,0x41,0x04,0xff,0x3f,0x2a,0x03,0xff,0x3e,0x2f,0x02,0xff,0x4b,0x32,0x04,0xff,0x3c,0x2b,0x03,0xff,0x36,0x29,0x02,0xff,0x20,0x1c,0x01,0xff,0x19,0x19,0x02,0xff,0x1f,0x1c,0x00,0xff,0x24,0x20,0x01,0xff,0x12,0x10,0x00,0xff,0x08,0x09,0x00,0xff,0x0e,0x0d,0x01,0xff,0x0e,0x0b,0x02,0xff,0x11,0x09,0x02,0xff,0x35,0x29,0x02,0xff,0x31,0x24,0x04,0xff,0x03,0x00,0x00,0xff,0x35,0x2f,0x1c,0xff,0x5f,0x64,0x55,0xff,0x2a,0x2a,0x1f,0xff,0x3d,0x3e,0x35,0xff,0x6f,0x79,0x77,0xff,0xba,0xc8,0xcb,0xff,0xeb,0xf7,0xfc,0xff,0xec,0xf8,0xfe,0xff,0xc3,0xcf,0xd2,0xff,0xc2,0xcb,0xcb,0xff,0xc8,0xd3,0xd4,0xff,0x82,0x8d,0x8c,0xff,0x89,0x90,0x92,0xff,0x1c,0x1c,0x20,0xff,0x12,0x12,0x18,0xff,0x11,0x12,0x16,0xff,0x10,0x0f,0x12,0xff,0x11,0x11,0x15,0xff,0x0d,0x0d,0x11,0xff,0x12,0x12,0x18,0xff,0x10,0x11,0x18,0xff,0x4d,0x4b,0x4e,0xff,0x43,0x33,0x23,0xff,0x3a,0x29,0x11,0xff,0x38,0x2a,0x15,0xff,0x3a,0x29,0x14,0xff,0x38,0x29,0x13,0xff,0x39,0x29,0x13,0xff,0x38,0x28,0x12,0xff,0x35,0x26,0x10,0xff,0x35,0x26,0x11,0xff,0x35,0x26,0x11,0xff,0x34,0x25,0x10,0xff,0x34,0x25,0x0f,0xff,0x35,0x26,0x11,0xff,0x32,0x25,0x0e,0xff,0x31,0x25,0x0e,0xff,0x32,0x26,0x0f,0xff,0x32,0x26,0x10,0xff,0x34,0x25,0x12,0xff,0x35,0x26,0x13,0xff,0x34,0x25,0x14,0xff,0x35,0x25,0x13,0xff,0x33,0x25,0x12,0xff,0x56,0x2d,0x04,0xff,0x87,0x7c,0x6e,0xff,0xcb,0xe0,0xe3,0xff,0xc4,0xce,0xca,0xff,0xb0,0x75,0x1e,0xff,0xd6,0xa7,0x72,0xff,0xca,0xa7,0xa4,0xff,0x9c,0x63,0x34,0xff,0xb7,0x6f,0x35,0xff,0x78,0x6c,0x68,0xff,0xab,0xc0,0xc6,0xff,0x90,0x96,0x8d,0xff,0x32,0x21,0x09,0xff,0x2d,0x19,0x02,0xff,0x31,0x21,0x09,0xff,0x31,0x23,0x10,0xff,0x30,0x21,0x0e,0xff,0x2e,0x21,0x0b,0xff,0x2c,0x1f,0x0a,0xff,0x2c,0x1f,0x0b,0xff,0x24,0x16,0x01,0xff,0x78,0x70,0x64,0xc9,0xfe,0xfd,0xfd,0x09,0xff,0xff,0xff,0x00,0xfe,0xf2,0xf6,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfc,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x22,0xdc,0xd7,0xd4,0xeb,0x67,0x4e,0x41,0xff,0x56,0x3c,0x2d,0xff,0x59,0x41,0x31,0xff,0x59,0x40,0x30,0xff,0x58,0x3f,0x2e,0xff,0x59,0x40,0x2e,0xff,0x57,0x3f,0x2b,0xff,0x50,0x3c,0x2b,0xff,0x84,0x45,0x16,0xff,0xc2,0x4d,0x01,0xff,0xcd,0x58,0x02,0xff,0xd1,0x5b,0x01,0xff,0xc0,0x55,0x02,0xff,0xa4,0x47,0x02,0xff,0xa5,0x47,0x03,0xff,0x7b,0x36,0x01,0xff,0x54,0x24,0x00,0xff,0x79,0x36,0x01,0xff,0xb1,0x54,0x02,0xff,0x72,0x32,0x02,0xff,0x45,0x14,0x01,0xff,0x4b,0x1b,0x02,0xff,0x48,0x1a,0x01,0xff,0x45,0x19,0x01,0xff,0x47,0x1a,0x03,0xff,0x47,0x19,0x02,0xff,0x31,0x12,0x02,0xff,0x0e,0x03,0x01,0xff,0x83,0x33,0x02,0xff,0x8c,0x38,0x03,0xff,0x20,0x0e,0x02,0xff,0x02,0x00,0x01,0xff,0x04,0x03,0x01,0xff,0x04,0x03,0x02,0xff,0x26,0x18,0x03,0xff,0x5a,0x31,0x03,0xff,0x71,0x35,0x01,0xff,0x76,0x39,0x01,0xff,0x85,0x50,0x04,0xff,0x78,0x4a,0x02,0xff,0x5e,0x3e,0x02,0xff,0x34,0x27,0x03,0xff,0x20,0x1e,0x03,0xff,0x25,0x20,0x04,0xff,0x13,0x15,0x02,0xff,0x0e,0x12,0x02,0xff,0x11,0x12,0x00,0xff,0x2a,0x26,0x01,0xff,0x29,0x25,0x02,0xff,0x11,0x0f,0x03,0xff,0x0e,0x0e,0x02,0xff,0x12,0x0f,0x02,0xff,0x0f,0x0d,0x01,0xff,0x2d,0x21,0x01,0xff,0x3a,0x2b,0x04,0xff,0x0a,0x08,0x01,0xff,0x1d,0x16,0x00,0xff,0x5c,0x59,0x42,0xff,0x43,0x45,0x39,0xff,0x24,0x23,0x15,0xff,0x38,0x3c,0x38,0xff,0x82,0x95,0xa1,0xff,0xd3,0xe8,0xf9,0xff,0xe2,0xf0,0xff,0xff,0xe8,0xf7,0xff,0xff,0xdd,0xe7,0xf0,0xff,0xb6,0xc1,0xc2,0xff,0xc8,0xd2,0xd2,0xff,0xac,0xb6,0xb7,0xff,0x92,0x9c,0x9d,0xff,0x31,0x31,0x37,0xff,0x14,0x13,0x1c,0xff,0x10,0x10,0x14,0xff,0x0f,0x0e,0x11,0xff,0x11,0x10,0x14,0xff,0x14,0x14,0x18,0xff,0x12,0x11,0x15,0xff,0x0a,0x09,0x0f,0xff,0x24,0x26,0x2c,0xff,0x52,0x4d,0x47,0xff,0x38,0x25,0x0f,0xff,0x3a,0x28,0x13,0xff,0x3a,0x29,0x14,0xff,0x39,0x27,0x12,0xff,0x38,0x26,0x11,0xff,0x37,0x27,0x11,0xff,0x35,0x26,0x11,0xff,0x33,0x24,0x0f,0xff,0x34,0x26,0x10,0xff,0x34,0x25,0x10,0xff,0x35,0x26,0x10,0xff,0x35,0x26,0x10,0xff,0x32,0x25,0x0f,0xff,0x30,0x24,0x0e,0xff,0x31,0x25,0x0f,0xff,0x32,0x25,0x10,0xff,0x34,0x24,0x11,0xff,0x34,0x24,0x12,0xff,0x33,0x24,0x12,0xff,0x33,0x23,0x15,0xff,0x38,0x24,0x0e,0xff,0xb1,0x61,0x02,0xff,0xc4,0xae,0x90,0xff,0xf8,0xff,0xff,0xff,0xfe,0xff,0xff,0xff,0xf8,0xd5,0x9a,0xff,0xff,0xd9,0x96,0xff,0xf4,0xf5,0xfa,0xff,0xbf,0xb5,0xaa,0xff,0xc9,0x98,0x7a,0xff,0xb4,0xbd,0xc6,0xff,0xde,0xed,0xee,0xff,0xff,0xff,0xff,0xff,0x6c,0x78,0x7c,0xff,0x2f,0x39,0x3f,0xff,0x2d,0x28,0x1f,0xff,0x24,0x19,0x05,0xff,0x2c,0x1f,0x0d,0xff,0x31,0x20,0x0d,0xff,0x2d,0x20,0x0c,0xff,0x2c,0x1f,0x0b,0xff,0x29,0x1b,0x08,0xff,0x2e,0x21,0x0e,0xff,0xbc,0xb7,0xb1,0x6f,0xff,0xff,0xff,0x00,0xff,0xfc,0xfe,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf3,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfb,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf0,0xf6,0x00,0xff,0xff,0xff,0x00,0xfe,0xfe,0xfe,0x96,0x95,0x83,0x79,0xff,0x54,0x38,0x29,0xff,0x59,0x3e,0x2f,0xff,0x59,0x3d,0x2f,0xff,0x58,0x3d,0x2d,0xff,0x58,0x3d,0x2c,0xff,0x58,0x3d,0x2a,0xff,0x55,0x3b,0x27,0xff,0x50,0x3b,0x29,0xff,0x6d,0x41,0x1e,0xff,0xb6,0x49,0x01,0xff,0xca,0x56,0x01,0xff,0xe0,0x69,0x02,0xff,0xbb,0x58,0x02,0xff,0x90,0x41,0x01,0xff,0x7b,0x35,0x02,0xff,0x51,0x25,0x01,0xff,0x5c,0x28,0x01,0xff,0x94,0x46,0x02,0xff,0xa7,0x4e,0x02,0xff,0x8f,0x41,0x02,0xff,0x5b,0x23,0x03,0xff,0x47,0x18,0x00,0xff,0x49,0x1a,0x01,0xff,0x49,0x1b,0x01,0xff,0x49,0x1a,0x03,0xff,0x46,0x19,0x01,0xff,0x51,0x26,0x04,0xff,0x1a,0x0b,0x02,0xff,0x48,0x19,0x02,0xff,0x39,0x16,0x02,0xff,0x00,0x00,0x01,0xff,0x03,0x02,0x01,0xff,0x06,0x02,0x02,0xff,0x31,0x1b,0x01,0xff,0x68,0x35,0x02,0xff,0x7e,0x3b,0x01,0xff,0x77,0x37,0x01,0xff,0x69,0x32,0x00,0xff,0x6d,0x38,0x02,0xff,0x57,0x36,0x02,0xff,0x3b,0x28,0x02,0xff,0x1b,0x14,0x02,0xff,0x26,0x1f,0x03,0xff,0x1d,0x1a,0x03,0xff,0x0d,0x0f,0x01,0xff,0x09,0x0e,0x01,0xff,0x1f,0x1e,0x00,0xff,0x3c,0x37,0x04,0xff,0x2a,0x27,0x03,0xff,0x13,0x12,0x03,0xff,0x13,0x12,0x03,0xff,0x1b,0x18,0x02,0xff,0x26,0x1e,0x01,0xff,0x3f,0x30,0x03,0xff,0x11,0x0d,0x01,0xff,0x1c,0x16,0x01,0xff,0x35,0x2d,0x12,0xff,0x2d,0x2d,0x21,0xff,0x13,0x17,0x0a,0xff,0x40,0x49,0x48,0xff,0x77,0x88,0x9d,0xff,0x98,0xb1,0xcb,0xff,0xb5,0xca,0xe2,0xff,0xd5,0xe5,0xf9,0xff,0xe4,0xf2,0xff,0xff,0xe7,0xf3,0xfe,0xff,0xc1,0xcd,0xd1,0xff,0xb5,0xc1,0xc0,0xff,0xc1,0xcd,0xcd,0xff,0xa9,0xb6,0xb5,0xff,0x40,0x43,0x46,0xff,0x11,0x0e,0x17,0xff,0x16,0x16,0x1c,0xff,0x13,0x11,0x15,0xff,0x15,0x14,0x18,0xff,0x12,0x13,0x16,0xff,0x0e,0x0d,0x11,0xff,0x0e,0x0d,0x10,0xff,0x08,0x09,0x0e,0xff,0x37,0x3a,0x3c,0xff,0x41,0x34,0x26,0xff,0x39,0x26,0x10,0xff,0x39,0x28,0x12,0xff,0x39,0x28,0x12,0xff,0x38,0x27,0x12,0xff,0x38,0x28,0x12,0xff,0x35,0x27,0x12,0xff,0x33,0x25,0x0f,0xff,0x33,0x25,0x0f,0xff,0x33,0x25,0x0f,0xff,0x35,0x26,0x11,0xff,0x33,0x25,0x0f,0xff,0x34,0x25,0x10,0xff,0x34,0x25,0x10,0xff,0x32,0x24,0x0f,0xff,0x33,0x24,0x10,0xff,0x33,0x24,0x10,0xff,0x33,0x24,0x10,0xff,0x36,0x26,0x11,0xff,0x33,0x25,0x13,0xff,0x2f,0x24,0x0e,0xff,0x62,0x35,0x07,0xff,0x8c,0x67,0x50,0xff,0xb7,0xc5,0xa9,0xff,0xe5,0xe3,0xbd,0xff,0xa0,0xda,0xfb,0xff,0x8b,0xd7,0xff,0xff,0xa2,0xd6,0xfb,0xff,0xb9,0xe1,0xff,0xff,0xb5,0xd6,0xf9,0xff,0xae,0xdf,0xfd,0xff,0xc5,0xeb,0xff,0xff,0xd0,0xef,0xff,0xff,0xa3,0xdd,0xff,0xff,0x92,0xd5,0xfc,0xff,0x82,0xb2,0xd9,0xff,0x7b,0x68,0x5a,0xff,0x39,0x2a,0x10,0xff,0x2d,0x1e,0x0c,0xff,0x2e,0x20,0x0c,0xff,0x2d,0x1f,0x0c,0xff,0x2c,0x1f,0x0c,0xff,0x23,0x16,0x01,0xff,0x5c,0x53,0x43,0xe1,0xf3,0xf3,0xf2,0x19,0xff,0xff,0xff,0x00,0xfe,0xf3,0xf8,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfb,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x30,0xd2,0xca,0xc6,0xf6,0x60,0x43,0x34,0xff,0x57,0x3a,0x2a,0xff,0x59,0x3d,0x2e,0xff,0x5c,0x3e,0x2f,0xff,0x59,0x3c,0x2b,0xff,0x5a,0x3d,0x2b,0xff,0x59,0x3c,0x29,0xff,0x56,0x3a,0x25,0xff,0x54,0x3a,0x26,0xff,0x5b,0x3d,0x23,0xff,0xa8,0x4a,0x08,0xff,0xcc,0x55,0x00,0xff,0xd5,0x63,0x02,0xff,0xab,0x4e,0x02,0xff,0x82,0x39,0x03,0xff,0x64,0x2a,0x01,0xff,0x67,0x2d,0x02,0xff,0x91,0x40,0x01,0xff,0xb5,0x52,0x02,0xff,0xa4,0x49,0x01,0xff,0xbb,0x56,0x02,0xff,0x8e,0x40,0x03,0xff,0x41,0x15,0x00,0xff,0x4a,0x1a,0x01,0xff,0x49,0x1a,0x00,0xff,0x49,0x17,0x02,0xff,0x53,0x25,0x04,0xff,0x4b,0x30,0x06,0xff,0x2b,0x13,0x04,0xff,0x0f,0x0b,0x08,0xff,0x03,0x00,0x02,0xff,0x05,0x02,0x01,0xff,0x0c,0x03,0x01,0xff,0x3e,0x1d,0x02,0xff,0x77,0x37,0x01,0xff,0x7d,0x36,0x02,0xff,0x6d,0x31,0x01,0xff,0x62,0x2e,0x01,0xff,0x5c,0x2c,0x01,0xff,0x52,0x29,0x02,0xff,0x2d,0x1d,0x02,0xff,0x10,0x0e,0x01,0xff,0x11,0x0a,0x02,0xff,0x1c,0x1b,0x03,0xff,0x10,0x11,0x02,0xff,0x14,0x15,0x01,0xff,0x33,0x2c,0x03,0xff,0x4d,0x42,0x03,0xff,0x3d,0x36,0x03,0xff,0x1f,0x1d,0x05,0xff,0x1d,0x19,0x04,0xff,0x35,0x2a,0x02,0xff,0x2c,0x23,0x01,0xff,0x2f,0x26,0x04,0xff,0x1f,0x18,0x03,0xff,0x17,0x13,0x04,0xff,0x23,0x1c,0x02,0xff,0x13,0x14,0x03,0xff,0x1d,0x22,0x1a,0xff,0x60,0x6a,0x75,0xff,0x8a,0x9e,0xb4,0xff,0x86,0x9a,0xb2,0xff,0x80,0x95,0xae,0xff,0x94,0xaa,0xc7,0xff,0xbd,0xd0,0xec,0xff,0xdc,0xec,0xfd,0xff,0xe7,0xf4,0xff,0xff,0xd6,0xe3,0xeb,0xff,0xb4,0xc0,0xc0,0xff,0xbc,0xc8,0xc8,0xff,0xc3,0xd1,0xcf,0xff,0x52,0x57,0x56,0xff,0x0a,0x07,0x0f,0xff,0x1c,0x1a,0x23,0xff,0x16,0x14,0x19,0xff,0x12,0x11,0x15,0xff,0x13,0x12,0x15,0xff,0x10,0x0f,0x10,0xff,0x0a,0x09,0x09,0xff,0x0a,0x09,0x0a,0xff,0x13,0x13,0x1a,0xff,0x44,0x40,0x3c,0xff,0x35,0x28,0x12,0xff,0x39,0x27,0x13,0xff,0x38,0x27,0x12,0xff,0x37,0x25,0x10,0xff,0x35,0x25,0x10,0xff,0x35,0x26,0x11,0xff,0x35,0x26,0x10,0xff,0x34,0x24,0x0f,0xff,0x33,0x24,0x0e,0xff,0x34,0x25,0x0f,0xff,0x35,0x26,0x11,0xff,0x34,0x24,0x10,0xff,0x34,0x25,0x12,0xff,0x33,0x23,0x10,0xff,0x33,0x24,0x10,0xff,0x34,0x25,0x10,0xff,0x35,0x25,0x10,0xff,0x33,0x25,0x10,0xff,0x34,0x24,0x0f,0xff,0x32,0x24,0x0e,0xff,0x2f,0x20,0x0a,0xff,0x49,0x29,0x04,0xff,0x87,0x80,0x01,0xff,0xf1,0xe8,0xa3,0xff,0xa6,0xd1,0xf9,0xff,0x51,0xa3,0xe3,0xff,0x91,0x8a,0xa6,0xff,0xad,0x9f,0xb2,0xff,0x96,0x86,0xa0,0xff,0x93,0x90,0xaa,0xff,0xa9,0x98,0xad,0xff,0x88,0x92,0xaf,0xff,0xa2,0xa4,0xbb,0xff,0xc1,0xbd,0xd0,0xff,0xbf,0xbe,0xd6,0xff,0xd1,0xc6,0xd5,0xff,0x52,0x4d,0x44,0xff,0x28,0x19,0x06,0xff,0x2f,0x20,0x0e,0xff,0x2c,0x1f,0x0c,0xff,0x2c,0x1e,0x0b,0xff,0x2a,0x1b,0x08,0xff,0x28,0x1a,0x06,0xff,0xac,0xa6,0x9f,0x83,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xfe,0xea,0xf2,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xfb,0xfa,0xf9,0xa2,0x8a,0x73,0x67,0xff,0x55,0x33,0x22,0xff,0x59,0x3a,0x2b,0xff,0x59,0x3a,0x2a,0xff,0x59,0x3b,0x29,0xff,0x58,0x3a,0x27,0xff,0x59,0x3b,0x27,0xff,0x59,0x3b,0x27,0xff,0x58,0x3a,0x26,0xff,0x57,0x3a,0x25,0xff,0x52,0x38,0x23,0xff,0x86,0x44,0x10,0xff,0xcd,0x5a,0x01,0xff,0xcd,0x62,0x02,0xff,0x8f,0x3e,0x01,0xff,0x76,0x33,0x01,0xff,0x69,0x2d,0x01,0xff,0x8a,0x3c,0x02,0xff,0xba,0x54,0x02,0xff,0xc8,0x57,0x02,0xff,0xc3,0x56,0x01,0xff,0xc3,0x58,0x03,0xff,0x82,0x3a,0x02,0xff,0x52,0x20,0x02,0xff,0x4a,0x1c,0x02,0xff,0x4a,0x19,0x02,0xff,0x4d,0x1d,0x01,0xff,0x5a,0x39,0x05,0xff,0x2b,0x11,0x03,0xff,0x1e,0x0e,0x04,0xff,0x1c,0x13,0x08,0xff,0x04,0x02,0x01,0xff,0x04,0x00,0x00,0xff,0x15,0x05,0x01,0xff,0x65,0x24,0x05,0xff,0x7f,0x32,0x02,0xff,0x6b,0x2b,0x01,0xff,0x62,0x2a,0x00,0xff,0x5d,0x2b,0x01,0xff,0x5d,0x2b,0x03,0xff,0x5b,0x2a,0x02,0xff,0x5e,0x2c,0x02,0xff,0x5e,0x2d,0x04,0xff,0x73,0x38,0x05,0xff,0x46,0x2c,0x05,0xff,0x1b,0x17,0x03,0xff,0x3a,0x2e,0x04,0xff,0x4e,0x3d,0x04,0xff,0x40,0x35,0x04,0xff,0x22,0x1e,0x03,0xff,0x27,0x23,0x02,0xff,0x41,0x32,0x02,0xff,0x4a,0x3a,0x01,0xff,0x28,0x22,0x01,0xff,0x1d,0x17,0x01,0xff,0x11,0x12,0x02,0xff,0x17,0x15,0x02,0xff,0x11,0x11,0x02,0xff,0x2b,0x31,0x2b,0xff,0x62,0x70,0x79,0xff,0x84,0x97,0xac,0xff,0x7f,0x92,0xa7,0xff,0x80,0x90,0xa8,0xff,0x7c,0x90,0xa8,0xff,0x84,0x99,0xb8,0xff,0xa1,0xb7,0xd6,0xff,0xc8,0xd9,0xf1,0xff,0xe2,0xf0,0xff,0xff,0xe3,0xf0,0xfc,0xff,0xbf,0xcd,0xd1,0xff,0xb7,0xc2,0xc2,0xff,0xc0,0xcf,0xcc,0xff,0x65,0x6b,0x6c,0xff,0x08,0x05,0x0c,0xff,0x16,0x14,0x1b,0xff,0x15,0x14,0x18,0xff,0x10,0x0e,0x12,0xff,0x10,0x0e,0x12,0xff,0x19,0x1b,0x20,0xff,0x10,0x11,0x16,0xff,0x09,0x08,0x0a,0xff,0x08,0x07,0x0a,0xff,0x2c,0x2e,0x31,0xff,0x40,0x36,0x28,0xff,0x35,0x24,0x0e,0xff,0x36,0x27,0x11,0xff,0x38,0x28,0x12,0xff,0x36,0x25,0x10,0xff,0x36,0x25,0x10,0xff,0x37,0x25,0x11,0xff,0x35,0x23,0x0e,0xff,0x33,0x22,0x0d,0xff,0x36,0x25,0x0f,0xff,0x34,0x23,0x10,0xff,0x32,0x23,0x0f,0xff,0x33,0x23,0x10,0xff,0x35,0x25,0x12,0xff,0x32,0x23,0x0f,0xff,0x33,0x25,0x0e,0xff,0x33,0x24,0x0e,0xff,0x33,0x25,0x0f,0xff,0x31,0x23,0x0d,0xff,0x32,0x24,0x0e,0xff,0x2e,0x1d,0x06,0xff,0xb6,0x7e,0x25,0xff,0xdb,0xb0,0x28,0xff,0xf0,0xe2,0x8f,0xff,0xe5,0xc9,0x97,0xff,0x7d,0x8f,0xa8,0xff,0x89,0x9b,0xb6,0xff,0x67,0x86,0xa8,0xff,0x66,0x8b,0xb3,0xff,0x55,0x78,0xa4,0xff,0x51,0x87,0xb6,0xff,0x35,0x78,0xab,0xff,0x3d,0x7e,0xb1,0xff,0x42,0x87,0xbe,0xff,0x3d,0x7a,0xad,0xff,0x53,0xbc,0xf7,0xff,0x3c,0x56,0x6a,0xff,0x2e,0x17,0x02,0xff,0x2e,0x20,0x0e,0xff,0x2c,0x1f,0x0b,0xff,0x2d,0x1f,0x0b,0xff,0x2e,0x1e,0x0b,0xff,0x25,0x15,0x01,0xff,0x52,0x44,0x34,0xe9,0xed,0xec,0xea,0x20,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf9,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xe8,0xf1,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x32,0xcc,0xc1,0xbb,0xf6,0x5c,0x3a,0x28,0xff,0x59,0x37,0x25,0xff,0x5b,0x3a,0x28,0xff,0x5a,0x3a,0x28,0xff,0x59,0x3a,0x26,0xff,0x59,0x3a,0x26,0xff,0x59,0x3a,0x25,0xff,0x59,0x3a,0x25,0xff,0x58,0x3a,0x24,0xff,0x58,0x3a,0x22,0xff,0x51,0x35,0x1f,0xff,0x67,0x3c,0x19,0xff,0xc8,0x60,0x02,0xff,0xbd,0x58,0x01,0xff,0x7f,0x36,0x01,0xff,0x67,0x2a,0x02,0xff,0x6d,0x2d,0x02,0xff,0xa3,0x48,0x02,0xff,0xc8,0x5b,0x01,0xff,0xcf,0x5a,0x01,0xff,0xc9,0x58,0x03,0xff,0x83,0x3c,0x01,0xff,0x74,0x34,0x01,0xff,0x95,0x43,0x05,0xff,0x50,0x1c,0x02,0xff,0x48,0x19,0x01,0xff,0x5c,0x30,0x03,0xff,0x4f,0x2e,0x01,0xff,0x3a,0x16,0x03,0xff,0x10,0x07,0x01,0xff,0x1d,0x11,0x05,0xff,0x25,0x20,0x1a,0xff,0x0c,0x04,0x04,0xff,0x13,0x02,0x01,0xff,0x2a,0x0c,0x01,0xff,0x58,0x1f,0x01,0xff,0x69,0x26,0x01,0xff,0x6b,0x2c,0x02,0xff,0x6c,0x30,0x01,0xff,0x6b,0x30,0x01,0xff,0x69,0x2f,0x01,0xff,0x6a,0x32,0x01,0xff,0x67,0x32,0x02,0xff,0x81,0x42,0x04,0xff,0x84,0x47,0x04,0xff,0x47,0x2e,0x01,0xff,0x40,0x30,0x04,0xff,0x35,0x2a,0x04,0xff,0x31,0x28,0x04,0xff,0x31,0x29,0x03,0xff,0x45,0x38,0x02,0xff,0x44,0x37,0x03,0xff,0x32,0x2a,0x01,0xff,0x21,0x21,0x00,0xff,0x15,0x16,0x03,0xff,0x14,0x19,0x01,0xff,0x14,0x19,0x00,0xff,0x1f,0x28,0x11,0xff,0x44,0x50,0x4c,0xff,0x56,0x64,0x6f,0xff,0x66,0x75,0x84,0xff,0x78,0x86,0x9b,0xff,0x7b,0x8b,0xa2,0xff,0x7b,0x8d,0xa4,0xff,0x84,0x97,0xb3,0xff,0x96,0xac,0xca,0xff,0xb3,0xc9,0xe2,0xff,0xd7,0xe8,0xfa,0xff,0xe5,0xf3,0xff,0xff,0xcf,0xdc,0xe6,0xff,0xbb,0xc7,0xc7,0xff,0xc1,0xce,0xcb,0xff,0x6d,0x73,0x72,0xff,0x0f,0x0b,0x0f,0xff,0x14,0x11,0x14,0xff,0x10,0x0c,0x0e,0xff,0x1a,0x18,0x1e,0xff,0x34,0x32,0x38,0xff,0x44,0x48,0x50,0xff,0x54,0x5a,0x62,0xff,0x23,0x24,0x28,0xff,0x09,0x08,0x09,0xff,0x0f,0x12,0x15,0xff,0x4a,0x47,0x44,0xff,0x38,0x26,0x12,0xff,0x37,0x28,0x12,0xff,0x37,0x25,0x12,0xff,0x36,0x24,0x10,0xff,0x36,0x25,0x11,0xff,0x35,0x24,0x0f,0xff,0x34,0x23,0x0e,0xff,0x35,0x24,0x0f,0xff,0x36,0x25,0x10,0xff,0x32,0x22,0x0e,0xff,0x32,0x23,0x0f,0xff,0x33,0x24,0x10,0xff,0x33,0x23,0x11,0xff,0x33,0x24,0x10,0xff,0x31,0x22,0x0d,0xff,0x32,0x23,0x0e,0xff,0x33,0x24,0x0f,0xff,0x34,0x24,0x0f,0xff,0x35,0x24,0x0e,0xff,0x28,0x1c,0x0a,0xff,0x94,0x5a,0x10,0xff,0xf1,0xb5,0x15,0xff,0xab,0x9d,0x0a,0xff,0x97,0x79,0x04,0xff,0x9c,0x92,0x8d,0xff,0xe0,0xf4,0xff,0xff,0x99,0xd3,0xfe,0xff,0x6e,0xcc,0xfe,0xff,0x69,0xcb,0xff,0xff,0x3a,0xc2,0xff,0xff,0x35,0xbd,0xff,0xff,0x32,0xc5,0xff,0xff,0x2d,0xc2,0xff,0xff,0x3c,0xc7,0xfd,0xff,0x55,0xdf,0xff,0xff,0x47,0x8b,0xb4,0xff,0x2b,0x18,0x0b,0xff,0x2e,0x1f,0x0c,0xff,0x2d,0x20,0x0c,0xff,0x2d,0x1f,0x0b,0xff,0x2e,0x1e,0x0a,0xff,0x2c,0x1c,0x09,0xff,0x26,0x16,0x02,0xff,0xa3,0x9c,0x93,0x86,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xfe,0xea,0xf2,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf0,0xf5,0x00,0xff,0xff,0xff,0x00,0xfd,0xfd,0xfd,0x9c,0x8b,0x72,0x64,0xff,0x55,0x30,0x1b,0xff,0x5a,0x38,0x24,0xff,0x59,0x38,0x23,0xff,0x59,0x38,0x24,0xff,0x5a,0x39,0x24,0xff,0x56,0x36,0x20,0xff,0x57,0x38,0x20,0xff,0x57,0x37,0x20,0xff,0x57,0x37,0x1f,0xff,0x56,0x37,0x1e,0xff,0x51,0x35,0x1f,0xff,0x6c,0x3e,0x16,0xff,0xca,0x63,0x02,0xff,0x91,0x3e,0x02,0xff,0x6d,0x2c,0x00,0xff,0x70,0x2c,0x01,0xff,0x98,0x41,0x02,0xff,0xcc,0x5b,0x02,0xff,0xd9,0x63,0x02,0xff,0xc7,0x58,0x01,0xff,0x95,0x41,0x01,0xff,0x61,0x2a,0x02,0xff,0x9a,0x43,0x01,0xff,0xc4,0x5b,0x03,0xff,0x6f,0x2c,0x02,0xff,0x43,0x18,0x02,0xff,0x50,0x2d,0x05,0xff,0x47,0x1c,0x03,0xff,0x2b,0x12,0x02,0xff,0x03,0x02,0x01,0xff,0x14,0x0b,0x02,0xff,0x26,0x23,0x20,0xff,0x15,0x0e,0x10,0xff,0x0e,0x01,0x00,0xff,0x0e,0x03,0x02,0xff,0x2f,0x11,0x01,0xff,0x68,0x26,0x02,0xff,0x76,0x30,0x01,0xff,0x77,0x33,0x01,0xff,0x76,0x34,0x02,0xff,0x71,0x33,0x01,0xff,0x5f,0x2e,0x02,0xff,0x4b,0x25,0x02,0xff,0x3f,0x23,0x01,0xff,0x4c,0x33,0x15,0xff,0x63,0x58,0x2d,0xff,0x80,0x68,0x02,0xff,0x71,0x60,0x02,0xff,0x5e,0x55,0x04,0xff,0x56,0x4f,0x02,0xff,0x4b,0x46,0x03,0xff,0x37,0x39,0x02,0xff,0x26,0x2c,0x01,0xff,0x20,0x23,0x01,0xff,0x1b,0x24,0x02,0xff,0x19,0x22,0x01,0xff,0x1d,0x24,0x01,0xff,0x22,0x28,0x05,0xff,0x23,0x2b,0x11,0xff,0x37,0x40,0x3b,0xff,0x50,0x57,0x64,0xff,0x65,0x73,0x84,0xff,0x75,0x85,0x99,0xff,0x7d,0x8e,0xa5,0xff,0x84,0x96,0xb0,0xff,0x8f,0xa5,0xc0,0xff,0xa7,0xbe,0xd8,0xff,0xc6,0xda,0xf0,0xff,0xdd,0xee,0xfd,0xff,0xe1,0xef,0xfa,0xff,0xc0,0xcc,0xcf,0xff,0xcc,0xd9,0xd8,0xff,0x7c,0x7e,0x7c,0xff,0x11,0x0a,0x0e,0xff,0x12,0x0c,0x0c,0xff,0x14,0x0b,0x0a,0xff,0x3d,0x3d,0x45,0xff,0x52,0x58,0x62,0xff,0x26,0x24,0x24,0xff,0x4a,0x53,0x56,0xff,0x4b,0x51,0x53,0xff,0x14,0x12,0x13,0xff,0x04,0x05,0x06,0xff,0x38,0x3a,0x3a,0xff,0x3f,0x34,0x23,0xff,0x35,0x23,0x0f,0xff,0x35,0x24,0x11,0xff,0x35,0x24,0x10,0xff,0x35,0x24,0x0f,0xff,0x35,0x23,0x0e,0xff,0x34,0x23,0x0e,0xff,0x35,0x25,0x0e,0xff,0x37,0x24,0x10,0xff,0x30,0x21,0x0c,0xff,0x2e,0x1d,0x08,0xff,0x34,0x23,0x0e,0xff,0x31,0x22,0x0e,0xff,0x31,0x22,0x0f,0xff,0x32,0x23,0x0d,0xff,0x31,0x23,0x0d,0xff,0x33,0x24,0x0e,0xff,0x34,0x24,0x0f,0xff,0x36,0x25,0x0d,0xff,0x2e,0x20,0x0e,0xff,0x4a,0x2c,0x08,0xff,0xc4,0x8a,0x04,0xff,0x7f,0x7b,0x12,0xff,0x92,0x9b,0x8e,0xff,0xab,0xb2,0xc7,0xff,0xaa,0xbd,0xd8,0xff,0xa6,0xdd,0xfd,0xff,0x72,0xcc,0xfd,0xff,0x3e,0xbc,0xfe,0xff,0x20,0xaf,0xfc,0xff,0x34,0xaf,0xfa,0xff,0x37,0xc6,0xff,0xff,0x35,0xcf,0xfe,0xff,0x4d,0xd8,0xfe,0xff,0x56,0xe0,0xff,0xff,0x4e,0xb1,0xda,0xff,0x2e,0x24,0x1d,0xff,0x2d,0x1d,0x07,0xff,0x2c,0x1f,0x0b,0xff,0x2d,0x1e,0x0b,0xff,0x2d,0x1d,0x0a,0xff,0x2d,0x1d,0x0a,0xff,0x23,0x14,0x00,0xff,0x52,0x46,0x34,0xe7,0xf0,0xef,0xee,0x19,0xff,0xff,0xff,0x00,0xfe,0xf3,0xf7,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfe,0xf0,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x25,0xd4,0xc9,0xc4,0xf1,0x60,0x3d,0x26,0xff,0x5a,0x35,0x1d,0xff,0x5c,0x38,0x21,0xff,0x5a,0x37,0x20,0xff,0x59,0x36,0x20,0xff,0x59,0x38,0x22,0xff,0x58,0x38,0x20,0xff,0x57,0x37,0x1e,0xff,0x56,0x37,0x1d,0xff,0x55,0x36,0x1b,0xff,0x55,0x37,0x1c,0xff,0x4c,0x32,0x18,0xff,0x97,0x4e,0x0d,0xff,0xc2,0x59,0x01,0xff,0x7c,0x31,0x02,0xff,0x83,0x37,0x02,0xff,0xaa,0x4a,0x04,0xff,0xd2,0x5d,0x02,0xff,0xde,0x64,0x02,0xff,0xce,0x5a,0x01,0xff,0xad,0x4c,0x02,0xff,0x74,0x32,0x01,0xff,0x71,0x30,0x01,0xff,0xb5,0x50,0x01,0xff,0xb7,0x52,0x02,0xff,0x87,0x3c,0x03,0xff,0x59,0x2e,0x04,0xff,0x42,0x20,0x03,0xff,0x46,0x1b,0x02,0xff,0x0f,0x08,0x01,0xff,0x09,0x04,0x01,0xff,0x13,0x09,0x00,0xff,0x0f,0x08,0x07,0xff,0x27,0x1c,0x1c,0xff,0x18,0x0b,0x0a,0xff,0x12,0x04,0x03,0xff,0x15,0x07,0x00,0xff,0x48,0x1a,0x01,0xff,0x77,0x2d,0x02,0xff,0x79,0x33,0x02,0xff,0x73,0x30,0x02,0xff,0x5f,0x2a,0x01,0xff,0x3d,0x1d,0x00,0xff,0x2d,0x15,0x02,0xff,0x31,0x15,0x00,0xff,0x45,0x2e,0x15,0xff,0x56,0x52,0x3e,0xff,0x80,0x65,0x0b,0xff,0xb1,0x8a,0x02,0xff,0x9b,0x7b,0x03,0xff,0x83,0x6f,0x02,0xff,0x75,0x67,0x02,0xff,0x60,0x5b,0x03,0xff,0x49,0x4b,0x01,0xff,0x35,0x39,0x02,0xff,0x2a,0x31,0x01,0xff,0x25,0x2b,0x02,0xff,0x22,0x28,0x01,0xff,0x20,0x27,0x00,0xff,0x20,0x26,0x00,0xff,0x28,0x2e,0x17,0xff,0x38,0x3f,0x3e,0xff,0x51,0x5c,0x66,0xff,0x64,0x72,0x83,0xff,0x75,0x84,0x9a,0xff,0x7e,0x90,0xa9,0xff,0x8c,0xa0,0xba,0xff,0x9a,0xaf,0xca,0xff,0xb6,0xcb,0xe6,0xff,0xd4,0xe6,0xf8,0xff,0xe4,0xf3,0xff,0xff,0xcf,0xde,0xe4,0xff,0xc8,0xd7,0xd7,0xff,0x88,0x80,0x7a,0xff,0x26,0x0d,0x01,0xff,0x17,0x08,0x07,0xff,0x16,0x0a,0x08,0xff,0x43,0x46,0x4d,0xff,0x51,0x59,0x64,0xff,0x28,0x29,0x32,0xff,0x1f,0x1f,0x37,0xff,0x28,0x29,0x48,0xff,0x1d,0x1c,0x2d,0xff,0x0f,0x0f,0x13,0xff,0x20,0x23,0x26,0xff,0x46,0x41,0x35,0xff,0x33,0x20,0x0b,0xff,0x35,0x24,0x10,0xff,0x36,0x26,0x10,0xff,0x36,0x25,0x10,0xff,0x34,0x23,0x0e,0xff,0x35,0x24,0x0e,0xff,0x34,0x24,0x0f,0xff,0x35,0x22,0x0d,0xff,0x3c,0x33,0x25,0xff,0x52,0x50,0x50,0xff,0x2e,0x21,0x0c,0xff,0x2f,0x22,0x0b,0xff,0x32,0x24,0x0f,0xff,0x33,0x24,0x0e,0xff,0x32,0x23,0x0e,0xff,0x33,0x23,0x10,0xff,0x33,0x23,0x10,0xff,0x31,0x23,0x10,0xff,0x33,0x25,0x0f,0xff,0x2b,0x1a,0x06,0xff,0x44,0x2a,0x14,0xff,0x8c,0x87,0x89,0xff,0xd3,0xe1,0xf6,0xff,0xa6,0xb8,0xcb,0xff,0x89,0xa2,0xbf,0xff,0xa7,0xd0,0xea,0xff,0x6c,0xc9,0xff,0xff,0x3d,0xbf,0xff,0xff,0x68,0xbe,0xf6,0xff,0x2d,0x86,0xe0,0xff,0x32,0xb2,0xf6,0xff,0x3c,0xd9,0xff,0xff,0x4b,0xdc,0xff,0xff,0x59,0xe1,0xff,0xff,0x54,0xc1,0xeb,0xff,0x2f,0x2d,0x2b,0xff,0x2d,0x1c,0x05,0xff,0x2e,0x1f,0x0c,0xff,0x2e,0x1e,0x0b,0xff,0x2d,0x1e,0x0a,0xff,0x2c,0x1d,0x09,0xff,0x2a,0x1a,0x06,0xff,0x28,0x19,0x03,0xff,0xad,0xa7,0x9f,0x76,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfe,0xef,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xee,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x83,0x94,0x7b,0x6b,0xff,0x57,0x30,0x17,0xff,0x5d,0x38,0x1f,0xff,0x5d,0x38,0x1e,0xff,0x5b,0x37,0x1e,0xff,0x59,0x36,0x1d,0xff,0x5a,0x37,0x1d,0xff,0x57,0x36,0x1b,0xff,0x55,0x35,0x1a,0xff,0x55,0x35,0x19,0xff,0x57,0x37,0x19,0xff,0x55,0x36,0x19,0xff,0x4b,0x33,0x17,0xff,0x99,0x4d,0x09,0xff,0xb8,0x50,0x02,0xff,0x99,0x3f,0x01,0xff,0xb1,0x4c,0x01,0xff,0xd7,0x60,0x02,0xff,0xe2,0x67,0x03,0xff,0xc6,0x58,0x01,0xff,0xb1,0x4e,0x01,0xff,0x99,0x43,0x02,0xff,0x68,0x2c,0x01,0xff,0x80,0x38,0x02,0xff,0xb9,0x54,0x02,0xff,0x93,0x40,0x00,0xff,0x96,0x46,0x03,0xff,0x63,0x36,0x03,0xff,0x45,0x18,0x04,0xff,0x28,0x14,0x01,0xff,0x07,0x02,0x01,0xff,0x16,0x08,0x01,0xff,0x0a,0x03,0x02,0xff,0x1e,0x0d,0x00,0xff,0x3a,0x20,0x11,0xff,0x23,0x14,0x14,0xff,0x0d,0x03,0x03,0xff,0x0d,0x03,0x00,0xff,0x22,0x10,0x01,0xff,0x53,0x21,0x02,0xff,0x74,0x30,0x01,0xff,0x6a,0x2d,0x01,0xff,0x51,0x22,0x02,0xff,0x42,0x1d,0x01,0xff,0x55,0x29,0x01,0xff,0x5b,0x30,0x00,0xff,0x4b,0x2f,0x0b,0xff,0x4f,0x48,0x3b,0xff,0x36,0x2c,0x13,0xff,0x87,0x65,0x05,0xff,0x9e,0x77,0x02,0xff,0x83,0x68,0x02,0xff,0x72,0x5e,0x01,0xff,0x61,0x57,0x02,0xff,0x51,0x4d,0x02,0xff,0x41,0x41,0x02,0xff,0x35,0x3a,0x01,0xff,0x2e,0x32,0x02,0xff,0x26,0x2c,0x01,0xff,0x1f,0x26,0x01,0xff,0x24,0x28,0x02,0xff,0x24,0x2a,0x02,0xff,0x28,0x2e,0x13,0xff,0x3b,0x41,0x3f,0xff,0x54,0x5f,0x69,0xff,0x64,0x72,0x83,0xff,0x75,0x85,0x9a,0xff,0x89,0x9a,0xb5,0xff,0x92,0xa5,0xc2,0xff,0xa9,0xbd,0xdc,0xff,0xc7,0xda,0xf0,0xff,0xdf,0xed,0xfe,0xff,0xe4,0xf2,0xfa,0xff,0xc9,0xd9,0xdb,0xff,0x9f,0xa5,0x9b,0xff,0x51,0x3f,0x2f,0xff,0x20,0x07,0x05,0xff,0x21,0x12,0x0f,0xff,0x53,0x4e,0x4d,0xff,0x27,0x28,0x2e,0xff,0x2a,0x2a,0x55,0xff,0x28,0x28,0x78,0xff,0x2d,0x2a,0x88,0xff,0x25,0x24,0x57,0xff,0x14,0x14,0x19,0xff,0x1d,0x1e,0x21,0xff,0x46,0x49,0x46,0xff,0x33,0x22,0x0e,0xff,0x35,0x24,0x0e,0xff,0x38,0x26,0x12,0xff,0x35,0x24,0x0f,0xff,0x34,0x24,0x0f,0xff,0x35,0x23,0x0e,0xff,0x35,0x24,0x11,0xff,0x2b,0x1e,0x0b,0xff,0x2f,0x29,0x2a,0xff,0x43,0x41,0x3c,0xff,0x30,0x21,0x09,0xff,0x31,0x23,0x0c,0xff,0x33,0x23,0x0d,0xff,0x33,0x23,0x0f,0xff,0x33,0x24,0x11,0xff,0x33,0x23,0x0f,0xff,0x33,0x25,0x11,0xff,0x33,0x24,0x12,0xff,0x30,0x1c,0x05,0xff,0x29,0x1c,0x12,0xff,0x99,0x9f,0xaa,0xff,0xc1,0xd2,0xe6,0xff,0x95,0xaa,0xc2,0xff,0xb2,0xca,0xda,0xff,0x86,0x9a,0xba,0xff,0x92,0xb6,0xd8,0xff,0x6f,0xbc,0xf2,0xff,0x52,0x8d,0xc3,0xff,0xb6,0xd3,0xec,0xff,0x4a,0xa2,0xec,0xff,0x2f,0xb5,0xfd,0xff,0x30,0xba,0xf2,0xff,0x2c,0x9f,0xd6,0xff,0x43,0xd9,0xff,0xff,0x4b,0xb4,0xd8,0xff,0x30,0x23,0x1a,0xff,0x2f,0x1e,0x08,0xff,0x2c,0x1e,0x0a,0xff,0x2c,0x1e,0x0a,0xff,0x2b,0x1d,0x09,0xff,0x2b,0x1d,0x09,0xff,0x2a,0x1c,0x08,0xff,0x22,0x14,0x00,0xff,0x5a,0x4f,0x40,0xd5,0xf5,0xf4,0xf3,0x0b,0xff,0xff,0xff,0x00,0xfe,0xf1,0xf6,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xef,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x10,0xde,0xd7,0xd1,0xdc,0x68,0x43,0x2b,0xff,0x5b,0x33,0x19,0xff,0x5d,0x37,0x1b,0xff,0x5b,0x36,0x19,0xff,0x59,0x35,0x18,0xff,0x5b,0x38,0x1a,0xff,0x59,0x37,0x19,0xff,0x58,0x36,0x19,0xff,0x56,0x36,0x19,0xff,0x57,0x35,0x17,0xff,0x57,0x35,0x17,0xff,0x56,0x35,0x16,0xff,0x4f,0x31,0x14,0xff,0x76,0x3e,0x0b,0xff,0xb4,0x4b,0x01,0xff,0xb2,0x49,0x00,0xff,0xcf,0x5d,0x02,0xff,0xe6,0x6b,0x03,0xff,0xbc,0x56,0x02,0xff,0x82,0x38,0x01,0xff,0x85,0x38,0x01,0xff,0x8c,0x3c,0x02,0xff,0x5f,0x28,0x00,0xff,0x85,0x3a,0x02,0xff,0xa8,0x4a,0x03,0xff,0x7e,0x38,0x01,0xff,0x8a,0x41,0x02,0xff,0x50,0x1f,0x03,0xff,0x38,0x14,0x03,0xff,0x0c,0x07,0x02,0xff,0x0d,0x04,0x02,0xff,0x16,0x09,0x02,0xff,0x0d,0x04,0x01,0xff,0x3e,0x1a,0x01,0xff,0x3a,0x1b,0x04,0xff,0x2c,0x1a,0x10,0xff,0x19,0x0d,0x0b,0xff,0x0b,0x00,0x00,0xff,0x10,0x05,0x02,0xff,0x2b,0x17,0x01,0xff,0x64,0x2c,0x02,0xff,0x6e,0x2e,0x02,0xff,0x5c,0x27,0x02,0xff,0x61,0x2b,0x02,0xff,0x71,0x37,0x02,0xff,0x5f,0x39,0x0b,0xff,0x3d,0x2b,0x16,0xff,0x5e,0x58,0x48,0xff,0x35,0x30,0x29,0xff,0x23,0x18,0x00,0xff,0x89,0x65,0x00,0xff,0x89,0x6a,0x00,0xff,0x75,0x5e,0x00,0xff,0x6c,0x5a,0x02,0xff,0x5c,0x53,0x02,0xff,0x47,0x46,0x01,0xff,0x3c,0x3e,0x01,0xff,0x34,0x35,0x02,0xff,0x2a,0x2e,0x02,0xff,0x22,0x28,0x02,0xff,0x26,0x2c,0x01,0xff,0x26,0x2c,0x01,0xff,0x28,0x2b,0x07,0xff,0x2b,0x31,0x1e,0xff,0x47,0x4e,0x50,0xff,0x55,0x5f,0x6c,0xff,0x62,0x6f,0x82,0xff,0x78,0x89,0xa1,0xff,0x89,0x9e,0xb8,0xff,0x9d,0xb0,0xd0,0xff,0xbb,0xce,0xe7,0xff,0xd4,0xe4,0xf9,0xff,0xe6,0xf4,0xff,0xff,0xe0,0xed,0xf6,0xff,0x8d,0x98,0x97,0xff,0x34,0x29,0x26,0xff,0x36,0x0f,0x0c,0xff,0x16,0x0c,0x08,0xff,0x3b,0x38,0x35,0xff,0x25,0x26,0x34,0xff,0x28,0x28,0x7a,0xff,0x31,0x30,0xaa,0xff,0x32,0x32,0xa8,0xff,0x27,0x27,0x5b,0xff,0x11,0x13,0x14,0xff,0x1a,0x1b,0x1f,0xff,0x45,0x4a,0x49,0xff,0x35,0x25,0x12,0xff,0x33,0x23,0x0d,0xff,0x36,0x23,0x10,0xff,0x35,0x23,0x0f,0xff,0x34,0x23,0x0d,0xff,0x35,0x24,0x0f,0xff,0x36,0x23,0x0e,0xff,0x25,0x1d,0x19,0xff,0x34,0x31,0x32,0xff,0x2e,0x1d,0x06,0xff,0x33,0x24,0x0b,0xff,0x30,0x23,0x0f,0xff,0x32,0x22,0x0f,0xff,0x32,0x23,0x0f,0xff,0x33,0x24,0x12,0xff,0x33,0x23,0x12,0xff,0x34,0x25,0x10,0xff,0x2d,0x1a,0x03,0xff,0x3e,0x34,0x2c,0xff,0x95,0x9b,0xaa,0xff,0xb7,0xc6,0xdc,0xff,0xb6,0xc9,0xda,0xff,0x96,0xaf,0xc7,0xff,0x9e,0xb6,0xd1,0xff,0xa4,0xbc,0xd4,0xff,0x61,0x7d,0xac,0xff,0x8a,0xbe,0xde,0xff,0x46,0x90,0xcd,0xff,0x51,0xbb,0xf1,0xff,0x48,0xcb,0xff,0xff,0x39,0xc5,0xff,0xff,0x3c,0x69,0x8d,0xff,0x2b,0x24,0x29,0xff,0x31,0x54,0x6f,0xff,0x36,0x4a,0x54,0xff,0x2d,0x1b,0x08,0xff,0x2e,0x1e,0x0a,0xff,0x2a,0x1d,0x09,0xff,0x2b,0x1d,0x0a,0xff,0x2a,0x1c,0x08,0xff,0x2a,0x1d,0x09,0xff,0x2a,0x1c,0x08,0xff,0x26,0x19,0x05,0xff,0x29,0x1c,0x08,0xff,0xbd,0xb9,0xb2,0x55,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xef,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xea,0xf2,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x5a,0xab,0x96,0x87,0xff,0x58,0x2e,0x12,0xff,0x5d,0x35,0x19,0xff,0x5d,0x37,0x19,0xff,0x5c,0x37,0x18,0xff,0x5b,0x36,0x16,0xff,0x5b,0x36,0x15,0xff,0x59,0x35,0x15,0xff,0x59,0x35,0x17,0xff,0x59,0x35,0x17,0xff,0x57,0x34,0x16,0xff,0x55,0x34,0x14,0xff,0x55,0x33,0x12,0xff,0x52,0x32,0x12,0xff,0x64,0x39,0x0c,0xff,0xb3,0x4e,0x01,0xff,0xc8,0x57,0x01,0xff,0xe5,0x6d,0x02,0xff,0xc7,0x59,0x02,0xff,0x7e,0x34,0x01,0xff,0x5c,0x24,0x01,0xff,0x82,0x37,0x02,0xff,0x82,0x39,0x02,0xff,0x60,0x27,0x00,0xff,0x98,0x44,0x02,0xff,0xa2,0x47,0x02,0xff,0x7b,0x33,0x01,0xff,0x8b,0x3d,0x03,0xff,0x52,0x21,0x02,0xff,0x17,0x0d,0x01,0xff,0x06,0x03,0x01,0xff,0x17,0x0a,0x01,0xff,0x0d,0x05,0x01,0xff,0x25,0x11,0x03,0xff,0x4f,0x21,0x03,0xff,0x36,0x18,0x01,0xff,0x2d,0x19,0x06,0xff,0x29,0x1a,0x12,0xff,0x10,0x07,0x07,0xff,0x0d,0x02,0x00,0xff,0x12,0x08,0x03,0xff,0x47,0x20,0x01,0xff,0x71,0x2d,0x02,0xff,0x5f,0x27,0x02,0xff,0x58,0x23,0x00,0xff,0x54,0x21,0x00,0xff,0x62,0x40,0x20,0xff,0x50,0x3a,0x1d,0xff,0x7a,0x71,0x5f,0xff,0x94,0x98,0x8e,0xff,0x7b,0x7f,0x7c,0xff,0x5c,0x49,0x1c,0xff,0x7b,0x56,0x00,0xff,0x7c,0x5d,0x00,0xff,0x73,0x5c,0x02,0xff,0x63,0x56,0x01,0xff,0x55,0x4e,0x01,0xff,0x44,0x42,0x01,0xff,0x39,0x3a,0x02,0xff,0x2e,0x30,0x01,0xff,0x27,0x2c,0x01,0xff,0x27,0x2c,0x01,0xff,0x27,0x2b,0x02,0xff,0x28,0x2b,0x05,0xff,0x26,0x29,0x0f,0xff,0x2c,0x31,0x23,0xff,0x45,0x4d,0x53,0xff,0x53,0x5e,0x6e,0xff,0x65,0x73,0x85,0xff,0x7b,0x8d,0xa7,0xff,0x8e,0xa1,0xc0,0xff,0xac,0xbe,0xdc,0xff,0xc6,0xd8,0xf0,0xff,0xdb,0xeb,0xfd,0xff,0xec,0xfb,0xff,0xff,0x9e,0xa9,0xaf,0xff,0x29,0x22,0x1e,0xff,0x1c,0x0c,0x08,0xff,0x32,0x35,0x35,0xff,0x4b,0x50,0x4c,0xff,0x22,0x23,0x3a,0xff,0x2c,0x30,0x9d,0xff,0x31,0x33,0xbb,0xff,0x31,0x33,0xa8,0xff,0x1b,0x1b,0x42,0xff,0x18,0x18,0x18,0xff,0x16,0x15,0x19,0xff,0x3c,0x3f,0x40,0xff,0x37,0x28,0x16,0xff,0x34,0x23,0x0d,0xff,0x35,0x24,0x10,0xff,0x33,0x23,0x0f,0xff,0x34,0x22,0x0e,0xff,0x36,0x24,0x11,0xff,0x2f,0x1e,0x0e,0xff,0x2c,0x2d,0x35,0xff,0x39,0x30,0x28,0xff,0x30,0x20,0x0b,0xff,0x30,0x22,0x10,0xff,0x30,0x22,0x10,0xff,0x30,0x23,0x0e,0xff,0x33,0x22,0x0f,0xff,0x2f,0x1e,0x06,0xff,0x2f,0x1e,0x06,0xff,0x31,0x1d,0x07,0xff,0x3b,0x31,0x26,0xff,0x8a,0x93,0xa3,0xff,0xdc,0xe9,0xf5,0xff,0x94,0xac,0xc3,0xff,0xa9,0xc1,0xd2,0xff,0xab,0xc2,0xd7,0xff,0x8b,0xa6,0xc8,0xff,0x8b,0xa6,0xc6,0xff,0x5b,0x71,0x9b,0xff,0x76,0x9c,0xc3,0xff,0x86,0xe1,0xff,0xff,0x39,0xcb,0xff,0xff,0x2f,0xcd,0xff,0xff,0x40,0xb0,0xdf,0xff,0x35,0x2f,0x30,0xff,0x34,0x25,0x15,0xff,0x2d,0x18,0x04,0xff,0x2c,0x17,0x02,0xff,0x2e,0x20,0x0c,0xff,0x2c,0x1e,0x0b,0xff,0x2b,0x1e,0x0a,0xff,0x2a,0x1d,0x09,0xff,0x29,0x1c,0x08,0xff,0x2a,0x1c,0x08,0xff,0x29,0x1c,0x08,0xff,0x28,0x1b,0x07,0xff,0x1f,0x12,0x00,0xff,0x73,0x6a,0x5d,0xb2,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xed,0xf3,0x00,0xfd,0xe4,0xef,0x00,0xfe,0xee,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xff,0xff,0x00,0xf3,0xf0,0xee,0xb3,0x7c,0x5a,0x43,0xff,0x58,0x2e,0x10,0xff,0x5f,0x37,0x18,0xff,0x5e,0x36,0x17,0xff,0x5c,0x35,0x16,0xff,0x5c,0x36,0x14,0xff,0x5b,0x35,0x13,0xff,0x5a,0x35,0x14,0xff,0x59,0x34,0x14,0xff,0x58,0x33,0x14,0xff,0x56,0x32,0x13,0xff,0x56,0x33,0x13,0xff,0x57,0x34,0x12,0xff,0x52,0x32,0x10,0xff,0x59,0x33,0x08,0xff,0xaf,0x4f,0x01,0xff,0xe0,0x68,0x02,0xff,0xd2,0x63,0x04,0xff,0x7f,0x34,0x00,0xff,0x49,0x1c,0x02,0xff,0x53,0x21,0x02,0xff,0x98,0x44,0x03,0xff,0x81,0x39,0x02,0xff,0x67,0x2b,0x02,0xff,0xa6,0x4a,0x01,0xff,0x98,0x41,0x01,0xff,0x85,0x36,0x02,0xff,0xae,0x4e,0x04,0xff,0x48,0x22,0x02,0xff,0x01,0x02,0x01,0xff,0x0f,0x07,0x00,0xff,0x14,0x09,0x01,0xff,0x0d,0x06,0x01,0xff,0x3e,0x1d,0x02,0xff,0x43,0x1d,0x01,0xff,0x37,0x19,0x01,0xff,0x30,0x17,0x02,0xff,0x32,0x23,0x1b,0xff,0x22,0x1a,0x19,0xff,0x0c,0x03,0x01,0xff,0x0f,0x06,0x02,0xff,0x24,0x10,0x02,0xff,0x4a,0x1c,0x03,0xff,0x50,0x1e,0x01,0xff,0x4a,0x1c,0x01,0xff,0x51,0x21,0x00,0xff,0x44,0x1f,0x01,0xff,0x33,0x1b,0x02,0xff,0x4a,0x3a,0x1c,0xff,0x57,0x44,0x25,0xff,0xaf,0xaa,0x9a,0xff,0xba,0xc7,0xc4,0xff,0x92,0x84,0x5e,0xff,0x74,0x53,0x00,0xff,0x77,0x5e,0x00,0xff,0x6d,0x5e,0x02,0xff,0x60,0x58,0x02,0xff,0x4e,0x4d,0x02,0xff,0x42,0x43,0x02,0xff,0x36,0x39,0x02,0xff,0x2d,0x31,0x01,0xff,0x28,0x2b,0x02,0xff,0x26,0x2b,0x01,0xff,0x28,0x2c,0x03,0xff,0x29,0x2e,0x0d,0xff,0x25,0x2b,0x15,0xff,0x34,0x3c,0x37,0xff,0x44,0x4e,0x57,0xff,0x54,0x62,0x70,0xff,0x6d,0x7d,0x92,0xff,0x82,0x94,0xb3,0xff,0x9d,0xb0,0xd1,0xff,0xb3,0xc6,0xe3,0xff,0xd1,0xe3,0xf9,0xff,0xe9,0xf7,0xff,0xff,0xc5,0xd4,0xda,0xff,0x2b,0x2e,0x31,0xff,0x0c,0x09,0x07,0xff,0x6b,0x7e,0x89,0xff,0x4b,0x57,0x5f,0xff,0x21,0x24,0x4f,0xff,0x46,0x4e,0xcb,0xff,0x39,0x43,0xd1,0xff,0x2c,0x2f,0xa2,0xff,0x21,0x21,0x41,0xff,0x22,0x22,0x22,0xff,0x09,0x0a,0x09,0xff,0x3c,0x3a,0x39,0xff,0x35,0x25,0x12,0xff,0x33,0x26,0x0e,0xff,0x32,0x25,0x0c,0xff,0x33,0x24,0x09,0xff,0x34,0x22,0x0b,0xff,0x35,0x23,0x0c,0xff,0x24,0x1c,0x16,0xff,0x55,0x5e,0x67,0xff,0x37,0x2b,0x1a,0xff,0x31,0x20,0x0e,0xff,0x33,0x24,0x12,0xff,0x33,0x23,0x0f,0xff,0x33,0x23,0x0f,0xff,0x32,0x25,0x16,0xff,0x44,0x44,0x48,0xff,0x3b,0x38,0x35,0xff,0x32,0x29,0x20,0xff,0xaf,0xb6,0xc1,0xff,0xb9,0xcb,0xde,0xff,0x99,0xb1,0xc4,0xff,0xbe,0xd2,0xe0,0xff,0x93,0xaf,0xc6,0xff,0xbc,0xd4,0xe7,0xff,0x80,0x99,0xba,0xff,0x72,0x8d,0xb2,0xff,0x73,0x8b,0xae,0xff,0x4f,0x65,0x8c,0xff,0x5f,0xb3,0xdb,0xff,0x26,0xd2,0xff,0xff,0x1c,0xd9,0xff,0xff,0x36,0x88,0xad,0xff,0x2b,0x15,0x02,0xff,0x2f,0x1f,0x0a,0xff,0x30,0x20,0x0c,0xff,0x2f,0x20,0x0c,0xff,0x2d,0x20,0x0c,0xff,0x2b,0x1e,0x0a,0xff,0x2b,0x1e,0x0a,0xff,0x29,0x1b,0x08,0xff,0x2a,0x1c,0x09,0xff,0x29,0x1c,0x08,0xff,0x28,0x1b,0x07,0xff,0x29,0x1b,0x08,0xff,0x25,0x17,0x03,0xff,0x3b,0x2f,0x1c,0xf5,0xde,0xdb,0xd8,0x29,0xff,0xff,0xff,0x00,0xfe,0xf6,0xf9,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xee,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x27,0xcb,0xbe,0xb4,0xf3,0x61,0x37,0x19,0xff,0x5d,0x32,0x14,0xff,0x5f,0x35,0x16,0xff,0x5f,0x35,0x17,0xff,0x5e,0x34,0x14,0xff,0x5c,0x34,0x11,0xff,0x5d,0x35,0x11,0xff,0x5a,0x32,0x10,0xff,0x59,0x33,0x11,0xff,0x5a,0x34,0x12,0xff,0x58,0x32,0x13,0xff,0x58,0x33,0x13,0xff,0x58,0x33,0x11,0xff,0x55,0x32,0x0d,0xff,0x51,0x30,0x08,0xff,0xab,0x50,0x03,0xff,0xdd,0x67,0x03,0xff,0x9c,0x41,0x04,0xff,0x49,0x1d,0x00,0xff,0x34,0x16,0x01,0xff,0x7c,0x37,0x01,0xff,0xb9,0x56,0x03,0xff,0x83,0x3a,0x02,0xff,0x70,0x30,0x00,0xff,0xab,0x4e,0x03,0xff,0x97,0x40,0x01,0xff,0xa5,0x4a,0x01,0xff,0xa6,0x4e,0x03,0xff,0x3a,0x1c,0x03,0xff,0x09,0x03,0x02,0xff,0x12,0x08,0x02,0xff,0x09,0x04,0x01,0xff,0x2d,0x18,0x04,0xff,0x3f,0x1f,0x01,0xff,0x35,0x1a,0x01,0xff,0x38,0x1c,0x01,0xff,0x35,0x1a,0x01,0xff,0x35,0x1b,0x0b,0xff,0x20,0x15,0x11,0xff,0x0f,0x07,0x04,0xff,0x21,0x10,0x02,0xff,0x09,0x05,0x02,0xff,0x16,0x0b,0x02,0xff,0x37,0x15,0x01,0xff,0x4c,0x1d,0x04,0xff,0x6a,0x2c,0x04,0xff,0x52,0x26,0x02,0xff,0x32,0x1c,0x03,0xff,0x48,0x34,0x1a,0xff,0x41,0x29,0x09,0xff,0x45,0x29,0x07,0xff,0x8e,0x86,0x76,0xff,0xcb,0xd9,0xdb,0xff,0xa3,0x9d,0x7a,0xff,0x6e,0x56,0x01,0xff,0x76,0x64,0x00,0xff,0x69,0x5e,0x01,0xff,0x55,0x52,0x01,0xff,0x48,0x48,0x02,0xff,0x3b,0x3d,0x01,0xff,0x31,0x36,0x01,0xff,0x2a,0x2e,0x01,0xff,0x26,0x2b,0x00,0xff,0x27,0x2b,0x03,0xff,0x27,0x2e,0x0b,0xff,0x25,0x2b,0x10,0xff,0x26,0x2b,0x1c,0xff,0x35,0x3e,0x3c,0xff,0x45,0x50,0x56,0xff,0x51,0x5d,0x69,0xff,0x69,0x79,0x91,0xff,0x8c,0xa0,0xc0,0xff,0xa8,0xbe,0xde,0xff,0xc6,0xdb,0xf4,0xff,0xdd,0xeb,0xfd,0xff,0xef,0xfd,0xff,0xff,0x87,0x8e,0x96,0xff,0x05,0x06,0x07,0xff,0x7e,0x8f,0x99,0xff,0x42,0x4a,0x54,0xff,0x33,0x39,0x79,0xff,0x47,0x52,0xd0,0xff,0x4c,0x5a,0xe8,0xff,0x2c,0x2f,0xa0,0xff,0x2b,0x2e,0x48,0xff,0x0f,0x10,0x0d,0xff,0x14,0x12,0x1a,0xff,0x44,0x32,0x5a,0xff,0x3e,0x21,0x5e,0xff,0x42,0x1c,0x7f,0xff,0x45,0x1a,0x89,0xff,0x43,0x1b,0x77,0xff,0x40,0x23,0x4c,0xff,0x38,0x25,0x28,0xff,0x12,0x10,0x13,0xff,0x2a,0x25,0x23,0xff,0x34,0x26,0x12,0xff,0x31,0x22,0x0f,0xff,0x33,0x24,0x12,0xff,0x32,0x24,0x12,0xff,0x34,0x26,0x1e,0xff,0x2f,0x24,0x2a,0xff,0x3a,0x50,0x70,0xff,0x66,0xa2,0xcd,0xff,0xa4,0xaf,0xbe,0xff,0xb6,0xc6,0xda,0xff,0xb8,0xce,0xde,0xff,0x9c,0xb4,0xcb,0xff,0xae,0xc2,0xd7,0xff,0xc7,0xdf,0xf0,0xff,0x9f,0xb8,0xcd,0xff,0x85,0xa2,0xbe,0xff,0x61,0x7b,0xa3,0xff,0x81,0x9a,0xbf,0xff,0x48,0x4e,0x62,0xff,0x19,0x2c,0x41,0xff,0x1b,0x75,0xa6,0xff,0x2d,0x9e,0xd7,0xff,0x2f,0x3f,0x4b,0xff,0x2d,0x1a,0x01,0xff,0x2e,0x21,0x0b,0xff,0x2d,0x1f,0x0c,0xff,0x2c,0x1e,0x0b,0xff,0x2c,0x1e,0x0a,0xff,0x2c,0x1e,0x0a,0xff,0x2a,0x1e,0x09,0xff,0x29,0x1c,0x08,0xff,0x29,0x1b,0x07,0xff,0x29,0x1b,0x07,0xff,0x27,0x1a,0x06,0xff,0x28,0x1a,0x06,0xff,0x27,0x19,0x05,0xff,0x22,0x14,0x00,0xff,0x9e,0x98,0x8f,0x7a,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfd,0xe8,0xf0,0x00,0xfe,0xed,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe5,0xee,0x00,0xfe,0xec,0xf3,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x72,0x99,0x7c,0x68,0xff,0x59,0x2b,0x0a,0xff,0x60,0x35,0x14,0xff,0x60,0x35,0x14,0xff,0x5f,0x34,0x12,0xff,0x5e,0x33,0x10,0xff,0x5c,0x33,0x0f,0xff,0x5c,0x33,0x0e,0xff,0x5a,0x31,0x0e,0xff,0x5b,0x32,0x10,0xff,0x59,0x32,0x10,0xff,0x58,0x31,0x10,0xff,0x59,0x32,0x11,0xff,0x54,0x30,0x0d,0xff,0x56,0x31,0x0d,0xff,0x4e,0x2f,0x08,0xff,0x99,0x48,0x03,0xff,0xc7,0x5c,0x01,0xff,0x6d,0x2f,0x01,0xff,0x37,0x17,0x00,0xff,0x42,0x1a,0x02,0xff,0xb0,0x51,0x02,0xff,0xc8,0x60,0x03,0xff,0x7d,0x39,0x02,0xff,0x84,0x3c,0x02,0xff,0xa8,0x4f,0x02,0xff,0xa8,0x4d,0x02,0xff,0x91,0x49,0x04,0xff,0x26,0x15,0x02,0xff,0x0d,0x0a,0x01,0xff,0x3d,0x24,0x05,0xff,0x16,0x0d,0x02,0xff,0x18,0x0c,0x02,0xff,0x3a,0x22,0x02,0xff,0x32,0x1b,0x01,0xff,0x2f,0x19,0x01,0xff,0x37,0x1d,0x01,0xff,0x30,0x17,0x01,0xff,0x48,0x27,0x06,0xff,0x39,0x23,0x06,0xff,0x0b,0x06,0x01,0xff,0x0b,0x05,0x01,0xff,0x0a,0x01,0x00,0xff,0x0b,0x07,0x01,0xff,0x24,0x10,0x01,0xff,0x45,0x1b,0x03,0xff,0x54,0x23,0x06,0xff,0x44,0x20,0x01,0xff,0x29,0x15,0x03,0xff,0x42,0x2a,0x0c,0xff,0x3f,0x27,0x0b,0xff,0x4b,0x29,0x00,0xff,0x56,0x37,0x0b,0xff,0x7e,0x76,0x64,0xff,0xb9,0xc1,0xbd,0xff,0x97,0x91,0x63,0xff,0x70,0x5b,0x00,0xff,0x69,0x5f,0x00,0xff,0x5e,0x56,0x02,0xff,0x50,0x4e,0x02,0xff,0x43,0x45,0x01,0xff,0x3b,0x3f,0x02,0xff,0x2f,0x33,0x01,0xff,0x25,0x2a,0x00,0xff,0x24,0x29,0x02,0xff,0x21,0x28,0x06,0xff,0x25,0x2b,0x10,0xff,0x26,0x2c,0x1a,0xff,0x26,0x2e,0x25,0xff,0x34,0x3d,0x3b,0xff,0x42,0x4e,0x55,0xff,0x54,0x63,0x75,0xff,0x7c,0x8f,0xab,0xff,0x99,0xb0,0xce,0xff,0xba,0xd0,0xea,0xff,0xd6,0xe4,0xf9,0xff,0xe4,0xf4,0xff,0xff,0xdd,0xea,0xed,0xff,0x48,0x50,0x5b,0xff,0x87,0x9a,0xab,0xff,0x28,0x2c,0x37,0xff,0x2e,0x34,0x82,0xff,0x3b,0x49,0xcc,0xff,0x3d,0x4f,0xe2,0xff,0x2c,0x32,0xaa,0xff,0x1a,0x17,0x2e,0xff,0x0e,0x0d,0x08,0xff,0x33,0x1d,0x4e,0xff,0x49,0x1e,0x8c,0xff,0x48,0x0b,0xc3,0xff,0x49,0x00,0xef,0xff,0x4e,0x00,0xfc,0xff,0x4c,0x00,0xf7,0xff,0x4c,0x0d,0xcf,0xff,0x36,0x1c,0x6c,0xff,0x10,0x0f,0x0e,0xff,0x28,0x1d,0x0e,0xff,0x30,0x20,0x10,0xff,0x30,0x23,0x0f,0xff,0x31,0x22,0x11,0xff,0x2b,0x24,0x1c,0xff,0x25,0x1f,0x1f,0xff,0x2f,0x2c,0x31,0xff,0x33,0x36,0x42,0xff,0x6e,0x87,0xa1,0xff,0xd4,0xe7,0xf5,0xff,0x9d,0xb4,0xc8,0xff,0xaa,0xc1,0xd6,0xff,0xab,0xbe,0xd2,0xff,0x99,0xb2,0xce,0xff,0xaa,0xc3,0xd7,0xff,0x85,0x9e,0xb8,0xff,0x8c,0xa7,0xc1,0xff,0x78,0x92,0xb7,0xff,0x58,0x62,0x79,0xff,0x44,0x40,0x43,0xff,0x52,0x49,0x4d,0xff,0x32,0x20,0x17,0xff,0x2d,0x1b,0x13,0xff,0x2b,0x1b,0x06,0xff,0x2c,0x1f,0x0b,0xff,0x2b,0x1e,0x0a,0xff,0x2a,0x1e,0x0b,0xff,0x2b,0x1d,0x0a,0xff,0x29,0x1c,0x08,0xff,0x29,0x1c,0x09,0xff,0x29,0x1b,0x09,0xff,0x28,0x1b,0x08,0xff,0x27,0x1b,0x08,0xff,0x27,0x1a,0x08,0xff,0x27,0x1a,0x08,0xff,0x26,0x19,0x05,0xff,0x27,0x19,0x05,0xff,0x20,0x10,0x00,0xff,0x5a,0x4f,0x3f,0xc9,0xf8,0xf7,0xf6,0x03,0xff,0xff,0xff,0x00,0xfe,0xee,0xf4,0x00,0xfe,0xec,0xf3,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe4,0xee,0x00,0xfe,0xf2,0xf8,0x00,0xff,0xff,0xff,0x00,0xea,0xe4,0xe0,0xc0,0x71,0x48,0x2c,0xff,0x5e,0x30,0x0d,0xff,0x5f,0x33,0x11,0xff,0x61,0x35,0x12,0xff,0x61,0x35,0x11,0xff,0x61,0x35,0x10,0xff,0x5e,0x34,0x0e,0xff,0x5c,0x32,0x0c,0xff,0x5c,0x32,0x0c,0xff,0x5a,0x31,0x0c,0xff,0x59,0x31,0x0d,0xff,0x59,0x32,0x0e,0xff,0x58,0x32,0x0d,0xff,0x56,0x32,0x0b,0xff,0x56,0x31,0x0a,0xff,0x4e,0x2f,0x07,0xff,0x82,0x3f,0x02,0xff,0xac,0x4c,0x02,0xff,0x57,0x24,0x02,0xff,0x32,0x15,0x00,0xff,0x52,0x22,0x00,0xff,0xb4,0x55,0x01,0xff,0xb9,0x5a,0x01,0xff,0x81,0x3d,0x02,0xff,0x8a,0x41,0x02,0xff,0xab,0x54,0x02,0xff,0x96,0x50,0x05,0xff,0x25,0x1a,0x01,0xff,0x0c,0x0c,0x01,0xff,0x5e,0x3b,0x03,0xff,0x82,0x4e,0x04,0xff,0x43,0x2e,0x03,0xff,0x44,0x27,0x02,0xff,0x33,0x1b,0x03,0xff,0x2f,0x1a,0x01,0xff,0x2d,0x1a,0x01,0xff,0x33,0x1d,0x01,0xff,0x33,0x19,0x02,0xff,0x3e,0x1f,0x04,0xff,0x48,0x27,0x05,0xff,0x0a,0x00,0x01,0xff,0x04,0x13,0x10,0xff,0x0b,0x2b,0x27,0xff,0x09,0x05,0x00,0xff,0x0c,0x07,0x01,0xff,0x2b,0x15,0x02,0xff,0x38,0x17,0x01,0xff,0x47,0x28,0x09,0xff,0x4e,0x2f,0x0b,0xff,0x4e,0x38,0x13,0xff,0x53,0x35,0x12,0xff,0x5e,0x36,0x05,0xff,0x42,0x2c,0x0b,0xff,0x2c,0x1e,0x0e,0xff,0x35,0x32,0x27,0xff,0x68,0x6b,0x5e,0xff,0x74,0x68,0x2a,0xff,0x70,0x5c,0x00,0xff,0x64,0x5c,0x02,0xff,0x58,0x55,0x02,0xff,0x4f,0x4f,0x01,0xff,0x40,0x44,0x02,0xff,0x34,0x3a,0x02,0xff,0x29,0x2e,0x01,0xff,0x22,0x27,0x01,0xff,0x21,0x27,0x08,0xff,0x26,0x2d,0x12,0xff,0x26,0x2d,0x19,0xff,0x23,0x2a,0x1e,0xff,0x24,0x2e,0x25,0xff,0x39,0x43,0x48,0xff,0x48,0x55,0x63,0xff,0x63,0x72,0x8b,0xff,0x88,0x9e,0xba,0xff,0xa7,0xbe,0xdc,0xff,0xc8,0xda,0xf2,0xff,0xda,0xe9,0xfb,0xff,0xec,0xf6,0xff,0xff,0xcb,0xd9,0xe7,0xff,0x83,0x95,0xa9,0xff,0x17,0x19,0x29,0xff,0x36,0x3b,0x97,0xff,0x41,0x52,0xdd,0xff,0x3a,0x51,0xe2,0xff,0x35,0x45,0xba,0xff,0x21,0x19,0x2d,0xff,0x35,0x22,0x2e,0xff,0x49,0x1f,0x84,0xff,0x48,0x08,0xc9,0xff,0x4e,0x00,0xf9,0xff,0x53,0x02,0xff,0xff,0x52,0x06,0xff,0xff,0x4f,0x02,0xff,0xff,0x4e,0x01,0xfc,0xff,0x2d,0x19,0x73,0xff,0x27,0x24,0x2e,0xff,0x34,0x23,0x26,0xff,0x2e,0x1d,0x05,0xff,0x32,0x20,0x0f,0xff,0x1e,0x18,0x1a,0xff,0x2c,0x31,0x39,0xff,0x31,0x27,0x20,0xff,0x35,0x34,0x37,0xff,0x84,0x8d,0x9a,0xff,0xbc,0xcc,0xd8,0xff,0x98,0xb0,0xc7,0xff,0xbf,0xd2,0xe1,0xff,0x8f,0xaa,0xc1,0xff,0xae,0xc9,0xdd,0xff,0x7d,0x95,0xb4,0xff,0x86,0xa1,0xba,0xff,0x88,0xa2,0xbc,0xff,0x84,0xa1,0xc2,0xff,0x75,0x86,0x9b,0xff,0x24,0x18,0x0c,0xff,0x28,0x1a,0x06,0xff,0x2f,0x22,0x10,0xff,0x2d,0x1f,0x0c,0xff,0x2d,0x1e,0x08,0xff,0x2d,0x1f,0x0b,0xff,0x2b,0x1d,0x0a,0xff,0x2a,0x1d,0x0c,0xff,0x29,0x1c,0x0a,0xff,0x28,0x1b,0x09,0xff,0x28,0x1b,0x09,0xff,0x27,0x1b,0x09,0xff,0x27,0x1a,0x09,0xff,0x27,0x1b,0x0a,0xff,0x27,0x1b,0x09,0xff,0x26,0x1a,0x08,0xff,0x26,0x1a,0x08,0xff,0x27,0x1a,0x08,0xff,0x27,0x19,0x07,0xff,0x24,0x16,0x03,0xff,0x2d,0x20,0x0e,0xfc,0xcd,0xca,0xc5,0x33,0xff,0xff,0xff,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xec,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf6,0xfa,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xff,0xff,0x29,0xc7,0xb6,0xa9,0xf6,0x5f,0x30,0x0e,0xff,0x60,0x32,0x0f,0xff,0x61,0x33,0x0f,0xff,0x61,0x34,0x0d,0xff,0x60,0x33,0x0c,0xff,0x60,0x33,0x0d,0xff,0x60,0x34,0x0c,0xff,0x5d,0x33,0x0a,0xff,0x5d,0x32,0x0b,0xff,0x5b,0x31,0x0b,0xff,0x5b,0x31,0x0b,0xff,0x5a,0x31,0x0b,0xff,0x56,0x30,0x09,0xff,0x56,0x31,0x09,0xff,0x56,0x32,0x08,0xff,0x50,0x2f,0x08,0xff,0x72,0x3b,0x03,0xff,0x91,0x40,0x02,0xff,0x43,0x1c,0x00,0xff,0x30,0x14,0x00,0xff,0x67,0x2c,0x01,0xff,0xb1,0x55,0x01,0xff,0xa1,0x52,0x01,0xff,0x7f,0x40,0x01,0xff,0x90,0x47,0x01,0xff,0xa1,0x58,0x02,0xff,0x47,0x2a,0x02,0xff,0x20,0x19,0x00,0xff,0x72,0x43,0x03,0xff,0x92,0x54,0x04,0xff,0x48,0x30,0x01,0xff,0x5a,0x39,0x01,0xff,0x83,0x52,0x02,0xff,0x34,0x1f,0x02,0xff,0x2a,0x19,0x01,0xff,0x34,0x1d,0x03,0xff,0x36,0x1b,0x01,0xff,0x3a,0x1c,0x01,0xff,0x3e,0x20,0x04,0xff,0x49,0x27,0x03,0xff,0x20,0x0b,0x00,0xff,0x04,0x12,0x13,0xff,0x0b,0x30,0x2c,0xff,0x09,0x04,0x01,0xff,0x0a,0x07,0x03,0xff,0x10,0x07,0x00,0xff,0x33,0x16,0x07,0xff,0x46,0x3a,0x2c,0xff,0x36,0x24,0x0a,0xff,0x35,0x20,0x02,0xff,0x3c,0x1c,0x02,0xff,0x40,0x1f,0x03,0xff,0x0c,0x07,0x03,0xff,0x03,0x00,0x01,0xff,0x02,0x00,0x00,0xff,0x04,0x01,0x02,0xff,0x1a,0x15,0x0a,0xff,0x52,0x47,0x04,0xff,0x6c,0x61,0x03,0xff,0x5d,0x55,0x02,0xff,0x53,0x52,0x01,0xff,0x47,0x4a,0x02,0xff,0x3b,0x40,0x02,0xff,0x30,0x35,0x01,0xff,0x24,0x29,0x01,0xff,0x1e,0x25,0x06,0xff,0x1f,0x25,0x0d,0xff,0x23,0x2b,0x17,0xff,0x25,0x2d,0x20,0xff,0x22,0x2a,0x1f,0xff,0x2c,0x34,0x34,0xff,0x39,0x44,0x4c,0xff,0x4a,0x55,0x66,0xff,0x6c,0x7c,0x97,0xff,0x94,0xa8,0xca,0xff,0xb8,0xcb,0xe8,0xff,0xd2,0xe1,0xf5,0xff,0xe0,0xed,0xfb,0xff,0xf3,0xff,0xff,0xff,0x93,0xa2,0xab,0xff,0x19,0x1b,0x34,0xff,0x45,0x50,0xa9,0xff,0x43,0x5d,0xe3,0xff,0x3d,0x5c,0xea,0xff,0x41,0x57,0xd5,0xff,0x24,0x24,0x3d,0xff,0x36,0x20,0x42,0xff,0x46,0x0e,0xb2,0xff,0x4b,0x00,0xfa,0xff,0x51,0x07,0xff,0xff,0x56,0x1d,0xfd,0xff,0x5a,0x26,0xfd,0xff,0x5c,0x21,0xff,0xff,0x4a,0x13,0xd7,0xff,0x2a,0x27,0x4e,0xff,0x33,0x1f,0x6b,0xff,0x36,0x20,0x44,0xff,0x41,0x3d,0x2f,0xff,0x35,0x2e,0x2b,0xff,0x16,0x19,0x28,0xff,0x3c,0x43,0x51,0xff,0x49,0x42,0x44,0xff,0xbc,0xc1,0xcb,0xff,0xb3,0xc5,0xd9,0xff,0xb3,0xc7,0xda,0xff,0xa5,0xbb,0xce,0xff,0x9b,0xb3,0xcb,0xff,0xcc,0xe1,0xef,0xff,0x9d,0xb6,0xca,0xff,0x88,0xa0,0xbb,0xff,0x6b,0x82,0xa1,0xff,0x93,0xac,0xc9,0xff,0x68,0x79,0x93,0xff,0x35,0x29,0x22,0xff,0x29,0x1a,0x07,0xff,0x2e,0x1f,0x0d,0xff,0x2e,0x1e,0x0d,0xff,0x2b,0x1e,0x0d,0xff,0x2c,0x1d,0x0c,0xff,0x2b,0x1d,0x0b,0xff,0x2b,0x1d,0x0c,0xff,0x29,0x1d,0x0b,0xff,0x28,0x1c,0x0a,0xff,0x27,0x1b,0x09,0xff,0x27,0x1b,0x09,0xff,0x27,0x1b,0x09,0xff,0x25,0x1a,0x09,0xff,0x26,0x1a,0x0a,0xff,0x25,0x19,0x08,0xff,0x26,0x19,0x09,0xff,0x25,0x19,0x08,0xff,0x24,0x19,0x07,0xff,0x26,0x19,0x07,0xff,0x26,0x17,0x06,0xff,0x1d,0x10,0x00,0xff,0x95,0x8f,0x86,0x7d,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xee,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf9,0x00,0xfd,0xe9,0xf1,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x6b,0xa0,0x82,0x6c,0xff,0x5b,0x2a,0x04,0xff,0x61,0x33,0x0e,0xff,0x61,0x33,0x0d,0xff,0x5f,0x33,0x09,0xff,0x5e,0x31,0x08,0xff,0x61,0x33,0x0c,0xff,0x61,0x33,0x0b,0xff,0x60,0x33,0x0a,0xff,0x5d,0x31,0x08,0xff,0x5c,0x31,0x09,0xff,0x5b,0x32,0x09,0xff,0x5b,0x32,0x08,0xff,0x58,0x31,0x07,0xff,0x58,0x31,0x06,0xff,0x56,0x31,0x08,0xff,0x51,0x2f,0x07,0xff,0x6e,0x39,0x04,0xff,0x7a,0x36,0x02,0xff,0x33,0x14,0x00,0xff,0x38,0x17,0x01,0xff,0x7d,0x37,0x02,0xff,0xab,0x57,0x01,0xff,0x96,0x4f,0x01,0xff,0x7e,0x40,0x01,0xff,0x94,0x51,0x03,0xff,0x6d,0x43,0x01,0xff,0x39,0x27,0x00,0xff,0x75,0x48,0x02,0xff,0x92,0x53,0x03,0xff,0x56,0x35,0x01,0xff,0x35,0x26,0x02,0xff,0x78,0x4a,0x01,0xff,0x8c,0x54,0x04,0xff,0x63,0x3b,0x03,0xff,0x2e,0x1a,0x01,0xff,0x36,0x1b,0x02,0xff,0x3d,0x1c,0x02,0xff,0x3f,0x1d,0x00,0xff,0x3d,0x1c,0x02,0xff,0x3b,0x1e,0x04,0xff,0x59,0x3b,0x0b,0xff,0x0a,0x03,0x01,0xff,0x09,0x01,0x01,0xff,0x0d,0x05,0x03,0xff,0x0a,0x06,0x02,0xff,0x10,0x04,0x00,0xff,0x42,0x30,0x25,0xff,0x5a,0x51,0x3e,0xff,0x23,0x14,0x02,0xff,0x26,0x15,0x03,0xff,0x26,0x14,0x03,0xff,0x22,0x11,0x01,0xff,0x15,0x11,0x0c,0xff,0x21,0x20,0x1c,0xff,0x11,0x10,0x0d,0xff,0x04,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x0a,0x08,0x02,0xff,0x4b,0x42,0x04,0xff,0x69,0x5f,0x03,0xff,0x59,0x56,0x01,0xff,0x4c,0x4f,0x02,0xff,0x40,0x46,0x01,0xff,0x37,0x3d,0x00,0xff,0x2a,0x31,0x02,0xff,0x22,0x28,0x09,0xff,0x21,0x26,0x11,0xff,0x22,0x2a,0x19,0xff,0x23,0x2a,0x1f,0xff,0x24,0x2a,0x22,0xff,0x28,0x30,0x2d,0xff,0x2e,0x37,0x3a,0xff,0x3b,0x43,0x4d,0xff,0x57,0x62,0x78,0xff,0x7f,0x91,0xb1,0xff,0xa3,0xb7,0xd8,0xff,0xc2,0xd4,0xef,0xff,0xd5,0xe6,0xf9,0xff,0xe1,0xf1,0xff,0xff,0xda,0xe7,0xef,0xff,0x4c,0x51,0x79,0xff,0x36,0x42,0xa7,0xff,0x3f,0x5d,0xdf,0xff,0x3d,0x63,0xed,0xff,0x3d,0x55,0xdb,0xff,0x2e,0x2f,0x5c,0xff,0x32,0x1a,0x4c,0xff,0x48,0x04,0xd3,0xff,0x4e,0x00,0xff,0xff,0x5d,0x28,0xfe,0xff,0x6a,0x57,0xfe,0xff,0x6c,0x5a,0xff,0xff,0x73,0x5c,0xff,0xff,0x3c,0x2e,0x93,0xff,0x2a,0x1d,0x78,0xff,0x42,0x0a,0xbe,0xff,0x2e,0x1a,0x50,0xff,0x39,0x3f,0x4a,0xff,0x29,0x2e,0x40,0xff,0x16,0x1e,0x37,0xff,0x55,0x6a,0x88,0xff,0xc1,0xca,0xd3,0xff,0xab,0xc1,0xd6,0xff,0xb7,0xca,0xd9,0xff,0x9e,0xb5,0xce,0xff,0xab,0xc3,0xd6,0xff,0x93,0xab,0xc4,0xff,0xa2,0xba,0xd0,0xff,0x82,0x9b,0xb1,0xff,0x93,0xaa,0xc2,0xff,0x70,0x87,0xa8,0xff,0x81,0x95,0xb1,0xff,0x39,0x35,0x30,0xff,0x29,0x15,0x01,0xff,0x2e,0x21,0x0d,0xff,0x2c,0x1f,0x0c,0xff,0x2c,0x1f,0x0d,0xff,0x2c,0x1e,0x0b,0xff,0x2a,0x1d,0x0c,0xff,0x2a,0x1d,0x0c,0xff,0x2a,0x1c,0x0c,0xff,0x28,0x1c,0x0c,0xff,0x27,0x1b,0x0a,0xff,0x26,0x1a,0x09,0xff,0x27,0x1c,0x0a,0xff,0x26,0x1a,0x08,0xff,0x26,0x1a,0x09,0xff,0x25,0x19,0x09,0xff,0x24,0x19,0x09,0xff,0x23,0x19,0x08,0xff,0x23,0x18,0x08,0xff,0x24,0x18,0x07,0xff,0x24,0x18,0x07,0xff,0x25,0x17,0x07,0xff,0x1c,0x0f,0x00,0xff,0x5d,0x54,0x47,0xc4,0xfc,0xfc,0xfc,0x00,0xff,0xff,0xff,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xef,0xf5,0x00,0xff,0xff,0xff,0x00,0xf2,0xee,0xeb,0xae,0x7c,0x52,0x33,0xff,0x5e,0x2c,0x06,0xff,0x62,0x33,0x0c,0xff,0x62,0x34,0x0c,0xff,0x60,0x32,0x09,0xff,0x60,0x32,0x08,0xff,0x60,0x32,0x08,0xff,0x60,0x31,0x08,0xff,0x60,0x31,0x08,0xff,0x5f,0x32,0x08,0xff,0x5e,0x33,0x09,0xff,0x5c,0x32,0x08,0xff,0x5b,0x31,0x06,0xff,0x5c,0x33,0x07,0xff,0x59,0x32,0x06,0xff,0x58,0x30,0x06,0xff,0x50,0x2d,0x04,0xff,0x6b,0x36,0x03,0xff,0x70,0x32,0x01,0xff,0x33,0x14,0x00,0xff,0x49,0x20,0x01,0xff,0x92,0x44,0x02,0xff,0xa8,0x59,0x02,0xff,0x93,0x51,0x02,0xff,0x92,0x52,0x01,0xff,0x8b,0x51,0x02,0xff,0x64,0x3b,0x03,0xff,0x79,0x4a,0x02,0xff,0x8e,0x55,0x03,0xff,0x57,0x35,0x02,0xff,0x2b,0x1f,0x00,0xff,0x5a,0x38,0x02,0xff,0x86,0x4f,0x02,0xff,0x8a,0x52,0x02,0xff,0x79,0x4c,0x03,0xff,0x47,0x2a,0x02,0xff,0x3c,0x1e,0x01,0xff,0x3e,0x1b,0x01,0xff,0x41,0x1d,0x02,0xff,0x2d,0x12,0x02,0xff,0x33,0x15,0x03,0xff,0x4b,0x2f,0x07,0xff,0x26,0x17,0x05,0xff,0x05,0x02,0x02,0xff,0x09,0x03,0x03,0xff,0x0f,0x09,0x04,0xff,0x22,0x15,0x02,0xff,0x45,0x3c,0x38,0xff,0x4e,0x49,0x32,0xff,0x1b,0x11,0x06,0xff,0x0f,0x07,0x00,0xff,0x0e,0x08,0x02,0xff,0x11,0x0a,0x01,0xff,0x0d,0x07,0x01,0xff,0x16,0x13,0x10,0xff,0x30,0x30,0x2c,0xff,0x37,0x39,0x34,0xff,0x20,0x1f,0x1c,0xff,0x02,0x01,0x01,0xff,0x07,0x04,0x00,0xff,0x37,0x35,0x02,0xff,0x53,0x52,0x03,0xff,0x50,0x51,0x02,0xff,0x48,0x4e,0x01,0xff,0x3f,0x44,0x01,0xff,0x31,0x39,0x04,0xff,0x25,0x2d,0x0e,0xff,0x21,0x28,0x14,0xff,0x1f,0x28,0x19,0xff,0x1f,0x27,0x1d,0xff,0x23,0x2a,0x22,0xff,0x25,0x2c,0x28,0xff,0x27,0x30,0x30,0xff,0x32,0x3b,0x40,0xff,0x3f,0x49,0x57,0xff,0x5f,0x6d,0x89,0xff,0x85,0x9a,0xbe,0xff,0xb2,0xc7,0xe6,0xff,0xcb,0xdb,0xf3,0xff,0xd5,0xe5,0xf8,0xff,0xed,0xfa,0xff,0xff,0xb5,0xc3,0xdd,0xff,0x30,0x43,0xb6,0xff,0x36,0x5b,0xe3,0xff,0x40,0x6e,0xf4,0xff,0x33,0x50,0xdc,0xff,0x2f,0x34,0x78,0xff,0x33,0x16,0x6e,0xff,0x4a,0x03,0xf0,0xff,0x5f,0x27,0xff,0xff,0x7d,0x6b,0xfe,0xff,0x8b,0x8c,0xfe,0xff,0x94,0x96,0xff,0xff,0x74,0x70,0xdc,0xff,0x2a,0x20,0x84,0xff,0x3a,0x23,0xa4,0xff,0x57,0x27,0xc6,0xff,0x40,0x2c,0x69,0xff,0x25,0x29,0x37,0xff,0x06,0x10,0x27,0xff,0x3d,0x65,0x8b,0xff,0xb4,0xc7,0xdd,0xff,0xb3,0xc6,0xd8,0xff,0xab,0xc2,0xd2,0xff,0xb0,0xc6,0xd9,0xff,0xa6,0xbb,0xce,0xff,0xaa,0xc3,0xd2,0xff,0x92,0xaa,0xc2,0xff,0x7e,0x97,0xb4,0xff,0x97,0xaf,0xc8,0xff,0x8b,0xa9,0xc1,0xff,0x8a,0x9e,0xb7,0xff,0x35,0x2c,0x2b,0xff,0x2a,0x1b,0x02,0xff,0x32,0x21,0x10,0xff,0x2d,0x20,0x0c,0xff,0x2c,0x1f,0x0a,0xff,0x2d,0x1f,0x0c,0xff,0x2b,0x1d,0x0c,0xff,0x29,0x1e,0x0c,0xff,0x28,0x1b,0x0b,0xff,0x27,0x1b,0x0b,0xff,0x28,0x1c,0x0c,0xff,0x27,0x1b,0x0b,0xff,0x25,0x19,0x0a,0xff,0x25,0x19,0x08,0xff,0x25,0x19,0x08,0xff,0x26,0x19,0x09,0xff,0x25,0x18,0x08,0xff,0x24,0x18,0x08,0xff,0x24,0x17,0x07,0xff,0x24,0x17,0x07,0xff,0x24,0x17,0x08,0xff,0x23,0x17,0x07,0xff,0x23,0x17,0x07,0xff,0x1e,0x12,0x01,0xff,0x33,0x27,0x19,0xf3,0xda,0xd7,0xd5,0x24,0xff,0xff,0xff,0x00,0xff,0xfa,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf9,0x00,0xff,0xf5,0xf9,0x00,0xff,0xff,0xff,0x11,0xd8,0xca,0xc0,0xe3,0x68,0x36,0x10,0xff,0x63,0x30,0x0a,0xff,0x64,0x33,0x0d,0xff,0x62,0x32,0x0a,0xff,0x61,0x32,0x08,0xff,0x60,0x31,0x06,0xff,0x61,0x32,0x06,0xff,0x63,0x33,0x08,0xff,0x61,0x31,0x05,0xff,0x60,0x32,0x06,0xff,0x60,0x33,0x07,0xff,0x5e,0x32,0x07,0xff,0x5c,0x32,0x06,0xff,0x5b,0x31,0x05,0xff,0x59,0x31,0x05,0xff,0x59,0x31,0x06,0xff,0x53,0x2e,0x05,0xff,0x69,0x37,0x04,0xff,0x6f,0x33,0x01,0xff,0x38,0x16,0x00,0xff,0x58,0x24,0x01,0xff,0x97,0x48,0x01,0xff,0xa2,0x57,0x01,0xff,0x88,0x4c,0x01,0xff,0x94,0x57,0x03,0xff,0x74,0x45,0x02,0xff,0x6e,0x41,0x02,0xff,0x78,0x47,0x03,0xff,0x51,0x32,0x01,0xff,0x2c,0x1e,0x00,0xff,0x53,0x35,0x01,0xff,0x87,0x4d,0x01,0xff,0x8c,0x51,0x02,0xff,0x86,0x50,0x02,0xff,0x6b,0x41,0x00,0xff,0x5a,0x37,0x04,0xff,0x3f,0x1a,0x03,0xff,0x3f,0x1a,0x02,0xff,0x36,0x17,0x02,0xff,0x25,0x0d,0x01,0xff,0x50,0x2a,0x01,0xff,0x24,0x10,0x02,0xff,0x15,0x0e,0x02,0xff,0x10,0x08,0x02,0xff,0x07,0x02,0x01,0xff,0x15,0x0c,0x04,0xff,0x1c,0x14,0x06,0xff,0x45,0x41,0x3d,0xff,0x2d,0x2c,0x20,0xff,0x3c,0x38,0x27,0xff,0x09,0x05,0x01,0xff,0x0c,0x08,0x01,0xff,0x0c,0x07,0x01,0xff,0x0c,0x07,0x01,0xff,0x0a,0x03,0x01,0xff,0x06,0x04,0x01,0xff,0x1f,0x20,0x1a,0xff,0x53,0x58,0x53,0xff,0x4f,0x55,0x53,0xff,0x18,0x1a,0x19,0xff,0x0c,0x0b,0x0b,0xff,0x29,0x2a,0x0e,0xff,0x3a,0x3c,0x02,0xff,0x46,0x49,0x02,0xff,0x3f,0x44,0x01,0xff,0x37,0x3d,0x04,0xff,0x2c,0x33,0x11,0xff,0x26,0x2d,0x19,0xff,0x1f,0x27,0x1b,0xff,0x1c,0x24,0x1d,0xff,0x1e,0x25,0x21,0xff,0x22,0x2a,0x27,0xff,0x21,0x2a,0x28,0xff,0x24,0x2e,0x30,0xff,0x34,0x3e,0x46,0xff,0x4e,0x5a,0x6f,0xff,0x73,0x84,0xa3,0xff,0x9f,0xb4,0xd3,0xff,0xbe,0xd0,0xeb,0xff,0xd1,0xe0,0xf6,0xff,0xdf,0xea,0xfd,0xff,0xf8,0xfe,0xff,0xff,0x8b,0xa8,0xec,0xff,0x2c,0x62,0xe5,0xff,0x4c,0x88,0xf8,0xff,0x3f,0x69,0xeb,0xff,0x2d,0x3d,0x98,0xff,0x2d,0x15,0x7c,0xff,0x4d,0x02,0xfe,0xff,0x6e,0x4e,0xfd,0xff,0x8f,0x94,0xfd,0xff,0x96,0x9a,0xff,0xff,0x98,0x9a,0xff,0xff,0x4d,0x48,0x95,0xff,0x69,0x4a,0xab,0xff,0x7f,0x57,0x8e,0xff,0x84,0x58,0x6f,0xff,0x9e,0x87,0xc2,0xff,0xd9,0xdf,0xf3,0xff,0x40,0x4b,0x61,0xff,0x38,0x79,0xa7,0xff,0xb3,0xd2,0xe7,0xff,0xa6,0xbb,0xcf,0xff,0xbc,0xd0,0xdf,0xff,0x90,0xa7,0xbc,0xff,0xb9,0xd2,0xe1,0xff,0xad,0xc5,0xd5,0xff,0x8b,0xa4,0xbb,0xff,0x82,0x9c,0xb7,0xff,0x90,0xa9,0xc2,0xff,0x80,0x96,0xb3,0xff,0x4d,0x4c,0x4c,0xff,0x25,0x17,0x01,0xff,0x2d,0x20,0x0e,0xff,0x2e,0x1f,0x0d,0xff,0x2e,0x1e,0x09,0xff,0x2d,0x20,0x0c,0xff,0x2c,0x1e,0x0c,0xff,0x2a,0x1c,0x0b,0xff,0x29,0x1d,0x0b,0xff,0x27,0x1a,0x0b,0xff,0x27,0x1b,0x0b,0xff,0x27,0x1b,0x0b,0xff,0x27,0x1a,0x0a,0xff,0x25,0x18,0x09,0xff,0x26,0x1a,0x08,0xff,0x25,0x19,0x07,0xff,0x24,0x18,0x08,0xff,0x24,0x17,0x07,0xff,0x25,0x17,0x07,0xff,0x24,0x17,0x07,0xff,0x24,0x17,0x07,0xff,0x23,0x17,0x06,0xff,0x23,0x17,0x07,0xff,0x22,0x16,0x06,0xff,0x21,0x14,0x04,0xff,0x1f,0x11,0x01,0xff,0xab,0xa6,0xa0,0x5a,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xf8,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x40,0xb3,0x99,0x84,0xff,0x60,0x29,0x00,0xff,0x65,0x32,0x0c,0xff,0x65,0x33,0x0d,0xff,0x62,0x32,0x08,0xff,0x63,0x32,0x08,0xff,0x64,0x32,0x07,0xff,0x63,0x32,0x04,0xff,0x61,0x31,0x04,0xff,0x61,0x31,0x04,0xff,0x60,0x30,0x04,0xff,0x5f,0x31,0x04,0xff,0x5e,0x31,0x04,0xff,0x5c,0x31,0x04,0xff,0x5b,0x31,0x04,0xff,0x5a,0x31,0x04,0xff,0x5a,0x31,0x06,0xff,0x55,0x2f,0x04,0xff,0x64,0x37,0x04,0xff,0x74,0x39,0x04,0xff,0x3c,0x18,0x00,0xff,0x60,0x28,0x03,0xff,0x99,0x4d,0x03,0xff,0x9e,0x57,0x01,0xff,0x8a,0x4d,0x03,0xff,0x82,0x4d,0x04,0xff,0x65,0x3c,0x02,0xff,0x53,0x32,0x01,0xff,0x43,0x29,0x01,0xff,0x35,0x22,0x01,0xff,0x56,0x34,0x01,0xff,0x88,0x4d,0x02,0xff,0x92,0x52,0x03,0xff,0x8c,0x50,0x02,0xff,0x6f,0x43,0x01,0xff,0x6c,0x44,0x03,0xff,0x4c,0x27,0x02,0xff,0x39,0x15,0x01,0xff,0x3b,0x17,0x01,0xff,0x2a,0x11,0x03,0xff,0x39,0x1b,0x04,0xff,0x58,0x31,0x02,0xff,0x56,0x32,0x04,0xff,0x09,0x04,0x02,0xff,0x11,0x0a,0x02,0xff,0x0e,0x08,0x02,0xff,0x08,0x02,0x01,0xff,0x0c,0x08,0x09,0xff,0x49,0x46,0x42,0xff,0x16,0x16,0x11,0xff,0x52,0x53,0x44,0xff,0x0f,0x0c,0x0a,0xff,0x0c,0x06,0x00,0xff,0x0d,0x08,0x03,0xff,0x0b,0x06,0x01,0xff,0x07,0x02,0x00,0xff,0x05,0x01,0x00,0xff,0x00,0x00,0x00,0xff,0x05,0x06,0x04,0xff,0x4a,0x51,0x48,0xff,0x51,0x56,0x52,0xff,0x17,0x14,0x11,0xff,0x07,0x04,0x06,0xff,0x0a,0x09,0x02,0xff,0x28,0x29,0x04,0xff,0x3e,0x40,0x02,0xff,0x3a,0x3d,0x02,0xff,0x35,0x3a,0x12,0xff,0x2a,0x33,0x1d,0xff,0x22,0x2b,0x20,0xff,0x1f,0x27,0x22,0xff,0x20,0x26,0x24,0xff,0x20,0x27,0x27,0xff,0x23,0x2a,0x2b,0xff,0x20,0x28,0x2b,0xff,0x2a,0x32,0x38,0xff,0x3c,0x45,0x52,0xff,0x62,0x71,0x88,0xff,0x87,0x9b,0xb8,0xff,0xaa,0xbf,0xdc,0xff,0xc4,0xd6,0xf0,0xff,0xd1,0xe3,0xf7,0xff,0xe5,0xf1,0xfe,0xff,0xe1,0xef,0xfd,0xff,0x66,0x9a,0xf1,0xff,0x54,0x99,0xf8,0xff,0x5b,0x90,0xfb,0xff,0x3a,0x52,0xc4,0xff,0x1e,0x19,0x5c,0xff,0x47,0x00,0xdf,0xff,0x66,0x3c,0xff,0xff,0x80,0x80,0xfe,0xff,0x8d,0x8e,0xff,0xff,0x8d,0x82,0xf6,0xff,0x72,0x42,0x75,0xff,0x7b,0x44,0x63,0xff,0x73,0x46,0x6c,0xff,0x59,0x34,0x64,0xff,0x45,0x3c,0x86,0xff,0xa8,0xbd,0xf3,0xff,0x61,0x6a,0x7b,0xff,0x16,0x4b,0x78,0xff,0x78,0xb9,0xeb,0xff,0xc2,0xd3,0xdf,0xff,0x9b,0xb0,0xc6,0xff,0xac,0xc1,0xd2,0xff,0x87,0xa0,0xb7,0xff,0x89,0xa1,0xb7,0xff,0x87,0xa0,0xb5,0xff,0x89,0xa4,0xbc,0xff,0x84,0x9e,0xba,0xff,0x58,0x5c,0x61,0xff,0x22,0x11,0x00,0xff,0x2d,0x20,0x0b,0xff,0x30,0x20,0x0c,0xff,0x30,0x1f,0x0a,0xff,0x2d,0x1e,0x0a,0xff,0x2d,0x1f,0x0b,0xff,0x2b,0x1e,0x0c,0xff,0x2b,0x1d,0x0b,0xff,0x29,0x1d,0x0b,0xff,0x27,0x1b,0x0b,0xff,0x27,0x1b,0x0b,0xff,0x28,0x1c,0x0c,0xff,0x27,0x1b,0x0b,0xff,0x26,0x1a,0x09,0xff,0x28,0x1c,0x09,0xff,0x25,0x19,0x08,0xff,0x25,0x18,0x08,0xff,0x25,0x18,0x08,0xff,0x26,0x18,0x08,0xff,0x25,0x18,0x08,0xff,0x25,0x17,0x08,0xff,0x24,0x17,0x09,0xff,0x24,0x17,0x07,0xff,0x23,0x17,0x06,0xff,0x23,0x17,0x08,0xff,0x19,0x0c,0x00,0xff,0x74,0x6d,0x63,0x9a,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xfe,0xfe,0xfe,0x78,0x94,0x6d,0x50,0xff,0x61,0x29,0x00,0xff,0x65,0x31,0x08,0xff,0x66,0x33,0x09,0xff,0x64,0x32,0x08,0xff,0x63,0x32,0x07,0xff,0x65,0x33,0x06,0xff,0x65,0x32,0x05,0xff,0x62,0x31,0x03,0xff,0x61,0x30,0x03,0xff,0x61,0x32,0x05,0xff,0x60,0x31,0x05,0xff,0x5d,0x30,0x03,0xff,0x5c,0x31,0x04,0xff,0x5b,0x31,0x04,0xff,0x5a,0x30,0x03,0xff,0x59,0x30,0x04,0xff,0x57,0x2f,0x04,0xff,0x5b,0x32,0x03,0xff,0x7c,0x3e,0x03,0xff,0x47,0x1b,0x01,0xff,0x64,0x2a,0x02,0xff,0x9f,0x51,0x02,0xff,0x9f,0x59,0x02,0xff,0x92,0x54,0x03,0xff,0x6c,0x41,0x01,0xff,0x58,0x36,0x01,0xff,0x51,0x31,0x01,0xff,0x57,0x34,0x02,0xff,0x66,0x3f,0x02,0xff,0x89,0x50,0x01,0xff,0x96,0x54,0x01,0xff,0x8f,0x54,0x01,0xff,0x80,0x4a,0x00,0xff,0x76,0x49,0x01,0xff,0x63,0x38,0x04,0xff,0x3d,0x15,0x02,0xff,0x3e,0x18,0x01,0xff,0x2d,0x12,0x01,0xff,0x23,0x0c,0x02,0xff,0x33,0x19,0x06,0xff,0x31,0x19,0x04,0xff,0x34,0x1d,0x03,0xff,0x09,0x05,0x01,0xff,0x0e,0x08,0x02,0xff,0x20,0x16,0x05,0xff,0x0b,0x06,0x00,0xff,0x19,0x15,0x0d,0xff,0x3e,0x3b,0x37,0xff,0x04,0x00,0x00,0xff,0x4e,0x47,0x39,0xff,0x23,0x23,0x22,0xff,0x09,0x01,0x00,0xff,0x0d,0x06,0x02,0xff,0x27,0x24,0x1d,0xff,0x31,0x31,0x29,0xff,0x27,0x28,0x21,0xff,0x24,0x26,0x22,0xff,0x22,0x23,0x1e,0xff,0x15,0x14,0x0d,0xff,0x11,0x0f,0x08,0xff,0x08,0x06,0x00,0xff,0x08,0x05,0x03,0xff,0x06,0x03,0x03,0xff,0x06,0x04,0x01,0xff,0x23,0x23,0x03,0xff,0x3e,0x41,0x03,0xff,0x36,0x3a,0x10,0xff,0x2e,0x35,0x1f,0xff,0x25,0x2e,0x27,0xff,0x23,0x2a,0x28,0xff,0x23,0x29,0x28,0xff,0x1e,0x25,0x27,0xff,0x23,0x2a,0x2d,0xff,0x24,0x2a,0x2f,0xff,0x25,0x2b,0x30,0xff,0x2a,0x32,0x3b,0xff,0x47,0x53,0x65,0xff,0x68,0x79,0x94,0xff,0x8e,0xa3,0xc1,0xff,0xb0,0xc3,0xe0,0xff,0xc8,0xd9,0xf1,0xff,0xd4,0xe5,0xfa,0xff,0xe9,0xf3,0xfe,0xff,0xc8,0xe2,0xfe,0xff,0x58,0xa0,0xf8,0xff,0x54,0x9a,0xfe,0xff,0x62,0x85,0xf4,0xff,0x28,0x33,0x79,0xff,0x2e,0x00,0xa2,0xff,0x5f,0x27,0xff,0xff,0x6e,0x63,0xff,0xff,0x84,0x76,0xfd,0xff,0x81,0x53,0x9b,0xff,0x4f,0x2b,0x40,0xff,0x2a,0x1f,0x3e,0xff,0x20,0x18,0x42,0xff,0x1d,0x19,0x43,0xff,0x1e,0x1e,0x56,0xff,0x51,0x60,0x99,0xff,0x1e,0x22,0x33,0xff,0x0e,0x21,0x39,0xff,0x29,0x73,0xa9,0xff,0x8f,0xb7,0xd7,0xff,0xc6,0xd8,0xe4,0xff,0xab,0xc2,0xd2,0xff,0x79,0x91,0xa7,0xff,0x8b,0xa3,0xb9,0xff,0x7b,0x93,0xad,0xff,0x93,0xac,0xc9,0xff,0x53,0x5c,0x66,0xff,0x27,0x19,0x07,0xff,0x2f,0x1f,0x0a,0xff,0x31,0x21,0x0c,0xff,0x2f,0x20,0x0a,0xff,0x2e,0x20,0x0a,0xff,0x2e,0x1f,0x0a,0xff,0x2d,0x1e,0x0a,0xff,0x2c,0x1e,0x0c,0xff,0x2b,0x1d,0x0c,0xff,0x28,0x1c,0x0a,0xff,0x28,0x1c,0x0b,0xff,0x26,0x1a,0x0a,0xff,0x26,0x1a,0x0a,0xff,0x27,0x1a,0x0a,0xff,0x27,0x1a,0x0a,0xff,0x26,0x1a,0x08,0xff,0x25,0x19,0x08,0xff,0x27,0x19,0x0a,0xff,0x25,0x18,0x09,0xff,0x24,0x18,0x08,0xff,0x24,0x18,0x08,0xff,0x25,0x18,0x09,0xff,0x23,0x16,0x08,0xff,0x23,0x16,0x06,0xff,0x23,0x17,0x07,0xff,0x23,0x17,0x07,0xff,0x1d,0x0f,0x00,0xff,0x4b,0x3f,0x34,0xd0,0xf2,0xf1,0xf0,0x04,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xef,0xe9,0xe4,0xad,0x7b,0x4b,0x26,0xff,0x63,0x2c,0x00,0xff,0x64,0x31,0x05,0xff,0x66,0x31,0x07,0xff,0x67,0x33,0x09,0xff,0x65,0x33,0x07,0xff,0x63,0x31,0x04,0xff,0x63,0x32,0x04,0xff,0x62,0x33,0x04,0xff,0x63,0x32,0x04,0xff,0x62,0x32,0x06,0xff,0x60,0x32,0x05,0xff,0x5d,0x31,0x03,0xff,0x5c,0x31,0x04,0xff,0x5c,0x31,0x04,0xff,0x5b,0x31,0x04,0xff,0x58,0x2f,0x02,0xff,0x5a,0x31,0x04,0xff,0x59,0x32,0x03,0xff,0x7e,0x3f,0x03,0xff,0x54,0x20,0x00,0xff,0x68,0x2c,0x01,0xff,0xa8,0x5a,0x01,0xff,0xa4,0x5e,0x03,0xff,0x7f,0x49,0x02,0xff,0x65,0x3d,0x01,0xff,0x63,0x3b,0x02,0xff,0x67,0x3f,0x00,0xff,0x81,0x4b,0x01,0xff,0x94,0x53,0x01,0xff,0x95,0x55,0x02,0xff,0x87,0x4c,0x02,0xff,0x80,0x4a,0x02,0xff,0x80,0x4d,0x02,0xff,0x7a,0x4b,0x03,0xff,0x42,0x1e,0x02,0xff,0x3a,0x16,0x00,0xff,0x3c,0x16,0x02,0xff,0x2f,0x16,0x04,0xff,0x37,0x1d,0x03,0xff,0x0f,0x05,0x02,0xff,0x17,0x0f,0x04,0xff,0x0a,0x05,0x03,0xff,0x0d,0x07,0x00,0xff,0x12,0x0c,0x01,0xff,0x21,0x14,0x02,0xff,0x0e,0x06,0x00,0xff,0x25,0x21,0x19,0xff,0x2b,0x2b,0x28,0xff,0x00,0x00,0x00,0xff,0x46,0x3c,0x2e,0xff,0x3f,0x3f,0x3b,0xff,0x06,0x00,0x00,0xff,0x0e,0x08,0x03,0xff,0x1e,0x1c,0x14,0xff,0x38,0x39,0x2e,0xff,0x48,0x4b,0x40,0xff,0x5e,0x65,0x5c,0xff,0x41,0x45,0x3d,0xff,0x0e,0x09,0x03,0xff,0x0b,0x06,0x00,0xff,0x08,0x08,0x01,0xff,0x09,0x08,0x03,0xff,0x08,0x06,0x03,0xff,0x05,0x06,0x03,0xff,0x06,0x06,0x04,0xff,0x1f,0x1c,0x02,0xff,0x36,0x38,0x0d,0xff,0x35,0x3a,0x21,0xff,0x2c,0x34,0x2e,0xff,0x24,0x2b,0x2e,0xff,0x21,0x28,0x2d,0xff,0x21,0x28,0x2d,0xff,0x21,0x27,0x2d,0xff,0x21,0x27,0x2e,0xff,0x23,0x28,0x2f,0xff,0x25,0x2c,0x35,0xff,0x32,0x3b,0x49,0xff,0x4f,0x5b,0x70,0xff,0x79,0x89,0xa5,0xff,0x9b,0xaf,0xcc,0xff,0xbb,0xce,0xe9,0xff,0xcb,0xdb,0xf4,0xff,0xd7,0xe5,0xfa,0xff,0xee,0xf6,0xfe,0xff,0xb1,0xd9,0xfc,0xff,0x5e,0xac,0xfb,0xff,0x71,0x9d,0xfd,0xff,0x65,0x7b,0xc4,0xff,0x3e,0x3d,0x85,0xff,0x41,0x08,0xf2,0xff,0x71,0x48,0xf9,0xff,0x74,0x4b,0x8b,0xff,0x4c,0x27,0x35,0xff,0x23,0x1b,0x2d,0xff,0x15,0x13,0x29,0xff,0x11,0x0c,0x22,0xff,0x1a,0x1a,0x40,0xff,0x50,0x59,0x88,0xff,0x57,0x65,0x7f,0xff,0x14,0x16,0x1b,0xff,0x0c,0x0c,0x1e,0xff,0x14,0x55,0x85,0xff,0x7f,0xad,0xd4,0xff,0xb4,0xc8,0xd9,0xff,0x92,0xa9,0xbd,0xff,0x92,0xa9,0xc0,0xff,0x77,0x8f,0xa7,0xff,0x86,0x9f,0xba,0xff,0x61,0x6c,0x7b,0xff,0x2f,0x24,0x13,0xff,0x2b,0x1e,0x04,0xff,0x2e,0x21,0x0c,0xff,0x30,0x20,0x0a,0xff,0x2d,0x1f,0x09,0xff,0x2e,0x20,0x0a,0xff,0x2e,0x1f,0x0a,0xff,0x2c,0x1e,0x0a,0xff,0x2a,0x1d,0x0b,0xff,0x2a,0x1c,0x0a,0xff,0x28,0x1c,0x0a,0xff,0x28,0x1c,0x0a,0xff,0x26,0x1a,0x0a,0xff,0x26,0x1b,0x0b,0xff,0x27,0x1a,0x0a,0xff,0x26,0x19,0x0a,0xff,0x27,0x1a,0x08,0xff,0x25,0x19,0x08,0xff,0x25,0x19,0x09,0xff,0x25,0x19,0x08,0xff,0x24,0x18,0x07,0xff,0x25,0x18,0x08,0xff,0x25,0x18,0x08,0xff,0x24,0x17,0x07,0xff,0x23,0x17,0x07,0xff,0x24,0x18,0x06,0xff,0x23,0x17,0x07,0xff,0x20,0x13,0x03,0xff,0x2f,0x22,0x14,0xf2,0xd3,0xd0,0xcd,0x22,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x0a,0xdc,0xcf,0xc5,0xdb,0x6e,0x37,0x0d,0xff,0x65,0x2f,0x02,0xff,0x66,0x32,0x05,0xff,0x67,0x32,0x07,0xff,0x65,0x32,0x07,0xff,0x65,0x32,0x06,0xff,0x64,0x31,0x04,0xff,0x65,0x32,0x04,0xff,0x63,0x32,0x04,0xff,0x63,0x31,0x05,0xff,0x62,0x31,0x06,0xff,0x5f,0x30,0x04,0xff,0x5e,0x32,0x05,0xff,0x5d,0x32,0x05,0xff,0x5b,0x30,0x03,0xff,0x5b,0x31,0x04,0xff,0x5b,0x32,0x02,0xff,0x5a,0x30,0x02,0xff,0x56,0x2f,0x01,0xff,0x76,0x3c,0x03,0xff,0x62,0x2a,0x01,0xff,0x77,0x35,0x01,0xff,0xb1,0x64,0x01,0xff,0x98,0x58,0x02,0xff,0x6a,0x3d,0x02,0xff,0x70,0x43,0x02,0xff,0x78,0x47,0x00,0xff,0x84,0x4d,0x01,0xff,0x92,0x55,0x03,0xff,0x90,0x52,0x02,0xff,0x7c,0x49,0x02,0xff,0x62,0x3b,0x02,0xff,0x6f,0x43,0x02,0xff,0x8c,0x54,0x03,0xff,0x5b,0x33,0x03,0xff,0x32,0x11,0x01,0xff,0x37,0x15,0x00,0xff,0x32,0x13,0x01,0xff,0x32,0x19,0x04,0xff,0x58,0x3e,0x0a,0xff,0x16,0x0c,0x04,0xff,0x13,0x08,0x03,0xff,0x10,0x09,0x01,0xff,0x13,0x0a,0x02,0xff,0x1d,0x12,0x01,0xff,0x14,0x0c,0x02,0xff,0x04,0x00,0x00,0xff,0x27,0x22,0x1b,0xff,0x20,0x21,0x1d,0xff,0x05,0x00,0x00,0xff,0x15,0x10,0x08,0xff,0x1a,0x17,0x12,0xff,0x08,0x03,0x01,0xff,0x0a,0x05,0x01,0xff,0x04,0x01,0x00,0xff,0x05,0x01,0x00,0xff,0x0c,0x09,0x04,0xff,0x1e,0x1b,0x14,0xff,0x13,0x0c,0x07,0xff,0x0b,0x07,0x02,0xff,0x09,0x07,0x02,0xff,0x09,0x07,0x02,0xff,0x08,0x09,0x03,0xff,0x09,0x07,0x04,0xff,0x09,0x07,0x04,0xff,0x0b,0x0a,0x06,0xff,0x08,0x05,0x05,0xff,0x14,0x12,0x02,0xff,0x2d,0x30,0x19,0xff,0x31,0x38,0x31,0xff,0x2b,0x32,0x38,0xff,0x25,0x2c,0x35,0xff,0x22,0x29,0x33,0xff,0x21,0x27,0x30,0xff,0x21,0x26,0x31,0xff,0x21,0x26,0x32,0xff,0x22,0x28,0x34,0xff,0x23,0x2a,0x38,0xff,0x3f,0x49,0x5a,0xff,0x65,0x72,0x8b,0xff,0x87,0x97,0xb6,0xff,0xa4,0xb9,0xd7,0xff,0xbd,0xd1,0xeb,0xff,0xcf,0xdf,0xf7,0xff,0xda,0xe9,0xfc,0xff,0xea,0xf2,0xfe,0xff,0xaf,0xd8,0xfb,0xff,0x82,0xb0,0xf8,0xff,0x9a,0xb6,0xe7,0xff,0xdc,0xe8,0xeb,0xff,0x8b,0x6b,0xd2,0xff,0x6f,0x30,0x74,0xff,0x3f,0x2a,0x32,0xff,0x22,0x1a,0x25,0xff,0x1c,0x14,0x26,0xff,0x0b,0x04,0x14,0xff,0x32,0x38,0x45,0xff,0x92,0xa5,0xb1,0xff,0xa6,0xbd,0xd2,0xff,0x8f,0xa7,0xc1,0xff,0x52,0x5b,0x65,0xff,0x05,0x03,0x08,0xff,0x10,0x46,0x71,0xff,0x73,0xad,0xda,0xff,0x86,0x9b,0xb0,0xff,0x90,0xa7,0xc0,0xff,0x8a,0xa1,0xb7,0xff,0x7b,0x92,0xb0,0xff,0x76,0x87,0x98,0xff,0x2b,0x20,0x14,0xff,0x2c,0x19,0x04,0xff,0x31,0x21,0x0e,0xff,0x2e,0x20,0x0b,0xff,0x2f,0x20,0x09,0xff,0x2d,0x1f,0x09,0xff,0x2e,0x20,0x0a,0xff,0x2e,0x1f,0x0a,0xff,0x2b,0x1e,0x09,0xff,0x2a,0x1c,0x0a,0xff,0x2a,0x1b,0x0a,0xff,0x28,0x1b,0x0a,0xff,0x27,0x1b,0x09,0xff,0x27,0x1b,0x0a,0xff,0x26,0x1b,0x0a,0xff,0x26,0x1b,0x09,0xff,0x26,0x19,0x09,0xff,0x27,0x1a,0x09,0xff,0x25,0x19,0x08,0xff,0x25,0x19,0x09,0xff,0x25,0x18,0x08,0xff,0x25,0x19,0x08,0xff,0x24,0x18,0x08,0xff,0x24,0x18,0x07,0xff,0x24,0x17,0x07,0xff,0x22,0x16,0x06,0xff,0x24,0x18,0x05,0xff,0x23,0x16,0x06,0xff,0x22,0x15,0x05,0xff,0x21,0x13,0x05,0xff,0xb3,0xae,0xa9,0x4e,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x26,0xc3,0xab,0x99,0xf6,0x66,0x2b,0x00,0xff,0x66,0x30,0x03,0xff,0x67,0x31,0x05,0xff,0x64,0x30,0x04,0xff,0x64,0x31,0x05,0xff,0x64,0x31,0x05,0xff,0x62,0x30,0x03,0xff,0x64,0x31,0x03,0xff,0x63,0x32,0x05,0xff,0x61,0x30,0x05,0xff,0x62,0x31,0x05,0xff,0x60,0x31,0x05,0xff,0x61,0x32,0x06,0xff,0x5e,0x32,0x04,0xff,0x5b,0x32,0x02,0xff,0x5b,0x31,0x02,0xff,0x5b,0x31,0x02,0xff,0x5b,0x31,0x02,0xff,0x58,0x2f,0x02,0xff,0x69,0x37,0x02,0xff,0x6d,0x34,0x01,0xff,0x84,0x3d,0x02,0xff,0xaf,0x65,0x03,0xff,0x77,0x44,0x02,0xff,0x5d,0x37,0x02,0xff,0x6b,0x3e,0x01,0xff,0x7c,0x49,0x02,0xff,0x8b,0x52,0x03,0xff,0x81,0x4b,0x02,0xff,0x68,0x3e,0x01,0xff,0x54,0x33,0x01,0xff,0x52,0x33,0x01,0xff,0x78,0x49,0x01,0xff,0x83,0x4f,0x03,0xff,0x3a,0x1b,0x01,0xff,0x33,0x14,0x01,0xff,0x30,0x14,0x01,0xff,0x2f,0x13,0x02,0xff,0x23,0x0d,0x03,0xff,0x4e,0x33,0x08,0xff,0x3c,0x29,0x06,0xff,0x0a,0x04,0x02,0xff,0x13,0x0b,0x01,0xff,0x1c,0x10,0x01,0xff,0x18,0x0e,0x01,0xff,0x0a,0x06,0x01,0xff,0x07,0x01,0x01,0xff,0x29,0x21,0x19,0xff,0x12,0x10,0x0e,0xff,0x06,0x03,0x00,0xff,0x07,0x03,0x01,0xff,0x06,0x02,0x01,0xff,0x0a,0x05,0x01,0xff,0x0b,0x06,0x01,0xff,0x0b,0x07,0x04,0xff,0x0e,0x07,0x04,0xff,0x0a,0x04,0x02,0xff,0x12,0x07,0x04,0xff,0x1a,0x0d,0x09,0xff,0x09,0x06,0x02,0xff,0x08,0x06,0x02,0xff,0x04,0x03,0x00,0xff,0x00,0x00,0x00,0xff,0x05,0x04,0x00,0xff,0x09,0x08,0x04,0xff,0x09,0x0b,0x07,0xff,0x0c,0x0d,0x08,0xff,0x06,0x05,0x07,0xff,0x0c,0x0c,0x08,0xff,0x20,0x23,0x21,0xff,0x2a,0x2f,0x38,0xff,0x28,0x2e,0x3c,0xff,0x24,0x2b,0x38,0xff,0x24,0x2b,0x39,0xff,0x23,0x28,0x38,0xff,0x21,0x27,0x36,0xff,0x22,0x26,0x36,0xff,0x25,0x29,0x39,0xff,0x2e,0x35,0x45,0xff,0x4c,0x56,0x6c,0xff,0x6f,0x7d,0x9c,0xff,0x92,0xa6,0xc7,0xff,0xb1,0xc7,0xe3,0xff,0xc7,0xda,0xf3,0xff,0xd6,0xe6,0xfb,0xff,0xdc,0xe9,0xfc,0xff,0xe6,0xf2,0xfe,0xff,0xc5,0xdd,0xfa,0xff,0xad,0xc9,0xdd,0xff,0xfa,0xff,0xff,0xff,0xdb,0xe0,0xd8,0xff,0x4a,0x3a,0x4c,0xff,0x26,0x1d,0x32,0xff,0x15,0x0d,0x17,0xff,0x0d,0x08,0x16,0xff,0x45,0x4b,0x61,0xff,0xb7,0xc5,0xd3,0xff,0xa9,0xc1,0xd0,0xff,0xb5,0xcb,0xdc,0xff,0xb7,0xd0,0xe1,0xff,0x73,0x8a,0x9e,0xff,0x1f,0x20,0x22,0xff,0x04,0x24,0x46,0xff,0x59,0xa8,0xdb,0xff,0x8d,0xa4,0xb8,0xff,0x8a,0xa3,0xba,0xff,0x7c,0x96,0xb2,0xff,0x7a,0x8d,0xa5,0xff,0x33,0x2c,0x23,0xff,0x2d,0x1c,0x03,0xff,0x30,0x20,0x0d,0xff,0x2f,0x1f,0x0c,0xff,0x2f,0x1f,0x0c,0xff,0x2e,0x1e,0x09,0xff,0x2e,0x1f,0x0a,0xff,0x2e,0x1f,0x09,0xff,0x2d,0x1f,0x0a,0xff,0x2b,0x1e,0x0a,0xff,0x2a,0x1c,0x0a,0xff,0x2a,0x1c,0x0a,0xff,0x29,0x1b,0x09,0xff,0x27,0x1c,0x0a,0xff,0x27,0x1a,0x08,0xff,0x27,0x1a,0x08,0xff,0x26,0x1a,0x08,0xff,0x26,0x1a,0x08,0xff,0x26,0x19,0x08,0xff,0x25,0x19,0x09,0xff,0x26,0x19,0x09,0xff,0x25,0x18,0x09,0xff,0x25,0x17,0x09,0xff,0x25,0x17,0x0a,0xff,0x25,0x17,0x09,0xff,0x24,0x17,0x07,0xff,0x23,0x17,0x06,0xff,0x23,0x17,0x05,0xff,0x23,0x17,0x05,0xff,0x24,0x17,0x06,0xff,0x1a,0x0c,0x00,0xff,0x8a,0x82,0x7a,0x7b,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x4d,0xad,0x8d,0x74,0xff,0x63,0x28,0x00,0xff,0x69,0x31,0x04,0xff,0x66,0x31,0x04,0xff,0x66,0x31,0x04,0xff,0x66,0x32,0x05,0xff,0x64,0x31,0x04,0xff,0x64,0x31,0x04,0xff,0x63,0x31,0x03,0xff,0x62,0x30,0x03,0xff,0x61,0x30,0x04,0xff,0x60,0x30,0x04,0xff,0x60,0x31,0x04,0xff,0x5f,0x2f,0x03,0xff,0x5e,0x31,0x03,0xff,0x5d,0x32,0x03,0xff,0x5b,0x30,0x02,0xff,0x5a,0x30,0x01,0xff,0x5b,0x31,0x02,0xff,0x59,0x30,0x02,0xff,0x5d,0x33,0x01,0xff,0x7a,0x3c,0x02,0xff,0x8f,0x4a,0x02,0xff,0x98,0x55,0x02,0xff,0x5e,0x35,0x02,0xff,0x5c,0x36,0x02,0xff,0x61,0x38,0x01,0xff,0x63,0x3a,0x01,0xff,0x63,0x3d,0x03,0xff,0x53,0x33,0x01,0xff,0x4a,0x2f,0x00,0xff,0x4c,0x2d,0x01,0xff,0x65,0x3d,0x02,0xff,0x8c,0x58,0x01,0xff,0x6b,0x3e,0x02,0xff,0x2c,0x10,0x02,0xff,0x32,0x15,0x01,0xff,0x2b,0x13,0x01,0xff,0x29,0x12,0x01,0xff,0x19,0x0c,0x03,0xff,0x14,0x0a,0x03,0xff,0x20,0x12,0x03,0xff,0x13,0x0a,0x02,0xff,0x1a,0x0f,0x00,0xff,0x1c,0x0f,0x01,0xff,0x10,0x0a,0x01,0xff,0x03,0x02,0x01,0xff,0x0a,0x06,0x01,0xff,0x28,0x21,0x14,0xff,0x08,0x06,0x05,0xff,0x07,0x05,0x01,0xff,0x09,0x06,0x02,0xff,0x08,0x04,0x00,0xff,0x0f,0x0a,0x06,0xff,0x15,0x0e,0x0b,0xff,0x2e,0x25,0x23,0xff,0x23,0x1a,0x17,0xff,0x0b,0x06,0x01,0xff,0x13,0x0a,0x05,0xff,0x13,0x09,0x04,0xff,0x0e,0x0a,0x06,0xff,0x25,0x24,0x20,0xff,0x3e,0x44,0x3c,0xff,0x49,0x50,0x4b,0xff,0x1e,0x1f,0x1e,0xff,0x07,0x06,0x02,0xff,0x0c,0x0d,0x0b,0xff,0x11,0x15,0x17,0xff,0x0e,0x0f,0x0e,0xff,0x07,0x06,0x05,0xff,0x06,0x07,0x07,0xff,0x15,0x19,0x21,0xff,0x23,0x28,0x37,0xff,0x26,0x2d,0x3f,0xff,0x24,0x2b,0x41,0xff,0x24,0x2b,0x41,0xff,0x23,0x29,0x3e,0xff,0x23,0x27,0x3c,0xff,0x22,0x26,0x39,0xff,0x23,0x28,0x39,0xff,0x35,0x3c,0x51,0xff,0x56,0x61,0x7b,0xff,0x83,0x95,0xb4,0xff,0xa6,0xba,0xd9,0xff,0xbb,0xcf,0xea,0xff,0xcc,0xdc,0xf5,0xff,0xcf,0xdf,0xf8,0xff,0xdc,0xe8,0xfb,0xff,0xe0,0xed,0xf8,0xff,0xd9,0xe8,0xee,0xff,0xf8,0xff,0xff,0xff,0xf8,0xff,0xff,0xff,0x6c,0x6c,0x79,0xff,0x1c,0x14,0x27,0xff,0x1b,0x16,0x27,0xff,0x53,0x5c,0x72,0xff,0xbc,0xcb,0xd7,0xff,0x9f,0xb7,0xc4,0xff,0xa4,0xbb,0xcb,0xff,0xaf,0xc7,0xd7,0xff,0x9d,0xb5,0xcc,0xff,0xa9,0xc3,0xde,0xff,0x64,0x6f,0x76,0xff,0x00,0x0e,0x1a,0xff,0x34,0x88,0xc6,0xff,0x8c,0xae,0xcc,0xff,0x80,0x96,0xb0,0xff,0x7b,0x92,0xaa,0xff,0x3b,0x39,0x37,0xff,0x28,0x18,0x02,0xff,0x2d,0x20,0x0c,0xff,0x31,0x20,0x0d,0xff,0x2f,0x20,0x0c,0xff,0x2e,0x1f,0x0b,0xff,0x2f,0x1f,0x0c,0xff,0x2f,0x20,0x0c,0xff,0x2e,0x1f,0x0b,0xff,0x2d,0x1f,0x0b,0xff,0x2b,0x1e,0x0a,0xff,0x2a,0x1d,0x0a,0xff,0x2a,0x1b,0x09,0xff,0x2a,0x1b,0x09,0xff,0x28,0x1c,0x0a,0xff,0x27,0x1b,0x08,0xff,0x26,0x1a,0x08,0xff,0x26,0x1b,0x09,0xff,0x26,0x1a,0x08,0xff,0x26,0x1a,0x0a,0xff,0x25,0x19,0x09,0xff,0x25,0x19,0x09,0xff,0x25,0x18,0x09,0xff,0x26,0x19,0x0a,0xff,0x25,0x19,0x09,0xff,0x26,0x18,0x09,0xff,0x24,0x17,0x07,0xff,0x23,0x17,0x06,0xff,0x23,0x17,0x05,0xff,0x23,0x17,0x05,0xff,0x22,0x16,0x05,0xff,0x1a,0x0c,0x00,0xff,0x69,0x61,0x56,0xaa,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x73,0x95,0x6b,0x4c,0xff,0x63,0x27,0x00,0xff,0x6a,0x32,0x04,0xff,0x66,0x30,0x01,0xff,0x64,0x2f,0x02,0xff,0x65,0x31,0x03,0xff,0x64,0x31,0x03,0xff,0x63,0x31,0x03,0xff,0x62,0x30,0x02,0xff,0x61,0x30,0x03,0xff,0x61,0x2f,0x04,0xff,0x61,0x30,0x04,0xff,0x60,0x31,0x04,0xff,0x5f,0x30,0x03,0xff,0x5e,0x30,0x02,0xff,0x5e,0x31,0x03,0xff,0x5d,0x31,0x02,0xff,0x5a,0x30,0x01,0xff,0x5b,0x30,0x02,0xff,0x5a,0x31,0x02,0xff,0x59,0x30,0x01,0xff,0x76,0x3e,0x01,0xff,0x96,0x50,0x03,0xff,0x73,0x40,0x02,0xff,0x51,0x2f,0x01,0xff,0x5a,0x33,0x01,0xff,0x58,0x33,0x01,0xff,0x52,0x2f,0x02,0xff,0x49,0x2b,0x01,0xff,0x43,0x29,0x01,0xff,0x49,0x2d,0x01,0xff,0x5c,0x3a,0x01,0xff,0x7e,0x4d,0x02,0xff,0x9b,0x5d,0x01,0xff,0x75,0x46,0x05,0xff,0x2f,0x13,0x02,0xff,0x29,0x11,0x01,0xff,0x25,0x10,0x02,0xff,0x24,0x10,0x00,0xff,0x1e,0x0e,0x02,0xff,0x17,0x0a,0x03,0xff,0x15,0x0a,0x02,0xff,0x1a,0x0e,0x00,0xff,0x1b,0x0f,0x01,0xff,0x15,0x0c,0x02,0xff,0x09,0x05,0x01,0xff,0x02,0x01,0x01,0xff,0x10,0x0c,0x03,0xff,0x20,0x19,0x0b,0xff,0x04,0x02,0x02,0xff,0x06,0x05,0x01,0xff,0x07,0x05,0x02,0xff,0x08,0x04,0x01,0xff,0x0d,0x09,0x05,0xff,0x0c,0x08,0x03,0xff,0x0e,0x08,0x06,0xff,0x0c,0x07,0x04,0xff,0x09,0x06,0x02,0xff,0x10,0x09,0x05,0xff,0x11,0x0a,0x05,0xff,0x0b,0x07,0x04,0xff,0x36,0x38,0x33,0xff,0x76,0x7e,0x78,0xff,0xac,0xb8,0xb3,0xff,0x96,0x9f,0xa3,0xff,0x47,0x4d,0x64,0xff,0x21,0x2a,0x44,0xff,0x12,0x14,0x1e,0xff,0x11,0x12,0x18,0xff,0x0f,0x13,0x16,0xff,0x08,0x07,0x05,0xff,0x07,0x07,0x07,0xff,0x10,0x15,0x1e,0xff,0x1f,0x26,0x3b,0xff,0x23,0x2d,0x48,0xff,0x22,0x2a,0x45,0xff,0x23,0x28,0x43,0xff,0x22,0x27,0x40,0xff,0x21,0x25,0x3e,0xff,0x21,0x26,0x3d,0xff,0x25,0x2b,0x42,0xff,0x46,0x4f,0x69,0xff,0x74,0x85,0xa1,0xff,0x97,0xab,0xcc,0xff,0xab,0xc1,0xdf,0xff,0xbd,0xd0,0xed,0xff,0xcb,0xd8,0xef,0xff,0xc9,0xd8,0xf3,0xff,0xd9,0xe6,0xfb,0xff,0xe9,0xf4,0xff,0xff,0xef,0xfa,0xfe,0xff,0xff,0xff,0xff,0xff,0xaf,0xb6,0xb9,0xff,0x34,0x3e,0x53,0xff,0x62,0x6d,0x81,0xff,0xba,0xcc,0xd8,0xff,0xa7,0xbc,0xc8,0xff,0xa9,0xc0,0xcd,0xff,0xac,0xc2,0xd1,0xff,0x8e,0xa8,0xbf,0xff,0x9d,0xb9,0xcf,0xff,0xa1,0xba,0xd3,0xff,0x81,0x99,0xac,0xff,0x20,0x26,0x28,0xff,0x16,0x5f,0x92,0xff,0x6b,0xaa,0xd7,0xff,0x84,0x93,0xab,0xff,0x49,0x47,0x48,0xff,0x24,0x16,0x04,0xff,0x2c,0x1f,0x0d,0xff,0x2e,0x21,0x0f,0xff,0x2e,0x1f,0x0b,0xff,0x2f,0x20,0x0c,0xff,0x2e,0x1f,0x0b,0xff,0x2e,0x1f,0x0b,0xff,0x2d,0x1e,0x0b,0xff,0x2f,0x1f,0x0c,0xff,0x2c,0x1e,0x0a,0xff,0x2b,0x1d,0x09,0xff,0x2b,0x1d,0x0b,0xff,0x29,0x1b,0x09,0xff,0x2a,0x1c,0x0a,0xff,0x28,0x1c,0x0a,0xff,0x27,0x1b,0x09,0xff,0x26,0x1a,0x08,0xff,0x26,0x1a,0x08,0xff,0x26,0x1a,0x08,0xff,0x27,0x1b,0x0a,0xff,0x25,0x18,0x09,0xff,0x25,0x19,0x09,0xff,0x25,0x19,0x09,0xff,0x25,0x19,0x09,0xff,0x26,0x19,0x09,0xff,0x25,0x18,0x08,0xff,0x24,0x18,0x08,0xff,0x23,0x16,0x06,0xff,0x24,0x18,0x06,0xff,0x23,0x18,0x05,0xff,0x22,0x17,0x06,0xff,0x1c,0x10,0x00,0xff,0x4a,0x40,0x33,0xcb,0xf4,0xf4,0xf3,0x02,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xf5,0xf1,0xed,0x9a,0x84,0x52,0x2e,0xff,0x65,0x28,0x00,0xff,0x69,0x2f,0x02,0xff,0x68,0x30,0x02,0xff,0x66,0x30,0x03,0xff,0x65,0x30,0x03,0xff,0x64,0x2f,0x02,0xff,0x65,0x31,0x02,0xff,0x65,0x30,0x03,0xff,0x62,0x30,0x03,0xff,0x5f,0x2e,0x02,0xff,0x60,0x2f,0x03,0xff,0x5f,0x30,0x04,0xff,0x5f,0x30,0x03,0xff,0x5e,0x30,0x02,0xff,0x5c,0x31,0x02,0xff,0x5c,0x30,0x01,0xff,0x59,0x2f,0x01,0xff,0x5a,0x30,0x02,0xff,0x5a,0x30,0x01,0xff,0x54,0x2d,0x01,0xff,0x78,0x3f,0x02,0xff,0x92,0x4f,0x04,0xff,0x51,0x2c,0x01,0xff,0x48,0x28,0x01,0xff,0x4c,0x29,0x02,0xff,0x50,0x2e,0x01,0xff,0x51,0x30,0x01,0xff,0x4b,0x2d,0x02,0xff,0x4f,0x2f,0x01,0xff,0x5b,0x38,0x01,0xff,0x77,0x47,0x01,0xff,0x98,0x5a,0x02,0xff,0x99,0x5c,0x02,0xff,0x7c,0x4a,0x04,0xff,0x47,0x24,0x02,0xff,0x21,0x0d,0x02,0xff,0x23,0x0e,0x01,0xff,0x24,0x10,0x01,0xff,0x20,0x10,0x00,0xff,0x1d,0x0f,0x01,0xff,0x1a,0x0d,0x02,0xff,0x19,0x0d,0x01,0xff,0x19,0x0e,0x02,0xff,0x0e,0x07,0x01,0xff,0x05,0x03,0x01,0xff,0x01,0x00,0x01,0xff,0x1a,0x14,0x04,0xff,0x17,0x11,0x06,0xff,0x03,0x01,0x00,0xff,0x07,0x06,0x02,0xff,0x0a,0x06,0x02,0xff,0x0b,0x06,0x02,0xff,0x08,0x06,0x02,0xff,0x0a,0x05,0x02,0xff,0x0a,0x05,0x02,0xff,0x0a,0x06,0x02,0xff,0x09,0x06,0x01,0xff,0x10,0x08,0x05,0xff,0x15,0x0d,0x08,0xff,0x0c,0x07,0x05,0xff,0x1f,0x22,0x1b,0xff,0x49,0x4b,0x45,0xff,0x72,0x78,0x77,0xff,0xc9,0xd0,0xd5,0xff,0x70,0x79,0xa1,0xff,0x32,0x55,0xa3,0xff,0x4a,0x83,0xb0,0xff,0x1f,0x31,0x46,0xff,0x13,0x15,0x20,0xff,0x11,0x13,0x17,0xff,0x09,0x09,0x0b,0xff,0x05,0x05,0x07,0xff,0x0f,0x12,0x1f,0xff,0x1d,0x24,0x3d,0xff,0x23,0x2c,0x4b,0xff,0x25,0x2d,0x49,0xff,0x23,0x29,0x44,0xff,0x22,0x27,0x43,0xff,0x22,0x28,0x41,0xff,0x1f,0x26,0x3f,0xff,0x34,0x3d,0x54,0xff,0x6a,0x7b,0x93,0xff,0x95,0xa7,0xc9,0xff,0xa5,0xb8,0xd9,0xff,0xaf,0xc0,0xdf,0xff,0xbf,0xcf,0xea,0xff,0xbe,0xce,0xea,0xff,0xc7,0xd5,0xf1,0xff,0xdb,0xe8,0xfc,0xff,0xe2,0xed,0xfd,0xff,0xef,0xf5,0xff,0xff,0xe1,0xea,0xf0,0xff,0x80,0x95,0xa3,0xff,0xad,0xbf,0xcd,0xff,0xa3,0xb8,0xc3,0xff,0xa5,0xbb,0xcb,0xff,0xab,0xc0,0xd0,0xff,0x91,0xa6,0xbb,0xff,0xaf,0xc9,0xd9,0xff,0x9d,0xb9,0xcc,0xff,0x7b,0x94,0xaf,0xff,0x8b,0xa5,0xbf,0xff,0x5b,0x67,0x6e,0xff,0x0a,0x2f,0x49,0xff,0x4a,0xa6,0xe3,0xff,0x49,0x54,0x59,0xff,0x1e,0x0b,0x00,0xff,0x2d,0x1f,0x0d,0xff,0x2e,0x1f,0x0e,0xff,0x2f,0x20,0x0f,0xff,0x2f,0x1f,0x0d,0xff,0x2f,0x1f,0x0c,0xff,0x2d,0x1e,0x0b,0xff,0x2c,0x1e,0x09,0xff,0x2c,0x1f,0x0a,0xff,0x2c,0x1e,0x0a,0xff,0x2c,0x1e,0x0b,0xff,0x2b,0x1e,0x0a,0xff,0x2a,0x1d,0x09,0xff,0x29,0x1c,0x0a,0xff,0x28,0x1b,0x09,0xff,0x27,0x1c,0x09,0xff,0x27,0x1c,0x09,0xff,0x26,0x1b,0x09,0xff,0x25,0x19,0x07,0xff,0x26,0x1a,0x08,0xff,0x27,0x19,0x09,0xff,0x28,0x19,0x0a,0xff,0x28,0x1a,0x0a,0xff,0x27,0x19,0x09,0xff,0x25,0x1a,0x08,0xff,0x26,0x19,0x08,0xff,0x25,0x19,0x07,0xff,0x25,0x19,0x07,0xff,0x24,0x18,0x06,0xff,0x24,0x18,0x06,0xff,0x23,0x17,0x07,0xff,0x24,0x17,0x07,0xff,0x1f,0x12,0x02,0xff,0x37,0x2c,0x1d,0xea,0xdf,0xdd,0xdb,0x13,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xeb,0xe2,0xdc,0xb9,0x7b,0x42,0x1c,0xff,0x67,0x29,0x00,0xff,0x6a,0x2f,0x02,0xff,0x69,0x2f,0x03,0xff,0x68,0x30,0x03,0xff,0x65,0x2f,0x02,0xff,0x64,0x2f,0x02,0xff,0x65,0x30,0x03,0xff,0x64,0x2f,0x02,0xff,0x62,0x30,0x03,0xff,0x61,0x30,0x03,0xff,0x5f,0x2f,0x04,0xff,0x5d,0x2f,0x03,0xff,0x5f,0x2f,0x03,0xff,0x5d,0x30,0x02,0xff,0x5b,0x2f,0x01,0xff,0x5c,0x30,0x01,0xff,0x5a,0x30,0x02,0xff,0x5a,0x2f,0x02,0xff,0x59,0x2f,0x02,0xff,0x53,0x2c,0x02,0xff,0x7c,0x45,0x03,0xff,0x78,0x42,0x02,0xff,0x48,0x25,0x01,0xff,0x48,0x27,0x00,0xff,0x5a,0x32,0x00,0xff,0x67,0x3c,0x01,0xff,0x66,0x3e,0x02,0xff,0x5e,0x38,0x01,0xff,0x66,0x3e,0x01,0xff,0x77,0x4c,0x01,0xff,0x93,0x59,0x01,0xff,0x9e,0x60,0x02,0xff,0x87,0x50,0x02,0xff,0x74,0x47,0x00,0xff,0x74,0x47,0x03,0xff,0x2b,0x15,0x01,0xff,0x1f,0x0d,0x01,0xff,0x21,0x0f,0x01,0xff,0x20,0x0f,0x00,0xff,0x1d,0x0e,0x00,0xff,0x1a,0x0d,0x01,0xff,0x19,0x0e,0x01,0xff,0x13,0x0a,0x01,0xff,0x09,0x04,0x00,0xff,0x06,0x03,0x01,0xff,0x06,0x04,0x01,0xff,0x1c,0x16,0x06,0xff,0x0c,0x09,0x03,0xff,0x04,0x02,0x01,0xff,0x11,0x0d,0x02,0xff,0x14,0x10,0x03,0xff,0x0f,0x0b,0x03,0xff,0x07,0x04,0x01,0xff,0x08,0x04,0x02,0xff,0x09,0x05,0x02,0xff,0x08,0x05,0x02,0xff,0x0a,0x05,0x02,0xff,0x1b,0x0b,0x08,0xff,0x25,0x09,0x0b,0xff,0x11,0x0f,0x09,0xff,0x1b,0x1b,0x13,0xff,0x4b,0x52,0x4b,0xff,0x86,0x8e,0x95,0xff,0x67,0x6c,0x7e,0xff,0x89,0x8f,0xb2,0xff,0x55,0x67,0xa3,0xff,0x48,0x8d,0xd6,0xff,0x48,0x93,0xdc,0xff,0x39,0x5d,0x82,0xff,0x14,0x18,0x23,0xff,0x10,0x13,0x1a,0xff,0x0a,0x0d,0x0e,0xff,0x05,0x06,0x04,0xff,0x0c,0x0f,0x15,0xff,0x1d,0x23,0x3d,0xff,0x21,0x2a,0x4c,0xff,0x22,0x2b,0x4b,0xff,0x24,0x2a,0x48,0xff,0x20,0x26,0x41,0xff,0x20,0x27,0x41,0xff,0x21,0x29,0x42,0xff,0x4d,0x58,0x73,0xff,0x91,0xa0,0xc0,0xff,0xb0,0xc1,0xe0,0xff,0xb1,0xc3,0xe0,0xff,0xac,0xbe,0xdb,0xff,0xb2,0xc4,0xe1,0xff,0xb5,0xc6,0xe3,0xff,0xc7,0xd6,0xf0,0xff,0xd4,0xe1,0xf7,0xff,0xdc,0xe7,0xfd,0xff,0xe1,0xec,0xfc,0xff,0xe8,0xf2,0xfa,0xff,0xc4,0xd3,0xdc,0xff,0xab,0xbe,0xcc,0xff,0x9c,0xb7,0xc6,0xff,0x8c,0xa7,0xbb,0xff,0x9b,0xb4,0xc8,0xff,0x9f,0xb6,0xcd,0xff,0x9d,0xb4,0xc8,0xff,0x78,0x90,0xab,0xff,0x89,0x9e,0xba,0xff,0x71,0x89,0x9d,0xff,0x17,0x20,0x26,0xff,0x4d,0x7d,0xb7,0xff,0x79,0x82,0x92,0xff,0x36,0x2a,0x1d,0xff,0x2b,0x1a,0x08,0xff,0x2f,0x1f,0x0d,0xff,0x2d,0x1f,0x0e,0xff,0x2e,0x1f,0x0c,0xff,0x2f,0x1f,0x0b,0xff,0x2e,0x1e,0x0a,0xff,0x2c,0x1e,0x09,0xff,0x2a,0x1e,0x08,0xff,0x2b,0x1d,0x0a,0xff,0x2b,0x1d,0x0a,0xff,0x29,0x1d,0x09,0xff,0x2a,0x1d,0x0a,0xff,0x29,0x1c,0x0a,0xff,0x28,0x1b,0x09,0xff,0x27,0x1b,0x09,0xff,0x26,0x1a,0x08,0xff,0x26,0x1b,0x09,0xff,0x27,0x1a,0x08,0xff,0x27,0x1a,0x08,0xff,0x28,0x19,0x09,0xff,0x28,0x19,0x0a,0xff,0x27,0x18,0x09,0xff,0x26,0x18,0x08,0xff,0x26,0x19,0x07,0xff,0x27,0x19,0x08,0xff,0x25,0x18,0x06,0xff,0x24,0x19,0x06,0xff,0x24,0x18,0x06,0xff,0x24,0x18,0x06,0xff,0x23,0x17,0x07,0xff,0x24,0x17,0x08,0xff,0x20,0x13,0x04,0xff,0x2b,0x1e,0x0f,0xf9,0xcb,0xc8,0xc4,0x2d,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x04,0xe0,0xd2,0xc9,0xd2,0x71,0x32,0x08,0xff,0x6b,0x2b,0x00,0xff,0x6a,0x2d,0x02,0xff,0x6a,0x2e,0x02,0xff,0x66,0x2e,0x02,0xff,0x66,0x2f,0x03,0xff,0x66,0x30,0x02,0xff,0x64,0x30,0x02,0xff,0x62,0x2f,0x02,0xff,0x61,0x30,0x02,0xff,0x60,0x30,0x03,0xff,0x60,0x2f,0x03,0xff,0x5e,0x30,0x03,0xff,0x5f,0x2f,0x03,0xff,0x5d,0x2f,0x03,0xff,0x5b,0x2e,0x02,0xff,0x5c,0x2f,0x03,0xff,0x5a,0x2e,0x02,0xff,0x5a,0x2f,0x02,0xff,0x57,0x2d,0x01,0xff,0x5d,0x31,0x01,0xff,0x8f,0x4f,0x03,0xff,0x65,0x38,0x02,0xff,0x4b,0x29,0x02,0xff,0x54,0x2d,0x01,0xff,0x74,0x44,0x01,0xff,0x80,0x4b,0x02,0xff,0x7a,0x48,0x01,0xff,0x77,0x46,0x01,0xff,0x80,0x4d,0x02,0xff,0x8d,0x56,0x02,0xff,0x98,0x5d,0x02,0xff,0x92,0x58,0x01,0xff,0x83,0x4e,0x01,0xff,0x7e,0x50,0x01,0xff,0x80,0x52,0x02,0xff,0x4e,0x2f,0x05,0xff,0x20,0x0c,0x01,0xff,0x20,0x0e,0x01,0xff,0x1e,0x0f,0x01,0xff,0x1d,0x0d,0x00,0xff,0x1a,0x0d,0x01,0xff,0x15,0x0c,0x02,0xff,0x0a,0x06,0x01,0xff,0x06,0x03,0x01,0xff,0x04,0x02,0x01,0xff,0x0e,0x09,0x01,0xff,0x1a,0x13,0x05,0xff,0x04,0x02,0x01,0xff,0x0a,0x07,0x01,0xff,0x1a,0x15,0x02,0xff,0x1d,0x18,0x02,0xff,0x13,0x0e,0x03,0xff,0x0e,0x0a,0x02,0xff,0x08,0x04,0x03,0xff,0x0b,0x06,0x03,0xff,0x09,0x04,0x02,0xff,0x0e,0x08,0x02,0xff,0x36,0x12,0x0b,0xff,0x3d,0x0b,0x1a,0xff,0x15,0x13,0x0e,0xff,0x25,0x24,0x1d,0xff,0x4f,0x55,0x4d,0xff,0x95,0xa0,0xa4,0xff,0xa3,0xad,0xbb,0xff,0x90,0x99,0xb6,0xff,0xab,0xb2,0xd2,0xff,0xab,0xba,0xd9,0xff,0x5a,0x8a,0xca,0xff,0x52,0x94,0xd5,0xff,0x4a,0x73,0xa1,0xff,0x1c,0x2b,0x40,0xff,0x0f,0x14,0x1f,0xff,0x09,0x0d,0x0e,0xff,0x05,0x06,0x04,0xff,0x0a,0x0e,0x13,0xff,0x17,0x1c,0x32,0xff,0x23,0x29,0x4b,0xff,0x25,0x2b,0x4c,0xff,0x21,0x28,0x46,0xff,0x20,0x26,0x44,0xff,0x20,0x26,0x43,0xff,0x30,0x36,0x54,0xff,0x78,0x83,0xa2,0xff,0xaa,0xb8,0xd7,0xff,0xb9,0xc9,0xe6,0xff,0xac,0xbb,0xdb,0xff,0xaa,0xba,0xda,0xff,0xb1,0xc1,0xdf,0xff,0xb1,0xbf,0xde,0xff,0xb7,0xc4,0xe0,0xff,0xcc,0xd9,0xf0,0xff,0xe0,0xea,0xfc,0xff,0xe8,0xf0,0xff,0xff,0xe5,0xf0,0xfe,0xff,0xe4,0xee,0xf9,0xff,0xc7,0xd7,0xe0,0xff,0xa0,0xb8,0xc5,0xff,0xa9,0xc7,0xd6,0xff,0x7e,0x95,0xb0,0xff,0x7e,0x94,0xac,0xff,0x7f,0x95,0xad,0xff,0x70,0x85,0xa2,0xff,0x6b,0x86,0x9e,0xff,0x58,0x62,0x79,0xff,0x55,0x49,0x95,0xff,0xd3,0xd6,0xff,0xff,0xb6,0xbb,0xbf,0xff,0x2a,0x1e,0x14,0xff,0x2c,0x1d,0x0b,0xff,0x2c,0x1f,0x0c,0xff,0x2f,0x20,0x0d,0xff,0x2f,0x1f,0x0c,0xff,0x2e,0x1e,0x0b,0xff,0x2d,0x1f,0x09,0xff,0x2c,0x1f,0x09,0xff,0x2b,0x1e,0x09,0xff,0x2b,0x1e,0x09,0xff,0x2a,0x1c,0x09,0xff,0x2a,0x1c,0x0a,0xff,0x29,0x1c,0x0a,0xff,0x28,0x1c,0x09,0xff,0x28,0x1c,0x0a,0xff,0x28,0x1c,0x0a,0xff,0x26,0x1b,0x09,0xff,0x26,0x1b,0x09,0xff,0x27,0x1b,0x09,0xff,0x29,0x1a,0x0a,0xff,0x28,0x19,0x0a,0xff,0x27,0x18,0x08,0xff,0x27,0x18,0x08,0xff,0x27,0x19,0x07,0xff,0x28,0x19,0x07,0xff,0x27,0x19,0x07,0xff,0x23,0x18,0x05,0xff,0x24,0x19,0x06,0xff,0x23,0x18,0x05,0xff,0x24,0x17,0x07,0xff,0x23,0x17,0x07,0xff,0x21,0x15,0x05,0xff,0x1f,0x12,0x01,0xff,0xb5,0xb1,0xac,0x44,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x10,0xd0,0xba,0xac,0xe9,0x6a,0x28,0x00,0xff,0x6c,0x2b,0x00,0xff,0x6a,0x2c,0x01,0xff,0x69,0x2c,0x01,0xff,0x68,0x2e,0x02,0xff,0x68,0x30,0x04,0xff,0x65,0x30,0x03,0xff,0x63,0x2f,0x01,0xff,0x64,0x2f,0x01,0xff,0x61,0x2f,0x01,0xff,0x5f,0x2f,0x02,0xff,0x5f,0x2e,0x02,0xff,0x5e,0x2f,0x02,0xff,0x5f,0x31,0x03,0xff,0x5c,0x2e,0x02,0xff,0x5b,0x2e,0x02,0xff,0x5b,0x2f,0x03,0xff,0x5b,0x2f,0x03,0xff,0x5b,0x30,0x04,0xff,0x56,0x2e,0x03,0xff,0x70,0x3a,0x01,0xff,0x95,0x50,0x02,0xff,0x5f,0x33,0x02,0xff,0x4f,0x2a,0x01,0xff,0x64,0x36,0x01,0xff,0x86,0x50,0x02,0xff,0x88,0x4f,0x02,0xff,0x7f,0x49,0x01,0xff,0x85,0x4f,0x02,0xff,0x8b,0x52,0x01,0xff,0x92,0x58,0x01,0xff,0x95,0x5b,0x02,0xff,0x8c,0x54,0x01,0xff,0x85,0x51,0x01,0xff,0x7e,0x4e,0x02,0xff,0x6f,0x46,0x01,0xff,0x6b,0x45,0x04,0xff,0x33,0x1d,0x03,0xff,0x1b,0x0a,0x01,0xff,0x1b,0x0d,0x02,0xff,0x1a,0x0d,0x01,0xff,0x18,0x0c,0x01,0xff,0x0e,0x07,0x01,0xff,0x06,0x04,0x00,0xff,0x08,0x03,0x01,0xff,0x03,0x02,0x01,0xff,0x19,0x11,0x04,0xff,0x12,0x0b,0x02,0xff,0x03,0x03,0x00,0xff,0x14,0x0f,0x02,0xff,0x22,0x1c,0x01,0xff,0x24,0x1c,0x01,0xff,0x1b,0x13,0x04,0xff,0x12,0x0d,0x03,0xff,0x0d,0x07,0x02,0xff,0x09,0x04,0x02,0xff,0x08,0x05,0x02,0xff,0x13,0x0a,0x05,0xff,0x48,0x1f,0x08,0xff,0x31,0x0c,0x13,0xff,0x1a,0x13,0x10,0xff,0x29,0x2a,0x22,0xff,0x30,0x32,0x29,0xff,0x68,0x70,0x70,0xff,0xbd,0xc9,0xd4,0xff,0xb2,0xbb,0xcf,0xff,0xb1,0xbc,0xd7,0xff,0xf5,0xf6,0xf9,0xff,0xd1,0xe1,0xf4,0xff,0x89,0xb4,0xdb,0xff,0x61,0x94,0xcd,0xff,0x44,0x87,0xc8,0xff,0x19,0x32,0x51,0xff,0x11,0x11,0x1b,0xff,0x0a,0x0e,0x0f,0xff,0x09,0x08,0x07,0xff,0x0a,0x0d,0x13,0xff,0x15,0x1c,0x31,0xff,0x1f,0x27,0x47,0xff,0x21,0x29,0x4a,0xff,0x24,0x2a,0x49,0xff,0x26,0x2a,0x49,0xff,0x22,0x26,0x44,0xff,0x45,0x4a,0x6b,0xff,0x8d,0x99,0xba,0xff,0xac,0xbc,0xdb,0xff,0xa2,0xb0,0xd1,0xff,0x9e,0xad,0xcf,0xff,0xb0,0xc1,0xde,0xff,0xad,0xbb,0xda,0xff,0xa4,0xb1,0xd1,0xff,0xaf,0xbd,0xd9,0xff,0xc2,0xce,0xe6,0xff,0xd6,0xe1,0xf5,0xff,0xde,0xe8,0xfa,0xff,0xe2,0xed,0xfd,0xff,0xeb,0xf3,0xff,0xff,0xe1,0xeb,0xf3,0xff,0xad,0xc0,0xcc,0xff,0x62,0x79,0x92,0xff,0x69,0x80,0x9b,0xff,0x67,0x79,0x95,0xff,0x73,0x8a,0xa7,0xff,0x68,0x75,0x97,0xff,0x5b,0x61,0x9c,0xff,0x37,0x3b,0x87,0xff,0x86,0x95,0xd9,0xff,0xd6,0xe7,0xfb,0xff,0x4d,0x49,0x40,0xff,0x26,0x16,0x03,0xff,0x2e,0x1f,0x0f,0xff,0x2d,0x1f,0x0d,0xff,0x2d,0x1f,0x0c,0xff,0x2d,0x1f,0x0b,0xff,0x2c,0x1e,0x0a,0xff,0x2a,0x1d,0x09,0xff,0x2b,0x1d,0x0a,0xff,0x2a,0x1d,0x0a,0xff,0x2a,0x1c,0x0a,0xff,0x2a,0x1c,0x0a,0xff,0x2a,0x1c,0x0b,0xff,0x27,0x1c,0x0a,0xff,0x27,0x1b,0x09,0xff,0x27,0x1b,0x09,0xff,0x28,0x1b,0x0b,0xff,0x26,0x1a,0x09,0xff,0x26,0x1a,0x09,0xff,0x27,0x19,0x09,0xff,0x26,0x19,0x09,0xff,0x26,0x19,0x09,0xff,0x26,0x1a,0x09,0xff,0x25,0x19,0x07,0xff,0x28,0x1a,0x08,0xff,0x26,0x18,0x06,0xff,0x24,0x17,0x05,0xff,0x25,0x18,0x06,0xff,0x26,0x18,0x06,0xff,0x25,0x17,0x06,0xff,0x25,0x17,0x06,0xff,0x24,0x16,0x05,0xff,0x1b,0x0c,0x00,0xff,0xa0,0x9a,0x92,0x5d,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x23,0xc4,0xa8,0x96,0xf4,0x6a,0x25,0x00,0xff,0x6c,0x2a,0x01,0xff,0x6b,0x2b,0x02,0xff,0x69,0x2b,0x02,0xff,0x69,0x2e,0x02,0xff,0x67,0x2e,0x02,0xff,0x65,0x2f,0x02,0xff,0x64,0x2f,0x02,0xff,0x64,0x2f,0x02,0xff,0x61,0x2f,0x02,0xff,0x60,0x2f,0x02,0xff,0x60,0x30,0x02,0xff,0x5f,0x2f,0x02,0xff,0x5e,0x2f,0x03,0xff,0x5e,0x2f,0x03,0xff,0x5c,0x2f,0x02,0xff,0x5c,0x2f,0x02,0xff,0x5b,0x2f,0x02,0xff,0x5a,0x2e,0x03,0xff,0x55,0x2c,0x02,0xff,0x75,0x3d,0x02,0xff,0x8d,0x4b,0x01,0xff,0x59,0x2f,0x01,0xff,0x56,0x2e,0x02,0xff,0x78,0x44,0x01,0xff,0x8e,0x54,0x02,0xff,0x85,0x4c,0x00,0xff,0x87,0x4e,0x01,0xff,0x8d,0x52,0x01,0xff,0x92,0x56,0x01,0xff,0x94,0x57,0x02,0xff,0x97,0x5a,0x01,0xff,0x90,0x56,0x01,0xff,0x83,0x50,0x01,0xff,0x73,0x46,0x01,0xff,0x68,0x42,0x01,0xff,0x6c,0x46,0x02,0xff,0x5c,0x3a,0x04,0xff,0x1d,0x0e,0x01,0xff,0x18,0x0b,0x00,0xff,0x1a,0x0c,0x01,0xff,0x12,0x09,0x00,0xff,0x08,0x04,0x01,0xff,0x06,0x03,0x01,0xff,0x04,0x03,0x01,0xff,0x09,0x06,0x03,0xff,0x1f,0x16,0x05,0xff,0x07,0x03,0x01,0xff,0x08,0x06,0x01,0xff,0x1d,0x16,0x02,0xff,0x25,0x1d,0x02,0xff,0x27,0x1d,0x02,0xff,0x25,0x1c,0x03,0xff,0x18,0x10,0x04,0xff,0x11,0x0b,0x03,0xff,0x0a,0x04,0x03,0xff,0x06,0x02,0x04,0xff,0x13,0x08,0x03,0xff,0x56,0x34,0x09,0xff,0x20,0x11,0x07,0xff,0x11,0x0c,0x0d,0xff,0x27,0x25,0x20,0xff,0x31,0x33,0x28,0xff,0x53,0x55,0x54,0xff,0x9b,0xa3,0xad,0xff,0xb8,0xc2,0xd4,0xff,0xba,0xc5,0xdb,0xff,0xf5,0xf9,0xfa,0xff,0xd3,0xe0,0xf3,0xff,0xb1,0xd4,0xf6,0xff,0xb1,0xd4,0xf0,0xff,0x4c,0xa6,0xed,0xff,0x1c,0x8a,0xd8,0xff,0x14,0x30,0x54,0xff,0x13,0x11,0x1f,0xff,0x09,0x0d,0x0f,0xff,0x0c,0x0d,0x0f,0xff,0x0b,0x0e,0x12,0xff,0x11,0x18,0x28,0xff,0x1c,0x24,0x40,0xff,0x1f,0x25,0x47,0xff,0x23,0x2b,0x4a,0xff,0x29,0x2e,0x4e,0xff,0x23,0x26,0x47,0xff,0x59,0x60,0x80,0xff,0x92,0x9f,0xbe,0xff,0x8d,0x9c,0xbd,0xff,0x88,0x98,0xb9,0xff,0x96,0xa6,0xc6,0xff,0xa8,0xb7,0xd7,0xff,0xa2,0xb0,0xcf,0xff,0xa7,0xb5,0xd3,0xff,0xad,0xba,0xd7,0xff,0xb3,0xc1,0xd9,0xff,0xbe,0xca,0xe3,0xff,0xc3,0xcd,0xe6,0xff,0xe1,0xec,0xfa,0xff,0xeb,0xf3,0xff,0xff,0xed,0xf2,0xfc,0xff,0xae,0xbc,0xc6,0xff,0x74,0x87,0x9e,0xff,0x64,0x79,0x98,0xff,0x52,0x61,0x7a,0xff,0x2b,0x25,0x48,0xff,0x1d,0x12,0x42,0xff,0x29,0x28,0x6d,0xff,0x60,0x6e,0xc0,0xff,0xa1,0xb4,0xe7,0xff,0x5c,0x59,0x54,0xff,0x26,0x15,0x00,0xff,0x2b,0x1e,0x0c,0xff,0x2a,0x1d,0x0c,0xff,0x2c,0x1e,0x0c,0xff,0x2b,0x1e,0x0a,0xff,0x2a,0x1d,0x0a,0xff,0x2a,0x1c,0x09,0xff,0x2a,0x1d,0x09,0xff,0x2a,0x1c,0x0a,0xff,0x2a,0x1c,0x0a,0xff,0x2a,0x1c,0x0a,0xff,0x2a,0x1c,0x09,0xff,0x27,0x1b,0x09,0xff,0x26,0x1a,0x07,0xff,0x27,0x1b,0x09,0xff,0x28,0x1b,0x0b,0xff,0x26,0x1a,0x0a,0xff,0x25,0x19,0x09,0xff,0x26,0x19,0x0a,0xff,0x26,0x19,0x09,0xff,0x26,0x19,0x09,0xff,0x25,0x1a,0x08,0xff,0x26,0x19,0x07,0xff,0x27,0x18,0x07,0xff,0x27,0x19,0x06,0xff,0x25,0x17,0x05,0xff,0x26,0x18,0x06,0xff,0x25,0x17,0x06,0xff,0x25,0x17,0x05,0xff,0x24,0x16,0x05,0xff,0x24,0x16,0x05,0xff,0x1c,0x0b,0x00,0xff,0x91,0x89,0x80,0x76,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x32,0xb9,0x98,0x84,0xfc,0x6a,0x23,0x00,0xff,0x6d,0x2a,0x01,0xff,0x6c,0x2b,0x01,0xff,0x6b,0x2c,0x02,0xff,0x69,0x2e,0x02,0xff,0x67,0x2e,0x01,0xff,0x67,0x30,0x03,0xff,0x64,0x2f,0x02,0xff,0x63,0x2f,0x02,0xff,0x62,0x2f,0x02,0xff,0x5f,0x2e,0x01,0xff,0x5f,0x2e,0x01,0xff,0x5d,0x2e,0x01,0xff,0x5d,0x2e,0x02,0xff,0x5e,0x2f,0x01,0xff,0x5d,0x2f,0x01,0xff,0x5c,0x30,0x02,0xff,0x5c,0x2f,0x01,0xff,0x5b,0x2e,0x02,0xff,0x58,0x2c,0x02,0xff,0x73,0x3c,0x02,0xff,0x83,0x46,0x02,0xff,0x53,0x2d,0x01,0xff,0x5d,0x32,0x00,0xff,0x87,0x4d,0x01,0xff,0x93,0x55,0x02,0xff,0x85,0x4b,0x01,0xff,0x8d,0x51,0x01,0xff,0x92,0x54,0x01,0xff,0x95,0x57,0x01,0xff,0x97,0x59,0x01,0xff,0x9e,0x5f,0x01,0xff,0x90,0x57,0x01,0xff,0x77,0x48,0x01,0xff,0x6a,0x43,0x01,0xff,0x63,0x3e,0x01,0xff,0x62,0x3c,0x01,0xff,0x6f,0x46,0x03,0xff,0x47,0x2a,0x04,0xff,0x13,0x08,0x02,0xff,0x15,0x0b,0x01,0xff,0x0b,0x05,0x01,0xff,0x07,0x03,0x02,0xff,0x07,0x02,0x02,0xff,0x04,0x02,0x00,0xff,0x17,0x10,0x03,0xff,0x1a,0x13,0x04,0xff,0x02,0x01,0x00,0xff,0x10,0x0d,0x01,0xff,0x24,0x1c,0x01,0xff,0x2b,0x1f,0x01,0xff,0x2e,0x20,0x03,0xff,0x2c,0x20,0x02,0xff,0x22,0x18,0x03,0xff,0x12,0x0c,0x03,0xff,0x10,0x0a,0x04,0xff,0x06,0x03,0x03,0xff,0x13,0x07,0x02,0xff,0x60,0x4a,0x09,0xff,0x24,0x20,0x07,0xff,0x14,0x0b,0x0a,0xff,0x26,0x22,0x1b,0xff,0x34,0x38,0x2e,0xff,0x55,0x55,0x4e,0xff,0x81,0x80,0x8a,0xff,0x93,0x99,0xb2,0xff,0xb2,0xc0,0xd9,0xff,0xe5,0xeb,0xf1,0xff,0xf8,0xfa,0xfc,0xff,0xb4,0xd3,0xf3,0xff,0x95,0xce,0xfd,0xff,0x58,0xc0,0xfc,0xff,0x1e,0xa1,0xf4,0xff,0x12,0x85,0xd4,0xff,0x18,0x2d,0x4b,0xff,0x0f,0x14,0x20,0xff,0x0b,0x11,0x11,0xff,0x0c,0x0c,0x0e,0xff,0x14,0x16,0x20,0xff,0x15,0x1b,0x2a,0xff,0x19,0x1f,0x36,0xff,0x1d,0x24,0x43,0xff,0x25,0x2a,0x48,0xff,0x26,0x2a,0x47,0xff,0x25,0x29,0x46,0xff,0x4f,0x56,0x74,0xff,0x6d,0x78,0x94,0xff,0x78,0x84,0xa2,0xff,0x7d,0x89,0xa8,0xff,0x8e,0x9a,0xbb,0xff,0xa7,0xb2,0xd2,0xff,0xa4,0xaf,0xce,0xff,0xa3,0xaf,0xcd,0xff,0xaf,0xbb,0xd9,0xff,0xa7,0xb4,0xd3,0xff,0x9b,0xa6,0xc5,0xff,0xb6,0xc0,0xda,0xff,0xe2,0xed,0xfd,0xff,0xe4,0xee,0xfd,0xff,0xe8,0xf1,0xfe,0xff,0xdc,0xe4,0xf3,0xff,0xd5,0xdd,0xe8,0xff,0x5f,0x63,0x73,0xff,0x3a,0x37,0x6e,0xff,0x82,0x7d,0xa6,0xff,0x82,0x87,0xb2,0xff,0x60,0x6c,0xb8,0xff,0x7a,0x89,0xc7,0xff,0x49,0x40,0x3b,0xff,0x27,0x16,0x03,0xff,0x2b,0x1e,0x0b,0xff,0x2c,0x1d,0x0e,0xff,0x2c,0x1e,0x0d,0xff,0x2b,0x1d,0x0b,0xff,0x2b,0x1e,0x0a,0xff,0x2b,0x1d,0x09,0xff,0x2a,0x1c,0x09,0xff,0x2a,0x1c,0x0a,0xff,0x29,0x1b,0x0a,0xff,0x29,0x1b,0x09,0xff,0x29,0x1c,0x0a,0xff,0x27,0x1b,0x09,0xff,0x25,0x1a,0x07,0xff,0x27,0x1b,0x09,0xff,0x27,0x1a,0x0a,0xff,0x26,0x1a,0x0a,0xff,0x27,0x1a,0x0a,0xff,0x26,0x19,0x09,0xff,0x26,0x19,0x0a,0xff,0x25,0x19,0x09,0xff,0x26,0x1a,0x09,0xff,0x26,0x1a,0x08,0xff,0x27,0x19,0x07,0xff,0x27,0x19,0x07,0xff,0x26,0x18,0x06,0xff,0x26,0x18,0x06,0xff,0x25,0x17,0x05,0xff,0x26,0x18,0x07,0xff,0x25,0x17,0x06,0xff,0x24,0x17,0x05,0xff,0x1b,0x0b,0x00,0xff,0x84,0x7b,0x71,0x89,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x3f,0xb1,0x8b,0x73,0xff,0x6a,0x22,0x00,0xff,0x6e,0x2a,0x01,0xff,0x6d,0x2c,0x01,0xff,0x6c,0x2e,0x01,0xff,0x6a,0x2f,0x01,0xff,0x6a,0x31,0x02,0xff,0x67,0x31,0x01,0xff,0x64,0x2f,0x01,0xff,0x64,0x2f,0x02,0xff,0x62,0x2f,0x02,0xff,0x61,0x2f,0x02,0xff,0x5e,0x2e,0x02,0xff,0x5e,0x2e,0x02,0xff,0x5e,0x30,0x02,0xff,0x5e,0x2f,0x02,0xff,0x5d,0x2f,0x01,0xff,0x5e,0x30,0x02,0xff,0x5b,0x2f,0x01,0xff,0x5a,0x2e,0x01,0xff,0x59,0x2d,0x02,0xff,0x6a,0x38,0x02,0xff,0x78,0x40,0x02,0xff,0x54,0x2d,0x01,0xff,0x6a,0x3b,0x01,0xff,0x91,0x54,0x02,0xff,0x96,0x56,0x02,0xff,0x8a,0x4e,0x02,0xff,0x91,0x53,0x01,0xff,0x94,0x56,0x01,0xff,0x93,0x54,0x02,0xff,0xa2,0x5f,0x02,0xff,0x9f,0x5f,0x03,0xff,0x7e,0x4b,0x01,0xff,0x6b,0x41,0x01,0xff,0x68,0x40,0x02,0xff,0x60,0x3b,0x01,0xff,0x5f,0x3b,0x01,0xff,0x6f,0x45,0x03,0xff,0x65,0x41,0x04,0xff,0x24,0x17,0x03,0xff,0x06,0x02,0x01,0xff,0x06,0x02,0x01,0xff,0x08,0x04,0x01,0xff,0x09,0x05,0x01,0xff,0x0c,0x08,0x01,0xff,0x23,0x19,0x05,0xff,0x13,0x0e,0x02,0xff,0x09,0x08,0x01,0xff,0x1a,0x13,0x01,0xff,0x29,0x1e,0x02,0xff,0x2d,0x20,0x01,0xff,0x2e,0x21,0x02,0xff,0x2f,0x21,0x02,0xff,0x2b,0x1f,0x02,0xff,0x18,0x10,0x02,0xff,0x13,0x0d,0x03,0xff,0x09,0x05,0x04,0xff,0x0c,0x04,0x01,0xff,0x6e,0x5d,0x15,0xff,0x47,0x43,0x13,0xff,0x11,0x07,0x07,0xff,0x1c,0x19,0x12,0xff,0x2a,0x2d,0x25,0xff,0x4c,0x4c,0x46,0xff,0x86,0x85,0x85,0xff,0xb3,0xb6,0xc4,0xff,0xad,0xb2,0xcf,0xff,0xbc,0xc5,0xe1,0xff,0xf4,0xf5,0xfa,0xff,0xca,0xe0,0xf7,0xff,0x78,0xc1,0xf9,0xff,0x42,0xb3,0xfd,0xff,0x2a,0xb3,0xfd,0xff,0x1a,0xa6,0xfc,0xff,0x18,0x81,0xcd,0xff,0x15,0x27,0x43,0xff,0x12,0x14,0x20,0xff,0x09,0x0c,0x0e,0xff,0x13,0x15,0x1c,0xff,0x24,0x28,0x38,0xff,0x13,0x1a,0x28,0xff,0x17,0x1a,0x2b,0xff,0x1e,0x21,0x3a,0xff,0x1e,0x22,0x3c,0xff,0x1e,0x21,0x3b,0xff,0x24,0x26,0x40,0xff,0x3a,0x3b,0x55,0xff,0x67,0x6d,0x88,0xff,0x75,0x7d,0x99,0xff,0x7b,0x83,0xa1,0xff,0x95,0x9d,0xbc,0xff,0xa1,0xab,0xc9,0xff,0x95,0xa0,0xbe,0xff,0x99,0xa5,0xc3,0xff,0x93,0x9f,0xbe,0xff,0x8f,0x9a,0xb9,0xff,0x94,0x9c,0xbf,0xff,0xbb,0xc7,0xdf,0xff,0xdf,0xea,0xfc,0xff,0xe1,0xe8,0xfb,0xff,0xdd,0xe6,0xfa,0xff,0xde,0xe7,0xfb,0xff,0xe3,0xe9,0xf9,0xff,0xbc,0xc3,0xe4,0xff,0xc2,0xcc,0xeb,0xff,0xc4,0xcf,0xf2,0xff,0xd6,0xe2,0xfd,0xff,0xa5,0xb0,0xbe,0xff,0x2c,0x1d,0x15,0xff,0x2a,0x1a,0x0b,0xff,0x2d,0x1d,0x0c,0xff,0x2e,0x1d,0x0f,0xff,0x2b,0x1c,0x0d,0xff,0x2c,0x1e,0x0c,0xff,0x2a,0x1d,0x0a,0xff,0x2a,0x1c,0x0a,0xff,0x2a,0x1c,0x0a,0xff,0x2a,0x1c,0x0b,0xff,0x29,0x1b,0x09,0xff,0x29,0x1b,0x09,0xff,0x28,0x1b,0x09,0xff,0x27,0x1c,0x08,0xff,0x26,0x1b,0x08,0xff,0x27,0x1b,0x09,0xff,0x27,0x1a,0x0a,0xff,0x25,0x19,0x09,0xff,0x26,0x19,0x09,0xff,0x27,0x1a,0x0a,0xff,0x26,0x1a,0x0a,0xff,0x25,0x19,0x09,0xff,0x26,0x1a,0x08,0xff,0x25,0x19,0x07,0xff,0x26,0x19,0x07,0xff,0x28,0x19,0x08,0xff,0x26,0x19,0x06,0xff,0x27,0x19,0x07,0xff,0x26,0x18,0x06,0xff,0x26,0x18,0x07,0xff,0x25,0x17,0x05,0xff,0x24,0x16,0x05,0xff,0x1b,0x0d,0x00,0xff,0x79,0x70,0x64,0x99,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x4a,0xaa,0x7f,0x66,0xff,0x6c,0x23,0x00,0xff,0x6f,0x2a,0x01,0xff,0x6d,0x2b,0x01,0xff,0x6d,0x2f,0x01,0xff,0x6c,0x30,0x01,0xff,0x69,0x2f,0x01,0xff,0x68,0x30,0x02,0xff,0x66,0x2f,0x02,0xff,0x65,0x2f,0x02,0xff,0x64,0x2f,0x02,0xff,0x61,0x2e,0x01,0xff,0x61,0x2f,0x02,0xff,0x60,0x2f,0x02,0xff,0x5f,0x2f,0x01,0xff,0x60,0x2f,0x02,0xff,0x5f,0x30,0x02,0xff,0x5d,0x2e,0x01,0xff,0x5b,0x2f,0x01,0xff,0x5b,0x2f,0x01,0xff,0x59,0x2e,0x01,0xff,0x68,0x36,0x02,0xff,0x6f,0x3a,0x02,0xff,0x5c,0x2e,0x02,0xff,0x7e,0x45,0x02,0xff,0xa2,0x5c,0x02,0xff,0x99,0x54,0x01,0xff,0x90,0x4f,0x01,0xff,0x96,0x56,0x01,0xff,0x9b,0x56,0x01,0xff,0xa5,0x5e,0x01,0xff,0xab,0x63,0x02,0xff,0x86,0x4e,0x01,0xff,0x68,0x3e,0x00,0xff,0x62,0x3a,0x03,0xff,0x5e,0x39,0x02,0xff,0x63,0x3d,0x02,0xff,0x70,0x43,0x02,0xff,0x7a,0x4b,0x03,0xff,0x5e,0x3d,0x02,0xff,0x41,0x2c,0x04,0xff,0x1f,0x14,0x04,0xff,0x15,0x0e,0x03,0xff,0x15,0x10,0x04,0xff,0x1a,0x16,0x03,0xff,0x1d,0x16,0x01,0xff,0x1b,0x15,0x03,0xff,0x0a,0x0a,0x01,0xff,0x0c,0x0d,0x00,0xff,0x1d,0x17,0x01,0xff,0x2b,0x1e,0x01,0xff,0x2f,0x21,0x03,0xff,0x2f,0x22,0x01,0xff,0x2f,0x22,0x02,0xff,0x2c,0x20,0x01,0xff,0x28,0x1d,0x03,0xff,0x13,0x0c,0x03,0xff,0x0f,0x0c,0x04,0xff,0x03,0x00,0x01,0xff,0x54,0x3b,0x0d,0xff,0x73,0x63,0x17,0xff,0x04,0x04,0x03,0xff,0x17,0x10,0x0e,0xff,0x23,0x22,0x1e,0xff,0x41,0x42,0x3d,0xff,0x86,0x87,0x87,0xff,0xad,0xaf,0xba,0xff,0xa1,0xa4,0xc5,0xff,0x9c,0xa5,0xd3,0xff,0xef,0xf2,0xf6,0xff,0xe8,0xf0,0xfc,0xff,0x75,0xbb,0xf9,0xff,0x47,0xb3,0xfd,0xff,0x2d,0xb1,0xfe,0xff,0x29,0xb7,0xfe,0xff,0x14,0xa9,0xfe,0xff,0x13,0x74,0xb8,0xff,0x12,0x1c,0x36,0xff,0x10,0x13,0x16,0xff,0x0d,0x10,0x0e,0xff,0x18,0x19,0x21,0xff,0x2b,0x31,0x3f,0xff,0x18,0x1c,0x2b,0xff,0x15,0x18,0x2a,0xff,0x19,0x1d,0x32,0xff,0x1c,0x1d,0x33,0xff,0x21,0x1f,0x35,0xff,0x2b,0x26,0x3c,0xff,0x45,0x44,0x58,0xff,0x62,0x66,0x7b,0xff,0x6e,0x71,0x8a,0xff,0x7b,0x80,0x9b,0xff,0x8e,0x97,0xb5,0xff,0x95,0xa0,0xbf,0xff,0x9a,0xa5,0xc3,0xff,0x90,0x9b,0xb8,0xff,0x80,0x88,0xa8,0xff,0x81,0x8b,0xab,0xff,0x86,0x92,0xb2,0xff,0xb0,0xbc,0xd7,0xff,0xd9,0xe3,0xf6,0xff,0xd8,0xe2,0xf5,0xff,0xbd,0xc8,0xe4,0xff,0xb8,0xc4,0xe8,0xff,0xef,0xf5,0xff,0xff,0xbe,0xc3,0xde,0xff,0x4c,0x57,0xa1,0xff,0x9a,0xab,0xdd,0xff,0xe5,0xf4,0xff,0xff,0x78,0x75,0x72,0xff,0x1e,0x0f,0x00,0xff,0x2a,0x1c,0x0c,0xff,0x2a,0x1d,0x0e,0xff,0x2c,0x1d,0x0d,0xff,0x2a,0x1c,0x0b,0xff,0x29,0x1b,0x0a,0xff,0x29,0x1b,0x0a,0xff,0x29,0x1b,0x0a,0xff,0x2a,0x1c,0x0a,0xff,0x2a,0x1c,0x0a,0xff,0x29,0x1b,0x09,0xff,0x28,0x1a,0x08,0xff,0x27,0x1c,0x07,0xff,0x25,0x1a,0x07,0xff,0x25,0x19,0x08,0xff,0x26,0x19,0x09,0xff,0x26,0x19,0x09,0xff,0x26,0x19,0x0a,0xff,0x26,0x19,0x09,0xff,0x27,0x1b,0x0b,0xff,0x25,0x19,0x09,0xff,0x24,0x18,0x07,0xff,0x24,0x18,0x06,0xff,0x26,0x19,0x07,0xff,0x27,0x19,0x07,0xff,0x27,0x19,0x08,0xff,0x27,0x19,0x07,0xff,0x26,0x19,0x07,0xff,0x26,0x18,0x07,0xff,0x26,0x17,0x06,0xff,0x25,0x16,0x07,0xff,0x1a,0x0c,0x00,0xff,0x6e,0x66,0x5a,0xa6,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x52,0xa7,0x77,0x5c,0xff,0x6f,0x23,0x00,0xff,0x71,0x2d,0x01,0xff,0x6f,0x2d,0x01,0xff,0x6d,0x2e,0x01,0xff,0x6d,0x30,0x02,0xff,0x6b,0x30,0x02,0xff,0x68,0x30,0x01,0xff,0x68,0x30,0x02,0xff,0x66,0x2f,0x01,0xff,0x65,0x30,0x01,0xff,0x64,0x30,0x02,0xff,0x63,0x30,0x03,0xff,0x63,0x31,0x03,0xff,0x61,0x30,0x02,0xff,0x61,0x31,0x02,0xff,0x61,0x32,0x02,0xff,0x5e,0x30,0x02,0xff,0x5d,0x30,0x02,0xff,0x5d,0x30,0x01,0xff,0x59,0x2d,0x01,0xff,0x6e,0x39,0x02,0xff,0x6f,0x3b,0x04,0xff,0x67,0x33,0x01,0xff,0x90,0x4e,0x02,0xff,0xa6,0x5f,0x01,0xff,0x95,0x51,0x01,0xff,0x95,0x52,0x01,0xff,0x9e,0x57,0x01,0xff,0xaa,0x5c,0x02,0xff,0xb4,0x66,0x01,0xff,0x99,0x56,0x01,0xff,0x73,0x42,0x02,0xff,0x64,0x3b,0x01,0xff,0x67,0x3c,0x01,0xff,0x68,0x3e,0x01,0xff,0x75,0x45,0x01,0xff,0x88,0x50,0x01,0xff,0x7e,0x4c,0x02,0xff,0x3f,0x2b,0x02,0xff,0x29,0x1e,0x02,0xff,0x23,0x1b,0x02,0xff,0x1a,0x15,0x01,0xff,0x18,0x16,0x01,0xff,0x23,0x1d,0x01,0xff,0x25,0x1d,0x03,0xff,0x13,0x12,0x02,0xff,0x14,0x13,0x01,0xff,0x0d,0x0d,0x00,0xff,0x12,0x0f,0x01,0xff,0x28,0x1e,0x03,0xff,0x30,0x23,0x02,0xff,0x2f,0x21,0x01,0xff,0x2f,0x22,0x02,0xff,0x2c,0x1f,0x01,0xff,0x32,0x23,0x01,0xff,0x1d,0x16,0x04,0xff,0x14,0x0c,0x03,0xff,0x08,0x06,0x04,0xff,0x27,0x13,0x03,0xff,0x7a,0x5e,0x15,0xff,0x1d,0x15,0x08,0xff,0x0c,0x0a,0x06,0xff,0x26,0x28,0x23,0xff,0x32,0x34,0x2e,0xff,0x63,0x66,0x63,0xff,0xa9,0xad,0xb3,0xff,0x9c,0xa3,0xbc,0xff,0x94,0x9d,0xcb,0xff,0xe4,0xeb,0xf5,0xff,0xfe,0xff,0xff,0xff,0x84,0xc4,0xf8,0xff,0x42,0xb1,0xfc,0xff,0x3e,0xb5,0xfd,0xff,0x22,0xb3,0xfe,0xff,0x19,0xb7,0xfd,0xff,0x0b,0xa6,0xfc,0xff,0x14,0x61,0x9e,0xff,0x15,0x15,0x20,0xff,0x15,0x13,0x17,0xff,0x0f,0x0e,0x12,0xff,0x15,0x17,0x1f,0xff,0x24,0x28,0x35,0xff,0x11,0x12,0x1d,0xff,0x18,0x1a,0x29,0xff,0x1a,0x1b,0x2d,0xff,0x1f,0x1b,0x30,0xff,0x26,0x20,0x33,0xff,0x35,0x2e,0x3d,0xff,0x54,0x50,0x5f,0xff,0x5e,0x5c,0x70,0xff,0x66,0x67,0x7f,0xff,0x81,0x87,0xa2,0xff,0x88,0x91,0xb0,0xff,0x93,0x9c,0xbd,0xff,0x9e,0xa9,0xc8,0xff,0x94,0xa0,0xbf,0xff,0x7d,0x88,0xa7,0xff,0x83,0x8c,0xae,0xff,0x9c,0xa6,0xc7,0xff,0xbf,0xca,0xe4,0xff,0xce,0xdb,0xef,0xff,0xbc,0xc6,0xe4,0xff,0x8b,0x9b,0xc6,0xff,0xbb,0xcb,0xeb,0xff,0xec,0xf5,0xff,0xff,0x71,0x73,0x9f,0xff,0x3a,0x45,0x81,0xff,0xb9,0xd0,0xf0,0xff,0xbc,0xc5,0xc9,0xff,0x29,0x19,0x0d,0xff,0x2a,0x19,0x0a,0xff,0x2a,0x1c,0x0c,0xff,0x2a,0x1c,0x0c,0xff,0x29,0x1b,0x09,0xff,0x29,0x1b,0x09,0xff,0x29,0x1b,0x09,0xff,0x29,0x1b,0x09,0xff,0x29,0x1b,0x09,0xff,0x2a,0x1c,0x0a,0xff,0x29,0x1a,0x09,0xff,0x28,0x1a,0x09,0xff,0x26,0x1a,0x08,0xff,0x25,0x19,0x07,0xff,0x26,0x1a,0x08,0xff,0x27,0x1a,0x0a,0xff,0x26,0x19,0x09,0xff,0x25,0x19,0x09,0xff,0x27,0x1a,0x0a,0xff,0x27,0x1a,0x0b,0xff,0x25,0x18,0x08,0xff,0x24,0x18,0x07,0xff,0x25,0x18,0x07,0xff,0x25,0x18,0x07,0xff,0x26,0x18,0x07,0xff,0x26,0x18,0x07,0xff,0x26,0x18,0x06,0xff,0x26,0x18,0x06,0xff,0x26,0x18,0x06,0xff,0x26,0x18,0x06,0xff,0x26,0x17,0x07,0xff,0x1a,0x0b,0x00,0xff,0x66,0x5c,0x52,0xb0,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x57,0xa4,0x71,0x54,0xff,0x6f,0x23,0x00,0xff,0x73,0x2d,0x01,0xff,0x6f,0x2d,0x00,0xff,0x6e,0x2e,0x01,0xff,0x6b,0x2f,0x01,0xff,0x6b,0x31,0x01,0xff,0x6a,0x31,0x01,0xff,0x69,0x31,0x01,0xff,0x67,0x30,0x01,0xff,0x66,0x30,0x02,0xff,0x65,0x30,0x02,0xff,0x65,0x31,0x02,0xff,0x64,0x31,0x02,0xff,0x63,0x31,0x02,0xff,0x60,0x30,0x01,0xff,0x61,0x31,0x01,0xff,0x61,0x31,0x02,0xff,0x60,0x31,0x01,0xff,0x5e,0x30,0x02,0xff,0x5c,0x2f,0x02,0xff,0x7a,0x42,0x02,0xff,0x6d,0x3a,0x02,0xff,0x6c,0x38,0x01,0xff,0x9e,0x55,0x02,0xff,0xa9,0x5c,0x01,0xff,0x9a,0x51,0x02,0xff,0xa5,0x58,0x01,0xff,0xaf,0x5f,0x02,0xff,0xb6,0x64,0x02,0xff,0xa7,0x5d,0x02,0xff,0x7c,0x46,0x01,0xff,0x6a,0x3c,0x01,0xff,0x71,0x40,0x02,0xff,0x7c,0x48,0x03,0xff,0x83,0x4a,0x02,0xff,0x92,0x51,0x01,0xff,0x8b,0x51,0x03,0xff,0x4d,0x2f,0x03,0xff,0x16,0x12,0x01,0xff,0x13,0x10,0x02,0xff,0x14,0x12,0x01,0xff,0x1e,0x16,0x01,0xff,0x2c,0x21,0x01,0xff,0x38,0x29,0x01,0xff,0x2c,0x1f,0x03,0xff,0x2f,0x21,0x01,0xff,0x3b,0x29,0x02,0xff,0x1b,0x16,0x01,0xff,0x09,0x07,0x01,0xff,0x1a,0x11,0x02,0xff,0x30,0x23,0x01,0xff,0x32,0x23,0x03,0xff,0x2f,0x22,0x02,0xff,0x2f,0x21,0x03,0xff,0x32,0x23,0x01,0xff,0x31,0x22,0x02,0xff,0x16,0x0e,0x03,0xff,0x10,0x0e,0x04,0xff,0x11,0x0a,0x02,0xff,0x47,0x31,0x05,0xff,0x2b,0x1f,0x06,0xff,0x0d,0x08,0x06,0xff,0x25,0x22,0x1e,0xff,0x36,0x38,0x33,0xff,0x5b,0x61,0x5a,0xff,0x9d,0xa0,0xa1,0xff,0x9e,0xa4,0xb7,0xff,0x8c,0x97,0xc2,0xff,0xd9,0xe2,0xf2,0xff,0xff,0xff,0xff,0xff,0xa8,0xd4,0xf7,0xff,0x49,0xae,0xf9,0xff,0x38,0xb1,0xfc,0xff,0x2e,0xb5,0xfb,0xff,0x19,0xb4,0xfe,0xff,0x14,0xb6,0xfe,0xff,0x0f,0x9f,0xf7,0xff,0x15,0x4c,0x7c,0xff,0x11,0x12,0x17,0xff,0x1e,0x21,0x26,0xff,0x14,0x13,0x17,0xff,0x13,0x10,0x1a,0xff,0x11,0x10,0x18,0xff,0x12,0x14,0x20,0xff,0x1c,0x1c,0x2d,0xff,0x20,0x1c,0x31,0xff,0x25,0x1e,0x33,0xff,0x2f,0x24,0x37,0xff,0x41,0x36,0x47,0xff,0x50,0x48,0x58,0xff,0x54,0x50,0x64,0xff,0x58,0x5b,0x70,0xff,0x7b,0x82,0x9c,0xff,0x79,0x7d,0x9e,0xff,0x87,0x90,0xae,0xff,0xa4,0xae,0xcc,0xff,0xae,0xbb,0xd6,0xff,0x8f,0x99,0xb9,0xff,0x8a,0x92,0xb6,0xff,0xb5,0xc0,0xe0,0xff,0xd8,0xe4,0xf8,0xff,0xda,0xe6,0xf7,0xff,0x93,0xa3,0xc9,0xff,0x9b,0xa8,0xd5,0xff,0xe5,0xf3,0xff,0xff,0xa3,0xa5,0xb1,0xff,0x19,0x12,0x30,0xff,0x79,0x84,0xa9,0xff,0xd8,0xe6,0xef,0xff,0x3e,0x34,0x2f,0xff,0x22,0x15,0x04,0xff,0x2a,0x1d,0x0b,0xff,0x2b,0x1c,0x0c,0xff,0x2a,0x1b,0x0a,0xff,0x2b,0x1d,0x0b,0xff,0x29,0x1c,0x09,0xff,0x29,0x1b,0x09,0xff,0x29,0x1b,0x09,0xff,0x28,0x1b,0x09,0xff,0x29,0x1c,0x0a,0xff,0x27,0x1a,0x08,0xff,0x26,0x1a,0x09,0xff,0x27,0x1b,0x0a,0xff,0x26,0x19,0x08,0xff,0x26,0x19,0x0a,0xff,0x26,0x19,0x09,0xff,0x26,0x19,0x09,0xff,0x26,0x19,0x09,0xff,0x25,0x19,0x09,0xff,0x25,0x19,0x09,0xff,0x24,0x18,0x08,0xff,0x24,0x18,0x07,0xff,0x26,0x19,0x08,0xff,0x25,0x18,0x07,0xff,0x26,0x17,0x06,0xff,0x26,0x18,0x06,0xff,0x26,0x18,0x06,0xff,0x25,0x17,0x05,0xff,0x25,0x17,0x05,0xff,0x25,0x17,0x06,0xff,0x18,0x0b,0x00,0xff,0x61,0x58,0x4c,0xb7,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x5a,0xa3,0x6e,0x50,0xff,0x71,0x22,0x00,0xff,0x74,0x2d,0x02,0xff,0x71,0x2d,0x01,0xff,0x6e,0x2f,0x02,0xff,0x6b,0x30,0x01,0xff,0x6b,0x31,0x01,0xff,0x6b,0x31,0x02,0xff,0x69,0x30,0x02,0xff,0x68,0x30,0x02,0xff,0x66,0x30,0x02,0xff,0x65,0x30,0x02,0xff,0x64,0x30,0x01,0xff,0x65,0x31,0x01,0xff,0x65,0x32,0x01,0xff,0x61,0x30,0x02,0xff,0x61,0x2f,0x01,0xff,0x63,0x31,0x01,0xff,0x62,0x32,0x02,0xff,0x5e,0x32,0x03,0xff,0x61,0x33,0x01,0xff,0x84,0x47,0x04,0xff,0x67,0x32,0x01,0xff,0x78,0x3f,0x02,0xff,0xaa,0x5b,0x01,0xff,0xaa,0x5b,0x03,0xff,0xa1,0x53,0x01,0xff,0xb2,0x5e,0x02,0xff,0xb6,0x63,0x02,0xff,0xb1,0x63,0x02,0xff,0x89,0x49,0x00,0xff,0x71,0x3d,0x00,0xff,0x78,0x45,0x02,0xff,0x81,0x48,0x02,0xff,0x8b,0x4c,0x02,0xff,0x99,0x53,0x01,0xff,0x92,0x53,0x03,0xff,0x41,0x25,0x04,0xff,0x18,0x0f,0x01,0xff,0x11,0x0c,0x01,0xff,0x1f,0x16,0x01,0xff,0x36,0x25,0x01,0xff,0x4b,0x31,0x02,0xff,0x57,0x38,0x01,0xff,0x5b,0x3a,0x02,0xff,0x2d,0x1c,0x03,0xff,0x50,0x32,0x03,0xff,0x56,0x34,0x02,0xff,0x3b,0x26,0x02,0xff,0x27,0x1d,0x01,0xff,0x23,0x1a,0x01,0xff,0x31,0x25,0x01,0xff,0x34,0x25,0x02,0xff,0x2e,0x20,0x02,0xff,0x2e,0x21,0x01,0xff,0x31,0x22,0x02,0xff,0x34,0x26,0x01,0xff,0x24,0x1b,0x02,0xff,0x0f,0x0c,0x04,0xff,0x15,0x0f,0x02,0xff,0x25,0x18,0x03,0xff,0x2d,0x23,0x05,0xff,0x16,0x0f,0x07,0xff,0x27,0x23,0x1d,0xff,0x32,0x31,0x2c,0xff,0x53,0x58,0x50,0xff,0x8c,0x94,0x8d,0xff,0xa8,0xac,0xb7,0xff,0x86,0x8f,0xb9,0xff,0xc9,0xd1,0xe7,0xff,0xff,0xff,0xff,0xff,0xc0,0xdd,0xf8,0xff,0x5a,0xb4,0xf8,0xff,0x3a,0xb1,0xfb,0xff,0x43,0xb8,0xfc,0xff,0x21,0xb1,0xfd,0xff,0x18,0xb4,0xfe,0xff,0x13,0xb6,0xfe,0xff,0x11,0x99,0xee,0xff,0x14,0x44,0x6c,0xff,0x1a,0x17,0x23,0xff,0x10,0x10,0x14,0xff,0x0d,0x0d,0x0f,0xff,0x10,0x12,0x18,0xff,0x0c,0x0e,0x14,0xff,0x17,0x17,0x27,0xff,0x1f,0x1c,0x31,0xff,0x24,0x1e,0x35,0xff,0x29,0x1f,0x34,0xff,0x32,0x27,0x39,0xff,0x3a,0x2f,0x3e,0xff,0x41,0x38,0x46,0xff,0x43,0x3f,0x4f,0xff,0x5a,0x59,0x6e,0xff,0x5e,0x60,0x79,0xff,0x5e,0x5e,0x75,0xff,0x64,0x67,0x81,0xff,0xa7,0xb2,0xcd,0xff,0xa9,0xb8,0xd4,0xff,0x73,0x7b,0x9d,0xff,0x6b,0x6f,0x90,0xff,0xb7,0xbf,0xdf,0xff,0xe6,0xf5,0xff,0xff,0xbb,0xcb,0xe3,0xff,0x76,0x85,0xaf,0xff,0xca,0xda,0xf5,0xff,0xb3,0xbb,0xc5,0xff,0x27,0x14,0x25,0xff,0x50,0x4c,0x6b,0xff,0xb6,0xc5,0xd5,0xff,0x38,0x2d,0x26,0xff,0x25,0x17,0x04,0xff,0x29,0x1b,0x0c,0xff,0x2b,0x1c,0x0c,0xff,0x2b,0x1c,0x0d,0xff,0x29,0x1b,0x0a,0xff,0x2a,0x1c,0x09,0xff,0x2a,0x1c,0x09,0xff,0x28,0x1b,0x08,0xff,0x25,0x19,0x08,0xff,0x26,0x1a,0x08,0xff,0x26,0x1b,0x08,0xff,0x26,0x1a,0x0a,0xff,0x26,0x1a,0x0a,0xff,0x25,0x19,0x09,0xff,0x25,0x18,0x08,0xff,0x26,0x1a,0x0a,0xff,0x26,0x19,0x09,0xff,0x25,0x18,0x08,0xff,0x24,0x17,0x08,0xff,0x24,0x18,0x08,0xff,0x25,0x19,0x08,0xff,0x25,0x19,0x06,0xff,0x25,0x19,0x07,0xff,0x24,0x18,0x06,0xff,0x25,0x17,0x06,0xff,0x27,0x19,0x07,0xff,0x26,0x18,0x06,0xff,0x24,0x18,0x06,0xff,0x23,0x18,0x06,0xff,0x23,0x18,0x06,0xff,0x19,0x0c,0x00,0xff,0x5e,0x55,0x49,0xbb,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x5a,0xa3,0x6e,0x51,0xff,0x70,0x22,0x00,0xff,0x75,0x2e,0x02,0xff,0x72,0x2e,0x01,0xff,0x6e,0x2f,0x01,0xff,0x6f,0x32,0x02,0xff,0x6d,0x31,0x01,0xff,0x6b,0x31,0x02,0xff,0x6a,0x31,0x01,0xff,0x68,0x31,0x01,0xff,0x68,0x31,0x02,0xff,0x66,0x31,0x02,0xff,0x66,0x31,0x01,0xff,0x66,0x31,0x01,0xff,0x67,0x32,0x02,0xff,0x66,0x32,0x02,0xff,0x64,0x31,0x02,0xff,0x63,0x31,0x01,0xff,0x63,0x33,0x02,0xff,0x60,0x31,0x01,0xff,0x6b,0x39,0x01,0xff,0x83,0x49,0x03,0xff,0x6c,0x36,0x00,0xff,0x97,0x4e,0x02,0xff,0xb5,0x60,0x02,0xff,0xad,0x5b,0x01,0xff,0xb1,0x5e,0x01,0xff,0xbd,0x65,0x01,0xff,0xb6,0x63,0x02,0xff,0x97,0x50,0x01,0xff,0x7c,0x42,0x02,0xff,0x81,0x46,0x03,0xff,0x8f,0x4d,0x01,0xff,0x90,0x4d,0x01,0xff,0x97,0x52,0x02,0xff,0x9e,0x57,0x02,0xff,0x68,0x3c,0x01,0xff,0x1b,0x12,0x02,0xff,0x0b,0x09,0x03,0xff,0x35,0x20,0x03,0xff,0x3e,0x24,0x01,0xff,0x61,0x39,0x02,0xff,0x64,0x3a,0x02,0xff,0x6b,0x3f,0x01,0xff,0x5a,0x36,0x04,0xff,0x2c,0x1c,0x04,0xff,0x5f,0x3b,0x02,0xff,0x55,0x33,0x00,0xff,0x4a,0x30,0x00,0xff,0x37,0x28,0x02,0xff,0x27,0x1f,0x03,0xff,0x22,0x19,0x01,0xff,0x2e,0x23,0x04,0xff,0x30,0x22,0x02,0xff,0x2d,0x20,0x01,0xff,0x32,0x24,0x03,0xff,0x30,0x25,0x01,0xff,0x31,0x25,0x01,0xff,0x1a,0x10,0x03,0xff,0x13,0x0f,0x03,0xff,0x12,0x0d,0x03,0xff,0x2a,0x22,0x05,0xff,0x1d,0x17,0x05,0xff,0x19,0x12,0x0d,0xff,0x2a,0x24,0x20,0xff,0x4e,0x4e,0x4a,0xff,0x98,0xa4,0x98,0xff,0xb0,0xb9,0xb5,0xff,0xac,0xb6,0xc8,0xff,0xca,0xd4,0xe4,0xff,0xff,0xff,0xff,0xff,0xde,0xea,0xf9,0xff,0x6a,0xb9,0xf8,0xff,0x41,0xaf,0xfb,0xff,0x49,0xb9,0xfd,0xff,0x3e,0xba,0xfd,0xff,0x14,0xae,0xfd,0xff,0x1c,0xb9,0xfd,0xff,0x21,0xb6,0xff,0xff,0x1d,0x9d,0xec,0xff,0x39,0x53,0x6a,0xff,0x37,0x3a,0x3c,0xff,0x25,0x2a,0x31,0xff,0x2e,0x34,0x39,0xff,0x0a,0x0b,0x11,0xff,0x0e,0x0e,0x17,0xff,0x1c,0x1a,0x2c,0xff,0x23,0x1e,0x34,0xff,0x25,0x1f,0x35,0xff,0x26,0x1f,0x33,0xff,0x28,0x21,0x33,0xff,0x2f,0x26,0x33,0xff,0x37,0x2a,0x37,0xff,0x4b,0x44,0x57,0xff,0x62,0x65,0x7a,0xff,0x5f,0x5d,0x72,0xff,0x4e,0x4d,0x61,0xff,0x7f,0x82,0xa0,0xff,0xc6,0xd5,0xee,0xff,0x87,0x8f,0xa6,0xff,0x24,0x1e,0x32,0xff,0x49,0x4a,0x70,0xff,0xba,0xcb,0xe9,0xff,0xb4,0xbf,0xce,0xff,0x2a,0x30,0x58,0xff,0x89,0x99,0xbc,0xff,0xd9,0xe9,0xf9,0xff,0x64,0x57,0x63,0xff,0x42,0x2e,0x3b,0xff,0x44,0x3d,0x3e,0xff,0x26,0x19,0x07,0xff,0x28,0x1b,0x0b,0xff,0x29,0x1b,0x0d,0xff,0x2a,0x1b,0x0c,0xff,0x2a,0x1b,0x0c,0xff,0x2b,0x1c,0x0c,0xff,0x28,0x1b,0x09,0xff,0x29,0x1b,0x09,0xff,0x29,0x1c,0x0a,0xff,0x27,0x1b,0x09,0xff,0x28,0x1c,0x0a,0xff,0x26,0x19,0x08,0xff,0x26,0x19,0x09,0xff,0x26,0x19,0x09,0xff,0x26,0x1a,0x0a,0xff,0x25,0x19,0x07,0xff,0x25,0x19,0x07,0xff,0x26,0x1a,0x08,0xff,0x25,0x19,0x07,0xff,0x25,0x19,0x08,0xff,0x25,0x19,0x07,0xff,0x25,0x19,0x07,0xff,0x24,0x19,0x06,0xff,0x25,0x1a,0x07,0xff,0x25,0x19,0x06,0xff,0x27,0x19,0x06,0xff,0x28,0x1a,0x08,0xff,0x28,0x1a,0x08,0xff,0x27,0x1a,0x08,0xff,0x24,0x17,0x05,0xff,0x24,0x18,0x06,0xff,0x1a,0x0d,0x00,0xff,0x5e,0x55,0x49,0xbb,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x56,0xa6,0x72,0x55,0xff,0x72,0x23,0x00,0xff,0x76,0x2d,0x01,0xff,0x73,0x2e,0x02,0xff,0x6f,0x2e,0x01,0xff,0x70,0x30,0x01,0xff,0x6d,0x30,0x01,0xff,0x6a,0x31,0x01,0xff,0x69,0x30,0x01,0xff,0x69,0x31,0x01,0xff,0x69,0x30,0x02,0xff,0x69,0x31,0x02,0xff,0x67,0x32,0x01,0xff,0x67,0x31,0x02,0xff,0x68,0x31,0x02,0xff,0x67,0x32,0x01,0xff,0x66,0x32,0x02,0xff,0x64,0x31,0x01,0xff,0x62,0x32,0x02,0xff,0x62,0x31,0x01,0xff,0x70,0x3a,0x02,0xff,0x9e,0x51,0x02,0xff,0x9e,0x4e,0x02,0xff,0xb5,0x5c,0x00,0xff,0xb9,0x62,0x02,0xff,0xb9,0x62,0x02,0xff,0xbf,0x68,0x02,0xff,0xbd,0x67,0x02,0xff,0xa7,0x59,0x01,0xff,0x8d,0x4a,0x01,0xff,0x8f,0x4c,0x02,0xff,0x97,0x50,0x01,0xff,0x99,0x51,0x02,0xff,0x9e,0x54,0x02,0xff,0xa2,0x56,0x01,0xff,0x83,0x49,0x03,0xff,0x3c,0x25,0x01,0xff,0x30,0x20,0x01,0xff,0x4d,0x2d,0x02,0xff,0x4d,0x2b,0x06,0xff,0x4e,0x2a,0x02,0xff,0x65,0x3c,0x02,0xff,0x64,0x3c,0x02,0xff,0x6d,0x41,0x03,0xff,0x49,0x2c,0x03,0xff,0x2f,0x1f,0x04,0xff,0x42,0x2a,0x03,0xff,0x33,0x21,0x00,0xff,0x24,0x1a,0x00,0xff,0x15,0x12,0x01,0xff,0x0f,0x0f,0x01,0xff,0x0d,0x0c,0x01,0xff,0x1d,0x18,0x02,0xff,0x30,0x23,0x02,0xff,0x2e,0x20,0x02,0xff,0x30,0x22,0x01,0xff,0x30,0x24,0x01,0xff,0x32,0x25,0x01,0xff,0x2d,0x21,0x02,0xff,0x11,0x0d,0x03,0xff,0x13,0x0f,0x04,0xff,0x1d,0x15,0x02,0xff,0x1d,0x18,0x05,0xff,0x16,0x10,0x0a,0xff,0x2c,0x2a,0x26,0xff,0x42,0x47,0x44,0xff,0x7d,0x85,0x78,0xff,0xbc,0xc6,0xbc,0xff,0xd8,0xdf,0xde,0xff,0xdd,0xe3,0xe8,0xff,0xfe,0xfe,0xfe,0xff,0xf8,0xf9,0xfe,0xff,0x8b,0xc2,0xfa,0xff,0x3f,0xac,0xf9,0xff,0x41,0xb4,0xfa,0xff,0x5d,0xc5,0xfc,0xff,0x1c,0xb0,0xfd,0xff,0x1b,0xb2,0xfe,0xff,0x26,0xc3,0xff,0xff,0x28,0x88,0xbb,0xff,0x4b,0x67,0x8b,0xff,0xa0,0xae,0xb2,0xff,0x61,0x69,0x6d,0xff,0x31,0x37,0x3b,0xff,0x1c,0x1c,0x22,0xff,0x07,0x08,0x0c,0xff,0x13,0x13,0x1f,0xff,0x1e,0x1c,0x2f,0xff,0x22,0x1e,0x33,0xff,0x21,0x1d,0x31,0xff,0x20,0x1d,0x32,0xff,0x28,0x21,0x33,0xff,0x2e,0x23,0x30,0xff,0x2d,0x23,0x30,0xff,0x4b,0x44,0x57,0xff,0x66,0x63,0x7c,0xff,0x55,0x52,0x68,0xff,0x54,0x54,0x6b,0xff,0xa7,0xae,0xc7,0xff,0xd6,0xdf,0xee,0xff,0x31,0x2d,0x3e,0xff,0x0d,0x09,0x19,0xff,0x66,0x6d,0x92,0xff,0xba,0xc4,0xd6,0xff,0x2d,0x2f,0x58,0xff,0x52,0x58,0x83,0xff,0xcb,0xdd,0xf9,0xff,0xa6,0xa8,0xac,0xff,0x20,0x11,0x07,0xff,0x23,0x13,0x02,0xff,0x2a,0x1b,0x0b,0xff,0x29,0x1b,0x0a,0xff,0x2a,0x1c,0x0b,0xff,0x29,0x1b,0x0b,0xff,0x2a,0x1b,0x0c,0xff,0x29,0x1a,0x09,0xff,0x28,0x1a,0x09,0xff,0x29,0x1b,0x09,0xff,0x27,0x1a,0x08,0xff,0x27,0x1b,0x09,0xff,0x26,0x1b,0x08,0xff,0x25,0x19,0x08,0xff,0x25,0x19,0x09,0xff,0x24,0x18,0x07,0xff,0x26,0x19,0x09,0xff,0x25,0x19,0x07,0xff,0x25,0x19,0x07,0xff,0x25,0x19,0x07,0xff,0x25,0x19,0x07,0xff,0x25,0x19,0x06,0xff,0x25,0x19,0x07,0xff,0x24,0x19,0x05,0xff,0x25,0x19,0x06,0xff,0x25,0x19,0x05,0xff,0x25,0x19,0x05,0xff,0x26,0x19,0x04,0xff,0x27,0x1a,0x07,0xff,0x28,0x1a,0x0a,0xff,0x28,0x1a,0x08,0xff,0x26,0x18,0x07,0xff,0x26,0x17,0x05,0xff,0x19,0x0b,0x00,0xff,0x60,0x57,0x4c,0xb6,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x50,0xaa,0x77,0x5c,0xff,0x73,0x23,0x00,0xff,0x76,0x2d,0x02,0xff,0x75,0x2e,0x03,0xff,0x73,0x2f,0x02,0xff,0x6f,0x2f,0x02,0xff,0x6d,0x30,0x02,0xff,0x6d,0x30,0x03,0xff,0x6b,0x31,0x02,0xff,0x6a,0x30,0x02,0xff,0x69,0x30,0x02,0xff,0x68,0x2f,0x01,0xff,0x69,0x30,0x02,0xff,0x68,0x30,0x01,0xff,0x67,0x31,0x02,0xff,0x67,0x30,0x02,0xff,0x65,0x31,0x01,0xff,0x65,0x32,0x00,0xff,0x63,0x31,0x02,0xff,0x61,0x30,0x01,0xff,0x78,0x3d,0x01,0xff,0xb9,0x5c,0x02,0xff,0xc1,0x62,0x01,0xff,0xc2,0x66,0x01,0xff,0xbe,0x66,0x02,0xff,0xbf,0x68,0x02,0xff,0xbc,0x65,0x02,0xff,0xab,0x5d,0x01,0xff,0x94,0x50,0x00,0xff,0x91,0x4d,0x01,0xff,0x9b,0x54,0x01,0xff,0x9b,0x53,0x01,0xff,0x9b,0x53,0x01,0xff,0x99,0x52,0x01,0xff,0x93,0x50,0x00,0xff,0x70,0x3f,0x01,0xff,0x44,0x28,0x01,0xff,0x62,0x39,0x01,0xff,0x7d,0x48,0x02,0xff,0x5b,0x35,0x06,0xff,0x47,0x27,0x03,0xff,0x71,0x43,0x02,0xff,0x70,0x42,0x03,0xff,0x70,0x43,0x03,0xff,0x38,0x22,0x01,0xff,0x25,0x19,0x03,0xff,0x25,0x19,0x01,0xff,0x25,0x18,0x01,0xff,0x1f,0x16,0x01,0xff,0x1f,0x16,0x02,0xff,0x23,0x1a,0x01,0xff,0x2e,0x1f,0x02,0xff,0x34,0x22,0x01,0xff,0x31,0x22,0x03,0xff,0x2d,0x20,0x01,0xff,0x2f,0x22,0x02,0xff,0x30,0x24,0x01,0xff,0x32,0x25,0x02,0xff,0x36,0x28,0x03,0xff,0x1c,0x16,0x03,0xff,0x13,0x0d,0x04,0xff,0x14,0x12,0x04,0xff,0x19,0x13,0x05,0xff,0x13,0x0f,0x08,0xff,0x21,0x1c,0x14,0xff,0x32,0x36,0x36,0xff,0x50,0x57,0x4f,0xff,0xa5,0xb0,0x9f,0xff,0xce,0xd5,0xcd,0xff,0xde,0xe4,0xe5,0xff,0xfb,0xfc,0xfd,0xff,0xff,0xff,0xfe,0xff,0xab,0xcd,0xf7,0xff,0x4b,0xac,0xf7,0xff,0x32,0xab,0xf7,0xff,0x67,0xc6,0xfc,0xff,0x37,0xb8,0xfc,0xff,0x18,0xb1,0xfe,0xff,0x31,0xc7,0xff,0xff,0x20,0x56,0x75,0xff,0x0d,0x10,0x22,0xff,0x62,0x6d,0x7d,0xff,0xa6,0xb1,0xb1,0xff,0x32,0x36,0x39,0xff,0x1e,0x1e,0x23,0xff,0x11,0x11,0x17,0xff,0x09,0x0b,0x10,0xff,0x18,0x18,0x24,0xff,0x20,0x1f,0x33,0xff,0x1f,0x1e,0x32,0xff,0x1e,0x1c,0x31,0xff,0x1f,0x1b,0x31,0xff,0x29,0x21,0x33,0xff,0x2d,0x21,0x2f,0xff,0x33,0x25,0x34,0xff,0x4f,0x4e,0x5f,0xff,0x46,0x45,0x58,0xff,0x3a,0x36,0x47,0xff,0x55,0x56,0x74,0xff,0xc8,0xd3,0xea,0xff,0x75,0x77,0x86,0xff,0x0b,0x05,0x10,0xff,0x2c,0x2e,0x4d,0xff,0xbc,0xc9,0xe3,0xff,0x71,0x76,0x92,0xff,0x27,0x25,0x53,0xff,0x99,0xa7,0xcb,0xff,0xb5,0xc0,0xc9,0xff,0x25,0x17,0x0b,0xff,0x27,0x1a,0x0a,0xff,0x28,0x1a,0x0b,0xff,0x29,0x1a,0x09,0xff,0x29,0x1b,0x0a,0xff,0x28,0x19,0x0a,0xff,0x29,0x1a,0x0b,0xff,0x29,0x1a,0x09,0xff,0x28,0x1a,0x08,0xff,0x29,0x1b,0x09,0xff,0x27,0x1a,0x09,0xff,0x27,0x1c,0x09,0xff,0x26,0x1b,0x09,0xff,0x26,0x1a,0x08,0xff,0x26,0x1a,0x08,0xff,0x26,0x1a,0x08,0xff,0x27,0x1a,0x08,0xff,0x28,0x1b,0x0a,0xff,0x25,0x19,0x07,0xff,0x25,0x1a,0x06,0xff,0x25,0x18,0x05,0xff,0x27,0x1a,0x06,0xff,0x26,0x19,0x06,0xff,0x26,0x19,0x05,0xff,0x26,0x19,0x05,0xff,0x25,0x18,0x05,0xff,0x26,0x19,0x05,0xff,0x28,0x1a,0x06,0xff,0x29,0x1b,0x08,0xff,0x2b,0x1c,0x0c,0xff,0x2c,0x1b,0x0c,0xff,0x29,0x1a,0x09,0xff,0x27,0x19,0x07,0xff,0x19,0x0d,0x00,0xff,0x66,0x5e,0x52,0xaf,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x47,0xb0,0x81,0x67,0xff,0x74,0x24,0x00,0xff,0x76,0x2b,0x00,0xff,0x75,0x2e,0x01,0xff,0x74,0x2f,0x01,0xff,0x71,0x30,0x02,0xff,0x6e,0x2f,0x01,0xff,0x6e,0x31,0x02,0xff,0x6d,0x31,0x02,0xff,0x6b,0x31,0x02,0xff,0x6a,0x30,0x01,0xff,0x6a,0x31,0x02,0xff,0x69,0x31,0x03,0xff,0x69,0x31,0x02,0xff,0x67,0x31,0x01,0xff,0x68,0x32,0x02,0xff,0x67,0x31,0x01,0xff,0x66,0x31,0x01,0xff,0x68,0x32,0x03,0xff,0x5f,0x31,0x01,0xff,0x7d,0x3f,0x01,0xff,0xcb,0x65,0x02,0xff,0xcc,0x69,0x03,0xff,0xc3,0x65,0x01,0xff,0xbc,0x64,0x02,0xff,0xba,0x63,0x01,0xff,0xaf,0x5f,0x01,0xff,0x93,0x50,0x01,0xff,0x8c,0x4d,0x01,0xff,0x95,0x51,0x01,0xff,0x91,0x4e,0x02,0xff,0x8f,0x4d,0x02,0xff,0x8d,0x4e,0x01,0xff,0x81,0x4a,0x02,0xff,0x7b,0x47,0x02,0xff,0x75,0x44,0x02,0xff,0x62,0x39,0x01,0xff,0x78,0x45,0x02,0xff,0x7c,0x47,0x01,0xff,0x77,0x44,0x03,0xff,0x38,0x20,0x04,0xff,0x52,0x33,0x03,0xff,0x67,0x3e,0x02,0xff,0x61,0x3a,0x02,0xff,0x27,0x18,0x03,0xff,0x35,0x23,0x03,0xff,0x30,0x1e,0x01,0xff,0x2e,0x1d,0x02,0xff,0x37,0x22,0x01,0xff,0x43,0x29,0x01,0xff,0x4d,0x31,0x01,0xff,0x50,0x33,0x02,0xff,0x49,0x2f,0x01,0xff,0x39,0x27,0x02,0xff,0x2f,0x22,0x01,0xff,0x31,0x23,0x02,0xff,0x33,0x24,0x02,0xff,0x35,0x26,0x01,0xff,0x38,0x29,0x00,0xff,0x31,0x25,0x01,0xff,0x13,0x0f,0x02,0xff,0x17,0x11,0x06,0xff,0x12,0x0f,0x04,0xff,0x14,0x10,0x07,0xff,0x14,0x0f,0x08,0xff,0x2f,0x2e,0x2c,0xff,0x4e,0x57,0x5a,0xff,0x86,0x90,0x85,0xff,0xcd,0xd6,0xcd,0xff,0xc1,0xcc,0xcc,0xff,0xef,0xf2,0xf3,0xff,0xff,0xff,0xff,0xff,0xc1,0xd2,0xf4,0xff,0x68,0xac,0xf6,0xff,0x33,0xa9,0xf8,0xff,0x51,0xbb,0xfb,0xff,0x53,0xc2,0xfb,0xff,0x23,0xb0,0xfd,0xff,0x3c,0xc2,0xff,0xff,0x38,0x9d,0xce,0xff,0x09,0x0c,0x18,0xff,0x18,0x33,0x5a,0xff,0x65,0x7b,0x90,0xff,0x75,0x80,0x7e,0xff,0x17,0x19,0x1a,0xff,0x19,0x19,0x1e,0xff,0x0b,0x0c,0x0f,0xff,0x12,0x13,0x1c,0xff,0x1c,0x1c,0x2d,0xff,0x1f,0x1f,0x34,0xff,0x1e,0x1f,0x34,0xff,0x1d,0x1c,0x33,0xff,0x21,0x1b,0x31,0xff,0x29,0x1f,0x30,0xff,0x2c,0x1f,0x2e,0xff,0x58,0x55,0x66,0xff,0x33,0x33,0x40,0xff,0x10,0x0e,0x1a,0xff,0x21,0x21,0x37,0xff,0x75,0x80,0xa1,0xff,0x9e,0xa9,0xbe,0xff,0x1a,0x16,0x20,0xff,0x1c,0x1e,0x31,0xff,0x90,0x9d,0xbe,0xff,0xc6,0xd0,0xe1,0xff,0x32,0x33,0x55,0xff,0x52,0x54,0x7f,0xff,0x6a,0x6d,0x77,0xff,0x23,0x13,0x06,0xff,0x28,0x1b,0x0c,0xff,0x29,0x1b,0x0b,0xff,0x2a,0x1b,0x0b,0xff,0x2a,0x1b,0x0b,0xff,0x29,0x1a,0x0b,0xff,0x2a,0x1b,0x0b,0xff,0x29,0x1b,0x0a,0xff,0x29,0x1b,0x09,0xff,0x29,0x1b,0x09,0xff,0x27,0x1a,0x08,0xff,0x25,0x19,0x07,0xff,0x26,0x1a,0x08,0xff,0x27,0x1b,0x09,0xff,0x27,0x1a,0x07,0xff,0x28,0x1a,0x07,0xff,0x28,0x1a,0x08,0xff,0x29,0x1c,0x08,0xff,0x27,0x1b,0x06,0xff,0x27,0x1b,0x05,0xff,0x28,0x1b,0x06,0xff,0x28,0x1c,0x07,0xff,0x28,0x1b,0x06,0xff,0x27,0x1a,0x05,0xff,0x28,0x1a,0x05,0xff,0x28,0x1a,0x05,0xff,0x29,0x1b,0x06,0xff,0x29,0x1b,0x05,0xff,0x2b,0x1c,0x08,0xff,0x2e,0x1d,0x0e,0xff,0x2f,0x1d,0x10,0xff,0x2e,0x1e,0x0e,0xff,0x28,0x1a,0x08,0xff,0x1c,0x0e,0x00,0xff,0x70,0x67,0x5b,0xa4,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x3c,0xb7,0x8b,0x75,0xff,0x73,0x22,0x00,0xff,0x77,0x2c,0x00,0xff,0x77,0x2e,0x02,0xff,0x74,0x2e,0x00,0xff,0x72,0x30,0x01,0xff,0x6f,0x2f,0x01,0xff,0x6f,0x31,0x01,0xff,0x6e,0x31,0x02,0xff,0x6d,0x30,0x02,0xff,0x6e,0x31,0x03,0xff,0x6b,0x30,0x02,0xff,0x68,0x30,0x02,0xff,0x69,0x31,0x02,0xff,0x67,0x31,0x02,0xff,0x6a,0x32,0x02,0xff,0x68,0x31,0x01,0xff,0x67,0x30,0x02,0xff,0x67,0x32,0x02,0xff,0x62,0x31,0x02,0xff,0x7b,0x3c,0x02,0xff,0xc9,0x65,0x03,0xff,0xc8,0x66,0x02,0xff,0xbf,0x62,0x02,0xff,0xb8,0x60,0x01,0xff,0xae,0x5b,0x01,0xff,0x9b,0x54,0x02,0xff,0x93,0x51,0x01,0xff,0x8b,0x4c,0x01,0xff,0x82,0x48,0x01,0xff,0x79,0x44,0x01,0xff,0x79,0x44,0x01,0xff,0x77,0x44,0x01,0xff,0x6a,0x3d,0x02,0xff,0x66,0x3c,0x03,0xff,0x6f,0x42,0x01,0xff,0x69,0x3f,0x02,0xff,0x6d,0x3f,0x02,0xff,0x67,0x3e,0x02,0xff,0x60,0x3a,0x01,0xff,0x42,0x2b,0x02,0xff,0x23,0x18,0x04,0xff,0x38,0x27,0x02,0xff,0x36,0x27,0x01,0xff,0x1c,0x14,0x01,0xff,0x4c,0x33,0x02,0xff,0x44,0x2b,0x03,0xff,0x3a,0x25,0x01,0xff,0x4a,0x2c,0x01,0xff,0x59,0x36,0x03,0xff,0x5a,0x39,0x02,0xff,0x50,0x33,0x02,0xff,0x3f,0x2b,0x04,0xff,0x35,0x25,0x03,0xff,0x27,0x1b,0x02,0xff,0x20,0x15,0x01,0xff,0x1d,0x15,0x03,0xff,0x26,0x1e,0x05,0xff,0x37,0x2c,0x0a,0xff,0x3c,0x2e,0x09,0xff,0x24,0x1b,0x03,0xff,0x1a,0x14,0x05,0xff,0x28,0x21,0x12,0xff,0x13,0x13,0x0b,0xff,0x11,0x10,0x0b,0xff,0x12,0x0f,0x0c,0xff,0x3b,0x42,0x46,0xff,0x67,0x75,0x74,0xff,0xd0,0xd8,0xce,0xff,0xd6,0xdf,0xdb,0xff,0xe7,0xec,0xeb,0xff,0xff,0xff,0xff,0xff,0xe2,0xe8,0xf7,0xff,0x80,0xb1,0xf0,0xff,0x38,0xa6,0xf8,0xff,0x40,0xb1,0xfa,0xff,0x74,0xcb,0xfc,0xff,0x2c,0xb3,0xfc,0xff,0x32,0xb4,0xfd,0xff,0x39,0xc6,0xff,0xff,0x22,0x57,0x78,0xff,0x09,0x0d,0x1e,0xff,0x44,0x58,0x6d,0xff,0x75,0x84,0x88,0xff,0x2f,0x31,0x33,0xff,0x12,0x12,0x16,0xff,0x14,0x14,0x19,0xff,0x12,0x14,0x1a,0xff,0x10,0x13,0x1f,0xff,0x17,0x19,0x2b,0xff,0x1d,0x21,0x37,0xff,0x20,0x23,0x3b,0xff,0x1c,0x1a,0x34,0xff,0x1d,0x18,0x2d,0xff,0x23,0x19,0x2c,0xff,0x68,0x65,0x79,0xff,0x38,0x38,0x47,0xff,0x13,0x14,0x22,0xff,0x1a,0x1b,0x2f,0xff,0x48,0x4f,0x6e,0xff,0x97,0xa5,0xba,0xff,0x19,0x15,0x22,0xff,0x19,0x16,0x26,0xff,0x52,0x5d,0x79,0xff,0xcd,0xdb,0xf7,0xff,0x7d,0x82,0x93,0xff,0x26,0x1e,0x27,0xff,0x22,0x15,0x0b,0xff,0x2a,0x19,0x0a,0xff,0x27,0x1a,0x0b,0xff,0x29,0x1a,0x0b,0xff,0x29,0x1b,0x0b,0xff,0x29,0x1a,0x0a,0xff,0x2a,0x1b,0x0c,0xff,0x2a,0x1b,0x0b,0xff,0x29,0x1b,0x0a,0xff,0x28,0x1a,0x08,0xff,0x29,0x1b,0x09,0xff,0x27,0x1a,0x08,0xff,0x26,0x1a,0x08,0xff,0x25,0x19,0x07,0xff,0x27,0x1b,0x09,0xff,0x28,0x1a,0x06,0xff,0x27,0x1a,0x06,0xff,0x28,0x1b,0x07,0xff,0x28,0x1b,0x06,0xff,0x29,0x1c,0x07,0xff,0x29,0x1d,0x06,0xff,0x28,0x1b,0x04,0xff,0x29,0x1c,0x05,0xff,0x29,0x1b,0x05,0xff,0x29,0x1b,0x05,0xff,0x2a,0x1b,0x04,0xff,0x2a,0x1b,0x05,0xff,0x2b,0x1d,0x06,0xff,0x2a,0x1b,0x04,0xff,0x2b,0x1c,0x07,0xff,0x31,0x1f,0x10,0xff,0x32,0x21,0x14,0xff,0x32,0x21,0x12,0xff,0x2a,0x1c,0x0a,0xff,0x1c,0x0e,0x00,0xff,0x79,0x71,0x64,0x95,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x2f,0xc0,0x98,0x85,0xfa,0x77,0x25,0x00,0xff,0x79,0x2b,0x01,0xff,0x77,0x2d,0x02,0xff,0x75,0x2e,0x01,0xff,0x72,0x2e,0x01,0xff,0x70,0x2f,0x01,0xff,0x6f,0x30,0x02,0xff,0x6f,0x31,0x03,0xff,0x6f,0x31,0x03,0xff,0x6d,0x31,0x02,0xff,0x6b,0x30,0x02,0xff,0x6a,0x31,0x02,0xff,0x67,0x30,0x01,0xff,0x66,0x31,0x01,0xff,0x67,0x31,0x01,0xff,0x65,0x31,0x00,0xff,0x65,0x32,0x01,0xff,0x66,0x33,0x01,0xff,0x64,0x31,0x01,0xff,0x6d,0x35,0x02,0xff,0xb7,0x5a,0x01,0xff,0xc5,0x62,0x02,0xff,0xc1,0x64,0x01,0xff,0xb6,0x5e,0x01,0xff,0x9a,0x54,0x01,0xff,0x89,0x4a,0x02,0xff,0x8f,0x4e,0x01,0xff,0x84,0x49,0x01,0xff,0x73,0x40,0x02,0xff,0x68,0x3b,0x00,0xff,0x6e,0x3f,0x01,0xff,0x68,0x3c,0x02,0xff,0x5e,0x37,0x01,0xff,0x64,0x3a,0x01,0xff,0x6f,0x44,0x01,0xff,0x64,0x3d,0x02,0xff,0x57,0x36,0x01,0xff,0x49,0x32,0x02,0xff,0x36,0x25,0x01,0xff,0x30,0x22,0x00,0xff,0x1c,0x14,0x02,0xff,0x11,0x0c,0x02,0xff,0x2f,0x23,0x02,0xff,0x1d,0x15,0x02,0xff,0x56,0x38,0x02,0xff,0x52,0x36,0x03,0xff,0x3d,0x2a,0x02,0xff,0x3d,0x28,0x02,0xff,0x39,0x25,0x02,0xff,0x2f,0x23,0x02,0xff,0x1c,0x12,0x04,0xff,0x16,0x11,0x03,0xff,0x4e,0x36,0x02,0xff,0x5c,0x40,0x04,0xff,0x38,0x27,0x02,0xff,0x29,0x1f,0x01,0xff,0x26,0x1b,0x01,0xff,0x22,0x1d,0x0a,0xff,0x3c,0x3a,0x2a,0xff,0x45,0x44,0x30,0xff,0x13,0x11,0x05,0xff,0x23,0x22,0x18,0xff,0x3c,0x3f,0x3d,0xff,0x0c,0x0c,0x08,0xff,0x10,0x0e,0x0c,0xff,0x12,0x14,0x13,0xff,0x3e,0x47,0x4c,0xff,0x96,0xa0,0x9d,0xff,0xe1,0xe7,0xe0,0xff,0xdf,0xe3,0xe4,0xff,0xff,0xff,0xff,0xff,0xfd,0xfb,0xfb,0xff,0x98,0xb9,0xec,0xff,0x41,0x98,0xf1,0xff,0x2f,0xa7,0xf8,0xff,0x7e,0xd0,0xfc,0xff,0x3e,0xb7,0xfc,0xff,0x23,0xb1,0xfe,0xff,0x2e,0xbf,0xff,0xff,0x2e,0xa5,0xdb,0xff,0x09,0x10,0x1c,0xff,0x19,0x37,0x5f,0xff,0x4b,0x69,0x87,0xff,0x65,0x6d,0x6c,0xff,0x17,0x16,0x19,0xff,0x18,0x17,0x1d,0xff,0x0d,0x0e,0x13,0xff,0x21,0x2a,0x41,0xff,0x1d,0x24,0x3c,0xff,0x12,0x15,0x2a,0xff,0x1c,0x20,0x38,0xff,0x22,0x25,0x40,0xff,0x1f,0x1e,0x38,0xff,0x19,0x19,0x2f,0xff,0x37,0x3b,0x51,0xff,0x31,0x34,0x46,0xff,0x29,0x31,0x46,0xff,0x21,0x26,0x3c,0xff,0x3e,0x48,0x61,0xff,0xa9,0xb7,0xc9,0xff,0x1e,0x1f,0x26,0xff,0x1d,0x1d,0x2b,0xff,0x2d,0x31,0x49,0xff,0xa2,0xb1,0xd2,0xff,0xa0,0xa6,0xab,0xff,0x19,0x0c,0x01,0xff,0x26,0x18,0x08,0xff,0x27,0x1b,0x0d,0xff,0x29,0x1b,0x0b,0xff,0x28,0x19,0x0a,0xff,0x2a,0x1b,0x0b,0xff,0x29,0x1b,0x0b,0xff,0x2a,0x1b,0x0b,0xff,0x29,0x1a,0x09,0xff,0x29,0x1b,0x09,0xff,0x28,0x1a,0x08,0xff,0x28,0x1a,0x08,0xff,0x27,0x19,0x07,0xff,0x27,0x19,0x07,0xff,0x27,0x19,0x07,0xff,0x27,0x1b,0x07,0xff,0x26,0x1b,0x06,0xff,0x27,0x1a,0x06,0xff,0x27,0x1a,0x05,0xff,0x29,0x1d,0x06,0xff,0x29,0x1d,0x05,0xff,0x29,0x1d,0x04,0xff,0x29,0x1b,0x03,0xff,0x29,0x1c,0x04,0xff,0x2b,0x1d,0x04,0xff,0x2b,0x1c,0x03,0xff,0x2c,0x1d,0x03,0xff,0x2c,0x1d,0x03,0xff,0x2b,0x1c,0x03,0xff,0x2b,0x1b,0x03,0xff,0x2f,0x1e,0x09,0xff,0x35,0x22,0x12,0xff,0x36,0x22,0x15,0xff,0x36,0x22,0x15,0xff,0x30,0x1e,0x0b,0xff,0x20,0x11,0x00,0xff,0x86,0x7e,0x71,0x84,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x1e,0xca,0xa9,0x97,0xf2,0x79,0x27,0x00,0xff,0x7a,0x2c,0x01,0xff,0x78,0x2d,0x01,0xff,0x74,0x2d,0x00,0xff,0x72,0x2e,0x01,0xff,0x73,0x30,0x02,0xff,0x70,0x30,0x01,0xff,0x6f,0x30,0x01,0xff,0x6e,0x30,0x01,0xff,0x6e,0x32,0x02,0xff,0x6c,0x31,0x01,0xff,0x6b,0x32,0x01,0xff,0x69,0x32,0x02,0xff,0x66,0x31,0x01,0xff,0x67,0x31,0x01,0xff,0x67,0x32,0x01,0xff,0x65,0x32,0x01,0xff,0x66,0x32,0x01,0xff,0x65,0x32,0x00,0xff,0x66,0x32,0x01,0xff,0xaa,0x53,0x02,0xff,0xc9,0x62,0x01,0xff,0xbe,0x61,0x01,0xff,0xae,0x5b,0x01,0xff,0x8c,0x4b,0x00,0xff,0x85,0x48,0x02,0xff,0x8a,0x4b,0x02,0xff,0x7d,0x47,0x01,0xff,0x6f,0x3f,0x01,0xff,0x6d,0x3d,0x01,0xff,0x71,0x41,0x03,0xff,0x64,0x39,0x01,0xff,0x63,0x39,0x01,0xff,0x79,0x4a,0x00,0xff,0x80,0x4f,0x03,0xff,0x5a,0x38,0x01,0xff,0x3c,0x2a,0x01,0xff,0x29,0x1e,0x01,0xff,0x1a,0x15,0x01,0xff,0x18,0x14,0x00,0xff,0x23,0x1a,0x02,0xff,0x25,0x1a,0x04,0xff,0x47,0x2f,0x04,0xff,0x2d,0x1d,0x02,0xff,0x61,0x41,0x02,0xff,0x44,0x2f,0x02,0xff,0x1d,0x15,0x01,0xff,0x17,0x11,0x02,0xff,0x13,0x11,0x01,0xff,0x11,0x0d,0x02,0xff,0x0c,0x0a,0x02,0xff,0x3b,0x2b,0x00,0xff,0x6e,0x49,0x01,0xff,0x6e,0x4c,0x01,0xff,0x4e,0x38,0x03,0xff,0x39,0x2b,0x01,0xff,0x34,0x27,0x02,0xff,0x36,0x26,0x00,0xff,0x28,0x20,0x04,0xff,0x34,0x38,0x2c,0xff,0x1f,0x22,0x1d,0xff,0x0b,0x08,0x01,0xff,0x29,0x2b,0x24,0xff,0x29,0x2c,0x25,0xff,0x0f,0x0f,0x0a,0xff,0x11,0x12,0x0e,0xff,0x1a,0x1f,0x21,0xff,0x41,0x49,0x48,0xff,0xca,0xd1,0xcd,0xff,0xe3,0xea,0xe6,0xff,0xfa,0xfa,0xfa,0xff,0xff,0xff,0xff,0xff,0xbb,0xcc,0xee,0xff,0x52,0x93,0xec,0xff,0x2b,0x99,0xf3,0xff,0x6b,0xc5,0xfc,0xff,0x54,0xbe,0xfe,0xff,0x21,0xb0,0xfd,0xff,0x23,0xb5,0xfd,0xff,0x28,0xc3,0xff,0xff,0x25,0x67,0x8c,0xff,0x06,0x0e,0x1f,0xff,0x3f,0x56,0x6f,0xff,0x6a,0x76,0x7a,0xff,0x38,0x3d,0x3f,0xff,0x12,0x12,0x14,0xff,0x10,0x0f,0x11,0xff,0x48,0x57,0x66,0xff,0x6e,0x8b,0xa3,0xff,0x20,0x2a,0x42,0xff,0x17,0x1a,0x32,0xff,0x20,0x2c,0x47,0xff,0x25,0x2f,0x4b,0xff,0x29,0x30,0x4c,0xff,0x1e,0x25,0x3b,0xff,0x4b,0x54,0x61,0xff,0x42,0x50,0x66,0xff,0x2c,0x35,0x50,0xff,0x29,0x2f,0x47,0xff,0xa7,0xb8,0xce,0xff,0x3f,0x44,0x53,0xff,0x1e,0x1f,0x31,0xff,0x26,0x2a,0x3d,0xff,0x79,0x89,0xa4,0xff,0xaa,0xb5,0xbe,0xff,0x1f,0x14,0x0d,0xff,0x25,0x18,0x0b,0xff,0x28,0x1b,0x0c,0xff,0x2a,0x1b,0x0c,0xff,0x29,0x19,0x0a,0xff,0x28,0x1a,0x0a,0xff,0x29,0x1a,0x0a,0xff,0x28,0x19,0x08,0xff,0x28,0x1a,0x08,0xff,0x28,0x1a,0x08,0xff,0x27,0x19,0x07,0xff,0x28,0x1a,0x08,0xff,0x27,0x19,0x07,0xff,0x27,0x19,0x08,0xff,0x27,0x19,0x07,0xff,0x29,0x1b,0x08,0xff,0x28,0x1b,0x07,0xff,0x29,0x1c,0x07,0xff,0x2a,0x1c,0x06,0xff,0x2b,0x1d,0x05,0xff,0x2a,0x1d,0x05,0xff,0x2b,0x1d,0x03,0xff,0x2a,0x1e,0x03,0xff,0x2a,0x1c,0x03,0xff,0x2c,0x1d,0x03,0xff,0x2d,0x1e,0x04,0xff,0x2c,0x1e,0x04,0xff,0x2c,0x1e,0x03,0xff,0x2d,0x1d,0x03,0xff,0x2d,0x1e,0x03,0xff,0x2f,0x1f,0x06,0xff,0x34,0x22,0x0f,0xff,0x36,0x23,0x14,0xff,0x38,0x24,0x17,0xff,0x34,0x23,0x0f,0xff,0x23,0x13,0x00,0xff,0x94,0x8c,0x7f,0x70,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x0c,0xd6,0xbb,0xae,0xe4,0x79,0x26,0x00,0xff,0x79,0x2b,0x00,0xff,0x78,0x2d,0x01,0xff,0x76,0x2e,0x01,0xff,0x76,0x2f,0x01,0xff,0x74,0x30,0x01,0xff,0x72,0x30,0x01,0xff,0x72,0x31,0x02,0xff,0x70,0x31,0x02,0xff,0x6f,0x31,0x02,0xff,0x6d,0x32,0x02,0xff,0x6b,0x32,0x02,0xff,0x6a,0x31,0x01,0xff,0x68,0x32,0x02,0xff,0x69,0x32,0x02,0xff,0x69,0x33,0x02,0xff,0x68,0x32,0x01,0xff,0x67,0x32,0x01,0xff,0x67,0x33,0x01,0xff,0x62,0x31,0x01,0xff,0x92,0x49,0x02,0xff,0xc6,0x63,0x02,0xff,0xb1,0x5c,0x00,0xff,0xa5,0x58,0x02,0xff,0x83,0x46,0x01,0xff,0x86,0x4b,0x01,0xff,0x8b,0x4f,0x02,0xff,0x79,0x44,0x01,0xff,0x73,0x42,0x01,0xff,0x7d,0x49,0x02,0xff,0x74,0x44,0x02,0xff,0x67,0x3b,0x01,0xff,0x7c,0x49,0x01,0xff,0x91,0x57,0x02,0xff,0x6e,0x42,0x03,0xff,0x39,0x26,0x01,0xff,0x1e,0x15,0x01,0xff,0x11,0x0e,0x01,0xff,0x1a,0x14,0x01,0xff,0x38,0x26,0x01,0xff,0x60,0x3e,0x02,0xff,0x64,0x3e,0x05,0xff,0x48,0x2d,0x06,0xff,0x32,0x20,0x03,0xff,0x38,0x26,0x02,0xff,0x1c,0x14,0x00,0xff,0x0c,0x0c,0x01,0xff,0x11,0x0e,0x03,0xff,0x17,0x17,0x01,0xff,0x12,0x0c,0x02,0xff,0x3e,0x2c,0x03,0xff,0x68,0x45,0x03,0xff,0x73,0x4d,0x01,0xff,0x6e,0x4b,0x01,0xff,0x5a,0x3e,0x02,0xff,0x49,0x35,0x03,0xff,0x37,0x27,0x02,0xff,0x31,0x26,0x02,0xff,0x31,0x27,0x02,0xff,0x14,0x0e,0x00,0xff,0x0a,0x0a,0x03,0xff,0x0e,0x0a,0x03,0xff,0x0f,0x0e,0x04,0xff,0x2e,0x32,0x28,0xff,0x34,0x39,0x32,0xff,0x11,0x14,0x10,0xff,0x11,0x14,0x10,0xff,0x15,0x1c,0x1a,0xff,0x5d,0x66,0x66,0xff,0xf1,0xf3,0xf2,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe9,0xeb,0xf6,0xff,0x67,0x96,0xe4,0xff,0x29,0x87,0xeb,0xff,0x52,0xb3,0xf7,0xff,0x65,0xc6,0xfd,0xff,0x1d,0xae,0xfd,0xff,0x28,0xb6,0xfd,0xff,0x2f,0xbd,0xff,0xff,0x33,0xb2,0xe8,0xff,0x0a,0x18,0x26,0xff,0x15,0x2f,0x50,0xff,0x4b,0x6c,0x8b,0xff,0x6b,0x74,0x73,0xff,0x19,0x19,0x1b,0xff,0x1a,0x18,0x1b,0xff,0x1d,0x1f,0x26,0xff,0x9a,0xc0,0xce,0xff,0x8a,0xa8,0xb7,0xff,0x20,0x28,0x40,0xff,0x23,0x2d,0x4a,0xff,0x2d,0x38,0x56,0xff,0x2d,0x35,0x53,0xff,0x1f,0x25,0x3b,0xff,0x4b,0x54,0x60,0xff,0x41,0x4b,0x64,0xff,0x2f,0x39,0x59,0xff,0x1a,0x21,0x34,0xff,0x7d,0x88,0xa5,0xff,0x5d,0x66,0x7c,0xff,0x28,0x2c,0x3f,0xff,0x31,0x37,0x49,0xff,0x4d,0x57,0x73,0xff,0x6a,0x6b,0x76,0xff,0x20,0x13,0x03,0xff,0x29,0x1a,0x0c,0xff,0x29,0x1a,0x0c,0xff,0x29,0x1a,0x0c,0xff,0x28,0x19,0x0a,0xff,0x28,0x1a,0x0a,0xff,0x2a,0x1c,0x0a,0xff,0x28,0x1a,0x08,0xff,0x28,0x1a,0x08,0xff,0x27,0x1a,0x07,0xff,0x28,0x1a,0x08,0xff,0x27,0x1a,0x08,0xff,0x27,0x19,0x08,0xff,0x27,0x19,0x07,0xff,0x27,0x19,0x07,0xff,0x27,0x1a,0x06,0xff,0x27,0x1b,0x05,0xff,0x28,0x1b,0x05,0xff,0x2b,0x1c,0x05,0xff,0x2b,0x1d,0x04,0xff,0x2b,0x1d,0x04,0xff,0x2b,0x1d,0x04,0xff,0x2b,0x1d,0x03,0xff,0x2c,0x1d,0x03,0xff,0x2d,0x1e,0x04,0xff,0x2e,0x1e,0x03,0xff,0x2e,0x1e,0x02,0xff,0x2e,0x1e,0x02,0xff,0x2e,0x1e,0x02,0xff,0x2f,0x1f,0x02,0xff,0x2f,0x1f,0x04,0xff,0x35,0x23,0x0d,0xff,0x39,0x25,0x14,0xff,0x3a,0x25,0x16,0xff,0x35,0x23,0x0f,0xff,0x24,0x14,0x00,0xff,0xa3,0x9d,0x91,0x56,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x02,0xe4,0xd2,0xca,0xcc,0x80,0x30,0x08,0xff,0x79,0x28,0x00,0xff,0x79,0x2d,0x01,0xff,0x78,0x2e,0x01,0xff,0x76,0x2e,0x02,0xff,0x75,0x30,0x02,0xff,0x72,0x30,0x01,0xff,0x73,0x32,0x02,0xff,0x71,0x31,0x02,0xff,0x70,0x32,0x02,0xff,0x6d,0x31,0x01,0xff,0x6b,0x31,0x01,0xff,0x6a,0x32,0x01,0xff,0x69,0x33,0x01,0xff,0x6a,0x32,0x01,0xff,0x69,0x31,0x01,0xff,0x68,0x32,0x01,0xff,0x68,0x33,0x01,0xff,0x67,0x33,0x02,0xff,0x63,0x31,0x02,0xff,0x75,0x3a,0x01,0xff,0xb0,0x5c,0x02,0xff,0xab,0x58,0x02,0xff,0x9f,0x56,0x02,0xff,0x82,0x45,0x02,0xff,0x8e,0x50,0x01,0xff,0x88,0x4d,0x01,0xff,0x74,0x41,0x00,0xff,0x77,0x46,0x02,0xff,0x7f,0x4b,0x01,0xff,0x70,0x41,0x01,0xff,0x76,0x45,0x02,0xff,0x99,0x5a,0x02,0xff,0x7f,0x4c,0x02,0xff,0x38,0x27,0x01,0xff,0x14,0x10,0x01,0xff,0x13,0x0d,0x01,0xff,0x25,0x1a,0x01,0xff,0x4e,0x32,0x03,0xff,0x78,0x47,0x04,0xff,0x85,0x50,0x02,0xff,0x80,0x4d,0x02,0xff,0x3d,0x26,0x05,0xff,0x19,0x11,0x03,0xff,0x11,0x0c,0x02,0xff,0x0a,0x0a,0x02,0xff,0x0f,0x0e,0x01,0xff,0x25,0x1e,0x02,0xff,0x3b,0x2b,0x02,0xff,0x1f,0x14,0x03,0xff,0x61,0x3f,0x03,0xff,0x72,0x48,0x02,0xff,0x6f,0x49,0x01,0xff,0x5f,0x3e,0x01,0xff,0x59,0x3d,0x01,0xff,0x4d,0x36,0x02,0xff,0x3c,0x2c,0x03,0xff,0x37,0x2a,0x02,0xff,0x26,0x1e,0x03,0xff,0x0d,0x0e,0x01,0xff,0x0a,0x0a,0x03,0xff,0x0c,0x09,0x04,0xff,0x0a,0x08,0x02,0xff,0x0e,0x0e,0x04,0xff,0x2a,0x2f,0x24,0xff,0x30,0x37,0x2f,0xff,0x1a,0x1f,0x1b,0xff,0x12,0x16,0x15,0xff,0x1b,0x23,0x23,0xff,0x9d,0xa5,0xa9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe6,0xe9,0xf2,0xff,0x6f,0x87,0xd5,0xff,0x2d,0x73,0xe0,0xff,0x3b,0x9d,0xf2,0xff,0x71,0xc9,0xfb,0xff,0x27,0xb2,0xfc,0xff,0x20,0xb3,0xfe,0xff,0x2e,0xb9,0xfe,0xff,0x3a,0xc7,0xff,0xff,0x21,0x71,0x99,0xff,0x03,0x08,0x18,0xff,0x3f,0x54,0x6b,0xff,0x77,0x84,0x82,0xff,0x37,0x3b,0x3c,0xff,0x14,0x10,0x15,0xff,0x0f,0x0e,0x12,0xff,0x28,0x33,0x43,0xff,0x92,0xb3,0xc1,0xff,0x6c,0x7f,0x8e,0xff,0x1c,0x24,0x42,0xff,0x2f,0x39,0x56,0xff,0x30,0x3a,0x57,0xff,0x1a,0x20,0x34,0xff,0x58,0x63,0x6d,0xff,0x66,0x76,0x8d,0xff,0x34,0x41,0x62,0xff,0x25,0x2d,0x42,0xff,0x50,0x58,0x72,0xff,0x4c,0x58,0x71,0xff,0x4a,0x58,0x6e,0xff,0x52,0x5a,0x6a,0xff,0x30,0x2d,0x32,0xff,0x22,0x15,0x09,0xff,0x27,0x1a,0x08,0xff,0x2b,0x1b,0x0c,0xff,0x2a,0x1b,0x0c,0xff,0x29,0x1a,0x0b,0xff,0x2a,0x1b,0x0b,0xff,0x2a,0x1b,0x0b,0xff,0x2a,0x1c,0x0a,0xff,0x27,0x19,0x08,0xff,0x26,0x19,0x06,0xff,0x27,0x19,0x06,0xff,0x27,0x19,0x08,0xff,0x27,0x19,0x07,0xff,0x27,0x19,0x08,0xff,0x25,0x18,0x06,0xff,0x27,0x19,0x07,0xff,0x26,0x19,0x05,0xff,0x27,0x1a,0x05,0xff,0x29,0x1b,0x04,0xff,0x2a,0x1c,0x04,0xff,0x2a,0x1d,0x03,0xff,0x2c,0x1d,0x03,0xff,0x2b,0x1c,0x02,0xff,0x2c,0x1d,0x03,0xff,0x2c,0x1d,0x02,0xff,0x2e,0x1e,0x03,0xff,0x2f,0x1e,0x02,0xff,0x2e,0x1d,0x02,0xff,0x2f,0x1f,0x03,0xff,0x2e,0x1e,0x02,0xff,0x2f,0x20,0x01,0xff,0x2f,0x1f,0x02,0xff,0x34,0x21,0x09,0xff,0x3b,0x25,0x14,0xff,0x3b,0x25,0x15,0xff,0x38,0x22,0x0f,0xff,0x2d,0x1d,0x02,0xff,0xb9,0xb5,0xab,0x3e,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xed,0xe2,0xdd,0xb3,0x8a,0x41,0x1c,0xff,0x79,0x27,0x00,0xff,0x79,0x2c,0x01,0xff,0x77,0x2e,0x01,0xff,0x75,0x2e,0x02,0xff,0x75,0x30,0x01,0xff,0x74,0x31,0x00,0xff,0x70,0x30,0x01,0xff,0x71,0x31,0x02,0xff,0x70,0x32,0x02,0xff,0x6e,0x33,0x02,0xff,0x6c,0x33,0x01,0xff,0x6b,0x33,0x01,0xff,0x6a,0x33,0x01,0xff,0x6a,0x32,0x01,0xff,0x6a,0x32,0x01,0xff,0x69,0x33,0x02,0xff,0x68,0x32,0x01,0xff,0x66,0x32,0x01,0xff,0x65,0x33,0x02,0xff,0x64,0x32,0x02,0xff,0x94,0x4f,0x03,0xff,0xab,0x5a,0x02,0xff,0x9b,0x55,0x01,0xff,0x7a,0x41,0x01,0xff,0x8d,0x51,0x02,0xff,0x81,0x48,0x02,0xff,0x78,0x46,0x02,0xff,0x83,0x4a,0x01,0xff,0x7e,0x49,0x01,0xff,0x78,0x47,0x01,0xff,0x9d,0x59,0x01,0xff,0x92,0x56,0x03,0xff,0x43,0x2c,0x02,0xff,0x13,0x11,0x01,0xff,0x15,0x0f,0x01,0xff,0x37,0x26,0x01,0xff,0x67,0x40,0x02,0xff,0x84,0x4b,0x02,0xff,0x85,0x4e,0x01,0xff,0x6c,0x41,0x02,0xff,0x3f,0x29,0x02,0xff,0x1a,0x12,0x01,0xff,0x04,0x02,0x01,0xff,0x0c,0x08,0x02,0xff,0x1d,0x15,0x01,0xff,0x38,0x28,0x03,0xff,0x59,0x3a,0x01,0xff,0x66,0x3f,0x03,0xff,0x22,0x18,0x03,0xff,0x5b,0x3a,0x02,0xff,0x70,0x48,0x02,0xff,0x6b,0x44,0x02,0xff,0x65,0x41,0x01,0xff,0x74,0x4c,0x03,0xff,0x50,0x38,0x03,0xff,0x31,0x26,0x03,0xff,0x36,0x29,0x02,0xff,0x21,0x1a,0x02,0xff,0x0a,0x0a,0x02,0xff,0x0f,0x0d,0x04,0xff,0x10,0x0d,0x05,0xff,0x09,0x07,0x03,0xff,0x10,0x0c,0x04,0xff,0x10,0x0f,0x02,0xff,0x22,0x27,0x1b,0xff,0x3b,0x41,0x3c,0xff,0x25,0x29,0x28,0xff,0x0e,0x12,0x11,0xff,0x3a,0x47,0x4a,0xff,0xdc,0xe5,0xe7,0xff,0xff,0xff,0xff,0xff,0xf0,0xf1,0xf3,0xff,0x84,0x8f,0xcf,0xff,0x3b,0x64,0xd3,0xff,0x34,0x87,0xed,0xff,0x62,0xbd,0xfc,0xff,0x39,0xb6,0xfe,0xff,0x20,0xb2,0xfd,0xff,0x28,0xb6,0xfd,0xff,0x41,0xc6,0xff,0xff,0x3f,0xbc,0xf4,0xff,0x0f,0x20,0x34,0xff,0x0b,0x20,0x42,0xff,0x48,0x70,0x95,0xff,0x72,0x7a,0x7c,0xff,0x1a,0x15,0x19,0xff,0x18,0x17,0x17,0xff,0x0f,0x0c,0x12,0xff,0x3f,0x4b,0x5e,0xff,0x39,0x45,0x5a,0xff,0x1a,0x23,0x39,0xff,0x27,0x34,0x4d,0xff,0x3b,0x44,0x5f,0xff,0x20,0x24,0x3a,0xff,0x3f,0x46,0x5b,0xff,0x51,0x61,0x7d,0xff,0x41,0x4f,0x70,0xff,0x2f,0x37,0x51,0xff,0x29,0x35,0x48,0xff,0xa4,0xb2,0xbc,0xff,0x81,0x8a,0x90,0xff,0x21,0x16,0x10,0xff,0x1d,0x0d,0x00,0xff,0x22,0x19,0x0e,0xff,0x2b,0x20,0x13,0xff,0x27,0x19,0x08,0xff,0x2b,0x1e,0x0d,0xff,0x2b,0x1c,0x0d,0xff,0x2a,0x1b,0x0b,0xff,0x29,0x1a,0x08,0xff,0x28,0x1a,0x08,0xff,0x28,0x1a,0x08,0xff,0x27,0x19,0x07,0xff,0x27,0x19,0x08,0xff,0x27,0x19,0x08,0xff,0x27,0x19,0x07,0xff,0x27,0x19,0x08,0xff,0x25,0x19,0x07,0xff,0x28,0x1a,0x07,0xff,0x28,0x1a,0x07,0xff,0x28,0x19,0x06,0xff,0x2a,0x1b,0x04,0xff,0x2a,0x1d,0x05,0xff,0x2a,0x1d,0x04,0xff,0x2c,0x1d,0x03,0xff,0x2e,0x1e,0x03,0xff,0x2c,0x1e,0x02,0xff,0x2d,0x1e,0x03,0xff,0x2e,0x1e,0x02,0xff,0x30,0x1e,0x03,0xff,0x2e,0x1e,0x02,0xff,0x2e,0x1d,0x02,0xff,0x2e,0x1e,0x02,0xff,0x2f,0x1f,0x02,0xff,0x2f,0x1f,0x01,0xff,0x34,0x20,0x07,0xff,0x3a,0x23,0x12,0xff,0x3b,0x24,0x14,0xff,0x37,0x20,0x0e,0xff,0x3c,0x2a,0x13,0xf6,0xce,0xca,0xc4,0x27,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xf7,0xf1,0xee,0x91,0x95,0x52,0x2f,0xff,0x77,0x25,0x00,0xff,0x79,0x2c,0x01,0xff,0x77,0x2d,0x02,0xff,0x76,0x2e,0x01,0xff,0x76,0x2f,0x01,0xff,0x73,0x2f,0x01,0xff,0x71,0x2f,0x01,0xff,0x70,0x31,0x01,0xff,0x70,0x32,0x02,0xff,0x6f,0x33,0x03,0xff,0x6c,0x33,0x01,0xff,0x6c,0x32,0x01,0xff,0x6b,0x33,0x01,0xff,0x6a,0x32,0x01,0xff,0x68,0x31,0x01,0xff,0x67,0x32,0x01,0xff,0x68,0x32,0x01,0xff,0x66,0x32,0x01,0xff,0x66,0x33,0x01,0xff,0x60,0x30,0x01,0xff,0x83,0x41,0x03,0xff,0xab,0x5b,0x02,0xff,0x92,0x4f,0x01,0xff,0x76,0x3d,0x02,0xff,0x8b,0x4e,0x01,0xff,0x82,0x47,0x01,0xff,0x86,0x4c,0x01,0xff,0x8e,0x51,0x01,0xff,0x86,0x4a,0x01,0xff,0x97,0x56,0x02,0xff,0xa1,0x5c,0x04,0xff,0x54,0x32,0x01,0xff,0x17,0x10,0x01,0xff,0x1e,0x15,0x01,0xff,0x4c,0x31,0x01,0xff,0x7a,0x45,0x01,0xff,0x88,0x4c,0x02,0xff,0x81,0x4b,0x02,0xff,0x5f,0x39,0x03,0xff,0x29,0x1c,0x00,0xff,0x09,0x0a,0x02,0xff,0x14,0x10,0x00,0xff,0x19,0x13,0x01,0xff,0x0d,0x0a,0x01,0xff,0x40,0x29,0x01,0xff,0x62,0x37,0x03,0xff,0x60,0x3a,0x01,0xff,0x69,0x40,0x02,0xff,0x37,0x1f,0x04,0xff,0x3c,0x24,0x03,0xff,0x6e,0x42,0x01,0xff,0x6f,0x45,0x01,0xff,0x73,0x48,0x01,0xff,0x5c,0x3e,0x02,0xff,0x2d,0x21,0x02,0xff,0x17,0x14,0x02,0xff,0x1d,0x18,0x03,0xff,0x1c,0x16,0x02,0xff,0x09,0x06,0x02,0xff,0x10,0x0d,0x04,0xff,0x0e,0x0b,0x03,0xff,0x09,0x06,0x03,0xff,0x0e,0x0b,0x04,0xff,0x13,0x10,0x05,0xff,0x14,0x13,0x07,0xff,0x19,0x1b,0x0f,0xff,0x3b,0x40,0x3b,0xff,0x2f,0x34,0x31,0xff,0x09,0x0e,0x0c,0xff,0x5a,0x67,0x6e,0xff,0xf3,0xf8,0xfa,0xff,0xff,0xff,0xfe,0xff,0x92,0x9b,0xba,0xff,0x46,0x5b,0xbc,0xff,0x34,0x6e,0xe0,0xff,0x4f,0xa8,0xf9,0xff,0x40,0xb9,0xff,0xff,0x20,0xb2,0xfb,0xff,0x20,0xb4,0xfc,0xff,0x21,0xb5,0xfe,0xff,0x31,0xc7,0xff,0xff,0x29,0x81,0xb0,0xff,0x01,0x0b,0x1c,0xff,0x33,0x4b,0x6a,0xff,0x7a,0x8b,0x90,0xff,0x3d,0x44,0x43,0xff,0x0f,0x0e,0x11,0xff,0x16,0x18,0x1d,0xff,0x1e,0x23,0x2b,0xff,0x13,0x16,0x27,0xff,0x0f,0x10,0x1c,0xff,0x13,0x17,0x27,0xff,0x2b,0x32,0x49,0xff,0x36,0x41,0x59,0xff,0x38,0x42,0x63,0xff,0x36,0x45,0x68,0xff,0x51,0x65,0x80,0xff,0x32,0x42,0x59,0xff,0x82,0x8e,0x96,0xff,0xf7,0xff,0xff,0xff,0xdf,0xeb,0xea,0xff,0x49,0x4f,0x47,0xff,0x5d,0x5e,0x58,0xff,0xb4,0xb6,0xb4,0xff,0x89,0x88,0x84,0xff,0x31,0x20,0x16,0xff,0x27,0x15,0x05,0xff,0x2b,0x1c,0x0c,0xff,0x29,0x1b,0x0a,0xff,0x29,0x1b,0x09,0xff,0x28,0x1a,0x08,0xff,0x28,0x19,0x08,0xff,0x27,0x18,0x06,0xff,0x27,0x19,0x08,0xff,0x27,0x19,0x08,0xff,0x27,0x19,0x07,0xff,0x27,0x1a,0x08,0xff,0x26,0x19,0x07,0xff,0x27,0x19,0x06,0xff,0x27,0x1a,0x06,0xff,0x28,0x1a,0x05,0xff,0x2a,0x1b,0x04,0xff,0x2a,0x1c,0x04,0xff,0x29,0x1b,0x02,0xff,0x2b,0x1c,0x02,0xff,0x2d,0x1e,0x02,0xff,0x2d,0x1f,0x03,0xff,0x2d,0x1e,0x02,0xff,0x2e,0x1e,0x02,0xff,0x2e,0x1d,0x02,0xff,0x2e,0x1d,0x02,0xff,0x2f,0x1e,0x03,0xff,0x2f,0x1e,0x03,0xff,0x30,0x1f,0x02,0xff,0x30,0x1f,0x02,0xff,0x33,0x1f,0x06,0xff,0x3b,0x24,0x12,0xff,0x39,0x23,0x13,0xff,0x35,0x1e,0x0d,0xff,0x4b,0x39,0x27,0xe3,0xe1,0xdf,0xdc,0x0d,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x6a,0xa4,0x6a,0x4e,0xff,0x76,0x22,0x00,0xff,0x7a,0x2c,0x01,0xff,0x78,0x2d,0x01,0xff,0x77,0x2d,0x01,0xff,0x77,0x2f,0x02,0xff,0x74,0x2e,0x01,0xff,0x73,0x2f,0x01,0xff,0x71,0x31,0x02,0xff,0x70,0x32,0x01,0xff,0x6f,0x33,0x02,0xff,0x6d,0x32,0x01,0xff,0x6c,0x33,0x02,0xff,0x6b,0x32,0x01,0xff,0x6a,0x32,0x01,0xff,0x69,0x32,0x01,0xff,0x68,0x32,0x01,0xff,0x67,0x32,0x01,0xff,0x65,0x32,0x01,0xff,0x66,0x32,0x02,0xff,0x5f,0x30,0x01,0xff,0x77,0x3c,0x02,0xff,0xa3,0x5a,0x01,0xff,0x86,0x48,0x02,0xff,0x79,0x3e,0x01,0xff,0x90,0x4f,0x02,0xff,0x8c,0x4d,0x02,0xff,0x92,0x51,0x01,0xff,0x8c,0x4d,0x01,0xff,0x93,0x51,0x01,0xff,0xae,0x64,0x02,0xff,0x6d,0x3f,0x03,0xff,0x21,0x16,0x01,0xff,0x25,0x19,0x01,0xff,0x62,0x3a,0x03,0xff,0x7f,0x47,0x02,0xff,0x86,0x4b,0x01,0xff,0x88,0x4d,0x02,0xff,0x68,0x3b,0x01,0xff,0x24,0x1a,0x01,0xff,0x0b,0x0c,0x00,0xff,0x25,0x18,0x01,0xff,0x4f,0x30,0x01,0xff,0x5c,0x38,0x02,0xff,0x17,0x0e,0x02,0xff,0x43,0x27,0x03,0xff,0x6c,0x3e,0x01,0xff,0x64,0x3b,0x03,0xff,0x6d,0x40,0x02,0xff,0x5e,0x3b,0x03,0xff,0x25,0x16,0x04,0xff,0x5f,0x3a,0x03,0xff,0x68,0x41,0x02,0xff,0x47,0x2f,0x02,0xff,0x2c,0x21,0x01,0xff,0x27,0x1f,0x03,0xff,0x20,0x19,0x03,0xff,0x11,0x0e,0x02,0xff,0x1f,0x1c,0x05,0xff,0x0e,0x0a,0x02,0xff,0x0e,0x0b,0x02,0xff,0x11,0x0b,0x04,0xff,0x0a,0x08,0x03,0xff,0x0c,0x0b,0x03,0xff,0x11,0x0f,0x03,0xff,0x15,0x13,0x05,0xff,0x17,0x15,0x06,0xff,0x17,0x19,0x0c,0xff,0x40,0x45,0x3d,0xff,0x32,0x38,0x34,0xff,0x08,0x0d,0x0a,0xff,0x84,0x90,0x91,0xff,0xff,0xff,0xff,0xff,0xb6,0xbc,0xbe,0xff,0x60,0x6c,0xaa,0xff,0x3a,0x5e,0xce,0xff,0x3b,0x86,0xeb,0xff,0x43,0xb1,0xfd,0xff,0x29,0xad,0xfc,0xff,0x1b,0xb3,0xfd,0xff,0x15,0xb2,0xfd,0xff,0x23,0xbc,0xff,0xff,0x34,0xc3,0xfc,0xff,0x0f,0x2f,0x43,0xff,0x0d,0x19,0x31,0xff,0x44,0x66,0x8c,0xff,0x6d,0x7b,0x7e,0xff,0x21,0x23,0x23,0xff,0x13,0x13,0x18,0xff,0x0c,0x0c,0x0e,0xff,0x1c,0x1d,0x27,0xff,0x0f,0x12,0x19,0xff,0x12,0x17,0x24,0xff,0x60,0x73,0x80,0xff,0xb3,0xc5,0xd1,0xff,0x2c,0x42,0x65,0xff,0x48,0x61,0x84,0xff,0x67,0x81,0x98,0xff,0xa3,0xb5,0xbe,0xff,0xe9,0xf9,0xf8,0xff,0xe1,0xf5,0xf5,0xff,0xe9,0xf9,0xfc,0xff,0xda,0xec,0xec,0xff,0x88,0x94,0x95,0xff,0x41,0x43,0x45,0xff,0x20,0x20,0x23,0xff,0x37,0x32,0x30,0xff,0x2f,0x28,0x1b,0xff,0x28,0x1a,0x08,0xff,0x2b,0x1b,0x0a,0xff,0x2a,0x1b,0x0a,0xff,0x2a,0x1c,0x0a,0xff,0x28,0x1a,0x09,0xff,0x27,0x19,0x08,0xff,0x27,0x19,0x08,0xff,0x27,0x19,0x08,0xff,0x27,0x19,0x06,0xff,0x26,0x19,0x07,0xff,0x26,0x18,0x06,0xff,0x28,0x1a,0x07,0xff,0x26,0x19,0x05,0xff,0x26,0x19,0x04,0xff,0x28,0x1a,0x04,0xff,0x29,0x1b,0x03,0xff,0x2a,0x1d,0x04,0xff,0x2c,0x1d,0x03,0xff,0x2d,0x1e,0x02,0xff,0x2d,0x1e,0x02,0xff,0x2c,0x1d,0x02,0xff,0x2d,0x1d,0x02,0xff,0x2e,0x1d,0x03,0xff,0x2e,0x1e,0x02,0xff,0x2f,0x1e,0x03,0xff,0x2f,0x1f,0x03,0xff,0x2e,0x1f,0x03,0xff,0x2e,0x1f,0x02,0xff,0x30,0x20,0x04,0xff,0x38,0x25,0x11,0xff,0x3b,0x25,0x15,0xff,0x34,0x1d,0x0d,0xff,0x60,0x4e,0x41,0xc3,0xf7,0xf6,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x43,0xb9,0x8b,0x75,0xff,0x78,0x23,0x00,0xff,0x7a,0x2a,0x00,0xff,0x79,0x2d,0x01,0xff,0x77,0x2e,0x01,0xff,0x75,0x2d,0x01,0xff,0x74,0x2d,0x02,0xff,0x72,0x2e,0x01,0xff,0x72,0x31,0x01,0xff,0x70,0x32,0x01,0xff,0x6f,0x33,0x01,0xff,0x6b,0x31,0x02,0xff,0x6b,0x31,0x01,0xff,0x6a,0x31,0x01,0xff,0x6a,0x33,0x01,0xff,0x6a,0x33,0x02,0xff,0x67,0x32,0x01,0xff,0x68,0x32,0x02,0xff,0x67,0x33,0x02,0xff,0x66,0x32,0x01,0xff,0x61,0x30,0x01,0xff,0x72,0x3a,0x02,0xff,0x9d,0x55,0x01,0xff,0x85,0x45,0x01,0xff,0x80,0x44,0x01,0xff,0x93,0x50,0x02,0xff,0x91,0x4f,0x02,0xff,0x8f,0x4e,0x03,0xff,0x89,0x49,0x02,0xff,0xa4,0x5d,0x03,0xff,0x93,0x53,0x02,0xff,0x3d,0x26,0x00,0xff,0x2f,0x1e,0x00,0xff,0x67,0x3b,0x03,0xff,0x84,0x49,0x01,0xff,0x85,0x4a,0x01,0xff,0x8d,0x4f,0x01,0xff,0x75,0x44,0x02,0xff,0x36,0x21,0x02,0xff,0x10,0x0d,0x01,0xff,0x30,0x1e,0x01,0xff,0x68,0x3b,0x01,0xff,0x75,0x42,0x02,0xff,0x6f,0x41,0x04,0xff,0x27,0x18,0x02,0xff,0x1d,0x10,0x02,0xff,0x68,0x40,0x03,0xff,0x6b,0x41,0x01,0xff,0x65,0x3d,0x01,0xff,0x60,0x3d,0x03,0xff,0x2e,0x22,0x02,0xff,0x21,0x16,0x03,0xff,0x3f,0x2c,0x03,0xff,0x1e,0x16,0x01,0xff,0x24,0x1d,0x01,0xff,0x23,0x19,0x02,0xff,0x16,0x10,0x03,0xff,0x18,0x10,0x03,0xff,0x27,0x1b,0x04,0xff,0x36,0x29,0x04,0xff,0x1a,0x13,0x03,0xff,0x0c,0x0b,0x04,0xff,0x0b,0x08,0x03,0xff,0x0f,0x0b,0x04,0xff,0x13,0x10,0x04,0xff,0x13,0x11,0x05,0xff,0x15,0x14,0x06,0xff,0x18,0x19,0x05,0xff,0x17,0x18,0x07,0xff,0x34,0x3b,0x36,0xff,0x2a,0x30,0x31,0xff,0x1c,0x21,0x23,0xff,0xc8,0xd4,0xdc,0xff,0xd2,0xd7,0xd2,0xff,0x5e,0x69,0x81,0xff,0x4f,0x63,0xbe,0xff,0x36,0x6a,0xde,0xff,0x44,0x9f,0xf7,0xff,0x2d,0xab,0xfa,0xff,0x0d,0xae,0xfd,0xff,0x13,0xb2,0xfe,0xff,0x1b,0xb6,0xfd,0xff,0x28,0xc8,0xff,0xff,0x21,0x8e,0xbe,0xff,0x04,0x0b,0x1d,0xff,0x2f,0x41,0x62,0xff,0x69,0x7c,0x82,0xff,0x36,0x3b,0x3f,0xff,0x1e,0x1e,0x23,0xff,0x16,0x15,0x1b,0xff,0x22,0x22,0x2b,0xff,0x17,0x1b,0x21,0xff,0x33,0x38,0x43,0xff,0x43,0x4d,0x59,0xff,0xd3,0xe5,0xe8,0xff,0xbb,0xd4,0xdc,0xff,0xb9,0xd6,0xdf,0xff,0xd0,0xe7,0xeb,0xff,0xeb,0xfe,0xfd,0xff,0xe1,0xf5,0xf6,0xff,0xdd,0xf3,0xf4,0xff,0xdc,0xf2,0xf3,0xff,0xe4,0xfb,0xfb,0xff,0xdb,0xec,0xec,0xff,0x94,0xa5,0xa5,0xff,0x7a,0x8b,0x8c,0xff,0xbd,0xd0,0xd4,0xff,0xb1,0xb9,0xb3,0xff,0x28,0x1d,0x0c,0xff,0x28,0x19,0x07,0xff,0x28,0x1b,0x09,0xff,0x29,0x1b,0x09,0xff,0x27,0x19,0x08,0xff,0x27,0x19,0x07,0xff,0x28,0x1a,0x09,0xff,0x27,0x19,0x08,0xff,0x28,0x1a,0x08,0xff,0x27,0x19,0x07,0xff,0x25,0x17,0x06,0xff,0x27,0x19,0x05,0xff,0x28,0x1a,0x06,0xff,0x27,0x1a,0x06,0xff,0x26,0x19,0x03,0xff,0x28,0x1a,0x02,0xff,0x2a,0x1d,0x03,0xff,0x2c,0x1d,0x04,0xff,0x2c,0x1d,0x02,0xff,0x2c,0x1d,0x02,0xff,0x2c,0x1e,0x02,0xff,0x2d,0x1c,0x01,0xff,0x2e,0x1d,0x02,0xff,0x2e,0x1d,0x02,0xff,0x2e,0x1d,0x02,0xff,0x2e,0x1e,0x03,0xff,0x2d,0x1f,0x02,0xff,0x2e,0x20,0x02,0xff,0x2d,0x1f,0x01,0xff,0x34,0x22,0x0c,0xff,0x3c,0x25,0x15,0xff,0x33,0x1c,0x0b,0xff,0x7b,0x6d,0x61,0x9f,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x1f,0xcc,0xaa,0x9a,0xf0,0x7a,0x25,0x00,0xff,0x7b,0x2b,0x00,0xff,0x7a,0x2d,0x01,0xff,0x78,0x2d,0x01,0xff,0x77,0x2d,0x02,0xff,0x75,0x2d,0x02,0xff,0x74,0x2e,0x01,0xff,0x72,0x30,0x02,0xff,0x70,0x32,0x02,0xff,0x6f,0x32,0x02,0xff,0x6e,0x33,0x02,0xff,0x6c,0x31,0x01,0xff,0x6b,0x32,0x01,0xff,0x69,0x32,0x02,0xff,0x69,0x32,0x01,0xff,0x68,0x32,0x01,0xff,0x67,0x32,0x01,0xff,0x68,0x33,0x02,0xff,0x66,0x31,0x01,0xff,0x63,0x32,0x01,0xff,0x6e,0x37,0x01,0xff,0x93,0x4f,0x02,0xff,0x84,0x42,0x01,0xff,0x84,0x44,0x01,0xff,0x91,0x4d,0x02,0xff,0x93,0x4f,0x02,0xff,0x8a,0x49,0x02,0xff,0x8e,0x4c,0x01,0xff,0xa9,0x62,0x03,0xff,0x6c,0x39,0x01,0xff,0x3f,0x27,0x00,0xff,0x5f,0x38,0x01,0xff,0x89,0x4c,0x01,0xff,0x84,0x4a,0x01,0xff,0x8b,0x4c,0x01,0xff,0x87,0x4a,0x02,0xff,0x4c,0x2d,0x01,0xff,0x17,0x10,0x01,0xff,0x38,0x21,0x02,0xff,0x74,0x42,0x02,0xff,0x82,0x48,0x02,0xff,0x7b,0x45,0x03,0xff,0x5a,0x33,0x01,0xff,0x34,0x21,0x03,0xff,0x0e,0x07,0x02,0xff,0x31,0x20,0x04,0xff,0x52,0x37,0x02,0xff,0x38,0x29,0x02,0xff,0x2a,0x1f,0x01,0xff,0x25,0x1c,0x03,0xff,0x12,0x0a,0x01,0xff,0x05,0x06,0x01,0xff,0x29,0x1c,0x03,0xff,0x50,0x37,0x04,0xff,0x72,0x52,0x07,0xff,0x7b,0x60,0x06,0xff,0x95,0x79,0x06,0xff,0x98,0x78,0x05,0xff,0x94,0x7c,0x06,0xff,0x4e,0x45,0x05,0xff,0x06,0x04,0x02,0xff,0x09,0x06,0x02,0xff,0x12,0x0d,0x03,0xff,0x15,0x10,0x03,0xff,0x15,0x10,0x04,0xff,0x13,0x11,0x04,0xff,0x16,0x17,0x03,0xff,0x1b,0x1c,0x04,0xff,0x14,0x15,0x03,0xff,0x34,0x39,0x33,0xff,0x22,0x27,0x28,0xff,0x3c,0x46,0x4e,0xff,0xe1,0xeb,0xec,0xff,0x8b,0x96,0x94,0xff,0x3c,0x44,0x7b,0xff,0x39,0x55,0xc6,0xff,0x3a,0x83,0xf4,0xff,0x1d,0x98,0xf9,0xff,0x09,0xa7,0xfd,0xff,0x0f,0xb1,0xfe,0xff,0x12,0xb3,0xfd,0xff,0x1c,0xbb,0xff,0xff,0x22,0xc7,0xff,0xff,0x11,0x3d,0x58,0xff,0x06,0x10,0x27,0xff,0x3e,0x61,0x81,0xff,0x70,0x86,0x8c,0xff,0x44,0x4c,0x53,0xff,0x21,0x23,0x28,0xff,0x3f,0x3f,0x46,0xff,0x20,0x26,0x2a,0xff,0x3a,0x45,0x4e,0xff,0x3d,0x4b,0x58,0xff,0xac,0xc2,0xc5,0xff,0xf2,0xff,0xff,0xff,0xe7,0xfc,0xfc,0xff,0xe5,0xf7,0xf8,0xff,0xdf,0xf3,0xf5,0xff,0xe0,0xf3,0xf4,0xff,0xde,0xf3,0xf4,0xff,0xdd,0xf3,0xf4,0xff,0xe0,0xf2,0xf3,0xff,0xe2,0xf5,0xf6,0xff,0xe9,0xfd,0xfe,0xff,0xed,0xff,0xfe,0xff,0xe8,0xff,0xff,0xff,0xc6,0xd6,0xd2,0xff,0x32,0x28,0x18,0xff,0x26,0x17,0x06,0xff,0x28,0x1b,0x08,0xff,0x28,0x1b,0x09,0xff,0x27,0x19,0x08,0xff,0x27,0x19,0x08,0xff,0x27,0x19,0x07,0xff,0x27,0x18,0x07,0xff,0x27,0x19,0x07,0xff,0x27,0x19,0x07,0xff,0x26,0x18,0x07,0xff,0x26,0x19,0x05,0xff,0x26,0x18,0x04,0xff,0x25,0x19,0x04,0xff,0x27,0x1a,0x03,0xff,0x29,0x1c,0x03,0xff,0x29,0x1c,0x02,0xff,0x2c,0x1c,0x03,0xff,0x2c,0x1c,0x01,0xff,0x2c,0x1d,0x02,0xff,0x2c,0x1e,0x02,0xff,0x2d,0x1c,0x02,0xff,0x2d,0x1d,0x02,0xff,0x2e,0x1d,0x02,0xff,0x2e,0x1d,0x02,0xff,0x2d,0x1d,0x01,0xff,0x2c,0x1e,0x01,0xff,0x2c,0x1e,0x01,0xff,0x2d,0x1f,0x02,0xff,0x31,0x21,0x07,0xff,0x39,0x25,0x11,0xff,0x31,0x1b,0x09,0xff,0x96,0x8b,0x81,0x70,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x03,0xe1,0xcf,0xc6,0xd1,0x81,0x31,0x09,0xff,0x7a,0x28,0x00,0xff,0x7a,0x2c,0x01,0xff,0x78,0x2c,0x01,0xff,0x76,0x2c,0x01,0xff,0x75,0x2e,0x02,0xff,0x74,0x2e,0x03,0xff,0x71,0x2e,0x01,0xff,0x71,0x31,0x02,0xff,0x6f,0x32,0x02,0xff,0x6f,0x33,0x02,0xff,0x6e,0x33,0x02,0xff,0x6c,0x33,0x02,0xff,0x6a,0x33,0x02,0xff,0x6a,0x32,0x02,0xff,0x6a,0x33,0x01,0xff,0x69,0x33,0x02,0xff,0x68,0x32,0x01,0xff,0x67,0x32,0x01,0xff,0x66,0x32,0x02,0xff,0x66,0x33,0x01,0xff,0x8b,0x49,0x01,0xff,0x87,0x43,0x02,0xff,0x86,0x46,0x02,0xff,0x8e,0x4b,0x02,0xff,0x93,0x4f,0x02,0xff,0x87,0x47,0x01,0xff,0xa1,0x59,0x03,0xff,0x9b,0x58,0x03,0xff,0x62,0x36,0x01,0xff,0x67,0x39,0x01,0xff,0x84,0x4a,0x02,0xff,0x91,0x4d,0x01,0xff,0x8d,0x4c,0x01,0xff,0x97,0x52,0x01,0xff,0x6f,0x3d,0x03,0xff,0x2a,0x18,0x01,0xff,0x34,0x1f,0x01,0xff,0x79,0x42,0x01,0xff,0x8b,0x4c,0x01,0xff,0x84,0x49,0x03,0xff,0x67,0x3b,0x03,0xff,0x4b,0x2b,0x02,0xff,0x47,0x28,0x02,0xff,0x24,0x14,0x03,0xff,0x0a,0x05,0x02,0xff,0x16,0x0f,0x01,0xff,0x20,0x19,0x01,0xff,0x39,0x29,0x03,0xff,0x59,0x40,0x04,0xff,0x86,0x64,0x04,0xff,0x6f,0x56,0x07,0xff,0x46,0x36,0x0a,0xff,0xb5,0x92,0x0d,0xff,0x97,0x7c,0x04,0xff,0x81,0x71,0x06,0xff,0x67,0x5e,0x04,0xff,0x49,0x48,0x02,0xff,0x31,0x31,0x01,0xff,0x28,0x25,0x03,0xff,0x30,0x27,0x04,0xff,0x10,0x0d,0x01,0xff,0x13,0x0e,0x03,0xff,0x14,0x10,0x01,0xff,0x15,0x10,0x01,0xff,0x15,0x11,0x02,0xff,0x16,0x15,0x03,0xff,0x1e,0x1d,0x03,0xff,0x1a,0x19,0x01,0xff,0x0f,0x10,0x03,0xff,0x34,0x38,0x35,0xff,0x14,0x19,0x1b,0xff,0x78,0x85,0x8d,0xff,0xcd,0xd3,0xd3,0xff,0x47,0x4c,0x62,0xff,0x26,0x30,0x8d,0xff,0x2f,0x5e,0xdf,0xff,0x23,0x85,0xf7,0xff,0x0e,0x9f,0xfb,0xff,0x0b,0xae,0xfd,0xff,0x14,0xb3,0xfd,0xff,0x12,0xb5,0xfe,0xff,0x0e,0xbf,0xff,0xff,0x15,0x97,0xcd,0xff,0x0d,0x20,0x37,0xff,0x82,0xa0,0xb0,0xff,0x98,0xac,0xad,0xff,0x91,0xa7,0xa9,0xff,0x42,0x4c,0x50,0xff,0x27,0x29,0x2f,0xff,0x3b,0x43,0x4b,0xff,0x31,0x46,0x52,0xff,0x87,0xab,0xb5,0xff,0xd8,0xef,0xf2,0xff,0xe0,0xf5,0xf8,0xff,0xdf,0xf4,0xf4,0xff,0xe6,0xf9,0xfa,0xff,0xe0,0xf5,0xf6,0xff,0xdc,0xf3,0xf3,0xff,0xdf,0xf3,0xf4,0xff,0xde,0xf2,0xf4,0xff,0xdb,0xf2,0xf1,0xff,0xdc,0xf2,0xf1,0xff,0xdc,0xf1,0xf2,0xff,0xdc,0xf0,0xf1,0xff,0xe8,0xfb,0xfd,0xff,0xb2,0xbc,0xb7,0xff,0x26,0x1b,0x09,0xff,0x2b,0x1b,0x09,0xff,0x2a,0x1a,0x09,0xff,0x28,0x1a,0x08,0xff,0x27,0x1a,0x08,0xff,0x27,0x19,0x08,0xff,0x28,0x19,0x07,0xff,0x28,0x18,0x07,0xff,0x27,0x18,0x07,0xff,0x27,0x19,0x07,0xff,0x26,0x18,0x06,0xff,0x27,0x1a,0x06,0xff,0x27,0x1a,0x05,0xff,0x25,0x18,0x02,0xff,0x28,0x1a,0x03,0xff,0x2b,0x1d,0x04,0xff,0x2a,0x1c,0x02,0xff,0x2c,0x1d,0x03,0xff,0x2c,0x1d,0x02,0xff,0x2d,0x1e,0x02,0xff,0x2c,0x1d,0x02,0xff,0x2d,0x1d,0x02,0xff,0x2d,0x1d,0x02,0xff,0x2d,0x1c,0x01,0xff,0x2e,0x1d,0x02,0xff,0x2f,0x1e,0x02,0xff,0x2d,0x1e,0x01,0xff,0x2d,0x1f,0x01,0xff,0x2d,0x1e,0x01,0xff,0x2f,0x1f,0x03,0xff,0x36,0x22,0x0a,0xff,0x37,0x22,0x0d,0xff,0xbb,0xb3,0xad,0x42,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xf2,0xe9,0xe5,0xa1,0x8d,0x45,0x23,0xff,0x76,0x23,0x00,0xff,0x79,0x2b,0x01,0xff,0x78,0x2c,0x01,0xff,0x77,0x2d,0x01,0xff,0x75,0x2d,0x00,0xff,0x74,0x2e,0x02,0xff,0x74,0x2f,0x02,0xff,0x72,0x30,0x02,0xff,0x70,0x32,0x03,0xff,0x6d,0x31,0x02,0xff,0x6d,0x32,0x01,0xff,0x6d,0x33,0x01,0xff,0x6b,0x33,0x02,0xff,0x6b,0x34,0x02,0xff,0x6b,0x34,0x01,0xff,0x69,0x32,0x01,0xff,0x67,0x32,0x00,0xff,0x67,0x32,0x01,0xff,0x68,0x33,0x01,0xff,0x60,0x30,0x01,0xff,0x8a,0x48,0x02,0xff,0x93,0x4d,0x02,0xff,0x8a,0x48,0x02,0xff,0x93,0x4f,0x02,0xff,0x92,0x4d,0x01,0xff,0x90,0x4d,0x01,0xff,0xb0,0x62,0x02,0xff,0x97,0x4e,0x01,0xff,0x7b,0x40,0x01,0xff,0x8f,0x4a,0x02,0xff,0x9d,0x51,0x02,0xff,0x98,0x4f,0x01,0xff,0x9a,0x52,0x01,0xff,0x9b,0x52,0x02,0xff,0x5f,0x32,0x02,0xff,0x3b,0x1e,0x00,0xff,0x73,0x3e,0x02,0xff,0x95,0x4f,0x03,0xff,0x8f,0x4e,0x01,0xff,0x74,0x43,0x02,0xff,0x50,0x2e,0x02,0xff,0x40,0x27,0x01,0xff,0x31,0x1b,0x02,0xff,0x21,0x14,0x01,0xff,0x0e,0x07,0x01,0xff,0x28,0x1d,0x07,0xff,0x2b,0x1f,0x09,0xff,0x78,0x5f,0x0e,0xff,0xc1,0x9e,0x09,0xff,0xdc,0xb3,0x0a,0xff,0xe5,0xba,0x0c,0xff,0x91,0x7a,0x0e,0xff,0x20,0x1a,0x05,0xff,0x16,0x17,0x01,0xff,0x1e,0x1e,0x02,0xff,0x21,0x22,0x03,0xff,0x32,0x29,0x07,0xff,0x50,0x42,0x06,0xff,0x82,0x73,0x07,0xff,0x77,0x6c,0x06,0xff,0x23,0x1e,0x04,0xff,0x15,0x0d,0x03,0xff,0x1a,0x11,0x02,0xff,0x18,0x12,0x02,0xff,0x1b,0x12,0x03,0xff,0x20,0x1b,0x03,0xff,0x1f,0x19,0x04,0xff,0x2b,0x27,0x0a,0xff,0x0e,0x11,0x02,0xff,0x11,0x10,0x08,0xff,0x2a,0x2f,0x2b,0xff,0x12,0x19,0x1e,0xff,0xa3,0xb0,0xba,0xff,0x8c,0x96,0x97,0xff,0x21,0x27,0x57,0xff,0x20,0x36,0xb3,0xff,0x20,0x6b,0xed,0xff,0x15,0x94,0xfb,0xff,0x0f,0xa2,0xfb,0xff,0x0e,0xae,0xfd,0xff,0x0f,0xb2,0xfd,0xff,0x08,0xb4,0xfe,0xff,0x0d,0xc4,0xff,0xff,0x14,0x76,0xa0,0xff,0x72,0x81,0x92,0xff,0x76,0xb2,0xd4,0xff,0x66,0x88,0x99,0xff,0xc7,0xe0,0xe2,0xff,0x53,0x62,0x6a,0xff,0x37,0x48,0x53,0xff,0x5e,0x7e,0x87,0xff,0xc0,0xe0,0xe5,0xff,0xe2,0xf9,0xfb,0xff,0xe2,0xf6,0xf8,0xff,0xe8,0xfc,0xfe,0xff,0xcc,0xe4,0xe6,0xff,0xd6,0xeb,0xed,0xff,0xdf,0xf4,0xf3,0xff,0xe5,0xf8,0xf7,0xff,0xe5,0xfa,0xfb,0xff,0xe4,0xf8,0xf9,0xff,0xe0,0xf5,0xf6,0xff,0xe0,0xf4,0xf5,0xff,0xe3,0xf5,0xf7,0xff,0xf6,0xff,0xff,0xff,0x7e,0x7f,0x79,0xff,0x1d,0x0f,0x00,0xff,0x2b,0x1d,0x0a,0xff,0x28,0x1a,0x09,0xff,0x28,0x1a,0x08,0xff,0x28,0x1a,0x08,0xff,0x26,0x19,0x06,0xff,0x25,0x18,0x05,0xff,0x26,0x18,0x06,0xff,0x27,0x19,0x07,0xff,0x26,0x18,0x06,0xff,0x25,0x18,0x04,0xff,0x26,0x18,0x04,0xff,0x26,0x18,0x04,0xff,0x26,0x19,0x03,0xff,0x28,0x1a,0x02,0xff,0x2a,0x1b,0x02,0xff,0x2a,0x1c,0x02,0xff,0x2c,0x1d,0x02,0xff,0x2c,0x1c,0x01,0xff,0x2d,0x1d,0x01,0xff,0x2e,0x1d,0x02,0xff,0x2e,0x1d,0x02,0xff,0x2d,0x1d,0x01,0xff,0x2e,0x1d,0x02,0xff,0x2e,0x1d,0x01,0xff,0x2e,0x1d,0x01,0xff,0x2e,0x1e,0x01,0xff,0x2e,0x1e,0x01,0xff,0x2e,0x1e,0x01,0xff,0x30,0x1f,0x02,0xff,0x31,0x1e,0x02,0xff,0x42,0x2f,0x19,0xeb,0xd8,0xd4,0xd0,0x1b,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x69,0xa4,0x69,0x4e,0xff,0x75,0x20,0x00,0xff,0x79,0x2b,0x01,0xff,0x79,0x2c,0x01,0xff,0x78,0x2c,0x01,0xff,0x76,0x2c,0x02,0xff,0x76,0x2d,0x02,0xff,0x74,0x2f,0x02,0xff,0x72,0x31,0x02,0xff,0x71,0x32,0x03,0xff,0x6e,0x33,0x02,0xff,0x6e,0x33,0x01,0xff,0x6e,0x35,0x02,0xff,0x6d,0x35,0x02,0xff,0x6c,0x34,0x02,0xff,0x6b,0x34,0x01,0xff,0x68,0x33,0x01,0xff,0x68,0x34,0x01,0xff,0x68,0x34,0x00,0xff,0x66,0x32,0x00,0xff,0x60,0x30,0x01,0xff,0x85,0x46,0x04,0xff,0x99,0x50,0x02,0xff,0x90,0x4b,0x01,0xff,0x9a,0x54,0x03,0xff,0x98,0x4f,0x02,0xff,0xa8,0x59,0x00,0xff,0xaf,0x5c,0x02,0xff,0x9d,0x4d,0x02,0xff,0xa0,0x4e,0x00,0xff,0xaa,0x54,0x02,0xff,0xa7,0x52,0x01,0xff,0xa1,0x52,0x01,0xff,0xa6,0x54,0x01,0xff,0x96,0x4d,0x02,0xff,0x6a,0x36,0x02,0xff,0x5f,0x31,0x02,0xff,0x88,0x48,0x02,0xff,0xa2,0x56,0x01,0xff,0x86,0x4a,0x02,0xff,0x4b,0x2a,0x02,0xff,0x28,0x16,0x02,0xff,0x16,0x0b,0x01,0xff,0x3a,0x23,0x03,0xff,0x67,0x48,0x08,0xff,0x16,0x09,0x02,0xff,0x52,0x3c,0x09,0xff,0xb4,0x93,0x0b,0xff,0x71,0x5f,0x08,0xff,0x55,0x48,0x05,0xff,0x55,0x47,0x0b,0xff,0x59,0x47,0x0b,0xff,0x57,0x49,0x0a,0xff,0x3c,0x32,0x04,0xff,0x42,0x39,0x05,0xff,0x20,0x19,0x03,0xff,0x23,0x1c,0x08,0xff,0x64,0x53,0x0a,0xff,0x8c,0x70,0x07,0xff,0x56,0x48,0x04,0xff,0x0e,0x0d,0x01,0xff,0x0f,0x0b,0x03,0xff,0x20,0x18,0x04,0xff,0x1d,0x12,0x03,0xff,0x1c,0x12,0x03,0xff,0x22,0x17,0x04,0xff,0x10,0x0c,0x01,0xff,0x42,0x40,0x0e,0xff,0x7a,0x7f,0x22,0xff,0x4f,0x4d,0x0f,0xff,0x13,0x0a,0x02,0xff,0x18,0x1c,0x1b,0xff,0x1d,0x1f,0x1e,0xff,0x23,0x24,0x27,0xff,0x5f,0x66,0x66,0xff,0x32,0x35,0x3d,0xff,0x29,0x2d,0x7b,0xff,0x1f,0x47,0xd7,0xff,0x16,0x7c,0xfa,0xff,0x19,0x92,0xf6,0xff,0x0d,0xa6,0xf9,0xff,0x0a,0xb2,0xfd,0xff,0x0b,0xb2,0xfd,0xff,0x08,0xb8,0xff,0xff,0x0f,0xb2,0xf2,0xff,0x15,0x89,0xbf,0xff,0x1f,0xbd,0xfe,0xff,0x31,0x83,0xa8,0xff,0xc3,0xd3,0xd3,0xff,0xc3,0xe0,0xe4,0xff,0x82,0xa0,0xa5,0xff,0xc4,0xe4,0xe7,0xff,0xe6,0xfd,0xfc,0xff,0xe4,0xf7,0xf9,0xff,0xb4,0xcb,0xcc,0xff,0xaf,0xc8,0xcb,0xff,0x57,0x72,0x7a,0xff,0xad,0xc8,0xcb,0xff,0xef,0xff,0xff,0xff,0xd3,0xe7,0xe7,0xff,0xc3,0xd5,0xd3,0xff,0xc4,0xd7,0xd5,0xff,0xd1,0xe6,0xe5,0xff,0xdd,0xf5,0xf4,0xff,0xde,0xf3,0xf1,0xff,0xa3,0xad,0xab,0xff,0x29,0x20,0x16,0xff,0x2a,0x1a,0x08,0xff,0x2b,0x1d,0x0b,0xff,0x29,0x1b,0x09,0xff,0x28,0x1a,0x08,0xff,0x27,0x19,0x07,0xff,0x26,0x18,0x05,0xff,0x26,0x19,0x06,0xff,0x26,0x18,0x06,0xff,0x26,0x18,0x07,0xff,0x26,0x17,0x06,0xff,0x25,0x18,0x04,0xff,0x25,0x18,0x05,0xff,0x26,0x19,0x05,0xff,0x27,0x1a,0x04,0xff,0x28,0x1a,0x02,0xff,0x2a,0x1b,0x02,0xff,0x2b,0x1c,0x03,0xff,0x2b,0x1d,0x02,0xff,0x2c,0x1d,0x01,0xff,0x2f,0x1e,0x02,0xff,0x2e,0x1d,0x01,0xff,0x2e,0x1d,0x01,0xff,0x2e,0x1d,0x01,0xff,0x2e,0x1d,0x01,0xff,0x2e,0x1e,0x01,0xff,0x2e,0x1e,0x01,0xff,0x2d,0x1e,0x01,0xff,0x2f,0x1e,0x02,0xff,0x2d,0x1d,0x01,0xff,0x2e,0x1f,0x01,0xff,0x2a,0x18,0x00,0xff,0x5a,0x4a,0x34,0xc3,0xf4,0xf3,0xf2,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfa,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x34,0xbf,0x96,0x84,0xfe,0x76,0x21,0x00,0xff,0x79,0x2a,0x01,0xff,0x78,0x2a,0x02,0xff,0x78,0x2b,0x02,0xff,0x77,0x2d,0x02,0xff,0x76,0x2e,0x02,0xff,0x75,0x2f,0x02,0xff,0x73,0x31,0x02,0xff,0x72,0x32,0x03,0xff,0x70,0x35,0x03,0xff,0x6f,0x34,0x02,0xff,0x6e,0x36,0x01,0xff,0x70,0x37,0x02,0xff,0x6d,0x35,0x02,0xff,0x6b,0x35,0x02,0xff,0x68,0x34,0x01,0xff,0x6a,0x35,0x02,0xff,0x68,0x34,0x01,0xff,0x66,0x33,0x00,0xff,0x61,0x32,0x01,0xff,0x7b,0x41,0x02,0xff,0x9f,0x53,0x01,0xff,0x97,0x4d,0x01,0xff,0xa0,0x52,0x00,0xff,0xa7,0x53,0x00,0xff,0xbd,0x5f,0x01,0xff,0xaf,0x57,0x02,0xff,0xa5,0x51,0x02,0xff,0xaa,0x53,0x01,0xff,0xaa,0x55,0x01,0xff,0xab,0x54,0x01,0xff,0xb0,0x56,0x01,0xff,0xa9,0x55,0x01,0xff,0x8b,0x46,0x02,0xff,0x71,0x39,0x02,0xff,0x70,0x36,0x02,0xff,0xa1,0x50,0x01,0xff,0x9b,0x4f,0x02,0xff,0x49,0x27,0x01,0xff,0x18,0x0c,0x02,0xff,0x2b,0x15,0x02,0xff,0x8b,0x69,0x09,0xff,0xdc,0xa6,0x09,0xff,0xc1,0x8a,0x04,0xff,0x21,0x11,0x01,0xff,0x07,0x00,0x01,0xff,0x9a,0x7d,0x03,0xff,0xe3,0xbd,0x04,0xff,0xc4,0xa4,0x02,0xff,0xba,0x9a,0x05,0xff,0xa6,0x91,0x05,0xff,0x9c,0x87,0x05,0xff,0x9a,0x84,0x02,0xff,0x9f,0x8b,0x04,0xff,0x70,0x62,0x06,0xff,0x41,0x3a,0x06,0xff,0x0e,0x0a,0x02,0xff,0x0d,0x08,0x02,0xff,0x0e,0x06,0x02,0xff,0x14,0x0d,0x04,0xff,0x16,0x11,0x03,0xff,0x23,0x19,0x06,0xff,0x27,0x18,0x04,0xff,0x1e,0x13,0x02,0xff,0x1f,0x15,0x02,0xff,0x2e,0x29,0x07,0xff,0x62,0x77,0x0c,0xff,0x90,0x99,0x10,0xff,0x53,0x4b,0x0b,0xff,0x31,0x38,0x0e,0xff,0x15,0x19,0x0c,0xff,0x24,0x25,0x24,0xff,0x0d,0x0d,0x0d,0xff,0x3a,0x46,0x52,0xff,0x6d,0x74,0x76,0xff,0x16,0x16,0x1b,0xff,0x13,0x16,0x4d,0xff,0x1f,0x4f,0xb7,0xff,0x1f,0x88,0xfa,0xff,0x0b,0xa1,0xff,0xff,0x0c,0xac,0xfd,0xff,0x09,0xae,0xfc,0xff,0x09,0xb0,0xfe,0xff,0x0a,0xb4,0xfe,0xff,0x0b,0xb9,0xff,0xff,0x0a,0xb7,0xff,0xff,0x1c,0xa8,0xdf,0xff,0x78,0x93,0x9e,0xff,0xeb,0xfb,0xf9,0xff,0xe9,0xfe,0xfd,0xff,0xeb,0xfb,0xfb,0xff,0xe5,0xf8,0xf9,0xff,0xe6,0xf8,0xf9,0xff,0x8b,0xa8,0xab,0xff,0x4f,0x7b,0x7f,0xff,0x6e,0x8c,0x94,0xff,0xd2,0xe7,0xea,0xff,0xbf,0xd0,0xd2,0xff,0x44,0x54,0x53,0xff,0x24,0x2b,0x2a,0xff,0x45,0x55,0x5c,0xff,0x4a,0x5a,0x60,0xff,0x51,0x5d,0x5d,0xff,0x42,0x49,0x45,0xff,0x2a,0x2b,0x2d,0xff,0x2d,0x21,0x17,0xff,0x2a,0x1c,0x09,0xff,0x29,0x1b,0x09,0xff,0x27,0x19,0x08,0xff,0x28,0x1a,0x09,0xff,0x28,0x1a,0x08,0xff,0x26,0x19,0x06,0xff,0x26,0x18,0x06,0xff,0x26,0x18,0x07,0xff,0x26,0x19,0x06,0xff,0x25,0x17,0x06,0xff,0x25,0x17,0x05,0xff,0x25,0x18,0x04,0xff,0x26,0x18,0x04,0xff,0x26,0x19,0x04,0xff,0x28,0x1a,0x03,0xff,0x2b,0x1c,0x03,0xff,0x2b,0x1c,0x03,0xff,0x2b,0x1c,0x02,0xff,0x2c,0x1e,0x02,0xff,0x2d,0x1e,0x01,0xff,0x2e,0x1e,0x01,0xff,0x2e,0x1e,0x01,0xff,0x2e,0x1e,0x01,0xff,0x2e,0x1d,0x01,0xff,0x2e,0x1e,0x01,0xff,0x2d,0x1d,0x00,0xff,0x2d,0x1c,0x01,0xff,0x2e,0x1d,0x02,0xff,0x2e,0x1d,0x02,0xff,0x2e,0x1e,0x02,0xff,0x24,0x13,0x00,0xff,0x7f,0x74,0x63,0x8d,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf9,0x00,0xff,0xf5,0xf9,0x00,0xff,0xff,0xff,0x09,0xde,0xc9,0xbf,0xd8,0x7d,0x2e,0x07,0xff,0x78,0x26,0x00,0xff,0x7a,0x2b,0x01,0xff,0x79,0x2c,0x02,0xff,0x77,0x2d,0x02,0xff,0x76,0x2d,0x02,0xff,0x77,0x2f,0x02,0xff,0x74,0x31,0x02,0xff,0x72,0x33,0x03,0xff,0x72,0x35,0x03,0xff,0x71,0x37,0x04,0xff,0x6f,0x36,0x02,0xff,0x71,0x39,0x01,0xff,0x6f,0x38,0x02,0xff,0x6b,0x36,0x01,0xff,0x6a,0x36,0x01,0xff,0x6a,0x36,0x01,0xff,0x68,0x35,0x01,0xff,0x67,0x35,0x00,0xff,0x63,0x32,0x01,0xff,0x74,0x3e,0x02,0xff,0xa7,0x57,0x01,0xff,0xb0,0x56,0x02,0xff,0xb1,0x55,0x00,0xff,0xba,0x59,0x01,0xff,0xc2,0x5d,0x02,0xff,0xa9,0x4f,0x01,0xff,0x9c,0x48,0x02,0xff,0x9d,0x49,0x02,0xff,0xa1,0x4c,0x02,0xff,0xa7,0x50,0x01,0xff,0xaf,0x56,0x01,0xff,0x97,0x4c,0x00,0xff,0x80,0x40,0x02,0xff,0x77,0x3c,0x01,0xff,0x96,0x48,0x01,0xff,0xa7,0x54,0x03,0xff,0x4a,0x26,0x01,0xff,0x13,0x08,0x02,0xff,0x3b,0x26,0x05,0xff,0xb6,0x85,0x0b,0xff,0x8e,0x6f,0x06,0xff,0x4d,0x3b,0x02,0xff,0x91,0x6e,0x05,0xff,0x57,0x44,0x04,0xff,0x15,0x0b,0x02,0xff,0x5a,0x3a,0x03,0xff,0xcd,0xa9,0x03,0xff,0xce,0xa8,0x01,0xff,0xce,0xa6,0x01,0xff,0xcb,0xab,0x02,0xff,0xc2,0xa1,0x04,0xff,0xa4,0x88,0x04,0xff,0x6a,0x5e,0x04,0xff,0x2e,0x27,0x03,0xff,0x0f,0x0a,0x02,0xff,0x0a,0x07,0x02,0xff,0x07,0x03,0x02,0xff,0x07,0x04,0x00,0xff,0x0b,0x07,0x01,0xff,0x0c,0x0a,0x02,0xff,0x0a,0x08,0x02,0xff,0x23,0x18,0x04,0xff,0x25,0x19,0x03,0xff,0x15,0x09,0x01,0xff,0x2e,0x2e,0x05,0xff,0x83,0x8c,0x17,0xff,0x79,0x6c,0x33,0xff,0x2d,0x26,0x1e,0xff,0x35,0x55,0x0c,0xff,0x1b,0x27,0x05,0xff,0x16,0x15,0x12,0xff,0x09,0x0a,0x08,0xff,0x26,0x2e,0x39,0xff,0x78,0x8a,0x95,0xff,0x4f,0x56,0x5e,0xff,0x15,0x14,0x34,0xff,0x1d,0x1c,0x4e,0xff,0x21,0x3f,0x70,0xff,0x1b,0x88,0xd4,0xff,0x0e,0xae,0xff,0xff,0x06,0xac,0xff,0xff,0x0a,0xae,0xfd,0xff,0x0e,0xb3,0xfd,0xff,0x12,0xb4,0xfd,0xff,0x0c,0xb1,0xfe,0xff,0x09,0xb3,0xff,0xff,0x33,0x83,0xa6,0xff,0xcc,0xd4,0xd2,0xff,0xee,0xfe,0xfd,0xff,0xe5,0xf8,0xf9,0xff,0xe6,0xf9,0xf9,0xff,0xf2,0xff,0xff,0xff,0x7c,0x91,0x93,0xff,0x65,0x84,0x86,0xff,0xdc,0xf6,0xf7,0xff,0xcd,0xdf,0xe0,0xff,0x34,0x34,0x36,0xff,0x16,0x10,0x0e,0xff,0x17,0x16,0x15,0xff,0x3a,0x43,0x52,0xff,0x43,0x51,0x69,0xff,0x3c,0x46,0x5b,0xff,0x52,0x64,0x7e,0xff,0x61,0x68,0x7b,0xff,0x2e,0x22,0x16,0xff,0x26,0x19,0x05,0xff,0x27,0x19,0x07,0xff,0x28,0x19,0x08,0xff,0x28,0x1a,0x09,0xff,0x28,0x1a,0x08,0xff,0x26,0x18,0x07,0xff,0x26,0x18,0x06,0xff,0x26,0x19,0x07,0xff,0x24,0x18,0x07,0xff,0x23,0x17,0x05,0xff,0x23,0x18,0x05,0xff,0x24,0x18,0x04,0xff,0x27,0x19,0x06,0xff,0x26,0x19,0x04,0xff,0x28,0x1b,0x03,0xff,0x29,0x1c,0x04,0xff,0x2b,0x1d,0x03,0xff,0x2c,0x1d,0x02,0xff,0x2c,0x1d,0x01,0xff,0x2c,0x1d,0x01,0xff,0x2d,0x1d,0x02,0xff,0x2e,0x1d,0x02,0xff,0x2d,0x1d,0x01,0xff,0x2d,0x1d,0x00,0xff,0x2d,0x1d,0x00,0xff,0x2d,0x1d,0x00,0xff,0x2d,0x1c,0x01,0xff,0x2d,0x1d,0x01,0xff,0x2e,0x1c,0x01,0xff,0x2c,0x1b,0x00,0xff,0x2b,0x1a,0x00,0xff,0xb1,0xaa,0xa1,0x4d,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xee,0xf4,0x00,0xff,0xff,0xff,0x00,0xf5,0xef,0xeb,0x9e,0x8f,0x4b,0x2a,0xff,0x75,0x22,0x00,0xff,0x79,0x2b,0x02,0xff,0x77,0x2b,0x01,0xff,0x79,0x2e,0x02,0xff,0x77,0x2e,0x01,0xff,0x76,0x30,0x02,0xff,0x75,0x33,0x04,0xff,0x75,0x36,0x06,0xff,0x72,0x37,0x05,0xff,0x72,0x38,0x05,0xff,0x70,0x38,0x03,0xff,0x6f,0x37,0x03,0xff,0x6d,0x37,0x02,0xff,0x6d,0x38,0x01,0xff,0x6b,0x38,0x01,0xff,0x69,0x36,0x00,0xff,0x68,0x34,0x01,0xff,0x66,0x33,0x02,0xff,0x63,0x33,0x01,0xff,0x6c,0x37,0x02,0xff,0xa1,0x53,0x02,0xff,0xb6,0x57,0x01,0xff,0xb4,0x54,0x00,0xff,0xb6,0x55,0x02,0xff,0xaf,0x4e,0x01,0xff,0xa2,0x47,0x01,0xff,0x9c,0x47,0x02,0xff,0x96,0x43,0x02,0xff,0x93,0x42,0x02,0xff,0xa9,0x52,0x02,0xff,0xab,0x53,0x02,0xff,0x88,0x45,0x01,0xff,0x84,0x44,0x02,0xff,0x98,0x4c,0x01,0xff,0xb5,0x5b,0x03,0xff,0x5a,0x2e,0x03,0xff,0x04,0x03,0x01,0xff,0x39,0x1f,0x02,0xff,0xc8,0x94,0x0c,0xff,0x68,0x49,0x04,0xff,0x23,0x12,0x04,0xff,0x17,0x0d,0x03,0xff,0x1c,0x17,0x03,0xff,0x6b,0x54,0x09,0xff,0x2b,0x20,0x03,0xff,0x38,0x1a,0x03,0xff,0x93,0x68,0x05,0xff,0xbb,0x8c,0x04,0xff,0xa0,0x7b,0x04,0xff,0x81,0x65,0x05,0xff,0x56,0x43,0x05,0xff,0x26,0x1d,0x04,0xff,0x07,0x04,0x03,0xff,0x04,0x02,0x02,0xff,0x0a,0x06,0x01,0xff,0x0a,0x07,0x01,0xff,0x07,0x04,0x02,0xff,0x06,0x04,0x00,0xff,0x07,0x04,0x01,0xff,0x08,0x04,0x02,0xff,0x06,0x04,0x01,0xff,0x08,0x05,0x03,0xff,0x1c,0x12,0x03,0xff,0x15,0x0e,0x01,0xff,0x21,0x20,0x02,0xff,0x76,0x8c,0x13,0xff,0x48,0x67,0x1c,0xff,0x3a,0x6a,0x16,0xff,0x48,0x86,0x10,0xff,0x1d,0x2d,0x0a,0xff,0x09,0x07,0x04,0xff,0x08,0x07,0x01,0xff,0x07,0x08,0x08,0xff,0x2a,0x35,0x4b,0xff,0x92,0xa8,0xb6,0xff,0x37,0x40,0x5b,0xff,0x14,0x1c,0x83,0xff,0x19,0x34,0xa1,0xff,0x1c,0x35,0x5b,0xff,0x27,0x69,0x93,0xff,0x1b,0xac,0xf1,0xff,0x09,0xb8,0xff,0xff,0x05,0xaf,0xff,0xff,0x4a,0xb6,0xed,0xff,0xa0,0xd2,0xeb,0xff,0x22,0xb6,0xfe,0xff,0x17,0x9b,0xd7,0xff,0x87,0x9d,0xa5,0xff,0xf1,0xff,0xfe,0xff,0xe6,0xfa,0xfb,0xff,0xe9,0xfb,0xfa,0xff,0xe2,0xf7,0xf9,0xff,0xd8,0xed,0xef,0xff,0xd1,0xe5,0xe6,0xff,0xf4,0xff,0xff,0xff,0x9e,0xa7,0xa7,0xff,0x0e,0x04,0x02,0xff,0x18,0x0e,0x0a,0xff,0x0a,0x03,0x02,0xff,0x16,0x16,0x1a,0xff,0x24,0x27,0x2f,0xff,0x43,0x48,0x5e,0xff,0x55,0x5f,0x75,0xff,0x2e,0x27,0x24,0xff,0x24,0x15,0x01,0xff,0x29,0x1c,0x08,0xff,0x27,0x19,0x07,0xff,0x27,0x18,0x07,0xff,0x27,0x19,0x07,0xff,0x28,0x1a,0x08,0xff,0x26,0x18,0x06,0xff,0x26,0x18,0x06,0xff,0x25,0x18,0x06,0xff,0x24,0x17,0x07,0xff,0x23,0x17,0x07,0xff,0x23,0x17,0x05,0xff,0x24,0x18,0x05,0xff,0x25,0x17,0x04,0xff,0x25,0x18,0x04,0xff,0x29,0x1b,0x05,0xff,0x29,0x1c,0x03,0xff,0x2b,0x1d,0x02,0xff,0x2b,0x1c,0x01,0xff,0x2c,0x1d,0x02,0xff,0x2c,0x1d,0x02,0xff,0x2c,0x1d,0x02,0xff,0x2e,0x1d,0x02,0xff,0x2e,0x1d,0x02,0xff,0x2e,0x1e,0x01,0xff,0x2e,0x1e,0x01,0xff,0x2e,0x1e,0x01,0xff,0x2c,0x1c,0x01,0xff,0x2d,0x1c,0x01,0xff,0x2f,0x1d,0x02,0xff,0x29,0x18,0x00,0xff,0x3e,0x2e,0x15,0xe9,0xde,0xdb,0xd6,0x18,0xff,0xff,0xff,0x00,0xff,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf9,0x00,0xfd,0xe8,0xf1,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x59,0xae,0x7d,0x65,0xff,0x74,0x20,0x00,0xff,0x7a,0x2a,0x01,0xff,0x7a,0x2c,0x02,0xff,0x7c,0x30,0x04,0xff,0x7b,0x32,0x05,0xff,0x79,0x34,0x07,0xff,0x7a,0x37,0x0a,0xff,0x79,0x3a,0x0e,0xff,0x78,0x3a,0x0d,0xff,0x75,0x3b,0x0a,0xff,0x72,0x3b,0x08,0xff,0x72,0x3c,0x09,0xff,0x71,0x3b,0x07,0xff,0x6f,0x3a,0x02,0xff,0x6c,0x38,0x02,0xff,0x69,0x35,0x01,0xff,0x69,0x35,0x01,0xff,0x68,0x34,0x02,0xff,0x66,0x35,0x01,0xff,0x65,0x32,0x02,0xff,0x96,0x4d,0x03,0xff,0xbf,0x58,0x01,0xff,0xc2,0x57,0x01,0xff,0xc1,0x56,0x02,0xff,0xb2,0x4e,0x01,0xff,0xb1,0x50,0x01,0xff,0xae,0x52,0x01,0xff,0xa8,0x4f,0x01,0xff,0xb1,0x56,0x03,0xff,0xbb,0x60,0x02,0xff,0xa7,0x54,0x01,0xff,0x91,0x49,0x01,0xff,0xa1,0x51,0x01,0xff,0xbe,0x63,0x02,0xff,0x7f,0x42,0x02,0xff,0x06,0x05,0x01,0xff,0x37,0x1b,0x03,0xff,0xc9,0x91,0x09,0xff,0x80,0x5d,0x03,0xff,0x15,0x0c,0x00,0xff,0x22,0x13,0x03,0xff,0x3f,0x27,0x08,0xff,0x04,0x00,0x00,0xff,0x3d,0x25,0x06,0xff,0x42,0x28,0x07,0xff,0x15,0x09,0x02,0xff,0x1c,0x0e,0x02,0xff,0x1e,0x12,0x03,0xff,0x0f,0x09,0x02,0xff,0x07,0x03,0x02,0xff,0x03,0x00,0x01,0xff,0x07,0x01,0x01,0xff,0x0a,0x06,0x02,0xff,0x0d,0x06,0x03,0xff,0x0a,0x05,0x03,0xff,0x09,0x05,0x01,0xff,0x09,0x07,0x01,0xff,0x07,0x05,0x01,0xff,0x09,0x06,0x02,0xff,0x07,0x07,0x02,0xff,0x0a,0x05,0x03,0xff,0x08,0x06,0x03,0xff,0x09,0x07,0x02,0xff,0x12,0x0d,0x03,0xff,0x11,0x0c,0x02,0xff,0x4a,0x4e,0x09,0xff,0x84,0xb0,0x0c,0xff,0x89,0xd2,0x10,0xff,0x40,0x6f,0x0c,0xff,0x09,0x0a,0x05,0xff,0x0a,0x0a,0x03,0xff,0x09,0x09,0x03,0xff,0x08,0x07,0x01,0xff,0x0b,0x0f,0x13,0xff,0x5a,0x70,0x85,0xff,0x8d,0xa2,0xad,0xff,0x17,0x19,0x43,0xff,0x14,0x2d,0xb3,0xff,0x1d,0x5b,0xe1,0xff,0x22,0x4e,0x8d,0xff,0x22,0x48,0x63,0xff,0x1d,0x78,0xa4,0xff,0x0c,0xaa,0xf0,0xff,0x5f,0xbe,0xeb,0xff,0xd1,0xd4,0xcd,0xff,0x96,0xd0,0xea,0xff,0x18,0xb0,0xfe,0xff,0x57,0x90,0xaa,0xff,0xd6,0xde,0xde,0xff,0xc0,0xdb,0xe1,0xff,0xa0,0xb5,0xc2,0xff,0x5f,0x75,0x88,0xff,0xe2,0xf2,0xf4,0xff,0xd2,0xeb,0xed,0xff,0xeb,0xff,0xff,0xff,0x80,0x87,0x87,0xff,0x71,0x79,0x83,0xff,0x95,0xa2,0xaf,0xff,0x87,0x90,0x98,0xff,0x84,0x8c,0x94,0xff,0x63,0x62,0x63,0xff,0x2f,0x24,0x1c,0xff,0x24,0x11,0x02,0xff,0x26,0x17,0x04,0xff,0x2a,0x1c,0x07,0xff,0x28,0x1b,0x08,0xff,0x27,0x19,0x08,0xff,0x28,0x1a,0x07,0xff,0x28,0x1a,0x07,0xff,0x27,0x1a,0x08,0xff,0x26,0x18,0x07,0xff,0x27,0x18,0x06,0xff,0x26,0x18,0x06,0xff,0x24,0x17,0x06,0xff,0x24,0x17,0x07,0xff,0x22,0x17,0x05,0xff,0x24,0x19,0x05,0xff,0x25,0x18,0x04,0xff,0x26,0x19,0x05,0xff,0x27,0x1a,0x03,0xff,0x28,0x1b,0x03,0xff,0x2b,0x1d,0x02,0xff,0x2b,0x1c,0x01,0xff,0x2c,0x1d,0x01,0xff,0x2c,0x1d,0x01,0xff,0x2d,0x1e,0x02,0xff,0x2e,0x1d,0x02,0xff,0x2e,0x1d,0x02,0xff,0x2e,0x1e,0x01,0xff,0x2e,0x1f,0x01,0xff,0x2e,0x1e,0x01,0xff,0x2d,0x1d,0x01,0xff,0x2d,0x1c,0x01,0xff,0x2f,0x1c,0x02,0xff,0x25,0x13,0x00,0xff,0x66,0x5a,0x47,0xb4,0xfd,0xfd,0xfc,0x00,0xff,0xff,0xff,0x00,0xfe,0xf3,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf6,0xfa,0x00,0xfd,0xe4,0xef,0x00,0xfe,0xf8,0xfb,0x00,0xff,0xff,0xff,0x1d,0xd2,0xb5,0xa7,0xed,0x7c,0x29,0x00,0xff,0x79,0x29,0x00,0xff,0x7c,0x2e,0x03,0xff,0x7d,0x31,0x05,0xff,0x7d,0x35,0x09,0xff,0x7c,0x38,0x0c,0xff,0x7d,0x3d,0x12,0xff,0x7b,0x3d,0x15,0xff,0x7b,0x3f,0x17,0xff,0x77,0x3e,0x14,0xff,0x76,0x3f,0x14,0xff,0x74,0x3f,0x11,0xff,0x73,0x3d,0x0d,0xff,0x70,0x3c,0x06,0xff,0x6a,0x36,0x02,0xff,0x6b,0x36,0x02,0xff,0x6a,0x36,0x01,0xff,0x68,0x35,0x01,0xff,0x69,0x35,0x02,0xff,0x64,0x32,0x02,0xff,0x83,0x42,0x02,0xff,0xc5,0x59,0x02,0xff,0xce,0x56,0x02,0xff,0xce,0x5b,0x00,0xff,0xbb,0x53,0x01,0xff,0xc0,0x58,0x02,0xff,0xb9,0x58,0x02,0xff,0xac,0x4f,0x02,0xff,0xba,0x5e,0x02,0xff,0xbd,0x62,0x03,0xff,0xa5,0x52,0x01,0xff,0xa4,0x55,0x01,0xff,0xc3,0x66,0x02,0xff,0xb1,0x5c,0x03,0xff,0x29,0x18,0x01,0xff,0x2a,0x13,0x02,0xff,0xb3,0x7b,0x06,0xff,0xd7,0xab,0x07,0xff,0x69,0x41,0x04,0xff,0x3b,0x28,0x03,0xff,0x11,0x05,0x02,0xff,0x36,0x19,0x06,0xff,0x2d,0x14,0x02,0xff,0x27,0x0d,0x03,0xff,0x1e,0x0d,0x02,0xff,0x09,0x05,0x01,0xff,0x04,0x01,0x02,0xff,0x06,0x03,0x02,0xff,0x0b,0x06,0x01,0xff,0x0a,0x06,0x01,0xff,0x0b,0x06,0x02,0xff,0x0a,0x05,0x02,0xff,0x0a,0x05,0x02,0xff,0x09,0x06,0x01,0xff,0x09,0x06,0x01,0xff,0x0b,0x06,0x02,0xff,0x0c,0x07,0x02,0xff,0x08,0x05,0x01,0xff,0x08,0x06,0x02,0xff,0x09,0x07,0x02,0xff,0x09,0x05,0x02,0xff,0x09,0x07,0x02,0xff,0x07,0x05,0x02,0xff,0x07,0x05,0x01,0xff,0x0e,0x09,0x01,0xff,0x15,0x0d,0x03,0xff,0x4a,0x46,0x0a,0xff,0x41,0x48,0x08,0xff,0x13,0x15,0x05,0xff,0x08,0x07,0x02,0xff,0x0c,0x0d,0x04,0xff,0x0a,0x0a,0x05,0xff,0x07,0x05,0x03,0xff,0x08,0x06,0x01,0xff,0x13,0x19,0x20,0xff,0x6b,0x7e,0x8b,0xff,0x49,0x51,0x58,0xff,0x1c,0x1c,0x5e,0xff,0x18,0x39,0xcf,0xff,0x15,0x72,0xfb,0xff,0x1e,0x83,0xd9,0xff,0x1f,0x57,0x7e,0xff,0x19,0x47,0x61,0xff,0x4b,0x79,0x90,0xff,0xc4,0xd8,0xdd,0xff,0xe0,0xf3,0xf9,0xff,0x44,0xc0,0xff,0xff,0x3e,0x99,0xc8,0xff,0xb7,0xbe,0xc1,0xff,0x96,0xab,0xb7,0xff,0x58,0x68,0x7c,0xff,0x20,0x32,0x4c,0xff,0xb4,0xcd,0xd7,0xff,0xea,0xff,0xff,0xff,0xe3,0xf6,0xf7,0xff,0x96,0xaa,0xab,0xff,0xce,0xe2,0xeb,0xff,0xca,0xdc,0xe5,0xff,0xa3,0xa9,0xab,0xff,0x5b,0x57,0x53,0xff,0x2e,0x1f,0x14,0xff,0x25,0x17,0x09,0xff,0x28,0x19,0x0a,0xff,0x2a,0x1a,0x08,0xff,0x27,0x1a,0x07,0xff,0x25,0x1a,0x06,0xff,0x26,0x19,0x06,0xff,0x27,0x1a,0x06,0xff,0x27,0x18,0x06,0xff,0x27,0x18,0x07,0xff,0x26,0x18,0x06,0xff,0x25,0x18,0x06,0xff,0x24,0x19,0x06,0xff,0x24,0x17,0x06,0xff,0x24,0x17,0x08,0xff,0x23,0x17,0x06,0xff,0x23,0x17,0x05,0xff,0x24,0x18,0x05,0xff,0x25,0x19,0x04,0xff,0x27,0x19,0x04,0xff,0x28,0x1b,0x03,0xff,0x2b,0x1c,0x02,0xff,0x2c,0x1e,0x01,0xff,0x2c,0x1d,0x01,0xff,0x2c,0x1c,0x01,0xff,0x2e,0x1d,0x02,0xff,0x2e,0x1d,0x02,0xff,0x2c,0x1c,0x00,0xff,0x2d,0x1c,0x01,0xff,0x2d,0x1c,0x01,0xff,0x2d,0x1c,0x01,0xff,0x2c,0x1c,0x01,0xff,0x2d,0x1c,0x01,0xff,0x2d,0x1b,0x00,0xff,0x26,0x14,0x00,0xff,0x9c,0x94,0x87,0x6c,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xee,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe4,0xee,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xef,0xe5,0xe0,0xb1,0x8d,0x44,0x20,0xff,0x79,0x28,0x00,0xff,0x7d,0x2f,0x04,0xff,0x7f,0x33,0x07,0xff,0x7f,0x38,0x0e,0xff,0x83,0x3f,0x19,0xff,0x83,0x43,0x20,0xff,0x82,0x45,0x24,0xff,0x81,0x46,0x26,0xff,0x7c,0x42,0x22,0xff,0x7e,0x47,0x24,0xff,0x7a,0x44,0x1e,0xff,0x79,0x44,0x19,0xff,0x6f,0x3d,0x08,0xff,0x6c,0x3a,0x01,0xff,0x6c,0x39,0x02,0xff,0x6b,0x37,0x01,0xff,0x6a,0x37,0x02,0xff,0x6a,0x36,0x01,0xff,0x66,0x33,0x01,0xff,0x6f,0x37,0x02,0xff,0xbe,0x55,0x03,0xff,0xdd,0x5c,0x01,0xff,0xcc,0x57,0x01,0xff,0xb2,0x4e,0x01,0xff,0xb1,0x51,0x01,0xff,0xa8,0x4c,0x02,0xff,0xa9,0x4f,0x02,0xff,0xba,0x60,0x02,0xff,0xad,0x58,0x01,0xff,0xa3,0x57,0x00,0xff,0xba,0x65,0x01,0xff,0xbf,0x66,0x02,0xff,0x75,0x40,0x01,0xff,0x2c,0x18,0x02,0xff,0x81,0x46,0x05,0xff,0xe9,0xbe,0x06,0xff,0xe5,0xb4,0x05,0xff,0x90,0x5f,0x0e,0xff,0x2f,0x15,0x04,0xff,0x43,0x23,0x04,0xff,0x47,0x28,0x05,0xff,0x23,0x17,0x02,0xff,0x1d,0x17,0x04,0xff,0x2b,0x1e,0x0d,0xff,0x17,0x0d,0x04,0xff,0x0d,0x07,0x01,0xff,0x0c,0x06,0x01,0xff,0x0a,0x05,0x01,0xff,0x0a,0x05,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x0a,0x05,0x01,0xff,0x0b,0x06,0x01,0xff,0x0a,0x07,0x01,0xff,0x0c,0x07,0x02,0xff,0x08,0x05,0x01,0xff,0x08,0x05,0x01,0xff,0x09,0x06,0x01,0xff,0x08,0x05,0x02,0xff,0x08,0x05,0x01,0xff,0x09,0x05,0x02,0xff,0x09,0x06,0x02,0xff,0x09,0x06,0x03,0xff,0x07,0x04,0x02,0xff,0x01,0x00,0x01,0xff,0x04,0x00,0x03,0xff,0x13,0x13,0x03,0xff,0x11,0x11,0x03,0xff,0x0b,0x0b,0x02,0xff,0x0a,0x0b,0x03,0xff,0x07,0x07,0x02,0xff,0x08,0x06,0x01,0xff,0x0e,0x0c,0x09,0xff,0x10,0x12,0x13,0xff,0x72,0x82,0x8d,0xff,0x3d,0x46,0x54,0xff,0x0e,0x19,0x73,0xff,0x14,0x42,0xd4,0xff,0x15,0x79,0xf8,0xff,0x1f,0xa2,0xff,0xff,0x21,0x99,0xde,0xff,0x2c,0x66,0x86,0xff,0x4f,0x58,0x5c,0xff,0x96,0xa0,0x9e,0xff,0x83,0xd1,0xf2,0xff,0x31,0xb4,0xeb,0xff,0xa6,0xb3,0xba,0xff,0x8a,0x97,0xa0,0xff,0x39,0x46,0x58,0xff,0x23,0x35,0x4c,0xff,0x4e,0x6f,0x84,0xff,0xcb,0xdf,0xe3,0xff,0xec,0xfc,0xfb,0xff,0x6e,0x71,0x6d,0xff,0x44,0x3d,0x36,0xff,0x39,0x2e,0x24,0xff,0x21,0x11,0x03,0xff,0x1f,0x0e,0x00,0xff,0x25,0x17,0x06,0xff,0x29,0x1a,0x0a,0xff,0x28,0x1a,0x09,0xff,0x26,0x18,0x08,0xff,0x26,0x19,0x07,0xff,0x25,0x19,0x06,0xff,0x25,0x18,0x06,0xff,0x26,0x18,0x07,0xff,0x28,0x19,0x07,0xff,0x26,0x18,0x06,0xff,0x26,0x18,0x06,0xff,0x25,0x18,0x06,0xff,0x23,0x18,0x06,0xff,0x24,0x17,0x06,0xff,0x23,0x16,0x06,0xff,0x22,0x16,0x06,0xff,0x23,0x18,0x06,0xff,0x24,0x18,0x06,0xff,0x26,0x19,0x05,0xff,0x27,0x19,0x04,0xff,0x29,0x1b,0x03,0xff,0x2b,0x1c,0x03,0xff,0x2b,0x1e,0x01,0xff,0x2b,0x1d,0x00,0xff,0x2d,0x1c,0x02,0xff,0x2d,0x1c,0x01,0xff,0x2e,0x1e,0x03,0xff,0x2e,0x1d,0x02,0xff,0x2d,0x1c,0x01,0xff,0x2d,0x1c,0x01,0xff,0x2c,0x1b,0x01,0xff,0x2d,0x1d,0x01,0xff,0x2d,0x1c,0x01,0xff,0x2a,0x19,0x00,0xff,0x36,0x25,0x0c,0xf5,0xd1,0xcd,0xc8,0x26,0xff,0xff,0xff,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xec,0xf3,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe5,0xee,0x00,0xfe,0xeb,0xf2,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x5e,0xad,0x7a,0x5f,0xff,0x7a,0x26,0x00,0xff,0x82,0x32,0x0a,0xff,0x81,0x35,0x0d,0xff,0x80,0x39,0x10,0xff,0x87,0x44,0x23,0xff,0x88,0x4d,0x38,0xff,0x82,0x58,0x44,0xff,0x89,0x6b,0x58,0xff,0x86,0x64,0x50,0xff,0x82,0x59,0x3d,0xff,0x7d,0x4d,0x30,0xff,0x7c,0x4b,0x26,0xff,0x70,0x3e,0x09,0xff,0x6f,0x3c,0x04,0xff,0x70,0x3c,0x04,0xff,0x6c,0x38,0x01,0xff,0x6c,0x38,0x01,0xff,0x6a,0x37,0x01,0xff,0x68,0x34,0x01,0xff,0x63,0x33,0x02,0xff,0xac,0x4e,0x02,0xff,0xd9,0x58,0x01,0xff,0xbc,0x50,0x01,0xff,0xa5,0x48,0x01,0xff,0x9c,0x43,0x01,0xff,0xa5,0x4b,0x01,0xff,0xb9,0x60,0x02,0xff,0xb2,0x5e,0x03,0xff,0xa9,0x57,0x01,0xff,0xb4,0x63,0x01,0xff,0xb9,0x68,0x03,0xff,0x98,0x53,0x01,0xff,0x57,0x30,0x01,0xff,0x5a,0x2e,0x03,0xff,0xa3,0x6d,0x08,0xff,0xff,0xe2,0x05,0xff,0xb3,0x8d,0x07,0xff,0x3c,0x25,0x04,0xff,0x6b,0x44,0x07,0xff,0x6e,0x4c,0x08,0xff,0x50,0x42,0x0a,0xff,0x2d,0x2d,0x06,0xff,0x32,0x28,0x04,0xff,0x19,0x10,0x07,0xff,0x0f,0x06,0x04,0xff,0x0c,0x05,0x01,0xff,0x0b,0x06,0x01,0xff,0x09,0x04,0x01,0xff,0x08,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x05,0x01,0xff,0x0a,0x04,0x01,0xff,0x0b,0x04,0x02,0xff,0x0c,0x06,0x02,0xff,0x0e,0x09,0x01,0xff,0x0d,0x08,0x02,0xff,0x09,0x04,0x01,0xff,0x09,0x05,0x01,0xff,0x0a,0x06,0x01,0xff,0x08,0x06,0x02,0xff,0x08,0x05,0x02,0xff,0x08,0x06,0x02,0xff,0x08,0x05,0x01,0xff,0x07,0x06,0x01,0xff,0x06,0x06,0x01,0xff,0x09,0x05,0x03,0xff,0x0b,0x06,0x03,0xff,0x10,0x10,0x02,0xff,0x18,0x19,0x02,0xff,0x0d,0x0c,0x01,0xff,0x0a,0x0a,0x03,0xff,0x08,0x08,0x02,0xff,0x05,0x08,0x02,0xff,0x06,0x07,0x03,0xff,0x04,0x00,0x00,0xff,0x42,0x4d,0x5a,0xff,0x82,0x9a,0xb4,0xff,0x1c,0x23,0x46,0xff,0x10,0x1a,0x98,0xff,0x1f,0x5e,0xe7,0xff,0x22,0x8a,0xf6,0xff,0x1c,0xa5,0xff,0xff,0x43,0xb8,0xfb,0xff,0x68,0x7d,0x84,0xff,0x39,0x3f,0x3e,0xff,0x52,0x69,0x71,0xff,0x45,0x96,0xbb,0xff,0x97,0xb5,0xbd,0xff,0xae,0xb9,0xbe,0xff,0x38,0x4b,0x5b,0xff,0x2e,0x49,0x5b,0xff,0x81,0x9a,0xa6,0xff,0x95,0xa7,0xaa,0xff,0xc6,0xd2,0xd3,0xff,0x53,0x4e,0x45,0xff,0x1c,0x09,0x00,0xff,0x27,0x17,0x04,0xff,0x29,0x1b,0x07,0xff,0x28,0x1c,0x09,0xff,0x28,0x19,0x0a,0xff,0x28,0x18,0x09,0xff,0x27,0x18,0x09,0xff,0x26,0x17,0x07,0xff,0x27,0x1a,0x08,0xff,0x24,0x18,0x06,0xff,0x24,0x17,0x05,0xff,0x26,0x18,0x06,0xff,0x28,0x18,0x07,0xff,0x27,0x19,0x07,0xff,0x26,0x18,0x06,0xff,0x24,0x17,0x05,0xff,0x23,0x17,0x05,0xff,0x23,0x17,0x06,0xff,0x22,0x15,0x06,0xff,0x23,0x16,0x06,0xff,0x22,0x16,0x04,0xff,0x24,0x18,0x06,0xff,0x26,0x19,0x05,0xff,0x27,0x19,0x04,0xff,0x28,0x1a,0x02,0xff,0x2a,0x1c,0x02,0xff,0x2c,0x1e,0x01,0xff,0x2c,0x1d,0x01,0xff,0x2d,0x1d,0x01,0xff,0x2d,0x1d,0x01,0xff,0x2d,0x1d,0x02,0xff,0x2f,0x1d,0x02,0xff,0x2e,0x1d,0x00,0xff,0x2e,0x1d,0x00,0xff,0x2e,0x1d,0x01,0xff,0x2e,0x1d,0x02,0xff,0x2c,0x1c,0x01,0xff,0x23,0x12,0x00,0xff,0x60,0x53,0x40,0xb9,0xf9,0xf8,0xf8,0x00,0xff,0xff,0xff,0x00,0xfe,0xed,0xf4,0x00,0xfe,0xec,0xf3,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x18,0xd7,0xbd,0xb1,0xe8,0x81,0x30,0x06,0xff,0x83,0x34,0x0a,0xff,0x89,0x3e,0x1f,0xff,0x8b,0x44,0x28,0xff,0x8c,0x56,0x40,0xff,0xa1,0x9b,0x93,0xff,0xc1,0xcb,0xc7,0xff,0xd9,0xe7,0xe7,0xff,0xd9,0xe6,0xe6,0xff,0xb9,0xbf,0xbc,0xff,0x8b,0x7e,0x70,0xff,0x7b,0x4c,0x2b,0xff,0x78,0x45,0x17,0xff,0x74,0x43,0x12,0xff,0x72,0x3f,0x09,0xff,0x6e,0x3b,0x03,0xff,0x6b,0x37,0x01,0xff,0x6a,0x35,0x00,0xff,0x6a,0x35,0x01,0xff,0x61,0x31,0x01,0xff,0x9b,0x48,0x03,0xff,0xd2,0x54,0x03,0xff,0xb4,0x4b,0x03,0xff,0xa3,0x49,0x00,0xff,0xa9,0x4d,0x02,0xff,0xb2,0x58,0x03,0xff,0xb0,0x5c,0x01,0xff,0x99,0x4e,0x00,0xff,0x98,0x4e,0x01,0xff,0xa7,0x59,0x01,0xff,0x9c,0x57,0x02,0xff,0x76,0x40,0x02,0xff,0x68,0x36,0x02,0xff,0x76,0x3e,0x03,0xff,0xca,0xab,0x08,0xff,0xca,0xad,0x08,0xff,0x27,0x1f,0x04,0xff,0x36,0x2e,0x06,0xff,0x3b,0x32,0x08,0xff,0x1e,0x1a,0x05,0xff,0x10,0x0d,0x02,0xff,0x10,0x07,0x01,0xff,0x0e,0x06,0x01,0xff,0x10,0x0a,0x02,0xff,0x0b,0x07,0x01,0xff,0x09,0x04,0x01,0xff,0x08,0x04,0x00,0xff,0x08,0x04,0x01,0xff,0x08,0x05,0x01,0xff,0x09,0x05,0x01,0xff,0x08,0x03,0x01,0xff,0x09,0x05,0x00,0xff,0x0c,0x06,0x01,0xff,0x0d,0x07,0x02,0xff,0x0d,0x07,0x01,0xff,0x0d,0x06,0x00,0xff,0x09,0x05,0x01,0xff,0x08,0x05,0x01,0xff,0x0a,0x06,0x01,0xff,0x09,0x05,0x01,0xff,0x09,0x06,0x00,0xff,0x08,0x06,0x01,0xff,0x08,0x04,0x02,0xff,0x08,0x05,0x02,0xff,0x08,0x06,0x01,0xff,0x07,0x07,0x02,0xff,0x09,0x06,0x02,0xff,0x0b,0x08,0x04,0xff,0x16,0x17,0x02,0xff,0x13,0x14,0x01,0xff,0x0b,0x09,0x03,0xff,0x0a,0x09,0x01,0xff,0x09,0x08,0x02,0xff,0x06,0x05,0x00,0xff,0x0b,0x05,0x03,0xff,0x11,0x19,0x1e,0xff,0x7f,0xa4,0xc4,0xff,0x64,0x79,0x8a,0xff,0x0a,0x0b,0x4d,0xff,0x2c,0x48,0xc9,0xff,0x25,0x70,0xf0,0xff,0x1f,0x8b,0xfa,0xff,0x2e,0xa3,0xf7,0xff,0x81,0xa4,0xbb,0xff,0x5a,0x67,0x67,0xff,0x6c,0x75,0x78,0xff,0x5c,0x7b,0x8c,0xff,0x49,0x61,0x6b,0xff,0xcf,0xd8,0xd7,0xff,0x94,0xa9,0xb0,0xff,0x7f,0xa0,0xa8,0xff,0xeb,0xfc,0xfc,0xff,0xdf,0xf1,0xf1,0xff,0xd6,0xe3,0xe3,0xff,0x45,0x3e,0x38,0xff,0x26,0x14,0x04,0xff,0x2a,0x1c,0x0b,0xff,0x29,0x19,0x0a,0xff,0x29,0x19,0x09,0xff,0x28,0x19,0x09,0xff,0x27,0x19,0x09,0xff,0x27,0x17,0x08,0xff,0x27,0x18,0x08,0xff,0x26,0x18,0x07,0xff,0x24,0x18,0x06,0xff,0x25,0x17,0x05,0xff,0x26,0x18,0x07,0xff,0x27,0x19,0x07,0xff,0x25,0x17,0x06,0xff,0x26,0x17,0x06,0xff,0x24,0x17,0x05,0xff,0x23,0x17,0x05,0xff,0x23,0x17,0x05,0xff,0x22,0x16,0x05,0xff,0x22,0x16,0x04,0xff,0x22,0x17,0x05,0xff,0x24,0x18,0x05,0xff,0x26,0x19,0x04,0xff,0x27,0x19,0x03,0xff,0x28,0x1a,0x02,0xff,0x2a,0x1c,0x02,0xff,0x2b,0x1d,0x01,0xff,0x2c,0x1d,0x02,0xff,0x2d,0x1d,0x01,0xff,0x2e,0x1d,0x02,0xff,0x2e,0x1d,0x02,0xff,0x2e,0x1d,0x01,0xff,0x2e,0x1e,0x00,0xff,0x2f,0x1d,0x01,0xff,0x30,0x1e,0x01,0xff,0x2f,0x1d,0x01,0xff,0x2d,0x1b,0x00,0xff,0x28,0x16,0x00,0xff,0xa3,0x9c,0x90,0x64,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xed,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xf6,0xf1,0xee,0x9e,0x97,0x56,0x34,0xff,0x80,0x2f,0x06,0xff,0x8a,0x40,0x23,0xff,0x8d,0x50,0x3e,0xff,0xad,0xac,0xa1,0xff,0xf5,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xda,0xe8,0xe7,0xff,0x8d,0x7f,0x74,0xff,0x80,0x50,0x32,0xff,0x77,0x45,0x1a,0xff,0x73,0x40,0x0d,0xff,0x70,0x3c,0x05,0xff,0x6b,0x37,0x02,0xff,0x6a,0x36,0x01,0xff,0x68,0x33,0x01,0xff,0x61,0x30,0x01,0xff,0x89,0x40,0x03,0xff,0xdd,0x58,0x03,0xff,0xc4,0x55,0x02,0xff,0xc0,0x5a,0x01,0xff,0xca,0x68,0x02,0xff,0xbb,0x5f,0x01,0xff,0xa5,0x51,0x02,0xff,0x9b,0x4e,0x01,0xff,0xa5,0x58,0x02,0xff,0x9d,0x55,0x01,0xff,0x84,0x48,0x02,0xff,0x75,0x3f,0x01,0xff,0x79,0x41,0x04,0xff,0x89,0x61,0x06,0xff,0xd4,0xbc,0x0b,0xff,0x3a,0x26,0x05,0xff,0x29,0x1c,0x0a,0xff,0x1c,0x14,0x03,0xff,0x0d,0x05,0x00,0xff,0x11,0x06,0x00,0xff,0x0f,0x07,0x01,0xff,0x0f,0x09,0x02,0xff,0x0d,0x07,0x02,0xff,0x0d,0x07,0x01,0xff,0x0d,0x05,0x00,0xff,0x0a,0x03,0x01,0xff,0x08,0x03,0x01,0xff,0x08,0x04,0x00,0xff,0x08,0x04,0x00,0xff,0x0a,0x05,0x02,0xff,0x0a,0x05,0x02,0xff,0x0b,0x07,0x02,0xff,0x0c,0x06,0x00,0xff,0x0b,0x04,0x01,0xff,0x0e,0x08,0x02,0xff,0x10,0x09,0x02,0xff,0x0b,0x06,0x01,0xff,0x08,0x05,0x01,0xff,0x0a,0x06,0x01,0xff,0x0a,0x06,0x01,0xff,0x0a,0x07,0x01,0xff,0x08,0x06,0x01,0xff,0x08,0x05,0x01,0xff,0x08,0x05,0x02,0xff,0x08,0x05,0x02,0xff,0x06,0x05,0x01,0xff,0x07,0x05,0x01,0xff,0x07,0x05,0x01,0xff,0x0f,0x0d,0x02,0xff,0x18,0x19,0x03,0xff,0x0d,0x0d,0x01,0xff,0x0a,0x09,0x02,0xff,0x0b,0x09,0x02,0xff,0x09,0x06,0x02,0xff,0x08,0x04,0x00,0xff,0x0c,0x0b,0x0b,0xff,0x39,0x4d,0x63,0xff,0x6c,0x87,0x99,0xff,0x1c,0x21,0x31,0xff,0x1b,0x24,0x81,0xff,0x1f,0x48,0xd7,0xff,0x1e,0x74,0xf6,0xff,0x24,0x8e,0xf7,0xff,0x79,0xad,0xda,0xff,0x47,0x48,0x47,0xff,0x4b,0x44,0x44,0xff,0x82,0xd1,0xf8,0xff,0x46,0x97,0xbc,0xff,0x5c,0x61,0x61,0xff,0xb8,0xc3,0xc3,0xff,0xed,0xfb,0xfb,0xff,0xe1,0xf6,0xf6,0xff,0xe2,0xf6,0xf8,0xff,0xd7,0xe5,0xe5,0xff,0x3a,0x31,0x2d,0xff,0x28,0x16,0x07,0xff,0x2b,0x1b,0x0b,0xff,0x28,0x19,0x0a,0xff,0x26,0x18,0x08,0xff,0x27,0x18,0x08,0xff,0x27,0x18,0x09,0xff,0x26,0x17,0x08,0xff,0x26,0x18,0x08,0xff,0x26,0x18,0x06,0xff,0x25,0x18,0x06,0xff,0x25,0x18,0x06,0xff,0x25,0x16,0x05,0xff,0x26,0x18,0x06,0xff,0x25,0x17,0x05,0xff,0x25,0x17,0x05,0xff,0x24,0x17,0x05,0xff,0x22,0x16,0x04,0xff,0x22,0x17,0x04,0xff,0x23,0x17,0x04,0xff,0x22,0x16,0x04,0xff,0x22,0x16,0x04,0xff,0x23,0x17,0x03,0xff,0x25,0x18,0x04,0xff,0x27,0x19,0x03,0xff,0x29,0x1b,0x02,0xff,0x2a,0x1b,0x02,0xff,0x2a,0x1c,0x01,0xff,0x2b,0x1c,0x01,0xff,0x2d,0x1c,0x01,0xff,0x2e,0x1c,0x01,0xff,0x2e,0x1d,0x01,0xff,0x2c,0x1c,0x00,0xff,0x2d,0x1d,0x01,0xff,0x2f,0x1d,0x01,0xff,0x2f,0x1d,0x01,0xff,0x2f,0x1d,0x00,0xff,0x2b,0x17,0x00,0xff,0x43,0x32,0x1a,0xe9,0xe0,0xde,0xda,0x19,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf9,0x00,0xfd,0xe4,0xef,0x00,0xfe,0xee,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe9,0xf2,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x44,0xc0,0x98,0x83,0xff,0x81,0x30,0x09,0xff,0x88,0x3f,0x23,0xff,0x8e,0x58,0x47,0xff,0xc1,0xcb,0xc7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0xfd,0xff,0xff,0xff,0xfe,0xff,0xff,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xcb,0xca,0xff,0x84,0x61,0x4f,0xff,0x7d,0x4b,0x27,0xff,0x77,0x43,0x14,0xff,0x70,0x3c,0x06,0xff,0x6d,0x39,0x02,0xff,0x6b,0x37,0x02,0xff,0x69,0x34,0x01,0xff,0x65,0x32,0x01,0xff,0x74,0x39,0x02,0xff,0xd9,0x58,0x03,0xff,0xd2,0x5d,0x01,0xff,0xd7,0x6c,0x02,0xff,0xd7,0x72,0x01,0xff,0xca,0x6c,0x02,0xff,0xab,0x5b,0x01,0xff,0x9c,0x4e,0x02,0xff,0xa2,0x55,0x03,0xff,0x95,0x51,0x01,0xff,0x88,0x49,0x02,0xff,0x8a,0x4c,0x03,0xff,0x7f,0x47,0x06,0xff,0xa5,0x86,0x0d,0xff,0x47,0x38,0x07,0xff,0x10,0x04,0x03,0xff,0x15,0x0a,0x02,0xff,0x0d,0x05,0x02,0xff,0x11,0x09,0x01,0xff,0x10,0x08,0x01,0xff,0x0c,0x07,0x01,0xff,0x0c,0x06,0x00,0xff,0x0c,0x06,0x01,0xff,0x0b,0x06,0x00,0xff,0x0f,0x08,0x02,0xff,0x0c,0x05,0x01,0xff,0x09,0x04,0x00,0xff,0x09,0x04,0x00,0xff,0x0b,0x06,0x01,0xff,0x0c,0x06,0x01,0xff,0x0d,0x08,0x02,0xff,0x0b,0x05,0x02,0xff,0x0a,0x05,0x01,0xff,0x0b,0x05,0x02,0xff,0x0e,0x08,0x01,0xff,0x0f,0x07,0x01,0xff,0x0c,0x06,0x02,0xff,0x08,0x04,0x01,0xff,0x0b,0x06,0x01,0xff,0x0b,0x07,0x02,0xff,0x09,0x06,0x00,0xff,0x08,0x06,0x01,0xff,0x08,0x05,0x02,0xff,0x08,0x05,0x02,0xff,0x08,0x05,0x02,0xff,0x07,0x05,0x02,0xff,0x08,0x06,0x02,0xff,0x09,0x07,0x01,0xff,0x08,0x06,0x01,0xff,0x14,0x14,0x02,0xff,0x13,0x14,0x02,0xff,0x09,0x08,0x03,0xff,0x0b,0x08,0x02,0xff,0x09,0x07,0x02,0xff,0x09,0x05,0x02,0xff,0x07,0x03,0x00,0xff,0x0f,0x13,0x18,0xff,0x55,0x74,0x8c,0xff,0x53,0x6b,0x77,0xff,0x19,0x17,0x3f,0xff,0x31,0x46,0xbe,0xff,0x25,0x56,0xe0,0xff,0x23,0x77,0xf7,0xff,0x57,0x98,0xe0,0xff,0x3e,0x40,0x40,0xff,0x07,0x06,0x03,0xff,0x16,0x30,0x44,0xff,0x4d,0x8c,0xaf,0xff,0xaf,0xbc,0xbe,0xff,0x81,0x83,0x84,0xff,0x8e,0x98,0x99,0xff,0xea,0xfb,0xfb,0xff,0xe5,0xfd,0xfe,0xff,0xca,0xdd,0xdd,0xff,0x32,0x29,0x23,0xff,0x28,0x17,0x07,0xff,0x2a,0x1a,0x0b,0xff,0x27,0x19,0x0a,0xff,0x27,0x19,0x08,0xff,0x27,0x19,0x09,0xff,0x27,0x18,0x08,0xff,0x26,0x17,0x08,0xff,0x26,0x17,0x07,0xff,0x26,0x18,0x06,0xff,0x26,0x18,0x06,0xff,0x26,0x18,0x07,0xff,0x24,0x18,0x05,0xff,0x24,0x17,0x05,0xff,0x23,0x16,0x04,0xff,0x23,0x17,0x05,0xff,0x23,0x16,0x04,0xff,0x23,0x16,0x05,0xff,0x22,0x16,0x04,0xff,0x22,0x17,0x04,0xff,0x22,0x16,0x04,0xff,0x22,0x17,0x04,0xff,0x23,0x17,0x03,0xff,0x25,0x18,0x04,0xff,0x27,0x19,0x03,0xff,0x29,0x1b,0x02,0xff,0x2a,0x1b,0x02,0xff,0x2b,0x1c,0x01,0xff,0x2b,0x1c,0x01,0xff,0x2d,0x1c,0x01,0xff,0x2e,0x1d,0x02,0xff,0x2d,0x1c,0x01,0xff,0x2d,0x1c,0x01,0xff,0x2d,0x1c,0x01,0xff,0x2f,0x1c,0x01,0xff,0x2f,0x1c,0x01,0xff,0x2f,0x1c,0x01,0xff,0x26,0x12,0x00,0xff,0x7c,0x6f,0x60,0x9d,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xec,0xf3,0x00,0xfd,0xe4,0xef,0x00,0xfe,0xee,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xff,0xff,0x03,0xe7,0xd8,0xd1,0xcb,0x8e,0x45,0x25,0xff,0x85,0x3c,0x21,0xff,0x8d,0x59,0x49,0xff,0xc4,0xcb,0xc7,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdd,0xe7,0xe6,0xff,0x89,0x6e,0x60,0xff,0x7a,0x47,0x28,0xff,0x72,0x40,0x11,0xff,0x6f,0x3c,0x05,0xff,0x6b,0x38,0x02,0xff,0x69,0x36,0x01,0xff,0x68,0x35,0x01,0xff,0x66,0x33,0x01,0xff,0x67,0x32,0x02,0xff,0xc7,0x54,0x02,0xff,0xd3,0x59,0x00,0xff,0xcc,0x64,0x03,0xff,0xd6,0x70,0x04,0xff,0xc6,0x69,0x02,0xff,0xae,0x59,0x01,0xff,0xb3,0x61,0x03,0xff,0x9d,0x54,0x03,0xff,0x6f,0x38,0x01,0xff,0x77,0x3e,0x00,0xff,0x88,0x4a,0x03,0xff,0x66,0x40,0x09,0xff,0x34,0x2a,0x08,0xff,0x0c,0x03,0x01,0xff,0x18,0x0d,0x02,0xff,0x0f,0x09,0x02,0xff,0x10,0x06,0x01,0xff,0x0d,0x07,0x01,0xff,0x0b,0x06,0x01,0xff,0x0b,0x07,0x01,0xff,0x0e,0x08,0x01,0xff,0x0f,0x09,0x01,0xff,0x0b,0x05,0x01,0xff,0x0d,0x07,0x01,0xff,0x0c,0x07,0x00,0xff,0x09,0x05,0x00,0xff,0x09,0x05,0x01,0xff,0x0b,0x06,0x01,0xff,0x0c,0x07,0x01,0xff,0x0c,0x07,0x01,0xff,0x0a,0x03,0x01,0xff,0x09,0x05,0x01,0xff,0x0b,0x06,0x02,0xff,0x10,0x09,0x01,0xff,0x12,0x0a,0x02,0xff,0x0c,0x05,0x02,0xff,0x08,0x04,0x01,0xff,0x0a,0x07,0x02,0xff,0x0a,0x05,0x00,0xff,0x09,0x05,0x00,0xff,0x09,0x06,0x01,0xff,0x08,0x05,0x01,0xff,0x09,0x05,0x02,0xff,0x07,0x04,0x01,0xff,0x08,0x05,0x01,0xff,0x08,0x05,0x02,0xff,0x09,0x07,0x02,0xff,0x06,0x04,0x02,0xff,0x0e,0x0b,0x02,0xff,0x16,0x15,0x02,0xff,0x0d,0x0b,0x02,0xff,0x09,0x07,0x03,0xff,0x08,0x07,0x02,0xff,0x08,0x07,0x03,0xff,0x08,0x05,0x01,0xff,0x04,0x04,0x01,0xff,0x22,0x2f,0x3c,0xff,0x69,0x8b,0xa4,0xff,0x55,0x6b,0x78,0xff,0x2c,0x33,0x6b,0xff,0x23,0x37,0xc0,0xff,0x20,0x56,0xea,0xff,0x49,0x87,0xf3,0xff,0x5c,0x68,0x73,0xff,0x09,0x0a,0x08,0xff,0x03,0x03,0x02,0xff,0x07,0x04,0x06,0xff,0x4d,0x55,0x56,0xff,0xbb,0xc8,0xc9,0xff,0x82,0x8c,0x8c,0xff,0x70,0x7b,0x7e,0xff,0xd4,0xed,0xf3,0xff,0xc2,0xd3,0xd2,0xff,0x24,0x19,0x0f,0xff,0x2b,0x18,0x08,0xff,0x28,0x1a,0x0c,0xff,0x26,0x18,0x08,0xff,0x28,0x19,0x09,0xff,0x27,0x18,0x09,0xff,0x26,0x18,0x08,0xff,0x26,0x17,0x07,0xff,0x25,0x17,0x07,0xff,0x25,0x17,0x06,0xff,0x25,0x17,0x06,0xff,0x24,0x17,0x06,0xff,0x24,0x18,0x07,0xff,0x23,0x17,0x06,0xff,0x22,0x16,0x05,0xff,0x22,0x16,0x05,0xff,0x22,0x16,0x04,0xff,0x22,0x16,0x04,0xff,0x22,0x17,0x04,0xff,0x22,0x16,0x05,0xff,0x23,0x15,0x05,0xff,0x23,0x16,0x05,0xff,0x23,0x17,0x05,0xff,0x26,0x18,0x04,0xff,0x26,0x19,0x03,0xff,0x28,0x1a,0x02,0xff,0x29,0x1b,0x01,0xff,0x2a,0x1b,0x01,0xff,0x2a,0x1c,0x00,0xff,0x2d,0x1d,0x02,0xff,0x2d,0x1c,0x01,0xff,0x2c,0x1b,0x00,0xff,0x2c,0x1b,0x00,0xff,0x2c,0x1c,0x01,0xff,0x2e,0x1c,0x01,0xff,0x2e,0x1b,0x01,0xff,0x2c,0x19,0x00,0xff,0x31,0x1e,0x04,0xff,0xc1,0xbc,0xb4,0x3f,0xff,0xff,0xff,0x00,0xff,0xf9,0xfb,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xef,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xed,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x6b,0xb0,0x7e,0x68,0xff,0x83,0x38,0x1d,0xff,0x8e,0x52,0x44,0xff,0xb3,0xb5,0xaf,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd2,0xde,0xdd,0xff,0x85,0x66,0x54,0xff,0x7a,0x45,0x24,0xff,0x74,0x3f,0x12,0xff,0x70,0x3b,0x06,0xff,0x6b,0x37,0x02,0xff,0x69,0x37,0x01,0xff,0x69,0x35,0x01,0xff,0x68,0x35,0x02,0xff,0x5e,0x32,0x01,0xff,0xa5,0x4b,0x02,0xff,0xd4,0x59,0x01,0xff,0xb8,0x4f,0x01,0xff,0xb9,0x58,0x02,0xff,0xb8,0x60,0x04,0xff,0xb0,0x5c,0x03,0xff,0x8e,0x47,0x02,0xff,0x67,0x30,0x00,0xff,0x83,0x43,0x03,0xff,0xb2,0x66,0x04,0xff,0x7c,0x46,0x05,0xff,0x16,0x0b,0x02,0xff,0x01,0x00,0x01,0xff,0x16,0x0b,0x01,0xff,0x19,0x0c,0x01,0xff,0x11,0x07,0x01,0xff,0x0e,0x06,0x01,0xff,0x0d,0x06,0x01,0xff,0x0f,0x09,0x01,0xff,0x0e,0x07,0x00,0xff,0x0f,0x07,0x01,0xff,0x0f,0x08,0x00,0xff,0x0d,0x07,0x01,0xff,0x0d,0x07,0x01,0xff,0x10,0x0a,0x01,0xff,0x09,0x05,0x01,0xff,0x08,0x04,0x02,0xff,0x0b,0x06,0x01,0xff,0x0b,0x07,0x01,0xff,0x09,0x05,0x01,0xff,0x09,0x04,0x01,0xff,0x0a,0x05,0x02,0xff,0x0b,0x06,0x01,0xff,0x0e,0x08,0x02,0xff,0x0e,0x08,0x01,0xff,0x0d,0x06,0x02,0xff,0x09,0x04,0x01,0xff,0x09,0x06,0x01,0xff,0x0a,0x06,0x01,0xff,0x09,0x05,0x00,0xff,0x09,0x05,0x01,0xff,0x07,0x05,0x01,0xff,0x08,0x05,0x02,0xff,0x07,0x04,0x02,0xff,0x08,0x05,0x01,0xff,0x08,0x05,0x01,0xff,0x07,0x04,0x01,0xff,0x06,0x04,0x01,0xff,0x0a,0x06,0x03,0xff,0x13,0x0f,0x03,0xff,0x12,0x10,0x03,0xff,0x0a,0x08,0x03,0xff,0x08,0x06,0x03,0xff,0x07,0x07,0x02,0xff,0x08,0x07,0x03,0xff,0x09,0x07,0x02,0xff,0x04,0x03,0x00,0xff,0x28,0x31,0x38,0xff,0x6b,0x87,0xa0,0xff,0x1d,0x21,0x2d,0xff,0x27,0x2c,0x86,0xff,0x22,0x3e,0xd2,0xff,0x37,0x6b,0xf4,0xff,0x59,0x74,0xa6,0xff,0x18,0x1a,0x13,0xff,0x03,0x03,0x07,0xff,0x04,0x01,0x03,0xff,0x04,0x01,0x05,0xff,0x17,0x1a,0x1c,0xff,0x71,0x75,0x7c,0xff,0x37,0x3c,0x45,0xff,0x5a,0x64,0x67,0xff,0xc7,0xd6,0xd7,0xff,0x3a,0x32,0x2b,0xff,0x25,0x13,0x04,0xff,0x28,0x17,0x0b,0xff,0x27,0x17,0x07,0xff,0x27,0x18,0x08,0xff,0x26,0x19,0x09,0xff,0x25,0x18,0x08,0xff,0x27,0x17,0x07,0xff,0x26,0x18,0x07,0xff,0x25,0x16,0x06,0xff,0x24,0x17,0x07,0xff,0x23,0x17,0x07,0xff,0x23,0x16,0x06,0xff,0x23,0x16,0x06,0xff,0x23,0x16,0x07,0xff,0x23,0x16,0x07,0xff,0x23,0x16,0x06,0xff,0x22,0x16,0x06,0xff,0x22,0x16,0x06,0xff,0x23,0x16,0x06,0xff,0x22,0x15,0x05,0xff,0x23,0x16,0x06,0xff,0x23,0x16,0x06,0xff,0x25,0x18,0x05,0xff,0x25,0x18,0x03,0xff,0x27,0x19,0x01,0xff,0x28,0x1b,0x01,0xff,0x2a,0x1b,0x01,0xff,0x2a,0x1c,0x01,0xff,0x2c,0x1c,0x00,0xff,0x2e,0x1d,0x02,0xff,0x2d,0x1c,0x01,0xff,0x2d,0x1c,0x01,0xff,0x2d,0x1c,0x01,0xff,0x2d,0x1c,0x01,0xff,0x2e,0x1c,0x01,0xff,0x25,0x13,0x00,0xff,0x61,0x54,0x3f,0xc3,0xf7,0xf6,0xf5,0x00,0xff,0xff,0xff,0x00,0xfe,0xf0,0xf6,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xef,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfa,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xf9,0xfc,0x00,0xff,0xff,0xff,0x15,0xe0,0xcc,0xc3,0xe2,0x8c,0x45,0x2b,0xff,0x91,0x49,0x39,0xff,0xa1,0x88,0x81,0xff,0xe8,0xf4,0xf1,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xff,0xff,0xff,0xa8,0xa8,0xa2,0xff,0x84,0x57,0x45,0xff,0x7b,0x49,0x26,0xff,0x75,0x41,0x14,0xff,0x6e,0x39,0x05,0xff,0x6b,0x37,0x02,0xff,0x6a,0x36,0x01,0xff,0x68,0x34,0x01,0xff,0x68,0x33,0x02,0xff,0x62,0x32,0x01,0xff,0x80,0x3d,0x01,0xff,0xd3,0x58,0x02,0xff,0xbd,0x4f,0x01,0xff,0xa5,0x4a,0x01,0xff,0xab,0x53,0x03,0xff,0x8c,0x40,0x02,0xff,0x75,0x36,0x02,0xff,0xa2,0x56,0x01,0xff,0xcf,0x73,0x03,0xff,0xa3,0x5c,0x05,0xff,0x21,0x11,0x03,0xff,0x07,0x03,0x02,0xff,0x08,0x04,0x01,0xff,0x0f,0x07,0x00,0xff,0x1b,0x0d,0x01,0xff,0x15,0x09,0x00,0xff,0x0d,0x07,0x01,0xff,0x0c,0x06,0x01,0xff,0x10,0x09,0x00,0xff,0x0f,0x07,0x00,0xff,0x0f,0x07,0x00,0xff,0x0f,0x09,0x00,0xff,0x12,0x0a,0x00,0xff,0x10,0x08,0x01,0xff,0x11,0x0a,0x03,0xff,0x0e,0x07,0x01,0xff,0x0a,0x06,0x02,0xff,0x0b,0x07,0x02,0xff,0x0a,0x05,0x01,0xff,0x09,0x05,0x00,0xff,0x09,0x04,0x00,0xff,0x0a,0x05,0x01,0xff,0x0b,0x06,0x01,0xff,0x0e,0x07,0x02,0xff,0x0f,0x09,0x02,0xff,0x0c,0x06,0x02,0xff,0x09,0x05,0x01,0xff,0x0a,0x06,0x01,0xff,0x0a,0x06,0x01,0xff,0x09,0x05,0x01,0xff,0x09,0x06,0x00,0xff,0x08,0x05,0x01,0xff,0x07,0x05,0x01,0xff,0x08,0x05,0x02,0xff,0x07,0x04,0x01,0xff,0x08,0x04,0x01,0xff,0x08,0x05,0x01,0xff,0x09,0x07,0x01,0xff,0x08,0x05,0x04,0xff,0x0b,0x07,0x02,0xff,0x11,0x0f,0x03,0xff,0x0b,0x0a,0x02,0xff,0x09,0x08,0x02,0xff,0x09,0x07,0x02,0xff,0x08,0x06,0x02,0xff,0x09,0x07,0x01,0xff,0x07,0x05,0x00,0xff,0x01,0x00,0x00,0xff,0x3f,0x55,0x69,0xff,0x50,0x68,0x79,0xff,0x06,0x04,0x1f,0xff,0x1b,0x21,0x9a,0xff,0x29,0x49,0xe8,0xff,0x35,0x56,0xba,0xff,0x46,0x52,0x55,0xff,0x47,0x53,0x56,0xff,0x43,0x4a,0x51,0xff,0x04,0x05,0x08,0xff,0x0a,0x04,0x06,0xff,0x0d,0x08,0x08,0xff,0x2c,0x28,0x2e,0xff,0x25,0x2a,0x31,0xff,0x60,0x6d,0x6f,0xff,0x61,0x5d,0x58,0xff,0x20,0x0d,0x00,0xff,0x28,0x18,0x09,0xff,0x27,0x18,0x08,0xff,0x27,0x18,0x08,0xff,0x25,0x18,0x08,0xff,0x24,0x17,0x08,0xff,0x25,0x17,0x08,0xff,0x24,0x17,0x08,0xff,0x24,0x16,0x08,0xff,0x23,0x17,0x06,0xff,0x23,0x17,0x07,0xff,0x23,0x17,0x07,0xff,0x24,0x17,0x08,0xff,0x23,0x16,0x06,0xff,0x22,0x15,0x06,0xff,0x22,0x15,0x06,0xff,0x23,0x16,0x06,0xff,0x22,0x15,0x05,0xff,0x22,0x15,0x05,0xff,0x21,0x15,0x05,0xff,0x23,0x16,0x06,0xff,0x23,0x16,0x06,0xff,0x24,0x17,0x04,0xff,0x24,0x17,0x02,0xff,0x26,0x19,0x01,0xff,0x28,0x1b,0x01,0xff,0x2a,0x1b,0x02,0xff,0x2b,0x1c,0x01,0xff,0x2c,0x1c,0x01,0xff,0x2d,0x1c,0x01,0xff,0x2d,0x1c,0x01,0xff,0x2d,0x1d,0x01,0xff,0x2d,0x1d,0x01,0xff,0x2e,0x1c,0x01,0xff,0x2d,0x1b,0x00,0xff,0x2a,0x19,0x00,0xff,0xb1,0xab,0xa1,0x5e,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfe,0xf0,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf0,0xf6,0x00,0xff,0xff,0xff,0x00,0xfe,0xfe,0xfd,0x81,0xac,0x79,0x64,0xff,0x8b,0x40,0x27,0xff,0x98,0x5b,0x51,0xff,0xb2,0xae,0xa6,0xff,0xf4,0xfd,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf2,0xfa,0xfa,0xff,0xb7,0xb6,0xb3,0xff,0x8c,0x68,0x53,0xff,0x87,0x52,0x3b,0xff,0x77,0x43,0x21,0xff,0x73,0x3e,0x0f,0xff,0x6f,0x39,0x03,0xff,0x6c,0x37,0x02,0xff,0x6c,0x38,0x02,0xff,0x6a,0x35,0x01,0xff,0x69,0x34,0x01,0xff,0x65,0x34,0x02,0xff,0x6b,0x34,0x01,0xff,0xc1,0x52,0x02,0xff,0xca,0x53,0x01,0xff,0xaf,0x4b,0x01,0xff,0x9c,0x45,0x02,0xff,0x9f,0x4f,0x04,0xff,0xc5,0x67,0x03,0xff,0xdf,0x78,0x04,0xff,0xa2,0x5a,0x05,0xff,0x27,0x15,0x03,0xff,0x05,0x01,0x02,0xff,0x0d,0x07,0x02,0xff,0x0a,0x04,0x00,0xff,0x12,0x08,0x01,0xff,0x1e,0x0f,0x01,0xff,0x1a,0x0c,0x01,0xff,0x0e,0x07,0x01,0xff,0x0d,0x07,0x02,0xff,0x11,0x09,0x01,0xff,0x10,0x08,0x00,0xff,0x11,0x0a,0x00,0xff,0x10,0x07,0x01,0xff,0x0f,0x08,0x02,0xff,0x12,0x09,0x01,0xff,0x0f,0x06,0x01,0xff,0x0e,0x08,0x02,0xff,0x0b,0x06,0x01,0xff,0x0a,0x05,0x01,0xff,0x0a,0x05,0x01,0xff,0x0a,0x05,0x01,0xff,0x0a,0x06,0x01,0xff,0x09,0x05,0x02,0xff,0x0d,0x07,0x01,0xff,0x11,0x09,0x01,0xff,0x10,0x09,0x01,0xff,0x0e,0x09,0x02,0xff,0x09,0x05,0x01,0xff,0x08,0x06,0x01,0xff,0x0a,0x06,0x01,0xff,0x0a,0x06,0x01,0xff,0x09,0x06,0x00,0xff,0x08,0x05,0x01,0xff,0x08,0x05,0x02,0xff,0x08,0x05,0x02,0xff,0x07,0x05,0x01,0xff,0x08,0x05,0x02,0xff,0x08,0x05,0x02,0xff,0x08,0x05,0x02,0xff,0x07,0x04,0x01,0xff,0x09,0x06,0x02,0xff,0x0e,0x0b,0x03,0xff,0x0f,0x0c,0x03,0xff,0x0a,0x08,0x02,0xff,0x0a,0x07,0x02,0xff,0x08,0x06,0x03,0xff,0x08,0x06,0x03,0xff,0x07,0x06,0x02,0xff,0x06,0x04,0x01,0xff,0x0a,0x0a,0x0b,0xff,0x53,0x6c,0x86,0xff,0x3d,0x4f,0x5f,0xff,0x09,0x07,0x3a,0xff,0x16,0x24,0xb6,0xff,0x12,0x26,0x9f,0xff,0x50,0x60,0x65,0xff,0x9b,0xb8,0xb7,0xff,0x8b,0xab,0xeb,0xff,0x3b,0x59,0x94,0xff,0x15,0x14,0x14,0xff,0x02,0x00,0x00,0xff,0x09,0x03,0x01,0xff,0x2c,0x28,0x2b,0xff,0x2c,0x2d,0x30,0xff,0x20,0x19,0x11,0xff,0x2b,0x1a,0x08,0xff,0x27,0x18,0x09,0xff,0x26,0x18,0x09,0xff,0x26,0x17,0x08,0xff,0x26,0x18,0x08,0xff,0x24,0x17,0x08,0xff,0x23,0x16,0x08,0xff,0x22,0x16,0x07,0xff,0x23,0x16,0x07,0xff,0x23,0x16,0x05,0xff,0x23,0x17,0x07,0xff,0x23,0x16,0x06,0xff,0x23,0x16,0x06,0xff,0x22,0x16,0x06,0xff,0x23,0x16,0x05,0xff,0x22,0x15,0x06,0xff,0x22,0x16,0x07,0xff,0x22,0x15,0x06,0xff,0x22,0x16,0x06,0xff,0x21,0x15,0x05,0xff,0x21,0x15,0x05,0xff,0x22,0x17,0x05,0xff,0x24,0x17,0x03,0xff,0x26,0x18,0x04,0xff,0x27,0x1a,0x02,0xff,0x29,0x1b,0x01,0xff,0x2a,0x1c,0x02,0xff,0x2b,0x1d,0x01,0xff,0x2c,0x1c,0x01,0xff,0x2c,0x1c,0x01,0xff,0x2d,0x1c,0x01,0xff,0x2d,0x1c,0x01,0xff,0x2d,0x1d,0x01,0xff,0x2d,0x1c,0x01,0xff,0x27,0x14,0x00,0xff,0x57,0x49,0x34,0xd3,0xf2,0xf2,0xf0,0x0c,0xff,0xff,0xff,0x00,0xfe,0xf3,0xf8,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfe,0xf0,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x1e,0xdb,0xc4,0xb9,0xe8,0x8e,0x43,0x22,0xff,0x95,0x4e,0x34,0xff,0x9e,0x6c,0x5b,0xff,0xb8,0xb5,0xa7,0xff,0xd1,0xd2,0xc5,0xff,0xc2,0xbe,0xb1,0xff,0xa4,0x91,0x83,0xff,0x92,0x66,0x50,0xff,0x88,0x4d,0x2f,0xff,0x7e,0x45,0x23,0xff,0x7a,0x41,0x1a,0xff,0x74,0x3c,0x0b,0xff,0x70,0x38,0x03,0xff,0x6f,0x36,0x02,0xff,0x6d,0x37,0x02,0xff,0x6d,0x36,0x01,0xff,0x6a,0x35,0x01,0xff,0x69,0x35,0x01,0xff,0x63,0x31,0x02,0xff,0x99,0x45,0x02,0xff,0xd1,0x52,0x03,0xff,0xb1,0x4a,0x01,0xff,0xb3,0x52,0x03,0xff,0xbc,0x61,0x07,0xff,0x8c,0x48,0x05,0xff,0x5a,0x2d,0x05,0xff,0x14,0x08,0x02,0xff,0x05,0x00,0x01,0xff,0x0b,0x04,0x01,0xff,0x0e,0x07,0x01,0xff,0x0b,0x06,0x00,0xff,0x17,0x0a,0x01,0xff,0x1f,0x0e,0x01,0xff,0x20,0x10,0x01,0xff,0x13,0x09,0x02,0xff,0x0f,0x07,0x01,0xff,0x12,0x0a,0x01,0xff,0x0f,0x08,0x01,0xff,0x11,0x08,0x01,0xff,0x0e,0x07,0x01,0xff,0x0e,0x06,0x02,0xff,0x13,0x09,0x02,0xff,0x0f,0x0a,0x02,0xff,0x0c,0x06,0x01,0xff,0x0a,0x06,0x01,0xff,0x09,0x05,0x01,0xff,0x0a,0x06,0x01,0xff,0x09,0x05,0x01,0xff,0x09,0x04,0x01,0xff,0x0b,0x06,0x01,0xff,0x11,0x0a,0x01,0xff,0x12,0x09,0x01,0xff,0x10,0x08,0x01,0xff,0x0d,0x07,0x01,0xff,0x08,0x04,0x00,0xff,0x08,0x05,0x02,0xff,0x0b,0x06,0x01,0xff,0x0a,0x06,0x00,0xff,0x0a,0x06,0x01,0xff,0x08,0x05,0x01,0xff,0x08,0x05,0x01,0xff,0x08,0x05,0x01,0xff,0x08,0x05,0x02,0xff,0x08,0x05,0x01,0xff,0x07,0x04,0x00,0xff,0x08,0x05,0x01,0xff,0x08,0x05,0x02,0xff,0x08,0x06,0x02,0xff,0x0a,0x07,0x02,0xff,0x0e,0x0a,0x04,0xff,0x0c,0x09,0x03,0xff,0x0a,0x07,0x04,0xff,0x09,0x06,0x03,0xff,0x09,0x06,0x02,0xff,0x09,0x06,0x02,0xff,0x07,0x06,0x03,0xff,0x05,0x01,0x00,0xff,0x19,0x1f,0x27,0xff,0x7d,0xa4,0xbf,0xff,0x34,0x3f,0x51,0xff,0x0c,0x0d,0x57,0xff,0x1b,0x22,0x8a,0xff,0x12,0x18,0x22,0xff,0x9a,0xb0,0xaf,0xff,0x74,0x91,0xe6,0xff,0x3a,0x5b,0xd0,0xff,0x87,0x94,0x9c,0xff,0x59,0x5f,0x5e,0xff,0x07,0x07,0x07,0xff,0x0d,0x0c,0x0a,0xff,0x1e,0x19,0x15,0xff,0x2e,0x24,0x18,0xff,0x27,0x19,0x07,0xff,0x27,0x17,0x07,0xff,0x25,0x16,0x08,0xff,0x25,0x17,0x07,0xff,0x25,0x17,0x07,0xff,0x23,0x16,0x06,0xff,0x23,0x16,0x06,0xff,0x23,0x16,0x06,0xff,0x24,0x17,0x07,0xff,0x24,0x15,0x06,0xff,0x22,0x15,0x05,0xff,0x22,0x16,0x04,0xff,0x22,0x16,0x06,0xff,0x23,0x16,0x06,0xff,0x23,0x16,0x06,0xff,0x21,0x14,0x05,0xff,0x22,0x15,0x06,0xff,0x22,0x16,0x06,0xff,0x21,0x14,0x05,0xff,0x21,0x14,0x05,0xff,0x21,0x15,0x05,0xff,0x22,0x16,0x05,0xff,0x24,0x17,0x05,0xff,0x27,0x19,0x04,0xff,0x28,0x19,0x02,0xff,0x2a,0x1b,0x01,0xff,0x2b,0x1d,0x02,0xff,0x2a,0x1b,0x00,0xff,0x2d,0x1d,0x01,0xff,0x2d,0x1c,0x02,0xff,0x2c,0x1b,0x01,0xff,0x2d,0x1c,0x01,0xff,0x2d,0x1c,0x00,0xff,0x2b,0x1a,0x00,0xff,0x28,0x16,0x00,0xff,0xa7,0xa0,0x95,0x6a,0xff,0xff,0xff,0x00,0xff,0xfd,0xff,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf1,0xf7,0x00,0xff,0xff,0xff,0x00,0xfc,0xfb,0xfa,0x86,0xaf,0x78,0x5b,0xff,0x8d,0x42,0x16,0xff,0x9d,0x57,0x2f,0xff,0x9d,0x5d,0x38,0xff,0x9b,0x62,0x3c,0xff,0x98,0x5c,0x37,0xff,0x97,0x5a,0x36,0xff,0x90,0x4e,0x2c,0xff,0x83,0x44,0x21,0xff,0x79,0x3e,0x12,0xff,0x76,0x3b,0x0a,0xff,0x72,0x39,0x06,0xff,0x70,0x37,0x03,0xff,0x6f,0x36,0x02,0xff,0x6c,0x36,0x01,0xff,0x6b,0x34,0x01,0xff,0x6a,0x35,0x01,0xff,0x69,0x33,0x01,0xff,0x63,0x30,0x02,0xff,0x6c,0x32,0x01,0xff,0xc2,0x50,0x01,0xff,0xf1,0x73,0x02,0xff,0xd9,0x6c,0x05,0xff,0x75,0x39,0x07,0xff,0x13,0x07,0x04,0xff,0x02,0x00,0x02,0xff,0x0c,0x04,0x03,0xff,0x0e,0x06,0x02,0xff,0x0b,0x04,0x01,0xff,0x0c,0x05,0x00,0xff,0x0b,0x07,0x00,0xff,0x16,0x09,0x02,0xff,0x1d,0x0c,0x01,0xff,0x23,0x11,0x01,0xff,0x1c,0x0c,0x00,0xff,0x12,0x08,0x02,0xff,0x11,0x0a,0x02,0xff,0x0f,0x07,0x01,0xff,0x0f,0x08,0x01,0xff,0x12,0x09,0x01,0xff,0x17,0x0d,0x02,0xff,0x2b,0x1d,0x08,0xff,0x1a,0x10,0x04,0xff,0x0a,0x05,0x00,0xff,0x0c,0x06,0x01,0xff,0x0a,0x05,0x01,0xff,0x0a,0x04,0x02,0xff,0x0b,0x05,0x01,0xff,0x0e,0x06,0x01,0xff,0x12,0x0b,0x01,0xff,0x10,0x0a,0x02,0xff,0x0b,0x06,0x01,0xff,0x0c,0x06,0x01,0xff,0x0c,0x06,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x05,0x01,0xff,0x0a,0x06,0x01,0xff,0x0a,0x06,0x00,0xff,0x0a,0x06,0x01,0xff,0x0a,0x06,0x01,0xff,0x0a,0x06,0x01,0xff,0x09,0x06,0x01,0xff,0x08,0x05,0x01,0xff,0x07,0x05,0x01,0xff,0x08,0x05,0x02,0xff,0x09,0x06,0x03,0xff,0x09,0x07,0x03,0xff,0x08,0x05,0x02,0xff,0x07,0x05,0x02,0xff,0x09,0x07,0x02,0xff,0x0b,0x08,0x03,0xff,0x09,0x06,0x02,0xff,0x08,0x06,0x03,0xff,0x09,0x06,0x02,0xff,0x0a,0x06,0x02,0xff,0x09,0x06,0x03,0xff,0x05,0x04,0x03,0xff,0x05,0x00,0x00,0xff,0x38,0x4c,0x62,0xff,0x82,0xab,0xd3,0xff,0x27,0x30,0x43,0xff,0x1a,0x16,0x4d,0xff,0x00,0x00,0x0d,0xff,0x6d,0x7a,0x78,0xff,0x74,0x8d,0xd6,0xff,0x28,0x3b,0xc5,0xff,0x49,0x5a,0x92,0xff,0xc6,0xd8,0xd5,0xff,0x9f,0xb5,0xba,0xff,0xa4,0xb2,0xb3,0xff,0x34,0x2d,0x28,0xff,0x26,0x16,0x08,0xff,0x25,0x17,0x07,0xff,0x26,0x17,0x07,0xff,0x25,0x16,0x07,0xff,0x24,0x15,0x05,0xff,0x24,0x16,0x06,0xff,0x22,0x15,0x06,0xff,0x23,0x17,0x06,0xff,0x23,0x16,0x06,0xff,0x23,0x17,0x07,0xff,0x25,0x15,0x06,0xff,0x22,0x15,0x05,0xff,0x22,0x16,0x04,0xff,0x23,0x16,0x06,0xff,0x22,0x16,0x05,0xff,0x22,0x15,0x05,0xff,0x22,0x15,0x05,0xff,0x22,0x16,0x06,0xff,0x22,0x15,0x05,0xff,0x22,0x15,0x05,0xff,0x22,0x15,0x05,0xff,0x22,0x15,0x05,0xff,0x22,0x16,0x04,0xff,0x23,0x17,0x03,0xff,0x25,0x17,0x03,0xff,0x28,0x18,0x02,0xff,0x2a,0x1a,0x01,0xff,0x2a,0x1b,0x01,0xff,0x2a,0x1b,0x01,0xff,0x2c,0x1c,0x01,0xff,0x2d,0x1d,0x02,0xff,0x2c,0x1b,0x01,0xff,0x2d,0x1c,0x01,0xff,0x2d,0x1c,0x01,0xff,0x25,0x14,0x00,0xff,0x55,0x48,0x32,0xd7,0xef,0xef,0xec,0x0d,0xff,0xff,0xff,0x00,0xfe,0xf4,0xf9,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfb,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x1c,0xe1,0xcd,0xc1,0xe5,0x94,0x49,0x16,0xff,0x96,0x4b,0x12,0xff,0x9b,0x50,0x1b,0xff,0x9c,0x53,0x20,0xff,0x94,0x4e,0x1c,0xff,0x8f,0x4b,0x1d,0xff,0x88,0x45,0x19,0xff,0x7f,0x3d,0x0d,0xff,0x76,0x39,0x07,0xff,0x73,0x38,0x05,0xff,0x72,0x36,0x04,0xff,0x71,0x35,0x01,0xff,0x6e,0x36,0x01,0xff,0x6a,0x34,0x01,0xff,0x6a,0x33,0x01,0xff,0x6b,0x33,0x01,0xff,0x69,0x33,0x01,0xff,0x69,0x33,0x01,0xff,0x5e,0x2c,0x00,0xff,0xc1,0x5f,0x05,0xff,0xf4,0x81,0x07,0xff,0x66,0x2d,0x04,0xff,0x09,0x02,0x01,0xff,0x0a,0x04,0x03,0xff,0x0d,0x04,0x03,0xff,0x0b,0x04,0x01,0xff,0x0c,0x04,0x01,0xff,0x0b,0x04,0x01,0xff,0x0a,0x04,0x02,0xff,0x08,0x05,0x01,0xff,0x14,0x09,0x00,0xff,0x21,0x10,0x01,0xff,0x23,0x10,0x01,0xff,0x20,0x0e,0x01,0xff,0x13,0x09,0x03,0xff,0x15,0x0a,0x02,0xff,0x16,0x0c,0x03,0xff,0x13,0x0b,0x03,0xff,0x14,0x0a,0x02,0xff,0x12,0x09,0x03,0xff,0x11,0x09,0x02,0xff,0x0c,0x06,0x01,0xff,0x0f,0x08,0x01,0xff,0x0d,0x07,0x00,0xff,0x0b,0x05,0x00,0xff,0x0b,0x05,0x01,0xff,0x10,0x08,0x00,0xff,0x13,0x0b,0x01,0xff,0x0e,0x08,0x01,0xff,0x07,0x04,0x01,0xff,0x06,0x03,0x01,0xff,0x0b,0x06,0x01,0xff,0x0d,0x08,0x02,0xff,0x0a,0x06,0x02,0xff,0x0a,0x06,0x01,0xff,0x0b,0x06,0x00,0xff,0x0b,0x06,0x01,0xff,0x0b,0x06,0x01,0xff,0x0b,0x06,0x01,0xff,0x0b,0x07,0x02,0xff,0x0a,0x06,0x01,0xff,0x09,0x05,0x02,0xff,0x08,0x05,0x02,0xff,0x08,0x06,0x02,0xff,0x08,0x06,0x01,0xff,0x08,0x05,0x01,0xff,0x08,0x05,0x01,0xff,0x06,0x04,0x02,0xff,0x07,0x05,0x02,0xff,0x0a,0x08,0x03,0xff,0x09,0x06,0x03,0xff,0x08,0x06,0x02,0xff,0x08,0x05,0x02,0xff,0x08,0x05,0x02,0xff,0x08,0x05,0x03,0xff,0x05,0x05,0x02,0xff,0x06,0x04,0x01,0xff,0x12,0x15,0x19,0xff,0x61,0x82,0xa7,0xff,0x6f,0x96,0xc1,0xff,0x1a,0x1d,0x2d,0xff,0x04,0x03,0x09,0xff,0x3c,0x44,0x54,0xff,0x55,0x63,0xbb,0xff,0x2d,0x39,0xaa,0xff,0x1c,0x21,0x72,0xff,0x6c,0x7d,0x87,0xff,0xfa,0xff,0xff,0xff,0xb9,0xc0,0xc0,0xff,0x1c,0x13,0x0b,0xff,0x26,0x14,0x05,0xff,0x26,0x17,0x08,0xff,0x25,0x16,0x08,0xff,0x25,0x16,0x07,0xff,0x25,0x16,0x06,0xff,0x24,0x16,0x06,0xff,0x23,0x16,0x06,0xff,0x23,0x16,0x06,0xff,0x23,0x16,0x06,0xff,0x23,0x15,0x06,0xff,0x24,0x15,0x06,0xff,0x22,0x15,0x05,0xff,0x21,0x15,0x03,0xff,0x22,0x16,0x05,0xff,0x22,0x15,0x05,0xff,0x21,0x15,0x05,0xff,0x22,0x15,0x05,0xff,0x22,0x15,0x05,0xff,0x21,0x15,0x06,0xff,0x22,0x14,0x06,0xff,0x21,0x14,0x05,0xff,0x21,0x14,0x04,0xff,0x22,0x16,0x04,0xff,0x23,0x16,0x02,0xff,0x24,0x17,0x01,0xff,0x27,0x18,0x02,0xff,0x29,0x19,0x02,0xff,0x29,0x1a,0x01,0xff,0x2a,0x1b,0x01,0xff,0x2c,0x1b,0x00,0xff,0x2c,0x1b,0x01,0xff,0x2c,0x1b,0x01,0xff,0x2d,0x1c,0x01,0xff,0x2a,0x19,0x00,0xff,0x2a,0x1a,0x00,0xff,0xb1,0xab,0xa0,0x66,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xfe,0xea,0xf2,0x00,0xfd,0xe7,0xef,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfb,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf0,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x79,0xb7,0x87,0x62,0xff,0x8b,0x3d,0x00,0xff,0x92,0x47,0x0a,0xff,0x92,0x48,0x0d,0xff,0x8d,0x45,0x0b,0xff,0x8a,0x42,0x0e,0xff,0x82,0x3c,0x09,0xff,0x79,0x38,0x04,0xff,0x76,0x36,0x03,0xff,0x73,0x36,0x03,0xff,0x70,0x35,0x02,0xff,0x6e,0x33,0x01,0xff,0x6e,0x34,0x01,0xff,0x6c,0x34,0x01,0xff,0x6b,0x34,0x01,0xff,0x6b,0x35,0x02,0xff,0x6a,0x33,0x01,0xff,0x66,0x31,0x01,0xff,0x6a,0x31,0x01,0xff,0xb7,0x57,0x04,0xff,0x92,0x48,0x05,0xff,0x4e,0x22,0x04,0xff,0x0f,0x05,0x02,0xff,0x0a,0x04,0x01,0xff,0x0c,0x04,0x01,0xff,0x0b,0x04,0x01,0xff,0x0d,0x05,0x01,0xff,0x0c,0x05,0x01,0xff,0x0b,0x05,0x01,0xff,0x0b,0x06,0x02,0xff,0x13,0x0a,0x02,0xff,0x21,0x10,0x02,0xff,0x22,0x0f,0x02,0xff,0x22,0x0f,0x02,0xff,0x32,0x1d,0x07,0xff,0x2c,0x19,0x05,0xff,0x13,0x08,0x02,0xff,0x0d,0x05,0x01,0xff,0x0a,0x05,0x00,0xff,0x0c,0x06,0x00,0xff,0x0e,0x07,0x01,0xff,0x10,0x08,0x01,0xff,0x11,0x08,0x01,0xff,0x0f,0x08,0x01,0xff,0x0b,0x06,0x00,0xff,0x0e,0x08,0x01,0xff,0x0e,0x08,0x00,0xff,0x0a,0x06,0x01,0xff,0x05,0x03,0x00,0xff,0x06,0x03,0x01,0xff,0x0b,0x07,0x01,0xff,0x0d,0x08,0x01,0xff,0x0e,0x08,0x01,0xff,0x0b,0x06,0x01,0xff,0x09,0x05,0x02,0xff,0x0c,0x07,0x01,0xff,0x0c,0x07,0x02,0xff,0x0b,0x07,0x01,0xff,0x0c,0x07,0x01,0xff,0x0b,0x07,0x02,0xff,0x0a,0x05,0x01,0xff,0x09,0x04,0x01,0xff,0x07,0x04,0x01,0xff,0x07,0x04,0x01,0xff,0x08,0x05,0x01,0xff,0x09,0x07,0x02,0xff,0x08,0x06,0x02,0xff,0x07,0x04,0x02,0xff,0x07,0x03,0x02,0xff,0x08,0x05,0x03,0xff,0x0a,0x06,0x05,0xff,0x09,0x06,0x02,0xff,0x09,0x06,0x02,0xff,0x08,0x05,0x02,0xff,0x09,0x06,0x03,0xff,0x08,0x06,0x03,0xff,0x05,0x04,0x02,0xff,0x05,0x02,0x00,0xff,0x19,0x21,0x2c,0xff,0x6c,0x9c,0xcb,0xff,0x3f,0x58,0x70,0xff,0x01,0x00,0x00,0xff,0x13,0x16,0x3a,0xff,0x2d,0x2f,0x89,0xff,0x23,0x26,0x6d,0xff,0x1d,0x1d,0x4f,0xff,0x18,0x20,0x2a,0xff,0x85,0x94,0x94,0xff,0x50,0x53,0x51,0xff,0x20,0x11,0x04,0xff,0x27,0x17,0x07,0xff,0x25,0x16,0x06,0xff,0x24,0x16,0x07,0xff,0x25,0x16,0x06,0xff,0x25,0x16,0x07,0xff,0x24,0x15,0x05,0xff,0x24,0x15,0x06,0xff,0x24,0x15,0x05,0xff,0x25,0x16,0x06,0xff,0x24,0x16,0x06,0xff,0x22,0x15,0x05,0xff,0x22,0x15,0x06,0xff,0x21,0x15,0x05,0xff,0x22,0x16,0x05,0xff,0x22,0x15,0x05,0xff,0x22,0x15,0x06,0xff,0x21,0x15,0x05,0xff,0x21,0x14,0x05,0xff,0x21,0x14,0x06,0xff,0x21,0x14,0x06,0xff,0x20,0x13,0x04,0xff,0x20,0x14,0x04,0xff,0x23,0x15,0x04,0xff,0x25,0x16,0x03,0xff,0x26,0x16,0x01,0xff,0x2a,0x19,0x01,0xff,0x2c,0x1a,0x01,0xff,0x2d,0x1a,0x01,0xff,0x2e,0x1b,0x01,0xff,0x2f,0x1c,0x01,0xff,0x2f,0x1c,0x01,0xff,0x2d,0x1b,0x01,0xff,0x2d,0x1c,0x00,0xff,0x24,0x12,0x00,0xff,0x63,0x56,0x44,0xcc,0xf6,0xf5,0xf4,0x09,0xff,0xff,0xff,0x00,0xfe,0xf3,0xf8,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfc,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xff,0xf9,0xfb,0x00,0xff,0xff,0xff,0x0e,0xe8,0xd9,0xcd,0xd4,0x95,0x4f,0x17,0xff,0x8c,0x3d,0x00,0xff,0x8c,0x3f,0x04,0xff,0x88,0x3c,0x04,0xff,0x84,0x3a,0x06,0xff,0x7c,0x36,0x03,0xff,0x74,0x33,0x03,0xff,0x71,0x33,0x02,0xff,0x71,0x33,0x01,0xff,0x6f,0x33,0x01,0xff,0x6f,0x33,0x01,0xff,0x6d,0x33,0x02,0xff,0x6c,0x32,0x01,0xff,0x6b,0x33,0x01,0xff,0x6a,0x33,0x01,0xff,0x6b,0x33,0x01,0xff,0x68,0x31,0x01,0xff,0x6c,0x33,0x01,0xff,0x7b,0x39,0x03,0xff,0x5f,0x2d,0x02,0xff,0x70,0x34,0x05,0xff,0x3e,0x17,0x05,0xff,0x10,0x04,0x01,0xff,0x07,0x04,0x02,0xff,0x0c,0x05,0x00,0xff,0x0c,0x05,0x00,0xff,0x0c,0x05,0x00,0xff,0x0c,0x06,0x01,0xff,0x0d,0x06,0x01,0xff,0x20,0x0d,0x01,0xff,0x2d,0x14,0x03,0xff,0x26,0x0f,0x03,0xff,0x28,0x10,0x02,0xff,0x1d,0x0c,0x03,0xff,0x10,0x07,0x02,0xff,0x0f,0x07,0x03,0xff,0x11,0x07,0x01,0xff,0x10,0x07,0x00,0xff,0x0f,0x06,0x00,0xff,0x10,0x08,0x00,0xff,0x10,0x08,0x01,0xff,0x10,0x08,0x01,0xff,0x11,0x08,0x01,0xff,0x0e,0x07,0x02,0xff,0x0b,0x07,0x01,0xff,0x06,0x04,0x01,0xff,0x03,0x03,0x01,0xff,0x03,0x02,0x00,0xff,0x0d,0x07,0x01,0xff,0x11,0x0a,0x01,0xff,0x0e,0x09,0x01,0xff,0x0d,0x08,0x02,0xff,0x0b,0x06,0x02,0xff,0x0a,0x06,0x02,0xff,0x0b,0x07,0x01,0xff,0x0b,0x06,0x01,0xff,0x0a,0x06,0x01,0xff,0x0b,0x06,0x00,0xff,0x09,0x05,0x01,0xff,0x07,0x04,0x00,0xff,0x08,0x05,0x00,0xff,0x07,0x05,0x01,0xff,0x06,0x04,0x01,0xff,0x09,0x06,0x00,0xff,0x0c,0x08,0x02,0xff,0x09,0x06,0x01,0xff,0x07,0x05,0x02,0xff,0x06,0x03,0x01,0xff,0x06,0x03,0x02,0xff,0x08,0x05,0x03,0xff,0x09,0x06,0x02,0xff,0x08,0x06,0x01,0xff,0x08,0x05,0x02,0xff,0x09,0x06,0x02,0xff,0x08,0x05,0x03,0xff,0x06,0x04,0x03,0xff,0x06,0x03,0x00,0xff,0x04,0x04,0x02,0xff,0x2c,0x3e,0x52,0xff,0x5d,0x78,0x9a,0xff,0x24,0x2e,0x3b,0xff,0x11,0x11,0x1e,0xff,0x0e,0x11,0x2b,0xff,0x2b,0x31,0x49,0xff,0x0b,0x0d,0x16,0xff,0x16,0x19,0x19,0xff,0x19,0x1a,0x1b,0xff,0x29,0x23,0x20,0xff,0x2b,0x1c,0x0e,0xff,0x23,0x15,0x06,0xff,0x24,0x15,0x06,0xff,0x24,0x15,0x05,0xff,0x24,0x15,0x05,0xff,0x23,0x14,0x05,0xff,0x24,0x15,0x06,0xff,0x23,0x15,0x06,0xff,0x23,0x15,0x06,0xff,0x22,0x14,0x04,0xff,0x23,0x15,0x05,0xff,0x20,0x14,0x04,0xff,0x21,0x14,0x04,0xff,0x21,0x15,0x04,0xff,0x22,0x16,0x05,0xff,0x22,0x16,0x06,0xff,0x21,0x14,0x05,0xff,0x20,0x13,0x04,0xff,0x21,0x14,0x05,0xff,0x21,0x13,0x04,0xff,0x22,0x13,0x05,0xff,0x22,0x14,0x04,0xff,0x25,0x16,0x03,0xff,0x28,0x17,0x02,0xff,0x2d,0x18,0x01,0xff,0x2c,0x17,0x01,0xff,0x2d,0x18,0x02,0xff,0x2e,0x19,0x00,0xff,0x31,0x1a,0x01,0xff,0x32,0x1c,0x01,0xff,0x32,0x1d,0x01,0xff,0x31,0x1d,0x01,0xff,0x31,0x1d,0x01,0xff,0x2c,0x1a,0x00,0xff,0x33,0x21,0x08,0xff,0xc1,0xbb,0xb4,0x50,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xf9,0xfc,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xee,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x59,0xc6,0x9f,0x83,0xff,0x86,0x34,0x00,0xff,0x87,0x39,0x01,0xff,0x81,0x36,0x01,0xff,0x7d,0x32,0x02,0xff,0x78,0x32,0x02,0xff,0x70,0x2e,0x01,0xff,0x70,0x30,0x02,0xff,0x70,0x31,0x02,0xff,0x6f,0x32,0x02,0xff,0x70,0x33,0x01,0xff,0x6d,0x31,0x00,0xff,0x6b,0x31,0x02,0xff,0x6a,0x31,0x02,0xff,0x6a,0x32,0x01,0xff,0x6b,0x32,0x01,0xff,0x6a,0x32,0x02,0xff,0x69,0x32,0x01,0xff,0x67,0x30,0x01,0xff,0x6a,0x32,0x01,0xff,0x66,0x2c,0x04,0xff,0x6e,0x31,0x05,0xff,0x45,0x17,0x03,0xff,0x14,0x03,0x01,0xff,0x0a,0x04,0x00,0xff,0x0f,0x06,0x01,0xff,0x11,0x06,0x00,0xff,0x12,0x07,0x02,0xff,0x1a,0x0b,0x02,0xff,0x34,0x17,0x02,0xff,0x3a,0x19,0x01,0xff,0x29,0x12,0x02,0xff,0x28,0x12,0x02,0xff,0x21,0x0e,0x02,0xff,0x0f,0x06,0x02,0xff,0x11,0x08,0x02,0xff,0x11,0x08,0x02,0xff,0x10,0x08,0x01,0xff,0x10,0x08,0x01,0xff,0x12,0x09,0x01,0xff,0x12,0x09,0x01,0xff,0x12,0x08,0x01,0xff,0x10,0x08,0x01,0xff,0x0a,0x06,0x01,0xff,0x06,0x03,0x01,0xff,0x03,0x02,0x00,0xff,0x08,0x04,0x01,0xff,0x11,0x0a,0x01,0xff,0x15,0x0b,0x01,0xff,0x0e,0x08,0x01,0xff,0x0a,0x07,0x01,0xff,0x0e,0x08,0x01,0xff,0x0c,0x07,0x02,0xff,0x08,0x04,0x01,0xff,0x09,0x05,0x01,0xff,0x09,0x06,0x01,0xff,0x0b,0x06,0x01,0xff,0x09,0x05,0x00,0xff,0x08,0x05,0x01,0xff,0x08,0x05,0x01,0xff,0x07,0x04,0x01,0xff,0x06,0x04,0x00,0xff,0x08,0x04,0x00,0xff,0x0e,0x09,0x01,0xff,0x0d,0x09,0x01,0xff,0x09,0x06,0x01,0xff,0x06,0x04,0x01,0xff,0x04,0x03,0x02,0xff,0x05,0x03,0x02,0xff,0x06,0x04,0x02,0xff,0x08,0x05,0x03,0xff,0x08,0x05,0x03,0xff,0x08,0x04,0x02,0xff,0x09,0x06,0x02,0xff,0x08,0x06,0x03,0xff,0x06,0x04,0x03,0xff,0x07,0x05,0x03,0xff,0x07,0x02,0x00,0xff,0x0b,0x0b,0x0d,0xff,0x26,0x31,0x42,0xff,0x34,0x45,0x5c,0xff,0x43,0x58,0x6e,0xff,0x52,0x62,0x79,0xff,0x43,0x4c,0x56,0xff,0x2a,0x2f,0x37,0xff,0x17,0x16,0x16,0xff,0x23,0x23,0x25,0xff,0x35,0x2d,0x27,0xff,0x24,0x14,0x06,0xff,0x24,0x16,0x06,0xff,0x24,0x15,0x05,0xff,0x24,0x15,0x06,0xff,0x24,0x15,0x06,0xff,0x24,0x15,0x06,0xff,0x23,0x15,0x06,0xff,0x23,0x14,0x05,0xff,0x26,0x16,0x07,0xff,0x26,0x16,0x07,0xff,0x25,0x15,0x05,0xff,0x21,0x14,0x04,0xff,0x21,0x15,0x05,0xff,0x21,0x15,0x05,0xff,0x21,0x15,0x04,0xff,0x22,0x15,0x05,0xff,0x20,0x14,0x04,0xff,0x20,0x13,0x05,0xff,0x22,0x14,0x05,0xff,0x23,0x15,0x04,0xff,0x26,0x14,0x04,0xff,0x28,0x15,0x04,0xff,0x2c,0x16,0x02,0xff,0x2f,0x18,0x02,0xff,0x30,0x19,0x00,0xff,0x33,0x19,0x01,0xff,0x33,0x1a,0x01,0xff,0x33,0x1a,0x01,0xff,0x35,0x1b,0x01,0xff,0x36,0x1c,0x00,0xff,0x35,0x1c,0x01,0xff,0x35,0x1d,0x01,0xff,0x34,0x1d,0x00,0xff,0x28,0x14,0x00,0xff,0x7f,0x74,0x64,0xae,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf1,0xf6,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xff,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xf6,0xf0,0xec,0xb0,0x9f,0x61,0x39,0xff,0x7e,0x2d,0x00,0xff,0x7e,0x32,0x02,0xff,0x78,0x2f,0x02,0xff,0x74,0x2d,0x02,0xff,0x71,0x2d,0x01,0xff,0x72,0x2f,0x02,0xff,0x71,0x30,0x01,0xff,0x6f,0x30,0x01,0xff,0x6e,0x32,0x01,0xff,0x6d,0x31,0x01,0xff,0x6d,0x31,0x02,0xff,0x6b,0x32,0x02,0xff,0x6b,0x32,0x01,0xff,0x6b,0x32,0x01,0xff,0x6b,0x32,0x01,0xff,0x68,0x32,0x02,0xff,0x6b,0x32,0x02,0xff,0x67,0x33,0x01,0xff,0x6a,0x2e,0x02,0xff,0x68,0x2f,0x02,0xff,0x67,0x25,0x02,0xff,0x31,0x0b,0x01,0xff,0x0c,0x04,0x01,0xff,0x0d,0x05,0x01,0xff,0x1a,0x09,0x01,0xff,0x1f,0x0a,0x02,0xff,0x19,0x0a,0x01,0xff,0x31,0x16,0x01,0xff,0x39,0x17,0x01,0xff,0x2d,0x12,0x02,0xff,0x26,0x0f,0x02,0xff,0x23,0x0f,0x01,0xff,0x13,0x08,0x01,0xff,0x0f,0x07,0x01,0xff,0x12,0x06,0x01,0xff,0x13,0x09,0x01,0xff,0x14,0x0a,0x01,0xff,0x12,0x0a,0x01,0xff,0x12,0x09,0x01,0xff,0x0c,0x06,0x01,0xff,0x07,0x03,0x01,0xff,0x06,0x03,0x00,0xff,0x07,0x03,0x00,0xff,0x0c,0x06,0x01,0xff,0x14,0x0b,0x01,0xff,0x19,0x0e,0x01,0xff,0x11,0x09,0x01,0xff,0x0b,0x07,0x01,0xff,0x0a,0x06,0x01,0xff,0x0b,0x06,0x01,0xff,0x09,0x06,0x01,0xff,0x08,0x04,0x01,0xff,0x0a,0x05,0x02,0xff,0x08,0x05,0x02,0xff,0x07,0x04,0x01,0xff,0x07,0x04,0x01,0xff,0x07,0x04,0x00,0xff,0x07,0x04,0x01,0xff,0x07,0x03,0x01,0xff,0x07,0x03,0x01,0xff,0x0f,0x0a,0x00,0xff,0x11,0x0b,0x01,0xff,0x0b,0x06,0x01,0xff,0x07,0x03,0x01,0xff,0x05,0x03,0x01,0xff,0x04,0x03,0x01,0xff,0x05,0x03,0x01,0xff,0x05,0x03,0x01,0xff,0x05,0x03,0x02,0xff,0x06,0x03,0x03,0xff,0x06,0x04,0x02,0xff,0x06,0x04,0x02,0xff,0x06,0x03,0x02,0xff,0x06,0x05,0x03,0xff,0x06,0x04,0x03,0xff,0x06,0x06,0x04,0xff,0x05,0x03,0x01,0xff,0x0a,0x06,0x07,0xff,0x17,0x1f,0x27,0xff,0x4d,0x66,0x88,0xff,0x6a,0x8b,0xac,0xff,0x3a,0x46,0x57,0xff,0x57,0x65,0x7a,0xff,0x3b,0x46,0x5b,0xff,0x5d,0x66,0x7b,0xff,0x26,0x17,0x0d,0xff,0x25,0x15,0x06,0xff,0x25,0x17,0x05,0xff,0x24,0x16,0x05,0xff,0x24,0x15,0x06,0xff,0x23,0x15,0x04,0xff,0x22,0x15,0x03,0xff,0x24,0x16,0x05,0xff,0x26,0x16,0x05,0xff,0x29,0x17,0x06,0xff,0x27,0x17,0x07,0xff,0x26,0x16,0x06,0xff,0x25,0x17,0x05,0xff,0x22,0x15,0x03,0xff,0x21,0x14,0x03,0xff,0x22,0x14,0x04,0xff,0x21,0x14,0x05,0xff,0x20,0x14,0x04,0xff,0x21,0x13,0x05,0xff,0x21,0x14,0x04,0xff,0x26,0x16,0x03,0xff,0x2a,0x16,0x03,0xff,0x2e,0x17,0x03,0xff,0x31,0x18,0x01,0xff,0x34,0x19,0x01,0xff,0x34,0x1b,0x00,0xff,0x34,0x1b,0x00,0xff,0x35,0x1a,0x01,0xff,0x36,0x1a,0x01,0xff,0x38,0x1b,0x02,0xff,0x35,0x1b,0x01,0xff,0x35,0x1b,0x01,0xff,0x36,0x1e,0x02,0xff,0x2f,0x17,0x00,0xff,0x4d,0x3b,0x22,0xf0,0xe0,0xde,0xd9,0x2c,0xff,0xff,0xff,0x00,0xff,0xf9,0xfc,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfe,0xf3,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xea,0xf2,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x2d,0xda,0xc2,0xb4,0xef,0x84,0x36,0x09,0xff,0x78,0x2a,0x00,0xff,0x75,0x2b,0x01,0xff,0x74,0x2b,0x02,0xff,0x72,0x2c,0x01,0xff,0x71,0x2d,0x00,0xff,0x6f,0x2f,0x01,0xff,0x6f,0x31,0x01,0xff,0x6d,0x2f,0x01,0xff,0x6c,0x30,0x02,0xff,0x6c,0x30,0x01,0xff,0x6b,0x31,0x01,0xff,0x6b,0x31,0x02,0xff,0x6b,0x32,0x01,0xff,0x6b,0x33,0x01,0xff,0x68,0x31,0x01,0xff,0x6a,0x32,0x02,0xff,0x6b,0x33,0x01,0xff,0x73,0x2f,0x03,0xff,0x67,0x2f,0x02,0xff,0x6c,0x29,0x02,0xff,0x50,0x14,0x04,0xff,0x22,0x0a,0x01,0xff,0x04,0x03,0x00,0xff,0x12,0x06,0x01,0xff,0x24,0x0d,0x02,0xff,0x1b,0x0a,0x01,0xff,0x28,0x0f,0x01,0xff,0x34,0x13,0x00,0xff,0x2e,0x12,0x01,0xff,0x20,0x0b,0x01,0xff,0x27,0x11,0x01,0xff,0x1a,0x0b,0x01,0xff,0x0f,0x07,0x00,0xff,0x11,0x07,0x01,0xff,0x0f,0x07,0x01,0xff,0x0e,0x07,0x01,0xff,0x0b,0x05,0x02,0xff,0x08,0x04,0x01,0xff,0x07,0x03,0x01,0xff,0x0b,0x06,0x02,0xff,0x10,0x09,0x03,0xff,0x0e,0x08,0x01,0xff,0x0c,0x05,0x01,0xff,0x0f,0x06,0x00,0xff,0x12,0x09,0x00,0xff,0x0c,0x06,0x00,0xff,0x08,0x04,0x00,0xff,0x09,0x05,0x00,0xff,0x09,0x05,0x01,0xff,0x09,0x05,0x02,0xff,0x08,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x07,0x04,0x01,0xff,0x06,0x03,0x00,0xff,0x07,0x04,0x01,0xff,0x06,0x04,0x00,0xff,0x07,0x04,0x00,0xff,0x07,0x03,0x01,0xff,0x0c,0x09,0x01,0xff,0x11,0x0a,0x02,0xff,0x0b,0x05,0x01,0xff,0x06,0x03,0x01,0xff,0x05,0x03,0x02,0xff,0x04,0x03,0x01,0xff,0x04,0x03,0x01,0xff,0x05,0x04,0x02,0xff,0x05,0x04,0x02,0xff,0x05,0x03,0x02,0xff,0x05,0x03,0x01,0xff,0x05,0x04,0x02,0xff,0x06,0x04,0x02,0xff,0x05,0x04,0x02,0xff,0x05,0x04,0x02,0xff,0x06,0x04,0x03,0xff,0x07,0x05,0x03,0xff,0x09,0x06,0x05,0xff,0x06,0x04,0x02,0xff,0x07,0x04,0x02,0xff,0x1b,0x21,0x32,0xff,0x41,0x54,0x75,0xff,0x50,0x60,0x81,0xff,0x22,0x27,0x36,0xff,0x4f,0x5c,0x78,0xff,0x3e,0x3a,0x40,0xff,0x25,0x11,0x01,0xff,0x26,0x16,0x08,0xff,0x23,0x15,0x07,0xff,0x23,0x14,0x05,0xff,0x22,0x15,0x05,0xff,0x22,0x14,0x04,0xff,0x25,0x16,0x05,0xff,0x28,0x17,0x05,0xff,0x2a,0x17,0x05,0xff,0x2c,0x19,0x06,0xff,0x2d,0x19,0x05,0xff,0x2e,0x19,0x04,0xff,0x2a,0x17,0x03,0xff,0x27,0x16,0x03,0xff,0x23,0x15,0x02,0xff,0x22,0x14,0x04,0xff,0x21,0x14,0x04,0xff,0x22,0x13,0x04,0xff,0x25,0x15,0x05,0xff,0x25,0x15,0x03,0xff,0x2b,0x17,0x03,0xff,0x31,0x19,0x03,0xff,0x34,0x19,0x01,0xff,0x36,0x1a,0x02,0xff,0x3d,0x19,0x01,0xff,0x43,0x1b,0x02,0xff,0x43,0x1b,0x01,0xff,0x41,0x19,0x02,0xff,0x3c,0x1a,0x02,0xff,0x39,0x19,0x02,0xff,0x35,0x18,0x01,0xff,0x34,0x1a,0x02,0xff,0x31,0x19,0x00,0xff,0x30,0x19,0x00,0xff,0xab,0xa2,0x96,0x7b,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfd,0xed,0xf3,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x75,0xb8,0x8d,0x73,0xff,0x75,0x26,0x00,0xff,0x73,0x28,0x00,0xff,0x74,0x2a,0x01,0xff,0x73,0x2c,0x02,0xff,0x70,0x2b,0x00,0xff,0x70,0x2c,0x01,0xff,0x6f,0x2e,0x02,0xff,0x6e,0x30,0x01,0xff,0x6d,0x30,0x00,0xff,0x6c,0x31,0x01,0xff,0x6b,0x31,0x01,0xff,0x6a,0x31,0x01,0xff,0x6b,0x32,0x01,0xff,0x6a,0x31,0x00,0xff,0x68,0x31,0x00,0xff,0x68,0x33,0x01,0xff,0x69,0x33,0x01,0xff,0x78,0x31,0x04,0xff,0x69,0x2e,0x03,0xff,0x65,0x28,0x03,0xff,0x50,0x13,0x02,0xff,0x3d,0x0f,0x01,0xff,0x1e,0x07,0x01,0xff,0x0a,0x04,0x00,0xff,0x0a,0x05,0x00,0xff,0x18,0x08,0x02,0xff,0x1f,0x0b,0x02,0xff,0x31,0x11,0x02,0xff,0x37,0x13,0x01,0xff,0x28,0x0e,0x01,0xff,0x1f,0x0b,0x03,0xff,0x1d,0x0d,0x02,0xff,0x0a,0x05,0x01,0xff,0x09,0x04,0x01,0xff,0x07,0x03,0x00,0xff,0x07,0x03,0x00,0xff,0x08,0x04,0x00,0xff,0x0b,0x06,0x02,0xff,0x0e,0x07,0x02,0xff,0x10,0x09,0x02,0xff,0x09,0x05,0x01,0xff,0x04,0x02,0x01,0xff,0x08,0x03,0x00,0xff,0x18,0x0c,0x03,0xff,0x10,0x09,0x02,0xff,0x07,0x04,0x01,0xff,0x06,0x03,0x01,0xff,0x06,0x03,0x01,0xff,0x08,0x04,0x01,0xff,0x0a,0x05,0x02,0xff,0x09,0x03,0x01,0xff,0x09,0x04,0x02,0xff,0x06,0x03,0x01,0xff,0x06,0x03,0x00,0xff,0x07,0x04,0x00,0xff,0x06,0x04,0x01,0xff,0x07,0x04,0x01,0xff,0x0f,0x09,0x01,0xff,0x10,0x09,0x02,0xff,0x08,0x05,0x02,0xff,0x04,0x02,0x02,0xff,0x04,0x04,0x00,0xff,0x04,0x04,0x00,0xff,0x04,0x04,0x01,0xff,0x04,0x03,0x01,0xff,0x04,0x03,0x01,0xff,0x04,0x03,0x02,0xff,0x05,0x03,0x01,0xff,0x05,0x03,0x02,0xff,0x05,0x03,0x02,0xff,0x05,0x03,0x02,0xff,0x05,0x03,0x02,0xff,0x05,0x03,0x02,0xff,0x06,0x04,0x02,0xff,0x09,0x06,0x05,0xff,0x0a,0x06,0x05,0xff,0x08,0x05,0x04,0xff,0x09,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x06,0x04,0x07,0xff,0x19,0x19,0x1f,0xff,0x27,0x23,0x28,0xff,0x2b,0x23,0x21,0xff,0x21,0x11,0x02,0xff,0x27,0x17,0x06,0xff,0x26,0x15,0x06,0xff,0x24,0x15,0x07,0xff,0x25,0x14,0x05,0xff,0x26,0x15,0x04,0xff,0x27,0x16,0x04,0xff,0x2a,0x18,0x03,0xff,0x31,0x1a,0x03,0xff,0x34,0x1c,0x02,0xff,0x37,0x1d,0x02,0xff,0x37,0x1c,0x02,0xff,0x36,0x1c,0x01,0xff,0x2f,0x19,0x02,0xff,0x2b,0x17,0x03,0xff,0x27,0x16,0x02,0xff,0x23,0x15,0x03,0xff,0x22,0x14,0x02,0xff,0x26,0x14,0x04,0xff,0x29,0x16,0x05,0xff,0x29,0x16,0x02,0xff,0x2f,0x17,0x01,0xff,0x36,0x19,0x02,0xff,0x3a,0x1a,0x01,0xff,0x3f,0x1b,0x00,0xff,0x53,0x1c,0x01,0xff,0x5d,0x1e,0x02,0xff,0x5d,0x1d,0x02,0xff,0x56,0x1a,0x02,0xff,0x4b,0x1a,0x04,0xff,0x40,0x18,0x03,0xff,0x38,0x17,0x02,0xff,0x32,0x17,0x01,0xff,0x28,0x10,0x00,0xff,0x76,0x67,0x56,0xc6,0xf9,0xf9,0xf8,0x0a,0xff,0xff,0xff,0x00,0xff,0xf5,0xf9,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf5,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xff,0xf9,0xfb,0x00,0xff,0xff,0xff,0x03,0xf5,0xee,0xea,0xba,0x95,0x59,0x39,0xff,0x6e,0x21,0x00,0xff,0x73,0x29,0x01,0xff,0x72,0x29,0x01,0xff,0x70,0x2a,0x02,0xff,0x6f,0x2c,0x02,0xff,0x6e,0x2d,0x01,0xff,0x6f,0x30,0x01,0xff,0x6c,0x2f,0x01,0xff,0x6a,0x2e,0x01,0xff,0x6b,0x30,0x02,0xff,0x69,0x2f,0x01,0xff,0x6a,0x31,0x01,0xff,0x6a,0x31,0x00,0xff,0x6a,0x32,0x01,0xff,0x69,0x32,0x01,0xff,0x6b,0x30,0x02,0xff,0x74,0x2f,0x04,0xff,0x68,0x2e,0x03,0xff,0x6b,0x31,0x02,0xff,0x55,0x17,0x02,0xff,0x4e,0x12,0x01,0xff,0x3d,0x0f,0x01,0xff,0x33,0x0d,0x01,0xff,0x2c,0x0e,0x02,0xff,0x10,0x04,0x02,0xff,0x0e,0x05,0x02,0xff,0x22,0x0a,0x03,0xff,0x36,0x12,0x03,0xff,0x35,0x14,0x01,0xff,0x18,0x08,0x01,0xff,0x18,0x0a,0x00,0xff,0x0e,0x06,0x00,0xff,0x05,0x02,0x00,0xff,0x04,0x03,0x00,0xff,0x08,0x05,0x01,0xff,0x0a,0x06,0x02,0xff,0x09,0x05,0x02,0xff,0x07,0x04,0x01,0xff,0x05,0x03,0x01,0xff,0x01,0x00,0x02,0xff,0x05,0x02,0x01,0xff,0x1e,0x0e,0x02,0xff,0x1e,0x0f,0x01,0xff,0x08,0x04,0x00,0xff,0x05,0x02,0x01,0xff,0x04,0x02,0x01,0xff,0x04,0x03,0x01,0xff,0x08,0x05,0x02,0xff,0x0b,0x05,0x01,0xff,0x09,0x04,0x01,0xff,0x08,0x04,0x02,0xff,0x09,0x03,0x02,0xff,0x07,0x03,0x01,0xff,0x05,0x04,0x01,0xff,0x09,0x05,0x02,0xff,0x0f,0x0a,0x02,0xff,0x0f,0x0a,0x01,0xff,0x08,0x04,0x00,0xff,0x04,0x03,0x01,0xff,0x04,0x03,0x02,0xff,0x04,0x03,0x01,0xff,0x05,0x04,0x01,0xff,0x05,0x04,0x01,0xff,0x05,0x03,0x02,0xff,0x05,0x03,0x02,0xff,0x05,0x03,0x02,0xff,0x04,0x03,0x01,0xff,0x04,0x03,0x01,0xff,0x05,0x03,0x01,0xff,0x05,0x04,0x02,0xff,0x05,0x04,0x02,0xff,0x05,0x04,0x02,0xff,0x07,0x04,0x02,0xff,0x09,0x07,0x04,0xff,0x10,0x09,0x06,0xff,0x1e,0x0c,0x09,0xff,0x34,0x27,0x23,0xff,0x57,0x4f,0x4f,0xff,0x67,0x61,0x63,0xff,0x54,0x4d,0x4a,0xff,0x31,0x25,0x19,0xff,0x23,0x13,0x01,0xff,0x27,0x18,0x06,0xff,0x25,0x16,0x08,0xff,0x29,0x16,0x07,0xff,0x29,0x18,0x06,0xff,0x2d,0x19,0x05,0xff,0x33,0x1a,0x02,0xff,0x36,0x1b,0x01,0xff,0x3e,0x1e,0x01,0xff,0x46,0x21,0x00,0xff,0x49,0x23,0x00,0xff,0x49,0x25,0x01,0xff,0x45,0x22,0x01,0xff,0x41,0x21,0x01,0xff,0x37,0x1d,0x01,0xff,0x2f,0x19,0x01,0xff,0x29,0x17,0x03,0xff,0x25,0x15,0x04,0xff,0x25,0x14,0x05,0xff,0x28,0x16,0x04,0xff,0x2b,0x17,0x04,0xff,0x2e,0x17,0x02,0xff,0x31,0x18,0x00,0xff,0x3a,0x18,0x02,0xff,0x41,0x1a,0x02,0xff,0x51,0x1e,0x01,0xff,0x68,0x22,0x01,0xff,0x71,0x24,0x04,0xff,0x6e,0x22,0x03,0xff,0x66,0x1d,0x03,0xff,0x5c,0x1b,0x06,0xff,0x48,0x19,0x06,0xff,0x3a,0x17,0x04,0xff,0x2a,0x10,0x00,0xff,0x4a,0x35,0x23,0xf4,0xdf,0xdb,0xd7,0x37,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf5,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xeb,0xf3,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x2a,0xdc,0xc8,0xbe,0xea,0x7b,0x34,0x12,0xff,0x70,0x23,0x00,0xff,0x72,0x29,0x01,0xff,0x71,0x2a,0x02,0xff,0x6f,0x2b,0x00,0xff,0x70,0x2c,0x01,0xff,0x6f,0x2d,0x02,0xff,0x6b,0x2c,0x02,0xff,0x69,0x2d,0x01,0xff,0x67,0x2d,0x02,0xff,0x65,0x2d,0x01,0xff,0x67,0x2e,0x01,0xff,0x68,0x2f,0x01,0xff,0x69,0x30,0x01,0xff,0x6a,0x31,0x02,0xff,0x6d,0x31,0x03,0xff,0x66,0x2c,0x04,0xff,0x67,0x30,0x02,0xff,0x6e,0x34,0x02,0xff,0x51,0x18,0x01,0xff,0x45,0x10,0x01,0xff,0x47,0x12,0x01,0xff,0x5a,0x19,0x03,0xff,0x61,0x1c,0x03,0xff,0x2b,0x0d,0x03,0xff,0x3f,0x13,0x03,0xff,0x3b,0x14,0x01,0xff,0x28,0x0c,0x01,0xff,0x34,0x10,0x03,0xff,0x2b,0x0e,0x01,0xff,0x15,0x07,0x01,0xff,0x0e,0x06,0x02,0xff,0x0a,0x05,0x01,0xff,0x08,0x03,0x00,0xff,0x07,0x04,0x00,0xff,0x07,0x04,0x00,0xff,0x06,0x02,0x01,0xff,0x07,0x02,0x02,0xff,0x04,0x01,0x02,0xff,0x09,0x05,0x01,0xff,0x23,0x12,0x04,0xff,0x1c,0x10,0x02,0xff,0x09,0x04,0x01,0xff,0x05,0x02,0x01,0xff,0x04,0x02,0x00,0xff,0x05,0x02,0x01,0xff,0x0b,0x06,0x01,0xff,0x0d,0x08,0x00,0xff,0x0c,0x06,0x01,0xff,0x0b,0x06,0x01,0xff,0x07,0x04,0x00,0xff,0x05,0x03,0x01,0xff,0x06,0x03,0x02,0xff,0x0a,0x06,0x00,0xff,0x0e,0x0b,0x02,0xff,0x0c,0x07,0x01,0xff,0x07,0x04,0x01,0xff,0x04,0x03,0x00,0xff,0x04,0x03,0x02,0xff,0x05,0x03,0x02,0xff,0x04,0x02,0x01,0xff,0x04,0x03,0x01,0xff,0x05,0x03,0x02,0xff,0x05,0x03,0x02,0xff,0x05,0x03,0x02,0xff,0x04,0x03,0x01,0xff,0x05,0x04,0x02,0xff,0x05,0x04,0x02,0xff,0x05,0x04,0x02,0xff,0x05,0x03,0x02,0xff,0x05,0x03,0x01,0xff,0x04,0x03,0x02,0xff,0x05,0x02,0x02,0xff,0x09,0x05,0x01,0xff,0x44,0x43,0x43,0xff,0x96,0x98,0x9d,0xff,0xb5,0xba,0xbd,0xff,0x99,0x9a,0x9f,0xff,0x5b,0x55,0x50,0xff,0x2c,0x1f,0x16,0xff,0x25,0x14,0x01,0xff,0x29,0x18,0x05,0xff,0x29,0x17,0x06,0xff,0x2d,0x18,0x06,0xff,0x33,0x1a,0x04,0xff,0x38,0x1d,0x01,0xff,0x3d,0x1f,0x01,0xff,0x44,0x21,0x01,0xff,0x4c,0x24,0x00,0xff,0x57,0x28,0x01,0xff,0x60,0x2b,0x01,0xff,0x63,0x2d,0x01,0xff,0x64,0x2d,0x01,0xff,0x5f,0x2b,0x01,0xff,0x56,0x27,0x01,0xff,0x4a,0x23,0x00,0xff,0x3d,0x1f,0x02,0xff,0x2f,0x1a,0x01,0xff,0x2c,0x17,0x03,0xff,0x2b,0x16,0x05,0xff,0x2d,0x16,0x04,0xff,0x2f,0x17,0x03,0xff,0x32,0x17,0x02,0xff,0x33,0x19,0x01,0xff,0x3d,0x1a,0x01,0xff,0x4a,0x1e,0x01,0xff,0x65,0x24,0x03,0xff,0x7d,0x29,0x05,0xff,0x84,0x2a,0x0a,0xff,0x82,0x29,0x09,0xff,0x7c,0x24,0x05,0xff,0x6d,0x1e,0x08,0xff,0x50,0x1a,0x09,0xff,0x38,0x12,0x02,0xff,0x33,0x18,0x06,0xff,0xb4,0xab,0xa4,0x76,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xee,0xf4,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf5,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x5f,0xc2,0x9f,0x90,0xff,0x73,0x25,0x01,0xff,0x71,0x25,0x00,0xff,0x71,0x29,0x01,0xff,0x70,0x29,0x01,0xff,0x70,0x29,0x01,0xff,0x6e,0x2b,0x01,0xff,0x6c,0x2d,0x01,0xff,0x6e,0x2f,0x01,0xff,0x6c,0x2f,0x01,0xff,0x6c,0x30,0x01,0xff,0x6b,0x2f,0x01,0xff,0x69,0x2e,0x00,0xff,0x69,0x2e,0x02,0xff,0x69,0x30,0x01,0xff,0x6e,0x32,0x02,0xff,0x64,0x2b,0x03,0xff,0x69,0x32,0x01,0xff,0x6e,0x33,0x02,0xff,0x50,0x1b,0x00,0xff,0x34,0x08,0x01,0xff,0x40,0x0f,0x00,0xff,0x65,0x1d,0x03,0xff,0x5b,0x1c,0x03,0xff,0x37,0x10,0x02,0xff,0x59,0x1d,0x02,0xff,0x53,0x1b,0x01,0xff,0x39,0x10,0x04,0xff,0x20,0x09,0x01,0xff,0x2b,0x0f,0x02,0xff,0x1e,0x0b,0x02,0xff,0x0a,0x04,0x00,0xff,0x03,0x03,0x00,0xff,0x05,0x02,0x01,0xff,0x05,0x02,0x00,0xff,0x05,0x02,0x00,0xff,0x07,0x03,0x00,0xff,0x05,0x04,0x01,0xff,0x0b,0x06,0x02,0xff,0x2d,0x13,0x04,0xff,0x1e,0x0f,0x02,0xff,0x09,0x04,0x01,0xff,0x04,0x02,0x02,0xff,0x03,0x02,0x01,0xff,0x08,0x04,0x00,0xff,0x0e,0x08,0x01,0xff,0x11,0x0a,0x01,0xff,0x0f,0x08,0x01,0xff,0x0d,0x07,0x01,0xff,0x0b,0x05,0x01,0xff,0x05,0x02,0x00,0xff,0x05,0x03,0x00,0xff,0x0d,0x06,0x02,0xff,0x0e,0x09,0x02,0xff,0x08,0x06,0x00,0xff,0x05,0x02,0x01,0xff,0x04,0x02,0x00,0xff,0x04,0x02,0x00,0xff,0x03,0x02,0x01,0xff,0x04,0x03,0x02,0xff,0x05,0x03,0x01,0xff,0x05,0x03,0x02,0xff,0x05,0x04,0x02,0xff,0x05,0x03,0x02,0xff,0x05,0x03,0x02,0xff,0x05,0x03,0x02,0xff,0x04,0x03,0x01,0xff,0x05,0x04,0x01,0xff,0x05,0x04,0x02,0xff,0x06,0x04,0x02,0xff,0x05,0x04,0x02,0xff,0x05,0x03,0x01,0xff,0x05,0x04,0x01,0xff,0x04,0x00,0x00,0xff,0x1f,0x22,0x23,0xff,0x77,0x81,0x82,0xff,0x47,0x40,0x3a,0xff,0x1f,0x0c,0x00,0xff,0x21,0x0e,0x00,0xff,0x26,0x16,0x02,0xff,0x27,0x19,0x06,0xff,0x26,0x16,0x05,0xff,0x2a,0x18,0x04,0xff,0x34,0x1b,0x02,0xff,0x3a,0x1e,0x01,0xff,0x3f,0x20,0x01,0xff,0x48,0x23,0x01,0xff,0x52,0x26,0x01,0xff,0x5e,0x2c,0x01,0xff,0x6b,0x31,0x01,0xff,0x74,0x34,0x01,0xff,0x7a,0x38,0x01,0xff,0x7c,0x39,0x01,0xff,0x78,0x36,0x01,0xff,0x6e,0x30,0x01,0xff,0x60,0x2a,0x00,0xff,0x50,0x24,0x01,0xff,0x40,0x1f,0x01,0xff,0x37,0x1b,0x01,0xff,0x33,0x17,0x02,0xff,0x32,0x17,0x03,0xff,0x33,0x18,0x03,0xff,0x37,0x19,0x03,0xff,0x38,0x1a,0x02,0xff,0x46,0x1d,0x02,0xff,0x5a,0x24,0x01,0xff,0x76,0x2c,0x03,0xff,0x8d,0x30,0x07,0xff,0x95,0x31,0x10,0xff,0x94,0x30,0x11,0xff,0x8d,0x2a,0x0b,0xff,0x7a,0x24,0x0c,0xff,0x57,0x1b,0x0b,0xff,0x39,0x0e,0x01,0xff,0x8d,0x7d,0x74,0xb1,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x00,0xfe,0xf4,0xf8,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xfc,0xfb,0xfa,0x94,0xa8,0x78,0x62,0xff,0x6e,0x1d,0x00,0xff,0x71,0x27,0x01,0xff,0x71,0x27,0x01,0xff,0x71,0x29,0x01,0xff,0x72,0x2d,0x01,0xff,0x76,0x33,0x01,0xff,0x7b,0x36,0x01,0xff,0x7c,0x36,0x01,0xff,0x79,0x35,0x01,0xff,0x74,0x34,0x01,0xff,0x6f,0x30,0x01,0xff,0x6a,0x2d,0x01,0xff,0x67,0x2e,0x01,0xff,0x6d,0x31,0x03,0xff,0x60,0x2a,0x03,0xff,0x6a,0x32,0x02,0xff,0x6f,0x33,0x02,0xff,0x5a,0x22,0x01,0xff,0x36,0x08,0x01,0xff,0x55,0x19,0x02,0xff,0x62,0x1e,0x02,0xff,0x4b,0x16,0x02,0xff,0x35,0x0e,0x03,0xff,0x47,0x15,0x02,0xff,0x34,0x11,0x00,0xff,0x2d,0x0e,0x01,0xff,0x2a,0x0d,0x01,0xff,0x1e,0x09,0x01,0xff,0x2c,0x0e,0x02,0xff,0x19,0x08,0x00,0xff,0x04,0x03,0x01,0xff,0x04,0x02,0x01,0xff,0x04,0x02,0x00,0xff,0x04,0x02,0x01,0xff,0x0e,0x07,0x01,0xff,0x14,0x08,0x01,0xff,0x2a,0x13,0x01,0xff,0x20,0x11,0x02,0xff,0x06,0x04,0x00,0xff,0x04,0x01,0x01,0xff,0x06,0x02,0x01,0xff,0x0b,0x06,0x01,0xff,0x12,0x0a,0x01,0xff,0x13,0x09,0x00,0xff,0x0d,0x07,0x01,0xff,0x0d,0x06,0x01,0xff,0x0c,0x06,0x01,0xff,0x0b,0x05,0x01,0xff,0x0b,0x06,0x02,0xff,0x0d,0x08,0x03,0xff,0x0d,0x06,0x02,0xff,0x06,0x04,0x01,0xff,0x04,0x02,0x01,0xff,0x04,0x03,0x00,0xff,0x03,0x03,0x00,0xff,0x04,0x03,0x00,0xff,0x05,0x03,0x01,0xff,0x05,0x04,0x01,0xff,0x05,0x03,0x01,0xff,0x05,0x04,0x01,0xff,0x05,0x04,0x01,0xff,0x05,0x04,0x01,0xff,0x04,0x03,0x01,0xff,0x05,0x03,0x02,0xff,0x04,0x02,0x01,0xff,0x04,0x03,0x01,0xff,0x05,0x03,0x02,0xff,0x06,0x04,0x02,0xff,0x05,0x04,0x02,0xff,0x05,0x03,0x02,0xff,0x05,0x04,0x01,0xff,0x01,0x02,0x00,0xff,0x10,0x12,0x0e,0xff,0x3f,0x43,0x3c,0xff,0x2a,0x1c,0x11,0xff,0x24,0x15,0x00,0xff,0x2b,0x18,0x05,0xff,0x27,0x18,0x04,0xff,0x26,0x17,0x03,0xff,0x29,0x17,0x02,0xff,0x2d,0x1a,0x03,0xff,0x36,0x1d,0x01,0xff,0x3f,0x21,0x01,0xff,0x48,0x25,0x02,0xff,0x53,0x28,0x01,0xff,0x63,0x2f,0x00,0xff,0x70,0x35,0x01,0xff,0x7e,0x3a,0x01,0xff,0x85,0x3e,0x01,0xff,0x8e,0x42,0x02,0xff,0x90,0x41,0x01,0xff,0x8b,0x3f,0x01,0xff,0x81,0x38,0x01,0xff,0x71,0x31,0x01,0xff,0x5f,0x29,0x01,0xff,0x4f,0x22,0x02,0xff,0x44,0x1d,0x01,0xff,0x3a,0x1b,0x01,0xff,0x35,0x19,0x01,0xff,0x34,0x18,0x01,0xff,0x37,0x18,0x02,0xff,0x3b,0x1a,0x01,0xff,0x4c,0x21,0x02,0xff,0x66,0x2b,0x01,0xff,0x7f,0x31,0x01,0xff,0x93,0x35,0x09,0xff,0x9d,0x37,0x15,0xff,0x9c,0x35,0x1a,0xff,0x90,0x2e,0x14,0xff,0x78,0x23,0x0c,0xff,0x50,0x12,0x02,0xff,0x76,0x57,0x4d,0xdb,0xf1,0xf0,0xef,0x1e,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfb,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfe,0xe8,0xf0,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x0b,0xf2,0xea,0xe7,0xc1,0x94,0x59,0x3e,0xff,0x6b,0x1d,0x00,0xff,0x72,0x27,0x01,0xff,0x74,0x2a,0x02,0xff,0x77,0x2f,0x01,0xff,0x7d,0x36,0x01,0xff,0x83,0x3b,0x01,0xff,0x85,0x3b,0x02,0xff,0x80,0x38,0x01,0xff,0x7a,0x35,0x01,0xff,0x75,0x33,0x01,0xff,0x6d,0x2f,0x01,0xff,0x68,0x2d,0x02,0xff,0x6a,0x2f,0x07,0xff,0x62,0x2c,0x04,0xff,0x6a,0x31,0x01,0xff,0x6a,0x32,0x02,0xff,0x69,0x2d,0x01,0xff,0x64,0x1c,0x02,0xff,0x71,0x22,0x03,0xff,0x3d,0x0e,0x03,0xff,0x36,0x0e,0x02,0xff,0x2c,0x0b,0x02,0xff,0x34,0x0d,0x02,0xff,0x26,0x0a,0x01,0xff,0x1f,0x08,0x01,0xff,0x2c,0x0e,0x04,0xff,0x14,0x05,0x01,0xff,0x1a,0x0a,0x02,0xff,0x1f,0x0c,0x02,0xff,0x07,0x04,0x01,0xff,0x05,0x03,0x01,0xff,0x05,0x02,0x01,0xff,0x05,0x02,0x02,0xff,0x1a,0x0b,0x02,0xff,0x25,0x11,0x02,0xff,0x2b,0x15,0x02,0xff,0x0b,0x06,0x01,0xff,0x03,0x02,0x01,0xff,0x04,0x01,0x00,0xff,0x0b,0x06,0x01,0xff,0x11,0x0a,0x01,0xff,0x12,0x0a,0x01,0xff,0x0e,0x07,0x01,0xff,0x0a,0x05,0x00,0xff,0x0d,0x06,0x00,0xff,0x0e,0x06,0x01,0xff,0x0d,0x08,0x02,0xff,0x0c,0x08,0x02,0xff,0x07,0x04,0x00,0xff,0x03,0x02,0x01,0xff,0x04,0x02,0x01,0xff,0x04,0x03,0x01,0xff,0x04,0x03,0x01,0xff,0x05,0x03,0x02,0xff,0x05,0x03,0x02,0xff,0x05,0x03,0x02,0xff,0x04,0x04,0x01,0xff,0x05,0x04,0x00,0xff,0x05,0x04,0x00,0xff,0x06,0x04,0x00,0xff,0x06,0x04,0x00,0xff,0x05,0x03,0x01,0xff,0x04,0x03,0x01,0xff,0x05,0x03,0x02,0xff,0x05,0x03,0x02,0xff,0x04,0x03,0x01,0xff,0x05,0x03,0x02,0xff,0x05,0x03,0x02,0xff,0x04,0x03,0x01,0xff,0x02,0x00,0x00,0xff,0x0a,0x0b,0x08,0xff,0x29,0x2f,0x2a,0xff,0x45,0x4c,0x47,0xff,0x38,0x2b,0x1e,0xff,0x24,0x14,0x00,0xff,0x2a,0x19,0x05,0xff,0x29,0x18,0x04,0xff,0x28,0x17,0x04,0xff,0x2b,0x19,0x03,0xff,0x31,0x1b,0x03,0xff,0x39,0x1f,0x02,0xff,0x45,0x24,0x01,0xff,0x51,0x29,0x01,0xff,0x5e,0x2e,0x01,0xff,0x6f,0x36,0x01,0xff,0x7f,0x3f,0x01,0xff,0x8c,0x43,0x01,0xff,0x8f,0x43,0x01,0xff,0x98,0x45,0x02,0xff,0x99,0x47,0x01,0xff,0x97,0x46,0x02,0xff,0x8c,0x3d,0x01,0xff,0x7c,0x35,0x01,0xff,0x69,0x2e,0x01,0xff,0x5a,0x27,0x02,0xff,0x4d,0x21,0x01,0xff,0x3f,0x1c,0x02,0xff,0x37,0x19,0x02,0xff,0x36,0x17,0x01,0xff,0x38,0x18,0x02,0xff,0x42,0x1c,0x01,0xff,0x55,0x24,0x02,0xff,0x71,0x2f,0x01,0xff,0x87,0x36,0x01,0xff,0x97,0x39,0x0c,0xff,0xa3,0x3e,0x1c,0xff,0x9e,0x37,0x1a,0xff,0x8d,0x2d,0x13,0xff,0x6d,0x1b,0x04,0xff,0x71,0x3e,0x30,0xf6,0xdf,0xd8,0xd6,0x43,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xea,0xf2,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xec,0xf3,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x25,0xe6,0xd9,0xd2,0xdf,0x83,0x42,0x26,0xff,0x69,0x1c,0x00,0xff,0x74,0x29,0x01,0xff,0x7a,0x31,0x01,0xff,0x80,0x38,0x01,0xff,0x87,0x3c,0x01,0xff,0x8a,0x3d,0x01,0xff,0x87,0x3c,0x01,0xff,0x82,0x39,0x01,0xff,0x79,0x34,0x01,0xff,0x71,0x30,0x01,0xff,0x64,0x2d,0x02,0xff,0x4c,0x1f,0x02,0xff,0x62,0x2d,0x03,0xff,0x69,0x32,0x00,0xff,0x67,0x31,0x01,0xff,0x73,0x34,0x01,0xff,0x80,0x2b,0x03,0xff,0x40,0x0e,0x01,0xff,0x28,0x08,0x01,0xff,0x26,0x08,0x01,0xff,0x20,0x09,0x01,0xff,0x23,0x0a,0x01,0xff,0x22,0x09,0x00,0xff,0x19,0x08,0x00,0xff,0x21,0x09,0x01,0xff,0x16,0x07,0x02,0xff,0x06,0x04,0x00,0xff,0x10,0x06,0x01,0xff,0x09,0x03,0x01,0xff,0x05,0x03,0x00,0xff,0x04,0x02,0x01,0xff,0x05,0x02,0x01,0xff,0x20,0x0e,0x03,0xff,0x2f,0x16,0x01,0xff,0x14,0x08,0x01,0xff,0x05,0x02,0x02,0xff,0x05,0x03,0x01,0xff,0x0d,0x07,0x01,0xff,0x13,0x0a,0x02,0xff,0x11,0x09,0x01,0xff,0x0e,0x06,0x00,0xff,0x0d,0x06,0x01,0xff,0x10,0x08,0x01,0xff,0x10,0x09,0x03,0xff,0x0d,0x07,0x02,0xff,0x07,0x04,0x00,0xff,0x04,0x02,0x01,0xff,0x03,0x02,0x01,0xff,0x04,0x02,0x01,0xff,0x06,0x03,0x00,0xff,0x06,0x04,0x00,0xff,0x07,0x04,0x01,0xff,0x07,0x04,0x01,0xff,0x06,0x04,0x01,0xff,0x06,0x03,0x00,0xff,0x06,0x04,0x01,0xff,0x06,0x04,0x01,0xff,0x06,0x04,0x00,0xff,0x07,0x04,0x00,0xff,0x05,0x04,0x00,0xff,0x05,0x03,0x01,0xff,0x05,0x04,0x02,0xff,0x05,0x03,0x01,0xff,0x04,0x03,0x01,0xff,0x04,0x03,0x01,0xff,0x05,0x03,0x02,0xff,0x05,0x03,0x02,0xff,0x03,0x01,0x00,0xff,0x08,0x08,0x05,0xff,0x1b,0x1d,0x19,0xff,0x24,0x2a,0x26,0xff,0x46,0x4d,0x4a,0xff,0x40,0x38,0x2d,0xff,0x26,0x14,0x00,0xff,0x2b,0x19,0x03,0xff,0x29,0x18,0x03,0xff,0x29,0x18,0x03,0xff,0x2c,0x19,0x02,0xff,0x32,0x1c,0x01,0xff,0x3b,0x21,0x00,0xff,0x4a,0x28,0x01,0xff,0x58,0x2d,0x01,0xff,0x65,0x33,0x02,0xff,0x76,0x3b,0x02,0xff,0x83,0x42,0x01,0xff,0x91,0x45,0x00,0xff,0x97,0x48,0x00,0xff,0x9b,0x49,0x01,0xff,0x9b,0x4a,0x01,0xff,0x9a,0x47,0x01,0xff,0x92,0x40,0x01,0xff,0x82,0x36,0x01,0xff,0x73,0x32,0x02,0xff,0x65,0x2c,0x01,0xff,0x52,0x22,0x01,0xff,0x42,0x1d,0x02,0xff,0x37,0x19,0x02,0xff,0x37,0x18,0x02,0xff,0x3d,0x1b,0x03,0xff,0x4d,0x21,0x02,0xff,0x64,0x2c,0x03,0xff,0x7e,0x34,0x02,0xff,0x8f,0x3a,0x04,0xff,0x9b,0x3c,0x0e,0xff,0x9f,0x3c,0x18,0xff,0x96,0x35,0x14,0xff,0x7e,0x24,0x09,0xff,0x77,0x31,0x1e,0xff,0xd4,0xc4,0xbf,0x6a,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe5,0xf0,0x00,0xfe,0xef,0xf5,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x3e,0xd8,0xc3,0xba,0xf2,0x79,0x34,0x16,0xff,0x6d,0x20,0x00,0xff,0x7a,0x31,0x01,0xff,0x83,0x3a,0x01,0xff,0x8c,0x3f,0x01,0xff,0x91,0x41,0x02,0xff,0x91,0x41,0x02,0xff,0x8b,0x3e,0x01,0xff,0x7b,0x35,0x01,0xff,0x70,0x2f,0x01,0xff,0x63,0x2a,0x02,0xff,0x40,0x19,0x03,0xff,0x65,0x2d,0x03,0xff,0x67,0x30,0x02,0xff,0x6d,0x34,0x00,0xff,0x78,0x37,0x02,0xff,0x57,0x19,0x02,0xff,0x23,0x03,0x01,0xff,0x37,0x0b,0x02,0xff,0x31,0x09,0x01,0xff,0x14,0x05,0x01,0xff,0x06,0x02,0x02,0xff,0x04,0x02,0x02,0xff,0x07,0x02,0x01,0xff,0x05,0x03,0x00,0xff,0x06,0x02,0x01,0xff,0x04,0x01,0x01,0xff,0x01,0x03,0x00,0xff,0x04,0x02,0x01,0xff,0x05,0x02,0x00,0xff,0x0a,0x04,0x01,0xff,0x12,0x07,0x01,0xff,0x2e,0x16,0x03,0xff,0x22,0x10,0x01,0xff,0x09,0x03,0x01,0xff,0x0a,0x03,0x01,0xff,0x10,0x08,0x01,0xff,0x18,0x0c,0x01,0xff,0x13,0x09,0x01,0xff,0x10,0x08,0x02,0xff,0x10,0x09,0x01,0xff,0x15,0x0b,0x01,0xff,0x14,0x0a,0x02,0xff,0x0a,0x06,0x01,0xff,0x03,0x03,0x01,0xff,0x03,0x02,0x01,0xff,0x04,0x02,0x01,0xff,0x05,0x02,0x01,0xff,0x06,0x04,0x00,0xff,0x07,0x04,0x00,0xff,0x07,0x05,0x00,0xff,0x08,0x05,0x01,0xff,0x07,0x05,0x01,0xff,0x07,0x04,0x00,0xff,0x07,0x05,0x00,0xff,0x07,0x04,0x00,0xff,0x07,0x04,0x00,0xff,0x08,0x05,0x01,0xff,0x07,0x05,0x01,0xff,0x06,0x04,0x01,0xff,0x05,0x03,0x02,0xff,0x04,0x03,0x01,0xff,0x04,0x03,0x01,0xff,0x04,0x03,0x02,0xff,0x04,0x02,0x01,0xff,0x04,0x03,0x01,0xff,0x02,0x01,0x00,0xff,0x09,0x08,0x07,0xff,0x1e,0x21,0x1c,0xff,0x26,0x2a,0x24,0xff,0x1e,0x21,0x1d,0xff,0x33,0x39,0x37,0xff,0x47,0x46,0x3a,0xff,0x27,0x16,0x00,0xff,0x29,0x19,0x01,0xff,0x29,0x18,0x03,0xff,0x29,0x19,0x03,0xff,0x2d,0x1a,0x02,0xff,0x32,0x1b,0x02,0xff,0x3c,0x20,0x01,0xff,0x4c,0x28,0x01,0xff,0x58,0x2d,0x01,0xff,0x65,0x32,0x01,0xff,0x76,0x3b,0x02,0xff,0x80,0x3f,0x01,0xff,0x8e,0x43,0x01,0xff,0x97,0x49,0x02,0xff,0x9a,0x4a,0x02,0xff,0x9a,0x49,0x01,0xff,0x98,0x46,0x01,0xff,0x91,0x3f,0x02,0xff,0x86,0x39,0x02,0xff,0x75,0x32,0x02,0xff,0x66,0x2b,0x02,0xff,0x53,0x23,0x01,0xff,0x42,0x1e,0x01,0xff,0x38,0x19,0x01,0xff,0x37,0x19,0x01,0xff,0x40,0x1d,0x02,0xff,0x52,0x24,0x02,0xff,0x6a,0x2e,0x01,0xff,0x85,0x38,0x02,0xff,0x92,0x3e,0x06,0xff,0x97,0x3d,0x0d,0xff,0x99,0x3c,0x10,0xff,0x8a,0x2e,0x07,0xff,0x7a,0x2e,0x15,0xff,0xc7,0xad,0xa6,0x8c,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf2,0xf7,0x00,0xfd,0xe5,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x58,0xcf,0xb5,0xa9,0xfb,0x77,0x31,0x10,0xff,0x72,0x29,0x00,0xff,0x84,0x3b,0x01,0xff,0x8f,0x41,0x01,0xff,0x98,0x46,0x01,0xff,0x9a,0x47,0x02,0xff,0x91,0x42,0x01,0xff,0x7f,0x37,0x02,0xff,0x6f,0x2e,0x01,0xff,0x63,0x29,0x02,0xff,0x40,0x1a,0x02,0xff,0x60,0x2a,0x02,0xff,0x64,0x2e,0x01,0xff,0x6b,0x34,0x02,0xff,0x79,0x37,0x05,0xff,0x51,0x12,0x02,0xff,0x3b,0x08,0x01,0xff,0x41,0x0b,0x01,0xff,0x30,0x09,0x01,0xff,0x0e,0x04,0x02,0xff,0x02,0x02,0x02,0xff,0x07,0x02,0x01,0xff,0x10,0x04,0x01,0xff,0x10,0x04,0x01,0xff,0x0f,0x05,0x01,0xff,0x08,0x04,0x01,0xff,0x04,0x02,0x01,0xff,0x04,0x01,0x01,0xff,0x03,0x00,0x02,0xff,0x18,0x08,0x02,0xff,0x43,0x1d,0x04,0xff,0x3f,0x19,0x04,0xff,0x1f,0x0e,0x00,0xff,0x0f,0x07,0x00,0xff,0x12,0x07,0x01,0xff,0x14,0x09,0x02,0xff,0x15,0x08,0x01,0xff,0x11,0x08,0x01,0xff,0x14,0x0b,0x02,0xff,0x14,0x0b,0x03,0xff,0x0b,0x06,0x01,0xff,0x04,0x02,0x01,0xff,0x04,0x02,0x01,0xff,0x03,0x02,0x01,0xff,0x04,0x02,0x01,0xff,0x07,0x04,0x01,0xff,0x09,0x05,0x02,0xff,0x0a,0x05,0x01,0xff,0x09,0x07,0x00,0xff,0x08,0x06,0x00,0xff,0x08,0x05,0x00,0xff,0x07,0x04,0x01,0xff,0x07,0x05,0x01,0xff,0x07,0x04,0x01,0xff,0x08,0x05,0x01,0xff,0x09,0x06,0x02,0xff,0x09,0x06,0x02,0xff,0x08,0x05,0x01,0xff,0x07,0x04,0x00,0xff,0x05,0x03,0x02,0xff,0x04,0x03,0x01,0xff,0x04,0x03,0x01,0xff,0x04,0x02,0x01,0xff,0x04,0x01,0x01,0xff,0x02,0x01,0x00,0xff,0x0c,0x0d,0x0b,0xff,0x1f,0x23,0x1f,0xff,0x23,0x26,0x22,0xff,0x22,0x25,0x21,0xff,0x24,0x28,0x24,0xff,0x2c,0x31,0x2d,0xff,0x45,0x44,0x38,0xff,0x2c,0x1a,0x04,0xff,0x2b,0x19,0x01,0xff,0x29,0x17,0x01,0xff,0x2a,0x18,0x02,0xff,0x30,0x1b,0x03,0xff,0x35,0x1d,0x03,0xff,0x3d,0x20,0x02,0xff,0x4c,0x27,0x00,0xff,0x59,0x2d,0x01,0xff,0x65,0x33,0x01,0xff,0x73,0x39,0x01,0xff,0x7e,0x3e,0x00,0xff,0x8a,0x43,0x01,0xff,0x92,0x46,0x01,0xff,0x94,0x46,0x01,0xff,0x94,0x46,0x01,0xff,0x8e,0x41,0x01,0xff,0x88,0x3b,0x02,0xff,0x7d,0x36,0x01,0xff,0x71,0x30,0x02,0xff,0x61,0x29,0x01,0xff,0x4e,0x22,0x00,0xff,0x3d,0x1c,0x00,0xff,0x35,0x17,0x01,0xff,0x35,0x18,0x02,0xff,0x41,0x1c,0x02,0xff,0x51,0x24,0x01,0xff,0x6b,0x2f,0x02,0xff,0x86,0x3a,0x03,0xff,0x93,0x3e,0x09,0xff,0x97,0x3f,0x0f,0xff,0x92,0x38,0x06,0xff,0x88,0x32,0x0b,0xff,0xc3,0xa0,0x94,0xa5,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x00,0xfe,0xf6,0xf9,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfe,0xf5,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x6c,0xc5,0xa8,0x98,0xff,0x7b,0x35,0x0a,0xff,0x7f,0x34,0x00,0xff,0x8c,0x41,0x01,0xff,0x95,0x45,0x01,0xff,0x95,0x44,0x01,0xff,0x8d,0x3e,0x00,0xff,0x7d,0x33,0x01,0xff,0x6d,0x2c,0x02,0xff,0x64,0x2a,0x01,0xff,0x3e,0x19,0x02,0xff,0x59,0x28,0x02,0xff,0x60,0x2e,0x02,0xff,0x66,0x30,0x01,0xff,0x79,0x38,0x02,0xff,0x80,0x20,0x03,0xff,0x4e,0x0b,0x02,0xff,0x44,0x08,0x04,0xff,0x2b,0x09,0x02,0xff,0x1e,0x07,0x03,0xff,0x2f,0x08,0x03,0xff,0x4a,0x0c,0x02,0xff,0x53,0x0f,0x01,0xff,0x52,0x0e,0x02,0xff,0x41,0x0d,0x01,0xff,0x24,0x09,0x00,0xff,0x14,0x07,0x00,0xff,0x07,0x03,0x01,0xff,0x01,0x00,0x01,0xff,0x11,0x06,0x02,0xff,0x4b,0x1d,0x03,0xff,0x43,0x1b,0x04,0xff,0x1e,0x0e,0x02,0xff,0x12,0x08,0x01,0xff,0x12,0x07,0x02,0xff,0x15,0x0a,0x00,0xff,0x17,0x0c,0x02,0xff,0x1a,0x0e,0x03,0xff,0x13,0x0b,0x01,0xff,0x08,0x03,0x01,0xff,0x02,0x02,0x01,0xff,0x02,0x03,0x00,0xff,0x05,0x03,0x01,0xff,0x06,0x04,0x01,0xff,0x09,0x05,0x01,0xff,0x0c,0x07,0x01,0xff,0x0a,0x06,0x00,0xff,0x0a,0x06,0x01,0xff,0x0a,0x06,0x01,0xff,0x09,0x05,0x00,0xff,0x0a,0x05,0x00,0xff,0x08,0x04,0x01,0xff,0x08,0x04,0x01,0xff,0x08,0x04,0x01,0xff,0x08,0x05,0x01,0xff,0x08,0x05,0x01,0xff,0x07,0x04,0x01,0xff,0x06,0x03,0x00,0xff,0x06,0x03,0x00,0xff,0x05,0x03,0x01,0xff,0x04,0x03,0x01,0xff,0x04,0x03,0x01,0xff,0x03,0x01,0x00,0xff,0x05,0x04,0x02,0xff,0x11,0x12,0x10,0xff,0x1d,0x21,0x1e,0xff,0x1e,0x24,0x1f,0xff,0x1e,0x22,0x1d,0xff,0x21,0x25,0x20,0xff,0x21,0x24,0x20,0xff,0x2e,0x33,0x31,0xff,0x41,0x41,0x38,0xff,0x2e,0x1c,0x06,0xff,0x2d,0x1a,0x02,0xff,0x2b,0x19,0x02,0xff,0x2c,0x19,0x03,0xff,0x30,0x1b,0x02,0xff,0x38,0x1e,0x02,0xff,0x3f,0x22,0x01,0xff,0x4a,0x26,0x01,0xff,0x5a,0x2e,0x02,0xff,0x66,0x34,0x02,0xff,0x73,0x3a,0x00,0xff,0x80,0x3f,0x01,0xff,0x88,0x42,0x01,0xff,0x8a,0x43,0x00,0xff,0x88,0x41,0x01,0xff,0x88,0x41,0x01,0xff,0x83,0x3d,0x01,0xff,0x7a,0x37,0x02,0xff,0x6e,0x31,0x00,0xff,0x67,0x2c,0x02,0xff,0x5b,0x26,0x02,0xff,0x48,0x1f,0x01,0xff,0x39,0x1a,0x01,0xff,0x33,0x17,0x01,0xff,0x31,0x17,0x01,0xff,0x40,0x1c,0x02,0xff,0x54,0x25,0x00,0xff,0x6e,0x33,0x02,0xff,0x85,0x3b,0x03,0xff,0x92,0x3f,0x0a,0xff,0x95,0x3d,0x0e,0xff,0x92,0x3a,0x0d,0xff,0xc2,0x97,0x82,0xb8,0xfd,0xfd,0xfd,0x0c,0xff,0xff,0xff,0x00,0xff,0xf8,0xfb,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf8,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x79,0xc7,0xa9,0x95,0xff,0x83,0x3b,0x09,0xff,0x84,0x37,0x00,0xff,0x8b,0x3e,0x02,0xff,0x87,0x3b,0x01,0xff,0x80,0x35,0x01,0xff,0x76,0x2f,0x01,0xff,0x6d,0x2b,0x01,0xff,0x65,0x2a,0x02,0xff,0x3f,0x1a,0x03,0xff,0x4f,0x22,0x02,0xff,0x5d,0x2c,0x01,0xff,0x63,0x2f,0x02,0xff,0x9e,0x38,0x03,0xff,0x87,0x1e,0x03,0xff,0x8a,0x1c,0x04,0xff,0x73,0x17,0x03,0xff,0x36,0x09,0x03,0xff,0x36,0x0a,0x03,0xff,0x4a,0x0f,0x03,0xff,0x74,0x14,0x03,0xff,0x51,0x0c,0x01,0xff,0x34,0x09,0x00,0xff,0x20,0x07,0x02,0xff,0x10,0x04,0x00,0xff,0x09,0x03,0x00,0xff,0x05,0x02,0x01,0xff,0x05,0x01,0x01,0xff,0x07,0x02,0x01,0xff,0x31,0x13,0x03,0xff,0x28,0x10,0x02,0xff,0x1a,0x0b,0x03,0xff,0x13,0x08,0x01,0xff,0x15,0x08,0x01,0xff,0x20,0x10,0x02,0xff,0x22,0x12,0x03,0xff,0x0e,0x07,0x02,0xff,0x05,0x01,0x02,0xff,0x04,0x02,0x01,0xff,0x05,0x02,0x00,0xff,0x07,0x04,0x01,0xff,0x09,0x06,0x01,0xff,0x0d,0x09,0x01,0xff,0x0e,0x08,0x01,0xff,0x0d,0x07,0x01,0xff,0x0c,0x06,0x01,0xff,0x0a,0x05,0x01,0xff,0x0b,0x06,0x01,0xff,0x0b,0x06,0x01,0xff,0x0a,0x05,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x05,0x01,0xff,0x0a,0x04,0x01,0xff,0x08,0x04,0x00,0xff,0x06,0x03,0x00,0xff,0x07,0x04,0x01,0xff,0x08,0x06,0x02,0xff,0x09,0x06,0x02,0xff,0x06,0x05,0x03,0xff,0x04,0x02,0x01,0xff,0x03,0x02,0x00,0xff,0x08,0x07,0x05,0xff,0x12,0x11,0x0e,0xff,0x1a,0x1b,0x18,0xff,0x1d,0x21,0x1c,0xff,0x1c,0x21,0x1d,0xff,0x20,0x24,0x1f,0xff,0x20,0x24,0x1f,0xff,0x20,0x23,0x1f,0xff,0x27,0x2d,0x2b,0xff,0x43,0x43,0x3b,0xff,0x2f,0x1c,0x08,0xff,0x2e,0x19,0x01,0xff,0x2c,0x1a,0x02,0xff,0x2d,0x19,0x02,0xff,0x32,0x1c,0x01,0xff,0x3a,0x1f,0x01,0xff,0x40,0x22,0x01,0xff,0x4b,0x26,0x01,0xff,0x58,0x2d,0x01,0xff,0x67,0x35,0x02,0xff,0x76,0x3c,0x01,0xff,0x7f,0x40,0x01,0xff,0x84,0x42,0x01,0xff,0x87,0x42,0x01,0xff,0x81,0x3e,0x01,0xff,0x7e,0x3a,0x01,0xff,0x7b,0x38,0x02,0xff,0x6f,0x32,0x01,0xff,0x65,0x2d,0x01,0xff,0x5b,0x26,0x01,0xff,0x51,0x21,0x00,0xff,0x43,0x1d,0x01,0xff,0x36,0x19,0x02,0xff,0x31,0x16,0x01,0xff,0x2d,0x15,0x00,0xff,0x40,0x1c,0x02,0xff,0x58,0x28,0x02,0xff,0x6d,0x34,0x01,0xff,0x82,0x3b,0x02,0xff,0x8d,0x3b,0x06,0xff,0x91,0x3c,0x0e,0xff,0xc5,0x99,0x82,0xc3,0xfe,0xfc,0xfc,0x12,0xff,0xff,0xff,0x00,0xff,0xf9,0xfb,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe9,0xf0,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf1,0x00,0xff,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x7d,0xc8,0xa8,0x92,0xff,0x86,0x40,0x0b,0xff,0x7f,0x36,0x00,0xff,0x7f,0x36,0x01,0xff,0x7b,0x32,0x02,0xff,0x71,0x2c,0x00,0xff,0x6a,0x29,0x01,0xff,0x64,0x2a,0x02,0xff,0x47,0x1d,0x04,0xff,0x43,0x1c,0x02,0xff,0x5c,0x2b,0x02,0xff,0x64,0x31,0x02,0xff,0x96,0x2f,0x02,0xff,0x82,0x19,0x02,0xff,0x79,0x17,0x01,0xff,0x64,0x12,0x03,0xff,0x3f,0x0b,0x02,0xff,0x4d,0x11,0x04,0xff,0x3e,0x0e,0x03,0xff,0x45,0x0d,0x02,0xff,0x2a,0x07,0x01,0xff,0x1d,0x06,0x01,0xff,0x1d,0x06,0x01,0xff,0x1e,0x06,0x02,0xff,0x22,0x06,0x02,0xff,0x24,0x08,0x02,0xff,0x20,0x08,0x02,0xff,0x17,0x05,0x01,0xff,0x1c,0x0a,0x03,0xff,0x28,0x10,0x01,0xff,0x34,0x18,0x01,0xff,0x33,0x17,0x02,0xff,0x25,0x12,0x03,0xff,0x16,0x0a,0x01,0xff,0x09,0x04,0x00,0xff,0x05,0x03,0x00,0xff,0x05,0x02,0x02,0xff,0x07,0x04,0x01,0xff,0x0a,0x05,0x01,0xff,0x0c,0x07,0x01,0xff,0x0d,0x08,0x00,0xff,0x0e,0x08,0x01,0xff,0x0c,0x07,0x01,0xff,0x0c,0x07,0x00,0xff,0x0c,0x06,0x01,0xff,0x0a,0x06,0x01,0xff,0x0a,0x05,0x02,0xff,0x0a,0x05,0x02,0xff,0x09,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x08,0x05,0x01,0xff,0x07,0x05,0x01,0xff,0x07,0x05,0x01,0xff,0x09,0x06,0x02,0xff,0x09,0x06,0x03,0xff,0x07,0x04,0x00,0xff,0x04,0x03,0x01,0xff,0x05,0x04,0x02,0xff,0x0c,0x0b,0x07,0xff,0x12,0x11,0x0d,0xff,0x11,0x12,0x0e,0xff,0x14,0x18,0x14,0xff,0x1c,0x1f,0x1d,0xff,0x1d,0x21,0x1f,0xff,0x21,0x24,0x20,0xff,0x1f,0x22,0x1e,0xff,0x22,0x25,0x21,0xff,0x29,0x2d,0x29,0xff,0x40,0x40,0x3b,0xff,0x30,0x1e,0x0b,0xff,0x2e,0x19,0x01,0xff,0x2d,0x1a,0x01,0xff,0x2e,0x1a,0x01,0xff,0x32,0x1b,0x01,0xff,0x39,0x1f,0x02,0xff,0x40,0x22,0x00,0xff,0x4a,0x25,0x01,0xff,0x56,0x2d,0x01,0xff,0x65,0x34,0x01,0xff,0x76,0x3c,0x01,0xff,0x80,0x41,0x02,0xff,0x87,0x44,0x01,0xff,0x87,0x44,0x03,0xff,0x7e,0x3b,0x02,0xff,0x7a,0x35,0x02,0xff,0x71,0x32,0x02,0xff,0x65,0x2d,0x01,0xff,0x5c,0x27,0x01,0xff,0x52,0x22,0x01,0xff,0x4a,0x1f,0x02,0xff,0x3e,0x1c,0x01,0xff,0x34,0x17,0x01,0xff,0x2d,0x14,0x01,0xff,0x2e,0x16,0x01,0xff,0x3f,0x1c,0x02,0xff,0x55,0x28,0x01,0xff,0x6b,0x32,0x01,0xff,0x7c,0x36,0x00,0xff,0x8e,0x3e,0x0b,0xff,0xc5,0x99,0x81,0xc6,0xfc,0xfb,0xf9,0x15,0xff,0xff,0xff,0x00,0xff,0xfa,0xfb,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf4,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x7b,0xce,0xb3,0x9c,0xff,0x86,0x43,0x0e,0xff,0x74,0x2d,0x00,0xff,0x74,0x2d,0x01,0xff,0x6d,0x2a,0x00,0xff,0x67,0x28,0x01,0xff,0x5b,0x26,0x01,0xff,0x4f,0x20,0x02,0xff,0x3c,0x19,0x02,0xff,0x5c,0x28,0x02,0xff,0x62,0x2f,0x01,0xff,0x74,0x2d,0x02,0xff,0x6e,0x14,0x02,0xff,0x69,0x0f,0x01,0xff,0x52,0x0e,0x02,0xff,0x39,0x09,0x03,0xff,0x33,0x08,0x02,0xff,0x29,0x07,0x03,0xff,0x4d,0x0f,0x02,0xff,0x5d,0x13,0x01,0xff,0x4e,0x0e,0x02,0xff,0x42,0x0c,0x01,0xff,0x3c,0x0b,0x01,0xff,0x34,0x0a,0x02,0xff,0x28,0x09,0x01,0xff,0x22,0x08,0x01,0xff,0x1c,0x07,0x00,0xff,0x16,0x05,0x00,0xff,0x21,0x0f,0x03,0xff,0x29,0x13,0x02,0xff,0x20,0x0e,0x02,0xff,0x13,0x08,0x02,0xff,0x0b,0x04,0x00,0xff,0x08,0x04,0x01,0xff,0x0a,0x05,0x01,0xff,0x09,0x06,0x01,0xff,0x0a,0x06,0x00,0xff,0x0e,0x08,0x01,0xff,0x0f,0x09,0x01,0xff,0x0f,0x0a,0x00,0xff,0x0f,0x09,0x01,0xff,0x0d,0x07,0x01,0xff,0x0d,0x07,0x01,0xff,0x0c,0x07,0x02,0xff,0x0b,0x07,0x01,0xff,0x0a,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x07,0x04,0x01,0xff,0x08,0x05,0x01,0xff,0x08,0x05,0x01,0xff,0x07,0x04,0x00,0xff,0x07,0x04,0x01,0xff,0x06,0x04,0x00,0xff,0x09,0x07,0x04,0xff,0x0d,0x0c,0x08,0xff,0x11,0x10,0x0b,0xff,0x10,0x0f,0x0b,0xff,0x10,0x12,0x0d,0xff,0x16,0x19,0x17,0xff,0x1f,0x22,0x1f,0xff,0x20,0x24,0x21,0xff,0x1e,0x23,0x1e,0xff,0x1f,0x23,0x1e,0xff,0x20,0x24,0x1f,0xff,0x29,0x2c,0x27,0xff,0x3e,0x3f,0x3b,0xff,0x32,0x22,0x0e,0xff,0x2f,0x1a,0x00,0xff,0x30,0x1b,0x03,0xff,0x2f,0x1b,0x03,0xff,0x32,0x1b,0x02,0xff,0x36,0x1d,0x02,0xff,0x3f,0x22,0x01,0xff,0x49,0x26,0x01,0xff,0x56,0x2c,0x02,0xff,0x62,0x33,0x02,0xff,0x6e,0x39,0x01,0xff,0x7a,0x40,0x02,0xff,0x7f,0x42,0x01,0xff,0x7e,0x3f,0x04,0xff,0x76,0x37,0x04,0xff,0x6f,0x32,0x03,0xff,0x65,0x2c,0x03,0xff,0x58,0x26,0x03,0xff,0x54,0x23,0x02,0xff,0x4d,0x21,0x02,0xff,0x48,0x1e,0x01,0xff,0x3f,0x1b,0x02,0xff,0x36,0x18,0x03,0xff,0x2f,0x16,0x02,0xff,0x30,0x16,0x01,0xff,0x40,0x1c,0x02,0xff,0x50,0x24,0x00,0xff,0x64,0x2b,0x00,0xff,0x7d,0x3b,0x06,0xff,0xc7,0xa1,0x87,0xc3,0xfe,0xfd,0xfc,0x15,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xfa,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf1,0x00,0xff,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x70,0xd1,0xb9,0xa7,0xfd,0x7b,0x3c,0x19,0xff,0x62,0x1e,0x00,0xff,0x64,0x24,0x00,0xff,0x5e,0x22,0x01,0xff,0x58,0x22,0x00,0xff,0x57,0x21,0x01,0xff,0x3f,0x1b,0x02,0xff,0x55,0x25,0x01,0xff,0x62,0x2d,0x01,0xff,0x6a,0x33,0x02,0xff,0x76,0x2a,0x04,0xff,0x6c,0x11,0x03,0xff,0x71,0x17,0x02,0xff,0x73,0x15,0x03,0xff,0x71,0x14,0x03,0xff,0x53,0x10,0x03,0xff,0x48,0x0d,0x02,0xff,0x4d,0x0c,0x01,0xff,0x34,0x0a,0x00,0xff,0x34,0x0a,0x01,0xff,0x34,0x09,0x01,0xff,0x2e,0x08,0x01,0xff,0x23,0x07,0x00,0xff,0x1d,0x06,0x01,0xff,0x1c,0x07,0x01,0xff,0x18,0x06,0x01,0xff,0x18,0x07,0x02,0xff,0x16,0x08,0x01,0xff,0x14,0x0a,0x01,0xff,0x16,0x0a,0x01,0xff,0x0e,0x07,0x01,0xff,0x0e,0x08,0x01,0xff,0x0d,0x07,0x02,0xff,0x0a,0x05,0x01,0xff,0x0d,0x07,0x01,0xff,0x0f,0x08,0x01,0xff,0x10,0x09,0x00,0xff,0x0f,0x09,0x00,0xff,0x10,0x09,0x00,0xff,0x0e,0x07,0x01,0xff,0x0d,0x07,0x01,0xff,0x0c,0x06,0x01,0xff,0x0a,0x06,0x01,0xff,0x0a,0x05,0x01,0xff,0x0a,0x05,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x08,0x04,0x01,0xff,0x07,0x04,0x01,0xff,0x08,0x04,0x01,0xff,0x07,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x0a,0x05,0x02,0xff,0x0d,0x0a,0x06,0xff,0x12,0x11,0x0c,0xff,0x0e,0x0d,0x0a,0xff,0x10,0x0f,0x0b,0xff,0x12,0x13,0x0f,0xff,0x13,0x16,0x13,0xff,0x19,0x1c,0x1a,0xff,0x1a,0x1e,0x1c,0xff,0x1c,0x20,0x1c,0xff,0x1e,0x22,0x1d,0xff,0x20,0x24,0x1f,0xff,0x28,0x2c,0x26,0xff,0x3a,0x3d,0x38,0xff,0x38,0x29,0x15,0xff,0x2e,0x19,0x00,0xff,0x30,0x1c,0x02,0xff,0x2d,0x1a,0x01,0xff,0x30,0x1b,0x02,0xff,0x35,0x1d,0x01,0xff,0x3d,0x20,0x01,0xff,0x47,0x23,0x01,0xff,0x54,0x2a,0x02,0xff,0x5e,0x31,0x02,0xff,0x66,0x36,0x01,0xff,0x6f,0x3b,0x01,0xff,0x71,0x3b,0x03,0xff,0x70,0x39,0x04,0xff,0x6c,0x34,0x05,0xff,0x63,0x2d,0x04,0xff,0x5b,0x28,0x03,0xff,0x51,0x23,0x02,0xff,0x50,0x21,0x02,0xff,0x4e,0x20,0x02,0xff,0x4c,0x21,0x02,0xff,0x46,0x1f,0x03,0xff,0x3c,0x1b,0x03,0xff,0x34,0x17,0x01,0xff,0x33,0x18,0x01,0xff,0x42,0x1c,0x02,0xff,0x4b,0x1d,0x00,0xff,0x69,0x36,0x0e,0xff,0xc3,0xa7,0x90,0xb8,0xff,0xfd,0xfd,0x12,0xff,0xff,0xff,0x00,0xff,0xf9,0xfb,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xff,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x5f,0xd7,0xc7,0xbe,0xf4,0x74,0x3e,0x23,0xff,0x55,0x16,0x00,0xff,0x57,0x1e,0x00,0xff,0x56,0x20,0x01,0xff,0x52,0x20,0x01,0xff,0x59,0x22,0x04,0xff,0x51,0x20,0x04,0xff,0x5c,0x2b,0x01,0xff,0x62,0x30,0x01,0xff,0x73,0x39,0x01,0xff,0x77,0x25,0x02,0xff,0x54,0x0b,0x01,0xff,0x4d,0x0d,0x01,0xff,0x4c,0x0e,0x01,0xff,0x34,0x0b,0x01,0xff,0x1e,0x05,0x01,0xff,0x29,0x08,0x00,0xff,0x2d,0x08,0x01,0xff,0x36,0x0b,0x02,0xff,0x33,0x0a,0x01,0xff,0x2e,0x08,0x01,0xff,0x24,0x08,0x01,0xff,0x1f,0x07,0x00,0xff,0x1b,0x07,0x00,0xff,0x16,0x05,0x01,0xff,0x11,0x03,0x01,0xff,0x0c,0x02,0x01,0xff,0x1e,0x0c,0x01,0xff,0x1e,0x0e,0x01,0xff,0x0d,0x07,0x01,0xff,0x0c,0x07,0x01,0xff,0x0c,0x06,0x01,0xff,0x0c,0x06,0x01,0xff,0x0f,0x07,0x01,0xff,0x10,0x08,0x00,0xff,0x12,0x09,0x00,0xff,0x10,0x09,0x00,0xff,0x10,0x08,0x01,0xff,0x0e,0x07,0x01,0xff,0x0c,0x07,0x01,0xff,0x0b,0x06,0x01,0xff,0x0a,0x04,0x01,0xff,0x0a,0x05,0x02,0xff,0x0a,0x05,0x02,0xff,0x09,0x04,0x01,0xff,0x08,0x05,0x02,0xff,0x08,0x05,0x01,0xff,0x07,0x05,0x01,0xff,0x08,0x05,0x01,0xff,0x09,0x05,0x00,0xff,0x0a,0x06,0x01,0xff,0x0c,0x08,0x01,0xff,0x0d,0x09,0x02,0xff,0x0f,0x0d,0x07,0xff,0x12,0x11,0x0b,0xff,0x0f,0x0e,0x09,0xff,0x11,0x11,0x0d,0xff,0x12,0x13,0x0f,0xff,0x13,0x15,0x12,0xff,0x1b,0x1c,0x1a,0xff,0x1b,0x1e,0x1b,0xff,0x1c,0x20,0x1b,0xff,0x1e,0x22,0x1d,0xff,0x1e,0x22,0x1d,0xff,0x24,0x29,0x24,0xff,0x36,0x3b,0x34,0xff,0x38,0x2c,0x1b,0xff,0x2d,0x18,0x00,0xff,0x2d,0x1b,0x01,0xff,0x2d,0x19,0x01,0xff,0x30,0x1a,0x02,0xff,0x32,0x1c,0x01,0xff,0x3a,0x1d,0x01,0xff,0x42,0x1f,0x01,0xff,0x4f,0x26,0x02,0xff,0x58,0x2c,0x01,0xff,0x5f,0x31,0x01,0xff,0x66,0x35,0x01,0xff,0x66,0x35,0x01,0xff,0x66,0x34,0x03,0xff,0x63,0x30,0x04,0xff,0x5b,0x2a,0x03,0xff,0x54,0x26,0x02,0xff,0x50,0x22,0x01,0xff,0x52,0x23,0x02,0xff,0x52,0x24,0x02,0xff,0x4f,0x23,0x02,0xff,0x4e,0x23,0x03,0xff,0x48,0x21,0x02,0xff,0x3c,0x1c,0x01,0xff,0x37,0x18,0x00,0xff,0x3b,0x13,0x00,0xff,0x5c,0x31,0x14,0xff,0xc7,0xb5,0xa7,0xa5,0xff,0xff,0xff,0x0c,0xff,0xff,0xff,0x00,0xff,0xf9,0xfc,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xf5,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x45,0xe2,0xd8,0xd3,0xe7,0x81,0x55,0x3f,0xff,0x51,0x18,0x00,0xff,0x54,0x1d,0x00,0xff,0x53,0x1f,0x01,0xff,0x59,0x22,0x02,0xff,0x6f,0x27,0x05,0xff,0x58,0x27,0x02,0xff,0x5f,0x30,0x01,0xff,0x6a,0x33,0x03,0xff,0x78,0x27,0x01,0xff,0x61,0x0f,0x02,0xff,0x3e,0x0b,0x01,0xff,0x31,0x0a,0x01,0xff,0x2e,0x09,0x02,0xff,0x1e,0x06,0x02,0xff,0x2c,0x0a,0x01,0xff,0x2d,0x0a,0x01,0xff,0x2e,0x0a,0x01,0xff,0x2e,0x0b,0x01,0xff,0x2d,0x09,0x01,0xff,0x25,0x09,0x01,0xff,0x1e,0x07,0x00,0xff,0x1a,0x07,0x01,0xff,0x14,0x04,0x00,0xff,0x12,0x04,0x01,0xff,0x0c,0x03,0x00,0xff,0x1b,0x0a,0x00,0xff,0x23,0x0f,0x01,0xff,0x0e,0x07,0x00,0xff,0x0b,0x05,0x00,0xff,0x0b,0x05,0x00,0xff,0x0c,0x07,0x01,0xff,0x10,0x08,0x01,0xff,0x11,0x09,0x00,0xff,0x12,0x09,0x00,0xff,0x11,0x08,0x00,0xff,0x0f,0x07,0x01,0xff,0x0e,0x07,0x01,0xff,0x0d,0x07,0x00,0xff,0x0a,0x06,0x00,0xff,0x09,0x05,0x02,0xff,0x0a,0x05,0x02,0xff,0x0a,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x05,0x02,0xff,0x08,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x0a,0x06,0x01,0xff,0x0a,0x06,0x01,0xff,0x0b,0x07,0x02,0xff,0x0a,0x06,0x01,0xff,0x09,0x06,0x01,0xff,0x09,0x06,0x02,0xff,0x0d,0x0c,0x07,0xff,0x0c,0x0a,0x07,0xff,0x12,0x12,0x0e,0xff,0x11,0x13,0x0e,0xff,0x16,0x17,0x13,0xff,0x19,0x1b,0x16,0xff,0x1b,0x1e,0x1a,0xff,0x1d,0x21,0x1c,0xff,0x1d,0x20,0x1c,0xff,0x1b,0x1e,0x1a,0xff,0x20,0x22,0x20,0xff,0x34,0x35,0x32,0xff,0x3e,0x33,0x26,0xff,0x2d,0x16,0x00,0xff,0x2d,0x19,0x01,0xff,0x2a,0x18,0x02,0xff,0x31,0x1a,0x01,0xff,0x3d,0x20,0x00,0xff,0x45,0x24,0x01,0xff,0x4c,0x26,0x01,0xff,0x52,0x2a,0x01,0xff,0x58,0x2e,0x01,0xff,0x5e,0x31,0x02,0xff,0x60,0x31,0x01,0xff,0x60,0x33,0x01,0xff,0x5f,0x32,0x03,0xff,0x5b,0x2c,0x02,0xff,0x55,0x28,0x01,0xff,0x4f,0x23,0x01,0xff,0x50,0x24,0x02,0xff,0x52,0x25,0x03,0xff,0x57,0x27,0x02,0xff,0x58,0x27,0x02,0xff,0x59,0x27,0x03,0xff,0x53,0x25,0x02,0xff,0x48,0x1f,0x00,0xff,0x3a,0x13,0x00,0xff,0x63,0x43,0x2d,0xff,0xd3,0xc7,0xc0,0x89,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x00,0xff,0xf8,0xfa,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xfb,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x2a,0xf0,0xeb,0xe8,0xce,0x96,0x74,0x62,0xff,0x52,0x1a,0x00,0xff,0x50,0x18,0x00,0xff,0x51,0x1e,0x01,0xff,0x69,0x27,0x05,0xff,0x6b,0x29,0x08,0xff,0x58,0x2b,0x01,0xff,0x64,0x31,0x03,0xff,0x69,0x25,0x01,0xff,0x60,0x0f,0x00,0xff,0x4a,0x0d,0x02,0xff,0x33,0x0c,0x01,0xff,0x2b,0x0b,0x01,0xff,0x29,0x0a,0x02,0xff,0x31,0x0c,0x01,0xff,0x31,0x0b,0x00,0xff,0x2e,0x0a,0x01,0xff,0x2b,0x09,0x01,0xff,0x2c,0x09,0x01,0xff,0x24,0x07,0x01,0xff,0x1c,0x07,0x01,0xff,0x16,0x06,0x00,0xff,0x14,0x06,0x00,0xff,0x11,0x05,0x01,0xff,0x0f,0x04,0x01,0xff,0x17,0x08,0x02,0xff,0x24,0x10,0x01,0xff,0x11,0x07,0x01,0xff,0x0d,0x06,0x00,0xff,0x0b,0x05,0x00,0xff,0x0d,0x07,0x01,0xff,0x11,0x09,0x01,0xff,0x13,0x09,0x01,0xff,0x13,0x0a,0x01,0xff,0x12,0x0a,0x01,0xff,0x12,0x09,0x02,0xff,0x11,0x08,0x02,0xff,0x0e,0x07,0x00,0xff,0x0a,0x06,0x01,0xff,0x08,0x05,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x0a,0x05,0x01,0xff,0x0a,0x05,0x00,0xff,0x0a,0x06,0x01,0xff,0x0a,0x07,0x02,0xff,0x08,0x05,0x00,0xff,0x07,0x04,0x01,0xff,0x07,0x03,0x01,0xff,0x07,0x03,0x01,0xff,0x05,0x03,0x01,0xff,0x07,0x07,0x04,0xff,0x0a,0x09,0x05,0xff,0x0e,0x0e,0x0a,0xff,0x11,0x12,0x0e,0xff,0x15,0x16,0x12,0xff,0x1a,0x1b,0x17,0xff,0x1b,0x1e,0x1a,0xff,0x1d,0x20,0x1b,0xff,0x1a,0x1e,0x19,0xff,0x1b,0x1f,0x1b,0xff,0x20,0x22,0x1e,0xff,0x2d,0x31,0x2d,0xff,0x42,0x36,0x27,0xff,0x33,0x19,0x00,0xff,0x2e,0x1a,0x01,0xff,0x2f,0x1a,0x01,0xff,0x46,0x21,0x01,0xff,0x5b,0x2b,0x01,0xff,0x60,0x2d,0x01,0xff,0x65,0x30,0x01,0xff,0x65,0x32,0x01,0xff,0x62,0x33,0x01,0xff,0x5e,0x32,0x00,0xff,0x5c,0x2f,0x01,0xff,0x5b,0x2f,0x01,0xff,0x58,0x2c,0x01,0xff,0x55,0x2a,0x01,0xff,0x53,0x26,0x01,0xff,0x50,0x23,0x01,0xff,0x54,0x25,0x02,0xff,0x5a,0x28,0x03,0xff,0x61,0x2a,0x02,0xff,0x63,0x2a,0x02,0xff,0x66,0x2c,0x06,0xff,0x5e,0x25,0x01,0xff,0x51,0x1c,0x00,0xff,0x80,0x60,0x4c,0xf5,0xe4,0xde,0xda,0x66,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf9,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xfb,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xef,0xf5,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x11,0xfc,0xfb,0xfb,0xa5,0xb4,0x9b,0x8f,0xff,0x60,0x2d,0x13,0xff,0x48,0x15,0x00,0xff,0x51,0x1e,0x02,0xff,0x6d,0x2b,0x08,0xff,0x64,0x28,0x04,0xff,0x5b,0x2b,0x01,0xff,0x6b,0x28,0x02,0xff,0x63,0x12,0x01,0xff,0x41,0x0d,0x02,0xff,0x29,0x0a,0x02,0xff,0x26,0x09,0x01,0xff,0x2f,0x0a,0x01,0xff,0x33,0x0c,0x00,0xff,0x32,0x0d,0x01,0xff,0x2d,0x0a,0x01,0xff,0x2c,0x0a,0x01,0xff,0x2b,0x0a,0x01,0xff,0x25,0x08,0x02,0xff,0x1d,0x07,0x02,0xff,0x16,0x04,0x00,0xff,0x14,0x05,0x01,0xff,0x11,0x04,0x00,0xff,0x0e,0x04,0x00,0xff,0x0d,0x04,0x02,0xff,0x23,0x0f,0x01,0xff,0x16,0x09,0x00,0xff,0x0e,0x06,0x01,0xff,0x0d,0x05,0x00,0xff,0x0f,0x07,0x00,0xff,0x12,0x09,0x00,0xff,0x16,0x0a,0x00,0xff,0x16,0x0b,0x01,0xff,0x13,0x0b,0x00,0xff,0x11,0x09,0x00,0xff,0x11,0x08,0x01,0xff,0x0f,0x07,0x01,0xff,0x0b,0x06,0x00,0xff,0x08,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x05,0x01,0xff,0x09,0x06,0x01,0xff,0x08,0x04,0x01,0xff,0x08,0x04,0x00,0xff,0x06,0x04,0x00,0xff,0x05,0x03,0x01,0xff,0x05,0x02,0x01,0xff,0x07,0x05,0x01,0xff,0x09,0x07,0x02,0xff,0x0d,0x0d,0x07,0xff,0x0e,0x0d,0x0a,0xff,0x0e,0x0e,0x0a,0xff,0x12,0x13,0x0f,0xff,0x12,0x14,0x10,0xff,0x18,0x1b,0x17,0xff,0x1b,0x1f,0x1a,0xff,0x1c,0x20,0x1c,0xff,0x1a,0x1e,0x19,0xff,0x1c,0x20,0x1a,0xff,0x23,0x26,0x20,0xff,0x27,0x2c,0x2a,0xff,0x48,0x39,0x26,0xff,0x41,0x1f,0x00,0xff,0x3c,0x1e,0x01,0xff,0x48,0x23,0x01,0xff,0x65,0x2e,0x01,0xff,0x78,0x35,0x01,0xff,0x7f,0x38,0x02,0xff,0x84,0x3d,0x01,0xff,0x87,0x3f,0x02,0xff,0x83,0x3f,0x02,0xff,0x75,0x3b,0x01,0xff,0x69,0x36,0x01,0xff,0x60,0x31,0x02,0xff,0x5a,0x2c,0x01,0xff,0x56,0x2a,0x01,0xff,0x57,0x28,0x02,0xff,0x56,0x25,0x01,0xff,0x5a,0x26,0x02,0xff,0x62,0x2a,0x02,0xff,0x67,0x2c,0x03,0xff,0x69,0x2d,0x05,0xff,0x6a,0x29,0x04,0xff,0x6f,0x33,0x10,0xff,0xac,0x8d,0x7a,0xdc,0xf7,0xf4,0xf3,0x3d,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xfe,0xf1,0xf6,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xfb,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xeb,0xf3,0x00,0xff,0xfb,0xfc,0x00,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x6f,0xd6,0xca,0xc3,0xf5,0x73,0x4c,0x36,0xff,0x46,0x13,0x00,0xff,0x53,0x1c,0x01,0xff,0x61,0x25,0x05,0xff,0x58,0x28,0x00,0xff,0x68,0x2a,0x02,0xff,0x58,0x13,0x02,0xff,0x38,0x0a,0x01,0xff,0x2d,0x0a,0x01,0xff,0x30,0x0a,0x01,0xff,0x2f,0x0a,0x02,0xff,0x2c,0x09,0x01,0xff,0x2b,0x0a,0x01,0xff,0x2b,0x0b,0x01,0xff,0x2b,0x0b,0x01,0xff,0x28,0x09,0x01,0xff,0x21,0x07,0x01,0xff,0x1a,0x06,0x00,0xff,0x15,0x05,0x01,0xff,0x11,0x04,0x01,0xff,0x0f,0x04,0x01,0xff,0x0a,0x03,0x00,0xff,0x06,0x01,0x01,0xff,0x20,0x0d,0x03,0xff,0x1b,0x0c,0x01,0xff,0x0d,0x05,0x01,0xff,0x0d,0x05,0x00,0xff,0x11,0x07,0x01,0xff,0x16,0x0a,0x00,0xff,0x18,0x0b,0x01,0xff,0x16,0x0a,0x02,0xff,0x13,0x09,0x01,0xff,0x11,0x09,0x01,0xff,0x10,0x09,0x01,0xff,0x0f,0x07,0x01,0xff,0x0b,0x05,0x01,0xff,0x09,0x03,0x00,0xff,0x08,0x03,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x05,0x02,0xff,0x09,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x07,0x03,0x01,0xff,0x07,0x04,0x01,0xff,0x07,0x04,0x00,0xff,0x09,0x06,0x02,0xff,0x0c,0x08,0x03,0xff,0x0d,0x09,0x04,0xff,0x10,0x0e,0x08,0xff,0x0e,0x0e,0x0a,0xff,0x0c,0x0d,0x08,0xff,0x11,0x12,0x0e,0xff,0x12,0x14,0x10,0xff,0x15,0x18,0x14,0xff,0x1a,0x1d,0x19,0xff,0x1b,0x1e,0x1a,0xff,0x1b,0x1e,0x1a,0xff,0x1c,0x1f,0x1a,0xff,0x23,0x25,0x1f,0xff,0x23,0x28,0x25,0xff,0x48,0x3a,0x25,0xff,0x4e,0x26,0x00,0xff,0x52,0x27,0x01,0xff,0x67,0x2f,0x02,0xff,0x83,0x3a,0x01,0xff,0x93,0x42,0x01,0xff,0x9e,0x48,0x01,0xff,0xa8,0x4e,0x01,0xff,0xa9,0x50,0x01,0xff,0xa6,0x50,0x01,0xff,0x95,0x49,0x01,0xff,0x82,0x42,0x01,0xff,0x70,0x39,0x02,0xff,0x67,0x33,0x01,0xff,0x5f,0x2d,0x01,0xff,0x60,0x2b,0x02,0xff,0x5f,0x27,0x01,0xff,0x5f,0x26,0x01,0xff,0x63,0x29,0x01,0xff,0x64,0x27,0x00,0xff,0x63,0x23,0x00,0xff,0x82,0x4d,0x2e,0xff,0xd3,0xbe,0xb4,0xaf,0xff,0xff,0xff,0x1a,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xed,0xf4,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xff,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x37,0xee,0xea,0xe8,0xce,0x9c,0x82,0x72,0xff,0x56,0x28,0x0c,0xff,0x4b,0x18,0x00,0xff,0x52,0x23,0x01,0xff,0x5e,0x26,0x03,0xff,0x58,0x16,0x03,0xff,0x44,0x0e,0x01,0xff,0x42,0x0f,0x00,0xff,0x3e,0x0d,0x01,0xff,0x34,0x0b,0x01,0xff,0x29,0x08,0x01,0xff,0x2a,0x09,0x01,0xff,0x2b,0x0a,0x01,0xff,0x2b,0x0b,0x01,0xff,0x27,0x0a,0x01,0xff,0x1e,0x07,0x01,0xff,0x16,0x06,0x00,0xff,0x11,0x04,0x00,0xff,0x0d,0x03,0x00,0xff,0x0a,0x02,0x01,0xff,0x08,0x02,0x00,0xff,0x04,0x00,0x01,0xff,0x17,0x09,0x03,0xff,0x21,0x0d,0x01,0xff,0x11,0x06,0x00,0xff,0x10,0x06,0x00,0xff,0x12,0x07,0x01,0xff,0x1a,0x0a,0x01,0xff,0x19,0x0a,0x00,0xff,0x17,0x0a,0x00,0xff,0x16,0x0a,0x01,0xff,0x14,0x09,0x01,0xff,0x11,0x09,0x01,0xff,0x0d,0x07,0x00,0xff,0x0b,0x05,0x00,0xff,0x0a,0x04,0x01,0xff,0x0a,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x08,0x04,0x00,0xff,0x0a,0x05,0x02,0xff,0x0b,0x06,0x02,0xff,0x0c,0x07,0x02,0xff,0x0c,0x06,0x03,0xff,0x09,0x05,0x02,0xff,0x07,0x03,0x01,0xff,0x05,0x04,0x01,0xff,0x09,0x09,0x05,0xff,0x0b,0x0c,0x08,0xff,0x10,0x12,0x0e,0xff,0x14,0x15,0x11,0xff,0x16,0x17,0x13,0xff,0x19,0x1b,0x17,0xff,0x1b,0x1c,0x1a,0xff,0x1c,0x1d,0x1a,0xff,0x1f,0x21,0x1c,0xff,0x23,0x24,0x20,0xff,0x21,0x25,0x21,0xff,0x4c,0x3e,0x2d,0xff,0x5a,0x2c,0x04,0xff,0x63,0x30,0x01,0xff,0x7e,0x39,0x01,0xff,0x9a,0x46,0x00,0xff,0xa7,0x4d,0x01,0xff,0xb3,0x53,0x01,0xff,0xbf,0x5c,0x01,0xff,0xc2,0x60,0x00,0xff,0xb8,0x5b,0x01,0xff,0xa4,0x51,0x01,0xff,0x95,0x4a,0x01,0xff,0x83,0x42,0x01,0xff,0x74,0x39,0x01,0xff,0x69,0x30,0x02,0xff,0x67,0x2c,0x01,0xff,0x65,0x29,0x02,0xff,0x63,0x25,0x01,0xff,0x5e,0x1e,0x00,0xff,0x66,0x2a,0x05,0xff,0xa0,0x79,0x61,0xf2,0xeb,0xe2,0xdd,0x71,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x00,0xff,0xf9,0xfb,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x0c,0xff,0xff,0xff,0x8b,0xcc,0xc0,0xb7,0xf9,0x73,0x50,0x35,0xff,0x51,0x1e,0x00,0xff,0x5e,0x25,0x00,0xff,0x70,0x21,0x02,0xff,0x5c,0x12,0x02,0xff,0x4e,0x11,0x01,0xff,0x46,0x0e,0x01,0xff,0x38,0x0c,0x02,0xff,0x2b,0x09,0x00,0xff,0x2c,0x0a,0x02,0xff,0x2a,0x09,0x00,0xff,0x29,0x09,0x01,0xff,0x24,0x09,0x01,0xff,0x1d,0x07,0x01,0xff,0x16,0x05,0x01,0xff,0x0f,0x04,0x01,0xff,0x0b,0x03,0x00,0xff,0x08,0x02,0x01,0xff,0x09,0x03,0x01,0xff,0x05,0x02,0x02,0xff,0x0f,0x05,0x02,0xff,0x28,0x0f,0x01,0xff,0x17,0x09,0x00,0xff,0x14,0x07,0x01,0xff,0x16,0x08,0x01,0xff,0x1b,0x0a,0x01,0xff,0x1b,0x0a,0x01,0xff,0x18,0x0b,0x01,0xff,0x17,0x09,0x01,0xff,0x15,0x08,0x00,0xff,0x11,0x07,0x00,0xff,0x0d,0x06,0x00,0xff,0x0b,0x05,0x00,0xff,0x09,0x05,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x04,0x01,0xff,0x0a,0x05,0x01,0xff,0x0b,0x05,0x00,0xff,0x0c,0x06,0x01,0xff,0x0e,0x07,0x02,0xff,0x0e,0x08,0x02,0xff,0x0c,0x07,0x01,0xff,0x08,0x05,0x01,0xff,0x07,0x04,0x01,0xff,0x06,0x03,0x01,0xff,0x04,0x02,0x01,0xff,0x02,0x03,0x01,0xff,0x09,0x07,0x04,0xff,0x0a,0x09,0x06,0xff,0x11,0x12,0x0e,0xff,0x14,0x14,0x10,0xff,0x14,0x16,0x12,0xff,0x15,0x17,0x12,0xff,0x19,0x1a,0x17,0xff,0x1d,0x1d,0x1c,0xff,0x1e,0x1f,0x1b,0xff,0x21,0x20,0x1f,0xff,0x1d,0x21,0x1e,0xff,0x4c,0x41,0x35,0xff,0x63,0x31,0x0a,0xff,0x6e,0x32,0x00,0xff,0x8c,0x3e,0x02,0xff,0xab,0x4d,0x01,0xff,0xba,0x56,0x00,0xff,0xc5,0x60,0x01,0xff,0xd0,0x6a,0x01,0xff,0xcf,0x6a,0x00,0xff,0xc1,0x61,0x01,0xff,0xae,0x56,0x01,0xff,0xa2,0x50,0x01,0xff,0x90,0x48,0x01,0xff,0x7c,0x3c,0x01,0xff,0x6c,0x31,0x01,0xff,0x6a,0x2e,0x01,0xff,0x63,0x25,0x00,0xff,0x5c,0x1d,0x00,0xff,0x79,0x44,0x26,0xff,0xc7,0xb1,0xa3,0xc3,0xfd,0xfc,0xfb,0x30,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xfe,0xf3,0xf7,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xeb,0xf3,0x00,0xff,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x3d,0xf2,0xee,0xeb,0xcb,0xac,0x94,0x82,0xff,0x6c,0x3c,0x18,0xff,0x74,0x1e,0x00,0xff,0x5a,0x0e,0x00,0xff,0x4a,0x0f,0x01,0xff,0x42,0x0d,0x01,0xff,0x36,0x0a,0x01,0xff,0x2a,0x09,0x01,0xff,0x2a,0x09,0x00,0xff,0x2a,0x09,0x01,0xff,0x25,0x08,0x00,0xff,0x1d,0x07,0x00,0xff,0x1a,0x06,0x01,0xff,0x16,0x06,0x01,0xff,0x12,0x06,0x01,0xff,0x0d,0x04,0x00,0xff,0x0a,0x03,0x01,0xff,0x0a,0x04,0x01,0xff,0x09,0x03,0x01,0xff,0x0b,0x03,0x00,0xff,0x25,0x0d,0x02,0xff,0x1f,0x0a,0x01,0xff,0x14,0x07,0x01,0xff,0x1a,0x09,0x01,0xff,0x1d,0x0b,0x01,0xff,0x1a,0x09,0x00,0xff,0x18,0x09,0x00,0xff,0x19,0x0a,0x01,0xff,0x17,0x09,0x01,0xff,0x12,0x08,0x00,0xff,0x0e,0x06,0x00,0xff,0x0b,0x05,0x01,0xff,0x0a,0x05,0x02,0xff,0x0a,0x04,0x01,0xff,0x0b,0x05,0x01,0xff,0x0c,0x06,0x01,0xff,0x0b,0x05,0x00,0xff,0x0d,0x07,0x02,0xff,0x0c,0x06,0x02,0xff,0x0b,0x05,0x01,0xff,0x08,0x04,0x00,0xff,0x05,0x03,0x01,0xff,0x04,0x02,0x01,0xff,0x06,0x02,0x00,0xff,0x08,0x05,0x01,0xff,0x0a,0x08,0x04,0xff,0x10,0x0e,0x0a,0xff,0x0b,0x0a,0x07,0xff,0x0e,0x0e,0x0a,0xff,0x11,0x13,0x0e,0xff,0x11,0x12,0x0e,0xff,0x11,0x13,0x0e,0xff,0x17,0x17,0x15,0xff,0x1c,0x1c,0x1a,0xff,0x1d,0x1d,0x1b,0xff,0x1f,0x1e,0x1d,0xff,0x1e,0x24,0x21,0xff,0x43,0x3e,0x36,0xff,0x66,0x35,0x0f,0xff,0x75,0x34,0x00,0xff,0x94,0x43,0x02,0xff,0xb2,0x52,0x01,0xff,0xc1,0x5e,0x02,0xff,0xce,0x68,0x01,0xff,0xda,0x72,0x02,0xff,0xd5,0x6f,0x01,0xff,0xc6,0x66,0x00,0xff,0xba,0x5d,0x02,0xff,0xad,0x55,0x01,0xff,0x9c,0x4c,0x01,0xff,0x81,0x3d,0x01,0xff,0x6c,0x2e,0x00,0xff,0x65,0x24,0x00,0xff,0x6e,0x33,0x0f,0xff,0xa7,0x84,0x6f,0xef,0xed,0xe5,0xe1,0x73,0xff,0xff,0xff,0x07,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x08,0xff,0xff,0xff,0x73,0xe2,0xd9,0xd2,0xea,0xaf,0x77,0x5e,0xff,0x68,0x1c,0x0a,0xff,0x43,0x06,0x00,0xff,0x3f,0x0b,0x00,0xff,0x35,0x0c,0x01,0xff,0x2c,0x09,0x00,0xff,0x27,0x09,0x00,0xff,0x29,0x09,0x01,0xff,0x27,0x0a,0x01,0xff,0x1d,0x07,0x00,0xff,0x15,0x06,0x00,0xff,0x13,0x06,0x00,0xff,0x12,0x06,0x00,0xff,0x0f,0x05,0x01,0xff,0x0c,0x04,0x01,0xff,0x0b,0x03,0x00,0xff,0x0b,0x03,0x00,0xff,0x08,0x02,0x00,0xff,0x1e,0x0b,0x02,0xff,0x25,0x0c,0x02,0xff,0x15,0x07,0x01,0xff,0x1c,0x0a,0x00,0xff,0x21,0x0c,0x01,0xff,0x20,0x0b,0x01,0xff,0x1d,0x0c,0x01,0xff,0x1c,0x0b,0x01,0xff,0x19,0x0b,0x02,0xff,0x12,0x08,0x01,0xff,0x0d,0x05,0x01,0xff,0x0d,0x06,0x01,0xff,0x0b,0x05,0x01,0xff,0x0c,0x06,0x01,0xff,0x0d,0x06,0x01,0xff,0x0d,0x06,0x01,0xff,0x0d,0x06,0x01,0xff,0x0c,0x06,0x01,0xff,0x09,0x04,0x01,0xff,0x07,0x02,0x01,0xff,0x06,0x03,0x01,0xff,0x06,0x02,0x01,0xff,0x05,0x02,0x02,0xff,0x09,0x05,0x01,0xff,0x0f,0x0a,0x02,0xff,0x0e,0x0a,0x04,0xff,0x0e,0x0d,0x08,0xff,0x0c,0x0c,0x06,0xff,0x0f,0x0f,0x09,0xff,0x10,0x11,0x0e,0xff,0x0f,0x10,0x0e,0xff,0x10,0x10,0x0e,0xff,0x13,0x15,0x13,0xff,0x1b,0x1d,0x1a,0xff,0x21,0x23,0x20,0xff,0x1d,0x1f,0x1c,0xff,0x1e,0x23,0x20,0xff,0x32,0x35,0x2f,0xff,0x65,0x3a,0x1b,0xff,0x78,0x33,0x00,0xff,0x9a,0x46,0x01,0xff,0xb3,0x53,0x01,0xff,0xc0,0x5d,0x01,0xff,0xcf,0x6a,0x01,0xff,0xd8,0x72,0x01,0xff,0xd9,0x72,0x01,0xff,0xcd,0x6b,0x01,0xff,0xbf,0x62,0x01,0xff,0xb5,0x5a,0x01,0xff,0xa0,0x4c,0x00,0xff,0x7f,0x34,0x00,0xff,0x75,0x33,0x04,0xff,0x9b,0x6c,0x4c,0xfe,0xdb,0xcc,0xc3,0xa9,0xff,0xff,0xff,0x25,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xfe,0xf4,0xf8,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xea,0xf2,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x1d,0xff,0xfe,0xfd,0x98,0xd7,0xc3,0xbe,0xf7,0x82,0x58,0x4f,0xff,0x45,0x11,0x06,0xff,0x2d,0x01,0x00,0xff,0x2c,0x07,0x00,0xff,0x28,0x09,0x01,0xff,0x29,0x09,0x01,0xff,0x29,0x0a,0x01,0xff,0x1e,0x07,0x01,0xff,0x14,0x05,0x01,0xff,0x10,0x04,0x01,0xff,0x0f,0x04,0x00,0xff,0x0d,0x03,0x00,0xff,0x0d,0x03,0x01,0xff,0x0c,0x03,0x01,0xff,0x0d,0x04,0x01,0xff,0x0d,0x04,0x01,0xff,0x1c,0x08,0x01,0xff,0x24,0x0d,0x02,0xff,0x18,0x07,0x01,0xff,0x21,0x0c,0x02,0xff,0x22,0x0d,0x01,0xff,0x20,0x0b,0x00,0xff,0x20,0x0d,0x01,0xff,0x1f,0x0c,0x01,0xff,0x19,0x0a,0x01,0xff,0x12,0x07,0x01,0xff,0x0e,0x06,0x01,0xff,0x0d,0x05,0x00,0xff,0x0d,0x05,0x01,0xff,0x0f,0x05,0x01,0xff,0x0f,0x06,0x01,0xff,0x10,0x07,0x01,0xff,0x0e,0x06,0x01,0xff,0x0b,0x05,0x01,0xff,0x09,0x04,0x02,0xff,0x07,0x03,0x02,0xff,0x06,0x03,0x01,0xff,0x06,0x03,0x01,0xff,0x07,0x04,0x02,0xff,0x0a,0x06,0x01,0xff,0x0a,0x06,0x00,0xff,0x06,0x04,0x02,0xff,0x0a,0x08,0x05,0xff,0x0e,0x0d,0x0a,0xff,0x10,0x0e,0x0c,0xff,0x10,0x10,0x0e,0xff,0x0d,0x0d,0x0b,0xff,0x0f,0x10,0x0e,0xff,0x12,0x15,0x12,0xff,0x18,0x1b,0x17,0xff,0x1e,0x22,0x1d,0xff,0x1d,0x22,0x1d,0xff,0x24,0x28,0x25,0xff,0x2b,0x32,0x2f,0xff,0x5e,0x38,0x22,0xff,0x76,0x30,0x00,0xff,0x9a,0x45,0x01,0xff,0xb0,0x51,0x01,0xff,0xbe,0x5b,0x00,0xff,0xcd,0x68,0x01,0xff,0xd7,0x70,0x01,0xff,0xd7,0x70,0x02,0xff,0xc9,0x69,0x02,0xff,0xbd,0x5f,0x00,0xff,0xb3,0x53,0x00,0xff,0xa0,0x4b,0x02,0xff,0xa6,0x6d,0x40,0xff,0xd6,0xbe,0xae,0xc7,0xfc,0xfa,0xf9,0x46,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xf8,0xfb,0x00,0xfe,0xec,0xf3,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xee,0xf4,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x30,0xfc,0xfa,0xfa,0xa9,0xc8,0xb8,0xb5,0xfb,0x6c,0x50,0x4a,0xff,0x32,0x0f,0x08,0xff,0x25,0x00,0x00,0xff,0x29,0x06,0x00,0xff,0x27,0x08,0x00,0xff,0x1b,0x06,0x01,0xff,0x12,0x04,0x00,0xff,0x10,0x04,0x00,0xff,0x10,0x05,0x00,0xff,0x0f,0x04,0x00,0xff,0x0e,0x04,0x00,0xff,0x0f,0x04,0x01,0xff,0x11,0x05,0x01,0xff,0x17,0x09,0x01,0xff,0x18,0x08,0x01,0xff,0x23,0x0c,0x02,0xff,0x21,0x0b,0x01,0xff,0x23,0x0c,0x02,0xff,0x23,0x0c,0x00,0xff,0x1f,0x0b,0x01,0xff,0x1f,0x0c,0x01,0xff,0x1e,0x0c,0x00,0xff,0x16,0x09,0x01,0xff,0x0f,0x06,0x01,0xff,0x0d,0x05,0x00,0xff,0x0c,0x05,0x01,0xff,0x0f,0x07,0x01,0xff,0x10,0x07,0x00,0xff,0x0e,0x06,0x01,0xff,0x0d,0x05,0x01,0xff,0x0c,0x05,0x01,0xff,0x0a,0x05,0x01,0xff,0x09,0x04,0x01,0xff,0x09,0x03,0x01,0xff,0x06,0x03,0x01,0xff,0x09,0x04,0x01,0xff,0x0c,0x06,0x01,0xff,0x0d,0x06,0x01,0xff,0x0b,0x06,0x00,0xff,0x0a,0x09,0x03,0xff,0x0f,0x0c,0x08,0xff,0x10,0x0e,0x0c,0xff,0x0d,0x0c,0x0b,0xff,0x0d,0x0c,0x0a,0xff,0x0a,0x08,0x07,0xff,0x0e,0x0f,0x0d,0xff,0x16,0x18,0x15,0xff,0x17,0x1a,0x17,0xff,0x1d,0x21,0x1c,0xff,0x21,0x25,0x20,0xff,0x24,0x26,0x24,0xff,0x25,0x2d,0x2a,0xff,0x57,0x39,0x25,0xff,0x73,0x2c,0x00,0xff,0x98,0x41,0x01,0xff,0xae,0x4f,0x01,0xff,0xbe,0x5b,0x00,0xff,0xcf,0x6a,0x00,0xff,0xd9,0x70,0x01,0xff,0xd5,0x6a,0x00,0xff,0xc4,0x5f,0x00,0xff,0xbf,0x62,0x04,0xff,0xc9,0x81,0x3d,0xff,0xde,0xc0,0xa6,0xd2,0xfa,0xf7,0xf5,0x5c,0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xef,0xf6,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xef,0xf6,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x35,0xfa,0xfa,0xfa,0xa7,0xc9,0xbf,0xbd,0xf7,0x81,0x64,0x5d,0xff,0x44,0x1c,0x13,0xff,0x20,0x00,0x00,0xff,0x16,0x00,0x00,0xff,0x12,0x03,0x00,0xff,0x13,0x06,0x00,0xff,0x13,0x05,0x00,0xff,0x12,0x04,0x00,0xff,0x12,0x05,0x01,0xff,0x15,0x06,0x00,0xff,0x19,0x08,0x01,0xff,0x1b,0x08,0x01,0xff,0x0c,0x04,0x01,0xff,0x14,0x06,0x02,0xff,0x28,0x0e,0x03,0xff,0x28,0x0f,0x01,0xff,0x27,0x0f,0x02,0xff,0x20,0x0c,0x01,0xff,0x20,0x0c,0x01,0xff,0x1d,0x0c,0x00,0xff,0x15,0x08,0x01,0xff,0x0e,0x05,0x01,0xff,0x0d,0x05,0x00,0xff,0x0e,0x06,0x00,0xff,0x11,0x08,0x00,0xff,0x11,0x07,0x01,0xff,0x11,0x07,0x01,0xff,0x0f,0x06,0x01,0xff,0x0c,0x05,0x01,0xff,0x0a,0x04,0x01,0xff,0x09,0x03,0x01,0xff,0x07,0x03,0x00,0xff,0x0a,0x05,0x01,0xff,0x10,0x07,0x01,0xff,0x12,0x09,0x01,0xff,0x10,0x09,0x02,0xff,0x0b,0x07,0x02,0xff,0x08,0x05,0x01,0xff,0x0b,0x0a,0x06,0xff,0x0e,0x0d,0x0b,0xff,0x0d,0x0c,0x0a,0xff,0x0d,0x0b,0x09,0xff,0x0e,0x0c,0x0b,0xff,0x10,0x10,0x0f,0xff,0x16,0x17,0x15,0xff,0x18,0x1a,0x18,0xff,0x1d,0x1e,0x1a,0xff,0x23,0x23,0x1f,0xff,0x20,0x22,0x1f,0xff,0x1c,0x22,0x20,0xff,0x4f,0x36,0x27,0xff,0x6f,0x27,0x03,0xff,0x97,0x3d,0x01,0xff,0xb2,0x4f,0x02,0xff,0xc5,0x5e,0x00,0xff,0xd6,0x68,0x00,0xff,0xdb,0x6b,0x00,0xff,0xd8,0x74,0x0d,0xff,0xdb,0x96,0x50,0xff,0xec,0xcf,0xb0,0xce,0xfc,0xf9,0xf5,0x5e,0xff,0xff,0xff,0x08,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x2c,0xff,0xff,0xff,0x92,0xda,0xd2,0xd1,0xea,0x8c,0x7c,0x79,0xff,0x42,0x2d,0x29,0xff,0x1b,0x06,0x02,0xff,0x0e,0x00,0x00,0xff,0x0f,0x01,0x00,0xff,0x13,0x03,0x00,0xff,0x16,0x05,0x01,0xff,0x1a,0x07,0x01,0xff,0x1a,0x08,0x01,0xff,0x12,0x06,0x00,0xff,0x06,0x02,0x02,0xff,0x04,0x02,0x01,0xff,0x1f,0x0b,0x03,0xff,0x2c,0x10,0x01,0xff,0x21,0x0c,0x01,0xff,0x1d,0x0a,0x00,0xff,0x1e,0x0c,0x00,0xff,0x1d,0x0b,0x01,0xff,0x13,0x07,0x02,0xff,0x0d,0x05,0x00,0xff,0x0d,0x04,0x01,0xff,0x10,0x07,0x01,0xff,0x14,0x09,0x01,0xff,0x12,0x08,0x01,0xff,0x11,0x07,0x01,0xff,0x10,0x07,0x01,0xff,0x0d,0x06,0x01,0xff,0x09,0x05,0x01,0xff,0x08,0x04,0x00,0xff,0x09,0x05,0x00,0xff,0x10,0x07,0x00,0xff,0x16,0x0a,0x00,0xff,0x12,0x0a,0x01,0xff,0x0a,0x06,0x01,0xff,0x05,0x04,0x02,0xff,0x05,0x03,0x02,0xff,0x07,0x05,0x03,0xff,0x0a,0x09,0x07,0xff,0x09,0x0a,0x07,0xff,0x0a,0x09,0x07,0xff,0x0d,0x0b,0x09,0xff,0x14,0x14,0x12,0xff,0x17,0x18,0x16,0xff,0x18,0x19,0x16,0xff,0x17,0x18,0x14,0xff,0x1e,0x1f,0x1a,0xff,0x20,0x22,0x1e,0xff,0x1a,0x1c,0x1c,0xff,0x44,0x2f,0x25,0xff,0x6c,0x25,0x04,0xff,0x95,0x38,0x00,0xff,0xb3,0x48,0x00,0xff,0xca,0x5d,0x00,0xff,0xe0,0x7d,0x21,0xff,0xed,0xab,0x6c,0xfb,0xf6,0xde,0xc5,0xb9,0xfe,0xfd,0xfb,0x50,0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf3,0xf7,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfe,0xf0,0xf5,0x00,0xff,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x17,0xff,0xff,0xff,0x6b,0xed,0xeb,0xeb,0xc8,0xb7,0xaf,0xad,0xfd,0x6f,0x60,0x5d,0xff,0x33,0x21,0x1d,0xff,0x16,0x02,0x00,0xff,0x13,0x00,0x00,0xff,0x18,0x02,0x00,0xff,0x15,0x04,0x00,0xff,0x0b,0x02,0x01,0xff,0x05,0x02,0x01,0xff,0x02,0x03,0x00,0xff,0x0c,0x03,0x01,0xff,0x29,0x0e,0x03,0xff,0x20,0x0b,0x01,0xff,0x20,0x0b,0x00,0xff,0x1f,0x0c,0x00,0xff,0x19,0x0a,0x01,0xff,0x10,0x06,0x01,0xff,0x0c,0x04,0x00,0xff,0x0d,0x05,0x01,0xff,0x10,0x07,0x01,0xff,0x13,0x09,0x01,0xff,0x12,0x08,0x00,0xff,0x11,0x08,0x01,0xff,0x0f,0x07,0x00,0xff,0x0d,0x05,0x00,0xff,0x09,0x04,0x02,0xff,0x0b,0x05,0x01,0xff,0x12,0x08,0x00,0xff,0x1a,0x0c,0x00,0xff,0x16,0x0a,0x01,0xff,0x0a,0x05,0x01,0xff,0x04,0x03,0x01,0xff,0x04,0x03,0x02,0xff,0x04,0x03,0x02,0xff,0x06,0x05,0x02,0xff,0x0e,0x0d,0x08,0xff,0x0c,0x0b,0x08,0xff,0x08,0x07,0x05,0xff,0x0e,0x0d,0x0b,0xff,0x14,0x15,0x13,0xff,0x15,0x16,0x13,0xff,0x14,0x15,0x11,0xff,0x13,0x15,0x11,0xff,0x18,0x1a,0x16,0xff,0x1e,0x1f,0x1c,0xff,0x17,0x1a,0x19,0xff,0x37,0x26,0x1f,0xff,0x6c,0x26,0x02,0xff,0x9f,0x4a,0x15,0xff,0xcf,0x87,0x52,0xff,0xed,0xc5,0xa2,0xe3,0xfb,0xef,0xe3,0x90,0xff,0xff,0xff,0x33,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf1,0xf6,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xed,0xf4,0x00,0xff,0xf7,0xfa,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x37,0xff,0xff,0xff,0x8c,0xe4,0xe0,0xdf,0xd8,0xad,0xa2,0xa0,0xfd,0x73,0x5e,0x59,0xff,0x40,0x2b,0x24,0xff,0x10,0x08,0x04,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x17,0x09,0x03,0xff,0x28,0x0c,0x02,0xff,0x23,0x0b,0x01,0xff,0x20,0x0d,0x02,0xff,0x15,0x09,0x00,0xff,0x0e,0x05,0x01,0xff,0x0d,0x05,0x01,0xff,0x0e,0x06,0x01,0xff,0x11,0x07,0x00,0xff,0x15,0x09,0x01,0xff,0x14,0x08,0x01,0xff,0x13,0x08,0x01,0xff,0x0f,0x07,0x00,0xff,0x0c,0x05,0x02,0xff,0x0b,0x04,0x01,0xff,0x14,0x08,0x01,0xff,0x20,0x0f,0x02,0xff,0x1a,0x0c,0x00,0xff,0x09,0x05,0x00,0xff,0x03,0x03,0x01,0xff,0x04,0x03,0x01,0xff,0x05,0x03,0x01,0xff,0x06,0x05,0x03,0xff,0x0c,0x0b,0x06,0xff,0x14,0x13,0x0d,0xff,0x0e,0x0d,0x09,0xff,0x0b,0x0a,0x06,0xff,0x13,0x11,0x0e,0xff,0x13,0x14,0x10,0xff,0x14,0x15,0x11,0xff,0x10,0x12,0x0e,0xff,0x0a,0x0c,0x07,0xff,0x0f,0x10,0x0c,0xff,0x1f,0x20,0x1c,0xff,0x37,0x3a,0x36,0xff,0x7a,0x73,0x6e,0xff,0xc6,0xa9,0x9c,0xec,0xee,0xdf,0xd6,0xac,0xff,0xfe,0xfe,0x56,0xff,0xff,0xff,0x10,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xf8,0xfb,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xea,0xf1,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x09,0xff,0xff,0xff,0x3d,0xff,0xff,0xff,0x87,0xea,0xe8,0xe7,0xcb,0xba,0xb9,0xb9,0xf8,0x80,0x7f,0x7e,0xff,0x4a,0x49,0x48,0xff,0x1e,0x1c,0x1a,0xff,0x08,0x06,0x04,0xff,0x00,0x00,0x00,0xff,0x18,0x05,0x00,0xff,0x20,0x05,0x00,0xff,0x16,0x03,0x00,0xff,0x0b,0x01,0x00,0xff,0x09,0x02,0x00,0xff,0x0d,0x04,0x00,0xff,0x12,0x07,0x00,0xff,0x18,0x09,0x01,0xff,0x1b,0x0a,0x01,0xff,0x1a,0x0a,0x01,0xff,0x19,0x0b,0x01,0xff,0x14,0x09,0x00,0xff,0x12,0x08,0x00,0xff,0x18,0x0a,0x00,0xff,0x21,0x0e,0x01,0xff,0x1b,0x0c,0x00,0xff,0x0a,0x04,0x00,0xff,0x02,0x02,0x01,0xff,0x03,0x02,0x01,0xff,0x04,0x02,0x01,0xff,0x04,0x02,0x00,0xff,0x05,0x04,0x01,0xff,0x06,0x06,0x01,0xff,0x11,0x11,0x0b,0xff,0x07,0x06,0x02,0xff,0x05,0x04,0x01,0xff,0x09,0x08,0x04,0xff,0x0a,0x0b,0x07,0xff,0x18,0x1a,0x15,0xff,0x2c,0x2d,0x29,0xff,0x4e,0x50,0x4c,0xff,0x81,0x82,0x7f,0xfe,0xba,0xba,0xb9,0xdf,0xe3,0xe4,0xe3,0xa3,0xfe,0xfe,0xfe,0x59,0xff,0xff,0xff,0x18,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xf3,0xf7,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xec,0xf3,0x00,0xfe,0xf3,0xf8,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x26,0xff,0xff,0xff,0x60,0xfc,0xfc,0xfc,0x9c,0xdf,0xdf,0xdf,0xd0,0xbe,0xbb,0xb9,0xf3,0x91,0x8d,0x8c,0xff,0x72,0x68,0x63,0xff,0x62,0x4b,0x40,0xff,0x39,0x29,0x21,0xff,0x25,0x18,0x11,0xff,0x1c,0x0d,0x04,0xff,0x12,0x03,0x00,0xff,0x11,0x02,0x00,0xff,0x12,0x00,0x00,0xff,0x11,0x01,0x00,0xff,0x0d,0x00,0x00,0xff,0x0b,0x00,0x00,0xff,0x0e,0x00,0x00,0xff,0x16,0x05,0x00,0xff,0x1b,0x07,0x00,0xff,0x0d,0x01,0x00,0xff,0x01,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x08,0x07,0x03,0xff,0x1e,0x1d,0x19,0xff,0x2b,0x29,0x25,0xff,0x47,0x47,0x43,0xff,0x67,0x67,0x64,0xff,0x8d,0x8e,0x8b,0xfc,0xb9,0xba,0xb8,0xdf,0xdd,0xdd,0xdc,0xb2,0xfb,0xfb,0xfb,0x77,0xff,0xff,0xff,0x3b,0xff,0xff,0xff,0x0d,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xed,0xf4,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe4,0xee,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xee,0xf5,0x00,0xff,0xf5,0xf9,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x04,0xff,0xff,0xff,0x20,0xff,0xff,0xff,0x48,0xff,0xff,0xff,0x75,0xfc,0xfb,0xfb,0xa0,0xe9,0xe7,0xe6,0xc3,0xd4,0xd1,0xcf,0xe1,0xc5,0xbf,0xbb,0xf1,0xac,0xa5,0xa0,0xfe,0x94,0x8c,0x86,0xff,0x83,0x78,0x72,0xff,0x72,0x67,0x60,0xff,0x64,0x59,0x52,0xff,0x59,0x4d,0x46,0xff,0x52,0x46,0x3c,0xff,0x51,0x42,0x37,0xff,0x44,0x3b,0x36,0xff,0x39,0x37,0x36,0xff,0x3b,0x3c,0x3b,0xff,0x45,0x45,0x44,0xff,0x53,0x52,0x4f,0xff,0x63,0x61,0x5f,0xff,0x75,0x73,0x70,0xff,0x8a,0x86,0x84,0xff,0xa2,0xa0,0x9d,0xf7,0xbd,0xbb,0xb9,0xe7,0xd1,0xd0,0xcf,0xd0,0xe4,0xe4,0xe3,0xad,0xf9,0xf9,0xf9,0x87,0xff,0xff,0xff,0x58,0xff,0xff,0xff,0x30,0xff,0xff,0xff,0x0b,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xff,0xf6,0xf9,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe4,0xee,0x00,0xfd,0xe4,0xee,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfe,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfd,0x00,0xff,0xfd,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xfc,0xfd,0x00,0xfe,0xfc,0xfd,0x00,0xfe,0xfb,0xfd,0x00,0xfe,0xfb,0xfd,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf8,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xf7,0xfa,0x00,0xff,0xf6,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xf7,0xfa,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x0e,0xff,0xff,0xff,0x20,0xff,0xff,0xff,0x32,0xff,0xff,0xff,0x4c,0xff,0xff,0xff,0x60,0xff,0xff,0xff,0x71,0xff,0xff,0xff,0x7f,0xff,0xff,0xff,0x8a,0xff,0xff,0xff,0x92,0xfe,0xfe,0xfe,0x97,0xfd,0xfe,0xfe,0x98,0xfe,0xfe,0xfe,0x94,0xff,0xff,0xff,0x8e,0xff,0xff,0xff,0x83,0xff,0xff,0xff,0x77,0xff,0xff,0xff,0x66,0xff,0xff,0xff,0x54,0xff,0xff,0xff,0x3c,0xff,0xff,0xff,0x26,0xff,0xff,0xff,0x15,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfb,0xfc,0x00,0xff,0xf7,0xfa,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xf6,0xfa,0x00,0xff,0xf6,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfb,0xfc,0x00,0xfe,0xfb,0xfd,0x00,0xfe,0xfc,0xfd,0x00,0xfe,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfd,0x00,0xff,0xfd,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+};
+
+const lv_image_dsc_t img_lv_demo_music_cover_1 = {
+    .header.w = 176,
+    .header.h = 175,
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .data = img_lv_demo_music_cover_1_map,
+    .data_size = sizeof(img_lv_demo_music_cover_1_map),
+};
+
+#endif /*LV_USE_DEMO_MUSIC*/
@@ -0,0 +1,196 @@
+#include "../lv_demo_music.h"
+#if LV_USE_DEMO_MUSIC  && !LV_DEMO_MUSIC_LARGE
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t img_lv_demo_music_cover_2_map[] = {
+  /*Pixel format: Fix 0xFF: 8 bit, Red: 8 bit, Green: 8 bit, Blue: 8 bit*/
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xf9,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf8,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfd,0xf2,0xf6,0x00,0xfd,0xf1,0xf6,0x00,0xfd,0xf0,0xf6,0x00,0xfd,0xf0,0xf6,0x00,0xfd,0xf0,0xf6,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf5,0xf9,0x00,0xff,0xf9,0xfc,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x13,0xff,0xff,0xff,0x25,0xff,0xff,0xff,0x3f,0xff,0xff,0xff,0x66,0xff,0xff,0xff,0x78,0xff,0xff,0xff,0x84,0xfe,0xfe,0xfe,0x97,0xfb,0xfb,0xfb,0xac,0xfa,0xfa,0xfa,0xc0,0xf8,0xf8,0xf9,0xce,0xf8,0xf8,0xf8,0xd1,0xf8,0xf8,0xf8,0xd0,0xf9,0xf9,0xf9,0xd0,0xfb,0xfb,0xfb,0xc6,0xfc,0xfc,0xfc,0xb4,0xff,0xff,0xff,0x9f,0xff,0xff,0xff,0x8b,0xff,0xff,0xff,0x7c,0xff,0xff,0xff,0x70,0xff,0xff,0xff,0x4e,0xff,0xff,0xff,0x2d,0xff,0xff,0xff,0x1b,0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfe,0x00,0xfe,0xf8,0xfa,0x00,0xfe,0xf3,0xf8,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xf0,0xf6,0x00,0xfd,0xf0,0xf6,0x00,0xfd,0xf1,0xf6,0x00,0xfd,0xf1,0xf6,0x00,0xfd,0xf2,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xef,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe4,0xee,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe9,0xf1,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x16,0xff,0xff,0xff,0x45,0xff,0xff,0xff,0x6f,0xfb,0xfb,0xfb,0xa6,0xe5,0xe4,0xe4,0xc3,0xcc,0xcb,0xcb,0xe9,0xb9,0xb7,0xb7,0xfc,0x98,0x96,0x97,0xff,0x7e,0x7a,0x7b,0xff,0x6b,0x69,0x69,0xff,0x5a,0x58,0x58,0xff,0x4c,0x4a,0x4a,0xff,0x41,0x3f,0x3f,0xff,0x3b,0x39,0x3a,0xff,0x34,0x31,0x31,0xff,0x33,0x2f,0x30,0xff,0x37,0x32,0x33,0xff,0x36,0x33,0x33,0xff,0x3a,0x39,0x39,0xff,0x46,0x44,0x44,0xff,0x53,0x4f,0x50,0xff,0x61,0x5e,0x5f,0xff,0x72,0x6f,0x70,0xff,0x89,0x87,0x86,0xff,0xa7,0xa6,0xa5,0xff,0xbc,0xbb,0xbb,0xfe,0xd4,0xd4,0xd4,0xf4,0xf0,0xef,0xef,0xd0,0xfe,0xfe,0xfe,0xb4,0xff,0xff,0xff,0x84,0xff,0xff,0xff,0x54,0xff,0xff,0xff,0x27,0xff,0xff,0xff,0x06,0xff,0xfe,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xed,0xf3,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe4,0xee,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xeb,0xf3,0x00,0xfe,0xf2,0xf6,0x00,0xfe,0xf9,0xfc,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x14,0xff,0xff,0xff,0x4a,0xfc,0xfc,0xfc,0x8c,0xe3,0xe3,0xe3,0xc6,0xbf,0xbd,0xbd,0xf0,0x95,0x92,0x92,0xfe,0x6c,0x6a,0x6a,0xff,0x45,0x42,0x42,0xff,0x22,0x1e,0x1e,0xff,0x19,0x15,0x14,0xff,0x10,0x0a,0x0a,0xff,0x01,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x03,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x03,0x00,0x00,0xff,0x05,0x01,0x00,0xff,0x04,0x00,0x00,0xff,0x03,0x00,0x00,0xff,0x01,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x00,0x00,0xff,0x12,0x0b,0x0a,0xff,0x15,0x10,0x11,0xff,0x1a,0x15,0x16,0xff,0x32,0x2c,0x2d,0xff,0x58,0x53,0x54,0xff,0x7a,0x77,0x77,0xff,0xa8,0xa6,0xa6,0xff,0xd0,0xcf,0xce,0xf7,0xef,0xef,0xee,0xda,0xff,0xff,0xff,0xa2,0xff,0xff,0xff,0x64,0xff,0xff,0xff,0x26,0xff,0xff,0xff,0x02,0xff,0xfd,0xfe,0x00,0xfe,0xf6,0xfa,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe9,0xf1,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x1d,0xff,0xff,0xff,0x64,0xee,0xed,0xed,0xb2,0xbe,0xbc,0xbb,0xeb,0x87,0x83,0x83,0xff,0x50,0x4b,0x4b,0xff,0x29,0x22,0x23,0xff,0x12,0x0a,0x0c,0xff,0x04,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x04,0x01,0x00,0xff,0x0d,0x09,0x06,0xff,0x11,0x0b,0x0a,0xff,0x09,0x05,0x06,0xff,0x0a,0x07,0x07,0xff,0x13,0x0e,0x0f,0xff,0x12,0x0c,0x0d,0xff,0x0e,0x08,0x08,0xff,0x0e,0x07,0x08,0xff,0x0f,0x08,0x07,0xff,0x12,0x0c,0x0a,0xff,0x0a,0x05,0x05,0xff,0x08,0x03,0x04,0xff,0x0d,0x08,0x09,0xff,0x08,0x06,0x06,0xff,0x0a,0x07,0x06,0xff,0x0f,0x0b,0x0c,0xff,0x18,0x13,0x14,0xff,0x10,0x0a,0x0b,0xff,0x0d,0x06,0x06,0xff,0x0f,0x08,0x07,0xff,0x0d,0x07,0x07,0xff,0x0a,0x05,0x06,0xff,0x08,0x01,0x01,0xff,0x07,0x00,0x01,0xff,0x03,0x00,0x00,0xff,0x13,0x0d,0x0d,0xff,0x22,0x1d,0x1a,0xff,0x35,0x32,0x30,0xff,0x5f,0x5c,0x5c,0xff,0x96,0x95,0x95,0xff,0xce,0xce,0xce,0xf8,0xf7,0xf7,0xf7,0xcb,0xff,0xff,0xff,0x82,0xff,0xff,0xff,0x36,0xff,0xff,0xff,0x05,0xff,0xfd,0xfe,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xed,0xf4,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xec,0xf3,0x00,0xff,0xf5,0xf9,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x12,0xff,0xff,0xff,0x5d,0xe9,0xe8,0xe7,0xb6,0xbc,0xb8,0xb6,0xf3,0x84,0x7d,0x78,0xff,0x46,0x3f,0x39,0xff,0x1f,0x18,0x15,0xff,0x0d,0x06,0x04,0xff,0x0b,0x05,0x03,0xff,0x13,0x0c,0x0b,0xff,0x13,0x0d,0x0d,0xff,0x09,0x05,0x06,0xff,0x04,0x02,0x03,0xff,0x05,0x01,0x02,0xff,0x0b,0x05,0x06,0xff,0x13,0x0d,0x0c,0xff,0x1a,0x11,0x11,0xff,0x0a,0x06,0x08,0xff,0x08,0x05,0x04,0xff,0x15,0x0f,0x0c,0xff,0x12,0x0c,0x0a,0xff,0x0b,0x07,0x06,0xff,0x0b,0x06,0x07,0xff,0x07,0x03,0x03,0xff,0x09,0x04,0x05,0xff,0x0d,0x08,0x08,0xff,0x08,0x04,0x04,0xff,0x07,0x03,0x03,0xff,0x08,0x04,0x04,0xff,0x0a,0x05,0x06,0xff,0x13,0x0c,0x0d,0xff,0x18,0x10,0x11,0xff,0x0e,0x08,0x09,0xff,0x08,0x03,0x04,0xff,0x04,0x01,0x02,0xff,0x06,0x03,0x03,0xff,0x0d,0x08,0x08,0xff,0x16,0x10,0x0e,0xff,0x17,0x10,0x0f,0xff,0x0d,0x05,0x05,0xff,0x1f,0x18,0x17,0xff,0x18,0x12,0x11,0xff,0x09,0x02,0x01,0xff,0x00,0x00,0x00,0xff,0x0d,0x0a,0x0b,0xff,0x2f,0x2a,0x2a,0xff,0x60,0x5c,0x5d,0xff,0x91,0x90,0x90,0xff,0xc6,0xc5,0xc5,0xfe,0xf5,0xf5,0xf5,0xd2,0xff,0xff,0xff,0x80,0xff,0xff,0xff,0x2a,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf2,0xf7,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xef,0xf5,0x00,0xff,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x33,0xf3,0xf3,0xf3,0x96,0xc2,0xbf,0xbd,0xe7,0x83,0x7c,0x77,0xff,0x50,0x46,0x40,0xff,0x37,0x2d,0x25,0xff,0x30,0x26,0x20,0xff,0x23,0x19,0x14,0xff,0x16,0x0f,0x0c,0xff,0x14,0x0d,0x0c,0xff,0x13,0x0c,0x0c,0xff,0x11,0x0c,0x0c,0xff,0x08,0x03,0x04,0xff,0x04,0x02,0x02,0xff,0x05,0x01,0x01,0xff,0x08,0x04,0x04,0xff,0x0d,0x08,0x08,0xff,0x1c,0x13,0x12,0xff,0x1a,0x11,0x10,0xff,0x0e,0x0a,0x09,0xff,0x07,0x03,0x03,0xff,0x0a,0x05,0x05,0xff,0x0d,0x08,0x08,0xff,0x0c,0x07,0x08,0xff,0x0b,0x06,0x07,0xff,0x0a,0x05,0x06,0xff,0x07,0x03,0x03,0xff,0x0a,0x05,0x06,0xff,0x0a,0x07,0x07,0xff,0x04,0x02,0x02,0xff,0x0b,0x07,0x07,0xff,0x0c,0x07,0x08,0xff,0x0f,0x09,0x0a,0xff,0x0b,0x05,0x06,0xff,0x04,0x01,0x02,0xff,0x07,0x05,0x05,0xff,0x0b,0x07,0x08,0xff,0x0e,0x08,0x09,0xff,0x0d,0x06,0x05,0xff,0x23,0x1b,0x19,0xff,0x1c,0x14,0x11,0xff,0x20,0x18,0x15,0xff,0x1e,0x16,0x13,0xff,0x14,0x0d,0x0b,0xff,0x0f,0x09,0x07,0xff,0x0f,0x09,0x08,0xff,0x2e,0x2a,0x29,0xff,0x3d,0x37,0x36,0xff,0x22,0x1b,0x1b,0xff,0x19,0x14,0x14,0xff,0x27,0x23,0x23,0xff,0x47,0x44,0x44,0xff,0x90,0x8d,0x8e,0xff,0xd0,0xcf,0xcf,0xf8,0xfb,0xfb,0xfb,0xb9,0xff,0xff,0xff,0x58,0xff,0xff,0xff,0x0a,0xff,0xfd,0xfe,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xec,0xf3,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xef,0xf5,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x05,0xff,0xff,0xff,0x4e,0xe0,0xdf,0xde,0xb9,0xa2,0x9d,0x99,0xfc,0x60,0x5a,0x53,0xff,0x3b,0x30,0x29,0xff,0x31,0x25,0x1e,0xff,0x34,0x29,0x22,0xff,0x39,0x30,0x28,0xff,0x33,0x2a,0x24,0xff,0x20,0x17,0x13,0xff,0x16,0x0f,0x0f,0xff,0x10,0x09,0x0a,0xff,0x17,0x10,0x11,0xff,0x0a,0x05,0x06,0xff,0x06,0x02,0x04,0xff,0x05,0x02,0x03,0xff,0x09,0x05,0x05,0xff,0x0c,0x07,0x07,0xff,0x09,0x04,0x05,0xff,0x0c,0x06,0x08,0xff,0x11,0x0c,0x0b,0xff,0x10,0x09,0x08,0xff,0x16,0x0f,0x10,0xff,0x0d,0x07,0x08,0xff,0x0c,0x06,0x08,0xff,0x0d,0x07,0x08,0xff,0x09,0x04,0x04,0xff,0x0e,0x0a,0x0a,0xff,0x09,0x04,0x05,0xff,0x07,0x02,0x03,0xff,0x0a,0x04,0x05,0xff,0x17,0x11,0x12,0xff,0x0f,0x0b,0x0c,0xff,0x08,0x05,0x06,0xff,0x05,0x03,0x03,0xff,0x06,0x03,0x03,0xff,0x08,0x05,0x04,0xff,0x0c,0x09,0x08,0xff,0x13,0x0c,0x0d,0xff,0x16,0x0e,0x0e,0xff,0x16,0x0d,0x0c,0xff,0x1d,0x15,0x13,0xff,0x18,0x10,0x0d,0xff,0x26,0x1d,0x19,0xff,0x27,0x1d,0x1b,0xff,0x15,0x0e,0x0c,0xff,0x13,0x0c,0x0b,0xff,0x23,0x1f,0x1e,0xff,0x4d,0x47,0x46,0xff,0x29,0x22,0x21,0xff,0x1f,0x18,0x17,0xff,0x2a,0x26,0x24,0xff,0x1b,0x19,0x18,0xff,0x0f,0x0a,0x0a,0xff,0x13,0x0d,0x0c,0xff,0x35,0x33,0x34,0xff,0x91,0x95,0x98,0xff,0xcd,0xd1,0xd5,0xff,0xee,0xee,0xee,0xdb,0xff,0xff,0xff,0x77,0xff,0xff,0xff,0x18,0xff,0xfe,0xff,0x00,0xfe,0xf6,0xfa,0x00,0xfe,0xeb,0xf3,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xee,0xf4,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x05,0xfe,0xfe,0xfe,0x5a,0xd5,0xd3,0xd1,0xcf,0x87,0x80,0x7c,0xff,0x4c,0x41,0x3b,0xff,0x35,0x29,0x21,0xff,0x36,0x2a,0x22,0xff,0x3a,0x2e,0x27,0xff,0x3b,0x2f,0x29,0xff,0x3c,0x31,0x29,0xff,0x3b,0x30,0x29,0xff,0x2d,0x24,0x1e,0xff,0x1b,0x14,0x10,0xff,0x10,0x08,0x0a,0xff,0x0c,0x04,0x07,0xff,0x0f,0x08,0x09,0xff,0x0a,0x05,0x06,0xff,0x0c,0x08,0x08,0xff,0x10,0x0a,0x0b,0xff,0x0d,0x08,0x09,0xff,0x0f,0x09,0x0a,0xff,0x09,0x05,0x05,0xff,0x0b,0x06,0x08,0xff,0x11,0x0d,0x0e,0xff,0x0f,0x08,0x09,0xff,0x13,0x0a,0x0b,0xff,0x17,0x0f,0x10,0xff,0x17,0x10,0x11,0xff,0x12,0x0b,0x0c,0xff,0x06,0x02,0x02,0xff,0x0b,0x06,0x07,0xff,0x0d,0x08,0x09,0xff,0x08,0x04,0x04,0xff,0x08,0x04,0x04,0xff,0x14,0x0f,0x0f,0xff,0x08,0x04,0x05,0xff,0x04,0x01,0x01,0xff,0x04,0x02,0x03,0xff,0x06,0x04,0x04,0xff,0x13,0x0b,0x0a,0xff,0x1c,0x12,0x12,0xff,0x15,0x0d,0x0f,0xff,0x28,0x20,0x1e,0xff,0x1e,0x17,0x13,0xff,0x12,0x0c,0x0a,0xff,0x1b,0x15,0x13,0xff,0x1d,0x16,0x14,0xff,0x1d,0x14,0x12,0xff,0x20,0x16,0x15,0xff,0x22,0x1a,0x1c,0xff,0x41,0x40,0x41,0xff,0x23,0x1f,0x1f,0xff,0x23,0x1a,0x1a,0xff,0x24,0x1f,0x1f,0xff,0x2b,0x2a,0x2a,0xff,0x24,0x22,0x22,0xff,0x26,0x25,0x26,0xff,0x52,0x4f,0x57,0xff,0x77,0x80,0x8d,0xff,0x64,0x73,0x84,0xff,0x2f,0x30,0x39,0xff,0x42,0x3f,0x3f,0xff,0x99,0x97,0x98,0xff,0xe7,0xe6,0xe7,0xec,0xff,0xff,0xff,0x8a,0xff,0xff,0xff,0x1b,0xff,0xff,0xff,0x00,0xff,0xf6,0xf9,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xec,0xf3,0x00,0xfe,0xf8,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x01,0xfd,0xfd,0xfd,0x51,0xd0,0xcd,0xcc,0xcf,0x81,0x7a,0x75,0xff,0x45,0x3b,0x34,0xff,0x31,0x26,0x1e,0xff,0x37,0x2d,0x24,0xff,0x39,0x31,0x29,0xff,0x3c,0x31,0x2a,0xff,0x3e,0x34,0x2c,0xff,0x3d,0x32,0x2b,0xff,0x3f,0x34,0x2c,0xff,0x3f,0x34,0x2c,0xff,0x32,0x27,0x21,0xff,0x1b,0x15,0x11,0xff,0x10,0x0a,0x0c,0xff,0x0d,0x07,0x09,0xff,0x0a,0x06,0x06,0xff,0x05,0x01,0x01,0xff,0x08,0x04,0x04,0xff,0x0c,0x07,0x07,0xff,0x0f,0x08,0x0a,0xff,0x0d,0x08,0x09,0xff,0x09,0x06,0x06,0xff,0x09,0x06,0x07,0xff,0x0b,0x06,0x07,0xff,0x0b,0x06,0x06,0xff,0x10,0x0a,0x0b,0xff,0x11,0x09,0x0b,0xff,0x19,0x12,0x12,0xff,0x1c,0x16,0x14,0xff,0x09,0x05,0x05,0xff,0x0a,0x04,0x05,0xff,0x11,0x0a,0x0b,0xff,0x0d,0x08,0x09,0xff,0x0e,0x09,0x0a,0xff,0x06,0x02,0x03,0xff,0x08,0x04,0x04,0xff,0x06,0x02,0x02,0xff,0x08,0x05,0x06,0xff,0x0e,0x0a,0x0b,0xff,0x15,0x0e,0x0f,0xff,0x16,0x0e,0x0e,0xff,0x17,0x0e,0x10,0xff,0x29,0x20,0x1e,0xff,0x1e,0x15,0x13,0xff,0x12,0x0b,0x0a,0xff,0x1d,0x16,0x16,0xff,0x12,0x0b,0x0a,0xff,0x1a,0x11,0x12,0xff,0x20,0x1a,0x1b,0xff,0x36,0x31,0x36,0xff,0x30,0x2e,0x2f,0xff,0x11,0x0d,0x0d,0xff,0x21,0x1b,0x1d,0xff,0x26,0x27,0x2a,0xff,0x48,0x46,0x4c,0xff,0x64,0x65,0x6b,0xff,0x73,0x7e,0x8b,0xff,0x83,0x90,0xa3,0xff,0x6e,0x79,0x8c,0xff,0x20,0x22,0x2c,0xff,0x1c,0x17,0x18,0xff,0x21,0x1e,0x1e,0xff,0x10,0x0e,0x0f,0xff,0x35,0x32,0x34,0xff,0x98,0x96,0x96,0xff,0xe7,0xe6,0xe7,0xed,0xff,0xff,0xff,0x84,0xff,0xff,0xff,0x13,0xff,0xfd,0xfe,0x00,0xfe,0xf3,0xf7,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe9,0xf1,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x39,0xd8,0xd6,0xd4,0xbd,0x80,0x79,0x75,0xff,0x42,0x38,0x31,0xff,0x35,0x29,0x21,0xff,0x3a,0x2e,0x27,0xff,0x3d,0x32,0x2a,0xff,0x3d,0x33,0x2c,0xff,0x3c,0x32,0x2b,0xff,0x3e,0x32,0x2c,0xff,0x3f,0x33,0x2c,0xff,0x41,0x34,0x2e,0xff,0x41,0x35,0x2e,0xff,0x40,0x34,0x2d,0xff,0x36,0x29,0x24,0xff,0x19,0x14,0x0f,0xff,0x0b,0x05,0x08,0xff,0x0f,0x09,0x0c,0xff,0x0a,0x06,0x06,0xff,0x0e,0x0a,0x0b,0xff,0x17,0x11,0x12,0xff,0x19,0x12,0x12,0xff,0x18,0x0f,0x10,0xff,0x06,0x01,0x02,0xff,0x04,0x02,0x02,0xff,0x07,0x05,0x06,0xff,0x0d,0x0a,0x0a,0xff,0x0b,0x06,0x07,0xff,0x0a,0x05,0x06,0xff,0x0e,0x07,0x09,0xff,0x12,0x0b,0x0b,0xff,0x16,0x10,0x0e,0xff,0x0a,0x05,0x06,0xff,0x05,0x01,0x02,0xff,0x0b,0x07,0x08,0xff,0x10,0x0a,0x0b,0xff,0x09,0x02,0x04,0xff,0x07,0x01,0x02,0xff,0x0d,0x09,0x09,0xff,0x0e,0x09,0x0a,0xff,0x14,0x0f,0x0f,0xff,0x16,0x10,0x10,0xff,0x15,0x0d,0x0e,0xff,0x14,0x0c,0x0c,0xff,0x18,0x0f,0x10,0xff,0x18,0x0f,0x0e,0xff,0x27,0x1f,0x20,0xff,0x20,0x18,0x1a,0xff,0x0f,0x08,0x09,0xff,0x23,0x1c,0x1d,0xff,0x30,0x2b,0x2e,0xff,0x26,0x29,0x2e,0xff,0x30,0x30,0x3a,0xff,0x16,0x0f,0x12,0xff,0x1f,0x1c,0x1f,0xff,0x3f,0x48,0x4d,0xff,0x69,0x6f,0x77,0xff,0x71,0x78,0x80,0xff,0x72,0x80,0x8d,0xff,0x73,0x84,0x9c,0xff,0x4f,0x5c,0x6b,0xff,0x21,0x22,0x2b,0xff,0x29,0x25,0x28,0xff,0x32,0x2f,0x32,0xff,0x1f,0x1b,0x1e,0xff,0x19,0x15,0x18,0xff,0x22,0x21,0x25,0xff,0x2c,0x2a,0x2c,0xff,0x33,0x32,0x33,0xff,0xa1,0xa0,0xa1,0xff,0xf4,0xf3,0xf4,0xe4,0xff,0xff,0xff,0x6a,0xff,0xff,0xff,0x07,0xff,0xfc,0xfd,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf0,0xf6,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x18,0xe5,0xe4,0xe3,0x9a,0x93,0x8d,0x89,0xfc,0x49,0x3f,0x38,0xff,0x35,0x29,0x21,0xff,0x3b,0x30,0x28,0xff,0x3e,0x33,0x2b,0xff,0x3f,0x34,0x2d,0xff,0x3f,0x34,0x2d,0xff,0x40,0x35,0x2e,0xff,0x40,0x34,0x2d,0xff,0x41,0x34,0x2d,0xff,0x42,0x35,0x2e,0xff,0x43,0x35,0x2e,0xff,0x43,0x35,0x2e,0xff,0x43,0x35,0x2d,0xff,0x32,0x25,0x1f,0xff,0x19,0x13,0x10,0xff,0x0d,0x06,0x09,0xff,0x0b,0x03,0x06,0xff,0x0b,0x05,0x06,0xff,0x0e,0x09,0x09,0xff,0x1d,0x16,0x14,0xff,0x1b,0x13,0x12,0xff,0x11,0x09,0x08,0xff,0x0f,0x0a,0x0a,0xff,0x08,0x05,0x06,0xff,0x08,0x06,0x07,0xff,0x0a,0x07,0x07,0xff,0x08,0x04,0x04,0xff,0x07,0x03,0x03,0xff,0x0c,0x07,0x08,0xff,0x07,0x03,0x04,0xff,0x07,0x03,0x05,0xff,0x09,0x05,0x06,0xff,0x0a,0x06,0x07,0xff,0x10,0x0a,0x0b,0xff,0x10,0x09,0x0a,0xff,0x0f,0x07,0x09,0xff,0x13,0x0c,0x0d,0xff,0x0f,0x09,0x0b,0xff,0x10,0x0b,0x0c,0xff,0x15,0x0f,0x0e,0xff,0x1b,0x14,0x13,0xff,0x19,0x11,0x10,0xff,0x1d,0x15,0x13,0xff,0x1f,0x15,0x15,0xff,0x17,0x0d,0x0e,0xff,0x23,0x1b,0x1e,0xff,0x1e,0x18,0x1b,0xff,0x30,0x2b,0x2c,0xff,0x30,0x2c,0x2e,0xff,0x25,0x23,0x29,0xff,0x33,0x37,0x3f,0xff,0x21,0x22,0x28,0xff,0x28,0x2c,0x34,0xff,0x60,0x68,0x79,0xff,0x71,0x78,0x85,0xff,0x59,0x63,0x6d,0xff,0x5f,0x6f,0x82,0xff,0x59,0x6b,0x86,0xff,0x33,0x42,0x59,0xff,0x26,0x2a,0x36,0xff,0x37,0x36,0x3d,0xff,0x31,0x30,0x35,0xff,0x29,0x2a,0x30,0xff,0x2c,0x30,0x34,0xff,0x2d,0x30,0x34,0xff,0x25,0x25,0x28,0xff,0x23,0x23,0x27,0xff,0x2c,0x2e,0x33,0xff,0x36,0x35,0x3d,0xff,0x6f,0x6d,0x75,0xff,0xae,0xae,0xb1,0xff,0xf1,0xf1,0xf1,0xcd,0xff,0xff,0xff,0x40,0xff,0xff,0xff,0x00,0xff,0xf8,0xfb,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfc,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe9,0xf1,0x00,0xff,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xf9,0xf8,0xf8,0x5d,0xaf,0xaa,0xa7,0xe5,0x56,0x4d,0x46,0xff,0x37,0x2c,0x25,0xff,0x3c,0x30,0x28,0xff,0x40,0x35,0x2d,0xff,0x3f,0x34,0x2d,0xff,0x3f,0x34,0x2d,0xff,0x41,0x36,0x2f,0xff,0x41,0x36,0x2f,0xff,0x40,0x35,0x2e,0xff,0x42,0x36,0x2f,0xff,0x45,0x37,0x30,0xff,0x45,0x38,0x30,0xff,0x45,0x37,0x2e,0xff,0x44,0x38,0x2e,0xff,0x40,0x35,0x2c,0xff,0x2b,0x21,0x1e,0xff,0x15,0x0e,0x0e,0xff,0x0c,0x04,0x06,0xff,0x0b,0x05,0x08,0xff,0x08,0x04,0x05,0xff,0x15,0x0e,0x0f,0xff,0x1d,0x17,0x17,0xff,0x0d,0x07,0x08,0xff,0x0b,0x06,0x06,0xff,0x0d,0x09,0x0a,0xff,0x06,0x03,0x04,0xff,0x07,0x05,0x05,0xff,0x0a,0x06,0x06,0xff,0x07,0x03,0x03,0xff,0x06,0x03,0x03,0xff,0x04,0x01,0x01,0xff,0x04,0x02,0x02,0xff,0x04,0x02,0x02,0xff,0x0d,0x08,0x09,0xff,0x15,0x0e,0x10,0xff,0x10,0x09,0x0a,0xff,0x11,0x0a,0x0b,0xff,0x17,0x10,0x11,0xff,0x18,0x11,0x14,0xff,0x10,0x0a,0x0d,0xff,0x0f,0x0a,0x0d,0xff,0x15,0x0e,0x0f,0xff,0x19,0x10,0x11,0xff,0x16,0x0e,0x0f,0xff,0x18,0x10,0x11,0xff,0x16,0x0d,0x0e,0xff,0x14,0x10,0x11,0xff,0x3f,0x3c,0x3e,0xff,0x3d,0x3c,0x3d,0xff,0x21,0x1f,0x21,0xff,0x1b,0x1b,0x1f,0xff,0x32,0x35,0x3d,0xff,0x2a,0x2f,0x3b,0xff,0x41,0x4a,0x55,0xff,0x6e,0x80,0x8d,0xff,0x58,0x64,0x78,0xff,0x4d,0x55,0x62,0xff,0x6a,0x7e,0x98,0xff,0x4c,0x62,0x81,0xff,0x2b,0x37,0x4d,0xff,0x30,0x3b,0x49,0xff,0x39,0x3f,0x4e,0xff,0x39,0x3d,0x49,0xff,0x3c,0x42,0x4b,0xff,0x46,0x4f,0x5c,0xff,0x3d,0x43,0x4e,0xff,0x25,0x23,0x29,0xff,0x1f,0x1a,0x1e,0xff,0x21,0x23,0x2a,0xff,0x33,0x3b,0x47,0xff,0x35,0x3a,0x4b,0xff,0x4d,0x50,0x61,0xff,0x40,0x42,0x4e,0xff,0x8e,0x91,0x97,0xff,0xe2,0xe3,0xe5,0xfc,0xff,0xff,0xff,0x99,0xff,0xff,0xff,0x14,0xff,0xfd,0xfe,0x00,0xfe,0xf1,0xf6,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfc,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xee,0xf4,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x1e,0xd5,0xd3,0xd0,0xaf,0x75,0x6e,0x68,0xff,0x3c,0x31,0x2a,0xff,0x3a,0x2e,0x28,0xff,0x3f,0x34,0x2d,0xff,0x3f,0x34,0x2d,0xff,0x41,0x35,0x2f,0xff,0x41,0x36,0x2e,0xff,0x43,0x37,0x2f,0xff,0x43,0x36,0x30,0xff,0x42,0x37,0x2f,0xff,0x42,0x38,0x30,0xff,0x44,0x38,0x31,0xff,0x45,0x37,0x30,0xff,0x47,0x39,0x32,0xff,0x44,0x38,0x30,0xff,0x2e,0x23,0x1d,0xff,0x1d,0x12,0x12,0xff,0x14,0x0a,0x0c,0xff,0x12,0x0b,0x0c,0xff,0x0e,0x07,0x0a,0xff,0x0e,0x08,0x0a,0xff,0x12,0x0d,0x0e,0xff,0x1a,0x13,0x14,0xff,0x0b,0x04,0x05,0xff,0x11,0x0b,0x0c,0xff,0x0c,0x07,0x08,0xff,0x0c,0x08,0x09,0xff,0x06,0x03,0x03,0xff,0x06,0x03,0x03,0xff,0x0a,0x06,0x07,0xff,0x11,0x0c,0x0c,0xff,0x16,0x11,0x12,0xff,0x08,0x03,0x04,0xff,0x06,0x03,0x04,0xff,0x07,0x04,0x04,0xff,0x0e,0x08,0x09,0xff,0x1a,0x12,0x13,0xff,0x1d,0x13,0x15,0xff,0x14,0x0c,0x0d,0xff,0x15,0x0d,0x0d,0xff,0x1f,0x19,0x1d,0xff,0x18,0x12,0x18,0xff,0x1e,0x19,0x1b,0xff,0x1b,0x15,0x16,0xff,0x1f,0x18,0x1b,0xff,0x1f,0x19,0x1c,0xff,0x1e,0x1a,0x1c,0xff,0x1f,0x1b,0x1e,0xff,0x3f,0x40,0x46,0xff,0x42,0x43,0x4a,0xff,0x22,0x22,0x26,0xff,0x21,0x22,0x28,0xff,0x3f,0x44,0x4d,0xff,0x2f,0x36,0x43,0xff,0x3c,0x4a,0x5f,0xff,0x5f,0x73,0x8a,0xff,0x3f,0x4e,0x65,0xff,0x46,0x56,0x6c,0xff,0x68,0x7f,0x9b,0xff,0x45,0x5a,0x78,0xff,0x23,0x32,0x4e,0xff,0x2d,0x38,0x4b,0xff,0x38,0x44,0x55,0xff,0x3f,0x4d,0x5d,0xff,0x3a,0x46,0x56,0xff,0x2c,0x36,0x45,0xff,0x1e,0x22,0x2c,0xff,0x18,0x15,0x19,0xff,0x25,0x20,0x23,0xff,0x23,0x1e,0x24,0xff,0x2b,0x2e,0x3a,0xff,0x31,0x3c,0x4f,0xff,0x44,0x50,0x66,0xff,0x65,0x72,0x87,0xff,0x6e,0x7c,0x8e,0xff,0x58,0x64,0x74,0xff,0x57,0x62,0x6f,0xff,0xac,0xb1,0xb9,0xff,0xf3,0xf3,0xf5,0xe0,0xff,0xff,0xff,0x4d,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xf7,0xf7,0xf7,0x55,0xa6,0xa2,0x9f,0xe7,0x4c,0x44,0x3b,0xff,0x36,0x2c,0x23,0xff,0x3e,0x33,0x2c,0xff,0x41,0x35,0x30,0xff,0x40,0x35,0x2e,0xff,0x42,0x37,0x2f,0xff,0x43,0x37,0x30,0xff,0x44,0x39,0x30,0xff,0x46,0x39,0x31,0xff,0x46,0x38,0x31,0xff,0x43,0x39,0x2f,0xff,0x44,0x3a,0x31,0xff,0x45,0x3a,0x32,0xff,0x47,0x39,0x32,0xff,0x47,0x3a,0x32,0xff,0x40,0x35,0x2f,0xff,0x22,0x17,0x17,0xff,0x13,0x09,0x0c,0xff,0x11,0x09,0x0a,0xff,0x0e,0x07,0x08,0xff,0x11,0x09,0x0a,0xff,0x15,0x0d,0x0f,0xff,0x1f,0x17,0x19,0xff,0x0f,0x08,0x09,0xff,0x0c,0x06,0x07,0xff,0x10,0x09,0x0a,0xff,0x0c,0x08,0x08,0xff,0x08,0x03,0x04,0xff,0x0d,0x08,0x09,0xff,0x0f,0x0a,0x0b,0xff,0x0b,0x07,0x07,0xff,0x11,0x0a,0x0b,0xff,0x1a,0x11,0x12,0xff,0x14,0x0a,0x0c,0xff,0x10,0x0a,0x0b,0xff,0x09,0x05,0x05,0xff,0x0c,0x05,0x06,0xff,0x24,0x1b,0x1c,0xff,0x1e,0x13,0x15,0xff,0x17,0x0d,0x0f,0xff,0x1a,0x12,0x12,0xff,0x1e,0x1b,0x1d,0xff,0x13,0x0e,0x13,0xff,0x1c,0x17,0x18,0xff,0x34,0x30,0x32,0xff,0x3e,0x3c,0x41,0xff,0x41,0x44,0x4c,0xff,0x4c,0x53,0x5f,0xff,0x55,0x5e,0x6b,0xff,0x48,0x52,0x60,0xff,0x46,0x4d,0x5f,0xff,0x5a,0x61,0x73,0xff,0x53,0x63,0x75,0xff,0x58,0x6e,0x83,0xff,0x57,0x66,0x7f,0xff,0x41,0x53,0x6c,0xff,0x43,0x5b,0x74,0xff,0x63,0x7b,0x96,0xff,0x5b,0x75,0x92,0xff,0x3b,0x4d,0x6b,0xff,0x29,0x36,0x52,0xff,0x28,0x34,0x4b,0xff,0x28,0x34,0x48,0xff,0x22,0x2a,0x3e,0xff,0x1e,0x26,0x37,0xff,0x1a,0x1f,0x2e,0xff,0x1a,0x1d,0x29,0xff,0x12,0x14,0x1e,0xff,0x1d,0x21,0x2b,0xff,0x31,0x35,0x41,0xff,0x3b,0x3f,0x4e,0xff,0x34,0x40,0x52,0xff,0x3e,0x4e,0x64,0xff,0x5b,0x6a,0x84,0xff,0x54,0x64,0x7e,0xff,0x4c,0x5c,0x71,0xff,0x58,0x64,0x79,0xff,0x60,0x6a,0x80,0xff,0x53,0x5c,0x6e,0xff,0x6a,0x70,0x7f,0xff,0xc9,0xca,0xce,0xff,0xff,0xff,0xff,0x93,0xff,0xff,0xff,0x0d,0xff,0xfc,0xfd,0x00,0xfe,0xee,0xf4,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xea,0xf2,0x00,0xff,0xf8,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x0a,0xde,0xdc,0xdb,0x91,0x7a,0x72,0x6d,0xff,0x3e,0x33,0x2b,0xff,0x3c,0x31,0x29,0xff,0x41,0x36,0x2f,0xff,0x43,0x38,0x30,0xff,0x44,0x38,0x31,0xff,0x44,0x38,0x31,0xff,0x45,0x3a,0x32,0xff,0x44,0x39,0x32,0xff,0x47,0x3a,0x32,0xff,0x47,0x3b,0x31,0xff,0x46,0x3c,0x32,0xff,0x48,0x3c,0x33,0xff,0x48,0x3c,0x32,0xff,0x49,0x3c,0x33,0xff,0x4b,0x3f,0x35,0xff,0x48,0x3d,0x34,0xff,0x2f,0x26,0x20,0xff,0x1a,0x10,0x14,0xff,0x0f,0x08,0x0b,0xff,0x10,0x0c,0x0c,0xff,0x1b,0x14,0x14,0xff,0x34,0x27,0x27,0xff,0x1f,0x15,0x15,0xff,0x0f,0x07,0x08,0xff,0x0e,0x05,0x07,0xff,0x09,0x03,0x04,0xff,0x04,0x02,0x02,0xff,0x04,0x02,0x02,0xff,0x08,0x05,0x05,0xff,0x10,0x0c,0x0d,0xff,0x08,0x06,0x06,0xff,0x07,0x04,0x04,0xff,0x0f,0x07,0x09,0xff,0x17,0x0f,0x10,0xff,0x23,0x18,0x18,0xff,0x18,0x10,0x0f,0xff,0x12,0x0c,0x0c,0xff,0x1d,0x15,0x17,0xff,0x18,0x11,0x12,0xff,0x0c,0x04,0x05,0xff,0x19,0x0f,0x11,0xff,0x24,0x1c,0x1e,0xff,0x1d,0x17,0x1a,0xff,0x0f,0x09,0x0b,0xff,0x21,0x1c,0x1c,0xff,0x2d,0x28,0x2c,0xff,0x35,0x33,0x3a,0xff,0x34,0x39,0x46,0xff,0x50,0x5d,0x73,0xff,0x53,0x63,0x78,0xff,0x42,0x51,0x67,0xff,0x55,0x64,0x7c,0xff,0x53,0x64,0x7e,0xff,0x57,0x6a,0x86,0xff,0x67,0x7b,0x97,0xff,0x42,0x55,0x71,0xff,0x42,0x56,0x72,0xff,0x60,0x75,0x92,0xff,0x50,0x63,0x82,0xff,0x30,0x3f,0x5b,0xff,0x23,0x2e,0x42,0xff,0x26,0x2f,0x42,0xff,0x1e,0x26,0x39,0xff,0x25,0x2a,0x3f,0xff,0x1f,0x25,0x38,0xff,0x18,0x1d,0x2e,0xff,0x18,0x1d,0x2e,0xff,0x20,0x27,0x36,0xff,0x26,0x2e,0x3d,0xff,0x2c,0x33,0x45,0xff,0x35,0x41,0x54,0xff,0x3e,0x4c,0x62,0xff,0x4a,0x57,0x6d,0xff,0x49,0x59,0x72,0xff,0x4a,0x5c,0x79,0xff,0x51,0x63,0x82,0xff,0x57,0x67,0x82,0xff,0x50,0x5c,0x74,0xff,0x3a,0x40,0x56,0xff,0x25,0x26,0x32,0xff,0x1d,0x1d,0x25,0xff,0x35,0x32,0x37,0xff,0x94,0x93,0x94,0xff,0xf3,0xf3,0xf3,0xcd,0xff,0xff,0xff,0x2f,0xff,0xfe,0xfe,0x00,0xfe,0xf2,0xf7,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xec,0xf3,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x21,0xbe,0xbc,0xb9,0xc5,0x55,0x4e,0x47,0xff,0x38,0x2e,0x25,0xff,0x41,0x36,0x2d,0xff,0x42,0x37,0x30,0xff,0x42,0x37,0x30,0xff,0x44,0x39,0x32,0xff,0x44,0x39,0x31,0xff,0x45,0x3b,0x32,0xff,0x47,0x3c,0x33,0xff,0x46,0x3a,0x32,0xff,0x49,0x3c,0x33,0xff,0x48,0x3d,0x33,0xff,0x48,0x3e,0x34,0xff,0x4c,0x3f,0x36,0xff,0x4b,0x3e,0x35,0xff,0x4b,0x3f,0x36,0xff,0x3e,0x32,0x2a,0xff,0x32,0x29,0x22,0xff,0x26,0x1d,0x1a,0xff,0x11,0x08,0x0c,0xff,0x0a,0x04,0x08,0xff,0x0e,0x0a,0x0b,0xff,0x15,0x0f,0x0f,0xff,0x16,0x0e,0x0e,0xff,0x12,0x0b,0x0c,0xff,0x09,0x03,0x05,0xff,0x05,0x02,0x04,0xff,0x04,0x01,0x03,0xff,0x05,0x02,0x04,0xff,0x08,0x04,0x06,0xff,0x0a,0x05,0x06,0xff,0x09,0x05,0x06,0xff,0x09,0x05,0x06,0xff,0x06,0x02,0x03,0xff,0x0e,0x08,0x09,0xff,0x15,0x0f,0x10,0xff,0x2d,0x23,0x24,0xff,0x22,0x18,0x18,0xff,0x1e,0x13,0x15,0xff,0x19,0x10,0x11,0xff,0x0a,0x03,0x03,0xff,0x0e,0x07,0x09,0xff,0x1e,0x15,0x19,0xff,0x1d,0x16,0x1b,0xff,0x19,0x14,0x17,0xff,0x24,0x1e,0x22,0xff,0x3b,0x3a,0x3f,0xff,0x41,0x4b,0x55,0xff,0x4b,0x57,0x64,0xff,0x56,0x63,0x79,0xff,0x54,0x64,0x80,0xff,0x3e,0x4d,0x65,0xff,0x51,0x62,0x7b,0xff,0x53,0x68,0x83,0xff,0x4f,0x65,0x81,0xff,0x59,0x6f,0x8d,0xff,0x47,0x5d,0x79,0xff,0x34,0x48,0x63,0xff,0x55,0x65,0x81,0xff,0x43,0x4e,0x6a,0xff,0x2e,0x35,0x4e,0xff,0x1b,0x21,0x34,0xff,0x19,0x21,0x30,0xff,0x18,0x1e,0x2f,0xff,0x1b,0x1f,0x30,0xff,0x22,0x28,0x3a,0xff,0x28,0x2f,0x42,0xff,0x2b,0x33,0x45,0xff,0x24,0x2c,0x3f,0xff,0x27,0x30,0x41,0xff,0x25,0x2e,0x3e,0xff,0x21,0x29,0x3c,0xff,0x22,0x2d,0x41,0xff,0x21,0x2d,0x41,0xff,0x26,0x30,0x46,0xff,0x2e,0x39,0x4f,0xff,0x35,0x3f,0x53,0xff,0x32,0x3a,0x4b,0xff,0x31,0x35,0x41,0xff,0x2f,0x31,0x39,0xff,0x2f,0x2f,0x36,0xff,0x24,0x22,0x27,0xff,0x22,0x1f,0x23,0xff,0x1a,0x17,0x18,0xff,0x10,0x0e,0x10,0xff,0x68,0x69,0x6a,0xff,0xe2,0xe2,0xe2,0xf2,0xff,0xff,0xff,0x59,0xff,0xff,0xff,0x00,0xff,0xf7,0xf9,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf0,0xf5,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xf6,0xf5,0xf5,0x44,0x9d,0x98,0x93,0xe7,0x45,0x3d,0x33,0xff,0x3b,0x32,0x2b,0xff,0x43,0x39,0x30,0xff,0x45,0x3a,0x31,0xff,0x44,0x39,0x32,0xff,0x44,0x39,0x32,0xff,0x46,0x3b,0x33,0xff,0x46,0x3b,0x34,0xff,0x47,0x3c,0x33,0xff,0x48,0x3d,0x33,0xff,0x4b,0x3d,0x35,0xff,0x4c,0x3f,0x35,0xff,0x4a,0x3f,0x35,0xff,0x49,0x3f,0x36,0xff,0x4c,0x3f,0x36,0xff,0x4c,0x3f,0x36,0xff,0x4a,0x3f,0x37,0xff,0x3e,0x34,0x2d,0xff,0x22,0x19,0x17,0xff,0x15,0x0d,0x0e,0xff,0x13,0x0b,0x0f,0xff,0x0b,0x06,0x09,0xff,0x0c,0x07,0x0a,0xff,0x0c,0x06,0x07,0xff,0x08,0x02,0x03,0xff,0x05,0x01,0x03,0xff,0x05,0x02,0x04,0xff,0x05,0x04,0x07,0xff,0x09,0x07,0x0a,0xff,0x0d,0x09,0x0c,0xff,0x0c,0x07,0x0a,0xff,0x0e,0x09,0x0a,0xff,0x15,0x0f,0x10,0xff,0x0e,0x07,0x08,0xff,0x08,0x03,0x04,0xff,0x16,0x11,0x12,0xff,0x16,0x0f,0x11,0xff,0x0e,0x05,0x07,0xff,0x1b,0x10,0x11,0xff,0x2a,0x20,0x20,0xff,0x19,0x10,0x11,0xff,0x14,0x0d,0x0e,0xff,0x18,0x0f,0x12,0xff,0x1c,0x15,0x18,0xff,0x21,0x20,0x26,0xff,0x30,0x33,0x3c,0xff,0x5c,0x5e,0x6c,0xff,0x5a,0x63,0x78,0xff,0x4f,0x64,0x7d,0xff,0x4e,0x64,0x7d,0xff,0x49,0x5c,0x77,0xff,0x3a,0x4d,0x6a,0xff,0x45,0x5b,0x79,0xff,0x48,0x5e,0x7a,0xff,0x49,0x5d,0x7b,0xff,0x55,0x69,0x88,0xff,0x49,0x5f,0x7d,0xff,0x38,0x4d,0x69,0xff,0x45,0x55,0x70,0xff,0x46,0x52,0x6c,0xff,0x28,0x33,0x4b,0xff,0x22,0x2b,0x41,0xff,0x1b,0x22,0x33,0xff,0x17,0x1c,0x2b,0xff,0x28,0x2e,0x3d,0xff,0x2c,0x34,0x44,0xff,0x33,0x3c,0x4d,0xff,0x35,0x3e,0x53,0xff,0x36,0x41,0x57,0xff,0x40,0x4d,0x64,0xff,0x46,0x56,0x6c,0xff,0x4a,0x5b,0x71,0xff,0x49,0x59,0x6f,0xff,0x42,0x4e,0x65,0xff,0x3c,0x47,0x5c,0xff,0x33,0x3e,0x52,0xff,0x2d,0x35,0x49,0xff,0x2e,0x32,0x43,0xff,0x26,0x29,0x36,0xff,0x1b,0x1c,0x23,0xff,0x1b,0x1a,0x20,0xff,0x19,0x17,0x1e,0xff,0x1a,0x18,0x1f,0xff,0x16,0x12,0x19,0xff,0x21,0x1d,0x22,0xff,0x2e,0x2b,0x2e,0xff,0x29,0x26,0x29,0xff,0x45,0x45,0x49,0xff,0xc6,0xc7,0xc9,0xff,0xff,0xff,0xff,0x89,0xff,0xff,0xff,0x01,0xff,0xf9,0xfc,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xee,0xec,0xeb,0x5f,0x83,0x7b,0x77,0xf8,0x3e,0x34,0x2b,0xff,0x3e,0x36,0x2b,0xff,0x45,0x3a,0x32,0xff,0x46,0x3b,0x32,0xff,0x46,0x3c,0x32,0xff,0x46,0x3b,0x33,0xff,0x47,0x3d,0x33,0xff,0x47,0x3e,0x33,0xff,0x48,0x3e,0x35,0xff,0x4b,0x3e,0x35,0xff,0x4b,0x3e,0x36,0xff,0x4b,0x3e,0x37,0xff,0x4d,0x3f,0x37,0xff,0x4d,0x41,0x37,0xff,0x4c,0x41,0x38,0xff,0x4d,0x40,0x37,0xff,0x50,0x43,0x39,0xff,0x49,0x3e,0x36,0xff,0x2e,0x24,0x1d,0xff,0x1a,0x12,0x10,0xff,0x13,0x0b,0x0d,0xff,0x13,0x09,0x0d,0xff,0x0f,0x07,0x0b,0xff,0x08,0x04,0x06,0xff,0x04,0x01,0x03,0xff,0x03,0x00,0x03,0xff,0x04,0x01,0x04,0xff,0x0e,0x0a,0x0b,0xff,0x0f,0x07,0x0a,0xff,0x10,0x09,0x0d,0xff,0x0b,0x06,0x08,0xff,0x07,0x04,0x04,0xff,0x0a,0x07,0x07,0xff,0x1b,0x10,0x11,0xff,0x19,0x10,0x11,0xff,0x13,0x0b,0x0c,0xff,0x12,0x0a,0x0c,0xff,0x15,0x0d,0x0e,0xff,0x18,0x0e,0x10,0xff,0x16,0x0d,0x0d,0xff,0x23,0x1a,0x18,0xff,0x21,0x19,0x19,0xff,0x1e,0x18,0x1b,0xff,0x27,0x21,0x26,0xff,0x39,0x3a,0x40,0xff,0x4e,0x57,0x65,0xff,0x5e,0x69,0x7c,0xff,0x65,0x72,0x89,0xff,0x4b,0x5e,0x7b,0xff,0x3c,0x51,0x6e,0xff,0x3a,0x4b,0x68,0xff,0x34,0x45,0x61,0xff,0x38,0x4b,0x68,0xff,0x3f,0x56,0x72,0xff,0x3b,0x51,0x6b,0xff,0x4a,0x5e,0x7b,0xff,0x42,0x58,0x76,0xff,0x32,0x44,0x60,0xff,0x32,0x41,0x5c,0xff,0x2e,0x3c,0x56,0xff,0x2b,0x39,0x52,0xff,0x39,0x49,0x63,0xff,0x57,0x66,0x82,0xff,0x68,0x76,0x8e,0xff,0x60,0x6b,0x7f,0xff,0x48,0x51,0x64,0xff,0x31,0x3a,0x4d,0xff,0x36,0x3e,0x53,0xff,0x46,0x50,0x66,0xff,0x45,0x52,0x69,0xff,0x47,0x54,0x6c,0xff,0x47,0x56,0x6f,0xff,0x53,0x63,0x7d,0xff,0x6a,0x79,0x92,0xff,0x7a,0x89,0xa1,0xff,0x76,0x87,0x9e,0xff,0x6f,0x7c,0x94,0xff,0x66,0x72,0x89,0xff,0x5f,0x69,0x7c,0xff,0x55,0x5c,0x6d,0xff,0x47,0x4b,0x58,0xff,0x3c,0x3f,0x48,0xff,0x29,0x2b,0x34,0xff,0x1c,0x1d,0x24,0xff,0x1e,0x1e,0x28,0xff,0x32,0x32,0x3e,0xff,0x3e,0x3f,0x4b,0xff,0x40,0x44,0x51,0xff,0x4a,0x53,0x61,0xff,0x4a,0x52,0x5d,0xff,0xb4,0xb5,0xbb,0xff,0xff,0xff,0xff,0xa7,0xff,0xff,0xff,0x0c,0xff,0xfc,0xfd,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xfb,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xde,0xdc,0xdb,0x7d,0x6d,0x64,0x5e,0xff,0x3d,0x31,0x28,0xff,0x44,0x39,0x2f,0xff,0x46,0x3c,0x31,0xff,0x47,0x3c,0x33,0xff,0x47,0x3d,0x33,0xff,0x48,0x3e,0x34,0xff,0x47,0x3d,0x34,0xff,0x49,0x3e,0x35,0xff,0x4b,0x3f,0x35,0xff,0x49,0x3f,0x35,0xff,0x4c,0x3f,0x37,0xff,0x4d,0x40,0x38,0xff,0x4e,0x41,0x38,0xff,0x4e,0x41,0x37,0xff,0x50,0x43,0x3a,0xff,0x4e,0x42,0x39,0xff,0x50,0x43,0x3a,0xff,0x4b,0x40,0x38,0xff,0x3a,0x30,0x2a,0xff,0x2e,0x24,0x1f,0xff,0x1e,0x16,0x15,0xff,0x0e,0x06,0x0a,0xff,0x12,0x09,0x0c,0xff,0x0b,0x06,0x08,0xff,0x07,0x03,0x05,0xff,0x0b,0x07,0x08,0xff,0x09,0x05,0x08,0xff,0x0c,0x06,0x09,0xff,0x10,0x08,0x0a,0xff,0x09,0x04,0x07,0xff,0x0f,0x07,0x0b,0xff,0x09,0x03,0x06,0xff,0x0c,0x07,0x09,0xff,0x0a,0x07,0x08,0xff,0x17,0x0c,0x0e,0xff,0x23,0x18,0x1a,0xff,0x23,0x19,0x1a,0xff,0x18,0x0b,0x0f,0xff,0x21,0x15,0x17,0xff,0x1d,0x12,0x12,0xff,0x15,0x0b,0x0a,0xff,0x20,0x14,0x14,0xff,0x25,0x19,0x1c,0xff,0x36,0x34,0x35,0xff,0x52,0x57,0x64,0xff,0x68,0x71,0x87,0xff,0x5d,0x6b,0x81,0xff,0x4a,0x5a,0x70,0xff,0x36,0x47,0x5e,0xff,0x2c,0x3c,0x56,0xff,0x2e,0x3e,0x58,0xff,0x30,0x3f,0x5a,0xff,0x2f,0x3e,0x59,0xff,0x3a,0x47,0x62,0xff,0x38,0x43,0x5e,0xff,0x35,0x43,0x5d,0xff,0x37,0x48,0x65,0xff,0x37,0x49,0x67,0xff,0x31,0x41,0x5e,0xff,0x35,0x44,0x60,0xff,0x36,0x46,0x61,0xff,0x43,0x52,0x6d,0xff,0x49,0x59,0x76,0xff,0x51,0x63,0x81,0xff,0x69,0x7e,0x9e,0xff,0x86,0x9a,0xbb,0xff,0x92,0xa4,0xbc,0xff,0x84,0x93,0xa4,0xff,0x67,0x70,0x84,0xff,0x48,0x53,0x69,0xff,0x40,0x4e,0x68,0xff,0x3c,0x49,0x64,0xff,0x4b,0x58,0x71,0xff,0x4e,0x5d,0x73,0xff,0x55,0x63,0x7b,0xff,0x69,0x77,0x92,0xff,0x79,0x85,0xa2,0xff,0x83,0x8f,0xac,0xff,0x86,0x93,0xad,0xff,0x81,0x8f,0xa5,0xff,0x7a,0x85,0x9b,0xff,0x71,0x7c,0x92,0xff,0x66,0x72,0x85,0xff,0x5b,0x65,0x76,0xff,0x50,0x58,0x69,0xff,0x48,0x51,0x61,0xff,0x4d,0x58,0x68,0xff,0x53,0x5e,0x72,0xff,0x55,0x60,0x75,0xff,0x54,0x5d,0x72,0xff,0x53,0x5e,0x71,0xff,0x66,0x71,0x82,0xff,0xa3,0xa7,0xb1,0xff,0xf8,0xf8,0xf9,0xc2,0xff,0xff,0xff,0x19,0xff,0xfd,0xfe,0x00,0xfd,0xed,0xf3,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xfb,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xd3,0xd0,0xce,0x93,0x62,0x59,0x51,0xff,0x3c,0x30,0x28,0xff,0x47,0x3a,0x31,0xff,0x48,0x3c,0x32,0xff,0x48,0x3d,0x34,0xff,0x4a,0x3f,0x35,0xff,0x48,0x3e,0x34,0xff,0x48,0x3d,0x33,0xff,0x48,0x3e,0x34,0xff,0x4c,0x40,0x36,0xff,0x4c,0x40,0x37,0xff,0x4b,0x40,0x37,0xff,0x4e,0x42,0x3a,0xff,0x50,0x43,0x3b,0xff,0x50,0x44,0x3a,0xff,0x50,0x44,0x3b,0xff,0x54,0x45,0x3c,0xff,0x51,0x43,0x3a,0xff,0x53,0x46,0x3d,0xff,0x4b,0x3f,0x38,0xff,0x32,0x28,0x21,0xff,0x23,0x19,0x15,0xff,0x1a,0x11,0x12,0xff,0x12,0x0a,0x0d,0xff,0x0d,0x05,0x08,0xff,0x0e,0x06,0x0a,0xff,0x12,0x0b,0x0d,0xff,0x12,0x0d,0x0e,0xff,0x0c,0x07,0x09,0xff,0x0b,0x04,0x07,0xff,0x0c,0x05,0x09,0xff,0x07,0x03,0x06,0xff,0x0b,0x06,0x09,0xff,0x0f,0x08,0x0b,0xff,0x10,0x0b,0x0e,0xff,0x0a,0x05,0x07,0xff,0x16,0x0b,0x0d,0xff,0x17,0x0d,0x0f,0xff,0x15,0x0d,0x0e,0xff,0x18,0x0c,0x10,0xff,0x24,0x17,0x19,0xff,0x23,0x17,0x16,0xff,0x1a,0x0f,0x0f,0xff,0x2e,0x24,0x24,0xff,0x3d,0x38,0x3d,0xff,0x5a,0x5e,0x6b,0xff,0x54,0x5e,0x77,0xff,0x58,0x63,0x81,0xff,0x50,0x5c,0x77,0xff,0x39,0x48,0x61,0xff,0x2e,0x3e,0x57,0xff,0x2c,0x3a,0x53,0xff,0x32,0x40,0x59,0xff,0x40,0x4f,0x68,0xff,0x3c,0x4a,0x64,0xff,0x3f,0x4b,0x66,0xff,0x3a,0x44,0x60,0xff,0x2f,0x3b,0x56,0xff,0x2e,0x3c,0x57,0xff,0x37,0x45,0x61,0xff,0x42,0x50,0x6d,0xff,0x3c,0x4d,0x6b,0xff,0x42,0x53,0x71,0xff,0x4e,0x61,0x7f,0xff,0x61,0x76,0x94,0xff,0x6d,0x86,0xa4,0xff,0x6a,0x80,0xa1,0xff,0x76,0x8a,0xac,0xff,0x8d,0xa1,0xbc,0xff,0xa4,0xb6,0xcd,0xff,0xb2,0xc1,0xd2,0xff,0xb0,0xbd,0xcd,0xff,0x90,0x99,0xb1,0xff,0x5e,0x68,0x83,0xff,0x3f,0x4a,0x63,0xff,0x3d,0x4b,0x62,0xff,0x38,0x45,0x5f,0xff,0x37,0x46,0x5d,0xff,0x3e,0x4c,0x60,0xff,0x49,0x54,0x6a,0xff,0x60,0x6c,0x82,0xff,0x74,0x7f,0x95,0xff,0x76,0x81,0x95,0xff,0x6d,0x78,0x8d,0xff,0x64,0x72,0x86,0xff,0x5f,0x6d,0x81,0xff,0x56,0x63,0x78,0xff,0x58,0x66,0x7a,0xff,0x5c,0x6c,0x7f,0xff,0x59,0x69,0x7d,0xff,0x58,0x68,0x7c,0xff,0x5e,0x6d,0x82,0xff,0x5e,0x6e,0x83,0xff,0x48,0x55,0x69,0xff,0x3d,0x46,0x59,0xff,0x91,0x96,0xa2,0xff,0xf4,0xf4,0xf6,0xd6,0xff,0xff,0xff,0x23,0xff,0xfd,0xfe,0x00,0xfd,0xed,0xf3,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf6,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x02,0xca,0xc7,0xc5,0x9b,0x59,0x52,0x47,0xff,0x3e,0x33,0x28,0xff,0x48,0x3b,0x32,0xff,0x4a,0x3d,0x33,0xff,0x4a,0x3e,0x35,0xff,0x4b,0x40,0x37,0xff,0x4a,0x40,0x36,0xff,0x4d,0x41,0x38,0xff,0x4c,0x40,0x36,0xff,0x4a,0x40,0x37,0xff,0x4c,0x42,0x38,0xff,0x4e,0x42,0x39,0xff,0x4f,0x42,0x39,0xff,0x4f,0x44,0x3a,0xff,0x50,0x44,0x3b,0xff,0x52,0x45,0x3c,0xff,0x51,0x46,0x3d,0xff,0x58,0x45,0x3d,0xff,0x54,0x45,0x3c,0xff,0x55,0x48,0x3f,0xff,0x50,0x43,0x3b,0xff,0x42,0x38,0x30,0xff,0x29,0x1e,0x1c,0xff,0x0e,0x04,0x08,0xff,0x14,0x0b,0x0f,0xff,0x14,0x0b,0x0f,0xff,0x13,0x0b,0x0e,0xff,0x0d,0x06,0x09,0xff,0x0a,0x06,0x06,0xff,0x0a,0x05,0x07,0xff,0x0f,0x08,0x0b,0xff,0x11,0x0a,0x0d,0xff,0x0b,0x06,0x08,0xff,0x07,0x03,0x06,0xff,0x12,0x0b,0x0e,0xff,0x0e,0x08,0x0a,0xff,0x08,0x04,0x06,0xff,0x1e,0x12,0x14,0xff,0x18,0x0e,0x0f,0xff,0x0a,0x04,0x05,0xff,0x1c,0x10,0x13,0xff,0x1a,0x10,0x12,0xff,0x1e,0x14,0x13,0xff,0x2c,0x1f,0x20,0xff,0x3d,0x37,0x3c,0xff,0x4c,0x52,0x61,0xff,0x38,0x42,0x58,0xff,0x3e,0x49,0x64,0xff,0x53,0x5d,0x7b,0xff,0x48,0x54,0x71,0xff,0x49,0x57,0x70,0xff,0x3c,0x4c,0x65,0xff,0x33,0x3d,0x55,0xff,0x38,0x40,0x5a,0xff,0x38,0x44,0x5e,0xff,0x33,0x40,0x5a,0xff,0x3e,0x4d,0x68,0xff,0x45,0x55,0x72,0xff,0x40,0x50,0x6d,0xff,0x32,0x40,0x5c,0xff,0x33,0x3f,0x5b,0xff,0x3d,0x4a,0x66,0xff,0x4e,0x5e,0x7b,0xff,0x52,0x64,0x83,0xff,0x5d,0x72,0x91,0xff,0x62,0x7a,0x98,0xff,0x6f,0x86,0xa7,0xff,0x75,0x8a,0xa9,0xff,0x78,0x8d,0xa8,0xff,0x80,0x95,0xb0,0xff,0x91,0xa6,0xc1,0xff,0xa0,0xb7,0xce,0xff,0xac,0xc0,0xd3,0xff,0xbe,0xcd,0xda,0xff,0xbb,0xc8,0xd3,0xff,0x8e,0x9a,0xa9,0xff,0x5a,0x66,0x7d,0xff,0x3e,0x4a,0x64,0xff,0x38,0x44,0x5b,0xff,0x2c,0x37,0x4c,0xff,0x1d,0x26,0x39,0xff,0x1b,0x20,0x33,0xff,0x25,0x2b,0x3e,0xff,0x2e,0x37,0x48,0xff,0x3a,0x42,0x55,0xff,0x41,0x4b,0x5d,0xff,0x46,0x50,0x62,0xff,0x4a,0x55,0x68,0xff,0x42,0x4c,0x60,0xff,0x42,0x4c,0x5f,0xff,0x42,0x4b,0x5e,0xff,0x45,0x4d,0x61,0xff,0x3f,0x49,0x5d,0xff,0x39,0x42,0x53,0xff,0x2d,0x35,0x44,0xff,0x25,0x2a,0x38,0xff,0x1f,0x23,0x2f,0xff,0x74,0x78,0x80,0xff,0xef,0xf0,0xf1,0xdd,0xff,0xff,0xff,0x28,0xff,0xfd,0xfe,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf3,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xc7,0xc3,0xc0,0x9b,0x55,0x4b,0x43,0xff,0x40,0x34,0x2a,0xff,0x48,0x3b,0x31,0xff,0x49,0x3d,0x33,0xff,0x48,0x3e,0x34,0xff,0x4b,0x3f,0x36,0xff,0x4d,0x40,0x38,0xff,0x4c,0x41,0x38,0xff,0x50,0x44,0x3b,0xff,0x4f,0x42,0x39,0xff,0x4f,0x43,0x3a,0xff,0x50,0x43,0x39,0xff,0x52,0x44,0x39,0xff,0x52,0x43,0x3b,0xff,0x52,0x46,0x3a,0xff,0x54,0x47,0x3d,0xff,0x53,0x46,0x3d,0xff,0x54,0x47,0x3e,0xff,0x59,0x49,0x3f,0xff,0x59,0x49,0x40,0xff,0x59,0x4c,0x42,0xff,0x47,0x3c,0x33,0xff,0x29,0x1f,0x1e,0xff,0x16,0x0e,0x10,0xff,0x15,0x0c,0x0e,0xff,0x17,0x0d,0x0f,0xff,0x14,0x0c,0x10,0xff,0x0e,0x07,0x0a,0xff,0x0a,0x04,0x06,0xff,0x10,0x0a,0x0a,0xff,0x10,0x0b,0x0c,0xff,0x0c,0x06,0x08,0xff,0x0b,0x05,0x09,0xff,0x11,0x09,0x0d,0xff,0x13,0x0b,0x0f,0xff,0x16,0x0e,0x10,0xff,0x18,0x0f,0x10,0xff,0x15,0x0b,0x0c,0xff,0x20,0x15,0x14,0xff,0x23,0x18,0x19,0xff,0x0d,0x04,0x07,0xff,0x16,0x0c,0x10,0xff,0x1e,0x13,0x15,0xff,0x2f,0x24,0x23,0xff,0x31,0x24,0x27,0xff,0x26,0x1f,0x29,0xff,0x15,0x1c,0x2c,0xff,0x2f,0x3d,0x51,0xff,0x52,0x5c,0x75,0xff,0x38,0x41,0x5b,0xff,0x18,0x21,0x3c,0xff,0x37,0x41,0x5a,0xff,0x4a,0x53,0x6c,0xff,0x36,0x40,0x59,0xff,0x2e,0x36,0x50,0xff,0x2a,0x33,0x4c,0xff,0x37,0x40,0x5a,0xff,0x31,0x3d,0x59,0xff,0x2d,0x3e,0x5d,0xff,0x45,0x58,0x78,0xff,0x55,0x67,0x86,0xff,0x5a,0x67,0x87,0xff,0x42,0x51,0x6e,0xff,0x37,0x45,0x64,0xff,0x46,0x56,0x77,0xff,0x56,0x6b,0x89,0xff,0x6b,0x80,0xa0,0xff,0x89,0x9d,0xbf,0xff,0x98,0xad,0xc8,0xff,0x99,0xac,0xc3,0xff,0x93,0xa5,0xbd,0xff,0x8d,0xa1,0xbb,0xff,0x91,0xa1,0xb9,0xff,0x96,0xa5,0xba,0xff,0xa4,0xb4,0xc5,0xff,0xba,0xc6,0xd3,0xff,0xc4,0xd2,0xdd,0xff,0xb5,0xc2,0xd5,0xff,0x84,0x91,0xa7,0xff,0x4e,0x5b,0x72,0xff,0x33,0x3e,0x54,0xff,0x2e,0x36,0x4a,0xff,0x24,0x28,0x3c,0xff,0x12,0x15,0x29,0xff,0x14,0x18,0x2a,0xff,0x1a,0x1f,0x31,0xff,0x1e,0x24,0x34,0xff,0x25,0x2d,0x3e,0xff,0x32,0x3a,0x4c,0xff,0x32,0x3a,0x4d,0xff,0x2e,0x35,0x48,0xff,0x2a,0x30,0x41,0xff,0x26,0x2c,0x3c,0xff,0x24,0x29,0x37,0xff,0x1e,0x22,0x2d,0xff,0x1f,0x23,0x2c,0xff,0x25,0x28,0x2f,0xff,0x23,0x24,0x2b,0xff,0x12,0x15,0x1c,0xff,0x6b,0x6f,0x77,0xff,0xe8,0xe8,0xe9,0xdd,0xff,0xff,0xff,0x27,0xff,0xfd,0xfe,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xed,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xfa,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfe,0xf3,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xc8,0xc4,0xc2,0x98,0x55,0x4b,0x43,0xff,0x41,0x36,0x2c,0xff,0x48,0x3c,0x33,0xff,0x4a,0x3e,0x35,0xff,0x4c,0x3f,0x36,0xff,0x4b,0x40,0x36,0xff,0x4e,0x41,0x38,0xff,0x50,0x43,0x3a,0xff,0x4e,0x43,0x39,0xff,0x50,0x44,0x3a,0xff,0x52,0x45,0x3b,0xff,0x52,0x45,0x3c,0xff,0x53,0x45,0x3b,0xff,0x54,0x47,0x3a,0xff,0x55,0x46,0x3b,0xff,0x55,0x48,0x3b,0xff,0x56,0x49,0x3e,0xff,0x55,0x48,0x3f,0xff,0x58,0x4a,0x41,0xff,0x59,0x4b,0x41,0xff,0x5a,0x4c,0x43,0xff,0x58,0x4b,0x42,0xff,0x40,0x35,0x2d,0xff,0x22,0x17,0x18,0xff,0x1b,0x12,0x13,0xff,0x27,0x1e,0x1d,0xff,0x17,0x0d,0x0f,0xff,0x11,0x08,0x0c,0xff,0x11,0x08,0x0a,0xff,0x0f,0x06,0x08,0xff,0x1c,0x14,0x15,0xff,0x19,0x11,0x12,0xff,0x0f,0x06,0x08,0xff,0x12,0x09,0x0d,0xff,0x15,0x0b,0x0f,0xff,0x0d,0x06,0x09,0xff,0x13,0x0a,0x0e,0xff,0x1c,0x12,0x12,0xff,0x24,0x18,0x16,0xff,0x2e,0x21,0x20,0xff,0x21,0x16,0x15,0xff,0x16,0x0c,0x0e,0xff,0x18,0x0b,0x0f,0xff,0x18,0x0c,0x0d,0xff,0x30,0x23,0x23,0xff,0x29,0x1d,0x23,0xff,0x16,0x12,0x1f,0xff,0x2f,0x33,0x4a,0xff,0x49,0x54,0x6b,0xff,0x2e,0x37,0x50,0xff,0x32,0x39,0x52,0xff,0x2f,0x36,0x4f,0xff,0x22,0x2a,0x45,0xff,0x3a,0x43,0x5e,0xff,0x3d,0x46,0x60,0xff,0x26,0x2f,0x48,0xff,0x15,0x1c,0x34,0xff,0x15,0x1c,0x33,0xff,0x35,0x3f,0x55,0xff,0x47,0x51,0x6b,0xff,0x48,0x5a,0x74,0xff,0x50,0x64,0x81,0xff,0x66,0x7b,0x9b,0xff,0x7b,0x91,0xb0,0xff,0x72,0x86,0xa3,0xff,0x67,0x7b,0x98,0xff,0x5f,0x74,0x92,0xff,0x58,0x6d,0x8c,0xff,0x69,0x7d,0x9c,0xff,0x90,0xa3,0xbd,0xff,0xa7,0xb8,0xcd,0xff,0xad,0xbd,0xd1,0xff,0xa9,0xb9,0xcb,0xff,0xaa,0xb8,0xc9,0xff,0x97,0xa4,0xb8,0xff,0x84,0x96,0xaf,0xff,0x75,0x85,0xa2,0xff,0x7e,0x8e,0xad,0xff,0x9b,0xaf,0xc4,0xff,0xb3,0xc5,0xd8,0xff,0xaa,0xb9,0xce,0xff,0x7d,0x89,0x9e,0xff,0x50,0x58,0x6e,0xff,0x32,0x39,0x4f,0xff,0x27,0x2c,0x3f,0xff,0x17,0x1b,0x2c,0xff,0x1f,0x24,0x35,0xff,0x1e,0x23,0x34,0xff,0x19,0x1f,0x2e,0xff,0x19,0x21,0x31,0xff,0x28,0x30,0x41,0xff,0x25,0x2b,0x3c,0xff,0x2a,0x2e,0x3c,0xff,0x2b,0x2d,0x3a,0xff,0x24,0x28,0x32,0xff,0x21,0x26,0x30,0xff,0x26,0x2a,0x33,0xff,0x24,0x26,0x2e,0xff,0x23,0x24,0x2a,0xff,0x0d,0x0d,0x12,0xff,0x16,0x1a,0x27,0xff,0x5a,0x59,0x5e,0xff,0xe8,0xe8,0xe8,0xdc,0xff,0xff,0xff,0x24,0xff,0xfd,0xfe,0x00,0xfe,0xec,0xf3,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xcc,0xc9,0xc6,0x87,0x58,0x4e,0x47,0xff,0x41,0x36,0x2e,0xff,0x47,0x3d,0x33,0xff,0x48,0x3e,0x35,0xff,0x4b,0x3f,0x36,0xff,0x4e,0x40,0x37,0xff,0x4d,0x40,0x37,0xff,0x4f,0x43,0x39,0xff,0x51,0x44,0x3b,0xff,0x52,0x45,0x3c,0xff,0x53,0x46,0x3c,0xff,0x52,0x46,0x3a,0xff,0x54,0x47,0x3d,0xff,0x54,0x47,0x3d,0xff,0x54,0x49,0x3c,0xff,0x57,0x4a,0x3d,0xff,0x58,0x4a,0x3d,0xff,0x58,0x4a,0x3f,0xff,0x59,0x4c,0x42,0xff,0x5b,0x4c,0x43,0xff,0x5b,0x4d,0x44,0xff,0x5b,0x4e,0x45,0xff,0x53,0x47,0x3d,0xff,0x42,0x37,0x2f,0xff,0x33,0x29,0x23,0xff,0x2a,0x20,0x1c,0xff,0x1c,0x13,0x13,0xff,0x12,0x0b,0x0d,0xff,0x16,0x0c,0x0f,0xff,0x22,0x18,0x19,0xff,0x19,0x11,0x11,0xff,0x12,0x0a,0x0b,0xff,0x17,0x0d,0x0f,0xff,0x16,0x0a,0x0d,0xff,0x1e,0x12,0x16,0xff,0x11,0x0a,0x0d,0xff,0x12,0x09,0x0c,0xff,0x14,0x0a,0x0c,0xff,0x24,0x18,0x18,0xff,0x2e,0x21,0x1e,0xff,0x32,0x25,0x22,0xff,0x27,0x1b,0x19,0xff,0x17,0x0e,0x0f,0xff,0x29,0x1b,0x1c,0xff,0x1f,0x13,0x13,0xff,0x24,0x19,0x1b,0xff,0x1d,0x1a,0x26,0xff,0x41,0x48,0x5b,0xff,0x54,0x5d,0x77,0xff,0x35,0x3e,0x5a,0xff,0x3a,0x45,0x62,0xff,0x4e,0x59,0x76,0xff,0x54,0x63,0x80,0xff,0x59,0x68,0x86,0xff,0x49,0x56,0x72,0xff,0x47,0x52,0x6f,0xff,0x3d,0x47,0x63,0xff,0x2a,0x33,0x49,0xff,0x13,0x1c,0x30,0xff,0x24,0x2e,0x43,0xff,0x40,0x48,0x61,0xff,0x56,0x60,0x7b,0xff,0x5e,0x6b,0x8a,0xff,0x59,0x6c,0x8d,0xff,0x5e,0x74,0x95,0xff,0x74,0x8a,0xab,0xff,0x7c,0x90,0xb2,0xff,0x84,0x9a,0xb9,0xff,0x88,0x9e,0xbb,0xff,0x7a,0x8d,0xaa,0xff,0x77,0x8b,0xa6,0xff,0x85,0x99,0xb3,0xff,0x91,0xa4,0xba,0xff,0x9e,0xaf,0xc5,0xff,0xa2,0xb5,0xc8,0xff,0xa8,0xbb,0xcd,0xff,0xab,0xbb,0xd2,0xff,0x9b,0xaa,0xc3,0xff,0x7e,0x8f,0xad,0xff,0x6c,0x7f,0xa1,0xff,0x72,0x88,0xa8,0xff,0x83,0x99,0xb6,0xff,0x99,0xae,0xc6,0xff,0x91,0xa5,0xbc,0xff,0x60,0x6f,0x84,0xff,0x37,0x41,0x53,0xff,0x1a,0x1f,0x2d,0xff,0x16,0x1c,0x2b,0xff,0x19,0x20,0x30,0xff,0x1d,0x22,0x31,0xff,0x1b,0x22,0x31,0xff,0x1d,0x25,0x35,0xff,0x25,0x2c,0x3c,0xff,0x16,0x18,0x23,0xff,0x17,0x17,0x20,0xff,0x1b,0x1d,0x28,0xff,0x18,0x1b,0x25,0xff,0x16,0x19,0x22,0xff,0x0f,0x0f,0x17,0xff,0x0d,0x0d,0x13,0xff,0x08,0x05,0x08,0xff,0x1a,0x1c,0x29,0xff,0x15,0x14,0x1d,0xff,0x63,0x62,0x67,0xff,0xee,0xed,0xee,0xd1,0xff,0xff,0xff,0x16,0xff,0xfc,0xfd,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xef,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xd7,0xd4,0xd2,0x6c,0x5d,0x55,0x4b,0xff,0x40,0x35,0x2d,0xff,0x49,0x3d,0x36,0xff,0x4b,0x3f,0x35,0xff,0x4c,0x3f,0x36,0xff,0x4d,0x41,0x38,0xff,0x4f,0x43,0x35,0xff,0x50,0x44,0x38,0xff,0x4f,0x42,0x3b,0xff,0x52,0x45,0x3c,0xff,0x52,0x46,0x3c,0xff,0x55,0x47,0x3e,0xff,0x57,0x48,0x40,0xff,0x56,0x49,0x40,0xff,0x58,0x4a,0x40,0xff,0x59,0x4a,0x3f,0xff,0x5a,0x4b,0x41,0xff,0x5b,0x4c,0x41,0xff,0x5b,0x4d,0x41,0xff,0x5c,0x4e,0x43,0xff,0x5e,0x4e,0x46,0xff,0x5f,0x4f,0x47,0xff,0x5d,0x4e,0x45,0xff,0x4d,0x3f,0x37,0xff,0x3a,0x2d,0x2b,0xff,0x25,0x1c,0x1d,0xff,0x19,0x0f,0x13,0xff,0x12,0x09,0x0c,0xff,0x1d,0x13,0x15,0xff,0x22,0x16,0x18,0xff,0x2b,0x20,0x21,0xff,0x1b,0x12,0x15,0xff,0x17,0x0c,0x11,0xff,0x12,0x07,0x0a,0xff,0x16,0x0c,0x0e,0xff,0x1f,0x15,0x1a,0xff,0x0f,0x08,0x0b,0xff,0x18,0x0d,0x0f,0xff,0x23,0x15,0x16,0xff,0x36,0x27,0x27,0xff,0x2f,0x21,0x21,0xff,0x28,0x1a,0x19,0xff,0x34,0x25,0x26,0xff,0x18,0x10,0x11,0xff,0x36,0x29,0x26,0xff,0x32,0x25,0x26,0xff,0x31,0x2a,0x30,0xff,0x40,0x46,0x57,0xff,0x5e,0x6c,0x84,0xff,0x55,0x61,0x7f,0xff,0x53,0x60,0x7e,0xff,0x63,0x70,0x8f,0xff,0x62,0x73,0x95,0xff,0x69,0x7b,0x9f,0xff,0x69,0x7b,0x9d,0xff,0x63,0x73,0x93,0xff,0x59,0x67,0x85,0xff,0x54,0x5f,0x7a,0xff,0x55,0x5e,0x75,0xff,0x3d,0x45,0x5b,0xff,0x1f,0x27,0x3e,0xff,0x1e,0x24,0x3d,0xff,0x21,0x28,0x41,0xff,0x41,0x49,0x65,0xff,0x53,0x63,0x80,0xff,0x59,0x6e,0x8d,0xff,0x66,0x7a,0x9e,0xff,0x74,0x88,0xae,0xff,0x80,0x97,0xb6,0xff,0x85,0x9a,0xb9,0xff,0x8e,0xa2,0xc0,0xff,0x8d,0xa3,0xbe,0xff,0x85,0x9b,0xb4,0xff,0x7f,0x92,0xae,0xff,0x7a,0x8c,0xa8,0xff,0x78,0x8a,0xa8,0xff,0x84,0x96,0xb4,0xff,0x7f,0x92,0xae,0xff,0x80,0x97,0xb3,0xff,0x85,0x9b,0xb7,0xff,0x8a,0x9d,0xbb,0xff,0x80,0x92,0xb3,0xff,0x70,0x85,0xa7,0xff,0x64,0x7a,0x9e,0xff,0x70,0x86,0xaa,0xff,0x76,0x89,0xa9,0xff,0x72,0x82,0x9f,0xff,0x47,0x52,0x66,0xff,0x19,0x1d,0x2c,0xff,0x0d,0x14,0x23,0xff,0x18,0x1e,0x2e,0xff,0x1c,0x22,0x33,0xff,0x1c,0x1f,0x32,0xff,0x26,0x2c,0x3e,0xff,0x28,0x30,0x3d,0xff,0x09,0x09,0x13,0xff,0x0a,0x0b,0x15,0xff,0x19,0x1a,0x25,0xff,0x15,0x15,0x1f,0xff,0x0e,0x0c,0x15,0xff,0x11,0x0d,0x13,0xff,0x18,0x19,0x1d,0xff,0x33,0x38,0x49,0xff,0x13,0x11,0x1a,0xff,0x0a,0x07,0x0e,0xff,0x76,0x76,0x79,0xff,0xf4,0xf3,0xf3,0xbb,0xff,0xff,0xff,0x09,0xff,0xfb,0xfc,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf8,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xeb,0xf3,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xe2,0xe1,0xdf,0x54,0x67,0x5d,0x57,0xfc,0x40,0x35,0x2c,0xff,0x49,0x3e,0x36,0xff,0x4b,0x40,0x37,0xff,0x4d,0x40,0x37,0xff,0x4e,0x42,0x39,0xff,0x4f,0x42,0x38,0xff,0x50,0x44,0x37,0xff,0x53,0x45,0x3b,0xff,0x54,0x46,0x3e,0xff,0x54,0x47,0x3e,0xff,0x55,0x48,0x3f,0xff,0x55,0x48,0x3e,0xff,0x58,0x49,0x3f,0xff,0x58,0x4a,0x41,0xff,0x59,0x4b,0x40,0xff,0x5b,0x4c,0x40,0xff,0x5c,0x4e,0x42,0xff,0x5d,0x4e,0x41,0xff,0x5e,0x4f,0x43,0xff,0x5e,0x50,0x44,0xff,0x5f,0x50,0x46,0xff,0x61,0x51,0x47,0xff,0x60,0x51,0x47,0xff,0x57,0x48,0x3e,0xff,0x47,0x3a,0x33,0xff,0x33,0x29,0x26,0xff,0x1b,0x12,0x14,0xff,0x17,0x0e,0x10,0xff,0x1f,0x14,0x16,0xff,0x26,0x1b,0x1d,0xff,0x17,0x0e,0x10,0xff,0x18,0x0f,0x12,0xff,0x20,0x13,0x19,0xff,0x12,0x09,0x0c,0xff,0x0f,0x09,0x0a,0xff,0x19,0x0f,0x13,0xff,0x16,0x0c,0x10,0xff,0x1b,0x11,0x14,0xff,0x2b,0x1e,0x20,0xff,0x30,0x22,0x22,0xff,0x2c,0x1f,0x1f,0xff,0x26,0x18,0x19,0xff,0x3c,0x2c,0x2d,0xff,0x29,0x1f,0x1d,0xff,0x3b,0x2b,0x27,0xff,0x32,0x21,0x23,0xff,0x34,0x34,0x40,0xff,0x59,0x64,0x7e,0xff,0x6a,0x79,0x96,0xff,0x60,0x71,0x91,0xff,0x5a,0x6c,0x8d,0xff,0x68,0x79,0x9a,0xff,0x6c,0x7f,0xa2,0xff,0x78,0x8c,0xb0,0xff,0x71,0x85,0xa8,0xff,0x68,0x7c,0xa0,0xff,0x57,0x68,0x8b,0xff,0x51,0x5d,0x7d,0xff,0x59,0x62,0x80,0xff,0x54,0x5d,0x78,0xff,0x37,0x3e,0x58,0xff,0x20,0x26,0x3e,0xff,0x11,0x17,0x2e,0xff,0x0d,0x11,0x28,0xff,0x1e,0x25,0x3b,0xff,0x3d,0x4b,0x69,0xff,0x66,0x78,0x96,0xff,0x7a,0x93,0xb0,0xff,0x7e,0x97,0xb6,0xff,0x86,0x9f,0xbd,0xff,0x8b,0xa5,0xc2,0xff,0x93,0xaa,0xc3,0xff,0x99,0xad,0xc7,0xff,0x9f,0xb2,0xcb,0xff,0x9b,0xae,0xc7,0xff,0x86,0x99,0xb5,0xff,0x7f,0x91,0xaf,0xff,0x7b,0x90,0xac,0xff,0x76,0x8c,0xaa,0xff,0x74,0x8b,0xab,0xff,0x68,0x7f,0xa0,0xff,0x73,0x88,0xa9,0xff,0x73,0x8b,0xad,0xff,0x66,0x7e,0xa1,0xff,0x68,0x7d,0xa0,0xff,0x6b,0x80,0x9f,0xff,0x5e,0x73,0x91,0xff,0x61,0x71,0x8d,0xff,0x4b,0x54,0x69,0xff,0x1d,0x1e,0x30,0xff,0x0d,0x0f,0x22,0xff,0x15,0x1b,0x2c,0xff,0x1b,0x23,0x33,0xff,0x1d,0x22,0x34,0xff,0x27,0x2d,0x43,0xff,0x32,0x39,0x4f,0xff,0x19,0x1c,0x27,0xff,0x0d,0x0a,0x14,0xff,0x08,0x04,0x0c,0xff,0x0a,0x06,0x09,0xff,0x1d,0x1e,0x22,0xff,0x3f,0x4b,0x5d,0xff,0x31,0x36,0x43,0xff,0x11,0x0d,0x12,0xff,0x0d,0x0c,0x12,0xff,0x30,0x35,0x3b,0xff,0x7e,0x7d,0x7f,0xff,0xfb,0xfa,0xfa,0xa4,0xff,0xff,0xff,0x01,0xfe,0xf7,0xfa,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xe8,0xf1,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xf0,0xef,0xee,0x33,0x75,0x6d,0x67,0xee,0x40,0x34,0x2c,0xff,0x4a,0x3e,0x37,0xff,0x4b,0x40,0x37,0xff,0x4c,0x41,0x37,0xff,0x4d,0x40,0x37,0xff,0x4e,0x44,0x3a,0xff,0x4f,0x43,0x3a,0xff,0x53,0x44,0x3a,0xff,0x55,0x46,0x3d,0xff,0x55,0x47,0x3e,0xff,0x56,0x4a,0x40,0xff,0x56,0x49,0x40,0xff,0x57,0x4a,0x40,0xff,0x58,0x4c,0x40,0xff,0x5c,0x4d,0x44,0xff,0x5c,0x4d,0x43,0xff,0x5c,0x4e,0x42,0xff,0x5d,0x4f,0x42,0xff,0x60,0x51,0x43,0xff,0x61,0x52,0x46,0xff,0x61,0x52,0x48,0xff,0x62,0x54,0x48,0xff,0x63,0x55,0x49,0xff,0x65,0x56,0x4b,0xff,0x69,0x59,0x4e,0xff,0x66,0x58,0x4c,0xff,0x44,0x39,0x33,0xff,0x1f,0x15,0x14,0xff,0x12,0x09,0x0a,0xff,0x16,0x0d,0x0e,0xff,0x20,0x15,0x17,0xff,0x12,0x0b,0x0c,0xff,0x09,0x02,0x05,0xff,0x0e,0x06,0x0a,0xff,0x0d,0x08,0x0a,0xff,0x0f,0x0a,0x0b,0xff,0x23,0x17,0x1b,0xff,0x20,0x14,0x17,0xff,0x16,0x0c,0x10,0xff,0x22,0x16,0x19,0xff,0x27,0x1b,0x1a,0xff,0x20,0x13,0x13,0xff,0x20,0x11,0x14,0xff,0x2d,0x1f,0x21,0xff,0x40,0x31,0x2b,0xff,0x34,0x21,0x20,0xff,0x2c,0x21,0x23,0xff,0x49,0x52,0x66,0xff,0x50,0x62,0x82,0xff,0x56,0x6c,0x8b,0xff,0x57,0x6a,0x8a,0xff,0x59,0x6c,0x90,0xff,0x6b,0x81,0xa7,0xff,0x79,0x8e,0xb3,0xff,0x7b,0x90,0xb2,0xff,0x81,0x95,0xb8,0xff,0x7c,0x8d,0xb4,0xff,0x69,0x79,0x9e,0xff,0x52,0x61,0x82,0xff,0x45,0x4e,0x70,0xff,0x45,0x4e,0x6d,0xff,0x3d,0x45,0x61,0xff,0x2a,0x30,0x4a,0xff,0x1a,0x1f,0x38,0xff,0x10,0x15,0x2d,0xff,0x0d,0x11,0x27,0xff,0x0f,0x11,0x2a,0xff,0x1d,0x21,0x3f,0xff,0x48,0x59,0x77,0xff,0x77,0x8e,0xab,0xff,0x77,0x8f,0xad,0xff,0x73,0x8d,0xac,0xff,0x80,0x9c,0xbb,0xff,0x97,0xb0,0xcd,0xff,0xa8,0xbb,0xd4,0xff,0xaa,0xbc,0xd1,0xff,0xa8,0xba,0xce,0xff,0xa1,0xb5,0xcb,0xff,0x97,0xad,0xca,0xff,0x8a,0xa0,0xc0,0xff,0x81,0x98,0xb8,0xff,0x6f,0x86,0xa6,0xff,0x67,0x7d,0x9d,0xff,0x5f,0x74,0x95,0xff,0x60,0x74,0x95,0xff,0x5b,0x6e,0x8d,0xff,0x54,0x68,0x87,0xff,0x52,0x66,0x85,0xff,0x54,0x68,0x86,0xff,0x62,0x78,0x94,0xff,0x4e,0x59,0x6e,0xff,0x1b,0x1c,0x2f,0xff,0x0b,0x0f,0x21,0xff,0x16,0x1b,0x2b,0xff,0x22,0x28,0x37,0xff,0x1e,0x24,0x34,0xff,0x26,0x2f,0x41,0xff,0x3d,0x4c,0x62,0xff,0x41,0x4b,0x5f,0xff,0x3c,0x48,0x57,0xff,0x54,0x61,0x6c,0xff,0x5c,0x68,0x7e,0xff,0x2a,0x31,0x45,0xff,0x12,0x0e,0x14,0xff,0x1b,0x17,0x1a,0xff,0x1b,0x1b,0x21,0xff,0x45,0x4c,0x58,0xff,0x1f,0x1c,0x1f,0xff,0x98,0x94,0x90,0xff,0xff,0xff,0xff,0x80,0xff,0xff,0xff,0x00,0xff,0xf4,0xf8,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xf6,0xfa,0x00,0xff,0xff,0xff,0x00,0xfa,0xfa,0xf9,0x16,0x8e,0x87,0x82,0xd3,0x44,0x38,0x2f,0xff,0x4b,0x3f,0x36,0xff,0x4e,0x41,0x38,0xff,0x4e,0x41,0x39,0xff,0x4d,0x41,0x3a,0xff,0x4e,0x43,0x3c,0xff,0x51,0x44,0x3d,0xff,0x53,0x45,0x3d,0xff,0x55,0x46,0x3c,0xff,0x55,0x47,0x3e,0xff,0x57,0x49,0x3f,0xff,0x59,0x4b,0x40,0xff,0x5a,0x4b,0x42,0xff,0x5b,0x4d,0x42,0xff,0x5c,0x4e,0x40,0xff,0x5d,0x4e,0x44,0xff,0x5c,0x50,0x43,0xff,0x5d,0x51,0x44,0xff,0x60,0x51,0x46,0xff,0x63,0x53,0x46,0xff,0x63,0x54,0x46,0xff,0x63,0x54,0x4a,0xff,0x67,0x56,0x4b,0xff,0x66,0x56,0x4d,0xff,0x66,0x58,0x4c,0xff,0x6b,0x5e,0x4f,0xff,0x64,0x55,0x48,0xff,0x35,0x2b,0x27,0xff,0x1f,0x14,0x14,0xff,0x2b,0x20,0x1f,0xff,0x25,0x1a,0x1c,0xff,0x17,0x0c,0x11,0xff,0x16,0x0d,0x0f,0xff,0x11,0x09,0x0b,0xff,0x12,0x0a,0x0e,0xff,0x15,0x0e,0x11,0xff,0x1c,0x14,0x18,0xff,0x1e,0x13,0x17,0xff,0x19,0x0f,0x12,0xff,0x1b,0x10,0x15,0xff,0x1e,0x12,0x15,0xff,0x22,0x17,0x16,0xff,0x27,0x18,0x19,0xff,0x26,0x16,0x1b,0xff,0x1e,0x10,0x13,0xff,0x46,0x37,0x31,0xff,0x23,0x17,0x16,0xff,0x30,0x30,0x39,0xff,0x50,0x5f,0x7f,0xff,0x4a,0x5d,0x7f,0xff,0x3f,0x54,0x79,0xff,0x51,0x66,0x8d,0xff,0x61,0x76,0xa0,0xff,0x71,0x87,0xb0,0xff,0x7f,0x95,0xbc,0xff,0x7b,0x92,0xb8,0xff,0x70,0x85,0xaf,0xff,0x67,0x7b,0xa7,0xff,0x5c,0x6f,0x9b,0xff,0x58,0x6b,0x94,0xff,0x55,0x64,0x8a,0xff,0x3f,0x4c,0x6f,0xff,0x36,0x41,0x5f,0xff,0x2e,0x37,0x53,0xff,0x23,0x29,0x43,0xff,0x1f,0x24,0x3d,0xff,0x19,0x1d,0x38,0xff,0x18,0x1c,0x37,0xff,0x12,0x16,0x31,0xff,0x10,0x13,0x31,0xff,0x37,0x43,0x61,0xff,0x6d,0x82,0xa2,0xff,0x73,0x89,0xaa,0xff,0x65,0x7c,0x9f,0xff,0x6e,0x8b,0xab,0xff,0x88,0xa2,0xc0,0xff,0x99,0xad,0xc7,0xff,0xa5,0xb7,0xce,0xff,0xb0,0xc2,0xd9,0xff,0xa4,0xb4,0xcf,0xff,0x95,0xa6,0xc1,0xff,0x97,0xac,0xc5,0xff,0x8f,0xa7,0xc4,0xff,0x88,0x9f,0xbe,0xff,0x79,0x8d,0xae,0xff,0x4c,0x5e,0x7c,0xff,0x4f,0x60,0x7e,0xff,0x58,0x6b,0x89,0xff,0x51,0x64,0x83,0xff,0x47,0x5a,0x78,0xff,0x53,0x69,0x85,0xff,0x5f,0x73,0x8e,0xff,0x55,0x61,0x7b,0xff,0x30,0x3b,0x4d,0xff,0x23,0x2b,0x3c,0xff,0x21,0x26,0x38,0xff,0x25,0x2c,0x3c,0xff,0x24,0x2b,0x3a,0xff,0x28,0x33,0x44,0xff,0x3c,0x48,0x60,0xff,0x5b,0x68,0x80,0xff,0x53,0x61,0x74,0xff,0x27,0x28,0x34,0xff,0x0a,0x04,0x0b,0xff,0x0c,0x09,0x0d,0xff,0x09,0x06,0x0a,0xff,0x17,0x15,0x1d,0xff,0x53,0x5c,0x6a,0xff,0x17,0x15,0x18,0xff,0x2d,0x23,0x1c,0xff,0xbd,0xb9,0xb6,0xfe,0xff,0xff,0xff,0x57,0xff,0xff,0xff,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xaa,0xa4,0xa1,0xa9,0x47,0x3c,0x33,0xff,0x4a,0x3e,0x36,0xff,0x4e,0x41,0x39,0xff,0x50,0x43,0x3a,0xff,0x50,0x43,0x3b,0xff,0x50,0x43,0x3c,0xff,0x51,0x44,0x3d,0xff,0x53,0x46,0x3f,0xff,0x55,0x46,0x3e,0xff,0x56,0x47,0x3e,0xff,0x57,0x48,0x3e,0xff,0x59,0x4b,0x3f,0xff,0x5b,0x4c,0x40,0xff,0x5b,0x4d,0x40,0xff,0x5d,0x4e,0x42,0xff,0x5f,0x50,0x44,0xff,0x5f,0x50,0x45,0xff,0x60,0x52,0x47,0xff,0x60,0x53,0x47,0xff,0x62,0x53,0x48,0xff,0x64,0x53,0x48,0xff,0x66,0x56,0x49,0xff,0x66,0x57,0x49,0xff,0x68,0x57,0x4c,0xff,0x69,0x59,0x4d,0xff,0x6a,0x5b,0x4d,0xff,0x66,0x58,0x4a,0xff,0x4a,0x3a,0x30,0xff,0x32,0x24,0x22,0xff,0x2c,0x21,0x21,0xff,0x37,0x2b,0x2c,0xff,0x2a,0x1e,0x20,0xff,0x1f,0x14,0x17,0xff,0x1f,0x16,0x18,0xff,0x1a,0x11,0x12,0xff,0x25,0x1a,0x1e,0xff,0x20,0x17,0x1b,0xff,0x14,0x0c,0x0f,0xff,0x14,0x0a,0x0e,0xff,0x1a,0x10,0x14,0xff,0x26,0x1b,0x1e,0xff,0x21,0x15,0x17,0xff,0x18,0x0d,0x12,0xff,0x2b,0x1d,0x21,0xff,0x3e,0x2f,0x2d,0xff,0x1a,0x10,0x13,0xff,0x2c,0x1f,0x24,0xff,0x2c,0x23,0x2d,0xff,0x31,0x39,0x4b,0xff,0x4c,0x5e,0x83,0xff,0x40,0x53,0x7c,0xff,0x43,0x5b,0x87,0xff,0x60,0x78,0xa7,0xff,0x76,0x90,0xbe,0xff,0x7e,0x9a,0xc7,0xff,0x7e,0x9a,0xc7,0xff,0x78,0x93,0xc2,0xff,0x6b,0x86,0xb8,0xff,0x5e,0x7a,0xaf,0xff,0x57,0x74,0xa7,0xff,0x5b,0x76,0xa6,0xff,0x59,0x70,0x9f,0xff,0x52,0x66,0x90,0xff,0x43,0x54,0x77,0xff,0x38,0x42,0x64,0xff,0x30,0x38,0x58,0xff,0x2c,0x33,0x51,0xff,0x26,0x2c,0x49,0xff,0x21,0x28,0x45,0xff,0x1e,0x25,0x42,0xff,0x1b,0x20,0x3e,0xff,0x13,0x18,0x36,0xff,0x2a,0x31,0x50,0xff,0x6e,0x7c,0x9c,0xff,0x80,0x93,0xb3,0xff,0x60,0x73,0x93,0xff,0x64,0x7f,0x9e,0xff,0x7b,0x96,0xb6,0xff,0x6f,0x87,0xa9,0xff,0x72,0x88,0xaa,0xff,0x9c,0xb0,0xca,0xff,0xa7,0xb8,0xcf,0xff,0x94,0xa5,0xbd,0xff,0x97,0xab,0xc2,0xff,0xa7,0xbc,0xd1,0xff,0xa4,0xb9,0xd0,0xff,0x88,0x9c,0xb6,0xff,0x54,0x67,0x85,0xff,0x42,0x54,0x6e,0xff,0x47,0x59,0x77,0xff,0x4c,0x61,0x7e,0xff,0x45,0x57,0x72,0xff,0x31,0x3d,0x5c,0xff,0x33,0x3f,0x5c,0xff,0x45,0x53,0x67,0xff,0x43,0x4d,0x5e,0xff,0x3b,0x40,0x51,0xff,0x29,0x2e,0x3e,0xff,0x26,0x2c,0x3d,0xff,0x20,0x28,0x3a,0xff,0x20,0x29,0x3a,0xff,0x1d,0x27,0x36,0xff,0x20,0x29,0x35,0xff,0x28,0x2b,0x35,0xff,0x19,0x18,0x20,0xff,0x0e,0x0d,0x13,0xff,0x0b,0x05,0x09,0xff,0x1b,0x1c,0x27,0xff,0x53,0x60,0x71,0xff,0x32,0x2f,0x2e,0xff,0x29,0x1f,0x19,0xff,0x54,0x4b,0x48,0xff,0xdd,0xdb,0xdb,0xea,0xff,0xff,0xff,0x2a,0xff,0xfd,0xfe,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf6,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xed,0xf4,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x00,0xcb,0xc7,0xc5,0x74,0x55,0x49,0x42,0xff,0x49,0x3e,0x35,0xff,0x4e,0x41,0x39,0xff,0x4f,0x42,0x3a,0xff,0x52,0x45,0x3c,0xff,0x52,0x44,0x3e,0xff,0x53,0x45,0x3e,0xff,0x53,0x45,0x3d,0xff,0x55,0x47,0x3f,0xff,0x56,0x47,0x3f,0xff,0x58,0x49,0x40,0xff,0x5a,0x4c,0x41,0xff,0x5b,0x4d,0x41,0xff,0x5c,0x4e,0x41,0xff,0x5d,0x4f,0x42,0xff,0x5f,0x51,0x45,0xff,0x60,0x51,0x46,0xff,0x60,0x51,0x45,0xff,0x61,0x53,0x47,0xff,0x63,0x54,0x49,0xff,0x64,0x55,0x4a,0xff,0x66,0x56,0x4a,0xff,0x67,0x56,0x4a,0xff,0x68,0x58,0x4b,0xff,0x6a,0x5b,0x4d,0xff,0x6a,0x5d,0x4c,0xff,0x6e,0x61,0x50,0xff,0x64,0x56,0x48,0xff,0x4e,0x3f,0x35,0xff,0x40,0x33,0x2c,0xff,0x38,0x2c,0x29,0xff,0x19,0x0d,0x11,0xff,0x14,0x09,0x0c,0xff,0x17,0x0f,0x10,0xff,0x17,0x0d,0x0f,0xff,0x28,0x1c,0x1f,0xff,0x30,0x24,0x28,0xff,0x13,0x0a,0x0e,0xff,0x17,0x0e,0x13,0xff,0x20,0x15,0x19,0xff,0x1b,0x10,0x13,0xff,0x2c,0x20,0x22,0xff,0x26,0x1b,0x1e,0xff,0x0e,0x04,0x0d,0xff,0x23,0x16,0x1b,0xff,0x45,0x37,0x32,0xff,0x40,0x36,0x3e,0xff,0x3c,0x39,0x46,0xff,0x2e,0x2d,0x42,0xff,0x3a,0x42,0x5a,0xff,0x4d,0x61,0x86,0xff,0x5a,0x74,0x9d,0xff,0x76,0x95,0xc1,0xff,0x86,0xa5,0xd1,0xff,0x8c,0xaa,0xd5,0xff,0x8a,0xa7,0xd3,0xff,0x86,0xa3,0xcf,0xff,0x87,0xa3,0xd1,0xff,0x88,0xa3,0xd1,0xff,0x87,0xa2,0xce,0xff,0x86,0xa0,0xcd,0xff,0x85,0xa0,0xce,0xff,0x7c,0x95,0xc5,0xff,0x6b,0x84,0xb4,0xff,0x64,0x79,0xa8,0xff,0x5d,0x6d,0x9a,0xff,0x4f,0x5e,0x82,0xff,0x47,0x53,0x74,0xff,0x3b,0x45,0x65,0xff,0x32,0x3b,0x57,0xff,0x2d,0x35,0x53,0xff,0x25,0x2d,0x4d,0xff,0x1d,0x27,0x45,0xff,0x19,0x1d,0x3c,0xff,0x25,0x2e,0x4d,0xff,0x65,0x77,0x96,0xff,0x86,0x9a,0xb8,0xff,0x58,0x6c,0x8a,0xff,0x58,0x6d,0x8d,0xff,0x7d,0x91,0xb3,0xff,0x68,0x7e,0xa0,0xff,0x48,0x5d,0x7f,0xff,0x69,0x7c,0x9b,0xff,0x90,0xa4,0xbf,0xff,0x96,0xa9,0xc5,0xff,0x9b,0xaf,0xca,0xff,0xa9,0xbd,0xd5,0xff,0xaa,0xbe,0xd5,0xff,0x90,0xa1,0xbf,0xff,0x5e,0x72,0x93,0xff,0x43,0x55,0x75,0xff,0x43,0x4e,0x6e,0xff,0x4b,0x58,0x75,0xff,0x52,0x62,0x7b,0xff,0x42,0x4b,0x63,0xff,0x30,0x3b,0x4f,0xff,0x37,0x40,0x52,0xff,0x2c,0x31,0x43,0xff,0x1a,0x1e,0x2c,0xff,0x22,0x26,0x36,0xff,0x26,0x2b,0x3e,0xff,0x27,0x30,0x41,0xff,0x22,0x2b,0x3c,0xff,0x1b,0x22,0x33,0xff,0x1e,0x26,0x36,0xff,0x27,0x2e,0x3a,0xff,0x1f,0x24,0x2d,0xff,0x13,0x16,0x1c,0xff,0x34,0x3a,0x49,0xff,0x3d,0x4a,0x5b,0xff,0x25,0x24,0x22,0xff,0x44,0x3e,0x3b,0xff,0x45,0x3e,0x3b,0xff,0x7a,0x74,0x6f,0xff,0xf0,0xef,0xee,0xc5,0xff,0xff,0xff,0x09,0xfe,0xf9,0xfb,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xff,0xfb,0xfc,0x00,0xff,0xff,0xff,0x00,0xe7,0xe5,0xe4,0x39,0x69,0x5e,0x58,0xf5,0x47,0x3c,0x34,0xff,0x51,0x43,0x3c,0xff,0x52,0x45,0x3c,0xff,0x52,0x45,0x3c,0xff,0x51,0x44,0x3e,0xff,0x54,0x46,0x40,0xff,0x55,0x48,0x40,0xff,0x56,0x49,0x3f,0xff,0x59,0x4a,0x41,0xff,0x59,0x4a,0x41,0xff,0x5a,0x4b,0x42,0xff,0x5b,0x4c,0x44,0xff,0x5c,0x4e,0x43,0xff,0x5f,0x51,0x43,0xff,0x5f,0x50,0x45,0xff,0x62,0x52,0x46,0xff,0x64,0x53,0x45,0xff,0x61,0x54,0x46,0xff,0x64,0x55,0x47,0xff,0x66,0x56,0x48,0xff,0x68,0x58,0x4b,0xff,0x68,0x59,0x49,0xff,0x69,0x5a,0x4b,0xff,0x69,0x5a,0x4d,0xff,0x5d,0x4e,0x43,0xff,0x64,0x57,0x4a,0xff,0x61,0x56,0x48,0xff,0x48,0x3b,0x36,0xff,0x2a,0x1a,0x1e,0xff,0x2f,0x23,0x24,0xff,0x24,0x19,0x1b,0xff,0x16,0x0c,0x10,0xff,0x1b,0x0f,0x15,0xff,0x1e,0x11,0x15,0xff,0x1f,0x14,0x18,0xff,0x1c,0x10,0x15,0xff,0x16,0x0b,0x11,0xff,0x0e,0x06,0x0d,0xff,0x0e,0x06,0x0c,0xff,0x22,0x16,0x1b,0xff,0x22,0x14,0x19,0xff,0x2c,0x1e,0x24,0xff,0x20,0x14,0x19,0xff,0x0f,0x04,0x0b,0xff,0x1f,0x10,0x16,0xff,0x44,0x35,0x31,0xff,0x76,0x7a,0x83,0xff,0x48,0x52,0x67,0xff,0x4a,0x53,0x71,0xff,0x4d,0x5d,0x82,0xff,0x6a,0x85,0xaf,0xff,0x78,0x9b,0xc6,0xff,0x7f,0xa1,0xcf,0xff,0x87,0xa9,0xd5,0xff,0x8f,0xae,0xdb,0xff,0x91,0xae,0xdb,0xff,0x90,0xab,0xd9,0xff,0x8e,0xaa,0xd8,0xff,0x95,0xaf,0xdb,0xff,0x99,0xb3,0xdd,0xff,0x9a,0xb2,0xdc,0xff,0x96,0xaf,0xdb,0xff,0x94,0xae,0xdb,0xff,0x8b,0xa5,0xd3,0xff,0x84,0x9d,0xcb,0xff,0x7c,0x93,0xc2,0xff,0x70,0x88,0xb5,0xff,0x67,0x7d,0xa9,0xff,0x58,0x6c,0x96,0xff,0x4e,0x5c,0x7d,0xff,0x41,0x4c,0x6d,0xff,0x38,0x41,0x63,0xff,0x2c,0x36,0x54,0xff,0x23,0x2b,0x49,0xff,0x12,0x19,0x38,0xff,0x1a,0x23,0x40,0xff,0x64,0x75,0x94,0xff,0x8c,0x9f,0xbd,0xff,0x65,0x78,0x97,0xff,0x55,0x69,0x89,0xff,0x7a,0x90,0xb0,0xff,0x69,0x7c,0x9c,0xff,0x39,0x46,0x69,0xff,0x3a,0x4a,0x6a,0xff,0x5c,0x6f,0x8f,0xff,0x76,0x89,0xaa,0xff,0x88,0x9b,0xba,0xff,0x98,0xaa,0xc6,0xff,0xa0,0xb1,0xcf,0xff,0x88,0x9c,0xb9,0xff,0x5d,0x72,0x8f,0xff,0x4c,0x5e,0x7d,0xff,0x43,0x4f,0x6d,0xff,0x40,0x4d,0x67,0xff,0x48,0x57,0x6e,0xff,0x3f,0x4d,0x60,0xff,0x38,0x42,0x53,0xff,0x36,0x3c,0x4d,0xff,0x18,0x1b,0x29,0xff,0x08,0x09,0x18,0xff,0x20,0x22,0x34,0xff,0x26,0x2b,0x3d,0xff,0x2d,0x35,0x48,0xff,0x27,0x2f,0x43,0xff,0x1c,0x22,0x32,0xff,0x1f,0x26,0x33,0xff,0x1c,0x24,0x30,0xff,0x21,0x2a,0x35,0xff,0x3f,0x49,0x5a,0xff,0x31,0x34,0x3d,0xff,0x31,0x30,0x30,0xff,0x3f,0x3c,0x3d,0xff,0x4b,0x42,0x3b,0xff,0x42,0x38,0x2e,0xff,0x95,0x8e,0x88,0xff,0xff,0xff,0xff,0x8a,0xff,0xff,0xff,0x00,0xfe,0xf4,0xf8,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf5,0xf9,0x00,0xff,0xff,0xff,0x00,0xfc,0xfc,0xfc,0x0a,0x8e,0x87,0x82,0xc9,0x48,0x3b,0x34,0xff,0x51,0x43,0x3d,0xff,0x53,0x45,0x3e,0xff,0x54,0x46,0x3f,0xff,0x55,0x47,0x40,0xff,0x55,0x47,0x40,0xff,0x57,0x48,0x40,0xff,0x58,0x49,0x41,0xff,0x58,0x4a,0x41,0xff,0x5b,0x4d,0x41,0xff,0x5c,0x4d,0x43,0xff,0x5d,0x4e,0x43,0xff,0x5e,0x4f,0x45,0xff,0x5e,0x50,0x44,0xff,0x60,0x52,0x46,0xff,0x61,0x53,0x47,0xff,0x63,0x55,0x45,0xff,0x64,0x54,0x48,0xff,0x66,0x56,0x4b,0xff,0x67,0x57,0x4b,0xff,0x68,0x58,0x4b,0xff,0x6a,0x5a,0x4d,0xff,0x6b,0x5b,0x4c,0xff,0x6b,0x5c,0x4d,0xff,0x6e,0x60,0x52,0xff,0x51,0x44,0x39,0xff,0x34,0x26,0x26,0xff,0x23,0x18,0x1b,0xff,0x13,0x0a,0x0f,0xff,0x17,0x0c,0x13,0xff,0x26,0x19,0x1c,0xff,0x21,0x16,0x18,0xff,0x22,0x15,0x18,0xff,0x2a,0x1c,0x21,0xff,0x25,0x18,0x1c,0xff,0x1c,0x12,0x15,0xff,0x0f,0x06,0x0b,0xff,0x13,0x07,0x0e,0xff,0x10,0x09,0x0e,0xff,0x14,0x0c,0x10,0xff,0x1e,0x13,0x18,0xff,0x1e,0x12,0x18,0xff,0x1c,0x0e,0x16,0xff,0x1d,0x0f,0x17,0xff,0x13,0x09,0x10,0xff,0x2c,0x20,0x26,0xff,0x49,0x41,0x4a,0xff,0x8b,0x93,0xa2,0xff,0x42,0x50,0x6a,0xff,0x59,0x68,0x8f,0xff,0x5c,0x72,0xa1,0xff,0x6e,0x8d,0xc0,0xff,0x7c,0x9e,0xce,0xff,0x8e,0xae,0xda,0xff,0x96,0xb6,0xe3,0xff,0x9b,0xba,0xe6,0xff,0x99,0xb7,0xe2,0xff,0x9b,0xb6,0xe3,0xff,0x9e,0xb9,0xe6,0xff,0xa0,0xbb,0xe7,0xff,0xa1,0xbb,0xe6,0xff,0xa1,0xbb,0xe7,0xff,0xa0,0xb8,0xe4,0xff,0x9e,0xb6,0xe1,0xff,0x98,0xb2,0xdc,0xff,0x94,0xaf,0xd8,0xff,0x92,0xac,0xd8,0xff,0x8a,0xa4,0xd2,0xff,0x85,0x9c,0xcc,0xff,0x79,0x8d,0xbc,0xff,0x6f,0x80,0xaf,0xff,0x5d,0x6c,0x95,0xff,0x4c,0x58,0x7a,0xff,0x3b,0x45,0x69,0xff,0x2e,0x38,0x5b,0xff,0x24,0x2c,0x4d,0xff,0x13,0x1c,0x3b,0xff,0x1a,0x26,0x45,0xff,0x66,0x74,0x93,0xff,0x90,0xa3,0xc1,0xff,0x6d,0x81,0x9f,0xff,0x56,0x69,0x8a,0xff,0x75,0x8b,0xac,0xff,0x6e,0x7f,0x9f,0xff,0x3e,0x4b,0x6a,0xff,0x21,0x34,0x51,0xff,0x2b,0x3f,0x60,0xff,0x45,0x5a,0x7a,0xff,0x58,0x6d,0x8d,0xff,0x76,0x8b,0xab,0xff,0x82,0x98,0xb5,0xff,0x72,0x86,0xa3,0xff,0x57,0x6d,0x8b,0xff,0x4a,0x5c,0x7b,0xff,0x44,0x54,0x71,0xff,0x3b,0x4a,0x5f,0xff,0x3a,0x46,0x57,0xff,0x35,0x3d,0x50,0xff,0x3b,0x42,0x52,0xff,0x2e,0x33,0x41,0xff,0x18,0x1b,0x29,0xff,0x0a,0x0b,0x1a,0xff,0x14,0x17,0x28,0xff,0x1e,0x23,0x37,0xff,0x25,0x2e,0x41,0xff,0x23,0x2e,0x3f,0xff,0x1f,0x29,0x3a,0xff,0x14,0x1a,0x29,0xff,0x14,0x1b,0x29,0xff,0x1d,0x27,0x32,0xff,0x1d,0x21,0x29,0xff,0x39,0x34,0x37,0xff,0x43,0x39,0x35,0xff,0x4e,0x3f,0x36,0xff,0x49,0x3d,0x33,0xff,0x4c,0x41,0x38,0xff,0xc1,0xbd,0xb9,0xfb,0xff,0xff,0xff,0x46,0xff,0xff,0xff,0x00,0xfe,0xed,0xf4,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xee,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xba,0xb5,0xb3,0x84,0x4f,0x44,0x3c,0xff,0x50,0x43,0x3c,0xff,0x54,0x45,0x3f,0xff,0x54,0x47,0x3f,0xff,0x55,0x47,0x40,0xff,0x57,0x49,0x42,0xff,0x58,0x49,0x44,0xff,0x59,0x4b,0x42,0xff,0x5a,0x4c,0x43,0xff,0x5c,0x4c,0x43,0xff,0x5c,0x4d,0x43,0xff,0x5f,0x4f,0x45,0xff,0x60,0x52,0x45,0xff,0x61,0x53,0x47,0xff,0x62,0x53,0x48,0xff,0x63,0x53,0x48,0xff,0x64,0x55,0x47,0xff,0x65,0x57,0x47,0xff,0x67,0x56,0x4b,0xff,0x68,0x58,0x4d,0xff,0x69,0x59,0x4b,0xff,0x6b,0x5b,0x4d,0xff,0x6d,0x5c,0x50,0xff,0x6e,0x5e,0x50,0xff,0x6b,0x5d,0x4f,0xff,0x5f,0x53,0x44,0xff,0x4a,0x3d,0x32,0xff,0x2a,0x1c,0x1e,0xff,0x1c,0x0f,0x14,0xff,0x22,0x15,0x18,0xff,0x2c,0x1e,0x20,0xff,0x36,0x28,0x28,0xff,0x4a,0x3b,0x39,0xff,0x48,0x3b,0x39,0xff,0x39,0x2d,0x2f,0xff,0x25,0x19,0x1d,0xff,0x1c,0x10,0x15,0xff,0x25,0x18,0x1f,0xff,0x16,0x0a,0x11,0xff,0x14,0x0c,0x10,0xff,0x19,0x10,0x15,0xff,0x14,0x09,0x0f,0xff,0x17,0x0a,0x11,0xff,0x19,0x0b,0x12,0xff,0x1d,0x0f,0x17,0xff,0x23,0x18,0x22,0xff,0x31,0x2c,0x3a,0xff,0x76,0x79,0x8d,0xff,0x67,0x6c,0x80,0xff,0x44,0x57,0x73,0xff,0x58,0x72,0x9d,0xff,0x5f,0x7e,0xae,0xff,0x79,0x9b,0xcc,0xff,0x8a,0xaa,0xda,0xff,0x92,0xb2,0xde,0xff,0x97,0xb7,0xe3,0xff,0xa3,0xc1,0xea,0xff,0xa6,0xc3,0xea,0xff,0xa6,0xc2,0xeb,0xff,0xa5,0xc0,0xe9,0xff,0xa6,0xc1,0xe8,0xff,0xa9,0xc4,0xea,0xff,0xa6,0xc0,0xe9,0xff,0xa2,0xba,0xe6,0xff,0xa4,0xbc,0xe5,0xff,0xa1,0xbb,0xe3,0xff,0x9c,0xb7,0xdf,0xff,0x9c,0xb5,0xdf,0xff,0x98,0xb0,0xdc,0xff,0x94,0xa9,0xd8,0xff,0x8f,0xa2,0xd3,0xff,0x85,0x98,0xc7,0xff,0x77,0x8b,0xb8,0xff,0x63,0x77,0xa2,0xff,0x51,0x62,0x88,0xff,0x43,0x50,0x75,0xff,0x37,0x41,0x62,0xff,0x2b,0x31,0x52,0xff,0x17,0x1e,0x3f,0xff,0x26,0x2e,0x4e,0xff,0x71,0x81,0xa0,0xff,0x93,0xa8,0xc6,0xff,0x68,0x7b,0x98,0xff,0x5e,0x74,0x8f,0xff,0x74,0x8e,0xab,0xff,0x6e,0x7f,0x9f,0xff,0x3d,0x4a,0x65,0xff,0x2a,0x34,0x51,0xff,0x3f,0x4d,0x6c,0xff,0x53,0x66,0x86,0xff,0x4b,0x5e,0x80,0xff,0x68,0x7b,0x9e,0xff,0x70,0x86,0xa8,0xff,0x73,0x87,0xa7,0xff,0x66,0x79,0x98,0xff,0x50,0x61,0x81,0xff,0x44,0x52,0x6a,0xff,0x3e,0x49,0x5a,0xff,0x34,0x3b,0x4e,0xff,0x3a,0x40,0x51,0xff,0x2d,0x34,0x43,0xff,0x2b,0x30,0x3d,0xff,0x16,0x16,0x23,0xff,0x0a,0x0a,0x17,0xff,0x10,0x11,0x1f,0xff,0x14,0x17,0x24,0xff,0x12,0x16,0x26,0xff,0x12,0x16,0x27,0xff,0x14,0x18,0x28,0xff,0x06,0x0a,0x17,0xff,0x1c,0x21,0x2c,0xff,0x2a,0x2d,0x37,0xff,0x39,0x37,0x36,0xff,0x4c,0x43,0x38,0xff,0x50,0x41,0x39,0xff,0x4c,0x3f,0x36,0xff,0x42,0x37,0x2c,0xff,0x63,0x5a,0x51,0xff,0xe7,0xe5,0xe3,0xd3,0xff,0xff,0xff,0x10,0xff,0xfa,0xfc,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf5,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf1,0x00,0xff,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xe2,0xe0,0xdf,0x38,0x64,0x5a,0x54,0xf8,0x4d,0x40,0x39,0xff,0x53,0x46,0x3f,0xff,0x55,0x48,0x41,0xff,0x56,0x4a,0x40,0xff,0x58,0x4b,0x42,0xff,0x59,0x4b,0x42,0xff,0x5c,0x4d,0x43,0xff,0x5a,0x4d,0x44,0xff,0x5c,0x4f,0x45,0xff,0x5f,0x51,0x45,0xff,0x61,0x50,0x48,0xff,0x62,0x52,0x47,0xff,0x62,0x55,0x47,0xff,0x63,0x55,0x49,0xff,0x64,0x55,0x4a,0xff,0x67,0x56,0x4b,0xff,0x67,0x57,0x48,0xff,0x68,0x58,0x4a,0xff,0x6b,0x5b,0x4e,0xff,0x6b,0x5b,0x4d,0xff,0x6c,0x5d,0x4e,0xff,0x6e,0x5e,0x4f,0xff,0x6f,0x5f,0x51,0xff,0x70,0x60,0x53,0xff,0x6d,0x5f,0x51,0xff,0x62,0x56,0x48,0xff,0x48,0x3b,0x31,0xff,0x2c,0x1e,0x1f,0xff,0x25,0x18,0x1d,0xff,0x23,0x15,0x1c,0xff,0x1f,0x12,0x17,0xff,0x23,0x17,0x19,0xff,0x2e,0x22,0x25,0xff,0x2b,0x1f,0x22,0xff,0x21,0x16,0x1c,0xff,0x18,0x0c,0x13,0xff,0x1c,0x10,0x17,0xff,0x23,0x14,0x1b,0xff,0x1c,0x12,0x18,0xff,0x11,0x09,0x0e,0xff,0x14,0x09,0x10,0xff,0x16,0x08,0x0f,0xff,0x23,0x14,0x1b,0xff,0x1e,0x0f,0x16,0xff,0x17,0x0b,0x13,0xff,0x30,0x2f,0x3c,0xff,0x5d,0x61,0x73,0xff,0x89,0x8f,0xa2,0xff,0x43,0x48,0x5e,0xff,0x4e,0x60,0x80,0xff,0x5e,0x7b,0xa9,0xff,0x6f,0x91,0xc3,0xff,0x83,0xa5,0xd7,0xff,0x88,0xaa,0xdb,0xff,0x8f,0xb1,0xdf,0xff,0x9a,0xbd,0xe5,0xff,0xab,0xc6,0xeb,0xff,0xaf,0xc8,0xed,0xff,0xad,0xc8,0xef,0xff,0xad,0xc7,0xed,0xff,0xb0,0xca,0xee,0xff,0xb2,0xca,0xef,0xff,0xae,0xc8,0xec,0xff,0xaa,0xc5,0xe9,0xff,0xa6,0xbf,0xe7,0xff,0xa5,0xbe,0xe5,0xff,0xa2,0xbb,0xe2,0xff,0x9d,0xb6,0xdf,0xff,0x9b,0xb3,0xdd,0xff,0x99,0xb0,0xdb,0xff,0x94,0xa9,0xd6,0xff,0x90,0xa5,0xd2,0xff,0x84,0x9a,0xc9,0xff,0x79,0x91,0xbf,0xff,0x6d,0x82,0xad,0xff,0x5c,0x6d,0x99,0xff,0x4a,0x58,0x7d,0xff,0x3e,0x45,0x67,0xff,0x2d,0x34,0x54,0xff,0x19,0x20,0x40,0xff,0x38,0x46,0x64,0xff,0x7a,0x8d,0xab,0xff,0x91,0xa5,0xc2,0xff,0x65,0x78,0x96,0xff,0x5f,0x73,0x92,0xff,0x73,0x8a,0xaa,0xff,0x69,0x78,0x95,0xff,0x41,0x46,0x63,0xff,0x27,0x2c,0x4b,0xff,0x49,0x57,0x77,0xff,0x53,0x66,0x87,0xff,0x4c,0x5b,0x7e,0xff,0x6b,0x81,0xa1,0xff,0x80,0x94,0xb3,0xff,0x6a,0x7e,0x9d,0xff,0x63,0x74,0x94,0xff,0x52,0x60,0x7a,0xff,0x46,0x51,0x64,0xff,0x3b,0x41,0x53,0xff,0x3a,0x3f,0x51,0xff,0x38,0x3f,0x4f,0xff,0x28,0x2e,0x3a,0xff,0x15,0x13,0x1e,0xff,0x10,0x0e,0x17,0xff,0x0c,0x0b,0x15,0xff,0x0d,0x0e,0x17,0xff,0x13,0x12,0x1b,0xff,0x19,0x18,0x20,0xff,0x18,0x15,0x1e,0xff,0x10,0x0c,0x15,0xff,0x1d,0x17,0x1c,0xff,0x30,0x28,0x2a,0xff,0x47,0x3b,0x34,0xff,0x4e,0x43,0x36,0xff,0x4d,0x41,0x37,0xff,0x4c,0x3f,0x36,0xff,0x4b,0x3f,0x33,0xff,0x43,0x36,0x2c,0xff,0x8d,0x85,0x7f,0xff,0xfd,0xfd,0xfd,0x8a,0xff,0xff,0xff,0x00,0xfe,0xf2,0xf7,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfc,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x01,0x92,0x89,0x85,0xbf,0x4b,0x3d,0x36,0xff,0x54,0x47,0x3f,0xff,0x54,0x47,0x3f,0xff,0x56,0x49,0x40,0xff,0x58,0x4c,0x43,0xff,0x5a,0x4d,0x44,0xff,0x5b,0x4e,0x45,0xff,0x5e,0x50,0x46,0xff,0x5e,0x50,0x45,0xff,0x60,0x51,0x46,0xff,0x62,0x51,0x47,0xff,0x63,0x54,0x48,0xff,0x63,0x54,0x49,0xff,0x64,0x56,0x4a,0xff,0x68,0x59,0x4e,0xff,0x69,0x58,0x4d,0xff,0x69,0x58,0x4e,0xff,0x6b,0x5a,0x4d,0xff,0x6b,0x5a,0x4f,0xff,0x6c,0x5d,0x4e,0xff,0x6d,0x5e,0x4e,0xff,0x6f,0x5f,0x50,0xff,0x6f,0x60,0x50,0xff,0x71,0x62,0x52,0xff,0x72,0x63,0x52,0xff,0x73,0x64,0x55,0xff,0x73,0x64,0x56,0xff,0x51,0x44,0x39,0xff,0x34,0x26,0x28,0xff,0x25,0x1b,0x20,0xff,0x1a,0x0f,0x15,0xff,0x13,0x0a,0x0f,0xff,0x22,0x19,0x1c,0xff,0x1a,0x10,0x14,0xff,0x14,0x0a,0x10,0xff,0x13,0x0a,0x10,0xff,0x11,0x08,0x0e,0xff,0x19,0x0c,0x13,0xff,0x23,0x13,0x1b,0xff,0x23,0x18,0x1f,0xff,0x0f,0x09,0x0f,0xff,0x18,0x0f,0x15,0xff,0x1b,0x0f,0x16,0xff,0x24,0x16,0x1c,0xff,0x24,0x18,0x1f,0xff,0x26,0x24,0x34,0xff,0x53,0x5a,0x70,0xff,0x8d,0x94,0xa8,0xff,0x5f,0x65,0x78,0xff,0x32,0x3b,0x51,0xff,0x52,0x64,0x86,0xff,0x61,0x7b,0xac,0xff,0x72,0x92,0xc4,0xff,0x81,0xa3,0xd4,0xff,0x84,0xa7,0xd8,0xff,0x91,0xb4,0xe0,0xff,0x9e,0xbd,0xe9,0xff,0xab,0xc6,0xed,0xff,0xaf,0xc9,0xee,0xff,0xb1,0xcb,0xef,0xff,0xb1,0xcb,0xf0,0xff,0xb1,0xcb,0xf0,0xff,0xb1,0xca,0xed,0xff,0xaf,0xca,0xeb,0xff,0xae,0xc9,0xeb,0xff,0xab,0xc3,0xe9,0xff,0xa6,0xbd,0xe4,0xff,0xa2,0xb9,0xe1,0xff,0x9b,0xb5,0xde,0xff,0x9b,0xb2,0xdd,0xff,0x9c,0xb2,0xde,0xff,0x98,0xaf,0xda,0xff,0x96,0xab,0xd7,0xff,0x90,0xa6,0xd4,0xff,0x87,0x9e,0xce,0xff,0x7d,0x94,0xc5,0xff,0x6f,0x84,0xb6,0xff,0x5b,0x6e,0x9e,0xff,0x4c,0x57,0x80,0xff,0x3e,0x46,0x68,0xff,0x2c,0x36,0x57,0xff,0x21,0x2c,0x4d,0xff,0x55,0x64,0x84,0xff,0x80,0x95,0xb4,0xff,0x8c,0x9f,0xbc,0xff,0x5b,0x6c,0x8a,0xff,0x60,0x73,0x95,0xff,0x6f,0x84,0xa8,0xff,0x60,0x6f,0x8f,0xff,0x3a,0x3f,0x5f,0xff,0x1c,0x28,0x44,0xff,0x39,0x4a,0x65,0xff,0x54,0x67,0x89,0xff,0x4a,0x5c,0x7d,0xff,0x5e,0x71,0x90,0xff,0x68,0x7b,0x9a,0xff,0x59,0x6c,0x8a,0xff,0x53,0x65,0x80,0xff,0x51,0x5c,0x75,0xff,0x3d,0x42,0x56,0xff,0x3a,0x42,0x53,0xff,0x44,0x4c,0x5d,0xff,0x30,0x37,0x46,0xff,0x17,0x16,0x23,0xff,0x09,0x08,0x10,0xff,0x05,0x04,0x0d,0xff,0x0b,0x0a,0x13,0xff,0x0c,0x0b,0x12,0xff,0x09,0x07,0x0c,0xff,0x0b,0x05,0x0a,0xff,0x0f,0x06,0x0d,0xff,0x2a,0x1e,0x1e,0xff,0x46,0x39,0x30,0xff,0x4f,0x3f,0x35,0xff,0x50,0x42,0x37,0xff,0x50,0x42,0x37,0xff,0x4d,0x41,0x36,0xff,0x4b,0x3e,0x35,0xff,0x49,0x3c,0x32,0xff,0x4c,0x3f,0x36,0xff,0xc4,0xbf,0xbc,0xf9,0xff,0xff,0xff,0x37,0xff,0xfd,0xfe,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfb,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xea,0xf2,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xc6,0xc2,0xc0,0x64,0x56,0x49,0x42,0xff,0x53,0x45,0x3e,0xff,0x55,0x49,0x3e,0xff,0x55,0x49,0x3e,0xff,0x58,0x4a,0x41,0xff,0x5b,0x4e,0x43,0xff,0x5c,0x4f,0x45,0xff,0x5c,0x4e,0x45,0xff,0x5e,0x4f,0x47,0xff,0x60,0x51,0x47,0xff,0x61,0x52,0x47,0xff,0x65,0x54,0x47,0xff,0x65,0x55,0x4a,0xff,0x64,0x55,0x4b,0xff,0x68,0x59,0x4d,0xff,0x6a,0x59,0x4f,0xff,0x6a,0x5a,0x4f,0xff,0x6b,0x5a,0x4e,0xff,0x6c,0x5d,0x4f,0xff,0x6d,0x5d,0x51,0xff,0x6e,0x5f,0x50,0xff,0x70,0x60,0x51,0xff,0x71,0x62,0x53,0xff,0x71,0x62,0x52,0xff,0x72,0x62,0x53,0xff,0x73,0x64,0x55,0xff,0x74,0x65,0x53,0xff,0x6d,0x5f,0x4f,0xff,0x4f,0x42,0x39,0xff,0x22,0x17,0x19,0xff,0x0a,0x06,0x0b,0xff,0x0a,0x04,0x0a,0xff,0x0e,0x07,0x0c,0xff,0x0a,0x04,0x08,0xff,0x0f,0x06,0x0b,0xff,0x19,0x12,0x17,0xff,0x12,0x0c,0x11,0xff,0x08,0x03,0x07,0xff,0x16,0x0d,0x12,0xff,0x25,0x16,0x1c,0xff,0x15,0x0b,0x10,0xff,0x0c,0x04,0x09,0xff,0x20,0x16,0x1c,0xff,0x23,0x15,0x1c,0xff,0x1f,0x11,0x18,0xff,0x23,0x1c,0x25,0xff,0x48,0x4a,0x5e,0xff,0x7d,0x83,0x9e,0xff,0x68,0x6f,0x84,0xff,0x32,0x37,0x4b,0xff,0x31,0x39,0x53,0xff,0x42,0x54,0x78,0xff,0x5b,0x77,0xa5,0xff,0x74,0x93,0xc4,0xff,0x81,0xa1,0xd3,0xff,0x8d,0xad,0xdf,0xff,0x9b,0xb7,0xe5,0xff,0xa0,0xbd,0xe8,0xff,0xa6,0xc3,0xea,0xff,0xb0,0xcd,0xf2,0xff,0xb3,0xcd,0xf2,0xff,0xb4,0xce,0xf3,0xff,0xb5,0xd0,0xf4,0xff,0xb5,0xce,0xf1,0xff,0xb3,0xcd,0xf0,0xff,0xad,0xc6,0xea,0xff,0xab,0xc2,0xe7,0xff,0xa5,0xbd,0xe4,0xff,0xa0,0xb8,0xe0,0xff,0x9c,0xb4,0xde,0xff,0x9b,0xb2,0xdc,0xff,0x9c,0xb2,0xde,0xff,0x9c,0xb1,0xdd,0xff,0x9b,0xb0,0xdc,0xff,0x95,0xac,0xd7,0xff,0x91,0xa7,0xd5,0xff,0x8b,0x9f,0xd0,0xff,0x80,0x94,0xc5,0xff,0x70,0x85,0xb6,0xff,0x5c,0x6d,0x9e,0xff,0x4f,0x5a,0x82,0xff,0x41,0x4d,0x6f,0xff,0x2d,0x38,0x5d,0xff,0x34,0x41,0x65,0xff,0x6b,0x7d,0x9f,0xff,0x94,0xa7,0xc7,0xff,0x6f,0x80,0xa0,0xff,0x51,0x5c,0x80,0xff,0x63,0x75,0x9a,0xff,0x6f,0x88,0xab,0xff,0x59,0x67,0x88,0xff,0x3d,0x41,0x5f,0xff,0x15,0x1b,0x37,0xff,0x30,0x3c,0x5b,0xff,0x4e,0x5f,0x80,0xff,0x3a,0x50,0x71,0xff,0x4e,0x63,0x83,0xff,0x63,0x75,0x95,0xff,0x47,0x58,0x78,0xff,0x40,0x4d,0x6b,0xff,0x35,0x3a,0x51,0xff,0x2f,0x36,0x48,0xff,0x3d,0x45,0x57,0xff,0x36,0x3d,0x4d,0xff,0x2a,0x2c,0x3a,0xff,0x16,0x17,0x21,0xff,0x0b,0x0b,0x14,0xff,0x07,0x06,0x0e,0xff,0x0a,0x09,0x11,0xff,0x0e,0x0c,0x15,0xff,0x09,0x05,0x0d,0xff,0x08,0x02,0x09,0xff,0x21,0x17,0x1a,0xff,0x46,0x3a,0x30,0xff,0x53,0x43,0x3a,0xff,0x55,0x46,0x3b,0xff,0x52,0x44,0x38,0xff,0x50,0x43,0x36,0xff,0x4f,0x40,0x36,0xff,0x4c,0x3f,0x35,0xff,0x44,0x36,0x2d,0xff,0x6b,0x61,0x5a,0xff,0xee,0xed,0xed,0xba,0xff,0xff,0xff,0x01,0xff,0xf7,0xf9,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfe,0xf3,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfb,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf5,0xf9,0x00,0xff,0xff,0xff,0x00,0xf1,0xf0,0xef,0x15,0x76,0x6b,0x65,0xe1,0x4e,0x41,0x39,0xff,0x56,0x48,0x41,0xff,0x56,0x49,0x41,0xff,0x57,0x4b,0x42,0xff,0x5a,0x4d,0x44,0xff,0x5d,0x4e,0x43,0xff,0x5d,0x4f,0x45,0xff,0x5e,0x51,0x48,0xff,0x5f,0x50,0x47,0xff,0x61,0x51,0x48,0xff,0x64,0x54,0x4b,0xff,0x66,0x54,0x4a,0xff,0x67,0x55,0x4e,0xff,0x69,0x57,0x4e,0xff,0x6b,0x5b,0x4d,0xff,0x6c,0x5b,0x50,0xff,0x6c,0x5c,0x4f,0xff,0x6d,0x5e,0x50,0xff,0x6d,0x5d,0x52,0xff,0x6f,0x5f,0x53,0xff,0x70,0x60,0x53,0xff,0x72,0x61,0x55,0xff,0x73,0x63,0x54,0xff,0x73,0x63,0x54,0xff,0x73,0x64,0x55,0xff,0x74,0x64,0x56,0xff,0x75,0x67,0x55,0xff,0x74,0x65,0x54,0xff,0x6e,0x60,0x51,0xff,0x48,0x38,0x38,0xff,0x0d,0x07,0x0d,0xff,0x0a,0x06,0x0b,0xff,0x0c,0x06,0x0b,0xff,0x10,0x0a,0x0f,0xff,0x0f,0x08,0x0d,0xff,0x0b,0x05,0x0a,0xff,0x07,0x03,0x07,0xff,0x05,0x01,0x07,0xff,0x19,0x0e,0x14,0xff,0x21,0x15,0x19,0xff,0x12,0x09,0x0c,0xff,0x12,0x08,0x0c,0xff,0x23,0x17,0x1e,0xff,0x20,0x12,0x19,0xff,0x26,0x1a,0x24,0xff,0x3d,0x3a,0x48,0xff,0x57,0x58,0x6c,0xff,0x61,0x67,0x7c,0xff,0x3e,0x45,0x55,0xff,0x24,0x26,0x3b,0xff,0x2c,0x34,0x51,0xff,0x4b,0x5e,0x82,0xff,0x61,0x7b,0xa7,0xff,0x72,0x8d,0xbe,0xff,0x80,0x9c,0xce,0xff,0x86,0xa4,0xd9,0xff,0x91,0xb0,0xdf,0xff,0x9d,0xbc,0xe7,0xff,0xa6,0xc3,0xee,0xff,0xad,0xc9,0xf2,0xff,0xb4,0xce,0xf3,0xff,0xb6,0xd0,0xf5,0xff,0xb6,0xd0,0xf5,0xff,0xb6,0xcf,0xf2,0xff,0xb5,0xcd,0xf1,0xff,0xb0,0xc8,0xed,0xff,0xae,0xc6,0xeb,0xff,0xa9,0xc2,0xe8,0xff,0xa3,0xbc,0xe4,0xff,0xa1,0xb8,0xe2,0xff,0x9e,0xb4,0xde,0xff,0x9e,0xb5,0xde,0xff,0x9d,0xb4,0xdd,0xff,0x9d,0xb3,0xdd,0xff,0x9c,0xb3,0xdc,0xff,0x99,0xaf,0xda,0xff,0x92,0xa7,0xd7,0xff,0x8a,0xa0,0xcf,0xff,0x80,0x94,0xc5,0xff,0x71,0x83,0xb6,0xff,0x5d,0x6d,0x9e,0xff,0x4e,0x5d,0x89,0xff,0x43,0x4e,0x74,0xff,0x2d,0x3b,0x5f,0xff,0x43,0x52,0x77,0xff,0x7d,0x8f,0xb5,0xff,0x89,0x9f,0xc2,0xff,0x50,0x5f,0x83,0xff,0x52,0x62,0x86,0xff,0x69,0x7e,0xa2,0xff,0x65,0x7d,0x9e,0xff,0x51,0x5f,0x7e,0xff,0x34,0x38,0x57,0xff,0x09,0x10,0x2e,0xff,0x24,0x32,0x4f,0xff,0x40,0x50,0x6e,0xff,0x35,0x47,0x66,0xff,0x4e,0x5f,0x81,0xff,0x55,0x66,0x87,0xff,0x44,0x54,0x71,0xff,0x39,0x40,0x58,0xff,0x2c,0x31,0x46,0xff,0x37,0x40,0x52,0xff,0x34,0x3b,0x4c,0xff,0x2c,0x2e,0x3e,0xff,0x25,0x27,0x32,0xff,0x12,0x13,0x1c,0xff,0x09,0x07,0x0e,0xff,0x09,0x07,0x0f,0xff,0x10,0x0e,0x18,0xff,0x15,0x11,0x1b,0xff,0x0f,0x0b,0x14,0xff,0x19,0x12,0x16,0xff,0x44,0x37,0x2f,0xff,0x56,0x46,0x3c,0xff,0x55,0x46,0x3b,0xff,0x53,0x45,0x37,0xff,0x52,0x44,0x36,0xff,0x51,0x40,0x35,0xff,0x4e,0x3f,0x35,0xff,0x4a,0x3d,0x35,0xff,0x45,0x37,0x2e,0xff,0xa4,0x9d,0x99,0xff,0xff,0xff,0xff,0x5d,0xff,0xff,0xff,0x00,0xfe,0xed,0xf4,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfb,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xec,0xf3,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x00,0xb1,0xaa,0xa7,0x84,0x4f,0x43,0x3c,0xff,0x56,0x4a,0x41,0xff,0x58,0x4b,0x41,0xff,0x5a,0x4b,0x42,0xff,0x5c,0x4d,0x44,0xff,0x5c,0x4d,0x44,0xff,0x5e,0x4f,0x46,0xff,0x5f,0x51,0x46,0xff,0x60,0x52,0x47,0xff,0x61,0x52,0x47,0xff,0x65,0x54,0x4b,0xff,0x67,0x55,0x4d,0xff,0x68,0x56,0x50,0xff,0x69,0x57,0x51,0xff,0x6b,0x5a,0x51,0xff,0x6a,0x5c,0x4e,0xff,0x6d,0x5d,0x4f,0xff,0x6d,0x5d,0x50,0xff,0x6f,0x5e,0x52,0xff,0x70,0x60,0x53,0xff,0x71,0x61,0x54,0xff,0x72,0x62,0x55,0xff,0x73,0x64,0x54,0xff,0x76,0x65,0x57,0xff,0x77,0x66,0x58,0xff,0x77,0x67,0x58,0xff,0x77,0x68,0x59,0xff,0x77,0x68,0x59,0xff,0x79,0x6a,0x59,0xff,0x7a,0x6b,0x59,0xff,0x45,0x33,0x32,0xff,0x0d,0x06,0x0e,0xff,0x05,0x03,0x09,0xff,0x0d,0x07,0x0f,0xff,0x0e,0x07,0x0f,0xff,0x07,0x02,0x07,0xff,0x07,0x03,0x08,0xff,0x04,0x02,0x07,0xff,0x09,0x06,0x0a,0xff,0x24,0x15,0x1c,0xff,0x14,0x0a,0x10,0xff,0x0d,0x05,0x0b,0xff,0x14,0x0b,0x10,0xff,0x19,0x0d,0x13,0xff,0x23,0x14,0x1d,0xff,0x31,0x2b,0x37,0xff,0x5f,0x62,0x73,0xff,0x6d,0x6e,0x81,0xff,0x41,0x45,0x55,0xff,0x35,0x37,0x4a,0xff,0x13,0x13,0x2c,0xff,0x38,0x40,0x5e,0xff,0x63,0x74,0x98,0xff,0x5f,0x75,0xa0,0xff,0x65,0x7e,0xac,0xff,0x6d,0x87,0xb8,0xff,0x7b,0x96,0xcb,0xff,0x85,0xa5,0xd7,0xff,0x91,0xb4,0xe3,0xff,0x9d,0xbf,0xea,0xff,0xa7,0xc3,0xec,0xff,0xae,0xc9,0xf2,0xff,0xb1,0xcc,0xf3,0xff,0xb1,0xcc,0xf2,0xff,0xb3,0xce,0xf2,0xff,0xb4,0xcd,0xf2,0xff,0xb4,0xcc,0xf0,0xff,0xb3,0xc9,0xec,0xff,0xad,0xc5,0xea,0xff,0xab,0xc3,0xea,0xff,0xa7,0xbe,0xe6,0xff,0xa2,0xb8,0xe2,0xff,0x9f,0xb6,0xe0,0xff,0xa0,0xb6,0xe0,0xff,0xa0,0xb6,0xe0,0xff,0x9f,0xb5,0xdf,0xff,0x9d,0xb3,0xdd,0xff,0x9a,0xaf,0xda,0xff,0x92,0xa8,0xd4,0xff,0x88,0xa0,0xcf,0xff,0x7b,0x92,0xc4,0xff,0x6c,0x83,0xb6,0xff,0x5b,0x6e,0xa1,0xff,0x51,0x5d,0x89,0xff,0x42,0x4e,0x79,0xff,0x32,0x3e,0x67,0xff,0x5f,0x71,0x97,0xff,0x8a,0xa0,0xc4,0xff,0x6b,0x7f,0xa2,0xff,0x4a,0x5a,0x7e,0xff,0x53,0x66,0x89,0xff,0x6d,0x82,0xa5,0xff,0x4f,0x62,0x86,0xff,0x4f,0x5c,0x7d,0xff,0x46,0x51,0x6e,0xff,0x18,0x21,0x3d,0xff,0x27,0x2c,0x49,0xff,0x33,0x3d,0x5b,0xff,0x30,0x3e,0x5c,0xff,0x52,0x61,0x7e,0xff,0x53,0x63,0x80,0xff,0x47,0x52,0x6c,0xff,0x37,0x3f,0x55,0xff,0x35,0x3f,0x52,0xff,0x36,0x40,0x51,0xff,0x2a,0x2d,0x3c,0xff,0x2b,0x2b,0x36,0xff,0x28,0x26,0x2f,0xff,0x0c,0x09,0x11,0xff,0x0a,0x07,0x0e,0xff,0x13,0x10,0x18,0xff,0x0f,0x0b,0x13,0xff,0x0d,0x09,0x0f,0xff,0x12,0x0c,0x10,0xff,0x3f,0x32,0x2c,0xff,0x56,0x46,0x3d,0xff,0x4b,0x3c,0x33,0xff,0x4e,0x40,0x35,0xff,0x51,0x44,0x37,0xff,0x51,0x43,0x37,0xff,0x50,0x41,0x36,0xff,0x4e,0x3f,0x35,0xff,0x49,0x39,0x30,0xff,0x5c,0x50,0x48,0xff,0xdf,0xdd,0xdc,0xd5,0xff,0xff,0xff,0x0e,0xfe,0xf8,0xfb,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xff,0xf7,0xfb,0x00,0xff,0xff,0xff,0x00,0xeb,0xe9,0xe8,0x22,0x6b,0x5f,0x58,0xed,0x4f,0x42,0x3b,0xff,0x57,0x4b,0x43,0xff,0x59,0x4c,0x42,0xff,0x5b,0x4c,0x43,0xff,0x5d,0x4d,0x45,0xff,0x5e,0x4f,0x46,0xff,0x60,0x52,0x47,0xff,0x62,0x53,0x48,0xff,0x65,0x55,0x4a,0xff,0x64,0x57,0x4b,0xff,0x65,0x55,0x4c,0xff,0x67,0x56,0x4d,0xff,0x6a,0x59,0x4d,0xff,0x6b,0x5b,0x4e,0xff,0x6b,0x5c,0x4e,0xff,0x6c,0x5d,0x50,0xff,0x70,0x60,0x52,0xff,0x70,0x61,0x53,0xff,0x71,0x63,0x52,0xff,0x72,0x63,0x55,0xff,0x74,0x63,0x57,0xff,0x75,0x66,0x57,0xff,0x76,0x67,0x58,0xff,0x78,0x67,0x59,0xff,0x79,0x68,0x5b,0xff,0x7a,0x6b,0x5b,0xff,0x7a,0x6b,0x5b,0xff,0x7a,0x6b,0x5c,0xff,0x7b,0x6c,0x5c,0xff,0x76,0x66,0x57,0xff,0x56,0x46,0x42,0xff,0x1d,0x12,0x19,0xff,0x09,0x03,0x09,0xff,0x0c,0x07,0x0b,0xff,0x17,0x0e,0x16,0xff,0x08,0x02,0x09,0xff,0x05,0x02,0x07,0xff,0x06,0x02,0x07,0xff,0x14,0x0e,0x13,0xff,0x17,0x0b,0x12,0xff,0x0e,0x05,0x0b,0xff,0x0f,0x07,0x0d,0xff,0x14,0x09,0x11,0xff,0x16,0x07,0x0f,0xff,0x28,0x1a,0x24,0xff,0x47,0x42,0x51,0xff,0x56,0x5a,0x6c,0xff,0x33,0x35,0x47,0xff,0x38,0x38,0x4a,0xff,0x2c,0x2b,0x40,0xff,0x18,0x1b,0x34,0xff,0x24,0x2d,0x4b,0xff,0x45,0x54,0x75,0xff,0x5d,0x6e,0x99,0xff,0x64,0x7a,0xa8,0xff,0x6b,0x84,0xb3,0xff,0x72,0x8f,0xc2,0xff,0x7d,0x9d,0xcf,0xff,0x8b,0xae,0xdf,0xff,0x99,0xba,0xea,0xff,0xa3,0xc0,0xee,0xff,0xaa,0xc5,0xf1,0xff,0xae,0xc8,0xf3,0xff,0xaf,0xca,0xf2,0xff,0xb2,0xcc,0xf3,0xff,0xb3,0xcc,0xf3,0xff,0xb4,0xcc,0xf2,0xff,0xb3,0xcb,0xef,0xff,0xb1,0xc8,0xed,0xff,0xad,0xc4,0xea,0xff,0xaa,0xc1,0xe9,0xff,0xa5,0xba,0xe4,0xff,0xa4,0xba,0xe3,0xff,0xa2,0xb9,0xe1,0xff,0xa3,0xb8,0xe2,0xff,0xa2,0xb8,0xe3,0xff,0x9f,0xb5,0xdf,0xff,0xa1,0xb3,0xdf,0xff,0x9c,0xae,0xdb,0xff,0x93,0xa9,0xd7,0xff,0x84,0x9e,0xcf,0xff,0x77,0x90,0xc2,0xff,0x69,0x80,0xb3,0xff,0x5c,0x70,0xa2,0xff,0x4a,0x5f,0x8e,0xff,0x3a,0x4e,0x78,0xff,0x47,0x5a,0x7f,0xff,0x75,0x86,0xac,0xff,0x8a,0x9d,0xbe,0xff,0x4a,0x5c,0x7f,0xff,0x51,0x61,0x87,0xff,0x5d,0x6e,0x93,0xff,0x73,0x87,0xac,0xff,0x3a,0x4a,0x6f,0xff,0x4b,0x56,0x75,0xff,0x53,0x60,0x7e,0xff,0x2e,0x35,0x52,0xff,0x36,0x3e,0x5a,0xff,0x2f,0x3a,0x54,0xff,0x35,0x43,0x5e,0xff,0x57,0x64,0x7f,0xff,0x50,0x5d,0x77,0xff,0x42,0x4c,0x61,0xff,0x30,0x39,0x4b,0xff,0x39,0x41,0x53,0xff,0x34,0x37,0x47,0xff,0x21,0x23,0x2d,0xff,0x2b,0x29,0x32,0xff,0x22,0x20,0x29,0xff,0x0e,0x08,0x10,0xff,0x17,0x12,0x19,0xff,0x10,0x0c,0x11,0xff,0x07,0x03,0x04,0xff,0x16,0x0f,0x0f,0xff,0x2e,0x22,0x1e,0xff,0x36,0x2a,0x23,0xff,0x41,0x33,0x2c,0xff,0x50,0x43,0x39,0xff,0x50,0x43,0x37,0xff,0x50,0x42,0x36,0xff,0x51,0x42,0x37,0xff,0x51,0x41,0x36,0xff,0x4d,0x3f,0x36,0xff,0x44,0x36,0x2d,0xff,0x94,0x8d,0x88,0xff,0xff,0xff,0xff,0x71,0xff,0xff,0xff,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xed,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xa5,0x9e,0x9a,0x8f,0x4f,0x41,0x39,0xff,0x57,0x49,0x42,0xff,0x59,0x4c,0x43,0xff,0x5a,0x4d,0x43,0xff,0x5e,0x4f,0x45,0xff,0x5e,0x4e,0x46,0xff,0x60,0x51,0x48,0xff,0x62,0x53,0x48,0xff,0x64,0x55,0x49,0xff,0x66,0x56,0x49,0xff,0x66,0x58,0x4c,0xff,0x68,0x57,0x4e,0xff,0x69,0x58,0x4f,0xff,0x6a,0x59,0x4e,0xff,0x6d,0x5d,0x50,0xff,0x6f,0x5f,0x52,0xff,0x6f,0x5f,0x52,0xff,0x70,0x60,0x53,0xff,0x73,0x62,0x54,0xff,0x74,0x66,0x53,0xff,0x76,0x66,0x57,0xff,0x77,0x66,0x59,0xff,0x77,0x68,0x58,0xff,0x77,0x68,0x58,0xff,0x79,0x69,0x5b,0xff,0x7a,0x6a,0x5d,0xff,0x7a,0x6b,0x5b,0xff,0x7b,0x6c,0x5c,0xff,0x7c,0x6d,0x5d,0xff,0x7d,0x6e,0x5e,0xff,0x7e,0x6f,0x5d,0xff,0x7d,0x6f,0x5c,0xff,0x6f,0x61,0x56,0xff,0x5b,0x4d,0x44,0xff,0x4b,0x3e,0x37,0xff,0x3a,0x2b,0x2d,0xff,0x09,0x05,0x0a,0xff,0x05,0x03,0x06,0xff,0x0e,0x07,0x0c,0xff,0x11,0x09,0x0f,0xff,0x0d,0x03,0x09,0xff,0x0d,0x05,0x09,0xff,0x10,0x07,0x0e,0xff,0x14,0x0e,0x15,0xff,0x33,0x27,0x2e,0xff,0x4d,0x3f,0x49,0xff,0x4d,0x49,0x57,0xff,0x39,0x3d,0x4e,0xff,0x22,0x23,0x35,0xff,0x39,0x38,0x4c,0xff,0x31,0x2f,0x46,0xff,0x1e,0x22,0x3b,0xff,0x2f,0x39,0x56,0xff,0x50,0x5c,0x7b,0xff,0x60,0x6e,0x98,0xff,0x64,0x76,0xa5,0xff,0x66,0x7d,0xac,0xff,0x6c,0x8b,0xbc,0xff,0x7b,0x9a,0xcd,0xff,0x88,0xa8,0xdc,0xff,0x94,0xb4,0xe8,0xff,0x9b,0xba,0xed,0xff,0xa6,0xc3,0xf1,0xff,0xac,0xc6,0xf3,0xff,0xae,0xc7,0xf4,0xff,0xb2,0xcb,0xf5,0xff,0xb2,0xcc,0xf4,0xff,0xb3,0xcc,0xf3,0xff,0xb4,0xcd,0xf2,0xff,0xb3,0xcb,0xf0,0xff,0xb2,0xca,0xef,0xff,0xaf,0xc7,0xea,0xff,0xad,0xc4,0xe7,0xff,0xa9,0xbf,0xe4,0xff,0xa6,0xbc,0xe3,0xff,0xa6,0xba,0xe4,0xff,0xa4,0xb8,0xe5,0xff,0xa2,0xb8,0xe2,0xff,0xa4,0xb7,0xe3,0xff,0x9e,0xb2,0xde,0xff,0x9c,0xaf,0xde,0xff,0x93,0xa9,0xd8,0xff,0x86,0x9f,0xd1,0xff,0x7b,0x93,0xc6,0xff,0x6b,0x83,0xb5,0xff,0x5b,0x71,0xa2,0xff,0x4e,0x64,0x93,0xff,0x48,0x5c,0x88,0xff,0x64,0x74,0x9e,0xff,0x7f,0x92,0xb3,0xff,0x66,0x79,0x9b,0xff,0x50,0x5d,0x86,0xff,0x55,0x65,0x8c,0xff,0x63,0x77,0x9e,0xff,0x5a,0x71,0x97,0xff,0x2c,0x3f,0x61,0xff,0x37,0x44,0x64,0xff,0x53,0x5f,0x7b,0xff,0x4b,0x54,0x6f,0xff,0x4e,0x58,0x71,0xff,0x30,0x3c,0x54,0xff,0x3b,0x47,0x61,0xff,0x5b,0x69,0x84,0xff,0x43,0x4e,0x64,0xff,0x3b,0x42,0x54,0xff,0x41,0x46,0x5a,0xff,0x36,0x3c,0x4c,0xff,0x2a,0x2e,0x39,0xff,0x16,0x15,0x1e,0xff,0x29,0x27,0x31,0xff,0x19,0x14,0x1d,0xff,0x1b,0x16,0x1c,0xff,0x1c,0x19,0x1d,0xff,0x17,0x12,0x17,0xff,0x1b,0x15,0x1a,0xff,0x14,0x0d,0x0d,0xff,0x27,0x1d,0x19,0xff,0x39,0x2c,0x28,0xff,0x39,0x2d,0x27,0xff,0x45,0x3b,0x32,0xff,0x4e,0x42,0x37,0xff,0x4e,0x40,0x37,0xff,0x50,0x40,0x37,0xff,0x4e,0x41,0x38,0xff,0x4a,0x3d,0x33,0xff,0x55,0x49,0x40,0xff,0xd6,0xd3,0xd1,0xde,0xff,0xff,0xff,0x11,0xff,0xfa,0xfc,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xff,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xe6,0xe3,0xe2,0x23,0x65,0x5a,0x53,0xee,0x51,0x47,0x3e,0xff,0x58,0x4c,0x42,0xff,0x59,0x4d,0x43,0xff,0x5b,0x4f,0x45,0xff,0x5e,0x4f,0x46,0xff,0x60,0x50,0x47,0xff,0x61,0x51,0x49,0xff,0x62,0x52,0x4a,0xff,0x64,0x55,0x4b,0xff,0x66,0x56,0x4d,0xff,0x66,0x58,0x4d,0xff,0x69,0x59,0x4e,0xff,0x6c,0x5b,0x50,0xff,0x6b,0x5b,0x50,0xff,0x6f,0x5f,0x52,0xff,0x72,0x62,0x54,0xff,0x72,0x62,0x54,0xff,0x73,0x63,0x55,0xff,0x74,0x64,0x57,0xff,0x76,0x66,0x59,0xff,0x79,0x68,0x59,0xff,0x79,0x69,0x59,0xff,0x7a,0x6a,0x5b,0xff,0x7a,0x6b,0x5a,0xff,0x7b,0x6c,0x5b,0xff,0x7c,0x6d,0x5d,0xff,0x7c,0x6d,0x5e,0xff,0x7e,0x6f,0x5d,0xff,0x7f,0x70,0x5f,0xff,0x81,0x6f,0x5f,0xff,0x82,0x71,0x5e,0xff,0x82,0x72,0x5d,0xff,0x84,0x73,0x5f,0xff,0x85,0x74,0x62,0xff,0x85,0x73,0x63,0xff,0x6e,0x5d,0x4f,0xff,0x21,0x1a,0x1b,0xff,0x07,0x01,0x06,0xff,0x0f,0x08,0x0d,0xff,0x0b,0x05,0x0b,0xff,0x0c,0x06,0x0b,0xff,0x1a,0x12,0x17,0xff,0x1d,0x14,0x1a,0xff,0x32,0x28,0x2e,0xff,0x40,0x30,0x37,0xff,0x34,0x27,0x2f,0xff,0x40,0x40,0x4e,0xff,0x46,0x4b,0x5d,0xff,0x22,0x20,0x34,0xff,0x2d,0x2b,0x41,0xff,0x31,0x2f,0x47,0xff,0x1f,0x22,0x3b,0xff,0x31,0x39,0x56,0xff,0x44,0x51,0x70,0xff,0x5e,0x6c,0x97,0xff,0x69,0x7a,0xa9,0xff,0x68,0x80,0xae,0xff,0x66,0x85,0xb6,0xff,0x75,0x94,0xc6,0xff,0x82,0xa1,0xd9,0xff,0x90,0xae,0xe7,0xff,0x99,0xb7,0xec,0xff,0x9e,0xbf,0xed,0xff,0xa8,0xc5,0xf0,0xff,0xac,0xc8,0xf5,0xff,0xb0,0xcc,0xf6,0xff,0xb2,0xcc,0xf4,0xff,0xb5,0xce,0xf5,0xff,0xb8,0xd0,0xf5,0xff,0xb8,0xce,0xf3,0xff,0xb6,0xcc,0xf1,0xff,0xb4,0xc9,0xef,0xff,0xb2,0xc7,0xed,0xff,0xaf,0xc5,0xeb,0xff,0xab,0xc1,0xe7,0xff,0xaa,0xc0,0xe6,0xff,0xa7,0xbb,0xe7,0xff,0xa6,0xba,0xe5,0xff,0xa4,0xbb,0xe5,0xff,0xa1,0xb7,0xe1,0xff,0xa1,0xb7,0xe2,0xff,0x9e,0xb3,0xdf,0xff,0x96,0xad,0xda,0xff,0x8e,0xa5,0xd5,0xff,0x81,0x97,0xc9,0xff,0x71,0x86,0xba,0xff,0x63,0x7a,0xac,0xff,0x54,0x68,0x9b,0xff,0x5d,0x6f,0xa0,0xff,0x6f,0x84,0xa8,0xff,0x78,0x8c,0xb0,0xff,0x4b,0x59,0x83,0xff,0x54,0x64,0x8c,0xff,0x4f,0x61,0x86,0xff,0x55,0x69,0x8d,0xff,0x54,0x6d,0x95,0xff,0x29,0x38,0x5a,0xff,0x23,0x2d,0x4a,0xff,0x38,0x43,0x5e,0xff,0x3f,0x48,0x61,0xff,0x40,0x4a,0x62,0xff,0x26,0x31,0x49,0xff,0x52,0x61,0x7c,0xff,0x54,0x62,0x77,0xff,0x3a,0x42,0x55,0xff,0x38,0x3f,0x52,0xff,0x3b,0x42,0x52,0xff,0x28,0x2e,0x3a,0xff,0x18,0x19,0x22,0xff,0x23,0x21,0x2b,0xff,0x20,0x20,0x29,0xff,0x10,0x0e,0x16,0xff,0x24,0x1d,0x24,0xff,0x25,0x1f,0x23,0xff,0x11,0x0d,0x0f,0xff,0x09,0x03,0x04,0xff,0x1e,0x15,0x15,0xff,0x1a,0x10,0x0f,0xff,0x25,0x1b,0x1a,0xff,0x31,0x26,0x23,0xff,0x32,0x27,0x22,0xff,0x45,0x3a,0x31,0xff,0x51,0x43,0x3a,0xff,0x51,0x41,0x39,0xff,0x4f,0x42,0x39,0xff,0x46,0x38,0x2e,0xff,0x8e,0x86,0x80,0xff,0xff,0xff,0xff,0x72,0xff,0xff,0xff,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xeb,0xf2,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xa8,0xa1,0x9d,0x8b,0x51,0x44,0x3a,0xff,0x57,0x4b,0x41,0xff,0x5a,0x4d,0x44,0xff,0x5b,0x4e,0x45,0xff,0x5d,0x50,0x47,0xff,0x60,0x51,0x48,0xff,0x62,0x53,0x4a,0xff,0x63,0x53,0x4a,0xff,0x64,0x54,0x4c,0xff,0x65,0x56,0x4d,0xff,0x67,0x58,0x4f,0xff,0x66,0x59,0x4e,0xff,0x6a,0x5a,0x4f,0xff,0x6d,0x5c,0x51,0xff,0x6d,0x5c,0x52,0xff,0x6e,0x5e,0x52,0xff,0x72,0x62,0x55,0xff,0x73,0x63,0x56,0xff,0x75,0x64,0x57,0xff,0x76,0x66,0x58,0xff,0x78,0x68,0x59,0xff,0x79,0x6a,0x5a,0xff,0x7b,0x6b,0x5a,0xff,0x7e,0x6d,0x5d,0xff,0x7c,0x6d,0x5d,0xff,0x7d,0x6f,0x5e,0xff,0x7d,0x6f,0x5e,0xff,0x7e,0x6f,0x60,0xff,0x82,0x70,0x5f,0xff,0x84,0x72,0x61,0xff,0x84,0x73,0x61,0xff,0x82,0x72,0x60,0xff,0x82,0x73,0x60,0xff,0x84,0x73,0x61,0xff,0x84,0x73,0x61,0xff,0x85,0x75,0x62,0xff,0x88,0x77,0x63,0xff,0x66,0x56,0x4f,0xff,0x16,0x0b,0x12,0xff,0x0c,0x06,0x0b,0xff,0x0c,0x06,0x0b,0xff,0x0e,0x07,0x0c,0xff,0x10,0x06,0x0d,0xff,0x1f,0x14,0x1a,0xff,0x29,0x16,0x1e,0xff,0x36,0x1f,0x27,0xff,0x2e,0x22,0x28,0xff,0x40,0x41,0x4f,0xff,0x49,0x4e,0x63,0xff,0x26,0x24,0x3a,0xff,0x21,0x20,0x36,0xff,0x2d,0x2a,0x45,0xff,0x26,0x26,0x41,0xff,0x38,0x41,0x5e,0xff,0x51,0x5f,0x82,0xff,0x65,0x74,0x9f,0xff,0x68,0x7a,0xa7,0xff,0x6d,0x85,0xb5,0xff,0x6d,0x8a,0xbf,0xff,0x71,0x8d,0xc2,0xff,0x7c,0x9a,0xd2,0xff,0x8a,0xa8,0xe1,0xff,0x94,0xb4,0xe9,0xff,0x9e,0xbe,0xee,0xff,0xaa,0xc5,0xf1,0xff,0xae,0xc9,0xf5,0xff,0xb4,0xce,0xf6,0xff,0xb4,0xce,0xf6,0xff,0xb4,0xce,0xf5,0xff,0xb3,0xce,0xf2,0xff,0xb5,0xce,0xf2,0xff,0xb9,0xcd,0xf3,0xff,0xb6,0xcb,0xf1,0xff,0xb4,0xca,0xee,0xff,0xb1,0xc7,0xeb,0xff,0xb0,0xc6,0xea,0xff,0xaf,0xc5,0xe9,0xff,0xab,0xc0,0xe6,0xff,0xa9,0xbe,0xe4,0xff,0xa7,0xbc,0xe5,0xff,0xa8,0xbe,0xe6,0xff,0xa8,0xbe,0xe5,0xff,0xa7,0xbd,0xe2,0xff,0xa1,0xb8,0xe1,0xff,0x9c,0xb1,0xdf,0xff,0x93,0xa6,0xd8,0xff,0x86,0x9d,0xcf,0xff,0x76,0x90,0xc3,0xff,0x62,0x7a,0xae,0xff,0x5b,0x71,0xa5,0xff,0x6a,0x7e,0xa9,0xff,0x71,0x85,0xad,0xff,0x56,0x66,0x91,0xff,0x52,0x61,0x8c,0xff,0x57,0x67,0x8d,0xff,0x43,0x4f,0x75,0xff,0x42,0x56,0x7d,0xff,0x50,0x68,0x8a,0xff,0x2f,0x3b,0x5b,0xff,0x20,0x2b,0x47,0xff,0x27,0x30,0x49,0xff,0x33,0x3b,0x54,0xff,0x35,0x40,0x57,0xff,0x44,0x51,0x68,0xff,0x70,0x7c,0x92,0xff,0x4c,0x55,0x68,0xff,0x3a,0x3f,0x51,0xff,0x3c,0x43,0x53,0xff,0x20,0x25,0x35,0xff,0x28,0x2b,0x39,0xff,0x22,0x23,0x2e,0xff,0x28,0x2a,0x32,0xff,0x30,0x2d,0x35,0xff,0x33,0x2d,0x33,0xff,0x18,0x10,0x14,0xff,0x0a,0x04,0x07,0xff,0x0d,0x08,0x0d,0xff,0x09,0x04,0x08,0xff,0x0d,0x06,0x0a,0xff,0x18,0x0e,0x12,0xff,0x17,0x0c,0x0d,0xff,0x1b,0x11,0x0e,0xff,0x36,0x2c,0x23,0xff,0x4c,0x3f,0x35,0xff,0x52,0x45,0x39,0xff,0x51,0x44,0x3a,0xff,0x4d,0x3e,0x35,0xff,0x57,0x4b,0x42,0xff,0xda,0xd8,0xd6,0xdb,0xff,0xff,0xff,0x0f,0xff,0xf8,0xfa,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfa,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf5,0xf9,0x00,0xff,0xff,0xff,0x00,0xeb,0xe9,0xe9,0x1a,0x6b,0x5f,0x58,0xeb,0x53,0x45,0x3c,0xff,0x58,0x4b,0x41,0xff,0x5b,0x4e,0x44,0xff,0x5c,0x50,0x46,0xff,0x5e,0x51,0x47,0xff,0x61,0x51,0x49,0xff,0x62,0x52,0x4a,0xff,0x63,0x54,0x4b,0xff,0x65,0x56,0x4d,0xff,0x67,0x57,0x4f,0xff,0x68,0x59,0x50,0xff,0x68,0x5a,0x4e,0xff,0x6b,0x5b,0x4f,0xff,0x6e,0x5d,0x53,0xff,0x6f,0x5e,0x53,0xff,0x70,0x60,0x53,0xff,0x72,0x62,0x55,0xff,0x74,0x64,0x57,0xff,0x77,0x67,0x5a,0xff,0x78,0x68,0x5a,0xff,0x79,0x6b,0x5a,0xff,0x7b,0x6c,0x5c,0xff,0x7c,0x6c,0x5b,0xff,0x7f,0x6e,0x5d,0xff,0x7e,0x6e,0x5e,0xff,0x81,0x71,0x5f,0xff,0x81,0x72,0x60,0xff,0x82,0x72,0x63,0xff,0x83,0x74,0x62,0xff,0x84,0x74,0x62,0xff,0x86,0x75,0x63,0xff,0x83,0x75,0x63,0xff,0x85,0x75,0x63,0xff,0x88,0x77,0x65,0xff,0x86,0x75,0x63,0xff,0x87,0x76,0x63,0xff,0x87,0x74,0x64,0xff,0x8b,0x79,0x67,0xff,0x34,0x2a,0x28,0xff,0x07,0x01,0x07,0xff,0x0d,0x08,0x0d,0xff,0x11,0x08,0x0e,0xff,0x21,0x16,0x1c,0xff,0x22,0x15,0x1b,0xff,0x27,0x12,0x19,0xff,0x41,0x2b,0x32,0xff,0x27,0x1a,0x22,0xff,0x39,0x38,0x49,0xff,0x44,0x4a,0x61,0xff,0x3c,0x3d,0x55,0xff,0x24,0x23,0x3d,0xff,0x2a,0x28,0x44,0xff,0x35,0x35,0x51,0xff,0x3c,0x45,0x64,0xff,0x5d,0x6d,0x93,0xff,0x6a,0x7b,0xa6,0xff,0x69,0x7f,0xab,0xff,0x6e,0x86,0xbb,0xff,0x72,0x8c,0xc6,0xff,0x74,0x90,0xc7,0xff,0x7e,0x9c,0xd5,0xff,0x89,0xa7,0xe2,0xff,0x93,0xb3,0xea,0xff,0x9d,0xbd,0xee,0xff,0xac,0xc8,0xf4,0xff,0xb1,0xcc,0xf6,0xff,0xb8,0xd2,0xf9,0xff,0xb7,0xd0,0xf7,0xff,0xb6,0xd0,0xf5,0xff,0xb5,0xcf,0xf3,0xff,0xb1,0xcb,0xf0,0xff,0xb8,0xcd,0xf2,0xff,0xba,0xcf,0xf5,0xff,0xb7,0xce,0xf2,0xff,0xb6,0xcd,0xf0,0xff,0xb6,0xcc,0xef,0xff,0xb3,0xca,0xed,0xff,0xb1,0xc7,0xe9,0xff,0xaf,0xc5,0xe8,0xff,0xae,0xc4,0xe8,0xff,0xae,0xc3,0xe7,0xff,0xb1,0xc6,0xeb,0xff,0xad,0xc3,0xe8,0xff,0xa8,0xbf,0xe7,0xff,0xa6,0xbc,0xe5,0xff,0x9f,0xb3,0xe2,0xff,0x91,0xa8,0xda,0xff,0x81,0x9b,0xcd,0xff,0x6b,0x86,0xbb,0xff,0x60,0x77,0xae,0xff,0x74,0x86,0xb6,0xff,0x6c,0x7f,0xab,0xff,0x51,0x64,0x8e,0xff,0x51,0x60,0x8b,0xff,0x4d,0x5c,0x83,0xff,0x4b,0x57,0x7e,0xff,0x2a,0x33,0x58,0xff,0x3f,0x51,0x73,0xff,0x4a,0x5f,0x7f,0xff,0x39,0x4a,0x69,0xff,0x22,0x2e,0x4a,0xff,0x1b,0x25,0x3e,0xff,0x2d,0x36,0x4d,0xff,0x36,0x40,0x58,0xff,0x53,0x5e,0x74,0xff,0x5e,0x69,0x7c,0xff,0x43,0x48,0x5b,0xff,0x45,0x4a,0x5c,0xff,0x34,0x39,0x4a,0xff,0x2b,0x2e,0x3c,0xff,0x34,0x35,0x41,0xff,0x30,0x31,0x3a,0xff,0x3b,0x38,0x42,0xff,0x1e,0x18,0x1e,0xff,0x0f,0x09,0x0d,0xff,0x12,0x09,0x10,0xff,0x11,0x09,0x0f,0xff,0x11,0x09,0x0d,0xff,0x0f,0x06,0x0d,0xff,0x13,0x09,0x0e,0xff,0x24,0x18,0x1a,0xff,0x3b,0x30,0x28,0xff,0x4e,0x43,0x36,0xff,0x53,0x47,0x3c,0xff,0x54,0x48,0x3b,0xff,0x53,0x45,0x3b,0xff,0x50,0x42,0x39,0xff,0x47,0x39,0x30,0xff,0x95,0x8e,0x88,0xff,0xff,0xff,0xff,0x67,0xff,0xff,0xff,0x00,0xfe,0xed,0xf3,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfe,0xf0,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfa,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xef,0x00,0xfd,0xea,0xf2,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xb0,0xaa,0xa6,0x71,0x4f,0x41,0x3a,0xff,0x57,0x49,0x41,0xff,0x59,0x4c,0x42,0xff,0x59,0x4c,0x43,0xff,0x5c,0x4f,0x46,0xff,0x5d,0x50,0x47,0xff,0x61,0x52,0x49,0xff,0x62,0x53,0x4a,0xff,0x63,0x55,0x4b,0xff,0x65,0x58,0x4c,0xff,0x66,0x59,0x4d,0xff,0x68,0x5a,0x4d,0xff,0x6c,0x5b,0x4e,0xff,0x6e,0x5d,0x51,0xff,0x6f,0x5e,0x54,0xff,0x70,0x60,0x53,0xff,0x72,0x62,0x54,0xff,0x73,0x63,0x56,0xff,0x75,0x66,0x58,0xff,0x77,0x67,0x5a,0xff,0x7a,0x6b,0x5c,0xff,0x7b,0x6c,0x5d,0xff,0x7d,0x6e,0x5e,0xff,0x7d,0x6e,0x5f,0xff,0x7f,0x6f,0x60,0xff,0x82,0x71,0x5f,0xff,0x82,0x72,0x60,0xff,0x85,0x74,0x62,0xff,0x87,0x76,0x64,0xff,0x86,0x77,0x65,0xff,0x86,0x78,0x66,0xff,0x87,0x77,0x65,0xff,0x89,0x78,0x66,0xff,0x89,0x78,0x66,0xff,0x89,0x78,0x66,0xff,0x88,0x78,0x66,0xff,0x8a,0x78,0x66,0xff,0x8b,0x77,0x65,0xff,0x85,0x74,0x63,0xff,0x21,0x19,0x19,0xff,0x08,0x01,0x07,0xff,0x14,0x0c,0x11,0xff,0x1d,0x14,0x1a,0xff,0x19,0x0c,0x14,0xff,0x1c,0x0c,0x12,0xff,0x34,0x1f,0x23,0xff,0x44,0x2f,0x33,0xff,0x23,0x16,0x22,0xff,0x3a,0x38,0x4c,0xff,0x42,0x4a,0x5f,0xff,0x4a,0x4e,0x6a,0xff,0x20,0x22,0x3e,0xff,0x2f,0x31,0x4d,0xff,0x2e,0x32,0x4e,0xff,0x3a,0x44,0x64,0xff,0x65,0x76,0x9d,0xff,0x6e,0x84,0xb1,0xff,0x6c,0x86,0xb5,0xff,0x73,0x8d,0xc2,0xff,0x77,0x8f,0xcb,0xff,0x77,0x94,0xcb,0xff,0x7f,0x9d,0xd6,0xff,0x8a,0xa9,0xe2,0xff,0x94,0xb4,0xea,0xff,0x9f,0xbc,0xef,0xff,0xaa,0xc6,0xf4,0xff,0xb3,0xcf,0xf8,0xff,0xb9,0xd2,0xf9,0xff,0xbe,0xd5,0xf9,0xff,0xbf,0xd5,0xf6,0xff,0xbf,0xd3,0xf6,0xff,0xba,0xcf,0xf5,0xff,0xb7,0xcc,0xf3,0xff,0xb9,0xce,0xf4,0xff,0xb6,0xcb,0xf0,0xff,0xb7,0xcc,0xf1,0xff,0xb8,0xce,0xf3,0xff,0xb7,0xcd,0xf0,0xff,0xb6,0xcb,0xef,0xff,0xb6,0xca,0xee,0xff,0xb3,0xc9,0xec,0xff,0xb2,0xc7,0xea,0xff,0xb3,0xc8,0xeb,0xff,0xaf,0xc4,0xe9,0xff,0xac,0xc2,0xe8,0xff,0xa9,0xc0,0xe7,0xff,0xa6,0xbc,0xe5,0xff,0x9b,0xb1,0xdf,0xff,0x8a,0xa2,0xd5,0xff,0x75,0x90,0xc5,0xff,0x65,0x7e,0xb4,0xff,0x6f,0x82,0xb1,0xff,0x68,0x7a,0xa8,0xff,0x4b,0x60,0x8a,0xff,0x49,0x5d,0x85,0xff,0x49,0x59,0x7f,0xff,0x49,0x55,0x7a,0xff,0x3f,0x49,0x6b,0xff,0x2c,0x35,0x54,0xff,0x35,0x42,0x5f,0xff,0x3a,0x48,0x66,0xff,0x3f,0x4b,0x69,0xff,0x38,0x45,0x60,0xff,0x2f,0x3c,0x55,0xff,0x38,0x46,0x5d,0xff,0x3a,0x46,0x5d,0xff,0x57,0x63,0x76,0xff,0x4a,0x52,0x64,0xff,0x44,0x4b,0x5b,0xff,0x41,0x48,0x55,0xff,0x2e,0x32,0x3d,0xff,0x2b,0x2c,0x38,0xff,0x22,0x21,0x2c,0xff,0x24,0x21,0x2b,0xff,0x25,0x1e,0x25,0xff,0x0f,0x09,0x0d,0xff,0x19,0x10,0x14,0xff,0x16,0x0d,0x10,0xff,0x11,0x09,0x0b,0xff,0x13,0x09,0x0c,0xff,0x2f,0x24,0x21,0xff,0x4c,0x3f,0x37,0xff,0x5b,0x4d,0x42,0xff,0x5a,0x4c,0x41,0xff,0x55,0x48,0x3d,0xff,0x56,0x48,0x3c,0xff,0x56,0x47,0x3d,0xff,0x53,0x44,0x3b,0xff,0x4c,0x3f,0x36,0xff,0x5c,0x50,0x48,0xff,0xe1,0xdf,0xdd,0xc9,0xff,0xff,0xff,0x02,0xfe,0xf6,0xf9,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfe,0xf0,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xff,0xff,0x00,0xf3,0xf2,0xf1,0x05,0x75,0x6a,0x64,0xcf,0x51,0x43,0x3b,0xff,0x58,0x4a,0x42,0xff,0x5a,0x4d,0x43,0xff,0x5b,0x4e,0x45,0xff,0x5d,0x50,0x46,0xff,0x5f,0x50,0x47,0xff,0x62,0x53,0x4a,0xff,0x64,0x55,0x4b,0xff,0x65,0x57,0x4c,0xff,0x66,0x59,0x4d,0xff,0x69,0x5a,0x4e,0xff,0x6b,0x5c,0x4e,0xff,0x6d,0x5c,0x51,0xff,0x6f,0x5d,0x56,0xff,0x70,0x61,0x53,0xff,0x74,0x64,0x55,0xff,0x74,0x64,0x56,0xff,0x76,0x66,0x5a,0xff,0x77,0x67,0x59,0xff,0x79,0x69,0x5b,0xff,0x7c,0x6c,0x5e,0xff,0x7d,0x6d,0x5e,0xff,0x7f,0x6e,0x5f,0xff,0x81,0x70,0x60,0xff,0x81,0x72,0x61,0xff,0x83,0x72,0x61,0xff,0x85,0x75,0x62,0xff,0x87,0x77,0x63,0xff,0x89,0x78,0x66,0xff,0x88,0x78,0x66,0xff,0x8a,0x79,0x67,0xff,0x8c,0x79,0x68,0xff,0x8b,0x7a,0x68,0xff,0x8c,0x7b,0x68,0xff,0x8e,0x7c,0x69,0xff,0x8c,0x79,0x68,0xff,0x8c,0x7a,0x67,0xff,0x94,0x81,0x6c,0xff,0x6f,0x5f,0x56,0xff,0x13,0x0b,0x10,0xff,0x23,0x1b,0x20,0xff,0x20,0x16,0x1c,0xff,0x14,0x08,0x10,0xff,0x17,0x07,0x11,0xff,0x25,0x11,0x19,0xff,0x40,0x2a,0x2d,0xff,0x43,0x2e,0x31,0xff,0x20,0x14,0x22,0xff,0x43,0x40,0x58,0xff,0x55,0x5d,0x76,0xff,0x54,0x59,0x77,0xff,0x2e,0x31,0x50,0xff,0x45,0x48,0x68,0xff,0x39,0x40,0x5d,0xff,0x49,0x54,0x75,0xff,0x66,0x75,0xa0,0xff,0x73,0x8a,0xb9,0xff,0x74,0x8d,0xc1,0xff,0x76,0x94,0xca,0xff,0x79,0x96,0xce,0xff,0x7c,0x99,0xd0,0xff,0x80,0x9d,0xd5,0xff,0x89,0xa8,0xe2,0xff,0x95,0xb5,0xeb,0xff,0xa5,0xc3,0xf3,0xff,0xb1,0xca,0xf8,0xff,0xb5,0xcf,0xf9,0xff,0xbc,0xd5,0xf9,0xff,0xbe,0xd6,0xfa,0xff,0xc1,0xd6,0xfa,0xff,0xc7,0xda,0xfb,0xff,0xc4,0xd9,0xfb,0xff,0xbc,0xd2,0xf6,0xff,0xba,0xd0,0xf5,0xff,0xbb,0xce,0xf4,0xff,0xb8,0xcc,0xf1,0xff,0xb7,0xce,0xf3,0xff,0xb7,0xcf,0xf3,0xff,0xb8,0xce,0xf3,0xff,0xb8,0xcc,0xf2,0xff,0xb5,0xca,0xef,0xff,0xb6,0xcb,0xf0,0xff,0xb3,0xc8,0xed,0xff,0xaf,0xc7,0xec,0xff,0xb0,0xc6,0xeb,0xff,0xac,0xc1,0xe8,0xff,0xa7,0xbf,0xe7,0xff,0x9c,0xb5,0xe3,0xff,0x8b,0xa4,0xd7,0xff,0x77,0x91,0xc5,0xff,0x64,0x7d,0xb4,0xff,0x63,0x78,0xaa,0xff,0x5e,0x71,0x9f,0xff,0x4a,0x5d,0x89,0xff,0x40,0x51,0x79,0xff,0x44,0x54,0x78,0xff,0x47,0x55,0x78,0xff,0x43,0x4e,0x6f,0xff,0x3f,0x48,0x66,0xff,0x40,0x45,0x62,0xff,0x3b,0x42,0x5b,0xff,0x3e,0x49,0x63,0xff,0x3d,0x4b,0x65,0xff,0x3a,0x4a,0x60,0xff,0x3d,0x49,0x5f,0xff,0x44,0x50,0x65,0xff,0x4b,0x55,0x6a,0xff,0x53,0x5c,0x6f,0xff,0x49,0x52,0x62,0xff,0x41,0x48,0x55,0xff,0x28,0x2a,0x34,0xff,0x19,0x18,0x22,0xff,0x16,0x14,0x1d,0xff,0x2a,0x26,0x2f,0xff,0x1b,0x15,0x1c,0xff,0x0c,0x04,0x07,0xff,0x19,0x0e,0x10,0xff,0x1c,0x10,0x13,0xff,0x23,0x17,0x17,0xff,0x41,0x37,0x2c,0xff,0x5c,0x51,0x43,0xff,0x5e,0x50,0x42,0xff,0x5d,0x4c,0x41,0xff,0x5c,0x4d,0x42,0xff,0x54,0x47,0x3b,0xff,0x56,0x48,0x3b,0xff,0x58,0x49,0x3e,0xff,0x54,0x45,0x3c,0xff,0x4f,0x43,0x38,0xff,0x48,0x3b,0x31,0xff,0xa6,0x9f,0x9b,0xff,0xff,0xff,0xff,0x42,0xff,0xfe,0xfe,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfe,0xf0,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xff,0xfa,0xfb,0x00,0xff,0xff,0xff,0x00,0xc8,0xc3,0xc1,0x48,0x56,0x48,0x41,0xff,0x56,0x49,0x3f,0xff,0x5a,0x4d,0x44,0xff,0x5a,0x4e,0x45,0xff,0x5e,0x52,0x49,0xff,0x60,0x52,0x49,0xff,0x61,0x52,0x49,0xff,0x64,0x55,0x4c,0xff,0x66,0x56,0x4c,0xff,0x68,0x59,0x4e,0xff,0x6a,0x5b,0x4f,0xff,0x6b,0x5b,0x50,0xff,0x6e,0x5e,0x52,0xff,0x6e,0x5d,0x53,0xff,0x70,0x5e,0x57,0xff,0x73,0x64,0x55,0xff,0x76,0x67,0x57,0xff,0x77,0x67,0x59,0xff,0x78,0x68,0x5c,0xff,0x7a,0x6a,0x5c,0xff,0x7b,0x6b,0x5d,0xff,0x7b,0x6b,0x5d,0xff,0x7f,0x6e,0x5f,0xff,0x80,0x6f,0x60,0xff,0x81,0x72,0x60,0xff,0x82,0x73,0x61,0xff,0x86,0x75,0x65,0xff,0x87,0x77,0x63,0xff,0x88,0x79,0x64,0xff,0x8b,0x79,0x67,0xff,0x8b,0x79,0x68,0xff,0x8c,0x7a,0x68,0xff,0x8f,0x7d,0x6a,0xff,0x8e,0x7c,0x6b,0xff,0x8e,0x7c,0x69,0xff,0x8f,0x7d,0x6a,0xff,0x8e,0x7b,0x69,0xff,0x8f,0x7b,0x69,0xff,0x99,0x86,0x72,0xff,0x56,0x47,0x43,0xff,0x17,0x0e,0x15,0xff,0x17,0x10,0x14,0xff,0x0f,0x05,0x0c,0xff,0x12,0x06,0x0e,0xff,0x19,0x09,0x13,0xff,0x23,0x0f,0x18,0xff,0x49,0x31,0x37,0xff,0x48,0x32,0x38,0xff,0x17,0x0e,0x1c,0xff,0x42,0x41,0x5b,0xff,0x6a,0x72,0x8b,0xff,0x56,0x5e,0x7b,0xff,0x29,0x2f,0x4d,0xff,0x4b,0x51,0x70,0xff,0x4b,0x54,0x71,0xff,0x4b,0x58,0x7a,0xff,0x6b,0x7a,0xa7,0xff,0x76,0x8c,0xbd,0xff,0x77,0x90,0xc8,0xff,0x78,0x95,0xcc,0xff,0x7d,0x9b,0xd1,0xff,0x7f,0x9c,0xd2,0xff,0x7e,0x9d,0xd5,0xff,0x87,0xa7,0xe0,0xff,0x8f,0xac,0xe8,0xff,0x8e,0xa8,0xda,0xff,0x8e,0xa0,0xd1,0xff,0x8e,0x9f,0xcf,0xff,0x8f,0xa0,0xcb,0xff,0x92,0xa2,0xd0,0xff,0x9f,0xb0,0xe0,0xff,0xa4,0xbb,0xeb,0xff,0xaf,0xc7,0xf4,0xff,0xb7,0xcf,0xf9,0xff,0xb6,0xcf,0xf8,0xff,0xb5,0xce,0xf4,0xff,0xb3,0xcc,0xf1,0xff,0xb2,0xca,0xf1,0xff,0xb2,0xca,0xf2,0xff,0xb0,0xc8,0xf1,0xff,0xaf,0xca,0xf1,0xff,0xb0,0xcb,0xf1,0xff,0xb2,0xc9,0xef,0xff,0xb3,0xc8,0xef,0xff,0xae,0xc5,0xec,0xff,0xaf,0xc6,0xeb,0xff,0xaf,0xc6,0xe8,0xff,0xa8,0xbe,0xe5,0xff,0x97,0xb0,0xe1,0xff,0x85,0x9f,0xd3,0xff,0x73,0x8b,0xc0,0xff,0x60,0x78,0xaf,0xff,0x5d,0x72,0xa5,0xff,0x5b,0x6c,0x9c,0xff,0x45,0x57,0x82,0xff,0x43,0x50,0x74,0xff,0x3a,0x40,0x60,0xff,0x37,0x3a,0x5a,0xff,0x38,0x3b,0x55,0xff,0x37,0x3a,0x52,0xff,0x2e,0x32,0x4a,0xff,0x2c,0x31,0x4b,0xff,0x2a,0x31,0x4c,0xff,0x1f,0x23,0x3d,0xff,0x1a,0x1d,0x33,0xff,0x1c,0x1e,0x34,0xff,0x30,0x34,0x49,0xff,0x41,0x49,0x5e,0xff,0x39,0x40,0x54,0xff,0x47,0x4d,0x5e,0xff,0x56,0x5c,0x68,0xff,0x46,0x47,0x52,0xff,0x2a,0x28,0x32,0xff,0x14,0x12,0x1b,0xff,0x0e,0x0b,0x12,0xff,0x14,0x0f,0x16,0xff,0x14,0x0e,0x11,0xff,0x2a,0x21,0x20,0xff,0x26,0x1a,0x1a,0xff,0x40,0x32,0x2e,0xff,0x58,0x4b,0x3e,0xff,0x5d,0x4e,0x40,0xff,0x61,0x50,0x43,0xff,0x5f,0x4f,0x43,0xff,0x5a,0x4a,0x3e,0xff,0x55,0x46,0x3b,0xff,0x58,0x4b,0x3d,0xff,0x57,0x49,0x3e,0xff,0x54,0x46,0x3c,0xff,0x51,0x44,0x3a,0xff,0x4a,0x3c,0x33,0xff,0x6e,0x63,0x5b,0xff,0xf1,0xf0,0xf0,0xa2,0xff,0xff,0xff,0x00,0xfe,0xf2,0xf6,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xef,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe4,0xee,0x00,0xfe,0xee,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0x92,0x89,0x84,0xa4,0x51,0x44,0x3a,0xff,0x59,0x4c,0x42,0xff,0x5b,0x4f,0x46,0xff,0x5c,0x4f,0x46,0xff,0x5d,0x50,0x48,0xff,0x61,0x53,0x4a,0xff,0x64,0x54,0x4c,0xff,0x65,0x56,0x4d,0xff,0x67,0x56,0x4e,0xff,0x6a,0x58,0x4f,0xff,0x6c,0x5a,0x4f,0xff,0x6c,0x5c,0x51,0xff,0x6e,0x5f,0x54,0xff,0x70,0x5e,0x54,0xff,0x72,0x61,0x55,0xff,0x74,0x65,0x55,0xff,0x77,0x68,0x58,0xff,0x78,0x69,0x5b,0xff,0x7a,0x6a,0x5b,0xff,0x7b,0x6c,0x5c,0xff,0x7e,0x6f,0x5f,0xff,0x80,0x70,0x60,0xff,0x81,0x6f,0x60,0xff,0x83,0x71,0x62,0xff,0x85,0x74,0x63,0xff,0x86,0x76,0x64,0xff,0x88,0x77,0x65,0xff,0x89,0x79,0x65,0xff,0x8b,0x7a,0x67,0xff,0x8d,0x7a,0x68,0xff,0x8e,0x7b,0x69,0xff,0x8e,0x7c,0x6a,0xff,0x8f,0x80,0x6c,0xff,0x91,0x7e,0x6c,0xff,0x90,0x7e,0x6c,0xff,0x8f,0x7f,0x6d,0xff,0x91,0x80,0x6b,0xff,0x92,0x7f,0x6c,0xff,0x97,0x85,0x73,0xff,0x39,0x2f,0x2d,0xff,0x08,0x00,0x07,0xff,0x0d,0x04,0x0a,0xff,0x0f,0x06,0x0c,0xff,0x0e,0x06,0x0c,0xff,0x19,0x0c,0x13,0xff,0x2b,0x14,0x1d,0xff,0x42,0x2b,0x30,0xff,0x41,0x2b,0x32,0xff,0x1a,0x11,0x22,0xff,0x44,0x4a,0x63,0xff,0x73,0x7d,0x93,0xff,0x56,0x5d,0x7b,0xff,0x25,0x2b,0x50,0xff,0x2d,0x35,0x56,0xff,0x4e,0x55,0x73,0xff,0x4e,0x5d,0x81,0xff,0x67,0x7d,0xaa,0xff,0x78,0x90,0xc1,0xff,0x79,0x92,0xc8,0xff,0x7d,0x98,0xce,0xff,0x80,0x9c,0xd3,0xff,0x7e,0x99,0xcf,0xff,0x77,0x92,0xc9,0xff,0x75,0x8b,0xc5,0xff,0x78,0x89,0xc2,0xff,0x6c,0x7b,0xaf,0xff,0x62,0x69,0x99,0xff,0x58,0x5e,0x8a,0xff,0x5b,0x60,0x8a,0xff,0x67,0x6d,0x95,0xff,0x73,0x76,0x9f,0xff,0x76,0x7c,0xa6,0xff,0x85,0x92,0xc0,0xff,0x8e,0x9e,0xcf,0xff,0x91,0xa8,0xd7,0xff,0x98,0xb7,0xe5,0xff,0xa3,0xc0,0xee,0xff,0xab,0xc4,0xef,0xff,0xa8,0xc1,0xf0,0xff,0xa6,0xbd,0xec,0xff,0xa8,0xbe,0xed,0xff,0xa7,0xbf,0xee,0xff,0xaa,0xc1,0xed,0xff,0xaa,0xc2,0xed,0xff,0xab,0xc2,0xed,0xff,0xad,0xc4,0xec,0xff,0xaa,0xc2,0xeb,0xff,0xa0,0xb6,0xe6,0xff,0x8f,0xa6,0xdb,0xff,0x79,0x92,0xc7,0xff,0x69,0x82,0xb8,0xff,0x5b,0x72,0xa7,0xff,0x59,0x6e,0x9d,0xff,0x5b,0x6d,0x97,0xff,0x40,0x4b,0x72,0xff,0x31,0x34,0x51,0xff,0x28,0x25,0x41,0xff,0x22,0x20,0x3a,0xff,0x18,0x15,0x2b,0xff,0x1a,0x17,0x2d,0xff,0x18,0x17,0x2f,0xff,0x14,0x18,0x31,0xff,0x1c,0x23,0x40,0xff,0x1d,0x22,0x3b,0xff,0x17,0x18,0x2d,0xff,0x10,0x12,0x29,0xff,0x1e,0x23,0x39,0xff,0x36,0x3b,0x50,0xff,0x36,0x3b,0x4d,0xff,0x3a,0x3c,0x4b,0xff,0x4a,0x4d,0x59,0xff,0x40,0x41,0x4d,0xff,0x1e,0x1a,0x25,0xff,0x15,0x11,0x1b,0xff,0x0b,0x08,0x10,0xff,0x14,0x10,0x16,0xff,0x4b,0x41,0x3a,0xff,0x52,0x44,0x37,0xff,0x43,0x35,0x2c,0xff,0x50,0x43,0x38,0xff,0x5b,0x4e,0x41,0xff,0x64,0x54,0x45,0xff,0x62,0x52,0x43,0xff,0x60,0x52,0x44,0xff,0x53,0x44,0x38,0xff,0x5a,0x49,0x3e,0xff,0x5a,0x4b,0x40,0xff,0x55,0x49,0x3d,0xff,0x54,0x48,0x3d,0xff,0x53,0x46,0x3d,0xff,0x4f,0x42,0x39,0xff,0x4f,0x43,0x39,0xff,0xc6,0xc2,0xbe,0xed,0xff,0xff,0xff,0x1b,0xff,0xfb,0xfc,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xef,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe4,0xee,0x00,0xfe,0xf5,0xf9,0x00,0xff,0xff,0xff,0x00,0xe5,0xe3,0xe1,0x18,0x66,0x59,0x53,0xea,0x56,0x49,0x41,0xff,0x5c,0x4f,0x45,0xff,0x5e,0x50,0x47,0xff,0x60,0x51,0x48,0xff,0x61,0x52,0x4a,0xff,0x63,0x55,0x4b,0xff,0x63,0x54,0x4b,0xff,0x67,0x56,0x4d,0xff,0x69,0x58,0x4e,0xff,0x6a,0x59,0x4e,0xff,0x6d,0x5c,0x51,0xff,0x6f,0x5f,0x52,0xff,0x71,0x61,0x54,0xff,0x72,0x62,0x55,0xff,0x73,0x63,0x56,0xff,0x76,0x66,0x59,0xff,0x79,0x69,0x5b,0xff,0x79,0x69,0x5b,0xff,0x7b,0x6b,0x5e,0xff,0x7c,0x6c,0x5f,0xff,0x7f,0x6f,0x62,0xff,0x80,0x6f,0x61,0xff,0x81,0x70,0x60,0xff,0x83,0x75,0x63,0xff,0x85,0x76,0x64,0xff,0x87,0x77,0x64,0xff,0x8b,0x79,0x65,0xff,0x8c,0x7b,0x66,0xff,0x8e,0x7c,0x69,0xff,0x8f,0x7c,0x6a,0xff,0x8f,0x7c,0x69,0xff,0x8d,0x7b,0x68,0xff,0x93,0x83,0x6f,0xff,0x91,0x80,0x6c,0xff,0x92,0x81,0x6e,0xff,0x93,0x82,0x6f,0xff,0x91,0x7f,0x6c,0xff,0x93,0x80,0x6d,0xff,0x90,0x7d,0x6e,0xff,0x2b,0x20,0x23,0xff,0x07,0x02,0x07,0xff,0x0d,0x07,0x0c,0xff,0x0a,0x06,0x0b,0xff,0x0f,0x07,0x0c,0xff,0x1f,0x0b,0x15,0xff,0x32,0x19,0x21,0xff,0x4e,0x36,0x3a,0xff,0x34,0x1d,0x26,0xff,0x1d,0x18,0x27,0xff,0x42,0x49,0x64,0xff,0x73,0x7d,0x95,0xff,0x49,0x50,0x71,0xff,0x1e,0x21,0x4b,0xff,0x1d,0x24,0x49,0xff,0x35,0x3c,0x5c,0xff,0x58,0x65,0x8c,0xff,0x71,0x87,0xb4,0xff,0x7e,0x94,0xc5,0xff,0x7e,0x97,0xcc,0xff,0x80,0x9e,0xd3,0xff,0x84,0xa3,0xd8,0xff,0x7d,0x97,0xca,0xff,0x75,0x88,0xbb,0xff,0x77,0x85,0xb3,0xff,0x71,0x83,0xaa,0xff,0x73,0x83,0xae,0xff,0x7c,0x8c,0xb8,0xff,0x7a,0x8c,0xb8,0xff,0x74,0x86,0xb5,0xff,0x72,0x81,0xac,0xff,0x62,0x62,0x8a,0xff,0x55,0x54,0x72,0xff,0x50,0x4c,0x68,0xff,0x5b,0x55,0x74,0xff,0x60,0x60,0x7f,0xff,0x74,0x75,0x9f,0xff,0x7e,0x8a,0xb7,0xff,0x84,0x99,0xc6,0xff,0x8b,0xa3,0xd4,0xff,0x8e,0xac,0xdb,0xff,0x91,0xab,0xdf,0xff,0x95,0xad,0xe1,0xff,0x98,0xaf,0xe2,0xff,0x9e,0xb4,0xe5,0xff,0x9f,0xb7,0xe4,0xff,0xa2,0xbb,0xe6,0xff,0x9f,0xb7,0xe5,0xff,0x8d,0xa5,0xdb,0xff,0x7a,0x92,0xc7,0xff,0x6a,0x80,0xb5,0xff,0x5d,0x6f,0xa4,0xff,0x4e,0x60,0x90,0xff,0x51,0x63,0x85,0xff,0x50,0x58,0x75,0xff,0x47,0x45,0x61,0xff,0x33,0x2c,0x47,0xff,0x2f,0x28,0x42,0xff,0x1b,0x18,0x30,0xff,0x1b,0x19,0x2f,0xff,0x22,0x1e,0x36,0xff,0x29,0x24,0x3d,0xff,0x18,0x18,0x2f,0xff,0x1a,0x1e,0x39,0xff,0x1e,0x22,0x3e,0xff,0x1d,0x20,0x34,0xff,0x15,0x17,0x2c,0xff,0x13,0x16,0x2d,0xff,0x25,0x28,0x3e,0xff,0x2a,0x2b,0x3d,0xff,0x27,0x27,0x35,0xff,0x30,0x2e,0x3c,0xff,0x2c,0x2b,0x3b,0xff,0x1a,0x17,0x22,0xff,0x22,0x1e,0x26,0xff,0x13,0x11,0x18,0xff,0x3c,0x34,0x30,0xff,0x70,0x61,0x4e,0xff,0x6b,0x5b,0x4a,0xff,0x63,0x53,0x45,0xff,0x63,0x56,0x47,0xff,0x64,0x55,0x46,0xff,0x66,0x58,0x47,0xff,0x67,0x57,0x47,0xff,0x58,0x49,0x3c,0xff,0x4e,0x40,0x35,0xff,0x5e,0x4f,0x44,0xff,0x53,0x44,0x38,0xff,0x55,0x48,0x3c,0xff,0x56,0x4a,0x3f,0xff,0x55,0x48,0x3f,0xff,0x53,0x46,0x3d,0xff,0x48,0x3b,0x31,0xff,0x8b,0x83,0x7d,0xff,0xff,0xff,0xff,0x67,0xff,0xff,0xff,0x00,0xfe,0xed,0xf3,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xee,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf6,0xf9,0x00,0xfd,0xe6,0xf0,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xb5,0xaf,0xab,0x61,0x55,0x47,0x3f,0xff,0x5b,0x4e,0x46,0xff,0x5d,0x50,0x46,0xff,0x60,0x52,0x49,0xff,0x62,0x53,0x4a,0xff,0x64,0x54,0x4d,0xff,0x65,0x54,0x4d,0xff,0x64,0x55,0x4c,0xff,0x69,0x58,0x50,0xff,0x6c,0x5b,0x51,0xff,0x6c,0x5b,0x50,0xff,0x6e,0x5d,0x52,0xff,0x70,0x60,0x54,0xff,0x72,0x62,0x55,0xff,0x73,0x63,0x56,0xff,0x76,0x66,0x58,0xff,0x77,0x68,0x5a,0xff,0x79,0x6a,0x5b,0xff,0x7a,0x6b,0x5e,0xff,0x7e,0x6d,0x60,0xff,0x7f,0x6e,0x60,0xff,0x80,0x6f,0x61,0xff,0x82,0x71,0x62,0xff,0x85,0x74,0x63,0xff,0x85,0x76,0x64,0xff,0x87,0x76,0x64,0xff,0x8a,0x78,0x66,0xff,0x8b,0x7b,0x67,0xff,0x8e,0x7c,0x68,0xff,0x90,0x7d,0x69,0xff,0x90,0x7d,0x6b,0xff,0x91,0x7e,0x6f,0xff,0x80,0x6e,0x62,0xff,0x76,0x65,0x58,0xff,0x91,0x81,0x6e,0xff,0x99,0x88,0x72,0xff,0x95,0x85,0x71,0xff,0x94,0x83,0x6d,0xff,0x97,0x84,0x6f,0xff,0x7e,0x6d,0x61,0xff,0x1b,0x11,0x16,0xff,0x09,0x03,0x08,0xff,0x0c,0x06,0x0b,0xff,0x0a,0x06,0x0b,0xff,0x10,0x07,0x0e,0xff,0x21,0x0c,0x16,0xff,0x39,0x20,0x26,0xff,0x5d,0x44,0x43,0xff,0x3a,0x22,0x29,0xff,0x1b,0x18,0x2f,0xff,0x44,0x4e,0x6c,0xff,0x73,0x7d,0x9a,0xff,0x44,0x48,0x6d,0xff,0x14,0x15,0x3f,0xff,0x22,0x2c,0x52,0xff,0x45,0x4c,0x70,0xff,0x65,0x71,0x9b,0xff,0x7b,0x91,0xbf,0xff,0x88,0x9e,0xcf,0xff,0x89,0xa2,0xd6,0xff,0x89,0xa5,0xda,0xff,0x88,0xa5,0xda,0xff,0x7c,0x94,0xc3,0xff,0x6c,0x77,0xa1,0xff,0x60,0x66,0x89,0xff,0x56,0x60,0x80,0xff,0x68,0x6e,0x91,0xff,0x74,0x7a,0x9e,0xff,0x76,0x7f,0xa4,0xff,0x7e,0x8a,0xb0,0xff,0x7f,0x8c,0xb4,0xff,0x7a,0x84,0xaf,0xff,0x75,0x7d,0xa4,0xff,0x59,0x5f,0x7d,0xff,0x44,0x45,0x61,0xff,0x36,0x30,0x4f,0xff,0x31,0x28,0x4a,0xff,0x3e,0x3a,0x5a,0xff,0x4b,0x4a,0x6a,0xff,0x59,0x5e,0x7f,0xff,0x5f,0x6c,0x94,0xff,0x6c,0x7d,0xaa,0xff,0x72,0x89,0xbb,0xff,0x7c,0x95,0xca,0xff,0x86,0x9e,0xd0,0xff,0x90,0xa9,0xd9,0xff,0x97,0xad,0xdd,0xff,0x95,0xab,0xdc,0xff,0x7d,0x96,0xcb,0xff,0x69,0x82,0xb6,0xff,0x5a,0x6c,0x9d,0xff,0x49,0x54,0x80,0xff,0x3a,0x3e,0x61,0xff,0x43,0x47,0x60,0xff,0x3c,0x39,0x50,0xff,0x30,0x28,0x3f,0xff,0x2a,0x25,0x39,0xff,0x21,0x1c,0x30,0xff,0x15,0x13,0x25,0xff,0x1e,0x18,0x28,0xff,0x12,0x0c,0x1a,0xff,0x17,0x12,0x20,0xff,0x0d,0x0b,0x17,0xff,0x11,0x12,0x24,0xff,0x1d,0x1e,0x39,0xff,0x16,0x17,0x2c,0xff,0x21,0x21,0x36,0xff,0x21,0x22,0x39,0xff,0x20,0x20,0x35,0xff,0x21,0x1f,0x32,0xff,0x10,0x0d,0x19,0xff,0x16,0x13,0x1b,0xff,0x1f,0x1e,0x2d,0xff,0x1e,0x1a,0x27,0xff,0x1c,0x15,0x20,0xff,0x36,0x2d,0x32,0xff,0x6e,0x62,0x51,0xff,0x68,0x59,0x47,0xff,0x6f,0x5f,0x4f,0xff,0x6f,0x5e,0x4f,0xff,0x6b,0x5c,0x4c,0xff,0x69,0x5a,0x48,0xff,0x6a,0x5b,0x49,0xff,0x5f,0x52,0x45,0xff,0x41,0x33,0x28,0xff,0x5b,0x4e,0x41,0xff,0x4f,0x43,0x37,0xff,0x4d,0x3f,0x33,0xff,0x55,0x48,0x3d,0xff,0x56,0x4a,0x3f,0xff,0x55,0x48,0x3f,0xff,0x55,0x48,0x3f,0xff,0x4e,0x41,0x38,0xff,0x60,0x54,0x4b,0xff,0xe5,0xe3,0xe2,0xbb,0xff,0xff,0xff,0x00,0xfe,0xf4,0xf8,0x00,0xfd,0xe4,0xee,0x00,0xfe,0xee,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xec,0xf4,0x00,0xff,0xff,0xff,0x00,0xfb,0xfb,0xfa,0x00,0x86,0x7c,0x76,0xb2,0x57,0x48,0x40,0xff,0x5e,0x51,0x47,0xff,0x61,0x52,0x4a,0xff,0x61,0x53,0x4a,0xff,0x61,0x55,0x4c,0xff,0x64,0x56,0x4b,0xff,0x65,0x56,0x4d,0xff,0x67,0x58,0x4f,0xff,0x69,0x5a,0x51,0xff,0x6c,0x5c,0x52,0xff,0x6e,0x5e,0x52,0xff,0x70,0x5f,0x54,0xff,0x71,0x60,0x56,0xff,0x73,0x62,0x57,0xff,0x74,0x64,0x57,0xff,0x77,0x67,0x58,0xff,0x78,0x69,0x58,0xff,0x7a,0x6a,0x5b,0xff,0x7b,0x6c,0x5e,0xff,0x7f,0x6f,0x60,0xff,0x81,0x70,0x60,0xff,0x82,0x71,0x61,0xff,0x84,0x72,0x62,0xff,0x86,0x75,0x63,0xff,0x8b,0x76,0x65,0xff,0x8c,0x77,0x67,0xff,0x8c,0x79,0x68,0xff,0x8d,0x7d,0x69,0xff,0x8f,0x7d,0x69,0xff,0x91,0x7e,0x6b,0xff,0x92,0x81,0x6c,0xff,0x93,0x83,0x71,0xff,0x88,0x79,0x6c,0xff,0x58,0x49,0x41,0xff,0x47,0x37,0x34,0xff,0x70,0x64,0x59,0xff,0x85,0x77,0x67,0xff,0x85,0x73,0x61,0xff,0x82,0x6e,0x5f,0xff,0x5b,0x4d,0x4a,0xff,0x0a,0x04,0x0a,0xff,0x0b,0x05,0x0a,0xff,0x0b,0x05,0x0a,0xff,0x0d,0x06,0x0c,0xff,0x12,0x07,0x10,0xff,0x23,0x0e,0x19,0xff,0x3e,0x23,0x29,0xff,0x5e,0x44,0x41,0xff,0x49,0x30,0x34,0xff,0x26,0x26,0x44,0xff,0x5c,0x67,0x8a,0xff,0x65,0x72,0x91,0xff,0x38,0x3a,0x61,0xff,0x2b,0x32,0x5e,0xff,0x5b,0x6d,0x97,0xff,0x49,0x50,0x76,0xff,0x68,0x72,0x9b,0xff,0x80,0x94,0xc2,0xff,0x8c,0xa4,0xd4,0xff,0x92,0xac,0xdf,0xff,0x94,0xad,0xe3,0xff,0x8b,0xa6,0xdc,0xff,0x76,0x8e,0xbd,0xff,0x5d,0x67,0x90,0xff,0x4d,0x4e,0x6e,0xff,0x4b,0x4a,0x66,0xff,0x4c,0x4a,0x65,0xff,0x4c,0x49,0x65,0xff,0x44,0x41,0x5e,0xff,0x39,0x36,0x52,0xff,0x32,0x2f,0x47,0xff,0x35,0x2f,0x48,0xff,0x3d,0x34,0x50,0xff,0x40,0x38,0x51,0xff,0x42,0x3a,0x53,0xff,0x39,0x33,0x4d,0xff,0x2b,0x28,0x48,0xff,0x24,0x23,0x49,0xff,0x24,0x27,0x50,0xff,0x2e,0x2e,0x54,0xff,0x36,0x33,0x57,0xff,0x3c,0x37,0x5c,0xff,0x49,0x4d,0x77,0xff,0x5c,0x6b,0x9b,0xff,0x76,0x8a,0xba,0xff,0x89,0xa1,0xd1,0xff,0x98,0xad,0xde,0xff,0x97,0xab,0xde,0xff,0x7e,0x98,0xcc,0xff,0x68,0x82,0xb6,0xff,0x4b,0x5b,0x85,0xff,0x2c,0x2e,0x50,0xff,0x28,0x24,0x41,0xff,0x3a,0x36,0x4f,0xff,0x2a,0x26,0x3b,0xff,0x14,0x10,0x26,0xff,0x1a,0x14,0x24,0xff,0x26,0x1c,0x2b,0xff,0x11,0x0a,0x1a,0xff,0x13,0x0d,0x1b,0xff,0x0c,0x06,0x10,0xff,0x0a,0x04,0x0e,0xff,0x0f,0x0c,0x16,0xff,0x0e,0x0d,0x19,0xff,0x1e,0x1e,0x35,0xff,0x18,0x19,0x32,0xff,0x1d,0x1c,0x33,0xff,0x22,0x21,0x35,0xff,0x2b,0x29,0x3c,0xff,0x2d,0x28,0x3a,0xff,0x1a,0x16,0x1d,0xff,0x11,0x0e,0x13,0xff,0x26,0x25,0x33,0xff,0x0f,0x0d,0x17,0xff,0x11,0x0c,0x0e,0xff,0x49,0x41,0x3b,0xff,0x58,0x4c,0x3d,0xff,0x6e,0x5d,0x4e,0xff,0x70,0x5e,0x4e,0xff,0x70,0x5f,0x4d,0xff,0x6d,0x5f,0x4d,0xff,0x6e,0x5f,0x4d,0xff,0x6b,0x5c,0x4f,0xff,0x39,0x2e,0x27,0xff,0x4a,0x3d,0x34,0xff,0x58,0x4c,0x40,0xff,0x39,0x2e,0x22,0xff,0x50,0x43,0x37,0xff,0x5b,0x4e,0x42,0xff,0x57,0x4a,0x3f,0xff,0x57,0x4a,0x41,0xff,0x53,0x46,0x3e,0xff,0x54,0x47,0x3e,0xff,0x4a,0x3d,0x33,0xff,0xb0,0xab,0xa7,0xf5,0xff,0xff,0xff,0x27,0xff,0xfa,0xfd,0x00,0xfd,0xe6,0xf0,0x00,0xfe,0xed,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xe1,0xdf,0xdd,0x1c,0x66,0x5b,0x51,0xee,0x5b,0x4e,0x43,0xff,0x60,0x53,0x4a,0xff,0x64,0x55,0x4c,0xff,0x65,0x56,0x4d,0xff,0x66,0x58,0x4e,0xff,0x67,0x59,0x4d,0xff,0x68,0x59,0x4e,0xff,0x6a,0x5b,0x52,0xff,0x6c,0x5e,0x52,0xff,0x6e,0x5e,0x52,0xff,0x70,0x5f,0x54,0xff,0x72,0x61,0x56,0xff,0x73,0x62,0x58,0xff,0x73,0x62,0x58,0xff,0x75,0x66,0x56,0xff,0x79,0x6a,0x5b,0xff,0x7a,0x6b,0x5c,0xff,0x7b,0x6b,0x5e,0xff,0x7e,0x6e,0x61,0xff,0x81,0x70,0x62,0xff,0x83,0x71,0x64,0xff,0x85,0x73,0x65,0xff,0x88,0x74,0x67,0xff,0x8a,0x76,0x66,0xff,0x8b,0x77,0x68,0xff,0x8d,0x79,0x69,0xff,0x8d,0x7a,0x68,0xff,0x8f,0x7c,0x68,0xff,0x90,0x7d,0x6a,0xff,0x92,0x7f,0x6c,0xff,0x91,0x7f,0x6d,0xff,0x8c,0x7b,0x6b,0xff,0x89,0x7b,0x6a,0xff,0x64,0x54,0x4b,0xff,0x4d,0x3a,0x3c,0xff,0x27,0x16,0x1d,0xff,0x21,0x11,0x17,0xff,0x31,0x1f,0x24,0xff,0x34,0x25,0x29,0xff,0x25,0x18,0x1e,0xff,0x10,0x06,0x10,0xff,0x0c,0x05,0x0a,0xff,0x0c,0x06,0x0b,0xff,0x0e,0x08,0x0d,0xff,0x17,0x0b,0x15,0xff,0x24,0x0f,0x1c,0xff,0x3e,0x25,0x2c,0xff,0x66,0x4a,0x48,0xff,0x4e,0x35,0x39,0xff,0x33,0x34,0x52,0xff,0x73,0x7f,0xa5,0xff,0x66,0x76,0xa2,0xff,0x40,0x46,0x75,0xff,0x51,0x5e,0x8d,0xff,0x6a,0x84,0xb5,0xff,0x43,0x4a,0x70,0xff,0x66,0x6f,0x95,0xff,0x7f,0x90,0xbf,0xff,0x8c,0xa3,0xd3,0xff,0x95,0xb0,0xe1,0xff,0x9e,0xb6,0xea,0xff,0x98,0xb1,0xe6,0xff,0x80,0x9c,0xce,0xff,0x63,0x79,0xa4,0xff,0x4d,0x4d,0x71,0xff,0x38,0x2c,0x49,0xff,0x31,0x24,0x3c,0xff,0x24,0x18,0x2f,0xff,0x17,0x0d,0x1f,0xff,0x16,0x0c,0x18,0xff,0x26,0x18,0x20,0xff,0x28,0x17,0x21,0xff,0x27,0x17,0x23,0xff,0x1f,0x0d,0x1b,0xff,0x1a,0x07,0x18,0xff,0x18,0x0d,0x1f,0xff,0x16,0x11,0x25,0xff,0x13,0x0e,0x24,0xff,0x16,0x15,0x34,0xff,0x26,0x29,0x50,0xff,0x2e,0x2f,0x58,0xff,0x27,0x26,0x50,0xff,0x28,0x27,0x4e,0xff,0x49,0x4b,0x73,0xff,0x72,0x86,0xb6,0xff,0x91,0xac,0xda,0xff,0xa6,0xbe,0xe7,0xff,0xa9,0xbe,0xe7,0xff,0x99,0xb3,0xe0,0xff,0x7b,0x95,0xc8,0xff,0x48,0x52,0x7a,0xff,0x22,0x1d,0x3b,0xff,0x21,0x1c,0x38,0xff,0x1f,0x1c,0x32,0xff,0x23,0x1f,0x31,0xff,0x20,0x19,0x30,0xff,0x16,0x0c,0x1c,0xff,0x19,0x0e,0x1d,0xff,0x1e,0x19,0x28,0xff,0x24,0x1d,0x2c,0xff,0x1c,0x14,0x20,0xff,0x0a,0x03,0x10,0xff,0x0d,0x06,0x13,0xff,0x15,0x10,0x1f,0xff,0x24,0x26,0x3f,0xff,0x26,0x29,0x46,0xff,0x18,0x15,0x2d,0xff,0x09,0x09,0x17,0xff,0x19,0x18,0x22,0xff,0x19,0x16,0x21,0xff,0x1c,0x1a,0x21,0xff,0x18,0x16,0x1b,0xff,0x14,0x11,0x1f,0xff,0x08,0x08,0x0f,0xff,0x35,0x2d,0x2b,0xff,0x44,0x38,0x2e,0xff,0x63,0x55,0x45,0xff,0x76,0x64,0x52,0xff,0x71,0x5f,0x50,0xff,0x6b,0x59,0x4a,0xff,0x71,0x5e,0x4e,0xff,0x6b,0x5a,0x4a,0xff,0x40,0x34,0x2b,0xff,0x33,0x28,0x22,0xff,0x5b,0x4e,0x47,0xff,0x33,0x25,0x1f,0xff,0x3e,0x31,0x27,0xff,0x5f,0x51,0x44,0xff,0x5c,0x4f,0x43,0xff,0x5b,0x4f,0x44,0xff,0x53,0x46,0x3c,0xff,0x4e,0x41,0x38,0xff,0x49,0x3f,0x36,0xff,0x32,0x26,0x1f,0xff,0x7f,0x77,0x73,0xff,0xff,0xff,0xff,0x6b,0xff,0xff,0xff,0x00,0xfd,0xea,0xf2,0x00,0xfe,0xec,0xf3,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xbc,0xb6,0xb2,0x59,0x59,0x4b,0x40,0xff,0x5e,0x50,0x46,0xff,0x62,0x54,0x4b,0xff,0x64,0x56,0x4d,0xff,0x66,0x56,0x4d,0xff,0x68,0x58,0x4f,0xff,0x68,0x58,0x50,0xff,0x6a,0x5b,0x50,0xff,0x6c,0x5e,0x52,0xff,0x6d,0x5f,0x53,0xff,0x6f,0x5f,0x54,0xff,0x72,0x61,0x57,0xff,0x73,0x62,0x58,0xff,0x74,0x64,0x56,0xff,0x77,0x67,0x58,0xff,0x79,0x69,0x5a,0xff,0x79,0x68,0x5c,0xff,0x7a,0x6a,0x5e,0xff,0x7c,0x6c,0x5f,0xff,0x81,0x6f,0x63,0xff,0x81,0x70,0x63,0xff,0x83,0x72,0x64,0xff,0x86,0x75,0x65,0xff,0x88,0x75,0x66,0xff,0x8c,0x78,0x67,0xff,0x8c,0x78,0x68,0xff,0x8f,0x7b,0x6b,0xff,0x91,0x7e,0x6c,0xff,0x91,0x7e,0x6b,0xff,0x91,0x7e,0x6a,0xff,0x92,0x7f,0x6c,0xff,0x92,0x81,0x6f,0xff,0x87,0x77,0x67,0xff,0x6d,0x5e,0x50,0xff,0x79,0x6a,0x64,0xff,0x49,0x3c,0x36,0xff,0x45,0x33,0x38,0xff,0x1f,0x13,0x1a,0xff,0x14,0x09,0x12,0xff,0x20,0x12,0x1d,0xff,0x14,0x09,0x14,0xff,0x13,0x07,0x0f,0xff,0x0c,0x04,0x0a,0xff,0x0b,0x06,0x0a,0xff,0x0e,0x08,0x0d,0xff,0x15,0x0a,0x14,0xff,0x24,0x11,0x1d,0xff,0x39,0x22,0x29,0xff,0x51,0x37,0x36,0xff,0x45,0x2d,0x31,0xff,0x42,0x41,0x63,0xff,0x7c,0x8f,0xb3,0xff,0x75,0x89,0xba,0xff,0x4b,0x59,0x92,0xff,0x54,0x62,0x97,0xff,0x58,0x6d,0x9f,0xff,0x42,0x48,0x6a,0xff,0x60,0x65,0x87,0xff,0x7f,0x8e,0xbc,0xff,0x90,0xa8,0xd9,0xff,0x9a,0xb3,0xe3,0xff,0xa5,0xbd,0xed,0xff,0xaa,0xc4,0xf3,0xff,0x9a,0xb5,0xe7,0xff,0x83,0x9e,0xd0,0xff,0x64,0x6f,0x9a,0xff,0x37,0x2f,0x50,0xff,0x26,0x17,0x30,0xff,0x24,0x15,0x21,0xff,0x33,0x23,0x29,0xff,0x53,0x3e,0x47,0xff,0x49,0x35,0x38,0xff,0x4c,0x39,0x3e,0xff,0x38,0x2b,0x31,0xff,0x30,0x23,0x2e,0xff,0x22,0x13,0x21,0xff,0x27,0x1e,0x2a,0xff,0x4b,0x45,0x54,0xff,0x39,0x35,0x4c,0xff,0x15,0x0b,0x2b,0xff,0x14,0x0e,0x29,0xff,0x2d,0x2c,0x53,0xff,0x27,0x27,0x52,0xff,0x1b,0x1b,0x42,0xff,0x3c,0x40,0x67,0xff,0x77,0x8f,0xbf,0xff,0xa7,0xc1,0xed,0xff,0xc1,0xd3,0xf1,0xff,0xc8,0xd8,0xf4,0xff,0xb9,0xce,0xf1,0xff,0x97,0xaf,0xdd,0xff,0x40,0x46,0x6b,0xff,0x13,0x0e,0x27,0xff,0x1c,0x18,0x2d,0xff,0x17,0x12,0x2f,0xff,0x31,0x2d,0x45,0xff,0x59,0x4f,0x5b,0xff,0x37,0x2f,0x35,0xff,0x2a,0x28,0x2e,0xff,0x39,0x34,0x38,0xff,0x51,0x48,0x4b,0xff,0x38,0x32,0x3b,0xff,0x0e,0x07,0x16,0xff,0x0d,0x06,0x18,0xff,0x19,0x13,0x2b,0xff,0x20,0x21,0x3f,0xff,0x2d,0x32,0x52,0xff,0x25,0x26,0x3e,0xff,0x0b,0x08,0x13,0xff,0x04,0x03,0x06,0xff,0x10,0x0f,0x13,0xff,0x07,0x05,0x0b,0xff,0x0e,0x0c,0x10,0xff,0x0b,0x06,0x0e,0xff,0x18,0x13,0x14,0xff,0x41,0x33,0x31,0xff,0x3e,0x30,0x2b,0xff,0x61,0x51,0x42,0xff,0x73,0x61,0x52,0xff,0x77,0x65,0x56,0xff,0x6d,0x5c,0x4d,0xff,0x62,0x53,0x44,0xff,0x46,0x38,0x2e,0xff,0x26,0x19,0x17,0xff,0x3e,0x31,0x2e,0xff,0x34,0x28,0x24,0xff,0x2d,0x20,0x1c,0xff,0x5e,0x53,0x47,0xff,0x5e,0x50,0x43,0xff,0x5c,0x4f,0x43,0xff,0x51,0x46,0x3b,0xff,0x47,0x3b,0x32,0xff,0x4b,0x40,0x37,0xff,0x2d,0x22,0x1b,0xff,0x3f,0x34,0x2d,0xff,0x52,0x49,0x42,0xff,0xe5,0xe3,0xe2,0xb6,0xff,0xff,0xff,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xeb,0xf3,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x00,0x93,0x89,0x83,0xa1,0x59,0x49,0x40,0xff,0x61,0x52,0x49,0xff,0x64,0x55,0x4c,0xff,0x65,0x55,0x4d,0xff,0x68,0x57,0x4e,0xff,0x6b,0x59,0x50,0xff,0x6b,0x5a,0x53,0xff,0x6d,0x5f,0x53,0xff,0x6d,0x60,0x52,0xff,0x71,0x62,0x56,0xff,0x73,0x63,0x58,0xff,0x75,0x63,0x5a,0xff,0x76,0x65,0x5a,0xff,0x76,0x67,0x58,0xff,0x77,0x66,0x5a,0xff,0x78,0x68,0x5b,0xff,0x7b,0x6b,0x5d,0xff,0x7b,0x6c,0x5e,0xff,0x7e,0x6d,0x60,0xff,0x82,0x70,0x62,0xff,0x83,0x72,0x63,0xff,0x83,0x74,0x64,0xff,0x87,0x76,0x66,0xff,0x8b,0x78,0x67,0xff,0x8c,0x79,0x67,0xff,0x8c,0x79,0x68,0xff,0x8f,0x7d,0x6b,0xff,0x91,0x7e,0x6d,0xff,0x92,0x7f,0x6e,0xff,0x93,0x80,0x6d,0xff,0x94,0x80,0x6d,0xff,0x94,0x82,0x70,0xff,0x96,0x86,0x74,0xff,0x7e,0x6e,0x61,0xff,0x4e,0x3d,0x39,0xff,0x5b,0x4b,0x4c,0xff,0x2e,0x23,0x28,0xff,0x33,0x24,0x2a,0xff,0x34,0x22,0x2a,0xff,0x2a,0x18,0x22,0xff,0x10,0x08,0x11,0xff,0x0f,0x07,0x0d,0xff,0x0c,0x05,0x0a,0xff,0x0b,0x05,0x0a,0xff,0x0d,0x07,0x0d,0xff,0x12,0x08,0x11,0xff,0x20,0x0f,0x1a,0xff,0x32,0x1c,0x27,0xff,0x38,0x1d,0x25,0xff,0x43,0x29,0x31,0xff,0x3f,0x3f,0x57,0xff,0x6c,0x82,0xa4,0xff,0x85,0x99,0xc8,0xff,0x8d,0x9f,0xd2,0xff,0x54,0x66,0x9b,0xff,0x43,0x52,0x83,0xff,0x3b,0x3e,0x5d,0xff,0x51,0x50,0x72,0xff,0x77,0x82,0xaf,0xff,0x8c,0xa2,0xd3,0xff,0x9f,0xb6,0xe6,0xff,0xad,0xc5,0xf2,0xff,0xb5,0xcd,0xf6,0xff,0xb8,0xcd,0xf4,0xff,0xab,0xc2,0xef,0xff,0x90,0xa9,0xda,0xff,0x71,0x7e,0xaa,0xff,0x57,0x56,0x7f,0xff,0x51,0x43,0x5e,0xff,0x41,0x2d,0x42,0xff,0x3c,0x2a,0x44,0xff,0x61,0x57,0x70,0xff,0x94,0x87,0x8b,0xff,0x9a,0x8f,0x7e,0xff,0x6d,0x6e,0x65,0xff,0x5d,0x61,0x5c,0xff,0x77,0x72,0x6f,0xff,0xba,0xb4,0xb5,0xff,0x86,0x82,0xa1,0xff,0x43,0x37,0x6b,0xff,0x24,0x19,0x38,0xff,0x43,0x3d,0x5b,0xff,0x57,0x59,0x7d,0xff,0x3e,0x3d,0x63,0xff,0x46,0x4d,0x77,0xff,0x7c,0x96,0xc6,0xff,0xb4,0xcd,0xf4,0xff,0xd3,0xe0,0xf6,0xff,0xdd,0xe6,0xf7,0xff,0xcc,0xdd,0xf7,0xff,0xa8,0xbe,0xe8,0xff,0x44,0x48,0x6a,0xff,0x2d,0x27,0x3a,0xff,0x34,0x2e,0x3c,0xff,0x3e,0x33,0x4b,0xff,0x4a,0x3f,0x55,0xff,0x62,0x58,0x66,0xff,0x6c,0x62,0x6b,0xff,0x58,0x4e,0x59,0xff,0x57,0x51,0x5b,0xff,0x51,0x47,0x53,0xff,0x29,0x1e,0x32,0xff,0x11,0x09,0x19,0xff,0x13,0x0e,0x24,0xff,0x26,0x23,0x45,0xff,0x35,0x34,0x58,0xff,0x37,0x3c,0x5e,0xff,0x2f,0x31,0x49,0xff,0x10,0x0d,0x17,0xff,0x04,0x02,0x06,0xff,0x08,0x06,0x0b,0xff,0x1a,0x16,0x1b,0xff,0x08,0x05,0x08,0xff,0x00,0x00,0x02,0xff,0x38,0x2b,0x2a,0xff,0x32,0x24,0x21,0xff,0x4d,0x3e,0x38,0xff,0x57,0x46,0x3b,0xff,0x6f,0x5d,0x50,0xff,0x6a,0x5a,0x4a,0xff,0x68,0x59,0x46,0xff,0x56,0x48,0x3d,0xff,0x24,0x18,0x15,0xff,0x21,0x14,0x14,0xff,0x32,0x24,0x25,0xff,0x25,0x19,0x17,0xff,0x4e,0x43,0x3c,0xff,0x5a,0x4e,0x3f,0xff,0x5a,0x4b,0x3d,0xff,0x54,0x46,0x3b,0xff,0x38,0x2d,0x24,0xff,0x41,0x36,0x30,0xff,0x2b,0x20,0x1c,0xff,0x40,0x35,0x31,0xff,0x34,0x29,0x24,0xff,0x2f,0x27,0x1f,0xff,0xbc,0xb9,0xb6,0xec,0xff,0xff,0xff,0x17,0xff,0xf7,0xfa,0x00,0xfe,0xed,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xef,0xed,0xeb,0x0a,0x74,0x66,0x5e,0xd8,0x5c,0x4c,0x44,0xff,0x62,0x53,0x4a,0xff,0x64,0x55,0x4c,0xff,0x64,0x55,0x4e,0xff,0x67,0x59,0x4e,0xff,0x6a,0x5c,0x50,0xff,0x6e,0x5e,0x50,0xff,0x6f,0x5f,0x51,0xff,0x72,0x61,0x54,0xff,0x73,0x63,0x55,0xff,0x74,0x64,0x58,0xff,0x76,0x66,0x5b,0xff,0x78,0x6a,0x5a,0xff,0x7a,0x69,0x5b,0xff,0x7b,0x68,0x5c,0xff,0x7b,0x6b,0x5e,0xff,0x7d,0x6c,0x62,0xff,0x7f,0x70,0x60,0xff,0x82,0x71,0x61,0xff,0x84,0x72,0x61,0xff,0x85,0x74,0x62,0xff,0x87,0x77,0x65,0xff,0x8a,0x77,0x66,0xff,0x8c,0x7a,0x68,0xff,0x8a,0x7a,0x68,0xff,0x8f,0x7b,0x6c,0xff,0x91,0x7c,0x6d,0xff,0x91,0x7f,0x6d,0xff,0x93,0x81,0x6d,0xff,0x94,0x82,0x70,0xff,0x94,0x83,0x72,0xff,0x97,0x83,0x72,0xff,0x92,0x81,0x6f,0xff,0x9a,0x8a,0x77,0xff,0x68,0x58,0x4e,0xff,0x27,0x16,0x1c,0xff,0x35,0x25,0x2e,0xff,0x22,0x10,0x1a,0xff,0x3e,0x2a,0x33,0xff,0x2a,0x17,0x21,0xff,0x0e,0x05,0x0e,0xff,0x0d,0x08,0x0e,0xff,0x0d,0x07,0x0c,0xff,0x0c,0x06,0x0b,0xff,0x0c,0x06,0x0c,0xff,0x10,0x08,0x0f,0xff,0x1a,0x0a,0x15,0xff,0x2f,0x18,0x25,0xff,0x3a,0x1f,0x2c,0xff,0x40,0x25,0x2f,0xff,0x47,0x48,0x55,0xff,0x67,0x7b,0x9c,0xff,0x6d,0x7f,0xb3,0xff,0xb6,0xcc,0xf2,0xff,0x86,0xa6,0xd8,0xff,0x21,0x2f,0x6f,0xff,0x3f,0x43,0x66,0xff,0x41,0x3f,0x5d,0xff,0x63,0x6a,0x8f,0xff,0x83,0x95,0xc8,0xff,0x9d,0xb3,0xe6,0xff,0xb0,0xc7,0xf4,0xff,0xb6,0xcd,0xf6,0xff,0xbf,0xd7,0xf9,0xff,0xbf,0xd7,0xfb,0xff,0xb7,0xcf,0xf7,0xff,0xa9,0xc0,0xe9,0xff,0x96,0xa6,0xd2,0xff,0x7a,0x82,0xaf,0xff,0x42,0x37,0x62,0xff,0x25,0x13,0x30,0xff,0x52,0x40,0x5b,0xff,0x91,0x7e,0x9a,0xff,0xbb,0xaa,0xba,0xff,0xab,0xa2,0xa5,0xff,0xa4,0x9e,0xa0,0xff,0xaf,0xa4,0xb4,0xff,0xa7,0x9c,0xb5,0xff,0x7c,0x71,0x8c,0xff,0x5c,0x4f,0x69,0xff,0x49,0x3b,0x4e,0xff,0x4c,0x48,0x60,0xff,0x88,0x90,0xb0,0xff,0x81,0x89,0xab,0xff,0x74,0x86,0xb5,0xff,0x94,0xab,0xde,0xff,0xb7,0xcc,0xf3,0xff,0xd2,0xdf,0xf7,0xff,0xe6,0xec,0xf8,0xff,0xd7,0xe4,0xf7,0xff,0xb5,0xca,0xf1,0xff,0x61,0x6a,0x89,0xff,0x50,0x4b,0x60,0xff,0x47,0x3c,0x53,0xff,0x44,0x37,0x4d,0xff,0x47,0x39,0x4f,0xff,0x43,0x34,0x4c,0xff,0x3d,0x2f,0x49,0xff,0x36,0x2a,0x43,0xff,0x30,0x24,0x3b,0xff,0x26,0x19,0x2e,0xff,0x20,0x14,0x26,0xff,0x1f,0x16,0x27,0xff,0x27,0x1f,0x41,0xff,0x2e,0x2f,0x53,0xff,0x38,0x40,0x64,0xff,0x3e,0x44,0x69,0xff,0x33,0x32,0x4b,0xff,0x0a,0x06,0x0e,0xff,0x05,0x02,0x06,0xff,0x05,0x01,0x07,0xff,0x10,0x0e,0x11,0xff,0x16,0x14,0x18,0xff,0x19,0x13,0x13,0xff,0x47,0x39,0x37,0xff,0x24,0x17,0x15,0xff,0x4f,0x3f,0x36,0xff,0x66,0x55,0x4b,0xff,0x62,0x52,0x44,0xff,0x56,0x46,0x38,0xff,0x5a,0x4a,0x3e,0xff,0x30,0x20,0x24,0xff,0x11,0x06,0x0b,0xff,0x2f,0x24,0x23,0xff,0x2c,0x20,0x23,0xff,0x2f,0x22,0x20,0xff,0x5e,0x51,0x46,0xff,0x53,0x45,0x3a,0xff,0x57,0x49,0x3f,0xff,0x34,0x29,0x22,0xff,0x39,0x2f,0x2a,0xff,0x28,0x1c,0x19,0xff,0x2b,0x20,0x1f,0xff,0x25,0x1b,0x1a,0xff,0x2b,0x21,0x1d,0xff,0x33,0x29,0x22,0xff,0x89,0x83,0x7e,0xff,0xff,0xff,0xff,0x4d,0xff,0xfd,0xfe,0x00,0xfe,0xf0,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xcf,0xcb,0xc8,0x2f,0x60,0x51,0x48,0xfd,0x5e,0x4f,0x46,0xff,0x64,0x54,0x4c,0xff,0x66,0x56,0x4f,0xff,0x68,0x58,0x50,0xff,0x69,0x5b,0x4e,0xff,0x6c,0x5d,0x4e,0xff,0x6e,0x5e,0x51,0xff,0x70,0x61,0x53,0xff,0x72,0x63,0x55,0xff,0x74,0x64,0x56,0xff,0x77,0x65,0x59,0xff,0x7b,0x68,0x5c,0xff,0x7c,0x6b,0x5b,0xff,0x7e,0x6d,0x5e,0xff,0x7e,0x6e,0x5f,0xff,0x7e,0x6f,0x60,0xff,0x80,0x70,0x61,0xff,0x81,0x71,0x60,0xff,0x83,0x72,0x61,0xff,0x84,0x74,0x62,0xff,0x87,0x76,0x64,0xff,0x89,0x78,0x65,0xff,0x8a,0x78,0x66,0xff,0x8c,0x7a,0x68,0xff,0x8e,0x7b,0x69,0xff,0x92,0x7d,0x6c,0xff,0x92,0x7e,0x6d,0xff,0x93,0x80,0x6e,0xff,0x95,0x82,0x70,0xff,0x96,0x84,0x70,0xff,0x97,0x85,0x71,0xff,0x9a,0x86,0x75,0xff,0x94,0x83,0x72,0xff,0x89,0x7a,0x65,0xff,0x8e,0x7d,0x6d,0xff,0x4d,0x3d,0x3d,0xff,0x1e,0x13,0x19,0xff,0x47,0x33,0x38,0xff,0x39,0x23,0x2b,0xff,0x1d,0x0e,0x18,0xff,0x0d,0x06,0x0d,0xff,0x0c,0x06,0x0c,0xff,0x0b,0x05,0x0a,0xff,0x0c,0x06,0x0c,0xff,0x0d,0x07,0x0c,0xff,0x0f,0x08,0x0f,0xff,0x15,0x0b,0x14,0xff,0x26,0x12,0x1f,0xff,0x38,0x20,0x2b,0xff,0x45,0x2c,0x36,0xff,0x5e,0x5b,0x69,0xff,0x70,0x7f,0xa3,0xff,0x89,0x9c,0xcd,0xff,0x99,0xb0,0xe1,0xff,0xcf,0xe6,0xff,0xff,0x62,0x75,0xae,0xff,0x32,0x38,0x63,0xff,0x39,0x38,0x52,0xff,0x4f,0x53,0x76,0xff,0x7d,0x8c,0xbe,0xff,0x94,0xab,0xe0,0xff,0xae,0xc3,0xf2,0xff,0xbd,0xd2,0xf9,0xff,0xc4,0xdb,0xfa,0xff,0xca,0xe1,0xfa,0xff,0xcb,0xe0,0xfc,0xff,0xc5,0xda,0xf9,0xff,0xbb,0xcf,0xf1,0xff,0x9e,0xb1,0xe1,0xff,0x7b,0x85,0xb5,0xff,0x53,0x4f,0x73,0xff,0x37,0x29,0x46,0xff,0x49,0x39,0x57,0xff,0x5b,0x49,0x64,0xff,0x61,0x50,0x6a,0xff,0x6d,0x5b,0x79,0xff,0x64,0x52,0x70,0xff,0x4d,0x3e,0x61,0xff,0x46,0x39,0x5d,0xff,0x53,0x4c,0x71,0xff,0x6a,0x64,0x88,0xff,0x7a,0x7e,0xa5,0xff,0x91,0x9e,0xc4,0xff,0x9a,0xaa,0xcc,0xff,0x9c,0xb2,0xdf,0xff,0xa8,0xbd,0xed,0xff,0xb8,0xce,0xf3,0xff,0xcc,0xde,0xf6,0xff,0xea,0xf0,0xf9,0xff,0xe1,0xe8,0xf7,0xff,0xc1,0xd4,0xf4,0xff,0x80,0x8e,0xb1,0xff,0x6c,0x71,0x8f,0xff,0x6a,0x6b,0x90,0xff,0x5a,0x57,0x81,0xff,0x4b,0x47,0x6c,0xff,0x3f,0x39,0x5d,0xff,0x31,0x29,0x4a,0xff,0x2c,0x23,0x40,0xff,0x2b,0x21,0x3d,0xff,0x25,0x1c,0x36,0xff,0x29,0x1f,0x3a,0xff,0x36,0x33,0x50,0xff,0x41,0x44,0x67,0xff,0x40,0x47,0x6c,0xff,0x3f,0x49,0x71,0xff,0x40,0x48,0x6e,0xff,0x34,0x33,0x4b,0xff,0x08,0x05,0x0b,0xff,0x04,0x02,0x06,0xff,0x06,0x03,0x08,0xff,0x05,0x02,0x06,0xff,0x09,0x07,0x09,0xff,0x43,0x34,0x36,0xff,0x29,0x20,0x20,0xff,0x39,0x2d,0x27,0xff,0x6a,0x5a,0x4e,0xff,0x4b,0x3d,0x36,0xff,0x41,0x35,0x2e,0xff,0x36,0x29,0x29,0xff,0x22,0x14,0x1b,0xff,0x16,0x0c,0x11,0xff,0x20,0x16,0x17,0xff,0x2a,0x1e,0x1f,0xff,0x22,0x16,0x17,0xff,0x48,0x3c,0x37,0xff,0x4d,0x41,0x38,0xff,0x54,0x48,0x41,0xff,0x29,0x20,0x1e,0xff,0x1e,0x14,0x15,0xff,0x2a,0x1f,0x1d,0xff,0x1b,0x11,0x11,0xff,0x17,0x0e,0x0f,0xff,0x25,0x1d,0x1b,0xff,0x3b,0x31,0x2d,0xff,0x36,0x2c,0x27,0xff,0x60,0x58,0x53,0xff,0xf3,0xf2,0xf2,0x87,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xae,0xa6,0xa1,0x6b,0x5b,0x4b,0x41,0xff,0x63,0x53,0x4a,0xff,0x65,0x55,0x4d,0xff,0x67,0x56,0x50,0xff,0x68,0x59,0x4f,0xff,0x6b,0x5c,0x4f,0xff,0x6e,0x5e,0x4f,0xff,0x6f,0x5e,0x53,0xff,0x70,0x61,0x56,0xff,0x72,0x63,0x57,0xff,0x75,0x65,0x58,0xff,0x79,0x68,0x5a,0xff,0x7d,0x6b,0x5b,0xff,0x7d,0x6b,0x5d,0xff,0x7e,0x6e,0x5f,0xff,0x80,0x70,0x61,0xff,0x80,0x71,0x61,0xff,0x83,0x71,0x62,0xff,0x84,0x72,0x62,0xff,0x84,0x73,0x62,0xff,0x86,0x75,0x64,0xff,0x88,0x76,0x65,0xff,0x8b,0x78,0x67,0xff,0x8b,0x7a,0x69,0xff,0x8d,0x7b,0x6a,0xff,0x8f,0x7b,0x6a,0xff,0x93,0x7e,0x6d,0xff,0x94,0x80,0x6f,0xff,0x94,0x81,0x6f,0xff,0x97,0x84,0x73,0xff,0x9a,0x86,0x74,0xff,0x9a,0x87,0x74,0xff,0x9b,0x87,0x76,0xff,0x9a,0x89,0x77,0xff,0x9b,0x8a,0x78,0xff,0x83,0x70,0x63,0xff,0x80,0x6a,0x61,0xff,0x46,0x39,0x35,0xff,0x3e,0x29,0x2c,0xff,0x40,0x29,0x32,0xff,0x15,0x09,0x13,0xff,0x0c,0x07,0x0b,0xff,0x0e,0x07,0x0c,0xff,0x0d,0x06,0x0b,0xff,0x11,0x0a,0x10,0xff,0x0f,0x08,0x0e,0xff,0x0f,0x08,0x10,0xff,0x13,0x0a,0x13,0xff,0x1e,0x0b,0x17,0xff,0x29,0x14,0x20,0xff,0x47,0x35,0x40,0xff,0x52,0x4c,0x5a,0xff,0x5d,0x65,0x88,0xff,0x97,0xab,0xd9,0xff,0x7e,0x95,0xd3,0xff,0x97,0xae,0xe2,0xff,0xbe,0xd8,0xf9,0xff,0x4d,0x57,0x81,0xff,0x30,0x2d,0x4d,0xff,0x3d,0x3a,0x59,0xff,0x73,0x79,0xa3,0xff,0x8e,0xa3,0xd6,0xff,0xa7,0xbc,0xeb,0xff,0xbd,0xd3,0xf8,0xff,0xc7,0xdd,0xfb,0xff,0xd2,0xe6,0xfb,0xff,0xd6,0xe9,0xfd,0xff,0xd3,0xe7,0xfe,0xff,0xcc,0xdf,0xfb,0xff,0xbf,0xd2,0xf5,0xff,0xac,0xc1,0xeb,0xff,0x99,0xab,0xd9,0xff,0x6f,0x76,0xa3,0xff,0x47,0x47,0x74,0xff,0x42,0x42,0x6d,0xff,0x43,0x3f,0x6e,0xff,0x51,0x4c,0x7d,0xff,0x53,0x4e,0x81,0xff,0x53,0x55,0x8c,0xff,0x7b,0x7e,0xb1,0xff,0x9a,0xa0,0xd2,0xff,0xa6,0xae,0xdc,0xff,0xaa,0xb6,0xe0,0xff,0xb3,0xbe,0xe5,0xff,0xb5,0xc5,0xe7,0xff,0xb1,0xc9,0xef,0xff,0xb1,0xc9,0xf1,0xff,0xb4,0xca,0xf2,0xff,0xc4,0xd7,0xf4,0xff,0xea,0xf1,0xfb,0xff,0xe7,0xed,0xfb,0xff,0xc7,0xd9,0xf3,0xff,0x8c,0x9d,0xc6,0xff,0x84,0x92,0xb9,0xff,0x7e,0x88,0xb6,0xff,0x6c,0x74,0xa8,0xff,0x65,0x6d,0x9c,0xff,0x5c,0x60,0x8f,0xff,0x4d,0x4e,0x78,0xff,0x41,0x42,0x67,0xff,0x3d,0x3e,0x65,0xff,0x44,0x45,0x6c,0xff,0x4f,0x50,0x79,0xff,0x55,0x5c,0x87,0xff,0x58,0x65,0x91,0xff,0x54,0x61,0x8d,0xff,0x4c,0x59,0x84,0xff,0x47,0x50,0x74,0xff,0x32,0x31,0x47,0xff,0x07,0x04,0x0a,0xff,0x03,0x02,0x06,0xff,0x06,0x03,0x08,0xff,0x07,0x02,0x07,0xff,0x17,0x0e,0x11,0xff,0x30,0x20,0x25,0xff,0x14,0x0c,0x0f,0xff,0x5a,0x4c,0x42,0xff,0x5d,0x4b,0x40,0xff,0x21,0x16,0x15,0xff,0x18,0x0d,0x14,0xff,0x19,0x0e,0x17,0xff,0x16,0x0b,0x15,0xff,0x1c,0x13,0x13,0xff,0x28,0x1c,0x1c,0xff,0x1a,0x0e,0x10,0xff,0x33,0x28,0x27,0xff,0x3a,0x2f,0x2b,0xff,0x3c,0x31,0x2d,0xff,0x30,0x26,0x23,0xff,0x17,0x0d,0x0f,0xff,0x28,0x1e,0x20,0xff,0x1b,0x11,0x13,0xff,0x18,0x0f,0x10,0xff,0x31,0x29,0x27,0xff,0x35,0x2e,0x29,0xff,0x2f,0x25,0x21,0xff,0x23,0x1a,0x16,0xff,0x38,0x2e,0x2b,0xff,0xda,0xd8,0xd6,0xc7,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfd,0xfd,0xfd,0x00,0x8f,0x84,0x7d,0x9d,0x5f,0x4d,0x41,0xff,0x67,0x56,0x4c,0xff,0x68,0x56,0x4e,0xff,0x6a,0x58,0x50,0xff,0x6b,0x5a,0x50,0xff,0x6d,0x5c,0x51,0xff,0x6e,0x5e,0x53,0xff,0x71,0x61,0x54,0xff,0x73,0x63,0x56,0xff,0x76,0x65,0x58,0xff,0x76,0x66,0x59,0xff,0x7a,0x6a,0x5b,0xff,0x7c,0x6b,0x5b,0xff,0x7e,0x6b,0x5e,0xff,0x82,0x6f,0x64,0xff,0x82,0x71,0x63,0xff,0x83,0x71,0x62,0xff,0x84,0x72,0x63,0xff,0x86,0x74,0x65,0xff,0x87,0x75,0x66,0xff,0x87,0x76,0x66,0xff,0x89,0x78,0x69,0xff,0x8a,0x79,0x6a,0xff,0x8d,0x7a,0x6b,0xff,0x8f,0x7b,0x6c,0xff,0x91,0x7d,0x6e,0xff,0x93,0x7f,0x70,0xff,0x95,0x81,0x71,0xff,0x96,0x83,0x72,0xff,0x97,0x84,0x73,0xff,0x9a,0x86,0x75,0xff,0x9b,0x88,0x77,0xff,0x9e,0x8a,0x79,0xff,0x9e,0x8d,0x79,0xff,0x9b,0x8a,0x77,0xff,0x99,0x87,0x77,0xff,0x7d,0x69,0x5f,0xff,0x67,0x54,0x4d,0xff,0x44,0x2f,0x34,0xff,0x31,0x1b,0x27,0xff,0x12,0x06,0x0f,0xff,0x0d,0x06,0x0c,0xff,0x0d,0x05,0x0b,0xff,0x0f,0x06,0x0c,0xff,0x11,0x09,0x0f,0xff,0x11,0x0a,0x10,0xff,0x11,0x0a,0x11,0xff,0x13,0x09,0x11,0xff,0x17,0x09,0x14,0xff,0x1e,0x0e,0x1a,0xff,0x2f,0x22,0x2d,0xff,0x4d,0x41,0x4f,0xff,0x50,0x4e,0x66,0xff,0x70,0x80,0xad,0xff,0x6b,0x7d,0xb3,0xff,0x44,0x54,0x8f,0xff,0x4a,0x5d,0x95,0xff,0x30,0x3a,0x68,0xff,0x30,0x2a,0x4d,0xff,0x34,0x2c,0x49,0xff,0x5e,0x5f,0x85,0xff,0x81,0x96,0xc6,0xff,0x9f,0xb5,0xe6,0xff,0xba,0xce,0xf6,0xff,0xc6,0xdd,0xfa,0xff,0xd3,0xe5,0xfd,0xff,0xd7,0xe9,0xfc,0xff,0xd9,0xea,0xfe,0xff,0xda,0xea,0xfd,0xff,0xd3,0xe5,0xfa,0xff,0xc7,0xdb,0xfa,0xff,0xbf,0xcf,0xf7,0xff,0xb4,0xc5,0xef,0xff,0xa3,0xb1,0xdf,0xff,0x93,0x9d,0xce,0xff,0x89,0x93,0xc4,0xff,0x8f,0x99,0xca,0xff,0x95,0x9f,0xd0,0xff,0xa6,0xaf,0xdf,0xff,0xb3,0xbb,0xed,0xff,0xb5,0xbc,0xf1,0xff,0xb9,0xc4,0xed,0xff,0xc3,0xd3,0xf1,0xff,0xc8,0xd7,0xf5,0xff,0xc4,0xd6,0xf7,0xff,0xbb,0xd3,0xf6,0xff,0xb5,0xcd,0xf3,0xff,0xb5,0xcb,0xf2,0xff,0xc0,0xd0,0xf3,0xff,0xe3,0xeb,0xf9,0xff,0xf0,0xf3,0xfb,0xff,0xd1,0xe0,0xf7,0xff,0x92,0xa5,0xce,0xff,0x89,0x9d,0xc6,0xff,0x88,0x98,0xc8,0xff,0x76,0x86,0xb8,0xff,0x6c,0x7b,0xaf,0xff,0x6b,0x7b,0xb0,0xff,0x6b,0x75,0xa9,0xff,0x68,0x70,0xa2,0xff,0x65,0x6f,0xa1,0xff,0x66,0x75,0xa5,0xff,0x65,0x76,0xa7,0xff,0x67,0x76,0xab,0xff,0x67,0x77,0xa9,0xff,0x61,0x71,0xa2,0xff,0x59,0x68,0x95,0xff,0x51,0x5b,0x7d,0xff,0x32,0x32,0x48,0xff,0x05,0x02,0x0b,0xff,0x04,0x02,0x07,0xff,0x07,0x02,0x08,0xff,0x0a,0x03,0x09,0xff,0x17,0x0d,0x14,0xff,0x16,0x0d,0x12,0xff,0x0e,0x07,0x08,0xff,0x37,0x2b,0x29,0xff,0x24,0x16,0x19,0xff,0x0b,0x03,0x09,0xff,0x10,0x08,0x0e,0xff,0x19,0x0e,0x15,0xff,0x14,0x0b,0x12,0xff,0x22,0x17,0x19,0xff,0x29,0x1d,0x1d,0xff,0x2c,0x1f,0x22,0xff,0x2e,0x22,0x24,0xff,0x25,0x19,0x1b,0xff,0x17,0x0d,0x0f,0xff,0x0a,0x01,0x04,0xff,0x18,0x0e,0x13,0xff,0x19,0x11,0x14,0xff,0x10,0x06,0x0b,0xff,0x23,0x18,0x1b,0xff,0x20,0x18,0x18,0xff,0x16,0x0f,0x0f,0xff,0x17,0x0e,0x0d,0xff,0x20,0x17,0x15,0xff,0x35,0x29,0x24,0xff,0xb6,0xb1,0xae,0xe9,0xff,0xff,0xff,0x18,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xf2,0xf1,0xf0,0x00,0x7d,0x6f,0x66,0xd2,0x63,0x52,0x46,0xff,0x68,0x57,0x4b,0xff,0x6a,0x58,0x4f,0xff,0x6d,0x5b,0x50,0xff,0x6d,0x5c,0x50,0xff,0x6e,0x5d,0x54,0xff,0x70,0x60,0x53,0xff,0x71,0x62,0x53,0xff,0x74,0x63,0x57,0xff,0x75,0x65,0x57,0xff,0x77,0x68,0x58,0xff,0x79,0x6a,0x5a,0xff,0x7c,0x6c,0x5c,0xff,0x7f,0x6e,0x5f,0xff,0x83,0x71,0x63,0xff,0x83,0x71,0x63,0xff,0x84,0x73,0x63,0xff,0x86,0x73,0x64,0xff,0x88,0x75,0x66,0xff,0x88,0x77,0x67,0xff,0x88,0x77,0x68,0xff,0x8a,0x79,0x6a,0xff,0x8e,0x79,0x6c,0xff,0x8f,0x7b,0x6c,0xff,0x91,0x7e,0x6e,0xff,0x93,0x7f,0x6f,0xff,0x95,0x82,0x72,0xff,0x96,0x84,0x72,0xff,0x97,0x86,0x73,0xff,0x9a,0x86,0x75,0xff,0x9c,0x89,0x76,0xff,0x9c,0x8a,0x77,0xff,0x99,0x88,0x77,0xff,0x90,0x7f,0x6e,0xff,0x84,0x72,0x63,0xff,0x7e,0x6c,0x61,0xff,0x70,0x5d,0x56,0xff,0x46,0x34,0x33,0xff,0x46,0x31,0x39,0xff,0x31,0x1e,0x28,0xff,0x13,0x07,0x0f,0xff,0x12,0x09,0x0f,0xff,0x0d,0x06,0x0d,0xff,0x0b,0x05,0x0b,0xff,0x0c,0x06,0x0c,0xff,0x0e,0x08,0x0d,0xff,0x0f,0x08,0x0e,0xff,0x0e,0x08,0x0f,0xff,0x0b,0x06,0x0f,0xff,0x11,0x05,0x12,0xff,0x24,0x14,0x22,0xff,0x3f,0x2e,0x3c,0xff,0x33,0x2f,0x39,0xff,0x59,0x63,0x7c,0xff,0x63,0x74,0xa5,0xff,0x8a,0x9a,0xc9,0xff,0x62,0x6e,0x9e,0xff,0x35,0x3d,0x6e,0xff,0x31,0x2f,0x56,0xff,0x33,0x2d,0x4b,0xff,0x48,0x45,0x67,0xff,0x74,0x83,0xb0,0xff,0x98,0xae,0xde,0xff,0xb4,0xc7,0xf2,0xff,0xc2,0xd6,0xfb,0xff,0xcf,0xe2,0xfd,0xff,0xd7,0xe8,0xfd,0xff,0xdd,0xec,0xfd,0xff,0xdf,0xef,0xfd,0xff,0xdf,0xee,0xfd,0xff,0xda,0xe8,0xfe,0xff,0xd4,0xe1,0xfa,0xff,0xd2,0xe1,0xfd,0xff,0xcd,0xdd,0xfd,0xff,0xc7,0xd5,0xf8,0xff,0xc3,0xd0,0xf6,0xff,0xbf,0xcc,0xf6,0xff,0xbc,0xca,0xf5,0xff,0xb6,0xc4,0xf0,0xff,0xb5,0xc0,0xf1,0xff,0xbf,0xca,0xf3,0xff,0xd2,0xde,0xfa,0xff,0xd3,0xe2,0xf9,0xff,0xce,0xe1,0xfa,0xff,0xc7,0xdc,0xfc,0xff,0xbd,0xd4,0xf7,0xff,0xb7,0xcd,0xf4,0xff,0xb6,0xca,0xf5,0xff,0xbc,0xcf,0xf5,0xff,0xdc,0xe6,0xf8,0xff,0xf2,0xf3,0xfd,0xff,0xdb,0xe5,0xfc,0xff,0x98,0xaa,0xd3,0xff,0x81,0x96,0xbe,0xff,0x88,0x9c,0xcd,0xff,0x85,0x9b,0xce,0xff,0x7a,0x8f,0xc3,0xff,0x74,0x87,0xbe,0xff,0x70,0x83,0xba,0xff,0x6d,0x82,0xb6,0xff,0x6c,0x83,0xb6,0xff,0x6e,0x85,0xb8,0xff,0x6f,0x87,0xba,0xff,0x6c,0x83,0xb7,0xff,0x67,0x80,0xb0,0xff,0x62,0x7b,0xaa,0xff,0x61,0x74,0xa1,0xff,0x57,0x61,0x82,0xff,0x2e,0x2f,0x41,0xff,0x04,0x01,0x07,0xff,0x06,0x03,0x07,0xff,0x07,0x01,0x07,0xff,0x0f,0x06,0x0e,0xff,0x17,0x0f,0x16,0xff,0x1e,0x14,0x1b,0xff,0x1f,0x14,0x1a,0xff,0x19,0x10,0x15,0xff,0x14,0x0d,0x13,0xff,0x1f,0x17,0x1d,0xff,0x17,0x0d,0x13,0xff,0x14,0x08,0x0e,0xff,0x1a,0x0f,0x14,0xff,0x23,0x17,0x19,0xff,0x22,0x17,0x18,0xff,0x2b,0x1e,0x20,0xff,0x18,0x0d,0x10,0xff,0x11,0x06,0x0c,0xff,0x0b,0x04,0x0a,0xff,0x09,0x03,0x06,0xff,0x18,0x0f,0x12,0xff,0x0f,0x08,0x0b,0xff,0x12,0x0b,0x10,0xff,0x13,0x0a,0x0f,0xff,0x13,0x0b,0x0e,0xff,0x1b,0x14,0x14,0xff,0x2c,0x22,0x22,0xff,0x35,0x2b,0x28,0xff,0x38,0x2d,0x25,0xff,0x96,0x91,0x8c,0xff,0xff,0xff,0xff,0x3e,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xde,0xda,0xd8,0x1d,0x6e,0x5d,0x53,0xee,0x67,0x55,0x4b,0xff,0x6b,0x5b,0x4e,0xff,0x6b,0x5a,0x50,0xff,0x6e,0x5d,0x51,0xff,0x6f,0x5f,0x52,0xff,0x70,0x5f,0x54,0xff,0x71,0x62,0x54,0xff,0x73,0x63,0x56,0xff,0x74,0x64,0x59,0xff,0x77,0x67,0x59,0xff,0x78,0x68,0x59,0xff,0x79,0x6a,0x5b,0xff,0x7c,0x6d,0x5d,0xff,0x81,0x6f,0x60,0xff,0x82,0x71,0x61,0xff,0x84,0x72,0x62,0xff,0x87,0x75,0x65,0xff,0x89,0x75,0x66,0xff,0x8a,0x77,0x68,0xff,0x8b,0x79,0x69,0xff,0x8c,0x7a,0x6b,0xff,0x8e,0x7a,0x6c,0xff,0x8f,0x7b,0x6c,0xff,0x91,0x7d,0x6d,0xff,0x92,0x7f,0x6e,0xff,0x95,0x82,0x70,0xff,0x97,0x82,0x71,0xff,0x97,0x84,0x72,0xff,0x98,0x86,0x73,0xff,0x9d,0x88,0x76,0xff,0x9c,0x89,0x76,0xff,0x9e,0x8c,0x78,0xff,0x9c,0x8a,0x78,0xff,0x94,0x82,0x70,0xff,0x91,0x7d,0x6f,0xff,0x8f,0x7c,0x6e,0xff,0x89,0x7b,0x69,0xff,0x6a,0x59,0x52,0xff,0x3b,0x25,0x2e,0xff,0x44,0x2c,0x36,0xff,0x22,0x12,0x1b,0xff,0x0f,0x06,0x0d,0xff,0x1c,0x0d,0x19,0xff,0x1d,0x0d,0x16,0xff,0x12,0x0a,0x10,0xff,0x0b,0x05,0x0b,0xff,0x0e,0x06,0x0c,0xff,0x0f,0x07,0x0f,0xff,0x12,0x0a,0x15,0xff,0x1f,0x0e,0x18,0xff,0x30,0x1a,0x27,0xff,0x47,0x31,0x3f,0xff,0x21,0x12,0x1d,0xff,0x4e,0x4c,0x5c,0xff,0x3f,0x48,0x65,0xff,0x79,0x89,0xb9,0xff,0xaa,0xbd,0xf3,0xff,0x85,0x97,0xc6,0xff,0x44,0x46,0x6e,0xff,0x34,0x2f,0x4d,0xff,0x3a,0x36,0x55,0xff,0x63,0x64,0x90,0xff,0x88,0x9b,0xcb,0xff,0xa5,0xbb,0xea,0xff,0xba,0xcc,0xf6,0xff,0xc9,0xdc,0xfb,0xff,0xd5,0xe6,0xfd,0xff,0xdc,0xea,0xfd,0xff,0xe0,0xf0,0xfe,0xff,0xe1,0xf0,0xff,0xff,0xe0,0xed,0xff,0xff,0xdb,0xea,0xfb,0xff,0xd6,0xe5,0xfc,0xff,0xd1,0xdf,0xfc,0xff,0xca,0xd8,0xf9,0xff,0xc2,0xcf,0xf5,0xff,0xbc,0xc9,0xf3,0xff,0xb8,0xc5,0xf4,0xff,0xb9,0xc5,0xf5,0xff,0xc5,0xd4,0xf6,0xff,0xd6,0xe7,0xfa,0xff,0xd9,0xe9,0xfd,0xff,0xd2,0xe2,0xfc,0xff,0xcc,0xe1,0xfc,0xff,0xc4,0xd9,0xfa,0xff,0xbf,0xd3,0xf8,0xff,0xb9,0xce,0xf6,0xff,0xb7,0xcb,0xf6,0xff,0xb8,0xce,0xf4,0xff,0xd6,0xe2,0xf8,0xff,0xf2,0xf3,0xfe,0xff,0xe1,0xe8,0xfc,0xff,0xa2,0xb3,0xda,0xff,0x81,0x95,0xc0,0xff,0x82,0x97,0xc9,0xff,0x85,0x9e,0xd1,0xff,0x8a,0xa1,0xd5,0xff,0x85,0x99,0xce,0xff,0x7d,0x92,0xc8,0xff,0x76,0x8d,0xc1,0xff,0x74,0x8b,0xbf,0xff,0x77,0x8d,0xc1,0xff,0x78,0x8f,0xc2,0xff,0x72,0x8a,0xbb,0xff,0x6b,0x84,0xb3,0xff,0x65,0x7d,0xac,0xff,0x63,0x74,0xa2,0xff,0x53,0x5b,0x7c,0xff,0x26,0x24,0x32,0xff,0x02,0x00,0x03,0xff,0x0b,0x05,0x09,0xff,0x1d,0x14,0x1a,0xff,0x24,0x1b,0x23,0xff,0x29,0x20,0x29,0xff,0x25,0x1a,0x22,0xff,0x2c,0x20,0x27,0xff,0x2c,0x22,0x27,0xff,0x2d,0x22,0x28,0xff,0x2b,0x1e,0x26,0xff,0x2e,0x22,0x26,0xff,0x1d,0x11,0x15,0xff,0x21,0x13,0x16,0xff,0x29,0x1c,0x1e,0xff,0x20,0x15,0x17,0xff,0x2a,0x1c,0x1f,0xff,0x1b,0x10,0x13,0xff,0x19,0x0d,0x12,0xff,0x0d,0x05,0x0a,0xff,0x0d,0x07,0x0a,0xff,0x1a,0x11,0x14,0xff,0x19,0x11,0x14,0xff,0x0d,0x07,0x0c,0xff,0x0e,0x05,0x0b,0xff,0x16,0x0e,0x11,0xff,0x1b,0x14,0x15,0xff,0x1a,0x12,0x12,0xff,0x2d,0x23,0x22,0xff,0x1e,0x15,0x14,0xff,0x59,0x53,0x53,0xff,0xfb,0xfb,0xfb,0x6d,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xca,0xc4,0xc1,0x3d,0x67,0x56,0x4d,0xff,0x6b,0x59,0x50,0xff,0x6c,0x5b,0x50,0xff,0x6d,0x5e,0x4f,0xff,0x70,0x60,0x52,0xff,0x72,0x62,0x54,0xff,0x71,0x61,0x54,0xff,0x73,0x63,0x56,0xff,0x76,0x66,0x5a,0xff,0x76,0x66,0x5a,0xff,0x77,0x67,0x59,0xff,0x79,0x69,0x5c,0xff,0x7b,0x6b,0x5c,0xff,0x7e,0x6e,0x5e,0xff,0x80,0x6f,0x60,0xff,0x82,0x71,0x62,0xff,0x86,0x74,0x64,0xff,0x89,0x75,0x66,0xff,0x8b,0x77,0x68,0xff,0x8d,0x79,0x6a,0xff,0x8f,0x7b,0x6c,0xff,0x91,0x7b,0x6c,0xff,0x93,0x7d,0x6d,0xff,0x92,0x7f,0x6d,0xff,0x93,0x81,0x6f,0xff,0x95,0x81,0x70,0xff,0x96,0x82,0x71,0xff,0x9b,0x85,0x74,0xff,0x99,0x85,0x74,0xff,0x99,0x86,0x75,0xff,0x9b,0x88,0x77,0xff,0x9e,0x8b,0x78,0xff,0x9f,0x8d,0x78,0xff,0xa0,0x8d,0x7a,0xff,0xa2,0x90,0x7b,0xff,0xa4,0x91,0x7d,0xff,0xa5,0x94,0x80,0xff,0x92,0x82,0x70,0xff,0x5c,0x49,0x43,0xff,0x3f,0x28,0x30,0xff,0x2e,0x17,0x22,0xff,0x39,0x23,0x2c,0xff,0x19,0x0d,0x15,0xff,0x11,0x07,0x0f,0xff,0x24,0x0e,0x19,0xff,0x2a,0x12,0x1d,0xff,0x2c,0x15,0x20,0xff,0x30,0x17,0x22,0xff,0x3c,0x20,0x2c,0xff,0x4d,0x2e,0x38,0xff,0x5d,0x3d,0x41,0xff,0x66,0x4a,0x4c,0xff,0x5c,0x42,0x47,0xff,0x1f,0x0b,0x14,0xff,0x30,0x2c,0x37,0xff,0x4c,0x4f,0x59,0xff,0x11,0x13,0x2d,0xff,0x4a,0x54,0x84,0xff,0x72,0x80,0xb5,0xff,0x51,0x54,0x7f,0xff,0x3b,0x37,0x54,0xff,0x37,0x33,0x51,0xff,0x50,0x4e,0x70,0xff,0x7a,0x83,0xb3,0xff,0x98,0xab,0xdd,0xff,0xaf,0xc1,0xed,0xff,0xbe,0xd2,0xfa,0xff,0xc9,0xdd,0xfd,0xff,0xd0,0xe1,0xfc,0xff,0xd8,0xe8,0xfd,0xff,0xde,0xec,0xfd,0xff,0xe1,0xee,0xfd,0xff,0xdc,0xec,0xfe,0xff,0xd8,0xe7,0xfd,0xff,0xd4,0xe2,0xfc,0xff,0xcf,0xde,0xfa,0xff,0xc7,0xd9,0xf9,0xff,0xc5,0xd7,0xf9,0xff,0xca,0xd8,0xf9,0xff,0xd4,0xdf,0xfa,0xff,0xdb,0xe8,0xfc,0xff,0xdc,0xe9,0xfd,0xff,0xd9,0xe8,0xfb,0xff,0xcd,0xe1,0xfd,0xff,0xc5,0xdb,0xfb,0xff,0xc1,0xd5,0xfa,0xff,0xb8,0xcd,0xf4,0xff,0xb7,0xcc,0xf4,0xff,0xb6,0xcb,0xf3,0xff,0xb6,0xce,0xf5,0xff,0xd1,0xe0,0xf9,0xff,0xf3,0xf3,0xfe,0xff,0xe5,0xec,0xfc,0xff,0xad,0xbd,0xe2,0xff,0x84,0x97,0xc3,0xff,0x80,0x96,0xc8,0xff,0x84,0x9f,0xd1,0xff,0x8c,0xa3,0xd6,0xff,0x8b,0xa0,0xd5,0xff,0x87,0x9c,0xd1,0xff,0x82,0x97,0xcc,0xff,0x7d,0x92,0xc8,0xff,0x7b,0x90,0xc6,0xff,0x7a,0x8e,0xc3,0xff,0x71,0x88,0xb9,0xff,0x6d,0x84,0xb5,0xff,0x68,0x7d,0xaf,0xff,0x62,0x70,0x9f,0xff,0x4c,0x52,0x72,0xff,0x1a,0x17,0x23,0xff,0x04,0x00,0x05,0xff,0x21,0x18,0x1f,0xff,0x22,0x17,0x1e,0xff,0x1c,0x10,0x19,0xff,0x12,0x08,0x10,0xff,0x17,0x0c,0x14,0xff,0x2b,0x1f,0x24,0xff,0x3c,0x2f,0x32,0xff,0x40,0x33,0x37,0xff,0x37,0x29,0x2b,0xff,0x3e,0x32,0x32,0xff,0x33,0x25,0x28,0xff,0x21,0x12,0x15,0xff,0x2a,0x1b,0x1f,0xff,0x21,0x14,0x18,0xff,0x2b,0x1e,0x23,0xff,0x1b,0x0e,0x13,0xff,0x1c,0x10,0x14,0xff,0x11,0x07,0x0b,0xff,0x19,0x0f,0x13,0xff,0x25,0x1b,0x1e,0xff,0x10,0x0a,0x0c,0xff,0x0c,0x05,0x0a,0xff,0x13,0x0a,0x10,0xff,0x1e,0x15,0x17,0xff,0x18,0x0f,0x11,0xff,0x0f,0x07,0x0a,0xff,0x10,0x08,0x0b,0xff,0x06,0x00,0x01,0xff,0x33,0x2b,0x2f,0xff,0xec,0xeb,0xeb,0x9c,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xb3,0xab,0xa6,0x62,0x63,0x52,0x47,0xff,0x6c,0x5b,0x50,0xff,0x6d,0x5d,0x50,0xff,0x6f,0x5f,0x51,0xff,0x70,0x60,0x53,0xff,0x72,0x62,0x55,0xff,0x74,0x64,0x57,0xff,0x76,0x66,0x58,0xff,0x78,0x68,0x5a,0xff,0x79,0x69,0x5c,0xff,0x7a,0x6a,0x5c,0xff,0x7b,0x6c,0x5e,0xff,0x7f,0x6e,0x60,0xff,0x81,0x6e,0x61,0xff,0x82,0x71,0x62,0xff,0x84,0x71,0x62,0xff,0x89,0x75,0x66,0xff,0x8a,0x76,0x67,0xff,0x8b,0x77,0x68,0xff,0x8f,0x7a,0x6c,0xff,0x92,0x7c,0x6e,0xff,0x92,0x7e,0x6d,0xff,0x93,0x80,0x6f,0xff,0x94,0x81,0x6f,0xff,0x95,0x81,0x72,0xff,0x95,0x81,0x72,0xff,0x98,0x84,0x75,0xff,0x99,0x85,0x74,0xff,0x99,0x86,0x74,0xff,0x9a,0x88,0x76,0xff,0x9c,0x8b,0x77,0xff,0xa0,0x8e,0x79,0xff,0xa0,0x8e,0x7a,0xff,0xa1,0x8f,0x7c,0xff,0xa1,0x8e,0x7c,0xff,0x9e,0x8c,0x7a,0xff,0x8b,0x7b,0x6b,0xff,0x5f,0x4c,0x46,0xff,0x58,0x45,0x42,0xff,0x3e,0x29,0x2e,0xff,0x2c,0x19,0x20,0xff,0x32,0x1e,0x24,0xff,0x44,0x31,0x37,0xff,0x2f,0x1f,0x26,0xff,0x25,0x13,0x1c,0xff,0x1f,0x09,0x14,0xff,0x21,0x0b,0x16,0xff,0x2b,0x13,0x1e,0xff,0x34,0x19,0x22,0xff,0x35,0x19,0x1f,0xff,0x36,0x1e,0x22,0xff,0x42,0x2a,0x2c,0xff,0x43,0x2a,0x2e,0xff,0x24,0x0f,0x19,0xff,0x22,0x17,0x1f,0xff,0x50,0x4f,0x59,0xff,0x1f,0x1b,0x23,0xff,0x09,0x05,0x10,0xff,0x0a,0x08,0x1d,0xff,0x1f,0x1e,0x36,0xff,0x4b,0x45,0x66,0xff,0x3b,0x37,0x56,0xff,0x3e,0x3b,0x58,0xff,0x66,0x6b,0x98,0xff,0x87,0x99,0xca,0xff,0x9e,0xb2,0xe2,0xff,0xb0,0xc3,0xf1,0xff,0xbd,0xd2,0xf9,0xff,0xc6,0xdb,0xfb,0xff,0xcd,0xe0,0xfe,0xff,0xd5,0xe4,0xfd,0xff,0xd6,0xe6,0xfd,0xff,0xd9,0xe8,0xfc,0xff,0xd8,0xe7,0xfc,0xff,0xd5,0xe4,0xfb,0xff,0xd5,0xe5,0xfb,0xff,0xd6,0xe5,0xfc,0xff,0xd8,0xe5,0xfc,0xff,0xdb,0xe7,0xfb,0xff,0xde,0xeb,0xfd,0xff,0xdb,0xe8,0xfc,0xff,0xd5,0xe5,0xfb,0xff,0xd1,0xe3,0xfa,0xff,0xc7,0xdd,0xfc,0xff,0xbf,0xd8,0xfb,0xff,0xb7,0xcf,0xf7,0xff,0xb3,0xca,0xf2,0xff,0xb6,0xcc,0xf4,0xff,0xb9,0xd0,0xf7,0xff,0xba,0xd1,0xf7,0xff,0xcb,0xdb,0xfa,0xff,0xf1,0xf1,0xfe,0xff,0xec,0xf1,0xff,0xff,0xb9,0xc9,0xec,0xff,0x88,0x9b,0xc5,0xff,0x7c,0x91,0xc2,0xff,0x82,0x9b,0xd1,0xff,0x8b,0xa2,0xd8,0xff,0x8f,0xa4,0xdb,0xff,0x89,0xa0,0xd2,0xff,0x86,0x9d,0xd0,0xff,0x80,0x96,0xca,0xff,0x7a,0x8f,0xc4,0xff,0x77,0x8a,0xc1,0xff,0x73,0x88,0xbb,0xff,0x6f,0x84,0xb5,0xff,0x68,0x7c,0xa7,0xff,0x57,0x66,0x8b,0xff,0x42,0x42,0x5d,0xff,0x0f,0x0b,0x14,0xff,0x1c,0x15,0x1b,0xff,0x2b,0x1e,0x27,0xff,0x1b,0x0e,0x18,0xff,0x22,0x16,0x1e,0xff,0x22,0x16,0x1c,0xff,0x2a,0x1d,0x21,0xff,0x3e,0x31,0x33,0xff,0x49,0x3e,0x3c,0xff,0x49,0x3d,0x3b,0xff,0x43,0x35,0x35,0xff,0x37,0x2a,0x29,0xff,0x28,0x1c,0x1d,0xff,0x22,0x17,0x1a,0xff,0x1a,0x0e,0x11,0xff,0x24,0x16,0x19,0xff,0x27,0x19,0x1c,0xff,0x25,0x19,0x1c,0xff,0x27,0x1c,0x1d,0xff,0x24,0x18,0x18,0xff,0x2a,0x22,0x22,0xff,0x1b,0x15,0x16,0xff,0x07,0x02,0x05,0xff,0x0f,0x07,0x0c,0xff,0x1d,0x12,0x16,0xff,0x20,0x15,0x17,0xff,0x16,0x0e,0x11,0xff,0x0b,0x05,0x08,0xff,0x0c,0x06,0x09,0xff,0x17,0x10,0x13,0xff,0x2f,0x27,0x27,0xff,0xdb,0xd9,0xd9,0xbc,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0x9e,0x93,0x8e,0x93,0x64,0x51,0x48,0xff,0x6d,0x5c,0x51,0xff,0x6e,0x5f,0x52,0xff,0x71,0x61,0x54,0xff,0x73,0x62,0x56,0xff,0x75,0x64,0x58,0xff,0x76,0x66,0x5a,0xff,0x77,0x67,0x5a,0xff,0x7a,0x69,0x5d,0xff,0x7a,0x6a,0x5e,0xff,0x7c,0x6b,0x5e,0xff,0x7f,0x6d,0x60,0xff,0x82,0x70,0x62,0xff,0x83,0x70,0x63,0xff,0x85,0x72,0x63,0xff,0x88,0x74,0x65,0xff,0x8b,0x76,0x67,0xff,0x8b,0x77,0x69,0xff,0x8c,0x78,0x6a,0xff,0x90,0x7b,0x6c,0xff,0x92,0x7d,0x6e,0xff,0x94,0x7f,0x6f,0xff,0x94,0x80,0x6f,0xff,0x94,0x81,0x70,0xff,0x94,0x81,0x71,0xff,0x98,0x84,0x74,0xff,0x9a,0x86,0x76,0xff,0x9c,0x88,0x77,0xff,0x9e,0x89,0x77,0xff,0x9e,0x8b,0x78,0xff,0x9f,0x8d,0x77,0xff,0xa1,0x8f,0x7a,0xff,0xa2,0x90,0x7c,0xff,0xa3,0x90,0x7c,0xff,0xa3,0x8f,0x7c,0xff,0x98,0x87,0x75,0xff,0x89,0x7a,0x68,0xff,0x8b,0x7a,0x69,0xff,0x85,0x73,0x63,0xff,0x76,0x64,0x5c,0xff,0x4d,0x3b,0x3b,0xff,0x32,0x1f,0x24,0xff,0x3c,0x27,0x2c,0xff,0x45,0x2f,0x34,0xff,0x56,0x3b,0x45,0xff,0x3f,0x26,0x30,0xff,0x3a,0x29,0x2d,0xff,0x34,0x20,0x26,0xff,0x38,0x22,0x27,0xff,0x40,0x2b,0x30,0xff,0x48,0x34,0x39,0xff,0x35,0x21,0x28,0xff,0x36,0x21,0x2b,0xff,0x3e,0x27,0x33,0xff,0x33,0x1c,0x27,0xff,0x45,0x39,0x44,0xff,0x37,0x2f,0x39,0xff,0x11,0x0b,0x14,0xff,0x07,0x03,0x09,0xff,0x08,0x04,0x0e,0xff,0x47,0x3f,0x5e,0xff,0x48,0x41,0x66,0xff,0x3a,0x34,0x52,0xff,0x50,0x50,0x78,0xff,0x72,0x7f,0xae,0xff,0x89,0x9b,0xcd,0xff,0xa1,0xb3,0xe6,0xff,0xb1,0xc4,0xf3,0xff,0xbd,0xd1,0xf9,0xff,0xc6,0xd8,0xfc,0xff,0xcd,0xdc,0xfc,0xff,0xcd,0xdd,0xfc,0xff,0xd2,0xe0,0xfd,0xff,0xd3,0xe2,0xfc,0xff,0xd4,0xe4,0xfc,0xff,0xd6,0xe5,0xfc,0xff,0xd9,0xe6,0xfd,0xff,0xdc,0xe8,0xfb,0xff,0xe0,0xea,0xfd,0xff,0xdc,0xe9,0xfc,0xff,0xda,0xe8,0xfc,0xff,0xd2,0xe3,0xfb,0xff,0xc8,0xdd,0xfb,0xff,0xbc,0xd5,0xfb,0xff,0xb5,0xcd,0xf9,0xff,0xb1,0xc9,0xf5,0xff,0xaf,0xc7,0xf2,0xff,0xb1,0xc8,0xf3,0xff,0xb5,0xcd,0xf7,0xff,0xbd,0xd4,0xf6,0xff,0xcd,0xdd,0xf7,0xff,0xee,0xf1,0xfc,0xff,0xee,0xf3,0xff,0xff,0xc3,0xd3,0xf5,0xff,0x8b,0x9f,0xc6,0xff,0x76,0x89,0xba,0xff,0x84,0x9b,0xd2,0xff,0x8b,0xa2,0xd8,0xff,0x91,0xa6,0xdb,0xff,0x8b,0xa2,0xd5,0xff,0x86,0x9e,0xd2,0xff,0x81,0x98,0xcb,0xff,0x7b,0x90,0xc5,0xff,0x79,0x8c,0xc2,0xff,0x77,0x8b,0xbf,0xff,0x6f,0x84,0xb6,0xff,0x60,0x72,0x9c,0xff,0x4e,0x57,0x77,0xff,0x34,0x30,0x47,0xff,0x0f,0x09,0x12,0xff,0x19,0x11,0x18,0xff,0x1a,0x0e,0x17,0xff,0x25,0x19,0x22,0xff,0x2b,0x1e,0x25,0xff,0x36,0x28,0x2d,0xff,0x49,0x3a,0x3c,0xff,0x4d,0x3f,0x3f,0xff,0x59,0x4d,0x4a,0xff,0x4b,0x3d,0x3d,0xff,0x3c,0x2e,0x2f,0xff,0x30,0x24,0x23,0xff,0x28,0x1c,0x1e,0xff,0x19,0x0f,0x14,0xff,0x14,0x08,0x0c,0xff,0x33,0x23,0x25,0xff,0x26,0x17,0x1a,0xff,0x21,0x15,0x17,0xff,0x34,0x28,0x2a,0xff,0x33,0x26,0x24,0xff,0x28,0x1d,0x1d,0xff,0x0b,0x04,0x09,0xff,0x08,0x01,0x06,0xff,0x15,0x0d,0x0f,0xff,0x22,0x17,0x19,0xff,0x20,0x15,0x16,0xff,0x16,0x0f,0x10,0xff,0x07,0x01,0x03,0xff,0x18,0x11,0x13,0xff,0x2a,0x20,0x20,0xff,0x34,0x28,0x24,0xff,0xbd,0xba,0xb8,0xe6,0xff,0xff,0xff,0x0c,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfc,0xfb,0xfb,0x00,0x90,0x84,0x7a,0xa6,0x67,0x56,0x4a,0xff,0x6e,0x5d,0x52,0xff,0x70,0x60,0x53,0xff,0x74,0x63,0x56,0xff,0x76,0x65,0x5b,0xff,0x77,0x66,0x5b,0xff,0x7a,0x69,0x5e,0xff,0x7a,0x69,0x5f,0xff,0x7b,0x6a,0x60,0xff,0x7c,0x6b,0x61,0xff,0x7d,0x6c,0x61,0xff,0x81,0x6f,0x62,0xff,0x84,0x71,0x64,0xff,0x85,0x72,0x65,0xff,0x87,0x73,0x64,0xff,0x8a,0x75,0x66,0xff,0x8a,0x76,0x68,0xff,0x8b,0x76,0x6a,0xff,0x8f,0x79,0x6b,0xff,0x91,0x7c,0x6d,0xff,0x92,0x7e,0x6f,0xff,0x94,0x7e,0x70,0xff,0x96,0x81,0x71,0xff,0x95,0x82,0x70,0xff,0x98,0x84,0x73,0xff,0x99,0x86,0x75,0xff,0x9b,0x87,0x76,0xff,0x9d,0x88,0x77,0xff,0xa2,0x8a,0x78,0xff,0xa3,0x8e,0x7a,0xff,0xa1,0x8e,0x7b,0xff,0xa0,0x8e,0x7b,0xff,0xa4,0x91,0x7e,0xff,0xa5,0x93,0x7f,0xff,0xa5,0x92,0x7f,0xff,0xa3,0x92,0x7e,0xff,0xa7,0x97,0x82,0xff,0xaa,0x98,0x84,0xff,0xa3,0x90,0x7e,0xff,0x8d,0x7b,0x6d,0xff,0x64,0x53,0x48,0xff,0x8b,0x79,0x6e,0xff,0x6f,0x5c,0x56,0xff,0x36,0x22,0x29,0xff,0x2b,0x16,0x22,0xff,0x40,0x2b,0x33,0xff,0x5a,0x46,0x44,0xff,0x5e,0x45,0x47,0xff,0x59,0x3e,0x44,0xff,0x4c,0x33,0x39,0xff,0x53,0x3b,0x41,0xff,0x49,0x32,0x38,0xff,0x38,0x22,0x2a,0xff,0x33,0x20,0x27,0xff,0x2e,0x18,0x23,0xff,0x31,0x22,0x2e,0xff,0x39,0x31,0x3d,0xff,0x17,0x10,0x1b,0xff,0x14,0x0c,0x14,0xff,0x08,0x03,0x0d,0xff,0x39,0x34,0x4a,0xff,0x55,0x4e,0x6e,0xff,0x40,0x39,0x58,0xff,0x3d,0x36,0x55,0xff,0x58,0x5b,0x84,0xff,0x76,0x86,0xb8,0xff,0x90,0xa2,0xd7,0xff,0xa1,0xb4,0xe7,0xff,0xb1,0xc4,0xf1,0xff,0xbb,0xcc,0xf8,0xff,0xc5,0xd3,0xfa,0xff,0xc8,0xda,0xfb,0xff,0xcb,0xdd,0xfc,0xff,0xd0,0xdf,0xfc,0xff,0xd5,0xe3,0xfd,0xff,0xd8,0xe7,0xfc,0xff,0xdc,0xe7,0xfd,0xff,0xde,0xe9,0xfc,0xff,0xdc,0xe7,0xfb,0xff,0xd9,0xe4,0xfb,0xff,0xd5,0xe2,0xfb,0xff,0xcb,0xdd,0xfc,0xff,0xc4,0xd7,0xfc,0xff,0xb7,0xcf,0xfc,0xff,0xac,0xc5,0xf5,0xff,0xaa,0xc2,0xf1,0xff,0xa4,0xbc,0xeb,0xff,0xa5,0xbe,0xeb,0xff,0xb0,0xca,0xf3,0xff,0xbe,0xd4,0xf8,0xff,0xd2,0xe0,0xfa,0xff,0xed,0xf3,0xfc,0xff,0xf4,0xf9,0xfe,0xff,0xd1,0xe1,0xfc,0xff,0x90,0xa2,0xcb,0xff,0x65,0x77,0xa6,0xff,0x84,0x9c,0xd2,0xff,0x90,0xa7,0xdb,0xff,0x95,0xab,0xdd,0xff,0x8e,0xa5,0xd9,0xff,0x85,0x9c,0xd2,0xff,0x82,0x97,0xcc,0xff,0x7f,0x94,0xc7,0xff,0x7e,0x93,0xc7,0xff,0x79,0x8c,0xc0,0xff,0x6e,0x7c,0xaf,0xff,0x58,0x5f,0x89,0xff,0x44,0x3f,0x5e,0xff,0x25,0x1c,0x31,0xff,0x14,0x0a,0x15,0xff,0x14,0x0b,0x13,0xff,0x1d,0x14,0x1b,0xff,0x30,0x24,0x2a,0xff,0x2f,0x21,0x27,0xff,0x3c,0x30,0x33,0xff,0x42,0x35,0x35,0xff,0x4f,0x42,0x40,0xff,0x59,0x4c,0x49,0xff,0x4a,0x3d,0x3c,0xff,0x30,0x23,0x22,0xff,0x36,0x27,0x2a,0xff,0x1e,0x11,0x16,0xff,0x0f,0x07,0x0d,0xff,0x15,0x09,0x0f,0xff,0x2c,0x1e,0x20,0xff,0x26,0x17,0x1a,0xff,0x19,0x0d,0x11,0xff,0x24,0x18,0x1c,0xff,0x35,0x26,0x25,0xff,0x2b,0x1e,0x1f,0xff,0x0f,0x05,0x0d,0xff,0x14,0x0c,0x11,0xff,0x11,0x09,0x0a,0xff,0x1a,0x10,0x12,0xff,0x21,0x18,0x1a,0xff,0x16,0x0d,0x0e,0xff,0x1a,0x11,0x12,0xff,0x25,0x1d,0x1e,0xff,0x19,0x10,0x10,0xff,0x19,0x10,0x0f,0xff,0x9f,0x9b,0x9b,0xf1,0xff,0xff,0xff,0x1b,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xf5,0xf4,0xf3,0x00,0x80,0x72,0x67,0xc6,0x6a,0x59,0x4e,0xff,0x6f,0x5e,0x54,0xff,0x72,0x61,0x56,0xff,0x74,0x64,0x58,0xff,0x77,0x66,0x5b,0xff,0x79,0x68,0x5c,0xff,0x7b,0x6b,0x5e,0xff,0x7c,0x6b,0x61,0xff,0x7c,0x6d,0x5f,0xff,0x7d,0x6d,0x60,0xff,0x80,0x6e,0x64,0xff,0x81,0x70,0x63,0xff,0x82,0x72,0x65,0xff,0x85,0x72,0x65,0xff,0x86,0x74,0x65,0xff,0x8c,0x77,0x68,0xff,0x8e,0x78,0x69,0xff,0x8d,0x79,0x6a,0xff,0x90,0x7a,0x6b,0xff,0x92,0x7c,0x6d,0xff,0x95,0x7e,0x70,0xff,0x97,0x80,0x71,0xff,0x96,0x81,0x71,0xff,0x97,0x83,0x72,0xff,0x99,0x85,0x74,0xff,0x9a,0x87,0x75,0xff,0x9e,0x8b,0x79,0xff,0x9e,0x8b,0x79,0xff,0x9f,0x8a,0x78,0xff,0xa2,0x8e,0x7c,0xff,0xa1,0x8f,0x7b,0xff,0xa2,0x90,0x7c,0xff,0xa5,0x92,0x7f,0xff,0xa5,0x94,0x7f,0xff,0xa3,0x94,0x7e,0xff,0xa5,0x95,0x81,0xff,0xa7,0x96,0x82,0xff,0xa8,0x94,0x81,0xff,0xaa,0x96,0x86,0xff,0x86,0x75,0x64,0xff,0x97,0x87,0x73,0xff,0xa4,0x93,0x7f,0xff,0xa8,0x96,0x85,0xff,0x7f,0x6e,0x63,0xff,0x3b,0x28,0x2c,0xff,0x2b,0x19,0x22,0xff,0x26,0x12,0x1e,0xff,0x3c,0x25,0x2e,0xff,0x3b,0x24,0x2c,0xff,0x35,0x20,0x26,0xff,0x2a,0x15,0x1a,0xff,0x3a,0x24,0x2a,0xff,0x44,0x2e,0x34,0xff,0x2c,0x17,0x1e,0xff,0x24,0x11,0x19,0xff,0x34,0x24,0x2c,0xff,0x59,0x4c,0x52,0xff,0x29,0x1e,0x25,0xff,0x25,0x19,0x20,0xff,0x23,0x1b,0x20,0xff,0x3f,0x36,0x40,0xff,0x5a,0x53,0x70,0xff,0x47,0x43,0x62,0xff,0x3a,0x32,0x52,0xff,0x48,0x42,0x64,0xff,0x63,0x69,0x94,0xff,0x79,0x88,0xb8,0xff,0x91,0x9f,0xd5,0xff,0xa0,0xb1,0xe7,0xff,0xac,0xbf,0xf2,0xff,0xb8,0xc8,0xf7,0xff,0xc4,0xd2,0xfb,0xff,0xc6,0xd8,0xfc,0xff,0xca,0xdc,0xfc,0xff,0xd2,0xe0,0xfc,0xff,0xd6,0xe4,0xfc,0xff,0xd8,0xe4,0xfd,0xff,0xd8,0xe3,0xfb,0xff,0xd7,0xe3,0xfa,0xff,0xd5,0xe2,0xfa,0xff,0xcd,0xdc,0xfc,0xff,0xc0,0xd5,0xfa,0xff,0xb7,0xce,0xfb,0xff,0xac,0xc3,0xf6,0xff,0xa4,0xbb,0xed,0xff,0xab,0xc0,0xee,0xff,0xab,0xc2,0xed,0xff,0xa1,0xb8,0xe4,0xff,0xb8,0xcf,0xf6,0xff,0xc5,0xd9,0xfa,0xff,0xd2,0xe1,0xfc,0xff,0xef,0xf2,0xfc,0xff,0xf3,0xf8,0xfe,0xff,0xdf,0xea,0xfe,0xff,0xb3,0xc1,0xe7,0xff,0x6c,0x7d,0xaa,0xff,0x80,0x99,0xcc,0xff,0x8d,0xa5,0xda,0xff,0x93,0xa8,0xdc,0xff,0x91,0xa7,0xdb,0xff,0x8c,0xa3,0xd8,0xff,0x89,0x9e,0xd2,0xff,0x85,0x9b,0xce,0xff,0x81,0x97,0xca,0xff,0x73,0x85,0xb5,0xff,0x64,0x6c,0x98,0xff,0x4b,0x4a,0x72,0xff,0x33,0x2c,0x42,0xff,0x16,0x0e,0x15,0xff,0x14,0x0a,0x12,0xff,0x1d,0x11,0x1a,0xff,0x25,0x19,0x21,0xff,0x33,0x27,0x2e,0xff,0x2f,0x22,0x27,0xff,0x34,0x27,0x2c,0xff,0x35,0x27,0x2b,0xff,0x56,0x48,0x48,0xff,0x5d,0x51,0x4c,0xff,0x61,0x54,0x4f,0xff,0x3d,0x31,0x2f,0xff,0x21,0x16,0x19,0xff,0x13,0x08,0x0c,0xff,0x12,0x09,0x0e,0xff,0x0c,0x05,0x0b,0xff,0x1a,0x0f,0x13,0xff,0x23,0x15,0x19,0xff,0x11,0x07,0x0f,0xff,0x19,0x0e,0x12,0xff,0x26,0x1a,0x1c,0xff,0x26,0x1b,0x1d,0xff,0x1b,0x11,0x16,0xff,0x19,0x10,0x15,0xff,0x13,0x0b,0x0f,0xff,0x23,0x19,0x1d,0xff,0x1f,0x16,0x17,0xff,0x1e,0x15,0x16,0xff,0x22,0x18,0x1b,0xff,0x1a,0x13,0x13,0xff,0x15,0x0f,0x0f,0xff,0x11,0x08,0x09,0xff,0x85,0x80,0x80,0xff,0xff,0xff,0xff,0x39,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xec,0xea,0xe9,0x0c,0x76,0x65,0x5c,0xe7,0x6c,0x5a,0x50,0xff,0x71,0x60,0x55,0xff,0x70,0x60,0x55,0xff,0x73,0x62,0x57,0xff,0x77,0x64,0x5a,0xff,0x78,0x67,0x5c,0xff,0x7a,0x69,0x5d,0xff,0x7b,0x6b,0x60,0xff,0x7d,0x6d,0x61,0xff,0x7e,0x6d,0x62,0xff,0x81,0x71,0x63,0xff,0x82,0x73,0x64,0xff,0x85,0x74,0x66,0xff,0x87,0x74,0x67,0xff,0x89,0x76,0x68,0xff,0x8a,0x76,0x68,0xff,0x8e,0x79,0x6a,0xff,0x90,0x7b,0x6c,0xff,0x92,0x7b,0x6d,0xff,0x92,0x7c,0x6d,0xff,0x96,0x80,0x6f,0xff,0x96,0x81,0x72,0xff,0x97,0x82,0x73,0xff,0x99,0x85,0x74,0xff,0x9b,0x87,0x76,0xff,0x9c,0x89,0x78,0xff,0x9e,0x8b,0x7a,0xff,0x9f,0x8c,0x7a,0xff,0xa0,0x8e,0x7e,0xff,0xa1,0x8f,0x80,0xff,0xa3,0x90,0x7e,0xff,0xa4,0x91,0x7f,0xff,0xa5,0x92,0x81,0xff,0xa5,0x93,0x81,0xff,0xa6,0x95,0x81,0xff,0xa8,0x96,0x83,0xff,0xa8,0x97,0x80,0xff,0xab,0x98,0x83,0xff,0xa9,0x97,0x82,0xff,0xa0,0x90,0x79,0xff,0xaa,0x99,0x83,0xff,0xac,0x99,0x88,0xff,0xb1,0x9e,0x8c,0xff,0xa9,0x98,0x84,0xff,0x95,0x84,0x76,0xff,0x7a,0x69,0x5f,0xff,0x67,0x54,0x4f,0xff,0x4c,0x36,0x37,0xff,0x47,0x31,0x35,0xff,0x48,0x33,0x37,0xff,0x61,0x4c,0x4d,0xff,0x4b,0x35,0x35,0xff,0x6b,0x57,0x50,0xff,0x8b,0x79,0x6c,0xff,0x5c,0x4d,0x40,0xff,0x5b,0x4a,0x44,0xff,0x93,0x83,0x75,0xff,0x8a,0x74,0x6d,0xff,0x2b,0x20,0x23,0xff,0x3c,0x2a,0x31,0xff,0x4e,0x3d,0x44,0xff,0x5b,0x55,0x71,0xff,0x51,0x4d,0x6d,0xff,0x3e,0x36,0x57,0xff,0x3d,0x33,0x54,0xff,0x4e,0x4b,0x6f,0xff,0x62,0x67,0x97,0xff,0x76,0x85,0xb7,0xff,0x8a,0x9d,0xd4,0xff,0x9d,0xb0,0xe6,0xff,0xa9,0xbc,0xf0,0xff,0xb2,0xc4,0xf6,0xff,0xbb,0xcc,0xfb,0xff,0xbf,0xd2,0xfb,0xff,0xc9,0xdb,0xfc,0xff,0xd0,0xdf,0xfe,0xff,0xd2,0xdf,0xfc,0xff,0xce,0xdc,0xf9,0xff,0xcd,0xda,0xfc,0xff,0xcc,0xdd,0xfb,0xff,0xc3,0xd7,0xfa,0xff,0xbb,0xd1,0xfa,0xff,0xb4,0xcd,0xf9,0xff,0xa8,0xbe,0xf1,0xff,0x9f,0xb5,0xe7,0xff,0xbf,0xd2,0xf4,0xff,0xd1,0xe0,0xfd,0xff,0xb9,0xcb,0xf2,0xff,0xba,0xce,0xf5,0xff,0xc9,0xdb,0xfc,0xff,0xd3,0xe1,0xfc,0xff,0xee,0xf1,0xfe,0xff,0xf6,0xf8,0xfe,0xff,0xe3,0xeb,0xff,0xff,0xc4,0xd1,0xf7,0xff,0x9a,0xac,0xd6,0xff,0x7e,0x98,0xca,0xff,0x8c,0xa3,0xd8,0xff,0x91,0xa7,0xda,0xff,0x91,0xa6,0xdb,0xff,0x91,0xa7,0xdd,0xff,0x8f,0xa4,0xd7,0xff,0x8a,0x9d,0xd1,0xff,0x7c,0x90,0xc4,0xff,0x66,0x76,0xa7,0xff,0x51,0x59,0x7f,0xff,0x39,0x38,0x53,0xff,0x21,0x1a,0x29,0xff,0x13,0x0b,0x11,0xff,0x16,0x0b,0x15,0xff,0x1f,0x12,0x1c,0xff,0x24,0x18,0x20,0xff,0x30,0x23,0x28,0xff,0x32,0x23,0x27,0xff,0x26,0x19,0x1d,0xff,0x2d,0x1f,0x24,0xff,0x32,0x24,0x27,0xff,0x45,0x39,0x38,0xff,0x4b,0x3f,0x3e,0xff,0x38,0x2d,0x2e,0xff,0x13,0x0a,0x0e,0xff,0x11,0x07,0x0d,0xff,0x0f,0x06,0x0c,0xff,0x0a,0x05,0x0a,0xff,0x13,0x0a,0x10,0xff,0x23,0x16,0x1c,0xff,0x15,0x0c,0x13,0xff,0x12,0x08,0x0f,0xff,0x19,0x0c,0x12,0xff,0x21,0x15,0x19,0xff,0x24,0x19,0x1c,0xff,0x16,0x0d,0x11,0xff,0x1c,0x12,0x15,0xff,0x24,0x18,0x1a,0xff,0x23,0x1a,0x19,0xff,0x20,0x17,0x18,0xff,0x16,0x0c,0x0f,0xff,0x15,0x0d,0x0f,0xff,0x14,0x0c,0x0e,0xff,0x09,0x00,0x04,0xff,0x64,0x5f,0x62,0xff,0xff,0xff,0xff,0x58,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xe4,0xe1,0xdf,0x13,0x72,0x61,0x58,0xed,0x6c,0x5a,0x51,0xff,0x70,0x5f,0x54,0xff,0x70,0x60,0x55,0xff,0x73,0x62,0x58,0xff,0x77,0x64,0x5a,0xff,0x79,0x68,0x5d,0xff,0x79,0x69,0x5e,0xff,0x7b,0x6b,0x5f,0xff,0x7d,0x6c,0x62,0xff,0x80,0x6f,0x64,0xff,0x82,0x73,0x63,0xff,0x83,0x74,0x63,0xff,0x86,0x75,0x67,0xff,0x8a,0x77,0x6b,0xff,0x8c,0x77,0x6b,0xff,0x8b,0x78,0x69,0xff,0x8e,0x79,0x6a,0xff,0x92,0x7a,0x6b,0xff,0x93,0x7c,0x6d,0xff,0x94,0x7e,0x6f,0xff,0x96,0x80,0x6f,0xff,0x95,0x81,0x72,0xff,0x99,0x84,0x75,0xff,0x9a,0x85,0x74,0xff,0x9c,0x88,0x76,0xff,0x9e,0x8a,0x79,0xff,0x9e,0x8b,0x7a,0xff,0xa0,0x8d,0x7c,0xff,0xa3,0x90,0x7d,0xff,0xa2,0x8f,0x7c,0xff,0xa3,0x90,0x7f,0xff,0xa4,0x92,0x80,0xff,0xa7,0x94,0x82,0xff,0xa7,0x94,0x83,0xff,0xa8,0x95,0x82,0xff,0xa8,0x96,0x81,0xff,0xaa,0x99,0x81,0xff,0xaa,0x97,0x83,0xff,0xac,0x9a,0x85,0xff,0xad,0x9c,0x84,0xff,0xaf,0x9d,0x87,0xff,0xb0,0x9c,0x8c,0xff,0xb1,0x9d,0x8c,0xff,0xb2,0x9e,0x8d,0xff,0xb6,0xa3,0x90,0xff,0xb3,0xa0,0x8d,0xff,0xb4,0xa0,0x8f,0xff,0xa7,0x93,0x84,0xff,0x74,0x5f,0x55,0xff,0x42,0x2b,0x2c,0xff,0x7e,0x69,0x65,0xff,0x9c,0x88,0x7e,0xff,0x75,0x63,0x51,0xff,0xaa,0x98,0x83,0xff,0xa3,0x92,0x7c,0xff,0x83,0x6e,0x61,0xff,0x87,0x74,0x62,0xff,0xbf,0xa9,0x96,0xff,0x85,0x73,0x6b,0xff,0x3e,0x2c,0x2d,0xff,0x6a,0x59,0x54,0xff,0x5c,0x58,0x6c,0xff,0x55,0x52,0x73,0xff,0x4c,0x44,0x67,0xff,0x38,0x31,0x51,0xff,0x40,0x39,0x5c,0xff,0x50,0x4c,0x76,0xff,0x63,0x6b,0x91,0xff,0x76,0x80,0xb0,0xff,0x87,0x97,0xcd,0xff,0x97,0xaa,0xe0,0xff,0xa5,0xb9,0xed,0xff,0xb2,0xc3,0xf6,0xff,0xbc,0xce,0xfc,0xff,0xc4,0xd7,0xfb,0xff,0xca,0xdb,0xfb,0xff,0xcc,0xda,0xfd,0xff,0xc8,0xd6,0xfc,0xff,0xc7,0xd6,0xfc,0xff,0xc5,0xd5,0xfc,0xff,0xbd,0xd2,0xfb,0xff,0xbb,0xd0,0xfb,0xff,0xb5,0xcc,0xfa,0xff,0xa9,0xbe,0xf0,0xff,0xa2,0xb6,0xe7,0xff,0xc6,0xdc,0xf9,0xff,0xd3,0xe1,0xfb,0xff,0xc1,0xd3,0xf7,0xff,0xbe,0xd1,0xf6,0xff,0xc9,0xda,0xfa,0xff,0xd2,0xe0,0xfb,0xff,0xeb,0xef,0xfd,0xff,0xfd,0xfc,0xff,0xff,0xea,0xf0,0xff,0xff,0xc0,0xcf,0xf3,0xff,0xa8,0xbb,0xe3,0xff,0x92,0xab,0xdc,0xff,0x8c,0xa3,0xd9,0xff,0x91,0xa6,0xda,0xff,0x91,0xa7,0xda,0xff,0x93,0xa8,0xdd,0xff,0x8f,0xa5,0xd8,0xff,0x84,0x98,0xca,0xff,0x72,0x82,0xb4,0xff,0x5e,0x65,0x90,0xff,0x45,0x43,0x67,0xff,0x31,0x28,0x3f,0xff,0x16,0x0c,0x1b,0xff,0x13,0x0c,0x14,0xff,0x1c,0x11,0x1c,0xff,0x24,0x18,0x22,0xff,0x1e,0x12,0x18,0xff,0x35,0x28,0x2a,0xff,0x3a,0x2c,0x2d,0xff,0x37,0x2b,0x2c,0xff,0x30,0x23,0x27,0xff,0x29,0x1c,0x20,0xff,0x22,0x16,0x19,0xff,0x36,0x2a,0x2c,0xff,0x26,0x1b,0x1e,0xff,0x0d,0x04,0x09,0xff,0x0e,0x05,0x0b,0xff,0x0e,0x07,0x0d,0xff,0x0b,0x05,0x0b,0xff,0x0f,0x09,0x0f,0xff,0x1b,0x0f,0x16,0xff,0x0d,0x05,0x0b,0xff,0x0e,0x07,0x0d,0xff,0x15,0x0a,0x11,0xff,0x16,0x0a,0x10,0xff,0x1f,0x13,0x18,0xff,0x1f,0x15,0x19,0xff,0x1a,0x11,0x13,0xff,0x2b,0x1e,0x20,0xff,0x37,0x2c,0x2d,0xff,0x18,0x11,0x13,0xff,0x11,0x0a,0x0c,0xff,0x11,0x0a,0x0d,0xff,0x14,0x0c,0x11,0xff,0x07,0x01,0x06,0xff,0x4e,0x49,0x4d,0xff,0xf9,0xf9,0xf9,0x63,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xdd,0xd9,0xd8,0x21,0x6e,0x5d,0x52,0xf3,0x6d,0x5c,0x51,0xff,0x6f,0x5f,0x54,0xff,0x72,0x61,0x56,0xff,0x74,0x64,0x58,0xff,0x76,0x66,0x58,0xff,0x78,0x67,0x5c,0xff,0x79,0x69,0x5d,0xff,0x7c,0x6c,0x5f,0xff,0x7f,0x6f,0x61,0xff,0x80,0x70,0x63,0xff,0x83,0x73,0x65,0xff,0x85,0x74,0x67,0xff,0x89,0x75,0x69,0xff,0x8b,0x77,0x6a,0xff,0x8c,0x77,0x69,0xff,0x8e,0x79,0x6b,0xff,0x8f,0x7b,0x6c,0xff,0x90,0x7c,0x6d,0xff,0x92,0x7d,0x6c,0xff,0x95,0x7f,0x6f,0xff,0x98,0x81,0x72,0xff,0x98,0x82,0x72,0xff,0x9a,0x85,0x74,0xff,0x99,0x86,0x75,0xff,0x9f,0x88,0x78,0xff,0x9f,0x8a,0x7b,0xff,0xa0,0x8d,0x7b,0xff,0xa0,0x8d,0x7b,0xff,0xa1,0x8f,0x7c,0xff,0xa3,0x91,0x7c,0xff,0xa6,0x93,0x82,0xff,0xa6,0x93,0x80,0xff,0xa7,0x95,0x81,0xff,0xa7,0x94,0x80,0xff,0xa9,0x97,0x83,0xff,0xaa,0x98,0x84,0xff,0xaa,0x98,0x85,0xff,0xab,0x97,0x86,0xff,0xac,0x9a,0x84,0xff,0xae,0x9d,0x86,0xff,0xb0,0xa0,0x88,0xff,0xb1,0x9f,0x89,0xff,0xb2,0x9e,0x89,0xff,0xb4,0x9f,0x8c,0xff,0xb6,0xa1,0x8d,0xff,0xb8,0xa4,0x8f,0xff,0xb9,0xa5,0x8f,0xff,0xbe,0xaa,0x92,0xff,0xbd,0xaa,0x93,0xff,0x83,0x6d,0x66,0xff,0x7b,0x67,0x5e,0xff,0xb8,0xa6,0x91,0xff,0xb2,0x9f,0x8b,0xff,0xc1,0xad,0x98,0xff,0xb8,0xa6,0x90,0xff,0xa8,0x94,0x81,0xff,0x8f,0x79,0x6d,0xff,0x8b,0x77,0x6c,0xff,0x7f,0x6e,0x67,0xff,0x3d,0x2a,0x35,0xff,0x38,0x25,0x2b,0xff,0x53,0x48,0x5a,0xff,0x5a,0x57,0x7a,0xff,0x55,0x51,0x77,0xff,0x38,0x35,0x57,0xff,0x31,0x2c,0x4b,0xff,0x40,0x38,0x5c,0xff,0x55,0x50,0x77,0xff,0x61,0x65,0x91,0xff,0x70,0x7c,0xad,0xff,0x81,0x92,0xc5,0xff,0x96,0xa9,0xdd,0xff,0xa4,0xb8,0xeb,0xff,0xae,0xc1,0xf3,0xff,0xb9,0xcb,0xfa,0xff,0xc2,0xd3,0xfa,0xff,0xc5,0xd2,0xfc,0xff,0xc4,0xd1,0xfc,0xff,0xc3,0xd3,0xfa,0xff,0xbe,0xd0,0xfb,0xff,0xb5,0xcd,0xfa,0xff,0xb5,0xcd,0xfb,0xff,0xb6,0xd0,0xfc,0xff,0xae,0xc6,0xf1,0xff,0x97,0xab,0xdd,0xff,0xc4,0xd6,0xfe,0xff,0xcf,0xdd,0xfb,0xff,0xc2,0xd4,0xf6,0xff,0xc0,0xd2,0xf7,0xff,0xc6,0xd9,0xfd,0xff,0xd0,0xde,0xfd,0xff,0xe5,0xed,0xfd,0xff,0xf8,0xfb,0xfd,0xff,0xec,0xf2,0xff,0xff,0xc3,0xd6,0xf7,0xff,0x9c,0xad,0xd4,0xff,0x9a,0xab,0xd7,0xff,0x8f,0xa8,0xdd,0xff,0x8e,0xa3,0xd9,0xff,0x90,0xa5,0xda,0xff,0x90,0xa6,0xd8,0xff,0x89,0x9e,0xd2,0xff,0x7a,0x8d,0xbb,0xff,0x6a,0x74,0x9d,0xff,0x53,0x54,0x75,0xff,0x3b,0x34,0x4d,0xff,0x26,0x1b,0x2b,0xff,0x11,0x07,0x11,0xff,0x1c,0x11,0x1c,0xff,0x23,0x18,0x20,0xff,0x34,0x27,0x2d,0xff,0x39,0x2c,0x2e,0xff,0x3b,0x2f,0x2f,0xff,0x43,0x38,0x37,0xff,0x52,0x46,0x46,0xff,0x4c,0x41,0x41,0xff,0x3a,0x2e,0x30,0xff,0x26,0x19,0x1c,0xff,0x2b,0x1e,0x21,0xff,0x1a,0x0f,0x13,0xff,0x10,0x08,0x0c,0xff,0x0d,0x06,0x0c,0xff,0x0f,0x09,0x0f,0xff,0x0c,0x06,0x0c,0xff,0x0c,0x05,0x0b,0xff,0x0c,0x05,0x0b,0xff,0x0c,0x05,0x0a,0xff,0x09,0x04,0x09,0xff,0x0c,0x05,0x0b,0xff,0x13,0x0b,0x11,0xff,0x16,0x0d,0x11,0xff,0x21,0x19,0x1c,0xff,0x22,0x1a,0x1d,0xff,0x18,0x0d,0x11,0xff,0x15,0x0a,0x10,0xff,0x14,0x0b,0x11,0xff,0x1e,0x18,0x1b,0xff,0x13,0x0f,0x11,0xff,0x13,0x0e,0x11,0xff,0x05,0x00,0x03,0xff,0x40,0x3a,0x3e,0xff,0xf2,0xf1,0xf2,0x73,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xd8,0xd3,0xd1,0x31,0x6b,0x5b,0x50,0xfb,0x6e,0x5e,0x52,0xff,0x71,0x60,0x55,0xff,0x72,0x62,0x57,0xff,0x75,0x64,0x59,0xff,0x78,0x65,0x5a,0xff,0x78,0x67,0x5c,0xff,0x7a,0x6a,0x5e,0xff,0x7b,0x6c,0x5e,0xff,0x7f,0x6f,0x62,0xff,0x81,0x71,0x64,0xff,0x82,0x73,0x66,0xff,0x88,0x75,0x67,0xff,0x8a,0x76,0x68,0xff,0x8c,0x78,0x69,0xff,0x8d,0x79,0x6a,0xff,0x8d,0x79,0x6a,0xff,0x90,0x7d,0x6e,0xff,0x8f,0x7d,0x6f,0xff,0x94,0x7f,0x71,0xff,0x94,0x7e,0x71,0xff,0x97,0x80,0x72,0xff,0x9b,0x83,0x73,0xff,0x98,0x85,0x73,0xff,0x9a,0x88,0x75,0xff,0x9c,0x88,0x77,0xff,0x9e,0x8a,0x79,0xff,0xa0,0x8e,0x7b,0xff,0xa2,0x8c,0x7b,0xff,0xa5,0x8d,0x7c,0xff,0xa3,0x91,0x7f,0xff,0xa6,0x92,0x81,0xff,0xa7,0x95,0x81,0xff,0xa7,0x96,0x81,0xff,0xa8,0x96,0x82,0xff,0xa9,0x96,0x83,0xff,0xab,0x99,0x85,0xff,0xac,0x99,0x86,0xff,0xac,0x9a,0x85,0xff,0xad,0x9b,0x85,0xff,0xb1,0x9c,0x88,0xff,0xb1,0x9e,0x87,0xff,0xb2,0x9e,0x89,0xff,0xb4,0x9f,0x8b,0xff,0xb5,0xa0,0x8a,0xff,0xbc,0xa6,0x8e,0xff,0xc1,0xad,0x93,0xff,0xc3,0xb1,0x97,0xff,0xb6,0xa4,0x90,0xff,0x9d,0x8c,0x7e,0xff,0x81,0x6f,0x68,0xff,0x61,0x4c,0x4c,0xff,0x67,0x53,0x51,0xff,0x5f,0x4b,0x4a,0xff,0x59,0x46,0x4a,0xff,0x3f,0x2f,0x36,0xff,0x33,0x25,0x2e,0xff,0x2d,0x1d,0x2a,0xff,0x1b,0x0e,0x1a,0xff,0x12,0x08,0x13,0xff,0x1e,0x11,0x23,0xff,0x19,0x0a,0x1d,0xff,0x49,0x3a,0x4d,0xff,0x5b,0x58,0x78,0xff,0x55,0x54,0x7b,0xff,0x48,0x45,0x68,0xff,0x35,0x31,0x52,0xff,0x3b,0x35,0x59,0xff,0x44,0x3f,0x65,0xff,0x56,0x58,0x81,0xff,0x64,0x6c,0x9b,0xff,0x71,0x7f,0xb0,0xff,0x7c,0x8d,0xc1,0xff,0x90,0xa2,0xd8,0xff,0x9e,0xb1,0xe7,0xff,0xaa,0xbc,0xf0,0xff,0xb7,0xc6,0xf7,0xff,0xba,0xc9,0xf8,0xff,0xbb,0xcb,0xf9,0xff,0xb9,0xcb,0xf9,0xff,0xb8,0xcd,0xfa,0xff,0xb7,0xcc,0xfb,0xff,0xb6,0xcd,0xfa,0xff,0xc2,0xdb,0xfd,0xff,0xc6,0xdd,0xf9,0xff,0x82,0x97,0xc9,0xff,0x99,0xaa,0xe1,0xff,0xc3,0xd0,0xfc,0xff,0xaf,0xbf,0xed,0xff,0x94,0xa1,0xd5,0xff,0x9f,0xad,0xe1,0xff,0xb5,0xc2,0xf2,0xff,0xcd,0xdd,0xfb,0xff,0xd9,0xe7,0xfb,0xff,0xcf,0xe0,0xff,0xff,0xa9,0xb7,0xe4,0xff,0x62,0x6b,0x90,0xff,0x85,0x98,0xc4,0xff,0x9b,0xb4,0xe7,0xff,0x8b,0xa2,0xd6,0xff,0x8a,0xa1,0xd4,0xff,0x8b,0xa0,0xd3,0xff,0x81,0x96,0xca,0xff,0x6d,0x7e,0xad,0xff,0x5c,0x64,0x89,0xff,0x42,0x42,0x5d,0xff,0x30,0x29,0x3c,0xff,0x1b,0x0f,0x1d,0xff,0x14,0x09,0x14,0xff,0x17,0x0d,0x16,0xff,0x28,0x1e,0x24,0xff,0x38,0x2c,0x30,0xff,0x3b,0x2e,0x2f,0xff,0x4f,0x43,0x43,0xff,0x5c,0x51,0x50,0xff,0x5e,0x53,0x52,0xff,0x50,0x44,0x45,0xff,0x32,0x26,0x28,0xff,0x2e,0x22,0x25,0xff,0x2a,0x1c,0x21,0xff,0x17,0x0d,0x12,0xff,0x0b,0x04,0x0a,0xff,0x0a,0x04,0x09,0xff,0x0f,0x09,0x0e,0xff,0x10,0x0a,0x10,0xff,0x0f,0x06,0x0d,0xff,0x0d,0x06,0x0a,0xff,0x0c,0x05,0x09,0xff,0x05,0x01,0x06,0xff,0x0d,0x06,0x0c,0xff,0x16,0x0d,0x14,0xff,0x0d,0x07,0x0a,0xff,0x0a,0x04,0x07,0xff,0x10,0x0a,0x0d,0xff,0x1e,0x15,0x1a,0xff,0x0f,0x06,0x0b,0xff,0x10,0x09,0x0e,0xff,0x11,0x0b,0x0f,0xff,0x0e,0x08,0x0b,0xff,0x11,0x0a,0x0e,0xff,0x0a,0x03,0x06,0xff,0x3a,0x33,0x36,0xff,0xed,0xec,0xec,0x88,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xd3,0xce,0xcb,0x42,0x6a,0x59,0x4e,0xff,0x71,0x60,0x55,0xff,0x72,0x60,0x56,0xff,0x75,0x63,0x59,0xff,0x77,0x65,0x5b,0xff,0x7a,0x67,0x5c,0xff,0x7a,0x68,0x5f,0xff,0x7b,0x6a,0x5f,0xff,0x7e,0x6d,0x60,0xff,0x80,0x70,0x62,0xff,0x82,0x72,0x64,0xff,0x85,0x74,0x67,0xff,0x8a,0x76,0x66,0xff,0x8c,0x78,0x68,0xff,0x8d,0x79,0x69,0xff,0x90,0x7a,0x6c,0xff,0x90,0x7b,0x6c,0xff,0x92,0x7e,0x6f,0xff,0x93,0x7f,0x6f,0xff,0x95,0x81,0x71,0xff,0x96,0x82,0x72,0xff,0x98,0x82,0x74,0xff,0x9b,0x84,0x74,0xff,0x99,0x87,0x74,0xff,0x9c,0x89,0x75,0xff,0x9d,0x8a,0x78,0xff,0x9f,0x8c,0x7b,0xff,0xa1,0x8d,0x7d,0xff,0xa2,0x8e,0x7c,0xff,0xa6,0x8d,0x7c,0xff,0xa4,0x90,0x80,0xff,0xa6,0x93,0x81,0xff,0xa7,0x96,0x82,0xff,0xa8,0x98,0x83,0xff,0xaa,0x97,0x83,0xff,0xaa,0x98,0x84,0xff,0xac,0x9a,0x86,0xff,0xac,0x98,0x87,0xff,0xae,0x9b,0x87,0xff,0xae,0x9a,0x87,0xff,0xb0,0x9b,0x88,0xff,0xb2,0x9d,0x8a,0xff,0xb3,0x9e,0x8c,0xff,0xb9,0xa5,0x8f,0xff,0xbd,0xa9,0x93,0xff,0xb2,0xa0,0x90,0xff,0x8f,0x7e,0x74,0xff,0x6e,0x5c,0x55,0xff,0x4c,0x39,0x42,0xff,0x2e,0x1d,0x2d,0xff,0x1e,0x0d,0x1d,0xff,0x2b,0x1a,0x29,0xff,0x25,0x15,0x25,0xff,0x0d,0x01,0x0f,0xff,0x11,0x0b,0x15,0xff,0x0c,0x04,0x0f,0xff,0x0d,0x04,0x11,0xff,0x0d,0x06,0x0e,0xff,0x0e,0x07,0x10,0xff,0x12,0x0a,0x16,0xff,0x11,0x07,0x12,0xff,0x1b,0x10,0x1d,0xff,0x48,0x3b,0x49,0xff,0x5d,0x58,0x73,0xff,0x58,0x57,0x7d,0xff,0x53,0x50,0x77,0xff,0x44,0x3f,0x64,0xff,0x3c,0x36,0x5a,0xff,0x3d,0x37,0x5b,0xff,0x48,0x46,0x6e,0xff,0x53,0x57,0x81,0xff,0x63,0x6a,0x98,0xff,0x6f,0x7e,0xae,0xff,0x7c,0x8d,0xc3,0xff,0x8e,0xa0,0xd8,0xff,0x9b,0xad,0xe3,0xff,0xab,0xbc,0xf0,0xff,0xaa,0xc0,0xf0,0xff,0xac,0xc3,0xf2,0xff,0xb1,0xc6,0xf6,0xff,0xb4,0xc9,0xf8,0xff,0xb7,0xcc,0xf9,0xff,0xbc,0xd6,0xfa,0xff,0xce,0xe3,0xfc,0xff,0xe7,0xf3,0xff,0xff,0x8e,0x9d,0xc6,0xff,0x41,0x4c,0x90,0xff,0x67,0x6f,0xaf,0xff,0x61,0x68,0xa6,0xff,0x49,0x4b,0x85,0xff,0x46,0x48,0x82,0xff,0x59,0x5b,0x97,0xff,0x7a,0x80,0xb7,0xff,0x8c,0x9a,0xc8,0xff,0x74,0x86,0xbb,0xff,0x44,0x45,0x76,0xff,0x33,0x39,0x5f,0xff,0x98,0xae,0xdc,0xff,0xa0,0xb8,0xea,0xff,0x8c,0xa5,0xd7,0xff,0x88,0xa0,0xd3,0xff,0x85,0x98,0xcc,0xff,0x78,0x89,0xbc,0xff,0x62,0x6e,0x9c,0xff,0x4c,0x4f,0x73,0xff,0x36,0x32,0x4d,0xff,0x26,0x1e,0x2f,0xff,0x14,0x0a,0x15,0xff,0x1b,0x12,0x1a,0xff,0x25,0x1c,0x23,0xff,0x34,0x29,0x2d,0xff,0x40,0x34,0x37,0xff,0x53,0x47,0x47,0xff,0x5e,0x53,0x52,0xff,0x4d,0x42,0x43,0xff,0x28,0x1e,0x20,0xff,0x1b,0x10,0x12,0xff,0x16,0x08,0x0f,0xff,0x24,0x16,0x1c,0xff,0x21,0x13,0x17,0xff,0x11,0x09,0x0e,0xff,0x06,0x02,0x07,0xff,0x09,0x04,0x09,0xff,0x0a,0x04,0x09,0xff,0x14,0x0c,0x10,0xff,0x22,0x18,0x1c,0xff,0x12,0x0a,0x0e,0xff,0x0c,0x06,0x08,0xff,0x0e,0x08,0x0e,0xff,0x0f,0x07,0x0c,0xff,0x0f,0x06,0x0c,0xff,0x0f,0x0a,0x0c,0xff,0x0e,0x08,0x0b,0xff,0x08,0x02,0x05,0xff,0x10,0x07,0x0d,0xff,0x13,0x0a,0x10,0xff,0x1b,0x14,0x19,0xff,0x1f,0x19,0x1c,0xff,0x13,0x0b,0x10,0xff,0x16,0x0e,0x11,0xff,0x22,0x1a,0x1b,0xff,0x41,0x39,0x3a,0xff,0xe8,0xe7,0xe7,0x9d,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xd0,0xcb,0xc6,0x52,0x6a,0x5a,0x4d,0xff,0x72,0x60,0x56,0xff,0x75,0x61,0x57,0xff,0x77,0x65,0x5a,0xff,0x77,0x67,0x5c,0xff,0x79,0x68,0x5d,0xff,0x7b,0x6a,0x60,0xff,0x7c,0x6c,0x60,0xff,0x7d,0x6c,0x61,0xff,0x80,0x72,0x62,0xff,0x82,0x73,0x64,0xff,0x89,0x74,0x67,0xff,0x8b,0x78,0x64,0xff,0x8e,0x79,0x68,0xff,0x91,0x7a,0x6b,0xff,0x93,0x7b,0x6d,0xff,0x92,0x7c,0x6d,0xff,0x93,0x7f,0x70,0xff,0x95,0x82,0x70,0xff,0x94,0x81,0x71,0xff,0x95,0x81,0x72,0xff,0x9a,0x85,0x77,0xff,0x9b,0x85,0x75,0xff,0x9b,0x86,0x75,0xff,0x9c,0x88,0x77,0xff,0x9d,0x8b,0x79,0xff,0xa0,0x8c,0x7b,0xff,0xa3,0x8d,0x7c,0xff,0xa1,0x8f,0x7b,0xff,0xa4,0x90,0x7e,0xff,0xa7,0x92,0x80,0xff,0xa8,0x95,0x81,0xff,0xa7,0x97,0x83,0xff,0xa7,0x97,0x83,0xff,0xaa,0x98,0x83,0xff,0xaa,0x98,0x84,0xff,0xad,0x99,0x86,0xff,0xae,0x9b,0x87,0xff,0xb0,0x9b,0x88,0xff,0xaf,0x9c,0x87,0xff,0xaf,0x9d,0x88,0xff,0xb5,0xa3,0x8e,0xff,0xbb,0xa8,0x95,0xff,0xa1,0x92,0x81,0xff,0x77,0x6a,0x61,0xff,0x4f,0x41,0x46,0xff,0x3b,0x2d,0x38,0xff,0x2c,0x1c,0x2b,0xff,0x22,0x12,0x23,0xff,0x23,0x14,0x24,0xff,0x18,0x0b,0x1c,0xff,0x20,0x15,0x24,0xff,0x17,0x10,0x1a,0xff,0x0d,0x07,0x0e,0xff,0x13,0x0c,0x12,0xff,0x11,0x08,0x0f,0xff,0x0e,0x07,0x0f,0xff,0x0f,0x08,0x0f,0xff,0x0d,0x06,0x0f,0xff,0x0d,0x05,0x0f,0xff,0x0b,0x03,0x0e,0xff,0x13,0x0a,0x17,0xff,0x2e,0x22,0x2e,0xff,0x56,0x4c,0x65,0xff,0x56,0x52,0x79,0xff,0x54,0x53,0x7b,0xff,0x4e,0x4c,0x71,0xff,0x43,0x3f,0x62,0xff,0x40,0x3d,0x60,0xff,0x47,0x43,0x67,0xff,0x51,0x4f,0x77,0xff,0x5d,0x60,0x8a,0xff,0x66,0x70,0x9d,0xff,0x71,0x7e,0xb1,0xff,0x84,0x94,0xca,0xff,0x95,0xa8,0xdf,0xff,0x9e,0xb4,0xe9,0xff,0xa4,0xba,0xed,0xff,0xab,0xc0,0xf1,0xff,0xb1,0xc6,0xf7,0xff,0xb7,0xc9,0xf8,0xff,0xbe,0xd3,0xf9,0xff,0xc7,0xdf,0xfa,0xff,0xda,0xea,0xfc,0xff,0xeb,0xf4,0xff,0xff,0xbe,0xca,0xeb,0xff,0x2c,0x34,0x77,0xff,0x09,0x0b,0x50,0xff,0x07,0x07,0x41,0xff,0x0f,0x0e,0x42,0xff,0x18,0x18,0x4c,0xff,0x33,0x31,0x64,0xff,0x42,0x3e,0x70,0xff,0x35,0x2f,0x62,0xff,0x26,0x23,0x4f,0xff,0x0d,0x0c,0x38,0xff,0x3a,0x48,0x81,0xff,0x9a,0xb3,0xe7,0xff,0x9d,0xb4,0xe5,0xff,0x8e,0xa6,0xd9,0xff,0x83,0x9c,0xcf,0xff,0x7f,0x91,0xc5,0xff,0x6e,0x7d,0xaa,0xff,0x5b,0x60,0x86,0xff,0x43,0x3e,0x5c,0xff,0x33,0x2a,0x3e,0xff,0x1b,0x14,0x22,0xff,0x0f,0x0a,0x12,0xff,0x24,0x1a,0x20,0xff,0x31,0x25,0x2b,0xff,0x3b,0x2f,0x33,0xff,0x58,0x4c,0x4e,0xff,0x4f,0x44,0x44,0xff,0x3e,0x33,0x34,0xff,0x3b,0x2f,0x30,0xff,0x47,0x3d,0x3b,0xff,0x49,0x40,0x3c,0xff,0x29,0x1c,0x20,0xff,0x27,0x1a,0x20,0xff,0x27,0x1c,0x20,0xff,0x13,0x0c,0x12,0xff,0x07,0x03,0x08,0xff,0x08,0x02,0x08,0xff,0x0b,0x06,0x0a,0xff,0x1b,0x12,0x13,0xff,0x27,0x1d,0x1f,0xff,0x0c,0x07,0x09,0xff,0x12,0x0b,0x0f,0xff,0x0d,0x07,0x0d,0xff,0x0c,0x05,0x0b,0xff,0x11,0x0a,0x0f,0xff,0x13,0x0b,0x0e,0xff,0x0f,0x08,0x0b,0xff,0x10,0x09,0x0d,0xff,0x12,0x0a,0x10,0xff,0x13,0x0a,0x10,0xff,0x0e,0x07,0x0c,0xff,0x0e,0x08,0x0b,0xff,0x0c,0x06,0x09,0xff,0x0d,0x07,0x09,0xff,0x14,0x0e,0x0f,0xff,0x2e,0x29,0x29,0xff,0xe4,0xe3,0xe3,0xb1,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xcd,0xc8,0xc4,0x5b,0x6a,0x59,0x4c,0xff,0x74,0x63,0x56,0xff,0x75,0x63,0x57,0xff,0x76,0x66,0x58,0xff,0x78,0x68,0x5a,0xff,0x7b,0x6b,0x5c,0xff,0x7c,0x6d,0x5e,0xff,0x7f,0x6f,0x61,0xff,0x80,0x6f,0x62,0xff,0x83,0x71,0x64,0xff,0x87,0x75,0x67,0xff,0x88,0x75,0x66,0xff,0x8c,0x78,0x69,0xff,0x90,0x7b,0x6b,0xff,0x92,0x7b,0x6c,0xff,0x91,0x7e,0x6d,0xff,0x92,0x7f,0x6e,0xff,0x95,0x80,0x71,0xff,0x98,0x83,0x72,0xff,0x96,0x82,0x73,0xff,0x98,0x84,0x75,0xff,0x9a,0x87,0x76,0xff,0x9c,0x87,0x76,0xff,0x9d,0x87,0x77,0xff,0x9e,0x89,0x7a,0xff,0x9f,0x8a,0x79,0xff,0x9f,0x8b,0x79,0xff,0xa1,0x8d,0x79,0xff,0xa2,0x90,0x7b,0xff,0xa7,0x93,0x7e,0xff,0xa8,0x94,0x7f,0xff,0xa7,0x98,0x83,0xff,0xa7,0x96,0x82,0xff,0xaa,0x97,0x84,0xff,0xab,0x99,0x85,0xff,0xab,0x99,0x84,0xff,0xab,0x99,0x86,0xff,0xae,0x9c,0x87,0xff,0xb3,0xa0,0x88,0xff,0xb7,0xa3,0x8e,0xff,0xb3,0xa1,0x91,0xff,0xa5,0x94,0x86,0xff,0x78,0x68,0x63,0xff,0x4b,0x3a,0x40,0xff,0x3a,0x2b,0x35,0xff,0x39,0x2a,0x36,0xff,0x35,0x27,0x32,0xff,0x2a,0x1a,0x2a,0xff,0x1d,0x0f,0x1f,0xff,0x14,0x09,0x16,0xff,0x0f,0x06,0x0f,0xff,0x16,0x10,0x17,0xff,0x11,0x0b,0x13,0xff,0x0c,0x06,0x0d,0xff,0x0f,0x07,0x10,0xff,0x10,0x08,0x12,0xff,0x0d,0x07,0x11,0xff,0x0d,0x05,0x0f,0xff,0x0b,0x03,0x0d,0xff,0x0b,0x03,0x0d,0xff,0x0d,0x05,0x10,0xff,0x0d,0x05,0x10,0xff,0x0d,0x03,0x0e,0xff,0x49,0x3d,0x54,0xff,0x5b,0x52,0x79,0xff,0x51,0x4f,0x77,0xff,0x54,0x52,0x78,0xff,0x50,0x4e,0x74,0xff,0x47,0x44,0x69,0xff,0x43,0x40,0x66,0xff,0x49,0x48,0x6e,0xff,0x52,0x56,0x7e,0xff,0x57,0x5f,0x8a,0xff,0x69,0x73,0xa3,0xff,0x7a,0x85,0xba,0xff,0x87,0x99,0xcf,0xff,0x93,0xa7,0xdf,0xff,0xa2,0xb8,0xec,0xff,0xa9,0xc0,0xf2,0xff,0xb0,0xc7,0xf8,0xff,0xbc,0xd1,0xfd,0xff,0xc9,0xde,0xfa,0xff,0xda,0xe8,0xfc,0xff,0xe7,0xf0,0xfd,0xff,0xec,0xf3,0xfe,0xff,0xd8,0xe6,0xfe,0xff,0x92,0xa4,0xd7,0xff,0x44,0x53,0x8f,0xff,0x2b,0x39,0x72,0xff,0x28,0x2a,0x5d,0xff,0x1a,0x16,0x48,0xff,0x1a,0x18,0x46,0xff,0x1a,0x19,0x40,0xff,0x10,0x0d,0x32,0xff,0x13,0x0e,0x35,0xff,0x15,0x14,0x41,0xff,0x4f,0x5f,0x92,0xff,0x96,0xb0,0xe0,0xff,0x99,0xb0,0xe1,0xff,0x8c,0xa3,0xd4,0xff,0x7f,0x97,0xc8,0xff,0x77,0x89,0xbc,0xff,0x61,0x6d,0x9a,0xff,0x4e,0x51,0x73,0xff,0x35,0x30,0x47,0xff,0x2d,0x25,0x36,0xff,0x10,0x0b,0x15,0xff,0x18,0x10,0x18,0xff,0x31,0x24,0x2b,0xff,0x3c,0x2f,0x34,0xff,0x52,0x45,0x47,0xff,0x5b,0x4f,0x51,0xff,0x2e,0x26,0x27,0xff,0x46,0x3d,0x3d,0xff,0x5b,0x50,0x4e,0xff,0x4d,0x43,0x40,0xff,0x55,0x4d,0x45,0xff,0x33,0x27,0x27,0xff,0x1b,0x0f,0x15,0xff,0x22,0x16,0x1c,0xff,0x11,0x0a,0x10,0xff,0x0c,0x07,0x0c,0xff,0x0f,0x07,0x0d,0xff,0x0f,0x0a,0x0d,0xff,0x1a,0x12,0x15,0xff,0x20,0x15,0x19,0xff,0x0d,0x07,0x0c,0xff,0x11,0x09,0x10,0xff,0x09,0x04,0x09,0xff,0x0c,0x05,0x0b,0xff,0x13,0x0a,0x10,0xff,0x18,0x0e,0x14,0xff,0x1a,0x11,0x14,0xff,0x19,0x0f,0x12,0xff,0x17,0x0d,0x12,0xff,0x0f,0x07,0x0c,0xff,0x09,0x04,0x07,0xff,0x0a,0x05,0x08,0xff,0x0a,0x03,0x08,0xff,0x0b,0x05,0x09,0xff,0x06,0x01,0x03,0xff,0x16,0x11,0x13,0xff,0xde,0xdd,0xdd,0xbb,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xcc,0xc6,0xc3,0x5b,0x68,0x57,0x4a,0xff,0x74,0x63,0x57,0xff,0x75,0x65,0x58,0xff,0x77,0x68,0x59,0xff,0x7a,0x6a,0x5a,0xff,0x7d,0x6e,0x5e,0xff,0x7e,0x6e,0x5f,0xff,0x80,0x6f,0x62,0xff,0x83,0x73,0x64,0xff,0x86,0x75,0x67,0xff,0x88,0x76,0x68,0xff,0x8a,0x79,0x6a,0xff,0x8e,0x7b,0x6c,0xff,0x91,0x7c,0x6c,0xff,0x93,0x7e,0x6e,0xff,0x93,0x7f,0x6e,0xff,0x94,0x80,0x70,0xff,0x96,0x82,0x73,0xff,0x99,0x83,0x72,0xff,0x99,0x84,0x75,0xff,0x99,0x84,0x75,0xff,0x99,0x87,0x75,0xff,0x9d,0x89,0x77,0xff,0xa0,0x8a,0x7a,0xff,0x9f,0x89,0x7c,0xff,0xa2,0x8c,0x7b,0xff,0xa3,0x8e,0x7c,0xff,0xa5,0x90,0x7d,0xff,0xa4,0x92,0x7d,0xff,0xa7,0x94,0x7f,0xff,0xa9,0x95,0x81,0xff,0xa8,0x96,0x83,0xff,0xa9,0x97,0x84,0xff,0xaa,0x97,0x83,0xff,0xab,0x99,0x86,0xff,0xac,0x9a,0x87,0xff,0xad,0x9a,0x88,0xff,0xb0,0x9d,0x89,0xff,0xad,0x9a,0x88,0xff,0x95,0x83,0x7b,0xff,0x6e,0x5f,0x62,0xff,0x46,0x38,0x3c,0xff,0x3f,0x30,0x3a,0xff,0x3d,0x2c,0x38,0xff,0x43,0x32,0x3e,0xff,0x37,0x25,0x32,0xff,0x29,0x18,0x27,0xff,0x2b,0x1a,0x2b,0xff,0x17,0x0d,0x19,0xff,0x0d,0x05,0x0d,0xff,0x0c,0x05,0x0d,0xff,0x09,0x04,0x0c,0xff,0x0c,0x06,0x0e,0xff,0x0c,0x05,0x0d,0xff,0x0d,0x05,0x0f,0xff,0x0f,0x08,0x12,0xff,0x0e,0x07,0x12,0xff,0x0d,0x06,0x11,0xff,0x0d,0x05,0x10,0xff,0x0d,0x04,0x0f,0xff,0x0c,0x04,0x0f,0xff,0x0c,0x04,0x0f,0xff,0x07,0x00,0x09,0xff,0x2c,0x21,0x32,0xff,0x5c,0x50,0x72,0xff,0x56,0x53,0x7a,0xff,0x53,0x51,0x79,0xff,0x55,0x54,0x7b,0xff,0x51,0x50,0x77,0xff,0x48,0x49,0x6f,0xff,0x46,0x45,0x6d,0xff,0x53,0x55,0x7b,0xff,0x56,0x5d,0x87,0xff,0x5d,0x64,0x94,0xff,0x72,0x7b,0xac,0xff,0x81,0x91,0xc4,0xff,0x8d,0xa0,0xd6,0xff,0x9a,0xaf,0xe4,0xff,0xa5,0xbd,0xf1,0xff,0xb0,0xc8,0xfa,0xff,0xbf,0xd6,0xfd,0xff,0xd0,0xe5,0xff,0xff,0xdb,0xe9,0xfe,0xff,0xe0,0xed,0xfe,0xff,0xe2,0xee,0xfd,0xff,0xd9,0xe7,0xfc,0xff,0xc8,0xdf,0xfd,0xff,0xb9,0xcd,0xf7,0xff,0xa2,0xb5,0xe5,0xff,0x88,0x98,0xc8,0xff,0x57,0x5f,0x90,0xff,0x27,0x29,0x5a,0xff,0x15,0x11,0x3b,0xff,0x0d,0x07,0x2f,0xff,0x13,0x0d,0x38,0xff,0x3a,0x3f,0x6f,0xff,0x77,0x8a,0xbc,0xff,0x93,0xab,0xdb,0xff,0x8f,0xa5,0xd4,0xff,0x86,0x9d,0xcc,0xff,0x77,0x8f,0xbf,0xff,0x6f,0x80,0xae,0xff,0x55,0x60,0x87,0xff,0x3e,0x42,0x5c,0xff,0x31,0x2c,0x3e,0xff,0x27,0x1f,0x2f,0xff,0x0d,0x08,0x10,0xff,0x1d,0x15,0x1b,0xff,0x41,0x36,0x3b,0xff,0x63,0x58,0x5a,0xff,0x5a,0x4e,0x50,0xff,0x3c,0x30,0x32,0xff,0x3d,0x34,0x35,0xff,0x43,0x38,0x39,0xff,0x47,0x3b,0x3b,0xff,0x75,0x6a,0x68,0xff,0x65,0x5b,0x56,0xff,0x2f,0x23,0x25,0xff,0x17,0x0c,0x14,0xff,0x11,0x08,0x0f,0xff,0x10,0x09,0x0f,0xff,0x0e,0x07,0x0c,0xff,0x16,0x0d,0x12,0xff,0x12,0x0a,0x0e,0xff,0x15,0x0d,0x10,0xff,0x1b,0x10,0x16,0xff,0x11,0x0a,0x10,0xff,0x12,0x0a,0x0f,0xff,0x12,0x09,0x0f,0xff,0x15,0x0b,0x11,0xff,0x12,0x08,0x0f,0xff,0x15,0x0b,0x12,0xff,0x1d,0x14,0x17,0xff,0x25,0x1b,0x1d,0xff,0x26,0x1a,0x1f,0xff,0x1b,0x12,0x15,0xff,0x0d,0x08,0x0a,0xff,0x0a,0x06,0x08,0xff,0x0e,0x08,0x0c,0xff,0x09,0x04,0x07,0xff,0x06,0x00,0x03,0xff,0x14,0x0f,0x12,0xff,0xdc,0xdc,0xdc,0xbb,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xcc,0xc6,0xc2,0x5b,0x68,0x56,0x4b,0xff,0x73,0x62,0x57,0xff,0x76,0x66,0x59,0xff,0x79,0x6a,0x5b,0xff,0x7a,0x6b,0x5b,0xff,0x7c,0x6e,0x5e,0xff,0x80,0x6f,0x60,0xff,0x83,0x71,0x61,0xff,0x85,0x74,0x64,0xff,0x87,0x76,0x66,0xff,0x8b,0x78,0x68,0xff,0x91,0x7a,0x6d,0xff,0x90,0x7b,0x6e,0xff,0x91,0x7e,0x6c,0xff,0x93,0x80,0x6f,0xff,0x93,0x7f,0x71,0xff,0x95,0x81,0x72,0xff,0x96,0x82,0x73,0xff,0x99,0x83,0x72,0xff,0x9b,0x84,0x75,0xff,0x9b,0x85,0x76,0xff,0x9c,0x89,0x77,0xff,0x9d,0x88,0x77,0xff,0x9f,0x8a,0x79,0xff,0xa0,0x8d,0x7b,0xff,0xa3,0x8e,0x7b,0xff,0xa4,0x8f,0x7d,0xff,0xa5,0x90,0x80,0xff,0xa5,0x92,0x7e,0xff,0xa6,0x94,0x80,0xff,0xa8,0x96,0x82,0xff,0xa9,0x95,0x84,0xff,0xab,0x98,0x85,0xff,0xab,0x99,0x85,0xff,0xae,0x9a,0x88,0xff,0xb1,0x9d,0x8b,0xff,0xb6,0xa2,0x8f,0xff,0xa1,0x93,0x87,0xff,0x69,0x5d,0x5e,0xff,0x59,0x4c,0x52,0xff,0x47,0x3a,0x43,0xff,0x33,0x25,0x2f,0xff,0x39,0x2a,0x36,0xff,0x3f,0x2e,0x3b,0xff,0x34,0x23,0x30,0xff,0x26,0x15,0x24,0xff,0x23,0x11,0x21,0xff,0x20,0x11,0x21,0xff,0x12,0x0c,0x18,0xff,0x0b,0x06,0x0d,0xff,0x0c,0x05,0x0e,0xff,0x09,0x04,0x0f,0xff,0x09,0x04,0x0e,0xff,0x0a,0x03,0x0b,0xff,0x0c,0x04,0x0e,0xff,0x0c,0x04,0x0f,0xff,0x0c,0x04,0x0e,0xff,0x0a,0x05,0x0f,0xff,0x0d,0x06,0x10,0xff,0x0e,0x06,0x10,0xff,0x0c,0x04,0x0e,0xff,0x0a,0x05,0x0f,0xff,0x09,0x05,0x0d,0xff,0x10,0x0a,0x12,0xff,0x49,0x3e,0x57,0xff,0x51,0x4c,0x72,0xff,0x51,0x4e,0x76,0xff,0x51,0x4f,0x76,0xff,0x52,0x53,0x7a,0xff,0x56,0x59,0x7f,0xff,0x4d,0x50,0x78,0xff,0x52,0x52,0x79,0xff,0x56,0x5b,0x84,0xff,0x5b,0x63,0x8f,0xff,0x65,0x6f,0x9d,0xff,0x72,0x7f,0xb0,0xff,0x85,0x95,0xc9,0xff,0x97,0xa9,0xe0,0xff,0x9d,0xb5,0xea,0xff,0xab,0xc4,0xf5,0xff,0xb8,0xd0,0xfa,0xff,0xc3,0xd4,0xf9,0xff,0xcd,0xe1,0xfc,0xff,0xd1,0xe3,0xfc,0xff,0xd0,0xe3,0xfc,0xff,0xcf,0xe4,0xfb,0xff,0xcc,0xe0,0xfa,0xff,0xc7,0xdc,0xf9,0xff,0xc0,0xd5,0xf8,0xff,0xae,0xc4,0xf2,0xff,0x86,0x9a,0xcd,0xff,0x58,0x61,0x99,0xff,0x2a,0x2d,0x64,0xff,0x14,0x14,0x4b,0xff,0x33,0x37,0x6d,0xff,0x67,0x7b,0xac,0xff,0x87,0x9f,0xce,0xff,0x8a,0xa2,0xd0,0xff,0x85,0x9d,0xca,0xff,0x7f,0x97,0xc7,0xff,0x6f,0x88,0xb8,0xff,0x61,0x74,0x9b,0xff,0x4f,0x52,0x6f,0xff,0x35,0x34,0x4c,0xff,0x32,0x2c,0x40,0xff,0x1c,0x14,0x20,0xff,0x12,0x0b,0x11,0xff,0x2f,0x28,0x2c,0xff,0x53,0x4b,0x4d,0xff,0x4f,0x45,0x47,0xff,0x3a,0x2e,0x31,0xff,0x42,0x35,0x37,0xff,0x3a,0x2f,0x30,0xff,0x3f,0x33,0x34,0xff,0x52,0x46,0x45,0xff,0x68,0x5d,0x5a,0xff,0x79,0x70,0x69,0xff,0x34,0x2a,0x2a,0xff,0x19,0x0e,0x16,0xff,0x10,0x06,0x0b,0xff,0x17,0x0c,0x13,0xff,0x12,0x09,0x0e,0xff,0x14,0x0b,0x0e,0xff,0x1a,0x11,0x14,0xff,0x16,0x0b,0x10,0xff,0x13,0x09,0x0f,0xff,0x13,0x0a,0x12,0xff,0x0a,0x03,0x08,0xff,0x0e,0x09,0x0d,0xff,0x12,0x0a,0x10,0xff,0x0d,0x05,0x0b,0xff,0x12,0x0a,0x10,0xff,0x14,0x0c,0x0f,0xff,0x1d,0x13,0x15,0xff,0x22,0x15,0x19,0xff,0x20,0x15,0x18,0xff,0x1a,0x11,0x14,0xff,0x13,0x0c,0x0f,0xff,0x14,0x0e,0x10,0xff,0x0e,0x07,0x0a,0xff,0x0a,0x03,0x06,0xff,0x25,0x1e,0x21,0xff,0xe0,0xdf,0xdf,0xbb,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xce,0xc8,0xc5,0x5a,0x69,0x57,0x4c,0xff,0x73,0x62,0x57,0xff,0x76,0x65,0x5a,0xff,0x78,0x68,0x5b,0xff,0x7b,0x6c,0x5c,0xff,0x7e,0x6e,0x5f,0xff,0x81,0x70,0x62,0xff,0x84,0x72,0x62,0xff,0x86,0x75,0x65,0xff,0x88,0x76,0x65,0xff,0x8c,0x78,0x67,0xff,0x8e,0x79,0x6a,0xff,0x90,0x7b,0x6a,0xff,0x92,0x7d,0x6d,0xff,0x91,0x7e,0x6f,0xff,0x95,0x80,0x70,0xff,0x97,0x81,0x71,0xff,0x98,0x82,0x72,0xff,0x9a,0x85,0x74,0xff,0x9b,0x85,0x75,0xff,0x9d,0x88,0x76,0xff,0x9d,0x89,0x76,0xff,0x9c,0x88,0x77,0xff,0x9f,0x8c,0x7a,0xff,0xa1,0x8f,0x7a,0xff,0xa4,0x8f,0x7b,0xff,0xa4,0x90,0x7d,0xff,0xa4,0x91,0x7e,0xff,0xa7,0x93,0x7f,0xff,0xa8,0x95,0x82,0xff,0xa8,0x96,0x81,0xff,0xaa,0x96,0x82,0xff,0xaa,0x97,0x83,0xff,0xae,0x9c,0x88,0xff,0xaf,0x9d,0x8d,0xff,0xa0,0x90,0x83,0xff,0x7b,0x71,0x6a,0xff,0x5b,0x4e,0x52,0xff,0x45,0x38,0x3f,0xff,0x3e,0x31,0x3a,0xff,0x3b,0x2c,0x37,0xff,0x2f,0x20,0x2c,0xff,0x36,0x25,0x34,0xff,0x32,0x23,0x31,0xff,0x26,0x16,0x24,0xff,0x1e,0x0f,0x1c,0xff,0x1f,0x10,0x1e,0xff,0x14,0x09,0x17,0xff,0x0b,0x07,0x0e,0xff,0x08,0x06,0x0b,0xff,0x0b,0x06,0x0e,0xff,0x0a,0x05,0x0e,0xff,0x0c,0x06,0x10,0xff,0x0d,0x05,0x0f,0xff,0x0e,0x06,0x11,0xff,0x0b,0x04,0x0d,0xff,0x0a,0x03,0x0b,0xff,0x0a,0x02,0x0d,0xff,0x0d,0x05,0x0f,0xff,0x0d,0x04,0x0e,0xff,0x0e,0x06,0x10,0xff,0x0c,0x07,0x0f,0xff,0x0b,0x06,0x0e,0xff,0x07,0x00,0x09,0xff,0x2a,0x1e,0x34,0xff,0x4b,0x43,0x68,0xff,0x4c,0x47,0x6f,0xff,0x50,0x4d,0x74,0xff,0x4e,0x4f,0x76,0xff,0x50,0x53,0x7a,0xff,0x57,0x57,0x80,0xff,0x56,0x57,0x7f,0xff,0x56,0x5b,0x84,0xff,0x5e,0x65,0x8e,0xff,0x61,0x69,0x98,0xff,0x6b,0x76,0xa9,0xff,0x7b,0x89,0xbd,0xff,0x88,0x99,0xce,0xff,0x99,0xaf,0xe2,0xff,0xaa,0xc2,0xf3,0xff,0xad,0xc3,0xf5,0xff,0xb0,0xc5,0xf3,0xff,0xc1,0xd8,0xfb,0xff,0xc3,0xda,0xf9,0xff,0xc1,0xd9,0xfa,0xff,0xc3,0xda,0xfa,0xff,0xcd,0xe1,0xf8,0xff,0xd0,0xe4,0xf8,0xff,0xd4,0xe6,0xfb,0xff,0xd5,0xe0,0xfd,0xff,0xbb,0xcb,0xf0,0xff,0x95,0xa5,0xd3,0xff,0x8c,0x95,0xc8,0xff,0x84,0x8f,0xc3,0xff,0x82,0x94,0xcc,0xff,0x90,0xa6,0xd6,0xff,0x93,0xad,0xd8,0xff,0x8a,0xa3,0xcf,0xff,0x81,0x98,0xc5,0xff,0x7b,0x90,0xbf,0xff,0x66,0x79,0xa6,0xff,0x52,0x5d,0x83,0xff,0x47,0x44,0x61,0xff,0x31,0x2a,0x43,0xff,0x29,0x22,0x35,0xff,0x11,0x08,0x14,0xff,0x2b,0x20,0x2a,0xff,0x4f,0x44,0x4a,0xff,0x58,0x4c,0x50,0xff,0x3c,0x2f,0x33,0xff,0x2e,0x20,0x25,0xff,0x46,0x3a,0x3e,0xff,0x34,0x27,0x2b,0xff,0x27,0x1b,0x1e,0xff,0x2b,0x20,0x22,0xff,0x3d,0x32,0x33,0xff,0x57,0x4d,0x4a,0xff,0x3c,0x30,0x31,0xff,0x25,0x18,0x1b,0xff,0x21,0x14,0x19,0xff,0x16,0x0b,0x10,0xff,0x26,0x1a,0x1f,0xff,0x1f,0x13,0x17,0xff,0x11,0x0a,0x0c,0xff,0x1e,0x12,0x16,0xff,0x13,0x0a,0x0f,0xff,0x12,0x0b,0x11,0xff,0x0c,0x05,0x0a,0xff,0x0e,0x06,0x0b,0xff,0x12,0x09,0x10,0xff,0x16,0x0d,0x13,0xff,0x16,0x0d,0x11,0xff,0x1a,0x11,0x15,0xff,0x26,0x1c,0x1e,0xff,0x29,0x1c,0x1f,0xff,0x1e,0x11,0x13,0xff,0x1b,0x10,0x13,0xff,0x1a,0x12,0x15,0xff,0x17,0x0e,0x12,0xff,0x1c,0x13,0x17,0xff,0x0c,0x03,0x07,0xff,0x24,0x1d,0x20,0xff,0xe1,0xe0,0xe0,0xba,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xd1,0xcc,0xc8,0x4e,0x6a,0x59,0x4d,0xff,0x72,0x62,0x56,0xff,0x75,0x64,0x59,0xff,0x78,0x68,0x5a,0xff,0x7b,0x6c,0x5c,0xff,0x7d,0x6e,0x5e,0xff,0x7f,0x6f,0x60,0xff,0x82,0x72,0x62,0xff,0x85,0x74,0x63,0xff,0x88,0x75,0x65,0xff,0x8b,0x77,0x67,0xff,0x8d,0x7a,0x69,0xff,0x8f,0x7b,0x6a,0xff,0x93,0x7d,0x6d,0xff,0x96,0x7f,0x71,0xff,0x97,0x81,0x70,0xff,0x99,0x83,0x72,0xff,0x9a,0x84,0x73,0xff,0x9b,0x86,0x75,0xff,0x9c,0x86,0x76,0xff,0xa0,0x8a,0x79,0xff,0x9f,0x8b,0x77,0xff,0xa0,0x88,0x78,0xff,0xa2,0x8b,0x7a,0xff,0xa2,0x8f,0x7c,0xff,0xa2,0x8e,0x7b,0xff,0xa6,0x92,0x7e,0xff,0xa5,0x92,0x7f,0xff,0xa6,0x92,0x7f,0xff,0xa6,0x93,0x80,0xff,0xa7,0x95,0x81,0xff,0xab,0x97,0x83,0xff,0xb0,0x9c,0x89,0xff,0xa1,0x91,0x85,0xff,0x7a,0x6e,0x6b,0xff,0x65,0x5e,0x5c,0xff,0x3e,0x39,0x3c,0xff,0x35,0x25,0x2f,0xff,0x38,0x2a,0x33,0xff,0x2b,0x1c,0x27,0xff,0x30,0x21,0x2d,0xff,0x21,0x12,0x20,0xff,0x26,0x1a,0x27,0xff,0x1e,0x11,0x1e,0xff,0x1e,0x10,0x20,0xff,0x16,0x0a,0x18,0xff,0x1b,0x0f,0x1c,0xff,0x13,0x0a,0x16,0xff,0x0b,0x06,0x0e,0xff,0x0a,0x06,0x0d,0xff,0x09,0x05,0x0c,0xff,0x0a,0x05,0x0f,0xff,0x0c,0x06,0x10,0xff,0x0f,0x06,0x11,0xff,0x0f,0x06,0x11,0xff,0x0c,0x05,0x0e,0xff,0x0b,0x04,0x0d,0xff,0x0c,0x04,0x0e,0xff,0x0d,0x05,0x10,0xff,0x0b,0x02,0x0d,0xff,0x0c,0x04,0x0e,0xff,0x0d,0x07,0x0f,0xff,0x0f,0x09,0x12,0xff,0x0d,0x06,0x0f,0xff,0x0f,0x06,0x15,0xff,0x3b,0x31,0x51,0xff,0x49,0x44,0x6a,0xff,0x4d,0x4b,0x72,0xff,0x4c,0x4c,0x72,0xff,0x4f,0x50,0x77,0xff,0x58,0x58,0x81,0xff,0x56,0x58,0x81,0xff,0x5a,0x5f,0x87,0xff,0x5c,0x62,0x8a,0xff,0x65,0x6c,0x97,0xff,0x6b,0x76,0xa7,0xff,0x76,0x82,0xb5,0xff,0x7f,0x91,0xc4,0xff,0x93,0xa8,0xda,0xff,0x9f,0xb5,0xe5,0xff,0xa5,0xbc,0xea,0xff,0xb1,0xc9,0xf3,0xff,0xb5,0xcc,0xf4,0xff,0xb9,0xd0,0xf4,0xff,0xbf,0xd8,0xf5,0xff,0xc8,0xde,0xfa,0xff,0xd1,0xe1,0xfd,0xff,0xc9,0xd7,0xfd,0xff,0xb1,0xc1,0xf7,0xff,0xad,0xb8,0xf9,0xff,0xb9,0xc7,0xfc,0xff,0xc7,0xd4,0xf9,0xff,0xc7,0xce,0xfa,0xff,0x9a,0x9e,0xe1,0xff,0x73,0x7e,0xc1,0xff,0x79,0x8a,0xc8,0xff,0x89,0x9f,0xd4,0xff,0x8b,0xa0,0xcf,0xff,0x75,0x85,0xae,0xff,0x67,0x75,0x9c,0xff,0x5f,0x69,0x91,0xff,0x51,0x52,0x73,0xff,0x3b,0x39,0x52,0xff,0x2d,0x28,0x3c,0xff,0x16,0x10,0x1e,0xff,0x18,0x0f,0x1a,0xff,0x3d,0x34,0x3c,0xff,0x48,0x3d,0x41,0xff,0x4a,0x3d,0x41,0xff,0x3d,0x31,0x34,0xff,0x3c,0x30,0x34,0xff,0x51,0x44,0x49,0xff,0x4b,0x3e,0x42,0xff,0x33,0x26,0x2b,0xff,0x3a,0x2e,0x31,0xff,0x2b,0x20,0x23,0xff,0x28,0x1b,0x22,0xff,0x29,0x1b,0x1e,0xff,0x24,0x15,0x1a,0xff,0x23,0x14,0x1b,0xff,0x18,0x0b,0x12,0xff,0x1f,0x12,0x16,0xff,0x3b,0x28,0x2d,0xff,0x1e,0x13,0x17,0xff,0x12,0x09,0x0e,0xff,0x10,0x09,0x0d,0xff,0x0b,0x03,0x09,0xff,0x14,0x0a,0x12,0xff,0x16,0x0c,0x11,0xff,0x1c,0x11,0x15,0xff,0x1f,0x15,0x16,0xff,0x1b,0x11,0x12,0xff,0x1b,0x12,0x14,0xff,0x1c,0x12,0x13,0xff,0x1a,0x0e,0x11,0xff,0x21,0x14,0x17,0xff,0x22,0x17,0x19,0xff,0x1c,0x13,0x15,0xff,0x15,0x0d,0x10,0xff,0x11,0x09,0x0e,0xff,0x0d,0x05,0x09,0xff,0x26,0x1f,0x22,0xff,0xe2,0xe1,0xe1,0xac,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xd4,0xcf,0xcb,0x3e,0x6c,0x5b,0x4d,0xff,0x73,0x63,0x56,0xff,0x76,0x66,0x58,0xff,0x78,0x68,0x5a,0xff,0x7a,0x6b,0x5b,0xff,0x7d,0x6d,0x5d,0xff,0x7e,0x6f,0x60,0xff,0x82,0x73,0x63,0xff,0x85,0x74,0x62,0xff,0x88,0x75,0x65,0xff,0x8c,0x78,0x69,0xff,0x8e,0x7b,0x69,0xff,0x90,0x7d,0x6b,0xff,0x95,0x7d,0x6d,0xff,0x99,0x7e,0x70,0xff,0x97,0x81,0x71,0xff,0x99,0x84,0x73,0xff,0x9d,0x87,0x75,0xff,0x9e,0x87,0x76,0xff,0x9c,0x87,0x76,0xff,0x9f,0x89,0x78,0xff,0xa1,0x8c,0x79,0xff,0x9f,0x8a,0x78,0xff,0xa1,0x8c,0x79,0xff,0xa3,0x8f,0x7b,0xff,0xa3,0x90,0x7d,0xff,0xa3,0x91,0x7e,0xff,0xa4,0x92,0x7f,0xff,0xa6,0x94,0x7f,0xff,0xa7,0x93,0x80,0xff,0xab,0x98,0x83,0xff,0xae,0x9b,0x86,0xff,0x90,0x7f,0x74,0xff,0x69,0x5e,0x5e,0xff,0x65,0x5a,0x5d,0xff,0x4f,0x44,0x49,0xff,0x39,0x2d,0x34,0xff,0x44,0x35,0x3e,0xff,0x35,0x26,0x32,0xff,0x2b,0x1c,0x27,0xff,0x1f,0x11,0x1d,0xff,0x19,0x0c,0x1a,0xff,0x1a,0x11,0x1e,0xff,0x1b,0x0e,0x1c,0xff,0x1e,0x11,0x22,0xff,0x16,0x0c,0x1b,0xff,0x18,0x0e,0x1a,0xff,0x12,0x0a,0x14,0xff,0x0b,0x03,0x0d,0xff,0x0c,0x05,0x0f,0xff,0x0a,0x05,0x0d,0xff,0x0d,0x09,0x11,0xff,0x0c,0x06,0x10,0xff,0x0b,0x04,0x0d,0xff,0x0c,0x04,0x0f,0xff,0x0d,0x05,0x0f,0xff,0x0d,0x05,0x0f,0xff,0x0d,0x05,0x0d,0xff,0x0d,0x05,0x0e,0xff,0x0c,0x04,0x0e,0xff,0x0c,0x05,0x0d,0xff,0x0b,0x04,0x0e,0xff,0x0b,0x05,0x10,0xff,0x0c,0x07,0x10,0xff,0x09,0x04,0x0c,0xff,0x1b,0x13,0x29,0xff,0x41,0x3b,0x60,0xff,0x41,0x3f,0x65,0xff,0x47,0x43,0x6b,0xff,0x4f,0x4c,0x74,0xff,0x51,0x51,0x79,0xff,0x54,0x57,0x80,0xff,0x56,0x5b,0x83,0xff,0x5d,0x63,0x8b,0xff,0x65,0x6d,0x94,0xff,0x6b,0x77,0xa5,0xff,0x72,0x7e,0xae,0xff,0x7c,0x8e,0xbd,0xff,0x86,0x9a,0xcc,0xff,0x92,0xa7,0xd9,0xff,0x99,0xaf,0xdd,0xff,0x9a,0xb3,0xdb,0xff,0xa9,0xc1,0xe9,0xff,0xba,0xd2,0xf6,0xff,0xbb,0xd0,0xfb,0xff,0xa2,0xb3,0xef,0xff,0x87,0x96,0xe5,0xff,0x7e,0x89,0xe2,0xff,0x79,0x7d,0xde,0xff,0x75,0x77,0xdc,0xff,0x7a,0x7f,0xe0,0xff,0x81,0x83,0xd7,0xff,0x7e,0x79,0xce,0xff,0x69,0x62,0xb4,0xff,0x5f,0x5c,0xa3,0xff,0x3a,0x3b,0x80,0xff,0x36,0x35,0x78,0xff,0x4a,0x4b,0x7c,0xff,0x45,0x49,0x65,0xff,0x43,0x48,0x64,0xff,0x51,0x56,0x76,0xff,0x49,0x4b,0x65,0xff,0x34,0x32,0x48,0xff,0x21,0x1f,0x2e,0xff,0x14,0x0d,0x17,0xff,0x2b,0x21,0x2b,0xff,0x28,0x1e,0x24,0xff,0x3d,0x32,0x35,0xff,0x46,0x39,0x3c,0xff,0x46,0x39,0x3d,0xff,0x3f,0x32,0x36,0xff,0x34,0x26,0x2b,0xff,0x34,0x27,0x2c,0xff,0x26,0x19,0x1e,0xff,0x3a,0x2e,0x32,0xff,0x47,0x3a,0x3b,0xff,0x66,0x5c,0x58,0xff,0x52,0x48,0x45,0xff,0x2c,0x1f,0x21,0xff,0x1b,0x0e,0x13,0xff,0x17,0x09,0x10,0xff,0x18,0x0c,0x10,0xff,0x1e,0x13,0x18,0xff,0x1a,0x0d,0x14,0xff,0x0f,0x06,0x0c,0xff,0x0f,0x09,0x0b,0xff,0x18,0x0e,0x11,0xff,0x20,0x14,0x18,0xff,0x28,0x1a,0x1b,0xff,0x34,0x26,0x23,0xff,0x2c,0x1e,0x1c,0xff,0x24,0x19,0x19,0xff,0x20,0x16,0x17,0xff,0x24,0x19,0x1a,0xff,0x25,0x1a,0x1c,0xff,0x20,0x16,0x18,0xff,0x1e,0x13,0x12,0xff,0x17,0x0e,0x0f,0xff,0x16,0x0e,0x12,0xff,0x13,0x0b,0x10,0xff,0x11,0x08,0x0c,0xff,0x2f,0x28,0x2a,0xff,0xe7,0xe6,0xe6,0x98,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xd9,0xd5,0xd1,0x2d,0x6f,0x5e,0x53,0xf9,0x71,0x62,0x52,0xff,0x76,0x67,0x58,0xff,0x79,0x69,0x5c,0xff,0x7b,0x6c,0x5c,0xff,0x7b,0x6c,0x5c,0xff,0x80,0x70,0x61,0xff,0x83,0x72,0x62,0xff,0x85,0x74,0x62,0xff,0x89,0x76,0x65,0xff,0x8c,0x79,0x67,0xff,0x8e,0x7c,0x6a,0xff,0x92,0x7d,0x6c,0xff,0x95,0x7f,0x6e,0xff,0x96,0x80,0x6f,0xff,0x98,0x82,0x71,0xff,0x9b,0x83,0x73,0xff,0x9e,0x86,0x75,0xff,0x9e,0x89,0x75,0xff,0x9c,0x89,0x76,0xff,0x95,0x81,0x70,0xff,0x9c,0x85,0x75,0xff,0xa2,0x8d,0x7b,0xff,0xa7,0x93,0x7e,0xff,0xa1,0x8e,0x78,0xff,0xa1,0x8f,0x7a,0xff,0xa3,0x90,0x7d,0xff,0xa5,0x92,0x7e,0xff,0xa6,0x95,0x7e,0xff,0xac,0x99,0x84,0xff,0xac,0x98,0x84,0xff,0x82,0x73,0x68,0xff,0x5a,0x4f,0x50,0xff,0x5b,0x4f,0x53,0xff,0x43,0x36,0x3a,0xff,0x3e,0x30,0x35,0xff,0x37,0x26,0x30,0xff,0x34,0x22,0x2d,0xff,0x2e,0x1e,0x2a,0xff,0x1d,0x10,0x1b,0xff,0x1d,0x11,0x1c,0xff,0x1b,0x10,0x1b,0xff,0x20,0x15,0x21,0xff,0x19,0x0e,0x1a,0xff,0x13,0x0a,0x15,0xff,0x15,0x0d,0x18,0xff,0x11,0x09,0x13,0xff,0x0d,0x08,0x0e,0xff,0x0b,0x06,0x0d,0xff,0x0c,0x06,0x0e,0xff,0x0f,0x07,0x10,0xff,0x0d,0x08,0x10,0xff,0x0b,0x06,0x0e,0xff,0x09,0x05,0x0c,0xff,0x09,0x04,0x0c,0xff,0x0b,0x05,0x0d,0xff,0x0c,0x05,0x0d,0xff,0x0b,0x04,0x0d,0xff,0x0a,0x03,0x0a,0xff,0x0a,0x04,0x0a,0xff,0x0c,0x05,0x0d,0xff,0x0c,0x05,0x0f,0xff,0x0c,0x04,0x0f,0xff,0x0d,0x07,0x11,0xff,0x0a,0x06,0x0f,0xff,0x07,0x04,0x0c,0xff,0x27,0x22,0x39,0xff,0x3e,0x37,0x5f,0xff,0x3b,0x37,0x5e,0xff,0x44,0x41,0x68,0xff,0x48,0x49,0x6f,0xff,0x4f,0x52,0x79,0xff,0x52,0x55,0x7e,0xff,0x57,0x5b,0x85,0xff,0x62,0x69,0x90,0xff,0x6e,0x78,0xa4,0xff,0x71,0x7b,0xaa,0xff,0x75,0x84,0xb4,0xff,0x7e,0x8f,0xc1,0xff,0x80,0x92,0xc3,0xff,0x74,0x81,0xae,0xff,0x69,0x77,0x9e,0xff,0x74,0x82,0xae,0xff,0x79,0x81,0xc1,0xff,0x5d,0x5f,0xb5,0xff,0x3e,0x3d,0x9e,0xff,0x3f,0x3e,0x99,0xff,0x53,0x51,0xa8,0xff,0x64,0x61,0xb6,0xff,0x61,0x5d,0xb2,0xff,0x56,0x52,0xa4,0xff,0x47,0x37,0x8b,0xff,0x41,0x35,0x83,0xff,0x3c,0x32,0x71,0xff,0x27,0x1d,0x58,0xff,0x19,0x0f,0x49,0xff,0x11,0x09,0x39,0xff,0x0b,0x06,0x2e,0xff,0x19,0x17,0x39,0xff,0x30,0x2e,0x4a,0xff,0x3b,0x39,0x57,0xff,0x34,0x34,0x4d,0xff,0x25,0x24,0x3a,0xff,0x0e,0x0b,0x1b,0xff,0x20,0x17,0x21,0xff,0x2f,0x24,0x2d,0xff,0x39,0x2e,0x33,0xff,0x43,0x37,0x3b,0xff,0x2c,0x1e,0x23,0xff,0x3a,0x2c,0x33,0xff,0x41,0x32,0x3a,0xff,0x21,0x13,0x1a,0xff,0x1d,0x10,0x15,0xff,0x20,0x14,0x17,0xff,0x21,0x13,0x17,0xff,0x23,0x14,0x18,0xff,0x30,0x24,0x23,0xff,0x3a,0x2d,0x2b,0xff,0x3a,0x2d,0x2c,0xff,0x13,0x0a,0x0b,0xff,0x1d,0x10,0x15,0xff,0x1c,0x12,0x15,0xff,0x16,0x0f,0x14,0xff,0x19,0x0c,0x13,0xff,0x15,0x09,0x10,0xff,0x0d,0x06,0x0a,0xff,0x20,0x16,0x18,0xff,0x34,0x25,0x25,0xff,0x35,0x25,0x26,0xff,0x26,0x19,0x1b,0xff,0x10,0x08,0x0b,0xff,0x0a,0x04,0x06,0xff,0x07,0x02,0x04,0xff,0x0d,0x08,0x0a,0xff,0x14,0x0e,0x0f,0xff,0x1e,0x15,0x16,0xff,0x1e,0x14,0x16,0xff,0x1e,0x12,0x16,0xff,0x18,0x0e,0x12,0xff,0x16,0x0c,0x10,0xff,0x0d,0x03,0x07,0xff,0x3f,0x37,0x38,0xff,0xee,0xed,0xed,0x83,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xdf,0xdb,0xd8,0x1d,0x73,0x64,0x56,0xf2,0x71,0x61,0x51,0xff,0x76,0x66,0x57,0xff,0x79,0x6a,0x5b,0xff,0x7a,0x6b,0x5b,0xff,0x7e,0x6e,0x5e,0xff,0x80,0x6f,0x5f,0xff,0x82,0x71,0x60,0xff,0x84,0x74,0x62,0xff,0x8a,0x78,0x66,0xff,0x8b,0x78,0x67,0xff,0x90,0x7c,0x6a,0xff,0x92,0x7d,0x6a,0xff,0x94,0x7f,0x6d,0xff,0x96,0x81,0x6f,0xff,0x99,0x84,0x71,0xff,0x9a,0x84,0x73,0xff,0x9c,0x85,0x75,0xff,0x9d,0x88,0x76,0xff,0xa1,0x8c,0x7a,0xff,0x8e,0x7b,0x69,0xff,0x83,0x6e,0x5f,0xff,0x77,0x63,0x56,0xff,0x7b,0x67,0x59,0xff,0xa6,0x94,0x80,0xff,0xa4,0x92,0x7d,0xff,0xa5,0x92,0x7f,0xff,0xa7,0x95,0x7f,0xff,0xb1,0x9e,0x86,0xff,0x9d,0x90,0x7f,0xff,0x6c,0x5f,0x57,0xff,0x48,0x3d,0x3f,0xff,0x62,0x57,0x5b,0xff,0x42,0x35,0x39,0xff,0x30,0x22,0x29,0xff,0x1f,0x11,0x1a,0xff,0x2f,0x1f,0x29,0xff,0x29,0x18,0x24,0xff,0x25,0x15,0x21,0xff,0x1e,0x13,0x1f,0xff,0x13,0x0c,0x17,0xff,0x15,0x0d,0x17,0xff,0x0f,0x08,0x10,0xff,0x0c,0x06,0x0c,0xff,0x0e,0x09,0x11,0xff,0x0f,0x08,0x11,0xff,0x0c,0x05,0x0c,0xff,0x0c,0x08,0x0d,0xff,0x0b,0x07,0x0d,0xff,0x0a,0x06,0x0c,0xff,0x0c,0x06,0x0d,0xff,0x09,0x03,0x0b,0xff,0x0b,0x05,0x0d,0xff,0x0b,0x06,0x0c,0xff,0x09,0x04,0x0a,0xff,0x08,0x03,0x09,0xff,0x0a,0x03,0x09,0xff,0x0a,0x03,0x0a,0xff,0x08,0x01,0x09,0xff,0x0b,0x04,0x0b,0xff,0x0d,0x06,0x0f,0xff,0x0a,0x04,0x0c,0xff,0x0b,0x03,0x0c,0xff,0x0c,0x06,0x10,0xff,0x0b,0x06,0x11,0xff,0x08,0x04,0x0c,0xff,0x08,0x05,0x0b,0xff,0x2c,0x26,0x43,0xff,0x3b,0x33,0x5b,0xff,0x3e,0x3a,0x61,0xff,0x44,0x42,0x68,0xff,0x4c,0x4d,0x73,0xff,0x4c,0x4f,0x78,0xff,0x4e,0x52,0x7d,0xff,0x57,0x5c,0x86,0xff,0x63,0x69,0x95,0xff,0x6c,0x75,0xa2,0xff,0x6f,0x7e,0xab,0xff,0x71,0x82,0xae,0xff,0x6e,0x7e,0xaa,0xff,0x5b,0x62,0x8d,0xff,0x27,0x27,0x5f,0xff,0x13,0x0e,0x5b,0xff,0x17,0x0d,0x6b,0xff,0x10,0x0a,0x5d,0xff,0x15,0x0f,0x57,0xff,0x15,0x0d,0x52,0xff,0x12,0x0b,0x4f,0xff,0x1d,0x13,0x60,0xff,0x22,0x16,0x64,0xff,0x1f,0x16,0x59,0xff,0x1a,0x12,0x4b,0xff,0x11,0x0c,0x41,0xff,0x02,0x00,0x33,0xff,0x03,0x00,0x42,0xff,0x15,0x0b,0x59,0xff,0x14,0x0d,0x4b,0xff,0x2a,0x2b,0x5a,0xff,0x4f,0x50,0x7a,0xff,0x2d,0x2c,0x47,0xff,0x2c,0x2a,0x45,0xff,0x2a,0x2a,0x42,0xff,0x16,0x17,0x27,0xff,0x0f,0x0a,0x14,0xff,0x2f,0x24,0x2d,0xff,0x3c,0x30,0x36,0xff,0x32,0x28,0x2d,0xff,0x3a,0x2f,0x33,0xff,0x41,0x33,0x38,0xff,0x1f,0x12,0x18,0xff,0x29,0x1d,0x24,0xff,0x19,0x0d,0x13,0xff,0x23,0x18,0x1b,0xff,0x33,0x26,0x28,0xff,0x29,0x1b,0x1c,0xff,0x2e,0x1d,0x20,0xff,0x37,0x25,0x29,0xff,0x31,0x1f,0x22,0xff,0x1e,0x11,0x12,0xff,0x0c,0x05,0x06,0xff,0x20,0x14,0x17,0xff,0x24,0x18,0x1d,0xff,0x10,0x06,0x0c,0xff,0x23,0x16,0x1c,0xff,0x23,0x16,0x1a,0xff,0x07,0x02,0x05,0xff,0x15,0x0d,0x0f,0xff,0x26,0x19,0x1c,0xff,0x1a,0x0e,0x14,0xff,0x0f,0x04,0x0b,0xff,0x17,0x0d,0x11,0xff,0x1e,0x15,0x19,0xff,0x14,0x0c,0x10,0xff,0x0b,0x04,0x07,0xff,0x0c,0x06,0x07,0xff,0x10,0x0a,0x0b,0xff,0x0f,0x08,0x0b,0xff,0x19,0x11,0x14,0xff,0x23,0x1b,0x1c,0xff,0x16,0x0e,0x10,0xff,0x0e,0x06,0x08,0xff,0x47,0x41,0x42,0xff,0xf2,0xf2,0xf2,0x6f,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xe6,0xe3,0xe0,0x11,0x76,0x68,0x59,0xec,0x72,0x62,0x53,0xff,0x75,0x66,0x57,0xff,0x77,0x68,0x58,0xff,0x7b,0x6b,0x5b,0xff,0x7f,0x6e,0x5e,0xff,0x80,0x6f,0x5e,0xff,0x83,0x72,0x60,0xff,0x85,0x74,0x63,0xff,0x89,0x77,0x66,0xff,0x8b,0x77,0x67,0xff,0x90,0x7a,0x6a,0xff,0x93,0x7e,0x6b,0xff,0x95,0x80,0x6c,0xff,0x95,0x81,0x6d,0xff,0x98,0x83,0x70,0xff,0x99,0x84,0x72,0xff,0x9c,0x86,0x74,0xff,0x9c,0x87,0x76,0xff,0xa0,0x8b,0x78,0xff,0x85,0x71,0x60,0xff,0x68,0x54,0x47,0xff,0x83,0x71,0x64,0xff,0x54,0x41,0x3a,0xff,0x60,0x4e,0x46,0xff,0xa1,0x8f,0x7c,0xff,0xa3,0x92,0x7b,0xff,0xad,0x99,0x85,0xff,0x8d,0x7f,0x72,0xff,0x57,0x4e,0x4d,0xff,0x55,0x4c,0x4f,0xff,0x51,0x45,0x48,0xff,0x4d,0x40,0x43,0xff,0x33,0x25,0x2a,0xff,0x2e,0x1f,0x26,0xff,0x2f,0x1f,0x29,0xff,0x20,0x10,0x1c,0xff,0x1c,0x0f,0x1a,0xff,0x18,0x0d,0x19,0xff,0x19,0x11,0x1c,0xff,0x0f,0x09,0x13,0xff,0x0f,0x08,0x12,0xff,0x0c,0x07,0x0f,0xff,0x0c,0x07,0x0d,0xff,0x0b,0x07,0x0f,0xff,0x0b,0x05,0x0c,0xff,0x0b,0x05,0x0a,0xff,0x08,0x04,0x09,0xff,0x09,0x05,0x0a,0xff,0x07,0x03,0x09,0xff,0x08,0x04,0x0b,0xff,0x0b,0x04,0x0b,0xff,0x0a,0x05,0x0b,0xff,0x07,0x04,0x08,0xff,0x05,0x01,0x07,0xff,0x07,0x01,0x07,0xff,0x09,0x02,0x08,0xff,0x08,0x02,0x09,0xff,0x0a,0x03,0x0b,0xff,0x0a,0x03,0x0b,0xff,0x0b,0x03,0x0d,0xff,0x0b,0x03,0x0c,0xff,0x0b,0x02,0x0c,0xff,0x0a,0x04,0x0e,0xff,0x09,0x04,0x0e,0xff,0x09,0x04,0x0c,0xff,0x06,0x02,0x05,0xff,0x0c,0x09,0x12,0xff,0x34,0x2c,0x52,0xff,0x38,0x33,0x5c,0xff,0x41,0x3d,0x64,0xff,0x46,0x44,0x6c,0xff,0x45,0x46,0x6e,0xff,0x46,0x49,0x73,0xff,0x52,0x56,0x80,0xff,0x59,0x5c,0x87,0xff,0x5b,0x64,0x8f,0xff,0x64,0x72,0x9d,0xff,0x69,0x78,0xa3,0xff,0x69,0x77,0xa6,0xff,0x8d,0x9c,0xcd,0xff,0x97,0xa0,0xd3,0xff,0x5c,0x57,0xa8,0xff,0x5e,0x50,0xb9,0xff,0x67,0x58,0xbc,0xff,0x56,0x4d,0xa1,0xff,0x39,0x32,0x84,0xff,0x24,0x1f,0x6f,0xff,0x11,0x0d,0x58,0xff,0x09,0x04,0x44,0xff,0x06,0x00,0x42,0xff,0x11,0x03,0x5e,0xff,0x21,0x10,0x7f,0xff,0x40,0x2d,0xa8,0xff,0x67,0x58,0xc6,0xff,0x83,0x79,0xda,0xff,0x6c,0x6c,0xb6,0xff,0x6c,0x73,0xa0,0xff,0x4a,0x4b,0x6a,0xff,0x33,0x30,0x4b,0xff,0x2b,0x28,0x43,0xff,0x22,0x20,0x39,0xff,0x09,0x08,0x15,0xff,0x19,0x0f,0x17,0xff,0x38,0x2c,0x34,0xff,0x44,0x38,0x3d,0xff,0x2e,0x25,0x29,0xff,0x41,0x38,0x3b,0xff,0x60,0x55,0x58,0xff,0x32,0x25,0x2a,0xff,0x10,0x05,0x0b,0xff,0x13,0x09,0x0f,0xff,0x1d,0x11,0x15,0xff,0x2f,0x1e,0x1f,0xff,0x3d,0x2c,0x2c,0xff,0x36,0x25,0x25,0xff,0x28,0x18,0x1a,0xff,0x27,0x16,0x19,0xff,0x20,0x16,0x16,0xff,0x13,0x0d,0x0e,0xff,0x21,0x15,0x19,0xff,0x28,0x1c,0x20,0xff,0x16,0x09,0x0f,0xff,0x22,0x15,0x1a,0xff,0x2e,0x21,0x23,0xff,0x0a,0x05,0x08,0xff,0x0d,0x08,0x0b,0xff,0x13,0x0c,0x0f,0xff,0x13,0x0b,0x11,0xff,0x12,0x09,0x0d,0xff,0x14,0x0b,0x0e,0xff,0x22,0x17,0x1b,0xff,0x27,0x1d,0x21,0xff,0x21,0x17,0x1a,0xff,0x22,0x16,0x18,0xff,0x21,0x15,0x17,0xff,0x1e,0x15,0x17,0xff,0x17,0x10,0x13,0xff,0x17,0x10,0x10,0xff,0x16,0x0f,0x10,0xff,0x0a,0x03,0x06,0xff,0x56,0x50,0x52,0xff,0xf9,0xf9,0xf9,0x5f,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xee,0xec,0xea,0x0a,0x7c,0x6c,0x60,0xe1,0x70,0x60,0x54,0xff,0x76,0x66,0x59,0xff,0x7a,0x6a,0x59,0xff,0x7c,0x6b,0x59,0xff,0x7c,0x6d,0x5d,0xff,0x7f,0x6f,0x60,0xff,0x83,0x72,0x62,0xff,0x86,0x75,0x63,0xff,0x88,0x76,0x65,0xff,0x8c,0x78,0x67,0xff,0x90,0x7a,0x69,0xff,0x91,0x7c,0x69,0xff,0x94,0x7e,0x6b,0xff,0x98,0x80,0x6d,0xff,0x96,0x80,0x6f,0xff,0x98,0x82,0x72,0xff,0x9b,0x86,0x73,0xff,0x99,0x84,0x70,0xff,0x9c,0x87,0x74,0xff,0x95,0x81,0x72,0xff,0x64,0x51,0x43,0xff,0x68,0x56,0x48,0xff,0x6b,0x5a,0x4e,0xff,0x25,0x13,0x14,0xff,0x69,0x56,0x50,0xff,0x86,0x77,0x62,0xff,0x75,0x65,0x59,0xff,0x4d,0x41,0x40,0xff,0x43,0x39,0x3a,0xff,0x4e,0x44,0x48,0xff,0x39,0x2d,0x33,0xff,0x29,0x1c,0x25,0xff,0x23,0x16,0x21,0xff,0x27,0x1a,0x25,0xff,0x26,0x19,0x24,0xff,0x1b,0x0f,0x1a,0xff,0x16,0x0c,0x17,0xff,0x19,0x0c,0x1a,0xff,0x1b,0x11,0x1e,0xff,0x15,0x0e,0x18,0xff,0x12,0x0a,0x15,0xff,0x10,0x09,0x12,0xff,0x0e,0x07,0x0f,0xff,0x0d,0x09,0x0e,0xff,0x08,0x04,0x09,0xff,0x09,0x05,0x0a,0xff,0x08,0x04,0x09,0xff,0x06,0x02,0x07,0xff,0x06,0x02,0x07,0xff,0x06,0x02,0x08,0xff,0x05,0x02,0x07,0xff,0x07,0x03,0x08,0xff,0x08,0x01,0x07,0xff,0x08,0x03,0x0a,0xff,0x09,0x03,0x0b,0xff,0x09,0x01,0x0a,0xff,0x09,0x03,0x09,0xff,0x0a,0x03,0x09,0xff,0x08,0x02,0x08,0xff,0x09,0x02,0x0a,0xff,0x0a,0x02,0x0a,0xff,0x0a,0x02,0x0a,0xff,0x09,0x01,0x0a,0xff,0x08,0x02,0x0b,0xff,0x08,0x03,0x0a,0xff,0x09,0x03,0x08,0xff,0x04,0x02,0x07,0xff,0x20,0x1f,0x3e,0xff,0x37,0x32,0x5c,0xff,0x38,0x33,0x5c,0xff,0x3f,0x3b,0x65,0xff,0x46,0x46,0x6f,0xff,0x45,0x46,0x6f,0xff,0x49,0x4b,0x74,0xff,0x4e,0x52,0x7b,0xff,0x56,0x5d,0x87,0xff,0x5d,0x67,0x91,0xff,0x67,0x73,0x9e,0xff,0x6f,0x7a,0xa8,0xff,0x6f,0x7b,0xb0,0xff,0x9f,0xae,0xe9,0xff,0xbc,0xc5,0xff,0xff,0xa8,0xac,0xf9,0xff,0xc0,0xbc,0xff,0xff,0xd8,0xd0,0xff,0xff,0xd8,0xd4,0xff,0xff,0xcb,0xc6,0xfc,0xff,0xae,0xa4,0xf1,0xff,0x8f,0x84,0xe1,0xff,0x7f,0x72,0xd9,0xff,0x93,0x89,0xed,0xff,0x9b,0x92,0xf4,0xff,0xa5,0x9e,0xf9,0xff,0xab,0xa5,0xff,0xff,0x95,0x93,0xf3,0xff,0x7d,0x82,0xce,0xff,0x51,0x53,0x7b,0xff,0x33,0x32,0x4f,0xff,0x33,0x33,0x50,0xff,0x29,0x29,0x45,0xff,0x12,0x0e,0x20,0xff,0x18,0x0f,0x1c,0xff,0x22,0x18,0x22,0xff,0x3d,0x33,0x3a,0xff,0x37,0x2d,0x33,0xff,0x45,0x3d,0x40,0xff,0x6f,0x67,0x68,0xff,0x5a,0x51,0x52,0xff,0x30,0x25,0x28,0xff,0x28,0x1b,0x1f,0xff,0x19,0x0e,0x13,0xff,0x23,0x13,0x1a,0xff,0x3e,0x28,0x27,0xff,0x42,0x2e,0x2b,0xff,0x50,0x3e,0x3c,0xff,0x48,0x36,0x35,0xff,0x40,0x2c,0x2d,0xff,0x27,0x1a,0x1b,0xff,0x0c,0x05,0x09,0xff,0x14,0x08,0x0f,0xff,0x18,0x0b,0x10,0xff,0x1e,0x11,0x15,0xff,0x1f,0x11,0x15,0xff,0x21,0x13,0x18,0xff,0x15,0x0b,0x11,0xff,0x13,0x09,0x0f,0xff,0x12,0x09,0x0d,0xff,0x12,0x09,0x0f,0xff,0x1e,0x14,0x1a,0xff,0x16,0x0c,0x11,0xff,0x1b,0x10,0x14,0xff,0x1a,0x10,0x14,0xff,0x27,0x1c,0x1f,0xff,0x27,0x1d,0x1e,0xff,0x27,0x1d,0x1e,0xff,0x2d,0x23,0x25,0xff,0x1c,0x13,0x14,0xff,0x0f,0x09,0x0b,0xff,0x11,0x0a,0x0e,0xff,0x07,0x00,0x02,0xff,0x62,0x5d,0x60,0xff,0xff,0xff,0xff,0x52,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xf7,0xf5,0xf5,0x00,0x88,0x7b,0x6d,0xbd,0x71,0x62,0x51,0xff,0x76,0x67,0x58,0xff,0x78,0x68,0x59,0xff,0x7c,0x6c,0x5c,0xff,0x7c,0x6e,0x5d,0xff,0x80,0x70,0x5f,0xff,0x82,0x71,0x60,0xff,0x85,0x73,0x61,0xff,0x8b,0x76,0x64,0xff,0x8d,0x78,0x65,0xff,0x8e,0x7a,0x65,0xff,0x90,0x7b,0x68,0xff,0x92,0x7c,0x6a,0xff,0x93,0x7d,0x6c,0xff,0x93,0x7d,0x6d,0xff,0x94,0x7e,0x6e,0xff,0x9a,0x85,0x72,0xff,0x9d,0x88,0x74,0xff,0x9c,0x87,0x74,0xff,0xa1,0x8d,0x7a,0xff,0x89,0x78,0x68,0xff,0x59,0x48,0x3f,0xff,0x69,0x5a,0x50,0xff,0x31,0x20,0x23,0xff,0x33,0x21,0x23,0xff,0x63,0x53,0x4e,0xff,0x5c,0x50,0x4f,0xff,0x45,0x3a,0x3b,0xff,0x4d,0x40,0x43,0xff,0x39,0x2b,0x32,0xff,0x1a,0x0e,0x19,0xff,0x1a,0x10,0x1b,0xff,0x11,0x08,0x13,0xff,0x0c,0x04,0x0f,0xff,0x0e,0x06,0x12,0xff,0x13,0x0b,0x16,0xff,0x0f,0x08,0x12,0xff,0x19,0x0f,0x1c,0xff,0x1b,0x12,0x1e,0xff,0x0f,0x07,0x11,0xff,0x0f,0x08,0x10,0xff,0x0e,0x08,0x10,0xff,0x0a,0x03,0x0a,0xff,0x06,0x02,0x05,0xff,0x06,0x02,0x07,0xff,0x07,0x03,0x08,0xff,0x06,0x02,0x07,0xff,0x05,0x01,0x06,0xff,0x05,0x01,0x05,0xff,0x06,0x02,0x05,0xff,0x07,0x03,0x08,0xff,0x06,0x02,0x07,0xff,0x07,0x02,0x09,0xff,0x07,0x01,0x09,0xff,0x09,0x02,0x0a,0xff,0x0a,0x03,0x09,0xff,0x09,0x03,0x09,0xff,0x08,0x01,0x08,0xff,0x09,0x02,0x09,0xff,0x09,0x02,0x09,0xff,0x09,0x03,0x07,0xff,0x09,0x03,0x07,0xff,0x09,0x03,0x07,0xff,0x06,0x01,0x07,0xff,0x06,0x01,0x07,0xff,0x07,0x01,0x07,0xff,0x04,0x01,0x03,0xff,0x1a,0x17,0x2e,0xff,0x2b,0x28,0x4f,0xff,0x36,0x31,0x57,0xff,0x3b,0x37,0x5f,0xff,0x45,0x43,0x6c,0xff,0x47,0x45,0x6f,0xff,0x45,0x46,0x6f,0xff,0x49,0x4e,0x76,0xff,0x50,0x56,0x7e,0xff,0x55,0x5d,0x85,0xff,0x5c,0x65,0x93,0xff,0x6f,0x79,0xa6,0xff,0x61,0x66,0x90,0xff,0x4e,0x59,0x90,0xff,0x8b,0x9a,0xde,0xff,0x98,0xa9,0xf7,0xff,0x87,0x91,0xf1,0xff,0xaa,0xae,0xfb,0xff,0xc4,0xc2,0xfe,0xff,0xcd,0xcd,0xfd,0xff,0xd3,0xd4,0xfd,0xff,0xc6,0xc7,0xfd,0xff,0xc1,0xbc,0xff,0xff,0xb7,0xb3,0xff,0xff,0x9f,0x9c,0xfe,0xff,0x99,0x94,0xfd,0xff,0x89,0x86,0xef,0xff,0x6a,0x6b,0xc2,0xff,0x49,0x47,0x7f,0xff,0x27,0x24,0x44,0xff,0x3d,0x3d,0x5d,0xff,0x34,0x37,0x59,0xff,0x19,0x1c,0x2f,0xff,0x18,0x11,0x18,0xff,0x36,0x2a,0x33,0xff,0x30,0x25,0x2d,0xff,0x44,0x3b,0x3f,0xff,0x52,0x4b,0x4d,0xff,0x68,0x60,0x62,0xff,0x73,0x6b,0x6c,0xff,0x5b,0x51,0x51,0xff,0x51,0x43,0x43,0xff,0x40,0x32,0x35,0xff,0x1a,0x10,0x13,0xff,0x26,0x14,0x1a,0xff,0x47,0x2f,0x30,0xff,0x45,0x33,0x2e,0xff,0x3c,0x2a,0x29,0xff,0x39,0x26,0x27,0xff,0x30,0x1d,0x1f,0xff,0x26,0x15,0x18,0xff,0x1f,0x12,0x15,0xff,0x31,0x24,0x25,0xff,0x2e,0x21,0x1e,0xff,0x2e,0x20,0x1e,0xff,0x33,0x23,0x23,0xff,0x24,0x15,0x18,0xff,0x18,0x0a,0x0f,0xff,0x14,0x09,0x0e,0xff,0x15,0x0d,0x12,0xff,0x1e,0x15,0x1b,0xff,0x1e,0x14,0x1a,0xff,0x19,0x0e,0x14,0xff,0x19,0x0d,0x12,0xff,0x19,0x0d,0x11,0xff,0x17,0x0b,0x0f,0xff,0x23,0x19,0x1c,0xff,0x1f,0x16,0x19,0xff,0x1b,0x14,0x15,0xff,0x1d,0x17,0x17,0xff,0x0e,0x0a,0x0a,0xff,0x12,0x0c,0x0e,0xff,0x0f,0x07,0x09,0xff,0x7e,0x7a,0x7b,0xfb,0xff,0xff,0xff,0x30,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfc,0xfc,0xfb,0x00,0x97,0x8c,0x7f,0xa1,0x70,0x61,0x4e,0xff,0x77,0x67,0x58,0xff,0x79,0x69,0x59,0xff,0x7c,0x6d,0x5d,0xff,0x7d,0x6e,0x5d,0xff,0x81,0x71,0x5f,0xff,0x83,0x72,0x60,0xff,0x85,0x74,0x62,0xff,0x8c,0x78,0x64,0xff,0x8e,0x79,0x66,0xff,0x8f,0x7a,0x68,0xff,0x90,0x7b,0x67,0xff,0x91,0x7d,0x69,0xff,0x93,0x7e,0x6d,0xff,0x88,0x72,0x61,0xff,0x7c,0x66,0x55,0xff,0x76,0x61,0x4f,0xff,0x8a,0x76,0x64,0xff,0xa3,0x8e,0x7b,0xff,0xa8,0x93,0x7e,0xff,0x8a,0x79,0x68,0xff,0x46,0x38,0x32,0xff,0x25,0x16,0x18,0xff,0x1d,0x0e,0x14,0xff,0x30,0x22,0x26,0xff,0x62,0x57,0x58,0xff,0x3e,0x32,0x36,0xff,0x49,0x3d,0x41,0xff,0x35,0x29,0x2e,0xff,0x1f,0x11,0x1b,0xff,0x1d,0x12,0x1c,0xff,0x15,0x0b,0x16,0xff,0x15,0x0d,0x16,0xff,0x0e,0x07,0x10,0xff,0x0d,0x06,0x10,0xff,0x10,0x08,0x13,0xff,0x12,0x0a,0x13,0xff,0x0f,0x07,0x10,0xff,0x0c,0x05,0x0d,0xff,0x0f,0x09,0x12,0xff,0x0e,0x09,0x11,0xff,0x11,0x09,0x11,0xff,0x0b,0x04,0x0d,0xff,0x08,0x05,0x0b,0xff,0x08,0x04,0x09,0xff,0x09,0x05,0x0b,0xff,0x06,0x02,0x08,0xff,0x05,0x01,0x07,0xff,0x05,0x01,0x06,0xff,0x06,0x03,0x05,0xff,0x07,0x03,0x08,0xff,0x05,0x02,0x06,0xff,0x05,0x03,0x06,0xff,0x08,0x03,0x06,0xff,0x07,0x02,0x06,0xff,0x08,0x02,0x05,0xff,0x07,0x02,0x05,0xff,0x07,0x02,0x05,0xff,0x07,0x02,0x05,0xff,0x08,0x03,0x06,0xff,0x09,0x02,0x07,0xff,0x09,0x02,0x08,0xff,0x09,0x02,0x08,0xff,0x07,0x03,0x08,0xff,0x07,0x03,0x08,0xff,0x07,0x03,0x08,0xff,0x04,0x00,0x04,0xff,0x14,0x12,0x22,0xff,0x25,0x22,0x47,0xff,0x20,0x1d,0x42,0xff,0x36,0x32,0x5a,0xff,0x3c,0x3b,0x61,0xff,0x46,0x44,0x6d,0xff,0x48,0x47,0x70,0xff,0x4b,0x4d,0x75,0xff,0x50,0x56,0x7d,0xff,0x55,0x5c,0x84,0xff,0x59,0x61,0x8c,0xff,0x63,0x6f,0x9b,0xff,0x64,0x70,0x9b,0xff,0x41,0x45,0x6a,0xff,0x30,0x2e,0x60,0xff,0x6d,0x72,0xbb,0xff,0x7f,0x84,0xda,0xff,0x64,0x6a,0xcb,0xff,0x7c,0x7b,0xe5,0xff,0x93,0x8f,0xfa,0xff,0x95,0x92,0xfb,0xff,0x93,0x93,0xf9,0xff,0x91,0x90,0xf9,0xff,0x87,0x84,0xf1,0xff,0x7c,0x76,0xe6,0xff,0x7b,0x6c,0xd9,0xff,0x55,0x4e,0x9e,0xff,0x3a,0x39,0x6b,0xff,0x22,0x1e,0x3f,0xff,0x36,0x39,0x58,0xff,0x4c,0x4e,0x6f,0xff,0x29,0x2a,0x49,0xff,0x12,0x0e,0x1e,0xff,0x35,0x2a,0x35,0xff,0x3e,0x32,0x3c,0xff,0x33,0x29,0x2e,0xff,0x3e,0x37,0x38,0xff,0x71,0x6c,0x6c,0xff,0x78,0x71,0x72,0xff,0x46,0x3d,0x3d,0xff,0x47,0x38,0x3a,0xff,0x3c,0x2a,0x2e,0xff,0x2c,0x1d,0x23,0xff,0x36,0x28,0x2e,0xff,0x2f,0x22,0x26,0xff,0x23,0x17,0x1c,0xff,0x27,0x16,0x1a,0xff,0x2d,0x1a,0x1e,0xff,0x26,0x16,0x19,0xff,0x31,0x21,0x24,0xff,0x32,0x21,0x24,0xff,0x36,0x26,0x28,0xff,0x2c,0x20,0x21,0xff,0x12,0x0a,0x0c,0xff,0x18,0x0f,0x13,0xff,0x21,0x17,0x1c,0xff,0x1a,0x0e,0x14,0xff,0x1b,0x0d,0x12,0xff,0x18,0x0e,0x11,0xff,0x14,0x0c,0x0f,0xff,0x13,0x09,0x0e,0xff,0x13,0x08,0x0d,0xff,0x18,0x0e,0x13,0xff,0x1b,0x12,0x16,0xff,0x1a,0x10,0x14,0xff,0x1b,0x10,0x14,0xff,0x21,0x14,0x18,0xff,0x1b,0x10,0x14,0xff,0x12,0x0a,0x0c,0xff,0x10,0x0a,0x0b,0xff,0x0d,0x09,0x09,0xff,0x14,0x0e,0x10,0xff,0x13,0x0e,0x0d,0xff,0xa0,0x9e,0x9d,0xef,0xff,0xff,0xff,0x17,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xa6,0x9c,0x92,0x8a,0x70,0x60,0x50,0xff,0x7a,0x68,0x59,0xff,0x7c,0x6b,0x5a,0xff,0x7e,0x6d,0x5b,0xff,0x80,0x6e,0x5f,0xff,0x80,0x6f,0x5e,0xff,0x83,0x73,0x60,0xff,0x84,0x73,0x62,0xff,0x8a,0x75,0x62,0xff,0x8d,0x78,0x66,0xff,0x8e,0x79,0x69,0xff,0x90,0x7c,0x68,0xff,0x92,0x7e,0x69,0xff,0x97,0x81,0x6e,0xff,0x95,0x81,0x6c,0xff,0x93,0x7e,0x6a,0xff,0x82,0x6d,0x5d,0xff,0x63,0x50,0x41,0xff,0x76,0x65,0x54,0xff,0x84,0x73,0x62,0xff,0x7c,0x6a,0x5b,0xff,0x66,0x54,0x4c,0xff,0x1e,0x10,0x14,0xff,0x16,0x06,0x0e,0xff,0x34,0x27,0x2d,0xff,0x50,0x48,0x4d,0xff,0x34,0x28,0x2f,0xff,0x3d,0x31,0x38,0xff,0x2a,0x1f,0x27,0xff,0x12,0x07,0x11,0xff,0x12,0x08,0x13,0xff,0x0e,0x07,0x0f,0xff,0x0d,0x07,0x0e,0xff,0x11,0x0a,0x13,0xff,0x0f,0x09,0x14,0xff,0x0e,0x0a,0x14,0xff,0x0f,0x09,0x12,0xff,0x0e,0x08,0x0f,0xff,0x0b,0x07,0x0e,0xff,0x0a,0x07,0x0d,0xff,0x06,0x02,0x0a,0xff,0x0b,0x06,0x0e,0xff,0x11,0x09,0x13,0xff,0x0f,0x07,0x0f,0xff,0x0b,0x05,0x0c,0xff,0x08,0x04,0x0b,0xff,0x07,0x03,0x09,0xff,0x06,0x02,0x08,0xff,0x06,0x02,0x08,0xff,0x06,0x02,0x08,0xff,0x07,0x03,0x08,0xff,0x07,0x03,0x08,0xff,0x06,0x03,0x08,0xff,0x06,0x03,0x08,0xff,0x08,0x03,0x08,0xff,0x0a,0x03,0x08,0xff,0x09,0x02,0x08,0xff,0x07,0x02,0x07,0xff,0x05,0x01,0x06,0xff,0x05,0x02,0x07,0xff,0x06,0x02,0x07,0xff,0x06,0x02,0x08,0xff,0x09,0x02,0x08,0xff,0x06,0x02,0x07,0xff,0x06,0x02,0x07,0xff,0x06,0x02,0x07,0xff,0x05,0x00,0x06,0xff,0x0b,0x08,0x14,0xff,0x2a,0x28,0x4b,0xff,0x19,0x18,0x3c,0xff,0x1e,0x1e,0x42,0xff,0x32,0x32,0x57,0xff,0x3c,0x3b,0x61,0xff,0x47,0x45,0x6c,0xff,0x4d,0x4d,0x73,0xff,0x58,0x5b,0x82,0xff,0x5c,0x61,0x8a,0xff,0x5c,0x65,0x8f,0xff,0x5a,0x65,0x92,0xff,0x61,0x6f,0x9a,0xff,0x59,0x65,0x8f,0xff,0x29,0x2a,0x51,0xff,0x1f,0x18,0x44,0xff,0x48,0x44,0x80,0xff,0x52,0x4d,0x90,0xff,0x4d,0x49,0x97,0xff,0x57,0x4f,0xad,0xff,0x61,0x57,0xbb,0xff,0x6a,0x61,0xc3,0xff,0x5e,0x58,0xb8,0xff,0x52,0x4f,0xa4,0xff,0x46,0x3f,0x8d,0xff,0x32,0x2a,0x69,0xff,0x19,0x16,0x3f,0xff,0x10,0x0f,0x2e,0xff,0x34,0x36,0x54,0xff,0x51,0x5d,0x7c,0xff,0x37,0x3b,0x5b,0xff,0x15,0x0d,0x24,0xff,0x2e,0x21,0x2c,0xff,0x51,0x46,0x4f,0xff,0x48,0x3f,0x46,0xff,0x57,0x50,0x53,0xff,0x7b,0x75,0x76,0xff,0x72,0x6c,0x6d,0xff,0x45,0x3d,0x3e,0xff,0x49,0x3c,0x3e,0xff,0x38,0x26,0x2a,0xff,0x2e,0x1e,0x24,0xff,0x0d,0x06,0x0d,0xff,0x17,0x09,0x12,0xff,0x2b,0x1c,0x23,0xff,0x13,0x08,0x11,0xff,0x1f,0x11,0x16,0xff,0x2d,0x1d,0x20,0xff,0x20,0x13,0x16,0xff,0x36,0x26,0x28,0xff,0x2d,0x1b,0x1f,0xff,0x27,0x17,0x1b,0xff,0x1c,0x0e,0x15,0xff,0x18,0x0d,0x14,0xff,0x1a,0x0f,0x15,0xff,0x1e,0x14,0x1a,0xff,0x1e,0x11,0x16,0xff,0x24,0x17,0x19,0xff,0x3a,0x2f,0x30,0xff,0x2b,0x21,0x24,0xff,0x30,0x25,0x29,0xff,0x19,0x10,0x13,0xff,0x12,0x0c,0x0e,0xff,0x11,0x0b,0x0d,0xff,0x0b,0x04,0x07,0xff,0x0e,0x07,0x0a,0xff,0x10,0x09,0x0c,0xff,0x13,0x0b,0x0e,0xff,0x11,0x0a,0x0d,0xff,0x12,0x0a,0x0e,0xff,0x0f,0x07,0x0b,0xff,0x11,0x0d,0x0e,0xff,0x12,0x0e,0x0e,0xff,0xb7,0xb5,0xb6,0xde,0xff,0xff,0xff,0x09,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xbb,0xb4,0xab,0x56,0x70,0x60,0x50,0xff,0x77,0x67,0x58,0xff,0x7a,0x6a,0x59,0xff,0x7e,0x6c,0x5b,0xff,0x7f,0x6e,0x5f,0xff,0x80,0x6f,0x5e,0xff,0x83,0x73,0x60,0xff,0x84,0x73,0x62,0xff,0x88,0x75,0x64,0xff,0x8c,0x78,0x67,0xff,0x8d,0x79,0x67,0xff,0x90,0x7a,0x67,0xff,0x92,0x7b,0x68,0xff,0x91,0x7a,0x69,0xff,0x88,0x73,0x62,0xff,0x73,0x63,0x55,0xff,0x60,0x51,0x45,0xff,0x58,0x48,0x3d,0xff,0x46,0x33,0x2d,0xff,0x51,0x3e,0x39,0xff,0x51,0x3e,0x37,0xff,0x34,0x23,0x22,0xff,0x1a,0x0d,0x11,0xff,0x2f,0x23,0x27,0xff,0x4e,0x42,0x48,0xff,0x39,0x2e,0x36,0xff,0x2e,0x21,0x29,0xff,0x27,0x1b,0x21,0xff,0x22,0x1a,0x20,0xff,0x0c,0x07,0x0e,0xff,0x0b,0x05,0x0d,0xff,0x0e,0x07,0x11,0xff,0x10,0x08,0x11,0xff,0x0a,0x04,0x0a,0xff,0x0a,0x05,0x0e,0xff,0x0f,0x09,0x13,0xff,0x12,0x0a,0x14,0xff,0x13,0x0a,0x14,0xff,0x14,0x0c,0x16,0xff,0x23,0x1b,0x25,0xff,0x29,0x1f,0x29,0xff,0x19,0x0f,0x19,0xff,0x1f,0x13,0x1e,0xff,0x1d,0x11,0x1c,0xff,0x17,0x0b,0x16,0xff,0x0b,0x07,0x0d,0xff,0x08,0x04,0x09,0xff,0x07,0x03,0x08,0xff,0x07,0x03,0x08,0xff,0x08,0x04,0x09,0xff,0x0a,0x06,0x0b,0xff,0x09,0x05,0x0a,0xff,0x08,0x04,0x0a,0xff,0x06,0x02,0x07,0xff,0x06,0x01,0x07,0xff,0x0a,0x04,0x0a,0xff,0x0c,0x05,0x0b,0xff,0x0a,0x04,0x0a,0xff,0x07,0x04,0x09,0xff,0x0a,0x03,0x09,0xff,0x07,0x03,0x08,0xff,0x06,0x02,0x07,0xff,0x06,0x01,0x07,0xff,0x05,0x01,0x07,0xff,0x06,0x01,0x07,0xff,0x07,0x04,0x08,0xff,0x08,0x04,0x08,0xff,0x06,0x03,0x09,0xff,0x27,0x23,0x47,0xff,0x21,0x20,0x46,0xff,0x14,0x13,0x36,0xff,0x1f,0x1e,0x43,0xff,0x32,0x30,0x58,0xff,0x39,0x37,0x5d,0xff,0x45,0x46,0x6a,0xff,0x58,0x58,0x80,0xff,0x5e,0x63,0x8b,0xff,0x5d,0x67,0x90,0xff,0x62,0x6e,0x9b,0xff,0x66,0x72,0xa0,0xff,0x6e,0x7a,0xa6,0xff,0x58,0x61,0x8d,0xff,0x25,0x26,0x4e,0xff,0x08,0x02,0x29,0xff,0x10,0x0a,0x32,0xff,0x18,0x13,0x40,0xff,0x1c,0x16,0x49,0xff,0x1e,0x17,0x4d,0xff,0x1a,0x14,0x48,0xff,0x13,0x0f,0x40,0xff,0x14,0x10,0x3c,0xff,0x12,0x0e,0x34,0xff,0x0d,0x0b,0x2a,0xff,0x0a,0x08,0x28,0xff,0x23,0x27,0x4a,0xff,0x50,0x5b,0x7c,0xff,0x50,0x5a,0x76,0xff,0x31,0x2f,0x43,0xff,0x5f,0x58,0x5e,0xff,0x6f,0x6b,0x6b,0xff,0x6b,0x67,0x66,0xff,0x67,0x60,0x63,0xff,0x83,0x7c,0x7d,0xff,0x66,0x5d,0x60,0xff,0x32,0x28,0x2d,0xff,0x4f,0x45,0x45,0xff,0x44,0x37,0x39,0xff,0x41,0x31,0x35,0xff,0x25,0x1a,0x1f,0xff,0x18,0x10,0x15,0xff,0x21,0x10,0x18,0xff,0x1d,0x0f,0x16,0xff,0x13,0x0a,0x11,0xff,0x17,0x0d,0x12,0xff,0x22,0x16,0x1a,0xff,0x17,0x0b,0x0d,0xff,0x29,0x1a,0x1d,0xff,0x31,0x22,0x24,0xff,0x25,0x14,0x18,0xff,0x22,0x14,0x19,0xff,0x16,0x0a,0x10,0xff,0x19,0x0d,0x13,0xff,0x23,0x13,0x19,0xff,0x2e,0x20,0x23,0xff,0x2a,0x1e,0x1e,0xff,0x2a,0x20,0x20,0xff,0x29,0x1d,0x1e,0xff,0x2e,0x21,0x22,0xff,0x38,0x2c,0x2d,0xff,0x28,0x21,0x22,0xff,0x0f,0x09,0x0c,0xff,0x09,0x04,0x07,0xff,0x0a,0x05,0x08,0xff,0x06,0x04,0x06,0xff,0x08,0x06,0x08,0xff,0x0f,0x0c,0x0d,0xff,0x0d,0x08,0x09,0xff,0x11,0x0b,0x0c,0xff,0x22,0x1b,0x1c,0xff,0x27,0x20,0x20,0xff,0xd6,0xd4,0xd4,0xb2,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xd0,0xcb,0xc5,0x37,0x76,0x66,0x56,0xff,0x78,0x68,0x57,0xff,0x7c,0x6b,0x59,0xff,0x7e,0x6d,0x5b,0xff,0x80,0x6e,0x5e,0xff,0x83,0x72,0x61,0xff,0x85,0x73,0x61,0xff,0x86,0x74,0x63,0xff,0x89,0x75,0x64,0xff,0x86,0x74,0x5e,0xff,0x86,0x74,0x64,0xff,0x89,0x72,0x68,0xff,0x79,0x64,0x56,0xff,0x64,0x53,0x3f,0xff,0x4d,0x3d,0x31,0xff,0x39,0x2b,0x2a,0xff,0x1e,0x11,0x17,0xff,0x21,0x12,0x19,0xff,0x2a,0x1c,0x22,0xff,0x30,0x22,0x26,0xff,0x3b,0x2e,0x31,0xff,0x4b,0x40,0x45,0xff,0x3a,0x33,0x35,0xff,0x4e,0x45,0x47,0xff,0x5a,0x50,0x53,0xff,0x39,0x2e,0x34,0xff,0x32,0x27,0x2e,0xff,0x10,0x09,0x0e,0xff,0x0c,0x05,0x0b,0xff,0x10,0x08,0x10,0xff,0x13,0x0c,0x14,0xff,0x27,0x1d,0x27,0xff,0x23,0x17,0x20,0xff,0x24,0x1b,0x23,0xff,0x33,0x27,0x30,0xff,0x31,0x21,0x2c,0xff,0x38,0x28,0x33,0xff,0x34,0x23,0x2f,0xff,0x35,0x26,0x31,0xff,0x39,0x2a,0x35,0xff,0x24,0x15,0x21,0xff,0x1d,0x10,0x1c,0xff,0x17,0x0a,0x16,0xff,0x17,0x0c,0x17,0xff,0x1a,0x0e,0x1a,0xff,0x0a,0x05,0x0d,0xff,0x08,0x05,0x0b,0xff,0x08,0x03,0x09,0xff,0x0d,0x08,0x0e,0xff,0x0a,0x06,0x0b,0xff,0x08,0x03,0x08,0xff,0x06,0x01,0x07,0xff,0x08,0x03,0x08,0xff,0x0a,0x06,0x0b,0xff,0x0a,0x04,0x0a,0xff,0x0c,0x04,0x0a,0xff,0x0a,0x02,0x0a,0xff,0x0a,0x04,0x0b,0xff,0x09,0x04,0x0a,0xff,0x0b,0x04,0x0a,0xff,0x09,0x02,0x0a,0xff,0x07,0x02,0x09,0xff,0x07,0x03,0x08,0xff,0x06,0x02,0x07,0xff,0x07,0x03,0x08,0xff,0x08,0x03,0x09,0xff,0x08,0x04,0x09,0xff,0x03,0x00,0x04,0xff,0x1d,0x1b,0x35,0xff,0x27,0x27,0x4d,0xff,0x1a,0x1a,0x3e,0xff,0x16,0x16,0x3a,0xff,0x23,0x21,0x47,0xff,0x35,0x33,0x57,0xff,0x39,0x37,0x5c,0xff,0x3f,0x3c,0x63,0xff,0x56,0x58,0x80,0xff,0x61,0x69,0x92,0xff,0x69,0x73,0xa0,0xff,0x71,0x81,0xae,0xff,0x74,0x84,0xb6,0xff,0x77,0x8a,0xbd,0xff,0x66,0x71,0xa4,0xff,0x37,0x3b,0x6c,0xff,0x12,0x14,0x43,0xff,0x08,0x04,0x36,0xff,0x05,0x00,0x33,0xff,0x04,0x00,0x32,0xff,0x07,0x04,0x31,0xff,0x0d,0x09,0x36,0xff,0x10,0x09,0x35,0xff,0x10,0x0d,0x34,0xff,0x16,0x13,0x3c,0xff,0x28,0x2b,0x57,0xff,0x4e,0x5d,0x86,0xff,0x69,0x75,0x96,0xff,0x61,0x63,0x74,0xff,0x56,0x4b,0x54,0xff,0x57,0x4f,0x52,0xff,0x4d,0x47,0x49,0xff,0x42,0x3c,0x3a,0xff,0x4a,0x42,0x42,0xff,0x58,0x4e,0x4f,0xff,0x32,0x29,0x2c,0xff,0x3a,0x31,0x37,0xff,0x47,0x3e,0x3e,0xff,0x47,0x3d,0x3c,0xff,0x49,0x3d,0x3e,0xff,0x3f,0x32,0x36,0xff,0x33,0x22,0x29,0xff,0x18,0x0c,0x12,0xff,0x0c,0x05,0x08,0xff,0x0f,0x07,0x0b,0xff,0x0c,0x03,0x0a,0xff,0x0e,0x05,0x0b,0xff,0x18,0x0c,0x11,0xff,0x30,0x21,0x25,0xff,0x33,0x22,0x25,0xff,0x27,0x17,0x1b,0xff,0x0d,0x05,0x09,0xff,0x08,0x05,0x09,0xff,0x0b,0x07,0x0c,0xff,0x0c,0x06,0x09,0xff,0x19,0x12,0x14,0xff,0x22,0x1a,0x1a,0xff,0x1d,0x14,0x14,0xff,0x1d,0x12,0x12,0xff,0x21,0x15,0x15,0xff,0x15,0x0a,0x0a,0xff,0x14,0x0c,0x0d,0xff,0x12,0x0b,0x0d,0xff,0x0d,0x08,0x0b,0xff,0x0e,0x09,0x0c,0xff,0x09,0x05,0x08,0xff,0x0a,0x07,0x09,0xff,0x10,0x0c,0x0d,0xff,0x0d,0x09,0x0a,0xff,0x0e,0x0a,0x0b,0xff,0x19,0x13,0x12,0xff,0x60,0x58,0x56,0xff,0xf1,0xf0,0xf0,0x95,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xe2,0xdf,0xdb,0x14,0x7c,0x6d,0x5e,0xe5,0x77,0x67,0x55,0xff,0x7d,0x6c,0x5a,0xff,0x7d,0x6c,0x5b,0xff,0x80,0x6f,0x5e,0xff,0x83,0x71,0x5f,0xff,0x87,0x71,0x60,0xff,0x89,0x75,0x63,0xff,0x88,0x73,0x63,0xff,0x84,0x7b,0x86,0xff,0x9e,0x98,0xbd,0xff,0xa5,0xa2,0xcf,0xff,0x94,0x8d,0xb3,0xff,0x72,0x67,0x67,0xff,0x52,0x45,0x34,0xff,0x3d,0x2e,0x2d,0xff,0x34,0x25,0x2f,0xff,0x19,0x0d,0x16,0xff,0x2d,0x22,0x2b,0xff,0x37,0x2a,0x33,0xff,0x32,0x25,0x2c,0xff,0x3e,0x34,0x3a,0xff,0x3d,0x33,0x37,0xff,0x3d,0x32,0x36,0xff,0x4f,0x45,0x48,0xff,0x3b,0x30,0x35,0xff,0x2e,0x22,0x2b,0xff,0x2c,0x20,0x29,0xff,0x39,0x2b,0x33,0xff,0x2d,0x20,0x29,0xff,0x29,0x1c,0x26,0xff,0x39,0x29,0x34,0xff,0x35,0x26,0x2f,0xff,0x30,0x23,0x2c,0xff,0x34,0x25,0x2e,0xff,0x41,0x30,0x3a,0xff,0x30,0x21,0x2a,0xff,0x2b,0x1c,0x27,0xff,0x21,0x13,0x1f,0xff,0x17,0x0a,0x15,0xff,0x1d,0x10,0x1b,0xff,0x1e,0x10,0x1c,0xff,0x1a,0x0c,0x17,0xff,0x22,0x14,0x20,0xff,0x12,0x08,0x12,0xff,0x0e,0x08,0x12,0xff,0x0b,0x07,0x0e,0xff,0x07,0x02,0x08,0xff,0x0a,0x05,0x0b,0xff,0x08,0x04,0x09,0xff,0x0a,0x05,0x09,0xff,0x0b,0x04,0x09,0xff,0x0c,0x05,0x0b,0xff,0x0e,0x07,0x0f,0xff,0x15,0x0d,0x16,0xff,0x13,0x09,0x11,0xff,0x0c,0x06,0x0d,0xff,0x0d,0x06,0x0e,0xff,0x0f,0x07,0x10,0xff,0x0f,0x08,0x10,0xff,0x09,0x02,0x09,0xff,0x09,0x03,0x09,0xff,0x07,0x03,0x08,0xff,0x08,0x03,0x09,0xff,0x09,0x05,0x09,0xff,0x09,0x04,0x0a,0xff,0x09,0x03,0x0b,0xff,0x04,0x00,0x05,0xff,0x15,0x13,0x28,0xff,0x27,0x28,0x4f,0xff,0x1c,0x1e,0x42,0xff,0x1a,0x19,0x3e,0xff,0x1a,0x19,0x3e,0xff,0x25,0x24,0x49,0xff,0x33,0x32,0x57,0xff,0x36,0x32,0x59,0xff,0x3d,0x3c,0x63,0xff,0x59,0x5e,0x87,0xff,0x68,0x72,0x9d,0xff,0x71,0x85,0xb3,0xff,0x78,0x90,0xc0,0xff,0x82,0x9a,0xcd,0xff,0x8d,0xa2,0xd5,0xff,0x86,0x9a,0xcb,0xff,0x6a,0x7c,0xad,0xff,0x58,0x5d,0x94,0xff,0x49,0x4a,0x83,0xff,0x3d,0x3f,0x76,0xff,0x42,0x45,0x79,0xff,0x46,0x48,0x7a,0xff,0x42,0x45,0x75,0xff,0x3d,0x43,0x71,0xff,0x4b,0x54,0x84,0xff,0x64,0x78,0xa5,0xff,0x70,0x7c,0x96,0xff,0x61,0x62,0x6d,0xff,0x42,0x39,0x42,0xff,0x28,0x1b,0x22,0xff,0x32,0x26,0x29,0xff,0x53,0x44,0x43,0xff,0x43,0x32,0x34,0xff,0x4b,0x3d,0x40,0xff,0x3f,0x35,0x37,0xff,0x56,0x4e,0x51,0xff,0x43,0x3c,0x40,0xff,0x46,0x3d,0x3d,0xff,0x53,0x47,0x49,0xff,0x38,0x29,0x2f,0xff,0x43,0x34,0x38,0xff,0x30,0x22,0x27,0xff,0x0c,0x07,0x0b,0xff,0x05,0x01,0x03,0xff,0x10,0x07,0x0b,0xff,0x18,0x0e,0x14,0xff,0x16,0x0a,0x11,0xff,0x16,0x0b,0x10,0xff,0x22,0x18,0x1b,0xff,0x21,0x16,0x1a,0xff,0x1e,0x12,0x17,0xff,0x0e,0x0a,0x0f,0xff,0x09,0x05,0x09,0xff,0x09,0x05,0x07,0xff,0x0c,0x07,0x0a,0xff,0x0f,0x08,0x0b,0xff,0x10,0x09,0x0c,0xff,0x16,0x0d,0x0f,0xff,0x20,0x15,0x17,0xff,0x27,0x1a,0x1c,0xff,0x23,0x16,0x19,0xff,0x13,0x0a,0x0c,0xff,0x0f,0x07,0x0b,0xff,0x0d,0x07,0x0a,0xff,0x0b,0x06,0x09,0xff,0x0c,0x07,0x09,0xff,0x14,0x0f,0x12,0xff,0x0e,0x09,0x0c,0xff,0x0c,0x06,0x0a,0xff,0x0d,0x08,0x0b,0xff,0x09,0x04,0x05,0xff,0x56,0x51,0x51,0xff,0xfd,0xfc,0xfc,0x5e,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xf4,0xf3,0xf2,0x00,0x8b,0x7f,0x72,0xc9,0x75,0x65,0x55,0xff,0x7c,0x6b,0x5a,0xff,0x7e,0x6d,0x5c,0xff,0x80,0x6f,0x5e,0xff,0x81,0x71,0x5f,0xff,0x84,0x72,0x60,0xff,0x8a,0x76,0x60,0xff,0x7b,0x70,0x74,0xff,0x98,0x9b,0xd7,0xff,0xb9,0xc0,0xec,0xff,0xb5,0xbf,0xe7,0xff,0xb1,0xbd,0xea,0xff,0x9d,0xa2,0xd1,0xff,0x4e,0x46,0x54,0xff,0x2a,0x1b,0x1e,0xff,0x1f,0x11,0x1b,0xff,0x25,0x19,0x22,0xff,0x2c,0x20,0x29,0xff,0x2d,0x20,0x28,0xff,0x2b,0x1d,0x23,0xff,0x28,0x1a,0x21,0xff,0x24,0x17,0x1d,0xff,0x2d,0x21,0x27,0xff,0x2a,0x1d,0x22,0xff,0x26,0x1a,0x1f,0xff,0x26,0x1a,0x20,0xff,0x39,0x2b,0x33,0xff,0x2f,0x20,0x28,0xff,0x2b,0x1c,0x23,0xff,0x2f,0x20,0x28,0xff,0x35,0x24,0x2d,0xff,0x2b,0x1b,0x25,0xff,0x11,0x05,0x0e,0xff,0x17,0x0b,0x13,0xff,0x38,0x2c,0x36,0xff,0x2e,0x21,0x2a,0xff,0x2c,0x1e,0x26,0xff,0x1d,0x0f,0x18,0xff,0x1b,0x0f,0x19,0xff,0x19,0x0d,0x18,0xff,0x1f,0x10,0x1c,0xff,0x2b,0x1b,0x27,0xff,0x24,0x16,0x21,0xff,0x10,0x08,0x13,0xff,0x0d,0x04,0x0f,0xff,0x10,0x09,0x12,0xff,0x11,0x0a,0x14,0xff,0x10,0x07,0x12,0xff,0x11,0x0a,0x13,0xff,0x11,0x0a,0x12,0xff,0x0d,0x05,0x10,0xff,0x0e,0x08,0x12,0xff,0x19,0x0c,0x19,0xff,0x17,0x0c,0x17,0xff,0x0f,0x07,0x11,0xff,0x13,0x0a,0x15,0xff,0x0f,0x06,0x11,0xff,0x11,0x09,0x14,0xff,0x11,0x09,0x13,0xff,0x0d,0x06,0x0d,0xff,0x0b,0x05,0x0a,0xff,0x08,0x04,0x0a,0xff,0x09,0x04,0x0c,0xff,0x0a,0x05,0x0c,0xff,0x0a,0x05,0x0c,0xff,0x09,0x05,0x0d,0xff,0x08,0x01,0x09,0xff,0x16,0x11,0x26,0xff,0x29,0x28,0x4f,0xff,0x1c,0x1b,0x42,0xff,0x1b,0x19,0x3f,0xff,0x1a,0x19,0x3d,0xff,0x1b,0x1d,0x41,0xff,0x23,0x25,0x4a,0xff,0x2e,0x2d,0x54,0xff,0x33,0x32,0x57,0xff,0x38,0x38,0x5d,0xff,0x51,0x55,0x7c,0xff,0x67,0x73,0x9f,0xff,0x73,0x86,0xba,0xff,0x87,0x9d,0xd1,0xff,0x94,0xac,0xde,0xff,0x98,0xb0,0xe0,0xff,0x9b,0xb0,0xdf,0xff,0x98,0xaa,0xd8,0xff,0x8f,0x9f,0xcf,0xff,0x86,0x95,0xc5,0xff,0x80,0x92,0xbf,0xff,0x81,0x91,0xbd,0xff,0x80,0x8f,0xbd,0xff,0x75,0x87,0xb7,0xff,0x7f,0x8e,0xc0,0xff,0x76,0x84,0x9e,0xff,0x49,0x45,0x4d,0xff,0x37,0x2a,0x30,0xff,0x40,0x34,0x39,0xff,0x38,0x2e,0x30,0xff,0x57,0x4e,0x4e,0xff,0x58,0x4b,0x46,0xff,0x38,0x27,0x29,0xff,0x47,0x3a,0x40,0xff,0x4d,0x44,0x47,0xff,0x3e,0x35,0x37,0xff,0x37,0x2c,0x30,0xff,0x34,0x27,0x2b,0xff,0x2a,0x1d,0x20,0xff,0x53,0x45,0x44,0xff,0x4b,0x3b,0x3c,0xff,0x2d,0x1e,0x22,0xff,0x14,0x0b,0x10,0xff,0x10,0x08,0x0d,0xff,0x15,0x0b,0x10,0xff,0x18,0x0d,0x13,0xff,0x1f,0x14,0x1a,0xff,0x17,0x0e,0x13,0xff,0x09,0x03,0x08,0xff,0x0c,0x05,0x0b,0xff,0x16,0x0b,0x12,0xff,0x22,0x16,0x1c,0xff,0x14,0x0c,0x12,0xff,0x11,0x0a,0x0f,0xff,0x12,0x0b,0x0e,0xff,0x20,0x18,0x1a,0xff,0x11,0x09,0x0d,0xff,0x0a,0x04,0x07,0xff,0x15,0x0e,0x0f,0xff,0x23,0x18,0x1a,0xff,0x17,0x0c,0x0f,0xff,0x19,0x0f,0x14,0xff,0x1e,0x14,0x18,0xff,0x1f,0x15,0x19,0xff,0x13,0x0b,0x0d,0xff,0x0d,0x09,0x09,0xff,0x12,0x0e,0x0f,0xff,0x17,0x12,0x15,0xff,0x10,0x0a,0x0e,0xff,0x0b,0x08,0x08,0xff,0x0f,0x0a,0x09,0xff,0x81,0x7c,0x7c,0xff,0xff,0xff,0xff,0x36,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xfe,0xfe,0x00,0x9e,0x94,0x88,0x8e,0x72,0x62,0x52,0xff,0x7c,0x6b,0x59,0xff,0x7d,0x6c,0x5a,0xff,0x80,0x6d,0x5d,0xff,0x82,0x70,0x60,0xff,0x87,0x72,0x62,0xff,0x81,0x6d,0x5c,0xff,0x56,0x54,0x76,0xff,0xa0,0xa6,0xda,0xff,0xb4,0xbe,0xe1,0xff,0xb3,0xbd,0xe4,0xff,0xb4,0xbe,0xe1,0xff,0xb3,0xbc,0xec,0xff,0x85,0x86,0xbf,0xff,0x23,0x16,0x27,0xff,0x1c,0x11,0x19,0xff,0x23,0x16,0x1f,0xff,0x16,0x08,0x12,0xff,0x15,0x09,0x11,0xff,0x1c,0x0f,0x16,0xff,0x23,0x15,0x1c,0xff,0x25,0x18,0x1f,0xff,0x23,0x15,0x1d,0xff,0x27,0x1a,0x21,0xff,0x26,0x19,0x20,0xff,0x1a,0x10,0x16,0xff,0x18,0x0f,0x14,0xff,0x22,0x14,0x1b,0xff,0x2b,0x1b,0x22,0xff,0x33,0x22,0x29,0xff,0x30,0x20,0x28,0xff,0x21,0x10,0x19,0xff,0x2d,0x1e,0x26,0xff,0x24,0x17,0x20,0xff,0x12,0x06,0x0e,0xff,0x1d,0x10,0x18,0xff,0x30,0x21,0x29,0xff,0x27,0x17,0x21,0xff,0x25,0x16,0x20,0xff,0x2a,0x1b,0x25,0xff,0x2c,0x1c,0x26,0xff,0x31,0x1f,0x2a,0xff,0x25,0x15,0x20,0xff,0x12,0x09,0x13,0xff,0x12,0x08,0x14,0xff,0x1e,0x13,0x22,0xff,0x24,0x17,0x2b,0xff,0x1d,0x11,0x22,0xff,0x16,0x0d,0x1a,0xff,0x11,0x07,0x13,0xff,0x1c,0x0f,0x1d,0xff,0x29,0x1a,0x28,0xff,0x2a,0x16,0x28,0xff,0x1d,0x0e,0x1d,0xff,0x1a,0x0e,0x1a,0xff,0x23,0x14,0x23,0xff,0x13,0x09,0x16,0xff,0x17,0x0f,0x1a,0xff,0x16,0x0c,0x18,0xff,0x14,0x0b,0x19,0xff,0x0e,0x07,0x13,0xff,0x0a,0x04,0x0d,0xff,0x0d,0x07,0x10,0xff,0x0a,0x05,0x0d,0xff,0x09,0x03,0x0c,0xff,0x07,0x01,0x09,0xff,0x1e,0x15,0x21,0xff,0x18,0x12,0x29,0xff,0x26,0x27,0x4b,0xff,0x1e,0x1e,0x44,0xff,0x16,0x16,0x39,0xff,0x18,0x16,0x39,0xff,0x18,0x17,0x3c,0xff,0x1d,0x1d,0x44,0xff,0x1f,0x1e,0x44,0xff,0x26,0x27,0x4a,0xff,0x32,0x31,0x55,0xff,0x3a,0x36,0x5e,0xff,0x49,0x48,0x73,0xff,0x60,0x66,0x96,0xff,0x76,0x85,0xb7,0xff,0x83,0x96,0xc9,0xff,0x8e,0xa5,0xd6,0xff,0x93,0xa9,0xd8,0xff,0x96,0xa9,0xd8,0xff,0x90,0xa4,0xd3,0xff,0x8b,0x9f,0xd0,0xff,0x90,0xa2,0xd3,0xff,0x8d,0x9d,0xcf,0xff,0x8c,0x9c,0xd1,0xff,0x8d,0x9f,0xce,0xff,0x72,0x7d,0x9a,0xff,0x45,0x3f,0x4a,0xff,0x4c,0x40,0x42,0xff,0x4f,0x45,0x46,0xff,0x5a,0x4e,0x4f,0xff,0x5f,0x54,0x52,0xff,0x54,0x4c,0x4a,0xff,0x4f,0x45,0x41,0xff,0x41,0x30,0x30,0xff,0x3f,0x31,0x35,0xff,0x4c,0x42,0x42,0xff,0x3b,0x30,0x33,0xff,0x37,0x29,0x2e,0xff,0x52,0x43,0x44,0xff,0x60,0x52,0x4c,0xff,0x51,0x43,0x40,0xff,0x3d,0x2e,0x2d,0xff,0x34,0x21,0x24,0xff,0x28,0x14,0x1a,0xff,0x2d,0x1a,0x20,0xff,0x24,0x15,0x1b,0xff,0x13,0x06,0x0d,0xff,0x16,0x0b,0x11,0xff,0x18,0x0e,0x15,0xff,0x18,0x0d,0x15,0xff,0x1f,0x0e,0x16,0xff,0x23,0x13,0x1a,0xff,0x2a,0x1d,0x22,0xff,0x20,0x14,0x19,0xff,0x1d,0x10,0x15,0xff,0x22,0x15,0x19,0xff,0x22,0x18,0x1c,0xff,0x0e,0x07,0x0a,0xff,0x0b,0x05,0x09,0xff,0x0b,0x06,0x08,0xff,0x1b,0x13,0x15,0xff,0x11,0x08,0x0c,0xff,0x0e,0x05,0x0a,0xff,0x14,0x0d,0x10,0xff,0x1a,0x11,0x14,0xff,0x1d,0x13,0x16,0xff,0x14,0x0d,0x0f,0xff,0x0b,0x06,0x08,0xff,0x07,0x02,0x03,0xff,0x11,0x0a,0x0c,0xff,0x0c,0x07,0x07,0xff,0x07,0x01,0x02,0xff,0xa8,0xa5,0xa6,0xe0,0xff,0xff,0xff,0x0f,0xff,0xfd,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xbb,0xb4,0xab,0x5d,0x74,0x64,0x52,0xff,0x7a,0x6a,0x57,0xff,0x7f,0x6d,0x5b,0xff,0x82,0x70,0x5e,0xff,0x84,0x70,0x5d,0xff,0x8c,0x77,0x5e,0xff,0x6b,0x5c,0x55,0xff,0x1b,0x1d,0x48,0xff,0x77,0x81,0xb2,0xff,0xaa,0xb3,0xd9,0xff,0xb1,0xb9,0xe2,0xff,0xb4,0xbc,0xe4,0xff,0xb5,0xba,0xe7,0xff,0xa4,0xab,0xe4,0xff,0x3d,0x3d,0x5b,0xff,0x27,0x1a,0x21,0xff,0x28,0x18,0x20,0xff,0x21,0x14,0x1d,0xff,0x1b,0x0e,0x16,0xff,0x24,0x16,0x1d,0xff,0x2d,0x20,0x25,0xff,0x20,0x13,0x18,0xff,0x20,0x12,0x18,0xff,0x2c,0x1f,0x25,0xff,0x2e,0x20,0x26,0xff,0x21,0x12,0x18,0xff,0x1e,0x0f,0x16,0xff,0x28,0x18,0x1f,0xff,0x37,0x27,0x2f,0xff,0x2d,0x1e,0x24,0xff,0x38,0x28,0x2f,0xff,0x2c,0x1c,0x23,0xff,0x2f,0x1f,0x26,0xff,0x27,0x19,0x21,0xff,0x25,0x16,0x20,0xff,0x21,0x12,0x1b,0xff,0x2b,0x1d,0x26,0xff,0x3f,0x2e,0x37,0xff,0x33,0x21,0x2a,0xff,0x39,0x27,0x31,0xff,0x35,0x23,0x2c,0xff,0x34,0x21,0x2b,0xff,0x38,0x26,0x32,0xff,0x1e,0x10,0x1c,0xff,0x27,0x1a,0x2a,0xff,0x2b,0x1d,0x31,0xff,0x22,0x14,0x2a,0xff,0x15,0x0c,0x18,0xff,0x12,0x08,0x14,0xff,0x22,0x15,0x23,0xff,0x31,0x21,0x30,0xff,0x26,0x16,0x25,0xff,0x26,0x16,0x25,0xff,0x2c,0x1a,0x2c,0xff,0x25,0x15,0x26,0xff,0x19,0x0e,0x1b,0xff,0x13,0x0b,0x17,0xff,0x15,0x0c,0x19,0xff,0x19,0x10,0x1b,0xff,0x14,0x0c,0x1a,0xff,0x12,0x0b,0x19,0xff,0x11,0x09,0x14,0xff,0x0d,0x07,0x11,0xff,0x08,0x03,0x0d,0xff,0x06,0x00,0x09,0xff,0x21,0x18,0x23,0xff,0x37,0x2d,0x3d,0xff,0x14,0x10,0x2a,0xff,0x27,0x28,0x48,0xff,0x24,0x23,0x48,0xff,0x13,0x14,0x36,0xff,0x13,0x11,0x33,0xff,0x15,0x13,0x36,0xff,0x1b,0x1b,0x3e,0xff,0x1f,0x1f,0x43,0xff,0x1c,0x1e,0x42,0xff,0x1e,0x20,0x43,0xff,0x2b,0x2a,0x4f,0xff,0x35,0x32,0x59,0xff,0x41,0x3e,0x67,0xff,0x4d,0x4f,0x7b,0xff,0x5e,0x65,0x93,0xff,0x71,0x7f,0xaf,0xff,0x7b,0x8a,0xbc,0xff,0x81,0x91,0xc3,0xff,0x84,0x94,0xc6,0xff,0x86,0x97,0xc9,0xff,0x84,0x96,0xc9,0xff,0x80,0x92,0xc6,0xff,0x81,0x8f,0xbe,0xff,0x6b,0x6f,0x8a,0xff,0x4d,0x4a,0x4f,0xff,0x3d,0x32,0x35,0xff,0x54,0x49,0x4a,0xff,0x68,0x5d,0x5b,0xff,0x45,0x39,0x3b,0xff,0x4f,0x43,0x42,0xff,0x5a,0x50,0x50,0xff,0x53,0x4a,0x46,0xff,0x5c,0x4b,0x47,0xff,0x3e,0x2c,0x2e,0xff,0x45,0x39,0x3a,0xff,0x2d,0x21,0x27,0xff,0x2c,0x1d,0x22,0xff,0x47,0x37,0x36,0xff,0x52,0x43,0x3e,0xff,0x35,0x24,0x25,0xff,0x2d,0x1c,0x1e,0xff,0x26,0x16,0x19,0xff,0x22,0x11,0x16,0xff,0x2a,0x19,0x1f,0xff,0x22,0x14,0x1a,0xff,0x10,0x04,0x0b,0xff,0x12,0x08,0x0e,0xff,0x0f,0x05,0x0e,0xff,0x14,0x0a,0x12,0xff,0x20,0x10,0x17,0xff,0x1e,0x10,0x14,0xff,0x25,0x17,0x1c,0xff,0x24,0x15,0x1a,0xff,0x22,0x15,0x19,0xff,0x21,0x15,0x17,0xff,0x18,0x0d,0x10,0xff,0x10,0x07,0x0b,0xff,0x16,0x0e,0x11,0xff,0x20,0x16,0x19,0xff,0x12,0x0b,0x0e,0xff,0x0e,0x07,0x0a,0xff,0x10,0x0a,0x0d,0xff,0x0d,0x08,0x0b,0xff,0x0d,0x07,0x09,0xff,0x1b,0x13,0x16,0xff,0x1e,0x17,0x1b,0xff,0x17,0x0f,0x13,0xff,0x13,0x0c,0x0d,0xff,0x12,0x0b,0x0c,0xff,0x0c,0x04,0x06,0xff,0x1e,0x17,0x19,0xff,0xd3,0xd2,0xd3,0xb9,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xd9,0xd3,0xcf,0x25,0x7a,0x69,0x58,0xf9,0x7b,0x6e,0x60,0xff,0x80,0x6e,0x60,0xff,0x82,0x6e,0x5e,0xff,0x82,0x71,0x5e,0xff,0x85,0x77,0x67,0xff,0x3e,0x39,0x51,0xff,0x0a,0x0b,0x38,0xff,0x35,0x40,0x74,0xff,0x98,0xa4,0xce,0xff,0xb8,0xbe,0xe6,0xff,0xb1,0xb8,0xe5,0xff,0xa8,0xb4,0xe1,0xff,0xa5,0xb0,0xec,0xff,0x67,0x69,0x94,0xff,0x2f,0x1f,0x28,0xff,0x2b,0x20,0x23,0xff,0x2b,0x20,0x25,0xff,0x27,0x1b,0x1f,0xff,0x4a,0x3e,0x40,0xff,0x3b,0x2f,0x31,0xff,0x23,0x16,0x19,0xff,0x30,0x25,0x27,0xff,0x41,0x35,0x37,0xff,0x3c,0x2e,0x30,0xff,0x2f,0x1f,0x23,0xff,0x2d,0x1e,0x23,0xff,0x2b,0x1d,0x23,0xff,0x2e,0x1f,0x24,0xff,0x3e,0x30,0x32,0xff,0x4c,0x3a,0x3d,0xff,0x34,0x27,0x2b,0xff,0x3b,0x2c,0x32,0xff,0x2c,0x1d,0x23,0xff,0x2e,0x21,0x28,0xff,0x2f,0x1f,0x27,0xff,0x24,0x12,0x1c,0xff,0x3f,0x2d,0x35,0xff,0x3a,0x29,0x2e,0xff,0x3d,0x29,0x31,0xff,0x3e,0x2a,0x32,0xff,0x32,0x20,0x28,0xff,0x1a,0x0d,0x16,0xff,0x26,0x17,0x25,0xff,0x32,0x23,0x33,0xff,0x28,0x1c,0x2d,0xff,0x20,0x17,0x28,0xff,0x0e,0x09,0x13,0xff,0x1e,0x10,0x1e,0xff,0x3e,0x2a,0x3b,0xff,0x2a,0x1b,0x2b,0xff,0x15,0x09,0x18,0xff,0x1f,0x11,0x21,0xff,0x3a,0x27,0x39,0xff,0x26,0x14,0x27,0xff,0x18,0x0d,0x1a,0xff,0x15,0x0d,0x19,0xff,0x11,0x0b,0x18,0xff,0x14,0x0d,0x1c,0xff,0x1a,0x11,0x20,0xff,0x17,0x0f,0x1d,0xff,0x11,0x0b,0x17,0xff,0x0c,0x06,0x11,0xff,0x06,0x03,0x09,0xff,0x25,0x18,0x1f,0xff,0x54,0x44,0x51,0xff,0x2e,0x27,0x3f,0xff,0x18,0x16,0x33,0xff,0x23,0x21,0x42,0xff,0x2c,0x2b,0x50,0xff,0x19,0x18,0x3a,0xff,0x13,0x12,0x35,0xff,0x12,0x12,0x33,0xff,0x16,0x15,0x37,0xff,0x1a,0x19,0x3d,0xff,0x1b,0x1d,0x41,0xff,0x1c,0x1e,0x42,0xff,0x17,0x17,0x3b,0xff,0x1a,0x18,0x3d,0xff,0x25,0x24,0x48,0xff,0x33,0x31,0x56,0xff,0x3b,0x39,0x60,0xff,0x44,0x44,0x6f,0xff,0x4c,0x4e,0x7d,0xff,0x5a,0x5d,0x8d,0xff,0x62,0x67,0x96,0xff,0x68,0x6f,0x9c,0xff,0x61,0x6a,0x9b,0xff,0x66,0x6c,0x93,0xff,0x68,0x65,0x78,0xff,0x4a,0x44,0x4e,0xff,0x41,0x36,0x3f,0xff,0x51,0x45,0x4a,0xff,0x44,0x3a,0x3c,0xff,0x53,0x49,0x49,0xff,0x88,0x7c,0x7c,0xff,0x82,0x77,0x76,0xff,0x4b,0x41,0x3d,0xff,0x4f,0x46,0x43,0xff,0x5c,0x4b,0x46,0xff,0x55,0x41,0x3f,0xff,0x51,0x40,0x41,0xff,0x2c,0x1d,0x22,0xff,0x3a,0x2b,0x2d,0xff,0x4a,0x3b,0x3a,0xff,0x34,0x22,0x24,0xff,0x2a,0x18,0x1d,0xff,0x27,0x16,0x1a,0xff,0x20,0x11,0x16,0xff,0x20,0x12,0x19,0xff,0x22,0x12,0x1b,0xff,0x1b,0x0e,0x15,0xff,0x15,0x0a,0x11,0xff,0x0f,0x08,0x0e,0xff,0x0e,0x06,0x0b,0xff,0x17,0x0e,0x14,0xff,0x14,0x0c,0x12,0xff,0x13,0x09,0x0f,0xff,0x1c,0x10,0x16,0xff,0x1b,0x11,0x13,0xff,0x1c,0x0f,0x14,0xff,0x1b,0x0f,0x13,0xff,0x18,0x0c,0x10,0xff,0x17,0x0c,0x10,0xff,0x15,0x0b,0x0d,0xff,0x1a,0x10,0x11,0xff,0x17,0x0d,0x0f,0xff,0x17,0x0d,0x11,0xff,0x1a,0x11,0x14,0xff,0x0c,0x05,0x09,0xff,0x0b,0x06,0x09,0xff,0x1e,0x1a,0x1d,0xff,0x17,0x12,0x16,0xff,0x0d,0x06,0x0a,0xff,0x0a,0x05,0x08,0xff,0x0b,0x06,0x09,0xff,0x08,0x01,0x05,0xff,0x49,0x42,0x46,0xff,0xf2,0xf1,0xf2,0x7c,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xef,0xee,0xee,0x02,0x8c,0x87,0xa4,0xcb,0x88,0x88,0xb4,0xff,0x7b,0x78,0x96,0xff,0x77,0x72,0x8e,0xff,0x8b,0x8a,0xaa,0xff,0x90,0x91,0xb7,0xff,0x78,0x7a,0xa9,0xff,0x44,0x48,0x74,0xff,0x15,0x19,0x4d,0xff,0x6f,0x78,0xb1,0xff,0xb5,0xbf,0xe7,0xff,0xb3,0xbf,0xe7,0xff,0xae,0xba,0xe7,0xff,0x9a,0xa5,0xe4,0xff,0x80,0x7f,0xb9,0xff,0x1f,0x14,0x20,0xff,0x34,0x2a,0x2b,0xff,0x47,0x3c,0x3c,0xff,0x4b,0x40,0x3f,0xff,0x42,0x37,0x37,0xff,0x48,0x3d,0x3d,0xff,0x2d,0x20,0x21,0xff,0x36,0x28,0x2b,0xff,0x3b,0x2e,0x2f,0xff,0x53,0x45,0x46,0xff,0x41,0x32,0x36,0xff,0x3f,0x32,0x35,0xff,0x39,0x2a,0x2d,0xff,0x43,0x33,0x35,0xff,0x46,0x37,0x37,0xff,0x4f,0x3f,0x40,0xff,0x4b,0x3d,0x3e,0xff,0x4a,0x3b,0x3e,0xff,0x37,0x28,0x2c,0xff,0x33,0x25,0x2a,0xff,0x2e,0x1e,0x25,0xff,0x33,0x21,0x29,0xff,0x31,0x20,0x26,0xff,0x46,0x35,0x3a,0xff,0x34,0x21,0x27,0xff,0x38,0x24,0x2a,0xff,0x45,0x33,0x3a,0xff,0x18,0x0a,0x14,0xff,0x23,0x14,0x21,0xff,0x35,0x26,0x35,0xff,0x27,0x1c,0x2d,0xff,0x1b,0x10,0x20,0xff,0x12,0x09,0x15,0xff,0x2b,0x1c,0x2c,0xff,0x2b,0x19,0x29,0xff,0x14,0x07,0x15,0xff,0x14,0x0b,0x16,0xff,0x24,0x17,0x28,0xff,0x3d,0x2b,0x3e,0xff,0x2c,0x1c,0x2e,0xff,0x14,0x0a,0x15,0xff,0x10,0x09,0x13,0xff,0x13,0x0c,0x19,0xff,0x1a,0x12,0x27,0xff,0x1e,0x12,0x2a,0xff,0x19,0x11,0x20,0xff,0x0a,0x08,0x12,0xff,0x04,0x01,0x09,0xff,0x25,0x18,0x1f,0xff,0x5c,0x46,0x4e,0xff,0x59,0x4a,0x5b,0xff,0x29,0x22,0x41,0xff,0x21,0x1e,0x3c,0xff,0x1f,0x1a,0x3a,0xff,0x2d,0x29,0x4e,0xff,0x1d,0x1a,0x3f,0xff,0x16,0x16,0x39,0xff,0x16,0x16,0x38,0xff,0x18,0x18,0x3b,0xff,0x19,0x18,0x3d,0xff,0x1a,0x1b,0x3f,0xff,0x19,0x1b,0x3f,0xff,0x17,0x18,0x3d,0xff,0x14,0x14,0x38,0xff,0x10,0x10,0x34,0xff,0x0f,0x0e,0x32,0xff,0x17,0x16,0x3a,0xff,0x1f,0x1c,0x42,0xff,0x2b,0x27,0x4d,0xff,0x2e,0x2a,0x51,0xff,0x2c,0x2c,0x53,0xff,0x24,0x20,0x47,0xff,0x3f,0x3b,0x56,0xff,0x5e,0x5b,0x63,0xff,0x4c,0x42,0x48,0xff,0x42,0x37,0x40,0xff,0x4f,0x43,0x4c,0xff,0x68,0x5e,0x61,0xff,0x77,0x6e,0x6f,0xff,0x63,0x59,0x59,0xff,0x5c,0x51,0x4f,0xff,0x93,0x88,0x84,0xff,0x73,0x66,0x62,0xff,0x50,0x43,0x41,0xff,0x45,0x34,0x31,0xff,0x5c,0x44,0x41,0xff,0x47,0x31,0x2e,0xff,0x43,0x30,0x30,0xff,0x3d,0x29,0x2c,0xff,0x31,0x1f,0x22,0xff,0x33,0x22,0x25,0xff,0x25,0x12,0x19,0xff,0x29,0x19,0x1f,0xff,0x28,0x18,0x1e,0xff,0x17,0x0a,0x11,0xff,0x0f,0x08,0x0f,0xff,0x0a,0x03,0x0a,0xff,0x1a,0x0f,0x16,0xff,0x11,0x09,0x0c,0xff,0x06,0x03,0x05,0xff,0x14,0x0e,0x12,0xff,0x10,0x09,0x0d,0xff,0x18,0x0e,0x13,0xff,0x18,0x0e,0x12,0xff,0x14,0x0b,0x0e,0xff,0x18,0x0d,0x10,0xff,0x1a,0x0d,0x12,0xff,0x19,0x0c,0x10,0xff,0x2b,0x1e,0x21,0xff,0x2e,0x22,0x24,0xff,0x29,0x1c,0x1e,0xff,0x25,0x16,0x18,0xff,0x27,0x1a,0x1c,0xff,0x14,0x09,0x0b,0xff,0x10,0x08,0x0c,0xff,0x0f,0x07,0x0b,0xff,0x0a,0x06,0x08,0xff,0x08,0x05,0x08,0xff,0x0a,0x05,0x08,0xff,0x06,0x02,0x06,0xff,0x07,0x03,0x06,0xff,0x00,0x00,0x00,0xff,0x75,0x72,0x73,0xff,0xff,0xff,0xff,0x3d,0xff,0xfd,0xfe,0x00,0xfe,0xf0,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xa9,0xac,0xd5,0x8f,0x65,0x68,0x9c,0xff,0x69,0x6e,0x97,0xff,0x87,0x8c,0xb6,0xff,0x87,0x8a,0xbd,0xff,0x96,0x98,0xcc,0xff,0xbb,0xbf,0xea,0xff,0xc1,0xc7,0xf1,0xff,0x56,0x5b,0x89,0xff,0x30,0x3b,0x77,0xff,0x9f,0xad,0xdc,0xff,0xbd,0xc8,0xe9,0xff,0xb9,0xc5,0xe9,0xff,0xa6,0xb4,0xe6,0xff,0x82,0x8c,0xc7,0xff,0x2d,0x25,0x36,0xff,0x30,0x23,0x25,0xff,0x32,0x27,0x28,0xff,0x3d,0x32,0x31,0xff,0x49,0x3e,0x3c,0xff,0x48,0x3d,0x3c,0xff,0x2b,0x1d,0x21,0xff,0x35,0x26,0x29,0xff,0x3e,0x30,0x2f,0xff,0x44,0x36,0x36,0xff,0x50,0x42,0x43,0xff,0x41,0x32,0x33,0xff,0x3e,0x2d,0x2e,0xff,0x58,0x48,0x48,0xff,0x4e,0x3e,0x3c,0xff,0x56,0x46,0x45,0xff,0x5b,0x4c,0x4c,0xff,0x48,0x38,0x3a,0xff,0x47,0x37,0x3b,0xff,0x49,0x3a,0x3e,0xff,0x2f,0x20,0x25,0xff,0x29,0x17,0x1f,0xff,0x3c,0x2a,0x2f,0xff,0x55,0x44,0x47,0xff,0x4d,0x39,0x3d,0xff,0x47,0x33,0x38,0xff,0x3d,0x2b,0x31,0xff,0x1f,0x0e,0x18,0xff,0x21,0x12,0x1e,0xff,0x35,0x27,0x35,0xff,0x25,0x17,0x27,0xff,0x25,0x17,0x27,0xff,0x18,0x0b,0x1b,0xff,0x27,0x18,0x2a,0xff,0x20,0x10,0x21,0xff,0x16,0x0c,0x19,0xff,0x19,0x11,0x1b,0xff,0x22,0x16,0x26,0xff,0x34,0x25,0x36,0xff,0x21,0x13,0x25,0xff,0x1b,0x11,0x21,0xff,0x14,0x0c,0x1a,0xff,0x0c,0x07,0x17,0xff,0x1a,0x14,0x2e,0xff,0x18,0x10,0x26,0xff,0x11,0x0a,0x18,0xff,0x04,0x03,0x0c,0xff,0x1d,0x13,0x18,0xff,0x5c,0x45,0x4b,0xff,0x71,0x62,0x6c,0xff,0x38,0x32,0x4f,0xff,0x2f,0x2e,0x4c,0xff,0x26,0x21,0x41,0xff,0x1c,0x17,0x37,0xff,0x2c,0x28,0x4c,0xff,0x21,0x1d,0x43,0xff,0x14,0x13,0x37,0xff,0x12,0x12,0x34,0xff,0x17,0x16,0x39,0xff,0x1e,0x1d,0x42,0xff,0x1f,0x20,0x44,0xff,0x1d,0x1e,0x43,0xff,0x1c,0x1c,0x43,0xff,0x17,0x18,0x3c,0xff,0x15,0x17,0x39,0xff,0x10,0x10,0x31,0xff,0x0d,0x0c,0x2d,0xff,0x0b,0x09,0x28,0xff,0x0b,0x09,0x26,0xff,0x09,0x08,0x23,0xff,0x04,0x05,0x1c,0xff,0x30,0x2a,0x3d,0xff,0x62,0x5c,0x65,0xff,0x57,0x52,0x56,0xff,0x3d,0x34,0x3c,0xff,0x41,0x36,0x3f,0xff,0x50,0x43,0x4e,0xff,0x4f,0x46,0x46,0xff,0x50,0x46,0x45,0xff,0x5a,0x4f,0x4f,0xff,0x56,0x4b,0x4a,0xff,0x75,0x69,0x64,0xff,0x63,0x54,0x51,0xff,0x59,0x4a,0x48,0xff,0x42,0x31,0x31,0xff,0x30,0x1d,0x1e,0xff,0x38,0x25,0x25,0xff,0x30,0x1e,0x20,0xff,0x28,0x16,0x1a,0xff,0x24,0x12,0x17,0xff,0x2f,0x1d,0x20,0xff,0x31,0x20,0x24,0xff,0x1a,0x0d,0x12,0xff,0x25,0x17,0x1b,0xff,0x18,0x0c,0x12,0xff,0x08,0x03,0x07,0xff,0x08,0x04,0x08,0xff,0x1b,0x10,0x17,0xff,0x1a,0x0f,0x13,0xff,0x13,0x10,0x11,0xff,0x09,0x04,0x07,0xff,0x0d,0x06,0x09,0xff,0x15,0x0b,0x0e,0xff,0x27,0x1c,0x1f,0xff,0x18,0x0d,0x10,0xff,0x1f,0x11,0x16,0xff,0x21,0x13,0x18,0xff,0x17,0x0b,0x0e,0xff,0x20,0x14,0x15,0xff,0x21,0x15,0x17,0xff,0x20,0x15,0x17,0xff,0x25,0x19,0x1a,0xff,0x23,0x17,0x17,0xff,0x1d,0x12,0x14,0xff,0x27,0x1e,0x22,0xff,0x1a,0x13,0x16,0xff,0x10,0x0a,0x0d,0xff,0x0f,0x0b,0x0d,0xff,0x05,0x02,0x05,0xff,0x05,0x02,0x05,0xff,0x03,0x00,0x03,0xff,0x05,0x02,0x05,0xff,0xac,0xab,0xac,0xe0,0xff,0xff,0xff,0x0e,0xff,0xf7,0xfa,0x00,0xfe,0xed,0xf3,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xc0,0xc5,0xd5,0x48,0x48,0x51,0x78,0xff,0x5a,0x61,0x89,0xff,0x70,0x77,0xa2,0xff,0x79,0x7e,0xb1,0xff,0xa4,0xa8,0xdc,0xff,0xba,0xc1,0xe7,0xff,0xc2,0xcc,0xeb,0xff,0xa3,0xad,0xd0,0xff,0x21,0x2e,0x64,0xff,0x79,0x86,0xc0,0xff,0xb7,0xbe,0xe8,0xff,0xb7,0xc1,0xea,0xff,0xa7,0xb6,0xe8,0xff,0x81,0x8e,0xcb,0xff,0x35,0x2f,0x43,0xff,0x41,0x32,0x34,0xff,0x3d,0x32,0x32,0xff,0x3a,0x31,0x2f,0xff,0x44,0x39,0x36,0xff,0x4a,0x3d,0x3a,0xff,0x34,0x24,0x2a,0xff,0x41,0x34,0x33,0xff,0x5c,0x50,0x4b,0xff,0x45,0x39,0x36,0xff,0x44,0x36,0x33,0xff,0x3b,0x2b,0x2a,0xff,0x5b,0x4b,0x4c,0xff,0x40,0x30,0x31,0xff,0x4f,0x40,0x3e,0xff,0x58,0x4a,0x47,0xff,0x43,0x33,0x33,0xff,0x51,0x40,0x42,0xff,0x45,0x37,0x38,0xff,0x47,0x39,0x3c,0xff,0x37,0x29,0x2c,0xff,0x43,0x31,0x38,0xff,0x59,0x47,0x4c,0xff,0x4a,0x38,0x3a,0xff,0x4a,0x37,0x39,0xff,0x59,0x45,0x49,0xff,0x48,0x35,0x3c,0xff,0x27,0x16,0x1f,0xff,0x1b,0x0d,0x18,0xff,0x35,0x25,0x33,0xff,0x42,0x2f,0x41,0xff,0x32,0x24,0x34,0xff,0x21,0x1b,0x2c,0xff,0x1c,0x14,0x26,0xff,0x1d,0x17,0x2d,0xff,0x27,0x20,0x35,0xff,0x17,0x0d,0x1e,0xff,0x29,0x1f,0x30,0xff,0x31,0x26,0x37,0xff,0x17,0x0d,0x1f,0xff,0x16,0x0f,0x20,0xff,0x0f,0x09,0x17,0xff,0x16,0x13,0x27,0xff,0x16,0x12,0x29,0xff,0x09,0x07,0x11,0xff,0x08,0x05,0x10,0xff,0x14,0x0b,0x18,0xff,0x59,0x45,0x47,0xff,0x75,0x61,0x5f,0xff,0x5e,0x57,0x69,0xff,0x2e,0x2e,0x53,0xff,0x35,0x34,0x52,0xff,0x2c,0x27,0x47,0xff,0x1c,0x18,0x38,0xff,0x2c,0x29,0x4a,0xff,0x31,0x2f,0x52,0xff,0x1d,0x1c,0x3e,0xff,0x16,0x13,0x36,0xff,0x12,0x10,0x33,0xff,0x14,0x14,0x36,0xff,0x18,0x1a,0x3d,0xff,0x1c,0x1e,0x43,0xff,0x1c,0x1c,0x43,0xff,0x16,0x17,0x3c,0xff,0x13,0x15,0x36,0xff,0x11,0x11,0x2f,0xff,0x10,0x0e,0x2b,0xff,0x0e,0x0a,0x28,0xff,0x0e,0x0a,0x25,0xff,0x07,0x06,0x1b,0xff,0x2c,0x2b,0x3d,0xff,0x60,0x59,0x61,0xff,0x54,0x4b,0x4f,0xff,0x35,0x2c,0x34,0xff,0x32,0x28,0x31,0xff,0x44,0x39,0x43,0xff,0x3e,0x31,0x3b,0xff,0x4e,0x42,0x44,0xff,0x44,0x38,0x39,0xff,0x43,0x37,0x3b,0xff,0x4a,0x3e,0x44,0xff,0x62,0x58,0x56,0xff,0x62,0x56,0x54,0xff,0x4a,0x3a,0x3b,0xff,0x3a,0x29,0x2a,0xff,0x30,0x1f,0x1f,0xff,0x3c,0x29,0x2b,0xff,0x36,0x24,0x25,0xff,0x37,0x25,0x28,0xff,0x2d,0x1a,0x1f,0xff,0x37,0x24,0x25,0xff,0x2f,0x1f,0x1f,0xff,0x1e,0x14,0x18,0xff,0x1b,0x0f,0x14,0xff,0x16,0x09,0x0f,0xff,0x19,0x10,0x12,0xff,0x16,0x0f,0x12,0xff,0x10,0x08,0x0e,0xff,0x13,0x0a,0x10,0xff,0x11,0x08,0x0d,0xff,0x10,0x08,0x0b,0xff,0x18,0x0f,0x13,0xff,0x17,0x0d,0x11,0xff,0x15,0x0b,0x0f,0xff,0x1b,0x10,0x15,0xff,0x1a,0x0e,0x13,0xff,0x1c,0x0e,0x13,0xff,0x24,0x17,0x1b,0xff,0x1d,0x11,0x15,0xff,0x17,0x0c,0x11,0xff,0x14,0x0c,0x0e,0xff,0x0c,0x06,0x07,0xff,0x0d,0x08,0x09,0xff,0x0c,0x07,0x09,0xff,0x12,0x0a,0x0e,0xff,0x1f,0x16,0x1a,0xff,0x10,0x0b,0x0e,0xff,0x15,0x11,0x14,0xff,0x0d,0x0a,0x0d,0xff,0x06,0x03,0x05,0xff,0x00,0x00,0x00,0xff,0x23,0x20,0x22,0xff,0xe2,0xe2,0xe2,0xa5,0xff,0xff,0xff,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xeb,0xf3,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf1,0xf7,0x00,0xff,0xff,0xff,0x00,0xe6,0xe9,0xf0,0x10,0x45,0x50,0x79,0xe4,0x2e,0x34,0x65,0xff,0x38,0x3d,0x74,0xff,0x77,0x7d,0xb2,0xff,0x9f,0xa6,0xd4,0xff,0xb5,0xbf,0xe2,0xff,0xc3,0xcc,0xe8,0xff,0xc9,0xd6,0xea,0xff,0x54,0x63,0x8f,0xff,0x4b,0x56,0x91,0xff,0x9a,0xa0,0xdf,0xff,0xa2,0xa6,0xe6,0xff,0x9a,0xa5,0xe1,0xff,0x8d,0x97,0xd9,0xff,0x2e,0x28,0x3e,0xff,0x2e,0x1d,0x1f,0xff,0x49,0x3d,0x3b,0xff,0x4b,0x41,0x3e,0xff,0x53,0x48,0x42,0xff,0x4b,0x3f,0x3a,0xff,0x3a,0x2d,0x2e,0xff,0x2d,0x21,0x22,0xff,0x45,0x3a,0x36,0xff,0x46,0x39,0x37,0xff,0x4c,0x3f,0x3e,0xff,0x40,0x31,0x30,0xff,0x49,0x3a,0x38,0xff,0x56,0x46,0x45,0xff,0x52,0x43,0x41,0xff,0x4e,0x3f,0x3d,0xff,0x56,0x47,0x46,0xff,0x4e,0x3f,0x40,0xff,0x39,0x29,0x2e,0xff,0x4d,0x3e,0x43,0xff,0x5d,0x4e,0x50,0xff,0x39,0x27,0x2c,0xff,0x38,0x27,0x2a,0xff,0x51,0x41,0x41,0xff,0x5a,0x48,0x49,0xff,0x47,0x35,0x39,0xff,0x3b,0x29,0x32,0xff,0x3b,0x2a,0x34,0xff,0x26,0x17,0x23,0xff,0x33,0x23,0x31,0xff,0x53,0x40,0x4e,0xff,0x2a,0x1d,0x2b,0xff,0x11,0x0f,0x1c,0xff,0x0c,0x09,0x19,0xff,0x11,0x0f,0x22,0xff,0x0e,0x0d,0x1d,0xff,0x17,0x0f,0x1e,0xff,0x34,0x28,0x40,0xff,0x1a,0x10,0x28,0xff,0x12,0x0d,0x1d,0xff,0x06,0x01,0x0f,0xff,0x07,0x02,0x0d,0xff,0x08,0x05,0x10,0xff,0x0b,0x08,0x15,0xff,0x15,0x12,0x23,0xff,0x19,0x14,0x31,0xff,0x59,0x4c,0x53,0xff,0x70,0x57,0x57,0xff,0x80,0x71,0x79,0xff,0x3a,0x3e,0x5b,0xff,0x3b,0x3b,0x60,0xff,0x37,0x32,0x54,0xff,0x2d,0x28,0x4a,0xff,0x1f,0x1c,0x3a,0xff,0x28,0x26,0x44,0xff,0x3f,0x3d,0x62,0xff,0x2c,0x2a,0x50,0xff,0x19,0x17,0x3a,0xff,0x11,0x10,0x31,0xff,0x10,0x0e,0x2f,0xff,0x11,0x11,0x33,0xff,0x15,0x14,0x3a,0xff,0x14,0x13,0x38,0xff,0x12,0x13,0x35,0xff,0x0f,0x0e,0x30,0xff,0x0d,0x0c,0x2b,0xff,0x0c,0x0b,0x29,0xff,0x0c,0x0a,0x27,0xff,0x0a,0x07,0x23,0xff,0x14,0x13,0x25,0xff,0x5d,0x5a,0x63,0xff,0x52,0x49,0x4c,0xff,0x4b,0x42,0x48,0xff,0x39,0x2d,0x35,0xff,0x42,0x39,0x41,0xff,0x3d,0x31,0x3a,0xff,0x51,0x44,0x4a,0xff,0x4c,0x41,0x44,0xff,0x2a,0x1b,0x20,0xff,0x3f,0x2c,0x32,0xff,0x3f,0x2e,0x31,0xff,0x51,0x42,0x3e,0xff,0x54,0x45,0x44,0xff,0x48,0x38,0x39,0xff,0x30,0x1f,0x21,0xff,0x3b,0x27,0x29,0xff,0x33,0x20,0x21,0xff,0x37,0x25,0x27,0xff,0x37,0x24,0x28,0xff,0x28,0x13,0x19,0xff,0x38,0x25,0x24,0xff,0x2c,0x1b,0x1a,0xff,0x28,0x1a,0x1c,0xff,0x27,0x1b,0x1c,0xff,0x25,0x17,0x1a,0xff,0x2e,0x1f,0x22,0xff,0x0f,0x08,0x0b,0xff,0x09,0x04,0x08,0xff,0x07,0x04,0x08,0xff,0x09,0x05,0x08,0xff,0x10,0x09,0x0d,0xff,0x11,0x08,0x0c,0xff,0x0e,0x07,0x0b,0xff,0x0c,0x07,0x0a,0xff,0x10,0x08,0x0c,0xff,0x13,0x09,0x0f,0xff,0x13,0x08,0x0d,0xff,0x1c,0x12,0x16,0xff,0x1c,0x12,0x16,0xff,0x0f,0x06,0x0a,0xff,0x16,0x0e,0x0f,0xff,0x19,0x11,0x12,0xff,0x19,0x11,0x13,0xff,0x0a,0x05,0x07,0xff,0x0b,0x06,0x09,0xff,0x11,0x0b,0x0d,0xff,0x17,0x10,0x12,0xff,0x0d,0x08,0x0a,0xff,0x08,0x05,0x08,0xff,0x04,0x02,0x05,0xff,0x00,0x00,0x00,0xff,0x59,0x57,0x59,0xff,0xff,0xff,0xff,0x5a,0xff,0xff,0xff,0x00,0xfd,0xe9,0xf2,0x00,0xfe,0xec,0xf3,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xeb,0xf3,0x00,0xff,0xff,0xff,0x00,0xfe,0xfe,0xff,0x00,0x97,0x9c,0xc6,0xa2,0x52,0x58,0x91,0xff,0x1e,0x24,0x57,0xff,0x4b,0x52,0x88,0xff,0xa7,0xb0,0xda,0xff,0xbc,0xc8,0xe1,0xff,0xc2,0xcb,0xe7,0xff,0xcc,0xd7,0xec,0xff,0xa2,0xb0,0xd0,0xff,0x40,0x4b,0x86,0xff,0x60,0x67,0xa7,0xff,0x7a,0x75,0x8e,0xff,0x6e,0x6b,0x82,0xff,0x86,0x8a,0xcd,0xff,0x36,0x31,0x4c,0xff,0x2b,0x1c,0x1d,0xff,0x52,0x46,0x44,0xff,0x51,0x45,0x41,0xff,0x43,0x37,0x32,0xff,0x52,0x46,0x42,0xff,0x4a,0x3f,0x3d,0xff,0x3f,0x34,0x33,0xff,0x40,0x34,0x32,0xff,0x3b,0x2e,0x2d,0xff,0x3e,0x30,0x30,0xff,0x3d,0x2f,0x2d,0xff,0x46,0x36,0x34,0xff,0x5d,0x4d,0x4c,0xff,0x4b,0x3c,0x3a,0xff,0x52,0x42,0x40,0xff,0x45,0x36,0x34,0xff,0x51,0x42,0x41,0xff,0x49,0x3a,0x3b,0xff,0x4a,0x3c,0x3c,0xff,0x5a,0x4b,0x49,0xff,0x4e,0x3e,0x3e,0xff,0x5f,0x4f,0x50,0xff,0x63,0x54,0x52,0xff,0x60,0x4e,0x4f,0xff,0x41,0x30,0x34,0xff,0x26,0x17,0x1e,0xff,0x35,0x24,0x2e,0xff,0x2a,0x1b,0x27,0xff,0x32,0x25,0x32,0xff,0x39,0x2a,0x38,0xff,0x22,0x17,0x2b,0xff,0x18,0x14,0x27,0xff,0x10,0x0b,0x1b,0xff,0x0a,0x08,0x14,0xff,0x09,0x05,0x12,0xff,0x15,0x0c,0x22,0xff,0x10,0x0d,0x20,0xff,0x06,0x03,0x17,0xff,0x14,0x0e,0x28,0xff,0x12,0x0e,0x27,0xff,0x1c,0x19,0x32,0xff,0x2a,0x27,0x41,0xff,0x34,0x30,0x50,0xff,0x30,0x2b,0x51,0xff,0x47,0x40,0x51,0xff,0x83,0x6c,0x67,0xff,0x74,0x62,0x60,0xff,0x6f,0x6d,0x7c,0xff,0x30,0x35,0x5c,0xff,0x41,0x41,0x63,0xff,0x39,0x35,0x56,0xff,0x2f,0x2a,0x4c,0xff,0x25,0x22,0x3e,0xff,0x23,0x1f,0x3d,0xff,0x41,0x40,0x64,0xff,0x39,0x39,0x5f,0xff,0x22,0x23,0x45,0xff,0x16,0x16,0x37,0xff,0x0f,0x0e,0x2f,0xff,0x10,0x0f,0x2f,0xff,0x14,0x12,0x36,0xff,0x14,0x13,0x38,0xff,0x15,0x15,0x37,0xff,0x13,0x13,0x34,0xff,0x11,0x0f,0x2e,0xff,0x0e,0x0c,0x2b,0xff,0x0c,0x0b,0x27,0xff,0x06,0x05,0x1f,0xff,0x2f,0x2d,0x3d,0xff,0x67,0x61,0x69,0xff,0x3e,0x36,0x3c,0xff,0x2d,0x25,0x2d,0xff,0x3a,0x2e,0x36,0xff,0x3a,0x30,0x36,0xff,0x50,0x46,0x4c,0xff,0x46,0x3b,0x40,0xff,0x2c,0x1f,0x21,0xff,0x5c,0x43,0x40,0xff,0x74,0x56,0x51,0xff,0x6d,0x51,0x47,0xff,0x5d,0x43,0x3a,0xff,0x44,0x29,0x2a,0xff,0x38,0x23,0x23,0xff,0x33,0x20,0x23,0xff,0x29,0x15,0x1a,0xff,0x2a,0x18,0x1d,0xff,0x28,0x16,0x1a,0xff,0x23,0x0f,0x14,0xff,0x24,0x10,0x15,0xff,0x2d,0x1b,0x1c,0xff,0x3b,0x28,0x29,0xff,0x3f,0x2c,0x28,0xff,0x3b,0x2c,0x27,0xff,0x2d,0x1c,0x1d,0xff,0x2f,0x1d,0x21,0xff,0x17,0x0e,0x12,0xff,0x17,0x12,0x15,0xff,0x08,0x03,0x06,0xff,0x0e,0x09,0x0c,0xff,0x0d,0x08,0x0a,0xff,0x03,0x00,0x02,0xff,0x09,0x04,0x07,0xff,0x0a,0x06,0x09,0xff,0x07,0x04,0x07,0xff,0x09,0x04,0x08,0xff,0x0d,0x08,0x0c,0xff,0x0a,0x07,0x09,0xff,0x1b,0x13,0x16,0xff,0x21,0x19,0x1c,0xff,0x18,0x10,0x12,0xff,0x19,0x0f,0x11,0xff,0x1c,0x13,0x14,0xff,0x13,0x0d,0x0e,0xff,0x10,0x0b,0x0d,0xff,0x14,0x0e,0x11,0xff,0x0c,0x05,0x08,0xff,0x0e,0x09,0x0c,0xff,0x0c,0x08,0x0b,0xff,0x06,0x03,0x05,0xff,0x00,0x00,0x00,0xff,0x99,0x99,0x9a,0xed,0xff,0xff,0xff,0x1a,0xff,0xfa,0xfc,0x00,0xfd,0xe6,0xf0,0x00,0xfe,0xed,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf6,0xf9,0x00,0xfd,0xe6,0xef,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xd3,0xd6,0xed,0x4f,0xa0,0xa9,0xd8,0xff,0x87,0x8d,0xb9,0xff,0x3b,0x40,0x73,0xff,0x6f,0x7d,0xb2,0xff,0xba,0xc5,0xe6,0xff,0xc1,0xc9,0xe5,0xff,0xc0,0xc9,0xe6,0xff,0xce,0xd9,0xf0,0xff,0x76,0x7e,0xb3,0xff,0x38,0x35,0x65,0xff,0x3c,0x30,0x22,0xff,0x4f,0x40,0x2f,0xff,0x5a,0x60,0x88,0xff,0x4e,0x4c,0x69,0xff,0x2b,0x1e,0x1e,0xff,0x43,0x38,0x38,0xff,0x46,0x3b,0x37,0xff,0x48,0x3b,0x38,0xff,0x44,0x37,0x36,0xff,0x59,0x4b,0x4a,0xff,0x49,0x3c,0x39,0xff,0x41,0x34,0x32,0xff,0x48,0x3b,0x39,0xff,0x43,0x33,0x32,0xff,0x52,0x43,0x40,0xff,0x5a,0x4b,0x49,0xff,0x41,0x32,0x30,0xff,0x49,0x3a,0x37,0xff,0x4e,0x3f,0x3d,0xff,0x54,0x45,0x42,0xff,0x5f,0x51,0x4c,0xff,0x5e,0x4f,0x4a,0xff,0x54,0x46,0x41,0xff,0x68,0x5a,0x55,0xff,0x6c,0x5d,0x5a,0xff,0x60,0x51,0x4e,0xff,0x5f,0x50,0x4d,0xff,0x67,0x54,0x55,0xff,0x3f,0x2e,0x30,0xff,0x26,0x16,0x1c,0xff,0x32,0x21,0x2b,0xff,0x2b,0x1d,0x28,0xff,0x28,0x1d,0x28,0xff,0x11,0x09,0x15,0xff,0x22,0x1a,0x2d,0xff,0x18,0x13,0x1f,0xff,0x06,0x03,0x0a,0xff,0x04,0x02,0x0a,0xff,0x06,0x04,0x12,0xff,0x0a,0x08,0x22,0xff,0x12,0x13,0x30,0xff,0x31,0x31,0x51,0xff,0x3a,0x39,0x5d,0xff,0x44,0x44,0x67,0xff,0x45,0x46,0x69,0xff,0x43,0x43,0x65,0xff,0x3a,0x3c,0x5c,0xff,0x38,0x35,0x51,0xff,0x88,0x78,0x72,0xff,0x74,0x63,0x5c,0xff,0x92,0x87,0x87,0xff,0x45,0x49,0x62,0xff,0x40,0x45,0x6f,0xff,0x44,0x44,0x65,0xff,0x3a,0x37,0x58,0xff,0x2f,0x2c,0x4e,0xff,0x26,0x24,0x3f,0xff,0x1f,0x1a,0x38,0xff,0x3c,0x3c,0x5d,0xff,0x45,0x48,0x6c,0xff,0x30,0x31,0x54,0xff,0x1d,0x1d,0x41,0xff,0x11,0x11,0x34,0xff,0x0f,0x0e,0x2f,0xff,0x12,0x11,0x31,0xff,0x14,0x14,0x35,0xff,0x13,0x13,0x35,0xff,0x12,0x12,0x32,0xff,0x0f,0x0e,0x2c,0xff,0x0e,0x0d,0x2a,0xff,0x0d,0x0b,0x24,0xff,0x07,0x04,0x1c,0xff,0x46,0x44,0x54,0xff,0x47,0x45,0x4c,0xff,0x35,0x2e,0x36,0xff,0x28,0x1f,0x28,0xff,0x32,0x28,0x2f,0xff,0x3d,0x32,0x38,0xff,0x3c,0x32,0x38,0xff,0x29,0x1d,0x25,0xff,0x2b,0x19,0x1b,0xff,0x79,0x5a,0x4d,0xff,0x87,0x67,0x57,0xff,0x73,0x57,0x4c,0xff,0x6d,0x53,0x4e,0xff,0x54,0x3a,0x37,0xff,0x44,0x2d,0x2c,0xff,0x3a,0x27,0x28,0xff,0x3d,0x2b,0x2c,0xff,0x28,0x17,0x1a,0xff,0x21,0x11,0x14,0xff,0x2a,0x18,0x19,0xff,0x2a,0x1a,0x1d,0xff,0x2f,0x20,0x1f,0xff,0x3a,0x29,0x27,0xff,0x36,0x24,0x23,0xff,0x3c,0x2a,0x29,0xff,0x2f,0x1c,0x1e,0xff,0x2b,0x1b,0x1f,0xff,0x1d,0x10,0x15,0xff,0x1d,0x14,0x17,0xff,0x08,0x04,0x05,0xff,0x0a,0x06,0x08,0xff,0x0e,0x0b,0x0d,0xff,0x0b,0x09,0x09,0xff,0x07,0x04,0x05,0xff,0x0b,0x07,0x09,0xff,0x0d,0x08,0x0b,0xff,0x06,0x03,0x04,0xff,0x05,0x02,0x03,0xff,0x07,0x02,0x03,0xff,0x13,0x0f,0x0f,0xff,0x24,0x1e,0x1f,0xff,0x16,0x0f,0x12,0xff,0x0e,0x06,0x0a,0xff,0x10,0x09,0x0a,0xff,0x16,0x0e,0x0f,0xff,0x13,0x0b,0x0e,0xff,0x18,0x0f,0x14,0xff,0x11,0x09,0x0f,0xff,0x15,0x0e,0x15,0xff,0x0e,0x09,0x10,0xff,0x03,0x00,0x04,0xff,0x20,0x1d,0x20,0xff,0xdc,0xdb,0xdc,0xaa,0xff,0xff,0xff,0x00,0xfe,0xf3,0xf8,0x00,0xfd,0xe4,0xee,0x00,0xfe,0xee,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe4,0xee,0x00,0xfe,0xf5,0xf9,0x00,0xff,0xff,0xff,0x00,0xf1,0xf2,0xf8,0x0e,0x9a,0xa2,0xcd,0xde,0x8c,0x94,0xc7,0xff,0x96,0x9a,0xcb,0xff,0x80,0x8f,0xbf,0xff,0x87,0x97,0xc9,0xff,0xb2,0xbb,0xdd,0xff,0xbc,0xc6,0xe0,0xff,0xca,0xd3,0xe9,0xff,0xae,0xb4,0xdb,0xff,0x4e,0x48,0x73,0xff,0x12,0x07,0x08,0xff,0x28,0x18,0x10,0xff,0x46,0x43,0x5b,0xff,0x44,0x39,0x50,0xff,0x33,0x26,0x25,0xff,0x40,0x35,0x35,0xff,0x37,0x2c,0x2a,0xff,0x4b,0x3e,0x3b,0xff,0x46,0x39,0x37,0xff,0x5d,0x4f,0x4f,0xff,0x50,0x42,0x3f,0xff,0x3d,0x30,0x2e,0xff,0x52,0x46,0x42,0xff,0x58,0x4c,0x48,0xff,0x41,0x34,0x2f,0xff,0x53,0x46,0x42,0xff,0x5d,0x50,0x4d,0xff,0x55,0x48,0x44,0xff,0x48,0x3a,0x37,0xff,0x65,0x57,0x52,0xff,0x68,0x5a,0x54,0xff,0x73,0x64,0x5e,0xff,0x54,0x44,0x3f,0xff,0x5f,0x4f,0x49,0xff,0x67,0x58,0x54,0xff,0x50,0x41,0x3e,0xff,0x54,0x44,0x43,0xff,0x64,0x51,0x52,0xff,0x43,0x33,0x33,0xff,0x30,0x1e,0x26,0xff,0x2d,0x1d,0x25,0xff,0x2f,0x25,0x2e,0xff,0x31,0x27,0x34,0xff,0x13,0x0a,0x1a,0xff,0x1e,0x14,0x29,0xff,0x11,0x0d,0x12,0xff,0x00,0x00,0x04,0xff,0x0d,0x0c,0x1b,0xff,0x28,0x26,0x42,0xff,0x39,0x38,0x5e,0xff,0x44,0x49,0x6e,0xff,0x4d,0x53,0x78,0xff,0x4e,0x56,0x7c,0xff,0x4a,0x51,0x74,0xff,0x44,0x49,0x6b,0xff,0x40,0x46,0x68,0xff,0x3c,0x3c,0x5f,0xff,0x70,0x68,0x6c,0xff,0x8e,0x7e,0x72,0xff,0x84,0x79,0x76,0xff,0x8a,0x85,0x8d,0xff,0x36,0x39,0x60,0xff,0x50,0x54,0x7d,0xff,0x47,0x47,0x68,0xff,0x3d,0x3b,0x5b,0xff,0x35,0x31,0x51,0xff,0x28,0x25,0x42,0xff,0x1e,0x1b,0x3a,0xff,0x2f,0x2f,0x50,0xff,0x4c,0x4e,0x71,0xff,0x3e,0x3e,0x63,0xff,0x26,0x26,0x4a,0xff,0x16,0x15,0x37,0xff,0x0f,0x0d,0x2e,0xff,0x0e,0x0d,0x2c,0xff,0x0f,0x10,0x2e,0xff,0x0f,0x11,0x2f,0xff,0x11,0x12,0x30,0xff,0x0f,0x0d,0x2b,0xff,0x0f,0x0d,0x29,0xff,0x0e,0x0b,0x23,0xff,0x07,0x04,0x1c,0xff,0x34,0x33,0x43,0xff,0x4c,0x49,0x51,0xff,0x38,0x2f,0x37,0xff,0x22,0x18,0x20,0xff,0x36,0x2a,0x32,0xff,0x40,0x32,0x39,0xff,0x34,0x29,0x2f,0xff,0x30,0x21,0x25,0xff,0x53,0x38,0x38,0xff,0x66,0x4d,0x44,0xff,0x6a,0x50,0x48,0xff,0x4e,0x36,0x31,0xff,0x45,0x2e,0x2c,0xff,0x49,0x33,0x31,0xff,0x3f,0x29,0x29,0xff,0x2a,0x18,0x1b,0xff,0x27,0x17,0x19,0xff,0x1f,0x10,0x13,0xff,0x28,0x19,0x1d,0xff,0x45,0x33,0x31,0xff,0x1e,0x0f,0x13,0xff,0x3a,0x2b,0x27,0xff,0x3e,0x2d,0x2a,0xff,0x27,0x16,0x17,0xff,0x34,0x21,0x23,0xff,0x39,0x28,0x2a,0xff,0x26,0x19,0x1b,0xff,0x18,0x0d,0x10,0xff,0x15,0x0c,0x0f,0xff,0x13,0x0e,0x0e,0xff,0x13,0x0e,0x0e,0xff,0x0c,0x08,0x08,0xff,0x15,0x0f,0x10,0xff,0x12,0x0b,0x0d,0xff,0x0f,0x06,0x09,0xff,0x11,0x09,0x0d,0xff,0x17,0x0f,0x12,0xff,0x17,0x11,0x12,0xff,0x15,0x10,0x10,0xff,0x1c,0x15,0x16,0xff,0x0f,0x08,0x09,0xff,0x0d,0x06,0x08,0xff,0x1b,0x13,0x17,0xff,0x17,0x0e,0x11,0xff,0x10,0x09,0x0d,0xff,0x11,0x09,0x10,0xff,0x15,0x0e,0x15,0xff,0x1f,0x19,0x20,0xff,0x10,0x0b,0x14,0xff,0x0a,0x05,0x0f,0xff,0x03,0x00,0x05,0xff,0x64,0x62,0x64,0xff,0xff,0xff,0xff,0x55,0xff,0xff,0xff,0x00,0xfe,0xed,0xf3,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xee,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe4,0xee,0x00,0xfe,0xed,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xab,0xb1,0xd3,0x90,0x8e,0x96,0xc8,0xff,0xb6,0xba,0xe0,0xff,0xbf,0xc6,0xe8,0xff,0x70,0x80,0xb8,0xff,0x73,0x87,0xb8,0xff,0xad,0xb8,0xd8,0xff,0xc0,0xc5,0xe1,0xff,0xc3,0xca,0xe8,0xff,0x7e,0x81,0xae,0xff,0x10,0x0c,0x21,0xff,0x1a,0x14,0x1e,0xff,0x2d,0x25,0x3e,0xff,0x22,0x1a,0x1f,0xff,0x33,0x27,0x27,0xff,0x2f,0x24,0x24,0xff,0x48,0x3e,0x3a,0xff,0x55,0x4b,0x45,0xff,0x51,0x45,0x43,0xff,0x4a,0x3c,0x3c,0xff,0x3b,0x2e,0x2c,0xff,0x33,0x26,0x23,0xff,0x4c,0x40,0x3c,0xff,0x59,0x4c,0x49,0xff,0x45,0x38,0x34,0xff,0x59,0x4e,0x48,0xff,0x4d,0x41,0x3c,0xff,0x59,0x4e,0x47,0xff,0x5c,0x50,0x49,0xff,0x6e,0x60,0x57,0xff,0x62,0x52,0x4c,0xff,0x61,0x50,0x4d,0xff,0x46,0x35,0x31,0xff,0x5b,0x4b,0x44,0xff,0x60,0x52,0x4c,0xff,0x53,0x45,0x43,0xff,0x3b,0x2b,0x2c,0xff,0x42,0x31,0x32,0xff,0x53,0x45,0x44,0xff,0x35,0x24,0x2b,0xff,0x2c,0x1d,0x26,0xff,0x26,0x1d,0x25,0xff,0x3b,0x31,0x3e,0xff,0x1f,0x17,0x28,0xff,0x14,0x0e,0x19,0xff,0x0d,0x0b,0x1a,0xff,0x24,0x23,0x3d,0xff,0x38,0x39,0x5a,0xff,0x45,0x49,0x6e,0xff,0x4f,0x55,0x79,0xff,0x51,0x59,0x7d,0xff,0x4f,0x57,0x7c,0xff,0x4f,0x57,0x7b,0xff,0x48,0x4f,0x73,0xff,0x42,0x49,0x6b,0xff,0x42,0x4a,0x6b,0xff,0x64,0x5e,0x73,0xff,0x9f,0x8e,0x83,0xff,0x78,0x6c,0x67,0xff,0xab,0xa1,0x9e,0xff,0x58,0x5a,0x71,0xff,0x43,0x4d,0x79,0xff,0x54,0x58,0x80,0xff,0x4a,0x49,0x6b,0xff,0x3f,0x3d,0x5d,0xff,0x36,0x32,0x52,0xff,0x2a,0x26,0x45,0xff,0x20,0x1d,0x3a,0xff,0x24,0x24,0x42,0xff,0x4c,0x4e,0x72,0xff,0x46,0x4a,0x6e,0xff,0x34,0x33,0x57,0xff,0x1e,0x1d,0x3f,0xff,0x13,0x12,0x32,0xff,0x0f,0x0e,0x2f,0xff,0x0f,0x0f,0x2f,0xff,0x10,0x11,0x2f,0xff,0x11,0x12,0x2f,0xff,0x0f,0x0e,0x2c,0xff,0x0e,0x0c,0x28,0xff,0x0d,0x0b,0x22,0xff,0x06,0x03,0x1a,0xff,0x24,0x22,0x33,0xff,0x53,0x4f,0x59,0xff,0x2d,0x25,0x2e,0xff,0x34,0x28,0x30,0xff,0x39,0x2c,0x34,0xff,0x34,0x24,0x2b,0xff,0x41,0x2e,0x33,0xff,0x4c,0x34,0x37,0xff,0x3c,0x25,0x29,0xff,0x34,0x21,0x22,0xff,0x37,0x23,0x24,0xff,0x3e,0x27,0x29,0xff,0x44,0x2c,0x2e,0xff,0x3c,0x26,0x27,0xff,0x2a,0x16,0x18,0xff,0x2f,0x1e,0x21,0xff,0x1a,0x0c,0x10,0xff,0x1e,0x11,0x17,0xff,0x31,0x22,0x25,0xff,0x4b,0x38,0x33,0xff,0x2b,0x1b,0x1e,0xff,0x43,0x31,0x2b,0xff,0x31,0x21,0x1e,0xff,0x1a,0x0c,0x0f,0xff,0x26,0x16,0x18,0xff,0x2f,0x21,0x23,0xff,0x2a,0x1c,0x1e,0xff,0x19,0x0d,0x10,0xff,0x18,0x0c,0x0f,0xff,0x28,0x19,0x1a,0xff,0x2e,0x1e,0x1e,0xff,0x24,0x16,0x17,0xff,0x1c,0x0f,0x14,0xff,0x12,0x0a,0x0e,0xff,0x0c,0x06,0x09,0xff,0x0b,0x05,0x08,0xff,0x11,0x09,0x0d,0xff,0x12,0x0b,0x0d,0xff,0x14,0x0f,0x10,0xff,0x17,0x10,0x11,0xff,0x14,0x0d,0x0e,0xff,0x12,0x0a,0x0d,0xff,0x12,0x0b,0x0e,0xff,0x12,0x0b,0x0d,0xff,0x12,0x08,0x11,0xff,0x14,0x0f,0x1f,0xff,0x1f,0x1d,0x2d,0xff,0x23,0x1f,0x2d,0xff,0x1b,0x16,0x25,0xff,0x11,0x0d,0x1c,0xff,0x0f,0x0e,0x19,0xff,0xb2,0xb3,0xb5,0xe0,0xff,0xff,0xff,0x10,0xff,0xfa,0xfc,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xef,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xf0,0x00,0xff,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xd3,0xd6,0xe5,0x36,0x8d,0x97,0xc2,0xfe,0xa4,0xad,0xd5,0xff,0xa7,0xab,0xda,0xff,0x88,0x90,0xc2,0xff,0x42,0x51,0x89,0xff,0x83,0x93,0xc5,0xff,0xb1,0xb8,0xe0,0xff,0xb7,0xbc,0xe0,0xff,0xb2,0xb5,0xe5,0xff,0x4b,0x4d,0x8e,0xff,0x0c,0x0d,0x38,0xff,0x07,0x03,0x09,0xff,0x1a,0x11,0x19,0xff,0x24,0x1a,0x1d,0xff,0x30,0x23,0x24,0xff,0x3d,0x32,0x30,0xff,0x47,0x3e,0x3a,0xff,0x48,0x3d,0x3c,0xff,0x53,0x46,0x45,0xff,0x3e,0x31,0x2e,0xff,0x44,0x37,0x34,0xff,0x50,0x43,0x42,0xff,0x43,0x35,0x35,0xff,0x46,0x39,0x36,0xff,0x58,0x4d,0x47,0xff,0x5e,0x53,0x4c,0xff,0x5d,0x51,0x4b,0xff,0x74,0x65,0x63,0xff,0x59,0x48,0x46,0xff,0x62,0x4f,0x4c,0xff,0x58,0x47,0x44,0xff,0x44,0x33,0x33,0xff,0x50,0x3e,0x3f,0xff,0x3b,0x29,0x2d,0xff,0x40,0x2f,0x33,0xff,0x32,0x21,0x25,0xff,0x3b,0x2e,0x2f,0xff,0x43,0x36,0x36,0xff,0x33,0x25,0x2a,0xff,0x3b,0x2f,0x36,0xff,0x20,0x17,0x20,0xff,0x3b,0x30,0x3e,0xff,0x19,0x14,0x22,0xff,0x14,0x15,0x22,0xff,0x38,0x3c,0x5c,0xff,0x41,0x44,0x6a,0xff,0x44,0x4a,0x6f,0xff,0x48,0x51,0x76,0xff,0x4f,0x59,0x7e,0xff,0x54,0x5e,0x83,0xff,0x53,0x5c,0x80,0xff,0x4f,0x58,0x7b,0xff,0x47,0x50,0x73,0xff,0x43,0x4e,0x72,0xff,0x4f,0x51,0x6b,0xff,0x9e,0x91,0x8b,0xff,0x8c,0x80,0x74,0xff,0x91,0x82,0x7f,0xff,0xa6,0xa3,0xa6,0xff,0x38,0x43,0x69,0xff,0x5e,0x68,0x96,0xff,0x54,0x58,0x7f,0xff,0x4b,0x4a,0x6d,0xff,0x40,0x3e,0x5e,0xff,0x35,0x33,0x52,0xff,0x2c,0x28,0x46,0xff,0x24,0x22,0x3d,0xff,0x20,0x1e,0x39,0xff,0x47,0x48,0x6b,0xff,0x4c,0x55,0x78,0xff,0x3c,0x3e,0x62,0xff,0x27,0x27,0x49,0xff,0x17,0x17,0x37,0xff,0x0f,0x10,0x30,0xff,0x10,0x10,0x30,0xff,0x10,0x10,0x32,0xff,0x0f,0x10,0x2d,0xff,0x0e,0x0d,0x2c,0xff,0x0c,0x0b,0x25,0xff,0x0c,0x0a,0x20,0xff,0x09,0x07,0x1c,0xff,0x0d,0x0b,0x1c,0xff,0x44,0x42,0x4e,0xff,0x37,0x30,0x39,0xff,0x2f,0x1e,0x26,0xff,0x44,0x32,0x36,0xff,0x49,0x35,0x37,0xff,0x3b,0x29,0x2c,0xff,0x24,0x17,0x1b,0xff,0x16,0x0a,0x0e,0xff,0x1d,0x0f,0x10,0xff,0x38,0x2a,0x2a,0xff,0x2d,0x1c,0x1c,0xff,0x31,0x20,0x22,0xff,0x2d,0x1a,0x1d,0xff,0x37,0x23,0x24,0xff,0x38,0x28,0x29,0xff,0x17,0x0b,0x0e,0xff,0x14,0x08,0x0f,0xff,0x2d,0x1d,0x1e,0xff,0x49,0x34,0x2e,0xff,0x3e,0x2b,0x2a,0xff,0x59,0x46,0x3f,0xff,0x35,0x25,0x22,0xff,0x1b,0x0d,0x10,0xff,0x1e,0x13,0x15,0xff,0x0d,0x06,0x07,0xff,0x14,0x0b,0x0d,0xff,0x19,0x0f,0x12,0xff,0x1a,0x0e,0x12,0xff,0x2b,0x1c,0x1d,0xff,0x33,0x24,0x25,0xff,0x27,0x1b,0x1d,0xff,0x1c,0x11,0x13,0xff,0x17,0x0d,0x0f,0xff,0x11,0x09,0x0c,0xff,0x0a,0x07,0x0a,0xff,0x0b,0x07,0x09,0xff,0x0b,0x06,0x08,0xff,0x0d,0x09,0x0b,0xff,0x0c,0x08,0x09,0xff,0x0d,0x07,0x09,0xff,0x0f,0x08,0x0c,0xff,0x12,0x0c,0x0e,0xff,0x11,0x0d,0x11,0xff,0x17,0x0f,0x1f,0xff,0x21,0x1f,0x35,0xff,0x29,0x30,0x49,0xff,0x37,0x3b,0x55,0xff,0x29,0x2f,0x44,0xff,0x1c,0x21,0x35,0xff,0x46,0x49,0x59,0xff,0xee,0xee,0xf0,0x8e,0xff,0xff,0xff,0x00,0xfe,0xf1,0xf6,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xef,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xff,0xff,0x00,0xf3,0xf4,0xf7,0x00,0x92,0x98,0xbe,0xbe,0x8c,0x91,0xc5,0xff,0xaa,0xb1,0xd8,0xff,0xb7,0xbf,0xe0,0xff,0x53,0x5e,0x8b,0xff,0x47,0x55,0x8e,0xff,0x97,0xa1,0xd3,0xff,0xa3,0xaa,0xda,0xff,0xa1,0xa8,0xde,0xff,0x94,0x9d,0xdc,0xff,0x63,0x6e,0xa0,0xff,0x1e,0x1a,0x2a,0xff,0x26,0x1b,0x23,0xff,0x30,0x27,0x28,0xff,0x47,0x3c,0x3b,0xff,0x3a,0x2f,0x2f,0xff,0x31,0x26,0x26,0xff,0x32,0x26,0x26,0xff,0x41,0x33,0x33,0xff,0x52,0x44,0x44,0xff,0x53,0x46,0x44,0xff,0x49,0x3c,0x3a,0xff,0x3d,0x30,0x2f,0xff,0x4e,0x43,0x3d,0xff,0x54,0x49,0x41,0xff,0x57,0x4c,0x45,0xff,0x65,0x5a,0x53,0xff,0x5a,0x4b,0x4a,0xff,0x4e,0x3d,0x3e,0xff,0x42,0x34,0x33,0xff,0x33,0x25,0x25,0xff,0x24,0x13,0x16,0xff,0x2c,0x1c,0x20,0xff,0x2a,0x1a,0x20,0xff,0x21,0x12,0x17,0xff,0x31,0x20,0x25,0xff,0x3a,0x29,0x2d,0xff,0x2e,0x1f,0x21,0xff,0x2c,0x1e,0x23,0xff,0x30,0x24,0x2d,0xff,0x2c,0x22,0x2c,0xff,0x2e,0x25,0x31,0xff,0x28,0x26,0x39,0xff,0x45,0x4a,0x6c,0xff,0x4d,0x53,0x79,0xff,0x47,0x52,0x77,0xff,0x4a,0x54,0x79,0xff,0x51,0x59,0x80,0xff,0x53,0x5e,0x83,0xff,0x55,0x5f,0x82,0xff,0x53,0x5d,0x7e,0xff,0x50,0x59,0x7b,0xff,0x4d,0x55,0x7b,0xff,0x44,0x4d,0x70,0xff,0x7c,0x75,0x81,0xff,0xb0,0x9f,0x93,0xff,0x85,0x79,0x70,0xff,0xc2,0xb8,0xaf,0xff,0x76,0x78,0x8e,0xff,0x56,0x62,0x8e,0xff,0x64,0x70,0x9c,0xff,0x55,0x59,0x81,0xff,0x4d,0x4c,0x6d,0xff,0x41,0x40,0x5f,0xff,0x36,0x33,0x52,0xff,0x2f,0x2c,0x48,0xff,0x29,0x27,0x43,0xff,0x23,0x20,0x3b,0xff,0x3a,0x3a,0x5c,0xff,0x50,0x58,0x7d,0xff,0x44,0x49,0x6c,0xff,0x2f,0x2f,0x52,0xff,0x1d,0x1d,0x3f,0xff,0x13,0x11,0x34,0xff,0x0e,0x0e,0x30,0xff,0x0f,0x0e,0x2e,0xff,0x0e,0x0e,0x2a,0xff,0x0a,0x0a,0x26,0xff,0x08,0x07,0x21,0xff,0x09,0x08,0x20,0xff,0x0b,0x08,0x1d,0xff,0x20,0x1b,0x2b,0xff,0x45,0x40,0x4c,0xff,0x41,0x32,0x3d,0xff,0x48,0x34,0x3b,0xff,0x43,0x2f,0x34,0xff,0x29,0x17,0x1b,0xff,0x11,0x05,0x0a,0xff,0x10,0x08,0x0c,0xff,0x11,0x06,0x0a,0xff,0x2d,0x1b,0x1e,0xff,0x32,0x21,0x24,0xff,0x22,0x13,0x15,0xff,0x2f,0x1f,0x21,0xff,0x29,0x19,0x1e,0xff,0x42,0x2e,0x2c,0xff,0x2d,0x1c,0x1c,0xff,0x17,0x0b,0x10,0xff,0x1a,0x0d,0x13,0xff,0x27,0x16,0x18,0xff,0x44,0x31,0x2c,0xff,0x39,0x26,0x23,0xff,0x4e,0x3b,0x37,0xff,0x3a,0x28,0x27,0xff,0x26,0x17,0x19,0xff,0x1e,0x0f,0x12,0xff,0x14,0x0d,0x0f,0xff,0x09,0x04,0x08,0xff,0x0d,0x08,0x0b,0xff,0x0b,0x05,0x08,0xff,0x0a,0x04,0x08,0xff,0x14,0x0b,0x0e,0xff,0x14,0x0a,0x0d,0xff,0x1a,0x11,0x12,0xff,0x27,0x1b,0x1d,0xff,0x2c,0x20,0x22,0xff,0x1e,0x17,0x18,0xff,0x0a,0x05,0x05,0xff,0x06,0x02,0x02,0xff,0x01,0x00,0x00,0xff,0x04,0x00,0x03,0xff,0x07,0x03,0x05,0xff,0x09,0x05,0x07,0xff,0x05,0x03,0x02,0xff,0x08,0x05,0x0d,0xff,0x09,0x07,0x14,0xff,0x10,0x10,0x21,0xff,0x1e,0x21,0x36,0xff,0x35,0x38,0x50,0xff,0x36,0x3b,0x51,0xff,0x1f,0x23,0x3b,0xff,0x98,0x99,0xa5,0xfc,0xff,0xff,0xff,0x31,0xff,0xfe,0xfe,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfe,0xf0,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe9,0xf2,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xc2,0xc5,0xda,0x5d,0x8d,0x92,0xc4,0xff,0xaf,0xb0,0xd9,0xff,0xc0,0xc4,0xe4,0xff,0xa0,0xa6,0xc7,0xff,0x24,0x2a,0x55,0xff,0x58,0x5f,0x9e,0xff,0x81,0x8d,0xcb,0xff,0x8c,0x96,0xd4,0xff,0x88,0x91,0xcf,0xff,0x8a,0x98,0xd5,0xff,0x4d,0x4f,0x72,0xff,0x13,0x0d,0x10,0xff,0x3b,0x31,0x32,0xff,0x4c,0x40,0x41,0xff,0x39,0x2c,0x2c,0xff,0x31,0x24,0x24,0xff,0x2f,0x25,0x24,0xff,0x22,0x17,0x17,0xff,0x32,0x26,0x26,0xff,0x42,0x36,0x34,0xff,0x44,0x38,0x33,0xff,0x4f,0x43,0x3c,0xff,0x59,0x4e,0x47,0xff,0x6a,0x5f,0x59,0xff,0x62,0x56,0x52,0xff,0x49,0x3b,0x3a,0xff,0x3b,0x2d,0x2e,0xff,0x24,0x17,0x19,0xff,0x16,0x0d,0x0f,0xff,0x1b,0x11,0x13,0xff,0x21,0x12,0x17,0xff,0x31,0x21,0x25,0xff,0x33,0x24,0x29,0xff,0x2e,0x20,0x24,0xff,0x45,0x34,0x3a,0xff,0x46,0x34,0x38,0xff,0x3e,0x30,0x35,0xff,0x1b,0x11,0x19,0xff,0x17,0x0f,0x19,0xff,0x24,0x1c,0x2a,0xff,0x11,0x09,0x17,0xff,0x2c,0x2b,0x42,0xff,0x54,0x61,0x84,0xff,0x52,0x5e,0x84,0xff,0x50,0x5a,0x7f,0xff,0x52,0x5c,0x7f,0xff,0x56,0x5f,0x84,0xff,0x57,0x61,0x86,0xff,0x55,0x61,0x85,0xff,0x53,0x5f,0x82,0xff,0x52,0x5d,0x7f,0xff,0x4d,0x56,0x7c,0xff,0x5a,0x5d,0x72,0xff,0xb5,0xa6,0x9c,0xff,0x9c,0x8b,0x83,0xff,0x99,0x8e,0x84,0xff,0xc6,0xbf,0xbc,0xff,0x62,0x6d,0x99,0xff,0x70,0x7e,0xad,0xff,0x60,0x6c,0x97,0xff,0x56,0x5b,0x80,0xff,0x4a,0x4b,0x6a,0xff,0x40,0x3f,0x5e,0xff,0x36,0x34,0x53,0xff,0x31,0x2f,0x4c,0xff,0x2f,0x2c,0x4a,0xff,0x29,0x25,0x43,0xff,0x2e,0x2e,0x4f,0xff,0x4f,0x58,0x7c,0xff,0x4c,0x52,0x76,0xff,0x3b,0x3c,0x5e,0xff,0x25,0x26,0x48,0xff,0x17,0x17,0x3a,0xff,0x10,0x0f,0x32,0xff,0x0b,0x0b,0x2d,0xff,0x0c,0x0b,0x26,0xff,0x12,0x0e,0x2a,0xff,0x15,0x10,0x2a,0xff,0x19,0x11,0x25,0xff,0x21,0x18,0x26,0xff,0x29,0x21,0x2b,0xff,0x4b,0x3d,0x47,0xff,0x4a,0x35,0x3e,0xff,0x39,0x26,0x2c,0xff,0x23,0x12,0x1b,0xff,0x17,0x09,0x12,0xff,0x26,0x18,0x1c,0xff,0x2c,0x1c,0x1f,0xff,0x35,0x21,0x25,0xff,0x39,0x24,0x27,0xff,0x27,0x13,0x17,0xff,0x33,0x21,0x26,0xff,0x2b,0x19,0x1e,0xff,0x2b,0x1a,0x20,0xff,0x47,0x33,0x2e,0xff,0x30,0x1d,0x1e,0xff,0x24,0x14,0x1a,0xff,0x2f,0x1f,0x21,0xff,0x2f,0x1e,0x22,0xff,0x46,0x35,0x33,0xff,0x3f,0x2c,0x29,0xff,0x46,0x34,0x31,0xff,0x33,0x23,0x23,0xff,0x24,0x15,0x17,0xff,0x1f,0x11,0x13,0xff,0x1a,0x11,0x13,0xff,0x11,0x0d,0x0f,0xff,0x0c,0x08,0x0a,0xff,0x07,0x03,0x04,0xff,0x0a,0x03,0x07,0xff,0x13,0x0b,0x0e,0xff,0x1b,0x10,0x13,0xff,0x1a,0x0f,0x11,0xff,0x1f,0x13,0x15,0xff,0x24,0x19,0x1b,0xff,0x23,0x1a,0x1b,0xff,0x14,0x0d,0x0e,0xff,0x10,0x0c,0x0c,0xff,0x13,0x11,0x11,0xff,0x08,0x04,0x06,0xff,0x03,0x00,0x03,0xff,0x03,0x01,0x02,0xff,0x08,0x06,0x0e,0xff,0x11,0x11,0x22,0xff,0x14,0x17,0x2b,0xff,0x1d,0x20,0x3a,0xff,0x2a,0x2f,0x49,0xff,0x41,0x48,0x64,0xff,0x46,0x4d,0x6c,0xff,0x55,0x5e,0x7a,0xff,0xe0,0xe1,0xe6,0xb7,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf9,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfe,0xf0,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xee,0xef,0xf4,0x0c,0x93,0x98,0xc1,0xd7,0x9f,0xa0,0xcd,0xff,0xb5,0xb7,0xdb,0xff,0xc3,0xca,0xe7,0xff,0x5b,0x5e,0x7d,0xff,0x23,0x27,0x59,0xff,0x58,0x64,0xa6,0xff,0x6e,0x78,0xb9,0xff,0x6c,0x74,0xbb,0xff,0x74,0x83,0xc1,0xff,0x6d,0x7d,0xac,0xff,0x15,0x13,0x1f,0xff,0x20,0x15,0x17,0xff,0x34,0x29,0x29,0xff,0x30,0x23,0x22,0xff,0x33,0x26,0x26,0xff,0x2e,0x24,0x24,0xff,0x32,0x29,0x27,0xff,0x33,0x28,0x27,0xff,0x35,0x2b,0x28,0xff,0x49,0x3d,0x39,0xff,0x69,0x5d,0x57,0xff,0x6c,0x62,0x5b,0xff,0x67,0x5c,0x57,0xff,0x50,0x42,0x42,0xff,0x33,0x24,0x26,0xff,0x2a,0x1c,0x1f,0xff,0x1e,0x11,0x14,0xff,0x1d,0x10,0x14,0xff,0x19,0x0d,0x12,0xff,0x14,0x09,0x0e,0xff,0x1c,0x10,0x17,0xff,0x1e,0x11,0x17,0xff,0x33,0x24,0x29,0xff,0x39,0x2a,0x30,0xff,0x36,0x2a,0x30,0xff,0x2a,0x23,0x30,0xff,0x1f,0x1b,0x2c,0xff,0x23,0x20,0x2e,0xff,0x1c,0x17,0x27,0xff,0x0e,0x08,0x1d,0xff,0x30,0x35,0x57,0xff,0x5c,0x6d,0x91,0xff,0x58,0x67,0x8b,0xff,0x55,0x60,0x85,0xff,0x56,0x61,0x84,0xff,0x56,0x62,0x85,0xff,0x57,0x63,0x87,0xff,0x5a,0x65,0x8a,0xff,0x58,0x65,0x89,0xff,0x58,0x66,0x8a,0xff,0x4c,0x54,0x76,0xff,0x8b,0x86,0x87,0xff,0xb7,0xaa,0x9d,0xff,0x88,0x79,0x70,0xff,0xc0,0xb4,0xaa,0xff,0xae,0xb2,0xc5,0xff,0x6e,0x86,0xb4,0xff,0x6e,0x7b,0xa9,0xff,0x60,0x6c,0x98,0xff,0x53,0x5b,0x7d,0xff,0x49,0x4a,0x6b,0xff,0x42,0x42,0x62,0xff,0x3b,0x3a,0x59,0xff,0x33,0x33,0x52,0xff,0x33,0x31,0x51,0xff,0x2f,0x2d,0x4e,0xff,0x2a,0x2f,0x4e,0xff,0x4d,0x57,0x78,0xff,0x56,0x5c,0x7f,0xff,0x44,0x47,0x69,0xff,0x2c,0x2e,0x50,0xff,0x1e,0x20,0x42,0xff,0x16,0x15,0x38,0xff,0x0e,0x0e,0x2f,0xff,0x0b,0x0b,0x27,0xff,0x13,0x10,0x2c,0xff,0x16,0x11,0x28,0xff,0x14,0x0d,0x20,0xff,0x15,0x0d,0x1f,0xff,0x23,0x1c,0x2b,0xff,0x3f,0x38,0x43,0xff,0x3a,0x32,0x3a,0xff,0x1c,0x14,0x18,0xff,0x16,0x0b,0x11,0xff,0x1f,0x11,0x17,0xff,0x30,0x20,0x23,0xff,0x34,0x22,0x23,0xff,0x3b,0x27,0x28,0xff,0x34,0x20,0x22,0xff,0x3a,0x27,0x2b,0xff,0x3b,0x2a,0x2e,0xff,0x25,0x14,0x19,0xff,0x21,0x10,0x14,0xff,0x55,0x41,0x3a,0xff,0x3f,0x2a,0x2b,0xff,0x2c,0x18,0x1c,0xff,0x40,0x2c,0x2b,0xff,0x31,0x21,0x24,0xff,0x40,0x30,0x31,0xff,0x34,0x23,0x21,0xff,0x3e,0x2d,0x2d,0xff,0x2c,0x1c,0x1d,0xff,0x26,0x17,0x19,0xff,0x17,0x0d,0x10,0xff,0x19,0x10,0x11,0xff,0x12,0x0c,0x0d,0xff,0x0e,0x09,0x0a,0xff,0x0f,0x09,0x0b,0xff,0x18,0x11,0x13,0xff,0x15,0x0f,0x0f,0xff,0x16,0x0f,0x10,0xff,0x17,0x0f,0x10,0xff,0x12,0x0b,0x0d,0xff,0x0e,0x09,0x0b,0xff,0x0b,0x06,0x07,0xff,0x0d,0x07,0x0a,0xff,0x0e,0x09,0x0a,0xff,0x1a,0x16,0x15,0xff,0x14,0x0e,0x10,0xff,0x0d,0x08,0x0b,0xff,0x0a,0x06,0x08,0xff,0x0b,0x08,0x10,0xff,0x11,0x12,0x24,0xff,0x15,0x17,0x2e,0xff,0x1d,0x21,0x39,0xff,0x2a,0x32,0x4c,0xff,0x38,0x42,0x5e,0xff,0x43,0x4f,0x6d,0xff,0x9b,0xa2,0xb4,0xff,0xff,0xff,0xff,0x4e,0xff,0xff,0xff,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfe,0xf0,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xeb,0xf2,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xb4,0xb7,0xcf,0x6e,0x7f,0x82,0xb5,0xff,0xa0,0xa1,0xd1,0xff,0xb2,0xb8,0xdd,0xff,0x9d,0xa3,0xc6,0xff,0x1a,0x1c,0x41,0xff,0x2e,0x33,0x6c,0xff,0x52,0x5a,0x97,0xff,0x54,0x56,0x8c,0xff,0x3f,0x48,0x69,0xff,0x74,0x87,0xb8,0xff,0x3c,0x3f,0x5b,0xff,0x1e,0x12,0x14,0xff,0x2c,0x24,0x22,0xff,0x2d,0x22,0x21,0xff,0x2b,0x1f,0x1f,0xff,0x2f,0x24,0x24,0xff,0x42,0x36,0x33,0xff,0x45,0x39,0x36,0xff,0x48,0x3b,0x38,0xff,0x54,0x47,0x44,0xff,0x6c,0x62,0x5c,0xff,0x66,0x5d,0x58,0xff,0x46,0x3a,0x38,0xff,0x27,0x18,0x19,0xff,0x2f,0x21,0x22,0xff,0x41,0x34,0x34,0xff,0x21,0x14,0x16,0xff,0x27,0x1a,0x1d,0xff,0x19,0x0c,0x11,0xff,0x2e,0x22,0x27,0xff,0x36,0x29,0x31,0xff,0x28,0x1b,0x24,0xff,0x2e,0x25,0x2c,0xff,0x28,0x22,0x29,0xff,0x1d,0x16,0x24,0xff,0x15,0x0f,0x22,0xff,0x14,0x11,0x24,0xff,0x0e,0x0e,0x1c,0xff,0x0b,0x09,0x18,0xff,0x23,0x22,0x43,0xff,0x57,0x60,0x86,0xff,0x62,0x74,0x99,0xff,0x5a,0x6b,0x91,0xff,0x58,0x65,0x8c,0xff,0x58,0x65,0x88,0xff,0x57,0x67,0x89,0xff,0x53,0x68,0x8c,0xff,0x5a,0x69,0x8e,0xff,0x5a,0x69,0x8c,0xff,0x57,0x64,0x8a,0xff,0x5b,0x5e,0x76,0xff,0xb4,0xa8,0x9e,0xff,0xa2,0x93,0x88,0xff,0x92,0x86,0x7b,0xff,0xdb,0xd4,0xce,0xff,0x97,0xa4,0xc7,0xff,0x6e,0x81,0xaf,0xff,0x6c,0x7a,0xa7,0xff,0x65,0x6e,0x9b,0xff,0x55,0x5f,0x82,0xff,0x4f,0x56,0x77,0xff,0x44,0x49,0x6d,0xff,0x3e,0x3f,0x63,0xff,0x3c,0x3c,0x5e,0xff,0x38,0x38,0x59,0xff,0x39,0x3a,0x5c,0xff,0x2f,0x33,0x54,0xff,0x51,0x59,0x79,0xff,0x5f,0x65,0x89,0xff,0x50,0x52,0x76,0xff,0x37,0x38,0x5c,0xff,0x28,0x27,0x4b,0xff,0x1c,0x1b,0x3e,0xff,0x15,0x14,0x35,0xff,0x10,0x10,0x2f,0xff,0x0a,0x0b,0x28,0xff,0x08,0x07,0x20,0xff,0x0b,0x08,0x1e,0xff,0x0a,0x04,0x19,0xff,0x23,0x1c,0x2b,0xff,0x33,0x2a,0x35,0xff,0x34,0x29,0x30,0xff,0x2c,0x21,0x25,0xff,0x20,0x14,0x17,0xff,0x25,0x16,0x1c,0xff,0x25,0x16,0x1a,0xff,0x28,0x17,0x1a,0xff,0x2f,0x1c,0x1f,0xff,0x31,0x1e,0x21,0xff,0x38,0x25,0x27,0xff,0x31,0x1e,0x20,0xff,0x38,0x27,0x29,0xff,0x37,0x24,0x25,0xff,0x51,0x39,0x35,0xff,0x46,0x31,0x30,0xff,0x36,0x24,0x25,0xff,0x31,0x20,0x1f,0xff,0x29,0x18,0x19,0xff,0x3d,0x2b,0x2c,0xff,0x23,0x13,0x12,0xff,0x2d,0x1d,0x1d,0xff,0x31,0x20,0x1e,0xff,0x33,0x23,0x23,0xff,0x12,0x07,0x0c,0xff,0x0c,0x06,0x09,0xff,0x0a,0x04,0x07,0xff,0x0e,0x05,0x09,0xff,0x1c,0x14,0x17,0xff,0x1c,0x18,0x18,0xff,0x16,0x10,0x11,0xff,0x10,0x0b,0x0b,0xff,0x07,0x04,0x05,0xff,0x0d,0x0b,0x0e,0xff,0x07,0x04,0x07,0xff,0x04,0x02,0x03,0xff,0x03,0x02,0x02,0xff,0x02,0x00,0x00,0xff,0x05,0x01,0x01,0xff,0x0f,0x07,0x0a,0xff,0x1c,0x13,0x17,0xff,0x22,0x19,0x1d,0xff,0x0d,0x09,0x12,0xff,0x22,0x22,0x35,0xff,0x20,0x22,0x36,0xff,0x25,0x29,0x40,0xff,0x2c,0x32,0x4a,0xff,0x30,0x38,0x53,0xff,0x47,0x50,0x6c,0xff,0xdb,0xdd,0xe3,0xc5,0xff,0xff,0xff,0x02,0xff,0xf8,0xfb,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xe5,0xe6,0xec,0x10,0x77,0x7d,0xa9,0xdd,0x7f,0x85,0xc0,0xff,0x95,0x9c,0xd0,0xff,0xa3,0xaa,0xd9,0xff,0x55,0x57,0x7e,0xff,0x15,0x14,0x3c,0xff,0x33,0x36,0x61,0xff,0x1c,0x19,0x22,0xff,0x05,0x00,0x00,0xff,0x35,0x3f,0x5c,0xff,0x4d,0x5a,0x7c,0xff,0x1c,0x10,0x13,0xff,0x2c,0x24,0x21,0xff,0x29,0x20,0x1f,0xff,0x2d,0x21,0x21,0xff,0x43,0x37,0x35,0xff,0x3e,0x32,0x2e,0xff,0x49,0x3d,0x39,0xff,0x61,0x56,0x4f,0xff,0x61,0x56,0x51,0xff,0x61,0x56,0x52,0xff,0x43,0x39,0x36,0xff,0x2e,0x23,0x23,0xff,0x23,0x15,0x19,0xff,0x27,0x18,0x1b,0xff,0x3c,0x2e,0x2f,0xff,0x2b,0x1d,0x20,0xff,0x25,0x18,0x1c,0xff,0x29,0x1d,0x23,0xff,0x32,0x26,0x2d,0xff,0x2f,0x26,0x2f,0xff,0x18,0x11,0x1a,0xff,0x0a,0x08,0x0f,0xff,0x06,0x05,0x0d,0xff,0x05,0x03,0x0a,0xff,0x04,0x03,0x0a,0xff,0x07,0x05,0x0e,0xff,0x0d,0x09,0x16,0xff,0x0d,0x0f,0x23,0xff,0x49,0x52,0x75,0xff,0x66,0x7b,0xa1,0xff,0x62,0x78,0x9e,0xff,0x5a,0x6d,0x93,0xff,0x56,0x67,0x8b,0xff,0x58,0x66,0x8a,0xff,0x58,0x67,0x8a,0xff,0x5a,0x6f,0x93,0xff,0x5b,0x6f,0x93,0xff,0x59,0x6c,0x8f,0xff,0x51,0x61,0x86,0xff,0x85,0x82,0x8d,0xff,0xc3,0xb4,0xa8,0xff,0x91,0x83,0x7a,0xff,0xb1,0xa7,0x9d,0xff,0xdc,0xda,0xdc,0xff,0x7a,0x8c,0xb4,0xff,0x68,0x7b,0xa9,0xff,0x6c,0x7d,0xa9,0xff,0x66,0x72,0x9f,0xff,0x5e,0x67,0x92,0xff,0x56,0x63,0x89,0xff,0x4e,0x58,0x7a,0xff,0x4a,0x4d,0x71,0xff,0x45,0x49,0x6e,0xff,0x40,0x43,0x66,0xff,0x4d,0x50,0x71,0xff,0x3a,0x3f,0x5e,0xff,0x4b,0x53,0x73,0xff,0x63,0x6b,0x90,0xff,0x57,0x5d,0x82,0xff,0x3e,0x42,0x66,0xff,0x2d,0x2e,0x52,0xff,0x29,0x28,0x4a,0xff,0x1f,0x1f,0x40,0xff,0x1a,0x1a,0x39,0xff,0x16,0x17,0x35,0xff,0x1a,0x14,0x30,0xff,0x1b,0x13,0x2c,0xff,0x17,0x0e,0x25,0xff,0x27,0x1b,0x27,0xff,0x32,0x22,0x29,0xff,0x36,0x22,0x28,0xff,0x3e,0x29,0x2b,0xff,0x4c,0x37,0x35,0xff,0x52,0x3f,0x3e,0xff,0x2c,0x1c,0x20,0xff,0x23,0x11,0x15,0xff,0x37,0x24,0x28,0xff,0x2f,0x1c,0x1e,0xff,0x3a,0x28,0x27,0xff,0x43,0x32,0x2e,0xff,0x42,0x30,0x31,0xff,0x2f,0x1b,0x1e,0xff,0x3d,0x27,0x27,0xff,0x3d,0x2a,0x28,0xff,0x27,0x1b,0x1a,0xff,0x26,0x17,0x19,0xff,0x2e,0x1c,0x1e,0xff,0x36,0x26,0x27,0xff,0x1a,0x0d,0x0e,0xff,0x19,0x0f,0x0f,0xff,0x39,0x29,0x29,0xff,0x2a,0x1c,0x1c,0xff,0x14,0x0a,0x0e,0xff,0x12,0x0c,0x10,0xff,0x0d,0x07,0x0b,0xff,0x0b,0x04,0x08,0xff,0x16,0x0e,0x12,0xff,0x18,0x11,0x13,0xff,0x0c,0x06,0x07,0xff,0x11,0x0c,0x0c,0xff,0x06,0x04,0x04,0xff,0x02,0x00,0x01,0xff,0x05,0x02,0x03,0xff,0x04,0x02,0x02,0xff,0x09,0x04,0x04,0xff,0x13,0x0d,0x0e,0xff,0x18,0x12,0x13,0xff,0x10,0x08,0x0b,0xff,0x12,0x09,0x0b,0xff,0x13,0x09,0x11,0xff,0x0b,0x07,0x11,0xff,0x2a,0x29,0x36,0xff,0x43,0x46,0x5a,0xff,0x41,0x48,0x60,0xff,0x41,0x4a,0x63,0xff,0x3b,0x44,0x5f,0xff,0x8e,0x94,0xa5,0xff,0xff,0xff,0xff,0x56,0xff,0xff,0xff,0x00,0xfe,0xee,0xf5,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xec,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xa7,0xaa,0xc3,0x73,0x66,0x6e,0xab,0xff,0x83,0x8c,0xca,0xff,0x85,0x93,0xcb,0xff,0x80,0x89,0xc1,0xff,0x2b,0x2b,0x4f,0xff,0x26,0x1f,0x46,0xff,0x07,0x04,0x09,0xff,0x0b,0x02,0x07,0xff,0x16,0x14,0x1b,0xff,0x38,0x3b,0x4b,0xff,0x1a,0x10,0x14,0xff,0x2f,0x26,0x24,0xff,0x28,0x1f,0x1d,0xff,0x3d,0x31,0x2f,0xff,0x5d,0x52,0x4a,0xff,0x5b,0x51,0x49,0xff,0x5c,0x51,0x4b,0xff,0x5d,0x52,0x4b,0xff,0x65,0x5c,0x55,0xff,0x3e,0x34,0x31,0xff,0x39,0x2e,0x2d,0xff,0x22,0x16,0x17,0xff,0x29,0x1d,0x1f,0xff,0x2c,0x1f,0x22,0xff,0x32,0x24,0x27,0xff,0x32,0x25,0x29,0xff,0x26,0x1b,0x21,0xff,0x29,0x1f,0x26,0xff,0x12,0x08,0x12,0xff,0x07,0x01,0x0b,0xff,0x09,0x03,0x0c,0xff,0x0a,0x04,0x0b,0xff,0x13,0x09,0x0f,0xff,0x1d,0x13,0x19,0xff,0x1c,0x12,0x1a,0xff,0x27,0x1c,0x24,0xff,0x20,0x19,0x26,0xff,0x37,0x3e,0x5b,0xff,0x5f,0x72,0x98,0xff,0x67,0x7e,0xa6,0xff,0x64,0x78,0xa1,0xff,0x5b,0x6d,0x94,0xff,0x59,0x6a,0x8e,0xff,0x59,0x68,0x8d,0xff,0x5e,0x6e,0x92,0xff,0x60,0x74,0x98,0xff,0x60,0x74,0x98,0xff,0x5a,0x71,0x93,0xff,0x55,0x65,0x85,0xff,0xb0,0xaa,0xad,0xff,0xb3,0xab,0xa3,0xff,0x87,0x7f,0x77,0xff,0xc4,0xbf,0xb5,0xff,0xd3,0xd3,0xdb,0xff,0x6c,0x7e,0xa7,0xff,0x64,0x76,0xa3,0xff,0x68,0x7a,0xa6,0xff,0x65,0x75,0xa4,0xff,0x65,0x73,0xa1,0xff,0x62,0x6e,0x98,0xff,0x5c,0x66,0x89,0xff,0x53,0x5a,0x7e,0xff,0x4d,0x53,0x78,0xff,0x50,0x56,0x7a,0xff,0x61,0x68,0x88,0xff,0x48,0x4c,0x6c,0xff,0x48,0x50,0x73,0xff,0x64,0x70,0x95,0xff,0x5d,0x68,0x8a,0xff,0x45,0x4c,0x6f,0xff,0x37,0x3a,0x5d,0xff,0x33,0x34,0x55,0xff,0x2b,0x2b,0x4d,0xff,0x27,0x27,0x49,0xff,0x2d,0x2d,0x4d,0xff,0x37,0x32,0x54,0xff,0x33,0x30,0x53,0xff,0x40,0x3b,0x56,0xff,0x62,0x58,0x5f,0xff,0x46,0x3c,0x3d,0xff,0x2a,0x1f,0x24,0xff,0x17,0x0c,0x13,0xff,0x20,0x14,0x19,0xff,0x29,0x1e,0x20,0xff,0x25,0x16,0x18,0xff,0x36,0x21,0x25,0xff,0x40,0x2c,0x2f,0xff,0x3a,0x27,0x28,0xff,0x40,0x2e,0x2c,0xff,0x49,0x38,0x34,0xff,0x37,0x25,0x25,0xff,0x23,0x10,0x15,0xff,0x2e,0x1c,0x1e,0xff,0x3b,0x2a,0x27,0xff,0x1f,0x16,0x17,0xff,0x1f,0x11,0x14,0xff,0x35,0x25,0x26,0xff,0x32,0x23,0x24,0xff,0x23,0x18,0x1a,0xff,0x13,0x0b,0x0d,0xff,0x25,0x16,0x19,0xff,0x1b,0x0f,0x11,0xff,0x10,0x07,0x0b,0xff,0x0d,0x07,0x0c,0xff,0x10,0x09,0x0b,0xff,0x13,0x0b,0x0c,0xff,0x0c,0x05,0x06,0xff,0x19,0x12,0x13,0xff,0x10,0x09,0x0a,0xff,0x05,0x02,0x02,0xff,0x10,0x0d,0x0d,0xff,0x0c,0x09,0x09,0xff,0x07,0x03,0x04,0xff,0x0d,0x0a,0x0b,0xff,0x16,0x0f,0x11,0xff,0x18,0x10,0x11,0xff,0x10,0x09,0x0a,0xff,0x0a,0x04,0x0a,0xff,0x10,0x0d,0x11,0xff,0x12,0x0d,0x13,0xff,0x0e,0x09,0x17,0xff,0x17,0x15,0x20,0xff,0x5f,0x63,0x71,0xff,0x62,0x6a,0x81,0xff,0x5d,0x68,0x82,0xff,0x65,0x70,0x89,0xff,0xdd,0xde,0xe4,0xc9,0xff,0xff,0xff,0x04,0xff,0xf9,0xfc,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfe,0xf1,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xff,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xe8,0xe9,0xef,0x10,0x70,0x77,0xa7,0xd9,0x71,0x78,0xba,0xff,0x83,0x8d,0xcb,0xff,0x8d,0x99,0xd7,0xff,0x65,0x67,0x9b,0xff,0x20,0x1b,0x3e,0xff,0x11,0x0d,0x24,0xff,0x06,0x03,0x04,0xff,0x0c,0x06,0x08,0xff,0x20,0x17,0x19,0xff,0x2b,0x20,0x24,0xff,0x35,0x2c,0x2a,0xff,0x3e,0x36,0x30,0xff,0x51,0x47,0x40,0xff,0x63,0x5a,0x52,0xff,0x50,0x47,0x3e,0xff,0x69,0x61,0x59,0xff,0x5d,0x54,0x4e,0xff,0x39,0x2e,0x2b,0xff,0x2f,0x25,0x24,0xff,0x31,0x25,0x25,0xff,0x35,0x27,0x28,0xff,0x3e,0x2f,0x30,0xff,0x2e,0x22,0x23,0xff,0x25,0x18,0x1b,0xff,0x2e,0x21,0x28,0xff,0x24,0x1a,0x22,0xff,0x11,0x09,0x12,0xff,0x11,0x08,0x11,0xff,0x25,0x1a,0x21,0xff,0x31,0x26,0x2a,0xff,0x29,0x1d,0x20,0xff,0x29,0x1c,0x20,0xff,0x2f,0x20,0x27,0xff,0x2f,0x20,0x27,0xff,0x31,0x20,0x2a,0xff,0x34,0x2d,0x3d,0xff,0x57,0x66,0x84,0xff,0x68,0x80,0xa5,0xff,0x6b,0x7f,0xa7,0xff,0x63,0x77,0xa0,0xff,0x5d,0x6b,0x94,0xff,0x59,0x6a,0x90,0xff,0x5c,0x6d,0x93,0xff,0x5e,0x70,0x96,0xff,0x5f,0x72,0x98,0xff,0x61,0x73,0x95,0xff,0x58,0x6b,0x8a,0xff,0x74,0x79,0x8b,0xff,0xc8,0xbc,0xb2,0xff,0xa7,0x98,0x91,0xff,0x9a,0x91,0x8b,0xff,0xda,0xd6,0xcd,0xff,0xbc,0xc1,0xcb,0xff,0x60,0x72,0x9e,0xff,0x63,0x6f,0x9c,0xff,0x63,0x72,0xa2,0xff,0x65,0x75,0xa8,0xff,0x69,0x7b,0xa8,0xff,0x67,0x74,0xa1,0xff,0x61,0x6d,0x97,0xff,0x55,0x60,0x85,0xff,0x53,0x5c,0x7f,0xff,0x60,0x67,0x8b,0xff,0x6f,0x75,0x9a,0xff,0x58,0x5c,0x7f,0xff,0x43,0x4b,0x70,0xff,0x68,0x75,0x99,0xff,0x63,0x70,0x93,0xff,0x4e,0x54,0x77,0xff,0x46,0x49,0x6c,0xff,0x3e,0x40,0x62,0xff,0x33,0x35,0x57,0xff,0x30,0x34,0x57,0xff,0x3f,0x44,0x6a,0xff,0x52,0x55,0x80,0xff,0x69,0x6c,0x86,0xff,0x71,0x6b,0x74,0xff,0x64,0x58,0x5b,0xff,0x2e,0x22,0x24,0xff,0x1d,0x11,0x14,0xff,0x23,0x17,0x1a,0xff,0x31,0x21,0x25,0xff,0x30,0x20,0x23,0xff,0x34,0x1f,0x22,0xff,0x3e,0x29,0x2c,0xff,0x3c,0x28,0x2b,0xff,0x35,0x23,0x24,0xff,0x3c,0x29,0x2a,0xff,0x2d,0x1a,0x1b,0xff,0x2b,0x19,0x1c,0xff,0x21,0x11,0x14,0xff,0x2f,0x1e,0x1e,0xff,0x38,0x28,0x28,0xff,0x1d,0x0f,0x14,0xff,0x2b,0x1b,0x20,0xff,0x37,0x26,0x28,0xff,0x30,0x1f,0x1f,0xff,0x25,0x1a,0x1a,0xff,0x1b,0x14,0x14,0xff,0x16,0x07,0x0a,0xff,0x19,0x0d,0x12,0xff,0x0e,0x07,0x0c,0xff,0x0b,0x05,0x0b,0xff,0x12,0x08,0x0b,0xff,0x23,0x18,0x19,0xff,0x25,0x18,0x1a,0xff,0x24,0x14,0x16,0xff,0x25,0x15,0x17,0xff,0x0d,0x08,0x08,0xff,0x0f,0x0a,0x0a,0xff,0x18,0x11,0x12,0xff,0x11,0x0a,0x0d,0xff,0x0c,0x05,0x09,0xff,0x04,0x01,0x04,0xff,0x0a,0x05,0x08,0xff,0x15,0x0e,0x11,0xff,0x0e,0x08,0x10,0xff,0x1e,0x1f,0x32,0xff,0x1d,0x1b,0x21,0xff,0x2e,0x2c,0x33,0xff,0x0b,0x09,0x14,0xff,0x5c,0x5d,0x68,0xff,0x88,0x8b,0x9f,0xff,0x74,0x7c,0x96,0xff,0xb2,0xb9,0xc8,0xff,0xff,0xff,0xff,0x54,0xff,0xff,0xff,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfb,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xeb,0xf3,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x00,0xab,0xad,0xc3,0x66,0x54,0x5b,0x9a,0xff,0x72,0x7b,0xbd,0xff,0x7b,0x86,0xc6,0xff,0x7b,0x7f,0xc3,0xff,0x39,0x37,0x5b,0xff,0x04,0x04,0x09,0xff,0x05,0x04,0x07,0xff,0x0e,0x08,0x0b,0xff,0x27,0x20,0x20,0xff,0x39,0x30,0x31,0xff,0x2e,0x25,0x24,0xff,0x38,0x30,0x2b,0xff,0x4f,0x46,0x3f,0xff,0x57,0x4e,0x46,0xff,0x51,0x49,0x40,0xff,0x6a,0x61,0x5b,0xff,0x41,0x37,0x33,0xff,0x2d,0x22,0x21,0xff,0x3f,0x34,0x34,0xff,0x34,0x29,0x29,0xff,0x3b,0x2f,0x2f,0xff,0x3f,0x32,0x33,0xff,0x2c,0x22,0x23,0xff,0x23,0x18,0x1c,0xff,0x1b,0x11,0x17,0xff,0x17,0x0e,0x15,0xff,0x24,0x1b,0x22,0xff,0x32,0x28,0x2b,0xff,0x34,0x2a,0x29,0xff,0x30,0x24,0x25,0xff,0x2d,0x1e,0x21,0xff,0x2a,0x1e,0x23,0xff,0x28,0x1c,0x23,0xff,0x1b,0x0f,0x17,0xff,0x2a,0x1e,0x26,0xff,0x40,0x3c,0x4f,0xff,0x64,0x76,0x98,0xff,0x68,0x80,0xa5,0xff,0x6a,0x7f,0xa7,0xff,0x5f,0x73,0x99,0xff,0x59,0x6b,0x90,0xff,0x59,0x69,0x8e,0xff,0x5c,0x6e,0x95,0xff,0x61,0x74,0x9a,0xff,0x62,0x75,0x99,0xff,0x5f,0x73,0x98,0xff,0x57,0x67,0x8b,0xff,0x9c,0x95,0x97,0xff,0xc6,0xb8,0xa6,0xff,0xa6,0x97,0x88,0xff,0xb4,0xac,0xa3,0xff,0xf0,0xed,0xe3,0xff,0xa2,0xa9,0xbc,0xff,0x58,0x66,0x91,0xff,0x60,0x6d,0x91,0xff,0x5d,0x69,0x99,0xff,0x5e,0x6f,0x9f,0xff,0x63,0x78,0xa5,0xff,0x64,0x75,0xa2,0xff,0x60,0x6e,0x99,0xff,0x57,0x61,0x87,0xff,0x5b,0x65,0x8c,0xff,0x6a,0x76,0x9b,0xff,0x7d,0x87,0xac,0xff,0x61,0x6b,0x8f,0xff,0x40,0x4c,0x70,0xff,0x6c,0x7b,0x9f,0xff,0x66,0x74,0x97,0xff,0x57,0x5c,0x7d,0xff,0x52,0x56,0x76,0xff,0x45,0x4b,0x6d,0xff,0x3b,0x40,0x66,0xff,0x47,0x51,0x75,0xff,0x64,0x70,0x88,0xff,0x74,0x74,0x81,0xff,0x51,0x45,0x49,0xff,0x28,0x1b,0x1f,0xff,0x2f,0x22,0x25,0xff,0x2d,0x1f,0x22,0xff,0x35,0x23,0x25,0xff,0x45,0x2d,0x2f,0xff,0x3d,0x25,0x27,0xff,0x29,0x16,0x1a,0xff,0x24,0x15,0x18,0xff,0x23,0x16,0x19,0xff,0x22,0x14,0x16,0xff,0x27,0x17,0x19,0xff,0x2d,0x1d,0x20,0xff,0x24,0x14,0x16,0xff,0x24,0x15,0x18,0xff,0x20,0x10,0x14,0xff,0x33,0x22,0x24,0xff,0x2d,0x1e,0x1f,0xff,0x15,0x08,0x0b,0xff,0x33,0x22,0x25,0xff,0x34,0x25,0x27,0xff,0x20,0x13,0x14,0xff,0x12,0x08,0x09,0xff,0x18,0x0e,0x12,0xff,0x15,0x0c,0x10,0xff,0x12,0x0a,0x0d,0xff,0x12,0x0a,0x0e,0xff,0x14,0x0b,0x10,0xff,0x14,0x09,0x0c,0xff,0x17,0x0f,0x10,0xff,0x1b,0x11,0x13,0xff,0x2b,0x1b,0x1d,0xff,0x31,0x1f,0x20,0xff,0x20,0x14,0x14,0xff,0x15,0x0f,0x0f,0xff,0x18,0x11,0x12,0xff,0x17,0x0f,0x10,0xff,0x1d,0x13,0x16,0xff,0x15,0x0c,0x10,0xff,0x15,0x0d,0x11,0xff,0x13,0x0b,0x11,0xff,0x1d,0x17,0x20,0xff,0x26,0x27,0x37,0xff,0x17,0x18,0x26,0xff,0x4f,0x4e,0x51,0xff,0x4b,0x48,0x4c,0xff,0x41,0x3f,0x46,0xff,0x9a,0x9e,0xa8,0xff,0x9a,0x9f,0xb2,0xff,0xeb,0xec,0xf1,0xbe,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfb,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf5,0xf8,0x00,0xff,0xff,0xff,0x00,0xef,0xef,0xf1,0x06,0x71,0x72,0x9f,0xc8,0x53,0x54,0x9e,0xff,0x63,0x67,0xb3,0xff,0x5e,0x5c,0xa3,0xff,0x51,0x4b,0x76,0xff,0x15,0x13,0x1e,0xff,0x00,0x00,0x00,0xff,0x14,0x0f,0x13,0xff,0x2c,0x25,0x26,0xff,0x33,0x29,0x2b,0xff,0x39,0x30,0x2f,0xff,0x39,0x31,0x2c,0xff,0x43,0x3a,0x34,0xff,0x58,0x50,0x48,0xff,0x63,0x5a,0x53,0xff,0x50,0x46,0x42,0xff,0x36,0x2b,0x28,0xff,0x33,0x28,0x28,0xff,0x2b,0x21,0x20,0xff,0x30,0x25,0x25,0xff,0x26,0x1b,0x1c,0xff,0x23,0x18,0x19,0xff,0x2f,0x24,0x25,0xff,0x2d,0x23,0x25,0xff,0x37,0x2c,0x2e,0xff,0x44,0x38,0x37,0xff,0x3a,0x2c,0x2d,0xff,0x2e,0x22,0x23,0xff,0x26,0x1b,0x1d,0xff,0x22,0x16,0x19,0xff,0x22,0x16,0x1a,0xff,0x24,0x16,0x1b,0xff,0x28,0x19,0x20,0xff,0x14,0x07,0x10,0xff,0x17,0x0e,0x17,0xff,0x41,0x49,0x5d,0xff,0x66,0x7c,0x9f,0xff,0x66,0x7b,0xa3,0xff,0x66,0x7b,0xa3,0xff,0x5b,0x6f,0x96,0xff,0x55,0x67,0x8c,0xff,0x59,0x6b,0x8e,0xff,0x60,0x73,0x99,0xff,0x62,0x75,0x9b,0xff,0x61,0x74,0x99,0xff,0x5b,0x70,0x98,0xff,0x62,0x70,0x92,0xff,0xbd,0xb5,0xad,0xff,0xa8,0x99,0x89,0xff,0xaa,0x9a,0x8b,0xff,0xcd,0xc4,0xb9,0xff,0xfb,0xf7,0xef,0xff,0x8e,0x95,0xae,0xff,0x51,0x5f,0x8a,0xff,0x59,0x66,0x88,0xff,0x58,0x65,0x8f,0xff,0x58,0x65,0x92,0xff,0x5b,0x6b,0x98,0xff,0x60,0x6f,0x9a,0xff,0x5d,0x69,0x92,0xff,0x54,0x60,0x86,0xff,0x61,0x6c,0x94,0xff,0x70,0x80,0xa8,0xff,0x7f,0x90,0xb4,0xff,0x65,0x73,0x95,0xff,0x45,0x53,0x77,0xff,0x70,0x7d,0xa3,0xff,0x6e,0x7b,0x9d,0xff,0x68,0x6f,0x8f,0xff,0x5e,0x64,0x85,0xff,0x4f,0x55,0x79,0xff,0x52,0x58,0x7f,0xff,0x5d,0x5e,0x71,0xff,0x46,0x3e,0x43,0xff,0x2c,0x1b,0x23,0xff,0x21,0x0f,0x16,0xff,0x1f,0x10,0x17,0xff,0x25,0x17,0x1a,0xff,0x3b,0x29,0x2c,0xff,0x37,0x25,0x28,0xff,0x2a,0x16,0x19,0xff,0x27,0x15,0x18,0xff,0x2f,0x1c,0x1f,0xff,0x2a,0x1c,0x1f,0xff,0x27,0x19,0x1c,0xff,0x20,0x14,0x16,0xff,0x2e,0x1f,0x21,0xff,0x31,0x20,0x22,0xff,0x1f,0x11,0x16,0xff,0x1a,0x0e,0x12,0xff,0x1d,0x0e,0x12,0xff,0x35,0x22,0x25,0xff,0x26,0x17,0x19,0xff,0x1b,0x10,0x11,0xff,0x35,0x22,0x24,0xff,0x2a,0x1b,0x1d,0xff,0x14,0x0a,0x0c,0xff,0x16,0x0d,0x10,0xff,0x0d,0x04,0x08,0xff,0x11,0x0a,0x0e,0xff,0x0b,0x06,0x07,0xff,0x14,0x0f,0x10,0xff,0x09,0x04,0x07,0xff,0x08,0x04,0x06,0xff,0x0f,0x09,0x0b,0xff,0x19,0x12,0x16,0xff,0x14,0x0c,0x0f,0xff,0x21,0x17,0x19,0xff,0x26,0x1b,0x1a,0xff,0x20,0x13,0x15,0xff,0x17,0x10,0x12,0xff,0x17,0x10,0x12,0xff,0x16,0x0e,0x13,0xff,0x19,0x10,0x17,0xff,0x17,0x0d,0x16,0xff,0x15,0x0c,0x15,0xff,0x31,0x2c,0x34,0xff,0x59,0x58,0x5b,0xff,0x44,0x45,0x50,0xff,0x3c,0x3e,0x4b,0xff,0x62,0x63,0x6b,0xff,0x3d,0x3c,0x3f,0xff,0x99,0x9b,0xa4,0xff,0xd6,0xd8,0xe0,0xfd,0xff,0xff,0xff,0x41,0xff,0xff,0xff,0x00,0xfe,0xec,0xf3,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfb,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xea,0xf2,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xc1,0xc0,0xcf,0x45,0x47,0x43,0x84,0xff,0x4f,0x4c,0x92,0xff,0x2a,0x25,0x48,0xff,0x17,0x13,0x1e,0xff,0x49,0x40,0x5f,0xff,0x09,0x06,0x0a,0xff,0x18,0x12,0x14,0xff,0x33,0x2a,0x2b,0xff,0x3c,0x33,0x32,0xff,0x41,0x39,0x35,0xff,0x49,0x41,0x3c,0xff,0x50,0x46,0x41,0xff,0x55,0x4b,0x46,0xff,0x42,0x38,0x33,0xff,0x36,0x2b,0x29,0xff,0x44,0x3a,0x37,0xff,0x3f,0x34,0x31,0xff,0x48,0x3d,0x3a,0xff,0x2f,0x23,0x25,0xff,0x1b,0x0f,0x12,0xff,0x40,0x33,0x36,0xff,0x3c,0x31,0x32,0xff,0x4c,0x40,0x40,0xff,0x5a,0x50,0x4d,0xff,0x44,0x39,0x36,0xff,0x31,0x23,0x22,0xff,0x2a,0x1c,0x1d,0xff,0x1a,0x0c,0x12,0xff,0x1e,0x11,0x15,0xff,0x22,0x15,0x1a,0xff,0x27,0x1b,0x1f,0xff,0x2f,0x22,0x27,0xff,0x23,0x14,0x1f,0xff,0x1b,0x14,0x1e,0xff,0x49,0x55,0x6b,0xff,0x62,0x76,0x9a,0xff,0x63,0x76,0x9e,0xff,0x63,0x78,0x9e,0xff,0x5b,0x6f,0x95,0xff,0x54,0x66,0x8c,0xff,0x56,0x68,0x8c,0xff,0x5e,0x71,0x97,0xff,0x60,0x73,0x99,0xff,0x5e,0x71,0x98,0xff,0x57,0x6a,0x92,0xff,0x88,0x8b,0x99,0xff,0xcf,0xbf,0xb1,0xff,0x8a,0x7a,0x6e,0xff,0xab,0x99,0x8f,0xff,0xe2,0xda,0xd0,0xff,0xf7,0xf3,0xed,0xff,0x80,0x89,0xa7,0xff,0x4d,0x5d,0x87,0xff,0x51,0x5e,0x82,0xff,0x54,0x60,0x88,0xff,0x55,0x5f,0x89,0xff,0x56,0x64,0x8c,0xff,0x58,0x66,0x8d,0xff,0x58,0x64,0x8b,0xff,0x57,0x62,0x8b,0xff,0x64,0x6f,0x9a,0xff,0x76,0x86,0xb0,0xff,0x82,0x92,0xb6,0xff,0x5d,0x6b,0x8c,0xff,0x4a,0x58,0x7c,0xff,0x6f,0x7c,0xa5,0xff,0x79,0x84,0xa6,0xff,0x73,0x7e,0x9d,0xff,0x61,0x69,0x8e,0xff,0x5f,0x66,0x8c,0xff,0x60,0x5c,0x73,0xff,0x2e,0x21,0x27,0xff,0x15,0x07,0x0f,0xff,0x29,0x19,0x24,0xff,0x17,0x0a,0x11,0xff,0x1b,0x0f,0x14,0xff,0x2a,0x1b,0x1e,0xff,0x37,0x24,0x27,0xff,0x32,0x1f,0x22,0xff,0x32,0x20,0x23,0xff,0x29,0x1b,0x1d,0xff,0x21,0x15,0x16,0xff,0x2e,0x21,0x23,0xff,0x1a,0x0f,0x11,0xff,0x13,0x0a,0x0c,0xff,0x27,0x17,0x19,0xff,0x3e,0x29,0x2a,0xff,0x20,0x11,0x17,0xff,0x15,0x09,0x0e,0xff,0x21,0x13,0x17,0xff,0x37,0x24,0x27,0xff,0x20,0x13,0x13,0xff,0x26,0x19,0x19,0xff,0x3d,0x2b,0x2b,0xff,0x25,0x17,0x19,0xff,0x17,0x0e,0x11,0xff,0x14,0x0d,0x10,0xff,0x06,0x00,0x03,0xff,0x0f,0x0b,0x0c,0xff,0x0a,0x05,0x07,0xff,0x08,0x02,0x05,0xff,0x08,0x02,0x05,0xff,0x0c,0x07,0x0a,0xff,0x0f,0x09,0x0d,0xff,0x0b,0x07,0x09,0xff,0x0c,0x07,0x0a,0xff,0x13,0x0c,0x0e,0xff,0x27,0x1b,0x1d,0xff,0x19,0x0f,0x11,0xff,0x04,0x02,0x05,0xff,0x0a,0x06,0x0e,0xff,0x16,0x12,0x1c,0xff,0x2f,0x2c,0x38,0xff,0x13,0x10,0x1b,0xff,0x12,0x0f,0x19,0xff,0x36,0x35,0x44,0xff,0x58,0x58,0x65,0xff,0x88,0x8a,0x91,0xff,0x78,0x7a,0x84,0xff,0x3a,0x3b,0x47,0xff,0x4f,0x51,0x5d,0xff,0x98,0x9a,0xa5,0xff,0xfd,0xfd,0xfe,0x9c,0xff,0xff,0xff,0x00,0xfe,0xf6,0xf9,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfe,0xf3,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfc,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xfe,0xfe,0xfd,0x00,0x89,0x85,0xaa,0xa0,0x3a,0x34,0x6d,0xff,0x0b,0x09,0x14,0xff,0x00,0x00,0x00,0xff,0x32,0x2d,0x3f,0xff,0x27,0x21,0x2b,0xff,0x3e,0x35,0x34,0xff,0x5c,0x54,0x50,0xff,0x67,0x60,0x5a,0xff,0x4f,0x48,0x42,0xff,0x42,0x3c,0x36,0xff,0x41,0x3a,0x35,0xff,0x3e,0x36,0x32,0xff,0x31,0x26,0x25,0xff,0x39,0x2d,0x2e,0xff,0x30,0x25,0x23,0xff,0x51,0x44,0x40,0xff,0x42,0x36,0x33,0xff,0x1e,0x13,0x14,0xff,0x24,0x17,0x1a,0xff,0x33,0x27,0x28,0xff,0x35,0x29,0x2a,0xff,0x44,0x39,0x37,0xff,0x43,0x38,0x38,0xff,0x29,0x1e,0x1e,0xff,0x23,0x17,0x17,0xff,0x23,0x16,0x19,0xff,0x1a,0x0d,0x13,0xff,0x19,0x0c,0x13,0xff,0x1c,0x10,0x14,0xff,0x1e,0x13,0x16,0xff,0x27,0x1c,0x21,0xff,0x2c,0x21,0x28,0xff,0x2a,0x27,0x36,0xff,0x49,0x57,0x77,0xff,0x5c,0x6e,0x92,0xff,0x5f,0x73,0x99,0xff,0x5c,0x72,0x99,0xff,0x59,0x6d,0x94,0xff,0x55,0x68,0x8d,0xff,0x55,0x68,0x8c,0xff,0x5a,0x6e,0x94,0xff,0x5b,0x71,0x98,0xff,0x57,0x6d,0x93,0xff,0x61,0x6d,0x8b,0xff,0xb4,0xab,0xa7,0xff,0xc7,0xb4,0xa6,0xff,0xaf,0xa2,0x97,0xff,0xc6,0xba,0xad,0xff,0xed,0xe6,0xde,0xff,0xed,0xea,0xe7,0xff,0x76,0x84,0xa5,0xff,0x50,0x63,0x8e,0xff,0x4e,0x5b,0x80,0xff,0x54,0x60,0x84,0xff,0x55,0x62,0x84,0xff,0x53,0x5d,0x81,0xff,0x50,0x5c,0x81,0xff,0x50,0x5c,0x82,0xff,0x51,0x5f,0x88,0xff,0x5f,0x6f,0x9b,0xff,0x76,0x87,0xb1,0xff,0x83,0x95,0xba,0xff,0x58,0x69,0x8c,0xff,0x50,0x5e,0x84,0xff,0x72,0x7f,0xa7,0xff,0x7c,0x88,0xad,0xff,0x75,0x80,0xa4,0xff,0x6d,0x7a,0xa0,0xff,0x56,0x5d,0x74,0xff,0x36,0x26,0x30,0xff,0x1a,0x0b,0x15,0xff,0x30,0x25,0x2a,0xff,0x34,0x27,0x2c,0xff,0x20,0x15,0x1a,0xff,0x20,0x13,0x1a,0xff,0x2d,0x1c,0x1f,0xff,0x36,0x21,0x24,0xff,0x32,0x22,0x24,0xff,0x10,0x0a,0x0b,0xff,0x04,0x01,0x01,0xff,0x19,0x0f,0x10,0xff,0x26,0x18,0x1b,0xff,0x15,0x09,0x0c,0xff,0x17,0x0c,0x0f,0xff,0x26,0x19,0x1a,0xff,0x3a,0x27,0x29,0xff,0x27,0x15,0x19,0xff,0x13,0x09,0x0c,0xff,0x15,0x0b,0x0d,0xff,0x28,0x1a,0x1d,0xff,0x1d,0x11,0x12,0xff,0x27,0x18,0x1a,0xff,0x2c,0x1d,0x1f,0xff,0x1d,0x11,0x12,0xff,0x09,0x06,0x06,0xff,0x06,0x02,0x03,0xff,0x06,0x01,0x04,0xff,0x0b,0x05,0x08,0xff,0x09,0x03,0x06,0xff,0x04,0x00,0x03,0xff,0x0d,0x07,0x0b,0xff,0x0c,0x06,0x09,0xff,0x0b,0x05,0x08,0xff,0x0d,0x08,0x0b,0xff,0x0e,0x09,0x0b,0xff,0x1b,0x15,0x14,0xff,0x29,0x20,0x1f,0xff,0x0c,0x09,0x08,0xff,0x00,0x00,0x05,0xff,0x11,0x0f,0x1d,0xff,0x27,0x27,0x35,0xff,0x30,0x32,0x41,0xff,0x1e,0x1f,0x2b,0xff,0x20,0x21,0x2e,0xff,0x5a,0x60,0x74,0xff,0x65,0x6a,0x7e,0xff,0x7b,0x80,0x8d,0xff,0xa5,0xa8,0xb0,0xff,0x68,0x69,0x79,0xff,0x57,0x5e,0x71,0xff,0xd2,0xd4,0xda,0xe7,0xff,0xff,0xff,0x1f,0xff,0xfd,0xfe,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xff,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xe2,0xe1,0xe8,0x1d,0x66,0x59,0x87,0xe6,0x10,0x0c,0x1e,0xff,0x00,0x00,0x00,0xff,0x07,0x06,0x08,0xff,0x39,0x34,0x36,0xff,0x47,0x3e,0x3d,0xff,0x31,0x28,0x26,0xff,0x41,0x39,0x35,0xff,0x40,0x37,0x34,0xff,0x38,0x2f,0x2c,0xff,0x37,0x2e,0x2a,0xff,0x39,0x2f,0x2d,0xff,0x2f,0x24,0x25,0xff,0x23,0x18,0x1a,0xff,0x29,0x1f,0x1e,0xff,0x44,0x37,0x34,0xff,0x4c,0x40,0x3d,0xff,0x1c,0x13,0x12,0xff,0x38,0x2c,0x2d,0xff,0x3f,0x33,0x33,0xff,0x1f,0x13,0x14,0xff,0x25,0x19,0x1a,0xff,0x2a,0x1e,0x20,0xff,0x21,0x15,0x17,0xff,0x1b,0x0f,0x12,0xff,0x1a,0x0d,0x12,0xff,0x17,0x0a,0x0f,0xff,0x22,0x13,0x19,0xff,0x28,0x1c,0x1f,0xff,0x25,0x1a,0x1e,0xff,0x23,0x18,0x1d,0xff,0x33,0x2a,0x34,0xff,0x25,0x25,0x3c,0xff,0x4a,0x59,0x7c,0xff,0x56,0x69,0x8d,0xff,0x5b,0x71,0x95,0xff,0x58,0x6e,0x94,0xff,0x57,0x6b,0x90,0xff,0x55,0x68,0x8c,0xff,0x54,0x68,0x8b,0xff,0x56,0x6c,0x91,0xff,0x57,0x6b,0x92,0xff,0x4e,0x62,0x8a,0xff,0x7b,0x7f,0x94,0xff,0xd0,0xc2,0xb4,0xff,0xba,0xaa,0x9e,0xff,0xb4,0xa8,0x9d,0xff,0xd8,0xcf,0xc2,0xff,0xf6,0xef,0xe5,0xff,0xe5,0xe1,0xe0,0xff,0x6f,0x80,0xa6,0xff,0x5b,0x70,0x9e,0xff,0x55,0x64,0x88,0xff,0x54,0x5f,0x83,0xff,0x56,0x61,0x84,0xff,0x52,0x5c,0x7f,0xff,0x4b,0x55,0x78,0xff,0x4a,0x54,0x7a,0xff,0x50,0x5d,0x85,0xff,0x5f,0x6e,0x9b,0xff,0x73,0x85,0xb0,0xff,0x78,0x88,0xaf,0xff,0x5d,0x6e,0x94,0xff,0x5b,0x6b,0x92,0xff,0x75,0x83,0xac,0xff,0x7c,0x88,0xb0,0xff,0x7a,0x87,0xb0,0xff,0x61,0x66,0x83,0xff,0x35,0x29,0x31,0xff,0x2c,0x1b,0x1e,0xff,0x2e,0x1b,0x21,0xff,0x34,0x22,0x28,0xff,0x2b,0x1e,0x22,0xff,0x22,0x15,0x1a,0xff,0x21,0x11,0x17,0xff,0x34,0x20,0x23,0xff,0x37,0x24,0x25,0xff,0x24,0x18,0x1b,0xff,0x0f,0x0a,0x0c,0xff,0x19,0x0f,0x12,0xff,0x2c,0x1a,0x1e,0xff,0x1e,0x10,0x12,0xff,0x1c,0x0e,0x13,0xff,0x1d,0x10,0x15,0xff,0x29,0x1a,0x1d,0xff,0x2a,0x18,0x1b,0xff,0x2b,0x18,0x1c,0xff,0x1c,0x14,0x16,0xff,0x07,0x02,0x04,0xff,0x1e,0x12,0x14,0xff,0x20,0x14,0x16,0xff,0x2a,0x17,0x1a,0xff,0x24,0x15,0x18,0xff,0x16,0x0b,0x0d,0xff,0x07,0x05,0x06,0xff,0x05,0x02,0x03,0xff,0x07,0x03,0x05,0xff,0x11,0x0b,0x0e,0xff,0x06,0x04,0x06,0xff,0x01,0x00,0x02,0xff,0x12,0x0b,0x0f,0xff,0x12,0x0a,0x0d,0xff,0x0b,0x06,0x09,0xff,0x0a,0x06,0x09,0xff,0x0d,0x07,0x09,0xff,0x0e,0x0a,0x09,0xff,0x19,0x12,0x12,0xff,0x13,0x0d,0x0e,0xff,0x04,0x02,0x09,0xff,0x18,0x19,0x2c,0xff,0x35,0x3b,0x4d,0xff,0x2d,0x33,0x44,0xff,0x18,0x1c,0x2c,0xff,0x2c,0x35,0x44,0xff,0x5c,0x69,0x7c,0xff,0x6b,0x76,0x8a,0xff,0x70,0x78,0x8c,0xff,0x90,0x91,0xa6,0xff,0x9a,0x9b,0xb3,0xff,0xac,0xb1,0xbf,0xff,0xfc,0xfd,0xfd,0x68,0xff,0xff,0xff,0x00,0xfe,0xf2,0xf6,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xed,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xba,0xb5,0xc6,0x62,0x2e,0x27,0x43,0xff,0x01,0x00,0x04,0xff,0x11,0x0b,0x11,0xff,0x36,0x2f,0x32,0xff,0x29,0x21,0x22,0xff,0x27,0x20,0x20,0xff,0x29,0x21,0x20,0xff,0x34,0x2b,0x2a,0xff,0x41,0x38,0x34,0xff,0x44,0x3a,0x36,0xff,0x26,0x1c,0x1a,0xff,0x1a,0x11,0x12,0xff,0x1e,0x14,0x16,0xff,0x31,0x28,0x28,0xff,0x40,0x36,0x33,0xff,0x3e,0x33,0x30,0xff,0x3a,0x30,0x2e,0xff,0x34,0x29,0x28,0xff,0x37,0x2b,0x2b,0xff,0x2e,0x22,0x23,0xff,0x25,0x1a,0x1b,0xff,0x22,0x16,0x19,0xff,0x27,0x1b,0x1e,0xff,0x20,0x13,0x17,0xff,0x1c,0x0e,0x13,0xff,0x24,0x17,0x19,0xff,0x33,0x24,0x27,0xff,0x28,0x1b,0x1e,0xff,0x27,0x1c,0x21,0xff,0x2e,0x21,0x28,0xff,0x2e,0x26,0x30,0xff,0x24,0x28,0x3e,0xff,0x4a,0x59,0x7b,0xff,0x4d,0x63,0x87,0xff,0x57,0x6d,0x91,0xff,0x54,0x6a,0x90,0xff,0x56,0x6a,0x8e,0xff,0x54,0x68,0x8b,0xff,0x52,0x66,0x89,0xff,0x50,0x65,0x8a,0xff,0x4f,0x66,0x8c,0xff,0x4e,0x5d,0x85,0xff,0xa3,0x9c,0xa2,0xff,0xd3,0xc0,0xb1,0xff,0xac,0x9f,0x92,0xff,0xc1,0xb5,0xab,0xff,0xe9,0xe1,0xd7,0xff,0xf6,0xf0,0xe6,0xff,0xdd,0xd9,0xda,0xff,0x6c,0x7e,0xab,0xff,0x64,0x7c,0xac,0xff,0x5e,0x71,0x98,0xff,0x5c,0x69,0x8e,0xff,0x58,0x61,0x85,0xff,0x53,0x5b,0x7e,0xff,0x4b,0x54,0x75,0xff,0x46,0x50,0x72,0xff,0x53,0x5d,0x82,0xff,0x5f,0x6e,0x99,0xff,0x6f,0x80,0xaa,0xff,0x6d,0x7e,0xa6,0xff,0x60,0x71,0x98,0xff,0x68,0x79,0xa1,0xff,0x78,0x86,0xb0,0xff,0x7c,0x8a,0xb3,0xff,0x67,0x6f,0x93,0xff,0x37,0x2e,0x39,0xff,0x3f,0x2e,0x31,0xff,0x30,0x22,0x26,0xff,0x43,0x38,0x3b,0xff,0x26,0x1a,0x1e,0xff,0x1a,0x0e,0x12,0xff,0x17,0x0b,0x10,0xff,0x22,0x17,0x1a,0xff,0x35,0x23,0x24,0xff,0x3a,0x28,0x28,0xff,0x12,0x09,0x0b,0xff,0x1b,0x0f,0x13,0xff,0x27,0x18,0x1d,0xff,0x20,0x12,0x17,0xff,0x19,0x0c,0x0e,0xff,0x24,0x15,0x19,0xff,0x2c,0x1d,0x21,0xff,0x29,0x18,0x1e,0xff,0x2d,0x1b,0x1e,0xff,0x29,0x17,0x1a,0xff,0x16,0x0e,0x11,0xff,0x07,0x03,0x06,0xff,0x1c,0x0f,0x13,0xff,0x20,0x14,0x16,0xff,0x25,0x17,0x19,0xff,0x1e,0x13,0x14,0xff,0x1b,0x11,0x14,0xff,0x09,0x04,0x07,0xff,0x0a,0x05,0x07,0xff,0x13,0x0f,0x0f,0xff,0x11,0x0d,0x0d,0xff,0x0b,0x05,0x06,0xff,0x10,0x0a,0x0c,0xff,0x18,0x0f,0x12,0xff,0x0f,0x06,0x09,0xff,0x04,0x00,0x02,0xff,0x03,0x01,0x03,0xff,0x0a,0x06,0x07,0xff,0x11,0x0b,0x0c,0xff,0x10,0x0a,0x0c,0xff,0x0d,0x07,0x0a,0xff,0x0c,0x09,0x11,0xff,0x19,0x1e,0x31,0xff,0x29,0x31,0x46,0xff,0x30,0x37,0x4a,0xff,0x1e,0x25,0x39,0xff,0x3d,0x46,0x5a,0xff,0x5f,0x69,0x81,0xff,0x6c,0x79,0x90,0xff,0x72,0x7e,0x96,0xff,0x73,0x7f,0x9b,0xff,0x9b,0xa4,0xbb,0xff,0xf4,0xf5,0xf9,0xb7,0xff,0xff,0xff,0x01,0xff,0xfa,0xfc,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf5,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xfd,0xfd,0xfd,0x00,0x67,0x67,0x6b,0xa9,0x00,0x00,0x00,0xff,0x18,0x11,0x14,0xff,0x20,0x18,0x1a,0xff,0x0f,0x07,0x09,0xff,0x0c,0x07,0x08,0xff,0x22,0x1a,0x19,0xff,0x2c,0x24,0x23,0xff,0x34,0x2b,0x2b,0xff,0x3e,0x35,0x34,0xff,0x2b,0x22,0x21,0xff,0x2b,0x22,0x22,0xff,0x22,0x19,0x19,0xff,0x1d,0x14,0x14,0xff,0x28,0x1e,0x1d,0xff,0x33,0x28,0x26,0xff,0x44,0x39,0x35,0xff,0x43,0x37,0x32,0xff,0x31,0x22,0x24,0xff,0x28,0x1c,0x1d,0xff,0x1b,0x10,0x10,0xff,0x27,0x1b,0x1c,0xff,0x21,0x15,0x16,0xff,0x27,0x1a,0x1d,0xff,0x30,0x22,0x25,0xff,0x36,0x28,0x2a,0xff,0x2f,0x21,0x24,0xff,0x2a,0x1e,0x21,0xff,0x26,0x1c,0x21,0xff,0x2d,0x21,0x27,0xff,0x27,0x1f,0x29,0xff,0x2a,0x2d,0x43,0xff,0x48,0x58,0x76,0xff,0x4a,0x5f,0x82,0xff,0x4f,0x62,0x88,0xff,0x4f,0x66,0x89,0xff,0x4f,0x65,0x8a,0xff,0x4f,0x64,0x89,0xff,0x4f,0x62,0x88,0xff,0x4c,0x61,0x85,0xff,0x46,0x5d,0x83,0xff,0x64,0x6b,0x88,0xff,0xc6,0xb9,0xab,0xff,0xc2,0xb1,0xa1,0xff,0xaf,0xa4,0x97,0xff,0xd6,0xcf,0xc6,0xff,0xe6,0xe1,0xdb,0xff,0xf1,0xed,0xe4,0xff,0xd1,0xd0,0xd2,0xff,0x6c,0x83,0xb0,0xff,0x70,0x88,0xba,0xff,0x62,0x79,0xa1,0xff,0x62,0x75,0x97,0xff,0x5a,0x6a,0x8d,0xff,0x50,0x5d,0x7f,0xff,0x47,0x53,0x73,0xff,0x42,0x4e,0x70,0xff,0x51,0x5d,0x83,0xff,0x5f,0x6f,0x96,0xff,0x69,0x7d,0xa3,0xff,0x66,0x7c,0xa1,0xff,0x5f,0x73,0x9a,0xff,0x6c,0x7d,0xa6,0xff,0x78,0x8a,0xb0,0xff,0x7a,0x89,0xb1,0xff,0x52,0x4e,0x64,0xff,0x2e,0x20,0x23,0xff,0x1c,0x16,0x1a,0xff,0x37,0x34,0x39,0xff,0x40,0x3a,0x3f,0xff,0x05,0x00,0x03,0xff,0x13,0x0b,0x10,0xff,0x14,0x0e,0x12,0xff,0x0b,0x06,0x08,0xff,0x2e,0x20,0x21,0xff,0x2a,0x1a,0x1d,0xff,0x13,0x06,0x0a,0xff,0x23,0x13,0x16,0xff,0x27,0x19,0x1e,0xff,0x13,0x0a,0x0d,0xff,0x23,0x14,0x17,0xff,0x24,0x14,0x18,0xff,0x24,0x15,0x1a,0xff,0x28,0x19,0x1d,0xff,0x22,0x13,0x16,0xff,0x20,0x11,0x13,0xff,0x10,0x09,0x09,0xff,0x0a,0x05,0x07,0xff,0x18,0x0e,0x10,0xff,0x27,0x1b,0x1c,0xff,0x19,0x0e,0x10,0xff,0x0f,0x0a,0x0a,0xff,0x0c,0x08,0x09,0xff,0x0a,0x05,0x09,0xff,0x0c,0x07,0x0a,0xff,0x11,0x0c,0x0c,0xff,0x14,0x0e,0x0f,0xff,0x11,0x08,0x09,0xff,0x20,0x14,0x17,0xff,0x1f,0x14,0x18,0xff,0x07,0x03,0x05,0xff,0x05,0x01,0x04,0xff,0x05,0x03,0x04,0xff,0x05,0x03,0x05,0xff,0x10,0x07,0x09,0xff,0x1d,0x13,0x16,0xff,0x0b,0x06,0x0a,0xff,0x0e,0x0b,0x13,0xff,0x1a,0x18,0x2c,0xff,0x21,0x27,0x3e,0xff,0x33,0x3a,0x4f,0xff,0x2a,0x32,0x48,0xff,0x44,0x4e,0x67,0xff,0x5b,0x66,0x81,0xff,0x5a,0x6b,0x86,0xff,0x5c,0x73,0x90,0xff,0x6c,0x80,0x9d,0xff,0xd4,0xda,0xe3,0xec,0xff,0xff,0xff,0x28,0xff,0xfe,0xff,0x00,0xfe,0xed,0xf3,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xe1,0xe0,0xe1,0x1c,0x43,0x3d,0x40,0xdf,0x26,0x1d,0x1d,0xff,0x3c,0x33,0x32,0xff,0x19,0x14,0x15,0xff,0x13,0x0d,0x11,0xff,0x17,0x11,0x11,0xff,0x15,0x0e,0x0d,0xff,0x23,0x1a,0x1b,0xff,0x29,0x1f,0x20,0xff,0x3d,0x33,0x32,0xff,0x3d,0x33,0x30,0xff,0x2d,0x24,0x21,0xff,0x22,0x18,0x17,0xff,0x25,0x1a,0x1b,0xff,0x28,0x1e,0x1e,0xff,0x36,0x2c,0x29,0xff,0x38,0x2f,0x2a,0xff,0x3e,0x30,0x32,0xff,0x35,0x29,0x29,0xff,0x33,0x28,0x28,0xff,0x34,0x27,0x27,0xff,0x3b,0x2e,0x2e,0xff,0x2e,0x20,0x23,0xff,0x32,0x24,0x27,0xff,0x35,0x28,0x29,0xff,0x46,0x39,0x3a,0xff,0x3b,0x2f,0x31,0xff,0x28,0x1d,0x21,0xff,0x2a,0x1e,0x24,0xff,0x24,0x1c,0x25,0xff,0x2b,0x2b,0x42,0xff,0x40,0x4f,0x6e,0xff,0x47,0x5b,0x7c,0xff,0x48,0x5c,0x80,0xff,0x4b,0x60,0x83,0xff,0x4a,0x5e,0x82,0xff,0x4a,0x5d,0x82,0xff,0x4a,0x5c,0x81,0xff,0x4c,0x5e,0x81,0xff,0x43,0x55,0x7b,0xff,0x84,0x88,0x91,0xff,0xcc,0xbf,0xaf,0xff,0xb9,0xa8,0x9b,0xff,0xc8,0xbb,0xb1,0xff,0xdf,0xd9,0xd2,0xff,0xe3,0xdc,0xd7,0xff,0xf7,0xf0,0xe9,0xff,0xcc,0xcf,0xd4,0xff,0x72,0x88,0xb9,0xff,0x79,0x90,0xc3,0xff,0x6a,0x82,0xae,0xff,0x60,0x78,0x9f,0xff,0x5b,0x6d,0x92,0xff,0x55,0x61,0x85,0xff,0x4a,0x54,0x75,0xff,0x44,0x4f,0x6f,0xff,0x52,0x5e,0x80,0xff,0x5d,0x6d,0x94,0xff,0x67,0x7b,0xa1,0xff,0x65,0x79,0x9f,0xff,0x64,0x76,0x9e,0xff,0x6a,0x7d,0xa8,0xff,0x7d,0x90,0xb8,0xff,0x6e,0x79,0x95,0xff,0x36,0x30,0x3a,0xff,0x32,0x24,0x2b,0xff,0x39,0x36,0x3a,0xff,0x41,0x42,0x45,0xff,0x07,0x05,0x07,0xff,0x04,0x00,0x03,0xff,0x13,0x0c,0x10,0xff,0x10,0x09,0x0d,0xff,0x09,0x03,0x05,0xff,0x2f,0x22,0x23,0xff,0x28,0x18,0x1b,0xff,0x19,0x09,0x0f,0xff,0x2a,0x17,0x1d,0xff,0x1d,0x11,0x16,0xff,0x24,0x17,0x1c,0xff,0x30,0x22,0x25,0xff,0x1b,0x0d,0x11,0xff,0x14,0x09,0x0d,0xff,0x19,0x0d,0x11,0xff,0x1e,0x11,0x13,0xff,0x22,0x14,0x14,0xff,0x10,0x08,0x0b,0xff,0x0b,0x04,0x08,0xff,0x0e,0x06,0x0a,0xff,0x2b,0x1e,0x1e,0xff,0x1b,0x0f,0x13,0xff,0x0f,0x07,0x0a,0xff,0x07,0x03,0x04,0xff,0x08,0x04,0x06,0xff,0x08,0x03,0x05,0xff,0x07,0x01,0x04,0xff,0x0a,0x03,0x06,0xff,0x1b,0x14,0x15,0xff,0x1a,0x11,0x13,0xff,0x14,0x09,0x0e,0xff,0x0f,0x0b,0x0e,0xff,0x05,0x03,0x04,0xff,0x04,0x02,0x02,0xff,0x09,0x06,0x08,0xff,0x03,0x02,0x04,0xff,0x0c,0x07,0x09,0xff,0x11,0x0c,0x0e,0xff,0x13,0x0d,0x19,0xff,0x1d,0x1a,0x2e,0xff,0x25,0x28,0x3d,0xff,0x2d,0x32,0x4a,0xff,0x2d,0x37,0x50,0xff,0x42,0x4c,0x65,0xff,0x4f,0x5c,0x79,0xff,0x50,0x62,0x7f,0xff,0x56,0x6b,0x8b,0xff,0xaa,0xb5,0xc7,0xff,0xff,0xff,0xff,0x63,0xff,0xff,0xff,0x00,0xfe,0xf2,0xf7,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xec,0xf3,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xc5,0xc3,0xc3,0x4d,0x2e,0x26,0x26,0xfe,0x38,0x2d,0x2c,0xff,0x2d,0x26,0x26,0xff,0x06,0x02,0x03,0xff,0x05,0x00,0x01,0xff,0x0f,0x0a,0x0b,0xff,0x18,0x11,0x12,0xff,0x19,0x0f,0x10,0xff,0x2a,0x1f,0x1e,0xff,0x3b,0x32,0x2f,0xff,0x31,0x27,0x24,0xff,0x31,0x26,0x23,0xff,0x2c,0x22,0x22,0xff,0x2e,0x24,0x22,0xff,0x39,0x2f,0x2c,0xff,0x2a,0x21,0x1f,0xff,0x2d,0x22,0x22,0xff,0x26,0x1a,0x1a,0xff,0x31,0x26,0x25,0xff,0x38,0x2b,0x2b,0xff,0x34,0x25,0x25,0xff,0x35,0x26,0x28,0xff,0x3b,0x2e,0x2f,0xff,0x27,0x1c,0x1c,0xff,0x42,0x37,0x36,0xff,0x3a,0x2e,0x2e,0xff,0x2f,0x24,0x26,0xff,0x2a,0x20,0x24,0xff,0x2c,0x24,0x2a,0xff,0x25,0x22,0x39,0xff,0x38,0x44,0x65,0xff,0x41,0x54,0x74,0xff,0x42,0x57,0x79,0xff,0x46,0x5a,0x7d,0xff,0x46,0x57,0x7b,0xff,0x47,0x58,0x7c,0xff,0x47,0x58,0x7c,0xff,0x46,0x57,0x7b,0xff,0x4c,0x5a,0x7a,0xff,0xa9,0xa4,0x9f,0xff,0xc3,0xb7,0xa7,0xff,0xad,0x9c,0x93,0xff,0xc7,0xbb,0xb2,0xff,0xed,0xe7,0xe0,0xff,0xed,0xe5,0xe1,0xff,0xfa,0xf2,0xea,0xff,0xbd,0xc4,0xcc,0xff,0x77,0x90,0xbd,0xff,0x7e,0x97,0xc4,0xff,0x73,0x8b,0xb9,0xff,0x65,0x7c,0xa7,0xff,0x5c,0x6f,0x95,0xff,0x56,0x62,0x87,0xff,0x4e,0x57,0x78,0xff,0x45,0x51,0x6f,0xff,0x4f,0x5b,0x7b,0xff,0x5d,0x6c,0x92,0xff,0x60,0x75,0x9a,0xff,0x66,0x77,0x9f,0xff,0x66,0x79,0xa1,0xff,0x6e,0x82,0xb0,0xff,0x65,0x74,0x98,0xff,0x2f,0x2b,0x33,0xff,0x2e,0x22,0x25,0xff,0x2b,0x1f,0x27,0xff,0x43,0x41,0x44,0xff,0x1b,0x1c,0x1d,0xff,0x00,0x00,0x01,0xff,0x05,0x02,0x05,0xff,0x10,0x09,0x0d,0xff,0x0d,0x07,0x0a,0xff,0x0f,0x07,0x09,0xff,0x23,0x16,0x17,0xff,0x27,0x16,0x1a,0xff,0x20,0x11,0x16,0xff,0x1b,0x0f,0x13,0xff,0x1d,0x11,0x15,0xff,0x27,0x1a,0x1e,0xff,0x19,0x0e,0x12,0xff,0x1b,0x0f,0x13,0xff,0x13,0x0b,0x0e,0xff,0x15,0x0c,0x10,0xff,0x1a,0x0d,0x0f,0xff,0x1d,0x11,0x11,0xff,0x0e,0x08,0x0c,0xff,0x11,0x09,0x0f,0xff,0x0c,0x05,0x09,0xff,0x20,0x16,0x14,0xff,0x23,0x15,0x1a,0xff,0x0e,0x08,0x0b,0xff,0x0f,0x07,0x07,0xff,0x1a,0x0e,0x10,0xff,0x11,0x0b,0x0b,0xff,0x0c,0x06,0x09,0xff,0x15,0x0d,0x11,0xff,0x10,0x09,0x0c,0xff,0x0c,0x05,0x06,0xff,0x13,0x0c,0x0f,0xff,0x0c,0x08,0x0b,0xff,0x07,0x04,0x05,0xff,0x06,0x04,0x04,0xff,0x06,0x03,0x05,0xff,0x04,0x01,0x04,0xff,0x06,0x03,0x04,0xff,0x08,0x04,0x06,0xff,0x11,0x0c,0x18,0xff,0x12,0x12,0x1f,0xff,0x18,0x1a,0x29,0xff,0x24,0x28,0x41,0xff,0x33,0x3e,0x57,0xff,0x41,0x4b,0x65,0xff,0x47,0x55,0x72,0xff,0x4a,0x5b,0x7b,0xff,0x82,0x90,0xa7,0xff,0xf5,0xf6,0xf8,0xa0,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfb,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0x9a,0x97,0x97,0x81,0x25,0x1c,0x1a,0xff,0x34,0x2b,0x29,0xff,0x22,0x1a,0x18,0xff,0x0a,0x04,0x05,0xff,0x03,0x00,0x04,0xff,0x0e,0x0a,0x0d,0xff,0x13,0x0c,0x0e,0xff,0x20,0x19,0x19,0xff,0x29,0x1e,0x1e,0xff,0x34,0x28,0x27,0xff,0x40,0x36,0x32,0xff,0x43,0x39,0x33,0xff,0x45,0x39,0x31,0xff,0x3e,0x33,0x2f,0xff,0x25,0x19,0x1b,0xff,0x2d,0x22,0x21,0xff,0x2e,0x24,0x23,0xff,0x28,0x1d,0x1c,0xff,0x20,0x14,0x14,0xff,0x2d,0x21,0x21,0xff,0x3c,0x2f,0x2d,0xff,0x3c,0x2f,0x2e,0xff,0x3d,0x31,0x30,0xff,0x3e,0x32,0x32,0xff,0x22,0x17,0x18,0xff,0x1e,0x14,0x16,0xff,0x24,0x1b,0x1f,0xff,0x28,0x1f,0x24,0xff,0x1f,0x1c,0x2d,0xff,0x35,0x3f,0x5d,0xff,0x3d,0x4d,0x6c,0xff,0x42,0x52,0x74,0xff,0x40,0x55,0x78,0xff,0x41,0x53,0x77,0xff,0x43,0x54,0x77,0xff,0x44,0x54,0x75,0xff,0x3e,0x51,0x73,0xff,0x6b,0x6f,0x82,0xff,0xc4,0xb5,0xab,0xff,0xb7,0xab,0x9d,0xff,0xa7,0x9a,0x8f,0xff,0xd1,0xc8,0xbf,0xff,0xec,0xe7,0xdf,0xff,0xea,0xe6,0xdf,0xff,0xfb,0xf4,0xeb,0xff,0xac,0xb2,0xc8,0xff,0x78,0x92,0xc3,0xff,0x7e,0x98,0xc5,0xff,0x74,0x8c,0xb9,0xff,0x67,0x7e,0xa8,0xff,0x5c,0x72,0x96,0xff,0x59,0x66,0x88,0xff,0x4e,0x59,0x7a,0xff,0x43,0x4f,0x6e,0xff,0x4b,0x54,0x75,0xff,0x58,0x64,0x88,0xff,0x5c,0x71,0x94,0xff,0x5f,0x74,0x9b,0xff,0x60,0x75,0x9c,0xff,0x6c,0x81,0xa6,0xff,0x41,0x40,0x4f,0xff,0x2a,0x1b,0x1f,0xff,0x1f,0x17,0x19,0xff,0x2f,0x2c,0x32,0xff,0x2d,0x2e,0x30,0xff,0x01,0x01,0x02,0xff,0x04,0x00,0x04,0xff,0x0a,0x03,0x09,0xff,0x0c,0x06,0x0b,0xff,0x06,0x02,0x05,0xff,0x0e,0x09,0x0c,0xff,0x1c,0x12,0x15,0xff,0x23,0x12,0x16,0xff,0x1a,0x0f,0x13,0xff,0x09,0x03,0x06,0xff,0x1a,0x10,0x14,0xff,0x1c,0x10,0x14,0xff,0x0c,0x03,0x07,0xff,0x16,0x0d,0x11,0xff,0x17,0x0d,0x11,0xff,0x1d,0x13,0x15,0xff,0x1a,0x10,0x10,0xff,0x20,0x16,0x18,0xff,0x08,0x05,0x07,0xff,0x0d,0x07,0x0b,0xff,0x13,0x0b,0x0f,0xff,0x12,0x0c,0x0c,0xff,0x2d,0x21,0x21,0xff,0x19,0x12,0x10,0xff,0x23,0x17,0x16,0xff,0x30,0x22,0x22,0xff,0x18,0x12,0x11,0xff,0x08,0x05,0x05,0xff,0x0b,0x08,0x08,0xff,0x08,0x02,0x03,0xff,0x12,0x0a,0x0c,0xff,0x09,0x07,0x09,0xff,0x03,0x03,0x01,0xff,0x08,0x04,0x05,0xff,0x06,0x03,0x06,0xff,0x03,0x03,0x05,0xff,0x03,0x01,0x04,0xff,0x05,0x03,0x04,0xff,0x03,0x03,0x04,0xff,0x13,0x12,0x1c,0xff,0x18,0x1a,0x26,0xff,0x18,0x19,0x2a,0xff,0x23,0x27,0x3c,0xff,0x32,0x3e,0x55,0xff,0x3c,0x4a,0x62,0xff,0x3f,0x4c,0x6a,0xff,0x64,0x71,0x8c,0xff,0xe0,0xe3,0xea,0xcf,0xff,0xff,0xff,0x10,0xff,0xfd,0xfe,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf6,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xff,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xfa,0xfa,0xfa,0x02,0x72,0x6e,0x6d,0xaf,0x1a,0x12,0x11,0xff,0x2b,0x21,0x22,0xff,0x1c,0x15,0x17,0xff,0x02,0x01,0x01,0xff,0x05,0x01,0x03,0xff,0x0f,0x08,0x0b,0xff,0x17,0x0f,0x14,0xff,0x1d,0x13,0x15,0xff,0x3c,0x31,0x30,0xff,0x3b,0x31,0x2d,0xff,0x44,0x39,0x33,0xff,0x44,0x38,0x31,0xff,0x3a,0x2e,0x29,0xff,0x37,0x2a,0x29,0xff,0x34,0x27,0x25,0xff,0x32,0x26,0x23,0xff,0x2e,0x22,0x21,0xff,0x35,0x28,0x27,0xff,0x46,0x3a,0x38,0xff,0x4f,0x42,0x40,0xff,0x46,0x39,0x36,0xff,0x40,0x32,0x31,0xff,0x2b,0x1f,0x20,0xff,0x1a,0x0e,0x11,0xff,0x22,0x15,0x18,0xff,0x27,0x1c,0x1e,0xff,0x28,0x1d,0x23,0xff,0x1d,0x15,0x24,0xff,0x36,0x3f,0x5d,0xff,0x3a,0x48,0x69,0xff,0x3d,0x4d,0x6e,0xff,0x3e,0x4f,0x70,0xff,0x3e,0x4f,0x70,0xff,0x3d,0x4f,0x6f,0xff,0x40,0x51,0x6e,0xff,0x3c,0x4e,0x69,0xff,0x95,0x90,0x90,0xff,0xca,0xb9,0xb1,0xff,0xb0,0xa4,0x99,0xff,0xab,0x9f,0x94,0xff,0xde,0xd6,0xcf,0xff,0xec,0xe7,0xe0,0xff,0xec,0xe7,0xe1,0xff,0xfa,0xf2,0xea,0xff,0xa3,0xac,0xca,0xff,0x7c,0x98,0xca,0xff,0x7d,0x97,0xc4,0xff,0x74,0x8c,0xb8,0xff,0x66,0x7f,0xa7,0xff,0x60,0x74,0x98,0xff,0x5a,0x67,0x88,0xff,0x4b,0x56,0x77,0xff,0x44,0x50,0x70,0xff,0x44,0x50,0x70,0xff,0x4f,0x5c,0x7e,0xff,0x56,0x66,0x8b,0xff,0x59,0x6d,0x91,0xff,0x62,0x77,0x9e,0xff,0x59,0x65,0x81,0xff,0x28,0x21,0x2a,0xff,0x1d,0x10,0x15,0xff,0x27,0x23,0x26,0xff,0x40,0x42,0x47,0xff,0x07,0x07,0x08,0xff,0x08,0x03,0x05,0xff,0x16,0x0d,0x11,0xff,0x0d,0x06,0x0c,0xff,0x0a,0x06,0x09,0xff,0x03,0x01,0x03,0xff,0x13,0x0b,0x0e,0xff,0x1d,0x10,0x15,0xff,0x21,0x12,0x16,0xff,0x0b,0x05,0x08,0xff,0x12,0x0b,0x0e,0xff,0x23,0x16,0x19,0xff,0x17,0x0d,0x0f,0xff,0x0d,0x05,0x08,0xff,0x11,0x0a,0x0f,0xff,0x13,0x0a,0x0f,0xff,0x17,0x0c,0x0f,0xff,0x1b,0x0f,0x13,0xff,0x19,0x0e,0x12,0xff,0x06,0x02,0x05,0xff,0x09,0x04,0x07,0xff,0x15,0x0d,0x10,0xff,0x0f,0x07,0x0a,0xff,0x2a,0x1e,0x20,0xff,0x1e,0x14,0x14,0xff,0x3c,0x2d,0x2d,0xff,0x39,0x2f,0x2e,0xff,0x0a,0x08,0x06,0xff,0x03,0x00,0x01,0xff,0x04,0x01,0x02,0xff,0x0c,0x07,0x08,0xff,0x11,0x0b,0x0c,0xff,0x06,0x03,0x04,0xff,0x0e,0x0b,0x0a,0xff,0x06,0x03,0x04,0xff,0x06,0x03,0x06,0xff,0x04,0x02,0x04,0xff,0x04,0x01,0x04,0xff,0x07,0x03,0x05,0xff,0x07,0x03,0x07,0xff,0x11,0x11,0x1d,0xff,0x1d,0x20,0x30,0xff,0x29,0x29,0x41,0xff,0x30,0x35,0x4b,0xff,0x30,0x3d,0x53,0xff,0x37,0x43,0x5c,0xff,0x4c,0x59,0x74,0xff,0xc6,0xca,0xd4,0xed,0xff,0xff,0xff,0x31,0xff,0xff,0xff,0x00,0xfe,0xee,0xf4,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xff,0xfb,0xfc,0x00,0xff,0xff,0xff,0x00,0xef,0xee,0xee,0x15,0x50,0x4a,0x4a,0xd5,0x1a,0x10,0x10,0xff,0x2b,0x23,0x22,0xff,0x0e,0x0a,0x0a,0xff,0x03,0x00,0x00,0xff,0x0a,0x05,0x09,0xff,0x12,0x0a,0x10,0xff,0x21,0x19,0x1a,0xff,0x33,0x29,0x27,0xff,0x3a,0x30,0x2c,0xff,0x3c,0x30,0x2c,0xff,0x2a,0x1d,0x1a,0xff,0x3c,0x30,0x2b,0xff,0x53,0x48,0x41,0xff,0x56,0x4b,0x43,0xff,0x47,0x3c,0x34,0xff,0x53,0x47,0x3f,0xff,0x46,0x3a,0x34,0xff,0x39,0x2c,0x28,0xff,0x3d,0x30,0x2d,0xff,0x36,0x29,0x27,0xff,0x35,0x28,0x27,0xff,0x1d,0x12,0x13,0xff,0x1e,0x13,0x15,0xff,0x23,0x19,0x1a,0xff,0x2d,0x22,0x25,0xff,0x23,0x17,0x1e,0xff,0x19,0x10,0x1b,0xff,0x37,0x3e,0x5a,0xff,0x3a,0x46,0x68,0xff,0x39,0x49,0x69,0xff,0x3a,0x48,0x68,0xff,0x3a,0x4a,0x6a,0xff,0x3b,0x4b,0x6a,0xff,0x3a,0x4b,0x68,0xff,0x4d,0x59,0x6c,0xff,0xb9,0xab,0xa0,0xff,0xc6,0xb4,0xaa,0xff,0xa8,0x99,0x8e,0xff,0xb9,0xad,0xa4,0xff,0xe8,0xe2,0xdb,0xff,0xec,0xe7,0xe1,0xff,0xee,0xe8,0xe4,0xff,0xf5,0xee,0xe8,0xff,0x9b,0xa8,0xc7,0xff,0x7c,0x98,0xca,0xff,0x7a,0x95,0xc2,0xff,0x72,0x89,0xb6,0xff,0x66,0x7f,0xa7,0xff,0x5f,0x73,0x96,0xff,0x57,0x65,0x87,0xff,0x4f,0x5b,0x7b,0xff,0x47,0x53,0x73,0xff,0x42,0x4e,0x6e,0xff,0x48,0x56,0x76,0xff,0x4f,0x5c,0x81,0xff,0x52,0x66,0x89,0xff,0x60,0x74,0x9b,0xff,0x42,0x46,0x58,0xff,0x18,0x0d,0x12,0xff,0x26,0x1d,0x23,0xff,0x3a,0x39,0x3d,0xff,0x17,0x15,0x18,0xff,0x04,0x02,0x04,0xff,0x13,0x0b,0x0e,0xff,0x0e,0x06,0x0a,0xff,0x0c,0x05,0x09,0xff,0x20,0x14,0x17,0xff,0x1a,0x0f,0x11,0xff,0x28,0x16,0x1b,0xff,0x1c,0x0f,0x13,0xff,0x14,0x0b,0x0f,0xff,0x08,0x03,0x05,0xff,0x20,0x16,0x19,0xff,0x1b,0x0d,0x0f,0xff,0x21,0x15,0x17,0xff,0x0f,0x08,0x0a,0xff,0x09,0x04,0x08,0xff,0x0d,0x07,0x0b,0xff,0x12,0x08,0x0c,0xff,0x1e,0x11,0x16,0xff,0x1d,0x11,0x15,0xff,0x07,0x04,0x06,0xff,0x0f,0x09,0x0b,0xff,0x13,0x0b,0x0e,0xff,0x0b,0x04,0x07,0xff,0x15,0x0b,0x0c,0xff,0x26,0x19,0x1a,0xff,0x31,0x20,0x21,0xff,0x1d,0x14,0x14,0xff,0x0f,0x0c,0x0b,0xff,0x09,0x06,0x07,0xff,0x06,0x03,0x06,0xff,0x0d,0x08,0x0a,0xff,0x0e,0x09,0x0b,0xff,0x0b,0x06,0x08,0xff,0x0a,0x06,0x06,0xff,0x07,0x03,0x05,0xff,0x05,0x02,0x05,0xff,0x06,0x02,0x05,0xff,0x04,0x01,0x04,0xff,0x06,0x02,0x04,0xff,0x0a,0x06,0x09,0xff,0x11,0x13,0x1e,0xff,0x19,0x1d,0x2c,0xff,0x1e,0x22,0x36,0xff,0x29,0x30,0x45,0xff,0x2b,0x36,0x4e,0xff,0x36,0x41,0x5c,0xff,0xac,0xb2,0xbe,0xff,0xff,0xff,0xff,0x56,0xff,0xff,0xff,0x00,0xfe,0xf4,0xf8,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xeb,0xf3,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xdf,0xde,0xde,0x2d,0x4e,0x47,0x43,0xe8,0x2c,0x23,0x1b,0xff,0x1f,0x16,0x15,0xff,0x07,0x02,0x04,0xff,0x02,0x03,0x05,0xff,0x0a,0x06,0x09,0xff,0x1a,0x13,0x15,0xff,0x23,0x1b,0x1a,0xff,0x38,0x2f,0x2c,0xff,0x27,0x1d,0x1a,0xff,0x37,0x2a,0x28,0xff,0x4c,0x3f,0x3b,0xff,0x43,0x37,0x32,0xff,0x3e,0x32,0x2c,0xff,0x4a,0x3f,0x36,0xff,0x51,0x47,0x3e,0xff,0x3a,0x2f,0x29,0xff,0x34,0x27,0x25,0xff,0x2b,0x1e,0x1d,0xff,0x27,0x1b,0x1b,0xff,0x20,0x16,0x16,0xff,0x17,0x0c,0x0d,0xff,0x17,0x0d,0x0e,0xff,0x1f,0x17,0x1a,0xff,0x27,0x1e,0x23,0xff,0x28,0x1e,0x24,0xff,0x14,0x0d,0x14,0xff,0x32,0x38,0x51,0xff,0x3b,0x46,0x67,0xff,0x35,0x45,0x65,0xff,0x38,0x47,0x66,0xff,0x38,0x46,0x67,0xff,0x39,0x47,0x66,0xff,0x36,0x45,0x64,0xff,0x74,0x75,0x79,0xff,0xce,0xba,0xac,0xff,0xbf,0xae,0xa0,0xff,0xa9,0x99,0x8e,0xff,0xca,0xbe,0xb9,0xff,0xec,0xe5,0xe0,0xff,0xeb,0xe6,0xe0,0xff,0xf0,0xeb,0xe7,0xff,0xf0,0xec,0xea,0xff,0x8f,0xa3,0xc5,0xff,0x78,0x97,0xc6,0xff,0x77,0x92,0xbf,0xff,0x71,0x85,0xb3,0xff,0x65,0x7b,0xa5,0xff,0x58,0x6f,0x92,0xff,0x56,0x65,0x8a,0xff,0x51,0x5d,0x7e,0xff,0x46,0x52,0x72,0xff,0x42,0x4e,0x6e,0xff,0x42,0x50,0x72,0xff,0x4a,0x57,0x78,0xff,0x4e,0x60,0x84,0xff,0x56,0x64,0x81,0xff,0x21,0x1b,0x22,0xff,0x1d,0x14,0x17,0xff,0x35,0x35,0x39,0xff,0x24,0x26,0x29,0xff,0x01,0x00,0x02,0xff,0x08,0x03,0x07,0xff,0x09,0x03,0x05,0xff,0x17,0x0c,0x0e,0xff,0x2d,0x1a,0x1d,0xff,0x33,0x1f,0x22,0xff,0x1e,0x16,0x17,0xff,0x10,0x09,0x0c,0xff,0x0e,0x07,0x09,0xff,0x0e,0x07,0x0b,0xff,0x09,0x04,0x06,0xff,0x16,0x0e,0x0e,0xff,0x21,0x12,0x15,0xff,0x29,0x1c,0x20,0xff,0x0f,0x07,0x0b,0xff,0x05,0x01,0x03,0xff,0x0d,0x09,0x0b,0xff,0x16,0x0d,0x11,0xff,0x21,0x13,0x17,0xff,0x1f,0x12,0x14,0xff,0x08,0x05,0x04,0xff,0x1a,0x14,0x13,0xff,0x13,0x0b,0x0c,0xff,0x08,0x04,0x05,0xff,0x1c,0x13,0x12,0xff,0x34,0x27,0x25,0xff,0x24,0x17,0x16,0xff,0x13,0x09,0x09,0xff,0x12,0x0c,0x0d,0xff,0x0d,0x0c,0x0d,0xff,0x05,0x03,0x05,0xff,0x0c,0x07,0x08,0xff,0x11,0x0d,0x0e,0xff,0x04,0x01,0x04,0xff,0x03,0x01,0x01,0xff,0x05,0x03,0x04,0xff,0x04,0x01,0x04,0xff,0x06,0x03,0x05,0xff,0x05,0x02,0x05,0xff,0x04,0x01,0x03,0xff,0x05,0x05,0x07,0xff,0x11,0x13,0x1e,0xff,0x16,0x18,0x28,0xff,0x19,0x1e,0x2f,0xff,0x23,0x29,0x3d,0xff,0x2c,0x34,0x4c,0xff,0x90,0x97,0xa8,0xff,0xfe,0xfe,0xff,0x77,0xff,0xff,0xff,0x00,0xfe,0xf6,0xfa,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xee,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xd7,0xd6,0xd5,0x44,0x5d,0x54,0x4e,0xf4,0x2a,0x1f,0x1b,0xff,0x11,0x0a,0x0d,0xff,0x00,0x01,0x03,0xff,0x03,0x02,0x04,0xff,0x07,0x04,0x06,0xff,0x1a,0x14,0x14,0xff,0x27,0x1f,0x1e,0xff,0x39,0x2f,0x2d,0xff,0x3c,0x31,0x2e,0xff,0x31,0x27,0x22,0xff,0x36,0x2a,0x27,0xff,0x37,0x29,0x27,0xff,0x2b,0x1f,0x1d,0xff,0x20,0x15,0x15,0xff,0x25,0x19,0x1a,0xff,0x23,0x16,0x16,0xff,0x29,0x1b,0x1c,0xff,0x1c,0x11,0x12,0xff,0x13,0x0b,0x0c,0xff,0x19,0x10,0x12,0xff,0x1b,0x12,0x16,0xff,0x10,0x0c,0x0f,0xff,0x1e,0x16,0x1b,0xff,0x24,0x1b,0x21,0xff,0x13,0x0a,0x0f,0xff,0x2e,0x31,0x48,0xff,0x34,0x41,0x61,0xff,0x33,0x42,0x63,0xff,0x37,0x43,0x63,0xff,0x34,0x42,0x63,0xff,0x34,0x44,0x63,0xff,0x3e,0x4a,0x63,0xff,0xa4,0x98,0x91,0xff,0xcb,0xb7,0xab,0xff,0xa8,0x97,0x8b,0xff,0xae,0x9f,0x94,0xff,0xdc,0xd1,0xc9,0xff,0xea,0xe3,0xdc,0xff,0xec,0xe6,0xe0,0xff,0xf5,0xf0,0xeb,0xff,0xe6,0xe4,0xe4,0xff,0x7f,0x96,0xbe,0xff,0x76,0x99,0xc8,0xff,0x73,0x8f,0xbc,0xff,0x72,0x86,0xb5,0xff,0x68,0x7c,0xa6,0xff,0x5d,0x72,0x96,0xff,0x57,0x67,0x8a,0xff,0x4f,0x5e,0x7e,0xff,0x4a,0x56,0x75,0xff,0x46,0x50,0x6f,0xff,0x42,0x4f,0x6e,0xff,0x47,0x54,0x74,0xff,0x53,0x61,0x84,0xff,0x4d,0x52,0x69,0xff,0x1c,0x0e,0x13,0xff,0x2c,0x26,0x2a,0xff,0x30,0x33,0x36,0xff,0x04,0x03,0x06,0xff,0x04,0x00,0x05,0xff,0x14,0x08,0x0d,0xff,0x2e,0x1b,0x1c,0xff,0x43,0x29,0x2a,0xff,0x33,0x20,0x1f,0xff,0x14,0x0c,0x0c,0xff,0x0b,0x05,0x07,0xff,0x19,0x10,0x14,0xff,0x22,0x16,0x1a,0xff,0x12,0x09,0x0d,0xff,0x09,0x05,0x06,0xff,0x0d,0x07,0x07,0xff,0x21,0x13,0x16,0xff,0x28,0x1b,0x1f,0xff,0x15,0x0e,0x11,0xff,0x10,0x0a,0x0e,0xff,0x0b,0x05,0x07,0xff,0x13,0x09,0x0d,0xff,0x16,0x0c,0x0e,0xff,0x12,0x09,0x0b,0xff,0x0f,0x08,0x0b,0xff,0x17,0x0f,0x10,0xff,0x15,0x0e,0x0f,0xff,0x0d,0x07,0x08,0xff,0x28,0x1e,0x1f,0xff,0x1e,0x13,0x12,0xff,0x18,0x0f,0x0e,0xff,0x2f,0x21,0x21,0xff,0x1e,0x16,0x15,0xff,0x04,0x03,0x03,0xff,0x04,0x01,0x02,0xff,0x07,0x04,0x04,0xff,0x06,0x04,0x04,0xff,0x00,0x00,0x02,0xff,0x02,0x02,0x03,0xff,0x03,0x02,0x04,0xff,0x06,0x03,0x05,0xff,0x0a,0x05,0x08,0xff,0x09,0x03,0x06,0xff,0x03,0x02,0x03,0xff,0x04,0x05,0x06,0xff,0x12,0x13,0x1e,0xff,0x16,0x16,0x26,0xff,0x18,0x1e,0x2f,0xff,0x1f,0x27,0x3c,0xff,0x81,0x86,0x94,0xff,0xf9,0xf9,0xfb,0x91,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf8,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xcf,0xcd,0xcb,0x5a,0x4e,0x46,0x41,0xfe,0x1a,0x11,0x12,0xff,0x04,0x02,0x04,0xff,0x02,0x01,0x04,0xff,0x06,0x04,0x05,0xff,0x0b,0x07,0x07,0xff,0x0f,0x08,0x09,0xff,0x1c,0x13,0x12,0xff,0x35,0x2b,0x28,0xff,0x41,0x36,0x33,0xff,0x35,0x28,0x26,0xff,0x38,0x2b,0x28,0xff,0x24,0x19,0x17,0xff,0x20,0x15,0x15,0xff,0x1f,0x14,0x15,0xff,0x21,0x16,0x17,0xff,0x21,0x16,0x17,0xff,0x0f,0x07,0x08,0xff,0x14,0x0e,0x0f,0xff,0x0f,0x0b,0x0d,0xff,0x0d,0x08,0x0b,0xff,0x1a,0x11,0x16,0xff,0x31,0x27,0x2e,0xff,0x1d,0x13,0x19,0xff,0x11,0x06,0x08,0xff,0x29,0x2b,0x3f,0xff,0x2f,0x3e,0x5d,0xff,0x31,0x3d,0x5d,0xff,0x34,0x3f,0x60,0xff,0x32,0x3f,0x5f,0xff,0x31,0x40,0x61,0xff,0x5e,0x60,0x6d,0xff,0xc9,0xb7,0xaa,0xff,0xb9,0xa8,0x9c,0xff,0x98,0x88,0x7c,0xff,0xbd,0xb1,0xa5,0xff,0xe7,0xe0,0xd6,0xff,0xe8,0xe2,0xda,0xff,0xea,0xe5,0xde,0xff,0xf5,0xef,0xe9,0xff,0xdc,0xdc,0xde,0xff,0x76,0x91,0xba,0xff,0x78,0x96,0xc7,0xff,0x6f,0x8b,0xb9,0xff,0x6e,0x82,0xb1,0xff,0x68,0x7d,0xa7,0xff,0x5e,0x73,0x97,0xff,0x56,0x65,0x8a,0xff,0x50,0x5f,0x7f,0xff,0x4e,0x5b,0x7a,0xff,0x4c,0x56,0x74,0xff,0x45,0x51,0x70,0xff,0x47,0x53,0x74,0xff,0x56,0x62,0x81,0xff,0x33,0x32,0x3e,0xff,0x24,0x1c,0x1d,0xff,0x35,0x37,0x38,0xff,0x09,0x0a,0x0d,0xff,0x03,0x00,0x04,0xff,0x1b,0x0d,0x11,0xff,0x33,0x1b,0x1e,0xff,0x43,0x27,0x29,0xff,0x24,0x14,0x16,0xff,0x0a,0x05,0x06,0xff,0x20,0x12,0x15,0xff,0x37,0x22,0x25,0xff,0x33,0x20,0x24,0xff,0x1a,0x0e,0x12,0xff,0x0c,0x04,0x07,0xff,0x04,0x01,0x03,0xff,0x08,0x05,0x06,0xff,0x1e,0x11,0x15,0xff,0x1a,0x0d,0x11,0xff,0x18,0x0f,0x11,0xff,0x16,0x0f,0x10,0xff,0x14,0x0c,0x0e,0xff,0x0f,0x07,0x0a,0xff,0x12,0x0c,0x0d,0xff,0x11,0x0c,0x0d,0xff,0x07,0x01,0x04,0xff,0x12,0x0b,0x0c,0xff,0x1c,0x13,0x15,0xff,0x11,0x08,0x09,0xff,0x1d,0x13,0x15,0xff,0x17,0x0f,0x10,0xff,0x13,0x0b,0x0b,0xff,0x36,0x26,0x26,0xff,0x16,0x0f,0x0f,0xff,0x01,0x00,0x00,0xff,0x05,0x02,0x02,0xff,0x0a,0x06,0x07,0xff,0x02,0x01,0x02,0xff,0x01,0x00,0x03,0xff,0x02,0x01,0x03,0xff,0x03,0x02,0x04,0xff,0x07,0x03,0x06,0xff,0x0a,0x05,0x07,0xff,0x0b,0x04,0x07,0xff,0x03,0x01,0x02,0xff,0x05,0x05,0x07,0xff,0x12,0x14,0x1e,0xff,0x14,0x14,0x23,0xff,0x14,0x19,0x2b,0xff,0x6d,0x73,0x81,0xff,0xf1,0xf1,0xf3,0xaa,0xff,0xff,0xff,0x03,0xff,0xfb,0xfd,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xcc,0xcb,0xc9,0x68,0x40,0x37,0x35,0xff,0x0c,0x05,0x06,0xff,0x03,0x00,0x03,0xff,0x05,0x02,0x04,0xff,0x07,0x04,0x04,0xff,0x10,0x0b,0x0c,0xff,0x10,0x09,0x09,0xff,0x29,0x20,0x1e,0xff,0x2c,0x21,0x20,0xff,0x32,0x27,0x24,0xff,0x29,0x1c,0x19,0xff,0x2c,0x1f,0x1e,0xff,0x23,0x17,0x17,0xff,0x1f,0x15,0x16,0xff,0x16,0x0c,0x0e,0xff,0x14,0x0d,0x0e,0xff,0x14,0x0d,0x0f,0xff,0x13,0x0b,0x0d,0xff,0x0b,0x05,0x09,0xff,0x13,0x0c,0x0e,0xff,0x23,0x1a,0x1c,0xff,0x2c,0x23,0x27,0xff,0x24,0x1a,0x1e,0xff,0x12,0x06,0x07,0xff,0x21,0x24,0x32,0xff,0x2c,0x3b,0x57,0xff,0x31,0x3c,0x5a,0xff,0x30,0x3b,0x5c,0xff,0x2f,0x3d,0x5c,0xff,0x30,0x3e,0x5b,0xff,0x91,0x87,0x84,0xff,0xcc,0xba,0xac,0xff,0xa3,0x93,0x86,0xff,0x96,0x86,0x7a,0xff,0xd3,0xc9,0xbf,0xff,0xe7,0xe3,0xda,0xff,0xea,0xe3,0xdb,0xff,0xe6,0xe2,0xdc,0xff,0xf8,0xf0,0xe9,0xff,0xd0,0xd2,0xd6,0xff,0x6e,0x92,0xbb,0xff,0x76,0x93,0xc7,0xff,0x6c,0x87,0xb6,0xff,0x6a,0x80,0xab,0xff,0x63,0x7a,0xa3,0xff,0x59,0x6f,0x93,0xff,0x58,0x67,0x8b,0xff,0x51,0x5f,0x80,0xff,0x4f,0x5d,0x7c,0xff,0x4e,0x5b,0x79,0xff,0x4b,0x57,0x77,0xff,0x4c,0x57,0x7a,0xff,0x54,0x5e,0x7c,0xff,0x22,0x1e,0x25,0xff,0x2d,0x2f,0x2f,0xff,0x1b,0x1c,0x1e,0xff,0x00,0x00,0x01,0xff,0x07,0x02,0x07,0xff,0x1d,0x0e,0x12,0xff,0x25,0x16,0x19,0xff,0x0e,0x07,0x06,0xff,0x1a,0x0f,0x0e,0xff,0x3f,0x29,0x27,0xff,0x47,0x2c,0x30,0xff,0x32,0x1e,0x20,0xff,0x18,0x0b,0x0c,0xff,0x07,0x03,0x04,0xff,0x08,0x05,0x08,0xff,0x04,0x04,0x05,0xff,0x0e,0x0a,0x0c,0xff,0x18,0x10,0x13,0xff,0x0f,0x07,0x0a,0xff,0x20,0x15,0x15,0xff,0x18,0x0d,0x0d,0xff,0x18,0x0e,0x0f,0xff,0x0b,0x04,0x06,0xff,0x08,0x05,0x06,0xff,0x0a,0x08,0x08,0xff,0x06,0x03,0x03,0xff,0x0f,0x09,0x0a,0xff,0x14,0x0d,0x0e,0xff,0x18,0x10,0x11,0xff,0x19,0x12,0x13,0xff,0x0e,0x08,0x09,0xff,0x1e,0x13,0x12,0xff,0x2f,0x22,0x22,0xff,0x0a,0x07,0x06,0xff,0x0a,0x08,0x08,0xff,0x0d,0x09,0x0a,0xff,0x13,0x0d,0x0f,0xff,0x00,0x00,0x02,0xff,0x01,0x00,0x03,0xff,0x04,0x01,0x04,0xff,0x03,0x02,0x04,0xff,0x08,0x04,0x07,0xff,0x09,0x06,0x06,0xff,0x09,0x04,0x06,0xff,0x04,0x02,0x04,0xff,0x07,0x04,0x08,0xff,0x0f,0x10,0x1a,0xff,0x0d,0x10,0x1e,0xff,0x63,0x66,0x72,0xff,0xef,0xf0,0xf1,0xb5,0xff,0xff,0xff,0x09,0xff,0xfd,0xfe,0x00,0xfe,0xec,0xf3,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xc5,0xc3,0xc2,0x6b,0x35,0x2f,0x2f,0xff,0x01,0x00,0x00,0xff,0x05,0x02,0x04,0xff,0x02,0x02,0x04,0xff,0x09,0x04,0x07,0xff,0x0e,0x08,0x0a,0xff,0x21,0x18,0x1a,0xff,0x2f,0x21,0x24,0xff,0x28,0x1c,0x1c,0xff,0x29,0x1d,0x1c,0xff,0x23,0x18,0x17,0xff,0x19,0x0f,0x0f,0xff,0x12,0x0a,0x0b,0xff,0x16,0x0e,0x10,0xff,0x1b,0x11,0x15,0xff,0x1b,0x11,0x15,0xff,0x17,0x0e,0x10,0xff,0x18,0x10,0x13,0xff,0x16,0x0f,0x13,0xff,0x1d,0x16,0x19,0xff,0x2d,0x23,0x27,0xff,0x1a,0x10,0x14,0xff,0x10,0x05,0x06,0xff,0x17,0x17,0x24,0xff,0x26,0x32,0x4f,0xff,0x2c,0x38,0x56,0xff,0x30,0x3a,0x5b,0xff,0x2c,0x3b,0x5b,0xff,0x46,0x4f,0x5f,0xff,0xbc,0xad,0xa2,0xff,0xbf,0xae,0xa2,0xff,0x99,0x8a,0x7f,0xff,0xa4,0x98,0x8c,0xff,0xe3,0xdb,0xd1,0xff,0xe9,0xe4,0xdc,0xff,0xeb,0xe3,0xdd,0xff,0xe6,0xe2,0xdc,0xff,0xf8,0xf2,0xeb,0xff,0xc0,0xc3,0xcd,0xff,0x6d,0x90,0xbd,0xff,0x77,0x95,0xc4,0xff,0x6c,0x89,0xb7,0xff,0x65,0x7f,0xad,0xff,0x62,0x78,0xa2,0xff,0x5a,0x6f,0x92,0xff,0x57,0x67,0x8b,0xff,0x52,0x61,0x83,0xff,0x51,0x60,0x80,0xff,0x4e,0x5c,0x7b,0xff,0x4e,0x5a,0x7b,0xff,0x50,0x60,0x7f,0xff,0x3a,0x3f,0x52,0xff,0x2a,0x25,0x29,0xff,0x2b,0x2d,0x2f,0xff,0x01,0x00,0x02,0xff,0x05,0x02,0x04,0xff,0x15,0x0b,0x0e,0xff,0x20,0x12,0x16,0xff,0x17,0x0c,0x0f,0xff,0x31,0x1f,0x1c,0xff,0x4d,0x32,0x2c,0xff,0x42,0x2b,0x28,0xff,0x25,0x13,0x16,0xff,0x11,0x06,0x09,0xff,0x08,0x03,0x06,0xff,0x07,0x01,0x05,0xff,0x07,0x02,0x03,0xff,0x06,0x06,0x06,0xff,0x13,0x0b,0x0c,0xff,0x11,0x0d,0x0e,0xff,0x04,0x03,0x03,0xff,0x16,0x0d,0x0e,0xff,0x11,0x0a,0x0c,0xff,0x0e,0x07,0x0a,0xff,0x0e,0x07,0x08,0xff,0x07,0x04,0x07,0xff,0x07,0x04,0x06,0xff,0x08,0x03,0x04,0xff,0x06,0x03,0x05,0xff,0x0e,0x09,0x0a,0xff,0x1b,0x10,0x12,0xff,0x10,0x08,0x0c,0xff,0x06,0x02,0x02,0xff,0x23,0x14,0x14,0xff,0x1b,0x0f,0x10,0xff,0x16,0x13,0x13,0xff,0x11,0x0c,0x0d,0xff,0x10,0x0a,0x0a,0xff,0x0b,0x07,0x09,0xff,0x03,0x00,0x04,0xff,0x03,0x00,0x04,0xff,0x04,0x01,0x05,0xff,0x04,0x02,0x04,0xff,0x0e,0x08,0x0a,0xff,0x0d,0x08,0x09,0xff,0x07,0x03,0x05,0xff,0x04,0x01,0x05,0xff,0x05,0x02,0x04,0xff,0x10,0x0e,0x19,0xff,0x61,0x64,0x6d,0xff,0xea,0xeb,0xec,0xb7,0xff,0xff,0xff,0x0c,0xff,0xfd,0xfd,0x00,0xfe,0xec,0xf3,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xfa,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf3,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xca,0xc7,0xc7,0x69,0x36,0x2f,0x30,0xfe,0x00,0x00,0x00,0xff,0x00,0x01,0x03,0xff,0x08,0x03,0x06,0xff,0x0a,0x05,0x07,0xff,0x14,0x0e,0x0f,0xff,0x2a,0x1e,0x20,0xff,0x37,0x2b,0x2b,0xff,0x38,0x2d,0x2b,0xff,0x23,0x19,0x18,0xff,0x1a,0x10,0x11,0xff,0x10,0x06,0x09,0xff,0x1b,0x11,0x13,0xff,0x1d,0x13,0x17,0xff,0x17,0x0c,0x10,0xff,0x0e,0x05,0x07,0xff,0x1d,0x15,0x18,0xff,0x27,0x20,0x23,0xff,0x29,0x21,0x24,0xff,0x29,0x1f,0x23,0xff,0x13,0x0a,0x0d,0xff,0x0b,0x03,0x05,0xff,0x0c,0x09,0x12,0xff,0x1e,0x23,0x3c,0xff,0x28,0x33,0x4f,0xff,0x2f,0x3b,0x59,0xff,0x2e,0x38,0x58,0xff,0x86,0x82,0x81,0xff,0xc7,0xb8,0xaa,0xff,0xa6,0x97,0x8b,0xff,0x8e,0x80,0x76,0xff,0xbd,0xb3,0xa9,0xff,0xe7,0xe0,0xd8,0xff,0xe7,0xe0,0xd9,0xff,0xe4,0xdd,0xd7,0xff,0xe6,0xe1,0xdb,0xff,0xf9,0xf2,0xe8,0xff,0xb6,0xbf,0xcb,0xff,0x71,0x92,0xbf,0xff,0x79,0x97,0xc4,0xff,0x6d,0x8a,0xb6,0xff,0x65,0x7f,0xac,0xff,0x5d,0x74,0xa0,0xff,0x59,0x6e,0x93,0xff,0x57,0x69,0x8c,0xff,0x54,0x64,0x87,0xff,0x52,0x62,0x83,0xff,0x51,0x5f,0x7e,0xff,0x51,0x5e,0x7f,0xff,0x52,0x5d,0x79,0xff,0x2e,0x2a,0x2f,0xff,0x37,0x33,0x36,0xff,0x0a,0x09,0x0c,0xff,0x03,0x00,0x03,0xff,0x0d,0x06,0x09,0xff,0x15,0x0a,0x0d,0xff,0x21,0x11,0x13,0xff,0x3c,0x25,0x27,0xff,0x45,0x2b,0x2b,0xff,0x2d,0x1a,0x18,0xff,0x16,0x08,0x0d,0xff,0x09,0x02,0x06,0xff,0x09,0x03,0x06,0xff,0x07,0x02,0x05,0xff,0x03,0x00,0x03,0xff,0x03,0x00,0x02,0xff,0x02,0x00,0x01,0xff,0x13,0x0c,0x0c,0xff,0x0d,0x08,0x08,0xff,0x05,0x03,0x03,0xff,0x08,0x03,0x06,0xff,0x07,0x02,0x04,0xff,0x08,0x03,0x04,0xff,0x0c,0x05,0x07,0xff,0x0a,0x05,0x08,0xff,0x0a,0x06,0x08,0xff,0x09,0x04,0x07,0xff,0x03,0x00,0x03,0xff,0x06,0x03,0x04,0xff,0x14,0x0d,0x0f,0xff,0x10,0x09,0x0c,0xff,0x0a,0x05,0x07,0xff,0x23,0x18,0x17,0xff,0x10,0x08,0x08,0xff,0x17,0x15,0x15,0xff,0x11,0x0a,0x0c,0xff,0x12,0x09,0x0c,0xff,0x05,0x02,0x03,0xff,0x03,0x00,0x02,0xff,0x05,0x02,0x05,0xff,0x08,0x04,0x06,0xff,0x06,0x03,0x05,0xff,0x10,0x09,0x0a,0xff,0x11,0x0b,0x0c,0xff,0x0b,0x07,0x08,0xff,0x06,0x03,0x05,0xff,0x00,0x00,0x00,0xff,0x68,0x67,0x6d,0xff,0xf0,0xf0,0xf1,0xb4,0xff,0xff,0xff,0x0b,0xff,0xfd,0xfe,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xce,0xcc,0xcc,0x60,0x38,0x35,0x37,0xfa,0x00,0x00,0x00,0xff,0x06,0x01,0x04,0xff,0x07,0x02,0x03,0xff,0x10,0x0a,0x0c,0xff,0x19,0x11,0x12,0xff,0x29,0x1e,0x1c,0xff,0x36,0x2b,0x29,0xff,0x30,0x27,0x25,0xff,0x29,0x1e,0x1c,0xff,0x34,0x2a,0x27,0xff,0x23,0x17,0x19,0xff,0x19,0x0e,0x11,0xff,0x14,0x09,0x0d,0xff,0x19,0x0f,0x13,0xff,0x22,0x1a,0x1d,0xff,0x25,0x1e,0x22,0xff,0x25,0x1d,0x21,0xff,0x1e,0x14,0x18,0xff,0x11,0x09,0x0c,0xff,0x0e,0x08,0x0b,0xff,0x08,0x03,0x07,0xff,0x19,0x16,0x29,0xff,0x29,0x31,0x4c,0xff,0x27,0x36,0x53,0xff,0x45,0x4a,0x5e,0xff,0xc5,0xb5,0xaa,0xff,0xb5,0xa6,0x97,0xff,0x9a,0x8d,0x80,0xff,0x96,0x88,0x7d,0xff,0xd0,0xc6,0xbe,0xff,0xe4,0xdf,0xd7,0xff,0xe3,0xdc,0xd5,0xff,0xe2,0xdb,0xd5,0xff,0xe6,0xdf,0xd9,0xff,0xf7,0xee,0xe5,0xff,0xa9,0xb6,0xc9,0xff,0x73,0x96,0xc1,0xff,0x79,0x96,0xc3,0xff,0x6e,0x89,0xb6,0xff,0x63,0x7d,0xa8,0xff,0x5b,0x72,0x9e,0xff,0x57,0x6d,0x93,0xff,0x56,0x68,0x8c,0xff,0x55,0x64,0x89,0xff,0x54,0x63,0x86,0xff,0x53,0x61,0x81,0xff,0x54,0x62,0x84,0xff,0x48,0x4f,0x68,0xff,0x36,0x34,0x37,0xff,0x1c,0x1b,0x1f,0xff,0x03,0x00,0x04,0xff,0x07,0x03,0x07,0xff,0x05,0x03,0x05,0xff,0x1d,0x0e,0x13,0xff,0x35,0x1e,0x20,0xff,0x36,0x21,0x20,0xff,0x26,0x14,0x16,0xff,0x10,0x06,0x0b,0xff,0x0f,0x02,0x08,0xff,0x11,0x06,0x0c,0xff,0x0b,0x04,0x08,0xff,0x05,0x00,0x03,0xff,0x01,0x00,0x03,0xff,0x02,0x00,0x03,0xff,0x05,0x01,0x03,0xff,0x0e,0x0a,0x0b,0xff,0x0b,0x06,0x07,0xff,0x05,0x01,0x02,0xff,0x01,0x01,0x03,0xff,0x07,0x03,0x05,0xff,0x05,0x01,0x03,0xff,0x02,0x02,0x04,0xff,0x0f,0x0c,0x0b,0xff,0x0c,0x08,0x0a,0xff,0x09,0x06,0x09,0xff,0x06,0x03,0x05,0xff,0x05,0x02,0x04,0xff,0x07,0x06,0x05,0xff,0x0c,0x09,0x09,0xff,0x0b,0x06,0x09,0xff,0x15,0x10,0x10,0xff,0x06,0x02,0x02,0xff,0x0b,0x07,0x08,0xff,0x0e,0x07,0x09,0xff,0x12,0x09,0x0c,0xff,0x05,0x02,0x03,0xff,0x02,0x00,0x00,0xff,0x0a,0x08,0x08,0xff,0x0d,0x08,0x09,0xff,0x09,0x06,0x06,0xff,0x0c,0x07,0x07,0xff,0x0f,0x0a,0x0a,0xff,0x0c,0x07,0x08,0xff,0x0c,0x07,0x07,0xff,0x6d,0x6b,0x6b,0xff,0xf0,0xf0,0xf0,0xaa,0xff,0xff,0xff,0x09,0xff,0xfc,0xfd,0x00,0xfe,0xec,0xf3,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xdd,0xdb,0xdd,0x4b,0x48,0x44,0x46,0xec,0x00,0x00,0x00,0xff,0x03,0x00,0x02,0xff,0x04,0x02,0x05,0xff,0x0a,0x06,0x09,0xff,0x13,0x0a,0x0b,0xff,0x1e,0x14,0x14,0xff,0x1e,0x15,0x15,0xff,0x24,0x1b,0x19,0xff,0x38,0x30,0x2b,0xff,0x2f,0x26,0x27,0xff,0x1c,0x12,0x15,0xff,0x17,0x0e,0x0f,0xff,0x17,0x0c,0x10,0xff,0x1a,0x12,0x14,0xff,0x2e,0x27,0x28,0xff,0x29,0x22,0x23,0xff,0x24,0x1c,0x1f,0xff,0x11,0x09,0x0d,0xff,0x12,0x0a,0x0e,0xff,0x0d,0x06,0x0a,0xff,0x11,0x10,0x20,0xff,0x29,0x31,0x50,0xff,0x20,0x30,0x4d,0xff,0x80,0x7c,0x7c,0xff,0xd4,0xc3,0xb2,0xff,0x9d,0x90,0x83,0xff,0x97,0x89,0x7e,0xff,0xa6,0x97,0x8e,0xff,0xe4,0xd8,0xd0,0xff,0xe2,0xdc,0xd5,0xff,0xdb,0xd4,0xcf,0xff,0xe5,0xdd,0xd8,0xff,0xe4,0xdc,0xd6,0xff,0xf1,0xe7,0xe0,0xff,0x9f,0xab,0xc6,0xff,0x73,0x98,0xc4,0xff,0x77,0x96,0xc2,0xff,0x6c,0x89,0xb6,0xff,0x66,0x7e,0xa9,0xff,0x5f,0x75,0x9e,0xff,0x56,0x6b,0x90,0xff,0x55,0x66,0x8c,0xff,0x50,0x66,0x87,0xff,0x50,0x64,0x85,0xff,0x50,0x60,0x83,0xff,0x54,0x62,0x84,0xff,0x3e,0x43,0x54,0xff,0x1d,0x20,0x22,0xff,0x02,0x01,0x05,0xff,0x0b,0x07,0x0a,0xff,0x09,0x03,0x06,0xff,0x0f,0x04,0x08,0xff,0x26,0x13,0x17,0xff,0x27,0x15,0x18,0xff,0x1e,0x0d,0x0f,0xff,0x11,0x06,0x09,0xff,0x0c,0x04,0x08,0xff,0x0c,0x06,0x0a,0xff,0x0a,0x04,0x05,0xff,0x06,0x02,0x04,0xff,0x04,0x01,0x04,0xff,0x02,0x00,0x03,0xff,0x05,0x01,0x04,0xff,0x0b,0x05,0x08,0xff,0x0b,0x05,0x08,0xff,0x06,0x02,0x05,0xff,0x03,0x00,0x02,0xff,0x03,0x01,0x01,0xff,0x04,0x01,0x03,0xff,0x05,0x02,0x06,0xff,0x04,0x02,0x05,0xff,0x08,0x05,0x07,0xff,0x0a,0x05,0x08,0xff,0x12,0x0c,0x0f,0xff,0x0a,0x05,0x08,0xff,0x0a,0x06,0x06,0xff,0x0b,0x07,0x07,0xff,0x0a,0x05,0x07,0xff,0x0b,0x05,0x09,0xff,0x0a,0x06,0x08,0xff,0x04,0x02,0x05,0xff,0x0a,0x05,0x07,0xff,0x0a,0x04,0x06,0xff,0x11,0x0b,0x0e,0xff,0x05,0x02,0x04,0xff,0x05,0x01,0x03,0xff,0x07,0x02,0x05,0xff,0x0f,0x05,0x0a,0xff,0x10,0x09,0x0a,0xff,0x09,0x04,0x05,0xff,0x07,0x01,0x02,0xff,0x0d,0x06,0x08,0xff,0x84,0x81,0x82,0xff,0xf9,0xf9,0xf9,0x91,0xff,0xff,0xff,0x04,0xff,0xfd,0xfe,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xfb,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x00,0xec,0xeb,0xec,0x31,0x63,0x61,0x63,0xdc,0x06,0x03,0x05,0xff,0x03,0x00,0x01,0xff,0x0a,0x05,0x08,0xff,0x11,0x0a,0x0d,0xff,0x14,0x0c,0x0d,0xff,0x20,0x17,0x18,0xff,0x20,0x17,0x18,0xff,0x2a,0x21,0x20,0xff,0x20,0x17,0x18,0xff,0x24,0x1a,0x1c,0xff,0x29,0x1f,0x20,0xff,0x24,0x1a,0x1c,0xff,0x33,0x29,0x2a,0xff,0x35,0x2d,0x2d,0xff,0x25,0x1d,0x1e,0xff,0x25,0x1b,0x1f,0xff,0x18,0x10,0x13,0xff,0x0c,0x03,0x07,0xff,0x0b,0x03,0x06,0xff,0x0c,0x0c,0x18,0xff,0x23,0x2d,0x4b,0xff,0x38,0x3f,0x4f,0xff,0xbc,0xaf,0xa3,0xff,0xb7,0xa7,0x9b,0xff,0x98,0x8a,0x7d,0xff,0x94,0x86,0x7a,0xff,0xb5,0xa9,0x9d,0xff,0xeb,0xdf,0xd7,0xff,0xe2,0xdb,0xd3,0xff,0xdc,0xd5,0xd0,0xff,0xe4,0xdc,0xd7,0xff,0xec,0xe5,0xde,0xff,0xf2,0xea,0xe4,0xff,0x9c,0xac,0xc6,0xff,0x77,0x9c,0xc4,0xff,0x77,0x97,0xc2,0xff,0x6e,0x89,0xb7,0xff,0x66,0x7f,0xab,0xff,0x5f,0x75,0x9e,0xff,0x56,0x6b,0x92,0xff,0x55,0x67,0x8c,0xff,0x54,0x67,0x8a,0xff,0x50,0x63,0x85,0xff,0x51,0x61,0x84,0xff,0x48,0x53,0x6d,0xff,0x2f,0x31,0x37,0xff,0x0d,0x0d,0x0f,0xff,0x09,0x03,0x07,0xff,0x0e,0x09,0x0b,0xff,0x08,0x04,0x04,0xff,0x0f,0x03,0x08,0xff,0x1a,0x0c,0x0f,0xff,0x1c,0x0e,0x10,0xff,0x14,0x06,0x0a,0xff,0x0d,0x03,0x06,0xff,0x0b,0x05,0x07,0xff,0x06,0x02,0x05,0xff,0x06,0x01,0x04,0xff,0x07,0x04,0x05,0xff,0x04,0x02,0x05,0xff,0x03,0x00,0x03,0xff,0x0d,0x06,0x0a,0xff,0x0f,0x07,0x0b,0xff,0x0b,0x05,0x08,0xff,0x05,0x02,0x04,0xff,0x03,0x00,0x03,0xff,0x03,0x00,0x02,0xff,0x04,0x01,0x02,0xff,0x05,0x02,0x04,0xff,0x07,0x03,0x06,0xff,0x06,0x02,0x05,0xff,0x07,0x03,0x06,0xff,0x0a,0x05,0x07,0xff,0x09,0x04,0x05,0xff,0x08,0x04,0x04,0xff,0x0a,0x07,0x07,0xff,0x0b,0x07,0x0a,0xff,0x08,0x04,0x07,0xff,0x07,0x03,0x05,0xff,0x03,0x02,0x03,0xff,0x04,0x01,0x03,0xff,0x06,0x03,0x04,0xff,0x0d,0x08,0x0b,0xff,0x07,0x02,0x05,0xff,0x07,0x02,0x05,0xff,0x0a,0x05,0x08,0xff,0x0a,0x05,0x09,0xff,0x12,0x0b,0x0b,0xff,0x00,0x00,0x00,0xff,0x1d,0x19,0x1b,0xff,0x9f,0x9d,0x9f,0xfd,0xff,0xff,0xff,0x73,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xeb,0xf2,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xfb,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xef,0xf4,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xf7,0xf7,0xf7,0x1e,0x8b,0x88,0x8a,0xbf,0x10,0x0c,0x0e,0xff,0x02,0x00,0x00,0xff,0x0b,0x06,0x08,0xff,0x0b,0x05,0x05,0xff,0x17,0x0f,0x10,0xff,0x1c,0x12,0x14,0xff,0x25,0x1b,0x1d,0xff,0x18,0x0e,0x0f,0xff,0x1d,0x14,0x14,0xff,0x28,0x1e,0x20,0xff,0x2b,0x22,0x23,0xff,0x36,0x2c,0x2b,0xff,0x2d,0x25,0x23,0xff,0x28,0x20,0x20,0xff,0x26,0x1b,0x1f,0xff,0x1c,0x11,0x16,0xff,0x13,0x09,0x0e,0xff,0x10,0x08,0x0b,0xff,0x0e,0x0d,0x18,0xff,0x1c,0x26,0x40,0xff,0x69,0x68,0x69,0xff,0xcb,0xba,0xac,0xff,0x9e,0x8f,0x83,0xff,0xa4,0x96,0x87,0xff,0x92,0x84,0x77,0xff,0xcd,0xc3,0xb7,0xff,0xe6,0xde,0xd5,0xff,0xe5,0xdc,0xd5,0xff,0xe5,0xdd,0xd8,0xff,0xe1,0xda,0xd4,0xff,0xed,0xe5,0xdf,0xff,0xf1,0xe9,0xe5,0xff,0x98,0xac,0xc6,0xff,0x7e,0xa1,0xc7,0xff,0x7b,0x9b,0xc1,0xff,0x72,0x8e,0xb7,0xff,0x68,0x83,0xae,0xff,0x60,0x78,0xa1,0xff,0x57,0x6d,0x94,0xff,0x57,0x69,0x8d,0xff,0x54,0x66,0x8a,0xff,0x50,0x61,0x84,0xff,0x4f,0x5f,0x82,0xff,0x44,0x50,0x65,0xff,0x1f,0x1e,0x22,0xff,0x05,0x02,0x03,0xff,0x16,0x0d,0x0f,0xff,0x10,0x09,0x0b,0xff,0x09,0x04,0x05,0xff,0x14,0x08,0x0c,0xff,0x1f,0x10,0x13,0xff,0x14,0x09,0x0c,0xff,0x0b,0x03,0x07,0xff,0x08,0x03,0x04,0xff,0x06,0x02,0x04,0xff,0x08,0x02,0x05,0xff,0x0b,0x04,0x07,0xff,0x08,0x03,0x06,0xff,0x03,0x01,0x04,0xff,0x0a,0x04,0x07,0xff,0x17,0x0e,0x12,0xff,0x11,0x09,0x0c,0xff,0x07,0x02,0x05,0xff,0x03,0x00,0x04,0xff,0x04,0x00,0x03,0xff,0x03,0x00,0x03,0xff,0x04,0x02,0x02,0xff,0x03,0x01,0x02,0xff,0x05,0x02,0x05,0xff,0x08,0x05,0x07,0xff,0x06,0x03,0x05,0xff,0x0b,0x08,0x09,0xff,0x0c,0x08,0x08,0xff,0x09,0x05,0x05,0xff,0x09,0x06,0x07,0xff,0x09,0x05,0x08,0xff,0x06,0x01,0x05,0xff,0x09,0x05,0x08,0xff,0x0b,0x09,0x09,0xff,0x02,0x00,0x02,0xff,0x04,0x01,0x04,0xff,0x0a,0x05,0x08,0xff,0x0a,0x04,0x07,0xff,0x0a,0x04,0x07,0xff,0x0b,0x05,0x08,0xff,0x04,0x00,0x04,0xff,0x06,0x00,0x00,0xff,0x35,0x2f,0x31,0xff,0xc0,0xbf,0xc0,0xed,0xff,0xff,0xff,0x55,0xff,0xff,0xff,0x00,0xff,0xf9,0xfb,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xeb,0xf2,0x00,0xff,0xfb,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x06,0xb3,0xb2,0xb3,0x93,0x32,0x2d,0x30,0xff,0x00,0x00,0x00,0xff,0x0a,0x04,0x05,0xff,0x16,0x0d,0x0e,0xff,0x1e,0x14,0x15,0xff,0x18,0x0e,0x10,0xff,0x1f,0x16,0x17,0xff,0x1f,0x16,0x18,0xff,0x1c,0x12,0x14,0xff,0x16,0x0e,0x0f,0xff,0x36,0x2d,0x2c,0xff,0x2d,0x24,0x23,0xff,0x23,0x1a,0x1b,0xff,0x21,0x17,0x1b,0xff,0x1b,0x11,0x15,0xff,0x11,0x06,0x0b,0xff,0x10,0x08,0x0a,0xff,0x0e,0x0e,0x19,0xff,0x24,0x2a,0x3f,0xff,0xa1,0x99,0x90,0xff,0xad,0x9d,0x8e,0xff,0x8a,0x7a,0x6c,0xff,0xa3,0x92,0x86,0xff,0x97,0x88,0x7d,0xff,0xe0,0xd9,0xcf,0xff,0xe2,0xdb,0xd4,0xff,0xdf,0xd9,0xd1,0xff,0xe4,0xdd,0xd6,0xff,0xe3,0xdc,0xd6,0xff,0xed,0xe6,0xde,0xff,0xea,0xe3,0xe1,0xff,0x95,0xac,0xc7,0xff,0x81,0xa2,0xc8,0xff,0x7a,0x99,0xbf,0xff,0x72,0x90,0xb7,0xff,0x6a,0x86,0xad,0xff,0x63,0x7c,0xa2,0xff,0x5b,0x72,0x98,0xff,0x57,0x6c,0x91,0xff,0x54,0x68,0x8a,0xff,0x50,0x61,0x85,0xff,0x4e,0x61,0x81,0xff,0x43,0x4e,0x5c,0xff,0x0d,0x0d,0x0e,0xff,0x0a,0x06,0x06,0xff,0x18,0x0f,0x10,0xff,0x11,0x09,0x0a,0xff,0x0e,0x05,0x07,0xff,0x1b,0x0b,0x10,0xff,0x15,0x0a,0x0d,0xff,0x06,0x02,0x03,0xff,0x08,0x02,0x04,0xff,0x0e,0x05,0x08,0xff,0x0f,0x06,0x0a,0xff,0x11,0x08,0x0b,0xff,0x0b,0x05,0x08,0xff,0x06,0x02,0x03,0xff,0x03,0x01,0x02,0xff,0x19,0x0d,0x11,0xff,0x18,0x0d,0x12,0xff,0x0c,0x05,0x09,0xff,0x02,0x01,0x04,0xff,0x02,0x00,0x03,0xff,0x03,0x00,0x03,0xff,0x03,0x00,0x03,0xff,0x03,0x01,0x01,0xff,0x03,0x01,0x01,0xff,0x04,0x02,0x02,0xff,0x06,0x04,0x05,0xff,0x0f,0x0b,0x0d,0xff,0x13,0x0e,0x0f,0xff,0x0b,0x07,0x07,0xff,0x09,0x04,0x05,0xff,0x0e,0x08,0x09,0xff,0x0d,0x07,0x0a,0xff,0x05,0x01,0x04,0xff,0x09,0x06,0x09,0xff,0x0a,0x08,0x08,0xff,0x04,0x02,0x03,0xff,0x04,0x01,0x05,0xff,0x03,0x01,0x03,0xff,0x07,0x02,0x05,0xff,0x0b,0x04,0x07,0xff,0x03,0x00,0x01,0xff,0x02,0x00,0x02,0xff,0x5d,0x5a,0x5d,0xff,0xe2,0xe1,0xe1,0xd1,0xff,0xff,0xff,0x2b,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf9,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xdd,0xdd,0xdd,0x5a,0x5d,0x5a,0x5b,0xf0,0x0b,0x07,0x07,0xff,0x0a,0x02,0x03,0xff,0x1b,0x12,0x13,0xff,0x21,0x17,0x18,0xff,0x21,0x18,0x17,0xff,0x26,0x1d,0x1d,0xff,0x2b,0x22,0x22,0xff,0x1a,0x12,0x10,0xff,0x1d,0x15,0x14,0xff,0x1b,0x13,0x14,0xff,0x24,0x1d,0x1e,0xff,0x25,0x1c,0x1d,0xff,0x1a,0x10,0x13,0xff,0x10,0x05,0x09,0xff,0x0d,0x07,0x09,0xff,0x06,0x05,0x11,0xff,0x47,0x47,0x4d,0xff,0xb8,0xa9,0x99,0xff,0x95,0x85,0x75,0xff,0x82,0x74,0x66,0xff,0x97,0x88,0x7c,0xff,0xac,0xa0,0x95,0xff,0xe4,0xdf,0xd5,0xff,0xdf,0xd8,0xd0,0xff,0xdf,0xd6,0xcf,0xff,0xe4,0xdc,0xd6,0xff,0xce,0xc7,0xc1,0xff,0xdc,0xd4,0xcb,0xff,0xdb,0xd5,0xd0,0xff,0x91,0xa8,0xc3,0xff,0x83,0xa3,0xc8,0xff,0x7a,0x9a,0xbe,0xff,0x74,0x93,0xb6,0xff,0x69,0x86,0xa9,0xff,0x64,0x7d,0xa2,0xff,0x5f,0x76,0x9b,0xff,0x59,0x6f,0x91,0xff,0x54,0x68,0x89,0xff,0x4e,0x62,0x83,0xff,0x51,0x62,0x7d,0xff,0x2b,0x31,0x3a,0xff,0x04,0x03,0x03,0xff,0x11,0x0a,0x0c,0xff,0x12,0x0c,0x0d,0xff,0x0c,0x07,0x07,0xff,0x08,0x04,0x05,0xff,0x0d,0x04,0x08,0xff,0x11,0x07,0x08,0xff,0x1b,0x0f,0x0f,0xff,0x27,0x16,0x16,0xff,0x25,0x13,0x16,0xff,0x1a,0x0a,0x0e,0xff,0x0c,0x05,0x08,0xff,0x03,0x00,0x04,0xff,0x01,0x00,0x01,0xff,0x0e,0x08,0x09,0xff,0x1b,0x0f,0x13,0xff,0x09,0x04,0x08,0xff,0x04,0x02,0x05,0xff,0x04,0x00,0x02,0xff,0x03,0x00,0x03,0xff,0x03,0x00,0x03,0xff,0x03,0x00,0x03,0xff,0x03,0x01,0x01,0xff,0x03,0x01,0x01,0xff,0x04,0x02,0x02,0xff,0x05,0x03,0x03,0xff,0x0b,0x08,0x09,0xff,0x14,0x0f,0x10,0xff,0x16,0x11,0x12,0xff,0x0b,0x06,0x07,0xff,0x0d,0x08,0x09,0xff,0x04,0x01,0x03,0xff,0x04,0x01,0x04,0xff,0x07,0x04,0x06,0xff,0x09,0x06,0x06,0xff,0x05,0x02,0x04,0xff,0x04,0x01,0x03,0xff,0x06,0x02,0x03,0xff,0x07,0x01,0x02,0xff,0x00,0x00,0x00,0xff,0x15,0x14,0x14,0xff,0x8e,0x8e,0x8e,0xff,0xf8,0xf8,0xf8,0x9e,0xff,0xff,0xff,0x0d,0xff,0xfe,0xfe,0x00,0xfe,0xf1,0xf6,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xf0,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xf6,0xf6,0xf6,0x26,0x98,0x96,0x96,0xc0,0x2b,0x25,0x26,0xff,0x0e,0x05,0x07,0xff,0x1f,0x15,0x16,0xff,0x23,0x1b,0x18,0xff,0x21,0x18,0x16,0xff,0x24,0x1b,0x19,0xff,0x22,0x19,0x17,0xff,0x21,0x18,0x17,0xff,0x1e,0x16,0x17,0xff,0x28,0x22,0x23,0xff,0x1c,0x14,0x15,0xff,0x1f,0x15,0x16,0xff,0x15,0x0b,0x0e,0xff,0x09,0x05,0x08,0xff,0x01,0x00,0x06,0xff,0x79,0x6d,0x65,0xff,0xb8,0xa8,0x99,0xff,0x84,0x75,0x69,0xff,0x8e,0x81,0x74,0xff,0x8b,0x7e,0x73,0xff,0xcf,0xc4,0xba,0xff,0xdf,0xda,0xd0,0xff,0xd8,0xd2,0xca,0xff,0xd0,0xcb,0xc5,0xff,0xdc,0xd7,0xd1,0xff,0xbf,0xb8,0xb2,0xff,0xc9,0xc3,0xb9,0xff,0xcc,0xc9,0xc4,0xff,0x8e,0xa6,0xc4,0xff,0x84,0xa2,0xc6,0xff,0x7a,0x9b,0xbc,0xff,0x73,0x93,0xb4,0xff,0x6a,0x88,0xa9,0xff,0x67,0x80,0xa4,0xff,0x60,0x78,0x9c,0xff,0x5b,0x71,0x92,0xff,0x56,0x6b,0x8b,0xff,0x4f,0x64,0x84,0xff,0x4b,0x58,0x70,0xff,0x18,0x1b,0x20,0xff,0x07,0x04,0x05,0xff,0x15,0x0a,0x0e,0xff,0x19,0x0e,0x0f,0xff,0x14,0x0a,0x0a,0xff,0x12,0x07,0x07,0xff,0x1c,0x0c,0x11,0xff,0x2d,0x19,0x1a,0xff,0x2f,0x1d,0x1d,0xff,0x2b,0x18,0x19,0xff,0x16,0x0a,0x0b,0xff,0x07,0x03,0x04,0xff,0x04,0x01,0x04,0xff,0x03,0x01,0x03,0xff,0x07,0x04,0x05,0xff,0x14,0x0d,0x0e,0xff,0x07,0x03,0x05,0xff,0x00,0x00,0x02,0xff,0x02,0x01,0x02,0xff,0x07,0x02,0x03,0xff,0x04,0x01,0x03,0xff,0x03,0x00,0x03,0xff,0x02,0x00,0x03,0xff,0x02,0x01,0x02,0xff,0x02,0x01,0x01,0xff,0x03,0x02,0x02,0xff,0x06,0x03,0x03,0xff,0x0b,0x07,0x08,0xff,0x11,0x0c,0x0d,0xff,0x15,0x10,0x10,0xff,0x0c,0x07,0x08,0xff,0x08,0x03,0x04,0xff,0x04,0x01,0x04,0xff,0x03,0x00,0x04,0xff,0x03,0x01,0x03,0xff,0x07,0x05,0x05,0xff,0x04,0x02,0x04,0xff,0x04,0x01,0x03,0xff,0x02,0x00,0x00,0xff,0x0c,0x04,0x05,0xff,0x55,0x4d,0x4e,0xff,0xca,0xc8,0xc8,0xec,0xff,0xff,0xff,0x5b,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xed,0xf4,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xed,0xf4,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x05,0xd5,0xd3,0xd4,0x77,0x5e,0x59,0x5a,0xf4,0x1b,0x11,0x11,0xff,0x19,0x0f,0x0d,0xff,0x25,0x1b,0x19,0xff,0x22,0x17,0x15,0xff,0x27,0x1d,0x1c,0xff,0x26,0x1c,0x1d,0xff,0x20,0x17,0x18,0xff,0x2e,0x25,0x26,0xff,0x27,0x1e,0x1e,0xff,0x1c,0x12,0x14,0xff,0x0f,0x07,0x0a,0xff,0x04,0x00,0x02,0xff,0x11,0x0e,0x11,0xff,0xa4,0x97,0x8a,0xff,0x8f,0x81,0x71,0xff,0x7c,0x6c,0x61,0xff,0x8c,0x7d,0x72,0xff,0x98,0x8b,0x82,0xff,0xdc,0xd2,0xca,0xff,0xd9,0xd2,0xc9,0xff,0xd3,0xcd,0xc5,0xff,0xd2,0xcd,0xc7,0xff,0xd7,0xd4,0xcd,0xff,0xd7,0xd2,0xcc,0xff,0xe4,0xdd,0xd5,0xff,0xd1,0xd2,0xd3,0xff,0x84,0x9e,0xc2,0xff,0x84,0xa0,0xc2,0xff,0x78,0x97,0xb8,0xff,0x72,0x90,0xb2,0xff,0x6e,0x89,0xab,0xff,0x6a,0x83,0xa6,0xff,0x60,0x78,0x9b,0xff,0x5c,0x72,0x93,0xff,0x54,0x69,0x88,0xff,0x53,0x67,0x87,0xff,0x48,0x51,0x64,0xff,0x13,0x13,0x15,0xff,0x07,0x03,0x05,0xff,0x17,0x0b,0x0f,0xff,0x18,0x0d,0x0e,0xff,0x17,0x0c,0x0c,0xff,0x1d,0x0f,0x10,0xff,0x27,0x17,0x1a,0xff,0x23,0x13,0x15,0xff,0x14,0x0b,0x0d,0xff,0x0b,0x03,0x04,0xff,0x01,0x00,0x00,0xff,0x00,0x01,0x01,0xff,0x01,0x00,0x02,0xff,0x04,0x01,0x02,0xff,0x0f,0x06,0x07,0xff,0x0f,0x06,0x07,0xff,0x0d,0x07,0x08,0xff,0x13,0x0a,0x0b,0xff,0x13,0x0a,0x0c,0xff,0x09,0x03,0x07,0xff,0x05,0x02,0x03,0xff,0x03,0x02,0x02,0xff,0x01,0x00,0x03,0xff,0x01,0x00,0x03,0xff,0x02,0x01,0x04,0xff,0x02,0x01,0x04,0xff,0x04,0x02,0x03,0xff,0x08,0x04,0x05,0xff,0x09,0x04,0x05,0xff,0x10,0x0b,0x0b,0xff,0x0c,0x07,0x07,0xff,0x09,0x05,0x05,0xff,0x05,0x02,0x04,0xff,0x03,0x01,0x04,0xff,0x01,0x00,0x02,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x16,0x14,0x14,0xff,0x88,0x85,0x85,0xff,0xf2,0xf1,0xf1,0xb3,0xff,0xff,0xff,0x21,0xff,0xff,0xff,0x00,0xfe,0xf6,0xf9,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xf9,0xf8,0xf8,0x2b,0xa6,0xa3,0xa3,0xbb,0x3f,0x39,0x38,0xff,0x1a,0x11,0x11,0xff,0x13,0x0a,0x0a,0xff,0x17,0x0f,0x0f,0xff,0x1e,0x15,0x16,0xff,0x19,0x10,0x10,0xff,0x2a,0x21,0x1f,0xff,0x29,0x20,0x20,0xff,0x1c,0x15,0x16,0xff,0x11,0x0a,0x0d,0xff,0x04,0x00,0x02,0xff,0x27,0x21,0x1f,0xff,0x9c,0x90,0x88,0xff,0x84,0x78,0x6d,0xff,0x82,0x72,0x67,0xff,0x7b,0x70,0x62,0xff,0xbc,0xb3,0xa8,0xff,0xd9,0xd3,0xc9,0xff,0xd3,0xcd,0xc5,0xff,0xd3,0xcc,0xc5,0xff,0xd5,0xcf,0xc8,0xff,0xda,0xd2,0xcd,0xff,0xd5,0xcf,0xc9,0xff,0xe7,0xe2,0xdb,0xff,0xcf,0xd0,0xd3,0xff,0x83,0xa0,0xc2,0xff,0x7f,0x9c,0xc1,0xff,0x73,0x92,0xb4,0xff,0x70,0x8d,0xaf,0xff,0x6c,0x89,0xab,0xff,0x68,0x82,0xa3,0xff,0x61,0x79,0x9a,0xff,0x5c,0x72,0x92,0xff,0x54,0x69,0x88,0xff,0x53,0x68,0x86,0xff,0x3e,0x48,0x57,0xff,0x0d,0x0c,0x0d,0xff,0x0f,0x06,0x07,0xff,0x1b,0x10,0x11,0xff,0x19,0x0d,0x0f,0xff,0x11,0x09,0x0a,0xff,0x09,0x04,0x04,0xff,0x0a,0x04,0x06,0xff,0x09,0x03,0x06,0xff,0x08,0x04,0x05,0xff,0x0b,0x05,0x05,0xff,0x0e,0x07,0x08,0xff,0x13,0x0b,0x0b,0xff,0x16,0x0c,0x0e,0xff,0x19,0x0e,0x10,0xff,0x1f,0x12,0x14,0xff,0x20,0x12,0x14,0xff,0x1c,0x10,0x12,0xff,0x14,0x0a,0x0d,0xff,0x0b,0x05,0x08,0xff,0x05,0x02,0x03,0xff,0x05,0x02,0x04,0xff,0x04,0x02,0x04,0xff,0x01,0x00,0x03,0xff,0x01,0x00,0x03,0xff,0x03,0x02,0x05,0xff,0x08,0x07,0x0a,0xff,0x02,0x02,0x03,0xff,0x05,0x05,0x04,0xff,0x06,0x04,0x04,0xff,0x07,0x04,0x05,0xff,0x08,0x05,0x06,0xff,0x06,0x03,0x03,0xff,0x04,0x02,0x03,0xff,0x03,0x01,0x03,0xff,0x00,0x00,0x01,0xff,0x00,0x00,0x00,0xff,0x06,0x06,0x07,0xff,0x55,0x54,0x56,0xff,0xcc,0xcc,0xcc,0xe6,0xff,0xff,0xff,0x5f,0xff,0xff,0xff,0x00,0xff,0xfd,0xfd,0x00,0xfe,0xf0,0xf6,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfc,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xee,0xf5,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x02,0xe7,0xe7,0xe7,0x5f,0x88,0x85,0x85,0xe2,0x28,0x22,0x23,0xff,0x0f,0x09,0x08,0xff,0x1b,0x12,0x13,0xff,0x1e,0x15,0x14,0xff,0x2c,0x23,0x20,0xff,0x27,0x1e,0x1e,0xff,0x1e,0x16,0x16,0xff,0x16,0x0f,0x11,0xff,0x03,0x00,0x01,0xff,0x4b,0x42,0x3c,0xff,0x8d,0x7e,0x73,0xff,0x6a,0x5c,0x52,0xff,0x7c,0x6d,0x61,0xff,0x78,0x6f,0x61,0xff,0xd7,0xd0,0xc6,0xff,0xd4,0xcd,0xc4,0xff,0xd5,0xcf,0xc8,0xff,0xd0,0xc9,0xc3,0xff,0xd6,0xcf,0xc9,0xff,0xd3,0xcd,0xc7,0xff,0xd2,0xcc,0xc6,0xff,0xec,0xe7,0xdf,0xff,0xd0,0xd2,0xd5,0xff,0x80,0x9d,0xbe,0xff,0x7b,0x98,0xbe,0xff,0x71,0x8f,0xb3,0xff,0x6d,0x8b,0xad,0xff,0x69,0x86,0xa8,0xff,0x67,0x81,0xa1,0xff,0x62,0x7a,0x9a,0xff,0x5d,0x71,0x92,0xff,0x55,0x69,0x89,0xff,0x51,0x65,0x81,0xff,0x32,0x3c,0x45,0xff,0x0e,0x0b,0x0d,0xff,0x16,0x0c,0x0e,0xff,0x1a,0x11,0x10,0xff,0x16,0x0b,0x0c,0xff,0x14,0x0a,0x0b,0xff,0x1c,0x10,0x11,0xff,0x1f,0x11,0x11,0xff,0x1f,0x13,0x12,0xff,0x20,0x13,0x13,0xff,0x22,0x12,0x15,0xff,0x21,0x10,0x13,0xff,0x1c,0x0e,0x10,0xff,0x15,0x0b,0x0d,0xff,0x13,0x07,0x09,0xff,0x12,0x08,0x0b,0xff,0x0b,0x06,0x08,0xff,0x09,0x03,0x04,0xff,0x08,0x02,0x04,0xff,0x0b,0x06,0x08,0xff,0x07,0x04,0x04,0xff,0x04,0x02,0x04,0xff,0x05,0x02,0x05,0xff,0x03,0x01,0x04,0xff,0x02,0x01,0x04,0xff,0x03,0x02,0x05,0xff,0x0a,0x09,0x0c,0xff,0x02,0x03,0x04,0xff,0x02,0x02,0x03,0xff,0x04,0x04,0x05,0xff,0x03,0x01,0x02,0xff,0x05,0x03,0x03,0xff,0x03,0x02,0x02,0xff,0x02,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x34,0x34,0x35,0xff,0xa9,0xaa,0xaa,0xfb,0xfb,0xfb,0xfb,0x98,0xff,0xff,0xff,0x17,0xff,0xff,0xff,0x00,0xff,0xf7,0xfa,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfc,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x12,0xda,0xd8,0xd8,0x85,0x7c,0x78,0x77,0xf1,0x38,0x30,0x2e,0xff,0x1d,0x13,0x13,0xff,0x20,0x17,0x16,0xff,0x25,0x1d,0x1c,0xff,0x22,0x19,0x18,0xff,0x1a,0x12,0x13,0xff,0x09,0x02,0x05,0xff,0x54,0x4a,0x45,0xff,0x72,0x64,0x58,0xff,0x6a,0x5b,0x50,0xff,0x6f,0x63,0x57,0xff,0x9b,0x92,0x86,0xff,0xd7,0xce,0xc6,0xff,0xd6,0xcd,0xc5,0xff,0xd1,0xca,0xc5,0xff,0xc4,0xbf,0xbc,0xff,0xd1,0xca,0xc5,0xff,0xcf,0xc9,0xc3,0xff,0xc9,0xc5,0xbe,0xff,0xf2,0xeb,0xe3,0xff,0xca,0xcc,0xd0,0xff,0x77,0x96,0xb9,0xff,0x76,0x91,0xb8,0xff,0x6d,0x8a,0xad,0xff,0x69,0x86,0xa8,0xff,0x68,0x83,0xa5,0xff,0x63,0x7b,0x9c,0xff,0x5f,0x75,0x94,0xff,0x59,0x6f,0x8d,0xff,0x55,0x69,0x89,0xff,0x52,0x63,0x7f,0xff,0x33,0x37,0x40,0xff,0x12,0x0e,0x0f,0xff,0x11,0x07,0x09,0xff,0x14,0x0b,0x0a,0xff,0x14,0x0a,0x09,0xff,0x0f,0x07,0x06,0xff,0x0f,0x08,0x08,0xff,0x0f,0x08,0x07,0xff,0x0e,0x06,0x06,0xff,0x0c,0x04,0x04,0xff,0x0b,0x02,0x04,0xff,0x09,0x02,0x04,0xff,0x06,0x01,0x02,0xff,0x06,0x02,0x03,0xff,0x0e,0x05,0x07,0xff,0x0d,0x03,0x07,0xff,0x0a,0x02,0x06,0xff,0x12,0x08,0x09,0xff,0x18,0x0e,0x0f,0xff,0x15,0x0e,0x0f,0xff,0x06,0x02,0x03,0xff,0x05,0x02,0x05,0xff,0x05,0x02,0x05,0xff,0x04,0x01,0x04,0xff,0x02,0x01,0x04,0xff,0x03,0x02,0x05,0xff,0x08,0x07,0x09,0xff,0x07,0x06,0x08,0xff,0x04,0x03,0x05,0xff,0x03,0x03,0x05,0xff,0x01,0x01,0x02,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x2b,0x2b,0x2b,0xff,0x95,0x94,0x95,0xff,0xef,0xef,0xef,0xb7,0xff,0xff,0xff,0x34,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xee,0xf4,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xeb,0xf3,0x00,0xff,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x21,0xd6,0xd4,0xd4,0x99,0x75,0x70,0x70,0xf7,0x2e,0x29,0x28,0xff,0x1a,0x14,0x13,0xff,0x1c,0x15,0x13,0xff,0x17,0x0e,0x0f,0xff,0x0a,0x03,0x04,0xff,0x4f,0x46,0x3d,0xff,0x5f,0x52,0x45,0xff,0x75,0x66,0x5b,0xff,0x71,0x66,0x5a,0xff,0xbf,0xb6,0xac,0xff,0xcd,0xc4,0xbd,0xff,0xce,0xc8,0xc1,0xff,0xcd,0xc6,0xc1,0xff,0xd6,0xcf,0xca,0xff,0xd6,0xcf,0xca,0xff,0xcc,0xc5,0xc0,0xff,0xc7,0xc1,0xbb,0xff,0xeb,0xe6,0xde,0xff,0xc4,0xc7,0xcc,0xff,0x70,0x91,0xb3,0xff,0x6e,0x8d,0xb2,0xff,0x6a,0x86,0xa9,0xff,0x68,0x83,0xa5,0xff,0x64,0x81,0xa1,0xff,0x60,0x79,0x97,0xff,0x5c,0x73,0x91,0xff,0x57,0x6d,0x8c,0xff,0x55,0x68,0x89,0xff,0x50,0x62,0x7b,0xff,0x30,0x35,0x3c,0xff,0x13,0x0e,0x0d,0xff,0x18,0x0d,0x0d,0xff,0x15,0x0b,0x0b,0xff,0x14,0x0b,0x0a,0xff,0x10,0x07,0x07,0xff,0x0e,0x07,0x07,0xff,0x16,0x0d,0x0d,0xff,0x1d,0x12,0x11,0xff,0x20,0x14,0x10,0xff,0x1c,0x11,0x0e,0xff,0x1c,0x11,0x10,0xff,0x1a,0x0f,0x10,0xff,0x13,0x07,0x09,0xff,0x17,0x0d,0x0d,0xff,0x19,0x0d,0x0d,0xff,0x1b,0x0f,0x0f,0xff,0x22,0x13,0x13,0xff,0x21,0x13,0x14,0xff,0x13,0x0b,0x0c,0xff,0x06,0x02,0x02,0xff,0x07,0x03,0x05,0xff,0x06,0x03,0x05,0xff,0x05,0x02,0x04,0xff,0x01,0x01,0x01,0xff,0x08,0x09,0x08,0xff,0x1a,0x19,0x19,0xff,0x28,0x26,0x28,0xff,0x28,0x25,0x27,0xff,0x04,0x03,0x05,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x2a,0x29,0x2b,0xff,0x8c,0x8c,0x8c,0xff,0xe9,0xe9,0xe9,0xc7,0xff,0xff,0xff,0x4a,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf2,0xf7,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xed,0xf4,0x00,0xff,0xf9,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x27,0xd4,0xd4,0xd4,0x98,0x7f,0x7c,0x7b,0xf2,0x36,0x30,0x2f,0xff,0x0a,0x05,0x05,0xff,0x03,0x01,0x00,0xff,0x48,0x3e,0x34,0xff,0x63,0x56,0x4a,0xff,0x73,0x65,0x5b,0xff,0x77,0x6b,0x61,0xff,0xc9,0xbe,0xb5,0xff,0xd0,0xc7,0xc0,0xff,0xcb,0xc6,0xc0,0xff,0xd0,0xca,0xc4,0xff,0xb7,0xb0,0xa9,0xff,0xba,0xb3,0xad,0xff,0xca,0xc2,0xbd,0xff,0xca,0xc3,0xbe,0xff,0xe9,0xe5,0xdc,0xff,0xb9,0xbf,0xc5,0xff,0x6e,0x8e,0xb2,0xff,0x6b,0x8a,0xb0,0xff,0x67,0x83,0xa6,0xff,0x67,0x82,0xa3,0xff,0x64,0x7d,0x9e,0xff,0x61,0x79,0x98,0xff,0x5e,0x75,0x93,0xff,0x58,0x6d,0x8c,0xff,0x53,0x67,0x87,0xff,0x4b,0x5f,0x77,0xff,0x2c,0x32,0x3a,0xff,0x12,0x0e,0x0c,0xff,0x1b,0x10,0x10,0xff,0x16,0x0d,0x0d,0xff,0x12,0x0c,0x0b,0xff,0x0e,0x09,0x08,0xff,0x1f,0x12,0x11,0xff,0x31,0x1d,0x1b,0xff,0x31,0x1e,0x1b,0xff,0x31,0x1d,0x1b,0xff,0x33,0x1f,0x1c,0xff,0x30,0x1e,0x1a,0xff,0x26,0x17,0x15,0xff,0x1d,0x10,0x10,0xff,0x23,0x17,0x15,0xff,0x24,0x17,0x16,0xff,0x24,0x19,0x17,0xff,0x23,0x16,0x16,0xff,0x23,0x15,0x16,0xff,0x10,0x07,0x09,0xff,0x06,0x02,0x02,0xff,0x07,0x04,0x06,0xff,0x09,0x04,0x07,0xff,0x06,0x02,0x04,0xff,0x03,0x02,0x02,0xff,0x09,0x07,0x0a,0xff,0x07,0x05,0x07,0xff,0x0b,0x09,0x0c,0xff,0x08,0x06,0x0a,0xff,0x09,0x07,0x0b,0xff,0x3f,0x3e,0x41,0xff,0x99,0x99,0x9a,0xff,0xea,0xea,0xeb,0xc2,0xff,0xff,0xff,0x4e,0xff,0xff,0xff,0x03,0xff,0xfe,0xff,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xe9,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xef,0xf5,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x1e,0xe1,0xe1,0xe0,0x7f,0x90,0x8e,0x8f,0xe0,0x43,0x3e,0x3e,0xff,0x46,0x3b,0x34,0xff,0x64,0x57,0x4e,0xff,0x5f,0x52,0x49,0xff,0x9b,0x8d,0x84,0xff,0xca,0xbe,0xb5,0xff,0xcd,0xc4,0xbd,0xff,0xcb,0xc5,0xbe,0xff,0xc9,0xc4,0xbc,0xff,0x9d,0x98,0x8f,0xff,0xae,0xa8,0xa0,0xff,0xc7,0xc0,0xba,0xff,0xce,0xc9,0xc3,0xff,0xe4,0xdf,0xd6,0xff,0xb3,0xba,0xc3,0xff,0x6d,0x8d,0xb1,0xff,0x68,0x84,0xaa,0xff,0x67,0x82,0xa4,0xff,0x64,0x7e,0x9e,0xff,0x63,0x79,0x9a,0xff,0x5e,0x76,0x95,0xff,0x5c,0x74,0x91,0xff,0x56,0x6d,0x88,0xff,0x53,0x68,0x85,0xff,0x4d,0x60,0x79,0xff,0x32,0x39,0x40,0xff,0x11,0x0e,0x0e,0xff,0x14,0x0a,0x0c,0xff,0x13,0x09,0x0b,0xff,0x0f,0x09,0x08,0xff,0x0d,0x08,0x07,0xff,0x1d,0x11,0x10,0xff,0x1b,0x0d,0x0b,0xff,0x13,0x07,0x07,0xff,0x17,0x0b,0x0c,0xff,0x22,0x15,0x13,0xff,0x31,0x21,0x1b,0xff,0x33,0x23,0x1f,0xff,0x27,0x18,0x18,0xff,0x23,0x16,0x13,0xff,0x1e,0x11,0x0f,0xff,0x1e,0x11,0x0f,0xff,0x1d,0x12,0x12,0xff,0x17,0x0a,0x0b,0xff,0x0f,0x07,0x09,0xff,0x06,0x02,0x03,0xff,0x07,0x04,0x06,0xff,0x0a,0x06,0x09,0xff,0x08,0x03,0x06,0xff,0x02,0x00,0x00,0xff,0x00,0x00,0x02,0xff,0x03,0x02,0x08,0xff,0x1a,0x1a,0x1f,0xff,0x59,0x57,0x5b,0xff,0xb3,0xb2,0xb4,0xf5,0xf5,0xf5,0xf5,0xa8,0xff,0xff,0xff,0x3e,0xff,0xff,0xff,0x01,0xff,0xfe,0xff,0x00,0xfe,0xf6,0xf9,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xee,0xf4,0x00,0xff,0xf7,0xfa,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x0e,0xf4,0xf4,0xf3,0x5a,0xcf,0xcd,0xcb,0xba,0xb0,0xaa,0xa6,0xf9,0x73,0x6b,0x63,0xff,0xb7,0xac,0xa2,0xff,0xc9,0xbd,0xb3,0xff,0xc6,0xbd,0xb5,0xff,0xd0,0xc9,0xc1,0xff,0xcb,0xc4,0xbd,0xff,0xd2,0xcb,0xc4,0xff,0xcf,0xca,0xc1,0xff,0xbb,0xb4,0xac,0xff,0xce,0xc8,0xc1,0xff,0xdf,0xd9,0xd1,0xff,0xb1,0xbb,0xc1,0xff,0x68,0x88,0xaa,0xff,0x64,0x80,0xa2,0xff,0x62,0x7c,0x9d,0xff,0x60,0x7a,0x9a,0xff,0x5e,0x78,0x99,0xff,0x5f,0x76,0x94,0xff,0x5e,0x74,0x90,0xff,0x5b,0x70,0x8b,0xff,0x58,0x6b,0x86,0xff,0x4c,0x5d,0x74,0xff,0x32,0x37,0x3f,0xff,0x11,0x0e,0x0e,0xff,0x16,0x0e,0x0f,0xff,0x11,0x0b,0x0b,0xff,0x16,0x0d,0x0d,0xff,0x0b,0x07,0x05,0xff,0x12,0x0a,0x09,0xff,0x0d,0x05,0x04,0xff,0x16,0x0a,0x09,0xff,0x19,0x0d,0x0c,0xff,0x23,0x14,0x12,0xff,0x31,0x21,0x1c,0xff,0x34,0x22,0x21,0xff,0x1b,0x0d,0x0e,0xff,0x1a,0x0e,0x0c,0xff,0x26,0x18,0x15,0xff,0x2c,0x1b,0x19,0xff,0x25,0x16,0x16,0xff,0x15,0x0b,0x0b,0xff,0x07,0x01,0x02,0xff,0x02,0x01,0x01,0xff,0x04,0x00,0x02,0xff,0x02,0x00,0x00,0xff,0x01,0x00,0x01,0xff,0x11,0x0e,0x0f,0xff,0x45,0x42,0x44,0xff,0x97,0x96,0x9a,0xff,0xd9,0xd9,0xda,0xd9,0xfd,0xfd,0xfd,0x7f,0xff,0xff,0xff,0x25,0xff,0xff,0xff,0x00,0xff,0xfc,0xfe,0x00,0xfe,0xf3,0xf7,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xeb,0xf3,0x00,0xfe,0xf5,0xf8,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x29,0xf3,0xf3,0xf2,0x7b,0xec,0xe9,0xe6,0xcc,0xdd,0xd7,0xd2,0xfb,0xd2,0xcb,0xc5,0xff,0xca,0xc4,0xbe,0xff,0xc9,0xc2,0xbc,0xff,0xcd,0xc6,0xc0,0xff,0xbb,0xb4,0xad,0xff,0xba,0xb3,0xac,0xff,0xd7,0xd0,0xca,0xff,0xe0,0xdb,0xd2,0xff,0xa8,0xb4,0xbd,0xff,0x62,0x81,0xa3,0xff,0x63,0x7d,0x9d,0xff,0x62,0x79,0x98,0xff,0x60,0x78,0x96,0xff,0x60,0x77,0x98,0xff,0x5f,0x75,0x93,0xff,0x5b,0x72,0x8d,0xff,0x58,0x6c,0x87,0xff,0x55,0x68,0x81,0xff,0x4f,0x5d,0x74,0xff,0x3a,0x3f,0x47,0xff,0x14,0x11,0x11,0xff,0x13,0x0c,0x0d,0xff,0x10,0x0a,0x0b,0xff,0x1b,0x11,0x12,0xff,0x0a,0x04,0x05,0xff,0x0b,0x05,0x05,0xff,0x14,0x0c,0x0b,0xff,0x1e,0x11,0x11,0xff,0x20,0x13,0x13,0xff,0x24,0x14,0x14,0xff,0x21,0x14,0x12,0xff,0x18,0x0e,0x0c,0xff,0x0c,0x04,0x04,0xff,0x1b,0x0f,0x0e,0xff,0x30,0x1f,0x1e,0xff,0x27,0x17,0x16,0xff,0x18,0x0b,0x0c,0xff,0x14,0x09,0x0b,0xff,0x06,0x01,0x02,0xff,0x01,0x01,0x00,0xff,0x1a,0x17,0x18,0xff,0x4c,0x47,0x4a,0xff,0x88,0x87,0x88,0xff,0xcb,0xca,0xca,0xe3,0xf9,0xf9,0xf9,0x9c,0xff,0xff,0xff,0x46,0xff,0xff,0xff,0x08,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf1,0xf6,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe9,0xf0,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf8,0xfb,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x2e,0xfc,0xfb,0xfb,0x78,0xef,0xed,0xed,0xbe,0xe6,0xe3,0xe1,0xf1,0xe2,0xdd,0xd9,0xff,0xb4,0xae,0xa9,0xff,0xb6,0xaf,0xaa,0xff,0xd6,0xd0,0xcb,0xff,0xea,0xe5,0xdc,0xff,0xa0,0xad,0xbb,0xff,0x5e,0x7b,0xa0,0xff,0x5f,0x78,0x97,0xff,0x60,0x75,0x93,0xff,0x5f,0x76,0x91,0xff,0x5e,0x75,0x8f,0xff,0x5a,0x71,0x8d,0xff,0x5a,0x70,0x8c,0xff,0x55,0x69,0x81,0xff,0x51,0x62,0x7a,0xff,0x4e,0x5c,0x70,0xff,0x3a,0x3f,0x49,0xff,0x14,0x12,0x13,0xff,0x13,0x0b,0x0c,0xff,0x12,0x0a,0x0a,0xff,0x17,0x0d,0x0e,0xff,0x0b,0x04,0x05,0xff,0x0e,0x08,0x09,0xff,0x17,0x0d,0x0d,0xff,0x1b,0x0f,0x0f,0xff,0x20,0x12,0x12,0xff,0x1f,0x12,0x11,0xff,0x17,0x0b,0x0c,0xff,0x09,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x07,0x02,0x02,0xff,0x12,0x03,0x04,0xff,0x14,0x06,0x06,0xff,0x22,0x19,0x1a,0xff,0x45,0x3d,0x3f,0xff,0x76,0x6f,0x71,0xff,0xa7,0xa5,0xa6,0xfa,0xd6,0xd6,0xd6,0xd6,0xfb,0xfb,0xfb,0x94,0xff,0xff,0xff,0x49,0xff,0xff,0xff,0x0e,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xec,0xf3,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfa,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xea,0xf2,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x1a,0xff,0xff,0xff,0x51,0xf6,0xf5,0xf5,0x8e,0xf0,0xee,0xed,0xc3,0xed,0xeb,0xe9,0xee,0xf5,0xf1,0xed,0xff,0xb8,0xc3,0xcd,0xff,0x79,0x93,0xaf,0xff,0x68,0x80,0x9c,0xff,0x65,0x7a,0x96,0xff,0x5c,0x73,0x8f,0xff,0x58,0x70,0x8a,0xff,0x58,0x6d,0x8b,0xff,0x52,0x66,0x82,0xff,0x55,0x67,0x7d,0xff,0x4c,0x5d,0x74,0xff,0x48,0x57,0x6c,0xff,0x32,0x3b,0x47,0xff,0x0f,0x12,0x12,0xff,0x0a,0x02,0x03,0xff,0x09,0x02,0x02,0xff,0x0a,0x03,0x01,0xff,0x02,0x01,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x0d,0x03,0x03,0xff,0x14,0x08,0x07,0xff,0x16,0x0b,0x0a,0xff,0x1d,0x13,0x15,0xff,0x21,0x1b,0x1c,0xff,0x32,0x31,0x31,0xff,0x5d,0x59,0x5a,0xff,0x86,0x7f,0x80,0xff,0xb2,0xad,0xad,0xf9,0xd6,0xd4,0xd4,0xd3,0xf5,0xf5,0xf5,0xa6,0xff,0xff,0xff,0x66,0xff,0xff,0xff,0x2e,0xff,0xff,0xff,0x05,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xee,0xf5,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe4,0xee,0x00,0xfd,0xe5,0xee,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xed,0xf4,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xf9,0xfc,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x16,0xff,0xff,0xff,0x38,0xfe,0xfe,0xfe,0x6a,0xf3,0xf6,0xf8,0x8b,0xe3,0xe7,0xed,0xbc,0xd7,0xdd,0xe5,0xd7,0xc7,0xcf,0xd8,0xe6,0xb5,0xbf,0xcb,0xfc,0xa9,0xb4,0xc3,0xff,0x9a,0xa5,0xb5,0xff,0x90,0x9c,0xab,0xff,0x82,0x8f,0x9e,0xff,0x76,0x82,0x93,0xff,0x6a,0x72,0x7b,0xff,0x4b,0x4d,0x4d,0xff,0x42,0x3b,0x3c,0xff,0x48,0x40,0x41,0xff,0x4f,0x4a,0x4a,0xff,0x53,0x50,0x50,0xff,0x5d,0x5a,0x5a,0xff,0x6c,0x6b,0x6b,0xff,0x84,0x81,0x81,0xff,0x9c,0x98,0x98,0xff,0xb6,0xb3,0xb3,0xef,0xc9,0xc7,0xc8,0xdb,0xde,0xdd,0xdd,0xcb,0xf4,0xf4,0xf4,0x9c,0xff,0xff,0xff,0x78,0xff,0xff,0xff,0x4b,0xff,0xff,0xff,0x21,0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xf8,0xfa,0x00,0xfd,0xf1,0xf6,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe4,0xee,0x00,0xfd,0xe4,0xee,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfd,0x00,0xff,0xfd,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xfc,0xfd,0x00,0xfe,0xfc,0xfd,0x00,0xfe,0xfc,0xfd,0x00,0xfe,0xfb,0xfd,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf8,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xf6,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf5,0xf9,0x00,0xff,0xf9,0xfc,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x14,0xff,0xff,0xff,0x30,0xff,0xff,0xff,0x3e,0xff,0xff,0xff,0x4a,0xff,0xff,0xff,0x5e,0xff,0xff,0xff,0x73,0xff,0xff,0xff,0x87,0xff,0xff,0xff,0x96,0xfe,0xfe,0xfe,0x99,0xfe,0xfe,0xfe,0x98,0xff,0xff,0xff,0x98,0xff,0xff,0xff,0x8e,0xff,0xff,0xff,0x7b,0xff,0xff,0xff,0x66,0xff,0xff,0xff,0x51,0xff,0xff,0xff,0x42,0xff,0xff,0xff,0x38,0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0x07,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfb,0xfd,0x00,0xff,0xf8,0xfb,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xfa,0x00,0xff,0xf6,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfb,0xfc,0x00,0xfe,0xfb,0xfd,0x00,0xfe,0xfc,0xfd,0x00,0xfe,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+
+};
+
+const lv_image_dsc_t img_lv_demo_music_cover_2 = {
+    .header.w = 176,
+    .header.h = 175,
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .data = img_lv_demo_music_cover_2_map,
+    .data_size = sizeof(img_lv_demo_music_cover_2_map),
+};
+
+#endif /*LV_USE_DEMO_MUSIC*/
@@ -0,0 +1,196 @@
+#include "../lv_demo_music.h"
+#if LV_USE_DEMO_MUSIC  && !LV_DEMO_MUSIC_LARGE
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t img_lv_demo_music_cover_3_map[] = {
+  /*Pixel format: Fix 0xFF: 8 bit, Red: 8 bit, Green: 8 bit, Blue: 8 bit*/
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xf9,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf8,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfd,0xf1,0xf6,0x00,0xfd,0xf1,0xf6,0x00,0xfd,0xf0,0xf6,0x00,0xfd,0xf0,0xf5,0x00,0xfd,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xed,0xf3,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf6,0xfa,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x0a,0xff,0xff,0xff,0x1c,0xff,0xff,0xff,0x1d,0xf6,0xfc,0xff,0x52,0xe8,0xf7,0xff,0x77,0xdd,0xf3,0xff,0x73,0xd3,0xef,0xff,0x74,0xcc,0xed,0xff,0x81,0xc5,0xeb,0xff,0xa1,0xc1,0xe8,0xff,0xcb,0xbf,0xe6,0xff,0xd1,0xbe,0xe4,0xff,0xd0,0xbf,0xe3,0xfe,0xd1,0xc3,0xe3,0xfe,0xb3,0xc8,0xe3,0xfd,0x8a,0xd0,0xe5,0xfd,0x77,0xd9,0xea,0xfd,0x73,0xe4,0xf0,0xfe,0x75,0xf0,0xf8,0xff,0x6a,0xfd,0xfe,0xff,0x29,0xff,0xff,0xff,0x1c,0xff,0xff,0xff,0x14,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xf8,0xfb,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xee,0xf4,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xf0,0xf5,0x00,0xfd,0xf0,0xf5,0x00,0xfd,0xf0,0xf6,0x00,0xfd,0xf0,0xf6,0x00,0xfd,0xf1,0xf6,0x00,0xfd,0xf2,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfa,0x00,0xfe,0xf8,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe5,0xee,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe9,0xf1,0x00,0xfe,0xee,0xf4,0x00,0xff,0xf5,0xf9,0x00,0xff,0xfb,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x34,0xec,0xf8,0xff,0x53,0xd3,0xee,0xff,0x93,0xb3,0xe3,0xff,0xb2,0x8e,0xd6,0xff,0xd4,0x72,0xcd,0xfe,0xfb,0x57,0xc5,0xff,0xf9,0x3e,0xbd,0xff,0xff,0x33,0xb9,0xff,0xff,0x29,0xb7,0xff,0xff,0x22,0xb4,0xff,0xff,0x1c,0xb1,0xff,0xff,0x16,0xae,0xff,0xff,0x12,0xaa,0xff,0xff,0x11,0xa7,0xff,0xff,0x10,0xa2,0xfe,0xff,0x10,0x9d,0xfd,0xff,0x13,0x9a,0xfc,0xff,0x17,0x90,0xfa,0xff,0x1e,0x83,0xf5,0xff,0x25,0x87,0xf4,0xff,0x30,0x93,0xfa,0xff,0x39,0x9f,0xfc,0xff,0x4e,0xae,0xfe,0xfb,0x68,0xbd,0xfe,0xfa,0x83,0xca,0xff,0xea,0xa3,0xd8,0xfe,0xb6,0xc8,0xe7,0xff,0xab,0xe2,0xf2,0xff,0x63,0xfa,0xfd,0xff,0x46,0xff,0xff,0xff,0x10,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfd,0x00,0xff,0xf8,0xfa,0x00,0xfe,0xf1,0xf6,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xea,0xf1,0x00,0xfe,0xf0,0xf6,0x00,0xff,0xf8,0xfa,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x09,0xfa,0xfe,0xff,0x30,0xdb,0xf2,0xff,0x78,0xb4,0xe4,0xfe,0xae,0x84,0xd4,0xfe,0xe6,0x5b,0xc6,0xfe,0xf8,0x34,0xb8,0xfe,0xff,0x1f,0xb1,0xfe,0xff,0x0f,0xaa,0xff,0xff,0x08,0xaa,0xff,0xff,0x08,0xab,0xfe,0xff,0x09,0xac,0xff,0xff,0x0b,0xad,0xff,0xff,0x0c,0xad,0xff,0xff,0x0c,0xb0,0xfe,0xff,0x0e,0xb0,0xff,0xff,0x10,0xb1,0xff,0xff,0x10,0xb0,0xff,0xff,0x10,0xae,0xff,0xff,0x10,0xac,0xff,0xff,0x10,0xaa,0xfe,0xff,0x11,0xa7,0xfe,0xff,0x0e,0xa3,0xfe,0xff,0x0e,0x99,0xfd,0xff,0x0e,0x84,0xf6,0xff,0x0d,0x85,0xf8,0xff,0x0a,0x89,0xfa,0xff,0x0a,0x8f,0xfb,0xff,0x07,0x97,0xfd,0xff,0x05,0x99,0xfd,0xff,0x07,0x9a,0xfd,0xff,0x0a,0x9b,0xfd,0xff,0x19,0x9f,0xfe,0xff,0x2c,0xa4,0xfd,0xff,0x4b,0xb0,0xfb,0xff,0x73,0xc3,0xfd,0xed,0xa1,0xd8,0xfe,0xc9,0xcd,0xec,0xff,0x8c,0xf0,0xfa,0xff,0x49,0xff,0xff,0xff,0x17,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xec,0xf3,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe6,0xf0,0x00,0xfe,0xed,0xf4,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x0d,0xf1,0xf8,0xff,0x4a,0xc3,0xe1,0xfd,0x9b,0x86,0xc7,0xfd,0xdc,0x50,0xb7,0xfe,0xff,0x25,0xaf,0xfe,0xff,0x11,0xad,0xfe,0xff,0x09,0xab,0xfd,0xff,0x08,0xab,0xff,0xff,0x0b,0xae,0xff,0xff,0x0e,0xaf,0xfe,0xff,0x10,0xaf,0xfe,0xff,0x11,0xb0,0xff,0xff,0x12,0xb0,0xff,0xff,0x13,0xb2,0xff,0xff,0x13,0xb3,0xff,0xff,0x12,0xb2,0xff,0xff,0x12,0xb4,0xfe,0xff,0x13,0xb4,0xff,0xff,0x14,0xb4,0xff,0xff,0x12,0xb3,0xff,0xff,0x12,0xb2,0xff,0xff,0x12,0xb1,0xff,0xff,0x12,0xae,0xff,0xff,0x13,0xab,0xff,0xff,0x12,0xa9,0xff,0xff,0x13,0xa5,0xfe,0xff,0x16,0x9e,0xfe,0xff,0x13,0x98,0xfa,0xff,0x11,0x98,0xf9,0xff,0x13,0x9e,0xfd,0xff,0x13,0xa4,0xfe,0xff,0x11,0xa5,0xff,0xff,0x12,0xa4,0xff,0xff,0x12,0xa1,0xff,0xff,0x0f,0x9e,0xfe,0xff,0x0c,0x9b,0xfe,0xff,0x08,0x98,0xfd,0xff,0x05,0x99,0xfd,0xff,0x0a,0x9f,0xfe,0xff,0x1c,0xac,0xfe,0xff,0x3c,0xbc,0xfe,0xff,0x70,0xce,0xff,0xec,0xae,0xe3,0xff,0xb9,0xe2,0xf5,0xff,0x68,0xff,0xff,0xff,0x20,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xf9,0xfc,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xe9,0xf1,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe9,0xf1,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x06,0xf2,0xf7,0xfe,0x45,0xbd,0xd8,0xfb,0x9e,0x7b,0xb6,0xf9,0xe6,0x3f,0x99,0xf9,0xff,0x15,0x8a,0xf8,0xff,0x08,0x8c,0xfb,0xff,0x0c,0x99,0xfd,0xff,0x0f,0xa7,0xff,0xff,0x10,0xb1,0xfe,0xff,0x12,0xb3,0xfe,0xff,0x12,0xb2,0xff,0xff,0x13,0xb3,0xff,0xff,0x13,0xb4,0xff,0xff,0x13,0xb3,0xfe,0xff,0x12,0xb3,0xff,0xff,0x12,0xb3,0xff,0xff,0x13,0xb4,0xff,0xff,0x13,0xb6,0xff,0xff,0x12,0xb7,0xfe,0xff,0x13,0xb8,0xff,0xff,0x13,0xb9,0xff,0xff,0x14,0xb9,0xff,0xff,0x14,0xb7,0xff,0xff,0x13,0xb5,0xff,0xff,0x13,0xb3,0xff,0xff,0x13,0xb1,0xff,0xff,0x13,0xae,0xff,0xff,0x13,0xab,0xff,0xff,0x11,0xa9,0xfe,0xff,0x12,0xa7,0xff,0xff,0x12,0xa3,0xff,0xff,0x12,0xa1,0xff,0xff,0x12,0xa3,0xfe,0xff,0x13,0xa5,0xfe,0xff,0x12,0xa5,0xfe,0xff,0x12,0xa3,0xff,0xff,0x12,0xa0,0xff,0xff,0x11,0xa1,0xfe,0xff,0x12,0xa0,0xff,0xff,0x11,0xa0,0xff,0xff,0x10,0xa1,0xff,0xff,0x10,0xa5,0xff,0xff,0x0e,0xaa,0xfe,0xff,0x0a,0xab,0xfd,0xff,0x07,0xac,0xfe,0xff,0x0f,0xad,0xfe,0xff,0x2b,0xb2,0xfe,0xff,0x5f,0xbd,0xfd,0xf7,0xa2,0xd0,0xfb,0xbd,0xe0,0xef,0xfe,0x66,0xff,0xff,0xff,0x18,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf4,0xf8,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe9,0xf2,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xfd,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xff,0xff,0x20,0xd5,0xe7,0xfc,0x7d,0x89,0xb9,0xf7,0xd6,0x40,0x90,0xf3,0xff,0x14,0x79,0xf3,0xff,0x07,0x78,0xf5,0xff,0x0c,0x7e,0xf9,0xff,0x0f,0x88,0xf9,0xff,0x11,0x94,0xfb,0xff,0x13,0xa1,0xfd,0xff,0x15,0xae,0xff,0xff,0x12,0xb6,0xfe,0xff,0x12,0xb6,0xfe,0xff,0x12,0xb6,0xff,0xff,0x13,0xb7,0xff,0xff,0x13,0xb8,0xfe,0xff,0x12,0xb8,0xfe,0xff,0x12,0xb7,0xfd,0xff,0x12,0xb7,0xfd,0xff,0x13,0xb8,0xff,0xff,0x13,0xb9,0xfe,0xff,0x14,0xba,0xfd,0xff,0x15,0xbc,0xff,0xff,0x15,0xbd,0xff,0xff,0x16,0xbe,0xfe,0xff,0x14,0xbc,0xff,0xff,0x14,0xb9,0xff,0xff,0x13,0xb7,0xff,0xff,0x13,0xb5,0xfe,0xff,0x13,0xb2,0xff,0xff,0x13,0xb1,0xfe,0xff,0x10,0xae,0xfe,0xff,0x11,0xab,0xfe,0xff,0x11,0xa8,0xfe,0xff,0x11,0xa5,0xfe,0xff,0x11,0xa3,0xfe,0xff,0x12,0xa3,0xff,0xff,0x12,0xa3,0xff,0xff,0x12,0xa1,0xfe,0xff,0x13,0x9f,0xfd,0xff,0x12,0xa0,0xff,0xff,0x10,0xa2,0xfe,0xff,0x10,0xa5,0xfd,0xff,0x10,0xa6,0xfe,0xff,0x11,0xa7,0xfd,0xff,0x12,0xaa,0xff,0xff,0x12,0xac,0xfe,0xff,0x11,0xac,0xff,0xff,0x10,0xa9,0xff,0xff,0x0a,0xa0,0xfd,0xff,0x01,0x94,0xfa,0xff,0x0b,0x8f,0xfa,0xff,0x2a,0x9b,0xfb,0xff,0x68,0xb6,0xfa,0xef,0xb9,0xdd,0xfd,0xa0,0xf5,0xfa,0xff,0x41,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xf8,0xfa,0x00,0xfe,0xed,0xf4,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xe9,0xf1,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x01,0xf4,0xf9,0xfe,0x33,0xb5,0xd5,0xfb,0x9c,0x63,0xa6,0xf6,0xf5,0x24,0x80,0xf0,0xff,0x09,0x70,0xee,0xff,0x0a,0x72,0xf0,0xff,0x0f,0x78,0xf3,0xff,0x10,0x7c,0xf5,0xff,0x13,0x84,0xfa,0xff,0x13,0x8b,0xfa,0xff,0x10,0x97,0xfc,0xff,0x12,0xa5,0xff,0xff,0x15,0xb1,0xff,0xff,0x12,0xb7,0xfe,0xff,0x13,0xb8,0xff,0xff,0x13,0xb9,0xfe,0xff,0x14,0xbb,0xfd,0xff,0x14,0xbc,0xfe,0xff,0x13,0xbc,0xff,0xff,0x14,0xbb,0xfe,0xff,0x13,0xba,0xfd,0xff,0x12,0xba,0xfe,0xff,0x14,0xbc,0xfe,0xff,0x16,0xbe,0xfe,0xff,0x1b,0xc0,0xfe,0xff,0x20,0xc0,0xfe,0xff,0x21,0xc0,0xff,0xff,0x1c,0xbf,0xff,0xff,0x15,0xbc,0xff,0xff,0x14,0xba,0xff,0xff,0x14,0xb8,0xff,0xff,0x13,0xb7,0xfe,0xff,0x12,0xb5,0xfe,0xff,0x12,0xb1,0xfe,0xff,0x13,0xaf,0xfe,0xff,0x13,0xad,0xff,0xff,0x13,0xa8,0xff,0xff,0x11,0xa5,0xff,0xff,0x11,0xa2,0xff,0xff,0x10,0x9f,0xfc,0xff,0x10,0x9c,0xfa,0xff,0x10,0x9d,0xfb,0xff,0x11,0x9f,0xfe,0xff,0x10,0xa4,0xfd,0xff,0x10,0xa7,0xfd,0xff,0x11,0xa9,0xfd,0xff,0x10,0xa9,0xfc,0xff,0x10,0xa8,0xfc,0xff,0x0f,0xa9,0xfc,0xff,0x11,0xa7,0xfe,0xff,0x10,0x9d,0xfc,0xff,0x0e,0x97,0xfb,0xff,0x0e,0x9c,0xfc,0xff,0x13,0xa1,0xfd,0xff,0x0c,0x98,0xf9,0xff,0x03,0x86,0xf5,0xff,0x11,0x8b,0xf8,0xff,0x46,0xa7,0xfc,0xff,0x95,0xd0,0xfd,0xc5,0xe1,0xf3,0xff,0x58,0xff,0xff,0xff,0x0c,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xf8,0xfb,0x00,0xfe,0xed,0xf4,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xfc,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xf1,0xf7,0xfe,0x44,0xa8,0xcd,0xfa,0xbe,0x49,0x97,0xf5,0xfe,0x12,0x79,0xf1,0xff,0x09,0x74,0xf0,0xff,0x10,0x77,0xf1,0xff,0x10,0x77,0xef,0xff,0x12,0x79,0xf1,0xff,0x12,0x7a,0xf4,0xff,0x13,0x7d,0xf7,0xff,0x14,0x86,0xfa,0xff,0x11,0x8c,0xfa,0xff,0x10,0x9b,0xfc,0xff,0x13,0xab,0xfe,0xff,0x17,0xb8,0xfe,0xff,0x13,0xbb,0xfd,0xff,0x14,0xbb,0xff,0xff,0x17,0xbd,0xff,0xff,0x1b,0xbe,0xff,0xff,0x1f,0xbf,0xff,0xff,0x1f,0xbf,0xff,0xff,0x1f,0xc1,0xfe,0xff,0x1f,0xc0,0xfd,0xff,0x1c,0xc0,0xfc,0xff,0x1e,0xc2,0xfe,0xff,0x21,0xc4,0xfe,0xff,0x2a,0xc5,0xff,0xff,0x32,0xc5,0xff,0xff,0x31,0xc4,0xff,0xff,0x29,0xc2,0xff,0xff,0x1e,0xc0,0xff,0xff,0x17,0xbd,0xff,0xff,0x15,0xbc,0xff,0xff,0x13,0xbb,0xfe,0xff,0x13,0xb9,0xff,0xff,0x14,0xb7,0xff,0xff,0x14,0xb5,0xff,0xff,0x14,0xb3,0xff,0xff,0x14,0xaf,0xff,0xff,0x12,0xaa,0xff,0xff,0x11,0xa4,0xfe,0xff,0x12,0x9e,0xfd,0xff,0x11,0x9b,0xfc,0xff,0x10,0x9c,0xfc,0xff,0x11,0xa1,0xfe,0xff,0x12,0xa8,0xfe,0xff,0x13,0xac,0xff,0xff,0x13,0xaa,0xfe,0xff,0x11,0xa9,0xfe,0xff,0x10,0xa8,0xfd,0xff,0x12,0xa3,0xff,0xff,0x0f,0x9a,0xfa,0xff,0x0c,0x94,0xf8,0xff,0x0e,0x9b,0xfc,0xff,0x13,0xaa,0xfe,0xff,0x14,0xaf,0xfd,0xff,0x11,0xa0,0xfc,0xff,0x0e,0x8d,0xfa,0xff,0x0a,0x86,0xf7,0xff,0x05,0x86,0xf8,0xff,0x09,0x8d,0xfa,0xff,0x2c,0xa0,0xfb,0xff,0x82,0xc7,0xfe,0xe1,0xdb,0xef,0xff,0x73,0xff,0xff,0xff,0x0d,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf6,0xfa,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xef,0xf5,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xf1,0xf7,0xfe,0x36,0xa2,0xc8,0xf8,0xbd,0x45,0x92,0xf3,0xff,0x0f,0x75,0xf2,0xff,0x08,0x73,0xf1,0xff,0x0f,0x77,0xf2,0xff,0x14,0x7a,0xf4,0xff,0x13,0x7c,0xf5,0xff,0x12,0x7b,0xf4,0xff,0x12,0x7a,0xf4,0xff,0x11,0x7b,0xf4,0xff,0x12,0x7e,0xf6,0xff,0x11,0x8a,0xf9,0xff,0x11,0x95,0xfc,0xff,0x15,0xa5,0xff,0xff,0x17,0xb3,0xff,0xff,0x1b,0xbe,0xff,0xff,0x1b,0xc1,0xfd,0xff,0x1c,0xc0,0xfd,0xff,0x1e,0xc1,0xfe,0xff,0x23,0xc2,0xfe,0xff,0x28,0xc3,0xfe,0xff,0x28,0xc3,0xfd,0xff,0x29,0xc4,0xfd,0xff,0x33,0xc6,0xfe,0xff,0x36,0xc8,0xfe,0xff,0x35,0xc8,0xff,0xff,0x36,0xc9,0xff,0xff,0x3e,0xc9,0xff,0xff,0x48,0xc9,0xff,0xff,0x41,0xc8,0xff,0xff,0x35,0xc5,0xff,0xff,0x27,0xc3,0xff,0xff,0x22,0xc3,0xff,0xff,0x20,0xc1,0xfe,0xff,0x1c,0xbf,0xff,0xff,0x1a,0xbe,0xff,0xff,0x18,0xbd,0xfe,0xff,0x16,0xbc,0xfe,0xff,0x15,0xba,0xfe,0xff,0x13,0xb7,0xff,0xff,0x13,0xb2,0xff,0xff,0x12,0xab,0xfe,0xff,0x12,0xa6,0xff,0xff,0x12,0xa2,0xfd,0xff,0x0d,0x9f,0xfa,0xff,0x11,0xa7,0xfe,0xff,0x14,0xaf,0xff,0xff,0x11,0xaf,0xff,0xff,0x0f,0xac,0xfd,0xff,0x10,0xa9,0xfd,0xff,0x13,0xa0,0xff,0xff,0x0f,0x92,0xfb,0xff,0x0f,0x8c,0xf8,0xff,0x0e,0x9a,0xfb,0xff,0x10,0xaa,0xfe,0xff,0x12,0xb2,0xfe,0xff,0x12,0xb2,0xfc,0xff,0x11,0xa6,0xfc,0xff,0x11,0x94,0xfb,0xff,0x0d,0x8a,0xf6,0xff,0x0d,0x88,0xf8,0xff,0x0d,0x89,0xf7,0xff,0x0b,0x8c,0xf9,0xff,0x07,0x8d,0xfa,0xff,0x27,0x9e,0xfb,0xff,0x7b,0xc4,0xfd,0xe3,0xda,0xee,0xfe,0x68,0xff,0xff,0xff,0x05,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xeb,0xf2,0x00,0xff,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xf9,0xfc,0xff,0x21,0xb2,0xd1,0xfa,0xa0,0x47,0x92,0xf3,0xfc,0x0e,0x70,0xef,0xff,0x0a,0x71,0xef,0xff,0x11,0x77,0xf2,0xff,0x12,0x79,0xf1,0xff,0x13,0x7a,0xf2,0xff,0x14,0x7b,0xf5,0xff,0x13,0x7d,0xf5,0xff,0x13,0x7e,0xf6,0xff,0x13,0x7f,0xf6,0xff,0x13,0x80,0xf7,0xff,0x11,0x85,0xf7,0xff,0x11,0x95,0xfa,0xff,0x14,0xa5,0xfe,0xff,0x13,0xb0,0xff,0xff,0x14,0xb9,0xfd,0xff,0x1d,0xc2,0xfe,0xff,0x27,0xc6,0xfd,0xff,0x29,0xc4,0xfe,0xff,0x29,0xc3,0xfe,0xff,0x2a,0xc5,0xfe,0xff,0x2d,0xc5,0xff,0xff,0x2c,0xc5,0xfe,0xff,0x31,0xc6,0xff,0xff,0x43,0xc8,0xff,0xff,0x4e,0xcb,0xff,0xff,0x4f,0xcc,0xfe,0xff,0x4e,0xcc,0xfe,0xff,0x53,0xcd,0xfe,0xff,0x59,0xcc,0xfe,0xff,0x54,0xcc,0xff,0xff,0x43,0xca,0xfe,0xff,0x37,0xc7,0xff,0xff,0x35,0xc7,0xff,0xff,0x33,0xc6,0xfe,0xff,0x30,0xc5,0xff,0xff,0x2d,0xc4,0xff,0xff,0x2b,0xc2,0xff,0xff,0x25,0xc1,0xfe,0xff,0x1b,0xbf,0xfd,0xff,0x16,0xbc,0xfe,0xff,0x13,0xb9,0xff,0xff,0x13,0xb3,0xfe,0xff,0x12,0xaf,0xff,0xff,0x11,0xad,0xff,0xff,0x0f,0xac,0xfd,0xff,0x11,0xb0,0xfd,0xff,0x12,0xb3,0xff,0xff,0x11,0xb1,0xff,0xff,0x0f,0xad,0xfe,0xff,0x11,0xa4,0xff,0xff,0x12,0x8f,0xfa,0xff,0x0e,0x85,0xf6,0xff,0x0d,0x95,0xfb,0xff,0x0f,0xa8,0xfd,0xff,0x0f,0xae,0xfe,0xff,0x12,0xb1,0xfe,0xff,0x13,0xb3,0xfe,0xff,0x11,0xa7,0xfd,0xff,0x12,0x97,0xfc,0xff,0x0d,0x8b,0xf7,0xff,0x0e,0x88,0xf9,0xff,0x0f,0x88,0xf9,0xff,0x10,0x8b,0xf8,0xff,0x0f,0x8f,0xf9,0xff,0x0a,0x8f,0xfa,0xff,0x06,0x8d,0xfa,0xff,0x28,0x9a,0xfb,0xff,0x88,0xc4,0xfc,0xcf,0xe7,0xf3,0xfe,0x4b,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfc,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x09,0xc8,0xdd,0xfb,0x7c,0x5c,0x9d,0xf3,0xf4,0x13,0x72,0xef,0xff,0x09,0x6c,0xf0,0xff,0x11,0x73,0xf1,0xff,0x12,0x78,0xef,0xff,0x12,0x79,0xf3,0xff,0x12,0x79,0xf1,0xff,0x12,0x7b,0xf2,0xff,0x12,0x7d,0xf4,0xff,0x12,0x80,0xf6,0xff,0x12,0x83,0xf8,0xff,0x12,0x89,0xfa,0xff,0x13,0x8c,0xfb,0xff,0x15,0x94,0xfd,0xff,0x17,0xa2,0xfe,0xff,0x16,0xad,0xff,0xff,0x12,0xb4,0xff,0xff,0x13,0xbb,0xfe,0xff,0x1d,0xc1,0xfe,0xff,0x2c,0xc6,0xfe,0xff,0x2e,0xc6,0xff,0xff,0x2d,0xc5,0xfe,0xff,0x30,0xc6,0xff,0xff,0x3a,0xc7,0xff,0xff,0x41,0xc7,0xff,0xff,0x48,0xca,0xff,0xff,0x53,0xcd,0xfe,0xff,0x5b,0xcd,0xff,0xff,0x5e,0xcd,0xff,0xff,0x60,0xce,0xff,0xff,0x5f,0xce,0xff,0xff,0x60,0xce,0xff,0xff,0x60,0xce,0xff,0xff,0x58,0xcd,0xfe,0xff,0x4d,0xcc,0xfd,0xff,0x47,0xc9,0xfd,0xff,0x46,0xc8,0xfe,0xff,0x42,0xca,0xfe,0xff,0x3c,0xc8,0xff,0xff,0x3b,0xc6,0xfe,0xff,0x33,0xc4,0xfe,0xff,0x29,0xc4,0xfe,0xff,0x22,0xc1,0xfe,0xff,0x18,0xbd,0xfe,0xff,0x14,0xb9,0xfe,0xff,0x13,0xb6,0xff,0xff,0x12,0xb4,0xff,0xff,0x12,0xb5,0xff,0xff,0x11,0xb4,0xfe,0xff,0x10,0xb3,0xfe,0xff,0x11,0xb1,0xff,0xff,0x13,0xaa,0xff,0xff,0x10,0x97,0xf9,0xff,0x0d,0x87,0xf4,0xff,0x10,0x8f,0xfa,0xff,0x0f,0xa2,0xff,0xff,0x0f,0xaa,0xfd,0xff,0x0f,0xad,0xfc,0xff,0x11,0xaf,0xff,0xff,0x11,0xaf,0xfe,0xff,0x10,0xa7,0xfe,0xff,0x11,0x98,0xfd,0xff,0x0e,0x8b,0xf9,0xff,0x11,0x8a,0xfb,0xff,0x11,0x8a,0xfb,0xff,0x11,0x8b,0xf9,0xff,0x11,0x8e,0xf9,0xff,0x11,0x8f,0xfa,0xff,0x10,0x90,0xfb,0xff,0x0a,0x8b,0xfa,0xff,0x08,0x85,0xf8,0xff,0x35,0x96,0xf6,0xff,0x9e,0xcb,0xfb,0xb7,0xf4,0xf9,0xfe,0x26,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xeb,0xf2,0x00,0xff,0xf9,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xea,0xf2,0xfd,0x40,0x81,0xb0,0xf4,0xd3,0x1e,0x75,0xee,0xff,0x09,0x6b,0xee,0xff,0x0f,0x6f,0xef,0xff,0x12,0x73,0xf0,0xff,0x12,0x75,0xf0,0xff,0x12,0x77,0xf2,0xff,0x12,0x7a,0xf3,0xff,0x11,0x7c,0xf3,0xff,0x10,0x7e,0xf5,0xff,0x11,0x82,0xf6,0xff,0x10,0x85,0xf6,0xff,0x10,0x88,0xf7,0xff,0x11,0x8c,0xfa,0xff,0x11,0x93,0xfc,0xff,0x14,0xa1,0xff,0xff,0x16,0xac,0xff,0xff,0x13,0xb2,0xff,0xff,0x11,0xb7,0xff,0xff,0x14,0xbd,0xfd,0xff,0x1f,0xc2,0xfe,0xff,0x2c,0xc4,0xff,0xff,0x2e,0xc5,0xfe,0xff,0x35,0xc6,0xfe,0xff,0x3f,0xc8,0xff,0xff,0x49,0xca,0xfd,0xff,0x53,0xcb,0xfe,0xff,0x5b,0xcd,0xfe,0xff,0x5f,0xcd,0xff,0xff,0x61,0xcd,0xff,0xff,0x62,0xce,0xff,0xff,0x62,0xcf,0xfe,0xff,0x63,0xcf,0xfe,0xff,0x63,0xcf,0xfe,0xff,0x63,0xcf,0xfe,0xff,0x64,0xcf,0xfe,0xff,0x5d,0xce,0xfd,0xff,0x56,0xcd,0xfe,0xff,0x57,0xcc,0xfe,0xff,0x55,0xcc,0xfe,0xff,0x4d,0xcc,0xfe,0xff,0x45,0xca,0xfe,0xff,0x3d,0xc9,0xfe,0xff,0x36,0xc7,0xfe,0xff,0x2d,0xc4,0xff,0xff,0x20,0xc1,0xfe,0xff,0x1a,0xbf,0xfc,0xff,0x16,0xbd,0xfe,0xff,0x10,0xbb,0xfe,0xff,0x11,0xb9,0xff,0xff,0x11,0xb7,0xfe,0xff,0x11,0xb6,0xfe,0xff,0x12,0xaf,0xff,0xff,0x0e,0xa1,0xfb,0xff,0x0e,0x92,0xf7,0xff,0x0e,0x94,0xf7,0xff,0x12,0x9f,0xfe,0xff,0x10,0xa6,0xff,0xff,0x0f,0xa9,0xfd,0xff,0x10,0xab,0xfe,0xff,0x11,0xac,0xfe,0xff,0x10,0xaa,0xfc,0xff,0x0f,0xa6,0xfd,0xff,0x0d,0x99,0xfd,0xff,0x0d,0x8d,0xf8,0xff,0x11,0x8d,0xfa,0xff,0x11,0x8d,0xfa,0xff,0x12,0x8c,0xfa,0xff,0x11,0x8e,0xfa,0xff,0x10,0x8e,0xfa,0xff,0x11,0x8f,0xfa,0xff,0x0f,0x8d,0xf9,0xff,0x0e,0x87,0xf8,0xff,0x07,0x7d,0xf6,0xff,0x0a,0x7c,0xf5,0xff,0x53,0xa1,0xf7,0xf4,0xca,0xe1,0xfc,0x79,0xff,0xff,0xff,0x07,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf0,0xf6,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x0c,0xb6,0xcf,0xf7,0x92,0x3f,0x83,0xec,0xff,0x09,0x65,0xe9,0xff,0x0e,0x6c,0xee,0xff,0x12,0x71,0xee,0xff,0x11,0x71,0xef,0xff,0x11,0x73,0xf0,0xff,0x11,0x76,0xf0,0xff,0x12,0x79,0xf3,0xff,0x13,0x7b,0xf4,0xff,0x12,0x7d,0xf5,0xff,0x11,0x83,0xf7,0xff,0x11,0x88,0xf8,0xff,0x11,0x8a,0xf9,0xff,0x0f,0x8e,0xf9,0xff,0x11,0x94,0xfc,0xff,0x12,0x9f,0xff,0xff,0x13,0xac,0xff,0xff,0x13,0xb2,0xff,0xff,0x11,0xb5,0xfe,0xff,0x12,0xb8,0xff,0xff,0x15,0xbd,0xfd,0xff,0x20,0xc1,0xfe,0xff,0x2b,0xc3,0xff,0xff,0x30,0xc5,0xfe,0xff,0x3c,0xc6,0xff,0xff,0x4a,0xc8,0xff,0xff,0x54,0xcb,0xff,0xff,0x58,0xcb,0xfe,0xff,0x5d,0xcc,0xff,0xff,0x5f,0xcc,0xff,0xff,0x61,0xcd,0xff,0xff,0x62,0xcf,0xfe,0xff,0x64,0xcf,0xfd,0xff,0x68,0xd0,0xfe,0xff,0x67,0xd0,0xfe,0xff,0x66,0xd0,0xfe,0xff,0x68,0xd0,0xfe,0xff,0x65,0xd0,0xfe,0xff,0x60,0xcf,0xfe,0xff,0x60,0xcd,0xff,0xff,0x61,0xcd,0xff,0xff,0x5d,0xcd,0xff,0xff,0x54,0xcc,0xfd,0xff,0x4c,0xcb,0xfe,0xff,0x46,0xca,0xff,0xff,0x3d,0xc8,0xff,0xff,0x31,0xc7,0xfd,0xff,0x2b,0xc5,0xfd,0xff,0x25,0xc3,0xfd,0xff,0x1c,0xc0,0xfd,0xff,0x15,0xbe,0xfd,0xff,0x16,0xbd,0xfe,0xff,0x12,0xb8,0xfe,0xff,0x11,0xac,0xfd,0xff,0x0e,0xa1,0xfc,0xff,0x0e,0xa2,0xfe,0xff,0x0f,0xa7,0xfc,0xff,0x12,0xa8,0xfe,0xff,0x11,0xa6,0xff,0xff,0x11,0xa8,0xfe,0xff,0x10,0xa7,0xfe,0xff,0x0f,0xa7,0xfe,0xff,0x10,0xa6,0xfd,0xff,0x10,0xa4,0xfd,0xff,0x10,0x9d,0xff,0xff,0x0f,0x94,0xfa,0xff,0x11,0x90,0xf9,0xff,0x10,0x8e,0xf9,0xff,0x11,0x8c,0xf9,0xff,0x11,0x8e,0xfa,0xff,0x10,0x8e,0xf9,0xff,0x10,0x8d,0xf9,0xff,0x0e,0x8b,0xf8,0xff,0x0e,0x87,0xf8,0xff,0x10,0x81,0xf7,0xff,0x0d,0x7d,0xf7,0xff,0x07,0x77,0xf3,0xff,0x1e,0x81,0xf3,0xff,0x85,0xba,0xf9,0xcd,0xef,0xf6,0xfe,0x30,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xf6,0xf9,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf1,0x00,0xfe,0xf5,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xed,0xf2,0xfc,0x38,0x7a,0xa6,0xee,0xd5,0x14,0x66,0xe5,0xff,0x09,0x61,0xe8,0xff,0x10,0x6a,0xea,0xff,0x12,0x70,0xed,0xff,0x12,0x72,0xed,0xff,0x12,0x73,0xf0,0xff,0x12,0x75,0xf2,0xff,0x12,0x77,0xf1,0xff,0x12,0x7a,0xf4,0xff,0x13,0x7d,0xf5,0xff,0x12,0x81,0xf7,0xff,0x12,0x88,0xf9,0xff,0x13,0x8d,0xfa,0xff,0x13,0x90,0xfc,0xff,0x13,0x95,0xfd,0xff,0x15,0x9b,0xff,0xff,0x13,0xa2,0xfe,0xff,0x14,0xad,0xff,0xff,0x11,0xb3,0xff,0xff,0x10,0xb5,0xff,0xff,0x13,0xb8,0xfe,0xff,0x15,0xbd,0xfe,0xff,0x1f,0xc0,0xff,0xff,0x2a,0xc3,0xfe,0xff,0x30,0xc5,0xfd,0xff,0x3a,0xc7,0xff,0xff,0x48,0xc9,0xff,0xff,0x54,0xcb,0xff,0xff,0x5a,0xcc,0xff,0xff,0x5a,0xcc,0xff,0xff,0x5c,0xcd,0xff,0xff,0x61,0xce,0xff,0xff,0x64,0xcf,0xfe,0xff,0x66,0xcf,0xfe,0xff,0x68,0xd0,0xfe,0xff,0x6a,0xd0,0xfe,0xff,0x6b,0xd0,0xfe,0xff,0x6c,0xd0,0xfe,0xff,0x6c,0xd0,0xfe,0xff,0x6b,0xd0,0xfe,0xff,0x69,0xcf,0xff,0xff,0x66,0xcf,0xff,0xff,0x61,0xcf,0xff,0xff,0x60,0xcd,0xff,0xff,0x5d,0xcc,0xff,0xff,0x55,0xcc,0xff,0xff,0x4c,0xcb,0xfe,0xff,0x42,0xca,0xfd,0xff,0x3a,0xc8,0xfe,0xff,0x35,0xc7,0xfe,0xff,0x32,0xc4,0xfe,0xff,0x29,0xc3,0xfc,0xff,0x22,0xc0,0xfd,0xff,0x18,0xb9,0xfe,0xff,0x10,0xb1,0xfd,0xff,0x10,0xaf,0xff,0xff,0x10,0xb1,0xff,0xff,0x11,0xaf,0xfe,0xff,0x10,0xaa,0xfe,0xff,0x10,0xa7,0xfe,0xff,0x11,0xa5,0xfe,0xff,0x10,0xa4,0xfd,0xff,0x10,0xa4,0xfd,0xff,0x11,0xa5,0xfe,0xff,0x11,0xa3,0xfe,0xff,0x12,0x9f,0xff,0xff,0x13,0x9a,0xff,0xff,0x12,0x94,0xfc,0xff,0x10,0x90,0xf9,0xff,0x10,0x8e,0xfa,0xff,0x11,0x8e,0xfa,0xff,0x10,0x8e,0xf9,0xff,0x0f,0x8c,0xf9,0xff,0x10,0x8a,0xfa,0xff,0x10,0x86,0xf7,0xff,0x0d,0x7d,0xf1,0xff,0x10,0x7c,0xef,0xff,0x11,0x7b,0xf1,0xff,0x0a,0x76,0xf2,0xff,0x07,0x71,0xef,0xff,0x4a,0x93,0xf2,0xfa,0xc9,0xde,0xfb,0x72,0xff,0xff,0xff,0x05,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xeb,0xf3,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x01,0xc7,0xd7,0xf6,0x6e,0x47,0x7f,0xe3,0xfe,0x09,0x59,0xdf,0xff,0x0b,0x60,0xe4,0xff,0x11,0x67,0xe8,0xff,0x11,0x6a,0xeb,0xff,0x12,0x70,0xee,0xff,0x13,0x72,0xef,0xff,0x11,0x74,0xef,0xff,0x10,0x76,0xf1,0xff,0x11,0x79,0xf1,0xff,0x10,0x7c,0xf3,0xff,0x10,0x80,0xf4,0xff,0x12,0x89,0xfa,0xff,0x11,0x90,0xfb,0xff,0x10,0x91,0xfa,0xff,0x12,0x95,0xfc,0xff,0x11,0x9a,0xfd,0xff,0x12,0x9f,0xff,0xff,0x13,0xa5,0xfe,0xff,0x14,0xad,0xfd,0xff,0x10,0xb4,0xff,0xff,0x10,0xb6,0xff,0xff,0x11,0xb9,0xff,0xff,0x14,0xbc,0xfe,0xff,0x17,0xbd,0xfe,0xff,0x1f,0xc0,0xfe,0xff,0x28,0xc4,0xff,0xff,0x31,0xc6,0xfe,0xff,0x3b,0xc7,0xfe,0xff,0x46,0xca,0xfe,0xff,0x53,0xcb,0xff,0xff,0x57,0xcb,0xff,0xff,0x55,0xcc,0xff,0xff,0x5e,0xce,0xff,0xff,0x66,0xcf,0xff,0xff,0x68,0xcf,0xfe,0xff,0x69,0xd0,0xfd,0xff,0x6c,0xd1,0xfe,0xff,0x70,0xd1,0xff,0xff,0x72,0xd2,0xfe,0xff,0x73,0xd1,0xfe,0xff,0x71,0xd1,0xfe,0xff,0x71,0xd2,0xff,0xff,0x6d,0xd2,0xff,0xff,0x6b,0xd1,0xfe,0xff,0x6a,0xd1,0xfd,0xff,0x6a,0xcf,0xfe,0xff,0x63,0xcf,0xfe,0xff,0x5b,0xce,0xfe,0xff,0x52,0xcc,0xfe,0xff,0x49,0xcc,0xfd,0xff,0x46,0xcb,0xfe,0xff,0x4e,0xca,0xfe,0xff,0x44,0xca,0xfd,0xff,0x2e,0xc3,0xfd,0xff,0x1c,0xbd,0xff,0xff,0x14,0xba,0xff,0xff,0x12,0xba,0xfe,0xff,0x11,0xba,0xfd,0xff,0x10,0xb4,0xfe,0xff,0x0e,0xac,0xfd,0xff,0x10,0xa5,0xfe,0xff,0x11,0xa2,0xfe,0xff,0x10,0xa2,0xfd,0xff,0x10,0xa2,0xfc,0xff,0x0f,0xa4,0xfd,0xff,0x10,0xa3,0xff,0xff,0x11,0xa0,0xfe,0xff,0x11,0x9c,0xfd,0xff,0x11,0x97,0xfd,0xff,0x0e,0x92,0xfa,0xff,0x0f,0x90,0xfa,0xff,0x10,0x8f,0xfa,0xff,0x10,0x8d,0xfa,0xff,0x10,0x8d,0xfa,0xff,0x0e,0x87,0xfa,0xff,0x18,0x8c,0xf4,0xff,0x39,0xae,0xf1,0xff,0x23,0x96,0xee,0xff,0x0c,0x7d,0xed,0xff,0x0c,0x77,0xf1,0xff,0x0c,0x73,0xee,0xff,0x06,0x6a,0xec,0xff,0x1f,0x75,0xeb,0xff,0x94,0xbb,0xf5,0xb4,0xf8,0xfb,0xfe,0x17,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xfe,0xf0,0xf6,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xed,0xf4,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xfc,0xfd,0xff,0x0a,0x9f,0xba,0xea,0xb0,0x24,0x60,0xd5,0xff,0x09,0x51,0xd7,0xff,0x11,0x5c,0xdf,0xff,0x10,0x62,0xe5,0xff,0x11,0x67,0xe8,0xff,0x11,0x6a,0xeb,0xff,0x10,0x70,0xef,0xff,0x12,0x72,0xf0,0xff,0x11,0x75,0xf0,0xff,0x11,0x78,0xf2,0xff,0x12,0x7c,0xf6,0xff,0x10,0x83,0xf9,0xff,0x10,0x8a,0xfb,0xff,0x10,0x8f,0xfc,0xff,0x0f,0x97,0xfd,0xff,0x0f,0x9a,0xfe,0xff,0x0f,0x9b,0xfe,0xff,0x0e,0x9f,0xfe,0xff,0x10,0xa5,0xff,0xff,0x12,0xa9,0xfe,0xff,0x12,0xad,0xfd,0xff,0x11,0xb2,0xfe,0xff,0x11,0xb6,0xff,0xff,0x12,0xb9,0xff,0xff,0x14,0xba,0xff,0xff,0x15,0xbb,0xfe,0xff,0x15,0xbc,0xfd,0xff,0x1b,0xc0,0xfd,0xff,0x27,0xc5,0xfd,0xff,0x2e,0xc5,0xfd,0xff,0x36,0xc7,0xfe,0xff,0x44,0xc9,0xfe,0xff,0x52,0xcb,0xff,0xff,0x56,0xcc,0xff,0xff,0x57,0xcd,0xff,0xff,0x60,0xce,0xff,0xff,0x68,0xcf,0xfe,0xff,0x6b,0xd0,0xfd,0xff,0x6e,0xd2,0xfe,0xff,0x71,0xd2,0xff,0xff,0x73,0xd3,0xff,0xff,0x75,0xd4,0xfe,0xff,0x75,0xd4,0xfe,0xff,0x75,0xd5,0xfe,0xff,0x75,0xd4,0xfe,0xff,0x75,0xd3,0xff,0xff,0x77,0xd4,0xff,0xff,0x75,0xd3,0xfe,0xff,0x70,0xd2,0xfe,0xff,0x6d,0xd1,0xfe,0xff,0x67,0xd0,0xfe,0xff,0x5e,0xcf,0xfe,0xff,0x59,0xce,0xfe,0xff,0x5b,0xcd,0xfd,0xff,0x50,0xcc,0xfd,0xff,0x38,0xc6,0xfb,0xff,0x24,0xc1,0xfe,0xff,0x1c,0xc0,0xfe,0xff,0x17,0xbe,0xfc,0xff,0x13,0xbc,0xfc,0xff,0x10,0xb5,0xfe,0xff,0x0f,0xad,0xfe,0xff,0x11,0xa4,0xfe,0xff,0x0f,0xa0,0xfd,0xff,0x10,0xa1,0xfc,0xff,0x11,0xa3,0xfd,0xff,0x0f,0xa4,0xfe,0xff,0x10,0xa2,0xfe,0xff,0x10,0x9f,0xfc,0xff,0x10,0x9c,0xfc,0xff,0x11,0x99,0xfd,0xff,0x0f,0x95,0xfc,0xff,0x0f,0x92,0xfb,0xff,0x0f,0x90,0xfa,0xff,0x0f,0x8d,0xfa,0xff,0x0f,0x8b,0xfa,0xff,0x0e,0x85,0xf8,0xff,0x10,0x82,0xf2,0xff,0x1a,0x8d,0xed,0xff,0x17,0x85,0xf0,0xff,0x0e,0x7b,0xf1,0xff,0x0b,0x76,0xf0,0xff,0x0e,0x72,0xee,0xff,0x10,0x6d,0xec,0xff,0x08,0x64,0xe7,0xff,0x0b,0x61,0xe5,0xff,0x67,0x99,0xec,0xe9,0xe7,0xef,0xfc,0x39,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf3,0xf8,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x00,0xf0,0xf3,0xfb,0x32,0x74,0x96,0xde,0xd0,0x10,0x4f,0xcb,0xff,0x0a,0x4c,0xce,0xff,0x11,0x53,0xd5,0xff,0x11,0x5a,0xdd,0xff,0x11,0x63,0xe5,0xff,0x11,0x67,0xe8,0xff,0x12,0x6a,0xeb,0xff,0x0f,0x71,0xef,0xff,0x11,0x75,0xf0,0xff,0x11,0x78,0xf1,0xff,0x11,0x80,0xf6,0xff,0x12,0x88,0xfb,0xff,0x11,0x93,0xfc,0xff,0x11,0x98,0xfd,0xff,0x10,0x98,0xfc,0xff,0x11,0x9b,0xfd,0xff,0x11,0x9d,0xff,0xff,0x11,0x9e,0xfe,0xff,0x12,0xa4,0xff,0xff,0x12,0xa9,0xff,0xff,0x12,0xab,0xff,0xff,0x13,0xaf,0xff,0xff,0x12,0xb3,0xff,0xff,0x13,0xb7,0xff,0xff,0x13,0xb8,0xff,0xff,0x13,0xb8,0xfe,0xff,0x14,0xba,0xff,0xff,0x14,0xbb,0xfe,0xff,0x14,0xbd,0xfa,0xff,0x22,0xc2,0xfd,0xff,0x2e,0xc4,0xfe,0xff,0x31,0xc6,0xfd,0xff,0x37,0xc8,0xfe,0xff,0x44,0xca,0xfe,0xff,0x53,0xcc,0xff,0xff,0x57,0xcc,0xff,0xff,0x5d,0xce,0xff,0xff,0x66,0xcf,0xfe,0xff,0x6c,0xd0,0xfe,0xff,0x6d,0xd1,0xfd,0xff,0x70,0xd2,0xfe,0xff,0x73,0xd4,0xfe,0xff,0x75,0xd5,0xfe,0xff,0x78,0xd5,0xfe,0xff,0x79,0xd5,0xfe,0xff,0x7c,0xd5,0xff,0xff,0x7d,0xd5,0xff,0xff,0x7e,0xd5,0xff,0xff,0x7e,0xd5,0xff,0xff,0x7c,0xd5,0xff,0xff,0x7b,0xd4,0xfe,0xff,0x76,0xd2,0xfe,0xff,0x70,0xd2,0xff,0xff,0x6c,0xcf,0xff,0xff,0x63,0xce,0xff,0xff,0x59,0xcc,0xff,0xff,0x4a,0xc9,0xfd,0xff,0x35,0xc6,0xfc,0xff,0x2a,0xc4,0xfd,0xff,0x1d,0xc0,0xfd,0xff,0x12,0xbc,0xfb,0xff,0x12,0xb7,0xff,0xff,0x0f,0xae,0xff,0xff,0x0f,0xa3,0xfd,0xff,0x0d,0x9f,0xfc,0xff,0x0f,0xa2,0xfe,0xff,0x11,0xa4,0xfe,0xff,0x10,0xa3,0xfe,0xff,0x10,0xa0,0xfd,0xff,0x10,0x9c,0xfc,0xff,0x10,0x9b,0xfc,0xff,0x10,0x9b,0xfd,0xff,0x10,0x99,0xfc,0xff,0x0f,0x94,0xfb,0xff,0x0f,0x91,0xfa,0xff,0x0e,0x8d,0xfa,0xff,0x11,0x8b,0xfa,0xff,0x0f,0x85,0xf9,0xff,0x0f,0x7e,0xf6,0xff,0x0c,0x78,0xf2,0xff,0x0d,0x77,0xf2,0xff,0x0e,0x77,0xf3,0xff,0x0d,0x74,0xee,0xff,0x0e,0x6e,0xed,0xff,0x0f,0x69,0xea,0xff,0x0f,0x65,0xe6,0xff,0x0b,0x5e,0xe2,0xff,0x03,0x54,0xdc,0xff,0x3f,0x79,0xe1,0xf4,0xcc,0xda,0xf7,0x70,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xfb,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xe2,0xeb,0xfb,0x3c,0x56,0x8d,0xe7,0xed,0x09,0x52,0xd4,0xff,0x0e,0x4f,0xcf,0xff,0x0f,0x50,0xcf,0xff,0x11,0x53,0xd3,0xff,0x11,0x57,0xda,0xff,0x10,0x60,0xe2,0xff,0x11,0x66,0xe8,0xff,0x12,0x6b,0xeb,0xff,0x11,0x74,0xef,0xff,0x14,0x7c,0xf3,0xff,0x10,0x81,0xf7,0xff,0x10,0x8c,0xfb,0xff,0x11,0x9a,0xfd,0xff,0x10,0xa5,0xfd,0xff,0x13,0xaa,0xff,0xff,0x14,0xa8,0xff,0xff,0x10,0xa0,0xfe,0xff,0x0f,0x9e,0xfb,0xff,0x14,0xa4,0xfe,0xff,0x13,0xab,0xff,0xff,0x10,0xaf,0xff,0xff,0x10,0xb1,0xfe,0xff,0x11,0xb4,0xff,0xff,0x12,0xb6,0xfe,0xff,0x13,0xb8,0xff,0xff,0x13,0xb9,0xfd,0xff,0x13,0xba,0xfd,0xff,0x16,0xbc,0xff,0xff,0x17,0xbd,0xfe,0xff,0x19,0xc0,0xfc,0xff,0x24,0xc2,0xfe,0xff,0x30,0xc5,0xfe,0xff,0x31,0xc7,0xfd,0xff,0x31,0xc8,0xff,0xff,0x35,0xc9,0xfe,0xff,0x48,0xcb,0xfe,0xff,0x56,0xcd,0xff,0xff,0x5f,0xce,0xff,0xff,0x66,0xcf,0xfe,0xff,0x69,0xd1,0xfe,0xff,0x6c,0xd1,0xfe,0xff,0x70,0xd1,0xff,0xff,0x73,0xd3,0xfe,0xff,0x77,0xd4,0xff,0xff,0x7a,0xd5,0xff,0xff,0x7e,0xd7,0xff,0xff,0x81,0xd7,0xff,0xff,0x84,0xd7,0xff,0xff,0x83,0xd7,0xff,0xff,0x85,0xd7,0xfe,0xff,0x85,0xd7,0xff,0xff,0x83,0xd6,0xfe,0xff,0x7f,0xd5,0xfe,0xff,0x7b,0xd4,0xff,0xff,0x74,0xd2,0xff,0xff,0x6a,0xd0,0xfe,0xff,0x63,0xce,0xff,0xff,0x5b,0xcd,0xfe,0xff,0x4a,0xcb,0xfc,0xff,0x37,0xc8,0xfb,0xff,0x27,0xc4,0xfc,0xff,0x16,0xbc,0xfb,0xff,0x11,0xb6,0xfe,0xff,0x0e,0xae,0xfe,0xff,0x0d,0xa8,0xfc,0xff,0x0e,0xa2,0xfc,0xff,0x10,0xa3,0xfe,0xff,0x10,0xa3,0xff,0xff,0x0f,0xa1,0xff,0xff,0x0e,0x9e,0xfd,0xff,0x0f,0x9b,0xfd,0xff,0x0f,0x9a,0xfc,0xff,0x11,0x9b,0xfd,0xff,0x0f,0x9a,0xfc,0xff,0x0f,0x96,0xfb,0xff,0x0e,0x92,0xf9,0xff,0x10,0x8e,0xf9,0xff,0x10,0x8a,0xfa,0xff,0x0f,0x84,0xf8,0xff,0x0f,0x80,0xf6,0xff,0x0e,0x7c,0xf2,0xff,0x14,0x80,0xf0,0xff,0x12,0x7b,0xf0,0xff,0x0f,0x6e,0xee,0xff,0x0f,0x6a,0xec,0xff,0x10,0x66,0xe8,0xff,0x0e,0x62,0xe4,0xff,0x0c,0x5d,0xdf,0xff,0x0b,0x58,0xda,0xff,0x04,0x4d,0xd5,0xff,0x2a,0x63,0xd9,0xff,0xb3,0xc7,0xef,0x86,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xf9,0xfb,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xfb,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xd0,0xde,0xf7,0x5a,0x42,0x8c,0xf0,0xf2,0x0c,0x7a,0xf6,0xff,0x15,0x80,0xf6,0xff,0x16,0x70,0xe9,0xff,0x12,0x5d,0xdd,0xff,0x0d,0x53,0xd5,0xff,0x0c,0x55,0xd7,0xff,0x0f,0x5f,0xe2,0xff,0x12,0x66,0xe9,0xff,0x11,0x6a,0xea,0xff,0x11,0x76,0xf1,0xff,0x10,0x80,0xf6,0xff,0x0e,0x8a,0xf9,0xff,0x10,0x9c,0xfd,0xff,0x11,0xaa,0xff,0xff,0x11,0xb3,0xff,0xff,0x10,0xb4,0xfe,0xff,0x11,0xb1,0xff,0xff,0x0c,0xa7,0xfc,0xff,0x0d,0xa6,0xfa,0xff,0x15,0xaf,0xfc,0xff,0x12,0xb3,0xfd,0xff,0x0f,0xb5,0xfd,0xff,0x11,0xb6,0xfc,0xff,0x13,0xb8,0xfe,0xff,0x13,0xb8,0xfe,0xff,0x12,0xb8,0xfe,0xff,0x12,0xb9,0xfe,0xff,0x18,0xbc,0xfc,0xff,0x22,0xc1,0xff,0xff,0x2c,0xc4,0xff,0xff,0x30,0xc6,0xfc,0xff,0x32,0xc6,0xfe,0xff,0x37,0xc7,0xfd,0xff,0x3e,0xc8,0xfd,0xff,0x44,0xc8,0xfe,0xff,0x44,0xc9,0xfd,0xff,0x46,0xcb,0xfc,0xff,0x51,0xcd,0xff,0xff,0x61,0xce,0xff,0xff,0x67,0xd0,0xfe,0xff,0x69,0xd0,0xfd,0xff,0x6b,0xd1,0xfe,0xff,0x6f,0xd2,0xff,0xff,0x72,0xd2,0xfe,0xff,0x77,0xd4,0xff,0xff,0x7d,0xd6,0xff,0xff,0x7f,0xd7,0xff,0xff,0x82,0xd7,0xff,0xff,0x84,0xd7,0xff,0xff,0x86,0xd7,0xfe,0xff,0x88,0xd8,0xfe,0xff,0x88,0xd8,0xfe,0xff,0x85,0xd8,0xfe,0xff,0x82,0xd7,0xfe,0xff,0x80,0xd6,0xff,0xff,0x78,0xd4,0xff,0xff,0x6f,0xd2,0xff,0xff,0x69,0xd0,0xfe,0xff,0x62,0xce,0xfe,0xff,0x5b,0xcc,0xfe,0xff,0x4b,0xc9,0xfd,0xff,0x38,0xc6,0xfe,0xff,0x1b,0xbb,0xfc,0xff,0x0c,0xb3,0xfb,0xff,0x0e,0xae,0xfe,0xff,0x0f,0xab,0xfd,0xff,0x10,0xa7,0xfe,0xff,0x0f,0xa4,0xfe,0xff,0x0f,0xa1,0xfe,0xff,0x0e,0x9f,0xfd,0xff,0x0e,0x9c,0xfd,0xff,0x0e,0x9a,0xfc,0xff,0x0e,0x9a,0xfc,0xff,0x10,0x9b,0xfe,0xff,0x10,0x99,0xfe,0xff,0x0e,0x95,0xfc,0xff,0x0e,0x91,0xf9,0xff,0x11,0x8c,0xfa,0xff,0x10,0x88,0xfa,0xff,0x10,0x84,0xf8,0xff,0x11,0x7f,0xf6,0xff,0x0e,0x80,0xf3,0xff,0x31,0xa0,0xf1,0xff,0x36,0x9c,0xec,0xff,0x0f,0x71,0xec,0xff,0x0e,0x66,0xe8,0xff,0x0e,0x62,0xe5,0xff,0x0d,0x5d,0xe0,0xff,0x0d,0x59,0xdc,0xff,0x0d,0x57,0xda,0xff,0x0d,0x53,0xd5,0xff,0x06,0x48,0xcc,0xff,0x15,0x51,0xc2,0xff,0x99,0xb1,0xe0,0x9f,0xff,0xff,0xff,0x0b,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xf3,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xc1,0xd1,0xf2,0x81,0x33,0x7c,0xe8,0xff,0x07,0x7f,0xf7,0xff,0x14,0x9d,0xff,0xff,0x15,0x9f,0xff,0xff,0x12,0x96,0xfc,0xff,0x15,0x85,0xf9,0xff,0x15,0x7a,0xf3,0xff,0x12,0x7a,0xf1,0xff,0x11,0x7a,0xf2,0xff,0x11,0x7a,0xf2,0xff,0x14,0x7d,0xf2,0xff,0x13,0x85,0xf7,0xff,0x10,0x8d,0xfb,0xff,0x0f,0x9a,0xfd,0xff,0x11,0xad,0xfe,0xff,0x15,0xb5,0xff,0xff,0x13,0xb8,0xff,0xff,0x11,0xb8,0xff,0xff,0x11,0xb7,0xff,0xff,0x10,0xb4,0xfe,0xff,0x11,0xb5,0xfd,0xff,0x16,0xba,0xff,0xff,0x15,0xba,0xfe,0xff,0x14,0xba,0xff,0xff,0x15,0xba,0xff,0xff,0x15,0xba,0xff,0xff,0x14,0xba,0xff,0xff,0x13,0xbc,0xff,0xff,0x1a,0xbf,0xff,0xff,0x26,0xc3,0xfe,0xff,0x2e,0xc7,0xfd,0xff,0x43,0xc8,0xfe,0xff,0x55,0xcc,0xfe,0xff,0x59,0xcd,0xfd,0xff,0x56,0xcf,0xfc,0xff,0x5d,0xce,0xfd,0xff,0x5f,0xcd,0xfe,0xff,0x58,0xcd,0xfe,0xff,0x51,0xcd,0xfe,0xff,0x54,0xce,0xfe,0xff,0x61,0xce,0xfe,0xff,0x69,0xd0,0xfe,0xff,0x6c,0xd2,0xfe,0xff,0x6c,0xd1,0xfd,0xff,0x70,0xd2,0xff,0xff,0x73,0xd3,0xff,0xff,0x78,0xd5,0xfe,0xff,0x7d,0xd7,0xff,0xff,0x7f,0xd7,0xff,0xff,0x82,0xd7,0xff,0xff,0x84,0xd7,0xfe,0xff,0x86,0xd8,0xfe,0xff,0x88,0xd9,0xff,0xff,0x88,0xd9,0xfe,0xff,0x87,0xd9,0xfe,0xff,0x85,0xd8,0xfe,0xff,0x80,0xd7,0xff,0xff,0x7d,0xd6,0xff,0xff,0x77,0xd4,0xff,0xff,0x6d,0xd1,0xfe,0xff,0x68,0xcf,0xfe,0xff,0x62,0xcd,0xff,0xff,0x5a,0xcc,0xff,0xff,0x4c,0xcb,0xff,0xff,0x2f,0xc4,0xfd,0xff,0x1c,0xbb,0xfa,0xff,0x1f,0xba,0xfd,0xff,0x1a,0xb5,0xfe,0xff,0x14,0xaf,0xfe,0xff,0x12,0xaa,0xfc,0xff,0x12,0xa6,0xfc,0xff,0x12,0xa3,0xfc,0xff,0x12,0xa1,0xfb,0xff,0x12,0xa2,0xfa,0xff,0x10,0xa0,0xfb,0xff,0x10,0xa0,0xfc,0xff,0x0f,0x9c,0xfc,0xff,0x0d,0x94,0xfa,0xff,0x0f,0x8f,0xfa,0xff,0x11,0x8b,0xfa,0xff,0x11,0x88,0xf9,0xff,0x12,0x85,0xf9,0xff,0x12,0x83,0xf8,0xff,0x0f,0x7d,0xf5,0xff,0x0a,0x73,0xef,0xff,0x0c,0x68,0xe7,0xff,0x10,0x66,0xe5,0xff,0x0e,0x62,0xe3,0xff,0x0d,0x5d,0xe0,0xff,0x0d,0x5a,0xdc,0xff,0x0d,0x57,0xdb,0xff,0x0e,0x55,0xd5,0xff,0x0e,0x4f,0xcb,0xff,0x0e,0x49,0xc0,0xff,0x06,0x41,0xb4,0xff,0x0f,0x44,0xb3,0xff,0x86,0xa0,0xd7,0xc8,0xf9,0xfb,0xfd,0x17,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe7,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf6,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xba,0xd3,0xf9,0x86,0x28,0x77,0xe9,0xff,0x08,0x7c,0xf5,0xff,0x11,0x9f,0xff,0xff,0x10,0xaf,0xfd,0xff,0x0f,0xb0,0xfe,0xff,0x11,0xac,0xff,0xff,0x11,0xa3,0xff,0xff,0x12,0xa0,0xff,0xff,0x12,0xa0,0xff,0xff,0x11,0x9d,0xfd,0xff,0x11,0x9b,0xfd,0xff,0x13,0x9a,0xfd,0xff,0x12,0x99,0xfd,0xff,0x10,0x9f,0xfe,0xff,0x0f,0xab,0xfe,0xff,0x13,0xb8,0xfd,0xff,0x17,0xbe,0xfe,0xff,0x13,0xbc,0xfc,0xff,0x12,0xba,0xfe,0xff,0x14,0xba,0xfe,0xff,0x14,0xba,0xfe,0xff,0x14,0xba,0xfe,0xff,0x14,0xba,0xff,0xff,0x13,0xb9,0xfe,0xff,0x14,0xb8,0xff,0xff,0x13,0xb9,0xff,0xff,0x12,0xb9,0xff,0xff,0x11,0xb9,0xff,0xff,0x13,0xbb,0xfd,0xff,0x1f,0xc2,0xfc,0xff,0x2e,0xc7,0xfd,0xff,0x3c,0xc8,0xfd,0xff,0x49,0xcb,0xfe,0xff,0x56,0xcb,0xfd,0xff,0x57,0xcb,0xfd,0xff,0x56,0xcc,0xfc,0xff,0x5f,0xcd,0xfd,0xff,0x66,0xcf,0xfe,0xff,0x64,0xce,0xff,0xff,0x5e,0xce,0xff,0xff,0x59,0xcf,0xff,0xff,0x5d,0xcf,0xfe,0xff,0x66,0xd0,0xfd,0xff,0x6d,0xd1,0xff,0xff,0x6e,0xd1,0xfe,0xff,0x70,0xd2,0xfd,0xff,0x73,0xd4,0xfd,0xff,0x78,0xd4,0xfe,0xff,0x7d,0xd6,0xff,0xff,0x7f,0xd7,0xff,0xff,0x82,0xd7,0xff,0xff,0x84,0xd7,0xfe,0xff,0x86,0xd8,0xfd,0xff,0x88,0xd9,0xfe,0xff,0x88,0xd9,0xfe,0xff,0x88,0xd9,0xfe,0xff,0x88,0xd9,0xff,0xff,0x83,0xd7,0xfe,0xff,0x81,0xd7,0xfd,0xff,0x7b,0xd6,0xfd,0xff,0x74,0xd4,0xfe,0xff,0x70,0xd2,0xfd,0xff,0x67,0xd0,0xfd,0xff,0x63,0xce,0xfe,0xff,0x59,0xcc,0xfe,0xff,0x41,0xca,0xfc,0xff,0x34,0xc8,0xfc,0xff,0x28,0xc2,0xfd,0xff,0x19,0xbb,0xfc,0xff,0x13,0xb0,0xfc,0xff,0x11,0xa7,0xfa,0xff,0x10,0xa3,0xfa,0xff,0x12,0xa1,0xfa,0xff,0x13,0x9f,0xf8,0xff,0x13,0xa0,0xf9,0xff,0x12,0x9f,0xfa,0xff,0x12,0x9c,0xf9,0xff,0x11,0x95,0xf7,0xff,0x0e,0x8b,0xf6,0xff,0x0d,0x85,0xf5,0xff,0x0e,0x82,0xf5,0xff,0x0f,0x7f,0xf5,0xff,0x0f,0x7d,0xf3,0xff,0x0f,0x79,0xf1,0xff,0x10,0x73,0xee,0xff,0x0d,0x6b,0xe8,0xff,0x0e,0x65,0xe6,0xff,0x0e,0x60,0xe2,0xff,0x0e,0x5c,0xdf,0xff,0x0e,0x59,0xdc,0xff,0x0f,0x58,0xda,0xff,0x0e,0x55,0xd8,0xff,0x0d,0x4f,0xc9,0xff,0x0e,0x49,0xbd,0xff,0x0d,0x45,0xb8,0xff,0x0d,0x43,0xb3,0xff,0x07,0x3c,0xac,0xff,0x0a,0x3c,0xa9,0xff,0x7a,0x94,0xcd,0xcf,0xf9,0xfa,0xfc,0x17,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xb7,0xdb,0xfe,0x86,0x27,0x8f,0xf8,0xff,0x09,0x7f,0xf5,0xff,0x0d,0x98,0xfe,0xff,0x0e,0xae,0xff,0xff,0x12,0xb9,0xfb,0xff,0x1d,0xbe,0xf8,0xff,0x12,0xb5,0xfa,0xff,0x0f,0xaf,0xfe,0xff,0x0f,0xae,0xfe,0xff,0x10,0xad,0xfe,0xff,0x11,0xad,0xff,0xff,0x12,0xad,0xff,0xff,0x12,0xab,0xff,0xff,0x11,0xa8,0xfe,0xff,0x12,0xaf,0xfd,0xff,0x12,0xb7,0xfb,0xff,0x1d,0xbe,0xfb,0xff,0x26,0xc6,0xfe,0xff,0x22,0xc3,0xfe,0xff,0x1f,0xc0,0xfe,0xff,0x1a,0xbf,0xfd,0xff,0x16,0xbd,0xfd,0xff,0x15,0xbb,0xff,0xff,0x13,0xba,0xff,0xff,0x12,0xb8,0xff,0xff,0x13,0xb7,0xff,0xff,0x13,0xb7,0xff,0xff,0x12,0xb7,0xff,0xff,0x11,0xb7,0xff,0xff,0x15,0xbb,0xfd,0xff,0x25,0xc5,0xfc,0xff,0x3c,0xc9,0xfa,0xff,0x51,0xcc,0xfd,0xff,0x5b,0xcf,0xfe,0xff,0x64,0xd1,0xfe,0xff,0x6d,0xd2,0xfe,0xff,0x77,0xd5,0xfd,0xff,0x77,0xd5,0xfe,0xff,0x76,0xd5,0xfe,0xff,0x73,0xd4,0xff,0xff,0x6e,0xd3,0xfe,0xff,0x68,0xd3,0xfe,0xff,0x65,0xd1,0xfc,0xff,0x68,0xd1,0xfd,0xff,0x6d,0xd1,0xfd,0xff,0x70,0xd2,0xfe,0xff,0x72,0xd3,0xfd,0xff,0x75,0xd4,0xfd,0xff,0x7b,0xd5,0xfe,0xff,0x7f,0xd6,0xff,0xff,0x81,0xd6,0xff,0xff,0x83,0xd7,0xff,0xff,0x85,0xd8,0xfe,0xff,0x87,0xd9,0xfe,0xff,0x89,0xd9,0xfe,0xff,0x8a,0xda,0xfe,0xff,0x8b,0xd9,0xfe,0xff,0x8a,0xd9,0xff,0xff,0x87,0xd8,0xfe,0xff,0x84,0xd8,0xfd,0xff,0x7e,0xd8,0xfd,0xff,0x7b,0xd6,0xfe,0xff,0x7a,0xd4,0xfe,0xff,0x71,0xd2,0xfd,0xff,0x6c,0xd1,0xfc,0xff,0x67,0xcf,0xfd,0xff,0x58,0xcc,0xfc,0xff,0x3d,0xc5,0xfc,0xff,0x17,0xb8,0xfb,0xff,0x0d,0xb0,0xfd,0xff,0x0e,0xa8,0xfc,0xff,0x0e,0xa0,0xfc,0xff,0x0c,0x9c,0xfc,0xff,0x10,0x98,0xfd,0xff,0x10,0x93,0xfa,0xff,0x0e,0x8f,0xfa,0xff,0x0f,0x8c,0xfa,0xff,0x0d,0x86,0xf7,0xff,0x10,0x81,0xf5,0xff,0x10,0x7c,0xf3,0xff,0x0e,0x79,0xf1,0xff,0x0f,0x78,0xf1,0xff,0x10,0x75,0xf0,0xff,0x0f,0x72,0xed,0xff,0x11,0x6e,0xec,0xff,0x10,0x66,0xe6,0xff,0x0d,0x5c,0xe3,0xff,0x0b,0x59,0xe0,0xff,0x0d,0x5c,0xdc,0xff,0x0f,0x59,0xdc,0xff,0x10,0x55,0xd8,0xff,0x0e,0x51,0xd1,0xff,0x0d,0x4c,0xca,0xff,0x0c,0x47,0xbe,0xff,0x0c,0x44,0xb7,0xff,0x08,0x40,0xb3,0xff,0x0b,0x40,0xaf,0xff,0x0b,0x3e,0xaa,0xff,0x08,0x38,0xa2,0xff,0x06,0x34,0x98,0xff,0x77,0x8e,0xc3,0xcf,0xf8,0xf9,0xfc,0x18,0xff,0xff,0xff,0x00,0xfe,0xfa,0xfc,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xb9,0xe0,0xff,0x87,0x22,0x99,0xfc,0xff,0x07,0x8a,0xf9,0xff,0x10,0x90,0xf8,0xff,0x11,0xa2,0xfe,0xff,0x0f,0xb5,0xff,0xff,0x16,0xbd,0xfc,0xff,0x2b,0xc4,0xf7,0xff,0x1c,0xbb,0xf9,0xff,0x10,0xb4,0xfe,0xff,0x11,0xb4,0xfd,0xff,0x12,0xb6,0xff,0xff,0x12,0xb5,0xfe,0xff,0x11,0xb5,0xfe,0xff,0x0e,0xb5,0xff,0xff,0x0d,0xb3,0xff,0xff,0x14,0xb9,0xfd,0xff,0x1a,0xbf,0xfb,0xff,0x2e,0xc6,0xfe,0xff,0x39,0xc8,0xff,0xff,0x32,0xc6,0xff,0xff,0x2b,0xc5,0xff,0xff,0x22,0xc3,0xff,0xff,0x18,0xbf,0xfe,0xff,0x14,0xbb,0xfe,0xff,0x11,0xb9,0xfe,0xff,0x11,0xb7,0xff,0xff,0x12,0xb6,0xff,0xff,0x12,0xb6,0xff,0xff,0x10,0xb5,0xff,0xff,0x10,0xb5,0xfd,0xff,0x19,0xbd,0xfe,0xff,0x2d,0xc7,0xfe,0xff,0x50,0xcb,0xfd,0xff,0x62,0xcf,0xfe,0xff,0x66,0xd0,0xff,0xff,0x66,0xd0,0xfe,0xff,0x6e,0xd2,0xfe,0xff,0x7b,0xd5,0xfe,0xff,0x82,0xd6,0xff,0xff,0x81,0xd7,0xff,0xff,0x7d,0xd6,0xff,0xff,0x79,0xd6,0xff,0xff,0x77,0xd5,0xfe,0xff,0x73,0xd4,0xfe,0xff,0x6f,0xd1,0xfd,0xff,0x71,0xd1,0xfd,0xff,0x73,0xd3,0xfd,0xff,0x72,0xd4,0xfd,0xff,0x78,0xd6,0xfd,0xff,0x80,0xd7,0xff,0xff,0x82,0xd7,0xff,0xff,0x83,0xd8,0xfe,0xff,0x84,0xd8,0xfe,0xff,0x86,0xd7,0xfe,0xff,0x88,0xd9,0xfe,0xff,0x8b,0xda,0xfe,0xff,0x8e,0xdb,0xfe,0xff,0x8f,0xda,0xfe,0xff,0x8e,0xda,0xff,0xff,0x8b,0xd9,0xfe,0xff,0x88,0xd8,0xfe,0xff,0x85,0xd8,0xfd,0xff,0x83,0xd7,0xfe,0xff,0x7f,0xd5,0xfe,0xff,0x75,0xd4,0xfe,0xff,0x71,0xd3,0xfc,0xff,0x6f,0xd2,0xfd,0xff,0x63,0xce,0xfe,0xff,0x46,0xc9,0xfe,0xff,0x22,0xbc,0xfd,0xff,0x0f,0xb0,0xfc,0xff,0x0f,0xa9,0xfd,0xff,0x0f,0xa4,0xfd,0xff,0x0e,0x9f,0xfe,0xff,0x12,0x98,0xfe,0xff,0x11,0x8f,0xf9,0xff,0x0d,0x85,0xf7,0xff,0x0e,0x7d,0xf4,0xff,0x0e,0x77,0xf1,0xff,0x0e,0x73,0xef,0xff,0x0d,0x72,0xef,0xff,0x0e,0x72,0xef,0xff,0x10,0x72,0xee,0xff,0x11,0x6f,0xec,0xff,0x0f,0x6a,0xe7,0xff,0x0e,0x64,0xe3,0xff,0x0a,0x5a,0xdd,0xff,0x18,0x6a,0xdc,0xff,0x1a,0x6a,0xdc,0xff,0x0d,0x55,0xd6,0xff,0x0f,0x52,0xd0,0xff,0x0d,0x4d,0xca,0xff,0x0d,0x48,0xc1,0xff,0x0d,0x45,0xbc,0xff,0x0c,0x42,0xb7,0xff,0x0c,0x4a,0xbf,0xff,0x10,0x4f,0xc3,0xff,0x0e,0x41,0xac,0xff,0x0f,0x3b,0xa2,0xff,0x0c,0x38,0x9b,0xff,0x06,0x33,0x8d,0xff,0x0a,0x31,0x89,0xff,0x7a,0x8c,0xba,0xd1,0xfa,0xfa,0xfc,0x17,0xff,0xff,0xff,0x00,0xff,0xf9,0xfc,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf5,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xc1,0xe4,0xff,0x67,0x27,0xa6,0xff,0xff,0x08,0x94,0xfc,0xff,0x0c,0x8e,0xf4,0xff,0x0b,0x95,0xf7,0xff,0x12,0xa9,0xff,0xff,0x13,0xbc,0xfe,0xff,0x23,0xc2,0xfc,0xff,0x27,0xc2,0xfc,0xff,0x1c,0xbe,0xfd,0xff,0x0e,0xb9,0xfc,0xff,0x13,0xb9,0xfe,0xff,0x15,0xbc,0xfd,0xff,0x18,0xbe,0xfc,0xff,0x17,0xbe,0xfc,0xff,0x1f,0xbf,0xf9,0xff,0x30,0xc2,0xf9,0xff,0x1c,0xc0,0xfb,0xff,0x2d,0xc5,0xfc,0xff,0x44,0xc9,0xfe,0xff,0x44,0xc9,0xfd,0xff,0x39,0xc7,0xfe,0xff,0x2e,0xc4,0xfd,0xff,0x25,0xc2,0xfe,0xff,0x1b,0xc0,0xff,0xff,0x13,0xbb,0xfe,0xff,0x12,0xb9,0xff,0xff,0x12,0xb6,0xfe,0xff,0x10,0xb4,0xfe,0xff,0x0f,0xb4,0xfe,0xff,0x10,0xb4,0xfe,0xff,0x13,0xb9,0xfd,0xff,0x20,0xc3,0xfe,0xff,0x38,0xc9,0xfc,0xff,0x5f,0xcf,0xfe,0xff,0x6c,0xd1,0xfe,0xff,0x6c,0xd2,0xfe,0xff,0x6d,0xd2,0xfd,0xff,0x76,0xd4,0xfe,0xff,0x84,0xd7,0xfd,0xff,0x89,0xd9,0xfd,0xff,0x88,0xda,0xfe,0xff,0x86,0xd9,0xff,0xff,0x83,0xd8,0xfe,0xff,0x82,0xd7,0xfe,0xff,0x81,0xd8,0xfe,0xff,0x7d,0xd6,0xfe,0xff,0x79,0xd4,0xfd,0xff,0x74,0xd3,0xfd,0xff,0x73,0xd4,0xfc,0xff,0x7a,0xd6,0xfd,0xff,0x84,0xd7,0xfe,0xff,0x85,0xd8,0xfe,0xff,0x86,0xd8,0xfd,0xff,0x87,0xd8,0xfd,0xff,0x88,0xd8,0xfe,0xff,0x8b,0xda,0xfe,0xff,0x8e,0xdb,0xff,0xff,0x91,0xdb,0xff,0xff,0x92,0xdc,0xfe,0xff,0x93,0xdc,0xff,0xff,0x91,0xdb,0xff,0xff,0x8d,0xda,0xff,0xff,0x89,0xd9,0xfe,0xff,0x86,0xd7,0xfd,0xff,0x81,0xd5,0xff,0xff,0x77,0xd5,0xfe,0xff,0x74,0xd4,0xfc,0xff,0x76,0xd4,0xfd,0xff,0x65,0xd0,0xfe,0xff,0x4a,0xcb,0xfd,0xff,0x31,0xc4,0xfe,0xff,0x15,0xb7,0xfd,0xff,0x10,0xaf,0xff,0xff,0x0f,0xaa,0xfd,0xff,0x0e,0xa4,0xfd,0xff,0x0f,0x9a,0xfd,0xff,0x10,0x90,0xfa,0xff,0x10,0x84,0xf8,0xff,0x0d,0x76,0xf0,0xff,0x0d,0x6f,0xec,0xff,0x0c,0x69,0xe8,0xff,0x0d,0x6a,0xe9,0xff,0x10,0x6b,0xeb,0xff,0x11,0x69,0xea,0xff,0x0e,0x63,0xe5,0xff,0x0c,0x5e,0xde,0xff,0x0b,0x59,0xda,0xff,0x0b,0x55,0xd8,0xff,0x2d,0x7f,0xde,0xff,0x27,0x76,0xd7,0xff,0x06,0x49,0xc5,0xff,0x0c,0x4a,0xc3,0xff,0x0c,0x47,0xbe,0xff,0x0d,0x46,0xb9,0xff,0x0c,0x43,0xb5,0xff,0x11,0x47,0xb7,0xff,0x0c,0x47,0xb6,0xff,0x0c,0x45,0xb2,0xff,0x0e,0x3b,0xa3,0xff,0x0d,0x38,0x97,0xff,0x0a,0x36,0x93,0xff,0x0b,0x34,0x8a,0xff,0x07,0x2d,0x7f,0xff,0x0a,0x29,0x78,0xff,0x81,0x90,0xb8,0xb9,0xfc,0xfc,0xfd,0x06,0xff,0xff,0xff,0x00,0xff,0xf8,0xfb,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xed,0xf3,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xd2,0xea,0xff,0x48,0x30,0xac,0xfe,0xf7,0x02,0xa2,0xfd,0xff,0x0f,0xa2,0xfe,0xff,0x0c,0x95,0xf7,0xff,0x0d,0x9e,0xfa,0xff,0x10,0xb3,0xff,0xff,0x14,0xbf,0xfc,0xff,0x32,0xc7,0xfc,0xff,0x3d,0xc7,0xfe,0xff,0x30,0xc4,0xfe,0xff,0x20,0xc0,0xfd,0xff,0x24,0xc1,0xff,0xff,0x2a,0xc3,0xfd,0xff,0x35,0xc7,0xfc,0xff,0x35,0xc7,0xfb,0xff,0x91,0xdc,0xf6,0xff,0xd5,0xf3,0xf9,0xff,0x5f,0xcf,0xf5,0xff,0x4b,0xca,0xfc,0xff,0x5b,0xce,0xfd,0xff,0x55,0xcb,0xfe,0xff,0x42,0xc8,0xfe,0xff,0x2f,0xc5,0xfe,0xff,0x25,0xc2,0xfe,0xff,0x1f,0xc2,0xff,0xff,0x17,0xbd,0xff,0xff,0x11,0xb8,0xff,0xff,0x11,0xb3,0xfe,0xff,0x11,0xb2,0xfe,0xff,0x11,0xb2,0xff,0xff,0x0f,0xb2,0xfd,0xff,0x17,0xbc,0xfe,0xff,0x2d,0xc3,0xfe,0xff,0x51,0xcd,0xfc,0xff,0x6e,0xd3,0xfc,0xff,0x70,0xd3,0xfd,0xff,0x72,0xd3,0xfe,0xff,0x7b,0xd5,0xfe,0xff,0x8b,0xd8,0xff,0xff,0x94,0xdb,0xfc,0xff,0x8e,0xdc,0xfc,0xff,0x8c,0xdc,0xfe,0xff,0x8e,0xdb,0xfe,0xff,0x8e,0xdb,0xfe,0xff,0x8f,0xd9,0xff,0xff,0x8e,0xda,0xff,0xff,0x89,0xd9,0xff,0xff,0x83,0xd8,0xfe,0xff,0x7b,0xd5,0xfd,0xff,0x79,0xd6,0xfe,0xff,0x7f,0xd7,0xff,0xff,0x86,0xd8,0xff,0xff,0x88,0xd9,0xfe,0xff,0x89,0xda,0xfe,0xff,0x89,0xda,0xfe,0xff,0x8a,0xda,0xff,0xff,0x8e,0xdc,0xfe,0xff,0x92,0xdd,0xff,0xff,0x94,0xdc,0xff,0xff,0x97,0xde,0xff,0xff,0x97,0xde,0xff,0xff,0x96,0xdd,0xff,0xff,0x93,0xdb,0xff,0xff,0x8d,0xda,0xfe,0xff,0x87,0xd8,0xfd,0xff,0x81,0xd6,0xfe,0xff,0x7b,0xd5,0xff,0xff,0x78,0xd4,0xfe,0xff,0x7a,0xd4,0xfe,0xff,0x69,0xd0,0xfe,0xff,0x4b,0xc9,0xfc,0xff,0x37,0xc6,0xfd,0xff,0x22,0xc0,0xfd,0xff,0x11,0xb7,0xfd,0xff,0x0e,0xb1,0xff,0xff,0x0e,0xa6,0xfd,0xff,0x0e,0x99,0xfc,0xff,0x0e,0x8f,0xfa,0xff,0x12,0x88,0xfa,0xff,0x0e,0x81,0xf6,0xff,0x0c,0x73,0xef,0xff,0x0d,0x60,0xe2,0xff,0x0c,0x5b,0xde,0xff,0x0c,0x5c,0xde,0xff,0x0c,0x5a,0xdd,0xff,0x0c,0x58,0xdb,0xff,0x0e,0x54,0xd8,0xff,0x0c,0x50,0xd5,0xff,0x0f,0x4f,0xd0,0xff,0x09,0x43,0xc9,0xff,0x03,0x3f,0xbe,0xff,0x08,0x42,0xbd,0xff,0x0a,0x40,0xba,0xff,0x0e,0x42,0xb3,0xff,0x0b,0x44,0xb5,0xff,0x0b,0x43,0xb3,0xff,0x0e,0x41,0xaf,0xff,0x0c,0x3e,0xa3,0xff,0x0c,0x39,0x9c,0xff,0x0d,0x34,0x95,0xff,0x0a,0x35,0x92,0xff,0x0c,0x34,0x91,0xff,0x0b,0x30,0x85,0xff,0x09,0x2c,0x78,0xff,0x04,0x22,0x6b,0xff,0x0c,0x28,0x6b,0xff,0x93,0xa0,0xbb,0x97,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf8,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf8,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xea,0xf2,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xe1,0xed,0xfe,0x3c,0x40,0xab,0xfc,0xf3,0x04,0xa6,0xfb,0xff,0x13,0xb1,0xfd,0xff,0x11,0xac,0xff,0xff,0x0b,0x9f,0xfc,0xff,0x0b,0xaa,0xfc,0xff,0x19,0xb8,0xf5,0xff,0x77,0xd8,0xf6,0xff,0x70,0xd1,0xf6,0xff,0x54,0xc6,0xfb,0xff,0x4d,0xcb,0xfd,0xff,0x46,0xcb,0xfd,0xff,0x44,0xca,0xfd,0xff,0x46,0xca,0xfd,0xff,0x4b,0xcb,0xfd,0xff,0x61,0xce,0xfc,0xff,0xe2,0xf6,0xfe,0xff,0xff,0xff,0xff,0xff,0xdc,0xf3,0xfc,0xff,0x70,0xd2,0xfb,0xff,0x5d,0xce,0xff,0xff,0x5e,0xce,0xff,0xff,0x4d,0xc9,0xfe,0xff,0x37,0xc5,0xfe,0xff,0x26,0xc3,0xfe,0xff,0x1d,0xc2,0xfe,0xff,0x11,0xbc,0xff,0xff,0x11,0xb9,0xfc,0xff,0x20,0xbd,0xfb,0xff,0x13,0xb3,0xfd,0xff,0x0f,0xb0,0xff,0xff,0x11,0xb5,0xff,0xff,0x1c,0xbf,0xfe,0xff,0x41,0xc7,0xfd,0xff,0x6c,0xd2,0xfe,0xff,0x7b,0xd3,0xff,0xff,0x77,0xd4,0xfe,0xff,0x7d,0xd5,0xff,0xff,0x8b,0xda,0xfe,0xff,0x98,0xdf,0xfe,0xff,0x9d,0xe0,0xfe,0xff,0x93,0xdd,0xfe,0xff,0x92,0xdd,0xff,0xff,0x96,0xdd,0xff,0xff,0x9a,0xde,0xff,0xff,0x9a,0xde,0xfe,0xff,0x98,0xdd,0xff,0xff,0x92,0xdc,0xff,0xff,0x8f,0xdc,0xff,0xff,0x8b,0xd9,0xfe,0xff,0x8c,0xd9,0xff,0xff,0x8d,0xdb,0xff,0xff,0x8c,0xdb,0xfe,0xff,0x8a,0xda,0xfe,0xff,0x8c,0xdb,0xfe,0xff,0x8e,0xdb,0xff,0xff,0x91,0xdc,0xff,0xff,0x93,0xde,0xfe,0xff,0x96,0xdd,0xfe,0xff,0x98,0xdd,0xfe,0xff,0x99,0xdd,0xfe,0xff,0x9a,0xde,0xfe,0xff,0x99,0xde,0xfe,0xff,0x96,0xdc,0xff,0xff,0x8f,0xdb,0xfe,0xff,0x86,0xd9,0xfc,0xff,0x84,0xd7,0xfe,0xff,0x7f,0xd7,0xff,0xff,0x7a,0xd4,0xfe,0xff,0x73,0xd2,0xfd,0xff,0x62,0xd0,0xff,0xff,0x47,0xc9,0xfe,0xff,0x36,0xc6,0xff,0xff,0x28,0xc4,0xfe,0xff,0x13,0xba,0xfb,0xff,0x17,0xb6,0xfa,0xff,0x10,0xa6,0xfd,0xff,0x0e,0x97,0xfa,0xff,0x0d,0x8c,0xf8,0xff,0x0e,0x8a,0xf9,0xff,0x0f,0x87,0xf9,0xff,0x0e,0x7b,0xf1,0xff,0x0f,0x75,0xed,0xff,0x0f,0x6c,0xe7,0xff,0x0c,0x5b,0xd9,0xff,0x0d,0x57,0xd8,0xff,0x0c,0x55,0xd7,0xff,0x12,0x65,0xde,0xff,0x16,0x74,0xea,0xff,0x0e,0x64,0xdf,0xff,0x0b,0x5a,0xd5,0xff,0x90,0xb8,0xe9,0xff,0x9b,0xbb,0xe4,0xff,0x12,0x4d,0xbd,0xff,0x0a,0x4b,0xc3,0xff,0x0f,0x44,0xb2,0xff,0x0d,0x3d,0xad,0xff,0x0e,0x3d,0xa8,0xff,0x0a,0x37,0x98,0xff,0x03,0x2c,0x97,0xff,0x03,0x2d,0x95,0xff,0x0a,0x33,0x91,0xff,0x09,0x30,0x8c,0xff,0x08,0x2f,0x82,0xff,0x0c,0x33,0x7f,0xff,0x13,0x38,0x83,0xff,0x06,0x29,0x79,0xff,0x11,0x2e,0x76,0xff,0xa5,0xb0,0xc5,0x8b,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf1,0xf6,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xff,0xf9,0xfc,0x00,0xff,0xff,0xff,0x00,0xf0,0xf3,0xfb,0x16,0x54,0x9a,0xf2,0xdc,0x05,0x97,0xfc,0xff,0x0d,0xb4,0xfb,0xff,0x10,0xb6,0xfc,0xff,0x10,0xaf,0xfd,0xff,0x0d,0xa4,0xfc,0xff,0x04,0xb0,0xfb,0xff,0x4b,0xca,0xf8,0xff,0xfa,0xfe,0xfd,0xff,0xfb,0xfd,0xfd,0xff,0xac,0xe0,0xf7,0xff,0x56,0xcb,0xf8,0xff,0x5b,0xce,0xfc,0xff,0x5d,0xce,0xfc,0xff,0x5c,0xce,0xfc,0xff,0x62,0xcd,0xfe,0xff,0x72,0xd3,0xfc,0xff,0xc2,0xeb,0xfd,0xff,0xee,0xf7,0xff,0xff,0xd9,0xf3,0xfd,0xff,0x78,0xd3,0xfc,0xff,0x60,0xce,0xff,0xff,0x5f,0xce,0xfe,0xff,0x51,0xcb,0xfd,0xff,0x3b,0xc7,0xfe,0xff,0x25,0xc3,0xfe,0xff,0x17,0xbe,0xff,0xff,0x0f,0xbb,0xff,0xff,0x12,0xba,0xfe,0xff,0x17,0xba,0xfd,0xff,0x10,0xb3,0xfe,0xff,0x0f,0xb1,0xfe,0xff,0x0f,0xb8,0xfe,0xff,0x26,0xc3,0xfc,0xff,0x67,0xd1,0xfc,0xff,0x7b,0xd5,0xfd,0xff,0x7e,0xd4,0xfe,0xff,0x7d,0xd6,0xff,0xff,0x89,0xda,0xfd,0xff,0x97,0xdc,0xfe,0xff,0x9b,0xdc,0xfe,0xff,0x99,0xdd,0xfd,0xff,0x98,0xdd,0xfd,0xff,0x9d,0xdf,0xfe,0xff,0xa2,0xdf,0xff,0xff,0xa3,0xe0,0xfe,0xff,0xa2,0xe0,0xfd,0xff,0x9e,0xdf,0xfe,0xff,0x99,0xdd,0xff,0xff,0x95,0xdd,0xfe,0xff,0x97,0xdd,0xfe,0xff,0x9c,0xdd,0xfe,0xff,0x9a,0xdd,0xfe,0xff,0x90,0xdd,0xff,0xff,0x8d,0xda,0xfe,0xff,0x8e,0xdb,0xff,0xff,0x91,0xdc,0xfe,0xff,0x95,0xdd,0xfe,0xff,0x98,0xdd,0xff,0xff,0x99,0xdd,0xff,0xff,0x9a,0xdd,0xff,0xff,0x9b,0xdd,0xfe,0xff,0x9c,0xdd,0xfe,0xff,0x9a,0xde,0xfe,0xff,0x98,0xdc,0xfe,0xff,0x92,0xdb,0xfd,0xff,0x8b,0xda,0xfc,0xff,0x87,0xd9,0xfd,0xff,0x84,0xd7,0xfe,0xff,0x7b,0xd4,0xfe,0xff,0x6b,0xd1,0xfd,0xff,0x53,0xcc,0xfd,0xff,0x3b,0xc7,0xfc,0xff,0x30,0xc5,0xfe,0xff,0x24,0xc4,0xfd,0xff,0x15,0xb9,0xfc,0xff,0x18,0xb6,0xfa,0xff,0x10,0xa9,0xfc,0xff,0x0f,0x99,0xfe,0xff,0x10,0x87,0xf7,0xff,0x0d,0x82,0xf3,0xff,0x24,0xa3,0xf9,0xff,0x16,0x8b,0xf3,0xff,0x09,0x73,0xeb,0xff,0x13,0x76,0xed,0xff,0x10,0x65,0xe3,0xff,0x0b,0x59,0xdb,0xff,0x0e,0x58,0xdc,0xff,0x10,0x64,0xdf,0xff,0x0c,0x6e,0xe3,0xff,0x16,0x75,0xe6,0xff,0xa0,0xcc,0xee,0xff,0xff,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0x70,0xa1,0xe4,0xff,0x02,0x4e,0xd1,0xff,0x0f,0x41,0xaf,0xff,0x0b,0x3d,0xad,0xff,0x0f,0x40,0xb1,0xff,0x09,0x52,0xc6,0xff,0x2a,0x73,0xce,0xff,0x51,0x9f,0xdf,0xff,0x1d,0x6f,0xcc,0xff,0x06,0x31,0x94,0xff,0x0a,0x37,0x96,0xff,0x14,0x44,0xaa,0xff,0x1c,0x59,0xba,0xff,0x13,0x44,0xaa,0xff,0x09,0x30,0x8f,0xff,0x1f,0x3d,0x89,0xff,0xc2,0xca,0xdf,0x5b,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xfe,0xed,0xf4,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfe,0xf5,0xf9,0x00,0xff,0xff,0xff,0x00,0xfd,0xff,0xff,0x07,0x75,0xa8,0xf1,0xbc,0x04,0x6d,0xed,0xff,0x10,0xa5,0xff,0xff,0x0d,0xb6,0xfd,0xff,0x0f,0xb7,0xfe,0xff,0x0f,0xaf,0xfe,0xff,0x0e,0xa5,0xfb,0xff,0x09,0xb3,0xfc,0xff,0x6f,0xd3,0xfb,0xff,0xfb,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,0xc3,0xeb,0xf8,0xff,0x5d,0xcc,0xf9,0xff,0x61,0xcf,0xfd,0xff,0x65,0xd0,0xfe,0xff,0x68,0xd1,0xfc,0xff,0x6f,0xd3,0xfb,0xff,0x7e,0xd7,0xfe,0xff,0x91,0xd9,0xfe,0xff,0xa0,0xde,0xfc,0xff,0x89,0xda,0xfc,0xff,0x6e,0xd1,0xfd,0xff,0x6a,0xcf,0xfe,0xff,0x61,0xce,0xff,0xff,0x4f,0xcc,0xfe,0xff,0x3a,0xc7,0xfe,0xff,0x24,0xc2,0xfe,0xff,0x15,0xbd,0xff,0xff,0x11,0xba,0xff,0xff,0x12,0xb9,0xff,0xff,0x11,0xb6,0xff,0xff,0x11,0xb2,0xff,0xff,0x10,0xb3,0xfe,0xff,0x0f,0xba,0xfe,0xff,0x3e,0xc6,0xfd,0xff,0x82,0xd7,0xfd,0xff,0x7f,0xd7,0xfc,0xff,0x7f,0xd5,0xfe,0xff,0x89,0xda,0xfe,0xff,0x96,0xde,0xfc,0xff,0x9d,0xde,0xfd,0xff,0x9c,0xde,0xff,0xff,0x9c,0xdd,0xfe,0xff,0xa5,0xdf,0xfe,0xff,0xab,0xe1,0xfe,0xff,0xad,0xe0,0xff,0xff,0xa9,0xe1,0xff,0xff,0xa4,0xe0,0xfe,0xff,0x9e,0xdf,0xfe,0xff,0x9d,0xde,0xfe,0xff,0x9d,0xdf,0xfe,0xff,0xa3,0xe0,0xfd,0xff,0xa7,0xdf,0xfc,0xff,0xa0,0xdf,0xfe,0xff,0x91,0xdc,0xff,0xff,0x8a,0xda,0xfe,0xff,0x8c,0xdc,0xfe,0xff,0x92,0xdd,0xfd,0xff,0x96,0xde,0xfd,0xff,0x99,0xdd,0xff,0xff,0x9c,0xdd,0xff,0xff,0x9e,0xdd,0xff,0xff,0x9e,0xdd,0xfe,0xff,0x9d,0xdd,0xfe,0xff,0x9b,0xde,0xfe,0xff,0x98,0xdc,0xfe,0xff,0x94,0xdc,0xfe,0xff,0x8e,0xdb,0xfd,0xff,0x88,0xd9,0xfc,0xff,0x86,0xd6,0xfd,0xff,0x7d,0xd5,0xfe,0xff,0x6c,0xd2,0xfd,0xff,0x4c,0xc9,0xfc,0xff,0x2d,0xc5,0xfb,0xff,0x28,0xc4,0xfe,0xff,0x1e,0xc2,0xfd,0xff,0x14,0xb9,0xfb,0xff,0x47,0xc4,0xf8,0xff,0x1f,0xb4,0xfb,0xff,0x0b,0x9c,0xfe,0xff,0x10,0x88,0xf7,0xff,0x0e,0x75,0xee,0xff,0x12,0x7f,0xf2,0xff,0x13,0x85,0xf8,0xff,0x0e,0x76,0xee,0xff,0x12,0x72,0xed,0xff,0x0f,0x6c,0xea,0xff,0x10,0x69,0xe9,0xff,0x0d,0x5f,0xe1,0xff,0x0d,0x57,0xd9,0xff,0x08,0x4d,0xd6,0xff,0x2e,0x78,0xe5,0xff,0xee,0xf9,0xfc,0xff,0xff,0xff,0xfb,0xff,0xff,0xff,0xff,0xff,0x86,0xc9,0xf6,0xff,0x00,0x47,0xcb,0xff,0x10,0x49,0xc5,0xff,0x13,0x5b,0xce,0xff,0x05,0x38,0xb1,0xff,0x12,0x6d,0xde,0xff,0x66,0xdd,0xff,0xff,0x91,0xf1,0xff,0xff,0x33,0xa9,0xef,0xff,0x07,0x3d,0xac,0xff,0x12,0x3d,0xa4,0xff,0x0c,0x31,0x95,0xff,0x09,0x29,0x89,0xff,0x0a,0x2d,0x82,0xff,0x0c,0x32,0x87,0xff,0x05,0x2c,0x87,0xff,0x35,0x52,0x95,0xf4,0xdb,0xe0,0xeb,0x3c,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf6,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf0,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0x9f,0xdb,0xff,0x86,0x0f,0x84,0xf5,0xff,0x0c,0x89,0xfa,0xff,0x14,0xb3,0xfe,0xff,0x11,0xba,0xfa,0xff,0x11,0xbc,0xfe,0xff,0x10,0xb0,0xfe,0xff,0x08,0xa6,0xfc,0xff,0x1c,0xb8,0xfa,0xff,0xa1,0xe3,0xfc,0xff,0xe4,0xf5,0xfe,0xff,0xb9,0xea,0xfd,0xff,0x72,0xd0,0xf7,0xff,0x65,0xcf,0xfe,0xff,0x68,0xcf,0xfd,0xff,0x6b,0xd1,0xfe,0xff,0x6f,0xd3,0xfe,0xff,0x75,0xd5,0xfe,0xff,0x83,0xd8,0xff,0xff,0x88,0xd8,0xff,0xff,0x82,0xd7,0xff,0xff,0x7c,0xd5,0xff,0xff,0x75,0xd3,0xfe,0xff,0x6d,0xd1,0xfd,0xff,0x61,0xcf,0xff,0xff,0x4d,0xcb,0xfe,0xff,0x39,0xc7,0xfd,0xff,0x23,0xc2,0xfe,0xff,0x14,0xbc,0xff,0xff,0x0f,0xb9,0xff,0xff,0x11,0xb7,0xff,0xff,0x11,0xb5,0xff,0xff,0x11,0xb1,0xfe,0xff,0x11,0xb5,0xff,0xff,0x17,0xbd,0xfd,0xff,0x52,0xcc,0xfd,0xff,0x7b,0xd6,0xfd,0xff,0x7d,0xd6,0xfd,0xff,0x84,0xd8,0xff,0xff,0x97,0xdc,0xff,0xff,0x9f,0xdf,0xfc,0xff,0xa1,0xe0,0xfc,0xff,0xa3,0xe1,0xfd,0xff,0xa6,0xe1,0xfc,0xff,0xb1,0xe2,0xfe,0xff,0xb4,0xe2,0xff,0xff,0xb2,0xe2,0xff,0xff,0xad,0xe2,0xff,0xff,0xa6,0xe0,0xfd,0xff,0xa2,0xdf,0xfc,0xff,0xa9,0xe1,0xfd,0xff,0xad,0xe2,0xff,0xff,0xae,0xe3,0xff,0xff,0xab,0xe2,0xfe,0xff,0x9c,0xe0,0xfe,0xff,0x88,0xd9,0xfe,0xff,0x8c,0xdb,0xff,0xff,0x94,0xdc,0xff,0xff,0x98,0xdd,0xff,0xff,0x99,0xde,0xfe,0xff,0x9b,0xdd,0xfe,0xff,0x9d,0xdd,0xfe,0xff,0xa0,0xde,0xff,0xff,0x9f,0xde,0xff,0xff,0x9d,0xdd,0xfe,0xff,0x9a,0xdd,0xfe,0xff,0x97,0xdc,0xfe,0xff,0x95,0xdc,0xfe,0xff,0x8f,0xdb,0xfd,0xff,0x89,0xda,0xfd,0xff,0x88,0xd8,0xfe,0xff,0x7f,0xd5,0xfe,0xff,0x70,0xd3,0xfd,0xff,0x51,0xcb,0xfe,0xff,0x2c,0xc5,0xfc,0xff,0x29,0xc3,0xff,0xff,0x23,0xc2,0xfe,0xff,0x12,0xbc,0xf9,0xff,0x47,0xcb,0xf9,0xff,0x1e,0xb8,0xfc,0xff,0x0a,0x9f,0xfd,0xff,0x11,0x89,0xf8,0xff,0x10,0x74,0xf1,0xff,0x09,0x68,0xe8,0xff,0x17,0x7c,0xf4,0xff,0x1b,0x7f,0xf3,0xff,0x0d,0x6f,0xeb,0xff,0x0e,0x71,0xee,0xff,0x12,0x75,0xf2,0xff,0x12,0x73,0xf0,0xff,0x0e,0x61,0xe1,0xff,0x0c,0x4c,0xd1,0xff,0x0b,0x5d,0xdf,0xff,0x88,0xd3,0xfb,0xff,0xf3,0xfa,0xff,0xff,0xe9,0xf6,0xfb,0xff,0x83,0xdb,0xff,0xff,0x0c,0x7a,0xe9,0xff,0x06,0x53,0xd4,0xff,0x13,0x6a,0xe5,0xff,0x0d,0x4b,0xcc,0xff,0x0b,0x50,0xcb,0xff,0x15,0x8e,0xec,0xff,0x21,0xb2,0xff,0xff,0x10,0x8f,0xf3,0xff,0x06,0x48,0xc5,0xff,0x0b,0x3b,0xaa,0xff,0x0d,0x38,0x9d,0xff,0x0c,0x35,0x91,0xff,0x09,0x2f,0x8c,0xff,0x06,0x28,0x7f,0xff,0x07,0x28,0x73,0xff,0x00,0x1f,0x6c,0xff,0x56,0x6c,0x9e,0xd4,0xf5,0xf6,0xf9,0x12,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xeb,0xf3,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xc9,0xef,0xff,0x56,0x26,0xb6,0xfe,0xff,0x05,0x92,0xfa,0xff,0x0e,0xa0,0xfd,0xff,0x1f,0xbe,0xfd,0xff,0x31,0xc5,0xfb,0xff,0x25,0xc2,0xfd,0xff,0x0e,0xb9,0xfd,0xff,0x06,0xb0,0xfd,0xff,0x40,0xc7,0xfa,0xff,0xb4,0xe8,0xfd,0xff,0xc8,0xeb,0xfe,0xff,0x8b,0xd7,0xfb,0xff,0x69,0xcf,0xfc,0xff,0x6e,0xd1,0xfd,0xff,0x6e,0xd1,0xfd,0xff,0x70,0xd3,0xfe,0xff,0x75,0xd4,0xfe,0xff,0x7b,0xd6,0xfe,0xff,0x83,0xd7,0xfe,0xff,0x83,0xd8,0xfe,0xff,0x7e,0xd8,0xfe,0xff,0x7a,0xd5,0xfe,0xff,0x75,0xd3,0xfd,0xff,0x6c,0xd0,0xfe,0xff,0x5d,0xce,0xff,0xff,0x4a,0xca,0xfd,0xff,0x38,0xc8,0xfc,0xff,0x20,0xc3,0xfd,0xff,0x10,0xbc,0xfe,0xff,0x11,0xb9,0xfd,0xff,0x12,0xb7,0xfe,0xff,0x12,0xb4,0xfe,0xff,0x13,0xb2,0xff,0xff,0x0e,0xb7,0xfe,0xff,0x26,0xc1,0xfb,0xff,0x67,0xd2,0xfd,0xff,0x79,0xd6,0xfe,0xff,0x80,0xd6,0xff,0xff,0x8e,0xda,0xfe,0xff,0x9d,0xdf,0xfd,0xff,0xa3,0xe0,0xfd,0xff,0xa7,0xe1,0xfc,0xff,0xb1,0xe5,0xfd,0xff,0xb6,0xe6,0xfe,0xff,0xb8,0xe5,0xff,0xff,0xb7,0xe3,0xff,0xff,0xb4,0xe3,0xff,0xff,0xad,0xe2,0xff,0xff,0xaa,0xe1,0xfd,0xff,0xad,0xe5,0xfd,0xff,0xb3,0xe6,0xfe,0xff,0xb6,0xe5,0xff,0xff,0xb4,0xe4,0xff,0xff,0xa4,0xe0,0xff,0xff,0x90,0xda,0xfb,0xff,0x8c,0xd9,0xfc,0xff,0x99,0xde,0xff,0xff,0xa0,0xde,0xff,0xff,0x9d,0xdd,0xfe,0xff,0x9b,0xdd,0xfe,0xff,0x9c,0xdd,0xfe,0xff,0x9b,0xdd,0xff,0xff,0x9b,0xdd,0xff,0xff,0x9d,0xde,0xff,0xff,0x9e,0xdf,0xfd,0xff,0x97,0xdc,0xfc,0xff,0x96,0xdd,0xff,0xff,0x96,0xdd,0xff,0xff,0x92,0xdc,0xfd,0xff,0x8d,0xda,0xfe,0xff,0x89,0xd8,0xfe,0xff,0x81,0xd6,0xff,0xff,0x6f,0xd3,0xfd,0xff,0x51,0xcc,0xfd,0xff,0x32,0xc4,0xf9,0xff,0x2b,0xc4,0xfd,0xff,0x27,0xc4,0xfe,0xff,0x16,0xbe,0xfc,0xff,0x07,0xb8,0xfd,0xff,0x0c,0xb2,0xfc,0xff,0x0e,0xa3,0xfb,0xff,0x0f,0x8a,0xf6,0xff,0x0d,0x75,0xf0,0xff,0x0c,0x64,0xe5,0xff,0x10,0x64,0xe2,0xff,0x0e,0x67,0xe4,0xff,0x0f,0x71,0xed,0xff,0x0d,0x76,0xf0,0xff,0x0c,0x76,0xef,0xff,0x0e,0x7a,0xf2,0xff,0x0d,0x78,0xef,0xff,0x0b,0x69,0xe1,0xff,0x04,0x6d,0xe4,0xff,0x3f,0xbb,0xf9,0xff,0xce,0xef,0xfe,0xff,0xda,0xef,0xfb,0xff,0x8e,0xe0,0xff,0xff,0x15,0xa0,0xfa,0xff,0x07,0x56,0xd5,0xff,0x08,0x52,0xd3,0xff,0x0d,0x53,0xd2,0xff,0x0b,0x43,0xbd,0xff,0x0a,0x48,0xc9,0xff,0x0d,0x87,0xf9,0xff,0x0e,0x95,0xff,0xff,0x0a,0x62,0xdc,0xff,0x09,0x3f,0xb3,0xff,0x0e,0x3f,0xab,0xff,0x08,0x36,0x9c,0xff,0x14,0x4a,0xa4,0xff,0x1b,0x57,0xb1,0xff,0x0c,0x2f,0x8b,0xff,0x08,0x26,0x6f,0xff,0x03,0x24,0x6b,0xff,0x82,0x91,0xb5,0xac,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf2,0xf7,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xff,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xf2,0xfb,0xfd,0x25,0x58,0xd1,0xfa,0xe7,0x10,0xb8,0xfd,0xff,0x0b,0x9c,0xf9,0xff,0x12,0xaa,0xfd,0xff,0x35,0xc7,0xfe,0xff,0x53,0xca,0xfb,0xff,0x82,0xd6,0xfa,0xff,0x51,0xce,0xf9,0xff,0x18,0xbe,0xf9,0xff,0x7d,0xd6,0xfd,0xff,0xc2,0xe9,0xff,0xff,0xab,0xe0,0xfd,0xff,0x73,0xd1,0xfb,0xff,0x6d,0xd2,0xfd,0xff,0x70,0xd3,0xfd,0xff,0x72,0xd2,0xfe,0xff,0x74,0xd4,0xff,0xff,0x78,0xd6,0xff,0xff,0x7d,0xd7,0xff,0xff,0x81,0xd7,0xfe,0xff,0x81,0xd8,0xff,0xff,0x7c,0xd7,0xff,0xff,0x78,0xd4,0xfe,0xff,0x73,0xd2,0xfe,0xff,0x69,0xd0,0xff,0xff,0x59,0xcd,0xfe,0xff,0x4a,0xca,0xfe,0xff,0x37,0xc6,0xfc,0xff,0x1f,0xc2,0xfc,0xff,0x11,0xbd,0xfe,0xff,0x13,0xb8,0xfd,0xff,0x12,0xb6,0xfe,0xff,0x12,0xb4,0xfe,0xff,0x12,0xb3,0xff,0xff,0x0e,0xb9,0xfc,0xff,0x34,0xc7,0xfd,0xff,0x66,0xd1,0xfe,0xff,0x73,0xd5,0xfd,0xff,0x86,0xd7,0xff,0xff,0x97,0xdc,0xff,0xff,0x9f,0xde,0xfc,0xff,0xa1,0xdf,0xfe,0xff,0xa8,0xe0,0xfe,0xff,0xb1,0xe3,0xfe,0xff,0xb8,0xe5,0xfe,0xff,0xba,0xe5,0xff,0xff,0xb6,0xe5,0xff,0xff,0xb2,0xe4,0xff,0xff,0xaf,0xe4,0xfd,0xff,0xb4,0xe6,0xfe,0xff,0xbb,0xe8,0xfe,0xff,0xbb,0xe6,0xfe,0xff,0xb9,0xe8,0xff,0xff,0xaf,0xe4,0xff,0xff,0x92,0xd9,0xfd,0xff,0x95,0xda,0xfc,0xff,0xa8,0xe2,0xfe,0xff,0xaa,0xe2,0xff,0xff,0xa7,0xe0,0xfe,0xff,0x9e,0xde,0xff,0xff,0x9b,0xdd,0xfe,0xff,0x9b,0xdd,0xfe,0xff,0x99,0xdd,0xff,0xff,0x98,0xdd,0xfe,0xff,0x99,0xdd,0xfe,0xff,0x93,0xdd,0xfd,0xff,0x8b,0xdb,0xfa,0xff,0x91,0xdd,0xfe,0xff,0x96,0xdd,0xff,0xff,0x95,0xdc,0xfe,0xff,0x93,0xdb,0xff,0xff,0x8e,0xd9,0xfe,0xff,0x82,0xd6,0xfe,0xff,0x6c,0xd1,0xfd,0xff,0x5a,0xcc,0xfe,0xff,0x46,0xc8,0xfc,0xff,0x2d,0xc4,0xfc,0xff,0x28,0xc4,0xfd,0xff,0x20,0xc1,0xfe,0xff,0x13,0xbc,0xfe,0xff,0x10,0xb8,0xfe,0xff,0x0d,0xa7,0xfb,0xff,0x0e,0x8e,0xf7,0xff,0x0d,0x77,0xf0,0xff,0x0d,0x67,0xe7,0xff,0x0f,0x61,0xe2,0xff,0x0e,0x65,0xe4,0xff,0x0e,0x72,0xee,0xff,0x0e,0x77,0xf1,0xff,0x0d,0x7a,0xf0,0xff,0x0b,0x7f,0xf3,0xff,0x0e,0x86,0xf8,0xff,0x13,0x7f,0xf3,0xff,0x07,0x80,0xf2,0xff,0x33,0xb8,0xfd,0xff,0xb9,0xea,0xfc,0xff,0xdb,0xf0,0xfe,0xff,0x96,0xe0,0xff,0xff,0x22,0xb2,0xfa,0xff,0x06,0x5f,0xe0,0xff,0x0e,0x4c,0xcd,0xff,0x0c,0x4b,0xc9,0xff,0x0e,0x47,0xbc,0xff,0x0c,0x44,0xbe,0xff,0x0d,0x72,0xe7,0xff,0x11,0x94,0xff,0xff,0x0d,0x79,0xed,0xff,0x09,0x49,0xc1,0xff,0x0e,0x45,0xbc,0xff,0x08,0x40,0xb9,0xff,0x12,0x57,0xc2,0xff,0x13,0x5f,0xc5,0xff,0x10,0x45,0xaf,0xff,0x08,0x2d,0x80,0xff,0x05,0x23,0x6e,0xff,0x12,0x2c,0x72,0xff,0xb3,0xb9,0xd0,0x70,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xfe,0xec,0xf4,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xed,0xf8,0xfc,0xaf,0x55,0xcc,0xf6,0xff,0x19,0xbf,0xfe,0xff,0x0b,0xa1,0xf9,0xff,0x19,0xb3,0xfd,0xff,0x4b,0xcc,0xfc,0xff,0xa2,0xdf,0xf9,0xff,0xf9,0xfc,0xf9,0xff,0xc9,0xef,0xfa,0xff,0x60,0xcc,0xf9,0xff,0xab,0xe3,0xfe,0xff,0xc1,0xe8,0xff,0xff,0x8e,0xda,0xf9,0xff,0x6e,0xd1,0xfa,0xff,0x72,0xd3,0xff,0xff,0x73,0xd3,0xfd,0xff,0x76,0xd3,0xfe,0xff,0x79,0xd5,0xff,0xff,0x7d,0xd6,0xff,0xff,0x7f,0xd8,0xff,0xff,0x80,0xd7,0xfe,0xff,0x7f,0xd7,0xff,0xff,0x7c,0xd6,0xff,0xff,0x78,0xd2,0xfe,0xff,0x71,0xd0,0xfe,0xff,0x66,0xcf,0xff,0xff,0x59,0xcd,0xfe,0xff,0x4a,0xca,0xfe,0xff,0x35,0xc5,0xfe,0xff,0x1e,0xc1,0xfe,0xff,0x12,0xbc,0xff,0xff,0x14,0xb7,0xfe,0xff,0x11,0xb6,0xff,0xff,0x12,0xb4,0xfe,0xff,0x12,0xb4,0xfe,0xff,0x10,0xba,0xfd,0xff,0x3b,0xc8,0xfd,0xff,0x63,0xd0,0xfd,0xff,0x71,0xd4,0xfd,0xff,0x89,0xd8,0xff,0xff,0x9a,0xdd,0xff,0xff,0x9d,0xde,0xfd,0xff,0x9f,0xdf,0xfd,0xff,0xb4,0xe4,0xfa,0xff,0xcb,0xee,0xfb,0xff,0xc4,0xe8,0xfc,0xff,0xbb,0xe6,0xfe,0xff,0xb4,0xe5,0xfe,0xff,0xb4,0xe3,0xff,0xff,0xb8,0xe6,0xfd,0xff,0xbe,0xea,0xfd,0xff,0xd2,0xee,0xfc,0xff,0xe4,0xf3,0xfc,0xff,0xbe,0xe9,0xfa,0xff,0x9c,0xde,0xf9,0xff,0x9e,0xde,0xfd,0xff,0xab,0xe5,0xfe,0xff,0xb6,0xe4,0xff,0xff,0xaf,0xe3,0xff,0xff,0xa4,0xe0,0xfe,0xff,0x96,0xdd,0xfc,0xff,0x93,0xdc,0xfc,0xff,0x9a,0xdd,0xfe,0xff,0xa0,0xdf,0xfd,0xff,0xa2,0xe0,0xfd,0xff,0xaa,0xe3,0xfd,0xff,0xb9,0xe9,0xfb,0xff,0x99,0xdd,0xf9,0xff,0x89,0xdb,0xfc,0xff,0x96,0xdc,0xfe,0xff,0x98,0xdc,0xfe,0xff,0x99,0xdc,0xfe,0xff,0x93,0xda,0xff,0xff,0x93,0xdb,0xf8,0xff,0x9e,0xdf,0xf9,0xff,0x74,0xd3,0xfb,0xff,0x67,0xce,0xfd,0xff,0x4f,0xca,0xfe,0xff,0x36,0xc6,0xfe,0xff,0x28,0xc3,0xff,0xff,0x19,0xbd,0xfe,0xff,0x09,0xb8,0xfd,0xff,0x0c,0xad,0xfd,0xff,0x11,0x96,0xfc,0xff,0x0f,0x7e,0xf5,0xff,0x0f,0x70,0xee,0xff,0x0f,0x66,0xe7,0xff,0x0f,0x67,0xe7,0xff,0x0f,0x74,0xef,0xff,0x0c,0x7a,0xf3,0xff,0x0c,0x7c,0xf3,0xff,0x0c,0x7d,0xf5,0xff,0x0c,0x7d,0xf5,0xff,0x0f,0x71,0xef,0xff,0x07,0x63,0xe5,0xff,0x0d,0x91,0xf7,0xff,0x53,0xcd,0xfd,0xff,0x97,0xdc,0xff,0xff,0x60,0xd2,0xfe,0xff,0x15,0xa7,0xfa,0xff,0x06,0x6b,0xec,0xff,0x0c,0x55,0xd9,0xff,0x0f,0x54,0xd6,0xff,0x10,0x56,0xd6,0xff,0x0f,0x51,0xd3,0xff,0x0b,0x5d,0xde,0xff,0x12,0x89,0xfb,0xff,0x0e,0x87,0xf8,0xff,0x0c,0x5f,0xdd,0xff,0x07,0x4f,0xd6,0xff,0x04,0x49,0xc9,0xff,0x07,0x3c,0xb2,0xff,0x03,0x36,0xac,0xff,0x0c,0x43,0xb5,0xff,0x0c,0x38,0x9b,0xff,0x0b,0x2e,0x84,0xff,0x00,0x18,0x67,0xff,0x5f,0x75,0xa4,0xee,0xff,0xff,0xff,0x2e,0xff,0xff,0xff,0x00,0xfe,0xfa,0xfc,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf5,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xeb,0xf3,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x66,0xee,0xfa,0xfd,0xff,0x65,0xd0,0xf7,0xff,0x1f,0xbe,0xfd,0xff,0x0a,0xa8,0xfd,0xff,0x27,0xbc,0xfe,0xff,0x64,0xcf,0xfa,0xff,0xc8,0xee,0xfc,0xff,0xf2,0xfc,0xfc,0xff,0xc5,0xea,0xfc,0xff,0x90,0xda,0xfb,0xff,0xbc,0xe9,0xff,0xff,0xb3,0xe4,0xfe,0xff,0x82,0xd7,0xf9,0xff,0x77,0xd4,0xfc,0xff,0x7a,0xd5,0xfd,0xff,0x7a,0xd5,0xfd,0xff,0x7c,0xd6,0xfe,0xff,0x80,0xd7,0xff,0xff,0x81,0xd7,0xfe,0xff,0x82,0xd7,0xfd,0xff,0x80,0xd7,0xfd,0xff,0x7e,0xd6,0xfd,0xff,0x7b,0xd4,0xfd,0xff,0x75,0xd3,0xfe,0xff,0x6a,0xd0,0xfe,0xff,0x61,0xce,0xfe,0xff,0x58,0xcc,0xfd,0xff,0x45,0xc9,0xfd,0xff,0x2d,0xc3,0xfe,0xff,0x1c,0xc0,0xfe,0xff,0x12,0xba,0xff,0xff,0x11,0xb8,0xff,0xff,0x12,0xb7,0xff,0xff,0x10,0xb4,0xfe,0xff,0x0f,0xb5,0xfd,0xff,0x18,0xbe,0xff,0xff,0x3d,0xc8,0xfd,0xff,0x62,0xd0,0xfc,0xff,0x74,0xd5,0xfe,0xff,0x87,0xda,0xfe,0xff,0x92,0xdc,0xfe,0xff,0x96,0xdd,0xfd,0xff,0xa0,0xdf,0xfb,0xff,0xdb,0xf2,0xfa,0xff,0xff,0xff,0xff,0xff,0xea,0xf6,0xfd,0xff,0xbd,0xe6,0xfd,0xff,0xb3,0xe5,0xff,0xff,0xb7,0xe6,0xfe,0xff,0xc1,0xe9,0xfd,0xff,0xc7,0xeb,0xfd,0xff,0xe1,0xf2,0xfd,0xff,0xff,0xfe,0xff,0xff,0xbc,0xe8,0xf9,0xff,0x9f,0xe1,0xf9,0xff,0xb6,0xe7,0xfe,0xff,0xb9,0xe7,0xfd,0xff,0xb6,0xe5,0xfe,0xff,0xa8,0xe1,0xff,0xff,0x9b,0xdd,0xfe,0xff,0x92,0xdd,0xfb,0xff,0x9a,0xdf,0xfd,0xff,0xa5,0xe0,0xff,0xff,0xa6,0xe0,0xfe,0xff,0xa7,0xe1,0xfb,0xff,0xd6,0xf0,0xfd,0xff,0xff,0xff,0xff,0xff,0xd9,0xf3,0xfd,0xff,0x94,0xdd,0xf9,0xff,0x96,0xdd,0xfc,0xff,0x97,0xde,0xfd,0xff,0x95,0xdc,0xfe,0xff,0x8f,0xda,0xfd,0xff,0xc1,0xeb,0xfb,0xff,0xf3,0xfa,0xfc,0xff,0xa3,0xe0,0xf8,0xff,0x72,0xd2,0xfb,0xff,0x70,0xd0,0xff,0xff,0x55,0xce,0xfd,0xff,0x3b,0xc7,0xfd,0xff,0x25,0xc0,0xfd,0xff,0x36,0xc7,0xfc,0xff,0x22,0xba,0xfe,0xff,0x0d,0x9c,0xfc,0xff,0x0d,0x86,0xf5,0xff,0x11,0x81,0xf3,0xff,0x0f,0x7a,0xf1,0xff,0x0d,0x6e,0xeb,0xff,0x0e,0x76,0xef,0xff,0x0d,0x7c,0xf4,0xff,0x0a,0x7f,0xf3,0xff,0x0f,0x85,0xf8,0xff,0x11,0x88,0xfb,0xff,0x0f,0x85,0xf8,0xff,0x0d,0x6e,0xeb,0xff,0x0b,0x79,0xf0,0xff,0x0e,0xad,0xfd,0xff,0x33,0xc5,0xfb,0xff,0x1a,0xbf,0xf9,0xff,0x03,0xa6,0xf8,0xff,0x0b,0x8b,0xf6,0xff,0x0b,0x70,0xeb,0xff,0x0b,0x65,0xe5,0xff,0x0d,0x63,0xe5,0xff,0x0c,0x5d,0xe1,0xff,0x07,0x56,0xd8,0xff,0x0f,0x79,0xf0,0xff,0x0f,0x8b,0xfc,0xff,0x0b,0x79,0xf2,0xff,0x08,0x6c,0xe8,0xff,0x81,0xb0,0xe5,0xff,0xb1,0xc9,0xe7,0xff,0x25,0x64,0xc9,0xff,0x05,0x44,0xbe,0xff,0x0f,0x40,0xaf,0xff,0x09,0x36,0x9c,0xff,0x00,0x21,0x81,0xff,0x46,0x9d,0xd6,0xff,0xd1,0xf9,0xff,0xbb,0xff,0xff,0xff,0x04,0xff,0xff,0xff,0x00,0xfe,0xf2,0xf7,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xff,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xf1,0xfb,0xff,0x1f,0xdc,0xf2,0xfd,0xed,0xd1,0xef,0xfc,0xff,0x65,0xd1,0xf8,0xff,0x26,0xbe,0xfd,0xff,0x09,0xae,0xfc,0xff,0x37,0xc7,0xfd,0xff,0x70,0xd3,0xfe,0xff,0x8c,0xd9,0xfb,0xff,0x9e,0xe0,0xfb,0xff,0x8a,0xd8,0xfa,0xff,0x9f,0xdf,0xfd,0xff,0xb8,0xe8,0xfe,0xff,0x9f,0xdd,0xfa,0xff,0x81,0xd4,0xfb,0xff,0x7e,0xd6,0xfe,0xff,0x80,0xd7,0xfc,0xff,0x7f,0xd7,0xfd,0xff,0x7f,0xd6,0xfe,0xff,0x81,0xd8,0xfe,0xff,0x83,0xd8,0xfe,0xff,0x83,0xd7,0xfd,0xff,0x81,0xd7,0xfe,0xff,0x7d,0xd7,0xfd,0xff,0x79,0xd4,0xfd,0xff,0x72,0xd3,0xfe,0xff,0x68,0xd0,0xfe,0xff,0x5e,0xce,0xfe,0xff,0x54,0xcc,0xfe,0xff,0x40,0xc9,0xfd,0xff,0x28,0xc2,0xfe,0xff,0x18,0xbd,0xfe,0xff,0x12,0xb9,0xff,0xff,0x10,0xb5,0xfe,0xff,0x12,0xb5,0xff,0xff,0x10,0xb3,0xfd,0xff,0x12,0xb7,0xfd,0xff,0x24,0xc0,0xff,0xff,0x2e,0xc4,0xfe,0xff,0x53,0xcb,0xff,0xff,0x77,0xd5,0xff,0xff,0x82,0xd9,0xfd,0xff,0x8a,0xda,0xfd,0xff,0x95,0xdd,0xfd,0xff,0xab,0xe2,0xf9,0xff,0xf0,0xfa,0xfe,0xff,0xff,0xff,0xff,0xff,0xf5,0xfd,0xfd,0xff,0xbd,0xe9,0xfb,0xff,0xb1,0xe5,0xfe,0xff,0xbb,0xe8,0xfe,0xff,0xc4,0xea,0xfd,0xff,0xc5,0xeb,0xff,0xff,0xc6,0xea,0xfd,0xff,0xd0,0xec,0xfb,0xff,0xb9,0xe7,0xfa,0xff,0xbe,0xe6,0xff,0xff,0xc1,0xe8,0xfe,0xff,0xbb,0xe7,0xfd,0xff,0xae,0xe2,0xfd,0xff,0x9a,0xdc,0xfd,0xff,0x98,0xdb,0xfc,0xff,0xa4,0xe1,0xfe,0xff,0xab,0xe1,0xfe,0xff,0xa9,0xdf,0xfe,0xff,0xa1,0xdf,0xfd,0xff,0x9d,0xde,0xf6,0xff,0xe5,0xf6,0xfc,0xff,0xff,0xff,0xff,0xff,0xf6,0xfd,0xfe,0xff,0xa9,0xe3,0xf7,0xff,0x99,0xdd,0xfb,0xff,0x9a,0xde,0xfd,0xff,0x97,0xdd,0xfe,0xff,0x99,0xdb,0xfc,0xff,0xc3,0xea,0xfe,0xff,0xda,0xf2,0xfe,0xff,0xad,0xe4,0xfb,0xff,0x76,0xd5,0xfc,0xff,0x75,0xd3,0xfc,0xff,0x6c,0xd3,0xfb,0xff,0x58,0xcc,0xfe,0xff,0x3a,0xc5,0xfb,0xff,0x61,0xd4,0xf9,0xff,0x37,0xc2,0xfd,0xff,0x06,0xa5,0xfd,0xff,0x0b,0x94,0xf9,0xff,0x10,0x97,0xfa,0xff,0x15,0x98,0xfd,0xff,0x10,0x85,0xf4,0xff,0x0b,0x7a,0xef,0xff,0x11,0x7f,0xf5,0xff,0x0d,0x87,0xf5,0xff,0x0e,0x92,0xf9,0xff,0x11,0x95,0xfa,0xff,0x0f,0x93,0xfb,0xff,0x0e,0x88,0xf7,0xff,0x0d,0x7d,0xf0,0xff,0x09,0xa4,0xf9,0xff,0x34,0xc7,0xfb,0xff,0x4f,0xc9,0xfe,0xff,0x28,0xc1,0xf9,0xff,0x13,0xb2,0xfa,0xff,0x08,0x90,0xf5,0xff,0x0b,0x7e,0xf2,0xff,0x0f,0x7e,0xf4,0xff,0x0d,0x7c,0xf2,0xff,0x0c,0x77,0xef,0xff,0x0d,0x7c,0xf2,0xff,0x0f,0x86,0xf9,0xff,0x02,0x88,0xf9,0xff,0x39,0xab,0xf3,0xff,0xf0,0xfd,0xfd,0xff,0xff,0xff,0xfc,0xff,0xce,0xe6,0xf8,0xff,0x1d,0x66,0xd4,0xff,0x05,0x42,0xbd,0xff,0x0f,0x42,0xb1,0xff,0x04,0x32,0x9d,0xff,0x28,0x89,0xde,0xff,0x5d,0xc9,0xff,0xff,0xba,0xdf,0xfc,0x6d,0xff,0xff,0xff,0x00,0xff,0xfd,0xfd,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xef,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0x9f,0xdd,0xfe,0xa7,0xa7,0xe5,0xfd,0xff,0xcd,0xee,0xfd,0xff,0x78,0xd4,0xfa,0xff,0x27,0xbe,0xfe,0xff,0x0b,0xb3,0xfd,0xff,0x4c,0xcb,0xfe,0xff,0x7d,0xd6,0xff,0xff,0x85,0xd8,0xfe,0xff,0x80,0xd5,0xfc,0xff,0x85,0xd8,0xfa,0xff,0xa9,0xe2,0xff,0xff,0xb2,0xe2,0xfe,0xff,0x92,0xd8,0xfa,0xff,0x80,0xd7,0xfc,0xff,0x82,0xd7,0xfd,0xff,0x84,0xd6,0xfd,0xff,0x84,0xd7,0xfd,0xff,0x82,0xd7,0xfd,0xff,0x84,0xd8,0xfe,0xff,0x85,0xd7,0xfe,0xff,0x85,0xd8,0xfe,0xff,0x81,0xd8,0xff,0xff,0x7b,0xd6,0xfe,0xff,0x77,0xd3,0xfd,0xff,0x6f,0xd1,0xfe,0xff,0x66,0xcf,0xff,0xff,0x5b,0xcc,0xff,0xff,0x50,0xca,0xff,0xff,0x3b,0xc7,0xfd,0xff,0x23,0xc1,0xff,0xff,0x15,0xbb,0xfe,0xff,0x11,0xb6,0xfd,0xff,0x12,0xb4,0xfe,0xff,0x12,0xb3,0xfe,0xff,0x11,0xb2,0xfe,0xff,0x17,0xbb,0xff,0xff,0x19,0xbf,0xfd,0xff,0x1c,0xc0,0xfb,0xff,0x50,0xcb,0xfe,0xff,0x76,0xd4,0xff,0xff,0x81,0xd7,0xfe,0xff,0x89,0xd9,0xfe,0xff,0x95,0xdd,0xfe,0xff,0xb2,0xe7,0xfb,0xff,0xe9,0xf9,0xfd,0xff,0xf5,0xfb,0xfe,0xff,0xdc,0xf1,0xfc,0xff,0xbc,0xe7,0xfa,0xff,0xbd,0xe9,0xff,0xff,0xc2,0xe9,0xff,0xff,0xc5,0xea,0xff,0xff,0xb5,0xe6,0xfe,0xff,0x9a,0xde,0xf8,0xff,0xac,0xe3,0xf9,0xff,0xc0,0xea,0xfe,0xff,0xc2,0xe8,0xff,0xff,0xb9,0xe8,0xfe,0xff,0xa9,0xe2,0xfd,0xff,0x99,0xdd,0xfb,0xff,0x9b,0xdc,0xfb,0xff,0xa3,0xdf,0xff,0xff,0xa6,0xe1,0xfe,0xff,0xa2,0xe0,0xfc,0xff,0x9d,0xde,0xfd,0xff,0x99,0xde,0xfd,0xff,0x9b,0xdd,0xf9,0xff,0xd6,0xf1,0xfc,0xff,0xfc,0xfe,0xff,0xff,0xe1,0xf5,0xfd,0xff,0xa1,0xde,0xf9,0xff,0x9b,0xde,0xfc,0xff,0x9d,0xdd,0xfd,0xff,0x9b,0xdd,0xff,0xff,0x99,0xdd,0xfd,0xff,0xa0,0xdd,0xfc,0xff,0xa8,0xe0,0xfc,0xff,0x97,0xdc,0xf8,0xff,0x7f,0xd7,0xfd,0xff,0x77,0xd3,0xfe,0xff,0x73,0xd3,0xfb,0xff,0x6b,0xd0,0xfd,0xff,0x56,0xcc,0xfd,0xff,0x2c,0xc3,0xfb,0xff,0x14,0xb9,0xfc,0xff,0x0f,0xaf,0xfe,0xff,0x0d,0xa1,0xfd,0xff,0x0c,0x9c,0xfc,0xff,0x0d,0x9c,0xfd,0xff,0x14,0x98,0xfe,0xff,0x0e,0x84,0xf5,0xff,0x0f,0x83,0xf6,0xff,0x0d,0x91,0xfb,0xff,0x0d,0x9c,0xfd,0xff,0x0f,0xa1,0xfc,0xff,0x0f,0xa1,0xfd,0xff,0x0f,0xa2,0xfc,0xff,0x0b,0x9f,0xfb,0xff,0x14,0xb1,0xfd,0xff,0x5f,0xd0,0xfd,0xff,0x90,0xd9,0xfe,0xff,0x88,0xda,0xfc,0xff,0x57,0xcf,0xff,0xff,0x0c,0xa6,0xfc,0xff,0x0e,0x91,0xfb,0xff,0x0f,0x9b,0xfe,0xff,0x0c,0xa2,0xfe,0xff,0x0c,0x9c,0xfe,0xff,0x0a,0x96,0xf9,0xff,0x0d,0x95,0xfb,0xff,0x04,0x93,0xfa,0xff,0x33,0xb5,0xf8,0xff,0xdf,0xf6,0xfe,0xff,0xff,0xff,0xfb,0xff,0xc6,0xec,0xfb,0xff,0x17,0x73,0xe2,0xff,0x01,0x44,0xc3,0xff,0x0c,0x46,0xbd,0xff,0x08,0x3b,0xb3,0xff,0x06,0x64,0xdf,0xff,0x00,0x79,0xf4,0xff,0x35,0x7f,0xe8,0xec,0xea,0xf0,0xfb,0x23,0xff,0xff,0xff,0x00,0xff,0xf8,0xfa,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfc,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xff,0xfb,0xfc,0x00,0xff,0xff,0xff,0x00,0xc4,0xe1,0xfc,0x46,0x2f,0xab,0xf9,0xff,0x9e,0xe4,0xfe,0xff,0xd5,0xf1,0xff,0xff,0x8a,0xda,0xfc,0xff,0x26,0xbe,0xfc,0xff,0x10,0xb8,0xfd,0xff,0x5c,0xce,0xfe,0xff,0x83,0xd7,0xfd,0xff,0x88,0xd8,0xfb,0xff,0x85,0xd7,0xfc,0xff,0x91,0xdc,0xfc,0xff,0xac,0xe3,0xff,0xff,0xa7,0xde,0xfe,0xff,0x89,0xd8,0xfa,0xff,0x81,0xd7,0xfc,0xff,0x84,0xd7,0xfd,0xff,0x84,0xd7,0xfc,0xff,0x86,0xd8,0xfd,0xff,0x86,0xd8,0xfd,0xff,0x86,0xd8,0xfd,0xff,0x86,0xd8,0xfd,0xff,0x85,0xd8,0xfd,0xff,0x80,0xd7,0xfe,0xff,0x78,0xd5,0xfd,0xff,0x72,0xd3,0xfe,0xff,0x6b,0xd1,0xff,0xff,0x63,0xce,0xff,0xff,0x58,0xcc,0xfd,0xff,0x4a,0xc9,0xfd,0xff,0x34,0xc4,0xfc,0xff,0x1e,0xbe,0xff,0xff,0x12,0xb8,0xfe,0xff,0x11,0xb4,0xfd,0xff,0x11,0xb2,0xfd,0xff,0x0f,0xb2,0xff,0xff,0x12,0xb6,0xff,0xff,0x16,0xbb,0xff,0xff,0x0e,0xbb,0xfa,0xff,0x29,0xc3,0xfa,0xff,0x63,0xce,0xff,0xff,0x77,0xd5,0xff,0xff,0x7f,0xd8,0xfe,0xff,0x87,0xda,0xfe,0xff,0x9c,0xe0,0xfd,0xff,0xc3,0xed,0xfd,0xff,0xe7,0xf9,0xfd,0xff,0xe8,0xf6,0xfd,0xff,0xd1,0xeb,0xfe,0xff,0xc4,0xea,0xfe,0xff,0xc5,0xe9,0xfe,0xff,0xc4,0xea,0xff,0xff,0xb1,0xe7,0xfe,0xff,0x9b,0xdd,0xfa,0xff,0xad,0xe2,0xfd,0xff,0xc0,0xea,0xff,0xff,0xc2,0xe9,0xff,0xff,0xb8,0xe7,0xfe,0xff,0xa8,0xe1,0xfe,0xff,0x9a,0xdc,0xfd,0xff,0x98,0xde,0xfd,0xff,0xa5,0xe0,0xfe,0xff,0xa8,0xe1,0xff,0xff,0x9c,0xde,0xfd,0xff,0x92,0xdc,0xfc,0xff,0x8f,0xdb,0xfc,0xff,0x92,0xdb,0xfd,0xff,0x9a,0xdd,0xfb,0xff,0xc9,0xee,0xfe,0xff,0xf1,0xf7,0xfe,0xff,0xcd,0xec,0xfc,0xff,0x9b,0xdc,0xfc,0xff,0x9c,0xde,0xfc,0xff,0x9d,0xde,0xfc,0xff,0x9c,0xdd,0xfd,0xff,0x9c,0xdf,0xfc,0xff,0x9e,0xde,0xfc,0xff,0x9f,0xde,0xfd,0xff,0x9d,0xe0,0xfd,0xff,0x8c,0xda,0xfe,0xff,0x81,0xd6,0xff,0xff,0x7a,0xd4,0xfe,0xff,0x72,0xd2,0xfa,0xff,0x6b,0xcf,0xfc,0xff,0x47,0xc8,0xfe,0xff,0x14,0xbf,0xfc,0xff,0x0e,0xb4,0xfc,0xff,0x0e,0xaa,0xfd,0xff,0x0d,0xa1,0xfd,0xff,0x0d,0x9d,0xfe,0xff,0x0f,0x97,0xfc,0xff,0x0b,0x8b,0xf5,0xff,0x0d,0x8a,0xf8,0xff,0x0e,0x9a,0xfd,0xff,0x0b,0xa2,0xfb,0xff,0x0c,0xa8,0xfc,0xff,0x0b,0xaa,0xfd,0xff,0x0b,0xaf,0xfc,0xff,0x09,0xaf,0xfb,0xff,0x1a,0xb8,0xfd,0xff,0x65,0xcf,0xff,0xff,0x89,0xd9,0xfb,0xff,0x8f,0xda,0xfb,0xff,0x5c,0xcd,0xfb,0xff,0x06,0xad,0xf9,0xff,0x08,0x9f,0xfb,0xff,0x0d,0xab,0xfd,0xff,0x0a,0xb4,0xfb,0xff,0x07,0xb1,0xfa,0xff,0x07,0xa9,0xf9,0xff,0x0c,0xa6,0xfb,0xff,0x07,0xa5,0xfc,0xff,0x0d,0xb3,0xfb,0xff,0x76,0xd3,0xfa,0xff,0x87,0xdd,0xfb,0xff,0x1f,0xa9,0xf6,0xff,0x05,0x6a,0xea,0xff,0x08,0x48,0xc9,0xff,0x0c,0x50,0xd0,0xff,0x0d,0x58,0xd9,0xff,0x08,0x6c,0xea,0xff,0x0b,0x73,0xf0,0xff,0x00,0x54,0xda,0xff,0x7f,0xa7,0xea,0x9d,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xee,0xf4,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfb,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf1,0xf7,0x00,0xff,0xff,0xff,0x00,0xfb,0xff,0xff,0x09,0x57,0xb1,0xfa,0xce,0x0e,0x9c,0xf7,0xff,0x9c,0xe2,0xff,0xff,0xd9,0xef,0xff,0xff,0x9a,0xde,0xfc,0xff,0x24,0xbf,0xfc,0xff,0x19,0xba,0xfe,0xff,0x69,0xd0,0xfe,0xff,0x84,0xd8,0xfd,0xff,0x88,0xd9,0xfb,0xff,0x86,0xd8,0xfc,0xff,0x98,0xde,0xfe,0xff,0xa8,0xe3,0xff,0xff,0x9a,0xdb,0xfd,0xff,0x89,0xd9,0xfc,0xff,0x86,0xd9,0xfd,0xff,0x87,0xd8,0xfe,0xff,0x88,0xd8,0xfc,0xff,0x88,0xd9,0xfd,0xff,0x87,0xd9,0xfd,0xff,0x87,0xd9,0xfd,0xff,0x86,0xd9,0xfe,0xff,0x85,0xd8,0xfe,0xff,0x80,0xd7,0xff,0xff,0x78,0xd6,0xfe,0xff,0x70,0xd2,0xfd,0xff,0x69,0xd1,0xff,0xff,0x62,0xce,0xff,0xff,0x54,0xcb,0xff,0xff,0x3f,0xc8,0xfc,0xff,0x28,0xc4,0xfd,0xff,0x16,0xbc,0xff,0xff,0x10,0xb6,0xfe,0xff,0x11,0xb4,0xff,0xff,0x11,0xb3,0xff,0xff,0x0e,0xb3,0xfd,0xff,0x14,0xb9,0xff,0xff,0x12,0xb8,0xff,0xff,0x1e,0xbe,0xfd,0xff,0x54,0xcc,0xfe,0xff,0x75,0xd2,0xfe,0xff,0x79,0xd5,0xfe,0xff,0x7f,0xd8,0xfe,0xff,0x8a,0xda,0xfd,0xff,0xaa,0xe3,0xfd,0xff,0xd5,0xf1,0xff,0xff,0xed,0xf8,0xfd,0xff,0xe9,0xf5,0xfe,0xff,0xd4,0xed,0xfe,0xff,0xc9,0xec,0xfe,0xff,0xc6,0xeb,0xff,0xff,0xb1,0xe4,0xfe,0xff,0x99,0xdc,0xfb,0xff,0xa8,0xe1,0xfd,0xff,0xbe,0xea,0xfe,0xff,0xbf,0xe9,0xff,0xff,0xb6,0xe7,0xff,0xff,0xa0,0xe0,0xfb,0xff,0x99,0xdc,0xfe,0xff,0xa2,0xdf,0xff,0xff,0xac,0xe0,0xff,0xff,0xa9,0xe0,0xff,0xff,0x9e,0xe0,0xfe,0xff,0x92,0xdb,0xfe,0xff,0x85,0xd7,0xfc,0xff,0x83,0xd8,0xfd,0xff,0x89,0xd9,0xfe,0xff,0x9c,0xdd,0xfb,0xff,0xcb,0xef,0xfe,0xff,0xe8,0xf5,0xfe,0xff,0xd0,0xed,0xfe,0xff,0xa2,0xde,0xfd,0xff,0x9c,0xdf,0xfd,0xff,0x9c,0xdf,0xfc,0xff,0x9c,0xdf,0xfc,0xff,0x9e,0xdd,0xfd,0xff,0xa1,0xde,0xfc,0xff,0xa4,0xe0,0xfd,0xff,0xa4,0xe0,0xfe,0xff,0x9a,0xdc,0xfe,0xff,0x8f,0xd9,0xfe,0xff,0x84,0xd7,0xfe,0xff,0x76,0xd3,0xfd,0xff,0x71,0xd1,0xfd,0xff,0x64,0xce,0xff,0xff,0x41,0xc8,0xfe,0xff,0x1c,0xbe,0xfb,0xff,0x0e,0xaf,0xfa,0xff,0x0e,0xa4,0xfc,0xff,0x0f,0x9f,0xfe,0xff,0x0e,0x9b,0xfb,0xff,0x0d,0x98,0xfb,0xff,0x0f,0x96,0xfc,0xff,0x0f,0x9d,0xfe,0xff,0x0d,0xa7,0xfc,0xff,0x0c,0xac,0xfa,0xff,0x10,0xb2,0xfc,0xff,0x12,0xb8,0xfb,0xff,0x0e,0xb6,0xfb,0xff,0x0c,0xb2,0xfc,0xff,0x37,0xc3,0xfd,0xff,0x6f,0xd2,0xfb,0xff,0x7d,0xd3,0xfe,0xff,0x60,0xcf,0xfd,0xff,0x2e,0xc1,0xfa,0xff,0x0a,0xb6,0xfb,0xff,0x13,0xba,0xfa,0xff,0x32,0xc4,0xfd,0xff,0x3a,0xc5,0xfd,0xff,0x20,0xbe,0xfc,0xff,0x0a,0xb7,0xf9,0xff,0x0e,0xb6,0xfa,0xff,0x14,0xbc,0xfc,0xff,0x2d,0xc1,0xfd,0xff,0x16,0xbb,0xfa,0xff,0x03,0xa7,0xfb,0xff,0x0d,0x8b,0xf6,0xff,0x08,0x5c,0xdd,0xff,0x0a,0x5c,0xdf,0xff,0x08,0x66,0xe7,0xff,0x08,0x6f,0xed,0xff,0x0b,0x6c,0xe9,0xff,0x02,0x51,0xd6,0xff,0x1b,0x64,0xdd,0xff,0xd0,0xe1,0xfa,0x47,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfc,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfb,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf2,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xb6,0xe6,0xff,0x66,0x0e,0x95,0xfa,0xff,0x0f,0x9b,0xf7,0xff,0x7f,0xdb,0xfe,0xff,0xcc,0xeb,0xfe,0xff,0xae,0xe4,0xfe,0xff,0x32,0xc0,0xfd,0xff,0x1f,0xbd,0xfe,0xff,0x70,0xd1,0xff,0xff,0x89,0xd9,0xfe,0xff,0x89,0xda,0xfc,0xff,0x88,0xd9,0xfc,0xff,0x98,0xdd,0xfe,0xff,0x9e,0xdf,0xfd,0xff,0x91,0xda,0xfe,0xff,0x8b,0xda,0xfe,0xff,0x8a,0xda,0xfe,0xff,0x8a,0xda,0xff,0xff,0x8b,0xda,0xfe,0xff,0x89,0xda,0xfc,0xff,0x89,0xd9,0xfc,0xff,0x89,0xda,0xfd,0xff,0x88,0xd9,0xfe,0xff,0x86,0xd7,0xfe,0xff,0x81,0xd7,0xff,0xff,0x77,0xd5,0xfe,0xff,0x6e,0xd2,0xfd,0xff,0x68,0xd0,0xfd,0xff,0x5e,0xce,0xfe,0xff,0x4b,0xc8,0xff,0xff,0x35,0xc4,0xfd,0xff,0x21,0xc1,0xfe,0xff,0x14,0xb9,0xff,0xff,0x10,0xb5,0xff,0xff,0x10,0xb4,0xff,0xff,0x0f,0xb3,0xff,0xff,0x11,0xb4,0xff,0xff,0x12,0xb7,0xff,0xff,0x12,0xb9,0xfc,0xff,0x42,0xc8,0xfe,0xff,0x6d,0xd0,0xff,0xff,0x74,0xd3,0xff,0xff,0x7b,0xd6,0xff,0xff,0x87,0xda,0xfe,0xff,0x9a,0xdd,0xfe,0xff,0xb7,0xe7,0xfe,0xff,0xde,0xf4,0xff,0xff,0xee,0xf8,0xfe,0xff,0xe8,0xf5,0xff,0xff,0xd7,0xee,0xfe,0xff,0xc8,0xed,0xff,0xff,0xaf,0xe6,0xff,0xff,0x9a,0xdc,0xfa,0xff,0xa5,0xe1,0xfc,0xff,0xb6,0xe7,0xff,0xff,0xbd,0xe7,0xff,0xff,0xb1,0xe4,0xff,0xff,0x9e,0xe0,0xfb,0xff,0x9a,0xde,0xfb,0xff,0xa4,0xe0,0xfe,0xff,0xaa,0xe2,0xff,0xff,0xa7,0xe0,0xff,0xff,0x9b,0xdd,0xfd,0xff,0x8f,0xdc,0xfc,0xff,0x8d,0xda,0xfe,0xff,0x84,0xd7,0xfe,0xff,0x7e,0xd6,0xfe,0xff,0x82,0xd6,0xfe,0xff,0x9c,0xdc,0xfb,0xff,0xca,0xee,0xfc,0xff,0xe4,0xf3,0xfd,0xff,0xd1,0xed,0xfe,0xff,0xa6,0xe1,0xfd,0xff,0x9f,0xdf,0xfd,0xff,0xa4,0xdf,0xfe,0xff,0xa1,0xdd,0xfc,0xff,0x9f,0xdd,0xfc,0xff,0xa0,0xdd,0xfc,0xff,0xa2,0xdf,0xfc,0xff,0xa4,0xdf,0xfd,0xff,0x9e,0xdf,0xfe,0xff,0x92,0xdd,0xfd,0xff,0x84,0xd7,0xfe,0xff,0x76,0xd3,0xfd,0xff,0x6d,0xd1,0xfd,0xff,0x67,0xd0,0xfe,0xff,0x5c,0xcd,0xfe,0xff,0x31,0xc4,0xfe,0xff,0x0d,0xaf,0xfb,0xff,0x0d,0xa6,0xfb,0xff,0x0e,0xa7,0xff,0xff,0x0d,0xa9,0xfd,0xff,0x10,0xa9,0xfe,0xff,0x10,0xa4,0xfc,0xff,0x0e,0xa1,0xfb,0xff,0x0d,0xa7,0xfd,0xff,0x0c,0xad,0xfc,0xff,0x17,0xb9,0xfc,0xff,0x2f,0xc5,0xfd,0xff,0x30,0xc3,0xfd,0xff,0x0a,0xb4,0xfb,0xff,0x1d,0xbc,0xfa,0xff,0x6c,0xd2,0xfb,0xff,0x84,0xd5,0xfd,0xff,0x7f,0xd5,0xfd,0xff,0x69,0xd1,0xfd,0xff,0x3e,0xc7,0xfd,0xff,0x3a,0xc5,0xfb,0xff,0x55,0xca,0xfe,0xff,0x68,0xcf,0xfc,0xff,0x5a,0xce,0xfc,0xff,0x3f,0xc7,0xfd,0xff,0x34,0xc3,0xfa,0xff,0x30,0xc4,0xfb,0xff,0x23,0xc0,0xf9,0xff,0x14,0xbd,0xfc,0xff,0x0f,0xb8,0xfa,0xff,0x09,0xa9,0xfd,0xff,0x0d,0x7f,0xf3,0xff,0x0b,0x6d,0xeb,0xff,0x0a,0x6f,0xee,0xff,0x0c,0x70,0xf0,0xff,0x0a,0x65,0xe4,0xff,0x09,0x53,0xd6,0xff,0x00,0x52,0xdb,0xff,0x67,0xa2,0xf2,0xc0,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf0,0xf6,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfb,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf3,0xf8,0x00,0xff,0xff,0xff,0x00,0xf5,0xf9,0xff,0x0e,0x4c,0xb9,0xff,0xda,0x04,0x8f,0xfa,0xff,0x0a,0x94,0xf6,0xff,0x56,0xd0,0xfb,0xff,0xb7,0xe7,0xfc,0xff,0xb4,0xe3,0xfe,0xff,0x44,0xc5,0xfb,0xff,0x26,0xbf,0xfc,0xff,0x75,0xd3,0xfe,0xff,0x8a,0xd9,0xfe,0xff,0x89,0xd9,0xfd,0xff,0x89,0xda,0xfd,0xff,0x97,0xdc,0xfd,0xff,0x99,0xdc,0xfd,0xff,0x90,0xdb,0xfd,0xff,0x8e,0xdb,0xfe,0xff,0x8f,0xdb,0xfe,0xff,0x8e,0xdb,0xfe,0xff,0x8e,0xdb,0xfe,0xff,0x8c,0xda,0xfd,0xff,0x8b,0xd9,0xfd,0xff,0x8b,0xda,0xfd,0xff,0x8a,0xda,0xfd,0xff,0x88,0xd8,0xfe,0xff,0x80,0xd7,0xfe,0xff,0x77,0xd5,0xfe,0xff,0x6e,0xd1,0xfe,0xff,0x68,0xcf,0xfd,0xff,0x5a,0xcd,0xfd,0xff,0x3c,0xc7,0xfd,0xff,0x2b,0xc5,0xff,0xff,0x1c,0xbf,0xfe,0xff,0x12,0xb7,0xff,0xff,0x11,0xb4,0xff,0xff,0x10,0xb3,0xfd,0xff,0x10,0xb2,0xfe,0xff,0x11,0xb2,0xfe,0xff,0x0f,0xb2,0xfd,0xff,0x28,0xc1,0xfd,0xff,0x5a,0xd0,0xff,0xff,0x6b,0xcf,0xff,0xff,0x6f,0xd3,0xfe,0xff,0x83,0xd9,0xfe,0xff,0x94,0xdd,0xfe,0xff,0xa5,0xe1,0xfe,0xff,0xc1,0xec,0xfe,0xff,0xe3,0xf5,0xff,0xff,0xee,0xf8,0xfe,0xff,0xe6,0xf6,0xff,0xff,0xd6,0xee,0xff,0xff,0xb2,0xe5,0xfe,0xff,0x94,0xda,0xf8,0xff,0xa3,0xe1,0xfc,0xff,0xb4,0xe7,0xfe,0xff,0xb6,0xe7,0xfe,0xff,0xad,0xe2,0xff,0xff,0x9a,0xdb,0xfc,0xff,0x97,0xdd,0xfb,0xff,0xa6,0xe3,0xfe,0xff,0xa9,0xe3,0xff,0xff,0xa6,0xe0,0xff,0xff,0x98,0xde,0xfd,0xff,0x8e,0xda,0xfc,0xff,0x8b,0xd9,0xfd,0xff,0x8a,0xd9,0xff,0xff,0x81,0xd7,0xff,0xff,0x76,0xd5,0xfe,0xff,0x7a,0xd5,0xfe,0xff,0x9d,0xde,0xfb,0xff,0xca,0xec,0xfd,0xff,0xdd,0xf1,0xfd,0xff,0xd1,0xee,0xfe,0xff,0xaa,0xe1,0xfc,0xff,0x9f,0xde,0xfc,0xff,0xa6,0xdf,0xfe,0xff,0xa4,0xde,0xfe,0xff,0x9f,0xdf,0xfd,0xff,0xa0,0xdf,0xfc,0xff,0xa3,0xde,0xfd,0xff,0xa5,0xdf,0xfe,0xff,0x9e,0xde,0xfe,0xff,0x93,0xdd,0xff,0xff,0x86,0xd9,0xfe,0xff,0x7c,0xd5,0xfc,0xff,0x72,0xd4,0xfd,0xff,0x6c,0xd2,0xfb,0xff,0x64,0xd0,0xfe,0xff,0x2e,0xc5,0xfc,0xff,0x09,0xb1,0xfb,0xff,0x0c,0xa8,0xfb,0xff,0x0d,0xae,0xfe,0xff,0x0f,0xb4,0xfc,0xff,0x13,0xb6,0xfe,0xff,0x11,0xb2,0xfe,0xff,0x0b,0xa9,0xfc,0xff,0x0c,0xaa,0xfc,0xff,0x0f,0xb0,0xfb,0xff,0x17,0xbd,0xf9,0xff,0x42,0xc7,0xfa,0xff,0x55,0xcc,0xfc,0xff,0x2b,0xc0,0xfc,0xff,0x1a,0xbc,0xf8,0xff,0x6b,0xd1,0xfb,0xff,0x8e,0xd9,0xfd,0xff,0x8f,0xda,0xfb,0xff,0x85,0xd7,0xfc,0xff,0x69,0xcf,0xfd,0xff,0x55,0xc9,0xfb,0xff,0x5c,0xca,0xfe,0xff,0x6f,0xd0,0xfc,0xff,0x73,0xd2,0xfb,0xff,0x6b,0xcf,0xfc,0xff,0x5c,0xcc,0xfb,0xff,0x4d,0xc9,0xfb,0xff,0x42,0xc8,0xfa,0xff,0x32,0xc4,0xfd,0xff,0x1f,0xc1,0xfc,0xff,0x0b,0xb4,0xfd,0xff,0x0c,0x98,0xfb,0xff,0x0c,0x85,0xf5,0xff,0x0b,0x76,0xf1,0xff,0x0a,0x70,0xed,0xff,0x0a,0x69,0xe7,0xff,0x0e,0x5e,0xe0,0xff,0x05,0x57,0xdd,0xff,0x13,0x70,0xec,0xff,0xc1,0xdd,0xfe,0x52,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfe,0xe9,0xf2,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xa5,0xcb,0xf9,0x73,0x0e,0x95,0xfc,0xff,0x0d,0x8e,0xfa,0xff,0x09,0x8d,0xf7,0xff,0x47,0xc8,0xfd,0xff,0xaa,0xe5,0xfe,0xff,0xac,0xe2,0xfe,0xff,0x4d,0xcb,0xfc,0xff,0x30,0xc2,0xfb,0xff,0x79,0xd4,0xfe,0xff,0x89,0xd9,0xfe,0xff,0x86,0xd8,0xfc,0xff,0x8a,0xda,0xfd,0xff,0x96,0xdc,0xfd,0xff,0x99,0xdc,0xfd,0xff,0x94,0xdc,0xfd,0xff,0x93,0xdd,0xfe,0xff,0x93,0xdd,0xfe,0xff,0x94,0xdc,0xfe,0xff,0x93,0xdc,0xfd,0xff,0x92,0xdb,0xfe,0xff,0x90,0xda,0xfe,0xff,0x8f,0xdb,0xfe,0xff,0x8e,0xdb,0xfe,0xff,0x8b,0xd8,0xfe,0xff,0x80,0xd8,0xfd,0xff,0x76,0xd5,0xfe,0xff,0x6e,0xd1,0xfe,0xff,0x66,0xcf,0xfe,0xff,0x51,0xc9,0xfd,0xff,0x33,0xc5,0xfe,0xff,0x23,0xc4,0xfe,0xff,0x15,0xbc,0xfe,0xff,0x12,0xb7,0xff,0xff,0x12,0xb3,0xfe,0xff,0x11,0xb3,0xfe,0xff,0x11,0xb2,0xfe,0xff,0x0e,0xaf,0xfe,0xff,0x15,0xb5,0xfd,0xff,0x4f,0xcd,0xff,0xff,0x64,0xd1,0xff,0xff,0x5c,0xcd,0xfe,0xff,0x78,0xd5,0xff,0xff,0x94,0xdc,0xfe,0xff,0xa2,0xe0,0xfd,0xff,0xb0,0xe4,0xfe,0xff,0xc9,0xed,0xfe,0xff,0xe6,0xf6,0xfe,0xff,0xee,0xf8,0xfe,0xff,0xe7,0xf5,0xff,0xff,0xca,0xea,0xfe,0xff,0x9c,0xd8,0xfb,0xff,0xa2,0xde,0xfd,0xff,0xb5,0xe7,0xff,0xff,0xb5,0xe6,0xfe,0xff,0xa8,0xe1,0xfe,0xff,0x90,0xda,0xff,0xff,0x98,0xdc,0xfe,0xff,0xa6,0xe0,0xfe,0xff,0xa8,0xe1,0xfd,0xff,0xa0,0xe0,0xfe,0xff,0x95,0xdc,0xfc,0xff,0x8a,0xdb,0xfc,0xff,0x89,0xdb,0xfd,0xff,0x8b,0xd9,0xff,0xff,0x84,0xd7,0xff,0xff,0x75,0xd4,0xfd,0xff,0x6f,0xd2,0xfd,0xff,0x79,0xd4,0xfd,0xff,0xa2,0xdf,0xfb,0xff,0xca,0xec,0xff,0xff,0xd9,0xf0,0xff,0xff,0xd0,0xee,0xfd,0xff,0xae,0xe3,0xfc,0xff,0x9d,0xdd,0xfd,0xff,0xa1,0xde,0xfd,0xff,0xa2,0xde,0xfd,0xff,0x9e,0xdf,0xfd,0xff,0xa0,0xdf,0xfc,0xff,0xa5,0xdf,0xfe,0xff,0xa6,0xdf,0xfe,0xff,0x9f,0xdd,0xfd,0xff,0x92,0xdc,0xfe,0xff,0x89,0xda,0xfe,0xff,0x87,0xd7,0xfd,0xff,0x82,0xd5,0xff,0xff,0x7d,0xd5,0xfe,0xff,0x6f,0xd1,0xfe,0xff,0x46,0xca,0xfb,0xff,0x0f,0xbc,0xf9,0xff,0x0b,0xb3,0xfd,0xff,0x0c,0xb4,0xfc,0xff,0x15,0xba,0xfb,0xff,0x18,0xbe,0xfd,0xff,0x12,0xba,0xfd,0xff,0x0d,0xb2,0xfe,0xff,0x0c,0xad,0xff,0xff,0x0e,0xb4,0xfd,0xff,0x27,0xc1,0xfb,0xff,0x52,0xca,0xfc,0xff,0x64,0xcd,0xfb,0xff,0x55,0xcc,0xfe,0xff,0x2e,0xc5,0xf6,0xff,0x66,0xcf,0xfc,0xff,0x91,0xda,0xfe,0xff,0x9c,0xdd,0xfc,0xff,0x93,0xda,0xfc,0xff,0x79,0xd3,0xfc,0xff,0x63,0xcf,0xfb,0xff,0x62,0xcf,0xfb,0xff,0x73,0xd3,0xf9,0xff,0x7e,0xd6,0xfb,0xff,0x82,0xd6,0xfc,0xff,0x79,0xd3,0xfc,0xff,0x65,0xce,0xfb,0xff,0x56,0xc9,0xfa,0xff,0x48,0xc6,0xfc,0xff,0x36,0xc5,0xfc,0xff,0x1c,0xbb,0xfb,0xff,0x0a,0xa7,0xfa,0xff,0x05,0x92,0xf7,0xff,0x0d,0x83,0xf5,0xff,0x09,0x79,0xef,0xff,0x08,0x73,0xed,0xff,0x0b,0x6a,0xe9,0xff,0x0a,0x61,0xe2,0xff,0x00,0x60,0xe4,0xff,0x57,0xa1,0xf7,0xca,0xfb,0xfd,0xff,0x03,0xff,0xff,0xff,0x00,0xfe,0xf1,0xf6,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xff,0xff,0x00,0xf2,0xf3,0xfa,0x0c,0x44,0x89,0xe9,0xdc,0x07,0x8c,0xfb,0xff,0x0e,0x8b,0xf9,0xff,0x08,0x8c,0xf7,0xff,0x3e,0xc5,0xff,0xff,0x9c,0xe0,0xfc,0xff,0xa7,0xe1,0xff,0xff,0x5e,0xcd,0xfc,0xff,0x41,0xc6,0xfc,0xff,0x79,0xd5,0xfd,0xff,0x89,0xd9,0xfd,0xff,0x86,0xd8,0xfc,0xff,0x8d,0xd9,0xfd,0xff,0x95,0xdc,0xfd,0xff,0x9a,0xdd,0xfd,0xff,0x99,0xdd,0xfe,0xff,0x98,0xde,0xff,0xff,0x99,0xde,0xff,0xff,0x99,0xde,0xff,0xff,0x99,0xdd,0xfe,0xff,0x97,0xdc,0xfe,0xff,0x95,0xdc,0xfe,0xff,0x93,0xdb,0xfd,0xff,0x93,0xdb,0xfe,0xff,0x8d,0xd9,0xff,0xff,0x82,0xd8,0xfd,0xff,0x76,0xd5,0xfd,0xff,0x6c,0xd2,0xfc,0xff,0x5e,0xce,0xfe,0xff,0x45,0xc8,0xfc,0xff,0x2f,0xc4,0xfc,0xff,0x20,0xc2,0xfe,0xff,0x13,0xbb,0xfe,0xff,0x11,0xb6,0xfe,0xff,0x12,0xb2,0xfe,0xff,0x11,0xb1,0xff,0xff,0x11,0xae,0xfe,0xff,0x0f,0xae,0xfc,0xff,0x39,0xc6,0xfd,0xff,0x6a,0xd0,0xff,0xff,0x67,0xce,0xfd,0xff,0x6e,0xd2,0xfc,0xff,0x90,0xdb,0xfe,0xff,0xa4,0xdf,0xff,0xff,0xab,0xe3,0xff,0xff,0xb4,0xe5,0xfd,0xff,0xcf,0xee,0xfe,0xff,0xea,0xf7,0xfe,0xff,0xec,0xf8,0xff,0xff,0xe0,0xf2,0xff,0xff,0xba,0xe3,0xfa,0xff,0xab,0xe1,0xfa,0xff,0xb2,0xe6,0xfe,0xff,0xaf,0xe4,0xff,0xff,0x97,0xdd,0xfe,0xff,0x86,0xd6,0xfa,0xff,0x8f,0xda,0xfd,0xff,0xa1,0xdf,0xff,0xff,0xa5,0xe1,0xfd,0xff,0x9a,0xde,0xfd,0xff,0x91,0xdb,0xfe,0xff,0x8c,0xda,0xfd,0xff,0x8a,0xda,0xfd,0xff,0x88,0xd9,0xfe,0xff,0x84,0xd7,0xff,0xff,0x77,0xd4,0xff,0xff,0x6a,0xd2,0xfd,0xff,0x6a,0xd0,0xfd,0xff,0x7c,0xd6,0xfd,0xff,0xa5,0xe0,0xfd,0xff,0xc9,0xeb,0xff,0xff,0xd6,0xf0,0xfe,0xff,0xd0,0xee,0xfe,0xff,0xaf,0xe2,0xfc,0xff,0x99,0xdb,0xfc,0xff,0x9c,0xdd,0xfe,0xff,0x9e,0xde,0xfd,0xff,0x9d,0xde,0xfc,0xff,0xa1,0xde,0xfd,0xff,0xa6,0xdf,0xfc,0xff,0xa8,0xe0,0xfe,0xff,0x9f,0xde,0xfe,0xff,0x93,0xdc,0xfc,0xff,0x88,0xd9,0xfd,0xff,0x89,0xd9,0xfe,0xff,0x88,0xd7,0xfe,0xff,0x87,0xd7,0xfe,0xff,0x76,0xd3,0xfd,0xff,0x61,0xcd,0xfc,0xff,0x40,0xc7,0xfa,0xff,0x22,0xc0,0xfb,0xff,0x0f,0xb8,0xfa,0xff,0x12,0xbb,0xfc,0xff,0x1b,0xbf,0xfd,0xff,0x18,0xbe,0xfb,0xff,0x11,0xb9,0xfd,0xff,0x0d,0xb3,0xfd,0xff,0x0d,0xb6,0xfd,0xff,0x36,0xc6,0xfe,0xff,0x5d,0xcd,0xfd,0xff,0x6a,0xcf,0xfc,0xff,0x6e,0xd0,0xff,0xff,0x44,0xc6,0xfb,0xff,0x42,0xc5,0xfa,0xff,0x81,0xd8,0xfc,0xff,0x9d,0xdd,0xfb,0xff,0xa0,0xdd,0xfb,0xff,0x8b,0xd6,0xfd,0xff,0x71,0xd0,0xfd,0xff,0x6b,0xd0,0xfc,0xff,0x7d,0xd4,0xfc,0xff,0x8d,0xd8,0xfb,0xff,0x99,0xd9,0xfc,0xff,0x93,0xda,0xfb,0xff,0x7f,0xd6,0xfb,0xff,0x66,0xcc,0xfb,0xff,0x58,0xc7,0xfc,0xff,0x4a,0xc6,0xfe,0xff,0x26,0xbe,0xfb,0xff,0x0d,0xad,0xf8,0xff,0x07,0x96,0xf6,0xff,0x0d,0x8d,0xf8,0xff,0x0b,0x89,0xf7,0xff,0x0b,0x85,0xf7,0xff,0x0d,0x7e,0xf5,0xff,0x0e,0x70,0xec,0xff,0x05,0x66,0xe5,0xff,0x12,0x76,0xf0,0xff,0xbc,0xd8,0xfa,0x52,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xab,0xbe,0xe7,0x6c,0x0d,0x5f,0xdc,0xff,0x0f,0x8f,0xfd,0xff,0x0c,0x87,0xf8,0xff,0x08,0x8c,0xf7,0xff,0x2d,0xbf,0xfd,0xff,0x84,0xd9,0xfc,0xff,0x9a,0xdf,0xff,0xff,0x6d,0xcf,0xfc,0xff,0x50,0xcb,0xfa,0xff,0x7b,0xd8,0xfd,0xff,0x8a,0xd9,0xfd,0xff,0x87,0xd8,0xfd,0xff,0x8b,0xd9,0xfe,0xff,0x95,0xdc,0xfd,0xff,0x9c,0xdd,0xfb,0xff,0x9e,0xdc,0xfd,0xff,0x9e,0xde,0xfc,0xff,0x9e,0xde,0xfc,0xff,0x9e,0xde,0xfd,0xff,0x9d,0xdd,0xfe,0xff,0x9b,0xdd,0xfe,0xff,0x99,0xdc,0xfe,0xff,0x98,0xdc,0xfe,0xff,0x96,0xdc,0xfe,0xff,0x8f,0xda,0xfd,0xff,0x83,0xd8,0xfe,0xff,0x76,0xd4,0xfe,0xff,0x6c,0xd2,0xfc,0xff,0x5c,0xcd,0xfd,0xff,0x43,0xc8,0xfe,0xff,0x2c,0xc6,0xfc,0xff,0x1f,0xc1,0xfc,0xff,0x14,0xbb,0xfe,0xff,0x11,0xb6,0xfe,0xff,0x11,0xb1,0xfe,0xff,0x10,0xad,0xfe,0xff,0x0c,0xa8,0xfe,0xff,0x18,0xb5,0xfd,0xff,0x5a,0xd0,0xfe,0xff,0x6a,0xd0,0xfd,0xff,0x6d,0xd2,0xfc,0xff,0x8c,0xdb,0xfc,0xff,0xa4,0xdf,0xfc,0xff,0xab,0xe1,0xff,0xff,0xac,0xe2,0xff,0xff,0xbc,0xe8,0xfd,0xff,0xd9,0xf2,0xfe,0xff,0xeb,0xf7,0xff,0xff,0xe6,0xf5,0xff,0xff,0xd0,0xee,0xfb,0xff,0xbe,0xe7,0xfd,0xff,0xba,0xe6,0xfd,0xff,0xad,0xe5,0xfe,0xff,0x90,0xdd,0xfc,0xff,0x7b,0xd4,0xf8,0xff,0x84,0xda,0xfe,0xff,0x9c,0xde,0xff,0xff,0x9a,0xdf,0xfe,0xff,0x8f,0xdd,0xfb,0xff,0x89,0xda,0xfd,0xff,0x87,0xd9,0xfe,0xff,0x87,0xd9,0xff,0xff,0x87,0xd9,0xfe,0xff,0x85,0xd8,0xfe,0xff,0x7b,0xd5,0xff,0xff,0x6d,0xd0,0xff,0xff,0x64,0xd0,0xfe,0xff,0x65,0xd0,0xfd,0xff,0x7d,0xd6,0xfd,0xff,0xa6,0xe0,0xfd,0xff,0xc6,0xea,0xfe,0xff,0xd1,0xee,0xfd,0xff,0xcd,0xed,0xfe,0xff,0xaf,0xe2,0xfe,0xff,0x94,0xdb,0xfe,0xff,0x96,0xdc,0xfe,0xff,0x98,0xdd,0xfd,0xff,0x98,0xdc,0xfc,0xff,0x9d,0xdc,0xfe,0xff,0xa1,0xde,0xfd,0xff,0xa4,0xde,0xfd,0xff,0xa0,0xdf,0xfd,0xff,0x91,0xdb,0xfc,0xff,0x82,0xd7,0xfd,0xff,0x88,0xd8,0xfe,0xff,0x8e,0xdb,0xfc,0xff,0x8f,0xdb,0xfb,0xff,0x83,0xd6,0xfd,0xff,0x72,0xd0,0xfb,0xff,0x6d,0xd0,0xfa,0xff,0x50,0xcc,0xfa,0xff,0x2a,0xc2,0xfb,0xff,0x12,0xbc,0xfc,0xff,0x26,0xc1,0xfd,0xff,0x37,0xc5,0xfe,0xff,0x2e,0xc3,0xfd,0xff,0x13,0xba,0xfa,0xff,0x0a,0xb7,0xfc,0xff,0x36,0xc5,0xfd,0xff,0x62,0xce,0xfd,0xff,0x6f,0xd1,0xfa,0xff,0x78,0xd2,0xfd,0xff,0x5a,0xcc,0xfc,0xff,0x23,0xbe,0xf7,0xff,0x69,0xd0,0xfc,0xff,0x99,0xdd,0xfd,0xff,0xa0,0xde,0xfa,0xff,0x99,0xdc,0xfb,0xff,0x83,0xd6,0xfc,0xff,0x76,0xd2,0xfc,0xff,0x83,0xd8,0xfc,0xff,0x99,0xdb,0xfb,0xff,0xa5,0xdc,0xfb,0xff,0xa4,0xdd,0xfa,0xff,0x97,0xda,0xfd,0xff,0x79,0xd2,0xfc,0xff,0x61,0xcb,0xf9,0xff,0x54,0xca,0xfc,0xff,0x39,0xc5,0xfc,0xff,0x12,0xb6,0xf8,0xff,0x0a,0xa2,0xf8,0xff,0x0c,0x95,0xfa,0xff,0x0b,0x92,0xf9,0xff,0x0a,0x8e,0xf9,0xff,0x0a,0x8a,0xf8,0xff,0x0b,0x7e,0xf2,0xff,0x06,0x6d,0xe8,0xff,0x00,0x67,0xe9,0xff,0x5d,0x9b,0xee,0xc4,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xee,0xf4,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfe,0xf0,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf0,0xf6,0x00,0xff,0xff,0xff,0x00,0xf8,0xfa,0xfe,0x0d,0x4c,0x76,0xcc,0xdb,0x05,0x59,0xda,0xff,0x11,0x90,0xff,0xff,0x0c,0x89,0xf8,0xff,0x0a,0x8d,0xf7,0xff,0x1f,0xbc,0xfd,0xff,0x71,0xd6,0xfd,0xff,0x8e,0xde,0xff,0xff,0x74,0xd4,0xfd,0xff,0x60,0xcd,0xf9,0xff,0x7f,0xd8,0xfc,0xff,0x8c,0xda,0xfd,0xff,0x89,0xd8,0xfd,0xff,0x8d,0xd9,0xfe,0xff,0x97,0xdc,0xfc,0xff,0x9f,0xde,0xfb,0xff,0xa2,0xde,0xfd,0xff,0xa1,0xde,0xfc,0xff,0xa2,0xde,0xfc,0xff,0xa1,0xdd,0xfc,0xff,0x9f,0xde,0xfc,0xff,0x9d,0xdd,0xfd,0xff,0x9b,0xdc,0xfe,0xff,0x99,0xdc,0xfe,0xff,0x99,0xdd,0xfe,0xff,0x92,0xdb,0xfd,0xff,0x85,0xd7,0xfe,0xff,0x77,0xd5,0xfd,0xff,0x6c,0xd2,0xfd,0xff,0x5f,0xcc,0xfe,0xff,0x4a,0xc9,0xff,0xff,0x34,0xc7,0xfc,0xff,0x22,0xc3,0xfd,0xff,0x14,0xbc,0xff,0xff,0x11,0xb6,0xfe,0xff,0x0f,0xb0,0xfd,0xff,0x11,0xa9,0xfd,0xff,0x08,0xa6,0xfc,0xff,0x26,0xbe,0xfc,0xff,0x68,0xd2,0xfe,0xff,0x6d,0xd1,0xfd,0xff,0x84,0xd9,0xff,0xff,0x9e,0xde,0xfe,0xff,0xaa,0xe0,0xfe,0xff,0xa8,0xe0,0xfe,0xff,0xad,0xe2,0xfe,0xff,0xcc,0xee,0xff,0xff,0xe2,0xf4,0xff,0xff,0xe6,0xf5,0xff,0xff,0xde,0xf1,0xfd,0xff,0xd1,0xee,0xfd,0xff,0xc9,0xec,0xfe,0xff,0xb2,0xe5,0xfe,0xff,0x8c,0xd9,0xfc,0xff,0x77,0xd1,0xfa,0xff,0x8c,0xdb,0xfc,0xff,0x9a,0xdf,0xfe,0xff,0x8f,0xda,0xff,0xff,0x7b,0xd5,0xfc,0xff,0x76,0xd4,0xfc,0xff,0x7f,0xd6,0xff,0xff,0x7e,0xd6,0xff,0xff,0x7f,0xd6,0xfe,0xff,0x7e,0xd6,0xfe,0xff,0x7b,0xd5,0xff,0xff,0x72,0xd4,0xff,0xff,0x64,0xcf,0xfe,0xff,0x5c,0xce,0xfd,0xff,0x62,0xcf,0xfd,0xff,0x7e,0xd6,0xfe,0xff,0xa6,0xe0,0xfd,0xff,0xc3,0xe9,0xfe,0xff,0xcf,0xec,0xfd,0xff,0xca,0xeb,0xfe,0xff,0xae,0xe2,0xff,0xff,0x90,0xd9,0xfd,0xff,0x90,0xda,0xfd,0xff,0x93,0xdc,0xfd,0xff,0x94,0xdc,0xfd,0xff,0x95,0xdc,0xfe,0xff,0x99,0xdd,0xfc,0xff,0x9e,0xde,0xfd,0xff,0x9c,0xdf,0xfd,0xff,0x8a,0xd9,0xfd,0xff,0x7b,0xd3,0xfe,0xff,0x88,0xd9,0xff,0xff,0x96,0xdd,0xfe,0xff,0x99,0xdc,0xfd,0xff,0x90,0xd9,0xfe,0xff,0x86,0xd9,0xfd,0xff,0x82,0xd8,0xfb,0xff,0x75,0xd4,0xfb,0xff,0x55,0xcc,0xfc,0xff,0x27,0xc1,0xfa,0xff,0x24,0xc1,0xfb,0xff,0x3c,0xc7,0xfc,0xff,0x47,0xca,0xfc,0xff,0x2a,0xc2,0xfc,0xff,0x09,0xb6,0xf9,0xff,0x2b,0xc0,0xfc,0xff,0x67,0xce,0xfe,0xff,0x7b,0xd2,0xfa,0xff,0x7b,0xd4,0xfb,0xff,0x74,0xd4,0xfd,0xff,0x36,0xc2,0xf9,0xff,0x52,0xc9,0xfa,0xff,0x98,0xdc,0xfd,0xff,0xa2,0xdf,0xfc,0xff,0xa4,0xdd,0xfc,0xff,0x98,0xdb,0xfb,0xff,0x8b,0xd8,0xfa,0xff,0x93,0xda,0xfb,0xff,0xa6,0xde,0xfc,0xff,0xb1,0xe0,0xfc,0xff,0xb0,0xe1,0xfb,0xff,0xa2,0xdc,0xfc,0xff,0x8a,0xd6,0xfc,0xff,0x70,0xd0,0xf9,0xff,0x5f,0xcc,0xfa,0xff,0x53,0xc9,0xfb,0xff,0x22,0xc0,0xf9,0xff,0x09,0xaf,0xf9,0xff,0x0a,0x99,0xf8,0xff,0x0c,0x94,0xfb,0xff,0x0e,0x93,0xfb,0xff,0x0c,0x90,0xf9,0xff,0x0e,0x88,0xf8,0xff,0x08,0x73,0xec,0xff,0x03,0x64,0xe5,0xff,0x14,0x6a,0xe4,0xff,0xc7,0xdb,0xf9,0x52,0xff,0xff,0xff,0x00,0xff,0xf9,0xfb,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfe,0xf0,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfa,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xff,0xfa,0xfb,0x00,0xff,0xff,0xff,0x00,0xbb,0xcd,0xf1,0x5a,0x10,0x48,0xbe,0xff,0x0e,0x61,0xde,0xff,0x12,0x94,0xff,0xff,0x0d,0x8b,0xf8,0xff,0x09,0x8e,0xf6,0xff,0x1b,0xbb,0xfe,0xff,0x6a,0xd4,0xfe,0xff,0x8a,0xda,0xfe,0xff,0x7e,0xd6,0xfd,0xff,0x71,0xd2,0xfd,0xff,0x86,0xd8,0xfc,0xff,0x8e,0xda,0xfd,0xff,0x8a,0xd9,0xfc,0xff,0x90,0xda,0xfe,0xff,0x9b,0xdd,0xfc,0xff,0xa4,0xdf,0xfc,0xff,0xa6,0xdf,0xfd,0xff,0xa5,0xdf,0xfc,0xff,0xa5,0xdf,0xfd,0xff,0xa4,0xdf,0xfe,0xff,0xa2,0xdf,0xfd,0xff,0xa1,0xdf,0xfe,0xff,0x9d,0xde,0xfe,0xff,0x9b,0xdd,0xfd,0xff,0x99,0xdd,0xfe,0xff,0x95,0xdb,0xff,0xff,0x87,0xd8,0xfe,0xff,0x78,0xd5,0xfe,0xff,0x6d,0xd2,0xfe,0xff,0x62,0xce,0xff,0xff,0x50,0xca,0xff,0xff,0x3e,0xc7,0xfd,0xff,0x2c,0xc4,0xfe,0xff,0x18,0xbe,0xfe,0xff,0x11,0xb7,0xff,0xff,0x10,0xae,0xfd,0xff,0x0f,0xa7,0xfb,0xff,0x18,0xb6,0xfb,0xff,0x58,0xcf,0xfe,0xff,0x70,0xd2,0xfd,0xff,0x7d,0xd5,0xfd,0xff,0x9b,0xde,0xff,0xff,0xa9,0xe1,0xfe,0xff,0xa3,0xdf,0xfe,0xff,0xa6,0xdf,0xfb,0xff,0xbf,0xe9,0xfd,0xff,0xd9,0xf0,0xff,0xff,0xe3,0xf3,0xff,0xff,0xe2,0xf2,0xfe,0xff,0xdf,0xf1,0xff,0xff,0xd8,0xf0,0xff,0xff,0xc2,0xe9,0xfe,0xff,0x93,0xdb,0xfa,0xff,0x7e,0xd3,0xf9,0xff,0x90,0xda,0xfe,0xff,0x92,0xdd,0xff,0xff,0x7c,0xd7,0xfc,0xff,0x62,0xce,0xfc,0xff,0x64,0xce,0xfd,0xff,0x6d,0xd2,0xff,0xff,0x6d,0xd2,0xfe,0xff,0x6f,0xd0,0xfe,0xff,0x72,0xd1,0xff,0xff,0x72,0xd1,0xff,0xff,0x6b,0xce,0xfd,0xff,0x62,0xcc,0xfe,0xff,0x5a,0xcb,0xfd,0xff,0x57,0xcc,0xfd,0xff,0x5f,0xcd,0xfe,0xff,0x7e,0xd5,0xfe,0xff,0xa4,0xe0,0xfd,0xff,0xbb,0xe7,0xfe,0xff,0xc6,0xea,0xfd,0xff,0xc4,0xea,0xfe,0xff,0xac,0xe2,0xff,0xff,0x8b,0xd8,0xfd,0xff,0x7f,0xd3,0xfb,0xff,0x84,0xd6,0xfe,0xff,0x8e,0xdb,0xff,0xff,0x93,0xdc,0xfe,0xff,0x98,0xdc,0xfd,0xff,0x9e,0xdc,0xfe,0xff,0x9a,0xdd,0xfe,0xff,0x8c,0xd9,0xfc,0xff,0x7e,0xd4,0xfd,0xff,0x85,0xd7,0xfc,0xff,0x93,0xdc,0xff,0xff,0x99,0xdc,0xfe,0xff,0x95,0xdb,0xfe,0xff,0x8e,0xdb,0xff,0xff,0x8c,0xda,0xfe,0xff,0x88,0xd8,0xfe,0xff,0x6f,0xd0,0xfb,0xff,0x43,0xc6,0xfb,0xff,0x1c,0xbe,0xfa,0xff,0x28,0xc3,0xfc,0xff,0x41,0xc9,0xfd,0xff,0x3b,0xc7,0xfe,0xff,0x15,0xb8,0xfa,0xff,0x11,0xb8,0xf9,0xff,0x54,0xc9,0xfe,0xff,0x79,0xd4,0xfc,0xff,0x83,0xd5,0xfc,0xff,0x85,0xd8,0xfd,0xff,0x5b,0xcb,0xfb,0xff,0x48,0xc6,0xf7,0xff,0x91,0xd9,0xfc,0xff,0xa7,0xdf,0xfc,0xff,0xab,0xdf,0xfc,0xff,0xa7,0xe0,0xfb,0xff,0xa3,0xde,0xfb,0xff,0xa8,0xdf,0xfb,0xff,0xb5,0xe3,0xfb,0xff,0xbb,0xe5,0xfc,0xff,0xb6,0xe4,0xfb,0xff,0xa6,0xde,0xfd,0xff,0x92,0xd9,0xfc,0xff,0x7c,0xd2,0xfb,0xff,0x6c,0xcf,0xfc,0xff,0x64,0xcc,0xfa,0xff,0x46,0xc7,0xfa,0xff,0x17,0xb9,0xf8,0xff,0x05,0xa2,0xf7,0xff,0x08,0x9b,0xfa,0xff,0x0a,0x98,0xfb,0xff,0x0b,0x94,0xf9,0xff,0x0e,0x8d,0xfa,0xff,0x0b,0x75,0xee,0xff,0x08,0x62,0xe4,0xff,0x00,0x5e,0xe4,0xff,0x6c,0xa3,0xf1,0xb5,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xef,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xec,0xf3,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0x6a,0x92,0xe1,0xbc,0x03,0x3d,0xbb,0xff,0x14,0x6a,0xe1,0xff,0x12,0x9f,0xff,0xff,0x0f,0x91,0xf9,0xff,0x0d,0x8e,0xf7,0xff,0x1c,0xba,0xfd,0xff,0x62,0xd1,0xfd,0xff,0x81,0xd8,0xfe,0xff,0x82,0xd7,0xff,0xff,0x7f,0xd5,0xfe,0xff,0x8a,0xd8,0xfd,0xff,0x8f,0xdc,0xff,0xff,0x8c,0xd9,0xfc,0xff,0x95,0xdb,0xfe,0xff,0xa0,0xdf,0xfc,0xff,0xa9,0xe1,0xfc,0xff,0xab,0xe1,0xfd,0xff,0xac,0xe1,0xfd,0xff,0xab,0xe1,0xfd,0xff,0xaa,0xe0,0xfd,0xff,0xa8,0xdf,0xfd,0xff,0xa5,0xe0,0xfe,0xff,0xa0,0xdf,0xfe,0xff,0x9c,0xde,0xfc,0xff,0x9a,0xdc,0xfc,0xff,0x95,0xdd,0xfe,0xff,0x89,0xd9,0xfd,0xff,0x7b,0xd6,0xfe,0xff,0x6f,0xd1,0xfe,0xff,0x64,0xcf,0xfe,0xff,0x53,0xcc,0xfe,0xff,0x42,0xc9,0xfc,0xff,0x31,0xc5,0xfb,0xff,0x1f,0xc0,0xfe,0xff,0x13,0xb7,0xff,0xff,0x0e,0xaf,0xfd,0xff,0x09,0xb4,0xfa,0xff,0x44,0xcb,0xfe,0xff,0x72,0xd3,0xfd,0xff,0x76,0xd3,0xfd,0xff,0x94,0xdb,0xff,0xff,0xa7,0xe3,0xfd,0xff,0xa8,0xe3,0xfb,0xff,0xa4,0xdf,0xfb,0xff,0xb9,0xe8,0xfe,0xff,0xd4,0xf0,0xff,0xff,0xd8,0xef,0xff,0xff,0xdc,0xf1,0xff,0xff,0xe2,0xf3,0xfe,0xff,0xdf,0xf4,0xff,0xff,0xcf,0xef,0xff,0xff,0xae,0xe1,0xfe,0xff,0x8b,0xd9,0xfb,0xff,0x90,0xde,0xfe,0xff,0x93,0xdd,0xfe,0xff,0x6a,0xd1,0xfd,0xff,0x45,0xc8,0xfb,0xff,0x43,0xc9,0xfc,0xff,0x4a,0xca,0xfc,0xff,0x4f,0xcb,0xfb,0xff,0x5a,0xcf,0xfc,0xff,0x60,0xcf,0xfe,0xff,0x61,0xce,0xfe,0xff,0x60,0xcc,0xfe,0xff,0x55,0xcb,0xfd,0xff,0x4e,0xca,0xfd,0xff,0x4c,0xca,0xfd,0xff,0x51,0xcb,0xfc,0xff,0x61,0xce,0xfc,0xff,0x7e,0xd7,0xfe,0xff,0x9d,0xde,0xfe,0xff,0xb4,0xe4,0xfe,0xff,0xbd,0xe7,0xfc,0xff,0xb9,0xe8,0xfd,0xff,0xa9,0xe1,0xfe,0xff,0x8a,0xd8,0xfe,0xff,0x6e,0xd1,0xfb,0xff,0x6e,0xd0,0xfd,0xff,0x7d,0xd4,0xfe,0xff,0x87,0xd8,0xfe,0xff,0x90,0xd9,0xff,0xff,0x99,0xdb,0xff,0xff,0x95,0xdc,0xfe,0xff,0x8c,0xdb,0xfc,0xff,0x85,0xd8,0xfd,0xff,0x81,0xd7,0xfe,0xff,0x8c,0xda,0xff,0xff,0x98,0xdd,0xfd,0xff,0x9a,0xdd,0xfd,0xff,0x97,0xdc,0xfe,0xff,0x92,0xdb,0xfe,0xff,0x8c,0xd9,0xfc,0xff,0x79,0xd5,0xfa,0xff,0x55,0xcd,0xfa,0xff,0x23,0xc1,0xfb,0xff,0x14,0xbd,0xfa,0xff,0x34,0xc5,0xfd,0xff,0x3d,0xc9,0xfe,0xff,0x26,0xbf,0xfd,0xff,0x07,0xb4,0xfa,0xff,0x2c,0xc1,0xfb,0xff,0x6c,0xd2,0xfd,0xff,0x86,0xd7,0xfd,0xff,0x91,0xd7,0xfc,0xff,0x7e,0xd5,0xfb,0xff,0x51,0xcb,0xf7,0xff,0x81,0xd6,0xfa,0xff,0xaa,0xe0,0xfb,0xff,0xb4,0xe2,0xfb,0xff,0xb5,0xe2,0xfb,0xff,0xb6,0xe3,0xfa,0xff,0xb9,0xe5,0xfb,0xff,0xbe,0xe6,0xfb,0xff,0xbe,0xe6,0xfc,0xff,0xb9,0xe5,0xfb,0xff,0xab,0xe1,0xfc,0xff,0x9a,0xdd,0xfb,0xff,0x85,0xd5,0xfa,0xff,0x76,0xd1,0xfe,0xff,0x6b,0xcf,0xfa,0xff,0x60,0xca,0xfc,0xff,0x35,0xc5,0xfa,0xff,0x0d,0xb5,0xf7,0xff,0x0b,0xab,0xfc,0xff,0x09,0xa2,0xfb,0xff,0x09,0x97,0xf8,0xff,0x0c,0x8d,0xf9,0xff,0x0a,0x75,0xef,0xff,0x0a,0x62,0xe4,0xff,0x05,0x68,0xeb,0xff,0x1e,0x70,0xe4,0xfa,0xda,0xe5,0xf9,0x2f,0xff,0xff,0xff,0x00,0xfe,0xf4,0xf8,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xef,0x00,0xfe,0xef,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf5,0xf9,0x00,0xff,0xff,0xff,0x00,0xdc,0xe4,0xf5,0x33,0x2a,0x62,0xd0,0xfc,0x09,0x40,0xbb,0xff,0x12,0x66,0xdd,0xff,0x12,0xa0,0xff,0xff,0x0f,0x91,0xf8,0xff,0x0f,0x8e,0xf8,0xff,0x1e,0xbc,0xfe,0xff,0x5c,0xd0,0xfc,0xff,0x7b,0xd7,0xfe,0xff,0x82,0xd6,0xff,0xff,0x85,0xd6,0xfe,0xff,0x8a,0xd9,0xfc,0xff,0x8d,0xda,0xfe,0xff,0x8d,0xd9,0xfc,0xff,0x98,0xdc,0xfc,0xff,0xa4,0xe0,0xfd,0xff,0xad,0xe2,0xfc,0xff,0xb0,0xe2,0xfd,0xff,0xb0,0xe2,0xfd,0xff,0xaf,0xe2,0xfd,0xff,0xae,0xe2,0xfd,0xff,0xad,0xe1,0xfe,0xff,0xa9,0xe1,0xfe,0xff,0xa4,0xe0,0xfe,0xff,0x9f,0xdf,0xfc,0xff,0x9c,0xdf,0xfd,0xff,0x97,0xdd,0xfe,0xff,0x8c,0xda,0xfe,0xff,0x7f,0xd6,0xfd,0xff,0x73,0xd1,0xfd,0xff,0x65,0xcf,0xfe,0xff,0x54,0xcd,0xfc,0xff,0x43,0xc9,0xfc,0xff,0x33,0xc7,0xfb,0xff,0x22,0xc1,0xfd,0xff,0x11,0xb8,0xff,0xff,0x10,0xb5,0xfa,0xff,0x2c,0xc3,0xfd,0xff,0x59,0xce,0xfc,0xff,0x75,0xd4,0xfd,0xff,0x8b,0xdb,0xfe,0xff,0xa7,0xe1,0xfe,0xff,0xaa,0xe3,0xfc,0xff,0xa2,0xe0,0xfd,0xff,0xbd,0xe7,0xfc,0xff,0xd1,0xf1,0xff,0xff,0xcd,0xee,0xfd,0xff,0xcd,0xee,0xfc,0xff,0xdc,0xf3,0xff,0xff,0xe4,0xf3,0xff,0xff,0xd8,0xf1,0xfe,0xff,0xbd,0xe8,0xfc,0xff,0xa6,0xe0,0xfe,0xff,0x99,0xe0,0xff,0xff,0x86,0xda,0xff,0xff,0x52,0xc9,0xfd,0xff,0x2f,0xc5,0xfc,0xff,0x2e,0xc7,0xfe,0xff,0x2f,0xc7,0xff,0xff,0x2f,0xc4,0xfc,0xff,0x3e,0xc5,0xfc,0xff,0x5a,0xcc,0xff,0xff,0x59,0xcd,0xff,0xff,0x52,0xcb,0xfe,0xff,0x4a,0xca,0xfd,0xff,0x3e,0xc9,0xfd,0xff,0x3a,0xc8,0xfe,0xff,0x3f,0xc9,0xfe,0xff,0x4b,0xcb,0xfc,0xff,0x63,0xce,0xfc,0xff,0x80,0xd7,0xfe,0xff,0x99,0xde,0xff,0xff,0xab,0xe2,0xfe,0xff,0xb5,0xe3,0xfe,0xff,0xb0,0xe2,0xfe,0xff,0xa3,0xdf,0xfd,0xff,0x89,0xd8,0xfe,0xff,0x6a,0xd0,0xfc,0xff,0x5f,0xcd,0xfe,0xff,0x63,0xce,0xfe,0xff,0x6f,0xcf,0xfd,0xff,0x79,0xd1,0xfe,0xff,0x83,0xd5,0xfe,0xff,0x83,0xd9,0xfc,0xff,0x7d,0xd8,0xfb,0xff,0x7c,0xd7,0xfd,0xff,0x7d,0xd5,0xfe,0xff,0x8a,0xd8,0xfe,0xff,0x9a,0xdd,0xfd,0xff,0x9d,0xde,0xfd,0xff,0x9d,0xdd,0xfe,0xff,0x98,0xdd,0xfe,0xff,0x8e,0xdb,0xfd,0xff,0x83,0xd7,0xfd,0xff,0x65,0xd0,0xf9,0xff,0x3f,0xc7,0xfc,0xff,0x12,0xbe,0xf6,0xff,0x22,0xc2,0xf9,0xff,0x39,0xc7,0xfc,0xff,0x35,0xc4,0xfd,0xff,0x13,0xb9,0xfd,0xff,0x11,0xb9,0xf9,0xff,0x55,0xcc,0xfc,0xff,0x82,0xd7,0xfc,0xff,0x92,0xd8,0xfc,0xff,0x91,0xdb,0xfb,0xff,0x71,0xd1,0xfa,0xff,0x78,0xd2,0xf9,0xff,0xa9,0xe1,0xfc,0xff,0xbc,0xe5,0xfd,0xff,0xbe,0xe6,0xfc,0xff,0xbf,0xe7,0xfc,0xff,0xc0,0xe7,0xfc,0xff,0xc1,0xe8,0xfd,0xff,0xbe,0xe6,0xfc,0xff,0xbb,0xe6,0xfb,0xff,0xb3,0xe2,0xfb,0xff,0xa5,0xde,0xfd,0xff,0x91,0xd9,0xfb,0xff,0x81,0xd5,0xfb,0xff,0x74,0xd2,0xf9,0xff,0x6a,0xcd,0xfa,0xff,0x50,0xca,0xfb,0xff,0x1e,0xbf,0xf5,0xff,0x0b,0xb2,0xf9,0xff,0x09,0xa4,0xfc,0xff,0x0a,0x98,0xf9,0xff,0x0c,0x8d,0xfb,0xff,0x0a,0x74,0xed,0xff,0x0b,0x61,0xe3,0xff,0x0d,0x6f,0xee,0xff,0x02,0x60,0xe5,0xff,0x90,0xb5,0xef,0x8b,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xef,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe9,0xf1,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0x95,0xaa,0xda,0x8d,0x11,0x4c,0xc8,0xff,0x0f,0x45,0xbf,0xff,0x10,0x60,0xd8,0xff,0x13,0x95,0xfc,0xff,0x11,0x8c,0xf8,0xff,0x0e,0x8b,0xf6,0xff,0x1f,0xba,0xff,0xff,0x57,0xce,0xfb,0xff,0x77,0xd4,0xfc,0xff,0x85,0xd6,0xff,0xff,0x87,0xd6,0xfd,0xff,0x89,0xd8,0xfb,0xff,0x8d,0xda,0xfe,0xff,0x90,0xda,0xfd,0xff,0x9a,0xdc,0xfd,0xff,0xa6,0xe0,0xfd,0xff,0xaf,0xe2,0xfc,0xff,0xb3,0xe4,0xfd,0xff,0xb2,0xe2,0xfc,0xff,0xb1,0xe3,0xfc,0xff,0xb0,0xe3,0xfd,0xff,0xb0,0xe3,0xfe,0xff,0xad,0xe2,0xfe,0xff,0xa7,0xe1,0xfd,0xff,0xa3,0xdf,0xfc,0xff,0x9f,0xdf,0xfc,0xff,0x99,0xdd,0xfd,0xff,0x8f,0xdb,0xfe,0xff,0x83,0xd7,0xfe,0xff,0x76,0xd2,0xfd,0xff,0x66,0xd0,0xfd,0xff,0x56,0xcd,0xfc,0xff,0x46,0xc9,0xfc,0xff,0x35,0xc8,0xfc,0xff,0x21,0xc2,0xfd,0xff,0x0e,0xba,0xfc,0xff,0x26,0xbf,0xfd,0xff,0x55,0xcc,0xfe,0xff,0x78,0xd6,0xfe,0xff,0x90,0xdc,0xff,0xff,0xa8,0xdf,0xff,0xff,0xa9,0xe3,0xfe,0xff,0xa4,0xdf,0xfa,0xff,0xb9,0xe6,0xfe,0xff,0xd4,0xee,0xff,0xff,0xca,0xeb,0xfd,0xff,0xbe,0xe9,0xf9,0xff,0xd9,0xf0,0xfe,0xff,0xe0,0xf2,0xff,0xff,0xd7,0xef,0xfe,0xff,0xc8,0xea,0xfb,0xff,0xb9,0xe7,0xfc,0xff,0xac,0xe2,0xff,0xff,0x7e,0xd9,0xfe,0xff,0x3c,0xc6,0xfa,0xff,0x1f,0xc0,0xfc,0xff,0x23,0xc2,0xfe,0xff,0x24,0xc5,0xff,0xff,0x2d,0xc7,0xfe,0xff,0x4d,0xcc,0xfd,0xff,0x62,0xd0,0xff,0xff,0x61,0xcf,0xff,0xff,0x50,0xcc,0xfe,0xff,0x3c,0xc7,0xfd,0xff,0x2f,0xc3,0xff,0xff,0x24,0xc2,0xfd,0xff,0x28,0xc3,0xfd,0xff,0x38,0xc7,0xfd,0xff,0x4e,0xcb,0xfc,0xff,0x68,0xd0,0xfd,0xff,0x82,0xd7,0xfe,0xff,0x97,0xdd,0xfe,0xff,0xa3,0xe0,0xfc,0xff,0xab,0xe1,0xfe,0xff,0xa7,0xe0,0xfd,0xff,0x9d,0xde,0xfc,0xff,0x87,0xd9,0xfe,0xff,0x6b,0xd0,0xfb,0xff,0x59,0xcc,0xfe,0xff,0x4c,0xca,0xfc,0xff,0x4f,0xc8,0xfa,0xff,0x5a,0xcc,0xfd,0xff,0x5f,0xcf,0xfd,0xff,0x63,0xcf,0xfd,0xff,0x66,0xcf,0xfe,0xff,0x6b,0xd0,0xfe,0xff,0x78,0xd3,0xf9,0xff,0x8e,0xda,0xfe,0xff,0x9c,0xdd,0xfe,0xff,0x9e,0xdd,0xfc,0xff,0x9e,0xdc,0xfd,0xff,0x9a,0xdd,0xfd,0xff,0x8f,0xda,0xfc,0xff,0x89,0xd7,0xfd,0xff,0x7f,0xd5,0xfd,0xff,0x5b,0xcf,0xfc,0xff,0x38,0xc7,0xf9,0xff,0x28,0xc2,0xf9,0xff,0x35,0xc4,0xfc,0xff,0x3c,0xc6,0xfb,0xff,0x21,0xc1,0xfb,0xff,0x06,0xb8,0xf8,0xff,0x36,0xc1,0xfd,0xff,0x79,0xd2,0xfd,0xff,0x93,0xd9,0xfc,0xff,0x9b,0xde,0xfa,0xff,0x85,0xd8,0xfd,0xff,0x75,0xd0,0xf9,0xff,0xa1,0xde,0xfc,0xff,0xbf,0xe7,0xfc,0xff,0xc8,0xe8,0xfc,0xff,0xca,0xe9,0xfd,0xff,0xc9,0xe8,0xfd,0xff,0xc3,0xe8,0xfc,0xff,0xbe,0xe6,0xfc,0xff,0xbc,0xe6,0xfb,0xff,0xb6,0xe2,0xfc,0xff,0xac,0xdd,0xfe,0xff,0x98,0xda,0xfb,0xff,0x87,0xd7,0xfb,0xff,0x7d,0xd4,0xfa,0xff,0x77,0xd1,0xfa,0xff,0x69,0xd0,0xfc,0xff,0x3f,0xc5,0xf9,0xff,0x0f,0xb4,0xf9,0xff,0x07,0xa5,0xfb,0xff,0x09,0x98,0xf9,0xff,0x0c,0x8e,0xfb,0xff,0x09,0x72,0xeb,0xff,0x0a,0x60,0xe2,0xff,0x0b,0x70,0xed,0xff,0x00,0x68,0xeb,0xff,0x43,0x8a,0xec,0xde,0xf6,0xf9,0xfe,0x0f,0xff,0xff,0xff,0x00,0xfe,0xf1,0xf6,0x00,0xfd,0xe4,0xee,0x00,0xfe,0xee,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe4,0xee,0x00,0xfe,0xef,0xf5,0x00,0xff,0xff,0xff,0x00,0xf6,0xf7,0xf9,0x0b,0x48,0x6a,0xb7,0xda,0x0f,0x4b,0xc6,0xff,0x12,0x49,0xc0,0xff,0x11,0x5e,0xd8,0xff,0x15,0x8f,0xfc,0xff,0x12,0x8a,0xf7,0xff,0x12,0x8a,0xf5,0xff,0x16,0xb6,0xfe,0xff,0x42,0xcb,0xfc,0xff,0x6e,0xd1,0xfa,0xff,0x80,0xd6,0xfe,0xff,0x84,0xd6,0xfe,0xff,0x86,0xd7,0xfd,0xff,0x8c,0xdb,0xff,0xff,0x8f,0xda,0xfe,0xff,0x9a,0xdd,0xfe,0xff,0xa9,0xe1,0xfd,0xff,0xb3,0xe4,0xfc,0xff,0xb7,0xe5,0xfd,0xff,0xb5,0xe3,0xfc,0xff,0xb4,0xe4,0xfc,0xff,0xb3,0xe3,0xfd,0xff,0xb3,0xe3,0xfd,0xff,0xb0,0xe2,0xfe,0xff,0xac,0xe1,0xfe,0xff,0xa9,0xe0,0xfe,0xff,0xa3,0xde,0xfd,0xff,0x9c,0xde,0xfe,0xff,0x91,0xdc,0xfd,0xff,0x84,0xd7,0xfd,0xff,0x76,0xd2,0xfd,0xff,0x65,0xd0,0xfd,0xff,0x58,0xcc,0xfd,0xff,0x49,0xc9,0xfd,0xff,0x36,0xc7,0xfd,0xff,0x1b,0xc1,0xfb,0xff,0x21,0xc0,0xfa,0xff,0x52,0xce,0xff,0xff,0x7c,0xd7,0xff,0xff,0x98,0xdd,0xfe,0xff,0xa8,0xe2,0xfe,0xff,0xb7,0xe5,0xff,0xff,0xa8,0xe0,0xfa,0xff,0xaf,0xe4,0xfb,0xff,0xd1,0xf0,0xff,0xff,0xc7,0xeb,0xfd,0xff,0xb8,0xe4,0xf8,0xff,0xd1,0xf0,0xfe,0xff,0xdf,0xf2,0xff,0xff,0xd8,0xef,0xfe,0xff,0xca,0xec,0xfd,0xff,0xc2,0xe9,0xfd,0xff,0xb7,0xe6,0xfe,0xff,0x9a,0xdd,0xfe,0xff,0x5f,0xcf,0xfc,0xff,0x2f,0xc5,0xfb,0xff,0x1f,0xc1,0xfe,0xff,0x13,0xbb,0xfc,0xff,0x14,0xbe,0xf9,0xff,0x3e,0xca,0xfc,0xff,0x65,0xd0,0xfe,0xff,0x6b,0xd1,0xff,0xff,0x58,0xcf,0xfd,0xff,0x3b,0xc7,0xfb,0xff,0x24,0xc2,0xfb,0xff,0x18,0xbf,0xfc,0xff,0x16,0xbe,0xfd,0xff,0x20,0xc1,0xfe,0xff,0x36,0xc6,0xfc,0xff,0x53,0xcc,0xfc,0xff,0x6e,0xd2,0xfe,0xff,0x83,0xd8,0xfd,0xff,0x97,0xdd,0xfe,0xff,0xa0,0xdf,0xfc,0xff,0xa1,0xde,0xfd,0xff,0x9e,0xdf,0xfe,0xff,0x97,0xdf,0xfe,0xff,0x86,0xd9,0xfc,0xff,0x6c,0xd1,0xfc,0xff,0x58,0xcc,0xfd,0xff,0x46,0xc9,0xfe,0xff,0x3c,0xc7,0xfc,0xff,0x38,0xc7,0xfb,0xff,0x39,0xc7,0xfd,0xff,0x40,0xc8,0xfe,0xff,0x4e,0xcb,0xff,0xff,0x5d,0xcf,0xfe,0xff,0x76,0xd5,0xfd,0xff,0x8d,0xdb,0xfe,0xff,0x92,0xdb,0xfd,0xff,0x99,0xdc,0xfe,0xff,0x9c,0xdc,0xfd,0xff,0x99,0xdc,0xfd,0xff,0x93,0xdb,0xfc,0xff,0x8f,0xda,0xfc,0xff,0x92,0xda,0xfd,0xff,0x8a,0xd9,0xfc,0xff,0x7b,0xd7,0xfc,0xff,0x57,0xcd,0xfd,0xff,0x3e,0xc5,0xfb,0xff,0x45,0xc8,0xfc,0xff,0x3e,0xc8,0xfc,0xff,0x19,0xbc,0xf9,0xff,0x12,0xbb,0xf8,0xff,0x64,0xce,0xfd,0xff,0x92,0xd9,0xfd,0xff,0xa0,0xde,0xf9,0xff,0x9b,0xde,0xfd,0xff,0x80,0xd4,0xfa,0xff,0x94,0xda,0xfb,0xff,0xbe,0xe6,0xfc,0xff,0xcd,0xe9,0xfb,0xff,0xd3,0xec,0xfd,0xff,0xce,0xea,0xfd,0xff,0xc5,0xe8,0xfb,0xff,0xc0,0xe6,0xfb,0xff,0xbe,0xe6,0xfb,0xff,0xb9,0xe4,0xfd,0xff,0xaf,0xe1,0xfb,0xff,0x9e,0xde,0xfa,0xff,0x8e,0xd9,0xfb,0xff,0x83,0xd5,0xf9,0xff,0x80,0xd5,0xf9,0xff,0x78,0xd2,0xfb,0xff,0x58,0xc9,0xfc,0xff,0x19,0xb9,0xfa,0xff,0x07,0xa7,0xfb,0xff,0x09,0x99,0xf9,0xff,0x0c,0x8e,0xfa,0xff,0x09,0x70,0xe8,0xff,0x09,0x62,0xe1,0xff,0x0a,0x71,0xec,0xff,0x06,0x71,0xed,0xff,0x0c,0x71,0xec,0xff,0xbf,0xd9,0xf9,0x4f,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfa,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xee,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf6,0xfa,0x00,0xfd,0xe4,0xee,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xc5,0xce,0xe3,0x48,0x19,0x43,0x9f,0xff,0x13,0x4f,0xc7,0xff,0x15,0x4d,0xc2,0xff,0x14,0x60,0xd8,0xff,0x16,0x8f,0xfe,0xff,0x15,0x8a,0xf8,0xff,0x13,0x8c,0xf6,0xff,0x10,0xb3,0xfe,0xff,0x27,0xc3,0xfb,0xff,0x53,0xcb,0xfe,0xff,0x71,0xd2,0xff,0xff,0x80,0xd6,0xff,0xff,0x83,0xd6,0xfd,0xff,0x89,0xda,0xfe,0xff,0x89,0xd9,0xfd,0xff,0x93,0xdc,0xfd,0xff,0xa9,0xe0,0xfd,0xff,0xb5,0xe4,0xfd,0xff,0xb7,0xe6,0xfd,0xff,0xb6,0xe5,0xfc,0xff,0xb6,0xe5,0xfd,0xff,0xb5,0xe4,0xfe,0xff,0xb5,0xe4,0xfe,0xff,0xb3,0xe4,0xff,0xff,0xb0,0xe3,0xff,0xff,0xad,0xe1,0xff,0xff,0xa6,0xe0,0xfe,0xff,0x9d,0xde,0xfd,0xff,0x93,0xdd,0xfd,0xff,0x86,0xd8,0xfd,0xff,0x76,0xd3,0xfe,0xff,0x65,0xd0,0xfe,0xff,0x5a,0xcc,0xfd,0xff,0x4a,0xca,0xfd,0xff,0x2d,0xc5,0xfc,0xff,0x27,0xc0,0xfd,0xff,0x60,0xcf,0xfc,0xff,0x8b,0xdc,0xfc,0xff,0x9c,0xdf,0xfd,0xff,0xad,0xe2,0xfc,0xff,0xb8,0xe7,0xfd,0xff,0xb3,0xe5,0xfb,0xff,0xb5,0xe5,0xfb,0xff,0xd0,0xf0,0xfe,0xff,0xc6,0xeb,0xfb,0xff,0xaf,0xe3,0xf7,0xff,0xd2,0xee,0xfd,0xff,0xdf,0xf2,0xff,0xff,0xd0,0xed,0xfc,0xff,0xcd,0xed,0xfd,0xff,0xcc,0xec,0xff,0xff,0xc2,0xe9,0xff,0xff,0xaa,0xe1,0xfd,0xff,0x87,0xd9,0xfe,0xff,0x60,0xd0,0xfd,0xff,0x38,0xc6,0xfb,0xff,0x1b,0xbf,0xfe,0xff,0x0e,0xbb,0xfe,0xff,0x2c,0xc3,0xfb,0xff,0x63,0xce,0xfe,0xff,0x6a,0xcf,0xff,0xff,0x5d,0xce,0xff,0xff,0x47,0xca,0xfd,0xff,0x29,0xc1,0xfc,0xff,0x15,0xbe,0xfd,0xff,0x10,0xb9,0xfc,0xff,0x13,0xba,0xfd,0xff,0x21,0xc1,0xfd,0xff,0x3c,0xc9,0xfc,0xff,0x5c,0xcf,0xfd,0xff,0x72,0xd4,0xfe,0xff,0x85,0xd7,0xfc,0xff,0x98,0xdd,0xfe,0xff,0x9f,0xde,0xfc,0xff,0x9e,0xde,0xfc,0xff,0x9a,0xdd,0xfd,0xff,0x92,0xdc,0xfe,0xff,0x83,0xd7,0xfc,0xff,0x6d,0xd2,0xfd,0xff,0x5a,0xcd,0xfd,0xff,0x4b,0xca,0xfe,0xff,0x3e,0xc8,0xfe,0xff,0x30,0xc5,0xfd,0xff,0x1f,0xbf,0xfc,0xff,0x1c,0xbe,0xfc,0xff,0x21,0xbf,0xfc,0xff,0x37,0xc4,0xfd,0xff,0x68,0xd0,0xfe,0xff,0x76,0xd2,0xfe,0xff,0x75,0xd3,0xfd,0xff,0x85,0xd8,0xfc,0xff,0x91,0xdd,0xfd,0xff,0x98,0xde,0xfe,0xff,0x9a,0xdd,0xfd,0xff,0x9b,0xdd,0xfd,0xff,0x9c,0xde,0xfd,0xff,0x9e,0xde,0xfb,0xff,0x9c,0xdd,0xfb,0xff,0x8d,0xda,0xfe,0xff,0x69,0xcf,0xfb,0xff,0x5b,0xca,0xfd,0xff,0x60,0xcc,0xfe,0xff,0x3a,0xc4,0xfc,0xff,0x0c,0xbb,0xf7,0xff,0x4e,0xca,0xfb,0xff,0x90,0xd8,0xfe,0xff,0xa5,0xde,0xfb,0xff,0xad,0xdf,0xfc,0xff,0x94,0xd8,0xf9,0xff,0x88,0xd7,0xf8,0xff,0xb4,0xe6,0xfc,0xff,0xcf,0xeb,0xfb,0xff,0xd5,0xed,0xfd,0xff,0xd1,0xec,0xfe,0xff,0xc5,0xe8,0xfb,0xff,0xc1,0xe6,0xfd,0xff,0xc1,0xe7,0xfd,0xff,0xba,0xe5,0xfc,0xff,0xb2,0xe2,0xfb,0xff,0xa4,0xde,0xfb,0xff,0x95,0xd9,0xfb,0xff,0x8a,0xd6,0xfc,0xff,0x86,0xd5,0xfb,0xff,0x7f,0xd3,0xfc,0xff,0x5e,0xcb,0xfb,0xff,0x1e,0xbc,0xfa,0xff,0x08,0xa8,0xfc,0xff,0x09,0x99,0xf8,0xff,0x0c,0x8e,0xf9,0xff,0x0a,0x70,0xe7,0xff,0x0b,0x64,0xe4,0xff,0x08,0x73,0xee,0xff,0x06,0x78,0xee,0xff,0x00,0x78,0xf0,0xff,0x73,0xb4,0xf6,0xa3,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xfd,0xe8,0xf1,0x00,0xfe,0xec,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf6,0xf9,0x00,0xfd,0xe7,0xf0,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0x85,0x98,0xc6,0x99,0x0b,0x34,0x93,0xff,0x1a,0x4e,0xbf,0xff,0x16,0x4b,0xc0,0xff,0x14,0x5e,0xd6,0xff,0x16,0x8f,0xfe,0xff,0x12,0x89,0xf8,0xff,0x12,0x8a,0xf4,0xff,0x15,0xaf,0xfd,0xff,0x19,0xbf,0xfb,0xff,0x39,0xc6,0xfd,0xff,0x66,0xd0,0xff,0xff,0x79,0xd4,0xfd,0xff,0x79,0xd4,0xfe,0xff,0x82,0xd8,0xfd,0xff,0x88,0xd8,0xfc,0xff,0x8f,0xda,0xfd,0xff,0xa6,0xdf,0xfe,0xff,0xb5,0xe3,0xfd,0xff,0xb7,0xe5,0xfe,0xff,0xb7,0xe4,0xfd,0xff,0xb6,0xe4,0xfd,0xff,0xb6,0xe5,0xfd,0xff,0xb6,0xe5,0xfd,0xff,0xb5,0xe4,0xfe,0xff,0xb1,0xe4,0xfe,0xff,0xad,0xe2,0xfe,0xff,0xa7,0xe1,0xfd,0xff,0x9f,0xdf,0xfc,0xff,0x94,0xdd,0xfe,0xff,0x86,0xd7,0xfe,0xff,0x75,0xd3,0xfe,0xff,0x65,0xcf,0xff,0xff,0x57,0xcc,0xff,0xff,0x40,0xc9,0xfd,0xff,0x2e,0xc5,0xf9,0xff,0x60,0xcd,0xfe,0xff,0x98,0xdc,0xff,0xff,0xa2,0xdf,0xfd,0xff,0xac,0xe1,0xfe,0xff,0xb8,0xe8,0xff,0xff,0xba,0xe6,0xfc,0xff,0xc0,0xe8,0xfc,0xff,0xd6,0xf2,0xfe,0xff,0xc5,0xeb,0xfc,0xff,0xab,0xe1,0xf8,0xff,0xd2,0xee,0xfd,0xff,0xdb,0xf2,0xff,0xff,0xd2,0xed,0xfc,0xff,0xd3,0xec,0xfc,0xff,0xd2,0xee,0xff,0xff,0xca,0xec,0xfe,0xff,0xba,0xe6,0xff,0xff,0x9f,0xde,0xfe,0xff,0x79,0xd6,0xfd,0xff,0x50,0xca,0xfa,0xff,0x37,0xc6,0xfd,0xff,0x19,0xc0,0xfd,0xff,0x15,0xbe,0xfb,0xff,0x4d,0xca,0xff,0xff,0x6a,0xd0,0xff,0xff,0x62,0xce,0xff,0xff,0x51,0xcc,0xff,0xff,0x36,0xc7,0xfd,0xff,0x1a,0xbe,0xfd,0xff,0x10,0xb7,0xfe,0xff,0x10,0xb3,0xfd,0xff,0x12,0xb9,0xfc,0xff,0x2a,0xc6,0xfd,0xff,0x52,0xcc,0xfe,0xff,0x6c,0xd2,0xff,0xff,0x79,0xd5,0xff,0xff,0x89,0xd8,0xfc,0xff,0x9a,0xdd,0xfe,0xff,0x9e,0xde,0xfc,0xff,0x9e,0xde,0xfc,0xff,0x98,0xdd,0xfd,0xff,0x90,0xda,0xfe,0xff,0x82,0xd6,0xfc,0xff,0x6e,0xd2,0xfd,0xff,0x62,0xce,0xfd,0xff,0x57,0xca,0xff,0xff,0x46,0xc8,0xfe,0xff,0x35,0xc5,0xfe,0xff,0x1d,0xbe,0xfe,0xff,0x0f,0xbb,0xfb,0xff,0x0d,0xb9,0xfc,0xff,0x23,0xbc,0xfc,0xff,0x5f,0xcb,0xff,0xff,0x4a,0xcb,0xfe,0xff,0x50,0xc9,0xfc,0xff,0x7e,0xd4,0xfc,0xff,0x8f,0xdb,0xfa,0xff,0x99,0xdd,0xfd,0xff,0x9e,0xdd,0xfc,0xff,0xa1,0xde,0xfc,0xff,0xa6,0xdf,0xfd,0xff,0xa8,0xdf,0xfe,0xff,0xa3,0xdd,0xfe,0xff,0x9b,0xdb,0xfc,0xff,0x88,0xd8,0xfe,0xff,0x6e,0xd0,0xfc,0xff,0x72,0xd0,0xfc,0xff,0x5f,0xce,0xfe,0xff,0x2c,0xc0,0xf9,0xff,0x42,0xc7,0xf9,0xff,0x8f,0xd8,0xff,0xff,0xa9,0xe0,0xfb,0xff,0xb5,0xe2,0xfb,0xff,0xa4,0xde,0xfb,0xff,0x8c,0xd7,0xf8,0xff,0xaf,0xe2,0xfb,0xff,0xcf,0xea,0xfd,0xff,0xd5,0xee,0xfc,0xff,0xd4,0xee,0xfe,0xff,0xc5,0xe8,0xfb,0xff,0xbc,0xe5,0xfd,0xff,0xbc,0xe6,0xfd,0xff,0xbc,0xe6,0xfc,0xff,0xb6,0xe3,0xfb,0xff,0xa8,0xde,0xfb,0xff,0x98,0xda,0xfc,0xff,0x8d,0xd7,0xfd,0xff,0x86,0xd4,0xfc,0xff,0x7e,0xd3,0xfb,0xff,0x60,0xcc,0xfb,0xff,0x20,0xbb,0xfb,0xff,0x08,0xa5,0xfc,0xff,0x09,0x96,0xf9,0xff,0x0b,0x8e,0xf8,0xff,0x09,0x70,0xe8,0xff,0x0b,0x64,0xe7,0xff,0x09,0x73,0xef,0xff,0x06,0x7b,0xef,0xff,0x02,0x87,0xf6,0xff,0x33,0xa0,0xf7,0xe9,0xee,0xf7,0xfe,0x13,0xff,0xff,0xff,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xec,0xf3,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf9,0x00,0xfd,0xec,0xf3,0x00,0xff,0xff,0xff,0x00,0xf5,0xf7,0xfa,0x09,0x4a,0x67,0xaa,0xe1,0x0f,0x36,0x92,0xff,0x1a,0x4a,0xb0,0xff,0x12,0x48,0xba,0xff,0x14,0x56,0xcc,0xff,0x19,0x87,0xf8,0xff,0x15,0x86,0xf7,0xff,0x15,0x84,0xf1,0xff,0x17,0xa8,0xfd,0xff,0x15,0xbc,0xfd,0xff,0x23,0xc1,0xfc,0xff,0x57,0xcd,0xfe,0xff,0x6e,0xd1,0xfc,0xff,0x6a,0xd1,0xfc,0xff,0x79,0xd5,0xfd,0xff,0x86,0xd8,0xfc,0xff,0x8a,0xd9,0xfd,0xff,0x9e,0xde,0xfd,0xff,0xb3,0xe4,0xfc,0xff,0xb8,0xe5,0xfc,0xff,0xb9,0xe4,0xfd,0xff,0xb7,0xe4,0xfd,0xff,0xb6,0xe5,0xfd,0xff,0xb6,0xe5,0xfb,0xff,0xb5,0xe5,0xfd,0xff,0xb3,0xe4,0xfe,0xff,0xae,0xe1,0xfe,0xff,0xa6,0xe0,0xff,0xff,0x9f,0xdf,0xfd,0xff,0x94,0xdc,0xfe,0xff,0x84,0xd7,0xff,0xff,0x72,0xd3,0xfe,0xff,0x61,0xcf,0xfd,0xff,0x4b,0xcb,0xfd,0xff,0x43,0xca,0xfa,0xff,0x5f,0xd0,0xfb,0xff,0x98,0xdc,0xff,0xff,0xa7,0xdf,0xff,0xff,0xad,0xe2,0xfe,0xff,0xbe,0xe9,0xff,0xff,0xba,0xe7,0xfc,0xff,0xc1,0xe7,0xfa,0xff,0xda,0xf0,0xff,0xff,0xc8,0xec,0xfc,0xff,0xaf,0xe2,0xf8,0xff,0xd1,0xee,0xfe,0xff,0xd9,0xf1,0xfe,0xff,0xcd,0xeb,0xfa,0xff,0xd1,0xed,0xfe,0xff,0xd8,0xef,0xff,0xff,0xcf,0xec,0xfe,0xff,0xc5,0xe9,0xfd,0xff,0xb2,0xe4,0xfe,0xff,0x91,0xda,0xfb,0xff,0x67,0xcf,0xf9,0xff,0x46,0xc8,0xfb,0xff,0x37,0xc6,0xfe,0xff,0x1d,0xc1,0xfb,0xff,0x25,0xc3,0xfb,0xff,0x4c,0xc9,0xff,0xff,0x4b,0xcb,0xfd,0xff,0x3b,0xc8,0xf9,0xff,0x30,0xc5,0xfd,0xff,0x1e,0xbe,0xfd,0xff,0x12,0xb6,0xfd,0xff,0x10,0xae,0xfd,0xff,0x12,0xaf,0xfd,0xff,0x11,0xb6,0xfe,0xff,0x28,0xc3,0xfe,0xff,0x5b,0xcc,0xfe,0xff,0x76,0xd3,0xff,0xff,0x81,0xd7,0xfd,0xff,0x90,0xdc,0xfd,0xff,0x9c,0xde,0xfd,0xff,0x9e,0xdd,0xfc,0xff,0x9f,0xdd,0xfe,0xff,0x98,0xdc,0xfe,0xff,0x8c,0xd9,0xfe,0xff,0x7f,0xd6,0xfd,0xff,0x71,0xd2,0xfc,0xff,0x68,0xd0,0xfd,0xff,0x5c,0xcb,0xff,0xff,0x4e,0xca,0xfd,0xff,0x41,0xc7,0xfd,0xff,0x2a,0xc3,0xff,0xff,0x1a,0xbe,0xfd,0xff,0x15,0xbb,0xfc,0xff,0x14,0xbb,0xfc,0xff,0x22,0xbc,0xfa,0xff,0x14,0xbd,0xfa,0xff,0x35,0xc4,0xfb,0xff,0x79,0xd4,0xfd,0xff,0x8c,0xda,0xfb,0xff,0x98,0xdc,0xfc,0xff,0x9e,0xde,0xfc,0xff,0xa2,0xdd,0xfc,0xff,0xac,0xdf,0xfe,0xff,0xb0,0xe0,0xfe,0xff,0xab,0xdf,0xfc,0xff,0xa1,0xde,0xfc,0xff,0x99,0xdb,0xff,0xff,0x81,0xd5,0xfa,0xff,0x75,0xd3,0xfa,0xff,0x79,0xd4,0xff,0xff,0x5f,0xcd,0xfc,0xff,0x4c,0xc7,0xfa,0xff,0x85,0xd8,0xfc,0xff,0xab,0xe2,0xfb,0xff,0xbb,0xe4,0xfc,0xff,0xb7,0xe6,0xfd,0xff,0xa0,0xe0,0xf9,0xff,0xac,0xdf,0xfa,0xff,0xcf,0xe9,0xff,0xff,0xd7,0xee,0xfc,0xff,0xd4,0xee,0xfb,0xff,0xc7,0xe8,0xfa,0xff,0xb7,0xe3,0xfc,0xff,0xb5,0xe3,0xfc,0xff,0xba,0xe5,0xfc,0xff,0xba,0xe5,0xfb,0xff,0xac,0xdf,0xfb,0xff,0x9a,0xdb,0xfe,0xff,0x8c,0xd4,0xfd,0xff,0x7f,0xd3,0xfc,0xff,0x77,0xd1,0xfb,0xff,0x5d,0xcc,0xfb,0xff,0x21,0xbb,0xfb,0xff,0x07,0x9e,0xfa,0xff,0x0b,0x8e,0xf6,0xff,0x0e,0x8c,0xf9,0xff,0x06,0x6e,0xe7,0xff,0x07,0x62,0xe4,0xff,0x08,0x73,0xec,0xff,0x03,0x80,0xef,0xff,0x07,0x95,0xf8,0xff,0x0d,0x9b,0xf8,0xff,0xbc,0xe3,0xfc,0x50,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf8,0x00,0xfe,0xec,0xf3,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xff,0xff,0x00,0xd2,0xd9,0xe9,0x43,0x24,0x46,0x95,0xff,0x15,0x3a,0x93,0xff,0x18,0x46,0xab,0xff,0x16,0x49,0xb6,0xff,0x14,0x4b,0xbc,0xff,0x1a,0x6f,0xe3,0xff,0x1d,0x7d,0xf3,0xff,0x18,0x7c,0xee,0xff,0x19,0xa0,0xfc,0xff,0x18,0xb9,0xfe,0xff,0x15,0xbb,0xfd,0xff,0x2f,0xc2,0xfd,0xff,0x57,0xce,0xfd,0xff,0x62,0xd1,0xfb,0xff,0x70,0xd4,0xfc,0xff,0x81,0xd8,0xfc,0xff,0x83,0xd7,0xfd,0xff,0x91,0xdc,0xfc,0xff,0xae,0xe4,0xfb,0xff,0xba,0xe4,0xfd,0xff,0xb8,0xe5,0xfc,0xff,0xb8,0xe4,0xfd,0xff,0xb8,0xe4,0xfd,0xff,0xb6,0xe5,0xfc,0xff,0xb5,0xe5,0xfc,0xff,0xb4,0xe4,0xfe,0xff,0xaf,0xe1,0xfe,0xff,0xa6,0xe0,0xff,0xff,0x9e,0xde,0xfe,0xff,0x93,0xdb,0xfe,0xff,0x83,0xd6,0xff,0xff,0x70,0xd2,0xfd,0xff,0x5d,0xce,0xfc,0xff,0x52,0xc9,0xf9,0xff,0x75,0xd3,0xfc,0xff,0x9f,0xdf,0xfe,0xff,0xb6,0xe7,0xfd,0xff,0xb6,0xe5,0xfb,0xff,0xc3,0xea,0xfe,0xff,0xc6,0xea,0xfd,0xff,0xbe,0xe7,0xf8,0xff,0xd9,0xf2,0xfe,0xff,0xd1,0xee,0xfb,0xff,0xb4,0xe4,0xf8,0xff,0xd5,0xf1,0xfd,0xff,0xd8,0xf0,0xfe,0xff,0xc7,0xe9,0xfb,0xff,0xd0,0xed,0xfd,0xff,0xd9,0xf1,0xff,0xff,0xd0,0xee,0xfe,0xff,0xc7,0xeb,0xfd,0xff,0xbf,0xe9,0xfc,0xff,0xab,0xe2,0xfe,0xff,0x89,0xd9,0xfd,0xff,0x60,0xd0,0xfc,0xff,0x41,0xc8,0xfe,0xff,0x31,0xc6,0xfd,0xff,0x2d,0xc5,0xff,0xff,0x2b,0xc3,0xff,0xff,0x2b,0xc2,0xfe,0xff,0x1e,0xc1,0xf8,0xff,0x16,0xbe,0xf9,0xff,0x16,0xba,0xfe,0xff,0x0f,0xb1,0xfe,0xff,0x11,0xaa,0xfe,0xff,0x11,0xa6,0xff,0xff,0x0f,0xa4,0xfc,0xff,0x0f,0xae,0xfc,0xff,0x18,0xbb,0xff,0xff,0x47,0xc9,0xff,0xff,0x75,0xd2,0xfd,0xff,0x87,0xd9,0xfd,0xff,0x94,0xdd,0xfd,0xff,0x9d,0xde,0xfc,0xff,0xa1,0xde,0xfc,0xff,0xa1,0xdd,0xfd,0xff,0x9b,0xdd,0xfe,0xff,0x8c,0xda,0xfe,0xff,0x7f,0xd6,0xfe,0xff,0x74,0xd3,0xfc,0xff,0x6a,0xd1,0xfd,0xff,0x5d,0xce,0xff,0xff,0x55,0xcc,0xfe,0xff,0x4e,0xcb,0xfd,0xff,0x3e,0xc8,0xfd,0xff,0x30,0xc5,0xfd,0xff,0x28,0xc2,0xfc,0xff,0x1b,0xbe,0xfd,0xff,0x08,0xb8,0xfc,0xff,0x03,0xb2,0xfb,0xff,0x1f,0xb8,0xfd,0xff,0x5e,0xcf,0xfd,0xff,0x74,0xd4,0xfd,0xff,0x85,0xd8,0xfb,0xff,0x96,0xdd,0xfc,0xff,0xa0,0xdd,0xff,0xff,0xae,0xe0,0xfd,0xff,0xb3,0xe3,0xfc,0xff,0xb0,0xe2,0xfc,0xff,0xac,0xe1,0xfc,0xff,0xa8,0xdf,0xfd,0xff,0x92,0xda,0xf9,0xff,0x72,0xd4,0xf9,0xff,0x7f,0xd5,0xfd,0xff,0x7f,0xd5,0xfd,0xff,0x65,0xcd,0xfc,0xff,0x78,0xd4,0xf8,0xff,0xaa,0xe1,0xfd,0xff,0xc3,0xe7,0xfc,0xff,0xc7,0xe9,0xfc,0xff,0xb9,0xe6,0xfa,0xff,0xaf,0xe0,0xfb,0xff,0xcc,0xe9,0xfe,0xff,0xd8,0xee,0xfb,0xff,0xd7,0xef,0xfb,0xff,0xc7,0xe9,0xfa,0xff,0xb8,0xe3,0xfd,0xff,0xb2,0xe2,0xfc,0xff,0xb7,0xe4,0xfa,0xff,0xbb,0xe5,0xfc,0xff,0xaf,0xe1,0xfc,0xff,0x98,0xda,0xfd,0xff,0x82,0xd3,0xfc,0xff,0x73,0xd1,0xfc,0xff,0x6c,0xcf,0xfc,0xff,0x57,0xca,0xfc,0xff,0x21,0xbb,0xfc,0xff,0x04,0x97,0xf5,0xff,0x0b,0x86,0xf4,0xff,0x0e,0x8a,0xfa,0xff,0x06,0x6d,0xe6,0xff,0x07,0x61,0xe2,0xff,0x0b,0x78,0xef,0xff,0x06,0x89,0xf2,0xff,0x0a,0x9e,0xfa,0xff,0x00,0x99,0xf6,0xff,0x80,0xca,0xf9,0xa1,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xef,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xff,0xf9,0xfc,0x00,0xff,0xff,0xff,0x00,0x9b,0xaa,0xcd,0x8d,0x12,0x38,0x8c,0xff,0x17,0x3d,0x95,0xff,0x1a,0x47,0xab,0xff,0x18,0x4b,0xb5,0xff,0x14,0x49,0xb8,0xff,0x1b,0x68,0xde,0xff,0x1e,0x7a,0xf2,0xff,0x15,0x73,0xea,0xff,0x18,0x98,0xf9,0xff,0x1a,0xb3,0xfd,0xff,0x15,0xb5,0xfe,0xff,0x16,0xb3,0xfb,0xff,0x34,0xc5,0xfd,0xff,0x55,0xcf,0xfd,0xff,0x6c,0xd2,0xfc,0xff,0x77,0xd6,0xfd,0xff,0x72,0xd1,0xfc,0xff,0x7b,0xd6,0xfc,0xff,0xa2,0xe0,0xfb,0xff,0xb6,0xe4,0xfc,0xff,0xb8,0xe5,0xfb,0xff,0xb8,0xe4,0xfc,0xff,0xb8,0xe4,0xfe,0xff,0xb8,0xe5,0xfe,0xff,0xb4,0xe4,0xfc,0xff,0xb4,0xe3,0xfe,0xff,0xaf,0xe1,0xff,0xff,0xa7,0xdf,0xfe,0xff,0x9d,0xde,0xfe,0xff,0x8f,0xda,0xfe,0xff,0x81,0xd5,0xff,0xff,0x6e,0xd0,0xfd,0xff,0x5a,0xcc,0xfa,0xff,0x6c,0xd1,0xfa,0xff,0xa1,0xdf,0xfe,0xff,0xbe,0xe7,0xff,0xff,0xc3,0xea,0xfa,0xff,0xd0,0xed,0xfc,0xff,0xd0,0xee,0xfe,0xff,0xc9,0xe9,0xfa,0xff,0xdc,0xf1,0xfd,0xff,0xd2,0xef,0xfb,0xff,0xc5,0xea,0xf7,0xff,0xdc,0xf4,0xfd,0xff,0xd7,0xef,0xfd,0xff,0xc7,0xe9,0xfb,0xff,0xd3,0xef,0xfd,0xff,0xd8,0xef,0xfe,0xff,0xd2,0xed,0xfd,0xff,0xcc,0xed,0xfe,0xff,0xc6,0xec,0xfc,0xff,0xbe,0xe8,0xfc,0xff,0xaa,0xe1,0xfe,0xff,0x89,0xd9,0xff,0xff,0x65,0xd1,0xfe,0xff,0x44,0xc8,0xff,0xff,0x31,0xc6,0xff,0xff,0x28,0xc2,0xfe,0xff,0x18,0xb8,0xfe,0xff,0x14,0xb8,0xfe,0xff,0x18,0xbe,0xfe,0xff,0x15,0xb7,0xfe,0xff,0x12,0xaf,0xfe,0xff,0x11,0xab,0xfd,0xff,0x11,0xa8,0xfd,0xff,0x10,0xa7,0xfd,0xff,0x10,0xa8,0xfc,0xff,0x0f,0xb0,0xfc,0xff,0x13,0xbb,0xfd,0xff,0x3c,0xc9,0xfe,0xff,0x73,0xd1,0xfc,0xff,0x86,0xd9,0xfd,0xff,0x94,0xdd,0xfe,0xff,0xa1,0xdf,0xfd,0xff,0xa9,0xdf,0xfd,0xff,0xa8,0xdf,0xfd,0xff,0x9f,0xde,0xfe,0xff,0x94,0xdb,0xfd,0xff,0x87,0xd8,0xfc,0xff,0x7c,0xd5,0xfc,0xff,0x70,0xd3,0xfc,0xff,0x68,0xd1,0xfe,0xff,0x69,0xcf,0xfe,0xff,0x63,0xce,0xfe,0xff,0x5d,0xce,0xfe,0xff,0x55,0xcb,0xfc,0xff,0x4f,0xcb,0xfe,0xff,0x49,0xc8,0xfe,0xff,0x37,0xc4,0xfd,0xff,0x22,0xbd,0xfb,0xff,0x0d,0xb4,0xfa,0xff,0x11,0xb6,0xf6,0xff,0x27,0xbf,0xfa,0xff,0x4c,0xca,0xfc,0xff,0x87,0xd7,0xfe,0xff,0x9d,0xdd,0xfe,0xff,0xaa,0xe1,0xfc,0xff,0xb2,0xe2,0xfb,0xff,0xb4,0xe4,0xfd,0xff,0xb8,0xe4,0xfd,0xff,0xb6,0xe3,0xfc,0xff,0x97,0xdd,0xf9,0xff,0x66,0xce,0xfa,0xff,0x76,0xd4,0xfc,0xff,0x86,0xd8,0xfc,0xff,0x7b,0xd5,0xfd,0xff,0x7a,0xd3,0xf9,0xff,0xa0,0xdf,0xfc,0xff,0xc3,0xe9,0xfb,0xff,0xcb,0xeb,0xfc,0xff,0xca,0xe9,0xfc,0xff,0xb6,0xe2,0xfc,0xff,0xc2,0xe8,0xfc,0xff,0xd6,0xed,0xfc,0xff,0xd8,0xee,0xfb,0xff,0xcb,0xea,0xfc,0xff,0xba,0xe4,0xfe,0xff,0xae,0xe2,0xfb,0xff,0xb4,0xe3,0xfb,0xff,0xba,0xe3,0xfc,0xff,0xb0,0xe1,0xfb,0xff,0x98,0xda,0xfd,0xff,0x77,0xd3,0xfa,0xff,0x62,0xcc,0xf7,0xff,0x5e,0xcb,0xf9,0xff,0x4f,0xc8,0xfa,0xff,0x1f,0xba,0xfc,0xff,0x04,0x93,0xf5,0xff,0x08,0x7d,0xf0,0xff,0x0d,0x88,0xfc,0xff,0x04,0x6a,0xe4,0xff,0x09,0x63,0xe3,0xff,0x0c,0x7d,0xf4,0xff,0x07,0x90,0xf5,0xff,0x0b,0xa4,0xfa,0xff,0x00,0x9b,0xf6,0xff,0x42,0xb1,0xf7,0xdf,0xf9,0xfc,0xff,0x0d,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0x64,0x7b,0xb2,0xc2,0x11,0x37,0x8c,0xff,0x1a,0x3f,0x96,0xff,0x1b,0x48,0xa9,0xff,0x18,0x4c,0xb4,0xff,0x15,0x4b,0xb7,0xff,0x1d,0x6a,0xe1,0xff,0x1c,0x79,0xf2,0xff,0x14,0x6f,0xe7,0xff,0x19,0x93,0xf8,0xff,0x1b,0xad,0xfe,0xff,0x18,0xb0,0xff,0xff,0x16,0xb0,0xfc,0xff,0x22,0xbd,0xfb,0xff,0x45,0xc9,0xfc,0xff,0x6b,0xd0,0xfe,0xff,0x70,0xd2,0xfc,0xff,0x5a,0xca,0xfb,0xff,0x68,0xcf,0xfc,0xff,0x96,0xdd,0xfc,0xff,0xae,0xe4,0xfc,0xff,0xb5,0xe4,0xfd,0xff,0xb6,0xe5,0xfd,0xff,0xb8,0xe5,0xfc,0xff,0xb7,0xe5,0xfe,0xff,0xb4,0xe3,0xfd,0xff,0xb2,0xe2,0xfe,0xff,0xac,0xe1,0xfd,0xff,0xa4,0xdf,0xfe,0xff,0x98,0xdd,0xfd,0xff,0x87,0xd8,0xfd,0xff,0x78,0xd2,0xfd,0xff,0x67,0xcf,0xfc,0xff,0x59,0xcc,0xfa,0xff,0x85,0xd7,0xfb,0xff,0xba,0xe8,0xfe,0xff,0xc9,0xeb,0xfc,0xff,0xcc,0xef,0xfb,0xff,0xd6,0xf1,0xfd,0xff,0xd2,0xeb,0xf9,0xff,0xdd,0xf3,0xfe,0xff,0xd6,0xf2,0xfb,0xff,0xcc,0xea,0xf8,0xff,0xe2,0xf6,0xfe,0xff,0xd6,0xf0,0xfd,0xff,0xc9,0xea,0xfa,0xff,0xd3,0xef,0xfe,0xff,0xd1,0xee,0xfe,0xff,0xcf,0xec,0xfc,0xff,0xcf,0xed,0xfe,0xff,0xce,0xed,0xfe,0xff,0xc7,0xeb,0xfe,0xff,0xbd,0xe7,0xfe,0xff,0xa9,0xe1,0xfe,0xff,0x8b,0xda,0xfd,0xff,0x6a,0xd2,0xfe,0xff,0x44,0xc9,0xfe,0xff,0x2b,0xc2,0xfd,0xff,0x1a,0xb9,0xfd,0xff,0x11,0xb3,0xfe,0xff,0x0f,0xb1,0xfe,0xff,0x12,0xb3,0xfe,0xff,0x13,0xb0,0xfd,0xff,0x12,0xab,0xfc,0xff,0x13,0xaa,0xfe,0xff,0x12,0xaa,0xfd,0xff,0x11,0xab,0xfc,0xff,0x14,0xaf,0xfe,0xff,0x0f,0xb6,0xfe,0xff,0x18,0xbe,0xfd,0xff,0x43,0xcb,0xfc,0xff,0x6e,0xd2,0xfd,0xff,0x86,0xd7,0xff,0xff,0x94,0xdc,0xff,0xff,0xa1,0xde,0xfe,0xff,0xaa,0xdf,0xfd,0xff,0xa9,0xdf,0xff,0xff,0xa0,0xde,0xff,0xff,0x99,0xdd,0xfe,0xff,0x8d,0xd9,0xfe,0xff,0x81,0xd7,0xfc,0xff,0x78,0xd5,0xfc,0xff,0x70,0xd4,0xfd,0xff,0x70,0xd2,0xfe,0xff,0x6f,0xd2,0xfd,0xff,0x6f,0xd3,0xfd,0xff,0x6f,0xd3,0xfe,0xff,0x6f,0xd2,0xff,0xff,0x6e,0xd0,0xff,0xff,0x65,0xce,0xfc,0xff,0x58,0xce,0xfa,0xff,0x3c,0xc7,0xfe,0xff,0x16,0xb6,0xfc,0xff,0x06,0xaa,0xfb,0xff,0x10,0xb4,0xfc,0xff,0x4b,0xc9,0xfd,0xff,0x89,0xda,0xfe,0xff,0xa0,0xdf,0xfd,0xff,0xb2,0xe3,0xfe,0xff,0xba,0xe9,0xfd,0xff,0xc3,0xe9,0xfe,0xff,0xca,0xeb,0xfe,0xff,0xaa,0xe3,0xfb,0xff,0x5a,0xca,0xf6,0xff,0x5e,0xcf,0xfb,0xff,0x87,0xd8,0xfc,0xff,0x8c,0xd9,0xfc,0xff,0x82,0xd6,0xfa,0xff,0x8f,0xda,0xfa,0xff,0xb9,0xe7,0xfc,0xff,0xc9,0xeb,0xfa,0xff,0xce,0xeb,0xfc,0xff,0xbe,0xe7,0xfc,0xff,0xb9,0xe5,0xfa,0xff,0xcf,0xec,0xfd,0xff,0xd7,0xed,0xfc,0xff,0xd1,0xec,0xfe,0xff,0xbe,0xe5,0xfd,0xff,0xaa,0xe1,0xfc,0xff,0xae,0xe1,0xfb,0xff,0xb6,0xe1,0xfd,0xff,0xaf,0xe0,0xfd,0xff,0x97,0xda,0xfb,0xff,0x70,0xd0,0xf9,0xff,0x51,0xc8,0xf9,0xff,0x4c,0xc8,0xfb,0xff,0x45,0xc7,0xfb,0xff,0x1c,0xba,0xfc,0xff,0x07,0x90,0xf5,0xff,0x09,0x79,0xf0,0xff,0x0e,0x86,0xfb,0xff,0x06,0x67,0xe3,0xff,0x09,0x5b,0xdd,0xff,0x08,0x7b,0xf0,0xff,0x05,0x8a,0xf3,0xff,0x0a,0x9e,0xf9,0xff,0x04,0x9c,0xf7,0xff,0x17,0x9f,0xf5,0xfe,0xd5,0xee,0xfe,0x33,0xff,0xff,0xff,0x00,0xff,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xe8,0xeb,0xf3,0x1b,0x3b,0x58,0x9d,0xf7,0x15,0x3a,0x90,0xff,0x1a,0x41,0x96,0xff,0x1a,0x48,0xa8,0xff,0x1a,0x4c,0xb3,0xff,0x18,0x4c,0xb8,0xff,0x1d,0x6a,0xe1,0xff,0x1b,0x78,0xf1,0xff,0x17,0x70,0xe8,0xff,0x1b,0x92,0xf9,0xff,0x1d,0xaa,0xff,0xff,0x19,0xac,0xff,0xff,0x1a,0xb2,0xfe,0xff,0x1d,0xba,0xfe,0xff,0x33,0xc3,0xfd,0xff,0x65,0xcf,0xff,0xff,0x67,0xd0,0xfc,0xff,0x4c,0xc9,0xfc,0xff,0x5e,0xce,0xfd,0xff,0x90,0xdc,0xfe,0xff,0xa4,0xe1,0xfc,0xff,0xac,0xe1,0xfc,0xff,0xb0,0xe4,0xfd,0xff,0xb7,0xe5,0xfd,0xff,0xb8,0xe4,0xfe,0xff,0xb2,0xe3,0xfe,0xff,0xae,0xe2,0xfe,0xff,0xa9,0xdf,0xfd,0xff,0x9e,0xdf,0xfd,0xff,0x91,0xda,0xfd,0xff,0x7f,0xd7,0xfd,0xff,0x6e,0xd2,0xfd,0xff,0x5d,0xce,0xfe,0xff,0x5d,0xce,0xfc,0xff,0x9e,0xdd,0xfe,0xff,0xc4,0xe9,0xfe,0xff,0xd0,0xee,0xfd,0xff,0xdb,0xf3,0xfc,0xff,0xd8,0xef,0xfb,0xff,0xe1,0xf3,0xfe,0xff,0xdc,0xf3,0xf9,0xff,0xd2,0xed,0xf8,0xff,0xe2,0xf6,0xff,0xff,0xd1,0xee,0xfa,0xff,0xca,0xeb,0xfb,0xff,0xd0,0xef,0xfe,0xff,0xcc,0xea,0xfe,0xff,0xc5,0xe9,0xfe,0xff,0xc7,0xea,0xff,0xff,0xcc,0xeb,0xff,0xff,0xcd,0xec,0xff,0xff,0xc6,0xea,0xfe,0xff,0xbc,0xe7,0xfd,0xff,0xa9,0xe1,0xfe,0xff,0x8c,0xda,0xfc,0xff,0x6c,0xd2,0xfd,0xff,0x43,0xc9,0xfd,0xff,0x20,0xc0,0xfc,0xff,0x14,0xb8,0xfe,0xff,0x13,0xb2,0xfe,0xff,0x11,0xb0,0xfe,0xff,0x12,0xae,0xfe,0xff,0x13,0xad,0xfd,0xff,0x13,0xac,0xfd,0xff,0x13,0xab,0xfd,0xff,0x13,0xac,0xfe,0xff,0x12,0xad,0xfe,0xff,0x14,0xb1,0xff,0xff,0x11,0xb8,0xfe,0xff,0x20,0xc0,0xfc,0xff,0x4b,0xcb,0xfb,0xff,0x6e,0xd2,0xfd,0xff,0x84,0xd7,0xff,0xff,0x90,0xdb,0xfe,0xff,0x9c,0xdd,0xfc,0xff,0xa2,0xde,0xfc,0xff,0xa2,0xde,0xfd,0xff,0x9e,0xdf,0xfc,0xff,0x96,0xdc,0xfe,0xff,0x8b,0xd9,0xfe,0xff,0x83,0xd7,0xfd,0xff,0x7b,0xd4,0xfd,0xff,0x74,0xd4,0xff,0xff,0x75,0xd3,0xfe,0xff,0x75,0xd3,0xfe,0xff,0x78,0xd4,0xfd,0xff,0x79,0xd4,0xfd,0xff,0x7b,0xd4,0xfe,0xff,0x7a,0xd3,0xfd,0xff,0x74,0xd4,0xfa,0xff,0x6f,0xd3,0xfa,0xff,0x6a,0xcf,0xfc,0xff,0x48,0xca,0xfd,0xff,0x15,0xb5,0xf9,0xff,0x07,0xa5,0xfc,0xff,0x13,0xb2,0xfa,0xff,0x3d,0xc8,0xfc,0xff,0x75,0xd4,0xfd,0xff,0xa6,0xdf,0xfc,0xff,0xbf,0xe7,0xfd,0xff,0xc5,0xe9,0xfc,0xff,0xcb,0xed,0xfb,0xff,0xc5,0xeb,0xfe,0xff,0x6a,0xd2,0xf7,0xff,0x4d,0xca,0xfa,0xff,0x7f,0xd7,0xfe,0xff,0x96,0xda,0xfd,0xff,0x90,0xd9,0xfc,0xff,0x88,0xd7,0xfb,0xff,0xac,0xe1,0xfd,0xff,0xc7,0xe9,0xfb,0xff,0xcd,0xeb,0xfc,0xff,0xc9,0xe9,0xfe,0xff,0xb9,0xe4,0xfa,0xff,0xc2,0xea,0xfe,0xff,0xd2,0xed,0xfd,0xff,0xd0,0xec,0xfd,0xff,0xc0,0xe6,0xfd,0xff,0xaa,0xe0,0xfd,0xff,0xa9,0xde,0xfc,0xff,0xae,0xdd,0xfd,0xff,0xa9,0xde,0xfd,0xff,0x90,0xd9,0xfb,0xff,0x6b,0xcf,0xfc,0xff,0x2f,0xc2,0xfb,0xff,0x25,0xbd,0xfb,0xff,0x38,0xc5,0xfe,0xff,0x1b,0xb8,0xfe,0xff,0x08,0x8e,0xf5,0xff,0x0c,0x75,0xee,0xff,0x0e,0x81,0xf8,0xff,0x0b,0x62,0xe0,0xff,0x05,0x4d,0xcf,0xff,0x0c,0x74,0xee,0xff,0x07,0x7f,0xf1,0xff,0x07,0x8b,0xf3,0xff,0x08,0x96,0xf8,0xff,0x03,0x96,0xf4,0xff,0xa4,0xd9,0xfc,0x71,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xc3,0xcb,0xe1,0x5a,0x20,0x42,0x92,0xff,0x1b,0x3f,0x94,0xff,0x1c,0x43,0x99,0xff,0x1b,0x48,0xa8,0xff,0x1d,0x4d,0xb2,0xff,0x1a,0x4d,0xb8,0xff,0x1d,0x6b,0xe0,0xff,0x1b,0x78,0xf0,0xff,0x19,0x72,0xea,0xff,0x1c,0x92,0xfa,0xff,0x1c,0xa8,0xff,0xff,0x19,0xa9,0xfd,0xff,0x1a,0xaf,0xfd,0xff,0x1c,0xb6,0xfe,0xff,0x23,0xbf,0xfc,0xff,0x51,0xcc,0xfd,0xff,0x4f,0xcc,0xfd,0xff,0x2c,0xc4,0xfb,0xff,0x50,0xcc,0xfc,0xff,0x8f,0xd9,0xfe,0xff,0x9f,0xde,0xfd,0xff,0x9f,0xde,0xfb,0xff,0xa4,0xe1,0xfc,0xff,0xb0,0xe3,0xfd,0xff,0xb1,0xe2,0xfe,0xff,0xae,0xe1,0xfe,0xff,0xa7,0xe0,0xfd,0xff,0xa1,0xdf,0xfd,0xff,0x96,0xde,0xfd,0xff,0x89,0xd8,0xff,0xff,0x7d,0xd5,0xfe,0xff,0x6e,0xd1,0xfd,0xff,0x58,0xcc,0xfd,0xff,0x6f,0xd4,0xfb,0xff,0xaa,0xe3,0xfc,0xff,0xc4,0xe8,0xfc,0xff,0xdd,0xf1,0xff,0xff,0xe1,0xf1,0xfc,0xff,0xe6,0xf6,0xfe,0xff,0xe2,0xf3,0xfc,0xff,0xda,0xf0,0xf8,0xff,0xe0,0xf6,0xfe,0xff,0xd4,0xed,0xfb,0xff,0xcf,0xec,0xfc,0xff,0xd0,0xee,0xff,0xff,0xc0,0xe7,0xfd,0xff,0xb8,0xe7,0xfd,0xff,0xbf,0xe8,0xff,0xff,0xc5,0xe9,0xff,0xff,0xc9,0xea,0xfe,0xff,0xca,0xea,0xfe,0xff,0xc4,0xe9,0xfe,0xff,0xba,0xe7,0xfc,0xff,0xa8,0xe1,0xfe,0xff,0x8c,0xd9,0xfd,0xff,0x6c,0xd2,0xfd,0xff,0x41,0xc9,0xfd,0xff,0x1f,0xc0,0xfe,0xff,0x16,0xb7,0xfe,0xff,0x15,0xb3,0xfe,0xff,0x15,0xb1,0xff,0xff,0x14,0xad,0xfd,0xff,0x14,0xac,0xfd,0xff,0x14,0xad,0xfd,0xff,0x14,0xad,0xfd,0xff,0x13,0xaf,0xfe,0xff,0x14,0xb1,0xff,0xff,0x14,0xb4,0xff,0xff,0x14,0xba,0xfd,0xff,0x2b,0xc3,0xfd,0xff,0x53,0xcc,0xfe,0xff,0x70,0xd2,0xfc,0xff,0x81,0xd7,0xfd,0xff,0x8c,0xdb,0xfd,0xff,0x97,0xdc,0xfd,0xff,0x9a,0xdc,0xfd,0xff,0x97,0xdd,0xfd,0xff,0x92,0xdc,0xfe,0xff,0x8c,0xda,0xfd,0xff,0x86,0xd8,0xfd,0xff,0x83,0xd7,0xfc,0xff,0x7f,0xd5,0xfe,0xff,0x7a,0xd5,0xff,0xff,0x7a,0xd4,0xfe,0xff,0x78,0xd5,0xfd,0xff,0x7a,0xd4,0xfd,0xff,0x7d,0xd4,0xfd,0xff,0x7f,0xd5,0xfe,0xff,0x7f,0xd5,0xfd,0xff,0x7d,0xd5,0xfd,0xff,0x7f,0xd5,0xfe,0xff,0x7d,0xd5,0xfc,0xff,0x70,0xd2,0xfd,0xff,0x38,0xc3,0xfc,0xff,0x08,0xa9,0xfa,0xff,0x0a,0xa9,0xfa,0xff,0x08,0xb3,0xfa,0xff,0x3b,0xc6,0xf8,0xff,0x87,0xd7,0xf9,0xff,0xa8,0xde,0xfe,0xff,0xbb,0xe6,0xfd,0xff,0xc0,0xea,0xfb,0xff,0xc3,0xe9,0xfe,0xff,0x99,0xdf,0xfe,0xff,0x62,0xcc,0xf8,0xff,0x77,0xd4,0xfb,0xff,0x98,0xdb,0xfd,0xff,0x9d,0xdc,0xfe,0xff,0x95,0xd8,0xfb,0xff,0x9c,0xdd,0xfa,0xff,0xbb,0xe8,0xfc,0xff,0xd1,0xea,0xfc,0xff,0xce,0xea,0xfe,0xff,0xb3,0xe4,0xfc,0xff,0xb0,0xe3,0xfb,0xff,0xc9,0xe9,0xfd,0xff,0xcf,0xeb,0xfe,0xff,0xc1,0xe7,0xfd,0xff,0xa8,0xdf,0xfb,0xff,0x9e,0xdb,0xfa,0xff,0x9f,0xde,0xfd,0xff,0x9c,0xdd,0xfb,0xff,0x8e,0xd8,0xfa,0xff,0x6e,0xd0,0xfc,0xff,0x21,0xbd,0xf9,0xff,0x0a,0xb7,0xf6,0xff,0x20,0xbf,0xfb,0xff,0x11,0xb3,0xfd,0xff,0x09,0x8c,0xf5,0xff,0x0c,0x70,0xed,0xff,0x0c,0x7a,0xf4,0xff,0x09,0x5e,0xdc,0xff,0x03,0x49,0xc9,0xff,0x0c,0x74,0xef,0xff,0x06,0x84,0xf6,0xff,0x05,0x8d,0xf3,0xff,0x08,0x92,0xf7,0xff,0x00,0x8b,0xf6,0xff,0x6c,0xb9,0xf7,0xb6,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0x9b,0xa9,0xcc,0x7d,0x18,0x3b,0x8f,0xff,0x1b,0x43,0x96,0xff,0x1d,0x46,0x9b,0xff,0x1c,0x4a,0xa9,0xff,0x1e,0x4e,0xb3,0xff,0x1a,0x50,0xb9,0xff,0x1d,0x6e,0xe2,0xff,0x1e,0x7d,0xf2,0xff,0x1d,0x79,0xeb,0xff,0x1c,0x90,0xf8,0xff,0x1d,0x9f,0xfd,0xff,0x1e,0xa1,0xfe,0xff,0x1b,0xa2,0xfb,0xff,0x1c,0xac,0xfc,0xff,0x1e,0xb8,0xfc,0xff,0x34,0xc4,0xfe,0xff,0x33,0xc3,0xfe,0xff,0x16,0xb9,0xfb,0xff,0x3f,0xc7,0xfb,0xff,0x89,0xd8,0xff,0xff,0x97,0xdc,0xfc,0xff,0x94,0xdb,0xfb,0xff,0x9a,0xde,0xfc,0xff,0xa7,0xe1,0xfe,0xff,0xa9,0xe1,0xfd,0xff,0xa6,0xdf,0xfd,0xff,0x9f,0xdf,0xfd,0xff,0x9a,0xde,0xfd,0xff,0x90,0xdc,0xfc,0xff,0x84,0xd6,0xfe,0xff,0x79,0xd3,0xfd,0xff,0x65,0xd0,0xfa,0xff,0x58,0xcd,0xf9,0xff,0x88,0xda,0xfd,0xff,0xa7,0xe3,0xf8,0xff,0xc9,0xed,0xfd,0xff,0xdf,0xf1,0xfe,0xff,0xe5,0xf5,0xff,0xff,0xe1,0xf4,0xfc,0xff,0xdd,0xf2,0xfa,0xff,0xe2,0xf7,0xfd,0xff,0xd5,0xed,0xf9,0xff,0xd1,0xee,0xfc,0xff,0xc6,0xec,0xfe,0xff,0xb3,0xe3,0xfd,0xff,0xaf,0xe3,0xfe,0xff,0xb2,0xe5,0xfd,0xff,0xb8,0xe7,0xfd,0xff,0xbf,0xe9,0xfe,0xff,0xc4,0xea,0xfe,0xff,0xc6,0xea,0xfe,0xff,0xc1,0xe9,0xfd,0xff,0xb8,0xe7,0xfc,0xff,0xa6,0xe1,0xfe,0xff,0x89,0xd9,0xfe,0xff,0x69,0xd0,0xfd,0xff,0x41,0xc9,0xfd,0xff,0x1f,0xc0,0xfe,0xff,0x16,0xb7,0xfe,0xff,0x16,0xb2,0xfd,0xff,0x18,0xb0,0xff,0xff,0x17,0xaf,0xfe,0xff,0x15,0xae,0xfe,0xff,0x15,0xae,0xfe,0xff,0x16,0xaf,0xfe,0xff,0x17,0xb1,0xfd,0xff,0x16,0xb4,0xfe,0xff,0x11,0xb8,0xff,0xff,0x19,0xbe,0xfd,0xff,0x37,0xc6,0xfd,0xff,0x5c,0xce,0xfe,0xff,0x70,0xd2,0xfb,0xff,0x80,0xd7,0xfc,0xff,0x8b,0xda,0xfd,0xff,0x92,0xdb,0xfd,0xff,0x94,0xdb,0xfe,0xff,0x91,0xda,0xfe,0xff,0x88,0xd9,0xfd,0xff,0x84,0xd9,0xfd,0xff,0x83,0xd7,0xfd,0xff,0x82,0xd6,0xfc,0xff,0x82,0xd5,0xfd,0xff,0x80,0xd5,0xfe,0xff,0x7d,0xd5,0xff,0xff,0x79,0xd5,0xfd,0xff,0x7c,0xd5,0xfd,0xff,0x80,0xd5,0xfe,0xff,0x83,0xd5,0xfd,0xff,0x87,0xd6,0xfc,0xff,0x8d,0xd8,0xfc,0xff,0x8e,0xd8,0xfc,0xff,0x8a,0xd9,0xfe,0xff,0x86,0xd6,0xfd,0xff,0x68,0xd0,0xfe,0xff,0x24,0xbb,0xfd,0xff,0x09,0xa8,0xf7,0xff,0x0d,0xb0,0xfc,0xff,0x26,0xbe,0xfa,0xff,0x79,0xd4,0xfd,0xff,0xa5,0xdf,0xff,0xff,0xb8,0xe7,0xfe,0xff,0xc3,0xe8,0xfd,0xff,0xc6,0xe8,0xfd,0xff,0xba,0xe7,0xfd,0xff,0x97,0xdc,0xfd,0xff,0x83,0xd5,0xfc,0xff,0x96,0xdb,0xfb,0xff,0xa6,0xdf,0xfd,0xff,0xa6,0xde,0xfc,0xff,0x96,0xda,0xf8,0xff,0xac,0xe4,0xfb,0xff,0xc9,0xea,0xfd,0xff,0xcc,0xeb,0xff,0xff,0xb3,0xe3,0xfb,0xff,0x9a,0xda,0xf8,0xff,0xb5,0xe4,0xfd,0xff,0xc5,0xe7,0xfc,0xff,0xc1,0xe7,0xfd,0xff,0xa9,0xe0,0xfb,0xff,0x90,0xd8,0xf9,0xff,0x8b,0xd9,0xfc,0xff,0x93,0xd9,0xfa,0xff,0x8f,0xd8,0xfc,0xff,0x70,0xd2,0xfb,0xff,0x23,0xbb,0xf9,0xff,0x08,0xb0,0xf9,0xff,0x0f,0xb6,0xfd,0xff,0x0b,0xb0,0xfe,0xff,0x09,0x8a,0xf5,0xff,0x08,0x68,0xe8,0xff,0x0e,0x70,0xee,0xff,0x09,0x58,0xd7,0xff,0x07,0x4d,0xcc,0xff,0x0c,0x73,0xef,0xff,0x08,0x88,0xfa,0xff,0x09,0x91,0xf8,0xff,0x08,0x8f,0xf7,0xff,0x00,0x7c,0xf3,0xff,0x42,0x99,0xf4,0xd6,0xf7,0xfa,0xfe,0x03,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0x73,0x87,0xb9,0xc7,0x16,0x39,0x8f,0xff,0x1e,0x44,0x98,0xff,0x1e,0x47,0x9f,0xff,0x1e,0x4c,0xab,0xff,0x1f,0x4f,0xb4,0xff,0x1b,0x50,0xba,0xff,0x1e,0x70,0xe4,0xff,0x21,0x7f,0xf3,0xff,0x1e,0x7b,0xec,0xff,0x1e,0x8e,0xf7,0xff,0x1e,0x94,0xf9,0xff,0x20,0x97,0xfc,0xff,0x1c,0x95,0xfa,0xff,0x1f,0xa0,0xfd,0xff,0x1e,0xae,0xfd,0xff,0x20,0xbc,0xfc,0xff,0x22,0xba,0xfc,0xff,0x18,0xad,0xfa,0xff,0x3b,0xc2,0xfb,0xff,0x7d,0xd7,0xfe,0xff,0x8d,0xda,0xfc,0xff,0x90,0xda,0xfb,0xff,0x96,0xdc,0xfc,0xff,0xa2,0xdd,0xfd,0xff,0xa4,0xde,0xfc,0xff,0xa0,0xdd,0xfc,0xff,0x9b,0xdd,0xfc,0xff,0x92,0xdc,0xfd,0xff,0x8b,0xd9,0xfb,0xff,0x81,0xd4,0xfe,0xff,0x73,0xd1,0xfd,0xff,0x6c,0xd1,0xf9,0xff,0x7e,0xd8,0xfa,0xff,0xa0,0xdd,0xfe,0xff,0xba,0xe6,0xff,0xff,0xd0,0xee,0xfd,0xff,0xe0,0xf4,0xff,0xff,0xe0,0xf3,0xfc,0xff,0xdb,0xf1,0xfa,0xff,0xdf,0xf4,0xfd,0xff,0xd5,0xed,0xfa,0xff,0xd1,0xed,0xfc,0xff,0xbc,0xe8,0xfb,0xff,0xa9,0xe2,0xf9,0xff,0xae,0xe3,0xfb,0xff,0xb2,0xe4,0xfd,0xff,0xb4,0xe5,0xfe,0xff,0xb8,0xe7,0xfd,0xff,0xbe,0xe9,0xfd,0xff,0xc2,0xe8,0xfd,0xff,0xc2,0xe9,0xfd,0xff,0xbe,0xe8,0xfd,0xff,0xb6,0xe6,0xfb,0xff,0xa4,0xe1,0xfe,0xff,0x88,0xd8,0xff,0xff,0x69,0xd0,0xfd,0xff,0x42,0xc9,0xfc,0xff,0x1f,0xbf,0xfe,0xff,0x15,0xb7,0xfe,0xff,0x16,0xb2,0xfd,0xff,0x18,0xb1,0xfe,0xff,0x18,0xb0,0xff,0xff,0x16,0xaf,0xff,0xff,0x16,0xb0,0xff,0xff,0x16,0xb0,0xfe,0xff,0x18,0xb2,0xfd,0xff,0x17,0xb6,0xff,0xff,0x13,0xba,0xff,0xff,0x1e,0xc0,0xfe,0xff,0x3e,0xc7,0xfe,0xff,0x5e,0xce,0xfe,0xff,0x71,0xd2,0xfc,0xff,0x80,0xd7,0xfd,0xff,0x89,0xd9,0xfe,0xff,0x90,0xdb,0xfe,0xff,0x93,0xda,0xfe,0xff,0x8f,0xd9,0xfc,0xff,0x88,0xd8,0xfd,0xff,0x84,0xd8,0xfd,0xff,0x84,0xd7,0xfe,0xff,0x82,0xd6,0xfd,0xff,0x84,0xd6,0xfd,0xff,0x84,0xd6,0xfe,0xff,0x7f,0xd6,0xfd,0xff,0x7a,0xd5,0xfc,0xff,0x7b,0xd5,0xfe,0xff,0x81,0xd6,0xff,0xff,0x8a,0xd7,0xfd,0xff,0x93,0xd9,0xfc,0xff,0x9b,0xdb,0xfc,0xff,0x9c,0xdc,0xfc,0xff,0x98,0xdd,0xfc,0xff,0x94,0xdc,0xfc,0xff,0x8d,0xda,0xfd,0xff,0x67,0xcf,0xfe,0xff,0x20,0xb5,0xf7,0xff,0x0b,0xac,0xf9,0xff,0x1a,0xbc,0xfc,0xff,0x66,0xcf,0xfb,0xff,0xa5,0xe0,0xfc,0xff,0xbb,0xe6,0xfd,0xff,0xc3,0xe8,0xfd,0xff,0xcd,0xea,0xfd,0xff,0xc9,0xea,0xfe,0xff,0xb8,0xe6,0xfd,0xff,0xa4,0xde,0xfe,0xff,0x99,0xdc,0xfd,0xff,0xa4,0xde,0xfd,0xff,0xad,0xe2,0xfd,0xff,0x99,0xda,0xf9,0xff,0x9c,0xdd,0xf9,0xff,0xb9,0xe8,0xfe,0xff,0xc5,0xea,0xfd,0xff,0xb9,0xe6,0xfd,0xff,0x92,0xd8,0xf6,0xff,0x99,0xdb,0xfc,0xff,0xb9,0xe6,0xfe,0xff,0xbe,0xe7,0xfc,0xff,0xab,0xe1,0xfb,0xff,0x88,0xd6,0xfa,0xff,0x7a,0xd4,0xfa,0xff,0x8c,0xd9,0xfb,0xff,0x8d,0xd9,0xfd,0xff,0x71,0xd3,0xfb,0xff,0x23,0xb9,0xfb,0xff,0x04,0xa1,0xfa,0xff,0x0d,0xac,0xfe,0xff,0x0b,0xaa,0xfd,0xff,0x0a,0x85,0xf4,0xff,0x06,0x61,0xe4,0xff,0x0d,0x66,0xe8,0xff,0x06,0x50,0xd1,0xff,0x09,0x4e,0xcf,0xff,0x0c,0x69,0xe8,0xff,0x0a,0x79,0xf0,0xff,0x0d,0x89,0xf7,0xff,0x0b,0x85,0xf5,0xff,0x00,0x71,0xed,0xff,0x1c,0x78,0xea,0xff,0xdf,0xeb,0xfc,0x33,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xf6,0xf7,0xfa,0x07,0x54,0x6b,0xa9,0xd9,0x19,0x3d,0x91,0xff,0x20,0x47,0x9a,0xff,0x20,0x49,0xa3,0xff,0x1f,0x4d,0xad,0xff,0x1f,0x51,0xb5,0xff,0x1d,0x53,0xbe,0xff,0x20,0x72,0xe5,0xff,0x21,0x7e,0xf3,0xff,0x1e,0x7a,0xec,0xff,0x21,0x8d,0xf8,0xff,0x20,0x91,0xf8,0xff,0x20,0x93,0xfa,0xff,0x1e,0x92,0xf9,0xff,0x21,0x9a,0xfe,0xff,0x1e,0xa5,0xfe,0xff,0x22,0xb3,0xfe,0xff,0x20,0xae,0xfa,0xff,0x1c,0xa0,0xfb,0xff,0x27,0xb6,0xfb,0xff,0x54,0xcf,0xfa,0xff,0x84,0xd8,0xfc,0xff,0x8f,0xda,0xfc,0xff,0x8e,0xdb,0xfb,0xff,0x98,0xdc,0xfc,0xff,0x9e,0xdc,0xfb,0xff,0x9e,0xdc,0xfc,0xff,0x9a,0xdb,0xfe,0xff,0x91,0xda,0xfc,0xff,0x84,0xd7,0xfb,0xff,0x75,0xd4,0xfb,0xff,0x74,0xd2,0xf9,0xff,0x8d,0xda,0xfd,0xff,0xa7,0xe2,0xfc,0xff,0xb4,0xe5,0xfb,0xff,0xc3,0xe7,0xfe,0xff,0xd6,0xef,0xfe,0xff,0xda,0xf1,0xfb,0xff,0xd9,0xf0,0xf9,0xff,0xd2,0xf0,0xfb,0xff,0xd0,0xec,0xfa,0xff,0xd2,0xed,0xfd,0xff,0xb5,0xe4,0xfc,0xff,0xa8,0xe1,0xfa,0xff,0xb4,0xe4,0xfc,0xff,0xb9,0xe7,0xfc,0xff,0xb8,0xe6,0xfc,0xff,0xb7,0xe6,0xfc,0xff,0xba,0xe6,0xfc,0xff,0xbe,0xe8,0xfe,0xff,0xc0,0xe8,0xff,0xff,0xc1,0xe8,0xff,0xff,0xbc,0xe7,0xfe,0xff,0xb3,0xe4,0xfd,0xff,0xa0,0xdf,0xfe,0xff,0x85,0xd7,0xfd,0xff,0x68,0xd0,0xfd,0xff,0x43,0xc8,0xfe,0xff,0x21,0xbf,0xfd,0xff,0x17,0xb8,0xff,0xff,0x17,0xb3,0xfd,0xff,0x19,0xb1,0xfd,0xff,0x18,0xb0,0xff,0xff,0x16,0xaf,0xff,0xff,0x17,0xb1,0xff,0xff,0x18,0xb1,0xff,0xff,0x19,0xb4,0xfe,0xff,0x16,0xb7,0xfe,0xff,0x16,0xbb,0xfe,0xff,0x24,0xc3,0xff,0xff,0x42,0xc8,0xfe,0xff,0x5f,0xcf,0xfe,0xff,0x72,0xd3,0xfd,0xff,0x80,0xd6,0xfe,0xff,0x87,0xd7,0xfd,0xff,0x8c,0xd9,0xfd,0xff,0x90,0xdb,0xfc,0xff,0x8f,0xdb,0xfd,0xff,0x8a,0xd9,0xfd,0xff,0x85,0xd7,0xfd,0xff,0x82,0xd6,0xfd,0xff,0x81,0xd6,0xfc,0xff,0x81,0xd6,0xfd,0xff,0x82,0xd7,0xfe,0xff,0x80,0xd7,0xfd,0xff,0x7c,0xd5,0xfd,0xff,0x79,0xd5,0xfd,0xff,0x7f,0xd6,0xfe,0xff,0x8c,0xd7,0xfe,0xff,0x98,0xdb,0xfc,0xff,0xa0,0xdd,0xfc,0xff,0xa5,0xde,0xfd,0xff,0xa6,0xde,0xfe,0xff,0xa4,0xde,0xfe,0xff,0x9f,0xdd,0xfd,0xff,0x94,0xdc,0xfc,0xff,0x63,0xd1,0xfc,0xff,0x14,0xb1,0xf8,0xff,0x0b,0xa7,0xfa,0xff,0x4e,0xc6,0xfc,0xff,0xa3,0xe0,0xfc,0xff,0xba,0xe3,0xfd,0xff,0xc2,0xe8,0xfe,0xff,0xcd,0xeb,0xfd,0xff,0xd3,0xed,0xff,0xff,0xce,0xee,0xfb,0xff,0xc2,0xeb,0xfc,0xff,0xb1,0xe1,0xfd,0xff,0xa8,0xdd,0xfa,0xff,0xad,0xe1,0xfe,0xff,0xa4,0xde,0xfd,0xff,0x8e,0xd8,0xf6,0xff,0xa4,0xe3,0xfb,0xff,0xbe,0xe8,0xfc,0xff,0xbe,0xe8,0xfe,0xff,0x9e,0xdd,0xf8,0xff,0x81,0xd6,0xf8,0xff,0xa5,0xe0,0xfd,0xff,0xb9,0xe5,0xfb,0xff,0xae,0xe1,0xfc,0xff,0x8a,0xd8,0xfc,0xff,0x6f,0xd1,0xf8,0xff,0x80,0xd5,0xfc,0xff,0x83,0xd6,0xfc,0xff,0x6b,0xd1,0xf9,0xff,0x25,0xb8,0xfd,0xff,0x04,0x90,0xf7,0xff,0x0d,0x99,0xfb,0xff,0x0c,0x9e,0xfb,0xff,0x08,0x7e,0xf0,0xff,0x07,0x5e,0xe2,0xff,0x0c,0x5e,0xe2,0xff,0x03,0x4b,0xcb,0xff,0x04,0x49,0xc5,0xff,0x06,0x4e,0xc9,0xff,0x09,0x59,0xd6,0xff,0x0d,0x77,0xef,0xff,0x06,0x70,0xea,0xff,0x00,0x62,0xe2,0xff,0x09,0x64,0xe3,0xff,0xbd,0xd3,0xf7,0x4a,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xe7,0xea,0xf2,0x35,0x3d,0x59,0x9b,0xff,0x1d,0x42,0x93,0xff,0x1f,0x48,0x9d,0xff,0x22,0x4b,0xa6,0xff,0x21,0x4f,0xb0,0xff,0x1e,0x52,0xb7,0xff,0x1e,0x56,0xc0,0xff,0x22,0x75,0xe7,0xff,0x24,0x81,0xf3,0xff,0x20,0x7d,0xec,0xff,0x21,0x90,0xf9,0xff,0x21,0x93,0xfa,0xff,0x20,0x8e,0xf7,0xff,0x1c,0x8a,0xf3,0xff,0x1d,0x95,0xf8,0xff,0x1d,0xa2,0xf8,0xff,0x22,0xab,0xfd,0xff,0x1f,0xa6,0xfc,0xff,0x20,0x9c,0xfa,0xff,0x1d,0xaa,0xfd,0xff,0x28,0xc0,0xfa,0xff,0x71,0xd4,0xfe,0xff,0x8e,0xd9,0xfd,0xff,0x8b,0xdb,0xfb,0xff,0x96,0xdd,0xfa,0xff,0x9c,0xdd,0xfb,0xff,0x9c,0xdb,0xfc,0xff,0x96,0xdb,0xfd,0xff,0x8c,0xd9,0xfc,0xff,0x7f,0xd6,0xfb,0xff,0x75,0xd3,0xf8,0xff,0x8e,0xdb,0xfa,0xff,0xb2,0xe6,0xfc,0xff,0xc3,0xe8,0xfc,0xff,0xc6,0xe9,0xfb,0xff,0xc7,0xea,0xfd,0xff,0xce,0xee,0xfc,0xff,0xd3,0xef,0xfa,0xff,0xd2,0xee,0xfa,0xff,0xc6,0xea,0xf9,0xff,0xbd,0xe7,0xfd,0xff,0xab,0xe0,0xfa,0xff,0xa9,0xe1,0xfa,0xff,0xb4,0xe8,0xfe,0xff,0xc5,0xe9,0xff,0xff,0xc7,0xe9,0xff,0xff,0xc0,0xe8,0xff,0xff,0xbb,0xe6,0xfd,0xff,0xbb,0xe6,0xfc,0xff,0xbb,0xe6,0xfd,0xff,0xbc,0xe6,0xfe,0xff,0xbc,0xe7,0xff,0xff,0xb8,0xe6,0xfe,0xff,0xaf,0xe2,0xfd,0xff,0x99,0xdc,0xfd,0xff,0x80,0xd7,0xfc,0xff,0x64,0xd0,0xfe,0xff,0x3f,0xc7,0xfe,0xff,0x21,0xbf,0xfd,0xff,0x19,0xb8,0xff,0xff,0x18,0xb3,0xfd,0xff,0x19,0xb1,0xfd,0xff,0x17,0xaf,0xfe,0xff,0x16,0xaf,0xff,0xff,0x17,0xb1,0xff,0xff,0x18,0xb2,0xfe,0xff,0x1a,0xb6,0xff,0xff,0x18,0xba,0xfd,0xff,0x1a,0xbf,0xfc,0xff,0x2e,0xc5,0xfe,0xff,0x49,0xcb,0xfb,0xff,0x61,0xcf,0xfe,0xff,0x71,0xd3,0xfc,0xff,0x80,0xd6,0xfc,0xff,0x87,0xd7,0xfb,0xff,0x8c,0xd9,0xfc,0xff,0x90,0xda,0xfd,0xff,0x8f,0xda,0xfe,0xff,0x8a,0xd9,0xfc,0xff,0x86,0xd7,0xfc,0xff,0x83,0xd7,0xfc,0xff,0x80,0xd5,0xfd,0xff,0x7b,0xd4,0xfd,0xff,0x74,0xd4,0xfc,0xff,0x77,0xd4,0xfe,0xff,0x79,0xd4,0xff,0xff,0x79,0xd5,0xfe,0xff,0x79,0xd4,0xfc,0xff,0x86,0xd7,0xfd,0xff,0x97,0xdc,0xfc,0xff,0xa1,0xde,0xfb,0xff,0xab,0xe0,0xfd,0xff,0xb0,0xe3,0xfd,0xff,0xb1,0xe3,0xfd,0xff,0xb0,0xe2,0xfc,0xff,0xa9,0xe1,0xfa,0xff,0x9b,0xde,0xfe,0xff,0x5c,0xcd,0xfd,0xff,0x07,0xa9,0xf8,0xff,0x0c,0xa8,0xf7,0xff,0x6d,0xd2,0xfb,0xff,0xae,0xe2,0xfd,0xff,0xbc,0xe6,0xfd,0xff,0xc6,0xea,0xfc,0xff,0xd4,0xee,0xfc,0xff,0xd9,0xef,0xfb,0xff,0xd7,0xee,0xfc,0xff,0xd1,0xec,0xfd,0xff,0xb4,0xe3,0xfb,0xff,0xa7,0xdf,0xfd,0xff,0xa6,0xe0,0xfe,0xff,0x8e,0xd8,0xf6,0xff,0x92,0xdc,0xf7,0xff,0xb6,0xe4,0xfb,0xff,0xc1,0xe7,0xfd,0xff,0xae,0xe3,0xfc,0xff,0x7d,0xd3,0xf6,0xff,0x8b,0xda,0xfc,0xff,0xab,0xe2,0xfb,0xff,0xad,0xe2,0xfb,0xff,0x90,0xd9,0xfe,0xff,0x5e,0xcd,0xf7,0xff,0x60,0xce,0xf8,0xff,0x6f,0xd0,0xfa,0xff,0x5a,0xca,0xf8,0xff,0x23,0xb9,0xfe,0xff,0x06,0x89,0xf4,0xff,0x09,0x86,0xf3,0xff,0x0d,0x8f,0xf8,0xff,0x07,0x70,0xea,0xff,0x07,0x57,0xdc,0xff,0x0b,0x55,0xd9,0xff,0x03,0x47,0xc6,0xff,0x05,0x46,0xc0,0xff,0x07,0x40,0xb6,0xff,0x05,0x46,0xc0,0xff,0x0b,0x5f,0xdf,0xff,0x06,0x57,0xd8,0xff,0x05,0x54,0xd8,0xff,0x05,0x54,0xd9,0xff,0x9f,0xbc,0xee,0x93,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xcc,0xd3,0xe5,0x3d,0x2b,0x49,0x93,0xff,0x20,0x46,0x95,0xff,0x21,0x4a,0x9f,0xff,0x24,0x4d,0xa9,0xff,0x23,0x52,0xb1,0xff,0x1f,0x54,0xba,0xff,0x1f,0x57,0xc4,0xff,0x24,0x74,0xe4,0xff,0x26,0x83,0xf4,0xff,0x23,0x81,0xf0,0xff,0x23,0x97,0xfd,0xff,0x24,0x9d,0xfd,0xff,0x24,0x96,0xfa,0xff,0x22,0x92,0xf7,0xff,0x22,0xa0,0xf9,0xff,0x24,0xb0,0xfc,0xff,0x24,0xb0,0xfe,0xff,0x20,0xa2,0xf8,0xff,0x1f,0x97,0xf6,0xff,0x20,0xa6,0xfb,0xff,0x1d,0xb6,0xfb,0xff,0x4e,0xc9,0xfc,0xff,0x88,0xda,0xfd,0xff,0x91,0xdc,0xfa,0xff,0x99,0xdd,0xfb,0xff,0x9d,0xdd,0xfb,0xff,0x98,0xdc,0xfb,0xff,0x8d,0xda,0xfc,0xff,0x82,0xd8,0xfc,0xff,0x75,0xd4,0xfa,0xff,0x8c,0xd9,0xfb,0xff,0xbb,0xe5,0xfe,0xff,0xd1,0xee,0xfc,0xff,0xdb,0xf0,0xfd,0xff,0xd8,0xef,0xfd,0xff,0xca,0xea,0xf7,0xff,0xc0,0xe9,0xf9,0xff,0xc6,0xeb,0xfc,0xff,0xc4,0xe9,0xfa,0xff,0xa6,0xe4,0xfb,0xff,0x89,0xd7,0xf9,0xff,0x9a,0xd9,0xfc,0xff,0xbe,0xe7,0xfd,0xff,0xc9,0xec,0xff,0xff,0xcc,0xec,0xff,0xff,0xcc,0xeb,0xff,0xff,0xc4,0xe9,0xff,0xff,0xbb,0xe6,0xfd,0xff,0xb9,0xe5,0xfc,0xff,0xb9,0xe5,0xfe,0xff,0xb9,0xe5,0xfe,0xff,0xb8,0xe5,0xfe,0xff,0xb4,0xe3,0xfe,0xff,0xa8,0xe0,0xfd,0xff,0x91,0xdb,0xfe,0xff,0x7b,0xd5,0xfc,0xff,0x5f,0xcd,0xfd,0xff,0x37,0xc5,0xfe,0xff,0x20,0xbe,0xfe,0xff,0x1b,0xb8,0xfd,0xff,0x19,0xb3,0xfd,0xff,0x19,0xb1,0xfd,0xff,0x18,0xaf,0xfe,0xff,0x18,0xaf,0xfe,0xff,0x18,0xb1,0xfe,0xff,0x19,0xb3,0xfe,0xff,0x1b,0xb7,0xff,0xff,0x1a,0xbb,0xfd,0xff,0x22,0xc2,0xfd,0xff,0x38,0xc7,0xff,0xff,0x4e,0xcb,0xfc,0xff,0x62,0xd0,0xfe,0xff,0x72,0xd2,0xfc,0xff,0x7f,0xd7,0xfb,0xff,0x86,0xd8,0xfc,0xff,0x8c,0xd9,0xfc,0xff,0x8f,0xda,0xfd,0xff,0x8f,0xda,0xfd,0xff,0x8b,0xd9,0xfc,0xff,0x87,0xd7,0xfc,0xff,0x84,0xd6,0xfc,0xff,0x80,0xd5,0xfd,0xff,0x77,0xd4,0xfd,0xff,0x69,0xd1,0xfc,0xff,0x5e,0xcc,0xfb,0xff,0x62,0xcd,0xfc,0xff,0x71,0xd1,0xfd,0xff,0x77,0xd4,0xfc,0xff,0x7d,0xd6,0xfb,0xff,0x90,0xdb,0xfc,0xff,0xa0,0xde,0xfc,0xff,0xad,0xe1,0xfd,0xff,0xb6,0xe5,0xfc,0xff,0xbd,0xe7,0xfa,0xff,0xbd,0xe7,0xf9,0xff,0xb7,0xe5,0xfb,0xff,0xb3,0xe2,0xfc,0xff,0x9e,0xdf,0xfe,0xff,0x4d,0xc7,0xf9,0xff,0x07,0xaa,0xf5,0xff,0x2e,0xbe,0xfc,0xff,0x8e,0xda,0xfd,0xff,0xba,0xe3,0xfd,0xff,0xc1,0xe9,0xfa,0xff,0xd2,0xed,0xfa,0xff,0xe0,0xf0,0xfd,0xff,0xe4,0xf4,0xfc,0xff,0xe3,0xf2,0xfd,0xff,0xbc,0xe3,0xf7,0xff,0x9c,0xda,0xf7,0xff,0xa0,0xdf,0xfb,0xff,0x9a,0xdb,0xfb,0xff,0x8b,0xd7,0xfa,0xff,0xa7,0xde,0xfe,0xff,0xbf,0xe4,0xfd,0xff,0xbc,0xe6,0xfc,0xff,0x8d,0xd6,0xf7,0xff,0x79,0xd4,0xfa,0xff,0x9c,0xe1,0xfc,0xff,0xa4,0xde,0xfa,0xff,0x92,0xd9,0xfe,0xff,0x4d,0xc9,0xf9,0xff,0x24,0xbf,0xf5,0xff,0x4c,0xc5,0xfc,0xff,0x4b,0xc9,0xfc,0xff,0x19,0xb9,0xfe,0xff,0x04,0x86,0xf2,0xff,0x08,0x75,0xef,0xff,0x0f,0x7d,0xf5,0xff,0x06,0x62,0xe1,0xff,0x0a,0x52,0xd6,0xff,0x0b,0x4c,0xcf,0xff,0x05,0x45,0xc3,0xff,0x08,0x44,0xbe,0xff,0x08,0x40,0xb5,0xff,0x03,0x47,0xbe,0xff,0x0c,0x61,0xe3,0xff,0x09,0x52,0xd2,0xff,0x08,0x44,0xbf,0xff,0x00,0x39,0xb7,0xff,0x72,0x91,0xd0,0x9c,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xb0,0xbc,0xd6,0x84,0x25,0x45,0x91,0xff,0x22,0x48,0x98,0xff,0x23,0x4d,0xa0,0xff,0x26,0x4e,0xac,0xff,0x23,0x52,0xb2,0xff,0x23,0x57,0xbc,0xff,0x22,0x59,0xc6,0xff,0x25,0x73,0xe1,0xff,0x26,0x85,0xf3,0xff,0x25,0x87,0xf3,0xff,0x29,0xa1,0xff,0xff,0x27,0xaa,0xff,0xff,0x24,0xa4,0xfb,0xff,0x25,0xa4,0xfb,0xff,0x29,0xb0,0xff,0xff,0x28,0xbb,0xff,0xff,0x26,0xb2,0xfe,0xff,0x20,0x9e,0xf5,0xff,0x20,0x98,0xf7,0xff,0x21,0xa6,0xfc,0xff,0x1a,0xb5,0xfd,0xff,0x34,0xc3,0xf8,0xff,0x82,0xd9,0xfd,0xff,0xa0,0xde,0xfc,0xff,0xa1,0xde,0xfc,0xff,0x9f,0xdd,0xfa,0xff,0x96,0xda,0xfa,0xff,0x8a,0xd8,0xfc,0xff,0x7d,0xd6,0xfb,0xff,0x7b,0xd4,0xf9,0xff,0xb5,0xe3,0xfc,0xff,0xda,0xf0,0xfd,0xff,0xe2,0xf3,0xfb,0xff,0xe4,0xf3,0xfd,0xff,0xdc,0xf0,0xfd,0xff,0xc8,0xeb,0xf9,0xff,0xb8,0xe6,0xf9,0xff,0xb3,0xe4,0xfc,0xff,0x8e,0xdd,0xfc,0xff,0x5d,0xcf,0xf8,0xff,0x86,0xd8,0xf8,0xff,0xc3,0xe9,0xfe,0xff,0xd2,0xee,0xff,0xff,0xd4,0xee,0xfe,0xff,0xd0,0xed,0xfe,0xff,0xcb,0xec,0xfe,0xff,0xbf,0xe8,0xfd,0xff,0xb4,0xe4,0xfb,0xff,0xb6,0xe4,0xfe,0xff,0xb7,0xe5,0xfe,0xff,0xb7,0xe5,0xfe,0xff,0xb5,0xe2,0xff,0xff,0xb0,0xe1,0xfe,0xff,0xa1,0xde,0xfd,0xff,0x88,0xd8,0xfd,0xff,0x73,0xd2,0xfc,0xff,0x57,0xca,0xfc,0xff,0x30,0xc3,0xfd,0xff,0x1d,0xbf,0xfe,0xff,0x1c,0xb8,0xfc,0xff,0x1a,0xb3,0xfe,0xff,0x19,0xb1,0xfd,0xff,0x19,0xb0,0xfe,0xff,0x1a,0xb0,0xfe,0xff,0x19,0xb1,0xfd,0xff,0x1a,0xb5,0xfd,0xff,0x1b,0xb8,0xfe,0xff,0x1d,0xbd,0xfd,0xff,0x2b,0xc4,0xfe,0xff,0x40,0xc8,0xff,0xff,0x56,0xcd,0xfd,0xff,0x65,0xcf,0xff,0xff,0x76,0xd2,0xfc,0xff,0x7f,0xd7,0xfb,0xff,0x85,0xd8,0xfd,0xff,0x8b,0xd9,0xfd,0xff,0x8f,0xd9,0xfd,0xff,0x8e,0xda,0xfc,0xff,0x8c,0xd9,0xfc,0xff,0x89,0xd7,0xfd,0xff,0x86,0xd6,0xfd,0xff,0x82,0xd6,0xfe,0xff,0x78,0xd4,0xfd,0xff,0x6b,0xd2,0xfc,0xff,0x5b,0xcc,0xfd,0xff,0x4e,0xc6,0xfc,0xff,0x50,0xc7,0xfc,0xff,0x62,0xcb,0xfc,0xff,0x76,0xd1,0xfe,0xff,0x87,0xd8,0xfe,0xff,0x9c,0xdf,0xfa,0xff,0xb0,0xe2,0xfd,0xff,0xbb,0xe6,0xfd,0xff,0xc3,0xe9,0xfb,0xff,0xc6,0xe8,0xfb,0xff,0xc3,0xe8,0xfb,0xff,0xc2,0xe6,0xfb,0xff,0xbb,0xe7,0xfc,0xff,0x9f,0xe1,0xfd,0xff,0x38,0xc2,0xf8,0xff,0x03,0xab,0xfa,0xff,0x3f,0xc2,0xfb,0xff,0x96,0xdd,0xfc,0xff,0xbd,0xe4,0xfb,0xff,0xca,0xea,0xfb,0xff,0xe3,0xf3,0xfd,0xff,0xeb,0xf5,0xfc,0xff,0xe8,0xf3,0xfb,0xff,0xcd,0xea,0xf9,0xff,0xa4,0xdf,0xf8,0xff,0x98,0xdc,0xfc,0xff,0x99,0xdd,0xfe,0xff,0x87,0xd5,0xf9,0xff,0x91,0xd9,0xfa,0xff,0xb2,0xe1,0xfc,0xff,0xb8,0xe7,0xfa,0xff,0xa2,0xde,0xfa,0xff,0x78,0xd0,0xf7,0xff,0x89,0xda,0xfc,0xff,0x99,0xdc,0xfc,0xff,0x8e,0xd7,0xfe,0xff,0x51,0xca,0xfb,0xff,0x0b,0xb3,0xf7,0xff,0x1e,0xb9,0xfb,0xff,0x2d,0xc3,0xfa,0xff,0x10,0xb2,0xfc,0xff,0x08,0x86,0xf4,0xff,0x09,0x6a,0xeb,0xff,0x0b,0x68,0xe7,0xff,0x07,0x59,0xdb,0xff,0x0c,0x51,0xd4,0xff,0x09,0x4c,0xce,0xff,0x08,0x47,0xc4,0xff,0x08,0x45,0xbe,0xff,0x09,0x41,0xb6,0xff,0x06,0x45,0xbc,0xff,0x0e,0x58,0xd6,0xff,0x08,0x46,0xbf,0xff,0x04,0x3a,0xab,0xff,0x00,0x2b,0x9d,0xff,0x53,0x72,0xb8,0xda,0xfe,0xfe,0xff,0x07,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0x99,0xa8,0xca,0x97,0x21,0x42,0x90,0xff,0x25,0x4a,0x99,0xff,0x25,0x4e,0xa2,0xff,0x28,0x50,0xad,0xff,0x26,0x54,0xb4,0xff,0x24,0x58,0xbe,0xff,0x22,0x5b,0xc7,0xff,0x26,0x73,0xe0,0xff,0x27,0x85,0xf2,0xff,0x26,0x88,0xf2,0xff,0x2c,0xa6,0xff,0xff,0x28,0xb0,0xfd,0xff,0x21,0xa7,0xf8,0xff,0x23,0xa6,0xf7,0xff,0x25,0xad,0xfc,0xff,0x26,0xb5,0xfd,0xff,0x25,0xaa,0xfb,0xff,0x1f,0x98,0xf5,0xff,0x22,0x99,0xf9,0xff,0x22,0xa8,0xfc,0xff,0x2b,0xb9,0xfd,0xff,0x51,0xcb,0xfe,0xff,0x86,0xd8,0xfc,0xff,0xa4,0xde,0xfb,0xff,0xa4,0xde,0xfc,0xff,0x9d,0xdd,0xfb,0xff,0x90,0xd8,0xfb,0xff,0x84,0xd8,0xfc,0xff,0x7b,0xd4,0xf8,0xff,0xa3,0xdf,0xfa,0xff,0xda,0xee,0xfb,0xff,0xe6,0xf4,0xfb,0xff,0xea,0xf6,0xfc,0xff,0xe6,0xf5,0xf9,0xff,0xdc,0xf0,0xfc,0xff,0xc6,0xeb,0xfb,0xff,0xa6,0xe3,0xfa,0xff,0x62,0xce,0xfe,0xff,0x2b,0xb9,0xfa,0xff,0x6b,0xd2,0xfa,0xff,0xc8,0xea,0xff,0xff,0xde,0xf1,0xfe,0xff,0xdb,0xf1,0xfc,0xff,0xd8,0xf0,0xfe,0xff,0xd1,0xee,0xfe,0xff,0xbf,0xe9,0xfe,0xff,0xb0,0xe4,0xfc,0xff,0xaa,0xe3,0xfb,0xff,0xb1,0xe3,0xfe,0xff,0xb2,0xe3,0xfd,0xff,0xb2,0xe3,0xfd,0xff,0xad,0xe2,0xff,0xff,0xa5,0xe0,0xfe,0xff,0x93,0xdd,0xfc,0xff,0x7d,0xd5,0xfc,0xff,0x69,0xcf,0xfd,0xff,0x4a,0xc9,0xfd,0xff,0x2a,0xc1,0xfd,0xff,0x1e,0xbc,0xfe,0xff,0x1d,0xb8,0xfc,0xff,0x1c,0xb3,0xfd,0xff,0x1b,0xb2,0xfe,0xff,0x1c,0xb2,0xff,0xff,0x1d,0xb2,0xff,0xff,0x1b,0xb3,0xfe,0xff,0x1d,0xb6,0xfe,0xff,0x1d,0xba,0xff,0xff,0x21,0xc0,0xfe,0xff,0x33,0xc7,0xfd,0xff,0x4c,0xcb,0xfc,0xff,0x60,0xcf,0xfc,0xff,0x6e,0xd0,0xfd,0xff,0x7b,0xd3,0xfb,0xff,0x80,0xd7,0xfb,0xff,0x85,0xd8,0xfd,0xff,0x8a,0xd8,0xfe,0xff,0x8e,0xda,0xfe,0xff,0x8e,0xda,0xfd,0xff,0x8c,0xda,0xfd,0xff,0x89,0xd8,0xfd,0xff,0x86,0xd7,0xfc,0xff,0x81,0xd6,0xfc,0xff,0x7a,0xd4,0xfc,0xff,0x6d,0xd3,0xfc,0xff,0x5d,0xcd,0xfc,0xff,0x4b,0xc8,0xfd,0xff,0x3b,0xc8,0xfb,0xff,0x36,0xc5,0xf8,0xff,0x47,0xc7,0xf9,0xff,0x68,0xcf,0xfb,0xff,0x8c,0xd9,0xfe,0xff,0xaa,0xe1,0xff,0xff,0xbb,0xe6,0xfb,0xff,0xc3,0xe8,0xfb,0xff,0xc8,0xe9,0xfb,0xff,0xca,0xea,0xfc,0xff,0xc9,0xea,0xfc,0xff,0xc8,0xea,0xfa,0xff,0xc9,0xea,0xfa,0xff,0x9a,0xdc,0xfe,0xff,0x28,0xbb,0xfb,0xff,0x01,0xaf,0xf7,0xff,0x1c,0xba,0xf6,0xff,0x68,0xd1,0xfa,0xff,0xa7,0xdf,0xfa,0xff,0xcd,0xea,0xfb,0xff,0xdf,0xf2,0xfd,0xff,0xe6,0xf4,0xfc,0xff,0xdf,0xf3,0xfd,0xff,0xc1,0xea,0xfa,0xff,0x9e,0xdc,0xfa,0xff,0x8d,0xd9,0xfd,0xff,0x85,0xd6,0xfa,0xff,0x7f,0xd3,0xf7,0xff,0x9a,0xdc,0xfb,0xff,0xae,0xe3,0xfc,0xff,0xab,0xe1,0xfe,0xff,0x80,0xd2,0xf8,0xff,0x74,0xd4,0xfa,0xff,0x8e,0xdc,0xfc,0xff,0x87,0xd6,0xfc,0xff,0x54,0xcb,0xfb,0xff,0x0f,0xae,0xf9,0xff,0x08,0xa9,0xf8,0xff,0x0e,0xb1,0xf6,0xff,0x0c,0xa6,0xf9,0xff,0x0c,0x83,0xf2,0xff,0x0a,0x67,0xe7,0xff,0x0a,0x60,0xe2,0xff,0x09,0x56,0xda,0xff,0x09,0x51,0xd3,0xff,0x07,0x4d,0xcd,0xff,0x07,0x49,0xc6,0xff,0x08,0x45,0xc0,0xff,0x08,0x43,0xb8,0xff,0x0a,0x44,0xb8,0xff,0x05,0x40,0xb7,0xff,0x03,0x3b,0xad,0xff,0x08,0x3c,0xa7,0xff,0x00,0x2a,0x97,0xff,0x3b,0x5c,0xac,0xea,0xf7,0xf8,0xfc,0x0d,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0x7e,0x92,0xbd,0xa3,0x20,0x40,0x8f,0xff,0x28,0x4a,0x9b,0xff,0x27,0x4f,0xa4,0xff,0x28,0x52,0xad,0xff,0x28,0x56,0xb5,0xff,0x26,0x5a,0xbf,0xff,0x24,0x5e,0xc9,0xff,0x26,0x6f,0xde,0xff,0x2b,0x82,0xf1,0xff,0x29,0x85,0xf1,0xff,0x2c,0xa3,0xfd,0xff,0x29,0xad,0xfe,0xff,0x25,0xa5,0xf9,0xff,0x26,0xa6,0xf9,0xff,0x27,0xac,0xfc,0xff,0x27,0xae,0xfb,0xff,0x27,0xa1,0xfa,0xff,0x25,0x90,0xf3,0xff,0x23,0x95,0xf6,0xff,0x21,0xa8,0xfb,0xff,0x2e,0xbe,0xfb,0xff,0x63,0xd0,0xfb,0xff,0x89,0xd9,0xfc,0xff,0x9b,0xdd,0xfc,0xff,0x9f,0xdd,0xfc,0xff,0x94,0xda,0xfa,0xff,0x89,0xd7,0xfb,0xff,0x7d,0xd4,0xfa,0xff,0x8b,0xd9,0xf6,0xff,0xd1,0xec,0xfa,0xff,0xe4,0xf2,0xfb,0xff,0xe9,0xf6,0xfe,0xff,0xe9,0xf7,0xfc,0xff,0xe5,0xf4,0xfb,0xff,0xd6,0xf0,0xfb,0xff,0xa4,0xe3,0xfd,0xff,0x59,0xca,0xfa,0xff,0x16,0xb1,0xf6,0xff,0x52,0xc6,0xfa,0xff,0xc7,0xef,0xfe,0xff,0xe6,0xf3,0xfc,0xff,0xe4,0xf2,0xfc,0xff,0xe2,0xf2,0xfc,0xff,0xd9,0xf0,0xff,0xff,0xc1,0xe9,0xfe,0xff,0xa2,0xe1,0xfc,0xff,0xa2,0xdf,0xfe,0xff,0xa3,0xe0,0xfe,0xff,0xa6,0xe1,0xfe,0xff,0xa9,0xe0,0xfd,0xff,0xa8,0xe0,0xfd,0xff,0xa3,0xdf,0xfd,0xff,0x9c,0xde,0xfe,0xff,0x89,0xd9,0xfc,0xff,0x74,0xd2,0xfb,0xff,0x5e,0xcb,0xfe,0xff,0x3d,0xc6,0xfc,0xff,0x25,0xc0,0xfc,0xff,0x1d,0xba,0xfe,0xff,0x1e,0xb6,0xfd,0xff,0x1e,0xb3,0xfd,0xff,0x1d,0xb1,0xfe,0xff,0x1c,0xb1,0xfe,0xff,0x1d,0xb2,0xfe,0xff,0x1c,0xb3,0xfd,0xff,0x1d,0xb7,0xfd,0xff,0x20,0xbc,0xff,0xff,0x2a,0xc1,0xfe,0xff,0x3f,0xc7,0xfd,0xff,0x54,0xcc,0xfc,0xff,0x6a,0xd0,0xfc,0xff,0x77,0xd2,0xfd,0xff,0x80,0xd6,0xfd,0xff,0x82,0xd7,0xfc,0xff,0x86,0xd7,0xfd,0xff,0x8b,0xd8,0xfd,0xff,0x8d,0xd9,0xfc,0xff,0x8f,0xda,0xfc,0xff,0x8d,0xd9,0xfc,0xff,0x8b,0xd9,0xfd,0xff,0x88,0xd8,0xfd,0xff,0x83,0xd6,0xfc,0xff,0x7d,0xd4,0xfd,0xff,0x70,0xd3,0xfc,0xff,0x61,0xcf,0xfc,0xff,0x4f,0xca,0xfb,0xff,0x40,0xc8,0xfa,0xff,0x33,0xc6,0xfa,0xff,0x2c,0xc3,0xf9,0xff,0x31,0xc3,0xf8,0xff,0x50,0xc9,0xfb,0xff,0x84,0xd6,0xfd,0xff,0xa9,0xe1,0xfb,0xff,0xb8,0xe6,0xfa,0xff,0xc4,0xe8,0xfd,0xff,0xcb,0xea,0xfe,0xff,0xcd,0xeb,0xfd,0xff,0xd4,0xec,0xfd,0xff,0xd4,0xec,0xfb,0xff,0xcf,0xea,0xfc,0xff,0x89,0xd8,0xfb,0xff,0x23,0xbe,0xf9,0xff,0x06,0xb8,0xfd,0xff,0x12,0xb9,0xfb,0xff,0x34,0xc2,0xf9,0xff,0x73,0xd1,0xf9,0xff,0xc5,0xe9,0xfc,0xff,0xe4,0xf4,0xfa,0xff,0xe6,0xf3,0xfc,0xff,0xe2,0xf0,0xfa,0xff,0xce,0xe9,0xfb,0xff,0xa1,0xda,0xfb,0xff,0x7f,0xd3,0xfb,0xff,0x70,0xd0,0xfa,0xff,0x7c,0xd4,0xfa,0xff,0x9a,0xdb,0xfd,0xff,0xa5,0xdf,0xff,0xff,0x89,0xd6,0xfa,0xff,0x6c,0xcd,0xf9,0xff,0x81,0xd6,0xfb,0xff,0x7b,0xd4,0xf9,0xff,0x53,0xcb,0xfa,0xff,0x14,0xb0,0xf8,0xff,0x07,0x9f,0xf8,0xff,0x0d,0xa4,0xfa,0xff,0x0e,0x9c,0xfb,0xff,0x0c,0x7f,0xf2,0xff,0x08,0x67,0xe6,0xff,0x0a,0x61,0xe2,0xff,0x0a,0x5a,0xdc,0xff,0x09,0x53,0xd6,0xff,0x08,0x4f,0xd0,0xff,0x08,0x4c,0xca,0xff,0x07,0x47,0xc4,0xff,0x06,0x44,0xbb,0xff,0x08,0x43,0xb8,0xff,0x06,0x3f,0xb4,0xff,0x04,0x3c,0xae,0xff,0x07,0x3b,0xa8,0xff,0x01,0x2e,0x99,0xff,0x23,0x48,0xa4,0xef,0xe8,0xec,0xf5,0x18,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xff,0xff,0x09,0x6b,0x82,0xb3,0xde,0x23,0x43,0x91,0xff,0x2b,0x4c,0x9d,0xff,0x29,0x50,0xa6,0xff,0x29,0x53,0xad,0xff,0x29,0x58,0xb5,0xff,0x28,0x5d,0xc0,0xff,0x27,0x5f,0xcc,0xff,0x27,0x6d,0xdc,0xff,0x2c,0x7f,0xef,0xff,0x27,0x7f,0xeb,0xff,0x2a,0x9c,0xf8,0xff,0x2a,0xad,0xfe,0xff,0x2b,0xa5,0xfb,0xff,0x2b,0xa8,0xfc,0xff,0x2a,0xae,0xfb,0xff,0x2a,0xab,0xfb,0xff,0x27,0x9c,0xf7,0xff,0x26,0x8f,0xf3,0xff,0x28,0x9b,0xf8,0xff,0x27,0xb0,0xfd,0xff,0x29,0xbf,0xf9,0xff,0x5f,0xd0,0xf9,0xff,0x86,0xd8,0xfa,0xff,0x94,0xdb,0xfa,0xff,0x94,0xda,0xfa,0xff,0x8c,0xd8,0xfb,0xff,0x7f,0xd5,0xfc,0xff,0x74,0xd0,0xf9,0xff,0xb3,0xe4,0xfb,0xff,0xe2,0xf3,0xfc,0xff,0xe4,0xf5,0xfd,0xff,0xe6,0xf7,0xfc,0xff,0xe7,0xf6,0xfb,0xff,0xdd,0xf2,0xfc,0xff,0x9e,0xe2,0xfb,0xff,0x3a,0xb6,0xfb,0xff,0x16,0xa6,0xf9,0xff,0x38,0xbb,0xf5,0xff,0xbc,0xea,0xfd,0xff,0xe4,0xf6,0xfd,0xff,0xe7,0xf5,0xfb,0xff,0xe5,0xf4,0xfd,0xff,0xdd,0xf4,0xfd,0xff,0xc6,0xea,0xff,0xff,0x9a,0xdc,0xfc,0xff,0x8d,0xda,0xfb,0xff,0x9b,0xdd,0xff,0xff,0xa1,0xde,0xfe,0xff,0xa2,0xdf,0xfd,0xff,0xa1,0xdf,0xfd,0xff,0x9f,0xde,0xfe,0xff,0x9d,0xdd,0xfc,0xff,0x93,0xdb,0xfd,0xff,0x80,0xd5,0xfc,0xff,0x6d,0xd0,0xfb,0xff,0x51,0xca,0xfb,0xff,0x31,0xc3,0xfc,0xff,0x21,0xbf,0xfe,0xff,0x1f,0xb8,0xfd,0xff,0x1f,0xb4,0xfc,0xff,0x1f,0xb3,0xfd,0xff,0x1f,0xb1,0xfd,0xff,0x1d,0xb1,0xfd,0xff,0x1d,0xb1,0xfb,0xff,0x1e,0xb3,0xfd,0xff,0x1f,0xb6,0xfc,0xff,0x20,0xbc,0xfd,0xff,0x2d,0xc2,0xfe,0xff,0x46,0xc9,0xfd,0xff,0x5c,0xcd,0xfd,0xff,0x6d,0xd1,0xfd,0xff,0x7b,0xd3,0xfe,0xff,0x83,0xd6,0xfe,0xff,0x86,0xd7,0xfd,0xff,0x89,0xd8,0xfd,0xff,0x8c,0xd9,0xfd,0xff,0x8e,0xd9,0xfc,0xff,0x8f,0xdb,0xfc,0xff,0x8e,0xda,0xfb,0xff,0x8d,0xd9,0xfc,0xff,0x88,0xd7,0xfd,0xff,0x85,0xd7,0xfc,0xff,0x80,0xd4,0xfd,0xff,0x74,0xd2,0xfc,0xff,0x69,0xd0,0xfd,0xff,0x5d,0xcc,0xfc,0xff,0x49,0xc9,0xfa,0xff,0x39,0xc7,0xfc,0xff,0x32,0xc4,0xfc,0xff,0x2b,0xc3,0xfc,0xff,0x2b,0xc3,0xfa,0xff,0x3e,0xc4,0xf7,0xff,0x6c,0xd0,0xfa,0xff,0x9a,0xdd,0xfb,0xff,0xbc,0xe7,0xfa,0xff,0xc8,0xe8,0xfc,0xff,0xce,0xeb,0xfc,0xff,0xd5,0xed,0xfd,0xff,0xd9,0xee,0xfc,0xff,0xdc,0xef,0xfa,0xff,0xca,0xeb,0xfb,0xff,0x76,0xd5,0xfc,0xff,0x30,0xc2,0xfa,0xff,0x25,0xbf,0xfd,0xff,0x21,0xc1,0xfa,0xff,0x35,0xc3,0xf5,0xff,0xa5,0xdd,0xfd,0xff,0xe9,0xf2,0xfd,0xff,0xea,0xf5,0xfc,0xff,0xec,0xf6,0xfa,0xff,0xee,0xf5,0xfa,0xff,0xd5,0xee,0xfc,0xff,0x8d,0xd6,0xf6,0xff,0x6e,0xd1,0xfa,0xff,0x6b,0xcf,0xfa,0xff,0x86,0xd6,0xfb,0xff,0x9d,0xdd,0xfc,0xff,0x92,0xd9,0xfd,0xff,0x72,0xcd,0xf8,0xff,0x76,0xd2,0xf8,0xff,0x74,0xd2,0xf9,0xff,0x59,0xcb,0xfa,0xff,0x23,0xb8,0xfd,0xff,0x08,0x9c,0xf5,0xff,0x0d,0x9b,0xf8,0xff,0x10,0x93,0xfa,0xff,0x0d,0x7f,0xf3,0xff,0x0a,0x6b,0xe9,0xff,0x0b,0x63,0xe4,0xff,0x0c,0x5e,0xe0,0xff,0x0b,0x58,0xdb,0xff,0x09,0x52,0xd4,0xff,0x09,0x50,0xce,0xff,0x06,0x4b,0xc8,0xff,0x07,0x46,0xc1,0xff,0x08,0x43,0xba,0xff,0x06,0x40,0xb5,0xff,0x05,0x3d,0xb0,0xff,0x09,0x3c,0xaa,0xff,0x04,0x31,0x99,0xff,0x16,0x3e,0x9e,0xff,0xd3,0xdb,0xec,0x50,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xf7,0xf9,0xfb,0x0d,0x60,0x79,0xae,0xea,0x26,0x47,0x93,0xff,0x2b,0x4f,0x9e,0xff,0x2b,0x53,0xa7,0xff,0x2c,0x57,0xaf,0xff,0x2c,0x5b,0xb7,0xff,0x2b,0x5f,0xc4,0xff,0x28,0x63,0xce,0xff,0x2b,0x6e,0xdc,0xff,0x2d,0x7b,0xea,0xff,0x2a,0x7d,0xea,0xff,0x2b,0x99,0xf7,0xff,0x2c,0xab,0xff,0xff,0x2c,0xa1,0xf9,0xff,0x2c,0xa8,0xfb,0xff,0x2d,0xb0,0xfd,0xff,0x2b,0xa6,0xfa,0xff,0x26,0x95,0xf3,0xff,0x29,0x90,0xf5,0xff,0x2d,0xa1,0xfb,0xff,0x29,0xb3,0xfb,0xff,0x3d,0xc4,0xfc,0xff,0x74,0xd3,0xfc,0xff,0x86,0xd6,0xf8,0xff,0x90,0xd9,0xf9,0xff,0x8d,0xd9,0xfa,0xff,0x83,0xd7,0xfb,0xff,0x6f,0xd0,0xfa,0xff,0x8c,0xd8,0xf6,0xff,0xd1,0xf1,0xfb,0xff,0xdb,0xf5,0xf9,0xff,0xde,0xf6,0xfb,0xff,0xe5,0xf7,0xfd,0xff,0xcf,0xf0,0xfd,0xff,0x84,0xd4,0xf9,0xff,0x33,0xa9,0xf7,0xff,0x16,0x97,0xfa,0xff,0x2a,0xb0,0xf7,0xff,0xa5,0xe4,0xfd,0xff,0xe8,0xf6,0xfb,0xff,0xe7,0xf5,0xfc,0xff,0xe8,0xf5,0xfc,0xff,0xe2,0xf2,0xfe,0xff,0xbb,0xe8,0xfd,0xff,0x8b,0xd9,0xf9,0xff,0x75,0xd3,0xfd,0xff,0x88,0xd8,0xfe,0xff,0x9a,0xdd,0xfe,0xff,0x9e,0xdd,0xfd,0xff,0x9c,0xdd,0xfd,0xff,0x9b,0xdd,0xfd,0xff,0x9a,0xdc,0xfe,0xff,0x93,0xdb,0xfc,0xff,0x89,0xd8,0xfc,0xff,0x77,0xd3,0xfd,0xff,0x62,0xcf,0xff,0xff,0x43,0xc8,0xfb,0xff,0x2a,0xc1,0xfc,0xff,0x22,0xbd,0xfe,0xff,0x21,0xb7,0xfd,0xff,0x21,0xb3,0xfd,0xff,0x21,0xb2,0xfd,0xff,0x20,0xb1,0xfc,0xff,0x1f,0xb1,0xfc,0xff,0x1e,0xb2,0xfc,0xff,0x20,0xb4,0xfd,0xff,0x21,0xb7,0xfd,0xff,0x23,0xbe,0xfc,0xff,0x30,0xc4,0xfc,0xff,0x4c,0xca,0xfc,0xff,0x62,0xcf,0xfc,0xff,0x70,0xd2,0xfa,0xff,0x7e,0xd5,0xfb,0xff,0x85,0xd6,0xfd,0xff,0x8a,0xd7,0xfd,0xff,0x8c,0xd8,0xfc,0xff,0x8e,0xda,0xfb,0xff,0x8e,0xda,0xfb,0xff,0x91,0xda,0xfd,0xff,0x90,0xd9,0xfd,0xff,0x8f,0xd9,0xfd,0xff,0x8b,0xd9,0xfc,0xff,0x87,0xd7,0xfc,0xff,0x81,0xd5,0xfc,0xff,0x76,0xd2,0xfc,0xff,0x6f,0xd0,0xfc,0xff,0x67,0xcf,0xfc,0xff,0x55,0xca,0xf9,0xff,0x42,0xc7,0xfa,0xff,0x36,0xc6,0xfc,0xff,0x34,0xc5,0xfc,0xff,0x33,0xc4,0xfc,0xff,0x2f,0xc4,0xfb,0xff,0x36,0xc5,0xf9,0xff,0x57,0xcc,0xf8,0xff,0x89,0xd8,0xfa,0xff,0xb1,0xe1,0xfb,0xff,0xc1,0xe8,0xfa,0xff,0xcf,0xec,0xfc,0xff,0xdb,0xef,0xfb,0xff,0xe0,0xf0,0xfb,0xff,0xdf,0xf1,0xfa,0xff,0xbd,0xe7,0xfc,0xff,0x68,0xce,0xf9,0xff,0x3e,0xc6,0xfa,0xff,0x40,0xc7,0xf8,0xff,0x39,0xc5,0xf7,0xff,0x5b,0xcb,0xf6,0xff,0xb8,0xe6,0xfc,0xff,0xed,0xf5,0xfd,0xff,0xec,0xf6,0xfb,0xff,0xed,0xf7,0xf9,0xff,0xf3,0xf8,0xfb,0xff,0xbe,0xe7,0xf9,0xff,0x72,0xd1,0xf7,0xff,0x6d,0xcf,0xfc,0xff,0x76,0xd2,0xfa,0xff,0x90,0xda,0xfb,0xff,0x95,0xdb,0xfe,0xff,0x7e,0xd2,0xfa,0xff,0x6e,0xd1,0xf8,0xff,0x6e,0xd1,0xf9,0xff,0x5b,0xcb,0xfa,0xff,0x28,0xbb,0xfc,0xff,0x09,0x9e,0xf4,0xff,0x10,0x95,0xf8,0xff,0x0e,0x8e,0xf8,0xff,0x0f,0x82,0xf3,0xff,0x0e,0x72,0xec,0xff,0x0f,0x68,0xe5,0xff,0x0d,0x63,0xe2,0xff,0x0b,0x5d,0xde,0xff,0x09,0x57,0xd7,0xff,0x09,0x52,0xd3,0xff,0x08,0x4d,0xce,0xff,0x09,0x49,0xc7,0xff,0x07,0x45,0xbe,0xff,0x06,0x42,0xb8,0xff,0x06,0x40,0xb5,0xff,0x09,0x3e,0xae,0xff,0x04,0x33,0x9c,0xff,0x10,0x39,0x9c,0xff,0xc1,0xcc,0xe6,0x5b,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xf1,0xf3,0xf8,0x0d,0x55,0x70,0xa9,0xea,0x2a,0x4b,0x97,0xff,0x2c,0x52,0xa0,0xff,0x2e,0x56,0xa9,0xff,0x2f,0x5a,0xb1,0xff,0x2f,0x5e,0xba,0xff,0x2e,0x63,0xc7,0xff,0x2c,0x67,0xd2,0xff,0x2f,0x6f,0xdd,0xff,0x2d,0x77,0xe6,0xff,0x2a,0x7c,0xea,0xff,0x2c,0x97,0xf6,0xff,0x2c,0xa6,0xfd,0xff,0x2c,0x9d,0xf8,0xff,0x2d,0xa2,0xf8,0xff,0x2d,0xa8,0xfa,0xff,0x2b,0x9e,0xf7,0xff,0x29,0x90,0xf0,0xff,0x2d,0x90,0xf4,0xff,0x2b,0x9a,0xf7,0xff,0x26,0xaa,0xfb,0xff,0x32,0xbe,0xfb,0xff,0x64,0xd0,0xfa,0xff,0x88,0xd7,0xfb,0xff,0x92,0xd8,0xfb,0xff,0x8c,0xd8,0xfa,0xff,0x74,0xd5,0xfa,0xff,0x69,0xce,0xf7,0xff,0xbf,0xeb,0xf9,0xff,0xd5,0xf6,0xf9,0xff,0xcb,0xf5,0xf9,0xff,0xdd,0xf8,0xfb,0xff,0xc0,0xea,0xfc,0xff,0x56,0xbd,0xf6,0xff,0x25,0x9c,0xf5,0xff,0x1f,0x99,0xf8,0xff,0x23,0xa9,0xf9,0xff,0x93,0xdc,0xfc,0xff,0xec,0xf7,0xfc,0xff,0xea,0xf6,0xfb,0xff,0xe9,0xf6,0xfc,0xff,0xd8,0xf4,0xfe,0xff,0x9e,0xe1,0xfb,0xff,0x6b,0xd0,0xf9,0xff,0x62,0xd0,0xfc,0xff,0x70,0xd3,0xfe,0xff,0x8a,0xd8,0xfd,0xff,0x98,0xdc,0xfd,0xff,0x9a,0xdc,0xfd,0xff,0x99,0xdc,0xfd,0xff,0x99,0xda,0xfd,0xff,0x94,0xd9,0xfd,0xff,0x8a,0xda,0xfc,0xff,0x80,0xd6,0xfc,0xff,0x6e,0xd1,0xfd,0xff,0x55,0xcc,0xfe,0xff,0x38,0xc5,0xfb,0xff,0x27,0xbf,0xfc,0xff,0x25,0xbb,0xfe,0xff,0x23,0xb6,0xfd,0xff,0x24,0xb3,0xfc,0xff,0x24,0xb2,0xfc,0xff,0x24,0xb2,0xfc,0xff,0x22,0xb2,0xfc,0xff,0x21,0xb3,0xfb,0xff,0x21,0xb4,0xfc,0xff,0x22,0xb8,0xfc,0xff,0x26,0xbf,0xfa,0xff,0x35,0xc5,0xfa,0xff,0x56,0xca,0xfc,0xff,0x6c,0xcf,0xfb,0xff,0x77,0xd3,0xfa,0xff,0x81,0xd6,0xfb,0xff,0x87,0xd7,0xfd,0xff,0x8b,0xd8,0xfc,0xff,0x8d,0xd8,0xfc,0xff,0x8f,0xd9,0xfc,0xff,0x90,0xda,0xfc,0xff,0x91,0xda,0xfd,0xff,0x91,0xd9,0xfe,0xff,0x90,0xd9,0xfd,0xff,0x8c,0xd8,0xfb,0xff,0x88,0xd7,0xfb,0xff,0x80,0xd5,0xfb,0xff,0x76,0xd2,0xfb,0xff,0x71,0xd1,0xfb,0xff,0x69,0xd0,0xfc,0xff,0x5e,0xcd,0xfb,0xff,0x4f,0xc8,0xfc,0xff,0x40,0xc7,0xfb,0xff,0x39,0xc7,0xfa,0xff,0x36,0xc6,0xf8,0xff,0x34,0xc5,0xf9,0xff,0x33,0xc5,0xfb,0xff,0x3a,0xc5,0xfa,0xff,0x49,0xc7,0xf9,0xff,0x68,0xce,0xf9,0xff,0x95,0xda,0xf8,0xff,0xbf,0xe6,0xfb,0xff,0xd7,0xee,0xfb,0xff,0xe0,0xef,0xfc,0xff,0xe1,0xf0,0xfa,0xff,0xde,0xf0,0xfa,0xff,0xb2,0xe2,0xfd,0xff,0x63,0xcb,0xf9,0xff,0x52,0xc8,0xfa,0xff,0x4e,0xc8,0xf9,0xff,0x40,0xc5,0xf7,0xff,0x57,0xca,0xf5,0xff,0xba,0xe5,0xfb,0xff,0xf5,0xf8,0xfc,0xff,0xf0,0xf9,0xf9,0xff,0xf0,0xf7,0xfb,0xff,0xec,0xf6,0xfc,0xff,0x94,0xd6,0xf8,0xff,0x6b,0xce,0xf9,0xff,0x6d,0xcf,0xfa,0xff,0x7f,0xd5,0xfb,0xff,0x90,0xdb,0xfd,0xff,0x7d,0xd4,0xf9,0xff,0x65,0xcc,0xf6,0xff,0x69,0xce,0xf9,0xff,0x51,0xc8,0xfa,0xff,0x1f,0xbb,0xfa,0xff,0x0d,0xa6,0xf8,0xff,0x12,0x95,0xf7,0xff,0x0d,0x8d,0xf6,0xff,0x10,0x84,0xf4,0xff,0x0f,0x7b,0xf2,0xff,0x0c,0x71,0xea,0xff,0x0e,0x68,0xe5,0xff,0x0f,0x62,0xe1,0xff,0x09,0x5a,0xda,0xff,0x09,0x55,0xd6,0xff,0x09,0x51,0xd0,0xff,0x09,0x4c,0xca,0xff,0x08,0x48,0xc3,0xff,0x07,0x44,0xbd,0xff,0x07,0x42,0xba,0xff,0x0b,0x41,0xb2,0xff,0x06,0x36,0x9f,0xff,0x0a,0x36,0x9a,0xff,0xb2,0xc0,0xdf,0x5b,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xec,0xef,0xf5,0x10,0x4e,0x6b,0xa6,0xec,0x2d,0x4f,0x9a,0xff,0x30,0x55,0xa4,0xff,0x31,0x59,0xab,0xff,0x30,0x5c,0xb3,0xff,0x32,0x62,0xbe,0xff,0x31,0x67,0xcb,0xff,0x2f,0x6a,0xd5,0xff,0x32,0x6f,0xde,0xff,0x30,0x77,0xe6,0xff,0x2d,0x7e,0xeb,0xff,0x32,0x91,0xf3,0xff,0x31,0xa0,0xfb,0xff,0x31,0x99,0xf7,0xff,0x2f,0x96,0xf3,0xff,0x2e,0x99,0xf7,0xff,0x2d,0x93,0xf5,0xff,0x2d,0x8c,0xf0,0xff,0x2f,0x90,0xf3,0xff,0x2f,0x98,0xf8,0xff,0x2e,0xa3,0xf9,0xff,0x29,0xb1,0xf9,0xff,0x3c,0xc3,0xf8,0xff,0x61,0xcd,0xfc,0xff,0x71,0xd1,0xfa,0xff,0x79,0xd3,0xfb,0xff,0x58,0xcb,0xf5,0xff,0x84,0xda,0xf5,0xff,0xd0,0xf5,0xfd,0xff,0xcd,0xf4,0xf5,0xff,0xd4,0xfb,0xf6,0xff,0xac,0xe6,0xfb,0xff,0x42,0xad,0xf2,0xff,0x1c,0x94,0xf4,0xff,0x28,0x9a,0xfa,0xff,0x23,0xa6,0xf5,0xff,0x8a,0xd8,0xfa,0xff,0xec,0xf9,0xfd,0xff,0xf0,0xf9,0xfa,0xff,0xee,0xf6,0xfd,0xff,0xc0,0xeb,0xfe,0xff,0x6e,0xd3,0xfa,0xff,0x34,0xc1,0xf7,0xff,0x52,0xcb,0xfd,0xff,0x67,0xd0,0xff,0xff,0x73,0xd3,0xfe,0xff,0x88,0xd8,0xfc,0xff,0x8f,0xdb,0xfd,0xff,0x90,0xdc,0xfe,0xff,0x90,0xda,0xfc,0xff,0x90,0xd8,0xfd,0xff,0x8a,0xd7,0xfd,0xff,0x7e,0xd6,0xfb,0xff,0x74,0xd2,0xfa,0xff,0x65,0xcf,0xfc,0xff,0x49,0xc9,0xfc,0xff,0x31,0xc1,0xfb,0xff,0x28,0xbc,0xfd,0xff,0x26,0xb9,0xfd,0xff,0x26,0xb6,0xfc,0xff,0x26,0xb3,0xfb,0xff,0x26,0xb1,0xfc,0xff,0x24,0xb1,0xfc,0xff,0x23,0xb2,0xfc,0xff,0x22,0xb4,0xfb,0xff,0x23,0xb6,0xfc,0xff,0x24,0xbb,0xfd,0xff,0x2a,0xc2,0xfb,0xff,0x3c,0xc7,0xfa,0xff,0x5b,0xcc,0xfc,0xff,0x6f,0xd0,0xfb,0xff,0x7a,0xd4,0xfb,0xff,0x83,0xd7,0xfb,0xff,0x89,0xd8,0xfd,0xff,0x8c,0xd8,0xfb,0xff,0x8e,0xd8,0xfc,0xff,0x90,0xd8,0xfc,0xff,0x91,0xda,0xfc,0xff,0x91,0xda,0xfd,0xff,0x91,0xd9,0xfe,0xff,0x90,0xd9,0xfb,0xff,0x8d,0xd8,0xfa,0xff,0x89,0xd7,0xfc,0xff,0x81,0xd5,0xfb,0xff,0x77,0xd4,0xfa,0xff,0x73,0xd1,0xfb,0xff,0x70,0xd0,0xfc,0xff,0x69,0xcf,0xfc,0xff,0x5b,0xcb,0xfd,0xff,0x49,0xc8,0xfb,0xff,0x40,0xc7,0xfa,0xff,0x3b,0xc6,0xf9,0xff,0x38,0xc6,0xfa,0xff,0x39,0xc6,0xfa,0xff,0x41,0xc5,0xfb,0xff,0x3d,0xc6,0xfb,0xff,0x36,0xc4,0xf9,0xff,0x4e,0xc7,0xf8,0xff,0x7b,0xd3,0xf9,0xff,0xb7,0xe4,0xfd,0xff,0xd8,0xed,0xff,0xff,0xe2,0xef,0xfa,0xff,0xe5,0xf0,0xfa,0xff,0xe0,0xf2,0xfc,0xff,0xab,0xe1,0xf8,0xff,0x66,0xcb,0xf7,0xff,0x5a,0xc9,0xfb,0xff,0x51,0xc9,0xfb,0xff,0x46,0xc4,0xfa,0xff,0x50,0xc5,0xf5,0xff,0x9d,0xdf,0xf7,0xff,0xed,0xf9,0xf8,0xff,0xf5,0xf7,0xfa,0xff,0xf6,0xf8,0xfb,0xff,0xcd,0xe9,0xfa,0xff,0x76,0xce,0xf8,0xff,0x6c,0xcd,0xfa,0xff,0x6d,0xce,0xf7,0xff,0x7c,0xd3,0xf9,0xff,0x79,0xd1,0xf9,0xff,0x5f,0xc8,0xf8,0xff,0x63,0xcb,0xf8,0xff,0x41,0xc5,0xf6,0xff,0x1d,0xbb,0xf7,0xff,0x14,0xb0,0xf8,0xff,0x0f,0x9f,0xf4,0xff,0x0f,0x96,0xf6,0xff,0x0e,0x8a,0xf2,0xff,0x0f,0x82,0xf3,0xff,0x0d,0x78,0xed,0xff,0x10,0x6e,0xe9,0xff,0x0f,0x66,0xe4,0xff,0x0b,0x5e,0xde,0xff,0x0a,0x58,0xd7,0xff,0x0a,0x54,0xd2,0xff,0x09,0x4f,0xcc,0xff,0x09,0x4c,0xc7,0xff,0x08,0x47,0xc2,0xff,0x07,0x43,0xbd,0xff,0x0a,0x42,0xb4,0xff,0x07,0x37,0x9f,0xff,0x06,0x33,0x98,0xff,0xa6,0xb6,0xda,0x5f,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xe8,0xec,0xf4,0x1f,0x48,0x66,0xa6,0xf3,0x32,0x53,0x9d,0xff,0x33,0x58,0xa7,0xff,0x33,0x5c,0xad,0xff,0x33,0x60,0xb6,0xff,0x34,0x65,0xc1,0xff,0x34,0x6a,0xcf,0xff,0x31,0x6d,0xd7,0xff,0x31,0x73,0xdf,0xff,0x30,0x79,0xe4,0xff,0x2f,0x83,0xec,0xff,0x31,0x90,0xf1,0xff,0x34,0xa3,0xfb,0xff,0x33,0x9a,0xf5,0xff,0x32,0x98,0xf2,0xff,0x32,0x9d,0xf7,0xff,0x33,0x9d,0xf7,0xff,0x30,0x99,0xf3,0xff,0x30,0xa0,0xf7,0xff,0x2f,0xa5,0xfb,0xff,0x2c,0xa2,0xf6,0xff,0x2c,0xaf,0xf8,0xff,0x31,0xbf,0xf8,0xff,0x33,0xc1,0xfa,0xff,0x35,0xc0,0xf7,0xff,0x36,0xc1,0xf8,0xff,0x50,0xc4,0xf5,0xff,0xbf,0xef,0xfa,0xff,0xcb,0xf6,0xf7,0xff,0xc7,0xf9,0xf8,0xff,0x93,0xda,0xf8,0xff,0x37,0xa1,0xf2,0xff,0x25,0x93,0xf6,0xff,0x2c,0x9c,0xfb,0xff,0x1d,0x9e,0xf5,0xff,0x66,0xc8,0xf5,0xff,0xe6,0xf9,0xfd,0xff,0xed,0xfb,0xfb,0xff,0xe3,0xf7,0xfb,0xff,0x99,0xdf,0xfa,0xff,0x42,0xbf,0xf7,0xff,0x26,0xae,0xf8,0xff,0x31,0xbd,0xfd,0xff,0x4f,0xce,0xfd,0xff,0x5f,0xd0,0xfd,0xff,0x70,0xd2,0xfe,0xff,0x82,0xd7,0xfc,0xff,0x88,0xd9,0xfc,0xff,0x89,0xd9,0xfc,0xff,0x87,0xd8,0xfc,0xff,0x84,0xd7,0xfc,0xff,0x7f,0xd4,0xfc,0xff,0x75,0xd1,0xfb,0xff,0x6b,0xd1,0xfb,0xff,0x5d,0xcd,0xfc,0xff,0x41,0xc6,0xfb,0xff,0x2c,0xc0,0xfa,0xff,0x29,0xba,0xfc,0xff,0x29,0xb9,0xfc,0xff,0x28,0xb6,0xfc,0xff,0x29,0xb3,0xfc,0xff,0x28,0xb1,0xfc,0xff,0x25,0xb1,0xfb,0xff,0x26,0xb3,0xfb,0xff,0x26,0xb5,0xfa,0xff,0x26,0xb7,0xfb,0xff,0x27,0xbc,0xfe,0xff,0x2f,0xc3,0xfc,0xff,0x43,0xc8,0xfc,0xff,0x5f,0xcd,0xfd,0xff,0x6f,0xd1,0xfc,0xff,0x7a,0xd4,0xfc,0xff,0x85,0xd6,0xfb,0xff,0x8b,0xd7,0xfc,0xff,0x8f,0xd9,0xfc,0xff,0x91,0xda,0xfc,0xff,0x93,0xdb,0xfb,0xff,0x93,0xdb,0xfa,0xff,0x93,0xdb,0xfb,0xff,0x93,0xda,0xfb,0xff,0x90,0xd9,0xfb,0xff,0x8c,0xd8,0xfa,0xff,0x88,0xd7,0xfc,0xff,0x83,0xd5,0xfc,0xff,0x7a,0xd3,0xfc,0xff,0x77,0xd1,0xfb,0xff,0x75,0xd0,0xfc,0xff,0x70,0xd0,0xfc,0xff,0x67,0xcd,0xfb,0xff,0x54,0xca,0xfa,0xff,0x49,0xca,0xfb,0xff,0x43,0xc8,0xfa,0xff,0x41,0xc8,0xf9,0xff,0x43,0xc8,0xf9,0xff,0x45,0xc7,0xf9,0xff,0x42,0xc7,0xf9,0xff,0x39,0xc7,0xf8,0xff,0x3d,0xc8,0xfa,0xff,0x4f,0xca,0xf8,0xff,0x74,0xd1,0xf8,0xff,0xa4,0xdd,0xfc,0xff,0xd0,0xec,0xfa,0xff,0xe4,0xf1,0xfb,0xff,0xe8,0xf5,0xf8,0xff,0xe5,0xf5,0xf9,0xff,0x9c,0xda,0xf7,0xff,0x61,0xca,0xfa,0xff,0x5c,0xca,0xfa,0xff,0x59,0xc7,0xfa,0xff,0x4b,0xc5,0xf8,0xff,0x3d,0xc3,0xf6,0xff,0x7f,0xd6,0xf8,0xff,0xe4,0xf3,0xfb,0xff,0xf8,0xfa,0xf9,0xff,0xf2,0xf9,0xfb,0xff,0xa0,0xda,0xf8,0xff,0x71,0xcd,0xf8,0xff,0x6b,0xce,0xf6,0xff,0x73,0xcf,0xf7,0xff,0x7a,0xd2,0xfa,0xff,0x61,0xc8,0xf6,0xff,0x66,0xcb,0xf8,0xff,0x57,0xcb,0xf5,0xff,0x3a,0xc2,0xf6,0xff,0x2e,0xbe,0xfb,0xff,0x15,0xb0,0xf4,0xff,0x0d,0xa3,0xf3,0xff,0x10,0x98,0xf5,0xff,0x0f,0x89,0xf1,0xff,0x10,0x7f,0xf0,0xff,0x0f,0x76,0xeb,0xff,0x0c,0x6d,0xe5,0xff,0x0d,0x65,0xdf,0xff,0x0c,0x5c,0xd8,0xff,0x0b,0x59,0xd5,0xff,0x0a,0x54,0xd1,0xff,0x09,0x4f,0xcc,0xff,0x08,0x4b,0xc5,0xff,0x08,0x48,0xc1,0xff,0x0b,0x43,0xb6,0xff,0x08,0x39,0xa1,0xff,0x01,0x31,0x99,0xff,0x9a,0xad,0xd6,0x71,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xe5,0xea,0xf3,0x42,0x45,0x64,0xa6,0xff,0x36,0x57,0xa3,0xff,0x36,0x5b,0xab,0xff,0x37,0x5f,0xb0,0xff,0x35,0x62,0xb8,0xff,0x37,0x68,0xc5,0xff,0x36,0x6d,0xd1,0xff,0x32,0x70,0xd9,0xff,0x34,0x77,0xe3,0xff,0x33,0x85,0xeb,0xff,0x32,0x97,0xf5,0xff,0x31,0x9f,0xf4,0xff,0x33,0xb3,0xfa,0xff,0x32,0xa9,0xf7,0xff,0x34,0xab,0xf9,0xff,0x32,0xb0,0xf8,0xff,0x35,0xb7,0xfc,0xff,0x33,0xb7,0xfc,0xff,0x3d,0xc1,0xfe,0xff,0x3f,0xc3,0xfc,0xff,0x31,0xb5,0xf5,0xff,0x3e,0xc0,0xfb,0xff,0x3f,0xc5,0xfb,0xff,0x30,0xbf,0xf7,0xff,0x2e,0xbe,0xf7,0xff,0x1f,0xb7,0xf4,0xff,0x7b,0xd2,0xf6,0xff,0xd8,0xfb,0xfb,0xff,0xbb,0xf0,0xf9,0xff,0x6c,0xc4,0xf2,0xff,0x2c,0x96,0xf1,0xff,0x2c,0x94,0xf4,0xff,0x30,0x9d,0xf7,0xff,0x25,0x9e,0xf6,0xff,0x50,0xbc,0xf7,0xff,0xcd,0xf4,0xfc,0xff,0xee,0xfe,0xfa,0xff,0xc9,0xf0,0xfc,0xff,0x6e,0xca,0xf7,0xff,0x2b,0xb1,0xf8,0xff,0x28,0xaa,0xf9,0xff,0x30,0xb1,0xfb,0xff,0x3d,0xc1,0xff,0xff,0x49,0xcc,0xfc,0xff,0x56,0xcf,0xfd,0xff,0x67,0xd1,0xfe,0xff,0x77,0xd5,0xfd,0xff,0x82,0xd7,0xfd,0xff,0x84,0xd6,0xfd,0xff,0x7f,0xd6,0xfc,0xff,0x7a,0xd4,0xfc,0xff,0x71,0xd2,0xfb,0xff,0x6a,0xcf,0xfb,0xff,0x62,0xcf,0xfc,0xff,0x52,0xca,0xf9,0xff,0x3b,0xc5,0xfa,0xff,0x2b,0xbf,0xfa,0xff,0x2a,0xb9,0xfb,0xff,0x2c,0xb6,0xfb,0xff,0x2b,0xb4,0xfc,0xff,0x2b,0xb3,0xfc,0xff,0x2b,0xb3,0xfc,0xff,0x28,0xb3,0xfc,0xff,0x28,0xb4,0xfb,0xff,0x28,0xb5,0xf9,0xff,0x28,0xb8,0xfb,0xff,0x28,0xbd,0xfe,0xff,0x32,0xc2,0xfc,0xff,0x4b,0xc8,0xfc,0xff,0x62,0xcd,0xfd,0xff,0x71,0xd1,0xfb,0xff,0x7d,0xd5,0xfc,0xff,0x86,0xd6,0xfb,0xff,0x8b,0xd7,0xfc,0xff,0x90,0xd9,0xfc,0xff,0x92,0xda,0xfc,0xff,0x94,0xda,0xfb,0xff,0x94,0xdb,0xfa,0xff,0x94,0xdb,0xfa,0xff,0x94,0xdb,0xfa,0xff,0x92,0xd9,0xfa,0xff,0x8e,0xd8,0xfa,0xff,0x89,0xd7,0xfb,0xff,0x85,0xd6,0xfc,0xff,0x7d,0xd4,0xfc,0xff,0x79,0xd2,0xfb,0xff,0x75,0xd1,0xfb,0xff,0x72,0xd1,0xfb,0xff,0x6e,0xcf,0xfb,0xff,0x61,0xcd,0xfb,0xff,0x56,0xcc,0xfb,0xff,0x50,0xca,0xfa,0xff,0x4d,0xc9,0xfa,0xff,0x4d,0xc9,0xf9,0xff,0x4d,0xc9,0xf9,0xff,0x4d,0xc9,0xf9,0xff,0x4b,0xc9,0xf9,0xff,0x4f,0xc9,0xfa,0xff,0x59,0xcc,0xfa,0xff,0x66,0xcd,0xfa,0xff,0x74,0xce,0xfc,0xff,0x90,0xd6,0xf8,0xff,0xc3,0xe7,0xfa,0xff,0xe5,0xf4,0xfb,0xff,0xf1,0xf7,0xf9,0xff,0xdb,0xef,0xfc,0xff,0x82,0xd2,0xf6,0xff,0x62,0xc9,0xfa,0xff,0x60,0xc9,0xfc,0xff,0x5b,0xc8,0xf9,0xff,0x48,0xc8,0xf9,0xff,0x3f,0xc3,0xf7,0xff,0x76,0xce,0xf5,0xff,0xd5,0xf1,0xf9,0xff,0xfe,0xfe,0xfa,0xff,0xdc,0xee,0xf8,0xff,0x80,0xd1,0xf5,0xff,0x73,0xd1,0xf7,0xff,0x73,0xce,0xf4,0xff,0x84,0xd4,0xf9,0xff,0x75,0xcf,0xf7,0xff,0x74,0xcd,0xf4,0xff,0x83,0xd3,0xf7,0xff,0x65,0xca,0xf5,0xff,0x5e,0xc8,0xfa,0xff,0x45,0xc1,0xf8,0xff,0x1e,0xb5,0xf4,0xff,0x14,0xad,0xf6,0xff,0x10,0x96,0xef,0xff,0x12,0x87,0xef,0xff,0x11,0x7e,0xee,0xff,0x0f,0x75,0xea,0xff,0x12,0x6b,0xe3,0xff,0x0f,0x62,0xdc,0xff,0x0c,0x5c,0xd7,0xff,0x0c,0x59,0xd4,0xff,0x0b,0x54,0xd0,0xff,0x0a,0x4f,0xc9,0xff,0x09,0x4b,0xc5,0xff,0x0d,0x46,0xbb,0xff,0x0b,0x3c,0xa7,0xff,0x00,0x31,0x9c,0xff,0x93,0xa8,0xd5,0x9c,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xe4,0xe8,0xf2,0x5b,0x45,0x64,0xa7,0xff,0x3a,0x5b,0xa7,0xff,0x3a,0x5f,0xaf,0xff,0x3a,0x63,0xb4,0xff,0x38,0x65,0xbc,0xff,0x3b,0x6c,0xc9,0xff,0x38,0x70,0xd4,0xff,0x35,0x73,0xdc,0xff,0x39,0x87,0xea,0xff,0x3a,0xa4,0xf6,0xff,0x41,0xb8,0xf9,0xff,0x41,0xbb,0xf8,0xff,0x50,0xc8,0xf8,0xff,0x38,0xbc,0xf5,0xff,0x36,0xbf,0xfa,0xff,0x35,0xbf,0xf8,0xff,0x35,0xc0,0xfa,0xff,0x2e,0xbe,0xf8,0xff,0x56,0xcd,0xfb,0xff,0x7e,0xd7,0xfc,0xff,0x70,0xd0,0xf8,0xff,0x76,0xd2,0xfc,0xff,0x65,0xce,0xfd,0xff,0x38,0xc2,0xf5,0xff,0x2d,0xba,0xf8,0xff,0x45,0xc0,0xf1,0xff,0xb5,0xe9,0xf9,0xff,0x9b,0xe4,0xfa,0xff,0x4b,0xab,0xf1,0xff,0x27,0x8c,0xee,0xff,0x2e,0x92,0xf7,0xff,0x33,0x9b,0xf8,0xff,0x2c,0x9d,0xf6,0xff,0x49,0xb4,0xf4,0xff,0xbe,0xf2,0xfa,0xff,0xde,0xfc,0xfb,0xff,0x93,0xde,0xf8,0xff,0x42,0xb6,0xf4,0xff,0x2a,0xa2,0xf7,0xff,0x30,0xa2,0xfb,0xff,0x31,0xa3,0xf7,0xff,0x39,0xb9,0xfd,0xff,0x3a,0xc6,0xfd,0xff,0x48,0xcc,0xfb,0xff,0x57,0xce,0xfc,0xff,0x61,0xd0,0xfd,0xff,0x6d,0xd3,0xfc,0xff,0x76,0xd4,0xfe,0xff,0x77,0xd4,0xff,0xff,0x6d,0xd0,0xfe,0xff,0x65,0xce,0xfe,0xff,0x5e,0xce,0xfc,0xff,0x5d,0xcd,0xfd,0xff,0x56,0xcb,0xfc,0xff,0x48,0xc8,0xfa,0xff,0x35,0xc3,0xfb,0xff,0x2d,0xbe,0xfb,0xff,0x2c,0xb9,0xfa,0xff,0x2e,0xb7,0xfb,0xff,0x2e,0xb4,0xfc,0xff,0x2e,0xb3,0xfb,0xff,0x2d,0xb3,0xfb,0xff,0x2c,0xb4,0xfc,0xff,0x2c,0xb5,0xfb,0xff,0x2c,0xb6,0xfa,0xff,0x2b,0xb9,0xfc,0xff,0x2b,0xbe,0xfd,0xff,0x36,0xc5,0xfc,0xff,0x4f,0xcb,0xfd,0xff,0x65,0xce,0xfc,0xff,0x73,0xd0,0xfa,0xff,0x7f,0xd4,0xfc,0xff,0x85,0xd6,0xfb,0xff,0x8a,0xd8,0xfb,0xff,0x90,0xd9,0xfb,0xff,0x93,0xda,0xfc,0xff,0x95,0xda,0xfc,0xff,0x96,0xda,0xfa,0xff,0x96,0xda,0xfa,0xff,0x95,0xda,0xfa,0xff,0x92,0xd9,0xfa,0xff,0x8f,0xd8,0xfa,0xff,0x8b,0xd8,0xfb,0xff,0x86,0xd7,0xfc,0xff,0x80,0xd4,0xfb,0xff,0x7c,0xd3,0xfa,0xff,0x79,0xd2,0xfa,0xff,0x76,0xd2,0xfb,0xff,0x74,0xd0,0xfc,0xff,0x6e,0xcf,0xfb,0xff,0x64,0xcd,0xfb,0xff,0x5c,0xcb,0xf9,0xff,0x5b,0xca,0xfa,0xff,0x59,0xca,0xfa,0xff,0x58,0xca,0xfa,0xff,0x5a,0xcb,0xfb,0xff,0x59,0xcb,0xfb,0xff,0x5e,0xcb,0xfb,0xff,0x64,0xcd,0xfb,0xff,0x6d,0xcf,0xfc,0xff,0x73,0xcf,0xfc,0xff,0x77,0xcf,0xfa,0xff,0x8a,0xd6,0xf6,0xff,0xb4,0xe2,0xf9,0xff,0xde,0xf0,0xfa,0xff,0xf0,0xf9,0xfa,0xff,0xc8,0xeb,0xf8,0xff,0x75,0xcf,0xf3,0xff,0x62,0xcb,0xfa,0xff,0x5e,0xc9,0xfa,0xff,0x50,0xc7,0xf8,0xff,0x4a,0xc4,0xf9,0xff,0x41,0xc1,0xf5,0xff,0x5e,0xc8,0xef,0xff,0xc9,0xea,0xf8,0xff,0xff,0xfb,0xfb,0xff,0xb7,0xe1,0xf5,0xff,0x81,0xd0,0xf5,0xff,0x7f,0xd1,0xf6,0xff,0x88,0xd5,0xf6,0xff,0x92,0xd6,0xf7,0xff,0x82,0xd0,0xf4,0xff,0x97,0xd6,0xfa,0xff,0x85,0xd1,0xf4,0xff,0x79,0xcd,0xf5,0xff,0x71,0xcc,0xf8,0xff,0x49,0xc3,0xf4,0xff,0x24,0xb9,0xf5,0xff,0x10,0xa9,0xf3,0xff,0x0f,0x94,0xf0,0xff,0x11,0x88,0xee,0xff,0x0f,0x7d,0xec,0xff,0x11,0x72,0xe5,0xff,0x0f,0x67,0xde,0xff,0x0d,0x60,0xd9,0xff,0x0c,0x5b,0xd5,0xff,0x0d,0x58,0xd2,0xff,0x0c,0x53,0xce,0xff,0x0c,0x4e,0xc9,0xff,0x0e,0x48,0xbe,0xff,0x0c,0x42,0xb0,0xff,0x00,0x35,0xa3,0xff,0x8e,0xa6,0xd6,0xbb,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xe3,0xe8,0xf2,0x5b,0x44,0x66,0xa8,0xff,0x3c,0x5e,0xa9,0xff,0x3b,0x63,0xb1,0xff,0x3c,0x67,0xb8,0xff,0x3a,0x6a,0xbf,0xff,0x3c,0x70,0xca,0xff,0x3b,0x73,0xd8,0xff,0x39,0x7d,0xe4,0xff,0x3c,0x9b,0xf4,0xff,0x45,0xbe,0xf9,0xff,0x67,0xd2,0xfa,0xff,0x60,0xcb,0xf7,0xff,0x81,0xd8,0xfa,0xff,0x6a,0xd1,0xf6,0xff,0x71,0xd3,0xfd,0xff,0x68,0xd1,0xfa,0xff,0x6f,0xd1,0xfb,0xff,0x55,0xc9,0xf5,0xff,0x6b,0xd1,0xf8,0xff,0x95,0xda,0xf9,0xff,0x91,0xd9,0xf5,0xff,0x95,0xda,0xf7,0xff,0x7b,0xd3,0xfa,0xff,0x3c,0xc1,0xf5,0xff,0x4f,0xc3,0xf7,0xff,0xc2,0xef,0xf9,0xff,0x89,0xde,0xf6,0xff,0x31,0xad,0xf4,0xff,0x30,0x92,0xf1,0xff,0x35,0x94,0xf2,0xff,0x36,0x97,0xf2,0xff,0x2f,0x96,0xf5,0xff,0x54,0xb6,0xf5,0xff,0xbf,0xf6,0xfa,0xff,0xba,0xf2,0xfb,0xff,0x5e,0xc3,0xf3,0xff,0x2a,0xa1,0xf6,0xff,0x2d,0x9a,0xf8,0xff,0x31,0x97,0xf6,0xff,0x30,0x93,0xf3,0xff,0x38,0xa8,0xf8,0xff,0x3d,0xc2,0xfe,0xff,0x3a,0xc7,0xfa,0xff,0x50,0xcd,0xfb,0xff,0x55,0xce,0xfd,0xff,0x53,0xcd,0xfd,0xff,0x59,0xce,0xfd,0xff,0x5c,0xcf,0xfd,0xff,0x5b,0xcd,0xfd,0xff,0x4e,0xc9,0xfa,0xff,0x44,0xc8,0xf9,0xff,0x41,0xc8,0xf9,0xff,0x4a,0xc9,0xfc,0xff,0x49,0xc9,0xfc,0xff,0x3f,0xc5,0xfa,0xff,0x32,0xc2,0xfc,0xff,0x31,0xbf,0xfc,0xff,0x30,0xba,0xfa,0xff,0x31,0xb8,0xfa,0xff,0x31,0xb6,0xfb,0xff,0x31,0xb4,0xfa,0xff,0x30,0xb4,0xfa,0xff,0x2f,0xb5,0xfb,0xff,0x2e,0xb6,0xfb,0xff,0x2f,0xb6,0xfb,0xff,0x2d,0xb8,0xfb,0xff,0x2c,0xbe,0xfc,0xff,0x3a,0xc5,0xfa,0xff,0x50,0xcb,0xfa,0xff,0x66,0xcf,0xfb,0xff,0x74,0xd0,0xfa,0xff,0x7f,0xd4,0xfa,0xff,0x85,0xd7,0xfa,0xff,0x8a,0xd8,0xfb,0xff,0x90,0xd9,0xfb,0xff,0x92,0xda,0xfa,0xff,0x96,0xdb,0xf9,0xff,0x97,0xdb,0xf9,0xff,0x97,0xdb,0xf9,0xff,0x95,0xda,0xfa,0xff,0x92,0xd9,0xf9,0xff,0x90,0xd8,0xf9,0xff,0x8d,0xd8,0xfa,0xff,0x89,0xd8,0xfb,0xff,0x84,0xd6,0xfa,0xff,0x81,0xd3,0xf9,0xff,0x7e,0xd2,0xf9,0xff,0x7c,0xd2,0xfa,0xff,0x79,0xd1,0xfa,0xff,0x77,0xd1,0xf9,0xff,0x71,0xcf,0xfa,0xff,0x67,0xcd,0xf9,0xff,0x62,0xcc,0xf8,0xff,0x62,0xcc,0xf7,0xff,0x61,0xcc,0xf8,0xff,0x61,0xcd,0xfa,0xff,0x61,0xcd,0xfa,0xff,0x66,0xcd,0xf9,0xff,0x6a,0xcf,0xfb,0xff,0x6f,0xcf,0xfa,0xff,0x74,0xd0,0xf9,0xff,0x78,0xd2,0xfa,0xff,0x7f,0xd2,0xf8,0xff,0x8c,0xd4,0xf9,0xff,0xa4,0xda,0xf9,0xff,0xca,0xea,0xf9,0xff,0xf3,0xf7,0xfd,0xff,0xc2,0xe8,0xf8,0xff,0x6b,0xcc,0xf6,0xff,0x62,0xca,0xfa,0xff,0x5a,0xc9,0xf7,0xff,0x4e,0xc5,0xf7,0xff,0x43,0xc5,0xf6,0xff,0x39,0xc3,0xf5,0xff,0x4f,0xc3,0xf2,0xff,0xb7,0xe2,0xf7,0xff,0xf0,0xf8,0xf9,0xff,0xb2,0xdd,0xf4,0xff,0x8e,0xd3,0xf5,0xff,0x90,0xd6,0xf3,0xff,0xa7,0xdc,0xf6,0xff,0x98,0xd7,0xf4,0xff,0x9e,0xd5,0xf7,0xff,0x9d,0xd6,0xf6,0xff,0x88,0xd2,0xf0,0xff,0x8a,0xd4,0xf5,0xff,0x73,0xcd,0xf4,0xff,0x4c,0xc4,0xf2,0xff,0x28,0xba,0xf1,0xff,0x13,0xa5,0xf0,0xff,0x12,0x91,0xed,0xff,0x12,0x85,0xed,0xff,0x10,0x78,0xe5,0xff,0x0d,0x6b,0xde,0xff,0x0f,0x64,0xda,0xff,0x0e,0x5e,0xd7,0xff,0x0c,0x59,0xd3,0xff,0x0c,0x55,0xcf,0xff,0x0c,0x50,0xcc,0xff,0x0d,0x4c,0xc4,0xff,0x0b,0x47,0xb8,0xff,0x00,0x39,0xad,0xff,0x8b,0xa7,0xda,0xbb,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xe4,0xe9,0xf3,0x5b,0x49,0x6a,0xad,0xff,0x3e,0x62,0xac,0xff,0x3e,0x66,0xb4,0xff,0x3f,0x6a,0xbb,0xff,0x3e,0x6e,0xc3,0xff,0x3e,0x74,0xce,0xff,0x3f,0x78,0xdc,0xff,0x41,0x8a,0xed,0xff,0x3a,0xaa,0xf5,0xff,0x4d,0xc7,0xf8,0xff,0x89,0xda,0xfc,0xff,0x83,0xd2,0xf7,0xff,0x9a,0xdc,0xf9,0xff,0x95,0xdb,0xf9,0xff,0xa8,0xde,0xfc,0xff,0x9d,0xdc,0xf8,0xff,0xa6,0xde,0xf8,0xff,0x9b,0xdb,0xf9,0xff,0x97,0xd9,0xfa,0xff,0xa2,0xdc,0xf7,0xff,0xa6,0xdf,0xf7,0xff,0xaa,0xe0,0xf7,0xff,0x94,0xda,0xf8,0xff,0x72,0xd2,0xf6,0xff,0x82,0xd8,0xf7,0xff,0x8e,0xde,0xf7,0xff,0x3f,0xbd,0xf5,0xff,0x32,0xa3,0xf3,0xff,0x38,0x98,0xf1,0xff,0x37,0x96,0xf2,0xff,0x37,0x97,0xf3,0xff,0x30,0x95,0xf5,0xff,0x59,0xb3,0xf0,0xff,0xa3,0xea,0xf9,0xff,0x53,0xb5,0xf2,0xff,0x27,0x97,0xf3,0xff,0x36,0x98,0xf4,0xff,0x38,0x94,0xf3,0xff,0x36,0x92,0xf1,0xff,0x37,0x95,0xf2,0xff,0x3e,0xb7,0xfa,0xff,0x39,0xc2,0xfa,0xff,0x42,0xc8,0xfb,0xff,0x5b,0xd0,0xfd,0xff,0x54,0xcd,0xfd,0xff,0x46,0xc8,0xfc,0xff,0x42,0xc6,0xfb,0xff,0x41,0xc7,0xfd,0xff,0x41,0xc5,0xfc,0xff,0x3c,0xc3,0xfc,0xff,0x35,0xc3,0xfb,0xff,0x34,0xc3,0xfb,0xff,0x3b,0xc3,0xfc,0xff,0x3c,0xc4,0xfb,0xff,0x3a,0xc4,0xfb,0xff,0x36,0xc3,0xfc,0xff,0x34,0xbf,0xfc,0xff,0x33,0xbb,0xfb,0xff,0x33,0xb8,0xfb,0xff,0x32,0xb6,0xfb,0xff,0x32,0xb5,0xfb,0xff,0x32,0xb4,0xfb,0xff,0x32,0xb6,0xfb,0xff,0x31,0xb7,0xfb,0xff,0x32,0xb8,0xfb,0xff,0x31,0xb9,0xfb,0xff,0x2e,0xbe,0xfb,0xff,0x3c,0xc5,0xfa,0xff,0x52,0xcc,0xfa,0xff,0x67,0xcf,0xfc,0xff,0x73,0xd1,0xfa,0xff,0x7e,0xd4,0xf9,0xff,0x84,0xd7,0xf9,0xff,0x8b,0xd8,0xfb,0xff,0x92,0xd8,0xfa,0xff,0x93,0xd9,0xf9,0xff,0x95,0xdb,0xf8,0xff,0x98,0xdb,0xf9,0xff,0x98,0xdb,0xf9,0xff,0x96,0xdb,0xf9,0xff,0x96,0xd9,0xf9,0xff,0x93,0xd9,0xf9,0xff,0x90,0xd8,0xf9,0xff,0x8c,0xd8,0xfa,0xff,0x8a,0xd7,0xfa,0xff,0x87,0xd5,0xf9,0xff,0x83,0xd4,0xf9,0xff,0x81,0xd4,0xfa,0xff,0x7e,0xd3,0xfa,0xff,0x7c,0xd2,0xfa,0xff,0x79,0xd1,0xfa,0xff,0x72,0xcf,0xfa,0xff,0x6a,0xcf,0xf9,0xff,0x67,0xcf,0xf8,0xff,0x68,0xcf,0xf9,0xff,0x66,0xce,0xfb,0xff,0x67,0xcf,0xfa,0xff,0x6b,0xcf,0xf9,0xff,0x6f,0xd0,0xfa,0xff,0x73,0xd0,0xf9,0xff,0x78,0xd1,0xf9,0xff,0x7b,0xd3,0xf9,0xff,0x80,0xd3,0xf8,0xff,0x8a,0xd5,0xf9,0xff,0x91,0xd4,0xf9,0xff,0x94,0xd7,0xf5,0xff,0xbd,0xe6,0xf8,0xff,0xef,0xf6,0xfd,0xff,0xc2,0xe8,0xf8,0xff,0x70,0xce,0xf4,0xff,0x64,0xca,0xf8,0xff,0x56,0xc8,0xf7,0xff,0x44,0xc4,0xf6,0xff,0x3d,0xc3,0xf6,0xff,0x44,0xc3,0xf4,0xff,0x5d,0xc7,0xf2,0xff,0xcd,0xea,0xf8,0xff,0xc9,0xe7,0xf7,0xff,0x9a,0xd5,0xf3,0xff,0x9a,0xd5,0xf3,0xff,0xaa,0xdd,0xf4,0xff,0xa8,0xdd,0xf3,0xff,0xa3,0xd7,0xf1,0xff,0xac,0xdc,0xf5,0xff,0x9d,0xd6,0xf1,0xff,0x9c,0xd6,0xf3,0xff,0x95,0xd4,0xf3,0xff,0x7b,0xcd,0xf1,0xff,0x59,0xc6,0xf1,0xff,0x28,0xb1,0xee,0xff,0x11,0x99,0xea,0xff,0x14,0x89,0xeb,0xff,0x12,0x7c,0xe7,0xff,0x0e,0x6e,0xdf,0xff,0x10,0x66,0xda,0xff,0x0e,0x60,0xd8,0xff,0x0e,0x5c,0xd3,0xff,0x0e,0x57,0xd0,0xff,0x0d,0x53,0xcb,0xff,0x0c,0x4f,0xc6,0xff,0x0e,0x50,0xc4,0xff,0x00,0x46,0xbf,0xff,0x8e,0xaf,0xe4,0xbb,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xe6,0xeb,0xf4,0x59,0x4f,0x71,0xb3,0xff,0x41,0x65,0xaf,0xff,0x41,0x69,0xb7,0xff,0x43,0x6e,0xbf,0xff,0x42,0x72,0xc8,0xff,0x41,0x79,0xd4,0xff,0x43,0x7f,0xe4,0xff,0x43,0x97,0xf2,0xff,0x4c,0xbb,0xf6,0xff,0x65,0xcd,0xf7,0xff,0x9a,0xdb,0xf9,0xff,0xa1,0xdc,0xf7,0xff,0xb4,0xe3,0xf9,0xff,0xb0,0xe2,0xfa,0xff,0xbf,0xe6,0xfb,0xff,0xb7,0xe3,0xf8,0xff,0xb6,0xe4,0xf7,0xff,0xae,0xdf,0xf8,0xff,0xaf,0xe1,0xf8,0xff,0xbc,0xe5,0xf7,0xff,0xc0,0xe6,0xf7,0xff,0xbd,0xe4,0xf9,0xff,0xaa,0xdc,0xfb,0xff,0x9a,0xdc,0xf7,0xff,0x87,0xd9,0xf4,0xff,0x4a,0xc7,0xf6,0xff,0x3a,0xac,0xf6,0xff,0x3c,0x9c,0xf5,0xff,0x3c,0x99,0xf3,0xff,0x3c,0x95,0xf3,0xff,0x3c,0x92,0xf2,0xff,0x3a,0x93,0xf1,0xff,0x38,0x92,0xf3,0xff,0x38,0x95,0xf1,0xff,0x33,0x91,0xee,0xff,0x37,0x91,0xef,0xff,0x3b,0x91,0xf0,0xff,0x3d,0x91,0xf2,0xff,0x39,0x91,0xf1,0xff,0x3b,0xa1,0xf8,0xff,0x3f,0xbb,0xfd,0xff,0x3f,0xc4,0xf8,0xff,0x5b,0xcf,0xfc,0xff,0x5d,0xd0,0xfc,0xff,0x52,0xca,0xfb,0xff,0x43,0xc6,0xfb,0xff,0x3f,0xc3,0xfa,0xff,0x3f,0xc2,0xfc,0xff,0x3d,0xc1,0xfd,0xff,0x3b,0xbf,0xfc,0xff,0x3b,0xbd,0xfc,0xff,0x3a,0xbd,0xfc,0xff,0x3a,0xbe,0xfb,0xff,0x3a,0xc0,0xfc,0xff,0x3a,0xc3,0xfc,0xff,0x39,0xc3,0xfc,0xff,0x37,0xbf,0xfb,0xff,0x37,0xbc,0xfb,0xff,0x35,0xb8,0xfb,0xff,0x35,0xb6,0xfa,0xff,0x35,0xb5,0xfb,0xff,0x35,0xb5,0xfc,0xff,0x34,0xb6,0xfc,0xff,0x34,0xb8,0xfb,0xff,0x34,0xb9,0xfa,0xff,0x34,0xbc,0xfa,0xff,0x32,0xbf,0xfb,0xff,0x40,0xc6,0xfa,0xff,0x55,0xcc,0xfa,0xff,0x68,0xce,0xfc,0xff,0x74,0xd2,0xfa,0xff,0x7d,0xd4,0xf9,0xff,0x84,0xd7,0xf9,0xff,0x8c,0xd7,0xfa,0xff,0x92,0xd7,0xfa,0xff,0x94,0xd8,0xf9,0xff,0x95,0xda,0xf8,0xff,0x97,0xdb,0xf9,0xff,0x97,0xdb,0xf9,0xff,0x98,0xdb,0xf9,0xff,0x98,0xd9,0xf9,0xff,0x96,0xd9,0xf9,0xff,0x94,0xd9,0xf9,0xff,0x91,0xd8,0xf9,0xff,0x8e,0xd7,0xf9,0xff,0x8b,0xd7,0xf8,0xff,0x88,0xd5,0xf9,0xff,0x85,0xd5,0xf9,0xff,0x81,0xd5,0xfa,0xff,0x80,0xd3,0xf9,0xff,0x7e,0xd1,0xfa,0xff,0x79,0xd0,0xf9,0xff,0x73,0xd0,0xf9,0xff,0x71,0xcf,0xf8,0xff,0x73,0xcf,0xfa,0xff,0x72,0xcf,0xfc,0xff,0x71,0xcf,0xfb,0xff,0x71,0xd0,0xf8,0xff,0x76,0xd0,0xfa,0xff,0x7a,0xd0,0xf9,0xff,0x7d,0xd1,0xf8,0xff,0x7e,0xd3,0xf8,0xff,0x82,0xd4,0xf8,0xff,0x8c,0xd5,0xf8,0xff,0x92,0xd6,0xf8,0xff,0x8f,0xd7,0xf9,0xff,0x8c,0xd5,0xf4,0xff,0xc1,0xe6,0xf6,0xff,0xcd,0xeb,0xf7,0xff,0x7c,0xcc,0xf5,0xff,0x6d,0xcb,0xf9,0xff,0x61,0xcb,0xf7,0xff,0x4a,0xc5,0xf4,0xff,0x43,0xc1,0xf5,0xff,0x4e,0xc3,0xf6,0xff,0x5e,0xc7,0xf4,0xff,0x7c,0xcd,0xf4,0xff,0x8d,0xd2,0xf5,0xff,0x9f,0xd8,0xf5,0xff,0xa0,0xd6,0xf4,0xff,0xa9,0xda,0xf3,0xff,0xb3,0xe0,0xf6,0xff,0xa6,0xd5,0xf0,0xff,0xb3,0xde,0xf3,0xff,0xac,0xdb,0xf2,0xff,0xa5,0xd6,0xf2,0xff,0xa9,0xd8,0xf1,0xff,0x8b,0xd0,0xf1,0xff,0x56,0xc4,0xef,0xff,0x26,0xb5,0xee,0xff,0x10,0x9c,0xec,0xff,0x14,0x8a,0xe9,0xff,0x13,0x7c,0xe8,0xff,0x11,0x72,0xe2,0xff,0x11,0x69,0xdb,0xff,0x0e,0x63,0xd7,0xff,0x0f,0x5e,0xd3,0xff,0x10,0x59,0xce,0xff,0x0d,0x54,0xc9,0xff,0x0a,0x50,0xc6,0xff,0x0e,0x55,0xca,0xff,0x04,0x58,0xcf,0xff,0x95,0xbb,0xed,0xb9,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xea,0xee,0xf6,0x38,0x58,0x78,0xb7,0xfe,0x44,0x68,0xb1,0xff,0x46,0x6e,0xbb,0xff,0x46,0x71,0xc2,0xff,0x45,0x75,0xcb,0xff,0x44,0x7c,0xd7,0xff,0x45,0x86,0xe6,0xff,0x46,0xa9,0xf5,0xff,0x68,0xcc,0xf8,0xff,0x8f,0xd9,0xf8,0xff,0xaa,0xdf,0xf8,0xff,0xb1,0xe3,0xf8,0xff,0xc1,0xe8,0xf7,0xff,0xc5,0xe8,0xf8,0xff,0xcf,0xe9,0xfa,0xff,0xc7,0xe7,0xf7,0xff,0xc3,0xe6,0xf6,0xff,0xb9,0xe4,0xf5,0xff,0xba,0xe6,0xf6,0xff,0xc1,0xe7,0xf6,0xff,0xc3,0xe6,0xf8,0xff,0xbe,0xe3,0xf8,0xff,0xad,0xe0,0xf7,0xff,0xa1,0xdd,0xf6,0xff,0x81,0xd7,0xf7,0xff,0x46,0xbb,0xf7,0xff,0x3f,0xa4,0xf6,0xff,0x43,0x9b,0xf5,0xff,0x3e,0x95,0xf0,0xff,0x3e,0x8f,0xef,0xff,0x3e,0x8a,0xec,0xff,0x3c,0x88,0xe9,0xff,0x41,0x89,0xed,0xff,0x3f,0x86,0xeb,0xff,0x3d,0x86,0xe9,0xff,0x3e,0x88,0xec,0xff,0x3f,0x8c,0xed,0xff,0x40,0x91,0xf0,0xff,0x3e,0x93,0xf0,0xff,0x40,0xa3,0xf7,0xff,0x3e,0xb2,0xf7,0xff,0x54,0xca,0xfa,0xff,0x71,0xd3,0xfb,0xff,0x5c,0xce,0xfb,0xff,0x4a,0xc9,0xf9,0xff,0x41,0xc6,0xfa,0xff,0x40,0xc2,0xfb,0xff,0x3d,0xbe,0xfa,0xff,0x3e,0xbb,0xfb,0xff,0x3d,0xb9,0xfb,0xff,0x3c,0xb7,0xfa,0xff,0x3b,0xb7,0xf9,0xff,0x3a,0xb9,0xfa,0xff,0x3b,0xbc,0xfb,0xff,0x3a,0xc0,0xfc,0xff,0x3a,0xc0,0xfa,0xff,0x39,0xbe,0xfa,0xff,0x38,0xbc,0xf9,0xff,0x37,0xb8,0xf9,0xff,0x38,0xb7,0xfa,0xff,0x38,0xb7,0xfa,0xff,0x37,0xb7,0xfa,0xff,0x36,0xb7,0xf9,0xff,0x36,0xb9,0xf9,0xff,0x36,0xbc,0xf9,0xff,0x35,0xbd,0xf9,0xff,0x35,0xc1,0xf9,0xff,0x47,0xc8,0xf7,0xff,0x5b,0xcc,0xf8,0xff,0x6a,0xce,0xfc,0xff,0x74,0xd0,0xfa,0xff,0x7f,0xd3,0xf9,0xff,0x85,0xd6,0xf8,0xff,0x89,0xd6,0xf9,0xff,0x8f,0xd7,0xfa,0xff,0x93,0xd9,0xf9,0xff,0x96,0xda,0xf8,0xff,0x97,0xdb,0xf9,0xff,0x99,0xda,0xf9,0xff,0x99,0xda,0xf9,0xff,0x99,0xd9,0xf8,0xff,0x98,0xd9,0xf8,0xff,0x97,0xda,0xf8,0xff,0x95,0xd9,0xf9,0xff,0x93,0xd8,0xf8,0xff,0x91,0xd7,0xf7,0xff,0x8d,0xd6,0xf7,0xff,0x8a,0xd6,0xf8,0xff,0x86,0xd5,0xf8,0xff,0x85,0xd5,0xf8,0xff,0x82,0xd4,0xf8,0xff,0x7e,0xd1,0xf7,0xff,0x7b,0xd0,0xf6,0xff,0x79,0xd0,0xf7,0xff,0x77,0xd0,0xf8,0xff,0x77,0xd0,0xf8,0xff,0x76,0xd0,0xf9,0xff,0x77,0xd0,0xf9,0xff,0x79,0xd1,0xf9,0xff,0x7c,0xd2,0xf8,0xff,0x81,0xd3,0xf7,0xff,0x82,0xd2,0xf7,0xff,0x85,0xd3,0xf7,0xff,0x8c,0xd6,0xf6,0xff,0x91,0xd7,0xf7,0xff,0x94,0xd8,0xf8,0xff,0x8f,0xd6,0xf9,0xff,0x86,0xd5,0xf7,0xff,0x82,0xd1,0xf6,0xff,0x7d,0xcf,0xf7,0xff,0x79,0xcf,0xf6,0xff,0x6d,0xcd,0xf4,0xff,0x5f,0xc9,0xf4,0xff,0x55,0xc6,0xf4,0xff,0x56,0xc6,0xf5,0xff,0x61,0xc7,0xf4,0xff,0x77,0xcc,0xf4,0xff,0x8b,0xd3,0xf3,0xff,0x9e,0xd8,0xf3,0xff,0xaa,0xda,0xf4,0xff,0xab,0xd7,0xf1,0xff,0xb9,0xe0,0xf6,0xff,0xb3,0xda,0xf0,0xff,0xb0,0xdc,0xed,0xff,0xb9,0xe0,0xf3,0xff,0xaa,0xd8,0xf2,0xff,0xac,0xd8,0xf1,0xff,0x98,0xd2,0xf0,0xff,0x5e,0xc4,0xed,0xff,0x33,0xb9,0xee,0xff,0x15,0xa4,0xeb,0xff,0x14,0x8e,0xea,0xff,0x12,0x80,0xe7,0xff,0x10,0x76,0xe0,0xff,0x12,0x6e,0xdb,0xff,0x10,0x68,0xd7,0xff,0x0e,0x62,0xd3,0xff,0x0d,0x5b,0xcd,0xff,0x0d,0x55,0xc9,0xff,0x0a,0x52,0xc3,0xff,0x0b,0x53,0xc3,0xff,0x08,0x62,0xd4,0xff,0xa0,0xc9,0xf5,0x90,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xed,0xf1,0xf8,0x1a,0x60,0x81,0xbc,0xf0,0x45,0x6c,0xb5,0xff,0x4a,0x72,0xbe,0xff,0x4b,0x76,0xc5,0xff,0x49,0x7b,0xcf,0xff,0x4a,0x81,0xdb,0xff,0x49,0x8e,0xe7,0xff,0x4d,0xbb,0xf7,0xff,0x7e,0xd5,0xf6,0xff,0xaa,0xdf,0xf6,0xff,0xb5,0xe2,0xf6,0xff,0xbe,0xe4,0xfa,0xff,0xcc,0xe9,0xf9,0xff,0xcb,0xe5,0xf5,0xff,0xd3,0xe8,0xf6,0xff,0xd2,0xea,0xf7,0xff,0xcf,0xe8,0xf7,0xff,0xca,0xe6,0xf6,0xff,0xc6,0xe5,0xf5,0xff,0xc7,0xe5,0xf7,0xff,0xc5,0xe4,0xf7,0xff,0xbd,0xe3,0xf4,0xff,0xad,0xe2,0xf3,0xff,0x9c,0xdb,0xf7,0xff,0x5c,0xc7,0xf5,0xff,0x41,0xac,0xf5,0xff,0x44,0xa0,0xf4,0xff,0x45,0x97,0xf0,0xff,0x43,0x8d,0xeb,0xff,0x41,0x87,0xe7,0xff,0x40,0x82,0xe4,0xff,0x40,0x7f,0xe1,0xff,0x42,0x80,0xe2,0xff,0x43,0x80,0xe3,0xff,0x41,0x7e,0xe2,0xff,0x41,0x80,0xe4,0xff,0x41,0x86,0xe8,0xff,0x42,0x93,0xef,0xff,0x43,0x93,0xf0,0xff,0x40,0x93,0xf1,0xff,0x49,0xb3,0xf4,0xff,0x72,0xd5,0xfc,0xff,0x77,0xd4,0xf8,0xff,0x5c,0xcd,0xfa,0xff,0x49,0xc8,0xf9,0xff,0x43,0xc5,0xfa,0xff,0x41,0xc1,0xfa,0xff,0x40,0xbc,0xf9,0xff,0x41,0xb8,0xfb,0xff,0x41,0xb5,0xfb,0xff,0x41,0xb3,0xfa,0xff,0x40,0xb2,0xf9,0xff,0x3f,0xb3,0xfa,0xff,0x3f,0xb7,0xfa,0xff,0x3e,0xbc,0xfb,0xff,0x3d,0xbe,0xfb,0xff,0x3d,0xbd,0xfa,0xff,0x3c,0xbb,0xf9,0xff,0x3a,0xb9,0xf9,0xff,0x3b,0xb7,0xf9,0xff,0x3b,0xb7,0xf9,0xff,0x3b,0xb8,0xf9,0xff,0x3a,0xb9,0xf9,0xff,0x3a,0xba,0xf9,0xff,0x39,0xbe,0xf9,0xff,0x38,0xc0,0xf9,0xff,0x3c,0xc4,0xfa,0xff,0x4e,0xc9,0xf9,0xff,0x60,0xcd,0xf9,0xff,0x6c,0xcf,0xfc,0xff,0x77,0xd0,0xfa,0xff,0x80,0xd3,0xfa,0xff,0x84,0xd6,0xf9,0xff,0x89,0xd6,0xf9,0xff,0x8f,0xd7,0xf9,0xff,0x94,0xd8,0xf8,0xff,0x97,0xd9,0xf8,0xff,0x98,0xd9,0xf8,0xff,0x9a,0xda,0xf9,0xff,0x9c,0xda,0xf9,0xff,0x9c,0xda,0xf8,0xff,0x9a,0xd9,0xf8,0xff,0x98,0xd9,0xf8,0xff,0x98,0xd9,0xf9,0xff,0x97,0xd8,0xf7,0xff,0x94,0xd8,0xf7,0xff,0x91,0xd7,0xf7,0xff,0x8f,0xd6,0xf8,0xff,0x8d,0xd7,0xf9,0xff,0x8b,0xd6,0xf8,0xff,0x88,0xd4,0xf8,0xff,0x85,0xd3,0xf7,0xff,0x83,0xd2,0xf7,0xff,0x80,0xd2,0xf8,0xff,0x7d,0xd3,0xf7,0xff,0x7b,0xd2,0xf8,0xff,0x78,0xd0,0xf8,0xff,0x7b,0xd1,0xf8,0xff,0x7d,0xd2,0xfa,0xff,0x7f,0xd3,0xf8,0xff,0x83,0xd3,0xf7,0xff,0x85,0xd4,0xf7,0xff,0x89,0xd4,0xf7,0xff,0x8c,0xd5,0xf6,0xff,0x90,0xd6,0xf7,0xff,0x94,0xd7,0xf7,0xff,0x92,0xd6,0xf7,0xff,0x88,0xd5,0xf6,0xff,0x84,0xd4,0xf7,0xff,0x83,0xd2,0xf8,0xff,0x7f,0xd0,0xf4,0xff,0x79,0xce,0xf6,0xff,0x73,0xcd,0xf4,0xff,0x6c,0xcb,0xf2,0xff,0x69,0xca,0xf1,0xff,0x6e,0xcb,0xf2,0xff,0x7e,0xd0,0xf4,0xff,0x92,0xd5,0xf4,0xff,0xa0,0xd7,0xf2,0xff,0xb4,0xde,0xf4,0xff,0xb2,0xdb,0xef,0xff,0xba,0xdd,0xf0,0xff,0xbf,0xdf,0xef,0xff,0xab,0xd8,0xec,0xff,0xbc,0xdf,0xf3,0xff,0xb5,0xda,0xf1,0xff,0xab,0xd8,0xee,0xff,0xa4,0xd6,0xee,0xff,0x85,0xcb,0xed,0xff,0x60,0xc3,0xed,0xff,0x32,0xb3,0xee,0xff,0x13,0x9b,0xea,0xff,0x13,0x89,0xe7,0xff,0x11,0x7d,0xe1,0xff,0x11,0x73,0xdb,0xff,0x11,0x6c,0xd9,0xff,0x0f,0x66,0xd5,0xff,0x0c,0x5d,0xcf,0xff,0x0c,0x56,0xc9,0xff,0x0c,0x54,0xc4,0xff,0x09,0x4f,0xbf,0xff,0x0a,0x60,0xcf,0xff,0xa9,0xcd,0xf4,0x6a,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xf2,0xf5,0xfa,0x0f,0x6a,0x8c,0xc2,0xeb,0x47,0x70,0xb7,0xff,0x4f,0x75,0xc1,0xff,0x4e,0x7a,0xca,0xff,0x4e,0x81,0xd4,0xff,0x4f,0x88,0xdf,0xff,0x4c,0x92,0xeb,0xff,0x52,0xbe,0xf8,0xff,0x83,0xd9,0xf6,0xff,0xb0,0xe1,0xf6,0xff,0xbf,0xe5,0xf6,0xff,0xcc,0xe7,0xf9,0xff,0xd8,0xec,0xf7,0xff,0xd0,0xe5,0xf1,0xff,0xd6,0xea,0xf6,0xff,0xd3,0xe7,0xf4,0xff,0xd2,0xea,0xf6,0xff,0xd0,0xe7,0xf6,0xff,0xc9,0xe5,0xf5,0xff,0xc4,0xe3,0xf7,0xff,0xbd,0xe3,0xf6,0xff,0xb2,0xe1,0xf4,0xff,0x9e,0xda,0xf7,0xff,0x6a,0xcb,0xf9,0xff,0x44,0xaf,0xf3,0xff,0x4a,0xa1,0xf4,0xff,0x4a,0x96,0xf2,0xff,0x47,0x8e,0xeb,0xff,0x46,0x85,0xe3,0xff,0x45,0x80,0xdc,0xff,0x44,0x7c,0xd7,0xff,0x43,0x77,0xd1,0xff,0x45,0x78,0xd0,0xff,0x48,0x79,0xd3,0xff,0x45,0x78,0xd4,0xff,0x43,0x78,0xd3,0xff,0x41,0x81,0xdb,0xff,0x47,0x93,0xee,0xff,0x46,0x90,0xef,0xff,0x41,0x96,0xed,0xff,0x68,0xca,0xf8,0xff,0x85,0xd7,0xfa,0xff,0x79,0xd3,0xf7,0xff,0x5c,0xce,0xfa,0xff,0x4b,0xc8,0xf9,0xff,0x49,0xc2,0xfb,0xff,0x48,0xbe,0xfa,0xff,0x46,0xb9,0xf8,0xff,0x45,0xb4,0xf9,0xff,0x45,0xb2,0xf9,0xff,0x43,0xb0,0xf8,0xff,0x41,0xaf,0xf8,0xff,0x43,0xb0,0xf9,0xff,0x45,0xb2,0xfa,0xff,0x44,0xb7,0xfa,0xff,0x41,0xbb,0xfa,0xff,0x41,0xbc,0xfa,0xff,0x40,0xbb,0xfa,0xff,0x3f,0xba,0xf9,0xff,0x3f,0xb8,0xf9,0xff,0x41,0xb9,0xf9,0xff,0x40,0xba,0xf9,0xff,0x40,0xbb,0xfa,0xff,0x3f,0xbd,0xfa,0xff,0x3d,0xc0,0xf9,0xff,0x3d,0xc2,0xf9,0xff,0x43,0xc5,0xfb,0xff,0x55,0xc9,0xf9,0xff,0x60,0xce,0xf9,0xff,0x6e,0xcf,0xfb,0xff,0x79,0xd0,0xfa,0xff,0x81,0xd2,0xfa,0xff,0x85,0xd6,0xf9,0xff,0x8b,0xd6,0xf7,0xff,0x91,0xd6,0xf8,0xff,0x95,0xd8,0xf7,0xff,0x97,0xd9,0xf7,0xff,0x98,0xd9,0xf8,0xff,0x9c,0xd9,0xf8,0xff,0x9e,0xda,0xf9,0xff,0x9e,0xd9,0xf6,0xff,0xa0,0xda,0xf6,0xff,0x9f,0xdb,0xf7,0xff,0x9c,0xda,0xf7,0xff,0x98,0xd8,0xf6,0xff,0x96,0xd8,0xf6,0xff,0x94,0xd8,0xf7,0xff,0x91,0xd6,0xf7,0xff,0x8f,0xd6,0xf7,0xff,0x8f,0xd6,0xf7,0xff,0x8d,0xd5,0xf7,0xff,0x8b,0xd5,0xf8,0xff,0x8a,0xd3,0xf8,0xff,0x8a,0xd4,0xf8,0xff,0x89,0xd4,0xf7,0xff,0x82,0xd3,0xf8,0xff,0x7a,0xd1,0xf7,0xff,0x7e,0xd2,0xf8,0xff,0x80,0xd2,0xf9,0xff,0x84,0xd4,0xf8,0xff,0x88,0xd4,0xf6,0xff,0x89,0xd5,0xf6,0xff,0x8b,0xd4,0xf6,0xff,0x8d,0xd4,0xf6,0xff,0x91,0xd5,0xf6,0xff,0x92,0xd6,0xf6,0xff,0x8f,0xd4,0xf6,0xff,0x8b,0xd2,0xf6,0xff,0x8a,0xd4,0xf8,0xff,0x87,0xd3,0xf5,0xff,0x83,0xd1,0xf4,0xff,0x80,0xd0,0xf6,0xff,0x7e,0xce,0xf5,0xff,0x7c,0xcd,0xf4,0xff,0x7a,0xcc,0xf3,0xff,0x7d,0xce,0xf4,0xff,0x84,0xd1,0xf5,0xff,0x94,0xd3,0xf4,0xff,0x9f,0xd5,0xf0,0xff,0xae,0xd9,0xf2,0xff,0xbd,0xdf,0xf0,0xff,0xbd,0xdd,0xec,0xff,0xc1,0xe0,0xf2,0xff,0xb0,0xd8,0xed,0xff,0xb7,0xdd,0xf0,0xff,0xbc,0xdc,0xf0,0xff,0xb1,0xd9,0xee,0xff,0xad,0xd6,0xec,0xff,0xa0,0xd2,0xeb,0xff,0x84,0xca,0xe9,0xff,0x5d,0xbf,0xeb,0xff,0x1c,0xa7,0xe8,0xff,0x13,0x94,0xe8,0xff,0x15,0x86,0xe1,0xff,0x14,0x7c,0xda,0xff,0x13,0x74,0xda,0xff,0x10,0x6a,0xd6,0xff,0x0d,0x61,0xd0,0xff,0x0f,0x5a,0xcb,0xff,0x0f,0x56,0xc6,0xff,0x0b,0x52,0xc3,0xff,0x0b,0x5b,0xca,0xff,0xb2,0xcf,0xf2,0x5d,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xf7,0xf9,0xfc,0x0d,0x77,0x94,0xc8,0xea,0x49,0x70,0xb9,0xff,0x4d,0x78,0xc3,0xff,0x50,0x7d,0xce,0xff,0x51,0x83,0xd9,0xff,0x50,0x8a,0xde,0xff,0x4f,0x94,0xe8,0xff,0x51,0xb4,0xf3,0xff,0x72,0xcf,0xf4,0xff,0xa8,0xde,0xf6,0xff,0xc8,0xe7,0xf7,0xff,0xd4,0xea,0xf6,0xff,0xdb,0xee,0xf5,0xff,0xd3,0xe6,0xf1,0xff,0xd5,0xe9,0xf5,0xff,0xd3,0xe5,0xf2,0xff,0xd6,0xe8,0xf6,0xff,0xd1,0xe6,0xf6,0xff,0xcc,0xe6,0xf6,0xff,0xc1,0xe4,0xf5,0xff,0xb4,0xe1,0xf3,0xff,0x9f,0xdc,0xf5,0xff,0x76,0xcd,0xfa,0xff,0x4c,0xb2,0xf4,0xff,0x47,0x9f,0xf1,0xff,0x4d,0x92,0xeb,0xff,0x4e,0x89,0xe4,0xff,0x4c,0x83,0xdd,0xff,0x4b,0x7d,0xd5,0xff,0x4a,0x7a,0xcf,0xff,0x4a,0x76,0xc8,0xff,0x4a,0x72,0xc1,0xff,0x4b,0x74,0xbf,0xff,0x4c,0x75,0xbf,0xff,0x4c,0x76,0xc0,0xff,0x4b,0x71,0xbe,0xff,0x44,0x7d,0xcf,0xff,0x4c,0x93,0xef,0xff,0x44,0x8e,0xec,0xff,0x58,0xb1,0xf3,0xff,0x8d,0xdb,0xf9,0xff,0x89,0xd6,0xf5,0xff,0x79,0xd4,0xf7,0xff,0x5d,0xcd,0xfa,0xff,0x4e,0xc7,0xfb,0xff,0x4d,0xc1,0xf9,0xff,0x4c,0xbc,0xf9,0xff,0x48,0xb7,0xf7,0xff,0x48,0xb2,0xf9,0xff,0x49,0xb0,0xfa,0xff,0x46,0xad,0xf8,0xff,0x46,0xaa,0xf7,0xff,0x46,0xaa,0xf7,0xff,0x46,0xab,0xf6,0xff,0x46,0xb2,0xf9,0xff,0x44,0xb8,0xfa,0xff,0x43,0xb9,0xf8,0xff,0x43,0xba,0xf8,0xff,0x43,0xba,0xf9,0xff,0x43,0xbb,0xf8,0xff,0x45,0xbc,0xf8,0xff,0x44,0xbd,0xf9,0xff,0x45,0xbe,0xf8,0xff,0x43,0xc0,0xf9,0xff,0x43,0xc2,0xf8,0xff,0x43,0xc4,0xf8,0xff,0x48,0xc8,0xfa,0xff,0x58,0xcc,0xf9,0xff,0x66,0xcf,0xf8,0xff,0x73,0xd0,0xf9,0xff,0x7c,0xd1,0xf9,0xff,0x83,0xd4,0xf9,0xff,0x87,0xd6,0xf7,0xff,0x8c,0xd6,0xf7,0xff,0x90,0xd6,0xf6,0xff,0x94,0xd7,0xf6,0xff,0x97,0xd8,0xf6,0xff,0x9b,0xda,0xf7,0xff,0x9d,0xd9,0xf7,0xff,0x9f,0xda,0xf7,0xff,0xa0,0xd9,0xf7,0xff,0xa4,0xdb,0xf8,0xff,0xa3,0xdc,0xf8,0xff,0x9b,0xd8,0xf5,0xff,0x99,0xd8,0xf5,0xff,0x98,0xd8,0xf6,0xff,0x96,0xd8,0xf6,0xff,0x93,0xd7,0xf5,0xff,0x92,0xd6,0xf6,0xff,0x91,0xd6,0xf7,0xff,0x90,0xd6,0xf6,0xff,0x90,0xd5,0xf6,0xff,0x8f,0xd5,0xf5,0xff,0x90,0xd5,0xf6,0xff,0x90,0xd5,0xf7,0xff,0x89,0xd3,0xf7,0xff,0x7f,0xd2,0xf6,0xff,0x81,0xd3,0xf6,0xff,0x82,0xd3,0xf8,0xff,0x87,0xd5,0xf9,0xff,0x8a,0xd5,0xf6,0xff,0x8c,0xd4,0xf6,0xff,0x8e,0xd4,0xf6,0xff,0x8f,0xd5,0xf5,0xff,0x92,0xd5,0xf6,0xff,0x92,0xd6,0xf6,0xff,0x8e,0xd4,0xf4,0xff,0x8b,0xd2,0xf4,0xff,0x8a,0xd3,0xf5,0xff,0x88,0xd3,0xf5,0xff,0x86,0xd1,0xf4,0xff,0x84,0xd1,0xf5,0xff,0x84,0xd0,0xf5,0xff,0x84,0xd0,0xf5,0xff,0x85,0xd1,0xf5,0xff,0x82,0xce,0xf2,0xff,0x8b,0xd1,0xf5,0xff,0x94,0xd3,0xf4,0xff,0x9c,0xd6,0xf2,0xff,0xa7,0xd6,0xf0,0xff,0xbd,0xdf,0xf0,0xff,0xc0,0xde,0xec,0xff,0xba,0xdc,0xef,0xff,0xb8,0xdc,0xee,0xff,0xb8,0xda,0xeb,0xff,0xbd,0xdd,0xee,0xff,0xb9,0xd9,0xec,0xff,0xb1,0xd7,0xeb,0xff,0xaa,0xd5,0xea,0xff,0x9a,0xcf,0xea,0xff,0x81,0xc7,0xe9,0xff,0x3b,0xb6,0xe6,0xff,0x14,0xa0,0xe6,0xff,0x15,0x90,0xde,0xff,0x14,0x82,0xdb,0xff,0x14,0x79,0xda,0xff,0x12,0x70,0xd5,0xff,0x0f,0x66,0xd0,0xff,0x10,0x60,0xca,0xff,0x0e,0x57,0xc5,0xff,0x0b,0x51,0xc3,0xff,0x12,0x64,0xcb,0xff,0xbf,0xd8,0xf3,0x5b,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfd,0xfe,0xfe,0x0d,0x84,0x9f,0xce,0xea,0x4b,0x73,0xbb,0xff,0x51,0x7c,0xc6,0xff,0x53,0x81,0xd0,0xff,0x54,0x87,0xda,0xff,0x54,0x8e,0xe0,0xff,0x53,0x97,0xe7,0xff,0x50,0xae,0xf2,0xff,0x61,0xc4,0xf4,0xff,0xa0,0xdb,0xf6,0xff,0xc9,0xe8,0xf6,0xff,0xd3,0xe9,0xf6,0xff,0xd9,0xec,0xf6,0xff,0xd2,0xe3,0xef,0xff,0xcf,0xe2,0xef,0xff,0xcd,0xde,0xeb,0xff,0xd6,0xe6,0xf4,0xff,0xd3,0xe7,0xf7,0xff,0xce,0xe6,0xf7,0xff,0xbd,0xe2,0xf5,0xff,0xa4,0xdd,0xf0,0xff,0x7a,0xd4,0xf2,0xff,0x4d,0xb8,0xf5,0xff,0x4e,0xa0,0xf0,0xff,0x4f,0x95,0xea,0xff,0x4e,0x89,0xe0,0xff,0x4e,0x83,0xd7,0xff,0x50,0x80,0xcf,0xff,0x4f,0x7b,0xc5,0xff,0x4e,0x78,0xbf,0xff,0x4d,0x73,0xb9,0xff,0x4e,0x71,0xb5,0xff,0x4f,0x71,0xb4,0xff,0x50,0x72,0xb4,0xff,0x53,0x73,0xb4,0xff,0x51,0x6f,0xaf,0xff,0x4d,0x7d,0xcb,0xff,0x4e,0x96,0xf3,0xff,0x4f,0xa4,0xf1,0xff,0x84,0xd5,0xf9,0xff,0x9b,0xdc,0xf5,0xff,0x8b,0xd5,0xf5,0xff,0x78,0xd3,0xf7,0xff,0x5b,0xcd,0xf8,0xff,0x4f,0xc6,0xfa,0xff,0x4f,0xc1,0xf9,0xff,0x4d,0xba,0xf8,0xff,0x4b,0xb5,0xf8,0xff,0x4c,0xb2,0xf9,0xff,0x4f,0xae,0xf8,0xff,0x4e,0xab,0xf6,0xff,0x50,0xa8,0xf5,0xff,0x4f,0xa7,0xf5,0xff,0x4b,0xa6,0xf4,0xff,0x4c,0xad,0xf7,0xff,0x4b,0xb4,0xfa,0xff,0x4b,0xb6,0xf8,0xff,0x4a,0xb9,0xf7,0xff,0x4b,0xbb,0xfa,0xff,0x49,0xbc,0xf9,0xff,0x49,0xbd,0xf9,0xff,0x4a,0xc0,0xf8,0xff,0x48,0xc0,0xf7,0xff,0x48,0xc3,0xf8,0xff,0x48,0xc5,0xf7,0xff,0x4b,0xc5,0xf7,0xff,0x51,0xc8,0xf9,0xff,0x5d,0xcd,0xf8,0xff,0x6c,0xcf,0xf7,0xff,0x77,0xd0,0xf8,0xff,0x7e,0xd2,0xf8,0xff,0x85,0xd4,0xf8,0xff,0x8a,0xd7,0xf8,0xff,0x8f,0xd7,0xf8,0xff,0x93,0xd7,0xf8,0xff,0x96,0xd8,0xf7,0xff,0x9a,0xdb,0xf8,0xff,0x9c,0xdb,0xf7,0xff,0xa1,0xdc,0xf8,0xff,0xa1,0xda,0xf7,0xff,0xa2,0xda,0xf7,0xff,0xa2,0xda,0xf7,0xff,0x9a,0xd3,0xf1,0xff,0x94,0xd1,0xee,0xff,0x98,0xd6,0xf4,0xff,0x9a,0xd8,0xf6,0xff,0x98,0xd7,0xf6,0xff,0x95,0xd6,0xf4,0xff,0x95,0xd5,0xf3,0xff,0x92,0xd5,0xf4,0xff,0x91,0xd4,0xf3,0xff,0x92,0xd4,0xf4,0xff,0x92,0xd5,0xf2,0xff,0x93,0xd5,0xf3,0xff,0x95,0xd5,0xf6,0xff,0x8c,0xd3,0xf6,0xff,0x80,0xd1,0xf4,0xff,0x83,0xd3,0xf5,0xff,0x85,0xd4,0xf7,0xff,0x89,0xd4,0xf7,0xff,0x8c,0xd5,0xf6,0xff,0x8e,0xd4,0xf6,0xff,0x8f,0xd4,0xf6,0xff,0x90,0xd5,0xf5,0xff,0x91,0xd4,0xf5,0xff,0x90,0xd4,0xf5,0xff,0x8c,0xd4,0xf3,0xff,0x8a,0xd2,0xf3,0xff,0x89,0xd1,0xf3,0xff,0x8a,0xd2,0xf3,0xff,0x89,0xd1,0xf3,0xff,0x89,0xd0,0xf4,0xff,0x89,0xd0,0xf3,0xff,0x88,0xce,0xf2,0xff,0x75,0xbe,0xe3,0xff,0x70,0xb8,0xdd,0xff,0x84,0xc8,0xed,0xff,0x8b,0xcc,0xef,0xff,0x99,0xd4,0xf2,0xff,0xa5,0xd8,0xf0,0xff,0xb1,0xda,0xea,0xff,0xbb,0xdd,0xec,0xff,0xb8,0xda,0xec,0xff,0xc1,0xde,0xef,0xff,0xc1,0xdb,0xea,0xff,0xc2,0xdd,0xec,0xff,0xbf,0xdb,0xeb,0xff,0xb7,0xd7,0xea,0xff,0xaf,0xd4,0xe9,0xff,0xa7,0xd0,0xe9,0xff,0x97,0xc9,0xe9,0xff,0x6c,0xc0,0xe6,0xff,0x2f,0xae,0xe0,0xff,0x11,0x9b,0xdb,0xff,0x13,0x8c,0xdc,0xff,0x15,0x80,0xdb,0xff,0x13,0x77,0xd7,0xff,0x13,0x6f,0xd3,0xff,0x13,0x64,0xcd,0xff,0x0f,0x58,0xc5,0xff,0x0b,0x4f,0xbd,0xff,0x1d,0x78,0xd1,0xff,0xd2,0xe7,0xf9,0x5b,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x04,0x95,0xad,0xd6,0xd1,0x4e,0x76,0xbe,0xff,0x54,0x7f,0xc9,0xff,0x56,0x84,0xd1,0xff,0x58,0x8b,0xdb,0xff,0x58,0x92,0xe2,0xff,0x57,0x99,0xe8,0xff,0x56,0xb0,0xf4,0xff,0x61,0xc5,0xf3,0xff,0x99,0xd8,0xf1,0xff,0xc5,0xe5,0xf2,0xff,0xd3,0xe9,0xf6,0xff,0xda,0xea,0xf5,0xff,0xce,0xdf,0xeb,0xff,0xcd,0xdd,0xea,0xff,0xcb,0xdd,0xea,0xff,0xd1,0xe3,0xf0,0xff,0xd4,0xe9,0xf7,0xff,0xc7,0xe4,0xf2,0xff,0xb2,0xde,0xf2,0xff,0x87,0xd4,0xf3,0xff,0x58,0xbc,0xf1,0xff,0x50,0xa4,0xef,0xff,0x53,0x97,0xe8,0xff,0x54,0x89,0xdc,0xff,0x56,0x89,0xe0,0xff,0x56,0x8a,0xdd,0xff,0x57,0x7c,0xc4,0xff,0x55,0x76,0xb4,0xff,0x55,0x76,0xb0,0xff,0x54,0x74,0xae,0xff,0x52,0x73,0xad,0xff,0x51,0x72,0xad,0xff,0x53,0x73,0xaf,0xff,0x57,0x74,0xaa,0xff,0x51,0x70,0xa4,0xff,0x4f,0x83,0xcb,0xff,0x55,0xb5,0xf5,0xff,0x7f,0xd3,0xf7,0xff,0xa3,0xdf,0xf8,0xff,0x97,0xd8,0xf6,0xff,0x8b,0xd6,0xf6,0xff,0x75,0xd0,0xf7,0xff,0x5a,0xc9,0xf6,0xff,0x52,0xc4,0xf8,0xff,0x53,0xbf,0xf8,0xff,0x52,0xb9,0xf7,0xff,0x51,0xb4,0xf8,0xff,0x52,0xb1,0xf8,0xff,0x52,0xad,0xf6,0xff,0x50,0xaa,0xf4,0xff,0x52,0xa7,0xf3,0xff,0x53,0xa5,0xf4,0xff,0x51,0xa4,0xf4,0xff,0x51,0xa7,0xf4,0xff,0x50,0xae,0xf7,0xff,0x4d,0xb2,0xf5,0xff,0x4d,0xb9,0xf7,0xff,0x4f,0xbc,0xfa,0xff,0x4f,0xbd,0xf9,0xff,0x4f,0xbf,0xf8,0xff,0x4f,0xc1,0xf8,0xff,0x4e,0xc2,0xf7,0xff,0x4c,0xc5,0xf7,0xff,0x4d,0xc6,0xf7,0xff,0x51,0xc6,0xf8,0xff,0x58,0xca,0xf9,0xff,0x64,0xcd,0xf9,0xff,0x71,0xcf,0xf8,0xff,0x7b,0xd0,0xf7,0xff,0x81,0xd2,0xf6,0xff,0x86,0xd3,0xf7,0xff,0x88,0xd2,0xf5,0xff,0x8c,0xd3,0xf4,0xff,0x91,0xd4,0xf6,0xff,0x95,0xd6,0xf6,0xff,0x7c,0xbc,0xda,0xff,0x7d,0xb8,0xd9,0xff,0x88,0xc2,0xe4,0xff,0x9d,0xd6,0xf5,0xff,0xa7,0xdf,0xfb,0xff,0x9e,0xd7,0xf2,0xff,0x9a,0xd4,0xf1,0xff,0x96,0xd1,0xee,0xff,0x96,0xd3,0xef,0xff,0x99,0xd7,0xf4,0xff,0x97,0xd6,0xf4,0xff,0x96,0xd5,0xf3,0xff,0x95,0xd5,0xf1,0xff,0x92,0xd4,0xf1,0xff,0x91,0xd3,0xf2,0xff,0x92,0xd3,0xf2,0xff,0x94,0xd5,0xf1,0xff,0x95,0xd5,0xf2,0xff,0x96,0xd5,0xf6,0xff,0x8f,0xd4,0xf5,0xff,0x83,0xd2,0xf3,0xff,0x85,0xd4,0xf5,0xff,0x88,0xd3,0xf5,0xff,0x8a,0xd4,0xf5,0xff,0x8e,0xd5,0xf5,0xff,0x8e,0xd4,0xf4,0xff,0x8f,0xd3,0xf3,0xff,0x90,0xd3,0xf3,0xff,0x90,0xd4,0xf4,0xff,0x8e,0xd4,0xf4,0xff,0x8c,0xd3,0xf3,0xff,0x8b,0xd2,0xf4,0xff,0x8b,0xd2,0xf3,0xff,0x89,0xd2,0xf1,0xff,0x8a,0xd1,0xf2,0xff,0x8a,0xd0,0xf3,0xff,0x89,0xd1,0xf4,0xff,0x86,0xcd,0xf2,0xff,0x60,0xa0,0xc7,0xff,0x6d,0xaf,0xd5,0xff,0x72,0xb6,0xdc,0xff,0x7a,0xbc,0xe1,0xff,0x71,0xad,0xcf,0xff,0x8e,0xc1,0xde,0xff,0xad,0xd7,0xee,0xff,0xb5,0xda,0xec,0xff,0xbc,0xda,0xeb,0xff,0xc2,0xdb,0xec,0xff,0xc5,0xdc,0xe9,0xff,0xc7,0xdc,0xe8,0xff,0xc6,0xda,0xe8,0xff,0xc1,0xd8,0xe6,0xff,0xbc,0xd6,0xe5,0xff,0xb2,0xd5,0xe4,0xff,0xa3,0xcc,0xe6,0xff,0x89,0xc4,0xe2,0xff,0x55,0xb6,0xe0,0xff,0x1e,0xa3,0xda,0xff,0x15,0x95,0xd9,0xff,0x17,0x88,0xda,0xff,0x14,0x7f,0xd5,0xff,0x14,0x78,0xd1,0xff,0x13,0x6d,0xcb,0xff,0x11,0x61,0xc5,0xff,0x0e,0x5c,0xc4,0xff,0x2d,0x82,0xd5,0xff,0xe5,0xf1,0xfb,0x43,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xad,0xc0,0xdf,0x9b,0x51,0x7b,0xbf,0xff,0x57,0x84,0xcc,0xff,0x5a,0x89,0xd4,0xff,0x5a,0x8f,0xdc,0xff,0x5c,0x95,0xe3,0xff,0x5c,0x9b,0xe6,0xff,0x5c,0xb4,0xf1,0xff,0x79,0xd0,0xf5,0xff,0xa6,0xdb,0xee,0xff,0xc8,0xe5,0xf1,0xff,0xd3,0xe7,0xf2,0xff,0xda,0xe9,0xf3,0xff,0xcd,0xde,0xe9,0xff,0xca,0xdb,0xe9,0xff,0xc9,0xdb,0xe8,0xff,0xce,0xe1,0xec,0xff,0xd1,0xe7,0xf5,0xff,0xbc,0xe0,0xf1,0xff,0x9b,0xd8,0xf1,0xff,0x64,0xc2,0xf1,0xff,0x50,0xa4,0xeb,0xff,0x56,0x9c,0xe9,0xff,0x53,0x92,0xe0,0xff,0x53,0x83,0xd2,0xff,0x55,0x85,0xd8,0xff,0x55,0x86,0xd6,0xff,0x4f,0x72,0xb5,0xff,0x53,0x72,0xab,0xff,0x53,0x72,0xa9,0xff,0x54,0x71,0xa9,0xff,0x55,0x70,0xa8,0xff,0x52,0x70,0xa8,0xff,0x50,0x70,0xa8,0xff,0x52,0x6e,0xa0,0xff,0x4d,0x6b,0x9e,0xff,0x5f,0xa0,0xd6,0xff,0x8e,0xdf,0xf9,0xff,0xaa,0xe0,0xf7,0xff,0xa3,0xdd,0xf6,0xff,0x96,0xd9,0xf7,0xff,0x87,0xd6,0xf5,0xff,0x6e,0xcf,0xf6,0xff,0x5b,0xc8,0xf7,0xff,0x58,0xc3,0xf7,0xff,0x58,0xbe,0xf6,0xff,0x56,0xb8,0xf6,0xff,0x57,0xb3,0xf5,0xff,0x57,0xaf,0xf5,0xff,0x55,0xab,0xf4,0xff,0x54,0xa8,0xf3,0xff,0x54,0xa6,0xf2,0xff,0x56,0xa4,0xf2,0xff,0x54,0xa4,0xf0,0xff,0x54,0xa5,0xf1,0xff,0x52,0xa9,0xf4,0xff,0x53,0xae,0xf4,0xff,0x53,0xb9,0xf5,0xff,0x54,0xbe,0xf7,0xff,0x54,0xbf,0xf7,0xff,0x53,0xc1,0xf7,0xff,0x53,0xc2,0xf7,0xff,0x53,0xc4,0xf6,0xff,0x54,0xc7,0xf7,0xff,0x55,0xc8,0xf5,0xff,0x58,0xc9,0xf7,0xff,0x5f,0xcb,0xf6,0xff,0x6b,0xce,0xf7,0xff,0x76,0xcf,0xf7,0xff,0x7e,0xd0,0xf6,0xff,0x87,0xd6,0xf9,0xff,0x7d,0xc5,0xea,0xff,0x62,0xa9,0xce,0xff,0x71,0xb6,0xdc,0xff,0x7e,0xbf,0xe4,0xff,0x74,0xb2,0xd4,0xff,0x5f,0x9c,0xbc,0xff,0x68,0xa1,0xc4,0xff,0x74,0xb0,0xd6,0xff,0x8c,0xc6,0xe8,0xff,0xa1,0xda,0xf7,0xff,0x9c,0xd4,0xf2,0xff,0x9c,0xd5,0xf2,0xff,0x99,0xd4,0xf0,0xff,0x96,0xd0,0xed,0xff,0x97,0xd3,0xef,0xff,0x99,0xd7,0xf3,0xff,0x96,0xd5,0xf3,0xff,0x95,0xd4,0xf2,0xff,0x93,0xd3,0xf2,0xff,0x94,0xd3,0xf1,0xff,0x93,0xd4,0xf0,0xff,0x97,0xd5,0xf1,0xff,0x99,0xd5,0xf2,0xff,0x9a,0xd5,0xf5,0xff,0x92,0xd4,0xf3,0xff,0x85,0xd2,0xf0,0xff,0x88,0xd4,0xf3,0xff,0x8b,0xd5,0xf5,0xff,0x8d,0xd5,0xf5,0xff,0x8d,0xd3,0xf5,0xff,0x90,0xd4,0xf4,0xff,0x90,0xd4,0xf4,0xff,0x8d,0xd4,0xf3,0xff,0x8d,0xd3,0xf2,0xff,0x8c,0xd1,0xf2,0xff,0x8a,0xd1,0xf1,0xff,0x8b,0xd2,0xf1,0xff,0x8a,0xd2,0xf2,0xff,0x89,0xd0,0xf2,0xff,0x8b,0xd0,0xf2,0xff,0x8a,0xcf,0xf2,0xff,0x89,0xd2,0xf4,0xff,0x7b,0xc2,0xe7,0xff,0x59,0x93,0xb6,0xff,0x64,0x9f,0xc3,0xff,0x6d,0xad,0xd0,0xff,0x65,0xa3,0xc6,0xff,0x61,0x9d,0xc0,0xff,0x71,0xa5,0xc9,0xff,0xa3,0xd1,0xef,0xff,0xae,0xd7,0xee,0xff,0xbb,0xd8,0xe8,0xff,0xc3,0xd8,0xe8,0xff,0xc8,0xdb,0xe8,0xff,0xc7,0xda,0xe7,0xff,0xc9,0xdb,0xe7,0xff,0xc6,0xda,0xe5,0xff,0xc2,0xd9,0xe4,0xff,0xbd,0xd7,0xe5,0xff,0xad,0xcf,0xe2,0xff,0x96,0xc6,0xde,0xff,0x6d,0xb9,0xdd,0xff,0x2c,0xa6,0xd7,0xff,0x16,0x9a,0xd4,0xff,0x18,0x92,0xd5,0xff,0x15,0x89,0xd3,0xff,0x15,0x7d,0xcd,0xff,0x15,0x75,0xc9,0xff,0x14,0x73,0xc8,0xff,0x0b,0x6b,0xc6,0xff,0x3f,0x88,0xd1,0xec,0xf6,0xf9,0xfd,0x10,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xc1,0xcf,0xe8,0x97,0x57,0x82,0xc4,0xff,0x5a,0x88,0xcd,0xff,0x5d,0x8c,0xd5,0xff,0x5a,0x90,0xdb,0xff,0x5c,0x95,0xe2,0xff,0x5e,0x9c,0xe7,0xff,0x5c,0xb4,0xef,0xff,0x87,0xd2,0xf4,0xff,0xbc,0xe0,0xf0,0xff,0xcd,0xe4,0xf0,0xff,0xd3,0xe7,0xf1,0xff,0xd6,0xe7,0xf2,0xff,0xc9,0xdb,0xe7,0xff,0xc6,0xd9,0xe7,0xff,0xc5,0xd8,0xe6,0xff,0xce,0xe3,0xf0,0xff,0xc7,0xe5,0xf3,0xff,0xa9,0xdb,0xf0,0xff,0x73,0xcc,0xf0,0xff,0x5c,0xb7,0xef,0xff,0x71,0xc0,0xf2,0xff,0x88,0xc9,0xf2,0xff,0x8d,0xc8,0xf0,0xff,0x8c,0xc7,0xed,0xff,0x8a,0xc9,0xec,0xff,0x86,0xc9,0xec,0xff,0x80,0xbf,0xe3,0xff,0x7c,0xba,0xe0,0xff,0x6d,0xab,0xd8,0xff,0x6e,0xa9,0xd8,0xff,0x73,0xa9,0xd7,0xff,0x76,0xaa,0xda,0xff,0x78,0xb6,0xe1,0xff,0x86,0xbb,0xdc,0xff,0x7c,0xa0,0xc8,0xff,0x7e,0xb7,0xe1,0xff,0xb6,0xe8,0xf8,0xff,0xab,0xdf,0xf5,0xff,0xa4,0xdc,0xf6,0xff,0x96,0xd8,0xf6,0xff,0x84,0xd4,0xf5,0xff,0x69,0xcd,0xf5,0xff,0x5c,0xc7,0xf7,0xff,0x5a,0xc2,0xf7,0xff,0x5c,0xbd,0xf7,0xff,0x5d,0xb7,0xf6,0xff,0x5c,0xb3,0xf4,0xff,0x5c,0xaf,0xf4,0xff,0x5a,0xab,0xf3,0xff,0x59,0xa8,0xf2,0xff,0x59,0xa5,0xf2,0xff,0x5a,0xa3,0xf0,0xff,0x5a,0xa2,0xee,0xff,0x5a,0xa3,0xef,0xff,0x59,0xa6,0xf2,0xff,0x5a,0xaf,0xf4,0xff,0x59,0xba,0xf5,0xff,0x58,0xbf,0xf6,0xff,0x58,0xc1,0xf7,0xff,0x58,0xc3,0xf7,0xff,0x59,0xc4,0xf7,0xff,0x58,0xc6,0xf7,0xff,0x5b,0xc8,0xf7,0xff,0x5c,0xc9,0xf5,0xff,0x5e,0xca,0xf7,0xff,0x68,0xcc,0xf6,0xff,0x74,0xcd,0xf6,0xff,0x7a,0xcf,0xf6,0xff,0x80,0xd1,0xf6,0xff,0x8c,0xd8,0xfa,0xff,0x68,0xae,0xd4,0xff,0x50,0x95,0xbc,0xff,0x6a,0xac,0xd3,0xff,0x5c,0x9b,0xc0,0xff,0x63,0xa0,0xc2,0xff,0x62,0x9d,0xbf,0xff,0x65,0x9d,0xc0,0xff,0x70,0xad,0xd3,0xff,0x7f,0xba,0xde,0xff,0x9d,0xd8,0xf6,0xff,0x9b,0xd4,0xf1,0xff,0x9a,0xd3,0xf1,0xff,0x96,0xd1,0xef,0xff,0x90,0xcc,0xea,0xff,0x95,0xd1,0xed,0xff,0x99,0xd7,0xf2,0xff,0x97,0xd5,0xf3,0xff,0x96,0xd5,0xf2,0xff,0x96,0xd4,0xf2,0xff,0x95,0xd4,0xf1,0xff,0x94,0xd4,0xef,0xff,0x98,0xd5,0xf0,0xff,0x9c,0xd7,0xf3,0xff,0x9f,0xd7,0xf6,0xff,0x96,0xd5,0xf3,0xff,0x88,0xd2,0xf1,0xff,0x8a,0xd3,0xf3,0xff,0x8d,0xd4,0xf3,0xff,0x8e,0xd4,0xf3,0xff,0x8f,0xd3,0xf4,0xff,0x91,0xd4,0xf4,0xff,0x90,0xd4,0xf4,0xff,0x8d,0xd3,0xf3,0xff,0x8c,0xd0,0xf2,0xff,0x87,0xcf,0xf2,0xff,0x87,0xcf,0xf0,0xff,0x89,0xd1,0xf0,0xff,0x86,0xce,0xf0,0xff,0x82,0xcb,0xee,0xff,0x84,0xcd,0xef,0xff,0x83,0xcd,0xef,0xff,0x86,0xd1,0xf2,0xff,0x71,0xb7,0xdb,0xff,0x54,0x8e,0xaf,0xff,0x62,0x98,0xbc,0xff,0x65,0x9b,0xbd,0xff,0x59,0x8d,0xae,0xff,0x59,0x91,0xb3,0xff,0x6a,0xa5,0xc9,0xff,0x91,0xc9,0xec,0xff,0xa8,0xd3,0xec,0xff,0xb7,0xd5,0xe6,0xff,0xc2,0xd8,0xe6,0xff,0xc6,0xd9,0xe6,0xff,0xc6,0xd9,0xe5,0xff,0xc7,0xd9,0xe4,0xff,0xc6,0xd7,0xe3,0xff,0xc4,0xd5,0xe3,0xff,0xc2,0xd3,0xe3,0xff,0xb3,0xce,0xe1,0xff,0x9d,0xc4,0xdc,0xff,0x73,0xb7,0xda,0xff,0x33,0xa5,0xd5,0xff,0x19,0x9c,0xce,0xff,0x19,0x97,0xd1,0xff,0x1a,0x8d,0xd0,0xff,0x18,0x80,0xc9,0xff,0x16,0x78,0xc6,0xff,0x16,0x7d,0xc7,0xff,0x0d,0x80,0xca,0xff,0x57,0x9b,0xd3,0xea,0xfd,0xfc,0xfe,0x0d,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xd5,0xe0,0xf0,0x72,0x5c,0x89,0xc9,0xff,0x5a,0x87,0xcc,0xff,0x5e,0x8d,0xd5,0xff,0x5d,0x91,0xdc,0xff,0x5e,0x97,0xe2,0xff,0x5d,0x9f,0xe7,0xff,0x5d,0xb3,0xec,0xff,0x88,0xd0,0xf2,0xff,0xbc,0xde,0xed,0xff,0xc9,0xe1,0xee,0xff,0xd0,0xe4,0xee,0xff,0xd0,0xe2,0xee,0xff,0xc1,0xd4,0xe2,0xff,0xbf,0xd3,0xe2,0xff,0xc0,0xd9,0xe7,0xff,0xca,0xe4,0xf2,0xff,0xbb,0xde,0xf0,0xff,0x89,0xd2,0xf1,0xff,0x5f,0xb4,0xee,0xff,0x5e,0x9c,0xe7,0xff,0x62,0x9e,0xe4,0xff,0x6d,0xa5,0xe0,0xff,0x72,0xa0,0xd9,0xff,0x6d,0x9e,0xd3,0xff,0x6e,0xa3,0xd7,0xff,0x72,0xac,0xdf,0xff,0x6e,0xa5,0xd9,0xff,0x6b,0x95,0xc7,0xff,0x6f,0x9c,0xca,0xff,0x6a,0x9c,0xcd,0xff,0x74,0xa2,0xd3,0xff,0x75,0xa5,0xd2,0xff,0x77,0xb7,0xe7,0xff,0x89,0xbe,0xe9,0xff,0x7e,0xae,0xdb,0xff,0x82,0xc1,0xeb,0xff,0xb6,0xe6,0xf6,0xff,0xac,0xdd,0xf4,0xff,0xa2,0xdc,0xf3,0xff,0x96,0xd7,0xf5,0xff,0x82,0xd2,0xf6,0xff,0x69,0xcc,0xf5,0xff,0x60,0xc5,0xf5,0xff,0x5f,0xbf,0xf6,0xff,0x5f,0xbb,0xf6,0xff,0x5f,0xb7,0xf5,0xff,0x5f,0xb2,0xf3,0xff,0x5f,0xaf,0xf4,0xff,0x5e,0xab,0xf1,0xff,0x5e,0xa7,0xf0,0xff,0x5f,0xa5,0xf0,0xff,0x5e,0xa4,0xf0,0xff,0x5f,0xa4,0xef,0xff,0x60,0xa5,0xef,0xff,0x5d,0xa8,0xf2,0xff,0x5d,0xb2,0xf5,0xff,0x5c,0xbc,0xf5,0xff,0x5b,0xc0,0xf5,0xff,0x5d,0xc1,0xf7,0xff,0x5d,0xc4,0xf7,0xff,0x5c,0xc7,0xf7,0xff,0x5e,0xc8,0xf7,0xff,0x60,0xca,0xf6,0xff,0x61,0xcb,0xf5,0xff,0x64,0xcc,0xf6,0xff,0x6d,0xcd,0xf6,0xff,0x79,0xce,0xf5,0xff,0x7f,0xcf,0xf5,0xff,0x83,0xd1,0xf5,0xff,0x8e,0xd7,0xf8,0xff,0x7c,0xc0,0xe4,0xff,0x50,0x92,0xb9,0xff,0x60,0xa0,0xc6,0xff,0x5a,0x96,0xbb,0xff,0x5a,0x94,0xb6,0xff,0x64,0x9d,0xc0,0xff,0x5e,0x97,0xbb,0xff,0x69,0xa3,0xca,0xff,0x75,0xb1,0xd5,0xff,0x96,0xd2,0xf1,0xff,0x99,0xd4,0xf1,0xff,0x91,0xcb,0xea,0xff,0x8c,0xc8,0xe7,0xff,0x8c,0xc8,0xe8,0xff,0x94,0xd1,0xec,0xff,0x9b,0xd6,0xf2,0xff,0x99,0xd4,0xf1,0xff,0x99,0xd5,0xf0,0xff,0x99,0xd5,0xf1,0xff,0x99,0xd5,0xf1,0xff,0x9d,0xda,0xf4,0xff,0xa4,0xdf,0xf9,0xff,0x9d,0xd6,0xf2,0xff,0x9a,0xd1,0xef,0xff,0x93,0xd1,0xef,0xff,0x8a,0xd2,0xf1,0xff,0x8d,0xd3,0xf3,0xff,0x96,0xd4,0xf3,0xff,0x95,0xd5,0xf3,0xff,0x90,0xd3,0xf2,0xff,0x8d,0xd1,0xef,0xff,0x8a,0xcd,0xee,0xff,0x89,0xcd,0xee,0xff,0x93,0xd2,0xef,0xff,0xa5,0xd9,0xf0,0xff,0xa5,0xd9,0xf1,0xff,0xa8,0xda,0xf1,0xff,0xa6,0xd5,0xec,0xff,0xa0,0xcf,0xe9,0xff,0xa6,0xd6,0xef,0xff,0xa1,0xd5,0xf0,0xff,0x9b,0xd3,0xf1,0xff,0x90,0xca,0xeb,0xff,0x62,0x96,0xb8,0xff,0x5d,0x8f,0xb2,0xff,0x62,0x92,0xb3,0xff,0x59,0x8a,0xab,0xff,0x53,0x88,0xa8,0xff,0x61,0x9b,0xbe,0xff,0x81,0xbd,0xe2,0xff,0x9f,0xcd,0xea,0xff,0xb3,0xd4,0xe7,0xff,0xc0,0xd6,0xe4,0xff,0xc3,0xd7,0xe3,0xff,0xc5,0xd6,0xe2,0xff,0xc6,0xd6,0xe1,0xff,0xc3,0xd3,0xe0,0xff,0xc0,0xd1,0xde,0xff,0xbd,0xd0,0xdd,0xff,0xb2,0xcb,0xdc,0xff,0xa0,0xc1,0xd8,0xff,0x74,0xb4,0xd5,0xff,0x39,0xa3,0xce,0xff,0x1c,0x99,0xc8,0xff,0x1b,0x92,0xca,0xff,0x1a,0x8c,0xc7,0xff,0x17,0x82,0xc2,0xff,0x16,0x77,0xc2,0xff,0x14,0x75,0xc0,0xff,0x11,0x7f,0xc7,0xff,0x7d,0xbb,0xe2,0xca,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xec,0xf2,0xfa,0x38,0x72,0xa5,0xdf,0xff,0x5d,0x9a,0xdc,0xff,0x5d,0x9a,0xdb,0xff,0x5f,0x94,0xdb,0xff,0x63,0x9b,0xe2,0xff,0x60,0xa4,0xe5,0xff,0x5d,0xb3,0xe9,0xff,0x87,0xcd,0xef,0xff,0xb9,0xdd,0xef,0xff,0xc4,0xdf,0xec,0xff,0xcb,0xe0,0xec,0xff,0xcc,0xe1,0xed,0xff,0xc1,0xd7,0xe4,0xff,0xb9,0xcf,0xde,0xff,0xc2,0xdc,0xe9,0xff,0xc0,0xe1,0xef,0xff,0x9c,0xd5,0xee,0xff,0x69,0xb9,0xeb,0xff,0x5c,0x9d,0xe7,0xff,0x5e,0x8e,0xd6,0xff,0x5f,0x87,0xcd,0xff,0x5f,0x85,0xca,0xff,0x59,0x82,0xba,0xff,0x56,0x7c,0xb0,0xff,0x5e,0x7f,0xc0,0xff,0x5e,0x81,0xc7,0xff,0x5e,0x86,0xc9,0xff,0x5f,0x7e,0xb4,0xff,0x60,0x7f,0xb3,0xff,0x5f,0x7f,0xb0,0xff,0x61,0x81,0xb8,0xff,0x62,0x80,0xb7,0xff,0x62,0x86,0xc1,0xff,0x5c,0x7f,0xbe,0xff,0x5c,0x79,0xb1,0xff,0x92,0xc6,0xf2,0xff,0xb4,0xe5,0xf6,0xff,0xac,0xdc,0xf5,0xff,0xa0,0xda,0xf3,0xff,0x8f,0xd5,0xf4,0xff,0x7b,0xcf,0xf4,0xff,0x67,0xc9,0xf4,0xff,0x65,0xc3,0xf5,0xff,0x64,0xbe,0xf4,0xff,0x64,0xba,0xf3,0xff,0x64,0xb5,0xf2,0xff,0x64,0xb3,0xf2,0xff,0x66,0xb0,0xf2,0xff,0x63,0xab,0xf0,0xff,0x63,0xa9,0xee,0xff,0x63,0xa8,0xef,0xff,0x62,0xa6,0xef,0xff,0x63,0xa6,0xee,0xff,0x64,0xa8,0xef,0xff,0x62,0xac,0xf1,0xff,0x64,0xb6,0xf5,0xff,0x62,0xbf,0xf3,0xff,0x63,0xc2,0xf5,0xff,0x63,0xc3,0xf6,0xff,0x62,0xc6,0xf5,0xff,0x61,0xc8,0xf5,0xff,0x63,0xca,0xf6,0xff,0x64,0xcb,0xf5,0xff,0x66,0xcd,0xf4,0xff,0x6a,0xce,0xf5,0xff,0x71,0xcf,0xf5,0xff,0x79,0xd0,0xf5,0xff,0x82,0xd2,0xf4,0xff,0x89,0xd3,0xf5,0xff,0x8f,0xd4,0xf4,0xff,0x95,0xd7,0xf8,0xff,0x90,0xd1,0xf2,0xff,0x71,0xb4,0xd5,0xff,0x66,0xa3,0xc7,0xff,0x53,0x8a,0xa9,0xff,0x5d,0x93,0xb4,0xff,0x61,0x98,0xbc,0xff,0x66,0x9e,0xc5,0xff,0x70,0xab,0xcf,0xff,0x91,0xcc,0xed,0xff,0x98,0xd2,0xef,0xff,0x8c,0xc7,0xe6,0xff,0x8a,0xc5,0xe5,0xff,0x8a,0xc4,0xe4,0xff,0x94,0xcf,0xea,0xff,0x9d,0xd6,0xf1,0xff,0x9c,0xd4,0xf0,0xff,0x9b,0xd6,0xee,0xff,0x9b,0xd5,0xf0,0xff,0x9f,0xd8,0xf3,0xff,0x9e,0xd7,0xf1,0xff,0x95,0xd0,0xec,0xff,0x91,0xc9,0xe7,0xff,0x90,0xc5,0xe5,0xff,0x8d,0xc7,0xe7,0xff,0x8a,0xce,0xee,0xff,0x91,0xd4,0xf2,0xff,0x98,0xd5,0xf3,0xff,0x98,0xd5,0xf3,0xff,0x8a,0xcb,0xe9,0xff,0x88,0xc8,0xe6,0xff,0x85,0xc5,0xe4,0xff,0x83,0xc5,0xe4,0xff,0x8d,0xc8,0xe7,0xff,0xa8,0xd7,0xed,0xff,0xa5,0xd6,0xee,0xff,0xa0,0xcc,0xe7,0xff,0x9d,0xca,0xe5,0xff,0x9c,0xca,0xe4,0xff,0xa5,0xd3,0xeb,0xff,0xa3,0xd4,0xee,0xff,0x9b,0xd2,0xed,0xff,0x9d,0xd5,0xf1,0xff,0x6f,0xa3,0xc2,0xff,0x4c,0x80,0x9f,0xff,0x56,0x87,0xa6,0xff,0x54,0x85,0xa3,0xff,0x51,0x83,0xa1,0xff,0x56,0x8a,0xaa,0xff,0x6f,0xac,0xd1,0xff,0x8f,0xc5,0xe6,0xff,0xac,0xd2,0xe9,0xff,0xbb,0xd3,0xe3,0xff,0xc1,0xd5,0xe1,0xff,0xc2,0xd2,0xdf,0xff,0xc0,0xd0,0xde,0xff,0xbf,0xcf,0xdc,0xff,0xbc,0xcc,0xd9,0xff,0xb7,0xc8,0xd5,0xff,0xb0,0xc6,0xd3,0xff,0x9c,0xbe,0xcf,0xff,0x72,0xb0,0xcb,0xff,0x42,0xa1,0xc6,0xff,0x26,0x98,0xc2,0xff,0x1d,0x8f,0xc2,0xff,0x17,0x88,0xc0,0xff,0x17,0x84,0xbc,0xff,0x18,0x79,0xbb,0xff,0x14,0x71,0xb9,0xff,0x0e,0x70,0xb8,0xff,0x9d,0xc8,0xe4,0x97,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xf6,0xf8,0xfc,0x2d,0x7b,0xaa,0xdd,0xfd,0x57,0xa0,0xe0,0xff,0x62,0xad,0xe5,0xff,0x60,0x9c,0xdc,0xff,0x63,0x9b,0xdf,0xff,0x61,0xa3,0xe3,0xff,0x5d,0xb1,0xe8,0xff,0x84,0xcc,0xf0,0xff,0xb3,0xda,0xf0,0xff,0xc5,0xde,0xee,0xff,0xcb,0xe0,0xec,0xff,0xcc,0xe2,0xef,0xff,0xc7,0xde,0xec,0xff,0xb2,0xcb,0xda,0xff,0xc1,0xda,0xe8,0xff,0xb0,0xdc,0xef,0xff,0x75,0xc3,0xe8,0xff,0x61,0xaa,0xe6,0xff,0x67,0xa7,0xe5,0xff,0x6d,0xa2,0xd9,0xff,0x75,0xa4,0xd7,0xff,0x72,0xa0,0xd5,0xff,0x7a,0x9f,0xcf,0xff,0x7c,0xa2,0xcd,0xff,0x79,0xa2,0xd4,0xff,0x7a,0xa4,0xd6,0xff,0x7b,0xa2,0xd2,0xff,0x65,0x8b,0xbf,0xff,0x6f,0x9e,0xe2,0xff,0x6b,0x8e,0xc5,0xff,0x6b,0x99,0xd3,0xff,0x74,0xa4,0xe3,0xff,0x65,0x87,0xbe,0xff,0x70,0x93,0xc8,0xff,0x69,0x8e,0xc4,0xff,0x95,0xc8,0xf3,0xff,0xb6,0xe5,0xf6,0xff,0xab,0xdc,0xf4,0xff,0x9f,0xda,0xf4,0xff,0x8b,0xd4,0xf3,0xff,0x76,0xcd,0xf3,0xff,0x66,0xc8,0xf4,0xff,0x68,0xc3,0xf5,0xff,0x67,0xbd,0xf4,0xff,0x68,0xb9,0xf2,0xff,0x6a,0xb4,0xf1,0xff,0x6a,0xb3,0xf2,0xff,0x6a,0xaf,0xf1,0xff,0x68,0xac,0xf0,0xff,0x66,0xa9,0xee,0xff,0x66,0xa9,0xee,0xff,0x66,0xa7,0xed,0xff,0x67,0xa8,0xed,0xff,0x69,0xab,0xef,0xff,0x67,0xaf,0xf2,0xff,0x67,0xba,0xf6,0xff,0x67,0xc2,0xf5,0xff,0x68,0xc4,0xf4,0xff,0x67,0xc6,0xf6,0xff,0x67,0xc8,0xf5,0xff,0x67,0xca,0xf4,0xff,0x66,0xcb,0xf4,0xff,0x69,0xcc,0xf4,0xff,0x6c,0xce,0xf4,0xff,0x70,0xcf,0xf5,0xff,0x76,0xd1,0xf5,0xff,0x7e,0xd2,0xf5,0xff,0x85,0xd4,0xf5,0xff,0x8d,0xd5,0xf5,0xff,0x92,0xd5,0xf3,0xff,0x95,0xd6,0xf4,0xff,0x99,0xd8,0xf7,0xff,0x99,0xd8,0xf8,0xff,0x81,0xbc,0xdf,0xff,0x54,0x89,0xa8,0xff,0x4f,0x82,0xa3,0xff,0x5b,0x8e,0xb0,0xff,0x66,0x9e,0xc2,0xff,0x69,0xa4,0xca,0xff,0x90,0xcb,0xec,0xff,0x9a,0xd4,0xf0,0xff,0x8b,0xc5,0xe4,0xff,0x89,0xc4,0xe4,0xff,0x88,0xc2,0xe2,0xff,0x95,0xcd,0xea,0xff,0xa0,0xd6,0xf1,0xff,0x9f,0xd5,0xf0,0xff,0x9e,0xd5,0xef,0xff,0x9f,0xd6,0xf1,0xff,0x9d,0xd4,0xf1,0xff,0x91,0xc7,0xe7,0xff,0x89,0xc0,0xe1,0xff,0x8e,0xc6,0xe4,0xff,0x8e,0xc5,0xe3,0xff,0x89,0xc3,0xe3,0xff,0x8e,0xce,0xed,0xff,0x95,0xd4,0xf2,0xff,0x97,0xd4,0xf1,0xff,0x95,0xd3,0xef,0xff,0x8c,0xc7,0xe6,0xff,0x8c,0xc7,0xe6,0xff,0x8c,0xc6,0xe6,0xff,0x89,0xc5,0xe4,0xff,0x86,0xc8,0xe8,0xff,0x89,0xcf,0xef,0xff,0x84,0xca,0xe9,0xff,0x75,0xbe,0xe1,0xff,0x74,0xbd,0xe2,0xff,0x70,0xba,0xde,0xff,0x7c,0xc5,0xe6,0xff,0x84,0xca,0xea,0xff,0x86,0xc9,0xea,0xff,0x8d,0xce,0xed,0xff,0x79,0xb7,0xd4,0xff,0x49,0x7e,0x9d,0xff,0x4d,0x7c,0x9a,0xff,0x4f,0x7e,0x9b,0xff,0x4e,0x7c,0x99,0xff,0x4d,0x7e,0x9c,0xff,0x63,0x9c,0xc4,0xff,0x7b,0xb4,0xdb,0xff,0xa1,0xcb,0xe5,0xff,0xb2,0xcd,0xdf,0xff,0xba,0xce,0xdd,0xff,0xbc,0xcc,0xdb,0xff,0xba,0xcb,0xd9,0xff,0xb9,0xc9,0xd7,0xff,0xb5,0xc5,0xd2,0xff,0xb0,0xc0,0xcc,0xff,0xac,0xbf,0xcc,0xff,0xa0,0xba,0xc8,0xff,0x7a,0xaa,0xc5,0xff,0x50,0x9d,0xc1,0xff,0x38,0x98,0xbe,0xff,0x22,0x8f,0xbe,0xff,0x19,0x88,0xbb,0xff,0x1a,0x86,0xba,0xff,0x18,0x81,0xb7,0xff,0x15,0x79,0xb4,0xff,0x1b,0x78,0xb9,0xff,0xbb,0xd6,0xea,0x87,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0x94,0xbd,0xe5,0xd2,0x56,0xa1,0xd9,0xff,0x63,0xae,0xe5,0xff,0x64,0xa1,0xe2,0xff,0x62,0x9d,0xde,0xff,0x63,0xa3,0xe2,0xff,0x62,0xb0,0xe9,0xff,0x7a,0xca,0xf0,0xff,0x9e,0xd5,0xef,0xff,0xc2,0xdf,0xf0,0xff,0xc9,0xdf,0xea,0xff,0xc7,0xde,0xec,0xff,0xc4,0xdc,0xeb,0xff,0xb1,0xc9,0xd9,0xff,0xb3,0xd3,0xe6,0xff,0x8c,0xd0,0xee,0xff,0x67,0xb2,0xe5,0xff,0x66,0xa5,0xe5,0xff,0x6b,0xa8,0xe1,0xff,0x77,0xb1,0xdc,0xff,0x80,0xb9,0xe1,0xff,0x87,0xc7,0xec,0xff,0xbf,0xe8,0xf8,0xff,0xce,0xee,0xf6,0xff,0xa2,0xda,0xf3,0xff,0xa2,0xd7,0xf4,0xff,0xab,0xd8,0xef,0xff,0x73,0xa4,0xcf,0xff,0x71,0x9d,0xdc,0xff,0x6c,0x8d,0xc0,0xff,0x7b,0xa6,0xd5,0xff,0x7a,0xa2,0xda,0xff,0x74,0x99,0xc8,0xff,0xb1,0xdb,0xf3,0xff,0x91,0xc1,0xe8,0xff,0x90,0xc8,0xf0,0xff,0xb6,0xe3,0xf8,0xff,0xa9,0xdc,0xf2,0xff,0x9d,0xd7,0xf4,0xff,0x86,0xd3,0xf3,0xff,0x74,0xcc,0xf2,0xff,0x6b,0xc6,0xf4,0xff,0x6d,0xbf,0xf4,0xff,0x6c,0xba,0xf3,0xff,0x6c,0xb7,0xf2,0xff,0x6c,0xb5,0xf1,0xff,0x6e,0xb3,0xf1,0xff,0x6d,0xb0,0xf0,0xff,0x6e,0xae,0xf0,0xff,0x6c,0xac,0xee,0xff,0x6b,0xab,0xee,0xff,0x6a,0xaa,0xed,0xff,0x6b,0xab,0xed,0xff,0x6f,0xb0,0xf1,0xff,0x68,0xae,0xf0,0xff,0x63,0xb4,0xf0,0xff,0x6b,0xc5,0xf6,0xff,0x6b,0xc5,0xf5,0xff,0x6d,0xc7,0xf7,0xff,0x6d,0xc9,0xf6,0xff,0x6c,0xcb,0xf5,0xff,0x6c,0xcc,0xf3,0xff,0x6e,0xcd,0xf4,0xff,0x71,0xcf,0xf3,0xff,0x76,0xd0,0xf5,0xff,0x7b,0xd1,0xf5,0xff,0x87,0xd3,0xf5,0xff,0x8e,0xd5,0xf5,0xff,0x91,0xd5,0xf4,0xff,0x93,0xd5,0xf2,0xff,0x97,0xd6,0xf3,0xff,0x99,0xd5,0xf3,0xff,0x9c,0xd7,0xf5,0xff,0x9d,0xd5,0xf5,0xff,0x64,0x9a,0xba,0xff,0x49,0x7b,0x9b,0xff,0x50,0x7f,0xa1,0xff,0x5b,0x91,0xb5,0xff,0x68,0xa3,0xc9,0xff,0x7e,0xbb,0xdd,0xff,0x9d,0xd4,0xf0,0xff,0x8e,0xc6,0xe5,0xff,0x8a,0xc3,0xe4,0xff,0x89,0xc2,0xe2,0xff,0x96,0xcc,0xea,0xff,0xa1,0xd6,0xf2,0xff,0xa1,0xd5,0xf1,0xff,0xa1,0xd5,0xf1,0xff,0xa1,0xd6,0xf1,0xff,0xa1,0xd6,0xf1,0xff,0x96,0xca,0xe9,0xff,0x8b,0xc0,0xe1,0xff,0x90,0xc5,0xe5,0xff,0x91,0xc7,0xe5,0xff,0x8a,0xc3,0xe2,0xff,0x95,0xcf,0xed,0xff,0x98,0xd4,0xf0,0xff,0x9c,0xd6,0xf1,0xff,0x92,0xce,0xea,0xff,0x8b,0xc4,0xe2,0xff,0x90,0xc5,0xe5,0xff,0x8c,0xc2,0xe0,0xff,0x91,0xc4,0xe0,0xff,0x9d,0xd1,0xec,0xff,0xa0,0xd5,0xed,0xff,0x94,0xcd,0xea,0xff,0x88,0xc2,0xe4,0xff,0x85,0xc1,0xe0,0xff,0x7d,0xba,0xda,0xff,0x85,0xc3,0xe4,0xff,0x8d,0xca,0xea,0xff,0x8f,0xca,0xe9,0xff,0x8d,0xcb,0xe8,0xff,0x91,0xd1,0xee,0xff,0x74,0xaa,0xc8,0xff,0x44,0x72,0x8f,0xff,0x46,0x73,0x8f,0xff,0x49,0x76,0x8f,0xff,0x49,0x75,0x92,0xff,0x66,0x99,0xc2,0xff,0x76,0xb3,0xda,0xff,0x8f,0xc5,0xdf,0xff,0xa5,0xca,0xdc,0xff,0xb4,0xc9,0xda,0xff,0xb6,0xc7,0xd6,0xff,0xb2,0xc4,0xd2,0xff,0xb0,0xc1,0xcf,0xff,0xab,0xbc,0xc7,0xff,0xa6,0xb7,0xc1,0xff,0xa6,0xb7,0xc3,0xff,0xa0,0xb4,0xc0,0xff,0x7c,0xa4,0xbe,0xff,0x56,0x97,0xba,0xff,0x44,0x96,0xba,0xff,0x2a,0x8e,0xbb,0xff,0x1c,0x8a,0xb7,0xff,0x1a,0x87,0xb5,0xff,0x28,0x88,0xb3,0xff,0x2c,0x8b,0xb4,0xff,0x35,0x90,0xbe,0xff,0xdc,0xea,0xf3,0x3d,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xb4,0xd9,0xf0,0xb8,0x62,0xb7,0xe0,0xff,0x73,0xc1,0xe7,0xff,0x74,0xb6,0xe9,0xff,0x64,0xa1,0xdb,0xff,0x69,0xa6,0xe3,0xff,0x6f,0xb2,0xe9,0xff,0x6d,0xbf,0xe9,0xff,0x85,0xc8,0xe7,0xff,0xb8,0xd5,0xe7,0xff,0xc0,0xd7,0xe5,0xff,0xbf,0xd8,0xe6,0xff,0xc5,0xdc,0xed,0xff,0xb5,0xce,0xe1,0xff,0x91,0xc6,0xe0,0xff,0x74,0xbd,0xec,0xff,0x6a,0xa5,0xe3,0xff,0x6b,0x97,0xd3,0xff,0x69,0x8e,0xc2,0xff,0x69,0x8a,0xb5,0xff,0x69,0x89,0xbc,0xff,0x75,0xa6,0xe1,0xff,0x83,0xae,0xd8,0xff,0x8c,0xa9,0xd3,0xff,0x7a,0xb5,0xe9,0xff,0x6b,0xb2,0xe3,0xff,0x6a,0x8f,0xc0,0xff,0x71,0x94,0xc8,0xff,0x73,0x9f,0xdd,0xff,0x72,0x96,0xc9,0xff,0x75,0x9d,0xd2,0xff,0x7d,0xad,0xe5,0xff,0x81,0xa2,0xd3,0xff,0x81,0xa0,0xd3,0xff,0x77,0x9d,0xcd,0xff,0x98,0xcd,0xf0,0xff,0xb4,0xe2,0xf6,0xff,0xa3,0xdb,0xf1,0xff,0x95,0xd7,0xf3,0xff,0x80,0xd1,0xf3,0xff,0x74,0xcb,0xf3,0xff,0x70,0xc5,0xf3,0xff,0x73,0xbf,0xf2,0xff,0x72,0xba,0xf1,0xff,0x72,0xb7,0xf0,0xff,0x70,0xb4,0xef,0xff,0x70,0xb2,0xee,0xff,0x71,0xb0,0xed,0xff,0x70,0xaf,0xed,0xff,0x70,0xae,0xec,0xff,0x70,0xac,0xec,0xff,0x70,0xac,0xed,0xff,0x71,0xae,0xed,0xff,0x74,0xb2,0xef,0xff,0x6b,0xb0,0xec,0xff,0x5f,0xad,0xe6,0xff,0x69,0xc0,0xf1,0xff,0x70,0xc8,0xf5,0xff,0x6b,0xc4,0xf0,0xff,0x6d,0xc9,0xf1,0xff,0x67,0xc3,0xeb,0xff,0x70,0xcc,0xf2,0xff,0x75,0xd0,0xf4,0xff,0x78,0xd0,0xf2,0xff,0x7d,0xd1,0xf3,0xff,0x81,0xd2,0xf3,0xff,0x8b,0xd3,0xf2,0xff,0x93,0xd5,0xf2,0xff,0x95,0xd5,0xf1,0xff,0x97,0xd5,0xf1,0xff,0x9a,0xd6,0xf2,0xff,0x9c,0xd5,0xf2,0xff,0x9d,0xd5,0xf2,0xff,0xa2,0xdb,0xf7,0xff,0x89,0xc2,0xdf,0xff,0x4c,0x7e,0x9e,0xff,0x4b,0x78,0x9a,0xff,0x4b,0x7b,0x9e,0xff,0x59,0x90,0xb4,0xff,0x6a,0xa6,0xcb,0xff,0x8d,0xc5,0xe5,0xff,0x9a,0xd3,0xef,0xff,0x8f,0xc8,0xe6,0xff,0x8b,0xc4,0xe2,0xff,0x93,0xca,0xe7,0xff,0xa2,0xd6,0xf2,0xff,0xa2,0xd5,0xef,0xff,0xa3,0xd5,0xef,0xff,0xa3,0xd7,0xf0,0xff,0xa4,0xd8,0xf2,0xff,0x96,0xc9,0xe6,0xff,0x89,0xbe,0xdd,0xff,0x8e,0xc2,0xe0,0xff,0x89,0xbc,0xdb,0xff,0x8e,0xc3,0xe1,0xff,0x99,0xd2,0xee,0xff,0x9f,0xd5,0xef,0xff,0xa4,0xd7,0xf0,0xff,0x8f,0xc5,0xe3,0xff,0x8a,0xc0,0xdf,0xff,0x8c,0xbf,0xde,0xff,0x84,0xb9,0xd5,0xff,0x97,0xc9,0xe2,0xff,0xa9,0xd6,0xed,0xff,0xb8,0xdc,0xeb,0xff,0xb2,0xda,0xeb,0xff,0xac,0xd5,0xed,0xff,0xa8,0xcb,0xe1,0xff,0xa9,0xc7,0xdc,0xff,0xaf,0xd1,0xe3,0xff,0xaa,0xd1,0xe9,0xff,0xa8,0xd3,0xea,0xff,0xa3,0xd0,0xe7,0xff,0x98,0xcc,0xe7,0xff,0x91,0xca,0xe6,0xff,0x70,0xa2,0xbf,0xff,0x4f,0x80,0x9d,0xff,0x4c,0x7a,0x96,0xff,0x49,0x71,0x90,0xff,0x58,0x8a,0xac,0xff,0x6a,0xa5,0xca,0xff,0x84,0xc1,0xe0,0xff,0x92,0xc0,0xd7,0xff,0xa7,0xc2,0xd5,0xff,0xae,0xc1,0xd0,0xff,0xa9,0xbe,0xcc,0xff,0xa6,0xba,0xc7,0xff,0xa2,0xb5,0xc0,0xff,0xa0,0xb2,0xbc,0xff,0xa0,0xb0,0xbd,0xff,0x98,0xab,0xb6,0xff,0x75,0x9e,0xb5,0xff,0x56,0x93,0xb2,0xff,0x48,0x90,0xb1,0xff,0x33,0x8b,0xb3,0xff,0x1e,0x88,0xaf,0xff,0x24,0x87,0xb1,0xff,0x52,0x91,0xb1,0xff,0x36,0x8a,0xab,0xff,0x4c,0x9d,0xc0,0xf9,0xf4,0xf9,0xfb,0x29,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xd1,0xea,0xf5,0x72,0x6c,0xbb,0xdc,0xff,0x69,0xbc,0xdf,0xff,0x6a,0xac,0xe1,0xff,0x67,0xa0,0xdc,0xff,0x6e,0xa8,0xe4,0xff,0x74,0xb0,0xe8,0xff,0x6a,0xbb,0xe7,0xff,0x77,0xbf,0xe1,0xff,0xb3,0xd0,0xe3,0xff,0xbb,0xd3,0xe3,0xff,0xbd,0xd6,0xe6,0xff,0xc6,0xe0,0xed,0xff,0xa9,0xce,0xe4,0xff,0x63,0xb1,0xd8,0xff,0x6f,0xab,0xe6,0xff,0x6f,0x9d,0xd9,0xff,0x70,0x93,0xc8,0xff,0x71,0x90,0xb8,0xff,0x70,0x8e,0xae,0xff,0x6f,0x8f,0xbb,0xff,0x79,0xa8,0xe4,0xff,0x7a,0xa2,0xcc,0xff,0x7d,0x99,0xc1,0xff,0x7b,0xaf,0xe3,0xff,0x77,0xad,0xe0,0xff,0x6d,0x89,0xb7,0xff,0x72,0x97,0xc8,0xff,0x79,0xa8,0xe5,0xff,0x6e,0x95,0xca,0xff,0x76,0xab,0xdd,0xff,0x7b,0xae,0xe3,0xff,0x7c,0x9a,0xc9,0xff,0x75,0x92,0xbb,0xff,0x76,0x93,0xc6,0xff,0x9f,0xd2,0xf3,0xff,0xb2,0xe2,0xf5,0xff,0x9f,0xd8,0xf0,0xff,0x8c,0xd3,0xf1,0xff,0x7c,0xce,0xf2,0xff,0x76,0xc9,0xf3,0xff,0x75,0xc3,0xf2,0xff,0x79,0xbe,0xf0,0xff,0x78,0xb9,0xf0,0xff,0x77,0xb7,0xef,0xff,0x75,0xb4,0xed,0xff,0x75,0xb2,0xec,0xff,0x75,0xb1,0xec,0xff,0x75,0xb0,0xed,0xff,0x77,0xaf,0xec,0xff,0x78,0xaf,0xee,0xff,0x75,0xae,0xed,0xff,0x73,0xad,0xec,0xff,0x76,0xb2,0xee,0xff,0x77,0xb8,0xf0,0xff,0x6a,0xb5,0xeb,0xff,0x61,0xb5,0xe7,0xff,0x6f,0xc2,0xf2,0xff,0x66,0xbc,0xe8,0xff,0x6b,0xc5,0xeb,0xff,0x68,0xc1,0xe8,0xff,0x7a,0xd1,0xf6,0xff,0x7c,0xd0,0xf4,0xff,0x7f,0xd0,0xf2,0xff,0x83,0xd1,0xf1,0xff,0x87,0xd2,0xf2,0xff,0x90,0xd3,0xf2,0xff,0x94,0xd5,0xf1,0xff,0x98,0xd5,0xf1,0xff,0x9a,0xd4,0xf1,0xff,0x9d,0xd5,0xf1,0xff,0x9e,0xd5,0xf1,0xff,0x9f,0xd5,0xf1,0xff,0x9e,0xd6,0xf2,0xff,0xa6,0xe0,0xfb,0xff,0x81,0xb4,0xd0,0xff,0x4c,0x7a,0x9c,0xff,0x52,0x7c,0xa1,0xff,0x47,0x72,0x99,0xff,0x5c,0x93,0xba,0xff,0x75,0xb0,0xd2,0xff,0xa1,0xd6,0xf3,0xff,0x99,0xd0,0xed,0xff,0x8c,0xc4,0xe2,0xff,0x8b,0xc2,0xde,0xff,0xa3,0xd5,0xf1,0xff,0xa5,0xd5,0xf0,0xff,0xa4,0xd5,0xef,0xff,0xa3,0xd5,0xee,0xff,0xa7,0xd8,0xf2,0xff,0x97,0xc8,0xe4,0xff,0x83,0xb6,0xd4,0xff,0x84,0xb7,0xd6,0xff,0x84,0xb7,0xd6,0xff,0x95,0xc7,0xe7,0xff,0x9a,0xcf,0xea,0xff,0xa2,0xd8,0xf0,0xff,0x97,0xce,0xe8,0xff,0x85,0xbf,0xdb,0xff,0x86,0xbd,0xda,0xff,0x85,0xb8,0xd5,0xff,0x8d,0xbf,0xda,0xff,0xa1,0xd2,0xec,0xff,0xa0,0xd2,0xea,0xff,0x9f,0xd1,0xea,0xff,0x9f,0xd1,0xec,0xff,0x97,0xcb,0xe7,0xff,0x92,0xbf,0xd9,0xff,0x9c,0xc2,0xd9,0xff,0xaa,0xd0,0xe6,0xff,0x99,0xcb,0xe5,0xff,0x92,0xca,0xe4,0xff,0x90,0xc9,0xe3,0xff,0x8c,0xc7,0xe2,0xff,0x8a,0xc4,0xe1,0xff,0x90,0xc9,0xe5,0xff,0x88,0xc2,0xdf,0xff,0x73,0xa9,0xcb,0xff,0x4d,0x78,0x9d,0xff,0x50,0x7d,0x9f,0xff,0x4c,0x7f,0xa4,0xff,0x77,0xaf,0xd8,0xff,0x89,0xbd,0xdb,0xff,0x91,0xb8,0xcc,0xff,0x9d,0xba,0xcb,0xff,0xa0,0xba,0xc7,0xff,0x9d,0xb2,0xbe,0xff,0x9b,0xae,0xba,0xff,0x98,0xaa,0xb7,0xff,0x96,0xa6,0xb3,0xff,0x8d,0xa0,0xad,0xff,0x6c,0x96,0xad,0xff,0x53,0x8f,0xac,0xff,0x4a,0x8b,0xab,0xff,0x38,0x87,0xaa,0xff,0x21,0x81,0xa7,0xff,0x25,0x81,0xa7,0xff,0x58,0x91,0xa9,0xff,0x3f,0x84,0xa4,0xff,0x72,0xab,0xc8,0xd0,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x00,0xf0,0xf7,0xfb,0x47,0x91,0xc6,0xdf,0xff,0x6f,0xbb,0xd9,0xff,0x64,0xa6,0xd8,0xff,0x65,0x9c,0xd9,0xff,0x6c,0xa6,0xe0,0xff,0x6f,0xac,0xe4,0xff,0x68,0xb6,0xe4,0xff,0x74,0xbd,0xe0,0xff,0xa3,0xca,0xdf,0xff,0xb4,0xd1,0xe1,0xff,0xb4,0xd1,0xe1,0xff,0xc2,0xde,0xee,0xff,0x89,0xc5,0xe5,0xff,0x51,0x99,0xd0,0xff,0x6d,0xa1,0xd7,0xff,0x70,0x98,0xcb,0xff,0x75,0x91,0xc0,0xff,0x75,0x90,0xb3,0xff,0x71,0x8e,0xad,0xff,0x6c,0x90,0xbc,0xff,0x80,0xba,0xea,0xff,0x96,0xc4,0xe0,0xff,0x9c,0xbf,0xd9,0xff,0x82,0xbe,0xe8,0xff,0x7d,0xb1,0xde,0xff,0x77,0x93,0xb8,0xff,0x76,0x9a,0xc2,0xff,0x75,0x9a,0xc3,0xff,0x73,0x96,0xc0,0xff,0x6e,0x96,0xbf,0xff,0x73,0x96,0xbf,0xff,0x78,0x97,0xba,0xff,0x79,0x97,0xb8,0xff,0x77,0x97,0xc5,0xff,0x99,0xce,0xee,0xff,0xb0,0xe0,0xf2,0xff,0x9c,0xd6,0xef,0xff,0x86,0xd0,0xf0,0xff,0x7d,0xcb,0xf1,0xff,0x7b,0xc6,0xf0,0xff,0x7b,0xc1,0xf0,0xff,0x7b,0xbc,0xee,0xff,0x7b,0xb9,0xef,0xff,0x79,0xb8,0xee,0xff,0x78,0xb5,0xeb,0xff,0x79,0xb4,0xeb,0xff,0x7a,0xb3,0xec,0xff,0x79,0xb1,0xed,0xff,0x7c,0xb2,0xed,0xff,0x78,0xae,0xec,0xff,0x75,0xac,0xe9,0xff,0x74,0xae,0xe9,0xff,0x76,0xb1,0xec,0xff,0x7e,0xbb,0xf0,0xff,0x70,0xb9,0xeb,0xff,0x6a,0xbc,0xeb,0xff,0x6d,0xbf,0xee,0xff,0x6a,0xbe,0xe8,0xff,0x6c,0xc5,0xeb,0xff,0x77,0xcf,0xf5,0xff,0x77,0xcc,0xf1,0xff,0x77,0xc9,0xeb,0xff,0x85,0xd2,0xf2,0xff,0x88,0xd1,0xf1,0xff,0x8d,0xd2,0xf1,0xff,0x93,0xd3,0xf1,0xff,0x98,0xd3,0xf0,0xff,0x9c,0xd5,0xf1,0xff,0x9e,0xd5,0xf0,0xff,0x9e,0xd4,0xf0,0xff,0x9e,0xd4,0xf0,0xff,0x9e,0xd4,0xf0,0xff,0xa4,0xda,0xf5,0xff,0x96,0xcc,0xe9,0xff,0x6b,0x9e,0xc0,0xff,0x59,0x8c,0xb0,0xff,0x67,0x9c,0xc1,0xff,0x61,0x98,0xbd,0xff,0x60,0x98,0xbd,0xff,0x65,0x9a,0xbe,0xff,0x67,0x9b,0xb9,0xff,0xa0,0xd5,0xf0,0xff,0x8f,0xc5,0xe3,0xff,0x88,0xbd,0xda,0xff,0x9d,0xcf,0xeb,0xff,0xa5,0xd4,0xef,0xff,0xa3,0xd4,0xee,0xff,0xa7,0xd8,0xf2,0xff,0xa7,0xd6,0xf2,0xff,0x9d,0xcd,0xe9,0xff,0x95,0xc7,0xe4,0xff,0x83,0xb6,0xd5,0xff,0x8e,0xc0,0xdf,0xff,0x98,0xca,0xeb,0xff,0x9e,0xd2,0xec,0xff,0x9f,0xd6,0xee,0xff,0x8f,0xc6,0xe1,0xff,0x84,0xbb,0xd8,0xff,0x84,0xba,0xd5,0xff,0x91,0xc6,0xe0,0xff,0x9e,0xd0,0xe9,0xff,0xa1,0xd2,0xea,0xff,0x9f,0xcf,0xea,0xff,0x9a,0xcc,0xe8,0xff,0x90,0xc3,0xe1,0xff,0x8c,0xbe,0xde,0xff,0x7c,0xb1,0xd0,0xff,0x7b,0xb5,0xd2,0xff,0x8c,0xc6,0xe2,0xff,0x90,0xc5,0xe3,0xff,0x8c,0xc5,0xe3,0xff,0x89,0xc4,0xe3,0xff,0x87,0xc3,0xe2,0xff,0x87,0xc1,0xe0,0xff,0x89,0xc1,0xde,0xff,0x8a,0xc2,0xde,0xff,0x88,0xbd,0xe0,0xff,0x58,0x88,0xad,0xff,0x46,0x75,0x96,0xff,0x58,0x8d,0xb1,0xff,0x74,0xaf,0xd9,0xff,0x83,0xbe,0xdd,0xff,0x7d,0xae,0xcb,0xff,0x8b,0xb1,0xc8,0xff,0x96,0xb2,0xc0,0xff,0x96,0xaa,0xb8,0xff,0x92,0xa7,0xb4,0xff,0x90,0xa5,0xb1,0xff,0x8e,0xa2,0xae,0xff,0x81,0x99,0xa8,0xff,0x62,0x8d,0xa3,0xff,0x50,0x88,0xa4,0xff,0x44,0x82,0xa3,0xff,0x34,0x7f,0xa1,0xff,0x21,0x7c,0xa0,0xff,0x22,0x7a,0x9f,0xff,0x56,0x87,0x9f,0xff,0x64,0x8b,0x9e,0xff,0xbc,0xcf,0xd9,0xa1,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfe,0xfe,0x00,0xfd,0xfe,0xfe,0x18,0xb4,0xd2,0xe3,0xf2,0x8d,0xc1,0xd9,0xff,0x73,0xb0,0xd8,0xff,0x65,0x9d,0xd4,0xff,0x69,0xa3,0xd8,0xff,0x6d,0xab,0xe1,0xff,0x6d,0xb3,0xe1,0xff,0x80,0xbd,0xdd,0xff,0x9d,0xc6,0xdb,0xff,0xad,0xcf,0xdf,0xff,0xae,0xce,0xe2,0xff,0xa8,0xd5,0xf1,0xff,0x73,0xb7,0xe1,0xff,0x54,0x8d,0xc7,0xff,0x6f,0x9a,0xcc,0xff,0x75,0x98,0xc1,0xff,0x75,0x95,0xb6,0xff,0x76,0x93,0xaf,0xff,0x73,0x90,0xac,0xff,0x71,0x96,0xbe,0xff,0x7d,0xbe,0xec,0xff,0x73,0xa9,0xd3,0xff,0x70,0x95,0xc2,0xff,0x73,0xb2,0xe3,0xff,0x7b,0xb0,0xdb,0xff,0x74,0x96,0xb7,0xff,0x78,0x98,0xbb,0xff,0x76,0x97,0xb8,0xff,0x75,0x95,0xb8,0xff,0x76,0x93,0xb5,0xff,0x77,0x94,0xb5,0xff,0x78,0x97,0xb6,0xff,0x78,0x97,0xb5,0xff,0x78,0x9b,0xc3,0xff,0x93,0xcc,0xec,0xff,0xa6,0xdb,0xf2,0xff,0x98,0xd8,0xf6,0xff,0x84,0xd2,0xf4,0xff,0x7e,0xc8,0xee,0xff,0x7e,0xc3,0xed,0xff,0x7e,0xbe,0xed,0xff,0x7e,0xbb,0xec,0xff,0x7e,0xb9,0xed,0xff,0x7d,0xb7,0xeb,0xff,0x7c,0xb6,0xea,0xff,0x7c,0xb6,0xea,0xff,0x7c,0xb5,0xea,0xff,0x7b,0xb3,0xe9,0xff,0x7d,0xb3,0xea,0xff,0x7b,0xb1,0xeb,0xff,0x77,0xaf,0xe8,0xff,0x79,0xb1,0xea,0xff,0x77,0xb0,0xe9,0xff,0x7e,0xbd,0xef,0xff,0x73,0xbb,0xe8,0xff,0x71,0xc0,0xeb,0xff,0x72,0xc3,0xeb,0xff,0x6e,0xc0,0xe7,0xff,0x6c,0xc1,0xe9,0xff,0x38,0x86,0xb3,0xff,0x54,0xa3,0xcc,0xff,0x84,0xd2,0xf0,0xff,0x8a,0xd3,0xf0,0xff,0x8e,0xd3,0xf0,0xff,0x93,0xd3,0xf0,0xff,0x98,0xd4,0xef,0xff,0x9b,0xd4,0xee,0xff,0x9e,0xd6,0xef,0xff,0xa0,0xd5,0xee,0xff,0xa0,0xd5,0xee,0xff,0xa0,0xd5,0xee,0xff,0xa1,0xd5,0xf0,0xff,0xa1,0xd6,0xf2,0xff,0x78,0xad,0xcd,0xff,0x48,0x75,0x99,0xff,0x3d,0x6b,0x8f,0xff,0x6c,0xa6,0xc8,0xff,0x7a,0xb2,0xd4,0xff,0x87,0xbd,0xe0,0xff,0x74,0xa8,0xcc,0xff,0x32,0x63,0x83,0xff,0x67,0x98,0xb7,0xff,0x99,0xcc,0xeb,0xff,0x8a,0xc0,0xde,0xff,0x95,0xc8,0xe5,0xff,0xa7,0xd5,0xef,0xff,0xa2,0xd3,0xee,0xff,0xa0,0xd2,0xee,0xff,0x9b,0xce,0xed,0xff,0x93,0xc7,0xe6,0xff,0x8d,0xc0,0xe1,0xff,0x86,0xb8,0xd9,0xff,0x79,0xac,0xcb,0xff,0x8f,0xc2,0xe1,0xff,0xa1,0xd3,0xee,0xff,0x9d,0xd1,0xeb,0xff,0x8d,0xc2,0xe0,0xff,0x82,0xb7,0xd5,0xff,0x8f,0xc3,0xdc,0xff,0x9e,0xd3,0xe8,0xff,0x9d,0xce,0xe7,0xff,0x9c,0xcc,0xe6,0xff,0x9d,0xcd,0xe7,0xff,0x98,0xc8,0xe5,0xff,0x8d,0xbd,0xdb,0xff,0x8b,0xbb,0xda,0xff,0x88,0xb5,0xd2,0xff,0x92,0xbe,0xd5,0xff,0xa2,0xce,0xe2,0xff,0x92,0xc6,0xe0,0xff,0x8b,0xc3,0xe1,0xff,0x88,0xc1,0xe2,0xff,0x87,0xc0,0xe0,0xff,0x87,0xc0,0xde,0xff,0x88,0xbe,0xdc,0xff,0x86,0xbc,0xd9,0xff,0x87,0xc0,0xdf,0xff,0x6b,0xa2,0xc3,0xff,0x40,0x6e,0x8d,0xff,0x58,0x8b,0xaf,0xff,0x77,0xb0,0xdb,0xff,0x84,0xbf,0xe0,0xff,0x71,0xab,0xc8,0xff,0x78,0xaa,0xc3,0xff,0x89,0xaa,0xba,0xff,0x8b,0xa3,0xb1,0xff,0x88,0xa1,0xae,0xff,0x87,0xa2,0xad,0xff,0x83,0x9e,0xa9,0xff,0x75,0x93,0xa2,0xff,0x5c,0x86,0xa0,0xff,0x4c,0x82,0x9f,0xff,0x42,0x81,0x9e,0xff,0x35,0x7b,0x9c,0xff,0x23,0x77,0x9a,0xff,0x29,0x78,0x98,0xff,0x62,0x85,0x97,0xff,0x7f,0x92,0x9e,0xff,0xe5,0xe8,0xea,0x6b,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xf8,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xd1,0xe1,0xeb,0xb5,0x9f,0xc2,0xd5,0xff,0x85,0xb8,0xd9,0xff,0x66,0x9e,0xd0,0xff,0x67,0xa0,0xd3,0xff,0x70,0xa9,0xe0,0xff,0x71,0xb0,0xdd,0xff,0x91,0xc3,0xdb,0xff,0xa4,0xc9,0xd8,0xff,0xac,0xcb,0xdc,0xff,0x96,0xc6,0xe0,0xff,0x80,0xc3,0xec,0xff,0x73,0xac,0xe1,0xff,0x57,0x86,0xbe,0xff,0x71,0x94,0xc5,0xff,0x79,0x98,0xbe,0xff,0x77,0x95,0xb5,0xff,0x77,0x93,0xaf,0xff,0x75,0x90,0xab,0xff,0x76,0x99,0xc1,0xff,0x7c,0xbc,0xe7,0xff,0x79,0xb5,0xde,0xff,0x7d,0xb5,0xe5,0xff,0x7c,0xbb,0xe6,0xff,0x80,0xb3,0xda,0xff,0x78,0x97,0xba,0xff,0x79,0x99,0xbb,0xff,0x78,0x98,0xba,0xff,0x78,0x96,0xb9,0xff,0x7e,0x9c,0xbe,0xff,0x7e,0x9b,0xbd,0xff,0x7f,0x9e,0xbd,0xff,0x83,0xa0,0xbd,0xff,0x86,0xa8,0xd1,0xff,0x88,0xbe,0xe3,0xff,0x8a,0xc5,0xe7,0xff,0x4d,0x90,0xb8,0xff,0x52,0x9e,0xc9,0xff,0x83,0xcb,0xf1,0xff,0x80,0xc2,0xeb,0xff,0x7f,0xbc,0xeb,0xff,0x80,0xba,0xeb,0xff,0x80,0xb8,0xeb,0xff,0x7f,0xb6,0xea,0xff,0x7e,0xb6,0xe9,0xff,0x7f,0xb6,0xe9,0xff,0x7e,0xb6,0xe8,0xff,0x7f,0xb4,0xe9,0xff,0x80,0xb4,0xe9,0xff,0x80,0xb4,0xea,0xff,0x79,0xaf,0xe5,0xff,0x7a,0xb0,0xe7,0xff,0x7a,0xb0,0xe8,0xff,0x7d,0xb9,0xec,0xff,0x76,0xbb,0xe9,0xff,0x76,0xc3,0xef,0xff,0x61,0xab,0xd5,0xff,0x77,0xc3,0xeb,0xff,0x5b,0xa8,0xd2,0xff,0x0b,0x4f,0x7e,0xff,0x5c,0xa1,0xc8,0xff,0x93,0xd9,0xf5,0xff,0x91,0xd2,0xef,0xff,0x95,0xd4,0xf0,0xff,0x99,0xd3,0xef,0xff,0x9c,0xd4,0xee,0xff,0x9e,0xd4,0xed,0xff,0xa0,0xd4,0xee,0xff,0xa1,0xd4,0xee,0xff,0xa0,0xd4,0xee,0xff,0xa0,0xd4,0xee,0xff,0xa1,0xd6,0xf2,0xff,0x86,0xbc,0xe0,0xff,0x5e,0x95,0xb9,0xff,0x4b,0x74,0x95,0xff,0x49,0x74,0x96,0xff,0x67,0x9b,0xbf,0xff,0x43,0x70,0x94,0xff,0x50,0x80,0xa5,0xff,0x4f,0x7f,0xa3,0xff,0x2f,0x5b,0x7e,0xff,0x58,0x88,0xaa,0xff,0x98,0xcb,0xeb,0xff,0x8e,0xc1,0xe2,0xff,0x92,0xc4,0xe2,0xff,0xa9,0xda,0xf1,0xff,0xa1,0xd3,0xef,0xff,0x89,0xbc,0xda,0xff,0x81,0xb7,0xd8,0xff,0x80,0xb8,0xdb,0xff,0x71,0xa4,0xc9,0xff,0x68,0x96,0xba,0xff,0x5c,0x8c,0xac,0xff,0x89,0xba,0xdb,0xff,0x93,0xc5,0xe3,0xff,0x9d,0xd0,0xeb,0xff,0x8c,0xbe,0xdc,0xff,0x80,0xb2,0xd2,0xff,0x97,0xc9,0xe2,0xff,0x9e,0xd0,0xe6,0xff,0x9b,0xcb,0xe3,0xff,0x9b,0xcb,0xe4,0xff,0x9b,0xcb,0xe5,0xff,0x97,0xc8,0xe3,0xff,0x89,0xb9,0xd5,0xff,0x8c,0xbc,0xd9,0xff,0x86,0xb7,0xd5,0xff,0x7b,0xaf,0xcc,0xff,0x8b,0xc0,0xdc,0xff,0x8f,0xc3,0xe1,0xff,0x8a,0xc0,0xdf,0xff,0x87,0xbf,0xdf,0xff,0x85,0xbe,0xdd,0xff,0x87,0xbe,0xdc,0xff,0x87,0xbd,0xd9,0xff,0x85,0xba,0xd7,0xff,0x83,0xba,0xd9,0xff,0x80,0xb9,0xd8,0xff,0x45,0x71,0x92,0xff,0x43,0x6d,0x92,0xff,0x6f,0xa6,0xd0,0xff,0x8a,0xc3,0xe5,0xff,0x70,0xa8,0xc4,0xff,0x6d,0xa1,0xbd,0xff,0x74,0xa0,0xb4,0xff,0x7d,0x9c,0xac,0xff,0x7c,0x9a,0xa8,0xff,0x7a,0x99,0xa5,0xff,0x78,0x96,0xa2,0xff,0x6c,0x8d,0x9e,0xff,0x56,0x81,0x9c,0xff,0x4b,0x7f,0x9b,0xff,0x42,0x7e,0x9a,0xff,0x35,0x79,0x98,0xff,0x25,0x72,0x94,0xff,0x2c,0x73,0x93,0xff,0x67,0x81,0x91,0xff,0x97,0xa2,0xa7,0xf9,0xf9,0xf9,0xfa,0x23,0xff,0xff,0xff,0x00,0xff,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf4,0xf9,0x00,0xff,0xff,0xff,0x00,0xe9,0xf0,0xf4,0x77,0xa7,0xc3,0xd7,0xff,0x87,0xb5,0xd8,0xff,0x67,0x9e,0xca,0xff,0x67,0x9e,0xd0,0xff,0x6f,0xa5,0xda,0xff,0x7a,0xb3,0xd9,0xff,0x9d,0xc5,0xda,0xff,0xa2,0xc8,0xd9,0xff,0x9f,0xc4,0xde,0xff,0x7a,0xb6,0xdb,0xff,0x81,0xb5,0xe9,0xff,0x7a,0xa6,0xe0,0xff,0x55,0x7e,0xb5,0xff,0x6d,0x8f,0xbc,0xff,0x79,0x98,0xbb,0xff,0x78,0x96,0xb3,0xff,0x78,0x94,0xaf,0xff,0x76,0x91,0xab,0xff,0x79,0x9c,0xc3,0xff,0x7c,0xba,0xe7,0xff,0x7d,0xaf,0xd8,0xff,0x80,0xab,0xd6,0xff,0x99,0xd0,0xef,0xff,0x93,0xbc,0xda,0xff,0x77,0x98,0xb8,0xff,0x7d,0x9c,0xbc,0xff,0x7c,0x9a,0xbb,0xff,0x7f,0x9b,0xbd,0xff,0x75,0x90,0xb3,0xff,0x7a,0x96,0xbb,0xff,0x6b,0x88,0xad,0xff,0x5a,0x73,0x96,0xff,0x4c,0x68,0x9c,0xff,0x4b,0x75,0xa7,0xff,0x55,0x89,0xb4,0xff,0x0a,0x36,0x67,0xff,0x3f,0x7a,0xa9,0xff,0x8d,0xcd,0xf5,0xff,0x84,0xc1,0xea,0xff,0x82,0xbc,0xea,0xff,0x83,0xba,0xea,0xff,0x82,0xb9,0xea,0xff,0x81,0xb6,0xe8,0xff,0x81,0xb6,0xe7,0xff,0x81,0xb6,0xe8,0xff,0x80,0xb5,0xe7,0xff,0x81,0xb4,0xe7,0xff,0x82,0xb4,0xe7,0xff,0x80,0xb3,0xe7,0xff,0x7e,0xb2,0xe5,0xff,0x7c,0xb1,0xe6,0xff,0x79,0xae,0xe5,0xff,0x82,0xbb,0xed,0xff,0x78,0xbb,0xed,0xff,0x4d,0x9b,0xc9,0xff,0x15,0x5b,0x89,0xff,0x3e,0x81,0xb5,0xff,0x3d,0x84,0xb3,0xff,0x0a,0x4c,0x78,0xff,0x74,0xb5,0xda,0xff,0x95,0xd7,0xf2,0xff,0x95,0xd2,0xee,0xff,0x99,0xd4,0xef,0xff,0x9d,0xd3,0xee,0xff,0x9f,0xd3,0xed,0xff,0xa0,0xd3,0xed,0xff,0xa1,0xd3,0xed,0xff,0xa2,0xd3,0xed,0xff,0xa1,0xd3,0xed,0xff,0xa2,0xd4,0xee,0xff,0xa0,0xd3,0xf2,0xff,0x84,0xb9,0xdf,0xff,0x4a,0x7f,0xa3,0xff,0x25,0x4c,0x6b,0xff,0x45,0x70,0x90,0xff,0x69,0x9c,0xc0,0xff,0x42,0x70,0x94,0xff,0x5b,0x8b,0xaf,0xff,0x4a,0x79,0x9e,0xff,0x2e,0x5b,0x7f,0xff,0x59,0x89,0xae,0xff,0x86,0xbb,0xdf,0xff,0x91,0xc3,0xe4,0xff,0x9e,0xce,0xea,0xff,0x9a,0xcd,0xe4,0xff,0x79,0xac,0xc9,0xff,0x5c,0x8d,0xae,0xff,0x4f,0x81,0xa4,0xff,0x6b,0xa0,0xc5,0xff,0x5e,0x8f,0xb7,0xff,0x60,0x8a,0xb0,0xff,0x88,0xb7,0xd9,0xff,0x80,0xb0,0xd2,0xff,0x8a,0xbd,0xdc,0xff,0x9f,0xd2,0xee,0xff,0x8b,0xbc,0xda,0xff,0x80,0xb1,0xd0,0xff,0x96,0xc7,0xe0,0xff,0x9c,0xcd,0xe4,0xff,0x99,0xca,0xe2,0xff,0x99,0xcb,0xe2,0xff,0x9a,0xca,0xe4,0xff,0x94,0xc4,0xde,0xff,0x82,0xb2,0xcc,0xff,0x86,0xb6,0xd1,0xff,0x85,0xba,0xd6,0xff,0x75,0xab,0xca,0xff,0x7a,0xb0,0xcf,0xff,0x8b,0xc0,0xde,0xff,0x88,0xbe,0xdb,0xff,0x84,0xbc,0xdb,0xff,0x82,0xb9,0xd9,0xff,0x83,0xb9,0xd6,0xff,0x82,0xb9,0xd5,0xff,0x7f,0xb6,0xd2,0xff,0x7d,0xb2,0xd1,0xff,0x83,0xba,0xda,0xff,0x58,0x85,0xa6,0xff,0x2e,0x55,0x73,0xff,0x58,0x8b,0xaf,0xff,0x8a,0xc4,0xe7,0xff,0x74,0xaa,0xc8,0xff,0x62,0x97,0xb4,0xff,0x64,0x9a,0xb1,0xff,0x71,0x96,0xa9,0xff,0x70,0x94,0xa1,0xff,0x6f,0x93,0x9f,0xff,0x6d,0x91,0x9e,0xff,0x62,0x89,0x9b,0xff,0x52,0x82,0x9b,0xff,0x49,0x7f,0x9a,0xff,0x43,0x7e,0x98,0xff,0x37,0x78,0x95,0xff,0x25,0x6e,0x8f,0xff,0x27,0x6b,0x8a,0xff,0x60,0x7a,0x89,0xff,0xb2,0xba,0xbe,0xce,0xff,0xff,0xff,0x04,0xff,0xfc,0xfe,0x00,0xfe,0xf0,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xed,0xf4,0x00,0xff,0xff,0xff,0x00,0xf9,0xfb,0xfb,0x36,0xb0,0xca,0xdd,0xfe,0x84,0xb1,0xd3,0xff,0x6a,0x9f,0xc9,0xff,0x69,0x9e,0xcd,0xff,0x6c,0xa3,0xd2,0xff,0x88,0xbb,0xdd,0xff,0x96,0xbf,0xd4,0xff,0x92,0xbf,0xd4,0xff,0x85,0xb7,0xd7,0xff,0x6b,0xa6,0xd2,0xff,0x83,0xaf,0xe2,0xff,0x80,0xa7,0xda,0xff,0x51,0x77,0xa9,0xff,0x69,0x8b,0xb4,0xff,0x7b,0x99,0xba,0xff,0x79,0x97,0xb2,0xff,0x7a,0x97,0xb0,0xff,0x79,0x94,0xae,0xff,0x7c,0x9f,0xc6,0xff,0x7c,0xb6,0xe5,0xff,0x78,0xa4,0xca,0xff,0x84,0xab,0xc9,0xff,0x97,0xcf,0xeb,0xff,0x88,0xb2,0xd4,0xff,0x7d,0x9c,0xba,0xff,0x80,0x9e,0xbd,0xff,0x85,0xa1,0xc0,0xff,0x75,0x94,0xb8,0xff,0x27,0x3b,0x61,0xff,0x38,0x4c,0x74,0xff,0x17,0x29,0x4f,0xff,0x10,0x21,0x49,0xff,0x1b,0x2a,0x58,0xff,0x21,0x38,0x6a,0xff,0x18,0x3a,0x6e,0xff,0x0a,0x2b,0x59,0xff,0x6b,0xa3,0xcc,0xff,0x8d,0xc9,0xf0,0xff,0x85,0xbe,0xe7,0xff,0x85,0xbc,0xe7,0xff,0x86,0xbb,0xe7,0xff,0x86,0xba,0xe9,0xff,0x85,0xb8,0xe8,0xff,0x83,0xb7,0xe6,0xff,0x82,0xb6,0xe6,0xff,0x81,0xb5,0xe5,0xff,0x81,0xb5,0xe4,0xff,0x82,0xb5,0xe4,0xff,0x83,0xb5,0xe5,0xff,0x85,0xb8,0xeb,0xff,0x82,0xb7,0xea,0xff,0x7c,0xb1,0xe3,0xff,0x8f,0xc5,0xf3,0xff,0x6c,0xad,0xe0,0xff,0x39,0x82,0xb2,0xff,0x05,0x3c,0x66,0xff,0x30,0x70,0x9c,0xff,0x32,0x72,0x9e,0xff,0x14,0x4b,0x76,0xff,0x74,0xb1,0xd5,0xff,0x95,0xd6,0xf1,0xff,0x95,0xd1,0xec,0xff,0x9b,0xd3,0xec,0xff,0x9f,0xd4,0xed,0xff,0xa1,0xd3,0xed,0xff,0xa2,0xd4,0xeb,0xff,0xa3,0xd3,0xeb,0xff,0xa3,0xd3,0xeb,0xff,0xa2,0xd3,0xec,0xff,0xa5,0xd7,0xf1,0xff,0x8e,0xbe,0xe1,0xff,0x67,0x95,0xbc,0xff,0x3b,0x67,0x8a,0xff,0x34,0x5c,0x7b,0xff,0x63,0x90,0xb1,0xff,0x3a,0x63,0x85,0xff,0x40,0x68,0x87,0xff,0x46,0x72,0x95,0xff,0x4c,0x7b,0xa2,0xff,0x2f,0x57,0x7e,0xff,0x4f,0x7d,0xa5,0xff,0x71,0xa7,0xcf,0xff,0x9c,0xcf,0xf0,0xff,0x9a,0xcb,0xe7,0xff,0x6c,0x9f,0xbb,0xff,0x53,0x83,0xa3,0xff,0x4a,0x79,0x9a,0xff,0x40,0x6d,0x90,0xff,0x3f,0x6b,0x91,0xff,0x57,0x84,0xab,0xff,0x6c,0x98,0xbf,0xff,0x61,0x8d,0xb0,0xff,0x56,0x85,0xa6,0xff,0x7d,0xb2,0xd1,0xff,0x96,0xc7,0xe4,0xff,0x8c,0xbd,0xdb,0xff,0x83,0xb1,0xd1,0xff,0x98,0xc7,0xe0,0xff,0x9b,0xcc,0xe2,0xff,0x98,0xc9,0xe1,0xff,0x99,0xca,0xe2,0xff,0x99,0xc9,0xe3,0xff,0x8b,0xbb,0xd5,0xff,0x81,0xb0,0xcb,0xff,0x65,0x92,0xaf,0xff,0x71,0xa1,0xc0,0xff,0x80,0xb3,0xd4,0xff,0x72,0xa5,0xc6,0xff,0x7e,0xb1,0xd1,0xff,0x84,0xb9,0xd7,0xff,0x7f,0xb6,0xd5,0xff,0x7d,0xb4,0xd2,0xff,0x7c,0xb3,0xd1,0xff,0x7b,0xb2,0xcf,0xff,0x7b,0xaf,0xcc,0xff,0x79,0xad,0xca,0xff,0x80,0xb6,0xd4,0xff,0x6d,0x9c,0xc1,0xff,0x2c,0x51,0x6f,0xff,0x41,0x65,0x84,0xff,0x7b,0xb1,0xd7,0xff,0x7f,0xb6,0xd6,0xff,0x5b,0x94,0xae,0xff,0x5c,0x95,0xae,0xff,0x65,0x91,0xa7,0xff,0x6a,0x90,0x9f,0xff,0x6a,0x8e,0x9c,0xff,0x69,0x8d,0x9c,0xff,0x60,0x87,0x9a,0xff,0x4f,0x80,0x99,0xff,0x46,0x7c,0x96,0xff,0x41,0x78,0x93,0xff,0x37,0x75,0x92,0xff,0x24,0x6b,0x8a,0xff,0x27,0x67,0x84,0xff,0x62,0x7c,0x89,0xff,0xd3,0xd8,0xda,0x8f,0xff,0xff,0xff,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xec,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf6,0xf9,0x00,0xfd,0xe8,0xf0,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x02,0xc4,0xd9,0xe8,0xd3,0x83,0xb0,0xd0,0xff,0x6c,0x9d,0xc7,0xff,0x6a,0x9c,0xcb,0xff,0x6a,0xa0,0xce,0xff,0x8a,0xbe,0xde,0xff,0x8b,0xba,0xcd,0xff,0x87,0xb8,0xd0,0xff,0x77,0xab,0xcf,0xff,0x6d,0x9d,0xca,0xff,0x83,0xab,0xd9,0xff,0x83,0xa7,0xd2,0xff,0x52,0x76,0xa1,0xff,0x67,0x86,0xae,0xff,0x7b,0x99,0xb9,0xff,0x79,0x98,0xb2,0xff,0x7a,0x99,0xb1,0xff,0x7a,0x97,0xb0,0xff,0x7e,0xa1,0xc8,0xff,0x83,0xbc,0xe5,0xff,0x85,0xc1,0xe3,0xff,0x93,0xca,0xe2,0xff,0x96,0xcb,0xea,0xff,0x88,0xb4,0xd8,0xff,0x81,0x9f,0xbe,0xff,0x83,0xa1,0xbe,0xff,0x83,0xa1,0xbf,0xff,0x65,0x85,0xaf,0xff,0x21,0x3a,0x5c,0xff,0x12,0x1f,0x3d,0xff,0x12,0x18,0x39,0xff,0x1a,0x22,0x46,0xff,0x16,0x1e,0x3e,0xff,0x0a,0x13,0x30,0xff,0x08,0x1f,0x4b,0xff,0x2f,0x5f,0x88,0xff,0x8a,0xc6,0xeb,0xff,0x89,0xc2,0xe8,0xff,0x86,0xbc,0xe6,0xff,0x87,0xba,0xe6,0xff,0x86,0xb9,0xe5,0xff,0x88,0xb9,0xe7,0xff,0x88,0xb9,0xe7,0xff,0x87,0xb8,0xe6,0xff,0x85,0xb7,0xe4,0xff,0x85,0xb7,0xe4,0xff,0x85,0xb7,0xe4,0xff,0x83,0xb6,0xe5,0xff,0x83,0xb5,0xe5,0xff,0x87,0xb9,0xeb,0xff,0x82,0xb6,0xe7,0xff,0x84,0xb7,0xe6,0xff,0x96,0xcc,0xf6,0xff,0x53,0x92,0xc4,0xff,0x21,0x5a,0x8b,0xff,0x29,0x5a,0x83,0xff,0x45,0x84,0xaf,0xff,0x1a,0x52,0x7d,0xff,0x1c,0x50,0x76,0xff,0x68,0xa3,0xc5,0xff,0x98,0xd5,0xf1,0xff,0x96,0xcf,0xe9,0xff,0x9b,0xd2,0xea,0xff,0x9f,0xd2,0xeb,0xff,0xa1,0xd2,0xec,0xff,0xa3,0xd3,0xeb,0xff,0xa4,0xd3,0xeb,0xff,0xa4,0xd3,0xeb,0xff,0xa7,0xd8,0xef,0xff,0x97,0xc8,0xe1,0xff,0x43,0x6f,0x92,0xff,0x1a,0x40,0x63,0xff,0x23,0x4a,0x6a,0xff,0x3a,0x66,0x88,0xff,0x3e,0x65,0x87,0xff,0x2c,0x4a,0x69,0xff,0x2e,0x4d,0x6a,0xff,0x31,0x54,0x75,0xff,0x4f,0x79,0xa2,0xff,0x41,0x69,0x94,0xff,0x42,0x6d,0x97,0xff,0x62,0x94,0xbd,0xff,0x7e,0xad,0xd1,0xff,0x72,0xa3,0xc2,0xff,0x54,0x83,0xa5,0xff,0x50,0x7c,0x9f,0xff,0x45,0x6e,0x90,0xff,0x3b,0x61,0x80,0xff,0x31,0x55,0x73,0xff,0x3a,0x5f,0x7f,0xff,0x55,0x7c,0x9d,0xff,0x6a,0x93,0xb2,0xff,0x79,0xa7,0xc6,0xff,0x7b,0xae,0xcd,0xff,0x88,0xb8,0xd8,0xff,0x8c,0xbc,0xdb,0xff,0x80,0xb0,0xcf,0xff,0x99,0xc8,0xe1,0xff,0x9c,0xcc,0xe1,0xff,0x98,0xc8,0xdf,0xff,0x98,0xc8,0xdf,0xff,0x99,0xc8,0xe1,0xff,0x87,0xb7,0xd1,0xff,0x7a,0xab,0xc5,0xff,0x69,0x94,0xb2,0xff,0x45,0x66,0x88,0xff,0x75,0xa1,0xc3,0xff,0x7b,0xae,0xce,0xff,0x73,0xa7,0xc6,0xff,0x7a,0xb0,0xce,0xff,0x7d,0xb4,0xd2,0xff,0x7b,0xb1,0xce,0xff,0x78,0xb0,0xcc,0xff,0x76,0xad,0xc9,0xff,0x78,0xaa,0xc7,0xff,0x77,0xa9,0xc6,0xff,0x7c,0xaf,0xcc,0xff,0x7c,0xad,0xd5,0xff,0x3d,0x63,0x84,0xff,0x31,0x4c,0x69,0xff,0x5e,0x8c,0xb2,0xff,0x89,0xbf,0xe2,0xff,0x60,0x99,0xb5,0xff,0x57,0x91,0xac,0xff,0x5b,0x8c,0xa5,0xff,0x63,0x89,0x9d,0xff,0x65,0x8b,0x9a,0xff,0x63,0x89,0x96,0xff,0x5d,0x84,0x95,0xff,0x4c,0x7c,0x93,0xff,0x43,0x76,0x8f,0xff,0x3e,0x72,0x8c,0xff,0x32,0x6e,0x89,0xff,0x24,0x67,0x85,0xff,0x26,0x63,0x7d,0xff,0x71,0x88,0x91,0xff,0xf1,0xf2,0xf3,0x41,0xff,0xff,0xff,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xeb,0xf3,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf6,0xfa,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf8,0xfa,0x00,0xff,0xff,0xff,0x00,0xde,0xeb,0xf2,0x86,0x89,0xb5,0xd1,0xff,0x6d,0x9b,0xc5,0xff,0x66,0x98,0xc7,0xff,0x65,0x9b,0xc9,0xff,0x80,0xb6,0xd5,0xff,0x82,0xb5,0xcd,0xff,0x75,0xa6,0xca,0xff,0x6e,0x9e,0xc9,0xff,0x6b,0x97,0xc4,0xff,0x81,0xa7,0xd2,0xff,0x85,0xa7,0xd0,0xff,0x55,0x77,0x9d,0xff,0x64,0x83,0xa7,0xff,0x7c,0x9a,0xb8,0xff,0x77,0x97,0xb1,0xff,0x7a,0x99,0xb2,0xff,0x77,0x97,0xb0,0xff,0x7b,0xa6,0xc6,0xff,0x94,0xc5,0xe2,0xff,0x8f,0xbc,0xdd,0xff,0x8f,0xc2,0xde,0xff,0x96,0xcd,0xe9,0xff,0x8a,0xb4,0xd7,0xff,0x81,0x9f,0xbf,0xff,0x87,0xa5,0xc0,0xff,0x80,0xa1,0xc1,0xff,0x6b,0x8f,0xba,0xff,0x20,0x38,0x59,0xff,0x10,0x18,0x35,0xff,0x10,0x16,0x33,0xff,0x17,0x1d,0x39,0xff,0x0c,0x10,0x29,0xff,0x0e,0x14,0x2d,0xff,0x0f,0x1e,0x44,0xff,0x4c,0x6e,0x9b,0xff,0x89,0xbe,0xe4,0xff,0x8c,0xbc,0xe2,0xff,0x86,0xb8,0xe1,0xff,0x85,0xb8,0xe4,0xff,0x86,0xb8,0xe4,0xff,0x87,0xb8,0xe4,0xff,0x88,0xb6,0xe3,0xff,0x87,0xb6,0xe2,0xff,0x85,0xb6,0xe2,0xff,0x84,0xb7,0xe3,0xff,0x85,0xb7,0xe3,0xff,0x83,0xb6,0xe3,0xff,0x81,0xb4,0xe2,0xff,0x86,0xb9,0xe8,0xff,0x80,0xb4,0xe4,0xff,0x8c,0xbe,0xea,0xff,0x84,0xb9,0xe0,0xff,0x28,0x5c,0x8d,0xff,0x51,0x8c,0xb6,0xff,0x55,0x95,0xbb,0xff,0x15,0x4a,0x73,0xff,0x18,0x44,0x6c,0xff,0x2e,0x62,0x85,0xff,0x88,0xc2,0xe2,0xff,0x96,0xd0,0xec,0xff,0x98,0xce,0xe7,0xff,0x9d,0xd0,0xe8,0xff,0x9e,0xcf,0xe8,0xff,0x9f,0xcf,0xe9,0xff,0xa1,0xd1,0xe9,0xff,0xa4,0xd2,0xeb,0xff,0xa5,0xd3,0xeb,0xff,0xa7,0xd6,0xed,0xff,0xa5,0xd5,0xec,0xff,0x3e,0x6b,0x8c,0xff,0x50,0x81,0xa9,0xff,0x69,0x9e,0xc9,0xff,0x61,0x96,0xc2,0xff,0x3b,0x62,0x85,0xff,0x2a,0x47,0x65,0xff,0x2f,0x4e,0x6e,0xff,0x34,0x58,0x79,0xff,0x53,0x7d,0xa6,0xff,0x4e,0x78,0xa4,0xff,0x39,0x63,0x8c,0xff,0x41,0x6d,0x96,0xff,0x49,0x77,0x9e,0xff,0x5e,0x8f,0xb2,0xff,0x4d,0x78,0x9b,0xff,0x41,0x62,0x85,0xff,0x2d,0x52,0x71,0xff,0x26,0x4a,0x68,0xff,0x47,0x6c,0x89,0xff,0x76,0x9d,0xb8,0xff,0xa0,0xcb,0xe2,0xff,0xa0,0xce,0xe9,0xff,0x75,0xa4,0xc1,0xff,0x6f,0xa0,0xc0,0xff,0x81,0xb2,0xd2,0xff,0x8a,0xbb,0xda,0xff,0x7f,0xb1,0xce,0xff,0x9a,0xc8,0xe1,0xff,0x9d,0xcc,0xe0,0xff,0x9a,0xc9,0xdf,0xff,0x99,0xc7,0xdd,0xff,0x9a,0xc8,0xe0,0xff,0x84,0xb2,0xcd,0xff,0x77,0xa8,0xc6,0xff,0x96,0xc3,0xe2,0xff,0x4d,0x6b,0x8f,0xff,0x45,0x69,0x8d,0xff,0x5d,0x8b,0xab,0xff,0x77,0xa5,0xc4,0xff,0x72,0xa7,0xc5,0xff,0x79,0xaf,0xcd,0xff,0x7b,0xb0,0xce,0xff,0x77,0xad,0xc9,0xff,0x75,0xaa,0xc6,0xff,0x76,0xa8,0xc4,0xff,0x74,0xa7,0xc2,0xff,0x73,0xa7,0xc4,0xff,0x80,0xb5,0xdb,0xff,0x54,0x83,0xa7,0xff,0x2a,0x49,0x66,0xff,0x3f,0x6b,0x8e,0xff,0x82,0xb9,0xdd,0xff,0x6f,0xa5,0xc5,0xff,0x51,0x8b,0xa9,0xff,0x4d,0x85,0xa0,0xff,0x5b,0x85,0x9f,0xff,0x5e,0x86,0x96,0xff,0x5d,0x86,0x91,0xff,0x59,0x81,0x8f,0xff,0x48,0x75,0x8a,0xff,0x40,0x6f,0x88,0xff,0x39,0x6b,0x84,0xff,0x2d,0x67,0x81,0xff,0x22,0x63,0x7f,0xff,0x20,0x5a,0x73,0xff,0x92,0xa4,0xa9,0xdc,0xff,0xff,0xff,0x07,0xff,0xff,0xff,0x00,0xfd,0xe9,0xf2,0x00,0xfe,0xec,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe4,0xee,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xff,0xff,0x00,0xf7,0xfb,0xfc,0x36,0x96,0xba,0xd0,0xff,0x6f,0x9b,0xc3,0xff,0x6e,0x9e,0xc9,0xff,0x75,0xa7,0xd0,0xff,0x8f,0xc0,0xe0,0xff,0x8d,0xbb,0xdb,0xff,0x78,0xa6,0xd0,0xff,0x6e,0x9b,0xc5,0xff,0x6b,0x96,0xbd,0xff,0x7e,0xa5,0xca,0xff,0x87,0xa9,0xcd,0xff,0x58,0x79,0x9a,0xff,0x61,0x81,0x9e,0xff,0x7c,0x9b,0xb5,0xff,0x7a,0x98,0xb1,0xff,0x79,0x98,0xb2,0xff,0x77,0x98,0xb3,0xff,0x7c,0xa8,0xc3,0xff,0x88,0xae,0xc8,0xff,0x85,0xa3,0xc0,0xff,0x88,0xb1,0xce,0xff,0x96,0xcb,0xe7,0xff,0x86,0xb0,0xd2,0xff,0x83,0xa3,0xbe,0xff,0x85,0xa4,0xbf,0xff,0x83,0xa7,0xc6,0xff,0x66,0x89,0xb4,0xff,0x18,0x29,0x4b,0xff,0x0e,0x14,0x30,0xff,0x0f,0x16,0x32,0xff,0x15,0x1c,0x36,0xff,0x0d,0x13,0x2a,0xff,0x0f,0x16,0x2f,0xff,0x1a,0x24,0x50,0xff,0x52,0x72,0xa0,0xff,0x90,0xbd,0xe1,0xff,0x8a,0xb2,0xd6,0xff,0x83,0xae,0xd4,0xff,0x83,0xb4,0xdd,0xff,0x83,0xb4,0xdd,0xff,0x85,0xb3,0xde,0xff,0x85,0xb2,0xdd,0xff,0x86,0xb2,0xde,0xff,0x85,0xb4,0xdf,0xff,0x84,0xb4,0xdf,0xff,0x84,0xb4,0xdf,0xff,0x84,0xb3,0xde,0xff,0x81,0xb2,0xdb,0xff,0x85,0xb8,0xe3,0xff,0x7e,0xb2,0xdf,0xff,0x90,0xc3,0xe9,0xff,0x66,0x97,0xbc,0xff,0x41,0x6d,0x95,0xff,0x68,0xa5,0xc2,0xff,0x11,0x44,0x69,0xff,0x1a,0x42,0x66,0xff,0x16,0x40,0x64,0xff,0x4b,0x84,0xa6,0xff,0x99,0xd4,0xf1,0xff,0x95,0xcd,0xe6,0xff,0x98,0xcd,0xe7,0xff,0x9b,0xcd,0xe5,0xff,0x9e,0xce,0xe6,0xff,0xa1,0xd0,0xe9,0xff,0xa2,0xd0,0xe9,0xff,0xa3,0xd1,0xea,0xff,0xa1,0xd2,0xea,0xff,0xa1,0xd4,0xea,0xff,0xa9,0xdc,0xf0,0xff,0x8e,0xbf,0xda,0xff,0x73,0xa8,0xd0,0xff,0x72,0xaf,0xde,0xff,0x53,0x87,0xab,0xff,0x2d,0x4f,0x6e,0xff,0x2a,0x47,0x67,0xff,0x2d,0x4c,0x6e,0xff,0x2d,0x51,0x71,0xff,0x50,0x78,0xa0,0xff,0x55,0x7f,0xa9,0xff,0x4b,0x75,0x9c,0xff,0x34,0x56,0x7d,0xff,0x4b,0x76,0x9e,0xff,0x75,0xa7,0xd1,0xff,0x4c,0x7b,0x9d,0xff,0x77,0xa0,0xbb,0xff,0x78,0xa1,0xba,0xff,0x7c,0xa4,0xbf,0xff,0xa4,0xce,0xe7,0xff,0xae,0xda,0xf0,0xff,0xa3,0xd0,0xe4,0xff,0xa1,0xcf,0xe5,0xff,0x87,0xb7,0xd1,0xff,0x6c,0x9d,0xbb,0xff,0x7a,0xab,0xcb,0xff,0x85,0xb5,0xd5,0xff,0x8c,0xbb,0xd9,0xff,0x9b,0xcb,0xe3,0xff,0x9c,0xcb,0xe0,0xff,0x9b,0xc8,0xde,0xff,0x9a,0xc7,0xdd,0xff,0x98,0xc6,0xdd,0xff,0x85,0xb3,0xd1,0xff,0x85,0xb5,0xd8,0xff,0x73,0x96,0xba,0xff,0x37,0x4c,0x71,0xff,0x37,0x56,0x77,0xff,0x35,0x58,0x76,0xff,0x4f,0x73,0x91,0xff,0x76,0xa9,0xc6,0xff,0x74,0xa9,0xc8,0xff,0x7b,0xaf,0xcd,0xff,0x71,0xa6,0xc2,0xff,0x73,0xa5,0xc1,0xff,0x73,0xa4,0xc0,0xff,0x6f,0xa3,0xbf,0xff,0x6a,0x9e,0xb9,0xff,0x82,0xba,0xd8,0xff,0x73,0xa7,0xcb,0xff,0x2c,0x53,0x73,0xff,0x2c,0x53,0x75,0xff,0x6d,0xa3,0xc7,0xff,0x80,0xb4,0xd8,0xff,0x48,0x7f,0xa0,0xff,0x3e,0x78,0x98,0xff,0x46,0x76,0x95,0xff,0x55,0x7f,0x92,0xff,0x59,0x83,0x8e,0xff,0x51,0x7b,0x87,0xff,0x40,0x6d,0x81,0xff,0x3d,0x6b,0x81,0xff,0x38,0x66,0x7e,0xff,0x29,0x61,0x79,0xff,0x1f,0x5a,0x73,0xff,0x2a,0x5b,0x72,0xff,0xc3,0xce,0xd2,0x91,0xff,0xff,0xff,0x00,0xff,0xf9,0xfb,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xed,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xea,0xf2,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xc3,0xd6,0xe9,0xcd,0x94,0xbb,0xe2,0xff,0x9a,0xc5,0xe7,0xff,0xa5,0xce,0xec,0xff,0xb9,0xdf,0xf6,0xff,0xb1,0xd8,0xf1,0xff,0xac,0xce,0xef,0xff,0xad,0xc7,0xe5,0xff,0x9e,0xb7,0xd2,0xff,0x88,0xa9,0xcb,0xff,0x83,0xa6,0xc7,0xff,0x5a,0x7b,0x99,0xff,0x61,0x7f,0x9c,0xff,0x7a,0x9a,0xb5,0xff,0x7a,0x99,0xb2,0xff,0x79,0x97,0xb3,0xff,0x7a,0x9b,0xb7,0xff,0x7c,0x9e,0xb7,0xff,0x7e,0x9d,0xb3,0xff,0x80,0x9e,0xb6,0xff,0x89,0xad,0xca,0xff,0x91,0xc4,0xe3,0xff,0x7f,0xaa,0xcd,0xff,0x7f,0x9e,0xbc,0xff,0x88,0xa6,0xc2,0xff,0x8a,0xac,0xcb,0xff,0x5e,0x7f,0xaa,0xff,0x1c,0x29,0x4c,0xff,0x0e,0x13,0x2c,0xff,0x12,0x19,0x34,0xff,0x17,0x1e,0x3b,0xff,0x14,0x1a,0x36,0xff,0x15,0x1e,0x3e,0xff,0x1a,0x2e,0x57,0xff,0x6f,0x8e,0xb2,0xff,0x8b,0xad,0xd0,0xff,0x87,0xa8,0xcc,0xff,0x84,0xa7,0xcc,0xff,0x81,0xaa,0xd4,0xff,0x82,0xac,0xd6,0xff,0x82,0xad,0xd7,0xff,0x83,0xad,0xd7,0xff,0x84,0xad,0xd8,0xff,0x85,0xae,0xd8,0xff,0x84,0xac,0xd7,0xff,0x83,0xab,0xd4,0xff,0x83,0xaa,0xd4,0xff,0x7f,0xad,0xd5,0xff,0x83,0xb9,0xe2,0xff,0x7d,0xb5,0xdc,0xff,0x95,0xc6,0xe7,0xff,0x8e,0xc3,0xe3,0xff,0x7d,0xb9,0xd7,0xff,0x1d,0x4f,0x6f,0xff,0x17,0x3c,0x5d,0xff,0x1a,0x3f,0x62,0xff,0x1e,0x48,0x6d,0xff,0x61,0x9d,0xc1,0xff,0x8e,0xca,0xe8,0xff,0x98,0xcd,0xe5,0xff,0x9b,0xcd,0xe6,0xff,0x9c,0xce,0xe5,0xff,0x9b,0xca,0xe2,0xff,0x97,0xc0,0xda,0xff,0xa2,0xce,0xe7,0xff,0xa0,0xd1,0xe9,0xff,0x9f,0xd0,0xe8,0xff,0x9e,0xd2,0xea,0xff,0x9e,0xd2,0xe7,0xff,0xa1,0xd6,0xee,0xff,0x85,0xbb,0xe1,0xff,0x62,0x98,0xc6,0xff,0x39,0x61,0x84,0xff,0x23,0x42,0x60,0xff,0x2b,0x49,0x6a,0xff,0x30,0x52,0x73,0xff,0x2c,0x4f,0x70,0xff,0x3b,0x60,0x86,0xff,0x37,0x5c,0x84,0xff,0x40,0x66,0x8b,0xff,0x3b,0x59,0x7f,0xff,0x3b,0x62,0x88,0xff,0x5d,0x90,0xba,0xff,0x77,0xac,0xd0,0xff,0xa1,0xd3,0xeb,0xff,0xb2,0xe0,0xf4,0xff,0xaf,0xd9,0xf1,0xff,0xa8,0xd2,0xeb,0xff,0xa4,0xcf,0xe7,0xff,0x9d,0xcf,0xe5,0xff,0x9d,0xce,0xe4,0xff,0x9a,0xc9,0xe2,0xff,0x76,0xa5,0xc5,0xff,0x71,0xa1,0xc2,0xff,0x80,0xb0,0xcf,0xff,0x85,0xb4,0xd3,0xff,0x93,0xc3,0xdd,0xff,0x9c,0xcb,0xe2,0xff,0x9b,0xc9,0xdf,0xff,0x9a,0xc9,0xdd,0xff,0x96,0xc4,0xda,0xff,0x84,0xb2,0xd3,0xff,0x75,0x9e,0xc5,0xff,0x2c,0x43,0x64,0xff,0x24,0x31,0x4e,0xff,0x27,0x3d,0x57,0xff,0x34,0x4c,0x68,0xff,0x2a,0x44,0x63,0xff,0x66,0x91,0xb0,0xff,0x74,0xa9,0xc7,0xff,0x6e,0xa1,0xbf,0xff,0x72,0xa5,0xc3,0xff,0x73,0xa4,0xc1,0xff,0x6f,0xa1,0xbe,0xff,0x6b,0x9e,0xb9,0xff,0x62,0x96,0xb0,0xff,0x7b,0xb0,0xcc,0xff,0x86,0xb9,0xde,0xff,0x3d,0x66,0x8c,0xff,0x24,0x47,0x68,0xff,0x55,0x88,0xae,0xff,0x80,0xb8,0xdf,0xff,0x3c,0x63,0x8a,0xff,0x36,0x55,0x79,0xff,0x41,0x6d,0x8b,0xff,0x4e,0x7a,0x90,0xff,0x52,0x7b,0x89,0xff,0x53,0x7b,0x88,0xff,0x42,0x6e,0x83,0xff,0x39,0x65,0x7d,0xff,0x31,0x60,0x77,0xff,0x26,0x5a,0x71,0xff,0x1e,0x50,0x67,0xff,0x52,0x77,0x84,0xff,0xf2,0xf6,0xf6,0x3c,0xff,0xff,0xff,0x00,0xfe,0xf2,0xf7,0x00,0xfd,0xe4,0xee,0x00,0xfe,0xee,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xf1,0xf7,0xfd,0x78,0xae,0xce,0xeb,0xff,0x9d,0xc4,0xe5,0xff,0x9e,0xc2,0xe4,0xff,0xb5,0xd7,0xf5,0xff,0xa5,0xca,0xe6,0xff,0x9e,0xbf,0xde,0xff,0xb8,0xcf,0xe8,0xff,0xd1,0xdd,0xef,0xff,0xc6,0xd7,0xe8,0xff,0x99,0xb4,0xca,0xff,0x65,0x82,0x9f,0xff,0x64,0x81,0xa0,0xff,0x79,0x98,0xb6,0xff,0x7a,0x9a,0xb5,0xff,0x79,0x99,0xb4,0xff,0x7a,0x9b,0xb5,0xff,0x79,0x9a,0xb2,0xff,0x79,0x99,0xb0,0xff,0x7b,0x99,0xb0,0xff,0x88,0xac,0xc7,0xff,0x8e,0xbe,0xdb,0xff,0x85,0xaa,0xc8,0xff,0xa2,0xb8,0xd1,0xff,0xa8,0xc2,0xd8,0xff,0x92,0xb2,0xd4,0xff,0x5e,0x7e,0xa9,0xff,0x18,0x26,0x48,0xff,0x0b,0x11,0x2a,0xff,0x12,0x19,0x33,0xff,0x17,0x1e,0x3a,0xff,0x18,0x20,0x3c,0xff,0x12,0x1d,0x3a,0xff,0x4d,0x66,0x84,0xff,0x88,0xa7,0xc6,0xff,0x89,0xaa,0xcb,0xff,0x8b,0xae,0xce,0xff,0x85,0xa9,0xcc,0xff,0x82,0xa9,0xd1,0xff,0x83,0xaa,0xd4,0xff,0x82,0xac,0xd5,0xff,0x84,0xac,0xd5,0xff,0x85,0xad,0xd6,0xff,0x84,0xad,0xd7,0xff,0x83,0xab,0xd4,0xff,0x82,0xab,0xd2,0xff,0x80,0xad,0xd4,0xff,0x81,0xb4,0xda,0xff,0x83,0xbe,0xe4,0xff,0x7f,0xba,0xdb,0xff,0xa2,0xd5,0xee,0xff,0xa5,0xdd,0xf9,0xff,0x45,0x7b,0x9f,0xff,0x11,0x35,0x5a,0xff,0x1d,0x3e,0x60,0xff,0x16,0x3a,0x5d,0xff,0x38,0x66,0x8d,0xff,0x5c,0x97,0xc0,0xff,0x82,0xbd,0xde,0xff,0x9b,0xcd,0xe6,0xff,0x9a,0xcb,0xe4,0xff,0x9c,0xcd,0xe4,0xff,0x98,0xc6,0xdf,0xff,0x8f,0xb0,0xcb,0xff,0x91,0xbb,0xd4,0xff,0x9d,0xd1,0xe9,0xff,0x9f,0xcf,0xe8,0xff,0x9c,0xcf,0xe7,0xff,0x9c,0xcf,0xe7,0xff,0x9b,0xd1,0xea,0xff,0x7d,0xb5,0xdb,0xff,0x4c,0x7e,0xac,0xff,0x2c,0x4e,0x70,0xff,0x22,0x41,0x5f,0xff,0x2b,0x4c,0x6d,0xff,0x35,0x56,0x78,0xff,0x31,0x50,0x73,0xff,0x2c,0x4c,0x6f,0xff,0x1e,0x40,0x63,0xff,0x2b,0x4b,0x6f,0xff,0x32,0x52,0x76,0xff,0x2c,0x4f,0x75,0xff,0x40,0x66,0x8f,0xff,0x5e,0x92,0xbb,0xff,0x7d,0xb3,0xd2,0xff,0xa7,0xd1,0xea,0xff,0xa8,0xd1,0xe7,0xff,0xa6,0xd1,0xe8,0xff,0xa0,0xcc,0xe3,0xff,0x86,0xae,0xc5,0xff,0x87,0xaf,0xc6,0xff,0xa0,0xcc,0xe5,0xff,0x8e,0xbb,0xdb,0xff,0x70,0x9f,0xc0,0xff,0x78,0xa9,0xc8,0xff,0x7e,0xaf,0xce,0xff,0x82,0xb2,0xcf,0xff,0x96,0xc7,0xdf,0xff,0x9d,0xcd,0xe4,0xff,0x9a,0xc8,0xde,0xff,0x9a,0xc7,0xdf,0xff,0x94,0xc1,0xe4,0xff,0x3f,0x5f,0x83,0xff,0x22,0x38,0x56,0xff,0x3e,0x53,0x6f,0xff,0x1f,0x34,0x4c,0xff,0x2e,0x43,0x60,0xff,0x25,0x3c,0x5c,0xff,0x3f,0x64,0x84,0xff,0x70,0xa5,0xc3,0xff,0x68,0x9c,0xba,0xff,0x81,0xb5,0xd3,0xff,0x7c,0xae,0xcc,0xff,0x6a,0x9b,0xb9,0xff,0x68,0x99,0xb3,0xff,0x5a,0x8d,0xa6,0xff,0x6c,0xa1,0xbb,0xff,0x8f,0xc2,0xe8,0xff,0x51,0x7e,0xa7,0xff,0x22,0x43,0x63,0xff,0x41,0x71,0x96,0xff,0x80,0xb9,0xe1,0xff,0x4b,0x6e,0x95,0xff,0x2d,0x44,0x62,0xff,0x4a,0x73,0x8c,0xff,0x4a,0x78,0x90,0xff,0x4b,0x75,0x86,0xff,0x51,0x79,0x87,0xff,0x41,0x6b,0x81,0xff,0x34,0x60,0x79,0xff,0x2d,0x5a,0x71,0xff,0x25,0x55,0x6b,0xff,0x1a,0x49,0x5f,0xff,0x8b,0xa1,0xad,0xd0,0xff,0xff,0xff,0x03,0xff,0xfe,0xff,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xef,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xed,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x22,0xca,0xdc,0xee,0xf5,0x92,0xb6,0xd8,0xff,0x89,0xad,0xd2,0xff,0x88,0xae,0xd1,0xff,0x81,0xa8,0xc7,0xff,0x7a,0xa0,0xbc,0xff,0x95,0xb8,0xd1,0xff,0x90,0xad,0xc7,0xff,0xaa,0xc0,0xd5,0xff,0xb9,0xd0,0xe2,0xff,0x7e,0x98,0xb0,0xff,0x5c,0x7b,0x9c,0xff,0x77,0x96,0xb5,0xff,0x79,0x98,0xb4,0xff,0x76,0x98,0xb2,0xff,0x76,0x96,0xae,0xff,0x75,0x97,0xac,0xff,0x77,0x98,0xac,0xff,0x79,0x98,0xaf,0xff,0x7f,0xa0,0xb8,0xff,0xa6,0xc9,0xe0,0xff,0xae,0xcd,0xe4,0xff,0xb5,0xce,0xe4,0xff,0x8a,0xa8,0xc5,0xff,0x76,0x9a,0xbf,0xff,0x66,0x88,0xb2,0xff,0x1b,0x2c,0x4d,0xff,0x07,0x0e,0x28,0xff,0x15,0x1b,0x37,0xff,0x18,0x1e,0x3a,0xff,0x10,0x17,0x35,0xff,0x2e,0x3f,0x5a,0xff,0x83,0x9f,0xb9,0xff,0x8c,0xad,0xca,0xff,0x90,0xb0,0xce,0xff,0x8d,0xae,0xcb,0xff,0x87,0xaa,0xc8,0xff,0x83,0xa9,0xca,0xff,0x85,0xac,0xd0,0xff,0x85,0xac,0xd3,0xff,0x86,0xae,0xd3,0xff,0x85,0xac,0xce,0xff,0x83,0xa8,0xcb,0xff,0x85,0xac,0xcf,0xff,0x81,0xaf,0xd3,0xff,0x7e,0xb0,0xd4,0xff,0x85,0xb8,0xdb,0xff,0x78,0xaa,0xcd,0xff,0x8f,0xc3,0xdf,0xff,0xa4,0xd8,0xec,0xff,0x8d,0xc6,0xe7,0xff,0x26,0x56,0x7d,0xff,0x18,0x38,0x59,0xff,0x18,0x37,0x56,0xff,0x27,0x4a,0x6e,0xff,0x63,0x94,0xbe,0xff,0x4b,0x83,0xb0,0xff,0x70,0xa6,0xcb,0xff,0x9a,0xc9,0xe5,0xff,0x99,0xc9,0xe3,0xff,0x9b,0xcc,0xe4,0xff,0x95,0xc3,0xdc,0xff,0x90,0xb0,0xcb,0xff,0x91,0xb7,0xd1,0xff,0x9b,0xce,0xe8,0xff,0x96,0xc6,0xe1,0xff,0x9a,0xcc,0xe4,0xff,0x9d,0xce,0xe6,0xff,0x99,0xcd,0xec,0xff,0x6b,0xa5,0xcd,0xff,0x3b,0x66,0x90,0xff,0x22,0x42,0x60,0xff,0x26,0x46,0x64,0xff,0x30,0x51,0x78,0xff,0x31,0x4f,0x73,0xff,0x2a,0x46,0x66,0xff,0x22,0x41,0x5f,0xff,0x30,0x50,0x73,0xff,0x46,0x66,0x8e,0xff,0x25,0x4c,0x72,0xff,0x2b,0x4d,0x72,0xff,0x30,0x4b,0x73,0xff,0x3f,0x6a,0x91,0xff,0x61,0x98,0xbe,0xff,0x92,0xc1,0xe0,0xff,0xab,0xd4,0xe9,0xff,0xa7,0xd2,0xe7,0xff,0x93,0xb9,0xd0,0xff,0x87,0xa3,0xbc,0xff,0x85,0x9f,0xb9,0xff,0x9c,0xbd,0xd7,0xff,0x97,0xc8,0xe4,0xff,0x72,0xa6,0xc5,0xff,0x6f,0xa0,0xc0,0xff,0x75,0xa7,0xc4,0xff,0x81,0xb3,0xce,0xff,0x78,0xaa,0xc4,0xff,0x80,0xaf,0xc8,0xff,0x9e,0xca,0xe3,0xff,0xa5,0xd0,0xed,0xff,0x6e,0x96,0xbb,0xff,0x1b,0x34,0x55,0xff,0x2f,0x41,0x5f,0xff,0x31,0x45,0x60,0xff,0x20,0x34,0x4b,0xff,0x2c,0x41,0x5f,0xff,0x21,0x37,0x57,0xff,0x40,0x66,0x85,0xff,0x74,0xa9,0xc7,0xff,0x67,0x9a,0xb9,0xff,0x67,0x9b,0xb8,0xff,0x6a,0x9d,0xb9,0xff,0x60,0x8f,0xab,0xff,0x5d,0x8c,0xa7,0xff,0x55,0x86,0xa0,0xff,0x6a,0x9c,0xb7,0xff,0x8e,0xc1,0xe7,0xff,0x5a,0x8b,0xb6,0xff,0x27,0x47,0x67,0xff,0x30,0x59,0x7a,0xff,0x74,0xae,0xd5,0xff,0x67,0x93,0xba,0xff,0x22,0x3a,0x58,0xff,0x40,0x60,0x75,0xff,0x48,0x70,0x87,0xff,0x43,0x6d,0x82,0xff,0x43,0x6d,0x80,0xff,0x3b,0x65,0x7c,0xff,0x30,0x5b,0x72,0xff,0x27,0x53,0x67,0xff,0x20,0x4d,0x62,0xff,0x2d,0x57,0x6b,0xff,0xd2,0xdb,0xdf,0x76,0xff,0xff,0xff,0x00,0xfe,0xf6,0xf9,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xef,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfa,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xff,0xfb,0xfc,0x00,0xff,0xff,0xff,0x00,0xe0,0xea,0xf0,0xa4,0xa0,0xc0,0xd7,0xff,0x98,0xbb,0xd6,0xff,0x7d,0xa4,0xc0,0xff,0x83,0xa8,0xc4,0xff,0x6e,0x91,0xa9,0xff,0x99,0xbb,0xd1,0xff,0x77,0x9d,0xb7,0xff,0x6e,0x97,0xb3,0xff,0x98,0xb9,0xcd,0xff,0xae,0xc8,0xdc,0xff,0x72,0x92,0xad,0xff,0x74,0x94,0xb1,0xff,0x77,0x97,0xb2,0xff,0x74,0x96,0xae,0xff,0x76,0x97,0xae,0xff,0x76,0x98,0xac,0xff,0x78,0x9a,0xae,0xff,0x78,0x98,0xad,0xff,0x89,0xa6,0xba,0xff,0xb9,0xd7,0xeb,0xff,0x9d,0xc0,0xd9,0xff,0x6f,0x91,0xb0,0xff,0x4c,0x6b,0x98,0xff,0x7b,0x9e,0xc5,0xff,0x77,0x99,0xc0,0xff,0x2a,0x39,0x5a,0xff,0x0c,0x11,0x2b,0xff,0x1a,0x20,0x3c,0xff,0x11,0x18,0x35,0xff,0x24,0x32,0x50,0xff,0x71,0x8b,0xa4,0xff,0x8e,0xac,0xc3,0xff,0x76,0x97,0xb2,0xff,0x85,0xa9,0xc8,0xff,0x8e,0xad,0xcb,0xff,0x8a,0xa8,0xc2,0xff,0x83,0xa5,0xbf,0xff,0x84,0xa7,0xc9,0xff,0x85,0xae,0xd3,0xff,0x85,0xaf,0xd3,0xff,0x87,0xab,0xc9,0xff,0x84,0xa6,0xc2,0xff,0x87,0xad,0xcb,0xff,0x81,0xb1,0xd3,0xff,0x80,0xb3,0xd5,0xff,0x8b,0xb9,0xde,0xff,0x84,0xa8,0xc7,0xff,0xa7,0xc9,0xe3,0xff,0x94,0xc5,0xe1,0xff,0x78,0xaf,0xd9,0xff,0x34,0x64,0x8c,0xff,0x1b,0x3d,0x5d,0xff,0x22,0x3d,0x60,0xff,0x31,0x54,0x78,0xff,0x78,0xaa,0xd2,0xff,0x4e,0x7e,0xac,0xff,0x58,0x8a,0xb3,0xff,0x91,0xc0,0xe0,0xff,0x99,0xca,0xe4,0xff,0x96,0xc5,0xdd,0xff,0x90,0xbb,0xd3,0xff,0x95,0xb7,0xd2,0xff,0x92,0xb8,0xd3,0xff,0x98,0xca,0xe5,0xff,0x92,0xbf,0xdb,0xff,0x98,0xc5,0xe1,0xff,0x9a,0xc9,0xe2,0xff,0x8f,0xc5,0xe7,0xff,0x54,0x8b,0xb6,0xff,0x22,0x47,0x6e,0xff,0x1b,0x39,0x56,0xff,0x25,0x44,0x65,0xff,0x38,0x58,0x82,0xff,0x26,0x42,0x66,0xff,0x1f,0x38,0x57,0xff,0x1e,0x39,0x59,0xff,0x2f,0x48,0x73,0xff,0x54,0x73,0xa5,0xff,0x32,0x58,0x87,0xff,0x27,0x48,0x70,0xff,0x2d,0x48,0x6c,0xff,0x2c,0x46,0x6f,0xff,0x45,0x70,0x9b,0xff,0x6a,0xa0,0xc8,0xff,0xa1,0xcd,0xeb,0xff,0xa0,0xc3,0xdb,0xff,0x8d,0xaa,0xc3,0xff,0x8a,0xa9,0xc2,0xff,0x8a,0xa6,0xbf,0xff,0x9a,0xb8,0xd4,0xff,0x8b,0xbf,0xdd,0xff,0x6e,0xa5,0xc5,0xff,0x75,0xa8,0xc7,0xff,0x77,0xa9,0xc4,0xff,0x6f,0xa0,0xb8,0xff,0x49,0x79,0x90,0xff,0x4e,0x7c,0x92,0xff,0x95,0xc1,0xdd,0xff,0x8d,0xbd,0xe1,0xff,0x32,0x52,0x78,0xff,0x1b,0x28,0x40,0xff,0x22,0x30,0x46,0xff,0x22,0x31,0x49,0xff,0x24,0x35,0x4f,0xff,0x1e,0x2e,0x4c,0xff,0x2a,0x48,0x67,0xff,0x76,0xa8,0xc8,0xff,0x6f,0xa4,0xc4,0xff,0x68,0x9a,0xba,0xff,0x5e,0x91,0xaf,0xff,0x58,0x8b,0xa6,0xff,0x58,0x89,0xa2,0xff,0x53,0x82,0x9b,0xff,0x50,0x80,0x99,0xff,0x5f,0x8e,0xa8,0xff,0x8b,0xbd,0xe0,0xff,0x69,0xa1,0xca,0xff,0x37,0x5d,0x80,0xff,0x26,0x44,0x66,0xff,0x61,0x96,0xbb,0xff,0x7c,0xb0,0xd7,0xff,0x42,0x5d,0x7e,0xff,0x2a,0x3d,0x52,0xff,0x3e,0x61,0x73,0xff,0x41,0x6c,0x80,0xff,0x3d,0x66,0x7c,0xff,0x38,0x60,0x77,0xff,0x2c,0x57,0x6c,0xff,0x25,0x50,0x63,0xff,0x18,0x43,0x58,0xff,0x67,0x84,0x92,0xee,0xfd,0xfe,0xfe,0x1c,0xff,0xff,0xff,0x00,0xfe,0xed,0xf4,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xef,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xfa,0xfc,0xfc,0x44,0xc3,0xdc,0xe5,0xff,0xa5,0xc6,0xd4,0xff,0x9e,0xc0,0xd0,0xff,0x96,0xba,0xcb,0xff,0x8d,0xb0,0xc2,0xff,0x92,0xb4,0xc7,0xff,0x75,0x9e,0xb3,0xff,0x65,0x90,0xad,0xff,0x7c,0x9e,0xbb,0xff,0xa8,0xc3,0xdd,0xff,0x9c,0xb9,0xcf,0xff,0x76,0x97,0xad,0xff,0x77,0x99,0xb0,0xff,0x76,0x97,0xad,0xff,0x77,0x99,0xad,0xff,0x78,0x9b,0xae,0xff,0x79,0x9b,0xaf,0xff,0x7f,0x9f,0xb3,0xff,0x7d,0x94,0xb3,0xff,0x59,0x78,0x9d,0xff,0x31,0x4c,0x73,0xff,0x27,0x3c,0x64,0xff,0x29,0x45,0x74,0xff,0x8d,0xae,0xd6,0xff,0x73,0x94,0xb9,0xff,0x12,0x1e,0x3d,0xff,0x10,0x15,0x2e,0xff,0x13,0x1a,0x36,0xff,0x38,0x4b,0x67,0xff,0x77,0x98,0xb2,0xff,0x75,0x95,0xad,0xff,0x79,0x99,0xae,0xff,0x72,0x94,0xac,0xff,0x81,0xa6,0xc5,0xff,0x8e,0xad,0xcc,0xff,0x89,0xa7,0xc2,0xff,0x83,0xa3,0xbb,0xff,0x84,0xa1,0xc0,0xff,0x86,0xa8,0xc9,0xff,0x84,0xac,0xcd,0xff,0x85,0xa9,0xc7,0xff,0x86,0xa7,0xc3,0xff,0x83,0xab,0xc8,0xff,0x7c,0xad,0xcd,0xff,0x81,0xb5,0xd7,0xff,0x8d,0xb8,0xda,0xff,0xa8,0xc1,0xda,0xff,0xa1,0xbd,0xd4,0xff,0x89,0xb8,0xd5,0xff,0x75,0xa6,0xd0,0xff,0x2a,0x52,0x79,0xff,0x1f,0x3d,0x5e,0xff,0x20,0x38,0x5c,0xff,0x2f,0x52,0x75,0xff,0x7f,0xb3,0xd6,0xff,0x56,0x86,0xb2,0xff,0x47,0x76,0xa1,0xff,0x7b,0xab,0xcf,0xff,0x99,0xc8,0xe1,0xff,0x8b,0xb4,0xcc,0xff,0x92,0xbd,0xd6,0xff,0x92,0xb6,0xd0,0xff,0x94,0xbc,0xd6,0xff,0x95,0xc9,0xe3,0xff,0x93,0xbd,0xda,0xff,0x94,0xbd,0xdb,0xff,0x9a,0xc9,0xe4,0xff,0x83,0xb9,0xdc,0xff,0x31,0x5d,0x85,0xff,0x13,0x2f,0x51,0xff,0x19,0x35,0x54,0xff,0x2a,0x47,0x6c,0xff,0x3c,0x5a,0x85,0xff,0x21,0x3c,0x61,0xff,0x18,0x30,0x4f,0xff,0x1c,0x31,0x53,0xff,0x1a,0x2e,0x59,0xff,0x3d,0x5e,0x8f,0xff,0x48,0x71,0xa2,0xff,0x26,0x48,0x72,0xff,0x2c,0x4a,0x6e,0xff,0x29,0x41,0x69,0xff,0x2d,0x4d,0x74,0xff,0x45,0x77,0x9d,0xff,0x6f,0xa1,0xc5,0xff,0x94,0xb2,0xcd,0xff,0x94,0xaf,0xc8,0xff,0x8f,0xae,0xc6,0xff,0x8d,0xaa,0xc3,0xff,0x96,0xb6,0xd2,0xff,0x7f,0xac,0xcf,0xff,0x62,0x94,0xb6,0xff,0x6a,0x99,0xb8,0xff,0x4f,0x7e,0x96,0xff,0x36,0x68,0x7c,0xff,0x44,0x73,0x88,0xff,0x44,0x71,0x85,0xff,0x60,0x8d,0xa8,0xff,0x6d,0x9f,0xc9,0xff,0x48,0x6a,0x93,0xff,0x1f,0x2f,0x4a,0xff,0x1c,0x37,0x4d,0xff,0x18,0x31,0x4a,0xff,0x16,0x27,0x41,0xff,0x28,0x3f,0x5a,0xff,0x73,0xa2,0xc1,0xff,0x7d,0xb3,0xd2,0xff,0x70,0xa4,0xc4,0xff,0x68,0x9c,0xbd,0xff,0x61,0x94,0xb2,0xff,0x54,0x85,0xa1,0xff,0x56,0x87,0xa0,0xff,0x51,0x80,0x9a,0xff,0x48,0x76,0x8e,0xff,0x47,0x74,0x8c,0xff,0x82,0xb3,0xd4,0xff,0x7e,0xb2,0xdc,0xff,0x4f,0x79,0xa1,0xff,0x25,0x41,0x67,0xff,0x4a,0x7a,0x9f,0xff,0x84,0xb9,0xe3,0xff,0x4d,0x69,0x8d,0xff,0x25,0x34,0x4a,0xff,0x3a,0x5c,0x70,0xff,0x3c,0x62,0x77,0xff,0x38,0x5f,0x73,0xff,0x32,0x5b,0x6f,0xff,0x28,0x52,0x65,0xff,0x1d,0x47,0x58,0xff,0x20,0x45,0x57,0xff,0xbd,0xc6,0xcd,0xa0,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfe,0xf0,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xea,0xf1,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xda,0xe7,0xeb,0xc2,0x8e,0xb4,0xc0,0xff,0x8c,0xb3,0xc3,0xff,0x7b,0xa1,0xb5,0xff,0x78,0x9f,0xb3,0xff,0x7b,0xa3,0xb7,0xff,0x6a,0x94,0xac,0xff,0x64,0x8c,0xab,0xff,0x72,0x97,0xb7,0xff,0x89,0xaa,0xc7,0xff,0xb2,0xcd,0xdf,0xff,0x8e,0xac,0xbe,0xff,0x77,0x98,0xac,0xff,0x78,0x9b,0xaf,0xff,0x86,0xa7,0xbd,0xff,0x82,0xa4,0xba,0xff,0x7b,0x9c,0xb2,0xff,0x7d,0x9b,0xb2,0xff,0x34,0x46,0x65,0xff,0x14,0x28,0x4e,0xff,0x24,0x3a,0x64,0xff,0x19,0x2d,0x58,0xff,0x3f,0x57,0x81,0xff,0x9d,0xc0,0xe6,0xff,0x51,0x6e,0x93,0xff,0x05,0x0d,0x28,0xff,0x10,0x14,0x2f,0xff,0x23,0x32,0x50,0xff,0x70,0x8f,0xa9,0xff,0x7d,0x9f,0xb7,0xff,0x7c,0x9c,0xb3,0xff,0x78,0x98,0xae,0xff,0x74,0x96,0xaa,0xff,0x7b,0x9f,0xb5,0xff,0x8e,0xac,0xcb,0xff,0x83,0xa4,0xc1,0xff,0x79,0x9b,0xb2,0xff,0x7e,0x9e,0xb6,0xff,0x81,0xa0,0xba,0xff,0x81,0xa6,0xc6,0xff,0x84,0xa8,0xc7,0xff,0x86,0xa7,0xc3,0xff,0x80,0xa3,0xc1,0xff,0x7a,0xa6,0xc5,0xff,0x89,0xb9,0xd8,0xff,0x99,0xbf,0xda,0xff,0xb0,0xc8,0xde,0xff,0x91,0xb2,0xc9,0xff,0x7d,0xa9,0xc7,0xff,0x71,0xa5,0xcd,0xff,0x26,0x4c,0x72,0xff,0x16,0x2f,0x4e,0xff,0x1b,0x32,0x55,0xff,0x25,0x45,0x68,0xff,0x7e,0xae,0xce,0xff,0x62,0x92,0xbb,0xff,0x41,0x6e,0x9c,0xff,0x62,0x92,0xbb,0xff,0x8e,0xbd,0xd8,0xff,0x90,0xb2,0xcb,0xff,0x94,0xbb,0xd5,0xff,0x8f,0xb1,0xcc,0xff,0x93,0xb5,0xcf,0xff,0x97,0xc7,0xe0,0xff,0x96,0xbf,0xdb,0xff,0x93,0xbb,0xd6,0xff,0x9c,0xcd,0xe8,0xff,0x70,0x9f,0xc4,0xff,0x1b,0x3f,0x63,0xff,0x16,0x2e,0x50,0xff,0x1d,0x36,0x59,0xff,0x35,0x55,0x7a,0xff,0x2f,0x51,0x7a,0xff,0x22,0x3c,0x60,0xff,0x1b,0x30,0x51,0xff,0x13,0x23,0x47,0xff,0x1b,0x29,0x50,0xff,0x27,0x40,0x69,0xff,0x4b,0x75,0xa6,0xff,0x2b,0x53,0x7f,0xff,0x2a,0x47,0x6e,0xff,0x2d,0x46,0x6d,0xff,0x25,0x3d,0x63,0xff,0x24,0x49,0x6f,0xff,0x3f,0x64,0x8d,0xff,0x78,0x98,0xba,0xff,0x98,0xb9,0xd2,0xff,0x95,0xb2,0xcb,0xff,0x92,0xaf,0xc7,0xff,0x96,0xb5,0xce,0xff,0x7a,0xa2,0xc4,0xff,0x57,0x83,0xa6,0xff,0x30,0x5a,0x79,0xff,0x27,0x4d,0x62,0xff,0x2c,0x54,0x68,0xff,0x30,0x58,0x6d,0xff,0x34,0x5a,0x6f,0xff,0x39,0x62,0x7b,0xff,0x5b,0x8b,0xb5,0xff,0x47,0x66,0x93,0xff,0x20,0x32,0x55,0xff,0x0c,0x26,0x43,0xff,0x07,0x1f,0x36,0xff,0x22,0x3b,0x53,0xff,0x7a,0xa5,0xbf,0xff,0x77,0xa7,0xca,0xff,0x53,0x85,0xa4,0xff,0x50,0x85,0x9f,0xff,0x5a,0x8b,0xa8,0xff,0x58,0x87,0xa6,0xff,0x56,0x86,0xa2,0xff,0x5b,0x89,0xa5,0xff,0x51,0x7f,0x9b,0xff,0x4d,0x79,0x93,0xff,0x46,0x75,0x8d,0xff,0x71,0xa6,0xc5,0xff,0x87,0xbc,0xe5,0xff,0x5f,0x91,0xbb,0xff,0x2e,0x51,0x79,0xff,0x3a,0x64,0x8a,0xff,0x7d,0xb4,0xdc,0xff,0x47,0x67,0x89,0xff,0x27,0x3c,0x52,0xff,0x3b,0x60,0x74,0xff,0x39,0x5d,0x70,0xff,0x33,0x58,0x6a,0xff,0x2e,0x55,0x65,0xff,0x24,0x48,0x5a,0xff,0x13,0x39,0x4b,0xff,0x58,0x72,0x7f,0xfd,0xfa,0xfa,0xfb,0x36,0xff,0xff,0xff,0x00,0xfe,0xf1,0xf6,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfe,0xf0,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xf3,0xf8,0xf9,0x51,0x8b,0xb1,0xbe,0xff,0x74,0xa1,0xb3,0xff,0x65,0x8d,0xa2,0xff,0x65,0x88,0x9e,0xff,0x7c,0xa2,0xb8,0xff,0x7a,0x9f,0xb7,0xff,0x7c,0xa0,0xba,0xff,0x8a,0xac,0xcc,0xff,0x82,0xa7,0xc3,0xff,0xa4,0xc5,0xd9,0xff,0xa6,0xc3,0xd9,0xff,0x7c,0x9e,0xb4,0xff,0x79,0x9d,0xb2,0xff,0x88,0xaa,0xc1,0xff,0x8d,0xaf,0xc6,0xff,0x7f,0xa0,0xb6,0xff,0x78,0x97,0xaf,0xff,0x77,0x95,0xab,0xff,0x3e,0x52,0x6e,0xff,0x29,0x39,0x63,0xff,0x2f,0x44,0x73,0xff,0x77,0x8f,0xb7,0xff,0x94,0xba,0xdc,0xff,0x3a,0x56,0x7c,0xff,0x0a,0x0d,0x29,0xff,0x0f,0x12,0x30,0xff,0x4f,0x68,0x89,0xff,0x8b,0xb0,0xca,0xff,0x79,0x9a,0xb4,0xff,0x76,0x97,0xae,0xff,0x73,0x95,0xaa,0xff,0x78,0x9a,0xae,0xff,0x7c,0x9d,0xb1,0xff,0x93,0xb3,0xcd,0xff,0x97,0xbb,0xd3,0xff,0x94,0xb6,0xc9,0xff,0x8e,0xad,0xbf,0xff,0x7b,0x9e,0xb5,0xff,0x7c,0xa3,0xc3,0xff,0x83,0xa7,0xc7,0xff,0x84,0xa6,0xc2,0xff,0x79,0x9b,0xb7,0xff,0x7d,0xa3,0xc0,0xff,0x94,0xb8,0xd6,0xff,0xa9,0xc6,0xdc,0xff,0x9e,0xc0,0xd6,0xff,0x84,0xb0,0xc9,0xff,0x65,0x92,0xb0,0xff,0x6a,0x9f,0xc9,0xff,0x42,0x6b,0x91,0xff,0x10,0x23,0x42,0xff,0x19,0x29,0x4c,0xff,0x18,0x30,0x53,0xff,0x6e,0x96,0xb5,0xff,0x72,0xa0,0xc8,0xff,0x3c,0x64,0x93,0xff,0x48,0x74,0xa2,0xff,0x7c,0xa8,0xcc,0xff,0x9c,0xb8,0xd2,0xff,0x9e,0xc0,0xd7,0xff,0xa1,0xc3,0xda,0xff,0x98,0xb6,0xce,0xff,0x9c,0xc4,0xde,0xff,0x98,0xc0,0xdc,0xff,0x96,0xbc,0xd9,0xff,0x9a,0xca,0xe9,0xff,0x4d,0x79,0x9e,0xff,0x16,0x36,0x5a,0xff,0x17,0x2d,0x51,0xff,0x20,0x36,0x5b,0xff,0x38,0x59,0x7e,0xff,0x61,0x86,0xaa,0xff,0x26,0x40,0x63,0xff,0x1b,0x2f,0x52,0xff,0x15,0x21,0x46,0xff,0x1b,0x24,0x48,0xff,0x1b,0x28,0x50,0xff,0x39,0x5b,0x8b,0xff,0x41,0x69,0x99,0xff,0x2c,0x49,0x73,0xff,0x2f,0x48,0x70,0xff,0x1e,0x34,0x59,0xff,0x18,0x27,0x50,0xff,0x24,0x36,0x61,0xff,0x4c,0x6d,0x9a,0xff,0x8d,0xaf,0xd0,0xff,0x98,0xb6,0xcf,0xff,0x95,0xb3,0xcb,0xff,0x98,0xb7,0xd1,0xff,0x7b,0xa0,0xbe,0xff,0x5a,0x82,0xa4,0xff,0x4c,0x72,0x94,0xff,0x32,0x4e,0x65,0xff,0x2f,0x44,0x59,0xff,0x35,0x4b,0x5f,0xff,0x38,0x51,0x67,0xff,0x43,0x62,0x7e,0xff,0x58,0x81,0xab,0xff,0x28,0x42,0x6f,0xff,0x19,0x27,0x4b,0xff,0x0a,0x19,0x3b,0xff,0x08,0x17,0x31,0xff,0x4e,0x6f,0x89,0xff,0x8a,0xbd,0xd7,0xff,0x5f,0x8a,0xac,0xff,0x4b,0x74,0x95,0xff,0x3f,0x69,0x86,0xff,0x38,0x62,0x7f,0xff,0x42,0x6b,0x88,0xff,0x52,0x80,0x9f,0xff,0x5a,0x8a,0xaa,0xff,0x53,0x7d,0x9c,0xff,0x40,0x6a,0x83,0xff,0x36,0x65,0x7b,0xff,0x53,0x82,0xa2,0xff,0x8d,0xbd,0xe7,0xff,0x74,0xad,0xda,0xff,0x38,0x67,0x92,0xff,0x25,0x47,0x70,0xff,0x6b,0x9b,0xc3,0xff,0x5b,0x7f,0xa1,0xff,0x31,0x4d,0x62,0xff,0x3d,0x62,0x75,0xff,0x39,0x5c,0x70,0xff,0x31,0x54,0x66,0xff,0x28,0x49,0x5b,0xff,0x1c,0x37,0x49,0xff,0x1e,0x39,0x4b,0xff,0xb2,0xbc,0xc3,0xac,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xeb,0xf2,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x02,0xbe,0xd3,0xdb,0xca,0x60,0x8f,0xa2,0xff,0x88,0xaa,0xbf,0xff,0xba,0xd1,0xe3,0xff,0xb8,0xd2,0xde,0xff,0xc0,0xdb,0xe6,0xff,0xa4,0xc0,0xcf,0xff,0x5c,0x75,0x95,0xff,0x6a,0x86,0xac,0xff,0x8c,0xaa,0xcb,0xff,0xaf,0xcd,0xe7,0xff,0x88,0xaa,0xc2,0xff,0x77,0x9c,0xb5,0xff,0x7d,0x9f,0xb8,0xff,0x81,0xa1,0xba,0xff,0x8e,0xae,0xc5,0xff,0x78,0x9a,0xb0,0xff,0x7a,0x9a,0xb2,0xff,0x84,0xa1,0xbd,0xff,0x5f,0x79,0x99,0xff,0x30,0x48,0x6f,0xff,0x98,0xb7,0xd7,0xff,0x7b,0xa2,0xc5,0xff,0x1e,0x31,0x52,0xff,0x06,0x0a,0x1f,0xff,0x1e,0x2a,0x48,0xff,0x5c,0x80,0xa9,0xff,0x7b,0xa4,0xc8,0xff,0x84,0xa5,0xc3,0xff,0x73,0x95,0xae,0xff,0x88,0xab,0xc2,0xff,0x95,0xb7,0xcf,0xff,0x9f,0xbe,0xd8,0xff,0x93,0xb2,0xcf,0xff,0x93,0xb4,0xd2,0xff,0x9c,0xba,0xd1,0xff,0xb0,0xca,0xdc,0xff,0xa7,0xc7,0xdf,0xff,0x89,0xae,0xcf,0xff,0x7f,0xa5,0xc4,0xff,0x82,0xa7,0xc2,0xff,0x77,0x9a,0xb5,0xff,0x84,0xa8,0xc3,0xff,0xa3,0xc4,0xde,0xff,0xa3,0xc0,0xd5,0xff,0x81,0xa7,0xc0,0xff,0x70,0x9d,0xbf,0xff,0x58,0x82,0xab,0xff,0x71,0x97,0xc3,0xff,0x67,0x8d,0xb3,0xff,0x0e,0x22,0x42,0xff,0x13,0x20,0x41,0xff,0x14,0x22,0x45,0xff,0x4d,0x6e,0x8d,0xff,0x7d,0xad,0xd3,0xff,0x41,0x68,0x97,0xff,0x34,0x57,0x86,0xff,0x66,0x8a,0xb3,0xff,0x91,0xb2,0xd3,0xff,0xa0,0xc4,0xe0,0xff,0xa7,0xc9,0xe4,0xff,0xa6,0xc6,0xe2,0xff,0x92,0xb8,0xd4,0xff,0x98,0xc0,0xdb,0xff,0x9f,0xc4,0xe2,0xff,0x87,0xb4,0xda,0xff,0x33,0x5f,0x85,0xff,0x16,0x34,0x54,0xff,0x19,0x2d,0x50,0xff,0x1e,0x33,0x59,0xff,0x3a,0x59,0x7d,0xff,0x9c,0xc5,0xe4,0xff,0x57,0x7b,0x9b,0xff,0x14,0x2a,0x4f,0xff,0x19,0x23,0x48,0xff,0x19,0x22,0x43,0xff,0x1b,0x27,0x4b,0xff,0x24,0x40,0x6e,0xff,0x46,0x69,0x9b,0xff,0x37,0x56,0x82,0xff,0x23,0x3a,0x63,0xff,0x20,0x30,0x58,0xff,0x1b,0x27,0x4f,0xff,0x1a,0x28,0x51,0xff,0x33,0x4e,0x7c,0xff,0x6c,0x8e,0xb7,0xff,0x98,0xb6,0xd1,0xff,0x95,0xb5,0xcd,0xff,0x97,0xb6,0xd1,0xff,0x88,0xaa,0xc6,0xff,0x61,0x85,0xa7,0xff,0x53,0x77,0x9c,0xff,0x38,0x57,0x70,0xff,0x32,0x4e,0x63,0xff,0x51,0x6e,0x8a,0xff,0x6a,0x89,0xa9,0xff,0x97,0xb6,0xd5,0xff,0x6e,0x92,0xbb,0xff,0x23,0x3b,0x67,0xff,0x17,0x23,0x47,0xff,0x0c,0x17,0x3b,0xff,0x12,0x20,0x3d,0xff,0x50,0x71,0x8e,0xff,0xa7,0xd8,0xf2,0xff,0x9c,0xc9,0xe6,0xff,0x9a,0xc6,0xea,0xff,0x7f,0xa4,0xce,0xff,0x5a,0x83,0xaf,0xff,0x5f,0x95,0xc2,0xff,0x4a,0x75,0x9e,0xff,0x25,0x4a,0x6f,0xff,0x21,0x3d,0x5d,0xff,0x12,0x29,0x42,0xff,0x10,0x2a,0x3f,0xff,0x11,0x27,0x42,0xff,0x2d,0x49,0x6c,0xff,0x58,0x82,0xac,0xff,0x53,0x7a,0xa7,0xff,0x17,0x30,0x5a,0xff,0x40,0x60,0x88,0xff,0x6c,0x90,0xb4,0xff,0x37,0x5b,0x72,0xff,0x37,0x5c,0x6f,0xff,0x36,0x5b,0x6d,0xff,0x31,0x53,0x65,0xff,0x27,0x46,0x58,0xff,0x18,0x35,0x49,0xff,0x57,0x6b,0x79,0xff,0xf4,0xf6,0xf6,0x3d,0xff,0xff,0xff,0x00,0xfe,0xf2,0xf7,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfb,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xf3,0xf7,0xf8,0x54,0x77,0x9a,0xab,0xff,0x8b,0xaa,0xc0,0xff,0xb5,0xd0,0xdc,0xff,0xb8,0xd4,0xdf,0xff,0x88,0xa1,0xb6,0xff,0x2a,0x3e,0x60,0xff,0x27,0x38,0x5a,0xff,0x4f,0x63,0x85,0xff,0x43,0x60,0x8a,0xff,0x98,0xb9,0xd6,0xff,0x90,0xb3,0xcd,0xff,0x65,0x89,0xa3,0xff,0x5f,0x83,0x9b,0xff,0x5b,0x7e,0x96,0xff,0x7a,0x9d,0xb5,0xff,0x86,0xa7,0xc0,0xff,0x79,0x9a,0xb3,0xff,0x90,0xb3,0xce,0xff,0x7f,0xa6,0xc1,0xff,0x89,0xa7,0xc3,0xff,0xa8,0xca,0xe9,0xff,0x46,0x63,0x85,0xff,0x07,0x0c,0x25,0xff,0x10,0x13,0x2a,0xff,0x27,0x32,0x53,0xff,0x43,0x62,0x8f,0xff,0x5e,0x85,0xb2,0xff,0x82,0xa8,0xc8,0xff,0x9c,0xbf,0xd8,0xff,0x85,0xa8,0xc3,0xff,0x70,0x93,0xaf,0xff,0x62,0x84,0xa2,0xff,0x6a,0x8b,0xa9,0xff,0x56,0x77,0x95,0xff,0x43,0x62,0x7d,0xff,0x4c,0x6b,0x83,0xff,0x7b,0x9d,0xba,0xff,0x90,0xb4,0xd6,0xff,0x88,0xad,0xcc,0xff,0x7d,0xa1,0xbd,0xff,0x76,0x99,0xb3,0xff,0x99,0xbb,0xd4,0xff,0xad,0xcf,0xe6,0xff,0x89,0xae,0xc3,0xff,0x65,0x8d,0xab,0xff,0x54,0x7b,0xa8,0xff,0x54,0x7b,0xaa,0xff,0x7b,0x9b,0xbf,0xff,0x79,0x9c,0xc0,0xff,0x17,0x2a,0x4b,0xff,0x11,0x1e,0x3c,0xff,0x11,0x1b,0x3c,0xff,0x29,0x42,0x64,0xff,0x7c,0xab,0xcf,0xff,0x58,0x81,0xa9,0xff,0x35,0x50,0x7e,0xff,0x56,0x76,0xa4,0xff,0x71,0x9c,0xc0,0xff,0x5d,0x86,0xa4,0xff,0x71,0x95,0xb6,0xff,0x87,0xaa,0xc9,0xff,0x75,0x9a,0xb6,0xff,0x6f,0x97,0xb2,0xff,0x90,0xb8,0xd7,0xff,0x74,0x9c,0xc9,0xff,0x2d,0x51,0x79,0xff,0x15,0x2e,0x4a,0xff,0x1a,0x29,0x4a,0xff,0x1c,0x2f,0x51,0xff,0x49,0x65,0x84,0xff,0x9b,0xbf,0xda,0xff,0x92,0xba,0xd8,0xff,0x34,0x54,0x76,0xff,0x17,0x22,0x46,0xff,0x16,0x1f,0x3e,0xff,0x1b,0x29,0x47,0xff,0x1d,0x31,0x58,0xff,0x33,0x4e,0x7a,0xff,0x48,0x66,0x92,0xff,0x23,0x39,0x63,0xff,0x25,0x32,0x5d,0xff,0x1e,0x2b,0x53,0xff,0x1f,0x2a,0x51,0xff,0x1e,0x32,0x5b,0xff,0x49,0x69,0x95,0xff,0x85,0xa8,0xc4,0xff,0x98,0xba,0xce,0xff,0x95,0xb6,0xcd,0xff,0x88,0xa9,0xc5,0xff,0x69,0x8b,0xac,0xff,0x55,0x77,0x9a,0xff,0x58,0x78,0x96,0xff,0x45,0x68,0x82,0xff,0x69,0x8e,0xab,0xff,0x79,0x9b,0xbd,0xff,0x71,0x8d,0xae,0xff,0x70,0x90,0xbc,0xff,0x31,0x4c,0x7b,0xff,0x0b,0x15,0x39,0xff,0x12,0x1a,0x3c,0xff,0x1a,0x26,0x4a,0xff,0x50,0x72,0x94,0xff,0xa4,0xd4,0xf3,0xff,0x97,0xc3,0xe6,0xff,0x69,0x8b,0xb4,0xff,0x37,0x51,0x7e,0xff,0x45,0x67,0x98,0xff,0x3a,0x59,0x83,0xff,0x10,0x1e,0x37,0xff,0x0b,0x17,0x2b,0xff,0x06,0x10,0x26,0xff,0x08,0x10,0x22,0xff,0x07,0x16,0x25,0xff,0x02,0x0d,0x1d,0xff,0x00,0x03,0x12,0xff,0x04,0x0c,0x1d,0xff,0x28,0x3c,0x57,0xff,0x2c,0x43,0x63,0xff,0x26,0x3e,0x64,0xff,0x6c,0x91,0xb7,0xff,0x41,0x69,0x85,0xff,0x30,0x54,0x67,0xff,0x37,0x5a,0x6a,0xff,0x33,0x56,0x67,0xff,0x2a,0x46,0x5a,0xff,0x26,0x40,0x55,0xff,0xb6,0xbf,0xc7,0xad,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfb,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xeb,0xf3,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x00,0xb8,0xc7,0xd0,0xc2,0x86,0xa7,0xbd,0xff,0xa1,0xc1,0xd2,0xff,0x5f,0x74,0x8d,0xff,0x1d,0x29,0x4b,0xff,0x1e,0x2c,0x55,0xff,0x5a,0x6c,0x8e,0xff,0x33,0x44,0x63,0xff,0x57,0x77,0xa0,0xff,0x92,0xb5,0xd5,0xff,0x9e,0xc0,0xd8,0xff,0x72,0x95,0xae,0xff,0x5d,0x80,0x97,0xff,0x61,0x84,0x9b,0xff,0x62,0x83,0x9b,0xff,0x72,0x92,0xac,0xff,0x5d,0x80,0x9b,0xff,0x6a,0x8e,0xac,0xff,0x6d,0x91,0xad,0xff,0xae,0xcb,0xe1,0xff,0x88,0xa7,0xc1,0xff,0x0c,0x15,0x2e,0xff,0x0b,0x09,0x1e,0xff,0x1b,0x1f,0x3b,0xff,0x2e,0x3a,0x5e,0xff,0x29,0x38,0x63,0xff,0x46,0x61,0x8e,0xff,0x65,0x8b,0xb0,0xff,0x93,0xb6,0xd5,0xff,0x7e,0x9f,0xbd,0xff,0x5d,0x7e,0x9a,0xff,0x47,0x68,0x84,0xff,0x48,0x66,0x7f,0xff,0x39,0x51,0x68,0xff,0x3d,0x57,0x6b,0xff,0x36,0x52,0x67,0xff,0x3c,0x5b,0x77,0xff,0x59,0x7b,0x9b,0xff,0x7a,0xa0,0xbf,0xff,0x7c,0xa0,0xbe,0xff,0x78,0x99,0xb3,0xff,0xaa,0xca,0xe2,0xff,0x9f,0xc0,0xd6,0xff,0x7e,0xa2,0xba,0xff,0x5c,0x7e,0xa4,0xff,0x47,0x67,0x97,0xff,0x5d,0x81,0xa7,0xff,0x7c,0x9e,0xba,0xff,0x7f,0xa4,0xc5,0xff,0x1e,0x31,0x52,0xff,0x13,0x20,0x3d,0xff,0x0f,0x19,0x3a,0xff,0x14,0x26,0x48,0xff,0x66,0x8d,0xb3,0xff,0x67,0x8d,0xb6,0xff,0x37,0x51,0x7d,0xff,0x52,0x73,0x9f,0xff,0x67,0x8c,0xb1,0xff,0x4c,0x72,0x8f,0xff,0x55,0x7c,0x97,0xff,0x4d,0x6f,0x8c,0xff,0x42,0x61,0x7b,0xff,0x5a,0x7f,0x9b,0xff,0x87,0xaf,0xd1,0xff,0x64,0x85,0xb3,0xff,0x27,0x3f,0x66,0xff,0x16,0x25,0x43,0xff,0x1a,0x23,0x45,0xff,0x1f,0x2f,0x50,0xff,0x67,0x80,0x9d,0xff,0xa3,0xc0,0xd7,0xff,0x9c,0xbd,0xd5,0xff,0x6d,0x95,0xb0,0xff,0x14,0x29,0x4b,0xff,0x13,0x1c,0x3b,0xff,0x19,0x23,0x44,0xff,0x1c,0x28,0x4c,0xff,0x23,0x32,0x5a,0xff,0x45,0x61,0x8b,0xff,0x40,0x58,0x85,0xff,0x22,0x2e,0x5b,0xff,0x21,0x2d,0x55,0xff,0x1d,0x28,0x4e,0xff,0x19,0x23,0x49,0xff,0x38,0x52,0x7a,0xff,0x68,0x8e,0xb2,0xff,0x98,0xb9,0xd1,0xff,0x91,0xb0,0xc9,0xff,0x8e,0xb0,0xc6,0xff,0x6f,0x8f,0xaf,0xff,0x7e,0x9c,0xbe,0xff,0x60,0x7a,0x9f,0xff,0x62,0x80,0xa6,0xff,0x4d,0x6b,0x92,0xff,0x76,0x93,0xb9,0xff,0x31,0x45,0x68,0xff,0x45,0x5d,0x8b,0xff,0x2f,0x46,0x7a,0xff,0x12,0x1c,0x42,0xff,0x1a,0x20,0x42,0xff,0x18,0x26,0x4a,0xff,0x4f,0x71,0x95,0xff,0x8f,0xba,0xe3,0xff,0x4c,0x71,0xa0,0xff,0x09,0x19,0x3a,0xff,0x20,0x2a,0x46,0xff,0x31,0x44,0x5d,0xff,0x0c,0x11,0x1f,0xff,0x00,0x00,0x09,0xff,0x02,0x05,0x0f,0xff,0x02,0x04,0x0d,0xff,0x01,0x02,0x0d,0xff,0x02,0x09,0x13,0xff,0x01,0x07,0x10,0xff,0x00,0x03,0x0a,0xff,0x04,0x06,0x0c,0xff,0x02,0x04,0x0b,0xff,0x16,0x18,0x2c,0xff,0x22,0x31,0x56,0xff,0x53,0x7b,0xa4,0xff,0x53,0x7d,0x9d,0xff,0x36,0x55,0x69,0xff,0x37,0x56,0x64,0xff,0x31,0x4d,0x5c,0xff,0x25,0x39,0x4a,0xff,0x68,0x75,0x81,0xfd,0xfb,0xfb,0xfc,0x35,0xff,0xff,0xff,0x00,0xfe,0xf3,0xf8,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfb,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf3,0xf8,0x00,0xff,0xff,0xff,0x00,0xf4,0xf5,0xf7,0x4f,0xb6,0xcf,0xe0,0xff,0x6f,0x8d,0xa3,0xff,0x0d,0x18,0x36,0xff,0x1e,0x2a,0x50,0xff,0x4d,0x64,0x8c,0xff,0x3f,0x51,0x72,0xff,0x29,0x39,0x5a,0xff,0x69,0x8d,0xb6,0xff,0x83,0xab,0xcd,0xff,0xa4,0xc5,0xdf,0xff,0x6d,0x8f,0xa7,0xff,0x49,0x6b,0x82,0xff,0x4c,0x6e,0x83,0xff,0x4a,0x6b,0x80,0xff,0x4d,0x6d,0x85,0xff,0x51,0x72,0x8a,0xff,0x55,0x75,0x92,0xff,0x77,0x96,0xb1,0xff,0xbd,0xdf,0xf2,0xff,0x3a,0x50,0x63,0xff,0x00,0x00,0x10,0xff,0x0f,0x13,0x27,0xff,0x19,0x26,0x43,0xff,0x5d,0x78,0x9c,0xff,0x2c,0x45,0x6b,0xff,0x22,0x35,0x5c,0xff,0x41,0x59,0x84,0xff,0x60,0x85,0xad,0xff,0x97,0xbb,0xdb,0xff,0x68,0x8b,0xa5,0xff,0x2c,0x4b,0x63,0xff,0x34,0x4d,0x63,0xff,0x2e,0x44,0x59,0xff,0x35,0x4a,0x5f,0xff,0x2d,0x44,0x5b,0xff,0x39,0x51,0x6c,0xff,0x3b,0x59,0x76,0xff,0x56,0x79,0x99,0xff,0x6d,0x92,0xb2,0xff,0x89,0xaa,0xc2,0xff,0xac,0xca,0xdf,0xff,0x95,0xb3,0xc9,0xff,0x77,0x97,0xb3,0xff,0x51,0x72,0x9c,0xff,0x4b,0x6b,0x9c,0xff,0x6d,0x8f,0xb1,0xff,0x7a,0x9b,0xb5,0xff,0x86,0xab,0xcb,0xff,0x2c,0x43,0x63,0xff,0x0d,0x18,0x34,0xff,0x0e,0x17,0x34,0xff,0x0f,0x1b,0x3b,0xff,0x3e,0x5b,0x81,0xff,0x6a,0x8d,0xb4,0xff,0x3f,0x5a,0x85,0xff,0x54,0x76,0x9e,0xff,0x6f,0x94,0xb9,0xff,0x68,0x8e,0xac,0xff,0x58,0x7e,0x96,0xff,0x43,0x62,0x7a,0xff,0x2a,0x45,0x5b,0xff,0x61,0x83,0x9f,0xff,0x94,0xba,0xde,0xff,0x50,0x6b,0x98,0xff,0x17,0x25,0x4a,0xff,0x19,0x23,0x43,0xff,0x1f,0x2c,0x4f,0xff,0x1e,0x34,0x54,0xff,0x86,0xa1,0xbc,0xff,0xa5,0xc1,0xd9,0xff,0x93,0xb4,0xcb,0xff,0x96,0xb8,0xd1,0xff,0x41,0x5a,0x7e,0xff,0x0d,0x17,0x3b,0xff,0x18,0x1f,0x41,0xff,0x18,0x21,0x43,0xff,0x1a,0x24,0x4b,0xff,0x2b,0x3c,0x67,0xff,0x4a,0x63,0x93,0xff,0x37,0x4c,0x7a,0xff,0x1e,0x2a,0x52,0xff,0x1b,0x26,0x4c,0xff,0x1b,0x25,0x4a,0xff,0x2c,0x45,0x6c,0xff,0x51,0x79,0xa2,0xff,0x8c,0xae,0xc7,0xff,0xa1,0xc1,0xd8,0xff,0x7c,0x9b,0xba,0xff,0x64,0x7f,0x9e,0xff,0x6f,0x8e,0xab,0xff,0x38,0x4b,0x73,0xff,0x6e,0x88,0xaf,0xff,0x34,0x4e,0x77,0xff,0x4e,0x67,0x8d,0xff,0x20,0x33,0x54,0xff,0x1a,0x2f,0x54,0xff,0x2b,0x42,0x71,0xff,0x17,0x20,0x4a,0xff,0x17,0x1f,0x45,0xff,0x13,0x25,0x49,0xff,0x49,0x68,0x8f,0xff,0x73,0x9c,0xca,0xff,0x59,0x7f,0xab,0xff,0x2e,0x43,0x60,0xff,0x18,0x1d,0x30,0xff,0x05,0x09,0x11,0xff,0x00,0x04,0x06,0xff,0x00,0x02,0x07,0xff,0x03,0x02,0x0a,0xff,0x04,0x03,0x0b,0xff,0x04,0x05,0x0e,0xff,0x06,0x08,0x13,0xff,0x04,0x07,0x11,0xff,0x00,0x02,0x0a,0xff,0x03,0x05,0x0e,0xff,0x03,0x06,0x0d,0xff,0x01,0x02,0x0b,0xff,0x1b,0x29,0x44,0xff,0x49,0x6c,0x99,0xff,0x62,0x89,0xaf,0xff,0x37,0x53,0x66,0xff,0x34,0x54,0x63,0xff,0x32,0x4c,0x61,0xff,0x38,0x47,0x5c,0xff,0xc6,0xc9,0xce,0xa9,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfe,0xf2,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfc,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe9,0xf1,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xeb,0xf4,0xfc,0xb0,0x57,0x70,0x87,0xff,0x07,0x10,0x2b,0xff,0x1b,0x1e,0x3c,0xff,0x14,0x1a,0x36,0xff,0x05,0x0e,0x2c,0xff,0x3e,0x56,0x7c,0xff,0x6c,0x99,0xc1,0xff,0x77,0xa2,0xc5,0xff,0x9a,0xbd,0xd9,0xff,0x78,0x9a,0xb3,0xff,0x45,0x65,0x7c,0xff,0x43,0x63,0x77,0xff,0x40,0x5f,0x73,0xff,0x41,0x61,0x76,0xff,0x46,0x64,0x7b,0xff,0x45,0x64,0x7a,0xff,0xa0,0xc0,0xd3,0xff,0x91,0xae,0xc4,0xff,0x06,0x0c,0x1d,0xff,0x08,0x0a,0x1c,0xff,0x0d,0x14,0x2d,0xff,0x23,0x37,0x57,0xff,0x90,0xb3,0xcb,0xff,0x7c,0x9d,0xb7,0xff,0x2f,0x45,0x68,0xff,0x39,0x52,0x77,0xff,0x55,0x79,0x9f,0xff,0x83,0xa5,0xc7,0xff,0xa6,0xc7,0xe3,0xff,0x6a,0x89,0xa1,0xff,0x24,0x37,0x51,0xff,0x2b,0x3e,0x54,0xff,0x30,0x43,0x59,0xff,0x28,0x3d,0x53,0xff,0x30,0x46,0x5e,0xff,0x34,0x4a,0x67,0xff,0x41,0x61,0x83,0xff,0x55,0x7b,0x9d,0xff,0xa9,0xc7,0xdb,0xff,0xa8,0xc6,0xd4,0xff,0x92,0xb0,0xc7,0xff,0x66,0x87,0xa8,0xff,0x47,0x69,0x98,0xff,0x56,0x7b,0xa5,0xff,0x75,0x98,0xb0,0xff,0x75,0x99,0xae,0xff,0x89,0xad,0xcb,0xff,0x48,0x63,0x87,0xff,0x10,0x18,0x36,0xff,0x0d,0x15,0x2d,0xff,0x15,0x1a,0x36,0xff,0x20,0x2e,0x50,0xff,0x62,0x7f,0xa3,0xff,0x4a,0x6c,0x94,0xff,0x5f,0x81,0xa6,0xff,0x67,0x8b,0xae,0xff,0x70,0x97,0xb5,0xff,0x62,0x85,0x9b,0xff,0x3b,0x58,0x6b,0xff,0x2a,0x47,0x59,0xff,0x81,0xa3,0xbf,0xff,0x8c,0xb3,0xda,0xff,0x3c,0x56,0x7e,0xff,0x17,0x1d,0x3e,0xff,0x1c,0x26,0x45,0xff,0x22,0x33,0x55,0xff,0x34,0x4d,0x6c,0xff,0x95,0xb4,0xcf,0xff,0x97,0xb4,0xcc,0xff,0x8d,0xae,0xc5,0xff,0x94,0xb8,0xcf,0xff,0x7d,0x9b,0xbd,0xff,0x19,0x25,0x4b,0xff,0x13,0x19,0x38,0xff,0x17,0x1f,0x3d,0xff,0x1c,0x22,0x46,0xff,0x22,0x2a,0x51,0xff,0x2f,0x44,0x6e,0xff,0x50,0x6c,0x9a,0xff,0x2d,0x43,0x6f,0xff,0x15,0x21,0x48,0xff,0x1e,0x28,0x4a,0xff,0x22,0x36,0x5b,0xff,0x3b,0x5f,0x8f,0xff,0x7c,0xa1,0xc3,0xff,0xa0,0xbf,0xd7,0xff,0x4a,0x61,0x86,0xff,0x6e,0x8a,0xab,0xff,0x4b,0x69,0x86,0xff,0x6b,0x85,0xa4,0xff,0x59,0x71,0x93,0xff,0x2f,0x3f,0x64,0xff,0x2d,0x3d,0x5f,0xff,0x20,0x30,0x51,0xff,0x21,0x31,0x58,0xff,0x3a,0x4d,0x76,0xff,0x19,0x1c,0x42,0xff,0x0e,0x17,0x35,0xff,0x12,0x19,0x36,0xff,0x1c,0x23,0x3f,0xff,0x67,0x84,0xa3,0xff,0x86,0xb1,0xd4,0xff,0x36,0x4a,0x68,0xff,0x06,0x09,0x17,0xff,0x02,0x05,0x0e,0xff,0x02,0x05,0x0a,0xff,0x03,0x04,0x08,0xff,0x02,0x02,0x06,0xff,0x02,0x03,0x07,0xff,0x03,0x05,0x0b,0xff,0x05,0x07,0x10,0xff,0x05,0x07,0x0f,0xff,0x00,0x01,0x06,0xff,0x01,0x03,0x09,0xff,0x02,0x04,0x0b,0xff,0x00,0x05,0x09,0xff,0x0c,0x18,0x28,0xff,0x30,0x43,0x66,0xff,0x3f,0x5b,0x81,0xff,0x56,0x73,0x91,0xff,0x47,0x61,0x80,0xff,0x1f,0x2d,0x46,0xff,0x7c,0x81,0x90,0xf2,0xff,0xff,0xff,0x2a,0xff,0xff,0xff,0x00,0xfe,0xf0,0xf6,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf1,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x2c,0x7e,0x8b,0x99,0xf5,0x02,0x0b,0x25,0xff,0x0f,0x11,0x2c,0xff,0x04,0x07,0x21,0xff,0x15,0x26,0x44,0xff,0x5c,0x86,0xae,0xff,0x6b,0x99,0xc2,0xff,0x78,0xa1,0xc4,0xff,0x93,0xb7,0xd5,0xff,0x8f,0xb2,0xd0,0xff,0x4d,0x6d,0x86,0xff,0x3c,0x5a,0x6d,0xff,0x3d,0x5b,0x6e,0xff,0x42,0x60,0x75,0xff,0x40,0x5e,0x75,0xff,0x5a,0x78,0x8c,0xff,0xc0,0xdf,0xf0,0xff,0x41,0x53,0x68,0xff,0x00,0x00,0x10,0xff,0x11,0x16,0x2a,0xff,0x13,0x18,0x36,0xff,0x3b,0x4e,0x71,0xff,0xc3,0xe1,0xf5,0xff,0xc4,0xe3,0xf8,0xff,0x8a,0xaa,0xcb,0xff,0x66,0x88,0xaa,0xff,0x6f,0x93,0xb1,0xff,0x7e,0xa1,0xbd,0xff,0x8f,0xb1,0xce,0xff,0xb0,0xcd,0xe7,0xff,0x6c,0x82,0x9a,0xff,0x1d,0x30,0x48,0xff,0x2a,0x39,0x52,0xff,0x29,0x3b,0x54,0xff,0x26,0x39,0x52,0xff,0x29,0x3c,0x58,0xff,0x2d,0x47,0x65,0xff,0x6f,0x8e,0xa6,0xff,0xb9,0xd4,0xe3,0xff,0xa2,0xc0,0xd0,0xff,0x86,0xa6,0xbf,0xff,0x54,0x75,0x9d,0xff,0x47,0x6a,0x9a,0xff,0x61,0x85,0xaa,0xff,0x74,0x96,0xa9,0xff,0x71,0x94,0xa9,0xff,0x85,0xa9,0xc7,0xff,0x5e,0x7d,0xa6,0xff,0x13,0x19,0x38,0xff,0x11,0x13,0x2c,0xff,0x19,0x1c,0x37,0xff,0x19,0x23,0x43,0xff,0x44,0x5f,0x81,0xff,0x5b,0x80,0xa7,0xff,0x68,0x8a,0xaf,0xff,0x60,0x84,0xa7,0xff,0x6a,0x90,0xb0,0xff,0x5d,0x80,0x97,0xff,0x3b,0x58,0x6d,0xff,0x3c,0x5a,0x6d,0xff,0x98,0xbc,0xda,0xff,0x77,0x9d,0xc9,0xff,0x2d,0x44,0x6b,0xff,0x14,0x1a,0x39,0xff,0x20,0x2b,0x49,0xff,0x1f,0x31,0x55,0xff,0x4b,0x66,0x85,0xff,0x97,0xb8,0xd0,0xff,0x8c,0xac,0xc2,0xff,0x85,0xa9,0xbf,0xff,0x89,0xaf,0xc9,0xff,0x70,0x9a,0xbb,0xff,0x3a,0x54,0x7a,0xff,0x15,0x18,0x37,0xff,0x1a,0x1d,0x3c,0xff,0x1a,0x1f,0x3f,0xff,0x1d,0x26,0x45,0xff,0x1f,0x2e,0x4f,0xff,0x34,0x4e,0x7d,0xff,0x4f,0x71,0x9f,0xff,0x2b,0x3c,0x65,0xff,0x1c,0x26,0x4a,0xff,0x1e,0x2b,0x52,0xff,0x29,0x3e,0x6f,0xff,0x6c,0x8f,0xb9,0xff,0x53,0x6b,0x8d,0xff,0x04,0x0b,0x23,0xff,0x17,0x22,0x3c,0xff,0x14,0x1e,0x39,0xff,0x2f,0x41,0x5e,0xff,0x41,0x56,0x72,0xff,0x1c,0x24,0x41,0xff,0x1d,0x2b,0x49,0xff,0x25,0x36,0x5a,0xff,0x1e,0x25,0x4d,0xff,0x14,0x19,0x2b,0xff,0x04,0x03,0x08,0xff,0x02,0x04,0x06,0xff,0x01,0x01,0x04,0xff,0x02,0x01,0x06,0xff,0x75,0x8a,0xa5,0xff,0x6d,0x8f,0xb5,0xff,0x25,0x39,0x58,0xff,0x1f,0x29,0x3a,0xff,0x13,0x1a,0x27,0xff,0x04,0x08,0x0f,0xff,0x02,0x04,0x08,0xff,0x00,0x02,0x03,0xff,0x01,0x03,0x04,0xff,0x02,0x05,0x07,0xff,0x02,0x05,0x09,0xff,0x03,0x05,0x0b,0xff,0x01,0x02,0x06,0xff,0x00,0x01,0x06,0xff,0x01,0x03,0x08,0xff,0x03,0x04,0x09,0xff,0x08,0x0a,0x14,0xff,0x19,0x1e,0x2c,0xff,0x18,0x27,0x3a,0xff,0x39,0x4f,0x6e,0xff,0x0b,0x0d,0x1c,0xff,0x22,0x22,0x24,0xff,0xdb,0xda,0xdb,0x7f,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfe,0xf3,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf1,0x00,0xff,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xdb,0xdd,0xe1,0x86,0x29,0x2f,0x45,0xff,0x01,0x07,0x23,0xff,0x1c,0x25,0x43,0xff,0x4b,0x68,0x8f,0xff,0x58,0x84,0xb0,0xff,0x70,0x9b,0xc1,0xff,0x7f,0xa8,0xca,0xff,0x91,0xb5,0xd4,0xff,0x92,0xb3,0xd4,0xff,0x56,0x74,0x90,0xff,0x39,0x55,0x68,0xff,0x41,0x5e,0x71,0xff,0x40,0x5e,0x73,0xff,0x3f,0x5f,0x76,0xff,0x9d,0xbc,0xcf,0xff,0x9e,0xbd,0xcf,0xff,0x0b,0x12,0x28,0xff,0x07,0x0a,0x1d,0xff,0x18,0x1d,0x35,0xff,0x1a,0x21,0x41,0xff,0x49,0x60,0x84,0xff,0x79,0x9c,0xb7,0xff,0x6d,0x92,0xae,0xff,0x7a,0xa1,0xc7,0xff,0x7c,0xa2,0xc7,0xff,0x6d,0x93,0xb0,0xff,0x77,0x9c,0xb7,0xff,0x7e,0xa1,0xbf,0xff,0x8d,0xb0,0xce,0xff,0xae,0xd1,0xe9,0xff,0x68,0x7f,0x96,0xff,0x16,0x21,0x3d,0xff,0x27,0x37,0x50,0xff,0x1d,0x2d,0x46,0xff,0x1b,0x2a,0x45,0xff,0x28,0x3e,0x5a,0xff,0xa8,0xc2,0xd7,0xff,0xb7,0xd0,0xe0,0xff,0x9a,0xb9,0xcc,0xff,0x70,0x92,0xaf,0xff,0x49,0x6b,0x95,0xff,0x49,0x6e,0x9b,0xff,0x63,0x86,0xa6,0xff,0x74,0x96,0xaa,0xff,0x6d,0x90,0xa7,0xff,0x7f,0xa4,0xc2,0xff,0x72,0x98,0xc1,0xff,0x1d,0x29,0x4a,0xff,0x10,0x10,0x2b,0xff,0x17,0x19,0x35,0xff,0x1b,0x23,0x42,0xff,0x28,0x3f,0x60,0xff,0x64,0x89,0xb0,0xff,0x87,0xab,0xd0,0xff,0x6f,0x93,0xb8,0xff,0x5e,0x83,0xa6,0xff,0x58,0x7c,0x97,0xff,0x3e,0x5e,0x75,0xff,0x67,0x86,0x9b,0xff,0xa2,0xc7,0xe6,0xff,0x65,0x8b,0xb8,0xff,0x23,0x36,0x5b,0xff,0x13,0x1a,0x35,0xff,0x22,0x30,0x4d,0xff,0x1e,0x32,0x57,0xff,0x67,0x84,0xa0,0xff,0x95,0xb7,0xce,0xff,0x85,0xa9,0xc4,0xff,0x82,0xa7,0xc4,0xff,0x76,0x9c,0xbc,0xff,0x53,0x7b,0x9c,0xff,0x60,0x85,0xa6,0xff,0x26,0x35,0x56,0xff,0x11,0x17,0x36,0xff,0x15,0x1c,0x3b,0xff,0x17,0x20,0x3e,0xff,0x1b,0x24,0x44,0xff,0x26,0x34,0x5c,0xff,0x40,0x5a,0x87,0xff,0x4c,0x6f,0x97,0xff,0x20,0x32,0x54,0xff,0x13,0x1a,0x31,0xff,0x0a,0x0f,0x20,0xff,0x5a,0x6e,0x8c,0xff,0x33,0x47,0x6a,0xff,0x08,0x0b,0x1e,0xff,0x0d,0x10,0x28,0xff,0x0f,0x12,0x2a,0xff,0x0d,0x12,0x2d,0xff,0x10,0x17,0x31,0xff,0x16,0x1e,0x37,0xff,0x2c,0x3c,0x5c,0xff,0x1a,0x27,0x4b,0xff,0x44,0x5a,0x83,0xff,0x4b,0x5f,0x86,0xff,0x13,0x18,0x2e,0xff,0x0e,0x12,0x27,0xff,0x0a,0x0d,0x1f,0xff,0x17,0x21,0x39,0xff,0x91,0xad,0xd1,0xff,0x58,0x77,0x9c,0xff,0x24,0x39,0x56,0xff,0x2b,0x3b,0x50,0xff,0x24,0x2b,0x3a,0xff,0x06,0x09,0x0e,0xff,0x01,0x04,0x08,0xff,0x01,0x02,0x04,0xff,0x01,0x03,0x05,0xff,0x01,0x02,0x06,0xff,0x01,0x02,0x07,0xff,0x01,0x02,0x07,0xff,0x02,0x02,0x07,0xff,0x01,0x03,0x07,0xff,0x01,0x02,0x06,0xff,0x01,0x02,0x08,0xff,0x02,0x05,0x0d,0xff,0x0f,0x14,0x1c,0xff,0x10,0x11,0x1c,0xff,0x21,0x24,0x3a,0xff,0x13,0x14,0x1b,0xff,0x93,0x94,0x94,0xd7,0xff,0xff,0xff,0x0d,0xff,0xff,0xff,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xed,0xf4,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x0c,0x9c,0x9f,0xab,0xd6,0x30,0x42,0x61,0xff,0x66,0x87,0xa7,0xff,0x56,0x80,0xa9,0xff,0x55,0x7e,0xab,0xff,0x7e,0xa6,0xca,0xff,0x89,0xb0,0xd2,0xff,0x98,0xbd,0xdb,0xff,0xa9,0xc8,0xe7,0xff,0x70,0x8e,0xa9,0xff,0x33,0x4e,0x60,0xff,0x3f,0x5b,0x70,0xff,0x3c,0x5e,0x72,0xff,0x71,0x95,0xaa,0xff,0xc8,0xe7,0xfd,0xff,0x59,0x72,0x87,0xff,0x00,0x00,0x11,0xff,0x10,0x12,0x27,0xff,0x1c,0x22,0x3f,0xff,0x1c,0x29,0x4b,0xff,0x4d,0x67,0x87,0xff,0x34,0x53,0x6c,0xff,0x1b,0x35,0x4e,0xff,0x43,0x65,0x8e,0xff,0x6f,0x97,0xbf,0xff,0x7e,0xa6,0xc5,0xff,0x7a,0x9f,0xbb,0xff,0x79,0x9d,0xba,0xff,0x7d,0xa2,0xbf,0xff,0x8e,0xb2,0xce,0xff,0xae,0xcf,0xe7,0xff,0x5d,0x76,0x8d,0xff,0x1c,0x29,0x45,0xff,0x1b,0x27,0x41,0xff,0x12,0x1f,0x38,0xff,0x5b,0x71,0x88,0xff,0xc3,0xdd,0xf1,0xff,0xac,0xc7,0xda,0xff,0x87,0xab,0xbf,0xff,0x5a,0x7f,0xa1,0xff,0x45,0x66,0x95,0xff,0x4e,0x71,0x9d,0xff,0x60,0x85,0xa1,0xff,0x6f,0x92,0xa8,0xff,0x66,0x89,0xa1,0xff,0x78,0x9d,0xb7,0xff,0x88,0xb0,0xd4,0xff,0x2b,0x3d,0x5d,0xff,0x0e,0x0f,0x28,0xff,0x14,0x19,0x34,0xff,0x19,0x22,0x3e,0xff,0x1e,0x2a,0x4b,0xff,0x5a,0x76,0x9f,0xff,0x7e,0xa5,0xca,0xff,0x89,0xb0,0xd4,0xff,0x7a,0xa1,0xc4,0xff,0x5a,0x7f,0x9e,0xff,0x41,0x64,0x7f,0xff,0x90,0xb3,0xcb,0xff,0x95,0xbd,0xdf,0xff,0x58,0x7d,0xa8,0xff,0x1f,0x2d,0x4e,0xff,0x15,0x1d,0x38,0xff,0x23,0x34,0x53,0xff,0x21,0x37,0x5b,0xff,0x74,0x95,0xb0,0xff,0x87,0xaf,0xc7,0xff,0x70,0x97,0xb9,0xff,0x49,0x69,0x8b,0xff,0x31,0x49,0x69,0xff,0x1c,0x32,0x4b,0xff,0x24,0x34,0x4f,0xff,0x44,0x56,0x76,0xff,0x11,0x1a,0x3c,0xff,0x15,0x1c,0x3b,0xff,0x18,0x1c,0x3b,0xff,0x15,0x1c,0x3b,0xff,0x13,0x20,0x40,0xff,0x24,0x38,0x65,0xff,0x47,0x6f,0x9d,0xff,0x52,0x68,0x8e,0xff,0x13,0x15,0x22,0xff,0x08,0x08,0x0f,0xff,0x75,0x8c,0xab,0xff,0x28,0x3c,0x5d,0xff,0x0b,0x0f,0x21,0xff,0x13,0x17,0x2a,0xff,0x12,0x16,0x2a,0xff,0x10,0x13,0x27,0xff,0x10,0x12,0x26,0xff,0x0f,0x14,0x2a,0xff,0x16,0x1e,0x3f,0xff,0x18,0x26,0x4a,0xff,0x79,0x99,0xbf,0xff,0x48,0x65,0x96,0xff,0x18,0x20,0x47,0xff,0x15,0x1b,0x3a,0xff,0x15,0x1d,0x3b,0xff,0x17,0x23,0x46,0xff,0x7f,0x9f,0xc3,0xff,0x71,0x92,0xb2,0xff,0x1b,0x2d,0x48,0xff,0x2f,0x40,0x5c,0xff,0x2a,0x36,0x4c,0xff,0x0a,0x0d,0x17,0xff,0x02,0x03,0x08,0xff,0x00,0x01,0x04,0xff,0x00,0x02,0x03,0xff,0x00,0x01,0x04,0xff,0x00,0x02,0x05,0xff,0x01,0x03,0x05,0xff,0x02,0x03,0x07,0xff,0x04,0x04,0x09,0xff,0x02,0x03,0x07,0xff,0x02,0x04,0x09,0xff,0x05,0x09,0x11,0xff,0x0a,0x10,0x19,0xff,0x09,0x0b,0x14,0xff,0x0a,0x0d,0x15,0xff,0x6f,0x70,0x7d,0xff,0xf5,0xf5,0xf5,0x4d,0xff,0xff,0xff,0x00,0xff,0xf5,0xf8,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf5,0xf9,0x00,0xff,0xff,0xff,0x00,0xfa,0xfa,0xfb,0x42,0x9a,0xb1,0xc6,0xff,0x5a,0x85,0xa8,0xff,0x52,0x7b,0xa4,0xff,0x5e,0x87,0xb3,0xff,0x93,0xb9,0xdb,0xff,0x95,0xba,0xdb,0xff,0x99,0xbe,0xdc,0xff,0xad,0xcd,0xec,0xff,0x93,0xb0,0xcc,0xff,0x34,0x51,0x64,0xff,0x35,0x52,0x65,0xff,0x5f,0x81,0x95,0xff,0xac,0xce,0xe2,0xff,0xb3,0xd1,0xed,0xff,0x25,0x37,0x4d,0xff,0x01,0x03,0x12,0xff,0x13,0x14,0x2d,0xff,0x1f,0x26,0x44,0xff,0x22,0x32,0x55,0xff,0x3e,0x58,0x77,0xff,0x2a,0x3d,0x57,0xff,0x22,0x2e,0x48,0xff,0x3c,0x55,0x7b,0xff,0x55,0x7b,0xa4,0xff,0x74,0x98,0xbe,0xff,0x82,0xa6,0xc3,0xff,0x7d,0xa0,0xbb,0xff,0x7b,0x9e,0xba,0xff,0x7f,0xa2,0xc0,0xff,0x8b,0xb4,0xcf,0xff,0xad,0xd3,0xec,0xff,0x56,0x6c,0x89,0xff,0x08,0x12,0x2f,0xff,0x20,0x2f,0x49,0xff,0xa3,0xba,0xd0,0xff,0xb9,0xd3,0xe9,0xff,0x9a,0xb7,0xce,0xff,0x75,0x97,0xb3,0xff,0x4e,0x71,0x97,0xff,0x43,0x61,0x92,0xff,0x52,0x74,0x9e,0xff,0x65,0x89,0xa8,0xff,0x62,0x86,0xa0,0xff,0x5d,0x7f,0x98,0xff,0x71,0x93,0xad,0xff,0x93,0xb8,0xdc,0xff,0x2e,0x40,0x61,0xff,0x0d,0x0d,0x28,0xff,0x12,0x18,0x33,0xff,0x15,0x1f,0x3a,0xff,0x1d,0x28,0x47,0xff,0x45,0x60,0x89,0xff,0x5c,0x82,0xa6,0xff,0x3f,0x5f,0x80,0xff,0x85,0xac,0xd0,0xff,0x71,0x9a,0xc0,0xff,0x61,0x86,0xa6,0xff,0xa6,0xc7,0xe3,0xff,0x83,0xab,0xd1,0xff,0x4a,0x6d,0x97,0xff,0x17,0x1f,0x3f,0xff,0x16,0x1e,0x3c,0xff,0x24,0x35,0x56,0xff,0x26,0x3c,0x60,0xff,0x74,0x97,0xb5,0xff,0x7b,0xa4,0xc2,0xff,0x4d,0x6b,0x90,0xff,0x23,0x37,0x59,0xff,0x29,0x3a,0x54,0xff,0x14,0x1d,0x27,0xff,0x01,0x02,0x0b,0xff,0x3f,0x53,0x6a,0xff,0x2b,0x3b,0x5f,0xff,0x0e,0x12,0x2f,0xff,0x12,0x1a,0x39,0xff,0x41,0x5b,0x7c,0xff,0x72,0x93,0xb5,0xff,0x88,0xab,0xd3,0xff,0x96,0xb7,0xe5,0xff,0x8e,0xaf,0xd5,0xff,0x77,0x95,0xb5,0xff,0x63,0x80,0x9d,0xff,0x75,0x9c,0xbb,0xff,0x17,0x24,0x45,0xff,0x0f,0x12,0x26,0xff,0x12,0x15,0x29,0xff,0x11,0x13,0x28,0xff,0x10,0x13,0x28,0xff,0x10,0x15,0x27,0xff,0x0e,0x13,0x25,0xff,0x0a,0x10,0x2b,0xff,0x36,0x48,0x69,0xff,0x8a,0xae,0xd5,0xff,0x35,0x50,0x7f,0xff,0x14,0x1c,0x42,0xff,0x17,0x1a,0x39,0xff,0x14,0x1a,0x38,0xff,0x11,0x1a,0x3b,0xff,0x6e,0x89,0xad,0xff,0x70,0x91,0xb1,0xff,0x11,0x18,0x30,0xff,0x28,0x38,0x58,0xff,0x3e,0x53,0x80,0xff,0x36,0x43,0x69,0xff,0x03,0x04,0x0a,0xff,0x00,0x01,0x01,0xff,0x00,0x02,0x04,0xff,0x01,0x02,0x04,0xff,0x01,0x02,0x04,0xff,0x00,0x02,0x04,0xff,0x03,0x04,0x07,0xff,0x03,0x04,0x07,0xff,0x04,0x05,0x09,0xff,0x05,0x07,0x0c,0xff,0x0a,0x0d,0x13,0xff,0x12,0x17,0x21,0xff,0x19,0x20,0x32,0xff,0x36,0x3d,0x4f,0xff,0xd6,0xd7,0xdb,0x9a,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf5,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xe5,0xec,0xf1,0x8c,0x71,0x94,0xb2,0xff,0x52,0x7b,0xa7,0xff,0x6c,0x95,0xc0,0xff,0xaa,0xce,0xee,0xff,0xa7,0xc8,0xe8,0xff,0x9c,0xbf,0xdf,0xff,0x9b,0xbd,0xdc,0xff,0xa4,0xc5,0xe0,0xff,0x42,0x62,0x75,0xff,0x40,0x5e,0x70,0xff,0x90,0xb1,0xc4,0xff,0xb8,0xd9,0xee,0xff,0x8d,0xa9,0xc8,0xff,0x0d,0x19,0x2f,0xff,0x08,0x0a,0x17,0xff,0x15,0x18,0x33,0xff,0x21,0x2a,0x4a,0xff,0x27,0x38,0x5b,0xff,0x32,0x49,0x67,0xff,0x29,0x3c,0x54,0xff,0x26,0x34,0x4e,0xff,0x2e,0x49,0x6a,0xff,0x36,0x59,0x7f,0xff,0x5f,0x81,0xac,0xff,0x7e,0xa2,0xc1,0xff,0x83,0xa7,0xc0,0xff,0x7f,0xa1,0xba,0xff,0x7c,0xa0,0xbb,0xff,0x81,0xa5,0xc2,0xff,0x92,0xbb,0xd7,0xff,0xac,0xcb,0xe8,0xff,0x3a,0x4b,0x68,0xff,0x44,0x56,0x70,0xff,0xb8,0xd3,0xec,0xff,0xa2,0xbf,0xd7,0xff,0x82,0xa1,0xbc,0xff,0x67,0x87,0xaa,0xff,0x44,0x63,0x8b,0xff,0x47,0x64,0x93,0xff,0x5a,0x7c,0xa3,0xff,0x69,0x8f,0xae,0xff,0x7a,0x9f,0xba,0xff,0x5d,0x7e,0x97,0xff,0x70,0x91,0xad,0xff,0x93,0xb8,0xde,0xff,0x33,0x43,0x66,0xff,0x0d,0x0e,0x28,0xff,0x10,0x16,0x32,0xff,0x15,0x1d,0x38,0xff,0x1e,0x28,0x47,0xff,0x30,0x46,0x6c,0xff,0x54,0x6f,0x8b,0xff,0x39,0x4d,0x64,0xff,0x2f,0x46,0x5f,0xff,0x57,0x81,0xa7,0xff,0x7c,0xa3,0xc5,0xff,0xa2,0xc4,0xe4,0xff,0x7c,0xa3,0xcd,0xff,0x48,0x67,0x90,0xff,0x14,0x1a,0x39,0xff,0x19,0x21,0x41,0xff,0x23,0x32,0x55,0xff,0x2f,0x44,0x68,0xff,0x7f,0xa4,0xc6,0xff,0x62,0x88,0xad,0xff,0x3b,0x54,0x77,0xff,0x39,0x4e,0x6e,0xff,0x37,0x49,0x63,0xff,0x0e,0x14,0x20,0xff,0x17,0x1e,0x27,0xff,0x15,0x24,0x31,0xff,0x3c,0x4f,0x70,0xff,0x23,0x2e,0x57,0xff,0x4f,0x6e,0x96,0xff,0x69,0x90,0xb8,0xff,0x6b,0x92,0xb7,0xff,0x70,0x96,0xba,0xff,0x43,0x57,0x74,0xff,0x1e,0x29,0x40,0xff,0x2c,0x3d,0x58,0xff,0x5d,0x76,0x96,0xff,0x66,0x85,0xa8,0xff,0x0e,0x13,0x32,0xff,0x11,0x13,0x2b,0xff,0x12,0x14,0x2c,0xff,0x13,0x14,0x2b,0xff,0x0f,0x12,0x28,0xff,0x0d,0x12,0x25,0xff,0x0d,0x0f,0x23,0xff,0x18,0x1d,0x37,0xff,0x8a,0xa0,0xbd,0xff,0x7c,0xa1,0xc9,0xff,0x2b,0x42,0x70,0xff,0x17,0x1d,0x44,0xff,0x18,0x1a,0x39,0xff,0x16,0x1a,0x39,0xff,0x10,0x17,0x3a,0xff,0x58,0x6e,0x91,0xff,0x85,0xa7,0xc8,0xff,0x08,0x0c,0x20,0xff,0x29,0x3a,0x5d,0xff,0x53,0x67,0x95,0xff,0x70,0x8e,0xc0,0xff,0x0e,0x12,0x22,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x02,0xff,0x01,0x00,0x02,0xff,0x02,0x01,0x02,0xff,0x00,0x01,0x03,0xff,0x00,0x03,0x04,0xff,0x02,0x03,0x05,0xff,0x03,0x04,0x08,0xff,0x06,0x08,0x0e,0xff,0x03,0x03,0x07,0xff,0x02,0x04,0x0b,0xff,0x25,0x2f,0x49,0xff,0xb6,0xbe,0xce,0xdb,0xff,0xff,0xff,0x13,0xff,0xff,0xff,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xed,0xf4,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x0e,0xc9,0xd6,0xe2,0xcb,0x65,0x8d,0xb4,0xff,0x7a,0xa6,0xcd,0xff,0xa0,0xc1,0xe4,0xff,0xa6,0xc7,0xe7,0xff,0xa3,0xc6,0xe6,0xff,0x93,0xb7,0xd9,0xff,0x84,0xa6,0xcb,0xff,0x5a,0x7b,0x9c,0xff,0x67,0x8a,0x9e,0xff,0x87,0xad,0xc0,0xff,0xb1,0xd8,0xee,0xff,0x5d,0x79,0x93,0xff,0x06,0x0a,0x1e,0xff,0x0c,0x10,0x1e,0xff,0x17,0x1e,0x3b,0xff,0x20,0x2d,0x4f,0xff,0x28,0x3c,0x5d,0xff,0x27,0x36,0x50,0xff,0x27,0x36,0x4c,0xff,0x20,0x2e,0x47,0xff,0x27,0x3e,0x5c,0xff,0x2b,0x43,0x65,0xff,0x44,0x64,0x89,0xff,0x6b,0x92,0xb8,0xff,0x81,0xa7,0xc4,0xff,0x7f,0xa4,0xba,0xff,0x82,0xa5,0xbc,0xff,0x82,0xa6,0xbe,0xff,0x85,0xac,0xc6,0xff,0x9d,0xc0,0xdf,0xff,0xa1,0xbf,0xd9,0xff,0x47,0x60,0x7b,0xff,0x99,0xb7,0xd0,0xff,0x8b,0xac,0xc5,0xff,0x70,0x93,0xb0,0xff,0x5f,0x82,0xa6,0xff,0x3d,0x5d,0x86,0xff,0x53,0x74,0x9d,0xff,0x68,0x8d,0xb3,0xff,0x5b,0x80,0xa2,0xff,0x78,0x9d,0xbc,0xff,0x7e,0xa4,0xbe,0xff,0x75,0x9c,0xb7,0xff,0x7f,0xa6,0xcf,0xff,0x2e,0x45,0x6b,0xff,0x0f,0x15,0x2f,0xff,0x10,0x15,0x30,0xff,0x13,0x19,0x34,0xff,0x1c,0x25,0x43,0xff,0x31,0x43,0x6a,0xff,0x24,0x30,0x48,0xff,0x18,0x20,0x2e,0xff,0x26,0x37,0x43,0xff,0x22,0x3a,0x51,0xff,0x79,0x99,0xb9,0xff,0x8e,0xb7,0xdc,0xff,0x79,0xa2,0xcc,0xff,0x38,0x53,0x78,0xff,0x12,0x18,0x33,0xff,0x20,0x27,0x47,0xff,0x23,0x2f,0x55,0xff,0x3d,0x56,0x7b,0xff,0x79,0x9f,0xc4,0xff,0x4a,0x6e,0x92,0xff,0x3f,0x58,0x79,0xff,0x4f,0x63,0x85,0xff,0x28,0x3c,0x51,0xff,0x27,0x3a,0x4b,0xff,0x2f,0x40,0x4f,0xff,0x05,0x09,0x14,0xff,0x2d,0x3c,0x55,0xff,0x56,0x79,0xa4,0xff,0x4f,0x78,0x9f,0xff,0x2a,0x46,0x68,0xff,0x1e,0x2d,0x4a,0xff,0x0d,0x14,0x23,0xff,0x00,0x00,0x07,0xff,0x16,0x19,0x26,0xff,0x38,0x48,0x5f,0xff,0x6f,0x8d,0xad,0xff,0x22,0x2b,0x4d,0xff,0x0b,0x0f,0x24,0xff,0x12,0x16,0x2b,0xff,0x10,0x15,0x2e,0xff,0x10,0x14,0x2c,0xff,0x0f,0x12,0x2a,0xff,0x0b,0x0e,0x23,0xff,0x0c,0x10,0x20,0xff,0x15,0x1b,0x2e,0xff,0x93,0xad,0xc9,0xff,0x74,0x99,0xc1,0xff,0x23,0x36,0x61,0xff,0x1a,0x20,0x47,0xff,0x15,0x1a,0x3a,0xff,0x15,0x18,0x38,0xff,0x13,0x19,0x3a,0xff,0x38,0x4b,0x6e,0xff,0x7c,0x9f,0xc9,0xff,0x2d,0x45,0x68,0xff,0x52,0x68,0x96,0xff,0x63,0x7d,0xb2,0xff,0x61,0x7a,0xad,0xff,0x09,0x0b,0x1f,0xff,0x01,0x00,0x02,0xff,0x01,0x00,0x00,0xff,0x01,0x00,0x02,0xff,0x01,0x00,0x03,0xff,0x02,0x00,0x03,0xff,0x01,0x02,0x04,0xff,0x01,0x03,0x05,0xff,0x03,0x03,0x08,0xff,0x00,0x00,0x05,0xff,0x1e,0x20,0x28,0xff,0x2e,0x33,0x46,0xff,0x84,0x8d,0x9f,0xfd,0xff,0xff,0xff,0x49,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf9,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x36,0xb5,0xca,0xdf,0xf5,0x80,0xac,0xd1,0xff,0xa0,0xc5,0xe4,0xff,0xa0,0xc4,0xe7,0xff,0xa0,0xc6,0xe4,0xff,0x9c,0xc2,0xe3,0xff,0x61,0x82,0xb2,0xff,0x5f,0x7e,0xab,0xff,0x6e,0x92,0xa8,0xff,0x81,0xa7,0xbd,0xff,0xa0,0xcc,0xe5,0xff,0x2a,0x41,0x5a,0xff,0x06,0x05,0x19,0xff,0x0f,0x12,0x23,0xff,0x17,0x1f,0x3b,0xff,0x20,0x2c,0x50,0xff,0x2d,0x3e,0x60,0xff,0x25,0x30,0x46,0xff,0x23,0x2c,0x40,0xff,0x16,0x1a,0x2f,0xff,0x1b,0x27,0x3f,0xff,0x29,0x3c,0x59,0xff,0x2c,0x47,0x6c,0xff,0x62,0x87,0xb1,0xff,0x71,0x94,0xbb,0xff,0x81,0xa5,0xc0,0xff,0x81,0xa3,0xbb,0xff,0x7f,0xa2,0xbb,0xff,0x7b,0x9f,0xbb,0xff,0x82,0xa7,0xc6,0xff,0x9c,0xc3,0xe1,0xff,0x7a,0x9e,0xbc,0xff,0x87,0xa6,0xc1,0xff,0x87,0xa7,0xc1,0xff,0x80,0xa2,0xbc,0xff,0x6c,0x8f,0xb2,0xff,0x47,0x68,0x91,0xff,0x65,0x87,0xb1,0xff,0x6f,0x94,0xbb,0xff,0x61,0x84,0xa9,0xff,0x5c,0x7f,0xa3,0xff,0x79,0x9f,0xc1,0xff,0x6f,0x96,0xb4,0xff,0x65,0x8b,0xb4,0xff,0x42,0x60,0x8a,0xff,0x1b,0x2a,0x46,0xff,0x10,0x13,0x2d,0xff,0x13,0x18,0x32,0xff,0x1a,0x22,0x40,0xff,0x2d,0x3d,0x65,0xff,0x2e,0x3c,0x53,0xff,0x08,0x0c,0x11,0xff,0x10,0x16,0x1a,0xff,0x13,0x16,0x1d,0xff,0x8d,0xad,0xc6,0xff,0x7a,0xa5,0xcf,0xff,0x75,0x9a,0xc4,0xff,0x28,0x39,0x5c,0xff,0x14,0x16,0x32,0xff,0x21,0x28,0x48,0xff,0x23,0x32,0x57,0xff,0x43,0x5f,0x83,0xff,0x59,0x7f,0xa6,0xff,0x40,0x5e,0x82,0xff,0x3c,0x51,0x70,0xff,0x41,0x58,0x79,0xff,0x21,0x33,0x45,0xff,0x2d,0x41,0x4e,0xff,0x34,0x40,0x4f,0xff,0x27,0x32,0x48,0xff,0x5f,0x82,0xa4,0xff,0x64,0x90,0xb8,0xff,0x35,0x4e,0x76,0xff,0x2d,0x3c,0x5e,0xff,0x20,0x25,0x37,0xff,0x02,0x00,0x05,0xff,0x06,0x05,0x0c,0xff,0x09,0x09,0x12,0xff,0x71,0x85,0x9a,0xff,0x4e,0x6c,0x8f,0xff,0x06,0x05,0x1d,0xff,0x0f,0x13,0x26,0xff,0x11,0x15,0x2a,0xff,0x10,0x16,0x2e,0xff,0x11,0x13,0x2f,0xff,0x0f,0x15,0x2d,0xff,0x25,0x2e,0x45,0xff,0x11,0x17,0x23,0xff,0x01,0x06,0x0d,0xff,0x78,0x92,0xac,0xff,0x6f,0x93,0xbe,0xff,0x1e,0x2d,0x58,0xff,0x1c,0x20,0x45,0xff,0x19,0x1e,0x3f,0xff,0x15,0x19,0x39,0xff,0x17,0x1b,0x3c,0xff,0x22,0x30,0x53,0xff,0x5e,0x7f,0xad,0xff,0x46,0x67,0x95,0xff,0x55,0x6a,0x95,0xff,0x5d,0x73,0xa5,0xff,0x34,0x3e,0x70,0xff,0x0a,0x09,0x20,0xff,0x04,0x02,0x08,0xff,0x02,0x00,0x00,0xff,0x02,0x01,0x02,0xff,0x01,0x01,0x02,0xff,0x01,0x01,0x02,0xff,0x00,0x01,0x02,0xff,0x01,0x01,0x04,0xff,0x02,0x01,0x04,0xff,0x00,0x00,0x03,0xff,0x5d,0x6f,0x90,0xff,0x76,0x80,0xa6,0xff,0xe4,0xe6,0xeb,0x87,0xff,0xff,0xff,0x00,0xfe,0xfb,0xfc,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf4,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xff,0xf8,0xfb,0x00,0xff,0xff,0xff,0x00,0xf8,0xfb,0xfc,0x61,0xb5,0xd2,0xea,0xff,0x9a,0xc2,0xe2,0xff,0xa2,0xc6,0xe8,0xff,0x9b,0xc0,0xe2,0xff,0x9b,0xc2,0xe5,0xff,0x70,0x92,0xc2,0xff,0x5f,0x7f,0xae,0xff,0x60,0x86,0x9d,0xff,0x97,0xbc,0xd5,0xff,0x78,0x9a,0xb7,0xff,0x13,0x1e,0x37,0xff,0x09,0x0b,0x1f,0xff,0x11,0x14,0x27,0xff,0x19,0x20,0x3d,0xff,0x23,0x2d,0x50,0xff,0x2b,0x38,0x5b,0xff,0x12,0x1a,0x2d,0xff,0x22,0x2d,0x3e,0xff,0x14,0x16,0x2c,0xff,0x13,0x19,0x30,0xff,0x25,0x36,0x50,0xff,0x20,0x38,0x5c,0xff,0x52,0x74,0x9f,0xff,0x5d,0x7f,0xa7,0xff,0x73,0x96,0xb3,0xff,0x78,0x9d,0xb6,0xff,0x72,0x96,0xb1,0xff,0x73,0x99,0xb4,0xff,0x70,0x96,0xb4,0xff,0x7d,0xa3,0xc5,0xff,0x97,0xbe,0xdf,0xff,0x9f,0xbf,0xdb,0xff,0x99,0xb7,0xd0,0xff,0x9b,0xba,0xd2,0xff,0x82,0xa5,0xc4,0xff,0x54,0x76,0x9f,0xff,0x5c,0x7e,0xa9,0xff,0x57,0x7a,0xa2,0xff,0x3e,0x5f,0x85,0xff,0x40,0x5c,0x82,0xff,0x51,0x6f,0x95,0xff,0x45,0x5f,0x7f,0xff,0x5e,0x7e,0xa6,0xff,0x57,0x7a,0xa6,0xff,0x33,0x46,0x6e,0xff,0x10,0x14,0x30,0xff,0x14,0x1a,0x31,0xff,0x19,0x21,0x3f,0xff,0x2d,0x3c,0x63,0xff,0x2b,0x39,0x53,0xff,0x0e,0x12,0x19,0xff,0x06,0x09,0x0d,0xff,0x2f,0x33,0x3a,0xff,0x9d,0xc0,0xdd,0xff,0x6d,0x99,0xc6,0xff,0x65,0x86,0xb1,0xff,0x1b,0x26,0x49,0xff,0x15,0x17,0x33,0xff,0x1f,0x27,0x46,0xff,0x1f,0x2e,0x50,0xff,0x43,0x60,0x87,0xff,0x48,0x6c,0x96,0xff,0x2c,0x48,0x6b,0xff,0x2b,0x3d,0x51,0xff,0x20,0x2c,0x3e,0xff,0x32,0x40,0x54,0xff,0x18,0x1f,0x29,0xff,0x18,0x25,0x36,0xff,0x58,0x7b,0x9a,0xff,0x83,0xb2,0xdc,0xff,0x5d,0x83,0xac,0xff,0x22,0x3b,0x63,0xff,0x49,0x62,0x87,0xff,0x1d,0x22,0x34,0xff,0x05,0x04,0x05,0xff,0x00,0x00,0x00,0xff,0x57,0x65,0x73,0xff,0x6a,0x84,0xa7,0xff,0x14,0x1a,0x3c,0xff,0x0c,0x11,0x29,0xff,0x0f,0x13,0x2a,0xff,0x11,0x14,0x2d,0xff,0x15,0x19,0x33,0xff,0x1a,0x1d,0x39,0xff,0x10,0x16,0x28,0xff,0x2b,0x32,0x40,0xff,0x29,0x2d,0x3a,0xff,0x00,0x00,0x00,0xff,0x74,0x8e,0xa8,0xff,0x5d,0x80,0xad,0xff,0x1f,0x2a,0x54,0xff,0x1a,0x1e,0x42,0xff,0x18,0x1d,0x3e,0xff,0x15,0x1b,0x3a,0xff,0x19,0x1d,0x3e,0xff,0x19,0x24,0x47,0xff,0x46,0x62,0x8e,0xff,0x2e,0x3f,0x67,0xff,0x81,0x9d,0xcc,0xff,0x51,0x66,0x8d,0xff,0x07,0x07,0x25,0xff,0x11,0x13,0x26,0xff,0x01,0x02,0x03,0xff,0x01,0x01,0x00,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x01,0x00,0x02,0xff,0x01,0x00,0x03,0xff,0x00,0x00,0x00,0xff,0x05,0x09,0x11,0xff,0x69,0x7d,0xa2,0xff,0xcc,0xce,0xdb,0xb7,0xff,0xff,0xff,0x01,0xff,0xfe,0xfe,0x00,0xfe,0xec,0xf3,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf6,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xea,0xf1,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xf2,0xf7,0xfb,0x92,0xa4,0xc5,0xe1,0xff,0x93,0xbe,0xdf,0xff,0x73,0x95,0xc4,0xff,0x6f,0x90,0xc5,0xff,0x7a,0xa1,0xca,0xff,0x70,0x97,0xb7,0xff,0x5e,0x85,0x9c,0xff,0xa1,0xc7,0xe4,0xff,0x45,0x59,0x77,0xff,0x0a,0x0c,0x22,0xff,0x0e,0x10,0x25,0xff,0x12,0x13,0x2a,0xff,0x19,0x20,0x3e,0xff,0x21,0x2f,0x51,0xff,0x29,0x37,0x57,0xff,0x0b,0x0f,0x1d,0xff,0x28,0x33,0x45,0xff,0x16,0x1e,0x33,0xff,0x0d,0x14,0x25,0xff,0x27,0x35,0x4f,0xff,0x1e,0x30,0x51,0xff,0x45,0x61,0x8a,0xff,0x55,0x78,0xa2,0xff,0x40,0x5b,0x7a,0xff,0x7c,0xa2,0xbe,0xff,0x67,0x8d,0xa7,0xff,0x7f,0xa6,0xb9,0xff,0x8d,0xb0,0xc5,0xff,0x8b,0xad,0xca,0xff,0x8e,0xb4,0xd7,0xff,0x9a,0xbd,0xda,0xff,0x9e,0xbd,0xd7,0xff,0x91,0xae,0xcb,0xff,0x52,0x6e,0x93,0xff,0x47,0x61,0x89,0xff,0x3d,0x57,0x80,0xff,0x53,0x70,0x9a,0xff,0x3d,0x59,0x83,0xff,0x3c,0x55,0x7e,0xff,0x3c,0x5b,0x84,0xff,0x41,0x5e,0x7d,0xff,0x60,0x81,0xa8,0xff,0x60,0x87,0xb6,0xff,0x4b,0x67,0x94,0xff,0x16,0x1c,0x39,0xff,0x12,0x16,0x30,0xff,0x19,0x21,0x3f,0xff,0x2c,0x3c,0x61,0xff,0x2e,0x3e,0x5a,0xff,0x09,0x0b,0x13,0xff,0x00,0x00,0x00,0xff,0x5d,0x68,0x75,0xff,0x9a,0xc0,0xe3,0xff,0x5a,0x85,0xb6,0xff,0x41,0x61,0x8b,0xff,0x13,0x1c,0x3c,0xff,0x16,0x18,0x35,0xff,0x19,0x23,0x3d,0xff,0x1e,0x28,0x48,0xff,0x4d,0x6a,0x96,0xff,0x4a,0x67,0x90,0xff,0x31,0x41,0x5d,0xff,0x14,0x1e,0x29,0xff,0x27,0x2e,0x3d,0xff,0x1e,0x27,0x3a,0xff,0x03,0x09,0x10,0xff,0x1b,0x2c,0x41,0xff,0x5b,0x85,0xae,0xff,0x7b,0xa7,0xd4,0xff,0x44,0x64,0x88,0xff,0x45,0x5c,0x7e,0xff,0x31,0x41,0x5d,0xff,0x0b,0x11,0x1c,0xff,0x00,0x00,0x00,0xff,0x4d,0x55,0x5f,0xff,0x7a,0x94,0xb3,0xff,0x15,0x23,0x49,0xff,0x13,0x15,0x2f,0xff,0x13,0x17,0x30,0xff,0x13,0x17,0x30,0xff,0x18,0x1c,0x38,0xff,0x1b,0x1d,0x36,0xff,0x18,0x1b,0x31,0xff,0x2b,0x34,0x4d,0xff,0x1b,0x23,0x35,0xff,0x34,0x3e,0x55,0xff,0x11,0x14,0x1e,0xff,0x5e,0x72,0x8d,0xff,0x4f,0x6a,0x94,0xff,0x1e,0x28,0x4c,0xff,0x1a,0x1e,0x40,0xff,0x19,0x1e,0x3f,0xff,0x19,0x1e,0x3f,0xff,0x1b,0x1f,0x41,0xff,0x18,0x20,0x42,0xff,0x2e,0x41,0x64,0xff,0x20,0x29,0x47,0xff,0x33,0x3b,0x62,0xff,0x23,0x29,0x49,0xff,0x19,0x1f,0x3a,0xff,0x09,0x0c,0x1e,0xff,0x00,0x00,0x02,0xff,0x01,0x01,0x00,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x1a,0x1d,0x25,0xff,0xc8,0xd0,0xdd,0xd9,0xff,0xff,0xff,0x1d,0xff,0xff,0xff,0x00,0xfe,0xf0,0xf6,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xed,0xf4,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x05,0xd9,0xe0,0xea,0xc0,0x41,0x54,0x83,0xff,0x37,0x4e,0x92,0xff,0x4d,0x6c,0xaa,0xff,0x62,0x86,0xba,0xff,0x5e,0x86,0xa6,0xff,0x71,0x95,0xaa,0xff,0x99,0xbe,0xda,0xff,0x22,0x31,0x4e,0xff,0x09,0x0c,0x1f,0xff,0x0e,0x10,0x25,0xff,0x13,0x14,0x2c,0xff,0x19,0x20,0x3c,0xff,0x20,0x2e,0x50,0xff,0x2a,0x39,0x59,0xff,0x0c,0x11,0x1b,0xff,0x35,0x40,0x53,0xff,0x16,0x1d,0x33,0xff,0x10,0x15,0x26,0xff,0x21,0x2d,0x46,0xff,0x21,0x31,0x51,0xff,0x33,0x4b,0x73,0xff,0x68,0x8c,0xb7,0xff,0x20,0x34,0x55,0xff,0x70,0x8a,0xaa,0xff,0x9b,0xbf,0xd9,0xff,0xb4,0xd3,0xe4,0xff,0xbf,0xd9,0xea,0xff,0xa6,0xc8,0xdd,0xff,0x91,0xba,0xd7,0xff,0x8f,0xb3,0xd2,0xff,0x9b,0xbb,0xd7,0xff,0x68,0x82,0xa7,0xff,0x2d,0x41,0x6d,0xff,0x2f,0x40,0x6b,0xff,0x2a,0x3b,0x65,0xff,0x42,0x58,0x81,0xff,0x48,0x62,0x8e,0xff,0x40,0x5a,0x85,0xff,0x50,0x72,0x9c,0xff,0x4d,0x69,0x8c,0xff,0x48,0x66,0x90,0xff,0x64,0x91,0xc5,0xff,0x56,0x7e,0xa9,0xff,0x1f,0x28,0x46,0xff,0x12,0x14,0x30,0xff,0x19,0x1f,0x3c,0xff,0x2b,0x3c,0x5e,0xff,0x2e,0x3f,0x5d,0xff,0x05,0x05,0x0c,0xff,0x00,0x01,0x03,0xff,0x83,0x99,0xae,0xff,0x7e,0xa5,0xd2,0xff,0x3c,0x62,0x94,0xff,0x27,0x3f,0x68,0xff,0x14,0x18,0x36,0xff,0x13,0x14,0x30,0xff,0x15,0x1d,0x36,0xff,0x20,0x2d,0x51,0xff,0x55,0x71,0x98,0xff,0x23,0x32,0x49,0xff,0x1b,0x21,0x30,0xff,0x1b,0x22,0x2c,0xff,0x26,0x33,0x44,0xff,0x17,0x1f,0x2f,0xff,0x1e,0x2b,0x37,0xff,0x2b,0x3f,0x53,0xff,0x48,0x6c,0x92,0xff,0x76,0x99,0xc3,0xff,0x34,0x47,0x68,0xff,0x27,0x33,0x47,0xff,0x0d,0x0b,0x16,0xff,0x00,0x00,0x00,0xff,0x46,0x51,0x58,0xff,0x9a,0xb6,0xda,0xff,0x2a,0x3d,0x64,0xff,0x0c,0x16,0x2e,0xff,0x15,0x19,0x30,0xff,0x15,0x1a,0x34,0xff,0x18,0x1e,0x38,0xff,0x20,0x24,0x42,0xff,0x0f,0x11,0x23,0xff,0x03,0x03,0x0c,0xff,0x13,0x15,0x27,0xff,0x26,0x2e,0x44,0xff,0x28,0x32,0x4d,0xff,0x31,0x3f,0x5a,0xff,0x5f,0x83,0xaa,0xff,0x3b,0x53,0x7d,0xff,0x19,0x21,0x44,0xff,0x18,0x1d,0x3d,0xff,0x1a,0x1f,0x3f,0xff,0x18,0x1d,0x3e,0xff,0x19,0x1e,0x3f,0xff,0x1a,0x21,0x43,0xff,0x21,0x31,0x51,0xff,0x12,0x1b,0x35,0xff,0x04,0x04,0x1c,0xff,0x64,0x7c,0x9f,0xff,0x39,0x4b,0x76,0xff,0x09,0x0a,0x21,0xff,0x01,0x02,0x05,0xff,0x00,0x01,0x00,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x03,0x03,0x04,0xff,0x05,0x06,0x07,0xff,0x00,0x00,0x00,0xff,0x87,0x87,0x87,0xf9,0xff,0xff,0xff,0x3b,0xff,0xff,0xff,0x00,0xfe,0xf5,0xf9,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xf0,0xf5,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x1b,0xb4,0xb1,0xc4,0xd4,0x3f,0x4b,0x8d,0xff,0x3f,0x5b,0x9c,0xff,0x5c,0x7f,0xb2,0xff,0x5b,0x83,0xa1,0xff,0x8b,0xaf,0xc8,0xff,0x4a,0x5c,0x76,0xff,0x03,0x08,0x1d,0xff,0x0e,0x12,0x24,0xff,0x0e,0x10,0x26,0xff,0x14,0x13,0x2b,0xff,0x16,0x1c,0x37,0xff,0x1d,0x2c,0x4c,0xff,0x30,0x3e,0x5c,0xff,0x13,0x19,0x27,0xff,0x2f,0x3e,0x52,0xff,0x19,0x22,0x37,0xff,0x0f,0x14,0x25,0xff,0x1b,0x25,0x3e,0xff,0x29,0x39,0x58,0xff,0x23,0x3a,0x5f,0xff,0x5d,0x81,0xae,0xff,0x3a,0x57,0x7a,0xff,0x33,0x45,0x68,0xff,0xb8,0xd0,0xe7,0xff,0xcc,0xe7,0xf6,0xff,0xc0,0xd9,0xe9,0xff,0xab,0xcc,0xe0,0xff,0x98,0xc0,0xdb,0xff,0x8e,0xb2,0xd2,0xff,0x93,0xb4,0xd4,0xff,0x54,0x6e,0x93,0xff,0x2f,0x42,0x6f,0xff,0x33,0x43,0x6f,0xff,0x2b,0x3e,0x66,0xff,0x2d,0x42,0x6a,0xff,0x48,0x61,0x8c,0xff,0x40,0x5b,0x8a,0xff,0x53,0x75,0xa2,0xff,0x66,0x83,0xa0,0xff,0x7f,0x94,0xaa,0xff,0x91,0xb3,0xd8,0xff,0x5b,0x80,0xaa,0xff,0x1e,0x29,0x4c,0xff,0x0d,0x0e,0x2b,0xff,0x18,0x1b,0x37,0xff,0x27,0x34,0x57,0xff,0x2d,0x3e,0x5d,0xff,0x02,0x01,0x07,0xff,0x14,0x16,0x1d,0xff,0x8d,0xaf,0xd1,0xff,0x58,0x81,0xb4,0xff,0x35,0x53,0x83,0xff,0x1e,0x29,0x4e,0xff,0x15,0x17,0x32,0xff,0x14,0x16,0x31,0xff,0x15,0x1b,0x38,0xff,0x28,0x3b,0x60,0xff,0x4e,0x6a,0x8f,0xff,0x0a,0x12,0x21,0xff,0x19,0x1f,0x2b,0xff,0x2d,0x38,0x47,0xff,0x20,0x2e,0x3e,0xff,0x26,0x32,0x43,0xff,0x32,0x41,0x52,0xff,0x16,0x23,0x35,0xff,0x39,0x4e,0x73,0xff,0x40,0x56,0x7a,0xff,0x10,0x17,0x2c,0xff,0x08,0x14,0x1c,0xff,0x00,0x00,0x00,0xff,0x44,0x4b,0x52,0xff,0xa3,0xc4,0xe0,0xff,0x3b,0x59,0x81,0xff,0x0f,0x17,0x31,0xff,0x13,0x17,0x2f,0xff,0x15,0x1a,0x35,0xff,0x18,0x1d,0x3a,0xff,0x22,0x2a,0x47,0xff,0x15,0x19,0x2d,0xff,0x00,0x02,0x0a,0xff,0x00,0x01,0x05,0xff,0x1c,0x20,0x2f,0xff,0x29,0x2f,0x46,0xff,0x09,0x0d,0x1c,0xff,0x2a,0x36,0x47,0xff,0x65,0x88,0xb3,0xff,0x2f,0x47,0x6d,0xff,0x18,0x1e,0x41,0xff,0x19,0x1e,0x3f,0xff,0x19,0x1f,0x3e,0xff,0x19,0x1e,0x3e,0xff,0x17,0x1d,0x3e,0xff,0x18,0x1f,0x42,0xff,0x20,0x2b,0x4c,0xff,0x19,0x1e,0x3c,0xff,0x19,0x1c,0x38,0xff,0x66,0x84,0xac,0xff,0x29,0x3c,0x69,0xff,0x17,0x18,0x37,0xff,0x05,0x06,0x13,0xff,0x00,0x01,0x00,0xff,0x01,0x02,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x46,0x56,0x69,0xff,0x48,0x56,0x7e,0xff,0x73,0x72,0x78,0xfd,0xf9,0xf9,0xf7,0x5c,0xff,0xff,0xff,0x00,0xfe,0xf7,0xfa,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf5,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x22,0xb4,0xb8,0xd2,0xe2,0x40,0x55,0x93,0xff,0x59,0x7d,0xaa,0xff,0x5d,0x85,0xa0,0xff,0x7f,0xa2,0xbe,0xff,0x1a,0x22,0x38,0xff,0x07,0x06,0x15,0xff,0x0c,0x0f,0x20,0xff,0x0f,0x11,0x27,0xff,0x11,0x13,0x2a,0xff,0x15,0x1d,0x39,0xff,0x20,0x30,0x4d,0xff,0x30,0x3d,0x58,0xff,0x1a,0x22,0x32,0xff,0x30,0x43,0x57,0xff,0x1b,0x27,0x3c,0xff,0x0d,0x16,0x28,0xff,0x18,0x22,0x3c,0xff,0x2a,0x3e,0x5e,0xff,0x27,0x3d,0x5e,0xff,0x49,0x6b,0x97,0xff,0x67,0x8c,0xb7,0xff,0x1c,0x2d,0x53,0xff,0x8e,0xa1,0xb2,0xff,0xce,0xe8,0xf3,0xff,0xbc,0xd4,0xe5,0xff,0xad,0xca,0xe2,0xff,0x9a,0xbf,0xdd,0xff,0x8d,0xb3,0xd4,0xff,0x93,0xb6,0xd7,0xff,0x65,0x7e,0xa0,0xff,0x2b,0x3e,0x67,0xff,0x2f,0x3f,0x6a,0xff,0x2c,0x3d,0x66,0xff,0x24,0x36,0x5b,0xff,0x3b,0x53,0x7a,0xff,0x38,0x55,0x85,0xff,0x64,0x83,0xab,0xff,0xb4,0xd8,0xed,0xff,0xc0,0xde,0xf3,0xff,0xc8,0xe2,0xf0,0xff,0xb7,0xce,0xdf,0xff,0x64,0x74,0x91,0xff,0x1a,0x24,0x40,0xff,0x07,0x0d,0x2a,0xff,0x15,0x20,0x43,0xff,0x23,0x34,0x53,0xff,0x00,0x00,0x01,0xff,0x32,0x3a,0x48,0xff,0x7a,0xa3,0xd3,0xff,0x4c,0x73,0xaa,0xff,0x4a,0x67,0x90,0xff,0x18,0x20,0x3f,0xff,0x12,0x15,0x31,0xff,0x13,0x16,0x33,0xff,0x1a,0x21,0x42,0xff,0x34,0x4b,0x6e,0xff,0x43,0x5e,0x7d,0xff,0x13,0x19,0x2c,0xff,0x2c,0x37,0x45,0xff,0x0e,0x17,0x23,0xff,0x1c,0x2b,0x3f,0xff,0x3a,0x49,0x5f,0xff,0x2a,0x38,0x49,0xff,0x0c,0x12,0x22,0xff,0x2b,0x39,0x58,0xff,0x18,0x1f,0x33,0xff,0x03,0x06,0x0c,0xff,0x00,0x00,0x02,0xff,0x43,0x4c,0x54,0xff,0xb2,0xcf,0xe6,0xff,0x4a,0x67,0x8d,0xff,0x0c,0x17,0x36,0xff,0x12,0x15,0x30,0xff,0x14,0x18,0x34,0xff,0x15,0x1b,0x38,0xff,0x21,0x26,0x45,0xff,0x19,0x1d,0x34,0xff,0x01,0x03,0x0a,0xff,0x02,0x05,0x0a,0xff,0x01,0x04,0x0b,0xff,0x0c,0x10,0x1c,0xff,0x1b,0x20,0x2e,0xff,0x02,0x04,0x0e,0xff,0x13,0x16,0x22,0xff,0x5f,0x6f,0x8f,0xff,0x34,0x46,0x6b,0xff,0x17,0x21,0x42,0xff,0x18,0x1f,0x40,0xff,0x1a,0x1e,0x3f,0xff,0x18,0x1d,0x3d,0xff,0x17,0x1d,0x3e,0xff,0x18,0x1f,0x41,0xff,0x1f,0x26,0x49,0xff,0x1d,0x23,0x3d,0xff,0x15,0x1d,0x39,0xff,0x4f,0x6c,0x96,0xff,0x2f,0x44,0x6f,0xff,0x23,0x2d,0x4f,0xff,0x0a,0x0b,0x21,0xff,0x01,0x01,0x06,0xff,0x00,0x00,0x02,0xff,0x00,0x00,0x00,0xff,0x0a,0x0b,0x0e,0xff,0x52,0x6b,0x94,0xff,0x78,0x84,0xab,0xff,0xf6,0xf6,0xf9,0x6a,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf8,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xf6,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x40,0xa8,0xb2,0xcb,0xf9,0x5c,0x7d,0xa4,0xff,0x50,0x78,0x95,0xff,0x73,0x91,0xaf,0xff,0x09,0x11,0x26,0xff,0x08,0x08,0x16,0xff,0x0b,0x0c,0x1c,0xff,0x0e,0x0f,0x24,0xff,0x12,0x14,0x2c,0xff,0x18,0x20,0x3d,0xff,0x27,0x34,0x53,0xff,0x24,0x2e,0x48,0xff,0x15,0x1d,0x2e,0xff,0x30,0x43,0x56,0xff,0x1e,0x2b,0x40,0xff,0x11,0x1b,0x2e,0xff,0x1a,0x25,0x3e,0xff,0x2a,0x3d,0x5e,0xff,0x27,0x3c,0x5d,0xff,0x33,0x53,0x7c,0xff,0x7f,0xa7,0xd5,0xff,0x55,0x79,0xa1,0xff,0x88,0xa1,0xb5,0xff,0xca,0xe5,0xef,0xff,0xbd,0xd7,0xe6,0xff,0xb4,0xce,0xe4,0xff,0xa2,0xc7,0xe5,0xff,0x8a,0xb3,0xd8,0xff,0x81,0xa8,0xcc,0xff,0x82,0xa1,0xc4,0xff,0x46,0x5f,0x84,0xff,0x40,0x57,0x7f,0xff,0x3c,0x55,0x7a,0xff,0x31,0x4b,0x6f,0xff,0x2e,0x48,0x70,0xff,0x45,0x63,0x89,0xff,0x9f,0xc1,0xdd,0xff,0xa2,0xc4,0xe7,0xff,0x82,0x9b,0xbb,0xff,0x96,0xae,0xc5,0xff,0xbe,0xd9,0xe8,0xff,0xe0,0xf0,0xf7,0xff,0xbb,0xce,0xdb,0xff,0x78,0x8c,0x9e,0xff,0x41,0x51,0x6e,0xff,0x24,0x33,0x55,0xff,0x00,0x00,0x01,0xff,0x4f,0x5e,0x75,0xff,0x6d,0x94,0xc8,0xff,0x49,0x69,0x9c,0xff,0x2b,0x40,0x66,0xff,0x10,0x11,0x30,0xff,0x14,0x17,0x34,0xff,0x12,0x16,0x34,0xff,0x1f,0x27,0x48,0xff,0x3a,0x52,0x74,0xff,0x26,0x3b,0x55,0xff,0x27,0x32,0x49,0xff,0x27,0x34,0x44,0xff,0x03,0x06,0x0a,0xff,0x3d,0x52,0x67,0xff,0x2b,0x3c,0x54,0xff,0x2a,0x32,0x46,0xff,0x1d,0x22,0x36,0xff,0x26,0x2f,0x45,0xff,0x0b,0x0f,0x1a,0xff,0x00,0x00,0x00,0xff,0x45,0x4c,0x55,0xff,0xaf,0xcd,0xe5,0xff,0x4c,0x69,0x8e,0xff,0x09,0x15,0x32,0xff,0x12,0x16,0x2e,0xff,0x14,0x18,0x35,0xff,0x18,0x1c,0x3a,0xff,0x20,0x27,0x49,0xff,0x1f,0x23,0x40,0xff,0x04,0x04,0x0d,0xff,0x03,0x03,0x08,0xff,0x06,0x06,0x0f,0xff,0x04,0x07,0x10,0xff,0x04,0x09,0x12,0xff,0x0f,0x13,0x1e,0xff,0x0a,0x0f,0x1e,0xff,0x1a,0x20,0x2d,0xff,0x19,0x1d,0x27,0xff,0x30,0x3a,0x5c,0xff,0x1c,0x25,0x48,0xff,0x1b,0x22,0x44,0xff,0x1a,0x1f,0x41,0xff,0x17,0x1d,0x3f,0xff,0x16,0x1d,0x3d,0xff,0x19,0x1e,0x3f,0xff,0x1e,0x26,0x46,0xff,0x1a,0x1e,0x36,0xff,0x1e,0x28,0x49,0xff,0x4a,0x63,0x93,0xff,0x38,0x4d,0x76,0xff,0x1a,0x26,0x45,0xff,0x16,0x17,0x30,0xff,0x0d,0x0f,0x22,0xff,0x07,0x09,0x18,0xff,0x09,0x09,0x1c,0xff,0x09,0x0c,0x1f,0xff,0x82,0x91,0xac,0xff,0xed,0xee,0xf2,0x92,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xeb,0xf2,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x56,0xb6,0xc6,0xd5,0xfb,0x4b,0x71,0x8e,0xff,0x6b,0x89,0xa8,0xff,0x07,0x0d,0x24,0xff,0x09,0x08,0x16,0xff,0x0b,0x0d,0x1b,0xff,0x0d,0x0f,0x23,0xff,0x13,0x14,0x2f,0xff,0x1a,0x21,0x41,0xff,0x24,0x31,0x51,0xff,0x1d,0x26,0x3d,0xff,0x16,0x1f,0x30,0xff,0x1d,0x2d,0x3f,0xff,0x28,0x33,0x49,0xff,0x17,0x20,0x35,0xff,0x17,0x21,0x39,0xff,0x2a,0x3d,0x5e,0xff,0x29,0x3e,0x5f,0xff,0x32,0x50,0x78,0xff,0x5a,0x80,0xb0,0xff,0x7f,0xa7,0xd2,0xff,0x9f,0xc1,0xd6,0xff,0xc5,0xe2,0xea,0xff,0xc0,0xdb,0xe9,0xff,0xc6,0xe1,0xf6,0xff,0x9d,0xc0,0xdc,0xff,0x50,0x71,0x8f,0xff,0x31,0x4b,0x6a,0xff,0x3e,0x54,0x76,0xff,0x72,0x96,0xba,0xff,0x83,0xa7,0xcb,0xff,0x8f,0xb0,0xd1,0xff,0xa5,0xc5,0xdf,0xff,0x5f,0x7b,0x9d,0xff,0x78,0x95,0xb5,0xff,0x89,0xa9,0xc4,0xff,0x4d,0x63,0x83,0xff,0x1c,0x24,0x3e,0xff,0x17,0x21,0x3d,0xff,0x59,0x6e,0x88,0xff,0x9e,0xbb,0xca,0xff,0xb2,0xcf,0xd9,0xff,0xd3,0xed,0xf4,0xff,0xd1,0xe8,0xf0,0xff,0xac,0xc0,0xcc,0xff,0x43,0x48,0x50,0xff,0x42,0x53,0x77,0xff,0x58,0x83,0xbc,0xff,0x37,0x58,0x87,0xff,0x13,0x27,0x4f,0xff,0x2d,0x3b,0x5f,0xff,0x17,0x1f,0x40,0xff,0x13,0x17,0x34,0xff,0x21,0x27,0x47,0xff,0x3d,0x55,0x76,0xff,0x20,0x34,0x4b,0xff,0x2f,0x41,0x58,0xff,0x12,0x1c,0x2b,0xff,0x02,0x03,0x05,0xff,0x34,0x43,0x58,0xff,0x28,0x36,0x4d,0xff,0x16,0x17,0x22,0xff,0x12,0x17,0x27,0xff,0x1e,0x25,0x3d,0xff,0x00,0x01,0x05,0xff,0x42,0x4d,0x55,0xff,0xb5,0xd3,0xec,0xff,0x52,0x69,0x8e,0xff,0x0b,0x0e,0x2d,0xff,0x11,0x15,0x2c,0xff,0x13,0x18,0x32,0xff,0x17,0x1b,0x39,0xff,0x1f,0x25,0x47,0xff,0x24,0x2a,0x47,0xff,0x08,0x09,0x13,0xff,0x00,0x00,0x04,0xff,0x06,0x06,0x0e,0xff,0x05,0x06,0x10,0xff,0x05,0x07,0x11,0xff,0x03,0x05,0x0e,0xff,0x11,0x14,0x1f,0xff,0x09,0x0e,0x17,0xff,0x00,0x00,0x02,0xff,0x0d,0x10,0x17,0xff,0x2e,0x37,0x5a,0xff,0x17,0x1e,0x44,0xff,0x11,0x17,0x3c,0xff,0x14,0x19,0x3e,0xff,0x19,0x1e,0x41,0xff,0x16,0x1e,0x3e,0xff,0x19,0x1e,0x3e,0xff,0x1c,0x22,0x42,0xff,0x17,0x20,0x3f,0xff,0x54,0x72,0x9e,0xff,0x4c,0x68,0x96,0xff,0x28,0x3c,0x64,0xff,0x1f,0x2d,0x51,0xff,0x15,0x1e,0x3e,0xff,0x16,0x21,0x3f,0xff,0x19,0x21,0x42,0xff,0x22,0x28,0x55,0xff,0x65,0x6c,0x89,0xff,0xed,0xee,0xf1,0xa5,0xff,0xff,0xff,0x03,0xff,0xfd,0xfd,0x00,0xfe,0xec,0xf3,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf6,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf1,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xfb,0xfc,0xfc,0x55,0xc3,0xd2,0xde,0xfb,0x65,0x78,0x97,0xff,0x00,0x01,0x1a,0xff,0x09,0x0b,0x18,0xff,0x0a,0x0d,0x1a,0xff,0x0c,0x0f,0x24,0xff,0x16,0x19,0x34,0xff,0x1b,0x23,0x44,0xff,0x22,0x33,0x51,0xff,0x20,0x2b,0x3f,0xff,0x19,0x22,0x34,0xff,0x16,0x20,0x32,0xff,0x24,0x2e,0x43,0xff,0x1d,0x26,0x3b,0xff,0x20,0x2a,0x42,0xff,0x26,0x3a,0x5b,0xff,0x20,0x36,0x57,0xff,0x3c,0x55,0x7d,0xff,0x43,0x68,0x97,0xff,0x67,0x8f,0xba,0xff,0x9b,0xc0,0xd9,0xff,0xbf,0xde,0xee,0xff,0xb8,0xd8,0xee,0xff,0x79,0x92,0xa5,0xff,0x1d,0x29,0x35,0xff,0x05,0x0a,0x19,0xff,0x08,0x09,0x17,0xff,0x0b,0x10,0x1f,0xff,0x3d,0x54,0x6d,0xff,0x3f,0x59,0x78,0xff,0x20,0x31,0x4d,0xff,0x35,0x49,0x61,0xff,0x7c,0x96,0xac,0xff,0xb5,0xd4,0xeb,0xff,0x43,0x56,0x7e,0xff,0x07,0x0a,0x22,0xff,0x2c,0x33,0x44,0xff,0x63,0x77,0x8d,0xff,0x58,0x74,0x8c,0xff,0x7b,0x99,0xac,0xff,0x93,0xb4,0xc0,0xff,0xb3,0xd1,0xde,0xff,0xba,0xd8,0xe1,0xff,0xc8,0xe4,0xeb,0xff,0xc8,0xde,0xe6,0xff,0x85,0xa0,0xb9,0xff,0x5f,0x86,0xba,0xff,0x46,0x6a,0x9d,0xff,0x41,0x61,0x8b,0xff,0x56,0x74,0xa0,0xff,0x1e,0x2b,0x4f,0xff,0x14,0x16,0x32,0xff,0x12,0x18,0x34,0xff,0x1c,0x2d,0x4f,0xff,0x34,0x47,0x61,0xff,0x1d,0x2c,0x3a,0xff,0x02,0x07,0x0d,0xff,0x01,0x00,0x00,0xff,0x19,0x20,0x32,0xff,0x1a,0x26,0x39,0xff,0x03,0x06,0x0a,0xff,0x15,0x1b,0x26,0xff,0x0f,0x16,0x2b,0xff,0x41,0x4d,0x5b,0xff,0xa6,0xc6,0xe1,0xff,0x4c,0x6c,0x92,0xff,0x11,0x19,0x37,0xff,0x11,0x16,0x30,0xff,0x11,0x15,0x2f,0xff,0x14,0x19,0x36,0xff,0x18,0x21,0x44,0xff,0x26,0x2f,0x53,0xff,0x13,0x15,0x26,0xff,0x00,0x00,0x01,0xff,0x02,0x03,0x08,0xff,0x05,0x04,0x0d,0xff,0x04,0x05,0x0f,0xff,0x07,0x08,0x12,0xff,0x03,0x04,0x0e,0xff,0x10,0x13,0x1c,0xff,0x03,0x03,0x06,0xff,0x00,0x00,0x00,0xff,0x0a,0x10,0x20,0xff,0x2d,0x3f,0x65,0xff,0x3a,0x4b,0x6e,0xff,0x53,0x66,0x87,0xff,0x34,0x44,0x69,0xff,0x1c,0x23,0x47,0xff,0x19,0x1f,0x42,0xff,0x18,0x1f,0x42,0xff,0x15,0x1d,0x3e,0xff,0x2c,0x3b,0x61,0xff,0x76,0x9f,0xd0,0xff,0x3b,0x5a,0x8b,0xff,0x39,0x57,0x82,0xff,0x46,0x63,0x8f,0xff,0x1f,0x29,0x4f,0xff,0x1a,0x23,0x44,0xff,0x1b,0x26,0x4e,0xff,0x6e,0x77,0x98,0xff,0xed,0xee,0xf3,0xa4,0xff,0xff,0xff,0x01,0xff,0xfd,0xfe,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xef,0x00,0xfd,0xe7,0xf1,0x00,0xff,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x54,0xae,0xb4,0xc0,0xfb,0x14,0x18,0x29,0xff,0x02,0x04,0x0f,0xff,0x09,0x0c,0x19,0xff,0x0f,0x10,0x29,0xff,0x1b,0x1e,0x3c,0xff,0x1d,0x27,0x48,0xff,0x30,0x43,0x62,0xff,0x23,0x2f,0x42,0xff,0x20,0x29,0x39,0xff,0x0c,0x12,0x25,0xff,0x1d,0x24,0x37,0xff,0x12,0x19,0x2d,0xff,0x20,0x2a,0x40,0xff,0x26,0x3a,0x59,0xff,0x24,0x39,0x5b,0xff,0x2f,0x48,0x6f,0xff,0x46,0x6a,0x98,0xff,0x50,0x78,0xa5,0xff,0x7c,0xa7,0xca,0xff,0x91,0xb8,0xd6,0xff,0x51,0x6a,0x84,0xff,0x15,0x19,0x24,0xff,0x15,0x13,0x1e,0xff,0x0d,0x0e,0x15,0xff,0x0e,0x10,0x17,0xff,0x15,0x15,0x20,0xff,0x1a,0x23,0x3c,0xff,0x3a,0x50,0x72,0xff,0x44,0x5c,0x7c,0xff,0x5c,0x7b,0x98,0xff,0x97,0xb7,0xcd,0xff,0xaf,0xce,0xe5,0xff,0xa5,0xbf,0xda,0xff,0x7b,0x90,0xae,0xff,0x6e,0x86,0x9f,0xff,0x94,0xb4,0xc7,0xff,0xa6,0xc6,0xd8,0xff,0xa7,0xc6,0xd5,0xff,0x9c,0xbc,0xc8,0xff,0xa9,0xc7,0xd5,0xff,0xac,0xc9,0xd6,0xff,0xac,0xcb,0xd7,0xff,0xb0,0xd0,0xde,0xff,0xba,0xdd,0xe8,0xff,0xa7,0xc7,0xe0,0xff,0x63,0x84,0xb0,0xff,0x4a,0x72,0x9f,0xff,0x47,0x64,0x93,0xff,0x24,0x30,0x54,0xff,0x14,0x17,0x31,0xff,0x13,0x17,0x30,0xff,0x14,0x18,0x35,0xff,0x36,0x49,0x6b,0xff,0x17,0x1b,0x27,0xff,0x00,0x00,0x00,0xff,0x00,0x01,0x01,0xff,0x19,0x21,0x33,0xff,0x21,0x2d,0x3f,0xff,0x14,0x17,0x1a,0xff,0x20,0x27,0x35,0xff,0x41,0x4d,0x61,0xff,0xa8,0xcc,0xe5,0xff,0x57,0x77,0xa0,0xff,0x16,0x26,0x45,0xff,0x2b,0x36,0x4f,0xff,0x17,0x21,0x3d,0xff,0x14,0x19,0x37,0xff,0x1d,0x24,0x44,0xff,0x28,0x30,0x56,0xff,0x20,0x22,0x3e,0xff,0x02,0x02,0x05,0xff,0x01,0x02,0x05,0xff,0x02,0x02,0x08,0xff,0x03,0x03,0x0b,0xff,0x04,0x05,0x0e,0xff,0x06,0x07,0x10,0xff,0x00,0x01,0x07,0xff,0x09,0x0d,0x14,0xff,0x2c,0x35,0x44,0xff,0x4c,0x59,0x65,0xff,0x5d,0x77,0x90,0xff,0x95,0xba,0xdb,0xff,0xa2,0xc8,0xec,0xff,0x7f,0xa2,0xbd,0xff,0x40,0x54,0x73,0xff,0x16,0x20,0x3b,0xff,0x15,0x19,0x37,0xff,0x1d,0x22,0x43,0xff,0x18,0x22,0x43,0xff,0x2a,0x3a,0x60,0xff,0x68,0x8e,0xbf,0xff,0x49,0x6d,0xa0,0xff,0x6d,0x97,0xc3,0xff,0x5f,0x87,0xb9,0xff,0x2b,0x3c,0x69,0xff,0x1b,0x21,0x47,0xff,0x75,0x7b,0x94,0xff,0xf0,0xf2,0xf5,0xa3,0xff,0xff,0xff,0x02,0xff,0xfd,0xfe,0x00,0xfe,0xec,0xf4,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x4e,0xb0,0xb2,0xb6,0xef,0x22,0x23,0x31,0xff,0x01,0x04,0x15,0xff,0x14,0x15,0x2f,0xff,0x1c,0x1e,0x3d,0xff,0x1e,0x2a,0x4c,0xff,0x42,0x5b,0x7e,0xff,0x1f,0x2d,0x3f,0xff,0x1c,0x22,0x30,0xff,0x08,0x0b,0x1a,0xff,0x1f,0x27,0x38,0xff,0x0d,0x15,0x27,0xff,0x14,0x1b,0x2f,0xff,0x2a,0x3c,0x5a,0xff,0x2b,0x3e,0x61,0xff,0x2f,0x49,0x70,0xff,0x48,0x6d,0x99,0xff,0x4f,0x73,0xa5,0xff,0x6f,0x9a,0xca,0xff,0x64,0x87,0xa8,0xff,0x27,0x2a,0x3c,0xff,0x21,0x21,0x2e,0xff,0x05,0x06,0x0a,0xff,0x00,0x00,0x00,0xff,0x02,0x03,0x06,0xff,0x3e,0x4c,0x5c,0xff,0x78,0x93,0xaf,0xff,0x99,0xbf,0xe1,0xff,0xa9,0xcf,0xee,0xff,0xbe,0xe6,0xfc,0xff,0xc8,0xee,0xff,0xff,0x71,0x8e,0xb2,0xff,0x55,0x70,0x93,0xff,0x42,0x55,0x75,0xff,0x21,0x2b,0x47,0xff,0x4c,0x60,0x7a,0xff,0x65,0x7b,0x91,0xff,0xa9,0xc8,0xd9,0xff,0x8c,0xad,0xbc,0xff,0x90,0xb5,0xc2,0xff,0x99,0xbc,0xca,0xff,0x9f,0xc1,0xcf,0xff,0xa0,0xc4,0xd2,0xff,0xa3,0xc5,0xd3,0xff,0xae,0xcf,0xde,0xff,0xa2,0xc4,0xdb,0xff,0x5f,0x84,0xae,0xff,0x3e,0x5a,0x8a,0xff,0x21,0x2d,0x50,0xff,0x13,0x18,0x31,0xff,0x17,0x1b,0x35,0xff,0x17,0x1a,0x34,0xff,0x25,0x2c,0x4d,0xff,0x38,0x41,0x5b,0xff,0x01,0x02,0x04,0xff,0x01,0x03,0x04,0xff,0x22,0x2c,0x3d,0xff,0x1f,0x2c,0x3d,0xff,0x11,0x12,0x17,0xff,0x3b,0x4a,0x58,0xff,0xa6,0xc6,0xe7,0xff,0x6b,0x8a,0xae,0xff,0x1f,0x32,0x50,0xff,0x27,0x36,0x4e,0xff,0x2e,0x3b,0x57,0xff,0x25,0x30,0x4e,0xff,0x24,0x2b,0x4d,0xff,0x28,0x2d,0x56,0xff,0x29,0x2c,0x4c,0xff,0x05,0x06,0x0e,0xff,0x00,0x02,0x02,0xff,0x02,0x03,0x06,0xff,0x02,0x02,0x06,0xff,0x05,0x04,0x0b,0xff,0x03,0x03,0x09,0xff,0x00,0x00,0x02,0xff,0x18,0x19,0x21,0xff,0x49,0x58,0x6c,0xff,0x73,0x96,0xb9,0xff,0x90,0xb8,0xdc,0xff,0x75,0x98,0xbf,0xff,0x4d,0x62,0x83,0xff,0x37,0x4c,0x6b,0xff,0x22,0x2d,0x4c,0xff,0x0a,0x0c,0x1a,0xff,0x02,0x03,0x07,0xff,0x03,0x03,0x07,0xff,0x0d,0x0d,0x16,0xff,0x15,0x1a,0x2f,0xff,0x26,0x37,0x5d,0xff,0x56,0x7f,0xb3,0xff,0x72,0x9e,0xcf,0xff,0x8c,0xb9,0xe5,0xff,0x67,0x91,0xc5,0xff,0x2e,0x45,0x73,0xff,0x80,0x86,0x9c,0xff,0xf5,0xf6,0xf7,0x97,0xff,0xff,0xff,0x02,0xff,0xfc,0xfd,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xff,0xf7,0xfa,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x2b,0xc7,0xc7,0xcc,0xd6,0x36,0x39,0x48,0xff,0x0b,0x0d,0x28,0xff,0x16,0x17,0x37,0xff,0x1a,0x22,0x42,0xff,0x44,0x60,0x85,0xff,0x3f,0x53,0x6e,0xff,0x12,0x16,0x26,0xff,0x04,0x06,0x11,0xff,0x25,0x32,0x47,0xff,0x0f,0x17,0x2a,0xff,0x03,0x07,0x17,0xff,0x23,0x32,0x50,0xff,0x2b,0x3d,0x5f,0xff,0x3f,0x59,0x80,0xff,0x49,0x6c,0x9a,0xff,0x4e,0x74,0xa2,0xff,0x6d,0x95,0xc2,0xff,0x2c,0x39,0x57,0xff,0x16,0x14,0x1c,0xff,0x00,0x00,0x00,0xff,0x03,0x04,0x05,0xff,0x16,0x1d,0x24,0xff,0x7d,0x90,0x9e,0xff,0xae,0xcf,0xef,0xff,0x89,0xb5,0xdc,0xff,0x69,0x95,0xbc,0xff,0x68,0x93,0xb8,0xff,0x8b,0xb6,0xd6,0xff,0xb6,0xd6,0xf5,0xff,0x6c,0x88,0xad,0xff,0x2f,0x40,0x64,0xff,0x43,0x57,0x79,0xff,0x2e,0x3d,0x61,0xff,0x0e,0x15,0x37,0xff,0x1e,0x28,0x47,0xff,0x7b,0x99,0xae,0xff,0x65,0x81,0x93,0xff,0x4e,0x6b,0x7e,0xff,0x63,0x86,0x98,0xff,0x7d,0xa4,0xb3,0xff,0x8e,0xb3,0xc3,0xff,0x97,0xba,0xcb,0xff,0x98,0xb9,0xca,0xff,0xa4,0xc7,0xd6,0xff,0x8c,0xb0,0xce,0xff,0x41,0x5f,0x89,0xff,0x1b,0x29,0x4c,0xff,0x11,0x16,0x31,0xff,0x16,0x19,0x36,0xff,0x18,0x1c,0x39,0xff,0x16,0x19,0x3a,0xff,0x39,0x46,0x69,0xff,0x1d,0x23,0x31,0xff,0x0c,0x0d,0x14,0xff,0x21,0x27,0x3a,0xff,0x0e,0x16,0x24,0xff,0x1e,0x24,0x30,0xff,0x9d,0xb7,0xcc,0xff,0x86,0xad,0xd3,0xff,0x28,0x3d,0x5f,0xff,0x20,0x2a,0x43,0xff,0x2a,0x38,0x52,0xff,0x29,0x37,0x54,0xff,0x26,0x30,0x52,0xff,0x24,0x2f,0x52,0xff,0x2b,0x32,0x5b,0xff,0x13,0x15,0x28,0xff,0x00,0x00,0x00,0xff,0x02,0x03,0x04,0xff,0x00,0x03,0x05,0xff,0x01,0x03,0x05,0xff,0x02,0x00,0x04,0xff,0x07,0x07,0x0f,0xff,0x39,0x46,0x54,0xff,0x81,0x9f,0xbc,0xff,0x87,0xb4,0xd6,0xff,0x63,0x8c,0xaf,0xff,0x46,0x61,0x83,0xff,0x14,0x20,0x33,0xff,0x01,0x01,0x07,0xff,0x01,0x02,0x03,0xff,0x13,0x13,0x1a,0xff,0x0a,0x0a,0x0c,0xff,0x02,0x01,0x01,0xff,0x02,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x14,0x1c,0x2f,0xff,0x4b,0x6c,0x98,0xff,0x6c,0x92,0xbf,0xff,0x65,0x8e,0xb9,0xff,0x4b,0x66,0x90,0xff,0x9f,0xa8,0xbc,0xfc,0xfb,0xfc,0xfc,0x6a,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xfb,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x17,0xdd,0xde,0xe0,0xcb,0x59,0x5a,0x6b,0xff,0x0e,0x10,0x2f,0xff,0x13,0x1a,0x38,0xff,0x38,0x4c,0x72,0xff,0x59,0x77,0x9e,0xff,0x23,0x30,0x46,0xff,0x04,0x05,0x10,0xff,0x2e,0x3e,0x54,0xff,0x17,0x20,0x36,0xff,0x02,0x03,0x12,0xff,0x27,0x35,0x53,0xff,0x20,0x33,0x54,0xff,0x36,0x4e,0x76,0xff,0x49,0x67,0x96,0xff,0x4e,0x74,0x9f,0xff,0x44,0x5f,0x81,0xff,0x19,0x1d,0x2a,0xff,0x05,0x06,0x06,0xff,0x07,0x05,0x07,0xff,0x18,0x1a,0x20,0xff,0x9c,0xb7,0xc6,0xff,0xb9,0xde,0xfa,0xff,0x88,0xad,0xd6,0xff,0x71,0x9b,0xc3,0xff,0x5e,0x87,0xaf,0xff,0x5b,0x7e,0xa4,0xff,0x59,0x7c,0xa3,0xff,0x75,0x9a,0xc2,0xff,0x79,0x98,0xbd,0xff,0x10,0x19,0x34,0xff,0x0f,0x17,0x37,0xff,0x58,0x66,0x91,0xff,0x60,0x6e,0x8f,0xff,0x2c,0x3d,0x5d,0xff,0x4e,0x66,0x7f,0xff,0x20,0x2d,0x42,0xff,0x0c,0x13,0x29,0xff,0x15,0x22,0x37,0xff,0x32,0x4a,0x5d,0xff,0x59,0x7b,0x8d,0xff,0x79,0x9e,0xb0,0xff,0x8c,0xae,0xc1,0xff,0x90,0xb3,0xc5,0xff,0x8f,0xb3,0xc9,0xff,0x49,0x67,0x8e,0xff,0x1c,0x2b,0x4b,0xff,0x12,0x17,0x30,0xff,0x14,0x19,0x34,0xff,0x18,0x1a,0x37,0xff,0x16,0x1a,0x39,0xff,0x20,0x2a,0x4a,0xff,0x3e,0x4e,0x73,0xff,0x1e,0x25,0x3a,0xff,0x0b,0x10,0x1b,0xff,0x18,0x22,0x31,0xff,0x86,0x9c,0xac,0xff,0xa9,0xcb,0xef,0xff,0x3c,0x58,0x7b,0xff,0x19,0x2a,0x3f,0xff,0x27,0x32,0x4b,0xff,0x2d,0x39,0x54,0xff,0x26,0x32,0x4f,0xff,0x24,0x2d,0x4f,0xff,0x26,0x2f,0x56,0xff,0x23,0x29,0x49,0xff,0x03,0x03,0x09,0xff,0x03,0x00,0x04,0xff,0x02,0x02,0x04,0xff,0x00,0x01,0x05,0xff,0x02,0x00,0x02,0xff,0x05,0x06,0x09,0xff,0x39,0x4a,0x65,0xff,0x5a,0x78,0x9b,0xff,0x2c,0x44,0x62,0xff,0x28,0x40,0x5d,0xff,0x39,0x52,0x6e,0xff,0x26,0x32,0x41,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x02,0xff,0x00,0x01,0x02,0xff,0x03,0x04,0x03,0xff,0x07,0x0a,0x0a,0xff,0x00,0x01,0x02,0xff,0x01,0x01,0x02,0xff,0x01,0x01,0x03,0xff,0x00,0x00,0x01,0xff,0x01,0x00,0x00,0xff,0x12,0x19,0x26,0xff,0x1e,0x2c,0x48,0xff,0x44,0x51,0x68,0xff,0xb6,0xb9,0xc1,0xf9,0xff,0xff,0xff,0x53,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xea,0xf2,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xfb,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x10,0xf1,0xf1,0xf2,0x9f,0x7c,0x7e,0x8d,0xff,0x17,0x1d,0x39,0xff,0x20,0x33,0x59,0xff,0x5c,0x7c,0xa2,0xff,0x32,0x42,0x5a,0xff,0x02,0x01,0x0e,0xff,0x24,0x36,0x4a,0xff,0x2d,0x3b,0x54,0xff,0x04,0x00,0x11,0xff,0x2a,0x37,0x55,0xff,0x31,0x44,0x63,0xff,0x28,0x3a,0x59,0xff,0x33,0x4b,0x75,0xff,0x45,0x67,0x93,0xff,0x23,0x33,0x4b,0xff,0x05,0x05,0x07,0xff,0x00,0x00,0x00,0xff,0x0e,0x0e,0x10,0xff,0x93,0xa1,0xa8,0xff,0xcd,0xed,0xfd,0xff,0xa9,0xcc,0xed,0xff,0x84,0xac,0xd5,0xff,0x51,0x77,0xa0,0xff,0x25,0x42,0x63,0xff,0x17,0x29,0x45,0xff,0x24,0x32,0x50,0xff,0x26,0x34,0x4f,0xff,0x2a,0x35,0x4d,0xff,0x29,0x34,0x4a,0xff,0x32,0x3e,0x5d,0xff,0x51,0x63,0x8f,0xff,0x71,0x85,0xa3,0xff,0x85,0x9f,0xb5,0xff,0xa9,0xc4,0xd7,0xff,0x2f,0x38,0x49,0xff,0x07,0x09,0x1c,0xff,0x0f,0x10,0x24,0xff,0x0b,0x10,0x24,0xff,0x19,0x27,0x3d,0xff,0x4a,0x66,0x7b,0xff,0x72,0x95,0xab,0xff,0x80,0xa5,0xb9,0xff,0x7f,0xa4,0xbc,0xff,0x4c,0x67,0x91,0xff,0x22,0x30,0x52,0xff,0x11,0x16,0x2f,0xff,0x12,0x17,0x30,0xff,0x17,0x1a,0x36,0xff,0x19,0x1e,0x3b,0xff,0x15,0x1c,0x3b,0xff,0x38,0x4b,0x77,0xff,0x1e,0x28,0x3d,0xff,0x00,0x01,0x0b,0xff,0x74,0x8a,0xa0,0xff,0xb7,0xdd,0xf6,0xff,0x59,0x7a,0x9f,0xff,0x1c,0x2d,0x49,0xff,0x25,0x2f,0x46,0xff,0x2c,0x39,0x51,0xff,0x2c,0x38,0x53,0xff,0x26,0x30,0x4e,0xff,0x21,0x2b,0x4f,0xff,0x27,0x35,0x5a,0xff,0x10,0x14,0x23,0xff,0x00,0x00,0x00,0xff,0x01,0x00,0x05,0xff,0x01,0x00,0x04,0xff,0x01,0x01,0x05,0xff,0x09,0x09,0x0e,0xff,0x1e,0x2b,0x42,0xff,0x4d,0x6b,0x93,0xff,0x3f,0x5a,0x7f,0xff,0x27,0x33,0x49,0xff,0x11,0x18,0x27,0xff,0x1c,0x25,0x32,0xff,0x0a,0x0e,0x11,0xff,0x02,0x01,0x00,0xff,0x02,0x01,0x00,0xff,0x01,0x01,0x00,0xff,0x01,0x00,0x00,0xff,0x02,0x03,0x03,0xff,0x01,0x02,0x01,0xff,0x01,0x00,0x02,0xff,0x01,0x00,0x03,0xff,0x01,0x01,0x03,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x01,0xff,0x48,0x4a,0x53,0xff,0xcc,0xcb,0xcd,0xd6,0xff,0xff,0xff,0x3b,0xff,0xff,0xff,0x00,0xff,0xf7,0xfa,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xee,0xf4,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xfd,0xfd,0xfd,0x79,0xaa,0xad,0xb6,0xfa,0x2e,0x3c,0x54,0xff,0x4c,0x6a,0x8b,0xff,0x5a,0x70,0x8f,0xff,0x00,0x00,0x12,0xff,0x1f,0x30,0x40,0xff,0x43,0x61,0x7c,0xff,0x09,0x09,0x19,0xff,0x1a,0x23,0x3e,0xff,0x3b,0x53,0x71,0xff,0x1e,0x2f,0x4a,0xff,0x20,0x2e,0x4b,0xff,0x35,0x47,0x6d,0xff,0x15,0x1d,0x2f,0xff,0x00,0x00,0x00,0xff,0x0d,0x0e,0x15,0xff,0x7d,0x94,0xa3,0xff,0xc6,0xe5,0xf5,0xff,0xc0,0xe3,0xf6,0xff,0x9a,0xc1,0xdf,0xff,0x5b,0x88,0xb2,0xff,0x42,0x65,0x8c,0xff,0x36,0x4c,0x70,0xff,0x2d,0x41,0x5d,0xff,0x0e,0x14,0x23,0xff,0x02,0x00,0x0b,0xff,0x00,0x00,0x0e,0xff,0x1a,0x29,0x3a,0xff,0x4b,0x62,0x77,0xff,0x39,0x4a,0x66,0xff,0x10,0x16,0x31,0xff,0x36,0x42,0x59,0xff,0x99,0xb6,0xca,0xff,0x89,0x9c,0xaf,0xff,0x0d,0x14,0x28,0xff,0x0e,0x14,0x25,0xff,0x0e,0x12,0x24,0xff,0x0b,0x0f,0x24,0xff,0x24,0x32,0x49,0xff,0x50,0x6f,0x85,0xff,0x6e,0x94,0xaa,0xff,0x7b,0xa3,0xbb,0xff,0x4d,0x6c,0x95,0xff,0x23,0x33,0x59,0xff,0x17,0x1e,0x3a,0xff,0x1a,0x24,0x40,0xff,0x1e,0x26,0x44,0xff,0x18,0x1f,0x3e,0xff,0x14,0x1d,0x3a,0xff,0x23,0x31,0x58,0xff,0x24,0x2e,0x48,0xff,0x3d,0x47,0x50,0xff,0xbb,0xdf,0xf6,0xff,0x73,0x95,0xb9,0xff,0x1d,0x36,0x51,0xff,0x1f,0x29,0x41,0xff,0x27,0x30,0x49,0xff,0x26,0x30,0x4b,0xff,0x26,0x31,0x4e,0xff,0x22,0x2c,0x4d,0xff,0x24,0x30,0x55,0xff,0x22,0x2d,0x4a,0xff,0x02,0x02,0x05,0xff,0x01,0x00,0x01,0xff,0x00,0x00,0x03,0xff,0x01,0x00,0x01,0xff,0x07,0x08,0x0b,0xff,0x26,0x2e,0x46,0xff,0x40,0x59,0x7e,0xff,0x54,0x6e,0x90,0xff,0x2e,0x40,0x5e,0xff,0x1c,0x22,0x31,0xff,0x0f,0x11,0x15,0xff,0x00,0x00,0x03,0xff,0x00,0x00,0x00,0xff,0x01,0x02,0x01,0xff,0x02,0x01,0x01,0xff,0x03,0x00,0x02,0xff,0x03,0x02,0x00,0xff,0x01,0x00,0x00,0xff,0x01,0x00,0x02,0xff,0x01,0x00,0x03,0xff,0x02,0x01,0x03,0xff,0x00,0x00,0x00,0xff,0x06,0x05,0x06,0xff,0x6c,0x6b,0x6b,0xff,0xe8,0xe7,0xe8,0xbd,0xff,0xff,0xff,0x16,0xff,0xff,0xff,0x00,0xfe,0xf4,0xf8,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xea,0xf2,0x00,0xff,0xf9,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x3b,0xd7,0xd7,0xdc,0xe2,0x5c,0x69,0x7d,0xff,0x5a,0x76,0x9a,0xff,0x27,0x30,0x46,0xff,0x0c,0x0f,0x21,0xff,0x4c,0x6a,0x8b,0xff,0x24,0x39,0x50,0xff,0x0e,0x12,0x29,0xff,0x2e,0x3f,0x5d,0xff,0x1d,0x2e,0x4b,0xff,0x0b,0x14,0x26,0xff,0x1a,0x21,0x32,0xff,0x08,0x0a,0x13,0xff,0x08,0x04,0x07,0xff,0x51,0x5f,0x75,0xff,0xb6,0xde,0xf9,0xff,0xb3,0xd4,0xed,0xff,0xb5,0xd5,0xed,0xff,0x91,0xb9,0xd7,0xff,0x6b,0x99,0xc3,0xff,0x52,0x76,0xa2,0xff,0x3c,0x55,0x78,0xff,0x1a,0x26,0x35,0xff,0x00,0x03,0x08,0xff,0x01,0x02,0x07,0xff,0x00,0x01,0x07,0xff,0x10,0x13,0x1b,0xff,0x1c,0x24,0x2e,0xff,0x4c,0x6b,0x78,0xff,0x66,0x8c,0x9a,0xff,0x39,0x4d,0x5e,0xff,0x16,0x1c,0x2d,0xff,0x60,0x79,0x8f,0xff,0x39,0x4d,0x6b,0xff,0x13,0x1b,0x3a,0xff,0x10,0x18,0x2c,0xff,0x0c,0x11,0x26,0xff,0x13,0x16,0x2d,0xff,0x3d,0x54,0x69,0xff,0x63,0x89,0x9e,0xff,0x7e,0xa7,0xbe,0xff,0x56,0x75,0xa1,0xff,0x29,0x37,0x63,0xff,0x1f,0x2a,0x4b,0xff,0x38,0x50,0x75,0xff,0x2f,0x43,0x69,0xff,0x14,0x1e,0x3f,0xff,0x17,0x1d,0x39,0xff,0x17,0x1d,0x39,0xff,0x4c,0x5f,0x7e,0xff,0xab,0xcb,0xdf,0xff,0x8d,0xb3,0xd5,0xff,0x27,0x3c,0x61,0xff,0x19,0x22,0x3c,0xff,0x20,0x29,0x41,0xff,0x22,0x2c,0x46,0xff,0x21,0x2a,0x45,0xff,0x20,0x2b,0x47,0xff,0x1d,0x28,0x4b,0xff,0x27,0x31,0x54,0xff,0x0f,0x12,0x1f,0xff,0x00,0x00,0x00,0xff,0x01,0x02,0x03,0xff,0x00,0x01,0x02,0xff,0x02,0x00,0x00,0xff,0x03,0x02,0x02,0xff,0x24,0x33,0x4d,0xff,0x3c,0x54,0x75,0xff,0x2c,0x39,0x52,0xff,0x1b,0x25,0x37,0xff,0x05,0x05,0x0c,0xff,0x03,0x02,0x06,0xff,0x01,0x00,0x03,0xff,0x01,0x01,0x02,0xff,0x00,0x01,0x00,0xff,0x01,0x01,0x01,0xff,0x02,0x01,0x02,0xff,0x02,0x01,0x00,0xff,0x02,0x01,0x01,0xff,0x01,0x00,0x03,0xff,0x00,0x00,0x01,0xff,0x00,0x00,0x00,0xff,0x20,0x20,0x21,0xff,0xa1,0xa1,0xa2,0xfd,0xff,0xff,0xff,0x7f,0xff,0xff,0xff,0x00,0xff,0xfd,0xfe,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf1,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x0f,0xf1,0xf1,0xf4,0xa4,0xae,0xba,0xc9,0xff,0x62,0x79,0x91,0xff,0x02,0x0c,0x25,0xff,0x28,0x39,0x57,0xff,0x41,0x5a,0x75,0xff,0x16,0x23,0x39,0xff,0x1a,0x20,0x38,0xff,0x19,0x23,0x38,0xff,0x07,0x0d,0x18,0xff,0x09,0x0c,0x12,0xff,0x04,0x04,0x08,0xff,0x0a,0x0b,0x0e,0xff,0x83,0x9f,0xb5,0xff,0xaa,0xce,0xee,0xff,0x9f,0xc1,0xdf,0xff,0xa7,0xcb,0xe4,0xff,0xa1,0xca,0xe7,0xff,0x73,0xa1,0xcb,0xff,0x54,0x78,0xa4,0xff,0x1f,0x31,0x45,0xff,0x03,0x04,0x07,0xff,0x00,0x01,0x06,0xff,0x00,0x01,0x05,0xff,0x00,0x01,0x06,0xff,0x02,0x03,0x07,0xff,0x09,0x10,0x15,0xff,0x6f,0x92,0x9e,0xff,0x94,0xc6,0xd0,0xff,0x95,0xc4,0xcf,0xff,0x80,0xa2,0xac,0xff,0x51,0x77,0x80,0xff,0x5a,0x7b,0x97,0xff,0x24,0x34,0x61,0xff,0x18,0x20,0x41,0xff,0x0f,0x15,0x2a,0xff,0x0e,0x11,0x25,0xff,0x27,0x3a,0x4f,0xff,0x68,0x8b,0xa2,0xff,0x92,0xba,0xd3,0xff,0x61,0x82,0xb0,0xff,0x2b,0x40,0x6e,0xff,0x22,0x33,0x57,0xff,0x46,0x66,0x90,0xff,0x3a,0x52,0x7f,0xff,0x1d,0x22,0x40,0xff,0x11,0x10,0x1d,0xff,0x09,0x09,0x11,0xff,0x80,0x98,0xa8,0xff,0xaf,0xd5,0xf2,0xff,0x3a,0x56,0x76,0xff,0x14,0x1e,0x39,0xff,0x1c,0x22,0x3b,0xff,0x1f,0x2a,0x41,0xff,0x22,0x2c,0x44,0xff,0x21,0x2b,0x46,0xff,0x1b,0x26,0x42,0xff,0x21,0x2b,0x4d,0xff,0x1e,0x21,0x3a,0xff,0x01,0x00,0x06,0xff,0x00,0x01,0x04,0xff,0x00,0x02,0x04,0xff,0x00,0x03,0x03,0xff,0x00,0x00,0x00,0xff,0x0d,0x0f,0x16,0xff,0x2f,0x45,0x63,0xff,0x3d,0x57,0x75,0xff,0x2b,0x34,0x4c,0xff,0x13,0x1a,0x29,0xff,0x02,0x01,0x03,0xff,0x02,0x00,0x01,0xff,0x01,0x01,0x02,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x02,0x02,0x03,0xff,0x59,0x59,0x59,0xff,0xd9,0xd9,0xd9,0xdb,0xff,0xff,0xff,0x3b,0xff,0xff,0xff,0x00,0xff,0xf9,0xfc,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xee,0xf5,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x58,0xe3,0xe8,0xf0,0xe7,0x69,0x74,0x87,0xff,0x1a,0x29,0x40,0xff,0x25,0x38,0x51,0xff,0x18,0x25,0x38,0xff,0x0a,0x0e,0x1b,0xff,0x0e,0x11,0x1d,0xff,0x08,0x0a,0x13,0xff,0x02,0x04,0x0b,0xff,0x00,0x00,0x00,0xff,0x30,0x3c,0x44,0xff,0xa2,0xc8,0xe5,0xff,0x86,0xae,0xce,0xff,0xa0,0xc7,0xe5,0xff,0xae,0xd6,0xf0,0xff,0x83,0xae,0xcf,0xff,0x66,0x93,0xbc,0xff,0x36,0x4d,0x6a,0xff,0x0d,0x0e,0x18,0xff,0x03,0x03,0x08,0xff,0x01,0x02,0x06,0xff,0x01,0x01,0x07,0xff,0x01,0x02,0x06,0xff,0x00,0x00,0x00,0xff,0x0a,0x0f,0x12,0xff,0x7d,0xa5,0xb0,0xff,0x90,0xbf,0xcb,0xff,0x5b,0x87,0x95,0xff,0x73,0xa2,0xb0,0xff,0x5a,0x82,0x90,0xff,0x4b,0x72,0x86,0xff,0x5d,0x79,0xa0,0xff,0x1e,0x28,0x50,0xff,0x13,0x16,0x30,0xff,0x05,0x0b,0x1b,0xff,0x21,0x2f,0x47,0xff,0x57,0x69,0x90,0xff,0x4c,0x5f,0x7f,0xff,0x6a,0x8d,0xba,0xff,0x31,0x54,0x81,0xff,0x2d,0x44,0x6f,0xff,0x4f,0x70,0xa1,0xff,0x3a,0x50,0x72,0xff,0x16,0x18,0x22,0xff,0x07,0x05,0x0b,0xff,0x3b,0x3e,0x49,0xff,0xbc,0xd9,0xf1,0xff,0x63,0x87,0xaf,0xff,0x18,0x26,0x41,0xff,0x1a,0x1e,0x36,0xff,0x19,0x21,0x37,0xff,0x20,0x29,0x40,0xff,0x21,0x2a,0x42,0xff,0x1e,0x26,0x42,0xff,0x1c,0x26,0x42,0xff,0x1e,0x25,0x44,0xff,0x06,0x08,0x13,0xff,0x00,0x00,0x04,0xff,0x01,0x02,0x08,0xff,0x01,0x02,0x06,0xff,0x03,0x04,0x07,0xff,0x00,0x00,0x02,0xff,0x14,0x1a,0x29,0xff,0x3d,0x57,0x75,0xff,0x56,0x76,0x94,0xff,0x2d,0x38,0x4d,0xff,0x02,0x07,0x0e,0xff,0x01,0x00,0x00,0xff,0x01,0x00,0x03,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x01,0x00,0x03,0xff,0x00,0x00,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x26,0x26,0x27,0xff,0x9f,0x9f,0x9f,0xfd,0xfa,0xfa,0xfa,0x98,0xff,0xff,0xff,0x0c,0xff,0xff,0xff,0x00,0xfe,0xf4,0xf9,0x00,0xfd,0xe7,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe9,0xf1,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x16,0xfa,0xfa,0xfb,0xa0,0xac,0xb1,0xb9,0xfe,0x46,0x4e,0x60,0xff,0x09,0x0a,0x19,0xff,0x00,0x00,0x05,0xff,0x06,0x08,0x13,0xff,0x0a,0x0c,0x15,0xff,0x04,0x05,0x0b,0xff,0x20,0x25,0x30,0xff,0x7d,0x9c,0xb9,0xff,0x8d,0xb7,0xdc,0xff,0x93,0xb8,0xdb,0xff,0xa7,0xd0,0xee,0xff,0x7e,0xa6,0xc7,0xff,0x5c,0x83,0xae,0xff,0x50,0x73,0x96,0xff,0x13,0x1d,0x2d,0xff,0x0e,0x10,0x18,0xff,0x05,0x06,0x0b,0xff,0x01,0x01,0x05,0xff,0x01,0x02,0x07,0xff,0x00,0x02,0x06,0xff,0x00,0x00,0x00,0xff,0x21,0x30,0x35,0xff,0x70,0x9a,0xa6,0xff,0x7f,0xaa,0xb9,0xff,0x50,0x7a,0x8b,0xff,0x38,0x60,0x72,0xff,0x44,0x69,0x7a,0xff,0x23,0x42,0x4f,0xff,0x70,0x94,0xaf,0xff,0x5b,0x78,0xa1,0xff,0x11,0x18,0x37,0xff,0x2f,0x3f,0x52,0xff,0x72,0x8f,0xa9,0xff,0x3c,0x4c,0x66,0xff,0x00,0x00,0x06,0xff,0x3d,0x53,0x7f,0xff,0x4d,0x74,0xa8,0xff,0x3e,0x5d,0x8d,0xff,0x4e,0x71,0xa5,0xff,0x27,0x31,0x42,0xff,0x15,0x15,0x1b,0xff,0x01,0x01,0x0d,0xff,0x74,0x84,0x97,0xff,0xa2,0xc8,0xea,0xff,0x2d,0x48,0x6d,0xff,0x15,0x1a,0x34,0xff,0x18,0x1b,0x33,0xff,0x17,0x1e,0x33,0xff,0x1a,0x20,0x37,0xff,0x1a,0x20,0x39,0xff,0x1a,0x22,0x3f,0xff,0x1d,0x24,0x43,0xff,0x0e,0x15,0x31,0xff,0x04,0x07,0x17,0xff,0x04,0x05,0x0c,0xff,0x01,0x02,0x0a,0xff,0x00,0x01,0x08,0xff,0x02,0x04,0x08,0xff,0x01,0x01,0x03,0xff,0x11,0x12,0x21,0xff,0x35,0x47,0x65,0xff,0x45,0x62,0x7f,0xff,0x1e,0x29,0x3b,0xff,0x01,0x03,0x07,0xff,0x02,0x00,0x01,0xff,0x01,0x00,0x02,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x01,0x00,0x03,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x11,0x10,0x11,0xff,0x74,0x73,0x73,0xff,0xe1,0xe2,0xe1,0xd4,0xff,0xff,0xff,0x41,0xff,0xff,0xff,0x00,0xff,0xfb,0xfc,0x00,0xfe,0xed,0xf4,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf4,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xef,0xf5,0x00,0xff,0xfb,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x43,0xe9,0xe9,0xeb,0xd3,0x83,0x83,0x89,0xff,0x1e,0x1e,0x25,0xff,0x00,0x00,0x06,0xff,0x00,0x01,0x08,0xff,0x0e,0x0f,0x1a,0xff,0x65,0x7b,0x9f,0xff,0x8d,0xb8,0xdb,0xff,0x81,0xab,0xce,0xff,0xa8,0xca,0xef,0xff,0x81,0xa9,0xcd,0xff,0x4d,0x74,0x99,0xff,0x54,0x7c,0xa5,0xff,0x3c,0x53,0x73,0xff,0x0e,0x0d,0x1b,0xff,0x02,0x03,0x08,0xff,0x02,0x02,0x08,0xff,0x02,0x01,0x05,0xff,0x01,0x02,0x08,0xff,0x01,0x01,0x06,0xff,0x10,0x15,0x1b,0xff,0x22,0x32,0x3a,0xff,0x3f,0x64,0x6f,0xff,0x5f,0x8b,0x9a,0xff,0x56,0x80,0x91,0xff,0x26,0x4a,0x5d,0xff,0x38,0x5a,0x6c,0xff,0x19,0x29,0x39,0xff,0x3e,0x58,0x6f,0xff,0x78,0xa2,0xca,0xff,0x3a,0x54,0x74,0xff,0x5d,0x7a,0x91,0xff,0x79,0x9b,0xb6,0xff,0x63,0x7e,0x99,0xff,0x03,0x05,0x12,0xff,0x0f,0x13,0x2b,0xff,0x53,0x73,0xa3,0xff,0x4e,0x75,0xad,0xff,0x3d,0x52,0x79,0xff,0x20,0x23,0x32,0xff,0x1f,0x1f,0x30,0xff,0x12,0x15,0x1f,0xff,0x9a,0xba,0xd1,0xff,0x6f,0x97,0xc1,0xff,0x1d,0x2e,0x4e,0xff,0x15,0x18,0x2f,0xff,0x15,0x19,0x30,0xff,0x13,0x19,0x2f,0xff,0x18,0x1f,0x34,0xff,0x17,0x1d,0x37,0xff,0x18,0x1c,0x3a,0xff,0x22,0x27,0x48,0xff,0x2f,0x3b,0x5e,0xff,0x22,0x2e,0x4a,0xff,0x09,0x0c,0x1c,0xff,0x08,0x08,0x16,0xff,0x02,0x02,0x0a,0xff,0x01,0x03,0x09,0xff,0x01,0x01,0x06,0xff,0x16,0x17,0x25,0xff,0x30,0x41,0x5e,0xff,0x2d,0x3c,0x56,0xff,0x1a,0x22,0x31,0xff,0x00,0x00,0x02,0xff,0x01,0x01,0x02,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x08,0x08,0x08,0xff,0x55,0x55,0x55,0xff,0xc6,0xc6,0xc6,0xf3,0xff,0xff,0xff,0x7d,0xff,0xff,0xff,0x07,0xff,0xfe,0xfe,0x00,0xfe,0xf4,0xf8,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfc,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfe,0xf3,0xf8,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x63,0xdc,0xdc,0xdd,0xe2,0x76,0x78,0x7b,0xff,0x1a,0x1c,0x21,0xff,0x00,0x00,0x0f,0xff,0x4e,0x69,0x90,0xff,0x70,0x9e,0xc4,0xff,0xa5,0xca,0xe9,0xff,0x81,0xa8,0xcb,0xff,0x5a,0x7f,0xa4,0xff,0x38,0x56,0x7e,0xff,0x5e,0x8b,0xb2,0xff,0x3a,0x4e,0x66,0xff,0x07,0x05,0x0b,0xff,0x02,0x01,0x07,0xff,0x03,0x04,0x09,0xff,0x00,0x01,0x07,0xff,0x01,0x03,0x09,0xff,0x0e,0x12,0x18,0xff,0x1d,0x24,0x2b,0xff,0x16,0x1f,0x28,0xff,0x2b,0x43,0x4e,0xff,0x40,0x69,0x73,0xff,0x49,0x75,0x82,0xff,0x26,0x46,0x55,0xff,0x30,0x4d,0x5a,0xff,0x1a,0x27,0x34,0xff,0x21,0x2f,0x40,0xff,0x5a,0x7c,0x9d,0xff,0x40,0x5e,0x80,0xff,0x54,0x75,0x8e,0xff,0x6a,0x8c,0xa6,0xff,0x7f,0xa2,0xbb,0xff,0x3a,0x4a,0x61,0xff,0x00,0x00,0x05,0xff,0x2f,0x42,0x60,0xff,0x5d,0x80,0xb5,0xff,0x26,0x31,0x4f,0xff,0x2b,0x32,0x46,0xff,0x08,0x07,0x0e,0xff,0x39,0x41,0x4f,0xff,0x9d,0xc7,0xe7,0xff,0x4d,0x75,0xa0,0xff,0x1d,0x2d,0x4d,0xff,0x17,0x19,0x30,0xff,0x19,0x1f,0x35,0xff,0x17,0x1f,0x34,0xff,0x16,0x1c,0x34,0xff,0x18,0x1d,0x38,0xff,0x19,0x1b,0x35,0xff,0x0e,0x0e,0x1c,0xff,0x29,0x34,0x48,0xff,0x3c,0x4b,0x6f,0xff,0x1a,0x24,0x3b,0xff,0x08,0x08,0x14,0xff,0x05,0x03,0x0d,0xff,0x01,0x02,0x0b,0xff,0x02,0x02,0x0a,0xff,0x0c,0x10,0x1d,0xff,0x45,0x56,0x71,0xff,0x14,0x1c,0x28,0xff,0x14,0x1d,0x2c,0xff,0x01,0x03,0x06,0xff,0x00,0x00,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x06,0x06,0x06,0xff,0x4c,0x4c,0x4c,0xff,0xb9,0xb9,0xb9,0xfb,0xfc,0xfc,0xfc,0x99,0xff,0xff,0xff,0x1d,0xff,0xff,0xff,0x00,0xfe,0xf8,0xfb,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xf0,0x00,0xfd,0xeb,0xf3,0x00,0xff,0xf6,0xfa,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x10,0xff,0xff,0xff,0x83,0xd5,0xd5,0xd5,0xee,0x85,0x87,0x92,0xff,0x6e,0x8c,0xaf,0xff,0x8d,0xbd,0xdb,0xff,0x87,0xaa,0xce,0xff,0x5d,0x86,0xae,0xff,0x39,0x4e,0x70,0xff,0x44,0x5f,0x87,0xff,0x63,0x8a,0xaa,0xff,0x0b,0x13,0x1a,0xff,0x00,0x00,0x00,0xff,0x04,0x03,0x09,0xff,0x03,0x03,0x0a,0xff,0x00,0x00,0x04,0xff,0x1c,0x23,0x29,0xff,0x27,0x37,0x3f,0xff,0x1b,0x23,0x2b,0xff,0x0d,0x13,0x1d,0xff,0x22,0x2d,0x38,0xff,0x2f,0x45,0x51,0xff,0x4a,0x73,0x7f,0xff,0x30,0x4e,0x5d,0xff,0x32,0x4b,0x5a,0xff,0x1c,0x2a,0x37,0xff,0x14,0x1c,0x2b,0xff,0x47,0x5f,0x7c,0xff,0x43,0x60,0x80,0xff,0x54,0x73,0x8e,0xff,0x67,0x86,0xa1,0xff,0x7a,0x9a,0xb4,0xff,0x71,0x8a,0xa6,0xff,0x06,0x0c,0x1b,0xff,0x0a,0x0c,0x20,0xff,0x47,0x5b,0x81,0xff,0x29,0x32,0x4e,0xff,0x21,0x2a,0x3e,0xff,0x05,0x07,0x0d,0xff,0x2f,0x35,0x42,0xff,0x8d,0xb3,0xdb,0xff,0x59,0x7f,0xad,0xff,0x29,0x39,0x5a,0xff,0x16,0x1c,0x32,0xff,0x19,0x21,0x38,0xff,0x19,0x20,0x39,0xff,0x18,0x1c,0x36,0xff,0x19,0x1a,0x36,0xff,0x15,0x19,0x2b,0xff,0x0e,0x12,0x1a,0xff,0x19,0x19,0x23,0xff,0x14,0x14,0x24,0xff,0x1d,0x22,0x32,0xff,0x0c,0x0d,0x18,0xff,0x0f,0x0f,0x1b,0xff,0x13,0x14,0x20,0xff,0x14,0x14,0x22,0xff,0x19,0x1e,0x30,0xff,0x53,0x6b,0x86,0xff,0x4b,0x5a,0x6b,0xff,0x2b,0x30,0x40,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x0c,0x0b,0x0c,0xff,0x50,0x50,0x50,0xff,0xb3,0xb3,0xb3,0xfd,0xf9,0xf9,0xf9,0xb5,0xff,0xff,0xff,0x32,0xff,0xff,0xff,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xec,0xf3,0x00,0xff,0xf8,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x18,0xff,0xff,0xff,0x82,0xf0,0xf5,0xfa,0xe4,0xd2,0xe4,0xf3,0xff,0x7c,0x9b,0xbe,0xff,0x54,0x7b,0xa3,0xff,0x16,0x2e,0x4d,0xff,0x73,0x9a,0xbf,0xff,0x36,0x49,0x60,0xff,0x00,0x00,0x00,0xff,0x02,0x02,0x07,0xff,0x03,0x04,0x0b,0xff,0x00,0x00,0x05,0xff,0x0e,0x13,0x18,0xff,0x29,0x34,0x3f,0xff,0x2d,0x3d,0x46,0xff,0x15,0x21,0x28,0xff,0x0d,0x16,0x1e,0xff,0x17,0x1b,0x25,0xff,0x17,0x24,0x30,0xff,0x40,0x65,0x72,0xff,0x38,0x58,0x67,0xff,0x2d,0x44,0x55,0xff,0x28,0x38,0x46,0xff,0x0e,0x12,0x1e,0xff,0x3d,0x55,0x6d,0xff,0x45,0x63,0x80,0xff,0x56,0x73,0x8e,0xff,0x7b,0x9a,0xb3,0xff,0x88,0xa6,0xc0,0xff,0x81,0xa1,0xba,0xff,0x29,0x35,0x49,0xff,0x00,0x00,0x12,0xff,0x20,0x28,0x45,0xff,0x32,0x40,0x5e,0xff,0x25,0x2e,0x41,0xff,0x0f,0x10,0x18,0xff,0x20,0x26,0x35,0xff,0x88,0xab,0xd6,0xff,0x6a,0x90,0xc1,0xff,0x2f,0x42,0x66,0xff,0x13,0x1c,0x33,0xff,0x1c,0x27,0x3f,0xff,0x29,0x35,0x4e,0xff,0x23,0x2a,0x46,0xff,0x1c,0x1f,0x39,0xff,0x14,0x16,0x28,0xff,0x22,0x24,0x37,0xff,0x16,0x17,0x1f,0xff,0x10,0x12,0x1d,0xff,0x1b,0x1d,0x2b,0xff,0x14,0x16,0x24,0xff,0x0b,0x0c,0x15,0xff,0x16,0x18,0x25,0xff,0x11,0x12,0x23,0xff,0x29,0x2f,0x3e,0xff,0x48,0x5d,0x79,0xff,0x24,0x34,0x52,0xff,0x18,0x1f,0x35,0xff,0x18,0x16,0x19,0xff,0x67,0x66,0x66,0xff,0xc4,0xc4,0xc3,0xf8,0xfb,0xfb,0xfb,0xae,0xff,0xff,0xff,0x39,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf1,0xf6,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfe,0xed,0xf4,0x00,0xfe,0xf8,0xfa,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x0e,0xff,0xff,0xff,0x5f,0xf6,0xf9,0xfd,0xce,0xb9,0xc1,0xce,0xff,0x80,0x91,0xa7,0xff,0x87,0xa9,0xc5,0xff,0x0a,0x10,0x1f,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x05,0xff,0x00,0x00,0x0b,0xff,0x00,0x00,0x01,0xff,0x1c,0x2b,0x31,0xff,0x22,0x31,0x3d,0xff,0x22,0x2b,0x34,0xff,0x08,0x12,0x18,0xff,0x0a,0x10,0x18,0xff,0x10,0x16,0x1e,0xff,0x09,0x0d,0x15,0xff,0x2c,0x45,0x51,0xff,0x3a,0x5a,0x69,0xff,0x20,0x36,0x45,0xff,0x30,0x43,0x50,0xff,0x0d,0x12,0x1a,0xff,0x34,0x4b,0x5f,0xff,0x3a,0x57,0x76,0xff,0x77,0x96,0xb0,0xff,0x9f,0xbf,0xda,0xff,0x77,0x96,0xba,0xff,0x8f,0xb3,0xd0,0xff,0x54,0x6b,0x89,0xff,0x00,0x04,0x1c,0xff,0x11,0x18,0x33,0xff,0x4e,0x5e,0x84,0xff,0x23,0x2b,0x41,0xff,0x28,0x2e,0x47,0xff,0x2a,0x3a,0x52,0xff,0x82,0x9e,0xcb,0xff,0x6a,0x93,0xc4,0xff,0x2d,0x48,0x6d,0xff,0x13,0x1d,0x35,0xff,0x1b,0x24,0x3d,0xff,0x2a,0x3a,0x52,0xff,0x29,0x3d,0x55,0xff,0x12,0x19,0x2a,0xff,0x13,0x14,0x22,0xff,0x14,0x15,0x1d,0xff,0x07,0x08,0x0b,0xff,0x0b,0x0c,0x15,0xff,0x1b,0x1f,0x30,0xff,0x1c,0x1e,0x31,0xff,0x19,0x19,0x26,0xff,0x01,0x01,0x03,0xff,0x00,0x00,0x00,0xff,0x24,0x2b,0x3a,0xff,0x3c,0x49,0x67,0xff,0x43,0x4c,0x64,0xff,0x94,0x9a,0xa8,0xff,0xd9,0xd9,0xd9,0xeb,0xff,0xff,0xff,0x8b,0xff,0xff,0xff,0x25,0xff,0xff,0xff,0x00,0xff,0xfb,0xfd,0x00,0xfe,0xf1,0xf6,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xeb,0xf2,0x00,0xfe,0xf5,0xf9,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x04,0xff,0xff,0xff,0x41,0xff,0xff,0xff,0xa1,0xe4,0xe8,0xeb,0xf0,0x97,0x9a,0xa1,0xff,0x4a,0x4a,0x51,0xff,0x14,0x12,0x1b,0xff,0x00,0x01,0x0b,0xff,0x00,0x00,0x02,0xff,0x22,0x35,0x3f,0xff,0x1c,0x29,0x34,0xff,0x12,0x17,0x22,0xff,0x0a,0x0f,0x19,0xff,0x09,0x0d,0x16,0xff,0x0b,0x0e,0x16,0xff,0x05,0x06,0x0c,0xff,0x1a,0x25,0x2d,0xff,0x3d,0x5a,0x6b,0xff,0x1f,0x35,0x44,0xff,0x34,0x49,0x58,0xff,0x0e,0x16,0x1d,0xff,0x24,0x38,0x4c,0xff,0x59,0x75,0x95,0xff,0x9f,0xbe,0xdd,0xff,0x97,0xba,0xe6,0xff,0x27,0x3e,0x6c,0xff,0x48,0x5d,0x84,0xff,0x81,0xa7,0xce,0xff,0x14,0x1d,0x34,0xff,0x0a,0x0d,0x23,0xff,0x43,0x52,0x78,0xff,0x48,0x59,0x7a,0xff,0x1b,0x22,0x30,0xff,0x14,0x1c,0x25,0xff,0x76,0x98,0xbf,0xff,0x6b,0x97,0xc8,0xff,0x33,0x4e,0x75,0xff,0x15,0x1c,0x36,0xff,0x1b,0x21,0x3b,0xff,0x22,0x32,0x4b,0xff,0x25,0x38,0x50,0xff,0x1e,0x25,0x40,0xff,0x12,0x15,0x21,0xff,0x02,0x03,0x05,0xff,0x0c,0x0c,0x15,0xff,0x0e,0x0f,0x17,0xff,0x0a,0x0d,0x19,0xff,0x0d,0x0f,0x1c,0xff,0x1a,0x1d,0x2f,0xff,0x0c,0x0c,0x13,0xff,0x32,0x32,0x36,0xff,0x87,0x8b,0x8f,0xff,0xcc,0xd0,0xd7,0xfb,0xf6,0xf6,0xf7,0xc7,0xff,0xff,0xff,0x63,0xff,0xff,0xff,0x15,0xff,0xff,0xff,0x00,0xfe,0xf9,0xfb,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe5,0xef,0x00,0xfe,0xe9,0xf1,0x00,0xfe,0xf1,0xf6,0x00,0xff,0xfa,0xfb,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x16,0xff,0xff,0xff,0x60,0xf9,0xfa,0xfa,0xb5,0xd2,0xd1,0xd3,0xf1,0xa2,0xa6,0xa8,0xff,0x5e,0x60,0x65,0xff,0x41,0x4e,0x59,0xff,0x19,0x20,0x2a,0xff,0x0a,0x10,0x19,0xff,0x00,0x03,0x0d,0xff,0x0b,0x0c,0x16,0xff,0x05,0x06,0x0e,0xff,0x04,0x05,0x0b,0xff,0x0c,0x13,0x16,0xff,0x3c,0x59,0x6a,0xff,0x24,0x38,0x4a,0xff,0x34,0x4a,0x59,0xff,0x11,0x1c,0x24,0xff,0x39,0x4d,0x61,0xff,0x8b,0xab,0xcb,0xff,0x3a,0x48,0x69,0xff,0x52,0x69,0x8b,0xff,0x40,0x58,0x78,0xff,0x0c,0x10,0x2d,0xff,0x36,0x40,0x5d,0xff,0x11,0x19,0x2c,0xff,0x08,0x06,0x15,0xff,0x16,0x1e,0x3a,0xff,0x42,0x5c,0x87,0xff,0x3e,0x4b,0x6a,0xff,0x26,0x2b,0x3e,0xff,0x6b,0x8a,0xaa,0xff,0x6a,0x97,0xc8,0xff,0x33,0x4e,0x78,0xff,0x19,0x20,0x3d,0xff,0x1c,0x22,0x3d,0xff,0x1e,0x2b,0x44,0xff,0x1c,0x28,0x44,0xff,0x1b,0x23,0x41,0xff,0x10,0x14,0x25,0xff,0x00,0x00,0x00,0xff,0x0e,0x0e,0x17,0xff,0x0f,0x10,0x19,0xff,0x23,0x23,0x31,0xff,0x4d,0x4e,0x5b,0xff,0x85,0x89,0x90,0xff,0xc0,0xc1,0xc4,0xfe,0xf2,0xf2,0xf3,0xd0,0xff,0xff,0xff,0x82,0xff,0xff,0xff,0x2f,0xff,0xff,0xff,0x03,0xff,0xfd,0xfd,0x00,0xfe,0xf5,0xf8,0x00,0xfe,0xec,0xf3,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf5,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xec,0xf3,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xfc,0xfd,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x1a,0xff,0xff,0xff,0x60,0xff,0xff,0xff,0xa8,0xea,0xeb,0xec,0xe4,0xbf,0xc0,0xc3,0xfb,0x8d,0x8e,0x92,0xff,0x55,0x57,0x5c,0xff,0x3b,0x3e,0x45,0xff,0x11,0x13,0x18,0xff,0x04,0x04,0x07,0xff,0x00,0x00,0x02,0xff,0x2d,0x47,0x57,0xff,0x26,0x3a,0x4b,0xff,0x29,0x40,0x50,0xff,0x18,0x29,0x3a,0xff,0x34,0x44,0x5e,0xff,0x75,0x9c,0xc1,0xff,0x06,0x0e,0x23,0xff,0x00,0x00,0x09,0xff,0x2b,0x3b,0x50,0xff,0x31,0x41,0x57,0xff,0x03,0x02,0x10,0xff,0x06,0x08,0x18,0xff,0x0b,0x0b,0x1a,0xff,0x0e,0x0f,0x24,0xff,0x2f,0x3b,0x68,0xff,0x25,0x30,0x5a,0xff,0x2a,0x31,0x4b,0xff,0x4d,0x60,0x7d,0xff,0x6a,0x98,0xcb,0xff,0x36,0x58,0x84,0xff,0x16,0x26,0x44,0xff,0x0e,0x16,0x31,0xff,0x11,0x1c,0x33,0xff,0x14,0x1c,0x35,0xff,0x17,0x1d,0x37,0xff,0x35,0x3b,0x4f,0xff,0x44,0x46,0x4d,0xff,0x80,0x80,0x87,0xff,0xb1,0xb1,0xb5,0xff,0xd8,0xd9,0xda,0xef,0xfa,0xfa,0xfa,0xc2,0xff,0xff,0xff,0x7d,0xff,0xff,0xff,0x30,0xff,0xff,0xff,0x03,0xff,0xfe,0xff,0x00,0xff,0xf8,0xfa,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xed,0xf4,0x00,0xfe,0xf3,0xf7,0x00,0xff,0xfa,0xfc,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x07,0xff,0xff,0xff,0x3e,0xff,0xff,0xff,0x73,0xfd,0xfd,0xfd,0xb3,0xee,0xee,0xef,0xdd,0xcb,0xcb,0xcc,0xfc,0xa9,0xa9,0xaa,0xfe,0x84,0x85,0x87,0xff,0x7f,0x8e,0x97,0xff,0x67,0x74,0x80,0xff,0x4e,0x5c,0x6a,0xff,0x47,0x5e,0x6f,0xff,0x77,0x8e,0xa3,0xff,0x58,0x6f,0x92,0xff,0x19,0x20,0x38,0xff,0x00,0x00,0x0c,0xff,0x01,0x01,0x0b,0xff,0x08,0x0a,0x1c,0xff,0x00,0x01,0x12,0xff,0x00,0x01,0x13,0xff,0x04,0x04,0x18,0xff,0x04,0x06,0x1b,0xff,0x12,0x1e,0x3a,0xff,0x2a,0x34,0x52,0xff,0x1c,0x20,0x39,0xff,0x55,0x67,0x85,0xff,0x71,0x99,0xc7,0xff,0x5d,0x7c,0xa2,0xff,0x53,0x62,0x7a,0xff,0x61,0x66,0x77,0xff,0x7f,0x84,0x8f,0xff,0xa3,0xa6,0xae,0xff,0xbf,0xc1,0xc5,0xfc,0xe4,0xe4,0xe8,0xf1,0xfa,0xfa,0xfa,0xbe,0xff,0xff,0xff,0x93,0xff,0xff,0xff,0x4e,0xff,0xff,0xff,0x1a,0xff,0xff,0xff,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xf6,0xf9,0x00,0xfd,0xef,0xf5,0x00,0xfd,0xea,0xf1,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfd,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfc,0xfe,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xee,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xeb,0xf3,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe8,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe6,0xef,0x00,0xfd,0xe4,0xee,0x00,0xfd,0xe4,0xee,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe9,0xf1,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf4,0xf8,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfe,0xff,0x00,0xff,0xff,0xff,0x0e,0xff,0xff,0xff,0x1e,0xff,0xff,0xff,0x59,0xff,0xff,0xff,0x74,0xff,0xff,0xff,0xa1,0xfc,0xfc,0xfc,0xd3,0xf4,0xf4,0xf5,0xd1,0xed,0xf2,0xf4,0xef,0xe3,0xe9,0xed,0xff,0xbc,0xbc,0xc1,0xff,0xbc,0xbc,0xc5,0xff,0xa5,0xa5,0xab,0xff,0x9b,0x9a,0x9f,0xff,0x95,0x94,0x9b,0xff,0x93,0x93,0x9a,0xff,0x92,0x93,0x9a,0xff,0x96,0x97,0x9f,0xff,0x9b,0x9d,0xa5,0xff,0xa0,0xa4,0xac,0xff,0xb1,0xb4,0xbe,0xff,0xbb,0xbc,0xc3,0xff,0xd5,0xd8,0xe0,0xff,0xe6,0xeb,0xf3,0xfc,0xf2,0xf5,0xf9,0xd8,0xfa,0xfa,0xfb,0xd2,0xfe,0xfe,0xff,0xbe,0xff,0xff,0xff,0x7a,0xff,0xff,0xff,0x6e,0xff,0xff,0xff,0x2d,0xff,0xff,0xff,0x16,0xff,0xff,0xff,0x01,0xff,0xfc,0xfe,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf0,0xf6,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xe6,0xf0,0x00,0xfd,0xe4,0xee,0x00,0xfd,0xe4,0xee,0x00,0xfd,0xe5,0xef,0x00,0xfd,0xe7,0xef,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe7,0xf0,0x00,0xfd,0xe8,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xe9,0xf1,0x00,0xfd,0xea,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xeb,0xf2,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xec,0xf3,0x00,0xfd,0xed,0xf4,0x00,0xfd,0xed,0xf4,0x00,0xfe,0xee,0xf4,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xff,0xf9,0xfb,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfa,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfc,0x00,0xff,0xfb,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfd,0x00,0xff,0xfd,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xfe,0xfc,0xfd,0x00,0xfe,0xfc,0xfd,0x00,0xfe,0xfb,0xfd,0x00,0xfe,0xfb,0xfd,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf8,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xff,0xf6,0xfa,0x00,0xff,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xf0,0xf5,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf5,0xf8,0x00,0xff,0xf9,0xfb,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x21,0xff,0xff,0xff,0x3c,0xff,0xff,0xff,0x39,0xff,0xff,0xff,0x3b,0xff,0xff,0xff,0x46,0xff,0xff,0xff,0x68,0xff,0xff,0xff,0x93,0xff,0xff,0xff,0x99,0xff,0xff,0xff,0x98,0xff,0xff,0xff,0x99,0xff,0xff,0xff,0x7a,0xff,0xff,0xff,0x50,0xff,0xff,0xff,0x3d,0xff,0xff,0xff,0x39,0xff,0xff,0xff,0x3a,0xff,0xff,0xff,0x32,0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xfe,0xff,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfa,0xfc,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xef,0xf5,0x00,0xfe,0xef,0xf6,0x00,0xfe,0xf0,0xf6,0x00,0xfe,0xf1,0xf6,0x00,0xfe,0xf2,0xf6,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf2,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf3,0xf7,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf8,0x00,0xfe,0xf4,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf5,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xfe,0xf6,0xf9,0x00,0xff,0xf6,0xfa,0x00,0xff,0xf6,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf7,0xfa,0x00,0xfe,0xf8,0xfa,0x00,0xfe,0xf8,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfb,0x00,0xfe,0xf9,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfa,0xfc,0x00,0xfe,0xfb,0xfc,0x00,0xfe,0xfb,0xfd,0x00,0xfe,0xfc,0xfd,0x00,0xfe,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfc,0xfd,0x00,0xff,0xfd,0xfd,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfd,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xff,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xfe,0xfe,0x00,0xff,0xff,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+    0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
+
+};
+
+const lv_image_dsc_t img_lv_demo_music_cover_3 = {
+    .header.w = 176,
+    .header.h = 175,
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .data = img_lv_demo_music_cover_3_map,
+    .data_size = sizeof(img_lv_demo_music_cover_3_map),
+};
+
+#endif /*LV_USE_DEMO_MUSIC*/
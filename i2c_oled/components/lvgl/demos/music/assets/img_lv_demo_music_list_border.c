@@ -0,0 +1,26 @@
+#include "../lv_demo_music.h"
+#if LV_USE_DEMO_MUSIC  && !LV_DEMO_MUSIC_LARGE
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t img_lv_demo_music_list_border_map[] = {
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27,
+    0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24,
+    0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18,
+};
+
+const lv_image_dsc_t img_lv_demo_music_list_border = {
+    .header.w = 272,
+    .header.h = 4,
+    .header.stride = 1088,
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .data = img_lv_demo_music_list_border_map,
+    .data_size = sizeof(img_lv_demo_music_list_border_map),
+};
+
+#endif /*LV_USE_DEMO_MUSIC*/
+
+
@@ -0,0 +1,35 @@
+#include "../lv_demo_music.h"
+#if LV_USE_DEMO_MUSIC && LV_DEMO_MUSIC_LARGE
+
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_IMG_LV_DEMO_MUSIC_LIST_BORDER
+    #define LV_ATTRIBUTE_IMAGE_IMG_LV_DEMO_MUSIC_LIST_BORDER
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_LV_DEMO_MUSIC_LIST_BORDER uint8_t
+img_lv_demo_music_list_border_map[] = {
+    /*Pixel format:  Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha: 8 bit*/
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24,
+    0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27,
+    0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24,
+    0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c,
+    0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18,
+};
+
+const lv_image_dsc_t img_lv_demo_music_list_border = {
+    .header.w = 479,
+    .header.h = 7,
+    .header.stride = 1916,
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .data = img_lv_demo_music_list_border_map,
+    .data_size = sizeof(img_lv_demo_music_list_border_map),
+};
+
+#endif
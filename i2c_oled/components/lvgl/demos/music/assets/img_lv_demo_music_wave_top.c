@@ -0,0 +1,65 @@
+#include "../lv_demo_music.h"
+#if LV_USE_DEMO_MUSIC  && !LV_DEMO_MUSIC_LARGE
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t img_lv_demo_music_wave_top_map[] = {
+    /*Pixel format: Fix 0xFF: 8 bit, Red: 8 bit, Green: 8 bit, Blue: 8 bit*/
+    0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf4, 0xe5, 0xff, 0xff, 0xf4, 0xe4, 0xff, 0xff, 0xf4, 0xe5, 0xff, 0xff, 0xf4, 0xe4, 0xff, 0xff, 0xf3, 0xe4, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf3, 0xe4, 0xff, 0xff, 0xf2, 0xe3, 0xff, 0xff, 0xf1, 0xe2, 0xff, 0xff, 0xf1, 0xe2, 0xff, 0xff, 0xf0, 0xe1, 0xff, 0xff, 0xef, 0xe0, 0xff, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xee, 0xdf, 0xff, 0xff, 0xee, 0xde, 0xff, 0xff, 0xee, 0xdd, 0xff, 0xff, 0xed, 0xdc, 0xff, 0xff, 0xec, 0xdb, 0xff, 0xff, 0xec, 0xdb, 0xff, 0xff, 0xeb, 0xda, 0xff, 0xff, 0xea, 0xda, 0xff, 0xff, 0xe9, 0xd9, 0xff, 0xff, 0xe9, 0xd9, 0xff, 0xff, 0xe8, 0xd8, 0xff, 0xff, 0xe7, 0xd7, 0xff, 0xff, 0xe7, 0xd6, 0xff, 0xff, 0xe6, 0xd6, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe9, 0xdc, 0xff, 0xff, 0xf2, 0xe8, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xee, 0xea, 0xff, 0xff, 0xea, 0xeb, 0xff, 0xff, 0xe6, 0xeb, 0xff, 0xff, 0xe6, 0xeb, 0xff, 0xff, 0xe6, 0xeb, 0xff, 0xff, 0xe6, 0xeb, 0xff, 0xff, 0xe6, 0xeb, 0xff, 0xff, 0xe6, 0xeb, 0xff, 0xff, 0xe6, 0xeb, 0xff, 0xff, 0xe6, 0xeb, 0xff, 0xff, 0xe6, 0xec, 0xff, 0xff, 0xe6, 0xec, 0xff, 0xff, 0xe6, 0xec, 0xff, 0xff, 0xe6, 0xec, 0xff, 0xff, 0xe6, 0xec, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xfe, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf2, 0xff, 0xfe, 0xe7, 0xf2, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfd, 0xea, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xf0, 0xf5, 0xff, 0xfd, 0xf0, 0xf5, 0xff, 0xfd, 0xf0, 0xf5, 0xff, 0xfd, 0xf0, 0xf5, 0xff, 0xfd, 0xf2, 0xf6, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xee, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf4, 0xe9, 0xff, 0xff, 0xf5, 0xe9, 0xff, 0xff, 0xf6, 0xe8, 0xff, 0xff, 0xf7, 0xe9, 0xff, 0xff, 0xf6, 0xe9, 0xff, 0xff, 0xf6, 0xea, 0xff, 0xff, 0xf7, 0xea, 0xff, 0xff, 0xf8, 0xea, 0xff, 0xff, 0xf8, 0xea, 0xff, 0xff, 0xf9, 0xeb, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xeb, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xfe, 0xf8, 0xe9, 0xff, 0xfe, 0xf8, 0xe9, 0xff, 0xfe, 0xf8, 0xe9, 0xff, 0xfe, 0xf7, 0xe8, 0xff, 0xfe, 0xf7, 0xe8, 0xff, 0xfe, 0xf6, 0xe8, 0xff, 0xfe, 0xf6, 0xe7, 0xff, 0xfe, 0xf5, 0xe8, 0xff,
+    0xff, 0xf5, 0xe6, 0xff, 0xff, 0xf4, 0xe5, 0xff, 0xff, 0xf4, 0xe4, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf4, 0xe4, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf3, 0xe4, 0xff, 0xff, 0xf2, 0xe3, 0xff, 0xff, 0xf1, 0xe2, 0xff, 0xff, 0xf1, 0xe2, 0xff, 0xff, 0xf0, 0xe1, 0xff, 0xff, 0xef, 0xe0, 0xff, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xee, 0xde, 0xff, 0xff, 0xee, 0xde, 0xff, 0xff, 0xed, 0xdd, 0xff, 0xff, 0xed, 0xdc, 0xff, 0xff, 0xec, 0xdb, 0xff, 0xff, 0xeb, 0xda, 0xff, 0xff, 0xea, 0xda, 0xff, 0xff, 0xea, 0xda, 0xff, 0xff, 0xe9, 0xd9, 0xff, 0xff, 0xe8, 0xd8, 0xff, 0xff, 0xe8, 0xd8, 0xff, 0xff, 0xe7, 0xd7, 0xff, 0xff, 0xe7, 0xd6, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe5, 0xd5, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xeb, 0xdd, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xef, 0xe9, 0xff, 0xff, 0xeb, 0xea, 0xff, 0xff, 0xe7, 0xeb, 0xff, 0xff, 0xe6, 0xeb, 0xff, 0xff, 0xe6, 0xeb, 0xff, 0xff, 0xe6, 0xeb, 0xff, 0xff, 0xe6, 0xeb, 0xff, 0xff, 0xe6, 0xec, 0xff, 0xff, 0xe6, 0xec, 0xff, 0xff, 0xe6, 0xec, 0xff, 0xff, 0xe6, 0xec, 0xff, 0xff, 0xe6, 0xec, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf2, 0xff, 0xfe, 0xe7, 0xf2, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfd, 0xea, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xf0, 0xf5, 0xff, 0xfd, 0xf0, 0xf5, 0xff, 0xfd, 0xf0, 0xf5, 0xff, 0xfd, 0xf0, 0xf6, 0xff, 0xfe, 0xf4, 0xf8, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xf0, 0xee, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xe9, 0xff, 0xff, 0xf4, 0xe9, 0xff, 0xff, 0xf5, 0xe8, 0xff, 0xff, 0xf6, 0xe8, 0xff, 0xff, 0xf7, 0xe9, 0xff, 0xff, 0xf6, 0xe9, 0xff, 0xff, 0xf6, 0xea, 0xff, 0xff, 0xf6, 0xea, 0xff, 0xff, 0xf7, 0xea, 0xff, 0xff, 0xf8, 0xea, 0xff, 0xff, 0xf8, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xeb, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xfa, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xfe, 0xf7, 0xe8, 0xff, 0xfe, 0xf7, 0xe8, 0xff, 0xfe, 0xf6, 0xe7, 0xff, 0xfe, 0xf5, 0xe7, 0xff, 0xfe, 0xf5, 0xe8, 0xff,
+    0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf4, 0xe4, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf3, 0xe4, 0xff, 0xff, 0xf2, 0xe3, 0xff, 0xff, 0xf1, 0xe2, 0xff, 0xff, 0xf1, 0xe2, 0xff, 0xff, 0xf0, 0xe1, 0xff, 0xff, 0xef, 0xe0, 0xff, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xef, 0xde, 0xff, 0xff, 0xee, 0xdd, 0xff, 0xff, 0xed, 0xdc, 0xff, 0xff, 0xec, 0xdc, 0xff, 0xff, 0xec, 0xdb, 0xff, 0xff, 0xeb, 0xda, 0xff, 0xff, 0xea, 0xda, 0xff, 0xff, 0xe9, 0xd9, 0xff, 0xff, 0xe9, 0xd9, 0xff, 0xff, 0xe8, 0xd8, 0xff, 0xff, 0xe7, 0xd7, 0xff, 0xff, 0xe7, 0xd7, 0xff, 0xff, 0xe7, 0xd5, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe5, 0xd5, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xeb, 0xde, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf1, 0xe9, 0xff, 0xff, 0xec, 0xea, 0xff, 0xff, 0xe8, 0xeb, 0xff, 0xff, 0xe6, 0xeb, 0xff, 0xff, 0xe6, 0xec, 0xff, 0xff, 0xe6, 0xec, 0xff, 0xff, 0xe6, 0xec, 0xff, 0xff, 0xe6, 0xec, 0xff, 0xff, 0xe6, 0xec, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf2, 0xff, 0xfe, 0xe7, 0xf2, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfd, 0xea, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xf0, 0xf5, 0xff, 0xfd, 0xf0, 0xf5, 0xff, 0xfd, 0xf0, 0xf5, 0xff, 0xfd, 0xf2, 0xf6, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xf0, 0xed, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xe9, 0xff, 0xff, 0xf3, 0xe9, 0xff, 0xff, 0xf3, 0xe8, 0xff, 0xff, 0xf5, 0xe8, 0xff, 0xff, 0xf6, 0xe8, 0xff, 0xff, 0xf7, 0xe9, 0xff, 0xff, 0xf7, 0xe9, 0xff, 0xff, 0xf6, 0xe9, 0xff, 0xff, 0xf6, 0xea, 0xff, 0xff, 0xf7, 0xea, 0xff, 0xff, 0xf8, 0xea, 0xff, 0xff, 0xf9, 0xeb, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xf9, 0xeb, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xfe, 0xf7, 0xe8, 0xff, 0xfe, 0xf6, 0xe7, 0xff, 0xfe, 0xf6, 0xe7, 0xff, 0xfe, 0xf5, 0xe6, 0xff,
+    0xff, 0xf4, 0xe5, 0xff, 0xff, 0xf4, 0xe4, 0xff, 0xff, 0xf3, 0xe4, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf2, 0xe2, 0xff, 0xff, 0xf2, 0xe3, 0xff, 0xff, 0xf1, 0xe2, 0xff, 0xff, 0xf1, 0xe2, 0xff, 0xff, 0xf0, 0xe1, 0xff, 0xff, 0xef, 0xe0, 0xff, 0xff, 0xee, 0xdf, 0xff, 0xff, 0xef, 0xde, 0xff, 0xff, 0xee, 0xdd, 0xff, 0xff, 0xed, 0xdc, 0xff, 0xff, 0xec, 0xdb, 0xff, 0xff, 0xeb, 0xda, 0xff, 0xff, 0xea, 0xda, 0xff, 0xff, 0xea, 0xda, 0xff, 0xff, 0xe9, 0xd9, 0xff, 0xff, 0xe8, 0xd8, 0xff, 0xff, 0xe8, 0xd7, 0xff, 0xff, 0xe7, 0xd7, 0xff, 0xff, 0xe7, 0xd6, 0xff, 0xff, 0xe7, 0xd6, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xeb, 0xde, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xed, 0xeb, 0xff, 0xff, 0xe8, 0xeb, 0xff, 0xff, 0xe6, 0xec, 0xff, 0xff, 0xe6, 0xec, 0xff, 0xff, 0xe6, 0xec, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf2, 0xff, 0xfe, 0xe7, 0xf2, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfd, 0xea, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xf0, 0xf5, 0xff, 0xfd, 0xf0, 0xf5, 0xff, 0xfd, 0xf0, 0xf5, 0xff, 0xfd, 0xf1, 0xf6, 0xff, 0xfe, 0xf4, 0xf8, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xee, 0xef, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xef, 0xed, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xe9, 0xff, 0xff, 0xf3, 0xe8, 0xff, 0xff, 0xf3, 0xe8, 0xff, 0xff, 0xf4, 0xe8, 0xff, 0xff, 0xf6, 0xe8, 0xff, 0xff, 0xf7, 0xe9, 0xff, 0xff, 0xf7, 0xe9, 0xff, 0xff, 0xf6, 0xe9, 0xff, 0xff, 0xf6, 0xea, 0xff, 0xff, 0xf7, 0xea, 0xff, 0xff, 0xf8, 0xea, 0xff, 0xff, 0xfa, 0xea, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xf9, 0xeb, 0xff, 0xff, 0xf9, 0xeb, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xfe, 0xf6, 0xe7, 0xff, 0xfe, 0xf6, 0xe7, 0xff, 0xfe, 0xf5, 0xe7, 0xff, 0xfe, 0xf4, 0xe6, 0xff,
+    0xff, 0xf4, 0xe4, 0xff, 0xff, 0xf4, 0xe4, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf3, 0xe2, 0xff, 0xff, 0xf2, 0xe2, 0xff, 0xff, 0xf1, 0xe2, 0xff, 0xff, 0xf1, 0xe1, 0xff, 0xff, 0xf0, 0xe1, 0xff, 0xff, 0xef, 0xe0, 0xff, 0xff, 0xee, 0xdf, 0xff, 0xff, 0xee, 0xde, 0xff, 0xff, 0xee, 0xdd, 0xff, 0xff, 0xed, 0xdc, 0xff, 0xff, 0xec, 0xdb, 0xff, 0xff, 0xeb, 0xda, 0xff, 0xff, 0xea, 0xda, 0xff, 0xff, 0xe9, 0xd9, 0xff, 0xff, 0xe9, 0xd8, 0xff, 0xff, 0xe8, 0xd8, 0xff, 0xff, 0xe7, 0xd7, 0xff, 0xff, 0xe7, 0xd6, 0xff, 0xff, 0xe6, 0xd6, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe7, 0xd5, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xeb, 0xdf, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xee, 0xeb, 0xff, 0xff, 0xe9, 0xec, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf2, 0xff, 0xfe, 0xe7, 0xf2, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfd, 0xea, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xf0, 0xf5, 0xff, 0xfd, 0xf0, 0xf5, 0xff, 0xfd, 0xf0, 0xf5, 0xff, 0xfd, 0xf2, 0xf6, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xee, 0xef, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xf0, 0xec, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xe9, 0xff, 0xff, 0xf3, 0xe8, 0xff, 0xff, 0xf4, 0xe8, 0xff, 0xff, 0xf5, 0xe8, 0xff, 0xff, 0xf6, 0xe8, 0xff, 0xff, 0xf7, 0xe9, 0xff, 0xff, 0xf7, 0xe9, 0xff, 0xff, 0xf6, 0xe9, 0xff, 0xff, 0xf8, 0xea, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xfa, 0xea, 0xff, 0xff, 0xfa, 0xea, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xf9, 0xeb, 0xff, 0xff, 0xf9, 0xeb, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xfe, 0xf5, 0xe6, 0xff, 0xfe, 0xf4, 0xe5, 0xff,
+    0xff, 0xf3, 0xe4, 0xff, 0xff, 0xf2, 0xe3, 0xff, 0xff, 0xf2, 0xe3, 0xff, 0xff, 0xf1, 0xe2, 0xff, 0xff, 0xf1, 0xe2, 0xff, 0xff, 0xf1, 0xe2, 0xff, 0xff, 0xf0, 0xe0, 0xff, 0xff, 0xef, 0xe0, 0xff, 0xff, 0xee, 0xdf, 0xff, 0xff, 0xee, 0xde, 0xff, 0xff, 0xed, 0xdd, 0xff, 0xff, 0xed, 0xdc, 0xff, 0xff, 0xec, 0xdb, 0xff, 0xff, 0xeb, 0xda, 0xff, 0xff, 0xea, 0xda, 0xff, 0xff, 0xe9, 0xd9, 0xff, 0xff, 0xe8, 0xd8, 0xff, 0xff, 0xe7, 0xd7, 0xff, 0xff, 0xe7, 0xd6, 0xff, 0xff, 0xe6, 0xd6, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe5, 0xd5, 0xff, 0xff, 0xe5, 0xd5, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xed, 0xe1, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xef, 0xec, 0xff, 0xff, 0xea, 0xed, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf2, 0xff, 0xfe, 0xe7, 0xf2, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfd, 0xea, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xf0, 0xf5, 0xff, 0xfd, 0xf0, 0xf5, 0xff, 0xfd, 0xf0, 0xf6, 0xff, 0xfe, 0xf4, 0xf8, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xee, 0xef, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xf0, 0xec, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xe9, 0xff, 0xff, 0xf3, 0xe9, 0xff, 0xff, 0xf4, 0xe8, 0xff, 0xff, 0xf5, 0xe8, 0xff, 0xff, 0xf6, 0xe8, 0xff, 0xff, 0xf7, 0xe9, 0xff, 0xff, 0xf7, 0xe9, 0xff, 0xff, 0xf8, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xfa, 0xea, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xf9, 0xeb, 0xff, 0xff, 0xf9, 0xeb, 0xff, 0xff, 0xf9, 0xeb, 0xff, 0xff, 0xf9, 0xeb, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0xf6, 0xe5, 0xff, 0xff, 0xf6, 0xe5, 0xff, 0xfe, 0xf5, 0xe5, 0xff,
+    0xff, 0xf2, 0xe3, 0xff, 0xff, 0xf1, 0xe2, 0xff, 0xff, 0xf1, 0xe1, 0xff, 0xff, 0xf1, 0xe0, 0xff, 0xff, 0xf0, 0xe0, 0xff, 0xff, 0xf0, 0xe1, 0xff, 0xff, 0xee, 0xdf, 0xff, 0xff, 0xee, 0xde, 0xff, 0xff, 0xee, 0xde, 0xff, 0xff, 0xed, 0xdd, 0xff, 0xff, 0xec, 0xdb, 0xff, 0xff, 0xeb, 0xdb, 0xff, 0xff, 0xea, 0xda, 0xff, 0xff, 0xe9, 0xd9, 0xff, 0xff, 0xe9, 0xd8, 0xff, 0xff, 0xe8, 0xd7, 0xff, 0xff, 0xe7, 0xd7, 0xff, 0xff, 0xe7, 0xd6, 0xff, 0xff, 0xe6, 0xd6, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd4, 0xff, 0xff, 0xef, 0xe3, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xef, 0xed, 0xff, 0xff, 0xea, 0xed, 0xff, 0xfe, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xee, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf2, 0xff, 0xfe, 0xe7, 0xf2, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfd, 0xea, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xf0, 0xf5, 0xff, 0xfd, 0xf0, 0xf5, 0xff, 0xfd, 0xf1, 0xf6, 0xff, 0xfe, 0xf6, 0xf9, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xee, 0xef, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xec, 0xff, 0xff, 0xef, 0xec, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xe9, 0xff, 0xff, 0xf4, 0xe9, 0xff, 0xff, 0xf5, 0xe8, 0xff, 0xff, 0xf5, 0xe8, 0xff, 0xff, 0xf5, 0xe9, 0xff, 0xff, 0xf7, 0xe9, 0xff, 0xff, 0xf8, 0xea, 0xff, 0xff, 0xfb, 0xeb, 0xff, 0xff, 0xfb, 0xeb, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xeb, 0xff, 0xff, 0xf9, 0xeb, 0xff, 0xff, 0xf9, 0xeb, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf5, 0xe6, 0xff, 0xff, 0xf5, 0xe6, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf4, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf4, 0xe4, 0xff,
+    0xff, 0xf2, 0xe3, 0xff, 0xff, 0xf1, 0xe2, 0xff, 0xff, 0xf0, 0xe0, 0xff, 0xff, 0xf0, 0xe0, 0xff, 0xff, 0xf0, 0xe0, 0xff, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xee, 0xde, 0xff, 0xff, 0xee, 0xdd, 0xff, 0xff, 0xed, 0xdd, 0xff, 0xff, 0xec, 0xdb, 0xff, 0xff, 0xeb, 0xda, 0xff, 0xff, 0xea, 0xda, 0xff, 0xff, 0xe9, 0xd9, 0xff, 0xff, 0xe8, 0xd8, 0xff, 0xff, 0xe8, 0xd7, 0xff, 0xff, 0xe7, 0xd6, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe5, 0xd5, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe5, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xef, 0xe5, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf0, 0xee, 0xff, 0xfe, 0xea, 0xef, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xef, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf2, 0xff, 0xfe, 0xe7, 0xf2, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfd, 0xea, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xf0, 0xf5, 0xff, 0xfd, 0xf0, 0xf6, 0xff, 0xfe, 0xf3, 0xf7, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xee, 0xef, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xec, 0xed, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xed, 0xec, 0xff, 0xff, 0xf0, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xe9, 0xff, 0xff, 0xf4, 0xe9, 0xff, 0xff, 0xf5, 0xe9, 0xff, 0xff, 0xf5, 0xe8, 0xff, 0xff, 0xf5, 0xe9, 0xff, 0xff, 0xf6, 0xe9, 0xff, 0xff, 0xf9, 0xeb, 0xff, 0xff, 0xfb, 0xec, 0xff, 0xff, 0xfb, 0xec, 0xff, 0xff, 0xfb, 0xeb, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xf9, 0xeb, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf8, 0xea, 0xff, 0xff, 0xf8, 0xea, 0xff, 0xff, 0xf8, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf5, 0xe6, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe4, 0xff, 0xff, 0xf4, 0xe5, 0xff, 0xff, 0xf4, 0xe5, 0xff, 0xff, 0xf4, 0xe5, 0xff, 0xff, 0xf3, 0xe4, 0xff,
+    0xff, 0xf2, 0xe2, 0xff, 0xff, 0xf0, 0xe0, 0xff, 0xff, 0xf0, 0xe0, 0xff, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xee, 0xde, 0xff, 0xff, 0xed, 0xde, 0xff, 0xff, 0xed, 0xdc, 0xff, 0xff, 0xec, 0xdb, 0xff, 0xff, 0xeb, 0xda, 0xff, 0xff, 0xea, 0xda, 0xff, 0xff, 0xe9, 0xd9, 0xff, 0xff, 0xe8, 0xd8, 0xff, 0xff, 0xe7, 0xd7, 0xff, 0xff, 0xe7, 0xd6, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe6, 0xd4, 0xff, 0xff, 0xe4, 0xd4, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe5, 0xd6, 0xff, 0xff, 0xf0, 0xe6, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf1, 0xef, 0xff, 0xfe, 0xea, 0xf0, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf0, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf2, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfd, 0xea, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xf0, 0xf5, 0xff, 0xfd, 0xf1, 0xf6, 0xff, 0xfe, 0xf5, 0xf9, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xee, 0xef, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xec, 0xed, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xeb, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xf0, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xe9, 0xff, 0xff, 0xf3, 0xe9, 0xff, 0xff, 0xf5, 0xe9, 0xff, 0xff, 0xf5, 0xe9, 0xff, 0xff, 0xf5, 0xe9, 0xff, 0xff, 0xf8, 0xeb, 0xff, 0xff, 0xfb, 0xed, 0xff, 0xff, 0xfb, 0xec, 0xff, 0xff, 0xfb, 0xec, 0xff, 0xff, 0xfb, 0xec, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xf9, 0xeb, 0xff, 0xff, 0xf8, 0xea, 0xff, 0xff, 0xf8, 0xea, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf8, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0xf5, 0xe6, 0xff, 0xff, 0xf4, 0xe4, 0xff, 0xff, 0xf3, 0xe4, 0xff, 0xff, 0xf3, 0xe4, 0xff, 0xff, 0xf3, 0xe4, 0xff, 0xff, 0xf3, 0xe4, 0xff, 0xff, 0xf2, 0xe2, 0xff,
+    0xff, 0xf1, 0xe2, 0xff, 0xff, 0xf1, 0xe1, 0xff, 0xff, 0xef, 0xe0, 0xff, 0xff, 0xef, 0xde, 0xff, 0xff, 0xee, 0xdf, 0xff, 0xff, 0xed, 0xde, 0xff, 0xff, 0xed, 0xdc, 0xff, 0xff, 0xec, 0xdb, 0xff, 0xff, 0xeb, 0xda, 0xff, 0xff, 0xea, 0xda, 0xff, 0xff, 0xe9, 0xd9, 0xff, 0xff, 0xe8, 0xd8, 0xff, 0xff, 0xe7, 0xd7, 0xff, 0xff, 0xe6, 0xd6, 0xff, 0xff, 0xe6, 0xd6, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe7, 0xd9, 0xff, 0xff, 0xf1, 0xe8, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xe9, 0xf0, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf2, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xf0, 0xf5, 0xff, 0xfe, 0xf3, 0xf7, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xee, 0xef, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xec, 0xed, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xeb, 0xec, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xec, 0xeb, 0xff, 0xff, 0xf1, 0xea, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xea, 0xff, 0xff, 0xf4, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xe9, 0xff, 0xff, 0xf3, 0xe9, 0xff, 0xff, 0xf4, 0xe9, 0xff, 0xff, 0xf5, 0xe9, 0xff, 0xff, 0xf5, 0xe9, 0xff, 0xff, 0xf8, 0xec, 0xff, 0xff, 0xfb, 0xed, 0xff, 0xff, 0xfb, 0xed, 0xff, 0xff, 0xfb, 0xec, 0xff, 0xff, 0xfb, 0xec, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xf9, 0xeb, 0xff, 0xff, 0xf9, 0xeb, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf8, 0xe7, 0xff, 0xff, 0xf8, 0xe7, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0xf5, 0xe6, 0xff, 0xff, 0xf4, 0xe4, 0xff, 0xff, 0xf3, 0xe4, 0xff, 0xff, 0xf3, 0xe4, 0xff, 0xff, 0xf3, 0xe4, 0xff, 0xff, 0xf2, 0xe2, 0xff, 0xff, 0xf2, 0xe2, 0xff, 0xff, 0xf1, 0xe2, 0xff,
+    0xff, 0xf1, 0xe0, 0xff, 0xff, 0xf0, 0xe0, 0xff, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xee, 0xde, 0xff, 0xff, 0xed, 0xde, 0xff, 0xff, 0xed, 0xdc, 0xff, 0xff, 0xeb, 0xdb, 0xff, 0xff, 0xeb, 0xda, 0xff, 0xff, 0xea, 0xda, 0xff, 0xff, 0xe9, 0xd9, 0xff, 0xff, 0xe8, 0xd8, 0xff, 0xff, 0xe7, 0xd7, 0xff, 0xff, 0xe6, 0xd6, 0xff, 0xff, 0xe6, 0xd6, 0xff, 0xff, 0xe6, 0xd4, 0xff, 0xff, 0xe5, 0xd5, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xea, 0xdc, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf2, 0xff, 0xfe, 0xef, 0xf1, 0xff, 0xfe, 0xe9, 0xf1, 0xff, 0xfe, 0xe7, 0xf1, 0xff, 0xfe, 0xe7, 0xf2, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xf0, 0xf6, 0xff, 0xfe, 0xf4, 0xf8, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xee, 0xef, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xec, 0xed, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xeb, 0xec, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xec, 0xeb, 0xff, 0xff, 0xf1, 0xeb, 0xff, 0xff, 0xf4, 0xeb, 0xff, 0xff, 0xf4, 0xea, 0xff, 0xff, 0xf4, 0xea, 0xff, 0xff, 0xf4, 0xea, 0xff, 0xff, 0xf3, 0xe9, 0xff, 0xff, 0xf3, 0xe9, 0xff, 0xff, 0xf4, 0xe9, 0xff, 0xff, 0xf5, 0xe9, 0xff, 0xff, 0xf6, 0xea, 0xff, 0xff, 0xfa, 0xed, 0xff, 0xff, 0xfb, 0xed, 0xff, 0xff, 0xfb, 0xed, 0xff, 0xff, 0xfb, 0xed, 0xff, 0xff, 0xfb, 0xec, 0xff, 0xff, 0xfa, 0xea, 0xff, 0xff, 0xfa, 0xea, 0xff, 0xff, 0xfa, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe9, 0xff, 0xff, 0xf7, 0xe9, 0xff, 0xff, 0xf7, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe5, 0xff, 0xff, 0xf6, 0xe5, 0xff, 0xff, 0xf4, 0xe5, 0xff, 0xff, 0xf4, 0xe5, 0xff, 0xff, 0xf3, 0xe4, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf2, 0xe2, 0xff, 0xff, 0xf1, 0xe1, 0xff, 0xff, 0xf0, 0xe1, 0xff, 0xff, 0xf0, 0xe1, 0xff,
+    0xff, 0xef, 0xdf, 0xff, 0xff, 0xee, 0xde, 0xff, 0xff, 0xee, 0xde, 0xff, 0xff, 0xed, 0xdc, 0xff, 0xff, 0xec, 0xdc, 0xff, 0xff, 0xec, 0xdb, 0xff, 0xff, 0xea, 0xda, 0xff, 0xff, 0xea, 0xda, 0xff, 0xff, 0xe9, 0xd9, 0xff, 0xff, 0xe8, 0xd8, 0xff, 0xff, 0xe7, 0xd7, 0xff, 0xff, 0xe7, 0xd6, 0xff, 0xff, 0xe7, 0xd6, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xec, 0xe1, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf2, 0xff, 0xfe, 0xf4, 0xf2, 0xff, 0xfe, 0xf4, 0xf3, 0xff, 0xfe, 0xf4, 0xf3, 0xff, 0xfe, 0xef, 0xf3, 0xff, 0xfe, 0xe8, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf3, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe7, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xe9, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfe, 0xea, 0xf4, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xf1, 0xf7, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xee, 0xef, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xeb, 0xec, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xec, 0xea, 0xff, 0xff, 0xf1, 0xea, 0xff, 0xff, 0xf4, 0xea, 0xff, 0xff, 0xf3, 0xe9, 0xff, 0xff, 0xf3, 0xe9, 0xff, 0xff, 0xf3, 0xe9, 0xff, 0xff, 0xf4, 0xe9, 0xff, 0xff, 0xf7, 0xec, 0xff, 0xff, 0xfb, 0xee, 0xff, 0xff, 0xfb, 0xed, 0xff, 0xff, 0xfb, 0xed, 0xff, 0xff, 0xfb, 0xed, 0xff, 0xff, 0xfb, 0xec, 0xff, 0xff, 0xfb, 0xec, 0xff, 0xff, 0xfa, 0xea, 0xff, 0xff, 0xfa, 0xea, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf6, 0xe8, 0xff, 0xff, 0xf7, 0xe9, 0xff, 0xff, 0xf7, 0xe9, 0xff, 0xff, 0xf7, 0xe9, 0xff, 0xff, 0xf7, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0xf4, 0xe4, 0xff, 0xff, 0xf4, 0xe4, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf2, 0xe3, 0xff, 0xff, 0xf1, 0xe1, 0xff, 0xff, 0xf0, 0xe1, 0xff, 0xff, 0xf0, 0xe1, 0xff, 0xff, 0xef, 0xe0, 0xff, 0xff, 0xef, 0xdf, 0xff,
+    0xff, 0xee, 0xde, 0xff, 0xff, 0xed, 0xdd, 0xff, 0xff, 0xec, 0xdc, 0xff, 0xff, 0xeb, 0xdc, 0xff, 0xff, 0xeb, 0xdc, 0xff, 0xff, 0xeb, 0xda, 0xff, 0xff, 0xe9, 0xd9, 0xff, 0xff, 0xe9, 0xd8, 0xff, 0xff, 0xe8, 0xd8, 0xff, 0xff, 0xe7, 0xd7, 0xff, 0xff, 0xe6, 0xd6, 0xff, 0xff, 0xe7, 0xd5, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe5, 0xd5, 0xff, 0xff, 0xef, 0xe5, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf2, 0xff, 0xfe, 0xf4, 0xf3, 0xff, 0xfe, 0xf4, 0xf3, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xee, 0xf4, 0xff, 0xfe, 0xe8, 0xf3, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf5, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf5, 0xff, 0xfe, 0xe9, 0xf5, 0xff, 0xfe, 0xe9, 0xf5, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xf0, 0xf6, 0xff, 0xfe, 0xf3, 0xf8, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xee, 0xef, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xeb, 0xec, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xea, 0xea, 0xff, 0xff, 0xeb, 0xea, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xed, 0xea, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf3, 0xe9, 0xff, 0xff, 0xf5, 0xe9, 0xff, 0xff, 0xf9, 0xed, 0xff, 0xff, 0xfb, 0xee, 0xff, 0xff, 0xfb, 0xed, 0xff, 0xff, 0xfb, 0xed, 0xff, 0xff, 0xfb, 0xed, 0xff, 0xff, 0xfb, 0xed, 0xff, 0xff, 0xfb, 0xec, 0xff, 0xff, 0xfb, 0xeb, 0xff, 0xff, 0xfa, 0xea, 0xff, 0xff, 0xfa, 0xea, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe8, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf8, 0xe9, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf5, 0xe6, 0xff, 0xff, 0xf5, 0xe6, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf4, 0xe4, 0xff, 0xff, 0xf3, 0xe4, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf1, 0xe2, 0xff, 0xff, 0xf1, 0xe1, 0xff, 0xff, 0xf1, 0xe1, 0xff, 0xff, 0xf0, 0xe0, 0xff, 0xff, 0xf0, 0xe0, 0xff, 0xff, 0xee, 0xdf, 0xff, 0xff, 0xee, 0xde, 0xff, 0xff, 0xee, 0xde, 0xff,
+    0xff, 0xed, 0xdd, 0xff, 0xff, 0xeb, 0xdc, 0xff, 0xff, 0xeb, 0xda, 0xff, 0xff, 0xea, 0xda, 0xff, 0xff, 0xea, 0xd9, 0xff, 0xff, 0xea, 0xd9, 0xff, 0xff, 0xe8, 0xd8, 0xff, 0xff, 0xe8, 0xd8, 0xff, 0xff, 0xe7, 0xd7, 0xff, 0xff, 0xe7, 0xd6, 0xff, 0xff, 0xe5, 0xd5, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe8, 0xd9, 0xff, 0xff, 0xf1, 0xe8, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf2, 0xff, 0xfe, 0xf4, 0xf3, 0xff, 0xfe, 0xf4, 0xf3, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf3, 0xf5, 0xff, 0xfd, 0xed, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf5, 0xff, 0xfe, 0xe8, 0xf5, 0xff, 0xfe, 0xe8, 0xf5, 0xff, 0xfe, 0xe9, 0xf5, 0xff, 0xfe, 0xe9, 0xf5, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfe, 0xeb, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xf1, 0xf6, 0xff, 0xfe, 0xf5, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xee, 0xef, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xeb, 0xec, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xea, 0xea, 0xff, 0xff, 0xea, 0xea, 0xff, 0xff, 0xea, 0xea, 0xff, 0xff, 0xeb, 0xea, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xec, 0xea, 0xff, 0xff, 0xf3, 0xef, 0xff, 0xff, 0xfb, 0xf1, 0xff, 0xff, 0xfb, 0xee, 0xff, 0xff, 0xfb, 0xee, 0xff, 0xff, 0xfb, 0xed, 0xff, 0xff, 0xfb, 0xec, 0xff, 0xff, 0xfb, 0xed, 0xff, 0xff, 0xfb, 0xed, 0xff, 0xff, 0xfb, 0xec, 0xff, 0xff, 0xfa, 0xea, 0xff, 0xff, 0xfa, 0xea, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf5, 0xe6, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0xf5, 0xe6, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf7, 0xe6, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf8, 0xe7, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe9, 0xff, 0xff, 0xf8, 0xe7, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf8, 0xe6, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf4, 0xe4, 0xff, 0xff, 0xf4, 0xe4, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf2, 0xe1, 0xff, 0xff, 0xf0, 0xe0, 0xff, 0xff, 0xef, 0xe0, 0xff, 0xff, 0xef, 0xe0, 0xff, 0xff, 0xef, 0xe0, 0xff, 0xff, 0xee, 0xdf, 0xff, 0xff, 0xee, 0xde, 0xff, 0xff, 0xee, 0xde, 0xff, 0xff, 0xee, 0xde, 0xff,
+    0xff, 0xeb, 0xdb, 0xff, 0xff, 0xea, 0xda, 0xff, 0xff, 0xea, 0xd9, 0xff, 0xff, 0xe8, 0xd9, 0xff, 0xff, 0xe9, 0xd8, 0xff, 0xff, 0xe8, 0xd7, 0xff, 0xff, 0xe8, 0xd7, 0xff, 0xff, 0xe7, 0xd6, 0xff, 0xff, 0xe7, 0xd6, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xeb, 0xdf, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf2, 0xff, 0xfe, 0xf4, 0xf3, 0xff, 0xfe, 0xf4, 0xf3, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf2, 0xf7, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfe, 0xe8, 0xf4, 0xff, 0xfe, 0xe8, 0xf5, 0xff, 0xfe, 0xe8, 0xf5, 0xff, 0xfe, 0xe8, 0xf5, 0xff, 0xfe, 0xe8, 0xf5, 0xff, 0xfe, 0xe8, 0xf5, 0xff, 0xfe, 0xe9, 0xf5, 0xff, 0xfe, 0xe9, 0xf5, 0xff, 0xfe, 0xe9, 0xf5, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfe, 0xeb, 0xf5, 0xff, 0xfd, 0xea, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xef, 0xf6, 0xff, 0xfe, 0xf2, 0xf7, 0xff, 0xfe, 0xf5, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xee, 0xef, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xeb, 0xec, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xea, 0xea, 0xff, 0xff, 0xea, 0xea, 0xff, 0xff, 0xea, 0xea, 0xff, 0xff, 0xea, 0xea, 0xff, 0xff, 0xea, 0xea, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xf7, 0xf6, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfd, 0xf7, 0xff, 0xff, 0xfb, 0xf0, 0xff, 0xff, 0xfb, 0xed, 0xff, 0xff, 0xfb, 0xed, 0xff, 0xff, 0xfb, 0xed, 0xff, 0xff, 0xfb, 0xec, 0xff, 0xff, 0xfb, 0xeb, 0xff, 0xff, 0xfa, 0xea, 0xff, 0xff, 0xfa, 0xea, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf4, 0xe5, 0xff, 0xff, 0xf5, 0xe6, 0xff, 0xff, 0xf4, 0xe6, 0xff, 0xff, 0xf5, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf6, 0xe8, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf6, 0xe8, 0xff, 0xff, 0xf5, 0xe7, 0xff, 0xff, 0xf5, 0xe6, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe4, 0xff, 0xff, 0xf4, 0xe4, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf3, 0xe2, 0xff, 0xff, 0xf2, 0xe1, 0xff, 0xff, 0xf1, 0xe0, 0xff, 0xff, 0xef, 0xe0, 0xff, 0xff, 0xef, 0xe0, 0xff, 0xff, 0xee, 0xdf, 0xff, 0xff, 0xee, 0xde, 0xff, 0xff, 0xee, 0xdd, 0xff, 0xff, 0xed, 0xdd, 0xff, 0xff, 0xed, 0xdd, 0xff, 0xff, 0xed, 0xdc, 0xff, 0xff, 0xec, 0xdc, 0xff,
+    0xff, 0xea, 0xd9, 0xff, 0xff, 0xe9, 0xd9, 0xff, 0xff, 0xe8, 0xd8, 0xff, 0xff, 0xe9, 0xd8, 0xff, 0xff, 0xe8, 0xd7, 0xff, 0xff, 0xe7, 0xd7, 0xff, 0xff, 0xe7, 0xd6, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe5, 0xd5, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe5, 0xd6, 0xff, 0xff, 0xef, 0xe5, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf2, 0xff, 0xfe, 0xf4, 0xf3, 0xff, 0xfe, 0xf4, 0xf3, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf2, 0xf7, 0xff, 0xfe, 0xeb, 0xf5, 0xff, 0xfe, 0xe8, 0xf5, 0xff, 0xfe, 0xe8, 0xf5, 0xff, 0xfe, 0xe8, 0xf5, 0xff, 0xfe, 0xe9, 0xf5, 0xff, 0xfe, 0xe9, 0xf5, 0xff, 0xfe, 0xe9, 0xf5, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfe, 0xeb, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xef, 0xf6, 0xff, 0xfe, 0xf4, 0xf9, 0xff, 0xfe, 0xf5, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xee, 0xef, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xec, 0xed, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xea, 0xea, 0xff, 0xff, 0xea, 0xea, 0xff, 0xff, 0xea, 0xea, 0xff, 0xff, 0xea, 0xea, 0xff, 0xff, 0xea, 0xea, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xfd, 0xf5, 0xff, 0xff, 0xfb, 0xef, 0xff, 0xff, 0xfb, 0xec, 0xff, 0xff, 0xfb, 0xec, 0xff, 0xff, 0xfb, 0xea, 0xff, 0xff, 0xfa, 0xea, 0xff, 0xff, 0xfa, 0xea, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf4, 0xe5, 0xff, 0xff, 0xf4, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe7, 0xff, 0xff, 0xf5, 0xe6, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe8, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf4, 0xe4, 0xff, 0xff, 0xf4, 0xe2, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf2, 0xe3, 0xff, 0xff, 0xf1, 0xe2, 0xff, 0xff, 0xef, 0xe0, 0xff, 0xff, 0xef, 0xde, 0xff, 0xff, 0xef, 0xde, 0xff, 0xff, 0xee, 0xde, 0xff, 0xff, 0xee, 0xde, 0xff, 0xff, 0xed, 0xdd, 0xff, 0xff, 0xec, 0xdd, 0xff, 0xff, 0xec, 0xdc, 0xff, 0xff, 0xec, 0xdb, 0xff, 0xff, 0xec, 0xdb, 0xff, 0xff, 0xec, 0xdb, 0xff,
+    0xff, 0xe8, 0xd9, 0xff, 0xff, 0xe8, 0xd8, 0xff, 0xff, 0xe8, 0xd8, 0xff, 0xff, 0xe8, 0xd7, 0xff, 0xff, 0xe7, 0xd6, 0xff, 0xff, 0xe6, 0xd6, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe4, 0xd4, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe9, 0xdb, 0xff, 0xff, 0xf1, 0xe8, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf2, 0xff, 0xfe, 0xf4, 0xf3, 0xff, 0xfe, 0xf4, 0xf3, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf1, 0xf6, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfe, 0xe9, 0xf5, 0xff, 0xfe, 0xe9, 0xf5, 0xff, 0xfe, 0xe9, 0xf5, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfe, 0xeb, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfe, 0xf1, 0xf7, 0xff, 0xfe, 0xf5, 0xfa, 0xff, 0xfe, 0xf5, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xee, 0xef, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xec, 0xed, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xea, 0xea, 0xff, 0xff, 0xea, 0xea, 0xff, 0xff, 0xea, 0xea, 0xff, 0xff, 0xea, 0xea, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfa, 0xff, 0xff, 0xfe, 0xf9, 0xff, 0xff, 0xfc, 0xf3, 0xff, 0xff, 0xfb, 0xec, 0xff, 0xff, 0xfa, 0xea, 0xff, 0xff, 0xfa, 0xea, 0xff, 0xff, 0xfa, 0xea, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf8, 0xe6, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0xf6, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe6, 0xff, 0xff, 0xf5, 0xe6, 0xff, 0xff, 0xf5, 0xe6, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf7, 0xe6, 0xff, 0xff, 0xf7, 0xe6, 0xff, 0xff, 0xf6, 0xe5, 0xff, 0xff, 0xf5, 0xe4, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf3, 0xe2, 0xff, 0xff, 0xf2, 0xe2, 0xff, 0xff, 0xf1, 0xe2, 0xff, 0xff, 0xf0, 0xe0, 0xff, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xed, 0xde, 0xff, 0xff, 0xed, 0xdd, 0xff, 0xff, 0xee, 0xdc, 0xff, 0xff, 0xed, 0xdd, 0xff, 0xff, 0xed, 0xdc, 0xff, 0xff, 0xec, 0xdb, 0xff, 0xff, 0xec, 0xda, 0xff, 0xff, 0xeb, 0xda, 0xff, 0xff, 0xeb, 0xd9, 0xff, 0xff, 0xea, 0xda, 0xff,
+    0xff, 0xe8, 0xd7, 0xff, 0xff, 0xe8, 0xd7, 0xff, 0xff, 0xe6, 0xd7, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe5, 0xd5, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xee, 0xe3, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf2, 0xff, 0xfe, 0xf4, 0xf3, 0xff, 0xfe, 0xf4, 0xf3, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf0, 0xf6, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfe, 0xea, 0xf5, 0xff, 0xfe, 0xeb, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xef, 0xf6, 0xff, 0xfe, 0xf3, 0xf9, 0xff, 0xfe, 0xf5, 0xfa, 0xff, 0xfe, 0xf5, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xee, 0xef, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xec, 0xed, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xea, 0xea, 0xff, 0xff, 0xea, 0xea, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xfd, 0xf8, 0xff, 0xff, 0xfd, 0xf7, 0xff, 0xff, 0xfb, 0xf1, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xfa, 0xe9, 0xff, 0xff, 0xf9, 0xea, 0xff, 0xff, 0xf9, 0xe8, 0xff, 0xff, 0xf8, 0xe6, 0xff, 0xff, 0xf7, 0xe6, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf6, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe4, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf6, 0xe5, 0xff, 0xff, 0xf6, 0xe5, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0xf6, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe3, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf3, 0xe2, 0xff, 0xff, 0xf2, 0xe2, 0xff, 0xff, 0xf1, 0xe1, 0xff, 0xff, 0xef, 0xe0, 0xff, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xef, 0xdd, 0xff, 0xff, 0xee, 0xdd, 0xff, 0xff, 0xec, 0xdb, 0xff, 0xff, 0xec, 0xdb, 0xff, 0xff, 0xeb, 0xdb, 0xff, 0xff, 0xec, 0xdb, 0xff, 0xff, 0xeb, 0xd9, 0xff, 0xff, 0xeb, 0xd8, 0xff, 0xff, 0xea, 0xd8, 0xff, 0xff, 0xea, 0xd8, 0xff, 0xff, 0xea, 0xd7, 0xff,
+    0xff, 0xe7, 0xd6, 0xff, 0xff, 0xe6, 0xd6, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe5, 0xd5, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe9, 0xdb, 0xff, 0xff, 0xf1, 0xe8, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf2, 0xff, 0xfe, 0xf4, 0xf2, 0xff, 0xfe, 0xf4, 0xf3, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf0, 0xf6, 0xff, 0xfe, 0xeb, 0xf5, 0xff, 0xfe, 0xeb, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xeb, 0xf5, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xef, 0xf5, 0xff, 0xfd, 0xee, 0xf6, 0xff, 0xfe, 0xf1, 0xf7, 0xff, 0xff, 0xf4, 0xfa, 0xff, 0xfe, 0xf5, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xec, 0xed, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfa, 0xff, 0xff, 0xfd, 0xf7, 0xff, 0xff, 0xfd, 0xf6, 0xff, 0xff, 0xfb, 0xef, 0xff, 0xff, 0xfa, 0xeb, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf8, 0xe7, 0xff, 0xff, 0xf8, 0xe7, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0xf6, 0xe5, 0xff, 0xff, 0xf5, 0xe4, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf4, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe4, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf4, 0xe5, 0xff, 0xff, 0xf5, 0xe4, 0xff, 0xff, 0xf5, 0xe4, 0xff, 0xff, 0xf4, 0xe3, 0xff, 0xff, 0xf2, 0xe2, 0xff, 0xff, 0xf2, 0xe2, 0xff, 0xff, 0xf1, 0xe1, 0xff, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xee, 0xde, 0xff, 0xff, 0xed, 0xde, 0xff, 0xff, 0xed, 0xde, 0xff, 0xff, 0xec, 0xdc, 0xff, 0xff, 0xeb, 0xda, 0xff, 0xff, 0xea, 0xd8, 0xff, 0xff, 0xea, 0xd8, 0xff, 0xff, 0xea, 0xd8, 0xff, 0xff, 0xe9, 0xd8, 0xff, 0xff, 0xe9, 0xd7, 0xff, 0xff, 0xe8, 0xd7, 0xff, 0xff, 0xe7, 0xd7, 0xff, 0xff, 0xe7, 0xd6, 0xff,
+    0xff, 0xe6, 0xd6, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe5, 0xd5, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe5, 0xd6, 0xff, 0xff, 0xef, 0xe4, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf2, 0xff, 0xfe, 0xf4, 0xf2, 0xff, 0xfe, 0xf4, 0xf3, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xef, 0xf6, 0xff, 0xfd, 0xec, 0xf6, 0xff, 0xfd, 0xec, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xed, 0xf5, 0xff, 0xfd, 0xee, 0xf5, 0xff, 0xfd, 0xee, 0xf6, 0xff, 0xfd, 0xef, 0xf6, 0xff, 0xfd, 0xef, 0xf6, 0xff, 0xfe, 0xf3, 0xf9, 0xff, 0xff, 0xf5, 0xfa, 0xff, 0xff, 0xf5, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xee, 0xef, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xec, 0xed, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfa, 0xff, 0xff, 0xfd, 0xf6, 0xff, 0xff, 0xfc, 0xf4, 0xff, 0xff, 0xfa, 0xef, 0xff, 0xff, 0xf9, 0xe9, 0xff, 0xff, 0xf8, 0xe7, 0xff, 0xff, 0xf7, 0xe6, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0xf6, 0xe5, 0xff, 0xff, 0xf4, 0xe5, 0xff, 0xff, 0xf4, 0xe5, 0xff, 0xff, 0xf4, 0xe5, 0xff, 0xff, 0xf4, 0xe5, 0xff, 0xff, 0xf4, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe4, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe4, 0xff, 0xff, 0xf4, 0xe4, 0xff, 0xff, 0xf3, 0xe4, 0xff, 0xff, 0xf4, 0xe3, 0xff, 0xff, 0xf3, 0xe2, 0xff, 0xff, 0xf1, 0xe2, 0xff, 0xff, 0xf0, 0xe0, 0xff, 0xff, 0xef, 0xe0, 0xff, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xee, 0xdd, 0xff, 0xff, 0xec, 0xdc, 0xff, 0xff, 0xec, 0xdc, 0xff, 0xff, 0xeb, 0xdc, 0xff, 0xff, 0xea, 0xda, 0xff, 0xff, 0xea, 0xd9, 0xff, 0xff, 0xea, 0xd9, 0xff, 0xff, 0xe9, 0xd7, 0xff, 0xff, 0xe9, 0xd8, 0xff, 0xff, 0xe9, 0xd8, 0xff, 0xff, 0xe8, 0xd6, 0xff, 0xff, 0xe7, 0xd6, 0xff, 0xff, 0xe7, 0xd6, 0xff, 0xff, 0xe7, 0xd6, 0xff,
+    0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd3, 0xff, 0xff, 0xeb, 0xde, 0xff, 0xff, 0xf2, 0xe8, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf2, 0xff, 0xfe, 0xf4, 0xf2, 0xff, 0xfe, 0xf4, 0xf3, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf3, 0xf7, 0xff, 0xfd, 0xef, 0xf6, 0xff, 0xfd, 0xed, 0xf6, 0xff, 0xfd, 0xee, 0xf6, 0xff, 0xfd, 0xee, 0xf6, 0xff, 0xfd, 0xee, 0xf6, 0xff, 0xfe, 0xf0, 0xf7, 0xff, 0xff, 0xf4, 0xfa, 0xff, 0xff, 0xf5, 0xfa, 0xff, 0xff, 0xf6, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf6, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xee, 0xef, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xec, 0xed, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfa, 0xff, 0xff, 0xfc, 0xf5, 0xff, 0xff, 0xfb, 0xf3, 0xff, 0xff, 0xfa, 0xed, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0xff, 0xf7, 0xe6, 0xff, 0xff, 0xf6, 0xe5, 0xff, 0xff, 0xf5, 0xe4, 0xff, 0xff, 0xf3, 0xe5, 0xff, 0xff, 0xf3, 0xe5, 0xff, 0xff, 0xf4, 0xe4, 0xff, 0xff, 0xf4, 0xe4, 0xff, 0xff, 0xf5, 0xe4, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf5, 0xe4, 0xff, 0xff, 0xf5, 0xe4, 0xff, 0xff, 0xf4, 0xe3, 0xff, 0xff, 0xf4, 0xe3, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf1, 0xe2, 0xff, 0xff, 0xf1, 0xe0, 0xff, 0xff, 0xf0, 0xe0, 0xff, 0xff, 0xef, 0xdd, 0xff, 0xff, 0xed, 0xde, 0xff, 0xff, 0xed, 0xdc, 0xff, 0xff, 0xec, 0xdb, 0xff, 0xff, 0xec, 0xdb, 0xff, 0xff, 0xeb, 0xda, 0xff, 0xff, 0xe9, 0xd9, 0xff, 0xff, 0xe9, 0xd8, 0xff, 0xff, 0xe8, 0xd8, 0xff, 0xff, 0xe8, 0xd7, 0xff, 0xff, 0xe8, 0xd7, 0xff, 0xff, 0xe8, 0xd6, 0xff, 0xff, 0xe7, 0xd6, 0xff, 0xff, 0xe7, 0xd6, 0xff, 0xff, 0xe6, 0xd6, 0xff, 0xff, 0xe5, 0xd5, 0xff,
+    0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe8, 0xdb, 0xff, 0xff, 0xf1, 0xe7, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf2, 0xff, 0xfe, 0xf4, 0xf2, 0xff, 0xfe, 0xf4, 0xf3, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf3, 0xf7, 0xff, 0xfd, 0xf0, 0xf6, 0xff, 0xfd, 0xef, 0xf6, 0xff, 0xfe, 0xf3, 0xfa, 0xff, 0xff, 0xf5, 0xfb, 0xff, 0xff, 0xf5, 0xfb, 0xff, 0xff, 0xf6, 0xfb, 0xff, 0xfe, 0xf6, 0xfb, 0xff, 0xfe, 0xf7, 0xfb, 0xff, 0xfe, 0xf7, 0xfb, 0xff, 0xfe, 0xf7, 0xfb, 0xff, 0xfe, 0xf8, 0xfb, 0xff, 0xfe, 0xf8, 0xfb, 0xff, 0xfe, 0xf8, 0xfb, 0xff, 0xfe, 0xf8, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xee, 0xef, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xed, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xeb, 0xec, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xfc, 0xf6, 0xff, 0xff, 0xfa, 0xf0, 0xff, 0xff, 0xf9, 0xeb, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf5, 0xe4, 0xff, 0xff, 0xf5, 0xe3, 0xff, 0xff, 0xf5, 0xe3, 0xff, 0xff, 0xf5, 0xe3, 0xff, 0xff, 0xf5, 0xe4, 0xff, 0xff, 0xf5, 0xe4, 0xff, 0xff, 0xf5, 0xe3, 0xff, 0xff, 0xf5, 0xe3, 0xff, 0xff, 0xf5, 0xe3, 0xff, 0xff, 0xf4, 0xe3, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf4, 0xe3, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf2, 0xe2, 0xff, 0xff, 0xf1, 0xe1, 0xff, 0xff, 0xf0, 0xdf, 0xff, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xee, 0xdd, 0xff, 0xff, 0xed, 0xdd, 0xff, 0xff, 0xec, 0xdc, 0xff, 0xff, 0xec, 0xdc, 0xff, 0xff, 0xeb, 0xdc, 0xff, 0xff, 0xeb, 0xda, 0xff, 0xff, 0xe9, 0xd9, 0xff, 0xff, 0xe9, 0xd7, 0xff, 0xff, 0xe8, 0xd7, 0xff, 0xff, 0xe8, 0xd6, 0xff, 0xff, 0xe8, 0xd6, 0xff, 0xff, 0xe7, 0xd6, 0xff, 0xff, 0xe5, 0xd5, 0xff, 0xff, 0xe5, 0xd5, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff,
+    0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe8, 0xd9, 0xff, 0xff, 0xf0, 0xe5, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf5, 0xef, 0xff, 0xfe, 0xf5, 0xf0, 0xff, 0xfe, 0xf5, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf1, 0xff, 0xfe, 0xf4, 0xf2, 0xff, 0xfe, 0xf4, 0xf2, 0xff, 0xfe, 0xf4, 0xf3, 0xff, 0xfe, 0xf4, 0xf3, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfe, 0xf4, 0xf7, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xf8, 0xfc, 0xff, 0xff, 0xf6, 0xfb, 0xff, 0xff, 0xf6, 0xfb, 0xff, 0xfe, 0xf6, 0xfb, 0xff, 0xfe, 0xf7, 0xfb, 0xff, 0xfe, 0xf7, 0xfb, 0xff, 0xfe, 0xf8, 0xfb, 0xff, 0xfe, 0xf8, 0xfb, 0xff, 0xfe, 0xf8, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf4, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf3, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf3, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf2, 0xf2, 0xff, 0xfe, 0xf1, 0xf2, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf1, 0xf1, 0xff, 0xfe, 0xf0, 0xf1, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xf0, 0xf0, 0xff, 0xfe, 0xef, 0xf0, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xef, 0xef, 0xff, 0xfe, 0xee, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xee, 0xef, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xec, 0xed, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfc, 0xf6, 0xff, 0xff, 0xf9, 0xef, 0xff, 0xff, 0xf7, 0xea, 0xff, 0xff, 0xf5, 0xe6, 0xff, 0xff, 0xf5, 0xe3, 0xff, 0xff, 0xf5, 0xe3, 0xff, 0xff, 0xf5, 0xe3, 0xff, 0xff, 0xf5, 0xe3, 0xff, 0xff, 0xf5, 0xe3, 0xff, 0xff, 0xf5, 0xe3, 0xff, 0xff, 0xf4, 0xe3, 0xff, 0xff, 0xf4, 0xe3, 0xff, 0xff, 0xf4, 0xe3, 0xff, 0xff, 0xf4, 0xe2, 0xff, 0xff, 0xf2, 0xe1, 0xff, 0xff, 0xf2, 0xe0, 0xff, 0xff, 0xf0, 0xe0, 0xff, 0xff, 0xf0, 0xdf, 0xff, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xee, 0xdd, 0xff, 0xff, 0xec, 0xdc, 0xff, 0xff, 0xec, 0xdb, 0xff, 0xff, 0xeb, 0xda, 0xff, 0xff, 0xea, 0xda, 0xff, 0xff, 0xea, 0xd9, 0xff, 0xff, 0xe8, 0xd8, 0xff, 0xff, 0xe8, 0xd7, 0xff, 0xff, 0xe9, 0xd7, 0xff, 0xff, 0xe8, 0xd6, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff,
+    0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe7, 0xd8, 0xff, 0xff, 0xf0, 0xe6, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xea, 0xff, 0xff, 0xf2, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf5, 0xef, 0xff, 0xfe, 0xf5, 0xf0, 0xff, 0xfe, 0xf5, 0xf1, 0xff, 0xfe, 0xf5, 0xf1, 0xff, 0xfe, 0xf5, 0xf2, 0xff, 0xfe, 0xf5, 0xf2, 0xff, 0xfe, 0xf5, 0xf2, 0xff, 0xfe, 0xf5, 0xf3, 0xff, 0xfe, 0xf5, 0xf3, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf4, 0xf4, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfe, 0xf4, 0xf7, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xf9, 0xfc, 0xff, 0xfe, 0xf7, 0xfb, 0xff, 0xfe, 0xf8, 0xfb, 0xff, 0xfe, 0xf8, 0xfb, 0xff, 0xfe, 0xf8, 0xfb, 0xff, 0xfe, 0xf8, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf8, 0xff, 0xfe, 0xf8, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf4, 0xf5, 0xff, 0xff, 0xf4, 0xf5, 0xff, 0xff, 0xf4, 0xf5, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf3, 0xf4, 0xff, 0xff, 0xf3, 0xf4, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf2, 0xf3, 0xff, 0xff, 0xf2, 0xf3, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf1, 0xf2, 0xff, 0xff, 0xf1, 0xf2, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf0, 0xf1, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xef, 0xf0, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xee, 0xef, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xec, 0xed, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xeb, 0xeb, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf9, 0xff, 0xff, 0xf9, 0xf1, 0xff, 0xff, 0xf7, 0xea, 0xff, 0xff, 0xf5, 0xe6, 0xff, 0xff, 0xf4, 0xe4, 0xff, 0xff, 0xf5, 0xe3, 0xff, 0xff, 0xf5, 0xe3, 0xff, 0xff, 0xf4, 0xe3, 0xff, 0xff, 0xf4, 0xe3, 0xff, 0xff, 0xf4, 0xe3, 0xff, 0xff, 0xf4, 0xe3, 0xff, 0xff, 0xf3, 0xe1, 0xff, 0xff, 0xf3, 0xe0, 0xff, 0xff, 0xf2, 0xe0, 0xff, 0xff, 0xf1, 0xdf, 0xff, 0xff, 0xf0, 0xde, 0xff, 0xff, 0xee, 0xde, 0xff, 0xff, 0xee, 0xdd, 0xff, 0xff, 0xec, 0xdc, 0xff, 0xff, 0xeb, 0xdb, 0xff, 0xff, 0xeb, 0xda, 0xff, 0xff, 0xea, 0xd9, 0xff, 0xff, 0xea, 0xd8, 0xff, 0xff, 0xe8, 0xd7, 0xff, 0xff, 0xe7, 0xd6, 0xff, 0xff, 0xe8, 0xd6, 0xff, 0xff, 0xe7, 0xd5, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff,
+    0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe9, 0xda, 0xff, 0xff, 0xf0, 0xe5, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf5, 0xef, 0xff, 0xfe, 0xf5, 0xf0, 0xff, 0xfe, 0xf5, 0xf1, 0xff, 0xfe, 0xf5, 0xf1, 0xff, 0xfe, 0xf5, 0xf2, 0xff, 0xfe, 0xf5, 0xf2, 0xff, 0xfe, 0xf5, 0xf2, 0xff, 0xfe, 0xf5, 0xf3, 0xff, 0xfe, 0xf5, 0xf3, 0xff, 0xfe, 0xf5, 0xf4, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf4, 0xf5, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf6, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfe, 0xf6, 0xf8, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xfa, 0xfc, 0xff, 0xfe, 0xf8, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf4, 0xf5, 0xff, 0xff, 0xf4, 0xf5, 0xff, 0xff, 0xf4, 0xf5, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf3, 0xf4, 0xff, 0xff, 0xf3, 0xf4, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf2, 0xf3, 0xff, 0xff, 0xf2, 0xf3, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf1, 0xf2, 0xff, 0xff, 0xf1, 0xf2, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf0, 0xf1, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xef, 0xf0, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xee, 0xef, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xec, 0xed, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xeb, 0xec, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf8, 0xff, 0xff, 0xf9, 0xf1, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf5, 0xe4, 0xff, 0xff, 0xf4, 0xe3, 0xff, 0xff, 0xf4, 0xe3, 0xff, 0xff, 0xf4, 0xe3, 0xff, 0xff, 0xf4, 0xe3, 0xff, 0xff, 0xf3, 0xe1, 0xff, 0xff, 0xf3, 0xe1, 0xff, 0xff, 0xf2, 0xe0, 0xff, 0xff, 0xf1, 0xde, 0xff, 0xff, 0xf0, 0xde, 0xff, 0xff, 0xee, 0xdd, 0xff, 0xff, 0xed, 0xdd, 0xff, 0xff, 0xec, 0xdc, 0xff, 0xff, 0xeb, 0xdb, 0xff, 0xff, 0xeb, 0xda, 0xff, 0xff, 0xea, 0xd9, 0xff, 0xff, 0xea, 0xd8, 0xff, 0xff, 0xe8, 0xd6, 0xff, 0xff, 0xe7, 0xd5, 0xff, 0xff, 0xe8, 0xd5, 0xff, 0xff, 0xe6, 0xd5, 0xff, 0xff, 0xe5, 0xd5, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff,
+    0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xeb, 0xde, 0xff, 0xff, 0xf2, 0xe9, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xea, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf5, 0xf0, 0xff, 0xfe, 0xf5, 0xf0, 0xff, 0xfe, 0xf5, 0xf1, 0xff, 0xfe, 0xf5, 0xf1, 0xff, 0xfe, 0xf5, 0xf2, 0xff, 0xfe, 0xf5, 0xf2, 0xff, 0xfe, 0xf5, 0xf2, 0xff, 0xfe, 0xf5, 0xf3, 0xff, 0xfe, 0xf5, 0xf3, 0xff, 0xfe, 0xf5, 0xf4, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xfb, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xfb, 0xfc, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf4, 0xf5, 0xff, 0xff, 0xf4, 0xf5, 0xff, 0xff, 0xf4, 0xf5, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf3, 0xf4, 0xff, 0xff, 0xf3, 0xf4, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf2, 0xf3, 0xff, 0xff, 0xf2, 0xf3, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf1, 0xf2, 0xff, 0xff, 0xf1, 0xf2, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf0, 0xf1, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xef, 0xf0, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xee, 0xef, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfa, 0xff, 0xff, 0xf9, 0xf1, 0xff, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0xf4, 0xe3, 0xff, 0xff, 0xf4, 0xe2, 0xff, 0xff, 0xf4, 0xe1, 0xff, 0xff, 0xf3, 0xe1, 0xff, 0xff, 0xf2, 0xe0, 0xff, 0xff, 0xf1, 0xde, 0xff, 0xff, 0xf0, 0xde, 0xff, 0xff, 0xef, 0xdc, 0xff, 0xff, 0xee, 0xdc, 0xff, 0xff, 0xeb, 0xda, 0xff, 0xff, 0xea, 0xda, 0xff, 0xff, 0xeb, 0xda, 0xff, 0xff, 0xe9, 0xd9, 0xff, 0xff, 0xea, 0xd8, 0xff, 0xff, 0xe8, 0xd6, 0xff, 0xff, 0xe8, 0xd6, 0xff, 0xff, 0xe8, 0xd5, 0xff, 0xff, 0xe6, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe5, 0xd4, 0xff, 0xff, 0xe4, 0xd3, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff,
+    0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd3, 0xff, 0xff, 0xe9, 0xdb, 0xff, 0xff, 0xef, 0xe4, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xeb, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf3, 0xee, 0xff, 0xff, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xee, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf5, 0xf0, 0xff, 0xfe, 0xf5, 0xf1, 0xff, 0xfe, 0xf5, 0xf1, 0xff, 0xfe, 0xf5, 0xf2, 0xff, 0xfe, 0xf5, 0xf2, 0xff, 0xfe, 0xf5, 0xf2, 0xff, 0xfe, 0xf5, 0xf3, 0xff, 0xfe, 0xf5, 0xf3, 0xff, 0xfe, 0xf5, 0xf4, 0xff, 0xfe, 0xf5, 0xf4, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf7, 0xff, 0xfe, 0xf5, 0xf7, 0xff, 0xfe, 0xf5, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfe, 0xf4, 0xf8, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfb, 0xfc, 0xff, 0xfe, 0xfa, 0xfc, 0xff, 0xfe, 0xfa, 0xfc, 0xff, 0xfe, 0xfa, 0xfc, 0xff, 0xfe, 0xfa, 0xfc, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xff, 0xf5, 0xf6, 0xff, 0xff, 0xf5, 0xf6, 0xff, 0xff, 0xf5, 0xf6, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf4, 0xf5, 0xff, 0xff, 0xf4, 0xf5, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf3, 0xf4, 0xff, 0xff, 0xf3, 0xf4, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf2, 0xf3, 0xff, 0xff, 0xf2, 0xf3, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf1, 0xf2, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf0, 0xf1, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xef, 0xf0, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xee, 0xef, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xec, 0xed, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfb, 0xf6, 0xff, 0xff, 0xf9, 0xed, 0xff, 0xff, 0xf5, 0xe5, 0xff, 0xff, 0xf2, 0xdf, 0xff, 0xff, 0xf2, 0xde, 0xff, 0xff, 0xf0, 0xde, 0xff, 0xff, 0xef, 0xdd, 0xff, 0xff, 0xee, 0xdc, 0xff, 0xff, 0xec, 0xda, 0xff, 0xff, 0xeb, 0xd9, 0xff, 0xff, 0xeb, 0xd9, 0xff, 0xff, 0xe9, 0xd8, 0xff, 0xff, 0xe8, 0xd6, 0xff, 0xff, 0xe8, 0xd5, 0xff, 0xff, 0xe7, 0xd4, 0xff, 0xff, 0xe7, 0xd4, 0xff, 0xff, 0xe6, 0xd3, 0xff, 0xff, 0xe6, 0xd3, 0xff, 0xff, 0xe5, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff,
+    0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe6, 0xd6, 0xff, 0xff, 0xea, 0xde, 0xff, 0xff, 0xef, 0xe5, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xed, 0xff, 0xff, 0xf5, 0xed, 0xff, 0xff, 0xf5, 0xed, 0xff, 0xff, 0xf5, 0xed, 0xff, 0xff, 0xf5, 0xed, 0xff, 0xff, 0xf5, 0xed, 0xff, 0xff, 0xf5, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xec, 0xff, 0xff, 0xf3, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xec, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xee, 0xff, 0xff, 0xf4, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xef, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf4, 0xf0, 0xff, 0xfe, 0xf5, 0xf1, 0xff, 0xfe, 0xf5, 0xf1, 0xff, 0xfe, 0xf5, 0xf1, 0xff, 0xfe, 0xf5, 0xf2, 0xff, 0xfe, 0xf5, 0xf2, 0xff, 0xfe, 0xf5, 0xf3, 0xff, 0xfe, 0xf5, 0xf3, 0xff, 0xfe, 0xf5, 0xf3, 0xff, 0xfe, 0xf5, 0xf4, 0xff, 0xfe, 0xf5, 0xf4, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf7, 0xff, 0xfe, 0xf5, 0xf7, 0xff, 0xfe, 0xf5, 0xf7, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfd, 0xf4, 0xf7, 0xff, 0xfe, 0xf4, 0xf8, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xfe, 0xfb, 0xfc, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xff, 0xf5, 0xf6, 0xff, 0xff, 0xf5, 0xf6, 0xff, 0xff, 0xf5, 0xf6, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf4, 0xf5, 0xff, 0xff, 0xf4, 0xf5, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf3, 0xf4, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf2, 0xf3, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf1, 0xf2, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf0, 0xf1, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xef, 0xf0, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xee, 0xef, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xec, 0xed, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfd, 0xfa, 0xff, 0xff, 0xfb, 0xf5, 0xff, 0xff, 0xf8, 0xee, 0xff, 0xff, 0xf5, 0xe7, 0xff, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xed, 0xdb, 0xff, 0xff, 0xec, 0xd9, 0xff, 0xff, 0xec, 0xd9, 0xff, 0xff, 0xe9, 0xd8, 0xff, 0xff, 0xe9, 0xd6, 0xff, 0xff, 0xe8, 0xd5, 0xff, 0xff, 0xe7, 0xd4, 0xff, 0xff, 0xe8, 0xd4, 0xff, 0xff, 0xe7, 0xd3, 0xff, 0xff, 0xe6, 0xd3, 0xff, 0xff, 0xe6, 0xd3, 0xff, 0xff, 0xe4, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff,
+    0xff, 0xe9, 0xdb, 0xff, 0xff, 0xec, 0xe1, 0xff, 0xff, 0xf1, 0xe8, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf7, 0xf2, 0xff, 0xff, 0xf7, 0xf3, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf6, 0xef, 0xff, 0xff, 0xf6, 0xef, 0xff, 0xff, 0xf6, 0xef, 0xff, 0xff, 0xf6, 0xef, 0xff, 0xff, 0xf5, 0xef, 0xff, 0xff, 0xf5, 0xef, 0xff, 0xff, 0xf5, 0xef, 0xff, 0xff, 0xf5, 0xef, 0xff, 0xff, 0xf5, 0xef, 0xff, 0xff, 0xf5, 0xef, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xed, 0xff, 0xff, 0xf5, 0xed, 0xff, 0xff, 0xf5, 0xed, 0xff, 0xff, 0xf5, 0xed, 0xff, 0xff, 0xf5, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf5, 0xed, 0xff, 0xff, 0xf4, 0xed, 0xff, 0xff, 0xf4, 0xee, 0xff, 0xff, 0xf4, 0xee, 0xff, 0xff, 0xf4, 0xee, 0xff, 0xff, 0xf4, 0xef, 0xff, 0xff, 0xf4, 0xef, 0xff, 0xfe, 0xf5, 0xef, 0xff, 0xfe, 0xf5, 0xef, 0xff, 0xfe, 0xf5, 0xf0, 0xff, 0xfe, 0xf5, 0xf0, 0xff, 0xfe, 0xf5, 0xf0, 0xff, 0xfe, 0xf5, 0xf1, 0xff, 0xfe, 0xf5, 0xf1, 0xff, 0xfe, 0xf5, 0xf2, 0xff, 0xfe, 0xf5, 0xf2, 0xff, 0xfe, 0xf5, 0xf2, 0xff, 0xfe, 0xf5, 0xf3, 0xff, 0xfe, 0xf5, 0xf3, 0xff, 0xfe, 0xf5, 0xf3, 0xff, 0xfe, 0xf5, 0xf4, 0xff, 0xfe, 0xf5, 0xf4, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf7, 0xff, 0xfe, 0xf5, 0xf7, 0xff, 0xfe, 0xf5, 0xf7, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf4, 0xf8, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xfe, 0xfb, 0xfc, 0xff, 0xfe, 0xfb, 0xfc, 0xff, 0xfe, 0xfb, 0xfc, 0xff, 0xfe, 0xfb, 0xfc, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xf9, 0xff, 0xfe, 0xf9, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf8, 0xff, 0xfe, 0xf8, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xff, 0xf6, 0xf7, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf5, 0xf6, 0xff, 0xff, 0xf5, 0xf6, 0xff, 0xff, 0xf5, 0xf6, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf3, 0xf4, 0xff, 0xff, 0xf3, 0xf4, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf2, 0xf3, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf1, 0xf2, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf0, 0xf1, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xef, 0xf0, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xee, 0xef, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xfd, 0xf9, 0xff, 0xff, 0xfc, 0xf8, 0xff, 0xff, 0xf9, 0xf3, 0xff, 0xff, 0xf8, 0xee, 0xff, 0xff, 0xf6, 0xea, 0xff, 0xff, 0xf2, 0xe5, 0xff, 0xff, 0xf0, 0xe1, 0xff, 0xff, 0xec, 0xdc, 0xff, 0xff, 0xea, 0xd6, 0xff, 0xff, 0xe9, 0xd3, 0xff, 0xff, 0xe8, 0xd3, 0xff, 0xff, 0xe6, 0xd3, 0xff, 0xff, 0xe4, 0xd2, 0xff, 0xff, 0xe3, 0xd2, 0xff, 0xff, 0xe5, 0xd6, 0xff,
+    0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xf8, 0xf3, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xef, 0xff, 0xff, 0xf6, 0xef, 0xff, 0xff, 0xf6, 0xef, 0xff, 0xff, 0xf6, 0xef, 0xff, 0xff, 0xf6, 0xef, 0xff, 0xff, 0xf6, 0xef, 0xff, 0xff, 0xf6, 0xef, 0xff, 0xff, 0xf6, 0xef, 0xff, 0xff, 0xf6, 0xef, 0xff, 0xff, 0xf5, 0xef, 0xff, 0xff, 0xf5, 0xef, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xef, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xee, 0xff, 0xff, 0xf5, 0xef, 0xff, 0xff, 0xf5, 0xef, 0xff, 0xff, 0xf5, 0xef, 0xff, 0xff, 0xf5, 0xf0, 0xff, 0xff, 0xf5, 0xf0, 0xff, 0xff, 0xf5, 0xf0, 0xff, 0xfe, 0xf5, 0xf0, 0xff, 0xfe, 0xf5, 0xf1, 0xff, 0xfe, 0xf5, 0xf1, 0xff, 0xfe, 0xf5, 0xf1, 0xff, 0xfe, 0xf6, 0xf1, 0xff, 0xfe, 0xf6, 0xf1, 0xff, 0xfe, 0xf6, 0xf2, 0xff, 0xfe, 0xf5, 0xf3, 0xff, 0xfe, 0xf5, 0xf3, 0xff, 0xfe, 0xf5, 0xf3, 0xff, 0xfe, 0xf5, 0xf4, 0xff, 0xfe, 0xf5, 0xf4, 0xff, 0xfe, 0xf5, 0xf4, 0xff, 0xfe, 0xf5, 0xf4, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf7, 0xff, 0xfe, 0xf5, 0xf7, 0xff, 0xfe, 0xf5, 0xf7, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xfe, 0xfb, 0xfc, 0xff, 0xfe, 0xfb, 0xfc, 0xff, 0xfe, 0xfb, 0xfc, 0xff, 0xfe, 0xfb, 0xfc, 0xff, 0xfe, 0xfb, 0xfc, 0xff, 0xfe, 0xfb, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfa, 0xff, 0xfe, 0xfa, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf8, 0xff, 0xfe, 0xf8, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xff, 0xf6, 0xf7, 0xff, 0xff, 0xf6, 0xf7, 0xff, 0xff, 0xf6, 0xf7, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf5, 0xf6, 0xff, 0xff, 0xf5, 0xf6, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf4, 0xf5, 0xff, 0xff, 0xf4, 0xf5, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf3, 0xf4, 0xff, 0xff, 0xf3, 0xf4, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf2, 0xf3, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf1, 0xf2, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf0, 0xf1, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xef, 0xf0, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xed, 0xee, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xed, 0xed, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf8, 0xf2, 0xff, 0xff, 0xf7, 0xf2, 0xff, 0xff, 0xf7, 0xf2, 0xff, 0xff, 0xf7, 0xf2, 0xff, 0xff, 0xf7, 0xf2, 0xff, 0xff, 0xf7, 0xf2, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xef, 0xff, 0xff, 0xf6, 0xef, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf5, 0xef, 0xff, 0xff, 0xf5, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf6, 0xf0, 0xff, 0xff, 0xf5, 0xf0, 0xff, 0xff, 0xf5, 0xf1, 0xff, 0xff, 0xf6, 0xf1, 0xff, 0xfe, 0xf6, 0xf1, 0xff, 0xfe, 0xf6, 0xf1, 0xff, 0xfe, 0xf6, 0xf1, 0xff, 0xfe, 0xf5, 0xf2, 0xff, 0xfe, 0xf6, 0xf2, 0xff, 0xfe, 0xf6, 0xf2, 0xff, 0xfe, 0xf6, 0xf2, 0xff, 0xfe, 0xf6, 0xf3, 0xff, 0xfe, 0xf6, 0xf3, 0xff, 0xfe, 0xf6, 0xf4, 0xff, 0xfe, 0xf6, 0xf4, 0xff, 0xfe, 0xf5, 0xf4, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf7, 0xff, 0xfe, 0xf5, 0xf7, 0xff, 0xfe, 0xf5, 0xf7, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf8, 0xfa, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xfe, 0xfb, 0xfc, 0xff, 0xfe, 0xfb, 0xfc, 0xff, 0xfe, 0xfb, 0xfb, 0xff, 0xfe, 0xfb, 0xfb, 0xff, 0xfe, 0xfb, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfa, 0xff, 0xfe, 0xfa, 0xfa, 0xff, 0xfe, 0xfa, 0xfa, 0xff, 0xfe, 0xfa, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xf9, 0xff, 0xfe, 0xf9, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf8, 0xff, 0xfe, 0xf8, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xff, 0xf7, 0xf8, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf6, 0xf7, 0xff, 0xff, 0xf6, 0xf7, 0xff, 0xff, 0xf6, 0xf7, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf4, 0xf5, 0xff, 0xff, 0xf4, 0xf5, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf3, 0xf4, 0xff, 0xff, 0xf3, 0xf4, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf2, 0xf3, 0xff, 0xff, 0xf2, 0xf3, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf1, 0xf2, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf0, 0xf1, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xef, 0xf0, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xff, 0xf9, 0xf4, 0xff, 0xff, 0xf8, 0xf4, 0xff, 0xff, 0xf8, 0xf4, 0xff, 0xff, 0xf8, 0xf4, 0xff, 0xff, 0xf8, 0xf4, 0xff, 0xff, 0xf8, 0xf4, 0xff, 0xff, 0xf8, 0xf3, 0xff, 0xff, 0xf8, 0xf3, 0xff, 0xff, 0xf8, 0xf3, 0xff, 0xff, 0xf8, 0xf3, 0xff, 0xff, 0xf8, 0xf3, 0xff, 0xff, 0xf8, 0xf3, 0xff, 0xff, 0xf8, 0xf3, 0xff, 0xff, 0xf8, 0xf3, 0xff, 0xff, 0xf8, 0xf3, 0xff, 0xff, 0xf8, 0xf3, 0xff, 0xff, 0xf8, 0xf2, 0xff, 0xff, 0xf8, 0xf3, 0xff, 0xff, 0xf8, 0xf2, 0xff, 0xff, 0xf8, 0xf2, 0xff, 0xff, 0xf8, 0xf2, 0xff, 0xff, 0xf8, 0xf2, 0xff, 0xff, 0xf8, 0xf2, 0xff, 0xff, 0xf7, 0xf2, 0xff, 0xff, 0xf7, 0xf2, 0xff, 0xff, 0xf7, 0xf2, 0xff, 0xff, 0xf7, 0xf2, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf6, 0xf1, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf7, 0xf2, 0xff, 0xff, 0xf7, 0xf1, 0xff, 0xff, 0xf6, 0xf2, 0xff, 0xff, 0xf6, 0xf1, 0xff, 0xff, 0xf6, 0xf2, 0xff, 0xff, 0xf7, 0xf2, 0xff, 0xfe, 0xf7, 0xf2, 0xff, 0xfe, 0xf6, 0xf2, 0xff, 0xfe, 0xf6, 0xf2, 0xff, 0xfe, 0xf6, 0xf3, 0xff, 0xfe, 0xf7, 0xf3, 0xff, 0xfe, 0xf7, 0xf3, 0xff, 0xfe, 0xf6, 0xf3, 0xff, 0xfe, 0xf6, 0xf4, 0xff, 0xfe, 0xf6, 0xf4, 0xff, 0xfe, 0xf6, 0xf4, 0xff, 0xfe, 0xf6, 0xf5, 0xff, 0xfe, 0xf6, 0xf5, 0xff, 0xfe, 0xf6, 0xf5, 0xff, 0xfe, 0xf6, 0xf5, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xfe, 0xf5, 0xf7, 0xff, 0xfe, 0xf5, 0xf7, 0xff, 0xfe, 0xf5, 0xf7, 0xff, 0xfe, 0xf5, 0xf7, 0xff, 0xfe, 0xf5, 0xf7, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xfe, 0xfb, 0xfb, 0xff, 0xfe, 0xfb, 0xfb, 0xff, 0xfe, 0xfb, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfa, 0xff, 0xfe, 0xfa, 0xfa, 0xff, 0xfe, 0xfa, 0xfa, 0xff, 0xfe, 0xfa, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xf9, 0xff, 0xfe, 0xf9, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf8, 0xff, 0xfe, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf7, 0xf8, 0xff, 0xff, 0xf7, 0xf8, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf6, 0xf7, 0xff, 0xff, 0xf6, 0xf7, 0xff, 0xff, 0xf6, 0xf7, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf3, 0xf4, 0xff, 0xff, 0xf3, 0xf4, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf2, 0xf3, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf1, 0xf2, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf0, 0xf1, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xef, 0xf0, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfb, 0xf9, 0xff, 0xff, 0xfa, 0xf6, 0xff, 0xff, 0xf9, 0xf6, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf4, 0xff, 0xff, 0xf9, 0xf4, 0xff, 0xff, 0xf9, 0xf4, 0xff, 0xff, 0xf9, 0xf4, 0xff, 0xff, 0xf9, 0xf4, 0xff, 0xff, 0xf9, 0xf4, 0xff, 0xff, 0xf9, 0xf4, 0xff, 0xff, 0xf9, 0xf4, 0xff, 0xff, 0xf8, 0xf4, 0xff, 0xff, 0xf8, 0xf4, 0xff, 0xff, 0xf8, 0xf4, 0xff, 0xff, 0xf8, 0xf3, 0xff, 0xff, 0xf8, 0xf3, 0xff, 0xff, 0xf8, 0xf3, 0xff, 0xff, 0xf8, 0xf3, 0xff, 0xff, 0xf8, 0xf3, 0xff, 0xff, 0xf8, 0xf3, 0xff, 0xff, 0xf8, 0xf3, 0xff, 0xff, 0xf8, 0xf3, 0xff, 0xff, 0xf8, 0xf3, 0xff, 0xff, 0xf8, 0xf3, 0xff, 0xff, 0xf8, 0xf3, 0xff, 0xff, 0xf7, 0xf3, 0xff, 0xff, 0xf8, 0xf4, 0xff, 0xfe, 0xf7, 0xf3, 0xff, 0xfe, 0xf7, 0xf4, 0xff, 0xfe, 0xf7, 0xf4, 0xff, 0xfe, 0xf7, 0xf4, 0xff, 0xfe, 0xf7, 0xf4, 0xff, 0xfe, 0xf7, 0xf4, 0xff, 0xfe, 0xf7, 0xf4, 0xff, 0xfe, 0xf7, 0xf5, 0xff, 0xfe, 0xf7, 0xf4, 0xff, 0xfe, 0xf7, 0xf5, 0xff, 0xfe, 0xf7, 0xf5, 0xff, 0xfe, 0xf6, 0xf5, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf8, 0xff, 0xfe, 0xf5, 0xf7, 0xff, 0xfe, 0xf5, 0xf7, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf6, 0xf9, 0xff, 0xfe, 0xfa, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xfe, 0xfb, 0xfb, 0xff, 0xfe, 0xfb, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfa, 0xff, 0xfe, 0xfa, 0xfa, 0xff, 0xfe, 0xfa, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xf9, 0xff, 0xfe, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf7, 0xf8, 0xff, 0xff, 0xf7, 0xf8, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf6, 0xf7, 0xff, 0xff, 0xf6, 0xf7, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf5, 0xf6, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf4, 0xf5, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf3, 0xf4, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf2, 0xf3, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf1, 0xf2, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xff, 0xfa, 0xf6, 0xff, 0xff, 0xfa, 0xf6, 0xff, 0xff, 0xfa, 0xf6, 0xff, 0xff, 0xfa, 0xf6, 0xff, 0xff, 0xfa, 0xf6, 0xff, 0xff, 0xfa, 0xf6, 0xff, 0xff, 0xfa, 0xf6, 0xff, 0xff, 0xfa, 0xf6, 0xff, 0xff, 0xfa, 0xf6, 0xff, 0xff, 0xfa, 0xf6, 0xff, 0xff, 0xfa, 0xf6, 0xff, 0xff, 0xfa, 0xf6, 0xff, 0xff, 0xfa, 0xf6, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf8, 0xf5, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xf8, 0xf5, 0xff, 0xff, 0xf8, 0xf5, 0xff, 0xff, 0xf8, 0xf5, 0xff, 0xff, 0xf8, 0xf5, 0xff, 0xff, 0xf8, 0xf5, 0xff, 0xff, 0xf8, 0xf5, 0xff, 0xfe, 0xf8, 0xf5, 0xff, 0xfe, 0xf8, 0xf6, 0xff, 0xfe, 0xf8, 0xf5, 0xff, 0xfe, 0xf7, 0xf6, 0xff, 0xfe, 0xf7, 0xf6, 0xff, 0xfe, 0xf7, 0xf6, 0xff, 0xfe, 0xf7, 0xf6, 0xff, 0xfe, 0xf7, 0xf6, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xfe, 0xf6, 0xf8, 0xff, 0xfe, 0xf6, 0xf8, 0xff, 0xfe, 0xf6, 0xf8, 0xff, 0xfe, 0xf6, 0xf8, 0xff, 0xfe, 0xf6, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfa, 0xfb, 0xff, 0xfe, 0xfa, 0xfa, 0xff, 0xfe, 0xfa, 0xfa, 0xff, 0xfe, 0xfa, 0xfa, 0xff, 0xfe, 0xfa, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xff, 0xf9, 0xfa, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf6, 0xf7, 0xff, 0xff, 0xf6, 0xf7, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf5, 0xf6, 0xff, 0xff, 0xf5, 0xf6, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf4, 0xf5, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf3, 0xf4, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf2, 0xf3, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfb, 0xf9, 0xff, 0xff, 0xfb, 0xf9, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfb, 0xf7, 0xff, 0xff, 0xfb, 0xf7, 0xff, 0xff, 0xfa, 0xf8, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xff, 0xfa, 0xf7, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0xff, 0xf9, 0xf6, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0xff, 0xf8, 0xf7, 0xff, 0xff, 0xf8, 0xf7, 0xff, 0xfe, 0xf8, 0xf7, 0xff, 0xfe, 0xf8, 0xf7, 0xff, 0xfe, 0xf8, 0xf7, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf6, 0xf8, 0xff, 0xfe, 0xf6, 0xf8, 0xff, 0xfe, 0xf6, 0xf8, 0xff, 0xfe, 0xf6, 0xf8, 0xff, 0xfe, 0xf6, 0xf8, 0xff, 0xfe, 0xf6, 0xf8, 0xff, 0xfe, 0xf6, 0xf8, 0xff, 0xfe, 0xf6, 0xf8, 0xff, 0xfe, 0xf6, 0xf9, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfa, 0xfb, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xf9, 0xfa, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf8, 0xf9, 0xff, 0xff, 0xf8, 0xf9, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf7, 0xf8, 0xff, 0xff, 0xf7, 0xf8, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf6, 0xf7, 0xff, 0xff, 0xf6, 0xf7, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf5, 0xf6, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf4, 0xf5, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf3, 0xf4, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf2, 0xf2, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfc, 0xf9, 0xff, 0xff, 0xfc, 0xf9, 0xff, 0xff, 0xfc, 0xf9, 0xff, 0xff, 0xfc, 0xf9, 0xff, 0xff, 0xfc, 0xf9, 0xff, 0xff, 0xfb, 0xf9, 0xff, 0xff, 0xfb, 0xf9, 0xff, 0xff, 0xfb, 0xf9, 0xff, 0xff, 0xfb, 0xf9, 0xff, 0xff, 0xfb, 0xf9, 0xff, 0xff, 0xfb, 0xf9, 0xff, 0xff, 0xfb, 0xf9, 0xff, 0xff, 0xfb, 0xf9, 0xff, 0xff, 0xfb, 0xf9, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfb, 0xf9, 0xff, 0xff, 0xfa, 0xf8, 0xff, 0xff, 0xfa, 0xf8, 0xff, 0xff, 0xfa, 0xf8, 0xff, 0xff, 0xfa, 0xf8, 0xff, 0xff, 0xfa, 0xf8, 0xff, 0xff, 0xfa, 0xf8, 0xff, 0xff, 0xfa, 0xf8, 0xff, 0xff, 0xf9, 0xf8, 0xff, 0xff, 0xf9, 0xf8, 0xff, 0xff, 0xf9, 0xf8, 0xff, 0xff, 0xf9, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xfe, 0xf8, 0xf8, 0xff, 0xfe, 0xf8, 0xf8, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf7, 0xf8, 0xff, 0xfe, 0xf6, 0xf9, 0xff, 0xfe, 0xf6, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfa, 0xfb, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf6, 0xf7, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf5, 0xf6, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf4, 0xf5, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfb, 0xfa, 0xff, 0xff, 0xfb, 0xfa, 0xff, 0xff, 0xfb, 0xfa, 0xff, 0xff, 0xfb, 0xfa, 0xff, 0xff, 0xfb, 0xf9, 0xff, 0xff, 0xfb, 0xf9, 0xff, 0xff, 0xfa, 0xf9, 0xff, 0xff, 0xfa, 0xf9, 0xff, 0xff, 0xfa, 0xf9, 0xff, 0xff, 0xfa, 0xf9, 0xff, 0xff, 0xfa, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xf9, 0xff, 0xfe, 0xf7, 0xfa, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfa, 0xfb, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xf9, 0xfa, 0xff, 0xff, 0xf9, 0xfa, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf8, 0xf9, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf7, 0xf8, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf6, 0xf7, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xfa, 0xff, 0xff, 0xfb, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xf9, 0xfa, 0xff, 0xfe, 0xfb, 0xfc, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfa, 0xfb, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf8, 0xf9, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xfe, 0xfb, 0xfb, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfe, 0xfb, 0xfc, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfa, 0xfb, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xf9, 0xfa, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf8, 0xf9, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xf9, 0xfa, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf8, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+const lv_image_dsc_t img_lv_demo_music_wave_top = {
+    .header.w = 272,
+    .header.h = 42,
+    .header.stride = 1088,
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .data = img_lv_demo_music_wave_top_map,
+    .data_size = sizeof(img_lv_demo_music_wave_top_map),
+};
+
+#endif /*LV_USE_DEMO_MUSIC*/
+
+
@@ -0,0 +1,446 @@
+const uint16_t spectrum_1[][4] = {
+{ 0, 0, 0, 0, },
+{ 0, 9, 7, 8, },
+{ 5, 39, 24, 29, },
+{ 14, 44, 34, 45, },
+{ 16, 25, 32, 48, },
+{ 16, 18, 29, 44, },
+{ 15, 20, 26, 40, },
+{ 15, 19, 24, 37, },
+{ 14, 19, 27, 42, },
+{ 13, 17, 29, 39, },
+{ 12, 17, 24, 31, },
+{ 11, 17, 24, 29, },
+{ 9, 19, 22, 26, },
+{ 6, 19, 27, 35, },
+{ 4, 18, 28, 38, },
+{ 2, 17, 20, 26, },
+{ 1, 15, 16, 20, },
+{ 1, 27, 18, 18, },
+{ 8, 52, 22, 31, },
+{ 16, 44, 20, 39, },
+{ 16, 29, 15, 25, },
+{ 16, 28, 12, 14, },
+{ 16, 27, 17, 14, },
+{ 15, 23, 53, 36, },
+{ 12, 20, 69, 51, },
+{ 11, 19, 53, 47, },
+{ 11, 20, 47, 43, },
+{ 10, 19, 45, 43, },
+{ 8, 16, 41, 43, },
+{ 5, 15, 43, 46, },
+{ 3, 12, 38, 42, },
+{ 2, 12, 27, 36, },
+{ 1, 12, 21, 35, },
+{ 2, 34, 26, 34, },
+{ 12, 55, 30, 30, },
+{ 17, 38, 19, 18, },
+{ 16, 25, 13, 13, },
+{ 16, 21, 13, 11, },
+{ 16, 17, 18, 19, },
+{ 14, 18, 23, 40, },
+{ 14, 16, 28, 44, },
+{ 13, 17, 24, 35, },
+{ 12, 15, 17, 32, },
+{ 11, 14, 16, 27, },
+{ 8, 13, 16, 27, },
+{ 5, 12, 19, 28, },
+{ 3, 11, 21, 32, },
+{ 1, 16, 19, 29, },
+{ 0, 20, 16, 18, },
+{ 0, 20, 16, 29, },
+{ 0, 17, 21, 46, },
+{ 0, 13, 23, 41, },
+{ 0, 11, 21, 33, },
+{ 0, 11, 18, 31, },
+{ 2, 34, 25, 32, },
+{ 12, 52, 29, 36, },
+{ 17, 28, 24, 36, },
+{ 16, 19, 23, 33, },
+{ 16, 19, 22, 30, },
+{ 15, 19, 21, 31, },
+{ 15, 19, 24, 35, },
+{ 14, 20, 24, 35, },
+{ 13, 21, 19, 22, },
+{ 13, 21, 16, 15, },
+{ 11, 20, 25, 17, },
+{ 7, 21, 62, 42, },
+{ 4, 19, 72, 56, },
+{ 2, 15, 55, 49, },
+{ 1, 15, 49, 40, },
+{ 1, 17, 41, 31, },
+{ 1, 20, 36, 33, },
+{ 0, 19, 33, 36, },
+{ 1, 15, 30, 31, },
+{ 0, 17, 25, 22, },
+{ 0, 20, 19, 15, },
+{ 0, 20, 19, 14, },
+{ 0, 17, 23, 15, },
+{ 0, 15, 19, 14, },
+{ 0, 15, 15, 14, },
+{ 0, 12, 15, 18, },
+{ 0, 11, 15, 25, },
+{ 0, 12, 23, 43, },
+{ 0, 14, 26, 48, },
+{ 0, 12, 21, 36, },
+{ 0, 11, 18, 27, },
+{ 1, 21, 21, 25, },
+{ 8, 42, 28, 30, },
+{ 16, 34, 25, 29, },
+{ 16, 22, 20, 20, },
+{ 16, 22, 16, 14, },
+{ 17, 21, 14, 15, },
+{ 15, 16, 21, 33, },
+{ 13, 15, 29, 46, },
+{ 13, 16, 26, 37, },
+{ 13, 15, 22, 32, },
+{ 11, 14, 20, 30, },
+{ 8, 12, 24, 34, },
+{ 6, 15, 27, 40, },
+{ 3, 17, 23, 34, },
+{ 2, 16, 18, 28, },
+{ 0, 13, 17, 29, },
+{ 2, 31, 22, 26, },
+{ 12, 52, 27, 33, },
+{ 17, 34, 21, 35, },
+{ 16, 23, 15, 22, },
+{ 17, 20, 12, 17, },
+{ 16, 23, 29, 21, },
+{ 13, 22, 66, 39, },
+{ 12, 20, 67, 47, },
+{ 12, 21, 50, 40, },
+{ 11, 23, 44, 32, },
+{ 10, 23, 37, 31, },
+{ 7, 17, 34, 40, },
+{ 5, 14, 35, 49, },
+{ 3, 12, 29, 41, },
+{ 1, 12, 27, 37, },
+{ 0, 16, 26, 31, },
+{ 4, 40, 34, 32, },
+{ 14, 47, 30, 29, },
+{ 17, 25, 17, 21, },
+{ 16, 22, 13, 14, },
+{ 17, 20, 14, 14, },
+{ 15, 17, 20, 27, },
+{ 14, 15, 26, 44, },
+{ 13, 16, 27, 41, },
+{ 13, 16, 23, 29, },
+{ 12, 14, 21, 27, },
+{ 10, 14, 21, 28, },
+{ 7, 16, 24, 31, },
+{ 4, 12, 25, 32, },
+{ 2, 11, 21, 25, },
+{ 1, 10, 14, 14, },
+{ 0, 11, 14, 16, },
+{ 0, 13, 18, 35, },
+{ 0, 13, 22, 45, },
+{ 0, 11, 20, 37, },
+{ 0, 11, 16, 29, },
+{ 0, 14, 15, 22, },
+{ 5, 40, 25, 24, },
+{ 14, 44, 30, 37, },
+{ 15, 24, 27, 35, },
+{ 15, 15, 23, 31, },
+{ 16, 12, 19, 28, },
+{ 15, 13, 21, 31, },
+{ 14, 16, 24, 41, },
+{ 13, 16, 22, 39, },
+{ 13, 13, 20, 29, },
+{ 12, 15, 18, 19, },
+{ 9, 18, 34, 24, },
+{ 7, 18, 69, 49, },
+{ 4, 17, 68, 55, },
+{ 2, 16, 54, 51, },
+{ 1, 14, 51, 47, },
+{ 1, 13, 44, 46, },
+{ 0, 11, 35, 43, },
+{ 1, 11, 32, 40, },
+{ 1, 11, 29, 39, },
+{ 0, 9, 26, 34, },
+{ 0, 12, 26, 31, },
+{ 0, 13, 28, 31, },
+{ 0, 13, 27, 30, },
+{ 0, 12, 26, 28, },
+{ 0, 10, 25, 27, },
+{ 0, 11, 21, 26, },
+{ 0, 11, 21, 28, },
+{ 0, 13, 25, 40, },
+{ 0, 14, 25, 37, },
+{ 0, 13, 22, 33, },
+{ 0, 14, 18, 29, },
+{ 2, 30, 19, 26, },
+{ 11, 51, 28, 36, },
+{ 16, 32, 30, 39, },
+{ 15, 23, 28, 33, },
+{ 16, 19, 26, 29, },
+{ 16, 18, 24, 26, },
+{ 14, 20, 26, 32, },
+{ 14, 21, 29, 37, },
+{ 13, 22, 26, 28, },
+{ 12, 22, 20, 17, },
+{ 11, 23, 19, 16, },
+{ 8, 23, 28, 27, },
+{ 5, 18, 32, 40, },
+{ 3, 17, 27, 33, },
+{ 1, 15, 23, 20, },
+{ 0, 17, 20, 15, },
+{ 4, 41, 25, 25, },
+{ 14, 51, 26, 34, },
+{ 17, 32, 19, 26, },
+{ 16, 28, 12, 16, },
+{ 17, 25, 10, 11, },
+{ 16, 28, 39, 25, },
+{ 13, 24, 68, 47, },
+{ 11, 22, 61, 48, },
+{ 12, 20, 49, 44, },
+{ 11, 19, 48, 40, },
+{ 9, 17, 41, 41, },
+{ 7, 15, 39, 45, },
+{ 4, 14, 38, 45, },
+{ 3, 16, 29, 36, },
+{ 1, 15, 25, 33, },
+{ 1, 21, 24, 33, },
+{ 7, 46, 31, 31, },
+{ 16, 41, 25, 23, },
+{ 16, 23, 17, 16, },
+{ 16, 21, 13, 11, },
+{ 16, 18, 12, 11, },
+{ 15, 19, 18, 29, },
+{ 14, 17, 25, 53, },
+{ 13, 17, 24, 44, },
+{ 13, 16, 18, 32, },
+{ 12, 16, 15, 27, },
+{ 9, 15, 17, 29, },
+{ 6, 15, 20, 30, },
+{ 4, 13, 20, 31, },
+{ 2, 15, 18, 27, },
+{ 1, 16, 16, 16, },
+{ 0, 15, 17, 20, },
+{ 0, 15, 21, 39, },
+{ 0, 14, 25, 43, },
+{ 0, 12, 22, 34, },
+{ 0, 10, 18, 30, },
+{ 1, 20, 20, 28, },
+{ 8, 45, 29, 38, },
+{ 16, 40, 29, 40, },
+{ 16, 24, 27, 28, },
+{ 17, 20, 23, 20, },
+{ 17, 21, 21, 18, },
+{ 15, 23, 22, 25, },
+{ 14, 22, 24, 37, },
+{ 13, 23, 20, 28, },
+{ 13, 23, 16, 17, },
+{ 11, 21, 16, 15, },
+{ 9, 20, 47, 29, },
+{ 6, 19, 76, 49, },
+{ 3, 18, 64, 49, },
+{ 2, 19, 52, 46, },
+{ 1, 19, 50, 43, },
+{ 1, 18, 42, 41, },
+{ 0, 17, 37, 43, },
+{ 1, 14, 33, 42, },
+{ 1, 13, 26, 36, },
+{ 0, 13, 23, 31, },
+{ 0, 14, 23, 28, },
+{ 0, 17, 31, 32, },
+{ 0, 16, 28, 32, },
+{ 0, 13, 18, 25, },
+{ 0, 11, 13, 20, },
+{ 0, 11, 11, 19, },
+{ 0, 12, 17, 37, },
+{ 0, 14, 25, 50, },
+{ 0, 14, 23, 42, },
+{ 0, 12, 18, 34, },
+{ 0, 13, 20, 29, },
+{ 4, 37, 29, 28, },
+{ 14, 49, 30, 31, },
+{ 17, 28, 25, 29, },
+{ 16, 21, 18, 19, },
+{ 17, 20, 15, 14, },
+{ 16, 20, 16, 23, },
+{ 14, 18, 25, 43, },
+{ 13, 17, 28, 44, },
+{ 13, 17, 22, 28, },
+{ 12, 17, 21, 21, },
+{ 10, 19, 22, 18, },
+{ 7, 22, 26, 25, },
+{ 4, 19, 27, 35, },
+{ 2, 16, 22, 28, },
+{ 1, 17, 18, 19, },
+{ 1, 25, 18, 17, },
+{ 7, 46, 25, 28, },
+{ 16, 38, 24, 37, },
+{ 16, 20, 20, 29, },
+{ 17, 21, 14, 16, },
+{ 17, 22, 16, 13, },
+{ 15, 25, 51, 30, },
+{ 12, 20, 71, 48, },
+{ 12, 22, 57, 48, },
+{ 12, 22, 49, 39, },
+{ 11, 23, 44, 33, },
+{ 9, 20, 37, 32, },
+{ 6, 21, 39, 44, },
+{ 4, 17, 36, 46, },
+{ 2, 17, 28, 34, },
+{ 1, 20, 22, 21, },
+{ 2, 34, 21, 16, },
+{ 10, 58, 28, 16, },
+{ 17, 40, 20, 14, },
+{ 16, 25, 12, 11, },
+{ 17, 18, 14, 10, },
+{ 16, 17, 15, 14, },
+{ 15, 20, 25, 37, },
+{ 14, 21, 27, 47, },
+{ 13, 19, 22, 34, },
+{ 13, 17, 18, 25, },
+{ 11, 17, 15, 23, },
+{ 8, 19, 18, 22, },
+{ 6, 18, 19, 22, },
+{ 3, 15, 21, 23, },
+{ 1, 15, 21, 20, },
+{ 0, 12, 16, 14, },
+{ 0, 11, 19, 27, },
+{ 0, 15, 27, 44, },
+{ 0, 13, 27, 40, },
+{ 0, 10, 22, 30, },
+{ 0, 10, 18, 26, },
+{ 2, 28, 24, 26, },
+{ 11, 51, 30, 33, },
+{ 17, 30, 28, 40, },
+{ 16, 19, 23, 34, },
+{ 17, 18, 21, 25, },
+{ 16, 17, 23, 23, },
+{ 14, 14, 27, 31, },
+{ 14, 11, 26, 36, },
+{ 13, 17, 22, 27, },
+{ 12, 21, 19, 17, },
+{ 11, 20, 21, 15, },
+{ 8, 20, 57, 38, },
+{ 5, 20, 71, 54, },
+{ 3, 14, 57, 54, },
+{ 1, 13, 52, 44, },
+{ 0, 15, 50, 38, },
+{ 1, 16, 41, 33, },
+{ 0, 20, 31, 28, },
+{ 1, 18, 26, 22, },
+{ 0, 20, 22, 17, },
+{ 0, 20, 21, 16, },
+{ 0, 20, 23, 20, },
+{ 0, 23, 22, 25, },
+{ 0, 22, 21, 24, },
+{ 0, 22, 19, 21, },
+{ 0, 23, 17, 21, },
+{ 0, 23, 19, 28, },
+{ 0, 23, 29, 39, },
+{ 0, 17, 32, 43, },
+{ 0, 17, 25, 38, },
+{ 0, 20, 20, 26, },
+{ 1, 22, 19, 19, },
+{ 2, 28, 26, 19, },
+{ 2, 29, 35, 15, },
+{ 2, 28, 45, 14, },
+{ 8, 28, 51, 15, },
+{ 11, 27, 46, 14, },
+{ 12, 26, 37, 13, },
+{ 8, 27, 31, 12, },
+{ 5, 22, 24, 11, },
+{ 4, 13, 16, 10, },
+{ 4, 6, 13, 9, },
+{ 4, 5, 16, 11, },
+{ 4, 7, 24, 16, },
+{ 5, 8, 23, 19, },
+{ 5, 6, 20, 20, },
+{ 4, 5, 18, 19, },
+{ 3, 4, 16, 16, },
+{ 1, 3, 15, 15, },
+{ 0, 2, 15, 13, },
+{ 0, 1, 15, 11, },
+{ 0, 1, 13, 11, },
+{ 0, 1, 13, 12, },
+{ 0, 2, 18, 14, },
+{ 0, 3, 23, 16, },
+{ 0, 3, 21, 17, },
+{ 0, 3, 18, 15, },
+{ 0, 5, 17, 13, },
+{ 0, 5, 13, 9, },
+{ 0, 3, 7, 4, },
+{ 0, 1, 4, 2, },
+{ 0, 0, 3, 1, },
+{ 0, 0, 3, 1, },
+{ 0, 0, 7, 4, },
+{ 0, 0, 12, 8, },
+{ 0, 0, 12, 10, },
+{ 0, 0, 11, 10, },
+{ 0, 0, 11, 9, },
+{ 0, 1, 12, 9, },
+{ 0, 2, 19, 12, },
+{ 0, 3, 25, 15, },
+{ 0, 4, 22, 16, },
+{ 0, 5, 21, 14, },
+{ 0, 4, 18, 9, },
+{ 0, 4, 19, 11, },
+{ 0, 5, 23, 16, },
+{ 0, 5, 22, 14, },
+{ 0, 4, 19, 12, },
+{ 0, 5, 18, 12, },
+{ 0, 4, 23, 13, },
+{ 0, 5, 28, 15, },
+{ 0, 4, 27, 17, },
+{ 0, 3, 22, 17, },
+{ 0, 3, 21, 16, },
+{ 0, 3, 16, 11, },
+{ 0, 2, 8, 5, },
+{ 0, 0, 5, 3, },
+{ 0, 0, 3, 1, },
+{ 0, 0, 2, 1, },
+{ 0, 1, 7, 4, },
+{ 0, 2, 16, 10, },
+{ 0, 3, 19, 14, },
+{ 0, 3, 16, 13, },
+{ 0, 3, 16, 14, },
+{ 0, 2, 15, 13, },
+{ 0, 2, 15, 13, },
+{ 0, 3, 13, 12, },
+{ 0, 3, 7, 5, },
+{ 0, 1, 2, 1, },
+{ 0, 0, 1, 1, },
+{ 0, 0, 1, 1, },
+{ 0, 0, 1, 1, },
+{ 0, 0, 1, 0, },
+{ 0, 0, 1, 0, },
+{ 0, 0, 2, 1, },
+{ 0, 1, 11, 7, },
+{ 0, 3, 21, 15, },
+{ 0, 4, 21, 17, },
+{ 0, 4, 18, 15, },
+{ 0, 4, 19, 15, },
+{ 0, 4, 21, 13, },
+{ 0, 4, 24, 17, },
+{ 0, 4, 27, 24, },
+{ 0, 3, 23, 22, },
+{ 0, 3, 20, 17, },
+{ 0, 4, 18, 16, },
+{ 0, 6, 13, 10, },
+{ 0, 5, 5, 3, },
+{ 0, 1, 2, 1, },
+{ 0, 0, 2, 1, },
+{ 0, 0, 1, 1, },
+{ 0, 0, 1, 1, },
+{ 0, 0, 1, 0, },
+{ 0, 0, 1, 0, },
+{ 0, 0, 1, 0, },
+{ 0, 0, 0, 0, },
+{ 0, 0, 0, 0, },
+{ 0, 0, 0, 0, },
+{ 0, 0, 0, 0, },
+{ 0, 0, 0, 0, },
+{ 0, 0, 0, 0, },
+{ 0, 0, 0, 0, },
+{ 0, 0, 0, 0, },
+{ 0, 0, 0, 0, },
+{ 0, 0, 0, 0, },
+{ 0, 0, 0, 0, },
+{ 0, 0, 0, 0, },
+{ 0, 0, 0, 0, },
+{ 0, 0, 0, 0, },
+};
@@ -0,0 +1,782 @@
+const uint16_t spectrum_2[][4] = {
+{ 0, 0, 0, 0, },
+{ 0, 8, 28, 14, },
+{ 1, 35, 63, 31, },
+{ 5, 62, 56, 35, },
+{ 13, 49, 42, 30, },
+{ 21, 24, 45, 31, },
+{ 22, 15, 46, 37, },
+{ 20, 9, 48, 35, },
+{ 17, 12, 50, 33, },
+{ 6, 11, 49, 35, },
+{ 0, 10, 50, 40, },
+{ 0, 11, 50, 37, },
+{ 0, 14, 51, 37, },
+{ 0, 18, 47, 33, },
+{ 0, 16, 41, 27, },
+{ 0, 13, 40, 24, },
+{ 0, 10, 36, 23, },
+{ 0, 7, 32, 25, },
+{ 0, 7, 33, 25, },
+{ 0, 7, 33, 29, },
+{ 0, 8, 31, 33, },
+{ 0, 8, 32, 32, },
+{ 0, 9, 33, 31, },
+{ 0, 11, 37, 31, },
+{ 0, 13, 39, 33, },
+{ 0, 16, 48, 47, },
+{ 0, 11, 57, 45, },
+{ 0, 7, 50, 36, },
+{ 0, 5, 38, 29, },
+{ 0, 5, 32, 30, },
+{ 0, 4, 25, 26, },
+{ 0, 5, 18, 17, },
+{ 0, 5, 14, 12, },
+{ 0, 6, 19, 17, },
+{ 0, 5, 26, 22, },
+{ 0, 16, 43, 27, },
+{ 1, 46, 64, 31, },
+{ 5, 60, 40, 24, },
+{ 17, 42, 22, 16, },
+{ 28, 23, 15, 9, },
+{ 29, 16, 15, 10, },
+{ 25, 12, 25, 20, },
+{ 16, 14, 34, 24, },
+{ 11, 13, 34, 24, },
+{ 10, 11, 31, 26, },
+{ 10, 15, 29, 23, },
+{ 10, 15, 23, 13, },
+{ 10, 15, 20, 7, },
+{ 11, 15, 28, 12, },
+{ 11, 13, 35, 20, },
+{ 10, 14, 39, 23, },
+{ 10, 14, 40, 28, },
+{ 10, 14, 36, 29, },
+{ 11, 13, 29, 21, },
+{ 10, 13, 27, 15, },
+{ 10, 15, 29, 17, },
+{ 11, 16, 32, 26, },
+{ 10, 15, 35, 27, },
+{ 11, 29, 60, 30, },
+{ 8, 56, 56, 27, },
+{ 11, 54, 25, 17, },
+{ 23, 28, 20, 13, },
+{ 29, 16, 19, 11, },
+{ 27, 12, 19, 17, },
+{ 22, 14, 28, 24, },
+{ 11, 15, 34, 25, },
+{ 11, 11, 37, 26, },
+{ 11, 12, 35, 26, },
+{ 11, 13, 26, 19, },
+{ 11, 17, 23, 16, },
+{ 10, 26, 39, 39, },
+{ 3, 20, 43, 48, },
+{ 1, 14, 43, 38, },
+{ 0, 12, 40, 31, },
+{ 0, 9, 40, 31, },
+{ 0, 8, 37, 30, },
+{ 0, 8, 32, 30, },
+{ 0, 5, 28, 33, },
+{ 0, 4, 25, 28, },
+{ 0, 6, 28, 21, },
+{ 0, 6, 33, 19, },
+{ 0, 5, 33, 21, },
+{ 0, 4, 36, 25, },
+{ 0, 4, 39, 34, },
+{ 0, 4, 40, 35, },
+{ 0, 4, 41, 31, },
+{ 0, 4, 40, 28, },
+{ 0, 4, 41, 26, },
+{ 0, 4, 38, 33, },
+{ 0, 3, 34, 31, },
+{ 0, 4, 26, 21, },
+{ 0, 10, 31, 18, },
+{ 1, 41, 65, 22, },
+{ 4, 67, 46, 14, },
+{ 15, 55, 18, 6, },
+{ 28, 26, 16, 5, },
+{ 31, 14, 16, 6, },
+{ 29, 9, 16, 6, },
+{ 22, 16, 19, 6, },
+{ 12, 15, 22, 7, },
+{ 12, 13, 22, 7, },
+{ 11, 13, 20, 6, },
+{ 11, 14, 22, 7, },
+{ 11, 18, 28, 20, },
+{ 11, 23, 26, 21, },
+{ 11, 18, 19, 9, },
+{ 11, 15, 18, 5, },
+{ 11, 14, 17, 4, },
+{ 11, 16, 16, 9, },
+{ 11, 18, 21, 21, },
+{ 11, 21, 20, 16, },
+{ 11, 17, 17, 6, },
+{ 11, 16, 17, 4, },
+{ 11, 16, 17, 4, },
+{ 12, 18, 22, 17, },
+{ 11, 21, 44, 44, },
+{ 5, 14, 56, 52, },
+{ 1, 11, 57, 41, },
+{ 0, 9, 39, 29, },
+{ 0, 8, 35, 25, },
+{ 0, 9, 37, 22, },
+{ 0, 12, 34, 21, },
+{ 0, 9, 27, 21, },
+{ 0, 5, 19, 17, },
+{ 0, 4, 16, 14, },
+{ 0, 18, 38, 17, },
+{ 2, 52, 67, 22, },
+{ 5, 66, 38, 17, },
+{ 17, 43, 25, 18, },
+{ 26, 18, 25, 18, },
+{ 26, 11, 21, 18, },
+{ 24, 10, 24, 18, },
+{ 15, 16, 28, 21, },
+{ 12, 14, 27, 22, },
+{ 11, 13, 25, 20, },
+{ 11, 15, 24, 15, },
+{ 11, 16, 20, 12, },
+{ 11, 16, 24, 10, },
+{ 11, 18, 40, 15, },
+{ 11, 14, 38, 19, },
+{ 11, 14, 35, 23, },
+{ 11, 13, 32, 28, },
+{ 12, 13, 29, 19, },
+{ 11, 14, 27, 18, },
+{ 11, 15, 32, 26, },
+{ 11, 14, 39, 27, },
+{ 11, 15, 38, 29, },
+{ 12, 19, 39, 24, },
+{ 12, 34, 68, 25, },
+{ 9, 63, 59, 25, },
+{ 12, 57, 30, 22, },
+{ 21, 27, 26, 19, },
+{ 24, 16, 23, 21, },
+{ 24, 17, 18, 16, },
+{ 23, 19, 17, 12, },
+{ 11, 22, 28, 21, },
+{ 3, 22, 34, 26, },
+{ 2, 21, 36, 28, },
+{ 2, 24, 32, 24, },
+{ 3, 39, 56, 25, },
+{ 4, 58, 71, 39, },
+{ 9, 50, 41, 36, },
+{ 17, 29, 30, 28, },
+{ 22, 20, 30, 22, },
+{ 22, 14, 32, 23, },
+{ 21, 13, 30, 23, },
+{ 10, 22, 38, 26, },
+{ 6, 47, 60, 31, },
+{ 6, 64, 43, 23, },
+{ 15, 48, 18, 12, },
+{ 24, 24, 16, 9, },
+{ 26, 15, 24, 13, },
+{ 22, 13, 33, 21, },
+{ 20, 15, 36, 30, },
+{ 8, 29, 57, 33, },
+{ 4, 57, 61, 27, },
+{ 10, 54, 37, 21, },
+{ 17, 29, 32, 22, },
+{ 21, 16, 31, 26, },
+{ 23, 11, 28, 26, },
+{ 20, 13, 27, 19, },
+{ 12, 21, 36, 19, },
+{ 7, 48, 72, 31, },
+{ 5, 68, 59, 32, },
+{ 13, 51, 38, 31, },
+{ 24, 24, 32, 29, },
+{ 26, 16, 34, 28, },
+{ 22, 10, 36, 26, },
+{ 17, 15, 38, 27, },
+{ 10, 14, 40, 28, },
+{ 10, 10, 40, 32, },
+{ 10, 12, 42, 35, },
+{ 10, 13, 46, 34, },
+{ 10, 15, 48, 31, },
+{ 10, 17, 40, 26, },
+{ 10, 17, 34, 24, },
+{ 10, 14, 32, 24, },
+{ 10, 13, 30, 22, },
+{ 10, 13, 30, 23, },
+{ 10, 14, 30, 21, },
+{ 10, 15, 29, 22, },
+{ 10, 14, 28, 22, },
+{ 10, 15, 30, 25, },
+{ 10, 17, 34, 28, },
+{ 11, 20, 36, 33, },
+{ 10, 21, 48, 49, },
+{ 4, 14, 63, 54, },
+{ 1, 11, 53, 41, },
+{ 0, 10, 38, 25, },
+{ 0, 9, 31, 18, },
+{ 0, 10, 24, 20, },
+{ 0, 12, 18, 16, },
+{ 0, 8, 15, 11, },
+{ 0, 5, 21, 14, },
+{ 0, 5, 28, 15, },
+{ 0, 15, 44, 18, },
+{ 2, 46, 60, 23, },
+{ 5, 61, 36, 15, },
+{ 16, 42, 21, 11, },
+{ 28, 21, 15, 7, },
+{ 30, 15, 14, 7, },
+{ 25, 13, 19, 12, },
+{ 16, 14, 23, 12, },
+{ 11, 12, 31, 13, },
+{ 11, 10, 31, 13, },
+{ 10, 13, 25, 14, },
+{ 11, 17, 22, 10, },
+{ 10, 16, 18, 7, },
+{ 11, 15, 17, 10, },
+{ 11, 14, 20, 11, },
+{ 11, 13, 25, 15, },
+{ 11, 14, 34, 17, },
+{ 10, 14, 33, 15, },
+{ 10, 14, 32, 15, },
+{ 10, 13, 35, 14, },
+{ 10, 13, 34, 14, },
+{ 10, 14, 31, 14, },
+{ 10, 14, 34, 15, },
+{ 10, 32, 63, 21, },
+{ 8, 62, 58, 17, },
+{ 11, 57, 39, 11, },
+{ 23, 27, 32, 11, },
+{ 26, 15, 25, 11, },
+{ 26, 12, 18, 11, },
+{ 22, 14, 18, 10, },
+{ 10, 15, 29, 13, },
+{ 10, 14, 33, 13, },
+{ 10, 13, 31, 14, },
+{ 10, 15, 27, 13, },
+{ 11, 19, 26, 17, },
+{ 9, 25, 44, 39, },
+{ 3, 19, 44, 46, },
+{ 0, 14, 37, 36, },
+{ 0, 11, 30, 23, },
+{ 0, 9, 29, 19, },
+{ 0, 8, 28, 17, },
+{ 0, 8, 24, 16, },
+{ 0, 5, 20, 17, },
+{ 0, 4, 21, 17, },
+{ 0, 3, 18, 13, },
+{ 0, 16, 33, 15, },
+{ 1, 47, 59, 23, },
+{ 7, 60, 40, 19, },
+{ 17, 40, 32, 15, },
+{ 22, 21, 31, 12, },
+{ 23, 13, 33, 13, },
+{ 21, 13, 32, 12, },
+{ 14, 20, 36, 14, },
+{ 4, 20, 34, 16, },
+{ 0, 21, 32, 17, },
+{ 0, 23, 27, 14, },
+{ 0, 29, 35, 13, },
+{ 1, 56, 66, 23, },
+{ 4, 71, 47, 15, },
+{ 15, 55, 19, 4, },
+{ 27, 26, 14, 3, },
+{ 30, 15, 13, 3, },
+{ 28, 8, 12, 4, },
+{ 21, 14, 16, 8, },
+{ 12, 14, 17, 7, },
+{ 11, 12, 17, 4, },
+{ 11, 13, 17, 3, },
+{ 11, 13, 17, 3, },
+{ 10, 13, 17, 7, },
+{ 10, 13, 22, 18, },
+{ 10, 14, 36, 23, },
+{ 11, 12, 43, 22, },
+{ 11, 12, 36, 21, },
+{ 11, 13, 37, 20, },
+{ 11, 14, 39, 19, },
+{ 10, 16, 32, 18, },
+{ 11, 15, 25, 17, },
+{ 11, 15, 21, 13, },
+{ 11, 13, 21, 11, },
+{ 11, 15, 24, 18, },
+{ 10, 21, 47, 44, },
+{ 4, 15, 55, 50, },
+{ 0, 12, 44, 38, },
+{ 0, 11, 36, 30, },
+{ 0, 12, 26, 24, },
+{ 0, 11, 22, 17, },
+{ 0, 10, 25, 24, },
+{ 0, 6, 34, 28, },
+{ 0, 3, 35, 25, },
+{ 0, 4, 27, 23, },
+{ 0, 16, 36, 18, },
+{ 2, 49, 60, 19, },
+{ 5, 65, 36, 16, },
+{ 16, 42, 23, 24, },
+{ 25, 19, 23, 24, },
+{ 25, 11, 24, 19, },
+{ 22, 8, 29, 22, },
+{ 15, 15, 34, 26, },
+{ 11, 13, 36, 27, },
+{ 10, 14, 32, 23, },
+{ 10, 16, 28, 17, },
+{ 10, 16, 30, 15, },
+{ 11, 21, 43, 30, },
+{ 7, 22, 43, 44, },
+{ 1, 13, 20, 40, },
+{ 0, 10, 13, 33, },
+{ 0, 9, 18, 32, },
+{ 0, 9, 27, 43, },
+{ 0, 9, 36, 49, },
+{ 0, 6, 36, 35, },
+{ 0, 2, 29, 28, },
+{ 0, 1, 26, 26, },
+{ 0, 1, 26, 27, },
+{ 0, 1, 34, 28, },
+{ 0, 1, 39, 35, },
+{ 0, 1, 33, 35, },
+{ 0, 2, 26, 34, },
+{ 0, 2, 23, 32, },
+{ 0, 2, 25, 28, },
+{ 0, 2, 32, 37, },
+{ 0, 2, 38, 45, },
+{ 0, 2, 26, 41, },
+{ 0, 2, 14, 28, },
+{ 0, 2, 14, 26, },
+{ 0, 8, 33, 35, },
+{ 0, 16, 54, 51, },
+{ 0, 16, 52, 52, },
+{ 0, 15, 52, 43, },
+{ 0, 14, 40, 28, },
+{ 0, 13, 38, 27, },
+{ 0, 14, 36, 26, },
+{ 0, 18, 38, 24, },
+{ 0, 15, 38, 24, },
+{ 0, 13, 34, 27, },
+{ 0, 13, 33, 27, },
+{ 0, 13, 35, 27, },
+{ 0, 14, 43, 35, },
+{ 0, 14, 59, 45, },
+{ 0, 10, 61, 39, },
+{ 0, 9, 59, 34, },
+{ 0, 11, 54, 37, },
+{ 0, 15, 51, 39, },
+{ 0, 15, 57, 37, },
+{ 0, 12, 68, 37, },
+{ 0, 9, 72, 43, },
+{ 0, 10, 66, 45, },
+{ 0, 13, 57, 47, },
+{ 1, 39, 78, 49, },
+{ 5, 63, 63, 37, },
+{ 14, 48, 45, 33, },
+{ 21, 23, 45, 36, },
+{ 23, 15, 49, 39, },
+{ 21, 10, 51, 39, },
+{ 16, 13, 52, 38, },
+{ 6, 12, 62, 38, },
+{ 0, 10, 68, 45, },
+{ 0, 12, 70, 46, },
+{ 0, 18, 74, 45, },
+{ 0, 21, 70, 42, },
+{ 0, 18, 51, 33, },
+{ 0, 15, 45, 29, },
+{ 0, 12, 45, 30, },
+{ 0, 9, 47, 30, },
+{ 0, 9, 45, 28, },
+{ 0, 11, 40, 31, },
+{ 1, 11, 38, 39, },
+{ 0, 11, 39, 46, },
+{ 0, 12, 41, 42, },
+{ 1, 14, 46, 36, },
+{ 0, 16, 47, 38, },
+{ 0, 16, 53, 55, },
+{ 0, 10, 58, 54, },
+{ 0, 9, 50, 37, },
+{ 0, 7, 42, 28, },
+{ 0, 5, 37, 30, },
+{ 0, 5, 27, 27, },
+{ 0, 6, 19, 18, },
+{ 0, 7, 15, 13, },
+{ 0, 8, 21, 17, },
+{ 0, 6, 29, 23, },
+{ 0, 16, 44, 27, },
+{ 2, 46, 63, 29, },
+{ 5, 60, 40, 24, },
+{ 17, 43, 21, 16, },
+{ 28, 22, 16, 9, },
+{ 30, 15, 14, 11, },
+{ 26, 13, 24, 21, },
+{ 16, 16, 35, 25, },
+{ 11, 14, 38, 25, },
+{ 12, 12, 35, 27, },
+{ 11, 15, 32, 24, },
+{ 11, 16, 24, 13, },
+{ 11, 16, 22, 9, },
+{ 12, 15, 31, 16, },
+{ 11, 15, 42, 23, },
+{ 11, 14, 51, 26, },
+{ 11, 14, 57, 31, },
+{ 10, 14, 55, 32, },
+{ 11, 13, 49, 24, },
+{ 11, 14, 46, 21, },
+{ 11, 15, 51, 23, },
+{ 10, 15, 53, 29, },
+{ 10, 14, 51, 28, },
+{ 10, 26, 65, 31, },
+{ 8, 54, 54, 28, },
+{ 11, 53, 28, 20, },
+{ 24, 28, 27, 15, },
+{ 30, 15, 29, 13, },
+{ 27, 11, 29, 18, },
+{ 22, 13, 35, 24, },
+{ 11, 14, 41, 27, },
+{ 11, 11, 43, 26, },
+{ 10, 11, 38, 25, },
+{ 11, 13, 29, 19, },
+{ 11, 17, 26, 18, },
+{ 10, 26, 42, 46, },
+{ 4, 20, 44, 56, },
+{ 0, 15, 43, 41, },
+{ 0, 12, 43, 31, },
+{ 0, 9, 41, 32, },
+{ 0, 8, 39, 30, },
+{ 0, 9, 35, 31, },
+{ 0, 5, 30, 32, },
+{ 0, 4, 24, 29, },
+{ 0, 6, 27, 21, },
+{ 0, 6, 31, 19, },
+{ 0, 5, 33, 20, },
+{ 0, 4, 36, 24, },
+{ 0, 5, 38, 32, },
+{ 0, 4, 41, 37, },
+{ 0, 4, 39, 32, },
+{ 0, 4, 40, 28, },
+{ 0, 3, 40, 29, },
+{ 0, 3, 38, 34, },
+{ 0, 3, 34, 32, },
+{ 0, 4, 27, 22, },
+{ 0, 10, 31, 19, },
+{ 1, 40, 63, 28, },
+{ 4, 65, 47, 19, },
+{ 14, 53, 26, 11, },
+{ 26, 23, 37, 16, },
+{ 28, 14, 35, 15, },
+{ 26, 12, 31, 13, },
+{ 20, 15, 44, 17, },
+{ 12, 16, 41, 15, },
+{ 12, 15, 43, 20, },
+{ 11, 14, 52, 25, },
+{ 11, 17, 46, 18, },
+{ 11, 16, 44, 17, },
+{ 11, 13, 51, 21, },
+{ 11, 14, 41, 18, },
+{ 11, 18, 31, 12, },
+{ 12, 20, 27, 12, },
+{ 11, 19, 25, 13, },
+{ 12, 16, 41, 18, },
+{ 12, 15, 48, 19, },
+{ 11, 17, 37, 15, },
+{ 11, 19, 26, 10, },
+{ 11, 19, 22, 9, },
+{ 12, 19, 24, 18, },
+{ 11, 22, 43, 43, },
+{ 5, 15, 55, 50, },
+{ 0, 12, 58, 37, },
+{ 0, 10, 44, 29, },
+{ 0, 9, 37, 25, },
+{ 0, 9, 38, 24, },
+{ 0, 12, 34, 22, },
+{ 0, 9, 26, 21, },
+{ 0, 5, 19, 18, },
+{ 0, 4, 15, 13, },
+{ 0, 18, 37, 17, },
+{ 2, 52, 65, 23, },
+{ 5, 67, 36, 18, },
+{ 17, 42, 22, 17, },
+{ 26, 20, 23, 15, },
+{ 26, 12, 21, 15, },
+{ 24, 11, 23, 17, },
+{ 16, 16, 29, 19, },
+{ 12, 14, 29, 23, },
+{ 11, 13, 26, 20, },
+{ 11, 15, 25, 13, },
+{ 11, 16, 21, 11, },
+{ 11, 16, 22, 10, },
+{ 10, 16, 39, 15, },
+{ 11, 14, 40, 19, },
+{ 10, 14, 41, 25, },
+{ 10, 13, 42, 29, },
+{ 11, 12, 44, 24, },
+{ 11, 13, 43, 25, },
+{ 10, 15, 47, 31, },
+{ 10, 14, 55, 29, },
+{ 9, 15, 56, 26, },
+{ 10, 18, 50, 27, },
+{ 11, 33, 71, 28, },
+{ 9, 62, 57, 25, },
+{ 11, 56, 32, 24, },
+{ 20, 28, 31, 23, },
+{ 24, 16, 32, 22, },
+{ 23, 15, 28, 15, },
+{ 21, 18, 24, 14, },
+{ 10, 21, 33, 24, },
+{ 3, 20, 38, 27, },
+{ 2, 21, 37, 26, },
+{ 3, 24, 32, 23, },
+{ 3, 37, 53, 24, },
+{ 4, 55, 69, 39, },
+{ 8, 49, 41, 40, },
+{ 18, 29, 33, 29, },
+{ 15, 18, 37, 23, },
+{ 5, 12, 43, 26, },
+{ 3, 14, 45, 27, },
+{ 4, 15, 47, 28, },
+{ 4, 16, 44, 31, },
+{ 4, 18, 42, 27, },
+{ 5, 19, 37, 18, },
+{ 5, 28, 51, 21, },
+{ 4, 56, 69, 28, },
+{ 6, 65, 41, 19, },
+{ 18, 40, 30, 22, },
+{ 20, 31, 55, 30, },
+{ 9, 55, 64, 28, },
+{ 10, 52, 39, 21, },
+{ 18, 29, 36, 23, },
+{ 14, 38, 59, 30, },
+{ 7, 60, 56, 26, },
+{ 12, 51, 29, 17, },
+{ 20, 29, 30, 18, },
+{ 17, 41, 64, 29, },
+{ 6, 63, 54, 31, },
+{ 13, 49, 38, 31, },
+{ 23, 24, 36, 30, },
+{ 24, 16, 40, 30, },
+{ 22, 10, 42, 27, },
+{ 18, 15, 46, 27, },
+{ 10, 13, 48, 30, },
+{ 10, 11, 47, 34, },
+{ 10, 12, 51, 36, },
+{ 10, 13, 57, 35, },
+{ 9, 14, 56, 31, },
+{ 9, 16, 42, 27, },
+{ 10, 17, 34, 24, },
+{ 9, 14, 34, 23, },
+{ 9, 13, 35, 23, },
+{ 10, 13, 35, 23, },
+{ 10, 13, 34, 23, },
+{ 10, 13, 32, 21, },
+{ 10, 14, 30, 22, },
+{ 10, 15, 33, 25, },
+{ 10, 18, 36, 27, },
+{ 10, 20, 36, 31, },
+{ 9, 21, 49, 50, },
+{ 4, 13, 60, 51, },
+{ 0, 10, 50, 35, },
+{ 0, 10, 38, 23, },
+{ 0, 9, 33, 21, },
+{ 0, 10, 25, 20, },
+{ 0, 12, 20, 17, },
+{ 0, 8, 16, 13, },
+{ 0, 5, 19, 13, },
+{ 0, 5, 28, 14, },
+{ 0, 15, 46, 18, },
+{ 2, 44, 61, 23, },
+{ 5, 59, 36, 15, },
+{ 17, 42, 19, 11, },
+{ 27, 21, 13, 8, },
+{ 28, 15, 14, 8, },
+{ 24, 12, 20, 12, },
+{ 15, 14, 23, 13, },
+{ 10, 12, 31, 13, },
+{ 10, 11, 31, 13, },
+{ 11, 13, 25, 13, },
+{ 10, 17, 21, 10, },
+{ 10, 16, 18, 7, },
+{ 10, 14, 19, 10, },
+{ 10, 13, 27, 12, },
+{ 10, 13, 34, 17, },
+{ 10, 14, 44, 19, },
+{ 10, 13, 47, 21, },
+{ 10, 13, 46, 20, },
+{ 11, 12, 50, 18, },
+{ 10, 12, 52, 18, },
+{ 10, 13, 51, 19, },
+{ 10, 13, 48, 19, },
+{ 10, 30, 67, 22, },
+{ 8, 59, 58, 18, },
+{ 10, 54, 40, 13, },
+{ 22, 27, 32, 13, },
+{ 25, 14, 29, 13, },
+{ 24, 11, 26, 13, },
+{ 21, 13, 25, 13, },
+{ 11, 14, 34, 16, },
+{ 10, 12, 36, 16, },
+{ 10, 12, 34, 15, },
+{ 10, 16, 29, 14, },
+{ 10, 19, 27, 19, },
+{ 9, 25, 45, 42, },
+{ 3, 19, 46, 48, },
+{ 1, 12, 37, 35, },
+{ 0, 11, 29, 23, },
+{ 0, 9, 29, 20, },
+{ 0, 9, 27, 18, },
+{ 0, 9, 23, 17, },
+{ 0, 5, 20, 20, },
+{ 0, 4, 20, 18, },
+{ 0, 4, 18, 14, },
+{ 0, 15, 32, 16, },
+{ 1, 46, 57, 24, },
+{ 7, 56, 42, 17, },
+{ 15, 37, 32, 13, },
+{ 21, 21, 31, 12, },
+{ 21, 14, 36, 12, },
+{ 21, 13, 34, 14, },
+{ 14, 19, 37, 17, },
+{ 3, 20, 36, 18, },
+{ 0, 22, 35, 17, },
+{ 0, 23, 30, 15, },
+{ 0, 28, 34, 14, },
+{ 1, 53, 64, 30, },
+{ 3, 67, 56, 32, },
+{ 13, 49, 42, 30, },
+{ 23, 22, 42, 28, },
+{ 26, 12, 40, 25, },
+{ 24, 8, 44, 25, },
+{ 19, 13, 47, 27, },
+{ 11, 13, 42, 20, },
+{ 11, 10, 40, 18, },
+{ 10, 12, 41, 18, },
+{ 10, 12, 44, 16, },
+{ 10, 11, 36, 16, },
+{ 10, 12, 33, 19, },
+{ 10, 13, 44, 24, },
+{ 10, 13, 48, 23, },
+{ 9, 12, 44, 24, },
+{ 9, 12, 43, 28, },
+{ 10, 15, 45, 25, },
+{ 11, 17, 40, 24, },
+{ 10, 15, 35, 31, },
+{ 11, 14, 34, 32, },
+{ 10, 12, 37, 25, },
+{ 11, 14, 37, 23, },
+{ 10, 19, 52, 44, },
+{ 4, 13, 63, 48, },
+{ 0, 11, 52, 35, },
+{ 0, 10, 42, 26, },
+{ 0, 13, 36, 24, },
+{ 0, 12, 28, 20, },
+{ 0, 10, 34, 21, },
+{ 0, 6, 39, 21, },
+{ 0, 2, 35, 21, },
+{ 0, 5, 33, 20, },
+{ 0, 17, 41, 21, },
+{ 2, 47, 60, 20, },
+{ 5, 62, 37, 14, },
+{ 16, 41, 23, 17, },
+{ 24, 20, 26, 17, },
+{ 25, 11, 29, 15, },
+{ 23, 9, 28, 16, },
+{ 16, 13, 27, 19, },
+{ 12, 11, 30, 20, },
+{ 10, 12, 33, 19, },
+{ 11, 13, 33, 19, },
+{ 11, 15, 32, 20, },
+{ 10, 15, 30, 22, },
+{ 10, 19, 37, 25, },
+{ 10, 24, 57, 24, },
+{ 10, 19, 54, 23, },
+{ 9, 17, 54, 20, },
+{ 10, 13, 55, 24, },
+{ 9, 15, 55, 28, },
+{ 10, 19, 65, 28, },
+{ 9, 19, 69, 27, },
+{ 10, 17, 56, 26, },
+{ 10, 19, 52, 23, },
+{ 10, 32, 71, 24, },
+{ 9, 57, 65, 20, },
+{ 12, 50, 48, 17, },
+{ 18, 23, 44, 17, },
+{ 21, 15, 39, 18, },
+{ 20, 13, 37, 19, },
+{ 17, 13, 40, 19, },
+{ 8, 11, 45, 19, },
+{ 0, 8, 46, 22, },
+{ 0, 8, 44, 22, },
+{ 0, 5, 42, 20, },
+{ 0, 8, 40, 27, },
+{ 0, 13, 50, 45, },
+{ 0, 14, 54, 50, },
+{ 0, 12, 55, 40, },
+{ 0, 13, 57, 32, },
+{ 0, 14, 53, 31, },
+{ 0, 35, 71, 33, },
+{ 4, 59, 62, 26, },
+{ 12, 46, 39, 22, },
+{ 19, 22, 38, 22, },
+{ 22, 16, 37, 22, },
+{ 21, 14, 37, 21, },
+{ 17, 17, 34, 19, },
+{ 7, 17, 38, 26, },
+{ 0, 11, 50, 33, },
+{ 0, 8, 55, 36, },
+{ 0, 9, 54, 35, },
+{ 0, 11, 50, 32, },
+{ 0, 13, 54, 32, },
+{ 0, 11, 62, 37, },
+{ 0, 10, 58, 33, },
+{ 0, 11, 53, 30, },
+{ 0, 13, 44, 31, },
+{ 0, 34, 42, 34, },
+{ 2, 47, 33, 24, },
+{ 5, 34, 30, 16, },
+{ 5, 22, 32, 15, },
+{ 7, 19, 33, 15, },
+{ 6, 19, 31, 15, },
+{ 3, 17, 36, 14, },
+{ 2, 14, 35, 15, },
+{ 3, 14, 35, 15, },
+{ 3, 13, 35, 15, },
+{ 2, 13, 35, 18, },
+{ 1, 12, 35, 17, },
+{ 2, 13, 28, 13, },
+{ 1, 11, 27, 13, },
+{ 2, 8, 29, 14, },
+{ 1, 9, 28, 14, },
+{ 3, 11, 24, 15, },
+{ 3, 10, 22, 14, },
+{ 2, 10, 21, 12, },
+{ 1, 10, 23, 11, },
+{ 1, 11, 22, 12, },
+{ 1, 9, 19, 11, },
+{ 1, 9, 20, 10, },
+{ 1, 9, 19, 10, },
+{ 2, 11, 18, 9, },
+{ 2, 10, 18, 10, },
+{ 0, 9, 18, 9, },
+{ 0, 10, 19, 9, },
+{ 0, 13, 19, 8, },
+{ 0, 12, 21, 9, },
+{ 1, 8, 20, 9, },
+{ 1, 7, 17, 9, },
+{ 1, 9, 16, 8, },
+{ 1, 9, 15, 8, },
+{ 1, 9, 15, 7, },
+{ 0, 7, 15, 6, },
+{ 0, 9, 15, 7, },
+{ 1, 8, 12, 6, },
+{ 0, 6, 11, 5, },
+{ 0, 6, 12, 5, },
+{ 0, 6, 12, 5, },
+{ 0, 5, 13, 4, },
+{ 0, 3, 12, 4, },
+{ 0, 3, 10, 3, },
+{ 0, 3, 8, 3, },
+{ 0, 3, 8, 3, },
+{ 0, 3, 7, 3, },
+{ 0, 3, 7, 2, },
+{ 0, 2, 5, 2, },
+{ 0, 2, 4, 2, },
+{ 0, 1, 4, 1, },
+{ 0, 1, 4, 1, },
+{ 0, 1, 3, 1, },
+{ 0, 0, 2, 1, },
+{ 0, 0, 1, 0, },
+{ 0, 0, 1, 0, },
+{ 0, 0, 0, 0, },
+{ 0, 0, 0, 0, },
+};
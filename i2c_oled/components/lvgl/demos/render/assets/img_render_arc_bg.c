@@ -0,0 +1,122 @@
+#include "../../../lvgl.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_IMG_RENDER_ARC_BG
+    #define LV_ATTRIBUTE_IMAGE_IMG_RENDER_ARC_BG
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_RENDER_ARC_BG uint8_t
+img_render_arc_bg_map[] = {
+    0x00, 0xc0, 0xff, 0xff, 0x01, 0xc0, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xcb, 0xff, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xce, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x00, 0xd4, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xd9, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x00, 0xde, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xe1, 0xff, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x00, 0xe4, 0xff, 0xff, 0x00, 0xe4, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x00, 0xea, 0xff, 0xff, 0x00, 0xec, 0xff, 0xff, 0x00, 0xed, 0xff, 0xff, 0x00, 0xee, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf1, 0xff, 0xff, 0x00, 0xf3, 0xff, 0xff, 0x00, 0xf4, 0xff, 0xff, 0x00, 0xf6, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x00, 0xfa, 0xff, 0xff, 0x00, 0xfb, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfc, 0xff, 0x00, 0xff, 0xfb, 0xff, 0x00, 0xff, 0xfa, 0xff, 0x00, 0xff, 0xf8, 0xff, 0x00, 0xff, 0xf6, 0xff, 0x00, 0xff, 0xf4, 0xff, 0x00, 0xff, 0xf3, 0xff, 0x00, 0xff, 0xf1, 0xff, 0x00, 0xff, 0xef, 0xff, 0x00, 0xff, 0xef, 0xff, 0x00, 0xff, 0xec, 0xff, 0x00, 0xff, 0xeb, 0xff, 0x00, 0xff, 0xea, 0xff, 0x00, 0xff, 0xe8, 0xff, 0x00, 0xff, 0xe7, 0xff, 0x00, 0xff, 0xe5, 0xff, 0x00, 0xff, 0xe3, 0xff, 0x00, 0xff, 0xe3, 0xff, 0x00, 0xff, 0xe1, 0xff, 0x00, 0xff, 0xe0, 0xff, 0x00, 0xff, 0xde, 0xff, 0x00, 0xff, 0xdd, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x00, 0xff, 0xda, 0xff, 0x00, 0xff, 0xd9, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd7, 0xff, 0x00, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xd4, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xd1, 0xff, 0x00, 0xff, 0xd0, 0xff, 0x00, 0xff, 0xcf, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xcb, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xc0, 0xff,
+    0x00, 0xbf, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcb, 0xff, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xce, 0xff, 0xff, 0x00, 0xce, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xd7, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xd9, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x00, 0xde, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xe1, 0xff, 0xff, 0x00, 0xe4, 0xff, 0xff, 0x00, 0xe4, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x00, 0xe9, 0xff, 0xff, 0x00, 0xeb, 0xff, 0xff, 0x00, 0xec, 0xff, 0xff, 0x00, 0xee, 0xff, 0xff, 0x00, 0xef, 0xff, 0xff, 0x00, 0xf1, 0xff, 0xff, 0x00, 0xf2, 0xff, 0xff, 0x01, 0xf4, 0xff, 0xff, 0x01, 0xf6, 0xff, 0xff, 0x00, 0xf7, 0xff, 0xff, 0x00, 0xf9, 0xff, 0xff, 0x00, 0xfb, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfd, 0xff, 0x00, 0xff, 0xfb, 0xff, 0x00, 0xff, 0xf8, 0xff, 0x00, 0xff, 0xf8, 0xff, 0x00, 0xff, 0xf6, 0xff, 0x00, 0xff, 0xf5, 0xff, 0x00, 0xff, 0xf3, 0xff, 0x00, 0xff, 0xf1, 0xff, 0x00, 0xff, 0xef, 0xff, 0x00, 0xfe, 0xee, 0xff, 0x00, 0xff, 0xed, 0xff, 0x00, 0xff, 0xeb, 0xff, 0x00, 0xff, 0xe9, 0xff, 0x00, 0xff, 0xe7, 0xff, 0x00, 0xff, 0xe6, 0xff, 0x00, 0xff, 0xe4, 0xff, 0x00, 0xff, 0xe3, 0xff, 0x00, 0xff, 0xe2, 0xff, 0x00, 0xff, 0xe1, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x00, 0xff, 0xde, 0xff, 0x00, 0xff, 0xdc, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x00, 0xff, 0xd9, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd7, 0xff, 0x00, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xd2, 0xff, 0x00, 0xff, 0xd1, 0xff, 0x00, 0xff, 0xcf, 0xff, 0x00, 0xff, 0xcf, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xcb, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xc8, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbf, 0xff,
+    0x00, 0xbf, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcb, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xd7, 0xff, 0xff, 0x00, 0xd9, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xde, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x00, 0xe3, 0xff, 0xff, 0x00, 0xe5, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x00, 0xe9, 0xff, 0xff, 0x00, 0xea, 0xff, 0xff, 0x00, 0xec, 0xff, 0xff, 0x00, 0xed, 0xff, 0xff, 0x00, 0xef, 0xff, 0xff, 0x00, 0xf1, 0xff, 0xff, 0x00, 0xf2, 0xff, 0xff, 0x00, 0xf5, 0xff, 0xff, 0x00, 0xf6, 0xff, 0xff, 0x00, 0xf7, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x00, 0xfb, 0xff, 0xff, 0x00, 0xfd, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfd, 0xff, 0x00, 0xff, 0xfb, 0xff, 0x00, 0xff, 0xf9, 0xff, 0x00, 0xff, 0xf7, 0xff, 0x00, 0xff, 0xf6, 0xff, 0x00, 0xff, 0xf4, 0xff, 0x00, 0xff, 0xf2, 0xff, 0x00, 0xff, 0xf1, 0xff, 0x00, 0xff, 0xf0, 0xff, 0x00, 0xff, 0xee, 0xff, 0x00, 0xff, 0xec, 0xff, 0x00, 0xff, 0xeb, 0xff, 0x00, 0xff, 0xe9, 0xff, 0x00, 0xff, 0xe7, 0xff, 0x00, 0xff, 0xe5, 0xff, 0x00, 0xff, 0xe4, 0xff, 0x00, 0xff, 0xe3, 0xff, 0x00, 0xff, 0xe1, 0xff, 0x00, 0xff, 0xe0, 0xff, 0x00, 0xff, 0xde, 0xff, 0x00, 0xff, 0xdd, 0xff, 0x00, 0xff, 0xdc, 0xff, 0x00, 0xff, 0xda, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd7, 0xff, 0x00, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xd1, 0xff, 0x00, 0xff, 0xd0, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xcb, 0xff, 0x00, 0xff, 0xca, 0xff, 0x01, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xc8, 0xff, 0x01, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbe, 0xff,
+    0x00, 0xbe, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xcb, 0xff, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xd7, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xd9, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x00, 0xde, 0xff, 0xff, 0x00, 0xde, 0xff, 0xff, 0x00, 0xe1, 0xff, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x00, 0xe4, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x00, 0xea, 0xff, 0xff, 0x00, 0xec, 0xff, 0xff, 0x00, 0xed, 0xff, 0xff, 0x00, 0xef, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf2, 0xff, 0xff, 0x00, 0xf4, 0xff, 0xff, 0x00, 0xf6, 0xff, 0xff, 0x00, 0xf7, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x00, 0xfa, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfc, 0xff, 0x00, 0xff, 0xfa, 0xff, 0x00, 0xff, 0xf9, 0xff, 0x00, 0xff, 0xf7, 0xff, 0x00, 0xff, 0xf6, 0xff, 0x00, 0xff, 0xf4, 0xff, 0x00, 0xff, 0xf2, 0xff, 0x00, 0xff, 0xf1, 0xff, 0x00, 0xff, 0xef, 0xff, 0x00, 0xff, 0xee, 0xff, 0x00, 0xff, 0xec, 0xff, 0x00, 0xff, 0xea, 0xff, 0x00, 0xff, 0xe8, 0xff, 0x00, 0xff, 0xe7, 0xff, 0x00, 0xff, 0xe5, 0xff, 0x00, 0xff, 0xe4, 0xff, 0x00, 0xff, 0xe2, 0xff, 0x00, 0xff, 0xe0, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x00, 0xff, 0xde, 0xff, 0x00, 0xff, 0xdc, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x01, 0xff, 0xda, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd7, 0xff, 0x00, 0xff, 0xd6, 0xff, 0x00, 0xff, 0xd4, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xd1, 0xff, 0x00, 0xff, 0xd0, 0xff, 0x00, 0xff, 0xcf, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xcb, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xc8, 0xff, 0x00, 0xff, 0xc8, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbe, 0xff,
+    0x00, 0xbc, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcb, 0xff, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x00, 0xd4, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xd9, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x00, 0xe3, 0xff, 0xff, 0x00, 0xe5, 0xff, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x00, 0xea, 0xff, 0xff, 0x00, 0xec, 0xff, 0xff, 0x00, 0xed, 0xff, 0xff, 0x00, 0xee, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf2, 0xff, 0xff, 0x00, 0xf4, 0xff, 0xff, 0x00, 0xf5, 0xff, 0xff, 0x00, 0xf7, 0xff, 0xff, 0x00, 0xf9, 0xff, 0xff, 0x00, 0xfb, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfc, 0xff, 0x00, 0xff, 0xfa, 0xff, 0x00, 0xff, 0xf8, 0xff, 0x00, 0xff, 0xf7, 0xff, 0x00, 0xff, 0xf5, 0xff, 0x00, 0xff, 0xf4, 0xff, 0x00, 0xff, 0xf2, 0xff, 0x00, 0xff, 0xf0, 0xff, 0x00, 0xff, 0xef, 0xff, 0x00, 0xff, 0xed, 0xff, 0x00, 0xff, 0xeb, 0xff, 0x00, 0xff, 0xea, 0xff, 0x00, 0xff, 0xe8, 0xff, 0x00, 0xff, 0xe6, 0xff, 0x00, 0xff, 0xe5, 0xff, 0x00, 0xff, 0xe3, 0xff, 0x00, 0xff, 0xe1, 0xff, 0x00, 0xff, 0xe1, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x00, 0xff, 0xdd, 0xff, 0x00, 0xff, 0xdc, 0xff, 0x00, 0xff, 0xda, 0xff, 0x00, 0xff, 0xd9, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd6, 0xff, 0x00, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xd2, 0xff, 0x00, 0xff, 0xd1, 0xff, 0x00, 0xff, 0xd0, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xcb, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xc8, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbc, 0xff,
+    0x00, 0xbc, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcb, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xce, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x00, 0xd4, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xd7, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x00, 0xe1, 0xff, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x00, 0xe4, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x00, 0xe9, 0xff, 0xff, 0x00, 0xeb, 0xff, 0xff, 0x00, 0xec, 0xff, 0xff, 0x00, 0xee, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf2, 0xff, 0xff, 0x00, 0xf4, 0xff, 0xff, 0x00, 0xf5, 0xff, 0xff, 0x00, 0xf7, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x00, 0xfb, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfc, 0xff, 0x00, 0xff, 0xfa, 0xff, 0x00, 0xff, 0xf9, 0xff, 0x00, 0xff, 0xf7, 0xff, 0x00, 0xff, 0xf5, 0xff, 0x00, 0xff, 0xf4, 0xff, 0x00, 0xff, 0xf1, 0xff, 0x00, 0xff, 0xf0, 0xff, 0x00, 0xff, 0xee, 0xff, 0x00, 0xff, 0xec, 0xff, 0x00, 0xff, 0xeb, 0xff, 0x00, 0xff, 0xe9, 0xff, 0x00, 0xff, 0xe8, 0xff, 0x00, 0xff, 0xe6, 0xff, 0x00, 0xff, 0xe4, 0xff, 0x00, 0xff, 0xe3, 0xff, 0x00, 0xff, 0xe1, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x00, 0xff, 0xdc, 0xff, 0x00, 0xff, 0xdd, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x00, 0xff, 0xda, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd7, 0xff, 0x01, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xd1, 0xff, 0x00, 0xff, 0xd0, 0xff, 0x00, 0xff, 0xcf, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xff, 0xcb, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xc8, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xbc, 0xff,
+    0x00, 0xba, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xce, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xd9, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x00, 0xe3, 0xff, 0xff, 0x00, 0xe5, 0xff, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x00, 0xe9, 0xff, 0xff, 0x00, 0xeb, 0xff, 0xff, 0x00, 0xec, 0xff, 0xff, 0x00, 0xee, 0xff, 0xff, 0x00, 0xef, 0xff, 0xff, 0x00, 0xf2, 0xff, 0xff, 0x00, 0xf3, 0xff, 0xff, 0x00, 0xf5, 0xff, 0xff, 0x00, 0xf7, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x00, 0xfa, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfc, 0xff, 0x00, 0xff, 0xfa, 0xff, 0x00, 0xff, 0xf9, 0xff, 0x00, 0xff, 0xf7, 0xff, 0x00, 0xff, 0xf5, 0xff, 0x00, 0xff, 0xf3, 0xff, 0x00, 0xff, 0xf1, 0xff, 0x00, 0xff, 0xf0, 0xff, 0x00, 0xff, 0xee, 0xff, 0x00, 0xff, 0xed, 0xff, 0x00, 0xff, 0xea, 0xff, 0x00, 0xff, 0xe9, 0xff, 0x00, 0xff, 0xe7, 0xff, 0x00, 0xff, 0xe6, 0xff, 0x00, 0xff, 0xe4, 0xff, 0x00, 0xff, 0xe2, 0xff, 0x00, 0xff, 0xe0, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x00, 0xff, 0xdd, 0xff, 0x00, 0xff, 0xdc, 0xff, 0x00, 0xff, 0xda, 0xff, 0x00, 0xff, 0xd9, 0xff, 0x00, 0xff, 0xd7, 0xff, 0x00, 0xff, 0xd6, 0xff, 0x00, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xd2, 0xff, 0x00, 0xff, 0xd0, 0xff, 0x00, 0xff, 0xcf, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x01, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xbb, 0xff,
+    0x00, 0xba, 0xff, 0xff, 0x00, 0xbb, 0xfe, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcb, 0xff, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x00, 0xd4, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xde, 0xfe, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xe1, 0xff, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x00, 0xe5, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x00, 0xea, 0xff, 0xff, 0x00, 0xeb, 0xff, 0xff, 0x00, 0xee, 0xff, 0xff, 0x00, 0xef, 0xff, 0xff, 0x00, 0xf1, 0xff, 0xff, 0x00, 0xf3, 0xff, 0xff, 0x00, 0xf5, 0xff, 0xff, 0x00, 0xf6, 0xff, 0xff, 0x00, 0xf9, 0xff, 0xff, 0x00, 0xfb, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfc, 0xff, 0x00, 0xff, 0xfa, 0xff, 0x00, 0xff, 0xf8, 0xff, 0x00, 0xff, 0xf6, 0xff, 0x01, 0xff, 0xf4, 0xff, 0x00, 0xff, 0xf3, 0xff, 0x00, 0xff, 0xf1, 0xff, 0x00, 0xff, 0xef, 0xff, 0x00, 0xff, 0xed, 0xff, 0x00, 0xff, 0xec, 0xff, 0x00, 0xff, 0xea, 0xff, 0x00, 0xff, 0xe8, 0xff, 0x00, 0xff, 0xe6, 0xff, 0x00, 0xff, 0xe5, 0xff, 0x00, 0xff, 0xe3, 0xff, 0x00, 0xff, 0xe1, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x00, 0xff, 0xde, 0xff, 0x00, 0xff, 0xdd, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x01, 0xff, 0xd9, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd7, 0xff, 0x00, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xd1, 0xff, 0x00, 0xff, 0xd0, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xcb, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xc8, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xba, 0xff,
+    0x00, 0xb9, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcb, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x00, 0xde, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x00, 0xe1, 0xff, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x00, 0xe4, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x00, 0xea, 0xff, 0xff, 0x00, 0xeb, 0xff, 0xff, 0x00, 0xed, 0xff, 0xff, 0x00, 0xef, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf3, 0xff, 0xff, 0x00, 0xf5, 0xff, 0xff, 0x00, 0xf7, 0xff, 0xff, 0x00, 0xf9, 0xff, 0xff, 0x00, 0xfa, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfc, 0xff, 0x00, 0xff, 0xfa, 0xff, 0x00, 0xff, 0xf9, 0xff, 0x00, 0xff, 0xf7, 0xff, 0x00, 0xff, 0xf4, 0xff, 0x00, 0xff, 0xf2, 0xff, 0x00, 0xff, 0xf1, 0xff, 0x00, 0xff, 0xef, 0xff, 0x00, 0xff, 0xed, 0xff, 0x00, 0xff, 0xeb, 0xff, 0x00, 0xff, 0xe9, 0xff, 0x00, 0xff, 0xe8, 0xff, 0x00, 0xff, 0xe6, 0xff, 0x00, 0xff, 0xe4, 0xff, 0x00, 0xff, 0xe3, 0xff, 0x00, 0xff, 0xe0, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x00, 0xff, 0xde, 0xff, 0x00, 0xff, 0xdc, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x00, 0xff, 0xd9, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd6, 0xff, 0x00, 0xff, 0xd4, 0xff, 0x00, 0xff, 0xd2, 0xff, 0x00, 0xff, 0xd2, 0xff, 0x00, 0xff, 0xd0, 0xff, 0x00, 0xff, 0xcf, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xff, 0xcb, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xba, 0xff, 0x00, 0xff, 0xba, 0xff, 0x00, 0xff, 0xb9, 0xff,
+    0x00, 0xb8, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcb, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xce, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xd9, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xde, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x00, 0xe4, 0xff, 0xff, 0x00, 0xe5, 0xff, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x00, 0xe9, 0xff, 0xff, 0x01, 0xea, 0xff, 0xff, 0x00, 0xec, 0xff, 0xff, 0x00, 0xee, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf3, 0xff, 0xff, 0x00, 0xf5, 0xff, 0xff, 0x00, 0xf6, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x00, 0xfa, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfc, 0xff, 0x00, 0xff, 0xfa, 0xff, 0x00, 0xff, 0xf8, 0xff, 0x00, 0xff, 0xf6, 0xff, 0x00, 0xff, 0xf5, 0xff, 0x00, 0xff, 0xf2, 0xff, 0x00, 0xff, 0xf0, 0xff, 0x00, 0xff, 0xef, 0xff, 0x00, 0xff, 0xed, 0xff, 0x00, 0xff, 0xeb, 0xff, 0x00, 0xff, 0xe9, 0xff, 0x00, 0xff, 0xe7, 0xff, 0x00, 0xff, 0xe5, 0xff, 0x00, 0xff, 0xe4, 0xff, 0x00, 0xff, 0xe2, 0xff, 0x00, 0xff, 0xe0, 0xff, 0x00, 0xff, 0xde, 0xff, 0x00, 0xff, 0xdc, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x00, 0xff, 0xd9, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd6, 0xff, 0x00, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xd4, 0xff, 0x00, 0xff, 0xd2, 0xff, 0x00, 0xff, 0xd0, 0xff, 0x00, 0xff, 0xcf, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xff, 0xcb, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xba, 0xff, 0x00, 0xff, 0xba, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb7, 0xff,
+    0x00, 0xb7, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xff, 0x00, 0xba, 0xfe, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xce, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x00, 0xd4, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xd7, 0xff, 0xff, 0x00, 0xd9, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x00, 0xde, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x00, 0xe1, 0xff, 0xff, 0x00, 0xe3, 0xff, 0xff, 0x00, 0xe5, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xe9, 0xff, 0xff, 0x00, 0xeb, 0xff, 0xff, 0x00, 0xec, 0xff, 0xff, 0x00, 0xef, 0xff, 0xff, 0x00, 0xf1, 0xff, 0xff, 0x00, 0xf2, 0xff, 0xff, 0x00, 0xf4, 0xff, 0xff, 0x00, 0xf6, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x00, 0xfa, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfc, 0xff, 0x00, 0xff, 0xfa, 0xff, 0x00, 0xff, 0xf8, 0xff, 0x00, 0xff, 0xf6, 0xff, 0x00, 0xff, 0xf4, 0xff, 0x00, 0xff, 0xf2, 0xff, 0x00, 0xff, 0xf0, 0xff, 0x00, 0xff, 0xee, 0xff, 0x00, 0xff, 0xec, 0xff, 0x00, 0xff, 0xea, 0xff, 0x00, 0xff, 0xe8, 0xff, 0x00, 0xff, 0xe7, 0xff, 0x00, 0xff, 0xe5, 0xff, 0x00, 0xff, 0xe3, 0xff, 0x00, 0xff, 0xe1, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x00, 0xff, 0xdd, 0xff, 0x00, 0xff, 0xdc, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd7, 0xff, 0x00, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xd4, 0xff, 0x00, 0xff, 0xd2, 0xff, 0x00, 0xfe, 0xd1, 0xff, 0x00, 0xff, 0xcf, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xcb, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xc8, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xba, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb7, 0xff,
+    0x00, 0xb6, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xcb, 0xff, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xce, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xd9, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xde, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x00, 0xe4, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x00, 0xea, 0xff, 0xff, 0x00, 0xec, 0xff, 0xff, 0x00, 0xee, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf2, 0xff, 0xff, 0x00, 0xf4, 0xff, 0xff, 0x00, 0xf6, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x00, 0xf9, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfc, 0xff, 0x00, 0xff, 0xfa, 0xff, 0x00, 0xff, 0xf8, 0xff, 0x00, 0xff, 0xf6, 0xff, 0x00, 0xff, 0xf4, 0xff, 0x00, 0xff, 0xf2, 0xff, 0x00, 0xff, 0xef, 0xff, 0x00, 0xff, 0xee, 0xff, 0x00, 0xff, 0xec, 0xff, 0x00, 0xff, 0xe9, 0xff, 0x00, 0xff, 0xe8, 0xff, 0x00, 0xff, 0xe6, 0xff, 0x00, 0xff, 0xe5, 0xff, 0x00, 0xff, 0xe2, 0xff, 0x00, 0xff, 0xe1, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x00, 0xff, 0xdd, 0xff, 0x00, 0xff, 0xda, 0xff, 0x00, 0xff, 0xda, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd6, 0xff, 0x00, 0xff, 0xd4, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xd2, 0xff, 0x00, 0xff, 0xd1, 0xff, 0x00, 0xff, 0xcf, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xcb, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xba, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb6, 0xff, 0x00, 0xff, 0xb6, 0xff,
+    0x00, 0xb5, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xcb, 0xff, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xce, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x00, 0xd4, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xd7, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x00, 0xe3, 0xff, 0xff, 0x00, 0xe5, 0xff, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x00, 0xea, 0xff, 0xff, 0x00, 0xeb, 0xff, 0xff, 0x00, 0xee, 0xff, 0xff, 0x00, 0xef, 0xff, 0xff, 0x00, 0xf2, 0xff, 0xff, 0x00, 0xf4, 0xff, 0xff, 0x00, 0xf5, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x00, 0xfa, 0xff, 0xff, 0x00, 0xfb, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfb, 0xff, 0x00, 0xff, 0xf9, 0xff, 0x00, 0xff, 0xf8, 0xff, 0x00, 0xff, 0xf5, 0xff, 0x00, 0xff, 0xf3, 0xff, 0x00, 0xff, 0xf1, 0xff, 0x00, 0xff, 0xef, 0xff, 0x00, 0xff, 0xed, 0xff, 0x00, 0xff, 0xed, 0xff, 0x00, 0xff, 0xea, 0xff, 0x00, 0xff, 0xe7, 0xff, 0x00, 0xff, 0xe5, 0xff, 0x00, 0xff, 0xe3, 0xff, 0x00, 0xff, 0xe1, 0xff, 0x00, 0xff, 0xe0, 0xff, 0x00, 0xff, 0xde, 0xff, 0x00, 0xff, 0xdc, 0xff, 0x00, 0xff, 0xda, 0xff, 0x00, 0xff, 0xd9, 0xff, 0x00, 0xff, 0xd7, 0xff, 0x00, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xd4, 0xff, 0x00, 0xff, 0xd2, 0xff, 0x00, 0xff, 0xd0, 0xff, 0x00, 0xff, 0xd0, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xfe, 0xcc, 0xff, 0x00, 0xff, 0xcb, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xc8, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x01, 0xff, 0xba, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb6, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb5, 0xff,
+    0x00, 0xb4, 0xff, 0xff, 0x00, 0xb5, 0xfe, 0xff, 0x00, 0xb5, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xce, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x00, 0xe1, 0xff, 0xff, 0x01, 0xe2, 0xff, 0xff, 0x00, 0xe5, 0xff, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x00, 0xe9, 0xff, 0xff, 0x00, 0xea, 0xff, 0xff, 0x00, 0xed, 0xff, 0xff, 0x00, 0xef, 0xff, 0xff, 0x00, 0xf1, 0xff, 0xff, 0x00, 0xf3, 0xff, 0xff, 0x00, 0xf5, 0xff, 0xff, 0x00, 0xf7, 0xff, 0xff, 0x00, 0xf9, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfb, 0xff, 0x00, 0xff, 0xfa, 0xff, 0x00, 0xff, 0xf8, 0xff, 0x00, 0xff, 0xf5, 0xff, 0x00, 0xff, 0xf3, 0xff, 0x00, 0xff, 0xf1, 0xff, 0x00, 0xff, 0xee, 0xff, 0x00, 0xff, 0xec, 0xff, 0x00, 0xff, 0xea, 0xff, 0x00, 0xff, 0xe9, 0xff, 0x00, 0xff, 0xe7, 0xff, 0x00, 0xff, 0xe5, 0xff, 0x00, 0xff, 0xe3, 0xff, 0x00, 0xff, 0xe1, 0xff, 0x00, 0xff, 0xde, 0xff, 0x00, 0xff, 0xdd, 0xff, 0x00, 0xff, 0xdc, 0xff, 0x00, 0xff, 0xda, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd6, 0xff, 0x00, 0xff, 0xd4, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xd2, 0xff, 0x00, 0xff, 0xcf, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xff, 0xcb, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xba, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb6, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb4, 0xff,
+    0x00, 0xb3, 0xff, 0xff, 0x00, 0xb3, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x01, 0xb7, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xcb, 0xfe, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x00, 0xd4, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xd7, 0xff, 0xff, 0x00, 0xd9, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x00, 0xde, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xe3, 0xff, 0xff, 0x00, 0xe4, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x00, 0xea, 0xff, 0xff, 0x00, 0xed, 0xff, 0xff, 0x00, 0xef, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf2, 0xff, 0xff, 0x00, 0xf5, 0xff, 0xff, 0x00, 0xf7, 0xff, 0xff, 0x00, 0xf9, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfb, 0xff, 0x00, 0xff, 0xf9, 0xff, 0x00, 0xff, 0xf7, 0xff, 0x00, 0xff, 0xf5, 0xff, 0x00, 0xff, 0xf3, 0xff, 0x00, 0xff, 0xf1, 0xff, 0x00, 0xff, 0xee, 0xff, 0x00, 0xff, 0xed, 0xff, 0x00, 0xff, 0xea, 0xff, 0x00, 0xff, 0xe8, 0xff, 0x00, 0xff, 0xe6, 0xff, 0x00, 0xff, 0xe4, 0xff, 0x00, 0xff, 0xe2, 0xff, 0x00, 0xff, 0xe0, 0xff, 0x00, 0xff, 0xde, 0xff, 0x00, 0xff, 0xdc, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x00, 0xff, 0xd9, 0xff, 0x00, 0xff, 0xd7, 0xff, 0x00, 0xff, 0xd6, 0xff, 0x00, 0xff, 0xd4, 0xff, 0x00, 0xff, 0xd2, 0xff, 0x00, 0xff, 0xd1, 0xff, 0x00, 0xff, 0xcf, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xff, 0xcb, 0xff, 0x00, 0xff, 0xcb, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x01, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xba, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb6, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb4, 0xff, 0x00, 0xff, 0xb4, 0xff, 0x00, 0xff, 0xb2, 0xff,
+    0x00, 0xb3, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xb3, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x00, 0xe3, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x00, 0xe9, 0xff, 0xff, 0x00, 0xec, 0xff, 0xff, 0x00, 0xee, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf3, 0xff, 0xff, 0x00, 0xf4, 0xff, 0xff, 0x00, 0xf7, 0xff, 0xff, 0x00, 0xf9, 0xff, 0xff, 0x00, 0xfb, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfb, 0xff, 0x00, 0xff, 0xf9, 0xff, 0x00, 0xff, 0xf7, 0xff, 0x00, 0xff, 0xf4, 0xff, 0x00, 0xff, 0xf2, 0xff, 0x00, 0xff, 0xf0, 0xff, 0x00, 0xff, 0xee, 0xff, 0x00, 0xff, 0xec, 0xff, 0x00, 0xff, 0xe9, 0xff, 0x00, 0xff, 0xe8, 0xff, 0x00, 0xff, 0xe6, 0xff, 0x00, 0xff, 0xe3, 0xff, 0x00, 0xff, 0xe2, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x00, 0xff, 0xde, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x00, 0xff, 0xda, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd6, 0xff, 0x00, 0xff, 0xd4, 0xff, 0x00, 0xff, 0xd2, 0xff, 0x00, 0xff, 0xd1, 0xff, 0x00, 0xff, 0xcf, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xc8, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb4, 0xff, 0x00, 0xff, 0xb4, 0xff, 0x00, 0xff, 0xb3, 0xff, 0x00, 0xff, 0xb2, 0xff,
+    0x00, 0xb0, 0xff, 0xff, 0x00, 0xb1, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbb, 0xfe, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbc, 0xfe, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xcb, 0xff, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xce, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xd9, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x00, 0xe5, 0xff, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x00, 0xe9, 0xff, 0xff, 0x00, 0xec, 0xff, 0xff, 0x00, 0xed, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf2, 0xff, 0xff, 0x00, 0xf5, 0xff, 0xff, 0x00, 0xf7, 0xff, 0xff, 0x00, 0xf9, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xfd, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfb, 0xff, 0x00, 0xff, 0xf9, 0xff, 0x00, 0xff, 0xf7, 0xff, 0x01, 0xff, 0xf5, 0xff, 0x00, 0xff, 0xf2, 0xff, 0x00, 0xff, 0xf0, 0xff, 0x00, 0xff, 0xed, 0xff, 0x00, 0xff, 0xeb, 0xff, 0x00, 0xff, 0xe9, 0xff, 0x00, 0xff, 0xe7, 0xff, 0x00, 0xff, 0xe4, 0xff, 0x00, 0xff, 0xe3, 0xff, 0x00, 0xff, 0xe1, 0xff, 0x00, 0xff, 0xde, 0xff, 0x00, 0xff, 0xdc, 0xff, 0x00, 0xff, 0xda, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd7, 0xff, 0x00, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xd2, 0xff, 0x00, 0xff, 0xd0, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xca, 0xff, 0x01, 0xff, 0xc8, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb6, 0xff, 0x00, 0xfe, 0xb6, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb3, 0xff, 0x00, 0xff, 0xb2, 0xff, 0x00, 0xff, 0xb2, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xb0, 0xff,
+    0x00, 0xaf, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb1, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcb, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x00, 0xd4, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xd9, 0xff, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x00, 0xde, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x00, 0xe3, 0xff, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x00, 0xeb, 0xff, 0xff, 0x00, 0xed, 0xff, 0xff, 0x00, 0xef, 0xff, 0xff, 0x00, 0xf2, 0xff, 0xff, 0x00, 0xf4, 0xff, 0xff, 0x00, 0xf7, 0xff, 0xff, 0x00, 0xf9, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xfd, 0xff, 0x00, 0xff, 0xfb, 0xff, 0x00, 0xff, 0xf9, 0xff, 0x00, 0xff, 0xf6, 0xff, 0x00, 0xff, 0xf4, 0xff, 0x00, 0xff, 0xf2, 0xff, 0x00, 0xff, 0xef, 0xff, 0x00, 0xff, 0xed, 0xff, 0x00, 0xff, 0xeb, 0xff, 0x00, 0xff, 0xe9, 0xff, 0x00, 0xff, 0xe6, 0xff, 0x00, 0xff, 0xe3, 0xff, 0x00, 0xff, 0xe2, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x00, 0xff, 0xde, 0xff, 0x00, 0xff, 0xdc, 0xff, 0x00, 0xff, 0xd9, 0xff, 0x00, 0xff, 0xd7, 0xff, 0x00, 0xff, 0xd6, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xfe, 0xd2, 0xff, 0x00, 0xff, 0xd1, 0xff, 0x00, 0xff, 0xcf, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xff, 0xcb, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xc8, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xba, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb4, 0xff, 0x00, 0xff, 0xb3, 0xff, 0x00, 0xff, 0xb3, 0xff, 0x00, 0xff, 0xb2, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xaf, 0xff,
+    0x00, 0xae, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb1, 0xff, 0xff, 0x00, 0xb3, 0xff, 0xff, 0x00, 0xb3, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xbf, 0xfe, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc4, 0xfe, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xcb, 0xff, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xd7, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x00, 0xe1, 0xff, 0xff, 0x00, 0xe3, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x00, 0xea, 0xff, 0xff, 0x00, 0xec, 0xff, 0xff, 0x00, 0xef, 0xff, 0xff, 0x00, 0xf1, 0xff, 0xff, 0x01, 0xf4, 0xff, 0xff, 0x00, 0xf7, 0xff, 0xff, 0x00, 0xf9, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfc, 0xff, 0x00, 0xff, 0xf8, 0xff, 0x00, 0xff, 0xf6, 0xff, 0x00, 0xff, 0xf3, 0xff, 0x00, 0xff, 0xf2, 0xff, 0x00, 0xff, 0xef, 0xff, 0x00, 0xff, 0xed, 0xff, 0x00, 0xff, 0xea, 0xff, 0x00, 0xff, 0xe8, 0xff, 0x00, 0xff, 0xe5, 0xff, 0x00, 0xff, 0xe3, 0xff, 0x00, 0xff, 0xe1, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x00, 0xff, 0xdc, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd6, 0xff, 0x00, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xd2, 0xff, 0x00, 0xff, 0xd1, 0xff, 0x00, 0xff, 0xd0, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xba, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb6, 0xff, 0x00, 0xff, 0xb6, 0xff, 0x00, 0xff, 0xb4, 0xff, 0x00, 0xff, 0xb3, 0xff, 0x00, 0xff, 0xb2, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xb0, 0xff, 0x00, 0xff, 0xaf, 0xff, 0x00, 0xff, 0xaf, 0xff, 0x00, 0xff, 0xaf, 0xff,
+    0x00, 0xad, 0xff, 0xff, 0x00, 0xae, 0xff, 0xff, 0x00, 0xae, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb1, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xb3, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xce, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xd9, 0xff, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x00, 0xde, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x00, 0xe4, 0xff, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x00, 0xe9, 0xff, 0xff, 0x00, 0xec, 0xff, 0xff, 0x00, 0xee, 0xff, 0xff, 0x00, 0xf1, 0xff, 0xff, 0x00, 0xf2, 0xff, 0xff, 0x00, 0xf6, 0xff, 0xff, 0x00, 0xf9, 0xff, 0xff, 0x00, 0xfb, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfb, 0xff, 0x00, 0xff, 0xf8, 0xff, 0x00, 0xff, 0xf6, 0xff, 0x00, 0xff, 0xf4, 0xff, 0x00, 0xff, 0xf1, 0xff, 0x00, 0xff, 0xee, 0xff, 0x00, 0xff, 0xeb, 0xff, 0x00, 0xff, 0xea, 0xff, 0x00, 0xff, 0xe7, 0xff, 0x00, 0xff, 0xe5, 0xff, 0x00, 0xff, 0xe2, 0xff, 0x00, 0xff, 0xe0, 0xff, 0x00, 0xff, 0xdd, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x00, 0xff, 0xd9, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xd4, 0xff, 0x00, 0xff, 0xd1, 0xff, 0x00, 0xff, 0xd0, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xfe, 0xc7, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xba, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb4, 0xff, 0x00, 0xff, 0xb3, 0xff, 0x00, 0xff, 0xb2, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xb0, 0xff, 0x00, 0xff, 0xaf, 0xff, 0x00, 0xff, 0xaf, 0xff, 0x00, 0xff, 0xae, 0xff, 0x00, 0xff, 0xad, 0xff,
+    0x00, 0xac, 0xff, 0xff, 0x00, 0xad, 0xff, 0xff, 0x00, 0xad, 0xff, 0xff, 0x00, 0xae, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xb3, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcb, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xce, 0xff, 0xff, 0x01, 0xd0, 0xff, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x00, 0xd4, 0xff, 0xff, 0x00, 0xd7, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x00, 0xe3, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xe9, 0xff, 0xff, 0x00, 0xeb, 0xff, 0xff, 0x00, 0xee, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf3, 0xff, 0xff, 0x00, 0xf5, 0xff, 0xff, 0x00, 0xf9, 0xff, 0xff, 0x00, 0xfb, 0xff, 0xff, 0x00, 0xfd, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfa, 0xff, 0x00, 0xff, 0xf8, 0xff, 0x00, 0xff, 0xf6, 0xff, 0x00, 0xff, 0xf3, 0xff, 0x00, 0xff, 0xf0, 0xff, 0x00, 0xff, 0xee, 0xff, 0x00, 0xff, 0xec, 0xff, 0x00, 0xff, 0xe9, 0xff, 0x00, 0xff, 0xe7, 0xff, 0x00, 0xff, 0xe4, 0xff, 0x00, 0xff, 0xe2, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x00, 0xff, 0xdd, 0xff, 0x00, 0xff, 0xda, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd6, 0xff, 0x01, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xd1, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xff, 0xcb, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xba, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb6, 0xff, 0x00, 0xff, 0xb6, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb3, 0xff, 0x00, 0xff, 0xb3, 0xff, 0x00, 0xff, 0xb2, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xb0, 0xff, 0x00, 0xff, 0xaf, 0xff, 0x00, 0xff, 0xaf, 0xff, 0x00, 0xff, 0xad, 0xff, 0x00, 0xff, 0xac, 0xff, 0x00, 0xff, 0xac, 0xff,
+    0x00, 0xaa, 0xff, 0xff, 0x00, 0xab, 0xff, 0xff, 0x00, 0xac, 0xff, 0xff, 0x00, 0xad, 0xff, 0xff, 0x00, 0xad, 0xff, 0xff, 0x00, 0xae, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb1, 0xff, 0xff, 0x00, 0xb1, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xb3, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcb, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xd7, 0xff, 0xff, 0x00, 0xd9, 0xff, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x00, 0xde, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xe3, 0xff, 0xff, 0x00, 0xe4, 0xff, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x00, 0xeb, 0xff, 0xff, 0x00, 0xed, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf3, 0xff, 0xff, 0x00, 0xf5, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x00, 0xfb, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfb, 0xff, 0x00, 0xff, 0xf8, 0xff, 0x00, 0xff, 0xf5, 0xff, 0x00, 0xff, 0xf3, 0xff, 0x00, 0xff, 0xef, 0xff, 0x00, 0xff, 0xed, 0xff, 0x00, 0xff, 0xea, 0xff, 0x00, 0xff, 0xe8, 0xff, 0x01, 0xff, 0xe5, 0xff, 0x00, 0xff, 0xe3, 0xff, 0x00, 0xff, 0xe1, 0xff, 0x00, 0xff, 0xde, 0xff, 0x00, 0xff, 0xdc, 0xff, 0x00, 0xff, 0xda, 0xff, 0x00, 0xff, 0xd7, 0xff, 0x00, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xd1, 0xff, 0x00, 0xff, 0xcf, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xff, 0xcb, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xc8, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xba, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb4, 0xff, 0x00, 0xff, 0xb3, 0xff, 0x00, 0xff, 0xb2, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xfe, 0xaf, 0xff, 0x00, 0xff, 0xae, 0xff, 0x00, 0xff, 0xae, 0xff, 0x00, 0xff, 0xad, 0xff, 0x00, 0xff, 0xac, 0xff, 0x00, 0xff, 0xac, 0xff, 0x00, 0xff, 0xab, 0xff,
+    0x00, 0xa9, 0xff, 0xff, 0x00, 0xaa, 0xff, 0xff, 0x00, 0xab, 0xff, 0xff, 0x00, 0xac, 0xff, 0xff, 0x00, 0xad, 0xff, 0xff, 0x00, 0xae, 0xff, 0xff, 0x00, 0xae, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb1, 0xff, 0xff, 0x00, 0xb1, 0xff, 0xff, 0x00, 0xb3, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xce, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x00, 0xd4, 0xff, 0xff, 0x00, 0xd7, 0xff, 0xff, 0x00, 0xd9, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x00, 0xe4, 0xff, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x00, 0xea, 0xff, 0xff, 0x00, 0xed, 0xff, 0xff, 0x00, 0xef, 0xff, 0xff, 0x00, 0xf2, 0xff, 0xff, 0x00, 0xf5, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x00, 0xfa, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfa, 0xff, 0x00, 0xff, 0xf8, 0xff, 0x00, 0xff, 0xf5, 0xff, 0x00, 0xff, 0xf2, 0xff, 0x00, 0xff, 0xef, 0xff, 0x00, 0xff, 0xed, 0xff, 0x00, 0xff, 0xea, 0xff, 0x00, 0xff, 0xe7, 0xff, 0x00, 0xff, 0xe4, 0xff, 0x00, 0xff, 0xe2, 0xff, 0x00, 0xff, 0xe0, 0xff, 0x00, 0xff, 0xdd, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd6, 0xff, 0x00, 0xff, 0xd4, 0xff, 0x00, 0xff, 0xd2, 0xff, 0x00, 0xff, 0xcf, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xc8, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb6, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb4, 0xff, 0x00, 0xff, 0xb2, 0xff, 0x00, 0xff, 0xb2, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xb0, 0xff, 0x00, 0xff, 0xaf, 0xff, 0x00, 0xff, 0xaf, 0xff, 0x00, 0xff, 0xad, 0xff, 0x00, 0xff, 0xac, 0xff, 0x00, 0xff, 0xac, 0xff, 0x00, 0xff, 0xab, 0xff, 0x00, 0xff, 0xab, 0xff, 0x00, 0xff, 0xa9, 0xff,
+    0x00, 0xa8, 0xff, 0xff, 0x00, 0xa9, 0xff, 0xff, 0x00, 0xa9, 0xff, 0xff, 0x01, 0xab, 0xff, 0xff, 0x00, 0xab, 0xff, 0xff, 0x00, 0xac, 0xff, 0xff, 0x00, 0xad, 0xff, 0xff, 0x00, 0xae, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xb3, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xd9, 0xfe, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x00, 0xe1, 0xff, 0xff, 0x00, 0xe4, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xe9, 0xff, 0xff, 0x00, 0xec, 0xff, 0xff, 0x00, 0xef, 0xff, 0xff, 0x00, 0xf2, 0xff, 0xff, 0x00, 0xf4, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x00, 0xfb, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xfe, 0xfd, 0xff, 0x00, 0xff, 0xfb, 0xff, 0x00, 0xff, 0xf8, 0xff, 0x00, 0xff, 0xf5, 0xff, 0x00, 0xff, 0xf2, 0xff, 0x00, 0xff, 0xef, 0xff, 0x00, 0xff, 0xec, 0xff, 0x00, 0xff, 0xe9, 0xff, 0x00, 0xff, 0xe6, 0xff, 0x00, 0xff, 0xe3, 0xff, 0x00, 0xff, 0xe1, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x00, 0xff, 0xdc, 0xff, 0x00, 0xff, 0xd9, 0xff, 0x00, 0xff, 0xd7, 0xff, 0x00, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xd0, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xc8, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xba, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb4, 0xff, 0x00, 0xff, 0xb4, 0xff, 0x00, 0xff, 0xb2, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xb0, 0xff, 0x00, 0xff, 0xb0, 0xff, 0x00, 0xff, 0xae, 0xff, 0x00, 0xff, 0xae, 0xff, 0x00, 0xff, 0xad, 0xff, 0x00, 0xff, 0xac, 0xff, 0x00, 0xff, 0xab, 0xff, 0x00, 0xff, 0xaa, 0xff, 0x00, 0xff, 0xaa, 0xff, 0x00, 0xff, 0xa9, 0xff, 0x00, 0xff, 0xa8, 0xff,
+    0x00, 0xa7, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0xa8, 0xff, 0xff, 0x00, 0xa9, 0xff, 0xff, 0x00, 0xaa, 0xff, 0xff, 0x00, 0xab, 0xff, 0xff, 0x00, 0xab, 0xff, 0xff, 0x00, 0xad, 0xff, 0xff, 0x00, 0xad, 0xff, 0xff, 0x00, 0xae, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb1, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xb3, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xcb, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xd4, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xd9, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0xde, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xe3, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xe9, 0xff, 0xff, 0x00, 0xec, 0xff, 0xff, 0x00, 0xee, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf5, 0xff, 0xff, 0x00, 0xf7, 0xff, 0xff, 0x00, 0xfa, 0xff, 0xff, 0x00, 0xfd, 0xff, 0xff, 0x00, 0xff, 0xfd, 0xff, 0x00, 0xff, 0xfa, 0xff, 0x00, 0xff, 0xf7, 0xff, 0x00, 0xff, 0xf4, 0xff, 0x00, 0xff, 0xf1, 0xff, 0x00, 0xff, 0xef, 0xff, 0x00, 0xff, 0xec, 0xff, 0x00, 0xff, 0xe8, 0xff, 0x00, 0xff, 0xe5, 0xff, 0x00, 0xff, 0xe2, 0xff, 0x00, 0xff, 0xe0, 0xff, 0x00, 0xff, 0xdd, 0xff, 0x00, 0xff, 0xda, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd6, 0xff, 0x00, 0xff, 0xd4, 0xff, 0x00, 0xff, 0xd2, 0xff, 0x00, 0xff, 0xcf, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xff, 0xcb, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb3, 0xff, 0x00, 0xff, 0xb2, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xb0, 0xff, 0x00, 0xff, 0xaf, 0xff, 0x00, 0xff, 0xae, 0xff, 0x00, 0xff, 0xad, 0xff, 0x00, 0xff, 0xac, 0xff, 0x00, 0xff, 0xac, 0xff, 0x00, 0xff, 0xab, 0xff, 0x00, 0xff, 0xaa, 0xff, 0x00, 0xff, 0xa9, 0xff, 0x00, 0xff, 0xa8, 0xff, 0x00, 0xff, 0xa8, 0xff, 0x00, 0xff, 0xa6, 0xff,
+    0x00, 0xa6, 0xff, 0xff, 0x00, 0xa6, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0xa8, 0xff, 0xff, 0x00, 0xa8, 0xff, 0xff, 0x00, 0xa9, 0xff, 0xff, 0x00, 0xaa, 0xff, 0xff, 0x00, 0xaa, 0xff, 0xff, 0x00, 0xac, 0xff, 0xff, 0x00, 0xac, 0xff, 0xff, 0x00, 0xad, 0xff, 0xff, 0x00, 0xae, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x01, 0xb1, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xb3, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x00, 0xd4, 0xfe, 0xff, 0x00, 0xd7, 0xff, 0xff, 0x00, 0xd9, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x00, 0xe1, 0xff, 0xff, 0x00, 0xe5, 0xff, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x00, 0xea, 0xff, 0xff, 0x00, 0xed, 0xff, 0xff, 0x00, 0xf1, 0xff, 0xff, 0x00, 0xf4, 0xff, 0xff, 0x00, 0xf7, 0xff, 0xff, 0x00, 0xfa, 0xff, 0xff, 0x00, 0xfd, 0xff, 0xff, 0x00, 0xff, 0xfd, 0xff, 0x00, 0xff, 0xfa, 0xff, 0x00, 0xff, 0xf7, 0xff, 0x00, 0xff, 0xf4, 0xff, 0x00, 0xff, 0xf1, 0xff, 0x00, 0xff, 0xed, 0xff, 0x00, 0xff, 0xeb, 0xff, 0x00, 0xff, 0xe7, 0xff, 0x00, 0xff, 0xe5, 0xff, 0x00, 0xff, 0xe2, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x00, 0xff, 0xdc, 0xff, 0x00, 0xff, 0xda, 0xff, 0x00, 0xff, 0xd7, 0xff, 0x00, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xd2, 0xff, 0x00, 0xff, 0xd0, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xc8, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xba, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb6, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb4, 0xff, 0x00, 0xff, 0xb3, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xb0, 0xff, 0x00, 0xff, 0xaf, 0xff, 0x00, 0xff, 0xad, 0xff, 0x00, 0xff, 0xad, 0xff, 0x00, 0xff, 0xac, 0xff, 0x00, 0xff, 0xab, 0xff, 0x00, 0xff, 0xaa, 0xff, 0x00, 0xff, 0xa9, 0xff, 0x00, 0xff, 0xa9, 0xff, 0x00, 0xff, 0xa8, 0xff, 0x00, 0xff, 0xa7, 0xff, 0x00, 0xff, 0xa7, 0xff, 0x00, 0xff, 0xa6, 0xff,
+    0x00, 0xa4, 0xff, 0xff, 0x00, 0xa5, 0xff, 0xff, 0x00, 0xa5, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0xa8, 0xff, 0xff, 0x00, 0xa9, 0xff, 0xff, 0x00, 0xa9, 0xff, 0xff, 0x00, 0xab, 0xff, 0xff, 0x00, 0xab, 0xff, 0xff, 0x00, 0xac, 0xff, 0xff, 0x00, 0xad, 0xff, 0xff, 0x00, 0xae, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb1, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x01, 0xb4, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xe3, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xea, 0xff, 0xff, 0x00, 0xed, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf4, 0xff, 0xff, 0x00, 0xf7, 0xff, 0xff, 0x00, 0xfa, 0xff, 0xff, 0x00, 0xfd, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfa, 0xff, 0x00, 0xff, 0xf7, 0xff, 0x00, 0xff, 0xf3, 0xff, 0x00, 0xff, 0xf0, 0xff, 0x00, 0xff, 0xed, 0xff, 0x00, 0xff, 0xea, 0xff, 0x00, 0xfe, 0xe6, 0xff, 0x00, 0xff, 0xe3, 0xff, 0x00, 0xff, 0xe0, 0xff, 0x00, 0xff, 0xde, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xd1, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xc8, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xfe, 0xc4, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xba, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb6, 0xff, 0x00, 0xff, 0xb4, 0xff, 0x00, 0xff, 0xb3, 0xff, 0x00, 0xff, 0xb2, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xb0, 0xff, 0x00, 0xff, 0xaf, 0xff, 0x00, 0xff, 0xae, 0xff, 0x00, 0xff, 0xae, 0xff, 0x00, 0xff, 0xac, 0xff, 0x00, 0xff, 0xab, 0xff, 0x00, 0xff, 0xaa, 0xff, 0x00, 0xff, 0xaa, 0xff, 0x00, 0xff, 0xa9, 0xff, 0x00, 0xff, 0xa8, 0xff, 0x00, 0xff, 0xa7, 0xff, 0x00, 0xff, 0xa7, 0xff, 0x00, 0xff, 0xa6, 0xff, 0x00, 0xff, 0xa5, 0xff, 0x00, 0xff, 0xa4, 0xff,
+    0x00, 0xa3, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xff, 0x00, 0xa4, 0xff, 0xff, 0x00, 0xa5, 0xff, 0xff, 0x00, 0xa6, 0xff, 0xff, 0x00, 0xa6, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0xa8, 0xff, 0xff, 0x00, 0xa9, 0xff, 0xff, 0x00, 0xaa, 0xff, 0xff, 0x00, 0xaa, 0xff, 0xff, 0x00, 0xac, 0xff, 0xff, 0x00, 0xac, 0xff, 0xff, 0x00, 0xae, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xb3, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xcb, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xd4, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xe3, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xe9, 0xff, 0xff, 0x00, 0xec, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf3, 0xff, 0xff, 0x00, 0xf6, 0xff, 0xff, 0x00, 0xf9, 0xff, 0xff, 0x00, 0xfd, 0xff, 0xff, 0x00, 0xff, 0xfd, 0xff, 0x00, 0xff, 0xf9, 0xff, 0x00, 0xff, 0xf7, 0xff, 0x00, 0xff, 0xf3, 0xff, 0x00, 0xff, 0xf0, 0xff, 0x00, 0xff, 0xec, 0xff, 0x00, 0xff, 0xe9, 0xff, 0x00, 0xff, 0xe6, 0xff, 0x00, 0xff, 0xe2, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x00, 0xff, 0xdd, 0xff, 0x00, 0xff, 0xd9, 0xff, 0x00, 0xff, 0xd7, 0xff, 0x00, 0xff, 0xd4, 0xff, 0x00, 0xff, 0xd2, 0xff, 0x00, 0xff, 0xcf, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xcb, 0xff, 0x00, 0xff, 0xc8, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xba, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb4, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xb0, 0xff, 0x00, 0xfe, 0xaf, 0xff, 0x00, 0xff, 0xad, 0xff, 0x00, 0xff, 0xad, 0xff, 0x00, 0xff, 0xac, 0xff, 0x00, 0xff, 0xab, 0xff, 0x00, 0xff, 0xaa, 0xff, 0x00, 0xff, 0xa9, 0xff, 0x00, 0xff, 0xa9, 0xff, 0x00, 0xff, 0xa7, 0xff, 0x00, 0xff, 0xa6, 0xff, 0x00, 0xff, 0xa5, 0xff, 0x00, 0xff, 0xa5, 0xff, 0x00, 0xff, 0xa4, 0xff, 0x00, 0xff, 0xa4, 0xff, 0x00, 0xff, 0xa3, 0xff,
+    0x00, 0xa2, 0xff, 0xff, 0x00, 0xa2, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xff, 0x00, 0xa4, 0xff, 0xff, 0x00, 0xa4, 0xff, 0xff, 0x00, 0xa5, 0xff, 0xff, 0x00, 0xa6, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0xa8, 0xff, 0xff, 0x00, 0xa9, 0xff, 0xff, 0x00, 0xaa, 0xff, 0xff, 0x00, 0xab, 0xff, 0xff, 0x00, 0xac, 0xff, 0xff, 0x00, 0xad, 0xff, 0xff, 0x00, 0xae, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x01, 0xb5, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xcb, 0xff, 0xff, 0x00, 0xce, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0x00, 0xde, 0xff, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x00, 0xe5, 0xff, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x00, 0xeb, 0xff, 0xff, 0x00, 0xee, 0xff, 0xff, 0x01, 0xf2, 0xff, 0xff, 0x00, 0xf5, 0xff, 0xff, 0x00, 0xf9, 0xff, 0xff, 0x00, 0xfd, 0xff, 0xff, 0x00, 0xff, 0xfd, 0xff, 0x00, 0xff, 0xf9, 0xff, 0x00, 0xff, 0xf5, 0xff, 0x01, 0xff, 0xf2, 0xff, 0x00, 0xff, 0xee, 0xff, 0x00, 0xfe, 0xeb, 0xff, 0x00, 0xff, 0xe8, 0xff, 0x00, 0xff, 0xe5, 0xff, 0x00, 0xff, 0xe1, 0xff, 0x00, 0xff, 0xde, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xd0, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xcb, 0xff, 0x00, 0xff, 0xc8, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x01, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb3, 0xff, 0x00, 0xff, 0xb2, 0xff, 0x00, 0xff, 0xb2, 0xff, 0x00, 0xff, 0xb0, 0xff, 0x00, 0xff, 0xaf, 0xff, 0x00, 0xff, 0xae, 0xff, 0x00, 0xff, 0xad, 0xff, 0x00, 0xff, 0xac, 0xff, 0x00, 0xff, 0xab, 0xff, 0x00, 0xff, 0xaa, 0xff, 0x00, 0xff, 0xa9, 0xff, 0x00, 0xff, 0xa8, 0xff, 0x00, 0xff, 0xa7, 0xff, 0x00, 0xff, 0xa6, 0xff, 0x00, 0xff, 0xa5, 0xff, 0x00, 0xff, 0xa5, 0xff, 0x00, 0xff, 0xa4, 0xff, 0x00, 0xff, 0xa4, 0xff, 0x01, 0xff, 0xa2, 0xff, 0x00, 0xff, 0xa3, 0xff, 0x00, 0xff, 0xa2, 0xff,
+    0x00, 0xa0, 0xff, 0xff, 0x00, 0xa0, 0xff, 0xff, 0x00, 0xa1, 0xff, 0xff, 0x00, 0xa2, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xff, 0x00, 0xa5, 0xff, 0xff, 0x00, 0xa5, 0xff, 0xff, 0x00, 0xa6, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0xa8, 0xff, 0xff, 0x00, 0xa9, 0xff, 0xff, 0x00, 0xab, 0xff, 0xff, 0x00, 0xab, 0xff, 0xff, 0x00, 0xac, 0xff, 0xff, 0x00, 0xad, 0xff, 0xff, 0x00, 0xae, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xff, 0x00, 0xb1, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xb3, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xff, 0x01, 0xb6, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xcb, 0xff, 0xff, 0x00, 0xce, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xd4, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xe3, 0xff, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x00, 0xea, 0xff, 0xff, 0x00, 0xee, 0xff, 0xff, 0x00, 0xf2, 0xff, 0xff, 0x00, 0xf5, 0xff, 0xff, 0x00, 0xf9, 0xff, 0xff, 0x00, 0xfd, 0xff, 0xff, 0x00, 0xff, 0xfd, 0xff, 0x00, 0xff, 0xf9, 0xff, 0x00, 0xff, 0xf5, 0xff, 0x00, 0xff, 0xf2, 0xff, 0x00, 0xff, 0xee, 0xff, 0x00, 0xff, 0xeb, 0xff, 0x00, 0xff, 0xe7, 0xff, 0x00, 0xff, 0xe4, 0xff, 0x00, 0xff, 0xe0, 0xff, 0x00, 0xff, 0xdc, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x00, 0xff, 0xd7, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xd1, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb6, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb4, 0xff, 0x00, 0xff, 0xb2, 0xff, 0x00, 0xff, 0xb0, 0xff, 0x00, 0xff, 0xb0, 0xff, 0x00, 0xff, 0xae, 0xff, 0x00, 0xff, 0xae, 0xff, 0x00, 0xff, 0xac, 0xff, 0x00, 0xff, 0xab, 0xff, 0x01, 0xff, 0xaa, 0xff, 0x00, 0xff, 0xaa, 0xff, 0x00, 0xff, 0xa8, 0xff, 0x00, 0xff, 0xa8, 0xff, 0x00, 0xff, 0xa6, 0xff, 0x00, 0xff, 0xa6, 0xff, 0x00, 0xff, 0xa5, 0xff, 0x00, 0xff, 0xa4, 0xff, 0x00, 0xff, 0xa3, 0xff, 0x00, 0xff, 0xa3, 0xff, 0x00, 0xff, 0xa3, 0xff, 0x00, 0xff, 0xa2, 0xff, 0x00, 0xff, 0xa1, 0xff, 0x00, 0xff, 0xa0, 0xff,
+    0x00, 0x9f, 0xff, 0xff, 0x00, 0xa0, 0xfe, 0xff, 0x00, 0xa0, 0xff, 0xff, 0x00, 0xa0, 0xff, 0xff, 0x00, 0xa1, 0xff, 0xff, 0x00, 0xa2, 0xff, 0xff, 0x00, 0xa2, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xff, 0x00, 0xa4, 0xff, 0xff, 0x00, 0xa5, 0xff, 0xff, 0x00, 0xa6, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0xa8, 0xff, 0xff, 0x00, 0xa9, 0xff, 0xff, 0x00, 0xa9, 0xff, 0xff, 0x00, 0xab, 0xff, 0xff, 0x00, 0xab, 0xff, 0xff, 0x00, 0xac, 0xff, 0xff, 0x00, 0xae, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xb3, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xea, 0xff, 0xff, 0x00, 0xed, 0xff, 0xff, 0x00, 0xf1, 0xff, 0xff, 0x00, 0xf5, 0xff, 0xff, 0x00, 0xf9, 0xff, 0xff, 0x00, 0xfd, 0xff, 0xff, 0x00, 0xff, 0xfd, 0xff, 0x00, 0xff, 0xf9, 0xff, 0x00, 0xff, 0xf5, 0xff, 0x00, 0xff, 0xf1, 0xff, 0x00, 0xff, 0xed, 0xff, 0x00, 0xff, 0xea, 0xff, 0x00, 0xff, 0xe6, 0xff, 0x00, 0xff, 0xe2, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x00, 0xff, 0xdc, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xd1, 0xff, 0x00, 0xff, 0xcf, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb6, 0xff, 0x00, 0xff, 0xb4, 0xff, 0x00, 0xff, 0xb3, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xaf, 0xff, 0x00, 0xff, 0xae, 0xff, 0x00, 0xff, 0xad, 0xff, 0x00, 0xff, 0xab, 0xff, 0x00, 0xfe, 0xab, 0xff, 0x00, 0xff, 0xaa, 0xff, 0x00, 0xff, 0xa9, 0xff, 0x00, 0xff, 0xa8, 0xff, 0x00, 0xff, 0xa7, 0xff, 0x00, 0xff, 0xa6, 0xff, 0x00, 0xff, 0xa5, 0xff, 0x00, 0xff, 0xa4, 0xff, 0x00, 0xff, 0xa3, 0xff, 0x00, 0xff, 0xa3, 0xff, 0x00, 0xff, 0xa2, 0xff, 0x00, 0xff, 0xa2, 0xff, 0x00, 0xff, 0xa1, 0xff, 0x00, 0xff, 0xa0, 0xff, 0x00, 0xff, 0x9f, 0xff, 0x00, 0xff, 0x9f, 0xff,
+    0x00, 0x9d, 0xff, 0xff, 0x00, 0x9e, 0xff, 0xff, 0x00, 0x9e, 0xff, 0xff, 0x01, 0x9f, 0xff, 0xff, 0x00, 0xa0, 0xff, 0xff, 0x00, 0xa1, 0xff, 0xff, 0x00, 0xa1, 0xff, 0xff, 0x00, 0xa2, 0xff, 0xff, 0x00, 0xa2, 0xff, 0xff, 0x00, 0xa4, 0xff, 0xff, 0x00, 0xa5, 0xff, 0xff, 0x00, 0xa5, 0xff, 0xff, 0x00, 0xa6, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0xa8, 0xff, 0xff, 0x00, 0xaa, 0xff, 0xff, 0x00, 0xab, 0xff, 0xff, 0x00, 0xac, 0xff, 0xff, 0x00, 0xad, 0xff, 0xff, 0x00, 0xae, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xd9, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xe5, 0xff, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x00, 0xed, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf4, 0xff, 0xff, 0x00, 0xf9, 0xff, 0xff, 0x00, 0xfd, 0xff, 0xff, 0x00, 0xff, 0xfd, 0xff, 0x00, 0xff, 0xf8, 0xff, 0x00, 0xff, 0xf4, 0xff, 0x00, 0xff, 0xf1, 0xff, 0x00, 0xff, 0xed, 0xff, 0x00, 0xff, 0xe8, 0xff, 0x00, 0xff, 0xe4, 0xff, 0x00, 0xff, 0xe1, 0xff, 0x00, 0xff, 0xdd, 0xff, 0x00, 0xff, 0xd9, 0xff, 0x00, 0xff, 0xd7, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xd0, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xc8, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xfe, 0xc3, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb4, 0xff, 0x00, 0xff, 0xb2, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xb0, 0xff, 0x00, 0xff, 0xae, 0xff, 0x00, 0xff, 0xad, 0xff, 0x00, 0xff, 0xac, 0xff, 0x00, 0xff, 0xab, 0xff, 0x00, 0xff, 0xaa, 0xff, 0x00, 0xff, 0xa9, 0xff, 0x00, 0xff, 0xa8, 0xff, 0x00, 0xff, 0xa6, 0xff, 0x00, 0xff, 0xa5, 0xff, 0x00, 0xff, 0xa5, 0xff, 0x00, 0xff, 0xa4, 0xff, 0x00, 0xff, 0xa4, 0xff, 0x00, 0xff, 0xa3, 0xff, 0x00, 0xff, 0xa2, 0xff, 0x00, 0xff, 0xa1, 0xff, 0x00, 0xff, 0xa0, 0xff, 0x00, 0xff, 0xa0, 0xff, 0x00, 0xff, 0x9f, 0xff, 0x00, 0xff, 0x9f, 0xff, 0x00, 0xff, 0x9e, 0xff, 0x00, 0xff, 0x9d, 0xff,
+    0x00, 0x9c, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xff, 0x00, 0x9d, 0xff, 0xff, 0x00, 0x9e, 0xff, 0xff, 0x00, 0x9e, 0xff, 0xff, 0x00, 0x9f, 0xff, 0xff, 0x01, 0xa0, 0xff, 0xff, 0x00, 0xa0, 0xff, 0xff, 0x00, 0xa1, 0xff, 0xff, 0x00, 0xa1, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xff, 0x00, 0xa4, 0xff, 0xff, 0x00, 0xa5, 0xff, 0xff, 0x00, 0xa6, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0xa9, 0xff, 0xff, 0x00, 0xaa, 0xff, 0xff, 0x00, 0xab, 0xff, 0xff, 0x00, 0xac, 0xff, 0xff, 0x00, 0xae, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xcb, 0xff, 0xff, 0x00, 0xce, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xd4, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x00, 0xe3, 0xff, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x00, 0xeb, 0xff, 0xff, 0x00, 0xef, 0xff, 0xff, 0x00, 0xf4, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x00, 0xfd, 0xff, 0xff, 0x00, 0xff, 0xfd, 0xff, 0x00, 0xff, 0xf9, 0xff, 0x00, 0xff, 0xf4, 0xff, 0x00, 0xff, 0xf0, 0xff, 0x00, 0xff, 0xeb, 0xff, 0x00, 0xff, 0xe7, 0xff, 0x00, 0xff, 0xe3, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x00, 0xff, 0xd7, 0xff, 0x00, 0xff, 0xd4, 0xff, 0x00, 0xff, 0xd1, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xcb, 0xff, 0x00, 0xff, 0xc8, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb4, 0xff, 0x00, 0xff, 0xb4, 0xff, 0x01, 0xff, 0xb2, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xaf, 0xff, 0x00, 0xff, 0xad, 0xff, 0x00, 0xff, 0xac, 0xff, 0x00, 0xff, 0xab, 0xff, 0x00, 0xff, 0xaa, 0xff, 0x00, 0xff, 0xa9, 0xff, 0x00, 0xff, 0xa7, 0xff, 0x00, 0xff, 0xa6, 0xff, 0x00, 0xff, 0xa6, 0xff, 0x00, 0xff, 0xa5, 0xff, 0x00, 0xff, 0xa4, 0xff, 0x00, 0xff, 0xa3, 0xff, 0x00, 0xff, 0xa3, 0xff, 0x00, 0xff, 0xa1, 0xff, 0x00, 0xff, 0xa1, 0xff, 0x00, 0xff, 0xa0, 0xff, 0x00, 0xff, 0xa0, 0xff, 0x00, 0xff, 0x9f, 0xff, 0x00, 0xff, 0x9f, 0xff, 0x00, 0xff, 0x9e, 0xff, 0x00, 0xff, 0x9d, 0xff, 0x00, 0xff, 0x9d, 0xff, 0x00, 0xff, 0x9c, 0xff,
+    0x00, 0x9b, 0xff, 0xff, 0x00, 0x9b, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xff, 0x01, 0x9d, 0xff, 0xff, 0x00, 0x9d, 0xff, 0xff, 0x00, 0x9e, 0xff, 0xff, 0x00, 0x9f, 0xff, 0xff, 0x00, 0x9f, 0xff, 0xff, 0x00, 0xa0, 0xff, 0xff, 0x00, 0xa1, 0xff, 0xff, 0x00, 0xa1, 0xff, 0xff, 0x00, 0xa2, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xff, 0x00, 0xa4, 0xff, 0xff, 0x00, 0xa5, 0xff, 0xff, 0x00, 0xa6, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0xa8, 0xff, 0xff, 0x00, 0xa9, 0xff, 0xff, 0x00, 0xaa, 0xff, 0xff, 0x00, 0xac, 0xff, 0xff, 0x00, 0xac, 0xff, 0xff, 0x00, 0xae, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb1, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0xde, 0xff, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xea, 0xff, 0xff, 0x00, 0xee, 0xff, 0xff, 0x00, 0xf3, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x00, 0xfd, 0xff, 0xff, 0x00, 0xff, 0xfc, 0xff, 0x00, 0xff, 0xf8, 0xff, 0x00, 0xff, 0xf3, 0xff, 0x00, 0xff, 0xef, 0xff, 0x00, 0xff, 0xea, 0xff, 0x00, 0xff, 0xe5, 0xff, 0x00, 0xff, 0xe1, 0xff, 0x00, 0xff, 0xdd, 0xff, 0x00, 0xff, 0xda, 0xff, 0x00, 0xff, 0xd6, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xcf, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xba, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb6, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb3, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xb0, 0xff, 0x00, 0xff, 0xae, 0xff, 0x00, 0xff, 0xad, 0xff, 0x00, 0xff, 0xab, 0xff, 0x00, 0xff, 0xaa, 0xff, 0x00, 0xff, 0xa9, 0xff, 0x00, 0xff, 0xa8, 0xff, 0x00, 0xff, 0xa6, 0xff, 0x00, 0xff, 0xa6, 0xff, 0x00, 0xff, 0xa4, 0xff, 0x00, 0xff, 0xa4, 0xff, 0x00, 0xff, 0xa3, 0xff, 0x00, 0xff, 0xa2, 0xff, 0x00, 0xff, 0xa2, 0xff, 0x00, 0xff, 0xa1, 0xff, 0x00, 0xff, 0xa0, 0xff, 0x00, 0xff, 0x9f, 0xff, 0x00, 0xff, 0x9e, 0xff, 0x00, 0xff, 0x9e, 0xff, 0x00, 0xff, 0x9d, 0xff, 0x00, 0xff, 0x9d, 0xff, 0x00, 0xff, 0x9c, 0xff, 0x00, 0xff, 0x9b, 0xff, 0x00, 0xff, 0x9b, 0xff, 0x00, 0xff, 0x9a, 0xff,
+    0x00, 0x99, 0xff, 0xff, 0x00, 0x9a, 0xff, 0xff, 0x00, 0x9a, 0xff, 0xff, 0x00, 0x9b, 0xff, 0xff, 0x00, 0x9b, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xff, 0x00, 0x9d, 0xff, 0xff, 0x00, 0x9d, 0xff, 0xff, 0x00, 0x9e, 0xff, 0xff, 0x00, 0x9e, 0xff, 0xff, 0x00, 0x9f, 0xff, 0xff, 0x00, 0xa0, 0xff, 0xff, 0x00, 0xa1, 0xff, 0xff, 0x00, 0xa2, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xff, 0x00, 0xa4, 0xff, 0xff, 0x00, 0xa5, 0xff, 0xff, 0x00, 0xa6, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0xa8, 0xff, 0xff, 0x00, 0xaa, 0xff, 0xff, 0x00, 0xaa, 0xff, 0xff, 0x00, 0xac, 0xff, 0xff, 0x00, 0xad, 0xff, 0xff, 0x00, 0xae, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0x00, 0xd4, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xe4, 0xff, 0xff, 0x00, 0xe9, 0xff, 0xff, 0x00, 0xee, 0xff, 0xff, 0x00, 0xf2, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x00, 0xfd, 0xff, 0xff, 0x00, 0xff, 0xfc, 0xff, 0x00, 0xff, 0xf7, 0xff, 0x00, 0xff, 0xf3, 0xff, 0x00, 0xff, 0xee, 0xff, 0x00, 0xff, 0xe9, 0xff, 0x00, 0xff, 0xe5, 0xff, 0x00, 0xff, 0xe0, 0xff, 0x00, 0xff, 0xdc, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd4, 0xff, 0x00, 0xff, 0xd0, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xba, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb6, 0xff, 0x00, 0xff, 0xb4, 0xff, 0x00, 0xff, 0xb2, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xaf, 0xff, 0x00, 0xff, 0xae, 0xff, 0x00, 0xff, 0xac, 0xff, 0x00, 0xff, 0xab, 0xff, 0x00, 0xff, 0xa8, 0xff, 0x00, 0xff, 0xa8, 0xff, 0x00, 0xff, 0xa7, 0xff, 0x00, 0xff, 0xa6, 0xff, 0x00, 0xff, 0xa5, 0xff, 0x00, 0xff, 0xa4, 0xff, 0x00, 0xff, 0xa3, 0xff, 0x00, 0xff, 0xa2, 0xff, 0x00, 0xff, 0xa2, 0xff, 0x00, 0xff, 0xa1, 0xff, 0x00, 0xff, 0x9f, 0xff, 0x00, 0xff, 0x9e, 0xff, 0x00, 0xff, 0x9f, 0xff, 0x00, 0xff, 0x9e, 0xff, 0x00, 0xff, 0x9d, 0xff, 0x00, 0xff, 0x9c, 0xff, 0x00, 0xff, 0x9c, 0xff, 0x00, 0xff, 0x9b, 0xff, 0x00, 0xff, 0x9b, 0xff, 0x00, 0xff, 0x9a, 0xff, 0x00, 0xff, 0x9a, 0xff, 0x00, 0xff, 0x9a, 0xff,
+    0x00, 0x98, 0xff, 0xff, 0x00, 0x98, 0xff, 0xff, 0x00, 0x98, 0xff, 0xff, 0x00, 0x99, 0xff, 0xff, 0x00, 0x9a, 0xff, 0xff, 0x00, 0x9a, 0xff, 0xff, 0x00, 0x9a, 0xff, 0xff, 0x00, 0x9b, 0xff, 0xff, 0x00, 0x9d, 0xff, 0xff, 0x00, 0x9d, 0xff, 0xff, 0x00, 0x9d, 0xff, 0xff, 0x00, 0x9f, 0xff, 0xff, 0x00, 0x9e, 0xff, 0xff, 0x00, 0x9f, 0xff, 0xff, 0x00, 0xa1, 0xff, 0xff, 0x00, 0xa1, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xff, 0x00, 0xa4, 0xff, 0xff, 0x00, 0xa5, 0xff, 0xff, 0x00, 0xa6, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0xa8, 0xff, 0xff, 0x00, 0xaa, 0xff, 0xff, 0x00, 0xab, 0xff, 0xff, 0x00, 0xad, 0xff, 0xff, 0x00, 0xae, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xb3, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0xde, 0xff, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x00, 0xed, 0xff, 0xff, 0x00, 0xf2, 0xff, 0xff, 0x00, 0xf7, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xff, 0xfd, 0xff, 0x00, 0xff, 0xf7, 0xff, 0x00, 0xff, 0xf2, 0xff, 0x00, 0xff, 0xed, 0xff, 0x00, 0xff, 0xe7, 0xff, 0x00, 0xff, 0xe3, 0xff, 0x00, 0xff, 0xde, 0xff, 0x00, 0xff, 0xda, 0xff, 0x00, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xd2, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb3, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xb0, 0xff, 0x00, 0xff, 0xae, 0xff, 0x00, 0xff, 0xad, 0xff, 0x00, 0xff, 0xab, 0xff, 0x00, 0xff, 0xaa, 0xff, 0x00, 0xff, 0xa9, 0xff, 0x00, 0xff, 0xa8, 0xff, 0x00, 0xff, 0xa6, 0xff, 0x00, 0xff, 0xa5, 0xff, 0x00, 0xff, 0xa4, 0xff, 0x00, 0xff, 0xa3, 0xff, 0x00, 0xff, 0xa2, 0xff, 0x00, 0xff, 0xa1, 0xff, 0x00, 0xff, 0xa0, 0xff, 0x00, 0xff, 0x9f, 0xff, 0x00, 0xff, 0x9f, 0xff, 0x00, 0xff, 0x9e, 0xff, 0x00, 0xff, 0x9d, 0xff, 0x00, 0xff, 0x9d, 0xff, 0x00, 0xff, 0x9c, 0xff, 0x00, 0xff, 0x9b, 0xff, 0x00, 0xff, 0x9a, 0xff, 0x00, 0xff, 0x9a, 0xff, 0x00, 0xff, 0x9a, 0xff, 0x00, 0xff, 0x9a, 0xff, 0x00, 0xff, 0x98, 0xff, 0x00, 0xff, 0x98, 0xff, 0x00, 0xff, 0x97, 0xff,
+    0x00, 0x96, 0xff, 0xff, 0x00, 0x97, 0xff, 0xff, 0x00, 0x97, 0xff, 0xff, 0x00, 0x97, 0xff, 0xff, 0x00, 0x98, 0xff, 0xff, 0x00, 0x99, 0xff, 0xff, 0x00, 0x99, 0xff, 0xff, 0x00, 0x9a, 0xff, 0xff, 0x00, 0x9a, 0xff, 0xff, 0x00, 0x9b, 0xff, 0xff, 0x00, 0x9b, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xff, 0x00, 0x9d, 0xff, 0xff, 0x00, 0x9d, 0xff, 0xff, 0x00, 0x9e, 0xff, 0xff, 0x00, 0x9f, 0xff, 0xff, 0x00, 0xa0, 0xff, 0xff, 0x01, 0xa1, 0xff, 0xff, 0x00, 0xa2, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xff, 0x00, 0xa4, 0xff, 0xff, 0x00, 0xa5, 0xff, 0xff, 0x00, 0xa6, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0xa8, 0xff, 0xff, 0x00, 0xaa, 0xff, 0xff, 0x00, 0xac, 0xff, 0xff, 0x00, 0xad, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xff, 0x00, 0xb1, 0xff, 0xff, 0x00, 0xb3, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xcb, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x00, 0xd9, 0xff, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x00, 0xe1, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xeb, 0xff, 0xff, 0x00, 0xf1, 0xff, 0xff, 0x00, 0xf7, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xff, 0xfc, 0xff, 0x00, 0xff, 0xf6, 0xff, 0x00, 0xff, 0xf1, 0xff, 0x00, 0xff, 0xeb, 0xff, 0x00, 0xff, 0xe6, 0xff, 0x00, 0xff, 0xe1, 0xff, 0x00, 0xff, 0xdc, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xcf, 0xff, 0x00, 0xff, 0xcb, 0xff, 0x00, 0xff, 0xc8, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb4, 0xff, 0x00, 0xff, 0xb3, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xaf, 0xff, 0x00, 0xff, 0xad, 0xff, 0x00, 0xff, 0xac, 0xff, 0x00, 0xff, 0xaa, 0xff, 0x00, 0xff, 0xa8, 0xff, 0x00, 0xff, 0xa8, 0xff, 0x00, 0xff, 0xa6, 0xff, 0x00, 0xff, 0xa5, 0xff, 0x00, 0xff, 0xa4, 0xff, 0x00, 0xff, 0xa3, 0xff, 0x00, 0xff, 0xa1, 0xff, 0x00, 0xff, 0xa1, 0xff, 0x00, 0xff, 0xa0, 0xff, 0x00, 0xff, 0xa0, 0xff, 0x00, 0xff, 0x9e, 0xff, 0x00, 0xff, 0x9e, 0xff, 0x00, 0xff, 0x9d, 0xff, 0x00, 0xff, 0x9c, 0xff, 0x00, 0xff, 0x9b, 0xff, 0x00, 0xff, 0x9b, 0xff, 0x00, 0xff, 0x9a, 0xff, 0x00, 0xff, 0x99, 0xff, 0x00, 0xff, 0x99, 0xff, 0x00, 0xff, 0x99, 0xff, 0x00, 0xff, 0x98, 0xff, 0x00, 0xff, 0x97, 0xff, 0x00, 0xff, 0x97, 0xff, 0x00, 0xff, 0x97, 0xff, 0x01, 0xff, 0x96, 0xff,
+    0x00, 0x94, 0xff, 0xff, 0x00, 0x95, 0xff, 0xff, 0x00, 0x96, 0xff, 0xff, 0x00, 0x96, 0xff, 0xff, 0x00, 0x96, 0xff, 0xff, 0x00, 0x97, 0xff, 0xff, 0x00, 0x97, 0xff, 0xff, 0x00, 0x97, 0xff, 0xff, 0x00, 0x98, 0xff, 0xff, 0x00, 0x98, 0xff, 0xff, 0x00, 0x9a, 0xff, 0xff, 0x00, 0x9a, 0xff, 0xff, 0x00, 0x9a, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xff, 0x00, 0x9d, 0xff, 0xff, 0x00, 0x9d, 0xff, 0xff, 0x00, 0x9f, 0xff, 0xff, 0x00, 0x9f, 0xff, 0xff, 0x00, 0xa1, 0xff, 0xff, 0x00, 0xa1, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xff, 0x00, 0xa4, 0xff, 0xff, 0x00, 0xa5, 0xff, 0xff, 0x00, 0xa6, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0xa8, 0xff, 0xff, 0x00, 0xab, 0xff, 0xff, 0x00, 0xac, 0xff, 0xff, 0x00, 0xad, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb1, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xc1, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xc8, 0xff, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x00, 0xe4, 0xff, 0xff, 0x00, 0xe9, 0xff, 0xff, 0x00, 0xef, 0xff, 0xff, 0x00, 0xf5, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xff, 0xfc, 0xff, 0x00, 0xff, 0xf6, 0xff, 0x00, 0xff, 0xf0, 0xff, 0x00, 0xff, 0xe9, 0xff, 0x00, 0xff, 0xe5, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x00, 0xff, 0xd9, 0xff, 0x00, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xd0, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xc8, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb6, 0xff, 0x01, 0xff, 0xb4, 0xff, 0x00, 0xfe, 0xb2, 0xff, 0x00, 0xff, 0xb0, 0xff, 0x00, 0xff, 0xae, 0xff, 0x00, 0xff, 0xac, 0xff, 0x00, 0xff, 0xaa, 0xff, 0x00, 0xff, 0xa9, 0xff, 0x00, 0xff, 0xa8, 0xff, 0x00, 0xff, 0xa7, 0xff, 0x00, 0xff, 0xa5, 0xff, 0x00, 0xff, 0xa3, 0xff, 0x00, 0xff, 0xa2, 0xff, 0x00, 0xff, 0xa1, 0xff, 0x00, 0xff, 0xa0, 0xff, 0x00, 0xff, 0xa0, 0xff, 0x00, 0xff, 0x9e, 0xff, 0x00, 0xff, 0x9e, 0xff, 0x00, 0xff, 0x9d, 0xff, 0x00, 0xff, 0x9c, 0xff, 0x00, 0xff, 0x9b, 0xff, 0x00, 0xff, 0x9b, 0xff, 0x00, 0xff, 0x9a, 0xff, 0x00, 0xff, 0x99, 0xff, 0x00, 0xff, 0x99, 0xff, 0x00, 0xff, 0x98, 0xff, 0x00, 0xff, 0x97, 0xff, 0x00, 0xff, 0x98, 0xff, 0x00, 0xff, 0x97, 0xff, 0x00, 0xff, 0x96, 0xff, 0x00, 0xff, 0x96, 0xff, 0x00, 0xff, 0x96, 0xff, 0x00, 0xff, 0x95, 0xff, 0x00, 0xff, 0x95, 0xff,
+    0x00, 0x93, 0xff, 0xff, 0x00, 0x94, 0xff, 0xff, 0x00, 0x94, 0xff, 0xff, 0x00, 0x94, 0xff, 0xff, 0x00, 0x94, 0xff, 0xff, 0x00, 0x97, 0xff, 0xff, 0x00, 0x96, 0xff, 0xff, 0x00, 0x96, 0xff, 0xff, 0x00, 0x97, 0xff, 0xff, 0x00, 0x97, 0xff, 0xff, 0x00, 0x98, 0xff, 0xff, 0x00, 0x99, 0xff, 0xff, 0x00, 0x99, 0xff, 0xff, 0x00, 0x99, 0xff, 0xff, 0x00, 0x9a, 0xff, 0xff, 0x00, 0x9b, 0xff, 0xff, 0x00, 0x9b, 0xff, 0xff, 0x00, 0x9d, 0xff, 0xff, 0x00, 0x9d, 0xff, 0xff, 0x00, 0x9e, 0xff, 0xff, 0x00, 0x9f, 0xff, 0xff, 0x00, 0xa0, 0xff, 0xff, 0x00, 0xa1, 0xff, 0xff, 0x00, 0xa2, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xff, 0x00, 0xa5, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0xaa, 0xff, 0xff, 0x00, 0xab, 0xff, 0xff, 0x00, 0xad, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xff, 0x00, 0xb1, 0xff, 0xff, 0x00, 0xb3, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xce, 0xff, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x00, 0xd7, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x00, 0xef, 0xff, 0xff, 0x00, 0xf6, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xff, 0xfc, 0xff, 0x00, 0xff, 0xf5, 0xff, 0x00, 0xff, 0xee, 0xff, 0x00, 0xff, 0xe8, 0xff, 0x00, 0xff, 0xe2, 0xff, 0x00, 0xff, 0xdd, 0xff, 0x00, 0xff, 0xd8, 0xff, 0x00, 0xff, 0xd2, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xc1, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb3, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xaf, 0xff, 0x00, 0xff, 0xad, 0xff, 0x00, 0xff, 0xab, 0xff, 0x00, 0xff, 0xa9, 0xff, 0x00, 0xff, 0xa8, 0xff, 0x00, 0xff, 0xa7, 0xff, 0x00, 0xff, 0xa5, 0xff, 0x00, 0xff, 0xa3, 0xff, 0x00, 0xff, 0xa3, 0xff, 0x00, 0xff, 0xa1, 0xff, 0x00, 0xff, 0xa0, 0xff, 0x00, 0xff, 0xa0, 0xff, 0x00, 0xff, 0x9e, 0xff, 0x00, 0xff, 0x9e, 0xff, 0x00, 0xff, 0x9d, 0xff, 0x00, 0xff, 0x9c, 0xff, 0x00, 0xff, 0x9b, 0xff, 0x00, 0xff, 0x9a, 0xff, 0x00, 0xff, 0x9a, 0xff, 0x00, 0xff, 0x98, 0xff, 0x00, 0xff, 0x98, 0xff, 0x00, 0xff, 0x98, 0xff, 0x00, 0xff, 0x97, 0xff, 0x00, 0xff, 0x96, 0xff, 0x00, 0xff, 0x97, 0xff, 0x00, 0xff, 0x96, 0xff, 0x00, 0xff, 0x94, 0xff, 0x00, 0xff, 0x94, 0xff, 0x00, 0xff, 0x94, 0xff, 0x00, 0xff, 0x94, 0xff, 0x00, 0xff, 0x93, 0xff, 0x00, 0xff, 0x93, 0xff,
+    0x00, 0x92, 0xff, 0xff, 0x00, 0x92, 0xff, 0xff, 0x00, 0x93, 0xff, 0xff, 0x00, 0x93, 0xff, 0xff, 0x00, 0x93, 0xff, 0xff, 0x00, 0x93, 0xff, 0xff, 0x00, 0x94, 0xff, 0xff, 0x00, 0x95, 0xff, 0xff, 0x00, 0x95, 0xff, 0xff, 0x00, 0x95, 0xff, 0xff, 0x00, 0x96, 0xff, 0xff, 0x00, 0x96, 0xff, 0xff, 0x00, 0x97, 0xff, 0xff, 0x00, 0x97, 0xff, 0xff, 0x00, 0x98, 0xff, 0xff, 0x00, 0x98, 0xff, 0xff, 0x00, 0x9a, 0xff, 0xff, 0x00, 0x9b, 0xff, 0xff, 0x00, 0x9b, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xff, 0x00, 0x9d, 0xff, 0xff, 0x00, 0x9e, 0xff, 0xff, 0x00, 0x9f, 0xff, 0xff, 0x00, 0xa0, 0xff, 0xff, 0x00, 0xa1, 0xff, 0xff, 0x00, 0xa2, 0xff, 0xff, 0x00, 0xa4, 0xff, 0xff, 0x00, 0xa5, 0xff, 0xff, 0x00, 0xa6, 0xff, 0xff, 0x00, 0xa8, 0xff, 0xff, 0x00, 0xaa, 0xff, 0xff, 0x00, 0xac, 0xff, 0xff, 0x00, 0xae, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xff, 0x00, 0xb3, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xff, 0x00, 0xb8, 0xfe, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x00, 0xed, 0xff, 0xff, 0x00, 0xf4, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xff, 0xfb, 0xff, 0x00, 0xff, 0xf5, 0xff, 0x00, 0xff, 0xed, 0xff, 0x00, 0xff, 0xe7, 0xff, 0x00, 0xff, 0xe0, 0xff, 0x00, 0xff, 0xda, 0xff, 0x00, 0xff, 0xd4, 0xff, 0x00, 0xff, 0xcf, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb2, 0xff, 0x00, 0xff, 0xb0, 0xff, 0x00, 0xff, 0xae, 0xff, 0x00, 0xff, 0xac, 0xff, 0x00, 0xff, 0xa9, 0xff, 0x00, 0xff, 0xa8, 0xff, 0x00, 0xff, 0xa6, 0xff, 0x00, 0xff, 0xa5, 0xff, 0x00, 0xff, 0xa4, 0xff, 0x00, 0xff, 0xa3, 0xff, 0x00, 0xff, 0xa0, 0xff, 0x00, 0xff, 0xa0, 0xff, 0x00, 0xff, 0x9f, 0xff, 0x00, 0xff, 0x9d, 0xff, 0x00, 0xff, 0x9c, 0xff, 0x00, 0xff, 0x9c, 0xff, 0x00, 0xff, 0x9b, 0xff, 0x00, 0xff, 0x9a, 0xff, 0x00, 0xff, 0x99, 0xff, 0x00, 0xff, 0x99, 0xff, 0x00, 0xff, 0x99, 0xff, 0x00, 0xff, 0x97, 0xff, 0x00, 0xff, 0x96, 0xff, 0x00, 0xff, 0x97, 0xff, 0x00, 0xff, 0x95, 0xff, 0x00, 0xff, 0x96, 0xff, 0x00, 0xff, 0x95, 0xff, 0x00, 0xff, 0x94, 0xff, 0x00, 0xff, 0x94, 0xff, 0x00, 0xff, 0x93, 0xff, 0x00, 0xff, 0x93, 0xff, 0x00, 0xff, 0x93, 0xff, 0x00, 0xff, 0x92, 0xff, 0x00, 0xff, 0x92, 0xff, 0x00, 0xff, 0x91, 0xff,
+    0x00, 0x90, 0xff, 0xff, 0x00, 0x90, 0xff, 0xff, 0x00, 0x90, 0xff, 0xff, 0x00, 0x91, 0xff, 0xff, 0x00, 0x92, 0xff, 0xff, 0x00, 0x92, 0xff, 0xff, 0x00, 0x92, 0xff, 0xff, 0x00, 0x93, 0xff, 0xff, 0x00, 0x93, 0xff, 0xff, 0x00, 0x93, 0xff, 0xff, 0x00, 0x94, 0xff, 0xff, 0x00, 0x95, 0xff, 0xff, 0x00, 0x95, 0xff, 0xff, 0x00, 0x95, 0xff, 0xff, 0x00, 0x96, 0xff, 0xff, 0x00, 0x96, 0xff, 0xff, 0x00, 0x97, 0xff, 0xff, 0x00, 0x98, 0xff, 0xff, 0x00, 0x98, 0xff, 0xff, 0x00, 0x99, 0xff, 0xff, 0x00, 0x9a, 0xff, 0xff, 0x00, 0x9b, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xff, 0x00, 0x9d, 0xff, 0xff, 0x00, 0x9e, 0xff, 0xff, 0x00, 0x9f, 0xff, 0xff, 0x00, 0xa1, 0xff, 0xff, 0x00, 0xa2, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xff, 0x00, 0xa5, 0xff, 0xff, 0x00, 0xa6, 0xff, 0xff, 0x00, 0xa8, 0xff, 0xff, 0x00, 0xaa, 0xff, 0xff, 0x00, 0xac, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xff, 0x01, 0xb1, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xd7, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xe4, 0xff, 0xff, 0x00, 0xeb, 0xff, 0xff, 0x00, 0xf3, 0xff, 0xff, 0x00, 0xfb, 0xff, 0xff, 0x00, 0xff, 0xfb, 0xff, 0x00, 0xff, 0xf3, 0xff, 0x00, 0xff, 0xec, 0xff, 0x00, 0xff, 0xe4, 0xff, 0x00, 0xff, 0xde, 0xff, 0x00, 0xff, 0xd6, 0xff, 0x00, 0xff, 0xd0, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xba, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xaf, 0xff, 0x00, 0xff, 0xac, 0xff, 0x00, 0xff, 0xaa, 0xff, 0x00, 0xff, 0xa8, 0xff, 0x00, 0xff, 0xa6, 0xff, 0x00, 0xff, 0xa5, 0xff, 0x00, 0xff, 0xa4, 0xff, 0x00, 0xff, 0xa2, 0xff, 0x00, 0xff, 0xa0, 0xff, 0x00, 0xff, 0xa0, 0xff, 0x00, 0xff, 0x9e, 0xff, 0x00, 0xff, 0x9d, 0xff, 0x00, 0xff, 0x9d, 0xff, 0x00, 0xff, 0x9c, 0xff, 0x00, 0xff, 0x9b, 0xff, 0x00, 0xff, 0x9a, 0xff, 0x00, 0xff, 0x99, 0xff, 0x00, 0xff, 0x98, 0xff, 0x00, 0xff, 0x97, 0xff, 0x00, 0xff, 0x97, 0xff, 0x00, 0xff, 0x96, 0xff, 0x00, 0xff, 0x96, 0xff, 0x00, 0xff, 0x95, 0xff, 0x00, 0xff, 0x95, 0xff, 0x00, 0xff, 0x94, 0xff, 0x00, 0xff, 0x95, 0xff, 0x00, 0xff, 0x93, 0xff, 0x00, 0xff, 0x92, 0xff, 0x00, 0xff, 0x93, 0xff, 0x00, 0xff, 0x92, 0xff, 0x00, 0xff, 0x91, 0xff, 0x00, 0xff, 0x91, 0xff, 0x00, 0xff, 0x91, 0xff, 0x00, 0xff, 0x90, 0xff, 0x00, 0xff, 0x90, 0xff,
+    0x00, 0x8e, 0xff, 0xff, 0x00, 0x8f, 0xff, 0xff, 0x00, 0x8f, 0xff, 0xff, 0x00, 0x90, 0xff, 0xff, 0x00, 0x8f, 0xff, 0xff, 0x00, 0x90, 0xff, 0xff, 0x00, 0x90, 0xff, 0xff, 0x00, 0x91, 0xff, 0xff, 0x00, 0x91, 0xff, 0xff, 0x00, 0x92, 0xff, 0xff, 0x00, 0x92, 0xff, 0xff, 0x00, 0x92, 0xff, 0xff, 0x00, 0x93, 0xff, 0xff, 0x00, 0x94, 0xff, 0xff, 0x00, 0x95, 0xff, 0xff, 0x00, 0x95, 0xff, 0xff, 0x00, 0x96, 0xff, 0xff, 0x00, 0x95, 0xff, 0xff, 0x00, 0x97, 0xff, 0xff, 0x00, 0x97, 0xff, 0xff, 0x00, 0x98, 0xff, 0xff, 0x00, 0x99, 0xff, 0xff, 0x00, 0x9a, 0xff, 0xff, 0x00, 0x9a, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xff, 0x00, 0x9d, 0xff, 0xff, 0x00, 0x9d, 0xff, 0xff, 0x00, 0x9f, 0xff, 0xff, 0x00, 0xa0, 0xff, 0xff, 0x00, 0xa2, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xff, 0x01, 0xa5, 0xff, 0xff, 0x00, 0xa6, 0xff, 0xff, 0x00, 0xa9, 0xff, 0xff, 0x00, 0xaa, 0xff, 0xff, 0x00, 0xad, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb3, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xc2, 0xff, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0xe1, 0xff, 0xff, 0x00, 0xea, 0xff, 0xff, 0x00, 0xf2, 0xff, 0xff, 0x00, 0xfa, 0xff, 0xff, 0x01, 0xff, 0xfb, 0xff, 0x00, 0xff, 0xf2, 0xff, 0x00, 0xff, 0xe9, 0xff, 0x00, 0xff, 0xe1, 0xff, 0x00, 0xff, 0xd9, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xcd, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb3, 0xff, 0x00, 0xff, 0xb0, 0xff, 0x00, 0xff, 0xad, 0xff, 0x00, 0xff, 0xab, 0xff, 0x00, 0xff, 0xa9, 0xff, 0x00, 0xff, 0xa7, 0xff, 0x00, 0xff, 0xa5, 0xff, 0x00, 0xff, 0xa3, 0xff, 0x00, 0xff, 0xa2, 0xff, 0x00, 0xff, 0xa0, 0xff, 0x00, 0xff, 0x9f, 0xff, 0x00, 0xfe, 0x9d, 0xff, 0x00, 0xff, 0x9d, 0xff, 0x00, 0xff, 0x9b, 0xff, 0x00, 0xff, 0x9b, 0xff, 0x00, 0xff, 0x98, 0xff, 0x00, 0xff, 0x98, 0xff, 0x00, 0xff, 0x98, 0xff, 0x00, 0xff, 0x98, 0xff, 0x00, 0xff, 0x96, 0xff, 0x00, 0xff, 0x96, 0xff, 0x00, 0xff, 0x95, 0xff, 0x00, 0xff, 0x94, 0xff, 0x00, 0xff, 0x94, 0xff, 0x00, 0xff, 0x93, 0xff, 0x00, 0xff, 0x93, 0xff, 0x00, 0xff, 0x92, 0xff, 0x00, 0xff, 0x92, 0xff, 0x00, 0xff, 0x91, 0xff, 0x00, 0xff, 0x92, 0xff, 0x00, 0xff, 0x91, 0xff, 0x00, 0xff, 0x90, 0xff, 0x00, 0xff, 0x90, 0xff, 0x00, 0xff, 0x90, 0xff, 0x00, 0xff, 0x8f, 0xff, 0x00, 0xff, 0x8f, 0xff, 0x00, 0xff, 0x8e, 0xff, 0x00, 0xff, 0x8f, 0xff,
+    0x00, 0x8d, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xff, 0x00, 0x8e, 0xff, 0xff, 0x00, 0x8e, 0xff, 0xff, 0x00, 0x8e, 0xff, 0xff, 0x00, 0x8f, 0xff, 0xff, 0x00, 0x8f, 0xff, 0xff, 0x00, 0x8f, 0xff, 0xff, 0x00, 0x90, 0xff, 0xff, 0x00, 0x91, 0xff, 0xff, 0x00, 0x91, 0xff, 0xff, 0x00, 0x91, 0xff, 0xff, 0x00, 0x92, 0xff, 0xff, 0x00, 0x92, 0xff, 0xff, 0x00, 0x93, 0xff, 0xff, 0x00, 0x94, 0xff, 0xff, 0x00, 0x94, 0xff, 0xff, 0x00, 0x94, 0xff, 0xff, 0x00, 0x96, 0xff, 0xff, 0x00, 0x96, 0xff, 0xff, 0x00, 0x97, 0xff, 0xff, 0x00, 0x98, 0xff, 0xff, 0x00, 0x99, 0xff, 0xff, 0x00, 0x99, 0xff, 0xff, 0x00, 0x9a, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xff, 0x00, 0x9d, 0xff, 0xff, 0x00, 0x9f, 0xff, 0xff, 0x00, 0x9f, 0xff, 0xff, 0x00, 0xa1, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xff, 0x00, 0xa5, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0xa9, 0xff, 0xff, 0x00, 0xab, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x00, 0xde, 0xff, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xfa, 0xff, 0xff, 0x00, 0xff, 0xfb, 0xff, 0x00, 0xff, 0xf0, 0xff, 0x00, 0xff, 0xe7, 0xff, 0x00, 0xff, 0xde, 0xff, 0x00, 0xff, 0xd6, 0xff, 0x00, 0xff, 0xcf, 0xff, 0x00, 0xff, 0xc8, 0xff, 0x00, 0xff, 0xc3, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xb2, 0xff, 0x00, 0xff, 0xae, 0xff, 0x00, 0xff, 0xab, 0xff, 0x00, 0xfe, 0xa9, 0xff, 0x00, 0xff, 0xa7, 0xff, 0x00, 0xff, 0xa5, 0xff, 0x00, 0xff, 0xa3, 0xff, 0x00, 0xff, 0xa2, 0xff, 0x00, 0xff, 0x9f, 0xff, 0x00, 0xff, 0x9e, 0xff, 0x00, 0xff, 0x9c, 0xff, 0x00, 0xff, 0x9c, 0xff, 0x00, 0xff, 0x9b, 0xff, 0x00, 0xff, 0x99, 0xff, 0x00, 0xff, 0x99, 0xff, 0x00, 0xff, 0x98, 0xff, 0x00, 0xff, 0x97, 0xff, 0x00, 0xff, 0x96, 0xff, 0x00, 0xff, 0x96, 0xff, 0x00, 0xff, 0x95, 0xff, 0x00, 0xff, 0x94, 0xff, 0x00, 0xff, 0x94, 0xff, 0x00, 0xff, 0x93, 0xff, 0x00, 0xff, 0x92, 0xff, 0x00, 0xff, 0x92, 0xff, 0x00, 0xff, 0x91, 0xff, 0x00, 0xff, 0x91, 0xff, 0x00, 0xff, 0x90, 0xff, 0x00, 0xff, 0x90, 0xff, 0x00, 0xff, 0x90, 0xff, 0x00, 0xff, 0x8f, 0xff, 0x00, 0xff, 0x8f, 0xff, 0x00, 0xff, 0x8f, 0xff, 0x00, 0xff, 0x8e, 0xff, 0x00, 0xff, 0x8d, 0xff, 0x00, 0xff, 0x8e, 0xff, 0x00, 0xff, 0x8e, 0xff, 0x00, 0xff, 0x8d, 0xff, 0x01, 0xff, 0x8c, 0xff,
+    0x00, 0x8b, 0xff, 0xff, 0x00, 0x8b, 0xff, 0xff, 0x00, 0x8b, 0xfe, 0xff, 0x00, 0x8c, 0xff, 0xff, 0x00, 0x8c, 0xff, 0xff, 0x00, 0x8c, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xff, 0x00, 0x8e, 0xff, 0xff, 0x00, 0x8e, 0xff, 0xff, 0x00, 0x8e, 0xff, 0xff, 0x00, 0x8e, 0xff, 0xff, 0x00, 0x8f, 0xff, 0xff, 0x00, 0x8f, 0xff, 0xff, 0x00, 0x90, 0xff, 0xff, 0x00, 0x90, 0xff, 0xff, 0x00, 0x90, 0xff, 0xff, 0x00, 0x92, 0xff, 0xff, 0x00, 0x93, 0xff, 0xff, 0x00, 0x92, 0xff, 0xff, 0x00, 0x93, 0xff, 0xff, 0x00, 0x93, 0xff, 0xff, 0x00, 0x94, 0xff, 0xff, 0x00, 0x95, 0xff, 0xff, 0x00, 0x96, 0xff, 0xff, 0x00, 0x96, 0xff, 0xff, 0x00, 0x97, 0xff, 0xff, 0x00, 0x99, 0xff, 0xff, 0x00, 0x99, 0xff, 0xff, 0x00, 0x9b, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xff, 0x00, 0x9d, 0xff, 0xff, 0x00, 0x9e, 0xff, 0xff, 0x00, 0xa1, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xff, 0x00, 0xa5, 0xff, 0xff, 0x00, 0xa8, 0xff, 0xff, 0x00, 0xa9, 0xff, 0xff, 0x00, 0xac, 0xff, 0xff, 0x00, 0xb1, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0xe4, 0xff, 0xff, 0x00, 0xef, 0xff, 0xff, 0x00, 0xfa, 0xff, 0xff, 0x00, 0xff, 0xf9, 0xff, 0x00, 0xff, 0xef, 0xff, 0x00, 0xff, 0xe3, 0xff, 0x00, 0xff, 0xda, 0xff, 0x00, 0xff, 0xd2, 0xff, 0x00, 0xff, 0xca, 0xff, 0x00, 0xff, 0xc2, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xb8, 0xff, 0x00, 0xff, 0xb4, 0xff, 0x00, 0xff, 0xb0, 0xff, 0x00, 0xff, 0xad, 0xff, 0x00, 0xff, 0xa9, 0xff, 0x00, 0xff, 0xa7, 0xff, 0x00, 0xff, 0xa4, 0xff, 0x00, 0xff, 0xa2, 0xff, 0x00, 0xff, 0xa1, 0xff, 0x00, 0xff, 0xa0, 0xff, 0x00, 0xff, 0x9d, 0xff, 0x00, 0xff, 0x9c, 0xff, 0x00, 0xff, 0x9b, 0xff, 0x00, 0xff, 0x9a, 0xff, 0x00, 0xff, 0x99, 0xff, 0x00, 0xff, 0x98, 0xff, 0x00, 0xff, 0x97, 0xff, 0x00, 0xff, 0x96, 0xff, 0x00, 0xff, 0x95, 0xff, 0x00, 0xff, 0x94, 0xff, 0x00, 0xff, 0x93, 0xff, 0x00, 0xff, 0x93, 0xff, 0x00, 0xff, 0x92, 0xff, 0x00, 0xff, 0x92, 0xff, 0x00, 0xff, 0x91, 0xff, 0x00, 0xff, 0x91, 0xff, 0x01, 0xff, 0x90, 0xff, 0x00, 0xff, 0x8f, 0xff, 0x00, 0xff, 0x8f, 0xff, 0x00, 0xff, 0x8f, 0xff, 0x00, 0xff, 0x8e, 0xff, 0x00, 0xff, 0x8e, 0xff, 0x00, 0xff, 0x8d, 0xff, 0x00, 0xff, 0x8d, 0xff, 0x00, 0xff, 0x8d, 0xff, 0x00, 0xff, 0x8d, 0xff, 0x00, 0xff, 0x8c, 0xff, 0x00, 0xff, 0x8c, 0xff, 0x00, 0xff, 0x8c, 0xff, 0x00, 0xff, 0x8b, 0xff, 0x00, 0xff, 0x8b, 0xff, 0x00, 0xff, 0x8b, 0xff,
+    0x00, 0x89, 0xff, 0xff, 0x00, 0x8a, 0xff, 0xff, 0x00, 0x8a, 0xff, 0xff, 0x00, 0x8a, 0xff, 0xff, 0x00, 0x8b, 0xff, 0xff, 0x00, 0x8a, 0xff, 0xff, 0x00, 0x8b, 0xff, 0xff, 0x00, 0x8c, 0xff, 0xff, 0x00, 0x8c, 0xff, 0xff, 0x00, 0x8c, 0xff, 0xff, 0x00, 0x8c, 0xff, 0xff, 0x00, 0x8c, 0xff, 0xff, 0x00, 0x8c, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xff, 0x00, 0x8e, 0xff, 0xff, 0x00, 0x8e, 0xff, 0xff, 0x00, 0x8f, 0xff, 0xff, 0x00, 0x8f, 0xff, 0xff, 0x00, 0x8f, 0xff, 0xff, 0x00, 0x90, 0xff, 0xff, 0x00, 0x90, 0xff, 0xff, 0x00, 0x90, 0xff, 0xff, 0x00, 0x91, 0xff, 0xff, 0x00, 0x92, 0xff, 0xff, 0x00, 0x92, 0xff, 0xff, 0x00, 0x94, 0xff, 0xff, 0x00, 0x94, 0xff, 0xff, 0x00, 0x95, 0xff, 0xff, 0x00, 0x96, 0xff, 0xff, 0x00, 0x97, 0xff, 0xff, 0x00, 0x98, 0xff, 0xff, 0x00, 0x99, 0xff, 0xff, 0x00, 0x9b, 0xff, 0xff, 0x00, 0x9d, 0xff, 0xff, 0x00, 0x9f, 0xff, 0xff, 0x00, 0xa0, 0xff, 0xff, 0x00, 0xa2, 0xff, 0xff, 0x00, 0xa5, 0xff, 0xff, 0x00, 0xa7, 0xff, 0xff, 0x00, 0xab, 0xff, 0xff, 0x00, 0xae, 0xff, 0xff, 0x00, 0xb3, 0xff, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xc4, 0xff, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xeb, 0xff, 0xff, 0x00, 0xf9, 0xff, 0xff, 0x00, 0xff, 0xf8, 0xff, 0x00, 0xff, 0xeb, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x00, 0xff, 0xd5, 0xff, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xff, 0xc4, 0xff, 0x00, 0xff, 0xbd, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x00, 0xff, 0xb2, 0xff, 0x00, 0xff, 0xae, 0xff, 0x00, 0xff, 0xaa, 0xff, 0x00, 0xff, 0xa8, 0xff, 0x00, 0xff, 0xa4, 0xff, 0x00, 0xff, 0xa2, 0xff, 0x00, 0xff, 0xa0, 0xff, 0x00, 0xff, 0x9e, 0xff, 0x00, 0xff, 0x9d, 0xff, 0x00, 0xff, 0x9b, 0xff, 0x00, 0xff, 0x9a, 0xff, 0x00, 0xff, 0x99, 0xff, 0x00, 0xff, 0x97, 0xff, 0x00, 0xff, 0x96, 0xff, 0x00, 0xff, 0x95, 0xff, 0x00, 0xff, 0x94, 0xff, 0x00, 0xff, 0x94, 0xff, 0x00, 0xff, 0x93, 0xff, 0x00, 0xff, 0x92, 0xff, 0x00, 0xff, 0x91, 0xff, 0x00, 0xff, 0x91, 0xff, 0x00, 0xff, 0x90, 0xff, 0x00, 0xff, 0x90, 0xff, 0x00, 0xff, 0x8f, 0xff, 0x00, 0xff, 0x8f, 0xff, 0x00, 0xff, 0x8e, 0xff, 0x00, 0xff, 0x8e, 0xff, 0x00, 0xff, 0x8e, 0xff, 0x00, 0xff, 0x8d, 0xff, 0x00, 0xff, 0x8d, 0xff, 0x00, 0xff, 0x8c, 0xff, 0x00, 0xff, 0x8c, 0xff, 0x00, 0xff, 0x8b, 0xff, 0x00, 0xff, 0x8c, 0xff, 0x00, 0xff, 0x8b, 0xff, 0x00, 0xff, 0x8b, 0xff, 0x00, 0xff, 0x8b, 0xff, 0x00, 0xff, 0x8b, 0xff, 0x00, 0xff, 0x8a, 0xff, 0x00, 0xff, 0x8a, 0xff, 0x00, 0xff, 0x8a, 0xff, 0x00, 0xff, 0x8a, 0xff,
+    0x00, 0x88, 0xff, 0xff, 0x00, 0x88, 0xff, 0xff, 0x00, 0x88, 0xff, 0xff, 0x00, 0x88, 0xff, 0xff, 0x00, 0x89, 0xff, 0xff, 0x00, 0x89, 0xff, 0xff, 0x00, 0x89, 0xff, 0xff, 0x00, 0x89, 0xff, 0xff, 0x00, 0x89, 0xff, 0xff, 0x00, 0x89, 0xff, 0xff, 0x00, 0x8a, 0xff, 0xff, 0x00, 0x8a, 0xff, 0xff, 0x00, 0x8a, 0xff, 0xff, 0x00, 0x8b, 0xff, 0xff, 0x00, 0x8b, 0xff, 0xff, 0x00, 0x8c, 0xff, 0xff, 0x00, 0x8c, 0xff, 0xff, 0x00, 0x8c, 0xff, 0xff, 0x00, 0x8c, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xff, 0x00, 0x8e, 0xff, 0xff, 0x00, 0x8e, 0xff, 0xff, 0x00, 0x8f, 0xff, 0xff, 0x00, 0x8f, 0xff, 0xff, 0x00, 0x90, 0xff, 0xff, 0x00, 0x91, 0xff, 0xff, 0x00, 0x91, 0xff, 0xff, 0x00, 0x91, 0xff, 0xff, 0x00, 0x93, 0xff, 0xff, 0x00, 0x94, 0xff, 0xff, 0x00, 0x95, 0xff, 0xff, 0x00, 0x96, 0xff, 0xff, 0x00, 0x97, 0xff, 0xff, 0x00, 0x98, 0xff, 0xff, 0x00, 0x99, 0xff, 0xff, 0x00, 0x9b, 0xff, 0xff, 0x00, 0x9d, 0xff, 0xff, 0x00, 0x9f, 0xff, 0xff, 0x00, 0xa2, 0xff, 0xff, 0x00, 0xa5, 0xff, 0xff, 0x00, 0xa8, 0xff, 0xff, 0x00, 0xab, 0xff, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x00, 0xbd, 0xff, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x00, 0xf7, 0xff, 0xff, 0x00, 0xff, 0xf7, 0xff, 0x00, 0xff, 0xe8, 0xff, 0x00, 0xff, 0xda, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xc5, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xb6, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xad, 0xff, 0x00, 0xff, 0xa8, 0xff, 0x00, 0xff, 0xa5, 0xff, 0x00, 0xff, 0xa2, 0xff, 0x01, 0xff, 0x9f, 0xff, 0x00, 0xff, 0x9d, 0xff, 0x00, 0xff, 0x9b, 0xff, 0x00, 0xff, 0x9a, 0xff, 0x00, 0xff, 0x98, 0xff, 0x00, 0xff, 0x97, 0xff, 0x00, 0xff, 0x96, 0xff, 0x00, 0xff, 0x95, 0xff, 0x00, 0xff, 0x94, 0xff, 0x00, 0xff, 0x92, 0xff, 0x00, 0xff, 0x92, 0xff, 0x00, 0xff, 0x91, 0xff, 0x00, 0xff, 0x90, 0xff, 0x00, 0xff, 0x8f, 0xff, 0x00, 0xff, 0x8f, 0xff, 0x00, 0xff, 0x8f, 0xff, 0x00, 0xff, 0x8e, 0xff, 0x00, 0xff, 0x8d, 0xff, 0x00, 0xff, 0x8d, 0xff, 0x00, 0xff, 0x8d, 0xff, 0x00, 0xff, 0x8c, 0xff, 0x00, 0xff, 0x8b, 0xff, 0x00, 0xff, 0x8b, 0xff, 0x00, 0xff, 0x8b, 0xff, 0x00, 0xff, 0x8b, 0xff, 0x00, 0xff, 0x8b, 0xff, 0x00, 0xff, 0x8a, 0xff, 0x00, 0xff, 0x8a, 0xff, 0x00, 0xff, 0x8a, 0xff, 0x00, 0xff, 0x8a, 0xff, 0x00, 0xff, 0x89, 0xff, 0x00, 0xff, 0x89, 0xff, 0x00, 0xff, 0x89, 0xff, 0x00, 0xff, 0x88, 0xff, 0x00, 0xff, 0x89, 0xff, 0x00, 0xff, 0x88, 0xff, 0x00, 0xff, 0x88, 0xff, 0x00, 0xff, 0x88, 0xff,
+    0x00, 0x86, 0xff, 0xff, 0x00, 0x87, 0xff, 0xff, 0x00, 0x86, 0xff, 0xff, 0x00, 0x86, 0xff, 0xff, 0x00, 0x87, 0xff, 0xff, 0x00, 0x87, 0xff, 0xff, 0x00, 0x88, 0xff, 0xff, 0x00, 0x87, 0xff, 0xff, 0x00, 0x88, 0xff, 0xff, 0x00, 0x87, 0xff, 0xff, 0x00, 0x88, 0xff, 0xff, 0x00, 0x88, 0xff, 0xff, 0x00, 0x88, 0xff, 0xff, 0x00, 0x88, 0xff, 0xff, 0x00, 0x89, 0xff, 0xff, 0x00, 0x89, 0xff, 0xff, 0x00, 0x89, 0xff, 0xff, 0x00, 0x8a, 0xff, 0xff, 0x00, 0x8a, 0xff, 0xff, 0x00, 0x8a, 0xff, 0xff, 0x00, 0x8b, 0xff, 0xff, 0x00, 0x8b, 0xff, 0xff, 0x00, 0x8c, 0xff, 0xff, 0x00, 0x8c, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xff, 0x00, 0x8e, 0xff, 0xff, 0x00, 0x8f, 0xff, 0xff, 0x00, 0x8f, 0xff, 0xff, 0x00, 0x8f, 0xff, 0xff, 0x00, 0x91, 0xff, 0xff, 0x00, 0x92, 0xff, 0xff, 0x00, 0x93, 0xff, 0xff, 0x00, 0x93, 0xff, 0xff, 0x00, 0x95, 0xff, 0xff, 0x00, 0x96, 0xff, 0xff, 0x00, 0x98, 0xff, 0xff, 0x00, 0x99, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xff, 0x00, 0x9e, 0xff, 0xff, 0x00, 0xa1, 0xff, 0xff, 0x00, 0xa4, 0xff, 0xff, 0x00, 0xa9, 0xff, 0xff, 0x00, 0xad, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xff, 0x00, 0xbc, 0xff, 0xff, 0x00, 0xc6, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x00, 0xe3, 0xff, 0xff, 0x00, 0xf5, 0xff, 0xff, 0x00, 0xfe, 0xf6, 0xff, 0x00, 0xff, 0xe3, 0xff, 0x00, 0xff, 0xd3, 0xff, 0x00, 0xff, 0xc6, 0xff, 0x00, 0xff, 0xbc, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xae, 0xff, 0x00, 0xff, 0xa9, 0xff, 0x00, 0xff, 0xa4, 0xff, 0x00, 0xff, 0xa1, 0xff, 0x00, 0xff, 0x9e, 0xff, 0x00, 0xff, 0x9c, 0xff, 0x00, 0xff, 0x9a, 0xff, 0x00, 0xff, 0x98, 0xff, 0x00, 0xff, 0x96, 0xff, 0x00, 0xff, 0x95, 0xff, 0x00, 0xff, 0x93, 0xff, 0x00, 0xff, 0x93, 0xff, 0x00, 0xff, 0x92, 0xff, 0x00, 0xff, 0x91, 0xff, 0x00, 0xff, 0x90, 0xff, 0x00, 0xff, 0x8f, 0xff, 0x00, 0xff, 0x8e, 0xff, 0x00, 0xff, 0x8e, 0xff, 0x00, 0xff, 0x8d, 0xff, 0x00, 0xff, 0x8c, 0xff, 0x00, 0xff, 0x8d, 0xff, 0x00, 0xff, 0x8c, 0xff, 0x00, 0xff, 0x8b, 0xff, 0x00, 0xff, 0x8b, 0xff, 0x00, 0xff, 0x8a, 0xff, 0x00, 0xff, 0x8a, 0xff, 0x00, 0xff, 0x8a, 0xff, 0x00, 0xff, 0x89, 0xff, 0x00, 0xff, 0x89, 0xff, 0x00, 0xff, 0x89, 0xff, 0x00, 0xff, 0x89, 0xff, 0x00, 0xff, 0x88, 0xff, 0x00, 0xff, 0x88, 0xff, 0x00, 0xff, 0x88, 0xff, 0x00, 0xfe, 0x88, 0xff, 0x00, 0xff, 0x88, 0xff, 0x00, 0xff, 0x88, 0xff, 0x00, 0xff, 0x87, 0xff, 0x00, 0xff, 0x87, 0xff, 0x00, 0xff, 0x87, 0xff, 0x00, 0xff, 0x86, 0xff, 0x00, 0xff, 0x87, 0xff, 0x00, 0xff, 0x87, 0xff, 0x00, 0xff, 0x86, 0xff,
+    0x00, 0x85, 0xff, 0xff, 0x00, 0x85, 0xff, 0xff, 0x00, 0x85, 0xff, 0xff, 0x00, 0x85, 0xff, 0xff, 0x00, 0x85, 0xff, 0xff, 0x00, 0x85, 0xff, 0xff, 0x00, 0x85, 0xff, 0xff, 0x00, 0x85, 0xff, 0xff, 0x00, 0x85, 0xff, 0xff, 0x00, 0x85, 0xff, 0xff, 0x00, 0x86, 0xff, 0xff, 0x00, 0x87, 0xff, 0xff, 0x00, 0x86, 0xff, 0xff, 0x00, 0x86, 0xff, 0xff, 0x00, 0x87, 0xff, 0xff, 0x00, 0x87, 0xff, 0xff, 0x00, 0x87, 0xff, 0xff, 0x00, 0x87, 0xff, 0xff, 0x00, 0x88, 0xff, 0xff, 0x00, 0x88, 0xff, 0xff, 0x00, 0x88, 0xff, 0xff, 0x00, 0x88, 0xff, 0xff, 0x00, 0x89, 0xff, 0xff, 0x00, 0x89, 0xff, 0xff, 0x00, 0x89, 0xff, 0xff, 0x00, 0x8a, 0xff, 0xff, 0x00, 0x8b, 0xff, 0xff, 0x00, 0x8b, 0xff, 0xff, 0x00, 0x8c, 0xff, 0xff, 0x00, 0x8c, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xff, 0x00, 0x8e, 0xff, 0xff, 0x00, 0x8f, 0xff, 0xff, 0x00, 0x90, 0xff, 0xff, 0x00, 0x91, 0xff, 0xff, 0x00, 0x92, 0xff, 0xff, 0x00, 0x94, 0xff, 0xff, 0x00, 0x95, 0xff, 0xff, 0x00, 0x97, 0xff, 0xff, 0x00, 0x99, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xff, 0x00, 0xa0, 0xff, 0xff, 0x00, 0xa4, 0xff, 0xff, 0x00, 0xaa, 0xff, 0xff, 0x00, 0xb2, 0xff, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0x00, 0xf2, 0xff, 0xff, 0x00, 0xff, 0xf2, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x00, 0xff, 0xc9, 0xff, 0x00, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xb1, 0xff, 0x00, 0xff, 0xaa, 0xff, 0x00, 0xff, 0xa4, 0xff, 0x00, 0xff, 0xa0, 0xff, 0x00, 0xff, 0x9c, 0xff, 0x00, 0xff, 0x99, 0xff, 0x00, 0xff, 0x97, 0xff, 0x00, 0xff, 0x95, 0xff, 0x00, 0xff, 0x94, 0xff, 0x00, 0xff, 0x92, 0xff, 0x00, 0xff, 0x91, 0xff, 0x00, 0xff, 0x90, 0xff, 0x00, 0xff, 0x8f, 0xff, 0x00, 0xff, 0x8e, 0xff, 0x00, 0xff, 0x8d, 0xff, 0x00, 0xff, 0x8d, 0xff, 0x00, 0xff, 0x8c, 0xff, 0x00, 0xff, 0x8c, 0xff, 0x00, 0xff, 0x8b, 0xff, 0x00, 0xff, 0x8a, 0xff, 0x00, 0xff, 0x8a, 0xff, 0x00, 0xff, 0x8a, 0xff, 0x00, 0xff, 0x8a, 0xff, 0x00, 0xff, 0x89, 0xff, 0x00, 0xff, 0x88, 0xff, 0x00, 0xff, 0x88, 0xff, 0x00, 0xff, 0x87, 0xff, 0x00, 0xff, 0x87, 0xff, 0x00, 0xff, 0x87, 0xff, 0x00, 0xff, 0x87, 0xff, 0x00, 0xff, 0x87, 0xff, 0x00, 0xff, 0x86, 0xff, 0x00, 0xff, 0x87, 0xff, 0x00, 0xff, 0x87, 0xff, 0x00, 0xff, 0x86, 0xff, 0x00, 0xff, 0x86, 0xff, 0x00, 0xff, 0x85, 0xff, 0x00, 0xff, 0x86, 0xff, 0x00, 0xff, 0x86, 0xff, 0x00, 0xff, 0x85, 0xff, 0x00, 0xff, 0x85, 0xff, 0x00, 0xff, 0x85, 0xff, 0x00, 0xff, 0x85, 0xff, 0x00, 0xff, 0x85, 0xff, 0x00, 0xff, 0x85, 0xff, 0x01, 0xff, 0x85, 0xff,
+    0x00, 0x83, 0xff, 0xff, 0x00, 0x83, 0xff, 0xff, 0x00, 0x83, 0xff, 0xff, 0x00, 0x84, 0xff, 0xff, 0x00, 0x83, 0xff, 0xff, 0x00, 0x83, 0xff, 0xff, 0x00, 0x84, 0xff, 0xff, 0x00, 0x83, 0xff, 0xff, 0x00, 0x83, 0xff, 0xff, 0x00, 0x84, 0xff, 0xff, 0x00, 0x84, 0xff, 0xff, 0x00, 0x85, 0xff, 0xff, 0x00, 0x84, 0xff, 0xff, 0x00, 0x85, 0xff, 0xff, 0x00, 0x85, 0xff, 0xff, 0x00, 0x85, 0xff, 0xff, 0x00, 0x85, 0xff, 0xff, 0x00, 0x85, 0xff, 0xff, 0x00, 0x85, 0xff, 0xff, 0x00, 0x85, 0xff, 0xff, 0x00, 0x86, 0xff, 0xff, 0x00, 0x85, 0xff, 0xff, 0x00, 0x85, 0xff, 0xff, 0x00, 0x86, 0xff, 0xff, 0x00, 0x86, 0xff, 0xff, 0x00, 0x87, 0xff, 0xff, 0x00, 0x87, 0xff, 0xff, 0x00, 0x87, 0xff, 0xff, 0x00, 0x87, 0xff, 0xff, 0x00, 0x89, 0xff, 0xff, 0x00, 0x88, 0xff, 0xff, 0x00, 0x89, 0xff, 0xff, 0x00, 0x8a, 0xff, 0xff, 0x00, 0x8a, 0xff, 0xff, 0x00, 0x8a, 0xff, 0xff, 0x00, 0x8c, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xff, 0x00, 0x8e, 0xff, 0xff, 0x00, 0x8e, 0xff, 0xff, 0x00, 0x90, 0xff, 0xff, 0x00, 0x92, 0xff, 0xff, 0x00, 0x94, 0xff, 0xff, 0x00, 0x96, 0xff, 0xff, 0x00, 0x9a, 0xff, 0xff, 0x00, 0x9e, 0xff, 0xff, 0x00, 0xa4, 0xff, 0xff, 0x00, 0xac, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xce, 0xff, 0xff, 0x00, 0xec, 0xff, 0xff, 0x00, 0xff, 0xed, 0xff, 0x00, 0xff, 0xce, 0xff, 0x00, 0xff, 0xb9, 0xff, 0x00, 0xff, 0xad, 0xff, 0x01, 0xff, 0xa4, 0xff, 0x00, 0xff, 0x9e, 0xff, 0x00, 0xff, 0x98, 0xff, 0x00, 0xff, 0x97, 0xff, 0x00, 0xff, 0x94, 0xff, 0x00, 0xff, 0x92, 0xff, 0x00, 0xff, 0x90, 0xff, 0x00, 0xff, 0x8e, 0xff, 0x00, 0xff, 0x8e, 0xff, 0x00, 0xff, 0x8c, 0xff, 0x00, 0xff, 0x8c, 0xff, 0x00, 0xff, 0x8b, 0xff, 0x00, 0xff, 0x8a, 0xff, 0x00, 0xff, 0x89, 0xff, 0x00, 0xff, 0x89, 0xff, 0x00, 0xff, 0x89, 0xff, 0x00, 0xff, 0x88, 0xff, 0x00, 0xff, 0x88, 0xff, 0x00, 0xff, 0x87, 0xff, 0x00, 0xff, 0x87, 0xff, 0x00, 0xff, 0x87, 0xff, 0x00, 0xff, 0x87, 0xff, 0x00, 0xff, 0x86, 0xff, 0x00, 0xff, 0x86, 0xff, 0x00, 0xff, 0x86, 0xff, 0x00, 0xff, 0x86, 0xff, 0x00, 0xff, 0x86, 0xff, 0x00, 0xff, 0x85, 0xff, 0x00, 0xff, 0x85, 0xff, 0x00, 0xff, 0x85, 0xff, 0x00, 0xff, 0x85, 0xff, 0x00, 0xff, 0x84, 0xff, 0x00, 0xff, 0x84, 0xff, 0x00, 0xff, 0x84, 0xff, 0x00, 0xff, 0x84, 0xff, 0x00, 0xff, 0x83, 0xff, 0x00, 0xff, 0x84, 0xff, 0x00, 0xff, 0x83, 0xff, 0x00, 0xff, 0x84, 0xff, 0x00, 0xff, 0x83, 0xff, 0x00, 0xff, 0x84, 0xff, 0x00, 0xff, 0x83, 0xff, 0x00, 0xff, 0x84, 0xff, 0x00, 0xff, 0x83, 0xff, 0x00, 0xfe, 0x83, 0xff, 0x00, 0xff, 0x83, 0xff,
+    0x00, 0x82, 0xff, 0xff, 0x00, 0x81, 0xff, 0xff, 0x00, 0x81, 0xff, 0xff, 0x00, 0x82, 0xff, 0xff, 0x00, 0x82, 0xff, 0xff, 0x00, 0x82, 0xff, 0xff, 0x01, 0x81, 0xff, 0xff, 0x00, 0x82, 0xff, 0xff, 0x00, 0x82, 0xff, 0xff, 0x00, 0x82, 0xff, 0xff, 0x00, 0x81, 0xff, 0xff, 0x00, 0x81, 0xff, 0xff, 0x00, 0x83, 0xff, 0xff, 0x00, 0x82, 0xff, 0xff, 0x00, 0x82, 0xff, 0xff, 0x00, 0x82, 0xff, 0xff, 0x00, 0x82, 0xff, 0xff, 0x00, 0x82, 0xff, 0xff, 0x00, 0x82, 0xff, 0xff, 0x00, 0x83, 0xff, 0xff, 0x00, 0x82, 0xff, 0xff, 0x00, 0x83, 0xff, 0xff, 0x00, 0x83, 0xff, 0xff, 0x00, 0x83, 0xff, 0xff, 0x00, 0x83, 0xff, 0xff, 0x00, 0x84, 0xff, 0xff, 0x00, 0x84, 0xff, 0xff, 0x00, 0x83, 0xff, 0xff, 0x00, 0x83, 0xff, 0xff, 0x00, 0x84, 0xff, 0xff, 0x00, 0x85, 0xff, 0xff, 0x00, 0x84, 0xff, 0xff, 0x00, 0x85, 0xff, 0xff, 0x00, 0x86, 0xff, 0xff, 0x00, 0x85, 0xff, 0xff, 0x00, 0x86, 0xff, 0xff, 0x00, 0x86, 0xff, 0xff, 0x00, 0x86, 0xff, 0xff, 0x00, 0x88, 0xff, 0xff, 0x00, 0x88, 0xff, 0xff, 0x00, 0x89, 0xff, 0xff, 0x00, 0x8b, 0xff, 0xff, 0x00, 0x8c, 0xff, 0xff, 0x00, 0x8e, 0xff, 0xff, 0x00, 0x91, 0xff, 0xff, 0x00, 0x94, 0xff, 0xff, 0x00, 0x99, 0xff, 0xff, 0x00, 0xa3, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x00, 0xff, 0xde, 0xff, 0x00, 0xff, 0xb5, 0xff, 0x00, 0xff, 0xa3, 0xff, 0x01, 0xff, 0x9a, 0xff, 0x00, 0xff, 0x94, 0xff, 0x00, 0xff, 0x91, 0xff, 0x00, 0xff, 0x8e, 0xff, 0x00, 0xff, 0x8c, 0xff, 0x00, 0xff, 0x8a, 0xff, 0x00, 0xff, 0x8a, 0xff, 0x00, 0xff, 0x89, 0xff, 0x00, 0xff, 0x88, 0xff, 0x00, 0xff, 0x87, 0xff, 0x00, 0xff, 0x86, 0xff, 0x00, 0xff, 0x86, 0xff, 0x00, 0xff, 0x85, 0xff, 0x00, 0xff, 0x85, 0xff, 0x00, 0xff, 0x85, 0xff, 0x00, 0xff, 0x85, 0xff, 0x00, 0xff, 0x85, 0xff, 0x00, 0xff, 0x84, 0xff, 0x00, 0xff, 0x84, 0xff, 0x00, 0xff, 0x84, 0xff, 0x00, 0xff, 0x83, 0xff, 0x00, 0xfe, 0x83, 0xff, 0x00, 0xff, 0x83, 0xff, 0x00, 0xff, 0x83, 0xff, 0x00, 0xff, 0x83, 0xff, 0x00, 0xff, 0x83, 0xff, 0x00, 0xff, 0x83, 0xff, 0x00, 0xff, 0x83, 0xff, 0x00, 0xff, 0x82, 0xff, 0x00, 0xff, 0x82, 0xff, 0x00, 0xff, 0x82, 0xff, 0x00, 0xff, 0x82, 0xff, 0x00, 0xff, 0x82, 0xff, 0x00, 0xff, 0x82, 0xff, 0x00, 0xff, 0x82, 0xff, 0x00, 0xff, 0x82, 0xff, 0x00, 0xff, 0x81, 0xff, 0x00, 0xff, 0x82, 0xff, 0x00, 0xff, 0x82, 0xff, 0x00, 0xff, 0x82, 0xff, 0x00, 0xff, 0x82, 0xff, 0x00, 0xff, 0x81, 0xff, 0x00, 0xff, 0x81, 0xff, 0x00, 0xff, 0x82, 0xff, 0x00, 0xff, 0x81, 0xff, 0x00, 0xff, 0x82, 0xff, 0x00, 0xff, 0x82, 0xff,
+    0x00, 0x81, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x81, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x81, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x81, 0xff, 0xff, 0x00, 0x81, 0xff, 0xff, 0x00, 0x81, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x81, 0xff, 0xff, 0x00, 0x81, 0xff, 0xff, 0x00, 0x81, 0xfe, 0xff, 0x00, 0x81, 0xff, 0xff, 0x00, 0x81, 0xff, 0xff, 0x00, 0x81, 0xff, 0xff, 0x00, 0x82, 0xff, 0xff, 0x00, 0x82, 0xff, 0xff, 0x00, 0x82, 0xff, 0xff, 0x00, 0x83, 0xff, 0xff, 0x00, 0x85, 0xff, 0xff, 0x00, 0x88, 0xff, 0xff, 0x00, 0x99, 0xff, 0xff, 0x00, 0xff, 0x9b, 0xff, 0x00, 0xff, 0x88, 0xff, 0x00, 0xff, 0x85, 0xff, 0x00, 0xff, 0x84, 0xff, 0x00, 0xff, 0x82, 0xff, 0x00, 0xff, 0x82, 0xff, 0x00, 0xff, 0x81, 0xff, 0x00, 0xff, 0x81, 0xff, 0x00, 0xff, 0x81, 0xff, 0x00, 0xff, 0x81, 0xff, 0x00, 0xff, 0x81, 0xff, 0x00, 0xff, 0x81, 0xff, 0x00, 0xff, 0x81, 0xff, 0x00, 0xff, 0x81, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x81, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xfe, 0x80, 0xff, 0x00, 0xfe, 0x80, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x7f, 0xff, 0x00, 0xff, 0x7f, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x7f, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x7f, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x7f, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0x80, 0xff,
+    0x00, 0x7e, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x01, 0x7d, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x65, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x2c, 0xff, 0xff, 0x00, 0xff, 0x2c, 0xff, 0x00, 0xff, 0x56, 0xff, 0x00, 0xff, 0x65, 0xff, 0x00, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x71, 0xff, 0x00, 0xff, 0x73, 0xff, 0x00, 0xff, 0x75, 0xff, 0x00, 0xff, 0x76, 0xff, 0x00, 0xff, 0x77, 0xff, 0x00, 0xff, 0x78, 0xff, 0x01, 0xff, 0x79, 0xff, 0x00, 0xff, 0x79, 0xff, 0x00, 0xff, 0x7a, 0xff, 0x00, 0xff, 0x7a, 0xff, 0x00, 0xff, 0x7a, 0xff, 0x00, 0xff, 0x7b, 0xff, 0x00, 0xff, 0x7b, 0xff, 0x00, 0xff, 0x7b, 0xff, 0x00, 0xff, 0x7c, 0xff, 0x00, 0xff, 0x7c, 0xff, 0x00, 0xff, 0x7c, 0xff, 0x00, 0xff, 0x7d, 0xff, 0x00, 0xff, 0x7c, 0xff, 0x00, 0xff, 0x7c, 0xff, 0x00, 0xff, 0x7d, 0xff, 0x00, 0xff, 0x7d, 0xff, 0x00, 0xff, 0x7d, 0xff, 0x00, 0xff, 0x7d, 0xff, 0x00, 0xff, 0x7d, 0xff, 0x00, 0xff, 0x7d, 0xff, 0x00, 0xff, 0x7e, 0xff, 0x00, 0xff, 0x7d, 0xff, 0x00, 0xff, 0x7d, 0xff, 0x00, 0xff, 0x7e, 0xff, 0x00, 0xff, 0x7d, 0xff, 0x00, 0xff, 0x7e, 0xff, 0x00, 0xff, 0x7e, 0xff, 0x00, 0xff, 0x7e, 0xff, 0x00, 0xff, 0x7e, 0xff, 0x00, 0xff, 0x7d, 0xff, 0x00, 0xff, 0x7e, 0xff, 0x00, 0xff, 0x7e, 0xff, 0x00, 0xff, 0x7e, 0xff, 0x00, 0xff, 0x7f, 0xff, 0x00, 0xff, 0x7e, 0xff, 0x00, 0xff, 0x7e, 0xff, 0x00, 0xff, 0x7f, 0xff, 0x00, 0xff, 0x7e, 0xff, 0x00, 0xff, 0x7e, 0xff, 0x00, 0xff, 0x7e, 0xff,
+    0x00, 0x7c, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x65, 0xff, 0xff, 0x00, 0x60, 0xff, 0xff, 0x00, 0x59, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x37, 0xff, 0xff, 0x00, 0x16, 0xff, 0xff, 0x00, 0xff, 0x16, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xff, 0x4c, 0xff, 0x00, 0xff, 0x59, 0xff, 0x00, 0xff, 0x5f, 0xff, 0x00, 0xff, 0x66, 0xff, 0x00, 0xff, 0x69, 0xff, 0x00, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x6e, 0xff, 0x00, 0xff, 0x70, 0xff, 0x00, 0xff, 0x71, 0xff, 0x00, 0xff, 0x73, 0xff, 0x00, 0xff, 0x74, 0xff, 0x00, 0xff, 0x75, 0xff, 0x00, 0xff, 0x75, 0xff, 0x00, 0xff, 0x76, 0xff, 0x00, 0xff, 0x76, 0xff, 0x00, 0xff, 0x77, 0xff, 0x00, 0xff, 0x78, 0xff, 0x00, 0xff, 0x78, 0xff, 0x00, 0xff, 0x79, 0xff, 0x00, 0xff, 0x79, 0xff, 0x00, 0xff, 0x79, 0xff, 0x00, 0xfe, 0x79, 0xff, 0x00, 0xff, 0x79, 0xff, 0x00, 0xff, 0x79, 0xff, 0x00, 0xff, 0x79, 0xff, 0x00, 0xff, 0x7a, 0xff, 0x00, 0xff, 0x7a, 0xff, 0x00, 0xff, 0x7b, 0xff, 0x00, 0xff, 0x7b, 0xff, 0x00, 0xff, 0x7b, 0xff, 0x00, 0xff, 0x7b, 0xff, 0x00, 0xff, 0x7b, 0xff, 0x00, 0xfe, 0x7c, 0xff, 0x00, 0xff, 0x7b, 0xff, 0x00, 0xff, 0x7b, 0xff, 0x00, 0xff, 0x7c, 0xff, 0x00, 0xff, 0x7b, 0xff, 0x00, 0xff, 0x7c, 0xff, 0x00, 0xff, 0x7b, 0xff, 0x00, 0xff, 0x7c, 0xff, 0x00, 0xff, 0x7b, 0xff, 0x00, 0xff, 0x7c, 0xff, 0x00, 0xff, 0x7c, 0xff, 0x00, 0xff, 0x7c, 0xff, 0x00, 0xff, 0x7c, 0xff, 0x00, 0xff, 0x7d, 0xff, 0x00, 0xff, 0x7c, 0xff, 0x00, 0xff, 0x7d, 0xff,
+    0x00, 0x7a, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x01, 0x7a, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x65, 0xfe, 0xff, 0x00, 0x62, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xff, 0x01, 0x58, 0xff, 0xff, 0x00, 0x52, 0xff, 0xff, 0x00, 0x48, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x27, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0x00, 0xff, 0x0e, 0xff, 0x00, 0xff, 0x27, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x52, 0xff, 0x00, 0xff, 0x58, 0xff, 0x00, 0xff, 0x5f, 0xff, 0x00, 0xff, 0x62, 0xff, 0x00, 0xff, 0x66, 0xff, 0x00, 0xff, 0x67, 0xff, 0x00, 0xff, 0x6a, 0xff, 0x00, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x6d, 0xff, 0x00, 0xff, 0x6f, 0xff, 0x00, 0xff, 0x70, 0xff, 0x00, 0xff, 0x71, 0xff, 0x00, 0xff, 0x71, 0xff, 0x00, 0xff, 0x73, 0xff, 0x00, 0xff, 0x73, 0xff, 0x00, 0xff, 0x74, 0xff, 0x00, 0xff, 0x75, 0xff, 0x00, 0xff, 0x75, 0xff, 0x00, 0xff, 0x75, 0xff, 0x00, 0xff, 0x76, 0xff, 0x00, 0xff, 0x77, 0xff, 0x00, 0xff, 0x76, 0xff, 0x00, 0xff, 0x77, 0xff, 0x00, 0xff, 0x77, 0xff, 0x00, 0xff, 0x77, 0xff, 0x00, 0xff, 0x77, 0xff, 0x00, 0xff, 0x78, 0xff, 0x00, 0xff, 0x78, 0xff, 0x00, 0xff, 0x79, 0xff, 0x00, 0xff, 0x79, 0xff, 0x00, 0xff, 0x79, 0xff, 0x00, 0xff, 0x79, 0xff, 0x00, 0xff, 0x79, 0xff, 0x00, 0xff, 0x79, 0xff, 0x00, 0xff, 0x79, 0xff, 0x00, 0xff, 0x79, 0xff, 0x00, 0xff, 0x7a, 0xff, 0x00, 0xff, 0x7a, 0xff, 0x00, 0xff, 0x7a, 0xff, 0x00, 0xff, 0x7a, 0xff, 0x00, 0xff, 0x7a, 0xff, 0x00, 0xff, 0x7a, 0xff, 0x00, 0xff, 0x7a, 0xff, 0x00, 0xff, 0x7b, 0xff, 0x00, 0xff, 0x7b, 0xff, 0x00, 0xff, 0x7b, 0xff,
+    0x00, 0x79, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x66, 0xff, 0xff, 0x00, 0x63, 0xff, 0xff, 0x00, 0x60, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xff, 0x00, 0x59, 0xff, 0xff, 0x00, 0x54, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x0a, 0xff, 0xff, 0x00, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x2f, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x4e, 0xff, 0x00, 0xff, 0x54, 0xff, 0x00, 0xff, 0x59, 0xff, 0x00, 0xff, 0x5d, 0xff, 0x00, 0xff, 0x60, 0xff, 0x00, 0xff, 0x63, 0xff, 0x00, 0xff, 0x65, 0xff, 0x00, 0xff, 0x68, 0xff, 0x00, 0xff, 0x69, 0xff, 0x00, 0xff, 0x6b, 0xff, 0x00, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x6d, 0xff, 0x00, 0xff, 0x6e, 0xff, 0x00, 0xff, 0x6f, 0xff, 0x00, 0xff, 0x70, 0xff, 0x00, 0xff, 0x70, 0xff, 0x00, 0xff, 0x71, 0xff, 0x00, 0xff, 0x71, 0xff, 0x00, 0xff, 0x73, 0xff, 0x00, 0xff, 0x73, 0xff, 0x00, 0xff, 0x73, 0xff, 0x00, 0xff, 0x74, 0xff, 0x00, 0xff, 0x74, 0xff, 0x00, 0xff, 0x75, 0xff, 0x00, 0xff, 0x75, 0xff, 0x00, 0xff, 0x75, 0xff, 0x00, 0xff, 0x76, 0xff, 0x00, 0xff, 0x76, 0xff, 0x00, 0xff, 0x76, 0xff, 0x00, 0xff, 0x76, 0xff, 0x00, 0xff, 0x77, 0xff, 0x00, 0xff, 0x77, 0xff, 0x00, 0xff, 0x78, 0xff, 0x00, 0xff, 0x77, 0xff, 0x00, 0xff, 0x78, 0xff, 0x00, 0xff, 0x78, 0xff, 0x00, 0xff, 0x78, 0xff, 0x00, 0xff, 0x78, 0xff, 0x00, 0xfe, 0x79, 0xff, 0x00, 0xff, 0x78, 0xff, 0x00, 0xff, 0x79, 0xff, 0x00, 0xff, 0x79, 0xff, 0x00, 0xff, 0x79, 0xff, 0x00, 0xff, 0x79, 0xff, 0x00, 0xff, 0x79, 0xff,
+    0x00, 0x78, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6d, 0xfe, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x66, 0xff, 0xff, 0x00, 0x64, 0xff, 0xff, 0x00, 0x62, 0xff, 0xff, 0x00, 0x5f, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xff, 0x00, 0x55, 0xff, 0xff, 0x00, 0x51, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x33, 0xff, 0xff, 0x00, 0x27, 0xff, 0xff, 0x00, 0x18, 0xff, 0xff, 0x00, 0x08, 0xff, 0xff, 0x00, 0xff, 0x08, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x27, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x00, 0xff, 0x51, 0xff, 0x00, 0xff, 0x56, 0xff, 0x00, 0xff, 0x59, 0xff, 0x00, 0xff, 0x5c, 0xff, 0x00, 0xff, 0x5f, 0xff, 0x00, 0xff, 0x62, 0xff, 0x00, 0xff, 0x64, 0xff, 0x00, 0xff, 0x65, 0xff, 0x00, 0xff, 0x67, 0xff, 0x00, 0xff, 0x68, 0xff, 0x00, 0xff, 0x6a, 0xff, 0x00, 0xff, 0x6b, 0xff, 0x00, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x6d, 0xff, 0x00, 0xff, 0x6e, 0xff, 0x00, 0xff, 0x6f, 0xff, 0x00, 0xff, 0x70, 0xff, 0x00, 0xff, 0x70, 0xff, 0x00, 0xff, 0x71, 0xff, 0x00, 0xff, 0x72, 0xff, 0x00, 0xff, 0x72, 0xff, 0x00, 0xff, 0x72, 0xff, 0x00, 0xff, 0x73, 0xff, 0x01, 0xff, 0x73, 0xff, 0x00, 0xff, 0x74, 0xff, 0x00, 0xff, 0x74, 0xff, 0x00, 0xff, 0x74, 0xff, 0x00, 0xff, 0x74, 0xff, 0x00, 0xff, 0x74, 0xff, 0x00, 0xff, 0x75, 0xff, 0x00, 0xff, 0x75, 0xff, 0x00, 0xff, 0x75, 0xff, 0x00, 0xff, 0x76, 0xff, 0x00, 0xff, 0x76, 0xff, 0x00, 0xff, 0x76, 0xff, 0x00, 0xff, 0x77, 0xff, 0x00, 0xff, 0x77, 0xff, 0x00, 0xff, 0x77, 0xff, 0x00, 0xff, 0x77, 0xff, 0x00, 0xff, 0x77, 0xff, 0x00, 0xff, 0x77, 0xff, 0x00, 0xff, 0x77, 0xff,
+    0x00, 0x76, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x6f, 0xfe, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x65, 0xff, 0xff, 0x00, 0x64, 0xff, 0xff, 0x00, 0x62, 0xff, 0xff, 0x00, 0x60, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xff, 0x00, 0x57, 0xff, 0xff, 0x00, 0x53, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xff, 0x00, 0x4a, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x2c, 0xff, 0xff, 0x00, 0x21, 0xff, 0xff, 0x00, 0x15, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x00, 0xff, 0x06, 0xff, 0x00, 0xff, 0x14, 0xff, 0x00, 0xff, 0x21, 0xff, 0x00, 0xff, 0x2c, 0xff, 0x00, 0xff, 0x35, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x4a, 0xff, 0x00, 0xff, 0x4e, 0xff, 0x00, 0xff, 0x53, 0xff, 0x00, 0xff, 0x56, 0xff, 0x00, 0xff, 0x59, 0xff, 0x00, 0xff, 0x5c, 0xff, 0x00, 0xff, 0x5e, 0xff, 0x00, 0xff, 0x60, 0xff, 0x00, 0xff, 0x62, 0xff, 0x00, 0xff, 0x64, 0xff, 0x00, 0xff, 0x65, 0xff, 0x00, 0xff, 0x67, 0xff, 0x00, 0xff, 0x68, 0xff, 0x00, 0xff, 0x69, 0xff, 0x00, 0xff, 0x6a, 0xff, 0x00, 0xff, 0x6b, 0xff, 0x00, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x6d, 0xff, 0x00, 0xff, 0x6e, 0xff, 0x00, 0xff, 0x6e, 0xff, 0x00, 0xff, 0x6f, 0xff, 0x00, 0xff, 0x6f, 0xff, 0x00, 0xff, 0x70, 0xff, 0x00, 0xff, 0x71, 0xff, 0x00, 0xff, 0x71, 0xff, 0x00, 0xff, 0x72, 0xff, 0x00, 0xff, 0x72, 0xff, 0x00, 0xff, 0x73, 0xff, 0x00, 0xff, 0x73, 0xff, 0x00, 0xff, 0x73, 0xff, 0x00, 0xff, 0x73, 0xff, 0x00, 0xff, 0x74, 0xff, 0x00, 0xff, 0x74, 0xff, 0x00, 0xff, 0x75, 0xff, 0x00, 0xff, 0x74, 0xff, 0x00, 0xff, 0x75, 0xff, 0x00, 0xff, 0x75, 0xff, 0x00, 0xff, 0x75, 0xff, 0x00, 0xff, 0x75, 0xff, 0x00, 0xff, 0x75, 0xff, 0x00, 0xff, 0x76, 0xff, 0x00, 0xff, 0x76, 0xff,
+    0x00, 0x75, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x72, 0xfe, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x01, 0x70, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x66, 0xff, 0xff, 0x00, 0x66, 0xff, 0xff, 0x00, 0x64, 0xff, 0xff, 0x00, 0x63, 0xff, 0xff, 0x00, 0x62, 0xff, 0xff, 0x00, 0x5f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xff, 0x00, 0x57, 0xff, 0xff, 0x00, 0x54, 0xff, 0xff, 0x00, 0x51, 0xff, 0xff, 0x00, 0x4c, 0xfe, 0xff, 0x00, 0x48, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x37, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xff, 0x00, 0x27, 0xff, 0xff, 0x00, 0x1c, 0xff, 0xff, 0x00, 0x12, 0xff, 0xff, 0x00, 0x06, 0xff, 0xff, 0x00, 0xff, 0x06, 0xff, 0x00, 0xff, 0x12, 0xff, 0x00, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x26, 0xff, 0x00, 0xff, 0x2f, 0xff, 0x00, 0xff, 0x37, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x49, 0xff, 0x00, 0xff, 0x4d, 0xff, 0x00, 0xff, 0x51, 0xff, 0x00, 0xff, 0x54, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x5a, 0xff, 0x00, 0xff, 0x5d, 0xff, 0x00, 0xff, 0x5e, 0xff, 0x00, 0xff, 0x60, 0xff, 0x00, 0xff, 0x61, 0xff, 0x00, 0xff, 0x63, 0xff, 0x00, 0xff, 0x65, 0xff, 0x00, 0xff, 0x65, 0xff, 0x00, 0xff, 0x66, 0xff, 0x00, 0xff, 0x68, 0xff, 0x00, 0xff, 0x68, 0xff, 0x00, 0xff, 0x69, 0xff, 0x00, 0xff, 0x6a, 0xff, 0x00, 0xff, 0x6b, 0xff, 0x00, 0xff, 0x6b, 0xff, 0x00, 0xff, 0x6c, 0xff, 0x01, 0xff, 0x6d, 0xff, 0x00, 0xff, 0x6e, 0xff, 0x00, 0xfe, 0x6e, 0xff, 0x00, 0xff, 0x6f, 0xff, 0x00, 0xff, 0x6f, 0xff, 0x00, 0xff, 0x70, 0xff, 0x00, 0xff, 0x70, 0xff, 0x00, 0xff, 0x70, 0xff, 0x00, 0xff, 0x71, 0xff, 0x00, 0xff, 0x71, 0xff, 0x00, 0xff, 0x72, 0xff, 0x00, 0xff, 0x72, 0xff, 0x00, 0xff, 0x72, 0xff, 0x00, 0xff, 0x72, 0xff, 0x00, 0xff, 0x73, 0xff, 0x00, 0xff, 0x73, 0xff, 0x00, 0xff, 0x73, 0xff, 0x00, 0xff, 0x73, 0xff, 0x00, 0xff, 0x74, 0xff, 0x00, 0xff, 0x74, 0xff, 0x00, 0xff, 0x74, 0xff,
+    0x00, 0x72, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x01, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x65, 0xff, 0xff, 0x00, 0x64, 0xff, 0xff, 0x00, 0x63, 0xff, 0xff, 0x00, 0x62, 0xff, 0xff, 0x00, 0x61, 0xff, 0xff, 0x00, 0x5f, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xff, 0x00, 0x57, 0xff, 0xff, 0x00, 0x55, 0xff, 0xff, 0x00, 0x52, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x48, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x32, 0xff, 0xff, 0x00, 0x2a, 0xff, 0xff, 0x00, 0x22, 0xff, 0xff, 0x00, 0x19, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0xff, 0x05, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x19, 0xff, 0x00, 0xff, 0x22, 0xff, 0x00, 0xff, 0x2b, 0xff, 0x00, 0xff, 0x31, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x00, 0xff, 0x4f, 0xff, 0x00, 0xff, 0x52, 0xff, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x5a, 0xff, 0x00, 0xff, 0x5b, 0xff, 0x00, 0xff, 0x5e, 0xff, 0x00, 0xff, 0x5f, 0xff, 0x00, 0xff, 0x60, 0xff, 0x00, 0xff, 0x62, 0xff, 0x00, 0xff, 0x63, 0xff, 0x00, 0xff, 0x64, 0xff, 0x00, 0xff, 0x65, 0xff, 0x00, 0xff, 0x67, 0xff, 0x00, 0xff, 0x67, 0xff, 0x00, 0xff, 0x68, 0xff, 0x00, 0xff, 0x69, 0xff, 0x00, 0xff, 0x6a, 0xff, 0x00, 0xff, 0x6a, 0xff, 0x00, 0xff, 0x6b, 0xff, 0x00, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x6d, 0xff, 0x00, 0xff, 0x6e, 0xff, 0x00, 0xff, 0x6e, 0xff, 0x00, 0xff, 0x6e, 0xff, 0x00, 0xff, 0x70, 0xff, 0x00, 0xff, 0x70, 0xff, 0x00, 0xff, 0x70, 0xff, 0x00, 0xff, 0x70, 0xff, 0x00, 0xff, 0x70, 0xff, 0x00, 0xff, 0x71, 0xff, 0x00, 0xff, 0x71, 0xff, 0x00, 0xff, 0x72, 0xff, 0x00, 0xff, 0x72, 0xff, 0x00, 0xff, 0x72, 0xff, 0x00, 0xff, 0x73, 0xff, 0x00, 0xff, 0x73, 0xff,
+    0x00, 0x71, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xfe, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x66, 0xfe, 0xff, 0x00, 0x65, 0xff, 0xff, 0x00, 0x65, 0xff, 0xff, 0x00, 0x63, 0xff, 0xff, 0x00, 0x62, 0xff, 0xff, 0x00, 0x61, 0xff, 0xff, 0x00, 0x60, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xff, 0x00, 0x59, 0xff, 0xff, 0x00, 0x58, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x53, 0xff, 0xff, 0x00, 0x50, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xff, 0x00, 0x4a, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x33, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xff, 0x00, 0x27, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x16, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0xff, 0x04, 0xff, 0x00, 0xff, 0x0e, 0xff, 0x00, 0xff, 0x17, 0xff, 0x00, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x26, 0xff, 0x00, 0xff, 0x2d, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x00, 0xff, 0x4d, 0xff, 0x00, 0xff, 0x51, 0xff, 0x00, 0xff, 0x53, 0xff, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x5a, 0xff, 0x00, 0xff, 0x5b, 0xff, 0x00, 0xff, 0x5d, 0xff, 0x00, 0xff, 0x5f, 0xff, 0x00, 0xff, 0x60, 0xff, 0x00, 0xff, 0x61, 0xff, 0x00, 0xff, 0x62, 0xff, 0x00, 0xff, 0x64, 0xff, 0x00, 0xff, 0x65, 0xff, 0x00, 0xff, 0x65, 0xff, 0x00, 0xff, 0x66, 0xff, 0x00, 0xff, 0x67, 0xff, 0x00, 0xff, 0x68, 0xff, 0x00, 0xff, 0x69, 0xff, 0x00, 0xff, 0x69, 0xff, 0x00, 0xff, 0x6a, 0xff, 0x00, 0xff, 0x6a, 0xff, 0x00, 0xff, 0x6b, 0xff, 0x00, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x6d, 0xff, 0x00, 0xff, 0x6e, 0xff, 0x00, 0xff, 0x6e, 0xff, 0x00, 0xff, 0x6e, 0xff, 0x00, 0xff, 0x6f, 0xff, 0x00, 0xff, 0x6f, 0xff, 0x00, 0xfe, 0x70, 0xff, 0x00, 0xff, 0x70, 0xff, 0x00, 0xff, 0x71, 0xff, 0x00, 0xff, 0x70, 0xff, 0x00, 0xff, 0x71, 0xff, 0x00, 0xff, 0x71, 0xff,
+    0x00, 0x70, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x66, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x65, 0xff, 0xff, 0x00, 0x65, 0xff, 0xff, 0x00, 0x63, 0xff, 0xff, 0x00, 0x63, 0xff, 0xff, 0x00, 0x62, 0xff, 0xff, 0x00, 0x60, 0xff, 0xff, 0x00, 0x5f, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xff, 0x00, 0x58, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x54, 0xff, 0xff, 0x00, 0x52, 0xff, 0xff, 0x00, 0x50, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x46, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x35, 0xff, 0xff, 0x00, 0x30, 0xff, 0xff, 0x00, 0x29, 0xff, 0xff, 0x00, 0x23, 0xff, 0xff, 0x00, 0x1c, 0xff, 0xff, 0x00, 0x14, 0xff, 0xff, 0x00, 0x0c, 0xff, 0xff, 0x00, 0x04, 0xff, 0xff, 0x00, 0xff, 0x04, 0xff, 0x00, 0xff, 0x0c, 0xff, 0x00, 0xff, 0x15, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x23, 0xff, 0x00, 0xff, 0x2a, 0xff, 0x00, 0xff, 0x2f, 0xff, 0x00, 0xff, 0x35, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x4a, 0xff, 0x00, 0xff, 0x4c, 0xff, 0x00, 0xff, 0x50, 0xff, 0x00, 0xff, 0x52, 0xff, 0x00, 0xff, 0x54, 0xff, 0x00, 0xff, 0x56, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x5a, 0xff, 0x00, 0xff, 0x5b, 0xff, 0x00, 0xff, 0x5d, 0xff, 0x00, 0xff, 0x5e, 0xff, 0x00, 0xff, 0x5f, 0xff, 0x00, 0xff, 0x61, 0xff, 0x00, 0xff, 0x62, 0xff, 0x00, 0xff, 0x62, 0xff, 0x00, 0xff, 0x63, 0xff, 0x00, 0xff, 0x65, 0xff, 0x00, 0xff, 0x66, 0xff, 0x00, 0xff, 0x66, 0xff, 0x00, 0xff, 0x67, 0xff, 0x00, 0xff, 0x68, 0xff, 0x00, 0xff, 0x68, 0xff, 0x00, 0xff, 0x69, 0xff, 0x00, 0xff, 0x69, 0xff, 0x00, 0xff, 0x6a, 0xff, 0x00, 0xff, 0x6b, 0xff, 0x00, 0xff, 0x6b, 0xff, 0x00, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x6d, 0xff, 0x00, 0xff, 0x6e, 0xff, 0x00, 0xff, 0x6e, 0xff, 0x00, 0xff, 0x6f, 0xff, 0x01, 0xff, 0x6e, 0xff, 0x00, 0xff, 0x6f, 0xff, 0x00, 0xff, 0x6f, 0xff, 0x00, 0xff, 0x70, 0xff,
+    0x00, 0x6e, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x65, 0xff, 0xff, 0x00, 0x64, 0xff, 0xff, 0x00, 0x64, 0xff, 0xff, 0x00, 0x63, 0xff, 0xff, 0x00, 0x62, 0xff, 0xff, 0x00, 0x61, 0xff, 0xff, 0x00, 0x60, 0xff, 0xff, 0x00, 0x5f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xff, 0x00, 0x58, 0xff, 0xff, 0x00, 0x57, 0xff, 0xff, 0x00, 0x54, 0xff, 0xff, 0x00, 0x52, 0xff, 0xff, 0x00, 0x50, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x48, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x2c, 0xff, 0xff, 0x00, 0x26, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x19, 0xff, 0xff, 0x00, 0x13, 0xff, 0xff, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x04, 0xff, 0xff, 0x00, 0xff, 0x04, 0xff, 0x00, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x12, 0xff, 0x00, 0xff, 0x19, 0xff, 0x00, 0xff, 0x20, 0xff, 0x00, 0xff, 0x26, 0xff, 0x00, 0xff, 0x2c, 0xff, 0x00, 0xff, 0x31, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x49, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x00, 0xff, 0x4e, 0xff, 0x00, 0xff, 0x50, 0xff, 0x00, 0xff, 0x53, 0xff, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x58, 0xff, 0x00, 0xff, 0x5a, 0xff, 0x00, 0xff, 0x5b, 0xff, 0x00, 0xff, 0x5c, 0xff, 0x00, 0xff, 0x5e, 0xff, 0x00, 0xff, 0x5e, 0xff, 0x00, 0xff, 0x60, 0xff, 0x00, 0xff, 0x61, 0xff, 0x00, 0xff, 0x62, 0xff, 0x00, 0xff, 0x63, 0xff, 0x00, 0xff, 0x63, 0xff, 0x00, 0xff, 0x64, 0xff, 0x00, 0xff, 0x65, 0xff, 0x00, 0xff, 0x67, 0xff, 0x00, 0xff, 0x67, 0xff, 0x00, 0xfe, 0x67, 0xff, 0x00, 0xff, 0x68, 0xff, 0x00, 0xff, 0x69, 0xff, 0x00, 0xff, 0x69, 0xff, 0x00, 0xff, 0x6a, 0xff, 0x00, 0xff, 0x6a, 0xff, 0x00, 0xff, 0x6b, 0xff, 0x00, 0xff, 0x6c, 0xff, 0x00, 0xfe, 0x6c, 0xff, 0x00, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x6d, 0xff, 0x00, 0xff, 0x6d, 0xff, 0x00, 0xff, 0x6d, 0xff, 0x00, 0xff, 0x6d, 0xff, 0x00, 0xff, 0x6e, 0xff,
+    0x00, 0x6d, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x01, 0x6a, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x66, 0xff, 0xff, 0x00, 0x65, 0xff, 0xff, 0x00, 0x65, 0xff, 0xff, 0x00, 0x65, 0xff, 0xff, 0x00, 0x64, 0xff, 0xff, 0x00, 0x64, 0xff, 0xff, 0x00, 0x62, 0xff, 0xff, 0x00, 0x61, 0xff, 0xff, 0x00, 0x60, 0xff, 0xff, 0x00, 0x60, 0xff, 0xff, 0x00, 0x5f, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xff, 0x00, 0x59, 0xff, 0xff, 0x00, 0x58, 0xff, 0xff, 0x00, 0x57, 0xff, 0xff, 0x00, 0x55, 0xff, 0xff, 0x00, 0x53, 0xff, 0xff, 0x00, 0x51, 0xff, 0xff, 0x00, 0x50, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x37, 0xff, 0xff, 0x00, 0x32, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x00, 0x23, 0xff, 0xff, 0x00, 0x1d, 0xff, 0xff, 0x00, 0x17, 0xff, 0xff, 0x00, 0x11, 0xff, 0xff, 0x00, 0x0a, 0xff, 0xff, 0x00, 0x04, 0xff, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x11, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x23, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x37, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x00, 0xff, 0x4d, 0xff, 0x00, 0xff, 0x4f, 0xff, 0x00, 0xff, 0x52, 0xff, 0x00, 0xff, 0x53, 0xff, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x58, 0xff, 0x00, 0xff, 0x5a, 0xff, 0x00, 0xff, 0x5b, 0xff, 0x00, 0xff, 0x5c, 0xff, 0x00, 0xff, 0x5d, 0xff, 0x00, 0xff, 0x5e, 0xff, 0x00, 0xff, 0x5f, 0xff, 0x00, 0xff, 0x61, 0xff, 0x00, 0xff, 0x61, 0xff, 0x00, 0xff, 0x62, 0xff, 0x00, 0xff, 0x63, 0xff, 0x00, 0xff, 0x64, 0xff, 0x00, 0xff, 0x64, 0xff, 0x00, 0xff, 0x65, 0xff, 0x00, 0xff, 0x66, 0xff, 0x00, 0xff, 0x66, 0xff, 0x00, 0xff, 0x67, 0xff, 0x00, 0xff, 0x68, 0xff, 0x00, 0xff, 0x69, 0xff, 0x00, 0xff, 0x69, 0xff, 0x00, 0xff, 0x69, 0xff, 0x00, 0xff, 0x6a, 0xff, 0x00, 0xff, 0x6b, 0xff, 0x00, 0xff, 0x6b, 0xff, 0x00, 0xff, 0x6b, 0xff, 0x00, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x6c, 0xff,
+    0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x66, 0xff, 0xff, 0x00, 0x66, 0xff, 0xff, 0x00, 0x65, 0xff, 0xff, 0x00, 0x64, 0xff, 0xff, 0x00, 0x63, 0xff, 0xff, 0x00, 0x63, 0xff, 0xff, 0x00, 0x61, 0xff, 0xff, 0x00, 0x61, 0xff, 0xff, 0x00, 0x60, 0xff, 0xff, 0x00, 0x5f, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xff, 0x00, 0x58, 0xff, 0xff, 0x00, 0x57, 0xff, 0xff, 0x00, 0x55, 0xff, 0xff, 0x00, 0x53, 0xfe, 0xff, 0x00, 0x52, 0xff, 0xff, 0x00, 0x51, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x4a, 0xff, 0xff, 0x00, 0x48, 0xff, 0xff, 0x00, 0x44, 0xfe, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x37, 0xff, 0xff, 0x00, 0x34, 0xff, 0xff, 0x00, 0x30, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xff, 0x00, 0x26, 0xff, 0xff, 0x00, 0x20, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xff, 0x00, 0x16, 0xff, 0xff, 0x00, 0x10, 0xff, 0xff, 0x00, 0x0a, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x09, 0xff, 0x00, 0xff, 0x10, 0xff, 0x00, 0xff, 0x16, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x21, 0xff, 0x00, 0xff, 0x26, 0xff, 0x00, 0xff, 0x2b, 0xff, 0x00, 0xff, 0x2f, 0xff, 0x00, 0xff, 0x33, 0xff, 0x01, 0xff, 0x38, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x49, 0xff, 0x00, 0xff, 0x4c, 0xff, 0x00, 0xff, 0x4f, 0xff, 0x00, 0xff, 0x50, 0xff, 0x00, 0xff, 0x52, 0xff, 0x00, 0xff, 0x53, 0xff, 0x00, 0xff, 0x56, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x58, 0xff, 0x00, 0xff, 0x5a, 0xff, 0x00, 0xff, 0x5a, 0xff, 0x00, 0xff, 0x5c, 0xff, 0x00, 0xff, 0x5d, 0xff, 0x00, 0xff, 0x5e, 0xff, 0x00, 0xff, 0x5f, 0xff, 0x00, 0xff, 0x60, 0xff, 0x00, 0xff, 0x61, 0xff, 0x00, 0xff, 0x62, 0xff, 0x00, 0xff, 0x62, 0xff, 0x00, 0xff, 0x63, 0xff, 0x00, 0xff, 0x64, 0xff, 0x00, 0xff, 0x64, 0xff, 0x00, 0xff, 0x65, 0xff, 0x00, 0xff, 0x66, 0xff, 0x00, 0xff, 0x67, 0xff, 0x00, 0xff, 0x67, 0xff, 0x00, 0xff, 0x69, 0xff, 0x00, 0xff, 0x68, 0xff, 0x00, 0xff, 0x69, 0xff, 0x00, 0xff, 0x69, 0xff, 0x00, 0xff, 0x6a, 0xff, 0x00, 0xff, 0x6a, 0xff, 0x00, 0xff, 0x6b, 0xff, 0x00, 0xff, 0x6a, 0xff,
+    0x00, 0x6a, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x66, 0xff, 0xff, 0x00, 0x66, 0xff, 0xff, 0x00, 0x65, 0xff, 0xff, 0x00, 0x65, 0xff, 0xff, 0x00, 0x64, 0xff, 0xff, 0x00, 0x63, 0xff, 0xff, 0x00, 0x63, 0xfe, 0xff, 0x00, 0x62, 0xff, 0xff, 0x00, 0x62, 0xff, 0xff, 0x00, 0x60, 0xff, 0xff, 0x00, 0x5f, 0xff, 0xff, 0x00, 0x5f, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xff, 0x00, 0x59, 0xff, 0xff, 0x00, 0x58, 0xff, 0xff, 0x00, 0x57, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x54, 0xff, 0xff, 0x00, 0x53, 0xfe, 0xff, 0x00, 0x51, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3c, 0xfe, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x35, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x00, 0x23, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xff, 0x00, 0x1a, 0xff, 0xff, 0x01, 0x14, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x09, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x09, 0xff, 0x00, 0xff, 0x0e, 0xff, 0x00, 0xff, 0x14, 0xff, 0x00, 0xff, 0x19, 0xff, 0x00, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x24, 0xff, 0x00, 0xff, 0x28, 0xff, 0x00, 0xff, 0x2d, 0xff, 0x00, 0xff, 0x31, 0xff, 0x00, 0xff, 0x35, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x49, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x00, 0xff, 0x4d, 0xff, 0x00, 0xff, 0x4f, 0xff, 0x00, 0xff, 0x51, 0xff, 0x00, 0xff, 0x53, 0xff, 0x00, 0xff, 0x54, 0xff, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x58, 0xff, 0x00, 0xff, 0x5a, 0xff, 0x00, 0xff, 0x5b, 0xff, 0x00, 0xff, 0x5c, 0xff, 0x00, 0xff, 0x5c, 0xff, 0x00, 0xff, 0x5e, 0xff, 0x00, 0xff, 0x5f, 0xff, 0x00, 0xff, 0x5f, 0xff, 0x00, 0xff, 0x61, 0xff, 0x00, 0xff, 0x62, 0xff, 0x00, 0xff, 0x62, 0xff, 0x00, 0xff, 0x62, 0xff, 0x00, 0xff, 0x63, 0xff, 0x00, 0xff, 0x64, 0xff, 0x00, 0xff, 0x65, 0xff, 0x00, 0xff, 0x66, 0xff, 0x00, 0xff, 0x66, 0xff, 0x00, 0xff, 0x67, 0xff, 0x00, 0xff, 0x67, 0xff, 0x00, 0xff, 0x68, 0xff, 0x00, 0xff, 0x68, 0xff, 0x00, 0xff, 0x69, 0xff, 0x00, 0xff, 0x69, 0xff, 0x00, 0xff, 0x69, 0xff,
+    0x00, 0x68, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x66, 0xff, 0xff, 0x00, 0x66, 0xff, 0xff, 0x00, 0x65, 0xff, 0xff, 0x00, 0x64, 0xff, 0xff, 0x00, 0x64, 0xff, 0xff, 0x00, 0x63, 0xff, 0xff, 0x00, 0x62, 0xff, 0xff, 0x00, 0x62, 0xff, 0xff, 0x00, 0x61, 0xff, 0xff, 0x00, 0x60, 0xff, 0xff, 0x00, 0x60, 0xff, 0xff, 0x00, 0x5f, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xff, 0x01, 0x5b, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xff, 0x00, 0x58, 0xff, 0xff, 0x00, 0x58, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x55, 0xff, 0xff, 0x00, 0x53, 0xff, 0xff, 0x00, 0x50, 0xff, 0xff, 0x00, 0x50, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x48, 0xff, 0xff, 0x00, 0x46, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x32, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xff, 0x00, 0x26, 0xff, 0xff, 0x00, 0x22, 0xff, 0xff, 0x00, 0x1d, 0xff, 0xff, 0x00, 0x18, 0xff, 0xff, 0x00, 0x13, 0xff, 0xff, 0x00, 0x0d, 0xff, 0xff, 0x00, 0x08, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x09, 0xff, 0x00, 0xff, 0x0e, 0xff, 0x00, 0xff, 0x13, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x22, 0xff, 0x00, 0xff, 0x26, 0xff, 0x00, 0xff, 0x2a, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x32, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x39, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x01, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x49, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x00, 0xff, 0x4d, 0xff, 0x00, 0xff, 0x4e, 0xff, 0x00, 0xff, 0x50, 0xff, 0x00, 0xff, 0x52, 0xff, 0x00, 0xff, 0x53, 0xff, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x56, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x59, 0xff, 0x00, 0xff, 0x5a, 0xff, 0x00, 0xff, 0x5b, 0xff, 0x00, 0xff, 0x5c, 0xff, 0x00, 0xff, 0x5d, 0xff, 0x00, 0xff, 0x5c, 0xff, 0x00, 0xff, 0x5e, 0xff, 0x00, 0xff, 0x60, 0xff, 0x00, 0xff, 0x60, 0xff, 0x00, 0xff, 0x60, 0xff, 0x00, 0xff, 0x62, 0xff, 0x00, 0xff, 0x63, 0xff, 0x00, 0xff, 0x63, 0xff, 0x00, 0xff, 0x64, 0xff, 0x00, 0xff, 0x65, 0xff, 0x00, 0xff, 0x64, 0xff, 0x00, 0xff, 0x66, 0xff, 0x00, 0xff, 0x66, 0xff, 0x00, 0xff, 0x66, 0xff, 0x00, 0xff, 0x67, 0xff, 0x00, 0xff, 0x67, 0xff, 0x00, 0xff, 0x68, 0xff,
+    0x00, 0x66, 0xff, 0xff, 0x00, 0x66, 0xff, 0xff, 0x00, 0x65, 0xff, 0xff, 0x00, 0x65, 0xff, 0xff, 0x00, 0x64, 0xff, 0xff, 0x00, 0x63, 0xff, 0xff, 0x00, 0x63, 0xff, 0xff, 0x00, 0x63, 0xff, 0xff, 0x00, 0x62, 0xff, 0xff, 0x01, 0x61, 0xff, 0xff, 0x00, 0x60, 0xff, 0xff, 0x00, 0x60, 0xff, 0xff, 0x00, 0x5f, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xff, 0x00, 0x59, 0xff, 0xff, 0x00, 0x57, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x55, 0xff, 0xff, 0x00, 0x54, 0xff, 0xff, 0x00, 0x52, 0xff, 0xff, 0x00, 0x51, 0xff, 0xff, 0x00, 0x50, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xff, 0x00, 0x4d, 0xfe, 0xff, 0x00, 0x4a, 0xff, 0xff, 0x00, 0x48, 0xff, 0xff, 0x00, 0x46, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x33, 0xff, 0xff, 0x00, 0x30, 0xff, 0xff, 0x00, 0x2c, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x00, 0x23, 0xff, 0xff, 0x00, 0x20, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xff, 0x00, 0x16, 0xfe, 0xff, 0x00, 0x12, 0xff, 0xff, 0x00, 0x0c, 0xff, 0xff, 0x00, 0x08, 0xff, 0xff, 0x00, 0x02, 0xff, 0xff, 0x00, 0xff, 0x02, 0xff, 0x00, 0xff, 0x08, 0xff, 0x00, 0xfe, 0x0d, 0xff, 0x00, 0xff, 0x11, 0xff, 0x00, 0xff, 0x16, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x24, 0xff, 0x00, 0xff, 0x28, 0xff, 0x00, 0xff, 0x2c, 0xff, 0x00, 0xff, 0x30, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x39, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x4a, 0xff, 0x00, 0xff, 0x4c, 0xff, 0x00, 0xff, 0x4e, 0xff, 0x00, 0xff, 0x50, 0xff, 0x00, 0xff, 0x51, 0xff, 0x00, 0xff, 0x52, 0xff, 0x00, 0xff, 0x53, 0xff, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x58, 0xff, 0x00, 0xff, 0x59, 0xff, 0x00, 0xff, 0x5b, 0xff, 0x00, 0xff, 0x5c, 0xff, 0x00, 0xff, 0x5c, 0xff, 0x00, 0xff, 0x5d, 0xff, 0x00, 0xff, 0x5f, 0xff, 0x00, 0xff, 0x5f, 0xff, 0x00, 0xff, 0x60, 0xff, 0x00, 0xff, 0x61, 0xff, 0x00, 0xff, 0x62, 0xff, 0x00, 0xff, 0x62, 0xff, 0x00, 0xff, 0x63, 0xff, 0x00, 0xff, 0x64, 0xff, 0x00, 0xff, 0x64, 0xff, 0x00, 0xff, 0x65, 0xff, 0x00, 0xff, 0x65, 0xff, 0x00, 0xff, 0x65, 0xff, 0x00, 0xff, 0x66, 0xff, 0x00, 0xff, 0x67, 0xff,
+    0x00, 0x65, 0xff, 0xff, 0x00, 0x64, 0xff, 0xff, 0x00, 0x64, 0xff, 0xff, 0x00, 0x63, 0xff, 0xff, 0x00, 0x63, 0xff, 0xff, 0x00, 0x62, 0xff, 0xff, 0x00, 0x61, 0xff, 0xff, 0x00, 0x61, 0xff, 0xff, 0x00, 0x60, 0xff, 0xff, 0x00, 0x5f, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xff, 0x00, 0x59, 0xff, 0xff, 0x00, 0x57, 0xfe, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x54, 0xff, 0xff, 0x00, 0x53, 0xff, 0xff, 0x00, 0x51, 0xff, 0xff, 0x00, 0x50, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x48, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x37, 0xff, 0xff, 0x00, 0x33, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x2e, 0xfe, 0xff, 0x00, 0x2a, 0xff, 0xff, 0x00, 0x26, 0xff, 0xff, 0x00, 0x21, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xff, 0x00, 0x1a, 0xff, 0xff, 0x00, 0x15, 0xff, 0xff, 0x00, 0x11, 0xff, 0xff, 0x00, 0x0c, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x00, 0x02, 0xff, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x07, 0xff, 0x00, 0xff, 0x0c, 0xff, 0x00, 0xff, 0x10, 0xff, 0x00, 0xff, 0x16, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x21, 0xff, 0x00, 0xff, 0x26, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x30, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x37, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x49, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x00, 0xff, 0x4e, 0xff, 0x00, 0xff, 0x4f, 0xff, 0x00, 0xff, 0x50, 0xff, 0x00, 0xff, 0x52, 0xff, 0x00, 0xff, 0x53, 0xff, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x56, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x58, 0xff, 0x00, 0xff, 0x59, 0xff, 0x00, 0xff, 0x59, 0xff, 0x00, 0xff, 0x5a, 0xff, 0x00, 0xff, 0x5c, 0xff, 0x00, 0xff, 0x5c, 0xff, 0x00, 0xff, 0x5d, 0xff, 0x00, 0xff, 0x5e, 0xff, 0x00, 0xff, 0x5f, 0xff, 0x00, 0xff, 0x5f, 0xff, 0x00, 0xff, 0x60, 0xff, 0x00, 0xff, 0x61, 0xff, 0x00, 0xff, 0x62, 0xff, 0x00, 0xff, 0x62, 0xff, 0x00, 0xff, 0x63, 0xff, 0x00, 0xff, 0x63, 0xff, 0x00, 0xff, 0x64, 0xff, 0x00, 0xff, 0x64, 0xff, 0x00, 0xff, 0x65, 0xff,
+    0x00, 0x63, 0xff, 0xff, 0x00, 0x63, 0xff, 0xff, 0x00, 0x62, 0xff, 0xff, 0x00, 0x62, 0xff, 0xff, 0x00, 0x61, 0xff, 0xff, 0x00, 0x60, 0xff, 0xff, 0x00, 0x60, 0xff, 0xff, 0x00, 0x60, 0xff, 0xff, 0x00, 0x5f, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xff, 0x00, 0x59, 0xff, 0xff, 0x00, 0x59, 0xff, 0xff, 0x00, 0x58, 0xff, 0xff, 0x00, 0x57, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x55, 0xff, 0xff, 0x00, 0x53, 0xff, 0xff, 0x00, 0x52, 0xff, 0xff, 0x00, 0x51, 0xff, 0xff, 0x00, 0x50, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x46, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x35, 0xff, 0xff, 0x00, 0x32, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x00, 0x24, 0xff, 0xff, 0x00, 0x20, 0xff, 0xff, 0x00, 0x1c, 0xff, 0xff, 0x00, 0x18, 0xff, 0xff, 0x00, 0x14, 0xff, 0xff, 0x00, 0x10, 0xff, 0xff, 0x00, 0x0c, 0xff, 0xff, 0x00, 0x06, 0xff, 0xff, 0x00, 0x02, 0xff, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x07, 0xff, 0x00, 0xff, 0x0c, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x14, 0xff, 0x00, 0xff, 0x19, 0xff, 0x00, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x20, 0xff, 0x00, 0xff, 0x24, 0xff, 0x00, 0xff, 0x28, 0xff, 0x00, 0xff, 0x2b, 0xff, 0x00, 0xff, 0x2f, 0xff, 0x00, 0xff, 0x31, 0xff, 0x00, 0xff, 0x35, 0xff, 0x00, 0xff, 0x37, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x47, 0xff, 0x00, 0xff, 0x49, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x00, 0xff, 0x4c, 0xff, 0x00, 0xff, 0x4e, 0xff, 0x00, 0xff, 0x50, 0xff, 0x00, 0xff, 0x51, 0xff, 0x00, 0xff, 0x52, 0xff, 0x00, 0xff, 0x53, 0xff, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x56, 0xff, 0x00, 0xff, 0x57, 0xff, 0x01, 0xff, 0x58, 0xff, 0x01, 0xff, 0x59, 0xff, 0x00, 0xff, 0x5a, 0xff, 0x00, 0xff, 0x5b, 0xff, 0x00, 0xff, 0x5c, 0xff, 0x00, 0xff, 0x5d, 0xff, 0x00, 0xff, 0x5d, 0xff, 0x00, 0xff, 0x5e, 0xff, 0x00, 0xff, 0x5e, 0xff, 0x00, 0xff, 0x60, 0xff, 0x00, 0xff, 0x60, 0xff, 0x00, 0xff, 0x61, 0xff, 0x00, 0xff, 0x61, 0xff, 0x00, 0xff, 0x61, 0xff, 0x00, 0xff, 0x62, 0xff, 0x00, 0xff, 0x63, 0xff, 0x00, 0xff, 0x64, 0xff,
+    0x00, 0x62, 0xff, 0xff, 0x00, 0x62, 0xff, 0xff, 0x00, 0x61, 0xff, 0xff, 0x00, 0x60, 0xff, 0xff, 0x00, 0x60, 0xff, 0xff, 0x00, 0x5f, 0xff, 0xff, 0x00, 0x5f, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xff, 0x00, 0x59, 0xff, 0xff, 0x00, 0x59, 0xff, 0xff, 0x00, 0x58, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x54, 0xff, 0xff, 0x00, 0x54, 0xff, 0xff, 0x00, 0x53, 0xff, 0xff, 0x00, 0x51, 0xff, 0xff, 0x00, 0x51, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x4a, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x46, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x35, 0xff, 0xff, 0x00, 0x32, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xff, 0x00, 0x29, 0xff, 0xff, 0x00, 0x26, 0xff, 0xff, 0x00, 0x23, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xff, 0x00, 0x17, 0xff, 0xff, 0x00, 0x13, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x0b, 0xfe, 0xff, 0x00, 0x07, 0xff, 0xff, 0x00, 0x02, 0xff, 0xff, 0x00, 0xff, 0x02, 0xff, 0x00, 0xff, 0x07, 0xff, 0x00, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x13, 0xff, 0x00, 0xff, 0x17, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x22, 0xff, 0x00, 0xff, 0x26, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xff, 0x2c, 0xff, 0x00, 0xff, 0x2f, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x35, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xfe, 0x3f, 0xff, 0x00, 0xff, 0x41, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x47, 0xff, 0x00, 0xff, 0x49, 0xff, 0x00, 0xff, 0x4a, 0xff, 0x00, 0xff, 0x4c, 0xff, 0x00, 0xff, 0x4d, 0xff, 0x00, 0xff, 0x4f, 0xff, 0x00, 0xff, 0x50, 0xff, 0x00, 0xff, 0x51, 0xff, 0x00, 0xff, 0x52, 0xff, 0x00, 0xff, 0x54, 0xff, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x56, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x58, 0xff, 0x00, 0xff, 0x58, 0xff, 0x00, 0xff, 0x5a, 0xff, 0x00, 0xff, 0x5a, 0xff, 0x00, 0xff, 0x5c, 0xff, 0x00, 0xff, 0x5c, 0xff, 0x00, 0xff, 0x5d, 0xff, 0x00, 0xff, 0x5e, 0xff, 0x00, 0xff, 0x5e, 0xff, 0x00, 0xff, 0x5f, 0xff, 0x00, 0xff, 0x60, 0xff, 0x00, 0xff, 0x61, 0xff, 0x00, 0xff, 0x61, 0xff, 0x00, 0xff, 0x61, 0xff, 0x00, 0xff, 0x62, 0xff,
+    0x00, 0x61, 0xff, 0xff, 0x00, 0x60, 0xff, 0xff, 0x00, 0x5f, 0xff, 0xff, 0x00, 0x5f, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xff, 0x00, 0x59, 0xff, 0xff, 0x00, 0x59, 0xff, 0xff, 0x00, 0x58, 0xff, 0xff, 0x00, 0x58, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x55, 0xff, 0xff, 0x00, 0x54, 0xff, 0xff, 0x00, 0x53, 0xff, 0xff, 0x00, 0x52, 0xff, 0xff, 0x00, 0x51, 0xff, 0xff, 0x00, 0x50, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x4a, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x46, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x33, 0xff, 0xff, 0x00, 0x30, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x00, 0x24, 0xff, 0xff, 0x00, 0x21, 0xff, 0xff, 0x00, 0x1d, 0xff, 0xff, 0x00, 0x1a, 0xff, 0xff, 0x00, 0x16, 0xff, 0xff, 0x00, 0x13, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x0a, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x00, 0x02, 0xff, 0xff, 0x00, 0xff, 0x02, 0xff, 0x00, 0xff, 0x06, 0xff, 0x00, 0xff, 0x0a, 0xff, 0x00, 0xff, 0x0e, 0xff, 0x00, 0xff, 0x12, 0xff, 0x00, 0xff, 0x16, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x21, 0xff, 0x00, 0xff, 0x24, 0xff, 0x00, 0xff, 0x28, 0xff, 0x00, 0xff, 0x2b, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x30, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x41, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x47, 0xff, 0x00, 0xff, 0x49, 0xff, 0x00, 0xff, 0x4a, 0xff, 0x00, 0xff, 0x4c, 0xff, 0x00, 0xff, 0x4d, 0xff, 0x00, 0xff, 0x4e, 0xff, 0x00, 0xff, 0x4f, 0xff, 0x00, 0xff, 0x51, 0xff, 0x00, 0xff, 0x52, 0xff, 0x00, 0xff, 0x53, 0xff, 0x00, 0xff, 0x54, 0xff, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x56, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x58, 0xff, 0x00, 0xff, 0x59, 0xff, 0x00, 0xff, 0x5a, 0xff, 0x00, 0xff, 0x5b, 0xff, 0x00, 0xff, 0x5b, 0xff, 0x00, 0xff, 0x5c, 0xff, 0x00, 0xff, 0x5d, 0xff, 0x00, 0xff, 0x5d, 0xff, 0x00, 0xff, 0x5f, 0xff, 0x00, 0xff, 0x5e, 0xff, 0x00, 0xff, 0x5f, 0xff, 0x00, 0xff, 0x60, 0xff, 0x00, 0xff, 0x60, 0xff,
+    0x00, 0x60, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xff, 0x00, 0x59, 0xff, 0xff, 0x00, 0x59, 0xff, 0xff, 0x00, 0x57, 0xff, 0xff, 0x00, 0x57, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x55, 0xff, 0xff, 0x00, 0x53, 0xff, 0xff, 0x00, 0x52, 0xff, 0xff, 0x00, 0x51, 0xff, 0xff, 0x00, 0x50, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x48, 0xff, 0xff, 0x00, 0x46, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x33, 0xff, 0xff, 0x00, 0x32, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xff, 0x00, 0x2c, 0xff, 0xff, 0x00, 0x29, 0xff, 0xff, 0x00, 0x26, 0xff, 0xff, 0x00, 0x22, 0xff, 0xff, 0x00, 0x20, 0xff, 0xff, 0x00, 0x1c, 0xff, 0xff, 0x00, 0x19, 0xff, 0xff, 0x00, 0x15, 0xff, 0xff, 0x00, 0x11, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x0a, 0xff, 0xff, 0x00, 0x06, 0xff, 0xff, 0x00, 0x02, 0xff, 0xff, 0x00, 0xff, 0x02, 0xff, 0x00, 0xff, 0x06, 0xff, 0x00, 0xff, 0x09, 0xff, 0x00, 0xff, 0x0d, 0xff, 0x00, 0xff, 0x13, 0xff, 0x00, 0xff, 0x15, 0xff, 0x00, 0xff, 0x19, 0xff, 0x00, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x23, 0xff, 0x00, 0xff, 0x26, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xff, 0x2c, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x31, 0xff, 0x00, 0xff, 0x34, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x39, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x41, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x4a, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x00, 0xff, 0x4c, 0xff, 0x00, 0xff, 0x4d, 0xff, 0x00, 0xff, 0x4f, 0xff, 0x00, 0xff, 0x50, 0xff, 0x00, 0xff, 0x51, 0xff, 0x00, 0xff, 0x52, 0xff, 0x00, 0xff, 0x54, 0xff, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x58, 0xff, 0x00, 0xff, 0x59, 0xff, 0x00, 0xff, 0x59, 0xff, 0x01, 0xff, 0x5b, 0xff, 0x00, 0xff, 0x5b, 0xff, 0x00, 0xff, 0x5b, 0xff, 0x00, 0xff, 0x5d, 0xff, 0x00, 0xff, 0x5e, 0xff, 0x00, 0xff, 0x5e, 0xff, 0x00, 0xff, 0x5f, 0xff, 0x00, 0xff, 0x5f, 0xff,
+    0x00, 0x5e, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xff, 0x00, 0x59, 0xff, 0xff, 0x00, 0x59, 0xff, 0xff, 0x00, 0x57, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x54, 0xff, 0xff, 0x00, 0x53, 0xff, 0xff, 0x00, 0x53, 0xff, 0xff, 0x00, 0x52, 0xff, 0xff, 0x00, 0x51, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x4a, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x48, 0xff, 0xff, 0x00, 0x46, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x37, 0xff, 0xff, 0x00, 0x34, 0xff, 0xff, 0x00, 0x32, 0xff, 0xff, 0x00, 0x30, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xff, 0x00, 0x2a, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x00, 0x25, 0xff, 0xff, 0x00, 0x21, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xff, 0x00, 0x17, 0xff, 0xff, 0x00, 0x14, 0xff, 0xff, 0x00, 0x10, 0xff, 0xff, 0x00, 0x0d, 0xff, 0xff, 0x00, 0x09, 0xff, 0xff, 0x00, 0x06, 0xff, 0xff, 0x00, 0x02, 0xff, 0xff, 0x00, 0xff, 0x02, 0xff, 0x00, 0xff, 0x06, 0xff, 0x00, 0xff, 0x09, 0xff, 0x00, 0xff, 0x0d, 0xff, 0x00, 0xff, 0x11, 0xff, 0x00, 0xff, 0x14, 0xff, 0x00, 0xff, 0x17, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x21, 0xff, 0x00, 0xff, 0x24, 0xff, 0x00, 0xff, 0x27, 0xff, 0x00, 0xff, 0x2a, 0xff, 0x00, 0xff, 0x2d, 0xff, 0x00, 0xff, 0x30, 0xff, 0x00, 0xff, 0x32, 0xff, 0x00, 0xff, 0x34, 0xff, 0x00, 0xff, 0x37, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xfe, 0x3b, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x41, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x49, 0xff, 0x00, 0xff, 0x4a, 0xff, 0x00, 0xff, 0x4c, 0xff, 0x00, 0xff, 0x4d, 0xff, 0x00, 0xff, 0x4e, 0xff, 0x00, 0xff, 0x50, 0xff, 0x00, 0xff, 0x51, 0xff, 0x00, 0xff, 0x52, 0xff, 0x00, 0xff, 0x53, 0xff, 0x00, 0xff, 0x54, 0xff, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x58, 0xff, 0x00, 0xff, 0x59, 0xff, 0x00, 0xff, 0x5a, 0xff, 0x00, 0xff, 0x5b, 0xff, 0x00, 0xff, 0x5c, 0xff, 0x00, 0xff, 0x5c, 0xff, 0x00, 0xff, 0x5c, 0xff, 0x00, 0xff, 0x5d, 0xff, 0x00, 0xff, 0x5e, 0xff,
+    0x00, 0x5d, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xff, 0x00, 0x59, 0xff, 0xff, 0x00, 0x59, 0xff, 0xff, 0x00, 0x58, 0xff, 0xff, 0x00, 0x58, 0xff, 0xff, 0x00, 0x57, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x55, 0xff, 0xff, 0x00, 0x54, 0xff, 0xff, 0x00, 0x53, 0xff, 0xff, 0x00, 0x52, 0xff, 0xff, 0x00, 0x51, 0xff, 0xff, 0x00, 0x50, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x4a, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x35, 0xff, 0xff, 0x00, 0x33, 0xff, 0xff, 0x00, 0x30, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x00, 0x26, 0xff, 0xff, 0x00, 0x23, 0xff, 0xff, 0x00, 0x20, 0xff, 0xff, 0x00, 0x1d, 0xff, 0xff, 0x00, 0x19, 0xff, 0xff, 0x00, 0x16, 0xff, 0xff, 0x00, 0x13, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x0c, 0xff, 0xff, 0x00, 0x09, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0x02, 0xff, 0xff, 0x00, 0xff, 0x02, 0xff, 0x00, 0xff, 0x05, 0xff, 0x00, 0xff, 0x09, 0xff, 0x00, 0xff, 0x0c, 0xff, 0x00, 0xff, 0x10, 0xff, 0x00, 0xff, 0x13, 0xff, 0x00, 0xff, 0x16, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x20, 0xff, 0x00, 0xff, 0x23, 0xff, 0x00, 0xff, 0x26, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xff, 0x2b, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x31, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x35, 0xff, 0x00, 0xff, 0x37, 0xff, 0x00, 0xff, 0x39, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x41, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x4a, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x00, 0xff, 0x4d, 0xff, 0x00, 0xff, 0x4e, 0xff, 0x00, 0xff, 0x4f, 0xff, 0x00, 0xff, 0x50, 0xff, 0x00, 0xff, 0x51, 0xff, 0x00, 0xff, 0x52, 0xff, 0x00, 0xff, 0x53, 0xff, 0x00, 0xff, 0x54, 0xff, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x58, 0xff, 0x00, 0xff, 0x59, 0xff, 0x00, 0xff, 0x59, 0xff, 0x00, 0xff, 0x59, 0xff, 0x00, 0xff, 0x5a, 0xff, 0x00, 0xff, 0x5b, 0xff, 0x00, 0xff, 0x5c, 0xff, 0x00, 0xff, 0x5d, 0xff,
+    0x00, 0x5b, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xff, 0x00, 0x59, 0xff, 0xff, 0x00, 0x58, 0xff, 0xff, 0x00, 0x58, 0xff, 0xff, 0x00, 0x57, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x54, 0xff, 0xff, 0x00, 0x53, 0xff, 0xff, 0x00, 0x52, 0xff, 0xff, 0x00, 0x51, 0xff, 0xff, 0x00, 0x51, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x4a, 0xff, 0xff, 0x00, 0x48, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x43, 0xfe, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3c, 0xfe, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x34, 0xff, 0xff, 0x00, 0x32, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x00, 0x2c, 0xff, 0xff, 0x00, 0x2a, 0xfe, 0xff, 0x00, 0x27, 0xff, 0xff, 0x00, 0x24, 0xff, 0xff, 0x00, 0x21, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xff, 0x00, 0x19, 0xff, 0xff, 0x00, 0x15, 0xff, 0xff, 0x00, 0x12, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x0c, 0xff, 0xff, 0x00, 0x09, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0xff, 0x02, 0xff, 0x00, 0xff, 0x05, 0xff, 0x00, 0xff, 0x08, 0xff, 0x00, 0xff, 0x0c, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x13, 0xff, 0x00, 0xff, 0x16, 0xff, 0x00, 0xff, 0x19, 0xff, 0x00, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x21, 0xff, 0x00, 0xff, 0x25, 0xff, 0x00, 0xff, 0x27, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xff, 0x2d, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x31, 0xff, 0x00, 0xff, 0x34, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x37, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x41, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x47, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x4a, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x00, 0xff, 0x4c, 0xff, 0x00, 0xff, 0x4d, 0xff, 0x00, 0xff, 0x4f, 0xff, 0x00, 0xff, 0x50, 0xff, 0x00, 0xff, 0x50, 0xff, 0x01, 0xff, 0x51, 0xff, 0x00, 0xff, 0x53, 0xff, 0x00, 0xff, 0x53, 0xff, 0x00, 0xff, 0x54, 0xff, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x56, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x58, 0xff, 0x00, 0xff, 0x58, 0xff, 0x00, 0xff, 0x59, 0xff, 0x00, 0xff, 0x59, 0xff, 0x00, 0xff, 0x5b, 0xff, 0x00, 0xff, 0x5b, 0xff,
+    0x01, 0x59, 0xff, 0xff, 0x00, 0x59, 0xff, 0xff, 0x00, 0x58, 0xff, 0xff, 0x00, 0x58, 0xff, 0xff, 0x00, 0x57, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x54, 0xff, 0xff, 0x00, 0x53, 0xfe, 0xff, 0x00, 0x53, 0xff, 0xff, 0x00, 0x52, 0xff, 0xff, 0x00, 0x51, 0xff, 0xff, 0x00, 0x50, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x48, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x35, 0xff, 0xff, 0x00, 0x32, 0xff, 0xff, 0x00, 0x30, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x01, 0x2b, 0xff, 0xff, 0x00, 0x29, 0xff, 0xff, 0x00, 0x26, 0xff, 0xff, 0x00, 0x23, 0xff, 0xff, 0x00, 0x21, 0xff, 0xff, 0x00, 0x1d, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xff, 0x00, 0x18, 0xff, 0xff, 0x00, 0x15, 0xff, 0xff, 0x00, 0x12, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x0c, 0xff, 0xff, 0x00, 0x09, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0x02, 0xff, 0xff, 0x01, 0xff, 0x02, 0xff, 0x00, 0xff, 0x05, 0xff, 0x00, 0xff, 0x08, 0xff, 0x00, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x0e, 0xff, 0x00, 0xff, 0x11, 0xff, 0x00, 0xff, 0x15, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x21, 0xff, 0x00, 0xff, 0x23, 0xff, 0x00, 0xff, 0x26, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xff, 0x2b, 0xff, 0x00, 0xff, 0x2d, 0xff, 0x00, 0xff, 0x2f, 0xff, 0x00, 0xff, 0x32, 0xff, 0x00, 0xff, 0x34, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x41, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x47, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x49, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x00, 0xff, 0x4c, 0xff, 0x00, 0xff, 0x4c, 0xff, 0x00, 0xff, 0x4e, 0xff, 0x00, 0xff, 0x4f, 0xff, 0x00, 0xff, 0x50, 0xff, 0x00, 0xff, 0x51, 0xff, 0x00, 0xff, 0x52, 0xff, 0x00, 0xff, 0x53, 0xff, 0x00, 0xff, 0x53, 0xff, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x56, 0xff, 0x00, 0xff, 0x56, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xfe, 0x58, 0xff, 0x00, 0xff, 0x59, 0xff, 0x00, 0xff, 0x59, 0xff, 0x00, 0xff, 0x5a, 0xff,
+    0x00, 0x59, 0xff, 0xff, 0x00, 0x57, 0xff, 0xff, 0x00, 0x57, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x55, 0xff, 0xff, 0x00, 0x54, 0xff, 0xff, 0x00, 0x53, 0xff, 0xff, 0x00, 0x52, 0xff, 0xff, 0x00, 0x51, 0xff, 0xff, 0x00, 0x50, 0xff, 0xff, 0x00, 0x50, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x48, 0xff, 0xff, 0x00, 0x46, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x37, 0xff, 0xff, 0x00, 0x34, 0xff, 0xff, 0x00, 0x32, 0xff, 0xff, 0x00, 0x30, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x00, 0x2c, 0xff, 0xff, 0x00, 0x29, 0xff, 0xff, 0x00, 0x27, 0xff, 0xff, 0x00, 0x24, 0xff, 0xff, 0x00, 0x22, 0xff, 0xff, 0x00, 0x20, 0xff, 0xff, 0x00, 0x1c, 0xff, 0xff, 0x00, 0x1a, 0xff, 0xff, 0x00, 0x17, 0xff, 0xff, 0x00, 0x14, 0xff, 0xff, 0x00, 0x11, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x0a, 0xff, 0xff, 0x00, 0x08, 0xff, 0xff, 0x00, 0x04, 0xff, 0xff, 0x00, 0x02, 0xff, 0xff, 0x00, 0xff, 0x02, 0xff, 0x00, 0xff, 0x05, 0xff, 0x00, 0xff, 0x07, 0xff, 0x00, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x0e, 0xff, 0x00, 0xff, 0x11, 0xff, 0x00, 0xff, 0x14, 0xff, 0x00, 0xff, 0x17, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x22, 0xff, 0x00, 0xff, 0x24, 0xff, 0x00, 0xff, 0x27, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xff, 0x2c, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x30, 0xff, 0x00, 0xff, 0x32, 0xff, 0x00, 0xff, 0x35, 0xff, 0x00, 0xff, 0x37, 0xff, 0x00, 0xff, 0x39, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x41, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x47, 0xff, 0x00, 0xff, 0x49, 0xff, 0x00, 0xff, 0x4a, 0xff, 0x00, 0xfe, 0x4b, 0xff, 0x00, 0xff, 0x4d, 0xff, 0x00, 0xff, 0x4d, 0xff, 0x00, 0xff, 0x4e, 0xff, 0x00, 0xff, 0x50, 0xff, 0x00, 0xff, 0x50, 0xff, 0x00, 0xff, 0x51, 0xff, 0x00, 0xff, 0x52, 0xff, 0x00, 0xff, 0x53, 0xff, 0x00, 0xff, 0x54, 0xff, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x56, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x58, 0xff,
+    0x00, 0x58, 0xff, 0xff, 0x00, 0x57, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x55, 0xff, 0xff, 0x00, 0x54, 0xff, 0xff, 0x00, 0x53, 0xff, 0xff, 0x00, 0x53, 0xff, 0xff, 0x00, 0x51, 0xff, 0xff, 0x00, 0x51, 0xff, 0xff, 0x00, 0x50, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x4a, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x37, 0xff, 0xff, 0x00, 0x35, 0xff, 0xff, 0x00, 0x33, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xff, 0x00, 0x2a, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x00, 0x26, 0xff, 0xff, 0x00, 0x24, 0xff, 0xff, 0x00, 0x21, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xff, 0x00, 0x1c, 0xff, 0xff, 0x00, 0x19, 0xff, 0xff, 0x00, 0x16, 0xff, 0xff, 0x00, 0x13, 0xff, 0xff, 0x00, 0x11, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x00, 0x04, 0xff, 0xff, 0x00, 0x02, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x00, 0xff, 0x04, 0xff, 0x00, 0xff, 0x08, 0xff, 0x00, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x0d, 0xff, 0x00, 0xff, 0x11, 0xff, 0x00, 0xff, 0x13, 0xff, 0x00, 0xff, 0x17, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x21, 0xff, 0x00, 0xff, 0x23, 0xff, 0x00, 0xff, 0x26, 0xff, 0x00, 0xff, 0x28, 0xff, 0x00, 0xff, 0x2a, 0xff, 0x00, 0xff, 0x2d, 0xff, 0x00, 0xff, 0x2f, 0xff, 0x00, 0xff, 0x31, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x35, 0xff, 0x00, 0xff, 0x37, 0xff, 0x00, 0xff, 0x39, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x41, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x49, 0xff, 0x00, 0xff, 0x4a, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x00, 0xff, 0x4c, 0xff, 0x00, 0xff, 0x4d, 0xff, 0x00, 0xff, 0x4e, 0xff, 0x00, 0xff, 0x4f, 0xff, 0x00, 0xff, 0x50, 0xff, 0x00, 0xff, 0x51, 0xff, 0x00, 0xff, 0x52, 0xff, 0x00, 0xff, 0x53, 0xff, 0x00, 0xff, 0x54, 0xff, 0x00, 0xff, 0x54, 0xff, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x56, 0xff, 0x00, 0xff, 0x57, 0xff, 0x00, 0xff, 0x57, 0xff,
+    0x00, 0x56, 0xff, 0xff, 0x00, 0x56, 0xff, 0xff, 0x00, 0x54, 0xff, 0xff, 0x00, 0x54, 0xff, 0xff, 0x00, 0x53, 0xff, 0xff, 0x00, 0x52, 0xff, 0xff, 0x00, 0x52, 0xff, 0xff, 0x00, 0x50, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x48, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x46, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x35, 0xff, 0xff, 0x00, 0x34, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x30, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x00, 0x2c, 0xff, 0xff, 0x00, 0x29, 0xff, 0xff, 0x00, 0x27, 0xff, 0xff, 0x00, 0x24, 0xff, 0xff, 0x00, 0x22, 0xff, 0xff, 0x00, 0x20, 0xfe, 0xff, 0x00, 0x1d, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xff, 0x00, 0x18, 0xff, 0xff, 0x00, 0x16, 0xff, 0xff, 0x00, 0x12, 0xff, 0xff, 0x00, 0x10, 0xff, 0xff, 0x00, 0x0d, 0xff, 0xff, 0x00, 0x0a, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x00, 0x04, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0xff, 0x02, 0xff, 0x00, 0xff, 0x04, 0xff, 0x00, 0xff, 0x07, 0xff, 0x00, 0xff, 0x0a, 0xff, 0x00, 0xff, 0x0d, 0xff, 0x00, 0xff, 0x10, 0xff, 0x00, 0xff, 0x12, 0xff, 0x00, 0xff, 0x16, 0xff, 0x00, 0xff, 0x17, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x20, 0xff, 0x00, 0xff, 0x22, 0xff, 0x00, 0xff, 0x25, 0xff, 0x00, 0xff, 0x27, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xff, 0x2b, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x2f, 0xff, 0x00, 0xff, 0x32, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x37, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x40, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x47, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x49, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x00, 0xff, 0x4c, 0xff, 0x00, 0xff, 0x4d, 0xff, 0x00, 0xff, 0x4d, 0xff, 0x00, 0xff, 0x4f, 0xff, 0x00, 0xff, 0x50, 0xff, 0x00, 0xff, 0x50, 0xff, 0x00, 0xff, 0x51, 0xff, 0x00, 0xff, 0x52, 0xff, 0x00, 0xff, 0x53, 0xff, 0x00, 0xff, 0x54, 0xff, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x56, 0xff,
+    0x00, 0x55, 0xff, 0xff, 0x00, 0x54, 0xff, 0xff, 0x00, 0x54, 0xff, 0xff, 0x00, 0x52, 0xff, 0xff, 0x00, 0x52, 0xff, 0xff, 0x00, 0x51, 0xff, 0xff, 0x00, 0x50, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x01, 0x4c, 0xff, 0xff, 0x00, 0x4a, 0xff, 0xff, 0x00, 0x4a, 0xff, 0xff, 0x00, 0x48, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x37, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x34, 0xff, 0xff, 0x00, 0x32, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xff, 0x00, 0x2a, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x00, 0x26, 0xff, 0xff, 0x00, 0x23, 0xff, 0xff, 0x00, 0x21, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x1d, 0xff, 0xff, 0x00, 0x1a, 0xff, 0xff, 0x00, 0x17, 0xff, 0xff, 0x00, 0x15, 0xff, 0xff, 0x00, 0x12, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x0c, 0xff, 0xff, 0x00, 0x09, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x00, 0x04, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0xff, 0x02, 0xff, 0x00, 0xff, 0x05, 0xff, 0x00, 0xff, 0x07, 0xff, 0x00, 0xff, 0x0a, 0xff, 0x00, 0xff, 0x0d, 0xff, 0x00, 0xff, 0x10, 0xff, 0x00, 0xff, 0x12, 0xff, 0x00, 0xfe, 0x15, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x21, 0xff, 0x00, 0xff, 0x24, 0xff, 0x00, 0xff, 0x26, 0xff, 0x00, 0xff, 0x28, 0xff, 0x00, 0xff, 0x2a, 0xff, 0x00, 0xff, 0x2c, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x30, 0xff, 0x00, 0xff, 0x32, 0xff, 0x00, 0xff, 0x34, 0xff, 0x00, 0xff, 0x35, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xfe, 0x39, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x41, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x47, 0xff, 0x00, 0xff, 0x49, 0xff, 0x00, 0xff, 0x4a, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x00, 0xff, 0x4c, 0xff, 0x00, 0xff, 0x4c, 0xff, 0x00, 0xff, 0x4d, 0xff, 0x00, 0xff, 0x4e, 0xff, 0x00, 0xff, 0x4f, 0xff, 0x00, 0xff, 0x50, 0xff, 0x00, 0xff, 0x51, 0xff, 0x00, 0xff, 0x52, 0xff, 0x00, 0xff, 0x52, 0xff, 0x00, 0xff, 0x53, 0xff, 0x00, 0xff, 0x54, 0xff, 0x00, 0xff, 0x54, 0xff,
+    0x00, 0x53, 0xff, 0xff, 0x00, 0x53, 0xff, 0xff, 0x00, 0x52, 0xff, 0xff, 0x00, 0x51, 0xff, 0xff, 0x00, 0x50, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x4a, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x46, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x35, 0xff, 0xff, 0x00, 0x33, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xff, 0x00, 0x29, 0xff, 0xff, 0x00, 0x27, 0xff, 0xff, 0x00, 0x25, 0xff, 0xff, 0x00, 0x22, 0xff, 0xff, 0x00, 0x20, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xff, 0x00, 0x1c, 0xff, 0xff, 0x00, 0x19, 0xff, 0xff, 0x00, 0x17, 0xff, 0xff, 0x00, 0x14, 0xff, 0xff, 0x00, 0x12, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x0c, 0xff, 0xff, 0x00, 0x0a, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0x02, 0xff, 0xff, 0x00, 0xff, 0x02, 0xff, 0x00, 0xff, 0x04, 0xff, 0x00, 0xff, 0x07, 0xff, 0x00, 0xff, 0x09, 0xff, 0x00, 0xff, 0x0d, 0xff, 0x00, 0xff, 0x0e, 0xff, 0x00, 0xff, 0x12, 0xff, 0x00, 0xff, 0x14, 0xff, 0x00, 0xff, 0x16, 0xff, 0x00, 0xff, 0x19, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x20, 0xff, 0x00, 0xff, 0x22, 0xff, 0x00, 0xff, 0x25, 0xff, 0x00, 0xff, 0x27, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xff, 0x2b, 0xff, 0x00, 0xff, 0x2d, 0xff, 0x00, 0xff, 0x2f, 0xff, 0x00, 0xff, 0x31, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x34, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x40, 0xff, 0x00, 0xff, 0x41, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x47, 0xff, 0x00, 0xff, 0x48, 0xff, 0x01, 0xff, 0x49, 0xff, 0x00, 0xff, 0x4a, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x00, 0xff, 0x4c, 0xff, 0x00, 0xff, 0x4d, 0xff, 0x00, 0xff, 0x4f, 0xff, 0x00, 0xff, 0x4f, 0xff, 0x00, 0xff, 0x4f, 0xff, 0x00, 0xff, 0x51, 0xff, 0x00, 0xff, 0x51, 0xff, 0x00, 0xff, 0x52, 0xff, 0x00, 0xff, 0x53, 0xff, 0x00, 0xff, 0x53, 0xff,
+    0x00, 0x52, 0xff, 0xff, 0x00, 0x52, 0xff, 0xff, 0x00, 0x51, 0xff, 0xff, 0x00, 0x50, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x48, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x46, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x35, 0xfe, 0xff, 0x00, 0x34, 0xff, 0xff, 0x00, 0x32, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x01, 0x2b, 0xff, 0xff, 0x00, 0x2a, 0xff, 0xff, 0x00, 0x29, 0xff, 0xff, 0x00, 0x26, 0xff, 0xff, 0x00, 0x23, 0xff, 0xff, 0x00, 0x22, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x1d, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xff, 0x00, 0x18, 0xff, 0xff, 0x00, 0x16, 0xff, 0xff, 0x00, 0x14, 0xff, 0xff, 0x00, 0x11, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x0c, 0xff, 0xff, 0x00, 0x09, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x00, 0x04, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x00, 0xff, 0x04, 0xff, 0x00, 0xff, 0x06, 0xff, 0x00, 0xff, 0x09, 0xff, 0x00, 0xff, 0x0c, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x11, 0xff, 0x00, 0xff, 0x14, 0xff, 0x00, 0xff, 0x16, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x22, 0xff, 0x00, 0xff, 0x23, 0xff, 0x00, 0xff, 0x26, 0xff, 0x00, 0xff, 0x28, 0xff, 0x00, 0xff, 0x2a, 0xff, 0x00, 0xff, 0x2c, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x2f, 0xff, 0x00, 0xff, 0x31, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x35, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x39, 0xff, 0x00, 0xff, 0x39, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xfe, 0x3f, 0xff, 0x00, 0xff, 0x41, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x49, 0xff, 0x00, 0xff, 0x49, 0xff, 0x00, 0xff, 0x4a, 0xff, 0x00, 0xff, 0x4c, 0xff, 0x00, 0xff, 0x4d, 0xff, 0x00, 0xff, 0x4e, 0xff, 0x00, 0xff, 0x4f, 0xff, 0x00, 0xff, 0x4f, 0xff, 0x00, 0xff, 0x51, 0xff, 0x00, 0xff, 0x50, 0xff, 0x00, 0xff, 0x51, 0xff, 0x00, 0xff, 0x53, 0xff,
+    0x00, 0x51, 0xff, 0xff, 0x00, 0x50, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x47, 0xfe, 0xff, 0x00, 0x46, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x35, 0xff, 0xff, 0x00, 0x34, 0xff, 0xff, 0x00, 0x32, 0xff, 0xff, 0x00, 0x30, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x00, 0x2c, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xff, 0x00, 0x29, 0xff, 0xff, 0x00, 0x26, 0xff, 0xff, 0x00, 0x24, 0xff, 0xff, 0x00, 0x23, 0xff, 0xff, 0x00, 0x20, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x1c, 0xff, 0xff, 0x00, 0x1a, 0xff, 0xff, 0x00, 0x18, 0xff, 0xff, 0x00, 0x15, 0xff, 0xff, 0x00, 0x13, 0xff, 0xff, 0x00, 0x10, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x09, 0xff, 0xff, 0x00, 0x06, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x00, 0xff, 0x04, 0xff, 0x00, 0xff, 0x06, 0xff, 0x00, 0xff, 0x09, 0xff, 0x00, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x0e, 0xff, 0x00, 0xff, 0x10, 0xff, 0x00, 0xff, 0x12, 0xff, 0x00, 0xff, 0x15, 0xff, 0x00, 0xff, 0x17, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x1e, 0xff, 0x01, 0xff, 0x20, 0xff, 0x00, 0xff, 0x23, 0xff, 0x00, 0xff, 0x25, 0xff, 0x00, 0xff, 0x27, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xff, 0x2b, 0xff, 0x00, 0xff, 0x2d, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x30, 0xff, 0x00, 0xff, 0x32, 0xff, 0x00, 0xff, 0x34, 0xff, 0x00, 0xff, 0x35, 0xff, 0x00, 0xff, 0x37, 0xff, 0x00, 0xff, 0x38, 0xff, 0x01, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x41, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x47, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x49, 0xff, 0x00, 0xfe, 0x4b, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x00, 0xff, 0x4c, 0xff, 0x00, 0xff, 0x4d, 0xff, 0x00, 0xff, 0x4e, 0xff, 0x00, 0xff, 0x4f, 0xff, 0x00, 0xff, 0x50, 0xff, 0x00, 0xff, 0x51, 0xff, 0x00, 0xff, 0x51, 0xff,
+    0x00, 0x50, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x4a, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x48, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x46, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x37, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x34, 0xff, 0xff, 0x00, 0x33, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xff, 0x00, 0x29, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x00, 0x25, 0xff, 0xff, 0x00, 0x24, 0xff, 0xff, 0x00, 0x22, 0xff, 0xff, 0x00, 0x20, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xff, 0x00, 0x19, 0xff, 0xff, 0x00, 0x17, 0xff, 0xff, 0x00, 0x15, 0xff, 0xff, 0x00, 0x12, 0xff, 0xff, 0x00, 0x10, 0xff, 0xff, 0x00, 0x0d, 0xff, 0xff, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x09, 0xff, 0xff, 0x00, 0x06, 0xff, 0xff, 0x00, 0x04, 0xff, 0xff, 0x00, 0x02, 0xff, 0xff, 0x00, 0xff, 0x02, 0xff, 0x00, 0xff, 0x04, 0xff, 0x00, 0xff, 0x06, 0xff, 0x00, 0xff, 0x09, 0xff, 0x00, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x0d, 0xff, 0x00, 0xff, 0x10, 0xff, 0x00, 0xff, 0x12, 0xff, 0x00, 0xff, 0x14, 0xff, 0x00, 0xff, 0x16, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x20, 0xff, 0x00, 0xff, 0x22, 0xff, 0x00, 0xff, 0x24, 0xff, 0x00, 0xff, 0x26, 0xff, 0x00, 0xff, 0x28, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xfe, 0x2c, 0xff, 0x00, 0xff, 0x2d, 0xff, 0x00, 0xff, 0x2f, 0xff, 0x00, 0xff, 0x30, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x34, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xff, 0x39, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x40, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x47, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x49, 0xff, 0x00, 0xff, 0x4a, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x00, 0xff, 0x4c, 0xff, 0x00, 0xff, 0x4c, 0xff, 0x00, 0xff, 0x4e, 0xff, 0x00, 0xff, 0x4e, 0xff, 0x00, 0xff, 0x4f, 0xff, 0x00, 0xff, 0x50, 0xff,
+    0x00, 0x4f, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x4a, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x35, 0xff, 0xff, 0x00, 0x33, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x30, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x00, 0x2c, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xff, 0x00, 0x29, 0xff, 0xff, 0x00, 0x27, 0xff, 0xff, 0x00, 0x25, 0xff, 0xff, 0x00, 0x23, 0xff, 0xff, 0x00, 0x21, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x1d, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xff, 0x00, 0x18, 0xff, 0xff, 0x00, 0x16, 0xff, 0xff, 0x00, 0x14, 0xff, 0xff, 0x00, 0x12, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x08, 0xff, 0xff, 0x00, 0x06, 0xff, 0xff, 0x00, 0x04, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x00, 0xff, 0x04, 0xff, 0x00, 0xff, 0x06, 0xff, 0x00, 0xff, 0x08, 0xff, 0x00, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x0d, 0xff, 0x00, 0xff, 0x10, 0xff, 0x00, 0xff, 0x11, 0xff, 0x00, 0xff, 0x14, 0xff, 0x00, 0xff, 0x16, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x21, 0xff, 0x00, 0xff, 0x23, 0xff, 0x00, 0xff, 0x25, 0xff, 0x00, 0xff, 0x27, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xff, 0x2a, 0xff, 0x00, 0xff, 0x2c, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x2f, 0xff, 0x00, 0xff, 0x31, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x35, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x37, 0xff, 0x00, 0xff, 0x39, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x01, 0xff, 0x41, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x47, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x4a, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x00, 0xff, 0x4c, 0xff, 0x00, 0xff, 0x4d, 0xff, 0x00, 0xff, 0x4d, 0xff, 0x00, 0xff, 0x4e, 0xff, 0x00, 0xff, 0x4f, 0xff,
+    0x00, 0x4e, 0xff, 0xff, 0x00, 0x4d, 0xff, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x4a, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x48, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x3f, 0xfe, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x37, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x35, 0xff, 0xff, 0x00, 0x33, 0xff, 0xff, 0x00, 0x32, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xff, 0x00, 0x29, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x00, 0x26, 0xff, 0xff, 0x00, 0x24, 0xff, 0xff, 0x00, 0x22, 0xff, 0xff, 0x00, 0x20, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xff, 0x00, 0x1c, 0xff, 0xff, 0x00, 0x1a, 0xff, 0xff, 0x00, 0x18, 0xff, 0xff, 0x00, 0x16, 0xff, 0xff, 0x00, 0x13, 0xff, 0xff, 0x00, 0x11, 0xff, 0xff, 0x00, 0x10, 0xff, 0xff, 0x01, 0x0d, 0xff, 0xff, 0x00, 0x0a, 0xff, 0xff, 0x00, 0x08, 0xff, 0xff, 0x00, 0x06, 0xff, 0xff, 0x00, 0x04, 0xff, 0xff, 0x00, 0x02, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x00, 0xff, 0x04, 0xff, 0x00, 0xff, 0x06, 0xff, 0x00, 0xff, 0x08, 0xff, 0x01, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x0d, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x11, 0xff, 0x00, 0xff, 0x13, 0xff, 0x00, 0xff, 0x16, 0xff, 0x00, 0xff, 0x17, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x20, 0xff, 0x00, 0xff, 0x22, 0xff, 0x00, 0xff, 0x23, 0xff, 0x00, 0xff, 0x25, 0xff, 0x00, 0xff, 0x27, 0xff, 0x00, 0xff, 0x2a, 0xff, 0x00, 0xff, 0x2b, 0xff, 0x00, 0xff, 0x2d, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x30, 0xff, 0x00, 0xff, 0x32, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x35, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xff, 0x39, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x41, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x47, 0xff, 0x00, 0xff, 0x47, 0xff, 0x00, 0xff, 0x49, 0xff, 0x00, 0xff, 0x4a, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x00, 0xff, 0x4c, 0xff, 0x00, 0xfe, 0x4d, 0xff, 0x00, 0xff, 0x4d, 0xff,
+    0x00, 0x4d, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x4a, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x48, 0xff, 0xff, 0x00, 0x46, 0xff, 0xff, 0x00, 0x46, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x37, 0xff, 0xff, 0x00, 0x35, 0xff, 0xff, 0x00, 0x34, 0xff, 0xff, 0x00, 0x32, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xff, 0x00, 0x2a, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x00, 0x26, 0xff, 0xff, 0x00, 0x25, 0xff, 0xff, 0x00, 0x23, 0xff, 0xff, 0x00, 0x21, 0xff, 0xff, 0x00, 0x20, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xff, 0x00, 0x19, 0xff, 0xff, 0x00, 0x17, 0xff, 0xff, 0x00, 0x15, 0xff, 0xff, 0x00, 0x13, 0xff, 0xff, 0x00, 0x11, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x0c, 0xff, 0xff, 0x00, 0x0a, 0xfe, 0xff, 0x00, 0x08, 0xff, 0xff, 0x00, 0x06, 0xff, 0xff, 0x00, 0x04, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x00, 0xff, 0x04, 0xff, 0x00, 0xff, 0x06, 0xff, 0x00, 0xff, 0x08, 0xff, 0x00, 0xff, 0x0a, 0xff, 0x00, 0xff, 0x0c, 0xff, 0x00, 0xff, 0x0e, 0xff, 0x00, 0xff, 0x11, 0xff, 0x00, 0xff, 0x13, 0xff, 0x00, 0xff, 0x15, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x19, 0xff, 0x00, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x21, 0xff, 0x00, 0xff, 0x23, 0xff, 0x00, 0xff, 0x25, 0xff, 0x00, 0xff, 0x27, 0xff, 0x00, 0xff, 0x28, 0xff, 0x00, 0xff, 0x2a, 0xff, 0x00, 0xff, 0x2c, 0xff, 0x00, 0xff, 0x2d, 0xff, 0x00, 0xff, 0x2f, 0xff, 0x00, 0xff, 0x31, 0xff, 0x00, 0xff, 0x32, 0xff, 0x00, 0xff, 0x34, 0xff, 0x00, 0xff, 0x35, 0xff, 0x01, 0xff, 0x36, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xff, 0x39, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x40, 0xff, 0x00, 0xff, 0x40, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x47, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x49, 0xff, 0x00, 0xff, 0x4a, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x01, 0xff, 0x4c, 0xff, 0x00, 0xff, 0x4d, 0xff,
+    0x00, 0x4b, 0xff, 0xff, 0x00, 0x4b, 0xff, 0xff, 0x00, 0x4a, 0xff, 0xff, 0x00, 0x4a, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x46, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x35, 0xff, 0xff, 0x00, 0x34, 0xff, 0xff, 0x00, 0x33, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xff, 0x00, 0x2a, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x00, 0x26, 0xff, 0xff, 0x00, 0x24, 0xff, 0xff, 0x00, 0x22, 0xff, 0xff, 0x00, 0x20, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xff, 0x00, 0x1d, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xff, 0x00, 0x19, 0xff, 0xff, 0x00, 0x16, 0xff, 0xff, 0x00, 0x15, 0xff, 0xff, 0x00, 0x12, 0xff, 0xff, 0x00, 0x10, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x0c, 0xff, 0xff, 0x00, 0x0a, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x05, 0xff, 0x00, 0xff, 0x07, 0xff, 0x00, 0xff, 0x0a, 0xff, 0x00, 0xff, 0x0c, 0xff, 0x00, 0xff, 0x0e, 0xff, 0x00, 0xff, 0x10, 0xff, 0x00, 0xff, 0x13, 0xff, 0x00, 0xff, 0x14, 0xff, 0x00, 0xff, 0x17, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x20, 0xff, 0x00, 0xff, 0x22, 0xff, 0x00, 0xff, 0x24, 0xff, 0x00, 0xff, 0x26, 0xff, 0x01, 0xff, 0x28, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xff, 0x2b, 0xff, 0x00, 0xff, 0x2d, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x2f, 0xff, 0x00, 0xff, 0x32, 0xff, 0x00, 0xff, 0x32, 0xff, 0x00, 0xff, 0x34, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x37, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x40, 0xff, 0x00, 0xff, 0x41, 0xff, 0x00, 0xff, 0x41, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x46, 0xff, 0x01, 0xff, 0x47, 0xff, 0x00, 0xff, 0x49, 0xff, 0x00, 0xff, 0x4a, 0xff, 0x00, 0xff, 0x4a, 0xff, 0x00, 0xff, 0x4a, 0xff, 0x00, 0xff, 0x4c, 0xff,
+    0x00, 0x4b, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x49, 0xff, 0xff, 0x00, 0x48, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x46, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x37, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x35, 0xff, 0xff, 0x00, 0x33, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x30, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xff, 0x00, 0x2c, 0xff, 0xff, 0x00, 0x2a, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x00, 0x26, 0xff, 0xff, 0x00, 0x25, 0xff, 0xff, 0x00, 0x23, 0xff, 0xff, 0x00, 0x21, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x1d, 0xff, 0xff, 0x00, 0x1c, 0xff, 0xff, 0x00, 0x1a, 0xff, 0xff, 0x00, 0x18, 0xff, 0xff, 0x00, 0x16, 0xff, 0xff, 0x00, 0x14, 0xff, 0xff, 0x00, 0x12, 0xff, 0xff, 0x00, 0x10, 0xff, 0xff, 0x00, 0x0e, 0xfe, 0xff, 0x00, 0x0c, 0xff, 0xff, 0x00, 0x09, 0xff, 0xff, 0x00, 0x08, 0xff, 0xff, 0x00, 0x06, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0xff, 0x02, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x05, 0xff, 0x00, 0xff, 0x08, 0xff, 0x00, 0xff, 0x09, 0xff, 0x00, 0xff, 0x0c, 0xff, 0x00, 0xff, 0x0e, 0xff, 0x00, 0xff, 0x10, 0xff, 0x00, 0xff, 0x12, 0xff, 0x00, 0xff, 0x14, 0xff, 0x00, 0xff, 0x16, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x20, 0xff, 0x00, 0xff, 0x21, 0xff, 0x00, 0xff, 0x23, 0xff, 0x00, 0xff, 0x25, 0xff, 0x00, 0xff, 0x27, 0xff, 0x00, 0xff, 0x28, 0xff, 0x00, 0xff, 0x2a, 0xff, 0x00, 0xff, 0x2c, 0xff, 0x00, 0xff, 0x2d, 0xff, 0x00, 0xff, 0x2f, 0xff, 0x00, 0xff, 0x31, 0xff, 0x00, 0xff, 0x31, 0xff, 0x01, 0xff, 0x33, 0xff, 0x00, 0xff, 0x35, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x37, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x40, 0xff, 0x00, 0xff, 0x41, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x49, 0xff, 0x00, 0xff, 0x4a, 0xff,
+    0x00, 0x49, 0xff, 0xff, 0x00, 0x48, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x46, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x37, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x34, 0xff, 0xff, 0x00, 0x34, 0xff, 0xff, 0x00, 0x33, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x00, 0x2c, 0xff, 0xff, 0x00, 0x2a, 0xff, 0xff, 0x00, 0x29, 0xff, 0xff, 0x00, 0x27, 0xff, 0xff, 0x00, 0x26, 0xff, 0xff, 0x00, 0x24, 0xff, 0xff, 0x00, 0x22, 0xff, 0xff, 0x00, 0x21, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x1d, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xff, 0x00, 0x19, 0xff, 0xff, 0x00, 0x17, 0xff, 0xff, 0x00, 0x15, 0xff, 0xff, 0x00, 0x14, 0xff, 0xff, 0x00, 0x12, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x0a, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x00, 0x06, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x05, 0xff, 0x00, 0xff, 0x07, 0xff, 0x00, 0xff, 0x0a, 0xff, 0x00, 0xff, 0x0c, 0xff, 0x00, 0xff, 0x0d, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x11, 0xff, 0x00, 0xff, 0x13, 0xff, 0x00, 0xff, 0x16, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x19, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x21, 0xff, 0x00, 0xff, 0x23, 0xff, 0x00, 0xff, 0x24, 0xff, 0x00, 0xff, 0x26, 0xff, 0x00, 0xff, 0x28, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xff, 0x2b, 0xff, 0x00, 0xff, 0x2c, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x2f, 0xff, 0x00, 0xff, 0x31, 0xff, 0x00, 0xff, 0x32, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x34, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x37, 0xff, 0x00, 0xff, 0x39, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x01, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x41, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x47, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x4a, 0xff,
+    0x00, 0x49, 0xff, 0xff, 0x00, 0x48, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x35, 0xff, 0xff, 0x00, 0x33, 0xff, 0xff, 0x00, 0x32, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xff, 0x00, 0x2c, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x00, 0x27, 0xff, 0xff, 0x00, 0x25, 0xff, 0xff, 0x00, 0x24, 0xff, 0xff, 0x00, 0x21, 0xff, 0xff, 0x00, 0x20, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xff, 0x00, 0x1d, 0xff, 0xff, 0x00, 0x1a, 0xff, 0xff, 0x00, 0x19, 0xff, 0xff, 0x00, 0x16, 0xff, 0xff, 0x00, 0x15, 0xff, 0xff, 0x00, 0x13, 0xff, 0xff, 0x00, 0x11, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x0d, 0xff, 0xff, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x09, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x01, 0x03, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x05, 0xff, 0x00, 0xff, 0x07, 0xff, 0x00, 0xff, 0x09, 0xff, 0x00, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x0e, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x11, 0xff, 0x00, 0xff, 0x13, 0xff, 0x00, 0xff, 0x15, 0xff, 0x00, 0xff, 0x16, 0xff, 0x00, 0xff, 0x19, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x21, 0xff, 0x00, 0xff, 0x24, 0xff, 0x00, 0xff, 0x25, 0xff, 0x00, 0xff, 0x27, 0xff, 0x00, 0xff, 0x28, 0xff, 0x00, 0xff, 0x2a, 0xff, 0x00, 0xff, 0x2b, 0xff, 0x00, 0xff, 0x2d, 0xff, 0x00, 0xff, 0x2f, 0xff, 0x00, 0xff, 0x30, 0xff, 0x00, 0xff, 0x31, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x34, 0xff, 0x00, 0xff, 0x35, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xff, 0x39, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x40, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x48, 0xff, 0x00, 0xff, 0x49, 0xff,
+    0x00, 0x47, 0xff, 0xff, 0x00, 0x47, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x35, 0xff, 0xff, 0x00, 0x34, 0xff, 0xff, 0x00, 0x33, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x00, 0x2c, 0xff, 0xff, 0x00, 0x2a, 0xff, 0xff, 0x00, 0x29, 0xff, 0xff, 0x00, 0x27, 0xff, 0xff, 0x00, 0x26, 0xff, 0xff, 0x00, 0x24, 0xff, 0xff, 0x00, 0x22, 0xff, 0xff, 0x00, 0x21, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xff, 0x00, 0x1a, 0xff, 0xff, 0x00, 0x18, 0xff, 0xff, 0x00, 0x16, 0xff, 0xff, 0x00, 0x14, 0xff, 0xff, 0x00, 0x12, 0xff, 0xff, 0x00, 0x11, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x0d, 0xff, 0xff, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x09, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x05, 0xff, 0x00, 0xff, 0x07, 0xff, 0x00, 0xff, 0x09, 0xff, 0x00, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x0d, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x11, 0xff, 0x00, 0xff, 0x13, 0xff, 0x00, 0xff, 0x14, 0xff, 0x00, 0xff, 0x17, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x21, 0xff, 0x00, 0xff, 0x22, 0xff, 0x00, 0xff, 0x24, 0xff, 0x00, 0xff, 0x26, 0xff, 0x00, 0xff, 0x27, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xff, 0x2b, 0xff, 0x00, 0xff, 0x2b, 0xff, 0x00, 0xff, 0x2d, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x30, 0xff, 0x00, 0xff, 0x32, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x35, 0xff, 0x00, 0xff, 0x35, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x40, 0xff, 0x00, 0xff, 0x40, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x46, 0xff, 0x00, 0xff, 0x47, 0xff, 0x00, 0xff, 0x48, 0xff,
+    0x00, 0x47, 0xff, 0xff, 0x00, 0x46, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x35, 0xff, 0xff, 0x00, 0x34, 0xff, 0xff, 0x00, 0x33, 0xff, 0xff, 0x00, 0x32, 0xff, 0xff, 0x00, 0x30, 0xff, 0xff, 0x00, 0x30, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x00, 0x2c, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xff, 0x00, 0x29, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x00, 0x26, 0xff, 0xff, 0x00, 0x25, 0xff, 0xff, 0x00, 0x23, 0xff, 0xff, 0x00, 0x22, 0xff, 0xff, 0x00, 0x21, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x1d, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xff, 0x00, 0x1a, 0xff, 0xff, 0x00, 0x18, 0xff, 0xff, 0x00, 0x15, 0xff, 0xff, 0x00, 0x14, 0xff, 0xff, 0x00, 0x12, 0xff, 0xff, 0x00, 0x11, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x0d, 0xff, 0xff, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x09, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x04, 0xff, 0x00, 0xff, 0x07, 0xff, 0x00, 0xff, 0x09, 0xff, 0x00, 0xff, 0x0a, 0xff, 0x00, 0xff, 0x0d, 0xff, 0x00, 0xff, 0x0e, 0xff, 0x00, 0xff, 0x10, 0xff, 0x00, 0xff, 0x13, 0xff, 0x00, 0xff, 0x14, 0xff, 0x00, 0xff, 0x16, 0xff, 0x00, 0xff, 0x18, 0xff, 0x01, 0xff, 0x19, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x20, 0xff, 0x00, 0xff, 0x22, 0xff, 0x00, 0xff, 0x23, 0xff, 0x00, 0xff, 0x25, 0xff, 0x00, 0xff, 0x26, 0xff, 0x00, 0xff, 0x28, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xff, 0x2b, 0xff, 0x00, 0xff, 0x2c, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x2f, 0xff, 0x00, 0xff, 0x30, 0xff, 0x00, 0xff, 0x32, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x34, 0xff, 0x00, 0xff, 0x35, 0xff, 0x00, 0xff, 0x37, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xff, 0x39, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x40, 0xff, 0x00, 0xff, 0x40, 0xff, 0x00, 0xff, 0x41, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x47, 0xff,
+    0x00, 0x46, 0xff, 0xff, 0x00, 0x45, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x34, 0xff, 0xff, 0x00, 0x34, 0xff, 0xff, 0x00, 0x32, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x30, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xff, 0x00, 0x2c, 0xff, 0xff, 0x00, 0x2a, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x00, 0x27, 0xff, 0xff, 0x00, 0x26, 0xff, 0xff, 0x00, 0x24, 0xff, 0xff, 0x00, 0x23, 0xff, 0xff, 0x00, 0x21, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xff, 0x00, 0x1c, 0xff, 0xff, 0x00, 0x1a, 0xff, 0xff, 0x00, 0x18, 0xff, 0xff, 0x00, 0x17, 0xff, 0xff, 0x00, 0x16, 0xff, 0xff, 0x00, 0x14, 0xff, 0xff, 0x00, 0x11, 0xff, 0xff, 0x00, 0x10, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x0c, 0xff, 0xff, 0x00, 0x0a, 0xff, 0xff, 0x00, 0x09, 0xff, 0xff, 0x00, 0x06, 0xff, 0xff, 0x00, 0x04, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x05, 0xff, 0x00, 0xff, 0x06, 0xff, 0x00, 0xff, 0x08, 0xff, 0x00, 0xff, 0x0a, 0xff, 0x00, 0xff, 0x0d, 0xff, 0x00, 0xff, 0x0e, 0xff, 0x00, 0xff, 0x10, 0xff, 0x00, 0xff, 0x12, 0xff, 0x00, 0xff, 0x14, 0xff, 0x00, 0xff, 0x15, 0xff, 0x00, 0xff, 0x17, 0xff, 0x00, 0xff, 0x19, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x20, 0xff, 0x00, 0xff, 0x21, 0xff, 0x00, 0xff, 0x23, 0xff, 0x00, 0xff, 0x24, 0xff, 0x01, 0xff, 0x25, 0xff, 0x00, 0xff, 0x27, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xff, 0x2a, 0xff, 0x00, 0xff, 0x2c, 0xff, 0x00, 0xff, 0x2d, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x30, 0xff, 0x00, 0xff, 0x31, 0xff, 0x00, 0xff, 0x32, 0xff, 0x00, 0xff, 0x34, 0xff, 0x00, 0xff, 0x34, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x37, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x40, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x45, 0xff, 0x00, 0xff, 0x45, 0xff,
+    0x00, 0x44, 0xff, 0xff, 0x00, 0x44, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x37, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x35, 0xff, 0xff, 0x00, 0x34, 0xff, 0xff, 0x00, 0x33, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x30, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x00, 0x2c, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x00, 0x27, 0xff, 0xff, 0x00, 0x25, 0xff, 0xff, 0x00, 0x24, 0xff, 0xff, 0x00, 0x22, 0xff, 0xff, 0x00, 0x20, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xff, 0x00, 0x1c, 0xff, 0xff, 0x00, 0x1a, 0xff, 0xff, 0x00, 0x18, 0xff, 0xff, 0x00, 0x17, 0xff, 0xff, 0x00, 0x15, 0xff, 0xff, 0x00, 0x13, 0xff, 0xff, 0x00, 0x11, 0xff, 0xff, 0x00, 0x10, 0xff, 0xff, 0x01, 0x0e, 0xff, 0xff, 0x00, 0x0c, 0xff, 0xff, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x08, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x00, 0x04, 0xff, 0xff, 0x00, 0x02, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x04, 0xff, 0x00, 0xff, 0x07, 0xff, 0x00, 0xff, 0x08, 0xff, 0x00, 0xff, 0x0a, 0xff, 0x00, 0xff, 0x0c, 0xff, 0x00, 0xff, 0x0e, 0xff, 0x00, 0xff, 0x10, 0xff, 0x00, 0xff, 0x11, 0xff, 0x00, 0xff, 0x13, 0xff, 0x00, 0xff, 0x15, 0xff, 0x00, 0xff, 0x17, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x20, 0xff, 0x00, 0xff, 0x22, 0xff, 0x00, 0xff, 0x24, 0xff, 0x00, 0xff, 0x25, 0xff, 0x00, 0xff, 0x27, 0xff, 0x00, 0xff, 0x27, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xff, 0x2b, 0xff, 0x00, 0xff, 0x2c, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x30, 0xff, 0x00, 0xff, 0x31, 0xff, 0x00, 0xff, 0x32, 0xff, 0x00, 0xff, 0x34, 0xff, 0x00, 0xff, 0x35, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x37, 0xff, 0x00, 0xff, 0x39, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x40, 0xff, 0x00, 0xff, 0x41, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x43, 0xff, 0x00, 0xff, 0x44, 0xff, 0x00, 0xff, 0x45, 0xff,
+    0x00, 0x44, 0xff, 0xff, 0x00, 0x43, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x35, 0xff, 0xff, 0x00, 0x34, 0xff, 0xff, 0x00, 0x33, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x30, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xff, 0x01, 0x2d, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xff, 0x00, 0x29, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x01, 0x28, 0xff, 0xff, 0x00, 0x26, 0xff, 0xff, 0x00, 0x24, 0xff, 0xff, 0x00, 0x22, 0xff, 0xff, 0x00, 0x21, 0xff, 0xff, 0x00, 0x20, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x1d, 0xff, 0xff, 0x00, 0x1c, 0xff, 0xff, 0x00, 0x1a, 0xff, 0xff, 0x00, 0x18, 0xff, 0xff, 0x00, 0x16, 0xff, 0xff, 0x00, 0x15, 0xff, 0xff, 0x00, 0x13, 0xff, 0xff, 0x00, 0x11, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x0d, 0xff, 0xff, 0x00, 0x0c, 0xff, 0xff, 0x00, 0x0a, 0xff, 0xff, 0x00, 0x08, 0xff, 0xff, 0x00, 0x06, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x02, 0xff, 0x00, 0xff, 0x04, 0xff, 0x00, 0xff, 0x06, 0xff, 0x00, 0xff, 0x08, 0xff, 0x00, 0xff, 0x0a, 0xff, 0x00, 0xff, 0x0c, 0xff, 0x00, 0xff, 0x0d, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x11, 0xff, 0x00, 0xff, 0x13, 0xff, 0x00, 0xff, 0x14, 0xff, 0x00, 0xff, 0x16, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x19, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x20, 0xff, 0x00, 0xff, 0x21, 0xff, 0x00, 0xff, 0x23, 0xff, 0x00, 0xff, 0x24, 0xff, 0x00, 0xff, 0x26, 0xff, 0x00, 0xff, 0x27, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xff, 0x2a, 0xff, 0x00, 0xff, 0x2b, 0xff, 0x00, 0xff, 0x2d, 0xff, 0x00, 0xff, 0x2d, 0xff, 0x00, 0xff, 0x2f, 0xff, 0x00, 0xff, 0x30, 0xff, 0x00, 0xff, 0x32, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x34, 0xff, 0x00, 0xff, 0x35, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xff, 0x39, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x40, 0xff, 0x00, 0xff, 0x40, 0xff, 0x00, 0xff, 0x41, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xfe, 0x43, 0xff, 0x00, 0xff, 0x43, 0xff,
+    0x00, 0x43, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x01, 0x35, 0xff, 0xff, 0x00, 0x34, 0xff, 0xff, 0x00, 0x32, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xff, 0x01, 0x2c, 0xff, 0xff, 0x00, 0x2a, 0xff, 0xff, 0x00, 0x29, 0xfe, 0xff, 0x00, 0x28, 0xff, 0xff, 0x01, 0x26, 0xff, 0xff, 0x00, 0x25, 0xff, 0xff, 0x00, 0x24, 0xff, 0xff, 0x00, 0x22, 0xff, 0xff, 0x00, 0x21, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xff, 0x00, 0x1c, 0xff, 0xff, 0x00, 0x1a, 0xff, 0xff, 0x00, 0x19, 0xff, 0xff, 0x00, 0x17, 0xff, 0xff, 0x00, 0x15, 0xff, 0xff, 0x00, 0x14, 0xff, 0xff, 0x00, 0x12, 0xff, 0xff, 0x00, 0x11, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x0c, 0xff, 0xff, 0x00, 0x0a, 0xff, 0xff, 0x00, 0x08, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0x02, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x04, 0xff, 0x00, 0xff, 0x06, 0xff, 0x00, 0xff, 0x08, 0xff, 0x00, 0xff, 0x0a, 0xff, 0x00, 0xff, 0x0c, 0xff, 0x00, 0xff, 0x0d, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x11, 0xff, 0x00, 0xff, 0x13, 0xff, 0x00, 0xff, 0x14, 0xff, 0x00, 0xff, 0x16, 0xff, 0x00, 0xff, 0x17, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x21, 0xff, 0x00, 0xff, 0x23, 0xff, 0x00, 0xff, 0x24, 0xff, 0x00, 0xff, 0x25, 0xff, 0x00, 0xff, 0x26, 0xff, 0x00, 0xff, 0x27, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xff, 0x2a, 0xff, 0x00, 0xff, 0x2c, 0xff, 0x00, 0xff, 0x2d, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x30, 0xff, 0x00, 0xff, 0x30, 0xff, 0x00, 0xff, 0x32, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x35, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x37, 0xff, 0x00, 0xff, 0x37, 0xff, 0x00, 0xff, 0x39, 0xff, 0x00, 0xff, 0x39, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x40, 0xff, 0x00, 0xff, 0x40, 0xff, 0x00, 0xff, 0x41, 0xff, 0x00, 0xff, 0x42, 0xff, 0x00, 0xff, 0x43, 0xff,
+    0x00, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x36, 0xfe, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x35, 0xff, 0xff, 0x00, 0x34, 0xff, 0xff, 0x00, 0x32, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x30, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xff, 0x00, 0x2a, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x00, 0x27, 0xff, 0xff, 0x00, 0x26, 0xff, 0xff, 0x00, 0x25, 0xff, 0xff, 0x00, 0x23, 0xff, 0xff, 0x00, 0x21, 0xff, 0xff, 0x00, 0x20, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xff, 0x00, 0x1d, 0xff, 0xff, 0x00, 0x1c, 0xff, 0xff, 0x00, 0x1a, 0xff, 0xff, 0x00, 0x19, 0xff, 0xff, 0x00, 0x16, 0xff, 0xff, 0x00, 0x15, 0xff, 0xff, 0x00, 0x13, 0xff, 0xff, 0x00, 0x12, 0xff, 0xff, 0x00, 0x11, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x0d, 0xff, 0xff, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x09, 0xff, 0xff, 0x00, 0x08, 0xff, 0xff, 0x00, 0x06, 0xff, 0xff, 0x00, 0x04, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x04, 0xff, 0x00, 0xff, 0x06, 0xff, 0x00, 0xff, 0x07, 0xff, 0x00, 0xff, 0x0a, 0xff, 0x00, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x0d, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x10, 0xff, 0x00, 0xff, 0x12, 0xff, 0x00, 0xff, 0x14, 0xff, 0x00, 0xff, 0x15, 0xff, 0x00, 0xff, 0x17, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x20, 0xff, 0x00, 0xff, 0x22, 0xff, 0x00, 0xff, 0x23, 0xff, 0x00, 0xff, 0x25, 0xff, 0x00, 0xff, 0x26, 0xff, 0x00, 0xff, 0x27, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xff, 0x2a, 0xff, 0x00, 0xff, 0x2b, 0xff, 0x00, 0xff, 0x2d, 0xff, 0x00, 0xff, 0x2d, 0xff, 0x00, 0xff, 0x2f, 0xff, 0x00, 0xff, 0x30, 0xff, 0x00, 0xff, 0x31, 0xff, 0x00, 0xff, 0x32, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x35, 0xff, 0x01, 0xff, 0x36, 0xff, 0x00, 0xff, 0x37, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xff, 0x39, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x40, 0xff, 0x00, 0xff, 0x40, 0xff, 0x00, 0xff, 0x41, 0xff, 0x00, 0xff, 0x42, 0xff,
+    0x00, 0x41, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x01, 0x3b, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x39, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x36, 0xfe, 0xff, 0x00, 0x35, 0xff, 0xff, 0x00, 0x34, 0xff, 0xff, 0x00, 0x33, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x31, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xff, 0x00, 0x29, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x00, 0x27, 0xff, 0xff, 0x00, 0x25, 0xff, 0xff, 0x00, 0x24, 0xff, 0xff, 0x00, 0x22, 0xff, 0xff, 0x00, 0x20, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xff, 0x00, 0x1c, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xff, 0x00, 0x19, 0xff, 0xff, 0x00, 0x17, 0xff, 0xff, 0x00, 0x16, 0xff, 0xff, 0x00, 0x15, 0xff, 0xff, 0x00, 0x13, 0xff, 0xff, 0x00, 0x11, 0xff, 0xff, 0x00, 0x10, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x0d, 0xff, 0xff, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x0a, 0xff, 0xff, 0x00, 0x08, 0xff, 0xff, 0x00, 0x06, 0xff, 0xff, 0x00, 0x04, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x04, 0xff, 0x00, 0xff, 0x06, 0xff, 0x00, 0xff, 0x07, 0xff, 0x00, 0xff, 0x0a, 0xff, 0x00, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x0c, 0xff, 0x00, 0xff, 0x0e, 0xff, 0x00, 0xff, 0x10, 0xff, 0x00, 0xff, 0x12, 0xff, 0x00, 0xff, 0x13, 0xff, 0x00, 0xff, 0x14, 0xff, 0x00, 0xff, 0x16, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x19, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x21, 0xff, 0x00, 0xff, 0x22, 0xff, 0x00, 0xff, 0x24, 0xff, 0x00, 0xff, 0x25, 0xff, 0x00, 0xff, 0x27, 0xff, 0x00, 0xff, 0x28, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xff, 0x2a, 0xff, 0x00, 0xff, 0x2c, 0xff, 0x00, 0xff, 0x2d, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x30, 0xff, 0x00, 0xff, 0x31, 0xff, 0x00, 0xff, 0x31, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x34, 0xff, 0x00, 0xff, 0x35, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x37, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xff, 0x39, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x40, 0xff, 0x00, 0xff, 0x40, 0xff, 0x00, 0xff, 0x42, 0xff,
+    0x00, 0x40, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xff, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x38, 0xff, 0xff, 0x00, 0x37, 0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x35, 0xff, 0xff, 0x00, 0x34, 0xff, 0xff, 0x00, 0x33, 0xff, 0xff, 0x00, 0x32, 0xff, 0xff, 0x00, 0x30, 0xff, 0xff, 0x00, 0x30, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x00, 0x2e, 0xff, 0xff, 0x00, 0x2c, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xff, 0x00, 0x2a, 0xff, 0xff, 0x00, 0x29, 0xff, 0xff, 0x00, 0x27, 0xff, 0xff, 0x00, 0x26, 0xff, 0xff, 0x00, 0x24, 0xff, 0xff, 0x00, 0x23, 0xff, 0xff, 0x00, 0x21, 0xff, 0xff, 0x00, 0x20, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xff, 0x00, 0x1c, 0xff, 0xff, 0x00, 0x1a, 0xff, 0xff, 0x00, 0x19, 0xff, 0xff, 0x00, 0x17, 0xff, 0xff, 0x00, 0x16, 0xff, 0xff, 0x00, 0x15, 0xff, 0xff, 0x00, 0x13, 0xff, 0xff, 0x00, 0x11, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x0c, 0xff, 0xff, 0x00, 0x0a, 0xff, 0xff, 0x00, 0x09, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x00, 0x04, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x00, 0xff, 0x02, 0xff, 0x00, 0xff, 0x05, 0xff, 0x00, 0xff, 0x06, 0xff, 0x00, 0xff, 0x07, 0xff, 0x00, 0xff, 0x09, 0xff, 0x00, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x0c, 0xff, 0x00, 0xff, 0x0e, 0xff, 0x00, 0xff, 0x10, 0xff, 0x00, 0xff, 0x11, 0xff, 0x00, 0xff, 0x13, 0xff, 0x00, 0xff, 0x15, 0xff, 0x00, 0xff, 0x16, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x19, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x21, 0xff, 0x00, 0xff, 0x22, 0xff, 0x00, 0xff, 0x23, 0xff, 0x00, 0xff, 0x25, 0xff, 0x00, 0xff, 0x26, 0xff, 0x00, 0xff, 0x27, 0xff, 0x00, 0xff, 0x29, 0xff, 0x00, 0xff, 0x2a, 0xff, 0x00, 0xff, 0x2b, 0xff, 0x00, 0xff, 0x2c, 0xff, 0x00, 0xff, 0x2d, 0xff, 0x00, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x30, 0xff, 0x00, 0xff, 0x31, 0xff, 0x00, 0xff, 0x32, 0xff, 0x00, 0xff, 0x33, 0xff, 0x00, 0xff, 0x34, 0xff, 0x00, 0xff, 0x35, 0xff, 0x00, 0xff, 0x36, 0xff, 0x00, 0xff, 0x37, 0xff, 0x00, 0xff, 0x38, 0xff, 0x00, 0xff, 0x39, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x00, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x3d, 0xff, 0x00, 0xff, 0x3e, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x40, 0xff,
+};
+
+const lv_image_dsc_t img_render_arc_bg = {
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .header.w = 100,
+    .header.h = 100,
+    .header.stride = 400,
+    .data = img_render_arc_bg_map,
+    .data_size = sizeof(img_render_arc_bg_map),
+};
@@ -0,0 +1,68 @@
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMG_IMG_RENDER_LVGL_LOGO_RGB888
+    #define LV_ATTRIBUTE_IMG_IMG_RENDER_LVGL_LOGO_RGB888
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMG_RENDER_LVGL_LOGO_RGB888 uint8_t
+img_render_lvgl_logo_rgb888_map[] = {
+
+    0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,0xbc,0xbb,0xba,0x7c,0x7b,0x79,0x76,0x75,0x72,0x77,0x76,0x73,0x77,0x76,0x73,0x77,0x76,0x73,0x77,0x76,0x73,0x77,0x76,0x73,0x77,0x76,0x73,0x77,0x76,0x73,0x77,0x76,0x73,0x77,0x76,0x73,0x77,0x76,0x73,0x77,0x76,0x73,0x77,0x76,0x73,0x77,0x76,0x73,0x77,0x76,0x73,0x77,0x76,0x73,0x77,0x76,0x73,0x77,0x76,0x73,0x77,0x76,0x73,0x77,0x76,0x73,0x77,0x76,0x73,0x77,0x76,0x73,0x75,0x74,0x71,0x94,0x93,0x91,0xe8,0xe8,0xe8,0xfe,0xfe,0xfe,
+    0xfd,0xfd,0xfd,0x96,0x95,0x93,0x34,0x33,0x2f,0x33,0x32,0x2d,0x34,0x33,0x2f,0x34,0x33,0x2f,0x34,0x33,0x2f,0x34,0x33,0x2f,0x34,0x33,0x2f,0x34,0x33,0x2f,0x34,0x33,0x2f,0x34,0x33,0x2f,0x34,0x33,0x2f,0x34,0x33,0x2f,0x34,0x33,0x2f,0x34,0x33,0x2f,0x34,0x33,0x2f,0x34,0x33,0x2f,0x34,0x33,0x2f,0x34,0x33,0x2f,0x34,0x33,0x2f,0x34,0x33,0x2f,0x34,0x33,0x2f,0x34,0x33,0x2f,0x34,0x33,0x2f,0x2d,0x2b,0x27,0x2b,0x2a,0x26,0x30,0x2f,0x2a,0x52,0x51,0x4e,0xdc,0xdc,0xdc,
+    0xbd,0xbc,0xbb,0x34,0x33,0x2f,0x36,0x35,0x31,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x33,0x32,0x2e,0x61,0x60,0x5d,0x6c,0x6b,0x68,0x37,0x36,0x32,0x2a,0x29,0x25,0x6a,0x69,0x66,
+    0x7c,0x7b,0x79,0x33,0x32,0x2e,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x2f,0x2e,0x2a,0x7b,0x7b,0x78,0xfb,0xfb,0xfb,0xfe,0xfe,0xfe,0x9d,0x9c,0x9a,0x2d,0x2c,0x28,0x45,0x44,0x40,
+    0x76,0x75,0x72,0x34,0x33,0x2f,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x2b,0x2a,0x26,0xb0,0xb1,0xaf,0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,0xd8,0xd8,0xd8,0x31,0x30,0x2c,0x44,0x43,0x3f,
+    0x77,0x76,0x73,0x34,0x33,0x2f,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x31,0x30,0x2c,0x63,0x62,0x5f,0xe8,0xe8,0xe8,0xf2,0xf2,0xf2,0x80,0x80,0x7d,0x2d,0x2c,0x28,0x45,0x45,0x40,
+    0x77,0x76,0x73,0x34,0x33,0x2f,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x34,0x32,0x31,0x2c,0x45,0x44,0x40,0x4c,0x4b,0x47,0x32,0x31,0x2d,0x36,0x35,0x31,0x45,0x45,0x40,
+    0x74,0x73,0x70,0x34,0x33,0x2f,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x34,0x33,0x2f,0x33,0x32,0x2e,0x38,0x37,0x33,0x36,0x35,0x31,0x45,0x45,0x40,
+    0x81,0x81,0x7e,0x29,0x28,0x23,0x2b,0x2a,0x26,0x2b,0x2a,0x26,0x2b,0x2a,0x26,0x2b,0x2a,0x26,0x2b,0x2a,0x26,0x2c,0x2a,0x26,0x2b,0x2a,0x26,0x30,0x2f,0x2a,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x36,0x35,0x31,0x45,0x45,0x40,
+    0xed,0xed,0xeb,0xb6,0xb3,0xab,0xaf,0xab,0xa2,0xb1,0xad,0xa4,0xb1,0xad,0xa4,0xb1,0xad,0xa4,0xb1,0xad,0xa4,0xb2,0xae,0xa5,0xad,0xaa,0xa2,0x6b,0x6a,0x66,0x30,0x2f,0x2b,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x36,0x35,0x31,0x45,0x45,0x40,
+    0xfb,0xfd,0xfe,0xce,0xdf,0xfe,0xc5,0xd9,0xfe,0xc6,0xda,0xfe,0xc6,0xda,0xfe,0xc6,0xda,0xfe,0xc6,0xda,0xfe,0xc4,0xd8,0xfe,0xd0,0xe1,0xfe,0xfd,0xfd,0xfe,0x79,0x78,0x75,0x2f,0x2e,0x2a,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x36,0x35,0x31,0x45,0x45,0x40,
+    0x80,0xa4,0xf8,0x14,0x57,0xf2,0x14,0x57,0xf2,0x15,0x57,0xf2,0x15,0x57,0xf2,0x15,0x57,0xf2,0x15,0x57,0xf2,0x14,0x56,0xf2,0x0e,0x52,0xf1,0xb8,0xcf,0xfe,0xd1,0xce,0xc5,0x2f,0x2e,0x2a,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x36,0x35,0x31,0x45,0x45,0x40,
+    0x60,0x8d,0xf6,0x19,0x5a,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x10,0x53,0xf1,0x9f,0xbd,0xfe,0xd4,0xd0,0xc5,0x31,0x30,0x2b,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x36,0x35,0x31,0x45,0x45,0x40,
+    0x65,0x90,0xf6,0x1a,0x5b,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x11,0x54,0xf1,0xa2,0xbf,0xfe,0xd3,0xcf,0xc4,0x31,0x30,0x2b,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x36,0x35,0x31,0x45,0x45,0x40,
+    0x65,0x90,0xf6,0x1a,0x5b,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x11,0x54,0xf1,0xa2,0xbf,0xfe,0xd3,0xcf,0xc4,0x31,0x30,0x2b,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x36,0x35,0x31,0x45,0x45,0x40,
+    0x65,0x90,0xf6,0x1a,0x5b,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x11,0x54,0xf1,0xa2,0xbf,0xfe,0xd3,0xcf,0xc4,0x31,0x30,0x2b,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x36,0x35,0x31,0x45,0x45,0x40,
+    0x65,0x90,0xf6,0x1a,0x5b,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x11,0x54,0xf1,0xa2,0xbf,0xfe,0xd3,0xcf,0xc4,0x31,0x30,0x2b,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x36,0x35,0x31,0x45,0x45,0x40,
+    0x64,0x90,0xf6,0x1a,0x5b,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x1f,0x5e,0xf2,0x11,0x54,0xf1,0xa2,0xbf,0xfe,0xd3,0xcf,0xc4,0x31,0x30,0x2b,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x36,0x35,0x31,0x45,0x45,0x40,
+    0x61,0x8d,0xf6,0x0f,0x53,0xf1,0x15,0x57,0xf2,0x15,0x57,0xf2,0x15,0x57,0xf2,0x15,0x57,0xf2,0x15,0x57,0xf2,0x15,0x57,0xf2,0x06,0x4c,0xf1,0xa0,0xbd,0xfe,0xd3,0xcf,0xc4,0x27,0x26,0x21,0x2e,0x2d,0x29,0x2f,0x2e,0x29,0x2f,0x2e,0x29,0x2f,0x2e,0x29,0x2f,0x2e,0x29,0x2f,0x2e,0x29,0x2f,0x2d,0x29,0x32,0x31,0x2d,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x36,0x35,0x31,0x45,0x45,0x40,
+    0xc3,0xd3,0xfb,0x5e,0x8a,0xf7,0x57,0x86,0xf7,0x59,0x87,0xf7,0x59,0x87,0xf7,0x59,0x87,0xf7,0x59,0x87,0xf7,0x57,0x85,0xf7,0x5d,0x8a,0xf7,0xdc,0xe7,0xfe,0xf5,0xf4,0xf0,0x7e,0x7e,0x7c,0x68,0x69,0x67,0x6b,0x6d,0x6b,0x6b,0x6d,0x6b,0x6b,0x6d,0x6b,0x6b,0x6d,0x6b,0x6b,0x6d,0x6b,0x6d,0x6e,0x6c,0x54,0x54,0x50,0x30,0x2f,0x2b,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x36,0x35,0x31,0x45,0x45,0x40,
+    0xfe,0xfe,0xfe,0xfe,0xfe,0xfb,0xfd,0xfe,0xf8,0xfe,0xfe,0xf8,0xfe,0xfe,0xf8,0xfe,0xfe,0xf8,0xfe,0xfe,0xf8,0xfd,0xfe,0xf8,0xfe,0xfe,0xfc,0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,0xfb,0xf9,0xfe,0xfc,0xfa,0xfe,0xfc,0xfa,0xfe,0xfc,0xfa,0xfe,0xfc,0xfa,0xfe,0xfc,0xfa,0xfe,0xfd,0xfc,0xf5,0xf9,0xfa,0x80,0x7f,0x7e,0x2f,0x2e,0x2a,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x36,0x35,0x31,0x45,0x45,0x40,
+    0xca,0xef,0xc8,0x7e,0xd9,0x79,0x79,0xd8,0x74,0x7a,0xd8,0x75,0x7a,0xd8,0x75,0x7a,0xd8,0x75,0x7a,0xd8,0x75,0x79,0xd8,0x73,0x7c,0xd9,0x77,0xde,0xf9,0xe2,0xfe,0xed,0xeb,0xf9,0x81,0x60,0xf9,0x75,0x50,0xf9,0x77,0x53,0xf9,0x77,0x53,0xf9,0x77,0x53,0xf9,0x77,0x53,0xf9,0x77,0x52,0xf9,0x71,0x4b,0xfe,0xbc,0xa9,0xec,0xf2,0xf3,0x42,0x41,0x3d,0x35,0x34,0x30,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x36,0x35,0x31,0x45,0x45,0x40,
+    0x94,0xe0,0x91,0x5e,0xd0,0x59,0x62,0xd1,0x5d,0x62,0xd1,0x5d,0x62,0xd1,0x5d,0x62,0xd1,0x5d,0x62,0xd1,0x5d,0x62,0xd1,0x5d,0x58,0xcd,0x52,0xba,0xf2,0xc1,0xfe,0xd3,0xce,0xf7,0x59,0x2d,0xf7,0x60,0x35,0xf7,0x60,0x36,0xf7,0x60,0x36,0xf7,0x60,0x36,0xf7,0x60,0x36,0xf7,0x60,0x36,0xf7,0x58,0x2c,0xfc,0x8b,0x6b,0xf7,0xfb,0xfc,0x50,0x50,0x4c,0x33,0x32,0x2e,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x36,0x35,0x31,0x45,0x45,0x40,
+    0x98,0xe1,0x95,0x63,0xd1,0x5e,0x66,0xd2,0x61,0x66,0xd2,0x61,0x66,0xd2,0x61,0x66,0xd2,0x61,0x66,0xd2,0x61,0x66,0xd2,0x61,0x5d,0xcf,0x57,0xbd,0xf3,0xc4,0xfe,0xd5,0xd0,0xf7,0x5f,0x34,0xf7,0x64,0x3a,0xf7,0x64,0x3b,0xf7,0x64,0x3b,0xf7,0x64,0x3b,0xf7,0x64,0x3b,0xf7,0x64,0x3b,0xf7,0x5d,0x32,0xfc,0x90,0x71,0xf5,0xf9,0xfa,0x4f,0x4e,0x4b,0x33,0x32,0x2e,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x36,0x35,0x31,0x45,0x45,0x40,
+    0x98,0xe1,0x95,0x63,0xd1,0x5e,0x66,0xd2,0x61,0x66,0xd2,0x61,0x66,0xd2,0x61,0x66,0xd2,0x61,0x66,0xd2,0x61,0x66,0xd2,0x61,0x5d,0xcf,0x57,0xbd,0xf3,0xc4,0xfe,0xd5,0xd0,0xf7,0x5f,0x34,0xf7,0x64,0x3a,0xf7,0x64,0x3b,0xf7,0x64,0x3b,0xf7,0x64,0x3b,0xf7,0x64,0x3b,0xf7,0x64,0x3b,0xf7,0x5d,0x32,0xfc,0x90,0x71,0xf5,0xf9,0xfa,0x4f,0x4e,0x4b,0x33,0x32,0x2e,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x36,0x35,0x31,0x45,0x45,0x40,
+    0x98,0xe1,0x95,0x63,0xd1,0x5e,0x66,0xd2,0x61,0x66,0xd2,0x61,0x66,0xd2,0x61,0x66,0xd2,0x61,0x66,0xd2,0x61,0x66,0xd2,0x61,0x5d,0xcf,0x57,0xbd,0xf3,0xc4,0xfe,0xd5,0xd0,0xf7,0x5f,0x34,0xf7,0x64,0x3a,0xf7,0x64,0x3b,0xf7,0x64,0x3b,0xf7,0x64,0x3b,0xf7,0x64,0x3b,0xf7,0x64,0x3b,0xf7,0x5d,0x32,0xfc,0x90,0x71,0xf5,0xf9,0xfa,0x4f,0x4e,0x4b,0x33,0x32,0x2e,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x36,0x35,0x31,0x45,0x45,0x40,
+    0x97,0xe1,0x94,0x63,0xd1,0x5e,0x66,0xd2,0x61,0x66,0xd2,0x61,0x66,0xd2,0x61,0x66,0xd2,0x61,0x66,0xd2,0x61,0x66,0xd2,0x61,0x5d,0xcf,0x57,0xbd,0xf3,0xc4,0xfe,0xd5,0xd0,0xf7,0x5f,0x34,0xf7,0x64,0x3a,0xf7,0x64,0x3b,0xf7,0x64,0x3b,0xf7,0x64,0x3b,0xf7,0x64,0x3b,0xf7,0x64,0x3b,0xf7,0x5d,0x32,0xfc,0x90,0x71,0xf5,0xf9,0xfa,0x4f,0x4e,0x4b,0x33,0x32,0x2e,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x36,0x35,0x31,0x44,0x44,0x3f,
+    0xb2,0xe8,0xb0,0x61,0xd0,0x5b,0x66,0xd2,0x61,0x66,0xd2,0x61,0x66,0xd2,0x61,0x66,0xd2,0x61,0x66,0xd2,0x61,0x66,0xd2,0x61,0x5d,0xcf,0x57,0xbd,0xf3,0xc4,0xfe,0xd5,0xd0,0xf7,0x5f,0x34,0xf7,0x64,0x3a,0xf7,0x64,0x3b,0xf7,0x64,0x3b,0xf7,0x64,0x3b,0xf7,0x64,0x3b,0xf7,0x64,0x3b,0xf7,0x5d,0x32,0xfc,0x90,0x71,0xf5,0xf9,0xfa,0x4f,0x4e,0x4b,0x33,0x32,0x2e,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x38,0x37,0x33,0x33,0x32,0x2e,0x4f,0x4e,0x4a,
+    0xef,0xfa,0xee,0x7f,0xd9,0x7b,0x5c,0xcf,0x56,0x64,0xd1,0x5f,0x64,0xd2,0x5f,0x64,0xd2,0x5f,0x64,0xd2,0x5f,0x64,0xd2,0x5f,0x5a,0xce,0x54,0xbb,0xf2,0xc2,0xfe,0xd4,0xce,0xf7,0x5b,0x30,0xf7,0x63,0x38,0xf7,0x62,0x39,0xf7,0x62,0x39,0xf7,0x62,0x39,0xf7,0x62,0x39,0xf7,0x62,0x39,0xf7,0x5b,0x2f,0xfc,0x8c,0x6d,0xf5,0xf9,0xfa,0x4a,0x49,0x46,0x31,0x30,0x2c,0x36,0x35,0x31,0x36,0x35,0x31,0x36,0x35,0x31,0x36,0x35,0x31,0x33,0x32,0x2e,0x2a,0x28,0x24,0xa1,0xa1,0x9f,
+    0xfe,0xfe,0xfe,0xe8,0xf8,0xe7,0x91,0xdf,0x8e,0x71,0xd6,0x6d,0x70,0xd5,0x6c,0x71,0xd5,0x6c,0x71,0xd5,0x6c,0x6f,0xd5,0x6b,0x73,0xd6,0x6e,0xda,0xf8,0xde,0xfe,0xea,0xe9,0xf8,0x78,0x55,0xf8,0x6c,0x45,0xf8,0x6e,0x48,0xf8,0x6e,0x48,0xf8,0x6e,0x48,0xf8,0x6e,0x48,0xf8,0x6e,0x48,0xf8,0x69,0x40,0xfc,0xaf,0x9a,0xfc,0xfd,0xfd,0x76,0x76,0x73,0x3e,0x3d,0x39,0x45,0x45,0x40,0x45,0x45,0x40,0x45,0x45,0x40,0x44,0x43,0x3f,0x4e,0x4d,0x4a,0x9f,0x9f,0x9d,0xfd,0xfd,0xfd,
+};
+
+const lv_image_dsc_t img_render_lvgl_logo_rgb888 = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB888,
+  .header.flags = 0,
+  .header.w = 30,
+  .header.h = 30,
+  .header.stride = 90,
+  .data_size = sizeof(img_render_lvgl_logo_rgb888_map),
+  .data = img_render_lvgl_logo_rgb888_map,
+};
@@ -0,0 +1,171 @@
+#include "../lv_examples.h"
+#if LV_USE_FLEX && LV_BUILD_EXAMPLES
+
+static const int32_t obj_width = 90;
+static const int32_t obj_height = 70;
+
+static void set_width(lv_anim_t * var, int32_t v)
+{
+    lv_obj_set_width(var->var, v);
+}
+
+static void set_height(lv_anim_t * var, int32_t v)
+{
+    lv_obj_set_height(var->var, v);
+}
+
+static void set_slider_value(lv_anim_t * var, int32_t v)
+{
+    lv_slider_set_value(var->var, v, LV_ANIM_OFF);
+}
+
+static void btn_start_event_handler(lv_event_t * e)
+{
+    lv_obj_t * btn = lv_event_get_current_target_obj(e);
+    lv_anim_timeline_t * anim_timeline = lv_event_get_user_data(e);
+
+    bool reverse = lv_obj_has_state(btn, LV_STATE_CHECKED);
+    lv_anim_timeline_set_reverse(anim_timeline, reverse);
+    lv_anim_timeline_start(anim_timeline);
+}
+
+static void btn_pause_event_handler(lv_event_t * e)
+{
+    lv_anim_timeline_t * anim_timeline = lv_event_get_user_data(e);
+    lv_anim_timeline_pause(anim_timeline);
+}
+
+static void slider_prg_event_handler(lv_event_t * e)
+{
+    lv_obj_t * slider = lv_event_get_current_target_obj(e);
+    lv_anim_timeline_t * anim_timeline = lv_event_get_user_data(e);
+    int32_t progress = lv_slider_get_value(slider);
+    lv_anim_timeline_set_progress(anim_timeline, progress);
+}
+
+/**
+ * Create an animation timeline
+ */
+void lv_example_anim_timeline_1(void)
+{
+    /* Create anim timeline */
+    lv_anim_timeline_t * anim_timeline = lv_anim_timeline_create();
+
+    lv_obj_t * par = lv_screen_active();
+    lv_obj_set_flex_flow(par, LV_FLEX_FLOW_ROW);
+    lv_obj_set_flex_align(par, LV_FLEX_ALIGN_SPACE_AROUND, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+
+    /* create btn_start */
+    lv_obj_t * btn_start = lv_button_create(par);
+    lv_obj_add_event_cb(btn_start, btn_start_event_handler, LV_EVENT_VALUE_CHANGED, anim_timeline);
+    lv_obj_add_flag(btn_start, LV_OBJ_FLAG_IGNORE_LAYOUT);
+    lv_obj_add_flag(btn_start, LV_OBJ_FLAG_CHECKABLE);
+    lv_obj_align(btn_start, LV_ALIGN_TOP_MID, -100, 20);
+
+    lv_obj_t * label_start = lv_label_create(btn_start);
+    lv_label_set_text(label_start, "Start");
+    lv_obj_center(label_start);
+
+    /* create btn_pause */
+    lv_obj_t * btn_pause = lv_button_create(par);
+    lv_obj_add_event_cb(btn_pause, btn_pause_event_handler, LV_EVENT_CLICKED, anim_timeline);
+    lv_obj_add_flag(btn_pause, LV_OBJ_FLAG_IGNORE_LAYOUT);
+    lv_obj_align(btn_pause, LV_ALIGN_TOP_MID, 100, 20);
+
+    lv_obj_t * label_pause = lv_label_create(btn_pause);
+    lv_label_set_text(label_pause, "Pause");
+    lv_obj_center(label_pause);
+
+    /* create slider_prg */
+    lv_obj_t * slider_prg = lv_slider_create(par);
+    lv_obj_add_event_cb(slider_prg, slider_prg_event_handler, LV_EVENT_VALUE_CHANGED, anim_timeline);
+    lv_obj_add_flag(slider_prg, LV_OBJ_FLAG_IGNORE_LAYOUT);
+    lv_obj_align(slider_prg, LV_ALIGN_BOTTOM_MID, 0, -20);
+    lv_slider_set_range(slider_prg, 0, LV_ANIM_TIMELINE_PROGRESS_MAX);
+
+    /* create 3 objects */
+    lv_obj_t * obj1 = lv_obj_create(par);
+    lv_obj_set_size(obj1, obj_width, obj_height);
+    lv_obj_set_scrollbar_mode(obj1, LV_SCROLLBAR_MODE_OFF);
+
+    lv_obj_t * obj2 = lv_obj_create(par);
+    lv_obj_set_size(obj2, obj_width, obj_height);
+    lv_obj_set_scrollbar_mode(obj2, LV_SCROLLBAR_MODE_OFF);
+
+    lv_obj_t * obj3 = lv_obj_create(par);
+    lv_obj_set_size(obj3, obj_width, obj_height);
+    lv_obj_set_scrollbar_mode(obj3, LV_SCROLLBAR_MODE_OFF);
+
+    /* anim-slider */
+    lv_anim_t a_slider;
+    lv_anim_init(&a_slider);
+    lv_anim_set_var(&a_slider, slider_prg);
+    lv_anim_set_values(&a_slider, 0, LV_ANIM_TIMELINE_PROGRESS_MAX);
+    lv_anim_set_custom_exec_cb(&a_slider, set_slider_value);
+    lv_anim_set_path_cb(&a_slider, lv_anim_path_linear);
+    lv_anim_set_duration(&a_slider, 700);
+
+    /* anim-obj1 */
+    lv_anim_t a1;
+    lv_anim_init(&a1);
+    lv_anim_set_var(&a1, obj1);
+    lv_anim_set_values(&a1, 0, obj_width);
+    lv_anim_set_custom_exec_cb(&a1, set_width);
+    lv_anim_set_path_cb(&a1, lv_anim_path_overshoot);
+    lv_anim_set_duration(&a1, 300);
+
+    lv_anim_t a2;
+    lv_anim_init(&a2);
+    lv_anim_set_var(&a2, obj1);
+    lv_anim_set_values(&a2, 0, obj_height);
+    lv_anim_set_custom_exec_cb(&a2, set_height);
+    lv_anim_set_path_cb(&a2, lv_anim_path_ease_out);
+    lv_anim_set_duration(&a2, 300);
+
+    /* anim-obj2 */
+    lv_anim_t a3;
+    lv_anim_init(&a3);
+    lv_anim_set_var(&a3, obj2);
+    lv_anim_set_values(&a3, 0, obj_width);
+    lv_anim_set_custom_exec_cb(&a3, set_width);
+    lv_anim_set_path_cb(&a3, lv_anim_path_overshoot);
+    lv_anim_set_duration(&a3, 300);
+
+    lv_anim_t a4;
+    lv_anim_init(&a4);
+    lv_anim_set_var(&a4, obj2);
+    lv_anim_set_values(&a4, 0, obj_height);
+    lv_anim_set_custom_exec_cb(&a4, set_height);
+    lv_anim_set_path_cb(&a4, lv_anim_path_ease_out);
+    lv_anim_set_duration(&a4, 300);
+
+    /* anim-obj3 */
+    lv_anim_t a5;
+    lv_anim_init(&a5);
+    lv_anim_set_var(&a5, obj3);
+    lv_anim_set_values(&a5, 0, obj_width);
+    lv_anim_set_custom_exec_cb(&a5, set_width);
+    lv_anim_set_path_cb(&a5, lv_anim_path_overshoot);
+    lv_anim_set_duration(&a5, 300);
+
+    lv_anim_t a6;
+    lv_anim_init(&a6);
+    lv_anim_set_var(&a6, obj3);
+    lv_anim_set_values(&a6, 0, obj_height);
+    lv_anim_set_custom_exec_cb(&a6, set_height);
+    lv_anim_set_path_cb(&a6, lv_anim_path_ease_out);
+    lv_anim_set_duration(&a6, 300);
+
+    /* add animations to timeline */
+    lv_anim_timeline_add(anim_timeline, 0, &a_slider);
+    lv_anim_timeline_add(anim_timeline, 0, &a1);
+    lv_anim_timeline_add(anim_timeline, 0, &a2);
+    lv_anim_timeline_add(anim_timeline, 200, &a3);
+    lv_anim_timeline_add(anim_timeline, 200, &a4);
+    lv_anim_timeline_add(anim_timeline, 400, &a5);
+    lv_anim_timeline_add(anim_timeline, 400, &a6);
+
+    lv_anim_timeline_set_progress(anim_timeline, LV_ANIM_TIMELINE_PROGRESS_MAX);
+}
+
+#endif
@@ -0,0 +1,195 @@
+#include "../../lvgl.h"
+
+#if LV_BUILD_EXAMPLES && LV_USE_ANIMIMG
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_ANIMIMG002
+    #define LV_ATTRIBUTE_IMAGE_ANIMIMG002
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_ANIMIMG002 uint8_t animimg002_map[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xf1, 0xf1, 0x00, 0xf2, 0xf2, 0xf2, 0x00, 0xf2, 0xf2, 0xf2, 0x03, 0xf3, 0xf3, 0xf3, 0x03, 0xf4, 0xf4, 0xf4, 0x03, 0xf4, 0xf4, 0xf4, 0x03, 0xf5, 0xf5, 0xf5, 0x03, 0xf5, 0xf5, 0xf5, 0x03, 0xf6, 0xf6, 0xf6, 0x03, 0xf6, 0xf6, 0xf6, 0x03, 0xf6, 0xf6, 0xf6, 0x03, 0xf6, 0xf6, 0xf6, 0x03, 0xf7, 0xf7, 0xf7, 0x03, 0xf7, 0xf7, 0xf7, 0x03, 0xf8, 0xf8, 0xf8, 0x03, 0xf9, 0xf9, 0xf9, 0x03, 0xf9, 0xf9, 0xf9, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x00, 0xfb, 0xfb, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xe8, 0xe8, 0x00, 0xe9, 0xe9, 0xe9, 0x03, 0xe9, 0xe9, 0xe9, 0x04, 0xea, 0xea, 0xea, 0x14, 0xea, 0xea, 0xea, 0x27, 0xeb, 0xeb, 0xeb, 0x3b, 0xeb, 0xeb, 0xeb, 0x4c, 0xec, 0xec, 0xec, 0x5f, 0xec, 0xec, 0xec, 0x6f, 0xed, 0xed, 0xed, 0x7f, 0xed, 0xed, 0xed, 0x8c, 0xee, 0xee, 0xee, 0x9b, 0xef, 0xef, 0xef, 0xa7, 0xef, 0xef, 0xef, 0xb3, 0xf0, 0xf0, 0xf0, 0xbc, 0xf0, 0xf0, 0xf0, 0xc7, 0xf1, 0xf1, 0xf1, 0xd0, 0xf1, 0xf1, 0xf1, 0xd7, 0xf2, 0xf2, 0xf2, 0xdb, 0xf2, 0xf2, 0xf2, 0xe0, 0xf3, 0xf3, 0xf3, 0xe3, 0xf4, 0xf4, 0xf4, 0xe7, 0xf4, 0xf4, 0xf4, 0xeb, 0xf5, 0xf5, 0xf5, 0xeb, 0xf5, 0xf5, 0xf5, 0xeb, 0xf6, 0xf6, 0xf6, 0xeb, 0xf6, 0xf6, 0xf6, 0xeb, 0xf6, 0xf6, 0xf6, 0xeb, 0xf6, 0xf6, 0xf6, 0xeb, 0xf7, 0xf7, 0xf7, 0xeb, 0xf7, 0xf7, 0xf7, 0xeb, 0xf8, 0xf8, 0xf8, 0xeb, 0xf9, 0xf9, 0xf9, 0xeb, 0xf9, 0xf9, 0xf9, 0xe3, 0xfa, 0xfa, 0xfa, 0xe3, 0xfa, 0xfa, 0xfa, 0xdb, 0xfb, 0xfb, 0xfb, 0xd8, 0xfb, 0xfb, 0xfb, 0xd0, 0xfc, 0xfc, 0xfc, 0xcb, 0xfc, 0xfc, 0xfc, 0xc0, 0xfd, 0xfd, 0xfd, 0xb7, 0xfe, 0xfe, 0xfe, 0xab, 0xfe, 0xfe, 0xfe, 0x9f, 0xff, 0xff, 0xff, 0x90, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xe8, 0xe8, 0x03, 0xe8, 0xe8, 0xe8, 0x0b, 0xe8, 0xe8, 0xe8, 0x27, 0xe7, 0xe7, 0xe7, 0x47, 0xe7, 0xe7, 0xe7, 0x64, 0xe7, 0xe7, 0xe7, 0x80, 0xe7, 0xe7, 0xe7, 0x9c, 0xe7, 0xe7, 0xe7, 0xb7, 0xe8, 0xe8, 0xe8, 0xcf, 0xe8, 0xe8, 0xe8, 0xe4, 0xe9, 0xe9, 0xe9, 0xf8, 0xea, 0xea, 0xea, 0xff, 0xea, 0xea, 0xea, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xec, 0xec, 0xec, 0xff, 0xeb, 0xeb, 0xeb, 0xfc, 0xeb, 0xeb, 0xeb, 0xfb, 0xea, 0xea, 0xea, 0xf3, 0xe8, 0xe8, 0xe8, 0xeb, 0xe6, 0xe6, 0xe6, 0xe3, 0xe4, 0xe4, 0xe4, 0xdc, 0xe4, 0xe4, 0xe4, 0xd7, 0xe3, 0xe3, 0xe3, 0xcc, 0xe0, 0xe0, 0xe0, 0xc8, 0xdf, 0xdf, 0xdf, 0xc4, 0xde, 0xde, 0xde, 0xc0, 0xdc, 0xdc, 0xdc, 0xbb, 0xdc, 0xdc, 0xdc, 0xb7, 0xdc, 0xdc, 0xdc, 0xb4, 0xd9, 0xd9, 0xd9, 0xaf, 0xda, 0xda, 0xda, 0xaf, 0xdb, 0xdb, 0xdb, 0xab, 0xdc, 0xdc, 0xdc, 0xa8, 0xdd, 0xdd, 0xdd, 0xa8, 0xdc, 0xdc, 0xdc, 0xab, 0xdc, 0xdc, 0xdc, 0xac, 0xdd, 0xdd, 0xdd, 0xac, 0xdd, 0xdd, 0xdd, 0xac, 0xdd, 0xdd, 0xdd, 0xac, 0xdf, 0xdf, 0xdf, 0xb0, 0xe1, 0xe1, 0xe1, 0xb4, 0xe2, 0xe2, 0xe2, 0xb7, 0xe5, 0xe5, 0xe5, 0xbc, 0xe7, 0xe7, 0xe7, 0xbf, 0xea, 0xea, 0xea, 0xc3, 0xed, 0xed, 0xed, 0xc8, 0xf0, 0xf0, 0xf0, 0xcf, 0xf3, 0xf3, 0xf3, 0xd4, 0xf6, 0xf6, 0xf6, 0xdc, 0xf7, 0xf7, 0xf7, 0xe4, 0xfa, 0xfa, 0xfa, 0xec, 0xfd, 0xfd, 0xfd, 0xf7, 0xfe, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0xbc, 0xff, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xeb, 0xeb, 0x00, 0xeb, 0xeb, 0xeb, 0x04, 0xea, 0xea, 0xea, 0x23, 0xea, 0xea, 0xea, 0x4f, 0xe9, 0xe9, 0xe9, 0x77, 0xe9, 0xe9, 0xe9, 0x9c, 0xe8, 0xe8, 0xe8, 0xc0, 0xe8, 0xe8, 0xe8, 0xe3, 0xe8, 0xe8, 0xe8, 0xfc, 0xe8, 0xe8, 0xe8, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe5, 0xe5, 0xe5, 0xf8, 0xe2, 0xe2, 0xe2, 0xeb, 0xdf, 0xdf, 0xdf, 0xdb, 0xdb, 0xdb, 0xdb, 0xcb, 0xd7, 0xd7, 0xd7, 0xbb, 0xd2, 0xd2, 0xd2, 0xa8, 0xce, 0xce, 0xce, 0x9b, 0xc9, 0xc9, 0xc9, 0x88, 0xc1, 0xc1, 0xc1, 0x7c, 0xb9, 0xb9, 0xb9, 0x70, 0xb0, 0xb0, 0xb0, 0x67, 0xa5, 0xa5, 0xa5, 0x5b, 0x9c, 0x9c, 0x9c, 0x50, 0x9c, 0x9c, 0x9c, 0x4c, 0x9c, 0x9c, 0x9c, 0x4b, 0x9d, 0x9d, 0x9d, 0x48, 0x9d, 0x9d, 0x9d, 0x44, 0x9d, 0x9d, 0x9d, 0x43, 0x9d, 0x9d, 0x9d, 0x40, 0x9d, 0x9d, 0x9d, 0x40, 0x9c, 0x9c, 0x9c, 0x40, 0x9d, 0x9d, 0x9d, 0x3f, 0x9d, 0x9d, 0x9d, 0x3c, 0x9d, 0x9d, 0x9d, 0x3c, 0x9d, 0x9d, 0x9d, 0x3c, 0x9d, 0x9d, 0x9d, 0x3b, 0x9d, 0x9d, 0x9d, 0x38, 0x9d, 0x9d, 0x9d, 0x38, 0x9d, 0x9d, 0x9d, 0x38, 0x9d, 0x9d, 0x9d, 0x38, 0x9d, 0x9d, 0x9d, 0x38, 0x9d, 0x9d, 0x9d, 0x38, 0x9d, 0x9d, 0x9d, 0x38, 0x9d, 0x9d, 0x9d, 0x38, 0x9d, 0x9d, 0x9d, 0x38, 0x9d, 0x9d, 0x9d, 0x38, 0x9d, 0x9d, 0x9d, 0x38, 0x9d, 0x9d, 0x9d, 0x3b, 0x9d, 0x9d, 0x9d, 0x3b, 0x9d, 0x9d, 0x9d, 0x3b, 0x9d, 0x9d, 0x9d, 0x3c, 0x9c, 0x9c, 0x9c, 0x3c, 0x9c, 0x9c, 0x9c, 0x3c, 0x9c, 0x9c, 0x9c, 0x3c, 0x9d, 0x9d, 0x9d, 0x3c, 0x9d, 0x9d, 0x9d, 0x3c, 0x9d, 0x9d, 0x9d, 0x3c, 0x9c, 0x9c, 0x9c, 0x3f, 0xa5, 0xa5, 0xa5, 0x44, 0xb5, 0xb5, 0xb5, 0x50, 0xc2, 0xc2, 0xc2, 0x5f, 0xcd, 0xcd, 0xcd, 0x6b, 0xd6, 0xd6, 0xd6, 0x7b, 0xdf, 0xdf, 0xdf, 0x88, 0xe6, 0xe6, 0xe6, 0x97, 0xea, 0xea, 0xea, 0xab, 0xf0, 0xf0, 0xf0, 0xbc, 0xf3, 0xf3, 0xf3, 0xd0, 0xf7, 0xf7, 0xf7, 0xe3, 0xfc, 0xfc, 0xfc, 0xf4, 0xfe, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xa8, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x0b, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xef, 0xef, 0x00, 0xee, 0xee, 0xee, 0x08, 0xee, 0xee, 0xee, 0x34, 0xed, 0xed, 0xed, 0x68, 0xec, 0xec, 0xec, 0x9b, 0xec, 0xec, 0xec, 0xc8, 0xeb, 0xeb, 0xeb, 0xf3, 0xea, 0xea, 0xea, 0xff, 0xea, 0xea, 0xea, 0xff, 0xe8, 0xe8, 0xe8, 0xfb, 0xe4, 0xe4, 0xe4, 0xe8, 0xdf, 0xdf, 0xdf, 0xd0, 0xd8, 0xd8, 0xd8, 0xb8, 0xd2, 0xd2, 0xd2, 0x9f, 0xc9, 0xc9, 0xc9, 0x87, 0xbe, 0xbe, 0xbe, 0x6f, 0xae, 0xae, 0xae, 0x5b, 0x9e, 0x9e, 0x9e, 0x4b, 0x9d, 0x9d, 0x9d, 0x47, 0x9d, 0x9d, 0x9d, 0x43, 0x9d, 0x9d, 0x9d, 0x40, 0x9e, 0x9e, 0x9e, 0x3f, 0x9e, 0x9e, 0x9e, 0x3c, 0x9e, 0x9e, 0x9e, 0x3b, 0x9e, 0x9e, 0x9e, 0x38, 0x9e, 0x9e, 0x9e, 0x38, 0x9e, 0x9e, 0x9e, 0x37, 0x9e, 0x9e, 0x9e, 0x37, 0x9e, 0x9e, 0x9e, 0x37, 0x9e, 0x9e, 0x9e, 0x34, 0x9e, 0x9e, 0x9e, 0x34, 0x9e, 0x9e, 0x9e, 0x34, 0x9e, 0x9e, 0x9e, 0x34, 0x9e, 0x9e, 0x9e, 0x33, 0x9e, 0x9e, 0x9e, 0x33, 0x9e, 0x9e, 0x9e, 0x33, 0x9e, 0x9e, 0x9e, 0x33, 0x9e, 0x9e, 0x9e, 0x30, 0x9e, 0x9e, 0x9e, 0x30, 0x9e, 0x9e, 0x9e, 0x30, 0x9e, 0x9e, 0x9e, 0x30, 0x9e, 0x9e, 0x9e, 0x30, 0x9e, 0x9e, 0x9e, 0x30, 0x9e, 0x9e, 0x9e, 0x2f, 0x9e, 0x9e, 0x9e, 0x2f, 0x9e, 0x9e, 0x9e, 0x2f, 0x9e, 0x9e, 0x9e, 0x2f, 0x9e, 0x9e, 0x9e, 0x2f, 0x9d, 0x9d, 0x9d, 0x2f, 0x9d, 0x9d, 0x9d, 0x2f, 0x9d, 0x9d, 0x9d, 0x2f, 0x9d, 0x9d, 0x9d, 0x30, 0x9d, 0x9d, 0x9d, 0x30, 0x9d, 0x9d, 0x9d, 0x30, 0x9d, 0x9d, 0x9d, 0x30, 0x9d, 0x9d, 0x9d, 0x30, 0x9d, 0x9d, 0x9d, 0x2f, 0x9d, 0x9d, 0x9d, 0x30, 0x9d, 0x9d, 0x9d, 0x30, 0x9d, 0x9d, 0x9d, 0x2f, 0x9d, 0x9d, 0x9d, 0x2f, 0x9d, 0x9d, 0x9d, 0x2f, 0x9d, 0x9d, 0x9d, 0x2f, 0x9d, 0x9d, 0x9d, 0x2f, 0x9d, 0x9d, 0x9d, 0x2f, 0x9d, 0x9d, 0x9d, 0x30, 0x9d, 0x9d, 0x9d, 0x30, 0x9d, 0x9d, 0x9d, 0x30, 0x9d, 0x9d, 0x9d, 0x33, 0x9d, 0x9d, 0x9d, 0x33, 0x9d, 0x9d, 0x9d, 0x33, 0x9d, 0x9d, 0x9d, 0x33, 0x9d, 0x9d, 0x9d, 0x33, 0x9d, 0x9d, 0x9d, 0x34, 0x9d, 0x9d, 0x9d, 0x38, 0x9d, 0x9d, 0x9d, 0x3b, 0x9c, 0x9c, 0x9c, 0x40, 0xac, 0xac, 0xac, 0x4c, 0xc4, 0xc4, 0xc4, 0x60, 0xd2, 0xd2, 0xd2, 0x7b, 0xdf, 0xdf, 0xdf, 0x94, 0xe7, 0xe7, 0xe7, 0xb0, 0xee, 0xee, 0xee, 0xcb, 0xf5, 0xf5, 0xf5, 0xe4, 0xfc, 0xfc, 0xfc, 0xf8, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xa8, 0xff, 0xff, 0xff, 0x78, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xf3, 0xf3, 0x00, 0xf2, 0xf2, 0xf2, 0x0c, 0xf1, 0xf1, 0xf1, 0x48, 0xf0, 0xf0, 0xf0, 0x88, 0xef, 0xef, 0xef, 0xc3, 0xee, 0xee, 0xee, 0xf4, 0xee, 0xee, 0xee, 0xff, 0xed, 0xed, 0xed, 0xfc, 0xe8, 0xe8, 0xe8, 0xeb, 0xe2, 0xe2, 0xe2, 0xc7, 0xd9, 0xd9, 0xd9, 0xa7, 0xce, 0xce, 0xce, 0x87, 0xbe, 0xbe, 0xbe, 0x68, 0xa6, 0xa6, 0xa6, 0x4f, 0x9e, 0x9e, 0x9e, 0x44, 0x9e, 0x9e, 0x9e, 0x40, 0x9e, 0x9e, 0x9e, 0x3c, 0x9e, 0x9e, 0x9e, 0x3b, 0x9e, 0x9e, 0x9e, 0x38, 0x9e, 0x9e, 0x9e, 0x38, 0x9e, 0x9e, 0x9e, 0x34, 0x9e, 0x9e, 0x9e, 0x34, 0x9e, 0x9e, 0x9e, 0x34, 0x9e, 0x9e, 0x9e, 0x33, 0x9e, 0x9e, 0x9e, 0x33, 0x9e, 0x9e, 0x9e, 0x30, 0x9e, 0x9e, 0x9e, 0x30, 0x9e, 0x9e, 0x9e, 0x30, 0x9e, 0x9e, 0x9e, 0x30, 0x9e, 0x9e, 0x9e, 0x30, 0x9e, 0x9e, 0x9e, 0x2f, 0x9e, 0x9e, 0x9e, 0x2c, 0x9e, 0x9e, 0x9e, 0x2c, 0x9e, 0x9e, 0x9e, 0x2c, 0x9e, 0x9e, 0x9e, 0x2c, 0x9e, 0x9e, 0x9e, 0x2c, 0x9e, 0x9e, 0x9e, 0x2c, 0x9e, 0x9e, 0x9e, 0x2c, 0x9e, 0x9e, 0x9e, 0x2c, 0x9e, 0x9e, 0x9e, 0x2c, 0x9e, 0x9e, 0x9e, 0x2b, 0x9e, 0x9e, 0x9e, 0x2b, 0x9e, 0x9e, 0x9e, 0x2b, 0x9e, 0x9e, 0x9e, 0x2b, 0x9e, 0x9e, 0x9e, 0x2b, 0x9e, 0x9e, 0x9e, 0x28, 0x9e, 0x9e, 0x9e, 0x28, 0x9e, 0x9e, 0x9e, 0x28, 0x9e, 0x9e, 0x9e, 0x28, 0x9e, 0x9e, 0x9e, 0x28, 0x9e, 0x9e, 0x9e, 0x28, 0x9e, 0x9e, 0x9e, 0x28, 0x9d, 0x9d, 0x9d, 0x28, 0x9d, 0x9d, 0x9d, 0x28, 0x9d, 0x9d, 0x9d, 0x28, 0x9d, 0x9d, 0x9d, 0x28, 0x9d, 0x9d, 0x9d, 0x28, 0x9d, 0x9d, 0x9d, 0x28, 0x9d, 0x9d, 0x9d, 0x28, 0x9d, 0x9d, 0x9d, 0x28, 0x9d, 0x9d, 0x9d, 0x28, 0x9d, 0x9d, 0x9d, 0x28, 0x9d, 0x9d, 0x9d, 0x28, 0x9d, 0x9d, 0x9d, 0x28, 0x9d, 0x9d, 0x9d, 0x28, 0x9d, 0x9d, 0x9d, 0x28, 0x9d, 0x9d, 0x9d, 0x28, 0x9d, 0x9d, 0x9d, 0x28, 0x9d, 0x9d, 0x9d, 0x28, 0x9d, 0x9d, 0x9d, 0x2b, 0x9d, 0x9d, 0x9d, 0x2b, 0x9d, 0x9d, 0x9d, 0x2b, 0x9d, 0x9d, 0x9d, 0x28, 0x9d, 0x9d, 0x9d, 0x2b, 0x9d, 0x9d, 0x9d, 0x2b, 0x9d, 0x9d, 0x9d, 0x2b, 0x9d, 0x9d, 0x9d, 0x2b, 0x9d, 0x9d, 0x9d, 0x2c, 0x9d, 0x9d, 0x9d, 0x2f, 0x9d, 0x9d, 0x9d, 0x2f, 0x9d, 0x9d, 0x9d, 0x2f, 0x9d, 0x9d, 0x9d, 0x2f, 0x9d, 0x9d, 0x9d, 0x30, 0x9d, 0x9d, 0x9d, 0x30, 0x9e, 0x9e, 0x9e, 0x33, 0x9e, 0x9e, 0x9e, 0x34, 0x9d, 0x9d, 0x9d, 0x38, 0x9d, 0x9d, 0x9d, 0x3f, 0xa0, 0xa0, 0xa0, 0x4b, 0xbb, 0xbb, 0xbb, 0x63, 0xd2, 0xd2, 0xd2, 0x83, 0xe0, 0xe0, 0xe0, 0xa4, 0xeb, 0xeb, 0xeb, 0xc7, 0xf5, 0xf5, 0xf5, 0xe7, 0xfd, 0xfd, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x1b, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xf6, 0xf6, 0x00, 0xf5, 0xf5, 0xf5, 0x23, 0xf4, 0xf4, 0xf4, 0x70, 0xf3, 0xf3, 0xf3, 0xbc, 0xf2, 0xf2, 0xf2, 0xf7, 0xf1, 0xf1, 0xf1, 0xff, 0xef, 0xef, 0xef, 0xf4, 0xe7, 0xe7, 0xe7, 0xcc, 0xdd, 0xdd, 0xdd, 0xa3, 0xcd, 0xcd, 0xcd, 0x78, 0xb2, 0xb2, 0xb2, 0x53, 0x9e, 0x9e, 0x9e, 0x40, 0x9e, 0x9e, 0x9e, 0x3c, 0x9e, 0x9e, 0x9e, 0x38, 0x9e, 0x9e, 0x9e, 0x38, 0x9e, 0x9e, 0x9e, 0x37, 0x9e, 0x9e, 0x9e, 0x34, 0x9e, 0x9e, 0x9e, 0x33, 0x9e, 0x9e, 0x9e, 0x30, 0x9e, 0x9e, 0x9e, 0x30, 0x9e, 0x9e, 0x9e, 0x2f, 0x9e, 0x9e, 0x9e, 0x2f, 0x9e, 0x9e, 0x9e, 0x2c, 0x9e, 0x9e, 0x9e, 0x2b, 0x9e, 0x9e, 0x9e, 0x2b, 0x9e, 0x9e, 0x9e, 0x2b, 0x9e, 0x9e, 0x9e, 0x2b, 0x9e, 0x9e, 0x9e, 0x2b, 0x9e, 0x9e, 0x9e, 0x28, 0x9e, 0x9e, 0x9e, 0x28, 0x9e, 0x9e, 0x9e, 0x28, 0x9e, 0x9e, 0x9e, 0x28, 0x9e, 0x9e, 0x9e, 0x28, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9d, 0x9d, 0x9d, 0x24, 0x9d, 0x9d, 0x9d, 0x23, 0x9d, 0x9d, 0x9d, 0x23, 0x9d, 0x9d, 0x9d, 0x23, 0x9d, 0x9d, 0x9d, 0x23, 0x9d, 0x9d, 0x9d, 0x23, 0x9d, 0x9d, 0x9d, 0x23, 0x9d, 0x9d, 0x9d, 0x23, 0x9d, 0x9d, 0x9d, 0x23, 0x9d, 0x9d, 0x9d, 0x24, 0x9d, 0x9d, 0x9d, 0x24, 0x9d, 0x9d, 0x9d, 0x23, 0x9d, 0x9d, 0x9d, 0x23, 0x9d, 0x9d, 0x9d, 0x23, 0x9d, 0x9d, 0x9d, 0x23, 0x9d, 0x9d, 0x9d, 0x23, 0x9d, 0x9d, 0x9d, 0x23, 0x9d, 0x9d, 0x9d, 0x23, 0x9d, 0x9d, 0x9d, 0x24, 0x9d, 0x9d, 0x9d, 0x24, 0x9d, 0x9d, 0x9d, 0x24, 0x9d, 0x9d, 0x9d, 0x24, 0x9d, 0x9d, 0x9d, 0x24, 0x9d, 0x9d, 0x9d, 0x24, 0x9d, 0x9d, 0x9d, 0x24, 0x9d, 0x9d, 0x9d, 0x27, 0x9d, 0x9d, 0x9d, 0x27, 0x9d, 0x9d, 0x9d, 0x27, 0x9d, 0x9d, 0x9d, 0x27, 0x9d, 0x9d, 0x9d, 0x27, 0x9d, 0x9d, 0x9d, 0x28, 0x9d, 0x9d, 0x9d, 0x28, 0x9e, 0x9e, 0x9e, 0x2b, 0x9e, 0x9e, 0x9e, 0x2c, 0x9e, 0x9e, 0x9e, 0x2c, 0x9e, 0x9e, 0x9e, 0x2f, 0x9e, 0x9e, 0x9e, 0x30, 0x9f, 0x9f, 0x9f, 0x33, 0x9f, 0x9f, 0x9f, 0x33, 0x9f, 0x9f, 0x9f, 0x37, 0x9f, 0x9f, 0x9f, 0x3b, 0x9e, 0x9e, 0x9e, 0x40, 0xa9, 0xa9, 0xa9, 0x53, 0xc9, 0xc9, 0xc9, 0x77, 0xe0, 0xe0, 0xe0, 0x9f, 0xee, 0xee, 0xee, 0xc7, 0xf9, 0xf9, 0xf9, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xf7, 0xf7, 0x10, 0xf6, 0xf6, 0xf6, 0x6b, 0xf6, 0xf6, 0xf6, 0xc8, 0xf5, 0xf5, 0xf5, 0xff, 0xf4, 0xf4, 0xf4, 0xfc, 0xed, 0xed, 0xed, 0xd3, 0xe1, 0xe1, 0xe1, 0x9c, 0xca, 0xca, 0xca, 0x68, 0xa6, 0xa6, 0xa6, 0x40, 0x9e, 0x9e, 0x9e, 0x38, 0x9e, 0x9e, 0x9e, 0x37, 0x9e, 0x9e, 0x9e, 0x34, 0x9e, 0x9e, 0x9e, 0x33, 0x9e, 0x9e, 0x9e, 0x30, 0x9e, 0x9e, 0x9e, 0x2f, 0x9e, 0x9e, 0x9e, 0x2c, 0x9e, 0x9e, 0x9e, 0x2c, 0x9e, 0x9e, 0x9e, 0x2b, 0x9e, 0x9e, 0x9e, 0x2b, 0x9e, 0x9e, 0x9e, 0x28, 0x9e, 0x9e, 0x9e, 0x28, 0x9e, 0x9e, 0x9e, 0x28, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x23, 0x9d, 0x9d, 0x9d, 0x23, 0x9d, 0x9d, 0x9d, 0x23, 0x9d, 0x9d, 0x9d, 0x23, 0x9d, 0x9d, 0x9d, 0x23, 0x9d, 0x9d, 0x9d, 0x23, 0x9d, 0x9d, 0x9d, 0x23, 0x9d, 0x9d, 0x9d, 0x23, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x28, 0x9f, 0x9f, 0x9f, 0x2b, 0x9f, 0x9f, 0x9f, 0x2b, 0x9f, 0x9f, 0x9f, 0x2c, 0x9f, 0x9f, 0x9f, 0x2f, 0x9f, 0x9f, 0x9f, 0x30, 0xa0, 0xa0, 0xa0, 0x30, 0xa0, 0xa0, 0xa0, 0x33, 0xa0, 0xa0, 0xa0, 0x37, 0xa1, 0xa1, 0xa1, 0x3c, 0xc4, 0xc4, 0xc4, 0x5f, 0xe2, 0xe2, 0xe2, 0x90, 0xf3, 0xf3, 0xf3, 0xc4, 0xfd, 0xfd, 0xfd, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xf8, 0xf8, 0x1c, 0xf9, 0xf9, 0xf9, 0x90, 0xf7, 0xf7, 0xf7, 0xf3, 0xf6, 0xf6, 0xf6, 0xfc, 0xf0, 0xf0, 0xf0, 0xd3, 0xdf, 0xdf, 0xdf, 0x8b, 0xba, 0xba, 0xba, 0x4b, 0x9e, 0x9e, 0x9e, 0x37, 0x9e, 0x9e, 0x9e, 0x34, 0x9e, 0x9e, 0x9e, 0x30, 0x9e, 0x9e, 0x9e, 0x2f, 0x9e, 0x9e, 0x9e, 0x2c, 0x9e, 0x9e, 0x9e, 0x2b, 0x9e, 0x9e, 0x9e, 0x28, 0x9e, 0x9e, 0x9e, 0x28, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1f, 0x9d, 0x9d, 0x9d, 0x1f, 0x9d, 0x9d, 0x9d, 0x1f, 0x9d, 0x9d, 0x9d, 0x1f, 0x9d, 0x9d, 0x9d, 0x1f, 0x9d, 0x9d, 0x9d, 0x1f, 0x9d, 0x9d, 0x9d, 0x1f, 0x9d, 0x9d, 0x9d, 0x1f, 0x9d, 0x9d, 0x9d, 0x1f, 0x9d, 0x9d, 0x9d, 0x1f, 0x9d, 0x9d, 0x9d, 0x1f, 0x9d, 0x9d, 0x9d, 0x1f, 0x9d, 0x9d, 0x9d, 0x1f, 0x9d, 0x9d, 0x9d, 0x1f, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9f, 0x9f, 0x9f, 0x24, 0x9f, 0x9f, 0x9f, 0x24, 0x9f, 0x9f, 0x9f, 0x24, 0x9f, 0x9f, 0x9f, 0x27, 0x9f, 0x9f, 0x9f, 0x27, 0xa0, 0xa0, 0xa0, 0x2b, 0xa1, 0xa1, 0xa1, 0x2f, 0xa2, 0xa2, 0xa2, 0x33, 0xaf, 0xaf, 0xaf, 0x3f, 0xdf, 0xdf, 0xdf, 0x73, 0xf6, 0xf6, 0xf6, 0xb7, 0xfe, 0xfe, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0x2c, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xf9, 0xf9, 0x07, 0xfa, 0xfa, 0xfa, 0x7b, 0xfa, 0xfa, 0xfa, 0xf4, 0xf8, 0xf8, 0xf8, 0xf8, 0xec, 0xec, 0xec, 0xaf, 0xc7, 0xc7, 0xc7, 0x5b, 0x9e, 0x9e, 0x9e, 0x38, 0x9e, 0x9e, 0x9e, 0x33, 0x9e, 0x9e, 0x9e, 0x2f, 0x9e, 0x9e, 0x9e, 0x2c, 0x9e, 0x9e, 0x9e, 0x2b, 0x9e, 0x9e, 0x9e, 0x28, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9f, 0x9f, 0x9f, 0x20, 0x9f, 0x9f, 0x9f, 0x23, 0xa0, 0xa0, 0xa0, 0x24, 0xa1, 0xa1, 0xa1, 0x24, 0xa1, 0xa1, 0xa1, 0x27, 0xa2, 0xa2, 0xa2, 0x28, 0xbf, 0xbf, 0xbf, 0x38, 0xee, 0xee, 0xee, 0x88, 0xfd, 0xfd, 0xfd, 0xe4, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xfe, 0x93, 0xfc, 0xfc, 0xfc, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xfb, 0xfb, 0x13, 0xfc, 0xfc, 0xfc, 0xbf, 0xfb, 0xfb, 0xfb, 0xff, 0xf1, 0xf1, 0xf1, 0xb8, 0xc0, 0xc0, 0xc0, 0x4f, 0x9e, 0x9e, 0x9e, 0x34, 0x9e, 0x9e, 0x9e, 0x33, 0x9e, 0x9e, 0x9e, 0x2f, 0x9e, 0x9e, 0x9e, 0x2b, 0x9e, 0x9e, 0x9e, 0x28, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9f, 0x9f, 0x9f, 0x1c, 0x9f, 0x9f, 0x9f, 0x1f, 0x9f, 0x9f, 0x9f, 0x1f, 0xa0, 0xa0, 0xa0, 0x20, 0xb2, 0xb2, 0xb2, 0x2b, 0xf1, 0xf1, 0xf1, 0x84, 0xfe, 0xfe, 0xfe, 0xf3, 0xfe, 0xfe, 0xfe, 0xd3, 0xf6, 0xf6, 0xf6, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xe2, 0xe2, 0x04, 0xfc, 0xfc, 0xfc, 0xbf, 0xfd, 0xfd, 0xfd, 0xfb, 0xe2, 0xe2, 0xe2, 0x80, 0x9f, 0x9f, 0x9f, 0x37, 0x9e, 0x9e, 0x9e, 0x33, 0x9e, 0x9e, 0x9e, 0x30, 0x9e, 0x9e, 0x9e, 0x2c, 0x9e, 0x9e, 0x9e, 0x28, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1c, 0x9c, 0x9c, 0x9c, 0x1c, 0x9c, 0x9c, 0x9c, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0xd7, 0xd7, 0xd7, 0x3f, 0xfd, 0xfd, 0xfd, 0xdc, 0xfd, 0xfd, 0xfd, 0xd0, 0xe6, 0xe6, 0xe6, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xf5, 0xf5, 0x50, 0xfe, 0xfe, 0xfe, 0xff, 0xe7, 0xe7, 0xe7, 0x8f, 0x9e, 0x9e, 0x9e, 0x37, 0x9e, 0x9e, 0x9e, 0x33, 0x9e, 0x9e, 0x9e, 0x30, 0x9e, 0x9e, 0x9e, 0x2c, 0x9e, 0x9e, 0x9e, 0x2b, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x99, 0x99, 0x99, 0x18, 0x99, 0x99, 0x99, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x97, 0x97, 0x97, 0x1b, 0xd6, 0xd6, 0xd6, 0x38, 0xff, 0xff, 0xff, 0xf4, 0xf7, 0xf7, 0xf7, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xfa, 0xfa, 0x77, 0xfe, 0xfe, 0xfe, 0xff, 0xc0, 0xc0, 0xc0, 0x4f, 0x9e, 0x9e, 0x9e, 0x34, 0x9e, 0x9e, 0x9e, 0x30, 0x9e, 0x9e, 0x9e, 0x2c, 0x9e, 0x9e, 0x9e, 0x2b, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x24, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9b, 0x9b, 0x9b, 0x1b, 0x9b, 0x9b, 0x9b, 0x1b, 0x9b, 0x9b, 0x9b, 0x1b, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x99, 0x99, 0x99, 0x18, 0x99, 0x99, 0x99, 0x18, 0x98, 0x98, 0x98, 0x18, 0x97, 0x97, 0x97, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x95, 0x95, 0x95, 0x18, 0x94, 0x94, 0x94, 0x18, 0x94, 0x94, 0x94, 0x18, 0xfc, 0xfc, 0xfc, 0xcb, 0xf7, 0xf7, 0xf7, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xe4, 0xe4, 0x53, 0xfe, 0xfe, 0xfe, 0xff, 0xe3, 0xe3, 0xe3, 0x87, 0x9d, 0x9d, 0x9d, 0x37, 0x9d, 0x9d, 0x9d, 0x30, 0x9d, 0x9d, 0x9d, 0x2c, 0x9d, 0x9d, 0x9d, 0x2b, 0x9d, 0x9d, 0x9d, 0x27, 0x9d, 0x9d, 0x9d, 0x23, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x1f, 0x9e, 0x9e, 0x9e, 0x1c, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9e, 0x9e, 0x9e, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1c, 0x9c, 0x9c, 0x9c, 0x1c, 0x9c, 0x9c, 0x9c, 0x1c, 0x9b, 0x9b, 0x9b, 0x1b, 0x9b, 0x9b, 0x9b, 0x1b, 0x9b, 0x9b, 0x9b, 0x1b, 0x9a, 0x9a, 0x9a, 0x1b, 0x99, 0x99, 0x99, 0x1b, 0x99, 0x99, 0x99, 0x1b, 0x98, 0x98, 0x98, 0x1b, 0x97, 0x97, 0x97, 0x1b, 0x97, 0x97, 0x97, 0x1b, 0x96, 0x96, 0x96, 0x1b, 0x96, 0x96, 0x96, 0x1c, 0xcb, 0xcb, 0xcb, 0x33, 0xfe, 0xfe, 0xfe, 0xf0, 0xf6, 0xf6, 0xf6, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xb7, 0xb7, 0x23, 0xf3, 0xf3, 0xf3, 0xd4, 0xfc, 0xfc, 0xfc, 0xf4, 0xd5, 0xd5, 0xd5, 0x73, 0x9c, 0x9c, 0x9c, 0x38, 0x9c, 0x9c, 0x9c, 0x30, 0x9c, 0x9c, 0x9c, 0x2b, 0x9c, 0x9c, 0x9c, 0x27, 0x9c, 0x9c, 0x9c, 0x23, 0x9c, 0x9c, 0x9c, 0x20, 0x9c, 0x9c, 0x9c, 0x1f, 0x9c, 0x9c, 0x9c, 0x1f, 0x9c, 0x9c, 0x9c, 0x1c, 0x9c, 0x9c, 0x9c, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x18, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9f, 0x9f, 0x9f, 0x1c, 0x9f, 0x9f, 0x9f, 0x1c, 0x9f, 0x9f, 0x9f, 0x1c, 0x9f, 0x9f, 0x9f, 0x1c, 0x9f, 0x9f, 0x9f, 0x1c, 0x9f, 0x9f, 0x9f, 0x1c, 0x9f, 0x9f, 0x9f, 0x1c, 0x9f, 0x9f, 0x9f, 0x1c, 0x9f, 0x9f, 0x9f, 0x1c, 0x9f, 0x9f, 0x9f, 0x1c, 0x9f, 0x9f, 0x9f, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9d, 0x9d, 0x9d, 0x1f, 0x9d, 0x9d, 0x9d, 0x1f, 0x9d, 0x9d, 0x9d, 0x1f, 0x9d, 0x9d, 0x9d, 0x1f, 0x9c, 0x9c, 0x9c, 0x1f, 0x9c, 0x9c, 0x9c, 0x1f, 0x9b, 0x9b, 0x9b, 0x1f, 0x9b, 0x9b, 0x9b, 0x1f, 0x9b, 0x9b, 0x9b, 0x20, 0x9a, 0x9a, 0x9a, 0x20, 0x99, 0x99, 0x99, 0x20, 0x99, 0x99, 0x99, 0x20, 0x98, 0x98, 0x98, 0x23, 0xc4, 0xc4, 0xc4, 0x37, 0xfb, 0xfb, 0xfb, 0xcf, 0xfc, 0xfc, 0xfc, 0xf3, 0xd1, 0xd1, 0xd1, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xb2, 0xb2, 0x0b, 0xc6, 0xc6, 0xc6, 0x78, 0xf8, 0xf8, 0xf8, 0xd3, 0xfb, 0xfb, 0xfb, 0xfc, 0xe9, 0xe9, 0xe9, 0xa8, 0xaf, 0xaf, 0xaf, 0x47, 0x9b, 0x9b, 0x9b, 0x33, 0x9b, 0x9b, 0x9b, 0x2b, 0x9b, 0x9b, 0x9b, 0x27, 0x9b, 0x9b, 0x9b, 0x23, 0x9b, 0x9b, 0x9b, 0x20, 0x9b, 0x9b, 0x9b, 0x1f, 0x9b, 0x9b, 0x9b, 0x1c, 0x9b, 0x9b, 0x9b, 0x1c, 0x9b, 0x9b, 0x9b, 0x1b, 0x9b, 0x9b, 0x9b, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1b, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9f, 0x9f, 0x9f, 0x1c, 0x9f, 0x9f, 0x9f, 0x1c, 0x9f, 0x9f, 0x9f, 0x1c, 0x9f, 0x9f, 0x9f, 0x1f, 0x9f, 0x9f, 0x9f, 0x1f, 0x9f, 0x9f, 0x9f, 0x1f, 0x9f, 0x9f, 0x9f, 0x1f, 0x9f, 0x9f, 0x9f, 0x1f, 0xa0, 0xa0, 0xa0, 0x1f, 0xa0, 0xa0, 0xa0, 0x1f, 0xa0, 0xa0, 0xa0, 0x20, 0xa0, 0xa0, 0xa0, 0x20, 0xa0, 0xa0, 0xa0, 0x20, 0xa0, 0xa0, 0xa0, 0x20, 0xa0, 0xa0, 0xa0, 0x20, 0xa0, 0xa0, 0xa0, 0x20, 0x9f, 0x9f, 0x9f, 0x20, 0x9f, 0x9f, 0x9f, 0x20, 0x9f, 0x9f, 0x9f, 0x23, 0x9f, 0x9f, 0x9f, 0x23, 0x9f, 0x9f, 0x9f, 0x23, 0x9f, 0x9f, 0x9f, 0x24, 0x9f, 0x9f, 0x9f, 0x24, 0x9f, 0x9f, 0x9f, 0x24, 0x9f, 0x9f, 0x9f, 0x27, 0x9f, 0x9f, 0x9f, 0x27, 0x9e, 0x9e, 0x9e, 0x27, 0x9e, 0x9e, 0x9e, 0x27, 0x9d, 0x9d, 0x9d, 0x27, 0x9c, 0x9c, 0x9c, 0x27, 0x9c, 0x9c, 0x9c, 0x28, 0x9c, 0x9c, 0x9c, 0x28, 0x9c, 0x9c, 0x9c, 0x2b, 0x9b, 0x9b, 0x9b, 0x2b, 0xa0, 0xa0, 0xa0, 0x2f, 0xe6, 0xe6, 0xe6, 0x73, 0xfd, 0xfd, 0xfd, 0xe8, 0xfd, 0xfd, 0xfd, 0xf0, 0xd7, 0xd7, 0xd7, 0x94, 0xb2, 0xb2, 0xb2, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xb0, 0xb0, 0x03, 0xb8, 0xb8, 0xb8, 0x6f, 0xcd, 0xcd, 0xcd, 0x53, 0xf6, 0xf6, 0xf6, 0x9c, 0xfa, 0xfa, 0xfa, 0xf8, 0xf7, 0xf7, 0xf7, 0xef, 0xe4, 0xe4, 0xe4, 0x9f, 0xb7, 0xb7, 0xb7, 0x48, 0x99, 0x99, 0x99, 0x2f, 0x9a, 0x9a, 0x9a, 0x27, 0x9b, 0x9b, 0x9b, 0x23, 0x9b, 0x9b, 0x9b, 0x20, 0x9b, 0x9b, 0x9b, 0x1f, 0x9b, 0x9b, 0x9b, 0x1c, 0x9b, 0x9b, 0x9b, 0x1b, 0x9b, 0x9b, 0x9b, 0x1b, 0x9b, 0x9b, 0x9b, 0x1b, 0x9b, 0x9b, 0x9b, 0x1b, 0x9b, 0x9b, 0x9b, 0x1b, 0x9b, 0x9b, 0x9b, 0x1b, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x18, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1c, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9f, 0x9f, 0x9f, 0x1f, 0x9f, 0x9f, 0x9f, 0x1f, 0x9f, 0x9f, 0x9f, 0x20, 0x9f, 0x9f, 0x9f, 0x20, 0x9f, 0x9f, 0x9f, 0x23, 0x9f, 0x9f, 0x9f, 0x23, 0x9f, 0x9f, 0x9f, 0x23, 0xa0, 0xa0, 0xa0, 0x23, 0xa0, 0xa0, 0xa0, 0x23, 0xa0, 0xa0, 0xa0, 0x24, 0xa1, 0xa1, 0xa1, 0x24, 0xa1, 0xa1, 0xa1, 0x24, 0xa1, 0xa1, 0xa1, 0x27, 0xa1, 0xa1, 0xa1, 0x27, 0xa1, 0xa1, 0xa1, 0x27, 0xa1, 0xa1, 0xa1, 0x27, 0xa1, 0xa1, 0xa1, 0x27, 0xa1, 0xa1, 0xa1, 0x27, 0xa1, 0xa1, 0xa1, 0x27, 0xa1, 0xa1, 0xa1, 0x28, 0xa0, 0xa0, 0xa0, 0x28, 0xa0, 0xa0, 0xa0, 0x28, 0xa0, 0xa0, 0xa0, 0x2b, 0xa0, 0xa0, 0xa0, 0x2b, 0xa0, 0xa0, 0xa0, 0x2c, 0xa1, 0xa1, 0xa1, 0x2c, 0xa1, 0xa1, 0xa1, 0x2f, 0xa1, 0xa1, 0xa1, 0x2f, 0xa1, 0xa1, 0xa1, 0x30, 0xa0, 0xa0, 0xa0, 0x30, 0xa0, 0xa0, 0xa0, 0x33, 0xa1, 0xa1, 0xa1, 0x34, 0xa1, 0xa1, 0xa1, 0x34, 0xac, 0xac, 0xac, 0x3c, 0xe3, 0xe3, 0xe3, 0x7b, 0xfa, 0xfa, 0xfa, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xcb, 0xd8, 0xd8, 0xd8, 0x6b, 0xb7, 0xb7, 0xb7, 0x7c, 0xb0, 0xb0, 0xb0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xb5, 0xb5, 0x63, 0xbe, 0xbe, 0xbe, 0x5b, 0xc9, 0xc9, 0xc9, 0x40, 0xe7, 0xe7, 0xe7, 0x4c, 0xf7, 0xf7, 0xf7, 0xaf, 0xf8, 0xf8, 0xf8, 0xf8, 0xf6, 0xf6, 0xf6, 0xf8, 0xec, 0xec, 0xec, 0xbf, 0xd8, 0xd8, 0xd8, 0x74, 0xa9, 0xa9, 0xa9, 0x34, 0x98, 0x98, 0x98, 0x27, 0x98, 0x98, 0x98, 0x20, 0x99, 0x99, 0x99, 0x1f, 0x99, 0x99, 0x99, 0x1c, 0x99, 0x99, 0x99, 0x1b, 0x99, 0x99, 0x99, 0x1b, 0x9a, 0x9a, 0x9a, 0x1b, 0x9a, 0x9a, 0x9a, 0x1b, 0x9a, 0x9a, 0x9a, 0x1b, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x1b, 0x9b, 0x9b, 0x9b, 0x1b, 0x9b, 0x9b, 0x9b, 0x1b, 0x9b, 0x9b, 0x9b, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1b, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x1f, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9f, 0x9f, 0x9f, 0x20, 0x9f, 0x9f, 0x9f, 0x23, 0x9f, 0x9f, 0x9f, 0x23, 0x9f, 0x9f, 0x9f, 0x24, 0x9f, 0x9f, 0x9f, 0x24, 0xa0, 0xa0, 0xa0, 0x27, 0xa0, 0xa0, 0xa0, 0x27, 0xa0, 0xa0, 0xa0, 0x27, 0xa1, 0xa1, 0xa1, 0x27, 0xa1, 0xa1, 0xa1, 0x28, 0xa1, 0xa1, 0xa1, 0x28, 0xa2, 0xa2, 0xa2, 0x28, 0xa2, 0xa2, 0xa2, 0x2b, 0xa2, 0xa2, 0xa2, 0x2b, 0xa2, 0xa2, 0xa2, 0x2c, 0xa3, 0xa3, 0xa3, 0x2c, 0xa3, 0xa3, 0xa3, 0x2c, 0xa3, 0xa3, 0xa3, 0x2f, 0xa3, 0xa3, 0xa3, 0x2f, 0xa3, 0xa3, 0xa3, 0x30, 0xa3, 0xa3, 0xa3, 0x30, 0xa3, 0xa3, 0xa3, 0x30, 0xa3, 0xa3, 0xa3, 0x33, 0xa3, 0xa3, 0xa3, 0x33, 0xa3, 0xa3, 0xa3, 0x34, 0xa4, 0xa4, 0xa4, 0x37, 0xa4, 0xa4, 0xa4, 0x38, 0xa4, 0xa4, 0xa4, 0x38, 0xa5, 0xa5, 0xa5, 0x3b, 0xa5, 0xa5, 0xa5, 0x3c, 0xa5, 0xa5, 0xa5, 0x3c, 0xa9, 0xa9, 0xa9, 0x43, 0xd2, 0xd2, 0xd2, 0x67, 0xf0, 0xf0, 0xf0, 0xa8, 0xfc, 0xfc, 0xfc, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xd3, 0xf0, 0xf0, 0xf0, 0x74, 0xc8, 0xc8, 0xc8, 0x48, 0xbb, 0xbb, 0xbb, 0x60, 0xb3, 0xb3, 0xb3, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0x53, 0xba, 0xba, 0xba, 0x60, 0xc0, 0xc0, 0xc0, 0x47, 0xc7, 0xc7, 0xc7, 0x38, 0xd0, 0xd0, 0xd0, 0x2c, 0xe6, 0xe6, 0xe6, 0x3c, 0xf5, 0xf5, 0xf5, 0x8f, 0xf6, 0xf6, 0xf6, 0xe0, 0xf5, 0xf5, 0xf5, 0xff, 0xf3, 0xf3, 0xf3, 0xf4, 0xeb, 0xeb, 0xeb, 0xbc, 0xe0, 0xe0, 0xe0, 0x7c, 0xc3, 0xc3, 0xc3, 0x40, 0x9b, 0x9b, 0x9b, 0x23, 0x97, 0x97, 0x97, 0x1c, 0x97, 0x97, 0x97, 0x1c, 0x98, 0x98, 0x98, 0x1c, 0x98, 0x98, 0x98, 0x1b, 0x98, 0x98, 0x98, 0x1b, 0x99, 0x99, 0x99, 0x18, 0x99, 0x99, 0x99, 0x18, 0x99, 0x99, 0x99, 0x18, 0x99, 0x99, 0x99, 0x18, 0x99, 0x99, 0x99, 0x18, 0x99, 0x99, 0x99, 0x18, 0x99, 0x99, 0x99, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x18, 0x9b, 0x9b, 0x9b, 0x1b, 0x9b, 0x9b, 0x9b, 0x1b, 0x9b, 0x9b, 0x9b, 0x1b, 0x9b, 0x9b, 0x9b, 0x1b, 0x9b, 0x9b, 0x9b, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9c, 0x9c, 0x9c, 0x1b, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1c, 0x9d, 0x9d, 0x9d, 0x1f, 0x9d, 0x9d, 0x9d, 0x1f, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x20, 0x9e, 0x9e, 0x9e, 0x23, 0x9e, 0x9e, 0x9e, 0x23, 0x9f, 0x9f, 0x9f, 0x23, 0x9f, 0x9f, 0x9f, 0x24, 0xa0, 0xa0, 0xa0, 0x24, 0xa0, 0xa0, 0xa0, 0x27, 0xa1, 0xa1, 0xa1, 0x27, 0xa1, 0xa1, 0xa1, 0x28, 0xa1, 0xa1, 0xa1, 0x2b, 0xa2, 0xa2, 0xa2, 0x2b, 0xa2, 0xa2, 0xa2, 0x2c, 0xa3, 0xa3, 0xa3, 0x2c, 0xa3, 0xa3, 0xa3, 0x2c, 0xa3, 0xa3, 0xa3, 0x2f, 0xa3, 0xa3, 0xa3, 0x2f, 0xa4, 0xa4, 0xa4, 0x30, 0xa4, 0xa4, 0xa4, 0x33, 0xa5, 0xa5, 0xa5, 0x34, 0xa6, 0xa6, 0xa6, 0x37, 0xa6, 0xa6, 0xa6, 0x37, 0xa6, 0xa6, 0xa6, 0x37, 0xa5, 0xa5, 0xa5, 0x38, 0xa6, 0xa6, 0xa6, 0x38, 0xa6, 0xa6, 0xa6, 0x3b, 0xa6, 0xa6, 0xa6, 0x3c, 0xa7, 0xa7, 0xa7, 0x3c, 0xa7, 0xa7, 0xa7, 0x3f, 0xa8, 0xa8, 0xa8, 0x40, 0xa8, 0xa8, 0xa8, 0x43, 0xa9, 0xa9, 0xa9, 0x44, 0xaa, 0xaa, 0xaa, 0x47, 0xb9, 0xb9, 0xb9, 0x54, 0xdd, 0xdd, 0xdd, 0x80, 0xf0, 0xf0, 0xf0, 0xb3, 0xfb, 0xfb, 0xfb, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xfc, 0xfc, 0xfc, 0xb0, 0xef, 0xef, 0xef, 0x5f, 0xcd, 0xcd, 0xcd, 0x34, 0xc1, 0xc1, 0xc1, 0x3f, 0xbc, 0xbc, 0xbc, 0x4f, 0xb7, 0xb7, 0xb7, 0x64, 0xb2, 0xb2, 0xb2, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xb2, 0xb2, 0x3f, 0xb9, 0xb9, 0xb9, 0x68, 0xbf, 0xbf, 0xbf, 0x4b, 0xc2, 0xc2, 0xc2, 0x3f, 0xc6, 0xc6, 0xc6, 0x33, 0xcb, 0xcb, 0xcb, 0x2f, 0xd0, 0xd0, 0xd0, 0x28, 0xd9, 0xd9, 0xd9, 0x23, 0xed, 0xed, 0xed, 0x50, 0xf2, 0xf2, 0xf2, 0x97, 0xf3, 0xf3, 0xf3, 0xdb, 0xf2, 0xf2, 0xf2, 0xfc, 0xf1, 0xf1, 0xf1, 0xff, 0xee, 0xee, 0xee, 0xe0, 0xe8, 0xe8, 0xe8, 0xac, 0xe1, 0xe1, 0xe1, 0x78, 0xd0, 0xd0, 0xd0, 0x44, 0xa4, 0xa4, 0xa4, 0x20, 0x96, 0x96, 0x96, 0x1b, 0x96, 0x96, 0x96, 0x1b, 0x97, 0x97, 0x97, 0x18, 0x97, 0x97, 0x97, 0x18, 0x97, 0x97, 0x97, 0x18, 0x97, 0x97, 0x97, 0x18, 0x97, 0x97, 0x97, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x99, 0x99, 0x99, 0x18, 0x99, 0x99, 0x99, 0x18, 0x99, 0x99, 0x99, 0x18, 0x99, 0x99, 0x99, 0x18, 0x99, 0x99, 0x99, 0x18, 0x99, 0x99, 0x99, 0x18, 0x99, 0x99, 0x99, 0x18, 0x99, 0x99, 0x99, 0x18, 0x99, 0x99, 0x99, 0x18, 0x99, 0x99, 0x99, 0x18, 0x99, 0x99, 0x99, 0x18, 0x99, 0x99, 0x99, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x99, 0x99, 0x99, 0x18, 0x99, 0x99, 0x99, 0x18, 0x99, 0x99, 0x99, 0x18, 0x99, 0x99, 0x99, 0x18, 0x99, 0x99, 0x99, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9a, 0x9a, 0x9a, 0x18, 0x9b, 0x9b, 0x9b, 0x1b, 0x9b, 0x9b, 0x9b, 0x1b, 0x9b, 0x9b, 0x9b, 0x1b, 0x9b, 0x9b, 0x9b, 0x1b, 0x9b, 0x9b, 0x9b, 0x1c, 0x9b, 0x9b, 0x9b, 0x1c, 0x9b, 0x9b, 0x9b, 0x1c, 0x9b, 0x9b, 0x9b, 0x1f, 0x9c, 0x9c, 0x9c, 0x1f, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x20, 0x9d, 0x9d, 0x9d, 0x23, 0x9e, 0x9e, 0x9e, 0x24, 0x9f, 0x9f, 0x9f, 0x27, 0x9f, 0x9f, 0x9f, 0x27, 0xa0, 0xa0, 0xa0, 0x28, 0xa0, 0xa0, 0xa0, 0x28, 0xa1, 0xa1, 0xa1, 0x2b, 0xa2, 0xa2, 0xa2, 0x2c, 0xa2, 0xa2, 0xa2, 0x2f, 0xa3, 0xa3, 0xa3, 0x30, 0xa4, 0xa4, 0xa4, 0x33, 0xa4, 0xa4, 0xa4, 0x33, 0xa5, 0xa5, 0xa5, 0x33, 0xa5, 0xa5, 0xa5, 0x34, 0xa5, 0xa5, 0xa5, 0x37, 0xa6, 0xa6, 0xa6, 0x38, 0xa7, 0xa7, 0xa7, 0x3b, 0xa7, 0xa7, 0xa7, 0x3b, 0xa8, 0xa8, 0xa8, 0x3f, 0xa8, 0xa8, 0xa8, 0x3f, 0xa9, 0xa9, 0xa9, 0x40, 0xa9, 0xa9, 0xa9, 0x40, 0xa9, 0xa9, 0xa9, 0x43, 0xaa, 0xaa, 0xaa, 0x44, 0xaa, 0xaa, 0xaa, 0x47, 0xab, 0xab, 0xab, 0x48, 0xab, 0xab, 0xab, 0x4b, 0xad, 0xad, 0xad, 0x4f, 0xc3, 0xc3, 0xc3, 0x63, 0xde, 0xde, 0xde, 0x88, 0xee, 0xee, 0xee, 0xb0, 0xf8, 0xf8, 0xf8, 0xd8, 0xfe, 0xfe, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfd, 0xfd, 0xfd, 0xb3, 0xf6, 0xf6, 0xf6, 0x6f, 0xdf, 0xdf, 0xdf, 0x33, 0xcd, 0xcd, 0xcd, 0x2f, 0xc5, 0xc5, 0xc5, 0x34, 0xbf, 0xbf, 0xbf, 0x3b, 0xbc, 0xbc, 0xbc, 0x44, 0xb9, 0xb9, 0xb9, 0x53, 0xb6, 0xb6, 0xb6, 0x6b, 0xb2, 0xb2, 0xb2, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xb1, 0xb1, 0x28, 0xb8, 0xb8, 0xb8, 0x70, 0xbe, 0xbe, 0xbe, 0x4f, 0xc1, 0xc1, 0xc1, 0x40, 0xc4, 0xc4, 0xc4, 0x37, 0xc6, 0xc6, 0xc6, 0x33, 0xc8, 0xc8, 0xc8, 0x2f, 0xcc, 0xcc, 0xcc, 0x2b, 0xd0, 0xd0, 0xd0, 0x24, 0xd2, 0xd2, 0xd2, 0x23, 0xd8, 0xd8, 0xd8, 0x20, 0xe8, 0xe8, 0xe8, 0x3c, 0xee, 0xee, 0xee, 0x74, 0xef, 0xef, 0xef, 0xac, 0xef, 0xef, 0xef, 0xe3, 0xee, 0xee, 0xee, 0xfc, 0xee, 0xee, 0xee, 0xff, 0xec, 0xec, 0xec, 0xf3, 0xe9, 0xe9, 0xe9, 0xcb, 0xe5, 0xe5, 0xe5, 0x9f, 0xe0, 0xe0, 0xe0, 0x77, 0xd5, 0xd5, 0xd5, 0x4f, 0xba, 0xba, 0xba, 0x28, 0x9b, 0x9b, 0x9b, 0x1b, 0x95, 0x95, 0x95, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x97, 0x97, 0x97, 0x18, 0x97, 0x97, 0x97, 0x18, 0x97, 0x97, 0x97, 0x18, 0x97, 0x97, 0x97, 0x18, 0x97, 0x97, 0x97, 0x18, 0x97, 0x97, 0x97, 0x18, 0x97, 0x97, 0x97, 0x18, 0x97, 0x97, 0x97, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x98, 0x98, 0x98, 0x18, 0x99, 0x99, 0x99, 0x1b, 0x99, 0x99, 0x99, 0x1b, 0x99, 0x99, 0x99, 0x1b, 0x99, 0x99, 0x99, 0x1b, 0x99, 0x99, 0x99, 0x1b, 0x9a, 0x9a, 0x9a, 0x1c, 0x9a, 0x9a, 0x9a, 0x1c, 0x9b, 0x9b, 0x9b, 0x1f, 0x9b, 0x9b, 0x9b, 0x1f, 0x9b, 0x9b, 0x9b, 0x1f, 0x9b, 0x9b, 0x9b, 0x20, 0x9c, 0x9c, 0x9c, 0x23, 0x9d, 0x9d, 0x9d, 0x24, 0x9d, 0x9d, 0x9d, 0x27, 0x9e, 0x9e, 0x9e, 0x28, 0x9f, 0x9f, 0x9f, 0x2b, 0xa0, 0xa0, 0xa0, 0x2b, 0xa0, 0xa0, 0xa0, 0x2c, 0xa1, 0xa1, 0xa1, 0x2f, 0xa2, 0xa2, 0xa2, 0x30, 0xa3, 0xa3, 0xa3, 0x33, 0xa4, 0xa4, 0xa4, 0x34, 0xa5, 0xa5, 0xa5, 0x37, 0xa6, 0xa6, 0xa6, 0x38, 0xa6, 0xa6, 0xa6, 0x38, 0xa7, 0xa7, 0xa7, 0x3b, 0xa8, 0xa8, 0xa8, 0x3c, 0xa8, 0xa8, 0xa8, 0x40, 0xa9, 0xa9, 0xa9, 0x43, 0xaa, 0xaa, 0xaa, 0x44, 0xaa, 0xaa, 0xaa, 0x47, 0xac, 0xac, 0xac, 0x48, 0xac, 0xac, 0xac, 0x4b, 0xac, 0xac, 0xac, 0x4c, 0xad, 0xad, 0xad, 0x50, 0xb4, 0xb4, 0xb4, 0x57, 0xcd, 0xcd, 0xcd, 0x70, 0xdf, 0xdf, 0xdf, 0x8f, 0xec, 0xec, 0xec, 0xaf, 0xf6, 0xf6, 0xf6, 0xcf, 0xfc, 0xfc, 0xfc, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xfd, 0xfd, 0xfd, 0xc0, 0xfa, 0xfa, 0xfa, 0x8c, 0xf3, 0xf3, 0xf3, 0x54, 0xdb, 0xdb, 0xdb, 0x2b, 0xd2, 0xd2, 0xd2, 0x28, 0xcd, 0xcd, 0xcd, 0x2b, 0xc7, 0xc7, 0xc7, 0x2c, 0xc3, 0xc3, 0xc3, 0x33, 0xc0, 0xc0, 0xc0, 0x38, 0xbe, 0xbe, 0xbe, 0x3c, 0xbb, 0xbb, 0xbb, 0x47, 0xb9, 0xb9, 0xb9, 0x54, 0xb6, 0xb6, 0xb6, 0x6f, 0xb1, 0xb1, 0xb1, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xb1, 0xb1, 0x10, 0xb6, 0xb6, 0xb6, 0x78, 0xbe, 0xbe, 0xbe, 0x50, 0xc1, 0xc1, 0xc1, 0x43, 0xc3, 0xc3, 0xc3, 0x37, 0xc5, 0xc5, 0xc5, 0x33, 0xc7, 0xc7, 0xc7, 0x30, 0xc9, 0xc9, 0xc9, 0x2c, 0xca, 0xca, 0xca, 0x2b, 0xcc, 0xcc, 0xcc, 0x28, 0xce, 0xce, 0xce, 0x28, 0xd0, 0xd0, 0xd0, 0x27, 0xd3, 0xd3, 0xd3, 0x24, 0xd6, 0xd6, 0xd6, 0x20, 0xdb, 0xdb, 0xdb, 0x1f, 0xe5, 0xe5, 0xe5, 0x37, 0xea, 0xea, 0xea, 0x63, 0xed, 0xed, 0xed, 0x98, 0xef, 0xef, 0xef, 0xdf, 0xed, 0xed, 0xed, 0xf3, 0xeb, 0xeb, 0xeb, 0xff, 0xea, 0xea, 0xea, 0xff, 0xea, 0xea, 0xea, 0xff, 0xe8, 0xe8, 0xe8, 0xe8, 0xe6, 0xe6, 0xe6, 0xc7, 0xe4, 0xe4, 0xe4, 0xa4, 0xe0, 0xe0, 0xe0, 0x84, 0xdb, 0xdb, 0xdb, 0x67, 0xd1, 0xd1, 0xd1, 0x48, 0xbc, 0xbc, 0xbc, 0x2b, 0xa0, 0xa0, 0xa0, 0x1c, 0x98, 0x98, 0x98, 0x1b, 0x95, 0x95, 0x95, 0x18, 0x95, 0x95, 0x95, 0x18, 0x95, 0x95, 0x95, 0x18, 0x95, 0x95, 0x95, 0x18, 0x95, 0x95, 0x95, 0x18, 0x95, 0x95, 0x95, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x96, 0x96, 0x96, 0x18, 0x97, 0x97, 0x97, 0x18, 0x96, 0x96, 0x96, 0x18, 0x97, 0x97, 0x97, 0x1b, 0x97, 0x97, 0x97, 0x1b, 0x97, 0x97, 0x97, 0x1b, 0x98, 0x98, 0x98, 0x1b, 0x98, 0x98, 0x98, 0x1b, 0x98, 0x98, 0x98, 0x1c, 0x99, 0x99, 0x99, 0x1c, 0x99, 0x99, 0x99, 0x1f, 0x99, 0x99, 0x99, 0x1f, 0x9a, 0x9a, 0x9a, 0x20, 0x9b, 0x9b, 0x9b, 0x23, 0x9b, 0x9b, 0x9b, 0x24, 0x9c, 0x9c, 0x9c, 0x27, 0x9d, 0x9d, 0x9d, 0x28, 0x9d, 0x9d, 0x9d, 0x2b, 0x9e, 0x9e, 0x9e, 0x2b, 0x9f, 0x9f, 0x9f, 0x2f, 0xa0, 0xa0, 0xa0, 0x30, 0xa1, 0xa1, 0xa1, 0x33, 0xa2, 0xa2, 0xa2, 0x34, 0xa3, 0xa3, 0xa3, 0x37, 0xa5, 0xa5, 0xa5, 0x3b, 0xa6, 0xa6, 0xa6, 0x3c, 0xa7, 0xa7, 0xa7, 0x3f, 0xa8, 0xa8, 0xa8, 0x43, 0xa9, 0xa9, 0xa9, 0x44, 0xaa, 0xaa, 0xaa, 0x47, 0xab, 0xab, 0xab, 0x4b, 0xae, 0xae, 0xae, 0x50, 0xb7, 0xb7, 0xb7, 0x58, 0xcc, 0xcc, 0xcc, 0x6c, 0xda, 0xda, 0xda, 0x84, 0xe5, 0xe5, 0xe5, 0x9f, 0xee, 0xee, 0xee, 0xb4, 0xf5, 0xf5, 0xf5, 0xcc, 0xfa, 0xfa, 0xfa, 0xe7, 0xfe, 0xfe, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xfe, 0xfe, 0xfe, 0xcf, 0xfc, 0xfc, 0xfc, 0xa3, 0xf9, 0xf9, 0xf9, 0x77, 0xf2, 0xf2, 0xf2, 0x4b, 0xde, 0xde, 0xde, 0x27, 0xd6, 0xd6, 0xd6, 0x24, 0xd2, 0xd2, 0xd2, 0x27, 0xd0, 0xd0, 0xd0, 0x28, 0xcc, 0xcc, 0xcc, 0x2b, 0xc9, 0xc9, 0xc9, 0x2c, 0xc6, 0xc6, 0xc6, 0x2f, 0xc4, 0xc4, 0xc4, 0x30, 0xc1, 0xc1, 0xc1, 0x34, 0xbf, 0xbf, 0xbf, 0x38, 0xbd, 0xbd, 0xbd, 0x3f, 0xbb, 0xbb, 0xbb, 0x48, 0xb8, 0xb8, 0xb8, 0x57, 0xb5, 0xb5, 0xb5, 0x74, 0xb1, 0xb1, 0xb1, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xb0, 0xb0, 0x04, 0xb5, 0xb5, 0xb5, 0x77, 0xbd, 0xbd, 0xbd, 0x57, 0xc0, 0xc0, 0xc0, 0x44, 0xc3, 0xc3, 0xc3, 0x38, 0xc5, 0xc5, 0xc5, 0x33, 0xc7, 0xc7, 0xc7, 0x30, 0xc8, 0xc8, 0xc8, 0x2c, 0xca, 0xca, 0xca, 0x2b, 0xca, 0xca, 0xca, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcc, 0xcc, 0xcc, 0x2b, 0xcd, 0xcd, 0xcd, 0x28, 0xcf, 0xcf, 0xcf, 0x27, 0xd1, 0xd1, 0xd1, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd4, 0xd4, 0xd4, 0x23, 0xe2, 0xe2, 0xe2, 0x2c, 0xfa, 0xfa, 0xfa, 0x8c, 0xfb, 0xfb, 0xfb, 0x88, 0xf8, 0xf8, 0xf8, 0x8f, 0xf5, 0xf5, 0xf5, 0x9f, 0xf2, 0xf2, 0xf2, 0xb0, 0xee, 0xee, 0xee, 0xc4, 0xec, 0xec, 0xec, 0xd7, 0xea, 0xea, 0xea, 0xeb, 0xe8, 0xe8, 0xe8, 0xfb, 0xe8, 0xe8, 0xe8, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe7, 0xe7, 0xe7, 0xf3, 0xe6, 0xe6, 0xe6, 0xdc, 0xe4, 0xe4, 0xe4, 0xc4, 0xe4, 0xe4, 0xe4, 0xac, 0xe2, 0xe2, 0xe2, 0x97, 0xe0, 0xe0, 0xe0, 0x80, 0xdd, 0xdd, 0xdd, 0x6c, 0xd8, 0xd8, 0xd8, 0x58, 0xd2, 0xd2, 0xd2, 0x47, 0xc7, 0xc7, 0xc7, 0x34, 0xb1, 0xb1, 0xb1, 0x24, 0xa1, 0xa1, 0xa1, 0x1c, 0x9c, 0x9c, 0x9c, 0x1b, 0x98, 0x98, 0x98, 0x1b, 0x94, 0x94, 0x94, 0x18, 0x94, 0x94, 0x94, 0x18, 0x94, 0x94, 0x94, 0x18, 0x94, 0x94, 0x94, 0x18, 0x94, 0x94, 0x94, 0x18, 0x94, 0x94, 0x94, 0x18, 0x95, 0x95, 0x95, 0x18, 0x95, 0x95, 0x95, 0x18, 0x95, 0x95, 0x95, 0x18, 0x94, 0x94, 0x94, 0x18, 0x94, 0x94, 0x94, 0x18, 0x94, 0x94, 0x94, 0x18, 0x94, 0x94, 0x94, 0x18, 0x94, 0x94, 0x94, 0x18, 0x94, 0x94, 0x94, 0x18, 0x94, 0x94, 0x94, 0x18, 0x95, 0x95, 0x95, 0x18, 0x95, 0x95, 0x95, 0x18, 0x95, 0x95, 0x95, 0x18, 0x95, 0x95, 0x95, 0x1b, 0x96, 0x96, 0x96, 0x1b, 0x96, 0x96, 0x96, 0x1b, 0x96, 0x96, 0x96, 0x1b, 0x97, 0x97, 0x97, 0x1b, 0x97, 0x97, 0x97, 0x1c, 0x97, 0x97, 0x97, 0x1f, 0x98, 0x98, 0x98, 0x1f, 0x98, 0x98, 0x98, 0x20, 0x99, 0x99, 0x99, 0x23, 0x9a, 0x9a, 0x9a, 0x24, 0x9b, 0x9b, 0x9b, 0x27, 0x9b, 0x9b, 0x9b, 0x2b, 0x9c, 0x9c, 0x9c, 0x2c, 0x9d, 0x9d, 0x9d, 0x2f, 0x9f, 0x9f, 0x9f, 0x30, 0xa3, 0xa3, 0xa3, 0x34, 0xa7, 0xa7, 0xa7, 0x38, 0xad, 0xad, 0xad, 0x40, 0xbf, 0xbf, 0xbf, 0x4f, 0xce, 0xce, 0xce, 0x60, 0xd8, 0xd8, 0xd8, 0x73, 0xe1, 0xe1, 0xe1, 0x84, 0xe6, 0xe6, 0xe6, 0x94, 0xec, 0xec, 0xec, 0xa8, 0xf1, 0xf1, 0xf1, 0xbb, 0xf6, 0xf6, 0xf6, 0xcc, 0xf9, 0xf9, 0xf9, 0xdf, 0xfc, 0xfc, 0xfc, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xeb, 0xfe, 0xfe, 0xfe, 0xcb, 0xfd, 0xfd, 0xfd, 0xab, 0xfb, 0xfb, 0xfb, 0x88, 0xf7, 0xf7, 0xf7, 0x64, 0xef, 0xef, 0xef, 0x40, 0xde, 0xde, 0xde, 0x24, 0xd8, 0xd8, 0xd8, 0x23, 0xd5, 0xd5, 0xd5, 0x24, 0xd3, 0xd3, 0xd3, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd0, 0xd0, 0xd0, 0x27, 0xce, 0xce, 0xce, 0x27, 0xcc, 0xcc, 0xcc, 0x28, 0xca, 0xca, 0xca, 0x2b, 0xc8, 0xc8, 0xc8, 0x2c, 0xc6, 0xc6, 0xc6, 0x2f, 0xc5, 0xc5, 0xc5, 0x2f, 0xc3, 0xc3, 0xc3, 0x30, 0xc1, 0xc1, 0xc1, 0x34, 0xbf, 0xbf, 0xbf, 0x38, 0xbd, 0xbd, 0xbd, 0x40, 0xba, 0xba, 0xba, 0x4b, 0xb8, 0xb8, 0xb8, 0x58, 0xb4, 0xb4, 0xb4, 0x78, 0xb0, 0xb0, 0xb0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xb4, 0xb4, 0x68, 0xbc, 0xbc, 0xbc, 0x5c, 0xc0, 0xc0, 0xc0, 0x44, 0xc2, 0xc2, 0xc2, 0x38, 0xc5, 0xc5, 0xc5, 0x33, 0xc6, 0xc6, 0xc6, 0x30, 0xc8, 0xc8, 0xc8, 0x2f, 0xca, 0xca, 0xca, 0x2b, 0xca, 0xca, 0xca, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcc, 0xcc, 0xcc, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xce, 0xce, 0xce, 0x28, 0xcf, 0xcf, 0xcf, 0x27, 0xd5, 0xd5, 0xd5, 0x2b, 0xf8, 0xf8, 0xf8, 0x8b, 0xf9, 0xf9, 0xf9, 0x8b, 0xf9, 0xf9, 0xf9, 0x87, 0xf9, 0xf9, 0xf9, 0x83, 0xf9, 0xf9, 0xf9, 0x7f, 0xf9, 0xf9, 0xf9, 0x78, 0xf9, 0xf9, 0xf9, 0x74, 0xf9, 0xf9, 0xf9, 0x70, 0xf8, 0xf8, 0xf8, 0x6f, 0xf5, 0xf5, 0xf5, 0x7c, 0xf1, 0xf1, 0xf1, 0x8b, 0xee, 0xee, 0xee, 0x9b, 0xec, 0xec, 0xec, 0xab, 0xea, 0xea, 0xea, 0xbc, 0xe9, 0xe9, 0xe9, 0xcc, 0xe8, 0xe8, 0xe8, 0xdc, 0xe9, 0xe9, 0xe9, 0xef, 0xe9, 0xe9, 0xe9, 0xfb, 0xe9, 0xe9, 0xe9, 0xfc, 0xea, 0xea, 0xea, 0xff, 0xea, 0xea, 0xea, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xec, 0xec, 0xec, 0xf8, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xdc, 0xeb, 0xeb, 0xeb, 0xd0, 0xeb, 0xeb, 0xeb, 0xc4, 0xeb, 0xeb, 0xeb, 0xbb, 0xea, 0xea, 0xea, 0xaf, 0xea, 0xea, 0xea, 0xa7, 0xea, 0xea, 0xea, 0x9c, 0xe9, 0xe9, 0xe9, 0x93, 0xe9, 0xe9, 0xe9, 0x8f, 0xe8, 0xe8, 0xe8, 0x84, 0xe8, 0xe8, 0xe8, 0x80, 0xe7, 0xe7, 0xe7, 0x7b, 0xe8, 0xe8, 0xe8, 0x7b, 0xe6, 0xe6, 0xe6, 0x70, 0xe6, 0xe6, 0xe6, 0x6f, 0xe6, 0xe6, 0xe6, 0x6f, 0xe8, 0xe8, 0xe8, 0x6f, 0xe8, 0xe8, 0xe8, 0x6f, 0xe8, 0xe8, 0xe8, 0x6f, 0xe8, 0xe8, 0xe8, 0x6f, 0xe8, 0xe8, 0xe8, 0x6f, 0xe9, 0xe9, 0xe9, 0x6f, 0xe9, 0xe9, 0xe9, 0x70, 0xec, 0xec, 0xec, 0x78, 0xec, 0xec, 0xec, 0x7c, 0xed, 0xed, 0xed, 0x80, 0xee, 0xee, 0xee, 0x88, 0xf0, 0xf0, 0xf0, 0x8f, 0xf1, 0xf1, 0xf1, 0x94, 0xf3, 0xf3, 0xf3, 0x9f, 0xf4, 0xf4, 0xf4, 0xa7, 0xf5, 0xf5, 0xf5, 0xb0, 0xf6, 0xf6, 0xf6, 0xbc, 0xf7, 0xf7, 0xf7, 0xc7, 0xfa, 0xfa, 0xfa, 0xd3, 0xfb, 0xfb, 0xfb, 0xdf, 0xfc, 0xfc, 0xfc, 0xe8, 0xfe, 0xfe, 0xfe, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf3, 0xfe, 0xfe, 0xfe, 0xdc, 0xfe, 0xfe, 0xfe, 0xc4, 0xfd, 0xfd, 0xfd, 0xaf, 0xfc, 0xfc, 0xfc, 0x97, 0xfa, 0xfa, 0xfa, 0x7c, 0xf7, 0xf7, 0xf7, 0x63, 0xf3, 0xf3, 0xf3, 0x47, 0xe9, 0xe9, 0xe9, 0x2f, 0xdc, 0xdc, 0xdc, 0x20, 0xda, 0xda, 0xda, 0x23, 0xd8, 0xd8, 0xd8, 0x23, 0xd6, 0xd6, 0xd6, 0x23, 0xd4, 0xd4, 0xd4, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd0, 0xd0, 0xd0, 0x27, 0xcf, 0xcf, 0xcf, 0x27, 0xce, 0xce, 0xce, 0x27, 0xcd, 0xcd, 0xcd, 0x27, 0xcb, 0xcb, 0xcb, 0x28, 0xca, 0xca, 0xca, 0x2b, 0xc9, 0xc9, 0xc9, 0x2b, 0xc8, 0xc8, 0xc8, 0x2c, 0xc6, 0xc6, 0xc6, 0x2f, 0xc5, 0xc5, 0xc5, 0x2f, 0xc3, 0xc3, 0xc3, 0x30, 0xc0, 0xc0, 0xc0, 0x37, 0xbf, 0xbf, 0xbf, 0x3b, 0xbc, 0xbc, 0xbc, 0x40, 0xba, 0xba, 0xba, 0x4c, 0xb7, 0xb7, 0xb7, 0x5f, 0xb3, 0xb3, 0xb3, 0x77, 0xb0, 0xb0, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0x58, 0xbb, 0xbb, 0xbb, 0x60, 0xc0, 0xc0, 0xc0, 0x47, 0xc2, 0xc2, 0xc2, 0x3b, 0xc4, 0xc4, 0xc4, 0x34, 0xc6, 0xc6, 0xc6, 0x30, 0xc8, 0xc8, 0xc8, 0x2f, 0xc9, 0xc9, 0xc9, 0x2c, 0xca, 0xca, 0xca, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcc, 0xcc, 0xcc, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xce, 0xce, 0xce, 0x28, 0xce, 0xce, 0xce, 0x27, 0xd1, 0xd1, 0xd1, 0x28, 0xf6, 0xf6, 0xf6, 0x84, 0xf8, 0xf8, 0xf8, 0x8c, 0xf8, 0xf8, 0xf8, 0x88, 0xf8, 0xf8, 0xf8, 0x84, 0xf7, 0xf7, 0xf7, 0x80, 0xf7, 0xf7, 0xf7, 0x7c, 0xf7, 0xf7, 0xf7, 0x78, 0xf6, 0xf6, 0xf6, 0x73, 0xf6, 0xf6, 0xf6, 0x6f, 0xf6, 0xf6, 0xf6, 0x6b, 0xf6, 0xf6, 0xf6, 0x67, 0xf6, 0xf6, 0xf6, 0x63, 0xf6, 0xf6, 0xf6, 0x5f, 0xf6, 0xf6, 0xf6, 0x5b, 0xf6, 0xf6, 0xf6, 0x57, 0xf6, 0xf6, 0xf6, 0x50, 0xf6, 0xf6, 0xf6, 0x4c, 0xf5, 0xf5, 0xf5, 0x4c, 0xf2, 0xf2, 0xf2, 0x57, 0xec, 0xec, 0xec, 0x53, 0xe8, 0xe8, 0xe8, 0x53, 0xe9, 0xe9, 0xe9, 0x64, 0xea, 0xea, 0xea, 0x74, 0xeb, 0xeb, 0xeb, 0x84, 0xeb, 0xeb, 0xeb, 0x93, 0xec, 0xec, 0xec, 0xa0, 0xed, 0xed, 0xed, 0xaf, 0xee, 0xee, 0xee, 0xbb, 0xee, 0xee, 0xee, 0xc7, 0xef, 0xef, 0xef, 0xd0, 0xf0, 0xf0, 0xf0, 0xd8, 0xf0, 0xf0, 0xf0, 0xe3, 0xf1, 0xf1, 0xf1, 0xec, 0xf1, 0xf1, 0xf1, 0xf3, 0xf2, 0xf2, 0xf2, 0xfb, 0xf2, 0xf2, 0xf2, 0xfb, 0xf3, 0xf3, 0xf3, 0xfb, 0xf4, 0xf4, 0xf4, 0xfb, 0xf4, 0xf4, 0xf4, 0xfb, 0xf5, 0xf5, 0xf5, 0xfb, 0xf5, 0xf5, 0xf5, 0xfb, 0xf6, 0xf6, 0xf6, 0xfb, 0xf6, 0xf6, 0xf6, 0xfb, 0xf6, 0xf6, 0xf6, 0xfb, 0xf6, 0xf6, 0xf6, 0xfb, 0xf7, 0xf7, 0xf7, 0xfb, 0xf7, 0xf7, 0xf7, 0xfb, 0xf8, 0xf8, 0xf8, 0xfb, 0xf9, 0xf9, 0xf9, 0xfb, 0xf9, 0xf9, 0xf9, 0xfb, 0xfa, 0xfa, 0xfa, 0xfb, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xf7, 0xfb, 0xfb, 0xfb, 0xef, 0xfc, 0xfc, 0xfc, 0xe4, 0xfc, 0xfc, 0xfc, 0xdf, 0xfc, 0xfc, 0xfc, 0xd4, 0xfd, 0xfd, 0xfd, 0xcb, 0xfd, 0xfd, 0xfd, 0xbf, 0xfd, 0xfd, 0xfd, 0xb3, 0xfd, 0xfd, 0xfd, 0xa7, 0xfd, 0xfd, 0xfd, 0x9b, 0xfc, 0xfc, 0xfc, 0x8c, 0xfb, 0xfb, 0xfb, 0x7c, 0xf9, 0xf9, 0xf9, 0x6f, 0xf7, 0xf7, 0xf7, 0x5c, 0xf5, 0xf5, 0xf5, 0x4c, 0xf0, 0xf0, 0xf0, 0x3b, 0xe7, 0xe7, 0xe7, 0x2b, 0xdd, 0xdd, 0xdd, 0x20, 0xdc, 0xdc, 0xdc, 0x20, 0xdb, 0xdb, 0xdb, 0x20, 0xd9, 0xd9, 0xd9, 0x23, 0xd8, 0xd8, 0xd8, 0x23, 0xd7, 0xd7, 0xd7, 0x23, 0xd6, 0xd6, 0xd6, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xcf, 0xcf, 0xcf, 0x27, 0xcf, 0xcf, 0xcf, 0x27, 0xce, 0xce, 0xce, 0x27, 0xce, 0xce, 0xce, 0x27, 0xcd, 0xcd, 0xcd, 0x27, 0xcc, 0xcc, 0xcc, 0x27, 0xcb, 0xcb, 0xcb, 0x28, 0xca, 0xca, 0xca, 0x2b, 0xc9, 0xc9, 0xc9, 0x2b, 0xc7, 0xc7, 0xc7, 0x2c, 0xc6, 0xc6, 0xc6, 0x2f, 0xc4, 0xc4, 0xc4, 0x2f, 0xc2, 0xc2, 0xc2, 0x33, 0xc0, 0xc0, 0xc0, 0x37, 0xbe, 0xbe, 0xbe, 0x3b, 0xbc, 0xbc, 0xbc, 0x43, 0xb9, 0xb9, 0xb9, 0x4f, 0xb7, 0xb7, 0xb7, 0x60, 0xb3, 0xb3, 0xb3, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0x43, 0xba, 0xba, 0xba, 0x68, 0xbf, 0xbf, 0xbf, 0x4b, 0xc2, 0xc2, 0xc2, 0x3f, 0xc4, 0xc4, 0xc4, 0x34, 0xc6, 0xc6, 0xc6, 0x30, 0xc7, 0xc7, 0xc7, 0x2f, 0xc9, 0xc9, 0xc9, 0x2c, 0xca, 0xca, 0xca, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcc, 0xcc, 0xcc, 0x2b, 0xcc, 0xcc, 0xcc, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xce, 0xce, 0xce, 0x28, 0xce, 0xce, 0xce, 0x28, 0xcf, 0xcf, 0xcf, 0x27, 0xf6, 0xf6, 0xf6, 0x7b, 0xf8, 0xf8, 0xf8, 0x8c, 0xf7, 0xf7, 0xf7, 0x88, 0xf7, 0xf7, 0xf7, 0x84, 0xf7, 0xf7, 0xf7, 0x80, 0xf6, 0xf6, 0xf6, 0x7c, 0xf6, 0xf6, 0xf6, 0x7b, 0xf6, 0xf6, 0xf6, 0x74, 0xf6, 0xf6, 0xf6, 0x70, 0xf5, 0xf5, 0xf5, 0x6f, 0xf5, 0xf5, 0xf5, 0x68, 0xf4, 0xf4, 0xf4, 0x64, 0xf4, 0xf4, 0xf4, 0x60, 0xf3, 0xf3, 0xf3, 0x5c, 0xf3, 0xf3, 0xf3, 0x58, 0xf2, 0xf2, 0xf2, 0x54, 0xf1, 0xf1, 0xf1, 0x50, 0xf0, 0xf0, 0xf0, 0x4c, 0xf0, 0xf0, 0xf0, 0x48, 0xea, 0xea, 0xea, 0x37, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x1f, 0xd9, 0xd9, 0xd9, 0x1f, 0xd9, 0xd9, 0xd9, 0x1f, 0xda, 0xda, 0xda, 0x1f, 0xda, 0xda, 0xda, 0x1f, 0xda, 0xda, 0xda, 0x1f, 0xdb, 0xdb, 0xdb, 0x1f, 0xdc, 0xdc, 0xdc, 0x1f, 0xdc, 0xdc, 0xdc, 0x1c, 0xdd, 0xdd, 0xdd, 0x1c, 0xdf, 0xdf, 0xdf, 0x1c, 0xdf, 0xdf, 0xdf, 0x1c, 0xdf, 0xdf, 0xdf, 0x1c, 0xe0, 0xe0, 0xe0, 0x1c, 0xe1, 0xe1, 0xe1, 0x1f, 0xe2, 0xe2, 0xe2, 0x23, 0xe2, 0xe2, 0xe2, 0x23, 0xe4, 0xe4, 0xe4, 0x27, 0xe5, 0xe5, 0xe5, 0x27, 0xe6, 0xe6, 0xe6, 0x27, 0xe6, 0xe6, 0xe6, 0x27, 0xe6, 0xe6, 0xe6, 0x27, 0xe8, 0xe8, 0xe8, 0x24, 0xe7, 0xe7, 0xe7, 0x27, 0xe7, 0xe7, 0xe7, 0x27, 0xe6, 0xe6, 0xe6, 0x27, 0xe6, 0xe6, 0xe6, 0x27, 0xe4, 0xe4, 0xe4, 0x24, 0xe4, 0xe4, 0xe4, 0x23, 0xe3, 0xe3, 0xe3, 0x20, 0xe0, 0xe0, 0xe0, 0x1c, 0xde, 0xde, 0xde, 0x1f, 0xdd, 0xdd, 0xdd, 0x1f, 0xdd, 0xdd, 0xdd, 0x1f, 0xdc, 0xdc, 0xdc, 0x1f, 0xdb, 0xdb, 0xdb, 0x20, 0xdb, 0xdb, 0xdb, 0x20, 0xdb, 0xdb, 0xdb, 0x20, 0xda, 0xda, 0xda, 0x20, 0xda, 0xda, 0xda, 0x20, 0xd9, 0xd9, 0xd9, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x23, 0xd7, 0xd7, 0xd7, 0x23, 0xd6, 0xd6, 0xd6, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xcf, 0xcf, 0xcf, 0x27, 0xcf, 0xcf, 0xcf, 0x27, 0xce, 0xce, 0xce, 0x27, 0xce, 0xce, 0xce, 0x27, 0xcd, 0xcd, 0xcd, 0x27, 0xcc, 0xcc, 0xcc, 0x27, 0xcb, 0xcb, 0xcb, 0x28, 0xca, 0xca, 0xca, 0x2b, 0xc8, 0xc8, 0xc8, 0x2b, 0xc7, 0xc7, 0xc7, 0x2c, 0xc5, 0xc5, 0xc5, 0x2f, 0xc4, 0xc4, 0xc4, 0x30, 0xc2, 0xc2, 0xc2, 0x33, 0xbf, 0xbf, 0xbf, 0x37, 0xbe, 0xbe, 0xbe, 0x3c, 0xbb, 0xbb, 0xbb, 0x44, 0xb9, 0xb9, 0xb9, 0x50, 0xb6, 0xb6, 0xb6, 0x64, 0xb3, 0xb3, 0xb3, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xb2, 0xb2, 0x2f, 0xb8, 0xb8, 0xb8, 0x73, 0xbf, 0xbf, 0xbf, 0x4c, 0xc2, 0xc2, 0xc2, 0x3f, 0xc3, 0xc3, 0xc3, 0x34, 0xc5, 0xc5, 0xc5, 0x33, 0xc7, 0xc7, 0xc7, 0x2f, 0xc9, 0xc9, 0xc9, 0x2c, 0xca, 0xca, 0xca, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcc, 0xcc, 0xcc, 0x2b, 0xcc, 0xcc, 0xcc, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xce, 0xce, 0xce, 0x28, 0xcf, 0xcf, 0xcf, 0x27, 0xf4, 0xf4, 0xf4, 0x70, 0xf8, 0xf8, 0xf8, 0x8c, 0xf7, 0xf7, 0xf7, 0x88, 0xf7, 0xf7, 0xf7, 0x84, 0xf7, 0xf7, 0xf7, 0x80, 0xf6, 0xf6, 0xf6, 0x7c, 0xf6, 0xf6, 0xf6, 0x7b, 0xf6, 0xf6, 0xf6, 0x74, 0xf6, 0xf6, 0xf6, 0x73, 0xf5, 0xf5, 0xf5, 0x6f, 0xf4, 0xf4, 0xf4, 0x6b, 0xf4, 0xf4, 0xf4, 0x67, 0xf3, 0xf3, 0xf3, 0x63, 0xf2, 0xf2, 0xf2, 0x5f, 0xf1, 0xf1, 0xf1, 0x5c, 0xf0, 0xf0, 0xf0, 0x57, 0xef, 0xef, 0xef, 0x53, 0xee, 0xee, 0xee, 0x50, 0xed, 0xed, 0xed, 0x4b, 0xe7, 0xe7, 0xe7, 0x3c, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd5, 0xd5, 0xd5, 0x20, 0xd5, 0xd5, 0xd5, 0x20, 0xd5, 0xd5, 0xd5, 0x20, 0xd5, 0xd5, 0xd5, 0x20, 0xd5, 0xd5, 0xd5, 0x20, 0xd5, 0xd5, 0xd5, 0x20, 0xd5, 0xd5, 0xd5, 0x20, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x20, 0xd5, 0xd5, 0xd5, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd5, 0xd5, 0xd5, 0x20, 0xd5, 0xd5, 0xd5, 0x20, 0xd5, 0xd5, 0xd5, 0x20, 0xd5, 0xd5, 0xd5, 0x20, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xcf, 0xcf, 0xcf, 0x27, 0xcf, 0xcf, 0xcf, 0x27, 0xce, 0xce, 0xce, 0x27, 0xce, 0xce, 0xce, 0x27, 0xcd, 0xcd, 0xcd, 0x27, 0xcc, 0xcc, 0xcc, 0x28, 0xcb, 0xcb, 0xcb, 0x28, 0xc9, 0xc9, 0xc9, 0x2b, 0xc8, 0xc8, 0xc8, 0x2c, 0xc6, 0xc6, 0xc6, 0x2c, 0xc5, 0xc5, 0xc5, 0x2f, 0xc3, 0xc3, 0xc3, 0x30, 0xc1, 0xc1, 0xc1, 0x33, 0xbf, 0xbf, 0xbf, 0x38, 0xbd, 0xbd, 0xbd, 0x3f, 0xbb, 0xbb, 0xbb, 0x47, 0xb9, 0xb9, 0xb9, 0x53, 0xb6, 0xb6, 0xb6, 0x68, 0xb2, 0xb2, 0xb2, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xb1, 0xb1, 0x17, 0xb7, 0xb7, 0xb7, 0x7b, 0xbf, 0xbf, 0xbf, 0x50, 0xc1, 0xc1, 0xc1, 0x40, 0xc3, 0xc3, 0xc3, 0x37, 0xc5, 0xc5, 0xc5, 0x33, 0xc7, 0xc7, 0xc7, 0x2f, 0xc9, 0xc9, 0xc9, 0x2c, 0xca, 0xca, 0xca, 0x2b, 0xca, 0xca, 0xca, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcc, 0xcc, 0xcc, 0x2b, 0xcc, 0xcc, 0xcc, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xce, 0xce, 0xce, 0x28, 0xce, 0xce, 0xce, 0x27, 0xf2, 0xf2, 0xf2, 0x64, 0xf8, 0xf8, 0xf8, 0x8c, 0xf7, 0xf7, 0xf7, 0x88, 0xf7, 0xf7, 0xf7, 0x84, 0xf7, 0xf7, 0xf7, 0x80, 0xf6, 0xf6, 0xf6, 0x7c, 0xf6, 0xf6, 0xf6, 0x7b, 0xf6, 0xf6, 0xf6, 0x74, 0xf6, 0xf6, 0xf6, 0x73, 0xf5, 0xf5, 0xf5, 0x6f, 0xf4, 0xf4, 0xf4, 0x6b, 0xf4, 0xf4, 0xf4, 0x67, 0xf3, 0xf3, 0xf3, 0x63, 0xf2, 0xf2, 0xf2, 0x5f, 0xf1, 0xf1, 0xf1, 0x5c, 0xf0, 0xf0, 0xf0, 0x58, 0xef, 0xef, 0xef, 0x54, 0xee, 0xee, 0xee, 0x50, 0xed, 0xed, 0xed, 0x4c, 0xe7, 0xe7, 0xe7, 0x40, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xcf, 0xcf, 0xcf, 0x27, 0xcf, 0xcf, 0xcf, 0x27, 0xcf, 0xcf, 0xcf, 0x27, 0xce, 0xce, 0xce, 0x27, 0xcd, 0xcd, 0xcd, 0x27, 0xcd, 0xcd, 0xcd, 0x27, 0xcc, 0xcc, 0xcc, 0x28, 0xca, 0xca, 0xca, 0x28, 0xc9, 0xc9, 0xc9, 0x2b, 0xc8, 0xc8, 0xc8, 0x2c, 0xc6, 0xc6, 0xc6, 0x2c, 0xc5, 0xc5, 0xc5, 0x2f, 0xc3, 0xc3, 0xc3, 0x30, 0xc1, 0xc1, 0xc1, 0x34, 0xbf, 0xbf, 0xbf, 0x38, 0xbd, 0xbd, 0xbd, 0x3f, 0xba, 0xba, 0xba, 0x48, 0xb8, 0xb8, 0xb8, 0x57, 0xb5, 0xb5, 0xb5, 0x6f, 0xb2, 0xb2, 0xb2, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xb0, 0xb0, 0x07, 0xb5, 0xb5, 0xb5, 0x7b, 0xbe, 0xbe, 0xbe, 0x57, 0xc1, 0xc1, 0xc1, 0x43, 0xc3, 0xc3, 0xc3, 0x37, 0xc5, 0xc5, 0xc5, 0x33, 0xc7, 0xc7, 0xc7, 0x2f, 0xc9, 0xc9, 0xc9, 0x2c, 0xca, 0xca, 0xca, 0x2b, 0xca, 0xca, 0xca, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcc, 0xcc, 0xcc, 0x2b, 0xcc, 0xcc, 0xcc, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xce, 0xce, 0xce, 0x28, 0xce, 0xce, 0xce, 0x27, 0xef, 0xef, 0xef, 0x5b, 0xf8, 0xf8, 0xf8, 0x8c, 0xf7, 0xf7, 0xf7, 0x88, 0xf7, 0xf7, 0xf7, 0x84, 0xf7, 0xf7, 0xf7, 0x80, 0xf6, 0xf6, 0xf6, 0x7c, 0xf6, 0xf6, 0xf6, 0x7b, 0xf6, 0xf6, 0xf6, 0x74, 0xf6, 0xf6, 0xf6, 0x73, 0xf5, 0xf5, 0xf5, 0x6f, 0xf4, 0xf4, 0xf4, 0x6b, 0xf4, 0xf4, 0xf4, 0x67, 0xf3, 0xf3, 0xf3, 0x63, 0xf2, 0xf2, 0xf2, 0x5f, 0xf1, 0xf1, 0xf1, 0x5c, 0xf0, 0xf0, 0xf0, 0x58, 0xef, 0xef, 0xef, 0x54, 0xee, 0xee, 0xee, 0x50, 0xed, 0xed, 0xed, 0x4c, 0xe7, 0xe7, 0xe7, 0x40, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xcf, 0xcf, 0xcf, 0x27, 0xcf, 0xcf, 0xcf, 0x27, 0xce, 0xce, 0xce, 0x27, 0xce, 0xce, 0xce, 0x27, 0xcd, 0xcd, 0xcd, 0x27, 0xcc, 0xcc, 0xcc, 0x27, 0xcb, 0xcb, 0xcb, 0x28, 0xca, 0xca, 0xca, 0x28, 0xc9, 0xc9, 0xc9, 0x2b, 0xc7, 0xc7, 0xc7, 0x2c, 0xc6, 0xc6, 0xc6, 0x2c, 0xc4, 0xc4, 0xc4, 0x2f, 0xc2, 0xc2, 0xc2, 0x30, 0xc0, 0xc0, 0xc0, 0x34, 0xbe, 0xbe, 0xbe, 0x3b, 0xbc, 0xbc, 0xbc, 0x40, 0xba, 0xba, 0xba, 0x4b, 0xb8, 0xb8, 0xb8, 0x58, 0xb4, 0xb4, 0xb4, 0x74, 0xb0, 0xb0, 0xb0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xb0, 0xb0, 0x00, 0xb4, 0xb4, 0xb4, 0x6f, 0xbd, 0xbd, 0xbd, 0x5c, 0xc0, 0xc0, 0xc0, 0x44, 0xc3, 0xc3, 0xc3, 0x38, 0xc4, 0xc4, 0xc4, 0x33, 0xc6, 0xc6, 0xc6, 0x30, 0xc8, 0xc8, 0xc8, 0x2c, 0xca, 0xca, 0xca, 0x2b, 0xca, 0xca, 0xca, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcc, 0xcc, 0xcc, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xce, 0xce, 0xce, 0x28, 0xce, 0xce, 0xce, 0x27, 0xec, 0xec, 0xec, 0x50, 0xf8, 0xf8, 0xf8, 0x8c, 0xf7, 0xf7, 0xf7, 0x88, 0xf7, 0xf7, 0xf7, 0x84, 0xf7, 0xf7, 0xf7, 0x80, 0xf6, 0xf6, 0xf6, 0x7c, 0xf6, 0xf6, 0xf6, 0x7b, 0xf6, 0xf6, 0xf6, 0x74, 0xf6, 0xf6, 0xf6, 0x73, 0xf5, 0xf5, 0xf5, 0x6f, 0xf4, 0xf4, 0xf4, 0x6b, 0xf4, 0xf4, 0xf4, 0x67, 0xf3, 0xf3, 0xf3, 0x63, 0xf2, 0xf2, 0xf2, 0x5f, 0xf1, 0xf1, 0xf1, 0x5c, 0xf0, 0xf0, 0xf0, 0x58, 0xef, 0xef, 0xef, 0x54, 0xee, 0xee, 0xee, 0x50, 0xed, 0xed, 0xed, 0x4c, 0xe7, 0xe7, 0xe7, 0x40, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xcf, 0xcf, 0xcf, 0x27, 0xcf, 0xcf, 0xcf, 0x27, 0xce, 0xce, 0xce, 0x27, 0xce, 0xce, 0xce, 0x27, 0xcd, 0xcd, 0xcd, 0x27, 0xcc, 0xcc, 0xcc, 0x27, 0xcb, 0xcb, 0xcb, 0x28, 0xca, 0xca, 0xca, 0x28, 0xc8, 0xc8, 0xc8, 0x2b, 0xc7, 0xc7, 0xc7, 0x2c, 0xc5, 0xc5, 0xc5, 0x2f, 0xc4, 0xc4, 0xc4, 0x2f, 0xc2, 0xc2, 0xc2, 0x30, 0xbf, 0xbf, 0xbf, 0x37, 0xbe, 0xbe, 0xbe, 0x3b, 0xbc, 0xbc, 0xbc, 0x43, 0xba, 0xba, 0xba, 0x4c, 0xb7, 0xb7, 0xb7, 0x5b, 0xb4, 0xb4, 0xb4, 0x77, 0xb0, 0xb0, 0xb0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xb4, 0xb4, 0x5b, 0xbc, 0xbc, 0xbc, 0x60, 0xc0, 0xc0, 0xc0, 0x47, 0xc2, 0xc2, 0xc2, 0x3b, 0xc4, 0xc4, 0xc4, 0x33, 0xc6, 0xc6, 0xc6, 0x30, 0xc8, 0xc8, 0xc8, 0x2f, 0xca, 0xca, 0xca, 0x2b, 0xca, 0xca, 0xca, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcc, 0xcc, 0xcc, 0x28, 0xcc, 0xcc, 0xcc, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xce, 0xce, 0xce, 0x28, 0xce, 0xce, 0xce, 0x28, 0xe7, 0xe7, 0xe7, 0x47, 0xf8, 0xf8, 0xf8, 0x8c, 0xf7, 0xf7, 0xf7, 0x88, 0xf7, 0xf7, 0xf7, 0x84, 0xf7, 0xf7, 0xf7, 0x80, 0xf6, 0xf6, 0xf6, 0x7c, 0xf6, 0xf6, 0xf6, 0x7b, 0xf6, 0xf6, 0xf6, 0x74, 0xf6, 0xf6, 0xf6, 0x73, 0xf5, 0xf5, 0xf5, 0x6f, 0xf4, 0xf4, 0xf4, 0x6b, 0xf4, 0xf4, 0xf4, 0x67, 0xf3, 0xf3, 0xf3, 0x63, 0xf2, 0xf2, 0xf2, 0x5f, 0xf1, 0xf1, 0xf1, 0x5c, 0xf0, 0xf0, 0xf0, 0x58, 0xef, 0xef, 0xef, 0x54, 0xee, 0xee, 0xee, 0x50, 0xed, 0xed, 0xed, 0x4c, 0xe9, 0xe9, 0xe9, 0x44, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xcf, 0xcf, 0xcf, 0x27, 0xcf, 0xcf, 0xcf, 0x27, 0xce, 0xce, 0xce, 0x27, 0xcd, 0xcd, 0xcd, 0x27, 0xcd, 0xcd, 0xcd, 0x27, 0xcc, 0xcc, 0xcc, 0x27, 0xcb, 0xcb, 0xcb, 0x28, 0xc9, 0xc9, 0xc9, 0x2b, 0xc8, 0xc8, 0xc8, 0x2b, 0xc6, 0xc6, 0xc6, 0x2c, 0xc5, 0xc5, 0xc5, 0x2f, 0xc3, 0xc3, 0xc3, 0x30, 0xc1, 0xc1, 0xc1, 0x33, 0xbf, 0xbf, 0xbf, 0x37, 0xbe, 0xbe, 0xbe, 0x3c, 0xbb, 0xbb, 0xbb, 0x43, 0xb9, 0xb9, 0xb9, 0x4c, 0xb8, 0xb8, 0xb8, 0x5c, 0xb4, 0xb4, 0xb4, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0x4b, 0xba, 0xba, 0xba, 0x68, 0xbf, 0xbf, 0xbf, 0x4b, 0xc1, 0xc1, 0xc1, 0x3c, 0xc3, 0xc3, 0xc3, 0x34, 0xc6, 0xc6, 0xc6, 0x30, 0xc8, 0xc8, 0xc8, 0x2f, 0xca, 0xca, 0xca, 0x2b, 0xca, 0xca, 0xca, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcc, 0xcc, 0xcc, 0x2b, 0xcc, 0xcc, 0xcc, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xce, 0xce, 0xce, 0x28, 0xe2, 0xe2, 0xe2, 0x3b, 0xf8, 0xf8, 0xf8, 0x8c, 0xf7, 0xf7, 0xf7, 0x88, 0xf7, 0xf7, 0xf7, 0x84, 0xf7, 0xf7, 0xf7, 0x80, 0xf6, 0xf6, 0xf6, 0x7c, 0xf6, 0xf6, 0xf6, 0x7b, 0xf6, 0xf6, 0xf6, 0x74, 0xf6, 0xf6, 0xf6, 0x73, 0xf5, 0xf5, 0xf5, 0x6f, 0xf4, 0xf4, 0xf4, 0x6b, 0xf4, 0xf4, 0xf4, 0x67, 0xf3, 0xf3, 0xf3, 0x63, 0xf2, 0xf2, 0xf2, 0x5f, 0xf1, 0xf1, 0xf1, 0x5c, 0xf0, 0xf0, 0xf0, 0x58, 0xef, 0xef, 0xef, 0x54, 0xee, 0xee, 0xee, 0x50, 0xed, 0xed, 0xed, 0x4c, 0xea, 0xea, 0xea, 0x47, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xcf, 0xcf, 0xcf, 0x27, 0xce, 0xce, 0xce, 0x27, 0xce, 0xce, 0xce, 0x27, 0xcd, 0xcd, 0xcd, 0x27, 0xcd, 0xcd, 0xcd, 0x27, 0xcc, 0xcc, 0xcc, 0x27, 0xca, 0xca, 0xca, 0x28, 0xc9, 0xc9, 0xc9, 0x2b, 0xc8, 0xc8, 0xc8, 0x2b, 0xc6, 0xc6, 0xc6, 0x2c, 0xc4, 0xc4, 0xc4, 0x2f, 0xc3, 0xc3, 0xc3, 0x30, 0xc1, 0xc1, 0xc1, 0x33, 0xbf, 0xbf, 0xbf, 0x38, 0xbd, 0xbd, 0xbd, 0x3f, 0xbc, 0xbc, 0xbc, 0x43, 0xba, 0xba, 0xba, 0x4f, 0xb9, 0xb9, 0xb9, 0x5f, 0xb4, 0xb4, 0xb4, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xb2, 0xb2, 0x34, 0xb8, 0xb8, 0xb8, 0x70, 0xbf, 0xbf, 0xbf, 0x4f, 0xc1, 0xc1, 0xc1, 0x3f, 0xc3, 0xc3, 0xc3, 0x34, 0xc5, 0xc5, 0xc5, 0x33, 0xc7, 0xc7, 0xc7, 0x2f, 0xc9, 0xc9, 0xc9, 0x2c, 0xca, 0xca, 0xca, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcc, 0xcc, 0xcc, 0x2b, 0xcc, 0xcc, 0xcc, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xce, 0xce, 0xce, 0x28, 0xda, 0xda, 0xda, 0x30, 0xf8, 0xf8, 0xf8, 0x8c, 0xf7, 0xf7, 0xf7, 0x88, 0xf7, 0xf7, 0xf7, 0x84, 0xf7, 0xf7, 0xf7, 0x80, 0xf6, 0xf6, 0xf6, 0x7c, 0xf6, 0xf6, 0xf6, 0x7b, 0xf6, 0xf6, 0xf6, 0x74, 0xf6, 0xf6, 0xf6, 0x73, 0xf5, 0xf5, 0xf5, 0x6f, 0xf4, 0xf4, 0xf4, 0x6b, 0xf4, 0xf4, 0xf4, 0x67, 0xf3, 0xf3, 0xf3, 0x63, 0xf2, 0xf2, 0xf2, 0x5f, 0xf1, 0xf1, 0xf1, 0x5c, 0xf0, 0xf0, 0xf0, 0x58, 0xef, 0xef, 0xef, 0x54, 0xee, 0xee, 0xee, 0x50, 0xed, 0xed, 0xed, 0x4c, 0xeb, 0xeb, 0xeb, 0x48, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xcf, 0xcf, 0xcf, 0x24, 0xcf, 0xcf, 0xcf, 0x27, 0xce, 0xce, 0xce, 0x27, 0xcd, 0xcd, 0xcd, 0x27, 0xcd, 0xcd, 0xcd, 0x27, 0xcc, 0xcc, 0xcc, 0x27, 0xcb, 0xcb, 0xcb, 0x27, 0xca, 0xca, 0xca, 0x28, 0xc8, 0xc8, 0xc8, 0x2b, 0xc7, 0xc7, 0xc7, 0x2c, 0xc6, 0xc6, 0xc6, 0x2c, 0xc4, 0xc4, 0xc4, 0x2f, 0xc2, 0xc2, 0xc2, 0x30, 0xc0, 0xc0, 0xc0, 0x33, 0xbf, 0xbf, 0xbf, 0x38, 0xbe, 0xbe, 0xbe, 0x3f, 0xbc, 0xbc, 0xbc, 0x44, 0xbb, 0xbb, 0xbb, 0x4f, 0xba, 0xba, 0xba, 0x63, 0xb4, 0xb4, 0xb4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xb1, 0xb1, 0x1c, 0xb7, 0xb7, 0xb7, 0x78, 0xbe, 0xbe, 0xbe, 0x53, 0xc0, 0xc0, 0xc0, 0x43, 0xc2, 0xc2, 0xc2, 0x37, 0xc4, 0xc4, 0xc4, 0x33, 0xc7, 0xc7, 0xc7, 0x2f, 0xc9, 0xc9, 0xc9, 0x2c, 0xca, 0xca, 0xca, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcc, 0xcc, 0xcc, 0x2b, 0xcc, 0xcc, 0xcc, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xce, 0xce, 0xce, 0x28, 0xd3, 0xd3, 0xd3, 0x2c, 0xf7, 0xf7, 0xf7, 0x88, 0xf7, 0xf7, 0xf7, 0x88, 0xf7, 0xf7, 0xf7, 0x84, 0xf7, 0xf7, 0xf7, 0x80, 0xf6, 0xf6, 0xf6, 0x7c, 0xf6, 0xf6, 0xf6, 0x7b, 0xf6, 0xf6, 0xf6, 0x74, 0xf6, 0xf6, 0xf6, 0x73, 0xf5, 0xf5, 0xf5, 0x6f, 0xf4, 0xf4, 0xf4, 0x6b, 0xf4, 0xf4, 0xf4, 0x67, 0xf3, 0xf3, 0xf3, 0x63, 0xf2, 0xf2, 0xf2, 0x5f, 0xf1, 0xf1, 0xf1, 0x5c, 0xf0, 0xf0, 0xf0, 0x58, 0xef, 0xef, 0xef, 0x54, 0xee, 0xee, 0xee, 0x50, 0xed, 0xed, 0xed, 0x4c, 0xea, 0xea, 0xea, 0x47, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xcf, 0xcf, 0xcf, 0x24, 0xcf, 0xcf, 0xcf, 0x27, 0xce, 0xce, 0xce, 0x27, 0xcd, 0xcd, 0xcd, 0x27, 0xcd, 0xcd, 0xcd, 0x27, 0xcc, 0xcc, 0xcc, 0x27, 0xcb, 0xcb, 0xcb, 0x27, 0xca, 0xca, 0xca, 0x28, 0xc8, 0xc8, 0xc8, 0x2b, 0xc7, 0xc7, 0xc7, 0x2c, 0xc5, 0xc5, 0xc5, 0x2c, 0xc4, 0xc4, 0xc4, 0x2f, 0xc2, 0xc2, 0xc2, 0x30, 0xc1, 0xc1, 0xc1, 0x33, 0xbf, 0xbf, 0xbf, 0x38, 0xbf, 0xbf, 0xbf, 0x3c, 0xbd, 0xbd, 0xbd, 0x44, 0xbc, 0xbc, 0xbc, 0x50, 0xba, 0xba, 0xba, 0x67, 0xb3, 0xb3, 0xb3, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xb0, 0xb0, 0x08, 0xb5, 0xb5, 0xb5, 0x7c, 0xbd, 0xbd, 0xbd, 0x57, 0xbf, 0xbf, 0xbf, 0x44, 0xc2, 0xc2, 0xc2, 0x38, 0xc4, 0xc4, 0xc4, 0x34, 0xc6, 0xc6, 0xc6, 0x30, 0xc9, 0xc9, 0xc9, 0x2c, 0xca, 0xca, 0xca, 0x2b, 0xca, 0xca, 0xca, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcc, 0xcc, 0xcc, 0x28, 0xcc, 0xcc, 0xcc, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xce, 0xce, 0xce, 0x28, 0xd0, 0xd0, 0xd0, 0x28, 0xf6, 0xf6, 0xf6, 0x80, 0xf7, 0xf7, 0xf7, 0x88, 0xf7, 0xf7, 0xf7, 0x84, 0xf7, 0xf7, 0xf7, 0x80, 0xf6, 0xf6, 0xf6, 0x7c, 0xf6, 0xf6, 0xf6, 0x7b, 0xf6, 0xf6, 0xf6, 0x74, 0xf6, 0xf6, 0xf6, 0x73, 0xf5, 0xf5, 0xf5, 0x6f, 0xf4, 0xf4, 0xf4, 0x6b, 0xf4, 0xf4, 0xf4, 0x67, 0xf3, 0xf3, 0xf3, 0x63, 0xf2, 0xf2, 0xf2, 0x5f, 0xf1, 0xf1, 0xf1, 0x5c, 0xf0, 0xf0, 0xf0, 0x58, 0xef, 0xef, 0xef, 0x54, 0xee, 0xee, 0xee, 0x50, 0xed, 0xed, 0xed, 0x4c, 0xea, 0xea, 0xea, 0x48, 0xd3, 0xd3, 0xd3, 0x27, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xcf, 0xcf, 0xcf, 0x24, 0xcf, 0xcf, 0xcf, 0x24, 0xce, 0xce, 0xce, 0x27, 0xce, 0xce, 0xce, 0x27, 0xcd, 0xcd, 0xcd, 0x27, 0xcc, 0xcc, 0xcc, 0x27, 0xcc, 0xcc, 0xcc, 0x27, 0xcb, 0xcb, 0xcb, 0x28, 0xc9, 0xc9, 0xc9, 0x28, 0xc8, 0xc8, 0xc8, 0x2b, 0xc7, 0xc7, 0xc7, 0x2c, 0xc6, 0xc6, 0xc6, 0x2c, 0xc4, 0xc4, 0xc4, 0x2f, 0xc3, 0xc3, 0xc3, 0x2f, 0xc2, 0xc2, 0xc2, 0x33, 0xc0, 0xc0, 0xc0, 0x38, 0xbf, 0xbf, 0xbf, 0x3c, 0xbf, 0xbf, 0xbf, 0x44, 0xbe, 0xbe, 0xbe, 0x50, 0xb9, 0xb9, 0xb9, 0x6c, 0xb1, 0xb1, 0xb1, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xb0, 0xb0, 0x00, 0xb4, 0xb4, 0xb4, 0x73, 0xbc, 0xbc, 0xbc, 0x5b, 0xbf, 0xbf, 0xbf, 0x47, 0xc1, 0xc1, 0xc1, 0x38, 0xc3, 0xc3, 0xc3, 0x34, 0xc6, 0xc6, 0xc6, 0x30, 0xc8, 0xc8, 0xc8, 0x2c, 0xca, 0xca, 0xca, 0x2b, 0xca, 0xca, 0xca, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcc, 0xcc, 0xcc, 0x28, 0xcc, 0xcc, 0xcc, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xcd, 0xcd, 0xcd, 0x27, 0xce, 0xce, 0xce, 0x27, 0xce, 0xce, 0xce, 0x27, 0xf5, 0xf5, 0xf5, 0x78, 0xf7, 0xf7, 0xf7, 0x88, 0xf7, 0xf7, 0xf7, 0x84, 0xf7, 0xf7, 0xf7, 0x83, 0xf6, 0xf6, 0xf6, 0x7c, 0xf6, 0xf6, 0xf6, 0x7b, 0xf6, 0xf6, 0xf6, 0x74, 0xf6, 0xf6, 0xf6, 0x73, 0xf5, 0xf5, 0xf5, 0x6f, 0xf4, 0xf4, 0xf4, 0x6b, 0xf4, 0xf4, 0xf4, 0x67, 0xf3, 0xf3, 0xf3, 0x63, 0xf2, 0xf2, 0xf2, 0x5f, 0xf1, 0xf1, 0xf1, 0x5c, 0xf0, 0xf0, 0xf0, 0x58, 0xef, 0xef, 0xef, 0x54, 0xee, 0xee, 0xee, 0x50, 0xed, 0xed, 0xed, 0x4c, 0xeb, 0xeb, 0xeb, 0x48, 0xd6, 0xd6, 0xd6, 0x28, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xcf, 0xcf, 0xcf, 0x24, 0xcf, 0xcf, 0xcf, 0x24, 0xce, 0xce, 0xce, 0x27, 0xcd, 0xcd, 0xcd, 0x27, 0xcd, 0xcd, 0xcd, 0x27, 0xcc, 0xcc, 0xcc, 0x27, 0xcc, 0xcc, 0xcc, 0x27, 0xcb, 0xcb, 0xcb, 0x27, 0xc9, 0xc9, 0xc9, 0x28, 0xc8, 0xc8, 0xc8, 0x2b, 0xc7, 0xc7, 0xc7, 0x2b, 0xc6, 0xc6, 0xc6, 0x2c, 0xc5, 0xc5, 0xc5, 0x2c, 0xc4, 0xc4, 0xc4, 0x2f, 0xc3, 0xc3, 0xc3, 0x33, 0xc2, 0xc2, 0xc2, 0x37, 0xc1, 0xc1, 0xc1, 0x3b, 0xc0, 0xc0, 0xc0, 0x43, 0xbf, 0xbf, 0xbf, 0x50, 0xb8, 0xb8, 0xb8, 0x70, 0xb0, 0xb0, 0xb0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xb4, 0xb4, 0x60, 0xbb, 0xbb, 0xbb, 0x63, 0xbf, 0xbf, 0xbf, 0x4b, 0xc0, 0xc0, 0xc0, 0x3b, 0xc3, 0xc3, 0xc3, 0x34, 0xc5, 0xc5, 0xc5, 0x30, 0xc8, 0xc8, 0xc8, 0x2c, 0xca, 0xca, 0xca, 0x2b, 0xca, 0xca, 0xca, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcc, 0xcc, 0xcc, 0x28, 0xcc, 0xcc, 0xcc, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xcd, 0xcd, 0xcd, 0x27, 0xce, 0xce, 0xce, 0x27, 0xce, 0xce, 0xce, 0x27, 0xf4, 0xf4, 0xf4, 0x6c, 0xf7, 0xf7, 0xf7, 0x88, 0xf7, 0xf7, 0xf7, 0x84, 0xf7, 0xf7, 0xf7, 0x83, 0xf6, 0xf6, 0xf6, 0x7c, 0xf6, 0xf6, 0xf6, 0x7b, 0xf6, 0xf6, 0xf6, 0x74, 0xf6, 0xf6, 0xf6, 0x73, 0xf5, 0xf5, 0xf5, 0x6f, 0xf4, 0xf4, 0xf4, 0x6b, 0xf4, 0xf4, 0xf4, 0x67, 0xf3, 0xf3, 0xf3, 0x63, 0xf2, 0xf2, 0xf2, 0x5f, 0xf1, 0xf1, 0xf1, 0x5c, 0xf0, 0xf0, 0xf0, 0x58, 0xef, 0xef, 0xef, 0x54, 0xee, 0xee, 0xee, 0x50, 0xed, 0xed, 0xed, 0x4c, 0xeb, 0xeb, 0xeb, 0x48, 0xd7, 0xd7, 0xd7, 0x2b, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xcf, 0xcf, 0xcf, 0x24, 0xcf, 0xcf, 0xcf, 0x24, 0xcf, 0xcf, 0xcf, 0x24, 0xce, 0xce, 0xce, 0x24, 0xce, 0xce, 0xce, 0x24, 0xce, 0xce, 0xce, 0x24, 0xcc, 0xcc, 0xcc, 0x27, 0xcb, 0xcb, 0xcb, 0x27, 0xca, 0xca, 0xca, 0x28, 0xc9, 0xc9, 0xc9, 0x28, 0xc8, 0xc8, 0xc8, 0x2b, 0xc7, 0xc7, 0xc7, 0x2b, 0xc6, 0xc6, 0xc6, 0x2c, 0xc6, 0xc6, 0xc6, 0x2c, 0xc5, 0xc5, 0xc5, 0x30, 0xc4, 0xc4, 0xc4, 0x37, 0xc3, 0xc3, 0xc3, 0x3b, 0xc3, 0xc3, 0xc3, 0x43, 0xc2, 0xc2, 0xc2, 0x50, 0xb8, 0xb8, 0xb8, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0x4c, 0xba, 0xba, 0xba, 0x6b, 0xbf, 0xbf, 0xbf, 0x4c, 0xc0, 0xc0, 0xc0, 0x3f, 0xc2, 0xc2, 0xc2, 0x37, 0xc5, 0xc5, 0xc5, 0x33, 0xc8, 0xc8, 0xc8, 0x2f, 0xca, 0xca, 0xca, 0x2b, 0xca, 0xca, 0xca, 0x2b, 0xcb, 0xcb, 0xcb, 0x28, 0xcc, 0xcc, 0xcc, 0x28, 0xcc, 0xcc, 0xcc, 0x28, 0xcd, 0xcd, 0xcd, 0x27, 0xce, 0xce, 0xce, 0x27, 0xce, 0xce, 0xce, 0x27, 0xcf, 0xcf, 0xcf, 0x27, 0xf2, 0xf2, 0xf2, 0x63, 0xf7, 0xf7, 0xf7, 0x88, 0xf7, 0xf7, 0xf7, 0x84, 0xf7, 0xf7, 0xf7, 0x80, 0xf6, 0xf6, 0xf6, 0x7c, 0xf6, 0xf6, 0xf6, 0x7b, 0xf6, 0xf6, 0xf6, 0x74, 0xf6, 0xf6, 0xf6, 0x73, 0xf5, 0xf5, 0xf5, 0x6f, 0xf4, 0xf4, 0xf4, 0x6b, 0xf4, 0xf4, 0xf4, 0x67, 0xf3, 0xf3, 0xf3, 0x63, 0xf2, 0xf2, 0xf2, 0x5f, 0xf1, 0xf1, 0xf1, 0x5c, 0xf0, 0xf0, 0xf0, 0x58, 0xef, 0xef, 0xef, 0x54, 0xee, 0xee, 0xee, 0x50, 0xed, 0xed, 0xed, 0x4c, 0xeb, 0xeb, 0xeb, 0x48, 0xd7, 0xd7, 0xd7, 0x2b, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xcf, 0xcf, 0xcf, 0x24, 0xcf, 0xcf, 0xcf, 0x24, 0xcd, 0xcd, 0xcd, 0x24, 0xcc, 0xcc, 0xcc, 0x27, 0xcb, 0xcb, 0xcb, 0x27, 0xca, 0xca, 0xca, 0x28, 0xca, 0xca, 0xca, 0x28, 0xc9, 0xc9, 0xc9, 0x2b, 0xc9, 0xc9, 0xc9, 0x2b, 0xc8, 0xc8, 0xc8, 0x2c, 0xc7, 0xc7, 0xc7, 0x30, 0xc7, 0xc7, 0xc7, 0x34, 0xc7, 0xc7, 0xc7, 0x37, 0xc6, 0xc6, 0xc6, 0x40, 0xc4, 0xc4, 0xc4, 0x53, 0xb8, 0xb8, 0xb8, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0x3b, 0xb8, 0xb8, 0xb8, 0x70, 0xbe, 0xbe, 0xbe, 0x50, 0xbf, 0xbf, 0xbf, 0x43, 0xc2, 0xc2, 0xc2, 0x38, 0xc5, 0xc5, 0xc5, 0x34, 0xc8, 0xc8, 0xc8, 0x2f, 0xca, 0xca, 0xca, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcb, 0xcb, 0xcb, 0x28, 0xcc, 0xcc, 0xcc, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xcd, 0xcd, 0xcd, 0x27, 0xce, 0xce, 0xce, 0x27, 0xcf, 0xcf, 0xcf, 0x27, 0xcf, 0xcf, 0xcf, 0x24, 0xf0, 0xf0, 0xf0, 0x58, 0xf8, 0xf8, 0xf8, 0x88, 0xf8, 0xf8, 0xf8, 0x84, 0xf7, 0xf7, 0xf7, 0x80, 0xf7, 0xf7, 0xf7, 0x7c, 0xf6, 0xf6, 0xf6, 0x78, 0xf6, 0xf6, 0xf6, 0x74, 0xf6, 0xf6, 0xf6, 0x70, 0xf5, 0xf5, 0xf5, 0x6f, 0xf5, 0xf5, 0xf5, 0x6b, 0xf4, 0xf4, 0xf4, 0x67, 0xf3, 0xf3, 0xf3, 0x63, 0xf2, 0xf2, 0xf2, 0x5f, 0xf2, 0xf2, 0xf2, 0x5b, 0xf1, 0xf1, 0xf1, 0x57, 0xf0, 0xf0, 0xf0, 0x53, 0xee, 0xee, 0xee, 0x50, 0xed, 0xed, 0xed, 0x4c, 0xeb, 0xeb, 0xeb, 0x48, 0xd8, 0xd8, 0xd8, 0x28, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x24, 0xd1, 0xd1, 0xd1, 0x23, 0xd1, 0xd1, 0xd1, 0x23, 0xd1, 0xd1, 0xd1, 0x23, 0xd0, 0xd0, 0xd0, 0x23, 0xce, 0xce, 0xce, 0x24, 0xcd, 0xcd, 0xcd, 0x24, 0xcd, 0xcd, 0xcd, 0x27, 0xcc, 0xcc, 0xcc, 0x27, 0xcc, 0xcc, 0xcc, 0x27, 0xcb, 0xcb, 0xcb, 0x28, 0xcb, 0xcb, 0xcb, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xca, 0xca, 0xca, 0x2f, 0xca, 0xca, 0xca, 0x33, 0xca, 0xca, 0xca, 0x34, 0xc9, 0xc9, 0xc9, 0x40, 0xc6, 0xc6, 0xc6, 0x54, 0xb7, 0xb7, 0xb7, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xb1, 0xb1, 0x23, 0xb7, 0xb7, 0xb7, 0x78, 0xbd, 0xbd, 0xbd, 0x57, 0xbf, 0xbf, 0xbf, 0x47, 0xc1, 0xc1, 0xc1, 0x3b, 0xc4, 0xc4, 0xc4, 0x34, 0xc7, 0xc7, 0xc7, 0x30, 0xca, 0xca, 0xca, 0x2b, 0xcb, 0xcb, 0xcb, 0x2b, 0xcb, 0xcb, 0xcb, 0x28, 0xcc, 0xcc, 0xcc, 0x28, 0xcd, 0xcd, 0xcd, 0x27, 0xce, 0xce, 0xce, 0x27, 0xce, 0xce, 0xce, 0x24, 0xcf, 0xcf, 0xcf, 0x24, 0xcf, 0xcf, 0xcf, 0x24, 0xed, 0xed, 0xed, 0x4f, 0xf8, 0xf8, 0xf8, 0x88, 0xf8, 0xf8, 0xf8, 0x84, 0xf7, 0xf7, 0xf7, 0x80, 0xf7, 0xf7, 0xf7, 0x7c, 0xf7, 0xf7, 0xf7, 0x78, 0xf6, 0xf6, 0xf6, 0x74, 0xf6, 0xf6, 0xf6, 0x70, 0xf6, 0xf6, 0xf6, 0x6c, 0xf5, 0xf5, 0xf5, 0x68, 0xf5, 0xf5, 0xf5, 0x67, 0xf4, 0xf4, 0xf4, 0x63, 0xf3, 0xf3, 0xf3, 0x5f, 0xf2, 0xf2, 0xf2, 0x5b, 0xf1, 0xf1, 0xf1, 0x57, 0xf0, 0xf0, 0xf0, 0x53, 0xef, 0xef, 0xef, 0x4f, 0xee, 0xee, 0xee, 0x4b, 0xec, 0xec, 0xec, 0x47, 0xdd, 0xdd, 0xdd, 0x2c, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd1, 0xd1, 0xd1, 0x23, 0xd0, 0xd0, 0xd0, 0x23, 0xcf, 0xcf, 0xcf, 0x24, 0xcf, 0xcf, 0xcf, 0x24, 0xce, 0xce, 0xce, 0x27, 0xce, 0xce, 0xce, 0x27, 0xce, 0xce, 0xce, 0x27, 0xce, 0xce, 0xce, 0x28, 0xcf, 0xcf, 0xcf, 0x28, 0xcf, 0xcf, 0xcf, 0x2b, 0xcf, 0xcf, 0xcf, 0x2f, 0xce, 0xce, 0xce, 0x33, 0xcd, 0xcd, 0xcd, 0x3f, 0xc6, 0xc6, 0xc6, 0x58, 0xb5, 0xb5, 0xb5, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xb0, 0xb0, 0x0b, 0xb5, 0xb5, 0xb5, 0x7f, 0xbc, 0xbc, 0xbc, 0x5b, 0xbf, 0xbf, 0xbf, 0x48, 0xc1, 0xc1, 0xc1, 0x3c, 0xc4, 0xc4, 0xc4, 0x37, 0xc7, 0xc7, 0xc7, 0x30, 0xca, 0xca, 0xca, 0x2c, 0xcb, 0xcb, 0xcb, 0x2b, 0xcb, 0xcb, 0xcb, 0x28, 0xcd, 0xcd, 0xcd, 0x28, 0xcd, 0xcd, 0xcd, 0x27, 0xce, 0xce, 0xce, 0x27, 0xcf, 0xcf, 0xcf, 0x24, 0xcf, 0xcf, 0xcf, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xe9, 0xe9, 0xe9, 0x43, 0xf8, 0xf8, 0xf8, 0x87, 0xf8, 0xf8, 0xf8, 0x83, 0xf8, 0xf8, 0xf8, 0x80, 0xf7, 0xf7, 0xf7, 0x7b, 0xf7, 0xf7, 0xf7, 0x78, 0xf6, 0xf6, 0xf6, 0x74, 0xf6, 0xf6, 0xf6, 0x70, 0xf6, 0xf6, 0xf6, 0x6c, 0xf6, 0xf6, 0xf6, 0x68, 0xf5, 0xf5, 0xf5, 0x64, 0xf4, 0xf4, 0xf4, 0x60, 0xf4, 0xf4, 0xf4, 0x5c, 0xf3, 0xf3, 0xf3, 0x58, 0xf2, 0xf2, 0xf2, 0x57, 0xf1, 0xf1, 0xf1, 0x53, 0xf0, 0xf0, 0xf0, 0x4f, 0xef, 0xef, 0xef, 0x4b, 0xed, 0xed, 0xed, 0x47, 0xe1, 0xe1, 0xe1, 0x2f, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd3, 0xd3, 0xd3, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x20, 0xd5, 0xd5, 0xd5, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x20, 0xd3, 0xd3, 0xd3, 0x20, 0xd3, 0xd3, 0xd3, 0x20, 0xd3, 0xd3, 0xd3, 0x20, 0xd2, 0xd2, 0xd2, 0x20, 0xd2, 0xd2, 0xd2, 0x20, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xd1, 0xd1, 0xd1, 0x23, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd1, 0xd1, 0xd1, 0x24, 0xd2, 0xd2, 0xd2, 0x24, 0xd2, 0xd2, 0xd2, 0x27, 0xd2, 0xd2, 0xd2, 0x28, 0xd2, 0xd2, 0xd2, 0x2c, 0xd1, 0xd1, 0xd1, 0x33, 0xcf, 0xcf, 0xcf, 0x3f, 0xc4, 0xc4, 0xc4, 0x60, 0xb3, 0xb3, 0xb3, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xb0, 0xb0, 0x03, 0xb4, 0xb4, 0xb4, 0x78, 0xbb, 0xbb, 0xbb, 0x60, 0xbf, 0xbf, 0xbf, 0x4c, 0xc1, 0xc1, 0xc1, 0x3f, 0xc4, 0xc4, 0xc4, 0x38, 0xc7, 0xc7, 0xc7, 0x33, 0xca, 0xca, 0xca, 0x2c, 0xcb, 0xcb, 0xcb, 0x2b, 0xcc, 0xcc, 0xcc, 0x28, 0xcd, 0xcd, 0xcd, 0x27, 0xce, 0xce, 0xce, 0x27, 0xce, 0xce, 0xce, 0x24, 0xcf, 0xcf, 0xcf, 0x24, 0xd0, 0xd0, 0xd0, 0x23, 0xd1, 0xd1, 0xd1, 0x23, 0xe4, 0xe4, 0xe4, 0x38, 0xf8, 0xf8, 0xf8, 0x87, 0xf8, 0xf8, 0xf8, 0x83, 0xf8, 0xf8, 0xf8, 0x7f, 0xf8, 0xf8, 0xf8, 0x7b, 0xf7, 0xf7, 0xf7, 0x77, 0xf7, 0xf7, 0xf7, 0x73, 0xf6, 0xf6, 0xf6, 0x6f, 0xf6, 0xf6, 0xf6, 0x6c, 0xf6, 0xf6, 0xf6, 0x68, 0xf6, 0xf6, 0xf6, 0x64, 0xf5, 0xf5, 0xf5, 0x60, 0xf4, 0xf4, 0xf4, 0x5c, 0xf3, 0xf3, 0xf3, 0x58, 0xf3, 0xf3, 0xf3, 0x54, 0xf2, 0xf2, 0xf2, 0x50, 0xf1, 0xf1, 0xf1, 0x4c, 0xef, 0xef, 0xef, 0x48, 0xee, 0xee, 0xee, 0x47, 0xe3, 0xe3, 0xe3, 0x2f, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd4, 0xd4, 0xd4, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd5, 0xd5, 0xd5, 0x20, 0xd5, 0xd5, 0xd5, 0x20, 0xd5, 0xd5, 0xd5, 0x20, 0xd4, 0xd4, 0xd4, 0x20, 0xd4, 0xd4, 0xd4, 0x20, 0xd4, 0xd4, 0xd4, 0x20, 0xd4, 0xd4, 0xd4, 0x20, 0xd4, 0xd4, 0xd4, 0x20, 0xd4, 0xd4, 0xd4, 0x20, 0xd3, 0xd3, 0xd3, 0x20, 0xd4, 0xd4, 0xd4, 0x20, 0xd4, 0xd4, 0xd4, 0x20, 0xd4, 0xd4, 0xd4, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd6, 0xd6, 0xd6, 0x23, 0xd6, 0xd6, 0xd6, 0x27, 0xd4, 0xd4, 0xd4, 0x28, 0xd3, 0xd3, 0xd3, 0x30, 0xd2, 0xd2, 0xd2, 0x3f, 0xc2, 0xc2, 0xc2, 0x68, 0xb0, 0xb0, 0xb0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xb4, 0xb4, 0x68, 0xba, 0xba, 0xba, 0x64, 0xbe, 0xbe, 0xbe, 0x50, 0xc1, 0xc1, 0xc1, 0x40, 0xc4, 0xc4, 0xc4, 0x38, 0xc7, 0xc7, 0xc7, 0x33, 0xc9, 0xc9, 0xc9, 0x2c, 0xcb, 0xcb, 0xcb, 0x2b, 0xcc, 0xcc, 0xcc, 0x28, 0xce, 0xce, 0xce, 0x27, 0xce, 0xce, 0xce, 0x24, 0xcf, 0xcf, 0xcf, 0x24, 0xd0, 0xd0, 0xd0, 0x23, 0xd1, 0xd1, 0xd1, 0x23, 0xd2, 0xd2, 0xd2, 0x23, 0xde, 0xde, 0xde, 0x2c, 0xf9, 0xf9, 0xf9, 0x87, 0xf8, 0xf8, 0xf8, 0x83, 0xf8, 0xf8, 0xf8, 0x7f, 0xf8, 0xf8, 0xf8, 0x7b, 0xf7, 0xf7, 0xf7, 0x77, 0xf7, 0xf7, 0xf7, 0x73, 0xf7, 0xf7, 0xf7, 0x6f, 0xf6, 0xf6, 0xf6, 0x6b, 0xf6, 0xf6, 0xf6, 0x67, 0xf6, 0xf6, 0xf6, 0x64, 0xf6, 0xf6, 0xf6, 0x60, 0xf5, 0xf5, 0xf5, 0x5c, 0xf4, 0xf4, 0xf4, 0x58, 0xf3, 0xf3, 0xf3, 0x54, 0xf2, 0xf2, 0xf2, 0x50, 0xf1, 0xf1, 0xf1, 0x4c, 0xf0, 0xf0, 0xf0, 0x48, 0xef, 0xef, 0xef, 0x44, 0xe3, 0xe3, 0xe3, 0x2c, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd5, 0xd5, 0xd5, 0x20, 0xd5, 0xd5, 0xd5, 0x20, 0xd5, 0xd5, 0xd5, 0x20, 0xd5, 0xd5, 0xd5, 0x20, 0xd5, 0xd5, 0xd5, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd5, 0xd5, 0xd5, 0x20, 0xd5, 0xd5, 0xd5, 0x20, 0xd5, 0xd5, 0xd5, 0x20, 0xd5, 0xd5, 0xd5, 0x20, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd5, 0xd5, 0xd5, 0x23, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x1f, 0xd7, 0xd7, 0xd7, 0x1f, 0xd7, 0xd7, 0xd7, 0x1f, 0xd7, 0xd7, 0xd7, 0x1f, 0xd7, 0xd7, 0xd7, 0x1f, 0xd7, 0xd7, 0xd7, 0x1f, 0xd7, 0xd7, 0xd7, 0x1f, 0xd7, 0xd7, 0xd7, 0x1c, 0xd7, 0xd7, 0xd7, 0x1f, 0xd7, 0xd7, 0xd7, 0x1f, 0xd7, 0xd7, 0xd7, 0x1f, 0xd7, 0xd7, 0xd7, 0x1f, 0xd8, 0xd8, 0xd8, 0x1f, 0xd8, 0xd8, 0xd8, 0x1f, 0xd9, 0xd9, 0xd9, 0x1f, 0xda, 0xda, 0xda, 0x20, 0xd9, 0xd9, 0xd9, 0x24, 0xd8, 0xd8, 0xd8, 0x27, 0xd8, 0xd8, 0xd8, 0x2f, 0xd4, 0xd4, 0xd4, 0x40, 0xbf, 0xbf, 0xbf, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0x54, 0xb9, 0xb9, 0xb9, 0x6c, 0xbe, 0xbe, 0xbe, 0x54, 0xc0, 0xc0, 0xc0, 0x44, 0xc3, 0xc3, 0xc3, 0x3b, 0xc6, 0xc6, 0xc6, 0x34, 0xc9, 0xc9, 0xc9, 0x2c, 0xcb, 0xcb, 0xcb, 0x2b, 0xcd, 0xcd, 0xcd, 0x28, 0xce, 0xce, 0xce, 0x27, 0xcf, 0xcf, 0xcf, 0x24, 0xd0, 0xd0, 0xd0, 0x23, 0xd1, 0xd1, 0xd1, 0x23, 0xd2, 0xd2, 0xd2, 0x20, 0xd2, 0xd2, 0xd2, 0x20, 0xd9, 0xd9, 0xd9, 0x24, 0xf9, 0xf9, 0xf9, 0x80, 0xf9, 0xf9, 0xf9, 0x83, 0xf9, 0xf9, 0xf9, 0x7c, 0xf9, 0xf9, 0xf9, 0x78, 0xf8, 0xf8, 0xf8, 0x77, 0xf8, 0xf8, 0xf8, 0x70, 0xf7, 0xf7, 0xf7, 0x6f, 0xf7, 0xf7, 0xf7, 0x6b, 0xf6, 0xf6, 0xf6, 0x67, 0xf6, 0xf6, 0xf6, 0x63, 0xf6, 0xf6, 0xf6, 0x5f, 0xf5, 0xf5, 0xf5, 0x5b, 0xf5, 0xf5, 0xf5, 0x57, 0xf4, 0xf4, 0xf4, 0x53, 0xf3, 0xf3, 0xf3, 0x50, 0xf2, 0xf2, 0xf2, 0x4c, 0xf1, 0xf1, 0xf1, 0x48, 0xf0, 0xf0, 0xf0, 0x44, 0xe5, 0xe5, 0xe5, 0x2f, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd7, 0xd7, 0xd7, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd9, 0xd9, 0xd9, 0x1f, 0xd9, 0xd9, 0xd9, 0x1f, 0xd9, 0xd9, 0xd9, 0x1f, 0xd9, 0xd9, 0xd9, 0x1f, 0xda, 0xda, 0xda, 0x1f, 0xda, 0xda, 0xda, 0x1f, 0xda, 0xda, 0xda, 0x1f, 0xdb, 0xdb, 0xdb, 0x1c, 0xda, 0xda, 0xda, 0x1c, 0xda, 0xda, 0xda, 0x1c, 0xda, 0xda, 0xda, 0x1c, 0xda, 0xda, 0xda, 0x1c, 0xda, 0xda, 0xda, 0x1c, 0xda, 0xda, 0xda, 0x1c, 0xda, 0xda, 0xda, 0x1b, 0xda, 0xda, 0xda, 0x1b, 0xdb, 0xdb, 0xdb, 0x1b, 0xdb, 0xdb, 0xdb, 0x1b, 0xda, 0xda, 0xda, 0x1c, 0xdb, 0xdb, 0xdb, 0x1c, 0xdb, 0xdb, 0xdb, 0x1c, 0xdb, 0xdb, 0xdb, 0x1c, 0xdc, 0xdc, 0xdc, 0x1c, 0xdd, 0xdd, 0xdd, 0x1c, 0xdd, 0xdd, 0xdd, 0x1f, 0xdd, 0xdd, 0xdd, 0x20, 0xde, 0xde, 0xde, 0x24, 0xdc, 0xdc, 0xdc, 0x2f, 0xd6, 0xd6, 0xd6, 0x43, 0xbe, 0xbe, 0xbe, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xb2, 0xb2, 0x3f, 0xb8, 0xb8, 0xb8, 0x74, 0xbd, 0xbd, 0xbd, 0x57, 0xbf, 0xbf, 0xbf, 0x47, 0xc3, 0xc3, 0xc3, 0x3c, 0xc6, 0xc6, 0xc6, 0x34, 0xc9, 0xc9, 0xc9, 0x2f, 0xcb, 0xcb, 0xcb, 0x28, 0xcd, 0xcd, 0xcd, 0x27, 0xcf, 0xcf, 0xcf, 0x24, 0xd0, 0xd0, 0xd0, 0x24, 0xd1, 0xd1, 0xd1, 0x23, 0xd2, 0xd2, 0xd2, 0x20, 0xd3, 0xd3, 0xd3, 0x20, 0xd4, 0xd4, 0xd4, 0x1f, 0xd7, 0xd7, 0xd7, 0x20, 0xf9, 0xf9, 0xf9, 0x78, 0xfa, 0xfa, 0xfa, 0x80, 0xf9, 0xf9, 0xf9, 0x7c, 0xf9, 0xf9, 0xf9, 0x78, 0xf9, 0xf9, 0xf9, 0x74, 0xf8, 0xf8, 0xf8, 0x70, 0xf8, 0xf8, 0xf8, 0x6c, 0xf8, 0xf8, 0xf8, 0x68, 0xf7, 0xf7, 0xf7, 0x64, 0xf7, 0xf7, 0xf7, 0x60, 0xf7, 0xf7, 0xf7, 0x5c, 0xf6, 0xf6, 0xf6, 0x58, 0xf6, 0xf6, 0xf6, 0x57, 0xf5, 0xf5, 0xf5, 0x53, 0xf4, 0xf4, 0xf4, 0x4f, 0xf4, 0xf4, 0xf4, 0x4b, 0xf2, 0xf2, 0xf2, 0x47, 0xf2, 0xf2, 0xf2, 0x43, 0xea, 0xea, 0xea, 0x2f, 0xda, 0xda, 0xda, 0x1f, 0xda, 0xda, 0xda, 0x1f, 0xda, 0xda, 0xda, 0x1f, 0xda, 0xda, 0xda, 0x1f, 0xda, 0xda, 0xda, 0x1f, 0xd9, 0xd9, 0xd9, 0x1f, 0xd9, 0xd9, 0xd9, 0x1f, 0xd9, 0xd9, 0xd9, 0x1f, 0xd9, 0xd9, 0xd9, 0x1f, 0xd9, 0xd9, 0xd9, 0x1f, 0xd9, 0xd9, 0xd9, 0x1f, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd8, 0xd8, 0xd8, 0x20, 0xd9, 0xd9, 0xd9, 0x20, 0xd9, 0xd9, 0xd9, 0x20, 0xd9, 0xd9, 0xd9, 0x20, 0xd9, 0xd9, 0xd9, 0x1f, 0xd9, 0xd9, 0xd9, 0x1f, 0xd9, 0xd9, 0xd9, 0x1f, 0xd9, 0xd9, 0xd9, 0x1f, 0xd9, 0xd9, 0xd9, 0x1f, 0xd9, 0xd9, 0xd9, 0x1f, 0xda, 0xda, 0xda, 0x1f, 0xda, 0xda, 0xda, 0x1f, 0xda, 0xda, 0xda, 0x1f, 0xda, 0xda, 0xda, 0x1f, 0xdb, 0xdb, 0xdb, 0x1f, 0xdb, 0xdb, 0xdb, 0x1c, 0xdb, 0xdb, 0xdb, 0x1c, 0xdc, 0xdc, 0xdc, 0x1c, 0xdc, 0xdc, 0xdc, 0x1c, 0xdc, 0xdc, 0xdc, 0x1c, 0xdc, 0xdc, 0xdc, 0x1c, 0xdd, 0xdd, 0xdd, 0x1c, 0xdd, 0xdd, 0xdd, 0x1c, 0xde, 0xde, 0xde, 0x1b, 0xdd, 0xdd, 0xdd, 0x1b, 0xdd, 0xdd, 0xdd, 0x1b, 0xdd, 0xdd, 0xdd, 0x1b, 0xdd, 0xdd, 0xdd, 0x1b, 0xdd, 0xdd, 0xdd, 0x1b, 0xdd, 0xdd, 0xdd, 0x18, 0xde, 0xde, 0xde, 0x18, 0xde, 0xde, 0xde, 0x18, 0xde, 0xde, 0xde, 0x18, 0xde, 0xde, 0xde, 0x18, 0xde, 0xde, 0xde, 0x18, 0xde, 0xde, 0xde, 0x18, 0xdf, 0xdf, 0xdf, 0x1b, 0xe0, 0xe0, 0xe0, 0x18, 0xe0, 0xe0, 0xe0, 0x18, 0xe1, 0xe1, 0xe1, 0x18, 0xe2, 0xe2, 0xe2, 0x1b, 0xe2, 0xe2, 0xe2, 0x1f, 0xe2, 0xe2, 0xe2, 0x20, 0xdf, 0xdf, 0xdf, 0x2c, 0xd6, 0xd6, 0xd6, 0x44, 0xbc, 0xbc, 0xbc, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xb1, 0xb1, 0x28, 0xb7, 0xb7, 0xb7, 0x7b, 0xbd, 0xbd, 0xbd, 0x5c, 0xbf, 0xbf, 0xbf, 0x4b, 0xc2, 0xc2, 0xc2, 0x3f, 0xc5, 0xc5, 0xc5, 0x37, 0xc8, 0xc8, 0xc8, 0x30, 0xcc, 0xcc, 0xcc, 0x28, 0xcd, 0xcd, 0xcd, 0x27, 0xcf, 0xcf, 0xcf, 0x24, 0xd1, 0xd1, 0xd1, 0x23, 0xd2, 0xd2, 0xd2, 0x20, 0xd2, 0xd2, 0xd2, 0x1f, 0xd3, 0xd3, 0xd3, 0x1f, 0xd4, 0xd4, 0xd4, 0x1f, 0xd6, 0xd6, 0xd6, 0x1c, 0xf8, 0xf8, 0xf8, 0x6f, 0xfa, 0xfa, 0xfa, 0x7f, 0xfa, 0xfa, 0xfa, 0x7b, 0xfa, 0xfa, 0xfa, 0x77, 0xfa, 0xfa, 0xfa, 0x73, 0xf9, 0xf9, 0xf9, 0x6f, 0xf9, 0xf9, 0xf9, 0x6b, 0xf9, 0xf9, 0xf9, 0x67, 0xf8, 0xf8, 0xf8, 0x63, 0xf8, 0xf8, 0xf8, 0x5f, 0xf8, 0xf8, 0xf8, 0x5b, 0xf7, 0xf7, 0xf7, 0x58, 0xf6, 0xf6, 0xf6, 0x54, 0xf6, 0xf6, 0xf6, 0x50, 0xf6, 0xf6, 0xf6, 0x4c, 0xf5, 0xf5, 0xf5, 0x48, 0xf4, 0xf4, 0xf4, 0x44, 0xf4, 0xf4, 0xf4, 0x40, 0xed, 0xed, 0xed, 0x2f, 0xde, 0xde, 0xde, 0x1b, 0xdd, 0xdd, 0xdd, 0x1b, 0xdd, 0xdd, 0xdd, 0x1c, 0xdd, 0xdd, 0xdd, 0x1c, 0xdd, 0xdd, 0xdd, 0x1c, 0xdd, 0xdd, 0xdd, 0x1c, 0xdc, 0xdc, 0xdc, 0x1c, 0xdc, 0xdc, 0xdc, 0x1c, 0xdc, 0xdc, 0xdc, 0x1c, 0xdc, 0xdc, 0xdc, 0x1c, 0xdc, 0xdc, 0xdc, 0x1c, 0xdb, 0xdb, 0xdb, 0x1c, 0xdb, 0xdb, 0xdb, 0x1c, 0xdb, 0xdb, 0xdb, 0x1c, 0xdb, 0xdb, 0xdb, 0x1c, 0xdb, 0xdb, 0xdb, 0x1c, 0xdb, 0xdb, 0xdb, 0x1f, 0xdb, 0xdb, 0xdb, 0x1f, 0xdb, 0xdb, 0xdb, 0x1f, 0xdb, 0xdb, 0xdb, 0x1f, 0xdb, 0xdb, 0xdb, 0x1c, 0xdb, 0xdb, 0xdb, 0x1f, 0xda, 0xda, 0xda, 0x1f, 0xdb, 0xdb, 0xdb, 0x1f, 0xdb, 0xdb, 0xdb, 0x1f, 0xdb, 0xdb, 0xdb, 0x1f, 0xdb, 0xdb, 0xdb, 0x1f, 0xdb, 0xdb, 0xdb, 0x1f, 0xdb, 0xdb, 0xdb, 0x1f, 0xdb, 0xdb, 0xdb, 0x1c, 0xdb, 0xdb, 0xdb, 0x1c, 0xdb, 0xdb, 0xdb, 0x1c, 0xdb, 0xdb, 0xdb, 0x1c, 0xdb, 0xdb, 0xdb, 0x1c, 0xdb, 0xdb, 0xdb, 0x1c, 0xdc, 0xdc, 0xdc, 0x1c, 0xdc, 0xdc, 0xdc, 0x1c, 0xdc, 0xdc, 0xdc, 0x1c, 0xdc, 0xdc, 0xdc, 0x1c, 0xdc, 0xdc, 0xdc, 0x1c, 0xdc, 0xdc, 0xdc, 0x1c, 0xdc, 0xdc, 0xdc, 0x1c, 0xdc, 0xdc, 0xdc, 0x1c, 0xdd, 0xdd, 0xdd, 0x1c, 0xdd, 0xdd, 0xdd, 0x1c, 0xdd, 0xdd, 0xdd, 0x1c, 0xde, 0xde, 0xde, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xdf, 0xdf, 0xdf, 0x1b, 0xdf, 0xdf, 0xdf, 0x1b, 0xdf, 0xdf, 0xdf, 0x1b, 0xe0, 0xe0, 0xe0, 0x1b, 0xe0, 0xe0, 0xe0, 0x18, 0xe0, 0xe0, 0xe0, 0x18, 0xe0, 0xe0, 0xe0, 0x18, 0xe0, 0xe0, 0xe0, 0x18, 0xe0, 0xe0, 0xe0, 0x18, 0xe0, 0xe0, 0xe0, 0x18, 0xe0, 0xe0, 0xe0, 0x18, 0xe1, 0xe1, 0xe1, 0x17, 0xe1, 0xe1, 0xe1, 0x17, 0xe1, 0xe1, 0xe1, 0x17, 0xe1, 0xe1, 0xe1, 0x17, 0xe1, 0xe1, 0xe1, 0x17, 0xe2, 0xe2, 0xe2, 0x17, 0xe2, 0xe2, 0xe2, 0x17, 0xe2, 0xe2, 0xe2, 0x17, 0xe3, 0xe3, 0xe3, 0x17, 0xe3, 0xe3, 0xe3, 0x17, 0xe4, 0xe4, 0xe4, 0x17, 0xe4, 0xe4, 0xe4, 0x17, 0xe5, 0xe5, 0xe5, 0x18, 0xe5, 0xe5, 0xe5, 0x1b, 0xe5, 0xe5, 0xe5, 0x1f, 0xe1, 0xe1, 0xe1, 0x2c, 0xd5, 0xd5, 0xd5, 0x48, 0xba, 0xba, 0xba, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xb1, 0xb1, 0x10, 0xb5, 0xb5, 0xb5, 0x83, 0xbc, 0xbc, 0xbc, 0x60, 0xbf, 0xbf, 0xbf, 0x4f, 0xc2, 0xc2, 0xc2, 0x40, 0xc5, 0xc5, 0xc5, 0x38, 0xc8, 0xc8, 0xc8, 0x30, 0xcc, 0xcc, 0xcc, 0x2b, 0xcd, 0xcd, 0xcd, 0x27, 0xcf, 0xcf, 0xcf, 0x24, 0xd1, 0xd1, 0xd1, 0x23, 0xd2, 0xd2, 0xd2, 0x20, 0xd3, 0xd3, 0xd3, 0x1f, 0xd5, 0xd5, 0xd5, 0x1c, 0xd6, 0xd6, 0xd6, 0x1c, 0xd7, 0xd7, 0xd7, 0x1b, 0xf8, 0xf8, 0xf8, 0x63, 0xfb, 0xfb, 0xfb, 0x7f, 0xfb, 0xfb, 0xfb, 0x7b, 0xfb, 0xfb, 0xfb, 0x74, 0xfa, 0xfa, 0xfa, 0x73, 0xfa, 0xfa, 0xfa, 0x6c, 0xfa, 0xfa, 0xfa, 0x68, 0xfa, 0xfa, 0xfa, 0x64, 0xf9, 0xf9, 0xf9, 0x60, 0xf9, 0xf9, 0xf9, 0x5f, 0xf9, 0xf9, 0xf9, 0x58, 0xf8, 0xf8, 0xf8, 0x57, 0xf8, 0xf8, 0xf8, 0x53, 0xf7, 0xf7, 0xf7, 0x4f, 0xf7, 0xf7, 0xf7, 0x4b, 0xf6, 0xf6, 0xf6, 0x47, 0xf6, 0xf6, 0xf6, 0x43, 0xf6, 0xf6, 0xf6, 0x3f, 0xf0, 0xf0, 0xf0, 0x2c, 0xe1, 0xe1, 0xe1, 0x18, 0xe1, 0xe1, 0xe1, 0x18, 0xe0, 0xe0, 0xe0, 0x18, 0xe0, 0xe0, 0xe0, 0x18, 0xe0, 0xe0, 0xe0, 0x18, 0xe0, 0xe0, 0xe0, 0x18, 0xe0, 0xe0, 0xe0, 0x18, 0xe0, 0xe0, 0xe0, 0x18, 0xe0, 0xe0, 0xe0, 0x1b, 0xdf, 0xdf, 0xdf, 0x1b, 0xdf, 0xdf, 0xdf, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xde, 0xde, 0xde, 0x1b, 0xdf, 0xdf, 0xdf, 0x1b, 0xdf, 0xdf, 0xdf, 0x1b, 0xdf, 0xdf, 0xdf, 0x1b, 0xdf, 0xdf, 0xdf, 0x1b, 0xdf, 0xdf, 0xdf, 0x1b, 0xdf, 0xdf, 0xdf, 0x1b, 0xdf, 0xdf, 0xdf, 0x1b, 0xdf, 0xdf, 0xdf, 0x1b, 0xdf, 0xdf, 0xdf, 0x1b, 0xdf, 0xdf, 0xdf, 0x1b, 0xdf, 0xdf, 0xdf, 0x1b, 0xe0, 0xe0, 0xe0, 0x1b, 0xe0, 0xe0, 0xe0, 0x18, 0xe0, 0xe0, 0xe0, 0x18, 0xe0, 0xe0, 0xe0, 0x18, 0xe0, 0xe0, 0xe0, 0x18, 0xe1, 0xe1, 0xe1, 0x18, 0xe1, 0xe1, 0xe1, 0x18, 0xe1, 0xe1, 0xe1, 0x18, 0xe2, 0xe2, 0xe2, 0x18, 0xe2, 0xe2, 0xe2, 0x17, 0xe3, 0xe3, 0xe3, 0x17, 0xe3, 0xe3, 0xe3, 0x17, 0xe3, 0xe3, 0xe3, 0x17, 0xe3, 0xe3, 0xe3, 0x17, 0xe3, 0xe3, 0xe3, 0x17, 0xe3, 0xe3, 0xe3, 0x17, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe5, 0xe5, 0xe5, 0x14, 0xe5, 0xe5, 0xe5, 0x14, 0xe6, 0xe6, 0xe6, 0x14, 0xe7, 0xe7, 0xe7, 0x13, 0xe8, 0xe8, 0xe8, 0x13, 0xe8, 0xe8, 0xe8, 0x17, 0xe9, 0xe9, 0xe9, 0x18, 0xe8, 0xe8, 0xe8, 0x1f, 0xe3, 0xe3, 0xe3, 0x2c, 0xd2, 0xd2, 0xd2, 0x50, 0xb5, 0xb5, 0xb5, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xb0, 0xb0, 0x04, 0xb5, 0xb5, 0xb5, 0x7c, 0xbb, 0xbb, 0xbb, 0x64, 0xbf, 0xbf, 0xbf, 0x50, 0xc1, 0xc1, 0xc1, 0x43, 0xc4, 0xc4, 0xc4, 0x3b, 0xc8, 0xc8, 0xc8, 0x33, 0xcc, 0xcc, 0xcc, 0x2b, 0xcd, 0xcd, 0xcd, 0x27, 0xd0, 0xd0, 0xd0, 0x24, 0xd2, 0xd2, 0xd2, 0x23, 0xd2, 0xd2, 0xd2, 0x20, 0xd4, 0xd4, 0xd4, 0x1f, 0xd6, 0xd6, 0xd6, 0x1c, 0xd7, 0xd7, 0xd7, 0x1b, 0xd9, 0xd9, 0xd9, 0x1b, 0xf7, 0xf7, 0xf7, 0x57, 0xfb, 0xfb, 0xfb, 0x7c, 0xfb, 0xfb, 0xfb, 0x78, 0xfb, 0xfb, 0xfb, 0x74, 0xfb, 0xfb, 0xfb, 0x70, 0xfb, 0xfb, 0xfb, 0x6b, 0xfb, 0xfb, 0xfb, 0x68, 0xfa, 0xfa, 0xfa, 0x64, 0xfa, 0xfa, 0xfa, 0x5f, 0xfa, 0xfa, 0xfa, 0x5c, 0xfa, 0xfa, 0xfa, 0x58, 0xf9, 0xf9, 0xf9, 0x54, 0xf9, 0xf9, 0xf9, 0x50, 0xf9, 0xf9, 0xf9, 0x4b, 0xf8, 0xf8, 0xf8, 0x48, 0xf8, 0xf8, 0xf8, 0x44, 0xf7, 0xf7, 0xf7, 0x3f, 0xf6, 0xf6, 0xf6, 0x3c, 0xf2, 0xf2, 0xf2, 0x28, 0xe4, 0xe4, 0xe4, 0x17, 0xe4, 0xe4, 0xe4, 0x17, 0xe4, 0xe4, 0xe4, 0x17, 0xe4, 0xe4, 0xe4, 0x17, 0xe4, 0xe4, 0xe4, 0x17, 0xe4, 0xe4, 0xe4, 0x17, 0xe3, 0xe3, 0xe3, 0x17, 0xe3, 0xe3, 0xe3, 0x17, 0xe3, 0xe3, 0xe3, 0x17, 0xe3, 0xe3, 0xe3, 0x17, 0xe2, 0xe2, 0xe2, 0x18, 0xe2, 0xe2, 0xe2, 0x18, 0xe2, 0xe2, 0xe2, 0x18, 0xe1, 0xe1, 0xe1, 0x18, 0xe1, 0xe1, 0xe1, 0x18, 0xe1, 0xe1, 0xe1, 0x18, 0xe2, 0xe2, 0xe2, 0x18, 0xe2, 0xe2, 0xe2, 0x18, 0xe2, 0xe2, 0xe2, 0x18, 0xe2, 0xe2, 0xe2, 0x18, 0xe1, 0xe1, 0xe1, 0x18, 0xe1, 0xe1, 0xe1, 0x18, 0xe1, 0xe1, 0xe1, 0x18, 0xe1, 0xe1, 0xe1, 0x18, 0xe1, 0xe1, 0xe1, 0x18, 0xe1, 0xe1, 0xe1, 0x18, 0xe1, 0xe1, 0xe1, 0x18, 0xe1, 0xe1, 0xe1, 0x18, 0xe1, 0xe1, 0xe1, 0x18, 0xe1, 0xe1, 0xe1, 0x18, 0xe2, 0xe2, 0xe2, 0x18, 0xe2, 0xe2, 0xe2, 0x18, 0xe2, 0xe2, 0xe2, 0x18, 0xe2, 0xe2, 0xe2, 0x18, 0xe2, 0xe2, 0xe2, 0x18, 0xe2, 0xe2, 0xe2, 0x18, 0xe2, 0xe2, 0xe2, 0x18, 0xe2, 0xe2, 0xe2, 0x18, 0xe2, 0xe2, 0xe2, 0x18, 0xe2, 0xe2, 0xe2, 0x18, 0xe2, 0xe2, 0xe2, 0x18, 0xe2, 0xe2, 0xe2, 0x18, 0xe2, 0xe2, 0xe2, 0x17, 0xe3, 0xe3, 0xe3, 0x17, 0xe3, 0xe3, 0xe3, 0x17, 0xe3, 0xe3, 0xe3, 0x17, 0xe3, 0xe3, 0xe3, 0x17, 0xe3, 0xe3, 0xe3, 0x17, 0xe4, 0xe4, 0xe4, 0x17, 0xe4, 0xe4, 0xe4, 0x17, 0xe4, 0xe4, 0xe4, 0x17, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe5, 0xe5, 0xe5, 0x14, 0xe5, 0xe5, 0xe5, 0x14, 0xe5, 0xe5, 0xe5, 0x14, 0xe5, 0xe5, 0xe5, 0x14, 0xe6, 0xe6, 0xe6, 0x13, 0xe6, 0xe6, 0xe6, 0x13, 0xe6, 0xe6, 0xe6, 0x13, 0xe6, 0xe6, 0xe6, 0x13, 0xe6, 0xe6, 0xe6, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x10, 0xe8, 0xe8, 0xe8, 0x10, 0xe8, 0xe8, 0xe8, 0x13, 0xe8, 0xe8, 0xe8, 0x10, 0xe9, 0xe9, 0xe9, 0x10, 0xea, 0xea, 0xea, 0x10, 0xeb, 0xeb, 0xeb, 0x10, 0xec, 0xec, 0xec, 0x10, 0xec, 0xec, 0xec, 0x13, 0xed, 0xed, 0xed, 0x14, 0xea, 0xea, 0xea, 0x1c, 0xe4, 0xe4, 0xe4, 0x2c, 0xcd, 0xcd, 0xcd, 0x58, 0xb0, 0xb0, 0xb0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xb4, 0xb4, 0x6f, 0xba, 0xba, 0xba, 0x6b, 0xbe, 0xbe, 0xbe, 0x54, 0xc0, 0xc0, 0xc0, 0x44, 0xc4, 0xc4, 0xc4, 0x3c, 0xc8, 0xc8, 0xc8, 0x33, 0xcc, 0xcc, 0xcc, 0x2b, 0xce, 0xce, 0xce, 0x27, 0xd0, 0xd0, 0xd0, 0x24, 0xd2, 0xd2, 0xd2, 0x20, 0xd3, 0xd3, 0xd3, 0x1f, 0xd5, 0xd5, 0xd5, 0x1c, 0xd7, 0xd7, 0xd7, 0x1b, 0xd8, 0xd8, 0xd8, 0x18, 0xda, 0xda, 0xda, 0x18, 0xf6, 0xf6, 0xf6, 0x4c, 0xfb, 0xfb, 0xfb, 0x7c, 0xfc, 0xfc, 0xfc, 0x78, 0xfc, 0xfc, 0xfc, 0x73, 0xfb, 0xfb, 0xfb, 0x6f, 0xfb, 0xfb, 0xfb, 0x6b, 0xfb, 0xfb, 0xfb, 0x67, 0xfb, 0xfb, 0xfb, 0x63, 0xfb, 0xfb, 0xfb, 0x5f, 0xfb, 0xfb, 0xfb, 0x5b, 0xfb, 0xfb, 0xfb, 0x54, 0xfb, 0xfb, 0xfb, 0x50, 0xfa, 0xfa, 0xfa, 0x4f, 0xfa, 0xfa, 0xfa, 0x48, 0xfa, 0xfa, 0xfa, 0x47, 0xf9, 0xf9, 0xf9, 0x43, 0xf8, 0xf8, 0xf8, 0x3f, 0xf8, 0xf8, 0xf8, 0x3b, 0xf6, 0xf6, 0xf6, 0x2b, 0xe6, 0xe6, 0xe6, 0x13, 0xe6, 0xe6, 0xe6, 0x13, 0xe6, 0xe6, 0xe6, 0x13, 0xe6, 0xe6, 0xe6, 0x14, 0xe6, 0xe6, 0xe6, 0x14, 0xe6, 0xe6, 0xe6, 0x14, 0xe5, 0xe5, 0xe5, 0x14, 0xe5, 0xe5, 0xe5, 0x14, 0xe5, 0xe5, 0xe5, 0x14, 0xe5, 0xe5, 0xe5, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x17, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x17, 0xe4, 0xe4, 0xe4, 0x17, 0xe4, 0xe4, 0xe4, 0x17, 0xe4, 0xe4, 0xe4, 0x17, 0xe4, 0xe4, 0xe4, 0x17, 0xe4, 0xe4, 0xe4, 0x17, 0xe4, 0xe4, 0xe4, 0x17, 0xe4, 0xe4, 0xe4, 0x17, 0xe4, 0xe4, 0xe4, 0x17, 0xe4, 0xe4, 0xe4, 0x17, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x14, 0xe5, 0xe5, 0xe5, 0x14, 0xe5, 0xe5, 0xe5, 0x14, 0xe5, 0xe5, 0xe5, 0x14, 0xe5, 0xe5, 0xe5, 0x14, 0xe5, 0xe5, 0xe5, 0x14, 0xe5, 0xe5, 0xe5, 0x14, 0xe6, 0xe6, 0xe6, 0x14, 0xe6, 0xe6, 0xe6, 0x13, 0xe6, 0xe6, 0xe6, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe8, 0xe8, 0xe8, 0x13, 0xe8, 0xe8, 0xe8, 0x13, 0xe9, 0xe9, 0xe9, 0x10, 0xe9, 0xe9, 0xe9, 0x10, 0xe9, 0xe9, 0xe9, 0x10, 0xe9, 0xe9, 0xe9, 0x10, 0xe9, 0xe9, 0xe9, 0x10, 0xe9, 0xe9, 0xe9, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x0f, 0xeb, 0xeb, 0xeb, 0x0f, 0xeb, 0xeb, 0xeb, 0x0f, 0xec, 0xec, 0xec, 0x0f, 0xec, 0xec, 0xec, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xee, 0xee, 0xee, 0x0f, 0xef, 0xef, 0xef, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf0, 0xf0, 0xf0, 0x10, 0xf0, 0xf0, 0xf0, 0x13, 0xec, 0xec, 0xec, 0x1b, 0xe4, 0xe4, 0xe4, 0x2c, 0xc6, 0xc6, 0xc6, 0x5f, 0xb0, 0xb0, 0xb0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xb4, 0xb4, 0x5b, 0xb9, 0xb9, 0xb9, 0x70, 0xbe, 0xbe, 0xbe, 0x58, 0xc0, 0xc0, 0xc0, 0x47, 0xc4, 0xc4, 0xc4, 0x3c, 0xc8, 0xc8, 0xc8, 0x34, 0xcc, 0xcc, 0xcc, 0x2b, 0xce, 0xce, 0xce, 0x27, 0xd1, 0xd1, 0xd1, 0x24, 0xd2, 0xd2, 0xd2, 0x20, 0xd4, 0xd4, 0xd4, 0x1f, 0xd6, 0xd6, 0xd6, 0x1b, 0xd8, 0xd8, 0xd8, 0x18, 0xd9, 0xd9, 0xd9, 0x18, 0xdb, 0xdb, 0xdb, 0x17, 0xf6, 0xf6, 0xf6, 0x40, 0xfc, 0xfc, 0xfc, 0x7b, 0xfc, 0xfc, 0xfc, 0x77, 0xfc, 0xfc, 0xfc, 0x73, 0xfc, 0xfc, 0xfc, 0x6f, 0xfc, 0xfc, 0xfc, 0x68, 0xfc, 0xfc, 0xfc, 0x64, 0xfc, 0xfc, 0xfc, 0x60, 0xfc, 0xfc, 0xfc, 0x5c, 0xfc, 0xfc, 0xfc, 0x58, 0xfc, 0xfc, 0xfc, 0x53, 0xfb, 0xfb, 0xfb, 0x50, 0xfb, 0xfb, 0xfb, 0x4c, 0xfb, 0xfb, 0xfb, 0x47, 0xfa, 0xfa, 0xfa, 0x44, 0xfa, 0xfa, 0xfa, 0x40, 0xfa, 0xfa, 0xfa, 0x3c, 0xf9, 0xf9, 0xf9, 0x38, 0xf7, 0xf7, 0xf7, 0x2b, 0xea, 0xea, 0xea, 0x10, 0xe9, 0xe9, 0xe9, 0x10, 0xe9, 0xe9, 0xe9, 0x10, 0xe9, 0xe9, 0xe9, 0x10, 0xe9, 0xe9, 0xe9, 0x13, 0xe9, 0xe9, 0xe9, 0x13, 0xe8, 0xe8, 0xe8, 0x13, 0xe8, 0xe8, 0xe8, 0x13, 0xe8, 0xe8, 0xe8, 0x13, 0xe8, 0xe8, 0xe8, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe6, 0xe6, 0xe6, 0x13, 0xe6, 0xe6, 0xe6, 0x13, 0xe6, 0xe6, 0xe6, 0x14, 0xe6, 0xe6, 0xe6, 0x14, 0xe6, 0xe6, 0xe6, 0x13, 0xe6, 0xe6, 0xe6, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe7, 0xe7, 0xe7, 0x13, 0xe8, 0xe8, 0xe8, 0x13, 0xe8, 0xe8, 0xe8, 0x13, 0xe8, 0xe8, 0xe8, 0x13, 0xe8, 0xe8, 0xe8, 0x13, 0xe8, 0xe8, 0xe8, 0x13, 0xe8, 0xe8, 0xe8, 0x13, 0xe9, 0xe9, 0xe9, 0x10, 0xe9, 0xe9, 0xe9, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xeb, 0xeb, 0xeb, 0x10, 0xeb, 0xeb, 0xeb, 0x0f, 0xec, 0xec, 0xec, 0x0f, 0xec, 0xec, 0xec, 0x0f, 0xec, 0xec, 0xec, 0x0f, 0xec, 0xec, 0xec, 0x0f, 0xec, 0xec, 0xec, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0c, 0xed, 0xed, 0xed, 0x0c, 0xee, 0xee, 0xee, 0x0c, 0xee, 0xee, 0xee, 0x0c, 0xef, 0xef, 0xef, 0x0c, 0xef, 0xef, 0xef, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf1, 0xf1, 0xf1, 0x0b, 0xf2, 0xf2, 0xf2, 0x0b, 0xf3, 0xf3, 0xf3, 0x0b, 0xf4, 0xf4, 0xf4, 0x0b, 0xf3, 0xf3, 0xf3, 0x0b, 0xf3, 0xf3, 0xf3, 0x10, 0xed, 0xed, 0xed, 0x1b, 0xe3, 0xe3, 0xe3, 0x30, 0xc4, 0xc4, 0xc4, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0x44, 0xb8, 0xb8, 0xb8, 0x77, 0xbd, 0xbd, 0xbd, 0x5b, 0xc0, 0xc0, 0xc0, 0x48, 0xc4, 0xc4, 0xc4, 0x3f, 0xc8, 0xc8, 0xc8, 0x34, 0xcc, 0xcc, 0xcc, 0x2c, 0xcf, 0xcf, 0xcf, 0x27, 0xd1, 0xd1, 0xd1, 0x23, 0xd3, 0xd3, 0xd3, 0x20, 0xd5, 0xd5, 0xd5, 0x1c, 0xd7, 0xd7, 0xd7, 0x1b, 0xd9, 0xd9, 0xd9, 0x17, 0xda, 0xda, 0xda, 0x17, 0xdc, 0xdc, 0xdc, 0x14, 0xf4, 0xf4, 0xf4, 0x34, 0xfc, 0xfc, 0xfc, 0x7b, 0xfc, 0xfc, 0xfc, 0x74, 0xfd, 0xfd, 0xfd, 0x70, 0xfd, 0xfd, 0xfd, 0x6c, 0xfc, 0xfc, 0xfc, 0x68, 0xfc, 0xfc, 0xfc, 0x64, 0xfc, 0xfc, 0xfc, 0x5f, 0xfd, 0xfd, 0xfd, 0x5b, 0xfc, 0xfc, 0xfc, 0x57, 0xfd, 0xfd, 0xfd, 0x53, 0xfc, 0xfc, 0xfc, 0x4f, 0xfc, 0xfc, 0xfc, 0x4b, 0xfc, 0xfc, 0xfc, 0x47, 0xfc, 0xfc, 0xfc, 0x43, 0xfb, 0xfb, 0xfb, 0x3f, 0xfb, 0xfb, 0xfb, 0x38, 0xfb, 0xfb, 0xfb, 0x37, 0xf9, 0xf9, 0xf9, 0x2b, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xec, 0xec, 0xec, 0x0f, 0xec, 0xec, 0xec, 0x0f, 0xec, 0xec, 0xec, 0x0f, 0xec, 0xec, 0xec, 0x0f, 0xeb, 0xeb, 0xeb, 0x10, 0xeb, 0xeb, 0xeb, 0x10, 0xeb, 0xeb, 0xeb, 0x10, 0xeb, 0xeb, 0xeb, 0x10, 0xeb, 0xeb, 0xeb, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xe9, 0xe9, 0xe9, 0x10, 0xe9, 0xe9, 0xe9, 0x10, 0xe9, 0xe9, 0xe9, 0x10, 0xe9, 0xe9, 0xe9, 0x10, 0xe9, 0xe9, 0xe9, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xeb, 0xeb, 0xeb, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xea, 0xea, 0xea, 0x10, 0xeb, 0xeb, 0xeb, 0x10, 0xeb, 0xeb, 0xeb, 0x10, 0xeb, 0xeb, 0xeb, 0x10, 0xeb, 0xeb, 0xeb, 0x0f, 0xec, 0xec, 0xec, 0x0f, 0xec, 0xec, 0xec, 0x0f, 0xec, 0xec, 0xec, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xee, 0xee, 0xee, 0x0f, 0xee, 0xee, 0xee, 0x0f, 0xee, 0xee, 0xee, 0x0c, 0xef, 0xef, 0xef, 0x0c, 0xef, 0xef, 0xef, 0x0c, 0xef, 0xef, 0xef, 0x0c, 0xef, 0xef, 0xef, 0x0c, 0xef, 0xef, 0xef, 0x0c, 0xf0, 0xf0, 0xf0, 0x0b, 0xf0, 0xf0, 0xf0, 0x0b, 0xf1, 0xf1, 0xf1, 0x0b, 0xf1, 0xf1, 0xf1, 0x0b, 0xf2, 0xf2, 0xf2, 0x0b, 0xf2, 0xf2, 0xf2, 0x0b, 0xf3, 0xf3, 0xf3, 0x08, 0xf3, 0xf3, 0xf3, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf5, 0xf5, 0xf5, 0x08, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x08, 0xf6, 0xf6, 0xf6, 0x08, 0xf5, 0xf5, 0xf5, 0x0f, 0xee, 0xee, 0xee, 0x1b, 0xe1, 0xe1, 0xe1, 0x37, 0xc1, 0xc1, 0xc1, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xb2, 0xb2, 0x2f, 0xb7, 0xb7, 0xb7, 0x7b, 0xbd, 0xbd, 0xbd, 0x5f, 0xbf, 0xbf, 0xbf, 0x4c, 0xc4, 0xc4, 0xc4, 0x3f, 0xc8, 0xc8, 0xc8, 0x37, 0xcc, 0xcc, 0xcc, 0x2f, 0xcf, 0xcf, 0xcf, 0x27, 0xd2, 0xd2, 0xd2, 0x23, 0xd3, 0xd3, 0xd3, 0x20, 0xd6, 0xd6, 0xd6, 0x1c, 0xd8, 0xd8, 0xd8, 0x18, 0xda, 0xda, 0xda, 0x17, 0xdc, 0xdc, 0xdc, 0x14, 0xde, 0xde, 0xde, 0x13, 0xf2, 0xf2, 0xf2, 0x27, 0xfd, 0xfd, 0xfd, 0x78, 0xfd, 0xfd, 0xfd, 0x74, 0xfd, 0xfd, 0xfd, 0x6f, 0xfd, 0xfd, 0xfd, 0x6b, 0xfd, 0xfd, 0xfd, 0x67, 0xfd, 0xfd, 0xfd, 0x63, 0xfd, 0xfd, 0xfd, 0x5c, 0xfd, 0xfd, 0xfd, 0x58, 0xfd, 0xfd, 0xfd, 0x54, 0xfd, 0xfd, 0xfd, 0x50, 0xfd, 0xfd, 0xfd, 0x4c, 0xfd, 0xfd, 0xfd, 0x48, 0xfd, 0xfd, 0xfd, 0x44, 0xfd, 0xfd, 0xfd, 0x40, 0xfc, 0xfc, 0xfc, 0x3c, 0xfc, 0xfc, 0xfc, 0x37, 0xfc, 0xfc, 0xfc, 0x33, 0xfb, 0xfb, 0xfb, 0x27, 0xf0, 0xf0, 0xf0, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xef, 0xef, 0xef, 0x0c, 0xef, 0xef, 0xef, 0x0c, 0xef, 0xef, 0xef, 0x0c, 0xef, 0xef, 0xef, 0x0c, 0xef, 0xef, 0xef, 0x0c, 0xef, 0xef, 0xef, 0x0c, 0xef, 0xef, 0xef, 0x0c, 0xee, 0xee, 0xee, 0x0c, 0xee, 0xee, 0xee, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xee, 0xee, 0xee, 0x0f, 0xee, 0xee, 0xee, 0x0f, 0xee, 0xee, 0xee, 0x0f, 0xee, 0xee, 0xee, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xed, 0xed, 0xed, 0x0f, 0xee, 0xee, 0xee, 0x0f, 0xee, 0xee, 0xee, 0x0f, 0xee, 0xee, 0xee, 0x0c, 0xef, 0xef, 0xef, 0x0c, 0xef, 0xef, 0xef, 0x0c, 0xef, 0xef, 0xef, 0x0c, 0xef, 0xef, 0xef, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf1, 0xf1, 0xf1, 0x0c, 0xf1, 0xf1, 0xf1, 0x0b, 0xf1, 0xf1, 0xf1, 0x0b, 0xf1, 0xf1, 0xf1, 0x0b, 0xf2, 0xf2, 0xf2, 0x0b, 0xf2, 0xf2, 0xf2, 0x0b, 0xf2, 0xf2, 0xf2, 0x0b, 0xf3, 0xf3, 0xf3, 0x08, 0xf3, 0xf3, 0xf3, 0x08, 0xf3, 0xf3, 0xf3, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf5, 0xf5, 0xf5, 0x08, 0xf5, 0xf5, 0xf5, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf7, 0xf7, 0xf7, 0x07, 0xf7, 0xf7, 0xf7, 0x07, 0xf8, 0xf8, 0xf8, 0x07, 0xf8, 0xf8, 0xf8, 0x07, 0xf7, 0xf7, 0xf7, 0x08, 0xf6, 0xf6, 0xf6, 0x0f, 0xee, 0xee, 0xee, 0x1c, 0xde, 0xde, 0xde, 0x3c, 0xbf, 0xbf, 0xbf, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xb1, 0xb1, 0x17, 0xb6, 0xb6, 0xb6, 0x80, 0xbc, 0xbc, 0xbc, 0x60, 0xbf, 0xbf, 0xbf, 0x4f, 0xc4, 0xc4, 0xc4, 0x40, 0xc8, 0xc8, 0xc8, 0x38, 0xcd, 0xcd, 0xcd, 0x2f, 0xd0, 0xd0, 0xd0, 0x27, 0xd2, 0xd2, 0xd2, 0x23, 0xd4, 0xd4, 0xd4, 0x1f, 0xd6, 0xd6, 0xd6, 0x1c, 0xd9, 0xd9, 0xd9, 0x18, 0xdb, 0xdb, 0xdb, 0x14, 0xdd, 0xdd, 0xdd, 0x13, 0xdf, 0xdf, 0xdf, 0x13, 0xee, 0xee, 0xee, 0x1b, 0xfd, 0xfd, 0xfd, 0x78, 0xfd, 0xfd, 0xfd, 0x73, 0xfd, 0xfd, 0xfd, 0x6f, 0xfd, 0xfd, 0xfd, 0x6b, 0xfd, 0xfd, 0xfd, 0x64, 0xfd, 0xfd, 0xfd, 0x60, 0xfe, 0xfe, 0xfe, 0x5c, 0xfe, 0xfe, 0xfe, 0x57, 0xfe, 0xfe, 0xfe, 0x53, 0xfe, 0xfe, 0xfe, 0x4f, 0xfe, 0xfe, 0xfe, 0x4b, 0xfe, 0xfe, 0xfe, 0x47, 0xfd, 0xfd, 0xfd, 0x43, 0xfd, 0xfd, 0xfd, 0x3f, 0xfd, 0xfd, 0xfd, 0x38, 0xfd, 0xfd, 0xfd, 0x34, 0xfd, 0xfd, 0xfd, 0x30, 0xfc, 0xfc, 0xfc, 0x27, 0xf3, 0xf3, 0xf3, 0x0b, 0xf3, 0xf3, 0xf3, 0x0b, 0xf3, 0xf3, 0xf3, 0x0b, 0xf2, 0xf2, 0xf2, 0x0b, 0xf2, 0xf2, 0xf2, 0x0b, 0xf2, 0xf2, 0xf2, 0x0b, 0xf2, 0xf2, 0xf2, 0x0b, 0xf2, 0xf2, 0xf2, 0x0b, 0xf2, 0xf2, 0xf2, 0x0b, 0xf1, 0xf1, 0xf1, 0x0b, 0xf1, 0xf1, 0xf1, 0x0b, 0xf1, 0xf1, 0xf1, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf1, 0xf1, 0xf1, 0x0c, 0xf1, 0xf1, 0xf1, 0x0c, 0xf1, 0xf1, 0xf1, 0x0c, 0xf1, 0xf1, 0xf1, 0x0b, 0xf1, 0xf1, 0xf1, 0x0b, 0xf1, 0xf1, 0xf1, 0x0b, 0xf1, 0xf1, 0xf1, 0x0b, 0xf1, 0xf1, 0xf1, 0x0c, 0xf0, 0xf0, 0xf0, 0x0c, 0xf1, 0xf1, 0xf1, 0x0c, 0xf1, 0xf1, 0xf1, 0x0b, 0xf1, 0xf1, 0xf1, 0x0b, 0xf2, 0xf2, 0xf2, 0x0b, 0xf2, 0xf2, 0xf2, 0x0b, 0xf2, 0xf2, 0xf2, 0x0b, 0xf2, 0xf2, 0xf2, 0x0b, 0xf2, 0xf2, 0xf2, 0x0b, 0xf3, 0xf3, 0xf3, 0x0b, 0xf3, 0xf3, 0xf3, 0x0b, 0xf3, 0xf3, 0xf3, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf5, 0xf5, 0xf5, 0x08, 0xf5, 0xf5, 0xf5, 0x08, 0xf5, 0xf5, 0xf5, 0x08, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf7, 0xf7, 0xf7, 0x04, 0xf7, 0xf7, 0xf7, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xfa, 0xfa, 0xfa, 0x04, 0xfa, 0xfa, 0xfa, 0x04, 0xfa, 0xfa, 0xfa, 0x04, 0xf8, 0xf8, 0xf8, 0x07, 0xf6, 0xf6, 0xf6, 0x0f, 0xee, 0xee, 0xee, 0x1f, 0xdb, 0xdb, 0xdb, 0x43, 0xba, 0xba, 0xba, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xb0, 0xb0, 0x07, 0xb5, 0xb5, 0xb5, 0x7f, 0xbc, 0xbc, 0xbc, 0x63, 0xc0, 0xc0, 0xc0, 0x50, 0xc4, 0xc4, 0xc4, 0x43, 0xc8, 0xc8, 0xc8, 0x38, 0xcd, 0xcd, 0xcd, 0x2f, 0xd0, 0xd0, 0xd0, 0x27, 0xd2, 0xd2, 0xd2, 0x24, 0xd5, 0xd5, 0xd5, 0x1f, 0xd7, 0xd7, 0xd7, 0x1c, 0xd9, 0xd9, 0xd9, 0x18, 0xdc, 0xdc, 0xdc, 0x14, 0xde, 0xde, 0xde, 0x13, 0xe0, 0xe0, 0xe0, 0x10, 0xe9, 0xe9, 0xe9, 0x14, 0xfd, 0xfd, 0xfd, 0x73, 0xfd, 0xfd, 0xfd, 0x73, 0xfe, 0xfe, 0xfe, 0x6c, 0xfe, 0xfe, 0xfe, 0x68, 0xfe, 0xfe, 0xfe, 0x64, 0xfe, 0xfe, 0xfe, 0x60, 0xfe, 0xfe, 0xfe, 0x5b, 0xfe, 0xfe, 0xfe, 0x57, 0xfe, 0xfe, 0xfe, 0x53, 0xfe, 0xfe, 0xfe, 0x4c, 0xfe, 0xfe, 0xfe, 0x48, 0xfe, 0xfe, 0xfe, 0x44, 0xfe, 0xfe, 0xfe, 0x40, 0xfe, 0xfe, 0xfe, 0x3c, 0xfe, 0xfe, 0xfe, 0x38, 0xfe, 0xfe, 0xfe, 0x34, 0xfe, 0xfe, 0xfe, 0x30, 0xfe, 0xfe, 0xfe, 0x28, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x08, 0xf5, 0xf5, 0xf5, 0x08, 0xf5, 0xf5, 0xf5, 0x08, 0xf5, 0xf5, 0xf5, 0x08, 0xf5, 0xf5, 0xf5, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf3, 0xf3, 0xf3, 0x08, 0xf3, 0xf3, 0xf3, 0x08, 0xf3, 0xf3, 0xf3, 0x0b, 0xf3, 0xf3, 0xf3, 0x0b, 0xf3, 0xf3, 0xf3, 0x0b, 0xf3, 0xf3, 0xf3, 0x0b, 0xf3, 0xf3, 0xf3, 0x0b, 0xf3, 0xf3, 0xf3, 0x0b, 0xf3, 0xf3, 0xf3, 0x0b, 0xf3, 0xf3, 0xf3, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf4, 0xf4, 0xf4, 0x08, 0xf5, 0xf5, 0xf5, 0x08, 0xf5, 0xf5, 0xf5, 0x08, 0xf5, 0xf5, 0xf5, 0x08, 0xf5, 0xf5, 0xf5, 0x08, 0xf5, 0xf5, 0xf5, 0x08, 0xf5, 0xf5, 0xf5, 0x08, 0xf6, 0xf6, 0xf6, 0x08, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf7, 0xf7, 0xf7, 0x07, 0xf7, 0xf7, 0xf7, 0x07, 0xf7, 0xf7, 0xf7, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xfa, 0xfa, 0xfa, 0x04, 0xfa, 0xfa, 0xfa, 0x04, 0xfb, 0xfb, 0xfb, 0x04, 0xfb, 0xfb, 0xfb, 0x04, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfb, 0xfb, 0xfb, 0x04, 0xf9, 0xf9, 0xf9, 0x07, 0xf6, 0xf6, 0xf6, 0x0f, 0xed, 0xed, 0xed, 0x20, 0xd2, 0xd2, 0xd2, 0x4f, 0xb2, 0xb2, 0xb2, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xb0, 0xb0, 0x00, 0xb5, 0xb5, 0xb5, 0x70, 0xbd, 0xbd, 0xbd, 0x67, 0xc0, 0xc0, 0xc0, 0x53, 0xc4, 0xc4, 0xc4, 0x43, 0xc8, 0xc8, 0xc8, 0x3b, 0xcd, 0xcd, 0xcd, 0x30, 0xd0, 0xd0, 0xd0, 0x28, 0xd2, 0xd2, 0xd2, 0x23, 0xd5, 0xd5, 0xd5, 0x1f, 0xd8, 0xd8, 0xd8, 0x1b, 0xda, 0xda, 0xda, 0x18, 0xdd, 0xdd, 0xdd, 0x14, 0xdf, 0xdf, 0xdf, 0x13, 0xe1, 0xe1, 0xe1, 0x10, 0xe5, 0xe5, 0xe5, 0x10, 0xfd, 0xfd, 0xfd, 0x6b, 0xfe, 0xfe, 0xfe, 0x73, 0xfe, 0xfe, 0xfe, 0x6c, 0xfe, 0xfe, 0xfe, 0x68, 0xfe, 0xfe, 0xfe, 0x63, 0xfe, 0xfe, 0xfe, 0x5f, 0xfe, 0xfe, 0xfe, 0x5b, 0xfe, 0xfe, 0xfe, 0x57, 0xfe, 0xfe, 0xfe, 0x50, 0xfe, 0xfe, 0xfe, 0x4c, 0xfe, 0xfe, 0xfe, 0x48, 0xfe, 0xfe, 0xfe, 0x44, 0xfe, 0xfe, 0xfe, 0x40, 0xfe, 0xfe, 0xfe, 0x3b, 0xfe, 0xfe, 0xfe, 0x37, 0xfe, 0xfe, 0xfe, 0x33, 0xfe, 0xfe, 0xfe, 0x2f, 0xfe, 0xfe, 0xfe, 0x28, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf7, 0xf7, 0xf7, 0x04, 0xf7, 0xf7, 0xf7, 0x07, 0xf7, 0xf7, 0xf7, 0x07, 0xf7, 0xf7, 0xf7, 0x07, 0xf7, 0xf7, 0xf7, 0x07, 0xf7, 0xf7, 0xf7, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf6, 0xf6, 0xf6, 0x07, 0xf7, 0xf7, 0xf7, 0x07, 0xf7, 0xf7, 0xf7, 0x07, 0xf7, 0xf7, 0xf7, 0x07, 0xf7, 0xf7, 0xf7, 0x07, 0xf7, 0xf7, 0xf7, 0x07, 0xf7, 0xf7, 0xf7, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x03, 0xf9, 0xf9, 0xf9, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfd, 0xfd, 0xfd, 0x03, 0xfd, 0xfd, 0xfd, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfa, 0xfa, 0xfa, 0x07, 0xf5, 0xf5, 0xf5, 0x10, 0xeb, 0xeb, 0xeb, 0x24, 0xca, 0xca, 0xca, 0x57, 0xb0, 0xb0, 0xb0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xb5, 0xb5, 0x5f, 0xbe, 0xbe, 0xbe, 0x68, 0xc1, 0xc1, 0xc1, 0x53, 0xc5, 0xc5, 0xc5, 0x44, 0xc9, 0xc9, 0xc9, 0x3b, 0xcd, 0xcd, 0xcd, 0x30, 0xd1, 0xd1, 0xd1, 0x28, 0xd3, 0xd3, 0xd3, 0x23, 0xd6, 0xd6, 0xd6, 0x1f, 0xd8, 0xd8, 0xd8, 0x1b, 0xdb, 0xdb, 0xdb, 0x17, 0xde, 0xde, 0xde, 0x13, 0xe0, 0xe0, 0xe0, 0x10, 0xe2, 0xe2, 0xe2, 0x0f, 0xe4, 0xe4, 0xe4, 0x0f, 0xfd, 0xfd, 0xfd, 0x60, 0xfe, 0xfe, 0xfe, 0x70, 0xfe, 0xfe, 0xfe, 0x6c, 0xfe, 0xfe, 0xfe, 0x68, 0xfe, 0xfe, 0xfe, 0x63, 0xfe, 0xfe, 0xfe, 0x5f, 0xfe, 0xfe, 0xfe, 0x5b, 0xfe, 0xfe, 0xfe, 0x54, 0xfe, 0xfe, 0xfe, 0x50, 0xfe, 0xfe, 0xfe, 0x4c, 0xfe, 0xfe, 0xfe, 0x48, 0xfe, 0xfe, 0xfe, 0x43, 0xfe, 0xfe, 0xfe, 0x3f, 0xfe, 0xfe, 0xfe, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xfe, 0xfe, 0xfe, 0x30, 0xff, 0xff, 0xff, 0x2c, 0xff, 0xff, 0xff, 0x28, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf8, 0xf8, 0xf8, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xfa, 0xfa, 0xfa, 0x04, 0xfa, 0xfa, 0xfa, 0x04, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfd, 0xfd, 0xfd, 0x03, 0xfd, 0xfd, 0xfd, 0x03, 0xfd, 0xfd, 0xfd, 0x03, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xfa, 0xfa, 0xfa, 0x08, 0xf4, 0xf4, 0xf4, 0x13, 0xe8, 0xe8, 0xe8, 0x2b, 0xc7, 0xc7, 0xc7, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xb5, 0xb5, 0x4b, 0xbe, 0xbe, 0xbe, 0x6c, 0xc2, 0xc2, 0xc2, 0x54, 0xc7, 0xc7, 0xc7, 0x44, 0xcb, 0xcb, 0xcb, 0x3b, 0xce, 0xce, 0xce, 0x30, 0xd2, 0xd2, 0xd2, 0x28, 0xd4, 0xd4, 0xd4, 0x23, 0xd7, 0xd7, 0xd7, 0x1f, 0xd9, 0xd9, 0xd9, 0x1b, 0xdc, 0xdc, 0xdc, 0x17, 0xde, 0xde, 0xde, 0x13, 0xe1, 0xe1, 0xe1, 0x10, 0xe3, 0xe3, 0xe3, 0x0f, 0xe4, 0xe4, 0xe4, 0x0c, 0xfd, 0xfd, 0xfd, 0x57, 0xfe, 0xfe, 0xfe, 0x70, 0xfe, 0xfe, 0xfe, 0x6c, 0xfe, 0xfe, 0xfe, 0x67, 0xfe, 0xfe, 0xfe, 0x63, 0xfe, 0xfe, 0xfe, 0x5f, 0xfe, 0xfe, 0xfe, 0x58, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0x47, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x34, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0x2c, 0xff, 0xff, 0xff, 0x27, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x04, 0xfa, 0xfa, 0xfa, 0x04, 0xfa, 0xfa, 0xfa, 0x04, 0xfa, 0xfa, 0xfa, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xfa, 0xfa, 0xfa, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xfa, 0xfa, 0xfa, 0x04, 0xfa, 0xfa, 0xfa, 0x04, 0xfa, 0xfa, 0xfa, 0x04, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xf9, 0xf9, 0xf9, 0x08, 0xf2, 0xf2, 0xf2, 0x17, 0xe4, 0xe4, 0xe4, 0x30, 0xc3, 0xc3, 0xc3, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0x34, 0xbd, 0xbd, 0xbd, 0x70, 0xc4, 0xc4, 0xc4, 0x54, 0xc8, 0xc8, 0xc8, 0x44, 0xcd, 0xcd, 0xcd, 0x38, 0xd0, 0xd0, 0xd0, 0x30, 0xd2, 0xd2, 0xd2, 0x28, 0xd5, 0xd5, 0xd5, 0x23, 0xd8, 0xd8, 0xd8, 0x1f, 0xda, 0xda, 0xda, 0x1b, 0xdd, 0xdd, 0xdd, 0x17, 0xdf, 0xdf, 0xdf, 0x13, 0xe1, 0xe1, 0xe1, 0x0f, 0xe4, 0xe4, 0xe4, 0x0f, 0xe5, 0xe5, 0xe5, 0x0c, 0xfc, 0xfc, 0xfc, 0x4b, 0xfe, 0xfe, 0xfe, 0x70, 0xfe, 0xfe, 0xfe, 0x6b, 0xfe, 0xfe, 0xfe, 0x67, 0xfe, 0xfe, 0xfe, 0x60, 0xff, 0xff, 0xff, 0x5c, 0xff, 0xff, 0xff, 0x58, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0x47, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0x38, 0xff, 0xff, 0xff, 0x34, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0x2c, 0xff, 0xff, 0xff, 0x27, 0xfe, 0xfe, 0xfe, 0x07, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfb, 0xfb, 0xfb, 0x04, 0xf8, 0xf8, 0xf8, 0x0b, 0xf1, 0xf1, 0xf1, 0x18, 0xe2, 0xe2, 0xe2, 0x37, 0xc0, 0xc0, 0xc0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xb2, 0xb2, 0x1c, 0xbd, 0xbd, 0xbd, 0x77, 0xc5, 0xc5, 0xc5, 0x57, 0xca, 0xca, 0xca, 0x44, 0xcf, 0xcf, 0xcf, 0x38, 0xd2, 0xd2, 0xd2, 0x30, 0xd4, 0xd4, 0xd4, 0x28, 0xd6, 0xd6, 0xd6, 0x23, 0xd9, 0xd9, 0xd9, 0x1c, 0xdb, 0xdb, 0xdb, 0x18, 0xde, 0xde, 0xde, 0x14, 0xe0, 0xe0, 0xe0, 0x10, 0xe2, 0xe2, 0xe2, 0x0f, 0xe4, 0xe4, 0xe4, 0x0c, 0xe6, 0xe6, 0xe6, 0x0b, 0xfc, 0xfc, 0xfc, 0x3f, 0xfe, 0xfe, 0xfe, 0x70, 0xfe, 0xfe, 0xfe, 0x6b, 0xff, 0xff, 0xff, 0x67, 0xfe, 0xfe, 0xfe, 0x60, 0xff, 0xff, 0xff, 0x5c, 0xff, 0xff, 0xff, 0x58, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0x38, 0xff, 0xff, 0xff, 0x34, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x27, 0xfe, 0xfe, 0xfe, 0x07, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfb, 0xfb, 0xfb, 0x04, 0xf7, 0xf7, 0xf7, 0x0b, 0xf0, 0xf0, 0xf0, 0x1c, 0xdc, 0xdc, 0xdc, 0x40, 0xba, 0xba, 0xba, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xb1, 0xb1, 0x08, 0xbb, 0xbb, 0xbb, 0x78, 0xc6, 0xc6, 0xc6, 0x57, 0xcc, 0xcc, 0xcc, 0x47, 0xd0, 0xd0, 0xd0, 0x38, 0xd2, 0xd2, 0xd2, 0x30, 0xd5, 0xd5, 0xd5, 0x28, 0xd8, 0xd8, 0xd8, 0x20, 0xda, 0xda, 0xda, 0x1c, 0xdc, 0xdc, 0xdc, 0x18, 0xdf, 0xdf, 0xdf, 0x14, 0xe1, 0xe1, 0xe1, 0x10, 0xe3, 0xe3, 0xe3, 0x0f, 0xe5, 0xe5, 0xe5, 0x0c, 0xe7, 0xe7, 0xe7, 0x0b, 0xfc, 0xfc, 0xfc, 0x34, 0xfe, 0xfe, 0xfe, 0x70, 0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x60, 0xff, 0xff, 0xff, 0x5c, 0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0x38, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0x07, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfb, 0xfb, 0xfb, 0x04, 0xf6, 0xf6, 0xf6, 0x0c, 0xee, 0xee, 0xee, 0x1f, 0xd5, 0xd5, 0xd5, 0x4b, 0xb3, 0xb3, 0xb3, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xb0, 0xb0, 0x00, 0xba, 0xba, 0xba, 0x6f, 0xc8, 0xc8, 0xc8, 0x58, 0xce, 0xce, 0xce, 0x44, 0xd2, 0xd2, 0xd2, 0x38, 0xd4, 0xd4, 0xd4, 0x30, 0xd7, 0xd7, 0xd7, 0x27, 0xd9, 0xd9, 0xd9, 0x20, 0xdc, 0xdc, 0xdc, 0x1c, 0xde, 0xde, 0xde, 0x18, 0xe0, 0xe0, 0xe0, 0x14, 0xe2, 0xe2, 0xe2, 0x10, 0xe4, 0xe4, 0xe4, 0x0c, 0xe6, 0xe6, 0xe6, 0x0c, 0xe8, 0xe8, 0xe8, 0x0b, 0xfb, 0xfb, 0xfb, 0x28, 0xfe, 0xfe, 0xfe, 0x6f, 0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x60, 0xff, 0xff, 0xff, 0x5c, 0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xfb, 0xfb, 0xfb, 0x07, 0xf6, 0xf6, 0xf6, 0x0f, 0xec, 0xec, 0xec, 0x23, 0xcc, 0xcc, 0xcc, 0x57, 0xb0, 0xb0, 0xb0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xb9, 0xb9, 0x5c, 0xc8, 0xc8, 0xc8, 0x5b, 0xcf, 0xcf, 0xcf, 0x44, 0xd3, 0xd3, 0xd3, 0x37, 0xd5, 0xd5, 0xd5, 0x2f, 0xd8, 0xd8, 0xd8, 0x27, 0xdb, 0xdb, 0xdb, 0x20, 0xdd, 0xdd, 0xdd, 0x1c, 0xdf, 0xdf, 0xdf, 0x18, 0xe1, 0xe1, 0xe1, 0x14, 0xe3, 0xe3, 0xe3, 0x10, 0xe4, 0xe4, 0xe4, 0x0c, 0xe7, 0xe7, 0xe7, 0x0b, 0xe9, 0xe9, 0xe9, 0x08, 0xfa, 0xfa, 0xfa, 0x1c, 0xfe, 0xfe, 0xfe, 0x6f, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x60, 0xff, 0xff, 0xff, 0x5c, 0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xfa, 0xfa, 0xfa, 0x07, 0xf5, 0xf5, 0xf5, 0x13, 0xe9, 0xe9, 0xe9, 0x28, 0xc7, 0xc7, 0xc7, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xb9, 0xb9, 0x4b, 0xc8, 0xc8, 0xc8, 0x5c, 0xd1, 0xd1, 0xd1, 0x43, 0xd5, 0xd5, 0xd5, 0x34, 0xd8, 0xd8, 0xd8, 0x2c, 0xda, 0xda, 0xda, 0x24, 0xdd, 0xdd, 0xdd, 0x1f, 0xde, 0xde, 0xde, 0x1b, 0xe0, 0xe0, 0xe0, 0x17, 0xe2, 0xe2, 0xe2, 0x14, 0xe4, 0xe4, 0xe4, 0x10, 0xe5, 0xe5, 0xe5, 0x0c, 0xe7, 0xe7, 0xe7, 0x0b, 0xea, 0xea, 0xea, 0x08, 0xf7, 0xf7, 0xf7, 0x13, 0xfe, 0xfe, 0xfe, 0x6f, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x60, 0xff, 0xff, 0xff, 0x5c, 0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xfa, 0xfa, 0xfa, 0x08, 0xf4, 0xf4, 0xf4, 0x14, 0xe6, 0xe6, 0xe6, 0x2c, 0xc4, 0xc4, 0xc4, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xb7, 0xb7, 0x37, 0xc8, 0xc8, 0xc8, 0x60, 0xd2, 0xd2, 0xd2, 0x43, 0xd7, 0xd7, 0xd7, 0x33, 0xda, 0xda, 0xda, 0x2b, 0xdc, 0xdc, 0xdc, 0x23, 0xdf, 0xdf, 0xdf, 0x1c, 0xe0, 0xe0, 0xe0, 0x1b, 0xe2, 0xe2, 0xe2, 0x17, 0xe4, 0xe4, 0xe4, 0x13, 0xe4, 0xe4, 0xe4, 0x10, 0xe6, 0xe6, 0xe6, 0x0c, 0xe8, 0xe8, 0xe8, 0x0b, 0xea, 0xea, 0xea, 0x08, 0xf5, 0xf5, 0xf5, 0x0b, 0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x60, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xf9, 0xf9, 0xf9, 0x08, 0xf2, 0xf2, 0xf2, 0x17, 0xe3, 0xe3, 0xe3, 0x33, 0xc0, 0xc0, 0xc0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0x23, 0xc7, 0xc7, 0xc7, 0x64, 0xd4, 0xd4, 0xd4, 0x43, 0xd9, 0xd9, 0xd9, 0x33, 0xdc, 0xdc, 0xdc, 0x28, 0xdf, 0xdf, 0xdf, 0x20, 0xe1, 0xe1, 0xe1, 0x1c, 0xe3, 0xe3, 0xe3, 0x18, 0xe4, 0xe4, 0xe4, 0x14, 0xe4, 0xe4, 0xe4, 0x13, 0xe6, 0xe6, 0xe6, 0x0f, 0xe8, 0xe8, 0xe8, 0x0b, 0xe9, 0xe9, 0xe9, 0x08, 0xeb, 0xeb, 0xeb, 0x08, 0xf0, 0xf0, 0xf0, 0x07, 0xff, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x60, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfb, 0xfb, 0xfb, 0x04, 0xf8, 0xf8, 0xf8, 0x0b, 0xf1, 0xf1, 0xf1, 0x18, 0xdf, 0xdf, 0xdf, 0x3c, 0xbb, 0xbb, 0xbb, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xb4, 0xb4, 0x0b, 0xc4, 0xc4, 0xc4, 0x6c, 0xd6, 0xd6, 0xd6, 0x40, 0xdb, 0xdb, 0xdb, 0x30, 0xdf, 0xdf, 0xdf, 0x27, 0xe1, 0xe1, 0xe1, 0x20, 0xe4, 0xe4, 0xe4, 0x1b, 0xe4, 0xe4, 0xe4, 0x17, 0xe6, 0xe6, 0xe6, 0x13, 0xe6, 0xe6, 0xe6, 0x10, 0xe8, 0xe8, 0xe8, 0x0f, 0xea, 0xea, 0xea, 0x0b, 0xeb, 0xeb, 0xeb, 0x08, 0xec, 0xec, 0xec, 0x07, 0xee, 0xee, 0xee, 0x04, 0xff, 0xff, 0xff, 0x58, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x60, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfb, 0xfb, 0xfb, 0x04, 0xf7, 0xf7, 0xf7, 0x0c, 0xef, 0xef, 0xef, 0x1c, 0xd7, 0xd7, 0xd7, 0x47, 0xb5, 0xb5, 0xb5, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xb2, 0xb2, 0x03, 0xc1, 0xc1, 0xc1, 0x68, 0xd6, 0xd6, 0xd6, 0x44, 0xde, 0xde, 0xde, 0x30, 0xe2, 0xe2, 0xe2, 0x24, 0xe4, 0xe4, 0xe4, 0x1f, 0xe5, 0xe5, 0xe5, 0x18, 0xe7, 0xe7, 0xe7, 0x14, 0xe8, 0xe8, 0xe8, 0x13, 0xe9, 0xe9, 0xe9, 0x10, 0xea, 0xea, 0xea, 0x0c, 0xeb, 0xeb, 0xeb, 0x0b, 0xec, 0xec, 0xec, 0x08, 0xee, 0xee, 0xee, 0x07, 0xef, 0xef, 0xef, 0x04, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x60, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfb, 0xfb, 0xfb, 0x04, 0xf6, 0xf6, 0xf6, 0x0f, 0xed, 0xed, 0xed, 0x20, 0xcf, 0xcf, 0xcf, 0x53, 0xb0, 0xb0, 0xb0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x5b, 0xd6, 0xd6, 0xd6, 0x47, 0xe0, 0xe0, 0xe0, 0x2f, 0xe4, 0xe4, 0xe4, 0x23, 0xe6, 0xe6, 0xe6, 0x1c, 0xe7, 0xe7, 0xe7, 0x18, 0xe9, 0xe9, 0xe9, 0x13, 0xea, 0xea, 0xea, 0x10, 0xeb, 0xeb, 0xeb, 0x0f, 0xec, 0xec, 0xec, 0x0c, 0xed, 0xed, 0xed, 0x0b, 0xee, 0xee, 0xee, 0x07, 0xef, 0xef, 0xef, 0x07, 0xf0, 0xf0, 0xf0, 0x04, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xfb, 0xfb, 0xfb, 0x07, 0xf6, 0xf6, 0xf6, 0x10, 0xea, 0xea, 0xea, 0x24, 0xc9, 0xc9, 0xc9, 0x57, 0xb0, 0xb0, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x4b, 0xd5, 0xd5, 0xd5, 0x48, 0xe2, 0xe2, 0xe2, 0x2f, 0xe7, 0xe7, 0xe7, 0x20, 0xe9, 0xe9, 0xe9, 0x1b, 0xea, 0xea, 0xea, 0x14, 0xeb, 0xeb, 0xeb, 0x10, 0xec, 0xec, 0xec, 0x10, 0xed, 0xed, 0xed, 0x0c, 0xee, 0xee, 0xee, 0x0b, 0xef, 0xef, 0xef, 0x08, 0xef, 0xef, 0xef, 0x07, 0xf1, 0xf1, 0xf1, 0x07, 0xf2, 0xf2, 0xf2, 0x04, 0xfe, 0xfe, 0xfe, 0x38, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xfa, 0xfa, 0xfa, 0x07, 0xf5, 0xf5, 0xf5, 0x13, 0xe8, 0xe8, 0xe8, 0x2b, 0xc5, 0xc5, 0xc5, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x38, 0xd4, 0xd4, 0xd4, 0x4c, 0xe3, 0xe3, 0xe3, 0x2c, 0xe9, 0xe9, 0xe9, 0x1f, 0xeb, 0xeb, 0xeb, 0x18, 0xed, 0xed, 0xed, 0x13, 0xee, 0xee, 0xee, 0x10, 0xee, 0xee, 0xee, 0x0f, 0xef, 0xef, 0xef, 0x0c, 0xf0, 0xf0, 0xf0, 0x0b, 0xf0, 0xf0, 0xf0, 0x08, 0xf1, 0xf1, 0xf1, 0x07, 0xf2, 0xf2, 0xf2, 0x04, 0xf4, 0xf4, 0xf4, 0x04, 0xfe, 0xfe, 0xfe, 0x2f, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xf9, 0xf9, 0xf9, 0x08, 0xf3, 0xf3, 0xf3, 0x14, 0xe5, 0xe5, 0xe5, 0x30, 0xc2, 0xc2, 0xc2, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb6, 0xb6, 0x27, 0xd2, 0xd2, 0xd2, 0x54, 0xe4, 0xe4, 0xe4, 0x2c, 0xeb, 0xeb, 0xeb, 0x1c, 0xee, 0xee, 0xee, 0x14, 0xf0, 0xf0, 0xf0, 0x10, 0xf0, 0xf0, 0xf0, 0x0f, 0xf1, 0xf1, 0xf1, 0x0c, 0xf2, 0xf2, 0xf2, 0x0b, 0xf2, 0xf2, 0xf2, 0x08, 0xf3, 0xf3, 0xf3, 0x07, 0xf3, 0xf3, 0xf3, 0x07, 0xf4, 0xf4, 0xf4, 0x04, 0xf4, 0xf4, 0xf4, 0x04, 0xfe, 0xfe, 0xfe, 0x24, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xf9, 0xf9, 0xf9, 0x08, 0xf2, 0xf2, 0xf2, 0x18, 0xe1, 0xe1, 0xe1, 0x37, 0xbe, 0xbe, 0xbe, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0x0f, 0xcc, 0xcc, 0xcc, 0x5b, 0xe5, 0xe5, 0xe5, 0x2c, 0xed, 0xed, 0xed, 0x1c, 0xf0, 0xf0, 0xf0, 0x13, 0xf2, 0xf2, 0xf2, 0x0f, 0xf3, 0xf3, 0xf3, 0x0c, 0xf3, 0xf3, 0xf3, 0x0b, 0xf3, 0xf3, 0xf3, 0x08, 0xf4, 0xf4, 0xf4, 0x07, 0xf4, 0xf4, 0xf4, 0x07, 0xf4, 0xf4, 0xf4, 0x04, 0xf5, 0xf5, 0xf5, 0x04, 0xf6, 0xf6, 0xf6, 0x04, 0xfe, 0xfe, 0xfe, 0x18, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfb, 0xfb, 0xfb, 0x04, 0xf8, 0xf8, 0xf8, 0x0b, 0xf0, 0xf0, 0xf0, 0x1b, 0xd9, 0xd9, 0xd9, 0x43, 0xb9, 0xb9, 0xb9, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xb0, 0xb0, 0x04, 0xc6, 0xc6, 0xc6, 0x5c, 0xe4, 0xe4, 0xe4, 0x2c, 0xee, 0xee, 0xee, 0x18, 0xf3, 0xf3, 0xf3, 0x10, 0xf4, 0xf4, 0xf4, 0x0f, 0xf5, 0xf5, 0xf5, 0x0b, 0xf5, 0xf5, 0xf5, 0x08, 0xf6, 0xf6, 0xf6, 0x07, 0xf5, 0xf5, 0xf5, 0x04, 0xf6, 0xf6, 0xf6, 0x04, 0xf6, 0xf6, 0xf6, 0x04, 0xf6, 0xf6, 0xf6, 0x04, 0xf6, 0xf6, 0xf6, 0x04, 0xfe, 0xfe, 0xfe, 0x0f, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfb, 0xfb, 0xfb, 0x04, 0xf7, 0xf7, 0xf7, 0x0c, 0xee, 0xee, 0xee, 0x1f, 0xd4, 0xd4, 0xd4, 0x4c, 0xb0, 0xb0, 0xb0, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xc4, 0xc4, 0x53, 0xe3, 0xe3, 0xe3, 0x2f, 0xee, 0xee, 0xee, 0x18, 0xf4, 0xf4, 0xf4, 0x0f, 0xf6, 0xf6, 0xf6, 0x0b, 0xf6, 0xf6, 0xf6, 0x08, 0xf7, 0xf7, 0xf7, 0x07, 0xf7, 0xf7, 0xf7, 0x04, 0xf7, 0xf7, 0xf7, 0x04, 0xf7, 0xf7, 0xf7, 0x04, 0xf7, 0xf7, 0xf7, 0x04, 0xf7, 0xf7, 0xf7, 0x04, 0xf7, 0xf7, 0xf7, 0x03, 0xfd, 0xfd, 0xfd, 0x07, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfb, 0xfb, 0xfb, 0x04, 0xf6, 0xf6, 0xf6, 0x0f, 0xec, 0xec, 0xec, 0x23, 0xcb, 0xcb, 0xcb, 0x54, 0xb0, 0xb0, 0xb0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xc3, 0xc3, 0x48, 0xdf, 0xdf, 0xdf, 0x34, 0xee, 0xee, 0xee, 0x18, 0xf5, 0xf5, 0xf5, 0x0f, 0xf6, 0xf6, 0xf6, 0x08, 0xf8, 0xf8, 0xf8, 0x07, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x04, 0xf9, 0xf9, 0xf9, 0x03, 0xf8, 0xf8, 0xf8, 0x03, 0xf9, 0xf9, 0xf9, 0x03, 0xf9, 0xf9, 0xf9, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xff, 0xff, 0xff, 0x5c, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xfa, 0xfa, 0xfa, 0x07, 0xf5, 0xf5, 0xf5, 0x10, 0xe9, 0xe9, 0xe9, 0x27, 0xc7, 0xc7, 0xc7, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xbd, 0xbd, 0x3b, 0xdd, 0xdd, 0xdd, 0x3b, 0xee, 0xee, 0xee, 0x1b, 0xf6, 0xf6, 0xf6, 0x0f, 0xf7, 0xf7, 0xf7, 0x08, 0xf9, 0xf9, 0xf9, 0x07, 0xfa, 0xfa, 0xfa, 0x04, 0xfa, 0xfa, 0xfa, 0x04, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfa, 0xfa, 0xfa, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x00, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xfa, 0xfa, 0xfa, 0x07, 0xf4, 0xf4, 0xf4, 0x13, 0xe6, 0xe6, 0xe6, 0x2f, 0xc5, 0xc5, 0xc5, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xb9, 0xb9, 0x2b, 0xd8, 0xd8, 0xd8, 0x44, 0xee, 0xee, 0xee, 0x1c, 0xf6, 0xf6, 0xf6, 0x0c, 0xf8, 0xf8, 0xf8, 0x07, 0xfa, 0xfa, 0xfa, 0x04, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x00, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xfb, 0xfb, 0xfb, 0x00, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xf9, 0xf9, 0xf9, 0x08, 0xf2, 0xf2, 0xf2, 0x17, 0xe3, 0xe3, 0xe3, 0x33, 0xc5, 0xc5, 0xc5, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xb5, 0xb5, 0x14, 0xd2, 0xd2, 0xd2, 0x4f, 0xed, 0xed, 0xed, 0x1f, 0xf6, 0xf6, 0xf6, 0x0f, 0xf9, 0xf9, 0xf9, 0x07, 0xfb, 0xfb, 0xfb, 0x04, 0xfb, 0xfb, 0xfb, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xf8, 0xf8, 0xf8, 0x0b, 0xf1, 0xf1, 0xf1, 0x18, 0xdf, 0xdf, 0xdf, 0x3b, 0xba, 0xba, 0xba, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xb0, 0xb0, 0x07, 0xcb, 0xcb, 0xcb, 0x58, 0xeb, 0xeb, 0xeb, 0x23, 0xf6, 0xf6, 0xf6, 0x0f, 0xfa, 0xfa, 0xfa, 0x07, 0xfb, 0xfb, 0xfb, 0x03, 0xfc, 0xfc, 0xfc, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x34, 0xff, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfb, 0xfb, 0xfb, 0x04, 0xf7, 0xf7, 0xf7, 0x0b, 0xef, 0xef, 0xef, 0x1c, 0xd6, 0xd6, 0xd6, 0x47, 0xb1, 0xb1, 0xb1, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xb0, 0xb0, 0x00, 0xc5, 0xc5, 0xc5, 0x54, 0xe8, 0xe8, 0xe8, 0x28, 0xf5, 0xf5, 0xf5, 0x10, 0xfa, 0xfa, 0xfa, 0x07, 0xfc, 0xfc, 0xfc, 0x03, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfb, 0xfb, 0xfb, 0x04, 0xf6, 0xf6, 0xf6, 0x0c, 0xee, 0xee, 0xee, 0x20, 0xcd, 0xcd, 0xcd, 0x50, 0xb0, 0xb0, 0xb0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0xc2, 0xc2, 0x48, 0xe5, 0xe5, 0xe5, 0x2c, 0xf4, 0xf4, 0xf4, 0x13, 0xfa, 0xfa, 0xfa, 0x07, 0xfc, 0xfc, 0xfc, 0x03, 0xfd, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfb, 0xfb, 0xfb, 0x04, 0xf6, 0xf6, 0xf6, 0x0f, 0xeb, 0xeb, 0xeb, 0x24, 0xc8, 0xc8, 0xc8, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x3b, 0xe1, 0xe1, 0xe1, 0x34, 0xf2, 0xf2, 0xf2, 0x14, 0xf9, 0xf9, 0xf9, 0x08, 0xfb, 0xfb, 0xfb, 0x03, 0xfd, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xfa, 0xfa, 0xfa, 0x07, 0xf5, 0xf5, 0xf5, 0x10, 0xe8, 0xe8, 0xe8, 0x28, 0xc6, 0xc6, 0xc6, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x2c, 0xdd, 0xdd, 0xdd, 0x3f, 0xf1, 0xf1, 0xf1, 0x18, 0xf8, 0xf8, 0xf8, 0x0b, 0xfb, 0xfb, 0xfb, 0x03, 0xfd, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x0b, 0xff, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xfa, 0xfa, 0xfa, 0x07, 0xf3, 0xf3, 0xf3, 0x14, 0xe5, 0xe5, 0xe5, 0x2f, 0xc3, 0xc3, 0xc3, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xb4, 0xb4, 0x1b, 0xd4, 0xd4, 0xd4, 0x4b, 0xee, 0xee, 0xee, 0x1b, 0xf7, 0xf7, 0xf7, 0x0b, 0xfb, 0xfb, 0xfb, 0x04, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0x60, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xf9, 0xf9, 0xf9, 0x08, 0xf2, 0xf2, 0xf2, 0x17, 0xe2, 0xe2, 0xe2, 0x37, 0xbc, 0xbc, 0xbc, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xb1, 0xb1, 0x08, 0xcc, 0xcc, 0xcc, 0x54, 0xec, 0xec, 0xec, 0x1f, 0xf6, 0xf6, 0xf6, 0x0c, 0xfb, 0xfb, 0xfb, 0x04, 0xfc, 0xfc, 0xfc, 0x03, 0xfd, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x58, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xf8, 0xf8, 0xf8, 0x0b, 0xf1, 0xf1, 0xf1, 0x18, 0xd9, 0xd9, 0xd9, 0x40, 0xb6, 0xb6, 0xb6, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xb0, 0xb0, 0x00, 0xc8, 0xc8, 0xc8, 0x53, 0xea, 0xea, 0xea, 0x24, 0xf6, 0xf6, 0xf6, 0x0f, 0xfa, 0xfa, 0xfa, 0x07, 0xfc, 0xfc, 0xfc, 0x03, 0xfd, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfb, 0xfb, 0xfb, 0x04, 0xf8, 0xf8, 0xf8, 0x0b, 0xf0, 0xf0, 0xf0, 0x1c, 0xd0, 0xd0, 0xd0, 0x4b, 0xb0, 0xb0, 0xb0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xc5, 0xc5, 0x48, 0xe6, 0xe6, 0xe6, 0x2b, 0xf4, 0xf4, 0xf4, 0x10, 0xfa, 0xfa, 0xfa, 0x07, 0xfc, 0xfc, 0xfc, 0x03, 0xfd, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x47, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfb, 0xfb, 0xfb, 0x04, 0xf6, 0xf6, 0xf6, 0x0c, 0xee, 0xee, 0xee, 0x20, 0xcb, 0xcb, 0xcb, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0xc2, 0xc2, 0x3c, 0xe4, 0xe4, 0xe4, 0x30, 0xf3, 0xf3, 0xf3, 0x13, 0xfa, 0xfa, 0xfa, 0x08, 0xfc, 0xfc, 0xfc, 0x03, 0xfd, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfb, 0xfb, 0xfb, 0x04, 0xf6, 0xf6, 0xf6, 0x0f, 0xeb, 0xeb, 0xeb, 0x24, 0xc9, 0xc9, 0xc9, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xbd, 0xbd, 0x30, 0xde, 0xde, 0xde, 0x38, 0xf1, 0xf1, 0xf1, 0x17, 0xf9, 0xf9, 0xf9, 0x08, 0xfb, 0xfb, 0xfb, 0x03, 0xfd, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfb, 0xfb, 0xfb, 0x07, 0xf5, 0xf5, 0xf5, 0x10, 0xe8, 0xe8, 0xe8, 0x28, 0xc3, 0xc3, 0xc3, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb6, 0xb6, 0x1f, 0xd8, 0xd8, 0xd8, 0x44, 0xef, 0xef, 0xef, 0x1b, 0xf8, 0xf8, 0xf8, 0x0b, 0xfb, 0xfb, 0xfb, 0x03, 0xfd, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xfa, 0xfa, 0xfa, 0x07, 0xf4, 0xf4, 0xf4, 0x13, 0xe5, 0xe5, 0xe5, 0x30, 0xbf, 0xbf, 0xbf, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0x0b, 0xcf, 0xcf, 0xcf, 0x4f, 0xee, 0xee, 0xee, 0x1c, 0xf6, 0xf6, 0xf6, 0x0c, 0xfb, 0xfb, 0xfb, 0x04, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xf9, 0xf9, 0xf9, 0x08, 0xf2, 0xf2, 0xf2, 0x14, 0xdd, 0xdd, 0xdd, 0x3b, 0xb7, 0xb7, 0xb7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xb0, 0xb0, 0x03, 0xcb, 0xcb, 0xcb, 0x4f, 0xeb, 0xeb, 0xeb, 0x20, 0xf6, 0xf6, 0xf6, 0x0c, 0xfb, 0xfb, 0xfb, 0x04, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x14, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xf9, 0xf9, 0xf9, 0x08, 0xf1, 0xf1, 0xf1, 0x18, 0xd3, 0xd3, 0xd3, 0x47, 0xb0, 0xb0, 0xb0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xc7, 0xc7, 0x48, 0xe8, 0xe8, 0xe8, 0x27, 0xf5, 0xf5, 0xf5, 0x0f, 0xfa, 0xfa, 0xfa, 0x07, 0xfc, 0xfc, 0xfc, 0x03, 0xfd, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x0b, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfb, 0xfb, 0xfb, 0x04, 0xf8, 0xf8, 0xf8, 0x0b, 0xef, 0xef, 0xef, 0x1c, 0xcc, 0xcc, 0xcc, 0x4b, 0xb0, 0xb0, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xc3, 0xc3, 0x40, 0xe4, 0xe4, 0xe4, 0x2c, 0xf4, 0xf4, 0xf4, 0x13, 0xfa, 0xfa, 0xfa, 0x07, 0xfc, 0xfc, 0xfc, 0x03, 0xfd, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfb, 0xfb, 0xfb, 0x04, 0xf6, 0xf6, 0xf6, 0x0c, 0xee, 0xee, 0xee, 0x1f, 0xc8, 0xc8, 0xc8, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xbe, 0xbe, 0x33, 0xe0, 0xe0, 0xe0, 0x34, 0xf2, 0xf2, 0xf2, 0x14, 0xf9, 0xf9, 0xf9, 0x08, 0xfc, 0xfc, 0xfc, 0x03, 0xfd, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfb, 0xfb, 0xfb, 0x04, 0xf6, 0xf6, 0xf6, 0x0f, 0xea, 0xea, 0xea, 0x24, 0xc5, 0xc5, 0xc5, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xb9, 0xb9, 0x20, 0xdb, 0xdb, 0xdb, 0x3f, 0xf1, 0xf1, 0xf1, 0x18, 0xf9, 0xf9, 0xf9, 0x08, 0xfb, 0xfb, 0xfb, 0x03, 0xfd, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xfb, 0xfb, 0xfb, 0x07, 0xf5, 0xf5, 0xf5, 0x10, 0xe7, 0xe7, 0xe7, 0x2b, 0xbf, 0xbf, 0xbf, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xb4, 0xb4, 0x0f, 0xd2, 0xd2, 0xd2, 0x4b, 0xef, 0xef, 0xef, 0x1b, 0xf8, 0xf8, 0xf8, 0x0b, 0xfb, 0xfb, 0xfb, 0x04, 0xfd, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xfa, 0xfa, 0xfa, 0x07, 0xf4, 0xf4, 0xf4, 0x13, 0xe1, 0xe1, 0xe1, 0x33, 0xb9, 0xb9, 0xb9, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xb0, 0xb0, 0x04, 0xcc, 0xcc, 0xcc, 0x4f, 0xec, 0xec, 0xec, 0x1f, 0xf6, 0xf6, 0xf6, 0x0c, 0xfb, 0xfb, 0xfb, 0x04, 0xfd, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x38, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0xf5, 0xf8, 0xfb, 0x18, 0x7e, 0xad, 0xd2, 0x0c, 0x7f, 0xaf, 0xd2, 0x1c, 0x81, 0xb0, 0xd3, 0x33, 0x81, 0xb0, 0xd4, 0x44, 0x81, 0xb1, 0xd5, 0x57, 0x82, 0xb1, 0xd6, 0x64, 0x82, 0xb2, 0xd7, 0x78, 0x82, 0xb2, 0xd8, 0x87, 0x82, 0xb2, 0xd8, 0x94, 0x82, 0xb2, 0xd8, 0x9f, 0x82, 0xb2, 0xd8, 0xab, 0x82, 0xb2, 0xd8, 0xac, 0x82, 0xb2, 0xd8, 0xac, 0x82, 0xb2, 0xd8, 0xb4, 0x82, 0xb2, 0xd8, 0xcb, 0x82, 0xb2, 0xd8, 0xcf, 0x82, 0xb2, 0xd8, 0xd4, 0x82, 0xb2, 0xd8, 0xd4, 0x82, 0xb2, 0xd8, 0xd4, 0x82, 0xb2, 0xd8, 0xd4, 0x82, 0xb2, 0xd8, 0xd4, 0x81, 0xb2, 0xd8, 0xd4, 0x80, 0xb1, 0xd8, 0xd4, 0x7e, 0xb0, 0xd8, 0xd4, 0x7d, 0xaf, 0xd7, 0xcf, 0x7a, 0xae, 0xd7, 0xcb, 0x78, 0xad, 0xd6, 0xc3, 0x76, 0xac, 0xd5, 0xbc, 0x74, 0xab, 0xd5, 0xb4, 0x71, 0xa9, 0xd4, 0xab, 0x6f, 0xa7, 0xd3, 0xa0, 0x6b, 0xa5, 0xd2, 0x94, 0x69, 0xa4, 0xd2, 0x88, 0x68, 0xa3, 0xd2, 0x78, 0x66, 0xa2, 0xd2, 0x6b, 0x65, 0xa1, 0xd2, 0x5b, 0x64, 0xa1, 0xd2, 0x47, 0x64, 0xa1, 0xd2, 0x33, 0x64, 0xa1, 0xd2, 0x1f, 0x65, 0xa1, 0xd2, 0x0c, 0x64, 0xa0, 0xd0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xfa, 0xfa, 0xfa, 0x08, 0xf3, 0xf3, 0xf3, 0x14, 0xd9, 0xd9, 0xd9, 0x3c, 0xb0, 0xb0, 0xb0, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xc8, 0xc8, 0x48, 0xe9, 0xe9, 0xe9, 0x24, 0xf6, 0xf6, 0xf6, 0x0f, 0xfa, 0xfa, 0xfa, 0x04, 0xfc, 0xfc, 0xfc, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x48, 0xf8, 0xfb, 0xfd, 0x47, 0xd8, 0xe7, 0xf3, 0x57, 0xc0, 0xd8, 0xeb, 0x68, 0xb1, 0xcf, 0xe5, 0x78, 0xa7, 0xc8, 0xe2, 0x88, 0xa0, 0xc3, 0xdd, 0x9b, 0x9b, 0xbf, 0xdb, 0xaf, 0x95, 0xbc, 0xd9, 0xc4, 0x91, 0xba, 0xd8, 0xdb, 0x8d, 0xb8, 0xd8, 0xec, 0x80, 0xb0, 0xd3, 0xfb, 0x81, 0xb0, 0xd4, 0xff, 0x81, 0xb0, 0xd4, 0xff, 0x81, 0xb1, 0xd6, 0xff, 0x82, 0xb2, 0xd7, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x81, 0xb1, 0xd8, 0xff, 0x80, 0xb1, 0xd8, 0xff, 0x7f, 0xb1, 0xd8, 0xff, 0x7e, 0xb0, 0xd8, 0xff, 0x7d, 0xaf, 0xd7, 0xff, 0x7b, 0xae, 0xd7, 0xff, 0x79, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x76, 0xac, 0xd5, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x71, 0xa9, 0xd4, 0xff, 0x6f, 0xa7, 0xd3, 0xff, 0x6d, 0xa6, 0xd3, 0xff, 0x6b, 0xa5, 0xd2, 0xff, 0x6b, 0xa5, 0xd2, 0xff, 0x69, 0xa4, 0xd2, 0xff, 0x69, 0xa3, 0xd2, 0xff, 0x68, 0xa3, 0xd2, 0xff, 0x67, 0xa3, 0xd2, 0xfb, 0x67, 0xa2, 0xd2, 0xec, 0x67, 0xa2, 0xd2, 0xd8, 0x66, 0xa2, 0xd2, 0xbf, 0x66, 0xa2, 0xd2, 0xa3, 0x65, 0xa1, 0xd2, 0x84, 0x65, 0xa1, 0xd2, 0x67, 0x65, 0xa1, 0xd2, 0x43, 0x64, 0xa1, 0xd2, 0x23, 0x64, 0x9f, 0xd1, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0xf9, 0xf9, 0xf9, 0x08, 0xf1, 0xf1, 0xf1, 0x18, 0xcd, 0xcd, 0xcd, 0x4b, 0xb0, 0xb0, 0xb0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xc5, 0xc5, 0x3f, 0xe7, 0xe7, 0xe7, 0x2b, 0xf5, 0xf5, 0xf5, 0x10, 0xfa, 0xfa, 0xfa, 0x07, 0xfc, 0xfc, 0xfc, 0x03, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x27, 0xf5, 0xf8, 0xfc, 0x60, 0xcf, 0xe1, 0xf1, 0x7c, 0xb7, 0xd2, 0xe9, 0x9b, 0xa6, 0xc9, 0xe4, 0xbb, 0x9a, 0xc1, 0xe1, 0xdc, 0x93, 0xbe, 0xdf, 0xf8, 0x92, 0xbd, 0xdd, 0xff, 0x92, 0xbc, 0xdd, 0xff, 0x93, 0xbd, 0xdc, 0xff, 0x94, 0xbd, 0xdc, 0xff, 0x94, 0xbd, 0xdb, 0xff, 0x94, 0xbd, 0xdc, 0xff, 0x92, 0xbd, 0xdb, 0xff, 0x91, 0xbc, 0xdb, 0xff, 0x8f, 0xbb, 0xdb, 0xff, 0x81, 0xb2, 0xd6, 0xff, 0x81, 0xb2, 0xd6, 0xff, 0x81, 0xb2, 0xd7, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x81, 0xb2, 0xd8, 0xff, 0x81, 0xb2, 0xd8, 0xff, 0x81, 0xb2, 0xd8, 0xff, 0x80, 0xb1, 0xd8, 0xff, 0x7e, 0xb1, 0xd8, 0xff, 0x7d, 0xb0, 0xd8, 0xff, 0x7c, 0xaf, 0xd7, 0xff, 0x7b, 0xae, 0xd7, 0xff, 0x7a, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x77, 0xac, 0xd5, 0xff, 0x76, 0xab, 0xd5, 0xff, 0x74, 0xaa, 0xd5, 0xff, 0x74, 0xaa, 0xd5, 0xff, 0x73, 0xaa, 0xd5, 0xff, 0x71, 0xa8, 0xd4, 0xff, 0x71, 0xa8, 0xd4, 0xff, 0x70, 0xa8, 0xd4, 0xff, 0x70, 0xa8, 0xd4, 0xff, 0x6f, 0xa7, 0xd4, 0xff, 0x6f, 0xa7, 0xd3, 0xff, 0x6e, 0xa6, 0xd3, 0xff, 0x6d, 0xa6, 0xd3, 0xff, 0x6c, 0xa5, 0xd3, 0xff, 0x6c, 0xa5, 0xd3, 0xff, 0x6b, 0xa5, 0xd3, 0xff, 0x6a, 0xa4, 0xd3, 0xff, 0x68, 0xa3, 0xd2, 0xf7, 0x67, 0xa3, 0xd2, 0xd4, 0x67, 0xa2, 0xd2, 0xab, 0x66, 0xa2, 0xd2, 0x80, 0x64, 0xa1, 0xd2, 0x53, 0x64, 0xa2, 0xd2, 0x20, 0x64, 0xa2, 0xd2, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfb, 0xfb, 0xfb, 0x03, 0xf8, 0xf8, 0xf8, 0x0b, 0xef, 0xef, 0xef, 0x1c, 0xca, 0xca, 0xca, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xc3, 0xc3, 0x33, 0xe2, 0xe2, 0xe2, 0x30, 0xf3, 0xf3, 0xf3, 0x13, 0xfa, 0xfa, 0xfa, 0x07, 0xfc, 0xfc, 0xfc, 0x03, 0xfd, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xa2, 0xd2, 0x1b, 0x67, 0xa3, 0xd2, 0x5b, 0x68, 0xa3, 0xd2, 0x97, 0x7e, 0xb0, 0xd8, 0xd4, 0xa0, 0xc5, 0xe3, 0xfb, 0x9d, 0xc3, 0xe2, 0xff, 0x9b, 0xc2, 0xe2, 0xff, 0x9b, 0xc1, 0xe1, 0xff, 0x98, 0xc0, 0xe1, 0xff, 0x98, 0xc0, 0xe0, 0xff, 0x98, 0xc0, 0xdf, 0xff, 0x97, 0xbf, 0xdf, 0xff, 0x97, 0xbf, 0xdf, 0xff, 0x97, 0xbf, 0xdf, 0xff, 0x97, 0xbf, 0xde, 0xff, 0x96, 0xbf, 0xde, 0xff, 0x93, 0xbe, 0xdd, 0xff, 0x91, 0xbc, 0xdd, 0xff, 0x8f, 0xbb, 0xdd, 0xff, 0x81, 0xb2, 0xd8, 0xff, 0x81, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x83, 0xb3, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x81, 0xb2, 0xd8, 0xff, 0x81, 0xb2, 0xd8, 0xff, 0x81, 0xb2, 0xd8, 0xff, 0x81, 0xb2, 0xd8, 0xff, 0x80, 0xb1, 0xd8, 0xff, 0x7f, 0xb1, 0xd8, 0xff, 0x7e, 0xb0, 0xd8, 0xff, 0x7e, 0xaf, 0xd8, 0xff, 0x7c, 0xae, 0xd7, 0xff, 0x7c, 0xae, 0xd7, 0xff, 0x7b, 0xae, 0xd7, 0xff, 0x7a, 0xad, 0xd7, 0xff, 0x79, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x77, 0xac, 0xd6, 0xff, 0x77, 0xac, 0xd6, 0xff, 0x76, 0xab, 0xd5, 0xff, 0x75, 0xab, 0xd5, 0xff, 0x75, 0xaa, 0xd5, 0xff, 0x74, 0xaa, 0xd5, 0xff, 0x74, 0xaa, 0xd5, 0xff, 0x73, 0xaa, 0xd5, 0xff, 0x73, 0xa9, 0xd5, 0xff, 0x72, 0xa9, 0xd4, 0xff, 0x70, 0xa8, 0xd4, 0xff, 0x6f, 0xa7, 0xd3, 0xff, 0x6d, 0xa6, 0xd3, 0xff, 0x6b, 0xa5, 0xd3, 0xff, 0x68, 0xa3, 0xd2, 0xff, 0x67, 0xa3, 0xd2, 0xe8, 0x66, 0xa2, 0xd2, 0xb4, 0x66, 0xa2, 0xd2, 0x7b, 0x64, 0xa1, 0xd2, 0x3b, 0x64, 0xa1, 0xd1, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfb, 0xfb, 0xfb, 0x04, 0xf7, 0xf7, 0xf7, 0x0c, 0xed, 0xed, 0xed, 0x20, 0xc6, 0xc6, 0xc6, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x24, 0xde, 0xde, 0xde, 0x3b, 0xf1, 0xf1, 0xf1, 0x17, 0xf9, 0xf9, 0xf9, 0x08, 0xfc, 0xfc, 0xfc, 0x03, 0xc5, 0xd3, 0xf0, 0x00, 0x68, 0xa3, 0xd2, 0x24, 0x6a, 0xa4, 0xd2, 0x7c, 0x6b, 0xa5, 0xd2, 0xcc, 0x6d, 0xa6, 0xd3, 0xfc, 0x6f, 0xa8, 0xd3, 0xff, 0x70, 0xa9, 0xd4, 0xff, 0x7c, 0xaf, 0xd7, 0xff, 0xa3, 0xc7, 0xe4, 0xff, 0xa1, 0xc6, 0xe3, 0xff, 0x9e, 0xc4, 0xe2, 0xff, 0x9c, 0xc3, 0xe2, 0xff, 0x9b, 0xc2, 0xe1, 0xff, 0x9a, 0xc1, 0xe1, 0xff, 0x9a, 0xc1, 0xe0, 0xff, 0x9a, 0xc1, 0xe0, 0xff, 0x99, 0xc1, 0xe0, 0xff, 0x99, 0xc0, 0xe0, 0xff, 0x98, 0xc0, 0xdf, 0xff, 0x96, 0xbf, 0xdf, 0xff, 0x94, 0xbe, 0xde, 0xff, 0x92, 0xbd, 0xde, 0xff, 0x8f, 0xbb, 0xdd, 0xff, 0x82, 0xb3, 0xd9, 0xff, 0x82, 0xb3, 0xd9, 0xff, 0x82, 0xb3, 0xd9, 0xff, 0x83, 0xb3, 0xd9, 0xff, 0x83, 0xb4, 0xd9, 0xff, 0x84, 0xb4, 0xd9, 0xff, 0x84, 0xb4, 0xd9, 0xff, 0x85, 0xb5, 0xd9, 0xff, 0x86, 0xb5, 0xd9, 0xff, 0x86, 0xb5, 0xd9, 0xff, 0x86, 0xb5, 0xd9, 0xff, 0x86, 0xb5, 0xd9, 0xff, 0x86, 0xb5, 0xd9, 0xff, 0x86, 0xb5, 0xd9, 0xff, 0x87, 0xb6, 0xda, 0xff, 0x87, 0xb6, 0xda, 0xff, 0x87, 0xb6, 0xda, 0xff, 0x87, 0xb6, 0xda, 0xff, 0x88, 0xb6, 0xda, 0xff, 0x88, 0xb6, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb6, 0xda, 0xff, 0x89, 0xb6, 0xda, 0xff, 0x89, 0xb6, 0xda, 0xff, 0x89, 0xb6, 0xdb, 0xff, 0x89, 0xb6, 0xdb, 0xff, 0x89, 0xb7, 0xdb, 0xff, 0x89, 0xb7, 0xdb, 0xff, 0x89, 0xb6, 0xdb, 0xff, 0x87, 0xb5, 0xda, 0xff, 0x87, 0xb5, 0xda, 0xff, 0x86, 0xb5, 0xda, 0xff, 0x87, 0xb5, 0xda, 0xff, 0x86, 0xb4, 0xda, 0xff, 0x86, 0xb4, 0xda, 0xff, 0x86, 0xb4, 0xda, 0xff, 0x85, 0xb3, 0xda, 0xff, 0x83, 0xb2, 0xd9, 0xff, 0x82, 0xb2, 0xd9, 0xff, 0x81, 0xb1, 0xd9, 0xff, 0x7f, 0xb0, 0xd8, 0xff, 0x7e, 0xaf, 0xd8, 0xff, 0x7c, 0xae, 0xd7, 0xff, 0x7a, 0xad, 0xd7, 0xff, 0x79, 0xad, 0xd7, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x77, 0xac, 0xd6, 0xff, 0x77, 0xac, 0xd6, 0xff, 0x76, 0xab, 0xd5, 0xff, 0x74, 0xaa, 0xd5, 0xff, 0x73, 0xa9, 0xd5, 0xff, 0x72, 0xa9, 0xd4, 0xff, 0x71, 0xa8, 0xd4, 0xff, 0x6f, 0xa7, 0xd4, 0xff, 0x6e, 0xa6, 0xd3, 0xff, 0x6c, 0xa6, 0xd3, 0xff, 0x6b, 0xa5, 0xd3, 0xff, 0x69, 0xa4, 0xd2, 0xff, 0x67, 0xa3, 0xd2, 0xef, 0x66, 0xa2, 0xd2, 0xab, 0x65, 0xa1, 0xd2, 0x5c, 0x64, 0xa0, 0xd1, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfb, 0xfb, 0xfb, 0x04, 0xf6, 0xf6, 0xf6, 0x0f, 0xea, 0xea, 0xea, 0x24, 0xc0, 0xc0, 0xc0, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xb5, 0xb5, 0x14, 0xd5, 0xd5, 0xd5, 0x44, 0xf0, 0xf0, 0xf0, 0x18, 0xe0, 0xea, 0xf3, 0x0b, 0x72, 0xa9, 0xd4, 0x4f, 0x6e, 0xa7, 0xd3, 0xbc, 0x70, 0xa8, 0xd3, 0xfc, 0x71, 0xa9, 0xd4, 0xff, 0x72, 0xaa, 0xd4, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x78, 0xad, 0xd6, 0xff, 0xa4, 0xc8, 0xe4, 0xff, 0xa1, 0xc6, 0xe3, 0xff, 0x9f, 0xc5, 0xe2, 0xff, 0x9d, 0xc3, 0xe2, 0xff, 0x9b, 0xc2, 0xe1, 0xff, 0x9b, 0xc2, 0xe1, 0xff, 0x9a, 0xc2, 0xe1, 0xff, 0x9a, 0xc1, 0xe1, 0xff, 0x99, 0xc1, 0xe0, 0xff, 0x99, 0xc0, 0xe0, 0xff, 0x98, 0xc0, 0xe0, 0xff, 0x97, 0xbf, 0xe0, 0xff, 0x95, 0xbf, 0xdf, 0xff, 0x93, 0xbe, 0xde, 0xff, 0x91, 0xbd, 0xde, 0xff, 0x86, 0xb5, 0xd9, 0xff, 0x86, 0xb5, 0xd9, 0xff, 0x87, 0xb6, 0xda, 0xff, 0x88, 0xb6, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x8a, 0xb8, 0xdb, 0xff, 0x8b, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8d, 0xba, 0xdb, 0xff, 0x8e, 0xba, 0xdc, 0xff, 0x8e, 0xba, 0xdc, 0xff, 0x8e, 0xba, 0xdc, 0xff, 0x8f, 0xbb, 0xdc, 0xff, 0x90, 0xbb, 0xdc, 0xff, 0x90, 0xbb, 0xdc, 0xff, 0x91, 0xbb, 0xdc, 0xff, 0x91, 0xbc, 0xdd, 0xff, 0x92, 0xbc, 0xdd, 0xff, 0x92, 0xbc, 0xdd, 0xff, 0x93, 0xbd, 0xde, 0xff, 0x95, 0xbe, 0xde, 0xff, 0x95, 0xbe, 0xde, 0xff, 0x95, 0xbe, 0xde, 0xff, 0x95, 0xbe, 0xde, 0xff, 0x95, 0xbe, 0xdf, 0xff, 0x95, 0xbe, 0xdf, 0xff, 0x95, 0xbe, 0xdf, 0xff, 0x95, 0xbe, 0xdf, 0xff, 0x95, 0xbe, 0xdf, 0xff, 0x94, 0xbd, 0xde, 0xff, 0x94, 0xbd, 0xde, 0xff, 0x94, 0xbd, 0xde, 0xff, 0x94, 0xbd, 0xde, 0xff, 0x94, 0xbd, 0xde, 0xff, 0x94, 0xbd, 0xde, 0xff, 0x94, 0xbd, 0xde, 0xff, 0x93, 0xbc, 0xde, 0xff, 0x91, 0xbb, 0xdd, 0xff, 0x8f, 0xba, 0xdd, 0xff, 0x8d, 0xb9, 0xdd, 0xff, 0x8a, 0xb7, 0xdc, 0xff, 0x88, 0xb6, 0xdb, 0xff, 0x85, 0xb4, 0xda, 0xff, 0x81, 0xb2, 0xd9, 0xff, 0x7f, 0xb0, 0xd8, 0xff, 0x7c, 0xae, 0xd8, 0xff, 0x79, 0xad, 0xd7, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x77, 0xac, 0xd6, 0xff, 0x76, 0xab, 0xd5, 0xff, 0x75, 0xab, 0xd5, 0xff, 0x74, 0xaa, 0xd5, 0xff, 0x73, 0xa9, 0xd5, 0xff, 0x72, 0xa9, 0xd4, 0xff, 0x71, 0xa8, 0xd4, 0xff, 0x70, 0xa8, 0xd4, 0xff, 0x6f, 0xa7, 0xd3, 0xff, 0x6e, 0xa6, 0xd3, 0xff, 0x6c, 0xa5, 0xd3, 0xff, 0x6b, 0xa4, 0xd2, 0xff, 0x69, 0xa3, 0xd2, 0xff, 0x67, 0xa2, 0xd2, 0xf3, 0x65, 0xa2, 0xd2, 0x9f, 0x69, 0xa3, 0xd2, 0x33, 0xf7, 0xf9, 0xf9, 0x07, 0xf5, 0xf5, 0xf5, 0x10, 0xe6, 0xe6, 0xe6, 0x2c, 0xbc, 0xbc, 0xbc, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xb4, 0xb4, 0x07, 0xcd, 0xcd, 0xcd, 0x4c, 0xa9, 0xc8, 0xe0, 0x40, 0x79, 0xad, 0xd6, 0xc4, 0x74, 0xab, 0xd4, 0xff, 0x74, 0xaa, 0xd4, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x76, 0xac, 0xd5, 0xff, 0xa3, 0xc7, 0xe4, 0xff, 0xa1, 0xc6, 0xe3, 0xff, 0x9f, 0xc5, 0xe2, 0xff, 0x9d, 0xc3, 0xe2, 0xff, 0x9b, 0xc2, 0xe1, 0xff, 0x9b, 0xc2, 0xe1, 0xff, 0x9a, 0xc2, 0xe1, 0xff, 0x99, 0xc1, 0xe1, 0xff, 0x99, 0xc1, 0xe0, 0xff, 0x99, 0xc1, 0xe0, 0xff, 0x99, 0xc0, 0xe0, 0xff, 0x97, 0xbf, 0xe0, 0xff, 0x96, 0xbf, 0xdf, 0xff, 0x95, 0xbf, 0xdf, 0xff, 0x94, 0xbe, 0xde, 0xff, 0x8a, 0xb8, 0xdb, 0xff, 0x89, 0xb7, 0xdb, 0xff, 0x8a, 0xb8, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8d, 0xba, 0xdc, 0xff, 0x8f, 0xbb, 0xdc, 0xff, 0x90, 0xbc, 0xdc, 0xff, 0x92, 0xbc, 0xdd, 0xff, 0x93, 0xbd, 0xdd, 0xff, 0x94, 0xbe, 0xde, 0xff, 0x95, 0xbe, 0xde, 0xff, 0x95, 0xbe, 0xde, 0xff, 0x96, 0xbf, 0xde, 0xff, 0x97, 0xbf, 0xde, 0xff, 0x98, 0xbf, 0xdf, 0xff, 0x98, 0xbf, 0xdf, 0xff, 0x99, 0xc0, 0xdf, 0xff, 0x9a, 0xc0, 0xdf, 0xff, 0x9b, 0xc1, 0xe0, 0xff, 0x9b, 0xc1, 0xe0, 0xff, 0x9b, 0xc2, 0xe0, 0xff, 0x9c, 0xc2, 0xe0, 0xff, 0x9c, 0xc2, 0xe0, 0xff, 0x9c, 0xc2, 0xe1, 0xff, 0x9c, 0xc2, 0xe1, 0xff, 0x9c, 0xc2, 0xe1, 0xff, 0x9c, 0xc2, 0xe1, 0xff, 0x9c, 0xc2, 0xe1, 0xff, 0x9c, 0xc2, 0xe1, 0xff, 0x9c, 0xc2, 0xe1, 0xff, 0x9c, 0xc2, 0xe1, 0xff, 0x9c, 0xc2, 0xe1, 0xff, 0x9c, 0xc2, 0xe1, 0xff, 0x9c, 0xc2, 0xe1, 0xff, 0x9c, 0xc2, 0xe1, 0xff, 0x9d, 0xc2, 0xe1, 0xff, 0x9c, 0xc2, 0xe1, 0xff, 0x9b, 0xc1, 0xe0, 0xff, 0x99, 0xc0, 0xe0, 0xff, 0x97, 0xbf, 0xdf, 0xff, 0x93, 0xbd, 0xde, 0xff, 0x8f, 0xbb, 0xdd, 0xff, 0x8a, 0xb8, 0xdc, 0xff, 0x86, 0xb5, 0xda, 0xff, 0x83, 0xb3, 0xd9, 0xff, 0x7f, 0xb0, 0xd8, 0xff, 0x7b, 0xae, 0xd7, 0xff, 0x79, 0xad, 0xd6, 0xff, 0x77, 0xac, 0xd6, 0xff, 0x76, 0xab, 0xd5, 0xff, 0x76, 0xab, 0xd5, 0xff, 0x75, 0xab, 0xd5, 0xff, 0x75, 0xaa, 0xd5, 0xff, 0x74, 0xaa, 0xd5, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x73, 0xa9, 0xd4, 0xff, 0x72, 0xa9, 0xd4, 0xff, 0x71, 0xa9, 0xd4, 0xff, 0x71, 0xa8, 0xd4, 0xff, 0x6f, 0xa7, 0xd3, 0xff, 0x6d, 0xa6, 0xd3, 0xff, 0x6b, 0xa5, 0xd2, 0xff, 0x69, 0xa4, 0xd2, 0xff, 0x68, 0xa3, 0xd2, 0xfc, 0x6a, 0xa5, 0xd3, 0xab, 0xa2, 0xc5, 0xe0, 0x2b, 0xdb, 0xdb, 0xdb, 0x38, 0xb1, 0xb1, 0xb1, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xb0, 0xb0, 0x00, 0xb2, 0xc1, 0xce, 0x67, 0x84, 0xb3, 0xd7, 0xf0, 0x79, 0xad, 0xd6, 0xff, 0x75, 0xac, 0xd5, 0xff, 0x74, 0xaa, 0xd4, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x74, 0xab, 0xd4, 0xff, 0x9f, 0xc5, 0xe2, 0xff, 0xa2, 0xc6, 0xe3, 0xff, 0x9f, 0xc5, 0xe3, 0xff, 0x9d, 0xc4, 0xe2, 0xff, 0x9c, 0xc3, 0xe1, 0xff, 0x9b, 0xc2, 0xe1, 0xff, 0x9b, 0xc2, 0xe1, 0xff, 0x9a, 0xc1, 0xe1, 0xff, 0x9a, 0xc1, 0xe0, 0xff, 0x99, 0xc1, 0xe0, 0xff, 0x99, 0xc0, 0xe0, 0xff, 0x98, 0xbf, 0xdf, 0xff, 0x97, 0xbf, 0xdf, 0xff, 0x96, 0xbf, 0xdf, 0xff, 0x95, 0xbf, 0xde, 0xff, 0x8a, 0xb8, 0xdb, 0xff, 0x89, 0xb7, 0xdb, 0xff, 0x8a, 0xb8, 0xdb, 0xff, 0x8b, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8d, 0xba, 0xdc, 0xff, 0x8e, 0xba, 0xdc, 0xff, 0x8f, 0xba, 0xdc, 0xff, 0x8f, 0xbb, 0xdc, 0xff, 0x91, 0xbc, 0xdd, 0xff, 0x92, 0xbc, 0xdd, 0xff, 0x93, 0xbd, 0xdd, 0xff, 0x94, 0xbe, 0xde, 0xff, 0x95, 0xbe, 0xde, 0xff, 0x95, 0xbf, 0xde, 0xff, 0x96, 0xbf, 0xde, 0xff, 0x97, 0xbf, 0xde, 0xff, 0x98, 0xbf, 0xdf, 0xff, 0x99, 0xc0, 0xdf, 0xff, 0x99, 0xc0, 0xdf, 0xff, 0x9b, 0xc1, 0xdf, 0xff, 0x9b, 0xc1, 0xdf, 0xff, 0x9b, 0xc1, 0xdf, 0xff, 0x9a, 0xc1, 0xe0, 0xff, 0x9a, 0xc1, 0xe0, 0xff, 0x9b, 0xc1, 0xe0, 0xff, 0x9b, 0xc1, 0xe0, 0xff, 0x9b, 0xc1, 0xe0, 0xff, 0x9b, 0xc1, 0xe0, 0xff, 0x9b, 0xc1, 0xe0, 0xff, 0x9b, 0xc1, 0xe0, 0xff, 0x9b, 0xc1, 0xe0, 0xff, 0x9b, 0xc1, 0xe0, 0xff, 0x9b, 0xc1, 0xe0, 0xff, 0x9b, 0xc1, 0xe0, 0xff, 0x9b, 0xc1, 0xe0, 0xff, 0x9b, 0xc1, 0xe0, 0xff, 0x9b, 0xc1, 0xe0, 0xff, 0x99, 0xc0, 0xdf, 0xff, 0x97, 0xbf, 0xdf, 0xff, 0x94, 0xbd, 0xde, 0xff, 0x8f, 0xbb, 0xdd, 0xff, 0x8c, 0xb9, 0xdc, 0xff, 0x89, 0xb7, 0xdb, 0xff, 0x85, 0xb4, 0xda, 0xff, 0x81, 0xb1, 0xd9, 0xff, 0x7e, 0xaf, 0xd8, 0xff, 0x7b, 0xae, 0xd7, 0xff, 0x79, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x77, 0xac, 0xd6, 0xff, 0x77, 0xac, 0xd6, 0xff, 0x77, 0xac, 0xd6, 0xff, 0x77, 0xac, 0xd5, 0xff, 0x77, 0xac, 0xd5, 0xff, 0x77, 0xac, 0xd5, 0xff, 0x77, 0xac, 0xd5, 0xff, 0x77, 0xac, 0xd5, 0xff, 0x76, 0xac, 0xd5, 0xff, 0x76, 0xab, 0xd5, 0xff, 0x74, 0xaa, 0xd4, 0xff, 0x73, 0xa9, 0xd4, 0xff, 0x71, 0xa8, 0xd3, 0xff, 0x70, 0xa8, 0xd3, 0xff, 0x70, 0xa8, 0xd3, 0xff, 0x77, 0xac, 0xd5, 0xe8, 0xad, 0xc0, 0xd1, 0x68, 0xb0, 0xb0, 0xb0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xb4, 0xd1, 0xac, 0x83, 0xb2, 0xd7, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x74, 0xaa, 0xd5, 0xff, 0x72, 0xa9, 0xd4, 0xff, 0x71, 0xa9, 0xd4, 0xff, 0x72, 0xa9, 0xd4, 0xff, 0x72, 0xaa, 0xd4, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x74, 0xab, 0xd5, 0xff, 0x9c, 0xc3, 0xe2, 0xff, 0xa3, 0xc7, 0xe4, 0xff, 0xa1, 0xc6, 0xe3, 0xff, 0x9f, 0xc5, 0xe2, 0xff, 0x9e, 0xc4, 0xe2, 0xff, 0x9c, 0xc3, 0xe1, 0xff, 0x9b, 0xc2, 0xe1, 0xff, 0x9b, 0xc1, 0xe1, 0xff, 0x9a, 0xc1, 0xe0, 0xff, 0x99, 0xc0, 0xe0, 0xff, 0x97, 0xbf, 0xdf, 0xff, 0x95, 0xbf, 0xdf, 0xff, 0x93, 0xbe, 0xde, 0xff, 0x91, 0xbc, 0xdd, 0xff, 0x90, 0xbb, 0xdd, 0xff, 0x85, 0xb4, 0xd9, 0xff, 0x83, 0xb3, 0xd9, 0xff, 0x83, 0xb3, 0xd9, 0xff, 0x83, 0xb3, 0xd9, 0xff, 0x84, 0xb3, 0xd9, 0xff, 0x84, 0xb4, 0xd9, 0xff, 0x85, 0xb4, 0xd9, 0xff, 0x84, 0xb4, 0xd9, 0xff, 0x85, 0xb5, 0xda, 0xff, 0x87, 0xb5, 0xda, 0xff, 0x88, 0xb6, 0xda, 0xff, 0x89, 0xb7, 0xdb, 0xff, 0x8a, 0xb8, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8d, 0xb9, 0xdc, 0xff, 0x8e, 0xba, 0xdc, 0xff, 0x8f, 0xbb, 0xdc, 0xff, 0x90, 0xbb, 0xdc, 0xff, 0x90, 0xbc, 0xdd, 0xff, 0x91, 0xbc, 0xdd, 0xff, 0x93, 0xbd, 0xdd, 0xff, 0x93, 0xbd, 0xdd, 0xff, 0x93, 0xbd, 0xdd, 0xff, 0x93, 0xbd, 0xdd, 0xff, 0x93, 0xbd, 0xdd, 0xff, 0x93, 0xbd, 0xdd, 0xff, 0x93, 0xbd, 0xdd, 0xff, 0x92, 0xbd, 0xdd, 0xff, 0x92, 0xbd, 0xdd, 0xff, 0x92, 0xbd, 0xdd, 0xff, 0x92, 0xbd, 0xdd, 0xff, 0x92, 0xbd, 0xdd, 0xff, 0x92, 0xbd, 0xdd, 0xff, 0x92, 0xbd, 0xdd, 0xff, 0x92, 0xbd, 0xdd, 0xff, 0x92, 0xbd, 0xdd, 0xff, 0x92, 0xbd, 0xdd, 0xff, 0x92, 0xbd, 0xdd, 0xff, 0x91, 0xbc, 0xdd, 0xff, 0x90, 0xbb, 0xdc, 0xff, 0x8f, 0xbb, 0xdd, 0xff, 0x8d, 0xb9, 0xdc, 0xff, 0x8b, 0xb8, 0xdc, 0xff, 0x89, 0xb7, 0xdb, 0xff, 0x87, 0xb6, 0xda, 0xff, 0x85, 0xb4, 0xd9, 0xff, 0x83, 0xb3, 0xd9, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x81, 0xb1, 0xd8, 0xff, 0x80, 0xb1, 0xd8, 0xff, 0x80, 0xb1, 0xd8, 0xff, 0x80, 0xb1, 0xd8, 0xff, 0x80, 0xb1, 0xd8, 0xff, 0x80, 0xb0, 0xd7, 0xff, 0x80, 0xb0, 0xd7, 0xff, 0x7f, 0xb0, 0xd7, 0xff, 0x7f, 0xb0, 0xd7, 0xff, 0x7f, 0xb0, 0xd7, 0xff, 0x7f, 0xb0, 0xd7, 0xff, 0x7f, 0xb0, 0xd7, 0xff, 0x7f, 0xb0, 0xd7, 0xff, 0x7f, 0xb0, 0xd7, 0xff, 0x7e, 0xaf, 0xd7, 0xff, 0x7f, 0xb0, 0xd7, 0xff, 0x81, 0xb1, 0xd7, 0xff, 0x88, 0xb5, 0xd9, 0xff, 0x95, 0xb8, 0xd2, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xae, 0xcf, 0xa7, 0x81, 0xb0, 0xd6, 0xff, 0x76, 0xac, 0xd5, 0xff, 0x71, 0xa8, 0xd4, 0xff, 0x6f, 0xa8, 0xd3, 0xff, 0x6f, 0xa8, 0xd4, 0xff, 0x70, 0xa8, 0xd4, 0xff, 0x71, 0xa9, 0xd4, 0xff, 0x72, 0xa9, 0xd4, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x74, 0xaa, 0xd4, 0xff, 0x75, 0xab, 0xd5, 0xff, 0x98, 0xc0, 0xe0, 0xff, 0xa4, 0xc7, 0xe4, 0xff, 0xa2, 0xc7, 0xe3, 0xff, 0xa0, 0xc5, 0xe2, 0xff, 0x9f, 0xc4, 0xe2, 0xff, 0x9d, 0xc3, 0xe1, 0xff, 0x9c, 0xc2, 0xe1, 0xff, 0x9b, 0xc1, 0xe1, 0xff, 0x99, 0xc0, 0xe0, 0xff, 0x98, 0xc0, 0xdf, 0xff, 0x96, 0xbf, 0xdf, 0xff, 0x94, 0xbe, 0xde, 0xff, 0x91, 0xbd, 0xdd, 0xff, 0x8f, 0xbb, 0xdd, 0xff, 0x8c, 0xba, 0xdc, 0xff, 0x81, 0xb2, 0xd8, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7f, 0xb0, 0xd7, 0xff, 0x7f, 0xb0, 0xd7, 0xff, 0x7f, 0xb0, 0xd7, 0xff, 0x7f, 0xb0, 0xd7, 0xff, 0x7f, 0xb1, 0xd8, 0xff, 0x80, 0xb1, 0xd8, 0xff, 0x81, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x83, 0xb3, 0xd9, 0xff, 0x85, 0xb4, 0xd9, 0xff, 0x86, 0xb4, 0xd9, 0xff, 0x87, 0xb5, 0xda, 0xff, 0x88, 0xb6, 0xda, 0xff, 0x89, 0xb6, 0xda, 0xff, 0x89, 0xb7, 0xdb, 0xff, 0x8a, 0xb8, 0xdb, 0xff, 0x8a, 0xb8, 0xdb, 0xff, 0x8b, 0xb9, 0xdb, 0xff, 0x8b, 0xb9, 0xdb, 0xff, 0x8b, 0xb9, 0xdb, 0xff, 0x8b, 0xb9, 0xdb, 0xff, 0x8b, 0xb9, 0xdb, 0xff, 0x8b, 0xb9, 0xdb, 0xff, 0x8b, 0xb9, 0xdb, 0xff, 0x8b, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8b, 0xb9, 0xdb, 0xff, 0x8b, 0xb8, 0xdb, 0xff, 0x8a, 0xb8, 0xdb, 0xff, 0x8a, 0xb8, 0xdb, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x88, 0xb6, 0xda, 0xff, 0x88, 0xb6, 0xda, 0xff, 0x88, 0xb6, 0xda, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x88, 0xb6, 0xd9, 0xff, 0x8b, 0xb8, 0xda, 0xff, 0x92, 0xbc, 0xdc, 0xff, 0x99, 0xba, 0xd3, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xae, 0xcb, 0x68, 0x84, 0xb1, 0xd6, 0xff, 0x77, 0xac, 0xd5, 0xff, 0x71, 0xa9, 0xd4, 0xff, 0x6f, 0xa8, 0xd3, 0xff, 0x6f, 0xa8, 0xd4, 0xff, 0x70, 0xa8, 0xd4, 0xff, 0x71, 0xa9, 0xd4, 0xff, 0x72, 0xa9, 0xd4, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x74, 0xaa, 0xd4, 0xff, 0x75, 0xab, 0xd5, 0xff, 0x93, 0xbe, 0xde, 0xff, 0xa4, 0xc7, 0xe4, 0xff, 0xa2, 0xc7, 0xe3, 0xff, 0xa0, 0xc5, 0xe2, 0xff, 0x9e, 0xc4, 0xe2, 0xff, 0x9d, 0xc3, 0xe1, 0xff, 0x9b, 0xc2, 0xe1, 0xff, 0x9a, 0xc1, 0xe1, 0xff, 0x99, 0xc0, 0xe0, 0xff, 0x97, 0xbf, 0xdf, 0xff, 0x95, 0xbf, 0xdf, 0xff, 0x93, 0xbe, 0xde, 0xff, 0x91, 0xbc, 0xdd, 0xff, 0x8f, 0xbb, 0xdc, 0xff, 0x8c, 0xb9, 0xdc, 0xff, 0x83, 0xb3, 0xd8, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7f, 0xb1, 0xd8, 0xff, 0x7f, 0xb1, 0xd8, 0xff, 0x80, 0xb1, 0xd8, 0xff, 0x81, 0xb2, 0xd8, 0xff, 0x81, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x83, 0xb3, 0xd9, 0xff, 0x83, 0xb3, 0xd9, 0xff, 0x84, 0xb3, 0xd9, 0xff, 0x84, 0xb4, 0xd9, 0xff, 0x84, 0xb4, 0xd9, 0xff, 0x85, 0xb4, 0xd9, 0xff, 0x86, 0xb5, 0xda, 0xff, 0x86, 0xb5, 0xda, 0xff, 0x86, 0xb5, 0xda, 0xff, 0x85, 0xb5, 0xda, 0xff, 0x86, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xda, 0xff, 0x88, 0xb6, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb8, 0xdb, 0xff, 0x8a, 0xb8, 0xdb, 0xff, 0x8b, 0xb8, 0xdb, 0xff, 0x8b, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8b, 0xb9, 0xdb, 0xff, 0x8b, 0xb8, 0xdb, 0xff, 0x8a, 0xb8, 0xdb, 0xff, 0x8a, 0xb8, 0xdb, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb6, 0xda, 0xff, 0x88, 0xb6, 0xda, 0xff, 0x88, 0xb6, 0xda, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x89, 0xb6, 0xd9, 0xff, 0x8c, 0xb8, 0xda, 0xff, 0x94, 0xbd, 0xdc, 0xff, 0x97, 0xb6, 0xce, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xb7, 0xbb, 0x1b, 0x82, 0xab, 0xce, 0xfc, 0x77, 0xac, 0xd6, 0xff, 0x71, 0xa8, 0xd4, 0xff, 0x6f, 0xa7, 0xd3, 0xff, 0x6f, 0xa8, 0xd4, 0xff, 0x71, 0xa8, 0xd4, 0xff, 0x72, 0xa9, 0xd4, 0xff, 0x72, 0xaa, 0xd4, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x74, 0xab, 0xd5, 0xff, 0x75, 0xab, 0xd5, 0xff, 0x8e, 0xbb, 0xdd, 0xff, 0xa4, 0xc7, 0xe4, 0xff, 0xa2, 0xc7, 0xe3, 0xff, 0xa0, 0xc5, 0xe2, 0xff, 0x9e, 0xc4, 0xe2, 0xff, 0x9c, 0xc3, 0xe1, 0xff, 0x9b, 0xc2, 0xe1, 0xff, 0x9a, 0xc1, 0xe0, 0xff, 0x98, 0xc0, 0xe0, 0xff, 0x97, 0xbf, 0xdf, 0xff, 0x95, 0xbf, 0xdf, 0xff, 0x93, 0xbe, 0xde, 0xff, 0x91, 0xbc, 0xdd, 0xff, 0x8f, 0xbb, 0xdc, 0xff, 0x8c, 0xb9, 0xdc, 0xff, 0x84, 0xb4, 0xd9, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7f, 0xb0, 0xd7, 0xff, 0x7f, 0xb0, 0xd7, 0xff, 0x7f, 0xb0, 0xd7, 0xff, 0x7f, 0xb0, 0xd7, 0xff, 0x7f, 0xb0, 0xd7, 0xff, 0x7f, 0xb1, 0xd7, 0xff, 0x7f, 0xb1, 0xd7, 0xff, 0x7f, 0xb1, 0xd7, 0xff, 0x7f, 0xb1, 0xd7, 0xff, 0x7f, 0xb1, 0xd7, 0xff, 0x7f, 0xb1, 0xd8, 0xff, 0x80, 0xb1, 0xd8, 0xff, 0x81, 0xb2, 0xd8, 0xff, 0x81, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd9, 0xff, 0x83, 0xb3, 0xd9, 0xff, 0x84, 0xb4, 0xd9, 0xff, 0x85, 0xb5, 0xd9, 0xff, 0x86, 0xb5, 0xd9, 0xff, 0x87, 0xb6, 0xda, 0xff, 0x88, 0xb6, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb8, 0xda, 0xff, 0x8a, 0xb8, 0xdb, 0xff, 0x8b, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8b, 0xb9, 0xdb, 0xff, 0x8b, 0xb8, 0xdb, 0xff, 0x8a, 0xb8, 0xdb, 0xff, 0x8a, 0xb8, 0xdb, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb6, 0xda, 0xff, 0x88, 0xb6, 0xda, 0xff, 0x88, 0xb6, 0xda, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x88, 0xb6, 0xda, 0xff, 0x8a, 0xb7, 0xda, 0xff, 0x80, 0xa5, 0xc5, 0xff, 0x76, 0x8f, 0xa9, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xb5, 0xb5, 0x07, 0x81, 0xa4, 0xc4, 0xe8, 0x6d, 0x9c, 0xc7, 0xff, 0x6a, 0xa1, 0xce, 0xff, 0x6c, 0xa6, 0xd3, 0xff, 0x6f, 0xa7, 0xd3, 0xff, 0x70, 0xa8, 0xd4, 0xff, 0x72, 0xa9, 0xd4, 0xff, 0x73, 0xa9, 0xd4, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x74, 0xab, 0xd5, 0xff, 0x75, 0xab, 0xd5, 0xff, 0x89, 0xb8, 0xdb, 0xff, 0xa4, 0xc7, 0xe4, 0xff, 0xa2, 0xc7, 0xe3, 0xff, 0xa0, 0xc5, 0xe2, 0xff, 0x9e, 0xc4, 0xe2, 0xff, 0x9c, 0xc3, 0xe1, 0xff, 0x9b, 0xc2, 0xe1, 0xff, 0x99, 0xc1, 0xe0, 0xff, 0x98, 0xbf, 0xdf, 0xff, 0x96, 0xbf, 0xdf, 0xff, 0x94, 0xbe, 0xdf, 0xff, 0x92, 0xbd, 0xde, 0xff, 0x90, 0xbc, 0xdd, 0xff, 0x8f, 0xbb, 0xdc, 0xff, 0x8c, 0xb9, 0xdc, 0xff, 0x84, 0xb4, 0xd9, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7d, 0xb0, 0xd7, 0xff, 0x7d, 0xaf, 0xd7, 0xff, 0x7d, 0xaf, 0xd7, 0xff, 0x7c, 0xaf, 0xd7, 0xff, 0x7c, 0xaf, 0xd7, 0xff, 0x7b, 0xae, 0xd7, 0xff, 0x7b, 0xae, 0xd7, 0xff, 0x7b, 0xae, 0xd7, 0xff, 0x7c, 0xaf, 0xd7, 0xff, 0x7d, 0xaf, 0xd7, 0xff, 0x7e, 0xaf, 0xd7, 0xff, 0x7e, 0xb0, 0xd8, 0xff, 0x80, 0xb1, 0xd8, 0xff, 0x81, 0xb2, 0xd8, 0xff, 0x82, 0xb3, 0xd9, 0xff, 0x84, 0xb4, 0xd9, 0xff, 0x85, 0xb5, 0xd9, 0xff, 0x87, 0xb6, 0xda, 0xff, 0x88, 0xb7, 0xda, 0xff, 0x89, 0xb8, 0xda, 0xff, 0x8a, 0xb8, 0xdb, 0xff, 0x8b, 0xb9, 0xdb, 0xff, 0x8b, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8b, 0xb9, 0xdb, 0xff, 0x8b, 0xb8, 0xdb, 0xff, 0x8a, 0xb8, 0xdb, 0xff, 0x8a, 0xb8, 0xdb, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb6, 0xda, 0xff, 0x88, 0xb6, 0xda, 0xff, 0x88, 0xb6, 0xda, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x86, 0xb5, 0xd9, 0xff, 0x86, 0xb5, 0xd9, 0xff, 0x85, 0xb4, 0xd9, 0xff, 0x84, 0xb3, 0xd8, 0xff, 0x81, 0xb2, 0xd8, 0xff, 0x7d, 0xaf, 0xd7, 0xff, 0x70, 0xa0, 0xc8, 0xff, 0x5e, 0x87, 0xac, 0xff, 0x64, 0x86, 0xa5, 0xff, 0x69, 0x86, 0xa1, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xb1, 0xb1, 0x00, 0x84, 0xa6, 0xc4, 0xc8, 0x6e, 0x9b, 0xc4, 0xff, 0x64, 0x95, 0xc1, 0xff, 0x60, 0x94, 0xc2, 0xff, 0x65, 0x9b, 0xca, 0xff, 0x6c, 0xa4, 0xd1, 0xff, 0x70, 0xa8, 0xd4, 0xff, 0x72, 0xa9, 0xd4, 0xff, 0x73, 0xaa, 0xd5, 0xff, 0x74, 0xaa, 0xd5, 0xff, 0x75, 0xab, 0xd5, 0xff, 0x85, 0xb4, 0xda, 0xff, 0xa3, 0xc7, 0xe4, 0xff, 0xa2, 0xc6, 0xe3, 0xff, 0xa0, 0xc5, 0xe2, 0xff, 0x9e, 0xc4, 0xe2, 0xff, 0x9c, 0xc3, 0xe1, 0xff, 0x9b, 0xc2, 0xe1, 0xff, 0x99, 0xc0, 0xe0, 0xff, 0x97, 0xbf, 0xdf, 0xff, 0x95, 0xbf, 0xdf, 0xff, 0x93, 0xbe, 0xde, 0xff, 0x92, 0xbd, 0xde, 0xff, 0x90, 0xbc, 0xdd, 0xff, 0x8e, 0xbb, 0xdc, 0xff, 0x8c, 0xb9, 0xdc, 0xff, 0x83, 0xb3, 0xd8, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7d, 0xaf, 0xd7, 0xff, 0x7c, 0xaf, 0xd7, 0xff, 0x7b, 0xae, 0xd7, 0xff, 0x7b, 0xae, 0xd7, 0xff, 0x7a, 0xad, 0xd6, 0xff, 0x79, 0xad, 0xd6, 0xff, 0x79, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x79, 0xad, 0xd6, 0xff, 0x7a, 0xad, 0xd6, 0xff, 0x7b, 0xad, 0xd6, 0xff, 0x7b, 0xae, 0xd7, 0xff, 0x7d, 0xaf, 0xd7, 0xff, 0x7f, 0xb0, 0xd8, 0xff, 0x80, 0xb2, 0xd8, 0xff, 0x82, 0xb3, 0xd9, 0xff, 0x83, 0xb4, 0xd9, 0xff, 0x85, 0xb5, 0xd9, 0xff, 0x87, 0xb6, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb8, 0xdb, 0xff, 0x8a, 0xb8, 0xdb, 0xff, 0x8b, 0xb9, 0xdb, 0xff, 0x8c, 0xb9, 0xdb, 0xff, 0x8b, 0xb9, 0xdb, 0xff, 0x8b, 0xb8, 0xdb, 0xff, 0x8a, 0xb8, 0xdb, 0xff, 0x8a, 0xb8, 0xdb, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb6, 0xda, 0xff, 0x88, 0xb6, 0xda, 0xff, 0x87, 0xb6, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x86, 0xb5, 0xd9, 0xff, 0x86, 0xb5, 0xd9, 0xff, 0x85, 0xb5, 0xd9, 0xff, 0x85, 0xb4, 0xd9, 0xff, 0x84, 0xb4, 0xd8, 0xff, 0x84, 0xb3, 0xd8, 0xff, 0x83, 0xb3, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x80, 0xb1, 0xd8, 0xff, 0x7f, 0xb0, 0xd7, 0xff, 0x7c, 0xae, 0xd7, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x6f, 0xa5, 0xd0, 0xff, 0x5f, 0x91, 0xbc, 0xff, 0x4f, 0x7b, 0xa4, 0xff, 0x4c, 0x74, 0x9a, 0xff, 0x53, 0x79, 0x9d, 0xff, 0x68, 0x88, 0xa5, 0xff, 0x5d, 0x7d, 0x9c, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xa8, 0xc4, 0xa4, 0x71, 0x9d, 0xc6, 0xff, 0x64, 0x96, 0xc2, 0xff, 0x60, 0x93, 0xc0, 0xff, 0x5e, 0x91, 0xbf, 0xff, 0x5d, 0x90, 0xbf, 0xff, 0x61, 0x95, 0xc3, 0xff, 0x66, 0x9c, 0xc9, 0xff, 0x6d, 0xa3, 0xd0, 0xff, 0x71, 0xa9, 0xd3, 0xff, 0x73, 0xaa, 0xd4, 0xff, 0x7e, 0xb0, 0xd8, 0xff, 0xa3, 0xc7, 0xe4, 0xff, 0xa1, 0xc6, 0xe3, 0xff, 0x9f, 0xc5, 0xe2, 0xff, 0x9d, 0xc3, 0xe2, 0xff, 0x9b, 0xc2, 0xe1, 0xff, 0x9a, 0xc1, 0xe1, 0xff, 0x98, 0xc0, 0xe0, 0xff, 0x97, 0xbf, 0xdf, 0xff, 0x95, 0xbf, 0xdf, 0xff, 0x93, 0xbd, 0xde, 0xff, 0x91, 0xbc, 0xde, 0xff, 0x8f, 0xbb, 0xdd, 0xff, 0x8d, 0xba, 0xdc, 0xff, 0x8b, 0xb9, 0xdc, 0xff, 0x83, 0xb3, 0xd9, 0xff, 0x7d, 0xaf, 0xd7, 0xff, 0x7d, 0xb0, 0xd7, 0xff, 0x7d, 0xb0, 0xd7, 0xff, 0x7d, 0xb0, 0xd7, 0xff, 0x7d, 0xb0, 0xd7, 0xff, 0x7d, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7d, 0xaf, 0xd7, 0xff, 0x7c, 0xaf, 0xd7, 0xff, 0x7b, 0xaf, 0xd7, 0xff, 0x7b, 0xae, 0xd7, 0xff, 0x7a, 0xae, 0xd6, 0xff, 0x79, 0xad, 0xd6, 0xff, 0x79, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x79, 0xad, 0xd6, 0xff, 0x79, 0xad, 0xd6, 0xff, 0x7a, 0xad, 0xd7, 0xff, 0x7c, 0xaf, 0xd7, 0xff, 0x7d, 0xb0, 0xd8, 0xff, 0x7f, 0xb1, 0xd8, 0xff, 0x80, 0xb1, 0xd8, 0xff, 0x81, 0xb3, 0xd9, 0xff, 0x84, 0xb4, 0xd9, 0xff, 0x85, 0xb5, 0xd9, 0xff, 0x87, 0xb6, 0xda, 0xff, 0x88, 0xb6, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x89, 0xb7, 0xda, 0xff, 0x88, 0xb6, 0xda, 0xff, 0x87, 0xb6, 0xd9, 0xff, 0x87, 0xb5, 0xd9, 0xff, 0x86, 0xb4, 0xd9, 0xff, 0x85, 0xb4, 0xd9, 0xff, 0x84, 0xb4, 0xd8, 0xff, 0x83, 0xb3, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x80, 0xb1, 0xd8, 0xff, 0x7f, 0xb0, 0xd8, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7d, 0xaf, 0xd7, 0xff, 0x7b, 0xae, 0xd7, 0xff, 0x79, 0xad, 0xd6, 0xff, 0x77, 0xac, 0xd6, 0xff, 0x74, 0xab, 0xd5, 0xff, 0x70, 0xa8, 0xd3, 0xff, 0x66, 0x9c, 0xc8, 0xff, 0x5a, 0x8c, 0xb7, 0xff, 0x50, 0x7d, 0xa6, 0xff, 0x48, 0x71, 0x99, 0xff, 0x47, 0x70, 0x98, 0xff, 0x48, 0x71, 0x98, 0xff, 0x4c, 0x74, 0x9a, 0xff, 0x55, 0x7a, 0x9e, 0xff, 0x69, 0x88, 0xa4, 0xff, 0x46, 0x6f, 0x97, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xa9, 0xc3, 0x80, 0x74, 0xa0, 0xc7, 0xff, 0x66, 0x98, 0xc4, 0xff, 0x61, 0x94, 0xc1, 0xff, 0x5e, 0x92, 0xc0, 0xff, 0x5d, 0x91, 0xbf, 0xff, 0x5d, 0x90, 0xbf, 0xff, 0x5d, 0x90, 0xbf, 0xff, 0x5d, 0x90, 0xbf, 0xff, 0x5d, 0x90, 0xbf, 0xff, 0x61, 0x95, 0xc2, 0xff, 0x6c, 0x9e, 0xca, 0xff, 0x9c, 0xbf, 0xdd, 0xff, 0x9d, 0xc2, 0xe0, 0xff, 0x9d, 0xc3, 0xe2, 0xff, 0x9c, 0xc2, 0xe1, 0xff, 0x9b, 0xc1, 0xe1, 0xff, 0x99, 0xc0, 0xe0, 0xff, 0x97, 0xbf, 0xe0, 0xff, 0x95, 0xbf, 0xdf, 0xff, 0x93, 0xbe, 0xde, 0xff, 0x91, 0xbd, 0xde, 0xff, 0x90, 0xbc, 0xdd, 0xff, 0x8e, 0xba, 0xdc, 0xff, 0x8c, 0xb9, 0xdc, 0xff, 0x89, 0xb8, 0xdb, 0xff, 0x83, 0xb3, 0xd9, 0xff, 0x7b, 0xae, 0xd6, 0xff, 0x7b, 0xaf, 0xd7, 0xff, 0x7c, 0xaf, 0xd7, 0xff, 0x7c, 0xaf, 0xd7, 0xff, 0x7c, 0xaf, 0xd7, 0xff, 0x7c, 0xaf, 0xd7, 0xff, 0x7d, 0xaf, 0xd7, 0xff, 0x7d, 0xb0, 0xd7, 0xff, 0x7c, 0xaf, 0xd7, 0xff, 0x7b, 0xae, 0xd7, 0xff, 0x7a, 0xae, 0xd6, 0xff, 0x7a, 0xae, 0xd6, 0xff, 0x79, 0xad, 0xd6, 0xff, 0x79, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x79, 0xad, 0xd6, 0xff, 0x79, 0xad, 0xd7, 0xff, 0x7b, 0xae, 0xd7, 0xff, 0x7c, 0xaf, 0xd7, 0xff, 0x7d, 0xb0, 0xd8, 0xff, 0x7e, 0xb0, 0xd8, 0xff, 0x7f, 0xb1, 0xd8, 0xff, 0x80, 0xb2, 0xd8, 0xff, 0x81, 0xb2, 0xd9, 0xff, 0x82, 0xb3, 0xd9, 0xff, 0x83, 0xb3, 0xd9, 0xff, 0x83, 0xb3, 0xd9, 0xff, 0x84, 0xb3, 0xd9, 0xff, 0x83, 0xb3, 0xd9, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x82, 0xb2, 0xd8, 0xff, 0x81, 0xb1, 0xd8, 0xff, 0x80, 0xb1, 0xd8, 0xff, 0x7e, 0xb0, 0xd7, 0xff, 0x7d, 0xaf, 0xd7, 0xff, 0x7c, 0xae, 0xd7, 0xff, 0x7b, 0xae, 0xd6, 0xff, 0x79, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x77, 0xac, 0xd6, 0xff, 0x75, 0xab, 0xd5, 0xff, 0x74, 0xaa, 0xd5, 0xff, 0x71, 0xa8, 0xd4, 0xff, 0x6d, 0xa6, 0xd2, 0xff, 0x68, 0xa0, 0xcd, 0xff, 0x60, 0x96, 0xc2, 0xff, 0x59, 0x8a, 0xb6, 0xff, 0x51, 0x7f, 0xa9, 0xff, 0x4a, 0x75, 0x9c, 0xff, 0x48, 0x71, 0x99, 0xff, 0x47, 0x70, 0x98, 0xff, 0x47, 0x70, 0x98, 0xff, 0x47, 0x70, 0x98, 0xff, 0x47, 0x70, 0x98, 0xff, 0x49, 0x71, 0x99, 0xff, 0x4d, 0x75, 0x9b, 0xff, 0x57, 0x7c, 0x9f, 0xff, 0x67, 0x86, 0xa3, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xaa, 0xc2, 0x5c, 0x77, 0xa3, 0xc9, 0xff, 0x68, 0x9a, 0xc5, 0xff, 0x62, 0x95, 0xc2, 0xff, 0x5f, 0x93, 0xc0, 0xff, 0x5d, 0x91, 0xc0, 0xff, 0x5d, 0x91, 0xbf, 0xff, 0x5d, 0x90, 0xbf, 0xff, 0x5d, 0x90, 0xbf, 0xff, 0x5d, 0x90, 0xbf, 0xff, 0x5c, 0x8f, 0xbe, 0xff, 0x5f, 0x91, 0xbf, 0xff, 0x91, 0xb3, 0xd3, 0xff, 0x90, 0xb2, 0xd2, 0xff, 0x8e, 0xb2, 0xd2, 0xff, 0x8e, 0xb3, 0xd3, 0xff, 0x8e, 0xb5, 0xd6, 0xff, 0x8f, 0xb6, 0xd8, 0xff, 0x8f, 0xb8, 0xd9, 0xff, 0x90, 0xba, 0xdb, 0xff, 0x90, 0xbb, 0xdc, 0xff, 0x8f, 0xbb, 0xdd, 0xff, 0x8d, 0xba, 0xdc, 0xff, 0x8a, 0xb8, 0xdc, 0xff, 0x89, 0xb7, 0xdb, 0xff, 0x87, 0xb6, 0xda, 0xff, 0x81, 0xb2, 0xd8, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x79, 0xad, 0xd6, 0xff, 0x79, 0xad, 0xd6, 0xff, 0x79, 0xad, 0xd6, 0xff, 0x7a, 0xae, 0xd6, 0xff, 0x7a, 0xae, 0xd6, 0xff, 0x7b, 0xae, 0xd6, 0xff, 0x7a, 0xae, 0xd6, 0xff, 0x79, 0xad, 0xd6, 0xff, 0x79, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x79, 0xad, 0xd6, 0xff, 0x79, 0xad, 0xd7, 0xff, 0x79, 0xad, 0xd7, 0xff, 0x7a, 0xae, 0xd7, 0xff, 0x79, 0xad, 0xd7, 0xff, 0x7a, 0xad, 0xd7, 0xff, 0x7a, 0xad, 0xd7, 0xff, 0x7a, 0xad, 0xd7, 0xff, 0x7a, 0xad, 0xd7, 0xff, 0x7a, 0xad, 0xd7, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x77, 0xac, 0xd6, 0xff, 0x75, 0xab, 0xd5, 0xff, 0x73, 0xaa, 0xd5, 0xff, 0x72, 0xa9, 0xd4, 0xff, 0x6f, 0xa8, 0xd3, 0xff, 0x6e, 0xa7, 0xd3, 0xff, 0x6c, 0xa6, 0xd3, 0xff, 0x69, 0xa2, 0xd0, 0xff, 0x65, 0x9d, 0xca, 0xff, 0x61, 0x96, 0xc2, 0xff, 0x5b, 0x8e, 0xbb, 0xff, 0x55, 0x87, 0xb2, 0xff, 0x51, 0x7e, 0xa9, 0xff, 0x4c, 0x77, 0xa0, 0xff, 0x49, 0x73, 0x9b, 0xff, 0x49, 0x72, 0x9b, 0xff, 0x49, 0x72, 0x9b, 0xff, 0x48, 0x72, 0x9a, 0xff, 0x48, 0x71, 0x99, 0xff, 0x48, 0x71, 0x99, 0xff, 0x48, 0x71, 0x99, 0xff, 0x48, 0x71, 0x99, 0xff, 0x48, 0x71, 0x98, 0xff, 0x48, 0x71, 0x98, 0xff, 0x49, 0x72, 0x99, 0xff, 0x4e, 0x76, 0x9b, 0xff, 0x5a, 0x7e, 0xa1, 0xff, 0x68, 0x87, 0xa3, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xaa, 0xc0, 0x37, 0x7b, 0xa5, 0xc9, 0xff, 0x6b, 0x9b, 0xc6, 0xff, 0x63, 0x96, 0xc3, 0xff, 0x5f, 0x93, 0xc1, 0xff, 0x5e, 0x92, 0xc0, 0xff, 0x5d, 0x91, 0xc0, 0xff, 0x5d, 0x91, 0xbf, 0xff, 0x5d, 0x90, 0xbf, 0xff, 0x5d, 0x90, 0xbf, 0xff, 0x5c, 0x8f, 0xbe, 0xff, 0x5d, 0x90, 0xbe, 0xff, 0x8d, 0xb1, 0xd2, 0xff, 0x90, 0xb2, 0xd2, 0xff, 0x8d, 0xb1, 0xd2, 0xff, 0x8a, 0xae, 0xd0, 0xff, 0x88, 0xad, 0xcf, 0xff, 0x85, 0xac, 0xce, 0xff, 0x82, 0xa9, 0xcd, 0xff, 0x7f, 0xa7, 0xcc, 0xff, 0x7c, 0xa6, 0xcb, 0xff, 0x7b, 0xa5, 0xcb, 0xff, 0x7a, 0xa6, 0xcc, 0xff, 0x7a, 0xa7, 0xce, 0xff, 0x79, 0xa7, 0xce, 0xff, 0x79, 0xa8, 0xd0, 0xff, 0x74, 0xa5, 0xce, 0xff, 0x6d, 0xa2, 0xcd, 0xff, 0x6f, 0xa4, 0xcf, 0xff, 0x72, 0xa7, 0xd1, 0xff, 0x75, 0xa9, 0xd2, 0xff, 0x77, 0xac, 0xd5, 0xff, 0x77, 0xad, 0xd5, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x78, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x77, 0xac, 0xd5, 0xff, 0x77, 0xac, 0xd5, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x77, 0xad, 0xd6, 0xff, 0x77, 0xac, 0xd6, 0xff, 0x77, 0xac, 0xd5, 0xff, 0x76, 0xac, 0xd5, 0xff, 0x76, 0xab, 0xd5, 0xff, 0x75, 0xab, 0xd5, 0xff, 0x74, 0xab, 0xd5, 0xff, 0x73, 0xaa, 0xd5, 0xff, 0x72, 0xa9, 0xd5, 0xff, 0x71, 0xa8, 0xd4, 0xff, 0x70, 0xa8, 0xd4, 0xff, 0x6e, 0xa7, 0xd3, 0xff, 0x6e, 0xa6, 0xd3, 0xff, 0x6c, 0xa5, 0xd2, 0xff, 0x6a, 0xa2, 0xd0, 0xff, 0x66, 0x9e, 0xcc, 0xff, 0x64, 0x9b, 0xc9, 0xff, 0x60, 0x96, 0xc3, 0xff, 0x5d, 0x92, 0xbf, 0xff, 0x5a, 0x8d, 0xba, 0xff, 0x56, 0x87, 0xb3, 0xff, 0x53, 0x83, 0xae, 0xff, 0x51, 0x7f, 0xaa, 0xff, 0x4d, 0x78, 0xa2, 0xff, 0x4c, 0x77, 0x9f, 0xff, 0x4b, 0x75, 0x9e, 0xff, 0x4b, 0x75, 0x9d, 0xff, 0x4a, 0x75, 0x9d, 0xff, 0x4a, 0x75, 0x9d, 0xff, 0x4a, 0x74, 0x9c, 0xff, 0x4a, 0x74, 0x9c, 0xff, 0x4a, 0x74, 0x9b, 0xff, 0x49, 0x73, 0x9b, 0xff, 0x49, 0x73, 0x9b, 0xff, 0x49, 0x72, 0x9b, 0xff, 0x48, 0x72, 0x9a, 0xff, 0x48, 0x72, 0x9a, 0xff, 0x48, 0x71, 0x99, 0xff, 0x48, 0x71, 0x99, 0xff, 0x48, 0x71, 0x99, 0xff, 0x49, 0x72, 0x98, 0xff, 0x4a, 0x72, 0x99, 0xff, 0x4f, 0x76, 0x9c, 0xff, 0x5d, 0x80, 0xa2, 0xff, 0x66, 0x86, 0xa5, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xa7, 0xbc, 0x13, 0x80, 0xa7, 0xc8, 0xff, 0x6c, 0x9c, 0xc7, 0xff, 0x64, 0x97, 0xc4, 0xff, 0x60, 0x94, 0xc2, 0xff, 0x5e, 0x93, 0xc1, 0xff, 0x5e, 0x92, 0xc0, 0xff, 0x5d, 0x91, 0xc0, 0xff, 0x5d, 0x91, 0xbf, 0xff, 0x5d, 0x90, 0xbf, 0xff, 0x5c, 0x8f, 0xbe, 0xff, 0x5c, 0x8f, 0xbe, 0xff, 0x89, 0xad, 0xd0, 0xff, 0x90, 0xb2, 0xd2, 0xff, 0x8d, 0xb1, 0xd2, 0xff, 0x8a, 0xae, 0xd0, 0xff, 0x88, 0xad, 0xcf, 0xff, 0x85, 0xac, 0xce, 0xff, 0x82, 0xa9, 0xcd, 0xff, 0x7f, 0xa7, 0xcc, 0xff, 0x7c, 0xa6, 0xcb, 0xff, 0x79, 0xa3, 0xc9, 0xff, 0x77, 0xa1, 0xc8, 0xff, 0x74, 0x9f, 0xc7, 0xff, 0x71, 0x9d, 0xc6, 0xff, 0x6e, 0x9b, 0xc5, 0xff, 0x65, 0x96, 0xc1, 0xff, 0x5c, 0x8f, 0xbe, 0xff, 0x5c, 0x8e, 0xbd, 0xff, 0x5b, 0x8e, 0xbd, 0xff, 0x5b, 0x8e, 0xbc, 0xff, 0x5b, 0x8d, 0xbc, 0xff, 0x5c, 0x8f, 0xbc, 0xff, 0x5d, 0x90, 0xbe, 0xff, 0x5e, 0x91, 0xbe, 0xff, 0x60, 0x92, 0xbf, 0xff, 0x61, 0x93, 0xbf, 0xff, 0x62, 0x95, 0xc0, 0xff, 0x62, 0x95, 0xc0, 0xff, 0x62, 0x94, 0xc0, 0xff, 0x62, 0x94, 0xbf, 0xff, 0x64, 0x97, 0xc2, 0xff, 0x64, 0x97, 0xc2, 0xff, 0x64, 0x97, 0xc2, 0xff, 0x65, 0x98, 0xc2, 0xff, 0x64, 0x97, 0xc2, 0xff, 0x64, 0x97, 0xc2, 0xff, 0x64, 0x97, 0xc1, 0xff, 0x63, 0x95, 0xbf, 0xff, 0x62, 0x94, 0xbf, 0xff, 0x62, 0x93, 0xbf, 0xff, 0x5f, 0x91, 0xbd, 0xff, 0x5e, 0x8f, 0xbb, 0xff, 0x5c, 0x8d, 0xba, 0xff, 0x5a, 0x8b, 0xb8, 0xff, 0x58, 0x89, 0xb5, 0xff, 0x56, 0x87, 0xb3, 0xff, 0x55, 0x85, 0xb0, 0xff, 0x53, 0x82, 0xad, 0xff, 0x52, 0x80, 0xab, 0xff, 0x50, 0x7d, 0xa8, 0xff, 0x50, 0x7c, 0xa7, 0xff, 0x4f, 0x7b, 0xa6, 0xff, 0x4f, 0x7b, 0xa5, 0xff, 0x4f, 0x7a, 0xa5, 0xff, 0x4e, 0x79, 0xa4, 0xff, 0x4e, 0x79, 0xa3, 0xff, 0x4d, 0x78, 0xa2, 0xff, 0x4d, 0x77, 0xa2, 0xff, 0x4d, 0x77, 0xa1, 0xff, 0x4c, 0x77, 0xa0, 0xff, 0x4c, 0x77, 0xa0, 0xff, 0x4c, 0x76, 0x9f, 0xff, 0x4b, 0x76, 0x9f, 0xff, 0x4b, 0x76, 0x9e, 0xff, 0x4b, 0x75, 0x9e, 0xff, 0x4b, 0x75, 0x9d, 0xff, 0x4a, 0x75, 0x9d, 0xff, 0x4a, 0x74, 0x9c, 0xff, 0x4a, 0x74, 0x9b, 0xff, 0x49, 0x73, 0x9b, 0xff, 0x49, 0x73, 0x9b, 0xff, 0x48, 0x72, 0x9a, 0xff, 0x48, 0x72, 0x9a, 0xff, 0x48, 0x72, 0x9a, 0xff, 0x48, 0x71, 0x99, 0xff, 0x48, 0x71, 0x99, 0xff, 0x49, 0x72, 0x99, 0xff, 0x4b, 0x73, 0x9a, 0xff, 0x51, 0x77, 0x9c, 0xff, 0x62, 0x83, 0xa3, 0xff, 0x64, 0x82, 0x9f, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xb0, 0xb0, 0x03, 0x85, 0xa9, 0xc8, 0xeb, 0x70, 0x9f, 0xc9, 0xff, 0x64, 0x98, 0xc5, 0xff, 0x60, 0x95, 0xc3, 0xff, 0x5f, 0x93, 0xc2, 0xff, 0x5e, 0x93, 0xc1, 0xff, 0x5e, 0x92, 0xc0, 0xff, 0x5d, 0x91, 0xc0, 0xff, 0x5d, 0x91, 0xbf, 0xff, 0x5d, 0x90, 0xbf, 0xff, 0x5d, 0x90, 0xbf, 0xff, 0x84, 0xab, 0xce, 0xff, 0x90, 0xb3, 0xd2, 0xff, 0x8d, 0xb1, 0xd2, 0xff, 0x8a, 0xaf, 0xd1, 0xff, 0x88, 0xad, 0xd0, 0xff, 0x86, 0xac, 0xcf, 0xff, 0x82, 0xaa, 0xcd, 0xff, 0x80, 0xa8, 0xcc, 0xff, 0x7d, 0xa6, 0xcb, 0xff, 0x7a, 0xa4, 0xca, 0xff, 0x77, 0xa2, 0xc9, 0xff, 0x74, 0xa0, 0xc8, 0xff, 0x72, 0x9e, 0xc6, 0xff, 0x6f, 0x9b, 0xc5, 0xff, 0x68, 0x98, 0xc2, 0xff, 0x5c, 0x8f, 0xbe, 0xff, 0x5c, 0x8e, 0xbd, 0xff, 0x5c, 0x8e, 0xbd, 0xff, 0x5b, 0x8e, 0xbc, 0xff, 0x5b, 0x8d, 0xbc, 0xff, 0x5b, 0x8d, 0xbc, 0xff, 0x5b, 0x8d, 0xbb, 0xff, 0x5a, 0x8c, 0xba, 0xff, 0x5a, 0x8c, 0xba, 0xff, 0x5a, 0x8b, 0xb9, 0xff, 0x59, 0x8b, 0xb8, 0xff, 0x59, 0x8a, 0xb8, 0xff, 0x59, 0x8a, 0xb7, 0xff, 0x59, 0x8a, 0xb7, 0xff, 0x58, 0x89, 0xb6, 0xff, 0x58, 0x89, 0xb5, 0xff, 0x57, 0x89, 0xb4, 0xff, 0x57, 0x88, 0xb4, 0xff, 0x56, 0x87, 0xb3, 0xff, 0x56, 0x86, 0xb2, 0xff, 0x55, 0x86, 0xb1, 0xff, 0x55, 0x85, 0xb0, 0xff, 0x54, 0x84, 0xb0, 0xff, 0x54, 0x84, 0xaf, 0xff, 0x54, 0x83, 0xae, 0xff, 0x53, 0x82, 0xad, 0xff, 0x53, 0x81, 0xad, 0xff, 0x52, 0x81, 0xad, 0xff, 0x52, 0x80, 0xac, 0xff, 0x52, 0x7f, 0xab, 0xff, 0x52, 0x7f, 0xaa, 0xff, 0x51, 0x7e, 0xaa, 0xff, 0x51, 0x7d, 0xa9, 0xff, 0x51, 0x7d, 0xa8, 0xff, 0x50, 0x7c, 0xa7, 0xff, 0x50, 0x7c, 0xa7, 0xff, 0x4f, 0x7b, 0xa6, 0xff, 0x4f, 0x7b, 0xa5, 0xff, 0x4f, 0x7a, 0xa5, 0xff, 0x4e, 0x79, 0xa4, 0xff, 0x4e, 0x79, 0xa3, 0xff, 0x4e, 0x78, 0xa3, 0xff, 0x4d, 0x78, 0xa2, 0xff, 0x4d, 0x77, 0xa1, 0xff, 0x4d, 0x77, 0xa1, 0xff, 0x4c, 0x77, 0xa0, 0xff, 0x4c, 0x77, 0x9f, 0xff, 0x4b, 0x76, 0x9f, 0xff, 0x4b, 0x75, 0x9e, 0xff, 0x4b, 0x75, 0x9d, 0xff, 0x4a, 0x74, 0x9c, 0xff, 0x4a, 0x74, 0x9b, 0xff, 0x49, 0x73, 0x9b, 0xff, 0x49, 0x73, 0x9b, 0xff, 0x49, 0x73, 0x9b, 0xff, 0x48, 0x72, 0x9a, 0xff, 0x48, 0x72, 0x9a, 0xff, 0x48, 0x71, 0x99, 0xff, 0x48, 0x71, 0x99, 0xff, 0x48, 0x71, 0x98, 0xff, 0x48, 0x71, 0x98, 0xff, 0x4b, 0x73, 0x9a, 0xff, 0x52, 0x78, 0x9c, 0xff, 0x6a, 0x89, 0xa5, 0xff, 0x5c, 0x7b, 0x9b, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xaa, 0xc6, 0xc8, 0x74, 0xa1, 0xca, 0xff, 0x66, 0x9a, 0xc6, 0xff, 0x61, 0x96, 0xc4, 0xff, 0x5f, 0x94, 0xc3, 0xff, 0x5e, 0x93, 0xc2, 0xff, 0x5e, 0x93, 0xc1, 0xff, 0x5e, 0x92, 0xc1, 0xff, 0x5e, 0x92, 0xc0, 0xff, 0x5d, 0x91, 0xbf, 0xff, 0x5d, 0x91, 0xbf, 0xff, 0x7e, 0xa8, 0xcd, 0xff, 0x90, 0xb4, 0xd3, 0xff, 0x8e, 0xb2, 0xd2, 0xff, 0x8b, 0xb0, 0xd2, 0xff, 0x89, 0xae, 0xd1, 0xff, 0x86, 0xad, 0xd0, 0xff, 0x83, 0xab, 0xce, 0xff, 0x80, 0xa9, 0xcd, 0xff, 0x7d, 0xa7, 0xcc, 0xff, 0x7a, 0xa5, 0xcb, 0xff, 0x77, 0xa3, 0xca, 0xff, 0x75, 0xa1, 0xc8, 0xff, 0x72, 0x9f, 0xc7, 0xff, 0x6f, 0x9d, 0xc6, 0xff, 0x6a, 0x9a, 0xc4, 0xff, 0x5d, 0x90, 0xbf, 0xff, 0x5d, 0x90, 0xbf, 0xff, 0x5c, 0x8f, 0xbf, 0xff, 0x5c, 0x8f, 0xbe, 0xff, 0x5c, 0x8f, 0xbe, 0xff, 0x5c, 0x8f, 0xbe, 0xff, 0x5c, 0x8e, 0xbd, 0xff, 0x5b, 0x8d, 0xbc, 0xff, 0x5b, 0x8d, 0xbb, 0xff, 0x5a, 0x8c, 0xbb, 0xff, 0x5a, 0x8c, 0xba, 0xff, 0x5a, 0x8b, 0xb9, 0xff, 0x59, 0x8b, 0xb8, 0xff, 0x59, 0x8a, 0xb7, 0xff, 0x58, 0x89, 0xb6, 0xff, 0x58, 0x89, 0xb6, 0xff, 0x57, 0x89, 0xb5, 0xff, 0x57, 0x88, 0xb4, 0xff, 0x56, 0x87, 0xb3, 0xff, 0x56, 0x87, 0xb2, 0xff, 0x56, 0x86, 0xb2, 0xff, 0x55, 0x85, 0xb1, 0xff, 0x55, 0x84, 0xb0, 0xff, 0x54, 0x84, 0xaf, 0xff, 0x54, 0x83, 0xae, 0xff, 0x53, 0x82, 0xad, 0xff, 0x53, 0x81, 0xad, 0xff, 0x52, 0x81, 0xad, 0xff, 0x52, 0x80, 0xac, 0xff, 0x52, 0x7f, 0xab, 0xff, 0x52, 0x7f, 0xaa, 0xff, 0x51, 0x7e, 0xa9, 0xff, 0x50, 0x7d, 0xa8, 0xff, 0x50, 0x7d, 0xa8, 0xff, 0x50, 0x7c, 0xa7, 0xff, 0x50, 0x7c, 0xa6, 0xff, 0x4f, 0x7b, 0xa6, 0xff, 0x4f, 0x7b, 0xa5, 0xff, 0x4f, 0x7a, 0xa4, 0xff, 0x4e, 0x79, 0xa4, 0xff, 0x4e, 0x79, 0xa3, 0xff, 0x4e, 0x78, 0xa2, 0xff, 0x4d, 0x78, 0xa2, 0xff, 0x4d, 0x77, 0xa1, 0xff, 0x4c, 0x77, 0xa0, 0xff, 0x4c, 0x77, 0x9f, 0xff, 0x4c, 0x76, 0x9f, 0xff, 0x4b, 0x76, 0x9e, 0xff, 0x4b, 0x75, 0x9d, 0xff, 0x4a, 0x74, 0x9c, 0xff, 0x4a, 0x74, 0x9b, 0xff, 0x49, 0x73, 0x9b, 0xff, 0x49, 0x73, 0x9b, 0xff, 0x49, 0x72, 0x9a, 0xff, 0x48, 0x72, 0x9a, 0xff, 0x48, 0x71, 0x99, 0xff, 0x48, 0x71, 0x99, 0xff, 0x48, 0x71, 0x98, 0xff, 0x47, 0x70, 0x98, 0xff, 0x47, 0x70, 0x97, 0xff, 0x48, 0x71, 0x97, 0xff, 0x4c, 0x74, 0x9a, 0xff, 0x56, 0x7a, 0x9e, 0xff, 0x70, 0x8b, 0xa6, 0xff, 0x48, 0x70, 0x96, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xaa, 0xc4, 0xa4, 0x79, 0xa5, 0xcb, 0xff, 0x69, 0x9b, 0xc7, 0xff, 0x62, 0x97, 0xc5, 0xff, 0x60, 0x95, 0xc4, 0xff, 0x5f, 0x94, 0xc3, 0xff, 0x5f, 0x94, 0xc2, 0xff, 0x5e, 0x93, 0xc2, 0xff, 0x5e, 0x93, 0xc1, 0xff, 0x5e, 0x92, 0xc1, 0xff, 0x5e, 0x92, 0xc0, 0xff, 0x7a, 0xa5, 0xcc, 0xff, 0x91, 0xb4, 0xd4, 0xff, 0x8e, 0xb3, 0xd3, 0xff, 0x8b, 0xb0, 0xd2, 0xff, 0x89, 0xaf, 0xd2, 0xff, 0x86, 0xad, 0xd1, 0xff, 0x83, 0xab, 0xcf, 0xff, 0x80, 0xa9, 0xce, 0xff, 0x7d, 0xa7, 0xcd, 0xff, 0x7a, 0xa5, 0xcc, 0xff, 0x78, 0xa3, 0xcb, 0xff, 0x75, 0xa1, 0xc9, 0xff, 0x73, 0x9f, 0xc8, 0xff, 0x6f, 0x9d, 0xc7, 0xff, 0x6a, 0x9b, 0xc5, 0xff, 0x5d, 0x91, 0xbf, 0xff, 0x5d, 0x91, 0xbf, 0xff, 0x5d, 0x90, 0xbf, 0xff, 0x5d, 0x90, 0xbf, 0xff, 0x5d, 0x90, 0xbf, 0xff, 0x5c, 0x8f, 0xbf, 0xff, 0x5c, 0x8f, 0xbe, 0xff, 0x5c, 0x8e, 0xbd, 0xff, 0x5b, 0x8e, 0xbd, 0xff, 0x5b, 0x8d, 0xbc, 0xff, 0x5a, 0x8d, 0xbb, 0xff, 0x5a, 0x8c, 0xba, 0xff, 0x5a, 0x8c, 0xb9, 0xff, 0x59, 0x8b, 0xb8, 0xff, 0x58, 0x8a, 0xb7, 0xff, 0x58, 0x89, 0xb6, 0xff, 0x58, 0x89, 0xb6, 0xff, 0x57, 0x89, 0xb5, 0xff, 0x57, 0x88, 0xb4, 0xff, 0x56, 0x87, 0xb3, 0xff, 0x56, 0x86, 0xb2, 0xff, 0x55, 0x85, 0xb1, 0xff, 0x55, 0x85, 0xb0, 0xff, 0x54, 0x84, 0xaf, 0xff, 0x54, 0x83, 0xae, 0xff, 0x53, 0x82, 0xae, 0xff, 0x53, 0x82, 0xad, 0xff, 0x52, 0x81, 0xad, 0xff, 0x52, 0x80, 0xac, 0xff, 0x52, 0x7f, 0xaa, 0xff, 0x51, 0x7e, 0xaa, 0xff, 0x51, 0x7e, 0xa9, 0xff, 0x50, 0x7d, 0xa8, 0xff, 0x50, 0x7d, 0xa7, 0xff, 0x50, 0x7c, 0xa7, 0xff, 0x50, 0x7b, 0xa6, 0xff, 0x4f, 0x7b, 0xa5, 0xff, 0x4f, 0x7a, 0xa5, 0xff, 0x4f, 0x7a, 0xa4, 0xff, 0x4e, 0x79, 0xa3, 0xff, 0x4e, 0x79, 0xa3, 0xff, 0x4d, 0x78, 0xa2, 0xff, 0x4d, 0x77, 0xa1, 0xff, 0x4d, 0x77, 0xa0, 0xff, 0x4c, 0x77, 0x9f, 0xff, 0x4c, 0x76, 0x9f, 0xff, 0x4b, 0x76, 0x9e, 0xff, 0x4b, 0x75, 0x9d, 0xff, 0x4a, 0x74, 0x9c, 0xff, 0x4a, 0x74, 0x9b, 0xff, 0x49, 0x73, 0x9b, 0xff, 0x49, 0x73, 0x9a, 0xff, 0x49, 0x72, 0x9a, 0xff, 0x48, 0x72, 0x99, 0xff, 0x48, 0x71, 0x99, 0xff, 0x48, 0x71, 0x98, 0xff, 0x47, 0x70, 0x98, 0xff, 0x47, 0x70, 0x97, 0xff, 0x47, 0x70, 0x97, 0xff, 0x47, 0x70, 0x97, 0xff, 0x49, 0x71, 0x98, 0xff, 0x4e, 0x75, 0x9a, 0xff, 0x5e, 0x80, 0xa1, 0xff, 0x6d, 0x89, 0xa3, 0xf8, 0x47, 0x6e, 0x94, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xa7, 0xc0, 0x80, 0x80, 0xa8, 0xca, 0xff, 0x6c, 0x9d, 0xc9, 0xff, 0x64, 0x98, 0xc6, 0xff, 0x60, 0x96, 0xc4, 0xff, 0x5f, 0x95, 0xc4, 0xff, 0x5f, 0x95, 0xc3, 0xff, 0x5f, 0x94, 0xc3, 0xff, 0x5f, 0x94, 0xc2, 0xff, 0x5e, 0x93, 0xc2, 0xff, 0x5e, 0x93, 0xc2, 0xff, 0x75, 0xa2, 0xca, 0xff, 0x91, 0xb5, 0xd5, 0xff, 0x8e, 0xb3, 0xd4, 0xff, 0x8b, 0xb1, 0xd3, 0xff, 0x89, 0xaf, 0xd2, 0xff, 0x86, 0xad, 0xd2, 0xff, 0x84, 0xac, 0xd0, 0xff, 0x81, 0xaa, 0xcf, 0xff, 0x7e, 0xa8, 0xce, 0xff, 0x7b, 0xa6, 0xcd, 0xff, 0x78, 0xa4, 0xcc, 0xff, 0x76, 0xa2, 0xca, 0xff, 0x73, 0xa0, 0xc9, 0xff, 0x70, 0x9e, 0xc8, 0xff, 0x6a, 0x9b, 0xc5, 0xff, 0x5e, 0x92, 0xc1, 0xff, 0x5e, 0x92, 0xc0, 0xff, 0x5d, 0x91, 0xc0, 0xff, 0x5d, 0x91, 0xc0, 0xff, 0x5d, 0x91, 0xbf, 0xff, 0x5d, 0x90, 0xbf, 0xff, 0x5c, 0x90, 0xbf, 0xff, 0x5c, 0x8f, 0xbe, 0xff, 0x5c, 0x8f, 0xbe, 0xff, 0x5b, 0x8e, 0xbd, 0xff, 0x5b, 0x8e, 0xbc, 0xff, 0x5a, 0x8d, 0xbb, 0xff, 0x5a, 0x8c, 0xba, 0xff, 0x59, 0x8b, 0xb9, 0xff, 0x59, 0x8a, 0xb8, 0xff, 0x58, 0x8a, 0xb7, 0xff, 0x58, 0x89, 0xb6, 0xff, 0x57, 0x89, 0xb5, 0xff, 0x57, 0x88, 0xb5, 0xff, 0x56, 0x87, 0xb3, 0xff, 0x56, 0x86, 0xb2, 0xff, 0x55, 0x85, 0xb1, 0xff, 0x55, 0x85, 0xb0, 0xff, 0x54, 0x84, 0xaf, 0xff, 0x54, 0x83, 0xaf, 0xff, 0x53, 0x83, 0xae, 0xff, 0x53, 0x82, 0xad, 0xff, 0x52, 0x81, 0xac, 0xff, 0x52, 0x7f, 0xab, 0xff, 0x52, 0x7f, 0xaa, 0xff, 0x51, 0x7e, 0xa9, 0xff, 0x51, 0x7e, 0xa8, 0xff, 0x50, 0x7d, 0xa7, 0xff, 0x50, 0x7c, 0xa7, 0xff, 0x50, 0x7c, 0xa6, 0xff, 0x4f, 0x7b, 0xa5, 0xff, 0x4f, 0x7b, 0xa5, 0xff, 0x4f, 0x7a, 0xa4, 0xff, 0x4e, 0x79, 0xa3, 0xff, 0x4e, 0x79, 0xa3, 0xff, 0x4e, 0x78, 0xa2, 0xff, 0x4d, 0x77, 0xa1, 0xff, 0x4d, 0x77, 0xa0, 0xff, 0x4c, 0x77, 0x9f, 0xff, 0x4c, 0x76, 0x9f, 0xff, 0x4b, 0x76, 0x9e, 0xff, 0x4b, 0x75, 0x9d, 0xff, 0x4a, 0x74, 0x9c, 0xff, 0x4a, 0x74, 0x9b, 0xff, 0x49, 0x73, 0x9b, 0xff, 0x49, 0x72, 0x9a, 0xff, 0x49, 0x72, 0x9a, 0xff, 0x48, 0x71, 0x99, 0xff, 0x48, 0x71, 0x98, 0xff, 0x47, 0x70, 0x98, 0xff, 0x47, 0x70, 0x97, 0xff, 0x47, 0x6f, 0x97, 0xff, 0x47, 0x6f, 0x96, 0xff, 0x47, 0x6f, 0x96, 0xff, 0x47, 0x6f, 0x96, 0xff, 0x4a, 0x71, 0x98, 0xff, 0x52, 0x77, 0x9b, 0xff, 0x64, 0x85, 0xa4, 0xff, 0x6e, 0x89, 0xa3, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xa4, 0xbf, 0x5c, 0x87, 0xaa, 0xc9, 0xff, 0x70, 0xa0, 0xca, 0xff, 0x64, 0x9a, 0xc7, 0xff, 0x61, 0x97, 0xc5, 0xff, 0x60, 0x96, 0xc5, 0xff, 0x5f, 0x95, 0xc4, 0xff, 0x5f, 0x95, 0xc4, 0xff, 0x5f, 0x95, 0xc4, 0xff, 0x5f, 0x94, 0xc3, 0xff, 0x5f, 0x94, 0xc3, 0xff, 0x70, 0x9f, 0xc9, 0xff, 0x91, 0xb6, 0xd6, 0xff, 0x8f, 0xb4, 0xd5, 0xff, 0x8c, 0xb2, 0xd4, 0xff, 0x89, 0xb0, 0xd2, 0xff, 0x87, 0xae, 0xd2, 0xff, 0x84, 0xad, 0xd1, 0xff, 0x81, 0xab, 0xd0, 0xff, 0x7e, 0xa9, 0xcf, 0xff, 0x7b, 0xa7, 0xce, 0xff, 0x78, 0xa5, 0xcd, 0xff, 0x76, 0xa3, 0xcc, 0xff, 0x73, 0xa1, 0xcb, 0xff, 0x70, 0x9f, 0xc9, 0xff, 0x6c, 0x9c, 0xc7, 0xff, 0x5e, 0x93, 0xc2, 0xff, 0x5e, 0x93, 0xc1, 0xff, 0x5e, 0x92, 0xc1, 0xff, 0x5e, 0x92, 0xc1, 0xff, 0x5d, 0x92, 0xc0, 0xff, 0x5d, 0x91, 0xc0, 0xff, 0x5d, 0x91, 0xbf, 0xff, 0x5c, 0x90, 0xbf, 0xff, 0x5c, 0x90, 0xbf, 0xff, 0x5c, 0x8f, 0xbe, 0xff, 0x5b, 0x8e, 0xbd, 0xff, 0x5b, 0x8e, 0xbc, 0xff, 0x5a, 0x8d, 0xbb, 0xff, 0x59, 0x8c, 0xba, 0xff, 0x59, 0x8b, 0xb9, 0xff, 0x58, 0x8a, 0xb8, 0xff, 0x58, 0x8a, 0xb7, 0xff, 0x57, 0x89, 0xb6, 0xff, 0x57, 0x89, 0xb5, 0xff, 0x56, 0x88, 0xb4, 0xff, 0x56, 0x87, 0xb2, 0xff, 0x55, 0x86, 0xb1, 0xff, 0x55, 0x85, 0xb0, 0xff, 0x54, 0x84, 0xaf, 0xff, 0x54, 0x83, 0xaf, 0xff, 0x53, 0x82, 0xad, 0xff, 0x52, 0x81, 0xad, 0xff, 0x52, 0x80, 0xac, 0xff, 0x52, 0x7f, 0xab, 0xff, 0x51, 0x7e, 0xaa, 0xff, 0x51, 0x7e, 0xa9, 0xff, 0x51, 0x7d, 0xa8, 0xff, 0x50, 0x7d, 0xa7, 0xff, 0x50, 0x7c, 0xa6, 0xff, 0x50, 0x7c, 0xa6, 0xff, 0x4f, 0x7b, 0xa5, 0xff, 0x4f, 0x7a, 0xa4, 0xff, 0x4f, 0x7a, 0xa4, 0xff, 0x4e, 0x79, 0xa3, 0xff, 0x4e, 0x78, 0xa2, 0xff, 0x4d, 0x78, 0xa1, 0xff, 0x4d, 0x77, 0xa0, 0xff, 0x4c, 0x77, 0xa0, 0xff, 0x4c, 0x76, 0x9f, 0xff, 0x4c, 0x76, 0x9e, 0xff, 0x4b, 0x75, 0x9d, 0xff, 0x4b, 0x74, 0x9c, 0xff, 0x4a, 0x74, 0x9b, 0xff, 0x49, 0x73, 0x9b, 0xff, 0x49, 0x72, 0x9a, 0xff, 0x48, 0x72, 0x99, 0xff, 0x48, 0x71, 0x98, 0xff, 0x48, 0x71, 0x98, 0xff, 0x47, 0x70, 0x97, 0xff, 0x47, 0x6f, 0x97, 0xff, 0x47, 0x6f, 0x96, 0xff, 0x47, 0x6f, 0x96, 0xff, 0x47, 0x6f, 0x96, 0xff, 0x47, 0x6f, 0x96, 0xff, 0x48, 0x6f, 0x96, 0xff, 0x4c, 0x73, 0x99, 0xff, 0x57, 0x7b, 0x9e, 0xff, 0x6b, 0x89, 0xa7, 0xff, 0x6a, 0x86, 0xa1, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x9f, 0xc0, 0x38, 0x8a, 0xab, 0xc6, 0xff, 0x74, 0xa3, 0xcb, 0xff, 0x66, 0x9b, 0xc8, 0xff, 0x61, 0x98, 0xc6, 0xff, 0x60, 0x96, 0xc5, 0xff, 0x60, 0x96, 0xc5, 0xff, 0x60, 0x96, 0xc5, 0xff, 0x60, 0x96, 0xc5, 0xff, 0x5f, 0x95, 0xc4, 0xff, 0x5f, 0x95, 0xc4, 0xff, 0x6b, 0x9c, 0xc8, 0xff, 0x92, 0xb6, 0xd6, 0xff, 0x8f, 0xb5, 0xd5, 0xff, 0x8c, 0xb3, 0xd4, 0xff, 0x89, 0xb1, 0xd3, 0xff, 0x87, 0xaf, 0xd2, 0xff, 0x84, 0xad, 0xd2, 0xff, 0x81, 0xac, 0xd1, 0xff, 0x7e, 0xaa, 0xd0, 0xff, 0x7b, 0xa8, 0xcf, 0xff, 0x79, 0xa6, 0xce, 0xff, 0x77, 0xa4, 0xcd, 0xff, 0x74, 0xa2, 0xcb, 0xff, 0x71, 0xa0, 0xca, 0xff, 0x6e, 0x9e, 0xc9, 0xff, 0x5f, 0x94, 0xc3, 0xff, 0x5f, 0x94, 0xc3, 0xff, 0x5e, 0x93, 0xc2, 0xff, 0x5e, 0x93, 0xc2, 0xff, 0x5e, 0x92, 0xc1, 0xff, 0x5d, 0x92, 0xc1, 0xff, 0x5d, 0x92, 0xc0, 0xff, 0x5d, 0x91, 0xc0, 0xff, 0x5c, 0x90, 0xbf, 0xff, 0x5c, 0x90, 0xbf, 0xff, 0x5b, 0x8f, 0xbe, 0xff, 0x5b, 0x8e, 0xbd, 0xff, 0x5a, 0x8d, 0xbb, 0xff, 0x5a, 0x8c, 0xba, 0xff, 0x59, 0x8b, 0xb9, 0xff, 0x59, 0x8b, 0xb8, 0xff, 0x58, 0x8a, 0xb7, 0xff, 0x57, 0x89, 0xb6, 0xff, 0x57, 0x89, 0xb5, 0xff, 0x56, 0x88, 0xb4, 0xff, 0x56, 0x87, 0xb2, 0xff, 0x55, 0x86, 0xb1, 0xff, 0x54, 0x85, 0xb0, 0xff, 0x54, 0x84, 0xaf, 0xff, 0x53, 0x83, 0xae, 0xff, 0x53, 0x82, 0xad, 0xff, 0x52, 0x81, 0xad, 0xff, 0x52, 0x80, 0xac, 0xff, 0x52, 0x7f, 0xaa, 0xff, 0x51, 0x7e, 0xa9, 0xff, 0x51, 0x7e, 0xa8, 0xff, 0x51, 0x7d, 0xa7, 0xff, 0x50, 0x7c, 0xa7, 0xff, 0x50, 0x7c, 0xa6, 0xff, 0x50, 0x7b, 0xa5, 0xff, 0x4f, 0x7b, 0xa5, 0xff, 0x4f, 0x7a, 0xa4, 0xff, 0x4e, 0x79, 0xa3, 0xff, 0x4e, 0x78, 0xa2, 0xff, 0x4d, 0x78, 0xa1, 0xff, 0x4d, 0x77, 0xa0, 0xff, 0x4d, 0x77, 0xa0, 0xff, 0x4c, 0x77, 0x9f, 0xff, 0x4c, 0x76, 0x9e, 0xff, 0x4b, 0x75, 0x9d, 0xff, 0x4b, 0x74, 0x9c, 0xff, 0x4a, 0x74, 0x9b, 0xff, 0x49, 0x73, 0x9b, 0xff, 0x49, 0x72, 0x99, 0xff, 0x48, 0x72, 0x99, 0xff, 0x48, 0x71, 0x98, 0xff, 0x48, 0x70, 0x97, 0xff, 0x47, 0x70, 0x97, 0xff, 0x47, 0x6f, 0x96, 0xff, 0x47, 0x6f, 0x96, 0xff, 0x47, 0x6f, 0x96, 0xff, 0x47, 0x6f, 0x96, 0xff, 0x47, 0x6f, 0x96, 0xff, 0x47, 0x6f, 0x96, 0xff, 0x48, 0x6f, 0x96, 0xff, 0x4e, 0x75, 0x9a, 0xff, 0x5c, 0x7f, 0xa0, 0xff, 0x72, 0x8d, 0xa9, 0xff, 0x67, 0x84, 0x9f, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x9b, 0xc1, 0x17, 0x8a, 0xaa, 0xc4, 0xff, 0x79, 0xa5, 0xcc, 0xff, 0x68, 0x9b, 0xc9, 0xff, 0x62, 0x98, 0xc6, 0xff, 0x60, 0x96, 0xc5, 0xff, 0x60, 0x96, 0xc5, 0xff, 0x60, 0x96, 0xc5, 0xff, 0x60, 0x96, 0xc5, 0xff, 0x60, 0x96, 0xc5, 0xff, 0x5f, 0x96, 0xc5, 0xff, 0x65, 0x9a, 0xc7, 0xff, 0x92, 0xb7, 0xd7, 0xff, 0x8f, 0xb5, 0xd6, 0xff, 0x8c, 0xb3, 0xd5, 0xff, 0x89, 0xb1, 0xd4, 0xff, 0x87, 0xaf, 0xd3, 0xff, 0x84, 0xad, 0xd2, 0xff, 0x81, 0xac, 0xd1, 0xff, 0x7e, 0xaa, 0xd0, 0xff, 0x7b, 0xa8, 0xcf, 0xff, 0x79, 0xa6, 0xce, 0xff, 0x77, 0xa4, 0xcd, 0xff, 0x74, 0xa2, 0xcc, 0xff, 0x71, 0xa1, 0xcb, 0xff, 0x6f, 0x9f, 0xca, 0xff, 0x5f, 0x95, 0xc4, 0xff, 0x5f, 0x95, 0xc4, 0xff, 0x5f, 0x94, 0xc3, 0xff, 0x5e, 0x94, 0xc3, 0xff, 0x5e, 0x93, 0xc2, 0xff, 0x5e, 0x93, 0xc2, 0xff, 0x5e, 0x92, 0xc1, 0xff, 0x5d, 0x92, 0xc1, 0xff, 0x5d, 0x91, 0xc0, 0xff, 0x5c, 0x90, 0xbf, 0xff, 0x5b, 0x8f, 0xbe, 0xff, 0x5b, 0x8e, 0xbd, 0xff, 0x5a, 0x8e, 0xbc, 0xff, 0x5a, 0x8d, 0xbb, 0xff, 0x59, 0x8c, 0xba, 0xff, 0x59, 0x8b, 0xb9, 0xff, 0x58, 0x8a, 0xb8, 0xff, 0x57, 0x89, 0xb6, 0xff, 0x57, 0x89, 0xb5, 0xff, 0x56, 0x88, 0xb4, 0xff, 0x56, 0x87, 0xb2, 0xff, 0x55, 0x86, 0xb1, 0xff, 0x54, 0x85, 0xb0, 0xff, 0x54, 0x84, 0xaf, 0xff, 0x53, 0x83, 0xae, 0xff, 0x53, 0x82, 0xad, 0xff, 0x52, 0x81, 0xac, 0xff, 0x52, 0x80, 0xab, 0xff, 0x52, 0x7f, 0xaa, 0xff, 0x51, 0x7e, 0xa9, 0xff, 0x51, 0x7d, 0xa8, 0xff, 0x51, 0x7d, 0xa7, 0xff, 0x50, 0x7c, 0xa6, 0xff, 0x50, 0x7c, 0xa5, 0xff, 0x4f, 0x7b, 0xa5, 0xff, 0x4f, 0x7a, 0xa4, 0xff, 0x4f, 0x79, 0xa3, 0xff, 0x4e, 0x79, 0xa2, 0xff, 0x4e, 0x78, 0xa1, 0xff, 0x4d, 0x77, 0xa1, 0xff, 0x4d, 0x77, 0xa0, 0xff, 0x4c, 0x77, 0x9f, 0xff, 0x4c, 0x76, 0x9e, 0xff, 0x4b, 0x75, 0x9d, 0xff, 0x4b, 0x74, 0x9c, 0xff, 0x4a, 0x74, 0x9b, 0xff, 0x4a, 0x73, 0x9b, 0xff, 0x49, 0x72, 0x9a, 0xff, 0x48, 0x71, 0x99, 0xff, 0x48, 0x71, 0x98, 0xff, 0x48, 0x70, 0x97, 0xff, 0x47, 0x6f, 0x96, 0xff, 0x47, 0x6e, 0x95, 0xff, 0x46, 0x6e, 0x95, 0xff, 0x46, 0x6e, 0x95, 0xff, 0x46, 0x6e, 0x95, 0xff, 0x46, 0x6e, 0x95, 0xff, 0x46, 0x6e, 0x95, 0xff, 0x46, 0x6e, 0x95, 0xff, 0x48, 0x6f, 0x96, 0xff, 0x52, 0x77, 0x9b, 0xff, 0x61, 0x82, 0xa2, 0xff, 0x77, 0x90, 0xa9, 0xff, 0x5e, 0x7c, 0x9b, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x94, 0xc4, 0x03, 0x87, 0xa7, 0xc2, 0xff, 0x7f, 0xa8, 0xcb, 0xff, 0x6a, 0x9d, 0xc9, 0xff, 0x62, 0x98, 0xc6, 0xff, 0x5f, 0x96, 0xc5, 0xff, 0x5f, 0x96, 0xc5, 0xff, 0x5f, 0x96, 0xc5, 0xff, 0x5f, 0x96, 0xc5, 0xff, 0x5f, 0x95, 0xc4, 0xff, 0x5f, 0x95, 0xc4, 0xff, 0x62, 0x97, 0xc5, 0xff, 0x90, 0xb6, 0xd6, 0xff, 0x8f, 0xb5, 0xd6, 0xff, 0x8c, 0xb3, 0xd5, 0xff, 0x89, 0xb1, 0xd4, 0xff, 0x87, 0xaf, 0xd3, 0xff, 0x84, 0xad, 0xd2, 0xff, 0x81, 0xac, 0xd1, 0xff, 0x7e, 0xaa, 0xd0, 0xff, 0x7b, 0xa8, 0xcf, 0xff, 0x79, 0xa6, 0xce, 0xff, 0x77, 0xa4, 0xcd, 0xff, 0x74, 0xa2, 0xcc, 0xff, 0x71, 0xa0, 0xca, 0xff, 0x6e, 0x9e, 0xc9, 0xff, 0x5f, 0x94, 0xc3, 0xff, 0x5e, 0x94, 0xc2, 0xff, 0x5e, 0x93, 0xc2, 0xff, 0x5e, 0x93, 0xc2, 0xff, 0x5e, 0x92, 0xc1, 0xff, 0x5d, 0x92, 0xc1, 0xff, 0x5d, 0x91, 0xc0, 0xff, 0x5c, 0x91, 0xbf, 0xff, 0x5c, 0x90, 0xbf, 0xff, 0x5b, 0x8f, 0xbe, 0xff, 0x5b, 0x8e, 0xbd, 0xff, 0x5a, 0x8e, 0xbc, 0xff, 0x5a, 0x8d, 0xbb, 0xff, 0x59, 0x8c, 0xba, 0xff, 0x59, 0x8b, 0xb9, 0xff, 0x58, 0x8a, 0xb7, 0xff, 0x57, 0x89, 0xb6, 0xff, 0x57, 0x89, 0xb5, 0xff, 0x56, 0x88, 0xb4, 0xff, 0x55, 0x87, 0xb2, 0xff, 0x55, 0x86, 0xb1, 0xff, 0x54, 0x85, 0xb0, 0xff, 0x53, 0x84, 0xae, 0xff, 0x53, 0x82, 0xad, 0xff, 0x52, 0x81, 0xad, 0xff, 0x52, 0x80, 0xac, 0xff, 0x52, 0x7f, 0xaa, 0xff, 0x51, 0x7e, 0xa9, 0xff, 0x51, 0x7d, 0xa8, 0xff, 0x50, 0x7c, 0xa7, 0xff, 0x50, 0x7c, 0xa6, 0xff, 0x50, 0x7b, 0xa5, 0xff, 0x4f, 0x7a, 0xa4, 0xff, 0x4f, 0x7a, 0xa3, 0xff, 0x4e, 0x79, 0xa2, 0xff, 0x4e, 0x78, 0xa1, 0xff, 0x4d, 0x77, 0xa0, 0xff, 0x4d, 0x77, 0x9f, 0xff, 0x4c, 0x77, 0x9f, 0xff, 0x4c, 0x76, 0x9e, 0xff, 0x4b, 0x75, 0x9d, 0xff, 0x4b, 0x74, 0x9c, 0xff, 0x4b, 0x74, 0x9b, 0xff, 0x4a, 0x73, 0x9b, 0xff, 0x49, 0x72, 0x9a, 0xff, 0x49, 0x71, 0x99, 0xff, 0x48, 0x71, 0x98, 0xff, 0x48, 0x70, 0x97, 0xff, 0x47, 0x6f, 0x96, 0xff, 0x47, 0x6e, 0x95, 0xff, 0x46, 0x6e, 0x95, 0xff, 0x46, 0x6e, 0x95, 0xff, 0x46, 0x6d, 0x94, 0xff, 0x46, 0x6d, 0x94, 0xff, 0x46, 0x6d, 0x94, 0xff, 0x46, 0x6d, 0x94, 0xff, 0x46, 0x6d, 0x94, 0xff, 0x46, 0x6d, 0x94, 0xff, 0x46, 0x6d, 0x94, 0xff, 0x49, 0x70, 0x96, 0xff, 0x54, 0x78, 0x9b, 0xff, 0x67, 0x86, 0xa4, 0xff, 0x7c, 0x92, 0xa8, 0xff, 0x4e, 0x71, 0x96, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xa2, 0xbf, 0xef, 0x88, 0xaa, 0xc8, 0xff, 0x73, 0xa1, 0xca, 0xff, 0x65, 0x9a, 0xc7, 0xff, 0x61, 0x97, 0xc5, 0xff, 0x60, 0x96, 0xc4, 0xff, 0x5f, 0x95, 0xc4, 0xff, 0x5f, 0x95, 0xc4, 0xff, 0x5f, 0x95, 0xc4, 0xff, 0x5f, 0x95, 0xc4, 0xff, 0x60, 0x96, 0xc4, 0xff, 0x8c, 0xb3, 0xd5, 0xff, 0x8f, 0xb5, 0xd6, 0xff, 0x8c, 0xb3, 0xd4, 0xff, 0x89, 0xb0, 0xd3, 0xff, 0x87, 0xae, 0xd2, 0xff, 0x84, 0xad, 0xd1, 0xff, 0x81, 0xab, 0xd0, 0xff, 0x7e, 0xa9, 0xcf, 0xff, 0x7b, 0xa7, 0xce, 0xff, 0x78, 0xa5, 0xcd, 0xff, 0x76, 0xa3, 0xcb, 0xff, 0x73, 0xa1, 0xca, 0xff, 0x70, 0x9f, 0xc8, 0xff, 0x6c, 0x9c, 0xc7, 0xff, 0x5e, 0x93, 0xc1, 0xff, 0x5d, 0x92, 0xc0, 0xff, 0x5d, 0x92, 0xc0, 0xff, 0x5d, 0x91, 0xbf, 0xff, 0x5c, 0x90, 0xbf, 0xff, 0x5c, 0x90, 0xbf, 0xff, 0x5c, 0x8f, 0xbe, 0xff, 0x5b, 0x8f, 0xbd, 0xff, 0x5b, 0x8e, 0xbc, 0xff, 0x5a, 0x8d, 0xbb, 0xff, 0x5a, 0x8c, 0xba, 0xff, 0x59, 0x8b, 0xb9, 0xff, 0x58, 0x8a, 0xb8, 0xff, 0x57, 0x89, 0xb6, 0xff, 0x57, 0x89, 0xb5, 0xff, 0x56, 0x88, 0xb4, 0xff, 0x56, 0x87, 0xb3, 0xff, 0x55, 0x86, 0xb1, 0xff, 0x54, 0x85, 0xb0, 0xff, 0x54, 0x84, 0xaf, 0xff, 0x53, 0x83, 0xae, 0xff, 0x52, 0x82, 0xad, 0xff, 0x52, 0x81, 0xac, 0xff, 0x52, 0x80, 0xab, 0xff, 0x52, 0x7f, 0xa9, 0xff, 0x51, 0x7e, 0xa8, 0xff, 0x50, 0x7c, 0xa7, 0xff, 0x50, 0x7b, 0xa6, 0xff, 0x4f, 0x7a, 0xa4, 0xff, 0x4f, 0x7a, 0xa3, 0xff, 0x4e, 0x79, 0xa2, 0xff, 0x4e, 0x78, 0xa1, 0xff, 0x4d, 0x78, 0xa0, 0xff, 0x4d, 0x77, 0x9f, 0xff, 0x4c, 0x77, 0x9f, 0xff, 0x4c, 0x76, 0x9e, 0xff, 0x4b, 0x75, 0x9d, 0xff, 0x4b, 0x75, 0x9c, 0xff, 0x4b, 0x74, 0x9b, 0xff, 0x4a, 0x73, 0x9b, 0xff, 0x4a, 0x73, 0x9b, 0xff, 0x49, 0x72, 0x9a, 0xff, 0x49, 0x71, 0x99, 0xff, 0x48, 0x70, 0x98, 0xff, 0x48, 0x6f, 0x97, 0xff, 0x47, 0x6f, 0x96, 0xff, 0x47, 0x6e, 0x95, 0xff, 0x47, 0x6e, 0x95, 0xff, 0x46, 0x6e, 0x95, 0xff, 0x46, 0x6d, 0x94, 0xff, 0x46, 0x6d, 0x94, 0xff, 0x45, 0x6c, 0x93, 0xff, 0x45, 0x6c, 0x93, 0xff, 0x45, 0x6c, 0x93, 0xff, 0x45, 0x6c, 0x93, 0xff, 0x45, 0x6c, 0x93, 0xff, 0x45, 0x6c, 0x93, 0xff, 0x45, 0x6c, 0x93, 0xff, 0x46, 0x6d, 0x93, 0xff, 0x4c, 0x72, 0x96, 0xff, 0x5b, 0x7c, 0x9e, 0xff, 0x74, 0x8d, 0xa8, 0xff, 0x7e, 0x93, 0xa7, 0xef, 0x53, 0x74, 0x99, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xa2, 0xc8, 0xc0, 0x89, 0xa6, 0xbf, 0xff, 0x82, 0xa8, 0xc8, 0xff, 0x71, 0x9f, 0xc8, 0xff, 0x67, 0x9a, 0xc6, 0xff, 0x63, 0x97, 0xc4, 0xff, 0x61, 0x95, 0xc3, 0xff, 0x5f, 0x95, 0xc3, 0xff, 0x5f, 0x94, 0xc2, 0xff, 0x5e, 0x94, 0xc3, 0xff, 0x5e, 0x94, 0xc3, 0xff, 0x88, 0xaf, 0xd2, 0xff, 0x8e, 0xb4, 0xd5, 0xff, 0x8b, 0xb2, 0xd3, 0xff, 0x89, 0xb0, 0xd2, 0xff, 0x86, 0xad, 0xd2, 0xff, 0x83, 0xac, 0xd0, 0xff, 0x80, 0xaa, 0xcf, 0xff, 0x7d, 0xa8, 0xcd, 0xff, 0x7a, 0xa6, 0xcc, 0xff, 0x77, 0xa3, 0xcb, 0xff, 0x75, 0xa1, 0xc9, 0xff, 0x72, 0x9f, 0xc8, 0xff, 0x6f, 0x9d, 0xc7, 0xff, 0x6c, 0x9b, 0xc5, 0xff, 0x5f, 0x92, 0xbf, 0xff, 0x5c, 0x90, 0xbf, 0xff, 0x5c, 0x8f, 0xbe, 0xff, 0x5b, 0x8f, 0xbd, 0xff, 0x5b, 0x8e, 0xbc, 0xff, 0x5a, 0x8d, 0xbc, 0xff, 0x5a, 0x8d, 0xbb, 0xff, 0x5a, 0x8c, 0xba, 0xff, 0x59, 0x8b, 0xb9, 0xff, 0x58, 0x8a, 0xb8, 0xff, 0x58, 0x89, 0xb6, 0xff, 0x57, 0x89, 0xb5, 0xff, 0x56, 0x88, 0xb4, 0xff, 0x56, 0x87, 0xb3, 0xff, 0x55, 0x86, 0xb2, 0xff, 0x54, 0x85, 0xb0, 0xff, 0x54, 0x84, 0xaf, 0xff, 0x53, 0x83, 0xae, 0xff, 0x53, 0x82, 0xad, 0xff, 0x52, 0x81, 0xac, 0xff, 0x52, 0x80, 0xab, 0xff, 0x52, 0x7f, 0xaa, 0xff, 0x51, 0x7e, 0xa8, 0xff, 0x50, 0x7d, 0xa7, 0xff, 0x50, 0x7c, 0xa6, 0xff, 0x4f, 0x7b, 0xa5, 0xff, 0x4e, 0x7a, 0xa3, 0xff, 0x4e, 0x78, 0xa2, 0xff, 0x4d, 0x77, 0xa1, 0xff, 0x4d, 0x77, 0xa0, 0xff, 0x4c, 0x77, 0x9f, 0xff, 0x4c, 0x76, 0x9e, 0xff, 0x4b, 0x76, 0x9d, 0xff, 0x4b, 0x75, 0x9c, 0xff, 0x4b, 0x74, 0x9b, 0xff, 0x4a, 0x73, 0x9b, 0xff, 0x4a, 0x73, 0x9a, 0xff, 0x49, 0x72, 0x99, 0xff, 0x49, 0x71, 0x99, 0xff, 0x49, 0x71, 0x98, 0xff, 0x48, 0x70, 0x97, 0xff, 0x48, 0x6f, 0x96, 0xff, 0x47, 0x6e, 0x95, 0xff, 0x47, 0x6e, 0x95, 0xff, 0x47, 0x6e, 0x95, 0xff, 0x46, 0x6d, 0x94, 0xff, 0x46, 0x6d, 0x94, 0xff, 0x46, 0x6d, 0x93, 0xff, 0x45, 0x6c, 0x93, 0xff, 0x45, 0x6c, 0x93, 0xff, 0x45, 0x6b, 0x92, 0xff, 0x44, 0x6b, 0x92, 0xff, 0x45, 0x6b, 0x92, 0xff, 0x45, 0x6c, 0x92, 0xff, 0x45, 0x6c, 0x92, 0xff, 0x45, 0x6c, 0x92, 0xff, 0x46, 0x6c, 0x92, 0xff, 0x48, 0x6e, 0x93, 0xff, 0x4b, 0x70, 0x95, 0xff, 0x55, 0x77, 0x9b, 0xff, 0x6b, 0x88, 0xa4, 0xff, 0x7f, 0x94, 0xa8, 0xff, 0xab, 0xb8, 0xc5, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xe4, 0xeb, 0xa0, 0x81, 0xa6, 0xc6, 0xe7, 0x82, 0xa2, 0xbf, 0xff, 0x86, 0xa8, 0xc5, 0xff, 0x79, 0xa2, 0xc7, 0xff, 0x6f, 0x9d, 0xc6, 0xff, 0x69, 0x9a, 0xc4, 0xff, 0x64, 0x97, 0xc2, 0xff, 0x62, 0x95, 0xc1, 0xff, 0x5f, 0x93, 0xc1, 0xff, 0x5f, 0x93, 0xc0, 0xff, 0x83, 0xab, 0xcf, 0xff, 0x8e, 0xb3, 0xd3, 0xff, 0x8b, 0xb0, 0xd2, 0xff, 0x88, 0xae, 0xd1, 0xff, 0x86, 0xad, 0xd0, 0xff, 0x82, 0xab, 0xce, 0xff, 0x7f, 0xa8, 0xcd, 0xff, 0x7c, 0xa6, 0xcb, 0xff, 0x79, 0xa4, 0xca, 0xff, 0x77, 0xa2, 0xc8, 0xff, 0x74, 0x9f, 0xc7, 0xff, 0x71, 0x9d, 0xc6, 0xff, 0x6e, 0x9b, 0xc4, 0xff, 0x6b, 0x9a, 0xc2, 0xff, 0x5e, 0x90, 0xbd, 0xff, 0x5a, 0x8d, 0xbb, 0xff, 0x5a, 0x8c, 0xba, 0xff, 0x59, 0x8b, 0xb9, 0xff, 0x59, 0x8b, 0xb8, 0xff, 0x58, 0x8a, 0xb7, 0xff, 0x58, 0x89, 0xb6, 0xff, 0x57, 0x89, 0xb5, 0xff, 0x57, 0x88, 0xb4, 0xff, 0x56, 0x88, 0xb3, 0xff, 0x55, 0x87, 0xb2, 0xff, 0x55, 0x86, 0xb1, 0xff, 0x54, 0x85, 0xb0, 0xff, 0x54, 0x84, 0xaf, 0xff, 0x53, 0x83, 0xae, 0xff, 0x53, 0x82, 0xad, 0xff, 0x52, 0x81, 0xac, 0xff, 0x52, 0x80, 0xab, 0xff, 0x52, 0x7f, 0xaa, 0xff, 0x51, 0x7e, 0xa8, 0xff, 0x50, 0x7d, 0xa7, 0xff, 0x50, 0x7c, 0xa6, 0xff, 0x4f, 0x7b, 0xa4, 0xff, 0x4e, 0x79, 0xa3, 0xff, 0x4e, 0x78, 0xa2, 0xff, 0x4d, 0x77, 0xa0, 0xff, 0x4c, 0x77, 0x9f, 0xff, 0x4c, 0x76, 0x9e, 0xff, 0x4b, 0x75, 0x9d, 0xff, 0x4b, 0x75, 0x9c, 0xff, 0x4a, 0x74, 0x9b, 0xff, 0x4a, 0x73, 0x9b, 0xff, 0x4a, 0x73, 0x9a, 0xff, 0x49, 0x72, 0x99, 0xff, 0x49, 0x71, 0x98, 0xff, 0x48, 0x70, 0x97, 0xff, 0x48, 0x70, 0x97, 0xff, 0x47, 0x6f, 0x96, 0xff, 0x47, 0x6e, 0x95, 0xff, 0x47, 0x6e, 0x94, 0xff, 0x47, 0x6d, 0x94, 0xff, 0x46, 0x6d, 0x93, 0xff, 0x46, 0x6d, 0x93, 0xff, 0x46, 0x6c, 0x92, 0xff, 0x45, 0x6c, 0x92, 0xff, 0x45, 0x6c, 0x92, 0xff, 0x45, 0x6b, 0x91, 0xff, 0x44, 0x6b, 0x91, 0xff, 0x44, 0x6b, 0x91, 0xff, 0x44, 0x6b, 0x91, 0xff, 0x44, 0x6b, 0x90, 0xff, 0x44, 0x6a, 0x91, 0xff, 0x44, 0x6b, 0x91, 0xff, 0x45, 0x6b, 0x91, 0xff, 0x46, 0x6c, 0x91, 0xff, 0x48, 0x6d, 0x92, 0xff, 0x4b, 0x70, 0x94, 0xff, 0x50, 0x74, 0x97, 0xff, 0x58, 0x79, 0x9b, 0xff, 0x67, 0x85, 0xa2, 0xff, 0x7d, 0x92, 0xa7, 0xff, 0x8f, 0x9e, 0xae, 0xcb, 0xec, 0xec, 0xec, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xfa, 0xfa, 0x9f, 0xea, 0xea, 0xea, 0xcc, 0xbb, 0xc9, 0xd4, 0xbf, 0x8e, 0xaa, 0xc2, 0xdf, 0x85, 0xa3, 0xbf, 0xfc, 0x88, 0xa8, 0xc3, 0xff, 0x7e, 0xa4, 0xc5, 0xff, 0x75, 0x9e, 0xc3, 0xff, 0x6c, 0x9a, 0xc1, 0xff, 0x66, 0x96, 0xc0, 0xff, 0x63, 0x94, 0xbf, 0xff, 0x80, 0xa8, 0xcb, 0xff, 0x8e, 0xb2, 0xd2, 0xff, 0x8b, 0xaf, 0xd0, 0xff, 0x88, 0xad, 0xcf, 0xff, 0x84, 0xab, 0xcd, 0xff, 0x81, 0xa8, 0xcb, 0xff, 0x7e, 0xa6, 0xca, 0xff, 0x7b, 0xa3, 0xc8, 0xff, 0x77, 0xa1, 0xc7, 0xff, 0x75, 0x9f, 0xc5, 0xff, 0x72, 0x9d, 0xc4, 0xff, 0x6f, 0x9b, 0xc2, 0xff, 0x6c, 0x99, 0xc0, 0xff, 0x69, 0x97, 0xbf, 0xff, 0x5c, 0x8c, 0xb9, 0xff, 0x58, 0x8a, 0xb7, 0xff, 0x58, 0x89, 0xb6, 0xff, 0x57, 0x89, 0xb5, 0xff, 0x57, 0x88, 0xb4, 0xff, 0x56, 0x87, 0xb3, 0xff, 0x56, 0x86, 0xb2, 0xff, 0x55, 0x86, 0xb1, 0xff, 0x54, 0x84, 0xb0, 0xff, 0x54, 0x84, 0xae, 0xff, 0x53, 0x83, 0xad, 0xff, 0x52, 0x82, 0xad, 0xff, 0x52, 0x81, 0xac, 0xff, 0x52, 0x80, 0xab, 0xff, 0x52, 0x7f, 0xaa, 0xff, 0x51, 0x7e, 0xa9, 0xff, 0x50, 0x7d, 0xa7, 0xff, 0x50, 0x7c, 0xa6, 0xff, 0x4f, 0x7b, 0xa5, 0xff, 0x4f, 0x7a, 0xa4, 0xff, 0x4e, 0x79, 0xa3, 0xff, 0x4d, 0x78, 0xa1, 0xff, 0x4d, 0x77, 0xa0, 0xff, 0x4c, 0x77, 0x9f, 0xff, 0x4b, 0x76, 0x9d, 0xff, 0x4b, 0x75, 0x9c, 0xff, 0x4a, 0x74, 0x9b, 0xff, 0x4a, 0x73, 0x9b, 0xff, 0x49, 0x72, 0x99, 0xff, 0x49, 0x71, 0x98, 0xff, 0x48, 0x71, 0x98, 0xff, 0x48, 0x70, 0x97, 0xff, 0x47, 0x6f, 0x96, 0xff, 0x47, 0x6f, 0x95, 0xff, 0x47, 0x6e, 0x94, 0xff, 0x46, 0x6d, 0x94, 0xff, 0x46, 0x6d, 0x93, 0xff, 0x46, 0x6d, 0x93, 0xff, 0x46, 0x6c, 0x92, 0xff, 0x45, 0x6c, 0x92, 0xff, 0x45, 0x6c, 0x91, 0xff, 0x45, 0x6b, 0x90, 0xff, 0x44, 0x6a, 0x90, 0xff, 0x44, 0x6a, 0x8f, 0xff, 0x44, 0x6a, 0x8f, 0xff, 0x44, 0x6a, 0x8f, 0xff, 0x44, 0x69, 0x8e, 0xff, 0x44, 0x69, 0x8e, 0xff, 0x44, 0x69, 0x8e, 0xff, 0x44, 0x69, 0x8e, 0xff, 0x44, 0x69, 0x8e, 0xff, 0x45, 0x6a, 0x8e, 0xff, 0x46, 0x6b, 0x8f, 0xff, 0x49, 0x6c, 0x90, 0xff, 0x4c, 0x6f, 0x92, 0xff, 0x51, 0x73, 0x95, 0xff, 0x57, 0x78, 0x9a, 0xff, 0x61, 0x80, 0x9e, 0xff, 0x6f, 0x89, 0xa4, 0xff, 0x7b, 0x90, 0xa5, 0xf8, 0x96, 0xa2, 0xaf, 0xb0, 0xd0, 0xd0, 0xd0, 0x9c, 0xee, 0xee, 0xee, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xf6, 0xf6, 0xa4, 0xf9, 0xf9, 0xf9, 0xf7, 0xf5, 0xf5, 0xf5, 0xe7, 0xeb, 0xeb, 0xeb, 0xcf, 0xce, 0xd4, 0xda, 0xbb, 0x9b, 0xb1, 0xc4, 0xcb, 0x84, 0xa1, 0xbc, 0xef, 0x88, 0xa4, 0xbd, 0xff, 0x84, 0xa2, 0xbe, 0xff, 0x79, 0x9d, 0xbe, 0xff, 0x70, 0x98, 0xbc, 0xff, 0x82, 0xa6, 0xc5, 0xff, 0x92, 0xb1, 0xce, 0xff, 0x8d, 0xad, 0xcc, 0xff, 0x88, 0xab, 0xca, 0xff, 0x85, 0xa8, 0xc8, 0xff, 0x81, 0xa5, 0xc6, 0xff, 0x7d, 0xa3, 0xc5, 0xff, 0x79, 0xa0, 0xc3, 0xff, 0x76, 0x9e, 0xc2, 0xff, 0x74, 0x9b, 0xc0, 0xff, 0x70, 0x9a, 0xbf, 0xff, 0x6d, 0x97, 0xbe, 0xff, 0x6a, 0x95, 0xbc, 0xff, 0x66, 0x92, 0xba, 0xff, 0x58, 0x89, 0xb4, 0xff, 0x56, 0x87, 0xb2, 0xff, 0x55, 0x86, 0xb1, 0xff, 0x55, 0x85, 0xb0, 0xff, 0x54, 0x84, 0xaf, 0xff, 0x54, 0x83, 0xae, 0xff, 0x53, 0x82, 0xad, 0xff, 0x53, 0x82, 0xad, 0xff, 0x52, 0x81, 0xac, 0xff, 0x52, 0x80, 0xab, 0xff, 0x52, 0x7f, 0xa9, 0xff, 0x51, 0x7e, 0xa8, 0xff, 0x51, 0x7d, 0xa7, 0xff, 0x50, 0x7c, 0xa6, 0xff, 0x4f, 0x7b, 0xa5, 0xff, 0x4f, 0x7a, 0xa4, 0xff, 0x4e, 0x79, 0xa2, 0xff, 0x4d, 0x78, 0xa1, 0xff, 0x4d, 0x77, 0xa0, 0xff, 0x4c, 0x77, 0x9f, 0xff, 0x4c, 0x76, 0x9e, 0xff, 0x4b, 0x75, 0x9c, 0xff, 0x4a, 0x74, 0x9b, 0xff, 0x4a, 0x73, 0x9b, 0xff, 0x49, 0x72, 0x9a, 0xff, 0x49, 0x71, 0x98, 0xff, 0x48, 0x70, 0x97, 0xff, 0x47, 0x6f, 0x96, 0xff, 0x47, 0x6e, 0x95, 0xff, 0x47, 0x6e, 0x94, 0xff, 0x46, 0x6d, 0x94, 0xff, 0x46, 0x6d, 0x93, 0xff, 0x45, 0x6c, 0x92, 0xff, 0x45, 0x6c, 0x91, 0xff, 0x45, 0x6b, 0x91, 0xff, 0x45, 0x6b, 0x90, 0xff, 0x44, 0x6a, 0x8f, 0xff, 0x44, 0x6a, 0x8f, 0xff, 0x43, 0x69, 0x8e, 0xff, 0x43, 0x68, 0x8d, 0xff, 0x43, 0x68, 0x8c, 0xff, 0x42, 0x68, 0x8c, 0xff, 0x42, 0x67, 0x8c, 0xff, 0x42, 0x67, 0x8c, 0xff, 0x42, 0x67, 0x8b, 0xff, 0x41, 0x66, 0x8a, 0xff, 0x41, 0x66, 0x8a, 0xff, 0x42, 0x65, 0x89, 0xff, 0x42, 0x65, 0x89, 0xff, 0x43, 0x66, 0x89, 0xff, 0x45, 0x68, 0x8a, 0xff, 0x48, 0x69, 0x8b, 0xff, 0x4b, 0x6c, 0x8d, 0xff, 0x50, 0x70, 0x91, 0xff, 0x56, 0x76, 0x95, 0xff, 0x5f, 0x7d, 0x9b, 0xff, 0x6c, 0x87, 0xa1, 0xff, 0x7a, 0x90, 0xa7, 0xff, 0x8c, 0x9c, 0xac, 0xdb, 0xb6, 0xbb, 0xbf, 0xa0, 0xc9, 0xc9, 0xc9, 0xab, 0xd2, 0xd2, 0xd2, 0xcc, 0xed, 0xed, 0xed, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xdc, 0xdc, 0x90, 0xbf, 0xbf, 0xbf, 0xdf, 0xe5, 0xe5, 0xe5, 0xf0, 0xf9, 0xf9, 0xf9, 0xf8, 0xf7, 0xf7, 0xf7, 0xec, 0xef, 0xef, 0xef, 0xd7, 0xe4, 0xe4, 0xe4, 0xbc, 0xb6, 0xc3, 0xd0, 0xbb, 0x92, 0xaa, 0xbf, 0xcf, 0x83, 0x9e, 0xb8, 0xf0, 0x83, 0x9d, 0xb6, 0xff, 0x8f, 0xa8, 0xbf, 0xff, 0x9c, 0xb4, 0xca, 0xff, 0x95, 0xae, 0xc7, 0xff, 0x8d, 0xaa, 0xc4, 0xff, 0x88, 0xa6, 0xc1, 0xff, 0x81, 0xa2, 0xbf, 0xff, 0x7c, 0x9e, 0xbd, 0xff, 0x78, 0x9b, 0xbc, 0xff, 0x74, 0x99, 0xba, 0xff, 0x71, 0x96, 0xb9, 0xff, 0x6c, 0x93, 0xb6, 0xff, 0x69, 0x91, 0xb5, 0xff, 0x66, 0x8e, 0xb3, 0xff, 0x63, 0x8c, 0xb2, 0xff, 0x56, 0x83, 0xac, 0xff, 0x52, 0x80, 0xaa, 0xff, 0x52, 0x7f, 0xaa, 0xff, 0x52, 0x7f, 0xa9, 0xff, 0x51, 0x7e, 0xa8, 0xff, 0x51, 0x7d, 0xa7, 0xff, 0x51, 0x7d, 0xa7, 0xff, 0x50, 0x7c, 0xa6, 0xff, 0x50, 0x7c, 0xa5, 0xff, 0x4f, 0x7b, 0xa4, 0xff, 0x4f, 0x7a, 0xa4, 0xff, 0x4e, 0x79, 0xa2, 0xff, 0x4e, 0x78, 0xa1, 0xff, 0x4d, 0x77, 0xa0, 0xff, 0x4d, 0x77, 0x9f, 0xff, 0x4c, 0x77, 0x9e, 0xff, 0x4c, 0x76, 0x9d, 0xff, 0x4b, 0x75, 0x9c, 0xff, 0x4b, 0x74, 0x9b, 0xff, 0x4a, 0x73, 0x9a, 0xff, 0x4a, 0x72, 0x99, 0xff, 0x49, 0x71, 0x98, 0xff, 0x48, 0x70, 0x97, 0xff, 0x48, 0x6f, 0x96, 0xff, 0x47, 0x6e, 0x95, 0xff, 0x46, 0x6d, 0x94, 0xff, 0x46, 0x6c, 0x93, 0xff, 0x46, 0x6c, 0x92, 0xff, 0x45, 0x6b, 0x91, 0xff, 0x45, 0x6a, 0x90, 0xff, 0x44, 0x6a, 0x8f, 0xff, 0x44, 0x69, 0x8e, 0xff, 0x44, 0x69, 0x8e, 0xff, 0x43, 0x69, 0x8d, 0xff, 0x43, 0x68, 0x8c, 0xff, 0x42, 0x67, 0x8b, 0xff, 0x42, 0x66, 0x8a, 0xff, 0x41, 0x66, 0x89, 0xff, 0x41, 0x65, 0x89, 0xff, 0x41, 0x65, 0x89, 0xff, 0x41, 0x64, 0x88, 0xff, 0x40, 0x64, 0x87, 0xff, 0x40, 0x64, 0x86, 0xff, 0x40, 0x64, 0x86, 0xff, 0x40, 0x64, 0x86, 0xff, 0x40, 0x63, 0x85, 0xff, 0x41, 0x63, 0x84, 0xff, 0x42, 0x63, 0x84, 0xff, 0x44, 0x64, 0x84, 0xff, 0x47, 0x66, 0x86, 0xff, 0x4c, 0x69, 0x88, 0xff, 0x51, 0x6e, 0x8a, 0xff, 0x58, 0x74, 0x8f, 0xff, 0x60, 0x7a, 0x95, 0xff, 0x6c, 0x84, 0x9b, 0xff, 0x77, 0x8c, 0xa1, 0xff, 0x91, 0x9f, 0xad, 0xe4, 0xb6, 0xbc, 0xc0, 0xb8, 0xcd, 0xcd, 0xcd, 0xb0, 0xcd, 0xcd, 0xcd, 0xc7, 0xc4, 0xc4, 0xc4, 0xcf, 0xb2, 0xb2, 0xb2, 0xd8, 0xdb, 0xdb, 0xdb, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xdf, 0xdf, 0x88, 0x9b, 0x9b, 0x9b, 0xaf, 0x86, 0x86, 0x86, 0x9c, 0xad, 0xad, 0xad, 0xb7, 0xdb, 0xdb, 0xdb, 0xdb, 0xf5, 0xf5, 0xf5, 0xf3, 0xf9, 0xf9, 0xf9, 0xf3, 0xf4, 0xf4, 0xf4, 0xe4, 0xea, 0xea, 0xea, 0xcc, 0xde, 0xde, 0xde, 0xaf, 0xb5, 0xc1, 0xcc, 0xaf, 0xa6, 0xb7, 0xc7, 0xcb, 0xad, 0xbe, 0xcd, 0xeb, 0xa1, 0xb4, 0xc6, 0xfc, 0x9c, 0xb0, 0xc2, 0xff, 0x93, 0xaa, 0xbf, 0xff, 0x8a, 0xa3, 0xba, 0xff, 0x82, 0x9d, 0xb6, 0xff, 0x7b, 0x99, 0xb3, 0xff, 0x75, 0x94, 0xb0, 0xff, 0x70, 0x90, 0xae, 0xff, 0x6b, 0x8c, 0xac, 0xff, 0x66, 0x89, 0xaa, 0xff, 0x63, 0x87, 0xa8, 0xff, 0x5f, 0x84, 0xa7, 0xff, 0x54, 0x7c, 0xa1, 0xff, 0x4e, 0x77, 0x9d, 0xff, 0x4d, 0x77, 0x9c, 0xff, 0x4d, 0x77, 0x9c, 0xff, 0x4d, 0x77, 0x9d, 0xff, 0x4d, 0x76, 0x9c, 0xff, 0x4c, 0x76, 0x9c, 0xff, 0x4c, 0x76, 0x9c, 0xff, 0x4c, 0x76, 0x9c, 0xff, 0x4c, 0x75, 0x9c, 0xff, 0x4b, 0x75, 0x9b, 0xff, 0x4b, 0x74, 0x9b, 0xff, 0x4a, 0x73, 0x9a, 0xff, 0x4a, 0x73, 0x99, 0xff, 0x49, 0x72, 0x99, 0xff, 0x49, 0x71, 0x98, 0xff, 0x49, 0x71, 0x97, 0xff, 0x48, 0x70, 0x96, 0xff, 0x48, 0x6f, 0x95, 0xff, 0x47, 0x6e, 0x94, 0xff, 0x46, 0x6e, 0x93, 0xff, 0x46, 0x6d, 0x92, 0xff, 0x46, 0x6c, 0x91, 0xff, 0x45, 0x6b, 0x90, 0xff, 0x45, 0x6a, 0x8f, 0xff, 0x44, 0x6a, 0x8e, 0xff, 0x44, 0x69, 0x8d, 0xff, 0x43, 0x67, 0x8c, 0xff, 0x43, 0x67, 0x8a, 0xff, 0x42, 0x66, 0x8a, 0xff, 0x42, 0x66, 0x89, 0xff, 0x41, 0x65, 0x89, 0xff, 0x41, 0x65, 0x89, 0xff, 0x41, 0x65, 0x88, 0xff, 0x41, 0x64, 0x87, 0xff, 0x40, 0x64, 0x86, 0xff, 0x40, 0x63, 0x84, 0xff, 0x40, 0x63, 0x83, 0xff, 0x40, 0x62, 0x83, 0xff, 0x40, 0x62, 0x82, 0xff, 0x41, 0x62, 0x81, 0xff, 0x41, 0x62, 0x80, 0xff, 0x41, 0x62, 0x80, 0xff, 0x42, 0x62, 0x7f, 0xff, 0x43, 0x62, 0x7f, 0xff, 0x45, 0x63, 0x7f, 0xff, 0x47, 0x64, 0x80, 0xff, 0x4b, 0x65, 0x81, 0xff, 0x51, 0x6a, 0x84, 0xff, 0x57, 0x70, 0x88, 0xff, 0x61, 0x77, 0x8e, 0xff, 0x6b, 0x80, 0x95, 0xff, 0x72, 0x86, 0x9a, 0xff, 0x7e, 0x90, 0xa2, 0xf3, 0xa0, 0xac, 0xb6, 0xd8, 0xc8, 0xcb, 0xce, 0xc0, 0xd8, 0xd8, 0xd8, 0xc4, 0xd6, 0xd6, 0xd6, 0xd3, 0xce, 0xce, 0xce, 0xd3, 0xb7, 0xb7, 0xb7, 0xcb, 0x95, 0x95, 0x95, 0xc8, 0x96, 0x96, 0x96, 0xc8, 0xe6, 0xe6, 0xe6, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xe4, 0xe4, 0x7b, 0x9b, 0x9b, 0x9b, 0x83, 0x7c, 0x7c, 0x7c, 0x68, 0x77, 0x77, 0x77, 0x64, 0x7f, 0x7f, 0x7f, 0x68, 0xa3, 0xa3, 0xa3, 0x84, 0xcb, 0xcb, 0xcb, 0xac, 0xe8, 0xe8, 0xe8, 0xdb, 0xf6, 0xf6, 0xf6, 0xef, 0xf7, 0xf7, 0xf7, 0xef, 0xf3, 0xf3, 0xf3, 0xe0, 0xec, 0xec, 0xec, 0xd0, 0xec, 0xec, 0xec, 0xcb, 0xe2, 0xe4, 0xe5, 0xbf, 0xc8, 0xd1, 0xd8, 0xc8, 0xb4, 0xc1, 0xcd, 0xd7, 0xa4, 0xb4, 0xc3, 0xe8, 0x95, 0xa9, 0xba, 0xfb, 0x8e, 0xa2, 0xb5, 0xff, 0x84, 0x9b, 0xaf, 0xff, 0x79, 0x92, 0xa9, 0xff, 0x72, 0x8b, 0xa5, 0xff, 0x6a, 0x87, 0xa0, 0xff, 0x65, 0x83, 0x9e, 0xff, 0x60, 0x7f, 0x9c, 0xff, 0x54, 0x77, 0x96, 0xff, 0x4c, 0x70, 0x91, 0xff, 0x4c, 0x70, 0x91, 0xff, 0x4b, 0x6f, 0x91, 0xff, 0x4b, 0x6f, 0x91, 0xff, 0x4a, 0x6f, 0x91, 0xff, 0x4a, 0x6f, 0x91, 0xff, 0x49, 0x6e, 0x92, 0xff, 0x49, 0x6e, 0x92, 0xff, 0x48, 0x6e, 0x92, 0xff, 0x48, 0x6d, 0x91, 0xff, 0x48, 0x6d, 0x90, 0xff, 0x47, 0x6d, 0x90, 0xff, 0x47, 0x6c, 0x8f, 0xff, 0x46, 0x6b, 0x8f, 0xff, 0x46, 0x6b, 0x8e, 0xff, 0x46, 0x6a, 0x8e, 0xff, 0x45, 0x6a, 0x8d, 0xff, 0x45, 0x69, 0x8c, 0xff, 0x44, 0x68, 0x8b, 0xff, 0x44, 0x68, 0x8a, 0xff, 0x44, 0x67, 0x8a, 0xff, 0x44, 0x67, 0x89, 0xff, 0x43, 0x66, 0x89, 0xff, 0x43, 0x66, 0x88, 0xff, 0x43, 0x65, 0x87, 0xff, 0x42, 0x65, 0x87, 0xff, 0x42, 0x64, 0x86, 0xff, 0x41, 0x63, 0x84, 0xff, 0x41, 0x63, 0x83, 0xff, 0x41, 0x63, 0x83, 0xff, 0x42, 0x63, 0x82, 0xff, 0x41, 0x62, 0x81, 0xff, 0x41, 0x62, 0x81, 0xff, 0x42, 0x62, 0x80, 0xff, 0x42, 0x62, 0x7f, 0xff, 0x43, 0x62, 0x7f, 0xff, 0x45, 0x62, 0x7f, 0xff, 0x46, 0x63, 0x7f, 0xff, 0x48, 0x64, 0x7f, 0xff, 0x4a, 0x64, 0x7f, 0xff, 0x4b, 0x65, 0x7f, 0xff, 0x50, 0x68, 0x81, 0xff, 0x52, 0x6b, 0x83, 0xff, 0x56, 0x6e, 0x84, 0xff, 0x5e, 0x74, 0x88, 0xff, 0x65, 0x79, 0x8d, 0xff, 0x6a, 0x7e, 0x91, 0xff, 0x6b, 0x80, 0x95, 0xff, 0x68, 0x80, 0x97, 0xfc, 0x7c, 0x91, 0xa5, 0xec, 0x9b, 0xaa, 0xb8, 0xdc, 0xc3, 0xca, 0xd1, 0xcc, 0xe4, 0xe4, 0xe4, 0xcc, 0xe5, 0xe5, 0xe5, 0xdb, 0xe3, 0xe3, 0xe3, 0xe0, 0xd9, 0xd9, 0xd9, 0xdb, 0xc2, 0xc2, 0xc2, 0xc7, 0xa4, 0xa4, 0xa4, 0xb7, 0x8b, 0x8b, 0x8b, 0xb3, 0x88, 0x88, 0x88, 0xa3, 0xc0, 0xc0, 0xc0, 0x70, 0xf3, 0xf3, 0xf3, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xe5, 0xe5, 0x6c, 0xa0, 0xa0, 0xa0, 0x6f, 0x81, 0x81, 0x81, 0x4c, 0x7c, 0x7c, 0x7c, 0x4b, 0x78, 0x78, 0x78, 0x44, 0x76, 0x76, 0x76, 0x3f, 0x7a, 0x7a, 0x7a, 0x3c, 0x94, 0x94, 0x94, 0x57, 0xb6, 0xb6, 0xb6, 0x7b, 0xd6, 0xd6, 0xd6, 0xb3, 0xe9, 0xe9, 0xe9, 0xd8, 0xf6, 0xf6, 0xf6, 0xf4, 0xfb, 0xfb, 0xfb, 0xf7, 0xf7, 0xf7, 0xf7, 0xec, 0xf3, 0xf3, 0xf3, 0xdf, 0xed, 0xed, 0xed, 0xcf, 0xe6, 0xe6, 0xe6, 0xbf, 0xe2, 0xe3, 0xe3, 0xb7, 0xcc, 0xd2, 0xd7, 0xbf, 0xb8, 0xc1, 0xca, 0xcb, 0xa6, 0xb2, 0xbf, 0xd8, 0x95, 0xa4, 0xb2, 0xe8, 0x85, 0x97, 0xa9, 0xf8, 0x7b, 0x8f, 0xa2, 0xff, 0x71, 0x88, 0x9c, 0xff, 0x61, 0x7a, 0x93, 0xff, 0x57, 0x73, 0x8c, 0xff, 0x57, 0x73, 0x8c, 0xff, 0x53, 0x70, 0x8b, 0xff, 0x52, 0x6f, 0x8a, 0xff, 0x50, 0x6d, 0x89, 0xff, 0x4d, 0x6c, 0x89, 0xff, 0x4c, 0x6b, 0x89, 0xff, 0x4b, 0x6a, 0x89, 0xff, 0x4a, 0x6a, 0x89, 0xff, 0x4b, 0x6a, 0x89, 0xff, 0x4a, 0x69, 0x88, 0xff, 0x49, 0x69, 0x88, 0xff, 0x48, 0x68, 0x88, 0xff, 0x48, 0x67, 0x87, 0xff, 0x47, 0x67, 0x86, 0xff, 0x46, 0x66, 0x86, 0xff, 0x46, 0x66, 0x85, 0xff, 0x45, 0x65, 0x85, 0xff, 0x46, 0x65, 0x84, 0xff, 0x45, 0x65, 0x84, 0xff, 0x45, 0x64, 0x83, 0xff, 0x45, 0x64, 0x83, 0xff, 0x45, 0x64, 0x82, 0xff, 0x46, 0x64, 0x82, 0xff, 0x46, 0x64, 0x82, 0xff, 0x45, 0x64, 0x81, 0xff, 0x45, 0x63, 0x80, 0xff, 0x46, 0x64, 0x80, 0xff, 0x48, 0x64, 0x80, 0xff, 0x48, 0x64, 0x7f, 0xff, 0x49, 0x65, 0x80, 0xff, 0x4b, 0x65, 0x80, 0xff, 0x4b, 0x65, 0x7f, 0xff, 0x4e, 0x67, 0x80, 0xff, 0x52, 0x6a, 0x82, 0xff, 0x55, 0x6d, 0x83, 0xff, 0x5b, 0x71, 0x87, 0xff, 0x60, 0x75, 0x89, 0xff, 0x64, 0x78, 0x8c, 0xff, 0x6a, 0x7d, 0x90, 0xff, 0x6a, 0x7e, 0x93, 0xff, 0x64, 0x7c, 0x93, 0xff, 0x62, 0x7b, 0x94, 0xff, 0x5b, 0x77, 0x93, 0xff, 0x5f, 0x7c, 0x98, 0xf8, 0x70, 0x8a, 0xa3, 0xeb, 0x8a, 0x9f, 0xb3, 0xdc, 0xb1, 0xbe, 0xc9, 0xd4, 0xde, 0xe1, 0xe3, 0xcb, 0xed, 0xed, 0xed, 0xd7, 0xf1, 0xf1, 0xf1, 0xe4, 0xf2, 0xf2, 0xf2, 0xec, 0xed, 0xed, 0xed, 0xe8, 0xe3, 0xe3, 0xe3, 0xd7, 0xce, 0xce, 0xce, 0xb8, 0xb6, 0xb6, 0xb6, 0xa0, 0x9e, 0x9e, 0x9e, 0x94, 0x95, 0x95, 0x95, 0x8b, 0x9c, 0x9c, 0x9c, 0x6b, 0xbe, 0xbe, 0xbe, 0x37, 0xdb, 0xdb, 0xdb, 0x68, 0xf6, 0xf6, 0xf6, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xe5, 0xe5, 0x67, 0xa7, 0xa7, 0xa7, 0x6f, 0x89, 0x89, 0x89, 0x48, 0x83, 0x83, 0x83, 0x43, 0x7f, 0x7f, 0x7f, 0x3f, 0x7b, 0x7b, 0x7b, 0x3b, 0x78, 0x78, 0x78, 0x30, 0x75, 0x75, 0x75, 0x28, 0x76, 0x76, 0x76, 0x24, 0x8a, 0x8a, 0x8a, 0x34, 0x9e, 0x9e, 0x9e, 0x58, 0xb9, 0xb9, 0xb9, 0x8f, 0xe3, 0xe3, 0xe3, 0xd3, 0xee, 0xee, 0xee, 0xeb, 0xf7, 0xf7, 0xf7, 0xf7, 0xfb, 0xfb, 0xfb, 0xf7, 0xf8, 0xf8, 0xf8, 0xef, 0xf6, 0xf6, 0xf6, 0xe8, 0xf2, 0xf2, 0xf2, 0xdc, 0xed, 0xed, 0xed, 0xd0, 0xe8, 0xe8, 0xe8, 0xc7, 0xe4, 0xe4, 0xe4, 0xb8, 0xde, 0xde, 0xde, 0xac, 0xd0, 0xd2, 0xd4, 0xb3, 0xbf, 0xc4, 0xca, 0xbf, 0xa8, 0xb1, 0xba, 0xc8, 0x95, 0xa1, 0xad, 0xd4, 0x87, 0x96, 0xa4, 0xdf, 0x7e, 0x8e, 0x9e, 0xec, 0x73, 0x86, 0x99, 0xf4, 0x6c, 0x81, 0x94, 0xff, 0x66, 0x7b, 0x90, 0xff, 0x62, 0x78, 0x8e, 0xff, 0x5d, 0x75, 0x8b, 0xff, 0x5a, 0x72, 0x89, 0xff, 0x5b, 0x73, 0x8a, 0xff, 0x5a, 0x72, 0x89, 0xff, 0x59, 0x71, 0x89, 0xff, 0x57, 0x70, 0x89, 0xff, 0x56, 0x6f, 0x88, 0xff, 0x55, 0x6e, 0x87, 0xff, 0x53, 0x6d, 0x86, 0xff, 0x52, 0x6b, 0x85, 0xff, 0x51, 0x6b, 0x84, 0xff, 0x53, 0x6c, 0x85, 0xff, 0x53, 0x6d, 0x85, 0xff, 0x54, 0x6d, 0x85, 0xff, 0x54, 0x6d, 0x85, 0xff, 0x56, 0x6e, 0x86, 0xff, 0x57, 0x6f, 0x86, 0xff, 0x58, 0x6f, 0x86, 0xff, 0x56, 0x6e, 0x85, 0xff, 0x58, 0x6f, 0x86, 0xff, 0x5b, 0x72, 0x87, 0xff, 0x5e, 0x74, 0x89, 0xff, 0x63, 0x77, 0x8b, 0xff, 0x67, 0x7b, 0x8e, 0xff, 0x6b, 0x7f, 0x91, 0xff, 0x66, 0x7b, 0x8f, 0xff, 0x68, 0x7e, 0x93, 0xff, 0x65, 0x7d, 0x94, 0xff, 0x61, 0x7b, 0x95, 0xff, 0x5c, 0x78, 0x95, 0xff, 0x59, 0x77, 0x95, 0xfb, 0x5e, 0x7c, 0x9a, 0xf3, 0x67, 0x84, 0x9f, 0xe7, 0x76, 0x8f, 0xa8, 0xdc, 0x90, 0xa3, 0xb6, 0xd4, 0xae, 0xbb, 0xc7, 0xcf, 0xd2, 0xd7, 0xdc, 0xcb, 0xea, 0xea, 0xea, 0xcc, 0xf0, 0xf0, 0xf0, 0xdb, 0xf5, 0xf5, 0xf5, 0xe7, 0xf9, 0xf9, 0xf9, 0xf0, 0xfa, 0xfa, 0xfa, 0xf4, 0xf9, 0xf9, 0xf9, 0xf0, 0xf4, 0xf4, 0xf4, 0xdf, 0xe8, 0xe8, 0xe8, 0xbb, 0xd7, 0xd7, 0xd7, 0x98, 0xc3, 0xc3, 0xc3, 0x7f, 0xb5, 0xb5, 0xb5, 0x6c, 0xad, 0xad, 0xad, 0x63, 0xb1, 0xb1, 0xb1, 0x4c, 0xc1, 0xc1, 0xc1, 0x30, 0xd1, 0xd1, 0xd1, 0x24, 0xcb, 0xcb, 0xcb, 0x38, 0xd3, 0xd3, 0xd3, 0x97, 0xf4, 0xf4, 0xf4, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xe8, 0xe8, 0x5c, 0xac, 0xac, 0xac, 0x6f, 0x91, 0x91, 0x91, 0x4b, 0x8c, 0x8c, 0x8c, 0x47, 0x89, 0x89, 0x89, 0x43, 0x86, 0x86, 0x86, 0x3f, 0x82, 0x82, 0x82, 0x3b, 0x7e, 0x7e, 0x7e, 0x33, 0x7a, 0x7a, 0x7a, 0x2b, 0x77, 0x77, 0x77, 0x23, 0x74, 0x74, 0x74, 0x1f, 0x7e, 0x7e, 0x7e, 0x2f, 0xc9, 0xc9, 0xc9, 0x7f, 0xc7, 0xc7, 0xc7, 0x9f, 0xce, 0xce, 0xce, 0xbc, 0xdb, 0xdb, 0xdb, 0xd7, 0xe9, 0xe9, 0xe9, 0xeb, 0xf3, 0xf3, 0xf3, 0xf4, 0xf8, 0xf8, 0xf8, 0xfb, 0xfb, 0xfb, 0xfb, 0xf8, 0xf9, 0xf9, 0xf9, 0xf3, 0xf6, 0xf6, 0xf6, 0xeb, 0xf3, 0xf3, 0xf3, 0xe0, 0xf1, 0xf1, 0xf1, 0xdb, 0xee, 0xee, 0xee, 0xd4, 0xea, 0xea, 0xea, 0xcc, 0xe5, 0xe5, 0xe5, 0xc0, 0xe3, 0xe3, 0xe3, 0xbb, 0xe0, 0xe0, 0xe0, 0xb4, 0xdc, 0xdc, 0xdc, 0xaf, 0xd6, 0xd6, 0xd6, 0xac, 0xc7, 0xca, 0xce, 0xb3, 0xbd, 0xc1, 0xc5, 0xb8, 0xaf, 0xb6, 0xbe, 0xbf, 0xa4, 0xad, 0xb5, 0xc3, 0xa2, 0xac, 0xb4, 0xc4, 0x9e, 0xa8, 0xb1, 0xc7, 0x9a, 0xa4, 0xad, 0xcf, 0x96, 0xa0, 0xab, 0xd4, 0x93, 0x9e, 0xa9, 0xd4, 0x91, 0x9c, 0xa8, 0xd7, 0x8e, 0x9b, 0xa6, 0xd7, 0x8b, 0x98, 0xa4, 0xd7, 0x8a, 0x97, 0xa2, 0xd7, 0x8e, 0x9a, 0xa5, 0xd4, 0x8e, 0x9a, 0xa5, 0xd4, 0x8f, 0x9b, 0xa6, 0xd4, 0x91, 0x9b, 0xa7, 0xd4, 0x93, 0x9e, 0xa9, 0xd4, 0x95, 0xa0, 0xab, 0xd4, 0x9a, 0xa4, 0xae, 0xd3, 0x99, 0xa4, 0xae, 0xcf, 0x9d, 0xa8, 0xb2, 0xcc, 0x9f, 0xab, 0xb5, 0xc8, 0x9f, 0xac, 0xb7, 0xc7, 0xa2, 0xae, 0xba, 0xc7, 0x9e, 0xad, 0xbb, 0xc4, 0x9e, 0xad, 0xba, 0xbf, 0xa0, 0xae, 0xbc, 0xbf, 0xad, 0xb8, 0xc4, 0xc0, 0xb5, 0xbf, 0xc9, 0xc3, 0xc1, 0xc9, 0xd1, 0xc3, 0xd8, 0xdb, 0xde, 0xc0, 0xe6, 0xe6, 0xe6, 0xc3, 0xe8, 0xe8, 0xe8, 0xc8, 0xeb, 0xeb, 0xeb, 0xcf, 0xed, 0xed, 0xed, 0xd3, 0xf2, 0xf2, 0xf2, 0xdf, 0xf6, 0xf6, 0xf6, 0xeb, 0xf9, 0xf9, 0xf9, 0xf3, 0xfb, 0xfb, 0xfb, 0xf7, 0xfc, 0xfc, 0xfc, 0xf8, 0xfa, 0xfa, 0xfa, 0xf0, 0xf6, 0xf6, 0xf6, 0xdb, 0xf2, 0xf2, 0xf2, 0xb8, 0xe7, 0xe7, 0xe7, 0x8f, 0xdd, 0xdd, 0xdd, 0x6c, 0xd2, 0xd2, 0xd2, 0x54, 0xc9, 0xc9, 0xc9, 0x47, 0xc4, 0xc4, 0xc4, 0x3b, 0xc7, 0xc7, 0xc7, 0x2f, 0xcf, 0xcf, 0xcf, 0x23, 0xd2, 0xd2, 0xd2, 0x20, 0xd0, 0xd0, 0xd0, 0x2b, 0xc8, 0xc8, 0xc8, 0x3f, 0xbd, 0xbd, 0xbd, 0x6b, 0xcf, 0xcf, 0xcf, 0xc0, 0xf6, 0xf6, 0xf6, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xe6, 0xe6, 0x54, 0xb1, 0xb1, 0xb1, 0x73, 0x99, 0x99, 0x99, 0x50, 0x96, 0x96, 0x96, 0x4c, 0x93, 0x93, 0x93, 0x48, 0x91, 0x91, 0x91, 0x44, 0x8e, 0x8e, 0x8e, 0x40, 0x8b, 0x8b, 0x8b, 0x3f, 0x87, 0x87, 0x87, 0x3b, 0x83, 0x83, 0x83, 0x34, 0x7e, 0x7e, 0x7e, 0x2c, 0x7a, 0x7a, 0x7a, 0x2b, 0xcc, 0xcc, 0xcc, 0x67, 0xc6, 0xc6, 0xc6, 0x7b, 0xb9, 0xb9, 0xb9, 0x8b, 0xb3, 0xb3, 0xb3, 0xa3, 0xb3, 0xb3, 0xb3, 0xb8, 0xb9, 0xb9, 0xb9, 0xd0, 0xc1, 0xc1, 0xc1, 0xe3, 0xd0, 0xd0, 0xd0, 0xf0, 0xdf, 0xdf, 0xdf, 0xf8, 0xe9, 0xe9, 0xe9, 0xfc, 0xf4, 0xf4, 0xf4, 0xfc, 0xf7, 0xf7, 0xf7, 0xfc, 0xfa, 0xfa, 0xfa, 0xf8, 0xfa, 0xfa, 0xfa, 0xf7, 0xf9, 0xf9, 0xf9, 0xf0, 0xf7, 0xf7, 0xf7, 0xec, 0xf6, 0xf6, 0xf6, 0xe8, 0xf4, 0xf4, 0xf4, 0xe3, 0xf2, 0xf2, 0xf2, 0xdf, 0xef, 0xef, 0xef, 0xdb, 0xee, 0xee, 0xee, 0xd4, 0xeb, 0xeb, 0xeb, 0xcf, 0xe7, 0xe7, 0xe7, 0xc7, 0xe5, 0xe5, 0xe5, 0xc3, 0xe5, 0xe5, 0xe5, 0xc3, 0xe4, 0xe4, 0xe4, 0xc0, 0xe4, 0xe4, 0xe4, 0xbf, 0xe4, 0xe4, 0xe4, 0xbf, 0xe4, 0xe4, 0xe4, 0xc0, 0xe4, 0xe4, 0xe4, 0xbf, 0xe4, 0xe4, 0xe4, 0xbf, 0xe4, 0xe4, 0xe4, 0xbc, 0xe2, 0xe2, 0xe2, 0xb8, 0xdf, 0xdf, 0xdf, 0xb4, 0xe1, 0xe1, 0xe1, 0xb7, 0xe3, 0xe3, 0xe3, 0xbc, 0xe4, 0xe4, 0xe4, 0xbf, 0xe4, 0xe4, 0xe4, 0xc3, 0xe5, 0xe5, 0xe5, 0xc3, 0xe8, 0xe8, 0xe8, 0xc8, 0xe8, 0xe8, 0xe8, 0xc8, 0xea, 0xea, 0xea, 0xcc, 0xea, 0xea, 0xea, 0xcf, 0xec, 0xec, 0xec, 0xd0, 0xed, 0xed, 0xed, 0xd3, 0xec, 0xec, 0xec, 0xd3, 0xed, 0xed, 0xed, 0xd4, 0xf0, 0xf0, 0xf0, 0xdb, 0xf4, 0xf4, 0xf4, 0xe3, 0xf6, 0xf6, 0xf6, 0xe8, 0xf6, 0xf6, 0xf6, 0xec, 0xf8, 0xf8, 0xf8, 0xf0, 0xfa, 0xfa, 0xfa, 0xf4, 0xfb, 0xfb, 0xfb, 0xf7, 0xfb, 0xfb, 0xfb, 0xf8, 0xf9, 0xf9, 0xf9, 0xf8, 0xf7, 0xf7, 0xf7, 0xf3, 0xf5, 0xf5, 0xf5, 0xe3, 0xf1, 0xf1, 0xf1, 0xcc, 0xe8, 0xe8, 0xe8, 0xac, 0xe4, 0xe4, 0xe4, 0x87, 0xdf, 0xdf, 0xdf, 0x63, 0xdd, 0xdd, 0xdd, 0x44, 0xd8, 0xd8, 0xd8, 0x37, 0xd4, 0xd4, 0xd4, 0x2b, 0xd2, 0xd2, 0xd2, 0x23, 0xd3, 0xd3, 0xd3, 0x1f, 0xd4, 0xd4, 0xd4, 0x1c, 0xd3, 0xd3, 0xd3, 0x20, 0xd1, 0xd1, 0xd1, 0x27, 0xcd, 0xcd, 0xcd, 0x33, 0xc5, 0xc5, 0xc5, 0x47, 0xbb, 0xbb, 0xbb, 0x67, 0xb0, 0xb0, 0xb0, 0x98, 0xcd, 0xcd, 0xcd, 0xd8, 0xf4, 0xf4, 0xf4, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xe5, 0xe5, 0x50, 0xb0, 0xb0, 0xb0, 0x84, 0x9c, 0x9c, 0x9c, 0x5f, 0x9d, 0x9d, 0x9d, 0x57, 0x9c, 0x9c, 0x9c, 0x50, 0x9d, 0x9d, 0x9d, 0x4c, 0x9c, 0x9c, 0x9c, 0x48, 0x9a, 0x9a, 0x9a, 0x47, 0x95, 0x95, 0x95, 0x44, 0x91, 0x91, 0x91, 0x43, 0x8c, 0x8c, 0x8c, 0x3f, 0x8a, 0x8a, 0x8a, 0x3b, 0xcb, 0xcb, 0xcb, 0x64, 0xd0, 0xd0, 0xd0, 0x77, 0xc4, 0xc4, 0xc4, 0x80, 0xb6, 0xb6, 0xb6, 0x8f, 0xa9, 0xa9, 0xa9, 0xa3, 0x9e, 0x9e, 0x9e, 0xb8, 0x99, 0x99, 0x99, 0xcf, 0x98, 0x98, 0x98, 0xe0, 0x9b, 0x9b, 0x9b, 0xef, 0xa5, 0xa5, 0xa5, 0xf8, 0xb2, 0xb2, 0xb2, 0xfc, 0xb8, 0xb8, 0xb8, 0xff, 0xc5, 0xc5, 0xc5, 0xfc, 0xce, 0xce, 0xce, 0xfc, 0xd9, 0xd9, 0xd9, 0xfb, 0xe3, 0xe3, 0xe3, 0xfb, 0xe9, 0xe9, 0xe9, 0xf8, 0xef, 0xef, 0xef, 0xf8, 0xf3, 0xf3, 0xf3, 0xf8, 0xf7, 0xf7, 0xf7, 0xf8, 0xf9, 0xf9, 0xf9, 0xf7, 0xfa, 0xfa, 0xfa, 0xf4, 0xfb, 0xfb, 0xfb, 0xf7, 0xfb, 0xfb, 0xfb, 0xf7, 0xfa, 0xfa, 0xfa, 0xf7, 0xf9, 0xf9, 0xf9, 0xf3, 0xf9, 0xf9, 0xf9, 0xf3, 0xf9, 0xf9, 0xf9, 0xf3, 0xf9, 0xf9, 0xf9, 0xf3, 0xf9, 0xf9, 0xf9, 0xf3, 0xf8, 0xf8, 0xf8, 0xf0, 0xf8, 0xf8, 0xf8, 0xf0, 0xf7, 0xf7, 0xf7, 0xef, 0xf7, 0xf7, 0xf7, 0xec, 0xf7, 0xf7, 0xf7, 0xec, 0xf8, 0xf8, 0xf8, 0xf0, 0xf9, 0xf9, 0xf9, 0xf3, 0xf9, 0xf9, 0xf9, 0xf3, 0xf9, 0xf9, 0xf9, 0xf3, 0xfa, 0xfa, 0xfa, 0xf4, 0xfa, 0xfa, 0xfa, 0xf4, 0xfa, 0xfa, 0xfa, 0xf4, 0xfb, 0xfb, 0xfb, 0xf7, 0xfb, 0xfb, 0xfb, 0xf8, 0xfb, 0xfb, 0xfb, 0xf8, 0xfb, 0xfb, 0xfb, 0xf8, 0xfb, 0xfb, 0xfb, 0xfb, 0xf9, 0xf9, 0xf9, 0xfb, 0xf6, 0xf6, 0xf6, 0xfc, 0xf4, 0xf4, 0xf4, 0xfc, 0xef, 0xef, 0xef, 0xfb, 0xed, 0xed, 0xed, 0xf7, 0xe8, 0xe8, 0xe8, 0xec, 0xe4, 0xe4, 0xe4, 0xe0, 0xe3, 0xe3, 0xe3, 0xd3, 0xdc, 0xdc, 0xdc, 0xbb, 0xd9, 0xd9, 0xd9, 0xa3, 0xd7, 0xd7, 0xd7, 0x88, 0xd7, 0xd7, 0xd7, 0x6b, 0xd7, 0xd7, 0xd7, 0x53, 0xd8, 0xd8, 0xd8, 0x3b, 0xd8, 0xd8, 0xd8, 0x2b, 0xd7, 0xd7, 0xd7, 0x20, 0xd6, 0xd6, 0xd6, 0x1c, 0xd5, 0xd5, 0xd5, 0x1c, 0xd5, 0xd5, 0xd5, 0x1f, 0xd3, 0xd3, 0xd3, 0x23, 0xd1, 0xd1, 0xd1, 0x28, 0xce, 0xce, 0xce, 0x33, 0xca, 0xca, 0xca, 0x3c, 0xc3, 0xc3, 0xc3, 0x4c, 0xba, 0xba, 0xba, 0x64, 0xb0, 0xb0, 0xb0, 0x8b, 0xad, 0xad, 0xad, 0xbb, 0xcb, 0xcb, 0xcb, 0xe8, 0xf4, 0xf4, 0xf4, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xea, 0xea, 0x50, 0xaf, 0xaf, 0xaf, 0xa7, 0x9b, 0x9b, 0x9b, 0x7c, 0x9f, 0x9f, 0x9f, 0x6b, 0xa2, 0xa2, 0xa2, 0x5f, 0xa6, 0xa6, 0xa6, 0x57, 0xa8, 0xa8, 0xa8, 0x50, 0xa8, 0xa8, 0xa8, 0x4f, 0xa5, 0xa5, 0xa5, 0x4c, 0xa2, 0xa2, 0xa2, 0x4c, 0x9d, 0x9d, 0x9d, 0x4b, 0x9b, 0x9b, 0x9b, 0x48, 0xc8, 0xc8, 0xc8, 0x68, 0xd7, 0xd7, 0xd7, 0x77, 0xd5, 0xd5, 0xd5, 0x74, 0xd0, 0xd0, 0xd0, 0x78, 0xc3, 0xc3, 0xc3, 0x84, 0xb8, 0xb8, 0xb8, 0x98, 0xab, 0xab, 0xab, 0xaf, 0x9f, 0x9f, 0x9f, 0xc4, 0x95, 0x95, 0x95, 0xdb, 0x8d, 0x8d, 0x8d, 0xec, 0x8a, 0x8a, 0x8a, 0xf8, 0x88, 0x88, 0x88, 0xfb, 0x89, 0x89, 0x89, 0xfb, 0x87, 0x87, 0x87, 0xf8, 0x89, 0x89, 0x89, 0xf3, 0x94, 0x94, 0x94, 0xec, 0x9c, 0x9c, 0x9c, 0xe7, 0xa3, 0xa3, 0xa3, 0xe3, 0xad, 0xad, 0xad, 0xdc, 0xb6, 0xb6, 0xb6, 0xd7, 0xc0, 0xc0, 0xc0, 0xd7, 0xcb, 0xcb, 0xcb, 0xd4, 0xd0, 0xd0, 0xd0, 0xd4, 0xd1, 0xd1, 0xd1, 0xd4, 0xd3, 0xd3, 0xd3, 0xd4, 0xd5, 0xd5, 0xd5, 0xd0, 0xd9, 0xd9, 0xd9, 0xdb, 0xdd, 0xdd, 0xdd, 0xd8, 0xe4, 0xe4, 0xe4, 0xd7, 0xe5, 0xe5, 0xe5, 0xdb, 0xe8, 0xe8, 0xe8, 0xd4, 0xe9, 0xe9, 0xe9, 0xd4, 0xe8, 0xe8, 0xe8, 0xd3, 0xe4, 0xe4, 0xe4, 0xd0, 0xe5, 0xe5, 0xe5, 0xd0, 0xe6, 0xe6, 0xe6, 0xd4, 0xe4, 0xe4, 0xe4, 0xd8, 0xe4, 0xe4, 0xe4, 0xdc, 0xe4, 0xe4, 0xe4, 0xe0, 0xe4, 0xe4, 0xe4, 0xe4, 0xda, 0xda, 0xda, 0xe8, 0xd9, 0xd9, 0xd9, 0xec, 0xd9, 0xd9, 0xd9, 0xf3, 0xd8, 0xd8, 0xd8, 0xf7, 0xd4, 0xd4, 0xd4, 0xfb, 0xcd, 0xcd, 0xcd, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc7, 0xc7, 0xc7, 0xfc, 0xc2, 0xc2, 0xc2, 0xf7, 0xc1, 0xc1, 0xc1, 0xf0, 0xbf, 0xbf, 0xbf, 0xe7, 0xc0, 0xc0, 0xc0, 0xd8, 0xc2, 0xc2, 0xc2, 0xc8, 0xc4, 0xc4, 0xc4, 0xb4, 0xc8, 0xc8, 0xc8, 0x9c, 0xcb, 0xcb, 0xcb, 0x87, 0xce, 0xce, 0xce, 0x6c, 0xd1, 0xd1, 0xd1, 0x57, 0xd3, 0xd3, 0xd3, 0x3f, 0xd6, 0xd6, 0xd6, 0x2c, 0xd6, 0xd6, 0xd6, 0x20, 0xd6, 0xd6, 0xd6, 0x1c, 0xd5, 0xd5, 0xd5, 0x1f, 0xd5, 0xd5, 0xd5, 0x20, 0xd3, 0xd3, 0xd3, 0x27, 0xd2, 0xd2, 0xd2, 0x2c, 0xd0, 0xd0, 0xd0, 0x33, 0xcd, 0xcd, 0xcd, 0x3b, 0xc9, 0xc9, 0xc9, 0x44, 0xc3, 0xc3, 0xc3, 0x53, 0xbc, 0xbc, 0xbc, 0x67, 0xb2, 0xb2, 0xb2, 0x83, 0xad, 0xad, 0xad, 0xa8, 0xad, 0xad, 0xad, 0xd8, 0xc9, 0xc9, 0xc9, 0xf3, 0xec, 0xec, 0xec, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xe9, 0xe9, 0x53, 0xad, 0xad, 0xad, 0xd3, 0x99, 0x99, 0x99, 0xac, 0x9c, 0x9c, 0x9c, 0x94, 0xa1, 0xa1, 0xa1, 0x7c, 0xa9, 0xa9, 0xa9, 0x6c, 0xae, 0xae, 0xae, 0x60, 0xb2, 0xb2, 0xb2, 0x5b, 0xb3, 0xb3, 0xb3, 0x58, 0xb1, 0xb1, 0xb1, 0x57, 0xad, 0xad, 0xad, 0x57, 0xab, 0xab, 0xab, 0x57, 0xc7, 0xc7, 0xc7, 0x73, 0xd6, 0xd6, 0xd6, 0x84, 0xd6, 0xd6, 0xd6, 0x80, 0xd7, 0xd7, 0xd7, 0x7b, 0xd8, 0xd8, 0xd8, 0x74, 0xd6, 0xd6, 0xd6, 0x73, 0xd2, 0xd2, 0xd2, 0x78, 0xc9, 0xc9, 0xc9, 0x84, 0xbe, 0xbe, 0xbe, 0x97, 0xb3, 0xb3, 0xb3, 0xab, 0xa9, 0xa9, 0xa9, 0xbf, 0x9c, 0x9c, 0x9c, 0xcc, 0x95, 0x95, 0x95, 0xd7, 0x89, 0x89, 0x89, 0xdc, 0x7c, 0x7c, 0x7c, 0xd8, 0x79, 0x79, 0x79, 0xdb, 0x77, 0x77, 0x77, 0xd4, 0x77, 0x77, 0x77, 0xcb, 0x77, 0x77, 0x77, 0xc3, 0x78, 0x78, 0x78, 0xb7, 0x7b, 0x7b, 0x7b, 0xab, 0x7e, 0x7e, 0x7e, 0xa0, 0x7e, 0x7e, 0x7e, 0x93, 0x7f, 0x7f, 0x7f, 0x88, 0x83, 0x83, 0x83, 0x7f, 0x86, 0x86, 0x86, 0x6f, 0x89, 0x89, 0x89, 0x6b, 0x8b, 0x8b, 0x8b, 0x5f, 0x8d, 0x8d, 0x8d, 0x54, 0x91, 0x91, 0x91, 0x54, 0x94, 0x94, 0x94, 0x4b, 0x98, 0x98, 0x98, 0x47, 0x96, 0x96, 0x96, 0x43, 0x91, 0x91, 0x91, 0x43, 0x95, 0x95, 0x95, 0x47, 0x96, 0x96, 0x96, 0x57, 0x8f, 0x8f, 0x8f, 0x64, 0x92, 0x92, 0x92, 0x77, 0x93, 0x93, 0x93, 0x8b, 0x96, 0x96, 0x96, 0xa0, 0x95, 0x95, 0x95, 0xb7, 0x98, 0x98, 0x98, 0xcb, 0x99, 0x99, 0x99, 0xdc, 0x9c, 0x9c, 0x9c, 0xeb, 0x9f, 0x9f, 0x9f, 0xf7, 0xa3, 0xa3, 0xa3, 0xfb, 0xa6, 0xa6, 0xa6, 0xf7, 0xab, 0xab, 0xab, 0xf0, 0xaf, 0xaf, 0xaf, 0xe8, 0xb4, 0xb4, 0xb4, 0xdb, 0xb9, 0xb9, 0xb9, 0xcb, 0xbd, 0xbd, 0xbd, 0xb8, 0xc1, 0xc1, 0xc1, 0xa0, 0xc6, 0xc6, 0xc6, 0x8c, 0xca, 0xca, 0xca, 0x73, 0xce, 0xce, 0xce, 0x5f, 0xd2, 0xd2, 0xd2, 0x48, 0xd4, 0xd4, 0xd4, 0x34, 0xd5, 0xd5, 0xd5, 0x2b, 0xd5, 0xd5, 0xd5, 0x24, 0xd4, 0xd4, 0xd4, 0x24, 0xd3, 0xd3, 0xd3, 0x27, 0xd3, 0xd3, 0xd3, 0x2b, 0xd2, 0xd2, 0xd2, 0x2f, 0xd1, 0xd1, 0xd1, 0x34, 0xcf, 0xcf, 0xcf, 0x3c, 0xcd, 0xcd, 0xcd, 0x47, 0xc9, 0xc9, 0xc9, 0x4c, 0xc5, 0xc5, 0xc5, 0x5b, 0xbe, 0xbe, 0xbe, 0x6b, 0xb6, 0xb6, 0xb6, 0x80, 0xaf, 0xaf, 0xaf, 0xa0, 0xac, 0xac, 0xac, 0xcb, 0xac, 0xac, 0xac, 0xf0, 0xc6, 0xc6, 0xc6, 0xeb, 0xf6, 0xf6, 0xf6, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xee, 0xee, 0x23, 0xad, 0xad, 0xad, 0xe7, 0x94, 0x94, 0x94, 0xdc, 0x99, 0x99, 0x99, 0xc4, 0x9d, 0x9d, 0x9d, 0xac, 0xa6, 0xa6, 0xa6, 0x94, 0xad, 0xad, 0xad, 0x83, 0xb5, 0xb5, 0xb5, 0x73, 0xbb, 0xbb, 0xbb, 0x6b, 0xbc, 0xbc, 0xbc, 0x67, 0xbb, 0xbb, 0xbb, 0x64, 0xb8, 0xb8, 0xb8, 0x67, 0xc9, 0xc9, 0xc9, 0x7b, 0xd7, 0xd7, 0xd7, 0x94, 0xd6, 0xd6, 0xd6, 0x94, 0xd5, 0xd5, 0xd5, 0x90, 0xd5, 0xd5, 0xd5, 0x8c, 0xd7, 0xd7, 0xd7, 0x84, 0xd9, 0xd9, 0xd9, 0x7b, 0xdb, 0xdb, 0xdb, 0x74, 0xdd, 0xdd, 0xdd, 0x6f, 0xdb, 0xdb, 0xdb, 0x6c, 0xd7, 0xd7, 0xd7, 0x6f, 0xcd, 0xcd, 0xcd, 0x77, 0xc1, 0xc1, 0xc1, 0x83, 0xb6, 0xb6, 0xb6, 0x8b, 0xa1, 0xa1, 0xa1, 0x8b, 0x9a, 0x9a, 0x9a, 0x94, 0x94, 0x94, 0x94, 0x98, 0x90, 0x90, 0x90, 0x98, 0x89, 0x89, 0x89, 0x98, 0x86, 0x86, 0x86, 0x93, 0x81, 0x81, 0x81, 0x8b, 0x7d, 0x7d, 0x7d, 0x80, 0x7b, 0x7b, 0x7b, 0x77, 0x7a, 0x7a, 0x7a, 0x6c, 0x78, 0x78, 0x78, 0x5f, 0x77, 0x77, 0x77, 0x53, 0x76, 0x76, 0x76, 0x47, 0x75, 0x75, 0x75, 0x3c, 0x75, 0x75, 0x75, 0x33, 0x74, 0x74, 0x74, 0x28, 0x74, 0x74, 0x74, 0x20, 0x74, 0x74, 0x74, 0x1c, 0x73, 0x73, 0x73, 0x1b, 0x74, 0x74, 0x74, 0x1c, 0x76, 0x76, 0x76, 0x24, 0x77, 0x77, 0x77, 0x33, 0x7b, 0x7b, 0x7b, 0x44, 0x7f, 0x7f, 0x7f, 0x57, 0x84, 0x84, 0x84, 0x6c, 0x89, 0x89, 0x89, 0x80, 0x8d, 0x8d, 0x8d, 0x93, 0x93, 0x93, 0x93, 0xa4, 0x9a, 0x9a, 0x9a, 0xb3, 0x9d, 0x9d, 0x9d, 0xbc, 0xa3, 0xa3, 0xa3, 0xc3, 0xa9, 0xa9, 0xa9, 0xc4, 0xae, 0xae, 0xae, 0xc0, 0xb3, 0xb3, 0xb3, 0xbb, 0xb9, 0xb9, 0xb9, 0xaf, 0xbe, 0xbe, 0xbe, 0xa0, 0xc2, 0xc2, 0xc2, 0x93, 0xc6, 0xc6, 0xc6, 0x7f, 0xca, 0xca, 0xca, 0x6c, 0xce, 0xce, 0xce, 0x5b, 0xd2, 0xd2, 0xd2, 0x48, 0xd3, 0xd3, 0xd3, 0x3c, 0xd4, 0xd4, 0xd4, 0x38, 0xd3, 0xd3, 0xd3, 0x38, 0xd2, 0xd2, 0xd2, 0x38, 0xd2, 0xd2, 0xd2, 0x37, 0xd2, 0xd2, 0xd2, 0x38, 0xd2, 0xd2, 0xd2, 0x38, 0xd1, 0xd1, 0xd1, 0x3b, 0xd0, 0xd0, 0xd0, 0x40, 0xce, 0xce, 0xce, 0x47, 0xcc, 0xcc, 0xcc, 0x50, 0xc8, 0xc8, 0xc8, 0x58, 0xc5, 0xc5, 0xc5, 0x63, 0xbf, 0xbf, 0xbf, 0x70, 0xb9, 0xb9, 0xb9, 0x84, 0xb1, 0xb1, 0xb1, 0x9f, 0xad, 0xad, 0xad, 0xc7, 0xa8, 0xa8, 0xa8, 0xeb, 0xa9, 0xa9, 0xa9, 0xfb, 0xbf, 0xbf, 0xbf, 0xcc, 0xec, 0xec, 0xec, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0xab, 0xab, 0x4b, 0x90, 0x90, 0x90, 0xf3, 0x91, 0x91, 0x91, 0xf3, 0x96, 0x96, 0x96, 0xe0, 0x9e, 0x9e, 0x9e, 0xc8, 0xa6, 0xa6, 0xa6, 0xb7, 0xb0, 0xb0, 0xb0, 0xa0, 0xb9, 0xb9, 0xb9, 0x8c, 0xbf, 0xbf, 0xbf, 0x80, 0xc1, 0xc1, 0xc1, 0x78, 0xc0, 0xc0, 0xc0, 0x78, 0xcb, 0xcb, 0xcb, 0x88, 0xd9, 0xd9, 0xd9, 0xa4, 0xd6, 0xd6, 0xd6, 0xa8, 0xd5, 0xd5, 0xd5, 0xa8, 0xd4, 0xd4, 0xd4, 0xa8, 0xd4, 0xd4, 0xd4, 0xa4, 0xd5, 0xd5, 0xd5, 0x9f, 0xd7, 0xd7, 0xd7, 0x9b, 0xd8, 0xd8, 0xd8, 0x90, 0xd9, 0xd9, 0xd9, 0x88, 0xda, 0xda, 0xda, 0x7c, 0xd9, 0xd9, 0xd9, 0x74, 0xd7, 0xd7, 0xd7, 0x67, 0xd4, 0xd4, 0xd4, 0x5f, 0xc7, 0xc7, 0xc7, 0x50, 0xc0, 0xc0, 0xc0, 0x4f, 0xba, 0xba, 0xba, 0x4f, 0xb3, 0xb3, 0xb3, 0x4f, 0xab, 0xab, 0xab, 0x4f, 0xa4, 0xa4, 0xa4, 0x4f, 0x9c, 0x9c, 0x9c, 0x50, 0x95, 0x95, 0x95, 0x50, 0x91, 0x91, 0x91, 0x48, 0x8b, 0x8b, 0x8b, 0x47, 0x87, 0x87, 0x87, 0x40, 0x83, 0x83, 0x83, 0x3b, 0x7f, 0x7f, 0x7f, 0x34, 0x7a, 0x7a, 0x7a, 0x2f, 0x78, 0x78, 0x78, 0x28, 0x77, 0x77, 0x77, 0x23, 0x75, 0x75, 0x75, 0x1f, 0x73, 0x73, 0x73, 0x1c, 0x72, 0x72, 0x72, 0x1b, 0x73, 0x73, 0x73, 0x1c, 0x76, 0x76, 0x76, 0x20, 0x78, 0x78, 0x78, 0x27, 0x7d, 0x7d, 0x7d, 0x2f, 0x83, 0x83, 0x83, 0x3b, 0x89, 0x89, 0x89, 0x44, 0x8f, 0x8f, 0x8f, 0x4f, 0x95, 0x95, 0x95, 0x57, 0x9b, 0x9b, 0x9b, 0x5c, 0xa3, 0xa3, 0xa3, 0x63, 0xab, 0xab, 0xab, 0x67, 0xb0, 0xb0, 0xb0, 0x68, 0xb7, 0xb7, 0xb7, 0x68, 0xbd, 0xbd, 0xbd, 0x67, 0xc2, 0xc2, 0xc2, 0x64, 0xc7, 0xc7, 0xc7, 0x5f, 0xcb, 0xcb, 0xcb, 0x5b, 0xce, 0xce, 0xce, 0x53, 0xd0, 0xd0, 0xd0, 0x50, 0xd1, 0xd1, 0xd1, 0x4f, 0xd1, 0xd1, 0xd1, 0x4f, 0xd2, 0xd2, 0xd2, 0x53, 0xd1, 0xd1, 0xd1, 0x57, 0xd1, 0xd1, 0xd1, 0x57, 0xd1, 0xd1, 0xd1, 0x57, 0xd0, 0xd0, 0xd0, 0x54, 0xd0, 0xd0, 0xd0, 0x53, 0xcf, 0xcf, 0xcf, 0x4c, 0xcf, 0xcf, 0xcf, 0x4f, 0xcd, 0xcd, 0xcd, 0x50, 0xcc, 0xcc, 0xcc, 0x54, 0xca, 0xca, 0xca, 0x5b, 0xc7, 0xc7, 0xc7, 0x64, 0xc3, 0xc3, 0xc3, 0x70, 0xbf, 0xbf, 0xbf, 0x7c, 0xba, 0xba, 0xba, 0x90, 0xb3, 0xb3, 0xb3, 0xab, 0xad, 0xad, 0xad, 0xcb, 0xa7, 0xa7, 0xa7, 0xeb, 0xa1, 0xa1, 0xa1, 0xfb, 0x9c, 0x9c, 0x9c, 0xdc, 0xa6, 0xa6, 0xa6, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x96, 0x96, 0x50, 0x8a, 0x8a, 0x8a, 0xe8, 0x8e, 0x8e, 0x8e, 0xf8, 0x95, 0x95, 0x95, 0xf4, 0x9b, 0x9b, 0x9b, 0xe8, 0xa3, 0xa3, 0xa3, 0xd7, 0xad, 0xad, 0xad, 0xc3, 0xb7, 0xb7, 0xb7, 0xaf, 0xbf, 0xbf, 0xbf, 0x9f, 0xc1, 0xc1, 0xc1, 0x94, 0xc9, 0xc9, 0xc9, 0x9c, 0xda, 0xda, 0xda, 0xb4, 0xd7, 0xd7, 0xd7, 0xb8, 0xd5, 0xd5, 0xd5, 0xbf, 0xd4, 0xd4, 0xd4, 0xc4, 0xd3, 0xd3, 0xd3, 0xc4, 0xd3, 0xd3, 0xd3, 0xc3, 0xd2, 0xd2, 0xd2, 0xc4, 0xd3, 0xd3, 0xd3, 0xbf, 0xd3, 0xd3, 0xd3, 0xb7, 0xd3, 0xd3, 0xd3, 0xac, 0xd2, 0xd2, 0xd2, 0xa0, 0xd2, 0xd2, 0xd2, 0x93, 0xcf, 0xcf, 0xcf, 0x87, 0xc4, 0xc4, 0xc4, 0x74, 0xc1, 0xc1, 0xc1, 0x67, 0xbf, 0xbf, 0xbf, 0x5f, 0xb9, 0xb9, 0xb9, 0x58, 0xb4, 0xb4, 0xb4, 0x4f, 0xae, 0xae, 0xae, 0x48, 0xaa, 0xaa, 0xaa, 0x40, 0xa4, 0xa4, 0xa4, 0x3b, 0x9e, 0x9e, 0x9e, 0x37, 0x98, 0x98, 0x98, 0x33, 0x92, 0x92, 0x92, 0x2f, 0x8c, 0x8c, 0x8c, 0x2b, 0x87, 0x87, 0x87, 0x27, 0x81, 0x81, 0x81, 0x23, 0x7c, 0x7c, 0x7c, 0x20, 0x78, 0x78, 0x78, 0x1f, 0x75, 0x75, 0x75, 0x1c, 0x74, 0x74, 0x74, 0x1b, 0x72, 0x72, 0x72, 0x1b, 0x74, 0x74, 0x74, 0x1b, 0x76, 0x76, 0x76, 0x1c, 0x7a, 0x7a, 0x7a, 0x1f, 0x80, 0x80, 0x80, 0x23, 0x87, 0x87, 0x87, 0x27, 0x8d, 0x8d, 0x8d, 0x2b, 0x95, 0x95, 0x95, 0x2f, 0x9b, 0x9b, 0x9b, 0x34, 0xa2, 0xa2, 0xa2, 0x38, 0xa9, 0xa9, 0xa9, 0x3c, 0xb0, 0xb0, 0xb0, 0x43, 0xb7, 0xb7, 0xb7, 0x48, 0xbe, 0xbe, 0xbe, 0x4f, 0xc2, 0xc2, 0xc2, 0x54, 0xc7, 0xc7, 0xc7, 0x5b, 0xca, 0xca, 0xca, 0x63, 0xcc, 0xcc, 0xcc, 0x6b, 0xcd, 0xcd, 0xcd, 0x73, 0xcd, 0xcd, 0xcd, 0x77, 0xcd, 0xcd, 0xcd, 0x7b, 0xce, 0xce, 0xce, 0x80, 0xce, 0xce, 0xce, 0x83, 0xce, 0xce, 0xce, 0x83, 0xce, 0xce, 0xce, 0x7f, 0xce, 0xce, 0xce, 0x78, 0xce, 0xce, 0xce, 0x77, 0xcd, 0xcd, 0xcd, 0x6f, 0xcc, 0xcc, 0xcc, 0x68, 0xcb, 0xcb, 0xcb, 0x67, 0xc9, 0xc9, 0xc9, 0x67, 0xc8, 0xc8, 0xc8, 0x6f, 0xc6, 0xc6, 0xc6, 0x74, 0xc1, 0xc1, 0xc1, 0x80, 0xbd, 0xbd, 0xbd, 0x90, 0xb7, 0xb7, 0xb7, 0xa4, 0xb2, 0xb2, 0xb2, 0xbb, 0xac, 0xac, 0xac, 0xd8, 0xa5, 0xa5, 0xa5, 0xf3, 0x9d, 0x9d, 0x9d, 0xf8, 0x94, 0x94, 0x94, 0xdb, 0x8f, 0x8f, 0x8f, 0x6f, 0x93, 0x93, 0x93, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x87, 0x87, 0x33, 0x88, 0x88, 0x88, 0xbb, 0x8c, 0x8c, 0x8c, 0xeb, 0x91, 0x91, 0x91, 0xfb, 0x9a, 0x9a, 0x9a, 0xf8, 0xa2, 0xa2, 0xa2, 0xef, 0xac, 0xac, 0xac, 0xdf, 0xb3, 0xb3, 0xb3, 0xd0, 0xbc, 0xbc, 0xbc, 0xc3, 0xc5, 0xc5, 0xc5, 0xbc, 0xd9, 0xd9, 0xd9, 0xc8, 0xd7, 0xd7, 0xd7, 0xcb, 0xd6, 0xd6, 0xd6, 0xcf, 0xd3, 0xd3, 0xd3, 0xd4, 0xd2, 0xd2, 0xd2, 0xdb, 0xd1, 0xd1, 0xd1, 0xe0, 0xd1, 0xd1, 0xd1, 0xe3, 0xd1, 0xd1, 0xd1, 0xe3, 0xd1, 0xd1, 0xd1, 0xdc, 0xd0, 0xd0, 0xd0, 0xd7, 0xcf, 0xcf, 0xcf, 0xcb, 0xcd, 0xcd, 0xcd, 0xbf, 0xc9, 0xc9, 0xc9, 0xb7, 0xc1, 0xc1, 0xc1, 0xa3, 0xbf, 0xbf, 0xbf, 0x97, 0xbc, 0xbc, 0xbc, 0x8f, 0xb7, 0xb7, 0xb7, 0x80, 0xb2, 0xb2, 0xb2, 0x74, 0xad, 0xad, 0xad, 0x6c, 0xa9, 0xa9, 0xa9, 0x63, 0xa4, 0xa4, 0xa4, 0x58, 0x9f, 0x9f, 0x9f, 0x53, 0x9a, 0x9a, 0x9a, 0x4b, 0x94, 0x94, 0x94, 0x43, 0x8f, 0x8f, 0x8f, 0x3c, 0x89, 0x89, 0x89, 0x34, 0x85, 0x85, 0x85, 0x2f, 0x81, 0x81, 0x81, 0x28, 0x7d, 0x7d, 0x7d, 0x24, 0x7a, 0x7a, 0x7a, 0x23, 0x78, 0x78, 0x78, 0x20, 0x77, 0x77, 0x77, 0x1f, 0x77, 0x77, 0x77, 0x1f, 0x7a, 0x7a, 0x7a, 0x23, 0x7f, 0x7f, 0x7f, 0x27, 0x84, 0x84, 0x84, 0x2c, 0x89, 0x89, 0x89, 0x34, 0x91, 0x91, 0x91, 0x3c, 0x98, 0x98, 0x98, 0x44, 0x9d, 0x9d, 0x9d, 0x4f, 0xa4, 0xa4, 0xa4, 0x54, 0xab, 0xab, 0xab, 0x5f, 0xb0, 0xb0, 0xb0, 0x68, 0xb6, 0xb6, 0xb6, 0x70, 0xbc, 0xbc, 0xbc, 0x7c, 0xc0, 0xc0, 0xc0, 0x88, 0xc4, 0xc4, 0xc4, 0x94, 0xc7, 0xc7, 0xc7, 0x9b, 0xc9, 0xc9, 0xc9, 0xa7, 0xca, 0xca, 0xca, 0xab, 0xca, 0xca, 0xca, 0xb3, 0xcb, 0xcb, 0xcb, 0xb3, 0xcb, 0xcb, 0xcb, 0xb7, 0xcb, 0xcb, 0xcb, 0xb0, 0xcc, 0xcc, 0xcc, 0xac, 0xcb, 0xcb, 0xcb, 0xa4, 0xcb, 0xcb, 0xcb, 0x9f, 0xca, 0xca, 0xca, 0x94, 0xca, 0xca, 0xca, 0x88, 0xc8, 0xc8, 0xc8, 0x84, 0xc7, 0xc7, 0xc7, 0x83, 0xc5, 0xc5, 0xc5, 0x84, 0xc2, 0xc2, 0xc2, 0x8b, 0xbf, 0xbf, 0xbf, 0x98, 0xba, 0xba, 0xba, 0xa7, 0xb4, 0xb4, 0xb4, 0xbb, 0xae, 0xae, 0xae, 0xd4, 0xa8, 0xa8, 0xa8, 0xeb, 0xa0, 0xa0, 0xa0, 0xf8, 0x99, 0x99, 0x99, 0xf4, 0x8f, 0x8f, 0x8f, 0xcf, 0x89, 0x89, 0x89, 0x5f, 0x87, 0x87, 0x87, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0x10, 0x85, 0x85, 0x85, 0x80, 0x89, 0x89, 0x89, 0xcc, 0x8e, 0x8e, 0x8e, 0xec, 0x96, 0x96, 0x96, 0xf8, 0x9e, 0x9e, 0x9e, 0xfb, 0xa8, 0xa8, 0xa8, 0xf7, 0xb3, 0xb3, 0xb3, 0xec, 0xbd, 0xbd, 0xbd, 0xe0, 0xd6, 0xd6, 0xd6, 0xe3, 0xd8, 0xd8, 0xd8, 0xdf, 0xd7, 0xd7, 0xd7, 0xe0, 0xd5, 0xd5, 0xd5, 0xe3, 0xd2, 0xd2, 0xd2, 0xe7, 0xd1, 0xd1, 0xd1, 0xef, 0xd0, 0xd0, 0xd0, 0xf3, 0xcf, 0xcf, 0xcf, 0xf7, 0xce, 0xce, 0xce, 0xf4, 0xcc, 0xcc, 0xcc, 0xf3, 0xcb, 0xcb, 0xcb, 0xeb, 0xc9, 0xc9, 0xc9, 0xe3, 0xc7, 0xc7, 0xc7, 0xdb, 0xc0, 0xc0, 0xc0, 0xcb, 0xbf, 0xbf, 0xbf, 0xbf, 0xbc, 0xbc, 0xbc, 0xb4, 0xb8, 0xb8, 0xb8, 0xa8, 0xb4, 0xb4, 0xb4, 0x9c, 0xb1, 0xb1, 0xb1, 0x93, 0xad, 0xad, 0xad, 0x84, 0xa9, 0xa9, 0xa9, 0x7b, 0xa5, 0xa5, 0xa5, 0x70, 0xa0, 0xa0, 0xa0, 0x67, 0x9c, 0x9c, 0x9c, 0x5c, 0x98, 0x98, 0x98, 0x54, 0x93, 0x93, 0x93, 0x4b, 0x8e, 0x8e, 0x8e, 0x43, 0x8b, 0x8b, 0x8b, 0x3c, 0x88, 0x88, 0x88, 0x34, 0x87, 0x87, 0x87, 0x33, 0x85, 0x85, 0x85, 0x2f, 0x84, 0x84, 0x84, 0x2c, 0x86, 0x86, 0x86, 0x30, 0x87, 0x87, 0x87, 0x33, 0x8a, 0x8a, 0x8a, 0x3b, 0x8e, 0x8e, 0x8e, 0x43, 0x94, 0x94, 0x94, 0x4b, 0x99, 0x99, 0x99, 0x57, 0x9e, 0x9e, 0x9e, 0x5f, 0xa3, 0xa3, 0xa3, 0x6c, 0xa8, 0xa8, 0xa8, 0x77, 0xad, 0xad, 0xad, 0x83, 0xb2, 0xb2, 0xb2, 0x90, 0xb7, 0xb7, 0xb7, 0x9b, 0xbc, 0xbc, 0xbc, 0xab, 0xc0, 0xc0, 0xc0, 0xb7, 0xc3, 0xc3, 0xc3, 0xc4, 0xc5, 0xc5, 0xc5, 0xcb, 0xc6, 0xc6, 0xc6, 0xd4, 0xc8, 0xc8, 0xc8, 0xd8, 0xc9, 0xc9, 0xc9, 0xdc, 0xc9, 0xc9, 0xc9, 0xdc, 0xc8, 0xc8, 0xc8, 0xdb, 0xc9, 0xc9, 0xc9, 0xd4, 0xc9, 0xc9, 0xc9, 0xcf, 0xc8, 0xc8, 0xc8, 0xc3, 0xc7, 0xc7, 0xc7, 0xb8, 0xc7, 0xc7, 0xc7, 0xaf, 0xc6, 0xc6, 0xc6, 0xa7, 0xc4, 0xc4, 0xc4, 0xa3, 0xc1, 0xc1, 0xc1, 0xa4, 0xbf, 0xbf, 0xbf, 0xab, 0xbc, 0xbc, 0xbc, 0xb7, 0xb6, 0xb6, 0xb6, 0xc4, 0xb0, 0xb0, 0xb0, 0xd8, 0xaa, 0xaa, 0xaa, 0xe8, 0xa3, 0xa3, 0xa3, 0xf7, 0x9b, 0x9b, 0x9b, 0xf8, 0x93, 0x93, 0x93, 0xe7, 0x8b, 0x8b, 0x8b, 0xb4, 0x85, 0x85, 0x85, 0x3c, 0x83, 0x83, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x81, 0x81, 0x03, 0x84, 0x84, 0x84, 0x3c, 0x87, 0x87, 0x87, 0xa3, 0x8c, 0x8c, 0x8c, 0xd4, 0x95, 0x95, 0x95, 0xe8, 0xa0, 0xa0, 0xa0, 0xf7, 0xad, 0xad, 0xad, 0xfc, 0xb7, 0xb7, 0xb7, 0xfb, 0xd2, 0xd2, 0xd2, 0xf8, 0xd9, 0xd9, 0xd9, 0xf3, 0xdc, 0xdc, 0xdc, 0xf0, 0xdc, 0xdc, 0xdc, 0xf0, 0xdb, 0xdb, 0xdb, 0xf0, 0xd8, 0xd8, 0xd8, 0xf7, 0xd4, 0xd4, 0xd4, 0xfb, 0xd1, 0xd1, 0xd1, 0xfc, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xfc, 0xca, 0xca, 0xca, 0xf8, 0xc8, 0xc8, 0xc8, 0xf4, 0xc7, 0xc7, 0xc7, 0xef, 0xc0, 0xc0, 0xc0, 0xe4, 0xc0, 0xc0, 0xc0, 0xdb, 0xbf, 0xbf, 0xbf, 0xd0, 0xbd, 0xbd, 0xbd, 0xc4, 0xba, 0xba, 0xba, 0xbb, 0xb6, 0xb6, 0xb6, 0xaf, 0xb4, 0xb4, 0xb4, 0xa3, 0xb0, 0xb0, 0xb0, 0x97, 0xad, 0xad, 0xad, 0x8c, 0xa9, 0xa9, 0xa9, 0x80, 0xa7, 0xa7, 0xa7, 0x74, 0xa4, 0xa4, 0xa4, 0x6c, 0xa0, 0xa0, 0xa0, 0x63, 0x9c, 0x9c, 0x9c, 0x5b, 0x9b, 0x9b, 0x9b, 0x53, 0x98, 0x98, 0x98, 0x4b, 0x97, 0x97, 0x97, 0x47, 0x95, 0x95, 0x95, 0x43, 0x95, 0x95, 0x95, 0x40, 0x97, 0x97, 0x97, 0x44, 0x97, 0x97, 0x97, 0x48, 0x9a, 0x9a, 0x9a, 0x50, 0x9c, 0x9c, 0x9c, 0x5b, 0xa0, 0xa0, 0xa0, 0x64, 0xa4, 0xa4, 0xa4, 0x70, 0xa8, 0xa8, 0xa8, 0x7c, 0xad, 0xad, 0xad, 0x8b, 0xaf, 0xaf, 0xaf, 0x97, 0xb3, 0xb3, 0xb3, 0xa4, 0xb7, 0xb7, 0xb7, 0xb0, 0xbb, 0xbb, 0xbb, 0xbc, 0xbe, 0xbe, 0xbe, 0xcb, 0xc0, 0xc0, 0xc0, 0xd4, 0xc2, 0xc2, 0xc2, 0xe0, 0xc3, 0xc3, 0xc3, 0xe8, 0xc5, 0xc5, 0xc5, 0xef, 0xc6, 0xc6, 0xc6, 0xf3, 0xc7, 0xc7, 0xc7, 0xf3, 0xc6, 0xc6, 0xc6, 0xf3, 0xc6, 0xc6, 0xc6, 0xec, 0xc6, 0xc6, 0xc6, 0xe7, 0xc6, 0xc6, 0xc6, 0xdf, 0xc6, 0xc6, 0xc6, 0xd4, 0xc7, 0xc7, 0xc7, 0xcf, 0xc6, 0xc6, 0xc6, 0xc8, 0xc5, 0xc5, 0xc5, 0xc7, 0xc3, 0xc3, 0xc3, 0xc8, 0xc0, 0xc0, 0xc0, 0xcf, 0xbc, 0xbc, 0xbc, 0xd7, 0xb6, 0xb6, 0xb6, 0xe3, 0xaf, 0xaf, 0xaf, 0xf0, 0xa8, 0xa8, 0xa8, 0xf8, 0x9f, 0x9f, 0x9f, 0xf8, 0x97, 0x97, 0x97, 0xec, 0x8d, 0x8d, 0x8d, 0xcf, 0x87, 0x87, 0x87, 0x7f, 0x84, 0x84, 0x84, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0x0b, 0x85, 0x85, 0x85, 0x54, 0x8a, 0x8a, 0x8a, 0xaf, 0x96, 0x96, 0x96, 0xd4, 0xa4, 0xa4, 0xa4, 0xeb, 0xb2, 0xb2, 0xb2, 0xf7, 0xd0, 0xd0, 0xd0, 0xfc, 0xdb, 0xdb, 0xdb, 0xfc, 0xe2, 0xe2, 0xe2, 0xfc, 0xe5, 0xe5, 0xe5, 0xfb, 0xe8, 0xe8, 0xe8, 0xfb, 0xe7, 0xe7, 0xe7, 0xfb, 0xe4, 0xe4, 0xe4, 0xfc, 0xdf, 0xdf, 0xdf, 0xfc, 0xdc, 0xdc, 0xdc, 0xff, 0xd9, 0xd9, 0xd9, 0xfc, 0xd3, 0xd3, 0xd3, 0xfb, 0xd0, 0xd0, 0xd0, 0xfb, 0xcd, 0xcd, 0xcd, 0xf4, 0xc6, 0xc6, 0xc6, 0xef, 0xc4, 0xc4, 0xc4, 0xe8, 0xc3, 0xc3, 0xc3, 0xe0, 0xc2, 0xc2, 0xc2, 0xd7, 0xc0, 0xc0, 0xc0, 0xcc, 0xbf, 0xbf, 0xbf, 0xc3, 0xbd, 0xbd, 0xbd, 0xb7, 0xba, 0xba, 0xba, 0xac, 0xb8, 0xb8, 0xb8, 0xa0, 0xb5, 0xb5, 0xb5, 0x94, 0xb3, 0xb3, 0xb3, 0x8c, 0xb2, 0xb2, 0xb2, 0x83, 0xae, 0xae, 0xae, 0x78, 0xad, 0xad, 0xad, 0x70, 0xac, 0xac, 0xac, 0x68, 0xaa, 0xaa, 0xaa, 0x60, 0xa9, 0xa9, 0xa9, 0x5c, 0xa7, 0xa7, 0xa7, 0x5b, 0xa7, 0xa7, 0xa7, 0x58, 0xa9, 0xa9, 0xa9, 0x5b, 0xaa, 0xaa, 0xaa, 0x5f, 0xac, 0xac, 0xac, 0x68, 0xad, 0xad, 0xad, 0x6f, 0xae, 0xae, 0xae, 0x7b, 0xb2, 0xb2, 0xb2, 0x87, 0xb4, 0xb4, 0xb4, 0x8f, 0xb7, 0xb7, 0xb7, 0x9f, 0xb9, 0xb9, 0xb9, 0xab, 0xbc, 0xbc, 0xbc, 0xb8, 0xbe, 0xbe, 0xbe, 0xc7, 0xbf, 0xbf, 0xbf, 0xd0, 0xc1, 0xc1, 0xc1, 0xdc, 0xc2, 0xc2, 0xc2, 0xe4, 0xc4, 0xc4, 0xc4, 0xef, 0xc4, 0xc4, 0xc4, 0xf4, 0xc5, 0xc5, 0xc5, 0xf8, 0xc5, 0xc5, 0xc5, 0xfc, 0xc6, 0xc6, 0xc6, 0xfb, 0xc6, 0xc6, 0xc6, 0xf8, 0xc8, 0xc8, 0xc8, 0xf7, 0xc9, 0xc9, 0xc9, 0xf0, 0xcb, 0xcb, 0xcb, 0xec, 0xcd, 0xcd, 0xcd, 0xe7, 0xcd, 0xcd, 0xcd, 0xe4, 0xcd, 0xcd, 0xcd, 0xe4, 0xcc, 0xcc, 0xcc, 0xe7, 0xc9, 0xc9, 0xc9, 0xec, 0xc4, 0xc4, 0xc4, 0xf3, 0xbf, 0xbf, 0xbf, 0xf8, 0xb5, 0xb5, 0xb5, 0xfb, 0xac, 0xac, 0xac, 0xf8, 0xa0, 0xa0, 0xa0, 0xec, 0x95, 0x95, 0x95, 0xd7, 0x8a, 0x8a, 0x8a, 0x9c, 0x86, 0x86, 0x86, 0x34, 0x81, 0x81, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x84, 0x84, 0x0f, 0x88, 0x88, 0x88, 0x5b, 0x91, 0x91, 0x91, 0xb3, 0xa3, 0xa3, 0xa3, 0xdc, 0xc6, 0xc6, 0xc6, 0xf0, 0xd7, 0xd7, 0xd7, 0xf8, 0xe2, 0xe2, 0xe2, 0xfc, 0xea, 0xea, 0xea, 0xfc, 0xf2, 0xf2, 0xf2, 0xfc, 0xf6, 0xf6, 0xf6, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xed, 0xed, 0xed, 0xfc, 0xe8, 0xe8, 0xe8, 0xfc, 0xe4, 0xe4, 0xe4, 0xfb, 0xde, 0xde, 0xde, 0xf8, 0xd6, 0xd6, 0xd6, 0xf3, 0xd5, 0xd5, 0xd5, 0xf0, 0xd2, 0xd2, 0xd2, 0xe8, 0xcf, 0xcf, 0xcf, 0xe3, 0xcc, 0xcc, 0xcc, 0xdb, 0xca, 0xca, 0xca, 0xd3, 0xc7, 0xc7, 0xc7, 0xc8, 0xc6, 0xc6, 0xc6, 0xbf, 0xc6, 0xc6, 0xc6, 0xb4, 0xc3, 0xc3, 0xc3, 0xab, 0xc2, 0xc2, 0xc2, 0xa0, 0xc0, 0xc0, 0xc0, 0x97, 0xbe, 0xbe, 0xbe, 0x8f, 0xbe, 0xbe, 0xbe, 0x87, 0xbd, 0xbd, 0xbd, 0x7f, 0xbb, 0xbb, 0xbb, 0x77, 0xbb, 0xbb, 0xbb, 0x74, 0xb9, 0xb9, 0xb9, 0x70, 0xb9, 0xb9, 0xb9, 0x6f, 0xbc, 0xbc, 0xbc, 0x70, 0xbd, 0xbd, 0xbd, 0x74, 0xbe, 0xbe, 0xbe, 0x7f, 0xbe, 0xbe, 0xbe, 0x87, 0xbe, 0xbe, 0xbe, 0x90, 0xbf, 0xbf, 0xbf, 0x9b, 0xc0, 0xc0, 0xc0, 0xa4, 0xc2, 0xc2, 0xc2, 0xb0, 0xc3, 0xc3, 0xc3, 0xbc, 0xc4, 0xc4, 0xc4, 0xc8, 0xc6, 0xc6, 0xc6, 0xd0, 0xc7, 0xc7, 0xc7, 0xdb, 0xc8, 0xc8, 0xc8, 0xe4, 0xca, 0xca, 0xca, 0xec, 0xca, 0xca, 0xca, 0xf3, 0xce, 0xce, 0xce, 0xf8, 0xcf, 0xcf, 0xcf, 0xfc, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xfc, 0xd5, 0xd5, 0xd5, 0xfc, 0xd9, 0xd9, 0xd9, 0xfb, 0xdc, 0xdc, 0xdc, 0xf8, 0xdf, 0xdf, 0xdf, 0xf7, 0xdf, 0xdf, 0xdf, 0xf7, 0xde, 0xde, 0xde, 0xf8, 0xdb, 0xdb, 0xdb, 0xf8, 0xd5, 0xd5, 0xd5, 0xfc, 0xcf, 0xcf, 0xcf, 0xfc, 0xc5, 0xc5, 0xc5, 0xfb, 0xba, 0xba, 0xba, 0xf4, 0xad, 0xad, 0xad, 0xeb, 0x9d, 0x9d, 0x9d, 0xd8, 0x91, 0x91, 0x91, 0x9b, 0x89, 0x89, 0x89, 0x3c, 0x83, 0x83, 0x83, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x07, 0x89, 0x89, 0x89, 0x48, 0xa5, 0xa5, 0xa5, 0xa7, 0xb7, 0xb7, 0xb7, 0xeb, 0xcc, 0xcc, 0xcc, 0xf7, 0xdc, 0xdc, 0xdc, 0xfb, 0xe7, 0xe7, 0xe7, 0xfc, 0xf1, 0xf1, 0xf1, 0xfc, 0xf6, 0xf6, 0xf6, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfb, 0xfb, 0xfb, 0xfc, 0xf8, 0xf8, 0xf8, 0xfc, 0xf5, 0xf5, 0xf5, 0xfb, 0xf1, 0xf1, 0xf1, 0xf8, 0xf0, 0xf0, 0xf0, 0xf8, 0xec, 0xec, 0xec, 0xf4, 0xe8, 0xe8, 0xe8, 0xf0, 0xe4, 0xe4, 0xe4, 0xec, 0xe1, 0xe1, 0xe1, 0xe7, 0xdc, 0xdc, 0xdc, 0xdf, 0xdc, 0xdc, 0xdc, 0xd7, 0xda, 0xda, 0xda, 0xcf, 0xd8, 0xd8, 0xd8, 0xc7, 0xd5, 0xd5, 0xd5, 0xbf, 0xd3, 0xd3, 0xd3, 0xb4, 0xd1, 0xd1, 0xd1, 0xab, 0xd2, 0xd2, 0xd2, 0xa4, 0xd2, 0xd2, 0xd2, 0x9c, 0xd1, 0xd1, 0xd1, 0x94, 0xd0, 0xd0, 0xd0, 0x90, 0xcf, 0xcf, 0xcf, 0x8c, 0xcf, 0xcf, 0xcf, 0x8c, 0xd1, 0xd1, 0xd1, 0x8f, 0xd1, 0xd1, 0xd1, 0x93, 0xd2, 0xd2, 0xd2, 0x98, 0xd2, 0xd2, 0xd2, 0xa0, 0xd3, 0xd3, 0xd3, 0xa8, 0xd5, 0xd5, 0xd5, 0xb3, 0xd5, 0xd5, 0xd5, 0xbc, 0xd6, 0xd6, 0xd6, 0xc4, 0xd5, 0xd5, 0xd5, 0xcf, 0xd5, 0xd5, 0xd5, 0xd7, 0xd8, 0xd8, 0xd8, 0xdf, 0xda, 0xda, 0xda, 0xe4, 0xdd, 0xdd, 0xdd, 0xec, 0xe1, 0xe1, 0xe1, 0xf3, 0xe3, 0xe3, 0xe3, 0xf7, 0xe5, 0xe5, 0xe5, 0xfb, 0xe8, 0xe8, 0xe8, 0xfc, 0xec, 0xec, 0xec, 0xff, 0xec, 0xec, 0xec, 0xff, 0xf0, 0xf0, 0xf0, 0xfc, 0xf3, 0xf3, 0xf3, 0xfc, 0xf3, 0xf3, 0xf3, 0xfc, 0xf1, 0xf1, 0xf1, 0xfc, 0xec, 0xec, 0xec, 0xfc, 0xe4, 0xe4, 0xe4, 0xfc, 0xd9, 0xd9, 0xd9, 0xfc, 0xcd, 0xcd, 0xcd, 0xf8, 0xbe, 0xbe, 0xbe, 0xf3, 0xae, 0xae, 0xae, 0xeb, 0x9e, 0x9e, 0x9e, 0xd0, 0x94, 0x94, 0x94, 0x83, 0x89, 0x89, 0x89, 0x2c, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x89, 0x89, 0x1c, 0x92, 0x92, 0x92, 0x68, 0xa6, 0xa6, 0xa6, 0xbb, 0xb6, 0xb6, 0xb6, 0xf4, 0xc5, 0xc5, 0xc5, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xee, 0xee, 0xee, 0xfc, 0xf3, 0xf3, 0xf3, 0xfc, 0xf7, 0xf7, 0xf7, 0xfc, 0xf9, 0xf9, 0xf9, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfb, 0xfb, 0xfc, 0xfa, 0xfa, 0xfa, 0xfb, 0xf8, 0xf8, 0xf8, 0xf8, 0xf6, 0xf6, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xf4, 0xf6, 0xf6, 0xf6, 0xf0, 0xf3, 0xf3, 0xf3, 0xec, 0xf1, 0xf1, 0xf1, 0xeb, 0xef, 0xef, 0xef, 0xe4, 0xec, 0xec, 0xec, 0xdc, 0xef, 0xef, 0xef, 0xdc, 0xee, 0xee, 0xee, 0xd7, 0xed, 0xed, 0xed, 0xd0, 0xeb, 0xeb, 0xeb, 0xcf, 0xea, 0xea, 0xea, 0xcb, 0xeb, 0xeb, 0xeb, 0xcb, 0xed, 0xed, 0xed, 0xcf, 0xec, 0xec, 0xec, 0xd3, 0xed, 0xed, 0xed, 0xd3, 0xed, 0xed, 0xed, 0xd8, 0xef, 0xef, 0xef, 0xd8, 0xef, 0xef, 0xef, 0xdc, 0xf1, 0xf1, 0xf1, 0xe3, 0xf2, 0xf2, 0xf2, 0xe7, 0xf2, 0xf2, 0xf2, 0xec, 0xf1, 0xf1, 0xf1, 0xef, 0xf2, 0xf2, 0xf2, 0xf3, 0xf5, 0xf5, 0xf5, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfa, 0xfa, 0xfa, 0xfc, 0xfa, 0xfa, 0xfa, 0xfc, 0xfb, 0xfb, 0xfb, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe0, 0xe0, 0xe0, 0xfc, 0xd4, 0xd4, 0xd4, 0xfc, 0xc5, 0xc5, 0xc5, 0xf8, 0xb2, 0xb2, 0xb2, 0xf7, 0xa4, 0xa4, 0xa4, 0xdf, 0x9a, 0x9a, 0x9a, 0x97, 0x8e, 0x8e, 0x8e, 0x48, 0x85, 0x85, 0x85, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x83, 0x83, 0x14, 0x8a, 0x8a, 0x8a, 0x50, 0x95, 0x95, 0x95, 0x90, 0xa4, 0xa4, 0xa4, 0xcf, 0xb1, 0xb1, 0xb1, 0xf4, 0xc1, 0xc1, 0xc1, 0xf8, 0xcd, 0xcd, 0xcd, 0xf8, 0xd2, 0xd2, 0xd2, 0xf7, 0xd8, 0xd8, 0xd8, 0xf7, 0xdb, 0xdb, 0xdb, 0xf7, 0xe2, 0xe2, 0xe2, 0xf7, 0xe8, 0xe8, 0xe8, 0xf8, 0xee, 0xee, 0xee, 0xf8, 0xf2, 0xf2, 0xf2, 0xf8, 0xf2, 0xf2, 0xf2, 0xf8, 0xf4, 0xf4, 0xf4, 0xf8, 0xf6, 0xf6, 0xf6, 0xfb, 0xf7, 0xf7, 0xf7, 0xfb, 0xf9, 0xf9, 0xf9, 0xfb, 0xfa, 0xfa, 0xfa, 0xfc, 0xfa, 0xfa, 0xfa, 0xfb, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf8, 0xfb, 0xfb, 0xfb, 0xf8, 0xfb, 0xfb, 0xfb, 0xf8, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfa, 0xfa, 0xfa, 0xfb, 0xfa, 0xfa, 0xfa, 0xfc, 0xf9, 0xf9, 0xf9, 0xfc, 0xf8, 0xf8, 0xf8, 0xfb, 0xf8, 0xf8, 0xf8, 0xfb, 0xf6, 0xf6, 0xf6, 0xfb, 0xf4, 0xf4, 0xf4, 0xfb, 0xf0, 0xf0, 0xf0, 0xfb, 0xec, 0xec, 0xec, 0xfb, 0xe7, 0xe7, 0xe7, 0xfb, 0xe2, 0xe2, 0xe2, 0xfb, 0xda, 0xda, 0xda, 0xfb, 0xd2, 0xd2, 0xd2, 0xfc, 0xca, 0xca, 0xca, 0xfc, 0xc0, 0xc0, 0xc0, 0xff, 0xb8, 0xb8, 0xb8, 0xfc, 0xa8, 0xa8, 0xa8, 0xef, 0x9d, 0x9d, 0x9d, 0xbb, 0x93, 0x93, 0x93, 0x78, 0x89, 0x89, 0x89, 0x38, 0x84, 0x84, 0x84, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x13, 0x8f, 0x8f, 0x8f, 0x40, 0x90, 0x90, 0x90, 0x70, 0x9b, 0x9b, 0x9b, 0x98, 0xa4, 0xa4, 0xa4, 0xbc, 0xa6, 0xa6, 0xa6, 0xd8, 0xae, 0xae, 0xae, 0xdf, 0xb9, 0xb9, 0xb9, 0xe0, 0xbf, 0xbf, 0xbf, 0xe0, 0xc0, 0xc0, 0xc0, 0xe0, 0xc7, 0xc7, 0xc7, 0xe3, 0xce, 0xce, 0xce, 0xe3, 0xd2, 0xd2, 0xd2, 0xe3, 0xd7, 0xd7, 0xd7, 0xe3, 0xdd, 0xdd, 0xdd, 0xe4, 0xdf, 0xdf, 0xdf, 0xe7, 0xdd, 0xdd, 0xdd, 0xe4, 0xde, 0xde, 0xde, 0xe7, 0xe2, 0xe2, 0xe2, 0xe8, 0xe3, 0xe3, 0xe3, 0xe7, 0xe4, 0xe4, 0xe4, 0xe7, 0xe7, 0xe7, 0xe7, 0xe8, 0xe8, 0xe8, 0xe8, 0xeb, 0xe5, 0xe5, 0xe5, 0xe4, 0xe3, 0xe3, 0xe3, 0xe4, 0xe3, 0xe3, 0xe3, 0xe7, 0xe3, 0xe3, 0xe3, 0xe4, 0xe0, 0xe0, 0xe0, 0xe8, 0xdf, 0xdf, 0xdf, 0xe7, 0xdc, 0xdc, 0xdc, 0xe8, 0xda, 0xda, 0xda, 0xe8, 0xd8, 0xd8, 0xd8, 0xe7, 0xd3, 0xd3, 0xd3, 0xe7, 0xd2, 0xd2, 0xd2, 0xe7, 0xd0, 0xd0, 0xd0, 0xe8, 0xd2, 0xd2, 0xd2, 0xeb, 0xcb, 0xcb, 0xcb, 0xeb, 0xc2, 0xc2, 0xc2, 0xeb, 0xb8, 0xb8, 0xb8, 0xec, 0xaf, 0xaf, 0xaf, 0xef, 0xa5, 0xa5, 0xa5, 0xe8, 0x9f, 0x9f, 0x9f, 0xd4, 0x99, 0x99, 0x99, 0xb7, 0x93, 0x93, 0x93, 0x8b, 0x8b, 0x8b, 0x8b, 0x5f, 0x84, 0x84, 0x84, 0x33, 0x81, 0x81, 0x81, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0x07, 0x89, 0x89, 0x89, 0x1f, 0x8e, 0x8e, 0x8e, 0x3b, 0x89, 0x89, 0x89, 0x50, 0x8e, 0x8e, 0x8e, 0x67, 0x93, 0x93, 0x93, 0x77, 0x97, 0x97, 0x97, 0x8b, 0x9d, 0x9d, 0x9d, 0x94, 0xa2, 0xa2, 0xa2, 0xa7, 0xa6, 0xa6, 0xa6, 0xaf, 0xa3, 0xa3, 0xa3, 0xb0, 0xa4, 0xa4, 0xa4, 0xb4, 0xa7, 0xa7, 0xa7, 0xb7, 0xa7, 0xa7, 0xa7, 0xb8, 0xaa, 0xaa, 0xaa, 0xb3, 0xac, 0xac, 0xac, 0xb4, 0xae, 0xae, 0xae, 0xb4, 0xb3, 0xb3, 0xb3, 0xb7, 0xae, 0xae, 0xae, 0xb0, 0xad, 0xad, 0xad, 0xb4, 0xad, 0xad, 0xad, 0xb3, 0xac, 0xac, 0xac, 0xb3, 0xa6, 0xa6, 0xa6, 0xb8, 0xa3, 0xa3, 0xa3, 0xb7, 0xa4, 0xa4, 0xa4, 0xb4, 0xa7, 0xa7, 0xa7, 0xb8, 0xa4, 0xa4, 0xa4, 0xb4, 0xa1, 0xa1, 0xa1, 0xb0, 0x9d, 0x9d, 0x9d, 0xa7, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x8c, 0x99, 0x99, 0x99, 0x78, 0x92, 0x92, 0x92, 0x60, 0x8b, 0x8b, 0x8b, 0x4b, 0x85, 0x85, 0x85, 0x24, 0x82, 0x82, 0x82, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x81, 0x81, 0x00, 0x81, 0x81, 0x81, 0x0b, 0x81, 0x81, 0x81, 0x10, 0x81, 0x81, 0x81, 0x14, 0x81, 0x81, 0x81, 0x17, 0x81, 0x81, 0x81, 0x17, 0x81, 0x81, 0x81, 0x17, 0x83, 0x83, 0x83, 0x17, 0x90, 0x90, 0x90, 0x18, 0x86, 0x86, 0x86, 0x17, 0x89, 0x89, 0x89, 0x17, 0x84, 0x84, 0x84, 0x17, 0x83, 0x83, 0x83, 0x17, 0x82, 0x82, 0x82, 0x17, 0x82, 0x82, 0x82, 0x14, 0x83, 0x83, 0x83, 0x13, 0x83, 0x83, 0x83, 0x0c, 0x81, 0x81, 0x81, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const lv_image_dsc_t animimg002 = {
+    .header.w = 130,
+    .header.h = 170,
+    .header.stride = 520,
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .data = animimg002_map,
+    .data_size = sizeof(animimg002_map),
+};
+
+#endif /* LV_BUILD_EXAMPLES */
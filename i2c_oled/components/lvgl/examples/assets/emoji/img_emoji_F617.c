@@ -0,0 +1,254 @@
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+    #include "lvgl.h"
+#else
+    #include "../../../lvgl.h"
+#endif
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+#ifndef LV_ATTRIBUTE_IMAGE_1F617
+    #define LV_ATTRIBUTE_IMAGE_1F617
+#endif
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMAGE_1F617 uint8_t emoji_F617_map[] = {
+#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
+    /*Pixel format: Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xd1, 0xd0, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xd0, 0xd1, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xd1, 0xf1, 0xf1, 0xf0, 0xf4, 0xf4, 0xf4, 0xf9, 0xf8, 0xf8, 0xf8, 0xf9, 0xf8, 0xf9, 0xf4, 0xf4, 0xf0, 0xf1, 0xf1, 0xd1, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xf1, 0xf0, 0xf4, 0xf4, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xf4, 0xf4, 0xf0, 0xf1, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xf1, 0xf0, 0xf4, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xf4, 0xf4, 0xf1, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xf1, 0xf4, 0xf4, 0xf8, 0xf8, 0xfc, 0xfc, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfd, 0xfc, 0xf8, 0xf8, 0xf4, 0xf4, 0xf1, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xf1, 0xf0, 0xf4, 0xf8, 0xf8, 0xfc, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0xf8, 0xf8, 0xf4, 0xf0, 0xf1, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xf0, 0xf4, 0xf4, 0xf8, 0xf8, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0xf8, 0xf4, 0xf4, 0xf0, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xf0, 0xf4, 0xf4, 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xf8, 0xf4, 0xf4, 0xf0, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xf0, 0xf4, 0xf8, 0xf8, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf8, 0xf8, 0xf4, 0xf0, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xf0, 0xf4, 0xf8, 0xf8, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xf8, 0xf4, 0xf0, 0xf1, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xf0, 0xf4, 0xf4, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xf8, 0xf4, 0xf0, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xf0, 0xf4, 0xf4, 0xf9, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf9, 0xf4, 0xf4, 0xf0, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xf0, 0xf4, 0xf4, 0xf8, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xf9, 0xf4, 0xf4, 0xf0, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xf0, 0xf4, 0xf4, 0xf8, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xf9, 0xf4, 0xf4, 0xf0, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xf0, 0xf4, 0xf4, 0xf8, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xf8, 0xf4, 0xf4, 0xf0, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xf0, 0xf4, 0xf4, 0xf9, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xf4, 0xf4, 0xf0, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xf0, 0xf4, 0xf4, 0xf9, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xf9, 0xf4, 0xf4, 0xf0, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xf0, 0xf4, 0xf4, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xf4, 0xf4, 0xf0, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xf0, 0xf4, 0xf4, 0xf9, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xf9, 0xf4, 0xf4, 0xf0, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xf0, 0xf4, 0xf4, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xf4, 0xf0, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xf0, 0xf0, 0xf4, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xf4, 0xf4, 0xf0, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xf0, 0xf4, 0xf4, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xf4, 0xf4, 0xf0, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xd1, 0xf0, 0xf0, 0xf4, 0xf4, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xb0, 0x88, 0xac, 0xf9, 0xfd, 0xfe, 0xfd, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xfd, 0xfe, 0xfd, 0xd5, 0xac, 0x88, 0xd0, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf4, 0xf0, 0xf0, 0xd1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xd1, 0xf0, 0xf0, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0x88, 0x64, 0x64, 0x64, 0x68, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd0, 0x64, 0x64, 0x64, 0x64, 0xac, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf0, 0xf0, 0xd1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf1, 0xf0, 0xf0, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xb0, 0x64, 0x88, 0x88, 0x88, 0x64, 0xac, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0x88, 0x68, 0x88, 0x88, 0x88, 0x64, 0xd5, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xfd, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf0, 0xf0, 0xf1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xcc, 0xf0, 0xf0, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0x88, 0x88, 0xac, 0xac, 0xac, 0x88, 0x88, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd5, 0x68, 0x88, 0xac, 0xac, 0xac, 0x68, 0xb0, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf0, 0xf0, 0xd0, 0xd1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xd1, 0xcc, 0xf0, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0x88, 0x88, 0xac, 0xac, 0xac, 0xac, 0x88, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd5, 0x88, 0xac, 0xac, 0xac, 0xac, 0x88, 0xac, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf0, 0xcc, 0xd1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xd1, 0xf0, 0xf0, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0x88, 0x88, 0xac, 0xac, 0xac, 0xac, 0x88, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd5, 0x88, 0xac, 0xac, 0xac, 0xac, 0x88, 0xac, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf0, 0xf0, 0xd1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xd1, 0xf0, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xb0, 0x88, 0xac, 0xac, 0xac, 0x88, 0xac, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0x88, 0xac, 0xac, 0xac, 0xac, 0x88, 0xd0, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf0, 0xd0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xd0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0x88, 0x88, 0xac, 0x88, 0x88, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd5, 0x88, 0xac, 0xac, 0x88, 0xac, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf0, 0xf1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xcc, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xb0, 0xac, 0xb0, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd5, 0xac, 0xac, 0xd0, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xcc, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xcc, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xcc, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xcc, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xcc, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xcc, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xcc, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xcc, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xfd, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xcc, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf1, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xfd, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xcc, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xd0, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xf1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xd0, 0xcc, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xd0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xd1, 0xcc, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xcc, 0xd1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xd1, 0xcc, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xf9, 0xf9, 0xfd, 0xf9, 0xfd, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xcc, 0xd1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xcc, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xf9, 0xd5, 0xd0, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xd0, 0xd1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf1, 0xf0, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xb0, 0x68, 0x64, 0x88, 0xac, 0xd0, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xf0, 0xf1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xd1, 0xcc, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xf9, 0xd5, 0xac, 0x68, 0x64, 0x88, 0xcc, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xcc, 0xd1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xd1, 0xcc, 0xf0, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xf9, 0xb0, 0x64, 0x64, 0xac, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xcc, 0xd1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xf9, 0x88, 0x64, 0x68, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xf0, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xcc, 0xf0, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xd0, 0x88, 0x68, 0xac, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xcc, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xf0, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xb0, 0x68, 0x88, 0xb0, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xf0, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xcc, 0xf0, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xb0, 0x88, 0x64, 0x88, 0xd0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xf0, 0xcc, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xf0, 0xf0, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xac, 0x64, 0x64, 0xb0, 0xf9, 0xf4, 0xf0, 0xf0, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xf0, 0xd0, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xcc, 0xf0, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xb0, 0x64, 0x68, 0xb0, 0xf4, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xf0, 0xcc, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xf0, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xd5, 0xac, 0x68, 0x88, 0xac, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xf0, 0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xcc, 0xcc, 0xf0, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xd0, 0x68, 0x64, 0x88, 0xcc, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xf0, 0xf0, 0xcc, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xcc, 0xf0, 0xf0, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xd5, 0x88, 0x64, 0x68, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xf0, 0xf0, 0xcc, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xcc, 0xf0, 0xf0, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0x88, 0x68, 0x88, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xf0, 0xf0, 0xcc, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xf0, 0xf0, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xcc, 0x88, 0x68, 0x88, 0xd0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xf0, 0xf0, 0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xcc, 0xcc, 0xf0, 0xf0, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xac, 0x88, 0x68, 0x68, 0xac, 0xd0, 0xf4, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xf0, 0xf0, 0xcc, 0xcc, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xcc, 0xcc, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xd0, 0xac, 0xac, 0xd0, 0xf4, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xf0, 0xf0, 0xcc, 0xcc, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xcc, 0xcc, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xcc, 0xcc, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xcc, 0xcc, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xcc, 0xcc, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xcc, 0xcc, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xcc, 0xcc, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xcc, 0xcc, 0xcc, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xcc, 0xcc, 0xcc, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xcc, 0xcc, 0xcc, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf4, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xcc, 0xcc, 0xd0, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xd1, 0xcc, 0xcc, 0xcc, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xcc, 0xcc, 0xd0, 0xd0, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xd1, 0xf1, 0xd0, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xd0, 0xf1, 0xd1, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xd1, 0xd1, 0xd0, 0xf1, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xf1, 0xd0, 0xd1, 0xd1, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+#endif
+#if LV_COLOR_DEPTH == 16
+    /*Pixel format: Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xcc,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xcc, 0xe4, 0xcb, 0xc4, 0xd3, 0x04, 0xdc, 0x04, 0xdc, 0x84, 0xec, 0x84, 0xec, 0x84, 0xec, 0x84, 0xec, 0x04, 0xdc, 0x04, 0xdc, 0xc4, 0xd3, 0xe4, 0xcb, 0x25, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xcc, 0xe4, 0xcb, 0x04, 0xdc, 0x84, 0xec, 0x83, 0xf4, 0x03, 0xf5, 0x83, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0xc5, 0xfd, 0x01, 0xfe, 0xa4, 0xfd, 0x83, 0xfd, 0x03, 0xf5, 0x83, 0xf4, 0x84, 0xec, 0x04, 0xdc, 0xe4, 0xcb, 0x25, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xcb, 0x04, 0xdc, 0x83, 0xf4, 0x03, 0xf5, 0x83, 0xfd, 0x01, 0xfe, 0x01, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x83, 0xfd, 0x03, 0xf5, 0x83, 0xf4, 0x84, 0xec, 0xe4, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xcb, 0x84, 0xec, 0x42, 0xf4, 0x83, 0xfd, 0x01, 0xfe, 0x01, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0x06, 0xff, 0x67, 0xff, 0x8a, 0xff, 0xac, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xac, 0xff, 0x8a, 0xff, 0x09, 0xff, 0x06, 0xff, 0xa1, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x83, 0xfd, 0x03, 0xf5, 0x84, 0xec, 0xe4, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xcb, 0x84, 0xec, 0x03, 0xf5, 0x61, 0xfd, 0x01, 0xfe, 0x01, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0x09, 0xff, 0x4e, 0xff, 0xd3, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xd3, 0xff, 0xcf, 0xff, 0x09, 0xff, 0xa6, 0xfe, 0xa1, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x61, 0xfd, 0x03, 0xf5, 0x84, 0xec, 0xe4, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xcc, 0x04, 0xdc, 0x42, 0xf4, 0x61, 0xfd, 0x01, 0xfe, 0x01, 0xfe, 0xa1, 0xfe, 0xe6, 0xfe, 0x4e, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0x70, 0xff, 0x09, 0xff, 0xa1, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x61, 0xfd, 0x42, 0xf4, 0x84, 0xec, 0x25, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xcb, 0x83, 0xf4, 0x01, 0xfd, 0x61, 0xfd, 0x01, 0xfe, 0x01, 0xfe, 0xa6, 0xfe, 0x70, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xd1, 0xff, 0x09, 0xff, 0xa1, 0xfe, 0x01, 0xfe, 0x61, 0xfd, 0x01, 0xfd, 0x83, 0xf4, 0xe4, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xd3, 0x42, 0xf4, 0x61, 0xfd, 0x61, 0xfd, 0x01, 0xfe, 0xa1, 0xfe, 0x4e, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0x70, 0xff, 0xa6, 0xfe, 0x01, 0xfe, 0x61, 0xfd, 0x61, 0xfd, 0x42, 0xf4, 0xc4, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xdc, 0x81, 0xfc, 0x61, 0xfd, 0x01, 0xfe, 0x01, 0xfe, 0xa9, 0xfe, 0xd3, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0x0b, 0xff, 0x01, 0xfe, 0x01, 0xfe, 0x61, 0xfd, 0x81, 0xfc, 0x84, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xcb, 0x81, 0xfc, 0x61, 0xfd, 0x01, 0xfe, 0x01, 0xfe, 0x0b, 0xff, 0xf6, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0x70, 0xff, 0x25, 0xfe, 0x01, 0xfe, 0x61, 0xfd, 0x81, 0xfc, 0x84, 0xec, 0x25, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xdc, 0x81, 0xfc, 0x61, 0xfd, 0x61, 0xfd, 0x01, 0xfe, 0x4e, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0x70, 0xff, 0x66, 0xfe, 0x01, 0xfe, 0x61, 0xfd, 0x81, 0xfc, 0x84, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xdc, 0x81, 0xfc, 0x61, 0xfd, 0x61, 0xfd, 0x25, 0xfe, 0x4e, 0xff, 0xf6, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xf6, 0xff, 0xd3, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xd3, 0xff, 0xf6, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xf6, 0xff, 0x70, 0xff, 0x87, 0xfe, 0x61, 0xfd, 0x61, 0xfd, 0x81, 0xfc, 0x84, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xd3, 0x81, 0xfc, 0x01, 0xfd, 0x61, 0xfd, 0x01, 0xfe, 0x4e, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xd3, 0xff, 0xf6, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0x70, 0xff, 0x46, 0xfe, 0x61, 0xfd, 0x01, 0xfd, 0x81, 0xfc, 0xc4, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xcb, 0x42, 0xf4, 0x01, 0xfd, 0x61, 0xfd, 0x01, 0xfe, 0x4e, 0xff, 0xd3, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd3, 0xff, 0xd1, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xf6, 0xff, 0xd3, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xd3, 0xff, 0xf6, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd1, 0xff, 0xd3, 0xff, 0xd1, 0xff, 0x70, 0xff, 0xd3, 0xff, 0x70, 0xff, 0x25, 0xfe, 0x61, 0xfd, 0x01, 0xfd, 0x42, 0xf4, 0xe4, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xcc, 0x83, 0xf4, 0x01, 0xfd, 0x61, 0xfd, 0x01, 0xfe, 0xa9, 0xfe, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd3, 0xff, 0xd1, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd1, 0xff, 0xd3, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0x70, 0xff, 0xd1, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x4e, 0xff, 0x01, 0xfe, 0x61, 0xfd, 0x01, 0xfd, 0x83, 0xf4, 0x25, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xdc, 0x81, 0xfc, 0x01, 0xfd, 0x61, 0xfd, 0x47, 0xfe, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0xd1, 0xff, 0x70, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd3, 0xff, 0xd1, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd1, 0xff, 0xd3, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0xa9, 0xfe, 0x61, 0xfd, 0x01, 0xfd, 0x81, 0xfc, 0x84, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xcb, 0x42, 0xf4, 0x01, 0xfd, 0x61, 0xfd, 0xc5, 0xfd, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x70, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xd1, 0xff, 0xcf, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xcf, 0xff, 0xd1, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0x70, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x07, 0xfe, 0x61, 0xfd, 0x01, 0xfd, 0x42, 0xf4, 0xe4, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xec, 0x81, 0xfc, 0x01, 0xfd, 0x61, 0xfd, 0xa9, 0xfe, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xd1, 0xff, 0xcf, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xcf, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xcf, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xcf, 0xff, 0xd1, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xd1, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x0b, 0xff, 0x83, 0xfd, 0x01, 0xfd, 0x81, 0xfc, 0x82, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xcb, 0x42, 0xf4, 0x01, 0xfd, 0x61, 0xfd, 0xc5, 0xfd, 0x0b, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0xac, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xac, 0xff, 0xcf, 0xff, 0x4e, 0xff, 0xac, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0x47, 0xfe, 0x61, 0xfd, 0x01, 0xfd, 0x61, 0xe4, 0xe4, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xcb, 0x81, 0xfc, 0x01, 0xfd, 0x61, 0xfd, 0x47, 0xfe, 0x0b, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0x4e, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xcf, 0xff, 0xac, 0xff, 0xcf, 0xff, 0xac, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xac, 0xff, 0xcf, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0x4e, 0xff, 0xac, 0xff, 0x4e, 0xff, 0xac, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0xa9, 0xfe, 0xa4, 0xfd, 0x01, 0xfd, 0x81, 0xfc, 0x82, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xcb, 0x42, 0xf4, 0x81, 0xfc, 0x01, 0xfd, 0xc5, 0xfd, 0xa9, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe, 0x0b, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0xac, 0xff, 0x4e, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0x0b, 0xff, 0xac, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0xa9, 0xfe, 0xa9, 0xfe, 0x07, 0xfe, 0x61, 0xfd, 0x01, 0xfd, 0x42, 0xf4, 0xe4, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xdc, 0x81, 0xfc, 0x01, 0xfd, 0x61, 0xfd, 0x07, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe, 0x0b, 0xff, 0xa9, 0xfe, 0x0b, 0xff, 0x09, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0x8a, 0xff, 0x0b, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0xac, 0xff, 0xac, 0xff, 0x8a, 0xff, 0xa9, 0xfe, 0x09, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0x09, 0xff, 0xa9, 0xfe, 0x8a, 0xff, 0xac, 0xff, 0x8a, 0xff, 0x0b, 0xff, 0x8a, 0xff, 0x0b, 0xff, 0x8a, 0xff, 0x0b, 0xff, 0x8a, 0xff, 0x0b, 0xff, 0x09, 0xff, 0x0b, 0xff, 0xa9, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe, 0x07, 0xfe, 0x83, 0xfd, 0x01, 0xfd, 0x81, 0xfc, 0x84, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xcc, 0x83, 0xf4, 0x81, 0xfc, 0x01, 0xfd, 0x83, 0xfd, 0x47, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe, 0x0b, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x8a, 0xff, 0x0b, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x47, 0xe6, 0xa3, 0xab, 0x61, 0x8a, 0x21, 0xa3, 0x47, 0xe6, 0x8a, 0xff, 0xac, 0xff, 0x8a, 0xff, 0xac, 0xff, 0x8a, 0xff, 0xac, 0xff, 0xac, 0xff, 0xac, 0xff, 0x8a, 0xff, 0xac, 0xff, 0xac, 0xff, 0x8a, 0xff, 0xac, 0xff, 0x8a, 0xff, 0x25, 0xcd, 0xe1, 0x9a, 0x61, 0x8a, 0x64, 0xc4, 0xa9, 0xfe, 0x8a, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x0b, 0xff, 0x8a, 0xff, 0x09, 0xff, 0x09, 0xff, 0x0b, 0xff, 0x09, 0xff, 0xa9, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe, 0x47, 0xfe, 0xa4, 0xfd, 0x01, 0xfd, 0x81, 0xfc, 0x83, 0xf4, 0x25, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xcb, 0x42, 0xf4, 0x81, 0xfc, 0x01, 0xfd, 0xa4, 0xfd, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x47, 0xe6, 0x61, 0x8a, 0x40, 0x61, 0x80, 0x69, 0x40, 0x61, 0xc0, 0x71, 0x47, 0xe6, 0x8a, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x64, 0xc4, 0x80, 0x69, 0x40, 0x61, 0x80, 0x69, 0x40, 0x61, 0x21, 0xa3, 0xa9, 0xfe, 0x8a, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0xa9, 0xfe, 0x09, 0xff, 0xa9, 0xfe, 0xa9, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0xe6, 0xfd, 0x01, 0xfd, 0x81, 0xfc, 0x21, 0xe4, 0xe4, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xdc, 0x81, 0xfc, 0x81, 0xfc, 0x01, 0xfd, 0xc5, 0xfd, 0x07, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x87, 0xfe, 0xa9, 0xfe, 0xe6, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0xa3, 0xab, 0x80, 0x69, 0x61, 0x8a, 0x61, 0x8a, 0x61, 0x8a, 0x80, 0x69, 0xe1, 0x9a, 0x09, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x47, 0xe6, 0x00, 0x7a, 0xc0, 0x71, 0x61, 0x8a, 0x61, 0x8a, 0x00, 0x7a, 0x80, 0x69, 0x25, 0xcd, 0x67, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0x09, 0xff, 0xa9, 0xfe, 0xa9, 0xfe, 0x87, 0xfe, 0xa9, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x07, 0xfe, 0xe6, 0xfd, 0x43, 0xfd, 0x81, 0xfc, 0x81, 0xfc, 0x04, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xcb, 0x81, 0xfc, 0x81, 0xfc, 0x43, 0xfd, 0xc5, 0xfd, 0x07, 0xfe, 0x46, 0xfe, 0x47, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0xe6, 0xfe, 0x09, 0xff, 0xe6, 0xfe, 0x09, 0xff, 0x09, 0xff, 0x67, 0xff, 0x67, 0xff, 0xe6, 0xfe, 0x61, 0x8a, 0x00, 0x7a, 0xe1, 0x9a, 0x21, 0xa3, 0xe1, 0x9a, 0x61, 0x8a, 0x00, 0x7a, 0x47, 0xe6, 0x8a, 0xff, 0x67, 0xff, 0x67, 0xff, 0x8a, 0xff, 0x67, 0xff, 0x67, 0xff, 0x8a, 0xff, 0x67, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x25, 0xcd, 0xc0, 0x71, 0x61, 0x8a, 0x21, 0xa3, 0x21, 0xa3, 0xe1, 0x9a, 0xc0, 0x71, 0xa3, 0xab, 0x09, 0xff, 0x67, 0xff, 0x09, 0xff, 0x09, 0xff, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xa9, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x47, 0xfe, 0x46, 0xfe, 0x07, 0xfe, 0xe6, 0xfd, 0x43, 0xfd, 0x81, 0xfc, 0x81, 0xfc, 0x82, 0xcb, 0x25, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xcc, 0x61, 0xcb, 0x81, 0xfc, 0x01, 0xfd, 0x43, 0xfd, 0xc5, 0xfd, 0xe6, 0xfd, 0x46, 0xfe, 0x46, 0xfe, 0x47, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0x67, 0xff, 0x47, 0xe6, 0x61, 0x8a, 0x61, 0x8a, 0x21, 0xa3, 0x21, 0xa3, 0x21, 0xa3, 0xe1, 0x9a, 0x00, 0x7a, 0x47, 0xe6, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x25, 0xcd, 0x00, 0x7a, 0xe1, 0x9a, 0x21, 0xa3, 0x21, 0xa3, 0x21, 0xa3, 0x00, 0x7a, 0xe1, 0x9a, 0x06, 0xff, 0x67, 0xff, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xa9, 0xfe, 0xe6, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x47, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0xe6, 0xfd, 0xc5, 0xfd, 0x43, 0xfd, 0x01, 0xfd, 0x81, 0xfc, 0x61, 0xcb, 0x25, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xcb, 0xc0, 0xdb, 0x81, 0xfc, 0x01, 0xfd, 0x43, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0x25, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0x67, 0xff, 0xe6, 0xfe, 0x61, 0x8a, 0x61, 0x8a, 0x21, 0xa3, 0x21, 0xa3, 0x21, 0xa3, 0xe1, 0x9a, 0x61, 0x8a, 0x47, 0xe6, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x25, 0xcd, 0x00, 0x7a, 0xe1, 0x9a, 0x21, 0xa3, 0x21, 0xa3, 0x21, 0xa3, 0x61, 0x8a, 0x21, 0xa3, 0x06, 0xff, 0x06, 0xff, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x25, 0xfe, 0xc5, 0xfd, 0xc5, 0xfd, 0x43, 0xfd, 0x01, 0xfd, 0x81, 0xfc, 0xc0, 0xdb, 0xe4, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xcb, 0xc0, 0xdb, 0xa2, 0xec, 0xe2, 0xf4, 0x43, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xe6, 0xfd, 0x25, 0xfe, 0x25, 0xfe, 0x46, 0xfe, 0x66, 0xfe, 0x87, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0x67, 0xff, 0xa3, 0xab, 0x61, 0x8a, 0x21, 0xa3, 0x21, 0xa3, 0x21, 0xa3, 0x61, 0x8a, 0x21, 0xa3, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x67, 0xff, 0x47, 0xe6, 0x61, 0x8a, 0xe1, 0x9a, 0x21, 0xa3, 0x21, 0xa3, 0x21, 0xa3, 0x00, 0x7a, 0x64, 0xc4, 0x67, 0xff, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x46, 0xfe, 0x25, 0xfe, 0xe6, 0xfd, 0xc5, 0xfd, 0xa4, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0xa2, 0xec, 0x21, 0xe4, 0xc4, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xd3, 0x21, 0xe4, 0xa2, 0xec, 0xe2, 0xf4, 0x43, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0x25, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0x46, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0x06, 0xff, 0x47, 0xe6, 0x61, 0x8a, 0x61, 0x8a, 0xe1, 0x9a, 0x61, 0x8a, 0x61, 0x8a, 0x47, 0xe6, 0x67, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x67, 0xff, 0x67, 0xff, 0x25, 0xcd, 0x61, 0x8a, 0xe1, 0x9a, 0xe1, 0x9a, 0x61, 0x8a, 0x21, 0xa3, 0xe6, 0xfe, 0x06, 0xff, 0xe6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0xc5, 0xfd, 0xc5, 0xfd, 0xa4, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0xa2, 0xec, 0x21, 0xe4, 0x04, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xcb, 0x21, 0xe4, 0xa2, 0xec, 0xe2, 0xf4, 0x43, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0x25, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0xa6, 0xfe, 0x66, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0x67, 0xff, 0x47, 0xe6, 0xa3, 0xab, 0x21, 0xa3, 0xa3, 0xab, 0x47, 0xe6, 0x67, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x67, 0xff, 0x67, 0xff, 0x25, 0xcd, 0x21, 0xa3, 0x21, 0xa3, 0x64, 0xc4, 0x47, 0xe6, 0x06, 0xff, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0xc5, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0xe2, 0xf4, 0xa2, 0xec, 0x21, 0xe4, 0x82, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xcb, 0x21, 0xe4, 0x61, 0xe4, 0xe2, 0xf4, 0x43, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0x25, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0x67, 0xff, 0x67, 0xff, 0x09, 0xff, 0x67, 0xff, 0x67, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x67, 0xff, 0x09, 0xff, 0xe6, 0xfe, 0x67, 0xff, 0x06, 0xff, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0xc5, 0xfd, 0xc5, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0xe2, 0xf4, 0xa2, 0xec, 0x21, 0xe4, 0x82, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xcb, 0x21, 0xe4, 0x61, 0xe4, 0xe2, 0xf4, 0x03, 0xf5, 0x83, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0x25, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0x06, 0xff, 0x06, 0xff, 0xe6, 0xfe, 0xe6, 0xfe, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0xe6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0xc5, 0xfd, 0xc5, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0xe2, 0xf4, 0x61, 0xe4, 0x21, 0xe4, 0x82, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xcb, 0xc0, 0xdb, 0x61, 0xe4, 0xe2, 0xf4, 0x03, 0xf5, 0x83, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0x25, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0x66, 0xfe, 0x25, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0x06, 0xff, 0xa6, 0xfe, 0x06, 0xff, 0xe6, 0xfe, 0xe6, 0xfe, 0x06, 0xff, 0xe6, 0xfe, 0x06, 0xff, 0xe6, 0xfe, 0x06, 0xff, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0x06, 0xff, 0xa6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0xc5, 0xfd, 0xe6, 0xfd, 0xc5, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0x03, 0xf5, 0xe2, 0xf4, 0x61, 0xe4, 0x21, 0xe4, 0x82, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xcb, 0xc0, 0xdb, 0x61, 0xe4, 0xe2, 0xf4, 0x03, 0xf5, 0x43, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xe6, 0xfd, 0x25, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0x06, 0xff, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0x06, 0xff, 0xe6, 0xfe, 0x06, 0xff, 0xa6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0x66, 0xfe, 0xa6, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x25, 0xfe, 0x66, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0xe6, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x03, 0xf5, 0xe2, 0xf4, 0x61, 0xe4, 0xc0, 0xdb, 0x82, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xdc, 0xc0, 0xdb, 0x61, 0xe4, 0xa2, 0xec, 0x03, 0xf5, 0x43, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0x25, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0xa6, 0xfe, 0x66, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0x06, 0xff, 0xa6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0x66, 0xfe, 0xa6, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0xe6, 0xfd, 0xe6, 0xfd, 0xc5, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0xe2, 0xf4, 0x61, 0xe4, 0xc0, 0xdb, 0x82, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xd3, 0xc0, 0xdb, 0x21, 0xe4, 0xa2, 0xec, 0xe2, 0xf4, 0x43, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0x07, 0xfe, 0x25, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x46, 0xfe, 0x25, 0xfe, 0x25, 0xfe, 0xe6, 0xfd, 0xe6, 0xfd, 0xc5, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0xa2, 0xec, 0x61, 0xe4, 0xc0, 0xdb, 0x04, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xd3, 0x60, 0xcb, 0x21, 0xe4, 0xa2, 0xec, 0xe2, 0xf4, 0x03, 0xf5, 0x83, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0x25, 0xfe, 0x07, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0xe6, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x03, 0xf5, 0xe2, 0xf4, 0xa2, 0xec, 0x21, 0xe4, 0xc0, 0xdb, 0xc4, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xcb, 0x41, 0xcb, 0x21, 0xe4, 0x61, 0xe4, 0xe2, 0xf4, 0x03, 0xf5, 0x43, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0x46, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x66, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x66, 0xfe, 0x87, 0xfe, 0x46, 0xfe, 0x87, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x07, 0xfe, 0xe6, 0xfd, 0xe6, 0xfd, 0xc5, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0xe2, 0xf4, 0x61, 0xe4, 0x21, 0xe4, 0x60, 0xcb, 0xe4, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xcc, 0x61, 0xcb, 0xc0, 0xdb, 0x61, 0xe4, 0xa2, 0xec, 0x03, 0xf5, 0x43, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xe6, 0xfd, 0x07, 0xfe, 0x07, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x66, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0xa6, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0xa6, 0xfe, 0x87, 0xfe, 0xa6, 0xfe, 0x87, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x46, 0xfe, 0x87, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x07, 0xfe, 0xe6, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0xa2, 0xec, 0x61, 0xe4, 0x21, 0xe4, 0x61, 0xcb, 0x25, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xcb, 0xc0, 0xdb, 0x21, 0xe4, 0xa2, 0xec, 0xe2, 0xf4, 0x03, 0xf5, 0x43, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0x07, 0xfe, 0x07, 0xfe, 0x46, 0xfe, 0x47, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x87, 0xfe, 0x47, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0xe6, 0xfe, 0x46, 0xfe, 0x25, 0xcd, 0x64, 0xc4, 0xa2, 0xec, 0x43, 0xfd, 0xe6, 0xfd, 0x46, 0xfe, 0x46, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x46, 0xfe, 0x87, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x07, 0xfe, 0x46, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0xe6, 0xfd, 0xe6, 0xfd, 0xc5, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0xe2, 0xf4, 0xa2, 0xec, 0x21, 0xe4, 0xc0, 0xdb, 0x82, 0xcb, 0x25, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xdc, 0xc0, 0xdb, 0x21, 0xe4, 0x61, 0xe4, 0xe2, 0xf4, 0x03, 0xf5, 0x43, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x47, 0xfe, 0xa3, 0xab, 0xc0, 0x71, 0x80, 0x69, 0x00, 0x7a, 0xe1, 0x9a, 0x64, 0xc4, 0x03, 0xf5, 0xe6, 0xfd, 0x46, 0xfe, 0x46, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x87, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x46, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0xe6, 0xfd, 0xe6, 0xfd, 0xc5, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0xe2, 0xf4, 0x61, 0xe4, 0x21, 0xe4, 0xc0, 0xdb, 0x04, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xcb, 0x41, 0xcb, 0xc0, 0xdb, 0x61, 0xe4, 0xa2, 0xec, 0xe2, 0xf4, 0x03, 0xf5, 0x43, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0x07, 0xfe, 0x46, 0xfe, 0x07, 0xfe, 0x47, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x87, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x87, 0xfe, 0x47, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0xa9, 0xfe, 0x47, 0xe6, 0x25, 0xcd, 0x21, 0xa3, 0xc0, 0x71, 0x40, 0x61, 0x00, 0x7a, 0x60, 0xcb, 0xa4, 0xfd, 0x46, 0xfe, 0x46, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x46, 0xfe, 0x47, 0xfe, 0x46, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0xe6, 0xfd, 0xe6, 0xfd, 0xc5, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0x03, 0xf5, 0xa2, 0xec, 0x61, 0xe4, 0xc0, 0xdb, 0x60, 0xcb, 0xe4, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xcc, 0x61, 0xcb, 0xc0, 0xdb, 0x21, 0xe4, 0x61, 0xe4, 0xe2, 0xf4, 0x03, 0xf5, 0x43, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xe6, 0xfd, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x87, 0xfe, 0x47, 0xfe, 0x87, 0xfe, 0x47, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0xa9, 0xfe, 0x09, 0xff, 0x09, 0xff, 0x47, 0xe6, 0xa3, 0xab, 0x80, 0x69, 0x40, 0x61, 0xe1, 0x9a, 0xa4, 0xfd, 0x07, 0xfe, 0x07, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0xe6, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0xe2, 0xf4, 0xa2, 0xec, 0x21, 0xe4, 0xc0, 0xdb, 0x61, 0xcb, 0x25, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xcb, 0x60, 0xcb, 0xc0, 0xdb, 0x61, 0xe4, 0xa2, 0xec, 0xe2, 0xf4, 0x03, 0xf5, 0x43, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xe6, 0xfd, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x87, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x87, 0xfe, 0x09, 0xff, 0x07, 0xfe, 0x61, 0x8a, 0x80, 0x69, 0xc0, 0x71, 0xa2, 0xec, 0xe6, 0xfd, 0xe6, 0xfd, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0xe6, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0xe2, 0xf4, 0xa2, 0xec, 0x61, 0xe4, 0xc0, 0xdb, 0xc0, 0xdb, 0x82, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xcb, 0x41, 0xcb, 0xc0, 0xdb, 0x21, 0xe4, 0x61, 0xe4, 0xe2, 0xf4, 0x03, 0xf5, 0x43, 0xfd, 0x43, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xe6, 0xfd, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x87, 0xfe, 0x47, 0xfe, 0x07, 0xfe, 0x64, 0xc4, 0x00, 0x7a, 0xc0, 0x71, 0xe1, 0x9a, 0x43, 0xfd, 0xc5, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0xe6, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0xe2, 0xf4, 0xa2, 0xec, 0x21, 0xe4, 0xc0, 0xdb, 0x41, 0xcb, 0xe4, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xcb, 0xc0, 0xdb, 0xc0, 0xdb, 0x21, 0xe4, 0xa2, 0xec, 0xe2, 0xf4, 0x03, 0xf5, 0x43, 0xfd, 0x43, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x07, 0xfe, 0x03, 0xf5, 0xa3, 0xab, 0xc0, 0x71, 0x00, 0x7a, 0xa3, 0xab, 0x03, 0xf5, 0x43, 0xfd, 0x43, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0x07, 0xfe, 0xe6, 0xfd, 0xe6, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0xe2, 0xf4, 0xa2, 0xec, 0x61, 0xe4, 0xc0, 0xdb, 0xc0, 0xdb, 0x82, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xcb, 0x41, 0xcb, 0xc0, 0xdb, 0x21, 0xe4, 0x61, 0xe4, 0xa2, 0xec, 0xe2, 0xf4, 0x03, 0xf5, 0x43, 0xfd, 0x43, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x47, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x47, 0xfe, 0x07, 0xfe, 0x47, 0xfe, 0x47, 0xfe, 0x07, 0xfe, 0x03, 0xf5, 0xa3, 0xab, 0x00, 0x7a, 0x80, 0x69, 0x61, 0x8a, 0x64, 0xc4, 0x43, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0x43, 0xfd, 0xc5, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0xe2, 0xf4, 0xe2, 0xf4, 0x61, 0xe4, 0x21, 0xe4, 0xc0, 0xdb, 0x60, 0xcb, 0xe4, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xcb, 0xc0, 0xdb, 0xc0, 0xdb, 0x21, 0xe4, 0x61, 0xe4, 0xe2, 0xf4, 0x03, 0xf5, 0x03, 0xf5, 0x43, 0xfd, 0x43, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x47, 0xfe, 0x07, 0xfe, 0xe1, 0x9a, 0x40, 0x61, 0x40, 0x61, 0xa3, 0xab, 0xa4, 0xfd, 0x43, 0xfd, 0x81, 0xfc, 0x81, 0xfc, 0x03, 0xf5, 0x43, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0x03, 0xf5, 0xe2, 0xf4, 0xa2, 0xec, 0x21, 0xe4, 0xc0, 0xdb, 0xc0, 0xdb, 0x82, 0xcb, 0x25, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xcb, 0x41, 0xcb, 0xc0, 0xdb, 0xc0, 0xdb, 0x61, 0xe4, 0xa2, 0xec, 0xe2, 0xf4, 0x03, 0xf5, 0x03, 0xf5, 0x43, 0xfd, 0x43, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x47, 0xfe, 0xa3, 0xab, 0x80, 0x69, 0xc0, 0x71, 0xa3, 0xab, 0xa2, 0xec, 0x81, 0xfc, 0x81, 0xfc, 0x03, 0xf5, 0x03, 0xf5, 0x43, 0xfd, 0x43, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0x03, 0xf5, 0xe2, 0xf4, 0xa2, 0xec, 0x61, 0xe4, 0x21, 0xe4, 0xc0, 0xdb, 0x41, 0xcb, 0xe4, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xcb, 0x60, 0xcb, 0xc0, 0xdb, 0x21, 0xe4, 0x61, 0xe4, 0xa2, 0xec, 0xe2, 0xf4, 0x03, 0xf5, 0x03, 0xf5, 0x43, 0xfd, 0x43, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0x07, 0xfe, 0xa9, 0xfe, 0x25, 0xcd, 0x21, 0xa3, 0xc0, 0x71, 0x00, 0x7a, 0x21, 0xa3, 0xc0, 0xdb, 0x81, 0xfc, 0x03, 0xf5, 0x43, 0xfd, 0x43, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0x03, 0xf5, 0xe2, 0xf4, 0xa2, 0xec, 0x61, 0xe4, 0x21, 0xe4, 0xc0, 0xdb, 0x60, 0xcb, 0x82, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xcc, 0x61, 0xcb, 0x60, 0xcb, 0xc0, 0xdb, 0x21, 0xe4, 0x61, 0xe4, 0xa2, 0xec, 0xe2, 0xf4, 0x03, 0xf5, 0x03, 0xf5, 0x43, 0xfd, 0x43, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0xe6, 0xfd, 0xa9, 0xfe, 0xa9, 0xfe, 0x64, 0xc4, 0xc0, 0x71, 0x40, 0x61, 0x00, 0x7a, 0x60, 0xcb, 0x03, 0xf5, 0x43, 0xfd, 0x43, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0x03, 0xf5, 0xe2, 0xf4, 0xa2, 0xec, 0x61, 0xe4, 0x21, 0xe4, 0xc0, 0xdb, 0xc0, 0xdb, 0x61, 0xcb, 0x25, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xcb, 0x41, 0xcb, 0xc0, 0xdb, 0xc0, 0xdb, 0x21, 0xe4, 0x61, 0xe4, 0xa2, 0xec, 0xe2, 0xf4, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x43, 0xfd, 0x43, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0x87, 0xfe, 0x25, 0xcd, 0x00, 0x7a, 0x80, 0x69, 0xc0, 0x71, 0x61, 0xe4, 0x43, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0x03, 0xf5, 0xe2, 0xf4, 0xa2, 0xec, 0x61, 0xe4, 0x21, 0xe4, 0xc0, 0xdb, 0xc0, 0xdb, 0x41, 0xcb, 0xe4, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xd3, 0x60, 0xcb, 0xc0, 0xdb, 0xc0, 0xdb, 0x21, 0xe4, 0x61, 0xe4, 0xa2, 0xec, 0xe2, 0xf4, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x43, 0xfd, 0x43, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0xc5, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0xa2, 0xec, 0x61, 0x8a, 0xc0, 0x71, 0x00, 0x7a, 0xa2, 0xec, 0x43, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0xe2, 0xf4, 0xa2, 0xec, 0x61, 0xe4, 0x21, 0xe4, 0xc0, 0xdb, 0xc0, 0xdb, 0x60, 0xcb, 0x04, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xcb, 0x60, 0xcb, 0xc0, 0xdb, 0xc0, 0xdb, 0x21, 0xe4, 0x61, 0xe4, 0xa2, 0xec, 0xe2, 0xf4, 0xe2, 0xf4, 0x03, 0xf5, 0x03, 0xf5, 0x43, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0xa2, 0xec, 0x60, 0xcb, 0x00, 0x7a, 0xc0, 0x71, 0x61, 0x8a, 0x64, 0xc4, 0x43, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0x03, 0xf5, 0xe2, 0xf4, 0xe2, 0xf4, 0xa2, 0xec, 0x61, 0xe4, 0x21, 0xe4, 0x21, 0xe4, 0xc0, 0xdb, 0x60, 0xcb, 0x82, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xcc, 0x82, 0xcb, 0x60, 0xcb, 0xc0, 0xdb, 0xc0, 0xdb, 0x21, 0xe4, 0x61, 0xe4, 0xa2, 0xec, 0xa2, 0xec, 0xe2, 0xf4, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x43, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x83, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0x61, 0xe4, 0x21, 0xa3, 0x61, 0x8a, 0xc0, 0x71, 0xc0, 0x71, 0xe1, 0x9a, 0x64, 0xc4, 0x43, 0xfd, 0xa4, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0xe2, 0xf4, 0xa2, 0xec, 0xa2, 0xec, 0x61, 0xe4, 0x21, 0xe4, 0x21, 0xe4, 0xc0, 0xdb, 0x60, 0xcb, 0x82, 0xcb, 0x25, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xcc, 0x82, 0xcb, 0x60, 0xcb, 0xc0, 0xdb, 0xc0, 0xdb, 0x21, 0xe4, 0x61, 0xe4, 0x61, 0xe4, 0xa2, 0xec, 0xe2, 0xf4, 0xe2, 0xf4, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x43, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x83, 0xfd, 0x43, 0xfd, 0x64, 0xc4, 0xe1, 0x9a, 0x21, 0xa3, 0x64, 0xc4, 0x03, 0xf5, 0xa4, 0xfd, 0xa4, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0xe2, 0xf4, 0xe2, 0xf4, 0xa2, 0xec, 0xa2, 0xec, 0x61, 0xe4, 0x21, 0xe4, 0xc0, 0xdb, 0xc0, 0xdb, 0x60, 0xcb, 0x82, 0xcb, 0x25, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xcc, 0x82, 0xcb, 0x60, 0xcb, 0xc0, 0xdb, 0xc0, 0xdb, 0x21, 0xe4, 0x21, 0xe4, 0x61, 0xe4, 0xa2, 0xec, 0xa2, 0xec, 0xe2, 0xf4, 0xe2, 0xf4, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x43, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0xc5, 0xfd, 0xc5, 0xfd, 0xa4, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0xe2, 0xf4, 0xe2, 0xf4, 0xa2, 0xec, 0xa2, 0xec, 0x61, 0xe4, 0x21, 0xe4, 0x21, 0xe4, 0xc0, 0xdb, 0xc0, 0xdb, 0x60, 0xcb, 0x82, 0xcb, 0x25, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xd3, 0x41, 0xcb, 0x60, 0xcb, 0xc0, 0xdb, 0x21, 0xe4, 0x21, 0xe4, 0x61, 0xe4, 0x61, 0xe4, 0xa2, 0xec, 0xa2, 0xec, 0xe2, 0xf4, 0xe2, 0xf4, 0xe2, 0xf4, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x43, 0xfd, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0xe2, 0xf4, 0xe2, 0xf4, 0xa2, 0xec, 0xa2, 0xec, 0x61, 0xe4, 0x61, 0xe4, 0x21, 0xe4, 0x21, 0xe4, 0xc0, 0xdb, 0x60, 0xcb, 0x41, 0xcb, 0xc4, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xcb, 0x61, 0xcb, 0x60, 0xcb, 0xc0, 0xdb, 0xc0, 0xdb, 0x21, 0xe4, 0x21, 0xe4, 0x61, 0xe4, 0x61, 0xe4, 0xa2, 0xec, 0xa2, 0xec, 0xe2, 0xf4, 0xe2, 0xf4, 0xe2, 0xf4, 0xe2, 0xf4, 0xe2, 0xf4, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0x03, 0xf5, 0xe2, 0xf4, 0x03, 0xf5, 0x03, 0xf5, 0xe2, 0xf4, 0xe2, 0xf4, 0xe2, 0xf4, 0xe2, 0xf4, 0xa2, 0xec, 0xa2, 0xec, 0xa2, 0xec, 0x61, 0xe4, 0x61, 0xe4, 0x21, 0xe4, 0x21, 0xe4, 0xc0, 0xdb, 0xc0, 0xdb, 0x60, 0xcb, 0x61, 0xcb, 0xe4, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xcc, 0x82, 0xcb, 0x41, 0xcb, 0x60, 0xcb, 0xc0, 0xdb, 0xc0, 0xdb, 0x21, 0xe4, 0x21, 0xe4, 0x61, 0xe4, 0x61, 0xe4, 0xa2, 0xec, 0xa2, 0xec, 0xa2, 0xec, 0xa2, 0xec, 0xe2, 0xf4, 0xe2, 0xf4, 0xa2, 0xec, 0xe2, 0xf4, 0xe2, 0xf4, 0xe2, 0xf4, 0xe2, 0xf4, 0xe2, 0xf4, 0xe2, 0xf4, 0xa2, 0xec, 0xe2, 0xf4, 0xa2, 0xec, 0xa2, 0xec, 0xa2, 0xec, 0x61, 0xe4, 0x61, 0xe4, 0x21, 0xe4, 0x21, 0xe4, 0xc0, 0xdb, 0xc0, 0xdb, 0x60, 0xcb, 0x41, 0xcb, 0x82, 0xcb, 0x25, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xcb, 0x82, 0xcb, 0x41, 0xcb, 0x60, 0xcb, 0xc0, 0xdb, 0xc0, 0xdb, 0x21, 0xe4, 0x21, 0xe4, 0x21, 0xe4, 0x61, 0xe4, 0x61, 0xe4, 0x61, 0xe4, 0xa2, 0xec, 0x61, 0xe4, 0xa2, 0xec, 0xa2, 0xec, 0xa2, 0xec, 0xa2, 0xec, 0xa2, 0xec, 0xa2, 0xec, 0xa2, 0xec, 0x61, 0xe4, 0x61, 0xe4, 0x61, 0xe4, 0x61, 0xe4, 0x61, 0xe4, 0x21, 0xe4, 0x21, 0xe4, 0xc0, 0xdb, 0xc0, 0xdb, 0x60, 0xcb, 0x41, 0xcb, 0x82, 0xcb, 0xe4, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xcc, 0xe4, 0xcb, 0x82, 0xcb, 0x41, 0xcb, 0x60, 0xcb, 0xc0, 0xdb, 0xc0, 0xdb, 0xc0, 0xdb, 0x21, 0xe4, 0x21, 0xe4, 0x21, 0xe4, 0x21, 0xe4, 0x61, 0xe4, 0x21, 0xe4, 0x61, 0xe4, 0x61, 0xe4, 0x61, 0xe4, 0x21, 0xe4, 0x61, 0xe4, 0x21, 0xe4, 0x61, 0xe4, 0x21, 0xe4, 0x21, 0xe4, 0x21, 0xe4, 0xc0, 0xdb, 0xc0, 0xdb, 0xc0, 0xdb, 0x60, 0xcb, 0x41, 0xcb, 0x82, 0xcb, 0xc4, 0xd3, 0x25, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xcb, 0x82, 0xcb, 0x61, 0xcb, 0x41, 0xcb, 0x60, 0xcb, 0x60, 0xcb, 0xc0, 0xdb, 0xc0, 0xdb, 0xc0, 0xdb, 0xc0, 0xdb, 0xc0, 0xdb, 0x21, 0xe4, 0xc0, 0xdb, 0x21, 0xe4, 0xc0, 0xdb, 0x21, 0xe4, 0xc0, 0xdb, 0xc0, 0xdb, 0xc0, 0xdb, 0xc0, 0xdb, 0x60, 0xcb, 0x60, 0xcb, 0x41, 0xcb, 0x61, 0xcb, 0x82, 0xcb, 0xe4, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xcc, 0xe4, 0xcb, 0x04, 0xdc, 0x82, 0xcb, 0x61, 0xcb, 0x41, 0xcb, 0x60, 0xcb, 0x60, 0xcb, 0x60, 0xcb, 0x60, 0xcb, 0x60, 0xcb, 0x60, 0xcb, 0x60, 0xcb, 0x60, 0xcb, 0x60, 0xcb, 0x60, 0xcb, 0x41, 0xcb, 0x61, 0xcb, 0x82, 0xcb, 0x04, 0xdc, 0xe4, 0xcb, 0x25, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xcc, 0x25, 0xcc, 0xe4, 0xcb, 0xc4, 0xd3, 0x04, 0xdc, 0x82, 0xcb, 0x82, 0xcb, 0x82, 0xcb, 0x82, 0xcb, 0x82, 0xcb, 0x82, 0xcb, 0x04, 0xdc, 0xc4, 0xd3, 0xe4, 0xcb, 0x25, 0xcc, 0x25, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+#endif
+#if LV_COLOR_DEPTH == 32 || LV_COLOR_DEPTH == 24 /*TODO it's incorrect for 24 bit*/
+    /*Pixel format: Fix 0xFF: 8 bit, Red: 8 bit, Green: 8 bit, Blue: 8 bit*/
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x28, 0x86, 0xc9, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x1e, 0x79, 0xce, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x22, 0x8f, 0xe6, 0xff, 0x22, 0x8f, 0xe6, 0xff, 0x22, 0x8f, 0xe6, 0xff, 0x22, 0x8f, 0xe6, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x1e, 0x79, 0xce, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x22, 0x8f, 0xe6, 0xff, 0x18, 0x8f, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x18, 0x8f, 0xed, 0xff, 0x22, 0x8f, 0xe6, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x18, 0x8f, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x18, 0x8f, 0xed, 0xff, 0x22, 0x8f, 0xe6, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x22, 0x8f, 0xe6, 0xff, 0x0e, 0x8a, 0xf1, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x22, 0x8f, 0xe6, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x22, 0x8f, 0xe6, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x05, 0xae, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x05, 0xae, 0xff, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x22, 0x8f, 0xe6, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x0e, 0x8a, 0xf1, 0xff, 0x05, 0xae, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x05, 0xae, 0xff, 0xff, 0x0e, 0x8a, 0xf1, 0xff, 0x22, 0x8f, 0xe6, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x18, 0x8f, 0xed, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x05, 0xae, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xe7, 0xfe, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x05, 0xae, 0xff, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x18, 0x8f, 0xed, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1e, 0x79, 0xce, 0xff, 0x0e, 0x8a, 0xf1, 0xff, 0x05, 0xae, 0xff, 0xff, 0x05, 0xae, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x0a, 0xd3, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x05, 0xae, 0xff, 0xff, 0x05, 0xae, 0xff, 0xff, 0x0e, 0x8a, 0xf1, 0xff, 0x1e, 0x79, 0xce, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x05, 0xae, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x05, 0xae, 0xff, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x22, 0x8f, 0xe6, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x14, 0x70, 0xc5, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x05, 0xae, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xd4, 0xfd, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x05, 0xae, 0xff, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x22, 0x8f, 0xe6, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x05, 0xae, 0xff, 0xff, 0x05, 0xae, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x05, 0xae, 0xff, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x22, 0x8f, 0xe6, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x05, 0xae, 0xff, 0xff, 0x05, 0xae, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xc1, 0xfc, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x05, 0xae, 0xff, 0xff, 0x05, 0xae, 0xff, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x22, 0x8f, 0xe6, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1e, 0x79, 0xce, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x05, 0xae, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x05, 0xae, 0xff, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x1e, 0x79, 0xce, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x0e, 0x8a, 0xf1, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x05, 0xae, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x05, 0xae, 0xff, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x0e, 0x8a, 0xf1, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x18, 0x8f, 0xed, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x05, 0xae, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x82, 0xec, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x05, 0xae, 0xff, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x18, 0x8f, 0xed, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x05, 0xae, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x9c, 0xf9, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x05, 0xae, 0xff, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x22, 0x8f, 0xe6, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x0e, 0x8a, 0xf1, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x05, 0xae, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x82, 0xec, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x05, 0xae, 0xff, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x0e, 0x8a, 0xf1, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x8f, 0xe6, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x05, 0xae, 0xff, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x8a, 0xf8, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x13, 0x71, 0xcc, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x0e, 0x8a, 0xf1, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x05, 0xae, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x05, 0xae, 0xff, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x13, 0x6f, 0xc7, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x05, 0xae, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x13, 0x71, 0xcc, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x0e, 0x8a, 0xf1, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x6d, 0xe7, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x05, 0xae, 0xff, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x0e, 0x8a, 0xf1, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x05, 0xae, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x22, 0x8f, 0xe6, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x18, 0x8f, 0xed, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x36, 0xc8, 0xe0, 0xff, 0x1a, 0x74, 0xaa, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x36, 0xc8, 0xe0, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x62, 0xf5, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x2a, 0xa5, 0xca, 0xff, 0x0a, 0x5b, 0x96, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x1f, 0x8c, 0xc3, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x5a, 0xe1, 0xff, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x18, 0x8f, 0xed, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x0e, 0x8a, 0xf1, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x36, 0xc8, 0xe0, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x00, 0x27, 0x5d, 0xff, 0x01, 0x2f, 0x66, 0xff, 0x00, 0x27, 0x5d, 0xff, 0x03, 0x38, 0x70, 0xff, 0x36, 0xc8, 0xe0, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x1f, 0x8c, 0xc3, 0xff, 0x01, 0x2f, 0x66, 0xff, 0x00, 0x27, 0x5d, 0xff, 0x01, 0x2f, 0x66, 0xff, 0x00, 0x27, 0x5d, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x1a, 0x74, 0xaa, 0xff, 0x01, 0x2f, 0x66, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x01, 0x2f, 0x66, 0xff, 0x0a, 0x5b, 0x96, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x36, 0xc8, 0xe0, 0xff, 0x03, 0x41, 0x7c, 0xff, 0x03, 0x38, 0x70, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x03, 0x41, 0x7c, 0xff, 0x01, 0x2f, 0x66, 0xff, 0x2a, 0xa5, 0xca, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x13, 0x6f, 0xc7, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x28, 0xba, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x03, 0x41, 0x7c, 0xff, 0x0a, 0x5b, 0x96, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x0a, 0x5b, 0x96, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x03, 0x41, 0x7c, 0xff, 0x36, 0xc8, 0xe0, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x4f, 0xf1, 0xff, 0xff, 0x2a, 0xa5, 0xca, 0xff, 0x03, 0x38, 0x70, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x0a, 0x5b, 0x96, 0xff, 0x03, 0x38, 0x70, 0xff, 0x1a, 0x74, 0xaa, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x13, 0x71, 0xcc, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x0b, 0x6c, 0xca, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x28, 0xba, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x36, 0xc8, 0xe0, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x0a, 0x5b, 0x96, 0xff, 0x03, 0x41, 0x7c, 0xff, 0x36, 0xc8, 0xe0, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x2a, 0xa5, 0xca, 0xff, 0x03, 0x41, 0x7c, 0xff, 0x0a, 0x5b, 0x96, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x03, 0x41, 0x7c, 0xff, 0x0a, 0x5b, 0x96, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x0b, 0x6c, 0xca, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x0a, 0x5b, 0x96, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x36, 0xc8, 0xe0, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x2a, 0xa5, 0xca, 0xff, 0x03, 0x41, 0x7c, 0xff, 0x0a, 0x5b, 0x96, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x05, 0x9f, 0xfe, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x1a, 0x74, 0xaa, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x36, 0xc8, 0xe0, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x0a, 0x5b, 0x96, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x03, 0x41, 0x7c, 0xff, 0x1f, 0x8c, 0xc3, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x1e, 0x79, 0xce, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1e, 0x79, 0xce, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x36, 0xc8, 0xe0, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x0a, 0x5b, 0x96, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x36, 0xc8, 0xe0, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x2a, 0xa5, 0xca, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x0a, 0x5b, 0x96, 0xff, 0x0a, 0x5b, 0x96, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x14, 0x70, 0xc5, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x36, 0xc8, 0xe0, 0xff, 0x1a, 0x74, 0xaa, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x1a, 0x74, 0xaa, 0xff, 0x36, 0xc8, 0xe0, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x2a, 0xa5, 0xca, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x1f, 0x8c, 0xc3, 0xff, 0x36, 0xc8, 0xe0, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x14, 0x70, 0xc5, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x14, 0x70, 0xc5, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x3c, 0xec, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x13, 0x6f, 0xc7, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x14, 0x70, 0xc5, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x13, 0x6f, 0xc7, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x14, 0x70, 0xc5, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x13, 0x6f, 0xc7, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x14, 0x70, 0xc5, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x13, 0x6f, 0xc7, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x31, 0xe1, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x14, 0x70, 0xc5, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1e, 0x79, 0xce, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1e, 0x79, 0xce, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x2a, 0xc6, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x1e, 0x79, 0xce, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x07, 0x67, 0xc6, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x0b, 0x6c, 0xca, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x2d, 0xce, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x30, 0xd6, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0b, 0x6c, 0xca, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x13, 0x6f, 0xc7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x34, 0xdb, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x2a, 0xa5, 0xca, 0xff, 0x1f, 0x8c, 0xc3, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x13, 0x71, 0xcc, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x1a, 0x74, 0xaa, 0xff, 0x03, 0x38, 0x70, 0xff, 0x01, 0x2f, 0x66, 0xff, 0x03, 0x41, 0x7c, 0xff, 0x0a, 0x5b, 0x96, 0xff, 0x1f, 0x8c, 0xc3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x07, 0x67, 0xc6, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x36, 0xc8, 0xe0, 0xff, 0x2a, 0xa5, 0xca, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x03, 0x38, 0x70, 0xff, 0x00, 0x27, 0x5d, 0xff, 0x03, 0x41, 0x7c, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x32, 0xc8, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x0b, 0x6c, 0xca, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x36, 0xc8, 0xe0, 0xff, 0x1a, 0x74, 0xaa, 0xff, 0x01, 0x2f, 0x66, 0xff, 0x00, 0x27, 0x5d, 0xff, 0x0a, 0x5b, 0x96, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x0b, 0x6c, 0xca, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x14, 0x70, 0xc5, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x46, 0xe2, 0xfe, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x01, 0x2f, 0x66, 0xff, 0x03, 0x38, 0x70, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x13, 0x6f, 0xc7, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x07, 0x67, 0xc6, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x1f, 0x8c, 0xc3, 0xff, 0x03, 0x41, 0x7c, 0xff, 0x03, 0x38, 0x70, 0xff, 0x0a, 0x5b, 0x96, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x28, 0xba, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x67, 0xc6, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x13, 0x6f, 0xc7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x1a, 0x74, 0xaa, 0xff, 0x03, 0x38, 0x70, 0xff, 0x03, 0x41, 0x7c, 0xff, 0x1a, 0x74, 0xaa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x13, 0x71, 0xcc, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x07, 0x67, 0xc6, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x1a, 0x74, 0xaa, 0xff, 0x03, 0x41, 0x7c, 0xff, 0x01, 0x2f, 0x66, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x1f, 0x8c, 0xc3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x28, 0xba, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x13, 0x6f, 0xc7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x0a, 0x5b, 0x96, 0xff, 0x00, 0x27, 0x5d, 0xff, 0x00, 0x27, 0x5d, 0xff, 0x1a, 0x74, 0xaa, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x13, 0x71, 0xcc, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x07, 0x67, 0xc6, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x39, 0xc9, 0xff, 0xff, 0x1a, 0x74, 0xaa, 0xff, 0x01, 0x2f, 0x66, 0xff, 0x03, 0x38, 0x70, 0xff, 0x1a, 0x74, 0xaa, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x67, 0xc6, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x14, 0x70, 0xc5, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x37, 0xc2, 0xff, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x2a, 0xa5, 0xca, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x03, 0x38, 0x70, 0xff, 0x03, 0x41, 0x7c, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x08, 0x90, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x13, 0x6f, 0xc7, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x0b, 0x6c, 0xca, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x30, 0xbd, 0xff, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x48, 0xd5, 0xfe, 0xff, 0x1f, 0x8c, 0xc3, 0xff, 0x03, 0x38, 0x70, 0xff, 0x00, 0x27, 0x5d, 0xff, 0x03, 0x41, 0x7c, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x0b, 0x6c, 0xca, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x07, 0x67, 0xc6, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x35, 0xd0, 0xff, 0xff, 0x2a, 0xa5, 0xca, 0xff, 0x03, 0x41, 0x7c, 0xff, 0x01, 0x2f, 0x66, 0xff, 0x03, 0x38, 0x70, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x67, 0xc6, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1e, 0x79, 0xce, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x28, 0xba, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x03, 0x38, 0x70, 0xff, 0x03, 0x41, 0x7c, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x14, 0x70, 0xc5, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x03, 0x41, 0x7c, 0xff, 0x03, 0x38, 0x70, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x1f, 0x8c, 0xc3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x13, 0x6f, 0xc7, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x14, 0x70, 0xc5, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x06, 0x4e, 0x89, 0xff, 0x03, 0x38, 0x70, 0xff, 0x03, 0x38, 0x70, 0xff, 0x0a, 0x5b, 0x96, 0xff, 0x1f, 0x8c, 0xc3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x13, 0x6f, 0xc7, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x14, 0x70, 0xc5, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xb0, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x1f, 0x8c, 0xc3, 0xff, 0x0a, 0x5b, 0x96, 0xff, 0x0c, 0x66, 0xa1, 0xff, 0x1f, 0x8c, 0xc3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x13, 0x6f, 0xc7, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x14, 0x70, 0xc5, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x28, 0xba, 0xff, 0xff, 0x28, 0xba, 0xff, 0xff, 0x21, 0xb5, 0xfe, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x13, 0x6f, 0xc7, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1e, 0x79, 0xce, 0xff, 0x07, 0x67, 0xc6, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x17, 0xa9, 0xfa, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x07, 0x67, 0xc6, 0xff, 0x1e, 0x79, 0xce, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x0b, 0x6c, 0xca, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x15, 0xa2, 0xf3, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x0b, 0x6c, 0xca, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x14, 0x70, 0xc5, 0xff, 0x07, 0x67, 0xc6, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0f, 0x9b, 0xed, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x07, 0x67, 0xc6, 0xff, 0x14, 0x70, 0xc5, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x13, 0x6f, 0xc7, 0xff, 0x07, 0x67, 0xc6, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0e, 0x93, 0xe7, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x07, 0x67, 0xc6, 0xff, 0x13, 0x71, 0xcc, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x13, 0x6f, 0xc7, 0xff, 0x07, 0x67, 0xc6, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x0a, 0x8c, 0xe2, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x07, 0x67, 0xc6, 0xff, 0x13, 0x71, 0xcc, 0xff, 0x1e, 0x79, 0xce, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x14, 0x70, 0xc5, 0xff, 0x0b, 0x6c, 0xca, 0xff, 0x07, 0x67, 0xc6, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x07, 0x83, 0xdd, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x78, 0xd7, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x07, 0x67, 0xc6, 0xff, 0x0b, 0x6c, 0xca, 0xff, 0x14, 0x70, 0xc5, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x13, 0x71, 0xcc, 0xff, 0x0b, 0x6c, 0xca, 0xff, 0x07, 0x67, 0xc6, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x04, 0x6b, 0xcb, 0xff, 0x07, 0x67, 0xc6, 0xff, 0x0b, 0x6c, 0xca, 0xff, 0x13, 0x71, 0xcc, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x1e, 0x79, 0xce, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x14, 0x70, 0xc5, 0xff, 0x13, 0x6f, 0xc7, 0xff, 0x13, 0x6f, 0xc7, 0xff, 0x13, 0x6f, 0xc7, 0xff, 0x13, 0x6f, 0xc7, 0xff, 0x14, 0x70, 0xc5, 0xff, 0x21, 0x80, 0xd6, 0xff, 0x1e, 0x79, 0xce, 0xff, 0x22, 0x7b, 0xc8, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x28, 0x86, 0xc9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0x28, 0x86, 0xc9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+#endif
+};
+
+const lv_image_dsc_t emoji_F617 = {
+    .header.cf = LV_COLOR_FORMAT_NATIVE,
+    .header.w = 72,
+    .header.h = 72,
+#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
+    .header.stride = 72,
+#elif LV_COLOR_DEPTH == 16
+    .header.stride = 144,
+#elif LV_COLOR_DEPTH == 32
+    .header.stride = 288,
+#endif
+    .data = emoji_F617_map,
+    .data_size = sizeof(emoji_F617_map),
+};
@@ -0,0 +1,17 @@
+#include "../../lv_examples.h"
+#if LV_USE_BMP && LV_BUILD_EXAMPLES
+
+/**
+ * Open a BMP file from a file
+ */
+void lv_example_bmp_1(void)
+{
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    /* Assuming a File system is attached to letter 'A'
+     * E.g. set LV_USE_FS_STDIO 'A' in lv_conf.h */
+    lv_image_set_src(img, "A:lvgl/examples/libs/bmp/example_32bit.bmp");
+    lv_obj_center(img);
+
+}
+
+#endif
@@ -0,0 +1,52 @@
+#include "../../lv_examples.h"
+#if LV_BUILD_EXAMPLES
+#if LV_USE_FREETYPE
+
+#if LV_FREETYPE_USE_LVGL_PORT
+    #define PATH_PREFIX "A:"
+#else
+    #define PATH_PREFIX "./"
+#endif
+
+/**
+ * Load a font with FreeType
+ */
+void lv_example_freetype_1(void)
+{
+    /*Create a font*/
+    lv_font_t * font = lv_freetype_font_create(PATH_PREFIX "lvgl/examples/libs/freetype/Lato-Regular.ttf",
+                                               LV_FREETYPE_FONT_RENDER_MODE_BITMAP,
+                                               24,
+                                               LV_FREETYPE_FONT_STYLE_NORMAL);
+
+    if(!font) {
+        LV_LOG_ERROR("freetype font create failed.");
+        return;
+    }
+
+    /*Create style with the new font*/
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_text_font(&style, font);
+    lv_style_set_text_align(&style, LV_TEXT_ALIGN_CENTER);
+
+    /*Create a label with the new style*/
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_obj_add_style(label, &style, 0);
+    lv_label_set_text(label, "Hello world\nI'm a font created with FreeType");
+    lv_obj_center(label);
+}
+#else
+
+void lv_example_freetype_1(void)
+{
+    /*TODO
+     *fallback for online examples*/
+
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_label_set_text(label, "FreeType is not installed");
+    lv_obj_center(label);
+}
+
+#endif
+#endif
@@ -0,0 +1,31 @@
+#include "../../lv_examples.h"
+#if LV_BUILD_EXAMPLES
+
+#if LV_USE_LIBJPEG_TURBO
+
+/**
+ * Load a JPG image
+ */
+void lv_example_libjpeg_turbo_1(void)
+{
+    lv_obj_t * wp;
+
+    wp = lv_image_create(lv_screen_active());
+    /* Assuming a File system is attached to letter 'A'
+     * E.g. set LV_USE_FS_STDIO 'A' in lv_conf.h */
+    lv_image_set_src(wp, "A:lvgl/examples/libs/libjpeg_turbo/flower.jpg");
+    lv_obj_center(wp);
+}
+
+#else
+
+void lv_example_libjpeg_turbo_1(void)
+{
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_label_set_text(label, "LibJPEG-Turbo is not installed");
+    lv_obj_center(label);
+}
+
+#endif
+
+#endif
@@ -0,0 +1,1318 @@
+#include "../../../lvgl.h"
+#if LV_USE_LIBPNG && LV_BUILD_EXAMPLES
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMG_PNG_DEMO
+    #define LV_ATTRIBUTE_IMG_PNG_DEMO
+#endif
+
+static const
+LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_PNG_DEMO
+uint8_t img_png_demo_map[] = {
+
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x78, 0x08, 0x06, 0x00, 0x00, 0x00, 0x75, 0xa2, 0xf9,
+    0x6f, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xae, 0xce, 0x1c, 0xe9, 0x00, 0x00,
+    0x00, 0x04, 0x67, 0x41, 0x4d, 0x41, 0x00, 0x00, 0xb1, 0x8f, 0x0b, 0xfc, 0x61, 0x05, 0x00, 0x00,
+    0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0e, 0xc3, 0x00, 0x00, 0x0e, 0xc3, 0x01, 0xc7,
+    0x6f, 0xa8, 0x64, 0x00, 0x00, 0x50, 0x15, 0x49, 0x44, 0x41, 0x54, 0x78, 0x5e, 0xed, 0xbd, 0x09,
+    0xb8, 0x25, 0x57, 0x79, 0x1d, 0xba, 0x77, 0xcd, 0x55, 0xe7, 0x9c, 0x3a, 0xf3, 0x39, 0x77, 0x9e,
+    0xfa, 0xf6, 0xbd, 0x3d, 0xaa, 0x5b, 0xad, 0xd6, 0x80, 0x84, 0x5a, 0x20, 0x24, 0x04, 0x12, 0x18,
+    0x03, 0x96, 0x04, 0xb1, 0x19, 0x6c, 0x6c, 0xf1, 0xd9, 0x2f, 0x18, 0x27, 0x36, 0x8f, 0x38, 0x38,
+    0x51, 0x14, 0x3b, 0x89, 0x89, 0x0d, 0x8e, 0x1e, 0xb6, 0x12, 0xf0, 0x07, 0xcf, 0xc2, 0xcf, 0x01,
+    0x44, 0x64, 0x30, 0x66, 0x1e, 0x22, 0x24, 0x6b, 0x56, 0x4b, 0x2d, 0xf5, 0x3c, 0xdd, 0x79, 0x38,
+    0xf3, 0x58, 0xf3, 0xb4, 0xf7, 0xfb, 0xf7, 0xb9, 0xf7, 0xb6, 0x06, 0x83, 0x49, 0x08, 0xdd, 0x6a,
+    0xba, 0x7b, 0xf5, 0xad, 0xae, 0x3a, 0x35, 0x0f, 0xab, 0xd6, 0xff, 0xaf, 0x5d, 0xbb, 0x76, 0xa1,
+    0x4b, 0xb8, 0x84, 0x4b, 0xb8, 0x84, 0x4b, 0xb8, 0x84, 0x4b, 0xb8, 0x84, 0x4b, 0xb8, 0xe8, 0x80,
+    0xd7, 0xfb, 0x3f, 0x37, 0x78, 0xe0, 0x01, 0x2a, 0xd5, 0xeb, 0x28, 0x16, 0x04, 0x76, 0xcc, 0xb2,
+    0x38, 0x85, 0x52, 0x2c, 0x64, 0xb3, 0x58, 0x9c, 0x98, 0x08, 0x65, 0x4a, 0x89, 0xbb, 0xb0, 0xc0,
+    0xb5, 0xeb, 0xf5, 0xd0, 0xc9, 0x66, 0x75, 0x67, 0x75, 0x15, 0xb9, 0xf7, 0xdc, 0x83, 0xc9, 0xfa,
+    0xa2, 0x97, 0x70, 0x1e, 0xe2, 0xe7, 0x80, 0x80, 0x14, 0xf7, 0xf7, 0xaf, 0xaa, 0xb2, 0xec, 0xe5,
+    0xf7, 0xed, 0x53, 0x27, 0x32, 0x99, 0xc4, 0x48, 0x10, 0x44, 0x79, 0xdf, 0x47, 0xc9, 0x28, 0xa2,
+    0x31, 0x49, 0xa2, 0xda, 0xf0, 0x30, 0xce, 0xe9, 0x3a, 0x55, 0x4d, 0x93, 0xb4, 0x56, 0x56, 0xf0,
+    0xb2, 0xef, 0x93, 0x2e, 0xcf, 0xd3, 0x26, 0xc7, 0x45, 0xab, 0xf1, 0x38, 0xb7, 0x34, 0x39, 0x49,
+    0x56, 0x93, 0xc9, 0x47, 0xea, 0x77, 0xdc, 0x71, 0x47, 0xb4, 0xbe, 0xd2, 0x4b, 0x38, 0x4f, 0x70,
+    0x1e, 0x13, 0x90, 0xe2, 0x9d, 0x3b, 0x3b, 0x29, 0x84, 0x3a, 0x40, 0x3a, 0x67, 0x1b, 0xcf, 0x3b,
+    0x9b, 0x65, 0x59, 0x9b, 0x90, 0xe5, 0x4c, 0x51, 0x96, 0xf9, 0x9c, 0xa2, 0xd0, 0x24, 0x10, 0x4c,
+    0xd6, 0x34, 0x2c, 0x25, 0x12, 0x48, 0x21, 0x80, 0x5a, 0x8d, 0xb6, 0x2b, 0x15, 0xda, 0x8a, 0xa2,
+    0xd0, 0x47, 0xc8, 0x77, 0x30, 0xa6, 0xad, 0x64, 0x12, 0x35, 0x86, 0x87, 0x51, 0x19, 0x48, 0x7a,
+    0xc0, 0xf7, 0xe9, 0x23, 0x1f, 0xf9, 0xc8, 0x64, 0x75, 0x7d, 0x03, 0x3f, 0x37, 0xb8, 0x9b, 0xde,
+    0xcd, 0x7d, 0xe6, 0xd9, 0xcf, 0x28, 0x25, 0xbb, 0x14, 0x43, 0x16, 0x8a, 0xed, 0xe4, 0x77, 0x26,
+    0xde, 0x98, 0x7e, 0x63, 0x76, 0x44, 0x19, 0x91, 0x96, 0xf0, 0x52, 0xf5, 0x29, 0xee, 0xa9, 0xca,
+    0x35, 0xf9, 0x6b, 0x4c, 0x2d, 0xa7, 0x59, 0xf7, 0xe0, 0x7b, 0x7e, 0xae, 0x14, 0xff, 0xbc, 0x24,
+    0xe0, 0x4d, 0x37, 0x35, 0x93, 0x96, 0xe5, 0x4e, 0x69, 0x5a, 0xb8, 0x73, 0xd7, 0xae, 0x68, 0xdf,
+    0xc8, 0x48, 0xb0, 0x97, 0xe7, 0xfd, 0xfc, 0xea, 0xaa, 0x48, 0xaa, 0xd5, 0x34, 0xd1, 0x34, 0x21,
+    0x26, 0xcb, 0x01, 0x84, 0xdc, 0x90, 0xfa, 0x7e, 0x10, 0x86, 0x21, 0x0d, 0x3a, 0x1d, 0xde, 0x6a,
+    0xb5, 0x78, 0x33, 0x00, 0x79, 0x44, 0x28, 0x20, 0x94, 0x46, 0x18, 0x88, 0xa9, 0xaa, 0x2a, 0x8d,
+    0xb9, 0xae, 0xeb, 0x08, 0x82, 0x7f, 0xc8, 0xf7, 0xa5, 0x6f, 0x51, 0x9a, 0xfc, 0xa1, 0x2c, 0x8f,
+    0x9f, 0xfe, 0xf2, 0x97, 0xf1, 0xf9, 0xaf, 0x86, 0x0f, 0x20, 0xe9, 0x86, 0xfc, 0x0d, 0x85, 0xb8,
+    0x1b, 0x1f, 0x0f, 0xbc, 0x60, 0x04, 0x87, 0x78, 0x90, 0xa7, 0x7c, 0x41, 0x40, 0x42, 0x2a, 0x2e,
+    0xc6, 0x13, 0x9a, 0xa4, 0xf1, 0x2d, 0xdc, 0x5a, 0x9d, 0x95, 0xe6, 0x4f, 0x6d, 0xcf, 0x6e, 0xed,
+    0x8c, 0xa7, 0xc6, 0x57, 0x62, 0x62, 0xec, 0x54, 0x7a, 0x20, 0x5d, 0xfa, 0x20, 0xfe, 0x60, 0xb0,
+    0xbe, 0x96, 0xf3, 0x1a, 0xe7, 0x15, 0x01, 0x6f, 0xbf, 0x9d, 0x4a, 0x95, 0x4a, 0x63, 0x93, 0x2c,
+    0x3b, 0x57, 0xa4, 0x52, 0xde, 0x6b, 0xf6, 0xed, 0x53, 0x6e, 0xd8, 0xb9, 0x53, 0x1e, 0xce, 0xe7,
+    0x91, 0x62, 0x59, 0x26, 0x7a, 0xfe, 0x79, 0xcf, 0x3f, 0x7e, 0x1c, 0x24, 0x4f, 0x92, 0x45, 0xdf,
+    0x8f, 0xc2, 0x66, 0xd3, 0xb3, 0x6a, 0x35, 0xaf, 0x6b, 0x9a, 0x91, 0x47, 0x88, 0x18, 0x2a, 0x0a,
+    0xcf, 0x27, 0x93, 0x56, 0x4c, 0x51, 0x02, 0x19, 0x54, 0x52, 0x8a, 0xb1, 0xa1, 0x00, 0x45, 0x8b,
+    0x8b, 0xbe, 0xc9, 0xf3, 0x28, 0x04, 0x6e, 0x2e, 0x82, 0x42, 0x7e, 0x73, 0x71, 0x51, 0xfe, 0x76,
+    0xbd, 0xbe, 0xed, 0x30, 0x1c, 0xfe, 0xf9, 0x79, 0x91, 0x1e, 0x42, 0x42, 0x26, 0xca, 0x14, 0xf7,
+    0x79, 0xfb, 0x2e, 0xcf, 0x85, 0xb9, 0x2b, 0x71, 0x80, 0x77, 0x79, 0x91, 0x37, 0x06, 0x17, 0x2b,
+    0x2b, 0xf2, 0x52, 0x1c, 0x73, 0x48, 0xe0, 0x30, 0xcf, 0x85, 0x5c, 0x18, 0xae, 0xfa, 0xab, 0xb5,
+    0xc3, 0xe4, 0xf0, 0xa9, 0xd1, 0xd4, 0xa8, 0x37, 0x94, 0x1d, 0xaa, 0x64, 0xd4, 0xcc, 0xe9, 0x94,
+    0x92, 0x3a, 0x9e, 0x12, 0x52, 0x47, 0xc7, 0x46, 0xc6, 0x96, 0xee, 0xc0, 0x77, 0x40, 0x34, 0x38,
+    0x7f, 0x71, 0xde, 0x10, 0xf0, 0x86, 0x1b, 0xba, 0xb9, 0x30, 0x6c, 0x5d, 0x9e, 0x4e, 0xbb, 0xd7,
+    0xe7, 0x72, 0xfe, 0xcd, 0xdb, 0xb6, 0x29, 0x9b, 0x6f, 0xbc, 0x31, 0x13, 0x1b, 0x1e, 0x96, 0x85,
+    0x76, 0xdb, 0x25, 0x87, 0x0e, 0x75, 0xdd, 0x27, 0x9f, 0x34, 0xbd, 0x7a, 0x9d, 0x57, 0x29, 0x55,
+    0x68, 0x10, 0x88, 0xb6, 0x6d, 0x87, 0x81, 0x6d, 0x07, 0x5e, 0x14, 0x71, 0x3e, 0xcf, 0x63, 0x8a,
+    0x81, 0x4f, 0xc5, 0xa2, 0x95, 0x4d, 0x24, 0xdc, 0xa4, 0x28, 0x8a, 0x1c, 0xc7, 0xc5, 0x09, 0x18,
+    0x96, 0xd6, 0xc1, 0x83, 0xfe, 0x8a, 0xae, 0x0b, 0x4a, 0x3c, 0xce, 0x6b, 0x41, 0xe0, 0x99, 0xab,
+    0xab, 0xc1, 0xb7, 0x4a, 0x25, 0xed, 0x6f, 0x9b, 0xcd, 0xed, 0x07, 0xce, 0x2b, 0x12, 0x52, 0xb8,
+    0x1e, 0x8f, 0xa2, 0x94, 0x60, 0x08, 0x93, 0x37, 0x7a, 0x37, 0xee, 0x1b, 0x8d, 0x46, 0x6f, 0xe1,
+    0x23, 0x7e, 0x47, 0x84, 0xa2, 0x98, 0x4d, 0x6d, 0x9f, 0x72, 0x94, 0xe8, 0x92, 0x0e, 0x01, 0x00,
+    0xfe, 0x78, 0xa1, 0x47, 0xc0, 0x7a, 0x50, 0xef, 0x18, 0xa1, 0xd1, 0x90, 0x15, 0x19, 0xb5, 0xd5,
+    0xb6, 0x27, 0xca, 0x62, 0x2b, 0x21, 0x26, 0xe6, 0xb3, 0x4a, 0xf6, 0x64, 0x4e, 0xc9, 0x1d, 0x8c,
+    0x27, 0xe3, 0xcf, 0x75, 0xb3, 0xdd, 0xd2, 0xf9, 0x1a, 0x9a, 0xcf, 0x03, 0x02, 0x52, 0x7e, 0xf7,
+    0xee, 0xda, 0x04, 0xc7, 0xd9, 0x57, 0x65, 0x32, 0xe6, 0x8d, 0x03, 0x03, 0xfe, 0xeb, 0xc1, 0x50,
+    0x14, 0x06, 0x07, 0x35, 0xb4, 0x7d, 0x7b, 0x12, 0x4e, 0x1a, 0x26, 0xa7, 0x4e, 0x39, 0xce, 0xa3,
+    0x8f, 0x7a, 0xcd, 0xd5, 0x55, 0x53, 0x50, 0x94, 0x6e, 0x31, 0x0c, 0x05, 0x14, 0x8f, 0x27, 0x29,
+    0x5c, 0x06, 0x89, 0x52, 0xde, 0x13, 0x04, 0xc5, 0x02, 0x43, 0xe2, 0x75, 0xbb, 0xbe, 0x2d, 0x49,
+    0x81, 0xa8, 0x69, 0xbe, 0x22, 0x8a, 0x48, 0xe0, 0x81, 0xab, 0xb5, 0x1a, 0xe9, 0x36, 0x9b, 0xa1,
+    0x05, 0xf9, 0x1f, 0x01, 0x85, 0x94, 0x52, 0x29, 0x2e, 0x09, 0xf9, 0x61, 0xd8, 0xed, 0x92, 0x6f,
+    0x2c, 0x2c, 0x24, 0xff, 0xa6, 0x54, 0x9a, 0x7c, 0x01, 0xb6, 0xf1, 0xea, 0x87, 0xe3, 0xfd, 0x48,
+    0x44, 0x2d, 0x34, 0xcc, 0x9b, 0xfc, 0xf6, 0x94, 0x95, 0xda, 0x7b, 0x0d, 0xbe, 0xe6, 0xb6, 0x3e,
+    0xb1, 0x6f, 0x52, 0xc2, 0x92, 0xd8, 0x0e, 0xdb, 0xe6, 0x8c, 0x37, 0x53, 0xa9, 0xd3, 0xba, 0x31,
+    0x2d, 0x4f, 0xf7, 0x8d, 0xc6, 0x46, 0x0b, 0x40, 0xb2, 0x18, 0x15, 0x28, 0x01, 0x72, 0xba, 0x5b,
+    0xf5, 0xad, 0xa4, 0x2f, 0xd9, 0x47, 0x0f, 0xd9, 0x87, 0xec, 0xa7, 0xbc, 0xa7, 0xda, 0x02, 0x15,
+    0xb8, 0x2c, 0xcd, 0xba, 0x29, 0x39, 0x75, 0x4a, 0x8b, 0x69, 0x8f, 0x6b, 0x29, 0xed, 0x11, 0xa5,
+    0x4f, 0x39, 0xf4, 0x61, 0xee, 0xc3, 0xde, 0xfa, 0xd6, 0xce, 0x1b, 0xf0, 0xeb, 0xfd, 0x57, 0x05,
+    0xef, 0x7b, 0x1f, 0x55, 0xd2, 0xe9, 0xe5, 0x3d, 0x96, 0xd5, 0x7a, 0x7d, 0x10, 0xd8, 0x37, 0x15,
+    0x8b, 0xc1, 0xb5, 0xe9, 0x74, 0x94, 0x03, 0xb2, 0x44, 0xb3, 0xb3, 0xb4, 0x7b, 0xe0, 0x80, 0x67,
+    0x7e, 0xe7, 0x3b, 0x56, 0xed, 0xb1, 0xc7, 0x6c, 0x6b, 0x75, 0xd5, 0x92, 0x82, 0xa0, 0x1d, 0xb3,
+    0xed, 0x55, 0xde, 0x71, 0x1c, 0x13, 0x76, 0x9d, 0x85, 0x16, 0x11, 0x88, 0x27, 0x01, 0x89, 0x45,
+    0x66, 0x5a, 0x1c, 0x87, 0xb8, 0xb6, 0x8d, 0x1d, 0xc3, 0xa0, 0x0e, 0xc7, 0xc9, 0x41, 0x14, 0xc9,
+    0x7e, 0x14, 0xa1, 0x10, 0x03, 0x24, 0x89, 0xe7, 0xa0, 0x87, 0x98, 0x5a, 0x0a, 0x02, 0x2f, 0x82,
+    0x67, 0x29, 0x42, 0x5e, 0x19, 0xc5, 0xe3, 0x76, 0xa9, 0xd5, 0xfa, 0x7f, 0x9a, 0x6b, 0x7b, 0xf4,
+    0xea, 0x60, 0xfa, 0xd1, 0xe9, 0x44, 0xd0, 0x08, 0xb6, 0x93, 0x2e, 0xb9, 0x8a, 0xb6, 0xe8, 0x3e,
+    0x14, 0xa0, 0xed, 0x49, 0x9c, 0xcc, 0x00, 0xf9, 0xd8, 0xf5, 0xf1, 0xdd, 0xc8, 0xb5, 0x4f, 0x05,
+    0xa7, 0xaa, 0x5d, 0xd2, 0xf5, 0x87, 0xf9, 0xa1, 0x8c, 0x2e, 0x24, 0x63, 0x1c, 0xe2, 0xb0, 0x19,
+    0x9a, 0x36, 0x4c, 0x73, 0xb7, 0x67, 0xb6, 0x8b, 0x7b, 0x07, 0xf7, 0x2a, 0x83, 0xf1, 0x41, 0xc9,
+    0x73, 0x3d, 0xd1, 0x74, 0x4c, 0x49, 0xf1, 0x95, 0x02, 0x71, 0xc9, 0x98, 0x1d, 0xda, 0x79, 0x83,
+    0x1a, 0x72, 0xe8, 0x86, 0xf4, 0xc6, 0xdf, 0xbf, 0xb1, 0xfa, 0xf0, 0x9f, 0x3e, 0x7c, 0x5e, 0x85,
+    0xe4, 0x57, 0x8d, 0x80, 0x1f, 0xf8, 0xc0, 0x62, 0xa6, 0xd3, 0x31, 0xae, 0x37, 0x4d, 0xeb, 0x26,
+    0xdf, 0xf7, 0x6e, 0xc0, 0x38, 0xea, 0x57, 0x55, 0x0c, 0x84, 0x42, 0xd1, 0xea, 0x2a, 0x6e, 0xb6,
+    0x5a, 0xd4, 0x33, 0xcd, 0x80, 0x73, 0x9c, 0x10, 0x83, 0x19, 0x49, 0xf3, 0xbc, 0x57, 0x00, 0x92,
+    0xc2, 0xe9, 0x76, 0xca, 0xcd, 0xa6, 0xb0, 0xda, 0x6a, 0xa1, 0x3a, 0xb8, 0x0f, 0xd7, 0xf3, 0x22,
+    0xdf, 0x71, 0x5c, 0x64, 0xdb, 0x1e, 0xf2, 0xbc, 0x90, 0xa8, 0x2a, 0xc7, 0xe5, 0x72, 0x92, 0xa2,
+    0xaa, 0x82, 0xe4, 0x79, 0x28, 0x02, 0x52, 0x86, 0x40, 0x52, 0xb6, 0x49, 0xc6, 0x43, 0x44, 0x61,
+    0x10, 0xf2, 0xc2, 0x80, 0x52, 0x0e, 0x08, 0x49, 0x73, 0x89, 0x04, 0xf5, 0x72, 0xb9, 0xdf, 0x59,
+    0x2c, 0x97, 0x3f, 0x65, 0xf7, 0x76, 0xec, 0x5c, 0x02, 0x42, 0x6e, 0xfc, 0x0d, 0xf1, 0xbc, 0xd0,
+    0x15, 0xf6, 0x4e, 0x9a, 0x93, 0xb7, 0x6e, 0xf2, 0x37, 0xbd, 0xa3, 0x0f, 0xf5, 0x4d, 0x9b, 0xc4,
+    0xf4, 0x81, 0x34, 0xce, 0x6b, 0x53, 0xaf, 0x4d, 0x5f, 0x9d, 0xbf, 0x3a, 0x3e, 0x15, 0x9f, 0xd2,
+    0xfa, 0x51, 0x7f, 0x42, 0x8c, 0x04, 0x2d, 0x2b, 0xe4, 0x52, 0x2a, 0x56, 0x65, 0x2b, 0xb4, 0xdc,
+    0x9a, 0x5f, 0xed, 0xcc, 0x04, 0xb3, 0x55, 0xf8, 0x8d, 0xa7, 0x32, 0x53, 0xea, 0xb0, 0x3e, 0x2c,
+    0x49, 0x91, 0x24, 0x55, 0x5b, 0x55, 0x29, 0x0a, 0x23, 0x91, 0xc7, 0xbc, 0x12, 0xf0, 0x41, 0xb2,
+    0x43, 0x5a, 0xba, 0xe1, 0x76, 0x65, 0xe4, 0x06, 0x68, 0xdf, 0x6f, 0x5f, 0x56, 0x7a, 0xfc, 0x2f,
+    0x0e, 0x9c, 0x37, 0x24, 0x7c, 0x15, 0x08, 0x48, 0xf1, 0xfb, 0xdf, 0xff, 0xdb, 0xc3, 0xad, 0x56,
+    0x70, 0x63, 0xb5, 0x6a, 0xdc, 0x64, 0x59, 0xe1, 0x55, 0xc0, 0x8d, 0x18, 0xc7, 0xf1, 0xc8, 0x71,
+    0x38, 0xaf, 0xdd, 0xe6, 0x2c, 0xdb, 0xe6, 0x5c, 0x48, 0xe0, 0x68, 0xbe, 0x80, 0xf4, 0x81, 0x41,
+    0x2e, 0x25, 0xcb, 0x34, 0xe1, 0x38, 0x28, 0x04, 0x42, 0x95, 0x0c, 0x43, 0xaa, 0x84, 0xa1, 0xe4,
+    0x01, 0xb1, 0xfc, 0x7a, 0x3d, 0xe8, 0x34, 0x1a, 0x1e, 0x90, 0xd5, 0x6d, 0x80, 0x6b, 0x36, 0x53,
+    0x29, 0x2a, 0x64, 0x32, 0x22, 0x84, 0x5e, 0x02, 0x64, 0xf4, 0x91, 0xeb, 0x12, 0xc8, 0x15, 0x71,
+    0xb8, 0xbe, 0x5d, 0x14, 0x8b, 0x61, 0x11, 0x48, 0xce, 0xfb, 0x3e, 0x02, 0x97, 0x8c, 0x80, 0x82,
+    0xbc, 0xc6, 0xf3, 0x34, 0x91, 0x4e, 0xcb, 0x2d, 0x59, 0xbe, 0x6b, 0xbe, 0x56, 0xbb, 0xef, 0xdc,
+    0x85, 0xe2, 0x07, 0xe0, 0xdc, 0xd7, 0xd0, 0x88, 0xda, 0x55, 0xaf, 0xda, 0x63, 0xee, 0xb9, 0x13,
+    0x08, 0xf6, 0xd6, 0x82, 0x54, 0x18, 0x8d, 0xf1, 0x31, 0xc9, 0x27, 0x7e, 0xb0, 0x3b, 0xb9, 0x3b,
+    0xf1, 0xce, 0xc9, 0x77, 0x16, 0x77, 0xf5, 0xed, 0x8a, 0xf5, 0xa9, 0x7d, 0xb2, 0x18, 0x89, 0x42,
+    0xd3, 0x6e, 0xd2, 0x6e, 0xd0, 0x0d, 0xcd, 0xc0, 0xf4, 0x57, 0xdd, 0xd5, 0x6e, 0x8b, 0xb4, 0x4c,
+    0xc2, 0x11, 0xb2, 0xe8, 0x2e, 0xba, 0x39, 0x9a, 0xd3, 0xb3, 0x72, 0x56, 0x46, 0x11, 0xe2, 0x56,
+    0xda, 0x2b, 0xb8, 0x16, 0xd4, 0x08, 0x96, 0x30, 0x05, 0xb5, 0xe7, 0x1c, 0xe4, 0xc9, 0x2d, 0xa7,
+    0x91, 0x02, 0x27, 0xad, 0xc6, 0xe5, 0x74, 0x78, 0xed, 0x07, 0xf7, 0xad, 0x3c, 0xf1, 0xdf, 0x9e,
+    0x38, 0x2f, 0x72, 0xdf, 0x73, 0x4a, 0xc0, 0xbb, 0xef, 0xa6, 0xdc, 0xd8, 0x58, 0x7d, 0xba, 0x56,
+    0xeb, 0xde, 0x5c, 0xaf, 0x9b, 0x6f, 0xb0, 0xed, 0x68, 0x1b, 0x88, 0x12, 0x84, 0xcf, 0x35, 0xc0,
+    0x30, 0x16, 0x45, 0x0c, 0x39, 0x1c, 0x16, 0x07, 0x07, 0x51, 0x16, 0xba, 0x8c, 0x2c, 0x47, 0x71,
+    0xd3, 0x42, 0xc8, 0x30, 0x50, 0x23, 0x0c, 0x49, 0x03, 0x54, 0x0c, 0xf2, 0x42, 0x42, 0xc3, 0x90,
+    0x92, 0x20, 0x80, 0x1c, 0x28, 0x8a, 0xe0, 0x37, 0x8d, 0x26, 0x27, 0x55, 0x6d, 0x60, 0x40, 0x15,
+    0x31, 0xe6, 0x49, 0xb7, 0x1b, 0xba, 0xe0, 0x78, 0x29, 0x21, 0x3c, 0x26, 0x70, 0x85, 0x40, 0xeb,
+    0xd0, 0xde, 0xbd, 0x5c, 0xfa, 0xd6, 0x5b, 0xe5, 0xe2, 0x9e, 0x3d, 0x62, 0x52, 0x51, 0x30, 0xbf,
+    0xbc, 0x1c, 0x39, 0x84, 0x2d, 0x49, 0x51, 0x52, 0x10, 0x08, 0xed, 0xeb, 0x8b, 0x2d, 0x9d, 0x38,
+    0xf1, 0x5f, 0x6a, 0xeb, 0xbb, 0x72, 0x76, 0x71, 0x18, 0x49, 0x22, 0x11, 0xa7, 0x21, 0xe7, 0xbb,
+    0x6a, 0x9b, 0xb1, 0xed, 0xed, 0x43, 0xc2, 0xd0, 0x8d, 0x59, 0x29, 0x9b, 0xe7, 0x11, 0x8f, 0x81,
+    0x60, 0xce, 0x72, 0xb0, 0xdc, 0x7c, 0xfb, 0xd0, 0xdb, 0x07, 0xaf, 0x1d, 0xbb, 0x36, 0x51, 0x4c,
+    0x14, 0x05, 0x44, 0x10, 0x36, 0x6d, 0x93, 0xce, 0x76, 0x67, 0xcc, 0xa7, 0x9c, 0xa7, 0x4a, 0x0b,
+    0xfe, 0x42, 0xeb, 0x94, 0x7b, 0xb2, 0x8e, 0x43, 0x8e, 0x24, 0x85, 0xa4, 0x68, 0x11, 0x8b, 0x2f,
+    0x77, 0xcb, 0x52, 0x68, 0x87, 0x4a, 0xc3, 0x68, 0x70, 0xa7, 0xba, 0xa7, 0xc8, 0x9c, 0x37, 0xeb,
+    0xf9, 0xd8, 0x0f, 0x99, 0x59, 0x21, 0x28, 0x22, 0x16, 0xb2, 0xb0, 0x4f, 0x83, 0x0c, 0x87, 0x25,
+    0x61, 0x28, 0x31, 0xe4, 0xfd, 0xde, 0x87, 0x7e, 0x6f, 0xe5, 0x6f, 0x3e, 0xf5, 0x37, 0xaf, 0x7a,
+    0xee, 0xcb, 0xad, 0xf7, 0xcf, 0x3a, 0x6e, 0xb8, 0xe1, 0x21, 0x61, 0x76, 0xb6, 0xb6, 0xab, 0x5c,
+    0xee, 0xde, 0xda, 0x68, 0xd8, 0x6f, 0x72, 0x1c, 0x3a, 0x09, 0x94, 0xeb, 0x6d, 0x9f, 0x83, 0x84,
+    0x26, 0x9b, 0x45, 0x89, 0xc9, 0x49, 0x3c, 0x38, 0x3d, 0x4d, 0x86, 0xa7, 0xa6, 0xfc, 0xd1, 0xbe,
+    0xbe, 0x20, 0x8b, 0xb9, 0x88, 0x6b, 0x35, 0x91, 0xd3, 0x6e, 0x61, 0x20, 0x1e, 0xd7, 0x06, 0xf2,
+    0x45, 0x40, 0x42, 0x06, 0x94, 0x4e, 0x23, 0xad, 0x58, 0xc4, 0xf1, 0x4c, 0x86, 0x57, 0xae, 0xbb,
+    0x2e, 0x35, 0x30, 0x3e, 0x9e, 0x4a, 0x12, 0x22, 0xa1, 0x4e, 0x87, 0x40, 0xee, 0x07, 0x8c, 0x8c,
+    0x10, 0xf4, 0x7d, 0x46, 0x56, 0x6e, 0x78, 0x98, 0xd3, 0xde, 0xf8, 0xc6, 0x78, 0xee, 0x86, 0x1b,
+    0x92, 0xc9, 0x1b, 0x6e, 0x48, 0xe9, 0xb7, 0xdc, 0x12, 0xcf, 0x4e, 0x4e, 0x8a, 0xf1, 0xde, 0x8e,
+    0x21, 0x2c, 0xb8, 0x2e, 0xdd, 0xc5, 0x71, 0xd1, 0x35, 0xb7, 0xdf, 0x5e, 0x59, 0x1f, 0x77, 0x16,
+    0xf1, 0x38, 0x52, 0xc5, 0xaa, 0xb8, 0x13, 0xc8, 0x77, 0x9d, 0xd0, 0x12, 0xde, 0x20, 0x04, 0xc2,
+    0x76, 0x4a, 0x28, 0x67, 0x05, 0x96, 0x03, 0xaa, 0xd6, 0x3c, 0xee, 0x1d, 0x5f, 0xed, 0xd2, 0xae,
+    0x9d, 0x90, 0x12, 0x42, 0x5c, 0x89, 0xc3, 0x0d, 0x29, 0xc2, 0x59, 0xc2, 0x14, 0x12, 0x8c, 0xa8,
+    0x11, 0x36, 0xdd, 0x53, 0xc1, 0xc9, 0xc6, 0x8a, 0xbf, 0xd4, 0x66, 0xb9, 0x5f, 0xd9, 0x2b, 0xb5,
+    0x5c, 0xd7, 0xf5, 0xe4, 0x50, 0x26, 0x87, 0xac, 0x43, 0x95, 0x2f, 0x2e, 0x7e, 0xb1, 0xf4, 0xd5,
+    0xf9, 0xaf, 0xd6, 0x9f, 0xad, 0x3d, 0xdb, 0x99, 0xe9, 0xcc, 0xb6, 0x17, 0xda, 0x0b, 0x66, 0xd5,
+    0xaa, 0xc2, 0xe1, 0x79, 0x21, 0xa4, 0x93, 0x11, 0x52, 0x78, 0x3d, 0x0c, 0x82, 0xd7, 0x84, 0x1d,
+    0xff, 0x36, 0x5b, 0xb4, 0xaf, 0xa5, 0x90, 0x87, 0xac, 0xef, 0xd5, 0xab, 0x86, 0x73, 0xa2, 0x80,
+    0xb7, 0xdf, 0x4e, 0x79, 0x08, 0x73, 0x7b, 0x2a, 0x15, 0xe3, 0x8d, 0xed, 0xb6, 0x73, 0x23, 0x98,
+    0x8c, 0x3c, 0x8c, 0xee, 0x39, 0x70, 0x96, 0x89, 0xf5, 0xf7, 0xe3, 0xcc, 0xd0, 0x10, 0x57, 0x48,
+    0xa7, 0x83, 0x94, 0x24, 0xf9, 0x72, 0x04, 0x09, 0x0c, 0x84, 0x5c, 0xa7, 0x5e, 0x13, 0x8c, 0xae,
+    0x21, 0x98, 0x9a, 0x8a, 0xbc, 0x30, 0xb4, 0x9d, 0x66, 0xd3, 0x76, 0x8b, 0xc5, 0x28, 0xb5, 0x6d,
+    0x9b, 0x38, 0xba, 0x65, 0x8b, 0x32, 0x34, 0x3e, 0xae, 0xa6, 0xa7, 0xa6, 0x52, 0x89, 0xc1, 0xc1,
+    0x78, 0x1a, 0xcc, 0x05, 0xae, 0xd5, 0x22, 0x9b, 0x85, 0x56, 0x16, 0x6e, 0x81, 0x78, 0xa0, 0x6e,
+    0xf0, 0x03, 0x02, 0xed, 0x55, 0x57, 0x69, 0xc9, 0xd7, 0xbd, 0x2e, 0x99, 0x1a, 0x18, 0xd0, 0x05,
+    0x4d, 0x93, 0xe1, 0xa2, 0x72, 0x5c, 0xa5, 0xe2, 0x45, 0x27, 0x4e, 0x04, 0x26, 0xcb, 0x09, 0xa1,
+    0x53, 0xd9, 0xff, 0xf1, 0xb8, 0xb4, 0x7c, 0xf8, 0xf0, 0x27, 0x56, 0xd9, 0x7e, 0x9d, 0x0d, 0xf4,
+    0xef, 0xef, 0xd7, 0xc4, 0xae, 0xb8, 0x7b, 0xb0, 0x3d, 0x78, 0xa3, 0x6e, 0xea, 0x37, 0xc1, 0x61,
+    0xe6, 0x6c, 0x62, 0x7b, 0x98, 0x60, 0x5a, 0x0e, 0xca, 0xed, 0x13, 0xfe, 0x89, 0xf2, 0x22, 0x59,
+    0x6c, 0x27, 0xb8, 0x84, 0xb2, 0x4b, 0xdb, 0xd5, 0x07, 0xa6, 0x42, 0x11, 0xb0, 0x80, 0x4a, 0x9d,
+    0x52, 0x78, 0xb0, 0x72, 0xd0, 0xf9, 0x66, 0xfd, 0x9b, 0xcb, 0x15, 0xaf, 0x0a, 0xca, 0x4d, 0xe1,
+    0x16, 0x43, 0x51, 0x88, 0x22, 0x0a, 0x01, 0x03, 0xa7, 0x85, 0xb4, 0x10, 0xe2, 0xd0, 0x99, 0x0b,
+    0xe7, 0x2a, 0xb5, 0xb0, 0xd6, 0x6e, 0x86, 0xcd, 0x96, 0x43, 0x9c, 0x0e, 0x18, 0x10, 0x47, 0x12,
+    0x24, 0x5e, 0x54, 0xc5, 0x88, 0x13, 0xb9, 0x48, 0x0d, 0x54, 0x55, 0xf4, 0xa5, 0x9c, 0x10, 0x8a,
+    0x69, 0x09, 0x0b, 0x51, 0x3b, 0xec, 0x2c, 0xfd, 0xf5, 0x9f, 0xfd, 0xf5, 0xab, 0x6a, 0xc0, 0xce,
+    0x3a, 0x01, 0x81, 0x04, 0xf8, 0xeb, 0x5f, 0xaf, 0xec, 0x30, 0x4d, 0xe3, 0xad, 0xbe, 0xef, 0xbe,
+    0x19, 0x0c, 0x40, 0x12, 0xd4, 0x09, 0x94, 0x69, 0x0d, 0x9a, 0x86, 0xa4, 0x62, 0x91, 0xa6, 0xe3,
+    0xf1, 0x20, 0xe1, 0x79, 0x41, 0xd8, 0x6a, 0x91, 0x36, 0x98, 0x90, 0x9a, 0x61, 0x88, 0xd6, 0xb6,
+    0x6d, 0x09, 0xe5, 0xc6, 0x1b, 0x63, 0xfa, 0xd5, 0x57, 0x73, 0xf1, 0x5c, 0xce, 0xd6, 0x08, 0x71,
+    0x63, 0x23, 0x23, 0xe2, 0x40, 0x5f, 0x9f, 0x96, 0xc9, 0x64, 0x12, 0x42, 0x2a, 0xa5, 0x93, 0x64,
+    0x52, 0x86, 0xf1, 0x44, 0x6c, 0x34, 0x22, 0xcb, 0xb2, 0x40, 0x28, 0x7a, 0xe4, 0x63, 0xdb, 0x65,
+    0xfc, 0xc6, 0xb0, 0x79, 0xca, 0xef, 0xda, 0xa5, 0x25, 0xf6, 0xee, 0x4d, 0xc5, 0x74, 0x5d, 0x81,
+    0xd4, 0x92, 0x43, 0xbe, 0x4f, 0xf0, 0xfc, 0xbc, 0xc1, 0xad, 0xae, 0x86, 0x11, 0xe4, 0x81, 0x38,
+    0x1e, 0xe7, 0x81, 0x80, 0x28, 0x26, 0x08, 0xa8, 0x7e, 0xcd, 0x35, 0x7f, 0x70, 0xf2, 0xc0, 0x81,
+    0x3f, 0xf9, 0x99, 0x27, 0xe9, 0x37, 0x3c, 0x74, 0x83, 0x32, 0x42, 0x47, 0xae, 0xb9, 0xcc, 0xbc,
+    0xec, 0x97, 0x8a, 0x41, 0xf1, 0x9d, 0x7d, 0x7c, 0xdf, 0xb8, 0x4c, 0x64, 0x7e, 0x2e, 0x9a, 0x6b,
+    0x2e, 0x44, 0x0b, 0xed, 0x12, 0x29, 0x19, 0x36, 0xb2, 0x7b, 0xdb, 0x1d, 0xc3, 0xa3, 0x19, 0x29,
+    0x12, 0xe3, 0xa1, 0x1f, 0xf2, 0xab, 0xdd, 0x92, 0x7f, 0xa8, 0x74, 0xc8, 0xfe, 0x66, 0xe9, 0x9b,
+    0x2b, 0xcf, 0x58, 0xcf, 0xd4, 0xe0, 0x58, 0x43, 0x38, 0xc4, 0xb5, 0x83, 0x04, 0xb0, 0x22, 0x97,
+    0x71, 0x75, 0x3c, 0xa3, 0x09, 0x9a, 0xd0, 0x88, 0x1a, 0x36, 0xdc, 0xd6, 0x11, 0x44, 0x8a, 0x10,
+    0x08, 0x09, 0xf2, 0x4f, 0xc2, 0x29, 0x65, 0x2a, 0x03, 0x39, 0xa4, 0x06, 0x4b, 0xf0, 0xa0, 0x94,
+    0x0a, 0xb8, 0x63, 0x8d, 0x46, 0x34, 0x15, 0x70, 0x61, 0x64, 0xaa, 0x66, 0xf3, 0x1d, 0x1f, 0x7d,
+    0xc7, 0xcc, 0xd7, 0x3f, 0xf9, 0xf5, 0x57, 0x2d, 0x1f, 0x3c, 0xeb, 0x04, 0xec, 0x76, 0x3f, 0x34,
+    0x28, 0x08, 0xc6, 0xed, 0x8a, 0xe2, 0xbc, 0x5b, 0xd7, 0xc9, 0x28, 0x63, 0x84, 0x61, 0x60, 0x67,
+    0x7d, 0x32, 0x82, 0x68, 0x0a, 0x1a, 0x45, 0xb1, 0x65, 0x21, 0xbb, 0x5a, 0x45, 0xcd, 0x4a, 0x05,
+    0x37, 0x41, 0xa5, 0xd0, 0xbb, 0xdf, 0x9d, 0x1b, 0xb8, 0xf5, 0xd6, 0x4c, 0x7a, 0xc7, 0x0e, 0x59,
+    0x4d, 0x24, 0x02, 0x20, 0x98, 0x81, 0x9a, 0xcd, 0x50, 0xd4, 0x75, 0x55, 0x53, 0x55, 0xdd, 0x97,
+    0x65, 0xdd, 0x08, 0x43, 0x2e, 0x30, 0x4d, 0x97, 0x6b, 0x36, 0x23, 0xbb, 0x5e, 0xa7, 0x1d, 0xb6,
+    0xae, 0xf5, 0xd5, 0x02, 0x98, 0xb6, 0xb1, 0xf5, 0x53, 0x9c, 0xcd, 0x0a, 0xf2, 0xce, 0x9d, 0x49,
+    0x2d, 0x9d, 0x96, 0x04, 0x36, 0xae, 0x54, 0x72, 0xe8, 0x91, 0x23, 0x0d, 0x01, 0xdc, 0xb1, 0x92,
+    0xc9, 0x28, 0x40, 0x6e, 0x21, 0x29, 0x49, 0x48, 0x07, 0xe5, 0x75, 0x09, 0x11, 0x4e, 0x1f, 0x3a,
+    0xf4, 0xc9, 0x12, 0x9b, 0xef, 0x67, 0x85, 0xdb, 0x1f, 0xb8, 0x9d, 0xbf, 0x72, 0xf0, 0xca, 0xeb,
+    0xe2, 0x46, 0xfc, 0x76, 0xec, 0xe2, 0xb7, 0x26, 0xf8, 0xc4, 0x60, 0x2f, 0xdf, 0x0b, 0x21, 0xdf,
+    0x8b, 0x96, 0xdb, 0x2c, 0x16, 0x48, 0x9c, 0xc4, 0xc7, 0x50, 0x4c, 0xe2, 0x29, 0xcf, 0x45, 0x90,
+    0xb3, 0xd1, 0x10, 0x71, 0xa7, 0x3a, 0xa7, 0xed, 0xc7, 0xeb, 0x8f, 0xd7, 0xbe, 0x55, 0xfb, 0xd6,
+    0xe2, 0x21, 0xfb, 0x50, 0xa3, 0x47, 0xbe, 0x57, 0x60, 0x42, 0x9c, 0xc8, 0x8e, 0xa9, 0x63, 0x7d,
+    0x29, 0x39, 0xa9, 0xc0, 0xa9, 0x25, 0x3e, 0xf2, 0x23, 0x45, 0x54, 0xf8, 0x84, 0x98, 0x90, 0x33,
+    0x42, 0x46, 0xbd, 0x25, 0x77, 0x4b, 0xdf, 0x75, 0x7d, 0xd7, 0x25, 0x60, 0x58, 0x2c, 0xdb, 0x65,
+    0x12, 0xd1, 0x88, 0x03, 0x55, 0x15, 0x43, 0x2e, 0xd4, 0x3c, 0xde, 0xeb, 0xd2, 0x18, 0x2d, 0xfd,
+    0xe0, 0x13, 0x3f, 0xf8, 0x99, 0x1e, 0xef, 0xff, 0x0e, 0xce, 0x2a, 0x01, 0xf7, 0xef, 0xa7, 0xa2,
+    0xe3, 0x34, 0xde, 0x6e, 0xdb, 0xd6, 0x7b, 0x64, 0xd9, 0xdf, 0x0a, 0xa4, 0xc0, 0x8d, 0x06, 0xee,
+    0x5a, 0x16, 0xe7, 0xae, 0xcf, 0xc2, 0x68, 0x42, 0x81, 0x7c, 0x5e, 0xa7, 0xc3, 0xdc, 0x2f, 0x82,
+    0xf1, 0x18, 0xdf, 0x72, 0x4b, 0xa2, 0xf8, 0xe6, 0x37, 0xe7, 0x52, 0xc5, 0x22, 0x0f, 0xc4, 0x33,
+    0xa3, 0x03, 0x07, 0x1a, 0xc6, 0x0f, 0x7f, 0xd8, 0x69, 0x80, 0x03, 0x8e, 0x74, 0x3d, 0xe9, 0x26,
+    0x93, 0x19, 0x48, 0x7d, 0xb0, 0x3b, 0x37, 0x67, 0xd9, 0x95, 0x4a, 0x68, 0xb6, 0x5a, 0xc8, 0x04,
+    0x53, 0x02, 0x09, 0xf5, 0x86, 0xfa, 0xf5, 0x7a, 0xeb, 0xa0, 0xb4, 0xdb, 0x8d, 0x88, 0xae, 0x0b,
+    0x52, 0x2c, 0x26, 0xe1, 0x6a, 0xd5, 0x0f, 0xf7, 0xef, 0x6f, 0xbb, 0xb3, 0xb3, 0x06, 0x07, 0x66,
+    0x44, 0x06, 0xb2, 0xcb, 0xb1, 0x98, 0x20, 0x83, 0x11, 0x11, 0x6c, 0xdb, 0x83, 0x8e, 0x2c, 0xec,
+    0xdd, 0xfb, 0xaf, 0x4f, 0x1d, 0x3c, 0xf8, 0x89, 0x9f, 0x99, 0x2a, 0x7c, 0xec, 0x0f, 0x3f, 0x36,
+    0xed, 0x9b, 0xfe, 0x1d, 0x1d, 0xb3, 0xf3, 0x16, 0x14, 0xa2, 0xe1, 0x90, 0x82, 0x9b, 0xf2, 0x1b,
+    0xdd, 0xc3, 0xfe, 0xe1, 0x65, 0x30, 0x07, 0xfe, 0x04, 0x3f, 0x91, 0xdb, 0xca, 0x6d, 0x1d, 0x1c,
+    0xc5, 0xa3, 0x39, 0x15, 0xa9, 0xc2, 0x12, 0x5d, 0xee, 0xae, 0x46, 0x2b, 0xc6, 0x9c, 0x3f, 0xdf,
+    0x01, 0x87, 0xdb, 0x35, 0x02, 0xc3, 0x85, 0x43, 0x3b, 0x13, 0x35, 0x36, 0x00, 0x9e, 0x0d, 0x4d,
+    0x8a, 0x93, 0xc5, 0x7e, 0xb5, 0x3f, 0x9b, 0x52, 0xd3, 0x72, 0x46, 0xc9, 0x28, 0x3a, 0xa7, 0x27,
+    0x03, 0x48, 0x83, 0x11, 0x58, 0x17, 0x55, 0x50, 0x85, 0x3d, 0xe9, 0x3d, 0xa9, 0xab, 0x07, 0xaf,
+    0xd6, 0xc6, 0x53, 0xe3, 0xbc, 0x1b, 0xb8, 0xe4, 0x84, 0x79, 0xc2, 0x61, 0x24, 0xe7, 0x30, 0xa7,
+    0x01, 0x09, 0x51, 0x24, 0x44, 0xf5, 0x77, 0xfd, 0xd1, 0xbb, 0x16, 0xbe, 0xf5, 0xc7, 0xdf, 0x3a,
+    0x23, 0x0a, 0xe7, 0x12, 0x67, 0x95, 0x80, 0x57, 0xed, 0x7b, 0xdf, 0x70, 0xb3, 0xda, 0x7e, 0xb7,
+    0x6d, 0xb3, 0xbc, 0x8f, 0x70, 0xa0, 0x52, 0xdd, 0x52, 0x49, 0x68, 0x46, 0x11, 0x64, 0x3d, 0x2f,
+    0x7b, 0x06, 0x03, 0xa7, 0x92, 0xfd, 0x31, 0x8b, 0x4b, 0x1c, 0x9a, 0x4e, 0xbb, 0x12, 0xc4, 0x0a,
+    0xfe, 0xc4, 0x89, 0xa6, 0xf3, 0xc3, 0x1f, 0x56, 0x3a, 0x4f, 0x3d, 0x65, 0xdb, 0xed, 0xb6, 0xa4,
+    0xa4, 0xd3, 0x3a, 0xea, 0xef, 0xcf, 0x05, 0x3c, 0x2f, 0xd0, 0x85, 0x05, 0xd3, 0x5d, 0x59, 0x71,
+    0x1d, 0xdf, 0x47, 0x60, 0x4b, 0xd8, 0xc5, 0x79, 0x29, 0xeb, 0x5e, 0x4a, 0x41, 0x8c, 0x2c, 0x8b,
+    0x90, 0xd9, 0xd9, 0xc0, 0x3d, 0x79, 0xd2, 0x75, 0x9e, 0x7a, 0xca, 0xe8, 0x3c, 0xf1, 0x84, 0xd3,
+    0x06, 0xb5, 0xc0, 0xaa, 0x8a, 0x65, 0x59, 0x96, 0x04, 0x30, 0x38, 0x28, 0x8a, 0x02, 0x50, 0x6b,
+    0x9f, 0x80, 0x9a, 0xd6, 0x79, 0x5e, 0x9c, 0x3b, 0x76, 0xec, 0x67, 0xe3, 0x88, 0xef, 0xda, 0x7f,
+    0x97, 0xa8, 0x84, 0xca, 0x4d, 0x25, 0xb3, 0x74, 0x4b, 0xc7, 0xe9, 0x6c, 0xb3, 0x7c, 0x8b, 0x07,
+    0xd3, 0x11, 0x74, 0x69, 0xa7, 0x3b, 0x1b, 0xcd, 0x35, 0x36, 0x09, 0x9b, 0x72, 0x5b, 0xa4, 0x2d,
+    0x43, 0x05, 0x54, 0xc8, 0x4a, 0x54, 0x52, 0x3d, 0xc8, 0x22, 0xaa, 0x61, 0xd5, 0xf1, 0x22, 0x8f,
+    0x44, 0xe0, 0xf1, 0x21, 0x5c, 0x06, 0x70, 0x68, 0x2f, 0xbb, 0xa5, 0x5e, 0x8a, 0x22, 0x57, 0x4c,
+    0xe4, 0xe4, 0x8c, 0x9e, 0x50, 0x12, 0x92, 0x1e, 0x4f, 0x72, 0x60, 0x5e, 0x34, 0x31, 0x12, 0x15,
+    0x70, 0xc6, 0x4e, 0xc4, 0x47, 0x91, 0x48, 0x45, 0x79, 0x5c, 0x1f, 0xd7, 0xc6, 0xb3, 0xe3, 0xbc,
+    0xc6, 0x6b, 0x78, 0xae, 0x35, 0x67, 0x2f, 0xda, 0x4b, 0xb6, 0x40, 0x78, 0xce, 0x25, 0xae, 0x6c,
+    0x20, 0x83, 0x3d, 0x39, 0xa9, 0x3d, 0x72, 0xef, 0x23, 0x4b, 0xf7, 0xdc, 0x73, 0xcf, 0xfa, 0x5a,
+    0xcf, 0x1d, 0xce, 0x6e, 0x08, 0x4e, 0xfe, 0xca, 0x96, 0xea, 0x72, 0xfd, 0x6d, 0x9d, 0x4e, 0x38,
+    0xd6, 0x6a, 0x0a, 0xad, 0x95, 0x15, 0xa1, 0x06, 0x6a, 0xe7, 0x72, 0x5c, 0xc8, 0x41, 0xb4, 0xe8,
+    0x85, 0x5f, 0xb8, 0xf8, 0x40, 0x3b, 0x36, 0x73, 0x84, 0x3d, 0xcf, 0x8c, 0x9a, 0x4d, 0xc3, 0x3e,
+    0x7e, 0xbc, 0xd3, 0x99, 0x9d, 0x35, 0xc3, 0xc5, 0x45, 0x9f, 0xeb, 0x76, 0x05, 0xb5, 0xd5, 0xe2,
+    0x92, 0x89, 0x84, 0xa2, 0x0d, 0x0e, 0xa6, 0xdc, 0x74, 0x5a, 0xa5, 0xf5, 0xba, 0x1b, 0x9e, 0x3c,
+    0x69, 0x38, 0x70, 0x79, 0x00, 0xec, 0xe2, 0xbc, 0x78, 0x7d, 0x7a, 0x63, 0x7a, 0xfd, 0xde, 0xcf,
+    0x1e, 0xd8, 0xb6, 0x20, 0x3f, 0x44, 0xe5, 0x32, 0xf5, 0x2a, 0x15, 0xf6, 0xb4, 0x84, 0x86, 0xbe,
+    0xcf, 0x47, 0xf1, 0xb8, 0x08, 0x49, 0x11, 0x27, 0xc3, 0x1c, 0xd8, 0xf7, 0x83, 0x00, 0x42, 0xbc,
+    0x59, 0xad, 0x86, 0x81, 0x2c, 0x8b, 0x95, 0xfe, 0xfe, 0x7f, 0x39, 0xb3, 0xb0, 0x70, 0xef, 0x3f,
+    0x0a, 0x79, 0xff, 0xbb, 0xe0, 0x7e, 0x9b, 0x2b, 0x38, 0x1d, 0xe7, 0x9a, 0x8a, 0x59, 0xb9, 0x1a,
+    0xc8, 0x10, 0xbb, 0x4c, 0xbf, 0x4c, 0xda, 0x91, 0xd8, 0x21, 0xf6, 0x4b, 0x03, 0x92, 0xea, 0xab,
+    0x71, 0x15, 0xab, 0xa9, 0x0c, 0x97, 0x49, 0x02, 0xd1, 0x94, 0x96, 0xd7, 0x22, 0xf3, 0xe1, 0x7c,
+    0xb3, 0x1e, 0xd6, 0x0d, 0x04, 0x2e, 0x1e, 0x0e, 0xe5, 0x9f, 0x24, 0x1f, 0x03, 0x9c, 0xc5, 0x28,
+    0x81, 0x75, 0x99, 0x99, 0x95, 0x64, 0x3c, 0x15, 0xe9, 0x31, 0x9d, 0x87, 0x25, 0x14, 0xdf, 0xf3,
+    0x69, 0x33, 0x6a, 0x1a, 0x1d, 0xda, 0xa1, 0x12, 0x91, 0xa4, 0x9c, 0x9a, 0xe3, 0x21, 0x34, 0xd3,
+    0xba, 0x59, 0x0f, 0x9e, 0xe8, 0x3e, 0x51, 0x0e, 0x82, 0x20, 0xec, 0x06, 0x5d, 0x52, 0xf7, 0xea,
+    0x3e, 0xa8, 0x70, 0xfd, 0xc1, 0xf6, 0x83, 0x8b, 0x47, 0xef, 0x3b, 0x7a, 0xce, 0x55, 0xf0, 0xac,
+    0x11, 0xf0, 0xee, 0xbb, 0x1f, 0x12, 0xa8, 0xab, 0x5e, 0x7f, 0xe4, 0x50, 0xe3, 0xd6, 0xf9, 0x39,
+    0x3f, 0xde, 0x6a, 0x51, 0xcb, 0x71, 0x42, 0x38, 0x15, 0x9e, 0x9a, 0xcf, 0x07, 0x59, 0x41, 0x08,
+    0xe4, 0x66, 0x13, 0xf4, 0x0b, 0x41, 0x16, 0xcd, 0x85, 0x10, 0x06, 0x3d, 0x25, 0x9f, 0xf7, 0xf5,
+    0x89, 0x09, 0xa1, 0xb0, 0x75, 0x6b, 0x62, 0x68, 0x68, 0x28, 0x91, 0xe3, 0x38, 0x29, 0x75, 0xea,
+    0x94, 0x1b, 0x17, 0x45, 0x5e, 0xce, 0x64, 0x64, 0xb7, 0x50, 0x88, 0x83, 0x96, 0x21, 0x3a, 0x33,
+    0xd3, 0x75, 0xda, 0xed, 0x20, 0x5c, 0x23, 0xdf, 0x8b, 0x78, 0x25, 0xf9, 0x36, 0xfa, 0xc0, 0x70,
+    0x1a, 0x81, 0x4d, 0x86, 0xdf, 0xa0, 0x76, 0x3c, 0x8c, 0xe5, 0x08, 0x0b, 0xd9, 0xb2, 0xcc, 0x09,
+    0x22, 0xb0, 0x82, 0x10, 0x9f, 0x76, 0x3a, 0x91, 0x59, 0x2e, 0x93, 0xb6, 0x69, 0xc2, 0x4c, 0x02,
+    0x32, 0xb3, 0x59, 0x7d, 0xe6, 0xe8, 0xd1, 0x4f, 0xb4, 0xd7, 0xd6, 0xf0, 0x53, 0x82, 0x22, 0x3c,
+    0x3c, 0x37, 0x3c, 0xbd, 0xda, 0x59, 0xdd, 0x6b, 0xfb, 0xf6, 0xf8, 0x2d, 0x85, 0x5b, 0x32, 0xaf,
+    0x1d, 0x78, 0xad, 0xba, 0x39, 0xbd, 0x59, 0xd0, 0xb1, 0x2e, 0x3a, 0x86, 0xa3, 0xce, 0x1b, 0xf3,
+    0x8a, 0x1b, 0x3a, 0x7c, 0xc3, 0x6b, 0x38, 0x0b, 0xc1, 0x42, 0x35, 0xe2, 0x22, 0xf3, 0x26, 0xfd,
+    0xa6, 0xcc, 0x15, 0xea, 0x15, 0x29, 0x8d, 0x68, 0x42, 0x29, 0x2c, 0xd9, 0x40, 0xb2, 0x97, 0x1d,
+    0xe7, 0x4b, 0xe1, 0x20, 0x27, 0x30, 0x42, 0xc3, 0x0e, 0xa2, 0x20, 0x18, 0x4e, 0x0e, 0x0b, 0x85,
+    0x74, 0x81, 0x87, 0xd3, 0xc0, 0x1b, 0x8e, 0x41, 0x2a, 0x6e, 0xc5, 0x08, 0x70, 0x10, 0xae, 0xf8,
+    0x2b, 0xe0, 0xff, 0x7c, 0x64, 0x3a, 0x26, 0x62, 0x79, 0xe0, 0xa2, 0xb7, 0x68, 0x55, 0x69, 0xd5,
+    0xa8, 0xfb, 0x75, 0x0b, 0x96, 0xe5, 0x43, 0x12, 0x9a, 0x44, 0x21, 0xd5, 0xf9, 0x4f, 0xcf, 0x97,
+    0xd1, 0x39, 0x16, 0xc1, 0xb3, 0x46, 0xc0, 0xbd, 0x6f, 0xf9, 0x63, 0x95, 0xb3, 0x9c, 0x1b, 0x7c,
+    0x3f, 0xbc, 0x4e, 0xd3, 0x24, 0x54, 0x2c, 0x4a, 0xa4, 0x58, 0x14, 0xc5, 0xb1, 0x31, 0x29, 0x35,
+    0x36, 0x26, 0x66, 0xd3, 0x69, 0x4e, 0x83, 0x0b, 0xcd, 0xf3, 0x7c, 0x00, 0x2e, 0xd6, 0x4a, 0x68,
+    0x5a, 0x90, 0xcb, 0xe5, 0xa4, 0x4c, 0x3e, 0xaf, 0xe9, 0x3c, 0xcf, 0xc5, 0x4e, 0x9e, 0xf4, 0xe4,
+    0xc3, 0x87, 0x6d, 0x9e, 0x85, 0xe5, 0x78, 0x9c, 0xa3, 0x60, 0x16, 0xba, 0xba, 0x2e, 0x7b, 0xdd,
+    0x6e, 0x10, 0xcd, 0xcd, 0x99, 0x2e, 0x53, 0xbf, 0xb5, 0x2d, 0xfd, 0xd8, 0x6b, 0xb3, 0x0e, 0x36,
+    0x9d, 0x49, 0x6c, 0x44, 0x43, 0x56, 0x8b, 0x01, 0x21, 0x11, 0x12, 0x20, 0x20, 0x2f, 0x47, 0x5d,
+    0x97, 0x80, 0x10, 0x90, 0xc0, 0x30, 0x22, 0xa7, 0x5e, 0x27, 0xdd, 0x76, 0x1b, 0x5b, 0x30, 0x9e,
+    0xcd, 0xcc, 0x69, 0x1a, 0xbf, 0x7c, 0xe7, 0x9d, 0xff, 0x65, 0xf6, 0xe1, 0x87, 0xef, 0xf9, 0x49,
+    0x1b, 0xf8, 0xb1, 0x98, 0xfc, 0xe5, 0x49, 0x39, 0x61, 0x24, 0x76, 0x82, 0x02, 0x5e, 0x3b, 0x2e,
+    0x8d, 0x8f, 0xbc, 0x69, 0xf8, 0x4d, 0x99, 0x9d, 0xc5, 0x9d, 0xb2, 0x26, 0x6a, 0x5c, 0xe8, 0x85,
+    0x5c, 0xa9, 0x55, 0xc2, 0x4f, 0x37, 0x9e, 0x36, 0x4e, 0x7b, 0x33, 0x95, 0x12, 0x2d, 0x95, 0x34,
+    0x49, 0xb3, 0xee, 0x1a, 0xbf, 0x6b, 0xe8, 0xa6, 0x91, 0x9b, 0xb2, 0xdb, 0x33, 0xdb, 0x93, 0x05,
+    0xae, 0x10, 0x6f, 0xda, 0x4d, 0x6f, 0x25, 0x5a, 0xb1, 0xd6, 0x57, 0x79, 0x06, 0x1a, 0xd6, 0x04,
+    0x11, 0x8b, 0xcc, 0xb0, 0x50, 0x9b, 0xda, 0x81, 0x15, 0x59, 0xde, 0xee, 0xec, 0xee, 0xd4, 0xc4,
+    0xc0, 0x84, 0x00, 0xf9, 0x1d, 0x29, 0x75, 0x4b, 0xde, 0x61, 0xf3, 0x70, 0x35, 0xa0, 0x41, 0xc8,
+    0x32, 0x9c, 0x19, 0x7f, 0xc6, 0x6a, 0xdb, 0x6d, 0x0e, 0x42, 0xbb, 0x12, 0x17, 0xe2, 0x9a, 0x87,
+    0x3c, 0xdf, 0x26, 0x36, 0x53, 0x58, 0x36, 0xbf, 0x10, 0x53, 0x62, 0xcd, 0x5d, 0xd1, 0xae, 0xa5,
+    0x13, 0xf7, 0x9e, 0x38, 0x93, 0x9f, 0x9f, 0x0b, 0x9c, 0xb5, 0x82, 0xc8, 0xfd, 0x5f, 0xe7, 0xb0,
+    0x02, 0x9a, 0x3f, 0x3c, 0x94, 0xc6, 0x9b, 0x37, 0xe7, 0xdd, 0x81, 0x81, 0x8c, 0x5b, 0x2c, 0xea,
+    0x5e, 0x26, 0x93, 0x70, 0x40, 0xc9, 0x82, 0xb1, 0xb1, 0x24, 0xde, 0xb2, 0x25, 0x8d, 0xb7, 0x6f,
+    0x4f, 0x47, 0xbb, 0x76, 0x25, 0xc3, 0x42, 0x21, 0x66, 0xb5, 0xdb, 0x91, 0xf3, 0xd8, 0x63, 0xed,
+    0xe8, 0x8b, 0x5f, 0x6c, 0xe0, 0x67, 0x9f, 0x35, 0x91, 0x0d, 0xe7, 0x07, 0x9c, 0x29, 0x74, 0xec,
+    0x89, 0x07, 0xf1, 0x5d, 0x37, 0x24, 0x10, 0x7e, 0x03, 0xcf, 0x03, 0x6f, 0xfb, 0x13, 0x42, 0xef,
+    0xfa, 0x2f, 0xe8, 0xe3, 0x8d, 0x99, 0x20, 0xef, 0x24, 0xa1, 0xa2, 0x04, 0x8a, 0xae, 0xd3, 0x14,
+    0x33, 0x1d, 0x60, 0x64, 0xfc, 0x95, 0x15, 0xda, 0x9c, 0x9b, 0x23, 0x95, 0x5a, 0x0d, 0x75, 0x29,
+    0x15, 0x28, 0xe4, 0x97, 0x5c, 0x14, 0xf1, 0x7d, 0x40, 0xd6, 0xcd, 0xf3, 0xf3, 0x6d, 0x7d, 0x7d,
+    0xd9, 0x9f, 0x0a, 0x49, 0x3e, 0xa9, 0x80, 0x32, 0xa5, 0x21, 0xe7, 0x4b, 0xc7, 0xb9, 0xb8, 0x08,
+    0x39, 0x18, 0xaf, 0x48, 0x0a, 0x86, 0xbb, 0x0e, 0x81, 0x11, 0xa1, 0x1e, 0xf1, 0xdc, 0x5a, 0x58,
+    0x5b, 0x6c, 0x90, 0xc6, 0x22, 0xc7, 0x71, 0x9d, 0x37, 0xf6, 0xbf, 0x31, 0x73, 0xed, 0xc4, 0xb5,
+    0x89, 0xcb, 0x47, 0x2f, 0x57, 0xa7, 0x0b, 0xd3, 0x4c, 0x29, 0xe3, 0xbb, 0xb4, 0x5d, 0x79, 0x56,
+    0xd1, 0x6c, 0x7d, 0x95, 0x48, 0xe1, 0x14, 0xfe, 0xce, 0xec, 0x9d, 0x13, 0x1f, 0x1b, 0xff, 0xd8,
+    0xee, 0xdf, 0x1d, 0xfc, 0xdd, 0x5d, 0x6f, 0xd0, 0xde, 0x30, 0xc4, 0xd2, 0x67, 0xc8, 0x1d, 0x23,
+    0x81, 0x13, 0x10, 0x84, 0x60, 0x3c, 0x98, 0x1b, 0x24, 0x23, 0xe9, 0x11, 0xcc, 0xb6, 0x07, 0x2a,
+    0x67, 0x9b, 0x81, 0xe9, 0xb9, 0x91, 0x1b, 0x42, 0x68, 0x77, 0x81, 0x6c, 0x7c, 0x4e, 0xca, 0xe9,
+    0x23, 0xf2, 0x48, 0x3e, 0x29, 0x26, 0x65, 0x59, 0x90, 0x59, 0x4e, 0x3a, 0xe8, 0x5a, 0xee, 0xb4,
+    0xd7, 0xf1, 0xc6, 0xe1, 0x94, 0xbd, 0x2c, 0x3b, 0x3f, 0xdb, 0x38, 0x6b, 0x04, 0xfc, 0xc0, 0x07,
+    0x88, 0x36, 0x39, 0xa9, 0x0e, 0x8c, 0x8d, 0xc5, 0xc1, 0xcd, 0x2a, 0xba, 0x20, 0xc0, 0x59, 0x87,
+    0x63, 0x03, 0xf2, 0x78, 0x86, 0x41, 0xbb, 0x9e, 0x47, 0x1d, 0xb8, 0x10, 0x10, 0x06, 0xa5, 0x28,
+    0x95, 0x62, 0x84, 0x4c, 0xdb, 0x5b, 0xb6, 0xe4, 0xdb, 0xdb, 0xb6, 0x25, 0x9b, 0x9b, 0x36, 0x49,
+    0xec, 0x9d, 0x0e, 0x08, 0x93, 0x90, 0x08, 0x81, 0xa1, 0xf3, 0xbc, 0x28, 0x82, 0xe5, 0x7c, 0xc3,
+    0xf0, 0xa2, 0x76, 0xdb, 0x5b, 0x0f, 0xbd, 0x1b, 0xbc, 0xfa, 0x71, 0x58, 0x9b, 0x5e, 0x28, 0x60,
+    0xf5, 0xfa, 0xeb, 0xc5, 0xc2, 0xf5, 0xd7, 0xcb, 0xf9, 0x5c, 0x0e, 0xc1, 0xc5, 0x47, 0x34, 0x91,
+    0xc0, 0xc9, 0xc1, 0x41, 0xb9, 0xa0, 0xeb, 0x38, 0x06, 0xb3, 0x80, 0xf1, 0x59, 0xbb, 0xc4, 0xcc,
+    0x08, 0xb1, 0xf2, 0x43, 0x08, 0xf3, 0x71, 0xd8, 0xe6, 0x26, 0x84, 0xec, 0xbe, 0xde, 0x4a, 0x7e,
+    0x4a, 0x04, 0x46, 0x20, 0x43, 0xe8, 0x8f, 0x41, 0x58, 0x95, 0xcb, 0x7e, 0xd9, 0x5b, 0xe9, 0xae,
+    0x90, 0x6a, 0xb7, 0x8a, 0x9a, 0x56, 0x13, 0x2d, 0x76, 0x17, 0xa3, 0x19, 0x6b, 0xc6, 0xa8, 0x92,
+    0x6a, 0x4d, 0x17, 0x75, 0x0a, 0x0e, 0x56, 0x9e, 0xce, 0x4c, 0x27, 0x46, 0xb2, 0x23, 0x62, 0x12,
+    0xcc, 0x84, 0xa2, 0x28, 0x48, 0x93, 0x35, 0x2c, 0xf3, 0x32, 0x58, 0xd6, 0x17, 0x2f, 0xd3, 0xdb,
+    0xf3, 0x6f, 0x1f, 0xfd, 0x95, 0xed, 0xbf, 0x32, 0xfc, 0xe6, 0x2d, 0x6f, 0xce, 0xbe, 0x61, 0xec,
+    0x0d, 0xb9, 0x37, 0xe5, 0xdf, 0x34, 0x3c, 0x2d, 0x4e, 0x27, 0xd9, 0x34, 0x11, 0x34, 0x91, 0x2d,
+    0x93, 0x49, 0x66, 0xf8, 0xf1, 0xfc, 0x78, 0xfc, 0xfa, 0xcc, 0xf5, 0x63, 0xa0, 0x92, 0x7c, 0xd7,
+    0xef, 0x3a, 0x41, 0x18, 0x44, 0x6d, 0xda, 0x36, 0xdb, 0x51, 0xdb, 0x84, 0x59, 0x49, 0x4a, 0x4c,
+    0xc5, 0xa6, 0x94, 0xa9, 0xec, 0xe5, 0xda, 0xe5, 0x99, 0x02, 0x5f, 0x48, 0x3a, 0x8e, 0x33, 0x15,
+    0x39, 0xd1, 0xf4, 0x2f, 0x9f, 0xfa, 0xe5, 0x04, 0x5b, 0xd7, 0xb9, 0xc2, 0x59, 0x23, 0xe0, 0xf4,
+    0x74, 0x82, 0x8b, 0xc7, 0x05, 0x3e, 0x1e, 0xc7, 0x90, 0xbf, 0x61, 0x7d, 0x74, 0x54, 0x4c, 0xb1,
+    0xf2, 0x38, 0x46, 0xc2, 0x6e, 0x17, 0x5b, 0xad, 0x16, 0xee, 0x06, 0x41, 0xaf, 0xaa, 0x14, 0xcc,
+    0xcd, 0x03, 0x01, 0x30, 0x82, 0x50, 0x1d, 0x8d, 0x8f, 0xa7, 0x9c, 0x6b, 0xaf, 0xcd, 0x77, 0xf6,
+    0xee, 0x8d, 0xb5, 0x44, 0x91, 0x84, 0x40, 0x3c, 0xe4, 0x38, 0x11, 0x31, 0xcd, 0x20, 0x60, 0xe4,
+    0xb3, 0x6d, 0x72, 0xa6, 0xb8, 0x65, 0x03, 0xaf, 0x54, 0x3f, 0x4d, 0xe3, 0x94, 0xfe, 0x7e, 0x29,
+    0x33, 0x3d, 0x2d, 0xe7, 0xee, 0xb8, 0x23, 0x35, 0xf8, 0xae, 0x77, 0x15, 0xfa, 0xde, 0xfd, 0xee,
+    0xe2, 0xc0, 0x3b, 0xde, 0x91, 0xee, 0x87, 0x50, 0x6c, 0xb3, 0x6a, 0xfc, 0xb2, 0x1c, 0xa6, 0x60,
+    0xbf, 0x0a, 0xaa, 0x8a, 0x74, 0x8e, 0xe3, 0x45, 0x51, 0x14, 0x64, 0xd8, 0x1e, 0xdc, 0x28, 0x11,
+    0x2b, 0x13, 0x4c, 0xe6, 0x72, 0xfc, 0xd6, 0x6d, 0xdb, 0xf8, 0xa9, 0xb5, 0x35, 0xfe, 0x74, 0x00,
+    0x75, 0xe1, 0xa4, 0x48, 0x92, 0x55, 0xa4, 0x2a, 0x2b, 0xde, 0x4a, 0xf8, 0xf0, 0xca, 0xc3, 0xe1,
+    0xf7, 0x67, 0xbe, 0x8f, 0x7e, 0xb8, 0xf0, 0x10, 0x7d, 0xac, 0xfa, 0xa8, 0x77, 0xc0, 0x7e, 0xae,
+    0x9d, 0x94, 0x41, 0x87, 0x94, 0xa4, 0x12, 0x13, 0x63, 0x62, 0xef, 0xbe, 0x82, 0xd3, 0xc1, 0x08,
+    0xc7, 0xec, 0x2f, 0x98, 0x84, 0xa0, 0xe4, 0x95, 0xcc, 0x28, 0x8c, 0x58, 0x21, 0x0c, 0xed, 0xe3,
+    0xfb, 0xd4, 0x9b, 0x87, 0x6f, 0x2e, 0x5e, 0x36, 0x7c, 0x99, 0x3a, 0x9c, 0x1f, 0x16, 0x07, 0xd2,
+    0x03, 0xe2, 0x50, 0x72, 0x48, 0x19, 0x13, 0xc7, 0x92, 0x32, 0x27, 0x73, 0x8c, 0x80, 0xa0, 0x70,
+    0x10, 0x53, 0x05, 0xac, 0x6b, 0xba, 0x32, 0x96, 0x1e, 0x4b, 0x5f, 0x13, 0xbb, 0x66, 0x0c, 0xdc,
+    0x6e, 0x68, 0x07, 0x90, 0x85, 0x46, 0x76, 0x08, 0xe1, 0xbc, 0x51, 0x0b, 0x6a, 0x1d, 0x08, 0xc5,
+    0x2e, 0x98, 0x21, 0xfd, 0xf6, 0x91, 0xdb, 0xfb, 0xde, 0x3f, 0xfa, 0xfe, 0x21, 0x70, 0xe3, 0x53,
+    0xa1, 0x1d, 0x6e, 0x49, 0xfa, 0xc9, 0x89, 0xf5, 0xdd, 0x3f, 0x27, 0x38, 0x6b, 0x04, 0xa4, 0xd4,
+    0x65, 0x8f, 0xc5, 0x58, 0x05, 0x02, 0x5b, 0xd7, 0x89, 0xb8, 0x7b, 0x37, 0x4e, 0xde, 0x78, 0xa3,
+    0x92, 0xdb, 0xb1, 0x43, 0x49, 0xf0, 0x3c, 0x46, 0x92, 0x84, 0xe9, 0x8e, 0x1d, 0x52, 0x7c, 0xc7,
+    0x0e, 0x39, 0x11, 0x8b, 0x09, 0x3c, 0xa8, 0x0e, 0xf3, 0x0a, 0x38, 0x91, 0x10, 0xf8, 0xc1, 0xc1,
+    0x38, 0xd9, 0xb9, 0x33, 0x63, 0x5e, 0x7e, 0x79, 0xac, 0x05, 0x8a, 0x15, 0xf8, 0x3e, 0xa5, 0xac,
+    0xaa, 0x15, 0xe4, 0x7f, 0x10, 0x19, 0x61, 0xce, 0x97, 0xe0, 0x47, 0x90, 0x4f, 0x1e, 0x1d, 0x55,
+    0x8a, 0x13, 0x13, 0x5a, 0xdf, 0xd5, 0x57, 0xeb, 0xfd, 0x57, 0x5c, 0x91, 0xd2, 0x37, 0x6f, 0xce,
+    0xc8, 0x53, 0x53, 0x59, 0xf9, 0x8a, 0x2b, 0xb2, 0x89, 0x4d, 0x9b, 0x44, 0xa9, 0x56, 0x73, 0x1a,
+    0x86, 0xe1, 0x32, 0x5d, 0xd5, 0x09, 0x71, 0x0a, 0xb0, 0xf6, 0x02, 0x18, 0x91, 0x1c, 0x98, 0xce,
+    0x3c, 0x28, 0x6f, 0xb6, 0x50, 0x10, 0x32, 0xc5, 0x22, 0x37, 0x5a, 0x28, 0xa0, 0x89, 0x07, 0x1e,
+    0xa0, 0x3f, 0x75, 0x9e, 0xcc, 0x11, 0x8e, 0x6e, 0xe7, 0xb6, 0xc7, 0x27, 0xf1, 0x64, 0x61, 0x1c,
+    0x8d, 0x0f, 0x1e, 0x6c, 0xbe, 0x20, 0xfc, 0xdd, 0xd2, 0x57, 0xd1, 0x57, 0xcb, 0x5f, 0x25, 0x4f,
+    0x3a, 0x4f, 0x7a, 0x91, 0x12, 0x45, 0xba, 0xaa, 0xcb, 0x71, 0x25, 0x2e, 0x61, 0xc8, 0x76, 0x4f,
+    0x34, 0x4f, 0x98, 0xc7, 0x57, 0x8f, 0xbb, 0x0b, 0xf5, 0x05, 0x7f, 0xa6, 0x31, 0xe3, 0x1c, 0xad,
+    0x1e, 0x35, 0x9e, 0x30, 0x9e, 0x28, 0x31, 0xf2, 0x81, 0x2b, 0x46, 0x43, 0xe2, 0x90, 0xda, 0xa7,
+    0xf7, 0x89, 0x19, 0x3d, 0xc3, 0xc9, 0x92, 0x8c, 0x44, 0x49, 0xa4, 0xc0, 0x38, 0xe6, 0x84, 0x49,
+    0x82, 0x4b, 0x88, 0xac, 0x8e, 0xa0, 0xe3, 0x3b, 0xd4, 0xb0, 0x0d, 0xec, 0x47, 0x3e, 0x0f, 0x6a,
+    0xa8, 0x0e, 0xc5, 0x86, 0x0a, 0xdb, 0xe4, 0x6d, 0x83, 0x5e, 0xe8, 0x45, 0x7e, 0xe8, 0x47, 0x46,
+    0x64, 0xb8, 0x73, 0xde, 0x5c, 0x15, 0x8c, 0x48, 0x13, 0xf2, 0xc3, 0x00, 0x48, 0x2a, 0xed, 0x1b,
+    0xd9, 0x97, 0x78, 0xc7, 0xf0, 0x3b, 0x46, 0xf3, 0x24, 0x7f, 0x59, 0xc7, 0xea, 0x4c, 0xfd, 0x49,
+    0xe9, 0x4f, 0x58, 0x64, 0x38, 0x27, 0x38, 0x6b, 0x26, 0xe4, 0x2f, 0xff, 0xf2, 0xe3, 0xe1, 0xf3,
+    0xcf, 0xdb, 0xc3, 0xcd, 0x66, 0xb0, 0x5d, 0x14, 0x83, 0x74, 0xa1, 0xe0, 0x8b, 0xf9, 0x7c, 0x28,
+    0x25, 0x93, 0x82, 0x10, 0x86, 0x1c, 0xe1, 0x79, 0xc2, 0xed, 0xdc, 0x49, 0xd2, 0x13, 0x13, 0xbc,
+    0x96, 0x48, 0x88, 0x3c, 0xb8, 0xe4, 0x40, 0x51, 0x28, 0xbf, 0x73, 0xa7, 0x90, 0x1c, 0x1f, 0x17,
+    0x35, 0x51, 0xe4, 0x58, 0xd9, 0x9e, 0x0b, 0xb9, 0x5a, 0x04, 0x06, 0x44, 0x96, 0x24, 0xce, 0x05,
+    0x35, 0x04, 0x32, 0x72, 0x67, 0xec, 0xc7, 0x8f, 0x42, 0xb1, 0x28, 0xa4, 0xfb, 0xfb, 0xe5, 0x2c,
+    0x10, 0x59, 0xdd, 0xb4, 0x49, 0x11, 0x20, 0xc7, 0x04, 0x25, 0x56, 0x81, 0xf0, 0x22, 0x7b, 0x04,
+    0x47, 0x8f, 0x1c, 0xe9, 0x58, 0x27, 0x4e, 0x38, 0xad, 0xf5, 0x75, 0x40, 0x88, 0x0c, 0x12, 0x8e,
+    0xe3, 0x69, 0xbe, 0xef, 0x69, 0xe0, 0x8c, 0x45, 0x49, 0x92, 0x7d, 0xd8, 0x1e, 0x49, 0x24, 0xf8,
+    0x10, 0xba, 0x43, 0x08, 0xd5, 0x9f, 0xfe, 0xbb, 0xbf, 0xfb, 0xe9, 0x8a, 0x63, 0xee, 0xf8, 0xbf,
+    0xee, 0x90, 0x73, 0x7e, 0x6e, 0x8f, 0xe8, 0x8b, 0xaf, 0xd1, 0x90, 0x56, 0xf4, 0x02, 0x4f, 0xac,
+    0xfa, 0x55, 0xea, 0x63, 0x0f, 0x0b, 0xbc, 0xc0, 0xaa, 0x62, 0x84, 0x10, 0xf1, 0x7d, 0x55, 0x52,
+    0x7b, 0x65, 0x51, 0xa7, 0x5a, 0xa7, 0xba, 0x8d, 0x56, 0x23, 0x5c, 0x6d, 0xac, 0x86, 0xfb, 0x57,
+    0xf6, 0x77, 0xbe, 0x52, 0xfa, 0xca, 0xdc, 0xbc, 0x3f, 0xcf, 0x42, 0x66, 0x0f, 0x90, 0x47, 0x4a,
+    0xd7, 0xf5, 0x5f, 0x97, 0x1f, 0xc9, 0x8c, 0xc8, 0x40, 0x36, 0xae, 0xd6, 0xad, 0x45, 0x47, 0xca,
+    0x47, 0xac, 0x6f, 0xd7, 0xbf, 0xbd, 0x94, 0x92, 0x53, 0xd2, 0xd6, 0xdc, 0xd6, 0x84, 0xa6, 0x68,
+    0xbc, 0xed, 0xd9, 0x22, 0x18, 0x0e, 0xc5, 0xf0, 0x0d, 0x1e, 0x72, 0x3f, 0x01, 0xd4, 0x54, 0x82,
+    0x10, 0x1c, 0xba, 0x60, 0xbb, 0x40, 0x25, 0x59, 0x55, 0xfe, 0x08, 0xd4, 0xb0, 0xa7, 0x88, 0x9b,
+    0x63, 0x9b, 0xe3, 0xe3, 0x99, 0x71, 0x09, 0x54, 0x58, 0xe8, 0x9a, 0x5d, 0xe9, 0x88, 0x75, 0x64,
+    0x66, 0x16, 0xcf, 0xce, 0xce, 0xfc, 0xd7, 0x99, 0xee, 0xfa, 0x66, 0xcf, 0x2a, 0xce, 0x9a, 0x02,
+    0xc2, 0x09, 0x8d, 0x80, 0x44, 0x27, 0x83, 0x80, 0x3b, 0x5e, 0x2a, 0x71, 0xad, 0x85, 0x05, 0xdf,
+    0xae, 0xd5, 0x5a, 0x44, 0x14, 0xdb, 0xf2, 0xc8, 0x48, 0x14, 0x17, 0x04, 0xcc, 0x35, 0x9b, 0x26,
+    0xf1, 0xfd, 0xba, 0xd8, 0xd7, 0x67, 0xc6, 0xa7, 0xa6, 0x20, 0x4b, 0x17, 0xa9, 0x20, 0xcb, 0x86,
+    0x9c, 0xcb, 0x19, 0xf1, 0xed, 0xdb, 0x71, 0x72, 0x7a, 0x3a, 0x26, 0x4f, 0x4f, 0xa7, 0xec, 0x4d,
+    0x9b, 0xe2, 0x5e, 0xb1, 0x28, 0x03, 0x89, 0xa5, 0x8c, 0x2c, 0xe3, 0x33, 0xd5, 0xb7, 0x5e, 0xa9,
+    0x7e, 0xb0, 0x4d, 0xcc, 0xa6, 0x0b, 0x02, 0x15, 0x58, 0x8d, 0x19, 0x30, 0x2f, 0x70, 0x99, 0x78,
+    0x36, 0xbe, 0xd7, 0x79, 0x1e, 0x17, 0x75, 0xbb, 0x90, 0xfd, 0x83, 0x31, 0xe9, 0x74, 0x82, 0xa6,
+    0xe3, 0x04, 0x6d, 0x20, 0x7f, 0x98, 0xc9, 0xc8, 0xb0, 0x0c, 0x96, 0xc0, 0x01, 0x07, 0x84, 0x28,
+    0x5d, 0xd3, 0x54, 0xdb, 0xab, 0xab, 0x42, 0xeb, 0xe4, 0x49, 0xae, 0xfd, 0xdc, 0x73, 0xa3, 0xff,
+    0x04, 0xdd, 0xff, 0x69, 0x84, 0x52, 0x68, 0x71, 0x12, 0xb7, 0x0a, 0x4a, 0xd5, 0x00, 0x97, 0x89,
+    0xb2, 0x5a, 0x36, 0xe0, 0x24, 0x5c, 0x87, 0xdc, 0xb7, 0x9b, 0x91, 0xd2, 0x42, 0x9f, 0x3c, 0x90,
+    0x85, 0x00, 0x9c, 0x62, 0x49, 0x1e, 0xdb, 0x43, 0xc8, 0xcf, 0xfc, 0xbf, 0xaa, 0xfc, 0xd5, 0xa9,
+    0x7f, 0x77, 0xea, 0xdf, 0x3d, 0x7f, 0xdf, 0xca, 0x7d, 0x47, 0x4f, 0x7a, 0x27, 0x3b, 0xeb, 0xab,
+    0xea, 0x61, 0xc6, 0x9b, 0x31, 0x1e, 0x5b, 0x78, 0xac, 0xf9, 0xcc, 0xec, 0x33, 0xf6, 0xc1, 0xe5,
+    0x83, 0xce, 0x73, 0x2b, 0xcf, 0x99, 0x3f, 0xac, 0xfe, 0xb0, 0x34, 0x1f, 0xce, 0x1b, 0x05, 0xb9,
+    0xa0, 0x82, 0xa1, 0xa7, 0x8d, 0x6e, 0x83, 0x1a, 0xae, 0x21, 0xb4, 0xad, 0x36, 0xd7, 0xb2, 0x5b,
+    0xc8, 0x0a, 0x2d, 0xc8, 0x6f, 0xa8, 0xae, 0x0b, 0xfa, 0xa0, 0x46, 0xb4, 0x2c, 0x09, 0x49, 0xef,
+    0xed, 0x19, 0x16, 0xea, 0x17, 0xfd, 0x45, 0xeb, 0x07, 0xa5, 0x1f, 0x34, 0x8f, 0x54, 0x8f, 0xb0,
+    0x52, 0x6f, 0x04, 0xe6, 0x24, 0x43, 0x7d, 0x3a, 0xba, 0x6a, 0xaf, 0x16, 0x41, 0x73, 0xcf, 0x89,
+    0x19, 0x39, 0x6b, 0x0a, 0xc8, 0xf0, 0x9e, 0xf7, 0x7c, 0x34, 0x32, 0x8c, 0x68, 0xb8, 0x52, 0xf1,
+    0x47, 0x5d, 0x97, 0xdd, 0xb3, 0x01, 0x27, 0x8a, 0x9e, 0x00, 0x29, 0x0e, 0xae, 0xd7, 0x65, 0x07,
+    0xa6, 0x45, 0x92, 0x64, 0x4a, 0x6c, 0x1c, 0x00, 0x37, 0x9a, 0x5c, 0x10, 0x04, 0x0e, 0x16, 0xc5,
+    0xae, 0x24, 0x49, 0xa1, 0xa8, 0x28, 0x32, 0xb6, 0x2c, 0xc9, 0xe3, 0x38, 0x29, 0x14, 0x04, 0x48,
+    0xa4, 0x14, 0x0c, 0x4a, 0x85, 0x7c, 0xd3, 0x24, 0xce, 0x2b, 0xc9, 0xb7, 0x06, 0xca, 0x8a, 0x6c,
+    0x14, 0x30, 0x19, 0x31, 0x8e, 0x63, 0x24, 0x8c, 0x28, 0x90, 0x0b, 0xd4, 0x4c, 0x86, 0xbc, 0x33,
+    0x0c, 0x9f, 0x7d, 0xb6, 0x65, 0x7d, 0xfb, 0xdb, 0xcd, 0xaa, 0x6d, 0x43, 0x82, 0x45, 0x29, 0x53,
+    0x39, 0xa5, 0x58, 0x54, 0x75, 0x48, 0x01, 0x04, 0xdf, 0xc7, 0x30, 0x4e, 0xed, 0xb2, 0x67, 0xcc,
+    0xac, 0x2a, 0x3f, 0x90, 0xb4, 0x0b, 0xeb, 0x7a, 0x2e, 0x97, 0x8b, 0xbd, 0xf0, 0xf0, 0xc3, 0xf7,
+    0xfc, 0x54, 0xf5, 0xe6, 0x9e, 0xfe, 0xd4, 0xd3, 0xd1, 0x20, 0x7b, 0x14, 0xee, 0x0a, 0xe3, 0xa0,
+    0x7e, 0x63, 0x04, 0x13, 0xaf, 0x8b, 0xbb, 0x4d, 0x49, 0x12, 0xbc, 0x3e, 0x69, 0x40, 0x4e, 0xf1,
+    0x29, 0x15, 0x3c, 0x3a, 0x6f, 0x53, 0xc7, 0x8d, 0x50, 0x14, 0x74, 0x9d, 0xae, 0xd7, 0x0d, 0xbb,
+    0x1b, 0x15, 0x21, 0x5e, 0x3c, 0xb2, 0x5e, 0x9a, 0x0c, 0x23, 0x38, 0x8a, 0x8e, 0x59, 0xc7, 0x3a,
+    0xab, 0xcd, 0x55, 0xff, 0x50, 0xe5, 0x50, 0xf7, 0xfb, 0xa5, 0xef, 0x97, 0x1e, 0x36, 0x1e, 0x2e,
+    0xeb, 0xbc, 0x2e, 0x8d, 0x6b, 0xe3, 0x7a, 0x5c, 0x8e, 0x83, 0xac, 0x22, 0x19, 0xc2, 0x79, 0x0c,
+    0x14, 0x50, 0x80, 0x0e, 0x81, 0x0b, 0xa7, 0x21, 0x09, 0x11, 0xe4, 0x7c, 0xac, 0xa2, 0xab, 0x0c,
+    0x79, 0x26, 0x5c, 0x08, 0x44, 0x20, 0x74, 0xb3, 0x54, 0x86, 0x42, 0x6e, 0xea, 0xd8, 0x8e, 0x8d,
+    0x2c, 0xd7, 0x42, 0x73, 0xe6, 0x9c, 0x7b, 0xd2, 0x39, 0xd9, 0x50, 0x55, 0x75, 0x5e, 0x76, 0xe5,
+    0xf9, 0xe6, 0xa7, 0x9a, 0x67, 0xbd, 0xbe, 0xe0, 0x59, 0x25, 0xe0, 0x07, 0x3f, 0x78, 0xab, 0xe3,
+    0xba, 0xf9, 0x7c, 0xa7, 0xe3, 0x4f, 0x00, 0xd9, 0x74, 0xc7, 0x11, 0x21, 0x87, 0xe3, 0x89, 0x6d,
+    0xf3, 0x61, 0xbd, 0x2e, 0xba, 0x9d, 0x8e, 0xe4, 0x31, 0x11, 0xe6, 0x38, 0x18, 0x09, 0xa7, 0xa3,
+    0xd6, 0xc0, 0x90, 0xe7, 0x21, 0x50, 0xce, 0x10, 0x0b, 0x82, 0x27, 0x88, 0x22, 0x8f, 0x6d, 0x5b,
+    0xf3, 0x5d, 0x57, 0xf2, 0xf9, 0xde, 0x2b, 0x1d, 0x44, 0x71, 0x5d, 0x12, 0xb5, 0x5a, 0xc4, 0x00,
+    0xe2, 0xbd, 0x9c, 0x7a, 0x6c, 0x04, 0xfb, 0x03, 0x81, 0x03, 0x3a, 0x89, 0x1c, 0x17, 0x01, 0xc9,
+    0x43, 0x67, 0x65, 0xc5, 0xb3, 0xea, 0x75, 0xcf, 0x3d, 0x78, 0xb0, 0x63, 0x7d, 0xfd, 0xeb, 0xf5,
+    0xea, 0xea, 0x6a, 0xe0, 0xf6, 0x0a, 0x71, 0x80, 0xac, 0x85, 0x82, 0x9a, 0x1a, 0x18, 0x88, 0xe9,
+    0xaa, 0x8a, 0xb9, 0x30, 0x44, 0x2e, 0x6c, 0xa7, 0xcd, 0xf3, 0xaa, 0x0b, 0xf9, 0x29, 0x97, 0x4e,
+    0x53, 0x67, 0x62, 0x82, 0x7b, 0x7e, 0xeb, 0xd6, 0xd8, 0x81, 0x2f, 0x7f, 0xf9, 0xa7, 0x2f, 0x0b,
+    0xcc, 0xfc, 0x4e, 0x26, 0x30, 0x3b, 0x66, 0xdc, 0x30, 0x8d, 0x91, 0xb6, 0xdf, 0xa6, 0x75, 0x30,
+    0x00, 0x3e, 0x0a, 0xbc, 0x2c, 0x9f, 0x55, 0x99, 0xfd, 0x80, 0x7b, 0x44, 0x64, 0xa4, 0x03, 0x82,
+    0x38, 0x96, 0x67, 0xad, 0x11, 0x70, 0x4d, 0x7b, 0x30, 0x9c, 0x1a, 0x36, 0x84, 0xe1, 0x2a, 0x31,
+    0xc5, 0xea, 0xa9, 0x96, 0x47, 0x3d, 0x72, 0xda, 0x3d, 0xdd, 0x3d, 0x6c, 0x1f, 0x6e, 0xaf, 0x04,
+    0x2b, 0x36, 0x98, 0x0e, 0x3c, 0x24, 0x0c, 0xc5, 0x33, 0x52, 0x46, 0x81, 0xf9, 0x79, 0x49, 0x96,
+    0x74, 0x8e, 0x72, 0x9a, 0x6b, 0xbb, 0xa1, 0xe7, 0x78, 0x0e, 0xb0, 0xcf, 0xe6, 0x22, 0x8e, 0x75,
+    0x96, 0xeb, 0xb9, 0x81, 0xe5, 0x5b, 0x14, 0x6e, 0x4c, 0x88, 0x0b, 0xbc, 0x08, 0x79, 0xa3, 0xcc,
+    0x96, 0x9f, 0xf1, 0x67, 0xba, 0xc7, 0x8d, 0xe3, 0xe6, 0x69, 0xe7, 0xb4, 0xe9, 0x62, 0xd7, 0x85,
+    0xbc, 0x74, 0x66, 0x70, 0x68, 0xf0, 0xf4, 0x89, 0x3f, 0x39, 0x71, 0xd6, 0xab, 0xee, 0x9f, 0x55,
+    0x02, 0xde, 0x7f, 0xff, 0xfd, 0xe4, 0xbd, 0xef, 0xfd, 0xfd, 0xc8, 0xb2, 0xc2, 0x11, 0xcb, 0xf2,
+    0xc6, 0x5c, 0x57, 0x00, 0x25, 0x92, 0xfd, 0x56, 0x8b, 0x55, 0xa9, 0xe7, 0x41, 0x71, 0x78, 0x62,
+    0x59, 0x62, 0xc0, 0xba, 0x4e, 0x47, 0x04, 0x97, 0x1b, 0x72, 0x8e, 0x1b, 0x0a, 0x51, 0xa8, 0x7a,
+    0x94, 0x0a, 0x21, 0xe4, 0x7b, 0xc4, 0x30, 0x14, 0xcf, 0xf7, 0x85, 0x48, 0x10, 0x78, 0xe6, 0x7e,
+    0x79, 0x70, 0xb0, 0x42, 0xbb, 0x4d, 0x0c, 0xf6, 0x24, 0x63, 0x43, 0xfd, 0xd6, 0xc5, 0x90, 0x95,
+    0x19, 0x52, 0xdb, 0x76, 0x7d, 0xf6, 0xaa, 0x26, 0x6c, 0xd3, 0x69, 0x34, 0x68, 0xf7, 0xd0, 0xa1,
+    0xa0, 0xfe, 0xf4, 0xd3, 0x46, 0xeb, 0xc0, 0x01, 0xb3, 0xdb, 0x68, 0x44, 0x10, 0x62, 0x41, 0xfa,
+    0xa0, 0x63, 0xc5, 0x42, 0xa9, 0x94, 0x9c, 0x91, 0x24, 0x1a, 0x63, 0x35, 0x6a, 0x20, 0x34, 0x43,
+    0x8e, 0xa9, 0x76, 0x38, 0x4e, 0x8c, 0xc0, 0x34, 0x69, 0x85, 0x02, 0x69, 0x0c, 0x0e, 0x8a, 0x0f,
+    0xfd, 0xda, 0xaf, 0xc5, 0x8e, 0xf7, 0x56, 0xfe, 0x53, 0x62, 0xec, 0x9d, 0x63, 0xfe, 0x92, 0xb8,
+    0x24, 0x95, 0x8d, 0xb2, 0x0e, 0xa1, 0x2d, 0xd6, 0x09, 0x3b, 0x9e, 0x19, 0x58, 0x81, 0x86, 0x62,
+    0xa2, 0x82, 0x15, 0x31, 0x02, 0x32, 0xb4, 0x83, 0x76, 0x08, 0x26, 0x21, 0xc0, 0x11, 0x0e, 0x61,
+    0x18, 0x7c, 0x3f, 0x59, 0x0b, 0x80, 0xac, 0x63, 0x49, 0xd2, 0xc6, 0xf0, 0x2b, 0xc0, 0x52, 0x8e,
+    0x24, 0x4a, 0x4a, 0x59, 0x21, 0xab, 0x88, 0xbc, 0xc8, 0x83, 0x1b, 0x49, 0x88, 0x91, 0x98, 0x22,
+    0x0e, 0xe1, 0x21, 0x97, 0x34, 0x4f, 0xd5, 0x4e, 0xad, 0x1c, 0xae, 0x1f, 0x5e, 0x9c, 0x69, 0x9d,
+    0x2e, 0x97, 0x8c, 0x52, 0xcd, 0xf1, 0xed, 0x0e, 0x98, 0x90, 0x8e, 0x40, 0x04, 0x3a, 0x06, 0x1e,
+    0x2b, 0xcf, 0xe7, 0x33, 0x32, 0x92, 0x55, 0x30, 0x27, 0xd4, 0x82, 0x60, 0xed, 0x84, 0x0e, 0xab,
+    0x46, 0x6e, 0xc9, 0x8a, 0x7c, 0x14, 0x56, 0x77, 0xe2, 0xf4, 0xa7, 0x4e, 0x9f, 0xf5, 0xb7, 0xe8,
+    0xce, 0x5a, 0x0e, 0xb8, 0x81, 0x6c, 0xd6, 0x9c, 0xcf, 0xe7, 0x95, 0x43, 0xaa, 0x2a, 0x95, 0x59,
+    0x1e, 0xc6, 0x2a, 0x22, 0x80, 0xda, 0x10, 0x18, 0xee, 0x65, 0x22, 0x51, 0xc4, 0x91, 0x76, 0x5b,
+    0x75, 0x6a, 0x75, 0xc9, 0xf1, 0x21, 0xd5, 0x8f, 0x48, 0x20, 0xb7, 0x3b, 0x14, 0x2f, 0x2f, 0x27,
+    0x3b, 0x4b, 0x4b, 0xa9, 0x76, 0xb7, 0xcb, 0x07, 0x30, 0x1f, 0xa8, 0x24, 0xa6, 0xb2, 0x2c, 0xdb,
+    0xf1, 0xb8, 0x84, 0x20, 0xc4, 0x6a, 0xeb, 0xab, 0x07, 0xac, 0x91, 0x0f, 0x68, 0x05, 0xe7, 0x2e,
+    0xa0, 0x51, 0x44, 0x60, 0x7d, 0xd4, 0x58, 0x5a, 0x0a, 0x6b, 0x95, 0x4a, 0xd4, 0x0e, 0x02, 0x02,
+    0x44, 0x46, 0x04, 0xb6, 0xdb, 0x9b, 0x8f, 0x29, 0x1f, 0x84, 0x40, 0x4d, 0xd3, 0xa4, 0x42, 0xa7,
+    0x43, 0xb4, 0xd9, 0x59, 0x8b, 0x3b, 0x7e, 0xdc, 0x86, 0xed, 0xf9, 0x34, 0xec, 0xbd, 0x3f, 0xc7,
+    0x81, 0x93, 0xc6, 0x62, 0xa1, 0x80, 0x5b, 0xa9, 0x94, 0xb0, 0xbc, 0xbe, 0xd0, 0x4f, 0x04, 0xec,
+    0x05, 0xa6, 0x37, 0xdc, 0x20, 0xd0, 0xbb, 0xef, 0x56, 0xc8, 0xbf, 0xf8, 0x17, 0x2a, 0xb9, 0xf7,
+    0x5e, 0x19, 0x86, 0x85, 0x87, 0x5f, 0xff, 0x70, 0x48, 0x92, 0x64, 0xc1, 0x8b, 0x79, 0xc7, 0x7c,
+    0xce, 0x37, 0x99, 0x70, 0xb3, 0xda, 0x30, 0x27, 0xbc, 0x13, 0xd5, 0x59, 0x7b, 0xb6, 0x5c, 0xf6,
+    0x4a, 0x95, 0xbc, 0x90, 0xa7, 0x6f, 0xcd, 0xbd, 0xa5, 0xff, 0x3d, 0xfd, 0xef, 0xd9, 0xfc, 0xee,
+    0xd4, 0xbb, 0xa7, 0x74, 0xac, 0x4b, 0xeb, 0xab, 0xfd, 0x27, 0x21, 0x53, 0x99, 0x63, 0xb5, 0x67,
+    0x78, 0xca, 0x0b, 0x71, 0x12, 0x07, 0xd1, 0x4e, 0x67, 0x04, 0x47, 0x10, 0x3b, 0x8d, 0x8e, 0x53,
+    0x69, 0x56, 0x3a, 0x07, 0x5b, 0x07, 0x97, 0x4f, 0xd9, 0xa7, 0x6a, 0xcb, 0xc1, 0x4a, 0xb7, 0x46,
+    0x2a, 0x76, 0x85, 0x56, 0x0d, 0x13, 0x81, 0x14, 0xf3, 0x23, 0xea, 0x20, 0x3f, 0xa4, 0xe4, 0x68,
+    0x4e, 0x4e, 0xf9, 0xa9, 0x58, 0xd6, 0xcb, 0xe6, 0x65, 0x5b, 0xce, 0x45, 0x4e, 0x94, 0x27, 0x2e,
+    0x55, 0x50, 0x80, 0x42, 0xa1, 0x2b, 0xfc, 0x1f, 0x3f, 0x07, 0xff, 0x5f, 0xc1, 0x8f, 0xb8, 0xaf,
+    0x7e, 0xf6, 0x78, 0xf0, 0xc1, 0xc6, 0x8e, 0xd9, 0x59, 0xe3, 0x03, 0xab, 0xab, 0xde, 0xcd, 0xa0,
+    0x56, 0x32, 0x2b, 0x57, 0x65, 0x65, 0x5d, 0xac, 0x32, 0x28, 0x23, 0x25, 0xfb, 0x0d, 0x06, 0x04,
+    0x0c, 0xa8, 0x9b, 0xf2, 0x82, 0xae, 0x46, 0x42, 0xc1, 0x51, 0x95, 0x64, 0x4b, 0x10, 0xe4, 0x88,
+    0xcd, 0x07, 0xc0, 0xac, 0xe8, 0x86, 0xf5, 0x1d, 0xc7, 0x51, 0xe7, 0xe6, 0xba, 0xe1, 0xe9, 0xd3,
+    0x41, 0x89, 0x91, 0x6d, 0x43, 0x05, 0x61, 0x18, 0x08, 0xe4, 0xc2, 0x18, 0x18, 0xe8, 0x8d, 0x83,
+    0xc8, 0x05, 0xb7, 0x31, 0xe4, 0x8f, 0x98, 0xe5, 0xf8, 0x90, 0xf8, 0x63, 0x98, 0x26, 0x80, 0x0b,
+    0x4f, 0xa5, 0xd3, 0x52, 0x8a, 0x55, 0x86, 0x29, 0x95, 0x5c, 0xb1, 0xd9, 0x04, 0x5b, 0x1d, 0x85,
+    0xa0, 0x26, 0x62, 0x3b, 0x99, 0xcc, 0x57, 0x35, 0x2d, 0xee, 0xf7, 0xf7, 0xd3, 0x68, 0xf7, 0x6e,
+    0xee, 0xeb, 0x43, 0x43, 0xea, 0x27, 0xef, 0xbc, 0x33, 0xf5, 0x8f, 0x6a, 0x0c, 0xaf, 0xbc, 0xe5,
+    0x2d, 0x5a, 0x98, 0xcf, 0xf7, 0x11, 0x59, 0x9e, 0x86, 0x18, 0xb5, 0xa3, 0xf6, 0xdd, 0xef, 0xa6,
+    0xc1, 0xdd, 0xa4, 0xd2, 0x7d, 0x7d, 0xe9, 0x0c, 0x38, 0x25, 0x38, 0x46, 0x3e, 0x94, 0x65, 0x9e,
+    0xe3, 0x79, 0x07, 0x2c, 0x7f, 0x2d, 0x50, 0xc2, 0xf2, 0x53, 0x5b, 0xba, 0xea, 0x83, 0x03, 0xb5,
+    0x2d, 0xcf, 0xab, 0x66, 0xba, 0xc6, 0x87, 0x11, 0x82, 0x1b, 0x4a, 0x40, 0x02, 0x37, 0x2d, 0x4f,
+    0xa7, 0x3e, 0x30, 0xf6, 0x81, 0x4d, 0x5b, 0xd3, 0x5b, 0x35, 0xe4, 0x21, 0x7c, 0xbc, 0x74, 0xdc,
+    0x79, 0x70, 0xf1, 0xc1, 0x85, 0xaf, 0x5b, 0x5f, 0x9f, 0x5f, 0xdf, 0xdc, 0x8f, 0x84, 0x84, 0xe1,
+    0x1f, 0x95, 0x78, 0xf6, 0xbc, 0x78, 0x94, 0x1b, 0x61, 0xed, 0xc4, 0x14, 0x75, 0x51, 0x8f, 0x43,
+    0xe0, 0x05, 0x0d, 0x6d, 0x19, 0x27, 0xec, 0x93, 0xcb, 0xb3, 0xe1, 0x6c, 0x03, 0xee, 0x71, 0x0e,
+    0x4e, 0x03, 0xcf, 0xde, 0xbc, 0x89, 0xf8, 0x88, 0x14, 0xf8, 0x42, 0xec, 0x0a, 0x65, 0xcf, 0x78,
+    0x56, 0xce, 0xe9, 0x90, 0x4e, 0xfb, 0x5d, 0xbf, 0xeb, 0x9a, 0x91, 0x19, 0xb5, 0x68, 0x8b, 0x1a,
+    0xd4, 0x50, 0x63, 0x5a, 0xec, 0xf9, 0xc2, 0x40, 0xe1, 0x33, 0xe4, 0x66, 0xf2, 0xcd, 0x87, 0xf1,
+    0xc3, 0x67, 0x9d, 0x84, 0x67, 0x35, 0x04, 0x6f, 0xe0, 0x37, 0x7f, 0xf3, 0x37, 0xbb, 0xbe, 0xaf,
+    0xe4, 0xc1, 0x08, 0x8c, 0x47, 0x11, 0x4a, 0xad, 0x91, 0x8e, 0x11, 0x90, 0xf1, 0x0f, 0x4e, 0x11,
+    0x70, 0x8b, 0xbd, 0x34, 0x9e, 0x49, 0x8b, 0x31, 0x70, 0xb1, 0x92, 0x17, 0x04, 0x20, 0x29, 0x62,
+    0x00, 0xc6, 0x04, 0x34, 0x69, 0x6d, 0x3e, 0xe6, 0x13, 0x99, 0xa3, 0x85, 0x5c, 0x10, 0xae, 0x6f,
+    0x20, 0x80, 0x8b, 0x0d, 0x5c, 0x97, 0x9e, 0xa9, 0xb3, 0xc7, 0xc2, 0x30, 0x38, 0x5f, 0xe8, 0xad,
+    0x3d, 0xb8, 0x67, 0x2b, 0x86, 0x70, 0x0a, 0x1d, 0xe3, 0x01, 0xcf, 0xc9, 0x32, 0x17, 0xcf, 0xe7,
+    0x85, 0xc2, 0xc0, 0x80, 0x90, 0xcd, 0xe5, 0x44, 0x8d, 0xe3, 0x04, 0xd2, 0x6a, 0x21, 0xdb, 0xb2,
+    0x22, 0x58, 0x47, 0xc8, 0xe5, 0x72, 0x18, 0x0f, 0x0d, 0x49, 0xbc, 0xaa, 0x0a, 0xec, 0x86, 0x78,
+    0x2e, 0x16, 0x43, 0x5f, 0xfb, 0xe7, 0xff, 0x3c, 0x7f, 0x04, 0xa1, 0x7b, 0xd0, 0xe1, 0x6d, 0xdb,
+    0xa4, 0x8f, 0x4d, 0x4d, 0x0d, 0x7e, 0x28, 0x9b, 0xbd, 0xee, 0xc3, 0xe9, 0xf4, 0x9d, 0x7e, 0xa7,
+    0xf3, 0xab, 0x10, 0xc3, 0x7f, 0x15, 0x67, 0xb3, 0xef, 0x84, 0xee, 0x35, 0xc2, 0xc0, 0xc0, 0xd6,
+    0x68, 0x66, 0x46, 0x56, 0xe3, 0xf1, 0x11, 0xb8, 0xbb, 0x74, 0x5f, 0x92, 0xf2, 0x73, 0xd3, 0xd3,
+    0x57, 0xd7, 0x33, 0x99, 0x6d, 0x76, 0x2a, 0xb5, 0x4b, 0xa2, 0xe2, 0x65, 0xa3, 0x27, 0x83, 0xe1,
+    0x9b, 0x9e, 0x97, 0x63, 0xef, 0x3c, 0xa9, 0xcb, 0x6f, 0xa8, 0xc4, 0xe4, 0x7e, 0xc8, 0x6a, 0x6b,
+    0x89, 0x90, 0xbe, 0x7e, 0xf0, 0x6d, 0x03, 0x37, 0x6d, 0xba, 0x29, 0x39, 0x91, 0x99, 0x90, 0x64,
+    0x4e, 0xe6, 0x03, 0x88, 0xc4, 0x35, 0xa3, 0x16, 0x3e, 0x6b, 0x3f, 0x5b, 0xfb, 0x71, 0x95, 0x10,
+    0x24, 0x24, 0x71, 0x19, 0x94, 0xd1, 0x32, 0x51, 0x26, 0x06, 0x6a, 0x85, 0x1b, 0x5e, 0xd3, 0x8a,
+    0xc2, 0x30, 0x6a, 0x79, 0x4d, 0x63, 0xc9, 0x59, 0xaa, 0x1e, 0xf5, 0x8e, 0xad, 0x94, 0xc2, 0x92,
+    0x81, 0xe0, 0x50, 0x80, 0xa7, 0x1c, 0x15, 0x29, 0x12, 0x44, 0x01, 0x4f, 0x0a, 0x93, 0xf9, 0x2d,
+    0xea, 0x96, 0xa1, 0xb4, 0x92, 0x4e, 0x10, 0x8e, 0xa0, 0x05, 0x67, 0xa1, 0xfa, 0x84, 0xfd, 0xc4,
+    0x6c, 0xaf, 0x70, 0x3a, 0xac, 0xb5, 0xe2, 0x38, 0x4e, 0x07, 0xe3, 0x83, 0x47, 0xfa, 0x8a, 0x7d,
+    0x8f, 0x7f, 0x63, 0xf8, 0x1b, 0x4b, 0xeb, 0x9b, 0x3b, 0xab, 0x38, 0x27, 0x04, 0xbc, 0xff, 0xfe,
+    0x7b, 0xc3, 0x0f, 0x7e, 0xf0, 0xf7, 0x7d, 0xcb, 0x42, 0x43, 0x96, 0x45, 0xc6, 0x80, 0x1a, 0xe0,
+    0x84, 0xd7, 0xc8, 0xc7, 0x04, 0x0e, 0x3a, 0x50, 0x28, 0x0e, 0xc7, 0x62, 0x58, 0x51, 0x55, 0x5e,
+    0x0a, 0x42, 0x48, 0x86, 0x42, 0x1c, 0xc2, 0x38, 0x1f, 0x88, 0xb2, 0x4e, 0x40, 0x9e, 0x99, 0x0c,
+    0x30, 0x27, 0x1c, 0x84, 0xee, 0x88, 0x77, 0x1c, 0x0f, 0x43, 0x2e, 0xd8, 0xab, 0x3e, 0xc4, 0x8a,
+    0x55, 0xd8, 0xba, 0x80, 0x7c, 0x78, 0x4d, 0xfd, 0x38, 0x50, 0x54, 0x81, 0xcf, 0x64, 0x24, 0x99,
+    0x11, 0x5b, 0x10, 0x24, 0x20, 0x9f, 0x92, 0x2e, 0x16, 0xb9, 0x54, 0x2a, 0x85, 0x21, 0xbc, 0x89,
+    0xc0, 0x21, 0xb1, 0x53, 0xaf, 0xf3, 0x35, 0xa0, 0xaa, 0x35, 0x32, 0x82, 0xe5, 0xf1, 0x71, 0x21,
+    0x96, 0xcf, 0x83, 0xf9, 0x96, 0x50, 0x0d, 0xb6, 0xf9, 0x35, 0xf9, 0xb1, 0x67, 0x7f, 0xf0, 0xf9,
+    0xf8, 0xdb, 0x06, 0x3f, 0x3c, 0x30, 0xf0, 0x16, 0x90, 0xc8, 0xdf, 0xf0, 0x0c, 0xe3, 0xbd, 0x20,
+    0xaf, 0x37, 0xc5, 0x6e, 0xbf, 0xfd, 0xfa, 0xfc, 0xdd, 0x77, 0xef, 0x4d, 0x7d, 0xe0, 0x03, 0xe3,
+    0xca, 0xcd, 0x37, 0x67, 0xd1, 0x65, 0x97, 0x25, 0x3d, 0xc8, 0x0b, 0xf0, 0xe3, 0x8f, 0x37, 0x40,
+    0x82, 0xf9, 0xd8, 0xf0, 0x70, 0x52, 0xde, 0xb2, 0x65, 0x24, 0x16, 0x8b, 0xc9, 0xec, 0x1e, 0x80,
+    0x5c, 0x83, 0x17, 0x61, 0xc7, 0xc4, 0x46, 0xa3, 0x4d, 0xfc, 0x20, 0x12, 0x7c, 0x0e, 0xf5, 0x35,
+    0x78, 0x7c, 0xd9, 0xbc, 0x26, 0xbc, 0xf1, 0x84, 0x2e, 0x15, 0x07, 0xb7, 0xa6, 0xc6, 0x76, 0x5d,
+    0x9b, 0xd0, 0xb5, 0x24, 0x0f, 0x0e, 0x0d, 0xd5, 0x8d, 0x7a, 0x74, 0xac, 0x79, 0xcc, 0x7c, 0xc6,
+    0x79, 0xa6, 0xf2, 0x0a, 0x9f, 0x85, 0x04, 0x2c, 0xe0, 0x22, 0x57, 0x8c, 0xef, 0x14, 0x77, 0x0e,
+    0x6f, 0x16, 0x36, 0x0f, 0x82, 0xf9, 0x28, 0x80, 0x99, 0x49, 0x38, 0x91, 0xe3, 0x1e, 0x0e, 0x0e,
+    0xaf, 0x2e, 0x85, 0xcb, 0xad, 0x2a, 0xa9, 0x99, 0xec, 0x05, 0x26, 0x50, 0x3c, 0x0e, 0xc9, 0x2c,
+    0x0c, 0xc0, 0x11, 0x0a, 0x18, 0xed, 0x16, 0x77, 0x0d, 0x4d, 0xab, 0xd3, 0xc3, 0x45, 0xa5, 0x90,
+    0xd1, 0x15, 0x5d, 0x0d, 0x51, 0xe8, 0x77, 0x82, 0x8e, 0x35, 0x17, 0xce, 0x35, 0x02, 0x0a, 0xa9,
+    0x31, 0xdc, 0xbe, 0x05, 0xa9, 0x60, 0x4e, 0x65, 0xa7, 0x9e, 0xbd, 0x22, 0x7d, 0xc5, 0x33, 0xdf,
+    0xfb, 0xcc, 0xf7, 0x5e, 0x56, 0x04, 0x74, 0xb6, 0x70, 0x4e, 0x08, 0xc8, 0xf0, 0xfb, 0xbf, 0xff,
+    0xf1, 0x8e, 0x6d, 0xfb, 0x19, 0xc3, 0x08, 0x47, 0x83, 0x80, 0x66, 0x21, 0x28, 0x70, 0xa2, 0x08,
+    0xac, 0x62, 0x49, 0x19, 0x93, 0x40, 0x00, 0x08, 0x9e, 0x08, 0xa6, 0x40, 0x02, 0x1e, 0x71, 0xac,
+    0xc2, 0x01, 0x10, 0xc1, 0x03, 0xf2, 0xb1, 0xd7, 0x2a, 0xd9, 0xb5, 0x04, 0xf5, 0x83, 0x78, 0x02,
+    0x4a, 0x08, 0x8a, 0xc6, 0xcc, 0x06, 0xad, 0x56, 0x03, 0x87, 0xbd, 0x76, 0xc9, 0x96, 0x25, 0x84,
+    0x29, 0x29, 0x0b, 0xe9, 0x1c, 0x8e, 0xc7, 0x05, 0xe9, 0xb6, 0xdb, 0x12, 0xfd, 0x37, 0xdf, 0x9c,
+    0x28, 0x6e, 0xd9, 0x22, 0xa7, 0xa2, 0x48, 0x86, 0xf5, 0x89, 0x54, 0x51, 0x10, 0x10, 0x5b, 0x00,
+    0xc3, 0x23, 0x83, 0x21, 0x11, 0xdb, 0xbe, 0x4f, 0x9d, 0x64, 0xd2, 0x13, 0x87, 0x87, 0xb1, 0x9e,
+    0x4c, 0x4a, 0x62, 0xe0, 0x71, 0x9d, 0x21, 0xbf, 0xf3, 0xfc, 0xcd, 0x33, 0x7f, 0xe3, 0x5c, 0xb1,
+    0xf0, 0x9f, 0x6f, 0xa9, 0x77, 0xda, 0xbf, 0x06, 0xce, 0xe4, 0x5a, 0x50, 0xd6, 0x02, 0xcb, 0x12,
+    0xe4, 0xd7, 0xbf, 0x3e, 0x5b, 0xfc, 0xd8, 0xc7, 0xc6, 0x39, 0x98, 0xd9, 0x69, 0xb7, 0xb9, 0xd6,
+    0xa1, 0x43, 0xb8, 0xfd, 0xa5, 0x2f, 0xd5, 0xd0, 0x9f, 0xfd, 0xd9, 0x51, 0x11, 0x92, 0x59, 0x27,
+    0x95, 0x1a, 0x51, 0x07, 0x06, 0x14, 0x50, 0x47, 0x8e, 0x76, 0xbb, 0xb6, 0x52, 0xad, 0x36, 0xf4,
+    0xc5, 0xc5, 0x55, 0xb9, 0x54, 0xaa, 0x21, 0x90, 0xf6, 0x00, 0xee, 0x22, 0x70, 0x47, 0x91, 0x13,
+    0x86, 0xc4, 0x05, 0x37, 0x45, 0x4d, 0x3f, 0xe4, 0x66, 0xab, 0x34, 0x38, 0x70, 0xb8, 0x1e, 0xdf,
+    0x7b, 0x45, 0xca, 0xa0, 0x3e, 0x3e, 0xd5, 0x38, 0xe5, 0x3e, 0x52, 0x79, 0xa4, 0x02, 0x39, 0xe2,
+    0xcb, 0xaa, 0x82, 0x81, 0x59, 0xe0, 0xb3, 0x38, 0xab, 0xec, 0xd6, 0x76, 0x8f, 0x0e, 0xcb, 0xc3,
+    0xc5, 0x34, 0x9f, 0x4e, 0x6a, 0x9c, 0xaa, 0x42, 0x8a, 0x1b, 0x76, 0xa2, 0x8e, 0x51, 0x89, 0x2a,
+    0xdd, 0xde, 0x59, 0x62, 0x95, 0x9d, 0x79, 0xcc, 0x83, 0x4c, 0x32, 0x17, 0xcd, 0x8a, 0x6e, 0x68,
+    0x0e, 0xe7, 0x62, 0x9b, 0x95, 0xcd, 0xfd, 0x39, 0x39, 0x9b, 0x96, 0x78, 0x59, 0x60, 0x05, 0xd2,
+    0x6d, 0xaf, 0x6d, 0x9c, 0xb0, 0x4e, 0x94, 0x5b, 0x51, 0x6b, 0xad, 0x0e, 0x20, 0x87, 0xa8, 0xa0,
+    0x0a, 0x87, 0x87, 0xf3, 0xc3, 0x4f, 0x5f, 0x77, 0xdd, 0x75, 0x87, 0xbf, 0x7c, 0xcf, 0x97, 0xcf,
+    0x7a, 0x11, 0x0c, 0xc3, 0x39, 0xc9, 0x01, 0x37, 0xf0, 0xdd, 0xef, 0x76, 0x36, 0x9f, 0x3c, 0x69,
+    0x7c, 0x60, 0x65, 0xc5, 0xbf, 0x55, 0x55, 0x71, 0x36, 0x16, 0xe3, 0x55, 0x08, 0xa3, 0xae, 0xe3,
+    0x50, 0x87, 0x69, 0x85, 0x24, 0x39, 0xb1, 0x78, 0x2c, 0x4a, 0x52, 0x2a, 0x8a, 0xa6, 0xc5, 0x05,
+    0x92, 0xa8, 0x40, 0x1e, 0xc8, 0x79, 0xe0, 0x57, 0x40, 0x05, 0x19, 0x01, 0x79, 0x20, 0x60, 0x2f,
+    0x27, 0x44, 0x95, 0x4a, 0x37, 0x7a, 0xf2, 0xc9, 0x5a, 0xdb, 0xb2, 0x58, 0xd5, 0x2a, 0x90, 0xc0,
+    0xf5, 0x5a, 0x2f, 0xa0, 0x80, 0xf4, 0xc6, 0x1b, 0x95, 0xe2, 0x3b, 0xde, 0x91, 0x2d, 0x0e, 0x0f,
+    0xab, 0x32, 0x18, 0x10, 0xba, 0x7f, 0x7f, 0x64, 0xfe, 0xed, 0xdf, 0x86, 0x15, 0x1f, 0xae, 0x37,
+    0xab, 0x78, 0xe0, 0x79, 0xbc, 0x0f, 0xa6, 0x04, 0xa2, 0x96, 0x4f, 0x65, 0xc9, 0x50, 0xc6, 0x72,
+    0x66, 0x72, 0x0b, 0x2e, 0xe3, 0x9d, 0x9d, 0x03, 0xdd, 0x21, 0xeb, 0x88, 0xc3, 0x13, 0x83, 0x69,
+    0x02, 0x0d, 0x80, 0x28, 0xb0, 0x00, 0x02, 0x9b, 0x8e, 0x42, 0x51, 0x54, 0xf9, 0x64, 0x52, 0x85,
+    0x78, 0x1e, 0x02, 0xb9, 0x1c, 0xaa, 0x69, 0x10, 0x31, 0x65, 0x81, 0xab, 0x56, 0xdb, 0x5c, 0xad,
+    0x66, 0x79, 0xb2, 0x1c, 0x37, 0xf2, 0xf9, 0x2d, 0xb4, 0xd5, 0x72, 0x54, 0x51, 0x74, 0x63, 0x63,
+    0x63, 0x24, 0xbe, 0x67, 0x0f, 0x97, 0xdc, 0xb7, 0x4f, 0xa3, 0xa3, 0xa3, 0x9a, 0x0b, 0x3b, 0xdf,
+    0x01, 0x77, 0xd4, 0xfd, 0xc4, 0x27, 0x4e, 0xd1, 0x27, 0x9f, 0x6c, 0xf4, 0x72, 0x89, 0x6c, 0x36,
+    0x61, 0x9d, 0x3c, 0x59, 0x8d, 0xea, 0x75, 0x47, 0x98, 0x9e, 0x8e, 0x9b, 0x7f, 0xf4, 0xdb, 0xdb,
+    0x7e, 0x40, 0x4f, 0x04, 0x0f, 0x96, 0x1f, 0x9c, 0x5d, 0xf1, 0x56, 0x3a, 0xec, 0x79, 0x30, 0x23,
+    0x95, 0x86, 0x34, 0x5e, 0x25, 0xaa, 0x00, 0xf9, 0x5b, 0x7c, 0x6b, 0x6c, 0xeb, 0x70, 0x5e, 0xce,
+    0x67, 0x22, 0x3f, 0x42, 0xa6, 0x6f, 0xda, 0x65, 0xa7, 0xdc, 0x3c, 0xe0, 0x1e, 0x98, 0x33, 0x81,
+    0xcd, 0x2c, 0xd9, 0x20, 0x3c, 0xc1, 0xa1, 0x14, 0x12, 0xd6, 0x90, 0x11, 0x98, 0x13, 0xb6, 0x38,
+    0xd6, 0xa8, 0x26, 0x5c, 0xa6, 0xec, 0x18, 0xca, 0x8a, 0xb9, 0x24, 0x85, 0x40, 0xd1, 0x0d, 0xba,
+    0xf6, 0x9c, 0x3f, 0x57, 0x65, 0xef, 0x17, 0xb3, 0x33, 0x07, 0xe4, 0x63, 0x6f, 0x67, 0x57, 0xf8,
+    0x02, 0xff, 0xdd, 0xec, 0x50, 0xf6, 0x91, 0xea, 0x6b, 0xaa, 0x95, 0xde, 0x49, 0x3e, 0x07, 0x38,
+    0xa7, 0x04, 0x7c, 0xe8, 0x21, 0x2a, 0xb4, 0x5a, 0x8d, 0x5f, 0x38, 0x79, 0xd2, 0x79, 0x0f, 0xa8,
+    0xca, 0x35, 0x99, 0x0c, 0x4e, 0xb1, 0x66, 0x32, 0x0c, 0x03, 0x19, 0x70, 0xbd, 0xc1, 0x3e, 0xb8,
+    0xac, 0x51, 0x2b, 0x08, 0x5d, 0xbc, 0x16, 0x85, 0x3c, 0x88, 0x86, 0xd2, 0x01, 0xce, 0xc1, 0x1d,
+    0xea, 0x03, 0xb9, 0x20, 0x6f, 0x07, 0xc1, 0x64, 0x05, 0xd6, 0x70, 0xbb, 0xb2, 0x1a, 0xcc, 0xe4,
+    0xd0, 0xa1, 0xaa, 0x7d, 0xf4, 0xa8, 0x65, 0x30, 0xe5, 0x63, 0xeb, 0x67, 0xe4, 0x63, 0x0e, 0xf6,
+    0xd7, 0x7f, 0x3d, 0x3b, 0x7a, 0xcb, 0x2d, 0x85, 0x94, 0xae, 0xab, 0xc0, 0x1f, 0x8a, 0xc0, 0xe5,
+    0x3a, 0x7f, 0xfd, 0xd7, 0xed, 0x66, 0xa5, 0x02, 0x06, 0x14, 0xd6, 0x04, 0x91, 0x32, 0x8a, 0x5c,
+    0xea, 0x0f, 0xfb, 0xe5, 0xf0, 0x35, 0xe4, 0x31, 0xb4, 0x83, 0x3f, 0xc0, 0x25, 0xc2, 0x2a, 0x2b,
+    0xe6, 0x81, 0x75, 0x40, 0xbc, 0x84, 0x75, 0x39, 0x96, 0x15, 0xd4, 0x0e, 0x1e, 0xac, 0x2b, 0x99,
+    0x8c, 0x9c, 0x1a, 0x19, 0xd1, 0x65, 0x48, 0x0e, 0x59, 0xd9, 0x4d, 0x10, 0x8b, 0xc5, 0x2b, 0xa7,
+    0x4f, 0xf3, 0x6a, 0xa5, 0x52, 0x72, 0x29, 0xcd, 0x82, 0xcd, 0x4f, 0x73, 0x92, 0x44, 0x3a, 0x27,
+    0x4f, 0x1e, 0x0d, 0xa3, 0xc8, 0x00, 0x0e, 0xc4, 0xe3, 0xd7, 0x5c, 0x73, 0xe5, 0x9e, 0xfb, 0xef,
+    0x57, 0x63, 0x83, 0x83, 0x2c, 0x2f, 0x45, 0xb6, 0x69, 0xa2, 0xd6, 0x91, 0x23, 0x6e, 0xf3, 0x4b,
+    0x5f, 0x5a, 0x0e, 0xbe, 0xf7, 0x3d, 0xd6, 0x40, 0x26, 0x16, 0xb7, 0x6d, 0x1b, 0x15, 0x97, 0x96,
+    0xaa, 0xe6, 0xea, 0x6a, 0xdb, 0x31, 0x0c, 0x9f, 0x38, 0x4e, 0xe8, 0x65, 0x35, 0xf1, 0xcf, 0x3f,
+    0x9c, 0x48, 0x3c, 0x93, 0x74, 0x03, 0xdb, 0xb3, 0x6c, 0x66, 0xb2, 0x92, 0x38, 0x29, 0xb1, 0x37,
+    0xdf, 0x20, 0xcc, 0x82, 0x37, 0x45, 0x78, 0xbb, 0xb6, 0x7d, 0x20, 0x25, 0x24, 0x63, 0x41, 0x14,
+    0x46, 0x0d, 0xaf, 0x61, 0x2c, 0x47, 0xcb, 0x4d, 0x08, 0xb9, 0x21, 0xdc, 0x98, 0x62, 0x4e, 0xcc,
+    0xc5, 0xa6, 0xb5, 0xe9, 0x64, 0x5e, 0xce, 0xca, 0x01, 0x9c, 0xb3, 0x6a, 0x50, 0x27, 0x6e, 0xe4,
+    0x51, 0xd6, 0x82, 0xd6, 0x52, 0xb4, 0xd4, 0x52, 0x39, 0x45, 0x84, 0x70, 0x1b, 0x75, 0x49, 0xc7,
+    0xf5, 0xd6, 0xeb, 0x09, 0xf6, 0x18, 0xc0, 0xa3, 0x2e, 0xca, 0xa0, 0x7f, 0x40, 0x7d, 0xe8, 0x51,
+    0x74, 0x23, 0x3a, 0x06, 0xe3, 0x7a, 0x51, 0xe5, 0x5c, 0xe0, 0x9c, 0x12, 0x90, 0xe1, 0xd1, 0x47,
+    0x6b, 0x03, 0xa7, 0x4e, 0xd1, 0x5f, 0xad, 0x54, 0xfc, 0x3b, 0xe2, 0xf1, 0x70, 0x32, 0x99, 0x44,
+    0x92, 0xae, 0x0b, 0x3e, 0xe4, 0x7c, 0x74, 0x65, 0x05, 0x85, 0x96, 0xc5, 0xb1, 0x56, 0x5b, 0x14,
+    0x59, 0x0e, 0x05, 0x9e, 0x97, 0xba, 0x60, 0x28, 0x4d, 0x50, 0x2a, 0x58, 0x32, 0x00, 0x35, 0x20,
+    0x3d, 0x12, 0x82, 0xbb, 0x65, 0x4a, 0x88, 0x57, 0x57, 0x3b, 0xc1, 0x13, 0x4f, 0x54, 0x5b, 0xa6,
+    0xc9, 0xde, 0x31, 0x61, 0xf9, 0x24, 0xe6, 0x32, 0x19, 0x45, 0xbb, 0xeb, 0xae, 0xc2, 0xe0, 0xcd,
+    0x37, 0xe7, 0x12, 0x8a, 0x22, 0xf6, 0x8e, 0xef, 0xd8, 0xb1, 0x56, 0xf4, 0x95, 0xaf, 0x54, 0x20,
+    0xef, 0x23, 0x1c, 0x0f, 0x5b, 0xca, 0x2c, 0x1d, 0x6f, 0x5c, 0x6d, 0x3e, 0xd9, 0x1d, 0x41, 0xa7,
+    0x41, 0x28, 0x3c, 0x10, 0x85, 0xb5, 0xf3, 0xc0, 0xc8, 0xd7, 0xeb, 0xc3, 0xca, 0x58, 0x61, 0xa1,
+    0xd3, 0xed, 0x7a, 0x66, 0xa5, 0x62, 0x8b, 0x3b, 0x76, 0xc4, 0x86, 0xde, 0xf5, 0xae, 0x61, 0x79,
+    0xdb, 0xb6, 0xb8, 0x9f, 0x4e, 0xcb, 0x96, 0xef, 0xe3, 0xce, 0x43, 0x0f, 0x19, 0xc6, 0x67, 0x3f,
+    0x2b, 0xc9, 0x85, 0x82, 0x5c, 0x7e, 0xea, 0xa9, 0x83, 0x6e, 0xa3, 0xb1, 0x08, 0x2b, 0x61, 0x6f,
+    0x7a, 0x63, 0x79, 0x68, 0x48, 0x1f, 0x78, 0xef, 0x7b, 0xb7, 0x43, 0xc6, 0x99, 0xb7, 0xe1, 0x37,
+    0x2b, 0x90, 0x94, 0x0e, 0x1c, 0x38, 0x25, 0x2c, 0x2c, 0xd4, 0x58, 0x6d, 0x0b, 0x9c, 0xcf, 0xa7,
+    0xe0, 0x00, 0xf2, 0x90, 0x47, 0xc0, 0xd1, 0x99, 0x4d, 0xb7, 0xdd, 0x36, 0xbc, 0x76, 0xbb, 0x45,
+    0x80, 0x88, 0xcd, 0x61, 0xc4, 0x7f, 0xfc, 0xb7, 0x0b, 0xba, 0x29, 0xc4, 0x10, 0x1f, 0xf2, 0x24,
+    0x84, 0x7f, 0x6d, 0xbf, 0xed, 0xb6, 0xfc, 0x96, 0x1b, 0x90, 0x80, 0x30, 0xe7, 0x2b, 0x52, 0x11,
+    0x42, 0x01, 0xa6, 0xba, 0xac, 0xcb, 0x31, 0x39, 0x26, 0xc1, 0xb9, 0x90, 0xa6, 0xa5, 0xe9, 0xdc,
+    0xee, 0xf8, 0xee, 0xcc, 0x50, 0x7c, 0x48, 0x4c, 0x2a, 0x3a, 0xdf, 0xf1, 0x5b, 0xf8, 0xa4, 0x79,
+    0x8a, 0x96, 0xdd, 0xaa, 0x5f, 0xf6, 0xcb, 0xf5, 0xfd, 0xee, 0xfe, 0xb9, 0x26, 0x6d, 0xae, 0xb5,
+    0x7f, 0xc3, 0x8e, 0x72, 0xe3, 0xca, 0x8b, 0x40, 0xbe, 0x04, 0x7a, 0x12, 0xf5, 0xa3, 0xa7, 0xd0,
+    0x24, 0x3a, 0x84, 0xc6, 0xd9, 0x8b, 0x61, 0xe7, 0x0e, 0xe7, 0x2c, 0x07, 0xdc, 0xc0, 0xe7, 0x3e,
+    0xf7, 0x27, 0xc6, 0x6f, 0xfd, 0xd6, 0xbf, 0x81, 0x1b, 0x1e, 0xe7, 0x3d, 0x8f, 0x0e, 0xea, 0x7a,
+    0xa8, 0x0d, 0x0e, 0xba, 0x70, 0x1d, 0xd9, 0x73, 0x60, 0x81, 0xeb, 0x76, 0x71, 0xa4, 0x69, 0xa1,
+    0xb0, 0x79, 0x73, 0x24, 0xf4, 0xf5, 0x09, 0x88, 0x35, 0x56, 0x04, 0x61, 0x3a, 0x12, 0x84, 0x08,
+    0xc8, 0x85, 0x24, 0x59, 0xa6, 0x90, 0xac, 0xb3, 0xf2, 0x52, 0x96, 0x33, 0x22, 0xce, 0xb6, 0x3d,
+    0x5a, 0xab, 0x85, 0x9e, 0x24, 0x09, 0xa2, 0xa6, 0xa9, 0x8a, 0x28, 0xc6, 0xf8, 0xf1, 0x71, 0x4d,
+    0x99, 0x9c, 0x54, 0xd9, 0xfb, 0x1e, 0x2c, 0x97, 0x44, 0x33, 0x33, 0x5d, 0xbc, 0x7a, 0xb2, 0x8a,
+    0x86, 0x4e, 0x3f, 0x5a, 0xdd, 0xfe, 0x83, 0xff, 0x74, 0x7c, 0x6a, 0xf6, 0x0b, 0xd5, 0x81, 0x2c,
+    0x51, 0x04, 0x85, 0xb5, 0xdf, 0xc3, 0xb3, 0x37, 0x92, 0x18, 0xf7, 0x28, 0x38, 0x17, 0x3e, 0x8c,
+    0xc7, 0x35, 0x20, 0x07, 0x2b, 0xa0, 0x24, 0x62, 0x2a, 0xa5, 0x0e, 0x7e, 0xf4, 0xa3, 0x63, 0xc3,
+    0x7f, 0xf0, 0x07, 0x9b, 0x62, 0x7b, 0xf6, 0xc4, 0x29, 0xb8, 0x1a, 0xf6, 0x1c, 0xd0, 0x7d, 0xec,
+    0xb1, 0x4e, 0xfb, 0xfe, 0xfb, 0x59, 0x2e, 0xc0, 0xb7, 0x4f, 0x9c, 0x78, 0x01, 0x92, 0xca, 0x32,
+    0xa8, 0x5f, 0xcf, 0xb2, 0x32, 0xe9, 0xc0, 0xdd, 0xae, 0xdf, 0x79, 0xf4, 0xd1, 0x15, 0xe3, 0x89,
+    0x27, 0x9a, 0xde, 0x81, 0x03, 0x12, 0x37, 0x37, 0x27, 0x81, 0x29, 0xa9, 0xc6, 0x76, 0xec, 0xd0,
+    0x84, 0x89, 0x89, 0x38, 0xaf, 0xeb, 0x0a, 0x95, 0xa4, 0x34, 0xe4, 0x1c, 0x0a, 0x1c, 0x58, 0x9a,
+    0xca, 0x72, 0xbf, 0x96, 0x48, 0x44, 0xbe, 0xeb, 0x5a, 0x4a, 0xcd, 0x0f, 0x87, 0x51, 0x4a, 0xec,
+    0x5c, 0xb1, 0x35, 0x25, 0x70, 0xa2, 0x04, 0x87, 0x2f, 0xb0, 0xb6, 0x60, 0x44, 0x70, 0xf4, 0x22,
+    0x12, 0x59, 0xe5, 0x82, 0xc0, 0x27, 0x7e, 0x98, 0x55, 0xb3, 0x6a, 0x21, 0x51, 0x88, 0xb1, 0x1a,
+    0x2f, 0x13, 0xca, 0x44, 0xf1, 0xa6, 0xbe, 0x9b, 0x8a, 0x57, 0x0e, 0x5d, 0xa9, 0x8d, 0x66, 0x46,
+    0x25, 0x38, 0x72, 0xc1, 0x22, 0x36, 0x57, 0x75, 0xaa, 0xa8, 0x15, 0xb6, 0xdc, 0x46, 0xd0, 0xe8,
+    0xce, 0x47, 0xf3, 0xf5, 0x88, 0x8b, 0xd6, 0x7c, 0xcd, 0x06, 0xf9, 0x24, 0x54, 0x47, 0x49, 0xf4,
+    0x04, 0xca, 0xa3, 0xfd, 0xa8, 0x88, 0x8e, 0xa2, 0xad, 0xe8, 0x9c, 0xbf, 0x13, 0xb2, 0xb1, 0x2b,
+    0xe7, 0x14, 0x10, 0x8a, 0x95, 0x56, 0xcb, 0x7c, 0xfb, 0xca, 0x8a, 0xf7, 0x6e, 0x8e, 0xb3, 0x5e,
+    0x33, 0x32, 0xd2, 0xd1, 0xf3, 0x79, 0x4f, 0xc4, 0x38, 0x11, 0x2d, 0x2d, 0xc5, 0x6d, 0x70, 0xb7,
+    0xd1, 0xe6, 0xcd, 0x66, 0x3c, 0x95, 0xe2, 0x78, 0xc3, 0xd0, 0xdc, 0xd9, 0x59, 0xc1, 0xa1, 0x34,
+    0xe0, 0x37, 0x6d, 0x0a, 0x14, 0x50, 0x35, 0xb4, 0xb2, 0x42, 0xc3, 0xe5, 0x65, 0x1a, 0x04, 0x01,
+    0x17, 0xae, 0xac, 0x98, 0xd6, 0xd3, 0x4f, 0x77, 0x5a, 0x92, 0x14, 0x03, 0xc2, 0xc5, 0xe1, 0x86,
+    0x12, 0xa2, 0xd1, 0x51, 0x51, 0xfe, 0xc5, 0x5f, 0x4c, 0xe4, 0xc6, 0xc6, 0x04, 0xb9, 0x53, 0x6d,
+    0xa1, 0xca, 0xdf, 0x7f, 0xb3, 0x25, 0x7c, 0xe1, 0x2f, 0x4e, 0xc7, 0xbd, 0xb2, 0x9f, 0x7b, 0xdb,
+    0xdb, 0xfa, 0xf2, 0xb7, 0xdd, 0x56, 0xe4, 0xc6, 0xc7, 0xe3, 0x2e, 0x30, 0xbe, 0x0b, 0x79, 0x19,
+    0xf9, 0xc2, 0x17, 0xea, 0x91, 0xe7, 0xa9, 0x7e, 0x3c, 0x9e, 0x00, 0xef, 0x83, 0xe3, 0xae, 0x6b,
+    0xf3, 0x10, 0xeb, 0x03, 0x01, 0xee, 0x89, 0xcd, 0x9b, 0xb1, 0x94, 0xcb, 0x45, 0x0a, 0x18, 0x89,
+    0xe0, 0xc4, 0x09, 0xd3, 0x3f, 0x7d, 0xda, 0x85, 0x1d, 0xd4, 0xbb, 0x20, 0xbb, 0xbe, 0x6d, 0x2f,
+    0x86, 0xae, 0xeb, 0x45, 0x41, 0x40, 0x22, 0xd7, 0x0e, 0x09, 0x6b, 0x57, 0x8e, 0x06, 0x88, 0x0b,
+    0x29, 0x64, 0x98, 0x34, 0xe2, 0xd2, 0x19, 0x39, 0x7b, 0xe5, 0x95, 0x99, 0xd4, 0x96, 0x2d, 0xd9,
+    0x30, 0x08, 0x42, 0xbb, 0xd9, 0xf4, 0xcd, 0x46, 0x23, 0xc1, 0x07, 0x41, 0x0c, 0xc1, 0x78, 0xc8,
+    0x35, 0x88, 0x7c, 0xe8, 0xd0, 0x29, 0x0e, 0x14, 0x15, 0x0e, 0x1e, 0x47, 0xdd, 0x6e, 0xb7, 0x39,
+    0x33, 0xd3, 0x89, 0x3c, 0x37, 0xfc, 0xe6, 0x1f, 0xbc, 0x66, 0x60, 0xff, 0x40, 0x28, 0x39, 0x9e,
+    0x23, 0xb3, 0x8a, 0x02, 0x40, 0xbc, 0x6e, 0x10, 0x06, 0x96, 0x17, 0x78, 0x01, 0x6b, 0xed, 0x20,
+    0xa9, 0x25, 0x65, 0xf6, 0x4a, 0x1f, 0x0d, 0x68, 0x62, 0x93, 0xb4, 0x29, 0xf3, 0x86, 0xa1, 0x37,
+    0xa8, 0x9b, 0xf3, 0x9b, 0x39, 0x20, 0x27, 0x59, 0xe9, 0xac, 0x90, 0xa3, 0xcd, 0x23, 0xfe, 0xb1,
+    0xf6, 0x71, 0xbb, 0xec, 0x95, 0x3b, 0x47, 0xfc, 0x23, 0x2b, 0x6d, 0xda, 0x7e, 0x29, 0xb9, 0x08,
+    0x90, 0x6f, 0x09, 0xa5, 0xd0, 0x33, 0x40, 0xbc, 0x83, 0x68, 0x13, 0x3a, 0x81, 0x46, 0xce, 0x3d,
+    0xf9, 0x18, 0x5e, 0x15, 0x02, 0x32, 0x3c, 0xff, 0x3c, 0x29, 0x9c, 0x38, 0x61, 0xbd, 0xbb, 0x5c,
+    0xf6, 0x7f, 0x51, 0x96, 0xdb, 0x3b, 0xfa, 0xfb, 0x1b, 0xf1, 0x4c, 0x86, 0x48, 0x8e, 0x93, 0x77,
+    0xe6, 0xe7, 0x63, 0x56, 0x32, 0x59, 0xd3, 0x8a, 0xc5, 0x6e, 0x4c, 0xd3, 0xe2, 0xb4, 0xd9, 0x4c,
+    0x45, 0xd5, 0x6a, 0x84, 0xfb, 0xfb, 0xdb, 0x7c, 0x36, 0xcb, 0x5e, 0xfb, 0x8f, 0x91, 0xa5, 0x25,
+    0xc5, 0x2d, 0x97, 0x65, 0xb3, 0x03, 0xe9, 0xcc, 0xd3, 0x4f, 0x97, 0xdb, 0x9d, 0x8e, 0x88, 0x32,
+    0x99, 0xa4, 0x12, 0x45, 0x62, 0xc0, 0x9e, 0xae, 0xe4, 0x72, 0x58, 0xba, 0x2a, 0x3d, 0x27, 0xbe,
+    0xae, 0xf9, 0xa5, 0x40, 0x5a, 0x3a, 0xea, 0x88, 0xe9, 0xb4, 0x90, 0xbf, 0xe7, 0x9e, 0x71, 0x79,
+    0xcb, 0x16, 0x8d, 0x89, 0x80, 0x6d, 0x18, 0xd4, 0x3c, 0x79, 0xd2, 0xab, 0x3c, 0xf5, 0x14, 0xe7,
+    0x2e, 0x2f, 0x8b, 0x11, 0x38, 0x14, 0xbe, 0xd5, 0xea, 0x28, 0xaa, 0x2a, 0x13, 0x45, 0x89, 0xb1,
+    0x77, 0x00, 0x10, 0x6b, 0x77, 0xc5, 0x34, 0xbb, 0x5a, 0xab, 0xd5, 0x06, 0xd2, 0x04, 0x40, 0x4e,
+    0x1e, 0xdc, 0xab, 0xec, 0x05, 0x40, 0x04, 0xdf, 0xf5, 0x3b, 0x5e, 0x47, 0x31, 0xc3, 0x6e, 0xcc,
+    0x25, 0x76, 0xcc, 0xa7, 0x81, 0x4a, 0x31, 0x21, 0x22, 0xe1, 0xda, 0xfd, 0x85, 0xad, 0x9d, 0xc1,
+    0xad, 0x7b, 0x79, 0x31, 0xa1, 0x4b, 0x6e, 0xad, 0xe6, 0x7b, 0x8d, 0x06, 0xd0, 0x2f, 0x24, 0x9e,
+    0xef, 0xb3, 0xc6, 0x94, 0x74, 0x59, 0x14, 0x33, 0xe8, 0xea, 0xab, 0xb3, 0x2c, 0xe1, 0x05, 0x62,
+    0x97, 0xf1, 0xcc, 0x4c, 0xaf, 0x39, 0x10, 0x76, 0x31, 0x6c, 0xc8, 0x39, 0xbc, 0xa3, 0x47, 0x6b,
+    0xd5, 0x09, 0x4d, 0xfc, 0xf7, 0xbf, 0x26, 0xca, 0x03, 0xca, 0xc4, 0x70, 0x5a, 0x4c, 0xa7, 0x20,
+    0x45, 0x66, 0x2f, 0x1f, 0xb5, 0x0c, 0x62, 0x40, 0x5e, 0xcc, 0x13, 0xb6, 0xac, 0x0f, 0xfb, 0x82,
+    0x7c, 0x94, 0x65, 0xef, 0x87, 0x6c, 0x4d, 0x6e, 0xf5, 0xf3, 0x5a, 0x9e, 0xb4, 0xbc, 0x96, 0x7f,
+    0xd4, 0x3c, 0x6a, 0xac, 0xb8, 0x2b, 0x6e, 0x33, 0x6a, 0x3a, 0xd5, 0xa8, 0x6a, 0x42, 0x9a, 0xfd,
+    0x52, 0x47, 0xeb, 0x23, 0x0d, 0x1d, 0x87, 0x9c, 0xef, 0x39, 0x94, 0x43, 0x87, 0xa1, 0x3f, 0x8f,
+    0x76, 0xc0, 0xb8, 0x57, 0x09, 0xaf, 0x1a, 0x01, 0x19, 0x1e, 0x7f, 0xdc, 0x99, 0x5c, 0x58, 0x08,
+    0xee, 0x80, 0x6b, 0xf4, 0x66, 0x59, 0xee, 0x4e, 0x65, 0xb3, 0x86, 0x86, 0x90, 0x46, 0x4a, 0xa5,
+    0x84, 0x0d, 0xc1, 0x53, 0x28, 0x16, 0x1b, 0xb1, 0x4c, 0xc6, 0x95, 0xc3, 0x30, 0x8d, 0x57, 0x56,
+    0xb4, 0x48, 0x96, 0xcd, 0x28, 0x97, 0x6b, 0x0b, 0x90, 0x46, 0x41, 0x68, 0xcd, 0xb9, 0x0b, 0x0b,
+    0xec, 0x51, 0x5d, 0x14, 0x1c, 0x3c, 0xb8, 0x62, 0x3d, 0xff, 0x7c, 0xcb, 0x18, 0x18, 0xd0, 0xd3,
+    0xa2, 0x98, 0x06, 0xde, 0xc8, 0xfe, 0x38, 0x29, 0xd1, 0xdf, 0x8c, 0xfe, 0x94, 0xc4, 0x50, 0x9b,
+    0x95, 0x46, 0x60, 0x94, 0x48, 0xf0, 0xea, 0xad, 0xb7, 0x66, 0x20, 0xcc, 0xe2, 0x68, 0x75, 0xd5,
+    0x0f, 0x8f, 0x1f, 0x77, 0x60, 0x43, 0x5e, 0x27, 0x91, 0x48, 0x00, 0xa3, 0x43, 0xc5, 0xb6, 0x5d,
+    0x1e, 0x1c, 0x03, 0x2b, 0xe7, 0x21, 0x2c, 0xc1, 0x84, 0x1c, 0x90, 0x8b, 0xc5, 0x38, 0x88, 0xe7,
+    0x0a, 0xc9, 0x64, 0x44, 0xcf, 0x34, 0xb9, 0xe6, 0xb3, 0xcf, 0xb8, 0x96, 0xef, 0x2a, 0x20, 0x15,
+    0xba, 0xe1, 0x5b, 0x9a, 0xed, 0xb6, 0x78, 0x4e, 0x13, 0x91, 0x96, 0xee, 0x47, 0x6a, 0x2c, 0x19,
+    0x6a, 0x60, 0xde, 0x73, 0x99, 0x81, 0x0e, 0x6f, 0xb9, 0x36, 0x98, 0x0b, 0x10, 0x23, 0xd6, 0x38,
+    0xd2, 0x8b, 0x85, 0x79, 0x0e, 0xe4, 0x03, 0x10, 0xaa, 0x25, 0x05, 0xa1, 0x3c, 0x7e, 0xcd, 0x6b,
+    0xb2, 0xc0, 0x22, 0x09, 0xb6, 0x6b, 0x89, 0xcf, 0x3f, 0x7f, 0x82, 0x4d, 0x67, 0x0d, 0x89, 0x98,
+    0xdb, 0xb6, 0x6d, 0x22, 0xec, 0x1d, 0x84, 0x6f, 0x7c, 0xfd, 0xc0, 0xe7, 0x7e, 0x99, 0x13, 0x2b,
+    0xbb, 0x76, 0x0d, 0x8e, 0x25, 0xc6, 0x8a, 0x12, 0x27, 0x2a, 0x0d, 0xb7, 0xe1, 0x57, 0x83, 0x6a,
+    0x13, 0xec, 0xad, 0x11, 0x46, 0x41, 0x64, 0xbb, 0x4e, 0x1c, 0xd2, 0xc2, 0x9c, 0x24, 0x49, 0xae,
+    0xc7, 0x79, 0xe5, 0x9a, 0x5f, 0x6d, 0x96, 0x83, 0x8a, 0xc9, 0xaa, 0xbb, 0x0c, 0x8a, 0x83, 0xc9,
+    0x24, 0x97, 0x54, 0x61, 0xfe, 0x6e, 0x99, 0x96, 0xd7, 0xea, 0x14, 0x72, 0xa8, 0x05, 0xf9, 0xde,
+    0x0b, 0x28, 0x0d, 0x5d, 0x06, 0xcc, 0xc6, 0x75, 0xa8, 0x0c, 0x67, 0xe6, 0x9c, 0x19, 0x8e, 0x1f,
+    0x85, 0x57, 0x95, 0x80, 0x70, 0xbe, 0xf1, 0xa3, 0x8f, 0x9a, 0xdb, 0x20, 0x9c, 0xbe, 0xb3, 0x5a,
+    0x75, 0xdf, 0x48, 0x48, 0x30, 0xce, 0xbc, 0x84, 0xef, 0x2b, 0xec, 0x11, 0x1c, 0x8d, 0xc7, 0x1d,
+    0x31, 0x99, 0x34, 0x14, 0x8c, 0x25, 0xae, 0xd1, 0xd0, 0x08, 0xcf, 0xa3, 0x30, 0x93, 0x69, 0x0a,
+    0xc9, 0x64, 0x3b, 0x26, 0xcb, 0x09, 0xd4, 0x6a, 0xe5, 0x5c, 0x50, 0x3e, 0xf7, 0xc4, 0x89, 0xba,
+    0xf1, 0xbd, 0xef, 0x2d, 0x55, 0x08, 0x11, 0x38, 0x55, 0x4d, 0x88, 0x49, 0x48, 0x08, 0x3f, 0x60,
+    0x7e, 0x22, 0x76, 0x55, 0xa6, 0xd4, 0x7b, 0x9b, 0x6c, 0xed, 0xf9, 0xc8, 0xda, 0xf3, 0xfd, 0xb5,
+    0x42, 0x9c, 0x35, 0xf4, 0x9c, 0x0b, 0xdb, 0x89, 0xf5, 0xdf, 0x0c, 0x6c, 0x94, 0xfa, 0xba, 0xd7,
+    0x25, 0xe3, 0xb7, 0xdd, 0x96, 0x15, 0x26, 0x27, 0x35, 0x90, 0x06, 0xce, 0x04, 0x17, 0x5b, 0x3a,
+    0x79, 0x02, 0x2d, 0x7c, 0xf2, 0xe3, 0x28, 0x16, 0x10, 0xc8, 0x3d, 0x25, 0xe4, 0x69, 0x1a, 0x12,
+    0xb2, 0x59, 0x92, 0x4a, 0xe8, 0x8e, 0xae, 0xaa, 0x16, 0x0b, 0x9f, 0xf6, 0xd2, 0x92, 0xcb, 0xd4,
+    0x8e, 0xd9, 0xf1, 0x75, 0xf4, 0x06, 0x7a, 0x57, 0x18, 0xc6, 0xb1, 0x27, 0x35, 0x2e, 0xd8, 0x7e,
+    0xb8, 0xa3, 0x0a, 0xf2, 0x8e, 0x1d, 0x8a, 0x9b, 0xcb, 0xe5, 0x79, 0xd7, 0x75, 0xb5, 0xe7, 0x9e,
+    0x3b, 0xca, 0xc8, 0xc7, 0x66, 0xb3, 0xb7, 0x6e, 0x1d, 0x07, 0xa3, 0x93, 0x11, 0x56, 0x56, 0xca,
+    0x73, 0x27, 0xbf, 0x76, 0xf8, 0x2f, 0x7e, 0x73, 0x32, 0x33, 0x96, 0x9a, 0xcc, 0xc5, 0xf9, 0x78,
+    0xd2, 0xb4, 0x4d, 0xb5, 0xe2, 0x00, 0xb1, 0x39, 0xc4, 0x8e, 0x8b, 0xb4, 0xdd, 0x0e, 0xf6, 0x88,
+    0x2f, 0x42, 0x1e, 0x18, 0xe8, 0xaa, 0xee, 0xf3, 0x90, 0x1e, 0x3b, 0xae, 0x03, 0x31, 0x5b, 0xe6,
+    0x8b, 0x72, 0x31, 0xcd, 0xbc, 0xd4, 0x8a, 0xb3, 0xd2, 0x78, 0xd2, 0x79, 0x72, 0x26, 0x90, 0x82,
+    0x79, 0xc8, 0xf7, 0x0e, 0x40, 0x77, 0x04, 0x15, 0xd0, 0x49, 0xb4, 0x17, 0x9d, 0x93, 0x82, 0xe6,
+    0x9f, 0x84, 0x73, 0x6e, 0x42, 0x5e, 0x0a, 0xf6, 0x26, 0xfe, 0xe7, 0x3e, 0xf7, 0x1f, 0xeb, 0x96,
+    0xc5, 0x9e, 0x3e, 0x44, 0x82, 0xe7, 0x71, 0x31, 0xcf, 0x13, 0x62, 0x94, 0x42, 0xfa, 0x0d, 0x46,
+    0x97, 0x3d, 0xc1, 0x24, 0x44, 0xc5, 0x9e, 0xa7, 0x41, 0x00, 0x94, 0x7c, 0x56, 0x43, 0x26, 0x08,
+    0x94, 0x80, 0x10, 0x09, 0xf8, 0x24, 0x0a, 0xbd, 0x86, 0x77, 0x79, 0x81, 0xb3, 0xac, 0x10, 0x72,
+    0x42, 0xcb, 0x6e, 0xb5, 0x5c, 0xb7, 0xdb, 0x35, 0xdd, 0xeb, 0xc3, 0xef, 0x17, 0xd2, 0xc7, 0x3e,
+    0x3d, 0x0c, 0x29, 0x92, 0xaf, 0x69, 0x9a, 0xcf, 0x03, 0xa9, 0x18, 0xc9, 0x36, 0x88, 0xc6, 0x5c,
+    0x2e, 0x6b, 0x74, 0xc0, 0xaa, 0xd5, 0xec, 0xee, 0xea, 0xaa, 0x61, 0x96, 0xcb, 0x16, 0x7b, 0xd8,
+    0x2c, 0x69, 0x9a, 0x18, 0x07, 0x95, 0xcc, 0xfc, 0xee, 0xef, 0x8e, 0x08, 0x85, 0x82, 0xe4, 0x5a,
+    0x16, 0x5e, 0x7e, 0xf6, 0x49, 0x74, 0xf8, 0xf3, 0x9f, 0x42, 0xcb, 0x9f, 0xff, 0x1c, 0xd2, 0x79,
+    0x19, 0xe9, 0xf1, 0x54, 0x24, 0x25, 0x93, 0x76, 0x66, 0x78, 0xa4, 0x3d, 0x98, 0x2f, 0x34, 0x39,
+    0xc7, 0x69, 0x97, 0x0f, 0x1d, 0x6a, 0x1a, 0xf3, 0xf3, 0x0e, 0x72, 0x9c, 0x33, 0xcc, 0x03, 0xac,
+    0x91, 0x8f, 0xf1, 0x8a, 0x39, 0xa6, 0x35, 0x7e, 0x81, 0xb0, 0x12, 0x0a, 0x06, 0x47, 0x53, 0x3d,
+    0xaf, 0x81, 0x06, 0x06, 0x52, 0xb8, 0x50, 0x60, 0xc5, 0xe7, 0x2e, 0x86, 0xfc, 0x10, 0xe6, 0x63,
+    0xcd, 0x35, 0x48, 0x7e, 0x32, 0x99, 0x44, 0xba, 0x1e, 0xcf, 0x2c, 0x74, 0x5b, 0x33, 0xd3, 0x94,
+    0xd6, 0xb3, 0x88, 0xf8, 0xd4, 0xa7, 0x56, 0x68, 0x84, 0xdd, 0xd0, 0x08, 0x58, 0xeb, 0x09, 0x04,
+    0x51, 0xde, 0xe5, 0x1c, 0x97, 0x88, 0xb4, 0x5d, 0x90, 0x0b, 0x72, 0x56, 0xce, 0x6a, 0x9a, 0xa4,
+    0x89, 0x29, 0x3e, 0xa5, 0x15, 0xc5, 0x62, 0x3a, 0x29, 0x26, 0x21, 0x25, 0xa0, 0x51, 0x3b, 0x6a,
+    0xaf, 0x2c, 0x48, 0x0b, 0x8f, 0xd0, 0x0c, 0x7d, 0x12, 0xf5, 0x01, 0x01, 0x47, 0x80, 0x7c, 0x3b,
+    0x7b, 0x04, 0x3e, 0x2f, 0xf0, 0xaa, 0x2a, 0xe0, 0x4b, 0x71, 0xe8, 0x90, 0x3d, 0x5c, 0xa9, 0x90,
+    0x37, 0x96, 0x4a, 0xd1, 0x6b, 0x0c, 0x83, 0xdf, 0x86, 0x90, 0x37, 0x1c, 0x8b, 0x39, 0x19, 0xa0,
+    0x18, 0x90, 0x50, 0x86, 0x5c, 0x5f, 0x74, 0x3d, 0x8f, 0xb5, 0xaa, 0x40, 0x21, 0x42, 0xb2, 0x42,
+    0x6b, 0xf6, 0xd4, 0x04, 0x0b, 0xac, 0x4a, 0xd7, 0xdc, 0x5c, 0xdd, 0x7e, 0xf8, 0xe1, 0xa5, 0x1a,
+    0x44, 0x54, 0x5b, 0x72, 0x6d, 0xfc, 0xdb, 0xf4, 0x3f, 0x5e, 0x2e, 0x96, 0x8e, 0x86, 0x12, 0xfb,
+    0x92, 0x0d, 0x84, 0xde, 0xe2, 0xce, 0x9d, 0x5e, 0x3a, 0x93, 0xb1, 0xa4, 0x4e, 0xc7, 0x42, 0x90,
+    0x8b, 0x19, 0x95, 0x8a, 0xd9, 0x3c, 0x71, 0xa2, 0x05, 0xc6, 0x63, 0x2d, 0x37, 0x02, 0x82, 0x26,
+    0xc1, 0x28, 0x70, 0x03, 0xb9, 0x62, 0x8d, 0x5a, 0x19, 0x37, 0x9b, 0x4c, 0x21, 0x12, 0x62, 0xbb,
+    0x56, 0x46, 0x4e, 0xa7, 0x11, 0x72, 0x58, 0xb0, 0xf3, 0x85, 0x2d, 0x4e, 0x7e, 0x70, 0xc2, 0xd3,
+    0xf3, 0x85, 0x40, 0x4d, 0x26, 0x59, 0x89, 0x38, 0x5d, 0x39, 0x78, 0xd0, 0x00, 0x02, 0x7b, 0x70,
+    0x17, 0x70, 0x32, 0x48, 0x76, 0x6f, 0x5d, 0xaf, 0x50, 0xbd, 0x1e, 0xf9, 0xd8, 0x20, 0xfb, 0x05,
+    0xc3, 0x4c, 0x8d, 0x61, 0xbb, 0xa9, 0xec, 0x65, 0x97, 0x11, 0xf9, 0x83, 0x1f, 0x9c, 0xe0, 0x74,
+    0x5d, 0x80, 0xbc, 0x10, 0x85, 0x07, 0x0f, 0xb6, 0x83, 0xfb, 0xee, 0x9b, 0xc5, 0x82, 0xc0, 0xdb,
+    0x7b, 0xf6, 0x6c, 0xf3, 0x30, 0x16, 0x63, 0xcf, 0x3f, 0x7f, 0xec, 0x91, 0xd1, 0xa5, 0xce, 0x57,
+    0xde, 0x9c, 0xd6, 0xa2, 0x30, 0xe2, 0xe4, 0x50, 0x56, 0x09, 0x61, 0x4d, 0x8b, 0x51, 0xde, 0x8e,
+    0xec, 0xa8, 0x19, 0xd5, 0xdb, 0xa0, 0xf7, 0x68, 0x52, 0x9e, 0x2c, 0xe6, 0xe5, 0x7c, 0x92, 0x59,
+    0xdc, 0xc8, 0x8f, 0x22, 0x3e, 0xe0, 0x39, 0xca, 0x53, 0xdb, 0x11, 0x9c, 0xc3, 0xcb, 0x78, 0xf9,
+    0xbb, 0x07, 0xd4, 0x03, 0x4f, 0x9a, 0xba, 0x79, 0x02, 0x5d, 0x0b, 0xae, 0xf7, 0x55, 0x0e, 0xb9,
+    0xaf, 0xc4, 0x79, 0x43, 0x40, 0x86, 0xc5, 0x45, 0xa2, 0x56, 0x2a, 0xe1, 0xce, 0x7a, 0x9d, 0x5c,
+    0x63, 0x59, 0xc1, 0xee, 0x20, 0xf0, 0xb7, 0x82, 0x28, 0xf4, 0x81, 0x12, 0xa6, 0x58, 0x7d, 0x19,
+    0xdb, 0x16, 0xc1, 0x03, 0x20, 0x8f, 0xe3, 0x02, 0x76, 0x3d, 0x81, 0x88, 0xac, 0x49, 0x0d, 0x47,
+    0x9c, 0x9d, 0xad, 0xf1, 0x47, 0x8f, 0xb6, 0xbb, 0xe5, 0xb2, 0x5b, 0xde, 0xa7, 0x9f, 0x8c, 0xbf,
+    0xb9, 0xf9, 0x97, 0x54, 0xe4, 0x38, 0x1b, 0xb1, 0xe2, 0x94, 0x91, 0x91, 0x22, 0xde, 0xbc, 0x79,
+    0x42, 0x91, 0x24, 0x64, 0x1d, 0x3c, 0xe8, 0xb9, 0x8f, 0x3f, 0x6e, 0x91, 0x76, 0xbb, 0xce, 0x43,
+    0xba, 0xa5, 0x24, 0x93, 0xbe, 0x36, 0x36, 0x26, 0x39, 0x09, 0x2d, 0x55, 0xaa, 0xce, 0x14, 0x03,
+    0xe2, 0x6a, 0x85, 0xb1, 0x2d, 0x38, 0xe8, 0x74, 0x96, 0x91, 0xed, 0x76, 0x24, 0x31, 0xe6, 0x2b,
+    0x89, 0x2c, 0x91, 0x33, 0x19, 0x49, 0xcd, 0x66, 0x45, 0x35, 0x93, 0x11, 0x34, 0xe8, 0x82, 0x6e,
+    0x37, 0x2c, 0x1f, 0x38, 0x60, 0xc2, 0x5d, 0x41, 0x40, 0xa6, 0xf1, 0x4b, 0xc2, 0x48, 0xaf, 0x10,
+    0xfb, 0x15, 0xc4, 0x63, 0x27, 0x99, 0x82, 0x33, 0xea, 0x55, 0xc3, 0x66, 0x44, 0xf5, 0x10, 0x4a,
+    0x6c, 0xba, 0xf7, 0xde, 0x71, 0xb5, 0xbf, 0xbf, 0xf7, 0x7a, 0x01, 0x23, 0x60, 0x00, 0x07, 0x66,
+    0x00, 0x01, 0xfd, 0x47, 0x1f, 0x6d, 0xd1, 0x42, 0x41, 0xf7, 0x36, 0x6d, 0x1a, 0x95, 0xf6, 0xef,
+    0x3f, 0xd6, 0x88, 0x2a, 0xd6, 0x47, 0xee, 0x8a, 0xb8, 0x82, 0x34, 0x9a, 0xef, 0x13, 0xfa, 0x92,
+    0xac, 0xec, 0x08, 0xd4, 0x90, 0x54, 0xbd, 0xaa, 0x71, 0xd2, 0x3d, 0x59, 0x0a, 0xb9, 0x30, 0x98,
+    0x96, 0xa6, 0x8b, 0xa0, 0x82, 0x3a, 0xac, 0x9e, 0x7a, 0xbe, 0x67, 0x81, 0xc0, 0x2f, 0x0a, 0x31,
+    0xe1, 0x20, 0x8d, 0xd1, 0xe7, 0x13, 0x7a, 0xe2, 0xd0, 0x37, 0xe8, 0x37, 0x8e, 0x95, 0xf6, 0x96,
+    0xce, 0x7d, 0x1b, 0xd8, 0xff, 0x0b, 0x38, 0xaf, 0x08, 0xb8, 0x81, 0x4a, 0x85, 0xc6, 0x97, 0x97,
+    0xfd, 0x09, 0xc7, 0x41, 0x5b, 0x1d, 0x27, 0x98, 0x80, 0x4b, 0x34, 0x01, 0xb6, 0x60, 0x18, 0x08,
+    0xa8, 0x74, 0xbb, 0x98, 0x8b, 0xa2, 0x00, 0xd2, 0xa8, 0x80, 0xf7, 0xbc, 0x80, 0x36, 0x1a, 0x06,
+    0x5e, 0x5a, 0xea, 0x40, 0x58, 0xc6, 0x35, 0xcf, 0x89, 0x8e, 0xbc, 0x79, 0xe5, 0xbe, 0xdd, 0x85,
+    0xd6, 0x81, 0x24, 0x2b, 0xcb, 0xeb, 0x3d, 0xc7, 0x82, 0x90, 0xc6, 0x5d, 0x73, 0xcd, 0x2e, 0x45,
+    0x51, 0x78, 0xf6, 0x65, 0x91, 0xf6, 0x23, 0x8f, 0x1c, 0x77, 0xca, 0xe5, 0x7c, 0xd8, 0xe9, 0x0c,
+    0x6c, 0x7f, 0xcf, 0x7b, 0x78, 0x55, 0xd7, 0x51, 0x04, 0x79, 0xd9, 0xe1, 0xcf, 0x7e, 0x16, 0xfc,
+    0xa1, 0xcf, 0xda, 0x08, 0xae, 0x80, 0xbc, 0x1e, 0xc4, 0xc9, 0xa4, 0x0c, 0xce, 0x59, 0x96, 0xb2,
+    0x59, 0x59, 0xc9, 0xe5, 0x7a, 0x04, 0x8c, 0x65, 0xb3, 0x02, 0xcb, 0xf1, 0x5a, 0xc7, 0x8e, 0x59,
+    0x1b, 0x04, 0x5b, 0xc7, 0x1a, 0xf1, 0x18, 0xd6, 0xc9, 0xc7, 0x88, 0xc7, 0xc0, 0xf2, 0x30, 0x36,
+    0xce, 0x05, 0xe5, 0x65, 0xb5, 0xc7, 0x62, 0xa0, 0x70, 0xe2, 0xe5, 0x97, 0x27, 0xa7, 0xef, 0xb9,
+    0x67, 0x52, 0x10, 0x04, 0x98, 0x04, 0xaa, 0xc5, 0x08, 0x08, 0xfb, 0xd0, 0xfa, 0xfb, 0xbf, 0xaf,
+    0x1a, 0x7f, 0xf9, 0x97, 0xbd, 0x5a, 0x28, 0x94, 0xd5, 0xce, 0x08, 0xc3, 0x08, 0x8e, 0x93, 0x7c,
+    0xfe, 0x5d, 0x52, 0xc5, 0x9e, 0xd8, 0x32, 0x02, 0x6e, 0x78, 0x14, 0x0c, 0x86, 0xc6, 0xde, 0x6c,
+    0x5b, 0xf6, 0x96, 0x5b, 0x07, 0xed, 0x83, 0xab, 0x0e, 0x71, 0xfc, 0x98, 0x10, 0x23, 0x7d, 0x72,
+    0x1f, 0x49, 0xc8, 0x89, 0x4a, 0x57, 0xe8, 0x1e, 0xad, 0x49, 0xb5, 0x63, 0x6e, 0xd2, 0x9d, 0xdd,
+    0x9c, 0xdc, 0xbc, 0xfc, 0xba, 0xe9, 0xd7, 0x35, 0xcf, 0xe7, 0xcf, 0x77, 0x9d, 0x97, 0x04, 0xdc,
+    0x00, 0x5c, 0x1c, 0xfc, 0xc2, 0x0b, 0x54, 0x4b, 0x24, 0xdc, 0x2c, 0xfc, 0xea, 0xb3, 0x6d, 0x29,
+    0xdd, 0xe9, 0x44, 0xf1, 0x20, 0xa0, 0x09, 0xd7, 0x0d, 0x84, 0x66, 0x33, 0xf4, 0x4f, 0x9f, 0x36,
+    0x8d, 0x95, 0x15, 0xbf, 0x3b, 0x38, 0x28, 0x75, 0x73, 0xcd, 0x59, 0x73, 0xfc, 0x1f, 0x3e, 0xfa,
+    0x27, 0x12, 0xf1, 0x32, 0xbd, 0x0a, 0x84, 0x10, 0x5a, 0x01, 0x98, 0x9b, 0x9e, 0x1e, 0x8a, 0x4d,
+    0x4c, 0x0c, 0x02, 0x6b, 0xbd, 0xe6, 0x23, 0x8f, 0x1c, 0x64, 0x2b, 0xf6, 0x39, 0x2e, 0xb1, 0xe9,
+    0x8a, 0x2b, 0x46, 0x12, 0xf1, 0x78, 0xac, 0x3e, 0x3b, 0x8b, 0x66, 0xbf, 0xf2, 0x15, 0xb0, 0x1b,
+    0x20, 0xa9, 0x3c, 0xff, 0x28, 0x17, 0x8f, 0x7b, 0xe0, 0x74, 0x64, 0x30, 0x19, 0x8a, 0x9c, 0xcd,
+    0x4a, 0x2a, 0x10, 0x50, 0xcb, 0xe5, 0xc4, 0xc8, 0x02, 0xaf, 0x71, 0xf2, 0xa4, 0xdd, 0x23, 0x19,
+    0xdb, 0xbf, 0xb5, 0x6e, 0x83, 0x6b, 0x4c, 0xca, 0xce, 0xfc, 0x90, 0x76, 0xed, 0xd2, 0xe5, 0x5b,
+    0x6f, 0x1d, 0x60, 0xcd, 0xae, 0x82, 0xe3, 0xee, 0xb4, 0xbe, 0xf0, 0x85, 0x05, 0x58, 0x3e, 0x88,
+    0x03, 0xeb, 0x52, 0x6f, 0x7a, 0x53, 0x76, 0xea, 0xf7, 0x7e, 0x6f, 0x8c, 0x07, 0x69, 0x67, 0xd8,
+    0x20, 0x60, 0xe5, 0x0b, 0x5f, 0x28, 0xb5, 0x3f, 0xfb, 0xd9, 0x95, 0xde, 0xc8, 0x0d, 0xc0, 0xb6,
+    0x96, 0xb6, 0xc5, 0x9f, 0x9d, 0xbd, 0xeb, 0xb6, 0x05, 0x14, 0xa0, 0xcd, 0x66, 0x60, 0xa6, 0x2a,
+    0x4e, 0x05, 0x1d, 0xf5, 0x8f, 0xd6, 0x4f, 0x84, 0x27, 0x5a, 0x02, 0x11, 0x7c, 0x45, 0x52, 0x3a,
+    0xaa, 0xa6, 0xd6, 0xa8, 0x42, 0x4b, 0xc7, 0xd4, 0x63, 0x0b, 0x7e, 0xde, 0xaf, 0xa0, 0x67, 0x90,
+    0x81, 0xee, 0x60, 0x2f, 0x73, 0x9e, 0xdf, 0x38, 0xaf, 0x09, 0xf8, 0x4f, 0x81, 0x91, 0x73, 0x9d,
+    0x5f, 0x67, 0x08, 0xf0, 0xc2, 0xdb, 0xdf, 0x3e, 0xb4, 0x3c, 0x3f, 0xff, 0xff, 0x89, 0xe0, 0x4e,
+    0xd8, 0x63, 0xf8, 0x9e, 0xa5, 0x65, 0x7f, 0xec, 0x01, 0xf3, 0xd6, 0xad, 0xc3, 0x12, 0x0c, 0x9b,
+    0x47, 0x8f, 0x2e, 0xf6, 0x4c, 0x08, 0xc6, 0x82, 0x29, 0x8a, 0x64, 0x6c, 0x68, 0x68, 0x62, 0xe9,
+    0x1b, 0xdf, 0x48, 0x53, 0x9b, 0x3d, 0x34, 0xc3, 0x65, 0x98, 0xf7, 0x00, 0x97, 0x48, 0x48, 0x82,
+    0xae, 0xcb, 0x22, 0xa8, 0x9f, 0x9c, 0xcb, 0xc9, 0x40, 0x3e, 0x49, 0x90, 0x65, 0x6c, 0xae, 0x93,
+    0xef, 0x1f, 0x11, 0x8f, 0x8d, 0x5b, 0x57, 0x44, 0xd8, 0x25, 0x0a, 0x0e, 0x37, 0x91, 0xfb, 0x9d,
+    0xdf, 0xd9, 0xcc, 0x96, 0x61, 0xcf, 0x82, 0x19, 0xb9, 0x9a, 0x8f, 0x3e, 0x5a, 0x6f, 0x7c, 0xfa,
+    0xd3, 0x33, 0x1a, 0xb0, 0x2e, 0xb6, 0x6d, 0x5b, 0xfc, 0xf2, 0xfb, 0xee, 0xdb, 0xc2, 0x54, 0x7a,
+    0x03, 0xac, 0x72, 0xe3, 0xa9, 0x0f, 0x7d, 0xe8, 0xb8, 0x77, 0xe4, 0xc8, 0x8b, 0x06, 0x61, 0x9d,
+    0xe8, 0x11, 0x8e, 0x8e, 0x77, 0xee, 0xfb, 0xb7, 0xff, 0xca, 0xd5, 0x70, 0xbe, 0x1c, 0x96, 0xf5,
+    0x27, 0xec, 0x27, 0xa2, 0xef, 0x92, 0xef, 0x7a, 0x42, 0x28, 0xe0, 0x04, 0x4a, 0x84, 0xba, 0xa0,
+    0x5b, 0x9b, 0x62, 0x9b, 0xba, 0x28, 0x86, 0xda, 0xf7, 0x8f, 0xdd, 0xef, 0xc1, 0x4e, 0xbc, 0xb8,
+    0x6f, 0xe7, 0x39, 0x7e, 0x6e, 0x09, 0xf8, 0xa3, 0xf0, 0xd4, 0x9b, 0xdf, 0x3c, 0xd5, 0x2c, 0x97,
+    0x3f, 0x2b, 0x70, 0x9c, 0xc0, 0x6a, 0x70, 0x31, 0xf2, 0x41, 0x9f, 0x29, 0x1b, 0x23, 0xd7, 0x5a,
+    0xa5, 0xc1, 0xde, 0x5f, 0xaf, 0xc3, 0x6d, 0x8c, 0x39, 0x01, 0x72, 0xc3, 0xe0, 0xc8, 0x91, 0x31,
+    0xbe, 0xd5, 0xca, 0xc0, 0x55, 0x7b, 0x86, 0x93, 0xa4, 0x3a, 0x17, 0x8b, 0x49, 0xec, 0x85, 0x11,
+    0x16, 0x7e, 0x59, 0x07, 0x79, 0x9f, 0xe8, 0x55, 0x2a, 0x90, 0x7a, 0xf9, 0xec, 0x71, 0xdb, 0x8f,
+    0x24, 0x1e, 0x03, 0x23, 0x1f, 0xeb, 0x0f, 0xdd, 0x73, 0xcf, 0x94, 0xbe, 0x73, 0x67, 0x82, 0x6d,
+    0x87, 0x11, 0x90, 0xd5, 0xf3, 0xb3, 0xdb, 0xed, 0xe8, 0xf8, 0x5d, 0x77, 0x1d, 0x50, 0x41, 0xed,
+    0xd8, 0xbe, 0x6d, 0xfe, 0xc3, 0x3f, 0xdc, 0x54, 0xdc, 0xb7, 0x0f, 0x72, 0x5b, 0x58, 0x08, 0xe6,
+    0x29, 0xfd, 0xf7, 0xff, 0x5e, 0xae, 0xdc, 0x77, 0xdf, 0xda, 0x2b, 0x00, 0xeb, 0xc4, 0xdb, 0x40,
+    0x18, 0x45, 0x8e, 0xde, 0xe9, 0xbc, 0x63, 0xcb, 0xc9, 0x93, 0xf5, 0xf5, 0x51, 0x6c, 0x4b, 0x6b,
+    0xd7, 0xee, 0xe7, 0x88, 0x6c, 0x3f, 0x0a, 0x2f, 0x2d, 0x16, 0xfb, 0xb9, 0x07, 0x27, 0xcb, 0xd1,
+    0x19, 0xd2, 0x6d, 0xf4, 0xd7, 0xc9, 0xc7, 0x7e, 0xb3, 0x6e, 0x6d, 0x90, 0xfd, 0x60, 0xd5, 0xda,
+    0x7b, 0xd3, 0xa9, 0xb4, 0x7d, 0xfb, 0x22, 0x8a, 0xc7, 0x0d, 0xb8, 0x92, 0xf5, 0x1e, 0x9d, 0x58,
+    0x62, 0x06, 0xf9, 0x1a, 0x05, 0xe3, 0xc0, 0x8a, 0x6b, 0xfc, 0x56, 0x2b, 0x78, 0x25, 0xf9, 0xf8,
+    0x4d, 0x9b, 0x62, 0xfc, 0x4d, 0x37, 0xf5, 0x71, 0xbb, 0x77, 0xb3, 0x8a, 0x05, 0x67, 0xc8, 0x07,
+    0xc0, 0xfa, 0xd4, 0x94, 0x06, 0x40, 0xac, 0x53, 0x55, 0xb5, 0xd7, 0x41, 0x1e, 0xc1, 0x31, 0x25,
+    0x66, 0xe4, 0x62, 0x1b, 0x3f, 0xfd, 0x9f, 0xfe, 0x53, 0x69, 0xe9, 0x13, 0x9f, 0x58, 0x65, 0x61,
+    0xf7, 0xf4, 0xef, 0xfd, 0xde, 0xc9, 0xca, 0x7f, 0xfb, 0x6f, 0xff, 0x88, 0x7c, 0xb0, 0x1b, 0x6b,
+    0xe0, 0x38, 0xa5, 0x23, 0xcb, 0xdb, 0xd6, 0x47, 0xaf, 0x81, 0x11, 0xef, 0xe7, 0x9c, 0x7c, 0x0c,
+    0x17, 0x14, 0x01, 0x75, 0x41, 0x70, 0x59, 0x5b, 0xbb, 0x8c, 0x61, 0xaf, 0x24, 0x5f, 0xcf, 0x90,
+    0xb0, 0xc1, 0x1e, 0x0d, 0x01, 0xf0, 0x3f, 0x64, 0x60, 0x2c, 0x7e, 0xb3, 0x4a, 0x08, 0x84, 0xdb,
+    0xba, 0xf5, 0x34, 0x24, 0xfe, 0xac, 0x62, 0x70, 0x8f, 0x74, 0x14, 0x4c, 0x03, 0x09, 0xc0, 0xdb,
+    0x78, 0x5e, 0x14, 0x9a, 0x66, 0xd8, 0x9b, 0x0f, 0x00, 0x74, 0x40, 0xf1, 0x3b, 0xee, 0x18, 0xcc,
+    0xfe, 0xee, 0xef, 0x4e, 0x67, 0x7f, 0xe9, 0x97, 0x06, 0xd2, 0x77, 0xdd, 0x35, 0xa1, 0xbe, 0xef,
+    0x7d, 0x63, 0x6c, 0xda, 0xba, 0x31, 0xa1, 0xac, 0x06, 0x34, 0xab, 0x5a, 0x2d, 0x8a, 0x22, 0x92,
+    0x65, 0x19, 0xb1, 0x86, 0x86, 0x70, 0xa7, 0xe3, 0x51, 0xc8, 0x01, 0x7b, 0x33, 0x00, 0x22, 0xc7,
+    0x71, 0x5b, 0x0f, 0x3d, 0x64, 0xae, 0x7e, 0xea, 0x53, 0x2b, 0xe6, 0x93, 0x4f, 0x76, 0x7b, 0xcb,
+    0xbe, 0x82, 0x7c, 0xeb, 0x83, 0x3d, 0x70, 0xa2, 0xb8, 0x7b, 0x7d, 0xf0, 0x82, 0xc2, 0x05, 0x45,
+    0x40, 0x21, 0x93, 0x31, 0x39, 0x9e, 0xb7, 0x37, 0xc8, 0xc7, 0x32, 0x70, 0x46, 0x89, 0x97, 0x91,
+    0x8f, 0x4d, 0x5b, 0xeb, 0x30, 0xf8, 0x01, 0x9a, 0xd8, 0xb9, 0x33, 0xc5, 0x94, 0x89, 0x7d, 0x5c,
+    0x98, 0x1f, 0x1f, 0x4f, 0xf4, 0xae, 0xfb, 0x1a, 0x09, 0x09, 0xa8, 0x5e, 0x14, 0x3a, 0x4e, 0xe4,
+    0x03, 0x19, 0x19, 0x1b, 0xd8, 0xc7, 0x47, 0x14, 0x30, 0x17, 0x85, 0xb7, 0xbe, 0xb5, 0x98, 0x4c,
+    0xa5, 0x90, 0x0e, 0x0e, 0x9a, 0x75, 0xe9, 0xd7, 0xbe, 0x36, 0x23, 0x4c, 0x4e, 0xf6, 0xbe, 0x31,
+    0xc2, 0xc2, 0x69, 0xfb, 0xb1, 0xc7, 0xce, 0xbc, 0xc8, 0xc4, 0xb6, 0xc7, 0xf6, 0xa7, 0xf6, 0xe0,
+    0x83, 0x25, 0x50, 0x5c, 0x18, 0xec, 0xd1, 0x9f, 0x55, 0x4a, 0x0c, 0x43, 0x9e, 0x5f, 0x6b, 0xe5,
+    0x81, 0x6d, 0xf3, 0xc7, 0x90, 0xaf, 0x37, 0xb0, 0x36, 0x62, 0x27, 0x74, 0xeb, 0x0b, 0x5f, 0x38,
+    0xb8, 0xa0, 0x08, 0xd8, 0x42, 0xc8, 0x86, 0x1c, 0xbf, 0xb1, 0xfe, 0x93, 0x35, 0xbd, 0x85, 0x02,
+    0x96, 0xfa, 0xc1, 0x30, 0xa3, 0x5c, 0x8f, 0x78, 0x80, 0x5e, 0x2e, 0x08, 0x04, 0xa5, 0x53, 0x53,
+    0x89, 0xd8, 0x9d, 0x77, 0x4e, 0xf6, 0xdd, 0x75, 0xd7, 0x26, 0x9e, 0xb5, 0xcd, 0x31, 0x32, 0x12,
+    0x67, 0x6f, 0x47, 0xb1, 0x77, 0x3b, 0xe9, 0xda, 0xfb, 0x9c, 0x84, 0x11, 0x91, 0x55, 0xb7, 0x66,
+    0x0e, 0x97, 0xb1, 0x29, 0xf3, 0xfa, 0xd7, 0xe7, 0x12, 0x40, 0xd6, 0x58, 0x2c, 0xf6, 0x62, 0x17,
+    0x87, 0xc5, 0x26, 0x27, 0xd5, 0x75, 0xb2, 0xa0, 0xc5, 0x4f, 0x7f, 0x7a, 0xb5, 0xf2, 0xed, 0x6f,
+    0xd7, 0x7d, 0xb0, 0xec, 0x4e, 0xa9, 0xe4, 0xcd, 0xdc, 0x7b, 0xef, 0x42, 0xe3, 0xdb, 0xdf, 0x6e,
+    0xb0, 0x96, 0x31, 0x7b, 0x7b, 0x00, 0x7c, 0x62, 0x7d, 0xd6, 0x06, 0x2f, 0xec, 0xc7, 0x99, 0x6b,
+    0xc0, 0x78, 0xc6, 0xb0, 0xfe, 0xb3, 0x07, 0x56, 0x70, 0xdd, 0xeb, 0x73, 0xdc, 0xf8, 0xf1, 0xe9,
+    0xe9, 0xb3, 0xff, 0x21, 0x9d, 0x73, 0x8c, 0x0b, 0x8a, 0x80, 0x7b, 0x3f, 0xf3, 0x99, 0x00, 0x4c,
+    0xc4, 0xe2, 0x99, 0xd0, 0x0b, 0xe8, 0xa9, 0x06, 0x1b, 0x84, 0xae, 0x37, 0x62, 0x6d, 0x34, 0x03,
+    0x86, 0x18, 0xc9, 0x77, 0xba, 0x5d, 0xd4, 0x52, 0xd5, 0x84, 0x70, 0xe5, 0x95, 0x39, 0x56, 0xf6,
+    0xc6, 0x4f, 0x4c, 0x24, 0xd8, 0x45, 0x67, 0x21, 0x98, 0x42, 0xf8, 0x65, 0x64, 0x15, 0xd6, 0xd7,
+    0x25, 0x0f, 0x0d, 0xe5, 0xe2, 0x03, 0x03, 0x29, 0x16, 0x52, 0x5f, 0xda, 0xb1, 0x1c, 0x0f, 0x59,
+    0x56, 0xc8, 0xc8, 0xc7, 0x00, 0x61, 0x9b, 0x40, 0x8e, 0xb7, 0xf0, 0xcc, 0x2f, 0xfe, 0xe2, 0x0b,
+    0xcf, 0xbd, 0xeb, 0x5d, 0x87, 0x2b, 0x5f, 0xfd, 0xea, 0x8b, 0x0d, 0x9e, 0xaf, 0x11, 0x8a, 0xed,
+    0x13, 0xf6, 0x5d, 0xd7, 0xeb, 0xb5, 0x9c, 0xb4, 0x36, 0xfa, 0x65, 0xc4, 0xdb, 0x40, 0x6f, 0x24,
+    0x4c, 0x03, 0xea, 0xc6, 0x1d, 0x55, 0x3d, 0xa7, 0x4d, 0xa7, 0x9d, 0x0b, 0x5c, 0x50, 0x04, 0x64,
+    0xc0, 0x92, 0x74, 0xa2, 0x47, 0x3e, 0xf8, 0xdb, 0x70, 0xbd, 0xac, 0xaf, 0x4c, 0x4d, 0xf5, 0xe3,
+    0x78, 0x5c, 0xd9, 0x50, 0x3f, 0xd6, 0x71, 0xb5, 0x9a, 0xcb, 0x48, 0xc3, 0xae, 0x3d, 0xdd, 0xb1,
+    0xa3, 0x80, 0x78, 0x1e, 0x8b, 0x7d, 0x7d, 0x2a, 0x24, 0x6e, 0x7c, 0x8f, 0x80, 0xd0, 0x89, 0xc2,
+    0xba, 0xa1, 0x86, 0xf9, 0x85, 0xc1, 0xc1, 0x42, 0x58, 0xaf, 0xb3, 0x77, 0x53, 0x7a, 0xc2, 0xc5,
+    0xfa, 0x2c, 0xd7, 0xc3, 0xae, 0x1b, 0x5a, 0xfb, 0xf7, 0x1b, 0xeb, 0xbb, 0x70, 0x06, 0x3d, 0x25,
+    0x7d, 0x29, 0xb1, 0xd6, 0x86, 0x37, 0x5e, 0x5e, 0xa1, 0xa1, 0x65, 0xd9, 0x9c, 0xae, 0xb3, 0xb0,
+    0xff, 0xa3, 0xc9, 0xc7, 0xc6, 0xaf, 0x75, 0x1b, 0xb1, 0x7b, 0xfb, 0xda, 0x94, 0x0b, 0x07, 0x17,
+    0x1c, 0x01, 0xc5, 0x78, 0xfc, 0x18, 0x81, 0xb0, 0xcb, 0x88, 0xc6, 0x2a, 0x21, 0xb0, 0x03, 0xe4,
+    0x41, 0xe9, 0xf8, 0xc1, 0xc1, 0xa2, 0xb2, 0x75, 0xeb, 0x30, 0x30, 0x87, 0x11, 0xb0, 0x67, 0x52,
+    0xb8, 0x7a, 0xdd, 0xa5, 0xf5, 0x7a, 0xaf, 0x22, 0x26, 0xe4, 0x80, 0x12, 0xd7, 0xdf, 0xaf, 0xb2,
+    0x1a, 0xd2, 0xfc, 0xd0, 0x10, 0xab, 0x0f, 0xd8, 0x73, 0xc2, 0x32, 0x90, 0x12, 0xae, 0x3c, 0x05,
+    0xb6, 0x09, 0x04, 0x72, 0xb6, 0xfa, 0x73, 0xcf, 0x21, 0xa7, 0x5c, 0x66, 0x8b, 0xf4, 0xc0, 0x9a,
+    0x6e, 0x5d, 0xf8, 0xd4, 0xa7, 0x16, 0x22, 0xc3, 0x78, 0xe9, 0x3b, 0xca, 0x3d, 0xac, 0xff, 0x5c,
+    0x23, 0xde, 0xda, 0x08, 0x56, 0xe9, 0x65, 0x8d, 0x54, 0x00, 0x02, 0x69, 0x60, 0xc0, 0xf3, 0x12,
+    0xdc, 0x34, 0x02, 0x51, 0x14, 0x89, 0x75, 0xbd, 0xd9, 0xd7, 0x3b, 0xd6, 0xf6, 0x88, 0x17, 0xf6,
+    0x5e, 0x63, 0x61, 0x0b, 0xb2, 0x30, 0xfc, 0x72, 0x27, 0x7c, 0x01, 0xe0, 0x82, 0x23, 0x60, 0x32,
+    0x91, 0x98, 0x03, 0x77, 0x61, 0x30, 0xc1, 0x60, 0xb5, 0x8c, 0x85, 0xf5, 0x1c, 0x2b, 0x02, 0x73,
+    0xc0, 0xa7, 0xd3, 0x09, 0x3e, 0x1e, 0x97, 0xd6, 0x33, 0xb1, 0xde, 0xc1, 0x73, 0xfb, 0xf7, 0x57,
+    0x80, 0x10, 0xbd, 0xdf, 0x38, 0x9b, 0x55, 0x98, 0x32, 0x8a, 0xfd, 0xfd, 0xbd, 0xa6, 0x3f, 0xc0,
+    0x50, 0xf4, 0x26, 0xf4, 0x08, 0x11, 0x86, 0x51, 0x10, 0x04, 0x91, 0x6b, 0xdb, 0xe8, 0xe9, 0xbf,
+    0xf8, 0x0b, 0x74, 0xf8, 0x8b, 0x5f, 0x44, 0xc7, 0xbe, 0xf2, 0x15, 0xf4, 0xf8, 0x47, 0x3e, 0x52,
+    0xaa, 0x3f, 0xf4, 0x50, 0x0b, 0x36, 0xd5, 0x23, 0x17, 0x03, 0x5b, 0xe6, 0x0c, 0xd6, 0x46, 0x30,
+    0xd5, 0x03, 0x29, 0x7e, 0xc9, 0x34, 0x18, 0x66, 0x7b, 0xe1, 0x76, 0xbb, 0x96, 0x90, 0xcf, 0x67,
+    0xdd, 0xd1, 0xd1, 0xfe, 0x60, 0xf7, 0xee, 0x69, 0xa2, 0xaa, 0x32, 0x5b, 0x51, 0xaf, 0x5b, 0x9b,
+    0x8d, 0x3d, 0x29, 0xd9, 0x58, 0x6e, 0x12, 0x06, 0x5e, 0xd5, 0x1a, 0x4c, 0x3f, 0x6b, 0x5c, 0x70,
+    0x04, 0xdc, 0xfc, 0xde, 0xf7, 0xb6, 0xd4, 0xa9, 0x29, 0x87, 0x29, 0x20, 0x0b, 0x5b, 0x90, 0xbf,
+    0xb1, 0x8b, 0x48, 0x02, 0xcf, 0xf3, 0x5d, 0x42, 0xb8, 0x20, 0x91, 0x58, 0x4b, 0xe4, 0x61, 0x3c,
+    0x84, 0x55, 0x2c, 0x1e, 0x39, 0xd2, 0xe6, 0x8e, 0x1f, 0x6f, 0xc2, 0x4c, 0x88, 0x83, 0x9c, 0x8f,
+    0x91, 0x93, 0x5f, 0xfb, 0xea, 0xb5, 0xcc, 0x16, 0xec, 0x15, 0x34, 0xb3, 0x0e, 0xc2, 0x69, 0x54,
+    0x2a, 0xd5, 0x4c, 0xcf, 0xa3, 0x3e, 0xfb, 0x70, 0x31, 0x28, 0xe1, 0xd2, 0xff, 0xfc, 0x9f, 0xb6,
+    0x7d, 0xe8, 0x50, 0xb9, 0x37, 0x1f, 0xa0, 0xb7, 0xde, 0x0d, 0xac, 0x8f, 0x3a, 0x43, 0x3c, 0xd6,
+    0x6d, 0x60, 0x63, 0x18, 0x7a, 0x4e, 0xb3, 0xd9, 0x46, 0x89, 0x44, 0x8e, 0xd5, 0xc2, 0x0e, 0x59,
+    0x42, 0x39, 0x39, 0x39, 0xd8, 0x9b, 0x06, 0xe8, 0xdd, 0x20, 0x92, 0xc4, 0x93, 0xe1, 0xe1, 0x2c,
+    0x53, 0x43, 0x58, 0xac, 0xf0, 0xfc, 0xe8, 0xe8, 0x39, 0x6d, 0xc3, 0xf9, 0x6c, 0xe3, 0x82, 0x23,
+    0x20, 0x7e, 0xfd, 0xeb, 0x43, 0x6d, 0x7a, 0x7a, 0x5e, 0xcc, 0x64, 0xf4, 0x33, 0x79, 0x20, 0x20,
+    0x6a, 0xb7, 0xbb, 0x86, 0xef, 0xa3, 0xa0, 0x97, 0xb4, 0xf5, 0x3c, 0x40, 0xef, 0xc9, 0x08, 0x00,
+    0xe1, 0xef, 0x7c, 0x67, 0x25, 0xfa, 0xd2, 0x97, 0x4e, 0xd0, 0xb9, 0xb9, 0x2e, 0x1b, 0xc7, 0x3a,
+    0x50, 0x41, 0x35, 0x82, 0xf0, 0xd7, 0x5b, 0x29, 0x03, 0x10, 0x20, 0x98, 0x9f, 0x2f, 0xf9, 0x33,
+    0x33, 0x73, 0xb4, 0xd1, 0xa8, 0xd3, 0xe5, 0xe5, 0x65, 0x72, 0xe8, 0xd0, 0x31, 0xe4, 0xfb, 0xbd,
+    0x26, 0x8d, 0xd6, 0xe7, 0x5a, 0x53, 0x4b, 0x06, 0x46, 0xbc, 0xde, 0x88, 0x75, 0xb2, 0x31, 0xb0,
+    0xe1, 0x17, 0x7f, 0xaf, 0xed, 0x57, 0x10, 0x78, 0xbe, 0xe3, 0x04, 0x82, 0x2c, 0x6b, 0x8c, 0x64,
+    0x01, 0xab, 0x0b, 0xc8, 0x9a, 0x73, 0x85, 0x61, 0x36, 0x03, 0x9f, 0xcd, 0xea, 0xd1, 0xf4, 0xf4,
+    0x26, 0xb2, 0x79, 0x33, 0x23, 0xa6, 0x8a, 0x55, 0xb5, 0xc0, 0x96, 0xbb, 0x50, 0x70, 0xc1, 0x11,
+    0x90, 0x41, 0xcb, 0xe7, 0x1f, 0x55, 0x46, 0x46, 0xf2, 0x3d, 0xf2, 0xad, 0x45, 0x60, 0x4c, 0xcb,
+    0xe5, 0x66, 0x00, 0x61, 0x94, 0x7d, 0x4a, 0x52, 0x9c, 0x9a, 0x4a, 0x8b, 0x63, 0x63, 0x5a, 0x8f,
+    0x37, 0x30, 0x9d, 0xb5, 0x36, 0x83, 0x58, 0x3e, 0xc8, 0x48, 0xc1, 0x08, 0x09, 0x0b, 0xf0, 0xf9,
+    0xbc, 0xca, 0xc8, 0xc2, 0x2a, 0x90, 0x32, 0x32, 0x30, 0x04, 0x2c, 0x16, 0xae, 0xae, 0xd6, 0xc8,
+    0xb1, 0x63, 0x33, 0x64, 0x6e, 0x6e, 0x19, 0xdc, 0x6e, 0x20, 0x6f, 0x14, 0xad, 0x00, 0x7a, 0xdc,
+    0x82, 0x0e, 0x9c, 0x07, 0x84, 0x49, 0xd6, 0x9c, 0x24, 0xe5, 0x23, 0x44, 0x05, 0x20, 0x16, 0x1f,
+    0x51, 0xc2, 0xc3, 0x78, 0xb6, 0x33, 0x4c, 0x11, 0xcf, 0x90, 0x91, 0x85, 0xda, 0xee, 0xca, 0x4a,
+    0x4d, 0x67, 0xef, 0x3b, 0xc3, 0x28, 0x1f, 0x52, 0x57, 0x2a, 0xcb, 0x67, 0xca, 0x07, 0x31, 0x0c,
+    0xb3, 0xfd, 0xa2, 0x43, 0x43, 0x7d, 0x08, 0x1c, 0xb3, 0x17, 0x45, 0xff, 0x47, 0x2d, 0xf7, 0x9f,
+    0x6f, 0xb8, 0x20, 0x09, 0x28, 0x15, 0x0a, 0xcf, 0xca, 0xe9, 0x74, 0x84, 0x15, 0x85, 0x7d, 0x98,
+    0xa6, 0x57, 0xb5, 0x1a, 0x3b, 0x8e, 0x2b, 0x2e, 0x2c, 0xcc, 0x0b, 0xbe, 0xef, 0xd0, 0x5b, 0x6e,
+    0x19, 0x95, 0x7f, 0xfd, 0xd7, 0x37, 0xb3, 0x4a, 0x03, 0x4c, 0xbd, 0x78, 0x8e, 0x51, 0x10, 0x48,
+    0xb3, 0x4e, 0x3e, 0x36, 0x8e, 0xb5, 0x1b, 0xc2, 0x65, 0x32, 0xd2, 0xfa, 0x7b, 0x1d, 0x8c, 0x2b,
+    0x0c, 0x3d, 0x85, 0x5b, 0xb7, 0xb6, 0x2c, 0xbc, 0xb3, 0x36, 0x6e, 0x24, 0x9f, 0x12, 0xd9, 0x41,
+    0xa1, 0xe6, 0xe0, 0x30, 0x61, 0xe0, 0x20, 0x6d, 0x71, 0x51, 0xc6, 0x10, 0xa2, 0xbc, 0x29, 0x84,
+    0x05, 0x93, 0x8f, 0xf2, 0x2d, 0xe4, 0xe5, 0xbb, 0x38, 0xc8, 0x76, 0x71, 0x98, 0x31, 0x69, 0xa8,
+    0xbb, 0x28, 0x52, 0x43, 0x42, 0x84, 0xde, 0x5a, 0x00, 0xa1, 0x6d, 0xb7, 0x9c, 0xf9, 0x79, 0x9f,
+    0x95, 0xc7, 0xc0, 0xba, 0xd7, 0x72, 0xcf, 0xf5, 0x69, 0x7c, 0x10, 0x80, 0x1d, 0x5f, 0x27, 0x66,
+    0x3e, 0x9f, 0x8c, 0x10, 0xca, 0xf6, 0x26, 0x5c, 0x20, 0xb8, 0x20, 0x09, 0x38, 0x32, 0x32, 0xb2,
+    0x04, 0x6e, 0x78, 0x86, 0xbd, 0x5a, 0xc9, 0xc8, 0xc7, 0xd0, 0x73, 0xbd, 0x8d, 0x46, 0x87, 0xb5,
+    0x6a, 0xe4, 0x06, 0x01, 0x6e, 0x74, 0xbb, 0x9c, 0x75, 0xed, 0xb5, 0x43, 0x88, 0x3d, 0x05, 0x81,
+    0x69, 0x30, 0x17, 0xd8, 0xe3, 0x35, 0xf2, 0xf5, 0x88, 0xc8, 0xc6, 0x81, 0x0a, 0x86, 0x10, 0x62,
+    0xd7, 0xf8, 0x86, 0x10, 0xb0, 0x8d, 0x3d, 0xab, 0x13, 0x43, 0x8e, 0xc4, 0x23, 0x91, 0xa6, 0x03,
+    0x91, 0xe6, 0x3a, 0xd8, 0xcf, 0x77, 0x39, 0xbf, 0x00, 0xc4, 0xeb, 0xeb, 0x72, 0x41, 0xbf, 0xc9,
+    0x3a, 0xec, 0xf7, 0x99, 0x28, 0x28, 0x5a, 0x38, 0x80, 0xf1, 0x5e, 0x11, 0x08, 0x58, 0x34, 0x70,
+    0x08, 0xd3, 0xfc, 0x7e, 0x98, 0xb7, 0xbf, 0x03, 0xf3, 0xc2, 0x7c, 0x69, 0xb6, 0xd2, 0x5e, 0x8e,
+    0x49, 0x69, 0xd8, 0x9a, 0x9d, 0xad, 0x5b, 0xcf, 0x3e, 0x8b, 0x44, 0x56, 0xa6, 0xb8, 0x75, 0x6b,
+    0x96, 0xd7, 0x75, 0x09, 0xc3, 0x34, 0xae, 0xdb, 0x75, 0x58, 0x5b, 0xc3, 0xac, 0xf9, 0xa0, 0x50,
+    0x96, 0x65, 0x70, 0xf8, 0xe7, 0xac, 0x05, 0xfb, 0x73, 0x81, 0x0b, 0x92, 0x80, 0x78, 0xc7, 0x0e,
+    0x3f, 0x72, 0x9c, 0x6f, 0x12, 0xd6, 0xf0, 0x5f, 0x6f, 0x44, 0x8f, 0x50, 0xb8, 0x57, 0xff, 0x0e,
+    0xc2, 0x26, 0x6e, 0xb7, 0x7b, 0xe3, 0xa3, 0x44, 0x42, 0x86, 0xfc, 0xaa, 0xf7, 0x91, 0x17, 0x1e,
+    0x44, 0x8f, 0x49, 0xdd, 0x1a, 0xff, 0x80, 0x8a, 0xa2, 0x28, 0x0a, 0x13, 0x13, 0x79, 0x50, 0xa7,
+    0x10, 0x54, 0x47, 0x70, 0x31, 0xd1, 0x3c, 0x3e, 0x4a, 0x13, 0x09, 0xf5, 0x85, 0x22, 0xea, 0x77,
+    0xf8, 0xa8, 0xdf, 0xe2, 0xfc, 0x3e, 0x87, 0x0b, 0x0a, 0xa0, 0x7c, 0x79, 0x17, 0x47, 0x69, 0x1f,
+    0x11, 0x3d, 0x44, 0x44, 0x0b, 0x31, 0x51, 0x42, 0x1a, 0x49, 0xa0, 0x72, 0x22, 0xb0, 0x57, 0x04,
+    0x3b, 0x2b, 0x41, 0x9c, 0x97, 0x08, 0xa6, 0x2a, 0x90, 0x57, 0x77, 0xb9, 0x30, 0xeb, 0xa3, 0x48,
+    0x81, 0xd0, 0x4c, 0x21, 0x25, 0xe8, 0xb1, 0x1b, 0x14, 0xb7, 0x1a, 0xbf, 0xe3, 0x0e, 0x9a, 0xfb,
+    0x67, 0xff, 0x0c, 0xc7, 0x3f, 0xf4, 0xa1, 0x01, 0xf1, 0x8f, 0xfe, 0x68, 0xbb, 0xb2, 0x79, 0x73,
+    0x5a, 0x56, 0x94, 0xac, 0x58, 0xab, 0x11, 0x66, 0xa6, 0x98, 0x1d, 0x86, 0xff, 0xd9, 0x7d, 0x72,
+    0xc1, 0xe0, 0x82, 0x24, 0x20, 0x03, 0x59, 0x5a, 0xfa, 0x06, 0x5c, 0x30, 0x7f, 0x83, 0x7c, 0xac,
+    0x0f, 0x89, 0x15, 0x07, 0x1d, 0x11, 0x66, 0x66, 0xda, 0x1b, 0x21, 0x2e, 0x9a, 0x98, 0xd0, 0x59,
+    0xb9, 0x20, 0x5c, 0xe0, 0x35, 0xa9, 0x64, 0x17, 0x9a, 0x2d, 0x90, 0xcb, 0x65, 0xb9, 0xcd, 0x9b,
+    0x27, 0x7c, 0x59, 0x52, 0x6c, 0x2e, 0x4a, 0x3b, 0x10, 0x52, 0x5d, 0x91, 0x16, 0x03, 0x09, 0xe7,
+    0x41, 0xfd, 0x32, 0x11, 0x47, 0x13, 0x40, 0x4c, 0x05, 0xe6, 0x15, 0x39, 0xf6, 0x86, 0x08, 0x6c,
+    0x01, 0xa4, 0xac, 0xb7, 0x0a, 0xd6, 0xe3, 0x39, 0x01, 0xc5, 0xd4, 0x14, 0x4a, 0x26, 0xf2, 0x48,
+    0x8f, 0xe7, 0x80, 0xcf, 0x2a, 0x5b, 0xed, 0x7a, 0x88, 0x47, 0x58, 0x25, 0x5c, 0x27, 0xc4, 0xa2,
+    0xb4, 0x4a, 0x12, 0xe3, 0xcc, 0xea, 0xa4, 0xdf, 0xf9, 0xce, 0xf4, 0xd0, 0x5b, 0xdf, 0x8a, 0xd3,
+    0x99, 0x0c, 0x4a, 0xa5, 0x52, 0x28, 0x31, 0x34, 0x24, 0x46, 0x77, 0xdc, 0x31, 0xd9, 0x6d, 0xb7,
+    0xfb, 0x95, 0x6a, 0x15, 0x4b, 0xa5, 0x12, 0x25, 0x95, 0x4a, 0x0c, 0x1c, 0xcf, 0x79, 0x59, 0xb5,
+    0xfe, 0xa7, 0xc5, 0x05, 0x4b, 0xc0, 0x81, 0xc1, 0xc1, 0x53, 0xe0, 0x2c, 0xab, 0x1b, 0xe4, 0xeb,
+    0x91, 0x0a, 0xfa, 0x2c, 0xde, 0x72, 0x27, 0x4f, 0xd6, 0xb8, 0x5a, 0x6d, 0xad, 0xe0, 0x38, 0x9d,
+    0x66, 0xed, 0xf8, 0xb1, 0x13, 0xc1, 0xea, 0xb0, 0x62, 0x90, 0x18, 0x96, 0x0b, 0x72, 0x02, 0x2b,
+    0x90, 0x66, 0x85, 0xd0, 0xc5, 0x62, 0xcc, 0xe1, 0x83, 0x6c, 0x20, 0xa0, 0x2c, 0xfb, 0xa8, 0xb9,
+    0x28, 0xb2, 0x62, 0x6d, 0x81, 0x25, 0x7f, 0x48, 0x12, 0x59, 0x03, 0x4a, 0x22, 0x62, 0xef, 0x9b,
+    0x80, 0x5e, 0xae, 0x55, 0xff, 0x02, 0x62, 0xb3, 0xa2, 0x47, 0x3d, 0x96, 0x46, 0x19, 0x3d, 0xdb,
+    0xeb, 0xd2, 0x89, 0x0c, 0x52, 0x95, 0x44, 0x8f, 0x94, 0x8c, 0x9d, 0x22, 0xe5, 0x4c, 0x8e, 0x28,
+    0x41, 0x5b, 0xcd, 0x6f, 0xb6, 0x10, 0x5f, 0xf4, 0x38, 0x41, 0x2d, 0xbe, 0xe9, 0x4d, 0x05, 0xf6,
+    0x8c, 0x39, 0x1e, 0x8f, 0xf7, 0x9e, 0x2f, 0xb3, 0x7e, 0x72, 0xeb, 0x56, 0xec, 0xf8, 0x3e, 0xdf,
+    0x58, 0x5c, 0x14, 0x8c, 0xfd, 0xfb, 0x29, 0xfb, 0x6c, 0x94, 0xc4, 0x71, 0xff, 0xcb, 0xcd, 0x06,
+    0xff, 0x3c, 0xe0, 0x82, 0x25, 0x60, 0xf6, 0x9e, 0x7b, 0x0c, 0x5e, 0x51, 0x5e, 0xd8, 0x20, 0x1f,
+    0xeb, 0x9f, 0xa9, 0xa6, 0xef, 0xfb, 0x81, 0xf4, 0xfd, 0xef, 0x2f, 0xe0, 0x56, 0xcb, 0xe3, 0x0c,
+    0xc3, 0x5f, 0x77, 0xcb, 0xac, 0xc1, 0x60, 0x3e, 0xa0, 0x54, 0xea, 0xa2, 0x30, 0xed, 0xba, 0x36,
+    0x96, 0x04, 0x01, 0x09, 0x03, 0x83, 0x49, 0x14, 0x42, 0xfa, 0x25, 0xa9, 0x1c, 0x0f, 0xfa, 0xc9,
+    0x5a, 0x80, 0x89, 0x08, 0x6b, 0xa9, 0x8b, 0x11, 0x50, 0x40, 0x8a, 0xc8, 0x08, 0x28, 0x20, 0x51,
+    0x60, 0x8f, 0xe7, 0x98, 0xbe, 0x81, 0x09, 0x12, 0x65, 0xa4, 0x29, 0x31, 0x94, 0xd0, 0xe2, 0x48,
+    0x16, 0x24, 0xc4, 0x3e, 0x4a, 0xc3, 0xf1, 0x22, 0x4a, 0xef, 0x7b, 0x23, 0x1a, 0xfd, 0x9d, 0x7f,
+    0x8b, 0x86, 0x7e, 0xeb, 0xff, 0x16, 0x5a, 0x63, 0x5b, 0x37, 0x75, 0x0c, 0x47, 0xd0, 0x54, 0x01,
+    0xf9, 0x48, 0x10, 0x63, 0x85, 0x82, 0xc8, 0xea, 0x0f, 0x6e, 0x3c, 0x5b, 0x66, 0x9d, 0x0c, 0x64,
+    0xee, 0xc9, 0x72, 0x14, 0x91, 0x8c, 0xaa, 0xae, 0xc0, 0x3c, 0x25, 0xa4, 0xeb, 0xff, 0x64, 0xd3,
+    0xbd, 0x3f, 0x6f, 0xb8, 0x60, 0x09, 0xc8, 0xb4, 0x48, 0x4d, 0xa7, 0x1f, 0x02, 0x56, 0xac, 0xc5,
+    0xbc, 0x75, 0xf2, 0x31, 0xae, 0xf5, 0xa6, 0x37, 0x9b, 0xb6, 0xfa, 0xc0, 0x03, 0xa7, 0xf8, 0xef,
+    0x7c, 0x67, 0x89, 0x8d, 0x17, 0x25, 0xa0, 0x13, 0xcf, 0xb3, 0xaf, 0xad, 0xf9, 0x36, 0x0a, 0x53,
+    0x8d, 0x4e, 0x23, 0xc6, 0x53, 0x82, 0xe4, 0x81, 0x81, 0x4c, 0x2c, 0x12, 0xda, 0x09, 0x2d, 0x03,
+    0x44, 0xd3, 0x61, 0xbd, 0x12, 0xab, 0xa1, 0x0c, 0x6b, 0x58, 0xaf, 0xc8, 0x02, 0xab, 0xeb, 0x39,
+    0xd7, 0xf5, 0x8e, 0x81, 0xf5, 0x28, 0x2c, 0xcb, 0xe6, 0x0b, 0x21, 0x0d, 0x75, 0x3c, 0x07, 0x65,
+    0xdf, 0xfa, 0x36, 0x34, 0xf5, 0xab, 0x77, 0xa1, 0xa1, 0x2b, 0xae, 0x44, 0x7d, 0x57, 0x5f, 0xa3,
+    0xee, 0xfc, 0x57, 0xff, 0x5c, 0x4d, 0xf4, 0x15, 0x05, 0xa3, 0xed, 0x12, 0x0d, 0x08, 0x0c, 0x37,
+    0x03, 0x65, 0x39, 0x2a, 0xeb, 0xd8, 0xcb, 0x4a, 0xac, 0xb8, 0xb2, 0xf5, 0xd0, 0x43, 0xbd, 0x96,
+    0x99, 0xd2, 0x40, 0xbe, 0x34, 0xa8, 0x79, 0xb8, 0xb0, 0xf0, 0xd4, 0x35, 0x23, 0x23, 0x2f, 0xd6,
+    0x8a, 0xbe, 0x00, 0x70, 0xc1, 0x12, 0x90, 0x41, 0xc8, 0x66, 0x0f, 0xf0, 0xb2, 0x5c, 0xef, 0x91,
+    0x4f, 0x55, 0xf9, 0xf8, 0x9d, 0x77, 0x0e, 0x49, 0x93, 0x93, 0x31, 0x26, 0x55, 0x3d, 0x51, 0x8c,
+    0x22, 0x8a, 0xd9, 0xb3, 0x56, 0x18, 0x96, 0xd6, 0x6a, 0xa5, 0xb0, 0x06, 0x46, 0x89, 0x8a, 0x05,
+    0x83, 0x7d, 0xcf, 0xba, 0x59, 0x5d, 0x45, 0x6a, 0x2a, 0xa5, 0x42, 0x40, 0x76, 0xe2, 0xa0, 0x68,
+    0x8a, 0xa4, 0x82, 0x9a, 0x41, 0x16, 0x09, 0xae, 0x62, 0xad, 0xaa, 0x7d, 0xd4, 0xfb, 0x9a, 0x27,
+    0x18, 0x65, 0xe4, 0x07, 0xec, 0xb3, 0xb2, 0xa4, 0x47, 0x42, 0x3f, 0x70, 0x51, 0xd7, 0xea, 0xa0,
+    0x7a, 0xa7, 0x8e, 0x5a, 0xdd, 0x06, 0x72, 0x61, 0xd5, 0x63, 0xb7, 0xbe, 0xa5, 0x57, 0x77, 0x90,
+    0x85, 0x59, 0xd6, 0x65, 0xfa, 0x8a, 0xb8, 0xef, 0xba, 0x3d, 0x38, 0xa7, 0xe2, 0xee, 0xf8, 0xd8,
+    0x60, 0xb2, 0xf5, 0xe0, 0x83, 0x4e, 0xe8, 0xbc, 0xd8, 0x3e, 0x90, 0x79, 0xe8, 0x90, 0x5d, 0xfe,
+    0xfc, 0xe7, 0x6d, 0x4d, 0x10, 0x1a, 0xe9, 0x58, 0xac, 0xee, 0x83, 0x21, 0x0e, 0x44, 0xf1, 0x61,
+    0xfc, 0xe5, 0x73, 0xd3, 0x72, 0xe9, 0xb9, 0xc2, 0x5a, 0xe2, 0x7d, 0x81, 0xe2, 0xcf, 0x1f, 0x7d,
+    0xd4, 0xed, 0xec, 0xdb, 0xb7, 0x55, 0x14, 0x84, 0xbd, 0xb4, 0x58, 0x54, 0xcc, 0x2b, 0xaf, 0xec,
+    0x13, 0xa6, 0xa6, 0x92, 0xe8, 0xf4, 0xe9, 0x2e, 0x76, 0x5d, 0x56, 0x73, 0x9a, 0x29, 0x22, 0x7b,
+    0xf2, 0xc1, 0xc9, 0x89, 0x44, 0xd1, 0xf3, 0x7d, 0xc3, 0x21, 0x24, 0x50, 0x39, 0xd1, 0x07, 0x57,
+    0x9b, 0x74, 0x5c, 0xa7, 0xf7, 0x79, 0x9c, 0xa8, 0xde, 0xa8, 0xa9, 0x9a, 0x96, 0xf5, 0x02, 0x0f,
+    0x72, 0x32, 0x1b, 0x08, 0xe7, 0xf4, 0x54, 0x8f, 0x3d, 0x5f, 0x66, 0x2a, 0x17, 0x00, 0x11, 0xd9,
+    0x9b, 0x6d, 0x5c, 0x32, 0x83, 0xc4, 0x7c, 0x3f, 0x8a, 0x6c, 0x13, 0xf9, 0x9e, 0x0d, 0x86, 0xdb,
+    0x41, 0xae, 0x67, 0xa1, 0xd4, 0xee, 0x2b, 0xd0, 0xe6, 0x9b, 0xde, 0xd4, 0xab, 0x1d, 0xcd, 0x6a,
+    0x49, 0x33, 0x85, 0x63, 0x4a, 0x67, 0xce, 0xce, 0xba, 0xa9, 0x67, 0x9f, 0x58, 0xd6, 0x5c, 0x1b,
+    0xd1, 0x76, 0x5b, 0x68, 0x3e, 0xfd, 0xb4, 0x6a, 0xcc, 0xcc, 0x44, 0x2b, 0xff, 0xe3, 0x7f, 0x04,
+    0x4b, 0x7f, 0xfe, 0xe7, 0x2d, 0x85, 0x90, 0x46, 0x22, 0x16, 0x63, 0xcf, 0x99, 0x49, 0x39, 0x02,
+    0xeb, 0x5c, 0xc8, 0xfe, 0x87, 0xfb, 0x4e, 0x9d, 0x5a, 0x6b, 0xe7, 0xe5, 0x02, 0xc1, 0x05, 0xad,
+    0x80, 0x2c, 0x0c, 0x4b, 0xd9, 0xec, 0xb7, 0xc0, 0xa3, 0xaa, 0x71, 0x59, 0xce, 0x46, 0xbe, 0x8f,
+    0x0d, 0x42, 0x04, 0x6f, 0xcf, 0x9e, 0xc2, 0x7a, 0x48, 0x86, 0x49, 0x1c, 0xe6, 0x35, 0xad, 0x00,
+    0x84, 0x92, 0x55, 0x08, 0x7b, 0x84, 0xe3, 0x28, 0x8c, 0x0f, 0xe3, 0x9c, 0x58, 0x81, 0xc9, 0xa8,
+    0x55, 0x2f, 0x23, 0x0b, 0x85, 0x5a, 0xbb, 0x5e, 0x6e, 0x9b, 0x4e, 0xb7, 0x47, 0x28, 0x16, 0x5e,
+    0x59, 0xf9, 0x5d, 0x04, 0xc4, 0x0b, 0x43, 0x50, 0x3e, 0x08, 0xb9, 0xfd, 0xb7, 0xbf, 0x0f, 0xed,
+    0xfc, 0x0f, 0xf7, 0xa2, 0x6d, 0xff, 0xfa, 0x8f, 0xd0, 0xd4, 0xbf, 0xf9, 0xcf, 0x48, 0xec, 0x1b,
+    0x02, 0x72, 0xfa, 0x94, 0x44, 0x21, 0x11, 0x28, 0xab, 0xe8, 0xa2, 0xf4, 0x08, 0xb8, 0x51, 0x45,
+    0x9f, 0x75, 0xe9, 0x6e, 0x43, 0xc1, 0x8a, 0xb4, 0xa5, 0x6a, 0x9a, 0x93, 0xe5, 0xd5, 0xd5, 0xbc,
+    0x79, 0xfa, 0x34, 0xd7, 0xf9, 0xde, 0xf7, 0xb8, 0xd6, 0xf7, 0xbf, 0x1f, 0xb5, 0x9b, 0xcd, 0x7e,
+    0xea, 0xba, 0xaa, 0x04, 0x52, 0x6b, 0x44, 0x9c, 0x66, 0x68, 0xfa, 0xd7, 0x77, 0x7c, 0xf3, 0x9b,
+    0x2f, 0x56, 0xc3, 0xb9, 0x40, 0x70, 0x41, 0x13, 0x90, 0x01, 0xf7, 0xf5, 0x3d, 0x2d, 0x07, 0xc1,
+    0xf7, 0xa3, 0x99, 0x99, 0x45, 0xde, 0x30, 0x7a, 0x5f, 0xfe, 0x21, 0xe3, 0xe3, 0xa9, 0xc2, 0xd4,
+    0xd4, 0x44, 0x26, 0x91, 0xc8, 0x16, 0x75, 0x3d, 0x01, 0x61, 0x37, 0x13, 0x01, 0xab, 0x62, 0x8c,
+    0x20, 0xe0, 0x7e, 0xc1, 0x1e, 0x53, 0x15, 0x4b, 0x1d, 0x15, 0xf3, 0x1d, 0x98, 0x86, 0x70, 0x26,
+    0x95, 0xea, 0xae, 0x2e, 0x57, 0x0c, 0xab, 0x45, 0x82, 0xc0, 0x63, 0x0d, 0x1d, 0xf5, 0xc0, 0xfa,
+    0xec, 0x99, 0x45, 0xdf, 0xcd, 0xb7, 0xd1, 0xa9, 0xb7, 0xdf, 0x81, 0x32, 0xb9, 0x5c, 0xaf, 0x08,
+    0x25, 0x3f, 0x3e, 0x81, 0xc6, 0x7f, 0xe5, 0x37, 0x28, 0x87, 0x94, 0x80, 0x43, 0xfd, 0x81, 0x7d,
+    0x64, 0x29, 0x8c, 0xd8, 0x6b, 0x9f, 0x6c, 0x7f, 0x80, 0xd4, 0x4c, 0xfd, 0xa2, 0x6a, 0x95, 0x3d,
+    0x07, 0xe6, 0xb9, 0xa1, 0x41, 0xde, 0x77, 0x5d, 0xe4, 0x1a, 0x06, 0x32, 0x9b, 0x4d, 0xa4, 0x66,
+    0xb3, 0x1c, 0x89, 0xc5, 0x34, 0x4c, 0x69, 0xa8, 0xab, 0x6a, 0x13, 0xe4, 0x99, 0xd4, 0x05, 0xbd,
+    0x59, 0x48, 0xe7, 0xee, 0xeb, 0xad, 0xe0, 0x02, 0xc3, 0x05, 0x4f, 0xc0, 0xa9, 0x0f, 0x7f, 0xd8,
+    0x13, 0x73, 0xb9, 0x2f, 0xf2, 0x10, 0x5a, 0xb5, 0x53, 0xa7, 0x7a, 0x2d, 0xcf, 0x13, 0x49, 0xc2,
+    0x30, 0x10, 0x10, 0x84, 0x34, 0x8b, 0x90, 0x7e, 0x9e, 0x52, 0x5e, 0xa0, 0x34, 0x10, 0x79, 0x9e,
+    0xb0, 0x8f, 0xd8, 0x33, 0x96, 0xb0, 0xe7, 0x13, 0x09, 0x2c, 0x95, 0x24, 0x8e, 0x77, 0xf8, 0x44,
+    0x2c, 0x41, 0xdb, 0xdd, 0x1a, 0x30, 0xc6, 0xe3, 0x11, 0xf5, 0x21, 0x6f, 0x01, 0x62, 0xa1, 0x80,
+    0xa7, 0x28, 0x10, 0xc0, 0x53, 0x6f, 0xfa, 0x85, 0x5f, 0xea, 0xe5, 0x75, 0xac, 0xe8, 0x64, 0xa3,
+    0x2b, 0x6e, 0xbf, 0x0c, 0x6b, 0x42, 0x9f, 0x58, 0x08, 0x5d, 0x9c, 0x59, 0x39, 0xee, 0x1f, 0xbf,
+    0xe7, 0x9e, 0x8e, 0x5d, 0xad, 0xb2, 0x76, 0x61, 0x50, 0xf7, 0xe8, 0x51, 0x54, 0x7a, 0xe0, 0x01,
+    0x2a, 0x94, 0xcb, 0x1d, 0x71, 0x65, 0xa5, 0x04, 0x24, 0x37, 0x21, 0x0d, 0xa0, 0x1e, 0x10, 0xb0,
+    0x0a, 0xd3, 0xfc, 0x56, 0x0b, 0xa9, 0x82, 0x60, 0x4a, 0x1c, 0x17, 0x2e, 0x0a, 0x71, 0x4d, 0x49,
+    0xab, 0xff, 0xe6, 0xea, 0xaf, 0xfe, 0xf5, 0x99, 0x57, 0x0d, 0x2e, 0x24, 0x5c, 0xd0, 0x39, 0xe0,
+    0x06, 0x3e, 0xfa, 0x6b, 0xbf, 0xb6, 0x1c, 0x96, 0xcb, 0xaf, 0x15, 0x2a, 0x95, 0xa4, 0x3f, 0x32,
+    0x12, 0x8f, 0x34, 0x48, 0xed, 0x83, 0x40, 0xe2, 0x3a, 0x9d, 0x0e, 0x66, 0xdf, 0x7b, 0xe0, 0x79,
+    0x0d, 0x5c, 0x30, 0x93, 0x28, 0x0b, 0xc8, 0xc7, 0xf8, 0x87, 0x03, 0xc8, 0xf1, 0x04, 0x20, 0x85,
+    0x88, 0x38, 0x33, 0x12, 0xb9, 0x04, 0x5d, 0x2a, 0x95, 0x39, 0x01, 0x8b, 0xbc, 0x28, 0xb0, 0xfa,
+    0x84, 0x04, 0x58, 0x1a, 0x01, 0x09, 0x23, 0x4e, 0x56, 0xe8, 0x8e, 0x0f, 0xfc, 0x96, 0xa4, 0x01,
+    0xe9, 0x5e, 0x9a, 0xdf, 0x61, 0xcf, 0x23, 0xda, 0x37, 0xbf, 0x3a, 0x97, 0x95, 0xf8, 0x6a, 0x42,
+    0x53, 0x9b, 0xd6, 0xd2, 0x52, 0xbb, 0xf2, 0xfc, 0xf3, 0xbc, 0xf9, 0xf8, 0xe3, 0xd4, 0x79, 0xea,
+    0x29, 0x8b, 0x9f, 0x9d, 0xad, 0x60, 0xe8, 0x44, 0xd7, 0x6d, 0xc7, 0x04, 0xa1, 0x26, 0xca, 0xb2,
+    0xe3, 0xba, 0x6e, 0x3c, 0x35, 0x32, 0xc2, 0x07, 0xa0, 0x88, 0x1a, 0xc2, 0xb5, 0x86, 0x92, 0x24,
+    0x5c, 0x36, 0xf9, 0x89, 0x7d, 0x7f, 0xff, 0xe0, 0x57, 0xee, 0x59, 0x3b, 0x94, 0x0b, 0x0e, 0x17,
+    0xbc, 0x02, 0x32, 0x0c, 0x7e, 0xf0, 0x83, 0xb6, 0xdc, 0xd7, 0xf7, 0x19, 0x70, 0xbc, 0x5e, 0xfa,
+    0x07, 0x3f, 0x58, 0x4e, 0x9c, 0x3c, 0xd9, 0x95, 0x1b, 0x0d, 0x9f, 0x35, 0x5b, 0x20, 0x10, 0xd2,
+    0x14, 0x09, 0xa9, 0x41, 0xfe, 0xc7, 0xc1, 0x70, 0xaf, 0x8d, 0x17, 0x50, 0x42, 0x0c, 0x0a, 0xc4,
+    0xb1, 0xe7, 0x1b, 0x3c, 0xe6, 0xc2, 0x18, 0x11, 0x17, 0xb9, 0x64, 0x52, 0x40, 0x4d, 0x73, 0x15,
+    0x12, 0x4b, 0x56, 0x51, 0x74, 0xa3, 0xc6, 0x28, 0x58, 0xde, 0x90, 0x86, 0x86, 0x49, 0x19, 0xf1,
+    0x36, 0x8a, 0x4f, 0x58, 0x9e, 0x87, 0x4f, 0x9d, 0xea, 0xca, 0x40, 0x68, 0xc8, 0x31, 0x59, 0x8a,
+    0x48, 0x39, 0xd7, 0x0d, 0xc2, 0x67, 0x9e, 0x39, 0x8d, 0x9f, 0x7d, 0xf6, 0x34, 0x7f, 0xfc, 0xf8,
+    0x12, 0xaa, 0xd5, 0xba, 0x58, 0x14, 0x31, 0x86, 0xf5, 0xfa, 0xb0, 0x1c, 0xf1, 0xbc, 0x9a, 0x96,
+    0x4c, 0x96, 0x9a, 0x8b, 0x8b, 0x91, 0x6b, 0x98, 0xa4, 0x93, 0x29, 0x18, 0x28, 0x9f, 0xfd, 0xfd,
+    0x7d, 0x5f, 0x7b, 0xf0, 0x73, 0x6c, 0x7b, 0x6b, 0x47, 0x72, 0xe1, 0xe1, 0xa2, 0x20, 0x20, 0xc3,
+    0xe8, 0xad, 0xb7, 0x3e, 0x2c, 0xe8, 0xfa, 0xf7, 0x69, 0xa7, 0xe3, 0xc7, 0xfe, 0xe1, 0x1f, 0x56,
+    0xe4, 0x13, 0x27, 0xe6, 0x45, 0x50, 0x40, 0x30, 0x1d, 0x5c, 0xd7, 0xf7, 0x93, 0xa1, 0x24, 0xc5,
+    0x3c, 0xc7, 0x49, 0x7b, 0xb6, 0x9d, 0xf3, 0x5c, 0x37, 0x0f, 0xe3, 0xf3, 0x9c, 0x20, 0x64, 0x10,
+    0x21, 0x71, 0x4c, 0x11, 0x27, 0x68, 0x71, 0x44, 0xd8, 0x07, 0x78, 0xbd, 0xd0, 0x64, 0xb5, 0xaa,
+    0xbc, 0x50, 0xe1, 0x03, 0xae, 0xa0, 0xa4, 0xfb, 0xb6, 0xc7, 0x1a, 0xdf, 0xfa, 0x1e, 0xa3, 0xe3,
+    0xfa, 0x96, 0x40, 0x16, 0xeb, 0xf5, 0xc0, 0xbc, 0xff, 0xfe, 0x97, 0x19, 0x06, 0x20, 0x67, 0x6f,
+    0x1e, 0xcb, 0xb2, 0x58, 0xe8, 0xef, 0xbd, 0x32, 0x1a, 0x02, 0xb1, 0x22, 0x20, 0xb9, 0xac, 0xeb,
+    0x92, 0xc0, 0x3e, 0xe9, 0xe4, 0xba, 0xab, 0x82, 0x96, 0x38, 0x11, 0xf4, 0x4f, 0x7d, 0x3a, 0x3e,
+    0x36, 0x78, 0xcb, 0xeb, 0xbe, 0xf6, 0x3f, 0xbe, 0x06, 0x62, 0x7c, 0xc1, 0x92, 0x8f, 0x61, 0xad,
+    0x54, 0xf6, 0x22, 0xc1, 0xd2, 0x1f, 0xff, 0xf1, 0x90, 0x79, 0xea, 0xd4, 0x17, 0x20, 0xe9, 0x2f,
+    0x80, 0xd1, 0x60, 0xb5, 0x9f, 0x25, 0x38, 0x01, 0x22, 0x10, 0x43, 0x22, 0x30, 0x0c, 0x0e, 0x45,
+    0x4f, 0x17, 0x8b, 0x42, 0x0b, 0xf2, 0x34, 0x7e, 0x74, 0x14, 0xa9, 0x10, 0x52, 0x03, 0xc8, 0xc7,
+    0xda, 0xf3, 0xf3, 0xd4, 0xab, 0x54, 0x16, 0x8c, 0x67, 0x9e, 0x39, 0xce, 0xe9, 0xc9, 0x14, 0xbf,
+    0x79, 0xf7, 0x95, 0xb9, 0x7c, 0x96, 0x17, 0x69, 0x04, 0xc6, 0xa1, 0x8b, 0xc2, 0x20, 0x44, 0x85,
+    0xab, 0xf7, 0x44, 0x63, 0xfb, 0xae, 0x71, 0xb8, 0x56, 0xc3, 0x32, 0xbe, 0xf6, 0xb5, 0x46, 0xd4,
+    0x6c, 0xf6, 0x2a, 0x3c, 0x30, 0xf5, 0x03, 0xa5, 0xc5, 0x61, 0x14, 0x91, 0xda, 0xfa, 0xfb, 0x27,
+    0x99, 0x7c, 0x5e, 0x85, 0xbc, 0x8f, 0x3d, 0x37, 0x61, 0x6a, 0xda, 0xbb, 0x08, 0x5e, 0x14, 0xfa,
+    0x1d, 0xdf, 0xff, 0xa1, 0x9c, 0xc9, 0xfe, 0xd5, 0xe5, 0x5f, 0xfb, 0xda, 0x31, 0x36, 0x8d, 0xcd,
+    0x7b, 0xa1, 0x83, 0x1d, 0xfb, 0x45, 0x03, 0x4a, 0x6f, 0xe7, 0x4f, 0x7d, 0x7e, 0xc7, 0x6f, 0xf8,
+    0xff, 0xb0, 0xf0, 0x11, 0xd3, 0x76, 0x45, 0xc8, 0x04, 0x3d, 0x08, 0xb7, 0x21, 0x7b, 0x86, 0xcb,
+    0x1e, 0xc7, 0x81, 0xe2, 0x89, 0x10, 0x12, 0x07, 0x23, 0x59, 0x96, 0x5c, 0x55, 0xf5, 0xf8, 0x58,
+    0x4c, 0x96, 0x20, 0x9f, 0x0b, 0x4b, 0x25, 0xbb, 0x74, 0xf0, 0xe0, 0x62, 0xfd, 0xf1, 0xc7, 0x17,
+    0x38, 0x08, 0xcf, 0xfa, 0x65, 0xbb, 0x76, 0x09, 0x42, 0xba, 0x2f, 0x0a, 0x99, 0x5f, 0x66, 0x2b,
+    0x26, 0x44, 0x43, 0x51, 0x3b, 0xc3, 0x87, 0x75, 0x95, 0xa3, 0x67, 0xbe, 0xb3, 0xb1, 0x41, 0xbe,
+    0xf5, 0x9f, 0xa8, 0xd5, 0x6e, 0xbb, 0x90, 0xe8, 0x85, 0xc9, 0x64, 0x52, 0xd6, 0xd8, 0x57, 0x11,
+    0x01, 0x9e, 0x2a, 0x60, 0xb2, 0x67, 0xca, 0xa3, 0x97, 0x6b, 0x5f, 0x1d, 0xba, 0x6c, 0xf5, 0xbe,
+    0xf4, 0xf8, 0xfd, 0x2f, 0xfb, 0x44, 0xd7, 0x85, 0x8e, 0x8b, 0x26, 0x04, 0x33, 0xfc, 0xf0, 0x87,
+    0x5f, 0xc6, 0xed, 0xad, 0x9a, 0xd5, 0x7c, 0x4d, 0x62, 0x21, 0x11, 0x13, 0x1d, 0x15, 0xc8, 0x07,
+    0x2c, 0xc0, 0x42, 0x2e, 0x97, 0x55, 0xf2, 0xf9, 0x0c, 0xf0, 0x28, 0x84, 0x10, 0x5d, 0xe6, 0x1c,
+    0xa7, 0xab, 0x2c, 0x2e, 0x2e, 0x09, 0xb5, 0x5a, 0x5d, 0x31, 0x58, 0x42, 0xd6, 0x59, 0x05, 0x63,
+    0xe1, 0x12, 0x20, 0x1f, 0x6b, 0x57, 0xfa, 0xc9, 0xe5, 0x03, 0xe9, 0xb2, 0x51, 0x5a, 0x63, 0x18,
+    0xe4, 0x91, 0x32, 0x8d, 0x8c, 0x04, 0x1f, 0xb5, 0x65, 0x8e, 0x9e, 0xf9, 0xc0, 0x33, 0x2b, 0xa8,
+    0x86, 0x0e, 0xaf, 0x87, 0xda, 0x5e, 0x17, 0x8b, 0xc7, 0x59, 0xab, 0x5d, 0x88, 0x91, 0xd0, 0x48,
+    0x04, 0xa8, 0x7c, 0x63, 0x52, 0x72, 0x3e, 0xf2, 0x86, 0x2c, 0x7f, 0xe7, 0x55, 0x22, 0xde, 0x14,
+    0x27, 0x6d, 0x14, 0x53, 0xd8, 0xb2, 0x17, 0x13, 0x2e, 0x2a, 0x02, 0x32, 0x84, 0x61, 0xc9, 0xed,
+    0x14, 0x2c, 0x77, 0xe5, 0xda, 0x48, 0xf5, 0xe3, 0xec, 0x19, 0x08, 0x44, 0xc2, 0x64, 0x52, 0x97,
+    0xfa, 0xfb, 0x73, 0x52, 0x3e, 0x9f, 0x02, 0x5b, 0xe0, 0xf1, 0x8e, 0xd3, 0x72, 0x38, 0x8e, 0xf8,
+    0xcd, 0x66, 0xab, 0xb3, 0xb2, 0x52, 0x62, 0x45, 0x32, 0x94, 0x3d, 0x73, 0x03, 0xf2, 0x00, 0x01,
+    0x91, 0xc0, 0x89, 0xde, 0x4c, 0x7b, 0xc6, 0x5b, 0xea, 0x2e, 0xba, 0x31, 0x14, 0x34, 0xd2, 0x7c,
+    0x54, 0x8f, 0x73, 0xc4, 0x62, 0x95, 0x5f, 0x89, 0x20, 0xf0, 0xec, 0x25, 0x91, 0xde, 0xab, 0xa1,
+    0xeb, 0x79, 0x21, 0x3b, 0xc9, 0x4c, 0xee, 0x88, 0xc0, 0x63, 0x67, 0x77, 0xbf, 0x3e, 0xff, 0x4e,
+    0xad, 0x6f, 0xe6, 0x5d, 0x38, 0xdf, 0xda, 0x59, 0xa5, 0x46, 0xf4, 0x82, 0xd9, 0x6c, 0x3e, 0x6a,
+    0x06, 0xc1, 0x69, 0xc6, 0x59, 0xf0, 0x2d, 0x17, 0x17, 0x2e, 0x8a, 0x62, 0x98, 0x0d, 0xbc, 0xff,
+    0xfd, 0x08, 0xcc, 0xa8, 0x30, 0x68, 0x18, 0xd6, 0x26, 0x47, 0x30, 0x0b, 0xf6, 0x70, 0xc4, 0xd8,
+    0x42, 0x25, 0x9c, 0x4d, 0x08, 0x92, 0x2c, 0x89, 0x10, 0x72, 0xc3, 0x4e, 0xc7, 0x60, 0xee, 0x98,
+    0xd5, 0x5e, 0x85, 0x34, 0x8d, 0x32, 0xc2, 0xb1, 0x0a, 0x0d, 0x4e, 0x10, 0x50, 0xb7, 0xdb, 0x0d,
+    0x58, 0x93, 0x1d, 0xf1, 0x08, 0x37, 0x48, 0x46, 0xcf, 0x3a, 0x38, 0x10, 0x8c, 0xc8, 0xe1, 0x78,
+    0x1c, 0xf9, 0x68, 0x64, 0x3c, 0x17, 0x6d, 0xda, 0x34, 0x14, 0x0d, 0x0d, 0x15, 0x48, 0xa1, 0x90,
+    0x16, 0x1b, 0x8d, 0x0e, 0xb0, 0x9d, 0x04, 0xb0, 0xae, 0xae, 0x8a, 0x90, 0x7b, 0xfd, 0x9e, 0x84,
+    0xf2, 0xeb, 0x77, 0xf4, 0x45, 0x57, 0xf6, 0x67, 0x6c, 0xc5, 0x50, 0x10, 0x87, 0xc1, 0x7f, 0x74,
+    0x6c, 0x84, 0x1a, 0x3e, 0x21, 0x2d, 0x43, 0x92, 0xe4, 0x85, 0x44, 0x22, 0x7d, 0xfc, 0xcf, 0xfe,
+    0xec, 0xc9, 0x7f, 0xf4, 0x81, 0xec, 0x0b, 0x19, 0x17, 0x15, 0x01, 0x6f, 0xbb, 0x0d, 0x61, 0x4d,
+    0xb3, 0xfb, 0x9a, 0xcd, 0xee, 0x98, 0xeb, 0x36, 0xd3, 0x54, 0xf2, 0x69, 0x3b, 0xdf, 0x0c, 0x4d,
+    0xad, 0x61, 0x71, 0x81, 0xc2, 0xab, 0x58, 0x57, 0x58, 0xf5, 0x15, 0xec, 0x79, 0x2e, 0x90, 0x8e,
+    0x15, 0xe8, 0xb1, 0x62, 0x19, 0xb0, 0x1a, 0x40, 0x20, 0x20, 0x20, 0x12, 0x45, 0x56, 0x57, 0x10,
+    0xf3, 0xc0, 0xab, 0xb8, 0x1d, 0x56, 0x7c, 0x44, 0xf8, 0x16, 0xf1, 0x12, 0x6d, 0x8c, 0xd2, 0x0b,
+    0x65, 0x30, 0x2a, 0xab, 0x95, 0xa5, 0xa8, 0x52, 0x2b, 0xd9, 0xab, 0xab, 0xf5, 0xb6, 0xd3, 0x76,
+    0xcc, 0x5d, 0x99, 0x44, 0x78, 0xdb, 0xc4, 0x40, 0xeb, 0x5a, 0x3d, 0x13, 0x8c, 0x8f, 0xf0, 0x7c,
+    0x2f, 0xc2, 0xb2, 0xfa, 0x0e, 0x71, 0x10, 0x44, 0x12, 0x84, 0xe1, 0xaa, 0xc5, 0xf3, 0x84, 0x42,
+    0xea, 0x09, 0x29, 0xa7, 0xb6, 0x10, 0x8f, 0xc7, 0x8f, 0x7d, 0xf2, 0x93, 0x4f, 0x5d, 0x90, 0x05,
+    0xce, 0x3f, 0x0e, 0x17, 0x15, 0x01, 0x1f, 0x78, 0x00, 0xa1, 0x99, 0x99, 0x74, 0x7f, 0xb7, 0x4b,
+    0x36, 0xb1, 0xef, 0xd4, 0x41, 0xb4, 0x04, 0x9e, 0x05, 0xc4, 0xe5, 0xeb, 0x5e, 0x59, 0x3a, 0xd2,
+    0x5e, 0x26, 0x27, 0xea, 0xec, 0x33, 0xf6, 0x92, 0x2f, 0x20, 0x11, 0xc4, 0x11, 0x09, 0x12, 0xa6,
+    0xac, 0xc5, 0x82, 0x4c, 0x26, 0x65, 0xb6, 0x5a, 0x16, 0xe4, 0x86, 0xac, 0x0a, 0x0c, 0xf3, 0x2b,
+    0x98, 0x87, 0xf8, 0xaa, 0x47, 0x5c, 0x27, 0x45, 0x84, 0x5a, 0x2a, 0x44, 0xab, 0xb9, 0x50, 0x28,
+    0xf1, 0x09, 0xea, 0x7b, 0x13, 0xbc, 0xe6, 0x5e, 0xa5, 0x17, 0xfc, 0x9b, 0x06, 0xc6, 0xb9, 0x1d,
+    0x99, 0xbc, 0x1f, 0x23, 0x6a, 0xc7, 0x2c, 0x47, 0xad, 0xd6, 0x9c, 0xe1, 0x79, 0x8e, 0x13, 0x8b,
+    0x15, 0xc5, 0x54, 0x6a, 0x4c, 0xa0, 0x34, 0x0a, 0x0c, 0xe3, 0x60, 0x17, 0xe3, 0x88, 0x8a, 0xa2,
+    0xe8, 0xc9, 0x72, 0x62, 0x41, 0x96, 0x53, 0x47, 0xee, 0xbd, 0xf7, 0x89, 0x0b, 0xaa, 0xba, 0xd5,
+    0x4f, 0xc2, 0x45, 0x95, 0x03, 0x32, 0xb3, 0x2b, 0x8a, 0x49, 0x97, 0xe7, 0x53, 0x1e, 0xc6, 0x29,
+    0xf8, 0x9d, 0x12, 0x30, 0x4e, 0xc3, 0x4d, 0x98, 0x02, 0x6f, 0x90, 0xc0, 0x9e, 0xec, 0xf8, 0x0b,
+    0xf9, 0x63, 0x9d, 0xa7, 0xb7, 0x3c, 0xde, 0x7d, 0x7a, 0xd3, 0xe3, 0xe6, 0x91, 0xcc, 0x41, 0x79,
+    0x35, 0x55, 0xd3, 0x4d, 0xd1, 0x50, 0xa5, 0x01, 0x7d, 0x10, 0x69, 0x44, 0xe2, 0x62, 0x08, 0x73,
+    0x19, 0x88, 0xc9, 0xa3, 0x22, 0xef, 0x6f, 0x13, 0x85, 0xe0, 0x1a, 0x91, 0x9a, 0xb7, 0x4a, 0xa8,
+    0xf1, 0xfe, 0x98, 0x5a, 0xbd, 0x33, 0x91, 0x6d, 0x5e, 0x25, 0xc6, 0x3a, 0x39, 0x9b, 0x74, 0xdd,
+    0xaa, 0x53, 0xa9, 0xcc, 0x45, 0x96, 0x65, 0x20, 0x49, 0x4a, 0x88, 0x61, 0x58, 0x43, 0xed, 0xf6,
+    0x93, 0x5d, 0xd8, 0x8d, 0x28, 0x91, 0x28, 0xa2, 0x78, 0x7c, 0x10, 0x92, 0x44, 0x3e, 0x8a, 0x22,
+    0x3f, 0x0a, 0x81, 0xd4, 0x90, 0x72, 0xc2, 0xbe, 0x9d, 0x69, 0x01, 0xe1, 0xa2, 0xc1, 0x45, 0x67,
+    0x42, 0x34, 0x6d, 0xd4, 0xd6, 0xb4, 0x49, 0x1a, 0x8b, 0x0d, 0xc9, 0x92, 0x94, 0x97, 0x04, 0x21,
+    0x27, 0x88, 0x62, 0x9e, 0x67, 0x9d, 0x24, 0xe5, 0x04, 0x49, 0xca, 0x88, 0x9c, 0xa0, 0x0b, 0x76,
+    0x8c, 0x46, 0xe5, 0xcc, 0x4a, 0xe3, 0x44, 0xfc, 0xf1, 0x85, 0x17, 0x62, 0x7f, 0x7f, 0xec, 0x50,
+    0xff, 0x43, 0xa7, 0x4f, 0xed, 0x5b, 0xb6, 0x66, 0xdf, 0x6a, 0x84, 0x8b, 0x6f, 0x0b, 0xc8, 0xf2,
+    0x6d, 0x94, 0x56, 0x5e, 0x1f, 0xd1, 0xfa, 0xae, 0x80, 0x1a, 0x43, 0x32, 0x8e, 0x12, 0xfd, 0x90,
+    0x46, 0x8e, 0x04, 0x82, 0x50, 0x30, 0x3d, 0x2f, 0xaa, 0xda, 0xb6, 0x55, 0xf1, 0x3c, 0xf6, 0x35,
+    0x22, 0xc5, 0x97, 0xe5, 0x24, 0x56, 0xd5, 0x7c, 0x2c, 0x8a, 0x2c, 0x3e, 0x0c, 0xad, 0x10, 0x7c,
+    0x0f, 0x91, 0xe5, 0x38, 0x64, 0x99, 0x05, 0x19, 0x52, 0x4a, 0xf6, 0xd5, 0x45, 0x56, 0x4c, 0xc8,
+    0xde, 0x51, 0x62, 0x65, 0xd4, 0x17, 0x15, 0x2e, 0x3a, 0x02, 0xea, 0xfa, 0x65, 0x7e, 0x3a, 0xbd,
+    0x85, 0xd7, 0xf5, 0x21, 0x55, 0xd7, 0xfb, 0x54, 0x55, 0xcd, 0x41, 0x04, 0xd4, 0x41, 0x05, 0x45,
+    0x2e, 0x0c, 0x31, 0x98, 0x14, 0x8a, 0x5d, 0x17, 0x07, 0x9e, 0xc7, 0xbb, 0x51, 0x24, 0x59, 0x94,
+    0x4a, 0x16, 0xfb, 0x46, 0x21, 0x45, 0xd8, 0x23, 0x14, 0xb3, 0x96, 0x2a, 0x7b, 0x8f, 0xe1, 0xd8,
+    0xb3, 0x0c, 0xf6, 0x3f, 0xcf, 0x67, 0xa5, 0x6c, 0xf6, 0x0d, 0x7d, 0x85, 0xc2, 0x1b, 0x87, 0xfa,
+    0xfa, 0x6e, 0xe9, 0x1f, 0x19, 0x79, 0x4b, 0x71, 0x74, 0xf4, 0x17, 0x32, 0x92, 0x34, 0xe8, 0x03,
+    0xb1, 0xaa, 0x96, 0xd5, 0xad, 0xb9, 0xae, 0x63, 0x70, 0x9c, 0xcc, 0xaa, 0x7e, 0xc9, 0xa6, 0xb9,
+    0xe0, 0x75, 0x3a, 0xcb, 0x3e, 0xa8, 0x1e, 0x97, 0x48, 0xec, 0x49, 0x8b, 0xe2, 0xae, 0x44, 0x18,
+    0x7a, 0x81, 0xef, 0xdb, 0x1e, 0x90, 0xb0, 0x57, 0x78, 0x7d, 0x31, 0xe1, 0xa2, 0x23, 0x20, 0xa5,
+    0x43, 0x46, 0x2c, 0x56, 0xb0, 0x52, 0xa9, 0x01, 0x4f, 0xd7, 0x8b, 0x82, 0xa2, 0xa4, 0x44, 0x4a,
+    0x21, 0x9c, 0xfa, 0x2e, 0x64, 0x7f, 0x1e, 0xc4, 0x44, 0x4d, 0x66, 0x8d, 0xfd, 0x62, 0x1c, 0x83,
+    0x73, 0xc3, 0xbd, 0x2c, 0x24, 0xb2, 0x72, 0x15, 0x56, 0xba, 0x02, 0x43, 0x67, 0x7e, 0x6b, 0xda,
+    0x44, 0x2c, 0x93, 0x99, 0x4c, 0xf4, 0xf5, 0xed, 0x4c, 0x42, 0x5f, 0x4f, 0xa7, 0x37, 0x27, 0xb3,
+    0xd9, 0x69, 0x3d, 0x95, 0x9a, 0x52, 0x83, 0xa0, 0xde, 0x6c, 0xb7, 0x67, 0x57, 0x9a, 0xcd, 0xa5,
+    0x92, 0xeb, 0xda, 0x26, 0x90, 0x59, 0x6c, 0xb5, 0x9e, 0x30, 0xcb, 0xe5, 0xa7, 0x0d, 0xdb, 0x6e,
+    0x92, 0x54, 0x6a, 0x4b, 0x3c, 0x97, 0xbb, 0x2e, 0x89, 0x50, 0x0e, 0x87, 0x61, 0xdb, 0xc5, 0xf8,
+    0xf8, 0x99, 0x72, 0xc4, 0x8b, 0x05, 0x17, 0x1d, 0x01, 0x6d, 0x5b, 0xea, 0xa6, 0xd3, 0x23, 0xe5,
+    0x6c, 0x76, 0xa8, 0xae, 0x69, 0x49, 0x56, 0x11, 0x46, 0xc1, 0x58, 0xd6, 0x05, 0x21, 0x1f, 0x8f,
+    0xc5, 0xae, 0x4c, 0x67, 0xb3, 0x37, 0xf7, 0x0d, 0x0c, 0xfc, 0xc2, 0xc8, 0xe8, 0xe8, 0x3b, 0x86,
+    0xf2, 0xf9, 0xd7, 0xe5, 0xc1, 0xba, 0xae, 0x1b, 0xb5, 0xf5, 0x42, 0xbd, 0x1e, 0xf9, 0x7a, 0x55,
+    0xef, 0x81, 0x8c, 0xac, 0x56, 0x7f, 0x27, 0xc0, 0xd8, 0x0f, 0x44, 0x31, 0xf4, 0x25, 0x09, 0x85,
+    0x84, 0xb8, 0xa1, 0xe7, 0x19, 0x90, 0xd7, 0x39, 0x10, 0x52, 0xed, 0x28, 0x08, 0x5a, 0xae, 0x61,
+    0xcc, 0x36, 0x1c, 0xa7, 0xd1, 0x8a, 0xa2, 0xd0, 0x77, 0xdd, 0x45, 0xd2, 0x68, 0x3c, 0xd4, 0x71,
+    0x9c, 0x5a, 0xa0, 0xeb, 0x83, 0x52, 0x26, 0xb3, 0x49, 0x51, 0xd5, 0x29, 0x91, 0x10, 0xcb, 0xf3,
+    0xbc, 0xfa, 0x99, 0x26, 0xde, 0x2e, 0x16, 0x5c, 0x74, 0x04, 0xdc, 0xbb, 0xf7, 0x83, 0x41, 0x22,
+    0x31, 0x38, 0x0f, 0xe1, 0xb7, 0xcc, 0x71, 0x82, 0x03, 0xa4, 0xe0, 0x59, 0x85, 0x69, 0x5d, 0xdf,
+    0x92, 0xc9, 0xe7, 0xaf, 0xd0, 0xf3, 0xf9, 0xcb, 0x93, 0xe9, 0xf4, 0xf6, 0x54, 0x36, 0xbb, 0x2b,
+    0xdb, 0xdf, 0x7f, 0x75, 0x36, 0x9d, 0xde, 0x9d, 0x04, 0xd3, 0xdb, 0x5b, 0x76, 0x4d, 0xfd, 0xd6,
+    0xd2, 0xb4, 0x0d, 0x3a, 0xda, 0xf6, 0xac, 0x55, 0x2a, 0x3d, 0x56, 0x2f, 0x95, 0x9e, 0xa9, 0xd7,
+    0x6a, 0x2f, 0x34, 0xab, 0xd5, 0xe7, 0x9b, 0xe5, 0xf2, 0xfe, 0x66, 0xb3, 0xf9, 0x78, 0x0b, 0xe3,
+    0x10, 0x42, 0x34, 0xfb, 0x02, 0x6c, 0x88, 0x83, 0xa0, 0x66, 0xb3, 0x50, 0x1b, 0x45, 0x1c, 0xa8,
+    0x6d, 0x83, 0x04, 0x81, 0x01, 0xf9, 0x22, 0x4f, 0x54, 0x35, 0xc1, 0x2b, 0xca, 0x00, 0x7b, 0xcb,
+    0x33, 0x70, 0xdd, 0xf5, 0x17, 0xe9, 0x2f, 0x22, 0x5c, 0x74, 0x04, 0x64, 0x90, 0xa4, 0xf8, 0xac,
+    0x28, 0xc6, 0x16, 0x7c, 0x3f, 0xa8, 0x3a, 0x4e, 0x0b, 0x72, 0xaf, 0x5e, 0x7b, 0xe1, 0xbc, 0xa6,
+    0xc5, 0x84, 0x54, 0x2a, 0xcd, 0xc5, 0xe3, 0x3a, 0x84, 0xe6, 0x18, 0x98, 0x04, 0x09, 0xc6, 0xa5,
+    0x24, 0xf6, 0x09, 0x58, 0xf8, 0x0d, 0x06, 0x45, 0x16, 0x78, 0x5e, 0x86, 0xf1, 0x32, 0x98, 0x96,
+    0x84, 0xc8, 0xf3, 0x71, 0x81, 0x95, 0x59, 0x43, 0x58, 0x6d, 0xcf, 0xce, 0xfe, 0xf5, 0xca, 0xec,
+    0xec, 0x67, 0x17, 0xe7, 0xe7, 0xff, 0xdf, 0xa5, 0x6a, 0xf5, 0x6f, 0xcb, 0x94, 0x2e, 0x7b, 0xa0,
+    0x8a, 0x58, 0x10, 0x42, 0x6e, 0xad, 0xef, 0x02, 0x73, 0x3d, 0x87, 0x35, 0x94, 0x10, 0x86, 0x2e,
+    0x10, 0x77, 0xc1, 0xb6, 0xed, 0x1a, 0xa8, 0x9e, 0x05, 0xdb, 0x96, 0x23, 0x0e, 0x78, 0x59, 0x2c,
+    0x46, 0x17, 0x9d, 0x02, 0x5e, 0x54, 0xe5, 0x80, 0x1b, 0xf8, 0xf8, 0xc7, 0xff, 0xab, 0xe5, 0xba,
+    0xab, 0x05, 0x30, 0x03, 0xe9, 0x66, 0x73, 0x36, 0xe5, 0x79, 0xec, 0xd3, 0xb9, 0x5e, 0x24, 0x8a,
+    0x1c, 0xe1, 0xb8, 0x88, 0x0b, 0x02, 0x93, 0x5a, 0x56, 0xd9, 0x75, 0x9c, 0x65, 0xd3, 0x75, 0x4f,
+    0x59, 0xa2, 0xe8, 0x53, 0x59, 0x96, 0x78, 0x41, 0x10, 0x79, 0x59, 0xee, 0x53, 0x13, 0x89, 0x2b,
+    0xd2, 0xc9, 0xe4, 0xe5, 0x99, 0x54, 0xea, 0xb2, 0x74, 0x22, 0x31, 0x11, 0x23, 0xc4, 0xa7, 0x51,
+    0xb4, 0xe2, 0x71, 0x9c, 0x01, 0xcb, 0x5b, 0x84, 0x55, 0x67, 0xc5, 0x98, 0x55, 0xd8, 0x8f, 0x98,
+    0x02, 0xf6, 0x8a, 0x58, 0x98, 0x7a, 0xf2, 0xbc, 0x40, 0xc1, 0x25, 0xc7, 0x20, 0xe4, 0xcb, 0x61,
+    0x58, 0x01, 0x32, 0x26, 0x39, 0xcf, 0x33, 0x21, 0xf7, 0xac, 0xcd, 0xc9, 0xf2, 0xdc, 0x7e, 0x9e,
+    0xb7, 0x4f, 0x7c, 0xea, 0x53, 0xcd, 0x0b, 0xea, 0xad, 0xb7, 0x9f, 0x84, 0x8b, 0xaa, 0x36, 0xcc,
+    0x4b, 0xd1, 0x6e, 0x3f, 0x3b, 0x39, 0x3f, 0xff, 0xd8, 0xdb, 0x56, 0x56, 0x9e, 0xde, 0x67, 0x9a,
+    0xab, 0x23, 0x60, 0x85, 0x41, 0xe1, 0xe2, 0x31, 0x8e, 0x4b, 0xa7, 0xa3, 0x48, 0x16, 0x3d, 0xcf,
+    0xee, 0xfa, 0x7e, 0xb3, 0x21, 0x49, 0x5e, 0xc8, 0x88, 0x07, 0x6c, 0x12, 0xa2, 0x48, 0x94, 0x14,
+    0x65, 0x67, 0x5c, 0x55, 0xb7, 0x68, 0x3c, 0x9f, 0x94, 0xd8, 0x87, 0xab, 0x39, 0xce, 0x0d, 0x3b,
+    0x9d, 0x93, 0x9d, 0x95, 0x95, 0x2f, 0xad, 0x10, 0xb2, 0xd2, 0x33, 0x11, 0x2c, 0x3f, 0x5c, 0x2b,
+    0x51, 0x61, 0xef, 0x37, 0xf5, 0x72, 0x45, 0xe8, 0x0b, 0xa0, 0x82, 0x53, 0x39, 0x59, 0x2e, 0xa4,
+    0x29, 0x0d, 0xa4, 0x20, 0x58, 0xee, 0x28, 0x4a, 0x21, 0x12, 0x84, 0x3e, 0x41, 0x55, 0x85, 0x47,
+    0x0b, 0x85, 0xb9, 0xcf, 0xef, 0xdd, 0xfb, 0xdd, 0x1f, 0xc0, 0xbc, 0x17, 0x55, 0x51, 0xcc, 0x45,
+    0x19, 0x82, 0x19, 0x92, 0xc9, 0x3d, 0x73, 0xc9, 0x64, 0xfe, 0x68, 0x3a, 0x9d, 0x9f, 0x8b, 0xc7,
+    0x13, 0x10, 0x2e, 0x11, 0x10, 0xcc, 0x16, 0x41, 0x8d, 0x04, 0xdf, 0x5f, 0x02, 0x67, 0x5c, 0x13,
+    0x04, 0xc1, 0x93, 0x22, 0x60, 0x9d, 0xe7, 0xb9, 0x2a, 0x84, 0x6b, 0x1d, 0xc2, 0x67, 0x52, 0x92,
+    0xf4, 0x84, 0xae, 0xe7, 0xb5, 0x74, 0xba, 0x5f, 0x8e, 0xc7, 0x33, 0x40, 0xc8, 0x94, 0x20, 0xcb,
+    0x09, 0xe8, 0x32, 0xe2, 0x1a, 0xd1, 0xd8, 0x87, 0x8d, 0x08, 0x7b, 0x8a, 0xc7, 0x9e, 0xe6, 0x61,
+    0x9e, 0x57, 0x79, 0xf6, 0xc5, 0x77, 0x84, 0x62, 0x10, 0xb2, 0x35, 0x59, 0x10, 0x12, 0x9a, 0x20,
+    0xa4, 0x75, 0x8e, 0xcb, 0xa6, 0x21, 0xfe, 0x26, 0xd8, 0x07, 0x56, 0x15, 0x25, 0xdf, 0x51, 0xd5,
+    0x5c, 0xed, 0x62, 0x23, 0x1f, 0xc3, 0x45, 0x4b, 0x40, 0x30, 0x16, 0x11, 0xc6, 0xa9, 0xe7, 0xe3,
+    0xf1, 0xfc, 0x71, 0x45, 0xd1, 0x97, 0x59, 0x73, 0x1b, 0x41, 0xe0, 0x40, 0x67, 0xf5, 0x1c, 0x2c,
+    0x21, 0x9e, 0x02, 0x2a, 0x96, 0x86, 0x71, 0x19, 0xcb, 0xea, 0xa6, 0x2c, 0xcb, 0x8c, 0x05, 0x41,
+    0x28, 0x79, 0x5e, 0x8b, 0x7a, 0x5e, 0x09, 0xdc, 0xed, 0x8a, 0xeb, 0xba, 0x4b, 0x96, 0x61, 0x9c,
+    0x36, 0x4c, 0x73, 0xce, 0xf2, 0xfd, 0x12, 0x38, 0xe1, 0xc1, 0xb8, 0x2c, 0x4f, 0xe7, 0x40, 0x25,
+    0xf3, 0x9a, 0x76, 0x63, 0x31, 0x95, 0x7a, 0xd7, 0x50, 0x2e, 0xf7, 0xab, 0x23, 0x85, 0xc2, 0xaf,
+    0x0e, 0xeb, 0xfa, 0x75, 0x29, 0x58, 0x5f, 0x10, 0x86, 0x96, 0x0d, 0xeb, 0x36, 0xa3, 0x08, 0x7e,
+    0x04, 0x1e, 0xa8, 0x23, 0xbf, 0x00, 0x79, 0xe6, 0x6c, 0x2a, 0x35, 0xd2, 0xfb, 0x4c, 0xeb, 0xc5,
+    0x86, 0x8b, 0x36, 0x04, 0x33, 0x40, 0x9c, 0xc4, 0xa7, 0x4e, 0xfd, 0xd5, 0xd5, 0xb5, 0xda, 0x91,
+    0xb7, 0x36, 0x1a, 0x27, 0xaf, 0xf7, 0xbc, 0x4a, 0x81, 0x10, 0x0a, 0xc6, 0x02, 0xab, 0xa0, 0x76,
+    0x0a, 0xf4, 0x45, 0xd7, 0xb5, 0x05, 0x08, 0xc7, 0x60, 0x3c, 0x14, 0x53, 0x96, 0xd3, 0x96, 0x24,
+    0x65, 0xa8, 0xa2, 0x64, 0x40, 0x1d, 0x21, 0xf5, 0x23, 0xbe, 0xef, 0xba, 0xcb, 0xa6, 0xe3, 0xac,
+    0x06, 0x3c, 0x9f, 0x4b, 0xca, 0x72, 0x5e, 0x17, 0x45, 0x45, 0x92, 0xa4, 0x14, 0x18, 0x9d, 0x31,
+    0x30, 0x1f, 0x79, 0xe6, 0xb0, 0x39, 0x59, 0xe6, 0x80, 0x6c, 0x35, 0xa7, 0x52, 0x79, 0xbc, 0x63,
+    0x9a, 0x47, 0x1d, 0x8e, 0x93, 0x84, 0x20, 0x60, 0x6f, 0x03, 0x38, 0x73, 0x85, 0xc2, 0xce, 0x67,
+    0x86, 0x87, 0x77, 0x7c, 0xe7, 0xb2, 0xcb, 0xfe, 0xe0, 0x29, 0x50, 0xc0, 0x75, 0x6f, 0x7d, 0xf1,
+    0xe0, 0xa2, 0x26, 0x20, 0x43, 0xa5, 0x72, 0x38, 0xde, 0x6c, 0x3e, 0xf1, 0x0b, 0x95, 0xca, 0xb3,
+    0xaf, 0x6b, 0xb5, 0x8e, 0xee, 0x0c, 0x82, 0xb6, 0x18, 0x45, 0x48, 0xa2, 0x54, 0x8e, 0x85, 0x21,
+    0xa7, 0x11, 0xa2, 0xab, 0x18, 0x17, 0x15, 0x49, 0x4e, 0xbb, 0x02, 0x4f, 0xbb, 0x41, 0x50, 0x01,
+    0x63, 0x32, 0x63, 0x53, 0x6a, 0x06, 0x51, 0xc4, 0xca, 0xfa, 0x08, 0xe1, 0xf9, 0xa2, 0x26, 0xcb,
+    0xc3, 0x69, 0x20, 0x60, 0x92, 0xe5, 0x8b, 0x92, 0x94, 0xc3, 0xba, 0xbe, 0x55, 0x88, 0xc5, 0xc6,
+    0x64, 0x8e, 0x93, 0x59, 0x25, 0x6a, 0x0c, 0x24, 0xf5, 0x6b, 0xb5, 0x17, 0xac, 0x6a, 0xf5, 0xb1,
+    0x76, 0x14, 0x55, 0x5b, 0x3c, 0xbf, 0x74, 0x3c, 0x99, 0x74, 0xf7, 0x17, 0x0a, 0xc5, 0xfd, 0xc5,
+    0xe2, 0xc4, 0x33, 0x53, 0x53, 0xdf, 0xbe, 0xe8, 0x0a, 0xa1, 0x19, 0x2e, 0x4a, 0x17, 0xfc, 0x52,
+    0xfc, 0xe9, 0x9f, 0xde, 0xe7, 0x7f, 0xf4, 0xa3, 0xff, 0xd2, 0x89, 0xa2, 0x0e, 0x84, 0xd8, 0xa6,
+    0x1a, 0x04, 0x5d, 0x08, 0x95, 0x01, 0xb8, 0x5a, 0xcf, 0x07, 0x55, 0x23, 0x89, 0xc4, 0x35, 0xaa,
+    0x9e, 0xdc, 0x25, 0x27, 0xe2, 0x9b, 0xc4, 0x64, 0x72, 0x42, 0xd4, 0xb4, 0x22, 0xa8, 0x97, 0xe9,
+    0x39, 0xce, 0x69, 0x08, 0xa5, 0x3d, 0xb7, 0x81, 0x40, 0x09, 0x21, 0x77, 0x13, 0x21, 0xfb, 0x63,
+    0x4f, 0xdf, 0x3a, 0x16, 0x84, 0x69, 0x0b, 0x63, 0x05, 0x0c, 0x06, 0x6b, 0xf3, 0x92, 0x7d, 0xe5,
+    0xb5, 0x83, 0x81, 0xd8, 0x9c, 0xe3, 0x54, 0x39, 0x42, 0x22, 0x56, 0xf3, 0xe5, 0x64, 0x32, 0x19,
+    0x3d, 0x9e, 0xcd, 0x9a, 0xcf, 0x68, 0x5a, 0x78, 0x60, 0xe7, 0xce, 0xe7, 0xcf, 0x54, 0xe3, 0xbf,
+    0xd8, 0x70, 0xd1, 0x13, 0x90, 0xe1, 0x93, 0x9f, 0x1c, 0x6b, 0x5b, 0x56, 0x31, 0x44, 0xc8, 0xe0,
+    0x20, 0x47, 0x13, 0x21, 0x07, 0x04, 0x73, 0x10, 0x8a, 0x8a, 0x32, 0x29, 0xa5, 0xd3, 0x3b, 0xd5,
+    0x54, 0x6a, 0x8b, 0xa2, 0x69, 0xac, 0xf9, 0xb4, 0x0c, 0x6b, 0xa5, 0x97, 0xe5, 0x8a, 0x91, 0x65,
+    0x9d, 0x34, 0x19, 0x51, 0xd9, 0xf2, 0x18, 0xfb, 0xc0, 0xc3, 0x96, 0x4b, 0x48, 0xc5, 0x0a, 0x82,
+    0x55, 0xe8, 0x16, 0x0d, 0xc7, 0x59, 0xb2, 0x6d, 0xbb, 0xee, 0xb9, 0x6e, 0x3d, 0xb4, 0xed, 0xd5,
+    0xc0, 0x71, 0x56, 0x4c, 0x84, 0xec, 0xa5, 0x44, 0x22, 0xf5, 0x9c, 0xae, 0xc7, 0x1f, 0x4b, 0xa7,
+    0xe7, 0xfe, 0x61, 0x60, 0x20, 0x7c, 0x61, 0xfb, 0xf6, 0xe5, 0x17, 0x5b, 0x24, 0xba, 0x08, 0x71,
+    0xd1, 0x87, 0xe0, 0x0d, 0x50, 0xfa, 0x90, 0x30, 0x3b, 0xfb, 0xc3, 0x6d, 0xf5, 0xfa, 0xd1, 0xcb,
+    0xdb, 0xed, 0xca, 0x6e, 0xc3, 0xb0, 0xb6, 0x70, 0x5c, 0xa1, 0x3f, 0x95, 0xda, 0x97, 0xd3, 0xf5,
+    0xe9, 0x38, 0xcf, 0xc7, 0x81, 0x98, 0x21, 0xb6, 0xed, 0x8a, 0x5b, 0xaf, 0x3f, 0x55, 0x6b, 0xb5,
+    0xbe, 0x51, 0xa3, 0x34, 0x02, 0x85, 0xdb, 0x28, 0xb6, 0x7b, 0x31, 0x7d, 0x63, 0xb2, 0x08, 0x6e,
+    0x18, 0x4c, 0x0e, 0xf2, 0xc1, 0xf5, 0xba, 0x8a, 0x32, 0x6e, 0xc7, 0x62, 0xc5, 0xba, 0xa6, 0x25,
+    0x96, 0x40, 0xf1, 0x4e, 0x48, 0xd2, 0xdc, 0x0b, 0x7b, 0xf6, 0x3c, 0xb4, 0x0c, 0xd3, 0x2f, 0xaa,
+    0x32, 0xbf, 0x1f, 0x85, 0x4b, 0x04, 0x7c, 0x09, 0xee, 0xbe, 0xfb, 0x6e, 0xee, 0xbd, 0xef, 0x2d,
+    0x0d, 0x99, 0x66, 0xb8, 0xbb, 0xdd, 0x6e, 0x6f, 0x73, 0x1c, 0x63, 0x9c, 0xd2, 0xdc, 0xb0, 0x24,
+    0x4d, 0xf4, 0x03, 0x01, 0x93, 0x41, 0xe0, 0x8b, 0x96, 0xb5, 0x1a, 0xb4, 0xdb, 0x4f, 0xd7, 0xc3,
+    0xb0, 0xe2, 0x02, 0xcf, 0x80, 0x80, 0x14, 0xcc, 0x44, 0xef, 0xc3, 0x9c, 0x10, 0xb2, 0x31, 0x18,
+    0x0c, 0xf6, 0xc5, 0x4e, 0x64, 0xc2, 0x70, 0x57, 0x14, 0x71, 0x47, 0x51, 0x50, 0x53, 0x51, 0xf8,
+    0x86, 0xaa, 0xd2, 0x8a, 0xae, 0xf3, 0x4b, 0xa2, 0x28, 0x94, 0xa7, 0xa6, 0x4e, 0x5f, 0x94, 0xf9,
+    0xde, 0x8f, 0xc2, 0x25, 0x02, 0xfe, 0x08, 0xd4, 0x6a, 0x1f, 0x4f, 0x74, 0x3a, 0x64, 0xca, 0x30,
+    0x66, 0x46, 0x2c, 0x6b, 0x25, 0x17, 0x04, 0x76, 0x36, 0x0c, 0xc5, 0x34, 0x21, 0x4a, 0xda, 0x75,
+    0x1d, 0xc8, 0x01, 0x6d, 0x1f, 0xc2, 0xad, 0x0d, 0x2a, 0x17, 0x00, 0xf1, 0x3c, 0x8e, 0x23, 0x8e,
+    0x20, 0x60, 0x8b, 0x75, 0xa2, 0x48, 0x4d, 0x49, 0x22, 0x26, 0xe4, 0x7f, 0x06, 0xc7, 0x05, 0xed,
+    0x78, 0x9c, 0xb6, 0x64, 0xd9, 0xed, 0x6c, 0xde, 0xdc, 0x34, 0x61, 0xde, 0x8b, 0xae, 0x9c, 0xef,
+    0x27, 0xe1, 0x12, 0x01, 0x7f, 0x0c, 0xc0, 0x5b, 0xe0, 0xf9, 0xf9, 0xf7, 0xc9, 0x84, 0x34, 0x41,
+    0xf9, 0x3c, 0x20, 0x1f, 0x49, 0xf9, 0x7e, 0x5f, 0x8a, 0x90, 0x98, 0xec, 0xfb, 0x8d, 0x30, 0x8a,
+    0x8e, 0xb8, 0x40, 0xc0, 0x90, 0xe3, 0x42, 0x4f, 0x14, 0x39, 0x30, 0x24, 0xc4, 0x52, 0xd5, 0xc0,
+    0x72, 0x5d, 0xde, 0xd1, 0x75, 0xce, 0xdd, 0xbc, 0xf9, 0x34, 0x23, 0xe7, 0x25, 0xc2, 0x5d, 0xc2,
+    0xcf, 0x0e, 0x2c, 0xb5, 0xa3, 0xf4, 0x6e, 0x81, 0xd2, 0x1b, 0xa0, 0xbb, 0x9d, 0x67, 0x24, 0x5d,
+    0x9f, 0x74, 0x09, 0x97, 0x70, 0x09, 0x97, 0x70, 0x09, 0x97, 0x70, 0x09, 0x97, 0x70, 0x09, 0x97,
+    0x70, 0x09, 0x97, 0x70, 0x09, 0x97, 0x70, 0x09, 0x97, 0x70, 0x09, 0x97, 0x70, 0x09, 0x97, 0x70,
+    0x09, 0x97, 0x70, 0x09, 0x97, 0x70, 0x09, 0x97, 0x70, 0x09, 0x97, 0x70, 0x09, 0x97, 0x70, 0x09,
+    0x97, 0x70, 0x09, 0x97, 0x70, 0x09, 0x17, 0x39, 0x10, 0xfa, 0xff, 0x01, 0xfe, 0x32, 0xf5, 0x16,
+    0x84, 0x88, 0xe4, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+
+};
+
+const lv_image_dsc_t img_png_demo = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_RAW_ALPHA,
+    .header.flags = 0,
+    .header.w = 160,
+    .header.h = 120,
+    .header.stride = 0,
+    .data_size = sizeof(img_png_demo_map),
+    .data = img_png_demo_map,
+};
+
+#endif /*LV_USE_LIBPNG && LV_BUILD_EXAMPLES*/
@@ -0,0 +1,38 @@
+/**
+ * @file lv_example_libpng.h
+ *
+ */
+
+#ifndef LV_EXAMPLE_LIBPNG_H
+#define LV_EXAMPLE_LIBPNG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+void lv_example_libpng_1(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_EXAMPLE_LIBPNG_H*/
@@ -0,0 +1,73 @@
+
+#include "../../lv_examples.h"
+
+#if LV_USE_TABLE && LV_USE_FILE_EXPLORER && (LV_USE_FS_STDIO || LV_USE_FS_POSIX || LV_USE_FS_WIN32 || LV_USE_FS_FATFS) && LV_BUILD_EXAMPLES
+
+#include <stdlib.h>
+#include <string.h>
+
+static void file_explorer_event_handler(lv_event_t * e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_target(e);
+
+    if(code == LV_EVENT_VALUE_CHANGED) {
+        const char * cur_path =  lv_file_explorer_get_current_path(obj);
+        const char * sel_fn = lv_file_explorer_get_selected_file_name(obj);
+        LV_LOG_USER("%s%s", cur_path, sel_fn);
+    }
+}
+
+void lv_example_file_explorer_1(void)
+{
+    lv_obj_t * file_explorer = lv_file_explorer_create(lv_screen_active());
+    lv_file_explorer_set_sort(file_explorer, LV_EXPLORER_SORT_KIND);
+
+#if LV_USE_FS_WIN32
+    lv_file_explorer_open_dir(file_explorer, "D:");
+#if LV_FILE_EXPLORER_QUICK_ACCESS
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_HOME_DIR, "C:/Users/Public/Desktop");
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_VIDEO_DIR, "C:/Users/Public/Videos");
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_PICTURES_DIR, "C:/Users/Public/Pictures");
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_MUSIC_DIR, "C:/Users/Public/Music");
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_DOCS_DIR, "C:/Users/Public/Documents");
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_FS_DIR, "D:");
+#endif
+
+#else
+    /* linux */
+    lv_file_explorer_open_dir(file_explorer, "A:/");
+
+#if LV_FILE_EXPLORER_QUICK_ACCESS
+    char * envvar = "HOME";
+    char home_dir[LV_FS_MAX_PATH_LENGTH];
+    strcpy(home_dir, "A:");
+    /* get the user's home directory from the HOME environment variable*/
+    strcat(home_dir, getenv(envvar));
+    LV_LOG_USER("home_dir: %s\n", home_dir);
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_HOME_DIR, home_dir);
+    char video_dir[LV_FS_MAX_PATH_LENGTH];
+    strcpy(video_dir, home_dir);
+    strcat(video_dir, "/Videos");
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_VIDEO_DIR, video_dir);
+    char picture_dir[LV_FS_MAX_PATH_LENGTH];
+    strcpy(picture_dir, home_dir);
+    strcat(picture_dir, "/Pictures");
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_PICTURES_DIR, picture_dir);
+    char music_dir[LV_FS_MAX_PATH_LENGTH];
+    strcpy(music_dir, home_dir);
+    strcat(music_dir, "/Music");
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_MUSIC_DIR, music_dir);
+    char document_dir[LV_FS_MAX_PATH_LENGTH];
+    strcpy(document_dir, home_dir);
+    strcat(document_dir, "/Documents");
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_DOCS_DIR, document_dir);
+
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_FS_DIR, "A:/");
+#endif
+#endif
+
+    lv_obj_add_event_cb(file_explorer, file_explorer_event_handler, LV_EVENT_ALL, NULL);
+}
+
+#endif
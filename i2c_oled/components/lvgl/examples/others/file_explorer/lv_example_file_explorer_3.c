@@ -0,0 +1,116 @@
+
+#include "../../lv_examples.h"
+
+#if LV_USE_TABLE && LV_USE_FILE_EXPLORER && (LV_USE_FS_STDIO || LV_USE_FS_POSIX || LV_USE_FS_WIN32 || LV_USE_FS_FATFS) && LV_BUILD_EXAMPLES
+
+#include <stdlib.h>
+#include <string.h>
+
+static void exch_table_item(lv_obj_t * tb, int16_t i, int16_t j)
+{
+    const char * tmp;
+    tmp = lv_table_get_cell_value(tb, i, 0);
+    lv_table_set_cell_value(tb, 0, 2, tmp);
+    lv_table_set_cell_value(tb, i, 0, lv_table_get_cell_value(tb, j, 0));
+    lv_table_set_cell_value(tb, j, 0, lv_table_get_cell_value(tb, 0, 2));
+
+    tmp = lv_table_get_cell_value(tb, i, 1);
+    lv_table_set_cell_value(tb, 0, 2, tmp);
+    lv_table_set_cell_value(tb, i, 1, lv_table_get_cell_value(tb, j, 1));
+    lv_table_set_cell_value(tb, j, 1, lv_table_get_cell_value(tb, 0, 2));
+}
+
+/*Quick sort 3 way*/
+static void sort_by_file_kind(lv_obj_t * tb, int16_t lo, int16_t hi)
+{
+    if(lo >= hi) return;
+
+    int16_t lt = lo;
+    int16_t i = lo + 1;
+    int16_t gt = hi;
+    const char * v = lv_table_get_cell_value(tb, lo, 1);
+    while(i <= gt) {
+        if(strcmp(lv_table_get_cell_value(tb, i, 1), v) < 0)
+            exch_table_item(tb, lt++, i++);
+        else if(strcmp(lv_table_get_cell_value(tb, i, 1), v) > 0)
+            exch_table_item(tb, i, gt--);
+        else
+            i++;
+    }
+
+    sort_by_file_kind(tb, lo, lt - 1);
+    sort_by_file_kind(tb, gt + 1, hi);
+}
+
+static void file_explorer_event_handler(lv_event_t * e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_target(e);
+
+    if(code == LV_EVENT_VALUE_CHANGED) {
+        const char * cur_path =  lv_file_explorer_get_current_path(obj);
+        const char * sel_fn = lv_file_explorer_get_selected_file_name(obj);
+
+        LV_LOG_USER("%s%s", cur_path, sel_fn);
+    }
+    else if(code == LV_EVENT_READY) {
+        lv_obj_t * tb = lv_file_explorer_get_file_table(obj);
+        uint16_t sum = lv_table_get_row_count(tb);
+
+        sort_by_file_kind(tb, 0, (sum - 1));
+    }
+}
+
+void lv_example_file_explorer_3(void)
+{
+    lv_obj_t * file_explorer = lv_file_explorer_create(lv_screen_active());
+    /*Before custom sort, please set the default sorting to NONE. The default is NONE.*/
+    lv_file_explorer_set_sort(file_explorer, LV_EXPLORER_SORT_NONE);
+
+#if LV_USE_FS_WIN32
+    lv_file_explorer_open_dir(file_explorer, "D:");
+#if LV_FILE_EXPLORER_QUICK_ACCESS
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_HOME_DIR, "C:/Users/Public/Desktop");
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_VIDEO_DIR, "C:/Users/Public/Videos");
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_PICTURES_DIR, "C:/Users/Public/Pictures");
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_MUSIC_DIR, "C:/Users/Public/Music");
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_DOCS_DIR, "C:/Users/Public/Documents");
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_FS_DIR, "D:");
+#endif
+
+#else
+    /* linux */
+    lv_file_explorer_open_dir(file_explorer, "A:/");
+#if LV_FILE_EXPLORER_QUICK_ACCESS
+    char * envvar = "HOME";
+    char home_dir[LV_FS_MAX_PATH_LENGTH];
+    strcpy(home_dir, "A:");
+    /* get the user's home directory from the HOME environment variable*/
+    strcat(home_dir, getenv(envvar));
+    LV_LOG_USER("home_dir: %s\n", home_dir);
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_HOME_DIR, home_dir);
+    char video_dir[LV_FS_MAX_PATH_LENGTH];
+    strcpy(video_dir, home_dir);
+    strcat(video_dir, "/Videos");
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_VIDEO_DIR, video_dir);
+    char picture_dir[LV_FS_MAX_PATH_LENGTH];
+    strcpy(picture_dir, home_dir);
+    strcat(picture_dir, "/Pictures");
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_PICTURES_DIR, picture_dir);
+    char music_dir[LV_FS_MAX_PATH_LENGTH];
+    strcpy(music_dir, home_dir);
+    strcat(music_dir, "/Music");
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_MUSIC_DIR, music_dir);
+    char document_dir[LV_FS_MAX_PATH_LENGTH];
+    strcpy(document_dir, home_dir);
+    strcat(document_dir, "/Documents");
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_DOCS_DIR, document_dir);
+
+    lv_file_explorer_set_quick_access_path(file_explorer, LV_EXPLORER_FS_DIR, "A:/");
+#endif
+#endif
+
+    lv_obj_add_event_cb(file_explorer, file_explorer_event_handler, LV_EVENT_ALL, NULL);
+}
+
+#endif
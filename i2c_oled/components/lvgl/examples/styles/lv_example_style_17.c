@@ -0,0 +1,53 @@
+﻿#include "../lv_examples.h"
+#if LV_BUILD_EXAMPLES
+
+#if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
+
+/**
+ * Using radial gradient as background
+ */
+void lv_example_style_17(void)
+{
+    static const lv_color_t grad_colors[2] = {
+        LV_COLOR_MAKE(0x9B, 0x18, 0x42),
+        LV_COLOR_MAKE(0x00, 0x00, 0x00),
+    };
+
+    int32_t width = lv_display_get_horizontal_resolution(NULL);
+    int32_t height = lv_display_get_vertical_resolution(NULL);
+
+    static lv_style_t style;
+    lv_style_init(&style);
+
+    /*First define a color gradient. In this example we use a purple to black color map.*/
+    static lv_grad_dsc_t grad;
+
+    lv_gradient_init_stops(&grad, grad_colors, NULL, NULL, sizeof(grad_colors) / sizeof(lv_color_t));
+
+    /*Make a radial gradient with the center in the middle of the object, extending to the farthest corner*/
+    lv_grad_radial_init(&grad, LV_GRAD_CENTER, LV_GRAD_CENTER, LV_GRAD_RIGHT, LV_GRAD_BOTTOM, LV_GRAD_EXTEND_PAD);
+
+    /*Set gradient as background*/
+    lv_style_set_bg_grad(&style, &grad);
+
+    /*Create an object with the new style*/
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_add_style(obj, &style, 0);
+    lv_obj_set_size(obj, width, height);
+    lv_obj_center(obj);
+}
+
+#else
+
+void lv_example_style_17(void)
+{
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_obj_set_width(label, LV_PCT(80));
+    lv_label_set_text(label, "LV_USE_DRAW_SW_COMPLEX_GRADIENTS is not enabled");
+    lv_label_set_long_mode(label, LV_LABEL_LONG_SCROLL_CIRCULAR);
+    lv_obj_center(label);
+}
+
+#endif /*LV_USE_DRAW_SW_COMPLEX_GRADIENTS*/
+
+#endif /*LV_BUILD_EXAMPLES*/
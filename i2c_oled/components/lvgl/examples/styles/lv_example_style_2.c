@@ -0,0 +1,35 @@
+#include "../lv_examples.h"
+#if LV_BUILD_EXAMPLES
+
+/**
+ * Using the background style properties
+ */
+void lv_example_style_2(void)
+{
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_radius(&style, 5);
+
+    /*Make a gradient*/
+    lv_style_set_bg_opa(&style, LV_OPA_COVER);
+    static lv_grad_dsc_t grad;
+    grad.dir = LV_GRAD_DIR_VER;
+    grad.stops_count = 2;
+    grad.stops[0].color = lv_palette_lighten(LV_PALETTE_GREY, 1);
+    grad.stops[0].opa = LV_OPA_COVER;
+    grad.stops[1].color = lv_palette_main(LV_PALETTE_BLUE);
+    grad.stops[1].opa = LV_OPA_COVER;
+
+    /*Shift the gradient to the bottom*/
+    grad.stops[0].frac  = 128;
+    grad.stops[1].frac  = 192;
+
+    lv_style_set_bg_grad(&style, &grad);
+
+    /*Create an object with the new style*/
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_add_style(obj, &style, 0);
+    lv_obj_center(obj);
+}
+
+#endif
@@ -0,0 +1,28 @@
+#include "../lv_examples.h"
+#if LV_BUILD_EXAMPLES
+
+/**
+ * Using the outline style properties
+ */
+void lv_example_style_4(void)
+{
+    static lv_style_t style;
+    lv_style_init(&style);
+
+    /*Set a background color and a radius*/
+    lv_style_set_radius(&style, 5);
+    lv_style_set_bg_opa(&style, LV_OPA_COVER);
+    lv_style_set_bg_color(&style, lv_palette_lighten(LV_PALETTE_GREY, 1));
+
+    /*Add outline*/
+    lv_style_set_outline_width(&style, 2);
+    lv_style_set_outline_color(&style, lv_palette_main(LV_PALETTE_BLUE));
+    lv_style_set_outline_pad(&style, 8);
+
+    /*Create an object with the new style*/
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_add_style(obj, &style, 0);
+    lv_obj_center(obj);
+}
+
+#endif
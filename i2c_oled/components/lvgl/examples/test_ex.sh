@@ -0,0 +1,4 @@
+#!/bin/sh
+cat ../../header.py $1 > test.py
+chmod +x test.py
+./test.py
@@ -0,0 +1,31 @@
+#include "../../lv_examples.h"
+#if LV_USE_BAR && LV_BUILD_EXAMPLES
+
+/**
+ * Bar with LTR and RTL base direction
+ */
+void lv_example_bar_5(void)
+{
+    lv_obj_t * label;
+
+    lv_obj_t * bar_ltr = lv_bar_create(lv_screen_active());
+    lv_obj_set_size(bar_ltr, 200, 20);
+    lv_bar_set_value(bar_ltr, 70, LV_ANIM_OFF);
+    lv_obj_align(bar_ltr, LV_ALIGN_CENTER, 0, -30);
+
+    label = lv_label_create(lv_screen_active());
+    lv_label_set_text(label, "Left to Right base direction");
+    lv_obj_align_to(label, bar_ltr, LV_ALIGN_OUT_TOP_MID, 0, -5);
+
+    lv_obj_t * bar_rtl = lv_bar_create(lv_screen_active());
+    lv_obj_set_style_base_dir(bar_rtl, LV_BASE_DIR_RTL, 0);
+    lv_obj_set_size(bar_rtl, 200, 20);
+    lv_bar_set_value(bar_rtl, 70, LV_ANIM_OFF);
+    lv_obj_align(bar_rtl, LV_ALIGN_CENTER, 0, 30);
+
+    label = lv_label_create(lv_screen_active());
+    lv_label_set_text(label, "Right to Left base direction");
+    lv_obj_align_to(label, bar_rtl, LV_ALIGN_OUT_TOP_MID, 0, -5);
+}
+
+#endif
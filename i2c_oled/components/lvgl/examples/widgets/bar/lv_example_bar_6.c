@@ -0,0 +1,76 @@
+#include "../../lv_examples.h"
+#if LV_USE_BAR && LV_BUILD_EXAMPLES
+
+#define MAX_VALUE 100
+#define MIN_VALUE 0
+
+static void set_value(void * bar, int32_t v)
+{
+    lv_bar_set_value(bar, v, LV_ANIM_OFF);
+}
+
+static void event_cb(lv_event_t * e)
+{
+    lv_obj_t * obj = lv_event_get_target(e);
+
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+    label_dsc.font = LV_FONT_DEFAULT;
+
+    char buf[8];
+    lv_snprintf(buf, sizeof(buf), "%d", (int)lv_bar_get_value(obj));
+
+    lv_point_t txt_size;
+    lv_text_get_size(&txt_size, buf, label_dsc.font, label_dsc.letter_space, label_dsc.line_space, LV_COORD_MAX,
+                     label_dsc.flag);
+
+    lv_area_t txt_area;
+    txt_area.x1 = 0;
+    txt_area.x2 = txt_size.x - 1;
+    txt_area.y1 = 0;
+    txt_area.y2 = txt_size.y - 1;
+
+    lv_area_t indic_area;
+    lv_obj_get_coords(obj, &indic_area);
+    lv_area_set_width(&indic_area, lv_area_get_width(&indic_area) * lv_bar_get_value(obj) / MAX_VALUE);
+
+    /*If the indicator is long enough put the text inside on the right*/
+    if(lv_area_get_width(&indic_area) > txt_size.x + 20) {
+        lv_area_align(&indic_area, &txt_area, LV_ALIGN_RIGHT_MID, -10, 0);
+        label_dsc.color = lv_color_white();
+    }
+    /*If the indicator is still short put the text out of it on the right*/
+    else {
+        lv_area_align(&indic_area, &txt_area, LV_ALIGN_OUT_RIGHT_MID, 10, 0);
+        label_dsc.color = lv_color_black();
+    }
+    label_dsc.text = buf;
+    label_dsc.text_local = true;
+    lv_layer_t * layer = lv_event_get_layer(e);
+    lv_draw_label(layer, &label_dsc, &txt_area);
+}
+
+/**
+ * Custom drawer on the bar to display the current value
+ */
+void lv_example_bar_6(void)
+{
+    lv_obj_t * bar = lv_bar_create(lv_screen_active());
+    lv_bar_set_range(bar, MIN_VALUE, MAX_VALUE);
+    lv_obj_set_size(bar, 200, 20);
+    lv_obj_center(bar);
+    lv_obj_add_event_cb(bar, event_cb, LV_EVENT_DRAW_MAIN_END, NULL);
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, bar);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_exec_cb(&a, set_value);
+    lv_anim_set_duration(&a, 4000);
+    lv_anim_set_playback_duration(&a, 4000);
+    lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+    lv_anim_start(&a);
+
+}
+
+#endif
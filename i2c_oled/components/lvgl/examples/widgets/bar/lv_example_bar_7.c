@@ -0,0 +1,22 @@
+#include "../../lv_examples.h"
+#if LV_USE_BAR && LV_BUILD_EXAMPLES
+
+/**
+ * Bar with opposite direction
+ */
+void lv_example_bar_7(void)
+{
+    lv_obj_t * label;
+
+    lv_obj_t * bar_tob = lv_bar_create(lv_screen_active());
+    lv_obj_set_size(bar_tob, 20, 200);
+    lv_bar_set_range(bar_tob, 100, 0);
+    lv_bar_set_value(bar_tob, 70, LV_ANIM_OFF);
+    lv_obj_align(bar_tob, LV_ALIGN_CENTER, 0, -30);
+
+    label = lv_label_create(lv_screen_active());
+    lv_label_set_text(label, "From top to bottom");
+    lv_obj_align_to(label, bar_tob, LV_ALIGN_OUT_TOP_MID, 0, -5);
+}
+
+#endif
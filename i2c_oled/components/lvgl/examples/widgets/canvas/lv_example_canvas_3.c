@@ -0,0 +1,44 @@
+#include "../../lv_examples.h"
+#if LV_USE_CANVAS && LV_BUILD_EXAMPLES
+
+#define CANVAS_WIDTH  50
+#define CANVAS_HEIGHT  50
+
+/**
+ * Draw a rectangle to the canvas
+ */
+void lv_example_canvas_3(void)
+{
+    /*Create a buffer for the canvas*/
+    LV_DRAW_BUF_DEFINE_STATIC(draw_buf, CANVAS_WIDTH, CANVAS_HEIGHT, LV_COLOR_FORMAT_ARGB8888);
+    LV_DRAW_BUF_INIT_STATIC(draw_buf);
+
+    /*Create a canvas and initialize its palette*/
+    lv_obj_t * canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, &draw_buf);
+
+    lv_canvas_fill_bg(canvas, lv_color_hex3(0xccc), LV_OPA_COVER);
+    lv_obj_center(canvas);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_color = lv_palette_main(LV_PALETTE_RED);
+    dsc.border_color = lv_palette_main(LV_PALETTE_BLUE);
+    dsc.border_width = 3;
+    dsc.outline_color = lv_palette_main(LV_PALETTE_GREEN);
+    dsc.outline_width = 2;
+    dsc.outline_pad = 2;
+    dsc.outline_opa = LV_OPA_50;
+    dsc.radius = 5;
+    dsc.border_width = 3;
+
+    lv_area_t coords = {10, 10, 40, 30};
+
+    lv_draw_rect(&layer, &dsc, &coords);
+
+    lv_canvas_finish_layer(canvas, &layer);
+}
+#endif
@@ -0,0 +1,57 @@
+#include "../../lv_examples.h"
+#if LV_USE_CANVAS && LV_BUILD_EXAMPLES
+
+#if LV_USE_VECTOR_GRAPHIC
+
+#define CANVAS_WIDTH  150
+#define CANVAS_HEIGHT 150
+
+/**
+ * Draw a path to the canvas
+ */
+void lv_example_canvas_8(void)
+{
+    /*Create a buffer for the canvas*/
+    LV_DRAW_BUF_DEFINE_STATIC(draw_buf, CANVAS_WIDTH, CANVAS_HEIGHT, LV_COLOR_FORMAT_ARGB8888);
+    LV_DRAW_BUF_INIT_STATIC(draw_buf);
+
+    /*Create a canvas and initialize its palette*/
+    lv_obj_t * canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, &draw_buf);
+    lv_canvas_fill_bg(canvas, lv_color_hex3(0xccc), LV_OPA_COVER);
+    lv_obj_center(canvas);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_vector_dsc_t * dsc = lv_vector_dsc_create(&layer);
+    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+
+    lv_fpoint_t pts[] = {{10, 10}, {130, 130}, {10, 130}};
+    lv_vector_path_move_to(path, &pts[0]);
+    lv_vector_path_line_to(path, &pts[1]);
+    lv_vector_path_line_to(path, &pts[2]);
+    lv_vector_path_close(path);
+
+    lv_vector_dsc_set_fill_color(dsc, lv_color_make(0x00, 0x80, 0xff));
+    lv_vector_dsc_add_path(dsc, path);
+
+    lv_draw_vector(dsc);
+    lv_vector_path_delete(path);
+    lv_vector_dsc_delete(dsc);
+
+    lv_canvas_finish_layer(canvas, &layer);
+}
+#else
+
+void lv_example_canvas_8(void)
+{
+    /*fallback for online examples*/
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_label_set_text(label, "Vector graphics is not enabled");
+    lv_obj_center(label);
+}
+
+#endif /*LV_USE_VECTOR_GRAPHIC*/
+
+#endif
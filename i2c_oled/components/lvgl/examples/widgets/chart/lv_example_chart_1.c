@@ -0,0 +1,33 @@
+#include "../../lv_examples.h"
+#if LV_USE_CHART && LV_BUILD_EXAMPLES
+
+/**
+ * A very basic line chart
+ */
+void lv_example_chart_1(void)
+{
+    /*Create a chart*/
+    lv_obj_t * chart;
+    chart = lv_chart_create(lv_screen_active());
+    lv_obj_set_size(chart, 200, 150);
+    lv_obj_center(chart);
+    lv_chart_set_type(chart, LV_CHART_TYPE_LINE);   /*Show lines and points too*/
+
+    /*Add two data series*/
+    lv_chart_series_t * ser1 = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_GREEN), LV_CHART_AXIS_PRIMARY_Y);
+    lv_chart_series_t * ser2 = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_RED), LV_CHART_AXIS_SECONDARY_Y);
+    int32_t * ser2_y_points = lv_chart_get_y_array(chart, ser2);
+
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        /*Set the next points on 'ser1'*/
+        lv_chart_set_next_value(chart, ser1, lv_rand(10, 50));
+
+        /*Directly set points on 'ser2'*/
+        ser2_y_points[i] = lv_rand(50, 90);
+    }
+
+    lv_chart_refresh(chart); /*Required after direct set*/
+}
+
+#endif
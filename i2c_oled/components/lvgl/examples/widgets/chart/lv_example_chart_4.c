@@ -0,0 +1,48 @@
+#include "../../lv_examples.h"
+
+#if LV_USE_CHART && LV_DRAW_SW_COMPLEX && LV_BUILD_EXAMPLES
+
+static void draw_event_cb(lv_event_t * e)
+{
+    lv_draw_task_t * draw_task = lv_event_get_draw_task(e);
+    lv_draw_dsc_base_t * base_dsc = lv_draw_task_get_draw_dsc(draw_task);
+
+    if(base_dsc->part != LV_PART_ITEMS) {
+        return;
+    }
+
+    lv_draw_fill_dsc_t * fill_dsc = lv_draw_task_get_fill_dsc(draw_task);
+    if(fill_dsc) {
+        lv_obj_t * chart = lv_event_get_target(e);
+        int32_t * y_array = lv_chart_get_y_array(chart, lv_chart_get_series_next(chart, NULL));
+        int32_t v = y_array[base_dsc->id2];
+
+        uint32_t ratio = v * 255 / 100;
+        fill_dsc->color = lv_color_mix(lv_palette_main(LV_PALETTE_GREEN), lv_palette_main(LV_PALETTE_RED), ratio);
+    }
+}
+
+/**
+ * Recolor the bars of a chart based on their value
+ */
+void lv_example_chart_4(void)
+{
+    /*Create a chart1*/
+    lv_obj_t * chart = lv_chart_create(lv_screen_active());
+    lv_chart_set_type(chart, LV_CHART_TYPE_BAR);
+    lv_chart_set_point_count(chart, 24);
+    lv_obj_set_style_pad_column(chart, 2, 0);
+    lv_obj_set_size(chart, 260, 160);
+    lv_obj_center(chart);
+
+    lv_chart_series_t * ser = lv_chart_add_series(chart, lv_color_hex(0xff0000), LV_CHART_AXIS_PRIMARY_Y);
+    lv_obj_add_event_cb(chart, draw_event_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
+    lv_obj_add_flag(chart, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+
+    uint32_t i;
+    for(i = 0; i < 24; i++) {
+        lv_chart_set_next_value(chart, ser, lv_rand(10, 90));
+    }
+}
+
+#endif
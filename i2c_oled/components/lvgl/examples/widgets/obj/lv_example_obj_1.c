@@ -0,0 +1,22 @@
+#include "../../lv_examples.h"
+#if LV_BUILD_EXAMPLES
+
+void lv_example_obj_1(void)
+{
+    lv_obj_t * obj1;
+    obj1 = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj1, 100, 50);
+    lv_obj_align(obj1, LV_ALIGN_CENTER, -60, -30);
+
+    static lv_style_t style_shadow;
+    lv_style_init(&style_shadow);
+    lv_style_set_shadow_width(&style_shadow, 10);
+    lv_style_set_shadow_spread(&style_shadow, 5);
+    lv_style_set_shadow_color(&style_shadow, lv_palette_main(LV_PALETTE_BLUE));
+
+    lv_obj_t * obj2;
+    obj2 = lv_obj_create(lv_screen_active());
+    lv_obj_add_style(obj2, &style_shadow, 0);
+    lv_obj_align(obj2, LV_ALIGN_CENTER, 60, 30);
+}
+#endif
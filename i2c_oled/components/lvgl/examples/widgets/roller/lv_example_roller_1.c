@@ -0,0 +1,41 @@
+#include "../../lv_examples.h"
+#if LV_USE_ROLLER && LV_BUILD_EXAMPLES
+
+static void event_handler(lv_event_t * e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_target(e);
+    if(code == LV_EVENT_VALUE_CHANGED) {
+        char buf[32];
+        lv_roller_get_selected_str(obj, buf, sizeof(buf));
+        LV_LOG_USER("Selected month: %s\n", buf);
+    }
+}
+
+/**
+ * An infinite roller with the name of the months
+ */
+void lv_example_roller_1(void)
+{
+    lv_obj_t * roller1 = lv_roller_create(lv_screen_active());
+    lv_roller_set_options(roller1,
+                          "January\n"
+                          "February\n"
+                          "March\n"
+                          "April\n"
+                          "May\n"
+                          "June\n"
+                          "July\n"
+                          "August\n"
+                          "September\n"
+                          "October\n"
+                          "November\n"
+                          "December",
+                          LV_ROLLER_MODE_INFINITE);
+
+    lv_roller_set_visible_row_count(roller1, 4);
+    lv_obj_center(roller1);
+    lv_obj_add_event_cb(roller1, event_handler, LV_EVENT_ALL, NULL);
+}
+
+#endif
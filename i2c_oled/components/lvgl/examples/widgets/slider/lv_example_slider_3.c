@@ -0,0 +1,69 @@
+#include "../../lv_examples.h"
+#if LV_USE_SLIDER && LV_BUILD_EXAMPLES
+
+#define MAX_VALUE 100
+#define MIN_VALUE 0
+
+static void slider_event_cb(lv_event_t * e);
+
+/**
+ * Show the current value when the slider is pressed by extending the drawer
+ *
+ */
+void lv_example_slider_3(void)
+{
+    /*Create a slider in the center of the display*/
+    lv_obj_t * slider;
+    slider = lv_slider_create(lv_screen_active());
+    lv_obj_center(slider);
+
+    lv_slider_set_mode(slider, LV_SLIDER_MODE_RANGE);
+    lv_slider_set_range(slider, MIN_VALUE, MAX_VALUE);
+    lv_slider_set_value(slider, 70, LV_ANIM_OFF);
+    lv_slider_set_left_value(slider, 20, LV_ANIM_OFF);
+
+    lv_obj_add_event_cb(slider, slider_event_cb, LV_EVENT_ALL, NULL);
+    lv_obj_refresh_ext_draw_size(slider);
+}
+
+static void slider_event_cb(lv_event_t * e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_target(e);
+
+    /*Provide some extra space for the value*/
+    if(code == LV_EVENT_REFR_EXT_DRAW_SIZE) {
+        lv_event_set_ext_draw_size(e, 50);
+    }
+    else if(code == LV_EVENT_DRAW_MAIN_END) {
+        if(!lv_obj_has_state(obj, LV_STATE_PRESSED)) return;
+
+        lv_area_t slider_area;
+        lv_obj_get_coords(obj, &slider_area);
+        lv_area_t indic_area = slider_area;
+        lv_area_set_width(&indic_area, lv_area_get_width(&slider_area) * lv_slider_get_value(obj) / MAX_VALUE);
+        indic_area.x1 += lv_area_get_width(&slider_area) * lv_slider_get_left_value(obj) / MAX_VALUE;
+        char buf[16];
+        lv_snprintf(buf, sizeof(buf), "%d - %d", (int)lv_slider_get_left_value(obj), (int)lv_slider_get_value(obj));
+
+        lv_point_t label_size;
+        lv_text_get_size(&label_size, buf, LV_FONT_DEFAULT, 0, 0, LV_COORD_MAX, 0);
+        lv_area_t label_area;
+        label_area.x1 = 0;
+        label_area.x2 = label_size.x - 1;
+        label_area.y1 = 0;
+        label_area.y2 = label_size.y - 1;
+
+        lv_area_align(&indic_area, &label_area, LV_ALIGN_OUT_TOP_MID, 0, -10);
+
+        lv_draw_label_dsc_t label_draw_dsc;
+        lv_draw_label_dsc_init(&label_draw_dsc);
+        label_draw_dsc.color = lv_color_hex3(0x888);
+        label_draw_dsc.text = buf;
+        label_draw_dsc.text_local = true;
+        lv_layer_t * layer = lv_event_get_layer(e);
+        lv_draw_label(layer, &label_draw_dsc, &label_area);
+    }
+}
+
+#endif
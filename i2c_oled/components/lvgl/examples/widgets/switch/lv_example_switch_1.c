@@ -0,0 +1,38 @@
+#include "../../lv_examples.h"
+#if LV_USE_SWITCH && LV_BUILD_EXAMPLES
+
+static void event_handler(lv_event_t * e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_target(e);
+    if(code == LV_EVENT_VALUE_CHANGED) {
+        LV_UNUSED(obj);
+        LV_LOG_USER("State: %s\n", lv_obj_has_state(obj, LV_STATE_CHECKED) ? "On" : "Off");
+    }
+}
+
+void lv_example_switch_1(void)
+{
+    lv_obj_set_flex_flow(lv_screen_active(), LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_flex_align(lv_screen_active(), LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+
+    lv_obj_t * sw;
+
+    sw = lv_switch_create(lv_screen_active());
+    lv_obj_add_event_cb(sw, event_handler, LV_EVENT_ALL, NULL);
+    lv_obj_add_flag(sw, LV_OBJ_FLAG_EVENT_BUBBLE);
+
+    sw = lv_switch_create(lv_screen_active());
+    lv_obj_add_state(sw, LV_STATE_CHECKED);
+    lv_obj_add_event_cb(sw, event_handler, LV_EVENT_ALL, NULL);
+
+    sw = lv_switch_create(lv_screen_active());
+    lv_obj_add_state(sw, LV_STATE_DISABLED);
+    lv_obj_add_event_cb(sw, event_handler, LV_EVENT_ALL, NULL);
+
+    sw = lv_switch_create(lv_screen_active());
+    lv_obj_add_state(sw, LV_STATE_CHECKED | LV_STATE_DISABLED);
+    lv_obj_add_event_cb(sw, event_handler, LV_EVENT_ALL, NULL);
+}
+
+#endif
@@ -0,0 +1,110 @@
+#include "../../lv_examples.h"
+#if LV_USE_TABLE && LV_BUILD_EXAMPLES
+
+#define ITEM_CNT 200
+
+static void draw_event_cb(lv_event_t * e)
+{
+    lv_obj_t * obj = lv_event_get_target(e);
+
+    lv_draw_task_t * draw_task = lv_event_get_draw_task(e);
+    lv_draw_dsc_base_t * base_dsc = lv_draw_task_get_draw_dsc(draw_task);
+    /*If the cells are drawn...*/
+    if(base_dsc->part == LV_PART_ITEMS && lv_draw_task_get_type(draw_task) == LV_DRAW_TASK_TYPE_FILL) {
+        /*Draw the background*/
+        bool chk = lv_table_has_cell_ctrl(obj, base_dsc->id1, 0, LV_TABLE_CELL_CTRL_CUSTOM_1);
+        lv_draw_rect_dsc_t rect_dsc;
+        lv_draw_rect_dsc_init(&rect_dsc);
+        rect_dsc.bg_color = chk ? lv_theme_get_color_primary(obj) : lv_palette_lighten(LV_PALETTE_GREY, 2);
+        rect_dsc.radius = LV_RADIUS_CIRCLE;
+
+        lv_area_t sw_area;
+        sw_area.x1 = 0;
+        sw_area.x2 = 40;
+        sw_area.y1 = 0;
+        sw_area.y2 = 24;
+        lv_area_t draw_task_area;
+        lv_draw_task_get_area(draw_task, &draw_task_area);
+        lv_area_align(&draw_task_area, &sw_area, LV_ALIGN_RIGHT_MID, -15, 0);
+        lv_draw_rect(base_dsc->layer, &rect_dsc, &sw_area);
+
+        /*Draw the knob*/
+        rect_dsc.bg_color = lv_color_white();
+        lv_area_t knob_area;
+        knob_area.x1 = 0;
+        knob_area.x2 = 18;
+        knob_area.y1 = 0;
+        knob_area.y2 = 18;
+        if(chk) {
+            lv_area_align(&sw_area, &knob_area, LV_ALIGN_RIGHT_MID, -3, 0);
+        }
+        else {
+            lv_area_align(&sw_area, &knob_area, LV_ALIGN_LEFT_MID, 3, 0);
+        }
+        lv_draw_rect(base_dsc->layer, &rect_dsc, &knob_area);
+    }
+}
+
+static void change_event_cb(lv_event_t * e)
+{
+    lv_obj_t * obj = lv_event_get_target(e);
+    uint32_t col;
+    uint32_t row;
+    lv_table_get_selected_cell(obj, &row, &col);
+    bool chk = lv_table_has_cell_ctrl(obj, row, 0, LV_TABLE_CELL_CTRL_CUSTOM_1);
+    if(chk) lv_table_clear_cell_ctrl(obj, row, 0, LV_TABLE_CELL_CTRL_CUSTOM_1);
+    else lv_table_add_cell_ctrl(obj, row, 0, LV_TABLE_CELL_CTRL_CUSTOM_1);
+}
+
+/**
+ * A very light-weighted list created from table
+ */
+void lv_example_table_2(void)
+{
+    /*Measure memory usage*/
+    lv_mem_monitor_t mon1;
+    lv_mem_monitor(&mon1);
+
+    uint32_t t = lv_tick_get();
+
+    lv_obj_t * table = lv_table_create(lv_screen_active());
+
+    /*Set a smaller height to the table. It'll make it scrollable*/
+    lv_obj_set_size(table, LV_SIZE_CONTENT, 200);
+
+    lv_table_set_column_width(table, 0, 150);
+    lv_table_set_row_count(table, ITEM_CNT); /*Not required but avoids a lot of memory reallocation lv_table_set_set_value*/
+    lv_table_set_column_count(table, 1);
+
+    /*Don't make the cell pressed, we will draw something different in the event*/
+    lv_obj_remove_style(table, NULL, LV_PART_ITEMS | LV_STATE_PRESSED);
+
+    uint32_t i;
+    for(i = 0; i < ITEM_CNT; i++) {
+        lv_table_set_cell_value_fmt(table, i, 0, "Item %"LV_PRIu32, i + 1);
+    }
+
+    lv_obj_align(table, LV_ALIGN_CENTER, 0, -20);
+
+    /*Add an event callback to to apply some custom drawing*/
+    lv_obj_add_event_cb(table, draw_event_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
+    lv_obj_add_event_cb(table, change_event_cb, LV_EVENT_VALUE_CHANGED, NULL);
+    lv_obj_add_flag(table, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+
+    lv_mem_monitor_t mon2;
+    lv_mem_monitor(&mon2);
+
+    size_t mem_used = mon1.free_size - mon2.free_size;
+
+    uint32_t elaps = lv_tick_elaps(t);
+
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_label_set_text_fmt(label, "%"LV_PRIu32" items were created in %"LV_PRIu32" ms\n"
+                          "using %zu bytes of memory",
+                          (uint32_t)ITEM_CNT, elaps, mem_used);
+
+    lv_obj_align(label, LV_ALIGN_BOTTOM_MID, 0, -10);
+
+}
+
+#endif
@@ -0,0 +1,42 @@
+#include "../../lv_examples.h"
+#if LV_USE_TABVIEW && LV_BUILD_EXAMPLES
+
+void lv_example_tabview_1(void)
+{
+    /*Create a Tab view object*/
+    lv_obj_t * tabview;
+    tabview = lv_tabview_create(lv_screen_active());
+
+    /*Add 3 tabs (the tabs are page (lv_page) and can be scrolled*/
+    lv_obj_t * tab1 = lv_tabview_add_tab(tabview, "Tab 1");
+    lv_obj_t * tab2 = lv_tabview_add_tab(tabview, "Tab 2");
+    lv_obj_t * tab3 = lv_tabview_add_tab(tabview, "Tab 3");
+
+    /*Add content to the tabs*/
+    lv_obj_t * label = lv_label_create(tab1);
+    lv_label_set_text(label, "This the first tab\n\n"
+                      "If the content\n"
+                      "of a tab\n"
+                      "becomes too\n"
+                      "longer\n"
+                      "than the\n"
+                      "container\n"
+                      "then it\n"
+                      "automatically\n"
+                      "becomes\n"
+                      "scrollable.\n"
+                      "\n"
+                      "\n"
+                      "\n"
+                      "Can you see it?");
+
+    label = lv_label_create(tab2);
+    lv_label_set_text(label, "Second tab");
+
+    label = lv_label_create(tab3);
+    lv_label_set_text(label, "Third tab");
+
+    lv_obj_scroll_to_view_recursive(label, LV_ANIM_ON);
+
+}
+#endif
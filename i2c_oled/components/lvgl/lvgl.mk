@@ -0,0 +1,12 @@
+LVGL_PATH ?= ${shell pwd}/lvgl
+
+ASRCS += $(shell find $(LVGL_PATH)/src -type f -name '*.S')
+CSRCS += $(shell find $(LVGL_PATH)/src -type f -name '*.c')
+CSRCS += $(shell find $(LVGL_PATH)/demos -type f -name '*.c')
+CSRCS += $(shell find $(LVGL_PATH)/examples -type f -name '*.c')
+CXXEXT := .cpp
+CXXSRCS += $(shell find $(LVGL_PATH)/src -type f -name '*${CXXEXT}')
+
+AFLAGS += "-I$(LVGL_PATH)"
+CFLAGS += "-I$(LVGL_PATH)"
+CXXFLAGS += "-I$(LVGL_PATH)"
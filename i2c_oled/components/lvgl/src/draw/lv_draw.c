@@ -0,0 +1,906 @@
+/**
+ * @file lv_draw.c
+ *
+ */
+
+/**
+ * Modified by NXP in 2024
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../misc/lv_area_private.h"
+#include "lv_draw_private.h"
+#include "sw/lv_draw_sw.h"
+#include "../display/lv_display_private.h"
+#include "../core/lv_global.h"
+#include "../core/lv_refr_private.h"
+#include "../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define _draw_info LV_GLOBAL_DEFAULT()->draw_info
+
+/*With fewer draw tasks in a layer simply checking all of them is faster than maintaining the grid*/
+#define TASK_GRID_MIN_TASK_CNT  32
+
+/*Leave this many draw tasks queued in a layer before dispatching them,
+ *so that the opaque tasks added after them can still cull them*/
+#define CULL_WINDOW             8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check);
+static bool is_known_blocked(lv_layer_t * layer, const lv_draw_task_t * t);
+static void task_grid_create(lv_layer_t * layer);
+static void task_grid_delete(lv_layer_t * layer);
+static bool task_grid_add(lv_layer_t * layer, lv_draw_task_t * t);
+static void task_grid_remove(lv_layer_t * layer, lv_draw_task_t * t);
+static void task_grid_touch(lv_layer_t * layer, lv_draw_task_t * t);
+static void cull_covered_tasks(lv_layer_t * layer, lv_draw_task_t * t_cover);
+static void clip_covered_side(lv_draw_task_t * t, lv_area_t * draw_area, const lv_area_t * cover_area);
+static uint32_t get_draw_px_cnt(const lv_draw_task_t * t);
+
+static inline uint32_t get_layer_size_kb(uint32_t size_byte)
+{
+    return size_byte < 1024 ? 1 : size_byte >> 10;
+}
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_init(void)
+{
+#if LV_USE_OS
+    lv_thread_sync_init(&_draw_info.sync);
+#endif
+}
+
+void lv_draw_deinit(void)
+{
+#if LV_USE_OS
+    lv_thread_sync_delete(&_draw_info.sync);
+#endif
+
+    lv_draw_unit_t * u = _draw_info.unit_head;
+    while(u) {
+        lv_draw_unit_t * cur_unit = u;
+        u = u->next;
+
+        if(cur_unit->delete_cb) cur_unit->delete_cb(cur_unit);
+        lv_free(cur_unit);
+    }
+    _draw_info.unit_head = NULL;
+}
+
+void * lv_draw_create_unit(size_t size)
+{
+    lv_draw_unit_t * new_unit = lv_malloc_zeroed(size);
+
+    new_unit->next = _draw_info.unit_head;
+    _draw_info.unit_head = new_unit;
+    _draw_info.unit_cnt++;
+
+    return new_unit;
+}
+
+lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords)
+{
+    LV_PROFILER_BEGIN;
+    lv_draw_task_t * new_task = lv_malloc_zeroed(sizeof(lv_draw_task_t));
+
+    new_task->area = *coords;
+    new_task->_real_area = *coords;
+    new_task->clip_area = layer->_clip_area;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    new_task->matrix = layer->matrix;
+#endif
+    new_task->state = LV_DRAW_TASK_STATE_QUEUED;
+    new_task->seq = layer->draw_task_seq++;
+
+    if(layer->draw_task_head == NULL) {
+        layer->draw_task_head = new_task;
+    }
+    else {
+        layer->draw_task_tail->next = new_task;
+    }
+    layer->draw_task_tail = new_task;
+    layer->draw_task_cnt++;
+
+    LV_PROFILER_END;
+    return new_task;
+}
+
+void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
+{
+    LV_PROFILER_BEGIN;
+    lv_draw_dsc_base_t * base_dsc = t->draw_dsc;
+    base_dsc->layer = layer;
+
+    /*Index the task now as `_real_area` might have been adjusted after `lv_draw_add_task()`.
+     *It has to happen before LV_EVENT_DRAW_TASK_ADDED to keep the cells ordered
+     *if new draw tasks are added in the event.*/
+    if(layer->task_grid) {
+        if(!task_grid_add(layer, t)) task_grid_delete(layer);
+    }
+    else if(layer->draw_task_cnt == TASK_GRID_MIN_TASK_CNT) {
+        task_grid_create(layer);
+    }
+
+    lv_draw_global_info_t * info = &_draw_info;
+
+    /*Send LV_EVENT_DRAW_TASK_ADDED and dispatch only on the "main" draw_task
+     *and not on the draw tasks added in the event.
+     *Sending LV_EVENT_DRAW_TASK_ADDED events might cause recursive event sends and besides
+     *dispatching might remove the "main" draw task while it's still being used in the event*/
+
+    if(info->task_running == false) {
+        if(base_dsc->obj && lv_obj_has_flag(base_dsc->obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS)) {
+            info->task_running = true;
+            lv_obj_send_event(base_dsc->obj, LV_EVENT_DRAW_TASK_ADDED, t);
+            info->task_running = false;
+        }
+
+        /*Let the draw units set their preference score*/
+        t->preference_score = 100;
+        t->preferred_draw_unit_id = 0;
+        lv_draw_unit_t * u = info->unit_head;
+        while(u) {
+            if(u->evaluate_cb) u->evaluate_cb(u, t);
+            u = u->next;
+        }
+
+        info->task_px_cnt += get_draw_px_cnt(t);
+        cull_covered_tasks(layer, t);
+
+        /*Still request dispatching to not block `lv_draw_dispatch_wait_for_request()`
+         *if the last tasks are left in the window*/
+        if(layer->draw_task_cnt > CULL_WINDOW) lv_draw_dispatch();
+        else lv_draw_dispatch_request();
+    }
+    else {
+        /*Let the draw units set their preference score*/
+        t->preference_score = 100;
+        t->preferred_draw_unit_id = 0;
+        lv_draw_unit_t * u = info->unit_head;
+        while(u) {
+            if(u->evaluate_cb) u->evaluate_cb(u, t);
+            u = u->next;
+        }
+
+        info->task_px_cnt += get_draw_px_cnt(t);
+        cull_covered_tasks(layer, t);
+    }
+    LV_PROFILER_END;
+}
+
+void lv_draw_wait_for_finish(void)
+{
+#if LV_USE_OS
+    lv_draw_unit_t * u = _draw_info.unit_head;
+    while(u) {
+        if(u->wait_for_finish_cb)
+            u->wait_for_finish_cb(u);
+        u = u->next;
+    }
+#endif
+}
+
+void lv_draw_dispatch(void)
+{
+    LV_PROFILER_BEGIN;
+    bool task_dispatched = false;
+    lv_display_t * disp = lv_display_get_next(NULL);
+    while(disp) {
+        lv_layer_t * layer = disp->layer_head;
+        while(layer) {
+            /* If there are no tasks in the layer, skip it */
+            if(layer->draw_task_head && lv_draw_dispatch_layer(disp, layer))
+                task_dispatched = true;
+            layer = layer->next;
+        }
+        if(!task_dispatched) {
+            lv_draw_wait_for_finish();
+            lv_draw_dispatch_request();
+        }
+        disp = lv_display_get_next(disp);
+    }
+    LV_PROFILER_END;
+}
+
+bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
+{
+    LV_PROFILER_BEGIN;
+    /*Remove the finished tasks first.
+     *Only the tasks handed out to the draw units can be ready, so don't look further than the last of them.*/
+    lv_draw_task_t * t_prev = NULL;
+    lv_draw_task_t * t = layer->draw_task_dispatched ? layer->draw_task_head : NULL;
+    while(t) {
+        lv_draw_task_t * t_next = t->next;
+        bool last = t == layer->draw_task_dispatched;
+        if(t->state == LV_DRAW_TASK_STATE_READY) {
+            if(t_prev) t_prev->next = t->next;      /*Remove it by assigning the next task to the previous*/
+            else layer->draw_task_head = t_next;    /*If it was the head, set the next as head*/
+
+            if(layer->draw_task_tail == t) layer->draw_task_tail = t_prev;
+            if(last) layer->draw_task_dispatched = t_prev;
+            layer->draw_task_cnt--;
+            task_grid_remove(layer, t);
+
+            /*If it was layer drawing free the layer too*/
+            if(t->type == LV_DRAW_TASK_TYPE_LAYER) {
+                lv_draw_image_dsc_t * draw_image_dsc = t->draw_dsc;
+                lv_layer_t * layer_drawn = (lv_layer_t *)draw_image_dsc->src;
+
+                if(layer_drawn->draw_buf) {
+                    int32_t h = lv_area_get_height(&layer_drawn->buf_area);
+                    uint32_t layer_size_byte = h * layer_drawn->draw_buf->header.stride;
+
+                    _draw_info.used_memory_for_layers_kb -= get_layer_size_kb(layer_size_byte);
+                    LV_LOG_INFO("Layer memory used: %" LV_PRIu32 " kB\n", _draw_info.used_memory_for_layers_kb);
+                    lv_draw_buf_destroy(layer_drawn->draw_buf);
+                    layer_drawn->draw_buf = NULL;
+                }
+
+                /*Remove the layer from  the display's*/
+                if(disp) {
+                    lv_layer_t * l2 = disp->layer_head;
+                    while(l2) {
+                        if(l2->next == layer_drawn) {
+                            l2->next = layer_drawn->next;
+                            break;
+                        }
+                        l2 = l2->next;
+                    }
+
+                    if(disp->layer_deinit) disp->layer_deinit(disp, layer_drawn);
+                    lv_free(layer_drawn);
+                }
+            }
+            lv_draw_label_dsc_t * draw_label_dsc = lv_draw_task_get_label_dsc(t);
+            if(draw_label_dsc && draw_label_dsc->text_local) {
+                lv_free((void *)draw_label_dsc->text);
+                draw_label_dsc->text = NULL;
+            }
+
+            lv_free(t->draw_dsc);
+            lv_free(t);
+        }
+        else {
+            t_prev = t;
+        }
+        t = last ? NULL : t_next;
+    }
+
+    if(layer->draw_task_head == NULL) {
+        task_grid_delete(layer);
+        layer->draw_task_seq = 0;
+    }
+
+    bool task_dispatched = false;
+
+    /*This layer is ready, enable blending its buffer*/
+    if(layer->parent && layer->all_tasks_added && layer->draw_task_head == NULL) {
+        /*Find a draw task with TYPE_LAYER in the layer where the src is this layer*/
+        lv_draw_task_t * t_src = layer->parent->draw_task_head;
+        while(t_src) {
+            if(t_src->type == LV_DRAW_TASK_TYPE_LAYER && t_src->state == LV_DRAW_TASK_STATE_WAITING) {
+                lv_draw_image_dsc_t * draw_dsc = t_src->draw_dsc;
+                if(draw_dsc->src == layer) {
+                    t_src->state = LV_DRAW_TASK_STATE_QUEUED;
+                    lv_draw_dispatch_request();
+                    break;
+                }
+            }
+            t_src = t_src->next;
+        }
+    }
+    /*Assign draw tasks to the draw_units*/
+    else {
+        /*Find a draw unit which is not busy and can take at least one task*/
+        /*Let all draw units to pick draw tasks*/
+        lv_draw_unit_t * u = _draw_info.unit_head;
+        while(u) {
+            int32_t taken_cnt = u->dispatch_cb(u, layer);
+            if(taken_cnt != LV_DRAW_UNIT_IDLE) task_dispatched = true;
+            u = u->next;
+        }
+    }
+
+    LV_PROFILER_END;
+    return task_dispatched;
+}
+
+void lv_draw_dispatch_wait_for_request(void)
+{
+#if LV_USE_OS
+    lv_thread_sync_wait(&_draw_info.sync);
+#else
+    while(!_draw_info.dispatch_req);
+    _draw_info.dispatch_req = 0;
+#endif
+}
+
+void lv_draw_dispatch_request(void)
+{
+#if LV_USE_OS
+    lv_thread_sync_signal(&_draw_info.sync);
+#else
+    _draw_info.dispatch_req = 1;
+#endif
+}
+
+uint32_t lv_draw_get_unit_count(void)
+{
+    return _draw_info.unit_cnt;
+}
+
+lv_draw_task_t * lv_draw_get_next_available_task(lv_layer_t * layer, lv_draw_task_t * t_prev, uint8_t draw_unit_id)
+{
+    LV_PROFILER_BEGIN;
+    /*If the first task is screen sized, there cannot be independent areas.
+     *A culled task is ready without being dispatched, so it doesn't block the others.*/
+    if(layer->draw_task_head) {
+        int32_t hor_res = lv_display_get_horizontal_resolution(lv_refr_get_disp_refreshing());
+        int32_t ver_res = lv_display_get_vertical_resolution(lv_refr_get_disp_refreshing());
+        lv_draw_task_t * t = layer->draw_task_head;
+        if(t->state != LV_DRAW_TASK_STATE_QUEUED && t->state != LV_DRAW_TASK_STATE_READY &&
+           t->area.x1 <= 0 && t->area.x2 >= hor_res - 1 &&
+           t->area.y1 <= 0 && t->area.y2 >= ver_res - 1) {
+            LV_PROFILER_END;
+            return NULL;
+        }
+    }
+
+    lv_draw_task_t * t = t_prev ? t_prev->next : layer->draw_task_head;
+    while(t) {
+        /*Find a queued and independent task*/
+        if(t->state == LV_DRAW_TASK_STATE_QUEUED &&
+           (t->preferred_draw_unit_id == LV_DRAW_UNIT_NONE || t->preferred_draw_unit_id == draw_unit_id) &&
+           !is_known_blocked(layer, t) && is_independent(layer, t)) {
+            if(layer->draw_task_dispatched == NULL || layer->draw_task_dispatched->seq < t->seq) {
+                layer->draw_task_dispatched = t;
+            }
+            LV_PROFILER_END;
+            return t;
+        }
+        t = t->next;
+    }
+
+    LV_PROFILER_END;
+    return NULL;
+}
+
+uint32_t lv_draw_get_dependent_count(lv_draw_task_t * t_check)
+{
+    if(t_check == NULL) return 0;
+    if(t_check->next == NULL) return 0;
+
+    LV_PROFILER_BEGIN;
+    uint32_t cnt = 0;
+
+    lv_draw_task_t * t = t_check->next;
+    while(t) {
+        if((t->state == LV_DRAW_TASK_STATE_QUEUED || t->state == LV_DRAW_TASK_STATE_WAITING) &&
+           lv_area_is_on(&t_check->area, &t->area)) {
+            cnt++;
+        }
+
+        t = t->next;
+    }
+    LV_PROFILER_END;
+    return cnt;
+}
+
+lv_layer_t * lv_draw_layer_create(lv_layer_t * parent_layer, lv_color_format_t color_format, const lv_area_t * area)
+{
+    lv_display_t * disp = lv_refr_get_disp_refreshing();
+    lv_layer_t * new_layer = lv_malloc_zeroed(sizeof(lv_layer_t));
+    LV_ASSERT_MALLOC(new_layer);
+    if(new_layer == NULL) return NULL;
+
+    new_layer->parent = parent_layer;
+    new_layer->_clip_area = *area;
+    new_layer->buf_area = *area;
+    new_layer->phy_clip_area = *area;
+    new_layer->color_format = color_format;
+
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    lv_matrix_identity(&new_layer->matrix);
+#endif
+
+    if(disp->layer_head) {
+        lv_layer_t * tail = disp->layer_head;
+        while(tail->next) tail = tail->next;
+        tail->next = new_layer;
+    }
+    else {
+        disp->layer_head = new_layer;
+    }
+
+    return new_layer;
+}
+
+void * lv_draw_layer_alloc_buf(lv_layer_t * layer)
+{
+    /*If the buffer of the layer is already allocated return it*/
+    if(layer->draw_buf != NULL) {
+        return layer->draw_buf->data;
+    }
+
+    /*If the buffer of the layer is not allocated yet, allocate it now*/
+    int32_t w = lv_area_get_width(&layer->buf_area);
+    int32_t h = lv_area_get_height(&layer->buf_area);
+    uint32_t layer_size_byte = h * lv_draw_buf_width_to_stride(w, layer->color_format);
+
+    layer->draw_buf = lv_draw_buf_create(w, h, layer->color_format, 0);
+
+    if(layer->draw_buf == NULL) {
+        LV_LOG_WARN("Allocating layer buffer failed. Try later");
+        return NULL;
+    }
+
+    _draw_info.used_memory_for_layers_kb += get_layer_size_kb(layer_size_byte);
+    LV_LOG_INFO("Layer memory used: %" LV_PRIu32 " kB\n", _draw_info.used_memory_for_layers_kb);
+
+    if(lv_color_format_has_alpha(layer->color_format)) {
+        lv_draw_buf_clear(layer->draw_buf, NULL);
+    }
+
+    return layer->draw_buf->data;
+}
+
+void * lv_draw_layer_go_to_xy(lv_layer_t * layer, int32_t x, int32_t y)
+{
+    return lv_draw_buf_goto_xy(layer->draw_buf, x, y);
+}
+
+lv_draw_task_type_t lv_draw_task_get_type(const lv_draw_task_t * t)
+{
+    return t->type;
+}
+
+void * lv_draw_task_get_draw_dsc(const lv_draw_task_t * t)
+{
+    return t->draw_dsc;
+}
+
+void lv_draw_task_get_area(const lv_draw_task_t * t, lv_area_t * area)
+{
+    *area = t->area;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Check if there are older draw task overlapping the area of `t_check`
+ * @param layer      the draw ctx to search in
+ * @param t_check       check this task if it overlaps with the older ones
+ * @return              true: `t_check` is not overlapping with older tasks so it's independent
+ */
+static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check)
+{
+    LV_PROFILER_BEGIN;
+    lv_draw_task_grid_t * grid = layer->task_grid;
+    lv_area_t a;
+
+    /*Check only the older tasks in the grid cells of t_check*/
+    if(grid && t_check->in_grid) {
+        int32_t x;
+        int32_t y;
+        for(y = t_check->grid_y1; y <= t_check->grid_y2; y++) {
+            for(x = t_check->grid_x1; x <= t_check->grid_x2; x++) {
+                uint32_t cell_idx = y * LV_DRAW_TASK_GRID_SIZE + x;
+                lv_draw_task_grid_cell_t * cell = &grid->cells[cell_idx];
+                uint32_t i;
+                for(i = cell->first; i < cell->cnt; i++) {
+                    lv_draw_task_t * t = cell->tasks[i];
+                    if(t == NULL) continue;
+                    if(t->seq >= t_check->seq) break;
+
+                    if(t->state != LV_DRAW_TASK_STATE_READY && lv_area_intersect(&a, &t->_real_area, &t_check->_real_area)) {
+                        t_check->blocked_cell = cell_idx;
+                        t_check->blocked_gen = cell->gen;
+                        LV_PROFILER_END;
+                        return false;
+                    }
+                }
+            }
+        }
+        LV_PROFILER_END;
+        return true;
+    }
+
+    lv_draw_task_t * t = layer->draw_task_head;
+
+    /*If t_check is outside of the older tasks then it's independent*/
+    while(t && t != t_check) {
+        if(t->state != LV_DRAW_TASK_STATE_READY) {
+            if(lv_area_intersect(&a, &t->_real_area, &t_check->_real_area)) {
+                LV_PROFILER_END;
+                return false;
+            }
+        }
+        t = t->next;
+    }
+    LV_PROFILER_END;
+
+    return true;
+}
+
+/**
+ * Check if an older task which overlaps `t` was found earlier and is still in the layer
+ * @param layer     the layer of the task
+ * @param t         the task to check
+ * @return          true: `t` is blocked for sure; false: it has to be checked with `is_independent()`
+ */
+static bool is_known_blocked(lv_layer_t * layer, const lv_draw_task_t * t)
+{
+    if(layer->task_grid == NULL || t->blocked_gen == 0) return false;
+
+    return layer->task_grid->cells[t->blocked_cell].gen == t->blocked_gen;
+}
+
+static int32_t get_grid_coord(int32_t v, int32_t start, int32_t cell_size)
+{
+    int32_t i = (v - start) / cell_size;
+    if(i < 0) return 0;
+    if(i >= LV_DRAW_TASK_GRID_SIZE) return LV_DRAW_TASK_GRID_SIZE - 1;
+    return i;
+}
+
+/**
+ * Create a grid for the area of a layer and add its draw tasks
+ * @param layer     pointer to a layer
+ */
+static void task_grid_create(lv_layer_t * layer)
+{
+    lv_draw_task_grid_t * grid = lv_malloc_zeroed(sizeof(lv_draw_task_grid_t));
+    if(grid == NULL) {
+        LV_LOG_WARN("Couldn't allocate the draw task grid");
+        return;
+    }
+
+    /*Tasks are clipped to the physical clip area which can be only a stripe of the buffer (e.g. a tile)*/
+    if(!lv_area_intersect(&grid->area, &layer->buf_area, &layer->phy_clip_area)) grid->area = layer->buf_area;
+    grid->cell_w = LV_MAX(1, (lv_area_get_width(&grid->area) + LV_DRAW_TASK_GRID_SIZE - 1) / LV_DRAW_TASK_GRID_SIZE);
+    grid->cell_h = LV_MAX(1, (lv_area_get_height(&grid->area) + LV_DRAW_TASK_GRID_SIZE - 1) / LV_DRAW_TASK_GRID_SIZE);
+
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_TASK_GRID_SIZE * LV_DRAW_TASK_GRID_SIZE; i++) {
+        grid->cells[i].gen = 1;
+    }
+
+    layer->task_grid = grid;
+
+    lv_draw_task_t * t = layer->draw_task_head;
+    while(t) {
+        t->blocked_gen = 0;
+        if(!task_grid_add(layer, t)) {
+            task_grid_delete(layer);
+            return;
+        }
+        t = t->next;
+    }
+}
+
+static void task_grid_delete(lv_layer_t * layer)
+{
+    lv_draw_task_grid_t * grid = layer->task_grid;
+    if(grid == NULL) return;
+
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_TASK_GRID_SIZE * LV_DRAW_TASK_GRID_SIZE; i++) {
+        lv_free(grid->cells[i].tasks);
+    }
+    lv_free(grid);
+    layer->task_grid = NULL;
+}
+
+/**
+ * Add a task to the end of the cells covered by its real area
+ * @param layer     the layer of the task
+ * @param t         the task to add
+ * @return          false if there was not enough memory
+ */
+static bool task_grid_add(lv_layer_t * layer, lv_draw_task_t * t)
+{
+    lv_draw_task_grid_t * grid = layer->task_grid;
+    t->grid_x1 = get_grid_coord(t->_real_area.x1, grid->area.x1, grid->cell_w);
+    t->grid_y1 = get_grid_coord(t->_real_area.y1, grid->area.y1, grid->cell_h);
+    t->grid_x2 = get_grid_coord(t->_real_area.x2, grid->area.x1, grid->cell_w);
+    t->grid_y2 = get_grid_coord(t->_real_area.y2, grid->area.y1, grid->cell_h);
+
+    int32_t x;
+    int32_t y;
+    for(y = t->grid_y1; y <= t->grid_y2; y++) {
+        for(x = t->grid_x1; x <= t->grid_x2; x++) {
+            lv_draw_task_grid_cell_t * cell = &grid->cells[y * LV_DRAW_TASK_GRID_SIZE + x];
+            if(cell->cnt == cell->cap) {
+                /*Drop the holes first*/
+                uint32_t i;
+                uint32_t cnt = 0;
+                for(i = cell->first; i < cell->cnt; i++) {
+                    if(cell->tasks[i]) cell->tasks[cnt++] = cell->tasks[i];
+                }
+                cell->first = 0;
+                cell->cnt = cnt;
+
+                if(cnt >= cell->cap / 2) {
+                    uint32_t new_cap = cell->cap ? cell->cap * 2 : 8;
+                    lv_draw_task_t ** new_tasks = lv_realloc(cell->tasks, new_cap * sizeof(lv_draw_task_t *));
+                    if(new_tasks == NULL) return false;
+                    cell->tasks = new_tasks;
+                    cell->cap = new_cap;
+                }
+            }
+            cell->tasks[cell->cnt++] = t;
+        }
+    }
+
+    t->in_grid = 1;
+    return true;
+}
+
+static void task_grid_remove(lv_layer_t * layer, lv_draw_task_t * t)
+{
+    lv_draw_task_grid_t * grid = layer->task_grid;
+    if(grid == NULL || !t->in_grid) return;
+
+    int32_t x;
+    int32_t y;
+    for(y = t->grid_y1; y <= t->grid_y2; y++) {
+        for(x = t->grid_x1; x <= t->grid_x2; x++) {
+            lv_draw_task_grid_cell_t * cell = &grid->cells[y * LV_DRAW_TASK_GRID_SIZE + x];
+            /*Mostly the oldest tasks are finished so it's usually found right at the beginning*/
+            uint32_t i;
+            for(i = cell->first; i < cell->cnt; i++) {
+                if(cell->tasks[i] == t) {
+                    cell->tasks[i] = NULL;
+                    break;
+                }
+            }
+            while(cell->first < cell->cnt && cell->tasks[cell->first] == NULL) cell->first++;
+            if(cell->first == cell->cnt) {
+                cell->first = 0;
+                cell->cnt = 0;
+            }
+
+            cell->gen++;
+            if(cell->gen == 0) cell->gen = 1;
+        }
+    }
+}
+
+/**
+ * Tell the tasks blocked in the cells of `t` that `t` changed and they need to be checked again
+ * @param layer     the layer of the task
+ * @param t         the changed task
+ */
+static void task_grid_touch(lv_layer_t * layer, lv_draw_task_t * t)
+{
+    lv_draw_task_grid_t * grid = layer->task_grid;
+    if(grid == NULL || !t->in_grid) return;
+
+    int32_t x;
+    int32_t y;
+    for(y = t->grid_y1; y <= t->grid_y2; y++) {
+        for(x = t->grid_x1; x <= t->grid_x2; x++) {
+            lv_draw_task_grid_cell_t * cell = &grid->cells[y * LV_DRAW_TASK_GRID_SIZE + x];
+            cell->gen++;
+            if(cell->gen == 0) cell->gen = 1;
+        }
+    }
+}
+
+static bool is_opaque_color_format(lv_color_format_t cf)
+{
+    switch(cf) {
+        case LV_COLOR_FORMAT_L8:
+        case LV_COLOR_FORMAT_RGB565:
+        case LV_COLOR_FORMAT_RGB888:
+        case LV_COLOR_FORMAT_XRGB8888:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Get the area a draw task surely covers with fully opaque pixels.
+ * Similarly to `LV_EVENT_COVER_CHECK` only simple cases are considered.
+ * @param t         pointer to a draw task
+ * @param area      store the covered area here. The rounded corners are not excluded.
+ * @param radius    store the radius of the corners here
+ * @return          true: the task covers `area`; false: it's not known what the task covers
+ */
+static bool get_cover_area(const lv_draw_task_t * t, lv_area_t * area, int32_t * radius)
+{
+    *radius = 0;
+    if(t->type == LV_DRAW_TASK_TYPE_FILL) {
+        const lv_draw_fill_dsc_t * dsc = t->draw_dsc;
+        if(dsc->opa < LV_OPA_MAX) return false;
+        if(dsc->grad.dir != LV_GRAD_DIR_NONE) {
+            uint32_t i;
+            for(i = 0; i < dsc->grad.stops_count; i++) {
+                if(dsc->grad.stops[i].opa < LV_OPA_MAX) return false;
+            }
+        }
+        *radius = dsc->radius;
+    }
+    else if(t->type == LV_DRAW_TASK_TYPE_IMAGE) {
+        const lv_draw_image_dsc_t * dsc = t->draw_dsc;
+        if(dsc->opa < LV_OPA_MAX) return false;
+        if(dsc->rotation != 0 || dsc->skew_x != 0 || dsc->skew_y != 0 ||
+           dsc->scale_x != LV_SCALE_NONE || dsc->scale_y != LV_SCALE_NONE) return false;
+        if(dsc->blend_mode != LV_BLEND_MODE_NORMAL || dsc->tile || dsc->clip_radius || dsc->bitmap_mask_src) return false;
+        if(!is_opaque_color_format(dsc->header.cf)) return false;
+        /*Only the image is drawn even if the area is larger*/
+        if(lv_area_get_width(&t->area) != dsc->header.w || lv_area_get_height(&t->area) != dsc->header.h) return false;
+    }
+    else {
+        return false;
+    }
+
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    if(!lv_matrix_is_identity_or_translation(&t->matrix)) return false;
+#endif
+
+    *area = t->area;
+    return true;
+}
+
+/**
+ * Get the number of pixels a task would draw
+ * @param t         the draw task
+ * @return          size of the task's area clipped to its clip area
+ */
+static uint32_t get_draw_px_cnt(const lv_draw_task_t * t)
+{
+    lv_area_t draw_area;
+    if(!lv_area_intersect(&draw_area, &t->_real_area, &t->clip_area)) return 0;
+    return lv_area_get_size(&draw_area);
+}
+
+/**
+ * Drop a queued fill, border or image task if it's fully covered and clip it if one of its sides is covered
+ * @param layer         the layer of the tasks
+ * @param t             the older task to cull
+ * @param t_cover       the opaque task
+ * @param cover_area    area covered by `t_cover`, clipped to its clip area
+ * @param radius        radius of the corners of `t_cover->area`
+ */
+static void cull_task(lv_layer_t * layer, lv_draw_task_t * t, const lv_draw_task_t * t_cover,
+                      const lv_area_t * cover_area, int32_t radius)
+{
+    if(t->state != LV_DRAW_TASK_STATE_QUEUED) return;
+    if(t->type != LV_DRAW_TASK_TYPE_FILL && t->type != LV_DRAW_TASK_TYPE_BORDER &&
+       t->type != LV_DRAW_TASK_TYPE_IMAGE) return;
+
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    if(lv_memcmp(&t->matrix, &t_cover->matrix, sizeof(lv_matrix_t)) != 0) return;
+#endif
+
+    lv_area_t draw_area;
+    if(!lv_area_intersect(&draw_area, &t->_real_area, &t->clip_area)) return;
+    if(!lv_area_is_on(&draw_area, cover_area)) return;
+
+    lv_draw_global_info_t * info = &_draw_info;
+    if(lv_area_is_in(&draw_area, cover_area, 0) && lv_area_is_in(&draw_area, &t_cover->area, radius)) {
+        /*It will be removed as any other finished task*/
+        t->state = LV_DRAW_TASK_STATE_READY;
+        task_grid_touch(layer, t);
+        info->culled_task_cnt++;
+        info->culled_px_cnt += lv_area_get_size(&draw_area);
+        return;
+    }
+
+    /*The rows and columns between the rounded corners cover the full height or width*/
+    if(radius == 0) {
+        clip_covered_side(t, &draw_area, cover_area);
+    }
+    else {
+        int32_t r = LV_MIN(radius, LV_MIN(lv_area_get_width(&t_cover->area), lv_area_get_height(&t_cover->area)) / 2);
+        lv_area_t band;
+        band = t_cover->area;
+        band.y1 += r + 1;
+        band.y2 -= r + 1;
+        if(lv_area_intersect(&band, &band, cover_area)) clip_covered_side(t, &draw_area, &band);
+
+        band = t_cover->area;
+        band.x1 += r + 1;
+        band.x2 -= r + 1;
+        if(lv_area_intersect(&band, &band, cover_area)) clip_covered_side(t, &draw_area, &band);
+    }
+}
+
+/**
+ * Clip the part of a task which is hidden by an opaque rectangle covering one of its sides
+ * @param t             the task to clip
+ * @param draw_area     the area drawn by the task, it's updated with the clipping
+ * @param cover_area    the opaque area
+ */
+static void clip_covered_side(lv_draw_task_t * t, lv_area_t * draw_area, const lv_area_t * cover_area)
+{
+    lv_area_t clip_area = *draw_area;
+    if(cover_area->x1 <= draw_area->x1 && cover_area->x2 >= draw_area->x2) {
+        if(cover_area->y1 <= draw_area->y1) clip_area.y1 = cover_area->y2 + 1;
+        else if(cover_area->y2 >= draw_area->y2) clip_area.y2 = cover_area->y1 - 1;
+    }
+    else if(cover_area->y1 <= draw_area->y1 && cover_area->y2 >= draw_area->y2) {
+        if(cover_area->x1 <= draw_area->x1) clip_area.x1 = cover_area->x2 + 1;
+        else if(cover_area->x2 >= draw_area->x2) clip_area.x2 = cover_area->x1 - 1;
+    }
+
+    /*A cover area in the middle or one covering it fully can't be clipped*/
+    if(lv_area_get_width(&clip_area) <= 0 || lv_area_get_height(&clip_area) <= 0) return;
+    if(lv_area_get_size(&clip_area) == lv_area_get_size(draw_area)) return;
+
+    _draw_info.culled_px_cnt += lv_area_get_size(draw_area) - lv_area_get_size(&clip_area);
+    *draw_area = clip_area;
+    t->clip_area = clip_area;
+}
+
+/**
+ * Cull the older queued tasks of a layer hidden by a new opaque task
+ * @param layer     the layer of the task
+ * @param t_cover   the new task
+ */
+static void cull_covered_tasks(lv_layer_t * layer, lv_draw_task_t * t_cover)
+{
+    LV_PROFILER_BEGIN;
+    lv_area_t cover_area;
+    int32_t radius;
+    if(!get_cover_area(t_cover, &cover_area, &radius) ||
+       !lv_area_intersect(&cover_area, &cover_area, &t_cover->clip_area)) {
+        LV_PROFILER_END;
+        return;
+    }
+
+    lv_draw_task_grid_t * grid = layer->task_grid;
+    if(grid && t_cover->in_grid) {
+        int32_t x;
+        int32_t y;
+        for(y = t_cover->grid_y1; y <= t_cover->grid_y2; y++) {
+            for(x = t_cover->grid_x1; x <= t_cover->grid_x2; x++) {
+                lv_draw_task_grid_cell_t * cell = &grid->cells[y * LV_DRAW_TASK_GRID_SIZE + x];
+                uint32_t i;
+                for(i = cell->first; i < cell->cnt; i++) {
+                    lv_draw_task_t * t = cell->tasks[i];
+                    if(t == NULL) continue;
+                    if(t->seq >= t_cover->seq) break;
+                    cull_task(layer, t, t_cover, &cover_area, radius);
+                }
+            }
+        }
+    }
+    else {
+        lv_draw_task_t * t = layer->draw_task_head;
+        while(t && t != t_cover) {
+            cull_task(layer, t, t_cover, &cover_area, radius);
+            t = t->next;
+        }
+    }
+    LV_PROFILER_END;
+}
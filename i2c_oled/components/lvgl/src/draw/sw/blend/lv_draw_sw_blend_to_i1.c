@@ -0,0 +1,1533 @@
+/**
+ * @file lv_draw_sw_blend_to_i1.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_to_i1.h"
+#if LV_USE_DRAW_SW
+
+#include "lv_draw_sw_blend_private.h"
+#include "../../../misc/lv_math.h"
+#include "../../../display/lv_display.h"
+#include "../../../core/lv_refr.h"
+#include "../../../misc/lv_color.h"
+#include "../../../stdlib/lv_string.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_NEON
+    #include "neon/lv_blend_neon.h"
+#elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_HELIUM
+    #include "helium/lv_blend_helium.h"
+#elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
+    #include LV_DRAW_SW_ASM_CUSTOM_INCLUDE
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void /* LV_ATTRIBUTE_FAST_MEM */ i1_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
+
+#if LV_DRAW_SW_SUPPORT_L8
+    static void /* LV_ATTRIBUTE_FAST_MEM */ l8_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
+#endif
+
+#if LV_DRAW_SW_SUPPORT_AL88
+    static void /* LV_ATTRIBUTE_FAST_MEM */ al88_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
+#endif
+
+#if LV_DRAW_SW_SUPPORT_RGB565
+    static void /* LV_ATTRIBUTE_FAST_MEM */ rgb565_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
+#endif
+
+#if LV_DRAW_SW_SUPPORT_RGB888
+static void /* LV_ATTRIBUTE_FAST_MEM */ rgb888_image_blend(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                           const uint8_t src_px_size);
+#endif
+
+#if LV_DRAW_SW_SUPPORT_ARGB8888
+    static void /* LV_ATTRIBUTE_FAST_MEM */ argb8888_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
+#endif
+
+static inline void /* LV_ATTRIBUTE_FAST_MEM */ lv_color_8_8_mix(const uint8_t src, uint8_t * dest, uint8_t mix);
+
+static inline void /* LV_ATTRIBUTE_FAST_MEM */ blend_non_normal_pixel(uint8_t * dest_buf, int32_t dest_x,
+                                                                      lv_color32_t src,
+                                                                      lv_blend_mode_t mode);
+
+
+static inline void /* LV_ATTRIBUTE_FAST_MEM */ set_bit(uint8_t * buf, int32_t bit_idx);
+
+static inline void /* LV_ATTRIBUTE_FAST_MEM */ clear_bit(uint8_t * buf, int32_t bit_idx);
+
+static inline uint8_t /* LV_ATTRIBUTE_FAST_MEM */ get_bit(const uint8_t * buf, int32_t bit_idx);
+
+static inline void * /* LV_ATTRIBUTE_FAST_MEM */ drawbuf_next_row(const void * buf, uint32_t stride);
+
+static bool fill_threshold(const lv_draw_sw_blend_fill_dsc_t * dsc, uint8_t * src_color, int32_t * thr);
+
+static bool i1_image_threshold(const lv_draw_sw_blend_image_dsc_t * dsc, int32_t * thr);
+
+static void /* LV_ATTRIBUTE_FAST_MEM */ i1_image_blend_vtiled(lv_draw_sw_blend_image_dsc_t * dsc);
+
+static void /* LV_ATTRIBUTE_FAST_MEM */ image_blend_vtiled_by_rows(lv_draw_sw_blend_image_dsc_t * dsc);
+
+static void /* LV_ATTRIBUTE_FAST_MEM */ blend_span(uint8_t * dest_buf, int32_t bit_ofs, int32_t w,
+                                                  const uint8_t * src_buf, uint8_t color,
+                                                  const lv_opa_t * mask, int32_t thr);
+
+static inline void /* LV_ATTRIBUTE_FAST_MEM */ blend_bits(uint8_t * dest_buf, int32_t bit_idx, int32_t n,
+                                                          uint8_t src_bits, const lv_opa_t * mask, int32_t thr);
+
+static inline uint8_t /* LV_ATTRIBUTE_FAST_MEM */ get_bits(const uint8_t * buf, int32_t bit_idx, int32_t n);
+
+static inline uint8_t /* LV_ATTRIBUTE_FAST_MEM */ mask_to_bits(const lv_opa_t * mask, int32_t n, int32_t thr);
+
+static inline uint32_t /* LV_ATTRIBUTE_FAST_MEM */ load_u32(const uint8_t * buf);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define I1_LUM_THRESHOLD 127
+
+/*Pixels of a row blended at once when a vertically tiled row goes through the row major kernels*/
+#define VTILED_ROW_CHUNK 64
+
+#ifndef LV_DRAW_SW_I1_BLEND_NORMAL_TO_I1
+    #define LV_DRAW_SW_I1_BLEND_NORMAL_TO_I1(...)                    LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_I1_BLEND_NORMAL_TO_I1_WITH_OPA
+    #define LV_DRAW_SW_I1_BLEND_NORMAL_TO_I1_WITH_OPA(...)           LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_I1_BLEND_NORMAL_TO_I1_WITH_MASK
+    #define LV_DRAW_SW_I1_BLEND_NORMAL_TO_I1_WITH_MASK(...)          LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_I1_BLEND_NORMAL_TO_I1_MIX_MASK_OPA
+    #define LV_DRAW_SW_I1_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(...)       LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_I1
+    #define LV_DRAW_SW_COLOR_BLEND_TO_I1(...)                         LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_I1_WITH_OPA
+    #define LV_DRAW_SW_COLOR_BLEND_TO_I1_WITH_OPA(...)                LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_I1_WITH_MASK
+    #define LV_DRAW_SW_COLOR_BLEND_TO_I1_WITH_MASK(...)               LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_I1_MIX_MASK_OPA
+    #define LV_DRAW_SW_COLOR_BLEND_TO_I1_MIX_MASK_OPA(...)            LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_I1
+    #define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_I1(...)                 LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_I1_WITH_OPA
+    #define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_I1_WITH_OPA(...)        LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_I1_WITH_MASK
+    #define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_I1_WITH_MASK(...)       LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_I1_MIX_MASK_OPA
+    #define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(...)    LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1
+    #define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1(...)                 LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1_WITH_OPA
+    #define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1_WITH_OPA(...)        LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1_WITH_MASK
+    #define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1_WITH_MASK(...)       LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1_MIX_MASK_OPA
+    #define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(...)    LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_L8_BLEND_NORMAL_TO_I1
+    #define LV_DRAW_SW_L8_BLEND_NORMAL_TO_I1(...)               LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_L8_BLEND_NORMAL_TO_I1_WITH_OPA
+    #define LV_DRAW_SW_L8_BLEND_NORMAL_TO_I1_WITH_OPA(...)      LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_L8_BLEND_NORMAL_TO_I1_WITH_MASK
+    #define LV_DRAW_SW_L8_BLEND_NORMAL_TO_I1_WITH_MASK(...)     LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_L8_BLEND_NORMAL_TO_I1_MIX_MASK_OPA
+    #define LV_DRAW_SW_L8_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(...)  LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_AL88_BLEND_NORMAL_TO_I1
+    #define LV_DRAW_SW_AL88_BLEND_NORMAL_TO_I1(...)               LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_AL88_BLEND_NORMAL_TO_I1_WITH_OPA
+    #define LV_DRAW_SW_AL88_BLEND_NORMAL_TO_I1_WITH_OPA(...)      LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_AL88_BLEND_NORMAL_TO_I1_WITH_MASK
+    #define LV_DRAW_SW_AL88_BLEND_NORMAL_TO_I1_WITH_MASK(...)     LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_AL88_BLEND_NORMAL_TO_I1_MIX_MASK_OPA
+    #define LV_DRAW_SW_AL88_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(...)  LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_I1
+    #define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_I1(...)               LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_I1_WITH_OPA
+    #define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_I1_WITH_OPA(...)      LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_I1_WITH_MASK
+    #define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_I1_WITH_MASK(...)     LV_RESULT_INVALID
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_I1_MIX_MASK_OPA
+    #define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(...)  LV_RESULT_INVALID
+#endif
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color_to_i1(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+
+    /* Simple fill */
+    if(mask == NULL && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID != LV_DRAW_SW_COLOR_BLEND_TO_I1(dsc)) return;
+    }
+    /* Opacity only */
+    else if(mask == NULL && opa < LV_OPA_MAX) {
+        if(LV_RESULT_INVALID != LV_DRAW_SW_COLOR_BLEND_TO_I1_WITH_OPA(dsc)) return;
+    }
+    /* Masked with full opacity */
+    else if(mask && opa >= LV_OPA_MAX) {
+        if(LV_RESULT_INVALID != LV_DRAW_SW_COLOR_BLEND_TO_I1_WITH_MASK(dsc)) return;
+    }
+    /* Masked with opacity */
+    else {
+        if(LV_RESULT_INVALID != LV_DRAW_SW_COLOR_BLEND_TO_I1_MIX_MASK_OPA(dsc)) return;
+    }
+
+    uint8_t src_color;
+    int32_t thr;
+    if(!fill_threshold(dsc, &src_color, &thr)) return;
+
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+    for(int32_t y = 0; y < h; y++) {
+        blend_span(dest_buf, bit_ofs, dsc->dest_w, NULL, src_color, mask, thr);
+        dest_buf = drawbuf_next_row(dest_buf, dsc->dest_stride);
+        if(mask) mask += dsc->mask_stride;
+    }
+}
+
+void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image_to_i1(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    switch(dsc->src_color_format) {
+#if LV_DRAW_SW_SUPPORT_RGB565
+        case LV_COLOR_FORMAT_RGB565:
+            rgb565_image_blend(dsc);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_RGB888
+        case LV_COLOR_FORMAT_RGB888:
+            rgb888_image_blend(dsc, 3);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_XRGB8888
+        case LV_COLOR_FORMAT_XRGB8888:
+            rgb888_image_blend(dsc, 4);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_ARGB8888
+        case LV_COLOR_FORMAT_ARGB8888:
+            argb8888_image_blend(dsc);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_L8
+        case LV_COLOR_FORMAT_L8:
+            l8_image_blend(dsc);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_AL88
+        case LV_COLOR_FORMAT_AL88:
+            al88_image_blend(dsc);
+            break;
+#endif
+        case LV_COLOR_FORMAT_I1:
+            i1_image_blend(dsc);
+            break;
+        default:
+            LV_LOG_WARN("Not supported source color format");
+            break;
+    }
+}
+
+void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color_to_i1_vtiled(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    uint8_t src_color;
+    int32_t thr;
+    if(!fill_threshold(dsc, &src_color, &thr)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t y = dsc->relative_area.y1;
+    int32_t y_end = y + h;
+    int32_t x;
+
+    if(mask == NULL) {
+        /*All rows of the area in a page are written at once*/
+        while(y < y_end) {
+            int32_t y1 = y & 0x7;
+            int32_t y2 = LV_MIN(y_end - (y & ~0x7), 8) - 1;
+            uint8_t sel = (uint8_t)((0xFF << y1) & (0xFF >> (7 - y2)));
+            if(sel == 0xFF) {
+                lv_memset(dest_buf, src_color ? 0xFF : 0x00, w);
+            }
+            else if(src_color) {
+                for(x = 0; x < w; x++) dest_buf[x] |= sel;
+            }
+            else {
+                for(x = 0; x < w; x++) dest_buf[x] &= (uint8_t)~sel;
+            }
+            y += y2 - y1 + 1;
+            dest_buf += dsc->dest_stride;
+        }
+        return;
+    }
+
+    for(; y < y_end; y++) {
+        uint8_t bit = (uint8_t)(1 << (y & 0x7));
+        if(src_color) {
+            for(x = 0; x < w; x++) {
+                if(mask[x] >= thr) dest_buf[x] |= bit;
+            }
+        }
+        else {
+            for(x = 0; x < w; x++) {
+                if(mask[x] >= thr) dest_buf[x] &= (uint8_t)~bit;
+            }
+        }
+        if(bit == 0x80) dest_buf += dsc->dest_stride;
+        mask += dsc->mask_stride;
+    }
+}
+
+void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image_to_i1_vtiled(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(dsc->src_color_format == LV_COLOR_FORMAT_I1 && dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
+        i1_image_blend_vtiled(dsc);
+    }
+    else {
+        image_blend_vtiled_by_rows(dsc);
+    }
+}
+
+void lv_draw_sw_blend_color_to_i1_ref(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    int32_t dest_stride = dsc->dest_stride;
+
+    uint8_t src_color = lv_color_luminance(dsc->color) / (I1_LUM_THRESHOLD + 1);
+    uint8_t * dest_buf = dsc->dest_buf;
+
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+
+    /* Simple fill */
+    if(mask == NULL && opa >= LV_OPA_MAX) {
+        for(int32_t y = 0; y < h; y++) {
+            for(int32_t x = 0; x < w; x++) {
+                if(src_color) {
+                    set_bit(dest_buf, x + bit_ofs);
+                }
+                else {
+                    clear_bit(dest_buf, x + bit_ofs);
+                }
+            }
+            dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        }
+    }
+    /* Opacity only */
+    else if(mask == NULL && opa < LV_OPA_MAX) {
+        for(int32_t y = 0; y < h; y++) {
+            for(int32_t x = 0; x < w; x++) {
+                uint8_t * dest_bit = &dest_buf[(x + bit_ofs) / 8];
+                uint8_t current_bit = (*dest_bit >> (7 - ((x + bit_ofs) % 8))) & 0x01;
+                uint8_t new_bit = (opa * src_color + (255 - opa) * current_bit) / 255;
+                if(new_bit) {
+                    set_bit(dest_buf, x + bit_ofs);
+                }
+                else {
+                    clear_bit(dest_buf, x + bit_ofs);
+                }
+            }
+            dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        }
+    }
+    /* Masked with full opacity */
+    else if(mask && opa >= LV_OPA_MAX) {
+        for(int32_t y = 0; y < h; y++) {
+            for(int32_t x = 0; x < w; x++) {
+                uint8_t mask_val = mask[x];
+                if(mask_val == LV_OPA_TRANSP) continue;
+                if(mask_val == LV_OPA_COVER) {
+                    if(src_color) {
+                        set_bit(dest_buf, x + bit_ofs);
+                    }
+                    else {
+                        clear_bit(dest_buf, x + bit_ofs);
+                    }
+                }
+                else {
+                    uint8_t * dest_bit = &dest_buf[(x + bit_ofs) / 8];
+                    uint8_t current_bit = (*dest_bit >> (7 - ((x + bit_ofs) % 8))) & 0x01;
+                    uint8_t new_bit = (mask_val * src_color + (255 - mask_val) * current_bit) / 255;
+                    if(new_bit) {
+                        set_bit(dest_buf, x + bit_ofs);
+                    }
+                    else {
+                        clear_bit(dest_buf, x + bit_ofs);
+                    }
+                }
+            }
+            dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+            mask += mask_stride;
+        }
+    }
+    /* Masked with opacity */
+    else {
+        for(int32_t y = 0; y < h; y++) {
+            for(int32_t x = 0; x < w; x++) {
+                uint8_t mask_val = mask[x];
+                if(mask_val == LV_OPA_TRANSP) continue;
+                uint8_t * dest_bit = &dest_buf[(x + bit_ofs) / 8];
+                uint8_t current_bit = (*dest_bit >> (7 - ((x  + bit_ofs) % 8))) & 0x01;
+                uint8_t blended_opa = (mask_val * opa) / 255;
+                uint8_t new_bit = (blended_opa * src_color + (255 - blended_opa) * current_bit) / 255;
+                if(new_bit) {
+                    set_bit(dest_buf, x + bit_ofs);
+                }
+                else {
+                    clear_bit(dest_buf, x + bit_ofs);
+                }
+            }
+            dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+            mask += mask_stride;
+        }
+    }
+}
+
+void lv_draw_sw_blend_i1_to_i1_ref(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint8_t * dest_buf_i1 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf_i1 = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t dest_x;
+    int32_t src_x;
+    int32_t y;
+
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+
+    if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+        for(y = 0; y < h; y++) {
+            for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
+                if(get_bit(src_buf_i1, src_x)) {
+                    set_bit(dest_buf_i1, dest_x + bit_ofs);
+                }
+                else {
+                    clear_bit(dest_buf_i1, dest_x + bit_ofs);
+                }
+            }
+            dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+            src_buf_i1 = drawbuf_next_row(src_buf_i1, src_stride);
+        }
+    }
+    else if(mask_buf == NULL && opa < LV_OPA_MAX) {
+        for(y = 0; y < h; y++) {
+            for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
+                uint8_t src = get_bit(src_buf_i1, src_x);
+                uint8_t dest = get_bit(dest_buf_i1, dest_x + bit_ofs);
+                uint8_t blended = (src * opa + dest * (255 - opa));
+                if(blended > I1_LUM_THRESHOLD) {
+                    set_bit(dest_buf_i1, dest_x + bit_ofs);
+                }
+                else  {
+                    clear_bit(dest_buf_i1, dest_x + bit_ofs);
+                }
+            }
+            dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+            src_buf_i1 = drawbuf_next_row(src_buf_i1, src_stride);
+        }
+    }
+    else if(mask_buf && opa >= LV_OPA_MAX) {
+        for(y = 0; y < h; y++) {
+            for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
+                uint8_t mask_val = mask_buf[src_x];
+                uint8_t src = get_bit(src_buf_i1, src_x);
+                uint8_t dest = get_bit(dest_buf_i1, dest_x + bit_ofs);
+                uint8_t blended = (src * mask_val + dest * (255 - mask_val));
+                if(blended > I1_LUM_THRESHOLD) {
+                    set_bit(dest_buf_i1, dest_x + bit_ofs);
+                }
+                else  {
+                    clear_bit(dest_buf_i1, dest_x + bit_ofs);
+                }
+            }
+            dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+            src_buf_i1 = drawbuf_next_row(src_buf_i1, src_stride);
+            mask_buf += mask_stride;
+        }
+    }
+    else if(mask_buf && opa < LV_OPA_MAX) {
+        for(y = 0; y < h; y++) {
+            for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
+                uint8_t mask_val = mask_buf[src_x];
+                if(mask_val == LV_OPA_TRANSP) continue;
+                uint8_t src = get_bit(src_buf_i1, src_x);
+                uint8_t dest = get_bit(dest_buf_i1, dest_x + bit_ofs);
+                uint8_t blend_opa = LV_OPA_MIX2(mask_val, opa);
+                uint8_t blended = (src * blend_opa + dest * (255 - blend_opa));
+                if(blended > I1_LUM_THRESHOLD) {
+                    set_bit(dest_buf_i1, dest_x + bit_ofs);
+                }
+                else  {
+                    clear_bit(dest_buf_i1, dest_x + bit_ofs);
+                }
+            }
+            dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+            src_buf_i1 = drawbuf_next_row(src_buf_i1, src_stride);
+            mask_buf += mask_stride;
+        }
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint8_t * dest_buf_i1 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf_i1 = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t dest_x;
+    int32_t src_x;
+    int32_t y;
+
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+
+    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
+        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+            if(LV_RESULT_INVALID != LV_DRAW_SW_I1_BLEND_NORMAL_TO_I1(dsc)) return;
+        }
+        else if(mask_buf == NULL && opa < LV_OPA_MAX) {
+            if(LV_RESULT_INVALID != LV_DRAW_SW_I1_BLEND_NORMAL_TO_I1_WITH_OPA(dsc)) return;
+        }
+        else if(mask_buf && opa >= LV_OPA_MAX) {
+            if(LV_RESULT_INVALID != LV_DRAW_SW_I1_BLEND_NORMAL_TO_I1_WITH_MASK(dsc)) return;
+        }
+        else {
+            if(LV_RESULT_INVALID != LV_DRAW_SW_I1_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(dsc)) return;
+        }
+
+        int32_t thr;
+        if(!i1_image_threshold(dsc, &thr)) return;
+
+        for(y = 0; y < h; y++) {
+            blend_span(dest_buf_i1, bit_ofs, w, src_buf_i1, 0, mask_buf, thr);
+            dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+            src_buf_i1 = drawbuf_next_row(src_buf_i1, src_stride);
+            if(mask_buf) mask_buf += mask_stride;
+        }
+    }
+    else {
+        lv_color32_t src_argb;
+        for(y = 0; y < h; y++) {
+            for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
+                src_argb.red = get_bit(src_buf_i1, src_x) * 255;
+                src_argb.green = src_argb.red;
+                src_argb.blue = src_argb.red;
+                if(mask_buf == NULL) src_argb.alpha = opa;
+                else src_argb.alpha = LV_OPA_MIX2(mask_buf[dest_x], opa);
+                blend_non_normal_pixel(dest_buf_i1, dest_x + bit_ofs, src_argb, dsc->blend_mode);
+            }
+            if(mask_buf) mask_buf += mask_stride;
+            dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+            src_buf_i1 = drawbuf_next_row(src_buf_i1, src_stride);
+        }
+    }
+}
+
+/**
+ * The normal fills reduce to writing the color where the mask reaches a threshold,
+ * see lv_draw_sw_blend_color_to_i1_ref() for the per pixel formulas.
+ * @param dsc           the fill descriptor
+ * @param src_color     store the color's bit here
+ * @param thr           store the lowest mask value to write here, 0 to write every pixel
+ * @return              false if no pixels change
+ */
+static bool fill_threshold(const lv_draw_sw_blend_fill_dsc_t * dsc, uint8_t * src_color, int32_t * thr)
+{
+    lv_opa_t opa = dsc->opa;
+    *src_color = lv_color_luminance(dsc->color) / (I1_LUM_THRESHOLD + 1);
+
+    /* Simple fill */
+    if(dsc->mask_buf == NULL && opa >= LV_OPA_MAX) {
+        *thr = 0;
+    }
+    /* Opacity only: a lighter color can't set a bit, a darker one clears it*/
+    else if(dsc->mask_buf == NULL) {
+        if(*src_color || opa == LV_OPA_TRANSP) return false;
+        *thr = 0;
+    }
+    /* Masked with full opacity: set where the mask covers, clear where it's not transparent*/
+    else if(opa >= LV_OPA_MAX) {
+        *thr = *src_color ? LV_OPA_COVER : 1;
+    }
+    /* Masked with opacity: clear where mask * opa / 255 isn't 0*/
+    else {
+        if(*src_color || opa == LV_OPA_TRANSP) return false;
+        *thr = (255 + opa - 1) / opa;
+    }
+
+    return true;
+}
+
+/**
+ * A pixel takes the source bit where the mix is above I1_LUM_THRESHOLD and keeps its bit
+ * otherwise, see lv_draw_sw_blend_i1_to_i1_ref().
+ * @param dsc           the image descriptor with an I1 source and normal blending
+ * @param thr           store the lowest mask value to take the source bit here, 0 for every pixel
+ * @return              false if no pixels change
+ */
+static bool i1_image_threshold(const lv_draw_sw_blend_image_dsc_t * dsc, int32_t * thr)
+{
+    lv_opa_t opa = dsc->opa;
+
+    if(dsc->mask_buf == NULL && opa >= LV_OPA_MAX) {
+        *thr = 0;
+    }
+    else if(dsc->mask_buf == NULL) {
+        if(opa <= I1_LUM_THRESHOLD) return false;
+        *thr = 0;
+    }
+    else if(opa >= LV_OPA_MAX) {
+        *thr = I1_LUM_THRESHOLD + 1;
+    }
+    else {
+        if(opa == LV_OPA_TRANSP) return false;
+        /*LV_OPA_MIX2(mask, opa) > I1_LUM_THRESHOLD*/
+        *thr = ((I1_LUM_THRESHOLD + 1) * 256 + opa - 1) / opa;
+    }
+
+    return true;
+}
+
+static void LV_ATTRIBUTE_FAST_MEM i1_image_blend_vtiled(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t thr;
+    if(!i1_image_threshold(dsc, &thr)) return;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint8_t * dest_buf = dsc->dest_buf;
+    const uint8_t * src_buf = dsc->src_buf;
+    const lv_opa_t * mask = dsc->mask_buf;
+    int32_t y = dsc->relative_area.y1;
+    int32_t y_end = y + h;
+    int32_t x;
+
+    for(; y < y_end; y++) {
+        uint8_t bit = (uint8_t)(1 << (y & 0x7));
+        for(x = 0; x < w; x++) {
+            uint8_t sel = (mask == NULL || mask[x] >= thr) ? bit : 0;
+            uint8_t src = get_bit(src_buf, x) ? bit : 0;
+            dest_buf[x] = (uint8_t)((dest_buf[x] & ~sel) | (src & sel));
+        }
+        if(bit == 0x80) dest_buf += dsc->dest_stride;
+        src_buf += dsc->src_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+}
+
+/**
+ * Blend the other sources and modes with the row major kernels: a piece of a row is gathered from
+ * the pages into a row major I1 buffer, blended there and scattered back.
+ */
+static void LV_ATTRIBUTE_FAST_MEM image_blend_vtiled_by_rows(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    uint8_t row_buf[VTILED_ROW_CHUNK / 8];
+    lv_draw_sw_blend_image_dsc_t row_dsc = *dsc;
+    row_dsc.dest_buf = row_buf;
+    row_dsc.dest_h = 1;
+    row_dsc.dest_stride = sizeof(row_buf);
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint8_t * dest_buf = dsc->dest_buf;
+    const uint8_t * src_buf = dsc->src_buf;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint32_t src_px_bits = lv_color_format_get_bpp(dsc->src_color_format);
+    int32_t y = dsc->relative_area.y1;
+    int32_t y_end = y + h;
+    int32_t x;
+    int32_t i;
+
+    for(; y < y_end; y++) {
+        uint8_t bit = (uint8_t)(1 << (y & 0x7));
+        for(x = 0; x < w; x += VTILED_ROW_CHUNK) {
+            int32_t n = LV_MIN(VTILED_ROW_CHUNK, w - x);
+            uint8_t * dest = &dest_buf[x];
+
+            lv_memzero(row_buf, sizeof(row_buf));
+            for(i = 0; i < n; i++) {
+                if(dest[i] & bit) set_bit(row_buf, i);
+            }
+
+            row_dsc.dest_w = n;
+            row_dsc.src_buf = src_buf + ((x * src_px_bits) >> 3);
+            row_dsc.mask_buf = mask ? &mask[x] : NULL;
+            lv_area_set(&row_dsc.relative_area, 0, 0, n - 1, 0);
+            lv_draw_sw_blend_image_to_i1(&row_dsc);
+
+            for(i = 0; i < n; i++) {
+                if(get_bit(row_buf, i)) dest[i] |= bit;
+                else dest[i] &= (uint8_t)~bit;
+            }
+        }
+        if(bit == 0x80) dest_buf += dsc->dest_stride;
+        src_buf += dsc->src_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+}
+
+#if LV_DRAW_SW_SUPPORT_L8
+static void LV_ATTRIBUTE_FAST_MEM l8_image_blend(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint8_t * dest_buf_i1 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf_l8 = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t src_x, dest_x;
+    int32_t y;
+
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+
+    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
+        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+            if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_I1(dsc)) {
+                for(y = 0; y < h; y++) {
+                    for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
+                        if(src_buf_l8[src_x] > I1_LUM_THRESHOLD) {
+                            set_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                        else {
+                            clear_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                    }
+                    dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+                    src_buf_l8 = drawbuf_next_row(src_buf_l8, src_stride);
+                }
+            }
+        }
+        else if(mask_buf == NULL && opa < LV_OPA_MAX) {
+            if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_I1_WITH_OPA(dsc)) {
+                for(y = 0; y < h; y++) {
+                    for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
+                        uint8_t dest_val = get_bit(dest_buf_i1, dest_x + bit_ofs) * 255;
+                        lv_color_8_8_mix(src_buf_l8[src_x], &dest_val, opa);
+                        if(dest_val > I1_LUM_THRESHOLD) {
+                            set_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                        else {
+                            clear_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                    }
+                    dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+                    src_buf_l8 = drawbuf_next_row(src_buf_l8, src_stride);
+                }
+            }
+        }
+        else if(mask_buf && opa >= LV_OPA_MAX) {
+            if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_I1_WITH_MASK(dsc)) {
+                for(y = 0; y < h; y++) {
+                    for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
+                        uint8_t src_luminance = src_buf_l8[src_x];
+                        uint8_t dest_val = get_bit(dest_buf_i1, dest_x + bit_ofs) * 255;
+                        lv_color_8_8_mix(src_luminance, &dest_val, mask_buf[src_x]);
+                        if(dest_val > I1_LUM_THRESHOLD) {
+                            set_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                        else {
+                            clear_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                    }
+                    dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+                    src_buf_l8 = drawbuf_next_row(src_buf_l8, src_stride);
+                    mask_buf += mask_stride;
+                }
+            }
+        }
+        else if(mask_buf && opa < LV_OPA_MAX) {
+            if(LV_RESULT_INVALID == LV_DRAW_SW_L8_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(dsc)) {
+                for(y = 0; y < h; y++) {
+                    for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
+                        uint8_t src_luminance = src_buf_l8[src_x];
+                        uint8_t dest_val = get_bit(dest_buf_i1, dest_x + bit_ofs) * 255;
+                        lv_color_8_8_mix(src_luminance, &dest_val, LV_OPA_MIX2(mask_buf[src_x], opa));
+                        if(dest_val > I1_LUM_THRESHOLD) {
+                            set_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                        else {
+                            clear_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                    }
+                    dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+                    src_buf_l8 = drawbuf_next_row(src_buf_l8, src_stride);
+                    mask_buf += mask_stride;
+                }
+            }
+        }
+    }
+    else {
+        lv_color32_t src_argb;
+        for(y = 0; y < h; y++) {
+            for(src_x = 0; src_x < w; src_x++) {
+                src_argb.red = src_buf_l8[src_x];
+                src_argb.green = src_buf_l8[src_x];
+                src_argb.blue = src_buf_l8[src_x];
+                if(mask_buf == NULL) src_argb.alpha = opa;
+                else src_argb.alpha = LV_OPA_MIX2(mask_buf[src_x], opa);
+                blend_non_normal_pixel(dest_buf_i1, src_x + bit_ofs, src_argb, dsc->blend_mode);
+            }
+            if(mask_buf) mask_buf += mask_stride;
+            dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+            src_buf_l8 = drawbuf_next_row(src_buf_l8, src_stride);
+        }
+    }
+}
+#endif
+
+#if LV_DRAW_SW_SUPPORT_AL88
+static void LV_ATTRIBUTE_FAST_MEM al88_image_blend(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint8_t * dest_buf_i1 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color16a_t * src_buf_al88 = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t dest_x;
+    int32_t src_x;
+    int32_t y;
+
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+
+    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
+        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+            if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_I1(dsc)) {
+                for(y = 0; y < h; y++) {
+                    for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
+                        uint8_t dest_val = get_bit(dest_buf_i1, dest_x + bit_ofs) * 255;
+                        lv_color_8_8_mix(src_buf_al88[src_x].lumi, &dest_val, src_buf_al88[src_x].alpha);
+                        if(dest_val > I1_LUM_THRESHOLD) {
+                            set_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                        else {
+                            clear_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                    }
+                    dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+                    src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
+                }
+            }
+        }
+        else if(mask_buf == NULL && opa < LV_OPA_MAX) {
+            if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_I1_WITH_OPA(dsc)) {
+                for(y = 0; y < h; y++) {
+                    for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
+                        uint8_t dest_val = get_bit(dest_buf_i1, dest_x + bit_ofs) * 255;
+                        lv_color_8_8_mix(src_buf_al88[src_x].lumi, &dest_val, LV_OPA_MIX2(src_buf_al88[src_x].alpha, opa));
+                        if(dest_val > I1_LUM_THRESHOLD) {
+                            set_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                        else {
+                            clear_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                    }
+                    dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+                    src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
+                }
+            }
+        }
+        else if(mask_buf && opa >= LV_OPA_MAX) {
+            if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_I1_WITH_MASK(dsc)) {
+                for(y = 0; y < h; y++) {
+                    for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
+                        uint8_t dest_val = get_bit(dest_buf_i1, dest_x + bit_ofs) * 255;
+                        lv_color_8_8_mix(src_buf_al88[src_x].lumi, &dest_val,  LV_OPA_MIX2(src_buf_al88[src_x].alpha, mask_buf[src_x]));
+                        if(dest_val > I1_LUM_THRESHOLD) {
+                            set_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                        else {
+                            clear_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                    }
+                    dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+                    src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
+                    mask_buf += mask_stride;
+                }
+            }
+        }
+        else if(mask_buf && opa < LV_OPA_MAX) {
+            if(LV_RESULT_INVALID == LV_DRAW_SW_AL88_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(dsc)) {
+                for(y = 0; y < h; y++) {
+                    for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
+                        uint8_t dest_val = get_bit(dest_buf_i1, dest_x + bit_ofs) * 255;
+                        lv_color_8_8_mix(src_buf_al88[src_x].lumi, &dest_val, LV_OPA_MIX3(src_buf_al88[src_x].alpha, mask_buf[src_x], opa));
+                        if(dest_val > I1_LUM_THRESHOLD) {
+                            set_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                        else {
+                            clear_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                    }
+                    dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+                    src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
+                    mask_buf += mask_stride;
+                }
+            }
+        }
+    }
+    else {
+        lv_color32_t src_argb;
+        for(y = 0; y < h; y++) {
+            for(dest_x = 0, src_x = 0; src_x < w; dest_x++, src_x++) {
+                src_argb.red = src_buf_al88[src_x].lumi;
+                src_argb.green = src_buf_al88[src_x].lumi;
+                src_argb.blue = src_buf_al88[src_x].lumi;
+                if(mask_buf == NULL) src_argb.alpha = LV_OPA_MIX2(src_buf_al88[src_x].alpha, opa);
+                else src_argb.alpha = LV_OPA_MIX3(src_buf_al88[src_x].alpha, mask_buf[src_x], opa);
+                blend_non_normal_pixel(dest_buf_i1, dest_x + bit_ofs, src_argb, dsc->blend_mode);
+            }
+            if(mask_buf) mask_buf += mask_stride;
+            dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+            src_buf_al88 = drawbuf_next_row(src_buf_al88, src_stride);
+        }
+    }
+}
+#endif
+
+#if LV_DRAW_SW_SUPPORT_ARGB8888
+static void LV_ATTRIBUTE_FAST_MEM argb8888_image_blend(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint8_t * dest_buf_i1 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color32_t * src_buf_c32 = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t x;
+    int32_t y;
+
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+
+    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
+        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+            if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_I1(dsc)) {
+                for(y = 0; y < h; y++) {
+                    for(x = 0; x < w; x++) {
+                        uint8_t src = lv_color32_luminance(src_buf_c32[x]);
+                        uint8_t dest = get_bit(dest_buf_i1, x + bit_ofs) * 255;
+                        lv_color_8_8_mix(src, &dest, src_buf_c32[x].alpha);
+                        if(dest > I1_LUM_THRESHOLD) {
+                            set_bit(dest_buf_i1, x + bit_ofs);
+                        }
+                        else {
+                            clear_bit(dest_buf_i1, x + bit_ofs);
+                        }
+                    }
+                    dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+                    src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+                }
+            }
+        }
+        else if(mask_buf == NULL && opa < LV_OPA_MAX) {
+            if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_I1_WITH_OPA(dsc)) {
+                for(y = 0; y < h; y++) {
+                    for(x = 0; x < w; x++) {
+                        uint8_t src = lv_color32_luminance(src_buf_c32[x]);
+                        uint8_t dest = get_bit(dest_buf_i1, x + bit_ofs) * 255;
+                        lv_color_8_8_mix(src, &dest, LV_OPA_MIX2(opa, src_buf_c32[x].alpha));
+                        if(dest > I1_LUM_THRESHOLD) {
+                            set_bit(dest_buf_i1, x + bit_ofs);
+                        }
+                        else {
+                            clear_bit(dest_buf_i1, x + bit_ofs);
+                        }
+                    }
+                    dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+                    src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+                }
+            }
+        }
+        else if(mask_buf && opa >= LV_OPA_MAX) {
+            if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_I1_WITH_MASK(dsc)) {
+                for(y = 0; y < h; y++) {
+                    for(x = 0; x < w; x++) {
+                        uint8_t src = lv_color32_luminance(src_buf_c32[x]);
+                        uint8_t dest = get_bit(dest_buf_i1, x + bit_ofs) * 255;
+                        lv_color_8_8_mix(src, &dest, LV_OPA_MIX2(mask_buf[x], src_buf_c32[x].alpha));
+                        if(dest > I1_LUM_THRESHOLD) {
+                            set_bit(dest_buf_i1, x + bit_ofs);
+                        }
+                        else {
+                            clear_bit(dest_buf_i1, x + bit_ofs);
+                        }
+                    }
+                    dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+                    src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+                    mask_buf += mask_stride;
+                }
+            }
+        }
+        else if(mask_buf && opa < LV_OPA_MAX) {
+            if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(dsc)) {
+                for(y = 0; y < h; y++) {
+                    for(x = 0; x < w; x++) {
+                        uint8_t src = lv_color32_luminance(src_buf_c32[x]);
+                        uint8_t dest = get_bit(dest_buf_i1, x + bit_ofs) * 255;
+                        lv_color_8_8_mix(src, &dest, LV_OPA_MIX3(opa, mask_buf[x], src_buf_c32[x].alpha));
+                        if(dest > I1_LUM_THRESHOLD) {
+                            set_bit(dest_buf_i1, x + bit_ofs);
+                        }
+                        else {
+                            clear_bit(dest_buf_i1, x + bit_ofs);
+                        }
+                    }
+                    dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+                    src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+                    mask_buf += mask_stride;
+                }
+            }
+        }
+    }
+    else {
+        for(y = 0; y < h; y++) {
+            for(x = 0; x < w; x++) {
+                lv_color32_t color_argb = src_buf_c32[x];
+                if(mask_buf == NULL) color_argb.alpha = LV_OPA_MIX2(color_argb.alpha, opa);
+                else color_argb.alpha = LV_OPA_MIX3(color_argb.alpha, mask_buf[x], opa);
+                blend_non_normal_pixel(dest_buf_i1, x + bit_ofs, color_argb, dsc->blend_mode);
+            }
+            if(mask_buf) mask_buf += mask_stride;
+            dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+            src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+        }
+    }
+}
+#endif
+
+#if LV_DRAW_SW_SUPPORT_RGB888
+static void LV_ATTRIBUTE_FAST_MEM rgb888_image_blend(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                     const uint8_t src_px_size)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint8_t * dest_buf_i1 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf_rgb888 = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t dest_x;
+    int32_t src_x;
+    int32_t y;
+
+
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+
+    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
+        /*Special case*/
+        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1(dsc)) {
+                for(y = 0; y < h; y++) {
+                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
+                        uint8_t src = lv_color24_luminance(&src_buf_rgb888[src_x]);
+                        if(src > I1_LUM_THRESHOLD) {
+                            set_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                        else {
+                            clear_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                    }
+                    dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+                    src_buf_rgb888 = drawbuf_next_row(src_buf_rgb888, src_stride);
+                }
+            }
+        }
+        else if(mask_buf == NULL && opa < LV_OPA_MAX) {
+            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1_WITH_OPA(dsc)) {
+                for(y = 0; y < h; y++) {
+                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
+                        uint8_t src = lv_color24_luminance(&src_buf_rgb888[src_x]);
+                        uint8_t dest = get_bit(dest_buf_i1, dest_x + bit_ofs) * 255;
+                        lv_color_8_8_mix(src, &dest, opa);
+                        if(dest > I1_LUM_THRESHOLD) {
+                            set_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                        else {
+                            clear_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                    }
+                    dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+                    src_buf_rgb888 = drawbuf_next_row(src_buf_rgb888, src_stride);
+                }
+            }
+        }
+        else if(mask_buf && opa >= LV_OPA_MAX) {
+            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1_WITH_MASK(dsc)) {
+                uint32_t mask_x;
+                for(y = 0; y < h; y++) {
+                    for(mask_x = 0, dest_x = 0, src_x = 0; dest_x < w; mask_x++, dest_x++, src_x += src_px_size) {
+                        uint8_t src = lv_color24_luminance(&src_buf_rgb888[src_x]);
+                        uint8_t dest = get_bit(dest_buf_i1, dest_x + bit_ofs) * 255;
+                        lv_color_8_8_mix(src, &dest, mask_buf[mask_x]);
+                        if(dest > I1_LUM_THRESHOLD) {
+                            set_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                        else {
+                            clear_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                    }
+                    dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+                    src_buf_rgb888 = drawbuf_next_row(src_buf_rgb888, src_stride);
+                    mask_buf += mask_stride;
+                }
+            }
+        }
+        else if(mask_buf && opa < LV_OPA_MAX) {
+            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(dsc)) {
+                uint32_t mask_x;
+                for(y = 0; y < h; y++) {
+                    for(mask_x = 0, dest_x = 0, src_x = 0; dest_x < w; mask_x++, dest_x++, src_x += src_px_size) {
+                        uint8_t src = lv_color24_luminance(&src_buf_rgb888[src_x]);
+                        uint8_t dest = get_bit(dest_buf_i1, dest_x + bit_ofs) * 255;
+                        lv_color_8_8_mix(src, &dest, LV_OPA_MIX2(mask_buf[mask_x], opa));
+                        if(dest > I1_LUM_THRESHOLD) {
+                            set_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                        else {
+                            clear_bit(dest_buf_i1, dest_x + bit_ofs);
+                        }
+                    }
+                    dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+                    src_buf_rgb888 = drawbuf_next_row(src_buf_rgb888, src_stride);
+                    mask_buf += mask_stride;
+                }
+            }
+        }
+        else {
+            lv_color32_t src_argb;
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
+                    src_argb.red = src_buf_rgb888[src_x + 2];
+                    src_argb.green = src_buf_rgb888[src_x + 1];
+                    src_argb.blue = src_buf_rgb888[src_x + 0];
+                    if(mask_buf == NULL) src_argb.alpha = opa;
+                    else src_argb.alpha = LV_OPA_MIX2(mask_buf[dest_x], opa);
+
+                    blend_non_normal_pixel(dest_buf_i1, dest_x + bit_ofs, src_argb, dsc->blend_mode);
+                }
+                if(mask_buf) mask_buf += mask_stride;
+                dest_buf_i1 = drawbuf_next_row(dest_buf_i1, dest_stride);
+                src_buf_rgb888 = drawbuf_next_row(src_buf_rgb888, src_stride);
+            }
+        }
+    }
+}
+#endif
+
+#if LV_DRAW_SW_SUPPORT_RGB565
+static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint8_t * dest_buf_u8 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color16_t * src_buf_c16 = (const lv_color16_t *)dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    int32_t bit_ofs = dsc->relative_area.x1 % 8;
+
+    int32_t src_x;
+    int32_t dest_x;
+    int32_t y;
+
+    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
+        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_I1(dsc)) {
+                for(y = 0; y < h; y++) {
+                    for(src_x = 0, dest_x = 0; src_x < w; dest_x++, src_x++) {
+                        uint8_t src = lv_color16_luminance(src_buf_c16[src_x]);
+                        if(src > I1_LUM_THRESHOLD) {
+                            set_bit(dest_buf_u8, dest_x + bit_ofs);
+                        }
+                        else {
+                            clear_bit(dest_buf_u8, dest_x + bit_ofs);
+                        }
+                    }
+                    dest_buf_u8 = drawbuf_next_row(dest_buf_u8, dest_stride);
+                    src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
+                }
+            }
+        }
+        else if(mask_buf == NULL && opa < LV_OPA_MAX) {
+            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_I1_WITH_OPA(dsc)) {
+                for(y = 0; y < h; y++) {
+                    for(src_x = 0, dest_x = 0; src_x < w; dest_x++, src_x++) {
+                        uint8_t src = lv_color16_luminance(src_buf_c16[src_x]);
+                        uint8_t dest = get_bit(dest_buf_u8, dest_x + bit_ofs) * 255;
+                        lv_color_8_8_mix(src, &dest, opa);
+                        if(dest > I1_LUM_THRESHOLD) {
+                            set_bit(dest_buf_u8, dest_x  + bit_ofs);
+                        }
+                        else {
+                            clear_bit(dest_buf_u8, dest_x  + bit_ofs);
+                        }
+                    }
+                    dest_buf_u8 = drawbuf_next_row(dest_buf_u8, dest_stride);
+                    src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
+                }
+            }
+        }
+        else if(mask_buf && opa >= LV_OPA_MAX) {
+            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_I1_WITH_MASK(dsc)) {
+                uint32_t mask_x;
+                for(y = 0; y < h; y++) {
+                    for(mask_x = 0, dest_x = 0, src_x = 0; dest_x < w; mask_x++, dest_x++, src_x++) {
+                        uint8_t src = lv_color16_luminance(src_buf_c16[src_x]);
+                        uint8_t dest = get_bit(dest_buf_u8, dest_x + bit_ofs) * 255;
+                        lv_color_8_8_mix(src, &dest, mask_buf[mask_x]);
+                        if(dest > I1_LUM_THRESHOLD) {
+                            set_bit(dest_buf_u8, dest_x + bit_ofs);
+                        }
+                        else {
+                            clear_bit(dest_buf_u8, dest_x + bit_ofs);
+                        }
+                    }
+                    dest_buf_u8 = drawbuf_next_row(dest_buf_u8, dest_stride);
+                    src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
+                    mask_buf += mask_stride;
+                }
+            }
+        }
+        else if(mask_buf && opa < LV_OPA_MAX)  {
+            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_I1_MIX_MASK_OPA(dsc)) {
+                uint32_t mask_x;
+                for(y = 0; y < h; y++) {
+                    for(mask_x = 0, dest_x = 0, src_x = 0; dest_x < w; mask_x++, dest_x++, src_x++) {
+                        uint8_t src = lv_color16_luminance(src_buf_c16[src_x]);
+                        uint8_t dest = get_bit(dest_buf_u8, dest_x + bit_ofs) * 255;
+                        lv_color_8_8_mix(src, &dest, LV_OPA_MIX2(mask_buf[mask_x], opa));
+                        if(dest > I1_LUM_THRESHOLD) {
+                            set_bit(dest_buf_u8, dest_x + bit_ofs);
+                        }
+                        else {
+                            clear_bit(dest_buf_u8, dest_x + bit_ofs);
+                        }
+                    }
+                    dest_buf_u8 = drawbuf_next_row(dest_buf_u8, dest_stride);
+                    src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
+                    mask_buf += mask_stride;
+                }
+            }
+        }
+    }
+    else {
+        lv_color32_t src_argb;
+        for(y = 0; y < h; y++) {
+            for(src_x = 0, dest_x = 0; src_x < w; src_x++, dest_x++) {
+                src_argb.red = (src_buf_c16[src_x].red * 2106) >> 8;
+                src_argb.green = (src_buf_c16[src_x].green * 1037) >> 8;
+                src_argb.blue = (src_buf_c16[src_x].blue * 2106) >> 8;
+                if(mask_buf == NULL) src_argb.alpha = opa;
+                else src_argb.alpha = LV_OPA_MIX2(mask_buf[src_x], opa);
+
+                blend_non_normal_pixel(dest_buf_u8, dest_x + bit_ofs, src_argb, dsc->blend_mode);
+            }
+            if(mask_buf) mask_buf += mask_stride;
+            dest_buf_u8 = drawbuf_next_row(dest_buf_u8, dest_stride);
+            src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
+        }
+    }
+}
+#endif
+
+static inline void LV_ATTRIBUTE_FAST_MEM blend_non_normal_pixel(uint8_t * dest_buf, int32_t dest_x, lv_color32_t src,
+                                                                lv_blend_mode_t mode)
+{
+    uint8_t res;
+    int32_t src_lumi = lv_color32_luminance(src);
+    uint8_t dest_lumi = get_bit(dest_buf, dest_x) * 255;
+    switch(mode) {
+        case LV_BLEND_MODE_ADDITIVE:
+            res = LV_MIN(dest_lumi + src_lumi, 255);
+            break;
+        case LV_BLEND_MODE_SUBTRACTIVE:
+            res = LV_MAX(dest_lumi - src_lumi, 0);
+            break;
+        case LV_BLEND_MODE_MULTIPLY:
+            res = (dest_lumi * src_lumi) >> 8;
+            break;
+        default:
+            LV_LOG_WARN("Not supported blend mode: %d", mode);
+            return;
+    }
+
+    lv_color_8_8_mix(res, &dest_lumi, src.alpha);
+    if(dest_lumi > I1_LUM_THRESHOLD) {
+        set_bit(dest_buf, dest_x);
+    }
+    else {
+        clear_bit(dest_buf, dest_x);
+    }
+}
+
+static inline void LV_ATTRIBUTE_FAST_MEM lv_color_8_8_mix(const uint8_t src, uint8_t * dest, uint8_t mix)
+{
+
+    if(mix == 0) return;
+
+    if(mix >= LV_OPA_MAX) {
+        *dest = src;
+    }
+    else {
+        lv_opa_t mix_inv = 255 - mix;
+        *dest = (uint32_t)((uint32_t)src * mix + dest[0] * mix_inv) >> 8;
+    }
+}
+
+static inline void * LV_ATTRIBUTE_FAST_MEM drawbuf_next_row(const void * buf, uint32_t stride)
+{
+    return (void *)((uint8_t *)buf + stride);
+}
+
+/**
+ * Blend a row of pixels `[0, w)` stored at the bits `[bit_ofs, bit_ofs + w)` of `dest_buf`.
+ * Without `mask` every pixel is written, otherwise the pixels with `mask[x] >= thr`.
+ * The new value is the bit `x` of `src_buf`, or `color` (0 or 1) if `src_buf` is NULL.
+ * The unaligned head and tail bits are merged into their bytes, the bytes between
+ * are filled, copied or merged as whole bytes and 32-bit words.
+ */
+static void LV_ATTRIBUTE_FAST_MEM blend_span(uint8_t * dest_buf, int32_t bit_ofs, int32_t w,
+                                            const uint8_t * src_buf, uint8_t color,
+                                            const lv_opa_t * mask, int32_t thr)
+{
+    uint8_t color_bits = color ? 0xFF : 0x00;
+    int32_t end = bit_ofs + w;
+    int32_t p = bit_ofs;
+
+    /*Head*/
+    if(p & 7) {
+        int32_t n = LV_MIN(8 - (p & 7), end - p);
+        int32_t x = p - bit_ofs;
+        blend_bits(dest_buf, p, n, src_buf ? get_bits(src_buf, x, n) : color_bits, mask ? &mask[x] : NULL, thr);
+        p += n;
+    }
+
+    /*Whole bytes*/
+    int32_t byte_cnt = (end - p) >> 3;
+    if(byte_cnt > 0) {
+        uint8_t * dest = &dest_buf[p >> 3];
+        int32_t x = p - bit_ofs;
+        int32_t i;
+        if(mask == NULL && src_buf == NULL) {
+            lv_memset(dest, color_bits, byte_cnt);
+        }
+        else if(mask == NULL && (x & 7) == 0) {
+            lv_memcpy(dest, &src_buf[x >> 3], byte_cnt);
+        }
+        else if(mask == NULL) {
+            /*The source is shifted against the destination: a word of the destination is
+             *the big endian word at the source byte shifted left, plus the top of the next byte*/
+            const uint8_t * src = &src_buf[x >> 3];
+            int32_t shift = x & 7;
+            for(i = 0; i + 4 <= byte_cnt; i += 4) {
+                uint32_t v = ((uint32_t)src[i] << 24) | ((uint32_t)src[i + 1] << 16) | ((uint32_t)src[i + 2] << 8) | src[i + 3];
+                v = (v << shift) | (src[i + 4] >> (8 - shift));
+                dest[i] = (uint8_t)(v >> 24);
+                dest[i + 1] = (uint8_t)(v >> 16);
+                dest[i + 2] = (uint8_t)(v >> 8);
+                dest[i + 3] = (uint8_t)v;
+            }
+            for(; i < byte_cnt; i++) {
+                dest[i] = (uint8_t)((src[i] << shift) | (src[i + 1] >> (8 - shift)));
+            }
+        }
+        else {
+            const lv_opa_t * m = &mask[x];
+            for(i = 0; i < byte_cnt; i++, m += 8) {
+                /*Anti-aliased edges are short, so most mask bytes come in transparent or covering runs*/
+                uint32_t m_lo = load_u32(m);
+                uint32_t m_hi = load_u32(m + 4);
+                uint8_t sel;
+                if((m_lo | m_hi) == 0) continue;
+                else if((m_lo & m_hi) == 0xFFFFFFFF && thr <= LV_OPA_COVER) sel = 0xFF;
+                else sel = mask_to_bits(m, 8, thr);
+                if(sel == 0) continue;
+                uint8_t bits = src_buf ? get_bits(src_buf, x + i * 8, 8) : color_bits;
+                dest[i] = (uint8_t)((dest[i] & ~sel) | (bits & sel));
+            }
+        }
+        p += byte_cnt * 8;
+    }
+
+    /*Tail*/
+    if(p < end) {
+        int32_t n = end - p;
+        int32_t x = p - bit_ofs;
+        blend_bits(dest_buf, p, n, src_buf ? get_bits(src_buf, x, n) : color_bits, mask ? &mask[x] : NULL, thr);
+    }
+}
+
+/**
+ * Write `n` bits from `bit_idx` on, within one byte. `src_bits` holds the new bits MSB first.
+ */
+static inline void LV_ATTRIBUTE_FAST_MEM blend_bits(uint8_t * dest_buf, int32_t bit_idx, int32_t n,
+                                                    uint8_t src_bits, const lv_opa_t * mask, int32_t thr)
+{
+    uint8_t sel = (uint8_t)(0xFF00 >> n);
+    if(mask) sel &= mask_to_bits(mask, n, thr);
+    int32_t ofs = bit_idx & 7;
+    sel >>= ofs;
+    src_bits >>= ofs;
+    uint8_t * dest = &dest_buf[bit_idx >> 3];
+    *dest = (uint8_t)((*dest & ~sel) | (src_bits & sel));
+}
+
+/**
+ * Get `n` (1..8) bits from `bit_idx` on, MSB first. The bits after them are undefined.
+ */
+static inline uint8_t LV_ATTRIBUTE_FAST_MEM get_bits(const uint8_t * buf, int32_t bit_idx, int32_t n)
+{
+    const uint8_t * p = &buf[bit_idx >> 3];
+    int32_t ofs = bit_idx & 7;
+    uint32_t v = (uint32_t)p[0] << ofs;
+    /*Don't read the next byte if not needed, it can be past the end of the row*/
+    if(ofs + n > 8) v |= p[1] >> (8 - ofs);
+    return (uint8_t)v;
+}
+
+/**
+ * One bit per mask value, MSB first: 1 where `mask[i] >= thr`
+ */
+static inline uint8_t LV_ATTRIBUTE_FAST_MEM mask_to_bits(const lv_opa_t * mask, int32_t n, int32_t thr)
+{
+    uint32_t bits = 0;
+    int32_t i;
+    for(i = 0; i < n; i++) {
+        bits = (bits << 1) | (mask[i] >= thr);
+    }
+    return (uint8_t)(bits << (8 - n));
+}
+
+static inline uint32_t LV_ATTRIBUTE_FAST_MEM load_u32(const uint8_t * buf)
+{
+    /*Compilers merge this into one load where unaligned access is allowed*/
+    return (uint32_t)buf[0] | ((uint32_t)buf[1] << 8) | ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);
+}
+
+static inline void LV_ATTRIBUTE_FAST_MEM set_bit(uint8_t * buf, int32_t bit_idx)
+{
+    buf[bit_idx / 8] |= (1 << (7 - (bit_idx % 8)));
+}
+
+static inline void LV_ATTRIBUTE_FAST_MEM clear_bit(uint8_t * buf, int32_t bit_idx)
+{
+    buf[bit_idx / 8] &= ~(1 << (7 - (bit_idx % 8)));
+}
+
+static inline uint8_t LV_ATTRIBUTE_FAST_MEM get_bit(const uint8_t * buf, int32_t bit_idx)
+{
+    return (buf[bit_idx / 8] >> (7 - (bit_idx % 8))) & 1;
+}
+
+#endif
@@ -0,0 +1,73 @@
+/**
+ * @file lv_draw_sw_blend_to_i1.h
+ *
+ */
+
+#ifndef LV_DRAW_SW_BLEND_TO_I1_H
+#define LV_DRAW_SW_BLEND_TO_I1_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_draw_sw.h"
+#if LV_USE_DRAW_SW
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_color_to_i1(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_image_to_i1(lv_draw_sw_blend_image_dsc_t * dsc);
+
+/**
+ * Fill an area of a `LV_COLOR_FORMAT_I1_VTILED` buffer.
+ * `dest_buf` points to the page of the first row, `relative_area.y1 % 8` is its bit.
+ * @param dsc       the fill descriptor
+ */
+void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_color_to_i1_vtiled(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+/**
+ * Blend an image to an area of a `LV_COLOR_FORMAT_I1_VTILED` buffer, with the same result as
+ * `lv_draw_sw_blend_image_to_i1()` gives in a row major I1 buffer.
+ * @param dsc       the image descriptor
+ */
+void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_image_to_i1_vtiled(lv_draw_sw_blend_image_dsc_t * dsc);
+
+/**
+ * Reference version of `lv_draw_sw_blend_color_to_i1()` writing one pixel at a time.
+ * Not used for drawing, only to verify the span based version.
+ * @param dsc       the fill descriptor
+ */
+void lv_draw_sw_blend_color_to_i1_ref(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+/**
+ * Reference version of `lv_draw_sw_blend_image_to_i1()` for I1 images with normal blending,
+ * writing one pixel at a time. Not used for drawing, only to verify the span based version.
+ * @param dsc       the image descriptor
+ */
+void lv_draw_sw_blend_i1_to_i1_ref(lv_draw_sw_blend_image_dsc_t * dsc);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_DRAW_SW*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_SW_BLEND_TO_I1_H*/
@@ -0,0 +1,154 @@
+/**
+ * @file lv_blend_x86.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_blend_x86_private.h"
+
+#if LV_USE_DRAW_SW && LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+#if LV_BLEND_X86_AVAILABLE
+static lv_blend_x86_level_t supported_level;
+static lv_blend_x86_level_t level;
+static const lv_blend_x86_kernels_t * kernels;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+#if LV_BLEND_X86_AVAILABLE
+
+void lv_blend_x86_init(void)
+{
+    __builtin_cpu_init();
+    supported_level = LV_BLEND_X86_NONE;
+    if(__builtin_cpu_supports("sse2")) supported_level = LV_BLEND_X86_SSE2;
+    if(__builtin_cpu_supports("avx2")) supported_level = LV_BLEND_X86_AVX2;
+
+    lv_blend_x86_set_level(supported_level);
+}
+
+lv_blend_x86_level_t lv_blend_x86_get_level(void)
+{
+    return level;
+}
+
+lv_blend_x86_level_t lv_blend_x86_set_level(lv_blend_x86_level_t new_level)
+{
+    if(new_level > supported_level) new_level = supported_level;
+
+    level = new_level;
+    switch(level) {
+        case LV_BLEND_X86_AVX2:
+            kernels = &lv_blend_x86_kernels_avx2;
+            break;
+        case LV_BLEND_X86_SSE2:
+            kernels = &lv_blend_x86_kernels_sse2;
+            break;
+        default:
+            kernels = NULL;
+            break;
+    }
+
+    return level;
+}
+
+lv_result_t lv_color_blend_to_rgb565_x86(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    if(kernels == NULL) return LV_RESULT_INVALID;
+    kernels->color_to_rgb565(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb565_blend_normal_to_rgb565_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    /*A plain copy is a memcpy, nothing to win*/
+    if(kernels == NULL || (dsc->mask_buf == NULL && dsc->opa >= LV_OPA_MAX)) return LV_RESULT_INVALID;
+    kernels->rgb565_to_rgb565(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_rgb565_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(kernels == NULL) return LV_RESULT_INVALID;
+    kernels->argb8888_to_rgb565(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_rgb888_x86(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dst_px_size)
+{
+    if(kernels == NULL || dst_px_size != 4) return LV_RESULT_INVALID;
+    kernels->color_to_xrgb8888(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_rgb888_x86(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dst_px_size)
+{
+    if(kernels == NULL || dst_px_size != 4) return LV_RESULT_INVALID;
+    kernels->argb8888_to_xrgb8888(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_argb8888_x86(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    if(kernels == NULL) return LV_RESULT_INVALID;
+    kernels->color_to_argb8888(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_argb8888_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(kernels == NULL) return LV_RESULT_INVALID;
+    kernels->argb8888_to_argb8888(dsc);
+    return LV_RESULT_OK;
+}
+
+#else /*LV_BLEND_X86_AVAILABLE*/
+
+void lv_blend_x86_init(void)
+{
+}
+
+lv_blend_x86_level_t lv_blend_x86_get_level(void)
+{
+    return LV_BLEND_X86_NONE;
+}
+
+lv_blend_x86_level_t lv_blend_x86_set_level(lv_blend_x86_level_t new_level)
+{
+    LV_UNUSED(new_level);
+    return LV_BLEND_X86_NONE;
+}
+
+#endif /*LV_BLEND_X86_AVAILABLE*/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#endif /*LV_USE_DRAW_SW && LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86*/
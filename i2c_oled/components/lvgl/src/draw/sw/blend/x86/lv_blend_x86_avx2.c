@@ -0,0 +1,89 @@
+/**
+ * @file lv_blend_x86_avx2.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_blend_x86_private.h"
+
+#if LV_USE_DRAW_SW && LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86 && LV_BLEND_X86_AVAILABLE
+
+#include <immintrin.h>
+
+/*Only reached after the CPU was checked, so AVX2 is enabled for this file alone*/
+#if defined(__clang__)
+    #pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+#else
+    #pragma GCC push_options
+    #pragma GCC target("avx2")
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LV_BLEND_X86_KERNELS    lv_blend_x86_kernels_avx2
+
+#define V_PX16                  16
+#define V_PX32                  8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef __m256i vec_t;
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define V_LOADU(p)              _mm256_loadu_si256((const __m256i *)(const void *)(p))
+#define V_STOREU(p, v)          _mm256_storeu_si256((__m256i *)(void *)(p), v)
+#define V_ZERO                  _mm256_setzero_si256()
+#define V_SET1_16(v)            _mm256_set1_epi16((int16_t)(v))
+#define V_SET1_32(v)            _mm256_set1_epi32((int32_t)(v))
+
+#define V_AND(a, b)             _mm256_and_si256(a, b)
+#define V_OR(a, b)              _mm256_or_si256(a, b)
+#define V_ANDNOT(a, b)          _mm256_andnot_si256(a, b)
+#define V_MOVEMASK8(a)          _mm256_movemask_epi8(a)
+
+#define V_ADD16(a, b)           _mm256_add_epi16(a, b)
+#define V_SUB16(a, b)           _mm256_sub_epi16(a, b)
+#define V_MULLO16(a, b)         _mm256_mullo_epi16(a, b)
+#define V_MULHI16U(a, b)        _mm256_mulhi_epu16(a, b)
+#define V_SRLI16(a, n)          _mm256_srli_epi16(a, n)
+#define V_SRAI16(a, n)          _mm256_srai_epi16(a, n)
+#define V_SLLI16(a, n)          _mm256_slli_epi16(a, n)
+#define V_CMPEQ16(a, b)         _mm256_cmpeq_epi16(a, b)
+
+#define V_SRLI32(a, n)          _mm256_srli_epi32(a, n)
+#define V_SRAI32(a, n)          _mm256_srai_epi32(a, n)
+#define V_SLLI32(a, n)          _mm256_slli_epi32(a, n)
+#define V_CMPEQ32(a, b)         _mm256_cmpeq_epi32(a, b)
+#define V_CMPGT32(a, b)         _mm256_cmpgt_epi32(a, b)
+
+/*The unpacks and the byte pack work per 128 bit lane, which matches as long as they are paired*/
+#define V_UNPACKLO8(a, b)       _mm256_unpacklo_epi8(a, b)
+#define V_UNPACKHI8(a, b)       _mm256_unpackhi_epi8(a, b)
+#define V_UNPACKLO32(a, b)      _mm256_unpacklo_epi32(a, b)
+#define V_UNPACKHI32(a, b)      _mm256_unpackhi_epi32(a, b)
+#define V_PACKUS16(a, b)        _mm256_packus_epi16(a, b)
+/*The 32 to 16 bit pack crosses pixels between vectors, so the lanes are put back in order*/
+#define V_PACK32_16(a, b)       _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xD8)
+
+#define V_LOAD_MASK16(p)        _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(const void *)(p)))
+#define V_LOAD_MASK32(p)        _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(const void *)(p)))
+
+#include "lv_blend_x86_kernels.h"
+
+#if defined(__clang__)
+    #pragma clang attribute pop
+#else
+    #pragma GCC pop_options
+#endif
+
+#endif /*LV_USE_DRAW_SW && LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86 && LV_BLEND_X86_AVAILABLE*/
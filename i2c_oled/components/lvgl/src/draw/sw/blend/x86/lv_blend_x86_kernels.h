@@ -0,0 +1,458 @@
+/**
+ * @file lv_blend_x86_kernels.h
+ *
+ * Blend kernels written once against a small vector API and compiled once per instruction set.
+ * The including file defines `vec_t`, the `V_...` operations, `V_PX16`, `V_PX32` (pixels of
+ * 16 and 32 bit per vector) and `LV_BLEND_X86_KERNELS`, the name of the exported table.
+ * Pixels left over at the end of a row go through the scalar helpers of lv_blend_x86_private.h.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_blend_x86_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define RGB_MASK    0x00FFFFFF
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define V_SELECT(sel, a, b) V_OR(V_AND(sel, a), V_ANDNOT(sel, b))
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static inline uint32_t fill_mix(const lv_opa_t * mask, int32_t x, lv_opa_t opa)
+{
+    if(mask == NULL) return opa;
+    return opa < LV_OPA_MAX ? (uint32_t)LV_OPA_MIX2(mask[x], opa) : mask[x];
+}
+
+static inline uint32_t image_mix(uint32_t a, const lv_opa_t * mask, int32_t x, lv_opa_t opa)
+{
+    if(mask == NULL) return opa < LV_OPA_MAX ? (uint32_t)LV_OPA_MIX2(a, opa) : a;
+    return (uint32_t)(opa < LV_OPA_MAX ? LV_OPA_MIX3(a, mask[x], opa) : LV_OPA_MIX2(a, mask[x]));
+}
+
+/**
+ * Mix factors of a color fill in 16 bit lanes: `opa`, `mask[x]` or `LV_OPA_MIX2(mask[x], opa)`
+ */
+static inline vec_t fill_mix16(const lv_opa_t * mask, vec_t opa16, bool has_opa)
+{
+    if(mask == NULL) return opa16;
+    vec_t m = V_LOAD_MASK16(mask);
+    return has_opa ? V_SRLI16(V_MULLO16(m, opa16), 8) : m;
+}
+
+static inline vec_t fill_mix32(const lv_opa_t * mask, vec_t opa32, bool has_opa)
+{
+    if(mask == NULL) return opa32;
+    vec_t m = V_LOAD_MASK32(mask);
+    return has_opa ? V_SRLI32(V_MULLO16(m, opa32), 8) : m;
+}
+
+/**
+ * Mix factors of an image from its alpha `a` (0..255 per lane, 16 or 32 bit lanes alike):
+ * `a`, `LV_OPA_MIX2(a, opa)`, `LV_OPA_MIX2(a, mask[x])` or `LV_OPA_MIX3(a, mask[x], opa)`.
+ * The products fit the low 16 bits of each lane, so the 16 bit multiplies work for both widths.
+ */
+static inline vec_t image_mix16(vec_t a, const lv_opa_t * mask, vec_t opa16, bool has_opa)
+{
+    if(mask == NULL) return has_opa ? V_SRLI16(V_MULLO16(a, opa16), 8) : a;
+    vec_t t = V_MULLO16(a, V_LOAD_MASK16(mask));
+    return has_opa ? V_MULHI16U(t, opa16) : V_SRLI16(t, 8);
+}
+
+static inline vec_t image_mix32(vec_t a, const lv_opa_t * mask, vec_t opa32, bool has_opa)
+{
+    if(mask == NULL) return has_opa ? V_SRLI32(V_MULLO16(a, opa32), 8) : a;
+    vec_t t = V_MULLO16(a, V_LOAD_MASK32(mask));
+    return has_opa ? V_MULHI16U(t, opa32) : V_SRLI32(t, 8);
+}
+
+/**
+ * `lv_color_16_16_mix()` on 16 bit lanes
+ */
+static inline vec_t mix_16_16(vec_t fg, vec_t bg, vec_t mix)
+{
+    vec_t m = V_SRLI16(V_ADD16(mix, V_SET1_16(4)), 3);
+    vec_t mask6 = V_SET1_16(0x3F);
+    vec_t mask5 = V_SET1_16(0x1F);
+
+    vec_t fr = V_SRLI16(fg, 11);
+    vec_t br = V_SRLI16(bg, 11);
+    vec_t fg6 = V_AND(V_SRLI16(fg, 5), mask6);
+    vec_t bg6 = V_AND(V_SRLI16(bg, 5), mask6);
+    vec_t fb = V_AND(fg, mask5);
+    vec_t bb = V_AND(bg, mask5);
+
+    vec_t r = V_ADD16(br, V_SRAI16(V_MULLO16(V_SUB16(fr, br), m), 5));
+    vec_t g = V_ADD16(bg6, V_SRAI16(V_MULLO16(V_SUB16(fg6, bg6), m), 5));
+    vec_t b = V_ADD16(bb, V_SRAI16(V_MULLO16(V_SUB16(fb, bb), m), 5));
+
+    return V_OR(V_OR(V_SLLI16(r, 11), V_SLLI16(g, 5)), b);
+}
+
+/**
+ * `lv_color_24_16_mix()` on 16 bit lanes, `src` already truncated to RGB565
+ */
+static inline vec_t mix_24_16(vec_t src, vec_t bg, vec_t mix)
+{
+    vec_t inv = V_SUB16(V_SET1_16(255), mix);
+    vec_t mask6 = V_SET1_16(0x3F);
+    vec_t mask5 = V_SET1_16(0x1F);
+
+    vec_t r = V_ADD16(V_MULLO16(V_SRLI16(src, 11), mix), V_MULLO16(V_SRLI16(bg, 11), inv));
+    vec_t g = V_ADD16(V_MULLO16(V_AND(V_SRLI16(src, 5), mask6), mix),
+                      V_MULLO16(V_AND(V_SRLI16(bg, 5), mask6), inv));
+    vec_t b = V_ADD16(V_MULLO16(V_AND(src, mask5), mix), V_MULLO16(V_AND(bg, mask5), inv));
+
+    vec_t res = V_OR(V_OR(V_SLLI16(V_SRLI16(r, 8), 11), V_SLLI16(V_SRLI16(g, 8), 5)), V_SRLI16(b, 8));
+    res = V_SELECT(V_CMPEQ16(mix, V_SET1_16(255)), src, res);
+    return V_SELECT(V_CMPEQ16(mix, V_ZERO), bg, res);
+}
+
+/**
+ * `V_PX16` ARGB8888 pixels truncated to RGB565, and their alpha, in 16 bit lanes
+ */
+static inline vec_t argb8888_to_rgb565_lanes(const uint32_t * src, vec_t * alpha)
+{
+    vec_t p0 = V_LOADU(src);
+    vec_t p1 = V_LOADU(src + V_PX32);
+    *alpha = V_PACK32_16(V_SRLI32(p0, 24), V_SRLI32(p1, 24));
+
+    vec_t r = V_SET1_32(0xF800);
+    vec_t g = V_SET1_32(0x07E0);
+    vec_t b = V_SET1_32(0x001F);
+    vec_t c0 = V_OR(V_OR(V_AND(V_SRLI32(p0, 8), r), V_AND(V_SRLI32(p0, 5), g)), V_AND(V_SRLI32(p0, 3), b));
+    vec_t c1 = V_OR(V_OR(V_AND(V_SRLI32(p1, 8), r), V_AND(V_SRLI32(p1, 5), g)), V_AND(V_SRLI32(p1, 3), b));
+
+    /*Sign extend so that the saturating pack keeps all 16 bits*/
+    c0 = V_SRAI32(V_SLLI32(c0, 16), 16);
+    c1 = V_SRAI32(V_SLLI32(c1, 16), 16);
+    return V_PACK32_16(c0, c1);
+}
+
+/**
+ * `lv_color_24_24_mix()` on 32 bit pixels. `mix` is 0..255 per 32 bit lane, the alpha byte of `dest` is kept.
+ */
+static inline vec_t mix_24_24(vec_t src, vec_t dest, vec_t mix)
+{
+    vec_t zero = V_ZERO;
+    vec_t m = V_OR(mix, V_SLLI32(mix, 16));
+    vec_t inv = V_SUB16(V_SET1_16(255), m);
+
+    /*Unpacking the factors like the pixels keeps them on the right channels, also per 128 bit lane*/
+    vec_t lo = V_ADD16(V_MULLO16(V_UNPACKLO8(src, zero), V_UNPACKLO32(m, m)),
+                       V_MULLO16(V_UNPACKLO8(dest, zero), V_UNPACKLO32(inv, inv)));
+    vec_t hi = V_ADD16(V_MULLO16(V_UNPACKHI8(src, zero), V_UNPACKHI32(m, m)),
+                       V_MULLO16(V_UNPACKHI8(dest, zero), V_UNPACKHI32(inv, inv)));
+    vec_t res = V_PACKUS16(V_SRLI16(lo, 8), V_SRLI16(hi, 8));
+
+    vec_t rgb = V_SET1_32(RGB_MASK);
+    vec_t dest_a = V_ANDNOT(rgb, dest);
+    res = V_OR(V_AND(res, rgb), dest_a);
+    res = V_SELECT(V_CMPGT32(mix, V_SET1_32(LV_OPA_MAX - 1)), V_OR(V_AND(src, rgb), dest_a), res);
+    return V_SELECT(V_CMPEQ32(mix, zero), dest, res);
+}
+
+/**
+ * `lv_color_32_32_mix()` on 32 bit pixels, `fg` carrying its final alpha. Pixels where both
+ * colors are semi-transparent need a division; they are finished by the scalar helper.
+ */
+static inline void mix_32_32_store(uint32_t * dest, vec_t fg, vec_t bg)
+{
+    vec_t fa = V_SRLI32(fg, 24);
+    vec_t ba = V_SRLI32(bg, 24);
+    vec_t three = V_SET1_32(LV_OPA_MIN + 1);
+
+    vec_t res = mix_24_24(fg, bg, fa);
+    vec_t fg_sel = V_OR(V_CMPGT32(fa, V_SET1_32(LV_OPA_MAX - 1)), V_CMPGT32(three, ba));
+    vec_t bg_sel = V_CMPGT32(three, fa);
+    res = V_SELECT(bg_sel, bg, res);
+    res = V_SELECT(fg_sel, fg, res);
+    V_STOREU(dest, res);
+
+    vec_t easy = V_OR(V_OR(fg_sel, bg_sel), V_CMPEQ32(ba, V_SET1_32(255)));
+    uint32_t hard = ~(uint32_t)V_MOVEMASK8(easy) & ((1ULL << (V_PX32 * 4)) - 1);
+    if(hard) {
+        uint32_t fg_px[V_PX32];
+        uint32_t bg_px[V_PX32];
+        V_STOREU(fg_px, fg);
+        V_STOREU(bg_px, bg);
+        int32_t i;
+        for(i = 0; i < V_PX32; i++) {
+            if(hard & (1U << (i * 4))) dest[i] = lv_blend_x86_mix_32_32(fg_px[i], bg_px[i]);
+        }
+    }
+}
+
+static void color_to_rgb565(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint8_t * dest_row = dsc->dest_buf;
+    uint16_t color16 = lv_color_to_u16(dsc->color);
+    bool has_opa = opa < LV_OPA_MAX;
+
+    vec_t color = V_SET1_16(color16);
+    vec_t opa16 = V_SET1_16(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint16_t * dest = (uint16_t *)dest_row;
+        if(mask == NULL && !has_opa) {
+            for(x = 0; x <= w - V_PX16; x += V_PX16) {
+                V_STOREU(&dest[x], color);
+            }
+            for(; x < w; x++) {
+                dest[x] = color16;
+            }
+        }
+        else {
+            for(x = 0; x <= w - V_PX16; x += V_PX16) {
+                vec_t m = fill_mix16(mask ? &mask[x] : NULL, opa16, has_opa);
+                V_STOREU(&dest[x], mix_16_16(color, V_LOADU(&dest[x]), m));
+            }
+            for(; x < w; x++) {
+                dest[x] = lv_blend_x86_mix_16_16(color16, dest[x], fill_mix(mask, x, opa));
+            }
+        }
+        dest_row += dsc->dest_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+}
+
+static void rgb565_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint8_t * dest_row = dsc->dest_buf;
+    const uint8_t * src_row = dsc->src_buf;
+    bool has_opa = opa < LV_OPA_MAX;
+
+    vec_t opa16 = V_SET1_16(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint16_t * dest = (uint16_t *)dest_row;
+        const uint16_t * src = (const uint16_t *)src_row;
+        for(x = 0; x <= w - V_PX16; x += V_PX16) {
+            vec_t m = fill_mix16(mask ? &mask[x] : NULL, opa16, has_opa);
+            V_STOREU(&dest[x], mix_16_16(V_LOADU(&src[x]), V_LOADU(&dest[x]), m));
+        }
+        for(; x < w; x++) {
+            dest[x] = lv_blend_x86_mix_16_16(src[x], dest[x], fill_mix(mask, x, opa));
+        }
+        dest_row += dsc->dest_stride;
+        src_row += dsc->src_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+}
+
+static void argb8888_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint8_t * dest_row = dsc->dest_buf;
+    const uint8_t * src_row = dsc->src_buf;
+    bool has_opa = opa < LV_OPA_MAX;
+
+    vec_t opa16 = V_SET1_16(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint16_t * dest = (uint16_t *)dest_row;
+        const uint32_t * src = (const uint32_t *)src_row;
+        for(x = 0; x <= w - V_PX16; x += V_PX16) {
+            vec_t a;
+            vec_t c = argb8888_to_rgb565_lanes(&src[x], &a);
+            vec_t m = image_mix16(a, mask ? &mask[x] : NULL, opa16, has_opa);
+            V_STOREU(&dest[x], mix_24_16(c, V_LOADU(&dest[x]), m));
+        }
+        for(; x < w; x++) {
+            dest[x] = lv_blend_x86_mix_24_16(src[x], dest[x], image_mix(src[x] >> 24, mask, x, opa));
+        }
+        dest_row += dsc->dest_stride;
+        src_row += dsc->src_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+}
+
+static void color_to_xrgb8888(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint8_t * dest_row = dsc->dest_buf;
+    uint32_t color32 = lv_color_to_u32(dsc->color);
+    bool has_opa = opa < LV_OPA_MAX;
+
+    vec_t color = V_SET1_32(color32);
+    vec_t opa32 = V_SET1_32(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint32_t * dest = (uint32_t *)dest_row;
+        if(mask == NULL && !has_opa) {
+            for(x = 0; x <= w - V_PX32; x += V_PX32) {
+                V_STOREU(&dest[x], color);
+            }
+            for(; x < w; x++) {
+                dest[x] = color32;
+            }
+        }
+        else {
+            for(x = 0; x <= w - V_PX32; x += V_PX32) {
+                vec_t m = fill_mix32(mask ? &mask[x] : NULL, opa32, has_opa);
+                V_STOREU(&dest[x], mix_24_24(color, V_LOADU(&dest[x]), m));
+            }
+            for(; x < w; x++) {
+                dest[x] = lv_blend_x86_mix_24_24(color32, dest[x], fill_mix(mask, x, opa));
+            }
+        }
+        dest_row += dsc->dest_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+}
+
+static void argb8888_to_xrgb8888(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint8_t * dest_row = dsc->dest_buf;
+    const uint8_t * src_row = dsc->src_buf;
+    bool has_opa = opa < LV_OPA_MAX;
+
+    vec_t opa32 = V_SET1_32(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint32_t * dest = (uint32_t *)dest_row;
+        const uint32_t * src = (const uint32_t *)src_row;
+        for(x = 0; x <= w - V_PX32; x += V_PX32) {
+            vec_t s = V_LOADU(&src[x]);
+            vec_t m = image_mix32(V_SRLI32(s, 24), mask ? &mask[x] : NULL, opa32, has_opa);
+            V_STOREU(&dest[x], mix_24_24(s, V_LOADU(&dest[x]), m));
+        }
+        for(; x < w; x++) {
+            dest[x] = lv_blend_x86_mix_24_24(src[x], dest[x], image_mix(src[x] >> 24, mask, x, opa));
+        }
+        dest_row += dsc->dest_stride;
+        src_row += dsc->src_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+}
+
+static void color_to_argb8888(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint8_t * dest_row = dsc->dest_buf;
+    uint32_t color32 = lv_color_to_u32(dsc->color);
+    bool has_opa = opa < LV_OPA_MAX;
+
+    vec_t color = V_SET1_32(color32);
+    vec_t color_rgb = V_SET1_32(color32 & RGB_MASK);
+    vec_t opa32 = V_SET1_32(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint32_t * dest = (uint32_t *)dest_row;
+        if(mask == NULL && !has_opa) {
+            for(x = 0; x <= w - V_PX32; x += V_PX32) {
+                V_STOREU(&dest[x], color);
+            }
+            for(; x < w; x++) {
+                dest[x] = color32;
+            }
+        }
+        else {
+            for(x = 0; x <= w - V_PX32; x += V_PX32) {
+                vec_t fa = fill_mix32(mask ? &mask[x] : NULL, opa32, has_opa);
+                mix_32_32_store(&dest[x], V_OR(color_rgb, V_SLLI32(fa, 24)), V_LOADU(&dest[x]));
+            }
+            for(; x < w; x++) {
+                uint32_t fg = (color32 & RGB_MASK) | (fill_mix(mask, x, opa) << 24);
+                dest[x] = lv_blend_x86_mix_32_32(fg, dest[x]);
+            }
+        }
+        dest_row += dsc->dest_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+}
+
+static void argb8888_to_argb8888(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint8_t * dest_row = dsc->dest_buf;
+    const uint8_t * src_row = dsc->src_buf;
+    bool has_opa = opa < LV_OPA_MAX;
+
+    vec_t rgb = V_SET1_32(RGB_MASK);
+    vec_t opa32 = V_SET1_32(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint32_t * dest = (uint32_t *)dest_row;
+        const uint32_t * src = (const uint32_t *)src_row;
+        for(x = 0; x <= w - V_PX32; x += V_PX32) {
+            vec_t s = V_LOADU(&src[x]);
+            vec_t fa = image_mix32(V_SRLI32(s, 24), mask ? &mask[x] : NULL, opa32, has_opa);
+            mix_32_32_store(&dest[x], V_OR(V_AND(s, rgb), V_SLLI32(fa, 24)), V_LOADU(&dest[x]));
+        }
+        for(; x < w; x++) {
+            uint32_t fg = (src[x] & RGB_MASK) | (image_mix(src[x] >> 24, mask, x, opa) << 24);
+            dest[x] = lv_blend_x86_mix_32_32(fg, dest[x]);
+        }
+        dest_row += dsc->dest_stride;
+        src_row += dsc->src_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+}
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+const lv_blend_x86_kernels_t LV_BLEND_X86_KERNELS = {
+    .color_to_rgb565 = color_to_rgb565,
+    .rgb565_to_rgb565 = rgb565_to_rgb565,
+    .argb8888_to_rgb565 = argb8888_to_rgb565,
+    .color_to_xrgb8888 = color_to_xrgb8888,
+    .argb8888_to_xrgb8888 = argb8888_to_xrgb8888,
+    .color_to_argb8888 = color_to_argb8888,
+    .argb8888_to_argb8888 = argb8888_to_argb8888,
+};
@@ -0,0 +1,128 @@
+/**
+ * @file lv_blend_x86_private.h
+ *
+ */
+
+#ifndef LV_BLEND_X86_PRIVATE_H
+#define LV_BLEND_X86_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_blend_x86.h"
+
+#if LV_USE_DRAW_SW && LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86 && LV_BLEND_X86_AVAILABLE
+
+#include "../lv_draw_sw_blend_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * One set of kernels per instruction set. Every kernel handles all four variants
+ * (plain, opa, mask, mask + opa) and picks the variant from `mask_buf` and `opa`.
+ */
+typedef struct {
+    void (*color_to_rgb565)(lv_draw_sw_blend_fill_dsc_t * dsc);
+    void (*rgb565_to_rgb565)(lv_draw_sw_blend_image_dsc_t * dsc);      /**< Not for the plain copy*/
+    void (*argb8888_to_rgb565)(lv_draw_sw_blend_image_dsc_t * dsc);
+    void (*color_to_xrgb8888)(lv_draw_sw_blend_fill_dsc_t * dsc);
+    void (*argb8888_to_xrgb8888)(lv_draw_sw_blend_image_dsc_t * dsc);
+    void (*color_to_argb8888)(lv_draw_sw_blend_fill_dsc_t * dsc);
+    void (*argb8888_to_argb8888)(lv_draw_sw_blend_image_dsc_t * dsc);
+} lv_blend_x86_kernels_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+extern const lv_blend_x86_kernels_t lv_blend_x86_kernels_sse2;
+extern const lv_blend_x86_kernels_t lv_blend_x86_kernels_avx2;
+
+/**********************
+ *   INLINE FUNCTIONS
+ **********************/
+
+/*Scalar versions of the C mixing functions for the row tails, bit exact with the C path*/
+
+/**
+ * `lv_color_16_16_mix()`: `bg + (fg - bg) * ((mix + 4) >> 3) / 32` per channel, rounded down
+ */
+static inline uint16_t lv_blend_x86_mix_16_16(uint16_t fg, uint16_t bg, uint32_t mix)
+{
+    int32_t m = (int32_t)(mix + 4) >> 3;
+    int32_t r = (bg >> 11) + ((((int32_t)(fg >> 11) - (bg >> 11)) * m) >> 5);
+    int32_t g = ((bg >> 5) & 0x3F) + ((((int32_t)((fg >> 5) & 0x3F) - ((bg >> 5) & 0x3F)) * m) >> 5);
+    int32_t b = (bg & 0x1F) + ((((int32_t)(fg & 0x1F) - (bg & 0x1F)) * m) >> 5);
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+/**
+ * `lv_color_24_16_mix()` with the source as an ARGB8888 word
+ */
+static inline uint16_t lv_blend_x86_mix_24_16(uint32_t src, uint16_t bg, uint32_t mix)
+{
+    if(mix == 0) return bg;
+    uint32_t r = (src >> 19) & 0x1F;
+    uint32_t g = (src >> 10) & 0x3F;
+    uint32_t b = (src >> 3) & 0x1F;
+    if(mix == 255) return (uint16_t)((r << 11) | (g << 5) | b);
+
+    uint32_t inv = 255 - mix;
+    r = (r * mix + (bg >> 11) * inv) >> 8;
+    g = (g * mix + ((bg >> 5) & 0x3F) * inv) >> 8;
+    b = (b * mix + (bg & 0x1F) * inv) >> 8;
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+/**
+ * `lv_color_24_24_mix()` on a 4 byte destination. The byte of the alpha channel is kept.
+ */
+static inline uint32_t lv_blend_x86_mix_24_24(uint32_t src, uint32_t dest, uint32_t mix)
+{
+    if(mix == 0) return dest;
+    if(mix >= LV_OPA_MAX) return (src & 0x00FFFFFF) | (dest & 0xFF000000);
+
+    uint32_t inv = 255 - mix;
+    uint32_t res = dest & 0xFF000000;
+    uint32_t i;
+    for(i = 0; i < 24; i += 8) {
+        res |= ((((src >> i) & 0xFF) * mix + ((dest >> i) & 0xFF) * inv) >> 8) << i;
+    }
+    return res;
+}
+
+/**
+ * `lv_color_32_32_mix()` without the cache. `fg` already carries the final alpha.
+ */
+static inline uint32_t lv_blend_x86_mix_32_32(uint32_t fg, uint32_t bg)
+{
+    uint32_t fa = fg >> 24;
+    uint32_t ba = bg >> 24;
+    if(fa >= LV_OPA_MAX || ba <= LV_OPA_MIN) return fg;
+    if(fa <= LV_OPA_MIN) return bg;
+    if(ba == 255) return lv_blend_x86_mix_24_24(fg, bg, fa);
+
+    uint32_t res_a = 255 - LV_OPA_MIX2(255 - fa, 255 - ba);
+    uint32_t ratio = fa * 255 / res_a;
+    uint32_t res = ratio <= LV_OPA_MIN ? bg : lv_blend_x86_mix_24_24(fg, bg, ratio);
+    return (res & 0x00FFFFFF) | (res_a << 24);
+}
+
+#endif /*LV_USE_DRAW_SW && LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86 && LV_BLEND_X86_AVAILABLE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_BLEND_X86_PRIVATE_H*/
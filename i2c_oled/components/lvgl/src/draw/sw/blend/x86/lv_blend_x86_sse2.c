@@ -0,0 +1,95 @@
+/**
+ * @file lv_blend_x86_sse2.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_blend_x86_private.h"
+
+#if LV_USE_DRAW_SW && LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86 && LV_BLEND_X86_AVAILABLE
+
+#include <emmintrin.h>
+
+/*Only reached after the CPU was checked, so SSE2 is enabled for this file alone*/
+#if defined(__clang__)
+    #pragma clang attribute push (__attribute__((target("sse2"))), apply_to = function)
+#else
+    #pragma GCC push_options
+    #pragma GCC target("sse2")
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LV_BLEND_X86_KERNELS    lv_blend_x86_kernels_sse2
+
+#define V_PX16                  8
+#define V_PX32                  4
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef __m128i vec_t;
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define V_LOADU(p)              _mm_loadu_si128((const __m128i *)(const void *)(p))
+#define V_STOREU(p, v)          _mm_storeu_si128((__m128i *)(void *)(p), v)
+#define V_ZERO                  _mm_setzero_si128()
+#define V_SET1_16(v)            _mm_set1_epi16((int16_t)(v))
+#define V_SET1_32(v)            _mm_set1_epi32((int32_t)(v))
+
+#define V_AND(a, b)             _mm_and_si128(a, b)
+#define V_OR(a, b)              _mm_or_si128(a, b)
+#define V_ANDNOT(a, b)          _mm_andnot_si128(a, b)
+#define V_MOVEMASK8(a)          _mm_movemask_epi8(a)
+
+#define V_ADD16(a, b)           _mm_add_epi16(a, b)
+#define V_SUB16(a, b)           _mm_sub_epi16(a, b)
+#define V_MULLO16(a, b)         _mm_mullo_epi16(a, b)
+#define V_MULHI16U(a, b)        _mm_mulhi_epu16(a, b)
+#define V_SRLI16(a, n)          _mm_srli_epi16(a, n)
+#define V_SRAI16(a, n)          _mm_srai_epi16(a, n)
+#define V_SLLI16(a, n)          _mm_slli_epi16(a, n)
+#define V_CMPEQ16(a, b)         _mm_cmpeq_epi16(a, b)
+
+#define V_SRLI32(a, n)          _mm_srli_epi32(a, n)
+#define V_SRAI32(a, n)          _mm_srai_epi32(a, n)
+#define V_SLLI32(a, n)          _mm_slli_epi32(a, n)
+#define V_CMPEQ32(a, b)         _mm_cmpeq_epi32(a, b)
+#define V_CMPGT32(a, b)         _mm_cmpgt_epi32(a, b)
+
+#define V_UNPACKLO8(a, b)       _mm_unpacklo_epi8(a, b)
+#define V_UNPACKHI8(a, b)       _mm_unpackhi_epi8(a, b)
+#define V_UNPACKLO32(a, b)      _mm_unpacklo_epi32(a, b)
+#define V_UNPACKHI32(a, b)      _mm_unpackhi_epi32(a, b)
+#define V_PACKUS16(a, b)        _mm_packus_epi16(a, b)
+#define V_PACK32_16(a, b)       _mm_packs_epi32(a, b)
+
+#define V_LOAD_MASK16(p)        _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(const void *)(p)), V_ZERO)
+#define V_LOAD_MASK32(p)        load_mask32(p)
+
+static inline vec_t load_mask32(const lv_opa_t * p)
+{
+    /*Compilers merge this into one unaligned load*/
+    uint32_t m = p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+    vec_t v = _mm_unpacklo_epi8(_mm_cvtsi32_si128((int32_t)m), V_ZERO);
+    return _mm_unpacklo_epi16(v, V_ZERO);
+}
+
+#include "lv_blend_x86_kernels.h"
+
+#if defined(__clang__)
+    #pragma clang attribute pop
+#else
+    #pragma GCC pop_options
+#endif
+
+#endif /*LV_USE_DRAW_SW && LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86 && LV_BLEND_X86_AVAILABLE*/
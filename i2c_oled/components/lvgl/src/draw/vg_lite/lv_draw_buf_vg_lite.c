@@ -0,0 +1,58 @@
+/**
+ * @file lv_draw_buf_vg_lite.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_draw_vg_lite.h"
+
+#if LV_USE_DRAW_VG_LITE
+
+#include "../lv_draw_buf_private.h"
+#include "lv_vg_lite_utils.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static uint32_t width_to_stride(uint32_t w, lv_color_format_t color_format);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_buf_vg_lite_init_handlers(void)
+{
+    lv_draw_buf_handlers_t * handlers = lv_draw_buf_get_handlers();
+    handlers->width_to_stride_cb = width_to_stride;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint32_t width_to_stride(uint32_t w, lv_color_format_t color_format)
+{
+    return lv_vg_lite_width_to_stride(w, lv_vg_lite_vg_fmt(color_format));
+}
+
+#endif /*LV_USE_DRAW_VG_LITE*/
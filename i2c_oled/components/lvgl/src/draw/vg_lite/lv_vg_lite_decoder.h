@@ -0,0 +1,47 @@
+/**
+ * @file lv_vg_lite_decoder.h
+ *
+ */
+
+#ifndef LV_VG_LITE_DECODER_H
+#define LV_VG_LITE_DECODER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../lv_image_decoder.h"
+
+#if LV_USE_DRAW_VG_LITE
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+void lv_vg_lite_decoder_init(void);
+
+void lv_vg_lite_decoder_deinit(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_DRAW_VG_LITE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_VG_LITE_DECODER_H*/
@@ -0,0 +1,41 @@
+/**
+ * @file lv_nuttx_cache.h
+ *
+ */
+
+#ifndef LV_NUTTX_CACHE_H
+#define LV_NUTTX_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+void lv_nuttx_cache_init(void);
+
+void lv_nuttx_cache_deinit(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_NUTTX_CACHE_H*/
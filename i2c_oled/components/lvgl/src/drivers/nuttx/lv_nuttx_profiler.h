@@ -0,0 +1,39 @@
+/**
+ * @file lv_nuttx_profiler.h
+ *
+ */
+
+#ifndef LV_NUTTX_PROFILER_H
+#define LV_NUTTX_PROFILER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+void lv_nuttx_profiler_init(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_NUTTX_PROFILER_H*/
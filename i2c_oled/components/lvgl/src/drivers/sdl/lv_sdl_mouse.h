@@ -0,0 +1,43 @@
+/**
+ * @file lv_sdl_mouse.h
+ *
+ */
+
+#ifndef LV_SDL_MOUSE_H
+#define LV_SDL_MOUSE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_sdl_window.h"
+#if LV_USE_SDL
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+lv_indev_t * lv_sdl_mouse_create(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_SDL*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LV_SDL_MOUSE_H */
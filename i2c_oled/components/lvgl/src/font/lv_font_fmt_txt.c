@@ -0,0 +1,1132 @@
+/**
+ * @file lv_font_fmt_txt.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_font.h"
+#include "lv_font_fmt_txt_private.h"
+#include "../core/lv_global.h"
+#include "../misc/lv_assert.h"
+#include "../misc/lv_types.h"
+#include "../misc/lv_log.h"
+#include "../misc/lv_utils.h"
+#include "../stdlib/lv_mem.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    #define CACHE_NAME  "FONT_GLYPH"
+    #define glyph_cache_p LV_GLOBAL_DEFAULT()->font_fmt_txt_glyph_cache
+    #define font_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->font_draw_buf_handlers)
+#endif /*LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE*/
+
+#if LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE
+    #if (LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE & (LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE - 1)) || LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE < 32
+        #error "LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE must be a power of 2 and at least 32"
+    #endif
+    #define glyph_id_cache_p LV_GLOBAL_DEFAULT()->font_fmt_txt_glyph_id_cache
+    #define GLYPH_ID_MAX_LETTER     0x10FFFF    /*The tag of larger letters wouldn't fit into 16 bits*/
+#endif /*LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE*/
+
+#if LV_FONT_FMT_TXT_KERN_INDEX
+    #define kern_index_p LV_GLOBAL_DEFAULT()->font_fmt_txt_kern_index
+    #define KERN_INDEX_HASH_MUL     0x9E3779B1  /*2^32 / golden ratio spreads the consecutive keys well*/
+#endif /*LV_FONT_FMT_TXT_KERN_INDEX*/
+
+/*Generate the 256 entries of the bitmap expansion tables*/
+#define LUT_4(f, b)     f(b), f((b) + 1), f((b) + 2), f((b) + 3)
+#define LUT_16(f, b)    LUT_4(f, b), LUT_4(f, (b) + 4), LUT_4(f, (b) + 8), LUT_4(f, (b) + 12)
+#define LUT_64(f, b)    LUT_16(f, b), LUT_16(f, (b) + 16), LUT_16(f, (b) + 32), LUT_16(f, (b) + 48)
+#define LUT_256(f)      LUT_64(f, 0), LUT_64(f, 64), LUT_64(f, 128), LUT_64(f, 192)
+
+#define A1_PX4(b)   (((b) & 0x8 ? 0xFFU : 0) | ((b) & 0x4 ? 0xFF00U : 0) | \
+                     ((b) & 0x2 ? 0xFF0000U : 0) | ((b) & 0x1 ? 0xFF000000U : 0))
+#define A1_PX8(b)   {A1_PX4((b) >> 4), A1_PX4(b)}
+#define A2_PX(b, s) ((((b) >> (s)) & 0x3U) * 85U)
+#define A2_PX4(b)   (A2_PX(b, 6) | (A2_PX(b, 4) << 8) | (A2_PX(b, 2) << 16) | (A2_PX(b, 0) << 24))
+#define A4_PX2(b)   ((uint16_t)((((b) >> 4) & 0xFU) * 17U | (((b) & 0xFU) * 17U) << 8))
+
+/*The tables hold the pixels in little endian order, so whole words can be stored only on such systems*/
+#if LV_BIG_ENDIAN_SYSTEM
+    #define OUT_IS_ALIGNED(out, mask)   false
+#else
+    #define OUT_IS_ALIGNED(out, mask)   (((lv_uintptr_t)(out) & (mask)) == 0)
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint32_t gid_left;
+    uint32_t gid_right;
+} kern_pair_ref_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool decode_glyph(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                         uint8_t * bitmap_out);
+static void /* LV_ATTRIBUTE_FAST_MEM */ decode_plain_row(const uint8_t * in, uint32_t bit_ofs, uint8_t * out,
+                                                        int32_t w, uint8_t bpp);
+static inline uint8_t /* LV_ATTRIBUTE_FAST_MEM */ get_byte(const uint8_t * in, int32_t i, uint32_t shift);
+static inline void /* LV_ATTRIBUTE_FAST_MEM */ store_u32(uint8_t * buf, uint32_t v);
+static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
+static uint32_t find_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
+static bool has_kern_left(const lv_font_t * font, uint32_t gid_left);
+static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
+static int unicode_list_compare(const void * ref, const void * element);
+static int kern_pair_8_compare(const void * ref, const void * element);
+static int kern_pair_16_compare(const void * ref, const void * element);
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    static lv_draw_buf_t * glyph_cache_acquire(lv_font_glyph_dsc_t * g_dsc);
+    static bool glyph_cache_create_cb(lv_font_fmt_txt_glyph_cache_data_t * data, void * user_data);
+    static void glyph_cache_free_cb(lv_font_fmt_txt_glyph_cache_data_t * data, void * user_data);
+    static lv_cache_compare_res_t glyph_cache_compare_cb(const lv_font_fmt_txt_glyph_cache_data_t * lhs,
+                                                         const lv_font_fmt_txt_glyph_cache_data_t * rhs);
+    static uint32_t get_glyph_cnt(const lv_font_fmt_txt_dsc_t * fdsc);
+#endif /*LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE*/
+
+#if LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE
+    static lv_font_fmt_txt_glyph_id_table_t * glyph_id_cache_get_table(const lv_font_fmt_txt_dsc_t * fdsc);
+#endif /*LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE*/
+
+#if LV_FONT_FMT_TXT_KERN_INDEX
+    static const lv_font_fmt_txt_kern_index_t * kern_index_get(const lv_font_fmt_txt_dsc_t * fdsc);
+    static lv_font_fmt_txt_kern_index_t * kern_index_create(const lv_font_fmt_txt_dsc_t * fdsc);
+#endif /*LV_FONT_FMT_TXT_KERN_INDEX*/
+
+#if LV_USE_FONT_COMPRESSED
+    static void decompress(const uint8_t * in, uint8_t * out, int32_t w, int32_t h, uint8_t bpp, bool prefilter);
+    static inline void decompress_line(lv_font_fmt_rle_t * rle, uint8_t * out, int32_t w);
+    static inline uint8_t rle_get_bits(lv_font_fmt_rle_t * rle, uint8_t len);
+    static inline void rle_init(lv_font_fmt_rle_t * rle, const uint8_t * in,  uint8_t bpp, uint32_t px_cnt);
+    static inline uint8_t rle_next_run(lv_font_fmt_rle_t * rle);
+#endif /*LV_USE_FONT_COMPRESSED*/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+#if LV_USE_FONT_COMPRESSED
+static const uint8_t opa4_table[16] = {0,  17, 34,  51,
+                                       68, 85, 102, 119,
+                                       136, 153, 170, 187,
+                                       204, 221, 238, 255
+                                      };
+
+static const uint8_t opa3_table[8] = {0, 36, 73, 109, 146, 182, 218, 255};
+
+static const uint8_t opa2_table[4] = {0, 85, 170, 255};
+#endif
+
+/*Expand a byte of 1, 2 or 4 bpp pixels (MSB first) to 8, 4 or 2 A8 pixels at once.
+ *The first pixel is the lowest byte of the words as they are stored little endian.*/
+static const uint32_t a1_table[256][2] = {LUT_256(A1_PX8)};
+static const uint32_t a2_table[256] = {LUT_256(A2_PX4)};
+static const uint16_t a4_table[256] = {LUT_256(A4_PX2)};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t * draw_buf)
+{
+    const lv_font_t * font = g_dsc->resolved_font;
+
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    uint32_t gid = g_dsc->gid.index;
+    if(!gid) return NULL;
+
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+
+    int32_t gsize = (int32_t) gdsc->box_w * gdsc->box_h;
+    if(gsize == 0) return NULL;
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    lv_draw_buf_t * cached_buf = glyph_cache_acquire(g_dsc);
+    if(cached_buf) return cached_buf;
+#endif
+
+    if(decode_glyph(fdsc, gdsc, draw_buf->data) == false) return NULL;
+
+    return draw_buf;
+}
+
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
+                                   uint32_t unicode_letter_next)
+{
+    /*It fixes a strange compiler optimization issue: https://github.com/lvgl/lvgl/issues/4370*/
+    bool is_tab = unicode_letter == '\t';
+    if(is_tab) {
+        unicode_letter = ' ';
+    }
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
+    if(!gid) return false;
+
+    int8_t kvalue = 0;
+    if(fdsc->kern_dsc && has_kern_left(font, gid)) {
+        uint32_t gid_next = get_glyph_dsc_id(font, unicode_letter_next);
+        if(gid_next) {
+            kvalue = get_kern_value(font, gid, gid_next);
+        }
+    }
+
+    /*Put together a glyph dsc*/
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+
+    int32_t kv = ((int32_t)((int32_t)kvalue * fdsc->kern_scale) >> 4);
+
+    uint32_t adv_w = gdsc->adv_w;
+    if(is_tab) adv_w *= 2;
+
+    adv_w += kv;
+    adv_w  = (adv_w + (1 << 3)) >> 4;
+
+    dsc_out->adv_w = adv_w;
+    dsc_out->box_h = gdsc->box_h;
+    dsc_out->box_w = gdsc->box_w;
+    dsc_out->ofs_x = gdsc->ofs_x;
+    dsc_out->ofs_y = gdsc->ofs_y;
+    dsc_out->format = (uint8_t)fdsc->bpp;
+    dsc_out->is_placeholder = false;
+    dsc_out->gid.index = gid;
+    dsc_out->entry = NULL;
+
+    if(is_tab) dsc_out->box_w = dsc_out->box_w * 2;
+
+    return true;
+}
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+
+void lv_font_fmt_txt_glyph_cache_init(void)
+{
+    lv_font_fmt_txt_glyph_cache_t * glyph_cache = &glyph_cache_p;
+    if(glyph_cache->cache != NULL) return;
+
+    glyph_cache->cache = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(lv_font_fmt_txt_glyph_cache_data_t), LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) glyph_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) glyph_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) glyph_cache_free_cb
+    });
+    LV_ASSERT_MALLOC(glyph_cache->cache);
+    lv_cache_set_name(glyph_cache->cache, CACHE_NAME);
+
+    lv_mutex_init(&glyph_cache->lock);
+    glyph_cache->hit_cnt = 0;
+    glyph_cache->miss_cnt = 0;
+}
+
+void lv_font_fmt_txt_glyph_cache_deinit(void)
+{
+    lv_font_fmt_txt_glyph_cache_t * glyph_cache = &glyph_cache_p;
+    if(glyph_cache->cache == NULL) return;
+
+    lv_cache_destroy(glyph_cache->cache, NULL);
+    glyph_cache->cache = NULL;
+    lv_mutex_delete(&glyph_cache->lock);
+}
+
+void lv_font_fmt_txt_glyph_cache_release(lv_font_glyph_dsc_t * g_dsc)
+{
+    if(g_dsc->entry == NULL) return;
+
+    lv_cache_release(glyph_cache_p.cache, g_dsc->entry, NULL);
+    g_dsc->entry = NULL;
+}
+
+void lv_font_fmt_txt_glyph_cache_drop(const lv_font_t * font)
+{
+    lv_cache_t * cache = glyph_cache_p.cache;
+    if(cache == NULL) return;
+
+    if(font == NULL) {
+        lv_cache_drop_all(cache, NULL);
+        return;
+    }
+
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    if(fdsc == NULL || fdsc->cmaps == NULL) return;
+
+    lv_font_fmt_txt_glyph_cache_data_t search_key = {
+        .fdsc = fdsc,
+        .bpp = (uint8_t)fdsc->bpp,
+    };
+
+    uint32_t glyph_cnt = get_glyph_cnt(fdsc);
+    for(search_key.gid = 1; search_key.gid < glyph_cnt; search_key.gid++) {
+        lv_cache_drop(cache, &search_key, NULL);
+    }
+}
+
+void lv_font_fmt_txt_glyph_cache_get_stat(uint32_t * hit_cnt, uint32_t * miss_cnt)
+{
+    lv_font_fmt_txt_glyph_cache_t * glyph_cache = &glyph_cache_p;
+
+    lv_mutex_lock(&glyph_cache->lock);
+    if(hit_cnt) *hit_cnt = glyph_cache->hit_cnt;
+    if(miss_cnt) *miss_cnt = glyph_cache->miss_cnt;
+    lv_mutex_unlock(&glyph_cache->lock);
+}
+
+#endif /*LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE*/
+
+#if LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE
+
+void lv_font_fmt_txt_glyph_id_cache_init(void)
+{
+    lv_font_fmt_txt_glyph_id_cache_t * glyph_id_cache = &glyph_id_cache_p;
+    glyph_id_cache->tables = NULL;
+    glyph_id_cache->hit_cnt = 0;
+    glyph_id_cache->miss_cnt = 0;
+    lv_mutex_init(&glyph_id_cache->lock);
+}
+
+void lv_font_fmt_txt_glyph_id_cache_deinit(void)
+{
+    lv_font_fmt_txt_glyph_id_cache_drop(NULL);
+    lv_mutex_delete(&glyph_id_cache_p.lock);
+}
+
+void lv_font_fmt_txt_glyph_id_cache_drop(const lv_font_t * font)
+{
+    lv_font_fmt_txt_glyph_id_cache_t * glyph_id_cache = &glyph_id_cache_p;
+
+    lv_mutex_lock(&glyph_id_cache->lock);
+    lv_font_fmt_txt_glyph_id_table_t ** table_p = &glyph_id_cache->tables;
+    while(*table_p) {
+        lv_font_fmt_txt_glyph_id_table_t * table = *table_p;
+        if(font == NULL || table->fdsc == font->dsc) {
+            *table_p = table->next;
+            lv_free(table);
+        }
+        else {
+            table_p = &table->next;
+        }
+    }
+    lv_mutex_unlock(&glyph_id_cache->lock);
+}
+
+void lv_font_fmt_txt_glyph_id_cache_get_stat(uint32_t * hit_cnt, uint32_t * miss_cnt)
+{
+    lv_font_fmt_txt_glyph_id_cache_t * glyph_id_cache = &glyph_id_cache_p;
+
+    lv_mutex_lock(&glyph_id_cache->lock);
+    if(hit_cnt) *hit_cnt = glyph_id_cache->hit_cnt;
+    if(miss_cnt) *miss_cnt = glyph_id_cache->miss_cnt;
+    lv_mutex_unlock(&glyph_id_cache->lock);
+}
+
+#endif /*LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE*/
+
+#if LV_FONT_FMT_TXT_KERN_INDEX
+
+void lv_font_fmt_txt_kern_index_init(void)
+{
+    kern_index_p.indexes = NULL;
+    lv_mutex_init(&kern_index_p.lock);
+}
+
+void lv_font_fmt_txt_kern_index_deinit(void)
+{
+    lv_font_fmt_txt_kern_index_drop(NULL);
+    lv_mutex_delete(&kern_index_p.lock);
+}
+
+void lv_font_fmt_txt_kern_index_create(const lv_font_t * font)
+{
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    if(fdsc->kern_dsc == NULL || fdsc->kern_classes) return;
+
+    kern_index_get(fdsc);
+}
+
+void lv_font_fmt_txt_kern_index_drop(const lv_font_t * font)
+{
+    lv_font_fmt_txt_kern_index_cache_t * kern_index = &kern_index_p;
+
+    lv_mutex_lock(&kern_index->lock);
+    lv_font_fmt_txt_kern_index_t ** index_p = &kern_index->indexes;
+    while(*index_p) {
+        lv_font_fmt_txt_kern_index_t * index = *index_p;
+        if(font == NULL || index->fdsc == font->dsc) {
+            *index_p = index->next;
+            lv_free(index);
+        }
+        else {
+            index_p = &index->next;
+        }
+    }
+    lv_mutex_unlock(&kern_index->lock);
+}
+
+#endif /*LV_FONT_FMT_TXT_KERN_INDEX*/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Convert the bitmap of a glyph to A8
+ * @param fdsc          the font's descriptor
+ * @param gdsc          the glyph's descriptor
+ * @param bitmap_out    buffer to store the result with the stride of `gdsc->box_w` A8 pixels
+ * @return true: the bitmap is converted; false: the font's bitmap format is not supported
+ */
+static bool decode_glyph(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                         uint8_t * bitmap_out)
+{
+    if(fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN) {
+        /*The rows are not padded, so a row starts on any bit of the bitmap*/
+        const uint8_t * bitmap_in = &fdsc->glyph_bitmap[gdsc->bitmap_index];
+        uint32_t stride = lv_draw_buf_width_to_stride(gdsc->box_w, LV_COLOR_FORMAT_A8);
+        uint32_t row_bits = (uint32_t)gdsc->box_w * fdsc->bpp;
+        int32_t y;
+
+        if(fdsc->bpp == 1 || fdsc->bpp == 2 || fdsc->bpp == 4) {
+            for(y = 0; y < gdsc->box_h; y++) {
+                decode_plain_row(bitmap_in, y * row_bits, bitmap_out, gdsc->box_w, (uint8_t)fdsc->bpp);
+                bitmap_out += stride;
+            }
+        }
+        return true;
+    }
+    /*Handle compressed bitmap*/
+    else {
+#if LV_USE_FONT_COMPRESSED
+        bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED;
+        decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], bitmap_out, gdsc->box_w, gdsc->box_h,
+                   (uint8_t)fdsc->bpp, prefilter);
+        return true;
+#else /*!LV_USE_FONT_COMPRESSED*/
+        LV_LOG_WARN("Compressed fonts is used but LV_USE_FONT_COMPRESSED is not enabled in lv_conf.h");
+        return false;
+#endif
+    }
+
+    /*If not returned earlier then the letter is not found in this font*/
+    return false;
+}
+
+
+/**
+ * Convert a row of `w` 1, 2 or 4 bpp pixels starting at the bit `bit_ofs` of `in` to A8.
+ * Each whole source byte is expanded by a table lookup and written as 32 or 16-bit words
+ * (byte by byte if `out` is not aligned or the system is big endian), only the last partial byte
+ * is copied pixel by pixel.
+ */
+static void LV_ATTRIBUTE_FAST_MEM decode_plain_row(const uint8_t * in, uint32_t bit_ofs, uint8_t * out, int32_t w,
+                                                   uint8_t bpp)
+{
+    in += bit_ofs >> 3;
+    uint32_t shift = bit_ofs & 0x7;
+    int32_t px_per_byte_log2 = bpp == 1 ? 3 : (bpp == 2 ? 2 : 1);
+    int32_t byte_cnt = w >> px_per_byte_log2;
+    int32_t i;
+
+    if(bpp == 1) {
+        if(OUT_IS_ALIGNED(out, 0x3)) {
+            uint32_t * out32 = (uint32_t *)out;
+            for(i = 0; i < byte_cnt; i++) {
+                const uint32_t * px = a1_table[get_byte(in, i, shift)];
+                out32[2 * i] = px[0];
+                out32[2 * i + 1] = px[1];
+            }
+        }
+        else {
+            for(i = 0; i < byte_cnt; i++) {
+                const uint32_t * px = a1_table[get_byte(in, i, shift)];
+                store_u32(&out[8 * i], px[0]);
+                store_u32(&out[8 * i + 4], px[1]);
+            }
+        }
+    }
+    else if(bpp == 2) {
+        if(OUT_IS_ALIGNED(out, 0x3)) {
+            uint32_t * out32 = (uint32_t *)out;
+            for(i = 0; i < byte_cnt; i++) out32[i] = a2_table[get_byte(in, i, shift)];
+        }
+        else {
+            for(i = 0; i < byte_cnt; i++) store_u32(&out[4 * i], a2_table[get_byte(in, i, shift)]);
+        }
+    }
+    else {
+        if(OUT_IS_ALIGNED(out, 0x1)) {
+            uint16_t * out16 = (uint16_t *)out;
+            for(i = 0; i < byte_cnt; i++) out16[i] = a4_table[get_byte(in, i, shift)];
+        }
+        else {
+            for(i = 0; i < byte_cnt; i++) {
+                uint16_t px = a4_table[get_byte(in, i, shift)];
+                out[2 * i] = (uint8_t)px;
+                out[2 * i + 1] = (uint8_t)(px >> 8);
+            }
+        }
+    }
+
+    /*The remaining pixels don't fill a byte. Don't read the next byte if not needed,
+     *it can be past the end of the bitmap.*/
+    int32_t rest = w - (byte_cnt << px_per_byte_log2);
+    if(rest == 0) return;
+
+    uint8_t b = (uint8_t)(in[byte_cnt] << shift);
+    if(shift + rest * bpp > 8) b |= in[byte_cnt + 1] >> (8 - shift);
+
+    uint8_t px[8];
+    if(bpp == 1) {
+        store_u32(&px[0], a1_table[b][0]);
+        store_u32(&px[4], a1_table[b][1]);
+    }
+    else if(bpp == 2) {
+        store_u32(px, a2_table[b]);
+    }
+    else {
+        px[0] = (uint8_t)a4_table[b];
+    }
+
+    out += byte_cnt << px_per_byte_log2;
+    for(i = 0; i < rest; i++) out[i] = px[i];
+}
+
+/**
+ * Get the `i`th byte of a bitmap shifted left by `shift` bits (0..7)
+ */
+static inline uint8_t LV_ATTRIBUTE_FAST_MEM get_byte(const uint8_t * in, int32_t i, uint32_t shift)
+{
+    if(shift == 0) return in[i];
+    return (uint8_t)((in[i] << shift) | (in[i + 1] >> (8 - shift)));
+}
+
+static inline void LV_ATTRIBUTE_FAST_MEM store_u32(uint8_t * buf, uint32_t v)
+{
+    /*Compilers merge this into one store where unaligned access is allowed*/
+    buf[0] = (uint8_t)v;
+    buf[1] = (uint8_t)(v >> 8);
+    buf[2] = (uint8_t)(v >> 16);
+    buf[3] = (uint8_t)(v >> 24);
+}
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+
+/**
+ * Get the decoded bitmap of a glyph from the glyph cache, and decode and add it if it's not cached yet.
+ * The entry is stored in `g_dsc->entry` and it stays valid until `lv_font_fmt_txt_glyph_cache_release()`
+ * even if another draw unit evicts or drops it in the meantime.
+ * @param g_dsc     the glyph descriptor
+ * @return          the cached A8 bitmap, or NULL if it doesn't fit into the cache
+ */
+static lv_draw_buf_t * glyph_cache_acquire(lv_font_glyph_dsc_t * g_dsc)
+{
+    lv_font_fmt_txt_glyph_cache_t * glyph_cache = &glyph_cache_p;
+    const lv_font_fmt_txt_dsc_t * fdsc = g_dsc->resolved_font->dsc;
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[g_dsc->gid.index];
+
+    lv_font_fmt_txt_glyph_cache_data_t search_key = {
+        .fdsc = fdsc,
+        .gid = g_dsc->gid.index,
+        .bpp = (uint8_t)fdsc->bpp,
+    };
+    search_key.slot.size = lv_draw_buf_width_to_stride(gdsc->box_w, LV_COLOR_FORMAT_A8) * gdsc->box_h;
+
+    /*The cache is locked while a missing glyph is decoded in `glyph_cache_create_cb()`,
+     *so the same glyph is never added twice by parallel draw units*/
+    lv_cache_entry_t * entry = lv_cache_acquire(glyph_cache->cache, &search_key, NULL);
+    bool hit = entry != NULL;
+    if(!hit) entry = lv_cache_acquire_or_create(glyph_cache->cache, &search_key, NULL);
+
+    lv_mutex_lock(&glyph_cache->lock);
+    if(hit) glyph_cache->hit_cnt++;
+    else glyph_cache->miss_cnt++;
+    lv_mutex_unlock(&glyph_cache->lock);
+
+    if(entry == NULL) return NULL;
+
+    g_dsc->entry = entry;
+    lv_font_fmt_txt_glyph_cache_data_t * data = lv_cache_entry_get_data(entry);
+    return data->draw_buf;
+}
+
+static bool glyph_cache_create_cb(lv_font_fmt_txt_glyph_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    const lv_font_fmt_txt_dsc_t * fdsc = data->fdsc;
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[data->gid];
+
+    data->draw_buf = lv_draw_buf_create_ex(font_draw_buf_handlers, gdsc->box_w, gdsc->box_h, LV_COLOR_FORMAT_A8,
+                                           LV_STRIDE_AUTO);
+    if(data->draw_buf == NULL) return false;
+
+    if(decode_glyph(fdsc, gdsc, data->draw_buf->data) == false) {
+        lv_draw_buf_destroy(data->draw_buf);
+        data->draw_buf = NULL;
+        return false;
+    }
+
+    return true;
+}
+
+static void glyph_cache_free_cb(lv_font_fmt_txt_glyph_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_draw_buf_destroy(data->draw_buf);
+}
+
+static lv_cache_compare_res_t glyph_cache_compare_cb(const lv_font_fmt_txt_glyph_cache_data_t * lhs,
+                                                     const lv_font_fmt_txt_glyph_cache_data_t * rhs)
+{
+    if(lhs->fdsc != rhs->fdsc) {
+        return lhs->fdsc > rhs->fdsc ? 1 : -1;
+    }
+    if(lhs->gid != rhs->gid) {
+        return lhs->gid > rhs->gid ? 1 : -1;
+    }
+    if(lhs->bpp != rhs->bpp) {
+        return lhs->bpp > rhs->bpp ? 1 : -1;
+    }
+    return 0;
+}
+
+/**
+ * Get the number of glyph descriptors referenced by the character maps of a font
+ * @param fdsc      the font's descriptor
+ * @return          the largest glyph id + 1
+ */
+static uint32_t get_glyph_cnt(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    uint32_t glyph_cnt = 0;
+    uint16_t i;
+    for(i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[i];
+        uint32_t last_ofs = 0;
+        uint32_t j;
+        if(cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
+            last_ofs = cmap->range_length ? cmap->range_length - 1 : 0;
+        }
+        else if(cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL && cmap->glyph_id_ofs_list) {
+            const uint8_t * gid_ofs_8 = cmap->glyph_id_ofs_list;
+            for(j = 0; j < cmap->range_length; j++) last_ofs = LV_MAX(last_ofs, gid_ofs_8[j]);
+        }
+        else if(cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) {
+            last_ofs = cmap->list_length ? cmap->list_length - 1 : 0;
+        }
+        else if(cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL && cmap->glyph_id_ofs_list) {
+            const uint16_t * gid_ofs_16 = cmap->glyph_id_ofs_list;
+            for(j = 0; j < cmap->list_length; j++) last_ofs = LV_MAX(last_ofs, gid_ofs_16[j]);
+        }
+
+        glyph_cnt = LV_MAX(glyph_cnt, cmap->glyph_id_start + last_ofs + 1);
+    }
+
+    return glyph_cnt;
+}
+
+#endif /*LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE*/
+
+static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
+{
+    if(letter == '\0') return 0;
+
+#if LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE
+    if(letter <= GLYPH_ID_MAX_LETTER) {
+        lv_font_fmt_txt_glyph_id_cache_t * glyph_id_cache = &glyph_id_cache_p;
+        lv_mutex_lock(&glyph_id_cache->lock);
+        lv_font_fmt_txt_glyph_id_table_t * table = glyph_id_cache_get_table(font->dsc);
+        if(table) {
+            /*The missing letters are cached too (with 0 glyph ID) as they are searched in the fallback fonts every time*/
+            uint32_t * entry = &table->entries[letter % LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE];
+            uint32_t tag = (letter / LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE + 1) << 16;
+            uint32_t glyph_id;
+            if((*entry & 0xFFFF0000) == tag) {
+                glyph_id_cache->hit_cnt++;
+                glyph_id = *entry & 0xFFFF;
+            }
+            else {
+                glyph_id_cache->miss_cnt++;
+                glyph_id = find_glyph_dsc_id(font, letter);
+                if(glyph_id <= 0xFFFF) *entry = tag | glyph_id;
+            }
+            lv_mutex_unlock(&glyph_id_cache->lock);
+            return glyph_id;
+        }
+        lv_mutex_unlock(&glyph_id_cache->lock);
+    }
+#endif
+
+    return find_glyph_dsc_id(font, letter);
+}
+
+/**
+ * Search the glyph ID of a letter in the character maps of a font
+ * @param font      pointer to a font
+ * @param letter    a UNICODE letter (not 0)
+ * @return the glyph ID or 0 if the font has no glyph for the letter
+ */
+static uint32_t find_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
+{
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+
+    uint16_t i;
+    for(i = 0; i < fdsc->cmap_num; i++) {
+
+        /*Relative code point*/
+        uint32_t rcp = letter - fdsc->cmaps[i].range_start;
+        if(rcp >= fdsc->cmaps[i].range_length) continue;
+        uint32_t glyph_id = 0;
+        if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
+            glyph_id = fdsc->cmaps[i].glyph_id_start + rcp;
+        }
+        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
+            const uint8_t * gid_ofs_8 = fdsc->cmaps[i].glyph_id_ofs_list;
+            glyph_id = fdsc->cmaps[i].glyph_id_start + gid_ofs_8[rcp];
+        }
+        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) {
+            uint16_t key = rcp;
+            uint16_t * p = lv_utils_bsearch(&key, fdsc->cmaps[i].unicode_list, fdsc->cmaps[i].list_length,
+                                            sizeof(fdsc->cmaps[i].unicode_list[0]), unicode_list_compare);
+
+            if(p) {
+                lv_uintptr_t ofs = p - fdsc->cmaps[i].unicode_list;
+                glyph_id = fdsc->cmaps[i].glyph_id_start + (uint32_t) ofs;
+            }
+        }
+        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
+            uint16_t key = rcp;
+            uint16_t * p = lv_utils_bsearch(&key, fdsc->cmaps[i].unicode_list, fdsc->cmaps[i].list_length,
+                                            sizeof(fdsc->cmaps[i].unicode_list[0]), unicode_list_compare);
+
+            if(p) {
+                lv_uintptr_t ofs = p - fdsc->cmaps[i].unicode_list;
+                const uint16_t * gid_ofs_16 = fdsc->cmaps[i].glyph_id_ofs_list;
+                glyph_id = fdsc->cmaps[i].glyph_id_start + gid_ofs_16[ofs];
+            }
+        }
+
+        return glyph_id;
+    }
+
+    return 0;
+
+}
+
+#if LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE
+
+/**
+ * Get the letter -> glyph ID table of a font and create it when the font is first used.
+ * The cache must be locked.
+ * @param fdsc      the font's descriptor
+ * @return the table of the font or NULL if it couldn't be allocated
+ */
+static lv_font_fmt_txt_glyph_id_table_t * glyph_id_cache_get_table(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    lv_font_fmt_txt_glyph_id_cache_t * glyph_id_cache = &glyph_id_cache_p;
+    lv_font_fmt_txt_glyph_id_table_t * table;
+    for(table = glyph_id_cache->tables; table; table = table->next) {
+        if(table->fdsc == fdsc) return table;
+    }
+
+    table = lv_malloc_zeroed(sizeof(lv_font_fmt_txt_glyph_id_table_t));
+    if(table == NULL) {
+        LV_LOG_WARN("Couldn't allocate the glyph ID table of a font");
+        return NULL;
+    }
+
+    table->fdsc = fdsc;
+    table->next = glyph_id_cache->tables;
+    glyph_id_cache->tables = table;
+    return table;
+}
+
+#endif /*LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE*/
+
+#if LV_FONT_FMT_TXT_KERN_INDEX
+
+/**
+ * Get the kerning index of a font and build it when the kerning of the font is first used.
+ * Only the list of the indexes is locked. An index is not changed after it's built and
+ * it's freed only before its font, so it can be used without locking.
+ * @param fdsc      descriptor of a font with kerning pairs
+ * @return the index of the font or NULL if it couldn't be allocated
+ */
+static const lv_font_fmt_txt_kern_index_t * kern_index_get(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    lv_font_fmt_txt_kern_index_cache_t * kern_index = &kern_index_p;
+    lv_font_fmt_txt_kern_index_t * index;
+
+    lv_mutex_lock(&kern_index->lock);
+    for(index = kern_index->indexes; index; index = index->next) {
+        if(index->fdsc == fdsc) break;
+    }
+
+    if(index == NULL) {
+        index = kern_index_create(fdsc);
+        if(index) {
+            index->next = kern_index->indexes;
+            kern_index->indexes = index;
+        }
+        else {
+            LV_LOG_WARN("Couldn't allocate the kerning index of a font");
+        }
+    }
+    lv_mutex_unlock(&kern_index->lock);
+
+    return index;
+}
+
+/**
+ * Put the kerning pairs of a font into a hash table and mark their left glyphs in a bitmap
+ * @param fdsc      descriptor of a font with kerning pairs
+ * @return the new index or NULL if it couldn't be allocated
+ */
+static lv_font_fmt_txt_kern_index_t * kern_index_create(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    const lv_font_fmt_txt_kern_pair_t * kdsc = fdsc->kern_dsc;
+    const uint8_t * g_ids_8 = kdsc->glyph_ids;
+    const uint16_t * g_ids_16 = kdsc->glyph_ids;
+    uint32_t pair_cnt = kdsc->pair_cnt;
+
+    /*Keep the table at most half full so that a search ends after 1-2 slots on average*/
+    uint32_t slot_cnt_log2 = 1;
+    while(((uint32_t)1 << slot_cnt_log2) < pair_cnt * 2) slot_cnt_log2++;
+    uint32_t slot_cnt = (uint32_t)1 << slot_cnt_log2;
+
+    uint32_t left_gid_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < pair_cnt; i++) {
+        uint32_t gid_left = kdsc->glyph_ids_size == 0 ? g_ids_8[i * 2] : g_ids_16[i * 2];
+        left_gid_cnt = LV_MAX(left_gid_cnt, gid_left + 1);
+    }
+
+    /*The struct, the keys, the values and the bitmap in one block*/
+    uint32_t bitmap_size = (left_gid_cnt + 7) >> 3;
+    lv_font_fmt_txt_kern_index_t * index = lv_malloc_zeroed(sizeof(lv_font_fmt_txt_kern_index_t) +
+                                                            slot_cnt * (sizeof(uint32_t) + sizeof(int8_t)) + bitmap_size);
+    if(index == NULL) return NULL;
+
+    uint32_t * keys = (uint32_t *)(index + 1);
+    int8_t * values = (int8_t *)(keys + slot_cnt);
+    uint8_t * left_bitmap = (uint8_t *)(values + slot_cnt);
+    index->fdsc = fdsc;
+    index->keys = keys;
+    index->values = values;
+    index->left_bitmap = left_bitmap;
+    index->left_gid_cnt = left_gid_cnt;
+    index->slot_mask = slot_cnt - 1;
+    index->hash_shift = (uint8_t)(32 - slot_cnt_log2);
+
+    for(i = 0; i < pair_cnt; i++) {
+        uint32_t gid_left = kdsc->glyph_ids_size == 0 ? g_ids_8[i * 2] : g_ids_16[i * 2];
+        uint32_t gid_right = kdsc->glyph_ids_size == 0 ? g_ids_8[i * 2 + 1] : g_ids_16[i * 2 + 1];
+        /*0 is not a valid glyph ID so it's never looked up, and it would look like an empty slot*/
+        if(gid_left == 0 || gid_right == 0) continue;
+
+        uint32_t key = gid_left << 16 | gid_right;
+        uint32_t slot = (key * KERN_INDEX_HASH_MUL) >> index->hash_shift;
+        while(keys[slot] != 0 && keys[slot] != key) slot = (slot + 1) & index->slot_mask;
+        if(keys[slot] == 0) {
+            keys[slot] = key;
+            values[slot] = kdsc->values[i];
+        }
+        left_bitmap[gid_left >> 3] |= (uint8_t)(1 << (gid_left & 0x7));
+    }
+
+    return index;
+}
+
+#endif /*LV_FONT_FMT_TXT_KERN_INDEX*/
+
+/**
+ * Check if a glyph can be the left glyph of a kerning pair. If not, the glyph ID of the next
+ * letter doesn't need to be looked up.
+ * @param font      pointer to a font with kerning
+ * @param gid_left  glyph ID of the left glyph
+ * @return false: the glyph has no kerning with any glyph; true: it might have
+ */
+static bool has_kern_left(const lv_font_t * font, uint32_t gid_left)
+{
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+
+    if(fdsc->kern_classes) {
+        const lv_font_fmt_txt_kern_classes_t * kdsc = fdsc->kern_dsc;
+        return kdsc->left_class_mapping[gid_left] != 0;
+    }
+
+#if LV_FONT_FMT_TXT_KERN_INDEX
+    const lv_font_fmt_txt_kern_index_t * index = kern_index_get(fdsc);
+    if(index) {
+        return gid_left < index->left_gid_cnt && (index->left_bitmap[gid_left >> 3] & (1 << (gid_left & 0x7)));
+    }
+#endif
+
+    return true;
+}
+
+static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right)
+{
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+
+    int8_t value = 0;
+
+    if(fdsc->kern_classes == 0) {
+        /*Kern pairs*/
+        const lv_font_fmt_txt_kern_pair_t * kdsc = fdsc->kern_dsc;
+#if LV_FONT_FMT_TXT_KERN_INDEX
+        const lv_font_fmt_txt_kern_index_t * index = kern_index_get(fdsc);
+        if(index) {
+            /*The glyph IDs of the pairs are at most 16 bit*/
+            if(gid_left > 0xFFFF || gid_right > 0xFFFF) return 0;
+
+            uint32_t key = gid_left << 16 | gid_right;
+            uint32_t slot = (key * KERN_INDEX_HASH_MUL) >> index->hash_shift;
+            while(index->keys[slot] != 0) {
+                if(index->keys[slot] == key) return index->values[slot];
+                slot = (slot + 1) & index->slot_mask;
+            }
+            return 0;
+        }
+#endif
+        if(kdsc->glyph_ids_size == 0) {
+            /*Use binary search to find the kern value.
+             *The pairs are ordered left_id first, then right_id secondly.*/
+            const uint16_t * g_ids = kdsc->glyph_ids;
+            kern_pair_ref_t g_id_both = {gid_left, gid_right};
+            uint16_t * kid_p = lv_utils_bsearch(&g_id_both, g_ids, kdsc->pair_cnt, 2, kern_pair_8_compare);
+
+            /*If the `g_id_both` were found get its index from the pointer*/
+            if(kid_p) {
+                lv_uintptr_t ofs = kid_p - g_ids;
+                value = kdsc->values[ofs];
+            }
+        }
+        else if(kdsc->glyph_ids_size == 1) {
+            /*Use binary search to find the kern value.
+             *The pairs are ordered left_id first, then right_id secondly.*/
+            const uint32_t * g_ids = kdsc->glyph_ids;
+            kern_pair_ref_t g_id_both = {gid_left, gid_right};
+            uint32_t * kid_p = lv_utils_bsearch(&g_id_both, g_ids, kdsc->pair_cnt, 4, kern_pair_16_compare);
+
+            /*If the `g_id_both` were found get its index from the pointer*/
+            if(kid_p) {
+                lv_uintptr_t ofs = kid_p - g_ids;
+                value = kdsc->values[ofs];
+            }
+
+        }
+        else {
+            /*Invalid value*/
+        }
+    }
+    else {
+        /*Kern classes*/
+        const lv_font_fmt_txt_kern_classes_t * kdsc = fdsc->kern_dsc;
+        uint8_t left_class = kdsc->left_class_mapping[gid_left];
+        uint8_t right_class = kdsc->right_class_mapping[gid_right];
+
+        /*If class = 0, kerning not exist for that glyph
+         *else got the value form `class_pair_values` 2D array*/
+        if(left_class > 0 && right_class > 0) {
+            value = kdsc->class_pair_values[(left_class - 1) * kdsc->right_class_cnt + (right_class - 1)];
+        }
+
+    }
+    return value;
+}
+
+static int kern_pair_8_compare(const void * ref, const void * element)
+{
+    const kern_pair_ref_t * ref8_p = ref;
+    const uint8_t * element8_p = element;
+
+    /*If the MSB is different it will matter. If not return the diff. of the LSB*/
+    if(ref8_p->gid_left != element8_p[0]) return ref8_p->gid_left - element8_p[0];
+    else return ref8_p->gid_right - element8_p[1];
+}
+
+static int kern_pair_16_compare(const void * ref, const void * element)
+{
+    const kern_pair_ref_t * ref16_p = ref;
+    const uint16_t * element16_p = element;
+
+    /*If the MSB is different it will matter. If not return the diff. of the LSB*/
+    if(ref16_p->gid_left != element16_p[0]) return ref16_p->gid_left - element16_p[0];
+    else return ref16_p->gid_right - element16_p[1];
+}
+
+#if LV_USE_FONT_COMPRESSED
+
+/**
+ * The compress a glyph's bitmap
+ * @param in the compressed bitmap
+ * @param out buffer to store the result
+ * @param px_num number of pixels in the glyph (width * height)
+ * @param bpp bit per pixel (bpp = 3 will be converted to bpp = 4)
+ * @param prefilter true: the lines are XORed
+ */
+static void decompress(const uint8_t * in, uint8_t * out, int32_t w, int32_t h, uint8_t bpp, bool prefilter)
+{
+    const lv_opa_t * opa_table;
+    switch(bpp) {
+        case 2:
+            opa_table = opa2_table;
+            break;
+        case 3:
+            opa_table = opa3_table;
+            break;
+        case 4:
+            opa_table = opa4_table;
+            break;
+        default:
+            LV_LOG_WARN("%d bpp is not handled", bpp);
+            return;
+    }
+
+    lv_font_fmt_rle_t rle;
+    rle_init(&rle, in, bpp, (uint32_t)w * h);
+
+    /*Decompress the raw values directly into `out`. A line is converted to opacity
+     *only when the next line doesn't need it for the prefilter anymore.*/
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_A8);
+    uint8_t * prev_line = NULL;
+    int32_t y;
+    int32_t x;
+
+    for(y = 0; y < h; y++) {
+        decompress_line(&rle, out, w);
+
+        if(prev_line) {
+            for(x = 0; x < w; x++) {
+                if(prefilter) out[x] ^= prev_line[x];
+                prev_line[x] = opa_table[prev_line[x]];
+            }
+        }
+        prev_line = out;
+        out += stride;
+    }
+
+    if(prev_line) {
+        for(x = 0; x < w; x++) {
+            prev_line[x] = opa_table[prev_line[x]];
+        }
+    }
+}
+
+/**
+ * Decompress one line. Store one pixel per byte
+ * @param rle the state of the decompression
+ * @param out output buffer
+ * @param w width of the line in pixel count
+ */
+static inline void decompress_line(lv_font_fmt_rle_t * rle, uint8_t * out, int32_t w)
+{
+    int32_t x = 0;
+    while(x < w) {
+        if(rle->run_left == 0) rle->run_left = rle_next_run(rle);
+
+        /*A run can continue in the next line*/
+        int32_t len = LV_MIN(rle->run_left, w - x);
+        if(len == 1) out[x] = rle->prev_v;
+        else lv_memset(&out[x], rle->prev_v, len);
+
+        x += len;
+        rle->run_left -= len;
+    }
+}
+
+static inline void rle_init(lv_font_fmt_rle_t * rle, const uint8_t * in,  uint8_t bpp, uint32_t px_cnt)
+{
+    rle->in = in;
+    rle->px_left = px_cnt;
+    rle->bits = 0;
+    rle->bit_cnt = 0;
+    rle->bpp = bpp;
+    rle->state = RLE_STATE_REPEATED;    /*The first value can't be a repetition*/
+    rle->prev_v = 0;
+    rle->run_left = 0;
+}
+
+/**
+ * Read the next bits of the input. Only the bytes containing the bits are read.
+ * @param rle the state of the decompression
+ * @param len number of bits to read (must be <= 8)
+ * @return the read bits
+ */
+static inline uint8_t rle_get_bits(lv_font_fmt_rle_t * rle, uint8_t len)
+{
+    if(rle->bit_cnt < len) {
+        rle->bits = (rle->bits << 8) | *rle->in;
+        rle->in++;
+        rle->bit_cnt += 8;
+    }
+
+    rle->bit_cnt -= len;
+    return (uint8_t)((rle->bits >> rle->bit_cnt) & ((1U << len) - 1));
+}
+
+/**
+ * Decode the next run of pixels with the same value.
+ * A value equal to the previous one is followed by 1 bits, each repeating it once more.
+ * After 10 of them a 6-bit counter tells the number of remaining repetitions.
+ * A 0 bit (or a 0 counter) ends the repetition and a new value follows.
+ * The bits after the last pixel of the glyph are not read as they might be missing.
+ * @param rle the state of the decompression
+ * @return the length of the run (1..74). The value of its pixels is `rle->prev_v`
+ */
+static inline uint8_t rle_next_run(lv_font_fmt_rle_t * rle)
+{
+    uint8_t v = rle_get_bits(rle, rle->bpp);
+
+    if(rle->state == RLE_STATE_REPEATED || rle->prev_v != v) {
+        rle->prev_v = v;
+        rle->state = RLE_STATE_SINGLE;
+        rle->px_left--;
+        return 1;
+    }
+
+    rle->state = RLE_STATE_REPEATED;
+
+    uint8_t run = 1;
+    uint8_t count;
+    for(count = 1; count <= 11 && run < rle->px_left; count++) {
+        if(rle_get_bits(rle, 1) == 0) break;
+
+        if(count == 11) run += rle_get_bits(rle, 6);
+        else run++;
+    }
+
+    rle->px_left -= LV_MIN(run, rle->px_left);
+    return run;
+}
+#endif /*LV_USE_FONT_COMPRESSED*/
+
+/** Code Comparator.
+ *
+ *  Compares the value of both input arguments.
+ *
+ *  @param[in]  pRef        Pointer to the reference.
+ *  @param[in]  pElement    Pointer to the element to compare.
+ *
+ *  @return Result of comparison.
+ *  @retval < 0   Reference is less than element.
+ *  @retval = 0   Reference is equal to element.
+ *  @retval > 0   Reference is greater than element.
+ *
+ */
+static int unicode_list_compare(const void * ref, const void * element)
+{
+    return (*(uint16_t *)ref) - (*(uint16_t *)element);
+}
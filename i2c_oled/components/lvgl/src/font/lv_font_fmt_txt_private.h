@@ -0,0 +1,165 @@
+/**
+ * @file lv_font_fmt_txt_private.h
+ *
+ */
+
+#ifndef LV_FONT_FMT_TXT_PRIVATE_H
+#define LV_FONT_FMT_TXT_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_font_fmt_txt.h"
+#include "../misc/cache/lv_cache.h"
+#include "../osal/lv_os.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+#if LV_USE_FONT_COMPRESSED
+typedef enum {
+    RLE_STATE_SINGLE = 0,       /**< A value equal to the previous one starts a repetition*/
+    RLE_STATE_REPEATED,         /**< The next value is a new one. (At the start or after a repetition)*/
+} lv_font_fmt_rle_state_t;
+
+/** State of decompressing a glyph. Each decompression has its own so the draw units can decode glyphs in parallel.*/
+typedef struct {
+    const uint8_t * in;         /**< The next byte to read*/
+    uint32_t bits;              /**< The last read bytes, `bit_cnt` of them are not used yet*/
+    uint32_t px_left;           /**< Number of pixels of the glyph which are not decoded yet*/
+    uint8_t bit_cnt;
+    uint8_t bpp;
+    uint8_t prev_v;
+    uint8_t run_left;           /**< Number of `prev_v` pixels which are not written out yet*/
+    lv_font_fmt_rle_state_t state;
+} lv_font_fmt_rle_t;
+#endif
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+typedef struct {
+    lv_cache_slot_size_t slot;
+    const lv_font_fmt_txt_dsc_t * fdsc; /**< Not the font as copies of a font share the glyphs*/
+    uint32_t gid;
+    uint8_t bpp;
+    lv_draw_buf_t * draw_buf;   /**< The decoded A8 bitmap of the glyph*/
+} lv_font_fmt_txt_glyph_cache_data_t;
+
+typedef struct {
+    lv_cache_t * cache;
+    lv_mutex_t lock;            /**< Protects the counters as the draw units look up glyphs in parallel*/
+    uint32_t hit_cnt;
+    uint32_t miss_cnt;
+} lv_font_fmt_txt_glyph_cache_t;
+#endif
+
+#if LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE
+/** Direct-mapped letter -> glyph ID table of a font. The slot of a letter is `letter % LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE`.
+ * An entry is `letter / LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE + 1` in the upper and the glyph ID
+ * in the lower 16 bits (0: empty).*/
+typedef struct lv_font_fmt_txt_glyph_id_table_t {
+    struct lv_font_fmt_txt_glyph_id_table_t * next;
+    const lv_font_fmt_txt_dsc_t * fdsc;     /**< Not the font as copies of a font share the glyph IDs*/
+    uint32_t entries[LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE];
+} lv_font_fmt_txt_glyph_id_table_t;
+
+typedef struct {
+    lv_font_fmt_txt_glyph_id_table_t * tables;  /**< The tables of the used fonts as a linked list*/
+    lv_mutex_t lock;                            /**< Protects the tables and the counters as the draw units
+                                                 *   look up letters in parallel*/
+    uint32_t hit_cnt;
+    uint32_t miss_cnt;
+} lv_font_fmt_txt_glyph_id_cache_t;
+#endif
+
+#if LV_FONT_FMT_TXT_KERN_INDEX
+/** Hash table of the kerning pairs of a font with open addressing. The slot of a pair is searched from
+ * the upper bits of `key * 0x9E3779B1`. The keys, the values and the bitmap are allocated after the struct.*/
+typedef struct lv_font_fmt_txt_kern_index_t {
+    struct lv_font_fmt_txt_kern_index_t * next;
+    const lv_font_fmt_txt_dsc_t * fdsc;     /**< Not the font as copies of a font share the kerning*/
+    const uint32_t * keys;          /**< `gid_left << 16 | gid_right` of the pairs, 0: empty slot*/
+    const int8_t * values;          /**< Kerning value of the pair in the same slot*/
+    const uint8_t * left_bitmap;    /**< A bit for each glyph ID, set if the glyph is the left glyph of a pair*/
+    uint32_t left_gid_cnt;          /**< Number of bits in `left_bitmap`*/
+    uint32_t slot_mask;             /**< Number of slots - 1*/
+    uint8_t hash_shift;             /**< 32 - log2(number of slots)*/
+} lv_font_fmt_txt_kern_index_t;
+
+typedef struct {
+    lv_font_fmt_txt_kern_index_t * indexes;     /**< The indexes of the used fonts as a linked list*/
+    lv_mutex_t lock;                            /**< Protects the list of the indexes*/
+} lv_font_fmt_txt_kern_index_cache_t;
+#endif
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+
+/**
+ * Create the cache of the decoded glyph bitmaps
+ */
+void lv_font_fmt_txt_glyph_cache_init(void);
+
+/**
+ * Free the cached glyph bitmaps and the cache itself
+ */
+void lv_font_fmt_txt_glyph_cache_deinit(void);
+
+/**
+ * Release the cached bitmap returned by `lv_font_get_bitmap_fmt_txt()`.
+ * Called by `lv_font_glyph_release_draw_data()` as the fmt_txt fonts have no `release_glyph` callback.
+ * @param g_dsc     the glyph descriptor whose bitmap was drawn
+ */
+void lv_font_fmt_txt_glyph_cache_release(lv_font_glyph_dsc_t * g_dsc);
+
+#endif /*LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE*/
+
+#if LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE
+
+/**
+ * Initialize the letter -> glyph ID cache. The tables of the fonts are created when they are first used.
+ */
+void lv_font_fmt_txt_glyph_id_cache_init(void);
+
+/**
+ * Free the letter -> glyph ID tables of all fonts
+ */
+void lv_font_fmt_txt_glyph_id_cache_deinit(void);
+
+#endif /*LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE*/
+
+#if LV_FONT_FMT_TXT_KERN_INDEX
+
+/**
+ * Initialize the kerning indexes. The index of a font is built when its kerning is first used.
+ */
+void lv_font_fmt_txt_kern_index_init(void);
+
+/**
+ * Free the kerning indexes of all fonts
+ */
+void lv_font_fmt_txt_kern_index_deinit(void);
+
+#endif /*LV_FONT_FMT_TXT_KERN_INDEX*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_FONT_FMT_TXT_PRIVATE_H*/
@@ -0,0 +1,6212 @@
+/*******************************************************************************
+ * Size: 32 px
+ * Bpp: 4
+ * Opts: --no-compress --no-prefilter --bpp 4 --size 32 --font Montserrat-Medium.ttf -r 0x20-0x7F,0xB0,0x2022 --font FontAwesome5-Solid+Brands+Regular.woff -r 61441,61448,61451,61452,61452,61453,61457,61459,61461,61465,61468,61473,61478,61479,61480,61502,61507,61512,61515,61516,61517,61521,61522,61523,61524,61543,61544,61550,61552,61553,61556,61559,61560,61561,61563,61587,61589,61636,61637,61639,61641,61664,61671,61674,61683,61724,61732,61787,61931,62016,62017,62018,62019,62020,62087,62099,62212,62189,62810,63426,63650 --format lvgl -o lv_font_montserrat_32.c --force-fast-kern-format
+ ******************************************************************************/
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+    #include "lvgl.h"
+#else
+    #include "../../lvgl.h"
+#endif
+
+#ifndef LV_FONT_MONTSERRAT_32
+    #define LV_FONT_MONTSERRAT_32 1
+#endif
+
+#if LV_FONT_MONTSERRAT_32
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0021 "!" */
+    0x7f, 0xff, 0x17, 0xff, 0xf0, 0x6f, 0xff, 0x5,
+    0xff, 0xf0, 0x5f, 0xfe, 0x4, 0xff, 0xe0, 0x4f,
+    0xfd, 0x3, 0xff, 0xc0, 0x2f, 0xfc, 0x2, 0xff,
+    0xb0, 0x1f, 0xfb, 0x1, 0xff, 0xa0, 0xf, 0xf9,
+    0x0, 0xff, 0x90, 0xf, 0xf8, 0x0, 0x33, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xfa, 0xb,
+    0xff, 0xf4, 0xaf, 0xff, 0x42, 0xcf, 0x90,
+
+    /* U+0022 "\"" */
+    0xff, 0xb0, 0x2, 0xff, 0x7f, 0xfa, 0x0, 0x2f,
+    0xf7, 0xef, 0xa0, 0x2, 0xff, 0x6e, 0xf9, 0x0,
+    0x1f, 0xf6, 0xef, 0x90, 0x1, 0xff, 0x6d, 0xf8,
+    0x0, 0x1f, 0xf5, 0xdf, 0x80, 0x0, 0xff, 0x5d,
+    0xf8, 0x0, 0xf, 0xf4, 0x79, 0x40, 0x0, 0x99,
+    0x20,
+
+    /* U+0023 "#" */
+    0x0, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x6,
+    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf6,
+    0x0, 0x0, 0x9, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xf4, 0x0, 0x0, 0xb, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0,
+    0xd, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xf0, 0x0, 0x0, 0xf, 0xf4, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfa, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x55, 0x55,
+    0xcf, 0xb5, 0x55, 0x55, 0x9f, 0xe5, 0x55, 0x53,
+    0x0, 0x0, 0x0, 0xcf, 0x70, 0x0, 0x0, 0x7f,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x60,
+    0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0x40, 0x0, 0x0, 0xbf, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0x20, 0x0, 0x0,
+    0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xfe, 0x0, 0x0, 0x0, 0xff, 0x30,
+    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x90, 0x2f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0x5, 0x55, 0x5d, 0xfa, 0x55, 0x55, 0x59, 0xfe,
+    0x55, 0x55, 0x30, 0x0, 0x0, 0xd, 0xf6, 0x0,
+    0x0, 0x8, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xf4, 0x0, 0x0, 0xa, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xf2, 0x0, 0x0, 0xc,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0,
+    0x0, 0x0, 0xe, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xe0, 0x0, 0x0, 0xf, 0xf3, 0x0,
+    0x0, 0x0,
+
+    /* U+0024 "$" */
+    0x0, 0x0, 0x0, 0x0, 0xef, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0xce,
+    0xff, 0xfe, 0xb8, 0x20, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x0, 0xbf,
+    0xff, 0xfc, 0xff, 0xde, 0xff, 0xff, 0x50, 0x7,
+    0xff, 0xf8, 0x10, 0xef, 0x20, 0x16, 0xce, 0x0,
+    0xe, 0xff, 0x70, 0x0, 0xef, 0x20, 0x0, 0x2,
+    0x0, 0x1f, 0xff, 0x0, 0x0, 0xef, 0x20, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0xef, 0x20,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x70, 0x0, 0xef,
+    0x20, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfa, 0x30,
+    0xef, 0x20, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
+    0xfd, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1a,
+    0xff, 0xff, 0xff, 0xfd, 0x82, 0x0, 0x0, 0x0,
+    0x0, 0x28, 0xdf, 0xff, 0xff, 0xff, 0xb2, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xef, 0xff, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0xef, 0x22, 0x9f,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x20,
+    0x3, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0x20, 0x0, 0xaf, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0x20, 0x0, 0xaf, 0xf8, 0xb, 0x50, 0x0,
+    0x0, 0xef, 0x20, 0x1, 0xef, 0xf4, 0x4f, 0xfc,
+    0x51, 0x0, 0xef, 0x20, 0x3d, 0xff, 0xd0, 0x5f,
+    0xff, 0xff, 0xdc, 0xff, 0xce, 0xff, 0xff, 0x30,
+    0x3, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3,
+    0x0, 0x0, 0x2, 0x7b, 0xdf, 0xff, 0xfe, 0xa5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x78, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+0025 "%" */
+    0x0, 0x2a, 0xef, 0xd8, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xe1, 0x0, 0x0, 0x3f, 0xff, 0xdf,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x2f, 0xf5, 0x0,
+    0x0, 0xe, 0xf8, 0x0, 0xa, 0xfb, 0x0, 0x0,
+    0x0, 0xc, 0xfa, 0x0, 0x0, 0x6, 0xfd, 0x0,
+    0x0, 0x1f, 0xf3, 0x0, 0x0, 0x8, 0xfe, 0x0,
+    0x0, 0x0, 0xaf, 0x70, 0x0, 0x0, 0xaf, 0x70,
+    0x0, 0x3, 0xff, 0x40, 0x0, 0x0, 0xc, 0xf5,
+    0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0xdf, 0x80,
+    0x0, 0x0, 0x0, 0xcf, 0x50, 0x0, 0x0, 0x8f,
+    0x80, 0x0, 0x9f, 0xd0, 0x0, 0x0, 0x0, 0xa,
+    0xf7, 0x0, 0x0, 0xb, 0xf6, 0x0, 0x4f, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xe0, 0x0, 0x1,
+    0xff, 0x20, 0x1e, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xb2, 0x3, 0xcf, 0xa0, 0xb, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
+    0xff, 0xc0, 0x6, 0xff, 0x20, 0x19, 0xdf, 0xe9,
+    0x20, 0x0, 0x0, 0x7b, 0xcb, 0x60, 0x2, 0xff,
+    0x60, 0x1e, 0xff, 0xdf, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xa0, 0xc, 0xfb, 0x10,
+    0x9, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xe1, 0x3, 0xff, 0x10, 0x0, 0xe, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xf4, 0x0, 0x7f, 0xa0,
+    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0xd,
+    0xf9, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x5, 0xfc,
+    0x0, 0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x9f,
+    0x70, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0, 0x4,
+    0xff, 0x30, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x7,
+    0xfa, 0x0, 0x0, 0x1, 0xef, 0x80, 0x0, 0x0,
+    0x3f, 0xe0, 0x0, 0x0, 0xcf, 0x60, 0x0, 0x0,
+    0xaf, 0xc0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0,
+    0x6f, 0xe0, 0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xda, 0xcf, 0xf3, 0x0, 0x0,
+    0x1e, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9e,
+    0xfe, 0xa2, 0x0,
+
+    /* U+0026 "&" */
+    0x0, 0x0, 0x2, 0x8d, 0xff, 0xea, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xf9, 0x54, 0x6e, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xf7, 0x0, 0x0, 0x2f, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0x10, 0x0, 0x0,
+    0xdf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2,
+    0x0, 0x0, 0x1f, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0x90, 0x0, 0xb, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x1e, 0xff, 0x60, 0x3d, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xbf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xfe, 0x9f,
+    0xff, 0x70, 0x0, 0x0, 0x50, 0x0, 0x1, 0xdf,
+    0xfa, 0x10, 0x4f, 0xff, 0x80, 0x0, 0x5f, 0xf4,
+    0x0, 0xbf, 0xf8, 0x0, 0x0, 0x4f, 0xff, 0x90,
+    0x9, 0xff, 0x10, 0x3f, 0xfd, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0x91, 0xff, 0xc0, 0x7, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x3e, 0xff, 0xef, 0xf5, 0x0,
+    0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xfc, 0x0, 0x6, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xc0, 0x0, 0x1e, 0xff, 0xb2,
+    0x0, 0x0, 0x1, 0x8f, 0xff, 0xff, 0xc1, 0x0,
+    0x5f, 0xff, 0xfc, 0xa8, 0x9c, 0xff, 0xff, 0x6c,
+    0xff, 0xc1, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xff,
+    0xfb, 0x20, 0x1c, 0xfe, 0x20, 0x0, 0x5, 0xad,
+    0xff, 0xec, 0x83, 0x0, 0x0, 0x1c, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+0027 "'" */
+    0xff, 0xbf, 0xfa, 0xef, 0xae, 0xf9, 0xef, 0x9d,
+    0xf8, 0xdf, 0x8d, 0xf8, 0x79, 0x40,
+
+    /* U+0028 "(" */
+    0x0, 0x6, 0xff, 0x80, 0x0, 0xef, 0xe0, 0x0,
+    0x7f, 0xf8, 0x0, 0xe, 0xff, 0x10, 0x3, 0xff,
+    0xb0, 0x0, 0x8f, 0xf6, 0x0, 0xe, 0xff, 0x10,
+    0x1, 0xff, 0xd0, 0x0, 0x4f, 0xfa, 0x0, 0x7,
+    0xff, 0x80, 0x0, 0xaf, 0xf5, 0x0, 0xc, 0xff,
+    0x30, 0x0, 0xcf, 0xf2, 0x0, 0xd, 0xff, 0x20,
+    0x0, 0xef, 0xf1, 0x0, 0xe, 0xff, 0x10, 0x0,
+    0xdf, 0xf2, 0x0, 0xc, 0xff, 0x20, 0x0, 0xcf,
+    0xf3, 0x0, 0xa, 0xff, 0x50, 0x0, 0x7f, 0xf8,
+    0x0, 0x4, 0xff, 0xa0, 0x0, 0x1f, 0xfd, 0x0,
+    0x0, 0xdf, 0xf1, 0x0, 0x8, 0xff, 0x60, 0x0,
+    0x3f, 0xfb, 0x0, 0x0, 0xdf, 0xf1, 0x0, 0x6,
+    0xff, 0x80, 0x0, 0xe, 0xfe, 0x0, 0x0, 0x6f,
+    0xf8,
+
+    /* U+0029 ")" */
+    0xbf, 0xf3, 0x0, 0x4, 0xff, 0xb0, 0x0, 0xc,
+    0xff, 0x30, 0x0, 0x5f, 0xfb, 0x0, 0x0, 0xff,
+    0xf0, 0x0, 0xa, 0xff, 0x50, 0x0, 0x5f, 0xfb,
+    0x0, 0x1, 0xff, 0xe0, 0x0, 0xe, 0xff, 0x10,
+    0x0, 0xbf, 0xf4, 0x0, 0x8, 0xff, 0x70, 0x0,
+    0x6f, 0xf9, 0x0, 0x6, 0xff, 0xa0, 0x0, 0x5f,
+    0xfb, 0x0, 0x4, 0xff, 0xb0, 0x0, 0x4f, 0xfc,
+    0x0, 0x5, 0xff, 0xb0, 0x0, 0x6f, 0xfa, 0x0,
+    0x6, 0xff, 0x90, 0x0, 0x8f, 0xf7, 0x0, 0xb,
+    0xff, 0x40, 0x0, 0xef, 0xf1, 0x0, 0x1f, 0xfe,
+    0x0, 0x5, 0xff, 0xb0, 0x0, 0xaf, 0xf5, 0x0,
+    0xf, 0xff, 0x0, 0x4, 0xff, 0xb0, 0x0, 0xcf,
+    0xf3, 0x0, 0x3f, 0xfb, 0x0, 0xb, 0xff, 0x30,
+    0x0,
+
+    /* U+002A "*" */
+    0x0, 0x0, 0x8, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0x50, 0x0, 0x0, 0x9, 0x70, 0x8,
+    0xf5, 0x0, 0x87, 0x2, 0xff, 0xd4, 0x8f, 0x56,
+    0xef, 0xe0, 0x4, 0xdf, 0xfe, 0xfe, 0xff, 0xb3,
+    0x0, 0x0, 0x6e, 0xff, 0xfd, 0x40, 0x0, 0x0,
+    0x19, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x7e, 0xff,
+    0xdf, 0xdf, 0xfd, 0x50, 0x2f, 0xfa, 0x28, 0xf5,
+    0x3c, 0xfe, 0x0, 0x74, 0x0, 0x8f, 0x50, 0x6,
+    0x50, 0x0, 0x0, 0x8, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7d, 0x40, 0x0, 0x0,
+
+    /* U+002B "+" */
+    0x0, 0x0, 0x0, 0xee, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xfa, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf7, 0x78, 0x88, 0x88, 0xff,
+    0xd8, 0x88, 0x88, 0x30, 0x0, 0x0, 0xf, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xfa, 0x0, 0x0,
+    0x0,
+
+    /* U+002C "," */
+    0x7, 0xca, 0x14, 0xff, 0xf9, 0x6f, 0xff, 0xb2,
+    0xef, 0xf8, 0x4, 0xff, 0x30, 0x6f, 0xe0, 0xa,
+    0xf9, 0x0, 0xef, 0x30, 0x2f, 0xe0, 0x0,
+
+    /* U+002D "-" */
+    0x1a, 0xaa, 0xaa, 0xaa, 0xa4, 0x2f, 0xff, 0xff,
+    0xff, 0xf7, 0x2f, 0xff, 0xff, 0xff, 0xf7,
+
+    /* U+002E "." */
+    0x1, 0x42, 0x1, 0xef, 0xf4, 0x7f, 0xff, 0xb6,
+    0xff, 0xf9, 0xa, 0xfc, 0x10,
+
+    /* U+002F "/" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x0, 0x0, 0x6b, 0xef, 0xfc, 0x82, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfd,
+    0xef, 0xff, 0xfc, 0x0, 0x0, 0x5, 0xff, 0xfc,
+    0x40, 0x0, 0x29, 0xff, 0xfa, 0x0, 0x0, 0xef,
+    0xfb, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf4, 0x0,
+    0x7f, 0xfe, 0x10, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xc0, 0xd, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0x21, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xf6, 0x4f, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0x96, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfb, 0x7f,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xc7, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xfc, 0x6f, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xb4, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xf9, 0x1f, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x60, 0xdf,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf2,
+    0x7, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xfc, 0x0, 0xe, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0x40, 0x0, 0x5f, 0xff, 0xc4, 0x0,
+    0x2, 0x9f, 0xff, 0xa0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xde, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xbe, 0xff, 0xd8, 0x20, 0x0,
+    0x0,
+
+    /* U+0031 "1" */
+    0xcf, 0xff, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xff,
+    0xf7, 0x9c, 0xcc, 0xce, 0xff, 0x70, 0x0, 0x0,
+    0xbf, 0xf7, 0x0, 0x0, 0xb, 0xff, 0x70, 0x0,
+    0x0, 0xbf, 0xf7, 0x0, 0x0, 0xb, 0xff, 0x70,
+    0x0, 0x0, 0xbf, 0xf7, 0x0, 0x0, 0xb, 0xff,
+    0x70, 0x0, 0x0, 0xbf, 0xf7, 0x0, 0x0, 0xb,
+    0xff, 0x70, 0x0, 0x0, 0xbf, 0xf7, 0x0, 0x0,
+    0xb, 0xff, 0x70, 0x0, 0x0, 0xbf, 0xf7, 0x0,
+    0x0, 0xb, 0xff, 0x70, 0x0, 0x0, 0xbf, 0xf7,
+    0x0, 0x0, 0xb, 0xff, 0x70, 0x0, 0x0, 0xbf,
+    0xf7, 0x0, 0x0, 0xb, 0xff, 0x70, 0x0, 0x0,
+    0xbf, 0xf7, 0x0, 0x0, 0xb, 0xff, 0x70, 0x0,
+    0x0, 0xbf, 0xf7,
+
+    /* U+0032 "2" */
+    0x0, 0x0, 0x49, 0xce, 0xff, 0xda, 0x50, 0x0,
+    0x0, 0x0, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x20, 0x0, 0x9, 0xff, 0xff, 0xfe, 0xde, 0xff,
+    0xff, 0xe2, 0x0, 0x4f, 0xff, 0xb4, 0x0, 0x0,
+    0x18, 0xff, 0xfb, 0x0, 0x4, 0xe6, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xcf, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xef, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xc3, 0xd, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0xd, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
+
+    /* U+0033 "3" */
+    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0x9, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfd, 0xa5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x6, 0x99, 0xad, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xb0, 0xb8, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xf7, 0x5f, 0xfe, 0x83, 0x0, 0x0, 0x16, 0xef,
+    0xfe, 0x7, 0xff, 0xff, 0xff, 0xed, 0xef, 0xff,
+    0xff, 0x30, 0x4, 0xcf, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x30, 0x0, 0x0, 0x27, 0xbd, 0xef, 0xed,
+    0x94, 0x0, 0x0,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xa0, 0x0, 0x3, 0xdd, 0x90, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xd0, 0x0, 0x0, 0x3f,
+    0xfc, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf2, 0x0,
+    0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x3, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0,
+    0x1, 0xef, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xc0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0x9b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdf, 0xff,
+    0xbb, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xc0, 0x0, 0x0,
+
+    /* U+0035 "5" */
+    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0xe, 0xff, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xfd, 0xcc, 0xba, 0x96, 0x20, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x40, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x49, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xf0, 0x6, 0xd3, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xc0, 0x1e, 0xff, 0xb5, 0x10, 0x0, 0x4,
+    0xcf, 0xff, 0x40, 0x2e, 0xff, 0xff, 0xfe, 0xdd,
+    0xff, 0xff, 0xf8, 0x0, 0x1, 0x9f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x59,
+    0xde, 0xff, 0xdb, 0x61, 0x0, 0x0,
+
+    /* U+0036 "6" */
+    0x0, 0x0, 0x0, 0x27, 0xbe, 0xff, 0xec, 0x94,
+    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x70, 0x0, 0x3, 0xef, 0xff, 0xfe, 0xcb,
+    0xcf, 0xff, 0x10, 0x0, 0x2e, 0xff, 0xf8, 0x10,
+    0x0, 0x0, 0x36, 0x0, 0x0, 0xcf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfe, 0x0, 0x2, 0x68, 0x87, 0x40, 0x0,
+    0x0, 0x5f, 0xfc, 0x4, 0xdf, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x6f, 0xfb, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x10, 0x7f, 0xff, 0xff, 0xd6, 0x10,
+    0x3, 0x9f, 0xff, 0xc0, 0x6f, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xf4, 0x5f, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0x2f, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfc, 0xe,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfd,
+    0x9, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xfb, 0x2, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xf6, 0x0, 0x8f, 0xff, 0x60, 0x0, 0x0,
+    0x2c, 0xff, 0xe0, 0x0, 0xa, 0xff, 0xfe, 0xb9,
+    0x9c, 0xff, 0xff, 0x20, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x1,
+    0x7b, 0xef, 0xfd, 0xa4, 0x0, 0x0,
+
+    /* U+0037 "7" */
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0xf, 0xff, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xff, 0xfb, 0xf, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf3, 0xf, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xc0, 0xf, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x50, 0xb, 0xbb,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x0, 0x16, 0xbd, 0xff, 0xed, 0x94, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x30, 0x0, 0x0, 0x9f, 0xff, 0xfc, 0xa9,
+    0xbd, 0xff, 0xff, 0x40, 0x0, 0x4f, 0xff, 0x91,
+    0x0, 0x0, 0x4, 0xdf, 0xfe, 0x0, 0x9, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf4, 0x0,
+    0xcf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0x60, 0xa, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xf4, 0x0, 0x6f, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x6f, 0xfe, 0x0, 0x0, 0xcf, 0xfe, 0x83,
+    0x10, 0x14, 0xaf, 0xff, 0x50, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x0,
+    0x0, 0x1c, 0xff, 0xfc, 0x97, 0x67, 0xaf, 0xff,
+    0xf7, 0x0, 0xb, 0xff, 0xe4, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xf5, 0x3, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xd0, 0x7f, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x19, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf2,
+    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0x14, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xd0, 0xc, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x2b, 0xff, 0xf6, 0x0, 0x1d, 0xff, 0xff,
+    0xb9, 0x9a, 0xdf, 0xff, 0xf8, 0x0, 0x0, 0x1a,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x0,
+    0x0, 0x2, 0x7b, 0xdf, 0xfe, 0xd9, 0x50, 0x0,
+    0x0,
+
+    /* U+0039 "9" */
+    0x0, 0x0, 0x16, 0xbd, 0xff, 0xda, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfb, 0x99,
+    0xbf, 0xff, 0xf6, 0x0, 0x0, 0x4f, 0xff, 0x90,
+    0x0, 0x0, 0x8, 0xff, 0xf3, 0x0, 0xb, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x7, 0xff, 0xd0, 0x0,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0x40, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xfa, 0x0, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0xd0, 0xc, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x5f, 0xff,
+    0x90, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf1, 0x0,
+    0xaf, 0xff, 0xfb, 0x99, 0xbf, 0xff, 0xaf, 0xff,
+    0x20, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0xff, 0xf2, 0x0, 0x0, 0x28, 0xce, 0xfe, 0xc8,
+    0x20, 0x1f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xf7, 0x0, 0x0, 0x9, 0x30, 0x0, 0x0,
+    0x3b, 0xff, 0xfb, 0x0, 0x0, 0x5, 0xff, 0xec,
+    0xbc, 0xef, 0xff, 0xfc, 0x10, 0x0, 0x0, 0xbf,
+    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x5a, 0xdf, 0xff, 0xda, 0x60, 0x0, 0x0,
+    0x0,
+
+    /* U+003A ":" */
+    0x9, 0xfc, 0x16, 0xff, 0xf9, 0x7f, 0xff, 0xb1,
+    0xef, 0xf4, 0x1, 0x42, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x42,
+    0x1, 0xef, 0xf4, 0x7f, 0xff, 0xb6, 0xff, 0xf9,
+    0xa, 0xfc, 0x10,
+
+    /* U+003B ";" */
+    0x9, 0xfc, 0x16, 0xff, 0xf9, 0x7f, 0xff, 0xb1,
+    0xef, 0xf4, 0x1, 0x42, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xc1, 0x5f, 0xff, 0xa6, 0xff, 0xfb,
+    0x1d, 0xff, 0x80, 0x3f, 0xf3, 0x7, 0xfd, 0x0,
+    0xbf, 0x80, 0xf, 0xf2, 0x2, 0xdb, 0x0,
+
+    /* U+003C "<" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xb7, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x8e, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x5c, 0xff, 0xff, 0xe4, 0x0, 0x0,
+    0x39, 0xff, 0xff, 0xfa, 0x40, 0x0, 0x6, 0xcf,
+    0xff, 0xfd, 0x71, 0x0, 0x0, 0x8f, 0xff, 0xfe,
+    0x93, 0x0, 0x0, 0x0, 0xd, 0xff, 0xc5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x93, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xcf, 0xff, 0xfd, 0x71,
+    0x0, 0x0, 0x0, 0x0, 0x29, 0xef, 0xff, 0xfa,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x5b, 0xff, 0xff,
+    0xe8, 0x20, 0x0, 0x0, 0x0, 0x2, 0x8e, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5, 0xbf,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17,
+    0x60,
+
+    /* U+003D "=" */
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x78,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x83, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf7,
+
+    /* U+003E ">" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xfc, 0x60, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xf9, 0x30, 0x0, 0x0, 0x0, 0x1, 0x6d,
+    0xff, 0xff, 0xd6, 0x10, 0x0, 0x0, 0x0, 0x3,
+    0x9e, 0xff, 0xff, 0xa4, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xbf, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x17, 0xef, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xbf, 0xff, 0x70, 0x0, 0x0, 0x3, 0x9e,
+    0xff, 0xff, 0xa2, 0x0, 0x1, 0x6d, 0xff, 0xff,
+    0xc6, 0x10, 0x0, 0x4a, 0xff, 0xff, 0xf9, 0x30,
+    0x0, 0x0, 0xcf, 0xff, 0xfc, 0x60, 0x0, 0x0,
+    0x0, 0xd, 0xfe, 0x82, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x95, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+003F "?" */
+    0x0, 0x0, 0x59, 0xde, 0xff, 0xda, 0x50, 0x0,
+    0x0, 0x5, 0xef, 0xff, 0xff, 0xff, 0xff, 0xd3,
+    0x0, 0xa, 0xff, 0xff, 0xec, 0xbd, 0xff, 0xff,
+    0xf3, 0x6, 0xff, 0xf9, 0x20, 0x0, 0x1, 0x8f,
+    0xff, 0xc0, 0x5, 0xe4, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xee, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xe4,
+    0x0, 0x0, 0x0,
+
+    /* U+0040 "@" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x48, 0xbd, 0xff,
+    0xfe, 0xc9, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x18, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xea, 0x63, 0x21, 0x23,
+    0x58, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xfd, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3a, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xef, 0xe2, 0x0, 0x0, 0x0, 0xbf,
+    0xf5, 0x0, 0x0, 0x1, 0x56, 0x64, 0x0, 0x1,
+    0x77, 0x41, 0xdf, 0xd0, 0x0, 0x0, 0x6f, 0xf6,
+    0x0, 0x0, 0x2b, 0xff, 0xff, 0xff, 0x91, 0x3f,
+    0xf9, 0x1, 0xef, 0x90, 0x0, 0xe, 0xfa, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xff,
+    0x90, 0x4, 0xff, 0x20, 0x6, 0xff, 0x20, 0x0,
+    0x3f, 0xff, 0xc4, 0x10, 0x26, 0xef, 0xff, 0xf9,
+    0x0, 0xb, 0xf9, 0x0, 0xcf, 0xa0, 0x0, 0xd,
+    0xff, 0x80, 0x0, 0x0, 0x1, 0xcf, 0xff, 0x90,
+    0x0, 0x5f, 0xe0, 0x1f, 0xf5, 0x0, 0x4, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf9, 0x0,
+    0x0, 0xff, 0x34, 0xff, 0x10, 0x0, 0x9f, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x90, 0x0,
+    0xc, 0xf6, 0x6f, 0xf0, 0x0, 0xc, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0,
+    0xbf, 0x77, 0xfe, 0x0, 0x0, 0xdf, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0x90, 0x0, 0xa,
+    0xf8, 0x7f, 0xe0, 0x0, 0xd, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xf9, 0x0, 0x0, 0xaf,
+    0x76, 0xff, 0x0, 0x0, 0xbf, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0x90, 0x0, 0xb, 0xf6,
+    0x3f, 0xf2, 0x0, 0x7, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xf9, 0x0, 0x0, 0xef, 0x40,
+    0xff, 0x50, 0x0, 0x1f, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0x90, 0x0, 0x3f, 0xf0, 0xc,
+    0xfa, 0x0, 0x0, 0x8f, 0xfd, 0x30, 0x0, 0x0,
+    0x6f, 0xff, 0xfd, 0x0, 0xb, 0xfa, 0x0, 0x6f,
+    0xf2, 0x0, 0x0, 0xcf, 0xff, 0xb7, 0x68, 0xdf,
+    0xf9, 0xcf, 0xfb, 0x7b, 0xff, 0x20, 0x0, 0xef,
+    0xb0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xf8,
+    0x5, 0xff, 0xff, 0xff, 0x60, 0x0, 0x5, 0xff,
+    0x60, 0x0, 0x0, 0x3a, 0xdf, 0xfd, 0x93, 0x0,
+    0x4, 0xcf, 0xeb, 0x40, 0x0, 0x0, 0xa, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xa6, 0x43, 0x23, 0x47, 0xaf, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0x9b, 0xef, 0xff, 0xdb, 0x83, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+0041 "A" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xfb, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0x1b, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xa0, 0x4f, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xf3, 0x0, 0xdf, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xfc, 0x0, 0x6, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0x40, 0x0, 0xe, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xd0, 0x0, 0x0,
+    0x7f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf6, 0x0, 0x0, 0x1, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0x80, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x7, 0xff, 0xd8, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0xaf, 0xfe, 0x0, 0x0, 0x0, 0xef, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf5,
+    0x0, 0x0, 0x6f, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xd0, 0x0, 0xd, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0x40, 0x5, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfc, 0x0, 0xcf,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xf3,
+
+    /* U+0042 "B" */
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0x60,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x50, 0x0, 0xaf, 0xfd, 0x99, 0x99,
+    0x99, 0x9a, 0xdf, 0xff, 0xf6, 0x0, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0x40, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0x60, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0x50, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x10,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
+    0xf9, 0x0, 0xaf, 0xfd, 0x99, 0x99, 0x99, 0x9a,
+    0xdf, 0xff, 0xb0, 0x0, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x14, 0xaf,
+    0xff, 0x80, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xf2, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf7, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf9,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf9, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf6, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xf1, 0xaf, 0xfd,
+    0x99, 0x99, 0x99, 0x99, 0xad, 0xff, 0xff, 0x60,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe5, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xed, 0xa5, 0x0, 0x0,
+
+    /* U+0043 "C" */
+    0x0, 0x0, 0x0, 0x1, 0x6b, 0xdf, 0xfe, 0xd9,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xfe, 0xde, 0xff, 0xff, 0xfc, 0x10,
+    0x0, 0x7f, 0xff, 0xfa, 0x40, 0x0, 0x0, 0x5b,
+    0xff, 0xfa, 0x0, 0x5f, 0xff, 0xe4, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xeb, 0x0, 0x1e, 0xff, 0xd1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x8,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xef, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x20, 0x0, 0x5, 0xff, 0xfe, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x7, 0xff,
+    0xff, 0xa4, 0x0, 0x0, 0x5, 0xbf, 0xff, 0xa0,
+    0x0, 0x5, 0xff, 0xff, 0xff, 0xed, 0xef, 0xff,
+    0xff, 0xc1, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x17, 0xbd, 0xff, 0xed, 0x95, 0x0, 0x0,
+
+    /* U+0044 "D" */
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc8, 0x40,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x60, 0x0, 0x0, 0xaf, 0xfe,
+    0xcc, 0xcc, 0xcc, 0xde, 0xff, 0xff, 0xfc, 0x10,
+    0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x16,
+    0xdf, 0xff, 0xd1, 0x0, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xfc, 0x0, 0xaf,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0x70, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xe0, 0xaf, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf5,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xf9, 0xaf, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfc, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xfd, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xfd, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfc, 0xaf,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xf5, 0xaf, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0x70, 0xaf, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfc, 0x0, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x16, 0xdf, 0xff, 0xd1,
+    0x0, 0xaf, 0xfe, 0xcc, 0xcc, 0xcc, 0xce, 0xff,
+    0xff, 0xfc, 0x10, 0x0, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x60, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xc8, 0x40, 0x0,
+    0x0, 0x0,
+
+    /* U+0045 "E" */
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf2, 0xaf, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0x2a, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xdb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xb8, 0x0, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0xa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xec, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xc7, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf9,
+
+    /* U+0046 "F" */
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf2, 0xaf, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0x2a, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0x90, 0xa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xa, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+0047 "G" */
+    0x0, 0x0, 0x0, 0x1, 0x6a, 0xdf, 0xfe, 0xda,
+    0x61, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xfe, 0xde, 0xff, 0xff, 0xfe,
+    0x30, 0x0, 0x7, 0xff, 0xff, 0xb4, 0x0, 0x0,
+    0x4, 0x9f, 0xff, 0xd0, 0x0, 0x5f, 0xff, 0xe4,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcd, 0x10, 0x1,
+    0xef, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x8, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22,
+    0x10, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xf0, 0x5f, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf0, 0x2f,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xf0, 0xe, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xf0, 0x8, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf0,
+    0x1, 0xef, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xf0, 0x0, 0x4f, 0xff, 0xe4, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xf0, 0x0, 0x6,
+    0xff, 0xff, 0xb4, 0x0, 0x0, 0x3, 0x8f, 0xff,
+    0xf0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xfe, 0xde,
+    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x6a, 0xdf, 0xfe, 0xda, 0x61,
+    0x0, 0x0,
+
+    /* U+0048 "H" */
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xfa, 0xaf, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xef, 0xfa, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xfa,
+
+    /* U+0049 "I" */
+    0xaf, 0xf9, 0xaf, 0xf9, 0xaf, 0xf9, 0xaf, 0xf9,
+    0xaf, 0xf9, 0xaf, 0xf9, 0xaf, 0xf9, 0xaf, 0xf9,
+    0xaf, 0xf9, 0xaf, 0xf9, 0xaf, 0xf9, 0xaf, 0xf9,
+    0xaf, 0xf9, 0xaf, 0xf9, 0xaf, 0xf9, 0xaf, 0xf9,
+    0xaf, 0xf9, 0xaf, 0xf9, 0xaf, 0xf9, 0xaf, 0xf9,
+    0xaf, 0xf9, 0xaf, 0xf9,
+
+    /* U+004A "J" */
+    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0xc, 0xcc, 0xcc, 0xcc, 0xcf, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf3,
+    0x0, 0x10, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x10,
+    0x3e, 0x40, 0x0, 0x0, 0x7, 0xff, 0xe0, 0x1e,
+    0xff, 0x81, 0x0, 0x5, 0xff, 0xf8, 0x0, 0xaf,
+    0xff, 0xfd, 0xce, 0xff, 0xfe, 0x10, 0x0, 0x8f,
+    0xff, 0xff, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x28,
+    0xce, 0xfe, 0xb6, 0x0, 0x0,
+
+    /* U+004B "K" */
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xd1, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xfd, 0x10, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xd1, 0x0, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfd, 0x10, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0xb, 0xff, 0xe2,
+    0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0xbf,
+    0xfe, 0x20, 0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0,
+    0xb, 0xff, 0xe2, 0x0, 0x0, 0x0, 0xaf, 0xf9,
+    0x0, 0x0, 0xaf, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0xa, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xf9, 0x0, 0xaf, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0xa, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf9,
+    0xaf, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xf7, 0xef, 0xfe, 0x10, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0x50, 0x3f, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf5, 0x0,
+    0x5, 0xff, 0xfa, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0x60, 0x0, 0x0, 0x7f, 0xff, 0x80, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf5,
+    0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0x30, 0x0, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xe1, 0x0, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xfd, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
+    0xff, 0xb0, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xf8,
+
+    /* U+004C "L" */
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc8,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+
+    /* U+004D "M" */
+    0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0x2a, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xf2, 0xaf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0x2a, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xf2, 0xaf, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x2a, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xf2, 0xaf, 0xfb, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xce, 0xff, 0x2a,
+    0xff, 0x7b, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xf2, 0xef, 0xf2, 0xaf, 0xf7, 0x1f, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0xe, 0xff,
+    0x2a, 0xff, 0x70, 0x7f, 0xfb, 0x0, 0x0, 0x0,
+    0x2f, 0xfe, 0x0, 0xef, 0xf2, 0xaf, 0xf7, 0x0,
+    0xdf, 0xf5, 0x0, 0x0, 0xb, 0xff, 0x50, 0xe,
+    0xff, 0x2a, 0xff, 0x70, 0x3, 0xff, 0xe0, 0x0,
+    0x4, 0xff, 0xb0, 0x0, 0xef, 0xf3, 0xaf, 0xf7,
+    0x0, 0xa, 0xff, 0x80, 0x0, 0xdf, 0xf2, 0x0,
+    0xe, 0xff, 0x3a, 0xff, 0x70, 0x0, 0x1e, 0xff,
+    0x20, 0x8f, 0xf8, 0x0, 0x0, 0xef, 0xf3, 0xaf,
+    0xf7, 0x0, 0x0, 0x6f, 0xfb, 0x2f, 0xfe, 0x0,
+    0x0, 0xe, 0xff, 0x3a, 0xff, 0x70, 0x0, 0x0,
+    0xcf, 0xfd, 0xff, 0x50, 0x0, 0x0, 0xef, 0xf3,
+    0xaf, 0xf7, 0x0, 0x0, 0x3, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0xe, 0xff, 0x3a, 0xff, 0x70, 0x0,
+    0x0, 0x9, 0xff, 0xf2, 0x0, 0x0, 0x0, 0xef,
+    0xf3, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x1e, 0xf7,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0x3a, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x25, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xf3, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x3a, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xf3,
+
+    /* U+004E "N" */
+    0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xfa, 0xaf, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa,
+    0xaf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xfa, 0xaf, 0xfe, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9, 0xbf, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9,
+    0xd, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x9f, 0xfa,
+    0xaf, 0xf9, 0x2, 0xef, 0xfd, 0x10, 0x0, 0x0,
+    0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x4f, 0xff, 0xb0,
+    0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x6,
+    0xff, 0xf9, 0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9,
+    0x0, 0x0, 0x9f, 0xff, 0x60, 0x0, 0x9f, 0xfa,
+    0xaf, 0xf9, 0x0, 0x0, 0xc, 0xff, 0xf3, 0x0,
+    0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x0, 0x1, 0xef,
+    0xfe, 0x10, 0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xd0, 0x9f, 0xfa, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xfa, 0x9f, 0xfa,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xef, 0xfa, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xfa, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xfa, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xfa,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xfa, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xfa,
+
+    /* U+004F "O" */
+    0x0, 0x0, 0x0, 0x1, 0x6a, 0xdf, 0xff, 0xda,
+    0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xfe, 0xde,
+    0xff, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xfa, 0x40, 0x0, 0x0, 0x4b, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x4f, 0xff, 0xe4, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xef, 0xff, 0x30, 0x0, 0xe,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xfd, 0x0, 0x8, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf6, 0x0,
+    0xef, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xc0, 0x2f, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0x5, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xf3, 0x7f, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0x47, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xf4, 0x5f, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0x32, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf0, 0xe,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xfc, 0x0, 0x8f, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x60,
+    0x0, 0xef, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xd0, 0x0, 0x4, 0xff, 0xfe,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xf3,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xa4, 0x0, 0x0,
+    0x4, 0xbf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xff, 0xed, 0xef, 0xff, 0xff, 0xe4,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x16, 0xad, 0xff, 0xfd, 0xa6, 0x10,
+    0x0, 0x0, 0x0,
+
+    /* U+0050 "P" */
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xec, 0x94, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x40, 0x0, 0xaf, 0xfe, 0xcc, 0xcc, 0xcc,
+    0xdf, 0xff, 0xff, 0x70, 0xa, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x5, 0xdf, 0xff, 0x40, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfd, 0xa,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xf2, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0x5a, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xf6, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0x5a, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf2, 0xaf,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfd,
+    0xa, 0xff, 0x90, 0x0, 0x0, 0x0, 0x5, 0xdf,
+    0xff, 0x40, 0xaf, 0xfe, 0xcc, 0xcc, 0xcc, 0xdf,
+    0xff, 0xff, 0x70, 0xa, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x40, 0x0, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xec, 0x94, 0x0, 0x0, 0xa, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+0051 "Q" */
+    0x0, 0x0, 0x0, 0x1, 0x6a, 0xdf, 0xff, 0xda,
+    0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xfe,
+    0xde, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xa4, 0x0, 0x0, 0x5, 0xbf,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe4,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0xef, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xd0, 0x0, 0x7, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xf5, 0x0, 0xd, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfc, 0x0,
+    0x2f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0x0, 0x5f, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0x30, 0x6f, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x40, 0x7f,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0x50, 0x5f, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0x30, 0x3f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0x10, 0xe, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xfc, 0x0, 0x9, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0,
+    0x1, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1e, 0xff, 0xd0, 0x0, 0x0, 0x6f, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff,
+    0x30, 0x0, 0x0, 0x9, 0xff, 0xff, 0x93, 0x0,
+    0x0, 0x3, 0x9f, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xff, 0xec, 0xbc, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xff,
+    0xfe, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0x60, 0x0,
+    0x0, 0x8, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfa, 0x30, 0x14, 0xcf, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xcf, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x67, 0x74, 0x0, 0x0,
+
+    /* U+0052 "R" */
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xec, 0x94, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x40, 0x0, 0xaf, 0xfe, 0xcc, 0xcc, 0xcc,
+    0xdf, 0xff, 0xff, 0x70, 0xa, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x5, 0xdf, 0xff, 0x40, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfd, 0xa,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xf2, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0x5a, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xf6, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0x5a, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf2, 0xaf,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfd,
+    0xa, 0xff, 0x90, 0x0, 0x0, 0x0, 0x5, 0xdf,
+    0xff, 0x40, 0xaf, 0xfd, 0xbb, 0xbb, 0xbb, 0xcf,
+    0xff, 0xff, 0x70, 0xa, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x40, 0x0, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xa, 0xff,
+    0x90, 0x0, 0x0, 0x2, 0xff, 0xf5, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x6, 0xff, 0xe1,
+    0x0, 0xa, 0xff, 0x90, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xb0, 0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0x60, 0xa, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0x20, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfc, 0xa,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
+    0xf7,
+
+    /* U+0053 "S" */
+    0x0, 0x0, 0x16, 0xbd, 0xef, 0xed, 0xa6, 0x10,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfa, 0x20, 0x0, 0xbf, 0xff, 0xfd, 0xbb, 0xce,
+    0xff, 0xff, 0x60, 0x7, 0xff, 0xf9, 0x10, 0x0,
+    0x0, 0x27, 0xde, 0x0, 0xd, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0x0, 0xf, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xcf, 0xff, 0xfc, 0x84, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xfc,
+    0x72, 0x0, 0x0, 0x0, 0x0, 0x17, 0xcf, 0xff,
+    0xff, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x48, 0xcf, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x7f, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf7, 0xc, 0x70, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf4, 0x5f, 0xfe, 0x83, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xd0, 0x4e, 0xff, 0xff, 0xfd, 0xbb,
+    0xcf, 0xff, 0xfe, 0x20, 0x1, 0x9f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x1, 0x59,
+    0xce, 0xff, 0xec, 0x83, 0x0, 0x0,
+
+    /* U+0054 "T" */
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0xac, 0xcc, 0xcc, 0xcc, 0xff,
+    0xfc, 0xcc, 0xcc, 0xcc, 0x80, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+0055 "U" */
+    0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xf1, 0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xf1, 0xdf, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xf1, 0xdf, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1,
+    0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xf1, 0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xf1, 0xdf, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xf1, 0xdf, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1,
+    0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xf1, 0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xf1, 0xdf, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xf1, 0xdf, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1,
+    0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xf1, 0xcf, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf0, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x7f, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xb0,
+    0x2f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0x70, 0xb, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0x10, 0x2, 0xff, 0xff, 0x71,
+    0x0, 0x0, 0x5d, 0xff, 0xf6, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xed, 0xef, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe6,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x9d, 0xef, 0xfd,
+    0xa6, 0x0, 0x0, 0x0,
+
+    /* U+0056 "V" */
+    0xc, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xf9, 0x5, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf2,
+    0x0, 0xef, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xb0, 0x0, 0x7f, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x30,
+    0x0, 0x1f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xfc, 0x0, 0x0, 0x9, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf5, 0x0,
+    0x0, 0x2, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xaf, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0x10, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xf1, 0x0, 0x0, 0x2,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xf8, 0x0, 0x0, 0x8, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0x0, 0x0, 0xf,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0x70, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xd0, 0x0, 0xef,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf5, 0x5, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xfc, 0xc, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0057 "W" */
+    0xcf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xfd, 0x7, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0x80, 0x1f, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xf2, 0x0, 0xcf, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xfd, 0x0, 0x7, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfe, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x9, 0xff, 0x70, 0x0,
+    0x1f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x4f, 0xfa,
+    0x9f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf2,
+    0x0, 0x0, 0xcf, 0xf8, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0x53, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x4f,
+    0xfc, 0x0, 0x0, 0x6, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0xff, 0xf0, 0xe, 0xff, 0x30, 0x0, 0x0,
+    0x9, 0xff, 0x70, 0x0, 0x0, 0x1f, 0xff, 0x30,
+    0x0, 0x0, 0x5f, 0xfa, 0x0, 0x8f, 0xf8, 0x0,
+    0x0, 0x0, 0xef, 0xf1, 0x0, 0x0, 0x0, 0xbf,
+    0xf8, 0x0, 0x0, 0xa, 0xff, 0x40, 0x3, 0xff,
+    0xd0, 0x0, 0x0, 0x4f, 0xfc, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xd0, 0x0, 0x0, 0xff, 0xe0, 0x0,
+    0xd, 0xff, 0x30, 0x0, 0xa, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0x30, 0x0, 0x6f, 0xf9,
+    0x0, 0x0, 0x7f, 0xf9, 0x0, 0x0, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf8, 0x0, 0xb,
+    0xff, 0x30, 0x0, 0x2, 0xff, 0xe0, 0x0, 0x5f,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xe0,
+    0x1, 0xff, 0xe0, 0x0, 0x0, 0xc, 0xff, 0x40,
+    0xa, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0x30, 0x6f, 0xf8, 0x0, 0x0, 0x0, 0x7f,
+    0xf9, 0x0, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xf9, 0xc, 0xff, 0x30, 0x0, 0x0,
+    0x1, 0xff, 0xe0, 0x5f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xe2, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0x4b, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xbf, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfb, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+0058 "X" */
+    0xb, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0x30, 0x1, 0xef, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xef, 0xf6, 0x0, 0x0, 0x3f,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0xc, 0xff, 0xa0,
+    0x0, 0x0, 0x7, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x8f, 0xfe, 0x10, 0x0, 0x0, 0x0, 0xbf, 0xfd,
+    0x0, 0x0, 0x4, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x1e, 0xff, 0xa0, 0x0, 0x1e, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf6, 0x0,
+    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0x27, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xdf, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0x5d, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf9, 0x2,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xc0, 0x0, 0x6f, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0x20, 0x0, 0xa, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0xdf, 0xfc, 0x0, 0x0, 0x0, 0x1e,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x80,
+    0x0, 0x0, 0xbf, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xf4, 0x0, 0x7, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe, 0x10, 0x3f,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
+    0xff, 0xb0,
+
+    /* U+0059 "Y" */
+    0xc, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xf8, 0x3, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xd0, 0x0, 0x9f,
+    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0x40, 0x0, 0xe, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xfa, 0x0, 0x0, 0x5, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x50, 0x0,
+    0x0, 0x6f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xe0, 0x0, 0x1, 0xef, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xf8, 0x0, 0x9, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0x20, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xc0, 0xdf, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xfc, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+005A "Z" */
+    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xb0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb0, 0x4c, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xef, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xdf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc1,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf1,
+
+    /* U+005B "[" */
+    0xaf, 0xff, 0xff, 0xf0, 0xaf, 0xff, 0xff, 0xf0,
+    0xaf, 0xfb, 0x88, 0x80, 0xaf, 0xf7, 0x0, 0x0,
+    0xaf, 0xf7, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0,
+    0xaf, 0xf7, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0,
+    0xaf, 0xf7, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0,
+    0xaf, 0xf7, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0,
+    0xaf, 0xf7, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0,
+    0xaf, 0xf7, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0,
+    0xaf, 0xf7, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0,
+    0xaf, 0xf7, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0,
+    0xaf, 0xf7, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0,
+    0xaf, 0xf7, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0,
+    0xaf, 0xf7, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0,
+    0xaf, 0xf7, 0x0, 0x0, 0xaf, 0xfb, 0x88, 0x80,
+    0xaf, 0xff, 0xff, 0xf0, 0xaf, 0xff, 0xff, 0xf0,
+
+    /* U+005C "\\" */
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xe0,
+
+    /* U+005D "]" */
+    0x6f, 0xff, 0xff, 0xf4, 0x6f, 0xff, 0xff, 0xf4,
+    0x38, 0x88, 0xef, 0xf4, 0x0, 0x0, 0xcf, 0xf4,
+    0x0, 0x0, 0xcf, 0xf4, 0x0, 0x0, 0xcf, 0xf4,
+    0x0, 0x0, 0xcf, 0xf4, 0x0, 0x0, 0xcf, 0xf4,
+    0x0, 0x0, 0xcf, 0xf4, 0x0, 0x0, 0xcf, 0xf4,
+    0x0, 0x0, 0xcf, 0xf4, 0x0, 0x0, 0xcf, 0xf4,
+    0x0, 0x0, 0xcf, 0xf4, 0x0, 0x0, 0xcf, 0xf4,
+    0x0, 0x0, 0xcf, 0xf4, 0x0, 0x0, 0xcf, 0xf4,
+    0x0, 0x0, 0xcf, 0xf4, 0x0, 0x0, 0xcf, 0xf4,
+    0x0, 0x0, 0xcf, 0xf4, 0x0, 0x0, 0xcf, 0xf4,
+    0x0, 0x0, 0xcf, 0xf4, 0x0, 0x0, 0xcf, 0xf4,
+    0x0, 0x0, 0xcf, 0xf4, 0x0, 0x0, 0xcf, 0xf4,
+    0x0, 0x0, 0xcf, 0xf4, 0x0, 0x0, 0xcf, 0xf4,
+    0x0, 0x0, 0xcf, 0xf4, 0x38, 0x88, 0xef, 0xf4,
+    0x6f, 0xff, 0xff, 0xf4, 0x6f, 0xff, 0xff, 0xf4,
+
+    /* U+005E "^" */
+    0x0, 0x0, 0x2, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xfe, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xfe, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0x70, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x5f,
+    0xf1, 0x6, 0xff, 0x0, 0x0, 0x0, 0xc, 0xfa,
+    0x0, 0xe, 0xf6, 0x0, 0x0, 0x3, 0xff, 0x30,
+    0x0, 0x8f, 0xd0, 0x0, 0x0, 0xaf, 0xc0, 0x0,
+    0x1, 0xff, 0x40, 0x0, 0x1f, 0xf5, 0x0, 0x0,
+    0xa, 0xfb, 0x0, 0x8, 0xfe, 0x0, 0x0, 0x0,
+    0x4f, 0xf2, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0,
+    0xdf, 0x90, 0x6f, 0xf1, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0x10,
+
+    /* U+005F "_" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+
+    /* U+0060 "`" */
+    0x8, 0xff, 0xf3, 0x0, 0x0, 0x4, 0xef, 0xf4,
+    0x0, 0x0, 0x1, 0xcf, 0xf6, 0x0, 0x0, 0x0,
+    0x8f, 0xf7,
+
+    /* U+0061 "a" */
+    0x0, 0x2, 0x8b, 0xef, 0xfe, 0xb6, 0x0, 0x0,
+    0x2, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0,
+    0xb, 0xff, 0xfe, 0xba, 0xbd, 0xff, 0xff, 0x20,
+    0x2, 0xfa, 0x30, 0x0, 0x0, 0x3e, 0xff, 0xb0,
+    0x0, 0x10, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5,
+    0x0, 0x5, 0xad, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0x1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0xb, 0xff, 0xe8, 0x43, 0x33, 0x33, 0xcf, 0xf5,
+    0x2f, 0xff, 0x20, 0x0, 0x0, 0x0, 0xbf, 0xf5,
+    0x5f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5,
+    0x5f, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf5,
+    0x2f, 0xff, 0x30, 0x0, 0x0, 0x2d, 0xff, 0xf5,
+    0xa, 0xff, 0xe8, 0x43, 0x49, 0xff, 0xff, 0xf5,
+    0x0, 0xbf, 0xff, 0xff, 0xff, 0xfa, 0x9f, 0xf5,
+    0x0, 0x5, 0xbe, 0xff, 0xda, 0x40, 0x9f, 0xf5,
+
+    /* U+0062 "b" */
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xf0, 0x4, 0x9d, 0xff,
+    0xda, 0x40, 0x0, 0x0, 0x1f, 0xff, 0xa, 0xff,
+    0xff, 0xff, 0xff, 0xc1, 0x0, 0x1, 0xff, 0xfc,
+    0xff, 0xfc, 0xbc, 0xff, 0xff, 0xe3, 0x0, 0x1f,
+    0xff, 0xff, 0x91, 0x0, 0x0, 0x6f, 0xff, 0xd1,
+    0x1, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0x90, 0x1f, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0x1, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xf4, 0x1f, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x61, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7,
+    0x1f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0x61, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xf4, 0x1f, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0x1, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0x90, 0x1f, 0xff,
+    0xff, 0x91, 0x0, 0x0, 0x6f, 0xff, 0xd1, 0x1,
+    0xff, 0xec, 0xff, 0xfc, 0xbc, 0xff, 0xff, 0xf3,
+    0x0, 0x1f, 0xfd, 0x1b, 0xff, 0xff, 0xff, 0xff,
+    0xc2, 0x0, 0x1, 0xff, 0xd0, 0x4, 0xad, 0xff,
+    0xda, 0x40, 0x0, 0x0,
+
+    /* U+0063 "c" */
+    0x0, 0x0, 0x4, 0x9d, 0xff, 0xdb, 0x61, 0x0,
+    0x0, 0x0, 0x2c, 0xff, 0xff, 0xff, 0xff, 0xe5,
+    0x0, 0x0, 0x3f, 0xff, 0xfe, 0xcb, 0xdf, 0xff,
+    0xf6, 0x0, 0x1e, 0xff, 0xe5, 0x0, 0x0, 0x2a,
+    0xff, 0xe0, 0xb, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0x9, 0xa1, 0x2, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xd1, 0x0, 0x0, 0x0, 0x9, 0xa1, 0x0, 0x1e,
+    0xff, 0xe5, 0x0, 0x0, 0x2a, 0xff, 0xe0, 0x0,
+    0x3f, 0xff, 0xfe, 0xcb, 0xdf, 0xff, 0xf5, 0x0,
+    0x0, 0x2c, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0,
+    0x0, 0x0, 0x4, 0x9d, 0xff, 0xeb, 0x61, 0x0,
+    0x0,
+
+    /* U+0064 "d" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfe, 0x0,
+    0x0, 0x5, 0xbe, 0xff, 0xd9, 0x20, 0x2f, 0xfe,
+    0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xf8, 0x2f,
+    0xfe, 0x0, 0x5f, 0xff, 0xfe, 0xcb, 0xdf, 0xff,
+    0xcf, 0xfe, 0x2, 0xff, 0xfe, 0x50, 0x0, 0x2,
+    0xbf, 0xff, 0xfe, 0xc, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfe, 0x2f, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xfe, 0x7f, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x9f, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0xaf,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfe,
+    0x9f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xfe, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xfe, 0x2f, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xfe, 0xc, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xfe, 0x2, 0xff, 0xfc, 0x20,
+    0x0, 0x0, 0x8f, 0xff, 0xfe, 0x0, 0x5f, 0xff,
+    0xfb, 0x98, 0xaf, 0xff, 0xcf, 0xfe, 0x0, 0x3,
+    0xdf, 0xff, 0xff, 0xff, 0xfa, 0x1f, 0xfe, 0x0,
+    0x0, 0x6, 0xbe, 0xff, 0xd9, 0x30, 0xf, 0xfe,
+
+    /* U+0065 "e" */
+    0x0, 0x0, 0x5, 0xbe, 0xff, 0xd9, 0x40, 0x0,
+    0x0, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xfb,
+    0x10, 0x0, 0x0, 0x5f, 0xff, 0xfb, 0x9a, 0xcf,
+    0xff, 0xe1, 0x0, 0x2, 0xff, 0xf9, 0x10, 0x0,
+    0x2, 0xcf, 0xfc, 0x0, 0xb, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0x60, 0x2f, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xc0, 0x7f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0, 0x9f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf3, 0x9f, 0xf9, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x30, 0x6f, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x1, 0x80, 0x0, 0x2, 0xef, 0xfe,
+    0x50, 0x0, 0x0, 0x5d, 0xf8, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xcb, 0xce, 0xff, 0xfc, 0x0, 0x0,
+    0x2, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x4, 0x9d, 0xff, 0xec, 0x83, 0x0,
+    0x0,
+
+    /* U+0066 "f" */
+    0x0, 0x0, 0x1, 0x9d, 0xff, 0xd7, 0x0, 0x0,
+    0x3, 0xef, 0xff, 0xff, 0xf3, 0x0, 0x0, 0xef,
+    0xfe, 0x99, 0xdd, 0x0, 0x0, 0x5f, 0xfe, 0x10,
+    0x0, 0x10, 0x0, 0x8, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0x60, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x40, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xf4, 0x4, 0x88, 0xdf, 0xfb, 0x88, 0x88,
+    0x20, 0x0, 0xa, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf7, 0x0, 0x0, 0x0,
+
+    /* U+0067 "g" */
+    0x0, 0x0, 0x5, 0xad, 0xff, 0xd9, 0x40, 0xc,
+    0xff, 0x20, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xff,
+    0xb1, 0xcf, 0xf2, 0x0, 0x7f, 0xff, 0xfe, 0xbb,
+    0xcf, 0xff, 0xdd, 0xff, 0x20, 0x4f, 0xff, 0xc3,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xf2, 0xd, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x24,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xf2, 0x8f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0x2a, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xf2, 0xaf, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x28, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf2, 0x4f,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0x20, 0xdf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xf2, 0x4, 0xff, 0xfd, 0x40, 0x0, 0x1,
+    0x7f, 0xff, 0xff, 0x20, 0x6, 0xff, 0xff, 0xec,
+    0xbc, 0xff, 0xfd, 0xff, 0xf2, 0x0, 0x4, 0xef,
+    0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0x20, 0x0,
+    0x0, 0x6b, 0xef, 0xfd, 0x94, 0x0, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xc0, 0x0, 0x64, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0xf7, 0x0, 0x2f, 0xfb, 0x50,
+    0x0, 0x0, 0x5, 0xef, 0xfe, 0x0, 0x7, 0xff,
+    0xff, 0xfd, 0xbb, 0xcf, 0xff, 0xff, 0x40, 0x0,
+    0x5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x30,
+    0x0, 0x0, 0x0, 0x38, 0xbd, 0xff, 0xed, 0xa5,
+    0x0, 0x0, 0x0,
+
+    /* U+0068 "h" */
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0x0, 0x4a, 0xdf, 0xfd, 0xa3, 0x0, 0x0,
+    0x1f, 0xff, 0x1c, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x1f, 0xff, 0xdf, 0xff, 0xcc, 0xdf, 0xff,
+    0xf9, 0x0, 0x1f, 0xff, 0xff, 0x60, 0x0, 0x2,
+    0xcf, 0xff, 0x30, 0x1f, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0x90, 0x1f, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xd0, 0x1f, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xf0, 0x1f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0,
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xf0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xf0, 0x1f, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf0, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xf0, 0x1f, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x1f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0,
+
+    /* U+0069 "i" */
+    0x1b, 0xfb, 0x8, 0xff, 0xf6, 0x8f, 0xff, 0x61,
+    0xbe, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf0, 0x1f, 0xff, 0x1, 0xff,
+    0xf0, 0x1f, 0xff, 0x1, 0xff, 0xf0, 0x1f, 0xff,
+    0x1, 0xff, 0xf0, 0x1f, 0xff, 0x1, 0xff, 0xf0,
+    0x1f, 0xff, 0x1, 0xff, 0xf0, 0x1f, 0xff, 0x1,
+    0xff, 0xf0, 0x1f, 0xff, 0x1, 0xff, 0xf0, 0x1f,
+    0xff, 0x1, 0xff, 0xf0,
+
+    /* U+006A "j" */
+    0x0, 0x0, 0x0, 0xaf, 0xc1, 0x0, 0x0, 0x5,
+    0xff, 0xf9, 0x0, 0x0, 0x5, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0xae, 0xb1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf2,
+    0x0, 0x0, 0x0, 0xef, 0xf2, 0x0, 0x0, 0x0,
+    0xef, 0xf2, 0x0, 0x0, 0x0, 0xef, 0xf2, 0x0,
+    0x0, 0x0, 0xef, 0xf2, 0x0, 0x0, 0x0, 0xef,
+    0xf2, 0x0, 0x0, 0x0, 0xef, 0xf2, 0x0, 0x0,
+    0x0, 0xef, 0xf2, 0x0, 0x0, 0x0, 0xef, 0xf2,
+    0x0, 0x0, 0x0, 0xef, 0xf2, 0x0, 0x0, 0x0,
+    0xef, 0xf2, 0x0, 0x0, 0x0, 0xef, 0xf2, 0x0,
+    0x0, 0x0, 0xef, 0xf2, 0x0, 0x0, 0x0, 0xef,
+    0xf2, 0x0, 0x0, 0x0, 0xef, 0xf2, 0x0, 0x0,
+    0x0, 0xef, 0xf2, 0x0, 0x0, 0x0, 0xef, 0xf2,
+    0x0, 0x0, 0x0, 0xff, 0xf2, 0x0, 0x0, 0x1,
+    0xff, 0xf0, 0x2, 0x0, 0x8, 0xff, 0xd0, 0x5f,
+    0xb9, 0xcf, 0xff, 0x70, 0xbf, 0xff, 0xff, 0xfb,
+    0x0, 0x4a, 0xdf, 0xfc, 0x60, 0x0,
+
+    /* U+006B "k" */
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x60,
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf6,
+    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0x60, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x9, 0xff,
+    0xf6, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0xaf,
+    0xff, 0x60, 0x0, 0x0, 0x1f, 0xff, 0x0, 0xb,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x1,
+    0xcf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0x1d, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xef, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xe6, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xfd, 0x20, 0x6f, 0xff, 0x80,
+    0x0, 0x0, 0x1f, 0xff, 0xc1, 0x0, 0x9, 0xff,
+    0xf5, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0x20, 0x0, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0x1e, 0xff, 0xd0, 0x0, 0x1f, 0xff, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xfa, 0x0, 0x1f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x70, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf4,
+
+    /* U+006C "l" */
+    0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff,
+    0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff,
+    0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff,
+    0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff,
+    0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff,
+    0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff,
+
+    /* U+006D "m" */
+    0x1f, 0xfd, 0x0, 0x6b, 0xef, 0xec, 0x71, 0x0,
+    0x0, 0x49, 0xde, 0xfe, 0xa4, 0x0, 0x0, 0x1f,
+    0xfd, 0x3d, 0xff, 0xff, 0xff, 0xff, 0x50, 0x1b,
+    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x1f, 0xfe,
+    0xef, 0xfc, 0xa9, 0xcf, 0xff, 0xf5, 0xdf, 0xff,
+    0xb9, 0xae, 0xff, 0xfb, 0x0, 0x1f, 0xff, 0xfd,
+    0x30, 0x0, 0x3, 0xef, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x8f, 0xff, 0x50, 0x1f, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xb0, 0x1f, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xe0, 0x1f, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xf0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1,
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xf1, 0x1f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xf1, 0x1f, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xf1, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xf1, 0x1f, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xf1, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xf1, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1,
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1,
+
+    /* U+006E "n" */
+    0x1f, 0xfd, 0x0, 0x5a, 0xdf, 0xfd, 0xa3, 0x0,
+    0x0, 0x1f, 0xfd, 0x2d, 0xff, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x1f, 0xfe, 0xef, 0xfd, 0xa9, 0xbf,
+    0xff, 0xf9, 0x0, 0x1f, 0xff, 0xfe, 0x40, 0x0,
+    0x0, 0xaf, 0xff, 0x30, 0x1f, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0x90, 0x1f, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xd0, 0x1f, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf0, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0,
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xf0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xf0, 0x1f, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf0, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xf0, 0x1f, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x1f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0,
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xf0,
+
+    /* U+006F "o" */
+    0x0, 0x0, 0x4, 0xad, 0xff, 0xeb, 0x60, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xff, 0xfe,
+    0x50, 0x0, 0x0, 0x4f, 0xff, 0xfe, 0xcb, 0xdf,
+    0xff, 0xf8, 0x0, 0x2, 0xef, 0xfe, 0x50, 0x0,
+    0x2, 0xbf, 0xff, 0x50, 0xb, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xf1, 0x2f, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf7, 0x6f, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfb, 0x9f,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe,
+    0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0x9f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfe, 0x6f, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xfb, 0x2f, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xf7, 0xb, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xf1, 0x1, 0xef, 0xfe,
+    0x40, 0x0, 0x2, 0xbf, 0xff, 0x50, 0x0, 0x4f,
+    0xff, 0xfe, 0xbb, 0xdf, 0xff, 0xf8, 0x0, 0x0,
+    0x2, 0xcf, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0,
+    0x0, 0x0, 0x4, 0xad, 0xff, 0xeb, 0x60, 0x0,
+    0x0,
+
+    /* U+0070 "p" */
+    0x1f, 0xfd, 0x0, 0x4a, 0xdf, 0xfd, 0xa4, 0x0,
+    0x0, 0x1, 0xff, 0xd1, 0xcf, 0xff, 0xff, 0xff,
+    0xfc, 0x10, 0x0, 0x1f, 0xfe, 0xdf, 0xfe, 0xa8,
+    0x9d, 0xff, 0xfe, 0x30, 0x1, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x4, 0xef, 0xfd, 0x10, 0x1f, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf9, 0x1,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xf0, 0x1f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0x41, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xf6, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0x71, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf6, 0x1f,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0x41, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xf0, 0x1f, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xf9, 0x1, 0xff, 0xff, 0xf9, 0x10,
+    0x0, 0x6, 0xff, 0xfd, 0x10, 0x1f, 0xff, 0xbf,
+    0xff, 0xcb, 0xcf, 0xff, 0xff, 0x30, 0x1, 0xff,
+    0xf0, 0xaf, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x0,
+    0x1f, 0xff, 0x0, 0x39, 0xdf, 0xfd, 0xa4, 0x0,
+    0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+0071 "q" */
+    0x0, 0x0, 0x5, 0xbe, 0xff, 0xd9, 0x30, 0xf,
+    0xfe, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xf9,
+    0xf, 0xfe, 0x0, 0x5f, 0xff, 0xfe, 0xcb, 0xdf,
+    0xff, 0xaf, 0xfe, 0x2, 0xff, 0xfe, 0x50, 0x0,
+    0x2, 0xbf, 0xff, 0xfe, 0xc, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xfe, 0x2f, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xfe, 0x7f, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x9f,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe,
+    0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xfe, 0x9f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfe, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xfe, 0x2f, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xfe, 0xc, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xfe, 0x2, 0xff, 0xfe,
+    0x40, 0x0, 0x2, 0xbf, 0xff, 0xfe, 0x0, 0x5f,
+    0xff, 0xfe, 0xbb, 0xdf, 0xff, 0xbf, 0xfe, 0x0,
+    0x3, 0xdf, 0xff, 0xff, 0xff, 0xf8, 0x2f, 0xfe,
+    0x0, 0x0, 0x6, 0xbe, 0xff, 0xd8, 0x20, 0x2f,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfe,
+
+    /* U+0072 "r" */
+    0x1f, 0xfd, 0x0, 0x5a, 0xdf, 0x1, 0xff, 0xd1,
+    0xbf, 0xff, 0xf0, 0x1f, 0xfd, 0xcf, 0xff, 0xfe,
+    0x1, 0xff, 0xff, 0xf9, 0x30, 0x0, 0x1f, 0xff,
+    0xf5, 0x0, 0x0, 0x1, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0x40, 0x0, 0x0, 0x1, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0073 "s" */
+    0x0, 0x0, 0x4a, 0xdf, 0xfe, 0xd9, 0x50, 0x0,
+    0x0, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0xdf, 0xff, 0xdb, 0xaa, 0xdf, 0xff, 0x10,
+    0x6, 0xff, 0xe3, 0x0, 0x0, 0x1, 0x87, 0x0,
+    0xa, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xf7, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xfd, 0xa7, 0x40, 0x0, 0x0,
+    0x0, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x0,
+    0x0, 0x0, 0x15, 0x9c, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x6e, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf0,
+    0x0, 0x20, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0,
+    0x6, 0xf9, 0x30, 0x0, 0x0, 0xa, 0xff, 0xd0,
+    0xe, 0xff, 0xff, 0xca, 0xac, 0xff, 0xff, 0x50,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x5, 0x9c, 0xef, 0xfe, 0xb7, 0x10, 0x0,
+
+    /* U+0074 "t" */
+    0x0, 0x5, 0x88, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf4,
+    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x48,
+    0x8d, 0xff, 0xb8, 0x88, 0x82, 0x0, 0x0, 0xaf,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xfe, 0x10, 0x0, 0x20, 0x0, 0x1, 0xff,
+    0xff, 0xaa, 0xdd, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x3, 0xae, 0xff, 0xc6,
+    0x0,
+
+    /* U+0075 "u" */
+    0x4f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xb4, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xfb, 0x4f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xb4, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xfb, 0x4f, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xb4, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xfb, 0x4f, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xb4, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xfb, 0x4f, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xb3, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xfb, 0x3f, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xb1, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xfb, 0xd, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xb0, 0x7f,
+    0xff, 0x60, 0x0, 0x0, 0x6f, 0xff, 0xfb, 0x0,
+    0xcf, 0xff, 0xd9, 0x9a, 0xef, 0xfd, 0xff, 0xb0,
+    0x1, 0xbf, 0xff, 0xff, 0xff, 0xfa, 0x3f, 0xfb,
+    0x0, 0x0, 0x4a, 0xef, 0xfd, 0x93, 0x3, 0xff,
+    0xb0,
+
+    /* U+0076 "v" */
+    0xd, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xb0, 0x6f, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xf4, 0x0, 0xef, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xfd, 0x0, 0x8, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0x60, 0x0, 0x1f,
+    0xff, 0x10, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
+    0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x8f, 0xf8,
+    0x0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0xe,
+    0xff, 0x10, 0x0, 0x0, 0xc, 0xff, 0x50, 0x0,
+    0x5, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x5f, 0xfc,
+    0x0, 0x0, 0xcf, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xf3, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0x90, 0xa, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0x12, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf7, 0x8f,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xef, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xfb, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+0077 "w" */
+    0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x64, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xf0, 0xe, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x1f, 0xfa, 0x0, 0x8f, 0xf6, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x7,
+    0xff, 0x40, 0x2, 0xff, 0xb0, 0x0, 0x0, 0x8,
+    0xff, 0xbf, 0xf6, 0x0, 0x0, 0x0, 0xdf, 0xe0,
+    0x0, 0xc, 0xff, 0x10, 0x0, 0x0, 0xef, 0xd1,
+    0xff, 0xc0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0,
+    0x6f, 0xf7, 0x0, 0x0, 0x4f, 0xf7, 0xb, 0xff,
+    0x20, 0x0, 0x9, 0xff, 0x20, 0x0, 0x1, 0xff,
+    0xd0, 0x0, 0xa, 0xff, 0x10, 0x4f, 0xf8, 0x0,
+    0x0, 0xef, 0xc0, 0x0, 0x0, 0xa, 0xff, 0x30,
+    0x1, 0xff, 0xb0, 0x0, 0xef, 0xe0, 0x0, 0x5f,
+    0xf6, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x7f,
+    0xf5, 0x0, 0x8, 0xff, 0x40, 0xb, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0xef, 0xe0, 0xd, 0xfe, 0x0,
+    0x0, 0x2f, 0xf9, 0x1, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x43, 0xff, 0x80, 0x0, 0x0,
+    0xcf, 0xf0, 0x7f, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xfa, 0x9f, 0xf2, 0x0, 0x0, 0x6, 0xff,
+    0x5d, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xfe, 0xfc, 0x0, 0x0, 0x0, 0x1f, 0xfd, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0x60, 0x0, 0x0, 0x0,
+
+    /* U+0078 "x" */
+    0xd, 0xff, 0x90, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0x70, 0x2, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xaf,
+    0xfb, 0x0, 0x0, 0x5f, 0xff, 0x20, 0x0, 0x6,
+    0xff, 0xd1, 0x0, 0x0, 0x8, 0xff, 0xd0, 0x0,
+    0x2f, 0xff, 0x30, 0x0, 0x0, 0x0, 0xcf, 0xf9,
+    0x0, 0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xff, 0x6a, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xdf, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfe, 0x16,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf4,
+    0x0, 0xaf, 0xfb, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0x80, 0x0, 0xd, 0xff, 0x70, 0x0, 0x0, 0x9f,
+    0xfc, 0x0, 0x0, 0x2, 0xff, 0xf4, 0x0, 0x6,
+    0xff, 0xe1, 0x0, 0x0, 0x0, 0x6f, 0xfe, 0x20,
+    0x3f, 0xff, 0x40, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xc0,
+
+    /* U+0079 "y" */
+    0xd, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xb0, 0x6f, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xf3, 0x0, 0xef, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x7, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0x50, 0x0, 0x1f,
+    0xff, 0x20, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
+    0x0, 0x9f, 0xf9, 0x0, 0x0, 0x0, 0x8f, 0xf7,
+    0x0, 0x0, 0x2, 0xff, 0xf1, 0x0, 0x0, 0xe,
+    0xff, 0x0, 0x0, 0x0, 0xb, 0xff, 0x70, 0x0,
+    0x6, 0xff, 0x90, 0x0, 0x0, 0x0, 0x3f, 0xfe,
+    0x0, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xf5, 0x0, 0x4f, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xc0, 0xb, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0x32, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfa, 0x9f,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x73, 0x0, 0x4,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfc,
+    0xab, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xae, 0xfe, 0xb5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+007A "z" */
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x48,
+    0x88, 0x88, 0x88, 0x88, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xb8, 0x88, 0x88, 0x88, 0x88,
+    0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+
+    /* U+007B "{" */
+    0x0, 0x0, 0x6, 0xcf, 0xfa, 0x0, 0x0, 0x9f,
+    0xff, 0xfa, 0x0, 0x3, 0xff, 0xfd, 0x95, 0x0,
+    0x7, 0xff, 0xd0, 0x0, 0x0, 0x9, 0xff, 0x80,
+    0x0, 0x0, 0x9, 0xff, 0x70, 0x0, 0x0, 0x9,
+    0xff, 0x70, 0x0, 0x0, 0x9, 0xff, 0x70, 0x0,
+    0x0, 0x9, 0xff, 0x70, 0x0, 0x0, 0x9, 0xff,
+    0x70, 0x0, 0x0, 0x9, 0xff, 0x70, 0x0, 0x0,
+    0x9, 0xff, 0x70, 0x0, 0x0, 0xa, 0xff, 0x60,
+    0x0, 0x0, 0x2e, 0xff, 0x40, 0x0, 0x2f, 0xff,
+    0xfc, 0x0, 0x0, 0x2f, 0xff, 0xf4, 0x0, 0x0,
+    0x18, 0xaf, 0xff, 0x20, 0x0, 0x0, 0xb, 0xff,
+    0x60, 0x0, 0x0, 0x9, 0xff, 0x70, 0x0, 0x0,
+    0x9, 0xff, 0x70, 0x0, 0x0, 0x9, 0xff, 0x70,
+    0x0, 0x0, 0x9, 0xff, 0x70, 0x0, 0x0, 0x9,
+    0xff, 0x70, 0x0, 0x0, 0x9, 0xff, 0x70, 0x0,
+    0x0, 0x9, 0xff, 0x70, 0x0, 0x0, 0x9, 0xff,
+    0x80, 0x0, 0x0, 0x8, 0xff, 0xd0, 0x0, 0x0,
+    0x3, 0xff, 0xfd, 0x85, 0x0, 0x0, 0xaf, 0xff,
+    0xfa, 0x0, 0x0, 0x6, 0xcf, 0xfa,
+
+    /* U+007C "|" */
+    0xaf, 0xf3, 0xaf, 0xf3, 0xaf, 0xf3, 0xaf, 0xf3,
+    0xaf, 0xf3, 0xaf, 0xf3, 0xaf, 0xf3, 0xaf, 0xf3,
+    0xaf, 0xf3, 0xaf, 0xf3, 0xaf, 0xf3, 0xaf, 0xf3,
+    0xaf, 0xf3, 0xaf, 0xf3, 0xaf, 0xf3, 0xaf, 0xf3,
+    0xaf, 0xf3, 0xaf, 0xf3, 0xaf, 0xf3, 0xaf, 0xf3,
+    0xaf, 0xf3, 0xaf, 0xf3, 0xaf, 0xf3, 0xaf, 0xf3,
+    0xaf, 0xf3, 0xaf, 0xf3, 0xaf, 0xf3, 0xaf, 0xf3,
+    0xaf, 0xf3, 0xaf, 0xf3,
+
+    /* U+007D "}" */
+    0x6f, 0xfd, 0x80, 0x0, 0x0, 0x6f, 0xff, 0xfc,
+    0x0, 0x0, 0x38, 0xcf, 0xff, 0x70, 0x0, 0x0,
+    0x9, 0xff, 0xb0, 0x0, 0x0, 0x4, 0xff, 0xd0,
+    0x0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x3,
+    0xff, 0xe0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0x0,
+    0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x3, 0xff,
+    0xe0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x0,
+    0x3, 0xff, 0xe0, 0x0, 0x0, 0x2, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xf6, 0x0, 0x0, 0x2d, 0xff, 0xf6,
+    0x0, 0x0, 0xef, 0xfc, 0x83, 0x0, 0x2, 0xff,
+    0xf0, 0x0, 0x0, 0x2, 0xff, 0xe0, 0x0, 0x0,
+    0x3, 0xff, 0xe0, 0x0, 0x0, 0x3, 0xff, 0xe0,
+    0x0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x3,
+    0xff, 0xe0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0x0,
+    0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x4, 0xff,
+    0xd0, 0x0, 0x0, 0x9, 0xff, 0xc0, 0x0, 0x38,
+    0xbf, 0xff, 0x70, 0x0, 0x6f, 0xff, 0xfd, 0x0,
+    0x0, 0x6f, 0xfd, 0x81, 0x0, 0x0,
+
+    /* U+007E "~" */
+    0x0, 0x1, 0x44, 0x10, 0x0, 0x0, 0x1, 0x54,
+    0x0, 0x6f, 0xff, 0xf9, 0x0, 0x0, 0x5, 0xfb,
+    0x4, 0xff, 0xff, 0xff, 0xd2, 0x0, 0xa, 0xf8,
+    0xb, 0xfd, 0x20, 0x7f, 0xfe, 0x62, 0x7f, 0xf3,
+    0xf, 0xf3, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xa0,
+    0x1f, 0xf0, 0x0, 0x0, 0x7, 0xdf, 0xe8, 0x0,
+
+    /* U+00B0 "°" */
+    0x0, 0x18, 0xdf, 0xea, 0x30, 0x0, 0x2e, 0xfe,
+    0xbd, 0xff, 0x60, 0xd, 0xf7, 0x0, 0x3, 0xef,
+    0x34, 0xfa, 0x0, 0x0, 0x4, 0xfb, 0x7f, 0x50,
+    0x0, 0x0, 0xf, 0xe7, 0xf5, 0x0, 0x0, 0x0,
+    0xfe, 0x4f, 0xa0, 0x0, 0x0, 0x4f, 0xb0, 0xdf,
+    0x70, 0x0, 0x3e, 0xf3, 0x2, 0xef, 0xec, 0xdf,
+    0xf7, 0x0, 0x1, 0x8d, 0xfe, 0xa3, 0x0,
+
+    /* U+2022 "•" */
+    0x5, 0xbb, 0x50, 0x5f, 0xff, 0xf5, 0xcf, 0xff,
+    0xfc, 0xdf, 0xff, 0xfd, 0x7f, 0xff, 0xf7, 0x8,
+    0xee, 0x80,
+
+    /* U+F001 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x9d, 0xd4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x7b, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x48, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x16, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8c,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x59, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xb6, 0x20, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe9, 0x40, 0x0, 0x0, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x72, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfe, 0xa5,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3a, 0xdf, 0xfd, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x3a, 0xdf, 0xfd, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xa0,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3a, 0xdf, 0xfd, 0xa3, 0x0,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3a, 0xdf, 0xfd, 0xa3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F008 "" */
+    0x8f, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xf8,
+    0xff, 0x20, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x2, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x20, 0x2, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x20, 0x2, 0xff,
+    0xff, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0xff,
+    0xff, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0xff,
+    0xff, 0x20, 0x2, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x20, 0x2, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x20, 0x2, 0xff, 0xfa, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0xaf, 0xff, 0x20, 0x2, 0xff,
+    0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff,
+    0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff,
+    0xff, 0x20, 0x2, 0xff, 0xfa, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0xaf, 0xff, 0x20, 0x2, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x20, 0x2, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x20, 0x2, 0xff,
+    0xff, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0xff,
+    0xff, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0xff,
+    0xff, 0x20, 0x2, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x20, 0x2, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x20, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x2, 0xff,
+    0x8f, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xf8,
+
+    /* U+F00B "" */
+    0x8f, 0xff, 0xff, 0xff, 0xc0, 0x4, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0xa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0xb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0xb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0xb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0xb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0xa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x8f, 0xff, 0xff, 0xff, 0xc0, 0x4, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xc0, 0x4, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0xa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0xb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0xb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0xb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0xb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0xa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x8f, 0xff, 0xff, 0xff, 0xc0, 0x4, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xc0, 0x4, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0xa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0xb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0xb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0xb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0xb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0xa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x8f, 0xff, 0xff, 0xff, 0xc0, 0x4, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+
+    /* U+F00C "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xd3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xe3, 0x0,
+    0x0, 0x3d, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xff, 0xff, 0xff, 0xfe, 0x30, 0x0,
+    0x4, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xdf, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x1,
+    0xdf, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x1d,
+    0xff, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
+    0x3e, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x1, 0xdf,
+    0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xef, 0xff, 0xff, 0xff, 0xd1, 0x1d, 0xff,
+    0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3e, 0xff, 0xff, 0xff, 0xfd, 0xdf, 0xff,
+    0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff,
+    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xfe,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xe2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xfe, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xc2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F00D "" */
+    0x1, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xfc, 0x10, 0x1e, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xe1, 0xcf, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0xfc, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+    0xa0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xf9, 0xa,
+    0xff, 0xff, 0xff, 0xfa, 0x0, 0xaf, 0xff, 0xff,
+    0xff, 0xa0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xaa,
+    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0xff, 0xaa, 0xff, 0xff, 0xff, 0xfa, 0x0,
+    0xa, 0xff, 0xff, 0xff, 0xfa, 0x0, 0xaf, 0xff,
+    0xff, 0xff, 0xa0, 0x9f, 0xff, 0xff, 0xff, 0xa0,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
+    0xff, 0xcf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xfc, 0x1e, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xe1, 0x1,
+    0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xfc, 0x10,
+
+    /* U+F011 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0x95, 0x0, 0x0, 0xef, 0xff, 0xf1,
+    0x0, 0x3, 0x94, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xf3, 0x0, 0xe, 0xff, 0xff, 0x10,
+    0x1, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xc0, 0x0, 0xef, 0xff, 0xf1, 0x0,
+    0x9f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xff, 0x10, 0xe, 0xff, 0xff, 0x10, 0xe,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x1, 0xef, 0xff,
+    0xff, 0xb0, 0x0, 0xef, 0xff, 0xf1, 0x0, 0x9f,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xb0, 0x0, 0xe, 0xff, 0xff, 0x10, 0x0, 0x9f,
+    0xff, 0xff, 0xc0, 0x0, 0x2f, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0xef, 0xff, 0xf1, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0x50, 0x9, 0xff, 0xff, 0xe1, 0x0,
+    0x0, 0xe, 0xff, 0xff, 0x10, 0x0, 0x0, 0xdf,
+    0xff, 0xfc, 0x0, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xf1, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xf1, 0x3f, 0xff, 0xff, 0x10, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0x10, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0x67, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xf9, 0x9f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xca, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfd,
+    0xbf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xda,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfd, 0x8f,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xb5, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf8, 0x2f, 0xff,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0x40, 0xcf, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xf0, 0x6, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xf9, 0x0, 0xe, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xff, 0xff, 0x20, 0x0, 0x5f, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0xaf, 0xff, 0xff,
+    0xfa, 0x20, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
+    0xff, 0xc7, 0x64, 0x57, 0xbf, 0xff, 0xff, 0xff,
+    0xe2, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xe8, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x26, 0x9a,
+    0xba, 0x97, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F013 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x46, 0x77,
+    0x64, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0x91, 0x0, 0x19,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0, 0x2a,
+    0x50, 0x0, 0x0, 0x3f, 0xff, 0x85, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x58, 0xff, 0xf3,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf7, 0xcf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb3, 0x0, 0x3b, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x3c, 0xff, 0xff, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xc3, 0x0, 0x6f, 0xff, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
+    0xf6, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xff, 0xf6, 0x0, 0x3c, 0xff, 0xff,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xc3, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb3, 0x0, 0x3b, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf7, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf1, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x3f, 0xff, 0x85, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x58, 0xff, 0xf3, 0x0, 0x0, 0x5,
+    0xa2, 0x0, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xa1, 0x0, 0x2a, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x46,
+    0x77, 0x64, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F015 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8e, 0xe8, 0x0, 0x0, 0x5, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0xff, 0xc1, 0x0, 0x8, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xef, 0xff, 0xff, 0xfe, 0x30,
+    0x8, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x8, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xfc, 0xcf, 0xff, 0xff, 0x88, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
+    0xff, 0xff, 0x80, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x5f, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xfe, 0x30, 0x1a, 0xa1,
+    0x3, 0xef, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc1, 0x2,
+    0xdf, 0xfd, 0x20, 0x1c, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfa,
+    0x0, 0x4f, 0xff, 0xff, 0xf4, 0x0, 0xaf, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff,
+    0xff, 0x70, 0x7, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x7, 0xff, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x3e,
+    0xff, 0xff, 0xf4, 0x0, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0xf9, 0x0, 0x4f, 0xff, 0xff, 0xd2, 0x0,
+    0x5, 0xff, 0xff, 0xfd, 0x20, 0x1c, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc1, 0x2, 0xdf, 0xff,
+    0xff, 0x50, 0x7f, 0xff, 0xff, 0xb1, 0x2, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20,
+    0x1c, 0xff, 0xff, 0xf7, 0xdf, 0xff, 0xf9, 0x0,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x0, 0x9f, 0xff, 0xfd, 0x3f, 0xff,
+    0x60, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x70, 0x6, 0xff, 0xf3,
+    0x6, 0xe4, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
+    0x4e, 0x60, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+
+    /* U+F019 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff,
+    0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
+    0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x2, 0xef,
+    0xfe, 0x20, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x2d,
+    0xd2, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x61,
+    0x16, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xee, 0xff, 0xee, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0xee, 0x0, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0xee, 0x0, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xee, 0xff, 0xee, 0xff, 0xff,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+
+    /* U+F01C "" */
+    0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0x50, 0x0, 0x0, 0x1e,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xe1, 0x0,
+    0x0, 0xaf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xfa, 0x0, 0x5, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0x50, 0x1e, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xe1, 0x9f, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf9,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x8, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x80,
+
+    /* U+F021 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x57,
+    0x75, 0x30, 0x0, 0x0, 0x0, 0x4, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x7c, 0xff, 0xff,
+    0xff, 0xff, 0xa4, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd5, 0x0, 0x5, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc2, 0x4, 0xff, 0xff,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff,
+    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xa5, 0x20,
+    0x2, 0x6b, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0,
+    0x0, 0x0, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0xd, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x8f, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff,
+    0x1, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x46, 0x54, 0x43, 0x5f, 0xff, 0xff, 0xff,
+    0x7, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x1f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x2f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf1,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xb0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x70,
+    0xff, 0xff, 0xff, 0xf5, 0x34, 0x45, 0x64, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xd0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x0, 0x0,
+    0x0, 0x0, 0x1a, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xb6, 0x20,
+    0x2, 0x5a, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0xff, 0xff, 0x45, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0xff, 0xff, 0x40, 0x2c, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0x50, 0x0, 0x5d, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x4a, 0xff, 0xff,
+    0xff, 0xff, 0xc7, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x3, 0x67,
+    0x76, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F026 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F027 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xe7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x7e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x8, 0xe7, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0xf, 0xff, 0x90,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0xa, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x9f, 0xfb,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x1f, 0xfe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x7f, 0xfc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x8, 0xff, 0xf5,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0xf, 0xff, 0xb0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0xa, 0xf9, 0x0,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F028 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xce,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3e,
+    0xc2, 0x0, 0x9, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0x40, 0x0, 0xcf, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf4, 0x0, 0x2f,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xfe,
+    0x10, 0x9, 0xff, 0xb0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0x90, 0x1, 0xff, 0xf1, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x9,
+    0xf8, 0x0, 0x4, 0xff, 0xf1, 0x0, 0xcf, 0xf6,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0xf, 0xff, 0xa0, 0x0, 0xcf, 0xf7, 0x0,
+    0x7f, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x9, 0xff, 0xf5, 0x0, 0x6f,
+    0xfb, 0x0, 0x3f, 0xfc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x8f, 0xfb,
+    0x0, 0x2f, 0xfe, 0x0, 0x1f, 0xfe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x1f, 0xfe, 0x0, 0xf, 0xff, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x1f, 0xfe, 0x0, 0xf, 0xff, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x8f, 0xfb, 0x0, 0x2f,
+    0xfe, 0x0, 0x2f, 0xfe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x9, 0xff, 0xf5,
+    0x0, 0x6f, 0xfb, 0x0, 0x3f, 0xfc, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xf,
+    0xff, 0xa0, 0x0, 0xcf, 0xf7, 0x0, 0x7f, 0xf9,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x9, 0xf8, 0x0, 0x4, 0xff, 0xf1, 0x0,
+    0xcf, 0xf6, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0x90, 0x2, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xfe, 0x10, 0x9, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xf4, 0x0, 0x2f, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0x40, 0x0, 0xcf,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x4e, 0xc2, 0x0,
+    0x9, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xce, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F03E "" */
+    0x8, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x80,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xff, 0xff, 0xfd, 0x88, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x90, 0x0, 0x9, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xf9, 0x9f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x90, 0x0, 0x9, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x88, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x99, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x8f, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x8, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x88, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x8, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x80,
+
+    /* U+F043 "" */
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xee, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x10, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf7, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x10, 0x9, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf1, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfb, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x33, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xdf, 0xff, 0x20, 0xcf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0x70,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x6f, 0xff, 0xe0, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0x1f, 0xff, 0xfb, 0x0, 0x4c,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x7, 0xff,
+    0xff, 0xb0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0x70, 0x0, 0xcf, 0xff, 0xfe, 0x72, 0x3, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x1e, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0,
+    0x1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x10, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x16, 0xbd, 0xff, 0xdb, 0x61, 0x0, 0x0, 0x0,
+
+    /* U+F048 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5e, 0xe5, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xfe, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x1c, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x2, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x2e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x83, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x2, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfe,
+    0xdf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+F04B "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xef,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfe, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xf9, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe5, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb2, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xb2, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe5, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x40, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfc,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xfe, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xee, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+F04C "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xff, 0xff, 0x90, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0xf9, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0xf9, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x7, 0xdf, 0xff, 0xff, 0xfd, 0x70, 0x0, 0x0,
+    0x7, 0xdf, 0xff, 0xff, 0xfd, 0x70,
+
+    /* U+F04D "" */
+    0x8, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x80, 0x8f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x8, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x80,
+
+    /* U+F051 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5e, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xfd, 0xef, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x10, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x20, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe3, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x38, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe2, 0x8, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
+    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xef, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0x5e, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+F052 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xee,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x1,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
+    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x40, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xe, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0x4, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x40,
+
+    /* U+F053 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfd, 0x10, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfd, 0x10,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xd1,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfd,
+    0x10, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
+    0xd1, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xc5, 0x0,
+
+    /* U+F054 "" */
+    0x0, 0x5, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xdf, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
+    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xdf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xdf, 0xff, 0xff, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5c, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+F067 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xfe,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F068 "" */
+    0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x4e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe4,
+
+    /* U+F06E "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0xad,
+    0xef, 0xfe, 0xda, 0x73, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7d,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xff, 0xff, 0xb5, 0x20, 0x2,
+    0x5b, 0xff, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x4e, 0xfc, 0x70, 0x0,
+    0xd, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x1f, 0xff,
+    0xfd, 0x10, 0x3, 0xff, 0xff, 0xff, 0xf6, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xd0, 0x0, 0xbf, 0xff, 0xff,
+    0xff, 0x30, 0xd, 0xff, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf7, 0x0, 0x5f,
+    0xff, 0xff, 0xff, 0xd0, 0x7f, 0xff, 0xff, 0xff,
+    0xf2, 0x0, 0x41, 0x17, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0x2f, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0xff, 0xfe,
+    0xef, 0xff, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xf2, 0x0,
+    0xcf, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x2f,
+    0xff, 0xff, 0xff, 0xf7, 0xc, 0xff, 0xff, 0xff,
+    0xf5, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x0, 0x5f, 0xff, 0xff, 0xff, 0xd0, 0x3, 0xff,
+    0xff, 0xff, 0xfb, 0x0, 0xc, 0xff, 0xff, 0xff,
+    0xff, 0xc0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x6f, 0xff, 0xff, 0xff, 0x30, 0x1, 0xcf,
+    0xff, 0xff, 0xfc, 0x10, 0x3, 0xff, 0xff, 0xff,
+    0xf6, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x6, 0xcf, 0xfc, 0x70, 0x0, 0xd, 0xff,
+    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xb5,
+    0x20, 0x2, 0x5b, 0xff, 0xff, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xd7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x37, 0xad, 0xef, 0xfe,
+    0xda, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F070 "" */
+    0x9, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xef, 0xff, 0xff, 0x60, 0x0, 0x0, 0x15,
+    0x9c, 0xef, 0xfe, 0xda, 0x73, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff,
+    0xfa, 0x0, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xde, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc7, 0x30, 0x2, 0x5b,
+    0xff, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xe4,
+    0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfe,
+    0x30, 0x4e, 0xfc, 0x70, 0x0, 0xd, 0xff, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x3e, 0xff, 0xff, 0xf7, 0x1f, 0xff, 0xfd,
+    0x10, 0x3, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x2, 0xf9, 0x0, 0x0, 0x1, 0xbf, 0xff,
+    0xff, 0xbf, 0xff, 0xff, 0xd0, 0x0, 0xbf, 0xff,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0xd, 0xff, 0xc2,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf7, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x7f, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x4e,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x2f, 0xff,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0xf, 0xff, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0xff, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xfc, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0xd, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0xff, 0x70, 0x6f, 0xff,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xfb, 0xdf, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff,
+    0xb5, 0x20, 0x1, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x2d, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7d, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x37, 0xad, 0xef, 0xfe, 0xca,
+    0x40, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3e, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0x90,
+
+    /* U+F071 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0x60, 0x0, 0x6, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0x40, 0x0, 0x4, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x5, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xff, 0xff, 0x70, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0xff, 0xff, 0x90, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
+    0xa, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xb0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0xd, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf9, 0x33, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x9,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x30, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x10, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf9, 0x33, 0x9f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x90, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
+
+    /* U+F074 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf9, 0x0,
+    0xdf, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x3,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xfe, 0x20, 0x3f,
+    0xff, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xf3, 0x2, 0xef,
+    0xff, 0xff, 0x90, 0x0, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0x40, 0x1e, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x1, 0xdf, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x8f, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfd,
+    0x10, 0x40, 0x0, 0x0, 0x8f, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xe1,
+    0x4, 0xfa, 0x0, 0x0, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfe, 0x20,
+    0x3f, 0xff, 0x90, 0x0, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf3, 0x2,
+    0xef, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xf9, 0x0,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x3,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
+    0xdf, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F077 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xf9, 0xcf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x80, 0xc,
+    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xcf, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
+    0x40, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xf4, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xff, 0x40, 0x6f, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xff, 0xf2, 0xbf, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0xf6, 0x4f, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xd1,
+    0x4, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xfd, 0x10, 0x0, 0x13,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x30, 0x0,
+
+    /* U+F078 "" */
+    0x0, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x4, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xfd, 0x10, 0x4f, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xd1, 0xbf, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf6,
+    0x6f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xff, 0xff, 0xf2, 0x8, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xff, 0xff, 0x40, 0x0, 0x8f, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
+    0xf4, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0xcf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0x80, 0xc, 0xff, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xf9, 0xcf, 0xff, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+F079 "" */
+    0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xff, 0xf5, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0x50, 0x3,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
+    0xff, 0xff, 0xf5, 0x0, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
+    0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfe, 0xff,
+    0xff, 0xef, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xf3, 0xff, 0xff, 0x3f, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x40, 0xff,
+    0xff, 0x4, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x6, 0xb4, 0x0, 0xff, 0xff, 0x0, 0x4b, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xb4, 0x0, 0xff, 0xff, 0x0, 0x4b, 0x60,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x40, 0xff,
+    0xff, 0x4, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xf3, 0xff, 0xff, 0x3f, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfe, 0xff,
+    0xff, 0xef, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1,
+    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x5f, 0xff, 0xff,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x30, 0x5, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x5f, 0xff,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+F07B "" */
+    0x8, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x80,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x8, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x80,
+
+    /* U+F093 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
+    0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
+    0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff,
+    0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x8f, 0xff,
+    0xff, 0xf8, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x20, 0x0,
+    0x0, 0x2, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xee, 0xff, 0xee, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0xee, 0x0, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0xee, 0x0, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xee, 0xff, 0xee, 0xff, 0xff,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+
+    /* U+F095 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xea, 0x63, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
+    0xb8, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0x20,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xcf, 0xfe,
+    0x20, 0x0, 0x0, 0x3, 0xef, 0xff, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x1, 0x7e, 0xff, 0xff,
+    0xfd, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x29, 0xff, 0xff, 0xff,
+    0xff, 0xfa, 0x0, 0x2b, 0xff, 0xff, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x9f, 0xff, 0xff, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x71, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xfe, 0xec, 0xa8, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+F0C4 "" */
+    0x0, 0x7, 0xcf, 0xfc, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
+    0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4b, 0xff, 0xc5, 0x0, 0xd, 0xff, 0xff,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xfa, 0x7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xff, 0xc0, 0xcf, 0xff, 0xb1, 0x1b, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xc1,
+    0xf, 0xff, 0xf1, 0x0, 0x1f, 0xff, 0xf0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xc1, 0x0, 0xff,
+    0xff, 0x10, 0x1, 0xff, 0xff, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xff, 0xc1, 0x0, 0xc, 0xff, 0xfb,
+    0x11, 0xbf, 0xff, 0xc0, 0x0, 0x9f, 0xff, 0xff,
+    0xff, 0xc1, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x10, 0x9f, 0xff, 0xff, 0xff, 0xc1,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0xaf, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0,
+    0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1d,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x10, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xca, 0xff, 0xff, 0xff, 0xfc,
+    0x10, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd1, 0x9, 0xff, 0xff, 0xff, 0xfc, 0x10,
+    0x0, 0x0, 0xcf, 0xff, 0xb1, 0x1b, 0xff, 0xfc,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x0,
+    0xf, 0xff, 0xf1, 0x0, 0x1f, 0xff, 0xf0, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x0, 0xff,
+    0xff, 0x10, 0x1, 0xff, 0xff, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xff, 0xfc, 0x10, 0xc, 0xff, 0xfb,
+    0x11, 0xbf, 0xff, 0xc0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xff, 0xfc, 0x10, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0xfc, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
+    0xa0, 0x1, 0xdf, 0xff, 0xff, 0xfd, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xbf, 0xfc, 0x50, 0x0,
+    0x0, 0x7c, 0xff, 0xc7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F0C5 "" */
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x20, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xfa, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F0C7 "" */
+    0x8, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xd6, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xf6, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfd,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x40, 0x4,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x40, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x8, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x80,
+
+    /* U+F0C9 "" */
+    0x47, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x47, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x47, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+F0E0 "" */
+    0x8, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x80,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
+    0x2, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x20,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
+    0xf6, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x6f,
+    0xff, 0xa0, 0x2, 0xcf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x20, 0xa, 0xff,
+    0xff, 0xfd, 0x30, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x3, 0xdf, 0xff,
+    0xff, 0xff, 0xf7, 0x0, 0x4e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe4, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb1, 0x1, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0x10, 0x1b, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x40, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0x70, 0x4, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x3e, 0xff,
+    0xff, 0xe3, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x8e,
+    0xe8, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0,
+    0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x41,
+    0x14, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x8, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x80,
+
+    /* U+F0E7 "" */
+    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xa,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x10, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0xe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfe, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F0EA "" */
+    0x0, 0x0, 0x0, 0x2, 0xbf, 0xfb, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xfa, 0xaf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xa,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xa0, 0xa, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xfa, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0x20, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x0, 0xf7,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0x80, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xf8, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+
+    /* U+F0F3 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xe4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x48,
+    0xff, 0xff, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xff,
+    0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x10, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x70, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x4e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xbf, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F11C "" */
+    0x8, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x80, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x20, 0x2, 0xff, 0x20, 0x2, 0xff,
+    0x20, 0x2, 0xff, 0x20, 0x2, 0xff, 0x20, 0x2,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0x0,
+    0x0, 0xff, 0x0, 0x0, 0xff, 0x0, 0x0, 0xff,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0xff, 0x0, 0x0, 0xff, 0x0, 0x0, 0xff, 0x0,
+    0x0, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0x20, 0x2, 0xff, 0x20, 0x2, 0xff, 0x20, 0x2,
+    0xff, 0x20, 0x2, 0xff, 0x20, 0x2, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0x0, 0x2f, 0xf2, 0x0, 0x2f, 0xf2, 0x0, 0x2f,
+    0xf2, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0x0, 0xf, 0xf0, 0x0, 0xf, 0xf0,
+    0x0, 0xf, 0xf0, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xf0, 0x0,
+    0xf, 0xf0, 0x0, 0xf, 0xf0, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x2f,
+    0xf2, 0x0, 0x2f, 0xf2, 0x0, 0x2f, 0xf2, 0x0,
+    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x20, 0x2, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x20, 0x2,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0x20, 0x2, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0x20, 0x2, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x8, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x80,
+
+    /* U+F124 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x9e,
+    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xbf,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xcf,
+    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x1, 0x8e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x2, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8e, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+F15B "" */
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0xf7, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0xff, 0x80, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0xff, 0xf8, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x80,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+
+    /* U+F1EB "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0x7a, 0xde, 0xff, 0xff, 0xed,
+    0xa7, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x6b, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xbf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x96,
+    0x42, 0x10, 0x1, 0x24, 0x69, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xd2, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0xff, 0xe8, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x8e, 0xff, 0xff, 0xff, 0xff, 0x40,
+    0x7f, 0xff, 0xff, 0xff, 0xd5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d,
+    0xff, 0xff, 0xff, 0xf7, 0xef, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
+    0x5f, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0xf5, 0x5, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x37, 0xbd, 0xef, 0xfe, 0xdb,
+    0x73, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x50,
+    0x0, 0x46, 0x0, 0x0, 0x0, 0x1, 0x8e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x10, 0x0,
+    0x0, 0x0, 0x64, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xfb,
+    0x73, 0x20, 0x2, 0x37, 0xbf, 0xff, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x9f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xfb, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xbf, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+F240 "" */
+    0x8, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x80, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xf8, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x8, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x80, 0x0,
+
+    /* U+F241 "" */
+    0x8, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x80, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xf8, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x8, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x80, 0x0,
+
+    /* U+F242 "" */
+    0x8, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x80, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xf8, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x8, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x80, 0x0,
+
+    /* U+F243 "" */
+    0x8, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x80, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xf8, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x8, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x80, 0x0,
+
+    /* U+F244 "" */
+    0x8, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x80, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xf8, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x8, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x80, 0x0,
+
+    /* U+F287 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xce, 0xef,
+    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xb5,
+    0x5b, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xc0, 0x0, 0x1d, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3,
+    0x0, 0x0, 0x6, 0x85, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x64, 0x0,
+    0x0, 0x0, 0xb, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xff, 0xfd, 0x30, 0x0, 0x3, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7a, 0x10, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xfe, 0x20, 0x0, 0xbf, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x70,
+    0x0, 0xb, 0xff, 0xff, 0xff, 0xf9, 0x12, 0x8f,
+    0xf5, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0xaf, 0xff, 0xd3, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf9, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xbf,
+    0xff, 0xff, 0xff, 0x92, 0x22, 0x22, 0x24, 0xef,
+    0xc2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2a,
+    0xff, 0xfd, 0x40, 0x3, 0xff, 0xff, 0xff, 0xe2,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0,
+    0x4, 0xef, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x56, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xa0, 0x0, 0x3a, 0xaa, 0xaa,
+    0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0x40, 0x8, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0x76, 0xbf, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xcc, 0xef,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F293 "" */
+    0x0, 0x0, 0x0, 0x4, 0x8c, 0xdf, 0xfe, 0xda,
+    0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xfb, 0xff, 0xff,
+    0xff, 0xfd, 0x10, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0xff, 0xf4, 0x9f, 0xff, 0xff, 0xff, 0xd1, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xf4, 0xa, 0xff,
+    0xff, 0xff, 0xfa, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0xff, 0xf4, 0x0, 0xbf, 0xff, 0xff, 0xff, 0x30,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0xc,
+    0xff, 0xff, 0xff, 0x90, 0xd, 0xff, 0xff, 0xff,
+    0xff, 0xf4, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xe0,
+    0x2f, 0xff, 0xff, 0xef, 0xff, 0xf4, 0x5, 0x20,
+    0x1d, 0xff, 0xff, 0xf3, 0x6f, 0xff, 0xfc, 0x19,
+    0xff, 0xf4, 0x6, 0xe2, 0x2, 0xef, 0xff, 0xf7,
+    0x9f, 0xff, 0xf3, 0x0, 0x9f, 0xf4, 0x6, 0xfe,
+    0x10, 0x3f, 0xff, 0xf9, 0xbf, 0xff, 0xfe, 0x20,
+    0x9, 0xf4, 0x6, 0xf8, 0x0, 0xaf, 0xff, 0xfb,
+    0xdf, 0xff, 0xff, 0xe2, 0x0, 0x94, 0x6, 0x80,
+    0x9, 0xff, 0xff, 0xfd, 0xef, 0xff, 0xff, 0xfe,
+    0x20, 0x0, 0x1, 0x0, 0x7f, 0xff, 0xff, 0xfe,
+    0xff, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x20, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
+    0xef, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xf7,
+    0x0, 0x33, 0x4, 0x20, 0xc, 0xff, 0xff, 0xfe,
+    0xcf, 0xff, 0xff, 0x70, 0x3, 0xe4, 0x6, 0xe2,
+    0x0, 0xcf, 0xff, 0xfc, 0xaf, 0xff, 0xf7, 0x0,
+    0x3f, 0xf4, 0x6, 0xfe, 0x10, 0x1e, 0xff, 0xfb,
+    0x7f, 0xff, 0xf7, 0x3, 0xff, 0xf4, 0x6, 0xf8,
+    0x0, 0x6f, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0x9f,
+    0xff, 0xf4, 0x6, 0x80, 0x6, 0xff, 0xff, 0xf5,
+    0xe, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x1, 0x0,
+    0x6f, 0xff, 0xff, 0xf1, 0x9, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x0, 0x6, 0xff, 0xff, 0xff, 0xb0,
+    0x2, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x6f,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x9f, 0xff, 0xff,
+    0xff, 0xf5, 0x6, 0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xff, 0xf5, 0x6f, 0xff,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x5, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0x8c, 0xef, 0xff, 0xec, 0x83, 0x0, 0x0, 0x0,
+
+    /* U+F2ED "" */
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0xff, 0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f,
+    0xff, 0xf3, 0x3f, 0xff, 0xff, 0x0, 0x0, 0xff,
+    0xff, 0xf0, 0xf, 0xff, 0xf0, 0xf, 0xff, 0xf0,
+    0xf, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xf0,
+    0xf, 0xff, 0xf0, 0xf, 0xff, 0xf0, 0xf, 0xff,
+    0xff, 0x0, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff,
+    0xf0, 0xf, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0,
+    0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xf0, 0xf,
+    0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0x0, 0xff,
+    0xff, 0xf0, 0xf, 0xff, 0xf0, 0xf, 0xff, 0xf0,
+    0xf, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xf0,
+    0xf, 0xff, 0xf0, 0xf, 0xff, 0xf0, 0xf, 0xff,
+    0xff, 0x0, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff,
+    0xf0, 0xf, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0,
+    0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xf0, 0xf,
+    0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0x0, 0xff,
+    0xff, 0xf0, 0xf, 0xff, 0xf0, 0xf, 0xff, 0xf0,
+    0xf, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xf0,
+    0xf, 0xff, 0xf0, 0xf, 0xff, 0xf0, 0xf, 0xff,
+    0xff, 0x0, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff,
+    0xf0, 0xf, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0,
+    0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xf0, 0xf,
+    0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0x0, 0xff,
+    0xff, 0xf0, 0xf, 0xff, 0xf0, 0xf, 0xff, 0xf0,
+    0xf, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xf0,
+    0xf, 0xff, 0xf0, 0xf, 0xff, 0xf0, 0xf, 0xff,
+    0xff, 0x0, 0x0, 0xff, 0xff, 0xf3, 0x3f, 0xff,
+    0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0xff, 0xff, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x8, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x80, 0x0,
+
+    /* U+F304 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6d, 0xfa, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfe, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xfe,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8c, 0x10, 0x6f, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xfc, 0x10, 0x6f,
+    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfc, 0x10,
+    0x6f, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xfc,
+    0x10, 0x6f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xfc, 0x10, 0x6f, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x10, 0x6f, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x10, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xec, 0xa9, 0x75, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+F55A "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xaf, 0xff,
+    0xff, 0xfa, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0xa, 0xff, 0xff, 0xa0, 0x0, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x5, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xaf,
+    0xfa, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfa, 0x0, 0x0, 0xa, 0xa0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0x6, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x5f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xa,
+    0xa0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x5f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xa, 0xff,
+    0xff, 0xa0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0xaf, 0xff, 0xff, 0xfa, 0x8, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20,
+
+    /* U+F7C2 "" */
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x8f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x8, 0xff, 0xf0, 0x0, 0xff, 0x0, 0xf,
+    0xf0, 0x0, 0xff, 0xff, 0x0, 0x8f, 0xff, 0xf0,
+    0x0, 0xff, 0x0, 0xf, 0xf0, 0x0, 0xff, 0xff,
+    0x8, 0xff, 0xff, 0xf0, 0x0, 0xff, 0x0, 0xf,
+    0xf0, 0x0, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xf0,
+    0x0, 0xff, 0x0, 0xf, 0xf0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0x0, 0xff, 0x0, 0xf,
+    0xf0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0x0, 0xff, 0x0, 0xf, 0xf0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe2, 0x2, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x20,
+
+    /* U+F8A2 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x8f, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0x10, 0x0, 0x0, 0xaf, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xf1, 0x0, 0x0, 0xbf, 0xff,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0xff, 0x10, 0x1, 0xcf, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xf1, 0x1, 0xdf, 0xff,
+    0xff, 0xff, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x8f, 0xff, 0xff, 0x12, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x2e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
+    0x1d, 0xff, 0xff, 0xff, 0xf8, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x20,
+    0x0, 0x1c, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0
+};
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 138, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 137, .box_w = 5, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 55, .adv_w = 200, .box_w = 9, .box_h = 9, .ofs_x = 2, .ofs_y = 13},
+    {.bitmap_index = 96, .adv_w = 360, .box_w = 22, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 338, .adv_w = 318, .box_w = 18, .box_h = 30, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 608, .adv_w = 432, .box_w = 25, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 883, .adv_w = 351, .box_w = 21, .box_h = 23, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1125, .adv_w = 108, .box_w = 3, .box_h = 9, .ofs_x = 2, .ofs_y = 13},
+    {.bitmap_index = 1139, .adv_w = 173, .box_w = 7, .box_h = 30, .ofs_x = 3, .ofs_y = -6},
+    {.bitmap_index = 1244, .adv_w = 173, .box_w = 7, .box_h = 30, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 1349, .adv_w = 205, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 12},
+    {.bitmap_index = 1427, .adv_w = 298, .box_w = 15, .box_h = 14, .ofs_x = 2, .ofs_y = 4},
+    {.bitmap_index = 1532, .adv_w = 116, .box_w = 5, .box_h = 9, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 1555, .adv_w = 196, .box_w = 10, .box_h = 3, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 1570, .adv_w = 116, .box_w = 5, .box_h = 5, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1583, .adv_w = 180, .box_w = 14, .box_h = 30, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 1793, .adv_w = 342, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2002, .adv_w = 189, .box_w = 9, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2101, .adv_w = 294, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2299, .adv_w = 293, .box_w = 17, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2486, .adv_w = 343, .box_w = 21, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2717, .adv_w = 294, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2915, .adv_w = 316, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3113, .adv_w = 306, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3311, .adv_w = 330, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3520, .adv_w = 316, .box_w = 19, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3729, .adv_w = 116, .box_w = 5, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3772, .adv_w = 116, .box_w = 5, .box_h = 22, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 3827, .adv_w = 298, .box_w = 15, .box_h = 15, .ofs_x = 2, .ofs_y = 4},
+    {.bitmap_index = 3940, .adv_w = 298, .box_w = 15, .box_h = 10, .ofs_x = 2, .ofs_y = 6},
+    {.bitmap_index = 4015, .adv_w = 298, .box_w = 15, .box_h = 15, .ofs_x = 2, .ofs_y = 4},
+    {.bitmap_index = 4128, .adv_w = 293, .box_w = 17, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4315, .adv_w = 529, .box_w = 31, .box_h = 28, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 4749, .adv_w = 375, .box_w = 25, .box_h = 22, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5024, .adv_w = 388, .box_w = 20, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5244, .adv_w = 370, .box_w = 21, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5475, .adv_w = 423, .box_w = 22, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5717, .adv_w = 343, .box_w = 17, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5904, .adv_w = 325, .box_w = 17, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 6091, .adv_w = 395, .box_w = 22, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6333, .adv_w = 416, .box_w = 20, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 6553, .adv_w = 159, .box_w = 4, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 6597, .adv_w = 263, .box_w = 15, .box_h = 22, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6762, .adv_w = 368, .box_w = 20, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 6982, .adv_w = 304, .box_w = 16, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 7158, .adv_w = 489, .box_w = 25, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 7433, .adv_w = 416, .box_w = 20, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 7653, .adv_w = 430, .box_w = 25, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7928, .adv_w = 370, .box_w = 19, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 8137, .adv_w = 430, .box_w = 26, .box_h = 27, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 8488, .adv_w = 372, .box_w = 19, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 8697, .adv_w = 318, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8895, .adv_w = 301, .box_w = 19, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9104, .adv_w = 405, .box_w = 20, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 9324, .adv_w = 365, .box_w = 24, .box_h = 22, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 9588, .adv_w = 577, .box_w = 35, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9973, .adv_w = 345, .box_w = 22, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10215, .adv_w = 331, .box_w = 22, .box_h = 22, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 10457, .adv_w = 336, .box_w = 20, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 10677, .adv_w = 170, .box_w = 8, .box_h = 30, .ofs_x = 3, .ofs_y = -6},
+    {.bitmap_index = 10797, .adv_w = 180, .box_w = 15, .box_h = 30, .ofs_x = -2, .ofs_y = -3},
+    {.bitmap_index = 11022, .adv_w = 170, .box_w = 8, .box_h = 30, .ofs_x = 0, .ofs_y = -6},
+    {.bitmap_index = 11142, .adv_w = 298, .box_w = 15, .box_h = 13, .ofs_x = 2, .ofs_y = 5},
+    {.bitmap_index = 11240, .adv_w = 256, .box_w = 16, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 11256, .adv_w = 307, .box_w = 9, .box_h = 4, .ofs_x = 3, .ofs_y = 19},
+    {.bitmap_index = 11274, .adv_w = 306, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11410, .adv_w = 349, .box_w = 19, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 11638, .adv_w = 292, .box_w = 17, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11783, .adv_w = 349, .box_w = 18, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11999, .adv_w = 313, .box_w = 18, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12152, .adv_w = 181, .box_w = 13, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12308, .adv_w = 353, .box_w = 19, .box_h = 23, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 12527, .adv_w = 349, .box_w = 18, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 12743, .adv_w = 143, .box_w = 5, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 12803, .adv_w = 145, .box_w = 10, .box_h = 30, .ofs_x = -3, .ofs_y = -6},
+    {.bitmap_index = 12953, .adv_w = 315, .box_w = 18, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 13169, .adv_w = 143, .box_w = 4, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 13217, .adv_w = 541, .box_w = 30, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 13472, .adv_w = 349, .box_w = 18, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 13625, .adv_w = 325, .box_w = 18, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13778, .adv_w = 349, .box_w = 19, .box_h = 23, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 13997, .adv_w = 349, .box_w = 18, .box_h = 23, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 14204, .adv_w = 210, .box_w = 11, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 14298, .adv_w = 257, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14434, .adv_w = 212, .box_w = 13, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14571, .adv_w = 347, .box_w = 17, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 14716, .adv_w = 286, .box_w = 19, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 14878, .adv_w = 460, .box_w = 29, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15125, .adv_w = 283, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15278, .adv_w = 286, .box_w = 19, .box_h = 23, .ofs_x = -1, .ofs_y = -6},
+    {.bitmap_index = 15497, .adv_w = 267, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15625, .adv_w = 180, .box_w = 10, .box_h = 30, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 15775, .adv_w = 153, .box_w = 4, .box_h = 30, .ofs_x = 3, .ofs_y = -6},
+    {.bitmap_index = 15835, .adv_w = 180, .box_w = 10, .box_h = 30, .ofs_x = 0, .ofs_y = -6},
+    {.bitmap_index = 15985, .adv_w = 298, .box_w = 16, .box_h = 6, .ofs_x = 1, .ofs_y = 9},
+    {.bitmap_index = 16033, .adv_w = 215, .box_w = 11, .box_h = 10, .ofs_x = 1, .ofs_y = 12},
+    {.bitmap_index = 16088, .adv_w = 161, .box_w = 6, .box_h = 6, .ofs_x = 2, .ofs_y = 6},
+    {.bitmap_index = 16106, .adv_w = 512, .box_w = 32, .box_h = 33, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 16634, .adv_w = 512, .box_w = 32, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17018, .adv_w = 512, .box_w = 32, .box_h = 28, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 17466, .adv_w = 512, .box_w = 32, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17850, .adv_w = 352, .box_w = 22, .box_h = 22, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 18092, .adv_w = 512, .box_w = 31, .box_h = 32, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 18588, .adv_w = 512, .box_w = 30, .box_h = 32, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 19068, .adv_w = 576, .box_w = 36, .box_h = 28, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 19572, .adv_w = 512, .box_w = 32, .box_h = 32, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 20084, .adv_w = 576, .box_w = 36, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20516, .adv_w = 512, .box_w = 32, .box_h = 32, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 21028, .adv_w = 256, .box_w = 16, .box_h = 26, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 21236, .adv_w = 384, .box_w = 24, .box_h = 26, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 21548, .adv_w = 576, .box_w = 36, .box_h = 32, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 22124, .adv_w = 512, .box_w = 32, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22508, .adv_w = 352, .box_w = 22, .box_h = 32, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 22860, .adv_w = 448, .box_w = 20, .box_h = 30, .ofs_x = 4, .ofs_y = -3},
+    {.bitmap_index = 23160, .adv_w = 448, .box_w = 28, .box_h = 34, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 23636, .adv_w = 448, .box_w = 28, .box_h = 29, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 24042, .adv_w = 448, .box_w = 28, .box_h = 28, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 24434, .adv_w = 448, .box_w = 20, .box_h = 30, .ofs_x = 4, .ofs_y = -3},
+    {.bitmap_index = 24734, .adv_w = 448, .box_w = 30, .box_h = 28, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 25154, .adv_w = 320, .box_w = 18, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 25406, .adv_w = 320, .box_w = 18, .box_h = 28, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 25658, .adv_w = 448, .box_w = 28, .box_h = 28, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 26050, .adv_w = 448, .box_w = 28, .box_h = 6, .ofs_x = 0, .ofs_y = 9},
+    {.bitmap_index = 26134, .adv_w = 576, .box_w = 36, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 26566, .adv_w = 640, .box_w = 40, .box_h = 32, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 27206, .adv_w = 576, .box_w = 38, .box_h = 32, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 27814, .adv_w = 512, .box_w = 32, .box_h = 30, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 28294, .adv_w = 448, .box_w = 28, .box_h = 18, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 28546, .adv_w = 448, .box_w = 28, .box_h = 18, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 28798, .adv_w = 640, .box_w = 40, .box_h = 26, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 29318, .adv_w = 512, .box_w = 32, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 29702, .adv_w = 512, .box_w = 32, .box_h = 32, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 30214, .adv_w = 512, .box_w = 33, .box_h = 33, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 30759, .adv_w = 448, .box_w = 29, .box_h = 28, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 31165, .adv_w = 448, .box_w = 28, .box_h = 32, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 31613, .adv_w = 448, .box_w = 28, .box_h = 28, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 32005, .adv_w = 448, .box_w = 28, .box_h = 26, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 32369, .adv_w = 512, .box_w = 32, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 32753, .adv_w = 320, .box_w = 22, .box_h = 32, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 33105, .adv_w = 448, .box_w = 28, .box_h = 32, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 33553, .adv_w = 448, .box_w = 28, .box_h = 32, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 34001, .adv_w = 576, .box_w = 36, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 34433, .adv_w = 512, .box_w = 34, .box_h = 34, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 35011, .adv_w = 384, .box_w = 24, .box_h = 32, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 35395, .adv_w = 640, .box_w = 40, .box_h = 29, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 35975, .adv_w = 640, .box_w = 40, .box_h = 20, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 36375, .adv_w = 640, .box_w = 40, .box_h = 20, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 36775, .adv_w = 640, .box_w = 40, .box_h = 20, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 37175, .adv_w = 640, .box_w = 40, .box_h = 20, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 37575, .adv_w = 640, .box_w = 40, .box_h = 20, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 37975, .adv_w = 640, .box_w = 41, .box_h = 26, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 38508, .adv_w = 448, .box_w = 24, .box_h = 32, .ofs_x = 2, .ofs_y = -4},
+    {.bitmap_index = 38892, .adv_w = 448, .box_w = 28, .box_h = 32, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 39340, .adv_w = 512, .box_w = 33, .box_h = 33, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 39885, .adv_w = 640, .box_w = 40, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 40365, .adv_w = 384, .box_w = 24, .box_h = 32, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 40749, .adv_w = 515, .box_w = 33, .box_h = 21, .ofs_x = 0, .ofs_y = 2}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_1[] = {
+    0x0, 0x1f72, 0xef51, 0xef58, 0xef5b, 0xef5c, 0xef5d, 0xef61,
+    0xef63, 0xef65, 0xef69, 0xef6c, 0xef71, 0xef76, 0xef77, 0xef78,
+    0xef8e, 0xef93, 0xef98, 0xef9b, 0xef9c, 0xef9d, 0xefa1, 0xefa2,
+    0xefa3, 0xefa4, 0xefb7, 0xefb8, 0xefbe, 0xefc0, 0xefc1, 0xefc4,
+    0xefc7, 0xefc8, 0xefc9, 0xefcb, 0xefe3, 0xefe5, 0xf014, 0xf015,
+    0xf017, 0xf019, 0xf030, 0xf037, 0xf03a, 0xf043, 0xf06c, 0xf074,
+    0xf0ab, 0xf13b, 0xf190, 0xf191, 0xf192, 0xf193, 0xf194, 0xf1d7,
+    0xf1e3, 0xf23d, 0xf254, 0xf4aa, 0xf712, 0xf7f2
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 176, .range_length = 63475, .glyph_id_start = 96,
+        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 62, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5,
+    2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 0, 13, 14, 15, 16, 17,
+    18, 19, 12, 20, 20, 0, 0, 0,
+    21, 22, 23, 24, 25, 22, 26, 27,
+    28, 29, 29, 30, 31, 32, 29, 29,
+    22, 33, 34, 35, 3, 36, 30, 37,
+    37, 38, 39, 40, 41, 42, 43, 0,
+    44, 0, 45, 46, 47, 48, 49, 50,
+    51, 45, 52, 52, 53, 48, 45, 45,
+    46, 46, 54, 55, 56, 57, 51, 58,
+    58, 59, 58, 60, 41, 0, 0, 9,
+    61, 9, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5,
+    2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 12,
+    18, 19, 20, 21, 21, 0, 0, 0,
+    22, 23, 24, 25, 23, 25, 25, 25,
+    23, 25, 25, 26, 25, 25, 25, 25,
+    23, 25, 23, 25, 3, 27, 28, 29,
+    29, 30, 31, 32, 33, 34, 35, 0,
+    36, 0, 37, 38, 39, 39, 39, 0,
+    39, 38, 40, 41, 38, 38, 42, 42,
+    39, 42, 39, 42, 43, 44, 45, 46,
+    46, 47, 46, 48, 0, 0, 35, 9,
+    49, 9, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    0, 2, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 5, 0, 0, 0,
+    0, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 23, 0, 14, -11, 0, 0,
+    0, 0, -28, -31, 4, 24, 11, 9,
+    -20, 4, 25, 2, 22, 5, 16, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 31, 4, -4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 10, 0, -15, 0, 0, 0, 0,
+    0, -10, 9, 10, 0, 0, -5, 0,
+    -4, 5, 0, -5, 0, -5, -3, -10,
+    0, 0, 0, 0, -5, 0, 0, -7,
+    -8, 0, 0, -5, 0, -10, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -5,
+    -5, 0, -8, 0, -14, 0, -62, 0,
+    0, -10, 0, 10, 15, 1, 0, -10,
+    5, 5, 17, 10, -9, 10, 0, 0,
+    -29, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -19, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -14, -6, -25, 0, -20,
+    -4, 0, 0, 0, 0, 1, 20, 0,
+    -15, -4, -2, 2, 0, -9, 0, 0,
+    -4, -38, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -41, -4, 19,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -21, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 17,
+    0, 5, 0, 0, -10, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 19, 4,
+    2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -19, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4,
+    10, 5, 15, -5, 0, 0, 10, -5,
+    -17, -70, 4, 14, 10, 1, -7, 0,
+    18, 0, 16, 0, 16, 0, -48, 0,
+    -6, 15, 0, 17, -5, 10, 5, 0,
+    0, 2, -5, 0, 0, -9, 41, 0,
+    41, 0, 15, 0, 22, 7, 9, 15,
+    0, 0, 0, -19, 0, 0, 0, 0,
+    2, -4, 0, 4, -9, -7, -10, 4,
+    0, -5, 0, 0, 0, -20, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -33, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, -28, 0, -32, 0, 0, 0,
+    0, -4, 0, 51, -6, -7, 5, 5,
+    -5, 0, -7, 5, 0, 0, -27, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -50, 0, 5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -32, 0, 31, 0, 0, -19, 0,
+    17, 0, -35, -50, -35, -10, 15, 0,
+    0, -34, 0, 6, -12, 0, -8, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 13, 15, -62, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 24, 0, 4, 0, 0, 0,
+    0, 0, 4, 4, -6, -10, 0, -2,
+    -2, -5, 0, 0, -4, 0, 0, 0,
+    -10, 0, -4, 0, -12, -10, 0, -13,
+    -17, -17, -10, 0, -10, 0, -10, 0,
+    0, 0, 0, -4, 0, 0, 5, 0,
+    4, -5, 0, 2, 0, 0, 0, 5,
+    -4, 0, 0, 0, -4, 5, 5, -2,
+    0, 0, 0, -10, 0, -2, 0, 0,
+    0, 0, 0, 2, 0, 7, -4, 0,
+    -6, 0, -9, 0, 0, -4, 0, 15,
+    0, 0, -5, 0, 0, 0, 0, 0,
+    -2, 2, -4, -4, 0, 0, -5, 0,
+    -5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -3, 0, -5, -6, 0,
+    0, 0, 0, 0, 2, 0, 0, -4,
+    0, -5, -5, -5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -3, 0, 0,
+    0, 0, -4, -7, 0, -8, 0, -15,
+    -4, -15, 10, 0, 0, -10, 5, 10,
+    14, 0, -13, -2, -6, 0, -2, -24,
+    5, -4, 4, -27, 5, 0, 0, 2,
+    -27, 0, -27, -4, -45, -4, 0, -26,
+    0, 10, 14, 0, 7, 0, 0, 0,
+    0, 1, 0, -9, -7, 0, -15, 0,
+    0, 0, -5, 0, 0, 0, -5, 0,
+    0, 0, 0, 0, -3, -3, 0, -3,
+    -7, 0, 0, 0, 0, 0, 0, 0,
+    -5, -5, 0, -4, -6, -4, 0, 0,
+    -5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -4, -4, 0, -6,
+    0, -4, 0, -10, 5, 0, 0, -6,
+    3, 5, 5, 0, 0, 0, 0, 0,
+    0, -4, 0, 0, 0, 0, 0, 4,
+    0, 0, -5, 0, -5, -4, -6, 0,
+    0, 0, 0, 0, 0, 0, 4, 0,
+    -4, 0, 0, 0, 0, -6, -8, 0,
+    -10, 0, 15, -4, 2, -16, 0, 0,
+    14, -26, -27, -22, -10, 5, 0, -4,
+    -33, -9, 0, -9, 0, -10, 8, -9,
+    -33, 0, -14, 0, 0, 3, -2, 4,
+    -4, 0, 5, 1, -15, -19, 0, -26,
+    -12, -11, -12, -15, -6, -14, -1, -10,
+    -14, 3, 0, 2, 0, -5, 0, 0,
+    0, 4, 0, 5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -5,
+    0, -3, 0, -2, -5, 0, -9, -11,
+    -11, -2, 0, -15, 0, 0, 0, 0,
+    0, 0, -4, 0, 0, 0, 0, 2,
+    -3, 0, 0, 0, 5, 0, 0, 0,
+    0, 0, 0, 0, 0, 25, 0, 0,
+    0, 0, 0, 0, 4, 0, 0, 0,
+    -5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -9, 0, 5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -4, 0, 0, 0,
+    -10, 0, 0, 0, 0, -26, -15, 0,
+    0, 0, -8, -26, 0, 0, -5, 5,
+    0, -14, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -8, 0, 0, -10,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, -9, 0,
+    0, 0, 0, 6, 0, 4, -10, -10,
+    0, -5, -5, -6, 0, 0, 0, 0,
+    0, 0, -15, 0, -5, 0, -8, -5,
+    0, -11, -13, -15, -4, 0, -10, 0,
+    -15, 0, 0, 0, 0, 41, 0, 0,
+    3, 0, 0, -7, 0, 5, 0, -22,
+    0, 0, 0, 0, 0, -48, -9, 17,
+    15, -4, -22, 0, 5, -8, 0, -26,
+    -3, -7, 5, -36, -5, 7, 0, 8,
+    -18, -8, -19, -17, -22, 0, 0, -31,
+    0, 29, 0, 0, -3, 0, 0, 0,
+    -3, -3, -5, -14, -17, -1, -48, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -5, 0, -3, -5, -8, 0, 0,
+    -10, 0, -5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, -10, 0, 0, 10,
+    -2, 7, 0, -11, 5, -4, -2, -13,
+    -5, 0, -7, -5, -4, 0, -8, -9,
+    0, 0, -4, -2, -4, -9, -6, 0,
+    0, -5, 0, 5, -4, 0, -11, 0,
+    0, 0, -10, 0, -9, 0, -9, -9,
+    5, 0, 0, 0, 0, 0, 0, 0,
+    0, -10, 5, 0, -7, 0, -4, -6,
+    -16, -4, -4, -4, -2, -4, -6, -2,
+    0, 0, 0, 0, 0, -5, -4, -4,
+    0, 0, 0, 0, 6, -4, 0, -4,
+    0, 0, 0, -4, -6, -4, -5, -6,
+    -5, 0, 4, 20, -2, 0, -14, 0,
+    -4, 10, 0, -5, -22, -7, 8, 1,
+    0, -24, -9, 5, -9, 4, 0, -4,
+    -4, -16, 0, -8, 3, 0, 0, -9,
+    0, 0, 0, 5, 5, -10, -10, 0,
+    -9, -5, -8, -5, -5, 0, -9, 3,
+    -10, -9, 15, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -4, -5,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -8, 0, 0, -7,
+    0, 0, -5, -5, 0, 0, 0, 0,
+    -5, 0, 0, 0, 0, -3, 0, 0,
+    0, 0, 0, -4, 0, 0, 0, 0,
+    -8, 0, -10, 0, 0, 0, -17, 0,
+    4, -11, 10, 1, -4, -24, 0, 0,
+    -11, -5, 0, -20, -13, -14, 0, 0,
+    -22, -5, -20, -19, -25, 0, -13, 0,
+    4, 34, -7, 0, -12, -5, -2, -5,
+    -9, -14, -9, -19, -21, -12, -5, 0,
+    0, -4, 0, 2, 0, 0, -36, -5,
+    15, 11, -11, -19, 0, 2, -16, 0,
+    -26, -4, -5, 10, -47, -7, 2, 0,
+    0, -33, -6, -27, -5, -37, 0, 0,
+    -36, 0, 30, 2, 0, -4, 0, 0,
+    0, 0, -3, -4, -19, -4, 0, -33,
+    0, 0, 0, 0, -16, 0, -5, 0,
+    -2, -14, -24, 0, 0, -3, -8, -15,
+    -5, 0, -4, 0, 0, 0, 0, -23,
+    -5, -17, -16, -4, -9, -13, -5, -9,
+    0, -10, -5, -17, -8, 0, -6, -10,
+    -5, -10, 0, 3, 0, -4, -17, 0,
+    10, 0, -9, 0, 0, 0, 0, 6,
+    0, 4, -10, 21, 0, -5, -5, -6,
+    0, 0, 0, 0, 0, 0, -15, 0,
+    -5, 0, -8, -5, 0, -11, -13, -15,
+    -4, 0, -10, 4, 20, 0, 0, 0,
+    0, 41, 0, 0, 3, 0, 0, -7,
+    0, 5, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0,
+    -4, -10, 0, 0, 0, 0, 0, -3,
+    0, 0, 0, -5, -5, 0, 0, -10,
+    -5, 0, 0, -10, 0, 9, -3, 0,
+    0, 0, 0, 0, 0, 3, 0, 0,
+    0, 0, 8, 10, 4, -5, 0, -16,
+    -8, 0, 15, -17, -16, -10, -10, 20,
+    9, 5, -45, -4, 10, -5, 0, -5,
+    6, -5, -18, 0, -5, 5, -7, -4,
+    -15, -4, 0, 0, 15, 10, 0, -14,
+    0, -28, -7, 15, -7, -19, 2, -7,
+    -17, -17, -5, 20, 5, 0, -8, 0,
+    -14, 0, 4, 17, -12, -19, -20, -13,
+    15, 0, 2, -37, -4, 5, -9, -4,
+    -12, 0, -11, -19, -8, -8, -4, 0,
+    0, -12, -11, -5, 0, 15, 12, -5,
+    -28, 0, -28, -7, 0, -18, -30, -2,
+    -16, -9, -17, -14, 14, 0, 0, -7,
+    0, -10, -5, 0, -5, -9, 0, 9,
+    -17, 5, 0, 0, -27, 0, -5, -11,
+    -9, -4, -15, -13, -17, -12, 0, -15,
+    -5, -12, -10, -15, -5, 0, 0, 2,
+    24, -9, 0, -15, -5, 0, -5, -10,
+    -12, -14, -14, -19, -7, -10, 10, 0,
+    -8, 0, -26, -6, 3, 10, -16, -19,
+    -10, -17, 17, -5, 3, -48, -9, 10,
+    -11, -9, -19, 0, -15, -22, -6, -5,
+    -4, -5, -11, -15, -2, 0, 0, 15,
+    14, -4, -33, 0, -31, -12, 12, -19,
+    -35, -10, -18, -22, -26, -17, 10, 0,
+    0, 0, 0, -6, 0, 0, 5, -6,
+    10, 4, -10, 10, 0, 0, -16, -2,
+    0, -2, 0, 2, 2, -4, 0, 0,
+    0, 0, 0, 0, -5, 0, 0, 0,
+    0, 4, 15, 1, 0, -6, 0, 0,
+    0, 0, -4, -4, -6, 0, 0, 0,
+    2, 4, 0, 0, 0, 0, 4, 0,
+    -4, 0, 19, 0, 9, 2, 2, -7,
+    0, 10, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 15, 0, 14, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -31, 0, -5, 9, 0, 15,
+    0, 0, 51, 6, -10, -10, 5, 5,
+    -4, 2, -26, 0, 0, 25, -31, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -35, 19, 72, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -31, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -8, 0, 0, -10,
+    -5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -4, 0, -14, 0,
+    0, 2, 0, 0, 5, 66, -10, -4,
+    16, 14, -14, 5, 0, 0, 5, 5,
+    -7, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -67, 14, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -14,
+    0, 0, 0, -14, 0, 0, 0, 0,
+    -11, -3, 0, 0, 0, -11, 0, -6,
+    0, -24, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -34, 0, 0,
+    0, 0, 2, 0, 0, 0, 0, 0,
+    0, -5, 0, 0, -10, 0, -8, 0,
+    -14, 0, 0, 0, -9, 5, -6, 0,
+    0, -14, -5, -12, 0, 0, -14, 0,
+    -5, 0, -24, 0, -6, 0, 0, -41,
+    -10, -20, -6, -18, 0, 0, -34, 0,
+    -14, -3, 0, 0, 0, 0, 0, 0,
+    0, 0, -8, -9, -4, -9, 0, 0,
+    0, 0, -11, 0, -11, 7, -6, 10,
+    0, -4, -12, -4, -9, -10, 0, -6,
+    -3, -4, 4, -14, -2, 0, 0, 0,
+    -45, -4, -7, 0, -11, 0, -4, -24,
+    -5, 0, 0, -4, -4, 0, 0, 0,
+    0, 4, 0, -4, -9, -4, 9, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 7, 0, 0, 0, 0, 0,
+    0, -11, 0, -4, 0, 0, 0, -10,
+    5, 0, 0, 0, -14, -5, -10, 0,
+    0, -14, 0, -5, 0, -24, 0, 0,
+    0, 0, -50, 0, -10, -19, -26, 0,
+    0, -34, 0, -4, -8, 0, 0, 0,
+    0, 0, 0, 0, 0, -5, -8, -3,
+    -8, 2, 0, 0, 9, -7, 0, 16,
+    25, -5, -5, -15, 6, 25, 9, 11,
+    -14, 6, 22, 6, 15, 11, 14, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 32, 24, -9, -5, 0, -4,
+    41, 22, 41, 0, 0, 0, 5, 0,
+    0, 19, 0, 0, -8, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -4, 0,
+    0, 0, 0, 0, 0, 0, 0, 7,
+    0, 0, 0, 0, -43, -6, -4, -21,
+    -25, 0, 0, -34, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -8, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -4,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    7, 0, 0, 0, 0, -43, -6, -4,
+    -21, -25, 0, 0, -20, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -4, 0, 0, 0, -12, 5, 0, -5,
+    4, 9, 5, -15, 0, -1, -4, 5,
+    0, 4, 0, 0, 0, 0, -13, 0,
+    -5, -4, -10, 0, -5, -20, 0, 32,
+    -5, 0, -11, -4, 0, -4, -9, 0,
+    -5, -14, -10, -6, 0, 0, 0, -8,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, 0, 0, 0, 0, 0, 0,
+    0, 0, 7, 0, 0, 0, 0, -43,
+    -6, -4, -21, -25, 0, 0, -34, 0,
+    0, 0, 0, 0, 0, 26, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -8, 0, -16, -6, -5, 15, -5, -5,
+    -20, 2, -3, 2, -4, -14, 1, 11,
+    1, 4, 2, 4, -12, -20, -6, 0,
+    -19, -10, -14, -22, -20, 0, -8, -10,
+    -6, -7, -4, -4, -6, -4, 0, -4,
+    -2, 8, 0, 8, -4, 0, 16, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, -5, -5, 0, 0,
+    -14, 0, -3, 0, -9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -31, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -5, -5, 0, -7,
+    0, 0, 0, 0, -4, 0, 0, -9,
+    -5, 5, 0, -9, -10, -4, 0, -15,
+    -4, -11, -4, -6, 0, -9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -34, 0, 16, 0, 0, -9, 0,
+    0, 0, 0, -7, 0, -5, 0, 0,
+    -3, 0, 0, -4, 0, -12, 0, 0,
+    22, -7, -17, -16, 4, 6, 6, -1,
+    -14, 4, 8, 4, 15, 4, 17, -4,
+    -14, 0, 0, -20, 0, 0, -15, -14,
+    0, 0, -10, 0, -7, -9, 0, -8,
+    0, -8, 0, -4, 8, 0, -4, -15,
+    -5, 19, 0, 0, -5, 0, -10, 0,
+    0, 7, -12, 0, 5, -5, 4, 1,
+    0, -17, 0, -4, -2, 0, -5, 6,
+    -4, 0, 0, 0, -21, -6, -11, 0,
+    -15, 0, 0, -24, 0, 19, -5, 0,
+    -9, 0, 3, 0, -5, 0, -5, -15,
+    0, -5, 5, 0, 0, 0, 0, -4,
+    0, 0, 5, -7, 2, 0, 0, -6,
+    -4, 0, -6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -32, 0, 11, 0,
+    0, -4, 0, 0, 0, 0, 1, 0,
+    -5, -5, 0, 0, 0, 10, 0, 12,
+    0, 0, 0, 0, 0, -32, -29, 2,
+    22, 15, 9, -20, 4, 22, 0, 19,
+    0, 10, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 27, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0
+};
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 61,
+    .right_class_cnt     = 49,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+#if LVGL_VERSION_MAJOR >= 8
+/*Store all the custom data of the font*/
+
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+#else
+static lv_font_fmt_txt_dsc_t font_dsc = {
+#endif
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 2,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+
+};
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+#if LVGL_VERSION_MAJOR >= 8
+const lv_font_t lv_font_montserrat_32 = {
+#else
+lv_font_t lv_font_montserrat_32 = {
+#endif
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 35,          /*The maximum line height required by the font*/
+    .base_line = 6,             /*Baseline measured from the bottom of the line*/
+#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
+    .subpx = LV_FONT_SUBPX_NONE,
+#endif
+#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
+    .underline_position = -2,
+    .underline_thickness = 2,
+#endif
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+};
+
+#endif /*#if LV_FONT_MONTSERRAT_32*/
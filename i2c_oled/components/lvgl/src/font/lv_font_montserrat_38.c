@@ -0,0 +1,8400 @@
+/*******************************************************************************
+ * Size: 38 px
+ * Bpp: 4
+ * Opts: --no-compress --no-prefilter --bpp 4 --size 38 --font Montserrat-Medium.ttf -r 0x20-0x7F,0xB0,0x2022 --font FontAwesome5-Solid+Brands+Regular.woff -r 61441,61448,61451,61452,61452,61453,61457,61459,61461,61465,61468,61473,61478,61479,61480,61502,61507,61512,61515,61516,61517,61521,61522,61523,61524,61543,61544,61550,61552,61553,61556,61559,61560,61561,61563,61587,61589,61636,61637,61639,61641,61664,61671,61674,61683,61724,61732,61787,61931,62016,62017,62018,62019,62020,62087,62099,62212,62189,62810,63426,63650 --format lvgl -o lv_font_montserrat_38.c --force-fast-kern-format
+ ******************************************************************************/
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+    #include "lvgl.h"
+#else
+    #include "../../lvgl.h"
+#endif
+
+#ifndef LV_FONT_MONTSERRAT_38
+    #define LV_FONT_MONTSERRAT_38 1
+#endif
+
+#if LV_FONT_MONTSERRAT_38
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0021 "!" */
+    0xf, 0xff, 0xf3, 0xf, 0xff, 0xf3, 0xf, 0xff,
+    0xf2, 0xe, 0xff, 0xf1, 0xd, 0xff, 0xf1, 0xd,
+    0xff, 0xf0, 0xc, 0xff, 0xf0, 0xc, 0xff, 0xf0,
+    0xb, 0xff, 0xe0, 0xa, 0xff, 0xe0, 0xa, 0xff,
+    0xd0, 0x9, 0xff, 0xc0, 0x9, 0xff, 0xc0, 0x8,
+    0xff, 0xb0, 0x7, 0xff, 0xa0, 0x7, 0xff, 0xa0,
+    0x6, 0xff, 0x90, 0x5, 0xee, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xab, 0x50, 0x1f, 0xff, 0xf3, 0x5f, 0xff, 0xf8,
+    0x2f, 0xff, 0xf5, 0x6, 0xee, 0x80,
+
+    /* U+0022 "\"" */
+    0x9f, 0xf9, 0x0, 0xb, 0xff, 0x79, 0xff, 0x80,
+    0x0, 0xbf, 0xf6, 0x8f, 0xf8, 0x0, 0xa, 0xff,
+    0x68, 0xff, 0x70, 0x0, 0xaf, 0xf6, 0x8f, 0xf7,
+    0x0, 0xa, 0xff, 0x57, 0xff, 0x70, 0x0, 0x9f,
+    0xf5, 0x7f, 0xf6, 0x0, 0x9, 0xff, 0x47, 0xff,
+    0x60, 0x0, 0x9f, 0xf4, 0x6f, 0xf5, 0x0, 0x8,
+    0xff, 0x36, 0xff, 0x50, 0x0, 0x8f, 0xf3, 0x1,
+    0x10, 0x0, 0x0, 0x11, 0x0,
+
+    /* U+0023 "#" */
+    0x0, 0x0, 0x0, 0x5, 0xff, 0x50, 0x0, 0x0,
+    0x7, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0xaf, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x10, 0x0,
+    0x0, 0xc, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xf0, 0x0, 0x0, 0x0, 0xef, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfd, 0x0,
+    0x0, 0x0, 0xf, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xa0, 0x0, 0x0, 0x2, 0xff,
+    0x80, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
+    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x8, 0xbb, 0xbb, 0xdf,
+    0xfc, 0xbb, 0xbb, 0xbb, 0xef, 0xfb, 0xbb, 0xbb,
+    0x70, 0x0, 0x0, 0x8, 0xff, 0x20, 0x0, 0x0,
+    0xb, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf0, 0x0, 0x0, 0x0, 0xdf, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xfe, 0x0, 0x0,
+    0x0, 0xe, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xc0, 0x0, 0x0, 0x0, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa, 0x0,
+    0x0, 0x0, 0x2f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0x80, 0x0, 0x0, 0x4, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf6,
+    0x0, 0x0, 0x0, 0x6f, 0xf4, 0x0, 0x0, 0x0,
+    0xbb, 0xbb, 0xbd, 0xff, 0xcb, 0xbb, 0xbb, 0xbd,
+    0xff, 0xcb, 0xbb, 0xb5, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0xcf, 0xe0, 0x0, 0x0, 0x0, 0xef, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xfc, 0x0, 0x0,
+    0x0, 0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xa0, 0x0, 0x0, 0x2, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8, 0x0,
+    0x0, 0x0, 0x4f, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0x60, 0x0, 0x0, 0x6, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf4,
+    0x0, 0x0, 0x0, 0x8f, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x20, 0x0, 0x0, 0xa,
+    0xff, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+0024 "$" */
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5a, 0xdf, 0xff, 0xfe, 0xc9, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x7e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x9f, 0xff, 0xfb, 0x66, 0xff, 0x65, 0x8b,
+    0xff, 0xf6, 0x0, 0x3, 0xff, 0xff, 0x40, 0x3,
+    0xff, 0x30, 0x0, 0x18, 0xe0, 0x0, 0x8, 0xff,
+    0xf5, 0x0, 0x3, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xf0, 0x0, 0x3, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf0, 0x0,
+    0x3, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xf4, 0x0, 0x3, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xfe, 0x30, 0x3, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xfb, 0x54, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xc7, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xff, 0xff,
+    0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0x57, 0xdf, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x4, 0xef,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0x30, 0x0, 0x2f, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0x30, 0x0, 0xc, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x0,
+    0xc, 0xff, 0xf0, 0x4, 0x90, 0x0, 0x0, 0x3,
+    0xff, 0x30, 0x0, 0x1f, 0xff, 0xc0, 0xc, 0xfd,
+    0x60, 0x0, 0x3, 0xff, 0x30, 0x1, 0xcf, 0xff,
+    0x70, 0x3f, 0xff, 0xfe, 0xa6, 0x45, 0xff, 0x55,
+    0x9f, 0xff, 0xfd, 0x0, 0x8, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0,
+    0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x10, 0x0, 0x0, 0x0, 0x15, 0xac, 0xef, 0xff,
+    0xfe, 0xb7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x88, 0x10,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+0025 "%" */
+    0x0, 0x2, 0xae, 0xfe, 0xb4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xf3, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0x80, 0x0, 0x0, 0x4, 0xff,
+    0xc4, 0x24, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xfc, 0x0, 0x0, 0x0, 0xd, 0xfd, 0x0,
+    0x0, 0xa, 0xff, 0x10, 0x0, 0x0, 0x0, 0xcf,
+    0xf2, 0x0, 0x0, 0x0, 0x3f, 0xf5, 0x0, 0x0,
+    0x1, 0xff, 0x60, 0x0, 0x0, 0x8, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0,
+    0xdf, 0x90, 0x0, 0x0, 0x3f, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xe0, 0x0, 0x0, 0x0, 0xbf,
+    0xb0, 0x0, 0x0, 0xdf, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xe0, 0x0, 0x0, 0x0, 0xbf, 0xb0,
+    0x0, 0x9, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0,
+    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xf5, 0x0, 0x0, 0x2, 0xff, 0x60, 0x1, 0xef,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfd,
+    0x0, 0x0, 0xa, 0xff, 0x10, 0xb, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xc5,
+    0x24, 0xbf, 0xf7, 0x0, 0x6f, 0xf8, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xff, 0x90, 0x2, 0xff, 0xc0, 0x0, 0x6d, 0xff,
+    0xfc, 0x50, 0x0, 0x0, 0x3, 0xae, 0xfe, 0xb4,
+    0x0, 0xc, 0xff, 0x20, 0xa, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf6, 0x0, 0x8f, 0xf9, 0x20, 0x2b, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xb0, 0x1, 0xff, 0x90, 0x0, 0x0, 0xcf, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfe, 0x10,
+    0x6, 0xff, 0x10, 0x0, 0x0, 0x4f, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xf5, 0x0, 0x9,
+    0xfd, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xa0, 0x0, 0xb, 0xfb,
+    0x0, 0x0, 0x0, 0xe, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x1e, 0xfe, 0x0, 0x0, 0xa, 0xfb, 0x0,
+    0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf3, 0x0, 0x0, 0x9, 0xfd, 0x0, 0x0,
+    0x0, 0xf, 0xf7, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0x80, 0x0, 0x0, 0x5, 0xff, 0x10, 0x0, 0x0,
+    0x3f, 0xf4, 0x0, 0x0, 0x0, 0x2f, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0xbf,
+    0xd0, 0x0, 0x0, 0x0, 0xcf, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xf7, 0x0, 0x1a, 0xff, 0x40,
+    0x0, 0x0, 0x7, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xfe, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x3f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4b, 0xef, 0xea, 0x30, 0x0,
+
+    /* U+0026 "&" */
+    0x0, 0x0, 0x0, 0x5, 0xad, 0xff, 0xeb, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c,
+    0xff, 0xff, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1e, 0xff, 0xfe, 0xba, 0xcf,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xf7, 0x0, 0x0, 0x4f, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xfa, 0x0, 0x0,
+    0x0, 0x8f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0x60, 0x0, 0x0, 0x5, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf7, 0x0,
+    0x0, 0x0, 0x9f, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xd0, 0x0, 0x0, 0x4f, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0x90, 0x0, 0x7f, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0x83, 0xcf, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfc,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xfd, 0xcf,
+    0xff, 0xa0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xf7, 0x0, 0xbf, 0xff, 0xb0, 0x0,
+    0x0, 0xef, 0xb1, 0x0, 0x1e, 0xff, 0xe3, 0x0,
+    0x0, 0xaf, 0xff, 0xc0, 0x0, 0x3f, 0xfe, 0x0,
+    0x9, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xc1, 0x8, 0xff, 0xa0, 0x0, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xd2, 0xff, 0xf5,
+    0x0, 0x3f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xfd, 0x0, 0x4, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0x50, 0x0, 0x2f, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xf3, 0x0, 0x0, 0xdf,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xf3, 0x0, 0x4, 0xff, 0xff, 0xc6, 0x20,
+    0x1, 0x37, 0xef, 0xff, 0xef, 0xff, 0xf4, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xb1, 0x4f, 0xff, 0xf3, 0x0, 0x3, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x60, 0x0, 0x3f, 0xfc,
+    0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xec, 0x84,
+    0x0, 0x0, 0x0, 0x3d, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+0027 "'" */
+    0x9f, 0xf9, 0x9f, 0xf8, 0x8f, 0xf8, 0x8f, 0xf7,
+    0x8f, 0xf7, 0x7f, 0xf7, 0x7f, 0xf6, 0x7f, 0xf6,
+    0x6f, 0xf5, 0x6f, 0xf5, 0x1, 0x10,
+
+    /* U+0028 "(" */
+    0x0, 0x0, 0x2f, 0xff, 0x50, 0x0, 0xb, 0xff,
+    0xc0, 0x0, 0x3, 0xff, 0xf4, 0x0, 0x0, 0xbf,
+    0xfd, 0x0, 0x0, 0x1f, 0xff, 0x70, 0x0, 0x7,
+    0xff, 0xf1, 0x0, 0x0, 0xcf, 0xfb, 0x0, 0x0,
+    0x1f, 0xff, 0x70, 0x0, 0x5, 0xff, 0xf3, 0x0,
+    0x0, 0x9f, 0xff, 0x0, 0x0, 0xc, 0xff, 0xc0,
+    0x0, 0x0, 0xff, 0xf9, 0x0, 0x0, 0x1f, 0xff,
+    0x70, 0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x4f,
+    0xff, 0x40, 0x0, 0x5, 0xff, 0xf3, 0x0, 0x0,
+    0x5f, 0xff, 0x30, 0x0, 0x6, 0xff, 0xf3, 0x0,
+    0x0, 0x5f, 0xff, 0x30, 0x0, 0x5, 0xff, 0xf3,
+    0x0, 0x0, 0x4f, 0xff, 0x40, 0x0, 0x3, 0xff,
+    0xf6, 0x0, 0x0, 0x1f, 0xff, 0x70, 0x0, 0x0,
+    0xff, 0xf9, 0x0, 0x0, 0xc, 0xff, 0xc0, 0x0,
+    0x0, 0x9f, 0xff, 0x0, 0x0, 0x5, 0xff, 0xf3,
+    0x0, 0x0, 0x1f, 0xff, 0x70, 0x0, 0x0, 0xcf,
+    0xfb, 0x0, 0x0, 0x7, 0xff, 0xf1, 0x0, 0x0,
+    0x1f, 0xff, 0x70, 0x0, 0x0, 0xbf, 0xfd, 0x0,
+    0x0, 0x3, 0xff, 0xf4, 0x0, 0x0, 0xb, 0xff,
+    0xc0, 0x0, 0x0, 0x2f, 0xff, 0x50,
+
+    /* U+0029 ")" */
+    0x8f, 0xfe, 0x0, 0x0, 0x0, 0xef, 0xf8, 0x0,
+    0x0, 0x7, 0xff, 0xf1, 0x0, 0x0, 0x1f, 0xff,
+    0x80, 0x0, 0x0, 0x9f, 0xfe, 0x0, 0x0, 0x4,
+    0xff, 0xf5, 0x0, 0x0, 0xe, 0xff, 0xa0, 0x0,
+    0x0, 0xaf, 0xfe, 0x0, 0x0, 0x5, 0xff, 0xf3,
+    0x0, 0x0, 0x2f, 0xff, 0x60, 0x0, 0x0, 0xff,
+    0xf9, 0x0, 0x0, 0xc, 0xff, 0xc0, 0x0, 0x0,
+    0xaf, 0xfe, 0x0, 0x0, 0x8, 0xff, 0xf0, 0x0,
+    0x0, 0x7f, 0xff, 0x10, 0x0, 0x6, 0xff, 0xf2,
+    0x0, 0x0, 0x6f, 0xff, 0x30, 0x0, 0x5, 0xff,
+    0xf3, 0x0, 0x0, 0x6f, 0xff, 0x30, 0x0, 0x6,
+    0xff, 0xf2, 0x0, 0x0, 0x7f, 0xff, 0x10, 0x0,
+    0x8, 0xff, 0xf0, 0x0, 0x0, 0xaf, 0xfe, 0x0,
+    0x0, 0xc, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xf9,
+    0x0, 0x0, 0x2f, 0xff, 0x60, 0x0, 0x5, 0xff,
+    0xf2, 0x0, 0x0, 0xaf, 0xfe, 0x0, 0x0, 0xe,
+    0xff, 0xa0, 0x0, 0x4, 0xff, 0xf4, 0x0, 0x0,
+    0x9f, 0xfe, 0x0, 0x0, 0x1f, 0xff, 0x80, 0x0,
+    0x7, 0xff, 0xf1, 0x0, 0x0, 0xef, 0xf8, 0x0,
+    0x0, 0x8f, 0xfe, 0x0, 0x0, 0x0,
+
+    /* U+002A "*" */
+    0x0, 0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xfb, 0x0, 0x0, 0x0, 0x2,
+    0x40, 0x0, 0x8f, 0xb0, 0x0, 0x24, 0x0, 0xbf,
+    0xa2, 0x8, 0xfb, 0x1, 0x9f, 0xe0, 0x1e, 0xff,
+    0xf8, 0x8f, 0xb6, 0xef, 0xff, 0x30, 0x7, 0xef,
+    0xff, 0xff, 0xff, 0xf9, 0x10, 0x0, 0x1, 0x8f,
+    0xff, 0xff, 0xa2, 0x0, 0x0, 0x0, 0x19, 0xff,
+    0xff, 0xfb, 0x30, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xa1, 0x1, 0xef, 0xfe, 0x78, 0xfb,
+    0x5d, 0xff, 0xf3, 0xa, 0xf9, 0x10, 0x8f, 0xb0,
+    0x7, 0xfd, 0x0, 0x12, 0x0, 0x8, 0xfb, 0x0,
+    0x1, 0x30, 0x0, 0x0, 0x0, 0x8f, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xfa, 0x0, 0x0,
+    0x0,
+
+    /* U+002B "+" */
+    0x0, 0x0, 0x0, 0x3, 0x66, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf9, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x8, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xa0, 0x0, 0x0,
+    0x0,
+
+    /* U+002C "," */
+    0x0, 0x35, 0x20, 0x9, 0xff, 0xf4, 0x1f, 0xff,
+    0xfb, 0x1f, 0xff, 0xfc, 0xb, 0xff, 0xf9, 0x0,
+    0xcf, 0xf4, 0x0, 0xdf, 0xe0, 0x1, 0xff, 0x90,
+    0x5, 0xff, 0x40, 0x9, 0xfe, 0x0, 0xd, 0xf9,
+    0x0,
+
+    /* U+002D "-" */
+    0x11, 0x11, 0x11, 0x11, 0x11, 0xd, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0x6d, 0xff, 0xff, 0xff, 0xff, 0xf6,
+
+    /* U+002E "." */
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xc1, 0x1f, 0xff,
+    0xfa, 0x3f, 0xff, 0xfc, 0xe, 0xff, 0xf9, 0x3,
+    0xdf, 0xa0,
+
+    /* U+002F "/" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x0, 0x0, 0x2, 0x8c, 0xef, 0xfd, 0xa4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xb7,
+    0x56, 0x9e, 0xff, 0xff, 0x70, 0x0, 0x0, 0xd,
+    0xff, 0xfc, 0x20, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0x30, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xfc, 0x0, 0x0, 0xef, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf4,
+    0x0, 0x5f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xa0, 0xa, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x0,
+    0xdf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xf3, 0xf, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x51, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xf7, 0x2f, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0x72, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xf7, 0x1f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0x70, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf5,
+    0xd, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0x30, 0xaf, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf0, 0x5,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xfa, 0x0, 0xe, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0x40, 0x0, 0x7f,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xd0, 0x0, 0x0, 0xdf, 0xff, 0xc2, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xf3, 0x0, 0x0, 0x2, 0xff,
+    0xff, 0xfb, 0x75, 0x69, 0xef, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x3, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
+    0xff, 0xff, 0xff, 0xff, 0xd4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50,
+    0x0, 0x0, 0x0,
+
+    /* U+0031 "1" */
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xff, 0xff,
+    0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff,
+    0x12, 0x44, 0x44, 0x4c, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0x10, 0x0, 0x0, 0xb, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x10, 0x0,
+    0x0, 0xb, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0x10, 0x0, 0x0, 0xb, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0x10, 0x0, 0x0, 0xb,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x10,
+    0x0, 0x0, 0xb, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0x10, 0x0, 0x0, 0xb, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0x10, 0x0, 0x0,
+    0xb, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0x10, 0x0, 0x0, 0xb, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0x10, 0x0, 0x0, 0xb, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x10, 0x0,
+    0x0, 0xb, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0x10, 0x0, 0x0, 0xb, 0xff, 0xf1,
+
+    /* U+0032 "2" */
+    0x0, 0x0, 0x4, 0x8c, 0xef, 0xfe, 0xd9, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x5d, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe5, 0x0, 0x0, 0x1, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x1,
+    0xdf, 0xff, 0xfe, 0x97, 0x55, 0x7a, 0xff, 0xff,
+    0xf5, 0x0, 0x1b, 0xff, 0xd4, 0x0, 0x0, 0x0,
+    0x1, 0xcf, 0xff, 0xd0, 0x0, 0x9, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xf7, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x20, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x9, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x9f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8,
+
+    /* U+0033 "3" */
+    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
+    0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x5f, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xfb, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5b, 0xbb, 0xdf, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xdf, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xe0, 0x6, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xfa, 0x1, 0xef, 0xe7, 0x10,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x30, 0x9f,
+    0xff, 0xff, 0xc8, 0x75, 0x56, 0xae, 0xff, 0xff,
+    0x90, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x5b, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0,
+    0x2, 0x6a, 0xde, 0xff, 0xec, 0x95, 0x0, 0x0,
+    0x0,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1d, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xf9, 0x0, 0x0, 0x5,
+    0x88, 0x70, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xc0, 0x0, 0x0, 0xa, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xfe, 0x10, 0x0, 0x0, 0xa,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0x50, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xe0, 0x0, 0x0, 0xa, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xe0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x13, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x3d, 0xff, 0xe3, 0x33, 0x33,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xe0, 0x0, 0x0,
+
+    /* U+0035 "5" */
+    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x6f, 0xff, 0x54, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xfe, 0xc9,
+    0x61, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x1, 0x44, 0x44, 0x44, 0x45, 0x79, 0xdf,
+    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4e, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xf5, 0x1, 0xd5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xff, 0x10, 0x9f, 0xfb, 0x40,
+    0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xa0, 0x2f,
+    0xff, 0xff, 0xea, 0x76, 0x56, 0x8c, 0xff, 0xff,
+    0xe1, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe3, 0x0, 0x0, 0x18, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0,
+    0x0, 0x48, 0xbd, 0xef, 0xfd, 0xb7, 0x20, 0x0,
+    0x0,
+
+    /* U+0036 "6" */
+    0x0, 0x0, 0x0, 0x0, 0x27, 0xbe, 0xff, 0xfd,
+    0xb7, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4c, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe, 0xa6, 0x43,
+    0x45, 0x8d, 0xe1, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0,
+    0x3f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xc0, 0x0, 0x5a, 0xdf, 0xfe, 0xc8, 0x30, 0x0,
+    0x0, 0x1f, 0xff, 0xb0, 0x5e, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x20, 0x0, 0x2f, 0xff, 0xa8, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x2f,
+    0xff, 0xef, 0xff, 0xb5, 0x10, 0x3, 0x7e, 0xff,
+    0xfe, 0x10, 0x1f, 0xff, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x1, 0xbf, 0xff, 0xa0, 0xf, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf1,
+    0xe, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xf4, 0xb, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xf6, 0x7, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xf6, 0x2, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xf3, 0x0, 0xbf, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf0, 0x0,
+    0x2f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x1, 0xcf,
+    0xff, 0x80, 0x0, 0x6, 0xff, 0xff, 0xb5, 0x21,
+    0x13, 0x7e, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x3, 0xcf, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8c,
+    0xef, 0xfe, 0xb7, 0x10, 0x0, 0x0,
+
+    /* U+0037 "7" */
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf3, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2d,
+    0xff, 0xd4, 0x44, 0x44, 0x44, 0x44, 0x44, 0x6f,
+    0xff, 0xc0, 0xdf, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xf4, 0xd, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xfd, 0x0, 0xdf,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0x60, 0xc, 0xee, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x0, 0x0, 0x48, 0xcd, 0xff, 0xed, 0xa5,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x4c, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
+    0x0, 0x0, 0x5f, 0xff, 0xfc, 0x62, 0x10, 0x14,
+    0x9f, 0xff, 0xfc, 0x0, 0x0, 0xef, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0x50, 0x3,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xa0, 0x5, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xd0, 0x4, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xc0,
+    0x2, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0x90, 0x0, 0xbf, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0xff, 0x20, 0x0, 0x2e,
+    0xff, 0xfc, 0x52, 0x0, 0x13, 0x8f, 0xff, 0xf7,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf9, 0x10, 0x0, 0x0,
+    0x1b, 0xff, 0xff, 0xff, 0xed, 0xef, 0xff, 0xff,
+    0xe5, 0x0, 0x1, 0xdf, 0xff, 0xe7, 0x20, 0x0,
+    0x0, 0x4b, 0xff, 0xff, 0x50, 0x9, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf1,
+    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xf7, 0x3f, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xfb, 0x4f, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xfc, 0x3f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xfb, 0xf, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf7, 0xa,
+    0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xf1, 0x1, 0xef, 0xff, 0xfa, 0x52, 0x10,
+    0x13, 0x7d, 0xff, 0xff, 0x70, 0x0, 0x2e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x1, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x40, 0x0, 0x0, 0x0, 0x1, 0x59, 0xcd,
+    0xff, 0xed, 0xb7, 0x20, 0x0, 0x0,
+
+    /* U+0039 "9" */
+    0x0, 0x0, 0x4, 0x9c, 0xef, 0xed, 0xa5, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x8f, 0xff, 0xfa, 0x41, 0x1, 0x37, 0xdf, 0xff,
+    0xc0, 0x0, 0x3f, 0xff, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0x80, 0x9, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x20, 0xdf,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xf8, 0xe, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xe0, 0xef, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x2b, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xf5, 0x5f, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0x70, 0xcf, 0xff, 0xf9, 0x41,
+    0x0, 0x27, 0xdf, 0xff, 0xff, 0xf8, 0x1, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x4f, 0xff,
+    0x90, 0x1, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x13, 0xff, 0xf9, 0x0, 0x0, 0x27, 0xbe, 0xff,
+    0xec, 0x83, 0x0, 0x4f, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xcf, 0xff, 0xb0, 0x0, 0x1, 0x20, 0x0,
+    0x0, 0x0, 0x4, 0xdf, 0xff, 0xe1, 0x0, 0x0,
+    0x9f, 0xc7, 0x43, 0x45, 0x8d, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd3, 0x0, 0x0, 0x4, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x59, 0xce, 0xff, 0xec, 0x95, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+003A ":" */
+    0x3, 0xdf, 0xa0, 0xe, 0xff, 0xf9, 0x3f, 0xff,
+    0xfc, 0x1f, 0xff, 0xf9, 0x5, 0xef, 0xc1, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xc1,
+    0x1f, 0xff, 0xfa, 0x3f, 0xff, 0xfc, 0xe, 0xff,
+    0xf9, 0x3, 0xdf, 0xa0,
+
+    /* U+003B ";" */
+    0x3, 0xdf, 0xa0, 0xe, 0xff, 0xf9, 0x3f, 0xff,
+    0xfc, 0x1f, 0xff, 0xf9, 0x5, 0xef, 0xc1, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xa1,
+    0xe, 0xff, 0xf9, 0x2f, 0xff, 0xfc, 0xe, 0xff,
+    0xfb, 0x4, 0xef, 0xf6, 0x0, 0xbf, 0xf1, 0x0,
+    0xff, 0xc0, 0x3, 0xff, 0x60, 0x8, 0xff, 0x10,
+    0xc, 0xfb, 0x0, 0x6, 0x63, 0x0,
+
+    /* U+003C "<" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x28, 0xe9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5b, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x9e, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x6,
+    0xcf, 0xff, 0xff, 0xe9, 0x30, 0x0, 0x0, 0x39,
+    0xff, 0xff, 0xff, 0xb5, 0x0, 0x0, 0x1, 0x7d,
+    0xff, 0xff, 0xfd, 0x71, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xf9, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xc6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xe8, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4e, 0xff, 0xff, 0xfc, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4a, 0xff, 0xff, 0xff,
+    0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xdf,
+    0xff, 0xff, 0xe8, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x9f, 0xff, 0xff, 0xfb, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6c, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0xef, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xb8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+003D "=" */
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf9, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf9, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf9,
+
+    /* U+003E ">" */
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7e, 0x82, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xc6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf9, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x8e, 0xff, 0xff,
+    0xfd, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a,
+    0xff, 0xff, 0xff, 0xa4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x16, 0xcf, 0xff, 0xff, 0xd7, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0x9e, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7d,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x5, 0xbf,
+    0xff, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x39, 0xef,
+    0xff, 0xff, 0xb5, 0x0, 0x0, 0x1, 0x7d, 0xff,
+    0xff, 0xfd, 0x71, 0x0, 0x0, 0x5, 0xbf, 0xff,
+    0xff, 0xfa, 0x40, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xd6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7c, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+003F "?" */
+    0x0, 0x0, 0x4, 0x9c, 0xef, 0xfe, 0xda, 0x50,
+    0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x60, 0x0, 0x1, 0xcf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x2d, 0xff,
+    0xff, 0xb7, 0x43, 0x34, 0x8e, 0xff, 0xff, 0x60,
+    0x3e, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x1, 0xcf,
+    0xff, 0xd0, 0x0, 0x9a, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xaa,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xb9,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xfc,
+    0x20, 0x0, 0x0, 0x0,
+
+    /* U+0040 "@" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x9c,
+    0xee, 0xff, 0xed, 0xa8, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5e, 0xff, 0xff, 0xec, 0x98, 0x78, 0x8a,
+    0xdf, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xff, 0xe8, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x15, 0xbf, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2a,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xfa, 0x0, 0x0, 0x0, 0x49, 0xcd,
+    0xdb, 0x83, 0x0, 0x1e, 0xee, 0x22, 0xef, 0xf5,
+    0x0, 0x0, 0x0, 0x9f, 0xfb, 0x0, 0x0, 0x3,
+    0xcf, 0xff, 0xff, 0xff, 0xfb, 0x22, 0xff, 0xf3,
+    0x2, 0xff, 0xe1, 0x0, 0x0, 0x3f, 0xfe, 0x10,
+    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x4f, 0xff, 0x30, 0x5, 0xff, 0x90, 0x0, 0xb,
+    0xff, 0x50, 0x0, 0x4, 0xff, 0xff, 0xa4, 0x10,
+    0x25, 0xbf, 0xff, 0xff, 0xf3, 0x0, 0xb, 0xff,
+    0x20, 0x1, 0xff, 0xd0, 0x0, 0x0, 0xef, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x30,
+    0x0, 0x3f, 0xf8, 0x0, 0x7f, 0xf6, 0x0, 0x0,
+    0x7f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xf3, 0x0, 0x0, 0xdf, 0xd0, 0xb, 0xff,
+    0x10, 0x0, 0xd, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0x30, 0x0, 0x8, 0xff,
+    0x10, 0xef, 0xe0, 0x0, 0x1, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf3, 0x0,
+    0x0, 0x5f, 0xf4, 0xf, 0xfb, 0x0, 0x0, 0x4f,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0x30, 0x0, 0x3, 0xff, 0x51, 0xff, 0xa0,
+    0x0, 0x5, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf3, 0x0, 0x0, 0x2f, 0xf6,
+    0x2f, 0xf9, 0x0, 0x0, 0x5f, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x30, 0x0,
+    0x2, 0xff, 0x71, 0xff, 0xa0, 0x0, 0x4, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xf3, 0x0, 0x0, 0x2f, 0xf6, 0xf, 0xfb, 0x0,
+    0x0, 0x2f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0x30, 0x0, 0x4, 0xff, 0x40,
+    0xef, 0xe0, 0x0, 0x0, 0xdf, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xf3, 0x0, 0x0,
+    0x7f, 0xf2, 0xb, 0xff, 0x20, 0x0, 0x7, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0x30, 0x0, 0xb, 0xfe, 0x0, 0x7f, 0xf7, 0x0,
+    0x0, 0x1e, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xf5, 0x0, 0x2, 0xff, 0x90, 0x1,
+    0xff, 0xd0, 0x0, 0x0, 0x4f, 0xff, 0xf8, 0x20,
+    0x0, 0x29, 0xff, 0xed, 0xff, 0xd1, 0x2, 0xdf,
+    0xf2, 0x0, 0xa, 0xff, 0x50, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xed, 0xff, 0xff, 0xf3, 0x7f, 0xff,
+    0xfd, 0xff, 0xf8, 0x0, 0x0, 0x3f, 0xfe, 0x10,
+    0x0, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xd3,
+    0x0, 0xcf, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x9f, 0xfb, 0x0, 0x0, 0x0, 0x5, 0xbe, 0xff,
+    0xda, 0x40, 0x0, 0x0, 0x8d, 0xfe, 0xb5, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xfc,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xe8, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x27, 0xd2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e,
+    0xff, 0xff, 0xec, 0x98, 0x88, 0x9b, 0xef, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xcf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x9c,
+    0xef, 0xff, 0xec, 0x96, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+0041 "A" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0x7b, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf1,
+    0x4f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0xcf,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0x10, 0x5, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0x90, 0x0, 0xd, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xf2, 0x0, 0x0, 0x6f, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xfb, 0x0,
+    0x0, 0x0, 0xef, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0x30, 0x0, 0x0,
+    0x7, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xd0, 0x0, 0x0, 0x7, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x40,
+    0x0, 0x0, 0xef, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
+    0x6f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xf3, 0x0, 0xd, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xb0, 0x5, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0x20, 0xcf, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xfa,
+
+    /* U+0042 "B" */
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed,
+    0xa6, 0x10, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc0, 0x0, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x1, 0x26, 0xcf, 0xff, 0xf9, 0x0,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0x10, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x50,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0x60, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x50,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0x20, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfb, 0x0,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x25,
+    0xbf, 0xff, 0xe2, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf9, 0x20, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x12,
+    0x5b, 0xff, 0xff, 0x70, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf2,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xf8, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfb,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfd, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xfa, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf5,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x12,
+    0x5a, 0xff, 0xff, 0xc0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x91, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xca, 0x61, 0x0, 0x0,
+
+    /* U+0043 "C" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x6a, 0xde, 0xff,
+    0xec, 0x95, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0xff, 0xfd, 0x97, 0x55, 0x79,
+    0xef, 0xff, 0xff, 0x60, 0x0, 0x1, 0xdf, 0xff,
+    0xfb, 0x30, 0x0, 0x0, 0x0, 0x3, 0xcf, 0xff,
+    0x80, 0x0, 0xc, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xf7, 0x0, 0x0, 0x7f,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x10, 0x0, 0x0, 0xef, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x20, 0x0, 0x0, 0xc, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7,
+    0x0, 0x0, 0x1, 0xdf, 0xff, 0xfb, 0x30, 0x0,
+    0x0, 0x0, 0x4, 0xcf, 0xff, 0x80, 0x0, 0x0,
+    0x1d, 0xff, 0xff, 0xfd, 0x96, 0x55, 0x79, 0xef,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x6a, 0xde, 0xff, 0xec, 0x95, 0x0,
+    0x0, 0x0,
+
+    /* U+0044 "D" */
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xdb,
+    0x73, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x60,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0, 0x0,
+    0x0, 0xff, 0xfd, 0x44, 0x44, 0x44, 0x44, 0x57,
+    0xbf, 0xff, 0xff, 0xf6, 0x0, 0x0, 0xf, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
+    0xff, 0xf6, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xf3,
+    0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xd0, 0x0, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0x60, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xfc, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf1, 0xf,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0x50, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xf7, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x80,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xf8, 0xf, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0x70, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf5,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0x10, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xc0, 0xf, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf6,
+    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xfd, 0x0, 0xf, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0x30, 0x0, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0x70,
+    0x0, 0xf, 0xff, 0xd4, 0x44, 0x44, 0x44, 0x45,
+    0x7b, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x40, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0xb7, 0x30, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0045 "E" */
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
+    0xff, 0xfd, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x30, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf2, 0x0, 0xf, 0xff, 0xd2, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x0, 0x0, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xd4, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf4, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf4,
+
+    /* U+0046 "F" */
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf, 0xff,
+    0xd4, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x20, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x20, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xf, 0xff,
+    0xd3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x0,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+0047 "G" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x5a, 0xce, 0xff,
+    0xed, 0xa6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0xff, 0xfe, 0x97, 0x55, 0x78,
+    0xcf, 0xff, 0xff, 0xa0, 0x0, 0x1, 0xdf, 0xff,
+    0xfb, 0x40, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
+    0xb0, 0x0, 0xb, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdb, 0x0, 0x0, 0x6f,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x22,
+    0x20, 0x2f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xf1, 0x1f, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xf1, 0xe, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf1,
+    0xb, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xf1, 0x5, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xf1, 0x0, 0xef, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf1, 0x0,
+    0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xf1, 0x0, 0xb, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xf1, 0x0, 0x1, 0xdf, 0xff, 0xfb, 0x40, 0x0,
+    0x0, 0x0, 0x1, 0x7e, 0xff, 0xf1, 0x0, 0x0,
+    0x1c, 0xff, 0xff, 0xfe, 0x97, 0x55, 0x68, 0xbf,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10,
+    0x0, 0x0, 0x0, 0x2, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x6a, 0xce, 0xff, 0xec, 0x96, 0x10,
+    0x0, 0x0,
+
+    /* U+0048 "H" */
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfd, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfd,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfd, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfd,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfd, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfd,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfd, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfd,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfd, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfd,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfd, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0xf, 0xff, 0xd4, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0xff, 0xfd, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfd,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfd, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfd,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfd, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfd,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfd, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfd,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfd, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfd,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfd, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfd,
+
+    /* U+0049 "I" */
+    0xf, 0xff, 0xc0, 0xff, 0xfc, 0xf, 0xff, 0xc0,
+    0xff, 0xfc, 0xf, 0xff, 0xc0, 0xff, 0xfc, 0xf,
+    0xff, 0xc0, 0xff, 0xfc, 0xf, 0xff, 0xc0, 0xff,
+    0xfc, 0xf, 0xff, 0xc0, 0xff, 0xfc, 0xf, 0xff,
+    0xc0, 0xff, 0xfc, 0xf, 0xff, 0xc0, 0xff, 0xfc,
+    0xf, 0xff, 0xc0, 0xff, 0xfc, 0xf, 0xff, 0xc0,
+    0xff, 0xfc, 0xf, 0xff, 0xc0, 0xff, 0xfc, 0xf,
+    0xff, 0xc0, 0xff, 0xfc, 0xf, 0xff, 0xc0, 0xff,
+    0xfc,
+
+    /* U+004A "J" */
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xb0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfb, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xb0, 0x0, 0x24, 0x44, 0x44, 0x44, 0x44,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xf9, 0x0, 0xc8, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0x50, 0xaf, 0xf9, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xf1, 0x1e, 0xff, 0xfe, 0x85, 0x35,
+    0xaf, 0xff, 0xf9, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x0, 0x0, 0x2b, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x3, 0x8c,
+    0xef, 0xed, 0x93, 0x0, 0x0,
+
+    /* U+004B "K" */
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xe2, 0x0, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe2,
+    0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xe3, 0x0, 0x0, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf3,
+    0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x4f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xfc, 0x0, 0x0, 0x4f, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0,
+    0x0, 0x4f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfc, 0x0, 0x3f, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xc0, 0x3f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xfc, 0x3f, 0xff, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xef, 0xff, 0xfb, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf9,
+    0x6, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xf9, 0x0, 0x8, 0xff, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0xa, 0xff, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x1e, 0xff, 0xfa, 0x0, 0x0, 0x0, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xf7, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf5, 0x0, 0x0,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xf3, 0x0, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xe1,
+    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xc0,
+
+    /* U+004C "L" */
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xd4, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf3, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf3,
+
+    /* U+004D "M" */
+    0xf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf4, 0xf,
+    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xf4, 0xf, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xf4, 0xf, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xf4, 0xf, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xf4, 0xf, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xff, 0xf4, 0xf, 0xff, 0xff, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
+    0xf4, 0xf, 0xff, 0xcf, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xfb, 0xff, 0xf4,
+    0xf, 0xff, 0xa8, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0xb6, 0xff, 0xf4, 0xf,
+    0xff, 0xa0, 0xef, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0x26, 0xff, 0xf4, 0xf, 0xff,
+    0xa0, 0x5f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xf8, 0x6, 0xff, 0xf4, 0xf, 0xff, 0xa0,
+    0xb, 0xff, 0xf2, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xd0, 0x6, 0xff, 0xf4, 0xf, 0xff, 0xa0, 0x2,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x40,
+    0x6, 0xff, 0xf4, 0xf, 0xff, 0xa0, 0x0, 0x7f,
+    0xff, 0x40, 0x0, 0x0, 0xef, 0xfb, 0x0, 0x6,
+    0xff, 0xf4, 0xf, 0xff, 0xa0, 0x0, 0xd, 0xff,
+    0xd0, 0x0, 0x8, 0xff, 0xf1, 0x0, 0x5, 0xff,
+    0xf4, 0xf, 0xff, 0xa0, 0x0, 0x4, 0xff, 0xf8,
+    0x0, 0x2f, 0xff, 0x70, 0x0, 0x5, 0xff, 0xf4,
+    0xf, 0xff, 0xa0, 0x0, 0x0, 0xaf, 0xff, 0x20,
+    0xbf, 0xfd, 0x0, 0x0, 0x5, 0xff, 0xf4, 0xf,
+    0xff, 0xa0, 0x0, 0x0, 0x1f, 0xff, 0xb5, 0xff,
+    0xf4, 0x0, 0x0, 0x5, 0xff, 0xf4, 0xf, 0xff,
+    0xa0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x5, 0xff, 0xf4, 0xf, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x10, 0x0,
+    0x0, 0x5, 0xff, 0xf4, 0xf, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xf4, 0xf, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xf4, 0xf, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0xcd, 0x30, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xf4, 0xf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf4,
+    0xf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf4, 0xf,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xf4,
+
+    /* U+004E "N" */
+    0xf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfd, 0xf, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfd,
+    0xf, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfd, 0xf, 0xff, 0xff, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfd,
+    0xf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfd, 0xf, 0xff, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfd,
+    0xf, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfd, 0xf, 0xff, 0xc7, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfd,
+    0xf, 0xff, 0xc0, 0xaf, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfd, 0xf, 0xff, 0xc0, 0xc,
+    0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0xff, 0xfd,
+    0xf, 0xff, 0xc0, 0x1, 0xef, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0xff, 0xfd, 0xf, 0xff, 0xc0, 0x0,
+    0x3f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xff, 0xfd,
+    0xf, 0xff, 0xc0, 0x0, 0x5, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0xff, 0xfd, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x8f, 0xff, 0xf3, 0x0, 0x0, 0xff, 0xfd,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0xb, 0xff, 0xfe,
+    0x10, 0x0, 0xff, 0xfd, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xd0, 0x0, 0xff, 0xfd,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xfa, 0x0, 0xff, 0xfd, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0x80, 0xff, 0xfd,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xf5, 0xff, 0xfd, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xfd,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xff, 0xfd, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xfd,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0xfd, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfd,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xfd, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfd,
+
+    /* U+004F "O" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x6a, 0xce, 0xff,
+    0xec, 0x95, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
+    0xff, 0xff, 0xfd, 0x96, 0x55, 0x69, 0xdf, 0xff,
+    0xff, 0xc1, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
+    0xfb, 0x30, 0x0, 0x0, 0x0, 0x4, 0xcf, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf5,
+    0x0, 0x0, 0xef, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfd, 0x0,
+    0x5, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x40, 0xb,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0x90, 0xe, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xd0, 0x1f, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xf0, 0x2f, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xf0, 0x2f, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xf0, 0x1f, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xf0, 0xe, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xd0,
+    0xb, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x90, 0x5,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0x40, 0x0, 0xef,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xfd, 0x0, 0x0, 0x6f, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xf5, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xfb,
+    0x30, 0x0, 0x0, 0x0, 0x3, 0xcf, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xfd,
+    0x96, 0x55, 0x69, 0xdf, 0xff, 0xff, 0xc1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x6a, 0xce, 0xff, 0xec,
+    0xa5, 0x10, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0050 "P" */
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xb7,
+    0x30, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0xff, 0xfd, 0x44, 0x44, 0x44,
+    0x45, 0x7a, 0xff, 0xff, 0xf8, 0x0, 0xf, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
+    0xf4, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xc0, 0xf, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0x10, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xf4, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x60,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xf6, 0xf, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x40, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xf1, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfc, 0x0, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff,
+    0x40, 0xf, 0xff, 0xd4, 0x44, 0x44, 0x44, 0x57,
+    0xaf, 0xff, 0xff, 0x90, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x40, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0xdb, 0x83, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+0051 "Q" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x5a, 0xce, 0xff,
+    0xec, 0x95, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2a, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xcf, 0xff, 0xff, 0xd9, 0x65, 0x56, 0x9e,
+    0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x0, 0x4,
+    0xcf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xf5, 0x0, 0x0, 0xe, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xd0, 0x0, 0x5, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0x40, 0x0, 0xaf, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xf9, 0x0, 0xe, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xd0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0x0, 0x2f, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xf0, 0x2, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0x10, 0x1f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf0,
+    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfd, 0x0,
+    0xb, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xa0, 0x0,
+    0x6f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xf5, 0x0, 0x1,
+    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xfe, 0x0, 0x0, 0x8,
+    0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0x60, 0x0, 0x0, 0xd,
+    0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x2e,
+    0xff, 0xff, 0x92, 0x0, 0x0, 0x0, 0x0, 0x2a,
+    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x3e,
+    0xff, 0xff, 0xfc, 0x75, 0x33, 0x57, 0xcf, 0xff,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x49, 0xce, 0xff, 0xff, 0xfe, 0x72, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x1, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xfd, 0x61, 0x0, 0x38,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x7c, 0xef, 0xec, 0x82, 0x0,
+    0x0,
+
+    /* U+0052 "R" */
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xb7,
+    0x30, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0xff, 0xfd, 0x44, 0x44, 0x44,
+    0x45, 0x7a, 0xff, 0xff, 0xf8, 0x0, 0xf, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
+    0xf4, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xc0, 0xf, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0x10, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xf4, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x60,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xf6, 0xf, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x50, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xf2, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xfc, 0x0, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0x40, 0xf, 0xff, 0xd2, 0x22, 0x22, 0x22, 0x35,
+    0x9e, 0xff, 0xff, 0x90, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x40, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xf4, 0x0, 0x0, 0xf, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xe1,
+    0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xb0, 0x0, 0xf, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x60,
+    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xef, 0xff, 0x20, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xfd, 0x0,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xf9,
+
+    /* U+0053 "S" */
+    0x0, 0x0, 0x0, 0x49, 0xce, 0xff, 0xed, 0xb7,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x9f, 0xff, 0xfc, 0x74, 0x33, 0x45,
+    0x9d, 0xff, 0xf6, 0x0, 0x2, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x29, 0xe0, 0x0, 0x8,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xfa, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xc8, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xc7, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xf9,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0x9d,
+    0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x15, 0xbf, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xf0, 0x5, 0xb1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xc0, 0xd,
+    0xff, 0x92, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf,
+    0xff, 0x60, 0x4f, 0xff, 0xff, 0xd9, 0x54, 0x33,
+    0x46, 0xbf, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0,
+    0x0, 0x18, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x3, 0x7b, 0xde,
+    0xff, 0xec, 0x95, 0x0, 0x0, 0x0,
+
+    /* U+0054 "T" */
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x2d, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x23, 0x44, 0x44, 0x44, 0x44, 0xcf,
+    0xff, 0x44, 0x44, 0x44, 0x44, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+0055 "U" */
+    0x3f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xf4, 0x3f, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf4,
+    0x3f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xf4, 0x3f, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf4,
+    0x3f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xf4, 0x3f, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf4,
+    0x3f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xf4, 0x3f, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf4,
+    0x3f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xf4, 0x3f, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf4,
+    0x3f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xf4, 0x3f, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf4,
+    0x3f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xf4, 0x3f, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf4,
+    0x3f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xf4, 0x2f, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf3,
+    0x1f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xf2, 0xf, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf0,
+    0xb, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xc0, 0x7, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x70,
+    0x1, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0x10, 0x0, 0x7f, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0,
+    0x0, 0xb, 0xff, 0xff, 0xea, 0x75, 0x57, 0xae,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0x9c, 0xef, 0xfe, 0xc9, 0x50, 0x0, 0x0, 0x0,
+
+    /* U+0056 "V" */
+    0xc, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xfd, 0x0, 0x5f,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0x60, 0x0, 0xef, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0xe0, 0x0, 0x7, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xf8, 0x0, 0x0, 0xf, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x10,
+    0x0, 0x0, 0x8f, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0x90, 0x0, 0x0,
+    0x1, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xf2, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0x20, 0x0, 0x0, 0xc, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xf9, 0x0, 0x0, 0x4, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0,
+    0x0, 0x0, 0xbf, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x70, 0x0,
+    0x2f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xfe, 0x0, 0x9, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xf5, 0x1, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xc0, 0x8f, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0x4e, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+0057 "W" */
+    0x9f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0x64, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xf1, 0xe, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xfb, 0x0, 0x9f, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0x60, 0x3, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xf1, 0x0, 0xe,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xfc, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xfb, 0x0, 0x0, 0x8f, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0x2f, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x50, 0x0,
+    0x3, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xa0, 0xcf, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xf0, 0x0, 0x0, 0xd, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xf4, 0x6, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x9f, 0xfe, 0x0, 0x1f, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0x50, 0x0, 0x0, 0x3, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0xe, 0xff, 0x90, 0x0,
+    0xbf, 0xfe, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xf0, 0x0, 0x0,
+    0x4, 0xff, 0xf3, 0x0, 0x6, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0x50, 0x0, 0x0, 0xaf, 0xfe, 0x0,
+    0x0, 0xf, 0xff, 0x90, 0x0, 0x0, 0x5f, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfb, 0x0,
+    0x0, 0xf, 0xff, 0x80, 0x0, 0x0, 0xaf, 0xfe,
+    0x0, 0x0, 0xb, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xf1, 0x0, 0x5, 0xff, 0xf3,
+    0x0, 0x0, 0x5, 0xff, 0xf4, 0x0, 0x1, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0x60, 0x0, 0xbf, 0xfd, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xa0, 0x0, 0x6f, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xfb, 0x0, 0x1f, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x0, 0xb,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xf1, 0x6, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xf5, 0x1, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x60, 0xcf,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xa0,
+    0x6f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xfc, 0x1f, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xc, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf9,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xf7, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0058 "X" */
+    0x8, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xfe, 0x10, 0x0, 0xcf, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xf4, 0x0, 0x0, 0x1e, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0x80, 0x0, 0x0,
+    0x4, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0x40, 0x0, 0x8, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xe1, 0x0, 0x4f, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xfc, 0x1, 0xef,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0x8c, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xaf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xfc, 0x5, 0xff,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xf2, 0x0, 0x9f, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x50,
+    0x0, 0xd, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xfa, 0x0, 0x0, 0x2, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0x70, 0x0, 0x0, 0xaf, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf3, 0x0,
+    0x6, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xfe, 0x10, 0x2f, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xb0,
+
+    /* U+0059 "Y" */
+    0xd, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xf6, 0x3, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xff, 0xc0, 0x0, 0x9f, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x30, 0x0,
+    0x1e, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xf8, 0x0, 0x0, 0x5, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0x30, 0x0, 0x0,
+    0x5f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xc0, 0x0, 0x0, 0xef, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf6,
+    0x0, 0x9, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xef, 0xff, 0x10, 0x3f, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xa0, 0xdf, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfb,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+005A "Z" */
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x61, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x1f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0xef, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0x54, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x34, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd,
+
+    /* U+005B "[" */
+    0xf, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xff, 0xf, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xfa,
+    0x0, 0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0xff,
+    0xfa, 0x0, 0x0, 0xf, 0xff, 0xa0, 0x0, 0x0,
+    0xff, 0xfa, 0x0, 0x0, 0xf, 0xff, 0xa0, 0x0,
+    0x0, 0xff, 0xfa, 0x0, 0x0, 0xf, 0xff, 0xa0,
+    0x0, 0x0, 0xff, 0xfa, 0x0, 0x0, 0xf, 0xff,
+    0xa0, 0x0, 0x0, 0xff, 0xfa, 0x0, 0x0, 0xf,
+    0xff, 0xa0, 0x0, 0x0, 0xff, 0xfa, 0x0, 0x0,
+    0xf, 0xff, 0xa0, 0x0, 0x0, 0xff, 0xfa, 0x0,
+    0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0xff, 0xfa,
+    0x0, 0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0xff,
+    0xfa, 0x0, 0x0, 0xf, 0xff, 0xa0, 0x0, 0x0,
+    0xff, 0xfa, 0x0, 0x0, 0xf, 0xff, 0xa0, 0x0,
+    0x0, 0xff, 0xfa, 0x0, 0x0, 0xf, 0xff, 0xa0,
+    0x0, 0x0, 0xff, 0xfa, 0x0, 0x0, 0xf, 0xff,
+    0xa0, 0x0, 0x0, 0xff, 0xfa, 0x0, 0x0, 0xf,
+    0xff, 0xa0, 0x0, 0x0, 0xff, 0xfa, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff,
+    0xff, 0xf, 0xff, 0xff, 0xff, 0xf0,
+
+    /* U+005C "\\" */
+    0x4f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0x30,
+
+    /* U+005D "]" */
+    0x4f, 0xff, 0xff, 0xff, 0xa4, 0xff, 0xff, 0xff,
+    0xfa, 0x4f, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0xff, 0xfa, 0x0, 0x0, 0xf, 0xff, 0xa0, 0x0,
+    0x0, 0xff, 0xfa, 0x0, 0x0, 0xf, 0xff, 0xa0,
+    0x0, 0x0, 0xff, 0xfa, 0x0, 0x0, 0xf, 0xff,
+    0xa0, 0x0, 0x0, 0xff, 0xfa, 0x0, 0x0, 0xf,
+    0xff, 0xa0, 0x0, 0x0, 0xff, 0xfa, 0x0, 0x0,
+    0xf, 0xff, 0xa0, 0x0, 0x0, 0xff, 0xfa, 0x0,
+    0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0xff, 0xfa,
+    0x0, 0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0xff,
+    0xfa, 0x0, 0x0, 0xf, 0xff, 0xa0, 0x0, 0x0,
+    0xff, 0xfa, 0x0, 0x0, 0xf, 0xff, 0xa0, 0x0,
+    0x0, 0xff, 0xfa, 0x0, 0x0, 0xf, 0xff, 0xa0,
+    0x0, 0x0, 0xff, 0xfa, 0x0, 0x0, 0xf, 0xff,
+    0xa0, 0x0, 0x0, 0xff, 0xfa, 0x0, 0x0, 0xf,
+    0xff, 0xa0, 0x0, 0x0, 0xff, 0xfa, 0x0, 0x0,
+    0xf, 0xff, 0xa0, 0x0, 0x0, 0xff, 0xfa, 0x0,
+    0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0xff, 0xfa,
+    0x4f, 0xff, 0xff, 0xff, 0xa4, 0xff, 0xff, 0xff,
+    0xfa, 0x4f, 0xff, 0xff, 0xff, 0xa0,
+
+    /* U+005E "^" */
+    0x0, 0x0, 0x0, 0x4, 0x88, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfe,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xa7, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0x31, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xfc, 0x0, 0x9f, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xf6, 0x0, 0x3f, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xe0, 0x0, 0xc, 0xff, 0x10,
+    0x0, 0x0, 0x5, 0xff, 0x80, 0x0, 0x5, 0xff,
+    0x70, 0x0, 0x0, 0xc, 0xff, 0x10, 0x0, 0x0,
+    0xef, 0xe0, 0x0, 0x0, 0x3f, 0xfa, 0x0, 0x0,
+    0x0, 0x8f, 0xf5, 0x0, 0x0, 0xaf, 0xf4, 0x0,
+    0x0, 0x0, 0x1f, 0xfc, 0x0, 0x1, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0x30, 0x8, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x4, 0xff, 0xa0, 0xe,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf1,
+
+    /* U+005F "_" */
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0,
+
+    /* U+0060 "`" */
+    0x1c, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x3, 0xef, 0xfa, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xfb, 0x0,
+
+    /* U+0061 "a" */
+    0x0, 0x0, 0x16, 0xad, 0xef, 0xfe, 0xb7, 0x10,
+    0x0, 0x0, 0x2, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x70, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x90, 0x0, 0xe, 0xff, 0xd8,
+    0x42, 0x12, 0x5b, 0xff, 0xff, 0x50, 0x0, 0x6c,
+    0x30, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xf6, 0x0, 0x0, 0x3, 0x67,
+    0x89, 0x99, 0x99, 0xaf, 0xff, 0x60, 0x0, 0x6d,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x60, 0x6f, 0xff, 0xe6, 0x20, 0x0, 0x0, 0x3,
+    0xff, 0xf6, 0xd, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0x60, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xf6, 0xf, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x60, 0xef,
+    0xfd, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf6,
+    0x9, 0xff, 0xf9, 0x10, 0x0, 0x1, 0x8f, 0xff,
+    0xff, 0x60, 0x1d, 0xff, 0xff, 0xb9, 0x9b, 0xff,
+    0xfc, 0xff, 0xf6, 0x0, 0x1c, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x1f, 0xff, 0x60, 0x0, 0x4, 0xad,
+    0xff, 0xec, 0x93, 0x0, 0xff, 0xf6,
+
+    /* U+0062 "b" */
+    0x8f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0x10, 0x4, 0x9d, 0xef, 0xec, 0x72,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0x13, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x8f, 0xff,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x30,
+    0x0, 0x8f, 0xff, 0xff, 0xfe, 0x84, 0x23, 0x5a,
+    0xff, 0xff, 0xe2, 0x0, 0x8f, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xfc, 0x0, 0x8f,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
+    0xff, 0x50, 0x8f, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xc0, 0x8f, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf0,
+    0x8f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xf3, 0x8f, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xf4, 0x8f, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xf4, 0x8f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xf3, 0x8f, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf0, 0x8f,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xb0, 0x8f, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0xff, 0x50, 0x8f, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xfc, 0x0,
+    0x8f, 0xff, 0xff, 0xfe, 0x84, 0x23, 0x5a, 0xff,
+    0xff, 0xe2, 0x0, 0x8f, 0xff, 0x4f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x30, 0x0, 0x8f, 0xff,
+    0x3, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0,
+    0x0, 0x8f, 0xff, 0x0, 0x4, 0x9d, 0xff, 0xec,
+    0x82, 0x0, 0x0, 0x0,
+
+    /* U+0063 "c" */
+    0x0, 0x0, 0x0, 0x16, 0xbd, 0xff, 0xec, 0x82,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xa1, 0x0, 0x0, 0x2, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x2e,
+    0xff, 0xff, 0xa5, 0x32, 0x48, 0xef, 0xff, 0xd0,
+    0x0, 0xcf, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x1a,
+    0xff, 0xc2, 0x6, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa6, 0x0, 0xd, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa6, 0x0, 0x0, 0xcf,
+    0xff, 0xc2, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xc2,
+    0x0, 0x2e, 0xff, 0xff, 0xa5, 0x32, 0x48, 0xef,
+    0xff, 0xc0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x17, 0xbe, 0xff, 0xec, 0x82, 0x0, 0x0,
+
+    /* U+0064 "d" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x28, 0xce, 0xfe, 0xd9, 0x40,
+    0x3, 0xff, 0xf7, 0x0, 0x0, 0x2b, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x23, 0xff, 0xf7, 0x0, 0x4,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xff,
+    0xf7, 0x0, 0x3f, 0xff, 0xff, 0xa5, 0x33, 0x49,
+    0xff, 0xff, 0xff, 0xf7, 0x0, 0xdf, 0xff, 0xc2,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xf7, 0x7,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xf7, 0xd, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xf7, 0x2f, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf7,
+    0x4f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xf7, 0x6f, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xf7, 0x6f, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xf7, 0x4f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xf7, 0x1f, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf7, 0xd,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xf7, 0x7, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xf7, 0x0, 0xdf, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf7,
+    0x0, 0x3f, 0xff, 0xfd, 0x61, 0x0, 0x16, 0xcf,
+    0xff, 0xff, 0xf7, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf5, 0xff, 0xf7, 0x0, 0x0,
+    0x2b, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x30, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x38, 0xce, 0xfe, 0xda,
+    0x50, 0x0, 0xff, 0xf7,
+
+    /* U+0065 "e" */
+    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x3, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xc5, 0x20, 0x14, 0x9f, 0xff,
+    0xf7, 0x0, 0x0, 0xdf, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xf3, 0x0, 0x6f, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xb0, 0xd,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0x11, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xf6, 0x4f, 0xff, 0xb9, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x9f, 0xff, 0x86, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfa, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x94, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0xd, 0xff,
+    0xfc, 0x20, 0x0, 0x0, 0x0, 0x2c, 0xf4, 0x0,
+    0x0, 0x2e, 0xff, 0xff, 0xa6, 0x32, 0x35, 0xaf,
+    0xff, 0xf2, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x19,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x6b, 0xdf, 0xfe, 0xd9, 0x40,
+    0x0, 0x0,
+
+    /* U+0066 "f" */
+    0x0, 0x0, 0x0, 0x6, 0xbe, 0xff, 0xc7, 0x10,
+    0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xf9, 0x0,
+    0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x7, 0xff, 0xfb, 0x30, 0x4, 0x90, 0x0, 0x0,
+    0xcf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0x7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x60, 0x6f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf6, 0x0, 0x0, 0xf, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xa0, 0x0,
+    0x0, 0x0,
+
+    /* U+0067 "g" */
+    0x0, 0x0, 0x0, 0x38, 0xce, 0xfe, 0xda, 0x50,
+    0x0, 0xbf, 0xfb, 0x0, 0x0, 0x2b, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x50, 0xbf, 0xfb, 0x0, 0x5,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbf,
+    0xfb, 0x0, 0x5f, 0xff, 0xff, 0x95, 0x32, 0x37,
+    0xcf, 0xff, 0xff, 0xfb, 0x1, 0xef, 0xff, 0xa1,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfb, 0x9,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xfb, 0xe, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xfb, 0x3f, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfb,
+    0x5f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xfb, 0x6f, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xfb, 0x5f, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xfb, 0x3f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xfb, 0xe, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfb, 0x8,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xfb, 0x1, 0xef, 0xff, 0xb1, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xfb, 0x0, 0x4f, 0xff,
+    0xff, 0xa5, 0x32, 0x47, 0xdf, 0xff, 0xff, 0xfb,
+    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf7, 0xef, 0xfb, 0x0, 0x0, 0x2b, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x50, 0xef, 0xfa, 0x0, 0x0,
+    0x0, 0x38, 0xce, 0xff, 0xda, 0x50, 0x0, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf4, 0x0,
+    0x5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xff, 0xf0, 0x0, 0x4f, 0xd5, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xcf, 0xff, 0x80, 0x1, 0xef, 0xff,
+    0xea, 0x64, 0x22, 0x36, 0xaf, 0xff, 0xfd, 0x10,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe2, 0x0, 0x0, 0x4, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0,
+    0x1, 0x69, 0xce, 0xff, 0xed, 0xa7, 0x10, 0x0,
+    0x0,
+
+    /* U+0068 "h" */
+    0x8f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0x10, 0x5, 0xad, 0xef, 0xeb, 0x71,
+    0x0, 0x0, 0x8f, 0xff, 0x14, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x8f, 0xff, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x8f, 0xff,
+    0xff, 0xfc, 0x74, 0x34, 0x8e, 0xff, 0xff, 0x50,
+    0x8f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xd0, 0x8f, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xf2, 0x8f, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xf6, 0x8f, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf7,
+    0x8f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf9, 0x8f, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf9, 0x8f, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xf9, 0x8f, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf9,
+    0x8f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf9, 0x8f, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf9, 0x8f, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xf9, 0x8f, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf9,
+    0x8f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf9, 0x8f, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf9, 0x8f, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xf9, 0x8f, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf9,
+
+    /* U+0069 "i" */
+    0x0, 0x57, 0x20, 0xa, 0xff, 0xf4, 0x1f, 0xff,
+    0xfa, 0x1f, 0xff, 0xf9, 0x6, 0xff, 0xd1, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xf1, 0x8, 0xff,
+    0xf1, 0x8, 0xff, 0xf1, 0x8, 0xff, 0xf1, 0x8,
+    0xff, 0xf1, 0x8, 0xff, 0xf1, 0x8, 0xff, 0xf1,
+    0x8, 0xff, 0xf1, 0x8, 0xff, 0xf1, 0x8, 0xff,
+    0xf1, 0x8, 0xff, 0xf1, 0x8, 0xff, 0xf1, 0x8,
+    0xff, 0xf1, 0x8, 0xff, 0xf1, 0x8, 0xff, 0xf1,
+    0x8, 0xff, 0xf1, 0x8, 0xff, 0xf1, 0x8, 0xff,
+    0xf1, 0x8, 0xff, 0xf1, 0x8, 0xff, 0xf1,
+
+    /* U+006A "j" */
+    0x0, 0x0, 0x0, 0x0, 0x47, 0x40, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf0,
+    0x7, 0x83, 0x12, 0xaf, 0xff, 0xb0, 0xe, 0xff,
+    0xff, 0xff, 0xff, 0x30, 0x5f, 0xff, 0xff, 0xff,
+    0xf5, 0x0, 0x5, 0xbe, 0xff, 0xd9, 0x20, 0x0,
+
+    /* U+006B "k" */
+    0x8f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xd1, 0x8, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xd1,
+    0x0, 0x8f, 0xff, 0x10, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xd1, 0x0, 0x8, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xd1, 0x0, 0x0, 0x8f, 0xff,
+    0x10, 0x0, 0x1, 0xcf, 0xff, 0xc1, 0x0, 0x0,
+    0x8, 0xff, 0xf1, 0x0, 0x1, 0xdf, 0xff, 0xc1,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0x10, 0x2, 0xef,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf1,
+    0x3, 0xef, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0x14, 0xff, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0xef, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0x62, 0xef, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0x50, 0x4, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x8, 0xff, 0xff, 0x40,
+    0x0, 0x7, 0xff, 0xff, 0x30, 0x0, 0x0, 0x8f,
+    0xff, 0x40, 0x0, 0x0, 0xa, 0xff, 0xfe, 0x10,
+    0x0, 0x8, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xfb, 0x0, 0x0, 0x8f, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x1e, 0xff, 0xf8, 0x0, 0x8, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf5,
+    0x0, 0x8f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xf2, 0x8, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xd1,
+
+    /* U+006C "l" */
+    0x8f, 0xff, 0x18, 0xff, 0xf1, 0x8f, 0xff, 0x18,
+    0xff, 0xf1, 0x8f, 0xff, 0x18, 0xff, 0xf1, 0x8f,
+    0xff, 0x18, 0xff, 0xf1, 0x8f, 0xff, 0x18, 0xff,
+    0xf1, 0x8f, 0xff, 0x18, 0xff, 0xf1, 0x8f, 0xff,
+    0x18, 0xff, 0xf1, 0x8f, 0xff, 0x18, 0xff, 0xf1,
+    0x8f, 0xff, 0x18, 0xff, 0xf1, 0x8f, 0xff, 0x18,
+    0xff, 0xf1, 0x8f, 0xff, 0x18, 0xff, 0xf1, 0x8f,
+    0xff, 0x18, 0xff, 0xf1, 0x8f, 0xff, 0x18, 0xff,
+    0xf1, 0x8f, 0xff, 0x18, 0xff, 0xf1,
+
+    /* U+006D "m" */
+    0x8f, 0xff, 0x0, 0x16, 0xbd, 0xff, 0xda, 0x40,
+    0x0, 0x0, 0x3, 0x8c, 0xef, 0xed, 0x93, 0x0,
+    0x0, 0x8f, 0xff, 0x7, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x20, 0x2, 0xbf, 0xff, 0xff, 0xff, 0xff,
+    0xb1, 0x0, 0x8f, 0xff, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x10, 0x8f, 0xff, 0xff, 0xf8, 0x31,
+    0x2, 0x7e, 0xff, 0xfd, 0xef, 0xff, 0x83, 0x11,
+    0x38, 0xff, 0xff, 0xa0, 0x8f, 0xff, 0xfe, 0x20,
+    0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xf2, 0x8f, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xf7, 0x8f, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfb, 0x8f,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xfd,
+    0x8f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xfe, 0x8f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xfe, 0x8f, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xfe, 0x8f, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xfe, 0x8f, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xfe, 0x8f, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xfe, 0x8f, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfe, 0x8f,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfe,
+    0x8f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xfe, 0x8f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xfe, 0x8f, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xfe, 0x8f, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xfe,
+
+    /* U+006E "n" */
+    0x8f, 0xff, 0x0, 0x6, 0xad, 0xff, 0xeb, 0x71,
+    0x0, 0x0, 0x8f, 0xff, 0x6, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x8f, 0xff, 0x8f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x8f, 0xff,
+    0xff, 0xfa, 0x41, 0x1, 0x5c, 0xff, 0xff, 0x50,
+    0x8f, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xd0, 0x8f, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xf2, 0x8f, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xf6, 0x8f, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf7,
+    0x8f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf9, 0x8f, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf9, 0x8f, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xf9, 0x8f, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf9,
+    0x8f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf9, 0x8f, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf9, 0x8f, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xf9, 0x8f, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf9,
+    0x8f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf9, 0x8f, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf9, 0x8f, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xf9, 0x8f, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf9,
+
+    /* U+006F "o" */
+    0x0, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xec, 0x82,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x3,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x2e, 0xff, 0xff, 0xa5, 0x33, 0x49,
+    0xef, 0xff, 0xf3, 0x0, 0x0, 0xdf, 0xff, 0xc1,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xfe, 0x10, 0x6,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0x80, 0xd, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf3,
+    0x4f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xf6, 0x6f, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x6f, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xf7, 0x4f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xf6, 0x1f, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf3, 0xd,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xe0, 0x6, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0x80, 0x0, 0xcf, 0xff,
+    0xc2, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xfe, 0x0,
+    0x0, 0x2e, 0xff, 0xff, 0xa5, 0x33, 0x49, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xec,
+    0x82, 0x0, 0x0, 0x0,
+
+    /* U+0070 "p" */
+    0x8f, 0xff, 0x0, 0x5, 0xad, 0xff, 0xec, 0x72,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0x4, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x8f, 0xff,
+    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x30,
+    0x0, 0x8f, 0xff, 0xff, 0xfc, 0x61, 0x0, 0x27,
+    0xef, 0xff, 0xe2, 0x0, 0x8f, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xfc, 0x0, 0x8f,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0x50, 0x8f, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0xc0, 0x8f, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf0,
+    0x8f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xf3, 0x8f, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xf4, 0x8f, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xf4, 0x8f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xf3, 0x8f, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf0, 0x8f,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xb0, 0x8f, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0xff, 0x50, 0x8f, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xfc, 0x0,
+    0x8f, 0xff, 0xff, 0xfe, 0x94, 0x23, 0x5b, 0xff,
+    0xff, 0xe2, 0x0, 0x8f, 0xff, 0x5f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x30, 0x0, 0x8f, 0xff,
+    0x12, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0,
+    0x0, 0x8f, 0xff, 0x10, 0x4, 0x9d, 0xff, 0xec,
+    0x82, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+0071 "q" */
+    0x0, 0x0, 0x0, 0x28, 0xce, 0xfe, 0xd9, 0x40,
+    0x0, 0xff, 0xf7, 0x0, 0x0, 0x2b, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x20, 0xff, 0xf7, 0x0, 0x4,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff,
+    0xf7, 0x0, 0x3f, 0xff, 0xff, 0xa5, 0x33, 0x49,
+    0xff, 0xff, 0xff, 0xf7, 0x0, 0xdf, 0xff, 0xc1,
+    0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xf7, 0x7,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xf7, 0xd, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xf7, 0x2f, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf7,
+    0x4f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xf7, 0x6f, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xf7, 0x6f, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xf7, 0x4f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xf7, 0x1f, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf7, 0xd,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xf7, 0x7, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0xf7, 0x0, 0xdf, 0xff,
+    0xc2, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xf7,
+    0x0, 0x3f, 0xff, 0xff, 0xa5, 0x33, 0x49, 0xff,
+    0xff, 0xff, 0xf7, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe5, 0xff, 0xf7, 0x0, 0x0,
+    0x2b, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x23, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x38, 0xce, 0xfe, 0xd9,
+    0x30, 0x3, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xf7,
+
+    /* U+0072 "r" */
+    0x8f, 0xff, 0x0, 0x5, 0xad, 0xe4, 0x8f, 0xff,
+    0x3, 0xdf, 0xff, 0xf4, 0x8f, 0xff, 0x4f, 0xff,
+    0xff, 0xf4, 0x8f, 0xff, 0xef, 0xff, 0xb8, 0x72,
+    0x8f, 0xff, 0xff, 0x91, 0x0, 0x0, 0x8f, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+0073 "s" */
+    0x0, 0x0, 0x3, 0x9c, 0xef, 0xfe, 0xc9, 0x51,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x91, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xd0, 0x0, 0xdf, 0xff, 0xc5, 0x21,
+    0x12, 0x59, 0xef, 0x50, 0x3, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0x0, 0x6, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xfe, 0xb7, 0x41, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xea,
+    0x50, 0x0, 0x0, 0x0, 0x5c, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x3, 0x69,
+    0xcf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4c, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfe, 0x0,
+    0xd8, 0x10, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfb,
+    0x7, 0xff, 0xfb, 0x74, 0x21, 0x24, 0x8f, 0xff,
+    0xf5, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xa0, 0x1, 0x9f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x59, 0xce, 0xff,
+    0xed, 0xa6, 0x10, 0x0,
+
+    /* U+0074 "t" */
+    0x0, 0x0, 0x88, 0x85, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x60, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf6, 0x6, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xfd, 0x41, 0x15, 0xb0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x4e,
+    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x18,
+    0xcf, 0xfe, 0xb5, 0x0,
+
+    /* U+0075 "u" */
+    0xbf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xf3, 0xbf, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xf3, 0xbf, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xf3, 0xbf, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf3,
+    0xbf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xf3, 0xbf, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xf3, 0xbf, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xf3, 0xbf, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf3,
+    0xbf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xf3, 0xbf, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xf3, 0xbf, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xf3, 0xbf, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf3,
+    0xaf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xf3, 0x8f, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xf3, 0x5f, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf3, 0xe, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf3,
+    0x7, 0xff, 0xff, 0x93, 0x0, 0x14, 0xbf, 0xff,
+    0xff, 0xf3, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xff, 0xf3, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x33, 0xff, 0xf3, 0x0, 0x0,
+    0x17, 0xbe, 0xff, 0xda, 0x50, 0x3, 0xff, 0xf3,
+
+    /* U+0076 "v" */
+    0xd, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0x10, 0x6f, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x90, 0x0,
+    0xef, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xf2, 0x0, 0x8, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xfb, 0x0, 0x0, 0x1f,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0x40, 0x0, 0x0, 0xaf, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xd0, 0x0, 0x0, 0x3, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x9f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0x60, 0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xfd, 0x0, 0x0, 0x7, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf4,
+    0x0, 0x0, 0xef, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xa0, 0x0, 0x5f, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x10,
+    0xc, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xf8, 0x3, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xe0, 0xaf,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0x8f, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0077 "w" */
+    0x9f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xfb, 0x3f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xf5, 0xd, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xf0, 0x7, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0x90, 0x1, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0x30, 0x0, 0xbf, 0xfb,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xda, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x6f, 0xfd, 0x0, 0x0, 0x5f,
+    0xff, 0x10, 0x0, 0x0, 0xd, 0xff, 0x74, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0xcf, 0xf7, 0x0, 0x0,
+    0xe, 0xff, 0x70, 0x0, 0x0, 0x3f, 0xff, 0x10,
+    0xef, 0xf7, 0x0, 0x0, 0x2, 0xff, 0xf1, 0x0,
+    0x0, 0x9, 0xff, 0xc0, 0x0, 0x0, 0xaf, 0xfa,
+    0x0, 0x7f, 0xfd, 0x0, 0x0, 0x8, 0xff, 0xb0,
+    0x0, 0x0, 0x3, 0xff, 0xf2, 0x0, 0x0, 0xff,
+    0xf4, 0x0, 0x1f, 0xff, 0x30, 0x0, 0xe, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0xdf, 0xf8, 0x0, 0x6,
+    0xff, 0xe0, 0x0, 0xb, 0xff, 0x90, 0x0, 0x4f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x0,
+    0xc, 0xff, 0x80, 0x0, 0x5, 0xff, 0xf0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0x40, 0x2f, 0xff, 0x10, 0x0, 0x0, 0xef, 0xf5,
+    0x1, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xa0, 0x8f, 0xfb, 0x0, 0x0, 0x0, 0x9f,
+    0xfb, 0x6, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xf1, 0xef, 0xf5, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0x1c, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xfa, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xaf, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0x90, 0x0, 0x0, 0x0,
+
+    /* U+0078 "x" */
+    0xb, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xfa, 0x0, 0x1d, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xfd, 0x0, 0x0, 0x3f, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x20, 0x0,
+    0x0, 0x6f, 0xff, 0xa0, 0x0, 0x0, 0xaf, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x70, 0x0,
+    0x6f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0x30, 0x3f, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xfe, 0x2d, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xaf, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0x90, 0xaf, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xc0,
+    0x0, 0xdf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x1e,
+    0xff, 0xe1, 0x0, 0x2, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xf4, 0x0, 0x0, 0x5, 0xff,
+    0xfa, 0x0, 0x0, 0x8, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xf7, 0x0, 0x4, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf4, 0x2,
+    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xe1,
+
+    /* U+0079 "y" */
+    0xd, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0x10, 0x6f, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x90, 0x0,
+    0xef, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xf2, 0x0, 0x7, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xfb, 0x0, 0x0, 0x1f,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0x30, 0x0, 0x0, 0x9f, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xc0, 0x0, 0x0, 0x2, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0xaf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0x80, 0x0, 0x0, 0x1f, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xfe, 0x0, 0x0, 0x8, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf6,
+    0x0, 0x0, 0xef, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xd0, 0x0, 0x6f, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x50,
+    0xd, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xfc, 0x4, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf3, 0xbf,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xcf, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xde, 0x62, 0x14, 0xcf, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x8c, 0xef, 0xeb, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+007A "z" */
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf1, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf1, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xef, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf6,
+
+    /* U+007B "{" */
+    0x0, 0x0, 0x3, 0xad, 0xff, 0x90, 0x0, 0x6,
+    0xff, 0xff, 0xf9, 0x0, 0x2, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x8f, 0xff, 0xc2, 0x0, 0x0, 0xb,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0xcf, 0xfe, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0xcf, 0xfd, 0x0, 0x0, 0x0, 0xc, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0xcf, 0xfd, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xcf, 0xfd,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0xcf, 0xfd, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xd0, 0x0, 0x0, 0x5, 0xff, 0xfa, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0x30, 0x0, 0xd, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x5, 0xff, 0xfa, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0xcf, 0xfd, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0xcf, 0xfd, 0x0, 0x0, 0x0, 0xc, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0xcf, 0xfd, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xcf, 0xfd,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0xcf, 0xfe, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xc2, 0x0,
+    0x0, 0x2, 0xff, 0xff, 0xff, 0x90, 0x0, 0x6,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x3, 0xae, 0xff,
+    0x90,
+
+    /* U+007C "|" */
+    0xf, 0xff, 0x60, 0xff, 0xf6, 0xf, 0xff, 0x60,
+    0xff, 0xf6, 0xf, 0xff, 0x60, 0xff, 0xf6, 0xf,
+    0xff, 0x60, 0xff, 0xf6, 0xf, 0xff, 0x60, 0xff,
+    0xf6, 0xf, 0xff, 0x60, 0xff, 0xf6, 0xf, 0xff,
+    0x60, 0xff, 0xf6, 0xf, 0xff, 0x60, 0xff, 0xf6,
+    0xf, 0xff, 0x60, 0xff, 0xf6, 0xf, 0xff, 0x60,
+    0xff, 0xf6, 0xf, 0xff, 0x60, 0xff, 0xf6, 0xf,
+    0xff, 0x60, 0xff, 0xf6, 0xf, 0xff, 0x60, 0xff,
+    0xf6, 0xf, 0xff, 0x60, 0xff, 0xf6, 0xf, 0xff,
+    0x60, 0xff, 0xf6, 0xf, 0xff, 0x60, 0xff, 0xf6,
+    0xf, 0xff, 0x60, 0xff, 0xf6, 0xf, 0xff, 0x60,
+
+    /* U+007D "}" */
+    0x4f, 0xfe, 0xb6, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x18, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x1, 0xdf, 0xff, 0xf2, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x4f, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0x20, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0x10, 0x0, 0x0, 0x18, 0xff, 0xfe, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x4f, 0xfe, 0xb6, 0x0,
+    0x0, 0x0,
+
+    /* U+007E "~" */
+    0x0, 0x7, 0xbb, 0x93, 0x0, 0x0, 0x0, 0x6,
+    0xca, 0x1, 0xdf, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0xa, 0xfc, 0xc, 0xff, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0xe, 0xfa, 0x3f, 0xfc, 0x20, 0x5e, 0xff,
+    0xd2, 0x0, 0x9f, 0xf6, 0x8f, 0xf2, 0x0, 0x1,
+    0xdf, 0xff, 0xce, 0xff, 0xe0, 0xbf, 0xc0, 0x0,
+    0x0, 0xb, 0xff, 0xff, 0xff, 0x40, 0x9b, 0x70,
+    0x0, 0x0, 0x0, 0x5c, 0xff, 0xb3, 0x0,
+
+    /* U+00B0 "°" */
+    0x0, 0x1, 0x7c, 0xfe, 0xc6, 0x0, 0x0, 0x0,
+    0x3e, 0xff, 0xff, 0xff, 0xd2, 0x0, 0x2, 0xff,
+    0xb3, 0x0, 0x4d, 0xfe, 0x10, 0xb, 0xfb, 0x0,
+    0x0, 0x0, 0xcf, 0x90, 0x1f, 0xf2, 0x0, 0x0,
+    0x0, 0x3f, 0xf0, 0x3f, 0xe0, 0x0, 0x0, 0x0,
+    0xf, 0xf2, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0xf,
+    0xf2, 0x1f, 0xf2, 0x0, 0x0, 0x0, 0x4f, 0xf0,
+    0xb, 0xfb, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x2,
+    0xff, 0xc4, 0x1, 0x5d, 0xfe, 0x10, 0x0, 0x3e,
+    0xff, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x1, 0x7d,
+    0xfe, 0xc7, 0x0, 0x0,
+
+    /* U+2022 "•" */
+    0x0, 0x7c, 0xb6, 0x0, 0xb, 0xff, 0xff, 0xa0,
+    0x4f, 0xff, 0xff, 0xf3, 0x7f, 0xff, 0xff, 0xf5,
+    0x4f, 0xff, 0xff, 0xf4, 0xd, 0xff, 0xff, 0xc0,
+    0x1, 0xae, 0xe9, 0x0,
+
+    /* U+F001 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x5a, 0xef, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7c, 0xff,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0x9e, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x16, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x38, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x5a, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7c,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x5e,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc8, 0x30, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xa6, 0x10, 0x0, 0x0, 0xe, 0xff,
+    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x94, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xfb, 0x72, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfa,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x55, 0x53, 0xef, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x1,
+    0x58, 0x99, 0x7c, 0xff, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x0, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x90, 0x1d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2,
+    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xff, 0xff, 0xd2, 0x1, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x39, 0xef, 0xff, 0xfb, 0x60, 0x0, 0x1f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x10,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xcf, 0xff, 0xff, 0xff, 0xfc,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49,
+    0xcd, 0xdb, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+F008 "" */
+    0x17, 0x30, 0x0, 0x7, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70,
+    0x0, 0x3, 0x71, 0xcf, 0x60, 0x0, 0xe, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x0, 0x6, 0xfc, 0xff, 0xa2,
+    0x22, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x22, 0x2a,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xb4, 0x44, 0x5f, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf5, 0x44,
+    0x4b, 0xff, 0xff, 0x60, 0x0, 0xe, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xe0, 0x0, 0x6, 0xff, 0xff, 0x60, 0x0,
+    0xe, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xe0, 0x0, 0x6, 0xff,
+    0xff, 0x60, 0x0, 0xe, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xe0,
+    0x0, 0x6, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xf1, 0x0, 0x8, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x66, 0x7f,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xff, 0xf7, 0x66, 0x6c, 0xff, 0xff,
+    0x60, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
+    0x6, 0xff, 0xff, 0x60, 0x0, 0xe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x0, 0x6, 0xff, 0xff, 0x60, 0x0,
+    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x6, 0xff,
+    0xff, 0x70, 0x0, 0xf, 0xff, 0xf9, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x9f, 0xff, 0xf0,
+    0x0, 0x7, 0xff, 0xff, 0xfe, 0xee, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xee, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xd8, 0x88, 0x9f, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xf9, 0x88, 0x8d, 0xff, 0xff, 0x60, 0x0, 0xe,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xe0, 0x0, 0x6, 0xff, 0xff,
+    0x60, 0x0, 0xe, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xe0, 0x0,
+    0x6, 0xff, 0xff, 0x60, 0x0, 0xe, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xe0, 0x0, 0x6, 0xff, 0xff, 0x70, 0x0,
+    0xe, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xe0, 0x0, 0x7, 0xff,
+    0xff, 0xfc, 0xcc, 0xdf, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfd,
+    0xcc, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea,
+    0xaa, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xaa, 0xae,
+    0xff, 0xff, 0x60, 0x0, 0xe, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0x6, 0xff, 0x6f, 0x60, 0x0, 0xe,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe0, 0x0, 0x6, 0xf6,
+
+    /* U+F00B "" */
+    0x5e, 0xff, 0xff, 0xff, 0xfe, 0x60, 0x1, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe5, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf1, 0x9, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x9,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf1, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf1, 0x9, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xcf, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x5, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x17, 0x88, 0x88, 0x88, 0x87,
+    0x10, 0x0, 0x58, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x71, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
+    0xff, 0x60, 0x1, 0xcf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x8, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf1, 0x9, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x9, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf1, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf1, 0x9, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xd0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x17,
+    0x88, 0x88, 0x88, 0x87, 0x10, 0x0, 0x47, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xff, 0xff, 0x70, 0x1, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf1, 0x9, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x9,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf1, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf1, 0x9, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x4, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0x6, 0x77, 0x77, 0x77, 0x76,
+    0x10, 0x0, 0x47, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x60,
+
+    /* U+F00C "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x25, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfe,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x7,
+    0xd9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xb0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0x5f, 0xff, 0xff,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xff,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xdf, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xd6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F00D "" */
+    0x0, 0x2, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x30, 0x0, 0x0, 0xb, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xc1, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xd1,
+    0x9, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0xb0, 0xff, 0xff,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xff, 0xff, 0x1d, 0xff, 0xff, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x3f,
+    0xff, 0xff, 0xff, 0xff, 0xb0, 0x9, 0xff, 0xff,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xff, 0xff, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x3f,
+    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x9, 0xff,
+    0xff, 0xff, 0xff, 0xf5, 0x0, 0x3f, 0xff, 0xff,
+    0xff, 0xff, 0xb0, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xa0, 0xef, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xd, 0xff,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xff, 0xf0, 0x5f, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xf7, 0x0, 0x6f, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0,
+    0x4c, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3b, 0xc6, 0x0, 0x0,
+
+    /* U+F011 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x44, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x38, 0x30, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x10,
+    0x0, 0x2, 0x85, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xf2, 0x0, 0x0, 0xdf,
+    0xff, 0xff, 0x10, 0x0, 0xe, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfb,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x8f,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0x40, 0x0, 0xdf, 0xff, 0xff,
+    0x10, 0x1, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0x60, 0x0,
+    0xdf, 0xff, 0xff, 0x10, 0x3, 0xff, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0xfd, 0x10, 0x0, 0xdf, 0xff, 0xff, 0x10, 0x0,
+    0xbf, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0x10, 0x0, 0x9, 0xff, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0xaf, 0xff, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0xc, 0xff, 0xff, 0xfe, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0x50, 0x6, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0xa0, 0xa, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0,
+    0xe, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xff, 0xf2, 0xf, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xf4, 0x2f, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xf6, 0x3f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xf6, 0x3f, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf6, 0x2f,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xf5, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x22, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xf3, 0xd, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1,
+    0x9, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xd0, 0x4, 0xff, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0x90, 0x0, 0xef,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0x8f, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xef, 0xff, 0xff, 0xf4, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
+    0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff,
+    0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x1e,
+    0xff, 0xff, 0xff, 0xff, 0xa5, 0x10, 0x0, 0x0,
+    0x49, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xdd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8c, 0xff,
+    0xff, 0xff, 0xda, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x11, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F013 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x58, 0x9a, 0xa9, 0x74, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xd4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xad, 0x50, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc3, 0x0, 0x8, 0xf7, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xfc, 0x4a, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x85, 0xef, 0xff,
+    0x50, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf1, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x6, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
+    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xb0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf2, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe5, 0x0, 0x1, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x1a, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0,
+    0x2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xc2, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x3, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10,
+    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf3, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x75, 0x58, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf4, 0x1f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xa, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x10, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xec, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x2,
+    0xff, 0xd4, 0x2, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0x10, 0x6e, 0xfd, 0x10, 0x0,
+    0x0, 0x0, 0x36, 0x0, 0x0, 0x7, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x40, 0x0, 0x0, 0x72,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xdf, 0xff, 0xff, 0xfc, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x12, 0x21, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F015 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xce, 0xb3, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xf6, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0xbf, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3e, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0xb,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x20, 0xbf, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xfd, 0x8e, 0xff,
+    0xff, 0xff, 0x4b, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
+    0xff, 0xff, 0xfa, 0x0, 0x2d, 0xff, 0xff, 0xff,
+    0xef, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xef, 0xff, 0xff, 0xf5, 0x0, 0x26, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xe3, 0x0, 0x4f, 0xfd, 0x20, 0x5, 0xff,
+    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xc1, 0x0,
+    0x7f, 0xff, 0xfe, 0x40, 0x3, 0xef, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
+    0xff, 0xff, 0xff, 0x90, 0x0, 0xaf, 0xff, 0xff,
+    0xff, 0x60, 0x1, 0xcf, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xff,
+    0x70, 0x1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0xaf, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xff, 0xff, 0x40, 0x3, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x7f,
+    0xff, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x8f, 0xff,
+    0xff, 0xfd, 0x20, 0x5, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd2, 0x0, 0x5f, 0xff, 0xff,
+    0xff, 0x40, 0x0, 0xaf, 0xff, 0xff, 0xfb, 0x10,
+    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf4, 0x0, 0x2e, 0xff, 0xff, 0xff, 0x70,
+    0xcf, 0xff, 0xff, 0xf9, 0x0, 0xa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0x0, 0x1c, 0xff, 0xff, 0xff, 0x8c, 0xff, 0xff,
+    0xf6, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x9,
+    0xff, 0xff, 0xf8, 0x1e, 0xff, 0xe4, 0x0, 0x3e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x10, 0x7, 0xff, 0xfc,
+    0x0, 0x3f, 0xd2, 0x0, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x30, 0x4, 0xfe, 0x10, 0x0, 0x10,
+    0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xcc, 0xcc, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x14, 0x44, 0x44, 0x44, 0x44, 0x0, 0x0,
+    0x0, 0x0, 0x14, 0x44, 0x44, 0x44, 0x44, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+F019 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x22, 0x22, 0x22, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3d, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xee, 0xee, 0xee, 0xd3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
+    0x0, 0x7f, 0xff, 0xf7, 0x0, 0x4f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x30, 0x7, 0xff, 0x70, 0x3,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
+    0x33, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x30, 0x0, 0x3, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x33, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x20, 0x8f, 0xd0, 0xc, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x4f,
+    0xa0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x72, 0xcf, 0xf4, 0x4e, 0xff, 0xff, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe5,
+
+    /* U+F01C "" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x8a, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xba,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xef, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xfe, 0x10, 0x0, 0xd, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xfa, 0x0, 0x9, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf5, 0x3,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xe1, 0xbf, 0xff, 0xff,
+    0x44, 0x44, 0x44, 0x44, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x44, 0x44, 0x44, 0x44, 0x6f,
+    0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x88, 0x88, 0x88, 0x88, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x95, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe1, 0x5, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x0,
+
+    /* U+F021 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0x77, 0x74, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x46, 0x77, 0x53, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5a, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x71, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xa1, 0x0, 0x2f, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x1f,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xf, 0xff, 0xff, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xff, 0xff, 0xb6, 0x20, 0x0, 0x2,
+    0x7c, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xb2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xe,
+    0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x7f, 0xff, 0xff, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0xc,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0xef, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xed, 0xdd, 0xff, 0xff, 0xff, 0xff, 0x5,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xa, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x1, 0x22, 0x21, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xff, 0xd0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xe0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0x60, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff,
+    0x10, 0xff, 0xff, 0xff, 0xff, 0x90, 0x1, 0x23,
+    0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xf9, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xf2, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x20, 0x0, 0x0, 0x0,
+    0x2, 0x9f, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x85, 0x33, 0x57, 0xcf, 0xff, 0xff, 0xff, 0xfe,
+    0x30, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x3e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xf1, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xf2, 0x0, 0x4, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf3, 0x0,
+    0x0, 0x5, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x2, 0x7b, 0xef,
+    0xff, 0xff, 0xd9, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7a, 0xaa, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x22, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F026 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0xf0, 0x34, 0x44, 0x44, 0x44, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F027 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x34, 0x44,
+    0x44, 0x44, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x2, 0xef, 0x90,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0x7f, 0xff, 0xb0, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x4, 0xff, 0xff, 0x80, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0x0, 0x4, 0xff, 0xff, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x6, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1f,
+    0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x2, 0xff, 0xf6,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x9f, 0xff, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0xaf, 0xff, 0xd0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
+    0x6f, 0xff, 0xf4, 0xf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x6, 0xff,
+    0xf6, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0x0, 0x8, 0xb3, 0x0,
+    0x5, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+F028 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x10,
+    0x0, 0x1, 0xdf, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x1, 0xdf, 0xa1, 0x0, 0x1,
+    0xef, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xd2, 0x0, 0x4, 0xff, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xe2, 0x0, 0x9, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0xd0,
+    0x0, 0xe, 0xff, 0xf0, 0x0, 0x34, 0x44, 0x44,
+    0x44, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xff, 0x90, 0x0, 0x7f,
+    0xff, 0x60, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x20, 0x0,
+    0x2, 0xff, 0xff, 0x20, 0x0, 0xff, 0xfb, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x2, 0xef, 0xa0, 0x0, 0x6, 0xff,
+    0xf9, 0x0, 0xa, 0xff, 0xf1, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
+    0x7f, 0xff, 0xc0, 0x0, 0xe, 0xff, 0xe0, 0x0,
+    0x5f, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x3, 0xff, 0xff,
+    0x80, 0x0, 0x7f, 0xff, 0x30, 0x2, 0xff, 0xf7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0x0, 0x4, 0xef, 0xff, 0x10, 0x3,
+    0xff, 0xf6, 0x0, 0xf, 0xff, 0x9f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x5, 0xff, 0xf5, 0x0, 0xf, 0xff, 0x80,
+    0x0, 0xef, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1f,
+    0xff, 0x70, 0x0, 0xff, 0xf9, 0x0, 0xd, 0xff,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x2, 0xff, 0xf6, 0x0,
+    0xf, 0xff, 0x90, 0x0, 0xef, 0xfb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0xaf, 0xff, 0x30, 0x1, 0xff, 0xf8,
+    0x0, 0xf, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xbf,
+    0xff, 0xc0, 0x0, 0x5f, 0xff, 0x50, 0x0, 0xff,
+    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0x7f, 0xff, 0xf3, 0x0,
+    0xa, 0xff, 0xf1, 0x0, 0x4f, 0xff, 0x5f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x6, 0xff, 0xf5, 0x0, 0x2, 0xff, 0xfc,
+    0x0, 0x8, 0xff, 0xf2, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7,
+    0x93, 0x0, 0x0, 0xbf, 0xff, 0x50, 0x0, 0xdf,
+    0xfe, 0x5, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xd0, 0x0, 0x4f, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf4,
+    0x0, 0xb, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xff, 0xf7, 0x0, 0x4, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xf9, 0x0, 0x0, 0xdf, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf7, 0x0,
+    0x0, 0x9f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x6, 0x92, 0x0, 0x0, 0x7f, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x82, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+F03E "" */
+    0x0, 0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x41, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x8f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x40, 0x1, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x70, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72,
+    0x3, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x29, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x8f, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10,
+    0x0, 0x8, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x8f, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0,
+    0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf5, 0x5, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50,
+
+    /* U+F043 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0xe, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf1, 0x5, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x70, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xd, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xfb, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf, 0xff, 0xfd, 0x0, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xef,
+    0xff, 0xd0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd, 0xff, 0xfe, 0x0,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xaf, 0xff, 0xf3, 0x3, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x6,
+    0xff, 0xff, 0xa0, 0x8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff,
+    0x40, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf3, 0x0, 0x9f, 0xff, 0xff, 0x30, 0x2,
+    0x8a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x5, 0xff,
+    0xff, 0xff, 0xc6, 0x20, 0x2e, 0xff, 0xff, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8e,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x79, 0xbb,
+    0x98, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F048 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xee,
+    0x70, 0x4f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0x44, 0xff, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xf7, 0x4f, 0xff, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x84, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xff, 0xf8, 0x4f, 0xff, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0x84,
+    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x4f, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x84, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x1d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x4f, 0xff, 0xff,
+    0x10, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x84, 0xff, 0xff, 0xf1, 0x0, 0x3e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x4f, 0xff,
+    0xff, 0x10, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x84, 0xff, 0xff, 0xf1, 0x5f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x4f,
+    0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x4f, 0xff, 0xff, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xff,
+    0xff, 0xf2, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x4f, 0xff, 0xff, 0x10, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84,
+    0xff, 0xff, 0xf1, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x4f, 0xff, 0xff, 0x10,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x84, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x4f, 0xff, 0xff,
+    0x10, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x84, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x4f, 0xff,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff,
+    0xff, 0xff, 0x84, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xf8, 0x4f,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1d,
+    0xff, 0xff, 0xff, 0x84, 0xff, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xf7,
+    0x4f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xff, 0x63, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xc0, 0x3, 0x44, 0x42, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0x40, 0x0,
+
+    /* U+F04B "" */
+    0x0, 0x13, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xd4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x30, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xfe,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8b,
+    0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F04C "" */
+    0x4, 0xcf, 0xff, 0xff, 0xff, 0xfd, 0x60, 0x0,
+    0x0, 0x0, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xd6,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x10, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x30, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x40, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x40, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x40, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x40, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x40, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x40, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x40, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x40, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x40, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x40, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x40, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x40, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x40, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0xe,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
+    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x10, 0x0, 0x24, 0x44, 0x44, 0x44, 0x43, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x44, 0x44, 0x44, 0x44,
+    0x30, 0x0,
+
+    /* U+F04D "" */
+    0x4, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
+    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x10, 0x0, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x30, 0x0,
+
+    /* U+F051 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xe6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xe3, 0x2f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0xff, 0x65, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xf6, 0x5f, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x65, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xf6, 0x5f, 0xff, 0xff, 0xff, 0xfc,
+    0x10, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x65,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xf6, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x20, 0x0, 0x0, 0xe, 0xff, 0xff,
+    0x65, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x30,
+    0x0, 0x0, 0xef, 0xff, 0xf6, 0x5f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0xe, 0xff,
+    0xff, 0x65, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0xef, 0xff, 0xf6, 0x5f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0xe,
+    0xff, 0xff, 0x65, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0xef, 0xff, 0xf6, 0x5f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x9e, 0xff, 0xff, 0x65, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x65, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf6, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x65, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf6, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x65, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
+    0xef, 0xff, 0xf6, 0x5f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb0, 0xe, 0xff, 0xff, 0x65,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
+    0x0, 0xef, 0xff, 0xf6, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x90, 0x0, 0xe, 0xff, 0xff,
+    0x65, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0xef, 0xff, 0xf6, 0x5f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0xe, 0xff,
+    0xff, 0x65, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xf6, 0x5f, 0xff,
+    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xff, 0x65, 0xff, 0xff, 0xff, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf6, 0x5f,
+    0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0x65, 0xff, 0xff, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf6,
+    0x3f, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0xff, 0x60, 0xaf, 0xfc, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xf5, 0x0, 0x34, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x44, 0x44, 0x0,
+
+    /* U+F052 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xbe, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x1e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
+    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf3, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x20, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x0,
+    0x0, 0x46, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe5, 0x0, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf4, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfb, 0x0, 0x3, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x75, 0x0,
+
+    /* U+F053 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xfd,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xd1,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
+    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xdf, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xdf, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0xe6, 0x0,
+
+    /* U+F054 "" */
+    0x0, 0x26, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9e, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+F067 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9d,
+    0xed, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xcd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xff, 0xff, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xca, 0x20, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf3, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf2, 0x5f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0x1, 0x45, 0x55, 0x55,
+    0x55, 0x55, 0x5f, 0xff, 0xff, 0xff, 0x75, 0x55,
+    0x55, 0x55, 0x55, 0x42, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x25, 0x65, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+F068 "" */
+    0x2b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x40, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf3, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x3e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x0,
+
+    /* U+F06E "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x45, 0x77, 0x65, 0x41, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0xa5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xfc, 0x73,
+    0x21, 0x24, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf,
+    0xff, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xef, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
+    0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x14, 0x54, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xa1, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0xd1,
+    0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xe3, 0x0,
+    0x5, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0xcf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0xe2, 0x0, 0xc, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xff, 0xff, 0xb0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0x30, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xff,
+    0x10, 0x2, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xa,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x9, 0xa7,
+    0x9e, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb0, 0x0, 0xbf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x70, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf6, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf9,
+    0x6f, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x1,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0x10, 0x3, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe0, 0x0, 0x5f, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0xf5, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf6, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0xd, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0xb, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0xff, 0xff, 0x20, 0x0, 0x3, 0x9c, 0xdc, 0x82,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xfd,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xff, 0xff, 0xb4, 0x0, 0x0, 0x0,
+    0x15, 0xdf, 0xff, 0xff, 0xff, 0xd2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xba, 0x9a, 0xcf, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x9e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x71, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0x7a, 0xce, 0xff, 0xed, 0xc9, 0x62,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F070 "" */
+    0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x25, 0x67, 0x76, 0x42, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x38, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x72,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xdf, 0xff, 0xff, 0xfb, 0x11, 0x8e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xb5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xa6, 0x31, 0x23, 0x7b, 0xff, 0xff,
+    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0x81, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xff,
+    0xff, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0x35, 0x42, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
+    0xff, 0xf8, 0x0, 0xcf, 0xff, 0xd4, 0x0, 0x0,
+    0x9f, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x2c, 0xff,
+    0xff, 0xff, 0xb1, 0x8f, 0xff, 0xff, 0x80, 0x0,
+    0xe, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0x80, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xf7, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x6,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
+    0x1, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
+    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xc0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xe4,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
+    0x74, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef,
+    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xff, 0xff,
+    0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xff,
+    0xff, 0xe7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0xa9, 0xab, 0x20, 0x0, 0x0,
+    0x4, 0xef, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x2c, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x59, 0xcd, 0xef, 0xfe, 0xca, 0x72, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xa7, 0x0,
+
+    /* U+F071 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
+    0x40, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0xcf, 0xff, 0xff,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe5, 0x55, 0x57, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfa, 0x20, 0x3c, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x10, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x5f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfa, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfa, 0x21, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x40, 0xe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xb0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x0,
+    0x3b, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xd9, 0x10, 0x0,
+
+    /* U+F074 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xf5, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf3, 0xbe, 0xee, 0xee, 0xef, 0xff, 0xff, 0xff,
+    0xa0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xee, 0xff,
+    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xff, 0x60, 0x5, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0x8f, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf7, 0x0, 0x4f,
+    0xff, 0xff, 0xff, 0xa0, 0x0, 0x8f, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0x90, 0x3, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x7f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8a, 0x0, 0x2e, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x5f, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x6, 0x93,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0xff, 0xe2, 0x0, 0x10, 0x0, 0x0, 0x9,
+    0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xff, 0xff, 0xff, 0x30, 0x9, 0xe1,
+    0x0, 0x0, 0x6f, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xf4,
+    0x0, 0x8f, 0xfd, 0x10, 0x0, 0x8f, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xff, 0x50, 0x6, 0xff, 0xff, 0xc0, 0x0,
+    0x8f, 0xff, 0xff, 0x60, 0x0, 0x1, 0x11, 0x11,
+    0x18, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x4f, 0xff,
+    0xff, 0xfb, 0x11, 0x8f, 0xff, 0xff, 0xf6, 0x0,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xad,
+    0xdd, 0xdd, 0xdd, 0xdb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xdd, 0xdd, 0xef, 0xff, 0xff,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xfe, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0x82, 0x0, 0x0,
+    0x0,
+
+    /* U+F077 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff,
+    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xb0, 0x7f, 0xff, 0xff,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xd1, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xd1,
+    0x6f, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xa7, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xfb, 0x1d, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0x30, 0x1d, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0x30, 0x0, 0x17, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x58, 0x20, 0x0,
+
+    /* U+F078 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xf9,
+    0x0, 0x6, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0xfa, 0x4, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0xff, 0xff, 0xc2, 0xff, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0xff, 0xff, 0xf5, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x3, 0xff, 0xff, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x1d, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x1d, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xff, 0x40, 0x1d, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x94, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+F079 "" */
+    0x0, 0x0, 0x0, 0x0, 0x59, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x60,
+    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x60, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf6, 0x0, 0x6a, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbe, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xef, 0xff, 0xfe, 0xef, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xfe, 0x2e, 0xff, 0xfd, 0x3f, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xf3, 0xe, 0xff, 0xfd, 0x4, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0x40, 0xe, 0xff, 0xfd, 0x0, 0x5f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x10, 0x0, 0xe, 0xff, 0xfd, 0x0, 0x0,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x56,
+    0x0, 0xa, 0xff, 0xff, 0x10, 0x3, 0x72, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xc0, 0xa, 0xff, 0xff, 0x10, 0x6f, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xfb, 0xa, 0xff, 0xff, 0x15, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xba, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x1, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x1c,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x1,
+    0xcf, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
+    0xc, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xab, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb9, 0x10, 0x0,
+    0x0, 0xcf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x10, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F07B "" */
+    0x0, 0x57, 0x88, 0x88, 0x88, 0x88, 0x88, 0x85,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xb9, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe2, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf5, 0x5, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50,
+
+    /* U+F093 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xe2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x11, 0x11, 0x11, 0xef, 0xff, 0xff, 0xff,
+    0xf9, 0x11, 0x11, 0x11, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
+    0xef, 0xff, 0xff, 0xff, 0xf9, 0x0, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xf4,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x5, 0x66,
+    0x66, 0x66, 0x30, 0x5, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x73, 0x22, 0x22, 0x22,
+    0x37, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x20, 0x8f, 0xd0, 0xc, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x4f,
+    0xa0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x72, 0xcf, 0xf4, 0x4e, 0xff, 0xff, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe5,
+
+    /* U+F095 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0xc9, 0x51, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0xfd, 0xa6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x28, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2e,
+    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xbf, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xff, 0xff,
+    0xff, 0xfe, 0x20, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x18,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x3,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x95, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xbb,
+    0xa9, 0x86, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+F0C4 "" */
+    0x0, 0x0, 0x6a, 0xdd, 0xb7, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x59, 0xa9,
+    0x50, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xff, 0xfe, 0x30, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0xcf, 0xff, 0xf9,
+    0x0, 0x6f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xff, 0xff,
+    0xe0, 0x0, 0xa, 0xff, 0xff, 0x20, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xff,
+    0xff, 0xd0, 0x0, 0x9, 0xff, 0xff, 0x30, 0x0,
+    0x5, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0xdf, 0xff, 0xf5, 0x0, 0x2e, 0xff, 0xff, 0x10,
+    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xba, 0xff, 0xff, 0xfd,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x11, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6a, 0xdd, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x10, 0xa,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xf9, 0x0, 0x6f, 0xff, 0xff, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0xff, 0xff, 0xe0, 0x0, 0xa, 0xff, 0xff,
+    0x20, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x9, 0xff,
+    0xff, 0x30, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0xdf, 0xff, 0xf5, 0x0, 0x2e,
+    0xff, 0xff, 0x10, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x9f, 0xff, 0xff, 0xba,
+    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0x90, 0x2f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x6, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x7f, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x9d, 0xfe, 0xa3, 0x0,
+    0x0, 0x3, 0xaf, 0xff, 0xfc, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+F0C5 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x0, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xed, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xef,
+    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
+    0xef, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0xef, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x0, 0xef, 0xff, 0xfd, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x0, 0xef, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0xef, 0xff, 0xff, 0xf2,
+    0x6f, 0xff, 0xff, 0xf2, 0x5, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xf2, 0x5, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xf2, 0x5, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xf2, 0x5,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xf2,
+    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff,
+    0xf2, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
+    0xff, 0xf2, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff,
+    0xff, 0xff, 0xf2, 0x5, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
+    0xff, 0xff, 0xff, 0xf2, 0x5, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf3, 0xff, 0xff, 0xff, 0xf2, 0x5, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf3, 0xff, 0xff, 0xff, 0xf2, 0x5, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xf2, 0x5,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xf2,
+    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff,
+    0xf2, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
+    0xff, 0xf2, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff,
+    0xff, 0xff, 0xf2, 0x5, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
+    0xff, 0xff, 0xff, 0xf2, 0x5, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf3, 0xff, 0xff, 0xff, 0xf2, 0x5, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf3, 0xff, 0xff, 0xff, 0xf2, 0x5, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xf2, 0x5,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xf2,
+    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff,
+    0xf2, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
+    0xff, 0xf3, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff,
+    0xff, 0xff, 0xf7, 0x0, 0x26, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x10,
+    0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F0C7 "" */
+    0x2, 0x9c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xa3, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x60, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf7, 0x0, 0x0, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0x70, 0x0, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0xf7, 0x0, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
+    0xf2, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0xff, 0xf6, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff,
+    0xfc, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x83, 0x12, 0x6d, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x10, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x9a, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x6f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0x10, 0x0, 0x2, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x10, 0x0,
+
+    /* U+F0C9 "" */
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf4, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf2, 0x26, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd1, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf2, 0x26, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf4, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf2, 0x14, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x20,
+
+    /* U+F0E0 "" */
+    0x0, 0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x41, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x8f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0x1b, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x4, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x40, 0x1, 0xc4, 0x0,
+    0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0,
+    0x7f, 0xff, 0x90, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf7, 0x0, 0x1b, 0xff, 0xff, 0xfc, 0x20, 0x3,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x30, 0x4, 0xef, 0xff, 0xff,
+    0xff, 0xf6, 0x0, 0x1a, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x6f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x0, 0x2c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x40, 0x2, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x20, 0x5, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x9, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc2, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xf5, 0x0,
+    0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x50, 0x2, 0xcf, 0xff,
+    0xfc, 0x20, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
+    0x0, 0x4, 0xaa, 0x40, 0x0, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x4d,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5,
+    0x33, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf5, 0x5, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50,
+
+    /* U+F0E7 "" */
+    0x0, 0x0, 0x13, 0x44, 0x44, 0x44, 0x44, 0x43,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb6, 0x66, 0x66, 0x66, 0x53,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x4, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb0, 0x6, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
+    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x0, 0xa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf4, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0xe,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x20, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x12,
+    0x22, 0x22, 0x22, 0x28, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2a, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+F0EA "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xef, 0xfd,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3b, 0xcc, 0xcc, 0xcc, 0xff,
+    0xfe, 0xef, 0xff, 0xcc, 0xcc, 0xcc, 0xa2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0xb, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x20, 0x5, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x90, 0x1b, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x0, 0x2, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x0, 0x20, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xf9, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x0, 0xed, 0x10, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x0, 0xef, 0xd1, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x1, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0xef, 0xfd, 0x10, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x1, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0xef, 0xff, 0xd1,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xef, 0xff,
+    0xfd, 0x10, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xef,
+    0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
+    0xef, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x1, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x1, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x1, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf3, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xff,
+    0xff, 0xff, 0xf8, 0x1, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x17,
+    0x88, 0x88, 0x88, 0x84, 0x1, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3a, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x40,
+
+    /* U+F0F3 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x9e, 0xff, 0xff, 0xff, 0xb5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf6, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x50, 0xbf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xbf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xa,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x39, 0xba, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F11C "" */
+    0x1, 0x8b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xba, 0x60, 0x2, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc0, 0xbf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xcf, 0xff, 0xfe, 0x10, 0x1,
+    0xaf, 0xf2, 0x0, 0x9, 0xff, 0x40, 0x0, 0x7f,
+    0xf5, 0x0, 0x5, 0xff, 0x70, 0x0, 0x4f, 0xff,
+    0xfc, 0xff, 0xff, 0xc0, 0x0, 0x7, 0xfe, 0x0,
+    0x0, 0x6f, 0xf0, 0x0, 0x4, 0xff, 0x20, 0x0,
+    0x2f, 0xf4, 0x0, 0x0, 0xff, 0xff, 0xcf, 0xff,
+    0xfc, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x6, 0xff,
+    0x0, 0x0, 0x4f, 0xf2, 0x0, 0x2, 0xff, 0x40,
+    0x0, 0xf, 0xff, 0xfc, 0xff, 0xff, 0xc0, 0x0,
+    0x7, 0xfe, 0x0, 0x0, 0x6f, 0xf0, 0x0, 0x4,
+    0xff, 0x20, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0xff,
+    0xff, 0xcf, 0xff, 0xfe, 0x10, 0x0, 0xaf, 0xf2,
+    0x0, 0x9, 0xff, 0x30, 0x0, 0x7f, 0xf5, 0x0,
+    0x5, 0xff, 0x70, 0x0, 0x3f, 0xff, 0xfc, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x66,
+    0x8f, 0xfd, 0x66, 0x68, 0xff, 0xd6, 0x66, 0x7f,
+    0xfd, 0x66, 0x66, 0xef, 0xff, 0xff, 0xff, 0xcf,
+    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0xff, 0x70,
+    0x0, 0xe, 0xf7, 0x0, 0x0, 0xef, 0x70, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
+    0xff, 0x50, 0x0, 0xf, 0xf7, 0x0, 0x0, 0xef,
+    0x70, 0x0, 0xe, 0xf7, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0xff, 0x70, 0x0, 0xe, 0xf7, 0x0, 0x0,
+    0xef, 0x70, 0x0, 0x9, 0xff, 0xff, 0xff, 0xfc,
+    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x1f, 0xf9,
+    0x0, 0x1, 0xff, 0x90, 0x0, 0x1f, 0xf9, 0x0,
+    0x0, 0xbf, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xcf, 0xff, 0xff, 0x76, 0x67, 0xdf, 0xf8, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6a,
+    0xff, 0xb6, 0x66, 0x9f, 0xff, 0xfc, 0xff, 0xff,
+    0xc0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0,
+    0x0, 0xff, 0xff, 0xcf, 0xff, 0xfc, 0x0, 0x0,
+    0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0xf, 0xff,
+    0xfc, 0xff, 0xff, 0xc0, 0x0, 0x7, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xf4, 0x0, 0x0, 0xff, 0xff, 0xcf, 0xff,
+    0xfd, 0x0, 0x0, 0x8f, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x50,
+    0x0, 0x1f, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0xcc,
+    0xcf, 0xff, 0xdc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xef, 0xff, 0xcc, 0xce, 0xff,
+    0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x95, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe1, 0x5, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x0,
+
+    /* U+F124 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c,
+    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x7e, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xbf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xab, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+F15B "" */
+    0x6, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x40, 0x6, 0x10, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
+    0xfe, 0x30, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xf, 0xfe,
+    0x30, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x0, 0xff, 0xfe, 0x30,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xa0, 0xf, 0xff, 0xfe, 0x30, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfa, 0x0, 0xff, 0xff, 0xfe, 0x30, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
+    0xf, 0xff, 0xff, 0xfe, 0x30, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0xff,
+    0xff, 0xff, 0xfe, 0x30, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xa0, 0xf, 0xff, 0xff,
+    0xff, 0xfe, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x32,
+    0x22, 0x22, 0x22, 0x22, 0x1f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x5e,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
+
+    /* U+F1EB "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x25, 0x8a, 0xcd, 0xee, 0xed, 0xcb, 0x96, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xae,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc7, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4a, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5c, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x81, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x0,
+    0x0, 0x5, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfb, 0x86, 0x42, 0x11, 0x12, 0x35, 0x79, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x0,
+    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x83,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0,
+    0xa, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x18, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40,
+    0xcf, 0xff, 0xff, 0xff, 0xfd, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x19, 0xff, 0xff, 0xff, 0xff, 0xf4,
+    0xdf, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2c, 0xff, 0xff, 0xff, 0xf5,
+    0x2e, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x90,
+    0x2, 0xef, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x69, 0xce, 0xff, 0xfe, 0xdb, 0x84, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf9, 0x0,
+    0x0, 0x2c, 0x70, 0x0, 0x0, 0x0, 0x0, 0x18,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x2c, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xc8, 0x42, 0x0, 0x1, 0x26, 0xae, 0xff,
+    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xb1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfc, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xff, 0xff, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2c, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x35, 0x41, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F240 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0xff, 0xff, 0xeb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xdf, 0xff, 0xf8, 0x20,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf5,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x37, 0x7f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x1f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x1f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x1f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x1f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x5c, 0xdf, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0x7, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf9,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc2,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
+    0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
+    0x1, 0x8b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x93, 0x0, 0x0,
+
+    /* U+F241 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0xff, 0xff, 0xeb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xdf, 0xff, 0xf8, 0x20,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf5,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x37, 0x7f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x5c, 0xdf, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0x7, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf9,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc2,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
+    0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
+    0x1, 0x8b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x93, 0x0, 0x0,
+
+    /* U+F242 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0xff, 0xff, 0xeb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xdf, 0xff, 0xf8, 0x20,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf5,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x37, 0x7f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5c, 0xdf, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0x7, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x85, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf9,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc2,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
+    0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
+    0x1, 0x8b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x93, 0x0, 0x0,
+
+    /* U+F243 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0xff, 0xff, 0xeb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xdf, 0xff, 0xf8, 0x20,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf5,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x37, 0x7f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5c, 0xdf, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0xe, 0xff, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0x7, 0x88, 0x88, 0x88, 0x88,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf9,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc2,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
+    0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
+    0x1, 0x8b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x93, 0x0, 0x0,
+
+    /* U+F244 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0xff, 0xff, 0xeb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xdf, 0xff, 0xf8, 0x20,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf5,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x37, 0x7f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5c, 0xdf, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf9,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc2,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
+    0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
+    0x1, 0x8b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x93, 0x0, 0x0,
+
+    /* U+F287 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x8b, 0xb4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x22, 0xcf, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xf9, 0x88, 0xef, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0x40, 0x0, 0x5f, 0xff, 0xff, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xf9, 0x0, 0x0, 0x5, 0xef, 0xfb, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xf1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0x78, 0x61, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0xff, 0x60, 0x0, 0x0, 0xc,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xd4, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x4f,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xb2, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1, 0xef,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x70, 0x0,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xb9, 0x9e, 0xff,
+    0xea, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xac, 0xff, 0xff, 0xfd, 0x40,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x3e, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xe6, 0x0,
+    0x3f, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xf9, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xfc, 0x20, 0x0, 0x0,
+    0x0, 0x2a, 0xef, 0xd7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xb0, 0x0, 0xa, 0xdd,
+    0xdd, 0xdd, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xf4, 0x0, 0xe, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xfe, 0x53, 0x3e, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x56, 0x6f, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11,
+    0x11, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F293 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0x8c, 0xff, 0xff, 0xff,
+    0xd9, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xbf, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
+    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
+    0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xd1, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0xff, 0xfe, 0x4, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x4, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x20, 0x0,
+    0x9f, 0xff, 0xff, 0xff, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0x7f, 0xff, 0xfe, 0x0, 0x5c, 0x0, 0xa,
+    0xff, 0xff, 0xff, 0x40, 0xc, 0xff, 0xff, 0xe3,
+    0x5, 0xff, 0xfe, 0x0, 0x4f, 0xc1, 0x0, 0xbf,
+    0xff, 0xff, 0x70, 0xf, 0xff, 0xff, 0xb0, 0x0,
+    0x4f, 0xfe, 0x0, 0x4f, 0xfa, 0x0, 0x1f, 0xff,
+    0xff, 0x90, 0x1f, 0xff, 0xff, 0xfb, 0x0, 0x4,
+    0xfe, 0x0, 0x4f, 0xd1, 0x0, 0xaf, 0xff, 0xff,
+    0xc0, 0x3f, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x4e,
+    0x0, 0x4d, 0x10, 0x8, 0xff, 0xff, 0xff, 0xd0,
+    0x4f, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x3, 0x0,
+    0x21, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xe0, 0x5f,
+    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x6f, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x6f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xa0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0x6f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xd1, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0x6f, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x10, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xd1,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0x5f, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x1,
+    0x0, 0x10, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xf0,
+    0x3f, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x2d, 0x0,
+    0x4b, 0x0, 0x8, 0xff, 0xff, 0xff, 0xe0, 0x1f,
+    0xff, 0xff, 0xfd, 0x10, 0x2, 0xef, 0x0, 0x4f,
+    0xa0, 0x0, 0x9f, 0xff, 0xff, 0xc0, 0xf, 0xff,
+    0xff, 0xd1, 0x0, 0x2e, 0xff, 0x0, 0x4f, 0xf9,
+    0x0, 0xc, 0xff, 0xff, 0xa0, 0xc, 0xff, 0xff,
+    0xd1, 0x2, 0xef, 0xff, 0x0, 0x4f, 0xe2, 0x0,
+    0x5f, 0xff, 0xff, 0x80, 0x9, 0xff, 0xff, 0xfd,
+    0x4e, 0xff, 0xff, 0x0, 0x5e, 0x20, 0x5, 0xff,
+    0xff, 0xff, 0x50, 0x5, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x32, 0x0, 0x5f, 0xff, 0xff,
+    0xff, 0x10, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x4f,
+    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xff, 0xff, 0xff, 0x4, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x1c,
+    0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x48,
+    0xab, 0xcd, 0xdc, 0xa7, 0x30, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+F2ED "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x22,
+    0x22, 0x22, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8c, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xa0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7c, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xa0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0x90, 0x9f, 0xff, 0xfb, 0x7,
+    0xff, 0xff, 0xc1, 0x5f, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0x50, 0x5f, 0xff, 0xf7,
+    0x3, 0xff, 0xff, 0x90, 0x1f, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0x50, 0x5f, 0xff,
+    0xf7, 0x3, 0xff, 0xff, 0x90, 0x1f, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x50, 0x5f,
+    0xff, 0xf7, 0x3, 0xff, 0xff, 0x90, 0x1f, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x50,
+    0x5f, 0xff, 0xf7, 0x3, 0xff, 0xff, 0x90, 0x1f,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0xaf, 0xff, 0xff,
+    0x50, 0x5f, 0xff, 0xf7, 0x3, 0xff, 0xff, 0x90,
+    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0x50, 0x5f, 0xff, 0xf7, 0x3, 0xff, 0xff,
+    0x90, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0x50, 0x5f, 0xff, 0xf7, 0x3, 0xff,
+    0xff, 0x90, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0x50, 0x5f, 0xff, 0xf7, 0x3,
+    0xff, 0xff, 0x90, 0x1f, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0x50, 0x5f, 0xff, 0xf7,
+    0x3, 0xff, 0xff, 0x90, 0x1f, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0x50, 0x5f, 0xff,
+    0xf7, 0x3, 0xff, 0xff, 0x90, 0x1f, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x50, 0x5f,
+    0xff, 0xf7, 0x3, 0xff, 0xff, 0x90, 0x1f, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x50,
+    0x5f, 0xff, 0xf7, 0x3, 0xff, 0xff, 0x90, 0x1f,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0xaf, 0xff, 0xff,
+    0x50, 0x5f, 0xff, 0xf7, 0x3, 0xff, 0xff, 0x90,
+    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0x50, 0x5f, 0xff, 0xf7, 0x3, 0xff, 0xff,
+    0x90, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0x50, 0x5f, 0xff, 0xf7, 0x3, 0xff,
+    0xff, 0x90, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0x50, 0x5f, 0xff, 0xf7, 0x3,
+    0xff, 0xff, 0x90, 0x1f, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0x50, 0x5f, 0xff, 0xf7,
+    0x3, 0xff, 0xff, 0x90, 0x1f, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0x90, 0x9f, 0xff,
+    0xfb, 0x7, 0xff, 0xff, 0xc1, 0x5f, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xd0, 0x0, 0x0, 0x5f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x7b, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcb, 0x81, 0x0, 0x0,
+
+    /* U+F304 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x33,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xef, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x4f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf7,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xf7, 0x0, 0x4f, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf7,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xff, 0xf7, 0x0, 0x4f, 0xff, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0x0, 0x4f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf7, 0x0, 0x4f, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf7, 0x0, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xab, 0x97,
+    0x53, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+F55A "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x67,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x76, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x6f, 0xff, 0xff, 0xff,
+    0x60, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x6, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x30, 0x0, 0x0, 0x6f, 0xff, 0x60,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xd1, 0x0, 0x0, 0x6, 0xf6, 0x0,
+    0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0,
+    0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x0, 0x1, 0xa1, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x1d, 0xfd, 0x10,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x30, 0x0, 0x1, 0xdf, 0xff, 0xd1,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe2, 0x0, 0x1d, 0xff, 0xff, 0xfd,
+    0x10, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x21, 0xdf, 0xff, 0xff, 0xff,
+    0xd1, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xa2, 0x0,
+
+    /* U+F7C2 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf1, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x70, 0x0, 0x2, 0xef, 0xfc, 0xbb, 0xbf, 0xfc,
+    0xbb, 0xcf, 0xfc, 0xbb, 0xbf, 0xff, 0xfa, 0x0,
+    0x2, 0xef, 0xff, 0x50, 0x2, 0xff, 0x40, 0x3,
+    0xff, 0x30, 0x1, 0xff, 0xff, 0xa0, 0x2, 0xef,
+    0xff, 0xf5, 0x0, 0x2f, 0xf4, 0x0, 0x3f, 0xf3,
+    0x0, 0x1f, 0xff, 0xfa, 0x2, 0xef, 0xff, 0xff,
+    0x50, 0x2, 0xff, 0x40, 0x3, 0xff, 0x30, 0x1,
+    0xff, 0xff, 0xa2, 0xef, 0xff, 0xff, 0xf5, 0x0,
+    0x2f, 0xf4, 0x0, 0x3f, 0xf3, 0x0, 0x1f, 0xff,
+    0xfa, 0xef, 0xff, 0xff, 0xff, 0x50, 0x2, 0xff,
+    0x40, 0x3, 0xff, 0x30, 0x1, 0xff, 0xff, 0xaf,
+    0xff, 0xff, 0xff, 0xf5, 0x0, 0x2f, 0xf4, 0x0,
+    0x3f, 0xf3, 0x0, 0x1f, 0xff, 0xfa, 0xff, 0xff,
+    0xff, 0xff, 0x62, 0x24, 0xff, 0x62, 0x25, 0xff,
+    0x52, 0x23, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xac, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf7, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x10, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
+    0x5c, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xea, 0x20, 0x0,
+
+    /* U+F8A2 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x10,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xff, 0xf1, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x10, 0x0,
+    0x9f, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0xff, 0xf1, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xff, 0xff, 0xff, 0x10, 0xbf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x1d, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
+    0x6f, 0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x40, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1a, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 164, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 163, .box_w = 6, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 78, .adv_w = 238, .box_w = 11, .box_h = 11, .ofs_x = 2, .ofs_y = 15},
+    {.bitmap_index = 139, .adv_w = 427, .box_w = 25, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 464, .adv_w = 378, .box_w = 22, .box_h = 36, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 860, .adv_w = 513, .box_w = 30, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1250, .adv_w = 417, .box_w = 25, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1588, .adv_w = 128, .box_w = 4, .box_h = 11, .ofs_x = 2, .ofs_y = 15},
+    {.bitmap_index = 1610, .adv_w = 205, .box_w = 9, .box_h = 35, .ofs_x = 3, .ofs_y = -7},
+    {.bitmap_index = 1768, .adv_w = 206, .box_w = 9, .box_h = 35, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 1926, .adv_w = 243, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = 14},
+    {.bitmap_index = 2031, .adv_w = 354, .box_w = 18, .box_h = 17, .ofs_x = 2, .ofs_y = 5},
+    {.bitmap_index = 2184, .adv_w = 138, .box_w = 6, .box_h = 11, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 2217, .adv_w = 233, .box_w = 11, .box_h = 4, .ofs_x = 2, .ofs_y = 9},
+    {.bitmap_index = 2239, .adv_w = 138, .box_w = 6, .box_h = 6, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2257, .adv_w = 214, .box_w = 17, .box_h = 35, .ofs_x = -2, .ofs_y = -4},
+    {.bitmap_index = 2555, .adv_w = 406, .box_w = 23, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2854, .adv_w = 225, .box_w = 11, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2997, .adv_w = 349, .box_w = 21, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3270, .adv_w = 348, .box_w = 21, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3543, .adv_w = 407, .box_w = 24, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3855, .adv_w = 349, .box_w = 21, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4128, .adv_w = 375, .box_w = 22, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4414, .adv_w = 364, .box_w = 21, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4687, .adv_w = 392, .box_w = 22, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4973, .adv_w = 375, .box_w = 21, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5246, .adv_w = 138, .box_w = 6, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5306, .adv_w = 138, .box_w = 6, .box_h = 26, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 5384, .adv_w = 354, .box_w = 18, .box_h = 18, .ofs_x = 2, .ofs_y = 4},
+    {.bitmap_index = 5546, .adv_w = 354, .box_w = 18, .box_h = 12, .ofs_x = 2, .ofs_y = 7},
+    {.bitmap_index = 5654, .adv_w = 354, .box_w = 18, .box_h = 18, .ofs_x = 2, .ofs_y = 4},
+    {.bitmap_index = 5816, .adv_w = 348, .box_w = 20, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6076, .adv_w = 629, .box_w = 37, .box_h = 33, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 6687, .adv_w = 445, .box_w = 29, .box_h = 26, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7064, .adv_w = 460, .box_w = 24, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 7376, .adv_w = 440, .box_w = 26, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7714, .adv_w = 502, .box_w = 27, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 8065, .adv_w = 407, .box_w = 21, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 8338, .adv_w = 386, .box_w = 20, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 8598, .adv_w = 469, .box_w = 26, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8936, .adv_w = 494, .box_w = 24, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 9248, .adv_w = 188, .box_w = 5, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 9313, .adv_w = 312, .box_w = 17, .box_h = 26, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 9534, .adv_w = 437, .box_w = 25, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 9859, .adv_w = 361, .box_w = 20, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 10119, .adv_w = 581, .box_w = 30, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 10509, .adv_w = 494, .box_w = 24, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 10821, .adv_w = 511, .box_w = 30, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11211, .adv_w = 439, .box_w = 23, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 11510, .adv_w = 511, .box_w = 31, .box_h = 31, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 11991, .adv_w = 442, .box_w = 23, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 12290, .adv_w = 378, .box_w = 22, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12576, .adv_w = 357, .box_w = 23, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12875, .adv_w = 481, .box_w = 24, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 13187, .adv_w = 433, .box_w = 29, .box_h = 26, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 13564, .adv_w = 685, .box_w = 41, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 14097, .adv_w = 409, .box_w = 26, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14435, .adv_w = 393, .box_w = 26, .box_h = 26, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 14773, .adv_w = 399, .box_w = 23, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15072, .adv_w = 202, .box_w = 9, .box_h = 35, .ofs_x = 3, .ofs_y = -7},
+    {.bitmap_index = 15230, .adv_w = 214, .box_w = 17, .box_h = 35, .ofs_x = -2, .ofs_y = -4},
+    {.bitmap_index = 15528, .adv_w = 202, .box_w = 9, .box_h = 35, .ofs_x = 0, .ofs_y = -7},
+    {.bitmap_index = 15686, .adv_w = 354, .box_w = 18, .box_h = 16, .ofs_x = 2, .ofs_y = 5},
+    {.bitmap_index = 15830, .adv_w = 304, .box_w = 19, .box_h = 3, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 15859, .adv_w = 365, .box_w = 11, .box_h = 5, .ofs_x = 4, .ofs_y = 23},
+    {.bitmap_index = 15887, .adv_w = 364, .box_w = 19, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16077, .adv_w = 415, .box_w = 22, .box_h = 28, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 16385, .adv_w = 347, .box_w = 20, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16585, .adv_w = 415, .box_w = 22, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16893, .adv_w = 372, .box_w = 21, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 17103, .adv_w = 215, .box_w = 15, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17313, .adv_w = 420, .box_w = 22, .box_h = 27, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 17610, .adv_w = 414, .box_w = 20, .box_h = 28, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 17890, .adv_w = 170, .box_w = 6, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 17977, .adv_w = 173, .box_w = 12, .box_h = 36, .ofs_x = -4, .ofs_y = -7},
+    {.bitmap_index = 18193, .adv_w = 375, .box_w = 21, .box_h = 28, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 18487, .adv_w = 170, .box_w = 5, .box_h = 28, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 18557, .adv_w = 643, .box_w = 34, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 18897, .adv_w = 414, .box_w = 20, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 19097, .adv_w = 386, .box_w = 22, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 19317, .adv_w = 415, .box_w = 22, .box_h = 27, .ofs_x = 3, .ofs_y = -7},
+    {.bitmap_index = 19614, .adv_w = 415, .box_w = 22, .box_h = 27, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 19911, .adv_w = 249, .box_w = 12, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 20031, .adv_w = 305, .box_w = 18, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20211, .adv_w = 252, .box_w = 15, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20399, .adv_w = 412, .box_w = 20, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 20599, .adv_w = 340, .box_w = 23, .box_h = 20, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 20829, .adv_w = 547, .box_w = 34, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21169, .adv_w = 336, .box_w = 21, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21379, .adv_w = 340, .box_w = 23, .box_h = 27, .ofs_x = -1, .ofs_y = -7},
+    {.bitmap_index = 21690, .adv_w = 317, .box_w = 18, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 21870, .adv_w = 213, .box_w = 11, .box_h = 35, .ofs_x = 2, .ofs_y = -7},
+    {.bitmap_index = 22063, .adv_w = 182, .box_w = 5, .box_h = 35, .ofs_x = 3, .ofs_y = -7},
+    {.bitmap_index = 22151, .adv_w = 213, .box_w = 12, .box_h = 35, .ofs_x = 0, .ofs_y = -7},
+    {.bitmap_index = 22361, .adv_w = 354, .box_w = 18, .box_h = 7, .ofs_x = 2, .ofs_y = 10},
+    {.bitmap_index = 22424, .adv_w = 255, .box_w = 14, .box_h = 12, .ofs_x = 1, .ofs_y = 14},
+    {.bitmap_index = 22508, .adv_w = 191, .box_w = 8, .box_h = 7, .ofs_x = 2, .ofs_y = 7},
+    {.bitmap_index = 22536, .adv_w = 608, .box_w = 39, .box_h = 39, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 23297, .adv_w = 608, .box_w = 38, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23848, .adv_w = 608, .box_w = 38, .box_h = 34, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 24494, .adv_w = 608, .box_w = 38, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25045, .adv_w = 418, .box_w = 27, .box_h = 27, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 25410, .adv_w = 608, .box_w = 38, .box_h = 39, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 26151, .adv_w = 608, .box_w = 36, .box_h = 39, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 26853, .adv_w = 684, .box_w = 43, .box_h = 34, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 27584, .adv_w = 608, .box_w = 38, .box_h = 39, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 28325, .adv_w = 684, .box_w = 43, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 28949, .adv_w = 608, .box_w = 38, .box_h = 39, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 29690, .adv_w = 304, .box_w = 19, .box_h = 30, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 29975, .adv_w = 456, .box_w = 29, .box_h = 30, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 30410, .adv_w = 684, .box_w = 43, .box_h = 37, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 31206, .adv_w = 608, .box_w = 38, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 31757, .adv_w = 418, .box_w = 27, .box_h = 39, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 32284, .adv_w = 532, .box_w = 25, .box_h = 35, .ofs_x = 4, .ofs_y = -3},
+    {.bitmap_index = 32722, .adv_w = 532, .box_w = 34, .box_h = 40, .ofs_x = 0, .ofs_y = -6},
+    {.bitmap_index = 33402, .adv_w = 532, .box_w = 34, .box_h = 34, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 33980, .adv_w = 532, .box_w = 34, .box_h = 34, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 34558, .adv_w = 532, .box_w = 25, .box_h = 35, .ofs_x = 4, .ofs_y = -3},
+    {.bitmap_index = 34996, .adv_w = 532, .box_w = 35, .box_h = 34, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 35591, .adv_w = 380, .box_w = 20, .box_h = 33, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 35921, .adv_w = 380, .box_w = 20, .box_h = 33, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 36251, .adv_w = 532, .box_w = 34, .box_h = 34, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 36829, .adv_w = 532, .box_w = 34, .box_h = 8, .ofs_x = 0, .ofs_y = 10},
+    {.bitmap_index = 36965, .adv_w = 684, .box_w = 43, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 37589, .adv_w = 760, .box_w = 48, .box_h = 39, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 38525, .adv_w = 684, .box_w = 45, .box_h = 39, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 39403, .adv_w = 608, .box_w = 38, .box_h = 35, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 40068, .adv_w = 532, .box_w = 33, .box_h = 21, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 40415, .adv_w = 532, .box_w = 33, .box_h = 21, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 40762, .adv_w = 760, .box_w = 48, .box_h = 30, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 41482, .adv_w = 608, .box_w = 38, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 42033, .adv_w = 608, .box_w = 38, .box_h = 39, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 42774, .adv_w = 608, .box_w = 39, .box_h = 39, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 43535, .adv_w = 532, .box_w = 34, .box_h = 34, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 44113, .adv_w = 532, .box_w = 34, .box_h = 39, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 44776, .adv_w = 532, .box_w = 34, .box_h = 34, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 45354, .adv_w = 532, .box_w = 34, .box_h = 30, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 45864, .adv_w = 608, .box_w = 38, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 46415, .adv_w = 380, .box_w = 26, .box_h = 39, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 46922, .adv_w = 532, .box_w = 34, .box_h = 39, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 47585, .adv_w = 532, .box_w = 34, .box_h = 39, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 48248, .adv_w = 684, .box_w = 43, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 48872, .adv_w = 608, .box_w = 40, .box_h = 39, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 49652, .adv_w = 456, .box_w = 29, .box_h = 39, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 50218, .adv_w = 760, .box_w = 48, .box_h = 35, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 51058, .adv_w = 760, .box_w = 48, .box_h = 25, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 51658, .adv_w = 760, .box_w = 48, .box_h = 25, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 52258, .adv_w = 760, .box_w = 48, .box_h = 25, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 52858, .adv_w = 760, .box_w = 48, .box_h = 25, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 53458, .adv_w = 760, .box_w = 48, .box_h = 25, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 54058, .adv_w = 760, .box_w = 48, .box_h = 30, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 54778, .adv_w = 532, .box_w = 30, .box_h = 39, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 55363, .adv_w = 532, .box_w = 34, .box_h = 39, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 56026, .adv_w = 608, .box_w = 39, .box_h = 39, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 56787, .adv_w = 760, .box_w = 48, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 57483, .adv_w = 456, .box_w = 29, .box_h = 39, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 58049, .adv_w = 612, .box_w = 39, .box_h = 25, .ofs_x = 0, .ofs_y = 2}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_1[] = {
+    0x0, 0x1f72, 0xef51, 0xef58, 0xef5b, 0xef5c, 0xef5d, 0xef61,
+    0xef63, 0xef65, 0xef69, 0xef6c, 0xef71, 0xef76, 0xef77, 0xef78,
+    0xef8e, 0xef93, 0xef98, 0xef9b, 0xef9c, 0xef9d, 0xefa1, 0xefa2,
+    0xefa3, 0xefa4, 0xefb7, 0xefb8, 0xefbe, 0xefc0, 0xefc1, 0xefc4,
+    0xefc7, 0xefc8, 0xefc9, 0xefcb, 0xefe3, 0xefe5, 0xf014, 0xf015,
+    0xf017, 0xf019, 0xf030, 0xf037, 0xf03a, 0xf043, 0xf06c, 0xf074,
+    0xf0ab, 0xf13b, 0xf190, 0xf191, 0xf192, 0xf193, 0xf194, 0xf1d7,
+    0xf1e3, 0xf23d, 0xf254, 0xf4aa, 0xf712, 0xf7f2
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 176, .range_length = 63475, .glyph_id_start = 96,
+        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 62, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5,
+    2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 0, 13, 14, 15, 16, 17,
+    18, 19, 12, 20, 20, 0, 0, 0,
+    21, 22, 23, 24, 25, 22, 26, 27,
+    28, 29, 29, 30, 31, 32, 29, 29,
+    22, 33, 34, 35, 3, 36, 30, 37,
+    37, 38, 39, 40, 41, 42, 43, 0,
+    44, 0, 45, 46, 47, 48, 49, 50,
+    51, 45, 52, 52, 53, 48, 45, 45,
+    46, 46, 54, 55, 56, 57, 51, 58,
+    58, 59, 58, 60, 41, 0, 0, 9,
+    61, 9, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5,
+    2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 12,
+    18, 19, 20, 21, 21, 0, 0, 0,
+    22, 23, 24, 25, 23, 25, 25, 25,
+    23, 25, 25, 26, 25, 25, 25, 25,
+    23, 25, 23, 25, 3, 27, 28, 29,
+    29, 30, 31, 32, 33, 34, 35, 0,
+    36, 0, 37, 38, 39, 39, 39, 0,
+    39, 38, 40, 41, 38, 38, 42, 42,
+    39, 42, 39, 42, 43, 44, 45, 46,
+    46, 47, 46, 48, 0, 0, 35, 9,
+    49, 9, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    0, 2, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 6, 0, 0, 0,
+    0, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 27, 0, 16, -13, 0, 0,
+    0, 0, -33, -36, 4, 29, 13, 10,
+    -24, 4, 30, 2, 26, 6, 19, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 36, 5, -4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 12, 0, -18, 0, 0, 0, 0,
+    0, -12, 10, 12, 0, 0, -6, 0,
+    -4, 6, 0, -6, 0, -6, -3, -12,
+    0, 0, 0, 0, -6, 0, 0, -8,
+    -9, 0, 0, -6, 0, -12, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -6,
+    -6, 0, -9, 0, -16, 0, -74, 0,
+    0, -12, 0, 12, 18, 1, 0, -12,
+    6, 6, 20, 12, -10, 12, 0, 0,
+    -35, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -16, -7, -30, 0, -24,
+    -4, 0, 0, 0, 0, 1, 24, 0,
+    -18, -5, -2, 2, 0, -10, 0, 0,
+    -4, -45, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -49, -5, 23,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -25, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 20,
+    0, 6, 0, 0, -12, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 23, 5,
+    2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -22, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4,
+    12, 6, 18, -6, 0, 0, 12, -6,
+    -20, -83, 4, 16, 12, 1, -8, 0,
+    22, 0, 19, 0, 19, 0, -57, 0,
+    -7, 18, 0, 20, -6, 12, 6, 0,
+    0, 2, -6, 0, 0, -10, 49, 0,
+    49, 0, 18, 0, 26, 8, 10, 18,
+    0, 0, 0, -22, 0, 0, 0, 0,
+    2, -4, 0, 4, -11, -8, -12, 4,
+    0, -6, 0, 0, 0, -24, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -40, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, -33, 0, -38, 0, 0, 0,
+    0, -4, 0, 60, -7, -8, 6, 6,
+    -5, 0, -8, 6, 0, 0, -32, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -59, 0, 6, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -38, 0, 36, 0, 0, -22, 0,
+    20, 0, -41, -59, -41, -12, 18, 0,
+    0, -41, 0, 7, -14, 0, -9, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 16, 18, -74, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 29, 0, 4, 0, 0, 0,
+    0, 0, 4, 4, -7, -12, 0, -2,
+    -2, -6, 0, 0, -4, 0, 0, 0,
+    -12, 0, -5, 0, -14, -12, 0, -15,
+    -20, -20, -12, 0, -12, 0, -12, 0,
+    0, 0, 0, -5, 0, 0, 6, 0,
+    4, -6, 0, 2, 0, 0, 0, 6,
+    -4, 0, 0, 0, -4, 6, 6, -2,
+    0, 0, 0, -12, 0, -2, 0, 0,
+    0, 0, 0, 2, 0, 8, -4, 0,
+    -7, 0, -10, 0, 0, -4, 0, 18,
+    0, 0, -6, 0, 0, 0, 0, 0,
+    -2, 2, -4, -4, 0, 0, -6, 0,
+    -6, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -3, 0, -6, -7, 0,
+    0, 0, 0, 0, 2, 0, 0, -4,
+    0, -6, -6, -6, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -4, 0, 0,
+    0, 0, -4, -8, 0, -9, 0, -18,
+    -4, -18, 12, 0, 0, -12, 6, 12,
+    16, 0, -15, -2, -7, 0, -2, -29,
+    6, -4, 4, -32, 6, 0, 0, 2,
+    -32, 0, -32, -5, -53, -4, 0, -30,
+    0, 12, 17, 0, 8, 0, 0, 0,
+    0, 1, 0, -11, -8, 0, -18, 0,
+    0, 0, -6, 0, 0, 0, -6, 0,
+    0, 0, 0, 0, -3, -3, 0, -3,
+    -8, 0, 0, 0, 0, 0, 0, 0,
+    -6, -6, 0, -4, -7, -5, 0, 0,
+    -6, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -5, -5, 0, -7,
+    0, -4, 0, -12, 6, 0, 0, -7,
+    3, 6, 6, 0, 0, 0, 0, 0,
+    0, -4, 0, 0, 0, 0, 0, 4,
+    0, 0, -6, 0, -6, -4, -7, 0,
+    0, 0, 0, 0, 0, 0, 5, 0,
+    -5, 0, 0, 0, 0, -7, -9, 0,
+    -12, 0, 18, -4, 2, -19, 0, 0,
+    16, -30, -32, -26, -12, 6, 0, -5,
+    -40, -11, 0, -11, 0, -12, 9, -11,
+    -39, 0, -16, 0, 0, 3, -2, 5,
+    -4, 0, 6, 1, -18, -23, 0, -30,
+    -15, -13, -15, -18, -7, -16, -1, -12,
+    -16, 4, 0, 2, 0, -6, 0, 0,
+    0, 4, 0, 6, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -6,
+    0, -3, 0, -2, -6, 0, -10, -13,
+    -13, -2, 0, -18, 0, 0, 0, 0,
+    0, 0, -5, 0, 0, 0, 0, 2,
+    -4, 0, 0, 0, 6, 0, 0, 0,
+    0, 0, 0, 0, 0, 29, 0, 0,
+    0, 0, 0, 0, 4, 0, 0, 0,
+    -6, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -11, 0, 6, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -4, 0, 0, 0,
+    -12, 0, 0, 0, 0, -30, -18, 0,
+    0, 0, -9, -30, 0, 0, -6, 6,
+    0, -16, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -10, 0, 0, -12,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 0, -11, 0,
+    0, 0, 0, 7, 0, 4, -12, -12,
+    0, -6, -6, -7, 0, 0, 0, 0,
+    0, 0, -18, 0, -6, 0, -9, -6,
+    0, -13, -15, -18, -5, 0, -12, 0,
+    -18, 0, 0, 0, 0, 49, 0, 0,
+    3, 0, 0, -8, 0, 6, 0, -26,
+    0, 0, 0, 0, 0, -57, -11, 20,
+    18, -5, -26, 0, 6, -9, 0, -30,
+    -3, -8, 6, -43, -6, 8, 0, 9,
+    -21, -9, -22, -20, -26, 0, 0, -36,
+    0, 35, 0, 0, -3, 0, 0, 0,
+    -3, -3, -6, -16, -20, -1, -57, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -6, 0, -3, -6, -9, 0, 0,
+    -12, 0, -6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, -12, 0, 0, 12,
+    -2, 8, 0, -13, 6, -4, -2, -16,
+    -6, 0, -8, -6, -4, 0, -9, -10,
+    0, 0, -5, -2, -4, -10, -7, 0,
+    0, -6, 0, 6, -4, 0, -13, 0,
+    0, 0, -12, 0, -10, 0, -10, -10,
+    6, 0, 0, 0, 0, 0, 0, 0,
+    0, -12, 6, 0, -9, 0, -4, -7,
+    -19, -4, -4, -4, -2, -4, -7, -2,
+    0, 0, 0, 0, 0, -6, -5, -5,
+    0, 0, 0, 0, 7, -4, 0, -4,
+    0, 0, 0, -4, -7, -4, -5, -7,
+    -5, 0, 5, 24, -2, 0, -16, 0,
+    -4, 12, 0, -6, -26, -8, 9, 1,
+    0, -29, -10, 6, -10, 4, 0, -4,
+    -5, -19, 0, -9, 3, 0, 0, -10,
+    0, 0, 0, 6, 6, -12, -12, 0,
+    -10, -6, -9, -6, -6, 0, -10, 3,
+    -12, -10, 18, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -10, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -5, -6,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -9, 0, 0, -8,
+    0, 0, -6, -6, 0, 0, 0, 0,
+    -6, 0, 0, 0, 0, -3, 0, 0,
+    0, 0, 0, -4, 0, 0, 0, 0,
+    -9, 0, -12, 0, 0, 0, -20, 0,
+    4, -13, 12, 1, -4, -29, 0, 0,
+    -13, -6, 0, -24, -15, -17, 0, 0,
+    -26, -6, -24, -23, -29, 0, -16, 0,
+    5, 41, -8, 0, -14, -6, -2, -6,
+    -10, -16, -11, -22, -25, -14, -6, 0,
+    0, -4, 0, 2, 0, 0, -43, -5,
+    18, 13, -13, -22, 0, 2, -19, 0,
+    -30, -4, -6, 12, -56, -8, 2, 0,
+    0, -40, -7, -32, -6, -44, 0, 0,
+    -43, 0, 36, 2, 0, -4, 0, 0,
+    0, 0, -3, -4, -23, -4, 0, -40,
+    0, 0, 0, 0, -19, 0, -5, 0,
+    -2, -17, -29, 0, 0, -3, -9, -18,
+    -6, 0, -4, 0, 0, 0, 0, -27,
+    -6, -20, -19, -5, -10, -15, -6, -10,
+    0, -12, -5, -20, -9, 0, -7, -12,
+    -6, -12, 0, 3, 0, -4, -20, 0,
+    12, 0, -11, 0, 0, 0, 0, 7,
+    0, 4, -12, 25, 0, -6, -6, -7,
+    0, 0, 0, 0, 0, 0, -18, 0,
+    -6, 0, -9, -6, 0, -13, -15, -18,
+    -5, 0, -12, 5, 24, 0, 0, 0,
+    0, 49, 0, 0, 3, 0, 0, -8,
+    0, 6, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0,
+    -4, -12, 0, 0, 0, 0, 0, -3,
+    0, 0, 0, -6, -6, 0, 0, -12,
+    -6, 0, 0, -12, 0, 10, -3, 0,
+    0, 0, 0, 0, 0, 3, 0, 0,
+    0, 0, 9, 12, 5, -5, 0, -19,
+    -10, 0, 18, -20, -19, -12, -12, 24,
+    11, 6, -53, -4, 12, -6, 0, -6,
+    7, -6, -21, 0, -6, 6, -8, -5,
+    -18, -5, 0, 0, 18, 12, 0, -17,
+    0, -33, -8, 18, -8, -23, 2, -8,
+    -20, -20, -6, 24, 6, 0, -9, 0,
+    -16, 0, 5, 20, -14, -22, -24, -15,
+    18, 0, 2, -44, -5, 6, -10, -4,
+    -14, 0, -13, -22, -9, -9, -5, 0,
+    0, -14, -13, -6, 0, 18, 14, -6,
+    -33, 0, -33, -9, 0, -21, -35, -2,
+    -19, -10, -20, -17, 16, 0, 0, -8,
+    0, -12, -5, 0, -6, -11, 0, 10,
+    -20, 6, 0, 0, -32, 0, -6, -13,
+    -10, -4, -18, -15, -20, -14, 0, -18,
+    -6, -14, -12, -18, -6, 0, 0, 2,
+    29, -10, 0, -18, -6, 0, -6, -12,
+    -14, -16, -17, -23, -8, -12, 12, 0,
+    -9, 0, -30, -7, 4, 12, -19, -22,
+    -12, -20, 20, -6, 3, -57, -11, 12,
+    -13, -10, -22, 0, -18, -26, -7, -6,
+    -5, -6, -13, -18, -2, 0, 0, 18,
+    17, -4, -40, 0, -36, -14, 15, -23,
+    -41, -12, -21, -26, -30, -20, 12, 0,
+    0, 0, 0, -7, 0, 0, 6, -7,
+    12, 4, -12, 12, 0, 0, -19, -2,
+    0, -2, 0, 2, 2, -5, 0, 0,
+    0, 0, 0, 0, -6, 0, 0, 0,
+    0, 5, 18, 1, 0, -7, 0, 0,
+    0, 0, -4, -4, -7, 0, 0, 0,
+    2, 5, 0, 0, 0, 0, 5, 0,
+    -5, 0, 23, 0, 11, 2, 2, -8,
+    0, 12, 0, 0, 0, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 18, 0, 17, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -36, 0, -6, 10, 0, 18,
+    0, 0, 60, 7, -12, -12, 6, 6,
+    -4, 2, -30, 0, 0, 29, -36, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -41, 23, 85, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -36, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -10, 0, 0, -12,
+    -5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -4, 0, -16, 0,
+    0, 2, 0, 0, 6, 78, -12, -5,
+    19, 16, -16, 6, 0, 0, 6, 6,
+    -8, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -79, 17, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -17,
+    0, 0, 0, -16, 0, 0, 0, 0,
+    -13, -3, 0, 0, 0, -13, 0, -7,
+    0, -29, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -41, 0, 0,
+    0, 0, 2, 0, 0, 0, 0, 0,
+    0, -6, 0, 0, -12, 0, -9, 0,
+    -16, 0, 0, 0, -10, 6, -7, 0,
+    0, -16, -6, -14, 0, 0, -16, 0,
+    -6, 0, -29, 0, -7, 0, 0, -49,
+    -12, -24, -7, -22, 0, 0, -41, 0,
+    -16, -3, 0, 0, 0, 0, 0, 0,
+    0, 0, -9, -11, -5, -10, 0, 0,
+    0, 0, -13, 0, -13, 8, -7, 12,
+    0, -4, -14, -4, -10, -12, 0, -7,
+    -3, -4, 4, -16, -2, 0, 0, 0,
+    -54, -5, -9, 0, -13, 0, -4, -29,
+    -5, 0, 0, -4, -5, 0, 0, 0,
+    0, 4, 0, -4, -10, -4, 10, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 8, 0, 0, 0, 0, 0,
+    0, -13, 0, -4, 0, 0, 0, -12,
+    6, 0, 0, 0, -16, -6, -12, 0,
+    0, -17, 0, -6, 0, -29, 0, 0,
+    0, 0, -59, 0, -12, -22, -30, 0,
+    0, -41, 0, -4, -9, 0, 0, 0,
+    0, 0, 0, 0, 0, -6, -9, -3,
+    -9, 2, 0, 0, 10, -8, 0, 19,
+    30, -6, -6, -18, 7, 30, 10, 13,
+    -16, 7, 26, 7, 18, 13, 16, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 38, 29, -11, -6, 0, -5,
+    49, 26, 49, 0, 0, 0, 6, 0,
+    0, 22, 0, 0, -10, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -4, 0,
+    0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, -51, -7, -5, -25,
+    -30, 0, 0, -41, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -10, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -4,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, -51, -7, -5,
+    -25, -30, 0, 0, -24, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -5, 0, 0, 0, -14, 6, 0, -6,
+    5, 11, 6, -18, 0, -1, -5, 6,
+    0, 5, 0, 0, 0, 0, -15, 0,
+    -5, -4, -12, 0, -5, -24, 0, 38,
+    -6, 0, -13, -4, 0, -4, -10, 0,
+    -6, -17, -12, -7, 0, 0, 0, -10,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, 0, 0, 0, 0, 0, 0,
+    0, 0, 9, 0, 0, 0, 0, -51,
+    -7, -5, -25, -30, 0, 0, -41, 0,
+    0, 0, 0, 0, 0, 30, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -10, 0, -19, -7, -5, 18, -5, -6,
+    -24, 2, -4, 2, -4, -16, 1, 13,
+    1, 5, 2, 5, -15, -24, -7, 0,
+    -23, -12, -16, -26, -24, 0, -10, -12,
+    -7, -8, -5, -4, -7, -4, 0, -4,
+    -2, 9, 0, 9, -4, 0, 19, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, -6, -6, 0, 0,
+    -16, 0, -3, 0, -10, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -36, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -6, -6, 0, -8,
+    0, 0, 0, 0, -5, 0, 0, -10,
+    -6, 6, 0, -10, -12, -4, 0, -18,
+    -4, -13, -4, -7, 0, -10, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -41, 0, 19, 0, 0, -11, 0,
+    0, 0, 0, -8, 0, -6, 0, 0,
+    -3, 0, 0, -4, 0, -14, 0, 0,
+    26, -8, -20, -19, 4, 7, 7, -1,
+    -17, 4, 9, 4, 18, 4, 20, -4,
+    -16, 0, 0, -24, 0, 0, -18, -16,
+    0, 0, -12, 0, -8, -10, 0, -9,
+    0, -9, 0, -4, 9, 0, -5, -18,
+    -6, 22, 0, 0, -5, 0, -12, 0,
+    0, 8, -14, 0, 6, -6, 5, 1,
+    0, -20, 0, -4, -2, 0, -6, 7,
+    -5, 0, 0, 0, -25, -7, -13, 0,
+    -18, 0, 0, -29, 0, 22, -6, 0,
+    -11, 0, 4, 0, -6, 0, -6, -18,
+    0, -6, 6, 0, 0, 0, 0, -4,
+    0, 0, 6, -8, 2, 0, 0, -7,
+    -4, 0, -7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -38, 0, 13, 0,
+    0, -5, 0, 0, 0, 0, 1, 0,
+    -6, -6, 0, 0, 0, 12, 0, 14,
+    0, 0, 0, 0, 0, -38, -35, 2,
+    26, 18, 10, -24, 4, 26, 0, 22,
+    0, 12, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 32, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0
+};
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 61,
+    .right_class_cnt     = 49,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+#if LVGL_VERSION_MAJOR >= 8
+/*Store all the custom data of the font*/
+
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+#else
+static lv_font_fmt_txt_dsc_t font_dsc = {
+#endif
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 2,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+
+};
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+#if LVGL_VERSION_MAJOR >= 8
+const lv_font_t lv_font_montserrat_38 = {
+#else
+lv_font_t lv_font_montserrat_38 = {
+#endif
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 41,          /*The maximum line height required by the font*/
+    .base_line = 7,             /*Baseline measured from the bottom of the line*/
+#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
+    .subpx = LV_FONT_SUBPX_NONE,
+#endif
+#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
+    .underline_position = -3,
+    .underline_thickness = 2,
+#endif
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+};
+
+#endif /*#if LV_FONT_MONTSERRAT_38*/
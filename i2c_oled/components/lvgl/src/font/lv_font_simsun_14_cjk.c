@@ -0,0 +1,20783 @@
+/*******************************************************************************
+ * Size: 14 px
+ * Bpp: 4
+ * Opts: --no-compress --no-prefilter --bpp 4 --size 14 --font SimSun.woff -r 0x20-0x7f --symbols （），盗提陽帯鼻画輕ッ冊ェル写父ぁフ結想正四O夫源庭場天續鳥れ講猿苦階給了製守8祝己妳薄泣塩帰ぺ吃変輪那着仍嗯爭熱創味保字宿捨準查達肯ァ薬得査障該降察ね網加昼料等図邪秋コ態品屬久原殊候路願楽確針上被怕悲風份重歡っ附ぷ既4黨價娘朝凍僅際洋止右航よ专角應酸師個比則響健昇豐筆歷適修據細忙跟管長令家ザ期般花越ミ域泳通些油乏ラ。營ス返調農叫樹刊愛間包知把ヤ貧橋拡普聞前ジ建当繰ネ送習渇用補ィ覺體法遊宙ョ酔余利壊語くつ払皆時辺追奇そ們只胸械勝住全沈力光ん深溝二類北面社值試9和五勵ゃ貿幾逐打課ゲて領3鼓辦発評１渉詳暇込计駄供嘛郵頃腦反構絵お容規借身妻国慮剛急乗静必議置克土オ乎荷更肉還混古渡授合主離條値決季晴東大尚央州が嗎験流先医亦林田星晩拿60旅婦量為痛テ孫う環友況玩務其ぼち揺坐一肩腰犯タょ希即果ぶ物練待み高九找やヶ都グ去」サ、气仮雑酒許終企笑録形リ銀切ギ快問滿役単黄集森毎實研喜蘇司鉛洲川条媽ノ才兩話言雖媒出客づ卻現異故り誌逮同訊已視本題ぞを横開音第席費持眾怎選元退限ー賽処喝就残無いガ多ケ沒義遠歌隣錢某雪析嬉採自透き側員予ゼ白婚电へ顯呀始均畫似懸格車騒度わ親店週維億締慣免帳電甚來園浴ゅ愈京と杯各海怒ぜ排敗挙老買7極模実紀ヒ携隻告シ並屋這孩讓質ワブ富賃争康由辞マ火於短樣削弟材注節另室ダ招擁ぃ若套底波行勤關著泊背疲狭作念推ぐ民貸祖介說ビ代温契你我レ入描變再札ソ派頭智遅私聽舉灣山伸放直安ト誕煙付符幅ふ絡她届耳飲忘参革團仕様載ど歩獲嫌息の汚交興魚指資雙與館初学年幸史位柱族走括び考青也共腕Lで販擔理病イ今逃當寺猫邊菓係ム秘示解池影ド文例斷曾事茶寫明科桃藝売便え導禁財飛替而亡到し具空寝辛業ウ府セ國何基菜厳市努張缺雲根外だ断万砂ゴ超使台实ぽ礼最慧算軟界段律像夕丈窓助刻月夏政呼ぴざ擇趣除動従涼方勉名線対存請子氏將5少否諸論美感或西者定食御表は參歳緑命進易性錯房も捕皿判中觀戦ニ緩町ピ番ず金千ろ?不た象治関ャ每看徒卒統じ手範訪押座步号ベ旁以母すほ密減成往歲件緒読歯效院种七謂凝濃嵌震喉繼クュ拭死円2積水欲如ポにさ寒道區精啦姐ア聯能足及停思壓２春且メ裏株官答概黒過氷柿戻厚ぱ党祭織引計け委暗複誘港バ失下村較続神ぇ尤強秀膝兒来績十書済化服破新廠1紹您情半式產系好教暑早め樂地休協良な哪常要揮周かエ麗境働避護ンツ香夜太見設非改広聲他検求危清彼經未在起葉控靴所差內造寄南望尺換向展備眠點完約ぎ裡分説申童優伝島机須塊日立拉,鉄軽單気信很転識支布数紙此迎受心輸坊モ處「訳三曇兄野顔戰增ナ伊列又髪両有取左毛至困吧昔赤狀相夠整別士経頼然簡ホ会發隨営需脱ヨば接永居冬迫圍甘醫誰部充消連弱宇會咲覚姉麼的増首统帶糖朋術商担移景功育庫曲總劃牛程駅犬報ロ學責因パ嚴八世後平負公げ曜陸專午之閉ぬ談ご災昨冷職悪謝對它近射敢意運船臉局難什産頗!球真記ま但蔵究制機案湖臺ひ害券男留内木驗雨施種特復句末濟キ色訴依せ百型る石牠討呢时任執飯歐宅組傳配小活ゆべ暖ズ漸站素らボ束価チ浅回女片独妹英目從認生違策僕楚ペ米こ掛む爸六状落漢プ投カ校做啊洗声探あ割体項履触々訓技ハ低工映是標速善点人デ口次可廿节宵植树端阳旦腊妇费愚劳动儿军师庆圣诞闰 --font FontAwesome5-Solid+Brands+Regular.woff -r 61441,61448,61451,61452,61452,61453,61457,61459,61461,61465,61468,61473,61478,61479,61480,61502,61507,61512,61515,61516,61517,61521,61522,61523,61524,61543,61544,61550,61552,61553,61556,61559,61560,61561,61563,61587,61589,61636,61637,61639,61641,61664,61671,61674,61683,61724,61732,61787,61931,62016,62017,62018,62019,62020,62087,62099,62212,62189,62810,63426,63650 --format lvgl -o lv_font_simsun_14_cjk.c --force-fast-kern-format
+ ******************************************************************************/
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+    #include "lvgl.h"
+#else
+    #include "../../lvgl.h"
+#endif
+
+#ifndef LV_FONT_SIMSUN_14_CJK
+    #define LV_FONT_SIMSUN_14_CJK 1
+#endif
+
+#if LV_FONT_SIMSUN_14_CJK
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0021 "!" */
+    0x1d, 0x2, 0xf0, 0xe, 0x0, 0xc0, 0xa, 0x0,
+    0x80, 0x5, 0x0, 0x0, 0x18, 0x2, 0xe1,
+
+    /* U+0022 "\"" */
+    0x0, 0x89, 0x5b, 0x1, 0xe3, 0xd5, 0x8, 0x45,
+    0x60, 0x4, 0x4, 0x0,
+
+    /* U+0023 "#" */
+    0x0, 0x70, 0x7, 0x0, 0x7, 0x0, 0x70, 0x7f,
+    0xff, 0xff, 0x71, 0x46, 0x24, 0x61, 0x4, 0x30,
+    0x43, 0x0, 0x52, 0x5, 0x20, 0x7f, 0xff, 0xff,
+    0x71, 0x92, 0x28, 0x21, 0x7, 0x0, 0x70, 0x0,
+    0x70, 0x7, 0x0,
+
+    /* U+0024 "$" */
+    0x0, 0x4, 0x0, 0x0, 0x8, 0x0, 0x1, 0x8b,
+    0x82, 0x9, 0x28, 0x4a, 0xc, 0x28, 0x46, 0x6,
+    0xc9, 0x0, 0x0, 0x8f, 0x30, 0x0, 0xa, 0xe2,
+    0x0, 0x8, 0x6a, 0xd, 0x28, 0xc, 0xe, 0x8,
+    0x19, 0x4, 0x7b, 0x71, 0x0, 0x8, 0x0, 0x0,
+    0x4, 0x0,
+
+    /* U+0025 "%" */
+    0x0, 0x0, 0x2, 0x4, 0x76, 0x3, 0x40, 0xa0,
+    0x90, 0x70, 0xb, 0x9, 0x16, 0x0, 0x90, 0xa5,
+    0x10, 0x1, 0x64, 0x64, 0x60, 0x0, 0x15, 0x93,
+    0x60, 0x6, 0x37, 0x9, 0x0, 0x64, 0x70, 0xa0,
+    0x32, 0x18, 0x28, 0x5, 0x0, 0x78, 0x10,
+
+    /* U+0026 "&" */
+    0x3, 0x79, 0x0, 0x0, 0xa0, 0x83, 0x0, 0xb,
+    0x9, 0x20, 0x0, 0xa5, 0x80, 0x0, 0x8, 0xa0,
+    0x78, 0x14, 0x6d, 0x4, 0x40, 0xb0, 0x95, 0x51,
+    0xc, 0x2, 0xd7, 0x0, 0x95, 0x8, 0xb0, 0x31,
+    0xb9, 0x68, 0xc5,
+
+    /* U+0027 "'" */
+    0xd, 0x60, 0x8a, 0x5, 0x50, 0x60,
+
+    /* U+0028 "(" */
+    0x0, 0x0, 0x0, 0x71, 0x5, 0x40, 0xa, 0x0,
+    0x65, 0x0, 0xb1, 0x0, 0xc0, 0x0, 0xc0, 0x0,
+    0xc0, 0x0, 0xb0, 0x0, 0x65, 0x0, 0x1a, 0x0,
+    0x6, 0x40, 0x0, 0x81, 0x0, 0x1,
+
+    /* U+0029 ")" */
+    0x0, 0x0, 0x26, 0x0, 0x5, 0x40, 0x0, 0xa0,
+    0x0, 0x65, 0x0, 0x2a, 0x0, 0xc, 0x0, 0xc,
+    0x0, 0xc, 0x0, 0x1b, 0x0, 0x66, 0x0, 0xa0,
+    0x4, 0x50, 0x17, 0x0, 0x10, 0x0,
+
+    /* U+002A "*" */
+    0x0, 0x5, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x6b,
+    0xb, 0x1c, 0x50, 0x7a, 0x7a, 0x70, 0x0, 0x6a,
+    0x60, 0x4, 0xe5, 0x86, 0xe3, 0x24, 0xd, 0x4,
+    0x20, 0x0, 0xd0, 0x0,
+
+    /* U+002B "+" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0,
+    0x7, 0x0, 0x0, 0x0, 0x70, 0x0, 0x38, 0x8c,
+    0x88, 0x40, 0x0, 0x70, 0x0, 0x0, 0x7, 0x0,
+    0x0, 0x0, 0x70, 0x0, 0x0, 0x2, 0x0, 0x0,
+
+    /* U+002C "," */
+    0xd, 0x60, 0x8a, 0x5, 0x50, 0x60,
+
+    /* U+002D "-" */
+    0x48, 0x88, 0x88, 0x40,
+
+    /* U+002E "." */
+    0x9, 0x40, 0xd6,
+
+    /* U+002F "/" */
+    0x0, 0x0, 0x1, 0x30, 0x0, 0x0, 0x60, 0x0,
+    0x0, 0x7, 0x0, 0x0, 0x5, 0x10, 0x0, 0x0,
+    0x70, 0x0, 0x0, 0x43, 0x0, 0x0, 0x7, 0x0,
+    0x0, 0x2, 0x50, 0x0, 0x0, 0x70, 0x0, 0x0,
+    0x6, 0x0, 0x0, 0x6, 0x10, 0x0, 0x0, 0x70,
+    0x0, 0x0, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x97, 0x90, 0x0, 0x95, 0x4, 0x90, 0xe,
+    0x0, 0xe, 0x3, 0xc0, 0x0, 0xd3, 0x4b, 0x0,
+    0xc, 0x45, 0xb0, 0x0, 0xc3, 0x3c, 0x0, 0xd,
+    0x20, 0xe0, 0x0, 0xe0, 0x9, 0x50, 0x48, 0x0,
+    0x9, 0x79, 0x0,
+
+    /* U+0031 "1" */
+    0x26, 0xe0, 0x0, 0xe, 0x0, 0x0, 0xe0, 0x0,
+    0xe, 0x0, 0x0, 0xe0, 0x0, 0xe, 0x0, 0x0,
+    0xe0, 0x0, 0xe, 0x0, 0x0, 0xe0, 0x2, 0x7f,
+    0x83,
+
+    /* U+0032 "2" */
+    0x3, 0x76, 0x93, 0x0, 0xb0, 0x1, 0xd0, 0x1f,
+    0x0, 0xe, 0x0, 0x40, 0x1, 0xc0, 0x0, 0x0,
+    0x84, 0x0, 0x0, 0x46, 0x0, 0x0, 0x36, 0x0,
+    0x0, 0x17, 0x0, 0x20, 0x8, 0x0, 0x8, 0x4,
+    0xee, 0xee, 0xd0,
+
+    /* U+0033 "3" */
+    0x4, 0x67, 0x91, 0x0, 0xd0, 0x5, 0x90, 0x8,
+    0x0, 0x3b, 0x0, 0x0, 0x8, 0x40, 0x0, 0x2a,
+    0x80, 0x0, 0x0, 0x5, 0x80, 0x0, 0x0, 0xe,
+    0x0, 0xb0, 0x0, 0xe0, 0x1e, 0x0, 0x2b, 0x0,
+    0x57, 0x68, 0x10,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x6e, 0x0, 0x0,
+    0x15, 0xd0, 0x0, 0x7, 0xd, 0x0, 0x4, 0x20,
+    0xd0, 0x0, 0x60, 0xd, 0x0, 0x45, 0x55, 0xe5,
+    0x20, 0x0, 0xd, 0x0, 0x0, 0x0, 0xd0, 0x0,
+    0x1, 0x6f, 0x81,
+
+    /* U+0035 "5" */
+    0x8, 0xee, 0xec, 0x0, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0x68, 0x9b, 0x20, 0x9, 0x10,
+    0x3b, 0x0, 0x0, 0x0, 0xe0, 0x1, 0x0, 0xd,
+    0x11, 0xf0, 0x0, 0xd0, 0xc, 0x0, 0x2a, 0x0,
+    0x37, 0x69, 0x10,
+
+    /* U+0036 "6" */
+    0x0, 0x66, 0x96, 0x0, 0x73, 0x2, 0x60, 0xc,
+    0x0, 0x0, 0x2, 0xb6, 0x9c, 0x40, 0x4e, 0x40,
+    0x1d, 0x5, 0xc0, 0x0, 0xb3, 0x4c, 0x0, 0xa,
+    0x41, 0xe0, 0x0, 0xb2, 0xb, 0x40, 0xb, 0x0,
+    0x1a, 0x68, 0x20,
+
+    /* U+0037 "7" */
+    0xd, 0xee, 0xef, 0x10, 0x90, 0x0, 0x70, 0x2,
+    0x0, 0x61, 0x0, 0x0, 0x8, 0x0, 0x0, 0x5,
+    0x40, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x1c, 0x0,
+    0x0, 0x5, 0xb0, 0x0, 0x0, 0x7b, 0x0, 0x0,
+    0x6, 0xa0, 0x0,
+
+    /* U+0038 "8" */
+    0x3, 0x86, 0x82, 0x0, 0xb0, 0x0, 0xb0, 0x2b,
+    0x0, 0xb, 0x0, 0xd6, 0x1, 0xa0, 0x1, 0xec,
+    0x90, 0x0, 0x83, 0x5e, 0x50, 0x39, 0x0, 0x2e,
+    0x5, 0x60, 0x0, 0xb2, 0x29, 0x0, 0xb, 0x0,
+    0x47, 0x67, 0x30,
+
+    /* U+0039 "9" */
+    0x4, 0x87, 0x81, 0x1, 0xc0, 0x2, 0xa0, 0x59,
+    0x0, 0xd, 0x5, 0x90, 0x0, 0xe2, 0x1d, 0x10,
+    0x6e, 0x30, 0x49, 0x83, 0xe2, 0x0, 0x0, 0xf,
+    0x0, 0x10, 0x3, 0xa0, 0xd, 0x30, 0x94, 0x0,
+    0x79, 0x76, 0x0,
+
+    /* U+003A ":" */
+    0x3e, 0x1, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x80, 0x3e, 0x0,
+
+    /* U+003B ";" */
+    0x3f, 0x1, 0x50, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x50, 0x3f, 0x0, 0xa0, 0x3, 0x0,
+
+    /* U+003C "<" */
+    0x0, 0x0, 0x5, 0x0, 0x0, 0x5, 0x40, 0x0,
+    0x5, 0x50, 0x0, 0x4, 0x60, 0x0, 0x3, 0x70,
+    0x0, 0x0, 0xa0, 0x0, 0x0, 0x4, 0x60, 0x0,
+    0x0, 0x5, 0x50, 0x0, 0x0, 0x6, 0x40, 0x0,
+    0x0, 0x6, 0x30, 0x0, 0x0, 0x6, 0x0,
+
+    /* U+003D "=" */
+    0x48, 0x88, 0x88, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0x88, 0x88, 0x84,
+
+    /* U+003E ">" */
+    0x5, 0x0, 0x0, 0x0, 0x46, 0x0, 0x0, 0x0,
+    0x55, 0x0, 0x0, 0x0, 0x64, 0x0, 0x0, 0x0,
+    0x73, 0x0, 0x0, 0x0, 0xa0, 0x0, 0x0, 0x64,
+    0x0, 0x0, 0x55, 0x0, 0x0, 0x46, 0x0, 0x0,
+    0x37, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+
+    /* U+003F "?" */
+    0x2, 0x88, 0xa4, 0x0, 0x80, 0x0, 0xd1, 0x3a,
+    0x0, 0xb, 0x31, 0x90, 0x0, 0xe1, 0x0, 0x1,
+    0xa5, 0x0, 0x0, 0x81, 0x0, 0x0, 0x7, 0x0,
+    0x0, 0x0, 0x20, 0x0, 0x0, 0x18, 0x0, 0x0,
+    0x3, 0xe0, 0x0,
+
+    /* U+0040 "@" */
+    0x0, 0x77, 0x74, 0x0, 0x72, 0x46, 0xa2, 0x9,
+    0x17, 0x65, 0x74, 0x67, 0x27, 0x37, 0x65, 0xb0,
+    0x91, 0x76, 0x5b, 0xa, 0x7, 0x46, 0xa1, 0xc4,
+    0x31, 0x95, 0x66, 0x61, 0x8, 0x10, 0x4, 0x30,
+    0x8, 0x77, 0x50,
+
+    /* U+0041 "A" */
+    0x0, 0xb, 0x0, 0x0, 0x4, 0xe2, 0x0, 0x0,
+    0x77, 0x60, 0x0, 0x8, 0x49, 0x0, 0x0, 0x70,
+    0xd0, 0x0, 0x44, 0xc, 0x10, 0x7, 0x65, 0xb5,
+    0x0, 0x80, 0x5, 0x80, 0x7, 0x0, 0x1c, 0x8,
+    0xb0, 0x4, 0xf5,
+
+    /* U+0042 "B" */
+    0x4e, 0x66, 0x95, 0x0, 0xd0, 0x0, 0xe0, 0xd,
+    0x0, 0xe, 0x0, 0xd0, 0x3, 0xb0, 0xd, 0x56,
+    0xb1, 0x0, 0xd0, 0x1, 0xc0, 0xd, 0x0, 0x9,
+    0x60, 0xd0, 0x0, 0x97, 0xd, 0x0, 0xc, 0x34,
+    0xe6, 0x68, 0x60,
+
+    /* U+0043 "C" */
+    0x0, 0x87, 0x8f, 0x10, 0x94, 0x0, 0x54, 0x1d,
+    0x0, 0x0, 0x36, 0x90, 0x0, 0x0, 0x88, 0x0,
+    0x0, 0x8, 0x80, 0x0, 0x0, 0x79, 0x0, 0x0,
+    0x4, 0xc0, 0x0, 0x4, 0xd, 0x30, 0x6, 0x10,
+    0x1a, 0x88, 0x30,
+
+    /* U+0044 "D" */
+    0x4e, 0x76, 0x80, 0x0, 0xd0, 0x3, 0xb0, 0xd,
+    0x0, 0xc, 0x30, 0xd0, 0x0, 0x96, 0xd, 0x0,
+    0x8, 0x70, 0xd0, 0x0, 0x87, 0xd, 0x0, 0xa,
+    0x60, 0xd0, 0x0, 0xd2, 0xd, 0x0, 0x4a, 0x4,
+    0xe7, 0x78, 0x0,
+
+    /* U+0045 "E" */
+    0x3e, 0x75, 0x7d, 0x0, 0xc1, 0x0, 0x43, 0xc,
+    0x10, 0x0, 0x0, 0xc1, 0x5, 0x0, 0xc, 0x65,
+    0xd0, 0x0, 0xc1, 0x6, 0x0, 0xc, 0x10, 0x20,
+    0x0, 0xc1, 0x0, 0x1, 0xc, 0x10, 0x2, 0x53,
+    0xe7, 0x57, 0xe1,
+
+    /* U+0046 "F" */
+    0x3e, 0x75, 0x6d, 0x30, 0xc1, 0x0, 0x17, 0xc,
+    0x10, 0x0, 0x0, 0xc1, 0x2, 0x40, 0xc, 0x65,
+    0xb4, 0x0, 0xc1, 0x2, 0x40, 0xc, 0x10, 0x1,
+    0x0, 0xc1, 0x0, 0x0, 0xc, 0x10, 0x0, 0x4,
+    0xe7, 0x0, 0x0,
+
+    /* U+0047 "G" */
+    0x1, 0x97, 0xc8, 0x0, 0xa2, 0x0, 0x90, 0x1a,
+    0x0, 0x3, 0x6, 0x70, 0x0, 0x0, 0x86, 0x0,
+    0x0, 0x9, 0x60, 0x7, 0xa4, 0x77, 0x0, 0xe,
+    0x3, 0xb0, 0x0, 0xd0, 0xc, 0x10, 0xd, 0x0,
+    0x29, 0x67, 0x40,
+
+    /* U+0048 "H" */
+    0x5f, 0x30, 0x3f, 0x40, 0xd0, 0x0, 0xe0, 0xd,
+    0x0, 0xe, 0x0, 0xd0, 0x0, 0xe0, 0xe, 0x55,
+    0x5e, 0x0, 0xd0, 0x0, 0xe0, 0xd, 0x0, 0xe,
+    0x0, 0xd0, 0x0, 0xe0, 0xd, 0x0, 0xe, 0x5,
+    0xf3, 0x4, 0xf4,
+
+    /* U+0049 "I" */
+    0x36, 0xf6, 0x30, 0xe, 0x0, 0x0, 0xe0, 0x0,
+    0xe, 0x0, 0x0, 0xe0, 0x0, 0xe, 0x0, 0x0,
+    0xe0, 0x0, 0xe, 0x0, 0x0, 0xe0, 0x3, 0x6f,
+    0x63,
+
+    /* U+004A "J" */
+    0x0, 0x46, 0xf5, 0x30, 0x0, 0xe, 0x0, 0x0,
+    0x0, 0xe0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0,
+    0xe0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0xe0,
+    0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0xe0, 0x0,
+    0x0, 0xd, 0x0, 0x57, 0x3, 0x90, 0x3, 0xb6,
+    0x70, 0x0,
+
+    /* U+004B "K" */
+    0x4e, 0x50, 0x8c, 0x20, 0xd0, 0x7, 0x0, 0xd,
+    0x4, 0x30, 0x0, 0xd1, 0x70, 0x0, 0xd, 0x8c,
+    0x0, 0x0, 0xd4, 0xa4, 0x0, 0xd, 0x3, 0xb0,
+    0x0, 0xd0, 0xc, 0x20, 0xd, 0x0, 0x59, 0x4,
+    0xe6, 0x4, 0xf5,
+
+    /* U+004C "L" */
+    0x2d, 0x80, 0x0, 0x0, 0xb3, 0x0, 0x0, 0xb,
+    0x30, 0x0, 0x0, 0xb3, 0x0, 0x0, 0xb, 0x30,
+    0x0, 0x0, 0xb3, 0x0, 0x0, 0xb, 0x30, 0x0,
+    0x0, 0xb3, 0x0, 0x1, 0xb, 0x30, 0x1, 0x53,
+    0xd8, 0x56, 0xd2,
+
+    /* U+004D "M" */
+    0x7c, 0x0, 0xf, 0x62, 0xe0, 0x3, 0xe2, 0x2b,
+    0x30, 0x6c, 0x22, 0x86, 0x6, 0xc2, 0x25, 0x90,
+    0x6c, 0x22, 0x2c, 0x14, 0xc2, 0x22, 0xb5, 0xc,
+    0x22, 0x28, 0x90, 0xc2, 0x22, 0x59, 0xc, 0x27,
+    0x72, 0x63, 0xe7,
+
+    /* U+004E "N" */
+    0x4f, 0x10, 0x1a, 0x50, 0xc8, 0x0, 0x50, 0x5,
+    0xd1, 0x5, 0x0, 0x57, 0x80, 0x50, 0x5, 0xd,
+    0x5, 0x0, 0x50, 0x87, 0x50, 0x5, 0x1, 0xe5,
+    0x0, 0x50, 0x8, 0xc0, 0x5, 0x0, 0x1f, 0x5,
+    0xa1, 0x0, 0x90,
+
+    /* U+004F "O" */
+    0x1, 0x96, 0x81, 0x0, 0xa2, 0x0, 0xb0, 0x1c,
+    0x0, 0xb, 0x35, 0x90, 0x0, 0x87, 0x78, 0x0,
+    0x7, 0x97, 0x80, 0x0, 0x79, 0x59, 0x0, 0x7,
+    0x71, 0xb0, 0x0, 0xa3, 0xa, 0x20, 0xb, 0x0,
+    0x18, 0x57, 0x20,
+
+    /* U+0050 "P" */
+    0x3e, 0x75, 0x75, 0x0, 0xc1, 0x0, 0xb2, 0xc,
+    0x10, 0x8, 0x60, 0xc1, 0x0, 0x95, 0xc, 0x10,
+    0x1c, 0x0, 0xc6, 0x57, 0x10, 0xc, 0x10, 0x0,
+    0x0, 0xc1, 0x0, 0x0, 0xc, 0x10, 0x0, 0x4,
+    0xe7, 0x0, 0x0,
+
+    /* U+0051 "Q" */
+    0x2, 0x96, 0x81, 0x0, 0xc1, 0x1, 0xb0, 0x3b,
+    0x0, 0xb, 0x36, 0x90, 0x0, 0x87, 0x87, 0x0,
+    0x7, 0x88, 0x70, 0x0, 0x78, 0x78, 0x0, 0x8,
+    0x74, 0xa8, 0xa1, 0xa3, 0xd, 0x44, 0x9b, 0x0,
+    0x28, 0x7f, 0x30, 0x0, 0x0, 0x7d, 0x20,
+
+    /* U+0052 "R" */
+    0x3d, 0x76, 0x95, 0x0, 0xb2, 0x0, 0xe1, 0xb,
+    0x20, 0xc, 0x20, 0xb2, 0x2, 0xc0, 0xb, 0x68,
+    0x91, 0x0, 0xb2, 0x58, 0x0, 0xb, 0x20, 0xd0,
+    0x0, 0xb2, 0xa, 0x40, 0xb, 0x20, 0x49, 0x3,
+    0xd7, 0x0, 0xe4,
+
+    /* U+0053 "S" */
+    0x4, 0x67, 0xcb, 0x1, 0x80, 0x0, 0x90, 0x37,
+    0x0, 0x1, 0x1, 0xd3, 0x0, 0x0, 0x3, 0xcb,
+    0x20, 0x0, 0x0, 0x5d, 0x50, 0x0, 0x0, 0x1d,
+    0x3, 0x10, 0x0, 0x92, 0x38, 0x0, 0xa, 0x0,
+    0xfa, 0x67, 0x30,
+
+    /* U+0054 "T" */
+    0x3b, 0x6f, 0x6b, 0x26, 0x0, 0xe0, 0x15, 0x10,
+    0xe, 0x0, 0x10, 0x0, 0xe0, 0x0, 0x0, 0xe,
+    0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe, 0x0,
+    0x0, 0x0, 0xe0, 0x0, 0x0, 0xe, 0x0, 0x0,
+    0x6, 0xf5, 0x0,
+
+    /* U+0055 "U" */
+    0x5f, 0x30, 0x1a, 0x40, 0xd0, 0x0, 0x50, 0xd,
+    0x0, 0x5, 0x0, 0xd0, 0x0, 0x50, 0xd, 0x0,
+    0x5, 0x0, 0xd0, 0x0, 0x50, 0xd, 0x0, 0x5,
+    0x0, 0xd0, 0x0, 0x50, 0xc, 0x0, 0x6, 0x0,
+    0x39, 0x77, 0x10,
+
+    /* U+0056 "V" */
+    0x5f, 0x30, 0x2c, 0x40, 0xd1, 0x0, 0x70, 0x9,
+    0x40, 0x15, 0x0, 0x58, 0x5, 0x10, 0x2, 0xc0,
+    0x60, 0x0, 0xd, 0x6, 0x0, 0x0, 0xa4, 0x50,
+    0x0, 0x7, 0xb1, 0x0, 0x0, 0x3d, 0x0, 0x0,
+    0x0, 0x80, 0x0,
+
+    /* U+0057 "W" */
+    0x9a, 0x2e, 0x36, 0x83, 0x80, 0xb0, 0x32, 0x1a,
+    0xb, 0x25, 0x0, 0xb0, 0xd4, 0x50, 0xb, 0x1a,
+    0x65, 0x0, 0xa5, 0x58, 0x50, 0x8, 0x91, 0xb5,
+    0x0, 0x6b, 0xe, 0x20, 0x3, 0x90, 0xc0, 0x0,
+    0x16, 0x7, 0x0,
+
+    /* U+0058 "X" */
+    0x2d, 0x70, 0x4c, 0x20, 0x57, 0x3, 0x30, 0x0,
+    0xc0, 0x70, 0x0, 0x8, 0x75, 0x0, 0x0, 0x1e,
+    0x0, 0x0, 0x0, 0xe3, 0x0, 0x0, 0x65, 0xa0,
+    0x0, 0x7, 0xc, 0x10, 0x5, 0x20, 0x68, 0x3,
+    0xd2, 0x5, 0xf4,
+
+    /* U+0059 "Y" */
+    0x4f, 0x40, 0x3d, 0x40, 0xa3, 0x0, 0x60, 0x4,
+    0x90, 0x41, 0x0, 0xd, 0x6, 0x0, 0x0, 0x95,
+    0x50, 0x0, 0x3, 0xd0, 0x0, 0x0, 0xe, 0x0,
+    0x0, 0x0, 0xe0, 0x0, 0x0, 0xe, 0x0, 0x0,
+    0x6, 0xf5, 0x0,
+
+    /* U+005A "Z" */
+    0xb, 0x95, 0x5e, 0x21, 0x70, 0x4, 0xa0, 0x0,
+    0x0, 0xc2, 0x0, 0x0, 0x4a, 0x0, 0x0, 0xc,
+    0x20, 0x0, 0x4, 0xa0, 0x0, 0x0, 0xb2, 0x0,
+    0x0, 0x4a, 0x0, 0x1, 0xb, 0x20, 0x6, 0x24,
+    0xd5, 0x57, 0xd0,
+
+    /* U+005B "[" */
+    0x39, 0x88, 0x4, 0x40, 0x0, 0x44, 0x0, 0x4,
+    0x40, 0x0, 0x44, 0x0, 0x4, 0x40, 0x0, 0x44,
+    0x0, 0x4, 0x40, 0x0, 0x44, 0x0, 0x4, 0x40,
+    0x0, 0x44, 0x0, 0x4, 0x40, 0x0, 0x44, 0x0,
+    0x3, 0x98, 0x80,
+
+    /* U+005C "\\" */
+    0xa0, 0x0, 0x0, 0x64, 0x0, 0x0, 0x9, 0x0,
+    0x0, 0x9, 0x0, 0x0, 0x4, 0x50, 0x0, 0x0,
+    0xa0, 0x0, 0x0, 0x81, 0x0, 0x0, 0x27, 0x0,
+    0x0, 0xa, 0x0, 0x0, 0x6, 0x30, 0x0, 0x1,
+    0x90, 0x0, 0x0, 0x90, 0x0, 0x0, 0x32,
+
+    /* U+005D "]" */
+    0x8, 0x89, 0x20, 0x0, 0x53, 0x0, 0x5, 0x30,
+    0x0, 0x53, 0x0, 0x5, 0x30, 0x0, 0x53, 0x0,
+    0x5, 0x30, 0x0, 0x53, 0x0, 0x5, 0x30, 0x0,
+    0x53, 0x0, 0x5, 0x30, 0x0, 0x53, 0x0, 0x5,
+    0x30, 0x88, 0x92,
+
+    /* U+005E "^" */
+    0x8, 0xb8, 0x1, 0x30, 0x31,
+
+    /* U+005F "_" */
+    0x55, 0x55, 0x55, 0x50,
+
+    /* U+0060 "`" */
+    0x5c, 0x30, 0x4,
+
+    /* U+0061 "a" */
+    0x5, 0x65, 0x81, 0x0, 0xd0, 0x4, 0x80, 0x0,
+    0x4, 0x79, 0x0, 0x78, 0x23, 0x90, 0x3b, 0x0,
+    0x39, 0x5, 0x90, 0x3, 0x92, 0xa, 0x76, 0x6b,
+    0x50,
+
+    /* U+0062 "b" */
+    0x3, 0x0, 0x0, 0x4, 0xd0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x47,
+    0x94, 0x0, 0xd4, 0x0, 0xc0, 0xc, 0x0, 0xb,
+    0x20, 0xc0, 0x0, 0xa3, 0xc, 0x0, 0xb, 0x10,
+    0xd1, 0x0, 0xb0, 0x8, 0x66, 0x82, 0x0,
+
+    /* U+0063 "c" */
+    0x0, 0x85, 0x83, 0x0, 0xa2, 0x3, 0xa0, 0xd,
+    0x0, 0x2, 0x2, 0xb0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0xb2, 0x0, 0x60, 0x1, 0x97, 0x73,
+    0x0,
+
+    /* U+0064 "d" */
+    0x0, 0x0, 0x3, 0x0, 0x0, 0x5, 0xc0, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0xc0, 0x1, 0x97,
+    0x6c, 0x0, 0xa2, 0x0, 0xc0, 0xc, 0x0, 0xc,
+    0x2, 0xb0, 0x0, 0xc0, 0xc, 0x0, 0xc, 0x0,
+    0xb1, 0x3, 0xc0, 0x2, 0x97, 0x5c, 0x30,
+
+    /* U+0065 "e" */
+    0x0, 0x86, 0x82, 0x0, 0x92, 0x1, 0xc0, 0xc,
+    0x0, 0xc, 0x11, 0xd5, 0x55, 0x91, 0xd, 0x0,
+    0x0, 0x0, 0xa2, 0x0, 0x50, 0x1, 0x97, 0x73,
+    0x0,
+
+    /* U+0066 "f" */
+    0x0, 0x7, 0x58, 0x50, 0x6, 0x40, 0x24, 0x0,
+    0x83, 0x0, 0x1, 0x5b, 0x75, 0x20, 0x0, 0x83,
+    0x0, 0x0, 0x8, 0x30, 0x0, 0x0, 0x83, 0x0,
+    0x0, 0x8, 0x30, 0x0, 0x0, 0x83, 0x0, 0x0,
+    0x5c, 0x95, 0x0,
+
+    /* U+0067 "g" */
+    0x1, 0x86, 0x99, 0x70, 0xa1, 0x6, 0x60, 0xb,
+    0x0, 0x47, 0x0, 0x83, 0x7, 0x30, 0x5, 0x75,
+    0x40, 0x0, 0x99, 0x64, 0x0, 0x7, 0x2, 0x5b,
+    0x2, 0x90, 0x0, 0x91, 0x7, 0x65, 0x66, 0x0,
+
+    /* U+0068 "h" */
+    0x6, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x58,
+    0xa4, 0x0, 0xc4, 0x0, 0xb0, 0xc, 0x0, 0xc,
+    0x0, 0xc0, 0x0, 0xc0, 0xc, 0x0, 0xc, 0x0,
+    0xc0, 0x0, 0xc0, 0x3e, 0x50, 0x4e, 0x30,
+
+    /* U+0069 "i" */
+    0x0, 0xe2, 0x0, 0x5, 0x0, 0x0, 0x20, 0x2,
+    0x5d, 0x0, 0x0, 0xc0, 0x0, 0xc, 0x0, 0x0,
+    0xc0, 0x0, 0xc, 0x0, 0x0, 0xc0, 0x2, 0x6e,
+    0x63,
+
+    /* U+006A "j" */
+    0x0, 0x8, 0x80, 0x0, 0x33, 0x0, 0x1, 0x10,
+    0x5, 0xa6, 0x0, 0x5, 0x60, 0x0, 0x56, 0x0,
+    0x5, 0x60, 0x0, 0x56, 0x0, 0x5, 0x60, 0x0,
+    0x55, 0x60, 0x8, 0x29, 0x97, 0x50,
+
+    /* U+006B "k" */
+    0x6, 0x0, 0x0, 0x3, 0xd0, 0x0, 0x0, 0xb,
+    0x0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0xb, 0x0,
+    0xc7, 0x0, 0xb0, 0x26, 0x0, 0xb, 0x1b, 0x0,
+    0x0, 0xb8, 0xa3, 0x0, 0xb, 0x12, 0xc0, 0x0,
+    0xb0, 0x9, 0x50, 0x2d, 0x50, 0x5e, 0x30,
+
+    /* U+006C "l" */
+    0x2, 0x90, 0x3, 0x5d, 0x0, 0x0, 0xc0, 0x0,
+    0xc, 0x0, 0x0, 0xc0, 0x0, 0xc, 0x0, 0x0,
+    0xc0, 0x0, 0xc, 0x0, 0x0, 0xc0, 0x0, 0xc,
+    0x0, 0x36, 0xe6, 0x30,
+
+    /* U+006D "m" */
+    0x8a, 0x7a, 0x7a, 0x24, 0x90, 0xc0, 0x55, 0x47,
+    0xc, 0x5, 0x64, 0x70, 0xc0, 0x56, 0x47, 0xc,
+    0x5, 0x64, 0x70, 0xc0, 0x56, 0x8b, 0x2e, 0x39,
+    0xa0,
+
+    /* U+006E "n" */
+    0x3e, 0x47, 0x94, 0x0, 0xc4, 0x0, 0xb0, 0xc,
+    0x0, 0xc, 0x0, 0xc0, 0x0, 0xc0, 0xc, 0x0,
+    0xc, 0x0, 0xc0, 0x0, 0xc0, 0x3e, 0x50, 0x4e,
+    0x30,
+
+    /* U+006F "o" */
+    0x1, 0x86, 0x82, 0x0, 0xb0, 0x0, 0xb0, 0x2a,
+    0x0, 0xa, 0x24, 0x80, 0x0, 0x84, 0x3a, 0x0,
+    0xa, 0x30, 0xb0, 0x0, 0xb0, 0x2, 0x85, 0x71,
+    0x0,
+
+    /* U+0070 "p" */
+    0x4e, 0x57, 0x94, 0x0, 0xc3, 0x0, 0xc0, 0xc,
+    0x0, 0x9, 0x30, 0xc0, 0x0, 0x84, 0xc, 0x0,
+    0xa, 0x30, 0xc1, 0x0, 0xc0, 0xc, 0x66, 0x92,
+    0x0, 0xc0, 0x0, 0x0, 0x3e, 0x50, 0x0, 0x0,
+
+    /* U+0071 "q" */
+    0x2, 0x86, 0x68, 0x0, 0xb0, 0x2, 0xc0, 0x2a,
+    0x0, 0xc, 0x4, 0x90, 0x0, 0xc0, 0x2a, 0x0,
+    0xc, 0x0, 0xb0, 0x2, 0xc0, 0x3, 0x97, 0x5c,
+    0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x6e, 0x30,
+
+    /* U+0072 "r" */
+    0x38, 0xc2, 0x7c, 0x30, 0xc, 0x60, 0x42, 0x0,
+    0xe0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0x36, 0xe5, 0x20,
+    0x0,
+
+    /* U+0073 "s" */
+    0x17, 0x6b, 0xa8, 0x10, 0x8, 0x69, 0x10, 0x0,
+    0x5c, 0xa1, 0x10, 0x4, 0xc8, 0x0, 0xa, 0xba,
+    0x66, 0x40,
+
+    /* U+0074 "t" */
+    0x0, 0x24, 0x0, 0x0, 0x94, 0x0, 0x5, 0xa8,
+    0x52, 0x0, 0x74, 0x0, 0x0, 0x74, 0x0, 0x0,
+    0x74, 0x0, 0x0, 0x74, 0x0, 0x0, 0x65, 0x5,
+    0x0, 0x1a, 0x83,
+
+    /* U+0075 "u" */
+    0x4d, 0x0, 0x5c, 0x0, 0xc0, 0x0, 0xc0, 0xc,
+    0x0, 0xc, 0x0, 0xc0, 0x0, 0xc0, 0xc, 0x0,
+    0xc, 0x0, 0xb0, 0x4, 0xc0, 0x4, 0xb8, 0x5c,
+    0x30,
+
+    /* U+0076 "v" */
+    0x2d, 0x70, 0x3d, 0x20, 0x75, 0x1, 0x50, 0x2,
+    0xa0, 0x50, 0x0, 0xc, 0x6, 0x0, 0x0, 0x84,
+    0x50, 0x0, 0x3, 0xd1, 0x0, 0x0, 0xa, 0x0,
+    0x0,
+
+    /* U+0077 "w" */
+    0x9b, 0x3e, 0x28, 0x82, 0x90, 0xb0, 0x50, 0xb,
+    0xd, 0x35, 0x0, 0xa2, 0x76, 0x50, 0x7, 0x81,
+    0xa4, 0x0, 0x4b, 0xd, 0x10, 0x0, 0x80, 0x80,
+    0x0,
+
+    /* U+0078 "x" */
+    0x9, 0xd0, 0x89, 0x10, 0xc, 0x18, 0x0, 0x0,
+    0x5d, 0x30, 0x0, 0x0, 0xe1, 0x0, 0x0, 0x65,
+    0x90, 0x0, 0x16, 0xa, 0x20, 0x2c, 0x50, 0x9c,
+    0x20,
+
+    /* U+0079 "y" */
+    0x2c, 0x80, 0x5c, 0x20, 0x57, 0x3, 0x40, 0x0,
+    0xb0, 0x70, 0x0, 0x9, 0x17, 0x0, 0x0, 0x48,
+    0x50, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x7, 0x0,
+    0x0, 0x1, 0x50, 0x0, 0xd, 0x90, 0x0, 0x0,
+
+    /* U+007A "z" */
+    0xc, 0x65, 0xa7, 0x0, 0x70, 0x1c, 0x0, 0x0,
+    0x9, 0x40, 0x0, 0x2, 0xb0, 0x0, 0x0, 0xb2,
+    0x2, 0x0, 0x58, 0x0, 0x70, 0xe, 0x65, 0x8b,
+    0x0,
+
+    /* U+007B "{" */
+    0x0, 0x26, 0x0, 0x80, 0x0, 0x70, 0x0, 0x80,
+    0x0, 0x80, 0x0, 0x80, 0x5, 0x40, 0x5, 0x40,
+    0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x70,
+    0x0, 0x80, 0x0, 0x27,
+
+    /* U+007C "|" */
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50,
+
+    /* U+007D "}" */
+    0x62, 0x0, 0x7, 0x0, 0x7, 0x0, 0x7, 0x0,
+    0x7, 0x0, 0x7, 0x0, 0x4, 0x50, 0x4, 0x50,
+    0x7, 0x0, 0x7, 0x0, 0x7, 0x0, 0x7, 0x0,
+    0x7, 0x0, 0x62, 0x0,
+
+    /* U+007E "~" */
+    0x5, 0x92, 0x0, 0x3, 0x11, 0xb2, 0x4, 0x0,
+    0x1, 0x97, 0x0,
+
+    /* U+007F "" */
+
+    /* U+3001 "、" */
+    0x0, 0x0, 0x29, 0x50, 0x0, 0xd7, 0x0, 0x4d,
+    0x0, 0x1,
+
+    /* U+3002 "。" */
+    0x0, 0x0, 0x67, 0x70, 0x70, 0x70, 0x77, 0x70,
+    0x0, 0x0,
+
+    /* U+3005 "々" */
+    0x0, 0x11, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0,
+    0x0, 0x82, 0x0, 0x11, 0x1, 0xc7, 0x55, 0xc8,
+    0x7, 0x21, 0x0, 0xb0, 0x11, 0x0, 0x5, 0x50,
+    0x0, 0x0, 0x8, 0x0, 0x0, 0x6, 0x52, 0x0,
+    0x0, 0x2, 0xd3, 0x0, 0x0, 0x0, 0x4d, 0x0,
+    0x0, 0x0, 0x3, 0x0,
+
+    /* U+300C "「" */
+    0x88, 0x86, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0,
+    0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0,
+    0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0,
+
+    /* U+300D "」" */
+    0x0, 0x8, 0x0, 0x8, 0x0, 0x8, 0x0, 0x8,
+    0x0, 0x8, 0x0, 0x8, 0x0, 0x8, 0x0, 0x8,
+    0x0, 0x8, 0x0, 0x8, 0x0, 0x8, 0x78, 0x88,
+
+    /* U+3041 "ぁ" */
+    0x0, 0x33, 0x0, 0x0, 0x0, 0x55, 0x54, 0x0,
+    0x5, 0xa8, 0x30, 0x0, 0x0, 0x63, 0x95, 0x10,
+    0x0, 0xb4, 0x71, 0x91, 0x8, 0x67, 0x10, 0x46,
+    0x70, 0x58, 0x0, 0x63, 0x78, 0x78, 0x3, 0x80,
+    0x1, 0x0, 0x54, 0x0,
+
+    /* U+3042 "あ" */
+    0x0, 0x4, 0x10, 0x0, 0x0, 0x0, 0x9, 0x30,
+    0x10, 0x0, 0x0, 0xa, 0x7a, 0x91, 0x0, 0x6,
+    0x7c, 0x21, 0x0, 0x0, 0x0, 0x9, 0x2c, 0x75,
+    0x0, 0x0, 0x2d, 0x6c, 0x3, 0xb1, 0x3, 0xa9,
+    0x37, 0x0, 0x48, 0x1a, 0x9, 0xa0, 0x0, 0x29,
+    0x82, 0xa, 0x50, 0x0, 0x65, 0x93, 0x89, 0x90,
+    0x2, 0xa0, 0x17, 0x20, 0x20, 0x67, 0x0, 0x0,
+    0x0, 0x14, 0x10, 0x0,
+
+    /* U+3043 "ぃ" */
+    0x0, 0x0, 0x0, 0x0, 0x55, 0x0, 0x1, 0x0,
+    0x62, 0x0, 0x3, 0x50, 0x81, 0x0, 0x0, 0x82,
+    0x71, 0x10, 0x1, 0x57, 0x37, 0x60, 0x0, 0x83,
+    0x8, 0x30, 0x0, 0x0,
+
+    /* U+3044 "い" */
+    0x34, 0x0, 0x0, 0x0, 0x0, 0x4a, 0x0, 0x0,
+    0x5, 0x0, 0x65, 0x0, 0x0, 0x2, 0x90, 0x82,
+    0x0, 0x0, 0x0, 0x56, 0x91, 0x1, 0x0, 0x0,
+    0x1a, 0x74, 0x14, 0x0, 0x4, 0x7b, 0x1c, 0xb1,
+    0x0, 0x0, 0x75, 0x4, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+3046 "う" */
+    0x0, 0x32, 0x0, 0x0, 0x0, 0x4, 0xdb, 0x0,
+    0x0, 0x2, 0x42, 0x0, 0x0, 0x2, 0x78, 0x20,
+    0x3, 0x97, 0x1, 0xb0, 0x58, 0x10, 0x0, 0x92,
+    0x0, 0x0, 0x0, 0x92, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0x3, 0x90, 0x0, 0x0, 0x1b, 0x0,
+    0x0, 0x3, 0x91, 0x0, 0x0, 0x43, 0x0, 0x0,
+
+    /* U+3047 "ぇ" */
+    0x0, 0x3, 0x70, 0x0, 0x0, 0x1, 0x60, 0x0,
+    0x0, 0x16, 0xb5, 0x0, 0x5, 0x71, 0xa0, 0x0,
+    0x0, 0x8, 0x10, 0x0, 0x0, 0x78, 0x40, 0x0,
+    0x9, 0x30, 0x80, 0x0, 0x45, 0x0, 0x88, 0x91,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+3048 "え" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x78,
+    0x10, 0x0, 0x0, 0x0, 0x5a, 0x40, 0x0, 0x0,
+    0x0, 0x6, 0x30, 0x0, 0x1, 0x47, 0x78, 0x90,
+    0x0, 0x6, 0x70, 0x1a, 0x0, 0x0, 0x0, 0x0,
+    0x91, 0x0, 0x0, 0x0, 0x7, 0x40, 0x0, 0x0,
+    0x0, 0x58, 0x86, 0x0, 0x0, 0x4, 0x80, 0xa,
+    0x0, 0x0, 0x4c, 0x0, 0xb, 0x34, 0x81, 0x31,
+    0x0, 0x2, 0x66, 0x30,
+
+    /* U+304A "お" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc2,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0x10, 0x1, 0x68,
+    0x10, 0x0, 0xa6, 0xb2, 0x0, 0xb8, 0x5, 0x9e,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0xa1, 0x89, 0x96,
+    0x0, 0x0, 0xc, 0x81, 0x0, 0x66, 0x0, 0x1a,
+    0xc0, 0x0, 0x0, 0xc0, 0x6, 0x3a, 0x2, 0x0,
+    0x39, 0x0, 0x8, 0xc1, 0x74, 0x4b, 0x20, 0x0,
+    0x1d, 0x0, 0x55, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+304B "か" */
+    0x0, 0x0, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0,
+    0x0, 0x0, 0x3, 0x5a, 0xc9, 0xc1, 0x6, 0x0,
+    0x9, 0x5b, 0x10, 0x76, 0x1, 0xb0, 0x0, 0x29,
+    0x0, 0x74, 0x0, 0x78, 0x0, 0x92, 0x0, 0xa1,
+    0x6, 0xc9, 0x3, 0x80, 0x0, 0xb0, 0x0, 0x62,
+    0xc, 0x4, 0x49, 0x60, 0x0, 0x0, 0x14, 0x0,
+    0xea, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+304C "が" */
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xa0, 0x0, 0x0,
+    0x82, 0x0, 0x76, 0x50, 0x0, 0x0, 0xb3, 0x0,
+    0x6, 0x0, 0x0, 0x1, 0xb1, 0x10, 0x20, 0x0,
+    0x17, 0x8c, 0xa6, 0xc2, 0x19, 0x10, 0x4, 0x2b,
+    0x0, 0x83, 0x2, 0xc0, 0x0, 0x47, 0x0, 0xa1,
+    0x0, 0x95, 0x0, 0xb0, 0x0, 0xb0, 0x18, 0xd6,
+    0x6, 0x60, 0x4, 0x70, 0x0, 0x81, 0x2c, 0x6,
+    0x6d, 0x20, 0x0, 0x0, 0x12, 0x0, 0xb5, 0x0,
+    0x0, 0x0,
+
+    /* U+304D "き" */
+    0x0, 0x10, 0x0, 0x0, 0x1, 0xe1, 0x0, 0x0,
+    0x0, 0x48, 0x6a, 0x20, 0x17, 0x8d, 0x40, 0x11,
+    0x0, 0x2, 0xa6, 0xa1, 0x4, 0x79, 0xb7, 0x0,
+    0x0, 0x0, 0xb, 0x10, 0x5, 0x99, 0x87, 0xb0,
+    0x97, 0x0, 0x17, 0xf4, 0xc0, 0x0, 0x0, 0x10,
+    0x69, 0x0, 0x1, 0x0, 0x5, 0xcc, 0xca, 0x0,
+
+    /* U+304E "ぎ" */
+    0x0, 0x0, 0x0, 0x0, 0x12, 0x0, 0x1c, 0x0,
+    0x0, 0x37, 0xb4, 0x0, 0x75, 0x2a, 0x40, 0xa1,
+    0x1, 0x36, 0xe7, 0x10, 0x0, 0x0, 0x3, 0x25,
+    0x54, 0xb2, 0x0, 0x0, 0x12, 0x6e, 0x80, 0x0,
+    0x0, 0x2, 0x42, 0x1a, 0x0, 0x0, 0x0, 0x26,
+    0x75, 0x69, 0x0, 0x0, 0x69, 0x32, 0x48, 0xe4,
+    0x0, 0xb, 0x0, 0x0, 0x1, 0x0, 0x0, 0x5a,
+    0x20, 0x26, 0x10, 0x0, 0x0, 0x4a, 0xca, 0x60,
+    0x0, 0x0,
+
+    /* U+304F "く" */
+    0x0, 0x1, 0x50, 0x0, 0x6, 0xe0, 0x0, 0x1c,
+    0x20, 0x1, 0xa1, 0x0, 0x9, 0x10, 0x0, 0x71,
+    0x0, 0x0, 0x46, 0x0, 0x0, 0x3, 0x91, 0x0,
+    0x0, 0x2d, 0x20, 0x0, 0x7, 0xd0, 0x0, 0x0,
+    0xe3, 0x0, 0x0, 0x30,
+
+    /* U+3050 "ぐ" */
+    0x0, 0x2, 0x20, 0x0, 0x0, 0x0, 0x8b, 0x0,
+    0x0, 0x0, 0x3c, 0x10, 0x8, 0x70, 0x1b, 0x10,
+    0xa, 0x34, 0x9, 0x0, 0x0, 0x23, 0x6, 0x0,
+    0x0, 0x0, 0x0, 0x55, 0x0, 0x0, 0x0, 0x0,
+    0x49, 0x0, 0x0, 0x0, 0x0, 0x5b, 0x0, 0x0,
+    0x0, 0x0, 0xaa, 0x0, 0x0, 0x0, 0x2, 0xf0,
+    0x0, 0x0, 0x0, 0x4, 0x0, 0x0,
+
+    /* U+3051 "け" */
+    0x0, 0x0, 0x0, 0x1, 0x20, 0x0, 0x2, 0xc0,
+    0x0, 0x1, 0xe0, 0x0, 0x2, 0xa0, 0x0, 0x0,
+    0xc0, 0x10, 0x6, 0x50, 0x4, 0x88, 0xea, 0x80,
+    0xa, 0x10, 0x0, 0x0, 0xb0, 0x0, 0xb, 0x0,
+    0x0, 0x0, 0xb0, 0x0, 0xb, 0x3, 0x0, 0x0,
+    0xb0, 0x0, 0xc, 0x43, 0x0, 0x2, 0x90, 0x0,
+    0xa, 0xd0, 0x0, 0x8, 0x40, 0x0, 0x2, 0xc0,
+    0x0, 0x39, 0x0, 0x0, 0x0, 0x0, 0x4, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+
+    /* U+3052 "げ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x15, 0x70, 0x18, 0x0, 0x0,
+    0x1b, 0x6, 0x77, 0x1, 0xe0, 0x0, 0x0, 0xd0,
+    0x4, 0x0, 0x48, 0x0, 0x0, 0x2d, 0x9a, 0x0,
+    0x8, 0x30, 0x5, 0x87, 0xd1, 0x0, 0x0, 0xa0,
+    0x0, 0x0, 0xb, 0x0, 0x0, 0xb, 0x0, 0x0,
+    0x0, 0xb0, 0x0, 0x0, 0xb0, 0x30, 0x0, 0xb,
+    0x0, 0x0, 0x8, 0x93, 0x0, 0x4, 0x70, 0x0,
+    0x0, 0x3f, 0x10, 0x0, 0xb1, 0x0, 0x0, 0x0,
+    0x40, 0x0, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x50, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+3053 "こ" */
+    0x0, 0x11, 0x1, 0x30, 0x0, 0x0, 0x68, 0xed,
+    0x20, 0x0, 0x0, 0x64, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10,
+    0x0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x0,
+    0x90, 0x0, 0x0, 0x0, 0x7, 0x95, 0x45, 0x7b,
+    0x60, 0x2, 0x67, 0x76, 0x20,
+
+    /* U+3054 "ご" */
+    0x0, 0x0, 0x0, 0x0, 0x36, 0x0, 0x10, 0x0,
+    0x10, 0x56, 0x72, 0x1, 0x69, 0xcf, 0x60, 0x90,
+    0x0, 0x0, 0x37, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xa4, 0x22, 0x48, 0x90, 0x0, 0x1,
+    0x69, 0xa9, 0x61, 0x0, 0x0,
+
+    /* U+3055 "さ" */
+    0x1, 0x50, 0x0, 0x0, 0x0, 0xb2, 0x0, 0x0,
+    0x0, 0x1b, 0x25, 0xb0, 0x7, 0x7b, 0xf6, 0x0,
+    0x1, 0x20, 0x49, 0x0, 0x0, 0x0, 0x9, 0x50,
+    0x19, 0x9a, 0xa9, 0xe0, 0xb1, 0x0, 0x3, 0xd2,
+    0xc0, 0x0, 0x0, 0x0, 0x4b, 0x42, 0x33, 0x0,
+    0x2, 0x7a, 0xa5, 0x0,
+
+    /* U+3056 "ざ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x14, 0x90, 0x0, 0xd3, 0x0, 0x3, 0xb5,
+    0x0, 0x1, 0xb1, 0x5, 0x53, 0x0, 0x0, 0x4,
+    0xca, 0x70, 0x0, 0x0, 0x36, 0x66, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0x60, 0x0, 0x0, 0x16,
+    0x75, 0x2d, 0x10, 0x0, 0x4a, 0x33, 0x59, 0xe7,
+    0x0, 0x9, 0x20, 0x0, 0x2, 0x30, 0x0, 0x4a,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5b, 0xbc, 0xc1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+3057 "し" */
+    0x0, 0x0, 0x0, 0x0, 0xb6, 0x0, 0x0, 0x0,
+    0x94, 0x0, 0x0, 0x0, 0x92, 0x0, 0x0, 0x0,
+    0xa1, 0x0, 0x0, 0x0, 0xa0, 0x0, 0x0, 0x0,
+    0xa0, 0x0, 0x0, 0x0, 0xa0, 0x0, 0x0, 0x0,
+    0xa1, 0x0, 0x0, 0x33, 0x75, 0x0, 0x7, 0x60,
+    0xc, 0x99, 0xc5, 0x0, 0x0, 0x22, 0x0, 0x0,
+
+    /* U+3058 "じ" */
+    0x20, 0x0, 0x0, 0x0, 0x98, 0x0, 0x6, 0x0,
+    0x85, 0x1, 0x74, 0x90, 0x83, 0x0, 0x56, 0x0,
+    0x92, 0x0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x0,
+    0xa1, 0x0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x0,
+    0x83, 0x0, 0x0, 0x34, 0x58, 0x0, 0x7, 0x70,
+    0xa, 0xba, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+3059 "す" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb0,
+    0x0, 0x0, 0x1, 0x13, 0x57, 0xd9, 0x9a, 0xa2,
+    0x8, 0x96, 0x30, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x69, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xa0, 0xb2,
+    0x0, 0x0, 0x0, 0x0, 0xa0, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x8a, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1a, 0x10,
+    0x0, 0x0, 0x0, 0x2, 0x60, 0x0, 0x0, 0x0,
+
+    /* U+305A "ず" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x50, 0x0,
+    0x0, 0x0, 0xe1, 0x0, 0x85, 0x80, 0x0, 0x0,
+    0x0, 0xb0, 0x0, 0x6, 0x0, 0x0, 0x2, 0x47,
+    0xd9, 0x9a, 0xa1, 0x0, 0x8, 0xa7, 0x41, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x68, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x90, 0x93, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x90, 0xa4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9a, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1b, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0x70,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+305B "せ" */
+    0x0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x91,
+    0x0, 0xd1, 0x0, 0x0, 0x9, 0x20, 0xb, 0x0,
+    0x0, 0x0, 0x93, 0x57, 0xda, 0xb6, 0x4a, 0x9c,
+    0x73, 0xa, 0x0, 0x0, 0x0, 0x91, 0x0, 0xb0,
+    0x0, 0x0, 0x8, 0x21, 0xb9, 0x0, 0x0, 0x0,
+    0x73, 0x2, 0x0, 0x0, 0x0, 0x3, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xab, 0xbb, 0x30,
+
+    /* U+305C "ぜ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x0, 0x0,
+    0x0, 0x0, 0x16, 0x7, 0x4a, 0x0, 0x3, 0x90,
+    0x0, 0xe0, 0x37, 0x0, 0x0, 0xb, 0x0, 0xb,
+    0x0, 0x0, 0x0, 0x0, 0xb4, 0x69, 0xda, 0xa2,
+    0x0, 0x9a, 0x9c, 0x52, 0xa, 0x0, 0x0, 0x0,
+    0x0, 0xa0, 0x2, 0x90, 0x0, 0x0, 0x0, 0xa,
+    0x2, 0xe4, 0x0, 0x0, 0x0, 0x0, 0xb0, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0x50, 0x0, 0x20,
+    0x0, 0x0, 0x0, 0x8, 0xbc, 0xca, 0x0, 0x0,
+
+    /* U+305D "そ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x47,
+    0xc4, 0x0, 0x0, 0x8a, 0x42, 0xc4, 0x0, 0x0,
+    0x0, 0x39, 0x10, 0x0, 0x0, 0x6, 0x60, 0x2,
+    0x30, 0x3, 0x85, 0x79, 0xc9, 0x70, 0x7e, 0x84,
+    0x48, 0x0, 0x0, 0x0, 0x1, 0x90, 0x0, 0x0,
+    0x0, 0x6, 0x30, 0x0, 0x0, 0x0, 0x5, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0xc7, 0x41, 0x0, 0x0,
+    0x0, 0x7, 0xa4, 0x0,
+
+    /* U+305E "ぞ" */
+    0x0, 0x0, 0x0, 0x30, 0x2, 0x40, 0x0, 0x23,
+    0x67, 0xe6, 0x36, 0x66, 0x0, 0x86, 0x18, 0x70,
+    0x8, 0x30, 0x0, 0x1, 0x93, 0x0, 0x0, 0x0,
+    0x0, 0x28, 0x0, 0x25, 0x71, 0x0, 0x6, 0x97,
+    0x7c, 0xa5, 0x41, 0x0, 0x6a, 0x40, 0x75, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0x20, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9c, 0x93,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x61, 0x0, 0x0,
+
+    /* U+305F "た" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0x0,
+    0x0, 0x0, 0x0, 0x48, 0x14, 0x0, 0x0, 0x24,
+    0x9c, 0xa3, 0x0, 0x10, 0x14, 0xb1, 0x2, 0x77,
+    0xf5, 0x0, 0xb0, 0x0, 0x17, 0x30, 0x2, 0x90,
+    0x0, 0x0, 0x0, 0x7, 0x30, 0x0, 0x0, 0x0,
+    0xb, 0x0, 0x60, 0x0, 0x0, 0x67, 0x0, 0x80,
+    0x0, 0x0, 0x90, 0x0, 0x39, 0xab, 0xc5, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+3060 "だ" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x10, 0x0, 0x6,
+    0x70, 0x0, 0x43, 0xb2, 0x0, 0x7, 0x53, 0x20,
+    0xb, 0x20, 0x3, 0x3b, 0xb7, 0x0, 0x1, 0x0,
+    0x2, 0x5c, 0x0, 0x47, 0x8e, 0x10, 0x0, 0xa,
+    0x0, 0x2, 0x73, 0x0, 0x0, 0x56, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x91, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb0, 0x5, 0x0, 0x0, 0x0, 0x7, 0x50,
+    0x19, 0x0, 0x0, 0x0, 0xa, 0x0, 0x4, 0xaa,
+    0xbc, 0x10,
+
+    /* U+3061 "ち" */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0xc, 0x30,
+    0x0, 0x0, 0x0, 0xb, 0x3, 0x71, 0x0, 0x28,
+    0xad, 0x86, 0x30, 0x0, 0x0, 0x54, 0x0, 0x0,
+    0x0, 0x0, 0xa0, 0x48, 0x99, 0x20, 0x1, 0xc9,
+    0x40, 0x2, 0xd0, 0x2, 0xd1, 0x0, 0x0, 0xb2,
+    0x0, 0x0, 0x0, 0x1, 0xd0, 0x0, 0x0, 0x0,
+    0x3b, 0x30, 0x0, 0x0, 0x46, 0x40, 0x0,
+
+    /* U+3063 "っ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x78, 0x78,
+    0x80, 0xb, 0x71, 0x0, 0x7, 0x40, 0x0, 0x0,
+    0x0, 0x47, 0x0, 0x0, 0x0, 0x8, 0x30, 0x0,
+    0x0, 0x7, 0x70, 0x0, 0x4, 0x67, 0x20, 0x0,
+
+    /* U+3064 "つ" */
+    0x0, 0x0, 0x17, 0x99, 0x81, 0x0, 0x36, 0xa8,
+    0x20, 0x1, 0xb3, 0xb, 0x70, 0x0, 0x0, 0x3,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0xb3, 0x0, 0x0, 0x0, 0x2, 0xb5, 0x0, 0x0,
+    0x3, 0x68, 0x81, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+3065 "づ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x72, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0x39, 0x0, 0x0, 0x37, 0x89,
+    0x61, 0x60, 0x14, 0x8a, 0x50, 0x0, 0x4a, 0x0,
+    0x2a, 0x30, 0x0, 0x0, 0xb, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x68, 0x0,
+    0x0, 0x0, 0x0, 0x18, 0x80, 0x0, 0x0, 0x3,
+    0x68, 0x72, 0x0, 0x0,
+
+    /* U+3066 "て" */
+    0x0, 0x0, 0x0, 0x36, 0x82, 0x35, 0x78, 0x87,
+    0xbc, 0x83, 0x46, 0x30, 0x9, 0x30, 0x0, 0x0,
+    0x0, 0x92, 0x0, 0x0, 0x0, 0x4, 0x60, 0x0,
+    0x0, 0x0, 0x9, 0x10, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0x40, 0x0, 0x0,
+    0x0, 0x1, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x1a,
+    0xd7, 0x0,
+
+    /* U+3067 "で" */
+    0x0, 0x0, 0x0, 0x26, 0x89, 0x10, 0x3, 0x47,
+    0x98, 0x7c, 0x85, 0x10, 0x8, 0x73, 0x2, 0xb2,
+    0x2, 0x0, 0x0, 0x0, 0x1b, 0x10, 0x33, 0xa0,
+    0x0, 0x0, 0x93, 0x0, 0x49, 0x40, 0x0, 0x0,
+    0xc0, 0x0, 0x3, 0x0, 0x0, 0x1, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6a, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xde, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+3068 "と" */
+    0x0, 0x20, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x40,
+    0x0, 0x92, 0x3b, 0xb0, 0x0, 0x5d, 0x71, 0x0,
+    0x9, 0x80, 0x0, 0x0, 0x66, 0x0, 0x0, 0x0,
+    0xa0, 0x0, 0x0, 0x0, 0x77, 0x0, 0x0, 0x20,
+    0x7, 0xbc, 0xcd, 0xc3, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+3069 "ど" */
+    0x0, 0x10, 0x0, 0x0, 0x20, 0x0, 0x8, 0x70,
+    0x0, 0x43, 0xb0, 0x0, 0x65, 0x0, 0x3, 0x94,
+    0x0, 0x5, 0x50, 0x3, 0x11, 0x0, 0x0, 0x28,
+    0x19, 0xd4, 0x0, 0x0, 0x1, 0xda, 0x30, 0x0,
+    0x0, 0x3, 0xb3, 0x0, 0x0, 0x0, 0x0, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xc1, 0x0, 0x0, 0x10, 0x0, 0x3,
+    0xab, 0xbc, 0xd9, 0x0, 0x0,
+
+    /* U+306A "な" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x82, 0x41, 0x0,
+    0x0, 0x6, 0x8c, 0x96, 0x5, 0x30, 0x0, 0x8,
+    0x10, 0x0, 0x2b, 0x60, 0x2, 0x80, 0x0, 0x96,
+    0x56, 0x1, 0xb0, 0x0, 0x9, 0x0, 0x0, 0xb4,
+    0x0, 0x1, 0x90, 0x0, 0x3, 0x0, 0x67, 0x59,
+    0x0, 0x0, 0x0, 0x92, 0x4, 0xe6, 0x0, 0x0,
+    0x9, 0x42, 0x94, 0xa5, 0x0, 0x0, 0x5, 0x73,
+    0x0, 0x20,
+
+    /* U+306B "に" */
+    0x26, 0x0, 0x24, 0x6a, 0x50, 0x2c, 0x0, 0x23,
+    0x78, 0x20, 0x65, 0x0, 0x1, 0x30, 0x0, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0xb0, 0x13, 0x0, 0x0, 0x0, 0xb6, 0x7,
+    0x0, 0x0, 0x0, 0x7d, 0x6, 0x50, 0x0, 0x30,
+    0x8, 0x0, 0x6a, 0xbc, 0x90,
+
+    /* U+306C "ぬ" */
+    0x0, 0x0, 0x5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x0, 0x0, 0xa, 0x20, 0x3d, 0x88,
+    0x70, 0x0, 0x6, 0x48, 0x87, 0x0, 0x39, 0x0,
+    0x3, 0xc2, 0x72, 0x0, 0xa, 0x10, 0x8, 0xa0,
+    0x90, 0x0, 0x8, 0x30, 0x18, 0x69, 0x40, 0x0,
+    0xa, 0x0, 0x53, 0xe, 0x32, 0xa9, 0xac, 0x0,
+    0x46, 0x92, 0x56, 0x41, 0xa8, 0xb0, 0x6, 0x10,
+    0x0, 0x78, 0x20, 0x40,
+
+    /* U+306D "ね" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0x5, 0x98, 0xa5, 0x0,
+    0x29, 0x99, 0x84, 0x0, 0xa, 0x10, 0x1, 0x8d,
+    0x10, 0x0, 0x7, 0x40, 0x0, 0xc8, 0x0, 0x0,
+    0x6, 0x50, 0x7, 0x48, 0x0, 0x1, 0x9, 0x20,
+    0x2b, 0x8, 0x3, 0xb8, 0xae, 0x30, 0x84, 0x99,
+    0x7, 0x40, 0x88, 0xa7, 0x0, 0x76, 0x1, 0x9a,
+    0x40, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+306E "の" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28,
+    0xa9, 0x99, 0x10, 0x0, 0x69, 0x16, 0x0, 0x2c,
+    0x10, 0x48, 0x0, 0x80, 0x0, 0x58, 0xb, 0x0,
+    0x9, 0x0, 0x1, 0xc1, 0x90, 0x0, 0x90, 0x0,
+    0xc, 0x36, 0x0, 0x19, 0x0, 0x0, 0xb2, 0x70,
+    0x8, 0x30, 0x0, 0x57, 0xb, 0x15, 0x80, 0x0,
+    0x2b, 0x0, 0x3a, 0x70, 0x0, 0x69, 0x10, 0x0,
+    0x0, 0x2, 0x52, 0x0, 0x0,
+
+    /* U+306F "は" */
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x24, 0x0,
+    0x1, 0xe0, 0x0, 0x4, 0xa0, 0x0, 0xb, 0x0,
+    0x0, 0x64, 0x0, 0x1, 0xc8, 0x90, 0xa, 0x0,
+    0x16, 0x7c, 0x10, 0x0, 0xa0, 0x0, 0x0, 0xa0,
+    0x0, 0x18, 0x0, 0x0, 0xa, 0x0, 0x3, 0x73,
+    0x0, 0x0, 0xa0, 0x0, 0x3b, 0x51, 0xa8, 0x9d,
+    0x30, 0x0, 0xe3, 0x55, 0x2, 0xaa, 0x70, 0x3,
+    0x1, 0xb9, 0xa1, 0x4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+3070 "ば" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x60, 0x5, 0x0,
+    0x0, 0x92, 0x7, 0x49, 0xd, 0x0, 0x0, 0xa1,
+    0x2, 0x70, 0x19, 0x0, 0x0, 0x94, 0x92, 0x0,
+    0x45, 0x0, 0x68, 0xd5, 0x10, 0x0, 0x72, 0x0,
+    0x0, 0x90, 0x0, 0x0, 0x90, 0x0, 0x0, 0x90,
+    0x0, 0x0, 0x93, 0x0, 0x0, 0x90, 0x0, 0x0,
+    0xa7, 0x5, 0x88, 0xd2, 0x0, 0x0, 0x97, 0xb,
+    0x0, 0xaa, 0x70, 0x0, 0x33, 0x9, 0x9a, 0x50,
+    0x80, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+3071 "ぱ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x45, 0x0, 0x5,
+    0x0, 0x0, 0xa1, 0x6, 0x42, 0x0, 0xd0, 0x0,
+    0xa, 0x0, 0x66, 0x0, 0x28, 0x0, 0x0, 0xa5,
+    0x92, 0x0, 0x5, 0x40, 0x6, 0x8c, 0x40, 0x0,
+    0x0, 0x80, 0x0, 0x0, 0x90, 0x0, 0x0, 0x9,
+    0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x93, 0x0,
+    0x0, 0x90, 0x0, 0x0, 0xa, 0x70, 0x78, 0x8d,
+    0x30, 0x0, 0x0, 0x96, 0xa, 0x0, 0xb9, 0x80,
+    0x0, 0x2, 0x20, 0x89, 0xa4, 0x5, 0x0, 0x0,
+
+    /* U+3072 "ひ" */
+    0x0, 0x4, 0x60, 0x1, 0x20, 0x0, 0x1b, 0x99,
+    0xb0, 0x6, 0xd0, 0x0, 0x0, 0x2a, 0x0, 0x3,
+    0xd3, 0x0, 0x0, 0xa1, 0x0, 0x2, 0x89, 0x0,
+    0x3, 0x70, 0x0, 0x3, 0x7a, 0x50, 0x8, 0x20,
+    0x0, 0x6, 0x51, 0xa0, 0xa, 0x0, 0x0, 0xa,
+    0x10, 0x0, 0x8, 0x30, 0x0, 0x2a, 0x0, 0x0,
+    0x2, 0xa0, 0x1, 0xc2, 0x0, 0x0, 0x0, 0x5b,
+    0xaa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+3073 "び" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x60, 0x0, 0x17,
+    0x30, 0x2, 0x8, 0x55, 0x5b, 0x7d, 0x60, 0xc,
+    0x61, 0x60, 0x0, 0x76, 0x0, 0xa, 0x90, 0x0,
+    0x2, 0xa0, 0x0, 0xa, 0x83, 0x0, 0x9, 0x20,
+    0x0, 0xa, 0x1c, 0x0, 0xb, 0x0, 0x0, 0xb,
+    0x5, 0x70, 0xa, 0x0, 0x0, 0x1a, 0x0, 0x0,
+    0xb, 0x0, 0x0, 0x84, 0x0, 0x0, 0x9, 0x30,
+    0x5, 0xa0, 0x0, 0x0, 0x1, 0xbb, 0xb8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+3074 "ぴ" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x50, 0x0, 0x16,
+    0x30, 0x2, 0x5, 0x5, 0x4b, 0x8c, 0x70, 0xa,
+    0x72, 0x51, 0x0, 0x67, 0x0, 0x8, 0xa0, 0x0,
+    0x1, 0xa0, 0x0, 0x7, 0x94, 0x0, 0x8, 0x30,
+    0x0, 0x8, 0x2c, 0x10, 0xb, 0x0, 0x0, 0xb,
+    0x4, 0x70, 0xb, 0x0, 0x0, 0xb, 0x0, 0x0,
+    0xb, 0x0, 0x0, 0x67, 0x0, 0x0, 0x9, 0x40,
+    0x3, 0xc0, 0x0, 0x0, 0x1, 0xba, 0xba, 0x10,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+3075 "ふ" */
+    0x0, 0x2, 0x20, 0x0, 0x0, 0x0, 0x0, 0x94,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0x30, 0x0, 0x0,
+    0x1, 0xa2, 0x0, 0x0, 0x0, 0x4, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x46, 0x3, 0x70, 0x21, 0x60, 0xb, 0x0, 0x78,
+    0xba, 0x12, 0xb, 0x0, 0xa, 0x30, 0x5, 0x95,
+    0x0, 0x0,
+
+    /* U+3076 "ぶ" */
+    0x0, 0x0, 0x20, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x9, 0x30, 0x22, 0xa1, 0x0, 0x0, 0x5, 0xf0,
+    0xb, 0x30, 0x0, 0x0, 0x57, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x50,
+    0x53, 0x0, 0x10, 0x34, 0x0, 0xb0, 0xb, 0x40,
+    0x3c, 0x70, 0x20, 0xb0, 0x2, 0x90, 0x4, 0x0,
+    0x38, 0x30, 0x0, 0x0,
+
+    /* U+3077 "ぷ" */
+    0x0, 0x0, 0x30, 0x0, 0x4, 0x10, 0x0, 0x0,
+    0xa3, 0x2, 0x26, 0x0, 0x0, 0x7, 0xf0, 0x5,
+    0x40, 0x0, 0x7, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x2, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0x40, 0x64, 0x1, 0x3,
+    0x50, 0xa, 0x0, 0xb4, 0x4c, 0x62, 0x0, 0xb0,
+    0x3, 0x71, 0x40, 0x8, 0x93, 0x0, 0x0,
+
+    /* U+3078 "へ" */
+    0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x69, 0x0, 0x0, 0x0, 0x0, 0x85, 0x2, 0x80,
+    0x0, 0x0, 0x1a, 0x80, 0x0, 0x57, 0x0, 0x0,
+    0x13, 0x0, 0x0, 0x8, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+3079 "べ" */
+    0x0, 0x0, 0x0, 0x0, 0x6, 0x10, 0x0, 0x0,
+    0x20, 0x1, 0x94, 0x80, 0x0, 0x8, 0x69, 0x0,
+    0x25, 0x0, 0x0, 0x83, 0x2, 0x80, 0x0, 0x0,
+    0x19, 0x60, 0x0, 0x56, 0x0, 0x0, 0x15, 0x0,
+    0x0, 0x8, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+307A "ぺ" */
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x20, 0x0, 0x52, 0x40, 0x0, 0x7, 0x69, 0x0,
+    0x35, 0x10, 0x0, 0x75, 0x2, 0x90, 0x0, 0x0,
+    0x19, 0x70, 0x0, 0x56, 0x0, 0x0, 0x14, 0x0,
+    0x0, 0x8, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+307B "ほ" */
+    0x3, 0x0, 0x0, 0x1, 0x10, 0xe, 0x0, 0x58,
+    0xc8, 0x40, 0xa, 0x0, 0x0, 0xc0, 0x0, 0x46,
+    0x0, 0x0, 0xa0, 0x30, 0x72, 0x0, 0x68, 0xda,
+    0x70, 0x90, 0x0, 0x0, 0x90, 0x0, 0x91, 0x0,
+    0x0, 0x90, 0x0, 0xa6, 0x0, 0x20, 0x90, 0x0,
+    0x98, 0x1a, 0x68, 0xe4, 0x0, 0x34, 0x45, 0x3,
+    0x98, 0x80, 0x0, 0xa, 0xbb, 0x10, 0x30,
+
+    /* U+307C "ぼ" */
+    0x1, 0x0, 0x0, 0x1, 0x20, 0x0, 0x0, 0xc0,
+    0x5, 0x8c, 0x84, 0x4, 0x0, 0xa, 0x0, 0x0,
+    0xc0, 0x6, 0x3a, 0x3, 0x60, 0x0, 0xa, 0x0,
+    0x28, 0x0, 0x63, 0x0, 0x11, 0xb7, 0x92, 0x0,
+    0x7, 0x10, 0x3, 0x6c, 0x30, 0x0, 0x0, 0x91,
+    0x0, 0x0, 0xa0, 0x0, 0x0, 0x9, 0x60, 0x0,
+    0xa, 0x0, 0x0, 0x0, 0x7a, 0x7, 0x77, 0xd2,
+    0x0, 0x0, 0x2, 0x72, 0x60, 0xb, 0x98, 0x0,
+    0x0, 0x0, 0x9, 0x89, 0x40, 0x50, 0x0, 0x0,
+
+    /* U+307D "ぽ" */
+    0x1, 0x0, 0x0, 0x1, 0x20, 0x0, 0xc, 0x0,
+    0x58, 0xc8, 0x42, 0x83, 0xa, 0x0, 0x0, 0xc0,
+    0x4, 0x6, 0x36, 0x0, 0x0, 0xa0, 0x0, 0x40,
+    0x63, 0x0, 0x11, 0xb7, 0x92, 0x0, 0x71, 0x0,
+    0x36, 0xc3, 0x0, 0x0, 0x90, 0x0, 0x0, 0xa0,
+    0x0, 0x0, 0x96, 0x0, 0x0, 0xa0, 0x0, 0x0,
+    0x7a, 0x7, 0x77, 0xd2, 0x0, 0x0, 0x28, 0x26,
+    0x0, 0xba, 0x70, 0x0, 0x0, 0x9, 0x89, 0x40,
+    0x60, 0x0,
+
+    /* U+307E "ま" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xb0, 0x0,
+    0x0, 0x0, 0xb0, 0x21, 0x2, 0x67, 0xda, 0x81,
+    0x0, 0x1, 0xa0, 0x0, 0x0, 0x0, 0xb5, 0x80,
+    0x2, 0x79, 0xd4, 0x0, 0x0, 0x0, 0xa0, 0x0,
+    0x7, 0x88, 0xb0, 0x0, 0x82, 0x3, 0xcb, 0x20,
+    0x67, 0x3b, 0x22, 0xd3, 0x4, 0x62, 0x0, 0x12,
+
+    /* U+307F "み" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x46,
+    0x8d, 0x50, 0x0, 0x0, 0x3, 0x20, 0xc1, 0x0,
+    0x0, 0x0, 0x0, 0x56, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x0, 0x43, 0x0, 0x2, 0x6a, 0x92, 0x7,
+    0x60, 0x7, 0x63, 0xa2, 0x7a, 0xc0, 0x3, 0x70,
+    0xa1, 0x0, 0x4c, 0xb0, 0x53, 0x84, 0x0, 0x1a,
+    0x5, 0x61, 0x84, 0x0, 0x19, 0x10, 0x0, 0x0,
+    0x0, 0x15, 0x0, 0x0, 0x0,
+
+    /* U+3080 "む" */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0x78, 0x0, 0x71,
+    0x0, 0x37, 0xc2, 0x0, 0x1, 0xc0, 0x0, 0x3a,
+    0x0, 0x0, 0x6, 0x10, 0x80, 0xc0, 0x0, 0x0,
+    0x0, 0x26, 0x1d, 0x0, 0x0, 0x0, 0x1, 0xcd,
+    0x80, 0x0, 0x5, 0x0, 0x0, 0x82, 0x0, 0x0,
+    0x57, 0x0, 0x9, 0x40, 0x2, 0x6c, 0x50, 0x0,
+    0x6, 0x99, 0x84, 0x0, 0x0,
+
+    /* U+3081 "め" */
+    0x0, 0x0, 0x0, 0x71, 0x0, 0x0, 0x1d, 0x0,
+    0xb, 0x10, 0x0, 0x0, 0xa1, 0x28, 0xd7, 0x30,
+    0x0, 0x5, 0xb6, 0x38, 0x18, 0x80, 0x0, 0x99,
+    0x7, 0x20, 0x9, 0x30, 0x73, 0x82, 0x90, 0x0,
+    0x56, 0xa, 0x1, 0xd2, 0x0, 0x7, 0x40, 0x90,
+    0x5a, 0x60, 0x0, 0xb0, 0xa, 0xa6, 0x0, 0x1,
+    0x92, 0x0, 0x0, 0x0, 0x15, 0x60, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x0,
+
+    /* U+3082 "も" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x1e, 0x0, 0x0,
+    0x0, 0x1a, 0x0, 0x0, 0x3, 0x46, 0x0, 0x0,
+    0x3, 0xca, 0x80, 0x0, 0x0, 0xa0, 0x0, 0x0,
+    0x20, 0xa0, 0x0, 0x20, 0x29, 0xd9, 0x80, 0x24,
+    0x1, 0x90, 0x0, 0x25, 0x0, 0xa0, 0x0, 0x63,
+    0x0, 0xa4, 0x3, 0xa0, 0x0, 0x7, 0x97, 0x0,
+
+    /* U+3083 "ゃ" */
+    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x30, 0x38,
+    0x0, 0x0, 0x0, 0xa0, 0x1a, 0x87, 0x10, 0x0,
+    0x87, 0x94, 0x2, 0xc0, 0x17, 0xa9, 0x3, 0x0,
+    0xc0, 0x13, 0x9, 0x12, 0x89, 0x30, 0x0, 0x2,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x40, 0x0, 0x0,
+
+    /* U+3084 "や" */
+    0x0, 0x0, 0x2, 0x60, 0x0, 0x0, 0x0, 0xa3,
+    0x3, 0xc3, 0x0, 0x0, 0x0, 0x74, 0x3, 0xb9,
+    0x99, 0xa0, 0x0, 0xc, 0xa6, 0x0, 0x0, 0x74,
+    0x3, 0xab, 0x40, 0x10, 0x0, 0x93, 0x49, 0x10,
+    0xb0, 0x37, 0x57, 0xa0, 0x0, 0x0, 0x84, 0x0,
+    0x32, 0x0, 0x0, 0x0, 0x2b, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0x50, 0x0, 0x0, 0x0, 0x0, 0x1, 0x10,
+    0x0, 0x0,
+
+    /* U+3085 "ゅ" */
+    0x0, 0x3, 0x60, 0x0, 0x65, 0x3, 0xd8, 0x40,
+    0x91, 0x85, 0x72, 0x84, 0x95, 0x50, 0x72, 0x29,
+    0xaa, 0x30, 0x90, 0x19, 0x97, 0x17, 0x90, 0x84,
+    0x22, 0x7, 0xb9, 0x50, 0x0, 0x45, 0x0, 0x0,
+
+    /* U+3086 "ゆ" */
+    0x0, 0x0, 0x49, 0x10, 0x0, 0x2, 0x30, 0x0,
+    0x49, 0x10, 0x0, 0x39, 0x2, 0xa8, 0xc8, 0x90,
+    0x6, 0x52, 0xa1, 0xa, 0x3, 0x90, 0x91, 0xa0,
+    0x0, 0xa0, 0xc, 0xa, 0x55, 0x30, 0xa, 0x0,
+    0xc0, 0xba, 0x6, 0x3, 0x70, 0xb, 0x9, 0xa0,
+    0x18, 0x83, 0x9, 0x50, 0x26, 0x0, 0x4e, 0x9a,
+    0x40, 0x0, 0x0, 0x2a, 0x20, 0x0, 0x0, 0x0,
+    0x14, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+3087 "ょ" */
+    0x0, 0xa, 0x20, 0x0, 0x0, 0xb3, 0x31, 0x0,
+    0xa, 0x66, 0x10, 0x0, 0xb0, 0x0, 0x0, 0xb,
+    0x0, 0x0, 0x67, 0xe9, 0x30, 0x37, 0x1c, 0x1a,
+    0x0, 0xce, 0x40, 0x0,
+
+    /* U+3088 "よ" */
+    0x0, 0xa, 0x20, 0x0, 0x0, 0xa, 0x20, 0x0,
+    0x0, 0xa, 0x8a, 0x80, 0x0, 0xa, 0x0, 0x0,
+    0x0, 0xa, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0,
+    0x39, 0x9d, 0x81, 0x0, 0xa0, 0xa, 0x3c, 0x10,
+    0x7a, 0xa3, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+3089 "ら" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x10, 0x0,
+    0x0, 0x3, 0xc6, 0x0, 0x2, 0x93, 0x58, 0x0,
+    0x9, 0x0, 0x0, 0x0, 0x18, 0x0, 0x21, 0x0,
+    0x57, 0x98, 0x68, 0xb1, 0xac, 0x10, 0x0, 0x39,
+    0x40, 0x0, 0x0, 0x2a, 0x0, 0x0, 0x0, 0x94,
+    0x0, 0x13, 0x79, 0x50, 0x1, 0x33, 0x10, 0x0,
+
+    /* U+308A "り" */
+    0x0, 0x0, 0x0, 0x7, 0x60, 0x68, 0x10, 0x83,
+    0x93, 0x39, 0xa, 0x66, 0x0, 0xc0, 0xab, 0x0,
+    0xb, 0xc, 0x70, 0x0, 0xb0, 0xd2, 0x0, 0xb,
+    0x5, 0x0, 0x3, 0x70, 0x0, 0x0, 0x91, 0x0,
+    0x0, 0x47, 0x0, 0x0, 0x27, 0x0, 0x0, 0x14,
+    0x0, 0x0,
+
+    /* U+308B "る" */
+    0x0, 0x0, 0x5a, 0x20, 0x0, 0x7a, 0x83, 0xb5,
+    0x0, 0x0, 0x0, 0x85, 0x0, 0x0, 0x0, 0x75,
+    0x0, 0x0, 0x0, 0x66, 0x23, 0x10, 0x0, 0x6e,
+    0x85, 0x5a, 0x70, 0x9b, 0x10, 0x0, 0xc, 0x7,
+    0x3, 0x40, 0x0, 0xb1, 0x2, 0xa4, 0x80, 0x2b,
+    0x0, 0xb, 0x46, 0x9b, 0x10, 0x0, 0x15, 0x63,
+    0x0, 0x0,
+
+    /* U+308C "れ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x46,
+    0x0, 0x0, 0x0, 0xc, 0x29, 0x66, 0x50, 0x0,
+    0x18, 0x8d, 0x91, 0x4, 0x60, 0x0, 0x0, 0x6c,
+    0x0, 0x6, 0x40, 0x0, 0x0, 0xc9, 0x0, 0x8,
+    0x10, 0x0, 0x5, 0x79, 0x0, 0xa, 0x0, 0x0,
+    0xc, 0x9, 0x0, 0x9, 0x0, 0x12, 0x66, 0x9a,
+    0x0, 0x9, 0x35, 0x70, 0x10, 0x68, 0x0, 0x1,
+    0x63, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+308D "ろ" */
+    0x0, 0x0, 0x36, 0x90, 0x0, 0x0, 0x89, 0x43,
+    0xd1, 0x0, 0x0, 0x0, 0x1a, 0x0, 0x0, 0x0,
+    0x1, 0x90, 0x0, 0x0, 0x0, 0x1a, 0x57, 0x74,
+    0x0, 0x2, 0xda, 0x40, 0x15, 0xa0, 0x2d, 0x40,
+    0x0, 0x0, 0x92, 0x11, 0x0, 0x0, 0x0, 0xa1,
+    0x0, 0x0, 0x0, 0x3, 0xa0, 0x0, 0x2, 0x56,
+    0x88, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+308F "わ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0xb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x30, 0x34, 0x30, 0x0,
+    0x4, 0x8d, 0x79, 0x54, 0x6a, 0x10, 0x4, 0x1e,
+    0x70, 0x0, 0x2, 0xa0, 0x0, 0x8e, 0x0, 0x0,
+    0x0, 0xb0, 0x2, 0xba, 0x0, 0x0, 0x0, 0xa0,
+    0xb, 0x2a, 0x0, 0x0, 0x2, 0x80, 0x2b, 0x7b,
+    0x0, 0x0, 0x29, 0x0, 0x1, 0x2d, 0x0, 0x4,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+3092 "を" */
+    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0xb2,
+    0x0, 0x0, 0x1, 0x1, 0xa1, 0x64, 0x0, 0x2,
+    0x8d, 0xa8, 0x40, 0x0, 0x0, 0x47, 0x0, 0x0,
+    0x0, 0x1, 0xd8, 0x93, 0x0, 0x87, 0xd, 0x60,
+    0xb, 0x7a, 0x51, 0x14, 0x0, 0x8d, 0x30, 0x0,
+    0x0, 0x2a, 0x3a, 0x0, 0x0, 0x0, 0xa1, 0x16,
+    0x0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x0, 0x0,
+    0x2a, 0xaa, 0xba, 0x0,
+
+    /* U+3093 "ん" */
+    0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0xa2, 0x0, 0x0,
+    0x0, 0x0, 0x29, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0x10, 0x0, 0x0, 0x0, 0x2, 0x98, 0xa5, 0x0,
+    0x0, 0x0, 0x9c, 0x20, 0xa0, 0x0, 0x20, 0x2f,
+    0x20, 0xa, 0x0, 0x6, 0xa, 0x70, 0x0, 0xb0,
+    0x7, 0x11, 0xd0, 0x0, 0xb, 0x58, 0x50, 0x1,
+    0x0, 0x0, 0x15, 0x10, 0x0,
+
+    /* U+30A1 "ァ" */
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x46, 0x77, 0xc5,
+    0x7, 0x62, 0x4, 0xa2, 0x0, 0x4, 0x74, 0x0,
+    0x0, 0x6, 0x60, 0x0, 0x0, 0xa, 0x20, 0x0,
+    0x0, 0x1a, 0x0, 0x0, 0x0, 0x91, 0x0, 0x0,
+    0x4, 0x10, 0x0, 0x0,
+
+    /* U+30A2 "ア" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14,
+    0x78, 0xe6, 0x1c, 0xb8, 0x62, 0x4, 0xd3, 0x1,
+    0x0, 0x0, 0x3a, 0x0, 0x0, 0x0, 0x5a, 0x50,
+    0x0, 0x0, 0x0, 0x76, 0x0, 0x0, 0x0, 0x0,
+    0xb1, 0x0, 0x0, 0x0, 0x2, 0xa0, 0x0, 0x0,
+    0x0, 0xa, 0x30, 0x0, 0x0, 0x0, 0x48, 0x0,
+    0x0, 0x0, 0x1, 0x90, 0x0, 0x0, 0x0, 0x3,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+30A3 "ィ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb3,
+    0x0, 0x0, 0x6, 0xa0, 0x0, 0x0, 0x69, 0x0,
+    0x0, 0x8, 0x8a, 0x0, 0x2, 0x72, 0xa, 0x0,
+    0x1, 0x0, 0x9, 0x0, 0x0, 0x0, 0x1a, 0x0,
+    0x0, 0x0, 0x19, 0x0, 0x0, 0x0, 0x1, 0x0,
+
+    /* U+30A4 "イ" */
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x2,
+    0xe0, 0x0, 0x0, 0x0, 0xb5, 0x0, 0x0, 0x0,
+    0x95, 0x0, 0x0, 0x0, 0x99, 0x0, 0x0, 0x1,
+    0xa5, 0xd0, 0x0, 0x5, 0x71, 0xb, 0x0, 0x3,
+    0x10, 0x0, 0xa0, 0x0, 0x0, 0x0, 0xa, 0x0,
+    0x0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x0, 0x1b,
+    0x0, 0x0, 0x0, 0x0, 0x60, 0x0,
+
+    /* U+30A6 "ウ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd2,
+    0x0, 0x0, 0x0, 0x0, 0xa2, 0x25, 0x80, 0x29,
+    0x89, 0xa8, 0x63, 0xe3, 0xb, 0x0, 0x0, 0x4,
+    0x90, 0xc, 0x0, 0x0, 0xb, 0x10, 0xd, 0x0,
+    0x0, 0x66, 0x0, 0x2, 0x0, 0x2, 0xa0, 0x0,
+    0x0, 0x0, 0xb, 0x10, 0x0, 0x0, 0x0, 0x92,
+    0x0, 0x0, 0x0, 0x17, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+30A7 "ェ" */
+    0x0, 0x12, 0x36, 0x91, 0x0, 0x7, 0x7c, 0x40,
+    0x0, 0x0, 0x0, 0x92, 0x0, 0x0, 0x0, 0x9,
+    0x10, 0x0, 0x2, 0x45, 0xc9, 0xab, 0x50, 0x56,
+    0x42, 0x0, 0x0,
+
+    /* U+30A8 "エ" */
+    0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x7, 0x89,
+    0xa9, 0x97, 0x0, 0x0, 0x22, 0xd, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa0, 0x0,
+    0x0, 0x7, 0x78, 0x9c, 0x99, 0xaa, 0x70, 0x44,
+    0x10, 0x0, 0x0, 0x0,
+
+    /* U+30AA "オ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x30, 0x0, 0x0, 0x0, 0x0, 0x92, 0x0,
+    0x0, 0x0, 0x0, 0x2a, 0x68, 0xa3, 0x4, 0xb9,
+    0x89, 0xf2, 0x10, 0x0, 0x0, 0x1, 0xb9, 0x10,
+    0x0, 0x0, 0x0, 0xb2, 0x91, 0x0, 0x0, 0x0,
+    0xa3, 0x9, 0x10, 0x0, 0x0, 0x92, 0x0, 0x91,
+    0x0, 0x2, 0x60, 0x1, 0x19, 0x20, 0x0, 0x0,
+    0x0, 0x9, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0x0, 0x0,
+
+    /* U+30AB "カ" */
+    0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0x37, 0x90, 0x7,
+    0x99, 0xba, 0x52, 0xe1, 0x2, 0x20, 0xb0, 0x2,
+    0xa0, 0x0, 0x2, 0x90, 0x6, 0x60, 0x0, 0xa,
+    0x10, 0xb, 0x10, 0x0, 0x65, 0x0, 0x1c, 0x0,
+    0x4, 0x70, 0x9, 0xa7, 0x0, 0x14, 0x0, 0x3,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+30AC "ガ" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x50, 0x0, 0x0,
+    0x9, 0x30, 0x54, 0x92, 0x0, 0x0, 0xb, 0x30,
+    0xb, 0x0, 0x0, 0x0, 0xc, 0x4, 0x81, 0x0,
+    0x3, 0x68, 0x9d, 0x85, 0xb6, 0x0, 0x0, 0x41,
+    0x56, 0x0, 0xb1, 0x0, 0x0, 0x0, 0xb1, 0x0,
+    0xb0, 0x0, 0x0, 0x3, 0x80, 0x4, 0x70, 0x0,
+    0x0, 0xa, 0x0, 0x9, 0x20, 0x0, 0x0, 0x82,
+    0x6, 0x6c, 0x0, 0x0, 0x4, 0x10, 0x1, 0xe5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+30AD "キ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x0,
+    0x1, 0xb6, 0x89, 0x30, 0x7, 0x97, 0xa3, 0x0,
+    0x0, 0x0, 0x0, 0x54, 0x3, 0x40, 0x23, 0x57,
+    0xac, 0x87, 0x51, 0x47, 0x31, 0x9, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0x10, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x0,
+
+    /* U+30AE "ギ" */
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x2b,
+    0x0, 0x32, 0xc0, 0x0, 0x0, 0xb0, 0x1, 0xc0,
+    0x0, 0x0, 0x1b, 0x79, 0x80, 0x0, 0x6, 0x96,
+    0x93, 0x0, 0x0, 0x0, 0x0, 0x4, 0x51, 0x35,
+    0x0, 0x24, 0x68, 0x9c, 0x86, 0x51, 0x3, 0x63,
+    0x0, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+30AF "ク" */
+    0x0, 0x0, 0x21, 0x0, 0x0, 0x0, 0x9, 0x80,
+    0x0, 0x0, 0x1, 0xd2, 0x25, 0x10, 0x0, 0x97,
+    0x75, 0x9b, 0x0, 0x66, 0x0, 0xd, 0x20, 0x23,
+    0x0, 0x8, 0x50, 0x0, 0x0, 0x3, 0xa0, 0x0,
+    0x0, 0x1, 0xb0, 0x0, 0x0, 0x0, 0xb2, 0x0,
+    0x0, 0x1, 0xa3, 0x0, 0x0, 0x3, 0x71, 0x0,
+    0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+30B0 "グ" */
+    0x0, 0x0, 0x31, 0x0, 0x31, 0x0, 0x0, 0xa,
+    0x60, 0x36, 0xb0, 0x0, 0x2, 0xd3, 0x36, 0x82,
+    0x0, 0x0, 0xa6, 0x64, 0xa9, 0x0, 0x0, 0x74,
+    0x0, 0x1d, 0x10, 0x0, 0x32, 0x0, 0xa, 0x30,
+    0x0, 0x0, 0x0, 0x5, 0x80, 0x0, 0x0, 0x0,
+    0x2, 0xb0, 0x0, 0x0, 0x0, 0x1, 0xb1, 0x0,
+    0x0, 0x0, 0x2, 0xa1, 0x0, 0x0, 0x0, 0x4,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+30B1 "ケ" */
+    0x0, 0x6, 0x10, 0x0, 0x0, 0x0, 0xe, 0x30,
+    0x0, 0x0, 0x0, 0x67, 0x3, 0x69, 0xa4, 0x1,
+    0xba, 0x89, 0x91, 0x0, 0x9, 0x10, 0x7, 0x70,
+    0x0, 0x30, 0x0, 0xb, 0x10, 0x0, 0x0, 0x0,
+    0x38, 0x0, 0x0, 0x0, 0x0, 0xa1, 0x0, 0x0,
+    0x0, 0x6, 0x40, 0x0, 0x0, 0x0, 0x34, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+30B2 "ゲ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x50,
+    0x0, 0x0, 0x83, 0x0, 0xd, 0x20, 0x0, 0x75,
+    0x70, 0x6, 0x70, 0x3, 0x66, 0x60, 0x1, 0xb9,
+    0x8a, 0xa3, 0x20, 0x0, 0x91, 0x0, 0x69, 0x0,
+    0x0, 0x30, 0x0, 0xb, 0x10, 0x0, 0x0, 0x0,
+    0x4, 0x70, 0x0, 0x0, 0x0, 0x0, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x82, 0x0, 0x0, 0x0, 0x0,
+    0x42, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+30B3 "コ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x78, 0x99,
+    0xd6, 0x1, 0x53, 0x0, 0x8, 0x50, 0x0, 0x0,
+    0x0, 0xa0, 0x0, 0x0, 0x0, 0xb, 0x0, 0x0,
+    0x0, 0x0, 0xa0, 0x0, 0x0, 0x13, 0x79, 0x0,
+    0x8b, 0xa8, 0x65, 0x40,
+
+    /* U+30B4 "ゴ" */
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x72, 0xb0, 0x0, 0x0, 0x0, 0x1,
+    0x19, 0x0, 0x2, 0x46, 0x78, 0x8c, 0x80, 0x0,
+    0x1, 0x74, 0x0, 0x7, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0x10, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x0, 0x0,
+    0x0, 0x0, 0x13, 0x6a, 0x0, 0x0, 0x8, 0xb9,
+    0x76, 0x54, 0x0, 0x0,
+
+    /* U+30B5 "サ" */
+    0x0, 0x0, 0x0, 0x14, 0x0, 0x0, 0x0, 0xd,
+    0x10, 0xd, 0x0, 0x0, 0x0, 0xa, 0x0, 0xb,
+    0x0, 0x0, 0x1, 0x2c, 0x67, 0x8d, 0x9a, 0xa1,
+    0x59, 0x6c, 0x20, 0xb, 0x0, 0x0, 0x0, 0xb,
+    0x0, 0x1a, 0x0, 0x0, 0x0, 0xb, 0x0, 0x47,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x82, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x1a, 0x10, 0x0, 0x0, 0x0, 0x0, 0x50, 0x0,
+    0x0, 0x0,
+
+    /* U+30B6 "ザ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x0, 0x0,
+    0x0, 0x0, 0x40, 0x43, 0x85, 0x0, 0x3, 0xa0,
+    0xb, 0x20, 0xa1, 0x10, 0x0, 0xa, 0x0, 0xa0,
+    0x0, 0x0, 0x0, 0x2, 0xc7, 0x7d, 0x89, 0xa2,
+    0x0, 0x99, 0x5b, 0x0, 0xa0, 0x0, 0x0, 0x0,
+    0x1, 0xa0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x19,
+    0x0, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x45,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+30B7 "シ" */
+    0x2, 0x72, 0x0, 0x0, 0x0, 0x0, 0x2, 0xd1,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x6,
+    0x4, 0x93, 0x0, 0x0, 0x8, 0x10, 0x2, 0xc0,
+    0x0, 0x9, 0x30, 0x0, 0x0, 0x0, 0x1a, 0x20,
+    0x0, 0x0, 0x0, 0x5b, 0x10, 0x0, 0x0, 0x26,
+    0xc8, 0x0, 0x0, 0x0, 0xa, 0xb2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+30B8 "ジ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x48, 0x0, 0x2, 0x72, 0x0, 0x49, 0x50,
+    0x0, 0x2, 0xd2, 0x0, 0x40, 0x0, 0x10, 0x1,
+    0x0, 0x0, 0x6, 0x1, 0x96, 0x0, 0x0, 0x9,
+    0x10, 0x0, 0xb3, 0x0, 0xa, 0x30, 0x0, 0x0,
+    0x0, 0x1b, 0x30, 0x0, 0x0, 0x0, 0x5b, 0x10,
+    0x0, 0x0, 0x15, 0xa7, 0x0, 0x0, 0x0, 0x6,
+    0xb1, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+30B9 "ス" */
+    0x0, 0x0, 0x0, 0x2, 0x20, 0x0, 0x1, 0x34,
+    0x89, 0xad, 0x0, 0x0, 0x39, 0x61, 0xa, 0x50,
+    0x0, 0x0, 0x0, 0x2, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x89, 0x60,
+    0x0, 0x0, 0x0, 0x59, 0x4, 0x80, 0x0, 0x0,
+    0x69, 0x0, 0x8, 0x80, 0x0, 0x85, 0x0, 0x0,
+    0x1e, 0x20, 0x30, 0x0, 0x0, 0x0, 0x51,
+
+    /* U+30BA "ズ" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x71, 0x0, 0x0,
+    0x0, 0x11, 0x57, 0x26, 0x1, 0x24, 0x79, 0xbc,
+    0x8, 0x0, 0x3, 0xa5, 0x10, 0xa4, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x6a, 0x40,
+    0x0, 0x0, 0x0, 0x4, 0x90, 0x58, 0x0, 0x0,
+    0x0, 0x48, 0x0, 0x8, 0x80, 0x0, 0x6, 0x50,
+    0x0, 0x0, 0xe2, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x30, 0x0,
+
+    /* U+30BB "セ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x39,
+    0x0, 0x0, 0xb, 0x6, 0x96, 0xe4, 0x0, 0x5,
+    0xd8, 0x20, 0x84, 0x0, 0x6b, 0x5b, 0x0, 0x35,
+    0x0, 0x0, 0x0, 0xb0, 0x1, 0x0, 0x0, 0x0,
+    0xb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x95, 0x0,
+    0x14, 0x10, 0x0, 0x1, 0x9b, 0xba, 0x70,
+
+    /* U+30BC "ゼ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x33, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x35, 0xb1, 0x0, 0x0, 0xd2,
+    0x0, 0x0, 0x92, 0x0, 0x0, 0xb, 0x0, 0x2,
+    0x81, 0x0, 0x0, 0x0, 0xb1, 0x69, 0x8e, 0x50,
+    0x0, 0x0, 0x5e, 0x72, 0x8, 0x30, 0x0, 0x6,
+    0xb4, 0xb0, 0x4, 0x40, 0x0, 0x0, 0x0, 0xb,
+    0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0x50, 0x12, 0x52,
+    0x0, 0x0, 0x0, 0x18, 0xab, 0xa8, 0x10, 0x0,
+
+    /* U+30BD "ソ" */
+    0x0, 0x0, 0x0, 0x0, 0x50, 0x0, 0x0, 0x6a,
+    0x59, 0x0, 0x0, 0x88, 0xd, 0x20, 0x0, 0xd1,
+    0x5, 0x10, 0x5, 0x80, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0x94, 0x0, 0x0, 0x6, 0x70, 0x0,
+    0x0, 0x67, 0x0, 0x0, 0x6, 0x40, 0x0, 0x0,
+    0x10, 0x0, 0x0, 0x0,
+
+    /* U+30BF "タ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x66,
+    0x0, 0x0, 0x0, 0x0, 0xd9, 0x8b, 0xe0, 0x0,
+    0x8, 0x64, 0x18, 0x80, 0x0, 0x7b, 0x10, 0x1d,
+    0x0, 0x7, 0x60, 0xb5, 0x95, 0x0, 0x21, 0x0,
+    0x1d, 0xa0, 0x0, 0x0, 0x0, 0x1b, 0x0, 0x0,
+    0x0, 0x1, 0xb1, 0x0, 0x0, 0x0, 0x4a, 0x10,
+    0x0, 0x0, 0x7, 0x60, 0x0, 0x0, 0x0, 0x20,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+30C0 "ダ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x92, 0x0, 0x0, 0x9,
+    0x20, 0x1, 0x95, 0x50, 0x0, 0x2, 0xe7, 0x8c,
+    0xa1, 0x40, 0x0, 0x0, 0xb5, 0x40, 0xb3, 0x0,
+    0x0, 0x0, 0x98, 0x0, 0x49, 0x0, 0x0, 0x0,
+    0x83, 0x2c, 0x2c, 0x10, 0x0, 0x0, 0x20, 0x0,
+    0x4d, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x17, 0x40, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+30C1 "チ" */
+    0x0, 0x0, 0x0, 0x8, 0x70, 0x0, 0x0, 0x0,
+    0x48, 0xb6, 0x20, 0x0, 0x0, 0x14, 0x21, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd4, 0x57, 0x50,
+    0x7, 0xba, 0x99, 0xc5, 0x44, 0x40, 0x0, 0x0,
+    0x4, 0x70, 0x0, 0x0, 0x0, 0x0, 0x9, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x2a, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+30C3 "ッ" */
+    0x0, 0x20, 0x0, 0x0, 0x41, 0x47, 0x3, 0xd0,
+    0x1c, 0x8, 0x6, 0x80, 0x4, 0x0, 0xc, 0x10,
+    0x0, 0x0, 0x65, 0x0, 0x0, 0x3, 0x80, 0x0,
+    0x0, 0x38, 0x0, 0x0, 0x1, 0x30, 0x0, 0x0,
+
+    /* U+30C4 "ツ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x20,
+    0x0, 0x70, 0x16, 0x1, 0xd0, 0x1, 0xe1, 0xa,
+    0x40, 0x90, 0x7, 0x60, 0x5, 0x50, 0x0, 0x1b,
+    0x0, 0x0, 0x0, 0x0, 0x93, 0x0, 0x0, 0x0,
+    0x4, 0x80, 0x0, 0x0, 0x0, 0x1a, 0x0, 0x0,
+    0x0, 0x1, 0x90, 0x0, 0x0, 0x0, 0x26, 0x0,
+    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+30C6 "テ" */
+    0x0, 0x0, 0x2, 0x61, 0x0, 0x0, 0x59, 0x86,
+    0x52, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x34,
+    0x56, 0x87, 0x8a, 0xb1, 0x36, 0x31, 0x79, 0x0,
+    0x0, 0x0, 0x0, 0x94, 0x0, 0x0, 0x0, 0x0,
+    0xb0, 0x0, 0x0, 0x0, 0x8, 0x40, 0x0, 0x0,
+    0x0, 0x38, 0x0, 0x0, 0x0, 0x2, 0x80, 0x0,
+    0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+30C7 "デ" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x40, 0x0, 0x0,
+    0x1, 0x41, 0x25, 0x93, 0x0, 0x49, 0x87, 0x63,
+    0x8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x12, 0x46, 0x78, 0x9a, 0xb2, 0x0, 0x26, 0x42,
+    0x2c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x66, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0x50, 0x0, 0x0, 0x0, 0x0, 0x19,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+30C8 "ト" */
+    0x18, 0x0, 0x0, 0xc, 0x0, 0x0, 0xb, 0x0,
+    0x0, 0xb, 0x10, 0x0, 0xa, 0x59, 0x20, 0xa,
+    0x1, 0xd5, 0xa, 0x0, 0x14, 0xa, 0x0, 0x0,
+    0xb, 0x0, 0x0, 0xb, 0x0, 0x0, 0x3, 0x0,
+    0x0,
+
+    /* U+30C9 "ド" */
+    0x81, 0x0, 0x3, 0x0, 0xb2, 0x1, 0x53, 0xb0,
+    0xa0, 0x0, 0x67, 0x30, 0xa3, 0x0, 0x0, 0x0,
+    0xa2, 0x94, 0x0, 0x0, 0xa0, 0xb, 0x70, 0x0,
+    0xa0, 0x0, 0x50, 0x0, 0xa0, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0,
+    0x20, 0x0, 0x0, 0x0,
+
+    /* U+30CA "ナ" */
+    0x0, 0x0, 0x36, 0x0, 0x0, 0x0, 0x0, 0x2c,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0x0, 0x0, 0x0,
+    0x23, 0x6d, 0x99, 0xb5, 0x7a, 0x75, 0x58, 0x0,
+    0x0, 0x0, 0x0, 0x55, 0x0, 0x0, 0x0, 0x0,
+    0x91, 0x0, 0x0, 0x0, 0x1, 0xa0, 0x0, 0x0,
+    0x0, 0x8, 0x20, 0x0, 0x0, 0x0, 0x44, 0x0,
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+
+    /* U+30CB "ニ" */
+    0x0, 0x0, 0x0, 0x2, 0x10, 0x0, 0x0, 0x8,
+    0xa8, 0x87, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0x88,
+    0x88, 0x88, 0x9a, 0x90, 0x2, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+30CD "ネ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x96,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0x0, 0x0, 0x0,
+    0x0, 0x37, 0xc7, 0x0, 0x1, 0xa9, 0x52, 0xc1,
+    0x0, 0x0, 0x0, 0x1b, 0x10, 0x0, 0x0, 0x2,
+    0xc6, 0x23, 0x0, 0x0, 0x49, 0x2a, 0x6, 0xa0,
+    0x6, 0x50, 0x9, 0x0, 0x84, 0x20, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x0, 0x2a, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0x0, 0x0,
+
+    /* U+30CE "ノ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xe0, 0x0, 0x0, 0x0, 0x7, 0x90, 0x0,
+    0x0, 0x0, 0x2c, 0x0, 0x0, 0x0, 0x0, 0xc2,
+    0x0, 0x0, 0x0, 0x9, 0x40, 0x0, 0x0, 0x0,
+    0x85, 0x0, 0x0, 0x0, 0x9, 0x40, 0x0, 0x0,
+    0x1, 0x92, 0x0, 0x0, 0x0, 0x25, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+30CF "ハ" */
+    0x0, 0x0, 0x60, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0xf2, 0x1, 0x70, 0x0, 0x0, 0x9, 0x60, 0x0,
+    0x49, 0x0, 0x0, 0x3a, 0x0, 0x0, 0xa, 0x60,
+    0x1, 0xa0, 0x0, 0x0, 0x1, 0xe0, 0x7, 0x0,
+    0x0, 0x0, 0x0, 0x81, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+30D0 "バ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x22, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x48, 0x51, 0x0, 0x0, 0x50, 0x1, 0x3, 0x0,
+    0x0, 0x1, 0xe1, 0x0, 0x70, 0x0, 0x0, 0x8,
+    0x50, 0x0, 0x29, 0x0, 0x0, 0x29, 0x0, 0x0,
+    0x9, 0x60, 0x0, 0x90, 0x0, 0x0, 0x1, 0xe0,
+    0x6, 0x0, 0x0, 0x0, 0x0, 0x91, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+30D1 "パ" */
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x41, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x16, 0x40, 0x0, 0x0, 0x40, 0x1, 0x20, 0x0,
+    0x0, 0x0, 0xd3, 0x0, 0x71, 0x0, 0x0, 0x5,
+    0x80, 0x0, 0xb, 0x0, 0x0, 0x1a, 0x0, 0x0,
+    0x6, 0x90, 0x0, 0x91, 0x0, 0x0, 0x0, 0xe2,
+    0x6, 0x10, 0x0, 0x0, 0x0, 0x73, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+30D2 "ヒ" */
+    0x0, 0x0, 0x0, 0x0, 0xd2, 0x0, 0x0, 0x0,
+    0xb0, 0x0, 0x1, 0x0, 0xb0, 0x15, 0xae, 0x40,
+    0xb5, 0x53, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x0,
+    0xb0, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x0,
+    0x96, 0x10, 0x13, 0x50, 0x6, 0x99, 0x98, 0x60,
+
+    /* U+30D3 "ビ" */
+    0x0, 0x0, 0x0, 0x10, 0x2, 0xc0, 0x0, 0x2,
+    0xa4, 0xb, 0x0, 0x0, 0x79, 0x30, 0xb0, 0x0,
+    0x28, 0x20, 0xb, 0x3, 0x9a, 0x61, 0x0, 0xc6,
+    0x40, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0x0,
+    0xb0, 0x0, 0x0, 0x0, 0xc, 0x30, 0x1, 0x44,
+    0x0, 0x28, 0x99, 0x98, 0x40,
+
+    /* U+30D4 "ピ" */
+    0x0, 0x0, 0x0, 0x6, 0x90, 0xa, 0x0, 0x0,
+    0x5, 0x32, 0xc, 0x0, 0x0, 0x1, 0x20, 0xb,
+    0x0, 0x1, 0xa1, 0x0, 0xb, 0x3, 0x8a, 0x61,
+    0x0, 0xb, 0x54, 0x0, 0x0, 0x0, 0xb, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0x52, 0x12, 0x46, 0x0, 0x0, 0x68, 0x98,
+    0x75, 0x0,
+
+    /* U+30D5 "フ" */
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x14, 0x46, 0x89,
+    0x99, 0xf4, 0x7, 0x63, 0x10, 0x3, 0xc0, 0x0,
+    0x0, 0x0, 0xb, 0x20, 0x0, 0x0, 0x0, 0x67,
+    0x0, 0x0, 0x0, 0x3, 0xb0, 0x0, 0x0, 0x0,
+    0x2b, 0x0, 0x0, 0x0, 0x3, 0xa0, 0x0, 0x0,
+    0x0, 0x57, 0x0, 0x0, 0x0, 0x4, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+30D6 "ブ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0x2b, 0x0, 0x0, 0x2,
+    0x57, 0xa7, 0x25, 0x0, 0x7b, 0xa8, 0x63, 0x17,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x58, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x58, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x63, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+30D7 "プ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0x15, 0x0, 0x0, 0x1,
+    0x36, 0x95, 0x4, 0x0, 0x8b, 0x99, 0x75, 0x28,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x94, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x59, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x64, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+30D9 "ベ" */
+    0x0, 0x0, 0x0, 0x0, 0x14, 0x0, 0x0, 0x0,
+    0x10, 0x4, 0x48, 0x50, 0x0, 0x9, 0xb5, 0x0,
+    0x90, 0x0, 0x0, 0xa4, 0x9, 0x50, 0x0, 0x0,
+    0x2b, 0x50, 0x0, 0xb4, 0x0, 0x0, 0x35, 0x0,
+    0x0, 0xb, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xb1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x41,
+
+    /* U+30DA "ペ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x26, 0x40, 0x0, 0x0, 0x0, 0x30, 0x34,
+    0x60, 0x0, 0x0, 0xb, 0x98, 0x1, 0x0, 0x0,
+    0x0, 0xb2, 0x7, 0x70, 0x0, 0x0, 0x3c, 0x30,
+    0x0, 0x96, 0x0, 0x0, 0x13, 0x0, 0x0, 0xa,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xd2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x10,
+
+    /* U+30DB "ホ" */
+    0x0, 0x0, 0xa1, 0x0, 0x0, 0x0, 0x0, 0xc1,
+    0x0, 0x0, 0x0, 0x0, 0xb0, 0x23, 0x30, 0x5b,
+    0x99, 0xd8, 0x77, 0x70, 0x0, 0x0, 0xb0, 0x0,
+    0x0, 0x0, 0x20, 0xb0, 0x4, 0x0, 0x5, 0x20,
+    0xb0, 0x3, 0x80, 0x2c, 0x0, 0xb0, 0x0, 0xc2,
+    0x52, 0x6, 0xd0, 0x0, 0x31, 0x0, 0x2, 0xc0,
+    0x0, 0x0,
+
+    /* U+30DC "ボ" */
+    0x0, 0x0, 0x0, 0x0, 0x51, 0x0, 0x0, 0x9,
+    0x10, 0x72, 0xb0, 0x0, 0x0, 0xb1, 0x2, 0x60,
+    0x0, 0x0, 0xa, 0x1, 0x32, 0x0, 0x4a, 0x98,
+    0xd8, 0x87, 0x70, 0x0, 0x0, 0xa, 0x0, 0x0,
+    0x0, 0x0, 0x20, 0xa0, 0x4, 0x0, 0x0, 0x52,
+    0xa, 0x0, 0x47, 0x0, 0x1c, 0x0, 0xa0, 0x0,
+    0xc2, 0x6, 0x30, 0x6c, 0x10, 0x4, 0x10, 0x0,
+    0x3, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+30DD "ポ" */
+    0x0, 0x0, 0x0, 0x5, 0x10, 0x0, 0x0, 0x91,
+    0x50, 0x50, 0x0, 0x0, 0xb1, 0x16, 0x20, 0x0,
+    0x0, 0xa0, 0x23, 0x30, 0x5b, 0x98, 0xd8, 0x76,
+    0x60, 0x0, 0x0, 0xa0, 0x0, 0x0, 0x0, 0x20,
+    0xa0, 0x4, 0x0, 0x5, 0x20, 0xa0, 0x3, 0x80,
+    0x2c, 0x0, 0xa0, 0x0, 0xc2, 0x52, 0x6, 0xc1,
+    0x0, 0x31, 0x0, 0x2, 0xc0, 0x0, 0x0,
+
+    /* U+30DE "マ" */
+    0x0, 0x0, 0x0, 0x24, 0x61, 0x7b, 0x98, 0x88,
+    0x64, 0xb9, 0x0, 0x0, 0x0, 0x7, 0x90, 0x0,
+    0x4, 0x0, 0x65, 0x0, 0x0, 0x2, 0x95, 0x20,
+    0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x20, 0x0, 0x0, 0x0, 0x4, 0x10, 0x0,
+
+    /* U+30DF "ミ" */
+    0x4, 0x20, 0x0, 0x0, 0x6b, 0x70, 0x0, 0x0,
+    0xa5, 0x1, 0x0, 0x0, 0x4, 0x96, 0x0, 0x0,
+    0x7, 0xc0, 0x0, 0x0, 0x20, 0x35, 0x10, 0x0,
+    0x1, 0x8b, 0x40, 0x0, 0x2, 0xc6, 0x0, 0x0,
+    0x2,
+
+    /* U+30E0 "ム" */
+    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x88,
+    0x0, 0x0, 0x0, 0x0, 0xc2, 0x0, 0x0, 0x0,
+    0x3, 0x90, 0x0, 0x0, 0x0, 0x9, 0x10, 0x0,
+    0x0, 0x0, 0x28, 0x0, 0x40, 0x0, 0x0, 0x91,
+    0x0, 0x2a, 0x0, 0x3, 0x70, 0x15, 0x79, 0x90,
+    0x1d, 0xaa, 0x83, 0x0, 0xe1, 0x18, 0x20, 0x0,
+    0x0, 0x40,
+
+    /* U+30E1 "メ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xc0, 0x0, 0x0, 0x0, 0xa, 0x50, 0x0,
+    0x2, 0x20, 0x2b, 0x0, 0x0, 0x0, 0x39, 0xc2,
+    0x0, 0x0, 0x0, 0x7, 0xd8, 0x0, 0x0, 0x0,
+    0x39, 0xa, 0x70, 0x0, 0x2, 0xb0, 0x0, 0x40,
+    0x0, 0x39, 0x0, 0x0, 0x0, 0x5, 0x60, 0x0,
+    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+30E2 "モ" */
+    0x0, 0x0, 0x1, 0x47, 0x81, 0x0, 0x7, 0x98,
+    0xc4, 0x21, 0x0, 0x0, 0x0, 0xd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb2, 0x46, 0x71, 0x6, 0xa9,
+    0x8c, 0x65, 0x43, 0x10, 0x0, 0x0, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb2, 0x1, 0x20, 0x0, 0x0, 0x2, 0x9a,
+    0xa6, 0x0,
+
+    /* U+30E3 "ャ" */
+    0x0, 0x9, 0x50, 0x0, 0x0, 0x0, 0x3, 0x90,
+    0x5, 0x70, 0x0, 0x4, 0xd8, 0x74, 0xc1, 0x6,
+    0x94, 0x82, 0x6, 0x10, 0x0, 0x0, 0x37, 0x2,
+    0x0, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0x20, 0x0, 0x0, 0x0, 0x3, 0x40, 0x0,
+
+    /* U+30E4 "ヤ" */
+    0x0, 0x4, 0x70, 0x0, 0x0, 0x0, 0x0, 0x1c,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x5b,
+    0x70, 0x0, 0x9, 0x98, 0x84, 0x97, 0x1a, 0xa8,
+    0x68, 0x0, 0x19, 0x0, 0x0, 0x0, 0xa0, 0x7,
+    0x0, 0x0, 0x0, 0x9, 0x10, 0x20, 0x0, 0x0,
+    0x0, 0x55, 0x0, 0x0, 0x0, 0x0, 0x1, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x20, 0x0, 0x0,
+
+    /* U+30E5 "ュ" */
+    0x0, 0x12, 0x35, 0x30, 0x0, 0x0, 0x67, 0x46,
+    0xb0, 0x0, 0x0, 0x0, 0x7, 0x40, 0x0, 0x0,
+    0x0, 0xb, 0x0, 0x0, 0x7, 0x88, 0x9d, 0xab,
+    0x90, 0x0, 0x20, 0x0, 0x0, 0x0,
+
+    /* U+30E7 "ョ" */
+    0x0, 0x0, 0x1, 0x10, 0x3, 0xba, 0x9a, 0xd0,
+    0x0, 0x0, 0x2, 0xa0, 0x1, 0xa9, 0x8a, 0x70,
+    0x0, 0x0, 0x6, 0x40, 0x0, 0x0, 0x8, 0x20,
+    0x8, 0xa9, 0x9a, 0x30,
+
+    /* U+30E8 "ヨ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0x89, 0xaa,
+    0xd5, 0x0, 0x21, 0x0, 0x7, 0x70, 0x0, 0x0,
+    0x0, 0x93, 0x0, 0x0, 0x0, 0xb, 0x0, 0x2b,
+    0xb9, 0x98, 0xc0, 0x0, 0x0, 0x0, 0xa, 0x0,
+    0x0, 0x0, 0x2, 0x80, 0xb, 0xba, 0x99, 0xb8,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+30E9 "ラ" */
+    0x0, 0x0, 0x1, 0x35, 0x0, 0x0, 0x7a, 0x98,
+    0x65, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0x35, 0x69, 0x9a, 0xe0, 0x6, 0x74, 0x20, 0x3,
+    0xb0, 0x0, 0x0, 0x0, 0xb, 0x10, 0x0, 0x0,
+    0x0, 0x85, 0x0, 0x0, 0x0, 0x7, 0x70, 0x0,
+    0x0, 0x0, 0x86, 0x0, 0x0, 0x0, 0x18, 0x30,
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+
+    /* U+30EA "リ" */
+    0x5, 0x0, 0xa, 0x0, 0xc1, 0x0, 0xe0, 0xb,
+    0x0, 0xc, 0x0, 0xb0, 0x0, 0xc0, 0xb, 0x0,
+    0xc, 0x0, 0xc0, 0x0, 0xb0, 0x3, 0x0, 0x29,
+    0x0, 0x0, 0x9, 0x30, 0x0, 0x3, 0x90, 0x0,
+    0x3, 0x80, 0x0, 0x1, 0x30, 0x0, 0x0,
+
+    /* U+30EB "ル" */
+    0x0, 0x0, 0x5, 0x0, 0x0, 0x0, 0x0, 0x20,
+    0xe, 0x10, 0x0, 0x0, 0x0, 0xd2, 0xc, 0x0,
+    0x0, 0x0, 0x0, 0xc0, 0xb, 0x0, 0x0, 0x50,
+    0x0, 0xc0, 0xb, 0x0, 0x6, 0x30, 0x0, 0xc0,
+    0xb, 0x0, 0x76, 0x0, 0x2, 0x80, 0xb, 0x1a,
+    0x60, 0x0, 0x9, 0x10, 0xd, 0xd3, 0x0, 0x0,
+    0x32, 0x0, 0x3, 0x10, 0x0, 0x0,
+
+    /* U+30EC "レ" */
+    0x24, 0x0, 0x0, 0x0, 0x2f, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0,
+    0xb, 0x0, 0x0, 0x62, 0xb, 0x0, 0x59, 0x10,
+    0xb, 0x3b, 0x60, 0x0, 0x1f, 0xb1, 0x0, 0x0,
+    0x2, 0x0, 0x0, 0x0,
+
+    /* U+30ED "ロ" */
+    0x0, 0x0, 0x24, 0x69, 0x20, 0xf9, 0x97, 0x53,
+    0xa9, 0xc, 0x0, 0x0, 0xb, 0x20, 0xb0, 0x0,
+    0x0, 0xb0, 0xa, 0x10, 0x0, 0x19, 0x0, 0x91,
+    0x0, 0x6, 0x60, 0xa, 0xaa, 0x99, 0x96, 0x0,
+    0x40, 0x0, 0x0, 0x0,
+
+    /* U+30EF "ワ" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0x56, 0x79,
+    0xab, 0xe2, 0xd, 0x43, 0x20, 0x0, 0xd2, 0xc,
+    0x0, 0x0, 0x5, 0x80, 0xd, 0x0, 0x0, 0xc,
+    0x10, 0x9, 0x0, 0x0, 0x76, 0x0, 0x0, 0x0,
+    0x2, 0xa0, 0x0, 0x0, 0x0, 0x1a, 0x0, 0x0,
+    0x0, 0x1, 0x90, 0x0, 0x0, 0x0, 0x27, 0x0,
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+
+    /* U+30F3 "ン" */
+    0x15, 0x0, 0x0, 0x0, 0x0, 0x2, 0xc4, 0x0,
+    0x0, 0x2, 0x0, 0x3a, 0x0, 0x0, 0x53, 0x0,
+    0x0, 0x0, 0x6, 0x60, 0x0, 0x0, 0x0, 0x66,
+    0x0, 0x0, 0x0, 0x9, 0x50, 0x0, 0x0, 0x3,
+    0xb3, 0x0, 0x0, 0x6, 0xa9, 0x10, 0x0, 0x0,
+    0x6, 0x30, 0x0, 0x0, 0x0,
+
+    /* U+30F6 "ヶ" */
+    0x0, 0x82, 0x0, 0x0, 0x0, 0xc1, 0x2, 0x50,
+    0x8, 0xa9, 0xd7, 0x51, 0x35, 0x0, 0xc2, 0x0,
+    0x0, 0x2, 0x90, 0x0, 0x0, 0x9, 0x10, 0x0,
+    0x0, 0x45, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0,
+
+    /* U+30FC "ー" */
+    0x2, 0x10, 0x0, 0x1, 0x24, 0x69, 0x40, 0x8,
+    0xff, 0xcb, 0xa9, 0x87, 0x77, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+4E00 "一" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x30, 0x6,
+    0x55, 0x55, 0x55, 0x55, 0x58, 0x70,
+
+    /* U+4E03 "七" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd0,
+    0x0, 0x7, 0x90, 0x0, 0x0, 0x0, 0xd3, 0x55,
+    0x51, 0x0, 0x0, 0x3, 0x55, 0xd1, 0x0, 0x0,
+    0x0, 0x7, 0x51, 0x0, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd0, 0x0, 0x0, 0x50, 0x0, 0x0,
+    0x0, 0xd0, 0x0, 0x0, 0x80, 0x0, 0x0, 0x0,
+    0xd1, 0x0, 0x0, 0xd2, 0x0, 0x0, 0x0, 0x5b,
+    0xbb, 0xbb, 0xa2,
+
+    /* U+4E07 "万" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x10, 0x75,
+    0x55, 0xa7, 0x55, 0x55, 0x85, 0x0, 0x0, 0xc,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd2, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0xf, 0x55, 0x55, 0xb8,
+    0x0, 0x0, 0x2, 0xc0, 0x0, 0x9, 0x40, 0x0,
+    0x0, 0x68, 0x0, 0x0, 0xa3, 0x0, 0x0, 0xb,
+    0x30, 0x0, 0xb, 0x20, 0x0, 0x2, 0xa0, 0x0,
+    0x0, 0xd1, 0x0, 0x0, 0xa2, 0x0, 0x0, 0xe,
+    0x0, 0x0, 0x73, 0x0, 0x5, 0x78, 0xc0, 0x0,
+    0x43, 0x0, 0x0, 0x6, 0xb2, 0x0, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+4E08 "丈" */
+    0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0x30, 0x1, 0x0, 0x5, 0x65, 0x55,
+    0x5b, 0x75, 0x5a, 0xa0, 0x0, 0x1, 0x0, 0xa,
+    0x20, 0x0, 0x0, 0x0, 0x5, 0x0, 0xb, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x60, 0xd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x73, 0xd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0x59, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xbe, 0x70, 0x0, 0x0, 0x0, 0x0, 0x88,
+    0x1, 0xbe, 0x95, 0x30, 0x0, 0x58, 0x30, 0x0,
+    0x3, 0xaf, 0x50, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4E09 "三" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x65, 0x55, 0x55, 0x55, 0x6d, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x90, 0x0, 0x0, 0x26, 0x55, 0x55, 0x55, 0x52,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x16, 0x55,
+    0x55, 0x55, 0x55, 0x58, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+4E0A "上" */
+    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd0,
+    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0xd5, 0x55,
+    0xa8, 0x0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd0, 0x0, 0x3, 0x80, 0x7, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x51,
+
+    /* U+4E0B "下" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x30, 0x65,
+    0x55, 0x5d, 0x55, 0x55, 0x54, 0x0, 0x0, 0x0,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd6, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0x5, 0xd7, 0x0, 0x0,
+    0x0, 0x0, 0xd0, 0x2, 0xe2, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x20, 0x0, 0x0, 0x0,
+
+    /* U+4E0D "不" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0x55, 0x55, 0x56, 0x55, 0x5b, 0x80, 0x0, 0x0,
+    0x0, 0x88, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xe4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0xa2, 0x25,
+    0x0, 0x0, 0x0, 0x1, 0xc2, 0xa2, 0x2, 0xa1,
+    0x0, 0x0, 0xb, 0x20, 0xa2, 0x0, 0x3d, 0x30,
+    0x0, 0x92, 0x0, 0xa2, 0x0, 0x6, 0xc0, 0x16,
+    0x0, 0x0, 0xa2, 0x0, 0x0, 0x40, 0x0, 0x0,
+    0x0, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4E13 "专" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x90, 0x0, 0x70, 0x0, 0x0, 0x55, 0x59,
+    0x95, 0x55, 0x52, 0x0, 0x0, 0x0, 0x8, 0x30,
+    0x0, 0x0, 0x0, 0x15, 0x55, 0x5d, 0x65, 0x55,
+    0x58, 0xb0, 0x1, 0x0, 0xc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x30, 0x0,
+    0x0, 0x0, 0x57, 0x55, 0x57, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x20, 0x0, 0x0, 0x0,
+    0x16, 0x30, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6c, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0,
+
+    /* U+4E14 "且" */
+    0x0, 0x0, 0x95, 0x55, 0x55, 0xb0, 0x0, 0x0,
+    0x0, 0xd0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0,
+    0xd0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xd0,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xd5, 0x55,
+    0x55, 0xc0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0,
+    0xc0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0x0, 0xd5, 0x55, 0x55, 0xc0, 0x0,
+    0x0, 0x0, 0xd0, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0x0, 0xd0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0,
+    0xd0, 0x0, 0x0, 0xc0, 0x80, 0x6, 0x55, 0x75,
+    0x55, 0x55, 0x76, 0x74,
+
+    /* U+4E16 "世" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc1, 0x0, 0xd1, 0x0, 0x0, 0x2c,
+    0x0, 0xc0, 0x0, 0xc0, 0x0, 0x0, 0x1a, 0x0,
+    0xc0, 0x0, 0xc0, 0x0, 0x0, 0x1a, 0x0, 0xc0,
+    0x0, 0xc0, 0x91, 0x6, 0x6c, 0x55, 0xd5, 0x55,
+    0xd5, 0x52, 0x0, 0x1a, 0x0, 0xc0, 0x0, 0xc0,
+    0x0, 0x0, 0x1a, 0x0, 0xc0, 0x0, 0xc0, 0x0,
+    0x0, 0x1a, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x0,
+    0x1a, 0x0, 0xc5, 0x55, 0xc0, 0x0, 0x0, 0x1a,
+    0x0, 0x90, 0x0, 0x70, 0x0, 0x0, 0x1a, 0x0,
+    0x0, 0x0, 0x0, 0x50, 0x0, 0x3b, 0x55, 0x55,
+    0x55, 0x56, 0x93, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4E21 "両" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x6,
+    0x55, 0x55, 0x57, 0x55, 0x59, 0x90, 0x0, 0x0,
+    0x0, 0x29, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x29, 0x0, 0x1, 0x0, 0x0, 0xc5, 0x55, 0x6b,
+    0x55, 0x5c, 0x30, 0x0, 0xb0, 0x0, 0x29, 0x1,
+    0xa, 0x10, 0x0, 0xb0, 0xb1, 0x29, 0xd, 0xa,
+    0x10, 0x0, 0xb0, 0xb0, 0x29, 0xc, 0xa, 0x10,
+    0x0, 0xb0, 0xb0, 0x29, 0xc, 0xa, 0x10, 0x0,
+    0xb0, 0xc5, 0x6a, 0x5d, 0xa, 0x10, 0x0, 0xb0,
+    0x20, 0x0, 0x5, 0xa, 0x10, 0x0, 0xb0, 0x0,
+    0x0, 0x3, 0x2c, 0x0, 0x0, 0xa0, 0x0, 0x0,
+    0x2, 0xab, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4E26 "並" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x1, 0x81, 0x0, 0x5, 0xc0, 0x0, 0x0, 0x0,
+    0x3d, 0x0, 0xa, 0x10, 0x0, 0x0, 0x0, 0xc,
+    0x10, 0x42, 0x7, 0x0, 0x2, 0x65, 0x5d, 0x55,
+    0xd5, 0x55, 0x20, 0x0, 0x20, 0xc, 0x0, 0xc0,
+    0x4, 0x10, 0x0, 0x70, 0xc, 0x0, 0xc0, 0xd,
+    0x50, 0x0, 0x56, 0xc, 0x0, 0xc0, 0x67, 0x0,
+    0x0, 0x1d, 0xc, 0x0, 0xc0, 0xa0, 0x0, 0x0,
+    0xd, 0xc, 0x0, 0xc6, 0x10, 0x0, 0x0, 0x3,
+    0xc, 0x0, 0xc2, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0xc0, 0x3, 0x40, 0x6, 0x55, 0x57, 0x55,
+    0x75, 0x57, 0x80,
+
+    /* U+4E2D "中" */
+    0x0, 0x0, 0x41, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0xa3, 0x0, 0x0,
+    0x8, 0x55, 0x5b, 0x75, 0x55, 0xa2, 0xc0, 0x0,
+    0xa3, 0x0, 0xc, 0xc, 0x0, 0xa, 0x30, 0x0,
+    0xc0, 0xc0, 0x0, 0xa3, 0x0, 0xc, 0xd, 0x55,
+    0x5b, 0x75, 0x55, 0xd0, 0xb0, 0x0, 0xa3, 0x0,
+    0xa, 0x0, 0x0, 0xa, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0xa3, 0x0, 0x0, 0x0, 0x0, 0xa, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0xa3, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x0, 0x0, 0x0,
+
+    /* U+4E3B "主" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x99, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x15, 0x0, 0x18, 0x0, 0x3, 0x65, 0x55, 0xc7,
+    0x55, 0x55, 0x10, 0x0, 0x0, 0x0, 0xa2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa3, 0x11, 0x90, 0x0,
+    0x0, 0x46, 0x55, 0xc6, 0x44, 0x41, 0x0, 0x0,
+    0x0, 0x0, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa2, 0x0, 0x5, 0x10, 0x26, 0x55, 0x55, 0x75,
+    0x55, 0x58, 0x60,
+
+    /* U+4E45 "久" */
+    0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x89,
+    0x55, 0xb1, 0x0, 0x0, 0x0, 0x0, 0xb0, 0x4,
+    0xb0, 0x0, 0x0, 0x0, 0x7, 0x20, 0xa, 0x50,
+    0x0, 0x0, 0x0, 0x36, 0x0, 0x1d, 0x50, 0x0,
+    0x0, 0x1, 0x50, 0x0, 0x94, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xb0, 0x45, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0x10, 0xb, 0x10, 0x0, 0x0, 0x0,
+    0xb2, 0x0, 0x4, 0xc1, 0x0, 0x0, 0x28, 0x10,
+    0x0, 0x0, 0x8d, 0x50, 0x5, 0x60, 0x0, 0x0,
+    0x0, 0x8, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4E4B "之" */
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb3, 0x0, 0x0, 0x0, 0x3, 0x55, 0x55,
+    0x65, 0x59, 0x50, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x3d, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2, 0xc1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xb1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1a, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x1d, 0x70, 0x87,
+    0x31, 0x0, 0x2, 0x31, 0x4, 0x0, 0x4, 0xad,
+    0xef, 0xff, 0x70,
+
+    /* U+4E4E "乎" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x12, 0x0, 0x0,
+    0x0, 0x0, 0x14, 0x7b, 0xd8, 0x0, 0x0, 0x45,
+    0x67, 0x8b, 0x20, 0x0, 0x0, 0x0, 0x4, 0x0,
+    0x2a, 0x0, 0xa5, 0x0, 0x0, 0x4, 0x90, 0x2a,
+    0x1, 0xa0, 0x0, 0x0, 0x0, 0xc2, 0x2a, 0x7,
+    0x10, 0x0, 0x0, 0x0, 0x20, 0x2a, 0x2, 0x1,
+    0x80, 0x6, 0x55, 0x55, 0x6c, 0x55, 0x55, 0x52,
+    0x0, 0x0, 0x0, 0x2a, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2a, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22,
+    0x4a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+4E4F "乏" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x48, 0xd5, 0x0, 0x15, 0x56, 0x78,
+    0x86, 0x53, 0x20, 0x0, 0x0, 0x3, 0x91, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0x80, 0x0, 0x0,
+    0x0, 0x45, 0x55, 0x56, 0x55, 0xb0, 0x0, 0x1,
+    0x0, 0x0, 0x2, 0xb5, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x8, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x58, 0x10, 0x0, 0x0,
+    0x0, 0x2, 0xa6, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xb0, 0x68, 0x41, 0x0, 0x1, 0x21, 0x21, 0x0,
+    0x17, 0xbd, 0xef, 0xf8, 0x0,
+
+    /* U+4E57 "乗" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x12, 0x46, 0x8b, 0xe8, 0x0, 0x0, 0x44,
+    0x33, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x92, 0x0, 0x43, 0x0, 0x0, 0x65, 0x85, 0xb7,
+    0x59, 0x54, 0x0, 0x0, 0x0, 0xc0, 0x92, 0xc,
+    0x4, 0x0, 0x6, 0x55, 0xd5, 0xb7, 0x5d, 0x56,
+    0x30, 0x0, 0x0, 0xc0, 0x92, 0xc, 0x12, 0x0,
+    0x0, 0x65, 0x79, 0xe9, 0x57, 0x66, 0x0, 0x0,
+    0x0, 0x1b, 0x94, 0x70, 0x0, 0x0, 0x0, 0x1,
+    0xa1, 0x92, 0x58, 0x0, 0x0, 0x0, 0x38, 0x10,
+    0x92, 0x6, 0xc5, 0x0, 0x5, 0x40, 0x0, 0x93,
+    0x0, 0x4d, 0x80, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+4E5D "九" */
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x10, 0x0, 0x0, 0x1, 0x65, 0x5d, 0x55,
+    0xb5, 0x0, 0x0, 0x0, 0x0, 0x1a, 0x0, 0xa1,
+    0x0, 0x0, 0x0, 0x0, 0x38, 0x0, 0xa1, 0x0,
+    0x0, 0x0, 0x0, 0x64, 0x0, 0xa1, 0x0, 0x0,
+    0x0, 0x0, 0xa0, 0x0, 0xa1, 0x0, 0x0, 0x0,
+    0x2, 0x90, 0x0, 0xa1, 0x0, 0x10, 0x0, 0x9,
+    0x10, 0x0, 0xa2, 0x0, 0x60, 0x0, 0x63, 0x0,
+    0x0, 0x92, 0x0, 0x90, 0x4, 0x30, 0x0, 0x0,
+    0x6c, 0xaa, 0xd1, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4E5F "也" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x94, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x0, 0x92, 0x0, 0x0, 0x0, 0x0, 0xd, 0x0,
+    0x92, 0x0, 0x3a, 0x0, 0x0, 0xc, 0x0, 0x95,
+    0x66, 0x69, 0x0, 0x0, 0xc, 0x16, 0xc5, 0x0,
+    0x39, 0x0, 0x2, 0x5d, 0x40, 0x92, 0x0, 0x47,
+    0x0, 0x4, 0xc, 0x0, 0x92, 0x0, 0x66, 0x0,
+    0x0, 0xc, 0x0, 0x93, 0x57, 0xd2, 0x0, 0x0,
+    0xc, 0x0, 0x93, 0x7, 0x60, 0x20, 0x0, 0xc,
+    0x0, 0x71, 0x0, 0x0, 0x60, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0x0, 0xa0, 0x0, 0xa, 0xba, 0xaa,
+    0xaa, 0xac, 0xd1,
+
+    /* U+4E86 "了" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x55, 0x55,
+    0x55, 0x57, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xb5,
+    0x0, 0x0, 0x0, 0x4, 0x60, 0x0, 0x0, 0x0,
+    0x29, 0x30, 0x0, 0x0, 0x0, 0x2, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x2a, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x2a, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x2a, 0x0, 0x0, 0x0, 0x2, 0x15, 0xa0,
+    0x0, 0x0, 0x0, 0x17, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x0, 0x0, 0x0,
+
+    /* U+4E88 "予" */
+    0x0, 0x55, 0x55, 0x55, 0x5b, 0x10, 0x0, 0x1,
+    0x0, 0x0, 0x1a, 0x82, 0x0, 0x0, 0x0, 0x54,
+    0x27, 0x10, 0x0, 0x0, 0x0, 0x0, 0x7d, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb4, 0x0, 0x15,
+    0x4, 0x65, 0x55, 0x5e, 0x55, 0x5b, 0xc0, 0x0,
+    0x0, 0x0, 0xd0, 0x3, 0x70, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x17, 0xea, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+4E89 "争" */
+    0x0, 0x0, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x99, 0x0, 0x50, 0x0, 0x0, 0x0, 0x5,
+    0xa5, 0x57, 0xd2, 0x0, 0x0, 0x0, 0x28, 0x0,
+    0x8, 0x0, 0x0, 0x0, 0x2, 0x66, 0x55, 0x96,
+    0x55, 0xd1, 0x0, 0x2, 0x0, 0x0, 0xa1, 0x0,
+    0xb0, 0x0, 0x15, 0x55, 0x55, 0xc6, 0x55, 0xc8,
+    0xa0, 0x1, 0x0, 0x0, 0xa1, 0x0, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0xa1, 0x0, 0xb0, 0x0, 0x0,
+    0x55, 0x55, 0xc6, 0x55, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+4E8B "事" */
+    0x0, 0x0, 0x0, 0x12, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2b, 0x0, 0x4, 0x20, 0x5, 0x55,
+    0x55, 0x6b, 0x55, 0x57, 0x60, 0x0, 0x7, 0x55,
+    0x6b, 0x55, 0x92, 0x0, 0x0, 0xb, 0x0, 0x29,
+    0x0, 0xc0, 0x0, 0x0, 0xc, 0x55, 0x6b, 0x55,
+    0xd0, 0x0, 0x0, 0x3, 0x0, 0x29, 0x0, 0x50,
+    0x0, 0x0, 0x36, 0x55, 0x6b, 0x55, 0xd2, 0x0,
+    0x16, 0x55, 0x55, 0x6b, 0x55, 0xd7, 0xb0, 0x0,
+    0x0, 0x0, 0x29, 0x0, 0xc0, 0x0, 0x0, 0x36,
+    0x55, 0x6b, 0x55, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x39, 0x0, 0x20, 0x0, 0x0, 0x0, 0x17, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+4E8C "二" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x46, 0x55, 0x55, 0x55, 0x98, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x50, 0x6,
+    0x55, 0x55, 0x55, 0x55, 0x56, 0x60,
+
+    /* U+4E94 "五" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x10, 0x0,
+    0x65, 0x55, 0xc6, 0x55, 0x55, 0x30, 0x0, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xa0,
+    0x0, 0x30, 0x0, 0x0, 0x36, 0x58, 0xa5, 0x55,
+    0xd0, 0x0, 0x0, 0x0, 0x6, 0x50, 0x1, 0xa0,
+    0x0, 0x0, 0x0, 0x9, 0x30, 0x2, 0xa0, 0x0,
+    0x0, 0x0, 0xb, 0x0, 0x2, 0x90, 0x0, 0x0,
+    0x0, 0xc, 0x0, 0x3, 0x90, 0x0, 0x0, 0x0,
+    0xb, 0x0, 0x3, 0x80, 0x70, 0x5, 0x55, 0x56,
+    0x55, 0x55, 0x66, 0x72,
+
+    /* U+4E9B "些" */
+    0x0, 0x0, 0x92, 0x0, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0xb0, 0x0, 0xb0, 0x2, 0x0, 0x0, 0xc0,
+    0xb0, 0x50, 0xb0, 0x3c, 0x40, 0x0, 0xb0, 0xb5,
+    0x52, 0xb5, 0x50, 0x0, 0x0, 0xb0, 0xb0, 0x0,
+    0xb0, 0x0, 0x50, 0x0, 0xb0, 0xb0, 0x1, 0xb0,
+    0x0, 0x90, 0x5, 0xd9, 0xa6, 0x41, 0x9a, 0x99,
+    0xc2, 0x8, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x15, 0x55, 0x55, 0x56, 0xd3, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0x60, 0x6, 0x55, 0x55,
+    0x55, 0x55, 0x56, 0x60,
+
+    /* U+4EA1 "亡" */
+    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0x0, 0x4, 0x80, 0x16, 0x5d, 0x55, 0x55,
+    0x55, 0x55, 0x51, 0x0, 0xd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0xe, 0x55,
+    0x55, 0x55, 0x7d, 0x20, 0x0, 0x2, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+4EA4 "交" */
+    0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x37, 0x0, 0x6, 0x50, 0x6, 0x55, 0x65,
+    0x55, 0x65, 0x55, 0x50, 0x0, 0x0, 0xc4, 0x0,
+    0x18, 0x30, 0x0, 0x0, 0xa, 0x40, 0x0, 0x10,
+    0xb9, 0x0, 0x1, 0x81, 0x31, 0x0, 0x88, 0xc,
+    0x0, 0x3, 0x0, 0x6, 0x0, 0xd1, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0x26, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xab, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xba, 0x0, 0x0, 0x0, 0x0, 0x0, 0x69,
+    0x13, 0xc7, 0x20, 0x0, 0x1, 0x57, 0x20, 0x0,
+    0x6, 0xcf, 0xc1, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x10,
+
+    /* U+4EA6 "亦" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x58, 0x0, 0x8, 0x20, 0x65, 0x55, 0xd5, 0x5d,
+    0x55, 0x54, 0x0, 0x0, 0xc, 0x0, 0xc0, 0x0,
+    0x0, 0x3, 0xa0, 0xc0, 0xc, 0x12, 0x0, 0x0,
+    0x76, 0xc, 0x0, 0xc0, 0x82, 0x0, 0xb, 0x0,
+    0xb0, 0xc, 0x1, 0xd1, 0x3, 0x50, 0x39, 0x0,
+    0xc0, 0x8, 0x90, 0x60, 0x9, 0x20, 0xc, 0x0,
+    0x27, 0x0, 0x2, 0x90, 0x0, 0xc0, 0x0, 0x0,
+    0x1, 0x90, 0x4, 0x4e, 0x0, 0x0, 0x3, 0x50,
+    0x0, 0x1a, 0x90, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+4EAC "京" */
+    0x0, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc2, 0x0, 0x0, 0x0, 0x5, 0x55,
+    0x55, 0x96, 0x55, 0x5a, 0xc0, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x55, 0x55,
+    0x55, 0xa0, 0x0, 0x0, 0xd, 0x0, 0x0, 0x2,
+    0xb0, 0x0, 0x0, 0xd, 0x0, 0x0, 0x2, 0xa0,
+    0x0, 0x0, 0xd, 0x55, 0x55, 0x56, 0xb0, 0x0,
+    0x0, 0x8, 0x0, 0xd0, 0x1, 0x30, 0x0, 0x0,
+    0x3, 0xa0, 0xd0, 0x6, 0x0, 0x0, 0x0, 0x1b,
+    0x20, 0xd0, 0x1, 0xb2, 0x0, 0x1, 0x91, 0x0,
+    0xd0, 0x0, 0x3e, 0x0, 0x15, 0x0, 0x4c, 0xd0,
+    0x0, 0x7, 0x0, 0x0, 0x0, 0x1, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+4EBA "人" */
+    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xd6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xb8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0x76, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0x31, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x2c, 0x0, 0xa2, 0x0, 0x0, 0x0,
+    0x0, 0xa4, 0x0, 0x2c, 0x0, 0x0, 0x0, 0x5,
+    0x80, 0x0, 0x8, 0xb0, 0x0, 0x0, 0x57, 0x0,
+    0x0, 0x0, 0xbd, 0x61, 0x5, 0x40, 0x0, 0x0,
+    0x0, 0x9, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4EC0 "什" */
+    0x0, 0x0, 0x20, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x4, 0xd0, 0x0, 0xc2, 0x0, 0x0, 0x0, 0x9,
+    0x50, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xd, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0,
+    0xc0, 0x0, 0x10, 0x0, 0xac, 0x36, 0x55, 0xd5,
+    0x58, 0x90, 0x5, 0x3c, 0x0, 0x0, 0xc0, 0x0,
+    0x0, 0x15, 0xc, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0x10, 0xc, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0xd, 0x0, 0x0,
+    0xc0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x20,
+    0x0, 0x0,
+
+    /* U+4ECA "今" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x76, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c,
+    0x0, 0x90, 0x0, 0x0, 0x0, 0x1, 0xc2, 0x0,
+    0x3b, 0x10, 0x0, 0x0, 0x1a, 0x11, 0x92, 0x3,
+    0xd7, 0x10, 0x2, 0x81, 0x0, 0x3b, 0x0, 0x1b,
+    0xd2, 0x14, 0x0, 0x0, 0x1, 0x0, 0x20, 0x0,
+    0x0, 0x16, 0x55, 0x55, 0x58, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x86, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x0,
+    0x0, 0x0,
+
+    /* U+4ECB "介" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0x86, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1c,
+    0x0, 0x90, 0x0, 0x0, 0x0, 0x0, 0xa3, 0x0,
+    0x2b, 0x10, 0x0, 0x0, 0x8, 0x42, 0x0, 0x44,
+    0xd8, 0x20, 0x1, 0x71, 0x2c, 0x0, 0xa4, 0x1a,
+    0x80, 0x3, 0x0, 0x29, 0x0, 0xa2, 0x0, 0x0,
+    0x0, 0x0, 0x39, 0x0, 0xa2, 0x0, 0x0, 0x0,
+    0x0, 0x56, 0x0, 0xa2, 0x0, 0x0, 0x0, 0x0,
+    0xb1, 0x0, 0xa2, 0x0, 0x0, 0x0, 0x6, 0x60,
+    0x0, 0xa2, 0x0, 0x0, 0x0, 0x65, 0x0, 0x0,
+    0xa2, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x30,
+    0x0, 0x0,
+
+    /* U+4ECD "仍" */
+    0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xb0, 0x0, 0x0, 0x13, 0x0, 0x0, 0xa,
+    0x25, 0x6d, 0x55, 0x99, 0x0, 0x0, 0x1a, 0x0,
+    0xc, 0x0, 0x84, 0x0, 0x0, 0x7c, 0x0, 0xb,
+    0x0, 0xb0, 0x0, 0x0, 0x8c, 0x0, 0x1a, 0x0,
+    0xc0, 0x40, 0x6, 0x1c, 0x0, 0x29, 0x2, 0x85,
+    0xd1, 0x12, 0xc, 0x0, 0x47, 0x0, 0x0, 0xc0,
+    0x0, 0xc, 0x0, 0x74, 0x0, 0x1, 0xb0, 0x0,
+    0xc, 0x0, 0xb0, 0x0, 0x3, 0x90, 0x0, 0xc,
+    0x3, 0x80, 0x0, 0x6, 0x70, 0x0, 0xc, 0x9,
+    0x0, 0x4, 0x3c, 0x30, 0x0, 0xd, 0x62, 0x0,
+    0x1, 0xc9, 0x0, 0x0, 0x3, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4ED5 "仕" */
+    0x0, 0x0, 0x20, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x3, 0xe1, 0x0, 0xd3, 0x0, 0x0, 0x0, 0x8,
+    0x70, 0x0, 0xd0, 0x0, 0x0, 0x0, 0xd, 0x0,
+    0x0, 0xd0, 0x0, 0x0, 0x0, 0x4c, 0x0, 0x0,
+    0xd0, 0x0, 0x20, 0x0, 0xbe, 0x26, 0x55, 0xd5,
+    0x57, 0x90, 0x4, 0x4d, 0x0, 0x0, 0xd0, 0x0,
+    0x0, 0x6, 0xd, 0x0, 0x0, 0xd0, 0x0, 0x0,
+    0x10, 0xd, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0, 0xd,
+    0x0, 0x0, 0xd0, 0x0, 0x0, 0x0, 0xd, 0x0,
+    0x0, 0xd0, 0x7, 0x10, 0x0, 0xe, 0x6, 0x55,
+    0x55, 0x55, 0x30, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4ED6 "他" */
+    0x0, 0x1, 0x30, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x6, 0xd0, 0x0, 0xb2, 0x0, 0x0, 0x0, 0xa,
+    0x40, 0x0, 0xb0, 0x0, 0x0, 0x0, 0x1c, 0x0,
+    0x90, 0xb0, 0x2, 0x0, 0x0, 0x7a, 0x0, 0xc0,
+    0xb5, 0x5d, 0x10, 0x0, 0xac, 0x14, 0xd5, 0xc0,
+    0xb, 0x0, 0x5, 0x3c, 0x21, 0xb0, 0xb0, 0xc,
+    0x0, 0x6, 0xc, 0x0, 0xb0, 0xb0, 0xc, 0x0,
+    0x0, 0xc, 0x0, 0xb0, 0xb1, 0x7d, 0x0, 0x0,
+    0xc, 0x0, 0xb0, 0xb0, 0x23, 0x0, 0x0, 0xc,
+    0x0, 0xb0, 0x70, 0x0, 0x50, 0x0, 0xc, 0x0,
+    0xb0, 0x0, 0x0, 0x90, 0x0, 0xc, 0x0, 0xa9,
+    0x99, 0x99, 0xd3, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4ED8 "付" */
+    0x0, 0x0, 0x30, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x1, 0xe1, 0x0, 0x0, 0xd2, 0x0, 0x0, 0x6,
+    0x70, 0x0, 0x0, 0xd0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0xd0, 0x10, 0x0, 0x3c, 0x5, 0x55,
+    0x55, 0xe5, 0xa1, 0x0, 0xad, 0x0, 0x0, 0x0,
+    0xd0, 0x0, 0x4, 0x5c, 0x0, 0x40, 0x0, 0xd0,
+    0x0, 0x6, 0xc, 0x0, 0x67, 0x0, 0xd0, 0x0,
+    0x10, 0xc, 0x0, 0xe, 0x0, 0xd0, 0x0, 0x0,
+    0xc, 0x0, 0x2, 0x0, 0xd0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0xd0, 0x0, 0x0, 0xd, 0x0, 0x0,
+    0x5c, 0xd0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1,
+    0x10, 0x0,
+
+    /* U+4EE3 "代" */
+    0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xf2, 0x4, 0x90, 0x40, 0x0, 0x0, 0x6,
+    0x80, 0x3, 0x90, 0x3d, 0x20, 0x0, 0xc, 0x10,
+    0x2, 0xa0, 0x5, 0x40, 0x0, 0x4d, 0x10, 0x1,
+    0xb0, 0x3, 0x70, 0x0, 0xad, 0x15, 0x55, 0xd5,
+    0x54, 0x30, 0x6, 0x3c, 0x0, 0x0, 0xc0, 0x0,
+    0x0, 0x15, 0xc, 0x0, 0x0, 0xa2, 0x0, 0x0,
+    0x10, 0xc, 0x0, 0x0, 0x76, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x2c, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0xa, 0x60, 0x32, 0x0, 0xc, 0x0,
+    0x0, 0x1, 0xd6, 0x81, 0x0, 0xd, 0x0, 0x0,
+    0x0, 0x1b, 0xf2, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x0, 0x31,
+
+    /* U+4EE4 "令" */
+    0x0, 0x0, 0x0, 0x31, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xb4, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1d,
+    0x10, 0x90, 0x0, 0x0, 0x0, 0x0, 0xb5, 0x20,
+    0x2a, 0x0, 0x0, 0x0, 0x9, 0x50, 0x87, 0x4,
+    0xd3, 0x0, 0x0, 0x72, 0x0, 0xd, 0x0, 0x3d,
+    0xc1, 0x14, 0x5, 0x55, 0x56, 0x57, 0xb0, 0x10,
+    0x0, 0x1, 0x0, 0x0, 0xc, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x73, 0x0, 0x0, 0x0, 0x0,
+    0x47, 0x23, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xac, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30,
+    0x0, 0x0,
+
+    /* U+4EE5 "以" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x10,
+    0x0, 0x0, 0x3c, 0x0, 0xd, 0x10, 0x70, 0x0,
+    0x3b, 0x0, 0xd, 0x0, 0x3d, 0x0, 0x3a, 0x0,
+    0xd, 0x0, 0xc, 0x40, 0x3a, 0x0, 0xd, 0x0,
+    0x2, 0x0, 0x49, 0x0, 0xd, 0x0, 0x0, 0x0,
+    0x58, 0x0, 0xd, 0x0, 0x4, 0x0, 0x85, 0x0,
+    0xd, 0x3, 0x80, 0x0, 0xd1, 0x0, 0xd, 0x99,
+    0x0, 0x5, 0xa8, 0x0, 0xe, 0x80, 0x0, 0x3c,
+    0x3, 0xd1, 0x1, 0x0, 0x7, 0x80, 0x0, 0x97,
+    0x0, 0x35, 0x61, 0x0, 0x0, 0x12, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+4EEE "仮" */
+    0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xd0, 0x10, 0x4, 0x8d, 0x70, 0x0, 0x8,
+    0x50, 0xc4, 0x42, 0x0, 0x0, 0x0, 0xb, 0x0,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x0, 0xc5,
+    0x55, 0x59, 0x30, 0x0, 0x9b, 0x0, 0xb4, 0x0,
+    0xc, 0x10, 0x6, 0x1b, 0x0, 0xc4, 0x10, 0x1a,
+    0x0, 0x2, 0xb, 0x0, 0xb0, 0x60, 0x74, 0x0,
+    0x0, 0xb, 0x3, 0x80, 0x80, 0xb0, 0x0, 0x0,
+    0xb, 0x6, 0x40, 0x3b, 0x70, 0x0, 0x0, 0xb,
+    0x9, 0x0, 0x2e, 0x50, 0x0, 0x0, 0xb, 0x16,
+    0x4, 0x91, 0xb7, 0x0, 0x0, 0xb, 0x62, 0x64,
+    0x0, 0x8, 0xd2, 0x0, 0x0, 0x2, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4EF6 "件" */
+    0x0, 0x0, 0x30, 0x0, 0x4, 0x0, 0x0, 0x0,
+    0x2, 0xf1, 0x0, 0xe, 0x0, 0x0, 0x0, 0x8,
+    0x70, 0xa5, 0xc, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0xd0, 0xc, 0x0, 0x20, 0x0, 0x6e, 0x1, 0xb5,
+    0x5d, 0x56, 0x70, 0x0, 0x9c, 0x6, 0x20, 0xc,
+    0x0, 0x0, 0x6, 0x1c, 0x5, 0x0, 0xc, 0x0,
+    0x0, 0x13, 0xc, 0x5, 0x55, 0x5d, 0x55, 0xa4,
+    0x0, 0xc, 0x1, 0x0, 0xc, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0xd, 0x0, 0x0, 0x0, 0xd, 0x0, 0x0,
+    0xd, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x2,
+    0x0, 0x0,
+
+    /* U+4EFB "任" */
+    0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xe0, 0x0, 0x0, 0x14, 0x0, 0x0, 0x6,
+    0x70, 0x35, 0x89, 0xa9, 0x10, 0x0, 0xc, 0x2,
+    0x10, 0xb1, 0x0, 0x0, 0x0, 0x4b, 0x0, 0x0,
+    0xb1, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0, 0xb1,
+    0x0, 0x0, 0x5, 0x3c, 0x0, 0x0, 0xb1, 0x3,
+    0x40, 0x15, 0xc, 0x26, 0x55, 0xc5, 0x55, 0x40,
+    0x0, 0xc, 0x0, 0x0, 0xb1, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0xb1, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0xb1, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0xb1, 0x0, 0x30, 0x0, 0xd, 0x36, 0x55,
+    0x75, 0x56, 0x70, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4EFD "份" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x0, 0xd1, 0x6, 0x7, 0x0, 0x0, 0x0, 0x4,
+    0x90, 0x2c, 0x6, 0x10, 0x0, 0x0, 0xb, 0x10,
+    0x84, 0x1, 0x70, 0x0, 0x0, 0x3a, 0x0, 0xa0,
+    0x0, 0x93, 0x0, 0x0, 0x9d, 0x7, 0x20, 0x0,
+    0x1d, 0x60, 0x5, 0x2c, 0x34, 0x55, 0x55, 0x84,
+    0xa3, 0x13, 0xc, 0x20, 0xd, 0x0, 0xa1, 0x0,
+    0x0, 0xc, 0x0, 0x1b, 0x0, 0xb0, 0x0, 0x0,
+    0xc, 0x0, 0x38, 0x0, 0xb0, 0x0, 0x0, 0xc,
+    0x0, 0x92, 0x0, 0xb0, 0x0, 0x0, 0xc, 0x2,
+    0x80, 0x22, 0xc0, 0x0, 0x0, 0xc, 0x36, 0x0,
+    0x3d, 0x60, 0x0, 0x0, 0x2, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4F01 "企" */
+    0x0, 0x0, 0x0, 0x12, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9c, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xd4, 0x30, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0x30, 0x73, 0x0, 0x0, 0x0, 0x0, 0x95, 0x2,
+    0xa, 0x50, 0x0, 0x0, 0x8, 0x40, 0xe, 0x10,
+    0xab, 0x41, 0x1, 0x72, 0x0, 0xc, 0x0, 0x6,
+    0x91, 0x3, 0x0, 0xe1, 0xc, 0x0, 0x60, 0x0,
+    0x0, 0x0, 0xc0, 0xd, 0x55, 0x61, 0x0, 0x0,
+    0x0, 0xc0, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc0, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc0,
+    0xc, 0x0, 0x2, 0x40, 0x5, 0x55, 0x75, 0x57,
+    0x55, 0x56, 0x70,
+
+    /* U+4F0A "伊" */
+    0x0, 0x2, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0x90, 0x0, 0x0, 0x4, 0x0, 0x0, 0xc,
+    0x16, 0x5c, 0x55, 0x5d, 0x0, 0x0, 0x39, 0x0,
+    0xc, 0x0, 0xc, 0x0, 0x0, 0x9b, 0x0, 0xc,
+    0x0, 0xc, 0x20, 0x2, 0x6c, 0x46, 0x5d, 0x55,
+    0x5d, 0x74, 0x6, 0xc, 0x0, 0xc, 0x0, 0xc,
+    0x0, 0x0, 0xc, 0x0, 0xc, 0x0, 0xc, 0x0,
+    0x0, 0xc, 0x7, 0x5d, 0x55, 0x5c, 0x0, 0x0,
+    0xc, 0x0, 0x2a, 0x0, 0x5, 0x0, 0x0, 0xc,
+    0x0, 0x83, 0x0, 0x0, 0x0, 0x0, 0xc, 0x3,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0xc, 0x35, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4F11 "休" */
+    0x0, 0x0, 0x20, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x2, 0xd1, 0x0, 0xc2, 0x0, 0x0, 0x0, 0x8,
+    0x50, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xb, 0x0,
+    0x0, 0xc0, 0x3, 0x40, 0x0, 0x6b, 0x36, 0x5a,
+    0xf7, 0x55, 0x50, 0x0, 0xac, 0x0, 0xc, 0xd5,
+    0x0, 0x0, 0x6, 0x2c, 0x0, 0x2a, 0xc3, 0x40,
+    0x0, 0x13, 0xc, 0x0, 0xa2, 0xc0, 0xa0, 0x0,
+    0x0, 0xc, 0x3, 0x80, 0xc0, 0x67, 0x0, 0x0,
+    0xc, 0x8, 0x0, 0xc0, 0xc, 0x70, 0x0, 0xc,
+    0x51, 0x0, 0xc0, 0x2, 0x92, 0x0, 0xc, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0xc0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x20,
+    0x0, 0x0,
+
+    /* U+4F1A "会" */
+    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0x47, 0x10, 0x0, 0x0, 0x0, 0x0, 0x68,
+    0x0, 0xa2, 0x0, 0x0, 0x0, 0x3, 0x90, 0x0,
+    0x1c, 0x70, 0x0, 0x0, 0x3a, 0x55, 0x55, 0x79,
+    0x9f, 0xa2, 0x4, 0x40, 0x10, 0x0, 0x0, 0x2,
+    0x20, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6, 0x0,
+    0x2, 0x65, 0x58, 0x95, 0x55, 0x58, 0x30, 0x0,
+    0x0, 0xd, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x85, 0x0, 0x64, 0x0, 0x0, 0x0, 0x6, 0x50,
+    0x0, 0x8, 0x90, 0x0, 0x0, 0x5e, 0xca, 0x87,
+    0x65, 0xc5, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x21, 0x0,
+
+    /* U+4F1D "伝" */
+    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe3, 0x0, 0x0, 0x1, 0x0, 0x0, 0x5,
+    0xa0, 0x55, 0x55, 0x68, 0x0, 0x0, 0xc, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4b, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xad, 0x15, 0x55, 0x55,
+    0x56, 0xc1, 0x7, 0x1c, 0x1, 0x0, 0xd2, 0x0,
+    0x0, 0x11, 0xc, 0x0, 0x3, 0xa0, 0x0, 0x0,
+    0x0, 0xc, 0x0, 0x9, 0x20, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x29, 0x0, 0x52, 0x0, 0x0, 0xc,
+    0x0, 0x90, 0x0, 0xc, 0x10, 0x0, 0xc, 0x8,
+    0xa7, 0x86, 0x5a, 0x80, 0x0, 0xd, 0x4, 0x62,
+    0x0, 0x3, 0x50, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4F38 "伸" */
+    0x0, 0x1, 0x0, 0x0, 0x12, 0x0, 0x0, 0x0,
+    0x8, 0x70, 0x0, 0x2b, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x2a, 0x0, 0x20, 0x0, 0x39, 0xb,
+    0x55, 0x6b, 0x55, 0xe0, 0x0, 0xab, 0xc, 0x0,
+    0x2a, 0x0, 0xc0, 0x2, 0x9a, 0xc, 0x0, 0x2a,
+    0x0, 0xc0, 0x8, 0x1a, 0xc, 0x55, 0x6b, 0x55,
+    0xc0, 0x11, 0x1a, 0xc, 0x0, 0x2a, 0x0, 0xc0,
+    0x0, 0x1a, 0xc, 0x55, 0x6b, 0x55, 0xc0, 0x0,
+    0x1a, 0x8, 0x0, 0x2a, 0x0, 0x80, 0x0, 0x1a,
+    0x0, 0x0, 0x2a, 0x0, 0x0, 0x0, 0x1a, 0x0,
+    0x0, 0x2a, 0x0, 0x0, 0x0, 0x2b, 0x0, 0x0,
+    0x2a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0,
+
+    /* U+4F3C "似" */
+    0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x70, 0x0, 0x0, 0x8, 0x20, 0x0, 0xc,
+    0x3, 0x1, 0x0, 0xc, 0x10, 0x0, 0x48, 0xb,
+    0x14, 0x60, 0xc, 0x0, 0x0, 0xab, 0xb, 0x0,
+    0xe1, 0xd, 0x0, 0x2, 0x7b, 0xb, 0x0, 0x60,
+    0xd, 0x0, 0x7, 0xb, 0xb, 0x0, 0x0, 0xd,
+    0x0, 0x10, 0xb, 0xb, 0x0, 0x0, 0x3b, 0x0,
+    0x0, 0xb, 0xb, 0x0, 0x50, 0x77, 0x0, 0x0,
+    0xb, 0xb, 0x59, 0x10, 0xd6, 0x0, 0x0, 0xb,
+    0xc, 0x90, 0xa, 0x63, 0xa0, 0x0, 0xb, 0x2,
+    0x0, 0x96, 0x0, 0x97, 0x0, 0x1b, 0x0, 0x56,
+    0x10, 0x0, 0x23, 0x0, 0x1, 0x3, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4F46 "但" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x31, 0x0, 0x0, 0x2, 0x0, 0x0, 0x2c,
+    0xc, 0x55, 0x55, 0x5e, 0x0, 0x0, 0x84, 0xc,
+    0x0, 0x0, 0xc, 0x0, 0x1, 0xe1, 0xc, 0x0,
+    0x0, 0xc, 0x0, 0x7, 0xd0, 0xc, 0x55, 0x55,
+    0x5c, 0x0, 0x25, 0xc0, 0xc, 0x0, 0x0, 0xc,
+    0x0, 0x30, 0xc0, 0xc, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0xc0, 0xc, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0xc0, 0xc, 0x55, 0x55, 0x5c, 0x0, 0x0, 0xc0,
+    0x7, 0x0, 0x0, 0x3, 0x0, 0x0, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x40, 0x0, 0xc2, 0x65, 0x55,
+    0x55, 0x55, 0x71, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4F4D "位" */
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xc0, 0x3, 0x80, 0x0, 0x0, 0x0, 0x9,
+    0x50, 0x0, 0xd2, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0x20, 0x4, 0x50, 0x0, 0x5a, 0x16, 0x55,
+    0x55, 0x55, 0x40, 0x0, 0xac, 0x0, 0x20, 0x0,
+    0x87, 0x0, 0x4, 0x4b, 0x0, 0x80, 0x0, 0xa3,
+    0x0, 0x5, 0xb, 0x0, 0x74, 0x0, 0xb0, 0x0,
+    0x0, 0xb, 0x0, 0x3b, 0x1, 0x80, 0x0, 0x0,
+    0xb, 0x0, 0x1d, 0x6, 0x30, 0x0, 0x0, 0xb,
+    0x0, 0x4, 0x8, 0x0, 0x0, 0x0, 0xb, 0x0,
+    0x0, 0x6, 0x0, 0x70, 0x0, 0xb, 0x36, 0x55,
+    0x55, 0x55, 0x62, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4F4E "低" */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd3, 0x0, 0x0, 0x3b, 0x30, 0x0, 0x49, 0x4,
+    0x46, 0xc7, 0x41, 0x0, 0xa, 0x10, 0xc0, 0xb,
+    0x0, 0x0, 0x2, 0xf2, 0xb, 0x0, 0xb0, 0x0,
+    0x0, 0x9b, 0x10, 0xb0, 0xb, 0x0, 0x20, 0x43,
+    0xa1, 0xc, 0x55, 0xb6, 0x57, 0x41, 0xa, 0x10,
+    0xb0, 0x6, 0x40, 0x0, 0x0, 0xa1, 0xb, 0x0,
+    0x38, 0x0, 0x0, 0xa, 0x10, 0xb0, 0x0, 0xc0,
+    0x1, 0x0, 0xa1, 0xb, 0x36, 0x6, 0x90, 0x70,
+    0xa, 0x10, 0xf7, 0x53, 0xa, 0x99, 0x0, 0xa1,
+    0x3, 0x0, 0xc0, 0x7, 0xa0, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x0,
+
+    /* U+4F4F "住" */
+    0x0, 0x0, 0x20, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe3, 0x7, 0x70, 0x0, 0x0, 0x0, 0x5,
+    0x90, 0x0, 0xd2, 0x0, 0x0, 0x0, 0xb, 0x15,
+    0x55, 0x75, 0x59, 0x90, 0x0, 0x4c, 0x1, 0x0,
+    0xc0, 0x0, 0x0, 0x0, 0x9c, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0x6, 0x1c, 0x0, 0x0, 0xc0, 0x0,
+    0x0, 0x12, 0xc, 0x3, 0x55, 0xd5, 0x6c, 0x10,
+    0x0, 0xc, 0x1, 0x0, 0xc0, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0xc0, 0x0, 0x30, 0x0, 0xd, 0x36, 0x55,
+    0x85, 0x57, 0x80, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4F53 "体" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xb0, 0x0, 0xc2, 0x0, 0x0, 0x0, 0x9,
+    0x40, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xb, 0x0,
+    0x0, 0xc0, 0x2, 0x50, 0x0, 0x69, 0x16, 0x5b,
+    0xf8, 0x55, 0x50, 0x0, 0xac, 0x0, 0xc, 0xc5,
+    0x0, 0x0, 0x6, 0x1b, 0x0, 0x57, 0xc1, 0x60,
+    0x0, 0x13, 0xb, 0x0, 0xa0, 0xc0, 0x91, 0x0,
+    0x0, 0xb, 0x7, 0x30, 0xc0, 0x2c, 0x0, 0x0,
+    0xb, 0x25, 0x0, 0xc0, 0x59, 0xc2, 0x0, 0xb,
+    0x30, 0x75, 0xd5, 0x53, 0x30, 0x0, 0xb, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0xb, 0x0, 0x0,
+    0xc0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x20,
+    0x0, 0x0,
+
+    /* U+4F55 "何" */
+    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xb0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x8,
+    0x46, 0x55, 0x55, 0x59, 0x93, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0xb, 0x0, 0x0, 0x5c, 0x2, 0x0,
+    0x30, 0xb, 0x0, 0x0, 0xab, 0xb, 0x55, 0xb4,
+    0xb, 0x0, 0x6, 0x2b, 0xb, 0x0, 0xa2, 0xb,
+    0x0, 0x2, 0xb, 0xb, 0x0, 0xa2, 0xb, 0x0,
+    0x0, 0xb, 0xb, 0x55, 0xb2, 0xb, 0x0, 0x0,
+    0xb, 0xa, 0x0, 0x40, 0xb, 0x0, 0x0, 0xb,
+    0x0, 0x0, 0x0, 0xb, 0x0, 0x0, 0xb, 0x0,
+    0x0, 0x0, 0xb, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x17, 0xd9, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x20, 0x0,
+
+    /* U+4F59 "余" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x46, 0x10, 0x0, 0x0, 0x0, 0x0, 0x87,
+    0x0, 0x92, 0x0, 0x0, 0x0, 0x7, 0x70, 0x0,
+    0xb, 0x60, 0x0, 0x0, 0x68, 0x65, 0x65, 0x7a,
+    0xae, 0x80, 0x16, 0x10, 0x0, 0xb1, 0x0, 0x4,
+    0x30, 0x0, 0x55, 0x55, 0xc5, 0x55, 0xc3, 0x0,
+    0x0, 0x10, 0x0, 0xb1, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xb0, 0xb1, 0x45, 0x0, 0x0, 0x0, 0x2c,
+    0x10, 0xb1, 0x5, 0xc2, 0x0, 0x2, 0x90, 0x0,
+    0xb0, 0x0, 0x5e, 0x0, 0x15, 0x0, 0x3b, 0xe0,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+4F5C "作" */
+    0x0, 0x0, 0x30, 0x3, 0x10, 0x0, 0x0, 0x0,
+    0x2, 0xd1, 0xa, 0x50, 0x0, 0x0, 0x0, 0x7,
+    0x50, 0x1b, 0x0, 0x0, 0x20, 0x0, 0xb, 0x0,
+    0x87, 0x95, 0x55, 0x91, 0x0, 0x5b, 0x1, 0x90,
+    0xc0, 0x0, 0x0, 0x0, 0xac, 0x7, 0x0, 0xc0,
+    0x0, 0x0, 0x6, 0x2c, 0x21, 0x0, 0xd5, 0x5a,
+    0x70, 0x3, 0xc, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0xd5, 0x56, 0xb0, 0x0, 0xc,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0xd, 0x0, 0x0,
+    0xd0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x20,
+    0x0, 0x0,
+
+    /* U+4F60 "你" */
+    0x0, 0x0, 0x40, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xe1, 0xe, 0x20, 0x0, 0x0, 0x0, 0x8,
+    0x60, 0x58, 0x0, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0xb6, 0x55, 0x58, 0x90, 0x0, 0x7c, 0x2, 0x70,
+    0x30, 0x9, 0x30, 0x1, 0x9c, 0x7, 0x0, 0x94,
+    0x2, 0x0, 0x7, 0x1c, 0x11, 0x51, 0x93, 0x10,
+    0x0, 0x12, 0xc, 0x0, 0xd1, 0x93, 0x53, 0x0,
+    0x0, 0xc, 0x3, 0x70, 0x93, 0xb, 0x20, 0x0,
+    0xc, 0x8, 0x0, 0x93, 0x4, 0xc0, 0x0, 0xc,
+    0x24, 0x0, 0x93, 0x0, 0xc0, 0x0, 0xc, 0x20,
+    0x0, 0xa2, 0x0, 0x0, 0x0, 0xc, 0x0, 0x19,
+    0xe1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x10,
+    0x0, 0x0,
+
+    /* U+4F7F "使" */
+    0x0, 0x0, 0x20, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x3, 0xe1, 0x0, 0xa2, 0x0, 0x0, 0x0, 0x8,
+    0x60, 0x0, 0xa1, 0x1, 0x60, 0x0, 0xc, 0x5,
+    0x55, 0xc5, 0x55, 0x50, 0x0, 0x6b, 0x1, 0x65,
+    0xc5, 0x58, 0x10, 0x0, 0x8b, 0x2, 0x90, 0xa0,
+    0xb, 0x0, 0x5, 0x1b, 0x1, 0x90, 0xa0, 0xb,
+    0x0, 0x12, 0xb, 0x2, 0xb5, 0xc5, 0x5c, 0x0,
+    0x0, 0xb, 0x0, 0x30, 0xb0, 0x2, 0x0, 0x0,
+    0xb, 0x0, 0x5, 0xa0, 0x0, 0x0, 0x0, 0xb,
+    0x0, 0x7, 0x80, 0x0, 0x0, 0x0, 0xb, 0x0,
+    0x2a, 0x7a, 0x30, 0x0, 0x0, 0xb, 0x5, 0x60,
+    0x2, 0xae, 0xa1, 0x0, 0x2, 0x30, 0x0, 0x0,
+    0x0, 0x10,
+
+    /* U+4F86 "來" */
+    0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2c, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2a, 0x0, 0x3, 0x0, 0x1, 0x65, 0x55,
+    0x6c, 0x55, 0x59, 0x50, 0x0, 0x3, 0xb0, 0x2a,
+    0x1, 0xd0, 0x0, 0x0, 0x8, 0x60, 0x2a, 0x4,
+    0x80, 0x0, 0x0, 0x1a, 0x76, 0x3b, 0x9, 0x5a,
+    0x10, 0x0, 0x81, 0x9, 0xbd, 0x64, 0x4, 0x50,
+    0x1, 0x0, 0x6, 0xaa, 0x81, 0x0, 0x0, 0x0,
+    0x0, 0x49, 0x2a, 0xb, 0x20, 0x0, 0x0, 0x5,
+    0x80, 0x2a, 0x1, 0xd6, 0x0, 0x0, 0x64, 0x0,
+    0x2a, 0x0, 0x1b, 0xe3, 0x4, 0x0, 0x0, 0x3b,
+    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x12, 0x0,
+    0x0, 0x0,
+
+    /* U+4F8B "例" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xd0, 0x0, 0x0, 0x0, 0xb2, 0x0, 0x76, 0x57,
+    0x76, 0x80, 0xb, 0x0, 0xb, 0x0, 0x83, 0x0,
+    0x82, 0xb0, 0x2, 0xe1, 0xb, 0x3, 0x1b, 0xb,
+    0x0, 0x8d, 0x1, 0xa5, 0xb5, 0xb0, 0xb0, 0x25,
+    0xb0, 0x73, 0xc, 0xb, 0xb, 0x2, 0xb, 0x7,
+    0x93, 0xa0, 0xb0, 0xb0, 0x0, 0xb2, 0x4, 0x94,
+    0xb, 0xb, 0x0, 0xb, 0x0, 0x1b, 0x0, 0xb0,
+    0xb0, 0x0, 0xb0, 0x8, 0x30, 0x1, 0xb, 0x0,
+    0xb, 0x4, 0x50, 0x0, 0x0, 0xb0, 0x0, 0xb4,
+    0x30, 0x0, 0x3, 0x9e, 0x0, 0x2, 0x0, 0x0,
+    0x0, 0x0, 0x20,
+
+    /* U+4F9B "供" */
+    0x0, 0x0, 0x20, 0x2, 0x0, 0x10, 0x0, 0x0,
+    0x1, 0xe1, 0xd, 0x0, 0xd0, 0x0, 0x0, 0x7,
+    0x70, 0xb, 0x0, 0xb0, 0x0, 0x0, 0xc, 0x0,
+    0xb, 0x0, 0xb0, 0x40, 0x0, 0x6b, 0x6, 0x5c,
+    0x55, 0xc5, 0x60, 0x0, 0xaa, 0x0, 0xb, 0x0,
+    0xb0, 0x0, 0x6, 0x1a, 0x0, 0xb, 0x0, 0xb0,
+    0x0, 0x2, 0xa, 0x0, 0xb, 0x0, 0xb0, 0x30,
+    0x0, 0xa, 0x56, 0x57, 0x55, 0x75, 0x84, 0x0,
+    0xa, 0x0, 0x8, 0x1, 0x10, 0x0, 0x0, 0xa,
+    0x0, 0x79, 0x0, 0x85, 0x0, 0x0, 0xa, 0x3,
+    0x90, 0x0, 0xa, 0x80, 0x0, 0x1b, 0x27, 0x0,
+    0x0, 0x0, 0xb0, 0x0, 0x3, 0x20, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4F9D "依" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x80, 0x3, 0x80, 0x0, 0x0, 0x0, 0xc,
+    0x10, 0x0, 0xc1, 0x2, 0x30, 0x0, 0x29, 0x26,
+    0x56, 0xe5, 0x55, 0x50, 0x0, 0x9c, 0x0, 0x7,
+    0x90, 0x0, 0x0, 0x1, 0x7b, 0x0, 0x1a, 0x50,
+    0x6, 0x0, 0x6, 0xb, 0x0, 0xa1, 0x51, 0x5b,
+    0x20, 0x2, 0xb, 0x6, 0xe1, 0x19, 0x50, 0x0,
+    0x0, 0xb, 0x44, 0xb0, 0xa, 0x0, 0x0, 0x0,
+    0xb, 0x20, 0xb0, 0x6, 0x70, 0x0, 0x0, 0xb,
+    0x0, 0xb0, 0x41, 0xc4, 0x0, 0x0, 0xb, 0x0,
+    0xb9, 0x20, 0x2e, 0x70, 0x0, 0xc, 0x0, 0xa2,
+    0x0, 0x3, 0x60, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4FA1 "価" */
+    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xc0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x8,
+    0x56, 0x58, 0x58, 0x55, 0xa2, 0x0, 0xb, 0x0,
+    0xa, 0x9, 0x10, 0x0, 0x0, 0x6c, 0x0, 0xa,
+    0x9, 0x10, 0x0, 0x0, 0x9a, 0xa, 0x5c, 0x5b,
+    0x55, 0xd0, 0x5, 0x1a, 0xb, 0xa, 0x9, 0x10,
+    0xb0, 0x2, 0xa, 0xb, 0xa, 0x9, 0x10, 0xb0,
+    0x0, 0xa, 0xb, 0xa, 0x9, 0x10, 0xb0, 0x0,
+    0xa, 0xb, 0xa, 0x9, 0x10, 0xb0, 0x0, 0xa,
+    0xb, 0xa, 0x9, 0x10, 0xb0, 0x0, 0xa, 0xb,
+    0x58, 0x57, 0x55, 0xb0, 0x0, 0xb, 0xb, 0x0,
+    0x0, 0x0, 0xa0, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4FBF "便" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x40, 0x0, 0x0, 0x3, 0x40, 0x0, 0x1c,
+    0x36, 0x55, 0xc5, 0x55, 0x40, 0x0, 0x74, 0x6,
+    0x55, 0xc5, 0x58, 0x10, 0x0, 0xd2, 0xb, 0x0,
+    0xb0, 0xb, 0x0, 0x5, 0xc2, 0xc, 0x55, 0xc5,
+    0x5b, 0x0, 0x6, 0x92, 0xb, 0x0, 0xb0, 0xb,
+    0x0, 0x30, 0x92, 0xb, 0x0, 0xb0, 0xb, 0x0,
+    0x0, 0x92, 0xb, 0x55, 0xc5, 0x59, 0x0, 0x0,
+    0x92, 0x1, 0x20, 0xa0, 0x0, 0x0, 0x0, 0x92,
+    0x0, 0x67, 0x60, 0x0, 0x0, 0x0, 0x92, 0x0,
+    0x1e, 0x80, 0x0, 0x0, 0x0, 0x92, 0x5, 0x91,
+    0x5c, 0xb8, 0x70, 0x0, 0x32, 0x51, 0x0, 0x0,
+    0x25, 0x30,
+
+    /* U+4FC2 "係" */
+    0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xe2, 0x0, 0x2, 0x5a, 0x80, 0x0, 0x7,
+    0x73, 0x56, 0xb8, 0x53, 0x30, 0x0, 0xd, 0x0,
+    0x3, 0xb4, 0x14, 0x0, 0x0, 0x5b, 0x0, 0x66,
+    0x0, 0xc8, 0x0, 0x0, 0xbb, 0x5, 0xa8, 0x7c,
+    0x31, 0x0, 0x6, 0x3b, 0x0, 0x4, 0x70, 0x6,
+    0x20, 0x3, 0xb, 0x2, 0xca, 0x77, 0x55, 0xd0,
+    0x0, 0xb, 0x0, 0x41, 0xb, 0x0, 0x90, 0x0,
+    0xb, 0x0, 0x2a, 0xb, 0x51, 0x0, 0x0, 0xb,
+    0x0, 0xb3, 0xb, 0xa, 0x40, 0x0, 0xb, 0x7,
+    0x30, 0xb, 0x1, 0xe0, 0x0, 0xc, 0x22, 0x6,
+    0xc9, 0x0, 0x20, 0x0, 0x1, 0x0, 0x0, 0x30,
+    0x0, 0x0,
+
+    /* U+4FDD "保" */
+    0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xd0, 0x85, 0x55, 0x5b, 0x10, 0x0, 0x8,
+    0x50, 0xc0, 0x0, 0xb, 0x0, 0x0, 0xb, 0x0,
+    0xc0, 0x0, 0xb, 0x0, 0x0, 0x6b, 0x0, 0xc0,
+    0x0, 0xb, 0x0, 0x0, 0xaa, 0x0, 0xd5, 0xb5,
+    0x5a, 0x0, 0x6, 0x1a, 0x0, 0x0, 0xb0, 0x0,
+    0x0, 0x1, 0xa, 0x45, 0x56, 0xd6, 0x55, 0xa2,
+    0x0, 0xa, 0x0, 0x9, 0xd4, 0x20, 0x0, 0x0,
+    0xa, 0x0, 0x38, 0xb0, 0x80, 0x0, 0x0, 0xa,
+    0x0, 0x90, 0xb0, 0x39, 0x0, 0x0, 0xa, 0x7,
+    0x10, 0xb0, 0x6, 0xd2, 0x0, 0x1b, 0x40, 0x0,
+    0xb0, 0x0, 0x10, 0x0, 0x1, 0x0, 0x0, 0x20,
+    0x0, 0x0,
+
+    /* U+4FE1 "信" */
+    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xd0, 0x0, 0xa1, 0x0, 0x0, 0x0, 0x8,
+    0x50, 0x0, 0x75, 0x1, 0x50, 0x0, 0xb, 0x17,
+    0x55, 0x55, 0x55, 0x50, 0x0, 0x6a, 0x0, 0x0,
+    0x0, 0x6, 0x0, 0x0, 0xba, 0x1, 0x65, 0x55,
+    0x55, 0x10, 0x6, 0x49, 0x0, 0x0, 0x0, 0x6,
+    0x0, 0x13, 0x19, 0x1, 0x65, 0x55, 0x55, 0x20,
+    0x0, 0x19, 0x0, 0x75, 0x55, 0x58, 0x20, 0x0,
+    0x19, 0x0, 0xb0, 0x0, 0xb, 0x0, 0x0, 0x19,
+    0x0, 0xb0, 0x0, 0xb, 0x0, 0x0, 0x19, 0x0,
+    0xc5, 0x55, 0x5c, 0x0, 0x0, 0x19, 0x0, 0xa0,
+    0x0, 0xa, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+4FEE "修" */
+    0x0, 0x3, 0x0, 0x2, 0x20, 0x0, 0x0, 0x0,
+    0xd, 0x10, 0x9, 0x60, 0x0, 0x0, 0x0, 0x57,
+    0x0, 0xd, 0x55, 0x59, 0x10, 0x0, 0xa1, 0x40,
+    0x65, 0x30, 0x69, 0x0, 0x2, 0xf2, 0xb2, 0x40,
+    0x78, 0x80, 0x0, 0x8, 0xa1, 0xa0, 0x0, 0x8b,
+    0x60, 0x0, 0x34, 0x91, 0xa0, 0x47, 0x14, 0x6c,
+    0x90, 0x10, 0x91, 0xa3, 0x10, 0x69, 0x20, 0x0,
+    0x0, 0x91, 0xa0, 0x17, 0x30, 0xa6, 0x0, 0x0,
+    0x91, 0xa1, 0x20, 0x2a, 0x60, 0x20, 0x0, 0x91,
+    0xa0, 0x17, 0x70, 0x2c, 0x90, 0x0, 0x91, 0x1,
+    0x30, 0x28, 0xa2, 0x0, 0x0, 0x91, 0x1, 0x57,
+    0x71, 0x0, 0x0, 0x0, 0x20, 0x13, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+500B "個" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc7, 0x30, 0x0, 0x0, 0x30, 0x0, 0x2c, 0xc,
+    0x55, 0x65, 0x5c, 0x20, 0x8, 0x40, 0xb0, 0xa,
+    0x0, 0xb0, 0x0, 0xe2, 0xb, 0x35, 0xa6, 0x6b,
+    0x0, 0x6e, 0x0, 0xb0, 0x8, 0x0, 0xb0, 0x16,
+    0xb0, 0xb, 0x1, 0x82, 0xb, 0x2, 0xb, 0x0,
+    0xb0, 0xc5, 0xc1, 0xb0, 0x0, 0xb0, 0xb, 0xa,
+    0xa, 0xb, 0x0, 0xb, 0x0, 0xb0, 0xc5, 0xc0,
+    0xb0, 0x0, 0xb0, 0xb, 0x8, 0x6, 0xb, 0x0,
+    0xb, 0x0, 0xc5, 0x55, 0x55, 0xc0, 0x0, 0xb0,
+    0xb, 0x0, 0x0, 0xa, 0x0, 0x2, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+5011 "們" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0x41, 0x4, 0x3, 0x0, 0x40, 0x0, 0x4a,
+    0x2b, 0x5c, 0x1d, 0x56, 0xb0, 0x0, 0x93, 0x2a,
+    0xb, 0xb, 0x2, 0x90, 0x0, 0xe1, 0x2b, 0x5c,
+    0xc, 0x56, 0x90, 0x5, 0xf0, 0x2a, 0xb, 0xb,
+    0x2, 0x90, 0x8, 0xb0, 0x2b, 0x5a, 0xa, 0x56,
+    0x90, 0x31, 0xb0, 0x2a, 0x0, 0x0, 0x2, 0x90,
+    0x0, 0xb0, 0x2a, 0x0, 0x0, 0x2, 0x90, 0x0,
+    0xb0, 0x2a, 0x0, 0x0, 0x2, 0x90, 0x0, 0xb0,
+    0x2a, 0x0, 0x0, 0x2, 0x90, 0x0, 0xb0, 0x2a,
+    0x0, 0x0, 0x2, 0x90, 0x0, 0xb0, 0x2a, 0x0,
+    0x0, 0x6c, 0x80, 0x0, 0x30, 0x11, 0x0, 0x0,
+    0x3, 0x0,
+
+    /* U+5019 "候" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1e, 0x10, 0x45, 0x55, 0xa0, 0x0, 0x0, 0x58,
+    0x0, 0x0, 0x3, 0x90, 0x0, 0x0, 0xa2, 0x82,
+    0x0, 0x5, 0x61, 0x30, 0x0, 0xe1, 0xa2, 0x7a,
+    0x55, 0x55, 0x40, 0x6, 0xe0, 0xa0, 0x57, 0x0,
+    0x11, 0x0, 0x16, 0xb0, 0xa0, 0x85, 0xa6, 0x65,
+    0x0, 0x20, 0xb0, 0xa0, 0x30, 0xa2, 0x0, 0x0,
+    0x0, 0xb0, 0xa2, 0x65, 0xc7, 0x58, 0x60, 0x0,
+    0xb0, 0xa0, 0x0, 0xb6, 0x0, 0x0, 0x0, 0xb0,
+    0xa0, 0x6, 0x52, 0x60, 0x0, 0x0, 0xb0, 0x0,
+    0x29, 0x0, 0x87, 0x0, 0x0, 0xb0, 0x4, 0x60,
+    0x0, 0xa, 0xb1, 0x0, 0x20, 0x11, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+501F "借" */
+    0x0, 0x0, 0x10, 0x3, 0x0, 0x30, 0x0, 0x0,
+    0x1, 0xe1, 0xb, 0x10, 0xd0, 0x0, 0x0, 0x6,
+    0x70, 0xa, 0x0, 0xb0, 0x30, 0x0, 0xc, 0x14,
+    0x5c, 0x55, 0xc5, 0x60, 0x0, 0x57, 0x0, 0xa,
+    0x0, 0xb0, 0x0, 0x0, 0xba, 0x0, 0xa, 0x0,
+    0xb0, 0x51, 0x7, 0x39, 0x36, 0x55, 0x55, 0x55,
+    0x53, 0x1, 0x19, 0x0, 0x75, 0x55, 0x59, 0x0,
+    0x0, 0x19, 0x0, 0xc0, 0x0, 0xb, 0x0, 0x0,
+    0x19, 0x0, 0xc0, 0x0, 0xb, 0x0, 0x0, 0x19,
+    0x0, 0xd5, 0x55, 0x5b, 0x0, 0x0, 0x19, 0x0,
+    0xc0, 0x0, 0xb, 0x0, 0x0, 0x2a, 0x0, 0xd5,
+    0x55, 0x5b, 0x0, 0x0, 0x12, 0x0, 0x20, 0x0,
+    0x1, 0x0,
+
+    /* U+5024 "値" */
+    0x0, 0x3, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0xc, 0x30, 0x0, 0xc2, 0x0, 0x0, 0x0, 0x2a,
+    0x35, 0x55, 0xd5, 0x56, 0xa0, 0x0, 0x84, 0x10,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0xe2, 0x0, 0x86,
+    0xc5, 0x5a, 0x0, 0x7, 0xd1, 0x51, 0xb0, 0x0,
+    0x1a, 0x0, 0x16, 0xa1, 0xc0, 0xc5, 0x55, 0x5a,
+    0x0, 0x20, 0xa1, 0xb0, 0xb0, 0x0, 0x1a, 0x0,
+    0x0, 0xa1, 0xb0, 0xc5, 0x55, 0x5a, 0x0, 0x0,
+    0xa1, 0xb0, 0xb0, 0x0, 0x1a, 0x0, 0x0, 0xa1,
+    0xb0, 0xc5, 0x55, 0x5a, 0x0, 0x0, 0xa1, 0xb0,
+    0x90, 0x0, 0x7, 0x10, 0x0, 0xa1, 0xd5, 0x55,
+    0x55, 0x56, 0xe1, 0x0, 0x50, 0x30, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+503C "值" */
+    0x0, 0x2, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x20, 0xa, 0x40, 0x0, 0x0, 0x0, 0x2a,
+    0x45, 0x5c, 0x65, 0x5c, 0x20, 0x0, 0x84, 0x10,
+    0xb, 0x10, 0x0, 0x0, 0x0, 0xe2, 0x7, 0x5c,
+    0x55, 0xa2, 0x0, 0x6, 0xd2, 0xb, 0x0, 0x0,
+    0xb0, 0x0, 0x8, 0x92, 0xb, 0x55, 0x55, 0xc0,
+    0x0, 0x40, 0x92, 0xb, 0x0, 0x0, 0xb0, 0x0,
+    0x0, 0x92, 0xb, 0x55, 0x55, 0xc0, 0x0, 0x0,
+    0x92, 0xb, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x92,
+    0xb, 0x55, 0x55, 0xc0, 0x0, 0x0, 0x92, 0xb,
+    0x0, 0x0, 0xb0, 0x0, 0x0, 0x94, 0x5c, 0x55,
+    0x55, 0xc7, 0xb0, 0x0, 0x41, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+505A "做" */
+    0x0, 0x2, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0xd, 0x14, 0x80, 0x7, 0x60, 0x0, 0x0, 0x39,
+    0x3, 0x70, 0xa, 0x0, 0x0, 0x0, 0x83, 0x3,
+    0x72, 0x8, 0x0, 0x30, 0x0, 0xd2, 0x67, 0x96,
+    0x59, 0x5b, 0x60, 0x4, 0xe0, 0x3, 0x70, 0x44,
+    0xa, 0x0, 0x7, 0xb0, 0x3, 0x70, 0x44, 0xa,
+    0x0, 0x21, 0xb0, 0xa6, 0x6c, 0x16, 0xa, 0x0,
+    0x0, 0xb0, 0xa0, 0xa, 0x6, 0x56, 0x0, 0x0,
+    0xb0, 0xa0, 0xa, 0x1, 0xe1, 0x0, 0x0, 0xb0,
+    0xb5, 0x5b, 0x5, 0xc2, 0x0, 0x0, 0xb0, 0xa0,
+    0x7, 0x57, 0x1b, 0x20, 0x0, 0xc0, 0x30, 0x16,
+    0x30, 0x2, 0xa1, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+505C "停" */
+    0x0, 0x3, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x1e, 0x10, 0x2, 0xa0, 0x1, 0x0, 0x0, 0x57,
+    0x36, 0x55, 0x85, 0x58, 0x50, 0x0, 0xa1, 0x0,
+    0x75, 0x55, 0x90, 0x0, 0x1, 0xf2, 0x0, 0xb0,
+    0x0, 0xb0, 0x0, 0x7, 0xd0, 0x0, 0xc5, 0x55,
+    0xc0, 0x0, 0x16, 0xb0, 0x20, 0x20, 0x0, 0x10,
+    0x30, 0x20, 0xb0, 0xb5, 0x55, 0x55, 0x58, 0x80,
+    0x0, 0xb1, 0x54, 0x55, 0x55, 0x97, 0x0, 0x0,
+    0xb0, 0x1, 0x0, 0xb0, 0x0, 0x0, 0x0, 0xb0,
+    0x0, 0x0, 0xb0, 0x0, 0x0, 0x0, 0xb0, 0x0,
+    0x0, 0xb0, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x39,
+    0xc0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x1, 0x10,
+    0x0, 0x0,
+
+    /* U+5065 "健" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x20, 0x0, 0xb, 0x0, 0x0, 0x0, 0x1b,
+    0x47, 0x62, 0x5c, 0x5a, 0x0, 0x0, 0x74, 0x9,
+    0x20, 0xa, 0xa, 0x10, 0x0, 0xc0, 0xb, 0x5,
+    0x5c, 0x5c, 0x70, 0x5, 0xe1, 0x56, 0x20, 0x2b,
+    0x2b, 0x0, 0x15, 0xb0, 0x85, 0xc1, 0x3b, 0x35,
+    0x0, 0x20, 0xb0, 0x0, 0x93, 0x5c, 0x59, 0x10,
+    0x0, 0xb0, 0x53, 0x70, 0xa, 0x0, 0x0, 0x0,
+    0xb0, 0x67, 0x45, 0x5c, 0x56, 0x60, 0x0, 0xb0,
+    0x1e, 0x0, 0xb, 0x0, 0x0, 0x0, 0xb0, 0x48,
+    0xa4, 0x5, 0x0, 0x0, 0x0, 0xb3, 0x40, 0x18,
+    0xbb, 0xbc, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5074 "側" */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0xd, 0x37, 0x55, 0x80, 0x0, 0xc0, 0x0, 0x2b,
+    0xa, 0x0, 0xa0, 0x70, 0xa0, 0x0, 0x74, 0xa,
+    0x0, 0xa0, 0xb0, 0xa0, 0x0, 0xc2, 0xc, 0x55,
+    0xa0, 0xa0, 0xa0, 0x3, 0xe0, 0xa, 0x0, 0xa0,
+    0xa0, 0xa0, 0x7, 0xa0, 0xa, 0x0, 0xa0, 0xa0,
+    0xa0, 0x21, 0xa0, 0xc, 0x55, 0xa0, 0xa0, 0xa0,
+    0x0, 0xa0, 0xa, 0x0, 0xa0, 0xa0, 0xa0, 0x0,
+    0xa0, 0xc, 0x55, 0xa0, 0xa0, 0xa0, 0x0, 0xa0,
+    0x6, 0x33, 0x10, 0x0, 0xa0, 0x0, 0xa0, 0x1b,
+    0x21, 0xa0, 0x0, 0xa0, 0x0, 0xb0, 0x70, 0x0,
+    0x93, 0x5b, 0x80, 0x0, 0x11, 0x0, 0x0, 0x10,
+    0x2, 0x0,
+
+    /* U+5099 "備" */
+    0x0, 0x1, 0x0, 0x40, 0x3, 0x0, 0x0, 0x0,
+    0xd, 0x30, 0xd1, 0xa, 0x40, 0x0, 0x0, 0x3b,
+    0x36, 0xd5, 0x5c, 0x6b, 0x30, 0x0, 0x84, 0x0,
+    0xc0, 0xa, 0x20, 0x10, 0x0, 0xe2, 0x65, 0xd5,
+    0x5a, 0x67, 0xb1, 0x6, 0xe0, 0x2, 0xc1, 0x0,
+    0x1, 0x0, 0x16, 0xb0, 0xd, 0x65, 0xa5, 0x5d,
+    0x0, 0x20, 0xb0, 0x7c, 0x0, 0xb0, 0xb, 0x0,
+    0x0, 0xb3, 0xb, 0x55, 0xc5, 0x5b, 0x0, 0x0,
+    0xb0, 0xb, 0x0, 0xb0, 0xb, 0x0, 0x0, 0xb0,
+    0xb, 0x55, 0xc5, 0x5b, 0x0, 0x0, 0xb0, 0xb,
+    0x0, 0xb0, 0xb, 0x0, 0x0, 0xb0, 0xb, 0x0,
+    0xb3, 0xa9, 0x0, 0x0, 0x30, 0x3, 0x0, 0x0,
+    0x31, 0x0,
+
+    /* U+50B3 "傳" */
+    0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0,
+    0x5, 0x90, 0x0, 0xc0, 0x2, 0x30, 0x0, 0xa,
+    0x37, 0x55, 0xc5, 0x56, 0x50, 0x0, 0x1a, 0xa,
+    0x55, 0xc5, 0x5c, 0x0, 0x0, 0x8b, 0xb, 0x55,
+    0xc5, 0x5b, 0x0, 0x1, 0xa9, 0xb, 0x0, 0xb0,
+    0xb, 0x0, 0x6, 0x29, 0x8, 0x55, 0xc5, 0x77,
+    0x0, 0x1, 0x19, 0x13, 0x44, 0xc5, 0x5b, 0x40,
+    0x0, 0x19, 0x28, 0x53, 0x10, 0x81, 0x40, 0x0,
+    0x19, 0x55, 0x55, 0x55, 0xc5, 0xb1, 0x0, 0x19,
+    0x4, 0x80, 0x0, 0xb0, 0x0, 0x0, 0x19, 0x0,
+    0x71, 0x0, 0xb0, 0x0, 0x0, 0x2a, 0x0, 0x2,
+    0x6c, 0x90, 0x0, 0x0, 0x1, 0x0, 0x0, 0x3,
+    0x0, 0x0,
+
+    /* U+50C5 "僅" */
+    0x0, 0x2, 0x0, 0x30, 0x0, 0x20, 0x0, 0x0,
+    0xe, 0x20, 0xc1, 0x1, 0xc0, 0x0, 0x0, 0x59,
+    0x55, 0xd5, 0x55, 0xc6, 0xb0, 0x0, 0xb2, 0x10,
+    0xb0, 0x0, 0xa0, 0x0, 0x1, 0xe2, 0x0, 0xb5,
+    0xa5, 0x80, 0x0, 0x7, 0xd0, 0x7, 0x55, 0xc5,
+    0x58, 0x0, 0x16, 0xb0, 0xb, 0x0, 0xb0, 0xb,
+    0x0, 0x30, 0xb0, 0xc, 0x55, 0xc5, 0x5b, 0x0,
+    0x0, 0xb0, 0x5, 0x0, 0xb0, 0x5, 0x0, 0x0,
+    0xb0, 0x6, 0x55, 0xc5, 0x67, 0x0, 0x0, 0xb0,
+    0x5, 0x55, 0xc5, 0x69, 0x0, 0x0, 0xb0, 0x1,
+    0x0, 0xb0, 0x0, 0x0, 0x0, 0xb1, 0x55, 0x55,
+    0xc5, 0x56, 0xd1, 0x0, 0x30, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+50CD "働" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x2d, 0x13, 0x6a, 0x60, 0xd1, 0x0, 0x0, 0x66,
+    0x22, 0xa0, 0x0, 0xb0, 0x0, 0x0, 0xa2, 0x75,
+    0xc5, 0x90, 0xb0, 0x0, 0x1, 0xd1, 0x20, 0xa0,
+    0x36, 0xc5, 0xd0, 0x7, 0xc0, 0xb5, 0xc5, 0xb0,
+    0xb0, 0xb0, 0x8, 0xa0, 0xa5, 0xc5, 0x90, 0xb0,
+    0xb0, 0x30, 0xa0, 0xa0, 0xa1, 0x90, 0xa0, 0xb0,
+    0x0, 0xa0, 0xb5, 0xc5, 0x92, 0x80, 0xa0, 0x0,
+    0xa0, 0x0, 0xa1, 0x46, 0x30, 0x90, 0x0, 0xa0,
+    0x65, 0xc5, 0x49, 0x1, 0x80, 0x0, 0xa0, 0x24,
+    0xc5, 0x55, 0x3, 0x70, 0x0, 0xb1, 0xb5, 0x11,
+    0x60, 0x7d, 0x30, 0x0, 0x20, 0x0, 0x2, 0x0,
+    0x2, 0x0,
+
+    /* U+50CF "像" */
+    0x0, 0x1, 0x50, 0x6, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xb0, 0x4d, 0x55, 0x80, 0x0, 0x0, 0xb,
+    0x30, 0xb1, 0x8, 0x40, 0x0, 0x0, 0x1b, 0x8,
+    0xb5, 0x78, 0x5b, 0x20, 0x0, 0x9c, 0x33, 0xb0,
+    0xb0, 0xb, 0x0, 0x1, 0x9a, 0x0, 0xd5, 0xc5,
+    0x5d, 0x10, 0x6, 0x1a, 0x0, 0x26, 0x50, 0x5,
+    0x0, 0x11, 0x1a, 0x0, 0x56, 0x93, 0xa6, 0x0,
+    0x0, 0x1a, 0x5, 0x28, 0x98, 0x50, 0x0, 0x0,
+    0x1a, 0x1, 0x83, 0x9b, 0x81, 0x0, 0x0, 0x1a,
+    0x14, 0x9, 0x5d, 0x2c, 0x0, 0x0, 0x1a, 0x3,
+    0x92, 0xd, 0x9, 0xd3, 0x0, 0x1a, 0x43, 0x6,
+    0xd8, 0x0, 0x40, 0x0, 0x1, 0x0, 0x0, 0x30,
+    0x0, 0x0,
+
+    /* U+50D5 "僕" */
+    0x0, 0x3, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0,
+    0xd, 0x30, 0xd, 0xd, 0x0, 0x0, 0x0, 0x3a,
+    0x8, 0x1b, 0xb, 0x2c, 0x0, 0x0, 0x84, 0x5,
+    0x4b, 0xb, 0x81, 0x0, 0x0, 0xd3, 0x56, 0x5a,
+    0x5b, 0x67, 0x80, 0x5, 0xd2, 0x0, 0x82, 0x4,
+    0x60, 0x0, 0x7, 0x92, 0x15, 0x78, 0x59, 0x6a,
+    0x0, 0x20, 0x92, 0x1, 0x0, 0xb0, 0x10, 0x0,
+    0x0, 0x92, 0x3, 0x65, 0xc5, 0x73, 0x0, 0x0,
+    0x92, 0x45, 0x57, 0xa5, 0x59, 0x60, 0x0, 0x92,
+    0x10, 0xa, 0x15, 0x0, 0x0, 0x0, 0x92, 0x1,
+    0x92, 0x3, 0x80, 0x0, 0x0, 0x92, 0x46, 0x0,
+    0x0, 0x3c, 0x80, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+50F9 "價" */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4d, 0x46, 0x57, 0x57, 0x56, 0x90, 0x0, 0x85,
+    0x2, 0xa, 0xa, 0x2, 0x10, 0x0, 0xc2, 0xc,
+    0x5c, 0x5c, 0x5a, 0x40, 0x2, 0xf3, 0xc, 0x5c,
+    0x5c, 0x5a, 0x30, 0x7, 0xa2, 0x4, 0x0, 0x0,
+    0x3, 0x0, 0x6, 0x82, 0x6, 0x65, 0x55, 0x5b,
+    0x0, 0x30, 0x82, 0x6, 0x75, 0x55, 0x59, 0x0,
+    0x0, 0x82, 0x6, 0x30, 0x0, 0x19, 0x0, 0x0,
+    0x82, 0x6, 0x75, 0x55, 0x59, 0x0, 0x0, 0x82,
+    0x6, 0x75, 0x55, 0x59, 0x0, 0x0, 0x82, 0x1,
+    0xb3, 0x3, 0x86, 0x0, 0x0, 0x82, 0x48, 0x10,
+    0x0, 0x6, 0xb0, 0x0, 0x10, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5104 "億" */
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0x70, 0x0, 0xb0, 0x0, 0x0, 0x0, 0xd,
+    0x4, 0x65, 0x95, 0x58, 0x50, 0x0, 0x49, 0x0,
+    0x55, 0x5, 0xa0, 0x0, 0x0, 0xab, 0x24, 0x48,
+    0x49, 0x44, 0xa1, 0x1, 0x99, 0x12, 0x31, 0x11,
+    0x24, 0x10, 0x6, 0x29, 0x0, 0xc5, 0x55, 0x6b,
+    0x0, 0x2, 0x19, 0x0, 0xc5, 0x55, 0x69, 0x0,
+    0x0, 0x19, 0x0, 0xd5, 0x55, 0x6a, 0x0, 0x0,
+    0x19, 0x0, 0x42, 0x70, 0x22, 0x0, 0x0, 0x19,
+    0x5, 0x1a, 0x63, 0x2a, 0x20, 0x0, 0x19, 0x38,
+    0x19, 0x0, 0x83, 0x80, 0x0, 0x2a, 0x41, 0xc,
+    0xab, 0xd2, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+512A "優" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0x26, 0x55, 0x85, 0x5a, 0x20, 0x0, 0x48,
+    0x0, 0xb5, 0x75, 0xb1, 0x0, 0x0, 0x92, 0x0,
+    0xc5, 0x55, 0xc0, 0x0, 0x0, 0xd2, 0x0, 0xc5,
+    0x55, 0xc0, 0x0, 0x5, 0xe0, 0x75, 0xa5, 0x55,
+    0xa5, 0xb0, 0x7, 0xb1, 0xa2, 0x73, 0xa2, 0x25,
+    0x40, 0x21, 0xb0, 0x38, 0x83, 0x12, 0x7a, 0x10,
+    0x0, 0xb0, 0x31, 0x5a, 0x88, 0x33, 0x0, 0x0,
+    0xb0, 0x0, 0xd7, 0x55, 0x92, 0x0, 0x0, 0xb0,
+    0x9, 0x47, 0x7, 0x70, 0x0, 0x0, 0xb0, 0x30,
+    0x5, 0xf9, 0x0, 0x0, 0x0, 0xb0, 0x4, 0x75,
+    0x6, 0xcb, 0x50, 0x0, 0x20, 0x30, 0x0, 0x0,
+    0x2, 0x0,
+
+    /* U+513F "儿" */
+    0x0, 0x0, 0x20, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0x0, 0xa3, 0x0, 0x0, 0x0, 0x1, 0xb0,
+    0xa, 0x20, 0x0, 0x0, 0x0, 0x1b, 0x0, 0xa2,
+    0x0, 0x0, 0x0, 0x1, 0xa0, 0xa, 0x20, 0x0,
+    0x0, 0x0, 0x29, 0x0, 0xa2, 0x0, 0x0, 0x0,
+    0x4, 0x80, 0xa, 0x20, 0x0, 0x0, 0x0, 0x75,
+    0x0, 0xa2, 0x0, 0x0, 0x0, 0xb, 0x10, 0xa,
+    0x20, 0x4, 0x0, 0x3, 0x90, 0x0, 0xa2, 0x0,
+    0x60, 0x0, 0xb1, 0x0, 0x9, 0x20, 0xa, 0x21,
+    0x81, 0x0, 0x0, 0x5d, 0xbb, 0xe4, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5143 "元" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x71, 0x0, 0x0,
+    0x6, 0x55, 0x55, 0x55, 0x53, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x0, 0x4, 0x65, 0x59, 0x55,
+    0x95, 0x5a, 0x60, 0x0, 0x0, 0xe, 0x0, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0x0, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x49, 0x0, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x95, 0x0, 0xd0, 0x0, 0x30, 0x0,
+    0x1, 0xc0, 0x0, 0xd0, 0x0, 0x60, 0x0, 0xb,
+    0x30, 0x0, 0xd0, 0x0, 0xc0, 0x1, 0x92, 0x0,
+    0x0, 0xac, 0xbc, 0xc2, 0x4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+5144 "兄" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0x55, 0x55, 0x55, 0xc2, 0x0, 0x0, 0xd0, 0x0,
+    0x0, 0xd, 0x0, 0x0, 0xd, 0x0, 0x0, 0x0,
+    0xd0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0xd, 0x0,
+    0x0, 0xd, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0,
+    0xe5, 0xb8, 0x5d, 0x5c, 0x0, 0x0, 0x3, 0xa,
+    0x30, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0xd,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0x0, 0xd0, 0x0,
+    0x40, 0x0, 0x6, 0x70, 0xd, 0x0, 0x6, 0x0,
+    0x2, 0xb0, 0x0, 0xd0, 0x0, 0xc0, 0x4, 0x80,
+    0x0, 0xb, 0xcb, 0xcd, 0x23, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+5145 "充" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x77, 0x0, 0x0, 0x0, 0x4, 0x55,
+    0x55, 0x7b, 0x55, 0x59, 0x90, 0x1, 0x0, 0x3,
+    0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x30,
+    0x23, 0x0, 0x0, 0x0, 0x2, 0x91, 0x0, 0x6,
+    0x90, 0x0, 0x0, 0x4f, 0xaa, 0x87, 0x95, 0x9c,
+    0x0, 0x0, 0x2, 0xd, 0x1, 0xb0, 0x8, 0x0,
+    0x0, 0x0, 0x1c, 0x1, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x57, 0x1, 0xb0, 0x0, 0x30, 0x0, 0x0,
+    0xb1, 0x1, 0xb0, 0x0, 0x60, 0x0, 0x7, 0x60,
+    0x0, 0xb0, 0x0, 0xb0, 0x1, 0x73, 0x0, 0x0,
+    0xbb, 0xbc, 0xd2, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5148 "先" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x0, 0x94, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0x30, 0x92, 0x0, 0x0, 0x0, 0x0, 0x3c, 0x55,
+    0xb6, 0x55, 0xd2, 0x0, 0x0, 0x92, 0x0, 0x92,
+    0x0, 0x0, 0x0, 0x2, 0x50, 0x0, 0x92, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x92, 0x0, 0x6,
+    0x30, 0x17, 0x55, 0x7b, 0x59, 0x95, 0x55, 0x40,
+    0x0, 0x0, 0x66, 0x6, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x93, 0x6, 0x60, 0x0, 0x10, 0x0, 0x0,
+    0xb0, 0x6, 0x60, 0x0, 0x50, 0x0, 0xa, 0x30,
+    0x5, 0x60, 0x1, 0x80, 0x2, 0x82, 0x0, 0x2,
+    0xda, 0xab, 0xb0, 0x13, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5149 "光" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4a, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0x0, 0x48, 0x0, 0x91, 0x0, 0x0, 0x2, 0xc0,
+    0x48, 0x4, 0xb0, 0x0, 0x0, 0x0, 0xa4, 0x48,
+    0xa, 0x10, 0x0, 0x0, 0x0, 0x20, 0x48, 0x33,
+    0x2, 0x40, 0x6, 0x55, 0x5c, 0x56, 0xc5, 0x56,
+    0x60, 0x0, 0x0, 0x1c, 0x0, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x29, 0x0, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x76, 0x0, 0xb0, 0x0, 0x30, 0x0, 0x0,
+    0xb0, 0x0, 0xb0, 0x0, 0x60, 0x0, 0x8, 0x50,
+    0x0, 0xc0, 0x0, 0xa0, 0x1, 0x73, 0x0, 0x0,
+    0xab, 0xaa, 0xd2, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+514B "克" */
+    0x0, 0x0, 0x0, 0x42, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x95, 0x0, 0x0, 0x0, 0x5, 0x55,
+    0x55, 0xb6, 0x55, 0x59, 0x70, 0x1, 0x0, 0x0,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x55, 0xc5,
+    0x55, 0xa0, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0,
+    0xb0, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0xa0,
+    0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0xa0, 0x0,
+    0x0, 0xb, 0x5c, 0x5a, 0x95, 0x80, 0x0, 0x0,
+    0x0, 0xb, 0x7, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x47, 0x7, 0x60, 0x0, 0x50, 0x0, 0x1, 0xb0,
+    0x7, 0x60, 0x0, 0x80, 0x0, 0x57, 0x10, 0x5,
+    0xd9, 0x9b, 0xb0, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+514D "免" */
+    0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd7, 0x55, 0xb5, 0x0, 0x0, 0x0, 0x8, 0x50,
+    0x0, 0xc1, 0x0, 0x0, 0x0, 0x4a, 0x0, 0x5,
+    0x20, 0x4, 0x0, 0x3, 0x7c, 0x55, 0x6c, 0x55,
+    0x5d, 0x0, 0x3, 0xc, 0x0, 0x39, 0x0, 0x1b,
+    0x0, 0x0, 0xd, 0x55, 0x8a, 0x55, 0x5b, 0x0,
+    0x0, 0x8, 0x0, 0x86, 0xb0, 0x5, 0x0, 0x0,
+    0x0, 0x0, 0xd2, 0xb0, 0x0, 0x20, 0x0, 0x0,
+    0x7, 0x81, 0xb0, 0x0, 0x60, 0x0, 0x0, 0x5b,
+    0x0, 0xb0, 0x0, 0x91, 0x0, 0x38, 0x50, 0x0,
+    0xda, 0xaa, 0xe4, 0x3, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5152 "兒" */
+    0x0, 0x0, 0x5, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0x59, 0x73, 0x55, 0x93, 0x0, 0x0, 0xd0, 0x0,
+    0x1, 0xa, 0x20, 0x0, 0xc, 0x2, 0x0, 0x0,
+    0xa1, 0x0, 0x0, 0xd5, 0x74, 0x6, 0x5c, 0x10,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0xa1, 0x0, 0x0,
+    0xd5, 0x55, 0x55, 0x5c, 0x20, 0x0, 0x7, 0xc,
+    0x0, 0xc0, 0x50, 0x0, 0x0, 0x0, 0xc0, 0xc,
+    0x0, 0x0, 0x0, 0x0, 0x38, 0x0, 0xc0, 0x0,
+    0x40, 0x0, 0xa, 0x20, 0xc, 0x0, 0x7, 0x0,
+    0x7, 0x60, 0x0, 0xd1, 0x1, 0xd4, 0x6, 0x40,
+    0x0, 0x6, 0x99, 0x97, 0x12, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+515A "党" */
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0x0, 0x2b, 0x5, 0x30, 0x0, 0x0, 0x1,
+    0xc2, 0x19, 0xc, 0x30, 0x0, 0x0, 0x30, 0x42,
+    0x19, 0x52, 0x0, 0x30, 0x1, 0xa5, 0x55, 0x55,
+    0x55, 0x5a, 0xa0, 0x9, 0x40, 0x30, 0x0, 0x4,
+    0x5, 0x0, 0x0, 0x0, 0xd5, 0x55, 0x5c, 0x20,
+    0x0, 0x0, 0x0, 0xb0, 0x0, 0xb, 0x0, 0x0,
+    0x0, 0x0, 0xd6, 0x86, 0x7c, 0x0, 0x0, 0x0,
+    0x0, 0x36, 0x72, 0x60, 0x0, 0x10, 0x0, 0x0,
+    0xb, 0x22, 0x60, 0x0, 0x50, 0x0, 0x0, 0x78,
+    0x2, 0x70, 0x0, 0xa0, 0x1, 0x57, 0x40, 0x1,
+    0xca, 0xab, 0xc1, 0x13, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5165 "入" */
+    0x0, 0x0, 0x88, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x95, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xda, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xb9,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0x54, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x1c, 0x0, 0xc1, 0x0,
+    0x0, 0x0, 0x0, 0x94, 0x0, 0x6a, 0x0, 0x0,
+    0x0, 0x5, 0x90, 0x0, 0xc, 0x60, 0x0, 0x0,
+    0x29, 0x0, 0x0, 0x2, 0xe8, 0x0, 0x3, 0x70,
+    0x0, 0x0, 0x0, 0x2e, 0xc2, 0x24, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x10,
+
+    /* U+5167 "內" */
+    0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x53, 0x0, 0x0,
+    0xa, 0x55, 0x57, 0x95, 0x55, 0xc1, 0xc0, 0x0,
+    0x3c, 0x0, 0xc, 0xc, 0x0, 0x6, 0xc1, 0x0,
+    0xc0, 0xc0, 0x0, 0xb3, 0x70, 0xc, 0xc, 0x0,
+    0x46, 0xb, 0x10, 0xc0, 0xc0, 0x9, 0x0, 0x4c,
+    0xc, 0xc, 0x7, 0x10, 0x0, 0xa9, 0xc0, 0xc1,
+    0x0, 0x0, 0x0, 0xc, 0xc, 0x0, 0x0, 0x0,
+    0x10, 0xd0, 0xb0, 0x0, 0x0, 0x4, 0xca, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5168 "全" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x87,
+    0x3, 0x70, 0x0, 0x0, 0x0, 0x4, 0xa0, 0x0,
+    0x59, 0x10, 0x0, 0x0, 0x49, 0x0, 0x0, 0x9,
+    0xe9, 0x40, 0x6, 0x66, 0x55, 0xc6, 0x55, 0x39,
+    0x70, 0x20, 0x0, 0x0, 0xa1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa1, 0x2, 0x40, 0x0, 0x0,
+    0x16, 0x55, 0xc6, 0x55, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa1, 0x0, 0x0, 0x0, 0x4, 0x55, 0x55, 0xc6,
+    0x55, 0x5d, 0x50, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5169 "兩" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x55,
+    0x55, 0x55, 0x55, 0x57, 0xe2, 0x0, 0x0, 0x0,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x0,
+    0x0, 0x10, 0xc, 0x55, 0x55, 0xc5, 0x55, 0x5c,
+    0x0, 0xb1, 0x10, 0xb, 0x10, 0x0, 0xa0, 0xb,
+    0x7, 0x10, 0xb0, 0x70, 0xa, 0x0, 0xb0, 0x3b,
+    0xb, 0x5, 0x90, 0xa0, 0xb, 0x9, 0xa4, 0xb0,
+    0x9b, 0x4a, 0x0, 0xb3, 0x52, 0x9b, 0x44, 0x59,
+    0xa0, 0xc, 0x50, 0x2, 0xb4, 0x1, 0x3a, 0x0,
+    0xb0, 0x0, 0xb, 0x0, 0x1, 0xa0, 0xb, 0x0,
+    0x0, 0xa0, 0x6, 0xe6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x0,
+
+    /* U+516B "八" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x2, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x1e, 0x10, 0x70, 0x0, 0x0, 0x0, 0x0, 0x1c,
+    0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x39, 0x0,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x57, 0x0, 0x81,
+    0x0, 0x0, 0x0, 0x0, 0x84, 0x0, 0x55, 0x0,
+    0x0, 0x0, 0x0, 0xc0, 0x0, 0x1a, 0x0, 0x0,
+    0x0, 0x1, 0xa0, 0x0, 0xa, 0x10, 0x0, 0x0,
+    0x8, 0x30, 0x0, 0x4, 0xa0, 0x0, 0x0, 0x19,
+    0x0, 0x0, 0x0, 0xb7, 0x0, 0x0, 0x80, 0x0,
+    0x0, 0x0, 0x1e, 0x80, 0x5, 0x10, 0x0, 0x0,
+    0x0, 0x3, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+516C "公" */
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0x10, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x4b, 0x0, 0x90, 0x0, 0x0, 0x0, 0x0, 0xb2,
+    0x0, 0x55, 0x0, 0x0, 0x0, 0x4, 0x80, 0x0,
+    0xc, 0x10, 0x0, 0x0, 0x1a, 0x0, 0x20, 0x3,
+    0xc1, 0x0, 0x0, 0x81, 0x0, 0xa8, 0x0, 0x6e,
+    0x60, 0x5, 0x0, 0x3, 0xc0, 0x0, 0x5, 0x40,
+    0x0, 0x0, 0xb, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x74, 0x0, 0x53, 0x0, 0x0, 0x0, 0x3,
+    0x70, 0x0, 0xa, 0x30, 0x0, 0x0, 0x4c, 0x66,
+    0x76, 0x67, 0xe1, 0x0, 0x0, 0x28, 0x42, 0x10,
+    0x0, 0xb3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+516D "六" */
+    0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x18, 0x0, 0x0, 0x10, 0x6, 0x55, 0x55, 0x55,
+    0x55, 0x58, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3c, 0x10, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x98, 0x0, 0x28, 0x0, 0x0,
+    0x0, 0x1, 0xd0, 0x0, 0x6, 0x80, 0x0, 0x0,
+    0x9, 0x40, 0x0, 0x0, 0xb7, 0x0, 0x0, 0x57,
+    0x0, 0x0, 0x0, 0x3f, 0x20, 0x2, 0x80, 0x0,
+    0x0, 0x0, 0xb, 0x40, 0x15, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5171 "共" */
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0xc1, 0x0, 0xc1, 0x0, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0xc0, 0x0, 0x0, 0x4, 0x55, 0xd5,
+    0x55, 0xd5, 0x5c, 0x20, 0x0, 0x0, 0xc0, 0x0,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0xc0, 0x0, 0xc0, 0x6, 0x20,
+    0x36, 0x55, 0x75, 0x55, 0x65, 0x56, 0x50, 0x0,
+    0x0, 0xa8, 0x0, 0x52, 0x0, 0x0, 0x0, 0x7,
+    0xa0, 0x0, 0x7, 0xa1, 0x0, 0x0, 0x67, 0x0,
+    0x0, 0x0, 0x5e, 0x20, 0x6, 0x30, 0x0, 0x0,
+    0x0, 0x6, 0x50, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5176 "其" */
+    0x0, 0x0, 0x30, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x0, 0xc1, 0x0, 0x1d, 0x0, 0x0, 0x3, 0x55,
+    0xd5, 0x55, 0x6c, 0x5b, 0x60, 0x0, 0x0, 0xc0,
+    0x0, 0x1b, 0x0, 0x0, 0x0, 0x0, 0xc5, 0x55,
+    0x5b, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x1b,
+    0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x1b, 0x0,
+    0x0, 0x0, 0x0, 0xc5, 0x55, 0x5b, 0x0, 0x0,
+    0x0, 0x0, 0xc0, 0x0, 0x1b, 0x1, 0x60, 0x16,
+    0x55, 0x76, 0x55, 0x57, 0x56, 0x72, 0x0, 0x0,
+    0xab, 0x0, 0x48, 0x10, 0x0, 0x0, 0xa, 0x70,
+    0x0, 0x2, 0xd7, 0x0, 0x3, 0x82, 0x0, 0x0,
+    0x0, 0x2e, 0x10, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0,
+
+    /* U+5177 "具" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc5, 0x55, 0x55, 0xc0, 0x0, 0x0, 0x0,
+    0xb0, 0x0, 0x1, 0x90, 0x0, 0x0, 0x0, 0xc5,
+    0x55, 0x56, 0x90, 0x0, 0x0, 0x0, 0xb0, 0x0,
+    0x1, 0x90, 0x0, 0x0, 0x0, 0xc5, 0x55, 0x56,
+    0x90, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x1, 0x90,
+    0x0, 0x0, 0x0, 0xc5, 0x55, 0x56, 0x90, 0x0,
+    0x0, 0x0, 0xb0, 0x0, 0x1, 0x90, 0x40, 0x6,
+    0x55, 0x85, 0x55, 0x55, 0x87, 0xa2, 0x0, 0x0,
+    0x89, 0x0, 0x25, 0x10, 0x0, 0x0, 0x9, 0x70,
+    0x0, 0x1, 0xa7, 0x0, 0x3, 0x72, 0x0, 0x0,
+    0x0, 0xb, 0x40, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5185 "内" */
+    0x0, 0x0, 0x41, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0xc1, 0x0, 0x0,
+    0x7, 0x55, 0x5d, 0x55, 0x55, 0xa0, 0xc0, 0x0,
+    0xd0, 0x0, 0xc, 0xc, 0x0, 0xc, 0x0, 0x0,
+    0xc0, 0xc0, 0x5, 0xa7, 0x0, 0xc, 0xc, 0x0,
+    0xa1, 0x3c, 0x20, 0xc0, 0xc0, 0x73, 0x0, 0x6b,
+    0xc, 0xc, 0x52, 0x0, 0x0, 0x60, 0xc0, 0xc0,
+    0x0, 0x0, 0x0, 0xc, 0xc, 0x0, 0x0, 0x1,
+    0x23, 0xb0, 0xc0, 0x0, 0x0, 0x4, 0xe7, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x0,
+
+    /* U+5186 "円" */
+    0x85, 0x55, 0x55, 0x55, 0x5a, 0x1c, 0x0, 0x2,
+    0x90, 0x0, 0xc0, 0xc0, 0x0, 0x29, 0x0, 0xc,
+    0xc, 0x0, 0x2, 0x90, 0x0, 0xc0, 0xc0, 0x0,
+    0x29, 0x0, 0xc, 0xd, 0x55, 0x56, 0xa5, 0x55,
+    0xd0, 0xc0, 0x0, 0x0, 0x0, 0xc, 0xc, 0x0,
+    0x0, 0x0, 0x0, 0xc0, 0xc0, 0x0, 0x0, 0x0,
+    0xc, 0xc, 0x0, 0x0, 0x0, 0x0, 0xc0, 0xc0,
+    0x0, 0x0, 0x0, 0xc, 0xc, 0x0, 0x0, 0x0,
+    0x6c, 0xc0, 0x10, 0x0, 0x0, 0x0, 0x21, 0x0,
+
+    /* U+518A "冊" */
+    0x0, 0x17, 0x55, 0x55, 0x55, 0x59, 0x0, 0x0,
+    0x1a, 0xb, 0x0, 0xb0, 0xc, 0x0, 0x0, 0xa,
+    0xb, 0x0, 0xb0, 0xb, 0x0, 0x0, 0xa, 0xb,
+    0x0, 0xb0, 0xb, 0x0, 0x0, 0xa, 0xb, 0x0,
+    0xb0, 0xb, 0x0, 0x4, 0x5c, 0x5c, 0x55, 0xc5,
+    0x5d, 0xd3, 0x1, 0x1a, 0xb, 0x0, 0xb0, 0xb,
+    0x0, 0x0, 0xa, 0xb, 0x0, 0xb0, 0xb, 0x0,
+    0x0, 0xa, 0xb, 0x0, 0xb0, 0xb, 0x0, 0x0,
+    0xa, 0xb, 0x0, 0xb0, 0xb, 0x0, 0x0, 0xa,
+    0xa, 0x0, 0xa0, 0xb, 0x0, 0x0, 0x19, 0x0,
+    0x0, 0x4, 0xc8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+518D "再" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x65, 0x55, 0x55, 0x55, 0x5d, 0x30, 0x0, 0x0,
+    0x0, 0x29, 0x0, 0x0, 0x0, 0x0, 0x7, 0x55,
+    0x6b, 0x55, 0x92, 0x0, 0x0, 0xc, 0x0, 0x29,
+    0x0, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x29, 0x0,
+    0xc0, 0x0, 0x0, 0xd, 0x55, 0x6b, 0x55, 0xd0,
+    0x0, 0x0, 0xc, 0x0, 0x29, 0x0, 0xc0, 0x0,
+    0x0, 0xc, 0x0, 0x29, 0x0, 0xc1, 0x70, 0x6,
+    0x5d, 0x55, 0x55, 0x55, 0xd5, 0x61, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x5b, 0xd0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1,
+    0x10, 0x0,
+
+    /* U+5199 "写" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x55, 0x55, 0x55, 0x55, 0x97, 0x1, 0xc0, 0x10,
+    0x0, 0x0, 0xa, 0x20, 0x46, 0xd, 0x10, 0x0,
+    0x1, 0x10, 0x0, 0x0, 0xd5, 0x55, 0x55, 0xa5,
+    0x0, 0x0, 0x39, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0x60, 0x0, 0x0, 0x3, 0x0, 0x0, 0x77,
+    0x55, 0x55, 0x55, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0x0, 0x45, 0x55, 0x55, 0x5a, 0x81,
+    0xa0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x48, 0x0,
+    0x0, 0x0, 0x0, 0x13, 0x1a, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x3d, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x10, 0x0,
+
+    /* U+519B "军" */
+    0x0, 0x85, 0x55, 0x55, 0x55, 0x59, 0x70, 0x5,
+    0x80, 0x2, 0x90, 0x0, 0x7, 0x10, 0x2, 0x10,
+    0x8, 0x50, 0x0, 0x20, 0x0, 0x0, 0x35, 0x6c,
+    0x55, 0x55, 0x72, 0x0, 0x0, 0x0, 0x93, 0x9,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x80, 0xb, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0x55, 0x5c, 0x55, 0xb1,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0,
+    0x4, 0x55, 0x55, 0x5c, 0x55, 0x56, 0xa0, 0x1,
+    0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x0,
+
+    /* U+51AC "冬" */
+    0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x99, 0x55, 0x5a, 0x70, 0x0, 0x0, 0x3, 0xa3,
+    0x0, 0x3c, 0x10, 0x0, 0x0, 0x9, 0x6, 0x31,
+    0xc2, 0x0, 0x0, 0x0, 0x60, 0x0, 0xac, 0x20,
+    0x0, 0x0, 0x1, 0x0, 0x5, 0xaa, 0x91, 0x0,
+    0x0, 0x0, 0x2, 0x96, 0x0, 0x4d, 0x94, 0x0,
+    0x4, 0x65, 0x0, 0x6a, 0x20, 0x6d, 0xa1, 0x0,
+    0x0, 0x0, 0x4, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x57, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5d, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+51B7 "冷" */
+    0x0, 0x0, 0x0, 0x2, 0x20, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x8, 0xb0, 0x0, 0x0, 0x8, 0x60,
+    0x0, 0xd, 0x52, 0x0, 0x0, 0x0, 0xf0, 0x40,
+    0x58, 0x9, 0x0, 0x0, 0x0, 0x30, 0x50, 0xb3,
+    0x3, 0xa0, 0x0, 0x0, 0x5, 0x18, 0x31, 0xc0,
+    0x7c, 0x30, 0x0, 0x8, 0x53, 0x0, 0xa1, 0x6,
+    0xa2, 0x0, 0x55, 0x13, 0x55, 0x55, 0x92, 0x0,
+    0x18, 0xe0, 0x0, 0x0, 0x3, 0xb0, 0x0, 0x2,
+    0xc0, 0x0, 0x10, 0xa, 0x0, 0x0, 0x4, 0xb0,
+    0x0, 0x9, 0x71, 0x0, 0x0, 0x4, 0xa0, 0x0,
+    0x1, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x66, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+51CD "凍" */
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x2,
+    0x0, 0x0, 0x0, 0xc1, 0x0, 0x0, 0x2, 0xc1,
+    0x45, 0x55, 0xd5, 0x57, 0xb0, 0x0, 0x75, 0x1,
+    0x0, 0xb0, 0x1, 0x0, 0x0, 0x2, 0x2c, 0x55,
+    0xc5, 0x5d, 0x10, 0x0, 0x5, 0xb, 0x0, 0xb0,
+    0xb, 0x0, 0x0, 0x6, 0xb, 0x55, 0xc5, 0x5c,
+    0x0, 0x0, 0x43, 0xb, 0x0, 0xb0, 0xb, 0x0,
+    0x6, 0xd0, 0xa, 0x5d, 0xe8, 0x58, 0x0, 0x2,
+    0xc0, 0x0, 0x39, 0xb6, 0x10, 0x0, 0x2, 0xb0,
+    0x1, 0xa0, 0xb1, 0xa0, 0x0, 0x4, 0xb0, 0x9,
+    0x10, 0xb0, 0x5b, 0x20, 0x1, 0x51, 0x60, 0x0,
+    0xb0, 0x6, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x50,
+    0x0, 0x0,
+
+    /* U+51DD "凝" */
+    0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x13,
+    0x0, 0xc0, 0x80, 0x65, 0x5d, 0x20, 0xa, 0x60,
+    0xb6, 0x21, 0x1, 0x35, 0x0, 0x2, 0x52, 0xa0,
+    0x15, 0x7, 0x80, 0x0, 0x0, 0x3, 0x98, 0xa5,
+    0x0, 0xb0, 0x0, 0x0, 0x50, 0xb0, 0x2, 0x65,
+    0x85, 0xd0, 0x0, 0x72, 0xb5, 0x92, 0x0, 0xa3,
+    0x20, 0x3, 0x76, 0xa, 0x0, 0xb1, 0xa0, 0x30,
+    0x3e, 0x45, 0x5c, 0x78, 0xa0, 0xc5, 0x50, 0xb,
+    0x1, 0xc, 0x0, 0xb0, 0xa0, 0x0, 0xf, 0x0,
+    0x57, 0xa1, 0xa7, 0xa0, 0x0, 0x8, 0x0, 0x90,
+    0x66, 0x41, 0xb6, 0x20, 0x0, 0x6, 0x0, 0x5,
+    0x0, 0x7, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+51E6 "処" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0x0, 0x0, 0xa5, 0xb2, 0x0, 0x0, 0x3b, 0x56,
+    0x90, 0xb0, 0xc0, 0x0, 0x0, 0x92, 0x4, 0x60,
+    0xb0, 0xc0, 0x0, 0x0, 0xb1, 0x7, 0x31, 0x90,
+    0xc0, 0x0, 0x7, 0x14, 0xb, 0x3, 0x70, 0xc0,
+    0x0, 0x3, 0x6, 0x1a, 0x8, 0x10, 0xc0, 0x10,
+    0x0, 0x2, 0xc4, 0x27, 0x0, 0xc0, 0x60, 0x0,
+    0x1, 0xe3, 0x60, 0x0, 0xa9, 0xd2, 0x0, 0x9,
+    0x2b, 0x40, 0x0, 0x1, 0x0, 0x0, 0x73, 0x1,
+    0xbc, 0x63, 0x22, 0x31, 0x6, 0x20, 0x0, 0x3,
+    0x8c, 0xde, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+51FA "出" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0x30, 0x0, 0x0, 0x3, 0x10, 0xa, 0x10,
+    0x5, 0x10, 0x7, 0x60, 0xa, 0x10, 0xa, 0x20,
+    0x6, 0x50, 0xa, 0x10, 0xa, 0x10, 0x6, 0x50,
+    0xa, 0x10, 0xa, 0x10, 0x8, 0x75, 0x5c, 0x65,
+    0x5c, 0x20, 0x0, 0x0, 0xa, 0x10, 0x2, 0x0,
+    0xd, 0x10, 0xa, 0x10, 0x2, 0xa0, 0xc, 0x0,
+    0xa, 0x10, 0x1, 0xa0, 0xc, 0x0, 0xa, 0x10,
+    0x1, 0xa0, 0xc, 0x0, 0xa, 0x10, 0x1, 0xa0,
+    0x8, 0x55, 0x55, 0x55, 0x56, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+5206 "分" */
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x87, 0x0, 0x80, 0x0, 0x0, 0x0, 0x1, 0xc0,
+    0x0, 0x27, 0x0, 0x0, 0x0, 0xa, 0x30, 0x0,
+    0x9, 0x40, 0x0, 0x0, 0x65, 0x0, 0x0, 0x1,
+    0xb8, 0x10, 0x4, 0x54, 0x57, 0x85, 0x5c, 0x59,
+    0xc1, 0x2, 0x0, 0x8, 0x40, 0xb, 0x10, 0x0,
+    0x0, 0x0, 0xb, 0x10, 0xc, 0x0, 0x0, 0x0,
+    0x0, 0x2a, 0x0, 0xd, 0x0, 0x0, 0x0, 0x0,
+    0x93, 0x0, 0xd, 0x0, 0x0, 0x0, 0x5, 0x60,
+    0x0, 0x2b, 0x0, 0x0, 0x0, 0x63, 0x0, 0x18,
+    0xf3, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x10,
+    0x0, 0x0,
+
+    /* U+5207 "切" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0xc,
+    0x0, 0x65, 0x69, 0x56, 0xd0, 0x0, 0xc, 0x0,
+    0x10, 0x3a, 0x1, 0xb0, 0x0, 0xc, 0x46, 0xa1,
+    0x48, 0x2, 0xb0, 0x5, 0x5c, 0x0, 0x0, 0x67,
+    0x2, 0xa0, 0x0, 0xc, 0x0, 0x0, 0x84, 0x3,
+    0x90, 0x0, 0xc, 0x0, 0x0, 0xc1, 0x4, 0x90,
+    0x0, 0xc, 0x1, 0x51, 0xc0, 0x4, 0x80, 0x0,
+    0xc, 0x57, 0x8, 0x50, 0x5, 0x70, 0x0, 0x1f,
+    0x60, 0x2b, 0x0, 0x7, 0x50, 0x0, 0x3, 0x1,
+    0xa1, 0x4, 0x3c, 0x30, 0x0, 0x0, 0x36, 0x0,
+    0x1, 0xca, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+520A "刊" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x3,
+    0x55, 0x55, 0x96, 0x0, 0x1, 0xd0, 0x0, 0x10,
+    0xc0, 0x0, 0x7, 0x1, 0xb0, 0x0, 0x0, 0xc0,
+    0x0, 0xc, 0x1, 0xb0, 0x0, 0x0, 0xc0, 0x0,
+    0xb, 0x1, 0xb0, 0x0, 0x0, 0xc0, 0x17, 0xb,
+    0x1, 0xb0, 0x6, 0x55, 0xd5, 0x55, 0x1b, 0x1,
+    0xb0, 0x0, 0x0, 0xc0, 0x0, 0xb, 0x1, 0xb0,
+    0x0, 0x0, 0xc0, 0x0, 0xc, 0x1, 0xb0, 0x0,
+    0x0, 0xc0, 0x0, 0x1b, 0x1, 0xb0, 0x0, 0x0,
+    0xc0, 0x0, 0x0, 0x1, 0xb0, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0x13, 0xa0, 0x0, 0x0, 0xd0, 0x0,
+    0x1, 0x6e, 0x60, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x2, 0x0,
+
+    /* U+5217 "列" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0x10, 0x1, 0xc0, 0x3, 0x65,
+    0xe5, 0x55, 0x30, 0x1, 0xa0, 0x0, 0x3, 0xb0,
+    0x0, 0xb, 0x1, 0xa0, 0x0, 0x8, 0x95, 0x75,
+    0xb, 0x1, 0xa0, 0x0, 0xc, 0x0, 0x94, 0xb,
+    0x1, 0xa0, 0x0, 0x79, 0x10, 0xc0, 0xb, 0x1,
+    0xa0, 0x1, 0x62, 0xb3, 0x90, 0xb, 0x1, 0xa0,
+    0x4, 0x0, 0x7b, 0x20, 0xb, 0x1, 0xa0, 0x0,
+    0x0, 0x48, 0x0, 0xc, 0x1, 0xa0, 0x0, 0x2,
+    0xa0, 0x0, 0x4, 0x1, 0xa0, 0x0, 0x38, 0x0,
+    0x0, 0x3, 0x24, 0xa0, 0x4, 0x40, 0x0, 0x0,
+    0x1, 0x6f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0,
+
+    /* U+521D "初" */
+    0x0, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0x40, 0x45, 0x65, 0x55, 0xb1, 0x17, 0x55, 0xb7,
+    0x0, 0xc0, 0x0, 0xc0, 0x0, 0x2, 0xb0, 0x0,
+    0xc0, 0x0, 0xb0, 0x0, 0xc, 0x16, 0x50, 0xb0,
+    0x1, 0xa0, 0x0, 0x7e, 0x19, 0x2, 0x90, 0x2,
+    0x90, 0x6, 0x4b, 0x95, 0x5, 0x60, 0x4, 0x80,
+    0x32, 0xb, 0xb, 0x38, 0x20, 0x5, 0x70, 0x0,
+    0xb, 0x0, 0xa, 0x0, 0x6, 0x60, 0x0, 0xb,
+    0x0, 0x64, 0x0, 0x8, 0x40, 0x0, 0xb, 0x2,
+    0x70, 0x13, 0x1b, 0x10, 0x0, 0xb, 0x25, 0x0,
+    0x4, 0xea, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5224 "判" */
+    0x0, 0x0, 0x20, 0x0, 0x0, 0x1, 0x20, 0x0,
+    0x0, 0xb2, 0x0, 0x0, 0x2, 0xb0, 0x3, 0x50,
+    0xb0, 0x3b, 0x2, 0x1, 0x90, 0x0, 0xc3, 0xb0,
+    0x92, 0xc, 0x11, 0x90, 0x0, 0x62, 0xb3, 0x30,
+    0xb, 0x1, 0x90, 0x2, 0x55, 0xc5, 0x6b, 0xb,
+    0x1, 0x90, 0x0, 0x0, 0xb0, 0x0, 0xb, 0x1,
+    0x90, 0x0, 0x0, 0xb0, 0x3, 0xb, 0x1, 0x90,
+    0x17, 0x55, 0xc5, 0x58, 0x3b, 0x1, 0x90, 0x0,
+    0x4, 0x70, 0x0, 0xc, 0x1, 0x90, 0x0, 0xa,
+    0x0, 0x0, 0x6, 0x1, 0x90, 0x0, 0x73, 0x0,
+    0x0, 0x0, 0x2, 0x90, 0x6, 0x20, 0x0, 0x0,
+    0x0, 0x7f, 0x50, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x0,
+
+    /* U+5225 "別" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x85, 0x55, 0x59, 0x0, 0x0, 0xc0, 0x0, 0xb0,
+    0x0, 0x1a, 0x0, 0x0, 0xb0, 0x0, 0xb0, 0x0,
+    0x1a, 0xa, 0x0, 0xb0, 0x0, 0xd5, 0x55, 0x6a,
+    0xb, 0x0, 0xb0, 0x0, 0x68, 0x10, 0x4, 0xb,
+    0x0, 0xb0, 0x0, 0xd, 0x0, 0x0, 0xb, 0x0,
+    0xb0, 0x0, 0xd, 0x55, 0x6a, 0xb, 0x0, 0xb0,
+    0x0, 0x39, 0x0, 0x46, 0xb, 0x0, 0xb0, 0x0,
+    0x75, 0x0, 0x74, 0xa, 0x0, 0xb0, 0x0, 0xb0,
+    0x0, 0xa1, 0x0, 0x0, 0xb0, 0x4, 0x50, 0x22,
+    0xc0, 0x0, 0x12, 0xb0, 0x7, 0x0, 0x1d, 0x50,
+    0x0, 0x5e, 0x70, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0,
+
+    /* U+5229 "利" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x4, 0x0, 0x2,
+    0x59, 0xba, 0x40, 0x0, 0xb3, 0x3, 0x21, 0xc0,
+    0x0, 0x6, 0xa, 0x10, 0x0, 0xc, 0x0, 0x0,
+    0xb0, 0xa1, 0x25, 0x55, 0xd5, 0x6c, 0x1b, 0xa,
+    0x10, 0x10, 0x1f, 0x0, 0x0, 0xb0, 0xa1, 0x0,
+    0x7, 0xf5, 0x10, 0xb, 0xa, 0x10, 0x1, 0xac,
+    0x1d, 0x40, 0xb0, 0xa1, 0x0, 0x91, 0xc0, 0x36,
+    0xb, 0xa, 0x10, 0x62, 0xc, 0x0, 0x0, 0x90,
+    0xa1, 0x31, 0x0, 0xc0, 0x0, 0x0, 0xa, 0x10,
+    0x0, 0xc, 0x0, 0x0, 0x44, 0xd1, 0x0, 0x0,
+    0xc0, 0x0, 0x0, 0x7d, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+5230 "到" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x4,
+    0x55, 0x55, 0x6b, 0x0, 0x0, 0xd0, 0x1, 0x0,
+    0xd2, 0x0, 0x5, 0x0, 0xb0, 0x0, 0x8, 0x42,
+    0x10, 0xc, 0x10, 0xb0, 0x0, 0x53, 0x0, 0x93,
+    0xb, 0x0, 0xb0, 0x6, 0xd8, 0xa6, 0x5e, 0xb,
+    0x0, 0xb0, 0x0, 0x0, 0xc1, 0x5, 0xb, 0x0,
+    0xb0, 0x0, 0x0, 0xc0, 0x2, 0xb, 0x0, 0xb0,
+    0x4, 0x55, 0xd5, 0x67, 0xb, 0x0, 0xb0, 0x0,
+    0x0, 0xc0, 0x0, 0xc, 0x0, 0xb0, 0x0, 0x0,
+    0xc0, 0x14, 0x2, 0x0, 0xb0, 0x4, 0x68, 0xb7,
+    0x40, 0x0, 0x1, 0xb0, 0xa, 0x72, 0x0, 0x0,
+    0x1, 0x7f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x0,
+
+    /* U+5236 "制" */
+    0x0, 0x0, 0x10, 0x0, 0x0, 0x3, 0x0, 0x0,
+    0xb, 0x0, 0x0, 0x0, 0xb1, 0x3, 0xa0, 0xa0,
+    0x0, 0x2, 0xb, 0x0, 0x87, 0x5c, 0x6a, 0x0,
+    0xc0, 0xb0, 0x7, 0x0, 0xa0, 0x0, 0xa, 0xb,
+    0x3, 0x65, 0x5c, 0x57, 0x80, 0xa0, 0xb0, 0x0,
+    0x0, 0xa0, 0x10, 0xa, 0xb, 0x0, 0x95, 0x5c,
+    0x5c, 0x20, 0xa0, 0xb0, 0x9, 0x10, 0xa0, 0xa0,
+    0xa, 0xb, 0x0, 0x91, 0xa, 0xa, 0x0, 0xa0,
+    0xb0, 0x9, 0x10, 0xb5, 0xc0, 0x0, 0xb, 0x0,
+    0x60, 0xa, 0x26, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0xa0, 0x0, 0x3, 0xad, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x10,
+
+    /* U+5238 "券" */
+    0x0, 0x0, 0x0, 0x60, 0x1, 0x0, 0x0, 0x0,
+    0x1a, 0x10, 0xe1, 0xc, 0x20, 0x0, 0x0, 0x5,
+    0x92, 0xa0, 0x63, 0x0, 0x0, 0x2, 0x55, 0x69,
+    0x95, 0x75, 0xa8, 0x0, 0x0, 0x10, 0xb, 0x10,
+    0x0, 0x0, 0x0, 0x15, 0x55, 0x5d, 0x55, 0x55,
+    0x5b, 0x80, 0x1, 0x0, 0xa2, 0x0, 0x52, 0x0,
+    0x0, 0x0, 0x8, 0x40, 0x0, 0x9, 0x71, 0x0,
+    0x1, 0x84, 0x5b, 0x55, 0x5e, 0x7e, 0xb2, 0x14,
+    0x0, 0xc, 0x0, 0xc, 0x0, 0x20, 0x0, 0x0,
+    0x66, 0x0, 0x1a, 0x0, 0x0, 0x0, 0x3, 0xa0,
+    0x0, 0x48, 0x0, 0x0, 0x1, 0x67, 0x0, 0x18,
+    0xf3, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x10,
+    0x0, 0x0,
+
+    /* U+523B "刻" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x1, 0xb0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0x81, 0x5, 0x2, 0x0, 0xb0, 0x16, 0x57, 0xc5,
+    0x56, 0x2a, 0x40, 0xb0, 0x0, 0xa, 0x30, 0x50,
+    0x9, 0x20, 0xb0, 0x0, 0x64, 0x4, 0xb1, 0x9,
+    0x20, 0xb0, 0x3, 0xd6, 0x5c, 0x11, 0x9, 0x20,
+    0xb0, 0x0, 0x0, 0xa3, 0x6c, 0x9, 0x20, 0xb0,
+    0x0, 0x9, 0x31, 0xc1, 0x9, 0x20, 0xb0, 0x2,
+    0x81, 0xc, 0x20, 0x9, 0x20, 0xb0, 0x23, 0x1,
+    0xa4, 0xa1, 0x1, 0x0, 0xb0, 0x0, 0x49, 0x10,
+    0x5a, 0x0, 0x1, 0xa0, 0x16, 0x30, 0x0, 0x3,
+    0x0, 0x6d, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x0,
+
+    /* U+5247 "則" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x95, 0x55, 0xa2, 0x0, 0x0, 0xd0, 0x0, 0xb0,
+    0x0, 0xb0, 0x1, 0x0, 0xb0, 0x0, 0xc5, 0x55,
+    0xc0, 0xd, 0x0, 0xb0, 0x0, 0xb0, 0x0, 0xb0,
+    0xb, 0x0, 0xb0, 0x0, 0xc5, 0x55, 0xc0, 0xb,
+    0x0, 0xb0, 0x0, 0xb0, 0x0, 0xb0, 0xb, 0x0,
+    0xb0, 0x0, 0xb0, 0x0, 0xb0, 0xb, 0x0, 0xb0,
+    0x0, 0xc5, 0x55, 0xc0, 0xb, 0x0, 0xb0, 0x0,
+    0x53, 0x2, 0x40, 0x8, 0x0, 0xb0, 0x0, 0x4b,
+    0x7, 0x50, 0x0, 0x0, 0xb0, 0x0, 0x90, 0x0,
+    0xc4, 0x0, 0x0, 0xb0, 0x6, 0x0, 0x0, 0x38,
+    0x0, 0x6e, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x0,
+
+    /* U+524A "削" */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0,
+    0xc2, 0x6, 0x0, 0x0, 0xc0, 0x1b, 0xb, 0x3,
+    0xa0, 0x0, 0xb, 0x0, 0x84, 0xb0, 0x70, 0xa,
+    0x10, 0xb0, 0x8, 0x5d, 0x65, 0x90, 0xb0, 0xb,
+    0x0, 0xb0, 0x0, 0xc, 0xb, 0x0, 0xb0, 0xd,
+    0x55, 0x55, 0xc0, 0xb0, 0xb, 0x0, 0xb0, 0x0,
+    0xc, 0xb, 0x0, 0xb0, 0xb, 0x0, 0x0, 0xc0,
+    0xb0, 0xb, 0x0, 0xd5, 0x55, 0x5c, 0xc, 0x0,
+    0xb0, 0xb, 0x0, 0x0, 0xc0, 0x60, 0xb, 0x0,
+    0xb0, 0x1, 0x2c, 0x0, 0x12, 0xa0, 0x1b, 0x0,
+    0x3d, 0x70, 0x5, 0xe7, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x1, 0x0,
+
+    /* U+524D "前" */
+    0x0, 0x0, 0x10, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x0, 0x85, 0x0, 0x3e, 0x20, 0x0, 0x0, 0x0,
+    0x1c, 0x0, 0x91, 0x0, 0x40, 0x6, 0x55, 0x55,
+    0x55, 0x65, 0x56, 0x92, 0x0, 0x30, 0x3, 0x10,
+    0x0, 0x19, 0x0, 0x0, 0xb5, 0x5b, 0x30, 0xa2,
+    0x1a, 0x0, 0x0, 0xb0, 0x9, 0x10, 0xb0, 0x1a,
+    0x0, 0x0, 0xb5, 0x5b, 0x10, 0xb0, 0x1a, 0x0,
+    0x0, 0xb0, 0x9, 0x10, 0xb0, 0x1a, 0x0, 0x0,
+    0xb5, 0x5b, 0x10, 0xb0, 0x1a, 0x0, 0x0, 0xb0,
+    0x9, 0x10, 0xb0, 0x1a, 0x0, 0x0, 0xb0, 0x9,
+    0x10, 0x11, 0x3a, 0x0, 0x0, 0xb0, 0x6d, 0x0,
+    0x6, 0xf5, 0x0, 0x0, 0x10, 0x1, 0x0, 0x0,
+    0x10, 0x0,
+
+    /* U+525B "剛" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xa, 0x55,
+    0x55, 0x5c, 0x20, 0x0, 0xc0, 0xb1, 0x40, 0x61,
+    0xb0, 0x10, 0xb, 0xb, 0xa, 0x1a, 0xb, 0xa,
+    0x10, 0xb0, 0xb2, 0x66, 0x76, 0xb0, 0xa0, 0xb,
+    0xb, 0x12, 0xa1, 0x1b, 0xa, 0x0, 0xb0, 0xb1,
+    0x19, 0x22, 0xb0, 0xa0, 0xb, 0xb, 0x55, 0x94,
+    0x5b, 0xa, 0x0, 0xb0, 0xb5, 0x49, 0x45, 0xb0,
+    0xa0, 0xb, 0xb, 0x68, 0xa8, 0x5b, 0x8, 0x0,
+    0xb0, 0xb0, 0x0, 0x11, 0xb0, 0x0, 0xb, 0xb,
+    0x0, 0x0, 0xb, 0x0, 0x2, 0xa0, 0xa0, 0x0,
+    0x2a, 0xd0, 0x27, 0xe7, 0x0, 0x0, 0x0, 0x11,
+    0x0, 0x1, 0x0,
+
+    /* U+5272 "割" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xb0, 0x0, 0x0, 0x0, 0xc0, 0x6, 0x55,
+    0x75, 0x5a, 0x21, 0x0, 0xb0, 0x1b, 0x0, 0xb1,
+    0x4, 0xb, 0x30, 0xb0, 0x3, 0x55, 0xc5, 0x67,
+    0xa, 0x0, 0xb0, 0x0, 0x0, 0xb0, 0x0, 0xa,
+    0x0, 0xb0, 0x1, 0x55, 0xc5, 0x73, 0xa, 0x0,
+    0xb0, 0x0, 0x0, 0xb0, 0x4, 0x2a, 0x0, 0xb0,
+    0x6, 0x55, 0xd5, 0x55, 0x3b, 0x0, 0xb0, 0x0,
+    0x95, 0x65, 0xa1, 0xa, 0x10, 0xb0, 0x0, 0xb0,
+    0x0, 0xb0, 0x0, 0x0, 0xb0, 0x0, 0xb0, 0x0,
+    0xb0, 0x0, 0x0, 0xb0, 0x0, 0xd5, 0x55, 0xc0,
+    0x0, 0x6c, 0xa0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x2, 0x0,
+
+    /* U+5275 "創" */
+    0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0xd5, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x6,
+    0x73, 0xa3, 0x0, 0x0, 0xa0, 0x0, 0x29, 0x45,
+    0x1c, 0xb, 0x0, 0xa0, 0x1, 0x80, 0xa, 0x1,
+    0xa, 0x0, 0xa0, 0x15, 0x86, 0x55, 0x5a, 0xa,
+    0x0, 0xa0, 0x0, 0x86, 0x55, 0x59, 0xa, 0x0,
+    0xa0, 0x0, 0x82, 0x0, 0x9, 0xa, 0x0, 0xa0,
+    0x0, 0x96, 0x55, 0x58, 0xb, 0x0, 0xa0, 0x0,
+    0xb7, 0x55, 0x57, 0x6, 0x0, 0xa0, 0x1, 0xa9,
+    0x0, 0xa, 0x0, 0x0, 0xa0, 0x6, 0x39, 0x0,
+    0xa, 0x0, 0x0, 0xa0, 0x15, 0x1b, 0x55, 0x5a,
+    0x1, 0x7d, 0x70, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0,
+
+    /* U+5283 "劃" */
+    0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0xa2, 0x2, 0x0, 0x0, 0xc0, 0x0, 0x55,
+    0xb5, 0x5c, 0x0, 0x0, 0xa0, 0x6, 0x55, 0xb5,
+    0x5c, 0x92, 0x90, 0xa0, 0x0, 0x33, 0xb4, 0x3b,
+    0x0, 0xa0, 0xa0, 0x0, 0x22, 0xa2, 0x35, 0x0,
+    0xa0, 0xa0, 0x0, 0x55, 0xb5, 0x54, 0x40, 0xa0,
+    0xa0, 0x5, 0x75, 0x55, 0x57, 0x51, 0xa0, 0xa0,
+    0x0, 0xc5, 0xc5, 0x5c, 0x0, 0xa0, 0xa0, 0x0,
+    0xc5, 0xc5, 0x5a, 0x0, 0x60, 0xa0, 0x0, 0xc5,
+    0xc5, 0x5a, 0x0, 0x0, 0xa0, 0x0, 0x40, 0x0,
+    0x27, 0x20, 0x11, 0xb0, 0x7, 0xb9, 0x75, 0x31,
+    0x0, 0x4d, 0x80, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0,
+
+    /* U+529B "力" */
+    0x0, 0x0, 0x0, 0x41, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x10,
+    0x0, 0x10, 0x1, 0x75, 0x55, 0xd5, 0x55, 0x5d,
+    0x40, 0x0, 0x0, 0xc, 0x0, 0x0, 0xd0, 0x0,
+    0x0, 0x3, 0x90, 0x0, 0xd, 0x0, 0x0, 0x0,
+    0x84, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x1c, 0x0,
+    0x0, 0x2b, 0x0, 0x0, 0x9, 0x40, 0x0, 0x4,
+    0xa0, 0x0, 0x4, 0x80, 0x0, 0x0, 0x67, 0x0,
+    0x4, 0x80, 0x0, 0x36, 0x4d, 0x30, 0x5, 0x50,
+    0x0, 0x0, 0x4f, 0x80, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x10, 0x0,
+
+    /* U+529F "功" */
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0x30, 0x0, 0x0, 0x0, 0x4,
+    0x0, 0xa1, 0x0, 0x0, 0x65, 0xc5, 0x52, 0xa,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x55, 0xc5, 0x5a,
+    0x50, 0x0, 0xa0, 0x0, 0xb, 0x0, 0x92, 0x0,
+    0xa, 0x0, 0x0, 0xb0, 0xa, 0x10, 0x0, 0xa0,
+    0x0, 0x1a, 0x0, 0xb0, 0x0, 0xa, 0x3, 0x25,
+    0x60, 0xc, 0x0, 0x26, 0xc6, 0x10, 0xb0, 0x0,
+    0xc0, 0x2c, 0x50, 0x0, 0x65, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0x47, 0x4, 0x23, 0xb0, 0x0, 0x0,
+    0x54, 0x0, 0x18, 0xf4, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x1, 0x0,
+
+    /* U+52A0 "加" */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x5d, 0x55,
+    0x91, 0xb5, 0x55, 0xc0, 0x0, 0xb, 0x0, 0xb0,
+    0xb0, 0x0, 0xb0, 0x0, 0xc, 0x0, 0xb0, 0xb0,
+    0x0, 0xb0, 0x0, 0xc, 0x0, 0xb0, 0xb0, 0x0,
+    0xb0, 0x0, 0xb, 0x0, 0xa0, 0xb0, 0x0, 0xb0,
+    0x0, 0x29, 0x1, 0x90, 0xb0, 0x0, 0xb0, 0x0,
+    0x64, 0x2, 0x80, 0xb0, 0x0, 0xb0, 0x0, 0xa0,
+    0x5, 0x60, 0xb0, 0x0, 0xb0, 0x5, 0x44, 0x7c,
+    0x30, 0xc5, 0x55, 0xb0, 0x15, 0x0, 0x66, 0x0,
+    0xb0, 0x0, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+52A8 "动" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0x0, 0x0, 0x3, 0x65,
+    0x5a, 0x50, 0xb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0x0, 0x10, 0x0, 0x0, 0x0, 0x15,
+    0x5c, 0x55, 0xd0, 0x5, 0x57, 0x65, 0x92, 0xb,
+    0x0, 0xb0, 0x0, 0xb, 0x60, 0x0, 0x19, 0x0,
+    0xb0, 0x0, 0x29, 0x2, 0x0, 0x46, 0x0, 0xb0,
+    0x0, 0x80, 0x8, 0x20, 0x82, 0x1, 0xa0, 0x5,
+    0x32, 0x36, 0xd0, 0xa0, 0x1, 0xa0, 0xd, 0xb6,
+    0x20, 0x96, 0x30, 0x3, 0x90, 0x0, 0x0, 0x0,
+    0x36, 0x3, 0x17, 0x60, 0x0, 0x0, 0x4, 0x40,
+    0x2, 0xcd, 0x10, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+52A9 "助" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x30, 0x4, 0x0, 0xe, 0x0, 0x0, 0x0, 0xd5,
+    0x5c, 0x20, 0xc, 0x0, 0x0, 0x0, 0xb0, 0xb,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0xb0, 0xb, 0x26,
+    0x5d, 0x55, 0xc0, 0x0, 0xc5, 0x5c, 0x0, 0xc,
+    0x0, 0xb0, 0x0, 0xb0, 0xb, 0x0, 0xc, 0x0,
+    0xb0, 0x0, 0xc5, 0x5c, 0x0, 0x2a, 0x0, 0xb0,
+    0x0, 0xb0, 0xb, 0x0, 0x56, 0x0, 0xb0, 0x0,
+    0xb0, 0xb, 0x0, 0xb1, 0x0, 0xb0, 0x0, 0xb4,
+    0x78, 0x46, 0x60, 0x2, 0x90, 0x1d, 0xa4, 0x0,
+    0x36, 0x3, 0x59, 0x60, 0x1, 0x0, 0x5, 0x40,
+    0x0, 0x5a, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+52AA "努" */
+    0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x50, 0x1, 0x11, 0x14, 0x0, 0x5, 0x5c,
+    0x57, 0x67, 0x44, 0x6d, 0x10, 0x1, 0x28, 0x9,
+    0x30, 0x60, 0x93, 0x0, 0x0, 0x92, 0xb, 0x0,
+    0x58, 0x80, 0x0, 0x0, 0x16, 0xca, 0x10, 0x2d,
+    0x80, 0x0, 0x0, 0x18, 0x44, 0x76, 0x70, 0x5c,
+    0x82, 0x14, 0x50, 0x1, 0xa4, 0x0, 0x0, 0x20,
+    0x0, 0x35, 0x55, 0xc8, 0x55, 0x75, 0x0, 0x0,
+    0x10, 0x1, 0xc0, 0x0, 0x85, 0x0, 0x0, 0x0,
+    0x9, 0x50, 0x0, 0xa3, 0x0, 0x0, 0x0, 0x87,
+    0x1, 0x31, 0xd0, 0x0, 0x2, 0x57, 0x20, 0x0,
+    0x6f, 0x60, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+52B3 "劳" */
+    0x0, 0x0, 0x40, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0xd, 0x0, 0x0, 0x35, 0x55, 0xc5,
+    0x55, 0xc5, 0x6d, 0x20, 0x0, 0xb, 0x0, 0xb,
+    0x0, 0x0, 0x2, 0x0, 0x60, 0x0, 0x50, 0x2,
+    0x0, 0x95, 0x55, 0x65, 0x55, 0x56, 0xe1, 0x3b,
+    0x0, 0xb, 0x40, 0x0, 0x51, 0x0, 0x0, 0x0,
+    0xc1, 0x0, 0x21, 0x0, 0x4, 0x65, 0x5e, 0x55,
+    0x5b, 0x60, 0x0, 0x0, 0x2, 0xb0, 0x0, 0xa2,
+    0x0, 0x0, 0x0, 0xa4, 0x0, 0xc, 0x0, 0x0,
+    0x0, 0x78, 0x1, 0x1, 0xd0, 0x0, 0x3, 0x84,
+    0x0, 0x7, 0xf7, 0x0, 0x3, 0x20, 0x0, 0x0,
+    0x2, 0x0, 0x0,
+
+    /* U+52C9 "勉" */
+    0x0, 0x4, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x2c, 0x0, 0x0, 0xc, 0x10, 0x0, 0x0, 0x97,
+    0x5d, 0x20, 0xa, 0x0, 0x0, 0x2, 0x80, 0x35,
+    0x0, 0xa, 0x2, 0x0, 0x7, 0xa5, 0xa5, 0xb5,
+    0x5c, 0x5a, 0x40, 0x10, 0xb0, 0xb0, 0xa0, 0xa,
+    0x8, 0x10, 0x0, 0xb0, 0xb0, 0xa0, 0xa, 0x8,
+    0x10, 0x0, 0xc5, 0xd8, 0xc0, 0x46, 0x9, 0x10,
+    0x0, 0x23, 0x98, 0x10, 0x91, 0xa, 0x0, 0x0,
+    0x8, 0x48, 0x2, 0x81, 0x1b, 0x0, 0x0, 0x19,
+    0x28, 0x7, 0x0, 0xa7, 0x40, 0x0, 0x81, 0x18,
+    0x30, 0x0, 0x0, 0x80, 0x6, 0x20, 0xb, 0x88,
+    0x88, 0x8a, 0xa0, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+52D5 "動" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x6b, 0x80, 0xc, 0x10, 0x0, 0x3, 0x4b,
+    0x30, 0x0, 0xc, 0x0, 0x0, 0x26, 0x5b, 0x65,
+    0xa2, 0xb, 0x0, 0x30, 0x1, 0x9, 0x10, 0x24,
+    0x6c, 0x55, 0xd0, 0xb, 0x5b, 0x65, 0xc0, 0xb,
+    0x0, 0xb0, 0xa, 0x5b, 0x65, 0xa0, 0xb, 0x0,
+    0xa0, 0xa, 0x9, 0x10, 0xa0, 0x19, 0x0, 0xa0,
+    0xa, 0x5b, 0x65, 0x90, 0x55, 0x0, 0xa0, 0x0,
+    0x9, 0x10, 0x40, 0xa0, 0x2, 0x80, 0x6, 0x5b,
+    0x65, 0x52, 0x80, 0x4, 0x60, 0x0, 0x1a, 0x65,
+    0x48, 0x3, 0x1a, 0x30, 0x1d, 0x94, 0x0, 0x52,
+    0x2, 0xca, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x10, 0x0,
+
+    /* U+52D9 "務" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x44, 0x46, 0x10, 0xd1, 0x0, 0x0, 0x1, 0x20,
+    0x2a, 0x45, 0xa5, 0x5d, 0x20, 0x0, 0x19, 0x70,
+    0x7, 0x60, 0x38, 0x0, 0x0, 0x1, 0xd0, 0x20,
+    0x28, 0xb0, 0x0, 0x5, 0x57, 0x97, 0x70, 0x1a,
+    0xb1, 0x0, 0x0, 0xc, 0xa5, 0x14, 0x91, 0x2c,
+    0xa4, 0x0, 0x29, 0xa1, 0x63, 0x76, 0x0, 0x40,
+    0x0, 0x92, 0xa0, 0x46, 0xc6, 0x5c, 0x30, 0x3,
+    0x51, 0xa0, 0x0, 0xb0, 0xb, 0x0, 0x5, 0x1,
+    0xa0, 0x5, 0x60, 0xb, 0x0, 0x0, 0x23, 0xa0,
+    0x29, 0x0, 0x1b, 0x0, 0x0, 0x4d, 0x63, 0x60,
+    0x7, 0xe6, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x10, 0x0,
+
+    /* U+52DD "勝" */
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x8,
+    0x55, 0xb0, 0x81, 0xc1, 0x76, 0x0, 0x9, 0x10,
+    0xa0, 0x3a, 0xb2, 0x70, 0x0, 0x9, 0x10, 0xa2,
+    0x57, 0xc6, 0x78, 0x0, 0x9, 0x65, 0xa0, 0x12,
+    0x80, 0x2, 0x0, 0x9, 0x10, 0xb6, 0x5a, 0x77,
+    0x58, 0x50, 0x9, 0x10, 0xa0, 0x2a, 0x25, 0x30,
+    0x0, 0x9, 0x65, 0xa1, 0x83, 0xa0, 0x7b, 0x60,
+    0xa, 0x0, 0xb6, 0x77, 0xa5, 0x95, 0x30, 0xa,
+    0x0, 0xa0, 0x7, 0x20, 0xa0, 0x0, 0x9, 0x0,
+    0xa0, 0xa, 0x0, 0xa0, 0x0, 0x15, 0x0, 0xa0,
+    0x82, 0x0, 0xb0, 0x0, 0x40, 0x3c, 0x66, 0x20,
+    0x5c, 0x80, 0x0, 0x10, 0x1, 0x10, 0x0, 0x2,
+    0x0, 0x0,
+
+    /* U+52E4 "勤" */
+    0x0, 0x12, 0x3, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x38, 0x8, 0x13, 0xa, 0x30, 0x0, 0x6, 0x7a,
+    0x5b, 0x67, 0xa, 0x0, 0x0, 0x0, 0x3a, 0x5b,
+    0x0, 0xb, 0x0, 0x0, 0x0, 0x22, 0xa2, 0x22,
+    0x6c, 0x55, 0xc2, 0x1, 0xb5, 0xc5, 0xb3, 0xb,
+    0x0, 0xb0, 0x1, 0xa0, 0xa0, 0x91, 0xb, 0x0,
+    0xb0, 0x1, 0xa5, 0xc5, 0x91, 0xb, 0x0, 0xb0,
+    0x2, 0x65, 0xc5, 0x86, 0xa, 0x0, 0xb0, 0x0,
+    0x0, 0xa0, 0x40, 0x47, 0x0, 0xb0, 0x0, 0x65,
+    0xc5, 0x52, 0x91, 0x0, 0xc0, 0x0, 0x2, 0xb5,
+    0x47, 0x63, 0x36, 0xa0, 0xb, 0xa6, 0x30, 0x35,
+    0x0, 0x7d, 0x10, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+52F5 "勵" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x6,
+    0x55, 0x55, 0x5a, 0xb, 0x20, 0x0, 0x9, 0x0,
+    0x60, 0x60, 0xa, 0x0, 0x0, 0x9, 0x56, 0xa5,
+    0xb7, 0xa, 0x0, 0x10, 0x8, 0x0, 0x30, 0x42,
+    0x6c, 0x55, 0xb2, 0x8, 0xb, 0x59, 0x75, 0xa,
+    0x0, 0xa0, 0x9, 0xc, 0x5a, 0x74, 0xa, 0x0,
+    0xa0, 0x9, 0xc, 0x5a, 0x74, 0xa, 0x0, 0xa0,
+    0x9, 0x2, 0x17, 0x11, 0x9, 0x0, 0xa0, 0x8,
+    0x77, 0x5a, 0x5a, 0x46, 0x0, 0xa0, 0x7, 0x74,
+    0x3a, 0x59, 0x81, 0x0, 0xa0, 0x32, 0x75, 0x61,
+    0x59, 0x81, 0x14, 0x80, 0x20, 0x73, 0x0, 0x8b,
+    0x10, 0x7d, 0x10, 0x0, 0x10, 0x0, 0x1, 0x0,
+    0x0, 0x0,
+
+    /* U+5305 "包" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0x90, 0x0, 0x0, 0x30, 0x0, 0x0, 0xc, 0x55,
+    0x55, 0x55, 0xc4, 0x0, 0x0, 0x84, 0x0, 0x1,
+    0x0, 0xa1, 0x0, 0x4, 0x6c, 0x55, 0x5c, 0x30,
+    0xb0, 0x0, 0x25, 0xb, 0x0, 0xb, 0x0, 0xb0,
+    0x0, 0x0, 0xb, 0x0, 0xb, 0x0, 0xc0, 0x0,
+    0x0, 0xb, 0x55, 0x5b, 0x20, 0xc0, 0x0, 0x0,
+    0xb, 0x0, 0x0, 0x4a, 0xa0, 0x30, 0x0, 0xb,
+    0x0, 0x0, 0x3, 0x0, 0x60, 0x0, 0xb, 0x0,
+    0x0, 0x0, 0x1, 0xc0, 0x0, 0x5, 0xba, 0xaa,
+    0xaa, 0xbd, 0xb1,
+
+    /* U+5316 "化" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc0, 0xa, 0x30, 0x0, 0x0, 0x0, 0x6,
+    0x80, 0xa, 0x10, 0x0, 0x0, 0x0, 0xc, 0x10,
+    0xa, 0x10, 0x12, 0x0, 0x0, 0x4b, 0x0, 0xa,
+    0x10, 0xa8, 0x0, 0x0, 0xbd, 0x0, 0xa, 0x17,
+    0x80, 0x0, 0x4, 0x4c, 0x0, 0xa, 0x79, 0x0,
+    0x0, 0x6, 0xc, 0x0, 0xb, 0x80, 0x0, 0x0,
+    0x10, 0xc, 0x0, 0x8d, 0x10, 0x0, 0x0, 0x0,
+    0xc, 0x26, 0x1a, 0x10, 0x0, 0x30, 0x0, 0xc,
+    0x10, 0xa, 0x10, 0x0, 0x60, 0x0, 0xc, 0x0,
+    0xa, 0x20, 0x1, 0xb0, 0x0, 0xd, 0x0, 0x6,
+    0xdb, 0xbc, 0xa0, 0x0, 0x5, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5317 "北" */
+    0x0, 0x0, 0x2, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0x0, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0xc0, 0x0, 0x20, 0x3, 0x55, 0x5c, 0x0,
+    0xc0, 0xb, 0xa0, 0x0, 0x0, 0xc, 0x0, 0xc3,
+    0x83, 0x0, 0x0, 0x0, 0xc, 0x0, 0xc3, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0x0, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0x0, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0x0, 0xc0, 0x0, 0x40, 0x1, 0x58,
+    0x5c, 0x0, 0xc0, 0x0, 0x60, 0xa, 0x60, 0xc,
+    0x0, 0xc0, 0x0, 0xb1, 0x0, 0x0, 0xc, 0x0,
+    0x9c, 0xbc, 0xd3, 0x0, 0x0, 0x4, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+533B "医" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0x55, 0x55, 0x55, 0x55, 0x7c, 0x10, 0xb, 0x10,
+    0xa, 0x10, 0x0, 0x0, 0x0, 0xb, 0x10, 0x1b,
+    0x0, 0x0, 0x20, 0x0, 0xb, 0x10, 0x78, 0x59,
+    0x57, 0x80, 0x0, 0xb, 0x10, 0x80, 0xb, 0x0,
+    0x0, 0x0, 0xb, 0x14, 0x0, 0x1a, 0x0, 0x3,
+    0x0, 0xb, 0x26, 0x55, 0x7b, 0x55, 0x58, 0x30,
+    0xb, 0x10, 0x0, 0x79, 0x10, 0x0, 0x0, 0xb,
+    0x10, 0x2, 0xb0, 0x7a, 0x30, 0x0, 0xb, 0x10,
+    0x39, 0x0, 0x3, 0xe3, 0x0, 0xb, 0x15, 0x40,
+    0x0, 0x0, 0x36, 0x10, 0xb, 0x55, 0x55, 0x55,
+    0x55, 0x58, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5340 "區" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x85, 0x55,
+    0x55, 0x55, 0x58, 0x80, 0x92, 0x1, 0x0, 0x0,
+    0x30, 0x0, 0x92, 0x5, 0x95, 0x55, 0xc0, 0x0,
+    0x92, 0x5, 0x60, 0x0, 0xa0, 0x0, 0x92, 0x5,
+    0x95, 0x55, 0xa0, 0x0, 0x92, 0x1, 0x10, 0x0,
+    0x20, 0x0, 0x92, 0x85, 0x58, 0x85, 0x5a, 0x10,
+    0x92, 0xa0, 0x19, 0xa0, 0xa, 0x0, 0x92, 0xa0,
+    0x19, 0xa0, 0xa, 0x0, 0x92, 0xb5, 0x69, 0xa5,
+    0x5c, 0x0, 0x92, 0x30, 0x1, 0x20, 0x1, 0x0,
+    0xa6, 0x55, 0x55, 0x55, 0x55, 0xe3, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+5341 "十" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb1,
+    0x0, 0x0, 0x0, 0x25, 0x55, 0x55, 0xc6, 0x55,
+    0x5a, 0x90, 0x1, 0x0, 0x0, 0xb1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5343 "千" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x25, 0x9e, 0xa0, 0x0, 0x0, 0x45,
+    0x67, 0xd6, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa2, 0x0,
+    0x5, 0x40, 0x36, 0x55, 0x55, 0xc7, 0x55, 0x55,
+    0x50, 0x0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+5348 "午" */
+    0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0x80, 0x0, 0x0, 0x62, 0x0, 0x0, 0xb, 0x55,
+    0x6b, 0x55, 0x54, 0x0, 0x0, 0x73, 0x0, 0x2a,
+    0x0, 0x0, 0x0, 0x3, 0x40, 0x0, 0x2a, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2a, 0x0, 0x0,
+    0x40, 0x6, 0x55, 0x55, 0x6c, 0x55, 0x56, 0x81,
+    0x0, 0x0, 0x0, 0x2a, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2a, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0x0,
+    0x0, 0x0,
+
+    /* U+534A "半" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc2, 0x0, 0x20, 0x0, 0x0, 0x26,
+    0x0, 0xc0, 0x5, 0xd1, 0x0, 0x0, 0x6, 0xb0,
+    0xc0, 0xa, 0x10, 0x0, 0x0, 0x0, 0xb0, 0xc0,
+    0x60, 0x0, 0x0, 0x2, 0x55, 0x55, 0xd5, 0x55,
+    0x8a, 0x0, 0x0, 0x10, 0x0, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0,
+    0x16, 0x55, 0x55, 0xd5, 0x55, 0x5a, 0x90, 0x0,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+5352 "卒" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3a, 0x0, 0x1, 0x0, 0x0, 0x65,
+    0x55, 0x59, 0x55, 0x6b, 0x20, 0x0, 0x0, 0x86,
+    0x0, 0x1d, 0x0, 0x0, 0x0, 0x0, 0xd0, 0x0,
+    0x77, 0x0, 0x0, 0x0, 0x6, 0x6a, 0x11, 0xa6,
+    0x60, 0x0, 0x0, 0x18, 0x5, 0x78, 0x10, 0xa6,
+    0x0, 0x0, 0x50, 0x0, 0x5a, 0x0, 0x13, 0x0,
+    0x4, 0x55, 0x55, 0x5d, 0x55, 0x56, 0xd2, 0x1,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0,
+    0x0, 0x0,
+
+    /* U+5354 "協" */
+    0x0, 0x10, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0xa3, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xa1,
+    0x3, 0x67, 0xa5, 0x5b, 0x20, 0x0, 0xa1, 0x0,
+    0x9, 0x20, 0xa, 0x0, 0x26, 0xc5, 0x91, 0x56,
+    0x0, 0x37, 0x0, 0x0, 0xa1, 0x15, 0x40, 0x18,
+    0xc1, 0x0, 0x0, 0xa1, 0x24, 0x30, 0x0, 0x60,
+    0x0, 0x0, 0xa1, 0x6a, 0x96, 0x75, 0xd5, 0x90,
+    0x0, 0xa1, 0x9, 0x14, 0x50, 0xa0, 0x90, 0x0,
+    0xa1, 0xa, 0x6, 0x32, 0x90, 0xa0, 0x0, 0xa1,
+    0x27, 0x8, 0x17, 0x40, 0xa0, 0x0, 0xa1, 0x72,
+    0x3b, 0x9, 0x0, 0xa0, 0x0, 0xa5, 0x30, 0x76,
+    0x70, 0x5b, 0x60, 0x0, 0x21, 0x0, 0x2, 0x0,
+    0x3, 0x0,
+
+    /* U+5357 "南" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa5, 0x0, 0x0, 0x0, 0x5, 0x55,
+    0x55, 0xc6, 0x55, 0x5a, 0xc0, 0x1, 0x0, 0x0,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x75, 0x55, 0xd5,
+    0x55, 0x59, 0x10, 0x0, 0xb0, 0x22, 0x0, 0x91,
+    0xb, 0x0, 0x0, 0xb0, 0xc, 0x14, 0x80, 0xb,
+    0x0, 0x0, 0xb0, 0x58, 0x5a, 0x5b, 0x1b, 0x0,
+    0x0, 0xb0, 0x10, 0xa1, 0x0, 0xb, 0x0, 0x0,
+    0xb4, 0x65, 0xc5, 0x59, 0x4b, 0x0, 0x0, 0xb0,
+    0x0, 0xa1, 0x0, 0xb, 0x0, 0x0, 0xb0, 0x0,
+    0xa1, 0x13, 0x2c, 0x0, 0x0, 0xb0, 0x0, 0x70,
+    0x4, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x10, 0x0,
+
+    /* U+5358 "単" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0x50, 0xa1, 0x4, 0xc0, 0x0, 0x0, 0x0,
+    0xb5, 0x68, 0xa, 0x20, 0x0, 0x0, 0x2, 0x23,
+    0x12, 0x43, 0x30, 0x0, 0x0, 0xc, 0x55, 0xb6,
+    0x55, 0xc2, 0x0, 0x0, 0xb, 0x0, 0x91, 0x0,
+    0xb0, 0x0, 0x0, 0xc, 0x55, 0xb6, 0x55, 0xc0,
+    0x0, 0x0, 0xb, 0x0, 0x91, 0x0, 0xb0, 0x0,
+    0x0, 0xb, 0x55, 0xb6, 0x55, 0xa0, 0x0, 0x4,
+    0x55, 0x55, 0xb6, 0x55, 0x59, 0xc0, 0x1, 0x0,
+    0x0, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5371 "危" */
+    0x0, 0x0, 0x21, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb5, 0x0, 0x3, 0x0, 0x0, 0x0, 0x5,
+    0xa5, 0x55, 0xab, 0x0, 0x0, 0x0, 0x2a, 0x0,
+    0x1, 0x80, 0x0, 0x0, 0x2, 0x89, 0x55, 0x58,
+    0x55, 0x5a, 0x60, 0x3, 0xc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0x9, 0x65, 0x55, 0xc0,
+    0x0, 0x0, 0xc, 0x9, 0x20, 0x0, 0xa0, 0x0,
+    0x0, 0xc, 0x9, 0x20, 0x0, 0xa0, 0x0, 0x0,
+    0xb, 0x9, 0x20, 0x57, 0xa0, 0x20, 0x0, 0x47,
+    0x9, 0x20, 0x7, 0x20, 0x60, 0x0, 0xa1, 0x9,
+    0x20, 0x0, 0x0, 0xb0, 0x5, 0x30, 0x4, 0xca,
+    0xaa, 0xab, 0xb1, 0x11, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5373 "即" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x55,
+    0xa4, 0x7, 0x55, 0x93, 0xb, 0x0, 0x92, 0xb,
+    0x0, 0xa1, 0xb, 0x0, 0x92, 0xb, 0x0, 0xa1,
+    0xc, 0x55, 0xb2, 0xb, 0x0, 0xa1, 0xb, 0x0,
+    0x92, 0xb, 0x0, 0xa1, 0xc, 0x55, 0xb2, 0xb,
+    0x0, 0xa1, 0xb, 0x1, 0x30, 0xb, 0x0, 0xa1,
+    0xb, 0x5, 0x60, 0xb, 0x0, 0xa1, 0xb, 0x0,
+    0xc7, 0xb, 0x27, 0xc0, 0x1d, 0x86, 0x1b, 0xb,
+    0x3, 0x50, 0x6, 0x0, 0x0, 0xb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x0, 0x0,
+
+    /* U+537B "卻" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4a, 0x4, 0x80, 0x20, 0x0, 0x20, 0x1, 0xa1,
+    0x0, 0x79, 0xc5, 0x55, 0xd0, 0x15, 0x1, 0x90,
+    0x4, 0xb0, 0x0, 0xb0, 0x0, 0x9, 0x85, 0x0,
+    0xb0, 0x0, 0xb0, 0x0, 0x47, 0x5, 0xb0, 0xb0,
+    0x0, 0xb0, 0x2, 0x80, 0x0, 0x77, 0xb0, 0x0,
+    0xb0, 0x16, 0x75, 0x55, 0xa2, 0xb0, 0x0, 0xb0,
+    0x10, 0xb0, 0x0, 0xb0, 0xb0, 0x0, 0xb0, 0x0,
+    0xb0, 0x0, 0xb0, 0xb1, 0x54, 0xb0, 0x0, 0xb0,
+    0x0, 0xb0, 0xb0, 0x1a, 0x40, 0x0, 0xb5, 0x55,
+    0xb0, 0xb0, 0x0, 0x0, 0x0, 0x60, 0x0, 0x40,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+539A "厚" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0,
+    0x95, 0x55, 0x55, 0x55, 0x5a, 0x50, 0x0, 0xa1,
+    0x7, 0x55, 0x55, 0x80, 0x0, 0x0, 0xa1, 0xb,
+    0x0, 0x0, 0xb0, 0x0, 0x0, 0xa1, 0xc, 0x55,
+    0x55, 0xc0, 0x0, 0x0, 0xa1, 0xc, 0x55, 0x55,
+    0xc0, 0x0, 0x0, 0xa0, 0x6, 0x0, 0x0, 0x60,
+    0x0, 0x0, 0xb0, 0x56, 0x55, 0x57, 0xd2, 0x0,
+    0x0, 0xb0, 0x0, 0x1, 0x75, 0x0, 0x0, 0x0,
+    0xb4, 0x65, 0x55, 0xc5, 0x58, 0x80, 0x3, 0x70,
+    0x0, 0x1, 0xa0, 0x0, 0x0, 0x7, 0x10, 0x0,
+    0x11, 0xa0, 0x0, 0x0, 0x14, 0x0, 0x0, 0x4e,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+539F "原" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x9,
+    0x55, 0x55, 0x65, 0x58, 0x90, 0x0, 0xb1, 0x0,
+    0x9, 0x30, 0x0, 0x0, 0xb, 0x11, 0x75, 0x95,
+    0x59, 0x20, 0x0, 0xb1, 0x1a, 0x0, 0x0, 0x91,
+    0x0, 0xb, 0x11, 0xc5, 0x55, 0x5b, 0x10, 0x0,
+    0xb0, 0x1a, 0x0, 0x0, 0x91, 0x0, 0xb, 0x1,
+    0xc5, 0x57, 0x5b, 0x20, 0x0, 0xb0, 0x3, 0x1,
+    0xa0, 0x30, 0x0, 0xb, 0x0, 0x7a, 0x1a, 0x35,
+    0x0, 0x2, 0x80, 0x5a, 0x1, 0xa0, 0x4c, 0x30,
+    0x71, 0x65, 0x3, 0x5a, 0x0, 0x3c, 0x14, 0x11,
+    0x0, 0x1b, 0x50, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+53B3 "厳" */
+    0x0, 0x1, 0x0, 0x10, 0x0, 0x10, 0x0, 0x0,
+    0x2b, 0x4, 0x80, 0x67, 0x0, 0x0, 0x10, 0x80,
+    0x8, 0x15, 0x6, 0x0, 0xc, 0x55, 0x55, 0x56,
+    0x75, 0x73, 0x0, 0xc1, 0x77, 0x80, 0x59, 0x0,
+    0x0, 0xc, 0x0, 0x72, 0x39, 0x10, 0x60, 0x0,
+    0xc3, 0xc5, 0xc5, 0xc5, 0x99, 0x10, 0xc, 0xa,
+    0x5c, 0x56, 0x8, 0x30, 0x0, 0xb0, 0xa0, 0xa0,
+    0x33, 0xb0, 0x0, 0xa, 0xa, 0x5c, 0x0, 0x99,
+    0x0, 0x2, 0x70, 0xb4, 0xc5, 0x1b, 0x60, 0x0,
+    0x61, 0xa8, 0x3a, 0x5, 0x6b, 0x60, 0x6, 0x0,
+    0x0, 0x94, 0x30, 0xb, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+53BB "去" */
+    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x20,
+    0x8, 0x0, 0x0, 0x55, 0x55, 0xc7, 0x55, 0x52,
+    0x0, 0x0, 0x0, 0xa, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa2, 0x0, 0x8, 0x21, 0x65, 0x55,
+    0x5e, 0x65, 0x55, 0x53, 0x0, 0x0, 0x7, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x90, 0x4, 0x10,
+    0x0, 0x0, 0x2, 0x80, 0x0, 0xa, 0x50, 0x0,
+    0x6, 0xc6, 0x66, 0x66, 0x5e, 0x60, 0x0, 0x49,
+    0x53, 0x10, 0x0, 0x39, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+53C2 "参" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x73, 0x0, 0x28, 0x50, 0x0, 0x0, 0x4e, 0x88,
+    0xa5, 0x54, 0xb6, 0x0, 0x0, 0x0, 0x8, 0x50,
+    0x0, 0x3, 0x50, 0x5, 0x55, 0x7c, 0x55, 0x85,
+    0x55, 0x60, 0x0, 0x1, 0xa1, 0x48, 0x47, 0x0,
+    0x0, 0x0, 0x28, 0x5, 0xb2, 0x13, 0xb8, 0x30,
+    0x5, 0x41, 0x75, 0x5, 0xd2, 0x6, 0x81, 0x0,
+    0x34, 0x1, 0x87, 0x1, 0x80, 0x0, 0x0, 0x3,
+    0x66, 0x10, 0x5c, 0x60, 0x0, 0x0, 0x22, 0x1,
+    0x6a, 0x60, 0x0, 0x0, 0x1, 0x46, 0x68, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+53C3 "參" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0x80, 0x51, 0x0, 0x0, 0x0, 0x1,
+    0xa6, 0x54, 0x5d, 0x20, 0x0, 0x0, 0x6, 0x52,
+    0x0, 0x8, 0x20, 0x0, 0x0, 0x66, 0x11, 0x0,
+    0x86, 0x6, 0x0, 0x4, 0xb6, 0x49, 0xc8, 0x61,
+    0x8, 0x40, 0x0, 0x0, 0xa, 0x66, 0x20, 0x1,
+    0x0, 0x0, 0x4, 0x92, 0x3, 0x6a, 0x62, 0x10,
+    0x4, 0x64, 0x3, 0xb8, 0x1, 0x8d, 0x91, 0x0,
+    0x5, 0x75, 0x4, 0xc1, 0x0, 0x0, 0x0, 0x30,
+    0x5, 0x97, 0x13, 0x10, 0x0, 0x0, 0x35, 0x52,
+    0x4, 0xab, 0x60, 0x0, 0x1, 0x34, 0x55, 0x64,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+53C8 "又" */
+    0x0, 0x45, 0x55, 0x55, 0x55, 0x91, 0x0, 0x0,
+    0x10, 0x40, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x0,
+    0x50, 0x0, 0x5, 0x70, 0x0, 0x0, 0x0, 0x50,
+    0x0, 0xb, 0x10, 0x0, 0x0, 0x0, 0x15, 0x0,
+    0x29, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0xa2,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x84, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8c, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbb, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x2a, 0x20, 0xa9, 0x10, 0x0, 0x0, 0x6,
+    0x70, 0x0, 0x6, 0xea, 0x51, 0x4, 0x51, 0x0,
+    0x0, 0x0, 0x18, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+53CA "及" */
+    0x0, 0x25, 0x56, 0x55, 0x59, 0x40, 0x0, 0x0,
+    0x0, 0xc, 0x0, 0xd, 0x10, 0x0, 0x0, 0x0,
+    0x1b, 0x0, 0x2a, 0x0, 0x0, 0x0, 0x0, 0x3b,
+    0x0, 0x84, 0x0, 0x0, 0x0, 0x0, 0x68, 0x20,
+    0xb5, 0x7c, 0x0, 0x0, 0x0, 0xa1, 0x60, 0x0,
+    0x94, 0x0, 0x0, 0x0, 0xb0, 0x61, 0x2, 0xb0,
+    0x0, 0x0, 0x6, 0x50, 0xa, 0xb, 0x20, 0x0,
+    0x0, 0xb, 0x0, 0x5, 0xd5, 0x0, 0x0, 0x0,
+    0x83, 0x0, 0x8, 0xb7, 0x0, 0x0, 0x4, 0x40,
+    0x4, 0x93, 0x8, 0xc5, 0x0, 0x23, 0x15, 0x63,
+    0x0, 0x0, 0x3b, 0xa0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+53CB "友" */
+    0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x0, 0x2, 0x30, 0x6, 0x55, 0x5e,
+    0x55, 0x55, 0x58, 0x80, 0x0, 0x0, 0x3a, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x67, 0x0, 0x0,
+    0x40, 0x0, 0x0, 0x0, 0xa7, 0x75, 0x57, 0xd0,
+    0x0, 0x0, 0x1, 0xc0, 0x60, 0x9, 0x50, 0x0,
+    0x0, 0x6, 0x60, 0x53, 0x1c, 0x0, 0x0, 0x0,
+    0xb, 0x0, 0x9, 0xb4, 0x0, 0x0, 0x0, 0x74,
+    0x0, 0x9, 0xe4, 0x0, 0x0, 0x2, 0x70, 0x1,
+    0x96, 0x1a, 0xa4, 0x0, 0x6, 0x2, 0x66, 0x0,
+    0x0, 0x5d, 0xb1, 0x10, 0x11, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+53CD "反" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x25, 0x8b, 0xe9, 0x0, 0x0, 0x1c,
+    0x55, 0x43, 0x10, 0x0, 0x0, 0x0, 0xb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0xc, 0x58, 0x55, 0x55,
+    0xaa, 0x0, 0x0, 0x1b, 0x5, 0x0, 0x0, 0xd1,
+    0x0, 0x0, 0x2a, 0x0, 0x70, 0x7, 0x80, 0x0,
+    0x0, 0x38, 0x0, 0x64, 0x2c, 0x0, 0x0, 0x0,
+    0x74, 0x0, 0x9, 0xc2, 0x0, 0x0, 0x0, 0xa0,
+    0x0, 0x1b, 0xc6, 0x0, 0x0, 0x4, 0x50, 0x7,
+    0x81, 0x9, 0xd6, 0x10, 0x6, 0x15, 0x61, 0x0,
+    0x0, 0x3c, 0xd2, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+53D6 "取" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0x75, 0x57, 0xb1, 0x0, 0x0, 0x0, 0x0, 0xb0,
+    0xb, 0x12, 0x22, 0x27, 0x0, 0x0, 0xb0, 0xb,
+    0x16, 0x33, 0x3e, 0x10, 0x0, 0xc5, 0x5c, 0x1,
+    0x30, 0x3a, 0x0, 0x0, 0xb0, 0xb, 0x0, 0x60,
+    0x76, 0x0, 0x0, 0xc5, 0x5c, 0x0, 0x70, 0xc1,
+    0x0, 0x0, 0xb0, 0xb, 0x0, 0x64, 0xa0, 0x0,
+    0x0, 0xb0, 0xb, 0x52, 0x1e, 0x30, 0x0, 0x4,
+    0xd9, 0x8d, 0x0, 0x2e, 0x40, 0x0, 0xa, 0x40,
+    0xb, 0x0, 0xa1, 0xc5, 0x0, 0x0, 0x0, 0xb,
+    0x8, 0x20, 0x1c, 0xb1, 0x0, 0x0, 0xa, 0x51,
+    0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+53D7 "受" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0,
+    0x0, 0x13, 0x57, 0xac, 0xd5, 0x0, 0x0, 0x45,
+    0x44, 0x31, 0x0, 0x80, 0x0, 0x0, 0x9, 0x10,
+    0xb1, 0x6, 0x80, 0x0, 0x0, 0x27, 0x70, 0x86,
+    0x9, 0x0, 0x10, 0x1, 0xa6, 0x55, 0x65, 0x56,
+    0x58, 0xd0, 0x9, 0x60, 0x0, 0x0, 0x1, 0x7,
+    0x10, 0x2, 0x5, 0x75, 0x55, 0x5f, 0x31, 0x0,
+    0x0, 0x0, 0x15, 0x0, 0x87, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0x45, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a,
+    0x56, 0xb7, 0x20, 0x0, 0x2, 0x57, 0x50, 0x0,
+    0x6, 0xcf, 0xb1, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+53E3 "口" */
+    0x18, 0x55, 0x55, 0x55, 0x5a, 0x1, 0xb0, 0x0,
+    0x0, 0x0, 0xc0, 0xb, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0xb0, 0x0, 0x0, 0x0, 0xc0, 0xb, 0x0,
+    0x0, 0x0, 0xc, 0x0, 0xb0, 0x0, 0x0, 0x0,
+    0xc0, 0xb, 0x0, 0x0, 0x0, 0xc, 0x0, 0xb0,
+    0x0, 0x0, 0x0, 0xc0, 0x1c, 0x55, 0x55, 0x55,
+    0x5c, 0x1, 0xa0, 0x0, 0x0, 0x0, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+53E4 "古" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa2, 0x0, 0x0, 0x0, 0x5, 0x55, 0x55,
+    0xc6, 0x55, 0x59, 0x90, 0x0, 0x0, 0x0, 0xa2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa2, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0x55, 0x85, 0x55, 0xd2, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x55,
+    0x55, 0x55, 0xd0, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x0, 0xb0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+53E5 "句" */
+    0x0, 0x0, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0x95, 0x55, 0x55, 0x55, 0x90, 0x0, 0x3a, 0x0,
+    0x0, 0x0, 0x2, 0xa0, 0x0, 0xa0, 0x0, 0x0,
+    0x0, 0x1, 0xa0, 0x7, 0x17, 0x55, 0x55, 0x90,
+    0x1, 0xa0, 0x10, 0xc, 0x0, 0x2, 0xa0, 0x2,
+    0xa0, 0x0, 0xc, 0x0, 0x2, 0xa0, 0x2, 0xa0,
+    0x0, 0xc, 0x0, 0x2, 0xa0, 0x2, 0x90, 0x0,
+    0xd, 0x55, 0x56, 0x90, 0x3, 0x90, 0x0, 0x4,
+    0x0, 0x0, 0x0, 0x4, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x20, 0x8, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x18, 0xec, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x40, 0x0,
+
+    /* U+53E6 "另" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0xb5, 0x55, 0x55, 0x5e, 0x0, 0x0, 0xb, 0x0,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0xb0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0xb, 0x55, 0x55, 0x55, 0xc0,
+    0x0, 0x0, 0x90, 0xa, 0x10, 0x7, 0x0, 0x0,
+    0x0, 0x1, 0xc0, 0x0, 0x3, 0x0, 0x26, 0x55,
+    0x7c, 0x55, 0x56, 0xc0, 0x0, 0x0, 0x5, 0x70,
+    0x0, 0x29, 0x0, 0x0, 0x0, 0xa2, 0x0, 0x3,
+    0x90, 0x0, 0x0, 0x29, 0x0, 0x0, 0x48, 0x0,
+    0x0, 0x49, 0x0, 0x3, 0x18, 0x60, 0x3, 0x64,
+    0x0, 0x0, 0x2b, 0xe1, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+53EA "只" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa5,
+    0x55, 0x55, 0x5d, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0xc5, 0x55, 0x55,
+    0x5c, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x9, 0x0,
+    0x0, 0x2, 0xd1, 0x5, 0x10, 0x0, 0x0, 0xc,
+    0x40, 0x0, 0xa4, 0x0, 0x0, 0x76, 0x0, 0x0,
+    0x1e, 0x50, 0x5, 0x60, 0x0, 0x0, 0x5, 0xe0,
+    0x44, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+53EB "叫" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc2, 0x27, 0x55, 0xa0, 0x29,
+    0x0, 0xb0, 0x2a, 0x0, 0xc0, 0x2a, 0x0, 0xb0,
+    0x2a, 0x0, 0xc0, 0x2a, 0x0, 0xb0, 0x2a, 0x0,
+    0xc0, 0x2a, 0x0, 0xb0, 0x2a, 0x0, 0xc0, 0x2a,
+    0x0, 0xb0, 0x2a, 0x0, 0xc0, 0x2a, 0x2, 0xc0,
+    0x2b, 0x55, 0xc0, 0x3d, 0x83, 0xb0, 0x2a, 0x0,
+    0xc0, 0x5, 0x0, 0xb0, 0x25, 0x0, 0x0, 0x0,
+    0x0, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x10,
+
+    /* U+53EF "可" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x90, 0x6,
+    0x55, 0x55, 0x55, 0x55, 0xd5, 0x52, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x18, 0x55,
+    0x5a, 0x0, 0xc0, 0x0, 0x0, 0x2a, 0x0, 0xc,
+    0x0, 0xc0, 0x0, 0x0, 0x1a, 0x0, 0xc, 0x0,
+    0xc0, 0x0, 0x0, 0x1a, 0x0, 0xc, 0x0, 0xc0,
+    0x0, 0x0, 0x1c, 0x55, 0x5c, 0x0, 0xc0, 0x0,
+    0x0, 0x2a, 0x0, 0xa, 0x0, 0xc0, 0x0, 0x0,
+    0x13, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x54, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1a, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+53F0 "台" */
+    0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3e, 0x30, 0x0, 0x0, 0x0, 0x1, 0xc2, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x20, 0x0, 0x60, 0x0,
+    0x0, 0x92, 0x0, 0x0, 0x1b, 0x50, 0x2d, 0x87,
+    0x77, 0x76, 0x57, 0xe5, 0xa, 0x74, 0x10, 0x0,
+    0x0, 0x45, 0x0, 0x30, 0x0, 0x0, 0x5, 0x0,
+    0x0, 0xc5, 0x55, 0x55, 0x5d, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0xc5, 0x55, 0x55, 0x5c, 0x0, 0x0, 0x20,
+    0x0, 0x0, 0x1, 0x0,
+
+    /* U+53F2 "史" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0x0, 0x0, 0xc, 0x55, 0x5d, 0x55,
+    0x5d, 0x20, 0x0, 0xd0, 0x0, 0xc0, 0x0, 0xc0,
+    0x0, 0xd, 0x0, 0xc, 0x0, 0xc, 0x0, 0x0,
+    0xe5, 0x55, 0xd5, 0x55, 0xd0, 0x0, 0x6, 0x10,
+    0xb, 0x0, 0x4, 0x0, 0x0, 0x3, 0x20, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0x77, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0x45, 0xca, 0x63, 0x20, 0x4, 0x87,
+    0x10, 0x0, 0x49, 0xcc, 0x23, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+53F3 "右" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0x80, 0x0, 0x3, 0x1, 0x65, 0x55, 0xb7, 0x55,
+    0x55, 0x96, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xc0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x9c,
+    0x65, 0x55, 0x5d, 0x20, 0x0, 0x54, 0xa2, 0x0,
+    0x0, 0xc0, 0x0, 0x35, 0xa, 0x20, 0x0, 0xc,
+    0x0, 0x23, 0x0, 0xa2, 0x0, 0x0, 0xc0, 0x0,
+    0x0, 0xa, 0x65, 0x55, 0x5d, 0x0, 0x0, 0x0,
+    0x81, 0x0, 0x0, 0x90, 0x0,
+
+    /* U+53F7 "号" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0xb5, 0x55, 0x55, 0xc3, 0x0, 0x0, 0xb, 0x0,
+    0x0, 0xb, 0x10, 0x0, 0x0, 0xb0, 0x0, 0x0,
+    0xb1, 0x0, 0x0, 0xb, 0x55, 0x55, 0x5c, 0x10,
+    0x0, 0x0, 0x40, 0x0, 0x0, 0x10, 0x50, 0x5,
+    0x55, 0x99, 0x55, 0x55, 0x56, 0x30, 0x0, 0xb,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x2, 0xd5, 0x55,
+    0x59, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x84,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x10, 0x0,
+    0x0, 0x0, 0x3, 0x2, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x20, 0x0, 0x0,
+
+    /* U+53F8 "司" */
+    0x2, 0x65, 0x55, 0x55, 0x55, 0xa1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x1,
+    0x20, 0xc0, 0x35, 0x55, 0x55, 0x57, 0x70, 0xc0,
+    0x0, 0x10, 0x0, 0x20, 0x0, 0xc0, 0x0, 0xd5,
+    0x55, 0xd4, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xb0,
+    0x0, 0xc0, 0x0, 0xc0, 0x0, 0xb0, 0x0, 0xc0,
+    0x0, 0xd5, 0x55, 0xd1, 0x0, 0xc0, 0x0, 0x80,
+    0x0, 0x50, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x21, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+
+    /* U+5403 "吃" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0x80, 0x0, 0x0, 0x42, 0x26, 0x0,
+    0xc0, 0x0, 0x0, 0xd, 0x33, 0xd0, 0x69, 0x55,
+    0x58, 0x80, 0xc0, 0xc, 0x9, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0xc5, 0x10, 0x0, 0x40, 0x0, 0xc0,
+    0xc, 0x15, 0x55, 0x9c, 0x10, 0xc, 0x0, 0xc0,
+    0x0, 0x2c, 0x10, 0x0, 0xc5, 0x5d, 0x0, 0xc,
+    0x20, 0x0, 0xd, 0x0, 0xb0, 0xa, 0x30, 0x0,
+    0x30, 0x50, 0x0, 0x7, 0x70, 0x0, 0x6, 0x0,
+    0x0, 0x0, 0xd0, 0x0, 0x1, 0xa0, 0x0, 0x0,
+    0x8, 0xba, 0xaa, 0xcc, 0x0,
+
+    /* U+5404 "各" */
+    0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0x10, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0xc7, 0x55, 0x6e, 0x20, 0x0, 0x0, 0x7, 0x56,
+    0x0, 0x96, 0x0, 0x0, 0x0, 0x44, 0x4, 0x53,
+    0xb0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x9c, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xa8, 0xa3, 0x0,
+    0x0, 0x0, 0x0, 0x86, 0x0, 0x3b, 0xd8, 0x51,
+    0x0, 0x58, 0xb5, 0x55, 0x5c, 0x48, 0x60, 0x4,
+    0x1, 0xa0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x1,
+    0xa0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x1, 0xa0,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0x2, 0xc5, 0x55,
+    0x5d, 0x0, 0x0, 0x0, 0x1, 0x30, 0x0, 0x3,
+    0x0, 0x0,
+
+    /* U+5408 "合" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0x67, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5a,
+    0x2, 0x90, 0x0, 0x0, 0x0, 0x4, 0xa0, 0x0,
+    0x4b, 0x20, 0x0, 0x0, 0x68, 0x0, 0x0, 0x17,
+    0xda, 0x50, 0x26, 0x24, 0x55, 0x55, 0x56, 0x7,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0x55, 0x55, 0x5c, 0x20, 0x0, 0x0,
+    0xa, 0x10, 0x0, 0xc, 0x0, 0x0, 0x0, 0xa,
+    0x10, 0x0, 0xc, 0x0, 0x0, 0x0, 0xa, 0x65,
+    0x55, 0x5d, 0x0, 0x0, 0x0, 0xa, 0x10, 0x0,
+    0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+540C "同" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x55,
+    0x55, 0x55, 0x55, 0xa3, 0xc, 0x0, 0x0, 0x0,
+    0x0, 0xa2, 0xc, 0x0, 0x0, 0x0, 0x61, 0xa2,
+    0xc, 0x6, 0x55, 0x55, 0x52, 0xa2, 0xc, 0x0,
+    0x10, 0x0, 0x30, 0xa2, 0xc, 0x1, 0xc5, 0x55,
+    0xc0, 0xa2, 0xc, 0x0, 0xa0, 0x0, 0xb0, 0xa2,
+    0xc, 0x0, 0xa0, 0x0, 0xb0, 0xa2, 0xc, 0x1,
+    0xc5, 0x55, 0xb0, 0xa2, 0xc, 0x0, 0x20, 0x0,
+    0x10, 0xa2, 0xc, 0x0, 0x0, 0x0, 0x20, 0xc1,
+    0xd, 0x0, 0x0, 0x0, 0x4c, 0xd0, 0x2, 0x0,
+    0x0, 0x0, 0x1, 0x0,
+
+    /* U+540D "名" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0x75, 0x55, 0x78, 0x0, 0x0, 0x7, 0x50, 0x0,
+    0xc, 0x40, 0x0, 0x4, 0xc2, 0x0, 0x9, 0x70,
+    0x0, 0x3, 0x60, 0xd3, 0x9, 0x80, 0x0, 0x0,
+    0x20, 0x3, 0x1a, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x3b, 0x50, 0x0, 0x10, 0x0, 0x0, 0x7e, 0x65,
+    0x55, 0x5d, 0x20, 0x15, 0x72, 0xc0, 0x0, 0x0,
+    0xc0, 0x2, 0x0, 0xc, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0xd5, 0x55, 0x55, 0xd0, 0x0, 0x0,
+    0x9, 0x0, 0x0, 0x7, 0x0,
+
+    /* U+5411 "向" */
+    0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0x0, 0x0, 0x0, 0x10, 0x5, 0x20, 0x0, 0x2,
+    0xd, 0x55, 0x65, 0x55, 0x55, 0xd2, 0xc0, 0x0,
+    0x0, 0x0, 0xc, 0xc, 0x1, 0x20, 0x4, 0x0,
+    0xc0, 0xc0, 0x1c, 0x55, 0xc3, 0xc, 0xc, 0x1,
+    0xa0, 0xb, 0x10, 0xc0, 0xc0, 0x1a, 0x0, 0xb1,
+    0xc, 0xc, 0x2, 0xc5, 0x5c, 0x10, 0xc0, 0xc0,
+    0x13, 0x0, 0x10, 0xc, 0xc, 0x0, 0x0, 0x0,
+    0x22, 0xd0, 0xc0, 0x0, 0x0, 0x3, 0xbb, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5426 "否" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x45,
+    0x55, 0x56, 0x55, 0x55, 0xd4, 0x0, 0x0, 0x3,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbd, 0x12,
+    0x0, 0x0, 0x0, 0x1, 0xb2, 0xc0, 0x27, 0x60,
+    0x0, 0x3, 0xa1, 0xc, 0x0, 0x4, 0xd4, 0x5,
+    0x50, 0x0, 0xd0, 0x0, 0x2, 0xa0, 0x0, 0x30,
+    0x4, 0x0, 0x5, 0x0, 0x0, 0xc, 0x65, 0x55,
+    0x55, 0xe0, 0x0, 0x0, 0xb1, 0x0, 0x0, 0xd,
+    0x0, 0x0, 0xb, 0x10, 0x0, 0x0, 0xd0, 0x0,
+    0x0, 0xb6, 0x55, 0x55, 0x5d, 0x0, 0x0, 0xc,
+    0x10, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+5427 "吧" */
+    0x0, 0x0, 0x2, 0x0, 0x0, 0x30, 0x7, 0x55,
+    0x90, 0xd5, 0xc5, 0x6d, 0x0, 0xc0, 0x1b, 0xc,
+    0xc, 0x1, 0xb0, 0xc, 0x1, 0xb0, 0xc0, 0xc0,
+    0x1b, 0x0, 0xc0, 0x1b, 0xc, 0xc, 0x1, 0xb0,
+    0xc, 0x1, 0xb0, 0xd5, 0xd5, 0x6b, 0x0, 0xc0,
+    0x1b, 0xc, 0x0, 0x1, 0x70, 0xc, 0x56, 0xb0,
+    0xc0, 0x0, 0x0, 0x0, 0xc0, 0x1b, 0xc, 0x0,
+    0x0, 0x1, 0xc, 0x0, 0x50, 0xc0, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0xc, 0x0, 0x0, 0xa, 0x0,
+    0x0, 0x0, 0xab, 0xaa, 0xab, 0xc0,
+
+    /* U+5440 "呀" */
+    0x0, 0x0, 0x2, 0x22, 0x22, 0x65, 0x9, 0x55,
+    0xb2, 0x42, 0x22, 0xc2, 0x20, 0xc0, 0xc, 0x6,
+    0x90, 0xc, 0x0, 0xc, 0x0, 0xc0, 0xb3, 0x0,
+    0xc0, 0x0, 0xc0, 0xc, 0x1c, 0x0, 0xc, 0x7,
+    0xc, 0x0, 0xc2, 0x75, 0x7d, 0xd5, 0x51, 0xc0,
+    0xc, 0x0, 0xa, 0x4c, 0x0, 0xc, 0x55, 0xd0,
+    0x4, 0x90, 0xc0, 0x0, 0xa0, 0x1, 0x2, 0xa0,
+    0xc, 0x0, 0x0, 0x0, 0x2, 0x90, 0x0, 0xc0,
+    0x0, 0x0, 0x3, 0x60, 0x12, 0x3b, 0x0, 0x0,
+    0x1, 0x20, 0x0, 0x5e, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+544A "告" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x64, 0xb, 0x30, 0x0, 0x0, 0x0, 0xb, 0x10,
+    0xb1, 0x2, 0x10, 0x0, 0x5, 0x85, 0x5c, 0x65,
+    0x76, 0x0, 0x1, 0x70, 0x0, 0xb1, 0x0, 0x0,
+    0x0, 0x20, 0x0, 0xb, 0x10, 0x1, 0x50, 0x6,
+    0x55, 0x55, 0x65, 0x55, 0x67, 0x10, 0x0, 0x20,
+    0x0, 0x0, 0x20, 0x0, 0x0, 0xc, 0x55, 0x55,
+    0x5c, 0x30, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xb1,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0xb, 0x10, 0x0,
+    0x0, 0xc5, 0x55, 0x55, 0xc1, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0xa, 0x10, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+5462 "呢" */
+    0x10, 0x1, 0x8, 0x55, 0x55, 0x91, 0xc5, 0x5d,
+    0xc, 0x0, 0x0, 0xc0, 0xc0, 0xc, 0xc, 0x0,
+    0x0, 0xc0, 0xc0, 0xc, 0xc, 0x55, 0x55, 0xd0,
+    0xc0, 0xc, 0xc, 0x12, 0x0, 0x20, 0xc0, 0xc,
+    0xc, 0x3a, 0x0, 0x70, 0xc0, 0xc, 0xb, 0x38,
+    0x9, 0x80, 0xc5, 0x5c, 0x38, 0x38, 0x74, 0x0,
+    0xc0, 0x6, 0x73, 0x3b, 0x10, 0x2, 0x40, 0x0,
+    0xa0, 0x38, 0x0, 0x14, 0x0, 0x4, 0x40, 0x2b,
+    0x11, 0x6a, 0x0, 0x6, 0x0, 0x7, 0x99, 0x93,
+    0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5468 "周" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0x65, 0x55, 0x55, 0x55, 0xd0, 0x0, 0x92, 0x0,
+    0x92, 0x0, 0xb, 0x0, 0x9, 0x20, 0xa, 0x14,
+    0x10, 0xb0, 0x0, 0x92, 0x36, 0xc5, 0x53, 0xb,
+    0x0, 0x9, 0x20, 0xa, 0x10, 0x60, 0xb0, 0x0,
+    0xa4, 0x65, 0x55, 0x55, 0x2b, 0x0, 0xa, 0x0,
+    0x85, 0x5a, 0x30, 0xb0, 0x0, 0xb0, 0xb, 0x0,
+    0xb0, 0xb, 0x0, 0xa, 0x0, 0xb0, 0xb, 0x0,
+    0xb0, 0x4, 0x50, 0xc, 0x55, 0xc0, 0xb, 0x0,
+    0x80, 0x0, 0x40, 0x3, 0x22, 0xb0, 0x32, 0x0,
+    0x0, 0x0, 0x5, 0xe5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+5473 "味" */
+    0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd0, 0x0, 0x0, 0x74, 0x49, 0x0,
+    0xc, 0x0, 0x20, 0xc, 0x0, 0xc1, 0x65, 0xd5,
+    0x67, 0x0, 0xc0, 0xc, 0x0, 0xc, 0x0, 0x0,
+    0xc, 0x0, 0xc0, 0x0, 0xc0, 0x2, 0x50, 0xc0,
+    0xc, 0x65, 0xae, 0x85, 0x55, 0xc, 0x0, 0xc0,
+    0xc, 0xc5, 0x10, 0x0, 0xd5, 0x5c, 0x6, 0x5c,
+    0x8, 0x0, 0xa, 0x0, 0x32, 0x90, 0xc0, 0x76,
+    0x0, 0x0, 0x1, 0x90, 0xc, 0x0, 0xc9, 0x10,
+    0x1, 0x70, 0x0, 0xc0, 0x1, 0x50, 0x0, 0x20,
+    0x0, 0xd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x20, 0x0, 0x0,
+
+    /* U+547C "呼" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0x8e, 0x20, 0x85, 0x5c, 0x14,
+    0x58, 0xc2, 0x0, 0xb, 0x0, 0xc1, 0x10, 0x1a,
+    0x1, 0x90, 0xb0, 0xc, 0xa, 0x11, 0xa0, 0x94,
+    0xb, 0x0, 0xc0, 0x67, 0x1a, 0x25, 0x0, 0xb0,
+    0xc, 0x1, 0x11, 0xa2, 0x5, 0xb, 0x0, 0xc5,
+    0x55, 0x6c, 0x55, 0x71, 0xb5, 0x5c, 0x0, 0x1,
+    0xa0, 0x0, 0xb, 0x0, 0xc0, 0x0, 0x1a, 0x0,
+    0x0, 0x50, 0x0, 0x0, 0x1, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x3a, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6e, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x10, 0x0, 0x0,
+
+    /* U+547D "命" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa4,
+    0x2, 0x80, 0x0, 0x0, 0x0, 0xa, 0x40, 0x0,
+    0x7c, 0x71, 0x0, 0x3, 0x82, 0x65, 0x55, 0x61,
+    0x8f, 0x80, 0x33, 0x20, 0x3, 0x4, 0x11, 0x52,
+    0x0, 0x0, 0xb5, 0x5d, 0xb, 0x33, 0xc1, 0x0,
+    0x0, 0xb0, 0xb, 0xb, 0x0, 0xb0, 0x0, 0x0,
+    0xb0, 0xb, 0xb, 0x0, 0xb0, 0x0, 0x0, 0xb5,
+    0x5c, 0xb, 0x0, 0xb0, 0x0, 0x0, 0xb0, 0x9,
+    0xb, 0x29, 0xc0, 0x0, 0x0, 0x30, 0x0, 0xb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0,
+
+    /* U+548C "和" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4a, 0xd0, 0x0, 0x0, 0x0, 0x2, 0x55,
+    0xd1, 0x0, 0x85, 0x55, 0x90, 0x0, 0x0, 0xc0,
+    0x0, 0xc0, 0x2, 0xa0, 0x3, 0x55, 0xd5, 0x94,
+    0xc0, 0x2, 0xa0, 0x0, 0x4, 0xe0, 0x0, 0xc0,
+    0x2, 0xa0, 0x0, 0xb, 0xe7, 0x20, 0xc0, 0x2,
+    0xa0, 0x0, 0x37, 0xc1, 0xd3, 0xc0, 0x2, 0xa0,
+    0x0, 0x90, 0xc0, 0x11, 0xc0, 0x2, 0xa0, 0x6,
+    0x10, 0xc0, 0x0, 0xd5, 0x56, 0xa0, 0x11, 0x0,
+    0xc0, 0x0, 0xc0, 0x2, 0xa0, 0x0, 0x0, 0xd0,
+    0x0, 0x50, 0x0, 0x0, 0x0, 0x0, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+54B2 "咲" */
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x10, 0x0, 0x0,
+    0x0, 0x94, 0x0, 0x7a, 0x0, 0xb5, 0x5c, 0x1,
+    0xf0, 0xa, 0x0, 0xc, 0x0, 0xc0, 0x4, 0x3,
+    0x21, 0x30, 0xc0, 0xc, 0x26, 0x59, 0x85, 0x66,
+    0xc, 0x0, 0xc0, 0x0, 0x93, 0x0, 0x0, 0xc0,
+    0xc, 0x0, 0xa, 0x20, 0x4, 0xc, 0x0, 0xc6,
+    0x55, 0xd8, 0x55, 0x73, 0xd5, 0x5c, 0x0, 0xc,
+    0x41, 0x0, 0xc, 0x0, 0x80, 0x3, 0x91, 0x70,
+    0x0, 0x10, 0x0, 0x0, 0xa2, 0xa, 0x10, 0x0,
+    0x0, 0x0, 0x56, 0x0, 0x3c, 0x0, 0x0, 0x0,
+    0x64, 0x0, 0x0, 0x8e, 0x40, 0x0, 0x30, 0x0,
+    0x0, 0x0, 0x30,
+
+    /* U+54C1 "品" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0x55, 0x55, 0xa4, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x82, 0x0, 0x0, 0xc, 0x0, 0x0, 0x82, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x82, 0x0, 0x0, 0xd,
+    0x55, 0x55, 0xb2, 0x0, 0x0, 0x4, 0x0, 0x0,
+    0x10, 0x0, 0x1a, 0x55, 0xa5, 0xb, 0x55, 0xb4,
+    0xb, 0x0, 0x93, 0xc, 0x0, 0xa2, 0xb, 0x0,
+    0x93, 0xc, 0x0, 0xa2, 0xb, 0x0, 0x93, 0xc,
+    0x0, 0xa2, 0xd, 0x55, 0xb3, 0xd, 0x55, 0xb2,
+    0x1a, 0x0, 0x51, 0x9, 0x0, 0x61, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+54E1 "員" */
+    0x0, 0x2, 0x0, 0x0, 0x3, 0x0, 0x0, 0x1c,
+    0x55, 0x55, 0x5d, 0x0, 0x0, 0x1b, 0x0, 0x0,
+    0xb, 0x0, 0x0, 0x1c, 0x55, 0x55, 0x5a, 0x0,
+    0x1, 0x86, 0x55, 0x55, 0x56, 0x80, 0x1, 0xb0,
+    0x0, 0x0, 0x2, 0x90, 0x1, 0xc5, 0x55, 0x55,
+    0x56, 0x90, 0x0, 0xb0, 0x0, 0x0, 0x2, 0x90,
+    0x1, 0xc5, 0x55, 0x55, 0x56, 0x90, 0x1, 0xc5,
+    0x55, 0x55, 0x56, 0xa0, 0x0, 0x50, 0x54, 0x5,
+    0x10, 0x20, 0x0, 0x7, 0xa3, 0x1, 0x9b, 0x30,
+    0x3, 0x72, 0x0, 0x0, 0x3, 0xe0, 0x11, 0x0,
+    0x0, 0x0, 0x0, 0x10,
+
+    /* U+54EA "哪" */
+    0x0, 0x3, 0x33, 0x37, 0x24, 0x37, 0x8, 0x5a,
+    0x22, 0xb1, 0xb4, 0x72, 0xc1, 0xa0, 0xa0, 0xa,
+    0xb, 0x46, 0x53, 0xa, 0xa, 0x25, 0xc5, 0xb4,
+    0x66, 0x0, 0xa0, 0xa0, 0xa, 0xb, 0x46, 0x50,
+    0xa, 0xa, 0x0, 0x90, 0xb4, 0x64, 0x30, 0xa0,
+    0xa2, 0x5b, 0x4b, 0x46, 0xa, 0xc, 0x5b, 0x5,
+    0x61, 0xa4, 0x60, 0x91, 0xb0, 0x20, 0x91, 0x1a,
+    0x47, 0x2b, 0x12, 0x0, 0x28, 0x3, 0x84, 0x6a,
+    0x90, 0x0, 0x8, 0x17, 0xb4, 0x46, 0x0, 0x0,
+    0x6, 0x0, 0x25, 0x4, 0x50, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5546 "商" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x67, 0x0, 0x2, 0x20, 0x6, 0x55,
+    0x75, 0x56, 0x67, 0x57, 0x60, 0x0, 0x0, 0x67,
+    0x0, 0x67, 0x0, 0x0, 0x0, 0x75, 0x5c, 0x55,
+    0x95, 0x59, 0x10, 0x0, 0xb0, 0x5, 0x0, 0x20,
+    0xb, 0x0, 0x0, 0xb0, 0x3c, 0x10, 0x5c, 0x1b,
+    0x0, 0x0, 0xb1, 0x71, 0x0, 0x25, 0x2b, 0x0,
+    0x0, 0xb2, 0xc, 0x55, 0xc2, 0xb, 0x0, 0x0,
+    0xb0, 0xb, 0x0, 0xb0, 0xb, 0x0, 0x0, 0xb0,
+    0xc, 0x55, 0xc0, 0xb, 0x0, 0x0, 0xb0, 0xa,
+    0x0, 0x60, 0xb, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0x3, 0xbb, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x10, 0x0,
+
+    /* U+554A "啊" */
+    0x0, 0x4, 0x67, 0x74, 0x55, 0x5a, 0x2c, 0x5c,
+    0x65, 0x73, 0x0, 0x5, 0x60, 0xa0, 0xa5, 0x58,
+    0x0, 0x0, 0x56, 0xa, 0xa, 0x55, 0x50, 0xa5,
+    0xb5, 0x60, 0xa0, 0xa5, 0x64, 0xa, 0xa, 0x56,
+    0xa, 0xa, 0x55, 0x70, 0xa0, 0xa5, 0x60, 0xa0,
+    0xa5, 0x55, 0x6a, 0xa, 0x56, 0xc, 0x5b, 0x55,
+    0x47, 0xc5, 0xa5, 0x60, 0xa0, 0x35, 0x8d, 0x23,
+    0x1, 0x56, 0x0, 0x0, 0x55, 0x0, 0x0, 0x5,
+    0x60, 0x0, 0x5, 0x50, 0x0, 0x10, 0x56, 0x0,
+    0x0, 0x64, 0x0, 0x1, 0x8f, 0x30, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+554F "問" */
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0xc5,
+    0x55, 0xc0, 0xc5, 0x55, 0xd0, 0x1b, 0x0, 0xa,
+    0xb, 0x0, 0xc, 0x1, 0xc5, 0x55, 0xa0, 0xc5,
+    0x55, 0xc0, 0x1b, 0x0, 0xa, 0xb, 0x0, 0xc,
+    0x1, 0xc5, 0x55, 0x80, 0xb5, 0x55, 0xc0, 0x1b,
+    0x0, 0x0, 0x0, 0x10, 0xc, 0x1, 0xb0, 0xc,
+    0x55, 0x5d, 0x0, 0xc0, 0x1b, 0x0, 0xb0, 0x0,
+    0xb0, 0xc, 0x1, 0xb0, 0xb, 0x0, 0xb, 0x0,
+    0xc0, 0x1b, 0x0, 0xd5, 0x55, 0xb0, 0xc, 0x1,
+    0xb0, 0x3, 0x0, 0x2, 0x0, 0xc0, 0x1a, 0x0,
+    0x0, 0x0, 0x6, 0xd8, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x1, 0x0,
+
+    /* U+5566 "啦" */
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd0, 0x4, 0x30, 0x0, 0x0, 0x0, 0xb,
+    0x0, 0xd, 0x0, 0xb, 0x5c, 0x10, 0xb4, 0x0,
+    0x71, 0x50, 0xb0, 0xb4, 0x6c, 0x54, 0x65, 0x55,
+    0xb, 0xb, 0x0, 0xb0, 0x0, 0x5, 0x30, 0xb0,
+    0xb0, 0xb, 0x45, 0x20, 0xa5, 0xb, 0xb, 0x5,
+    0xd2, 0x9, 0xb, 0x0, 0xb0, 0xba, 0x6b, 0x0,
+    0xc0, 0xa0, 0xc, 0x5c, 0x0, 0xb0, 0xa, 0x27,
+    0x0, 0xa0, 0x20, 0xb, 0x0, 0x24, 0x30, 0x0,
+    0x0, 0x11, 0xb0, 0x0, 0x50, 0x60, 0x0, 0x4,
+    0xd7, 0x36, 0x55, 0x56, 0x20, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+5584 "善" */
+    0x0, 0x0, 0x20, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x6, 0x70, 0x1b, 0x0, 0x0, 0x3, 0x55, 0x6b,
+    0x59, 0x55, 0xc5, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0x21, 0x0, 0x0, 0x36, 0x55, 0xd5, 0x56, 0x50,
+    0x0, 0x65, 0x55, 0x5d, 0x55, 0x56, 0xb0, 0x0,
+    0x4, 0x60, 0xc0, 0x1b, 0x0, 0x0, 0x0, 0xb,
+    0xc, 0x5, 0x20, 0x60, 0x16, 0x55, 0x55, 0x65,
+    0x55, 0x57, 0x40, 0x0, 0x75, 0x55, 0x55, 0xa1,
+    0x0, 0x0, 0xb, 0x0, 0x0, 0xb, 0x0, 0x0,
+    0x0, 0xb0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0xc,
+    0x55, 0x55, 0x5d, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x20, 0x0,
+
+    /* U+5589 "喉" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc2, 0x55, 0x82, 0x0, 0x54, 0x72, 0x1a,
+    0x0, 0xa, 0x0, 0xa, 0x1a, 0x6, 0x30, 0x0,
+    0xa0, 0x40, 0xa0, 0xa0, 0xc2, 0x7b, 0x55, 0x55,
+    0xa, 0xa, 0x3e, 0x4, 0xa0, 0x2, 0x0, 0xa0,
+    0xa4, 0xa0, 0x95, 0xb5, 0x62, 0xa, 0xa, 0xa,
+    0x32, 0xb, 0x0, 0x0, 0xa5, 0xc0, 0xa4, 0x55,
+    0xc6, 0x59, 0xb, 0x9, 0xa, 0x0, 0xa, 0x60,
+    0x0, 0x60, 0x0, 0xa0, 0x6, 0x56, 0x30, 0x0,
+    0x0, 0xa, 0x1, 0x90, 0xb, 0x10, 0x0, 0x0,
+    0xb2, 0x60, 0x0, 0x3b, 0x0, 0x0, 0x1, 0x10,
+    0x0, 0x0, 0x0,
+
+    /* U+559C "喜" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0x10, 0x4, 0x10, 0x2, 0x65, 0x55,
+    0xc5, 0x55, 0x75, 0x0, 0x0, 0x22, 0x2c, 0x22,
+    0x91, 0x0, 0x0, 0x6, 0x32, 0x22, 0x26, 0x10,
+    0x0, 0x0, 0xb5, 0x55, 0x55, 0xc1, 0x0, 0x0,
+    0xb, 0x55, 0x55, 0x5c, 0x0, 0x0, 0x0, 0x63,
+    0x30, 0x8, 0x40, 0x0, 0x1, 0x11, 0x1b, 0x13,
+    0x51, 0x18, 0x21, 0x64, 0x54, 0x44, 0x44, 0x54,
+    0x42, 0x0, 0xa, 0x55, 0x55, 0x5b, 0x40, 0x0,
+    0x0, 0xa0, 0x0, 0x0, 0x82, 0x0, 0x0, 0xb,
+    0x55, 0x55, 0x5b, 0x30, 0x0, 0x0, 0x30, 0x0,
+    0x0, 0x20, 0x0,
+
+    /* U+559D "喝" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x10, 0xc5, 0x55, 0x5e, 0x0, 0xb5, 0x6c, 0xc,
+    0x0, 0x0, 0xc0, 0xc, 0x1, 0xa0, 0xd5, 0x55,
+    0x5c, 0x0, 0xc0, 0x1a, 0xd, 0x55, 0x55, 0xc0,
+    0xc, 0x1, 0xa0, 0x8a, 0x0, 0x4, 0x0, 0xc0,
+    0x1a, 0xa, 0x73, 0x33, 0x37, 0xc, 0x56, 0xb6,
+    0x52, 0x86, 0x22, 0xb0, 0xc0, 0x8, 0xa5, 0x1c,
+    0x60, 0x18, 0x9, 0x0, 0x26, 0x38, 0x13, 0xa3,
+    0x70, 0x0, 0x0, 0x65, 0x0, 0x16, 0x46, 0x0,
+    0x0, 0x6, 0x65, 0x55, 0x47, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x3b, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x11, 0x0,
+
+    /* U+55AE "單" */
+    0x0, 0x10, 0x3, 0x2, 0x0, 0x11, 0x0, 0x0,
+    0xb5, 0x5c, 0x1b, 0x55, 0x87, 0x0, 0x0, 0xb0,
+    0xb, 0xa, 0x0, 0x55, 0x0, 0x0, 0xb5, 0x5a,
+    0xb, 0x55, 0x85, 0x0, 0x0, 0x27, 0x55, 0x65,
+    0x55, 0xa0, 0x0, 0x0, 0x38, 0x0, 0x90, 0x0,
+    0xb0, 0x0, 0x0, 0x2b, 0x55, 0xb5, 0x55, 0xb0,
+    0x0, 0x0, 0x28, 0x0, 0x90, 0x0, 0xb0, 0x0,
+    0x0, 0x3b, 0x55, 0xb5, 0x55, 0xb0, 0x0, 0x0,
+    0x11, 0x0, 0x90, 0x0, 0x13, 0x20, 0x16, 0x55,
+    0x55, 0xb5, 0x55, 0x56, 0x60, 0x0, 0x0, 0x0,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0,
+    0x0, 0x0,
+
+    /* U+55B6 "営" */
+    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x91, 0x9, 0x10, 0x87, 0x0, 0x0, 0x5, 0x90,
+    0x57, 0x18, 0x0, 0x0, 0x20, 0x2, 0x0, 0x4,
+    0x0, 0x11, 0x8, 0x55, 0x55, 0x55, 0x55, 0x5b,
+    0x91, 0xd0, 0x47, 0x55, 0x55, 0xb0, 0x70, 0x11,
+    0x5, 0x60, 0x0, 0xb, 0x0, 0x0, 0x0, 0x59,
+    0x55, 0x55, 0xb0, 0x0, 0x0, 0x3, 0x20, 0x0,
+    0x3, 0x0, 0x0, 0x5, 0x55, 0x55, 0x55, 0x59,
+    0x10, 0x0, 0xa1, 0x0, 0x0, 0x0, 0xb0, 0x0,
+    0xa, 0x10, 0x0, 0x0, 0xb, 0x0, 0x0, 0xa5,
+    0x55, 0x55, 0x55, 0xc0, 0x0, 0x5, 0x0, 0x0,
+    0x0, 0x4, 0x0,
+
+    /* U+55CE "嗎" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x55,
+    0x95, 0x85, 0x59, 0x57, 0x60, 0xb0, 0xa, 0x56,
+    0x0, 0xb0, 0x10, 0xb, 0x0, 0xa5, 0x95, 0x5c,
+    0x58, 0x20, 0xb0, 0xa, 0x56, 0x0, 0xb0, 0x10,
+    0xb, 0x0, 0xa5, 0x95, 0x5c, 0x57, 0x30, 0xb0,
+    0xa, 0x56, 0x0, 0xb0, 0x2, 0xc, 0x55, 0xb5,
+    0x95, 0x47, 0x45, 0xc2, 0xb0, 0x6, 0x0, 0x0,
+    0x4, 0xb, 0x5, 0x0, 0x4, 0x24, 0x26, 0x3a,
+    0xb0, 0x0, 0x0, 0x90, 0xc0, 0xc0, 0xab, 0x0,
+    0x0, 0x67, 0x7, 0x2, 0x2, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x39, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0x0,
+
+    /* U+55EF "嗯" */
+    0x20, 0x3, 0x18, 0x55, 0x55, 0xa3, 0xb, 0x56,
+    0xb1, 0xa0, 0x73, 0xa, 0x10, 0xb0, 0x1a, 0x1a,
+    0x5b, 0x79, 0xa1, 0xb, 0x1, 0xa1, 0xa0, 0xb0,
+    0xa, 0x10, 0xb0, 0x1a, 0x1a, 0x18, 0x94, 0xa1,
+    0xb, 0x1, 0xa1, 0xa7, 0x0, 0x7a, 0x10, 0xb5,
+    0x6a, 0x1c, 0x55, 0x55, 0xb1, 0xb, 0x1, 0x70,
+    0x30, 0x71, 0x2, 0x0, 0x80, 0x0, 0x22, 0x63,
+    0xa0, 0x63, 0x0, 0x0, 0x36, 0x28, 0x2, 0x3,
+    0xd2, 0x0, 0xd, 0x22, 0x70, 0x1, 0x64, 0x0,
+    0x0, 0x0, 0xc, 0x99, 0xb9, 0x0,
+
+    /* U+561B "嘛" */
+    0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb2, 0x0, 0x0, 0x85, 0x94, 0x75,
+    0x58, 0x55, 0x98, 0xb, 0xb, 0x47, 0xb, 0x0,
+    0xa1, 0x0, 0xb0, 0xb4, 0x70, 0xa0, 0xa, 0x0,
+    0xb, 0xb, 0x4a, 0x5c, 0x94, 0xc6, 0x80, 0xb0,
+    0xb5, 0x63, 0xc0, 0xe, 0x40, 0xb, 0xb, 0x64,
+    0x8c, 0xb4, 0xe6, 0x0, 0xc5, 0xc9, 0x1a, 0xa2,
+    0x8a, 0x70, 0x9, 0x0, 0xa6, 0x2a, 0x25, 0xa2,
+    0x90, 0x0, 0x36, 0x50, 0xa5, 0xa, 0xa, 0x30,
+    0x7, 0x20, 0xa, 0x0, 0xb0, 0x0, 0x3, 0x10,
+    0x0, 0xa0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+56B4 "嚴" */
+    0x0, 0x1, 0x0, 0x30, 0x10, 0x2, 0x0, 0x0,
+    0x1b, 0x55, 0xc0, 0xb5, 0x5c, 0x0, 0x0, 0x1b,
+    0x55, 0xb0, 0xb5, 0x5b, 0x0, 0x0, 0x33, 0x0,
+    0x30, 0x40, 0x7, 0x30, 0x0, 0xd5, 0x55, 0x65,
+    0x57, 0x56, 0x50, 0x0, 0xb0, 0x65, 0xc1, 0x2b,
+    0x0, 0x0, 0x0, 0xb0, 0x0, 0x93, 0x66, 0x25,
+    0x40, 0x0, 0xb5, 0xc5, 0x79, 0xb2, 0x49, 0x10,
+    0x1, 0xa0, 0xb5, 0x77, 0x73, 0x55, 0x0, 0x2,
+    0x80, 0xa0, 0x39, 0x7, 0x91, 0x0, 0x5, 0x40,
+    0xb5, 0x77, 0x5, 0xb0, 0x0, 0x7, 0x2, 0xc7,
+    0x89, 0x38, 0xa5, 0x0, 0x5, 0x9, 0x40, 0x37,
+    0x52, 0xb, 0x90, 0x10, 0x0, 0x0, 0x12, 0x0,
+    0x0, 0x0,
+
+    /* U+56DB "四" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x55, 0x75,
+    0x57, 0x55, 0xc2, 0xc0, 0xc, 0x0, 0xc0, 0xc,
+    0xc, 0x0, 0xc0, 0xc, 0x0, 0xc0, 0xc0, 0xc,
+    0x0, 0xc0, 0xc, 0xc, 0x0, 0xb0, 0xc, 0x0,
+    0xc0, 0xc0, 0xb, 0x0, 0xc0, 0xc, 0xc, 0x4,
+    0x70, 0xc, 0x0, 0xc0, 0xc0, 0xa1, 0x0, 0xab,
+    0xcd, 0xc, 0x73, 0x0, 0x0, 0x0, 0xc0, 0xd1,
+    0x0, 0x0, 0x0, 0xc, 0xd, 0x55, 0x55, 0x55,
+    0x55, 0xd0, 0xc0, 0x0, 0x0, 0x0, 0xb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x10,
+
+    /* U+56DE "回" */
+    0x85, 0x55, 0x55, 0x55, 0x59, 0x2c, 0x0, 0x0,
+    0x0, 0x0, 0xb0, 0xc0, 0x0, 0x0, 0x0, 0xb,
+    0xc, 0x1, 0x75, 0x55, 0x80, 0xb0, 0xc0, 0x1a,
+    0x0, 0x1a, 0xb, 0xc, 0x0, 0xa0, 0x1, 0xa0,
+    0xb0, 0xc0, 0x1a, 0x0, 0x1a, 0xb, 0xc, 0x1,
+    0xc5, 0x56, 0xa0, 0xb0, 0xc0, 0x4, 0x0, 0x2,
+    0xb, 0xc, 0x0, 0x0, 0x0, 0x0, 0xb0, 0xd5,
+    0x55, 0x55, 0x55, 0x5c, 0xc, 0x0, 0x0, 0x0,
+    0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+56E0 "因" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x95,
+    0x55, 0x55, 0x55, 0x56, 0xa0, 0x1b, 0x0, 0x1,
+    0x60, 0x0, 0x2a, 0x1, 0xb0, 0x0, 0x1b, 0x0,
+    0x2, 0xa0, 0x1b, 0x0, 0x1, 0xa0, 0x4, 0x2a,
+    0x1, 0xb3, 0x65, 0x6c, 0x56, 0x72, 0xa0, 0x1b,
+    0x0, 0x4, 0x90, 0x0, 0x2a, 0x1, 0xb0, 0x0,
+    0x88, 0x70, 0x2, 0xa0, 0x1b, 0x0, 0xc, 0x4,
+    0xc0, 0x2a, 0x1, 0xb0, 0x9, 0x30, 0x9, 0x72,
+    0xa0, 0x1b, 0x16, 0x20, 0x0, 0x14, 0x2a, 0x1,
+    0xb0, 0x0, 0x0, 0x0, 0x2, 0xa0, 0x1c, 0x55,
+    0x55, 0x55, 0x55, 0x6a, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+56F0 "困" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x55,
+    0x55, 0x65, 0x55, 0xc4, 0xc, 0x0, 0x0, 0xd0,
+    0x0, 0xa2, 0xc, 0x0, 0x0, 0xc0, 0x0, 0xa2,
+    0xc, 0x36, 0x56, 0xd5, 0x79, 0xa2, 0xc, 0x0,
+    0xc, 0xc0, 0x0, 0xa2, 0xc, 0x0, 0x47, 0xd5,
+    0x0, 0xa2, 0xc, 0x0, 0xa0, 0xc2, 0xc4, 0xa2,
+    0xc, 0x8, 0x20, 0xc0, 0x2c, 0xa2, 0xc, 0x52,
+    0x0, 0xc0, 0x2, 0xa2, 0xc, 0x0, 0x0, 0xd0,
+    0x0, 0xa2, 0xc, 0x0, 0x0, 0x40, 0x0, 0xa2,
+    0xd, 0x55, 0x55, 0x55, 0x55, 0xb2, 0x2, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+56F3 "図" */
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x30, 0xb6, 0x55,
+    0x55, 0x55, 0x55, 0xd2, 0xb1, 0x0, 0x1, 0x30,
+    0x0, 0xb0, 0xb1, 0x0, 0x71, 0xb2, 0x71, 0xb0,
+    0xb1, 0x4, 0x2b, 0x56, 0xd1, 0xb0, 0xb1, 0x5,
+    0x14, 0x9, 0x40, 0xb0, 0xb1, 0x0, 0x80, 0x3a,
+    0x0, 0xb0, 0xb1, 0x0, 0x29, 0xb1, 0x0, 0xb0,
+    0xb1, 0x0, 0xb, 0xb0, 0x0, 0xb0, 0xb1, 0x1,
+    0x81, 0x3c, 0x72, 0xb0, 0xb1, 0x45, 0x0, 0x1,
+    0x89, 0xc0, 0xb3, 0x0, 0x0, 0x0, 0x0, 0xb0,
+    0xb6, 0x55, 0x55, 0x55, 0x55, 0xd1, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x20,
+
+    /* U+56FD "国" */
+    0x10, 0x0, 0x0, 0x0, 0x1, 0xd, 0x55, 0x55,
+    0x55, 0x55, 0xd2, 0xc0, 0x0, 0x0, 0x3, 0x3c,
+    0xc, 0x16, 0x56, 0xb5, 0x53, 0xc0, 0xc0, 0x0,
+    0x2a, 0x0, 0xc, 0xc, 0x4, 0x56, 0xb5, 0xa1,
+    0xc0, 0xc0, 0x10, 0x2a, 0x20, 0xc, 0xc, 0x0,
+    0x2, 0xa9, 0x70, 0xc0, 0xc0, 0x0, 0x2a, 0x9,
+    0xc, 0xc, 0x35, 0x56, 0xb5, 0x98, 0xc0, 0xc1,
+    0x0, 0x0, 0x0, 0xc, 0xd, 0x55, 0x55, 0x55,
+    0x55, 0xd0, 0xc0, 0x0, 0x0, 0x0, 0x9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+570B "國" */
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x30, 0xa6, 0x55,
+    0x55, 0x87, 0x55, 0xc2, 0xa1, 0x0, 0x0, 0xc1,
+    0xc0, 0xb0, 0xa2, 0x65, 0x55, 0xc5, 0x8a, 0xb0,
+    0xa1, 0x0, 0x0, 0xa0, 0x0, 0xb0, 0xa1, 0x95,
+    0xb2, 0xa0, 0x65, 0xb0, 0xa1, 0xa0, 0xa0, 0x90,
+    0xa1, 0xb0, 0xa1, 0xa5, 0xc0, 0x67, 0x80, 0xb0,
+    0xa1, 0x70, 0x40, 0xf, 0x11, 0xc0, 0xa1, 0x36,
+    0x63, 0x7a, 0x86, 0xb0, 0xa2, 0x91, 0x6, 0x40,
+    0x6f, 0xb0, 0xa1, 0x0, 0x40, 0x0, 0x3, 0xc0,
+    0xa6, 0x55, 0x55, 0x55, 0x55, 0xc0, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x20,
+
+    /* U+570D "圍" */
+    0x11, 0x0, 0x0, 0x0, 0x0, 0x3, 0x2, 0xb5,
+    0x55, 0x75, 0x55, 0x55, 0xd0, 0x2a, 0x0, 0xa,
+    0x10, 0x20, 0xc, 0x2, 0xa0, 0x46, 0xb5, 0x5d,
+    0x0, 0xc0, 0x2a, 0x45, 0x5b, 0x55, 0xca, 0x3c,
+    0x2, 0xa1, 0x16, 0x55, 0x58, 0x0, 0xc0, 0x2a,
+    0x1, 0x90, 0x0, 0xb0, 0xc, 0x2, 0xa0, 0x18,
+    0x5c, 0x57, 0x0, 0xc0, 0x2a, 0x6, 0x85, 0xc5,
+    0x84, 0xc, 0x2, 0xa0, 0xa8, 0x5c, 0x57, 0x70,
+    0xc0, 0x2a, 0x1, 0x0, 0xb0, 0x0, 0xc, 0x2,
+    0xa0, 0x0, 0x8, 0x0, 0x0, 0xc0, 0x2b, 0x55,
+    0x55, 0x55, 0x55, 0x5c, 0x0, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x20,
+
+    /* U+5712 "園" */
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x30, 0xa6, 0x55,
+    0x5a, 0x55, 0x55, 0xd1, 0xa2, 0x0, 0xc, 0x3,
+    0x0, 0xc0, 0xa2, 0x6, 0x5c, 0x56, 0x20, 0xc0,
+    0xa2, 0x65, 0x5a, 0x55, 0xa3, 0xc0, 0xa2, 0x7,
+    0x55, 0x58, 0x20, 0xc0, 0xa2, 0xb, 0x0, 0xa,
+    0x10, 0xc0, 0xa2, 0xd, 0x66, 0x5b, 0x10, 0xc0,
+    0xa2, 0x3, 0xd1, 0x1, 0xc1, 0xc0, 0xa2, 0x18,
+    0xa1, 0x69, 0x10, 0xc0, 0xa4, 0x50, 0x80, 0x9,
+    0xa0, 0xc0, 0xa2, 0x0, 0x60, 0x0, 0x70, 0xc0,
+    0xa6, 0x55, 0x55, 0x55, 0x55, 0xd0, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x10,
+
+    /* U+5718 "團" */
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x30, 0xb6, 0x55,
+    0x5a, 0x65, 0x55, 0xd1, 0xb3, 0x65, 0x5d, 0x55,
+    0x76, 0xc0, 0xb1, 0x55, 0x5c, 0x55, 0x80, 0xc0,
+    0xb1, 0x86, 0x5c, 0x55, 0xa0, 0xc0, 0xb1, 0x86,
+    0x5c, 0x55, 0xa0, 0xc0, 0xb1, 0x50, 0xb, 0x3,
+    0x70, 0xc0, 0xb1, 0x9a, 0x88, 0x48, 0x86, 0xc0,
+    0xb2, 0x55, 0x55, 0x5c, 0x82, 0xc0, 0xb1, 0x15,
+    0x40, 0xa, 0x0, 0xc0, 0xb1, 0x0, 0x72, 0x5a,
+    0x0, 0xc0, 0xb1, 0x0, 0x0, 0x74, 0x0, 0xc0,
+    0xb6, 0x55, 0x55, 0x55, 0x55, 0xd0, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x10,
+
+    /* U+571F "土" */
+    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb1,
+    0x0, 0x0, 0x0, 0x2, 0x55, 0x55, 0xc6, 0x55,
+    0x9a, 0x0, 0x0, 0x10, 0x0, 0xb1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb1, 0x0, 0x1, 0x0, 0x26, 0x55, 0x55,
+    0xb6, 0x55, 0x5b, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+5723 "圣" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x16, 0x65, 0x55, 0x58, 0xd0, 0x0, 0x0, 0x0,
+    0x32, 0x0, 0xd, 0x50, 0x0, 0x0, 0x0, 0x6,
+    0x40, 0xa6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x2, 0xb8, 0xb7,
+    0x20, 0x0, 0x0, 0x3, 0x87, 0x19, 0x15, 0xbf,
+    0xd3, 0x4, 0x53, 0x0, 0xd, 0x0, 0x0, 0x20,
+    0x0, 0x0, 0x0, 0xd, 0x0, 0x26, 0x0, 0x0,
+    0x26, 0x55, 0x5e, 0x55, 0x55, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x1, 0x80, 0x5, 0x55, 0x55, 0x56,
+    0x55, 0x55, 0x62,
+
+    /* U+5728 "在" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0x80, 0x0, 0x6, 0x40, 0x5, 0x65, 0x5d,
+    0x55, 0x65, 0x55, 0x40, 0x0, 0x0, 0x58, 0x0,
+    0xd0, 0x0, 0x0, 0x0, 0x1, 0xb0, 0x0, 0xc0,
+    0x0, 0x0, 0x0, 0xd, 0x20, 0x0, 0xc0, 0x7,
+    0x0, 0x0, 0x8c, 0x6, 0x55, 0xd5, 0x55, 0x20,
+    0x6, 0x2c, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x10,
+    0xc, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xc, 0x45,
+    0x55, 0xc5, 0x56, 0xc1, 0x0, 0xc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5730 "地" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x29, 0x0, 0x0, 0x1a, 0x0, 0x0, 0x0, 0x29,
+    0x0, 0x51, 0x1a, 0x0, 0x0, 0x0, 0x29, 0x0,
+    0xb0, 0x1a, 0x3, 0x0, 0x0, 0x29, 0x10, 0xb0,
+    0x1b, 0x5d, 0x20, 0x6, 0x7b, 0x83, 0xb5, 0x6a,
+    0xb, 0x0, 0x0, 0x29, 0x35, 0xc0, 0x1a, 0xb,
+    0x0, 0x0, 0x29, 0x0, 0xb0, 0x1a, 0xb, 0x0,
+    0x0, 0x29, 0x0, 0xb0, 0x1a, 0xb, 0x0, 0x0,
+    0x29, 0x0, 0xb0, 0x1b, 0x9b, 0x10, 0x0, 0x2c,
+    0x64, 0xb0, 0x17, 0x0, 0x50, 0xb, 0xb3, 0x0,
+    0xb0, 0x0, 0x0, 0x91, 0x3, 0x0, 0x0, 0x7b,
+    0xaa, 0xaa, 0xe4,
+
+    /* U+5747 "均" */
+    0x0, 0x2, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0,
+    0xe, 0x0, 0x7, 0x90, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0xb, 0x10, 0x0, 0x10, 0x0, 0xc, 0x0,
+    0x2b, 0x55, 0x55, 0xd1, 0x5, 0x5d, 0x86, 0x81,
+    0x0, 0x0, 0xc0, 0x0, 0xc, 0x2, 0x53, 0x60,
+    0x0, 0xc0, 0x0, 0xc, 0x2, 0x0, 0xb6, 0x0,
+    0xc0, 0x0, 0xc, 0x0, 0x0, 0x35, 0x0, 0xb0,
+    0x0, 0xc, 0x2, 0x10, 0x5, 0x41, 0xb0, 0x0,
+    0x2e, 0x83, 0x6, 0x91, 0x2, 0xa0, 0x1d, 0xc3,
+    0x2, 0xe6, 0x0, 0x4, 0x80, 0x3, 0x0, 0x0,
+    0x20, 0x22, 0x1a, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xea, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x10, 0x0,
+
+    /* U+574A "坊" */
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x10, 0x1, 0xb1, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x88, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0x11, 0x22, 0x11, 0x80, 0x0, 0xc, 0x16, 0x36,
+    0xb3, 0x33, 0x31, 0x4, 0x5d, 0x54, 0x4, 0x90,
+    0x0, 0x0, 0x0, 0xc, 0x0, 0x5, 0xa5, 0x5b,
+    0x60, 0x0, 0xc, 0x0, 0x7, 0x60, 0xa, 0x30,
+    0x0, 0xc, 0x0, 0xb, 0x20, 0xb, 0x10, 0x0,
+    0x1d, 0x86, 0x2b, 0x0, 0xd, 0x0, 0xc, 0xc4,
+    0x0, 0x93, 0x0, 0xd, 0x0, 0x2, 0x0, 0x5,
+    0x40, 0x21, 0x3b, 0x0, 0x0, 0x0, 0x53, 0x0,
+    0x1a, 0xf4, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x10, 0x0,
+
+    /* U+5750 "坐" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x95, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0x20, 0x92, 0x0, 0xd2, 0x0, 0x0, 0x2c, 0x0,
+    0x92, 0x3, 0xb0, 0x0, 0x0, 0x88, 0x0, 0x92,
+    0x9, 0x80, 0x0, 0x0, 0xc5, 0xa0, 0x92, 0x1a,
+    0x2b, 0x0, 0x6, 0x40, 0xb4, 0x92, 0x71, 0x9,
+    0x60, 0x16, 0x0, 0x20, 0x95, 0x30, 0x1, 0x10,
+    0x10, 0x35, 0x55, 0xb7, 0x55, 0xd3, 0x0, 0x0,
+    0x10, 0x0, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x92, 0x0, 0x5, 0x40, 0x26, 0x55, 0x55, 0x65,
+    0x55, 0x57, 0x70,
+
+    /* U+578B "型" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x15,
+    0x55, 0x58, 0x80, 0x0, 0xb1, 0x0, 0xa, 0x9,
+    0x20, 0xb, 0xb, 0x0, 0x0, 0xa0, 0x92, 0x30,
+    0xb0, 0xb0, 0x5, 0x5c, 0x5b, 0x78, 0x3b, 0xb,
+    0x0, 0x0, 0xb0, 0x92, 0x0, 0xb0, 0xb0, 0x0,
+    0x28, 0x9, 0x20, 0x3, 0xb, 0x0, 0x9, 0x0,
+    0x92, 0x0, 0x38, 0xd0, 0x5, 0x10, 0x1, 0xa5,
+    0x0, 0x23, 0x0, 0x1, 0x55, 0x5c, 0x75, 0x5c,
+    0x30, 0x0, 0x1, 0x0, 0xa3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0x30, 0x0, 0x10, 0x4, 0x55,
+    0x55, 0xb7, 0x55, 0x5e, 0x80, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+57DF "域" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x10, 0x0, 0x0,
+    0x94, 0x0, 0x0, 0xc, 0x2b, 0x20, 0x0, 0x92,
+    0x0, 0x0, 0xb, 0x4, 0x40, 0x0, 0x92, 0x36,
+    0x55, 0x5c, 0x56, 0xa1, 0x25, 0xb8, 0x80, 0x0,
+    0xb, 0x0, 0x0, 0x1, 0x92, 0xa, 0x5c, 0x3b,
+    0xa, 0x30, 0x0, 0x92, 0xa, 0xa, 0xb, 0xd,
+    0x0, 0x0, 0x92, 0xa, 0xa, 0xb, 0x57, 0x0,
+    0x0, 0x92, 0xa, 0x59, 0xa, 0xc1, 0x0, 0x15,
+    0xc7, 0x40, 0x0, 0x28, 0xa0, 0x2, 0x49, 0x10,
+    0x68, 0x74, 0x3b, 0xc2, 0x32, 0x0, 0x0, 0x61,
+    0x2, 0x90, 0x3d, 0xa1, 0x0, 0x0, 0x0, 0x56,
+    0x0, 0x4, 0xe2, 0x0, 0x0, 0x1, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+57F7 "執" */
+    0x0, 0x3, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0xc, 0x20, 0x0, 0xc2, 0x0, 0x0, 0x4, 0x5d,
+    0x59, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0xc0, 0x3, 0x0, 0x0, 0xc, 0x3, 0x26,
+    0xd5, 0x8b, 0x0, 0x27, 0x85, 0x59, 0x30, 0xb0,
+    0x57, 0x0, 0x0, 0x93, 0x56, 0x5, 0xb0, 0x65,
+    0x0, 0x5, 0x77, 0x99, 0x12, 0xe4, 0x74, 0x0,
+    0x0, 0xc, 0x0, 0x4, 0x8d, 0x74, 0x0, 0x25,
+    0x5d, 0x5a, 0x49, 0x20, 0x75, 0x10, 0x1, 0xc,
+    0x0, 0x19, 0x0, 0x58, 0x60, 0x0, 0xc, 0x0,
+    0x91, 0x0, 0xd, 0xa0, 0x0, 0xb, 0x16, 0x10,
+    0x0, 0x3, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+57FA "基" */
+    0x0, 0x0, 0x20, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x0, 0xd0, 0x0, 0xd, 0x1, 0x0, 0x3, 0x55,
+    0xd5, 0x55, 0x5d, 0x5a, 0x30, 0x0, 0x0, 0xc0,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xc5, 0x55,
+    0x5c, 0x0, 0x0, 0x0, 0x0, 0xc5, 0x55, 0x5c,
+    0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0xc, 0x5,
+    0x40, 0x6, 0x55, 0xc7, 0x75, 0x87, 0x57, 0x60,
+    0x0, 0x4, 0x90, 0xb2, 0x9, 0x30, 0x0, 0x0,
+    0x57, 0x0, 0xb0, 0x5, 0x9c, 0x71, 0x16, 0x32,
+    0x55, 0xc5, 0x56, 0x3, 0x40, 0x0, 0x0, 0x0,
+    0xb0, 0x0, 0x0, 0x0, 0x3, 0x55, 0x55, 0xc5,
+    0x55, 0x6e, 0x20, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5831 "報" */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0x20, 0xa, 0x55, 0x59, 0x50, 0x5, 0x5c,
+    0x59, 0x1b, 0x0, 0x8, 0x30, 0x0, 0xa, 0x0,
+    0xb, 0x0, 0xa, 0x10, 0x25, 0x5c, 0x57, 0x7b,
+    0x2, 0xac, 0x0, 0x1, 0x60, 0x35, 0xb, 0x0,
+    0x11, 0x0, 0x0, 0x85, 0x72, 0xc, 0x75, 0x5a,
+    0x80, 0x6, 0x68, 0x79, 0x3b, 0x40, 0xb, 0x0,
+    0x0, 0xa, 0x0, 0xb, 0x7, 0x74, 0x0, 0x25,
+    0x5c, 0x57, 0x6b, 0x7, 0xa0, 0x0, 0x1, 0xa,
+    0x0, 0xb, 0xa, 0xb3, 0x0, 0x0, 0xa, 0x0,
+    0xb, 0x71, 0x1d, 0x80, 0x0, 0xa, 0x10, 0xb,
+    0x0, 0x2, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5834 "場" */
+    0x0, 0x20, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0xa4, 0x0, 0xc5, 0x55, 0x5d, 0x0, 0x0, 0xa2,
+    0x0, 0xb0, 0x0, 0xc, 0x0, 0x0, 0xa2, 0x0,
+    0xc5, 0x55, 0x5c, 0x0, 0x36, 0xc6, 0x92, 0xd5,
+    0x55, 0x5c, 0x0, 0x0, 0xa2, 0x0, 0x60, 0x0,
+    0x5, 0x10, 0x0, 0xa2, 0x16, 0x5a, 0x55, 0x56,
+    0x90, 0x0, 0xa2, 0x0, 0x7a, 0x55, 0x56, 0x50,
+    0x0, 0xa5, 0x67, 0x65, 0x76, 0x66, 0x50, 0x27,
+    0xb4, 0x42, 0x28, 0xb, 0x8, 0x20, 0x47, 0x0,
+    0x4, 0x60, 0x92, 0xb, 0x0, 0x0, 0x0, 0x12,
+    0x8, 0x30, 0xc, 0x0, 0x0, 0x0, 0x3, 0x61,
+    0x6, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x10, 0x0,
+
+    /* U+584A "塊" */
+    0x0, 0x10, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0xa3, 0x0, 0x4, 0x80, 0x0, 0x0, 0x0, 0xa2,
+    0xa, 0x57, 0x85, 0x5c, 0x0, 0x0, 0xa2, 0xb,
+    0x0, 0xc0, 0xc, 0x0, 0x25, 0xc7, 0x8b, 0x55,
+    0xd5, 0x5c, 0x0, 0x1, 0xa2, 0xb, 0x0, 0xc0,
+    0xc, 0x0, 0x0, 0xa2, 0xb, 0x1, 0xb0, 0xc,
+    0x0, 0x0, 0xa2, 0x9, 0x48, 0xe8, 0x47, 0x0,
+    0x0, 0xa2, 0x40, 0xa, 0x84, 0x82, 0x0, 0x1,
+    0xb8, 0x10, 0x39, 0x65, 0x74, 0x0, 0x5d, 0x30,
+    0x1, 0xa0, 0x6c, 0x79, 0x50, 0x1, 0x0, 0x19,
+    0x10, 0x66, 0x2, 0x80, 0x0, 0x3, 0x50, 0x0,
+    0x3b, 0x89, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5869 "塩" */
+    0x0, 0x30, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0xb1, 0x0, 0xa5, 0x0, 0x0, 0x0, 0x0, 0xb0,
+    0x0, 0xc5, 0x55, 0x5c, 0x40, 0x0, 0xb0, 0x6,
+    0x20, 0x0, 0x0, 0x0, 0x36, 0xd7, 0x56, 0x85,
+    0x55, 0x5a, 0x0, 0x0, 0xb0, 0x10, 0xb0, 0x0,
+    0xb, 0x0, 0x0, 0xb0, 0x0, 0xb0, 0x0, 0xb,
+    0x0, 0x0, 0xb0, 0x1, 0xa5, 0x55, 0x58, 0x0,
+    0x0, 0xb1, 0x45, 0x55, 0x55, 0x58, 0x20, 0x3,
+    0xc6, 0xb, 0xa, 0xa, 0xa, 0x10, 0x4b, 0x10,
+    0xb, 0xa, 0xa, 0xa, 0x10, 0x0, 0x0, 0xb,
+    0xa, 0xa, 0xa, 0x10, 0x0, 0x0, 0x4c, 0x5c,
+    0x5c, 0x5b, 0xc1, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5883 "境" */
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x2b, 0x0, 0x0, 0x92, 0x1, 0x0, 0x0, 0x29,
+    0x1, 0x65, 0x65, 0x68, 0x50, 0x0, 0x29, 0x0,
+    0x9, 0x20, 0xc2, 0x0, 0x5, 0x6b, 0xa3, 0x15,
+    0x44, 0x51, 0x70, 0x0, 0x29, 0x5, 0x54, 0x44,
+    0x45, 0x41, 0x0, 0x29, 0x0, 0xb5, 0x55, 0x5e,
+    0x10, 0x0, 0x29, 0x0, 0xb5, 0x55, 0x5c, 0x0,
+    0x0, 0x29, 0x13, 0xb0, 0x0, 0xc, 0x0, 0x6,
+    0xa9, 0x30, 0xc7, 0x78, 0x5c, 0x0, 0x6, 0x10,
+    0x0, 0x9, 0x4b, 0x0, 0x50, 0x0, 0x0, 0x0,
+    0x2c, 0xb, 0x0, 0x71, 0x0, 0x0, 0x37, 0x81,
+    0x6, 0xb9, 0xd4, 0x0, 0x2, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5897 "増" */
+    0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb3, 0x0, 0x49, 0x0, 0x7a, 0x0, 0x0, 0xb1,
+    0x0, 0x9, 0x61, 0x80, 0x0, 0x0, 0xb1, 0x8,
+    0x56, 0x77, 0x55, 0x90, 0x13, 0xc5, 0x6c, 0x0,
+    0xb0, 0x2, 0xa0, 0x13, 0xb2, 0x1c, 0x55, 0xc5,
+    0x56, 0xa0, 0x0, 0xb1, 0xc, 0x0, 0xb0, 0x2,
+    0xa0, 0x0, 0xb1, 0xa, 0x55, 0x55, 0x56, 0x70,
+    0x0, 0xb1, 0x1, 0x85, 0x55, 0x5a, 0x0, 0x0,
+    0xb8, 0x61, 0xa0, 0x0, 0xc, 0x0, 0x4c, 0xa1,
+    0x0, 0xc5, 0x55, 0x5c, 0x0, 0x15, 0x0, 0x0,
+    0xa0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x1, 0xc5,
+    0x55, 0x5d, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0,
+    0x2, 0x0,
+
+    /* U+589E "增" */
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x2b, 0x0, 0x9, 0x30, 0x67, 0x0, 0x0, 0x19,
+    0x0, 0x22, 0x50, 0x70, 0x30, 0x0, 0x19, 0x0,
+    0xc5, 0x5c, 0x55, 0xc0, 0x6, 0x6b, 0xa4, 0xe5,
+    0xa, 0x28, 0xa0, 0x0, 0x19, 0x0, 0xad, 0xa,
+    0x61, 0xa0, 0x0, 0x19, 0x0, 0xa2, 0xa, 0x10,
+    0xa0, 0x0, 0x19, 0x0, 0x95, 0x55, 0x55, 0x80,
+    0x0, 0x19, 0x0, 0x56, 0x55, 0x5b, 0x10, 0x0,
+    0x3d, 0x63, 0x55, 0x0, 0xb, 0x0, 0xc, 0x91,
+    0x0, 0x58, 0x55, 0x5c, 0x0, 0x1, 0x0, 0x0,
+    0x55, 0x0, 0xb, 0x0, 0x0, 0x0, 0x0, 0x58,
+    0x55, 0x5c, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+58CA "壊" */
+    0x0, 0x10, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0,
+    0xb2, 0x0, 0x0, 0xd1, 0x2, 0x20, 0x0, 0xb0,
+    0x26, 0x55, 0xd5, 0x56, 0x50, 0x0, 0xb0, 0x5,
+    0x55, 0xd5, 0x58, 0x20, 0x25, 0xc6, 0x8a, 0xa,
+    0xa, 0xa, 0x0, 0x1, 0xb0, 0xa, 0xa, 0xa,
+    0xa, 0x0, 0x0, 0xb0, 0xb, 0x59, 0x59, 0x5c,
+    0x0, 0x0, 0xb0, 0x1, 0x0, 0xa1, 0x3, 0x0,
+    0x0, 0xb0, 0x26, 0x5b, 0x95, 0x58, 0x20, 0x0,
+    0xb6, 0x50, 0x86, 0x24, 0x1b, 0x0, 0x2a, 0x91,
+    0x7, 0xc3, 0x9, 0x71, 0x0, 0x5, 0x2, 0x62,
+    0x73, 0x42, 0xd4, 0x0, 0x0, 0x1, 0x0, 0x8a,
+    0x10, 0x3e, 0x91, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+58D3 "壓" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0xc,
+    0x55, 0x55, 0x55, 0x65, 0x83, 0x0, 0xb3, 0x95,
+    0x5b, 0xa, 0x27, 0x0, 0xb, 0x39, 0x55, 0xa0,
+    0xa0, 0x52, 0x0, 0xb3, 0x75, 0x57, 0x5c, 0x59,
+    0x0, 0x9, 0x67, 0x55, 0xb0, 0xa4, 0x0, 0x3,
+    0x76, 0x85, 0x5a, 0x9, 0x60, 0x0, 0x62, 0x68,
+    0x55, 0xa5, 0x45, 0x50, 0x8, 0x6, 0x40, 0x5a,
+    0x60, 0xc, 0x42, 0x30, 0x31, 0x1, 0x70, 0x0,
+    0x10, 0x0, 0x25, 0x55, 0x6b, 0x55, 0xa0, 0x0,
+    0x0, 0x10, 0x1, 0x80, 0x0, 0x0, 0x4, 0x55,
+    0x55, 0x6b, 0x55, 0x5c, 0x80, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+58EB "士" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa2,
+    0x0, 0x0, 0x0, 0x15, 0x55, 0x55, 0xc7, 0x55,
+    0x5c, 0x90, 0x1, 0x0, 0x0, 0xa2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x55, 0x55,
+    0xc7, 0x55, 0xaa, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+58F0 "声" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0x0, 0x0, 0x0, 0x25, 0x55, 0x55,
+    0xd5, 0x55, 0x7b, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0x0, 0x65, 0x55, 0xb5, 0x58, 0x80,
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0,
+    0xd5, 0x55, 0xd5, 0x55, 0xd0, 0x0, 0xc, 0x0,
+    0xc, 0x0, 0xc, 0x0, 0x0, 0xd5, 0x55, 0xa5,
+    0x55, 0xd0, 0x0, 0x1b, 0x0, 0x0, 0x0, 0x2,
+    0x0, 0x4, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x53, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+58F2 "売" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0x20, 0x2, 0x10, 0x2, 0x65, 0x55,
+    0xc6, 0x55, 0x86, 0x0, 0x0, 0x0, 0xa, 0x10,
+    0x21, 0x0, 0x0, 0x16, 0x55, 0x75, 0x57, 0x40,
+    0x0, 0x55, 0x55, 0x55, 0x55, 0x55, 0x82, 0xa,
+    0x10, 0x0, 0x0, 0x0, 0xa, 0x20, 0x80, 0x6,
+    0x60, 0x36, 0x1, 0x10, 0x0, 0x0, 0x86, 0x4,
+    0x80, 0x0, 0x0, 0x0, 0x9, 0x30, 0x48, 0x0,
+    0x0, 0x0, 0x0, 0xc0, 0x4, 0x80, 0x4, 0x0,
+    0x0, 0x58, 0x0, 0x38, 0x0, 0x52, 0x0, 0x66,
+    0x0, 0x2, 0xea, 0xac, 0x51, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+5909 "変" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5a, 0x0, 0x0, 0x30, 0x4, 0x65,
+    0x58, 0x59, 0x68, 0x56, 0xb3, 0x0, 0x2, 0x1c,
+    0x0, 0x3b, 0x0, 0x0, 0x0, 0x1c, 0x4c, 0x0,
+    0x3c, 0x86, 0x0, 0x0, 0x91, 0x1c, 0x0, 0x3b,
+    0x8, 0xb0, 0x5, 0x0, 0xa, 0x10, 0x11, 0x0,
+    0x50, 0x0, 0x0, 0x4e, 0x65, 0x55, 0x91, 0x0,
+    0x0, 0x2, 0x95, 0x0, 0x7, 0xc2, 0x0, 0x0,
+    0x35, 0x4, 0x60, 0x7a, 0x0, 0x0, 0x0, 0x10,
+    0x0, 0x6d, 0x80, 0x0, 0x0, 0x0, 0x0, 0x17,
+    0x94, 0xa9, 0x40, 0x0, 0x1, 0x56, 0x61, 0x0,
+    0x3, 0x9e, 0xe5, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x10,
+
+    /* U+590F "夏" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x3,
+    0x65, 0x55, 0xa5, 0x55, 0x5a, 0x20, 0x0, 0x7,
+    0x56, 0x85, 0x55, 0x90, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0xd, 0x55, 0x55,
+    0x55, 0xc0, 0x0, 0x0, 0xd, 0x55, 0x55, 0x55,
+    0xc0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0xc, 0x6e, 0x55, 0x55, 0x80, 0x0,
+    0x0, 0x0, 0x99, 0x55, 0x5c, 0x20, 0x0, 0x0,
+    0x6, 0x55, 0x10, 0xa6, 0x0, 0x0, 0x0, 0x64,
+    0x0, 0x9a, 0x50, 0x0, 0x0, 0x3, 0x10, 0x5,
+    0x97, 0xa6, 0x20, 0x0, 0x1, 0x56, 0x72, 0x0,
+    0x6, 0xbe, 0x92, 0x12, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5915 "夕" */
+    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd8, 0x55,
+    0x57, 0xd1, 0x0, 0x0, 0x5a, 0x0, 0x0, 0x8a,
+    0x0, 0x0, 0xc, 0x10, 0x0, 0xe, 0x20, 0x0,
+    0x7, 0x88, 0x0, 0x7, 0x90, 0x0, 0x3, 0x70,
+    0x5d, 0x1, 0xe1, 0x0, 0x1, 0x60, 0x0, 0xc2,
+    0xa5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x79, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x88, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xa5, 0x0, 0x0, 0x0, 0x1, 0x57,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+5916 "外" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe2, 0x0, 0xd, 0x10, 0x0, 0x0, 0x3c, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0x8, 0x60, 0x23, 0xc,
+    0x0, 0x0, 0x0, 0xc5, 0x5a, 0xb0, 0xc0, 0x0,
+    0x0, 0x48, 0x0, 0xc2, 0xd, 0x10, 0x0, 0xa,
+    0x84, 0x1c, 0x0, 0xc6, 0xa2, 0x4, 0x40, 0xd7,
+    0x50, 0xc, 0x3, 0xe1, 0x30, 0x1, 0xc0, 0x0,
+    0xc0, 0x4, 0x0, 0x0, 0x65, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0x29, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0x27, 0x0, 0x0, 0xc, 0x0, 0x0, 0x34, 0x0,
+    0x0, 0x0, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0x0, 0x0,
+
+    /* U+591A "多" */
+    0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x50, 0x0, 0x0, 0x0, 0x1, 0xb8, 0x55,
+    0x59, 0xb0, 0x0, 0x48, 0x72, 0x0, 0x5c, 0x10,
+    0x15, 0x20, 0x1b, 0x8, 0x80, 0x0, 0x0, 0x0,
+    0x6, 0xa3, 0x0, 0x0, 0x0, 0x37, 0x86, 0xc1,
+    0x0, 0x0, 0x24, 0x20, 0x2d, 0x95, 0x55, 0x93,
+    0x0, 0x5, 0xb2, 0x0, 0x4, 0xc2, 0x2, 0x75,
+    0x38, 0x0, 0x4b, 0x10, 0x2, 0x0, 0xd, 0x7,
+    0x90, 0x0, 0x0, 0x0, 0x17, 0x93, 0x0, 0x0,
+    0x3, 0x56, 0x62, 0x0, 0x0, 0x0, 0x21, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+591C "夜" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x5, 0x55,
+    0x55, 0x58, 0x55, 0x57, 0xb0, 0x1, 0x2, 0xc0,
+    0x1d, 0x0, 0x0, 0x0, 0x0, 0x9, 0x60, 0x68,
+    0x0, 0x14, 0x0, 0x0, 0x1c, 0x0, 0xb5, 0x55,
+    0x99, 0x0, 0x0, 0x8e, 0x3, 0x93, 0x60, 0xb2,
+    0x0, 0x2, 0x7c, 0x9, 0x60, 0xb1, 0xb0, 0x0,
+    0x6, 0xc, 0x52, 0x16, 0x8, 0x50, 0x0, 0x0,
+    0xc, 0x0, 0x6, 0x5b, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0x19, 0x4a, 0x92, 0x0, 0x0, 0xc, 0x5, 0x70,
+    0x0, 0x6e, 0xc2, 0x0, 0x4, 0x30, 0x0, 0x0,
+    0x0, 0x10,
+
+    /* U+5920 "夠" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x30, 0x0, 0xd2, 0x0, 0x0, 0x0, 0x77,
+    0x58, 0xc4, 0x90, 0x0, 0x10, 0x5, 0x84, 0xc,
+    0x2a, 0x55, 0x55, 0xd0, 0x11, 0x6, 0xa3, 0x53,
+    0x0, 0x0, 0xb0, 0x0, 0x9, 0x52, 0x42, 0x0,
+    0x40, 0xb0, 0x4, 0x77, 0xa0, 0x1b, 0x55, 0xc0,
+    0xb0, 0x11, 0x2b, 0x57, 0xeb, 0x0, 0xb0, 0xb0,
+    0x1, 0xb1, 0x9, 0x5a, 0x0, 0xb0, 0xb0, 0x16,
+    0x1b, 0x2b, 0xb, 0x55, 0xb1, 0xa0, 0x0, 0x3,
+    0xb2, 0x0, 0x0, 0x3, 0x80, 0x0, 0x19, 0x30,
+    0x0, 0x12, 0x17, 0x60, 0x4, 0x60, 0x0, 0x0,
+    0x5, 0xde, 0x10, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x10, 0x0,
+
+    /* U+5927 "大" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd0, 0x0, 0x2, 0x10, 0x6, 0x55, 0x55, 0xe5,
+    0x55, 0x59, 0x80, 0x0, 0x0, 0x0, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0x87, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0x31, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0x0, 0x73, 0x0, 0x0, 0x0, 0x0,
+    0xb2, 0x0, 0xa, 0x40, 0x0, 0x0, 0x1a, 0x30,
+    0x0, 0x1, 0xda, 0x30, 0x5, 0x70, 0x0, 0x0,
+    0x0, 0xa, 0x70, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5929 "天" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x45, 0x55, 0x55, 0x55, 0xd4, 0x0, 0x0, 0x10,
+    0x0, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd0, 0x0,
+    0x1b, 0x10, 0x6, 0x55, 0x56, 0xc8, 0x55, 0x55,
+    0x30, 0x0, 0x0, 0x6, 0x75, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0x21, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x3a, 0x0, 0x82, 0x0, 0x0, 0x0, 0x0,
+    0xb1, 0x0, 0x1c, 0x30, 0x0, 0x0, 0x9, 0x10,
+    0x0, 0x3, 0xe8, 0x20, 0x3, 0x70, 0x0, 0x0,
+    0x0, 0x2c, 0xa1, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+592A "太" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb1, 0x0, 0x3, 0x10, 0x5, 0x65, 0x55, 0xd7,
+    0x55, 0x5a, 0x70, 0x0, 0x0, 0x0, 0xd6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xa2, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0x50, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0x0, 0x65, 0x0, 0x0, 0x0,
+    0x0, 0x87, 0x10, 0xc, 0x10, 0x0, 0x0, 0x4,
+    0x80, 0xb5, 0x3, 0xc1, 0x0, 0x0, 0x47, 0x0,
+    0x1e, 0x0, 0x6e, 0x60, 0x5, 0x30, 0x0, 0x2,
+    0x0, 0x6, 0x71, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+592B "夫" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x96, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x93, 0x0, 0x1, 0x0, 0x0, 0x55, 0x55,
+    0xb7, 0x55, 0x87, 0x0, 0x0, 0x0, 0x0, 0xa3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa2, 0x0,
+    0x2, 0x0, 0x6, 0x55, 0x55, 0xd6, 0x55, 0x5b,
+    0x80, 0x0, 0x0, 0x1, 0xd4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0x70, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0x0, 0x72, 0x0, 0x0, 0x0, 0x0,
+    0xa3, 0x0, 0xb, 0x20, 0x0, 0x0, 0x19, 0x20,
+    0x0, 0x2, 0xe7, 0x10, 0x4, 0x50, 0x0, 0x0,
+    0x0, 0x2c, 0x80, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+592E "央" */
+    0x0, 0x0, 0x0, 0x12, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3b, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3a, 0x0, 0x0, 0x0, 0x0, 0xa, 0x55,
+    0x7c, 0x55, 0xc2, 0x0, 0x0, 0xd, 0x0, 0x39,
+    0x0, 0xd0, 0x0, 0x0, 0xd, 0x0, 0x39, 0x0,
+    0xd0, 0x0, 0x0, 0xd, 0x0, 0x48, 0x0, 0xd0,
+    0x10, 0x4, 0x6b, 0x55, 0x9a, 0x55, 0xb8, 0xb0,
+    0x0, 0x0, 0x0, 0x94, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xc0, 0x71, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0x30, 0x1b, 0x10, 0x0, 0x0, 0x2, 0x93,
+    0x0, 0x2, 0xd7, 0x20, 0x2, 0x65, 0x0, 0x0,
+    0x0, 0x1a, 0xb1, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5931 "失" */
+    0x0, 0x0, 0x0, 0x41, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x0, 0x96, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0x20, 0x93, 0x0, 0x0, 0x0, 0x0, 0x2d, 0x55,
+    0xb7, 0x55, 0xd4, 0x0, 0x0, 0x72, 0x0, 0xa3,
+    0x0, 0x0, 0x0, 0x0, 0x70, 0x0, 0xb1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x9,
+    0x30, 0x6, 0x55, 0x55, 0xd8, 0x55, 0x55, 0x40,
+    0x0, 0x0, 0x4, 0x83, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0x10, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x67, 0x0, 0x2a, 0x0, 0x0, 0x0, 0x6, 0x70,
+    0x0, 0x4, 0xc4, 0x0, 0x2, 0x73, 0x0, 0x0,
+    0x0, 0x4e, 0x90, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0,
+
+    /* U+5947 "奇" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x97, 0x0, 0x0, 0x0, 0x0, 0x55,
+    0x55, 0xd6, 0x55, 0x7b, 0x0, 0x0, 0x10, 0x5,
+    0x96, 0x30, 0x0, 0x0, 0x0, 0x0, 0x58, 0x0,
+    0x5c, 0x80, 0x0, 0x0, 0x46, 0x30, 0x0, 0x0,
+    0x92, 0x80, 0x6, 0x55, 0x55, 0x55, 0x55, 0xc5,
+    0x62, 0x0, 0x3, 0x0, 0x4, 0x0, 0xc0, 0x0,
+    0x0, 0xd, 0x55, 0x5d, 0x10, 0xc0, 0x0, 0x0,
+    0xc, 0x0, 0xc, 0x0, 0xc0, 0x0, 0x0, 0xd,
+    0x55, 0x5d, 0x0, 0xc0, 0x0, 0x0, 0xa, 0x0,
+    0x5, 0x0, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5d, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0,
+
+    /* U+5951 "契" */
+    0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc0, 0x10, 0x0, 0x0, 0x20, 0x3, 0x65,
+    0xc5, 0x93, 0x6b, 0x56, 0xd0, 0x0, 0x0, 0xb1,
+    0x30, 0xc, 0x2, 0xa0, 0x0, 0x65, 0xc5, 0x40,
+    0x48, 0x4, 0x80, 0x3, 0x55, 0xc5, 0xa2, 0xb1,
+    0x6, 0x60, 0x0, 0x0, 0xb0, 0x8, 0x33, 0x6c,
+    0x20, 0x0, 0x0, 0xc1, 0x70, 0x0, 0x55, 0x0,
+    0x0, 0x0, 0x0, 0x95, 0x0, 0x5, 0x40, 0x5,
+    0x65, 0x55, 0xd8, 0x55, 0x55, 0x50, 0x0, 0x0,
+    0x7, 0x50, 0x80, 0x0, 0x0, 0x0, 0x0, 0x77,
+    0x0, 0x1a, 0x60, 0x0, 0x0, 0x58, 0x30, 0x0,
+    0x0, 0x8e, 0xb2, 0x4, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x10,
+
+    /* U+5957 "套" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xd1, 0x0, 0x2, 0x0, 0x2, 0x65,
+    0x5c, 0x85, 0x65, 0x5b, 0x20, 0x0, 0x0, 0x59,
+    0x0, 0x53, 0x0, 0x0, 0x0, 0x3, 0xa0, 0x0,
+    0x1a, 0x60, 0x0, 0x0, 0x56, 0xc5, 0x55, 0x66,
+    0x7e, 0x91, 0x15, 0x20, 0xc5, 0x55, 0x79, 0x2,
+    0x20, 0x0, 0x0, 0xc0, 0x0, 0x2, 0x0, 0x0,
+    0x0, 0x0, 0xc5, 0x55, 0x58, 0x30, 0x0, 0x5,
+    0x55, 0xd5, 0x55, 0x55, 0x5c, 0x90, 0x1, 0x0,
+    0xa, 0x60, 0x30, 0x0, 0x0, 0x0, 0x0, 0x73,
+    0x0, 0x9, 0x90, 0x0, 0x0, 0x9, 0xc9, 0x76,
+    0x54, 0x87, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x0,
+
+    /* U+5973 "女" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xa0, 0x0, 0x0, 0x10, 0x5, 0x55, 0x5a, 0x85,
+    0x55, 0x59, 0xc0, 0x0, 0x0, 0xc, 0x0, 0xb,
+    0x40, 0x0, 0x0, 0x0, 0x48, 0x0, 0xe, 0x0,
+    0x0, 0x0, 0x0, 0xa2, 0x0, 0x69, 0x0, 0x0,
+    0x0, 0x1, 0xd1, 0x0, 0xc2, 0x0, 0x0, 0x0,
+    0x0, 0x16, 0x89, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4c, 0xab, 0x50, 0x0, 0x0, 0x0, 0x8,
+    0x80, 0x3, 0xdb, 0x0, 0x0, 0x36, 0x71, 0x0,
+    0x0, 0xa, 0x10, 0x3, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5979 "她" */
+    0x0, 0x3, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0xe, 0x10, 0x0, 0xd, 0x0, 0x0, 0x0, 0x1b,
+    0x0, 0x14, 0xb, 0x0, 0x0, 0x0, 0x38, 0x3,
+    0x2a, 0xb, 0x1, 0x0, 0x6, 0x98, 0x6b, 0x19,
+    0xc, 0x5d, 0x20, 0x0, 0x73, 0x38, 0x7b, 0x5b,
+    0xb, 0x0, 0x0, 0xa0, 0x65, 0x19, 0xb, 0xc,
+    0x0, 0x0, 0xa0, 0x82, 0x19, 0xb, 0xc, 0x0,
+    0x0, 0x90, 0xb0, 0x19, 0xb, 0x5c, 0x0, 0x2,
+    0x93, 0xa0, 0x19, 0xc, 0x24, 0x10, 0x0, 0xa,
+    0xc3, 0x19, 0xb, 0x0, 0x50, 0x0, 0x27, 0x1d,
+    0x2a, 0x0, 0x0, 0x90, 0x2, 0x70, 0x1, 0xd,
+    0xa9, 0x9a, 0xd1, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+597D "好" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x10, 0x0, 0x0, 0x4, 0x0, 0x0, 0xc,
+    0x0, 0x25, 0x55, 0x6e, 0x30, 0x0, 0x29, 0x3,
+    0x0, 0x0, 0x81, 0x0, 0x15, 0x99, 0x5d, 0x10,
+    0x8, 0x30, 0x0, 0x0, 0x92, 0xb, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0xa0, 0x38, 0x0, 0xc, 0x0,
+    0x70, 0x0, 0x90, 0x75, 0x55, 0x5d, 0x55, 0x51,
+    0x4, 0x50, 0xb0, 0x0, 0xc, 0x0, 0x0, 0x2,
+    0x67, 0xb0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x9,
+    0xba, 0x0, 0xc, 0x0, 0x0, 0x0, 0x65, 0x8,
+    0x40, 0xc, 0x0, 0x0, 0x6, 0x30, 0x0, 0x6,
+    0xbc, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x31,
+    0x0, 0x0,
+
+    /* U+5982 "如" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0x50, 0x95, 0x55, 0xc0, 0x6, 0x5d, 0x55, 0xd0,
+    0xb0, 0x0, 0xb0, 0x0, 0x29, 0x2, 0xa0, 0xb0,
+    0x0, 0xb0, 0x0, 0x65, 0x5, 0x70, 0xb0, 0x0,
+    0xb0, 0x0, 0x91, 0x8, 0x40, 0xb0, 0x0, 0xb0,
+    0x0, 0xb0, 0xb, 0x0, 0xb0, 0x0, 0xb0, 0x0,
+    0x57, 0x7b, 0x0, 0xb0, 0x0, 0xb0, 0x0, 0x0,
+    0x9b, 0xa0, 0xc5, 0x55, 0xb0, 0x0, 0x7, 0x40,
+    0x73, 0xb0, 0x0, 0xb0, 0x2, 0x72, 0x0, 0x0,
+    0x40, 0x0, 0x10, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5987 "妇" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0x0, 0x12, 0x22, 0x22, 0x60, 0x0, 0x2a, 0x2,
+    0x44, 0x33, 0x34, 0xb0, 0x5, 0x89, 0x5b, 0x50,
+    0x0, 0x2, 0xa0, 0x0, 0x83, 0xb, 0x0, 0x0,
+    0x2, 0xa0, 0x0, 0xb0, 0xb, 0x6, 0x55, 0x56,
+    0xa0, 0x0, 0xb0, 0x1a, 0x0, 0x0, 0x2, 0xa0,
+    0x1, 0x92, 0x65, 0x0, 0x0, 0x2, 0xa0, 0x0,
+    0x6, 0xe4, 0x0, 0x0, 0x2, 0xa0, 0x0, 0x3,
+    0x9c, 0x30, 0x0, 0x2, 0xa0, 0x0, 0x19, 0x1,
+    0x46, 0x55, 0x56, 0xa0, 0x1, 0x70, 0x0, 0x0,
+    0x0, 0x1, 0x80, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+59B3 "妳" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0x0, 0x5, 0x90, 0x0, 0x0, 0x0, 0x58,
+    0x0, 0x9, 0x50, 0x0, 0x0, 0x0, 0x83, 0x3,
+    0xd, 0x44, 0x44, 0x70, 0x36, 0xd5, 0x7b, 0x37,
+    0x0, 0x5, 0x90, 0x0, 0xb0, 0x56, 0x70, 0x6,
+    0x15, 0x0, 0x5, 0x60, 0x93, 0x20, 0xc, 0x0,
+    0x0, 0x9, 0x10, 0xc0, 0x7, 0x1c, 0x3, 0x0,
+    0xb, 0x1, 0xa0, 0x1c, 0xc, 0x7, 0x50, 0x1,
+    0x7b, 0x60, 0x63, 0xc, 0x0, 0xd1, 0x0, 0x1b,
+    0xc6, 0x50, 0xc, 0x0, 0x50, 0x0, 0x91, 0x5,
+    0x0, 0xc, 0x0, 0x0, 0x7, 0x10, 0x0, 0x3,
+    0xad, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x12,
+    0x0, 0x0,
+
+    /* U+59B9 "妹" */
+    0x0, 0x2, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0xc, 0x20, 0x0, 0xd, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0x38, 0x4,
+    0x26, 0x5c, 0x58, 0x40, 0x6, 0xa7, 0x5d, 0x0,
+    0xb, 0x0, 0x0, 0x0, 0xa0, 0x29, 0x0, 0xb,
+    0x0, 0x50, 0x0, 0xa0, 0x56, 0x65, 0xbd, 0x75,
+    0x52, 0x3, 0x60, 0x92, 0x0, 0xcb, 0x60, 0x0,
+    0x7, 0x40, 0xb0, 0x6, 0x5b, 0x61, 0x0, 0x0,
+    0x5a, 0x90, 0xa, 0xb, 0x19, 0x0, 0x0, 0x9,
+    0x96, 0x72, 0xb, 0x8, 0x80, 0x0, 0x62, 0x6,
+    0x30, 0xb, 0x0, 0xb5, 0x4, 0x30, 0x2, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x0, 0x0,
+
+    /* U+59BB "妻" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc1, 0x0, 0x9, 0x20, 0x6, 0x55,
+    0x55, 0xd5, 0x55, 0x55, 0x30, 0x0, 0x25, 0x55,
+    0xd5, 0x55, 0x90, 0x0, 0x0, 0x0, 0x0, 0xc0,
+    0x1, 0xa0, 0x40, 0x7, 0x55, 0x55, 0xd5, 0x56,
+    0xc6, 0x81, 0x0, 0x0, 0x0, 0xc0, 0x1, 0xb0,
+    0x0, 0x0, 0x36, 0x5c, 0x65, 0x55, 0x70, 0x0,
+    0x25, 0x55, 0x6d, 0x55, 0x55, 0x57, 0xc1, 0x1,
+    0x0, 0x92, 0x0, 0x6a, 0x0, 0x0, 0x0, 0x1,
+    0x85, 0x56, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x99, 0x9c, 0x92, 0x0, 0x3, 0x55, 0x66, 0x10,
+    0x0, 0x4a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+59C9 "姉" */
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x3,
+    0xc0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x66, 0x0,
+    0x0, 0xb, 0x0, 0x0, 0xa, 0x20, 0x25, 0x55,
+    0xc5, 0x95, 0x36, 0xd5, 0x89, 0x10, 0xb, 0x0,
+    0x0, 0x29, 0x7, 0x52, 0x0, 0xb0, 0x30, 0x6,
+    0x50, 0xa1, 0xb5, 0x5c, 0x5b, 0x20, 0xa0, 0xb,
+    0xb, 0x0, 0xb0, 0xa1, 0xb, 0x3, 0x80, 0xb0,
+    0xb, 0xa, 0x10, 0x38, 0xc4, 0xb, 0x0, 0xb0,
+    0xa1, 0x0, 0x2a, 0xc5, 0xb0, 0xb, 0x4c, 0x10,
+    0x9, 0x0, 0x54, 0x0, 0xb3, 0x70, 0x7, 0x10,
+    0x0, 0x0, 0xc, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x0, 0x20, 0x0,
+
+    /* U+59CB "始" */
+    0x0, 0x1, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0xd, 0x20, 0x0, 0x97, 0x0, 0x0, 0x0, 0x1b,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x47, 0x3,
+    0x5, 0x50, 0x43, 0x0, 0x16, 0xb7, 0x5e, 0x19,
+    0x0, 0xb, 0x40, 0x0, 0xb0, 0x1a, 0x8c, 0x86,
+    0x56, 0xc0, 0x1, 0x90, 0x57, 0x13, 0x0, 0x0,
+    0x30, 0x6, 0x50, 0x92, 0x7, 0x55, 0x59, 0x20,
+    0x9, 0x20, 0xc0, 0xc, 0x0, 0xb, 0x0, 0x0,
+    0x5b, 0xa0, 0xc, 0x0, 0xb, 0x0, 0x0, 0xb,
+    0x9b, 0xc, 0x0, 0xb, 0x0, 0x0, 0x82, 0x8,
+    0xd, 0x55, 0x5d, 0x0, 0x6, 0x20, 0x0, 0xc,
+    0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+59D0 "姐" */
+    0x0, 0x4, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x20, 0x8, 0x55, 0x59, 0x10, 0x0, 0x1c,
+    0x0, 0xc, 0x0, 0xc, 0x0, 0x2, 0x69, 0x26,
+    0xc, 0x0, 0xc, 0x0, 0x3, 0xa5, 0x3d, 0x1c,
+    0x0, 0xc, 0x0, 0x0, 0xb0, 0xb, 0xd, 0x55,
+    0x5d, 0x0, 0x1, 0x90, 0x48, 0xc, 0x0, 0xc,
+    0x0, 0x6, 0x40, 0x83, 0xc, 0x0, 0xc, 0x0,
+    0x9, 0x20, 0xb0, 0xd, 0x55, 0x5d, 0x0, 0x0,
+    0x4a, 0xb0, 0xc, 0x0, 0xc, 0x0, 0x0, 0xb,
+    0x6c, 0x1c, 0x0, 0xc, 0x0, 0x0, 0x82, 0x4,
+    0x2c, 0x0, 0xc, 0x20, 0x6, 0x10, 0x5, 0x68,
+    0x55, 0x58, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+59D4 "委" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x40, 0x0, 0x0,
+    0x3, 0x46, 0x79, 0x99, 0x81, 0x0, 0x0, 0x0,
+    0x0, 0x2a, 0x0, 0x0, 0x10, 0x5, 0x65, 0x55,
+    0x9c, 0x65, 0x57, 0xc1, 0x0, 0x0, 0xa, 0x7a,
+    0x62, 0x0, 0x0, 0x0, 0x1, 0xa4, 0x1a, 0x8,
+    0x92, 0x0, 0x0, 0x57, 0x10, 0x57, 0x0, 0x4d,
+    0xd3, 0x4, 0x10, 0x5, 0xc0, 0x0, 0x0, 0x50,
+    0x7, 0x55, 0x6c, 0x65, 0x5a, 0x56, 0xa2, 0x0,
+    0x0, 0xa3, 0x0, 0x4a, 0x0, 0x0, 0x0, 0x0,
+    0x55, 0x77, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6a, 0x7d, 0xa3, 0x0, 0x0, 0x25, 0x68, 0x30,
+    0x0, 0x6e, 0x20, 0x3, 0x20, 0x0, 0x0, 0x0,
+    0x1, 0x10,
+
+    /* U+5A18 "娘" */
+    0x0, 0x2, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0xb, 0x50, 0x0, 0x1c, 0x0, 0x0, 0x0, 0xd,
+    0x0, 0x8, 0x5b, 0x59, 0x10, 0x2, 0x4b, 0x36,
+    0xb, 0x0, 0xb, 0x0, 0x3, 0x77, 0x2c, 0x1c,
+    0x55, 0x5c, 0x0, 0x0, 0x92, 0xb, 0xb, 0x0,
+    0xb, 0x0, 0x0, 0xb0, 0x28, 0xb, 0x0, 0xb,
+    0x0, 0x1, 0x90, 0x64, 0xc, 0x58, 0x59, 0x10,
+    0x4, 0x70, 0xa0, 0xb, 0x7, 0x6, 0xa0, 0x0,
+    0x39, 0xc0, 0xb, 0x7, 0x65, 0x0, 0x0, 0x9,
+    0x8c, 0xb, 0x2, 0xc1, 0x0, 0x0, 0x56, 0x4,
+    0xc, 0x83, 0x4d, 0x71, 0x5, 0x50, 0x0, 0xc,
+    0x10, 0x2, 0x81, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5A5A "婚" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0,
+    0x1d, 0x0, 0x22, 0x58, 0xb8, 0x0, 0x0, 0x48,
+    0x0, 0xb3, 0x1b, 0x0, 0x0, 0x0, 0x74, 0x2,
+    0xa1, 0x1b, 0x11, 0x50, 0x15, 0xc5, 0x88, 0xa4,
+    0x4a, 0x64, 0x40, 0x0, 0xb0, 0x74, 0xa0, 0x23,
+    0xa0, 0x40, 0x3, 0x70, 0xa1, 0xd9, 0x30, 0x5b,
+    0xb0, 0x7, 0x30, 0xb0, 0x40, 0x0, 0x6, 0xa1,
+    0xa, 0x12, 0x80, 0x97, 0x55, 0x5d, 0x10, 0x0,
+    0x6c, 0x50, 0x93, 0x0, 0xb, 0x0, 0x0, 0x29,
+    0xc4, 0x87, 0x55, 0x5c, 0x0, 0x0, 0x80, 0x16,
+    0x93, 0x0, 0xb, 0x0, 0x6, 0x0, 0x0, 0x97,
+    0x55, 0x5c, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+5A66 "婦" */
+    0x0, 0x11, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x5a, 0x0, 0x55, 0x55, 0x5d, 0x10, 0x0, 0x84,
+    0x0, 0x15, 0x55, 0x5c, 0x0, 0x12, 0xb2, 0x42,
+    0x1, 0x0, 0xb, 0x0, 0x15, 0xc3, 0xa6, 0x46,
+    0x55, 0x5c, 0x0, 0x2, 0x80, 0xb4, 0x0, 0x0,
+    0x0, 0x30, 0x7, 0x40, 0xb8, 0x55, 0x6b, 0x56,
+    0xc1, 0xa, 0x1, 0x99, 0x20, 0x1a, 0x5, 0x0,
+    0xa, 0x6, 0x50, 0xb5, 0x6b, 0x5d, 0x10, 0x0,
+    0x7e, 0x30, 0xb0, 0x1a, 0xb, 0x0, 0x0, 0x38,
+    0xc3, 0xb0, 0x1a, 0xb, 0x0, 0x1, 0x80, 0x13,
+    0xb0, 0x1a, 0x6c, 0x0, 0x15, 0x0, 0x0, 0x0,
+    0x1a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x0, 0x0,
+
+    /* U+5A92 "媒" */
+    0x0, 0x3, 0x0, 0x2, 0x0, 0x2, 0x0, 0x0,
+    0xe, 0x10, 0x1c, 0x0, 0xd, 0x0, 0x0, 0x2a,
+    0x3, 0x5c, 0x55, 0x5c, 0x91, 0x1, 0x67, 0x15,
+    0xa, 0x0, 0xb, 0x0, 0x5, 0xb5, 0x5b, 0xc,
+    0x55, 0x5b, 0x0, 0x0, 0xb0, 0x47, 0xa, 0x0,
+    0xb, 0x0, 0x1, 0xa0, 0x73, 0x1c, 0x55, 0x5b,
+    0x0, 0x4, 0x50, 0xa0, 0x2, 0x1c, 0x0, 0x0,
+    0x7, 0x30, 0xa3, 0x65, 0x8d, 0x55, 0xa0, 0x0,
+    0x4b, 0x80, 0x3, 0xbb, 0x50, 0x0, 0x0, 0x1a,
+    0x97, 0x1b, 0x2a, 0x63, 0x0, 0x0, 0x81, 0x4,
+    0x91, 0x1a, 0xa, 0x81, 0x6, 0x20, 0x36, 0x0,
+    0x1b, 0x0, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x0, 0x0,
+
+    /* U+5ABD "媽" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2c, 0x0, 0xa5, 0x58, 0x58, 0x60, 0x0, 0x67,
+    0x0, 0xb0, 0xb, 0x0, 0x0, 0x0, 0x93, 0x2,
+    0xb5, 0x5c, 0x59, 0x20, 0x26, 0xd5, 0x88, 0xb0,
+    0xb, 0x0, 0x0, 0x1, 0xa0, 0x74, 0xb5, 0x5c,
+    0x58, 0x40, 0x5, 0x60, 0xa1, 0xb0, 0xb, 0x0,
+    0x0, 0x9, 0x20, 0xb0, 0xb5, 0x5b, 0x55, 0xa2,
+    0xb, 0x3, 0x80, 0x40, 0x0, 0x20, 0xc0, 0x2,
+    0x7c, 0x50, 0x24, 0x8, 0x29, 0xc0, 0x0, 0x1a,
+    0xb4, 0x84, 0x78, 0x3a, 0xc0, 0x0, 0x80, 0x7,
+    0x72, 0x51, 0x1, 0xc0, 0x6, 0x10, 0x0, 0x0,
+    0x3, 0x9e, 0x60, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x0,
+
+    /* U+5ACC "嫌" */
+    0x0, 0x42, 0x0, 0x10, 0x0, 0x40, 0x0, 0x0,
+    0xa4, 0x0, 0xb, 0x4, 0x80, 0x0, 0x0, 0xb0,
+    0x5, 0x5a, 0x59, 0x5a, 0x40, 0x13, 0xc3, 0x73,
+    0xa, 0xa, 0x0, 0x0, 0x15, 0x92, 0xc1, 0x6c,
+    0x5c, 0x5a, 0x0, 0x5, 0x50, 0xb0, 0xa, 0xa,
+    0xa, 0x0, 0x8, 0x12, 0x85, 0x5c, 0x5c, 0x5c,
+    0x80, 0xa, 0x5, 0x40, 0xa, 0xa, 0xa, 0x0,
+    0xa, 0x19, 0x2, 0x7f, 0x5c, 0x79, 0x0, 0x0,
+    0x7d, 0x20, 0x7d, 0xa, 0x60, 0x0, 0x0, 0x84,
+    0xa3, 0x6a, 0xa, 0x27, 0x0, 0x4, 0x50, 0x16,
+    0xa, 0xa, 0x9, 0x90, 0x24, 0x0, 0x30, 0xa,
+    0xb, 0x0, 0x20, 0x0, 0x0, 0x0, 0x2, 0x1,
+    0x0, 0x0,
+
+    /* U+5B09 "嬉" */
+    0x0, 0x10, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0,
+    0x68, 0x0, 0x0, 0x2b, 0x0, 0x0, 0x0, 0x92,
+    0x3, 0x65, 0x6b, 0x57, 0x70, 0x0, 0xb0, 0x31,
+    0x12, 0x4a, 0x27, 0x0, 0x36, 0xc5, 0xb3, 0x43,
+    0x22, 0x25, 0x0, 0x4, 0x70, 0xb0, 0xa5, 0x55,
+    0x5d, 0x0, 0x8, 0x30, 0xb0, 0xa5, 0x55, 0x5c,
+    0x0, 0xb, 0x3, 0x80, 0x25, 0x10, 0x72, 0x0,
+    0xa, 0x8, 0x32, 0x26, 0x82, 0x72, 0x60, 0x5,
+    0x8d, 0x4, 0x53, 0x33, 0x36, 0x30, 0x0, 0x69,
+    0xd0, 0xb5, 0x55, 0x5d, 0x10, 0x1, 0x90, 0x30,
+    0xb0, 0x0, 0xb, 0x0, 0x17, 0x0, 0x0, 0xb5,
+    0x55, 0x5c, 0x0, 0x10, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+5B50 "子" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x16, 0x55, 0x55, 0x55, 0x7c, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xb5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x56, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0x0,
+    0x0, 0x50, 0x6, 0x55, 0x55, 0x6c, 0x55, 0x56,
+    0x92, 0x0, 0x0, 0x0, 0x1b, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x12,
+    0x3b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+5B57 "字" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5a, 0x0, 0x0, 0x0, 0x0, 0x30,
+    0x0, 0x7, 0x0, 0x2, 0x60, 0x0, 0xa5, 0x55,
+    0x55, 0x55, 0x5a, 0x90, 0x3, 0xc3, 0x55, 0x55,
+    0x56, 0x73, 0x0, 0x0, 0x0, 0x10, 0x0, 0x2b,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x3, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x70,
+    0x6, 0x55, 0x55, 0x6c, 0x55, 0x55, 0x72, 0x0,
+    0x0, 0x0, 0x1a, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0xe8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0,
+    0x0, 0x0,
+
+    /* U+5B58 "存" */
+    0x0, 0x0, 0x1, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xa0, 0x0, 0x3, 0x0, 0x6, 0x55,
+    0x5d, 0x65, 0x55, 0x6b, 0x30, 0x0, 0x0, 0x39,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa4, 0x55,
+    0x55, 0x95, 0x0, 0x0, 0x9, 0x60, 0x0, 0x4,
+    0x82, 0x0, 0x0, 0x2e, 0x10, 0x0, 0x85, 0x0,
+    0x0, 0x0, 0x9b, 0x10, 0x0, 0xc0, 0x0, 0x0,
+    0x8, 0x1a, 0x26, 0x55, 0xd5, 0x58, 0x80, 0x30,
+    0xa, 0x10, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xa,
+    0x10, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xa, 0x20,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0xb, 0x20, 0x3b,
+    0xd0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x10,
+    0x0, 0x0,
+
+    /* U+5B63 "季" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0,
+    0x0, 0x2, 0x47, 0xac, 0xc2, 0x0, 0x0, 0x3,
+    0x43, 0x3a, 0x0, 0x0, 0x0, 0x5, 0x55, 0x55,
+    0x5c, 0x55, 0x56, 0xd2, 0x0, 0x0, 0x8, 0x8a,
+    0x71, 0x0, 0x0, 0x0, 0x0, 0x95, 0x1a, 0x9,
+    0x71, 0x0, 0x0, 0x58, 0x10, 0x18, 0x0, 0x6d,
+    0xd4, 0x4, 0x11, 0x65, 0x55, 0x5c, 0xa0, 0x20,
+    0x0, 0x0, 0x0, 0x6, 0x61, 0x0, 0x0, 0x4,
+    0x55, 0x55, 0x5d, 0x55, 0x58, 0xd1, 0x1, 0x0,
+    0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xd8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+5B66 "学" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x8,
+    0x0, 0xa0, 0x0, 0xe2, 0x0, 0x0, 0x6b, 0x9,
+    0x70, 0x66, 0x0, 0x0, 0x20, 0x90, 0x32, 0x8,
+    0x0, 0x20, 0xa, 0x55, 0x55, 0x55, 0x65, 0x6f,
+    0x25, 0xa0, 0x0, 0x0, 0x1, 0x16, 0x20, 0x32,
+    0x46, 0x55, 0x55, 0xd8, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd0,
+    0x0, 0x38, 0x5, 0x65, 0x55, 0x5d, 0x55, 0x55,
+    0x51, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6e, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10,
+    0x0, 0x0, 0x0,
+
+    /* U+5B69 "孩" */
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x11, 0x15, 0x0, 0x59, 0x0, 0x0, 0x2, 0x43,
+    0x89, 0x0, 0x9, 0x0, 0x70, 0x0, 0x1, 0x62,
+    0x55, 0xd6, 0x55, 0x52, 0x0, 0xc, 0x0, 0x4,
+    0x80, 0x21, 0x0, 0x0, 0xb, 0x2, 0x8, 0x0,
+    0xc6, 0x0, 0x0, 0xc, 0x73, 0x8a, 0x68, 0xa0,
+    0x0, 0x5, 0xac, 0x0, 0x0, 0x1b, 0x8, 0x50,
+    0x1a, 0x1b, 0x0, 0x1, 0xa1, 0x3b, 0x0, 0x0,
+    0xb, 0x0, 0x38, 0x11, 0xb1, 0x0, 0x0, 0xb,
+    0x4, 0x30, 0x2b, 0x74, 0x0, 0x0, 0xb, 0x0,
+    0x6, 0x80, 0xa, 0x70, 0x2, 0xc7, 0x25, 0x61,
+    0x0, 0x1, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5B6B "孫" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x14, 0x2, 0x57, 0x9b, 0x50, 0x4, 0x55,
+    0xa9, 0x22, 0x88, 0x0, 0x0, 0x0, 0x1, 0x60,
+    0x1, 0xa0, 0x32, 0x0, 0x0, 0x2b, 0x0, 0x39,
+    0x44, 0xc4, 0x0, 0x0, 0x19, 0x0, 0x46, 0x4a,
+    0x30, 0x0, 0x0, 0x1b, 0x62, 0x1, 0x91, 0x15,
+    0x0, 0x5, 0xab, 0x0, 0x7b, 0x55, 0x58, 0x90,
+    0x9, 0x29, 0x0, 0x55, 0x2b, 0x0, 0xa0, 0x0,
+    0x19, 0x0, 0x17, 0xb, 0x30, 0x0, 0x0, 0x19,
+    0x0, 0x95, 0xb, 0xa, 0x20, 0x0, 0x29, 0x5,
+    0x40, 0xb, 0x2, 0xe0, 0x2, 0xd6, 0x11, 0x6,
+    0xe9, 0x0, 0x60, 0x0, 0x10, 0x0, 0x0, 0x20,
+    0x0, 0x0,
+
+    /* U+5B78 "學" */
+    0x0, 0x0, 0x3, 0x2, 0x20, 0x0, 0x0, 0x0,
+    0x29, 0x64, 0x3c, 0x45, 0xb4, 0x0, 0x0, 0x1b,
+    0x72, 0x44, 0x65, 0xc1, 0x0, 0x0, 0x9, 0x0,
+    0x24, 0x30, 0xa0, 0x0, 0x0, 0xc, 0x65, 0x3e,
+    0x15, 0xc0, 0x0, 0x4, 0xa, 0x0, 0x53, 0x40,
+    0xb0, 0x30, 0xa, 0x55, 0x55, 0x55, 0x55, 0x58,
+    0xb0, 0x1c, 0x3, 0x55, 0x55, 0x7b, 0x4, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0x60, 0x0, 0x0, 0x4,
+    0x55, 0x55, 0x6e, 0x55, 0x5b, 0x90, 0x1, 0x0,
+    0x0, 0x1a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xd7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+5B83 "它" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x95, 0x0, 0x0, 0x0, 0x0, 0x30,
+    0x0, 0x28, 0x0, 0x1, 0x20, 0x3, 0x95, 0x55,
+    0x55, 0x55, 0x5b, 0xb0, 0xc, 0x50, 0x0, 0x0,
+    0x0, 0x7, 0x0, 0x2, 0x0, 0xd1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x2c, 0x20,
+    0x0, 0x0, 0x0, 0xc0, 0x17, 0xa4, 0x10, 0x0,
+    0x0, 0x0, 0xd5, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0xab, 0xaa,
+    0xaa, 0xbc, 0x20,
+
+    /* U+5B85 "宅" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x85, 0x0, 0x0, 0x0, 0x0, 0x20,
+    0x0, 0x36, 0x0, 0x1, 0x20, 0x0, 0xa5, 0x55,
+    0x55, 0x55, 0x5a, 0x90, 0x3, 0xc0, 0x0, 0x3,
+    0x9d, 0x27, 0x0, 0x0, 0x34, 0x57, 0xd6, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0xc0, 0x2, 0x6e, 0x40,
+    0x0, 0x14, 0x55, 0xd5, 0x53, 0x10, 0x0, 0x6,
+    0x31, 0x0, 0xc0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0x50, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0x0, 0xa0, 0x0, 0x0, 0x0, 0xbb,
+    0xaa, 0xab, 0xc0,
+
+    /* U+5B87 "宇" */
+    0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x68, 0x0, 0x0, 0x0, 0x3, 0x0, 0x1,
+    0x70, 0x0, 0x23, 0x0, 0xa5, 0x55, 0x55, 0x55,
+    0x5b, 0x80, 0x2c, 0x0, 0x0, 0x0, 0x2, 0x50,
+    0x0, 0x5, 0x55, 0x58, 0x56, 0xa1, 0x0, 0x0,
+    0x0, 0x1, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1a, 0x0, 0x3, 0x80, 0x55, 0x55, 0x56, 0xc5,
+    0x55, 0x55, 0x10, 0x0, 0x0, 0x1a, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x10, 0x3a, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x8f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20,
+    0x0, 0x0, 0x0,
+
+    /* U+5B88 "守" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0x60, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x29, 0x0, 0x2, 0x0, 0xa, 0x55, 0x55, 0x55,
+    0x55, 0xe7, 0x4, 0xb0, 0x0, 0x0, 0xa2, 0x35,
+    0x0, 0x10, 0x0, 0x0, 0xd, 0x0, 0x20, 0x5,
+    0x55, 0x55, 0x55, 0xe5, 0x5a, 0x70, 0x0, 0x40,
+    0x0, 0xd, 0x0, 0x0, 0x0, 0x2, 0xb0, 0x0,
+    0xd0, 0x0, 0x0, 0x0, 0xb, 0x40, 0xd, 0x0,
+    0x0, 0x0, 0x0, 0x30, 0x0, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4d, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x10, 0x0, 0x0,
+
+    /* U+5B89 "安" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x58, 0x0, 0x0, 0x0, 0x0, 0x20,
+    0x0, 0x8, 0x0, 0x3, 0x10, 0x0, 0x95, 0x55,
+    0x55, 0x55, 0x5c, 0x60, 0x2, 0xb0, 0x3, 0x60,
+    0x0, 0x14, 0x0, 0x0, 0x0, 0x8, 0x50, 0x0,
+    0x0, 0x10, 0x5, 0x55, 0x5d, 0x55, 0x57, 0x59,
+    0x90, 0x0, 0x0, 0x57, 0x0, 0x1d, 0x0, 0x0,
+    0x0, 0x0, 0xb0, 0x0, 0x86, 0x0, 0x0, 0x0,
+    0x1, 0x86, 0x33, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5e, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xa2, 0x6, 0xd8, 0x0, 0x0, 0x36, 0x84, 0x0,
+    0x0, 0x1a, 0x50, 0x3, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5B8C "完" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x85, 0x0, 0x0, 0x0, 0x0, 0x40,
+    0x0, 0x26, 0x0, 0x0, 0x30, 0x0, 0xb5, 0x55,
+    0x55, 0x55, 0x58, 0xa0, 0x3, 0x80, 0x0, 0x0,
+    0x4, 0x3, 0x0, 0x0, 0x5, 0x55, 0x55, 0x55,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0x0, 0x1, 0x55, 0x59, 0x55, 0x85, 0x5a, 0x40,
+    0x0, 0x0, 0xc, 0x2, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x29, 0x2, 0xa0, 0x0, 0x10, 0x0, 0x0,
+    0x84, 0x2, 0xa0, 0x0, 0x50, 0x0, 0x2, 0xa0,
+    0x1, 0xa0, 0x0, 0x90, 0x0, 0x67, 0x0, 0x0,
+    0xba, 0xaa, 0xd3, 0x4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5B98 "官" */
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0x20, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x64, 0x0, 0x3, 0x20, 0x68, 0x55, 0x55, 0x55,
+    0x55, 0xc7, 0xd, 0x16, 0x55, 0x55, 0x59, 0x23,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0xb, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xb5,
+    0x55, 0x55, 0xb0, 0x0, 0x0, 0xb, 0x0, 0x0,
+    0x0, 0x10, 0x0, 0x0, 0xb5, 0x55, 0x55, 0x98,
+    0x0, 0x0, 0xb, 0x0, 0x0, 0x6, 0x60, 0x0,
+    0x0, 0xb0, 0x0, 0x0, 0x66, 0x0, 0x0, 0xc,
+    0x55, 0x55, 0x59, 0x50, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+5B99 "宙" */
+    0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0x20, 0x0, 0x0, 0x2, 0x0, 0x0,
+    0x54, 0x0, 0x2, 0x10, 0x95, 0x55, 0x57, 0x55,
+    0x55, 0xc7, 0x1d, 0x0, 0x0, 0xc2, 0x0, 0x14,
+    0x0, 0x1, 0x0, 0xc, 0x0, 0x1, 0x0, 0x0,
+    0x96, 0x55, 0xd5, 0x55, 0xe1, 0x0, 0x9, 0x20,
+    0xc, 0x0, 0xc, 0x0, 0x0, 0x92, 0x0, 0xc0,
+    0x0, 0xc0, 0x0, 0x9, 0x75, 0x5d, 0x55, 0x5c,
+    0x0, 0x0, 0x92, 0x0, 0xc0, 0x0, 0xc0, 0x0,
+    0x9, 0x20, 0xc, 0x0, 0xc, 0x0, 0x0, 0x97,
+    0x55, 0x55, 0x55, 0xd0, 0x0, 0x3, 0x0, 0x0,
+    0x0, 0x2, 0x0,
+
+    /* U+5B9A "定" */
+    0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x85, 0x0, 0x0, 0x0, 0x3, 0x0, 0x2,
+    0x60, 0x0, 0x13, 0x0, 0xa5, 0x55, 0x55, 0x55,
+    0x5a, 0xa0, 0x3b, 0x0, 0x0, 0x0, 0x0, 0x50,
+    0x0, 0x45, 0x55, 0x55, 0x55, 0x7c, 0x10, 0x1,
+    0x0, 0x2, 0x90, 0x0, 0x0, 0x0, 0x5, 0x70,
+    0x29, 0x0, 0x0, 0x0, 0x0, 0x87, 0x2, 0xb5,
+    0x5b, 0x50, 0x0, 0xa, 0x50, 0x29, 0x0, 0x0,
+    0x0, 0x1, 0xa4, 0x32, 0x90, 0x0, 0x0, 0x0,
+    0x82, 0x6, 0xaa, 0x10, 0x0, 0x0, 0x44, 0x0,
+    0x2, 0x8b, 0xde, 0xf9, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+5B9E "实" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6a, 0x0, 0x0, 0x0, 0x0, 0x30,
+    0x0, 0x9, 0x0, 0x1, 0x30, 0x0, 0xa5, 0x55,
+    0x55, 0x55, 0x5a, 0xc0, 0x8, 0x80, 0x65, 0x7,
+    0x70, 0x7, 0x0, 0x2, 0x0, 0xd, 0x18, 0x50,
+    0x0, 0x0, 0x0, 0x18, 0x12, 0xa, 0x30, 0x0,
+    0x0, 0x0, 0x5, 0xc0, 0xb, 0x10, 0x0, 0x0,
+    0x4, 0x55, 0x95, 0x5e, 0x55, 0x58, 0xb0, 0x1,
+    0x0, 0x0, 0x4a, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc5, 0x87, 0x10, 0x0, 0x0, 0x0, 0x2b,
+    0x40, 0x5, 0xe7, 0x0, 0x1, 0x57, 0x60, 0x0,
+    0x0, 0x2d, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5B9F "実" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0x70, 0x0, 0x0, 0x2, 0x20, 0x0,
+    0x26, 0x0, 0x5, 0x20, 0x78, 0x55, 0x56, 0x55,
+    0x55, 0xd6, 0xd, 0x20, 0x0, 0xa3, 0x0, 0x22,
+    0x0, 0x4, 0x55, 0x5c, 0x65, 0x5c, 0x10, 0x0,
+    0x10, 0x0, 0xa1, 0x0, 0x20, 0x0, 0x1, 0x55,
+    0x5c, 0x65, 0x78, 0x0, 0x4, 0x55, 0x55, 0xc6,
+    0x55, 0x6d, 0x20, 0x10, 0x0, 0x1d, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0x61, 0x70, 0x0, 0x0,
+    0x0, 0x8, 0x90, 0x3, 0xb5, 0x0, 0x1, 0x58,
+    0x30, 0x0, 0x2, 0xae, 0x40, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+5BA2 "客" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5b, 0x0, 0x0, 0x0, 0x0, 0x95,
+    0x55, 0x59, 0x55, 0x55, 0xb0, 0x5, 0x80, 0xb,
+    0x20, 0x0, 0x6, 0x60, 0x5, 0x10, 0x6c, 0x55,
+    0x5b, 0x52, 0x0, 0x0, 0x2, 0x93, 0x30, 0x6a,
+    0x0, 0x0, 0x0, 0x27, 0x0, 0x69, 0x90, 0x0,
+    0x0, 0x0, 0x30, 0x0, 0x98, 0x94, 0x0, 0x0,
+    0x0, 0x0, 0x68, 0x20, 0x7, 0xda, 0x84, 0x4,
+    0x56, 0xc5, 0x55, 0x55, 0xc4, 0x70, 0x0, 0x0,
+    0xb0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x0, 0xb0,
+    0x0, 0x0, 0xb0, 0x0, 0x0, 0x0, 0xc5, 0x55,
+    0x55, 0xb0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x10, 0x0,
+
+    /* U+5BA4 "室" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x96, 0x0, 0x0, 0x0, 0x0, 0x65,
+    0x55, 0x79, 0x55, 0x56, 0x10, 0x7, 0x50, 0x0,
+    0x0, 0x0, 0x9, 0x10, 0x6, 0x45, 0x55, 0x55,
+    0x58, 0xa0, 0x0, 0x0, 0x0, 0xa, 0x50, 0x11,
+    0x0, 0x0, 0x0, 0x1, 0x82, 0x0, 0xa, 0x40,
+    0x0, 0x0, 0x2f, 0xa8, 0x76, 0x56, 0xe0, 0x0,
+    0x0, 0x3, 0x0, 0x84, 0x0, 0x40, 0x0, 0x0,
+    0x25, 0x55, 0xb7, 0x56, 0xb0, 0x0, 0x0, 0x1,
+    0x0, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x92, 0x0, 0x0, 0x0, 0x15, 0x55, 0x55, 0xb7,
+    0x55, 0x5b, 0xa0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5BB3 "害" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x85, 0x0, 0x0, 0x0, 0x2, 0x85,
+    0x55, 0x67, 0x55, 0x59, 0x80, 0xb, 0x30, 0x0,
+    0xb2, 0x0, 0x26, 0x0, 0x1, 0x25, 0x55, 0xd5,
+    0x55, 0x92, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0,
+    0x50, 0x0, 0x0, 0x25, 0x55, 0xd5, 0x55, 0x51,
+    0x0, 0x5, 0x55, 0x55, 0xd5, 0x55, 0x59, 0x90,
+    0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0x55, 0x75, 0x55, 0xd0, 0x0, 0x0, 0xb,
+    0x0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0xb, 0x0,
+    0x0, 0x0, 0xb0, 0x0, 0x0, 0xb, 0x55, 0x55,
+    0x55, 0xb0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
+    0x50, 0x0,
+
+    /* U+5BB5 "宵" */
+    0x0, 0x0, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb4, 0x0, 0x0, 0x0, 0x7, 0x55, 0x57,
+    0x75, 0x55, 0x68, 0x3, 0x92, 0x0, 0x64, 0x1,
+    0x16, 0x40, 0x42, 0x2c, 0x2a, 0x20, 0xa5, 0x10,
+    0x0, 0x0, 0x55, 0xa1, 0x53, 0x0, 0x0, 0x0,
+    0xa5, 0x59, 0x55, 0x5c, 0x0, 0x0, 0xb, 0x0,
+    0x0, 0x0, 0xb0, 0x0, 0x0, 0xc5, 0x55, 0x55,
+    0x5b, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0xb0,
+    0x0, 0x0, 0xc5, 0x55, 0x55, 0x5b, 0x0, 0x0,
+    0xb, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0xb0,
+    0x0, 0x6, 0xc9, 0x0, 0x0, 0x2, 0x0, 0x0,
+    0x3, 0x0, 0x0,
+
+    /* U+5BB6 "家" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x95,
+    0x55, 0x58, 0x55, 0x57, 0xa0, 0x6, 0x80, 0x0,
+    0x0, 0x0, 0x7, 0x20, 0x1, 0x5, 0x55, 0x95,
+    0x57, 0x70, 0x0, 0x0, 0x0, 0x1b, 0x60, 0x0,
+    0x50, 0x0, 0x0, 0x4, 0x81, 0x92, 0x8, 0x71,
+    0x0, 0x3, 0x53, 0x6, 0x7b, 0x54, 0x0, 0x0,
+    0x0, 0x1, 0x84, 0x1e, 0x37, 0x0, 0x0, 0x1,
+    0x56, 0x2, 0xb8, 0x75, 0x60, 0x0, 0x2, 0x0,
+    0x49, 0x14, 0x80, 0x99, 0x20, 0x0, 0x37, 0x40,
+    0x6, 0x60, 0x7, 0x80, 0x14, 0x20, 0x4, 0xbd,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+5BB9 "容" */
+    0x0, 0x0, 0x1, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x87, 0x0, 0x0, 0x0, 0x0, 0x95,
+    0x55, 0x58, 0x55, 0x57, 0x70, 0x5, 0x80, 0x40,
+    0x0, 0x20, 0x8, 0x30, 0x5, 0x12, 0xc3, 0x42,
+    0x3a, 0x51, 0x0, 0x0, 0x29, 0x10, 0xd7, 0x0,
+    0xb7, 0x0, 0x2, 0x40, 0xa, 0x54, 0x40, 0x4,
+    0x0, 0x0, 0x0, 0x97, 0x0, 0x58, 0x0, 0x0,
+    0x0, 0x9, 0x90, 0x0, 0x7, 0xda, 0x61, 0x4,
+    0x71, 0xd5, 0x55, 0x5d, 0x36, 0x60, 0x0, 0x0,
+    0xc0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xd5, 0x55,
+    0x5d, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x1,
+    0x0, 0x0,
+
+    /* U+5BBF "宿" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x69, 0x0, 0x0, 0x0, 0x0, 0x85,
+    0x55, 0x59, 0x55, 0x56, 0x80, 0x3, 0x91, 0x90,
+    0x0, 0x0, 0x7, 0x40, 0x5, 0x26, 0x94, 0x55,
+    0x55, 0x56, 0xb1, 0x0, 0xb, 0x0, 0x0, 0xa3,
+    0x0, 0x0, 0x0, 0x6d, 0x0, 0x20, 0x80, 0x3,
+    0x0, 0x1, 0x8c, 0x0, 0xc5, 0x55, 0x5d, 0x0,
+    0x6, 0xc, 0x0, 0xc0, 0x0, 0xc, 0x0, 0x0,
+    0xc, 0x0, 0xc5, 0x55, 0x5c, 0x0, 0x0, 0xc,
+    0x0, 0xc0, 0x0, 0xc, 0x0, 0x0, 0xc, 0x0,
+    0xc0, 0x0, 0xc, 0x0, 0x0, 0xc, 0x0, 0xc5,
+    0x55, 0x5c, 0x0, 0x0, 0x3, 0x0, 0x20, 0x0,
+    0x2, 0x0,
+
+    /* U+5BC4 "寄" */
+    0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x92, 0x0, 0x0, 0x0, 0x9, 0x55, 0x56,
+    0x55, 0x55, 0x89, 0x6, 0x80, 0x0, 0x77, 0x0,
+    0x15, 0x0, 0x1, 0x55, 0x6d, 0x65, 0x5a, 0x20,
+    0x0, 0x0, 0x1a, 0x33, 0x85, 0x0, 0x0, 0x1,
+    0x55, 0x0, 0x0, 0x90, 0x17, 0x5, 0x55, 0x55,
+    0x55, 0x55, 0xc5, 0x61, 0x0, 0x95, 0x55, 0xa0,
+    0xc, 0x0, 0x0, 0xc, 0x0, 0xb, 0x0, 0xc0,
+    0x0, 0x0, 0xd5, 0x55, 0xb0, 0xc, 0x0, 0x0,
+    0xb, 0x0, 0x7, 0x0, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xe9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x0,
+
+    /* U+5BC6 "密" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x0, 0x95,
+    0x55, 0x59, 0x55, 0x55, 0xd1, 0x6, 0x80, 0x0,
+    0x71, 0x7, 0x15, 0x20, 0x2, 0x1, 0x49, 0x57,
+    0x8a, 0x10, 0x0, 0x0, 0x27, 0x38, 0xa, 0x61,
+    0x39, 0x0, 0x0, 0xb3, 0x3c, 0x92, 0x5, 0x9,
+    0x60, 0x0, 0x26, 0x9d, 0x99, 0x9c, 0x31, 0x10,
+    0x3, 0x20, 0x0, 0x16, 0x0, 0x0, 0x0, 0x0,
+    0x19, 0x0, 0x1b, 0x0, 0x55, 0x0, 0x0, 0xa,
+    0x0, 0xa, 0x0, 0x65, 0x0, 0x0, 0x1a, 0x0,
+    0xa, 0x0, 0x65, 0x0, 0x0, 0x28, 0x55, 0x56,
+    0x55, 0x95, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5BCC "富" */
+    0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xc0, 0x0, 0x0, 0x8, 0x55, 0x55, 0x85,
+    0x55, 0x97, 0x49, 0x0, 0x0, 0x0, 0x41, 0x81,
+    0x10, 0x35, 0x55, 0x55, 0x53, 0x0, 0x0, 0xa,
+    0x55, 0x55, 0xb2, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0xb0, 0x0, 0x0, 0xb, 0x55, 0x55, 0x90, 0x0,
+    0x0, 0x85, 0x55, 0x55, 0x59, 0x20, 0x0, 0xc0,
+    0x1, 0xa0, 0xb, 0x0, 0x0, 0xd5, 0x55, 0xc5,
+    0x5d, 0x0, 0x0, 0xc0, 0x1, 0xa0, 0xb, 0x0,
+    0x0, 0xd5, 0x55, 0x75, 0x5d, 0x10, 0x0, 0x20,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+5BD2 "寒" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x10, 0x0, 0x39, 0x0, 0x0, 0x10, 0x1, 0x95,
+    0x55, 0x57, 0x55, 0x56, 0xd0, 0xa, 0x30, 0x1a,
+    0x0, 0xb1, 0x14, 0x10, 0x0, 0x45, 0x6c, 0x55,
+    0xc5, 0x93, 0x0, 0x0, 0x0, 0x1a, 0x0, 0xb0,
+    0x51, 0x0, 0x0, 0x25, 0x6c, 0x55, 0xc5, 0x52,
+    0x0, 0x4, 0x55, 0x6c, 0x55, 0xc5, 0x58, 0xc0,
+    0x0, 0x0, 0x68, 0x0, 0x42, 0x0, 0x0, 0x0,
+    0x3, 0xa0, 0x78, 0x8, 0x40, 0x0, 0x0, 0x38,
+    0x0, 0x7, 0x0, 0x9d, 0x81, 0x4, 0x30, 0x15,
+    0x87, 0x20, 0x2, 0x30, 0x0, 0x0, 0x0, 0x5,
+    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5BDD "寝" */
+    0x0, 0x0, 0x2, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0x50, 0x0, 0x0, 0x2, 0x85, 0x55,
+    0x66, 0x55, 0x5a, 0x30, 0x84, 0x30, 0x0, 0x0,
+    0x2, 0x50, 0x3, 0xb, 0x12, 0x65, 0x55, 0xc1,
+    0x0, 0x71, 0xb0, 0x5, 0x55, 0x5c, 0x0, 0x4,
+    0x8b, 0x2, 0x65, 0x55, 0xc0, 0x0, 0x1, 0xb0,
+    0x53, 0x33, 0x34, 0x60, 0x2, 0x8c, 0x38, 0x11,
+    0x12, 0x59, 0x13, 0xb0, 0xb3, 0x27, 0x65, 0x99,
+    0x0, 0x0, 0xb, 0x0, 0x7, 0x2a, 0x0, 0x0,
+    0x0, 0xb0, 0x0, 0x4f, 0x30, 0x0, 0x0, 0xb,
+    0x1, 0x65, 0x17, 0xba, 0x60, 0x0, 0x32, 0x20,
+    0x0, 0x0, 0x20,
+
+    /* U+5BDF "察" */
+    0x0, 0x0, 0x0, 0x31, 0x0, 0x0, 0x0, 0x0,
+    0x10, 0x0, 0xc, 0x0, 0x0, 0x20, 0x0, 0x95,
+    0x65, 0x55, 0x55, 0x56, 0xd2, 0x6, 0x71, 0xd1,
+    0x11, 0x10, 0x5, 0x10, 0x0, 0xa, 0x75, 0xd5,
+    0x85, 0x5d, 0x50, 0x0, 0x57, 0x93, 0xa0, 0x52,
+    0x54, 0x0, 0x2, 0x82, 0x5a, 0x10, 0x1a, 0x50,
+    0x0, 0x1, 0x8, 0x96, 0x55, 0x74, 0xb7, 0x10,
+    0x0, 0x18, 0x10, 0x0, 0x0, 0x89, 0xd2, 0x4,
+    0x45, 0x55, 0x6c, 0x55, 0x52, 0x0, 0x0, 0x0,
+    0xb4, 0x1a, 0x16, 0x10, 0x0, 0x0, 0x19, 0x30,
+    0x1a, 0x0, 0xb6, 0x0, 0x3, 0x60, 0x6, 0xc9,
+    0x0, 0x1b, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0,
+    0x0, 0x0,
+
+    /* U+5BE6 "實" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x58, 0x0, 0x0, 0x0, 0x0, 0x84,
+    0x44, 0x47, 0x44, 0x48, 0x60, 0x1, 0xb3, 0x55,
+    0x55, 0x55, 0x87, 0x0, 0x2, 0x28, 0x52, 0x67,
+    0x22, 0xb5, 0x80, 0x5, 0x3b, 0x43, 0x95, 0x36,
+    0x93, 0x30, 0x0, 0x9, 0x55, 0x65, 0x57, 0x50,
+    0x0, 0x0, 0xa, 0x55, 0x55, 0x55, 0xd0, 0x0,
+    0x0, 0xb, 0x55, 0x55, 0x55, 0xb0, 0x0, 0x0,
+    0xb, 0x55, 0x55, 0x55, 0xb0, 0x0, 0x0, 0xb,
+    0x55, 0x55, 0x55, 0xb0, 0x0, 0x0, 0x3, 0x29,
+    0x0, 0x56, 0x40, 0x0, 0x0, 0x37, 0x72, 0x0,
+    0x3, 0xc7, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0,
+    0x3, 0x0,
+
+    /* U+5BEB "寫" */
+    0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x76, 0x0, 0x0, 0x0, 0x8, 0x55, 0x56,
+    0x95, 0x55, 0x67, 0x7, 0x50, 0x5, 0x40, 0x0,
+    0x26, 0x40, 0x61, 0xa5, 0x41, 0x46, 0x5d, 0x20,
+    0x0, 0xc, 0x58, 0x31, 0x55, 0xb0, 0x0, 0x0,
+    0xb0, 0x0, 0x1, 0xb, 0x0, 0x0, 0xc, 0x8a,
+    0x55, 0x55, 0xa0, 0x0, 0x0, 0x1d, 0x65, 0x55,
+    0x55, 0x91, 0x0, 0x38, 0x10, 0x2, 0x14, 0xb,
+    0x0, 0x23, 0x60, 0x80, 0x91, 0xb1, 0xb0, 0x0,
+    0x2c, 0x8, 0x24, 0x12, 0x39, 0x0, 0x1, 0x20,
+    0x0, 0x4, 0xad, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x20, 0x0,
+
+    /* U+5BFA "寺" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd1, 0x0, 0x0, 0x0, 0x1, 0x55,
+    0x55, 0xe5, 0x55, 0x99, 0x0, 0x0, 0x10, 0x0,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd0,
+    0x0, 0x1, 0x40, 0x36, 0x55, 0x55, 0x85, 0x66,
+    0x57, 0x91, 0x0, 0x0, 0x0, 0x0, 0x2d, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0x6, 0x30,
+    0x6, 0x57, 0x55, 0x55, 0x6c, 0x55, 0x40, 0x0,
+    0x1, 0xb0, 0x0, 0x2b, 0x0, 0x0, 0x0, 0x0,
+    0xa5, 0x0, 0x2b, 0x0, 0x0, 0x0, 0x0, 0x20,
+    0x0, 0x2a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28,
+    0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40,
+    0x0, 0x0,
+
+    /* U+5BFE "対" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x63, 0x0, 0x0, 0x0, 0xc1, 0x0, 0x0, 0x1e,
+    0x10, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x6, 0x4,
+    0x0, 0x0, 0xc0, 0x0, 0x6, 0x55, 0xc7, 0x35,
+    0x55, 0xd5, 0xb0, 0x0, 0x0, 0xd0, 0x1, 0x0,
+    0xc0, 0x0, 0x3, 0x21, 0xb0, 0x33, 0x0, 0xc0,
+    0x0, 0x0, 0x5a, 0x60, 0xc, 0x20, 0xc0, 0x0,
+    0x0, 0xc, 0x90, 0x7, 0x60, 0xc0, 0x0, 0x0,
+    0x47, 0xa8, 0x0, 0x0, 0xc0, 0x0, 0x1, 0x90,
+    0x1c, 0x0, 0x0, 0xc0, 0x0, 0x18, 0x0, 0x0,
+    0x1, 0x32, 0xd0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x3d, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0,
+
+    /* U+5C04 "射" */
+    0x0, 0x1, 0x20, 0x0, 0x0, 0x30, 0x0, 0x0,
+    0x6, 0x40, 0x0, 0x0, 0xc2, 0x0, 0x0, 0xa7,
+    0x5b, 0x20, 0x0, 0xc0, 0x0, 0x0, 0xc0, 0xb,
+    0x10, 0x0, 0xc0, 0x10, 0x0, 0xd5, 0x5c, 0x46,
+    0x55, 0xd6, 0xa0, 0x0, 0xc0, 0xb, 0x10, 0x0,
+    0xc0, 0x0, 0x0, 0xd5, 0x5c, 0x15, 0x10, 0xc0,
+    0x0, 0x0, 0xc0, 0xb, 0x12, 0xc0, 0xc0, 0x0,
+    0x16, 0x86, 0xac, 0x10, 0xc0, 0xc0, 0x0, 0x0,
+    0x9, 0x4b, 0x10, 0x0, 0xc0, 0x0, 0x0, 0x48,
+    0xb, 0x10, 0x0, 0xc0, 0x0, 0x2, 0x80, 0xb,
+    0x10, 0x0, 0xc0, 0x0, 0x15, 0x2, 0xad, 0x0,
+    0x6d, 0xc0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x0,
+
+    /* U+5C07 "將" */
+    0x0, 0x0, 0x20, 0x0, 0x20, 0x0, 0x0, 0x2,
+    0x0, 0xd0, 0x1, 0xe1, 0x0, 0x0, 0xb, 0x10,
+    0xb0, 0x9, 0x85, 0x5b, 0x60, 0xb, 0x0, 0xb0,
+    0x58, 0x70, 0x3c, 0x10, 0xc, 0x55, 0xb3, 0x75,
+    0x74, 0xb1, 0x0, 0x3, 0x0, 0xb0, 0x8, 0x2a,
+    0x20, 0x0, 0x0, 0x0, 0xb0, 0x6, 0x80, 0xb1,
+    0x0, 0x17, 0x95, 0xb3, 0x51, 0x0, 0xb1, 0x60,
+    0x0, 0xc0, 0xb5, 0x65, 0x55, 0xc5, 0x50, 0x0,
+    0xb0, 0xb0, 0x64, 0x0, 0xb0, 0x0, 0x3, 0x80,
+    0xb0, 0x1d, 0x0, 0xb0, 0x0, 0x8, 0x20, 0xb0,
+    0x3, 0x0, 0xb0, 0x0, 0x35, 0x0, 0xc0, 0x1,
+    0x7d, 0xc0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x2,
+    0x10, 0x0,
+
+    /* U+5C08 "專" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0x30, 0x3, 0x50, 0x0, 0x65, 0x55,
+    0xc5, 0x55, 0x55, 0x0, 0x0, 0xa5, 0x5c, 0x55,
+    0x79, 0x0, 0x0, 0xc, 0x0, 0xb1, 0x4, 0x80,
+    0x0, 0x0, 0xc5, 0x5c, 0x55, 0x78, 0x0, 0x0,
+    0xc, 0x55, 0xc5, 0x57, 0x80, 0x0, 0x0, 0x30,
+    0xb, 0x22, 0x97, 0x0, 0x0, 0xac, 0xa8, 0x76,
+    0x84, 0x96, 0x0, 0x45, 0x55, 0x55, 0x5c, 0x75,
+    0xd7, 0x1, 0x3, 0x40, 0x0, 0xa2, 0x0, 0x0,
+    0x0, 0xb, 0x30, 0xa, 0x20, 0x0, 0x0, 0x0,
+    0x30, 0x3a, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x0,
+
+    /* U+5C0D "對" */
+    0x0, 0x3, 0x3, 0x0, 0x0, 0x2, 0x0, 0x1,
+    0xc, 0xc, 0x1, 0x0, 0xd, 0x0, 0x8, 0x4a,
+    0xa, 0x67, 0x0, 0xb, 0x0, 0x2, 0x4a, 0xc,
+    0x42, 0x0, 0xb, 0x0, 0x16, 0x58, 0x59, 0x5a,
+    0x10, 0xb, 0x51, 0x0, 0x72, 0xb, 0x10, 0x65,
+    0x5c, 0x52, 0x0, 0x38, 0x25, 0x22, 0x30, 0xb,
+    0x0, 0x4, 0x66, 0xa5, 0x70, 0xb3, 0xb, 0x0,
+    0x0, 0x2, 0x90, 0x0, 0x59, 0xb, 0x0, 0x1,
+    0x66, 0xb6, 0x90, 0x1, 0xb, 0x0, 0x0, 0x2,
+    0x90, 0x0, 0x0, 0xb, 0x0, 0x0, 0x2, 0xa3,
+    0x42, 0x1, 0x1b, 0x0, 0xb, 0xb8, 0x52, 0x0,
+    0x5, 0xe8, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0x10, 0x0,
+
+    /* U+5C0E "導" */
+    0x0, 0x10, 0x0, 0x30, 0x2, 0x0, 0x0, 0x0,
+    0x94, 0x0, 0x2a, 0x8, 0x31, 0x0, 0x0, 0x38,
+    0x46, 0x58, 0x77, 0x59, 0x60, 0x1, 0x26, 0x9,
+    0x57, 0x55, 0x86, 0x0, 0x1, 0x3c, 0xb, 0x55,
+    0x55, 0x95, 0x0, 0x0, 0xb, 0xb, 0x44, 0x44,
+    0x95, 0x0, 0x0, 0xb, 0xb, 0x55, 0x55, 0x95,
+    0x0, 0x1, 0x76, 0x89, 0x21, 0x11, 0x34, 0x41,
+    0x2, 0x40, 0x4, 0x79, 0xac, 0xab, 0x70, 0x4,
+    0x55, 0x55, 0x55, 0x5e, 0x5a, 0xb0, 0x1, 0x1,
+    0x40, 0x0, 0xb, 0x0, 0x0, 0x0, 0x0, 0xa3,
+    0x0, 0xb, 0x0, 0x0, 0x0, 0x0, 0x20, 0x5,
+    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30,
+    0x0, 0x0,
+
+    /* U+5C0F "小" */
+    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0x0, 0x8, 0x10, 0xc0, 0x30, 0x0, 0x0, 0x1e,
+    0x20, 0xc0, 0x46, 0x0, 0x0, 0x95, 0x0, 0xc0,
+    0x9, 0x70, 0x2, 0x90, 0x0, 0xc0, 0x0, 0xe5,
+    0x8, 0x0, 0x0, 0xc0, 0x0, 0x6c, 0x51, 0x0,
+    0x0, 0xc0, 0x0, 0x6, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0x0, 0x1, 0x45, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x4e, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x0,
+
+    /* U+5C11 "少" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa2, 0x0, 0x0, 0x0, 0x0, 0x34, 0xa, 0x22,
+    0x10, 0x0, 0x0, 0xa, 0x90, 0xa2, 0x7, 0x91,
+    0x0, 0x2, 0xc0, 0xa, 0x20, 0x7, 0xe2, 0x0,
+    0xa2, 0x0, 0xa2, 0x0, 0xa, 0x80, 0x54, 0x0,
+    0xa, 0x20, 0x29, 0x12, 0x24, 0x0, 0x0, 0xa3,
+    0x1d, 0xa1, 0x0, 0x0, 0x0, 0x1, 0x2d, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x6c, 0x30, 0x0, 0x0,
+    0x0, 0x5, 0xb7, 0x0, 0x0, 0x0, 0x3, 0x68,
+    0x40, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+5C1A "尚" */
+    0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x11, 0x0,
+    0xd, 0x0, 0x5, 0x0, 0x9, 0x60, 0xc, 0x0,
+    0x4d, 0x10, 0x0, 0xe3, 0xc, 0x0, 0xa1, 0x0,
+    0x20, 0x40, 0xc, 0x5, 0x20, 0x20, 0xc5, 0x55,
+    0x57, 0x56, 0x56, 0xc0, 0xc0, 0x2, 0x0, 0x3,
+    0x2, 0xa0, 0xc0, 0xc, 0x55, 0x5c, 0x2, 0xa0,
+    0xc0, 0xb, 0x0, 0xb, 0x2, 0xa0, 0xc0, 0xb,
+    0x0, 0xb, 0x2, 0xa0, 0xc0, 0xc, 0x55, 0x5b,
+    0x2, 0xa0, 0xc0, 0x4, 0x0, 0x3, 0x24, 0xa0,
+    0xc0, 0x0, 0x0, 0x1, 0x7f, 0x50, 0x10, 0x0,
+    0x0, 0x0, 0x2, 0x0,
+
+    /* U+5C24 "尤" */
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0x60, 0x66, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x30, 0xa, 0x90, 0x0, 0x0, 0x0, 0x8,
+    0x30, 0x0, 0x44, 0x0, 0x6, 0x55, 0x5b, 0x78,
+    0x55, 0x5b, 0x50, 0x0, 0x0, 0x9, 0x3a, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0x2a, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xa, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xa, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x48, 0xa, 0x10, 0x0, 0x10, 0x0, 0x0,
+    0xb1, 0xa, 0x10, 0x0, 0x50, 0x0, 0x9, 0x40,
+    0xa, 0x20, 0x1, 0x80, 0x1, 0x82, 0x0, 0x6,
+    0xdb, 0xbc, 0xb0, 0x13, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5C31 "就" */
+    0x0, 0x1, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x3, 0x90, 0x0, 0xb1, 0x30, 0x0, 0x0, 0x0,
+    0x70, 0x21, 0xb0, 0x4a, 0x0, 0x5, 0x55, 0x55,
+    0x52, 0xb0, 0x6, 0x0, 0x0, 0x75, 0x55, 0x74,
+    0xc5, 0x56, 0x90, 0x0, 0xb0, 0x0, 0xb0, 0xb4,
+    0x60, 0x0, 0x0, 0xb0, 0x0, 0xb0, 0xb4, 0x60,
+    0x0, 0x0, 0xc5, 0xb5, 0xa0, 0xb4, 0x60, 0x0,
+    0x0, 0x30, 0xa1, 0x0, 0xb4, 0x60, 0x0, 0x0,
+    0xc1, 0xa2, 0x82, 0x84, 0x60, 0x0, 0x5, 0x40,
+    0xa0, 0x98, 0x24, 0x60, 0x40, 0x6, 0x0, 0xa0,
+    0x8, 0x4, 0x60, 0x80, 0x10, 0x3b, 0x90, 0x70,
+    0x2, 0xca, 0xd0, 0x0, 0x1, 0x2, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+5C3A "尺" */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0,
+    0xd, 0x55, 0x55, 0x55, 0x5d, 0x0, 0x0, 0xd,
+    0x0, 0x0, 0x0, 0x1b, 0x0, 0x0, 0xd, 0x0,
+    0x0, 0x0, 0x1b, 0x0, 0x0, 0xd, 0x55, 0x57,
+    0x55, 0x5b, 0x0, 0x0, 0xd, 0x0, 0x6, 0x0,
+    0x4, 0x0, 0x0, 0xc, 0x0, 0x7, 0x10, 0x0,
+    0x0, 0x0, 0xb, 0x0, 0x1, 0x70, 0x0, 0x0,
+    0x0, 0x38, 0x0, 0x0, 0x93, 0x0, 0x0, 0x0,
+    0x82, 0x0, 0x0, 0x1d, 0x40, 0x0, 0x2, 0x80,
+    0x0, 0x0, 0x2, 0xe9, 0x20, 0x7, 0x0, 0x0,
+    0x0, 0x0, 0x1b, 0xe3, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+5C40 "局" */
+    0x0, 0x8, 0x55, 0x55, 0x55, 0x5a, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0xd, 0x55,
+    0x55, 0x55, 0x59, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x0, 0x0, 0x30, 0x0, 0xd, 0x55, 0x55, 0x55,
+    0x55, 0xd0, 0x0, 0x1a, 0x7, 0x55, 0x58, 0x0,
+    0xc0, 0x0, 0x28, 0xb, 0x0, 0xb, 0x0, 0xc0,
+    0x0, 0x64, 0xb, 0x0, 0xb, 0x0, 0xc0, 0x0,
+    0x90, 0xc, 0x55, 0x5a, 0x1, 0xb0, 0x1, 0x60,
+    0x2, 0x0, 0x2, 0x14, 0xa0, 0x5, 0x0, 0x0,
+    0x0, 0x1, 0x8f, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+5C45 "居" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x65, 0x55, 0x55, 0x56, 0xa0, 0x0, 0x83, 0x0,
+    0x0, 0x0, 0x38, 0x0, 0x8, 0x75, 0x55, 0x55,
+    0x57, 0x90, 0x0, 0x83, 0x0, 0x9, 0x10, 0x13,
+    0x0, 0x8, 0x30, 0x0, 0xc0, 0x0, 0x11, 0x0,
+    0x87, 0x65, 0x5d, 0x55, 0x58, 0x60, 0xa, 0x10,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0xa0, 0x20, 0xc,
+    0x0, 0x40, 0x0, 0xa, 0xc, 0x66, 0x66, 0x6d,
+    0x10, 0x3, 0x50, 0xc0, 0x0, 0x0, 0xc0, 0x0,
+    0x70, 0xc, 0x0, 0x0, 0xc, 0x0, 0x23, 0x0,
+    0xc5, 0x55, 0x55, 0xc0, 0x0, 0x0, 0x2, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+5C4A "届" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x65, 0x55, 0x55, 0x55, 0xc0, 0x0, 0x83, 0x0,
+    0x0, 0x0, 0xc, 0x0, 0x8, 0x75, 0x55, 0x55,
+    0x55, 0xc0, 0x0, 0x83, 0x0, 0x0, 0x30, 0x5,
+    0x0, 0x8, 0x30, 0x0, 0xd, 0x0, 0x0, 0x0,
+    0x82, 0x65, 0x55, 0xd5, 0x59, 0x30, 0xa, 0x1b,
+    0x10, 0xc, 0x0, 0xa1, 0x0, 0xa0, 0xb1, 0x0,
+    0xc0, 0xa, 0x10, 0xa, 0xa, 0x65, 0x5d, 0x55,
+    0xc1, 0x3, 0x60, 0xa1, 0x0, 0xc0, 0xa, 0x10,
+    0x70, 0xb, 0x65, 0x5d, 0x55, 0xc1, 0x14, 0x0,
+    0x91, 0x0, 0x0, 0x7, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+5C4B "屋" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x97, 0x55, 0x55, 0x55, 0x5e, 0x0, 0x0, 0x83,
+    0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x87, 0x55,
+    0x55, 0x55, 0x5c, 0x0, 0x0, 0x83, 0x0, 0x0,
+    0x0, 0x5, 0x0, 0x0, 0x84, 0x65, 0x78, 0x55,
+    0x68, 0x10, 0x0, 0x92, 0x0, 0xb5, 0x6, 0x10,
+    0x0, 0x0, 0xa1, 0x38, 0x10, 0x2, 0xd5, 0x0,
+    0x0, 0xc0, 0x8a, 0x8b, 0x74, 0x4b, 0x0, 0x0,
+    0xb0, 0x0, 0xa, 0x20, 0x13, 0x0, 0x3, 0x60,
+    0x56, 0x5c, 0x65, 0x66, 0x0, 0x8, 0x0, 0x0,
+    0xa, 0x10, 0x0, 0x0, 0x15, 0x5, 0x55, 0x5c,
+    0x65, 0x58, 0xc0, 0x10, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5C55 "展" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x86, 0x55, 0x55, 0x55, 0x5d, 0x0, 0x0, 0x83,
+    0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x87, 0x55,
+    0x55, 0x55, 0x5c, 0x0, 0x0, 0x83, 0x3, 0xa0,
+    0x1a, 0x2, 0x0, 0x0, 0x97, 0x57, 0xb5, 0x6b,
+    0x69, 0x0, 0x0, 0x92, 0x3, 0x80, 0x1a, 0x0,
+    0x0, 0x0, 0xa1, 0x3, 0x80, 0x1a, 0x5, 0x50,
+    0x0, 0xb5, 0x5c, 0x59, 0x55, 0x75, 0x40, 0x0,
+    0xb0, 0xb, 0x5, 0x32, 0xb3, 0x0, 0x2, 0x70,
+    0xb, 0x0, 0xa7, 0x0, 0x0, 0x7, 0x10, 0xb,
+    0x55, 0x1b, 0x83, 0x10, 0x15, 0x0, 0x1e, 0x40,
+    0x0, 0x6d, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5C65 "履" */
+    0x0, 0x10, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0xa6, 0x55, 0x55, 0x55, 0x5c, 0x10, 0x0, 0x96,
+    0x55, 0x55, 0x55, 0x5c, 0x0, 0x0, 0x91, 0x27,
+    0x9, 0x30, 0x5, 0x0, 0x0, 0x91, 0x92, 0xc,
+    0x55, 0x58, 0x20, 0x0, 0x95, 0x46, 0x6b, 0x55,
+    0x5b, 0x0, 0x0, 0xa2, 0x69, 0x5a, 0x55, 0x5a,
+    0x0, 0x0, 0xa0, 0xc1, 0xa, 0x0, 0xa, 0x0,
+    0x0, 0xa6, 0xc1, 0x7, 0xc6, 0x56, 0x0, 0x0,
+    0x92, 0xa0, 0x5, 0xc5, 0x78, 0x0, 0x3, 0x50,
+    0xa0, 0x35, 0x42, 0xb2, 0x0, 0x7, 0x0, 0xa0,
+    0x20, 0x3d, 0x80, 0x0, 0x13, 0x0, 0x91, 0x47,
+    0x50, 0x5b, 0xa0, 0x0, 0x0, 0x2, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5C6C "屬" */
+    0x0, 0x20, 0x0, 0x0, 0x0, 0x3, 0x0, 0x9,
+    0x75, 0x55, 0x55, 0x55, 0xc0, 0x0, 0x97, 0x55,
+    0x56, 0x55, 0x6b, 0x0, 0x9, 0x23, 0x91, 0x92,
+    0x57, 0x10, 0x0, 0x96, 0x76, 0x39, 0x15, 0x87,
+    0x0, 0x9, 0x47, 0x55, 0x75, 0x55, 0xa0, 0x0,
+    0xa2, 0x70, 0x90, 0x90, 0xa, 0x0, 0xb, 0x19,
+    0x84, 0x44, 0x44, 0x60, 0x0, 0xa0, 0x96, 0x57,
+    0x55, 0x5a, 0x40, 0x9, 0x57, 0x55, 0xb5, 0x91,
+    0x91, 0x5, 0x40, 0x95, 0x5a, 0x5c, 0xa, 0x0,
+    0x70, 0x4, 0x23, 0xa5, 0x81, 0xa0, 0x14, 0x0,
+    0x85, 0x31, 0x6, 0x9a, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x0,
+
+    /* U+5C71 "山" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x20, 0x0, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0,
+    0x8, 0x10, 0xc, 0x0, 0x0, 0xa1, 0xc, 0x0,
+    0xc, 0x0, 0x0, 0xc0, 0xc, 0x0, 0xc, 0x0,
+    0x0, 0xc0, 0xc, 0x0, 0xc, 0x0, 0x0, 0xc0,
+    0xc, 0x0, 0xc, 0x0, 0x0, 0xc0, 0xc, 0x0,
+    0xc, 0x0, 0x0, 0xc0, 0xc, 0x0, 0xc, 0x0,
+    0x0, 0xc0, 0xe, 0x55, 0x5a, 0x55, 0x55, 0xc0,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x80,
+
+    /* U+5CF6 "島" */
+    0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x90, 0x0, 0x0, 0x0, 0x0, 0x86, 0x56,
+    0x55, 0x5c, 0x30, 0x0, 0x9, 0x75, 0x55, 0x55,
+    0xc0, 0x0, 0x0, 0x93, 0x0, 0x0, 0xa, 0x0,
+    0x0, 0x9, 0x75, 0x55, 0x55, 0xb0, 0x0, 0x0,
+    0x97, 0x55, 0x55, 0x55, 0x59, 0x70, 0x9, 0x30,
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x76, 0x57, 0x55,
+    0x55, 0x5d, 0x10, 0x51, 0x0, 0xd0, 0x5, 0x0,
+    0xb0, 0xb, 0x0, 0xb, 0x0, 0xb1, 0xb, 0x0,
+    0xb5, 0x55, 0x95, 0x5b, 0x2, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x5b, 0xd3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x11, 0x0,
+
+    /* U+5D4C "嵌" */
+    0x0, 0x0, 0x0, 0x31, 0x0, 0x0, 0x0, 0x0,
+    0x71, 0x0, 0x85, 0x0, 0x18, 0x0, 0x0, 0xb0,
+    0x0, 0x74, 0x0, 0x1a, 0x0, 0x0, 0xb5, 0x55,
+    0x76, 0x55, 0x5a, 0x0, 0x0, 0x71, 0x8, 0x10,
+    0x59, 0x0, 0x0, 0x0, 0xb0, 0xb, 0x41, 0xa3,
+    0x0, 0x50, 0x6, 0xc5, 0x5c, 0x54, 0xb5, 0x57,
+    0xb0, 0x0, 0xb0, 0xb, 0x8, 0x1c, 0x25, 0x0,
+    0x0, 0xb5, 0x5c, 0x12, 0xe, 0x20, 0x0, 0x0,
+    0xb0, 0xb, 0x0, 0x58, 0x60, 0x0, 0x0, 0xb0,
+    0xb, 0x0, 0xa2, 0x72, 0x0, 0x0, 0xb5, 0x5d,
+    0x5, 0x70, 0xc, 0x30, 0x0, 0x80, 0x4, 0x64,
+    0x0, 0x3, 0xe4, 0x0, 0x0, 0x2, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5DDD "川" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa3, 0x0, 0x0, 0x0, 0xd1, 0x0, 0xa, 0x10,
+    0xb, 0x20, 0xc, 0x0, 0x0, 0xa1, 0x0, 0xc0,
+    0x0, 0xc0, 0x0, 0xa, 0x10, 0xc, 0x0, 0xc,
+    0x0, 0x0, 0xb0, 0x0, 0xc0, 0x0, 0xc0, 0x0,
+    0xb, 0x0, 0xc, 0x0, 0xc, 0x0, 0x0, 0xb0,
+    0x0, 0xc0, 0x0, 0xc0, 0x0, 0xa, 0x0, 0xc,
+    0x0, 0xc, 0x0, 0x3, 0x70, 0x0, 0xc0, 0x0,
+    0xc0, 0x0, 0x71, 0x0, 0xa, 0x0, 0xc, 0x0,
+    0x7, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x5, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x10,
+
+    /* U+5DDE "州" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x27, 0x0, 0x20, 0x1, 0xc0, 0x0, 0x2, 0x90,
+    0x9, 0x40, 0x1a, 0x0, 0x0, 0x29, 0x0, 0x92,
+    0x1, 0xa0, 0x0, 0x3, 0x80, 0x9, 0x20, 0xa,
+    0x0, 0x6, 0x47, 0x80, 0x92, 0x91, 0xa0, 0x2,
+    0xa5, 0x66, 0x79, 0x29, 0x4a, 0x0, 0x74, 0x65,
+    0x23, 0x92, 0x21, 0xa0, 0x0, 0x9, 0x20, 0x9,
+    0x20, 0xa, 0x0, 0x0, 0xc0, 0x0, 0x92, 0x0,
+    0xa0, 0x0, 0x38, 0x0, 0x9, 0x20, 0xa, 0x0,
+    0x9, 0x0, 0x0, 0x71, 0x1, 0xa0, 0x5, 0x30,
+    0x0, 0x0, 0x0, 0x1b, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+5DE5 "工" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3,
+    0x65, 0x55, 0x75, 0x55, 0x8b, 0x0, 0x0, 0x0,
+    0x0, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa2, 0x0, 0x1, 0x0, 0x15, 0x55,
+    0x55, 0xc7, 0x55, 0x5e, 0x80, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+5DE6 "左" */
+    0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0x0, 0x0, 0x16, 0x0, 0x46, 0x56, 0xc5, 0x55,
+    0x56, 0x81, 0x0, 0x0, 0x66, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xb0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x76,
+    0x55, 0xb5, 0x58, 0x10, 0x0, 0x1a, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0x8, 0x10, 0x0, 0xc0, 0x0,
+    0x0, 0x4, 0x40, 0x0, 0xc, 0x0, 0x0, 0x2,
+    0x40, 0x0, 0x0, 0xc0, 0x0, 0x70, 0x0, 0x17,
+    0x55, 0x56, 0x55, 0x56, 0x30,
+
+    /* U+5DEE "差" */
+    0x0, 0x1, 0x10, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x0, 0xa5, 0x0, 0xc, 0x40, 0x0, 0x0, 0x0,
+    0x17, 0x0, 0x44, 0x3, 0x50, 0x0, 0x55, 0x55,
+    0xb6, 0x55, 0x56, 0x60, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0x24, 0x0, 0x0, 0x25, 0x56, 0xc5, 0x55,
+    0x55, 0x0, 0x0, 0x0, 0x6, 0x50, 0x0, 0x3,
+    0x80, 0x4, 0x55, 0x5d, 0x55, 0x55, 0x55, 0x51,
+    0x0, 0x0, 0x56, 0x0, 0x0, 0x11, 0x0, 0x0,
+    0x1, 0x95, 0x56, 0xa5, 0x66, 0x0, 0x0, 0x18,
+    0x0, 0x2, 0xa0, 0x0, 0x0, 0x1, 0x70, 0x0,
+    0x2, 0xa0, 0x0, 0x0, 0x3, 0x4, 0x55, 0x56,
+    0xc5, 0x56, 0xd1, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5DF1 "己" */
+    0x0, 0x0, 0x0, 0x0, 0x5, 0x0, 0x0, 0x65,
+    0x55, 0x55, 0x55, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0x3, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0xb5, 0x55, 0x55, 0x55, 0xd0, 0x0, 0xb,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0x10, 0x0, 0x0,
+    0x0, 0x5, 0x0, 0xb1, 0x0, 0x0, 0x0, 0x0,
+    0x70, 0xa, 0x52, 0x22, 0x22, 0x22, 0x6e, 0x0,
+    0x29, 0x99, 0x99, 0x99, 0x99, 0x50,
+
+    /* U+5DF2 "已" */
+    0x4, 0x55, 0x55, 0x55, 0x5b, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x5, 0x10, 0x0, 0x0, 0xc, 0x0,
+    0xb, 0x65, 0x55, 0x55, 0x5c, 0x0, 0xb, 0x10,
+    0x0, 0x0, 0x9, 0x0, 0xb, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0x10, 0x0, 0x0, 0x0, 0x10,
+    0xb, 0x10, 0x0, 0x0, 0x0, 0x50, 0xb, 0x10,
+    0x0, 0x0, 0x0, 0x62, 0xa, 0x42, 0x22, 0x22,
+    0x22, 0xb8, 0x2, 0x88, 0x88, 0x88, 0x88, 0x72,
+
+    /* U+5E02 "市" */
+    0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x68, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x90, 0x0, 0x19, 0x4, 0x65, 0x55, 0x5d, 0x55,
+    0x55, 0x52, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x10,
+    0x0, 0xc, 0x55, 0x5d, 0x55, 0x6d, 0x0, 0x0,
+    0xc0, 0x0, 0xc0, 0x1, 0xb0, 0x0, 0xc, 0x0,
+    0xc, 0x0, 0x1b, 0x0, 0x0, 0xc0, 0x0, 0xc0,
+    0x1, 0xb0, 0x0, 0xc, 0x0, 0xc, 0x0, 0x1b,
+    0x0, 0x0, 0xc0, 0x0, 0xc0, 0x56, 0xa0, 0x0,
+    0xa, 0x0, 0xc, 0x1, 0xb4, 0x0, 0x0, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x0, 0x0, 0x0,
+
+    /* U+5E03 "布" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0x60, 0x0, 0x1, 0x40, 0x5, 0x55, 0x5d,
+    0x55, 0x55, 0x56, 0x81, 0x0, 0x0, 0x57, 0x9,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0xc0, 0xb, 0x0,
+    0x4, 0x0, 0x0, 0x8, 0xe5, 0x5c, 0x55, 0x5d,
+    0x0, 0x0, 0x54, 0xc0, 0xb, 0x0, 0xc, 0x0,
+    0x4, 0x40, 0xc0, 0xb, 0x0, 0xc, 0x0, 0x12,
+    0x0, 0xc0, 0xb, 0x0, 0xc, 0x0, 0x0, 0x0,
+    0xc0, 0xb, 0x2, 0x2c, 0x0, 0x0, 0x0, 0xb0,
+    0xb, 0x1, 0xc6, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0,
+    0x0, 0x0,
+
+    /* U+5E08 "师" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa3, 0x55, 0x55, 0x55, 0xa5, 0x3, 0xa, 0x11,
+    0x0, 0xb0, 0x0, 0x0, 0xa2, 0xa1, 0x0, 0xb,
+    0x0, 0x0, 0xa, 0x1a, 0x1a, 0x55, 0xc5, 0x5c,
+    0x20, 0xa1, 0xa1, 0xb0, 0xb, 0x0, 0xa0, 0xa,
+    0x1a, 0xb, 0x0, 0xb0, 0xa, 0x0, 0xa1, 0xb0,
+    0xb0, 0xb, 0x0, 0xa0, 0xa, 0x1b, 0xb, 0x0,
+    0xb0, 0xa, 0x0, 0x32, 0x80, 0xb0, 0xb, 0x1,
+    0xb0, 0x0, 0x82, 0x7, 0x0, 0xb0, 0x6b, 0x0,
+    0x27, 0x0, 0x0, 0xb, 0x0, 0x0, 0x6, 0x0,
+    0x0, 0x0, 0xb0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x3, 0x0, 0x0,
+
+    /* U+5E0C "希" */
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0,
+    0x14, 0x52, 0x3, 0xc8, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xdd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x68,
+    0x14, 0xcb, 0x10, 0x0, 0x0, 0x44, 0xc, 0x40,
+    0x6, 0x51, 0x0, 0x16, 0x55, 0x7c, 0x55, 0x55,
+    0x5b, 0x80, 0x0, 0x0, 0xb1, 0x94, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0x85, 0xb7, 0x55, 0x91, 0x0,
+    0x0, 0x8c, 0x20, 0x92, 0x0, 0xc0, 0x0, 0x25,
+    0x9, 0x20, 0x92, 0x0, 0xc0, 0x0, 0x0, 0x9,
+    0x20, 0x92, 0x11, 0xd0, 0x0, 0x0, 0xa, 0x20,
+    0x92, 0x2b, 0x90, 0x0, 0x0, 0x1, 0x0, 0xa3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+5E2B "師" */
+    0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0x10, 0x0, 0x0, 0x0, 0x20, 0x23, 0x30, 0x36,
+    0x55, 0xa5, 0x58, 0x2c, 0x55, 0x5c, 0x0, 0xb,
+    0x0, 0x0, 0xb0, 0x0, 0xb3, 0x54, 0xc4, 0x49,
+    0xc, 0x55, 0x5b, 0x55, 0xb, 0x0, 0xb0, 0xb0,
+    0x0, 0x45, 0x50, 0xb0, 0xb, 0xc, 0x55, 0x58,
+    0x55, 0xb, 0x0, 0xb0, 0xb0, 0x0, 0xb5, 0x50,
+    0xb0, 0xb, 0xb, 0x0, 0xb, 0x55, 0xb, 0x0,
+    0xb0, 0xb0, 0x0, 0xb5, 0x40, 0xb3, 0xb9, 0xc,
+    0x55, 0x5b, 0x0, 0xb, 0x1, 0x0, 0x70, 0x0,
+    0x10, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x0, 0x0,
+
+    /* U+5E2D "席" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0x0, 0x0, 0x20, 0x0, 0xc5,
+    0x55, 0x58, 0x55, 0x57, 0x80, 0x0, 0xc0, 0x6,
+    0x50, 0xc, 0x0, 0x0, 0x0, 0xc3, 0x59, 0x85,
+    0x5d, 0x5a, 0x50, 0x0, 0xb0, 0x5, 0x50, 0xb,
+    0x0, 0x0, 0x0, 0xb0, 0x6, 0x86, 0x5c, 0x0,
+    0x0, 0x1, 0xa0, 0x3, 0x1b, 0x4, 0x0, 0x0,
+    0x2, 0x90, 0xa5, 0x5c, 0x55, 0x5c, 0x0, 0x5,
+    0x60, 0xb0, 0xb, 0x0, 0xb, 0x0, 0x8, 0x10,
+    0xb0, 0xb, 0x0, 0xb, 0x0, 0x7, 0x0, 0xb0,
+    0xb, 0x3, 0xba, 0x0, 0x22, 0x0, 0x30, 0xb,
+    0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0,
+    0x0, 0x0,
+
+    /* U+5E2F "帯" */
+    0x0, 0x0, 0x0, 0x12, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0x20, 0x37, 0x0, 0x80, 0x0, 0x3, 0x5a,
+    0x75, 0x79, 0x55, 0xd8, 0xc0, 0x0, 0x7, 0x30,
+    0x36, 0x0, 0xb0, 0x0, 0x0, 0x9, 0x75, 0x68,
+    0x55, 0xc0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x20, 0x40, 0x4, 0x85, 0x55, 0x78, 0x55, 0x56,
+    0xd1, 0xb, 0x22, 0x0, 0x37, 0x0, 0x24, 0x0,
+    0x0, 0xc, 0x55, 0x79, 0x55, 0xa5, 0x0, 0x0,
+    0xb, 0x0, 0x36, 0x0, 0x73, 0x0, 0x0, 0xb,
+    0x0, 0x36, 0x0, 0x73, 0x0, 0x0, 0xb, 0x0,
+    0x36, 0x16, 0xd2, 0x0, 0x0, 0x1, 0x0, 0x36,
+    0x0, 0x40, 0x0, 0x0, 0x0, 0x0, 0x11, 0x0,
+    0x0, 0x0,
+
+    /* U+5E30 "帰" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0xb, 0x14, 0x65, 0x55, 0x5c, 0x20, 0x0, 0xb,
+    0x0, 0x0, 0x0, 0xb, 0x0, 0x3, 0xb, 0x2,
+    0x65, 0x55, 0x5c, 0x0, 0xa, 0xb, 0x3, 0x55,
+    0x55, 0x5c, 0x0, 0xa, 0xb, 0x3, 0x0, 0x0,
+    0x3, 0x20, 0xa, 0xb, 0x48, 0x55, 0xb5, 0x55,
+    0xd2, 0xa, 0xb, 0x82, 0x0, 0xb0, 0x3, 0x20,
+    0x2, 0x19, 0x9, 0x65, 0xc5, 0x5d, 0x10, 0x0,
+    0x55, 0x9, 0x20, 0xb0, 0xb, 0x0, 0x0, 0x80,
+    0x9, 0x20, 0xb0, 0xb, 0x0, 0x1, 0x70, 0x9,
+    0x20, 0xb1, 0x7d, 0x0, 0x5, 0x0, 0x3, 0x0,
+    0xb0, 0x24, 0x0, 0x1, 0x0, 0x0, 0x0, 0x40,
+    0x0, 0x0,
+
+    /* U+5E33 "帳" */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0x0, 0xb, 0x55, 0x58, 0x50, 0x0, 0x1b,
+    0x0, 0xb, 0x0, 0x4, 0x0, 0xb, 0x5d, 0x5c,
+    0xc, 0x55, 0x56, 0x0, 0xb, 0x1b, 0xb, 0xb,
+    0x0, 0x6, 0x0, 0xb, 0x1b, 0xb, 0xc, 0x55,
+    0x55, 0x10, 0xb, 0x1b, 0xb, 0x5c, 0x55, 0x55,
+    0xb1, 0xb, 0x1b, 0xb, 0x28, 0x13, 0x1, 0x10,
+    0xb, 0x1b, 0xb, 0x28, 0x7, 0xa, 0x60, 0xa,
+    0x1c, 0x96, 0x28, 0x6, 0x82, 0x0, 0x0, 0x1b,
+    0x0, 0x28, 0x0, 0xb1, 0x0, 0x0, 0x1b, 0x0,
+    0x2a, 0x72, 0x3d, 0x30, 0x0, 0x1c, 0x0, 0x3c,
+    0x10, 0x4, 0xb2, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5E36 "帶" */
+    0x0, 0x3, 0x2, 0x2, 0x2, 0x0, 0x0, 0x0,
+    0xb, 0x1a, 0x1a, 0x2a, 0x30, 0x0, 0x3, 0x5d,
+    0x5c, 0x5c, 0x5b, 0x6d, 0x70, 0x0, 0xb, 0xa,
+    0xa, 0x9, 0x10, 0x30, 0x0, 0x64, 0xa, 0x5c,
+    0x9, 0x65, 0xa0, 0x4, 0x20, 0x4, 0x3, 0x1,
+    0x44, 0x20, 0x6, 0x55, 0x55, 0x86, 0x55, 0x58,
+    0xc0, 0xd, 0x0, 0x0, 0x92, 0x0, 0x36, 0x10,
+    0x14, 0x49, 0x55, 0xb6, 0x55, 0xd0, 0x0, 0x0,
+    0x46, 0x0, 0x91, 0x0, 0xb0, 0x0, 0x0, 0x46,
+    0x0, 0x91, 0x0, 0xb0, 0x0, 0x0, 0x45, 0x0,
+    0x91, 0x28, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x91,
+    0x2, 0x20, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0,
+    0x0, 0x0,
+
+    /* U+5E38 "常" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x5,
+    0x70, 0xc, 0x5, 0x90, 0x0, 0x0, 0xb, 0x10,
+    0xb0, 0x80, 0x0, 0x0, 0x85, 0x55, 0x59, 0x65,
+    0x55, 0xe1, 0x67, 0x2, 0x0, 0x0, 0x30, 0x53,
+    0x5, 0x10, 0x96, 0x55, 0x5c, 0x10, 0x0, 0x0,
+    0x9, 0x20, 0x0, 0xb0, 0x0, 0x0, 0x0, 0x86,
+    0x5c, 0x58, 0x0, 0x0, 0x0, 0x95, 0x55, 0xc5,
+    0x57, 0x60, 0x0, 0xc, 0x0, 0xb, 0x0, 0x56,
+    0x0, 0x0, 0xc0, 0x0, 0xb0, 0x5, 0x60, 0x0,
+    0xc, 0x0, 0xb, 0x7, 0xc4, 0x0, 0x0, 0x30,
+    0x0, 0xb0, 0x5, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x0, 0x0, 0x0,
+
+    /* U+5E45 "幅" */
+    0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x55, 0x55, 0x55, 0xa1, 0x0, 0xa0, 0x1,
+    0x0, 0x0, 0x0, 0xa, 0x5c, 0x5b, 0x9, 0x55,
+    0x5c, 0x0, 0xa0, 0xa0, 0xa0, 0xb0, 0x0, 0xb0,
+    0xa, 0xa, 0xa, 0xc, 0x55, 0x5b, 0x0, 0xa0,
+    0xa0, 0xa0, 0x70, 0x0, 0x40, 0xa, 0xa, 0xa,
+    0x95, 0x59, 0x55, 0xb0, 0xa0, 0xa0, 0xa9, 0x0,
+    0xa0, 0x1a, 0xb, 0xa, 0x78, 0x95, 0x5c, 0x55,
+    0xa0, 0x30, 0xa1, 0x9, 0x0, 0xa0, 0x1a, 0x0,
+    0xb, 0x0, 0x95, 0x5c, 0x55, 0xa0, 0x0, 0xb0,
+    0xa, 0x0, 0x0, 0x1a, 0x0, 0x2, 0x0, 0x10,
+    0x0, 0x0, 0x0,
+
+    /* U+5E73 "平" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x55, 0x55, 0x55, 0x55, 0x8b, 0x0, 0x0, 0x10,
+    0x0, 0xa2, 0x0, 0x30, 0x0, 0x0, 0x9, 0x0,
+    0xa2, 0x4, 0xd1, 0x0, 0x0, 0x6, 0xb0, 0xa2,
+    0x9, 0x10, 0x0, 0x0, 0x0, 0xb0, 0xa2, 0x42,
+    0x0, 0x0, 0x36, 0x55, 0x55, 0xc7, 0x65, 0x5a,
+    0x90, 0x0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5E74 "年" */
+    0x0, 0x1, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0x65, 0x55, 0x55, 0x5c, 0x60, 0x0, 0x74, 0x0,
+    0xd, 0x0, 0x0, 0x0, 0x3, 0x60, 0x0, 0xd,
+    0x0, 0x0, 0x0, 0x4, 0x8, 0x55, 0x5d, 0x55,
+    0xa7, 0x0, 0x0, 0xd, 0x0, 0xd, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0x0, 0xd, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0x0, 0xd, 0x0, 0x2, 0x80, 0x17,
+    0x55, 0x55, 0x5d, 0x55, 0x55, 0x51, 0x0, 0x0,
+    0x0, 0xd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0,
+    0x0, 0x0,
+
+    /* U+5E78 "幸" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x16,
+    0x55, 0xc6, 0x58, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0xa1, 0x0, 0x0, 0x0, 0x5, 0x55, 0x55, 0xb6,
+    0x55, 0x6d, 0x30, 0x0, 0x0, 0x52, 0x0, 0x83,
+    0x0, 0x0, 0x0, 0x0, 0x1c, 0x0, 0xa0, 0x0,
+    0x0, 0x0, 0x65, 0x57, 0x68, 0x65, 0xc3, 0x0,
+    0x0, 0x0, 0x0, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa1, 0x0, 0x7, 0x50, 0x26, 0x55,
+    0x55, 0xc6, 0x55, 0x55, 0x40, 0x0, 0x0, 0x0,
+    0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0,
+    0x0, 0x0,
+
+    /* U+5E7E "幾" */
+    0x0, 0x0, 0x10, 0x13, 0x0, 0x20, 0x0, 0x0,
+    0x4, 0xa0, 0x1a, 0x4, 0xa0, 0x0, 0x0, 0x18,
+    0x2, 0xa, 0x18, 0x3, 0x0, 0x1, 0xb6, 0x6b,
+    0x1b, 0xa8, 0x5c, 0x30, 0x0, 0x32, 0x80, 0xa,
+    0x10, 0x82, 0x0, 0x0, 0x36, 0x28, 0xb, 0x3a,
+    0x47, 0x60, 0x0, 0x99, 0x67, 0x3a, 0x2a, 0x30,
+    0x90, 0x0, 0x3, 0x90, 0x9, 0x12, 0x73, 0x40,
+    0x5, 0x58, 0x95, 0x59, 0x85, 0x57, 0x60, 0x0,
+    0x9, 0x80, 0x2, 0x90, 0xaa, 0x0, 0x0, 0x9,
+    0x3c, 0x0, 0xbb, 0x70, 0x2, 0x0, 0x71, 0x3,
+    0x4, 0xac, 0x40, 0x24, 0x5, 0x20, 0x4, 0x73,
+    0x1, 0x9c, 0xc4, 0x1, 0x0, 0x30, 0x0, 0x0,
+    0x1, 0x52,
+
+    /* U+5E83 "広" */
+    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc2, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x5, 0x30, 0x8, 0x20, 0x9, 0x85, 0x55, 0x55,
+    0x55, 0x53, 0x0, 0x94, 0x0, 0x4, 0x20, 0x0,
+    0x0, 0x9, 0x30, 0x0, 0xb7, 0x0, 0x0, 0x0,
+    0xa3, 0x0, 0x2d, 0x0, 0x0, 0x0, 0xb, 0x10,
+    0x8, 0x40, 0x0, 0x0, 0x0, 0xc0, 0x1, 0xa0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x82, 0x0, 0x19,
+    0x10, 0x3, 0x50, 0x46, 0x0, 0x0, 0x3d, 0x10,
+    0x70, 0x2e, 0x99, 0x98, 0x87, 0xc8, 0x15, 0x0,
+    0x84, 0x10, 0x0, 0x2, 0x61, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+5E86 "庆" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0x0, 0x0, 0x0, 0x0, 0x85,
+    0x55, 0x5c, 0x55, 0x5b, 0x80, 0x0, 0xc0, 0x0,
+    0x7, 0x10, 0x0, 0x0, 0x0, 0xc0, 0x0, 0xd,
+    0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0xc, 0x0,
+    0x0, 0x10, 0x0, 0xc3, 0x65, 0x5d, 0x65, 0x57,
+    0x80, 0x0, 0xc0, 0x0, 0xc, 0x50, 0x0, 0x0,
+    0x0, 0xc0, 0x0, 0x29, 0x71, 0x0, 0x0, 0x1,
+    0xa0, 0x0, 0x84, 0x19, 0x0, 0x0, 0x5, 0x60,
+    0x1, 0xb0, 0x7, 0x70, 0x0, 0x8, 0x0, 0x29,
+    0x10, 0x0, 0xab, 0x30, 0x24, 0x5, 0x60, 0x0,
+    0x0, 0x8, 0x91, 0x10, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5E95 "底" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0x0, 0x0, 0x0, 0x0, 0xb5,
+    0x55, 0x5b, 0x55, 0x5a, 0x70, 0x0, 0xd0, 0x0,
+    0x0, 0x0, 0x40, 0x0, 0x0, 0xd0, 0x42, 0x47,
+    0x9b, 0xb5, 0x0, 0x0, 0xd0, 0xc3, 0x15, 0x80,
+    0x0, 0x0, 0x0, 0xd0, 0xc0, 0x2, 0xa0, 0x2,
+    0x0, 0x0, 0xd0, 0xc5, 0x55, 0xd5, 0x59, 0x40,
+    0x0, 0xb0, 0xc0, 0x0, 0xb1, 0x0, 0x0, 0x2,
+    0x80, 0xc0, 0x0, 0x77, 0x0, 0x0, 0x6, 0x30,
+    0xc1, 0x75, 0xd, 0x20, 0x50, 0x8, 0x0, 0xdb,
+    0x38, 0x13, 0xd4, 0x90, 0x23, 0x0, 0x30, 0x5,
+    0x80, 0x2b, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x20,
+
+    /* U+5E97 "店" */
+    0x0, 0x0, 0x0, 0x31, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0x10, 0x0, 0x20, 0x0, 0x86,
+    0x55, 0x5a, 0x55, 0x58, 0xb1, 0x0, 0x93, 0x0,
+    0xa, 0x20, 0x0, 0x0, 0x0, 0x93, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0x0, 0x93, 0x0, 0xc, 0x55,
+    0x5b, 0x40, 0x0, 0xa2, 0x0, 0xc, 0x0, 0x0,
+    0x0, 0x0, 0xa2, 0x0, 0xc, 0x0, 0x1, 0x0,
+    0x0, 0xc0, 0xb5, 0x58, 0x55, 0x5e, 0x0, 0x0,
+    0xc0, 0xb0, 0x0, 0x0, 0xd, 0x0, 0x3, 0x70,
+    0xb0, 0x0, 0x0, 0xd, 0x0, 0x7, 0x0, 0xb5,
+    0x55, 0x55, 0x5d, 0x0, 0x23, 0x0, 0xb0, 0x0,
+    0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5E9C "府" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0x0, 0x0, 0x10, 0x0, 0xa5,
+    0x55, 0x59, 0x55, 0x59, 0x90, 0x0, 0xc0, 0x2,
+    0x50, 0x0, 0x61, 0x0, 0x0, 0xc0, 0x8, 0x70,
+    0x0, 0xb0, 0x0, 0x0, 0xc0, 0xc, 0x0, 0x0,
+    0xb0, 0x60, 0x0, 0xc0, 0x7d, 0x26, 0x55, 0xc5,
+    0x51, 0x0, 0xb1, 0x9b, 0x12, 0x0, 0xb0, 0x0,
+    0x2, 0xa7, 0xb, 0x9, 0x50, 0xb0, 0x0, 0x4,
+    0x70, 0xb, 0x1, 0x90, 0xb0, 0x0, 0x7, 0x10,
+    0xb, 0x0, 0x0, 0xb0, 0x0, 0x8, 0x0, 0xb,
+    0x0, 0x0, 0xb0, 0x0, 0x32, 0x0, 0xb, 0x0,
+    0x39, 0xc0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x1,
+    0x20, 0x0,
+
+    /* U+5EA6 "度" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3c, 0x0, 0x1, 0x0, 0x0, 0xb5,
+    0x55, 0x58, 0x55, 0x59, 0x70, 0x0, 0xc0, 0x9,
+    0x30, 0xa, 0x20, 0x0, 0x0, 0xc4, 0x5b, 0x65,
+    0x5d, 0x5b, 0x40, 0x0, 0xc0, 0x9, 0x20, 0xb,
+    0x0, 0x0, 0x0, 0xc0, 0x9, 0x65, 0x5c, 0x0,
+    0x0, 0x0, 0xc0, 0x4, 0x0, 0x3, 0x20, 0x0,
+    0x0, 0xa0, 0x47, 0x55, 0x59, 0xb0, 0x0, 0x2,
+    0x70, 0x0, 0x70, 0x2c, 0x0, 0x0, 0x6, 0x20,
+    0x0, 0x29, 0xc1, 0x0, 0x0, 0x7, 0x0, 0x0,
+    0x6a, 0xb6, 0x10, 0x0, 0x23, 0x2, 0x67, 0x30,
+    0x7, 0xcd, 0x80, 0x10, 0x22, 0x0, 0x0, 0x0,
+    0x1, 0x0,
+
+    /* U+5EA7 "座" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4b, 0x0, 0x1, 0x0, 0x0, 0x95,
+    0x55, 0x5b, 0x55, 0x5d, 0x50, 0x0, 0xd0, 0x0,
+    0x3, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x36, 0xa,
+    0x20, 0x81, 0x0, 0x0, 0xc0, 0x75, 0xa, 0x1,
+    0xd0, 0x0, 0x0, 0xc0, 0xa5, 0xa, 0x6, 0x94,
+    0x0, 0x0, 0xc2, 0x55, 0x9a, 0x8, 0x9, 0x70,
+    0x0, 0xb6, 0x0, 0x5a, 0x41, 0x21, 0x30, 0x1,
+    0x90, 0x65, 0x5c, 0x55, 0x86, 0x0, 0x5, 0x40,
+    0x0, 0xa, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0,
+    0xa, 0x0, 0x0, 0x0, 0x14, 0x15, 0x55, 0x5c,
+    0x55, 0x5b, 0xa0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5EAB "庫" */
+    0x0, 0x0, 0x0, 0x31, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xd0, 0x0, 0x0, 0x0, 0x65, 0x55,
+    0x5a, 0x55, 0x5d, 0x30, 0x8, 0x30, 0x0, 0x28,
+    0x0, 0x0, 0x0, 0x83, 0x65, 0x56, 0xb5, 0x88,
+    0x0, 0x8, 0x30, 0x20, 0x19, 0x3, 0x0, 0x0,
+    0x92, 0xd, 0x56, 0xb5, 0xc2, 0x0, 0xa, 0x10,
+    0xc5, 0x6b, 0x5c, 0x10, 0x0, 0xa0, 0xb, 0x1,
+    0x90, 0xa1, 0x0, 0xa, 0x0, 0xc5, 0x6b, 0x59,
+    0x10, 0x3, 0x53, 0x55, 0x56, 0xb5, 0x5d, 0x50,
+    0x70, 0x1, 0x0, 0x19, 0x0, 0x0, 0x23, 0x0,
+    0x0, 0x2, 0xa0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x12, 0x0, 0x0,
+
+    /* U+5EAD "庭" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2c, 0x0, 0x3, 0x0, 0x2, 0xa5,
+    0x55, 0x58, 0x55, 0x59, 0x40, 0x2, 0xa0, 0x2,
+    0x0, 0x0, 0x48, 0x0, 0x2, 0xa6, 0x6e, 0x24,
+    0x5d, 0x53, 0x0, 0x2, 0xa0, 0x84, 0x0, 0xc,
+    0x0, 0x0, 0x2, 0x95, 0x82, 0x10, 0xc, 0x4,
+    0x10, 0x2, 0x97, 0x5b, 0x56, 0x5d, 0x55, 0x30,
+    0x3, 0x72, 0xb, 0x0, 0xc, 0x0, 0x0, 0x4,
+    0x53, 0x69, 0x0, 0xc, 0x0, 0x30, 0x7, 0x10,
+    0xd5, 0x26, 0x56, 0x55, 0x60, 0x7, 0x7, 0x68,
+    0x94, 0x10, 0x0, 0x0, 0x32, 0x74, 0x0, 0x28,
+    0xbd, 0xef, 0xa1, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5EB7 "康" */
+    0x0, 0x0, 0x0, 0x13, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0x40, 0x1, 0x20, 0x0, 0xa5,
+    0x55, 0x57, 0x65, 0x58, 0x80, 0x0, 0xa1, 0x0,
+    0xc, 0x0, 0x20, 0x0, 0x0, 0xa1, 0x65, 0x5c,
+    0x55, 0xc3, 0x0, 0x0, 0xa5, 0x55, 0x5c, 0x55,
+    0xc7, 0xa0, 0x0, 0xb2, 0x0, 0xb, 0x0, 0xa0,
+    0x0, 0x0, 0xc0, 0x65, 0x5c, 0x65, 0xc1, 0x0,
+    0x0, 0xb0, 0x44, 0xb, 0x50, 0x2a, 0x20, 0x1,
+    0xa0, 0xb, 0x2c, 0x54, 0x83, 0x0, 0x5, 0x40,
+    0x7, 0x5b, 0xb, 0x20, 0x0, 0x8, 0x9, 0xa1,
+    0xb, 0x1, 0xc7, 0x20, 0x23, 0x5, 0x3, 0xba,
+    0x0, 0x9, 0x60, 0x10, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+5EE0 "廠" */
+    0x0, 0x0, 0x0, 0x22, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0x10, 0x1, 0x10, 0x0, 0x85,
+    0x55, 0x58, 0x55, 0x59, 0x80, 0x0, 0xb0, 0x2,
+    0x70, 0x2, 0x30, 0x0, 0x0, 0xb1, 0x63, 0xb2,
+    0x96, 0x60, 0x0, 0x0, 0xb0, 0x84, 0xb6, 0x9,
+    0x44, 0x60, 0x0, 0xb3, 0x66, 0xb6, 0x9a, 0x19,
+    0x20, 0x0, 0xa4, 0x61, 0x12, 0xb6, 0x19, 0x0,
+    0x0, 0xa4, 0x6b, 0x87, 0xa1, 0x59, 0x0, 0x0,
+    0x84, 0x69, 0x46, 0x90, 0xa6, 0x0, 0x4, 0x44,
+    0x69, 0x75, 0x90, 0xb4, 0x0, 0x6, 0x4, 0x60,
+    0x13, 0x95, 0x4b, 0x20, 0x4, 0x4, 0x30, 0x8,
+    0x73, 0x2, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5EFA "建" */
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x5, 0x57,
+    0xa2, 0x55, 0xc5, 0x5b, 0x0, 0x0, 0xa, 0x20,
+    0x0, 0xb0, 0xb, 0x20, 0x0, 0x48, 0x15, 0x55,
+    0xc5, 0x5d, 0x70, 0x0, 0xa0, 0x1, 0x22, 0xb2,
+    0x2b, 0x0, 0x5, 0x85, 0xd2, 0x33, 0xc3, 0x35,
+    0x0, 0x0, 0x0, 0xa2, 0x55, 0xc5, 0x86, 0x0,
+    0x1, 0x33, 0x70, 0x0, 0xb0, 0x0, 0x0, 0x0,
+    0x77, 0x45, 0x55, 0xc5, 0x57, 0x70, 0x0, 0x2d,
+    0x0, 0x0, 0xb0, 0x0, 0x0, 0x0, 0x77, 0xb5,
+    0x10, 0xa0, 0x0, 0x0, 0x5, 0x20, 0x17, 0xbc,
+    0xcc, 0xde, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5EFF "廿" */
+    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc2, 0x0, 0xd, 0x0, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0,
+    0xc, 0x1, 0x60, 0x6, 0x55, 0xd5, 0x55, 0x5d,
+    0x56, 0x61, 0x0, 0x0, 0xc0, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0x0, 0xc0, 0x0, 0xc, 0x0, 0x0,
+    0x0, 0x0, 0xc0, 0x0, 0xc, 0x0, 0x0, 0x0,
+    0x0, 0xc0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xc5,
+    0x55, 0x5c, 0x0, 0x0, 0x0, 0x0, 0xb0, 0x0,
+    0xb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5F0F "式" */
+    0x0, 0x0, 0x0, 0x1, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xc2, 0x81, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xb0, 0x68, 0x0, 0x3, 0x55, 0x55,
+    0x56, 0xd5, 0x5b, 0xa0, 0x1, 0x10, 0x0, 0x0,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0xc0,
+    0x0, 0x0, 0x3, 0x65, 0x85, 0xb3, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0xc0, 0x0, 0x93, 0x0, 0x0,
+    0x0, 0x0, 0xc0, 0x0, 0x58, 0x0, 0x0, 0x0,
+    0x0, 0xc0, 0x0, 0xd, 0x0, 0x30, 0x0, 0x0,
+    0xd6, 0x64, 0x8, 0x80, 0x60, 0x8, 0xba, 0x61,
+    0x0, 0x0, 0xc8, 0x90, 0x5, 0x20, 0x0, 0x0,
+    0x0, 0xa, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x11,
+
+    /* U+5F15 "引" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x55, 0x55,
+    0x59, 0x0, 0xb4, 0x1, 0x0, 0x2, 0x90, 0xa,
+    0x10, 0x0, 0x0, 0x29, 0x0, 0xa1, 0x6, 0x75,
+    0x56, 0xa0, 0xa, 0x10, 0x93, 0x0, 0x12, 0x0,
+    0xa1, 0xc, 0x0, 0x0, 0x0, 0xa, 0x12, 0xc5,
+    0x55, 0x5d, 0x10, 0xa1, 0x0, 0x0, 0x0, 0xa0,
+    0xa, 0x10, 0x0, 0x0, 0x47, 0x0, 0xa1, 0x0,
+    0x0, 0x8, 0x40, 0xa, 0x10, 0x2, 0x54, 0xd0,
+    0x0, 0xa1, 0x0, 0x4, 0xe4, 0x0, 0xb, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x10,
+
+    /* U+5F1F "弟" */
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x94, 0x0, 0xd, 0x30, 0x0, 0x0, 0x1, 0xb0,
+    0x6, 0x30, 0x0, 0x0, 0x46, 0x55, 0x58, 0x75,
+    0x5d, 0x0, 0x0, 0x0, 0x1, 0xa0, 0x0, 0xc0,
+    0x0, 0x8, 0x55, 0x6c, 0x55, 0x5c, 0x0, 0x1,
+    0xb0, 0x1, 0xa0, 0x0, 0x60, 0x0, 0x76, 0x0,
+    0x1a, 0x0, 0x0, 0x40, 0x6, 0x55, 0x6f, 0xc5,
+    0x55, 0x7c, 0x0, 0x0, 0xb, 0x5a, 0x0, 0x4,
+    0x80, 0x0, 0x9, 0x41, 0xa0, 0x0, 0x75, 0x0,
+    0x18, 0x20, 0x1a, 0x5, 0xad, 0x20, 0x35, 0x0,
+    0x2, 0xb0, 0x4, 0x30, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x0,
+
+    /* U+5F31 "弱" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36,
+    0x55, 0xb3, 0x56, 0x55, 0xc1, 0x0, 0x0, 0xa,
+    0x10, 0x0, 0xb, 0x0, 0x3, 0x0, 0xa1, 0x14,
+    0x22, 0xc0, 0x0, 0xc5, 0x59, 0x13, 0x92, 0x27,
+    0x0, 0x1a, 0x0, 0x0, 0x65, 0x0, 0x10, 0x4,
+    0x95, 0x5c, 0x3a, 0x65, 0x5a, 0x60, 0x4, 0x10,
+    0xb0, 0x5, 0x10, 0x75, 0x0, 0x1c, 0xb, 0x0,
+    0x2b, 0x7, 0x50, 0x0, 0x24, 0xc0, 0x0, 0x45,
+    0x84, 0x2, 0x87, 0xb, 0x3, 0x86, 0x8, 0x40,
+    0xc3, 0x0, 0xb0, 0xa2, 0x10, 0xb2, 0x0, 0x6,
+    0xd6, 0x0, 0x3, 0xcc, 0x0, 0x0, 0x2, 0x0,
+    0x0, 0x1, 0x0,
+
+    /* U+5F35 "張" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0x55, 0x92, 0x75, 0x55, 0x5b, 0x20, 0x0, 0x0,
+    0xa1, 0x91, 0x0, 0x1, 0x0, 0x0, 0x0, 0xa1,
+    0x96, 0x55, 0x67, 0x0, 0x8, 0x55, 0xc1, 0x91,
+    0x0, 0x5, 0x0, 0xc, 0x0, 0x30, 0x96, 0x55,
+    0x55, 0x0, 0xb, 0x0, 0x2, 0xa4, 0x33, 0x35,
+    0x60, 0x3c, 0x55, 0x96, 0xc2, 0x72, 0x23, 0x20,
+    0x0, 0x0, 0xa2, 0xb0, 0x51, 0x2c, 0x20, 0x0,
+    0x0, 0xb0, 0xb0, 0x19, 0x60, 0x0, 0x0, 0x0,
+    0xb0, 0xb0, 0x7, 0x50, 0x0, 0x2, 0x14, 0x80,
+    0xb5, 0x60, 0xb7, 0x0, 0x0, 0xaf, 0x20, 0xd7,
+    0x0, 0x1b, 0x90, 0x0, 0x1, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+5F37 "強" */
+    0x0, 0x0, 0x0, 0x0, 0x31, 0x0, 0x1, 0x55,
+    0x5a, 0x20, 0xc, 0x50, 0x0, 0x0, 0x0, 0xa0,
+    0x7, 0x30, 0x10, 0x0, 0x0, 0xa, 0x6, 0x20,
+    0x1, 0xa3, 0x9, 0x55, 0xc4, 0xd9, 0x88, 0x44,
+    0xc0, 0xb0, 0x2, 0x0, 0x2, 0xa0, 0x1, 0xa,
+    0x0, 0x0, 0xa5, 0x6b, 0x5b, 0x14, 0xb5, 0x59,
+    0x3b, 0x2, 0x90, 0xb0, 0x0, 0x0, 0xb1, 0xb0,
+    0x29, 0xb, 0x0, 0x0, 0xc, 0xc, 0x56, 0xb5,
+    0xb0, 0x0, 0x1, 0xb0, 0x0, 0x29, 0x5, 0x0,
+    0x20, 0x77, 0x1, 0x25, 0xb5, 0x87, 0x0, 0xad,
+    0x2, 0xd8, 0x53, 0x0, 0xb0, 0x1, 0x10, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+5F53 "当" */
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0x50, 0x2, 0x0, 0x4, 0x80, 0xa, 0x10,
+    0x4e, 0x10, 0x0, 0x7a, 0xa, 0x10, 0xb2, 0x0,
+    0x0, 0x5, 0xa, 0x16, 0x10, 0x0, 0x16, 0x55,
+    0x5b, 0x65, 0x55, 0xb2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd0,
+    0x3, 0x55, 0x55, 0x55, 0x55, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd0,
+    0x46, 0x55, 0x55, 0x55, 0x55, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x20,
+
+    /* U+5F62 "形" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0x55, 0x55, 0x5b, 0x50, 0x1d, 0x10, 0x0, 0xc,
+    0x0, 0xb0, 0x0, 0x95, 0x0, 0x0, 0xc, 0x0,
+    0xb0, 0x5, 0x50, 0x0, 0x0, 0xc, 0x0, 0xb0,
+    0x24, 0x0, 0x0, 0x0, 0xc, 0x0, 0xb4, 0x40,
+    0xa, 0x70, 0x5, 0x5d, 0x55, 0xc5, 0x40, 0x79,
+    0x0, 0x0, 0xc, 0x0, 0xb0, 0x7, 0x60, 0x0,
+    0x0, 0x1a, 0x0, 0xb0, 0x63, 0x0, 0x40, 0x0,
+    0x56, 0x0, 0xb0, 0x0, 0x8, 0xd1, 0x0, 0x91,
+    0x0, 0xb0, 0x0, 0x79, 0x0, 0x2, 0x60, 0x0,
+    0xb0, 0x8, 0x50, 0x0, 0x6, 0x0, 0x0, 0x73,
+    0x72, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0,
+    0x0, 0x0,
+
+    /* U+5F71 "影" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x95, 0x55, 0x5c, 0x0, 0x8, 0x50, 0x1, 0xa0,
+    0x0, 0xb, 0x0, 0x3b, 0x0, 0x1, 0xb5, 0x55,
+    0x5b, 0x1, 0x90, 0x0, 0x1, 0xb5, 0x85, 0x5a,
+    0x15, 0x0, 0x10, 0x2, 0x22, 0xb2, 0x26, 0x40,
+    0x2, 0xe1, 0x4, 0x53, 0x33, 0x37, 0x20, 0xb,
+    0x20, 0x0, 0xc5, 0x55, 0x6b, 0x0, 0x91, 0x0,
+    0x0, 0xa0, 0x0, 0x1a, 0x16, 0x0, 0x33, 0x0,
+    0x95, 0xc5, 0x67, 0x0, 0x1, 0xd5, 0x0, 0x66,
+    0xb3, 0x60, 0x0, 0x2b, 0x20, 0x1, 0x90, 0xb0,
+    0x77, 0x4, 0x91, 0x0, 0x6, 0x17, 0xd0, 0x3,
+    0x64, 0x0, 0x0, 0x0, 0x0, 0x10, 0x2, 0x0,
+    0x0, 0x0,
+
+    /* U+5F79 "役" */
+    0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0x80, 0x2a, 0x55, 0xc0, 0x0, 0x0, 0x49,
+    0x0, 0x29, 0x0, 0xb0, 0x0, 0x2, 0x80, 0x20,
+    0x47, 0x0, 0xb0, 0x0, 0x4, 0x3, 0xe1, 0x82,
+    0x0, 0xc0, 0x10, 0x0, 0xc, 0x24, 0x50, 0x0,
+    0x68, 0x83, 0x0, 0x8c, 0x23, 0x55, 0x55, 0x78,
+    0x0, 0x5, 0x4c, 0x0, 0x5, 0x0, 0x93, 0x0,
+    0x13, 0xc, 0x0, 0x6, 0x1, 0xb0, 0x0, 0x0,
+    0xc, 0x0, 0x1, 0x8a, 0x30, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0xbb, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0x19, 0x57, 0xa2, 0x0, 0x0, 0xc, 0x5, 0x71,
+    0x0, 0x4c, 0xc1, 0x0, 0x3, 0x20, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5F7C "彼" */
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0xd, 0x20, 0x0, 0xc, 0x0, 0x0, 0x0, 0x57,
+    0x0, 0x30, 0xb, 0x0, 0x40, 0x1, 0x90, 0x30,
+    0xd5, 0x5c, 0x57, 0xc1, 0x6, 0x6, 0xb0, 0xb0,
+    0xb, 0x5, 0x0, 0x0, 0xc, 0x10, 0xb0, 0xb,
+    0x0, 0x0, 0x0, 0x8b, 0x0, 0xc6, 0x58, 0x5c,
+    0x20, 0x4, 0x5b, 0x0, 0xa1, 0x40, 0x1a, 0x0,
+    0x3, 0xb, 0x2, 0x90, 0x80, 0x83, 0x0, 0x0,
+    0xb, 0x5, 0x50, 0x65, 0xa0, 0x0, 0x0, 0xb,
+    0x8, 0x0, 0x1f, 0x20, 0x0, 0x0, 0xb, 0x16,
+    0x3, 0x94, 0xb5, 0x0, 0x0, 0xb, 0x53, 0x53,
+    0x0, 0x1a, 0xc1, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5F80 "往" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0x90, 0x4, 0x70, 0x0, 0x0, 0x0, 0x1b,
+    0x0, 0x0, 0xb3, 0x0, 0x0, 0x0, 0x71, 0x0,
+    0x0, 0x20, 0x6, 0x10, 0x4, 0x2, 0xa5, 0x55,
+    0xd5, 0x55, 0x30, 0x0, 0xa, 0x60, 0x0, 0xc0,
+    0x0, 0x0, 0x0, 0x4d, 0x0, 0x0, 0xc0, 0x0,
+    0x0, 0x1, 0x9c, 0x1, 0x55, 0xd5, 0x5a, 0x10,
+    0x7, 0xc, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x10,
+    0xc, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0xc0, 0x0, 0x50, 0x0, 0xc, 0x36, 0x55,
+    0x75, 0x56, 0x71, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5F85 "待" */
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x7, 0x90, 0x0, 0xc2, 0x0, 0x0, 0x0, 0x1b,
+    0x0, 0x0, 0xc0, 0x5, 0x0, 0x0, 0x91, 0x32,
+    0x55, 0xd5, 0x55, 0x0, 0x5, 0x13, 0xd0, 0x0,
+    0xc0, 0x0, 0x0, 0x0, 0xb, 0x47, 0x55, 0x95,
+    0x55, 0xa1, 0x0, 0x6d, 0x0, 0x0, 0x0, 0xa1,
+    0x0, 0x2, 0x6c, 0x5, 0x55, 0x55, 0xd5, 0xb0,
+    0x4, 0xc, 0x0, 0x30, 0x0, 0xb0, 0x0, 0x0,
+    0xc, 0x0, 0x3a, 0x0, 0xb0, 0x0, 0x0, 0xc,
+    0x0, 0xa, 0x0, 0xb0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0xb0, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x5b, 0xc0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x2,
+    0x10, 0x0,
+
+    /* U+5F88 "很" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x40, 0x75, 0x55, 0x59, 0x0, 0x0, 0x47,
+    0x0, 0xb0, 0x0, 0xb, 0x0, 0x0, 0x80, 0x30,
+    0xb0, 0x0, 0xb, 0x0, 0x5, 0x3, 0xc0, 0xb5,
+    0x55, 0x5b, 0x0, 0x0, 0xa, 0x20, 0xb0, 0x0,
+    0xb, 0x0, 0x0, 0x4c, 0x0, 0xb5, 0x65, 0x5b,
+    0x0, 0x0, 0x8b, 0x0, 0xb0, 0x60, 0x8, 0x20,
+    0x6, 0xb, 0x0, 0xb0, 0x61, 0x67, 0x10, 0x0,
+    0xb, 0x0, 0xb0, 0xb, 0x10, 0x0, 0x0, 0xb,
+    0x0, 0xb0, 0x6, 0x80, 0x0, 0x0, 0xb, 0x0,
+    0xb6, 0x71, 0x7c, 0x40, 0x0, 0xc, 0x0, 0xb5,
+    0x0, 0x3, 0x81, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5F8B "律" */
+    0x0, 0x4, 0x0, 0x0, 0x50, 0x0, 0x0, 0x0,
+    0x4b, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0, 0xa1,
+    0x3, 0x55, 0xd5, 0x5a, 0x10, 0x5, 0x24, 0x50,
+    0x0, 0xc0, 0xc, 0x0, 0x2, 0xb, 0x66, 0x55,
+    0xd5, 0x5d, 0xa3, 0x0, 0x3b, 0x0, 0x0, 0xc0,
+    0xc, 0x0, 0x0, 0xba, 0x4, 0x65, 0xd5, 0x5b,
+    0x0, 0x6, 0x3a, 0x0, 0x0, 0xc0, 0x4, 0x0,
+    0x2, 0x1a, 0x5, 0x55, 0xd5, 0x56, 0x20, 0x0,
+    0x1a, 0x0, 0x0, 0xc0, 0x0, 0x60, 0x0, 0x1a,
+    0x56, 0x55, 0xd5, 0x55, 0x51, 0x0, 0x1a, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0x2a, 0x0, 0x0,
+    0xd0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x40,
+    0x0, 0x0,
+
+    /* U+5F8C "後" */
+    0x0, 0x0, 0x10, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x7, 0xb0, 0x0, 0xd3, 0x0, 0x0, 0x0, 0x2b,
+    0x0, 0x9, 0x20, 0x97, 0x0, 0x1, 0x90, 0x31,
+    0xd8, 0x59, 0x70, 0x0, 0x6, 0x3, 0xd1, 0x41,
+    0x83, 0x31, 0x0, 0x0, 0xb, 0x20, 0x58, 0x0,
+    0x2c, 0x20, 0x0, 0x8d, 0x4, 0xcc, 0x85, 0x35,
+    0x70, 0x6, 0x5c, 0x0, 0xc, 0x20, 0x12, 0x0,
+    0x12, 0xc, 0x0, 0x89, 0x55, 0xaa, 0x0, 0x0,
+    0xc, 0x4, 0x54, 0x21, 0xc0, 0x0, 0x0, 0xc,
+    0x13, 0x0, 0x9b, 0x20, 0x0, 0x0, 0xc, 0x0,
+    0x1, 0xab, 0x40, 0x0, 0x0, 0xc, 0x2, 0x77,
+    0x10, 0x7d, 0xa2, 0x0, 0x3, 0x22, 0x0, 0x0,
+    0x0, 0x20,
+
+    /* U+5F92 "徒" */
+    0x0, 0x2, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0xc, 0x40, 0x0, 0xa4, 0x0, 0x0, 0x0, 0x58,
+    0x0, 0x0, 0x92, 0x3, 0x0, 0x1, 0x90, 0x42,
+    0x65, 0xb7, 0x57, 0x40, 0x6, 0x5, 0xc0, 0x0,
+    0x92, 0x0, 0x0, 0x0, 0xc, 0x20, 0x0, 0x92,
+    0x1, 0x70, 0x0, 0x7c, 0x16, 0x55, 0xb8, 0x55,
+    0x51, 0x3, 0x8c, 0x0, 0xa0, 0x92, 0x0, 0x0,
+    0x15, 0xc, 0x1, 0xb0, 0x97, 0x59, 0x50, 0x0,
+    0xc, 0x3, 0xa0, 0x92, 0x0, 0x0, 0x0, 0xc,
+    0x7, 0x35, 0x92, 0x0, 0x0, 0x0, 0xc, 0x7,
+    0x3, 0xd6, 0x10, 0x0, 0x0, 0xc, 0x40, 0x0,
+    0x6, 0xbe, 0xe3, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5F93 "従" */
+    0x0, 0x0, 0x20, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x7, 0xc0, 0x73, 0x0, 0xb, 0x60, 0x0, 0x2b,
+    0x0, 0xd, 0x20, 0x29, 0x0, 0x0, 0x90, 0x20,
+    0x5, 0x40, 0x70, 0x0, 0x6, 0x1, 0xe4, 0x55,
+    0x55, 0x66, 0xc1, 0x0, 0x9, 0x60, 0x10, 0xc,
+    0x0, 0x0, 0x0, 0x4d, 0x0, 0x51, 0xc, 0x0,
+    0x0, 0x1, 0x8c, 0x0, 0xa4, 0xc, 0x2, 0x20,
+    0x5, 0xc, 0x0, 0xb1, 0xd, 0x55, 0x30, 0x0,
+    0xc, 0x0, 0xd1, 0xc, 0x0, 0x0, 0x0, 0xc,
+    0x2, 0x97, 0x1c, 0x0, 0x0, 0x0, 0xc, 0x7,
+    0x10, 0xac, 0x0, 0x0, 0x0, 0xc, 0x23, 0x0,
+    0x7, 0xdc, 0xa3, 0x0, 0x2, 0x10, 0x0, 0x0,
+    0x2, 0x40,
+
+    /* U+5F97 "得" */
+    0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xd0, 0x85, 0x55, 0x5b, 0x0, 0x0, 0x2b,
+    0x10, 0xb0, 0x0, 0x1a, 0x0, 0x1, 0x80, 0x42,
+    0xb5, 0x55, 0x6a, 0x0, 0x4, 0x0, 0xd5, 0xb0,
+    0x0, 0x1a, 0x0, 0x0, 0x8, 0x60, 0xc5, 0x55,
+    0x6a, 0x0, 0x0, 0x4d, 0x3, 0x65, 0x55, 0x58,
+    0x60, 0x3, 0x6c, 0x0, 0x10, 0x0, 0xc0, 0x0,
+    0x3, 0xc, 0x16, 0x55, 0x55, 0xd5, 0xc1, 0x0,
+    0xc, 0x0, 0x51, 0x0, 0xc0, 0x0, 0x0, 0xc,
+    0x0, 0x2c, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x0,
+    0x5, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x4a, 0xd0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1,
+    0x10, 0x0,
+
+    /* U+5F9E "從" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xa0, 0x6b, 0x0, 0x5a, 0x0, 0x0, 0x2a,
+    0x0, 0x85, 0x0, 0x94, 0x0, 0x0, 0x80, 0x10,
+    0xa8, 0x30, 0xb7, 0x0, 0x5, 0x0, 0xe4, 0x61,
+    0xd5, 0x33, 0xc0, 0x0, 0x8, 0x55, 0x0, 0x15,
+    0x0, 0x40, 0x0, 0x4c, 0x0, 0x0, 0x9, 0x0,
+    0x0, 0x3, 0x7c, 0x0, 0xa3, 0xc, 0x0, 0x0,
+    0x13, 0xc, 0x0, 0xc0, 0xd, 0x59, 0x20, 0x0,
+    0xc, 0x0, 0xc0, 0xc, 0x0, 0x0, 0x0, 0xc,
+    0x1, 0xc7, 0xc, 0x0, 0x0, 0x0, 0xc, 0x6,
+    0x21, 0xad, 0x30, 0x0, 0x0, 0xc, 0x24, 0x0,
+    0x4, 0xae, 0xd4, 0x0, 0x1, 0x10, 0x0, 0x0,
+    0x0, 0x10,
+
+    /* U+5FA1 "御" */
+    0x0, 0x1, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0x50, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x48,
+    0x2, 0x80, 0x40, 0x63, 0x71, 0x2, 0x70, 0x37,
+    0x6b, 0x52, 0xc1, 0xb0, 0x4, 0x5, 0xa6, 0xa,
+    0x0, 0xb0, 0xa0, 0x0, 0xb, 0x15, 0x5b, 0x86,
+    0xb0, 0xa0, 0x0, 0x99, 0x0, 0xa, 0x0, 0xb0,
+    0xa0, 0x4, 0x49, 0xa, 0x1a, 0x31, 0xb0, 0xa0,
+    0x2, 0x19, 0xa, 0xb, 0x53, 0xb0, 0xa0, 0x0,
+    0x19, 0xa, 0xa, 0x0, 0xb0, 0xa0, 0x0, 0x19,
+    0xa, 0x1c, 0x52, 0xb6, 0xb0, 0x0, 0x19, 0x4d,
+    0x82, 0x0, 0xb0, 0x10, 0x0, 0x29, 0x1, 0x0,
+    0x0, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x10, 0x0,
+
+    /* U+5FA9 "復" */
+    0x0, 0x0, 0x10, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xc0, 0xd, 0x20, 0x0, 0x0, 0x0, 0x1b,
+    0x0, 0x6a, 0x55, 0x57, 0x90, 0x0, 0x91, 0x1,
+    0x72, 0x0, 0x3, 0x10, 0x6, 0x0, 0x94, 0xd,
+    0x55, 0x5b, 0x40, 0x0, 0x7, 0x80, 0xc, 0x55,
+    0x5b, 0x20, 0x0, 0x3c, 0x0, 0xb, 0x0, 0x9,
+    0x20, 0x1, 0x8b, 0x0, 0xa, 0xc5, 0x58, 0x10,
+    0x4, 0xb, 0x0, 0x8, 0x85, 0x5a, 0x10, 0x0,
+    0xb, 0x0, 0x45, 0x50, 0x6a, 0x0, 0x0, 0xb,
+    0x3, 0x30, 0x38, 0xb0, 0x0, 0x0, 0xb, 0x0,
+    0x0, 0x5c, 0x80, 0x0, 0x0, 0xb, 0x0, 0x47,
+    0x30, 0x6d, 0xa2, 0x0, 0x1, 0x2, 0x0, 0x0,
+    0x0, 0x20,
+
+    /* U+5FC3 "心" */
+    0x0, 0x0, 0x0, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7a, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x40, 0xe, 0x60, 0x0, 0x0, 0x0, 0x0, 0xc4,
+    0x5, 0x20, 0x0, 0x0, 0x0, 0x30, 0xb1, 0x0,
+    0x0, 0x21, 0x0, 0x0, 0x80, 0xb1, 0x0, 0x0,
+    0xb, 0x10, 0x3, 0xa0, 0xb1, 0x0, 0x0, 0x6,
+    0xb0, 0xd, 0x70, 0xb1, 0x0, 0x0, 0x42, 0xd0,
+    0x4, 0x0, 0xb1, 0x0, 0x0, 0x60, 0x10, 0x0,
+    0x0, 0xb2, 0x0, 0x3, 0x90, 0x0, 0x0, 0x0,
+    0x7d, 0xaa, 0xad, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x11, 0x10, 0x0, 0x0,
+
+    /* U+5FC5 "必" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x53, 0x0, 0x26, 0x0, 0x0, 0x0, 0x0,
+    0xb5, 0x7, 0x80, 0x0, 0x0, 0xc, 0x23, 0xb0,
+    0xc1, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x49, 0x0,
+    0x0, 0x5, 0xc, 0x0, 0xb, 0x13, 0x20, 0x0,
+    0x80, 0xc0, 0x4, 0x80, 0xa, 0x10, 0x67, 0xc,
+    0x0, 0xb1, 0x0, 0x6a, 0xa, 0x20, 0xc0, 0x93,
+    0x0, 0x21, 0x70, 0x0, 0xc, 0x76, 0x0, 0x6,
+    0x0, 0x0, 0x0, 0xd5, 0x0, 0x1, 0xb0, 0x0,
+    0x16, 0x79, 0xdc, 0xcc, 0xdb, 0x0, 0x13, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+5FD8 "忘" */
+    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x95, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2d, 0x0, 0x4, 0x70, 0x6, 0x55, 0xd5,
+    0x55, 0x55, 0x55, 0x50, 0x0, 0x0, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xd5, 0x55, 0x55, 0x7c,
+    0x0, 0x0, 0x0, 0x50, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x30, 0x2d, 0x10, 0x0, 0x0, 0x0,
+    0x40, 0x95, 0x9, 0x20, 0x19, 0x10, 0x0, 0xa0,
+    0x83, 0x0, 0x0, 0x45, 0xc0, 0x6, 0xc0, 0x83,
+    0x0, 0x0, 0x90, 0x70, 0x1, 0x0, 0x5c, 0xaa,
+    0xab, 0xb0, 0x0,
+
+    /* U+5FD9 "忙" */
+    0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x95, 0x0, 0x2, 0x90, 0x0, 0x0, 0x0, 0x92,
+    0x0, 0x0, 0x97, 0x0, 0x0, 0x0, 0x93, 0x0,
+    0x0, 0x22, 0x2, 0x60, 0x2, 0x9a, 0x85, 0xd5,
+    0x55, 0x55, 0x50, 0x9, 0x93, 0xa0, 0xc0, 0x0,
+    0x0, 0x0, 0x4a, 0x92, 0x0, 0xc0, 0x0, 0x0,
+    0x0, 0x21, 0x92, 0x0, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x92, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x92, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x92,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x93, 0x0,
+    0xc0, 0x0, 0x4, 0x20, 0x0, 0xa3, 0x1, 0x85,
+    0x55, 0x55, 0x40, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5FEB "快" */
+    0x0, 0x13, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0,
+    0x2c, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x0, 0x1a,
+    0x0, 0x0, 0xc0, 0x1, 0x0, 0x0, 0x1c, 0x3,
+    0x55, 0xd5, 0x5e, 0x10, 0x1, 0x3b, 0xb3, 0x0,
+    0xc0, 0xc, 0x0, 0x7, 0x4a, 0x35, 0x0, 0xc0,
+    0xc, 0x0, 0xd, 0x2a, 0x0, 0x0, 0xb0, 0xc,
+    0x20, 0x0, 0x1a, 0x26, 0x56, 0xc6, 0x59, 0x94,
+    0x0, 0x1a, 0x0, 0x6, 0x66, 0x0, 0x0, 0x0,
+    0x1a, 0x0, 0xb, 0x16, 0x20, 0x0, 0x0, 0x1a,
+    0x0, 0x47, 0x0, 0xa0, 0x0, 0x0, 0x1a, 0x2,
+    0x90, 0x0, 0x5b, 0x10, 0x0, 0x2b, 0x37, 0x0,
+    0x0, 0x7, 0xe4, 0x0, 0x1, 0x10, 0x0, 0x0,
+    0x0, 0x10,
+
+    /* U+5FF5 "念" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x45, 0x30, 0x0, 0x0, 0x0, 0x0, 0xa5,
+    0x50, 0x67, 0x0, 0x0, 0x0, 0xa, 0x30, 0x77,
+    0x4, 0xd8, 0x41, 0x4, 0x71, 0x0, 0x13, 0x3,
+    0x7, 0x80, 0x12, 0x4, 0x65, 0x55, 0x7e, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa4, 0x0, 0x0,
+    0x0, 0x0, 0x42, 0x93, 0x90, 0x0, 0x0, 0x0,
+    0x40, 0xd2, 0x96, 0x0, 0x23, 0x0, 0x0, 0xb0,
+    0xc0, 0x10, 0x4, 0xb, 0x40, 0x7, 0x80, 0xc0,
+    0x0, 0x8, 0x24, 0x60, 0x0, 0x0, 0xac, 0xaa,
+    0xad, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+600E "怎" */
+    0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xb5, 0x55, 0x55, 0x6c, 0x10, 0x0, 0x1a, 0xc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x81, 0xc, 0x55,
+    0x56, 0xb0, 0x0, 0x5, 0x10, 0xc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0x55, 0x55, 0xb7,
+    0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x30, 0xc1, 0x1d, 0x0, 0x17, 0x0, 0x0, 0x90,
+    0xc0, 0x6, 0x0, 0x36, 0xb0, 0x9, 0x70, 0xc0,
+    0x0, 0x1, 0x60, 0xa0, 0x4, 0x0, 0x8b, 0xaa,
+    0xac, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6012 "怒" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x60, 0x1, 0x11, 0x15, 0x0, 0x5, 0x5d,
+    0x57, 0x67, 0x44, 0x7c, 0x0, 0x0, 0x28, 0x9,
+    0x31, 0x50, 0xa3, 0x0, 0x0, 0x92, 0xb, 0x0,
+    0x76, 0x90, 0x0, 0x0, 0x26, 0xc9, 0x0, 0x4f,
+    0x40, 0x0, 0x0, 0x7, 0x58, 0x55, 0x71, 0xb9,
+    0x30, 0x4, 0x61, 0x3, 0x52, 0x0, 0x6, 0x80,
+    0x10, 0x0, 0x10, 0x55, 0x0, 0x10, 0x0, 0x0,
+    0x40, 0xb2, 0xd, 0x30, 0x39, 0x0, 0x0, 0xa0,
+    0xb1, 0x4, 0x2, 0x8, 0x90, 0x7, 0x70, 0xb1,
+    0x0, 0x6, 0x20, 0x40, 0x0, 0x0, 0x8c, 0xbb,
+    0xbd, 0x50, 0x0,
+
+    /* U+6015 "怕" */
+    0x0, 0x3, 0x0, 0x0, 0x21, 0x0, 0x0, 0x0,
+    0xd1, 0x0, 0x7, 0x70, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0x80, 0x0, 0x0, 0x0, 0xc0, 0x9, 0x57,
+    0x55, 0xc2, 0x1, 0x2c, 0xa2, 0xc0, 0x0, 0xc,
+    0x0, 0x64, 0xc3, 0x3c, 0x0, 0x0, 0xc0, 0xd,
+    0x2c, 0x0, 0xc0, 0x0, 0xc, 0x0, 0x0, 0xc0,
+    0xc, 0x55, 0x55, 0xd0, 0x0, 0xc, 0x0, 0xc0,
+    0x0, 0xc, 0x0, 0x0, 0xc0, 0xc, 0x0, 0x0,
+    0xc0, 0x0, 0xc, 0x0, 0xc0, 0x0, 0xc, 0x0,
+    0x0, 0xc0, 0xc, 0x55, 0x55, 0xd0, 0x0, 0xd,
+    0x0, 0xc0, 0x0, 0xb, 0x0, 0x0, 0x20, 0x1,
+    0x0, 0x0, 0x0,
+
+    /* U+601D "思" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x55, 0x58, 0x55, 0x5d, 0x0, 0x0, 0xc,
+    0x0, 0xc, 0x0, 0xc, 0x0, 0x0, 0xc, 0x0,
+    0xc, 0x0, 0xc, 0x0, 0x0, 0xd, 0x55, 0x5d,
+    0x55, 0x5c, 0x0, 0x0, 0xc, 0x0, 0xc, 0x0,
+    0xc, 0x0, 0x0, 0xc, 0x0, 0xc, 0x0, 0xc,
+    0x0, 0x0, 0xd, 0x55, 0x65, 0x55, 0x5b, 0x0,
+    0x0, 0x1, 0x30, 0x69, 0x0, 0x0, 0x0, 0x0,
+    0x60, 0x95, 0xb, 0x20, 0x33, 0x91, 0x1, 0xb0,
+    0x93, 0x0, 0x0, 0xc3, 0x6b, 0x8, 0x80, 0x94,
+    0x0, 0x0, 0xe6, 0x6, 0x0, 0x0, 0x6d, 0xbb,
+    0xbc, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6025 "急" */
+    0x0, 0x0, 0x5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5b, 0x10, 0x12, 0x0, 0x0, 0x0, 0x1,
+    0xb5, 0x55, 0xba, 0x0, 0x0, 0x0, 0x8, 0x0,
+    0x2, 0x70, 0x2, 0x0, 0x0, 0x76, 0x55, 0x56,
+    0x55, 0x8c, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x49, 0x0, 0x0, 0x2, 0x65, 0x55, 0x55, 0x79,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0,
+    0x0, 0x6, 0x55, 0x96, 0x55, 0x77, 0x0, 0x0,
+    0x10, 0xb2, 0x1d, 0x11, 0x14, 0x0, 0x0, 0x80,
+    0xc0, 0x3, 0x5, 0x7, 0x90, 0x5, 0xb0, 0xc0,
+    0x0, 0x7, 0x20, 0x90, 0x2, 0x10, 0x9b, 0xaa,
+    0xad, 0x50, 0x0,
+
+    /* U+6027 "性" */
+    0x0, 0x13, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x1c, 0x0, 0x0, 0xe, 0x10, 0x0, 0x0, 0x1a,
+    0x0, 0x77, 0xc, 0x0, 0x0, 0x0, 0x1c, 0x40,
+    0xa3, 0xc, 0x0, 0x10, 0x2, 0x4a, 0xa3, 0xd5,
+    0x5d, 0x57, 0xa0, 0x7, 0x5a, 0x14, 0x60, 0xc,
+    0x0, 0x0, 0xa, 0x2a, 0x7, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0x1a, 0x2, 0x45, 0x5d, 0x59, 0x70,
+    0x0, 0x1a, 0x0, 0x10, 0xc, 0x0, 0x0, 0x0,
+    0x1a, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x1a,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x1a, 0x0,
+    0x0, 0xc, 0x0, 0x71, 0x0, 0x2b, 0x7, 0x55,
+    0x55, 0x55, 0x53, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+606F "息" */
+    0x0, 0x0, 0x0, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x20, 0x37, 0x0, 0x5, 0x0, 0x0, 0xd, 0x55,
+    0x55, 0x55, 0xe0, 0x0, 0x0, 0xd0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0xd, 0x55, 0x55, 0x55, 0xc0,
+    0x0, 0x0, 0xd5, 0x55, 0x55, 0x5c, 0x0, 0x0,
+    0xd, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xd5,
+    0x55, 0x55, 0x5d, 0x0, 0x0, 0x5, 0x0, 0x83,
+    0x0, 0x30, 0x0, 0x2, 0xc, 0x22, 0xf0, 0x0,
+    0x40, 0x0, 0x90, 0xd0, 0x3, 0x3, 0x17, 0x80,
+    0xa8, 0xd, 0x0, 0x0, 0x54, 0x1c, 0x4, 0x0,
+    0x9b, 0xaa, 0xac, 0x60, 0x0,
+
+    /* U+60A8 "您" */
+    0x0, 0x2, 0x10, 0x11, 0x0, 0x0, 0x0, 0x0,
+    0x96, 0x8, 0x90, 0x0, 0x0, 0x0, 0x1c, 0x0,
+    0xd5, 0x55, 0x59, 0x30, 0x9, 0xa0, 0x62, 0x3,
+    0x0, 0xa2, 0x4, 0x6a, 0x23, 0x20, 0xc1, 0x20,
+    0x0, 0x41, 0xa0, 0x1d, 0x1c, 0x7, 0x10, 0x0,
+    0x1a, 0x8, 0x20, 0xc0, 0x2d, 0x10, 0x1, 0xa3,
+    0x14, 0x8e, 0x0, 0x61, 0x0, 0x15, 0x0, 0x44,
+    0x40, 0x0, 0x0, 0x1, 0x18, 0x55, 0x90, 0x2,
+    0x40, 0x0, 0x81, 0x73, 0x7, 0x0, 0x48, 0x70,
+    0x4e, 0x7, 0x30, 0x0, 0x28, 0x9, 0x1, 0x10,
+    0x4b, 0x99, 0x9b, 0x80, 0x0,
+
+    /* U+60AA "悪" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36,
+    0x55, 0x65, 0x56, 0x58, 0xa0, 0x0, 0x0, 0xc,
+    0x0, 0xc0, 0x0, 0x0, 0x8, 0x65, 0xd5, 0x5d,
+    0x5c, 0x30, 0x0, 0x92, 0xc, 0x0, 0xc0, 0xb0,
+    0x0, 0x9, 0x75, 0xd5, 0x5d, 0x5c, 0x10, 0x0,
+    0x30, 0xc, 0x0, 0xc0, 0x24, 0x0, 0x55, 0x55,
+    0x95, 0x59, 0x56, 0xa3, 0x0, 0x0, 0x20, 0x64,
+    0x0, 0x0, 0x0, 0x3, 0x1d, 0x0, 0xc3, 0x1,
+    0x70, 0x0, 0x91, 0xb0, 0x2, 0x4, 0x7, 0x70,
+    0xb8, 0x1b, 0x0, 0x0, 0x63, 0x17, 0x3, 0x0,
+    0xdb, 0xbb, 0xbd, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+60B2 "悲" */
+    0x0, 0x0, 0x3, 0x0, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0x0, 0xd0, 0x0, 0x0, 0x3, 0x55,
+    0x5c, 0x0, 0xd5, 0x57, 0x50, 0x0, 0x0, 0xc,
+    0x0, 0xc0, 0x2, 0x0, 0x0, 0x55, 0x5c, 0x0,
+    0xd5, 0x57, 0x0, 0x0, 0x0, 0xc, 0x0, 0xc0,
+    0x0, 0x10, 0x5, 0x55, 0x5c, 0x0, 0xd5, 0x57,
+    0x70, 0x0, 0x0, 0xd, 0x0, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x21, 0x46, 0x0, 0x11, 0x0, 0x0,
+    0x40, 0xd1, 0xb, 0x30, 0x9, 0x40, 0x2, 0x80,
+    0xc0, 0x2, 0x0, 0x41, 0xb0, 0xc, 0x40, 0xc0,
+    0x0, 0x1, 0x80, 0x10, 0x0, 0x0, 0xbb, 0xaa,
+    0xac, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+60C5 "情" */
+    0x0, 0x20, 0x0, 0x0, 0x30, 0x0, 0x0, 0xa,
+    0x40, 0x0, 0xd, 0x0, 0x0, 0x0, 0xa2, 0x26,
+    0x55, 0xd5, 0x6a, 0x0, 0x1a, 0x93, 0x0, 0xc,
+    0x3, 0x0, 0x7, 0xa4, 0x74, 0x65, 0xd5, 0x63,
+    0x4, 0x9a, 0x24, 0x55, 0x5d, 0x55, 0x86, 0x21,
+    0xa2, 0x12, 0x0, 0x0, 0x20, 0x0, 0xa, 0x20,
+    0xa5, 0x55, 0x5c, 0x30, 0x0, 0xa2, 0xa, 0x65,
+    0x55, 0xc1, 0x0, 0xa, 0x20, 0xa1, 0x0, 0xa,
+    0x10, 0x0, 0xa2, 0xa, 0x65, 0x55, 0xc1, 0x0,
+    0xa, 0x20, 0xa1, 0x0, 0xa, 0x10, 0x0, 0xa2,
+    0xa, 0x10, 0x28, 0xe0, 0x0, 0x2, 0x0, 0x20,
+    0x0, 0x2, 0x0,
+
+    /* U+60F3 "想" */
+    0x0, 0x4, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0x30, 0x8, 0x55, 0x59, 0x10, 0x0, 0x8,
+    0x24, 0xb, 0x0, 0xb, 0x0, 0x6, 0x5c, 0x78,
+    0x2c, 0x55, 0x5c, 0x0, 0x0, 0x1f, 0x70, 0xb,
+    0x0, 0xb, 0x0, 0x0, 0x8c, 0x6c, 0xc, 0x55,
+    0x5c, 0x0, 0x2, 0x78, 0x25, 0xb, 0x0, 0xb,
+    0x0, 0x6, 0x9, 0x20, 0xd, 0x55, 0x5c, 0x0,
+    0x10, 0x7, 0x20, 0x46, 0x0, 0x4, 0x0, 0x0,
+    0x0, 0x71, 0x2d, 0x0, 0x2, 0x0, 0x0, 0x70,
+    0xb0, 0x7, 0x14, 0x7, 0x60, 0x4, 0xa0, 0xb0,
+    0x0, 0x6, 0x10, 0xc0, 0x4, 0x20, 0x8a, 0x99,
+    0x9c, 0x40, 0x0,
+
+    /* U+6108 "愈" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xab, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa5,
+    0x17, 0x0, 0x0, 0x0, 0x3, 0x93, 0x11, 0x7b,
+    0x61, 0x0, 0x35, 0x52, 0x36, 0x33, 0x17, 0xda,
+    0x10, 0xc, 0x55, 0xb0, 0x80, 0xc0, 0x0, 0x0,
+    0xb4, 0x4a, 0x9, 0xa, 0x0, 0x0, 0xc, 0x55,
+    0xa0, 0xa0, 0xa0, 0x0, 0x0, 0xa0, 0x69, 0x3,
+    0x2b, 0x0, 0x0, 0x5, 0x23, 0x84, 0x5, 0x60,
+    0x0, 0x1, 0x18, 0x40, 0xc0, 0x0, 0x70, 0x0,
+    0xa1, 0x83, 0x0, 0x2, 0x15, 0xa0, 0x27, 0x5,
+    0xb9, 0x99, 0xb6, 0x2, 0x0,
+
+    /* U+610F "意" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x75, 0x0, 0x30, 0x0, 0x0, 0x25,
+    0x76, 0x66, 0x97, 0x80, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0xa1, 0x1, 0x0, 0x6, 0x55, 0x57, 0x56,
+    0x65, 0x59, 0x80, 0x0, 0x7, 0x55, 0x55, 0x55,
+    0x70, 0x0, 0x0, 0xb, 0x0, 0x0, 0x2, 0x90,
+    0x0, 0x0, 0xc, 0x55, 0x55, 0x56, 0x90, 0x0,
+    0x0, 0xc, 0x55, 0x55, 0x56, 0x90, 0x0, 0x0,
+    0x5, 0x20, 0x71, 0x1, 0x30, 0x0, 0x0, 0x50,
+    0xc0, 0x3a, 0x1, 0x39, 0x10, 0x2, 0xa0, 0xb0,
+    0x1, 0x6, 0x6, 0x90, 0x8, 0x40, 0xaa, 0x99,
+    0x9d, 0x10, 0x10,
+
+    /* U+611A "愚" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc5,
+    0x58, 0x55, 0x5c, 0x0, 0x0, 0xc0, 0x9, 0x10,
+    0xb, 0x0, 0x0, 0xd5, 0x5b, 0x65, 0x5b, 0x0,
+    0x0, 0xd5, 0x5b, 0x65, 0x5c, 0x0, 0x3, 0x30,
+    0x9, 0x10, 0x1, 0x50, 0xd, 0x55, 0x5b, 0x67,
+    0x55, 0xc1, 0xc, 0x1, 0x2a, 0x57, 0xb0, 0xb0,
+    0xc, 0xb, 0x74, 0x10, 0x60, 0xb0, 0xb, 0x1,
+    0x1a, 0x20, 0x29, 0xb0, 0x3, 0xc, 0x4, 0x80,
+    0x23, 0x60, 0x1a, 0xb, 0x0, 0x0, 0x60, 0x97,
+    0x74, 0x9, 0xa9, 0x99, 0xc4, 0x13,
+
+    /* U+611B "愛" */
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x1, 0x24,
+    0x57, 0x8a, 0xcc, 0x50, 0x1, 0x43, 0x7, 0x10,
+    0x86, 0x0, 0x2, 0xb, 0x2, 0x60, 0x70, 0x12,
+    0x2a, 0x56, 0x5a, 0x75, 0x55, 0xb7, 0xa4, 0x5a,
+    0x31, 0xd1, 0x13, 0x80, 0x8, 0x59, 0x30, 0x10,
+    0x64, 0x4c, 0x6, 0x4, 0xaa, 0xaa, 0x92, 0x2,
+    0x0, 0xa, 0x50, 0x0, 0x10, 0x0, 0x0, 0x5a,
+    0x85, 0x59, 0xc0, 0x0, 0x4, 0x50, 0x64, 0x5a,
+    0x10, 0x0, 0x1, 0x0, 0x2d, 0xe2, 0x0, 0x0,
+    0x2, 0x57, 0x61, 0x3a, 0xdb, 0x93, 0x12, 0x0,
+    0x0, 0x0, 0x3, 0x30,
+
+    /* U+611F "感" */
+    0x0, 0x0, 0x0, 0x0, 0x41, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb0, 0xa2, 0x0, 0x0, 0x95,
+    0x55, 0x55, 0xc5, 0x67, 0xb0, 0x0, 0xb0, 0x0,
+    0x2, 0x91, 0x3, 0x0, 0x0, 0xb3, 0x55, 0x56,
+    0x73, 0x2d, 0x10, 0x0, 0xb0, 0x85, 0x58, 0x48,
+    0xb3, 0x0, 0x0, 0xb0, 0xb0, 0x1a, 0xe, 0x70,
+    0x10, 0x3, 0x70, 0xd5, 0x6a, 0x4a, 0xa0, 0x50,
+    0x8, 0x0, 0x60, 0x7, 0x40, 0x5c, 0xb0, 0x22,
+    0x0, 0x50, 0x75, 0x0, 0x32, 0x82, 0x0, 0x70,
+    0xd0, 0xc, 0x2, 0xc, 0x20, 0x7, 0x80, 0xb0,
+    0x0, 0x7, 0x6, 0x40, 0x5, 0x10, 0xb9, 0x99,
+    0x9c, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+614B "態" */
+    0x0, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
+    0x51, 0x1, 0xb0, 0x4, 0x0, 0x47, 0x10, 0x47,
+    0x1b, 0x58, 0x61, 0x8, 0xa8, 0x54, 0x91, 0xa0,
+    0x0, 0x70, 0xa, 0x55, 0x96, 0xb, 0x99, 0xa8,
+    0x0, 0xc5, 0x59, 0x51, 0xc0, 0x16, 0x0, 0xb,
+    0x0, 0x75, 0x1b, 0x69, 0x61, 0x0, 0xc4, 0x49,
+    0x51, 0xb0, 0x0, 0x60, 0xc, 0x6, 0xc4, 0xc,
+    0xaa, 0xb8, 0x0, 0x20, 0x55, 0x2a, 0x10, 0x3,
+    0x0, 0x6, 0xc, 0x10, 0x47, 0x4, 0x58, 0x4,
+    0xb0, 0xc0, 0x0, 0x0, 0x70, 0xc0, 0x42, 0xa,
+    0xba, 0xaa, 0xc9, 0x0, 0x0,
+
+    /* U+6163 "慣" */
+    0x0, 0x10, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0xb2, 0x0, 0xc5, 0x87, 0x5c, 0x0, 0x0, 0xb0,
+    0x0, 0xb0, 0x92, 0x1a, 0x50, 0x2, 0xb6, 0x56,
+    0xb5, 0xd5, 0x8a, 0x50, 0x7, 0xb6, 0x55, 0xa5,
+    0xd5, 0x97, 0x0, 0x49, 0xb2, 0x21, 0x10, 0x0,
+    0x22, 0x0, 0x31, 0xb0, 0xa, 0x55, 0x55, 0x5c,
+    0x0, 0x0, 0xb0, 0xb, 0x44, 0x44, 0x4b, 0x0,
+    0x0, 0xb0, 0xb, 0x11, 0x11, 0x1b, 0x0, 0x0,
+    0xb0, 0xb, 0x55, 0x55, 0x5b, 0x0, 0x0, 0xb0,
+    0xc, 0x55, 0x55, 0x5b, 0x0, 0x0, 0xb0, 0x3,
+    0xc4, 0x1, 0x84, 0x0, 0x0, 0xb0, 0x38, 0x20,
+    0x0, 0x1d, 0x30, 0x0, 0x10, 0x20, 0x0, 0x0,
+    0x1, 0x10,
+
+    /* U+6167 "慧" */
+    0x0, 0x3, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0xc1, 0x40, 0xc, 0x3, 0x20, 0x36, 0x5c, 0x55,
+    0x46, 0xc5, 0x53, 0x0, 0x65, 0xc6, 0x53, 0x6c,
+    0x59, 0x10, 0x45, 0x5c, 0x59, 0x35, 0xc5, 0x59,
+    0x1, 0x0, 0xa0, 0x0, 0x1a, 0x0, 0x0, 0x3,
+    0x65, 0x55, 0x55, 0x59, 0x70, 0x0, 0x5, 0x55,
+    0x55, 0x55, 0x95, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0x50, 0x0, 0x27, 0x65, 0x95, 0x55, 0x83,
+    0x0, 0x4, 0xa, 0x35, 0x90, 0x21, 0x70, 0x0,
+    0xa0, 0xa2, 0x3, 0x7, 0x13, 0xb0, 0x33, 0x7,
+    0xb9, 0x99, 0xc3, 0x3, 0x0,
+
+    /* U+616E "慮" */
+    0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2c, 0x11, 0x50, 0x0, 0x0, 0x10,
+    0x0, 0x1b, 0x44, 0x42, 0x0, 0x0, 0xb6, 0x55,
+    0x6a, 0x56, 0x5c, 0x50, 0x0, 0xa1, 0x24, 0x6b,
+    0x58, 0x35, 0x0, 0x0, 0xb1, 0x30, 0x1a, 0x22,
+    0x39, 0x0, 0x0, 0xb0, 0x20, 0x4, 0x66, 0xa3,
+    0x0, 0x0, 0xb0, 0xc5, 0x5b, 0x65, 0xc2, 0x0,
+    0x0, 0xb0, 0xb5, 0x5b, 0x65, 0xc0, 0x0, 0x0,
+    0x90, 0xc5, 0x5a, 0x65, 0xc0, 0x0, 0x4, 0x40,
+    0x28, 0x5, 0x60, 0x14, 0x0, 0x7, 0x4, 0x3d,
+    0x0, 0x91, 0x42, 0xd0, 0x32, 0x3d, 0xb, 0xba,
+    0xab, 0x80, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+61C9 "應" */
+    0x0, 0x0, 0x0, 0x41, 0x0, 0x0, 0x0, 0x0,
+    0x20, 0x0, 0x2b, 0x0, 0x1, 0x40, 0x0, 0xc5,
+    0x56, 0x57, 0x76, 0x56, 0x70, 0x0, 0xc0, 0x2d,
+    0x6b, 0x1b, 0x1, 0x0, 0x0, 0xc0, 0xb2, 0xc6,
+    0x5a, 0x57, 0x40, 0x0, 0xc4, 0xc4, 0xc5, 0x5c,
+    0x59, 0x0, 0x0, 0xc0, 0xb1, 0xa1, 0xa, 0x4,
+    0x0, 0x0, 0xb0, 0xb0, 0xa5, 0x5c, 0x55, 0x10,
+    0x0, 0xb0, 0xb0, 0xa5, 0x59, 0x56, 0x80, 0x3,
+    0x80, 0x40, 0x41, 0x0, 0x1, 0x0, 0x7, 0x34,
+    0x39, 0xa, 0x60, 0x24, 0x70, 0x8, 0x1b, 0x28,
+    0x0, 0x60, 0x70, 0xc1, 0x23, 0x54, 0xc, 0xaa,
+    0xab, 0xd1, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+61F8 "懸" */
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0xa5, 0x5b, 0x33, 0x57, 0x9a, 0x70, 0x0, 0xb5,
+    0x5b, 0x10, 0x19, 0x65, 0x10, 0x0, 0xa4, 0x4b,
+    0x13, 0xd6, 0x9a, 0x30, 0x0, 0xa5, 0x5b, 0x10,
+    0x5a, 0x32, 0x50, 0x0, 0xa0, 0x9, 0x55, 0xf9,
+    0xa5, 0xb2, 0x6, 0x97, 0xa5, 0x54, 0x60, 0xb3,
+    0x10, 0x2, 0xa4, 0x79, 0x24, 0xa1, 0xb3, 0xa0,
+    0x5, 0x2a, 0x52, 0x65, 0x26, 0xa0, 0x81, 0x0,
+    0x3, 0x50, 0x52, 0x6, 0x31, 0x0, 0x0, 0x51,
+    0x90, 0x1d, 0x10, 0x8, 0x50, 0x4, 0xa1, 0x90,
+    0x2, 0x0, 0x60, 0xc0, 0x7, 0x20, 0xca, 0xaa,
+    0xac, 0xa0, 0x0,
+
+    /* U+6210 "成" */
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0x15, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0x0, 0xc3, 0x0, 0x0, 0x75, 0x55,
+    0x5e, 0x55, 0x6b, 0x60, 0x0, 0xc1, 0x0, 0xb,
+    0x10, 0x0, 0x0, 0x0, 0xc1, 0x0, 0x9, 0x30,
+    0x38, 0x0, 0x0, 0xc5, 0x58, 0x46, 0x60, 0x97,
+    0x0, 0x0, 0xc0, 0x9, 0x33, 0x90, 0xd0, 0x0,
+    0x0, 0xc0, 0xa, 0x10, 0xd7, 0x70, 0x0, 0x0,
+    0xb0, 0xb, 0x0, 0x8e, 0x0, 0x20, 0x2, 0x74,
+    0x6c, 0x0, 0xbd, 0x50, 0x60, 0x7, 0x10, 0x75,
+    0x19, 0x12, 0xd9, 0x90, 0x6, 0x0, 0x2, 0x50,
+    0x0, 0x9, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6211 "我" */
+    0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x8d, 0x6a, 0x51, 0x30, 0x0, 0x2, 0x43,
+    0xc0, 0xa, 0x20, 0x99, 0x0, 0x0, 0x0, 0xc0,
+    0x9, 0x20, 0x9, 0x0, 0x5, 0x55, 0xd5, 0x5b,
+    0x75, 0x5a, 0x90, 0x1, 0x0, 0xc0, 0x7, 0x40,
+    0x1, 0x0, 0x0, 0x0, 0xc0, 0x5, 0x60, 0x79,
+    0x0, 0x0, 0x1, 0xe6, 0x33, 0x82, 0xb0, 0x0,
+    0x18, 0xc8, 0xc0, 0x0, 0xcb, 0x10, 0x0, 0x6,
+    0x10, 0xc0, 0x1, 0xe5, 0x0, 0x10, 0x0, 0x0,
+    0xc0, 0x29, 0x4c, 0x10, 0x50, 0x0, 0x43, 0xc4,
+    0x50, 0x2, 0xd6, 0x90, 0x0, 0x2d, 0x60, 0x0,
+    0x0, 0x18, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6216 "或" */
+    0x0, 0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe1, 0xb4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd0, 0x15, 0x40, 0x6, 0x55, 0x55,
+    0x55, 0xd5, 0x56, 0x70, 0x0, 0x0, 0x1, 0x0,
+    0xc0, 0x1, 0x0, 0x0, 0xd5, 0x5c, 0x50, 0xc0,
+    0xe, 0x10, 0x0, 0xc0, 0xa, 0x20, 0xa2, 0x4a,
+    0x0, 0x0, 0xc0, 0xa, 0x20, 0x74, 0xa3, 0x0,
+    0x0, 0xd5, 0x5c, 0x20, 0x3b, 0xb0, 0x0, 0x0,
+    0x50, 0x0, 0x0, 0xf, 0x40, 0x10, 0x0, 0x35,
+    0x77, 0x54, 0x98, 0xb0, 0x50, 0x1f, 0xa5, 0x10,
+    0x28, 0x10, 0x7c, 0xa0, 0x0, 0x0, 0x5, 0x40,
+    0x0, 0x5, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6226 "戦" */
+    0x0, 0x2, 0x0, 0x10, 0x4, 0x0, 0x0, 0x8,
+    0x18, 0x51, 0xb0, 0xe, 0x25, 0x0, 0x4, 0x81,
+    0x66, 0x10, 0xc, 0x9, 0x50, 0x9, 0x55, 0x77,
+    0xb0, 0xc, 0x1, 0x20, 0xb, 0x1, 0x90, 0xb0,
+    0x2d, 0x55, 0x80, 0xb, 0x55, 0xb5, 0xb5, 0x3c,
+    0x4, 0x20, 0xb, 0x1, 0x90, 0xb0, 0xc, 0xc,
+    0x40, 0xb, 0x55, 0xb5, 0xb0, 0xc, 0x59, 0x0,
+    0x7, 0x1, 0x90, 0x60, 0x9, 0xd1, 0x0, 0x0,
+    0x1, 0x90, 0x43, 0x8, 0x90, 0x0, 0x27, 0x55,
+    0xb5, 0x54, 0x4a, 0xd1, 0x51, 0x0, 0x1, 0x90,
+    0x3, 0x90, 0x4d, 0xb0, 0x0, 0x1, 0xa0, 0x56,
+    0x0, 0x6, 0xf1, 0x0, 0x0, 0x10, 0x10, 0x0,
+    0x0, 0x31,
+
+    /* U+6230 "戰" */
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0xa,
+    0x5b, 0x57, 0xb2, 0xd, 0x34, 0x0, 0xa, 0xa,
+    0x55, 0x91, 0xd, 0xa, 0x40, 0xb, 0x5b, 0x58,
+    0xb1, 0xc, 0x1, 0x10, 0x5, 0x2, 0x21, 0x50,
+    0xc, 0x46, 0x80, 0x7, 0x77, 0x95, 0xc3, 0x5c,
+    0x3, 0x10, 0x7, 0x77, 0x95, 0xa0, 0xb, 0xb,
+    0x40, 0x7, 0x33, 0x70, 0xa0, 0xa, 0x4a, 0x0,
+    0x8, 0x77, 0x95, 0xa0, 0x7, 0xd2, 0x0, 0x3,
+    0x3, 0x70, 0x20, 0x6, 0xb0, 0x0, 0x6, 0x57,
+    0x95, 0x74, 0x2a, 0xb3, 0x60, 0x0, 0x3, 0x70,
+    0x2, 0x80, 0x2d, 0xb0, 0x0, 0x4, 0x70, 0x34,
+    0x0, 0x4, 0xf0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x21,
+
+    /* U+623B "戻" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5a, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x55, 0x5a, 0x55, 0x5a, 0x0, 0x0, 0xd, 0x0,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0xd, 0x0, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0xe, 0x55, 0x55, 0x55,
+    0x5c, 0x0, 0x0, 0x1c, 0x0, 0x8, 0x40, 0x4,
+    0x0, 0x0, 0x3a, 0x0, 0xc, 0x20, 0x3, 0x0,
+    0x0, 0x66, 0x65, 0x5d, 0x75, 0x58, 0x40, 0x0,
+    0xa1, 0x0, 0x75, 0x43, 0x0, 0x0, 0x1, 0x90,
+    0x3, 0xa0, 0x9, 0x30, 0x0, 0x7, 0x10, 0x38,
+    0x0, 0x0, 0xb9, 0x20, 0x14, 0x15, 0x40, 0x0,
+    0x0, 0x8, 0xc2, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+623F "房" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2b, 0x0, 0x0, 0x0, 0x0, 0x3a,
+    0x55, 0x56, 0x55, 0x5d, 0x10, 0x0, 0x39, 0x0,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0x2b, 0x55, 0x55,
+    0x55, 0x5d, 0x0, 0x0, 0x38, 0x0, 0x8, 0x30,
+    0x1, 0x0, 0x0, 0x47, 0x0, 0x2, 0x70, 0x1,
+    0x50, 0x0, 0x56, 0x55, 0x8b, 0x55, 0x55, 0x50,
+    0x0, 0x82, 0x0, 0x68, 0x0, 0x5, 0x0, 0x0,
+    0xa0, 0x0, 0xb7, 0x55, 0x5e, 0x10, 0x2, 0x70,
+    0x2, 0xd0, 0x0, 0x1c, 0x0, 0x6, 0x10, 0x1c,
+    0x20, 0x0, 0x3a, 0x0, 0x13, 0x2, 0x92, 0x0,
+    0x17, 0xd5, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x40, 0x0,
+
+    /* U+6240 "所" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x21, 0x6b, 0x52, 0x4, 0x8c, 0x60, 0x0, 0xd4,
+    0x0, 0xa, 0x61, 0x0, 0x0, 0x0, 0xd0, 0x0,
+    0xa, 0x30, 0x0, 0x0, 0x0, 0xd5, 0x59, 0x29,
+    0x30, 0x0, 0x20, 0x0, 0xc0, 0xc, 0x9, 0x75,
+    0x96, 0x80, 0x0, 0xc0, 0xc, 0xa, 0x20, 0xb0,
+    0x0, 0x0, 0xd5, 0x5d, 0xc, 0x0, 0xb0, 0x0,
+    0x0, 0xc0, 0x8, 0xb, 0x0, 0xb0, 0x0, 0x0,
+    0xb0, 0x0, 0x47, 0x0, 0xb0, 0x0, 0x4, 0x60,
+    0x0, 0x91, 0x0, 0xb0, 0x0, 0x7, 0x0, 0x4,
+    0x50, 0x0, 0xb0, 0x0, 0x15, 0x0, 0x15, 0x0,
+    0x0, 0xb1, 0x0, 0x10, 0x0, 0x10, 0x0, 0x0,
+    0x10, 0x0,
+
+    /* U+624B "手" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x25, 0x8c, 0xf3, 0x0, 0x2, 0x45,
+    0x66, 0xd4, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc1, 0x0, 0x0, 0x0, 0x0, 0x55, 0x55, 0xd5,
+    0x55, 0xd5, 0x0, 0x0, 0x10, 0x0, 0xc1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc1, 0x0, 0x0,
+    0x0, 0x25, 0x55, 0x55, 0xd5, 0x55, 0x5b, 0xa0,
+    0x1, 0x0, 0x0, 0xc1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+624D "才" */
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd0, 0x0, 0x50, 0x5, 0x65, 0x55, 0x5c,
+    0xd5, 0x56, 0x71, 0x0, 0x0, 0x0, 0x6a, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xd1, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0x30, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x75, 0x0, 0xd0, 0x0, 0x0, 0x0,
+    0x6, 0x50, 0x0, 0xd0, 0x0, 0x0, 0x0, 0x63,
+    0x0, 0x0, 0xd0, 0x0, 0x0, 0x5, 0x10, 0x1,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0,
+    0x0, 0x0,
+
+    /* U+6253 "打" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x55, 0x57, 0x58, 0x90, 0x15, 0x5d, 0x5a,
+    0x10, 0xd, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0xd, 0x0, 0x0, 0x0, 0xc, 0x1, 0x0, 0xd,
+    0x0, 0x0, 0x0, 0xc, 0x73, 0x0, 0xd, 0x0,
+    0x0, 0x29, 0xbd, 0x0, 0x0, 0xd, 0x0, 0x0,
+    0x5, 0xc, 0x0, 0x0, 0xd, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0xd, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0xd, 0x0, 0x0, 0x3, 0x2d, 0x0,
+    0x3, 0x1d, 0x0, 0x0, 0x1, 0xbc, 0x0, 0x2,
+    0xca, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10,
+    0x0, 0x0,
+
+    /* U+6255 "払" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb2, 0x0, 0x8, 0x50, 0x0, 0x0, 0xb, 0x0,
+    0x0, 0xd3, 0x0, 0x1, 0x55, 0xd5, 0xa1, 0x1d,
+    0x0, 0x0, 0x0, 0xb, 0x0, 0x5, 0x80, 0x0,
+    0x0, 0x0, 0xb0, 0x11, 0x92, 0x0, 0x0, 0x0,
+    0xc, 0x74, 0xb, 0x0, 0x0, 0x2, 0xab, 0xd0,
+    0x3, 0x70, 0x4, 0x0, 0x5, 0xb, 0x0, 0x72,
+    0x0, 0x43, 0x0, 0x0, 0xb0, 0x9, 0x0, 0x0,
+    0xb0, 0x0, 0xb, 0x3, 0x60, 0x0, 0x8, 0x70,
+    0x32, 0xd0, 0xcb, 0xa9, 0x76, 0x7c, 0x1, 0xbb,
+    0x4, 0x40, 0x0, 0x2, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+627E "找" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x20, 0x8, 0x61, 0x40, 0x0, 0x0, 0xc,
+    0x0, 0x8, 0x40, 0x8a, 0x0, 0x0, 0xc, 0x4,
+    0x8, 0x40, 0x5, 0x0, 0x16, 0x5d, 0x55, 0x19,
+    0x64, 0x5b, 0x30, 0x0, 0xc, 0x3, 0x39, 0x40,
+    0x0, 0x0, 0x0, 0xc, 0x64, 0x7, 0x50, 0x6a,
+    0x0, 0x28, 0xae, 0x0, 0x5, 0x74, 0xc1, 0x0,
+    0x16, 0xc, 0x0, 0x2, 0xdb, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x5, 0xf2, 0x0, 0x30, 0x0, 0xc,
+    0x0, 0x75, 0x2c, 0x10, 0x60, 0x3, 0x3d, 0x5,
+    0x10, 0x4, 0xd8, 0x70, 0x1, 0xaa, 0x0, 0x0,
+    0x0, 0x2b, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6280 "技" */
+    0x0, 0x3, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0xd, 0x10, 0x0, 0xe, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0x15, 0x5d, 0x6a,
+    0x35, 0x5d, 0x55, 0xb1, 0x0, 0xc, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0xc, 0x75, 0x47, 0x59, 0x5d,
+    0x30, 0x18, 0xbd, 0x0, 0x6, 0x0, 0x1b, 0x0,
+    0x6, 0xc, 0x0, 0x3, 0x40, 0x84, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x94, 0xb0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x5f, 0x20, 0x0, 0x1, 0xc, 0x0,
+    0x7, 0x95, 0xc4, 0x0, 0x3, 0xcc, 0x15, 0x72,
+    0x0, 0x2a, 0xd3, 0x0, 0x10, 0x20, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+628A "把" */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x10, 0x10, 0x0, 0x2, 0x0, 0x0, 0xc,
+    0x0, 0xd5, 0x5b, 0x5d, 0x30, 0x15, 0x5d, 0x77,
+    0xc0, 0xb, 0xb, 0x0, 0x0, 0xc, 0x0, 0xc0,
+    0xb, 0xb, 0x0, 0x0, 0xc, 0x0, 0xc0, 0xb,
+    0xb, 0x0, 0x0, 0xd, 0x73, 0xd5, 0x57, 0x5c,
+    0x10, 0x2a, 0xbd, 0x0, 0xc0, 0x0, 0x0, 0x0,
+    0x5, 0xc, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0xc0, 0x0, 0x0, 0x10, 0x0, 0xc,
+    0x0, 0xc0, 0x0, 0x0, 0x50, 0x0, 0xc, 0x0,
+    0xc0, 0x0, 0x0, 0xa0, 0x5, 0xbb, 0x0, 0xab,
+    0xaa, 0xab, 0xd0, 0x0, 0x21, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6295 "投" */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0x10, 0x9, 0x55, 0xa1, 0x0, 0x0, 0xc,
+    0x0, 0xb, 0x0, 0xc0, 0x0, 0x5, 0x5d, 0x78,
+    0x2a, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x55,
+    0x0, 0xc0, 0x0, 0x0, 0xc, 0x1, 0x90, 0x0,
+    0x8a, 0xb3, 0x0, 0xd, 0x67, 0x65, 0x55, 0x87,
+    0x0, 0x18, 0xbc, 0x0, 0x5, 0x0, 0xa3, 0x0,
+    0x6, 0xc, 0x0, 0x6, 0x11, 0xb0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x9a, 0x30, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0xac, 0x0, 0x0, 0x1, 0xc, 0x0,
+    0x19, 0x57, 0xc3, 0x0, 0x3, 0xc8, 0x15, 0x60,
+    0x0, 0x3c, 0xb1, 0x0, 0x0, 0x20, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+62BC "押" */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x85, 0x55, 0x55, 0xa0, 0x0, 0xc,
+    0x0, 0xc0, 0xc, 0x1, 0xb0, 0x5, 0x5d, 0x95,
+    0xc0, 0xc, 0x1, 0xb0, 0x0, 0xc, 0x0, 0xd5,
+    0x5d, 0x56, 0xb0, 0x0, 0xc, 0x1, 0xc0, 0xc,
+    0x1, 0xb0, 0x0, 0xe, 0x61, 0xc0, 0xc, 0x1,
+    0xb0, 0x17, 0xbc, 0x0, 0xd5, 0x5d, 0x56, 0xb0,
+    0x19, 0xc, 0x0, 0xa0, 0xc, 0x0, 0x60, 0x0,
+    0xc, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0x1, 0x2c, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x3, 0xd7, 0x0, 0x0,
+    0xd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x0, 0x0,
+
+    /* U+62C5 "担" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x10, 0x0, 0x0, 0x1, 0x0, 0x0, 0xc,
+    0x0, 0x96, 0x55, 0x5e, 0x10, 0x0, 0xc, 0x13,
+    0x92, 0x0, 0xd, 0x0, 0x5, 0x5d, 0x54, 0x92,
+    0x0, 0xd, 0x0, 0x0, 0xc, 0x1, 0x97, 0x55,
+    0x5d, 0x0, 0x0, 0xc, 0x71, 0x92, 0x0, 0xd,
+    0x0, 0x5, 0xbe, 0x0, 0x92, 0x0, 0xd, 0x0,
+    0x1a, 0x1c, 0x0, 0x92, 0x0, 0xd, 0x0, 0x0,
+    0xc, 0x0, 0xa7, 0x55, 0x5e, 0x0, 0x0, 0xc,
+    0x0, 0x50, 0x0, 0x2, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0x2, 0x70, 0x3, 0xbc, 0x6, 0x55,
+    0x55, 0x55, 0x50, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+62C9 "拉" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x20, 0x0, 0x70, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x6a, 0x0, 0x0, 0x2, 0x2c, 0x36,
+    0x0, 0x16, 0x1, 0x0, 0x3, 0x2c, 0x22, 0x55,
+    0x55, 0x58, 0x50, 0x0, 0xc, 0x0, 0x0, 0x0,
+    0x42, 0x0, 0x0, 0xc, 0x64, 0x23, 0x0, 0x97,
+    0x0, 0x2, 0x9e, 0x10, 0xa, 0x0, 0xb1, 0x0,
+    0x2d, 0x3c, 0x0, 0xa, 0x30, 0xb0, 0x0, 0x0,
+    0xc, 0x0, 0x8, 0x73, 0x70, 0x0, 0x0, 0xc,
+    0x0, 0x4, 0x27, 0x10, 0x0, 0x1, 0xd, 0x0,
+    0x0, 0x7, 0x0, 0x50, 0x2, 0xbc, 0x6, 0x55,
+    0x56, 0x56, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+62DB "招" */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc0, 0x25, 0x55, 0x55, 0x76, 0x0, 0xb, 0x0,
+    0x6, 0x70, 0x7, 0x50, 0x55, 0xc6, 0x80, 0x83,
+    0x0, 0x83, 0x0, 0xb, 0x0, 0xb, 0x0, 0xa,
+    0x10, 0x0, 0xb0, 0x4, 0x60, 0x55, 0xd0, 0x0,
+    0xc, 0x73, 0x80, 0x0, 0xa5, 0x1, 0x7b, 0xc0,
+    0x46, 0x55, 0x55, 0x92, 0x8, 0xb, 0x0, 0xa1,
+    0x0, 0xb, 0x0, 0x0, 0xb0, 0xa, 0x10, 0x0,
+    0xb0, 0x0, 0xb, 0x0, 0xa1, 0x0, 0xb, 0x0,
+    0x0, 0xb0, 0xa, 0x65, 0x55, 0xd0, 0x3, 0xc9,
+    0x0, 0x90, 0x0, 0x8, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+62E1 "拡" */
+    0x0, 0x2, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x20, 0xa, 0x0, 0x50, 0x0, 0xc, 0x12,
+    0xd5, 0x55, 0x55, 0x61, 0x5, 0x5d, 0x54, 0xc0,
+    0x1, 0x0, 0x0, 0x0, 0xc, 0x0, 0xc0, 0xa,
+    0x70, 0x0, 0x0, 0xc, 0x52, 0xc0, 0xd, 0x0,
+    0x0, 0x0, 0x7d, 0x10, 0xc0, 0x38, 0x0, 0x0,
+    0x2e, 0x5c, 0x0, 0xc0, 0x81, 0x0, 0x0, 0x1,
+    0xc, 0x1, 0xa0, 0x80, 0x7, 0x0, 0x0, 0xc,
+    0x5, 0x55, 0x30, 0x3, 0xa0, 0x0, 0xc, 0x9,
+    0xd, 0xa8, 0x65, 0xd2, 0x5, 0xd8, 0x42, 0x3,
+    0x0, 0x0, 0x50, 0x0, 0x10, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+62EC "括" */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x20, 0x0, 0x2, 0x7c, 0x10, 0x0, 0xc,
+    0x0, 0x35, 0x7d, 0x41, 0x0, 0x17, 0x5d, 0x5a,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0xc, 0x0, 0x30, 0x0, 0xc, 0x3, 0x65, 0x5d,
+    0x56, 0x80, 0x0, 0xc, 0x54, 0x0, 0xc, 0x0,
+    0x0, 0x16, 0xae, 0x10, 0x20, 0xc, 0x3, 0x0,
+    0x19, 0x1c, 0x0, 0xc5, 0x55, 0x5d, 0x10, 0x0,
+    0xc, 0x0, 0xc0, 0x0, 0xc, 0x0, 0x0, 0xc,
+    0x0, 0xc0, 0x0, 0xc, 0x0, 0x2, 0x2d, 0x0,
+    0xc5, 0x55, 0x5d, 0x0, 0x1, 0xaa, 0x0, 0xc0,
+    0x0, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+62ED "拭" */
+    0x0, 0x2, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0xe, 0x10, 0x0, 0xd, 0x29, 0x30, 0x0, 0xc,
+    0x0, 0x0, 0xd, 0x2, 0x80, 0x0, 0xc, 0x23,
+    0x0, 0xc, 0x1, 0x50, 0x16, 0x5d, 0x54, 0x46,
+    0x5d, 0x55, 0x50, 0x0, 0xc, 0x0, 0x0, 0xa,
+    0x10, 0x0, 0x0, 0xd, 0x66, 0x55, 0x89, 0x20,
+    0x0, 0x18, 0xbd, 0x0, 0xc, 0x6, 0x50, 0x0,
+    0x18, 0xc, 0x0, 0xc, 0x3, 0x80, 0x0, 0x0,
+    0xc, 0x0, 0xc, 0x0, 0xc0, 0x0, 0x0, 0xc,
+    0x0, 0x1d, 0x63, 0x86, 0x41, 0x1, 0xc, 0xa,
+    0xa4, 0x0, 0xd, 0xc0, 0x3, 0xd8, 0x0, 0x0,
+    0x0, 0x1, 0xc2, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+62FF "拿" */
+    0x0, 0x0, 0x0, 0x14, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb9, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x3b, 0x30, 0x66, 0x0, 0x0, 0x0, 0x17, 0x76,
+    0x55, 0x86, 0xb9, 0x62, 0x4, 0x40, 0x85, 0x55,
+    0x59, 0x13, 0x60, 0x0, 0x0, 0xc0, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0x0, 0xd5, 0x55, 0x5a, 0x10,
+    0x0, 0x0, 0x23, 0x45, 0x68, 0xac, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x2a, 0x0, 0x40, 0x0, 0x0,
+    0x36, 0x55, 0x6c, 0x56, 0x92, 0x0, 0x4, 0x55,
+    0x55, 0x6c, 0x55, 0x5a, 0x90, 0x0, 0x0, 0x0,
+    0x2a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xd7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0,
+    0x0, 0x0,
+
+    /* U+6301 "持" */
+    0x0, 0x4, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0, 0xc,
+    0x1, 0x44, 0xc5, 0x49, 0x0, 0x5, 0x5d, 0x86,
+    0x11, 0xb2, 0x11, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0xb1, 0x0, 0x20, 0x0, 0xc, 0x6, 0x55, 0x86,
+    0x56, 0x90, 0x0, 0xd, 0x62, 0x0, 0x7, 0x70,
+    0x0, 0x7, 0xbc, 0x5, 0x55, 0x5a, 0x87, 0x90,
+    0x6, 0xc, 0x1, 0x20, 0x7, 0x50, 0x0, 0x0,
+    0xc, 0x0, 0x85, 0x7, 0x50, 0x0, 0x0, 0xc,
+    0x0, 0x19, 0x7, 0x50, 0x0, 0x1, 0x1c, 0x0,
+    0x0, 0x7, 0x50, 0x0, 0x2, 0xc8, 0x0, 0x0,
+    0x7f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0,
+
+    /* U+6307 "指" */
+    0x0, 0x5, 0x0, 0x31, 0x0, 0x0, 0x0, 0x0,
+    0xc1, 0x8, 0x60, 0x3, 0x70, 0x0, 0xc, 0x0,
+    0x83, 0x18, 0xa5, 0x0, 0x55, 0xd6, 0xb8, 0x75,
+    0x10, 0x3, 0x1, 0xc, 0x0, 0x84, 0x0, 0x0,
+    0x70, 0x0, 0xc0, 0x35, 0xc9, 0x99, 0xb9, 0x0,
+    0xc, 0x70, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xe0,
+    0x6, 0x75, 0x55, 0xc1, 0x1b, 0x2c, 0x0, 0x65,
+    0x0, 0xc, 0x0, 0x0, 0xc0, 0x6, 0x85, 0x55,
+    0xd0, 0x0, 0xc, 0x0, 0x65, 0x0, 0xc, 0x0,
+    0x10, 0xd0, 0x6, 0x85, 0x55, 0xd0, 0x2, 0xba,
+    0x0, 0x74, 0x0, 0xb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+6319 "挙" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0x0, 0x91, 0x5, 0xb0, 0x0, 0x0, 0x5,
+    0xb0, 0x5a, 0xa, 0x10, 0x0, 0x0, 0x0, 0x70,
+    0x4, 0x34, 0x4, 0x30, 0x6, 0x55, 0xc5, 0x55,
+    0x95, 0x57, 0x60, 0x0, 0x5, 0x80, 0x0, 0x66,
+    0x0, 0x0, 0x0, 0x3a, 0x46, 0x9b, 0xa6, 0xb4,
+    0x0, 0x5, 0x60, 0x0, 0xb0, 0x0, 0x7c, 0x80,
+    0x31, 0x55, 0x55, 0xc5, 0x55, 0x71, 0x0, 0x0,
+    0x0, 0x0, 0xb0, 0x0, 0x7, 0x30, 0x7, 0x55,
+    0x55, 0xc5, 0x55, 0x55, 0x40, 0x0, 0x0, 0x0,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+6355 "捕" */
+    0x0, 0x2, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x0, 0xb2, 0x81, 0x0, 0x0, 0xb,
+    0x0, 0x0, 0xb0, 0x36, 0x10, 0x0, 0xb, 0x45,
+    0x55, 0xc5, 0x56, 0x90, 0x4, 0x4c, 0x41, 0x0,
+    0xb0, 0x0, 0x0, 0x0, 0xb, 0xa, 0x65, 0xc5,
+    0x5c, 0x20, 0x0, 0xd, 0x59, 0x10, 0xb0, 0xb,
+    0x0, 0x7, 0xbb, 0x9, 0x65, 0xc5, 0x5c, 0x0,
+    0x7, 0xb, 0x9, 0x10, 0xb0, 0xb, 0x0, 0x0,
+    0xb, 0x9, 0x65, 0xc5, 0x5c, 0x0, 0x0, 0xb,
+    0x9, 0x10, 0xb0, 0xb, 0x0, 0x0, 0xb, 0x9,
+    0x10, 0xb0, 0xb, 0x0, 0x4, 0xc7, 0xa, 0x10,
+    0xb2, 0x8d, 0x0, 0x0, 0x10, 0x2, 0x0, 0x10,
+    0x1, 0x0,
+
+    /* U+6368 "捨" */
+    0x0, 0x2, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0xe, 0x0, 0x0, 0xe1, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x8, 0x57, 0x0, 0x0, 0x0, 0xc, 0x41,
+    0x47, 0x2, 0x90, 0x0, 0x5, 0x5d, 0x55, 0x70,
+    0x0, 0x8c, 0x72, 0x0, 0xc, 0x14, 0x25, 0xc5,
+    0x63, 0x71, 0x0, 0xc, 0x43, 0x0, 0xb0, 0x2,
+    0x20, 0x1, 0x8e, 0x24, 0x65, 0xc5, 0x56, 0x50,
+    0xc, 0x4c, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0xc5, 0x85, 0x5d, 0x10, 0x0, 0xc,
+    0x0, 0xb0, 0x0, 0xc, 0x0, 0x1, 0xc, 0x0,
+    0xb0, 0x0, 0xc, 0x0, 0x4, 0xd8, 0x0, 0xd5,
+    0x55, 0x5d, 0x0, 0x0, 0x10, 0x0, 0x20, 0x0,
+    0x1, 0x0,
+
+    /* U+6388 "授" */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0xd, 0x0, 0x1, 0x47, 0xad, 0x40, 0x0, 0xb,
+    0x1, 0x43, 0x30, 0x9, 0x20, 0x5, 0x5c, 0x84,
+    0x90, 0xa2, 0x2a, 0x0, 0x0, 0xb, 0x0, 0x75,
+    0x63, 0x71, 0x0, 0x0, 0xb, 0x27, 0x55, 0x55,
+    0x85, 0xb0, 0x0, 0x1d, 0x5c, 0x0, 0x0, 0x5,
+    0x30, 0x17, 0xab, 0x2, 0x55, 0x55, 0xa4, 0x0,
+    0x17, 0xb, 0x0, 0x5, 0x2, 0xc1, 0x0, 0x0,
+    0xb, 0x0, 0x3, 0x5b, 0x20, 0x0, 0x0, 0xb,
+    0x0, 0x0, 0xd8, 0x0, 0x0, 0x0, 0xb, 0x0,
+    0x2a, 0x48, 0x93, 0x0, 0x5, 0xd7, 0x16, 0x60,
+    0x0, 0x4b, 0xc2, 0x0, 0x10, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6392 "排" */
+    0x0, 0x5, 0x0, 0x4, 0x10, 0x40, 0x0, 0x0,
+    0xc, 0x0, 0x9, 0x50, 0xd0, 0x0, 0x0, 0xb,
+    0x0, 0x9, 0x20, 0xb0, 0x0, 0x5, 0x5c, 0x96,
+    0x5b, 0x20, 0xc5, 0x84, 0x0, 0xb, 0x0, 0x9,
+    0x20, 0xb0, 0x0, 0x0, 0xb, 0x11, 0x9, 0x20,
+    0xb0, 0x10, 0x0, 0x2d, 0x52, 0x5b, 0x20, 0xc5,
+    0x82, 0x1b, 0xab, 0x0, 0x9, 0x20, 0xb0, 0x0,
+    0x3, 0xb, 0x0, 0x9, 0x20, 0xb0, 0x21, 0x0,
+    0xb, 0x15, 0x5b, 0x20, 0xc5, 0x64, 0x0, 0xb,
+    0x0, 0x9, 0x20, 0xb0, 0x0, 0x1, 0xb, 0x0,
+    0x9, 0x20, 0xb0, 0x0, 0x3, 0xc7, 0x0, 0x9,
+    0x20, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x10, 0x0,
+
+    /* U+639B "掛" */
+    0x0, 0x20, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0xa3, 0x0, 0x1b, 0x0, 0xb2, 0x0, 0x0, 0xa1,
+    0x0, 0x19, 0x0, 0xb0, 0x0, 0x0, 0xa2, 0x25,
+    0x5b, 0x91, 0xb0, 0x0, 0x35, 0xc6, 0x40, 0x19,
+    0x0, 0xb0, 0x0, 0x0, 0xa1, 0x0, 0x19, 0x13,
+    0xb5, 0x0, 0x0, 0xa2, 0x35, 0x57, 0x54, 0xb4,
+    0xb0, 0x3, 0xd4, 0x0, 0x1b, 0x0, 0xb0, 0xa0,
+    0x6a, 0xb1, 0x15, 0x6b, 0x83, 0xb0, 0x0, 0x0,
+    0xa1, 0x0, 0x19, 0x0, 0xb0, 0x0, 0x0, 0xa1,
+    0x0, 0x19, 0x0, 0xb0, 0x0, 0x0, 0xb0, 0x2,
+    0x5b, 0x53, 0xb0, 0x0, 0x8, 0xb0, 0x5b, 0x40,
+    0x0, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+63A1 "採" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0,
+    0xd, 0x0, 0x14, 0x69, 0xcc, 0x10, 0x0, 0xb,
+    0x3, 0x33, 0x0, 0x2, 0x40, 0x0, 0xb, 0x44,
+    0x31, 0x90, 0x9, 0x60, 0x5, 0x5c, 0x52, 0xc2,
+    0x85, 0x37, 0x0, 0x0, 0xb, 0x0, 0x40, 0x51,
+    0x40, 0x0, 0x0, 0xb, 0x42, 0x0, 0x93, 0x2,
+    0x40, 0x0, 0x6d, 0x24, 0x59, 0xf9, 0x55, 0x40,
+    0x1e, 0x6b, 0x0, 0xb, 0xb8, 0x10, 0x0, 0x1,
+    0xb, 0x0, 0x46, 0x92, 0xa0, 0x0, 0x0, 0xb,
+    0x1, 0x80, 0x92, 0x69, 0x0, 0x0, 0xb, 0x7,
+    0x0, 0x92, 0xb, 0xb2, 0x4, 0xd8, 0x20, 0x0,
+    0x92, 0x0, 0x20, 0x0, 0x10, 0x0, 0x0, 0x20,
+    0x0, 0x0,
+
+    /* U+63A2 "探" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x75, 0x55, 0x55, 0x82, 0x0, 0xb,
+    0x1, 0xb0, 0x0, 0x0, 0xa1, 0x0, 0xb, 0x44,
+    0x25, 0x92, 0x51, 0x0, 0x5, 0x5c, 0x53, 0x1b,
+    0x10, 0x3d, 0x30, 0x0, 0xb, 0x3, 0x81, 0x1a,
+    0x3, 0x50, 0x0, 0xd, 0x62, 0x0, 0x1a, 0x0,
+    0x50, 0x6, 0xbb, 0x5, 0x55, 0xec, 0x75, 0x63,
+    0x8, 0xb, 0x0, 0x6, 0x9a, 0x70, 0x0, 0x0,
+    0xb, 0x0, 0x1b, 0x1a, 0x46, 0x0, 0x0, 0xb,
+    0x0, 0x91, 0x1a, 0xa, 0x70, 0x0, 0xb, 0x7,
+    0x10, 0x1a, 0x0, 0xb6, 0x2, 0xb7, 0x20, 0x0,
+    0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+63A5 "接" */
+    0x0, 0x4, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x94, 0x0, 0x0, 0x0, 0xb,
+    0x1, 0x55, 0x77, 0x58, 0x60, 0x5, 0x5c, 0x77,
+    0x34, 0x0, 0xa1, 0x0, 0x0, 0xb, 0x0, 0xb,
+    0x23, 0x70, 0x0, 0x0, 0xb, 0x5, 0x57, 0x68,
+    0x55, 0xb1, 0x0, 0xc, 0x51, 0x1, 0xc0, 0x0,
+    0x0, 0x16, 0xab, 0x0, 0x8, 0x50, 0x0, 0x50,
+    0x18, 0xb, 0x35, 0x5c, 0x55, 0xc6, 0x62, 0x0,
+    0xb, 0x0, 0x73, 0x2, 0xb0, 0x0, 0x0, 0xb,
+    0x0, 0x57, 0x7c, 0x20, 0x0, 0x1, 0xb, 0x0,
+    0x1, 0xa6, 0xb8, 0x0, 0x2, 0xc7, 0x3, 0x78,
+    0x10, 0x7, 0xa0, 0x0, 0x10, 0x31, 0x0, 0x0,
+    0x0, 0x10,
+
+    /* U+63A7 "控" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0x10, 0x1, 0x82, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x10, 0x39, 0x0, 0x10, 0x5, 0x5d, 0x83,
+    0x94, 0x44, 0x46, 0xb0, 0x0, 0xc, 0x5, 0x55,
+    0x32, 0x4, 0x0, 0x0, 0xc, 0x0, 0x1c, 0x20,
+    0x97, 0x0, 0x0, 0xd, 0x63, 0x91, 0x0, 0xb,
+    0x50, 0x5, 0xad, 0x4, 0x0, 0x0, 0x26, 0x10,
+    0x1a, 0x1c, 0x0, 0x55, 0xc6, 0x54, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0xa2, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0xa2, 0x1, 0x60, 0x5, 0xb9, 0x6, 0x55,
+    0x55, 0x55, 0x50, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+63A8 "推" */
+    0x0, 0x2, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x3d, 0x9, 0x20, 0x0, 0x0, 0xb,
+    0x0, 0x76, 0x4, 0x70, 0x20, 0x5, 0x5c, 0x76,
+    0xb5, 0x5a, 0x55, 0x80, 0x0, 0xb, 0x0, 0xf0,
+    0xb, 0x0, 0x0, 0x0, 0xb, 0x7, 0xd0, 0xb,
+    0x3, 0x20, 0x0, 0x1d, 0x45, 0xb5, 0x5c, 0x55,
+    0x30, 0x19, 0x9b, 0x0, 0xb0, 0xb, 0x0, 0x0,
+    0x5, 0xb, 0x0, 0xb5, 0x5c, 0x57, 0x80, 0x0,
+    0xb, 0x0, 0xb0, 0xb, 0x0, 0x0, 0x0, 0xb,
+    0x0, 0xb0, 0xb, 0x0, 0x0, 0x0, 0xb, 0x0,
+    0xb5, 0x5c, 0x56, 0xc1, 0x3, 0xc6, 0x0, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+63CF "描" */
+    0x0, 0x4, 0x0, 0x1, 0x0, 0x10, 0x0, 0x0,
+    0xe, 0x10, 0x8, 0x60, 0xc2, 0x0, 0x0, 0xc,
+    0x0, 0x8, 0x30, 0xc0, 0x20, 0x0, 0xc, 0x26,
+    0x5a, 0x75, 0xd5, 0x81, 0x6, 0x5d, 0x54, 0x8,
+    0x30, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x4, 0x10,
+    0x40, 0x10, 0x0, 0xc, 0x53, 0xc5, 0x5a, 0x56,
+    0xc0, 0x5, 0x9d, 0x10, 0xb0, 0xb, 0x1, 0xa0,
+    0x9, 0x1c, 0x0, 0xc5, 0x5c, 0x56, 0xa0, 0x0,
+    0xc, 0x0, 0xb0, 0xb, 0x1, 0xa0, 0x0, 0xc,
+    0x0, 0xb0, 0xb, 0x1, 0xa0, 0x3, 0x2c, 0x0,
+    0xc5, 0x5c, 0x56, 0xa0, 0x2, 0xc7, 0x0, 0xa0,
+    0x0, 0x1, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+63D0 "提" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x85, 0x55, 0x5a, 0x0, 0x0, 0xb,
+    0x0, 0x91, 0x0, 0xa, 0x0, 0x5, 0x5c, 0x84,
+    0x96, 0x55, 0x5a, 0x0, 0x0, 0xb, 0x0, 0x91,
+    0x0, 0xa, 0x0, 0x0, 0xb, 0x1, 0xa6, 0x55,
+    0x5a, 0x0, 0x0, 0xd, 0x60, 0x30, 0x0, 0x0,
+    0x50, 0x8, 0xab, 0x17, 0x55, 0x5c, 0x55, 0x62,
+    0x6, 0xb, 0x2, 0xa0, 0xb, 0x0, 0x0, 0x0,
+    0xb, 0x5, 0x70, 0xc, 0x56, 0x60, 0x0, 0xb,
+    0x9, 0x63, 0xb, 0x0, 0x0, 0x1, 0x2b, 0x26,
+    0x8, 0x9c, 0x0, 0x0, 0x2, 0xc6, 0x50, 0x0,
+    0x4a, 0xde, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+63DB "換" */
+    0x0, 0x2, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x2c, 0x0, 0x9, 0x41, 0x20, 0x0, 0x0, 0x19,
+    0x0, 0x38, 0x5b, 0xa0, 0x0, 0x5, 0x6b, 0x94,
+    0x50, 0x26, 0x0, 0x0, 0x0, 0x19, 0x0, 0xa5,
+    0x75, 0x5b, 0x20, 0x0, 0x19, 0x3, 0xb5, 0x65,
+    0xa, 0x0, 0x0, 0x2d, 0x60, 0xb8, 0x1, 0xcb,
+    0x0, 0x9, 0xc9, 0x0, 0xc2, 0x81, 0x6b, 0x0,
+    0x5, 0x19, 0x0, 0x40, 0xc0, 0x4, 0x30, 0x0,
+    0x19, 0x16, 0x56, 0xb7, 0x55, 0x81, 0x0, 0x19,
+    0x0, 0x9, 0x25, 0x20, 0x0, 0x0, 0x19, 0x0,
+    0x76, 0x0, 0xa6, 0x0, 0x4, 0xc7, 0x37, 0x20,
+    0x0, 0x9, 0xd2, 0x0, 0x20, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+63EE "揮" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x93, 0x7, 0x55, 0x55, 0x56, 0x80, 0x0, 0x92,
+    0xe, 0x10, 0x62, 0x7, 0x30, 0x0, 0x93, 0x13,
+    0x0, 0xb1, 0x6, 0x0, 0x35, 0xb7, 0x45, 0x55,
+    0xc5, 0x55, 0x20, 0x0, 0x92, 0x6, 0x55, 0xc5,
+    0x5a, 0x20, 0x0, 0x93, 0x49, 0x20, 0xb0, 0xb,
+    0x0, 0x1, 0xc6, 0x9, 0x65, 0xc5, 0x5c, 0x0,
+    0x6c, 0xb2, 0x9, 0x65, 0xc5, 0x5c, 0x0, 0x10,
+    0x92, 0x5, 0x0, 0xb0, 0x4, 0x0, 0x0, 0x92,
+    0x26, 0x55, 0xc5, 0x58, 0x80, 0x0, 0x92, 0x0,
+    0x0, 0xb0, 0x0, 0x0, 0x29, 0xe0, 0x0, 0x0,
+    0xb0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x30,
+    0x0, 0x0,
+
+    /* U+63FA "揺" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x1, 0x10, 0x0,
+    0xd, 0x0, 0x1, 0x48, 0xbd, 0xa0, 0x0, 0xb,
+    0x2, 0x44, 0x31, 0x0, 0x80, 0x0, 0xb, 0x34,
+    0x20, 0x91, 0x5, 0xa0, 0x5, 0x5c, 0x53, 0xc1,
+    0x67, 0x8, 0x0, 0x0, 0xb, 0x0, 0x40, 0x1,
+    0x22, 0x20, 0x0, 0xb, 0x53, 0x55, 0x5b, 0x56,
+    0x50, 0x1, 0x7d, 0x10, 0x0, 0xb, 0x0, 0x20,
+    0x1e, 0x5b, 0x6, 0x55, 0x5c, 0x55, 0x95, 0x1,
+    0xb, 0x0, 0x40, 0xb, 0x0, 0x20, 0x0, 0xb,
+    0x0, 0xc0, 0xb, 0x0, 0xc0, 0x0, 0x1b, 0x0,
+    0xa0, 0xb, 0x0, 0xa0, 0x5, 0xe7, 0x1, 0xa5,
+    0x57, 0x55, 0xb0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x10,
+
+    /* U+643A "携" */
+    0x0, 0x2, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x1d, 0x1b, 0x10, 0x0, 0x0, 0xb,
+    0x0, 0x88, 0x5b, 0x67, 0x80, 0x5, 0x5c, 0x93,
+    0xf0, 0xa, 0x3, 0x10, 0x0, 0xb, 0x6, 0xb5,
+    0x5c, 0x55, 0x30, 0x0, 0xb, 0x22, 0xb5, 0x5c,
+    0x59, 0x30, 0x0, 0x1d, 0x40, 0xb0, 0xa, 0x0,
+    0x30, 0x19, 0xab, 0x0, 0xb5, 0x56, 0x55, 0x60,
+    0x6, 0xb, 0x3, 0x68, 0x55, 0x96, 0x0, 0x0,
+    0xb, 0x0, 0xd, 0x0, 0xb0, 0x40, 0x0, 0xb,
+    0x0, 0x48, 0x1, 0x75, 0xd0, 0x0, 0xb, 0x1,
+    0xb1, 0x0, 0x3, 0x80, 0x4, 0xc8, 0x38, 0x10,
+    0x2, 0x9c, 0x20, 0x0, 0x10, 0x10, 0x0, 0x0,
+    0x12, 0x0,
+
+    /* U+64C1 "擁" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb1, 0x0, 0x0, 0xa1, 0x0, 0x0, 0x0, 0xb0,
+    0x25, 0x55, 0x96, 0x56, 0xa0, 0x0, 0xb0, 0x1,
+    0xb0, 0x44, 0x60, 0x0, 0x25, 0xc6, 0x56, 0x22,
+    0xa2, 0x73, 0x10, 0x0, 0xb0, 0x5, 0x4c, 0xc5,
+    0x96, 0x70, 0x0, 0xb2, 0x68, 0xb6, 0xb0, 0xb0,
+    0x0, 0x0, 0xc4, 0x5, 0x32, 0xc5, 0xc6, 0x60,
+    0x3c, 0xd0, 0x37, 0x6a, 0xb0, 0xb0, 0x0, 0x13,
+    0xb0, 0x56, 0xb1, 0xc5, 0xc6, 0x60, 0x0, 0xb0,
+    0x2, 0x70, 0xb0, 0xb0, 0x0, 0x0, 0xb0, 0x9,
+    0x0, 0xb0, 0xb0, 0x40, 0x18, 0xd0, 0x60, 0x0,
+    0xd5, 0x65, 0x60, 0x0, 0x10, 0x0, 0x0, 0x10,
+    0x0, 0x0,
+
+    /* U+64C7 "擇" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0x0, 0x85, 0x55, 0x55, 0x90, 0x0, 0x1a,
+    0x0, 0xa0, 0xb0, 0xa0, 0xa0, 0x0, 0xa, 0x20,
+    0xc5, 0xc5, 0xc5, 0xb0, 0x5, 0x5c, 0x73, 0x60,
+    0x1a, 0x0, 0x40, 0x0, 0xa, 0x0, 0x45, 0x5c,
+    0x5a, 0x20, 0x0, 0xa, 0x50, 0x0, 0xb, 0x0,
+    0x40, 0x0, 0x3d, 0x13, 0x69, 0x55, 0x86, 0x52,
+    0x8, 0xaa, 0x0, 0x4, 0x80, 0x93, 0x0, 0x6,
+    0x1a, 0x0, 0x76, 0x79, 0x67, 0x40, 0x0, 0xa,
+    0x0, 0x0, 0xb, 0x0, 0x60, 0x0, 0xa, 0x7,
+    0x55, 0x5c, 0x55, 0x52, 0x4, 0xa9, 0x0, 0x0,
+    0xb, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x5,
+    0x0, 0x0,
+
+    /* U+64D4 "擔" */
+    0x0, 0x1, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0xa, 0x60, 0x10, 0x0, 0x0, 0xb,
+    0x0, 0x3a, 0x55, 0xd1, 0x0, 0x0, 0xb, 0x20,
+    0xb5, 0x57, 0x65, 0xa0, 0x5, 0x5c, 0x65, 0xc1,
+    0xa2, 0x37, 0x0, 0x0, 0xb, 0x0, 0xb5, 0x18,
+    0x36, 0x30, 0x0, 0xb, 0x62, 0xb5, 0x56, 0x55,
+    0x81, 0x0, 0x3d, 0x10, 0xb2, 0x55, 0x59, 0x0,
+    0x9, 0x9b, 0x0, 0xa0, 0x0, 0x5, 0x0, 0x5,
+    0xb, 0x3, 0x72, 0x65, 0x55, 0x10, 0x0, 0xb,
+    0x8, 0x28, 0x65, 0x5b, 0x20, 0x1, 0xb, 0x7,
+    0x8, 0x30, 0xa, 0x10, 0x2, 0xd7, 0x50, 0x8,
+    0x75, 0x5a, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+64DA "據" */
+    0x0, 0x1, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x1b, 0x0, 0x0, 0xb1, 0x4, 0x0, 0x0, 0x19,
+    0x1, 0x0, 0xb5, 0x55, 0x20, 0x0, 0x19, 0x29,
+    0x65, 0xb6, 0x55, 0xd1, 0x5, 0x6b, 0x6a, 0x10,
+    0xb5, 0x83, 0x20, 0x0, 0x19, 0x9, 0x44, 0xb1,
+    0x7, 0x0, 0x0, 0x1a, 0x49, 0x10, 0x37, 0x76,
+    0x40, 0x0, 0x4c, 0xa, 0x45, 0xa8, 0x57, 0x60,
+    0x9, 0xa9, 0xa, 0x5, 0x84, 0x1b, 0x20, 0x4,
+    0x19, 0xa, 0x23, 0x8a, 0x90, 0x0, 0x0, 0x19,
+    0x26, 0x56, 0x4a, 0x97, 0x0, 0x0, 0x19, 0x61,
+    0x27, 0x60, 0xb4, 0xc2, 0x5, 0xc7, 0x42, 0x30,
+    0x39, 0x90, 0x10, 0x0, 0x20, 0x0, 0x0, 0x2,
+    0x0, 0x0,
+
+    /* U+652F "支" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc1, 0x0, 0x6, 0x10, 0x6, 0x55, 0x55,
+    0xd5, 0x55, 0x57, 0x40, 0x0, 0x0, 0x0, 0xc1,
+    0x0, 0x0, 0x0, 0x0, 0x25, 0x55, 0xd5, 0x59,
+    0x10, 0x0, 0x0, 0x0, 0x40, 0x0, 0x4a, 0x0,
+    0x0, 0x0, 0x0, 0x51, 0x0, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0x7, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xab, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xdb, 0x20, 0x0, 0x0, 0x0, 0x1, 0x97,
+    0x3, 0xca, 0x63, 0x10, 0x4, 0x67, 0x10, 0x0,
+    0x4, 0xae, 0x60, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6539 "改" */
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0x0, 0x0, 0x5, 0x55, 0x5c,
+    0x15, 0x70, 0x0, 0x0, 0x0, 0x0, 0xb0, 0xa1,
+    0x0, 0x41, 0x0, 0x0, 0xb, 0xb, 0x55, 0xb6,
+    0x30, 0x20, 0x0, 0xb6, 0x70, 0xa, 0x0, 0xb,
+    0x65, 0x58, 0x55, 0x10, 0xb0, 0x0, 0xb1, 0x0,
+    0x0, 0x25, 0xb, 0x0, 0xb, 0x10, 0x0, 0x0,
+    0x95, 0x60, 0x0, 0xb1, 0x0, 0x2, 0x6, 0xc0,
+    0x0, 0xb, 0x13, 0x75, 0x0, 0x8c, 0x20, 0x0,
+    0xcc, 0x60, 0x0, 0x85, 0x1c, 0x40, 0x4, 0x10,
+    0x4, 0x71, 0x0, 0x2d, 0x80, 0x0, 0x1, 0x10,
+    0x0, 0x0, 0x0,
+
+    /* U+653E "放" */
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x9, 0x30, 0x0, 0xc4, 0x0, 0x0, 0x0, 0x1,
+    0xb0, 0x0, 0xd0, 0x0, 0x0, 0x25, 0x65, 0x55,
+    0xa4, 0xb5, 0x59, 0x80, 0x0, 0x92, 0x0, 0x8,
+    0x20, 0x57, 0x0, 0x0, 0x92, 0x3, 0xa, 0x20,
+    0x75, 0x0, 0x0, 0xa6, 0x5c, 0x52, 0x60, 0xb1,
+    0x0, 0x0, 0xb0, 0xb, 0x0, 0x80, 0xc0, 0x0,
+    0x0, 0xb0, 0xb, 0x0, 0x68, 0x60, 0x0, 0x0,
+    0xa0, 0xb, 0x0, 0x1f, 0x0, 0x0, 0x4, 0x60,
+    0xc, 0x0, 0x98, 0x90, 0x0, 0x9, 0x6, 0xa8,
+    0x8, 0x30, 0x8a, 0x10, 0x43, 0x0, 0x83, 0x61,
+    0x0, 0x7, 0x91, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+653F "政" */
+    0x0, 0x0, 0x0, 0x0, 0x22, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x88, 0x0, 0x0, 0x6, 0x55,
+    0x65, 0xc3, 0xb1, 0x0, 0x0, 0x0, 0x0, 0xb0,
+    0x0, 0xd5, 0x56, 0xb2, 0x0, 0x0, 0xb0, 0x4,
+    0x70, 0xd, 0x0, 0x1, 0xb0, 0xb1, 0x28, 0x50,
+    0xb, 0x0, 0x1, 0xa0, 0xc5, 0x55, 0x60, 0x38,
+    0x0, 0x1, 0xa0, 0xb0, 0x20, 0x52, 0x75, 0x0,
+    0x1, 0xa0, 0xb0, 0x0, 0x8, 0xc0, 0x0, 0x1,
+    0xa0, 0xb0, 0x31, 0xa, 0x90, 0x0, 0x2, 0xc8,
+    0xb6, 0x10, 0x4b, 0xc1, 0x0, 0x1d, 0x72, 0x0,
+    0x6, 0x70, 0x3d, 0x40, 0x0, 0x0, 0x2, 0x62,
+    0x0, 0x3, 0xc4, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6545 "故" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0xc0, 0x0, 0x4c, 0x0, 0x0, 0x0, 0x0,
+    0xb0, 0x0, 0x75, 0x0, 0x0, 0x0, 0x0, 0xb0,
+    0x30, 0xb0, 0x0, 0x40, 0x5, 0x55, 0xc5, 0x73,
+    0xd5, 0x5d, 0x61, 0x0, 0x0, 0xb0, 0x6, 0x80,
+    0xc, 0x0, 0x0, 0x0, 0xb0, 0x6, 0x50, 0x1b,
+    0x0, 0x0, 0xc5, 0x79, 0x80, 0x34, 0x47, 0x0,
+    0x0, 0xb0, 0x6, 0x50, 0x9, 0x92, 0x0, 0x0,
+    0xb0, 0x6, 0x50, 0x9, 0xb0, 0x0, 0x0, 0xb0,
+    0x6, 0x50, 0xb, 0xb0, 0x0, 0x0, 0xd5, 0x59,
+    0x51, 0x92, 0x5b, 0x20, 0x0, 0x50, 0x1, 0x55,
+    0x0, 0x5, 0xd2, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6548 "效" */
+    0x0, 0x1, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0,
+    0x5, 0x60, 0x0, 0x1e, 0x20, 0x0, 0x0, 0x0,
+    0xd1, 0x21, 0x48, 0x0, 0x0, 0x3, 0x65, 0x65,
+    0x75, 0x92, 0x0, 0x60, 0x0, 0x2b, 0x7, 0x40,
+    0xb5, 0x5d, 0x51, 0x0, 0x93, 0x0, 0xd4, 0x90,
+    0xb, 0x0, 0x3, 0x60, 0x6, 0x36, 0x50, 0x29,
+    0x0, 0x5, 0x14, 0x1c, 0x12, 0x34, 0x64, 0x0,
+    0x0, 0x3, 0xc4, 0x0, 0x9, 0xb0, 0x0, 0x0,
+    0x2, 0xba, 0x0, 0xa, 0x70, 0x0, 0x0, 0xa,
+    0x8, 0x70, 0x3a, 0xa0, 0x0, 0x0, 0x81, 0x1,
+    0x54, 0x60, 0x6b, 0x10, 0x6, 0x10, 0x0, 0x53,
+    0x0, 0x7, 0xb1, 0x0, 0x0, 0x2, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6557 "敗" */
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x6,
+    0x55, 0x55, 0x90, 0x7a, 0x0, 0x0, 0xb, 0x0,
+    0x1, 0xb0, 0xa2, 0x0, 0x0, 0xb, 0x0, 0x1,
+    0xa0, 0xc5, 0x57, 0xb2, 0xb, 0x55, 0x55, 0xa3,
+    0x80, 0xc, 0x0, 0xb, 0x0, 0x1, 0xa7, 0x40,
+    0xc, 0x0, 0xb, 0x55, 0x55, 0xa6, 0x50, 0x29,
+    0x0, 0xb, 0x0, 0x1, 0xb0, 0x42, 0x75, 0x0,
+    0xb, 0x55, 0x55, 0xa0, 0x7, 0xb0, 0x0, 0x7,
+    0x11, 0x10, 0x40, 0x9, 0x80, 0x0, 0x0, 0xa6,
+    0x1a, 0x30, 0x3a, 0xb1, 0x0, 0x5, 0x60, 0x2,
+    0x72, 0x80, 0x3d, 0x20, 0x24, 0x0, 0x0, 0x44,
+    0x0, 0x4, 0xd3, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6559 "教" */
+    0x0, 0x0, 0x10, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0xc0, 0x0, 0x9, 0x70, 0x0, 0x0, 0x0,
+    0xb3, 0x2b, 0xc, 0x10, 0x0, 0x1, 0x55, 0xc5,
+    0xd2, 0xa, 0x0, 0x50, 0x5, 0x55, 0xc8, 0xaa,
+    0x67, 0x4a, 0x62, 0x0, 0x0, 0x38, 0x0, 0x73,
+    0xa, 0x10, 0x1, 0x57, 0xb5, 0xd3, 0x44, 0xb,
+    0x0, 0x0, 0x46, 0x16, 0x22, 0x6, 0xa, 0x0,
+    0x4, 0x20, 0x85, 0x2, 0x6, 0x56, 0x0, 0x1,
+    0x36, 0xc8, 0x52, 0x3, 0xd0, 0x0, 0x8, 0x72,
+    0x83, 0x0, 0x7, 0xc2, 0x0, 0x0, 0x0, 0x83,
+    0x0, 0x75, 0x1c, 0x20, 0x0, 0x27, 0xd1, 0x26,
+    0x20, 0x3, 0xd4, 0x0, 0x0, 0x30, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+6562 "敢" */
+    0x0, 0x0, 0x0, 0x0, 0x12, 0x0, 0x0, 0x1,
+    0x55, 0x58, 0x0, 0x5a, 0x0, 0x0, 0x0, 0x0,
+    0x48, 0x0, 0x83, 0x0, 0x0, 0x15, 0x55, 0xa6,
+    0x86, 0xb5, 0x56, 0xa0, 0x0, 0xb0, 0xb, 0x0,
+    0xa0, 0x1a, 0x0, 0x0, 0xb0, 0xb, 0x5, 0x80,
+    0x38, 0x0, 0x0, 0xc5, 0x5c, 0x7, 0x50, 0x65,
+    0x0, 0x0, 0xb0, 0xb, 0x13, 0x34, 0x92, 0x0,
+    0x0, 0xc5, 0x5c, 0x0, 0x8, 0xb0, 0x0, 0x0,
+    0xb0, 0xb, 0x33, 0x9, 0x70, 0x0, 0x16, 0xe9,
+    0x7d, 0x10, 0x1b, 0xb0, 0x0, 0x8, 0x20, 0xb,
+    0x0, 0x91, 0x4b, 0x10, 0x0, 0x0, 0xb, 0x27,
+    0x10, 0x5, 0xc2, 0x0, 0x0, 0x1, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+6570 "数" */
+    0x0, 0x0, 0x30, 0x0, 0x11, 0x0, 0x0, 0x1,
+    0x40, 0xc1, 0x62, 0x5b, 0x0, 0x0, 0x0, 0xb3,
+    0xb1, 0x90, 0x93, 0x0, 0x0, 0x0, 0x31, 0xb3,
+    0x41, 0xb0, 0x0, 0x60, 0x6, 0x5b, 0xe5, 0x56,
+    0xb5, 0x5d, 0x51, 0x0, 0x48, 0xb9, 0x77, 0x50,
+    0x1a, 0x0, 0x4, 0x60, 0xa0, 0x54, 0x50, 0x38,
+    0x0, 0x11, 0x4, 0x90, 0x10, 0x52, 0x65, 0x0,
+    0x6, 0x5b, 0x75, 0xc0, 0x17, 0xb1, 0x0, 0x0,
+    0x29, 0x7, 0x50, 0xa, 0xb0, 0x0, 0x0, 0x26,
+    0x8d, 0x20, 0xb, 0xa0, 0x0, 0x0, 0x6, 0x84,
+    0xc2, 0x93, 0x8a, 0x10, 0x4, 0x62, 0x0, 0x36,
+    0x10, 0x7, 0xc1, 0x0, 0x0, 0x1, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+6574 "整" */
+    0x0, 0x0, 0x30, 0x0, 0x22, 0x0, 0x0, 0x0,
+    0x0, 0xc0, 0x30, 0x86, 0x0, 0x0, 0x5, 0x65,
+    0xc5, 0x63, 0xc5, 0x57, 0xa0, 0x0, 0x95, 0xc5,
+    0xa3, 0xa0, 0x29, 0x0, 0x0, 0xa0, 0xb0, 0xa7,
+    0x24, 0x84, 0x0, 0x0, 0xb7, 0xe5, 0x90, 0x9,
+    0xb0, 0x0, 0x0, 0x2a, 0xc8, 0x60, 0x2a, 0xb2,
+    0x0, 0x3, 0x70, 0xc0, 0x65, 0x60, 0x2c, 0xa1,
+    0x12, 0x46, 0x65, 0x86, 0x55, 0x96, 0x10, 0x0,
+    0x0, 0x20, 0x57, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0xc0, 0x5a, 0x56, 0x80, 0x0, 0x0, 0x0, 0xb0,
+    0x57, 0x0, 0x0, 0x0, 0x4, 0x55, 0xc5, 0x8a,
+    0x55, 0x5b, 0x90, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6587 "文" */
+    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x48, 0x0, 0x0, 0x10, 0x5, 0x55, 0x65,
+    0x55, 0x57, 0x5a, 0xa0, 0x0, 0x0, 0x50, 0x0,
+    0x2a, 0x0, 0x0, 0x0, 0x0, 0x51, 0x0, 0x66,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0xb1, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0x2, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x8a, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0x8a, 0x70, 0x0, 0x0, 0x0, 0x1, 0x84,
+    0x0, 0x7d, 0x84, 0x10, 0x3, 0x55, 0x0, 0x0,
+    0x1, 0x8e, 0x80, 0x11, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6599 "料" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0,
+    0xc, 0x10, 0x0, 0x0, 0xd2, 0x0, 0x5, 0xb,
+    0x9, 0x13, 0x20, 0xc0, 0x0, 0x3, 0x9b, 0x9,
+    0x0, 0xd2, 0xc0, 0x0, 0x0, 0x6b, 0x40, 0x0,
+    0x40, 0xc0, 0x0, 0x5, 0x5d, 0x5a, 0x31, 0x0,
+    0xc0, 0x0, 0x0, 0x2f, 0x10, 0x4, 0x90, 0xc0,
+    0x0, 0x0, 0x9e, 0x79, 0x0, 0xa0, 0xc0, 0x10,
+    0x1, 0x8b, 0x9, 0x10, 0x0, 0xc6, 0xa0, 0x8,
+    0x1b, 0x3, 0x55, 0x55, 0xd0, 0x0, 0x32, 0xb,
+    0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xb, 0x0,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0xb, 0x0, 0x0,
+    0x0, 0xd0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x10, 0x0,
+
+    /* U+65AD "断" */
+    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x20, 0xb2, 0x0, 0x12, 0x6b, 0x70, 0xb, 0x12,
+    0xb0, 0x92, 0xc3, 0x10, 0x0, 0xb, 0xb, 0xc1,
+    0x90, 0xb0, 0x0, 0x0, 0xb, 0x4, 0xc4, 0x0,
+    0xb0, 0x0, 0x0, 0xb, 0x45, 0xe5, 0x93, 0xc5,
+    0x57, 0xb1, 0xb, 0x4, 0xf4, 0x0, 0xb0, 0x1a,
+    0x0, 0xb, 0x8, 0xc3, 0x90, 0xa0, 0x1a, 0x0,
+    0xb, 0x17, 0xb0, 0xa3, 0x90, 0x1a, 0x0, 0xb,
+    0x50, 0xb0, 0x4, 0x70, 0x1a, 0x0, 0xb, 0x0,
+    0xa1, 0x8, 0x20, 0x1a, 0x0, 0xc, 0x55, 0x59,
+    0x66, 0x0, 0x1a, 0x0, 0x0, 0x0, 0x1, 0x60,
+    0x0, 0x1a, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+65B0 "新" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0x80, 0x0, 0x0, 0x39, 0xa0, 0x4, 0x55,
+    0xb5, 0xb2, 0xb5, 0x41, 0x0, 0x0, 0x61, 0xa,
+    0x20, 0xb0, 0x0, 0x0, 0x0, 0x2a, 0x8, 0x0,
+    0xb0, 0x0, 0x0, 0x6, 0x57, 0x85, 0x87, 0xb5,
+    0x56, 0xc3, 0x0, 0x0, 0xb0, 0x0, 0xb0, 0x1a,
+    0x0, 0x3, 0x55, 0xc5, 0xa3, 0xb0, 0x1a, 0x0,
+    0x0, 0x10, 0xb0, 0x0, 0xb0, 0x1a, 0x0, 0x0,
+    0xd2, 0xb5, 0x41, 0xa0, 0x1a, 0x0, 0x4, 0x60,
+    0xb0, 0xc6, 0x40, 0x1a, 0x0, 0x7, 0x22, 0xb0,
+    0x28, 0x0, 0x1a, 0x0, 0x10, 0xa, 0x70, 0x60,
+    0x0, 0x1a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+65B7 "斷" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0x19, 0x2, 0x70, 0x32, 0x6b, 0x60, 0xb, 0x35,
+    0x57, 0x73, 0xc2, 0x0, 0x0, 0xb, 0x4a, 0x16,
+    0xa0, 0xb0, 0x0, 0x0, 0xb, 0x25, 0x67, 0x81,
+    0xb0, 0x0, 0x10, 0xb, 0x55, 0x75, 0x54, 0xb5,
+    0x87, 0x80, 0xb, 0x58, 0x56, 0x90, 0xb0, 0x92,
+    0x0, 0xb, 0xa, 0x16, 0x40, 0xb0, 0x92, 0x0,
+    0xb, 0x68, 0x79, 0xb1, 0xb0, 0x92, 0x0, 0xb,
+    0x18, 0x4, 0x60, 0xa0, 0x92, 0x0, 0xb, 0x48,
+    0x8a, 0x92, 0x80, 0x92, 0x0, 0xb, 0x0, 0x36,
+    0x47, 0x20, 0x92, 0x0, 0x8, 0x55, 0x55, 0x46,
+    0x0, 0x92, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x10, 0x0,
+
+    /* U+65B9 "方" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x29, 0x0, 0x0, 0x20, 0x16, 0x55, 0x55,
+    0x85, 0x55, 0x57, 0xb1, 0x0, 0x0, 0x2, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x80, 0x0,
+    0x20, 0x0, 0x0, 0x0, 0x6, 0x95, 0x55, 0xe2,
+    0x0, 0x0, 0x0, 0xa, 0x10, 0x1, 0xc0, 0x0,
+    0x0, 0x0, 0xb, 0x0, 0x3, 0xa0, 0x0, 0x0,
+    0x0, 0x73, 0x0, 0x5, 0x80, 0x0, 0x0, 0x2,
+    0x80, 0x0, 0x8, 0x50, 0x0, 0x0, 0x28, 0x0,
+    0x22, 0xc, 0x20, 0x0, 0x3, 0x50, 0x0, 0x7,
+    0xfa, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x20,
+    0x0, 0x0,
+
+    /* U+65BC "於" */
+    0x0, 0x2, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x9, 0x30, 0x0, 0x7a, 0x0, 0x0, 0x0, 0x3,
+    0x52, 0x10, 0xb8, 0x0, 0x0, 0x16, 0x96, 0x57,
+    0x61, 0xb2, 0x60, 0x0, 0x0, 0x92, 0x0, 0x6,
+    0x40, 0xa1, 0x0, 0x0, 0x97, 0x59, 0x19, 0x0,
+    0x2d, 0x20, 0x0, 0xa2, 0xb, 0x61, 0x63, 0x6,
+    0xa0, 0x0, 0xb0, 0xb, 0x10, 0x1b, 0x80, 0x0,
+    0x0, 0xb0, 0xb, 0x0, 0x0, 0x30, 0x0, 0x0,
+    0xa0, 0x1a, 0x0, 0x0, 0x0, 0x0, 0x5, 0x40,
+    0x38, 0x5, 0x95, 0x0, 0x0, 0x8, 0x17, 0xb4,
+    0x0, 0x9, 0xe1, 0x0, 0x32, 0x3, 0x60, 0x0,
+    0x0, 0x63, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+65BD "施" */
+    0x0, 0x10, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x1a, 0x0, 0x0, 0xe2, 0x0, 0x0, 0x0, 0x9,
+    0x20, 0x7, 0x92, 0x24, 0x90, 0x15, 0x75, 0x5b,
+    0x5b, 0x33, 0x33, 0x30, 0x0, 0xb0, 0x0, 0x71,
+    0xd, 0x0, 0x0, 0x0, 0xb0, 0x32, 0x2a, 0xb,
+    0x5, 0x20, 0x0, 0xb5, 0xc3, 0xb, 0x1d, 0x6c,
+    0x10, 0x0, 0xb0, 0xa2, 0x6d, 0x4b, 0xb, 0x0,
+    0x0, 0xb0, 0xb1, 0xb, 0xb, 0xb, 0x0, 0x0,
+    0x90, 0xb0, 0xb, 0xb, 0x6c, 0x0, 0x4, 0x50,
+    0xb0, 0xb, 0xc, 0x12, 0x50, 0x8, 0x32, 0xc0,
+    0xb, 0x3, 0x0, 0x90, 0x23, 0xb, 0x50, 0xc,
+    0xaa, 0xaa, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+65C1 "旁" */
+    0x0, 0x0, 0x1, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x94, 0x0, 0x3, 0x0, 0x0, 0x65,
+    0x65, 0x66, 0x65, 0x78, 0x0, 0x0, 0x0, 0x67,
+    0x0, 0x77, 0x0, 0x0, 0x0, 0x20, 0xa, 0x0,
+    0x70, 0x2, 0x0, 0x3, 0x95, 0x55, 0x85, 0x55,
+    0x5c, 0x60, 0x7, 0x20, 0x0, 0x59, 0x0, 0x14,
+    0x10, 0x4, 0x65, 0x57, 0x78, 0x55, 0x57, 0x90,
+    0x0, 0x0, 0xb, 0x30, 0x0, 0x30, 0x0, 0x0,
+    0x0, 0xd, 0x55, 0x56, 0xd0, 0x0, 0x0, 0x0,
+    0x67, 0x0, 0x4, 0x90, 0x0, 0x0, 0x2, 0xa0,
+    0x2, 0x8, 0x50, 0x0, 0x1, 0x66, 0x0, 0x2,
+    0xcd, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x10,
+    0x0, 0x0,
+
+    /* U+65C5 "旅" */
+    0x0, 0x10, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x10, 0x7, 0xa0, 0x0, 0x0, 0x0, 0x7,
+    0x60, 0xb, 0x20, 0x1, 0x0, 0x15, 0x55, 0x5a,
+    0x5b, 0x55, 0x59, 0x60, 0x0, 0xb0, 0x0, 0x62,
+    0x0, 0x12, 0x0, 0x0, 0xb0, 0x4, 0x41, 0x27,
+    0xa6, 0x0, 0x0, 0xb5, 0x5c, 0xc, 0x52, 0x0,
+    0x0, 0x0, 0xb0, 0xa, 0xb, 0x4, 0xb, 0x30,
+    0x0, 0xb0, 0x1a, 0xb, 0x8, 0x61, 0x0, 0x2,
+    0x90, 0x29, 0xb, 0x8, 0x10, 0x0, 0x7, 0x30,
+    0x47, 0xb, 0x2, 0xa0, 0x0, 0x8, 0x16, 0xb3,
+    0xb, 0x54, 0x7a, 0x10, 0x41, 0x4, 0x50, 0xe,
+    0x40, 0x7, 0xc1, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0,
+
+    /* U+65CF "族" */
+    0x0, 0x10, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0x48, 0x0, 0xd, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0x0, 0x56, 0x0, 0x5, 0x0, 0x25, 0x85, 0x67,
+    0x98, 0x55, 0x57, 0x20, 0x0, 0xb0, 0x1, 0x6d,
+    0x10, 0x1, 0x0, 0x0, 0xb5, 0x95, 0x58, 0x85,
+    0x68, 0x0, 0x0, 0xb0, 0xb0, 0x70, 0xa1, 0x0,
+    0x0, 0x0, 0xb0, 0xb1, 0x0, 0xa0, 0x2, 0x10,
+    0x0, 0xb0, 0xb5, 0x55, 0xc7, 0x57, 0x50, 0x1,
+    0x90, 0xb0, 0x0, 0xa6, 0x0, 0x0, 0x6, 0x30,
+    0xb0, 0x7, 0x42, 0x70, 0x0, 0x8, 0x29, 0x90,
+    0x48, 0x0, 0x96, 0x0, 0x41, 0x4, 0x26, 0x50,
+    0x0, 0xb, 0x90, 0x0, 0x0, 0x20, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+65E2 "既" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x55,
+    0x59, 0x25, 0x57, 0x58, 0x70, 0xa1, 0x0, 0xb1,
+    0x30, 0xc0, 0x0, 0xa, 0x10, 0xb, 0x2b, 0xc,
+    0x0, 0x0, 0xa6, 0x55, 0xb3, 0x70, 0xc0, 0x0,
+    0xa, 0x10, 0xb, 0x46, 0xb, 0x0, 0x10, 0xa6,
+    0x55, 0xb6, 0x77, 0xb5, 0x77, 0xa, 0x10, 0x4,
+    0x0, 0x6c, 0x20, 0x0, 0xa1, 0x14, 0x0, 0xa,
+    0xa2, 0x0, 0xa, 0x10, 0x67, 0x2, 0xa9, 0x20,
+    0x0, 0xa1, 0x65, 0xd1, 0x91, 0x92, 0x5, 0xb,
+    0xc3, 0x3, 0x64, 0x9, 0x20, 0x80, 0x31, 0x0,
+    0x53, 0x0, 0x6b, 0xad, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+65E5 "日" */
+    0x95, 0x55, 0x55, 0x5a, 0x2c, 0x0, 0x0, 0x0,
+    0xc0, 0xc0, 0x0, 0x0, 0xc, 0xc, 0x0, 0x0,
+    0x0, 0xc0, 0xc0, 0x0, 0x0, 0xc, 0xd, 0x55,
+    0x55, 0x55, 0xd0, 0xc0, 0x0, 0x0, 0xc, 0xc,
+    0x0, 0x0, 0x0, 0xc0, 0xc0, 0x0, 0x0, 0xc,
+    0xc, 0x0, 0x0, 0x0, 0xc0, 0xd5, 0x55, 0x55,
+    0x5d, 0xa, 0x0, 0x0, 0x0, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+65E6 "旦" */
+    0x0, 0x1, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0xb6, 0x55, 0x55, 0xd3, 0x0, 0x0, 0xb, 0x10,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0xa1, 0x0, 0x0,
+    0xc0, 0x0, 0x0, 0xa, 0x65, 0x55, 0x5d, 0x0,
+    0x0, 0x0, 0xa1, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0xa, 0x10, 0x0, 0xc, 0x0, 0x0, 0x0, 0xb6,
+    0x55, 0x55, 0xd0, 0x0, 0x0, 0xb, 0x10, 0x0,
+    0xb, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x11,
+    0x75, 0x55, 0x55, 0x55, 0x55, 0x53,
+
+    /* U+65E9 "早" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa5, 0x55, 0x55, 0xc4, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0xb, 0x10, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0xb1, 0x0, 0x0, 0xc, 0x55, 0x55, 0x5c, 0x10,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0xb1, 0x0, 0x0,
+    0xc, 0x55, 0x75, 0x5c, 0x10, 0x0, 0x0, 0x60,
+    0xb, 0x10, 0x40, 0x0, 0x0, 0x0, 0x0, 0xb1,
+    0x0, 0x8, 0x1, 0x75, 0x55, 0x5c, 0x65, 0x55,
+    0x52, 0x0, 0x0, 0x0, 0xb1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x0, 0x0, 0x0,
+
+    /* U+65F6 "时" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe1, 0x0, 0x85, 0x5a, 0x20,
+    0x0, 0xc, 0x0, 0xc, 0x0, 0xc0, 0x0, 0x0,
+    0xc0, 0x50, 0xc0, 0xc, 0x46, 0x55, 0x5d, 0x57,
+    0x1c, 0x0, 0xc0, 0x0, 0x0, 0xc0, 0x0, 0xc5,
+    0x5d, 0x7, 0x40, 0xc, 0x0, 0xc, 0x0, 0xc0,
+    0xe, 0x10, 0xc0, 0x0, 0xc0, 0xc, 0x0, 0x60,
+    0xc, 0x0, 0xc, 0x0, 0xc0, 0x0, 0x0, 0xc0,
+    0x0, 0xc5, 0x5d, 0x0, 0x0, 0xc, 0x0, 0x9,
+    0x0, 0x30, 0x0, 0x11, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x0,
+
+    /* U+6607 "昇" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x55, 0x55, 0x55, 0x8b, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0x47, 0x0, 0x0, 0xd, 0x55,
+    0x55, 0x55, 0x87, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x0, 0x47, 0x0, 0x0, 0xc, 0x55, 0x75, 0x55,
+    0x75, 0x0, 0x0, 0x2, 0x6a, 0xc2, 0xc, 0x10,
+    0x0, 0x0, 0x33, 0x57, 0x0, 0xc, 0x0, 0x0,
+    0x0, 0x0, 0x47, 0x0, 0xc, 0x3, 0x70, 0x5,
+    0x55, 0x99, 0x55, 0x5d, 0x55, 0x50, 0x0, 0x0,
+    0xa2, 0x0, 0xc, 0x0, 0x0, 0x0, 0x3, 0x80,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0x57, 0x0, 0x0,
+    0xd, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x3,
+    0x0, 0x0,
+
+    /* U+660E "明" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10,
+    0x95, 0x55, 0xc2, 0xc5, 0x5d, 0xa, 0x10, 0xb,
+    0xb, 0x0, 0xb0, 0xa1, 0x0, 0xb0, 0xb0, 0xb,
+    0xa, 0x65, 0x5c, 0xc, 0x55, 0xb0, 0xa1, 0x0,
+    0xb0, 0xb0, 0xb, 0xb, 0x0, 0xb, 0xb, 0x0,
+    0xb0, 0xb3, 0x33, 0xc0, 0xc5, 0x5c, 0xc, 0x11,
+    0x1b, 0xb, 0x0, 0x51, 0xb0, 0x0, 0xb0, 0x0,
+    0x0, 0x84, 0x0, 0xb, 0x0, 0x0, 0x47, 0x0,
+    0x10, 0xc0, 0x0, 0x44, 0x0, 0x4, 0xcc, 0x0,
+    0x11, 0x0, 0x0, 0x1, 0x0,
+
+    /* U+6613 "易" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1b,
+    0x55, 0x55, 0x5d, 0x0, 0x0, 0x1b, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x1c, 0x55, 0x55, 0x5c, 0x0,
+    0x0, 0x1b, 0x0, 0x0, 0xc, 0x0, 0x0, 0x1c,
+    0x85, 0x55, 0x5b, 0x0, 0x0, 0x7, 0xa0, 0x0,
+    0x0, 0x11, 0x0, 0x2b, 0x5b, 0x75, 0xc5, 0xa8,
+    0x2, 0x90, 0x3b, 0x6, 0x70, 0x93, 0x4, 0x1,
+    0xb1, 0xc, 0x10, 0xc0, 0x0, 0x48, 0x10, 0x95,
+    0x0, 0xc0, 0x4, 0x20, 0x19, 0x51, 0x4, 0x90,
+    0x0, 0x15, 0x61, 0x1, 0xae, 0x20, 0x0, 0x20,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+6614 "昔" */
+    0x0, 0x0, 0x10, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x76, 0x0, 0xc2, 0x0, 0x0, 0x0, 0x0,
+    0x74, 0x0, 0xc0, 0x36, 0x0, 0x2, 0x65, 0xa8,
+    0x55, 0xd5, 0x55, 0x0, 0x0, 0x0, 0x74, 0x0,
+    0xc0, 0x0, 0x0, 0x15, 0x55, 0xa8, 0x55, 0xd5,
+    0x5b, 0x80, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0x55, 0x55, 0x5a, 0x70, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x8, 0x40, 0x0, 0x0,
+    0xc, 0x55, 0x55, 0x5a, 0x40, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x8, 0x40, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0x8, 0x40, 0x0, 0x0, 0xc, 0x55, 0x55,
+    0x5a, 0x40, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+661F "星" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x55, 0x55, 0x55, 0x8a, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0x57, 0x0, 0x0, 0xd, 0x55,
+    0x55, 0x55, 0x87, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x0, 0x57, 0x0, 0x0, 0xb, 0x55, 0x65, 0x55,
+    0x86, 0x0, 0x0, 0x9, 0x20, 0x2b, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0x55, 0x6b, 0x55, 0x6d, 0x20,
+    0x0, 0x82, 0x0, 0x29, 0x0, 0x0, 0x0, 0x2,
+    0x50, 0x0, 0x29, 0x0, 0x82, 0x0, 0x3, 0x5,
+    0x55, 0x6b, 0x55, 0x53, 0x0, 0x0, 0x0, 0x0,
+    0x29, 0x0, 0x0, 0x40, 0x6, 0x55, 0x55, 0x57,
+    0x55, 0x56, 0x92,
+
+    /* U+6620 "映" */
+    0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb2, 0x0, 0x0, 0x75, 0x59, 0x0,
+    0xb, 0x0, 0x0, 0xb, 0x0, 0xb0, 0xb5, 0xc5,
+    0x5c, 0x0, 0xb0, 0xb, 0xa, 0xb, 0x0, 0xa0,
+    0xb, 0x0, 0xb0, 0xa0, 0xb0, 0xa, 0x0, 0xb5,
+    0x5b, 0xa, 0xb, 0x0, 0xa0, 0xb, 0x0, 0xb5,
+    0xa5, 0xc5, 0x5b, 0xb1, 0xb0, 0xb, 0x0, 0x28,
+    0x50, 0x0, 0xb, 0x0, 0xb0, 0x8, 0x46, 0x10,
+    0x0, 0xb5, 0x5b, 0x1, 0xa0, 0x1a, 0x0, 0x9,
+    0x0, 0x1, 0xa1, 0x0, 0x6a, 0x0, 0x0, 0x5,
+    0x70, 0x0, 0x0, 0x8d, 0x10, 0x2, 0x10, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+6625 "春" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf3, 0x0, 0x1, 0x0, 0x2, 0x55,
+    0x56, 0xe5, 0x55, 0x5a, 0x30, 0x0, 0x0, 0x5,
+    0x70, 0x0, 0x60, 0x0, 0x0, 0x55, 0x5d, 0x65,
+    0x55, 0x51, 0x0, 0x5, 0x55, 0x6c, 0x55, 0x55,
+    0x57, 0xc1, 0x0, 0x1, 0xb1, 0x0, 0x7, 0x0,
+    0x0, 0x0, 0x1a, 0x61, 0x11, 0x18, 0x90, 0x0,
+    0x4, 0x70, 0xd3, 0x33, 0x3d, 0x3c, 0xa3, 0x11,
+    0x0, 0xc0, 0x0, 0xc, 0x0, 0x40, 0x0, 0x0,
+    0xd5, 0x55, 0x5c, 0x0, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xd5, 0x55,
+    0x5c, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x1,
+    0x0, 0x0,
+
+    /* U+6628 "昨" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0x70, 0x0, 0x0, 0x85, 0x5b, 0x20,
+    0xd0, 0x0, 0x0, 0xb, 0x0, 0xb0, 0x4a, 0x75,
+    0x57, 0xb0, 0xb0, 0xb, 0x9, 0xc, 0x0, 0x0,
+    0xb, 0x0, 0xb3, 0x40, 0xc0, 0x0, 0x0, 0xb5,
+    0x5c, 0x20, 0xd, 0x55, 0xa2, 0xb, 0x0, 0xb0,
+    0x0, 0xc0, 0x0, 0x0, 0xb0, 0xb, 0x0, 0xc,
+    0x0, 0x33, 0xb, 0x0, 0xb0, 0x0, 0xd5, 0x56,
+    0x50, 0xb5, 0x5d, 0x0, 0xc, 0x0, 0x0, 0xa,
+    0x0, 0x40, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x10, 0x0, 0x0,
+
+    /* U+662F "是" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0xd5, 0x55, 0x5c, 0x50, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0xa, 0x20, 0x0, 0x0, 0x0, 0xd5,
+    0x55, 0x5c, 0x20, 0x0, 0x0, 0x0, 0xc0, 0x0,
+    0xa, 0x20, 0x0, 0x0, 0x0, 0xd5, 0x55, 0x5b,
+    0x20, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x7,
+    0x30, 0x4, 0x65, 0x75, 0x5d, 0x55, 0x55, 0x40,
+    0x0, 0x4, 0xd0, 0xc, 0x0, 0x22, 0x0, 0x0,
+    0x8, 0x60, 0xd, 0x55, 0x65, 0x0, 0x0, 0xb,
+    0x45, 0xc, 0x0, 0x0, 0x0, 0x0, 0x92, 0x5,
+    0xbd, 0x20, 0x0, 0x0, 0x5, 0x30, 0x0, 0x17,
+    0xbd, 0xef, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+663C "昼" */
+    0x0, 0x8, 0x55, 0x55, 0x55, 0xb0, 0x0, 0x0,
+    0xb, 0x0, 0x0, 0x0, 0xa0, 0x0, 0x0, 0xc,
+    0x55, 0x55, 0x65, 0xb0, 0x0, 0x0, 0xb, 0x0,
+    0x0, 0x42, 0x10, 0x0, 0x0, 0x39, 0x0, 0x0,
+    0x9, 0x20, 0x0, 0x0, 0x98, 0x75, 0x55, 0x5d,
+    0xa7, 0x0, 0x2, 0x67, 0x30, 0x0, 0xa, 0x6,
+    0xb0, 0x16, 0x7, 0x75, 0x55, 0x5b, 0x0, 0x0,
+    0x10, 0x7, 0x30, 0x0, 0xa, 0x0, 0x0, 0x0,
+    0x7, 0x75, 0x55, 0x5b, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x3, 0x55, 0x55,
+    0x55, 0x55, 0x56, 0x30,
+
+    /* U+6642 "時" */
+    0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1, 0x0,
+    0x20, 0x0, 0xb2, 0x0, 0x0, 0xc5, 0x5d, 0x10,
+    0xb, 0x0, 0x30, 0xb, 0x0, 0xb0, 0x55, 0xc5,
+    0x57, 0x0, 0xb0, 0xb, 0x0, 0xb, 0x0, 0x0,
+    0xb, 0x0, 0xb5, 0x55, 0xd5, 0x57, 0xa0, 0xb5,
+    0x5b, 0x0, 0x0, 0x9, 0x10, 0xb, 0x0, 0xb4,
+    0x55, 0x55, 0xc5, 0xa0, 0xb0, 0xb, 0x14, 0x10,
+    0xb, 0x0, 0xb, 0x0, 0xb0, 0xc, 0x10, 0xb0,
+    0x0, 0xc5, 0x5c, 0x0, 0x41, 0xb, 0x0, 0x8,
+    0x0, 0x30, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xac, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x10, 0x0,
+
+    /* U+6669 "晩" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0x20, 0x0, 0x0, 0xb5, 0x5c, 0x4,
+    0xb5, 0x6b, 0x10, 0xb, 0x1, 0x90, 0xa0, 0x8,
+    0x40, 0x0, 0xb0, 0x19, 0x7a, 0x56, 0x85, 0x92,
+    0xb, 0x1, 0xb2, 0xb0, 0x91, 0xb, 0x0, 0xc5,
+    0x69, 0xb, 0x9, 0x10, 0xb0, 0xb, 0x1, 0x90,
+    0xd5, 0xb6, 0x5c, 0x0, 0xb0, 0x19, 0x4, 0x17,
+    0xc0, 0x10, 0xb, 0x1, 0xa0, 0x4, 0x4c, 0x0,
+    0x0, 0xd5, 0x6a, 0x0, 0x90, 0xc0, 0x4, 0x6,
+    0x0, 0x0, 0x65, 0xc, 0x0, 0x60, 0x0, 0x0,
+    0x64, 0x0, 0xba, 0x9d, 0x10, 0x0, 0x10, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+666E "普" */
+    0x0, 0x0, 0x40, 0x0, 0x22, 0x0, 0x0, 0x0,
+    0x4, 0xb0, 0x8, 0x30, 0x0, 0x2, 0x55, 0x5d,
+    0x55, 0x95, 0x7c, 0x10, 0x1, 0x0, 0xc0, 0x2a,
+    0x5, 0x0, 0x0, 0xa, 0xc, 0x2, 0xa1, 0xb0,
+    0x0, 0x0, 0x75, 0xc0, 0x2a, 0x71, 0x0, 0x35,
+    0x56, 0x5d, 0x56, 0xb7, 0x5c, 0x70, 0x0, 0x10,
+    0x0, 0x0, 0x20, 0x0, 0x0, 0xa, 0x65, 0x55,
+    0x5d, 0x30, 0x0, 0x0, 0x92, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0x9, 0x65, 0x55, 0x5d, 0x0, 0x0,
+    0x0, 0x92, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xa,
+    0x65, 0x55, 0x5d, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x10, 0x0,
+
+    /* U+666F "景" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x55, 0x55, 0x55, 0xd1, 0x0, 0x0, 0xc,
+    0x55, 0x55, 0x55, 0xd0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0xb, 0x55, 0x88,
+    0x55, 0xa0, 0x0, 0x3, 0x33, 0x33, 0x3c, 0x33,
+    0x35, 0xa0, 0x3, 0x24, 0x22, 0x22, 0x22, 0x62,
+    0x20, 0x0, 0x8, 0x85, 0x55, 0x56, 0xc0, 0x0,
+    0x0, 0x8, 0x40, 0x0, 0x1, 0xa0, 0x0, 0x0,
+    0x6, 0x65, 0x6c, 0x55, 0x70, 0x0, 0x0, 0x1,
+    0xc2, 0x1a, 0x5, 0x40, 0x0, 0x0, 0x59, 0x20,
+    0x1a, 0x0, 0x6c, 0x20, 0x15, 0x20, 0x5, 0xa8,
+    0x0, 0x4, 0x70, 0x0, 0x0, 0x0, 0x40, 0x0,
+    0x0, 0x0,
+
+    /* U+6674 "晴" */
+    0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x10, 0x0, 0xb3, 0x2, 0x10, 0xb5, 0x5d, 0x35,
+    0x5c, 0x55, 0x64, 0xb, 0x0, 0xb0, 0x0, 0xb1,
+    0x6, 0x0, 0xb0, 0xb, 0x5, 0x5c, 0x65, 0x51,
+    0xb, 0x33, 0xb5, 0x55, 0xb5, 0x55, 0xa0, 0xb2,
+    0x2b, 0x2, 0x0, 0x0, 0x40, 0xb, 0x0, 0xb0,
+    0xb5, 0x55, 0x5c, 0x0, 0xb0, 0xb, 0xb, 0x55,
+    0x55, 0xb0, 0xb, 0x33, 0xb0, 0xb0, 0x0, 0xb,
+    0x0, 0xb2, 0x2b, 0xb, 0x55, 0x55, 0xb0, 0x5,
+    0x0, 0x10, 0xb0, 0x0, 0xb, 0x0, 0x0, 0x0,
+    0xb, 0x0, 0x49, 0xa0, 0x0, 0x0, 0x0, 0x30,
+    0x0, 0x41, 0x0,
+
+    /* U+667A "智" */
+    0x0, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1, 0xb0,
+    0x3, 0x1, 0x0, 0x1, 0x6, 0x69, 0x86, 0x1b,
+    0x55, 0x79, 0x5, 0x7, 0x30, 0xb, 0x0, 0x37,
+    0x55, 0x5b, 0x57, 0x6b, 0x0, 0x37, 0x0, 0xb,
+    0x74, 0xb, 0x55, 0x78, 0x0, 0x74, 0xa, 0x6b,
+    0x0, 0x36, 0x5, 0x43, 0x0, 0x21, 0x4, 0x0,
+    0x31, 0xd, 0x55, 0x55, 0x5d, 0x20, 0x0, 0xb,
+    0x0, 0x0, 0xb, 0x0, 0x0, 0xc, 0x55, 0x55,
+    0x5c, 0x0, 0x0, 0xb, 0x0, 0x0, 0xb, 0x0,
+    0x0, 0xd, 0x55, 0x55, 0x5c, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x0,
+
+    /* U+6687 "暇" */
+    0x0, 0x11, 0x75, 0x83, 0x55, 0x92, 0xb, 0x5c,
+    0x49, 0xa, 0x0, 0xa, 0x0, 0xa0, 0xa1, 0x90,
+    0xa0, 0x0, 0xa0, 0xa, 0xa, 0x1b, 0x5c, 0x15,
+    0x5c, 0x0, 0xb5, 0xc1, 0x90, 0x40, 0x0, 0x10,
+    0xa, 0xa, 0x19, 0x3, 0x45, 0x58, 0x30, 0xa0,
+    0xa1, 0xb5, 0x40, 0x40, 0xb1, 0xa, 0xa, 0x19,
+    0x2, 0x5, 0x1b, 0x0, 0xb5, 0xc2, 0xb5, 0x71,
+    0x69, 0x30, 0x7, 0x1, 0x19, 0x0, 0x4, 0xe0,
+    0x0, 0x0, 0x1, 0x90, 0x3, 0x84, 0xc3, 0x0,
+    0x0, 0x28, 0x4, 0x40, 0x4, 0xa2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+6691 "暑" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x55, 0x55, 0x56, 0xc0, 0x0, 0x0, 0xc,
+    0x55, 0x55, 0x56, 0xa0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0x2, 0xa0, 0x0, 0x0, 0xb, 0x55, 0xd6,
+    0x56, 0x8b, 0x10, 0x0, 0x15, 0x55, 0xd6, 0xa3,
+    0xc4, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x6b, 0x11,
+    0x50, 0x6, 0x55, 0x55, 0x9d, 0x85, 0x56, 0x70,
+    0x0, 0x0, 0x7a, 0xc6, 0x55, 0x90, 0x0, 0x0,
+    0x58, 0xd0, 0x0, 0x0, 0xc0, 0x0, 0x23, 0x0,
+    0xd5, 0x55, 0x55, 0xc0, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xd5, 0x55,
+    0x55, 0xc0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6696 "暖" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0,
+    0x1, 0x45, 0x68, 0xab, 0x30, 0xb5, 0x5d, 0x23,
+    0x6, 0x2, 0x90, 0xb, 0x0, 0xb0, 0x93, 0x74,
+    0x73, 0x0, 0xb0, 0xb, 0x28, 0x66, 0x58, 0x95,
+    0xb, 0x0, 0xb0, 0x4, 0x70, 0x0, 0x0, 0xc5,
+    0x5b, 0x46, 0x98, 0x55, 0x5b, 0x1b, 0x0, 0xb0,
+    0xa, 0x10, 0x0, 0x0, 0xb0, 0xb, 0x0, 0xc6,
+    0x56, 0xd0, 0xb, 0x0, 0xb0, 0x64, 0x70, 0xb3,
+    0x0, 0xc5, 0x5b, 0x19, 0x3, 0xc5, 0x0, 0xa,
+    0x0, 0x7, 0x0, 0x8a, 0xa1, 0x0, 0x0, 0x3,
+    0x3, 0x82, 0x5, 0xda, 0x20, 0x0, 0x0, 0x20,
+    0x0, 0x0, 0x20,
+
+    /* U+6697 "暗" */
+    0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x85, 0x0, 0x0, 0xb5, 0x5d, 0x16,
+    0x56, 0x75, 0x93, 0xc, 0x0, 0xb0, 0x23, 0x0,
+    0xa3, 0x0, 0xb0, 0xb, 0x0, 0xc1, 0xa, 0x0,
+    0xb, 0x0, 0xb1, 0x26, 0x26, 0x32, 0x80, 0xc5,
+    0x5b, 0x33, 0x33, 0x33, 0x33, 0xb, 0x0, 0xb0,
+    0x75, 0x55, 0x5a, 0x0, 0xb0, 0xb, 0xb, 0x0,
+    0x0, 0xb0, 0xb, 0x0, 0xb0, 0xb5, 0x55, 0x5b,
+    0x0, 0xc5, 0x5b, 0xb, 0x0, 0x0, 0xb0, 0x4,
+    0x0, 0x10, 0xb5, 0x55, 0x5c, 0x0, 0x0, 0x0,
+    0xb, 0x0, 0x0, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+66C7 "曇" */
+    0x0, 0x10, 0x0, 0x0, 0x4, 0x0, 0x0, 0xa,
+    0x55, 0x55, 0x55, 0xc1, 0x0, 0x0, 0xa5, 0x55,
+    0x55, 0x5b, 0x0, 0x0, 0xa, 0x55, 0x55, 0x55,
+    0xb0, 0x0, 0x0, 0x53, 0x33, 0x33, 0x39, 0x20,
+    0x0, 0x32, 0x11, 0xa2, 0x11, 0x11, 0x40, 0x39,
+    0x77, 0x6b, 0x56, 0x77, 0x5c, 0x28, 0x27, 0x72,
+    0x91, 0x37, 0x62, 0x0, 0x0, 0x11, 0x13, 0x11,
+    0x44, 0x0, 0x0, 0x4, 0x43, 0x33, 0x33, 0x33,
+    0x30, 0x55, 0x55, 0x79, 0x55, 0x55, 0x66, 0x0,
+    0x0, 0x29, 0x20, 0x6, 0x40, 0x0, 0x0, 0x8d,
+    0x98, 0x76, 0x5c, 0x30, 0x0, 0x2, 0x20, 0x0,
+    0x0, 0x10, 0x0,
+
+    /* U+66DC "曜" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0,
+    0x34, 0x65, 0xb4, 0x65, 0xb0, 0xc5, 0x6b, 0x37,
+    0xa, 0x26, 0xa, 0xb, 0x1, 0x90, 0x60, 0xa0,
+    0x61, 0xa0, 0xb0, 0x19, 0x16, 0x5a, 0x37, 0x5b,
+    0xb, 0x56, 0xa9, 0x22, 0x69, 0x10, 0x60, 0xb0,
+    0x19, 0x8, 0x60, 0xc2, 0x12, 0xb, 0x1, 0x91,
+    0xc5, 0x5c, 0x56, 0x60, 0xb0, 0x19, 0x7c, 0x22,
+    0xb2, 0x80, 0xb, 0x56, 0xb1, 0xc3, 0x3b, 0x33,
+    0x10, 0xb0, 0x13, 0xc, 0x55, 0xc5, 0xa2, 0x2,
+    0x0, 0x0, 0xb0, 0xa, 0x0, 0x30, 0x0, 0x0,
+    0xd, 0x55, 0x75, 0x68, 0x0, 0x0, 0x0, 0x10,
+    0x0, 0x0, 0x0,
+
+    /* U+66F2 "曲" */
+    0x0, 0x3, 0x0, 0x30, 0x0, 0x0, 0x0, 0xc1,
+    0xc, 0x10, 0x0, 0x0, 0xb, 0x0, 0xb0, 0x0,
+    0x8, 0x55, 0xc5, 0x5c, 0x55, 0xa1, 0xd0, 0xb,
+    0x0, 0xb0, 0xc, 0xc, 0x0, 0xb0, 0xb, 0x0,
+    0xc0, 0xc0, 0xb, 0x0, 0xb0, 0xc, 0xc, 0x55,
+    0xc5, 0x5c, 0x55, 0xc0, 0xc0, 0xb, 0x0, 0xb0,
+    0xc, 0xc, 0x0, 0xb0, 0xb, 0x0, 0xc0, 0xc0,
+    0xb, 0x0, 0xb0, 0xc, 0xc, 0x55, 0xb5, 0x5b,
+    0x55, 0xd0, 0xc0, 0x0, 0x0, 0x0, 0x9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+66F4 "更" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0x55, 0x55, 0x56, 0x55, 0x56, 0xc1, 0x0, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0x19, 0x55,
+    0x5d, 0x55, 0x5b, 0x0, 0x0, 0x1b, 0x0, 0xc,
+    0x0, 0x1a, 0x0, 0x0, 0xc, 0x55, 0x5d, 0x55,
+    0x6a, 0x0, 0x0, 0xb, 0x0, 0xc, 0x0, 0x1a,
+    0x0, 0x0, 0x1c, 0x55, 0x5d, 0x55, 0x6a, 0x0,
+    0x0, 0x5, 0x10, 0x38, 0x0, 0x4, 0x0, 0x0,
+    0x0, 0x33, 0x75, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a,
+    0x7b, 0x62, 0x0, 0x0, 0x1, 0x57, 0x50, 0x1,
+    0x6a, 0xdd, 0xe4, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+66F8 "書" */
+    0x0, 0x0, 0x1, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0x0, 0x20, 0x0, 0x0, 0x45, 0x56,
+    0xb5, 0x5c, 0x41, 0x3, 0x65, 0x55, 0x6b, 0x55,
+    0xb7, 0x90, 0x0, 0x45, 0x56, 0xb5, 0x5b, 0x10,
+    0x0, 0x0, 0x0, 0x29, 0x0, 0x32, 0x0, 0x3,
+    0x55, 0x56, 0xb5, 0x56, 0x60, 0x4, 0x55, 0x55,
+    0x69, 0x55, 0x58, 0x80, 0x0, 0x85, 0x55, 0x55,
+    0x59, 0x20, 0x0, 0xc, 0x0, 0x0, 0x0, 0xa1,
+    0x0, 0x0, 0xd5, 0x55, 0x55, 0x5c, 0x10, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0xa1, 0x0, 0x0, 0xd5,
+    0x55, 0x55, 0x5c, 0x10, 0x0, 0x2, 0x0, 0x0,
+    0x0, 0x20, 0x0,
+
+    /* U+66FE "曾" */
+    0x0, 0x20, 0x0, 0x11, 0x0, 0x0, 0x3a, 0x0,
+    0x96, 0x0, 0x20, 0x7, 0x2, 0x60, 0x12, 0xb5,
+    0x55, 0xb6, 0x55, 0x88, 0xb0, 0x82, 0x91, 0x59,
+    0x56, 0xb0, 0x39, 0x92, 0x80, 0x56, 0xb5, 0x56,
+    0xb7, 0x55, 0x86, 0x60, 0x0, 0x0, 0x0, 0x22,
+    0x9, 0x55, 0x55, 0x5b, 0x40, 0x9, 0x10, 0x0,
+    0x9, 0x10, 0x9, 0x65, 0x55, 0x5b, 0x10, 0x9,
+    0x10, 0x0, 0x9, 0x20, 0x9, 0x55, 0x55, 0x5b,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+66FF "替" */
+    0x0, 0x3, 0x0, 0x1, 0x20, 0x0, 0x0, 0xd,
+    0x10, 0x2, 0xb0, 0x0, 0x5, 0x5d, 0x77, 0x46,
+    0xb7, 0x70, 0x0, 0xb, 0x1, 0x3, 0x80, 0x20,
+    0x25, 0x7b, 0x65, 0x59, 0xb5, 0x73, 0x0, 0x86,
+    0x90, 0xa, 0x17, 0x0, 0x4, 0x60, 0x55, 0x81,
+    0x5, 0xa4, 0x43, 0x75, 0x59, 0x55, 0x5a, 0x42,
+    0x0, 0xc0, 0x0, 0x0, 0x2a, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0x29, 0x0, 0x0, 0xc5, 0x55, 0x55,
+    0x69, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x2a, 0x0,
+    0x0, 0xc5, 0x55, 0x55, 0x6a, 0x0, 0x0, 0x20,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+6700 "最" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0,
+    0x6, 0x85, 0x55, 0x55, 0xd2, 0x0, 0x0, 0x6,
+    0x95, 0x55, 0x55, 0xd0, 0x0, 0x0, 0x6, 0x60,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x6, 0x95, 0x55,
+    0x55, 0xd0, 0x0, 0x4, 0x56, 0x55, 0x55, 0x55,
+    0x58, 0xd1, 0x0, 0x29, 0x0, 0xb0, 0x0, 0x3,
+    0x0, 0x0, 0x2b, 0x55, 0xc4, 0x85, 0x5d, 0x30,
+    0x0, 0x2b, 0x55, 0xc0, 0x50, 0x39, 0x0, 0x0,
+    0x29, 0x0, 0xb0, 0x28, 0xb1, 0x0, 0x0, 0x2b,
+    0x67, 0xd5, 0x1a, 0x90, 0x0, 0xa, 0xc7, 0x30,
+    0xb0, 0x56, 0x99, 0x10, 0x0, 0x0, 0x0, 0xb5,
+    0x30, 0x6, 0xb2, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+6703 "會" */
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xba, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0x71, 0x60, 0x0, 0x0, 0x0, 0x1, 0xa5,
+    0x0, 0x5a, 0x61, 0x0, 0x0, 0x57, 0x25, 0x55,
+    0x51, 0x6c, 0xb1, 0x4, 0xb, 0x55, 0x59, 0x55,
+    0xb3, 0x0, 0x0, 0xb, 0x57, 0xb, 0x56, 0x91,
+    0x0, 0x0, 0xb, 0x6, 0xb, 0x60, 0x91, 0x0,
+    0x0, 0x8, 0x55, 0x55, 0x56, 0x70, 0x0, 0x0,
+    0x3, 0xa5, 0x55, 0x5c, 0x30, 0x0, 0x0, 0x2,
+    0xb5, 0x55, 0x5c, 0x10, 0x0, 0x0, 0x2, 0x90,
+    0x0, 0xa, 0x10, 0x0, 0x0, 0x3, 0xb5, 0x55,
+    0x5c, 0x10, 0x0, 0x0, 0x1, 0x30, 0x0, 0x4,
+    0x0, 0x0,
+
+    /* U+6708 "月" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa5,
+    0x55, 0x55, 0xc1, 0x0, 0xc, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0xc0, 0x0, 0xd,
+    0x55, 0x55, 0x5c, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0xc0, 0x0, 0xc, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0xd5, 0x55, 0x55, 0xc0, 0x0, 0x2a, 0x0, 0x0,
+    0xc, 0x0, 0x5, 0x70, 0x0, 0x0, 0xc0, 0x0,
+    0xa1, 0x0, 0x0, 0xc, 0x0, 0x37, 0x0, 0x1,
+    0x11, 0xd0, 0x26, 0x0, 0x0, 0x5, 0xe9, 0x2,
+    0x0, 0x0, 0x0, 0x1, 0x0,
+
+    /* U+6709 "有" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe3, 0x0, 0x0, 0x0, 0x15, 0x55,
+    0x58, 0xc5, 0x55, 0x5a, 0xc1, 0x1, 0x0, 0xc,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x77, 0x0,
+    0x0, 0x40, 0x0, 0x0, 0x2, 0xe5, 0x55, 0x55,
+    0xe0, 0x0, 0x0, 0x19, 0xc0, 0x0, 0x0, 0xc0,
+    0x0, 0x1, 0x80, 0xc5, 0x55, 0x55, 0xc0, 0x0,
+    0x15, 0x0, 0xc0, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0x0, 0xd5, 0x55, 0x55, 0xc0, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xc0, 0x0,
+    0x5c, 0x90, 0x0, 0x0, 0x0, 0x10, 0x0, 0x2,
+    0x0, 0x0,
+
+    /* U+670B "朋" */
+    0x0, 0x75, 0x59, 0x20, 0x85, 0x59, 0x20, 0xb,
+    0x0, 0xb0, 0xb, 0x0, 0xb0, 0x0, 0xb0, 0xb,
+    0x0, 0xb0, 0xb, 0x0, 0xc, 0x55, 0xc0, 0xc,
+    0x55, 0xc0, 0x0, 0xb0, 0xb, 0x0, 0xb0, 0xb,
+    0x0, 0xb, 0x0, 0xb0, 0xb, 0x0, 0xb0, 0x0,
+    0xc5, 0x5c, 0x0, 0xc5, 0x5c, 0x0, 0xa, 0x0,
+    0xb0, 0xa, 0x0, 0xb0, 0x0, 0xa0, 0xb, 0x3,
+    0x70, 0xb, 0x0, 0x36, 0x0, 0xb0, 0x82, 0x0,
+    0xb0, 0x7, 0x2, 0x6d, 0x18, 0x0, 0xc, 0x1,
+    0x40, 0x4, 0x66, 0x0, 0x4c, 0xd0, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x10, 0x0,
+
+    /* U+670D "服" */
+    0x0, 0x95, 0x5a, 0x9, 0x55, 0x5a, 0x10, 0x0,
+    0xb0, 0xb, 0xb, 0x0, 0xc, 0x0, 0x0, 0xb0,
+    0xb, 0xb, 0x0, 0xc, 0x0, 0x0, 0xc5, 0x5b,
+    0xb, 0x4, 0x89, 0x0, 0x0, 0xb0, 0xb, 0xb,
+    0x0, 0x51, 0x0, 0x0, 0xb0, 0xb, 0xc, 0x65,
+    0x5a, 0x50, 0x0, 0xc5, 0x5b, 0xb, 0x42, 0xc,
+    0x0, 0x0, 0xb0, 0xb, 0xb, 0x7, 0x29, 0x0,
+    0x0, 0xa0, 0xb, 0xb, 0x6, 0xb2, 0x0, 0x4,
+    0x60, 0xb, 0xb, 0x4, 0xd1, 0x0, 0x8, 0x2,
+    0x1b, 0xb, 0x37, 0x1c, 0x61, 0x14, 0x1, 0xc7,
+    0xd, 0x30, 0x1, 0x71, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x0,
+
+    /* U+671B "望" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x10, 0x8, 0x55, 0x59, 0x10, 0x0, 0x5,
+    0x14, 0xc, 0x0, 0xb, 0x0, 0x16, 0xb5, 0x57,
+    0x2d, 0x55, 0x5c, 0x0, 0x0, 0xb0, 0x0, 0xc,
+    0x0, 0xb, 0x0, 0x0, 0xb0, 0x25, 0x3c, 0x55,
+    0x5c, 0x0, 0x0, 0xca, 0x60, 0x75, 0x2, 0x3c,
+    0x0, 0x0, 0x40, 0x3, 0x60, 0x0, 0x67, 0x0,
+    0x3, 0x65, 0x57, 0x75, 0x55, 0x6b, 0x10, 0x0,
+    0x0, 0x0, 0xc0, 0x0, 0x10, 0x0, 0x0, 0x46,
+    0x55, 0xd5, 0x56, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0x0, 0x0, 0x15, 0x55, 0x55, 0xd5,
+    0x55, 0x5b, 0x90, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+671D "朝" */
+    0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc0, 0x0, 0x42, 0x22, 0x70, 0x4, 0x55,
+    0xc5, 0x75, 0x93, 0x22, 0xc0, 0x0, 0x0, 0xb0,
+    0x0, 0x91, 0x0, 0xb0, 0x0, 0xa5, 0x95, 0xc0,
+    0x93, 0x11, 0xb0, 0x0, 0xb0, 0x0, 0xb0, 0x94,
+    0x33, 0xb0, 0x0, 0xc5, 0x55, 0xb0, 0x91, 0x0,
+    0xb0, 0x0, 0xb0, 0x0, 0xb0, 0xa1, 0x0, 0xb0,
+    0x0, 0xc5, 0xc5, 0x90, 0xb5, 0x55, 0xb0, 0x0,
+    0x0, 0xb0, 0x31, 0xb0, 0x0, 0xb0, 0x16, 0x55,
+    0xc5, 0x55, 0x80, 0x0, 0xb0, 0x0, 0x0, 0xb0,
+    0x8, 0x10, 0x0, 0xb0, 0x0, 0x0, 0xc0, 0x43,
+    0x0, 0x4c, 0x80, 0x0, 0x0, 0x20, 0x10, 0x0,
+    0x1, 0x0,
+
+    /* U+671F "期" */
+    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0x0, 0xd0, 0x16, 0x44, 0x81, 0x0, 0x1a,
+    0x0, 0xc5, 0x1b, 0x11, 0xc0, 0x3, 0x6c, 0x55,
+    0xd5, 0x3b, 0x0, 0xc0, 0x0, 0x1c, 0x55, 0xc0,
+    0x1c, 0x55, 0xc0, 0x0, 0x1a, 0x0, 0xc0, 0x1a,
+    0x0, 0xc0, 0x0, 0x1c, 0x55, 0xc0, 0x1a, 0x0,
+    0xc0, 0x0, 0x1a, 0x0, 0xc0, 0x2b, 0x22, 0xc0,
+    0x3, 0x6c, 0x55, 0xda, 0x5a, 0x33, 0xc0, 0x0,
+    0x6, 0x13, 0x0, 0x66, 0x0, 0xc0, 0x0, 0x2c,
+    0x24, 0xa0, 0xb1, 0x0, 0xc0, 0x0, 0xa1, 0x0,
+    0x75, 0x60, 0x10, 0xc0, 0x6, 0x0, 0x0, 0x35,
+    0x0, 0x2b, 0xa0, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+6728 "木" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc1, 0x0, 0x3, 0x0, 0x7, 0x55, 0x57, 0xe7,
+    0x55, 0x5b, 0x50, 0x0, 0x0, 0xb, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2b, 0xc3, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0xb3, 0xc1, 0xa1, 0x0, 0x0,
+    0x0, 0x6, 0x70, 0xc1, 0x3b, 0x0, 0x0, 0x0,
+    0x48, 0x0, 0xc1, 0x6, 0xd3, 0x0, 0x3, 0x70,
+    0x0, 0xc1, 0x0, 0x7f, 0xa0, 0x23, 0x0, 0x0,
+    0xc1, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0xc1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+672A "未" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa2, 0x0, 0x50, 0x0, 0x0, 0x46, 0x55,
+    0xc7, 0x56, 0x71, 0x0, 0x0, 0x0, 0x0, 0xa2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa2, 0x0,
+    0x5, 0x0, 0x6, 0x55, 0x58, 0xf9, 0x55, 0x58,
+    0x40, 0x0, 0x0, 0xc, 0xd5, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x86, 0xa2, 0x81, 0x0, 0x0, 0x0,
+    0x6, 0x70, 0xa2, 0x1c, 0x20, 0x0, 0x0, 0x65,
+    0x0, 0xa2, 0x2, 0xe8, 0x10, 0x16, 0x20, 0x0,
+    0xa3, 0x0, 0x2c, 0x80, 0x0, 0x0, 0x0, 0xb3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+672B "末" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa2, 0x0, 0x5, 0x0, 0x7, 0x55, 0x55,
+    0xc7, 0x55, 0x58, 0x40, 0x0, 0x0, 0x0, 0xa2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa2, 0x0,
+    0x80, 0x0, 0x0, 0x55, 0x5a, 0xfa, 0x55, 0x52,
+    0x0, 0x0, 0x0, 0x1c, 0xb4, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0xb3, 0xa2, 0x74, 0x0, 0x0, 0x0,
+    0x9, 0x40, 0xa2, 0xb, 0x60, 0x0, 0x0, 0x83,
+    0x0, 0xa2, 0x0, 0xcc, 0x60, 0x26, 0x10, 0x0,
+    0xa3, 0x0, 0x7, 0x20, 0x0, 0x0, 0x0, 0xb3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+672C "本" */
+    0x0, 0x0, 0x0, 0x13, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3c, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2a, 0x0, 0x0, 0x0, 0x2, 0x55, 0x55,
+    0x6c, 0x55, 0x58, 0xb0, 0x0, 0x10, 0x0, 0xea,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x6, 0xaa, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x1c, 0x3a, 0x18, 0x0,
+    0x0, 0x0, 0x0, 0xa3, 0x2a, 0x7, 0x50, 0x0,
+    0x0, 0x7, 0x50, 0x2a, 0x0, 0xb7, 0x0, 0x0,
+    0x66, 0x55, 0x6c, 0x59, 0x7c, 0xd3, 0x5, 0x20,
+    0x0, 0x2a, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x2a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3b,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0x0,
+    0x0, 0x0,
+
+    /* U+672D "札" */
+    0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xc0, 0x0, 0xd2, 0x0, 0x0, 0x0, 0x3,
+    0xa0, 0x0, 0xd0, 0x0, 0x0, 0x0, 0x2, 0xa0,
+    0x60, 0xd0, 0x0, 0x0, 0x6, 0x57, 0xc5, 0x50,
+    0xd0, 0x0, 0x0, 0x0, 0x7, 0xb0, 0x0, 0xd0,
+    0x0, 0x0, 0x0, 0xc, 0xca, 0x30, 0xd0, 0x0,
+    0x0, 0x0, 0x3a, 0xa3, 0xe0, 0xd0, 0x0, 0x0,
+    0x0, 0x93, 0xa0, 0x30, 0xd0, 0x0, 0x0, 0x3,
+    0x42, 0xa0, 0x0, 0xd0, 0x0, 0x30, 0x4, 0x2,
+    0xa0, 0x0, 0xd0, 0x0, 0x60, 0x0, 0x3, 0xa0,
+    0x0, 0xc0, 0x0, 0xa2, 0x0, 0x3, 0xa0, 0x0,
+    0x9c, 0xaa, 0xd3, 0x0, 0x1, 0x30, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+673A "机" */
+    0x0, 0x5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x2, 0x0, 0x40, 0x0, 0x0, 0xc,
+    0x0, 0x1c, 0x55, 0xd1, 0x0, 0x0, 0xc, 0x4,
+    0x1b, 0x0, 0xc0, 0x0, 0x5, 0x6e, 0x55, 0x1b,
+    0x0, 0xc0, 0x0, 0x0, 0x4d, 0x0, 0x1b, 0x0,
+    0xc0, 0x0, 0x0, 0x8d, 0x94, 0x1b, 0x0, 0xc0,
+    0x0, 0x0, 0xac, 0xc, 0x1a, 0x0, 0xc0, 0x0,
+    0x3, 0x5c, 0x0, 0x29, 0x0, 0xc0, 0x0, 0x7,
+    0xc, 0x0, 0x56, 0x0, 0xc0, 0x0, 0x22, 0xc,
+    0x0, 0xa1, 0x0, 0xc0, 0x50, 0x0, 0xc, 0x2,
+    0x70, 0x0, 0xc0, 0x70, 0x0, 0xd, 0x7, 0x0,
+    0x0, 0xba, 0xd3, 0x0, 0x8, 0x30, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6750 "材" */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0,
+    0xd, 0x30, 0x0, 0x0, 0xd2, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0xc, 0x6,
+    0x0, 0x0, 0xd1, 0x60, 0x35, 0x5e, 0x55, 0x24,
+    0x46, 0xf4, 0x40, 0x0, 0x1f, 0x50, 0x0, 0x9,
+    0xf0, 0x0, 0x0, 0x7f, 0x4b, 0x0, 0x2c, 0xd0,
+    0x0, 0x0, 0xbc, 0x9, 0x10, 0xa2, 0xd0, 0x0,
+    0x5, 0x5c, 0x0, 0x7, 0x50, 0xd0, 0x0, 0x7,
+    0xc, 0x0, 0x55, 0x0, 0xd0, 0x0, 0x40, 0xc,
+    0x3, 0x20, 0x0, 0xd0, 0x0, 0x0, 0xc, 0x10,
+    0x0, 0x0, 0xd0, 0x0, 0x0, 0xc, 0x10, 0x0,
+    0x5c, 0xd0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x1,
+    0x10, 0x0,
+
+    /* U+6751 "村" */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0,
+    0xd, 0x20, 0x0, 0x0, 0xd2, 0x0, 0x0, 0xd,
+    0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0xd, 0x5,
+    0x0, 0x0, 0xd1, 0x40, 0x25, 0x5f, 0x55, 0x25,
+    0x55, 0xe5, 0x40, 0x0, 0x4f, 0x20, 0x3, 0x0,
+    0xd0, 0x0, 0x0, 0x8f, 0x69, 0x6, 0x60, 0xd0,
+    0x0, 0x0, 0x9d, 0xb, 0x10, 0xe0, 0xd0, 0x0,
+    0x6, 0x3d, 0x0, 0x0, 0x40, 0xd0, 0x0, 0x6,
+    0xd, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x30, 0xd,
+    0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0xd, 0x0,
+    0x0, 0x0, 0xd0, 0x0, 0x0, 0xd, 0x0, 0x0,
+    0x5c, 0xe0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x2,
+    0x10, 0x0,
+
+    /* U+675F "束" */
+    0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1d, 0x0, 0x0, 0x10, 0x5, 0x65,
+    0x55, 0x5d, 0x55, 0x55, 0xb4, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0x0, 0x29, 0x55, 0x5d,
+    0x55, 0x6b, 0x0, 0x0, 0x1b, 0x0, 0xc, 0x0,
+    0x2a, 0x0, 0x0, 0x1b, 0x0, 0xc, 0x0, 0x2a,
+    0x0, 0x0, 0x1c, 0x55, 0x8d, 0x65, 0x7a, 0x0,
+    0x0, 0x28, 0x5, 0xbc, 0x60, 0x13, 0x0, 0x0,
+    0x0, 0x2c, 0x1c, 0x18, 0x0, 0x0, 0x0, 0x2,
+    0xb1, 0xc, 0x4, 0xa2, 0x0, 0x0, 0x49, 0x0,
+    0x1c, 0x0, 0x4e, 0xa3, 0x5, 0x40, 0x0, 0x1c,
+    0x0, 0x1, 0x60, 0x0, 0x0, 0x0, 0x2, 0x0,
+    0x0, 0x0,
+
+    /* U+6761 "条" */
+    0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4c, 0x0, 0x1, 0x40, 0x0, 0x0, 0x0,
+    0xb8, 0x55, 0x5c, 0xb0, 0x0, 0x0, 0x7, 0x35,
+    0x10, 0x4d, 0x0, 0x0, 0x0, 0x44, 0x0, 0x95,
+    0xc2, 0x0, 0x0, 0x1, 0x20, 0x0, 0x9f, 0x70,
+    0x0, 0x0, 0x0, 0x2, 0x79, 0x47, 0x9d, 0xa7,
+    0x63, 0x4, 0x54, 0x0, 0xe, 0x0, 0x58, 0x70,
+    0x0, 0x17, 0x55, 0x5e, 0x55, 0x96, 0x0, 0x0,
+    0x0, 0x54, 0xd, 0x21, 0x0, 0x0, 0x0, 0x2,
+    0xd3, 0xd, 0x7, 0x80, 0x0, 0x0, 0x2a, 0x10,
+    0xd, 0x0, 0x8c, 0x0, 0x3, 0x50, 0x5, 0xda,
+    0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+6765 "来" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa2, 0x0, 0x17, 0x0, 0x2, 0x66, 0x55,
+    0xc7, 0x55, 0x75, 0x10, 0x0, 0x8, 0x60, 0xa2,
+    0x7, 0xa0, 0x0, 0x0, 0x0, 0xe0, 0xa2, 0x1a,
+    0x0, 0x0, 0x25, 0x55, 0x75, 0xc7, 0x95, 0x5a,
+    0x90, 0x1, 0x0, 0x8, 0xf6, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x2b, 0xa2, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0xc1, 0xa2, 0x3a, 0x0, 0x0, 0x0, 0xa,
+    0x20, 0xa2, 0x5, 0xc3, 0x0, 0x1, 0x81, 0x0,
+    0xa3, 0x0, 0x4e, 0xa0, 0x24, 0x0, 0x0, 0xb3,
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+676F "杯" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc2, 0x0, 0x0, 0x0, 0x42, 0x0, 0xb, 0x4,
+    0x55, 0x9a, 0x55, 0x30, 0x0, 0xb0, 0x40, 0xa,
+    0x20, 0x0, 0x15, 0x5d, 0x56, 0x0, 0xb0, 0x0,
+    0x0, 0x1, 0xf4, 0x0, 0x7d, 0x20, 0x0, 0x0,
+    0x7f, 0x68, 0xb, 0xb0, 0x30, 0x0, 0x9, 0xb0,
+    0xa8, 0x2b, 0x2, 0x90, 0x6, 0x2b, 0x3, 0x50,
+    0xb0, 0x7, 0xa2, 0x40, 0xb2, 0x50, 0xb, 0x0,
+    0x5, 0x20, 0xb, 0x10, 0x0, 0xc0, 0x0, 0x0,
+    0x0, 0xb1, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc,
+    0x10, 0x0, 0xc1, 0x0, 0x0, 0x0, 0x30, 0x0,
+    0x2, 0x0, 0x0,
+
+    /* U+6771 "東" */
+    0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0x0, 0x2, 0x10, 0x3, 0x65,
+    0x55, 0x5c, 0x55, 0x59, 0x80, 0x0, 0x2, 0x0,
+    0x1b, 0x0, 0x40, 0x0, 0x0, 0xd, 0x55, 0x5c,
+    0x55, 0xd3, 0x0, 0x0, 0xc, 0x0, 0x1b, 0x0,
+    0xc0, 0x0, 0x0, 0xd, 0x55, 0x5c, 0x55, 0xd0,
+    0x0, 0x0, 0xd, 0x55, 0x6c, 0x55, 0xd0, 0x0,
+    0x0, 0x7, 0x3, 0xdb, 0x50, 0x40, 0x0, 0x0,
+    0x0, 0xc, 0x3b, 0x44, 0x0, 0x0, 0x0, 0x0,
+    0xa3, 0x1b, 0x9, 0x50, 0x0, 0x0, 0x9, 0x30,
+    0x1b, 0x0, 0xac, 0x51, 0x4, 0x60, 0x0, 0x1b,
+    0x0, 0x5, 0xa2, 0x1, 0x0, 0x0, 0x2, 0x0,
+    0x0, 0x0,
+
+    /* U+6790 "析" */
+    0x0, 0x5, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0,
+    0xd, 0x0, 0x24, 0x46, 0x9a, 0x40, 0x0, 0xc,
+    0x0, 0x39, 0x0, 0x0, 0x0, 0x5, 0x5d, 0x69,
+    0x39, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x0, 0x39,
+    0x0, 0x0, 0x10, 0x0, 0x5e, 0x10, 0x3b, 0x55,
+    0x85, 0xb2, 0x0, 0xac, 0xa4, 0x38, 0x0, 0xc0,
+    0x0, 0x0, 0x9c, 0x28, 0x48, 0x0, 0xc0, 0x0,
+    0x6, 0x2c, 0x0, 0x56, 0x0, 0xc0, 0x0, 0x5,
+    0xc, 0x0, 0x83, 0x0, 0xc0, 0x0, 0x0, 0xc,
+    0x0, 0xb0, 0x0, 0xc0, 0x0, 0x0, 0xd, 0x6,
+    0x40, 0x0, 0xc0, 0x0, 0x0, 0xd, 0x25, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0x2, 0x10, 0x0, 0x0,
+    0x10, 0x0,
+
+    /* U+6797 "林" */
+    0x0, 0x1, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0xb, 0x30, 0x0, 0xb3, 0x0, 0x0, 0x0, 0xa,
+    0x10, 0x0, 0xb1, 0x0, 0x0, 0x0, 0xa, 0x33,
+    0x0, 0xb1, 0x18, 0x0, 0x5, 0x5d, 0x64, 0x34,
+    0xf8, 0x44, 0x10, 0x0, 0xf, 0x20, 0x5, 0xf7,
+    0x0, 0x0, 0x0, 0x5f, 0x94, 0xa, 0xc7, 0x10,
+    0x0, 0x0, 0xab, 0x2c, 0x27, 0xb2, 0x90, 0x0,
+    0x4, 0x5a, 0x11, 0x80, 0xb1, 0x94, 0x0, 0x6,
+    0xa, 0x15, 0x20, 0xb1, 0x1e, 0x60, 0x20, 0xa,
+    0x33, 0x0, 0xb1, 0x3, 0x30, 0x0, 0xa, 0x10,
+    0x0, 0xb1, 0x0, 0x0, 0x0, 0xb, 0x20, 0x0,
+    0xb1, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x40,
+    0x0, 0x0,
+
+    /* U+679C "果" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x55, 0x59, 0x55, 0xc3, 0x0, 0x0, 0xc,
+    0x0, 0x1b, 0x0, 0xc0, 0x0, 0x0, 0xd, 0x55,
+    0x6c, 0x55, 0xd0, 0x0, 0x0, 0xc, 0x0, 0x1b,
+    0x0, 0xc0, 0x0, 0x0, 0xd, 0x55, 0x6c, 0x55,
+    0xd0, 0x0, 0x0, 0x9, 0x0, 0x1b, 0x0, 0x70,
+    0x0, 0x3, 0x55, 0x55, 0x6c, 0x55, 0x5b, 0xb1,
+    0x1, 0x0, 0x4, 0xcd, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x3c, 0x2b, 0x74, 0x0, 0x0, 0x0, 0x3,
+    0xa0, 0x1b, 0xb, 0x80, 0x0, 0x0, 0x66, 0x0,
+    0x2b, 0x0, 0x9e, 0x92, 0x5, 0x10, 0x0, 0x2b,
+    0x0, 0x4, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+67D0 "某" */
+    0x0, 0x0, 0x20, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x0, 0xc1, 0x0, 0xd, 0x0, 0x0, 0x5, 0x55,
+    0xd5, 0x55, 0x5d, 0x5a, 0x50, 0x0, 0x0, 0xc0,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xc5, 0x55,
+    0x5c, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0x0, 0xd5, 0x85, 0x5c, 0x0,
+    0x0, 0x0, 0x0, 0x10, 0xa1, 0x0, 0x3, 0x30,
+    0x7, 0x55, 0x5b, 0xe9, 0x55, 0x56, 0x60, 0x0,
+    0x0, 0x39, 0xa3, 0x60, 0x0, 0x0, 0x0, 0x2,
+    0xa0, 0xa1, 0x58, 0x0, 0x0, 0x0, 0x48, 0x0,
+    0xa2, 0x4, 0xd8, 0x40, 0x15, 0x30, 0x0, 0xb2,
+    0x0, 0x19, 0x60, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+67E5 "查" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0x20, 0x0, 0x10, 0x6, 0x55, 0x57,
+    0xe6, 0x55, 0x59, 0x40, 0x0, 0x1, 0xbd, 0x25,
+    0x0, 0x0, 0x0, 0x1, 0xa2, 0xc0, 0x57, 0x0,
+    0x0, 0x2, 0x91, 0xb, 0x0, 0x4c, 0x72, 0x5,
+    0x49, 0x65, 0x55, 0x56, 0xc7, 0x41, 0x0, 0xa2,
+    0x0, 0x0, 0x29, 0x0, 0x0, 0x9, 0x65, 0x55,
+    0x56, 0x90, 0x0, 0x0, 0x92, 0x0, 0x0, 0x29,
+    0x0, 0x0, 0xa, 0x65, 0x55, 0x56, 0xa0, 0x0,
+    0x0, 0x91, 0x0, 0x0, 0x15, 0x10, 0x4, 0x55,
+    0x55, 0x55, 0x55, 0x5e, 0x30, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+67F1 "柱" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x4b, 0x0, 0x0, 0x0, 0xc, 0x13,
+    0x23, 0x36, 0x34, 0xb1, 0x6, 0x5d, 0x55, 0x22,
+    0x1c, 0x11, 0x10, 0x0, 0x3d, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0x8d, 0xa3, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0xac, 0x3a, 0x35, 0x5d, 0x59, 0x80,
+    0x5, 0x4c, 0x0, 0x10, 0xc, 0x0, 0x0, 0x6,
+    0xc, 0x0, 0x0, 0xc, 0x0, 0x0, 0x10, 0xc,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0xc, 0x0, 0x30, 0x0, 0xd, 0x5, 0x55,
+    0x58, 0x56, 0x92, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+67FB "査" */
+    0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0x0, 0x2, 0x80, 0x4, 0x65, 0x55,
+    0xdd, 0x95, 0x55, 0x51, 0x0, 0x0, 0x9, 0x6c,
+    0x37, 0x0, 0x0, 0x0, 0x0, 0x95, 0xc, 0x4,
+    0xb4, 0x0, 0x0, 0x58, 0x20, 0xa, 0x0, 0x4a,
+    0xe6, 0x4, 0x11, 0xc5, 0x55, 0x55, 0xe0, 0x10,
+    0x0, 0x1, 0xb0, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0x1, 0xc5, 0x55, 0x55, 0xc0, 0x0, 0x0, 0x1,
+    0xc5, 0x55, 0x55, 0xc0, 0x0, 0x0, 0x1, 0xb0,
+    0x0, 0x0, 0xc0, 0x10, 0x5, 0x55, 0xc5, 0x55,
+    0x55, 0xd6, 0xf5, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+67FF "柿" */
+    0x0, 0x2, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0xe, 0x0, 0x0, 0x95, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x2b, 0x0, 0x10, 0x0, 0xc, 0x14,
+    0x65, 0x58, 0x55, 0xb2, 0x5, 0x5d, 0x65, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0x4d, 0x0, 0x75, 0x5d,
+    0x55, 0x80, 0x0, 0x9d, 0xb3, 0xc0, 0xc, 0x2,
+    0xa0, 0x0, 0x9c, 0x35, 0xc0, 0xc, 0x2, 0xa0,
+    0x5, 0x3c, 0x0, 0xc0, 0xc, 0x2, 0xa0, 0x6,
+    0xc, 0x0, 0xc0, 0xc, 0x2, 0xa0, 0x10, 0xc,
+    0x0, 0xc0, 0xc, 0x2a, 0x80, 0x0, 0xd, 0x0,
+    0x20, 0xc, 0x2, 0x0, 0x0, 0xd, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x0,
+
+    /* U+6811 "树" */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0,
+    0xd, 0x0, 0x0, 0x0, 0xd, 0x0, 0x0, 0xc,
+    0x4, 0x55, 0x91, 0xc, 0x0, 0x0, 0xc, 0x22,
+    0x0, 0xc0, 0xc, 0x41, 0x5, 0x5d, 0x66, 0x3,
+    0x95, 0x5d, 0x53, 0x0, 0x3d, 0x0, 0x57, 0x40,
+    0xc, 0x0, 0x0, 0x7d, 0xa2, 0x6c, 0x53, 0xc,
+    0x0, 0x0, 0xac, 0x28, 0x4d, 0xc, 0xc, 0x0,
+    0x3, 0x4c, 0x0, 0xa8, 0x58, 0xc, 0x0, 0x6,
+    0xc, 0x5, 0x33, 0x90, 0xc, 0x0, 0x10, 0xc,
+    0x24, 0x0, 0x20, 0xc, 0x0, 0x0, 0xc, 0x10,
+    0x0, 0x11, 0x1c, 0x0, 0x0, 0xd, 0x0, 0x0,
+    0x6, 0xe9, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x20, 0x0,
+
+    /* U+6821 "校" */
+    0x0, 0x1, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0,
+    0xe, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x56, 0x0, 0x40, 0x0, 0xc, 0x15,
+    0x65, 0x55, 0x56, 0x81, 0x5, 0x5e, 0x54, 0x8,
+    0x61, 0x61, 0x0, 0x0, 0x4e, 0x60, 0x2b, 0x0,
+    0x2d, 0x40, 0x0, 0x9d, 0x86, 0x80, 0x0, 0x34,
+    0x90, 0x0, 0x9c, 0x4, 0x4, 0x0, 0xd5, 0x0,
+    0x5, 0x3c, 0x0, 0x5, 0x3, 0xb0, 0x0, 0x6,
+    0xc, 0x0, 0x1, 0x6b, 0x20, 0x0, 0x10, 0xc,
+    0x0, 0x0, 0xa9, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0x6, 0x7a, 0x91, 0x0, 0x0, 0xd, 0x4, 0x72,
+    0x0, 0x5d, 0xc3, 0x0, 0x3, 0x21, 0x0, 0x0,
+    0x0, 0x20,
+
+    /* U+682A "株" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0x10, 0x1, 0xd, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x3c, 0xc, 0x0, 0x0, 0x0, 0xc, 0x23,
+    0x7a, 0x5d, 0x59, 0x60, 0x6, 0x6d, 0x54, 0xa0,
+    0xc, 0x0, 0x0, 0x0, 0x4d, 0x1, 0x20, 0xc,
+    0x0, 0x10, 0x0, 0x9d, 0xb5, 0x65, 0x8d, 0x65,
+    0x94, 0x0, 0x9c, 0x34, 0x1, 0xdc, 0x50, 0x0,
+    0x6, 0x2c, 0x0, 0x9, 0x4c, 0x71, 0x0, 0x5,
+    0xc, 0x0, 0x38, 0xc, 0x1a, 0x0, 0x0, 0xc,
+    0x1, 0x80, 0xc, 0x6, 0xb2, 0x0, 0xd, 0x16,
+    0x0, 0xc, 0x0, 0x84, 0x0, 0xd, 0x10, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x2,
+    0x0, 0x0,
+
+    /* U+6839 "根" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0x0, 0x85, 0x55, 0x5c, 0x10, 0x0, 0xc,
+    0x0, 0xc0, 0x0, 0xc, 0x0, 0x1, 0x1c, 0x24,
+    0xc0, 0x0, 0xc, 0x0, 0x4, 0x4d, 0x33, 0xc5,
+    0x55, 0x5c, 0x0, 0x0, 0x4d, 0x10, 0xc0, 0x0,
+    0xc, 0x0, 0x0, 0x9c, 0xa3, 0xc5, 0x65, 0x5c,
+    0x0, 0x0, 0x9c, 0x37, 0xc0, 0x60, 0x7, 0x70,
+    0x5, 0x2c, 0x0, 0xc0, 0x61, 0x68, 0x10, 0x5,
+    0xc, 0x0, 0xc0, 0x1b, 0x10, 0x0, 0x0, 0xc,
+    0x0, 0xc0, 0x8, 0x50, 0x0, 0x0, 0xd, 0x0,
+    0xc2, 0x61, 0xb9, 0x10, 0x0, 0xd, 0x0, 0xd9,
+    0x0, 0x9, 0xd3, 0x0, 0x2, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+683C "格" */
+    0x0, 0x3, 0x0, 0x3, 0x10, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0xc, 0x50, 0x0, 0x0, 0x0, 0xb,
+    0x0, 0x2d, 0x55, 0x5a, 0x0, 0x0, 0xb, 0x23,
+    0x87, 0x0, 0x85, 0x0, 0x5, 0x6d, 0x56, 0x43,
+    0x53, 0xa0, 0x0, 0x0, 0x4d, 0x3, 0x0, 0x9c,
+    0x10, 0x0, 0x0, 0x9c, 0xa2, 0x2, 0xbb, 0x40,
+    0x0, 0x0, 0x8b, 0x25, 0x47, 0x0, 0x9c, 0x72,
+    0x5, 0x2b, 0x24, 0x95, 0x55, 0x5b, 0x60, 0x5,
+    0xb, 0x0, 0xa1, 0x0, 0x29, 0x0, 0x0, 0xb,
+    0x0, 0xa1, 0x0, 0x29, 0x0, 0x0, 0xc, 0x0,
+    0xa1, 0x0, 0x29, 0x0, 0x0, 0xc, 0x0, 0xa6,
+    0x55, 0x6a, 0x0, 0x0, 0x4, 0x0, 0x30, 0x0,
+    0x2, 0x0,
+
+    /* U+6843 "桃" */
+    0x0, 0x2, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x9, 0x4a, 0x40, 0x0, 0x0, 0xb,
+    0x0, 0x9, 0x29, 0x10, 0x0, 0x0, 0xb, 0x32,
+    0x9, 0x29, 0x13, 0x30, 0x5, 0x5d, 0x53, 0x79,
+    0x29, 0x2b, 0x40, 0x0, 0x4d, 0x0, 0xc9, 0x29,
+    0x71, 0x0, 0x0, 0x8c, 0xa2, 0x29, 0x29, 0x10,
+    0x0, 0x0, 0xab, 0x36, 0xb, 0x29, 0x84, 0x0,
+    0x4, 0x4b, 0x3, 0x9b, 0x19, 0x2b, 0x40, 0x7,
+    0xb, 0xa, 0xb, 0x9, 0x10, 0x20, 0x11, 0xb,
+    0x0, 0x29, 0x9, 0x10, 0x40, 0x0, 0xc, 0x0,
+    0x91, 0x9, 0x20, 0x80, 0x0, 0xc, 0x6, 0x30,
+    0x6, 0xca, 0xd2, 0x0, 0x6, 0x21, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6848 "案" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x85, 0x0, 0x0, 0x0, 0x0, 0x75,
+    0x55, 0x86, 0x55, 0x5a, 0x60, 0x3, 0xb0, 0x4,
+    0xa0, 0x0, 0x9, 0x0, 0x1, 0x55, 0x5c, 0x55,
+    0x58, 0x59, 0x60, 0x0, 0x0, 0x94, 0x0, 0xa4,
+    0x0, 0x0, 0x0, 0x0, 0x14, 0x7d, 0xc6, 0x10,
+    0x0, 0x0, 0x1, 0x57, 0x83, 0x6, 0xd4, 0x0,
+    0x0, 0x32, 0x0, 0x2c, 0x0, 0x3, 0x70, 0x3,
+    0x55, 0x57, 0xdc, 0x85, 0x55, 0x61, 0x0, 0x0,
+    0x2b, 0x3a, 0x56, 0x0, 0x0, 0x0, 0x5, 0x80,
+    0x2a, 0x5, 0xb7, 0x30, 0x4, 0x62, 0x0, 0x2b,
+    0x0, 0x18, 0xb2, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0,
+
+    /* U+689D "條" */
+    0x0, 0x3, 0x0, 0x1, 0x30, 0x0, 0x0, 0x0,
+    0x1f, 0x20, 0x6, 0xb0, 0x0, 0x0, 0x0, 0x58,
+    0x0, 0xc, 0x75, 0x5a, 0x10, 0x0, 0xb1, 0x50,
+    0x39, 0x50, 0x78, 0x0, 0x3, 0xf1, 0xc0, 0x80,
+    0x87, 0x90, 0x0, 0x8, 0xb0, 0xb1, 0x0, 0x8d,
+    0x60, 0x0, 0x41, 0xb0, 0xb0, 0x28, 0x41, 0x8d,
+    0x92, 0x0, 0xb0, 0xb3, 0x30, 0x1c, 0x1, 0x40,
+    0x0, 0xb0, 0xb4, 0x65, 0x6b, 0x57, 0x80, 0x0,
+    0xb0, 0xc0, 0x14, 0x1a, 0x10, 0x0, 0x0, 0xb0,
+    0x70, 0xa7, 0x1a, 0x2a, 0x20, 0x0, 0xb0, 0x5,
+    0x60, 0x1a, 0x3, 0xd0, 0x0, 0xb0, 0x23, 0x5,
+    0xd8, 0x0, 0x40, 0x0, 0x20, 0x0, 0x0, 0x20,
+    0x0, 0x0,
+
+    /* U+68B0 "械" */
+    0x0, 0x10, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0xa4, 0x0, 0x0, 0xd, 0x28, 0x0, 0x0, 0x92,
+    0x0, 0x0, 0xb, 0x6, 0x30, 0x0, 0x93, 0x34,
+    0x44, 0x4c, 0x45, 0x90, 0x36, 0xc6, 0x44, 0x12,
+    0xb, 0x0, 0x0, 0x0, 0xd8, 0x19, 0x2c, 0xb,
+    0x3, 0x50, 0x1, 0xf5, 0xa9, 0x1a, 0xa, 0x8,
+    0x50, 0x6, 0xb2, 0x7b, 0x5c, 0x8b, 0xc, 0x0,
+    0x7, 0x92, 0xa, 0xa, 0x8, 0x86, 0x0, 0x41,
+    0x92, 0xa, 0xa, 0x5, 0xd0, 0x10, 0x0, 0x92,
+    0x17, 0xb, 0x9, 0xc0, 0x50, 0x0, 0xa2, 0x60,
+    0x8, 0x83, 0x4a, 0x80, 0x0, 0xa4, 0x30, 0x26,
+    0x10, 0x6, 0xe0, 0x0, 0x30, 0x0, 0x20, 0x0,
+    0x0, 0x10,
+
+    /* U+68EE "森" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc2, 0x0, 0x2, 0x0, 0x5, 0x55,
+    0x57, 0xe7, 0x55, 0x5b, 0x20, 0x0, 0x0, 0x2c,
+    0xd3, 0x50, 0x0, 0x0, 0x0, 0x1, 0xb1, 0xc0,
+    0x69, 0x10, 0x0, 0x0, 0x38, 0x0, 0xc0, 0x7,
+    0xe9, 0x50, 0x4, 0x39, 0x30, 0xb0, 0xd, 0x17,
+    0x20, 0x25, 0x5b, 0x69, 0x35, 0x5d, 0x58, 0x80,
+    0x0, 0x1f, 0x20, 0x0, 0xdc, 0x50, 0x0, 0x0,
+    0x9c, 0x88, 0x7, 0x7b, 0x81, 0x0, 0x4, 0x6a,
+    0x16, 0x39, 0xb, 0x2c, 0x10, 0x25, 0xa, 0x23,
+    0x60, 0xc, 0x6, 0xc1, 0x10, 0xa, 0x22, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x3,
+    0x0, 0x0,
+
+    /* U+690D "植" */
+    0x0, 0x6, 0x0, 0x0, 0x41, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x0, 0xc,
+    0x3, 0x55, 0xc5, 0x58, 0x90, 0x2, 0x2c, 0x73,
+    0x0, 0xb0, 0x0, 0x0, 0x4, 0x4d, 0x31, 0x75,
+    0xc5, 0x5a, 0x0, 0x0, 0x4d, 0x20, 0xb0, 0x0,
+    0xb, 0x0, 0x0, 0x9c, 0xa4, 0xb5, 0x55, 0x5b,
+    0x0, 0x0, 0x9c, 0x13, 0xb0, 0x0, 0xb, 0x0,
+    0x5, 0x3c, 0x0, 0xb5, 0x55, 0x5b, 0x0, 0x5,
+    0xc, 0x0, 0xb0, 0x0, 0xb, 0x0, 0x0, 0xc,
+    0x0, 0xb5, 0x55, 0x5b, 0x0, 0x0, 0xc, 0x0,
+    0xb0, 0x0, 0xb, 0x50, 0x0, 0xc, 0x36, 0x65,
+    0x55, 0x56, 0x62, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+691C "検" */
+    0x0, 0x4, 0x0, 0x0, 0x21, 0x0, 0x0, 0x0,
+    0xe, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x3, 0xb3, 0x50, 0x0, 0x1, 0x1c, 0x43,
+    0x1a, 0x0, 0x6b, 0x30, 0x4, 0x4d, 0x34, 0x76,
+    0x55, 0x87, 0xb3, 0x0, 0x4e, 0x22, 0x0, 0xb,
+    0x0, 0x0, 0x0, 0x9d, 0xa5, 0xa5, 0x5c, 0x5c,
+    0x30, 0x0, 0x9c, 0x14, 0xb0, 0xa, 0xb, 0x0,
+    0x5, 0x3c, 0x0, 0xb5, 0x6b, 0x5c, 0x0, 0x5,
+    0xc, 0x0, 0x70, 0x6b, 0x14, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0xc1, 0xa0, 0x0, 0x0, 0xd, 0x0,
+    0x9, 0x40, 0x4c, 0x30, 0x0, 0xd, 0x2, 0x72,
+    0x0, 0x5, 0xc3, 0x0, 0x2, 0x1, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+695A "楚" */
+    0x0, 0x0, 0x20, 0x0, 0x4, 0x0, 0x0, 0x0,
+    0x0, 0xc1, 0x0, 0xc, 0x0, 0x0, 0x2, 0x55,
+    0xc6, 0x83, 0x5c, 0x59, 0x30, 0x0, 0x4, 0xf2,
+    0x0, 0x7e, 0x0, 0x0, 0x0, 0xb, 0xc6, 0x72,
+    0x9b, 0x77, 0x0, 0x0, 0x82, 0xc0, 0x48, 0xb,
+    0xa, 0x20, 0x5, 0x20, 0xb0, 0x50, 0xb, 0x0,
+    0x0, 0x1, 0x65, 0x55, 0x58, 0x55, 0x5e, 0x30,
+    0x0, 0x0, 0x60, 0xb, 0x0, 0x42, 0x0, 0x0,
+    0x5, 0xb0, 0xc, 0x55, 0x86, 0x0, 0x0, 0xc,
+    0x70, 0xb, 0x0, 0x0, 0x0, 0x0, 0x73, 0x8,
+    0x6b, 0x0, 0x0, 0x0, 0x4, 0x30, 0x0, 0x39,
+    0xbc, 0xce, 0xb1, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+696D "業" */
+    0x0, 0x0, 0x4, 0x0, 0x50, 0x0, 0x0, 0x0,
+    0x76, 0xc, 0x10, 0xc0, 0xb2, 0x0, 0x0, 0xa,
+    0x4b, 0x0, 0xb7, 0x30, 0x0, 0x4, 0x56, 0x6c,
+    0x55, 0xd5, 0x56, 0xb0, 0x1, 0x0, 0x63, 0x0,
+    0x72, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x60,
+    0x35, 0x0, 0x0, 0x45, 0x55, 0xa7, 0x55, 0x55,
+    0x0, 0x0, 0x15, 0x55, 0xb7, 0x55, 0xb1, 0x0,
+    0x0, 0x0, 0x0, 0x82, 0x0, 0x3, 0x10, 0x4,
+    0x55, 0x58, 0xe9, 0x65, 0x56, 0x50, 0x0, 0x0,
+    0x3b, 0xa3, 0x92, 0x0, 0x0, 0x0, 0x7, 0x80,
+    0x92, 0xa, 0xa5, 0x20, 0x4, 0x72, 0x0, 0x93,
+    0x0, 0x4b, 0xc2, 0x0, 0x0, 0x0, 0x30, 0x0,
+    0x0, 0x0,
+
+    /* U+6975 "極" */
+    0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0xb,
+    0x0, 0x55, 0x55, 0xb8, 0x0, 0x3, 0x3c, 0x71,
+    0x0, 0x18, 0x20, 0x0, 0x2, 0x2c, 0x26, 0x58,
+    0x3a, 0x55, 0x81, 0x0, 0x3d, 0x38, 0x1a, 0x19,
+    0x1, 0xb0, 0x0, 0x8c, 0x9d, 0x1a, 0x19, 0x56,
+    0x60, 0x0, 0xab, 0x1c, 0x1a, 0x19, 0xe, 0x10,
+    0x4, 0x5b, 0x8, 0x6c, 0x19, 0x1a, 0x90, 0x7,
+    0xb, 0x9, 0x18, 0x19, 0x60, 0xb0, 0x10, 0xb,
+    0x4, 0x3, 0x3a, 0x30, 0x0, 0x0, 0xc, 0x0,
+    0x2, 0xc5, 0x0, 0x0, 0x0, 0xc, 0x25, 0x55,
+    0x55, 0x55, 0xd2, 0x0, 0x5, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+697D "楽" */
+    0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0x10, 0x0, 0x0, 0x2, 0x71,
+    0x1b, 0x66, 0x5b, 0x6, 0x80, 0x0, 0x3c, 0xb,
+    0x0, 0x1a, 0x37, 0x0, 0x0, 0x1, 0xc, 0x55,
+    0x6c, 0x20, 0x0, 0x0, 0x16, 0x4b, 0x0, 0x1b,
+    0x7b, 0x40, 0x6, 0xa1, 0xc, 0x55, 0x6a, 0x2,
+    0xa0, 0x0, 0x0, 0x5, 0xa, 0x14, 0x0, 0x20,
+    0x5, 0x65, 0x55, 0x9d, 0x75, 0x57, 0x80, 0x0,
+    0x0, 0x6, 0xbc, 0x71, 0x0, 0x0, 0x0, 0x0,
+    0x69, 0xc, 0xa, 0x30, 0x0, 0x0, 0x18, 0x50,
+    0xc, 0x1, 0xbb, 0x61, 0x5, 0x50, 0x0, 0xd,
+    0x0, 0x4, 0x60, 0x0, 0x0, 0x0, 0x3, 0x0,
+    0x0, 0x0,
+
+    /* U+6982 "概" */
+    0x0, 0x5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1a, 0x5, 0x57, 0x24, 0x55, 0x93, 0x0, 0x9,
+    0xa, 0x9, 0x0, 0xb, 0x0, 0x2, 0x3b, 0x7a,
+    0x9, 0x8, 0x2a, 0x0, 0x2, 0x4a, 0x2a, 0x5b,
+    0xb, 0x19, 0x0, 0x0, 0x6c, 0x2a, 0x9, 0x2a,
+    0x28, 0x0, 0x0, 0xaa, 0xcc, 0x9, 0x79, 0x8a,
+    0x95, 0x0, 0x99, 0x3c, 0x57, 0x0, 0x88, 0x0,
+    0x6, 0x39, 0xa, 0x15, 0x0, 0xcb, 0x0, 0x6,
+    0x19, 0xa, 0xa, 0x55, 0x7a, 0x0, 0x10, 0x19,
+    0xb, 0x92, 0x4a, 0xa, 0x3, 0x0, 0x1a, 0x6,
+    0x10, 0x92, 0xa, 0x6, 0x0, 0x1a, 0x0, 0x16,
+    0x10, 0xa, 0xa9, 0x0, 0x3, 0x0, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+69CB "構" */
+    0x0, 0x20, 0x0, 0x4, 0x0, 0x30, 0x0, 0x0,
+    0x84, 0x0, 0xc, 0x0, 0xc1, 0x20, 0x0, 0x82,
+    0x15, 0x5c, 0x55, 0xc6, 0x60, 0x0, 0x82, 0x44,
+    0x5c, 0x55, 0xc9, 0x30, 0x25, 0xb6, 0x51, 0xa,
+    0x0, 0xa0, 0x40, 0x0, 0xd9, 0x55, 0x56, 0x97,
+    0x65, 0x60, 0x1, 0xf4, 0xa5, 0x55, 0xa8, 0x58,
+    0x20, 0x6, 0xc2, 0x38, 0x20, 0x74, 0xa, 0x0,
+    0x8, 0x82, 0x8, 0x65, 0xa8, 0x5b, 0x0, 0x32,
+    0x82, 0x8, 0x20, 0x74, 0xa, 0x50, 0x10, 0x82,
+    0x5b, 0x65, 0x55, 0x5b, 0x61, 0x0, 0x82, 0x8,
+    0x20, 0x0, 0xa, 0x0, 0x0, 0x92, 0x9, 0x20,
+    0x2, 0x8d, 0x0, 0x0, 0x10, 0x2, 0x0, 0x0,
+    0x1, 0x0,
+
+    /* U+69D8 "様" */
+    0x0, 0x2, 0x0, 0x3, 0x0, 0x4, 0x0, 0x0,
+    0xc, 0x0, 0x3, 0xb0, 0xb, 0x10, 0x0, 0xa,
+    0x0, 0x45, 0xb5, 0x86, 0xb2, 0x0, 0xa, 0x23,
+    0x0, 0xb, 0x0, 0x0, 0x5, 0x6c, 0x54, 0x25,
+    0x5c, 0x57, 0x70, 0x0, 0x4d, 0x50, 0x0, 0xb,
+    0x0, 0x10, 0x0, 0x8a, 0xa4, 0x65, 0x5b, 0x55,
+    0x94, 0x0, 0xaa, 0x20, 0x0, 0xb, 0x20, 0x80,
+    0x4, 0x4a, 0x4, 0x59, 0x7b, 0x47, 0x50, 0x6,
+    0xa, 0x0, 0xa, 0x1b, 0x72, 0x0, 0x0, 0xa,
+    0x0, 0x47, 0xb, 0xb, 0x0, 0x0, 0xb, 0x1,
+    0x80, 0xb, 0x5, 0xc3, 0x0, 0xb, 0x25, 0x4,
+    0xac, 0x0, 0x40, 0x0, 0x1, 0x0, 0x0, 0x11,
+    0x0, 0x0,
+
+    /* U+6A02 "樂" */
+    0x0, 0x21, 0x0, 0x32, 0x0, 0x30, 0x0, 0x0,
+    0x86, 0x1, 0x72, 0x20, 0xa5, 0x0, 0x0, 0xa2,
+    0x3a, 0x55, 0xc1, 0x83, 0x20, 0x7, 0x38, 0x7a,
+    0x0, 0xa7, 0x2a, 0x40, 0x9, 0x7a, 0xa, 0x55,
+    0xa9, 0x78, 0x0, 0x0, 0x73, 0xa, 0x0, 0xa0,
+    0x83, 0x0, 0x6, 0x75, 0xaa, 0x55, 0xa6, 0x55,
+    0xb0, 0x8, 0x62, 0xa4, 0x45, 0x3a, 0x62, 0x90,
+    0x6, 0x55, 0x55, 0xaa, 0x55, 0x5a, 0x70, 0x0,
+    0x0, 0xb, 0xb7, 0x60, 0x0, 0x0, 0x0, 0x1,
+    0xa4, 0x66, 0x48, 0x0, 0x0, 0x0, 0x58, 0x10,
+    0x66, 0x4, 0xd8, 0x50, 0x15, 0x20, 0x0, 0x66,
+    0x0, 0x17, 0x70, 0x0, 0x0, 0x0, 0x21, 0x0,
+    0x0, 0x0,
+
+    /* U+6A19 "標" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x3, 0x65, 0x75, 0x75, 0xa2, 0x0, 0xa,
+    0x0, 0x0, 0x90, 0x90, 0x0, 0x5, 0x5c, 0x86,
+    0xa5, 0xb5, 0xb5, 0xa0, 0x0, 0x2b, 0x0, 0xa0,
+    0x90, 0x92, 0x80, 0x0, 0x7d, 0x60, 0xc5, 0xb5,
+    0xb6, 0x80, 0x0, 0xaa, 0x94, 0x70, 0x0, 0x2,
+    0x20, 0x3, 0x5a, 0x10, 0x55, 0x55, 0x58, 0x20,
+    0x6, 0xa, 0x4, 0x55, 0x55, 0x55, 0x85, 0x12,
+    0xa, 0x1, 0x23, 0xb, 0x10, 0x0, 0x0, 0xb,
+    0x0, 0xb5, 0xb, 0x38, 0x0, 0x0, 0xb, 0x8,
+    0x20, 0xb, 0x4, 0xb0, 0x0, 0xb, 0x40, 0x5,
+    0xb8, 0x0, 0x40, 0x0, 0x1, 0x0, 0x0, 0x10,
+    0x0, 0x0,
+
+    /* U+6A21 "模" */
+    0x0, 0x4, 0x0, 0x3, 0x0, 0x40, 0x0, 0x0,
+    0xd, 0x0, 0xb, 0x20, 0xd0, 0x10, 0x0, 0xb,
+    0x4, 0x5c, 0x55, 0xc5, 0xa1, 0x4, 0x4c, 0x85,
+    0xa, 0x0, 0xa0, 0x0, 0x1, 0x3c, 0x10, 0x95,
+    0x55, 0x5b, 0x10, 0x0, 0x6d, 0x20, 0xb0, 0x0,
+    0xb, 0x0, 0x0, 0xab, 0xa4, 0xb5, 0x55, 0x5c,
+    0x0, 0x1, 0x7b, 0x16, 0xb5, 0x55, 0x5c, 0x0,
+    0x6, 0xb, 0x0, 0x60, 0x93, 0x5, 0x0, 0x12,
+    0xb, 0x16, 0x55, 0xc7, 0x55, 0xb2, 0x0, 0xb,
+    0x0, 0x1, 0xb4, 0x20, 0x0, 0x0, 0xc, 0x0,
+    0xa, 0x30, 0xa5, 0x0, 0x0, 0xc, 0x2, 0x83,
+    0x0, 0xa, 0xd3, 0x0, 0x2, 0x22, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6A23 "樣" */
+    0x0, 0x4, 0x0, 0x3, 0x0, 0x32, 0x0, 0x0,
+    0xc, 0x0, 0x5, 0x80, 0x94, 0x0, 0x0, 0xb,
+    0x2, 0x55, 0x7a, 0x57, 0x50, 0x5, 0x5c, 0x76,
+    0x45, 0x5c, 0x59, 0x20, 0x0, 0x2c, 0x0, 0x0,
+    0xa, 0x0, 0x10, 0x0, 0x6d, 0x53, 0x55, 0x69,
+    0x55, 0x92, 0x0, 0xab, 0x85, 0x0, 0x3c, 0x0,
+    0x0, 0x2, 0x7b, 0x13, 0x55, 0x5a, 0x0, 0x40,
+    0x7, 0xb, 0x0, 0x2, 0xc, 0x19, 0x60, 0x12,
+    0xb, 0x5, 0x5e, 0x5b, 0x91, 0x0, 0x0, 0xb,
+    0x0, 0x79, 0xb, 0x38, 0x0, 0x0, 0xc, 0x4,
+    0x90, 0xb, 0x7, 0xa2, 0x0, 0xc, 0x25, 0x5,
+    0xbc, 0x0, 0x51, 0x0, 0x2, 0x0, 0x0, 0x20,
+    0x0, 0x0,
+
+    /* U+6A2A "横" */
+    0x0, 0x13, 0x0, 0x2, 0x1, 0x20, 0x0, 0x0,
+    0x1b, 0x0, 0xa, 0x2, 0xb0, 0x0, 0x0, 0x19,
+    0x3, 0x5b, 0x56, 0xb7, 0x50, 0x5, 0x6b, 0xa4,
+    0x9, 0x2, 0x90, 0x0, 0x0, 0x59, 0x16, 0x58,
+    0x86, 0x85, 0x91, 0x0, 0x8b, 0x0, 0x20, 0xa0,
+    0x3, 0x0, 0x0, 0xba, 0xb2, 0xc4, 0xb5, 0x5c,
+    0x20, 0x2, 0x89, 0x32, 0xa0, 0xa0, 0xa, 0x0,
+    0x7, 0x29, 0x0, 0xc5, 0xb5, 0x5c, 0x0, 0x5,
+    0x19, 0x0, 0xa0, 0xa0, 0xa, 0x0, 0x0, 0x19,
+    0x0, 0xb8, 0x56, 0x57, 0x0, 0x0, 0x1a, 0x0,
+    0x5b, 0x10, 0x76, 0x0, 0x0, 0x2a, 0x6, 0x60,
+    0x0, 0x7, 0x80, 0x0, 0x13, 0x20, 0x0, 0x0,
+    0x0, 0x30,
+
+    /* U+6A39 "樹" */
+    0x0, 0x31, 0x0, 0x21, 0x0, 0x3, 0x0, 0x0,
+    0x92, 0x0, 0x67, 0x0, 0xb, 0x0, 0x0, 0x92,
+    0x25, 0x99, 0x83, 0xa, 0x0, 0x25, 0xb8, 0x70,
+    0x66, 0x0, 0xa, 0x40, 0x0, 0xb2, 0x5, 0x77,
+    0x84, 0x5c, 0x50, 0x0, 0xe4, 0x6, 0x55, 0x80,
+    0xa, 0x0, 0x3, 0xf8, 0x7a, 0x0, 0xa6, 0x2a,
+    0x0, 0x8, 0xa2, 0x4b, 0x55, 0xa1, 0xba, 0x0,
+    0x16, 0x92, 0x6, 0x0, 0x90, 0x2a, 0x0, 0x40,
+    0x92, 0x7, 0x13, 0x70, 0xa, 0x0, 0x0, 0x92,
+    0x3, 0x47, 0x32, 0xa, 0x0, 0x0, 0x92, 0x6a,
+    0x85, 0x10, 0xb, 0x0, 0x0, 0x92, 0x20, 0x0,
+    0x2, 0xbb, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6A4B "橋" */
+    0x0, 0x30, 0x0, 0x0, 0x0, 0x42, 0x0, 0x0,
+    0x94, 0x3, 0x57, 0xaa, 0x85, 0x0, 0x0, 0x92,
+    0x0, 0x0, 0xc0, 0x1, 0x0, 0x25, 0xb8, 0x74,
+    0x5b, 0x75, 0x86, 0x40, 0x0, 0xb2, 0x0, 0x76,
+    0x0, 0x87, 0x10, 0x0, 0xe5, 0x17, 0x4b, 0x55,
+    0xc5, 0xa1, 0x3, 0xf7, 0x80, 0xb, 0x55, 0xb0,
+    0x0, 0x8, 0xa2, 0x33, 0x13, 0x0, 0x41, 0x40,
+    0x17, 0x92, 0xc, 0x45, 0x44, 0x55, 0xb0, 0x50,
+    0x92, 0xb, 0x9, 0x55, 0xc1, 0x90, 0x0, 0x92,
+    0xb, 0x9, 0x55, 0xa1, 0x90, 0x0, 0x92, 0xb,
+    0x4, 0x0, 0x31, 0x90, 0x0, 0x92, 0xb, 0x0,
+    0x0, 0x6c, 0x60, 0x0, 0x10, 0x1, 0x0, 0x0,
+    0x1, 0x0,
+
+    /* U+6A5F "機" */
+    0x0, 0x41, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0xa2, 0x0, 0xb0, 0xb2, 0x68, 0x0, 0x0, 0xa1,
+    0x4, 0x36, 0xb0, 0x83, 0x20, 0x25, 0xc9, 0x6b,
+    0x78, 0xb9, 0x8b, 0x40, 0x0, 0xc1, 0x1, 0x71,
+    0xb1, 0x46, 0x0, 0x0, 0xf3, 0x5, 0x29, 0xb2,
+    0x65, 0x60, 0x4, 0xf8, 0x6a, 0x57, 0xb7, 0x92,
+    0x80, 0x9, 0xb1, 0x40, 0xb0, 0x91, 0x56, 0x20,
+    0x26, 0xa1, 0x25, 0xc5, 0xa7, 0x57, 0x80, 0x40,
+    0xa1, 0x0, 0xc0, 0x47, 0x2c, 0x0, 0x0, 0xa1,
+    0x5, 0x5a, 0xb, 0xc2, 0x30, 0x0, 0xa1, 0x18,
+    0x1, 0x78, 0xc4, 0x70, 0x0, 0xa3, 0x50, 0x5,
+    0x10, 0x18, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6B21 "次" */
+    0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x2,
+    0x40, 0x0, 0xe, 0x30, 0x0, 0x0, 0x0, 0xa6,
+    0x10, 0x3a, 0x0, 0x0, 0x0, 0x0, 0x38, 0x40,
+    0x88, 0x55, 0x57, 0x70, 0x0, 0x0, 0x50, 0xb0,
+    0x40, 0xa, 0x60, 0x0, 0x5, 0x17, 0x20, 0xe2,
+    0x24, 0x0, 0x0, 0x7, 0x25, 0x1, 0xb3, 0x0,
+    0x0, 0x0, 0x44, 0x10, 0x3, 0x85, 0x0, 0x0,
+    0x6, 0xd0, 0x0, 0x7, 0x47, 0x0, 0x0, 0x0,
+    0xb0, 0x0, 0xb, 0x4, 0x50, 0x0, 0x0, 0xe0,
+    0x0, 0x74, 0x0, 0xb1, 0x0, 0x0, 0xf0, 0x5,
+    0x50, 0x0, 0x3d, 0x30, 0x0, 0x21, 0x62, 0x0,
+    0x0, 0x4, 0xb2, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6B32 "欲" */
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x55, 0x15, 0x0, 0x78, 0x0, 0x0, 0x0, 0xa1,
+    0x7, 0x90, 0xb1, 0x0, 0x0, 0x7, 0x13, 0x50,
+    0x40, 0xc5, 0x55, 0xa0, 0x10, 0xa, 0x70, 0x6,
+    0x30, 0x5, 0x60, 0x0, 0x38, 0x3c, 0x46, 0xe,
+    0x4, 0x0, 0x1, 0x90, 0x2, 0x80, 0x1c, 0x0,
+    0x0, 0x6, 0x30, 0x4, 0x0, 0x39, 0x30, 0x0,
+    0x10, 0xc5, 0x5d, 0x0, 0x65, 0x60, 0x0, 0x0,
+    0xa0, 0xb, 0x0, 0xb0, 0x90, 0x0, 0x0, 0xa0,
+    0xb, 0x3, 0x80, 0x74, 0x0, 0x0, 0xc5, 0x5c,
+    0x19, 0x0, 0xd, 0x30, 0x0, 0x60, 0x4, 0x60,
+    0x0, 0x4, 0xc2, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6B4C "歌" */
+    0x0, 0x0, 0x0, 0x0, 0x21, 0x0, 0x0, 0x16,
+    0x55, 0x56, 0xa3, 0x79, 0x0, 0x0, 0x1, 0x0,
+    0x18, 0x30, 0xb1, 0x0, 0x0, 0x4, 0xa5, 0xa8,
+    0x31, 0xc5, 0x56, 0x70, 0x4, 0xa5, 0xa8, 0x36,
+    0x14, 0x7, 0x40, 0x3, 0x40, 0x47, 0x43, 0xe,
+    0x2, 0x0, 0x26, 0x55, 0x58, 0xa2, 0xf, 0x0,
+    0x0, 0x2, 0x0, 0x3a, 0x10, 0x2a, 0x40, 0x0,
+    0xb, 0x65, 0xba, 0x10, 0x67, 0x70, 0x0, 0xb,
+    0x10, 0xaa, 0x10, 0x91, 0x80, 0x0, 0xb, 0x65,
+    0x7a, 0x11, 0x90, 0x57, 0x0, 0x1, 0x0, 0x3b,
+    0x18, 0x10, 0xd, 0x40, 0x0, 0x0, 0x4b, 0x62,
+    0x0, 0x3, 0x90, 0x0, 0x0, 0x2, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6B50 "歐" */
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x9,
+    0x55, 0x55, 0xa0, 0xc2, 0x0, 0x0, 0xa, 0x3,
+    0x12, 0x30, 0xb0, 0x0, 0x0, 0xa, 0xa, 0x48,
+    0x65, 0x95, 0x57, 0x80, 0xa, 0x9, 0x5, 0x48,
+    0x5, 0x8, 0x20, 0xa, 0xa, 0x58, 0x53, 0xe,
+    0x12, 0x0, 0xa, 0x1, 0x0, 0x0, 0xd, 0x10,
+    0x0, 0xa, 0x87, 0x9a, 0x96, 0xb, 0x40, 0x0,
+    0xa, 0x83, 0x79, 0x63, 0x39, 0x70, 0x0, 0xa,
+    0x87, 0x7a, 0x93, 0x75, 0x80, 0x0, 0xa, 0x61,
+    0x16, 0x21, 0xb0, 0x49, 0x0, 0xb, 0x0, 0x4,
+    0x18, 0x30, 0xc, 0x70, 0x8, 0x55, 0x55, 0x93,
+    0x0, 0x1, 0xb2, 0x0, 0x0, 0x3, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6B61 "歡" */
+    0x0, 0x10, 0x2, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x48, 0xc, 0x31, 0x79, 0x0, 0x0, 0x6, 0x89,
+    0x5c, 0x52, 0x92, 0x0, 0x0, 0x6, 0x58, 0x56,
+    0x71, 0xc5, 0x57, 0x80, 0xb, 0xb, 0x91, 0xa2,
+    0x62, 0x9, 0x30, 0x8, 0x86, 0x85, 0x66, 0xe,
+    0x12, 0x0, 0x0, 0xc1, 0x80, 0x31, 0x1d, 0x0,
+    0x0, 0x7, 0xa5, 0xb5, 0x62, 0x2b, 0x20, 0x0,
+    0x27, 0xa4, 0xc4, 0x70, 0x56, 0x60, 0x0, 0x2,
+    0xa5, 0xc5, 0x70, 0x92, 0x90, 0x0, 0x2, 0x70,
+    0xb0, 0x10, 0xa0, 0x57, 0x0, 0x3, 0xa5, 0x95,
+    0x99, 0x20, 0xc, 0x60, 0x3, 0x60, 0x0, 0x62,
+    0x0, 0x2, 0xb2, 0x0, 0x0, 0x2, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6B62 "止" */
+    0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0x0, 0xb, 0x30, 0xc,
+    0x0, 0x3, 0x0, 0x0, 0xc, 0x0, 0xd, 0x55,
+    0x59, 0x20, 0x0, 0xc, 0x0, 0xc, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0x0, 0xc, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0x15, 0x5d, 0x55,
+    0x5d, 0x55, 0x5a, 0xb0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+6B63 "正" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x55, 0x55, 0x55, 0x55, 0x5b, 0x90, 0x0, 0x10,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0x30, 0xc, 0x0,
+    0x1, 0x0, 0x0, 0xb, 0x0, 0xd, 0x55, 0x7a,
+    0x0, 0x0, 0xb, 0x0, 0xc, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xb, 0x0,
+    0xc, 0x0, 0x6, 0x50, 0x17, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x50,
+
+    /* U+6B64 "此" */
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0xa4, 0x0, 0xc2, 0x0, 0x0, 0x0, 0x0,
+    0xa2, 0x0, 0xb0, 0x0, 0x0, 0x0, 0x10, 0x92,
+    0x0, 0xb0, 0x1, 0x20, 0x0, 0xd0, 0x92, 0x0,
+    0xb0, 0x1c, 0x90, 0x0, 0xb0, 0x96, 0x86, 0xb3,
+    0x93, 0x0, 0x0, 0xb0, 0x92, 0x0, 0xb4, 0x0,
+    0x0, 0x0, 0xb0, 0x92, 0x0, 0xb0, 0x0, 0x0,
+    0x0, 0xb0, 0x92, 0x0, 0xb0, 0x0, 0x0, 0x0,
+    0xb0, 0x92, 0x2, 0xb0, 0x0, 0x30, 0x0, 0xb0,
+    0xa9, 0x62, 0xb0, 0x0, 0x60, 0x16, 0xea, 0x50,
+    0x0, 0xc0, 0x0, 0xc2, 0x1a, 0x30, 0x0, 0x0,
+    0x5a, 0xaa, 0x91,
+
+    /* U+6B65 "步" */
+    0x0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0xd, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0x20, 0xd, 0x55, 0x6b, 0x0, 0x0, 0xc, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0x0, 0xc, 0x0, 0xc,
+    0x0, 0x0, 0x20, 0x7, 0x5b, 0x55, 0x5b, 0x55,
+    0x57, 0xc1, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xa0, 0xc, 0x0, 0xa, 0x30,
+    0x0, 0xb, 0x30, 0xc, 0x0, 0x9a, 0x0, 0x0,
+    0x75, 0x0, 0xc, 0xa, 0x80, 0x0, 0x4, 0x50,
+    0x0, 0x8, 0xb5, 0x0, 0x0, 0x2, 0x0, 0x2,
+    0x89, 0x10, 0x0, 0x0, 0x0, 0x25, 0x66, 0x10,
+    0x0, 0x0, 0x0, 0x3, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6B69 "歩" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0x20, 0x0, 0x0, 0x0, 0x2b, 0x0,
+    0xc0, 0x2, 0x40, 0x0, 0x2, 0xa0, 0xc, 0x55,
+    0x54, 0x0, 0x0, 0x1a, 0x0, 0xc0, 0x0, 0x4,
+    0x5, 0x65, 0x85, 0x5b, 0x55, 0x56, 0x92, 0x0,
+    0x1, 0x0, 0xe0, 0x44, 0x0, 0x0, 0x2, 0xe2,
+    0xc, 0x0, 0x5b, 0x30, 0x0, 0xb3, 0x0, 0xc0,
+    0xa, 0x8d, 0x0, 0x82, 0x0, 0xd, 0xb, 0xb2,
+    0x20, 0x20, 0x0, 0x0, 0x7c, 0x60, 0x0, 0x0,
+    0x0, 0x3, 0x98, 0x10, 0x0, 0x0, 0x1, 0x57,
+    0x50, 0x0, 0x0, 0x0, 0x2, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+6B6F "歯" */
+    0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x50, 0xd, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0x80, 0xd, 0x55, 0xb1, 0x0, 0x0, 0x4, 0x80,
+    0xc, 0x0, 0x0, 0x0, 0x4, 0x57, 0xa5, 0x5d,
+    0x55, 0x5b, 0x80, 0x1, 0x0, 0x10, 0x8, 0x2,
+    0x0, 0x0, 0x0, 0xb0, 0x57, 0xb, 0xb, 0x27,
+    0x10, 0x0, 0xb0, 0x7, 0xb, 0x43, 0x2c, 0x0,
+    0x0, 0xb3, 0x65, 0xae, 0x76, 0x7c, 0x0, 0x0,
+    0xb0, 0x5, 0x8b, 0x87, 0xc, 0x0, 0x0, 0xb0,
+    0x47, 0xb, 0x9, 0x9c, 0x0, 0x0, 0xb4, 0x40,
+    0xa, 0x0, 0x2c, 0x0, 0x2, 0xa5, 0x55, 0x55,
+    0x55, 0x5c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6B72 "歲" */
+    0x0, 0x0, 0x0, 0x21, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x40, 0x66, 0x0, 0x50, 0x0, 0x0, 0x4,
+    0x60, 0x68, 0x55, 0x50, 0x10, 0x6, 0x57, 0x85,
+    0x88, 0x55, 0x57, 0xa0, 0x0, 0x0, 0x0, 0x6,
+    0x63, 0x90, 0x0, 0x0, 0xb5, 0x55, 0x58, 0x95,
+    0x79, 0x50, 0x0, 0xc0, 0x0, 0x21, 0x90, 0x24,
+    0x0, 0x0, 0xc3, 0x6a, 0x72, 0xb0, 0x89, 0x0,
+    0x0, 0xc2, 0x5a, 0x23, 0xa3, 0xc0, 0x0, 0x2,
+    0xa7, 0x2a, 0xb6, 0x6e, 0x30, 0x0, 0x4, 0x64,
+    0xf, 0x60, 0xad, 0x20, 0x40, 0x8, 0x0, 0x95,
+    0x1a, 0x42, 0xd4, 0x80, 0x15, 0x47, 0x24, 0x71,
+    0x0, 0x2c, 0xf0, 0x10, 0x10, 0x20, 0x0, 0x0,
+    0x0, 0x10,
+
+    /* U+6B73 "歳" */
+    0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x50, 0x58, 0x0, 0x60, 0x0, 0x0, 0x4,
+    0x70, 0x49, 0x55, 0x51, 0x10, 0x6, 0x57, 0x85,
+    0x78, 0x55, 0x58, 0xa0, 0x0, 0x0, 0x0, 0x5,
+    0x83, 0xa0, 0x0, 0x0, 0xa5, 0x55, 0x57, 0xa5,
+    0x78, 0x60, 0x0, 0xb0, 0x0, 0x13, 0xa0, 0x14,
+    0x0, 0x0, 0xb6, 0x5b, 0x54, 0xb0, 0x7b, 0x0,
+    0x0, 0xa2, 0x3a, 0x40, 0x94, 0xd1, 0x0, 0x1,
+    0x98, 0x3a, 0x57, 0x4f, 0x30, 0x0, 0x4, 0x84,
+    0xa, 0x4, 0x9d, 0x20, 0x40, 0x7, 0x12, 0xa9,
+    0x19, 0x43, 0xd3, 0x70, 0x6, 0x0, 0x4, 0x60,
+    0x0, 0x2c, 0xe0, 0x10, 0x0, 0x20, 0x0, 0x0,
+    0x0, 0x20,
+
+    /* U+6B77 "歷" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x95, 0x55, 0x55, 0x55, 0x5b, 0x50, 0x1, 0xa0,
+    0x15, 0xc2, 0x1, 0x78, 0x0, 0x1, 0xa3, 0x5a,
+    0x0, 0x4c, 0x20, 0x0, 0x1, 0xa5, 0x7b, 0xa3,
+    0x6c, 0x58, 0x50, 0x1, 0xa0, 0xab, 0x20, 0x5e,
+    0x60, 0x0, 0x2, 0x92, 0x99, 0xa1, 0x8a, 0x2a,
+    0x0, 0x3, 0x87, 0x29, 0x6, 0xa, 0x5, 0x70,
+    0x4, 0x70, 0x15, 0x12, 0x74, 0x0, 0x0, 0x6,
+    0x30, 0x51, 0x2, 0x80, 0x50, 0x0, 0x8, 0x0,
+    0xa0, 0x2, 0xa5, 0x52, 0x0, 0x7, 0x0, 0xa0,
+    0x2, 0x80, 0x0, 0x0, 0x42, 0x55, 0xc5, 0x56,
+    0xa5, 0x59, 0xb0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6B7B "死" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0x55, 0x55, 0x55, 0x55, 0x5a, 0xc0, 0x1, 0x3,
+    0xa0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x7, 0x60,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0xb, 0x10, 0x40,
+    0xc0, 0x4, 0x60, 0x0, 0x1c, 0x56, 0xe1, 0xc0,
+    0x2c, 0x40, 0x0, 0x85, 0x5, 0x80, 0xc3, 0x80,
+    0x0, 0x1, 0x88, 0x3a, 0x20, 0xc3, 0x0, 0x0,
+    0x7, 0x3, 0x6c, 0x0, 0xc0, 0x0, 0x0, 0x10,
+    0x0, 0x94, 0x0, 0xc0, 0x0, 0x40, 0x0, 0x4,
+    0x80, 0x0, 0xc0, 0x0, 0x70, 0x0, 0x38, 0x0,
+    0x0, 0xc2, 0x11, 0xd2, 0x4, 0x50, 0x0, 0x0,
+    0x59, 0x99, 0x70, 0x11, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6B8A "殊" */
+    0x0, 0x0, 0x0, 0x0, 0x12, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0x6, 0x2c, 0x0, 0x0, 0x5, 0x99,
+    0x55, 0x3a, 0x2a, 0x1, 0x0, 0x0, 0x84, 0x0,
+    0x67, 0x6b, 0x59, 0x40, 0x0, 0xb6, 0x75, 0x80,
+    0x2a, 0x0, 0x0, 0x0, 0xb0, 0x77, 0x20, 0x2a,
+    0x0, 0x40, 0x3, 0x90, 0xa4, 0x55, 0xbc, 0x65,
+    0x92, 0x7, 0x57, 0xc0, 0x2, 0xda, 0x60, 0x0,
+    0x13, 0x5, 0x90, 0xa, 0x4a, 0x80, 0x0, 0x0,
+    0x8, 0x20, 0x56, 0x2a, 0x38, 0x0, 0x0, 0x19,
+    0x3, 0x80, 0x2a, 0xa, 0x80, 0x0, 0x71, 0x26,
+    0x0, 0x2a, 0x1, 0xb4, 0x5, 0x10, 0x20, 0x0,
+    0x2a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6B8B "残" */
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0x0, 0xc2, 0x60, 0x0, 0x5, 0x99,
+    0x55, 0x10, 0xc0, 0x69, 0x0, 0x0, 0x83, 0x0,
+    0x0, 0xc0, 0x6, 0x0, 0x0, 0xa0, 0x4, 0x35,
+    0xd5, 0x57, 0x40, 0x0, 0xb5, 0x5d, 0x10, 0xb0,
+    0x0, 0x0, 0x5, 0x80, 0x38, 0x0, 0xb6, 0x57,
+    0x60, 0x8, 0x49, 0x64, 0x54, 0x94, 0x7, 0x10,
+    0x21, 0x4, 0xa0, 0x0, 0x57, 0x4b, 0x0, 0x0,
+    0x2, 0x80, 0x0, 0x1d, 0xb0, 0x0, 0x0, 0x9,
+    0x0, 0x0, 0x4e, 0x50, 0x12, 0x0, 0x63, 0x0,
+    0x18, 0x60, 0xc5, 0x60, 0x4, 0x30, 0x4, 0x50,
+    0x0, 0x1b, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x30,
+
+    /* U+6BB5 "段" */
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x43, 0x8b, 0x27, 0x55, 0x91, 0x0, 0x0, 0xc2,
+    0x0, 0xc, 0x0, 0xb0, 0x0, 0x0, 0xb0, 0x0,
+    0xc, 0x0, 0xb0, 0x0, 0x0, 0xc5, 0x68, 0xa,
+    0x0, 0xc0, 0x10, 0x0, 0xb0, 0x0, 0x72, 0x0,
+    0x59, 0x80, 0x0, 0xc5, 0x68, 0x55, 0x44, 0x78,
+    0x0, 0x0, 0xb0, 0x0, 0x6, 0x0, 0xa3, 0x0,
+    0x0, 0xb0, 0x2, 0x24, 0x42, 0xb0, 0x0, 0x14,
+    0xd9, 0x73, 0x0, 0xbb, 0x30, 0x0, 0x19, 0xc0,
+    0x0, 0x0, 0xbd, 0x10, 0x0, 0x0, 0xb0, 0x0,
+    0x3a, 0x33, 0xd6, 0x0, 0x0, 0xb0, 0x35, 0x40,
+    0x0, 0x1a, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6BCD "母" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0x65, 0x55, 0x55, 0xb5, 0x0, 0x0, 0xc,
+    0x11, 0x50, 0x0, 0xa2, 0x0, 0x0, 0xd, 0x0,
+    0x87, 0x0, 0xb1, 0x0, 0x0, 0xd, 0x0, 0x17,
+    0x0, 0xc0, 0x0, 0x15, 0x5d, 0x55, 0x55, 0x55,
+    0xe7, 0xc0, 0x0, 0x2a, 0x2, 0x30, 0x0, 0xd0,
+    0x0, 0x0, 0x48, 0x0, 0xb5, 0x0, 0xd0, 0x0,
+    0x0, 0x67, 0x0, 0x49, 0x1, 0xc0, 0x0, 0x0,
+    0x85, 0x0, 0x0, 0x2, 0xb3, 0x60, 0x0, 0x86,
+    0x55, 0x55, 0x57, 0xb5, 0x50, 0x0, 0x0, 0x0,
+    0x2, 0x7, 0x70, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xbf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11,
+    0x0, 0x0,
+
+    /* U+6BCE "毎" */
+    0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xc0, 0x0, 0x0, 0x6, 0x0, 0x0, 0xc,
+    0x55, 0x55, 0x55, 0x56, 0x20, 0x0, 0x84, 0x0,
+    0x0, 0x0, 0x30, 0x0, 0x4, 0x26, 0x85, 0x5c,
+    0x55, 0xd3, 0x0, 0x0, 0x8, 0x30, 0x1a, 0x0,
+    0xc0, 0x0, 0x0, 0xa, 0x10, 0x38, 0x0, 0xc0,
+    0x50, 0x16, 0x5d, 0x55, 0x89, 0x55, 0xd6, 0x71,
+    0x0, 0xc, 0x0, 0x75, 0x0, 0xc0, 0x0, 0x0,
+    0xb, 0x0, 0x83, 0x0, 0xc0, 0x0, 0x0, 0x5b,
+    0x55, 0x96, 0x55, 0xd8, 0x80, 0x0, 0x1, 0x0,
+    0x0, 0x3, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x8d, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0x0, 0x0,
+
+    /* U+6BCF "每" */
+    0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xc0, 0x0, 0x0, 0x5, 0x0, 0x0, 0xc,
+    0x65, 0x55, 0x55, 0x58, 0x30, 0x0, 0x85, 0x0,
+    0x0, 0x0, 0x30, 0x0, 0x5, 0x56, 0x95, 0x75,
+    0x55, 0xd3, 0x0, 0x12, 0x7, 0x40, 0x87, 0x0,
+    0xc0, 0x0, 0x0, 0x9, 0x30, 0x8, 0x0, 0xc0,
+    0x60, 0x16, 0x5c, 0x66, 0x55, 0x55, 0xd5, 0x71,
+    0x0, 0xc, 0x0, 0xa4, 0x0, 0xd0, 0x0, 0x0,
+    0xc, 0x0, 0x2a, 0x0, 0xc0, 0x0, 0x0, 0x3c,
+    0x55, 0x55, 0x55, 0xd8, 0xa0, 0x0, 0x1, 0x0,
+    0x0, 0x3, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x8d, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0x0, 0x0,
+
+    /* U+6BD4 "比" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb2, 0x0,
+    0xc, 0x30, 0x0, 0x0, 0xc0, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0xc0, 0x0, 0xc, 0x0, 0xc, 0x30,
+    0xc0, 0x0, 0xc, 0x0, 0xb7, 0x0, 0xc5, 0x5a,
+    0x3c, 0x9, 0x30, 0x0, 0xc0, 0x0, 0xc, 0x60,
+    0x0, 0x0, 0xc0, 0x0, 0xc, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc0, 0x0,
+    0xc, 0x0, 0x0, 0x40, 0xc0, 0x15, 0x2c, 0x0,
+    0x0, 0x60, 0xdb, 0x70, 0xc, 0x31, 0x14, 0xc0,
+    0x62, 0x0, 0x4, 0xaa, 0xaa, 0x60,
+
+    /* U+6BDB "毛" */
+    0x0, 0x0, 0x0, 0x1, 0x5c, 0x30, 0x0, 0x0,
+    0x14, 0x57, 0xb9, 0x74, 0x20, 0x0, 0x0, 0x20,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0x50, 0x0, 0x0, 0x24, 0x55, 0xd5,
+    0x55, 0x62, 0x0, 0x0, 0x31, 0x0, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x1, 0x29,
+    0x80, 0x4, 0x55, 0x55, 0xd5, 0x54, 0x21, 0x0,
+    0x1, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x50, 0x0, 0x0,
+    0x0, 0xd0, 0x0, 0x0, 0xa0, 0x0, 0x0, 0x0,
+    0xbc, 0xbb, 0xbc, 0xc1,
+
+    /* U+6C0F "氏" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0x8e, 0x80, 0x0, 0xa5, 0x56, 0xd5, 0x31,
+    0x0, 0x0, 0xb1, 0x0, 0xb1, 0x0, 0x0, 0x0,
+    0xb1, 0x0, 0xa2, 0x0, 0x0, 0x0, 0xb5, 0x55,
+    0xb7, 0x55, 0x6e, 0x30, 0xb1, 0x0, 0x56, 0x0,
+    0x0, 0x0, 0xb1, 0x0, 0x2b, 0x0, 0x0, 0x0,
+    0xb1, 0x0, 0xc, 0x30, 0x0, 0x0, 0xb1, 0x0,
+    0x34, 0xd0, 0x0, 0x30, 0xb1, 0x66, 0x0, 0x8b,
+    0x10, 0x70, 0xcd, 0x40, 0x0, 0x7, 0xe9, 0x70,
+    0x62, 0x0, 0x0, 0x0, 0x2a, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+6C11 "民" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x95,
+    0x55, 0x55, 0x55, 0xc1, 0x0, 0xc, 0x0, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0xc, 0x55, 0x5a, 0x55, 0x5d, 0x0,
+    0x0, 0xc0, 0x0, 0xa1, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x9, 0x20, 0x0, 0x53, 0x0, 0xc5, 0x55,
+    0x99, 0x55, 0x55, 0x40, 0xc, 0x0, 0x1, 0xb0,
+    0x0, 0x0, 0x0, 0xc0, 0x0, 0xa, 0x40, 0x0,
+    0x0, 0xc, 0x1, 0x50, 0x2d, 0x20, 0x5, 0x0,
+    0xd8, 0x80, 0x0, 0x4d, 0x41, 0x80, 0xc, 0x50,
+    0x0, 0x0, 0x2b, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x30,
+
+    /* U+6C14 "气" */
+    0x0, 0x2, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0x55, 0x55, 0x55, 0x7d, 0x10, 0x0, 0x65, 0x0,
+    0x0, 0x0, 0x10, 0x0, 0x0, 0x90, 0x65, 0x55,
+    0x57, 0x90, 0x0, 0x7, 0x10, 0x0, 0x0, 0x3,
+    0x0, 0x0, 0x21, 0x36, 0x55, 0x55, 0x5c, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0x70, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc2, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3d, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x30,
+
+    /* U+6C17 "気" */
+    0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xc0, 0x0, 0x0, 0x2, 0x0, 0x0, 0xa,
+    0x75, 0x55, 0x55, 0x59, 0x40, 0x0, 0x28, 0x55,
+    0x55, 0x55, 0xa2, 0x0, 0x0, 0x90, 0x10, 0x0,
+    0x0, 0x10, 0x0, 0x5, 0x16, 0x55, 0x55, 0x55,
+    0xe0, 0x0, 0x1, 0x0, 0x0, 0xa, 0x60, 0xc0,
+    0x0, 0x0, 0x4, 0x20, 0x3c, 0x0, 0xb0, 0x0,
+    0x0, 0x0, 0x49, 0xc1, 0x0, 0xb0, 0x0, 0x0,
+    0x0, 0xa, 0xc7, 0x0, 0xb0, 0x0, 0x0, 0x0,
+    0x93, 0xc, 0x60, 0x83, 0x30, 0x0, 0x27, 0x10,
+    0x2, 0x60, 0x2c, 0x51, 0x1, 0x30, 0x0, 0x0,
+    0x0, 0x6, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x12,
+
+    /* U+6C34 "水" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb4, 0x0, 0x7a, 0x0, 0x5, 0x55, 0xa4, 0xb7,
+    0x5, 0x80, 0x0, 0x1, 0x0, 0xd1, 0xb7, 0x63,
+    0x0, 0x0, 0x0, 0x3, 0xa0, 0xb2, 0x80, 0x0,
+    0x0, 0x0, 0x9, 0x40, 0xb1, 0x83, 0x0, 0x0,
+    0x0, 0x1b, 0x0, 0xb1, 0x1c, 0x0, 0x0, 0x0,
+    0x83, 0x0, 0xb1, 0x6, 0xb0, 0x0, 0x3, 0x60,
+    0x0, 0xb1, 0x0, 0x9d, 0x40, 0x15, 0x0, 0x11,
+    0xc1, 0x0, 0x8, 0x60, 0x0, 0x0, 0x2b, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6C37 "氷" */
+    0x0, 0x0, 0x0, 0x52, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x20,
+    0x0, 0xa2, 0x0, 0x10, 0x0, 0x0, 0x6a, 0x10,
+    0xa3, 0x0, 0xd4, 0x0, 0x0, 0x6, 0x80, 0xa8,
+    0x9, 0x30, 0x0, 0x4, 0x55, 0x66, 0xa8, 0x72,
+    0x0, 0x0, 0x1, 0x0, 0x85, 0xa4, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0xc0, 0xa2, 0xa1, 0x0, 0x0,
+    0x0, 0x7, 0x50, 0xa2, 0x3c, 0x0, 0x0, 0x0,
+    0x1a, 0x0, 0xa2, 0x9, 0xb0, 0x0, 0x0, 0xa1,
+    0x0, 0xa2, 0x0, 0xbd, 0x50, 0x8, 0x10, 0x22,
+    0xc2, 0x0, 0x8, 0x20, 0x20, 0x0, 0x18, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6C38 "永" */
+    0x0, 0x0, 0x1, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8b, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55,
+    0x5a, 0x10, 0x1, 0x0, 0x0, 0x0, 0x10, 0xe,
+    0x0, 0x2e, 0x10, 0x0, 0x0, 0x12, 0xd, 0x40,
+    0xa2, 0x0, 0x3, 0x65, 0xa9, 0xc, 0x77, 0x20,
+    0x0, 0x0, 0x0, 0xc1, 0xc, 0x55, 0x0, 0x0,
+    0x0, 0x4, 0x80, 0xc, 0xb, 0x0, 0x0, 0x0,
+    0xb, 0x0, 0xc, 0x5, 0xb0, 0x0, 0x0, 0x73,
+    0x0, 0xc, 0x0, 0x9c, 0x20, 0x4, 0x40, 0x3,
+    0x4c, 0x0, 0x8, 0xc2, 0x2, 0x0, 0x2, 0xd7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6C42 "求" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd2, 0x29, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0xd0, 0x3, 0xc0, 0x0, 0x5, 0x55, 0x55,
+    0xe5, 0x55, 0x7d, 0x30, 0x1, 0x0, 0x0, 0xd3,
+    0x0, 0x0, 0x0, 0x0, 0x56, 0x0, 0xd5, 0x0,
+    0x65, 0x0, 0x0, 0xa, 0x90, 0xd7, 0x5, 0xb3,
+    0x0, 0x0, 0x1, 0x60, 0xd2, 0xa5, 0x0, 0x0,
+    0x0, 0x0, 0x36, 0xd0, 0x93, 0x0, 0x0, 0x0,
+    0x39, 0x40, 0xd0, 0x1d, 0x30, 0x0, 0x3c, 0xa0,
+    0x0, 0xd0, 0x3, 0xe8, 0x10, 0x6, 0x0, 0x32,
+    0xe0, 0x0, 0x2d, 0x90, 0x0, 0x0, 0x3c, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6C5A "汚" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x92, 0x6, 0x55, 0x65, 0x5a, 0x10, 0x0, 0x3a,
+    0x0, 0x4, 0x70, 0x0, 0x0, 0x0, 0x1, 0x20,
+    0x6, 0x50, 0x0, 0x0, 0x27, 0x0, 0x76, 0x5b,
+    0x75, 0x55, 0xb1, 0x7, 0x73, 0x20, 0xb, 0x0,
+    0x0, 0x0, 0x0, 0x46, 0x0, 0xc, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0x0, 0x4b, 0x55, 0x5c, 0x40,
+    0x0, 0x44, 0x0, 0x0, 0x0, 0xd, 0x0, 0x7,
+    0xe0, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0xd0,
+    0x0, 0x0, 0x0, 0x39, 0x0, 0x1, 0xd0, 0x0,
+    0x0, 0x30, 0x86, 0x0, 0x0, 0xa0, 0x0, 0x0,
+    0x3e, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x0, 0x0,
+
+    /* U+6C60 "池" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa2, 0x0, 0x0, 0xb2, 0x0, 0x0, 0x0, 0x49,
+    0x0, 0x0, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x31,
+    0xa0, 0xb0, 0x2, 0x0, 0x9, 0x10, 0x41, 0xa0,
+    0xb4, 0x4c, 0x30, 0x3, 0xb1, 0x44, 0xb4, 0xc0,
+    0xa, 0x0, 0x0, 0x26, 0x22, 0xa0, 0xb0, 0xb,
+    0x0, 0x0, 0x7, 0x1, 0xa0, 0xb0, 0xb, 0x0,
+    0x0, 0x35, 0x1, 0xa0, 0xb2, 0x4c, 0x0, 0x6,
+    0xe1, 0x1, 0xa0, 0xb0, 0x76, 0x20, 0x0, 0xd0,
+    0x1, 0xa0, 0x70, 0x0, 0x60, 0x0, 0xe0, 0x1,
+    0xb0, 0x0, 0x0, 0xb4, 0x0, 0xa0, 0x0, 0x8a,
+    0xaa, 0xaa, 0x91,
+
+    /* U+6C7A "決" */
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x75, 0x0, 0x1, 0xd0, 0x0, 0x0, 0x0, 0xd,
+    0x0, 0x1, 0xb0, 0x0, 0x0, 0x0, 0x1, 0x5,
+    0x76, 0xc5, 0x5c, 0x0, 0x7, 0x20, 0x40, 0x1,
+    0xa0, 0xc, 0x0, 0x1, 0xe0, 0x60, 0x1, 0xa0,
+    0xc, 0x0, 0x0, 0x43, 0x30, 0x2, 0x90, 0xc,
+    0x0, 0x0, 0x8, 0x26, 0x57, 0xb5, 0x5a, 0x93,
+    0x0, 0x27, 0x0, 0x7, 0x56, 0x0, 0x0, 0x5,
+    0xe3, 0x0, 0xc, 0x9, 0x10, 0x0, 0x0, 0xc0,
+    0x0, 0x57, 0x2, 0xc0, 0x0, 0x0, 0xe0, 0x1,
+    0xa0, 0x0, 0x7c, 0x20, 0x0, 0x70, 0x28, 0x0,
+    0x0, 0x7, 0xf4, 0x0, 0x0, 0x20, 0x0, 0x0,
+    0x0, 0x10,
+
+    /* U+6C88 "沈" */
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x1,
+    0x50, 0x0, 0x1, 0xd0, 0x0, 0x0, 0x0, 0x77,
+    0x0, 0x1, 0xb0, 0x0, 0x0, 0x0, 0x3, 0x7,
+    0x55, 0xc5, 0x57, 0x80, 0x14, 0x0, 0x4c, 0x1,
+    0xa0, 0x7, 0x20, 0x9, 0x54, 0x11, 0x2, 0xa0,
+    0x0, 0x0, 0x1, 0x25, 0x0, 0x4, 0xe5, 0x0,
+    0x0, 0x0, 0x6, 0x0, 0x7, 0xb4, 0x0, 0x0,
+    0x0, 0x62, 0x0, 0xc, 0x74, 0x0, 0x0, 0x14,
+    0xc0, 0x0, 0x39, 0x64, 0x0, 0x10, 0x7, 0xb0,
+    0x0, 0xa1, 0x64, 0x0, 0x50, 0x4, 0xa0, 0x7,
+    0x20, 0x65, 0x0, 0x61, 0x5, 0xa0, 0x62, 0x0,
+    0x3c, 0x99, 0xc4, 0x0, 0x23, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6C92 "沒" */
+    0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0x73, 0x0, 0x4b, 0x0, 0x0, 0x0, 0x0, 0x1d,
+    0x0, 0x96, 0x55, 0x5d, 0x0, 0x0, 0x2, 0x13,
+    0x80, 0x0, 0x1b, 0x0, 0x7, 0x0, 0x56, 0x10,
+    0x0, 0x38, 0x0, 0x4, 0xb0, 0x73, 0x0, 0x3,
+    0xd2, 0x0, 0x0, 0x55, 0x15, 0x65, 0x55, 0x6c,
+    0x0, 0x0, 0x8, 0x0, 0x60, 0x0, 0x86, 0x0,
+    0x0, 0x46, 0x0, 0x43, 0x1, 0xb0, 0x0, 0x6,
+    0xf1, 0x0, 0xa, 0x1b, 0x20, 0x0, 0x0, 0xc0,
+    0x0, 0x3, 0xf5, 0x0, 0x0, 0x0, 0xe0, 0x0,
+    0x3b, 0x6c, 0x60, 0x0, 0x0, 0x80, 0x38, 0x71,
+    0x1, 0x9f, 0xb2, 0x0, 0x2, 0x20, 0x0, 0x0,
+    0x1, 0x20,
+
+    /* U+6CB9 "油" */
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x5,
+    0x0, 0x0, 0xc, 0x10, 0x0, 0x0, 0x3c, 0x0,
+    0x0, 0xb0, 0x0, 0x0, 0x0, 0x42, 0x20, 0xb,
+    0x0, 0x40, 0x23, 0x0, 0x5b, 0x55, 0xc5, 0x5d,
+    0x10, 0xb5, 0x14, 0xb0, 0xb, 0x0, 0xb0, 0x2,
+    0x36, 0xb, 0x0, 0xb0, 0xb, 0x0, 0x0, 0x80,
+    0xb5, 0x5c, 0x55, 0xc0, 0x0, 0x54, 0xb, 0x0,
+    0xb0, 0xb, 0x1, 0x6d, 0x0, 0xb0, 0xb, 0x0,
+    0xb0, 0x3, 0xc0, 0xb, 0x0, 0xb0, 0xb, 0x0,
+    0x3b, 0x0, 0xb5, 0x5c, 0x55, 0xc0, 0x3, 0xb0,
+    0xa, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+6CBB "治" */
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x53, 0x0, 0x1, 0xe1, 0x0, 0x0, 0x0, 0xe,
+    0x10, 0x8, 0x40, 0x0, 0x0, 0x0, 0x4, 0x4,
+    0x27, 0x0, 0x53, 0x0, 0x4, 0x0, 0x32, 0x80,
+    0x0, 0xb, 0x50, 0x6, 0xa0, 0x6a, 0xc8, 0x65,
+    0x55, 0xd0, 0x0, 0x80, 0x61, 0x0, 0x0, 0x0,
+    0x20, 0x0, 0x6, 0x10, 0x95, 0x55, 0x5b, 0x0,
+    0x0, 0xa, 0x0, 0xb0, 0x0, 0xb, 0x0, 0x4,
+    0xb7, 0x0, 0xb0, 0x0, 0xb, 0x0, 0x0, 0x95,
+    0x0, 0xb0, 0x0, 0xb, 0x0, 0x0, 0xb4, 0x0,
+    0xc5, 0x55, 0x5b, 0x0, 0x0, 0x93, 0x0, 0xa0,
+    0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6CC1 "況" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x82, 0x1, 0xa5, 0x55, 0x5b, 0x20, 0x0, 0x1d,
+    0x0, 0xa0, 0x0, 0xb, 0x0, 0x0, 0x2, 0x3,
+    0xa0, 0x0, 0xb, 0x0, 0x6, 0x0, 0x40, 0xa0,
+    0x0, 0xb, 0x0, 0x4, 0xb0, 0x50, 0xc5, 0x55,
+    0x5c, 0x0, 0x0, 0x64, 0x21, 0x77, 0x3b, 0x5,
+    0x0, 0x0, 0x8, 0x0, 0x8, 0x1b, 0x0, 0x0,
+    0x0, 0x37, 0x0, 0xa, 0xb, 0x0, 0x0, 0x6,
+    0xe2, 0x0, 0xa, 0xb, 0x0, 0x0, 0x0, 0xd0,
+    0x0, 0x74, 0xb, 0x0, 0x50, 0x0, 0xf0, 0x3,
+    0x80, 0xb, 0x0, 0x80, 0x0, 0xa0, 0x46, 0x0,
+    0x7, 0xa9, 0xc2, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6CCA "泊" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x51,
+    0x0, 0x0, 0x5b, 0x0, 0x0, 0x1, 0xd0, 0x0,
+    0x8, 0x10, 0x0, 0x0, 0x5, 0x3, 0x95, 0x85,
+    0x55, 0xb0, 0x40, 0x2, 0x2b, 0x0, 0x0, 0x1a,
+    0x3, 0xb0, 0x50, 0xb0, 0x0, 0x1, 0xa0, 0x9,
+    0x16, 0xb, 0x0, 0x0, 0x1a, 0x0, 0x6, 0x10,
+    0xc5, 0x55, 0x56, 0xa0, 0x0, 0x90, 0xb, 0x0,
+    0x0, 0x1a, 0x4, 0xb6, 0x0, 0xb0, 0x0, 0x1,
+    0xa0, 0xa, 0x30, 0xb, 0x0, 0x0, 0x1a, 0x0,
+    0xb2, 0x0, 0xc5, 0x55, 0x56, 0xa0, 0x9, 0x30,
+    0xb, 0x0, 0x0, 0x1a, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+6CD5 "法" */
+    0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0,
+    0x91, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0, 0x3a,
+    0x0, 0x0, 0xb0, 0x0, 0x0, 0x0, 0x2, 0x34,
+    0x65, 0xc5, 0x5a, 0x30, 0x26, 0x0, 0x50, 0x0,
+    0xb0, 0x0, 0x0, 0x8, 0x71, 0x40, 0x0, 0xb0,
+    0x0, 0x0, 0x1, 0x46, 0x0, 0x0, 0xb0, 0x0,
+    0x60, 0x0, 0x7, 0x36, 0x56, 0xd5, 0x55, 0x51,
+    0x0, 0x63, 0x0, 0x7, 0x90, 0x0, 0x0, 0x18,
+    0xd0, 0x0, 0x2b, 0x0, 0x30, 0x0, 0x1, 0xb0,
+    0x0, 0x91, 0x0, 0x57, 0x0, 0x3, 0xa0, 0x19,
+    0x44, 0x55, 0x5c, 0x70, 0x2, 0x80, 0x2e, 0x95,
+    0x20, 0x1, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6CE2 "波" */
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x92, 0x0, 0x0, 0xb1, 0x0, 0x0, 0x0, 0x4a,
+    0x0, 0x0, 0xb0, 0x0, 0x0, 0x0, 0x1, 0x4a,
+    0x55, 0xc5, 0x5b, 0x70, 0x27, 0x0, 0x5b, 0x0,
+    0xb0, 0x17, 0x0, 0x8, 0x73, 0x2b, 0x0, 0xb0,
+    0x0, 0x0, 0x1, 0x27, 0xb, 0x56, 0xa5, 0x6a,
+    0x0, 0x0, 0x16, 0xb, 0x5, 0x0, 0x84, 0x0,
+    0x0, 0x81, 0xb, 0x6, 0x11, 0xa0, 0x0, 0x29,
+    0xb0, 0x28, 0x0, 0xaa, 0x10, 0x0, 0x3, 0x90,
+    0x72, 0x0, 0xab, 0x0, 0x0, 0x5, 0x91, 0x70,
+    0x9, 0x45, 0xc3, 0x0, 0x3, 0x76, 0x5, 0x71,
+    0x0, 0x3d, 0x80, 0x0, 0x0, 0x30, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6CE3 "泣" */
+    0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0x82, 0x0, 0x8, 0x50, 0x0, 0x0, 0x0, 0x3c,
+    0x0, 0x3, 0xb0, 0x0, 0x0, 0x0, 0x3, 0x5,
+    0x55, 0x65, 0x5d, 0x30, 0x16, 0x0, 0x31, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0x90, 0x52, 0x0, 0x0,
+    0xe1, 0x0, 0x0, 0x54, 0x20, 0x70, 0x2, 0xb0,
+    0x0, 0x0, 0x8, 0x0, 0xa2, 0x5, 0x60, 0x0,
+    0x0, 0x28, 0x0, 0x77, 0x8, 0x10, 0x0, 0x6,
+    0xe3, 0x0, 0x49, 0x9, 0x0, 0x0, 0x0, 0xd1,
+    0x0, 0x12, 0x7, 0x0, 0x0, 0x0, 0xe0, 0x0,
+    0x0, 0x42, 0x1, 0x80, 0x0, 0xa0, 0x65, 0x55,
+    0x55, 0x55, 0x51,
+
+    /* U+6CE8 "注" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x70, 0x0, 0x8, 0x50, 0x0, 0x0, 0x0, 0x6a,
+    0x0, 0x1, 0xe0, 0x0, 0x0, 0x0, 0x4, 0x40,
+    0x0, 0x20, 0x5, 0x50, 0x22, 0x0, 0x56, 0x55,
+    0xd5, 0x55, 0x40, 0xb, 0x53, 0x30, 0x0, 0xc0,
+    0x0, 0x0, 0x3, 0x67, 0x0, 0x0, 0xc0, 0x0,
+    0x0, 0x0, 0x8, 0x4, 0x55, 0xd5, 0x6d, 0x10,
+    0x0, 0x55, 0x1, 0x0, 0xc0, 0x0, 0x0, 0x17,
+    0xe0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x3, 0xd0,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x4, 0xb0, 0x0,
+    0x0, 0xc0, 0x2, 0x70, 0x4, 0xa0, 0x65, 0x55,
+    0x55, 0x55, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6CF3 "泳" */
+    0x0, 0x0, 0x0, 0x13, 0x0, 0x0, 0x0, 0x0,
+    0x82, 0x0, 0x6, 0xd2, 0x0, 0x0, 0x0, 0x2c,
+    0x0, 0x0, 0x52, 0x0, 0x0, 0x0, 0x2, 0x32,
+    0x65, 0xe1, 0x1, 0x0, 0x17, 0x0, 0x50, 0x0,
+    0xe1, 0xb, 0x40, 0x7, 0x93, 0x20, 0x40, 0xc5,
+    0x73, 0x0, 0x0, 0x47, 0x46, 0xd2, 0xc9, 0x10,
+    0x0, 0x0, 0x8, 0x0, 0xb0, 0xc7, 0x10, 0x0,
+    0x0, 0x55, 0x4, 0x70, 0xc2, 0x80, 0x0, 0x7,
+    0xf1, 0xa, 0x10, 0xc0, 0xb3, 0x0, 0x0, 0xe0,
+    0x37, 0x0, 0xc0, 0x3e, 0x30, 0x3, 0xd1, 0x60,
+    0x11, 0xc0, 0x6, 0xa1, 0x1, 0xa0, 0x0, 0x4d,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0,
+    0x0, 0x0,
+
+    /* U+6D0B "洋" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x60, 0x0, 0x92, 0x0, 0xd2, 0x0, 0x0, 0x69,
+    0x0, 0x4b, 0x4, 0x70, 0x0, 0x0, 0x5, 0x20,
+    0x3, 0x7, 0x5, 0x40, 0x12, 0x0, 0x45, 0x55,
+    0xd5, 0x55, 0x40, 0xb, 0x50, 0x50, 0x0, 0xc0,
+    0x2, 0x0, 0x2, 0x64, 0x23, 0x65, 0xd5, 0x59,
+    0x10, 0x0, 0x8, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0x0, 0x18, 0x0, 0x0, 0xc0, 0x1, 0x60, 0x5,
+    0xb4, 0x36, 0x55, 0xd5, 0x55, 0x50, 0x0, 0xe1,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xe0, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20,
+    0x0, 0x0,
+
+    /* U+6D17 "洗" */
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x1,
+    0x60, 0x0, 0x40, 0xb2, 0x0, 0x0, 0x0, 0x87,
+    0x2, 0xd0, 0xb0, 0x0, 0x0, 0x0, 0x12, 0x35,
+    0x95, 0xc5, 0x5d, 0x20, 0x15, 0x0, 0x49, 0x0,
+    0xb0, 0x0, 0x0, 0x7, 0x81, 0x54, 0x0, 0xb0,
+    0x0, 0x0, 0x0, 0x55, 0x35, 0x55, 0xc5, 0x56,
+    0xb0, 0x0, 0x7, 0x1, 0x1b, 0xa, 0x10, 0x0,
+    0x0, 0x17, 0x0, 0x29, 0xa, 0x10, 0x0, 0x5,
+    0xb4, 0x0, 0x57, 0xa, 0x10, 0x0, 0x0, 0xd2,
+    0x0, 0xa2, 0xa, 0x10, 0x40, 0x0, 0xf1, 0x4,
+    0x90, 0xa, 0x10, 0x80, 0x0, 0xe0, 0x57, 0x0,
+    0x6, 0xb9, 0xd4, 0x0, 0x2, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6D32 "洲" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x83, 0x0, 0xb0, 0x2, 0x0, 0xd0, 0x0, 0x1b,
+    0x0, 0xb0, 0xc, 0x0, 0xb0, 0x0, 0x0, 0x40,
+    0xb0, 0xa, 0x0, 0xb0, 0x7, 0x10, 0x50, 0xa0,
+    0xa, 0x0, 0xb0, 0x3, 0xc1, 0x45, 0xb6, 0xa,
+    0x70, 0xb0, 0x0, 0x26, 0x66, 0xa5, 0x6a, 0x84,
+    0xb0, 0x0, 0x8, 0x62, 0x91, 0x1a, 0x10, 0xb0,
+    0x0, 0x36, 0x4, 0x70, 0xa, 0x0, 0xb0, 0x6,
+    0xe2, 0x8, 0x20, 0xa, 0x0, 0xb0, 0x0, 0xd0,
+    0xa, 0x0, 0xa, 0x0, 0xb0, 0x0, 0xf0, 0x63,
+    0x0, 0xb, 0x0, 0xb0, 0x0, 0x92, 0x40, 0x0,
+    0x1, 0x0, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6D3B "活" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x72, 0x0, 0x0, 0x15, 0xac, 0x0, 0x0, 0x2d,
+    0x4, 0x57, 0xd6, 0x32, 0x0, 0x0, 0x3, 0x0,
+    0x0, 0xb0, 0x0, 0x0, 0x24, 0x0, 0x30, 0x0,
+    0xb0, 0x0, 0x20, 0x9, 0x64, 0x46, 0x55, 0xc5,
+    0x55, 0x91, 0x1, 0x56, 0x0, 0x0, 0xb0, 0x0,
+    0x0, 0x0, 0x16, 0x2, 0x0, 0xb0, 0x3, 0x0,
+    0x0, 0x72, 0xc, 0x55, 0x55, 0x5e, 0x10, 0x18,
+    0xd0, 0xc, 0x0, 0x0, 0xb, 0x0, 0x1, 0xb0,
+    0xc, 0x0, 0x0, 0xb, 0x0, 0x3, 0xb0, 0xc,
+    0x55, 0x55, 0x5c, 0x0, 0x2, 0x80, 0xc, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0,
+    0x2, 0x0,
+
+    /* U+6D3E "派" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x66, 0x0, 0x0, 0x26, 0xbc, 0x0, 0x0, 0xd,
+    0x9, 0x65, 0x42, 0x0, 0x0, 0x0, 0x0, 0x39,
+    0x20, 0x1, 0x6c, 0x0, 0x38, 0x1, 0x39, 0x2a,
+    0x67, 0x20, 0x0, 0x9, 0x55, 0x9, 0x2b, 0x4,
+    0x5, 0x40, 0x1, 0x7, 0xa, 0x1b, 0x6, 0x69,
+    0x20, 0x0, 0x35, 0xb, 0xb, 0x9, 0x20, 0x0,
+    0x0, 0xa0, 0xb, 0xb, 0x8, 0x10, 0x0, 0x19,
+    0xd0, 0x19, 0xb, 0x3, 0x80, 0x0, 0x3, 0xb0,
+    0x72, 0xb, 0x0, 0xa4, 0x0, 0x5, 0xa0, 0x70,
+    0xc, 0x83, 0x1e, 0x80, 0x1, 0x56, 0x0, 0x9,
+    0x10, 0x3, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6D41 "流" */
+    0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x9, 0x50, 0x1, 0x0, 0x0, 0x4b,
+    0x27, 0x59, 0x75, 0x59, 0x40, 0x0, 0x4, 0x0,
+    0x1d, 0x20, 0x0, 0x0, 0x32, 0x0, 0x40, 0x93,
+    0x0, 0x70, 0x0, 0xc, 0x32, 0x37, 0x73, 0x34,
+    0x98, 0x0, 0x3, 0x26, 0x7, 0x74, 0x20, 0x8,
+    0x0, 0x0, 0x7, 0xa, 0x29, 0x30, 0xb0, 0x0,
+    0x0, 0x63, 0xb, 0xb, 0x0, 0xb0, 0x0, 0x26,
+    0xc0, 0xb, 0xb, 0x0, 0xb0, 0x0, 0x6, 0xa0,
+    0xb, 0xb, 0x0, 0xb0, 0x30, 0x5, 0x90, 0x55,
+    0xb, 0x0, 0xb0, 0x60, 0x6, 0x93, 0x60, 0xb,
+    0x0, 0xb9, 0xc0, 0x0, 0x12, 0x0, 0x2, 0x0,
+    0x0, 0x0,
+
+    /* U+6D45 "浅" */
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x56, 0x0, 0x0, 0xd2, 0x50, 0x0, 0x0, 0xd,
+    0x20, 0x0, 0xc0, 0x86, 0x0, 0x0, 0x2, 0x4,
+    0x0, 0xc0, 0x4, 0x20, 0x7, 0x20, 0x33, 0x45,
+    0xd5, 0x56, 0x50, 0x2, 0xe0, 0x61, 0x10, 0xb0,
+    0x0, 0x20, 0x0, 0x41, 0x60, 0x2, 0xc5, 0x57,
+    0x90, 0x0, 0x6, 0x36, 0x43, 0xb0, 0x7, 0x0,
+    0x0, 0xa, 0x0, 0x0, 0x83, 0x8a, 0x0, 0x4,
+    0xb8, 0x0, 0x0, 0x3e, 0x80, 0x0, 0x0, 0x95,
+    0x0, 0x1, 0xad, 0x30, 0x50, 0x0, 0xb4, 0x0,
+    0x57, 0x11, 0xc4, 0x90, 0x0, 0x93, 0x13, 0x0,
+    0x0, 0x1b, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x20,
+
+    /* U+6D74 "浴" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x92, 0x0, 0x1d, 0x2, 0x70, 0x0, 0x0, 0x4c,
+    0x0, 0xa3, 0x0, 0x3e, 0x20, 0x0, 0x3, 0x45,
+    0x30, 0xa5, 0x7, 0x40, 0x17, 0x0, 0x62, 0x4,
+    0xb6, 0x0, 0x0, 0x7, 0xa2, 0x30, 0xc, 0x13,
+    0x60, 0x0, 0x0, 0x47, 0x0, 0xa2, 0x0, 0x69,
+    0x10, 0x0, 0x9, 0x8, 0x70, 0x0, 0xb, 0xe2,
+    0x0, 0x37, 0x51, 0xc5, 0x55, 0x5c, 0x0, 0x6,
+    0xd2, 0x0, 0xc0, 0x0, 0x1b, 0x0, 0x0, 0xf0,
+    0x0, 0xc0, 0x0, 0x1b, 0x0, 0x2, 0xf0, 0x0,
+    0xd5, 0x55, 0x5b, 0x0, 0x1, 0xc0, 0x0, 0xc0,
+    0x0, 0x1b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6D77 "海" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x1,
+    0x70, 0x4, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x94,
+    0x9, 0x75, 0x55, 0x5a, 0x40, 0x0, 0x12, 0x19,
+    0x0, 0x0, 0x0, 0x0, 0x29, 0x4, 0x6a, 0x55,
+    0x55, 0xa5, 0x0, 0x9, 0x25, 0x1c, 0x7, 0x30,
+    0x91, 0x0, 0x0, 0x14, 0xc, 0x1, 0x80, 0xa0,
+    0x20, 0x0, 0x64, 0x7c, 0x55, 0x55, 0xc5, 0x81,
+    0x0, 0x80, 0x38, 0x7, 0x20, 0xb0, 0x0, 0x2a,
+    0x80, 0x65, 0x3, 0x60, 0xb0, 0x0, 0x6, 0x60,
+    0xb6, 0x55, 0x55, 0xd5, 0x90, 0x8, 0x60, 0x0,
+    0x1, 0x11, 0xb0, 0x0, 0x5, 0x50, 0x0, 0x0,
+    0x6f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x0, 0x0,
+
+    /* U+6D88 "消" */
+    0x0, 0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x6,
+    0x20, 0x31, 0x2, 0xc0, 0x43, 0x0, 0x1e, 0x0,
+    0xc3, 0x1a, 0xb, 0x20, 0x0, 0x40, 0x35, 0x51,
+    0xa5, 0x10, 0x6, 0x10, 0x13, 0x85, 0x6c, 0x69,
+    0x20, 0x3d, 0x5, 0xc, 0x0, 0x0, 0xc0, 0x0,
+    0x50, 0x70, 0xd5, 0x55, 0x5d, 0x0, 0x0, 0x35,
+    0xc, 0x0, 0x0, 0xc0, 0x0, 0x9, 0x0, 0xc0,
+    0x0, 0xc, 0x0, 0x48, 0xb0, 0xd, 0x55, 0x55,
+    0xd0, 0x0, 0x68, 0x0, 0xc0, 0x0, 0xc, 0x0,
+    0x6, 0x70, 0xc, 0x0, 0x0, 0xc0, 0x0, 0x67,
+    0x0, 0xc0, 0x4, 0xbc, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x10,
+
+    /* U+6DBC "涼" */
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x50, 0x0, 0x0, 0x94, 0x0, 0x0, 0x0, 0x69,
+    0x0, 0x0, 0x16, 0x0, 0x60, 0x0, 0x6, 0x6,
+    0x65, 0x55, 0x55, 0x51, 0x13, 0x0, 0x40, 0x65,
+    0x55, 0x57, 0x0, 0x9, 0x60, 0x50, 0xb0, 0x0,
+    0xb, 0x0, 0x1, 0x94, 0x20, 0xb0, 0x0, 0xb,
+    0x0, 0x0, 0x8, 0x0, 0xb5, 0x57, 0x5c, 0x0,
+    0x0, 0x26, 0x0, 0x50, 0x1a, 0x3, 0x0, 0x6,
+    0xc1, 0x0, 0xa3, 0x1a, 0x33, 0x0, 0x0, 0xd0,
+    0x3, 0xa0, 0x1a, 0x9, 0x50, 0x0, 0xd0, 0x18,
+    0x0, 0x19, 0x1, 0xe0, 0x0, 0xc0, 0x50, 0x6,
+    0xb8, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x40,
+    0x0, 0x0,
+
+    /* U+6DF1 "深" */
+    0x0, 0x70, 0x4, 0x0, 0x0, 0x2, 0x10, 0x0,
+    0x59, 0xa, 0x55, 0x55, 0x5b, 0x50, 0x0, 0x2,
+    0x56, 0x47, 0x3, 0x43, 0x0, 0x32, 0x3, 0x10,
+    0xa1, 0x10, 0x6b, 0x0, 0xc, 0x35, 0x6, 0x0,
+    0xc2, 0x7, 0x0, 0x2, 0x16, 0x0, 0x0, 0xc0,
+    0x2, 0x40, 0x0, 0x53, 0x16, 0x5b, 0xf8, 0x55,
+    0x50, 0x0, 0xa0, 0x0, 0x2b, 0xc5, 0x10, 0x0,
+    0x29, 0xb0, 0x0, 0xb1, 0xc0, 0xa0, 0x0, 0x4,
+    0x90, 0x9, 0x20, 0xc0, 0x4c, 0x20, 0x6, 0x81,
+    0x61, 0x0, 0xc0, 0x7, 0x80, 0x4, 0x60, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+6DF7 "混" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x64, 0x2, 0x0, 0x0, 0x4, 0x0, 0x0, 0xd,
+    0x17, 0x85, 0x55, 0x5d, 0x0, 0x0, 0x2, 0x47,
+    0x85, 0x55, 0x5b, 0x0, 0x29, 0x0, 0x56, 0x50,
+    0x0, 0xb, 0x0, 0x7, 0x72, 0x37, 0x50, 0x0,
+    0xb, 0x0, 0x0, 0x17, 0x5, 0x65, 0x58, 0x57,
+    0x0, 0x0, 0x7, 0xa, 0x20, 0xc, 0x6, 0x10,
+    0x0, 0x63, 0xb, 0x5a, 0x3b, 0x88, 0x10, 0x18,
+    0xf0, 0xb, 0x0, 0xd, 0x20, 0x0, 0x0, 0xc0,
+    0xb, 0x0, 0xb, 0x0, 0x50, 0x1, 0xd0, 0xb,
+    0x66, 0x2b, 0x0, 0x90, 0x0, 0x80, 0x8, 0x40,
+    0xc, 0xab, 0xb0,
+
+    /* U+6E05 "清" */
+    0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x1,
+    0x91, 0x0, 0x0, 0xc0, 0x2, 0x0, 0x0, 0x59,
+    0x26, 0x55, 0xc5, 0x58, 0x40, 0x0, 0x2, 0x3,
+    0x55, 0xc5, 0x77, 0x0, 0x28, 0x4, 0x1, 0x10,
+    0xb0, 0x0, 0x10, 0x7, 0x85, 0x55, 0x55, 0xa5,
+    0x56, 0xb0, 0x0, 0x25, 0x2, 0x0, 0x0, 0x4,
+    0x0, 0x0, 0x33, 0xb, 0x55, 0x55, 0x5c, 0x0,
+    0x0, 0x80, 0xb, 0x55, 0x55, 0x5b, 0x0, 0x28,
+    0xb0, 0xb, 0x0, 0x0, 0xb, 0x0, 0x4, 0xa0,
+    0xb, 0x55, 0x55, 0x5b, 0x0, 0x5, 0x80, 0xb,
+    0x0, 0x0, 0xb, 0x0, 0x5, 0x70, 0xb, 0x0,
+    0x5, 0xc9, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0,
+    0x20, 0x0,
+
+    /* U+6E07 "渇" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x73, 0x9, 0x65, 0x55, 0x5c, 0x0, 0x0, 0x1d,
+    0x9, 0x20, 0x0, 0xb, 0x0, 0x0, 0x2, 0x2b,
+    0x65, 0x55, 0x5b, 0x0, 0x16, 0x0, 0x59, 0x20,
+    0x0, 0xb, 0x0, 0x6, 0x91, 0x59, 0x85, 0x55,
+    0x5b, 0x0, 0x0, 0x56, 0x3, 0xc4, 0x0, 0x0,
+    0x10, 0x0, 0x8, 0x7, 0x85, 0x55, 0x57, 0xb0,
+    0x0, 0x54, 0x5a, 0x30, 0x35, 0x3, 0x80, 0x6,
+    0xe2, 0x27, 0x67, 0x62, 0x4, 0x70, 0x0, 0xc0,
+    0x7, 0x60, 0x5, 0x14, 0x70, 0x0, 0xd0, 0x3,
+    0xa9, 0x9a, 0x25, 0x60, 0x0, 0x70, 0x0, 0x0,
+    0x0, 0x7e, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x0,
+
+    /* U+6E08 "済" */
+    0x0, 0x0, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0,
+    0x72, 0x0, 0x1, 0xd1, 0x0, 0x0, 0x0, 0x1d,
+    0x6, 0x65, 0x95, 0x88, 0x70, 0x0, 0x3, 0x0,
+    0x60, 0x2, 0xb0, 0x0, 0x15, 0x0, 0x40, 0x1a,
+    0x1b, 0x10, 0x0, 0x7, 0x80, 0x40, 0x7, 0xf4,
+    0x0, 0x0, 0x0, 0x65, 0x2, 0x87, 0x2a, 0xb6,
+    0x41, 0x0, 0x8, 0x46, 0x80, 0x0, 0xa9, 0x60,
+    0x0, 0x45, 0x3, 0xa5, 0x55, 0xd0, 0x0, 0x7,
+    0xe0, 0x4, 0x70, 0x0, 0xb0, 0x0, 0x0, 0xd0,
+    0x7, 0x75, 0x55, 0xc0, 0x0, 0x1, 0xd0, 0xa,
+    0x0, 0x0, 0xb0, 0x0, 0x0, 0x90, 0x54, 0x0,
+    0x0, 0xb0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0,
+    0x40, 0x0,
+
+    /* U+6E09 "渉" */
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x73, 0x0, 0x0, 0xa3, 0x0, 0x0, 0x0, 0x1d,
+    0x0, 0x61, 0xa1, 0x0, 0x0, 0x0, 0x2, 0x30,
+    0xa0, 0xa6, 0x59, 0x0, 0x26, 0x0, 0x50, 0xa0,
+    0xa1, 0x0, 0x0, 0x8, 0x72, 0x55, 0xc5, 0xb6,
+    0x56, 0xa0, 0x1, 0x47, 0x1, 0x10, 0x93, 0x0,
+    0x0, 0x0, 0x17, 0x0, 0xd1, 0xa1, 0x19, 0x20,
+    0x0, 0x82, 0x4, 0x70, 0xa1, 0x31, 0xd0, 0x18,
+    0xd0, 0x9, 0x0, 0xa4, 0xd2, 0x30, 0x2, 0xb0,
+    0x23, 0x0, 0x6c, 0x10, 0x0, 0x4, 0xb0, 0x0,
+    0x8, 0x90, 0x0, 0x0, 0x2, 0x70, 0x6, 0x83,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x41, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6E1B "減" */
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x1,
+    0x60, 0x0, 0x0, 0xc, 0x48, 0x0, 0x0, 0x78,
+    0x0, 0x0, 0xb, 0x6, 0x50, 0x0, 0x4, 0x3b,
+    0x55, 0x5c, 0x65, 0x92, 0x22, 0x0, 0x4b, 0x0,
+    0x9, 0x10, 0x0, 0xb, 0x43, 0x2b, 0x46, 0xba,
+    0x22, 0x70, 0x3, 0x56, 0xa, 0x0, 0x17, 0x36,
+    0x70, 0x0, 0x16, 0xa, 0x95, 0xc7, 0x6b, 0x10,
+    0x0, 0x72, 0xa, 0x90, 0xa2, 0xb9, 0x0, 0x18,
+    0xc0, 0xa, 0x90, 0xa0, 0xe2, 0x0, 0x3, 0xa0,
+    0x36, 0x95, 0xa6, 0xc5, 0x40, 0x4, 0x90, 0x91,
+    0x0, 0x38, 0xc, 0x80, 0x3, 0x82, 0x50, 0x3,
+    0x70, 0x3, 0xf3, 0x0, 0x2, 0x0, 0x2, 0x0,
+    0x0, 0x12,
+
+    /* U+6E21 "渡" */
+    0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0,
+    0x91, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0, 0x59,
+    0x9, 0x55, 0x87, 0x55, 0xb1, 0x10, 0x1, 0x1b,
+    0x7, 0x10, 0x80, 0x0, 0x1a, 0x10, 0x4b, 0xa,
+    0x0, 0xa1, 0x40, 0x6, 0x65, 0xc, 0x5c, 0x55,
+    0xc5, 0x40, 0x0, 0x6, 0xb, 0xa, 0x55, 0xb0,
+    0x0, 0x0, 0x16, 0xb, 0x5, 0x0, 0x40, 0x0,
+    0x0, 0x81, 0x19, 0x37, 0x55, 0xd4, 0x0, 0x18,
+    0xd0, 0x46, 0x5, 0x15, 0x90, 0x0, 0x2, 0xb0,
+    0x82, 0x0, 0xbb, 0x0, 0x0, 0x4, 0xb0, 0x90,
+    0x7, 0x9b, 0x60, 0x0, 0x1, 0x66, 0x25, 0x73,
+    0x0, 0x7e, 0xa1, 0x0, 0x1, 0x21, 0x0, 0x0,
+    0x0, 0x10,
+
+    /* U+6E29 "温" */
+    0x0, 0x81, 0x7, 0x55, 0x55, 0x91, 0x0, 0x0,
+    0x47, 0xa, 0x0, 0x0, 0x90, 0x0, 0x0, 0x0,
+    0x4b, 0x55, 0x55, 0xb0, 0x0, 0x17, 0x3, 0x1a,
+    0x0, 0x0, 0x90, 0x0, 0x7, 0x55, 0xa, 0x0,
+    0x0, 0xa0, 0x0, 0x0, 0x7, 0xa, 0x55, 0x55,
+    0xa0, 0x0, 0x0, 0x35, 0x20, 0x0, 0x0, 0x3,
+    0x0, 0x0, 0x81, 0xb5, 0xb5, 0x5c, 0x5d, 0x0,
+    0x28, 0xc0, 0xb0, 0xa0, 0xa, 0xb, 0x0, 0x4,
+    0xa0, 0xb0, 0xa0, 0xa, 0xb, 0x0, 0x5, 0x90,
+    0xb0, 0xa0, 0xa, 0xb, 0x0, 0x5, 0x95, 0xc5,
+    0xb5, 0x5c, 0x5d, 0xb1, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+6E2F "港" */
+    0x0, 0x0, 0x0, 0x20, 0x3, 0x0, 0x0, 0x0,
+    0xa2, 0x0, 0x94, 0xb, 0x10, 0x0, 0x0, 0x49,
+    0x0, 0x92, 0xb, 0x5, 0x0, 0x10, 0x2, 0x26,
+    0xb6, 0x5c, 0x55, 0x10, 0xb, 0x24, 0x0, 0x92,
+    0xb, 0x0, 0x10, 0x5, 0x65, 0x65, 0xa8, 0x5a,
+    0x55, 0x81, 0x0, 0x5, 0x0, 0xb0, 0x3, 0x40,
+    0x0, 0x0, 0x42, 0x7, 0xb5, 0x58, 0xb7, 0x0,
+    0x0, 0x90, 0x55, 0xb0, 0x7, 0x36, 0xd2, 0x19,
+    0xa4, 0x30, 0xc5, 0x59, 0x30, 0x0, 0x4, 0x80,
+    0x0, 0xb0, 0x3, 0x13, 0x0, 0x6, 0x80, 0x0,
+    0xb0, 0x0, 0x4, 0x30, 0x3, 0x50, 0x0, 0xba,
+    0xaa, 0xac, 0x60,
+
+    /* U+6E56 "湖" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x60, 0x3, 0x90, 0x2, 0x0, 0x30, 0x0, 0x94,
+    0x13, 0x70, 0xd, 0x55, 0xb0, 0x0, 0x1, 0x45,
+    0x85, 0x1b, 0x1, 0x90, 0x44, 0x4, 0x26, 0x82,
+    0x1c, 0x55, 0x90, 0xc, 0x25, 0x3, 0x70, 0xa,
+    0x1, 0x90, 0x2, 0x6, 0x46, 0x86, 0xa, 0x1,
+    0x90, 0x0, 0x43, 0xb2, 0x2a, 0xc, 0x55, 0x90,
+    0x0, 0x90, 0xa0, 0xa, 0x19, 0x1, 0x90, 0x29,
+    0xb0, 0xa0, 0xa, 0x46, 0x1, 0x90, 0x3, 0x90,
+    0xb5, 0x59, 0x90, 0x1, 0x90, 0x5, 0x90, 0x80,
+    0x5, 0x40, 0x22, 0x90, 0x2, 0x60, 0x0, 0x44,
+    0x0, 0x4e, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6E90 "源" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x91, 0x8, 0x55, 0x55, 0x57, 0xb0, 0x0, 0x68,
+    0xc, 0x0, 0xc, 0x10, 0x0, 0x0, 0x1, 0x4c,
+    0x2, 0x34, 0x4, 0x0, 0x35, 0x1, 0x3c, 0xc,
+    0x55, 0x5c, 0x20, 0xb, 0x65, 0xc, 0xb, 0x0,
+    0xb, 0x0, 0x2, 0x26, 0xc, 0xc, 0x55, 0x5c,
+    0x0, 0x0, 0x16, 0xb, 0xb, 0x0, 0xb, 0x0,
+    0x0, 0x71, 0x29, 0xa, 0x5d, 0x59, 0x0, 0x18,
+    0xd0, 0x64, 0x6, 0xc, 0x22, 0x0, 0x2, 0xb0,
+    0x90, 0x4a, 0xc, 0xa, 0x50, 0x4, 0xa3, 0x41,
+    0x80, 0xc, 0x1, 0xe0, 0x2, 0x85, 0x4, 0x2,
+    0x9d, 0x0, 0x30, 0x0, 0x10, 0x0, 0x0, 0x11,
+    0x0, 0x0,
+
+    /* U+6E96 "準" */
+    0x0, 0x10, 0x0, 0x10, 0x10, 0x0, 0x0, 0x0,
+    0x94, 0x0, 0x95, 0x2a, 0x0, 0x0, 0x0, 0x5,
+    0x31, 0xc5, 0x58, 0x59, 0x70, 0x8, 0x30, 0x48,
+    0xb0, 0x1a, 0x2, 0x0, 0x1, 0x65, 0x62, 0xc5,
+    0x6c, 0x57, 0x20, 0x0, 0x7, 0x10, 0xb0, 0x1a,
+    0x15, 0x10, 0x3, 0xb3, 0x0, 0xc5, 0x6b, 0x44,
+    0x20, 0x0, 0x91, 0x0, 0xd5, 0x6b, 0x57, 0x90,
+    0x0, 0x82, 0x0, 0x46, 0x0, 0x0, 0x0, 0x5,
+    0x55, 0x55, 0x7b, 0x55, 0x55, 0xa2, 0x1, 0x0,
+    0x0, 0x29, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x29, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x29,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0,
+
+    /* U+6E9D "溝" */
+    0x0, 0x0, 0x0, 0x21, 0x2, 0x10, 0x0, 0x0,
+    0x70, 0x0, 0x67, 0x6, 0x70, 0x0, 0x0, 0x69,
+    0x36, 0x98, 0x59, 0x87, 0x70, 0x0, 0x4, 0x20,
+    0x65, 0x5, 0x54, 0x0, 0x31, 0x0, 0x46, 0x98,
+    0x59, 0x85, 0x30, 0xc, 0x25, 0x36, 0x76, 0x97,
+    0x75, 0x90, 0x5, 0x36, 0x2, 0x0, 0xb0, 0x3,
+    0x0, 0x0, 0x34, 0xb, 0x55, 0xc5, 0x5d, 0x0,
+    0x0, 0x90, 0xb, 0x55, 0xc5, 0x5b, 0x0, 0x29,
+    0xa0, 0xb, 0x0, 0xb0, 0xb, 0x20, 0x6, 0x70,
+    0x6c, 0x55, 0x65, 0x5c, 0x61, 0x7, 0x70, 0xb,
+    0x0, 0x0, 0xb, 0x0, 0x5, 0x60, 0xb, 0x0,
+    0x5, 0x9a, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0,
+    0x42, 0x0,
+
+    /* U+6EFF "滿" */
+    0x0, 0x0, 0x0, 0x11, 0x0, 0x30, 0x0, 0x0,
+    0x72, 0x0, 0x47, 0x0, 0xc0, 0x0, 0x0, 0x1d,
+    0x36, 0x79, 0x55, 0xd5, 0x92, 0x0, 0x3, 0x20,
+    0x36, 0x0, 0xb0, 0x0, 0x6, 0x0, 0x40, 0x49,
+    0xa5, 0xc0, 0x0, 0x4, 0xb0, 0x50, 0x10, 0xb0,
+    0x0, 0x0, 0x0, 0x74, 0x2c, 0x55, 0xc5, 0x58,
+    0x90, 0x0, 0x7, 0xb, 0x61, 0xb3, 0x54, 0x60,
+    0x0, 0x27, 0xb, 0x3b, 0xb0, 0xd8, 0x60, 0x5,
+    0xd3, 0xb, 0x79, 0xd5, 0x6e, 0x60, 0x0, 0xc0,
+    0xc, 0x11, 0xb3, 0x6, 0x60, 0x0, 0xe0, 0xb,
+    0x0, 0xb0, 0x4, 0x60, 0x0, 0x90, 0xb, 0x0,
+    0xb0, 0x5b, 0x50, 0x0, 0x0, 0x3, 0x0, 0x0,
+    0x5, 0x0,
+
+    /* U+6F22 "漢" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x20, 0x0, 0x0,
+    0x81, 0x0, 0xb0, 0x1, 0xa0, 0x40, 0x0, 0x4a,
+    0x36, 0xc5, 0x56, 0xb5, 0x50, 0x0, 0x3, 0x31,
+    0xb5, 0x56, 0x90, 0x0, 0x14, 0x0, 0x50, 0x40,
+    0xa0, 0x31, 0x0, 0x9, 0x61, 0x4c, 0x55, 0xc5,
+    0x5c, 0x0, 0x1, 0x56, 0xb, 0x0, 0xa0, 0xa,
+    0x0, 0x0, 0x7, 0xa, 0x55, 0xc5, 0x58, 0x0,
+    0x0, 0x63, 0x6, 0x55, 0xc5, 0x68, 0x0, 0x17,
+    0xd0, 0x0, 0x1, 0x90, 0x0, 0x40, 0x1, 0xb0,
+    0x65, 0x5a, 0x89, 0x55, 0x51, 0x2, 0xb0, 0x0,
+    0x39, 0x5, 0x70, 0x0, 0x1, 0x80, 0x6, 0x70,
+    0x0, 0x4d, 0x92, 0x0, 0x0, 0x41, 0x0, 0x0,
+    0x0, 0x10,
+
+    /* U+6F38 "漸" */
+    0x0, 0x0, 0x0, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x92, 0x0, 0xc0, 0x0, 0x16, 0xc2, 0x0, 0x4a,
+    0x65, 0xc5, 0x99, 0x51, 0x0, 0x0, 0x1, 0x10,
+    0xb0, 0x28, 0x10, 0x0, 0x26, 0x4, 0xb5, 0xc5,
+    0xd8, 0x10, 0x50, 0x8, 0x75, 0xb0, 0xb0, 0xb8,
+    0x6c, 0x51, 0x1, 0x45, 0xb5, 0xc5, 0xb8, 0x1b,
+    0x0, 0x0, 0x52, 0xb0, 0xb0, 0xb8, 0x1b, 0x0,
+    0x0, 0xa0, 0x95, 0xc5, 0x69, 0xb, 0x0, 0x29,
+    0xa3, 0x55, 0xc5, 0xa9, 0xb, 0x0, 0x4, 0x80,
+    0x0, 0xb0, 0x9, 0xb, 0x0, 0x6, 0x80, 0x0,
+    0xb0, 0x44, 0xb, 0x0, 0x4, 0x60, 0x0, 0xc1,
+    0x60, 0xb, 0x0, 0x0, 0x0, 0x0, 0x42, 0x0,
+    0x4, 0x0,
+
+    /* U+6FC3 "濃" */
+    0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x1,
+    0x60, 0x2, 0xa, 0xa, 0x3, 0x0, 0x0, 0x78,
+    0xb, 0x5c, 0x5c, 0x5c, 0x20, 0x0, 0x4, 0x4b,
+    0x5c, 0x5c, 0x5c, 0x0, 0x7, 0x11, 0x4b, 0xa,
+    0xa, 0xb, 0x0, 0x3, 0xc5, 0x18, 0x55, 0x55,
+    0x58, 0x0, 0x0, 0x57, 0x1c, 0x55, 0x55, 0x56,
+    0x30, 0x0, 0x26, 0xb, 0x45, 0x55, 0x57, 0x0,
+    0x1, 0xa2, 0xc, 0x55, 0x55, 0x55, 0x90, 0x5,
+    0xe0, 0x1a, 0x73, 0x60, 0x36, 0x0, 0x0, 0xc0,
+    0x37, 0x73, 0x39, 0x71, 0x0, 0x1, 0xd0, 0x81,
+    0x75, 0x55, 0xb4, 0x10, 0x0, 0x42, 0x40, 0x77,
+    0x0, 0x2a, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+6FDF "濟" */
+    0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x2,
+    0x60, 0x0, 0x1, 0xb0, 0x0, 0x10, 0x0, 0x95,
+    0x46, 0x56, 0x66, 0x57, 0x80, 0x0, 0x12, 0x30,
+    0xa, 0x2b, 0x15, 0x10, 0x27, 0x4, 0x3a, 0x98,
+    0x93, 0x68, 0x10, 0x8, 0x76, 0xa, 0x64, 0xb4,
+    0x68, 0x0, 0x0, 0x45, 0x36, 0x92, 0xa5, 0x97,
+    0xa1, 0x0, 0x61, 0x65, 0x90, 0x62, 0x43, 0x61,
+    0x0, 0xa0, 0xa, 0x75, 0x55, 0x5d, 0x0, 0x1a,
+    0x90, 0xa, 0x10, 0x0, 0xc, 0x0, 0x5, 0x70,
+    0xb, 0x55, 0x55, 0x5c, 0x0, 0x6, 0x70, 0x18,
+    0x0, 0x0, 0xc, 0x0, 0x3, 0x41, 0x80, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x3, 0x0,
+
+    /* U+7063 "灣" */
+    0x0, 0x0, 0x2, 0x1, 0x20, 0x2, 0x0, 0x2,
+    0x50, 0x28, 0x10, 0x92, 0x9, 0x40, 0x0, 0xa4,
+    0x97, 0x66, 0x57, 0x96, 0xa0, 0x0, 0x23, 0x34,
+    0x26, 0x87, 0x17, 0x30, 0x16, 0x4, 0xa7, 0xa5,
+    0x35, 0x89, 0x75, 0x7, 0x75, 0x33, 0x3a, 0x5b,
+    0x23, 0x30, 0x1, 0x57, 0x99, 0x8a, 0x5b, 0x94,
+    0x86, 0x0, 0x52, 0x16, 0x58, 0x57, 0x6a, 0x10,
+    0x0, 0x90, 0x3, 0x22, 0x22, 0x2b, 0x0, 0x18,
+    0xa0, 0xb, 0x33, 0x33, 0x37, 0x0, 0x4, 0x80,
+    0x18, 0x55, 0x55, 0x5b, 0x50, 0x5, 0x70, 0x0,
+    0x0, 0x0, 0xb, 0x0, 0x4, 0x70, 0x0, 0x0,
+    0x17, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+706B "火" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb3, 0x0, 0x10, 0x0, 0x0, 0x4, 0x0, 0xb3,
+    0x0, 0xb6, 0x0, 0x0, 0x18, 0x0, 0xc3, 0x6,
+    0x80, 0x0, 0x1, 0xc4, 0x0, 0xd4, 0x36, 0x0,
+    0x0, 0x4, 0x70, 0x1, 0xc4, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0x70, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0x10, 0x47, 0x0, 0x0, 0x0, 0x0,
+    0x85, 0x0, 0x9, 0x70, 0x0, 0x0, 0x8, 0x60,
+    0x0, 0x0, 0xab, 0x40, 0x4, 0x72, 0x0, 0x0,
+    0x0, 0x8, 0x80, 0x21, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+707D "災" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0xb, 0x40, 0x59, 0x0, 0xa5, 0x0, 0x0, 0x45,
+    0x0, 0x90, 0x3, 0x60, 0x0, 0x0, 0x70, 0x6,
+    0x0, 0x7, 0x0, 0x0, 0x0, 0x67, 0x3, 0x90,
+    0x6, 0x60, 0x0, 0x0, 0xb, 0x20, 0x58, 0x0,
+    0x94, 0x0, 0x0, 0x1, 0x0, 0x32, 0x0, 0x11,
+    0x0, 0x0, 0x2, 0x0, 0xa7, 0x0, 0x10, 0x0,
+    0x0, 0x9, 0x0, 0xc6, 0x3, 0xb0, 0x0, 0x0,
+    0x7a, 0x2, 0xb3, 0x76, 0x0, 0x0, 0x0, 0x10,
+    0xb, 0x40, 0x82, 0x0, 0x0, 0x0, 0x0, 0x97,
+    0x0, 0xc, 0x60, 0x0, 0x1, 0x69, 0x30, 0x0,
+    0x0, 0x9e, 0x81, 0x13, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0,
+
+    /* U+70B9 "点" */
+    0x0, 0x0, 0x0, 0x51, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc5, 0x55, 0x6c, 0x10, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0xc5, 0x59, 0x55, 0x5e, 0x10, 0x0,
+    0xd, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xd0,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0xd, 0x55, 0x55,
+    0x55, 0xc0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x8,
+    0x0, 0x0, 0x30, 0x12, 0x2, 0x10, 0x14, 0x0,
+    0x9, 0x0, 0xb1, 0xc, 0x0, 0x85, 0x9, 0x70,
+    0x7, 0x10, 0x81, 0x2, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+70BA "為" */
+    0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xa0, 0x6a, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x61, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x75, 0x56,
+    0xc5, 0x56, 0xb0, 0x0, 0x0, 0x0, 0x9, 0x30,
+    0x6, 0x50, 0x0, 0x0, 0x0, 0x1c, 0x55, 0x59,
+    0x6d, 0x10, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x47,
+    0x0, 0x0, 0x6, 0x95, 0x55, 0x55, 0x96, 0xc1,
+    0x0, 0x38, 0x0, 0x1, 0x3, 0x0, 0xb0, 0x2,
+    0x72, 0x27, 0x6, 0x62, 0xa2, 0xa0, 0x13, 0xa,
+    0x4, 0x90, 0xb0, 0x64, 0x80, 0x0, 0x6b, 0x0,
+    0x50, 0x0, 0x7, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x8e, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x0,
+
+    /* U+7121 "無" */
+    0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x86,
+    0x56, 0x56, 0xa2, 0x0, 0x6, 0xd0, 0xa0, 0xa0,
+    0xb0, 0x0, 0x2, 0x3a, 0xa, 0xa, 0xb, 0x0,
+    0x0, 0x0, 0xa0, 0xa0, 0xa0, 0xb0, 0x70, 0x2,
+    0x6c, 0x5c, 0x5c, 0x5c, 0x55, 0x10, 0x0, 0xa0,
+    0xa0, 0xa0, 0xb0, 0x0, 0x0, 0xa, 0xa, 0xa,
+    0xb, 0x3, 0x0, 0x65, 0x85, 0x85, 0x85, 0x85,
+    0x93, 0x0, 0x40, 0x23, 0x1, 0x50, 0x16, 0x0,
+    0x1a, 0x0, 0xb1, 0x9, 0x40, 0x86, 0xc, 0x50,
+    0x8, 0x30, 0x35, 0x2, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+7136 "然" */
+    0x0, 0x3, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0xe, 0x20, 0x0, 0xb2, 0x50, 0x0, 0x0, 0x49,
+    0x2, 0x20, 0xb1, 0x4b, 0x0, 0x0, 0xa6, 0x5a,
+    0x80, 0xb0, 0x7, 0x0, 0x2, 0xa9, 0x2b, 0x56,
+    0xd6, 0x5b, 0x40, 0x8, 0x73, 0x6b, 0x0, 0xc5,
+    0x0, 0x0, 0x32, 0x67, 0x74, 0x1, 0xa5, 0x30,
+    0x0, 0x0, 0x3, 0xa0, 0x8, 0x30, 0xb1, 0x0,
+    0x0, 0x2a, 0x0, 0x57, 0x0, 0x4d, 0x40, 0x4,
+    0x70, 0x5, 0x30, 0x0, 0x6, 0x50, 0x11, 0x40,
+    0x31, 0x4, 0x10, 0x34, 0x0, 0x1, 0xa0, 0x1c,
+    0x1, 0xc0, 0xb, 0x40, 0xb, 0x70, 0xc, 0x0,
+    0xa0, 0x4, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7159 "煙" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x2, 0x65, 0x55, 0x55, 0xb3, 0x0, 0xc,
+    0x0, 0x0, 0xb0, 0xb0, 0x0, 0x0, 0xc, 0x27,
+    0x75, 0xc5, 0xd5, 0x90, 0x2, 0x1c, 0x92, 0xa0,
+    0xb0, 0xb0, 0xb0, 0x8, 0x2d, 0x10, 0xa0, 0xb0,
+    0xb0, 0xb0, 0x1d, 0xb, 0x0, 0xa0, 0xb0, 0xb0,
+    0xb0, 0x0, 0xb, 0x0, 0xa5, 0x5a, 0x55, 0x60,
+    0x0, 0x1b, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0,
+    0x39, 0xa2, 0x55, 0x5c, 0x59, 0x60, 0x0, 0x73,
+    0x3b, 0x0, 0xb, 0x0, 0x0, 0x0, 0xa0, 0x2,
+    0x0, 0xb, 0x0, 0x0, 0x7, 0x20, 0x5, 0x55,
+    0x5c, 0x55, 0x97, 0x12, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+71B1 "熱" */
+    0x0, 0x0, 0x20, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0xd0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x65,
+    0xc6, 0x80, 0xb, 0x4, 0x0, 0x0, 0x0, 0xb0,
+    0x24, 0x5c, 0x79, 0x0, 0x4, 0x77, 0x76, 0x72,
+    0x19, 0x36, 0x0, 0x0, 0x96, 0x37, 0x92, 0x48,
+    0x36, 0x0, 0x6, 0x20, 0xc0, 0x70, 0xb9, 0x38,
+    0x0, 0x0, 0x65, 0xc7, 0x70, 0xb9, 0x6b, 0x2,
+    0x0, 0x0, 0xb3, 0x46, 0x30, 0x18, 0xa2, 0x4,
+    0xba, 0x62, 0x23, 0x0, 0x0, 0xb2, 0x1, 0x23,
+    0x5, 0x1, 0x40, 0x24, 0x0, 0x0, 0x92, 0x7,
+    0x50, 0xa3, 0xb, 0x40, 0x7, 0xa0, 0x2, 0x60,
+    0x33, 0x4, 0x60, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+71DF "營" */
+    0x0, 0x0, 0x30, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x2b, 0x15, 0x2, 0xa1, 0x30, 0x0, 0x63, 0xc7,
+    0x37, 0x4a, 0x84, 0x0, 0x6, 0x2c, 0x63, 0x86,
+    0x94, 0x0, 0x0, 0x9, 0x12, 0x92, 0x90, 0x6b,
+    0x0, 0x5, 0x22, 0x22, 0x62, 0x22, 0x64, 0x4,
+    0x73, 0x43, 0x33, 0x36, 0x3a, 0x60, 0xa1, 0xc,
+    0x55, 0x55, 0xd2, 0x30, 0x0, 0x0, 0xc5, 0x55,
+    0x5c, 0x0, 0x0, 0x0, 0x15, 0x0, 0x0, 0x32,
+    0x0, 0x0, 0xd, 0x55, 0x55, 0x55, 0xd2, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x0, 0xd,
+    0x55, 0x55, 0x55, 0xd0, 0x0, 0x0, 0x70, 0x0,
+    0x0, 0x5, 0x0,
+
+    /* U+722D "爭" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x2, 0x35, 0x7a, 0xdc, 0x0, 0x1, 0x54, 0x47,
+    0x21, 0x2, 0x50, 0x0, 0x8, 0x50, 0x3a, 0x0,
+    0x94, 0x0, 0x0, 0x9, 0x0, 0x60, 0x53, 0x0,
+    0x0, 0x5, 0x55, 0x57, 0x56, 0x5c, 0x0, 0x0,
+    0x0, 0x1, 0x90, 0x1, 0xa0, 0x13, 0x65, 0x55,
+    0x6b, 0x55, 0x5c, 0x86, 0x0, 0x0, 0x1, 0x90,
+    0x1, 0xa0, 0x0, 0x6, 0x55, 0x6b, 0x55, 0x5a,
+    0x0, 0x0, 0x0, 0x1, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x29, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0x8e, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x50,
+    0x0, 0x0, 0x0,
+
+    /* U+7236 "父" */
+    0x0, 0x0, 0x47, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x1, 0xd5, 0x0, 0x7, 0x60, 0x0, 0x0, 0xb,
+    0x30, 0x0, 0x0, 0x7c, 0x0, 0x1, 0x81, 0x10,
+    0x0, 0x5, 0x9, 0x50, 0x14, 0x0, 0x50, 0x0,
+    0x1d, 0x10, 0x0, 0x0, 0x0, 0x52, 0x0, 0x85,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0x1, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0x8a, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xab, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0x76, 0xc3, 0x0, 0x0, 0x0, 0x2,
+    0x94, 0x0, 0x3c, 0xc7, 0x30, 0x3, 0x75, 0x0,
+    0x0, 0x0, 0x4a, 0x91, 0x12, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+7238 "爸" */
+    0x0, 0x0, 0x20, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x1, 0xc4, 0x0, 0x6, 0x91, 0x0, 0x0, 0x29,
+    0x41, 0x0, 0x77, 0x4d, 0x0, 0x3, 0x50, 0x7,
+    0x39, 0x80, 0x2, 0x0, 0x0, 0x0, 0x4, 0xda,
+    0x10, 0x0, 0x0, 0x0, 0x5, 0x96, 0x2, 0x8a,
+    0x97, 0x63, 0x15, 0x68, 0x55, 0x55, 0x55, 0xb5,
+    0x50, 0x0, 0xb, 0x0, 0xb0, 0x1, 0xa0, 0x0,
+    0x0, 0xb, 0x0, 0xb0, 0x1, 0x90, 0x0, 0x0,
+    0xb, 0x55, 0x85, 0x56, 0x90, 0x0, 0x0, 0xb,
+    0x0, 0x0, 0x0, 0x3, 0x10, 0x0, 0xb, 0x0,
+    0x0, 0x0, 0x5, 0x30, 0x0, 0x7, 0xba, 0xaa,
+    0xaa, 0xad, 0x60,
+
+    /* U+7247 "片" */
+    0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0,
+    0x64, 0x0, 0xd, 0x0, 0x0, 0x0, 0x8, 0x40,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0x83, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0x8, 0x75, 0x55, 0xd5, 0x5b,
+    0x70, 0x0, 0x93, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb6,
+    0x55, 0x55, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x1b, 0x0, 0x0, 0x1, 0xb0, 0x0, 0x1, 0xb0,
+    0x0, 0x0, 0x83, 0x0, 0x0, 0x1b, 0x0, 0x0,
+    0x28, 0x0, 0x0, 0x1, 0xb0, 0x0, 0x6, 0x0,
+    0x0, 0x0, 0x1b, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x10, 0x0,
+
+    /* U+725B "牛" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x10, 0x1d, 0x0, 0x0, 0x0, 0x0, 0x4c, 0x0,
+    0xc0, 0x0, 0x0, 0x0, 0x9, 0x50, 0xc, 0x0,
+    0x17, 0x0, 0x0, 0xc5, 0x55, 0xd5, 0x55, 0x51,
+    0x0, 0x73, 0x0, 0xc, 0x0, 0x0, 0x0, 0x15,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x4, 0x55, 0x55,
+    0x5d, 0x55, 0x59, 0xc1, 0x10, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+7260 "牠" */
+    0x0, 0x2, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0xc, 0x20, 0x0, 0xd, 0x0, 0x0, 0x5, 0x5b,
+    0x0, 0x40, 0xb, 0x0, 0x0, 0x9, 0x4b, 0x0,
+    0xb2, 0xb, 0x3, 0x0, 0xb, 0x5c, 0x93, 0xb0,
+    0xc, 0x5c, 0x20, 0x8, 0xb, 0x5, 0xc5, 0x4b,
+    0xa, 0x0, 0x51, 0xb, 0x1, 0xb0, 0xb, 0xb,
+    0x0, 0x20, 0xb, 0x22, 0xb0, 0xb, 0xb, 0x0,
+    0x0, 0x3d, 0x40, 0xb0, 0xb, 0x5c, 0x0, 0x2b,
+    0x6b, 0x0, 0xb0, 0xb, 0x56, 0x0, 0x2, 0xb,
+    0x0, 0xb0, 0xb, 0x0, 0x40, 0x0, 0xb, 0x0,
+    0xb0, 0x0, 0x2, 0x70, 0x0, 0xb, 0x0, 0x5b,
+    0x99, 0x9b, 0x90, 0x0, 0x7, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7269 "物" */
+    0x0, 0x2, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x20, 0xd, 0x30, 0x0, 0x0, 0x6, 0x7b,
+    0x0, 0x2b, 0x0, 0x0, 0x0, 0x9, 0x2b, 0x11,
+    0x88, 0x95, 0x95, 0xd1, 0xb, 0x5c, 0x66, 0x90,
+    0xc0, 0xd0, 0xc0, 0x24, 0xb, 0x6, 0x15, 0x61,
+    0xb0, 0xc0, 0x30, 0xb, 0x2, 0xa, 0x6, 0x70,
+    0xc0, 0x0, 0xc, 0x62, 0x64, 0xb, 0x11, 0xb0,
+    0x18, 0x9d, 0x2, 0x60, 0x3a, 0x2, 0xa0, 0x15,
+    0xb, 0x4, 0x0, 0xb1, 0x4, 0x80, 0x0, 0xb,
+    0x0, 0x8, 0x30, 0x6, 0x70, 0x0, 0xb, 0x0,
+    0x63, 0x14, 0x2c, 0x30, 0x0, 0xb, 0x4, 0x0,
+    0x3, 0xf8, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7279 "特" */
+    0x0, 0x4, 0x0, 0x0, 0x51, 0x0, 0x0, 0x0,
+    0xc, 0x10, 0x0, 0xc0, 0x0, 0x0, 0x7, 0x3c,
+    0x0, 0x55, 0xd5, 0x6b, 0x0, 0xb, 0x1c, 0x0,
+    0x10, 0xc0, 0x0, 0x0, 0xc, 0x5d, 0x6a, 0x0,
+    0xc0, 0x0, 0x20, 0x26, 0xc, 0x5, 0x55, 0x95,
+    0x56, 0xa1, 0x40, 0xc, 0x2, 0x0, 0x0, 0xd0,
+    0x0, 0x0, 0xc, 0x75, 0x55, 0x55, 0xd5, 0xc2,
+    0x18, 0xbd, 0x0, 0x30, 0x0, 0xc0, 0x0, 0x7,
+    0xc, 0x0, 0x66, 0x0, 0xc0, 0x0, 0x0, 0xc,
+    0x0, 0x1c, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x0,
+    0x2, 0x11, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x5e, 0x70, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1,
+    0x0, 0x0,
+
+    /* U+72AC "犬" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe2, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe0, 0x4a, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0xd0, 0x8, 0x90, 0x0, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0x30, 0x30, 0x6, 0x55, 0x56, 0xd7, 0x55,
+    0x57, 0x91, 0x0, 0x0, 0x4, 0x95, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0x65, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0x11, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0x0, 0x74, 0x0, 0x0, 0x0, 0x0,
+    0xb2, 0x0, 0xc, 0x30, 0x0, 0x0, 0xa, 0x40,
+    0x0, 0x1, 0xe8, 0x10, 0x3, 0x81, 0x0, 0x0,
+    0x0, 0x1c, 0xb1, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+72AF "犯" */
+    0x1, 0x10, 0xb, 0x21, 0x0, 0x3, 0x0, 0x0,
+    0x54, 0x88, 0xd, 0x55, 0x5d, 0x20, 0x0, 0xa,
+    0x80, 0xc, 0x0, 0xc, 0x0, 0x0, 0x47, 0x80,
+    0xc, 0x0, 0xc, 0x0, 0x5, 0x40, 0xb0, 0xc,
+    0x0, 0xc, 0x0, 0x0, 0x3, 0xf0, 0xc, 0x0,
+    0xc, 0x0, 0x0, 0xa, 0xa2, 0xc, 0x5, 0x4d,
+    0x0, 0x0, 0x82, 0x93, 0xc, 0x1, 0xb7, 0x0,
+    0x6, 0x20, 0xa2, 0xc, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0xb1, 0xc, 0x0, 0x0, 0x60, 0x0, 0x0,
+    0xd0, 0xc, 0x0, 0x0, 0xb1, 0x1, 0x8d, 0x50,
+    0x8, 0xcb, 0xbb, 0xd2, 0x0, 0x3, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+72B6 "状" */
+    0x0, 0x0, 0x10, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0xe1, 0x0, 0xc2, 0x40, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0xc0, 0x4d, 0x0, 0x6, 0x20, 0xc0,
+    0x0, 0xc0, 0x8, 0x0, 0x1, 0xe0, 0xc0, 0x0,
+    0xc0, 0x0, 0x70, 0x0, 0x91, 0xc5, 0x65, 0xd8,
+    0x55, 0x61, 0x0, 0x0, 0xc0, 0x0, 0xc6, 0x0,
+    0x0, 0x0, 0x6, 0xc0, 0x1, 0xa5, 0x10, 0x0,
+    0x2, 0xa1, 0xc0, 0x5, 0x71, 0x70, 0x0, 0xd,
+    0x20, 0xc0, 0xa, 0x10, 0xb0, 0x0, 0x0, 0x0,
+    0xc0, 0x1a, 0x0, 0x6a, 0x0, 0x0, 0x0, 0xc0,
+    0x91, 0x0, 0xd, 0x90, 0x0, 0x0, 0xd5, 0x30,
+    0x0, 0x2, 0xc4, 0x0, 0x0, 0x21, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+72C0 "狀" */
+    0x0, 0x0, 0x10, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x40, 0xb2, 0x0, 0xb3, 0x30, 0x0, 0x0, 0xc0,
+    0xb0, 0x0, 0xb1, 0x3a, 0x0, 0x0, 0xb0, 0xb0,
+    0x0, 0xb1, 0x8, 0x0, 0x0, 0xb0, 0xb1, 0x22,
+    0xb3, 0x23, 0x90, 0x2, 0x95, 0xc1, 0x32, 0xc7,
+    0x22, 0x20, 0x0, 0x0, 0xb0, 0x0, 0xb7, 0x0,
+    0x0, 0x3, 0x55, 0xc0, 0x0, 0xb6, 0x20, 0x0,
+    0x0, 0x82, 0xb0, 0x4, 0x72, 0x80, 0x0, 0x0,
+    0xa0, 0xb0, 0x9, 0x20, 0xb1, 0x0, 0x0, 0x90,
+    0xb0, 0x1a, 0x0, 0x5b, 0x0, 0x5, 0x30, 0xb0,
+    0x91, 0x0, 0xb, 0xa0, 0x5, 0x0, 0xb5, 0x30,
+    0x0, 0x1, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+72EC "独" */
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x3,
+    0x20, 0x79, 0x0, 0xd, 0x0, 0x0, 0x0, 0x76,
+    0xb0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x1e, 0x30,
+    0x85, 0x5d, 0x59, 0x20, 0x1, 0x85, 0x60, 0xc0,
+    0xc, 0xc, 0x0, 0x15, 0x3, 0xb0, 0xc0, 0xc,
+    0xc, 0x0, 0x0, 0xb, 0xc0, 0xc0, 0xc, 0xc,
+    0x0, 0x0, 0x57, 0xb0, 0xc0, 0xc, 0xc, 0x0,
+    0x1, 0xa0, 0xc0, 0xd5, 0x5d, 0x5c, 0x0, 0x7,
+    0x0, 0xc0, 0x10, 0xc, 0x2, 0x0, 0x10, 0x0,
+    0xd0, 0x0, 0xc, 0x8, 0x20, 0x0, 0x2, 0xb1,
+    0x24, 0x5d, 0x65, 0xd0, 0x0, 0x8e, 0x35, 0xc7,
+    0x30, 0x0, 0x90, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+72ED "狭" */
+    0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x3,
+    0x0, 0xb1, 0x4, 0xa0, 0x0, 0x0, 0x1, 0x87,
+    0x50, 0x3, 0x80, 0x2, 0x0, 0x0, 0x7a, 0x6,
+    0x57, 0xa5, 0x5a, 0x20, 0x4, 0x5a, 0x2, 0x3,
+    0x80, 0x62, 0x0, 0x22, 0xa, 0x31, 0xb4, 0x70,
+    0xb1, 0x0, 0x0, 0x2e, 0x50, 0xc5, 0x75, 0x20,
+    0x0, 0x0, 0x95, 0x85, 0x68, 0x96, 0x59, 0x90,
+    0x6, 0x33, 0x81, 0x8, 0x44, 0x0, 0x0, 0x32,
+    0x4, 0x80, 0xc, 0x7, 0x0, 0x0, 0x0, 0x6,
+    0x70, 0x56, 0x4, 0x70, 0x0, 0x3, 0x4c, 0x22,
+    0xa0, 0x0, 0x98, 0x0, 0x0, 0xa5, 0x56, 0x0,
+    0x0, 0x9, 0x90, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+732B "猫" */
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x10, 0x0, 0x4,
+    0x0, 0x67, 0xc, 0x20, 0xe1, 0x0, 0x0, 0x75,
+    0xb0, 0xc, 0x0, 0xc0, 0x10, 0x0, 0x1e, 0x26,
+    0x5d, 0x55, 0xd5, 0xb1, 0x1, 0x84, 0x60, 0xc,
+    0x0, 0xc0, 0x0, 0x4, 0x3, 0xb0, 0x7, 0x0,
+    0x61, 0x0, 0x0, 0xa, 0xb1, 0xb5, 0x77, 0x5a,
+    0x60, 0x0, 0x46, 0xb1, 0x90, 0x56, 0x7, 0x40,
+    0x1, 0x80, 0xb1, 0x90, 0x56, 0x7, 0x40, 0x15,
+    0x0, 0xb1, 0xb5, 0x99, 0x5a, 0x40, 0x10, 0x0,
+    0xc1, 0x90, 0x56, 0x7, 0x40, 0x1, 0x37, 0x81,
+    0xb5, 0x99, 0x5a, 0x40, 0x0, 0x4c, 0x1, 0x80,
+    0x0, 0x4, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+733F "猿" */
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x3,
+    0x0, 0x83, 0x0, 0xc2, 0x1, 0x0, 0x1, 0x74,
+    0xb1, 0x65, 0xd5, 0x69, 0x0, 0x0, 0x3e, 0x0,
+    0x0, 0xc0, 0x0, 0x50, 0x1, 0x8a, 0x26, 0x55,
+    0x65, 0x55, 0x60, 0x15, 0x7, 0x50, 0xb5, 0x55,
+    0x5c, 0x0, 0x0, 0xd, 0x80, 0xb0, 0x0, 0xb,
+    0x0, 0x0, 0x66, 0xa0, 0xd5, 0x76, 0x5b, 0x0,
+    0x1, 0x81, 0xb0, 0x29, 0x46, 0x4, 0xb0, 0x7,
+    0x2, 0xb0, 0x68, 0x8, 0x67, 0x0, 0x10, 0x4,
+    0xa5, 0x97, 0x1, 0xc0, 0x0, 0x0, 0x8, 0x80,
+    0x46, 0x42, 0x5c, 0x30, 0x1, 0x9e, 0x0, 0x5c,
+    0x20, 0x4, 0xb2, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x0,
+
+    /* U+7372 "獲" */
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x10, 0x0, 0x2,
+    0x0, 0x63, 0x9, 0x20, 0xa3, 0x40, 0x2, 0x82,
+    0xb4, 0x6b, 0x65, 0xb6, 0x61, 0x0, 0x2e, 0x10,
+    0x55, 0x37, 0x30, 0x0, 0x0, 0x9a, 0x10, 0xd6,
+    0x5a, 0x58, 0x50, 0x6, 0x16, 0x56, 0xc3, 0x3c,
+    0x38, 0x0, 0x0, 0xb, 0x93, 0xb2, 0x2b, 0x27,
+    0x0, 0x0, 0x48, 0xa0, 0xc5, 0x5c, 0x55, 0x40,
+    0x0, 0x90, 0xb0, 0xc5, 0x56, 0x55, 0x60, 0x7,
+    0x10, 0xb0, 0x66, 0x55, 0x7b, 0x0, 0x11, 0x1,
+    0xa0, 0x5, 0x31, 0xb2, 0x0, 0x0, 0x4, 0x80,
+    0x0, 0x9d, 0x20, 0x0, 0x1, 0x8d, 0x30, 0x17,
+    0x86, 0xb7, 0x52, 0x0, 0x25, 0x14, 0x40, 0x0,
+    0x4, 0x50,
+
+    /* U+73A9 "玩" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0x55, 0x6a, 0x15, 0x55, 0x59, 0x50, 0x1, 0xd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x0, 0x0,
+    0x0, 0x0, 0x31, 0x5, 0x5e, 0x95, 0x68, 0x75,
+    0xa5, 0x85, 0x0, 0xd, 0x0, 0x8, 0x40, 0xc0,
+    0x0, 0x0, 0xd, 0x0, 0xa, 0x20, 0xc0, 0x0,
+    0x0, 0xd, 0x0, 0xc, 0x0, 0xc0, 0x0, 0x0,
+    0xd, 0x34, 0x1b, 0x0, 0xc0, 0x0, 0x16, 0x99,
+    0x20, 0x75, 0x0, 0xc0, 0x22, 0x9, 0x10, 0x3,
+    0xa0, 0x0, 0xc0, 0x44, 0x0, 0x0, 0x57, 0x0,
+    0x0, 0xba, 0xd8, 0x0, 0x2, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+73FE "現" */
+    0x4, 0x55, 0x68, 0x85, 0x55, 0x58, 0x30, 0x1,
+    0xb, 0x0, 0xb0, 0x0, 0x8, 0x20, 0x0, 0xb,
+    0x0, 0xb5, 0x55, 0x5a, 0x20, 0x0, 0xb, 0x0,
+    0xb0, 0x0, 0x8, 0x20, 0x0, 0xb, 0x23, 0xb4,
+    0x44, 0x4a, 0x20, 0x4, 0x6c, 0x53, 0xb0, 0x0,
+    0x8, 0x20, 0x0, 0xb, 0x0, 0xb5, 0x55, 0x5a,
+    0x20, 0x0, 0xb, 0x0, 0x82, 0xb0, 0xa4, 0x10,
+    0x0, 0xb, 0x1, 0x6, 0x60, 0xa0, 0x0, 0x1,
+    0x4d, 0x53, 0xc, 0x10, 0xa0, 0x40, 0x1c, 0x60,
+    0x0, 0x76, 0x0, 0xa0, 0x70, 0x0, 0x0, 0x7,
+    0x50, 0x0, 0xca, 0xd4, 0x0, 0x0, 0x30, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+7403 "球" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0x18, 0x10, 0x6, 0x57,
+    0x77, 0x0, 0x1b, 0x6, 0x60, 0x0, 0x1a, 0x2,
+    0x55, 0x6c, 0x55, 0xc4, 0x0, 0x1a, 0x0, 0x0,
+    0x1d, 0x0, 0x0, 0x0, 0x1a, 0x13, 0x70, 0x1e,
+    0x11, 0xb0, 0x5, 0x6c, 0x64, 0x96, 0x1b, 0x69,
+    0x30, 0x0, 0x1a, 0x0, 0x12, 0x1b, 0x91, 0x0,
+    0x0, 0x1a, 0x0, 0x2, 0x7b, 0x38, 0x0, 0x0,
+    0x1c, 0x65, 0x87, 0x1b, 0xb, 0x60, 0xa, 0xb4,
+    0x8, 0x50, 0x1b, 0x1, 0xe7, 0x4, 0x0, 0x0,
+    0x1, 0x2a, 0x0, 0x10, 0x0, 0x0, 0x0, 0x5,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20,
+    0x0, 0x0,
+
+    /* U+7406 "理" */
+    0x0, 0x0, 0x0, 0x53, 0x33, 0x37, 0x10, 0x6,
+    0x58, 0x85, 0xb1, 0x1b, 0x1b, 0x0, 0x0, 0xb,
+    0x0, 0xa0, 0xa, 0xa, 0x0, 0x0, 0xb, 0x0,
+    0xb5, 0x5c, 0x5c, 0x0, 0x0, 0xb, 0x21, 0xa0,
+    0xa, 0xa, 0x0, 0x6, 0x6d, 0x74, 0xb0, 0xa,
+    0xa, 0x0, 0x0, 0xb, 0x0, 0xb5, 0x5c, 0x5a,
+    0x0, 0x0, 0xb, 0x0, 0x0, 0xa, 0x0, 0x0,
+    0x0, 0xc, 0x54, 0x55, 0x5c, 0x5a, 0x20, 0x7,
+    0xb8, 0x10, 0x0, 0xa, 0x0, 0x0, 0x6, 0x0,
+    0x0, 0x0, 0xa, 0x0, 0x40, 0x0, 0x0, 0x36,
+    0x55, 0x56, 0x55, 0x71,
+
+    /* U+74B0 "環" */
+    0x0, 0x0, 0x40, 0x75, 0x55, 0x57, 0x40, 0x6,
+    0x6b, 0x52, 0xa0, 0x90, 0x95, 0x30, 0x0, 0x19,
+    0x0, 0xc5, 0xa5, 0xa8, 0x30, 0x0, 0x19, 0x0,
+    0x20, 0x0, 0x0, 0x40, 0x4, 0x6b, 0xa6, 0x55,
+    0x55, 0x55, 0x50, 0x1, 0x29, 0x0, 0x85, 0x55,
+    0x5b, 0x0, 0x0, 0x19, 0x0, 0xa1, 0x0, 0x9,
+    0x0, 0x0, 0x19, 0x0, 0xa6, 0xb7, 0x58, 0x20,
+    0x0, 0x1a, 0x52, 0xa, 0x37, 0x16, 0x90, 0x9,
+    0xb6, 0x0, 0x8d, 0x1, 0xc2, 0x0, 0x3, 0x0,
+    0x26, 0x1b, 0x14, 0x2c, 0x60, 0x0, 0x0, 0x0,
+    0xc, 0x80, 0x1, 0x70, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x0,
+
+    /* U+7518 "甘" */
+    0x0, 0x0, 0x40, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x0, 0xe0, 0x0, 0xc, 0x20, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0xc, 0x2, 0x80, 0x6, 0x55, 0xd5, 0x55,
+    0x5d, 0x55, 0x51, 0x0, 0x0, 0xc0, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0x0, 0xd5, 0x55, 0x5d, 0x0, 0x0,
+    0x0, 0x0, 0xc0, 0x0, 0xc, 0x0, 0x0, 0x0,
+    0x0, 0xc0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xe5,
+    0x55, 0x5d, 0x0, 0x0, 0x0, 0x0, 0xd0, 0x0,
+    0xb, 0x10, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+751A "甚" */
+    0x0, 0x0, 0x40, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x0, 0xc0, 0x0, 0xc, 0x10, 0x0, 0x2, 0x65,
+    0xd5, 0x55, 0x5d, 0x5a, 0x50, 0x0, 0x0, 0xc0,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xc5, 0x55,
+    0x5d, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0x0, 0xc5, 0x55, 0x5d, 0x0,
+    0x0, 0x0, 0x0, 0xc0, 0x0, 0xc, 0x0, 0x20,
+    0x17, 0x5a, 0x85, 0x55, 0x58, 0x55, 0x91, 0x0,
+    0xc, 0x1, 0xc0, 0x35, 0x0, 0x0, 0x0, 0xc,
+    0x9, 0x40, 0x7, 0xb0, 0x0, 0x0, 0xc, 0x64,
+    0x0, 0x0, 0x90, 0x0, 0x0, 0xe, 0x75, 0x55,
+    0x55, 0x5d, 0x30, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+751F "生" */
+    0x0, 0x0, 0x0, 0x12, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x10, 0x2c, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0x80, 0x2a, 0x0, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0x2a, 0x0, 0x5, 0x0, 0x0, 0x49, 0x55, 0x6c,
+    0x55, 0x58, 0x30, 0x0, 0x90, 0x0, 0x2a, 0x0,
+    0x0, 0x0, 0x2, 0x50, 0x0, 0x2a, 0x0, 0x0,
+    0x0, 0x5, 0x0, 0x0, 0x2a, 0x0, 0x54, 0x0,
+    0x0, 0x5, 0x55, 0x6c, 0x55, 0x54, 0x0, 0x0,
+    0x0, 0x0, 0x2a, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2a, 0x0, 0x0, 0x60, 0x6, 0x55, 0x55, 0x56,
+    0x55, 0x56, 0x72,
+
+    /* U+7522 "產" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0x40, 0x0, 0x40, 0x0, 0x55, 0x67,
+    0x55, 0x6d, 0x65, 0x0, 0x0, 0x0, 0x27, 0x89,
+    0x30, 0x0, 0x0, 0x0, 0x25, 0x65, 0xb4, 0x0,
+    0x0, 0x7, 0x67, 0x55, 0x56, 0xb5, 0xc2, 0x0,
+    0xc0, 0x23, 0x7, 0x10, 0x0, 0x0, 0xb, 0x8,
+    0x60, 0xb0, 0x1, 0x0, 0x0, 0xb0, 0xc5, 0x5c,
+    0x55, 0x84, 0x0, 0xa, 0x62, 0x0, 0xb0, 0x1,
+    0x0, 0x2, 0x72, 0x46, 0x5c, 0x55, 0x80, 0x0,
+    0x61, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x6, 0x15,
+    0x55, 0x5c, 0x55, 0x5a, 0x71, 0x0, 0x10, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+7523 "産" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0x50, 0x0, 0x60, 0x0, 0x55, 0x75,
+    0x55, 0x76, 0x56, 0x10, 0x0, 0x2, 0x90, 0x8,
+    0x60, 0x0, 0x0, 0x20, 0x8, 0x0, 0x70, 0x4,
+    0x0, 0xc, 0x55, 0x55, 0x85, 0x55, 0x62, 0x0,
+    0xb0, 0x57, 0xb, 0x10, 0x0, 0x0, 0xb, 0xa,
+    0x30, 0xb0, 0x2, 0x50, 0x0, 0xb1, 0xa5, 0x5c,
+    0x55, 0x54, 0x0, 0x19, 0x60, 0x0, 0xb0, 0x5,
+    0x0, 0x4, 0x60, 0x36, 0x5c, 0x55, 0x51, 0x0,
+    0x70, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x6, 0x15,
+    0x55, 0x5c, 0x55, 0x5b, 0x51, 0x0, 0x10, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+7528 "用" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x65, 0x55, 0x75, 0x55, 0xd1, 0x0, 0x83, 0x0,
+    0xa, 0x0, 0xc, 0x0, 0x8, 0x30, 0x0, 0xa0,
+    0x0, 0xc0, 0x0, 0x87, 0x55, 0x5c, 0x55, 0x5c,
+    0x0, 0x8, 0x30, 0x0, 0xa0, 0x0, 0xc0, 0x0,
+    0x93, 0x0, 0xa, 0x0, 0xc, 0x0, 0x9, 0x20,
+    0x0, 0xa0, 0x0, 0xc0, 0x0, 0xb5, 0x55, 0x5c,
+    0x55, 0x5c, 0x0, 0xc, 0x0, 0x0, 0xa0, 0x0,
+    0xc0, 0x2, 0x80, 0x0, 0x1a, 0x0, 0xc, 0x0,
+    0x71, 0x0, 0x1, 0xa0, 0x22, 0xd0, 0x6, 0x0,
+    0x0, 0x17, 0x3, 0xc9, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x0,
+
+    /* U+7530 "田" */
+    0x10, 0x0, 0x0, 0x0, 0x10, 0xc5, 0x55, 0xa6,
+    0x55, 0xa6, 0xc0, 0x0, 0xa1, 0x0, 0x84, 0xc0,
+    0x0, 0xa1, 0x0, 0x84, 0xc0, 0x0, 0xa1, 0x0,
+    0x84, 0xc5, 0x55, 0xc6, 0x55, 0xa4, 0xc0, 0x0,
+    0xa1, 0x0, 0x84, 0xc0, 0x0, 0xa1, 0x0, 0x84,
+    0xc0, 0x0, 0xa1, 0x0, 0x84, 0xc0, 0x0, 0xa1,
+    0x0, 0x84, 0xc5, 0x55, 0x55, 0x55, 0xa4, 0x40,
+    0x0, 0x0, 0x0, 0x20,
+
+    /* U+7531 "由" */
+    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0xa1, 0x0, 0x0,
+    0x2, 0x0, 0xa, 0x10, 0x0, 0x40, 0xc5, 0x55,
+    0xc6, 0x55, 0x5e, 0x1c, 0x0, 0xa, 0x10, 0x0,
+    0xc0, 0xc0, 0x0, 0xa1, 0x0, 0xc, 0xc, 0x0,
+    0xa, 0x10, 0x0, 0xc0, 0xc5, 0x55, 0xc6, 0x55,
+    0x5c, 0xc, 0x0, 0xa, 0x10, 0x0, 0xc0, 0xc0,
+    0x0, 0xa1, 0x0, 0xc, 0xc, 0x0, 0xa, 0x10,
+    0x0, 0xc0, 0xc5, 0x55, 0x55, 0x55, 0x5c, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+7533 "申" */
+    0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0, 0xc2,
+    0x0, 0x0, 0x20, 0x0, 0xb0, 0x0, 0x30, 0xc5,
+    0x55, 0xc5, 0x55, 0xd3, 0xc0, 0x0, 0xb0, 0x0,
+    0xb0, 0xc5, 0x55, 0xc5, 0x55, 0xc0, 0xc0, 0x0,
+    0xb0, 0x0, 0xb0, 0xc0, 0x0, 0xb0, 0x0, 0xb0,
+    0xc5, 0x55, 0xc5, 0x55, 0xc1, 0xb0, 0x0, 0xb0,
+    0x0, 0x70, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xb1, 0x0,
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0,
+
+    /* U+7535 "电" */
+    0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0,
+    0x0, 0x0, 0xa5, 0x55, 0xd5, 0x55, 0xb4, 0x0,
+    0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0,
+    0xc0, 0x0, 0xc0, 0x0, 0xc5, 0x55, 0xd5, 0x55,
+    0xd0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0,
+    0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xd5, 0x55,
+    0xd5, 0x55, 0xa0, 0x10, 0x30, 0x0, 0xc0, 0x0,
+    0x0, 0x50, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xa0,
+    0x0, 0x0, 0x8b, 0xaa, 0xab, 0xd0,
+
+    /* U+7537 "男" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0xc5,
+    0x55, 0xa5, 0x5c, 0x20, 0x0, 0xb0, 0x1, 0xa0,
+    0xb, 0x0, 0x0, 0xc5, 0x55, 0xc5, 0x5c, 0x0,
+    0x0, 0xb0, 0x1, 0xa0, 0xb, 0x0, 0x0, 0xd5,
+    0x55, 0xc5, 0x5c, 0x10, 0x0, 0x80, 0x1, 0x80,
+    0x5, 0x0, 0x0, 0x0, 0x3, 0xa0, 0x0, 0x30,
+    0x6, 0x55, 0x59, 0x95, 0x55, 0xe1, 0x0, 0x0,
+    0xa, 0x20, 0x1, 0xb0, 0x0, 0x0, 0x3a, 0x0,
+    0x4, 0x80, 0x0, 0x4, 0xa0, 0x4, 0x8, 0x40,
+    0x4, 0x86, 0x0, 0x1, 0xdc, 0x0, 0x31, 0x0,
+    0x0, 0x0, 0x10, 0x0,
+
+    /* U+753A "町" */
+    0x0, 0x0, 0x10, 0x0, 0x0, 0x24, 0xb, 0x5a,
+    0x5c, 0x56, 0x5b, 0x65, 0x50, 0xb0, 0xb0, 0xa0,
+    0x0, 0xa2, 0x0, 0xb, 0xb, 0xa, 0x0, 0xa,
+    0x20, 0x0, 0xb0, 0xb0, 0xa0, 0x0, 0xa2, 0x0,
+    0xb, 0x5c, 0x5c, 0x0, 0xa, 0x20, 0x0, 0xb0,
+    0xb0, 0xa0, 0x0, 0xa2, 0x0, 0xb, 0xb, 0xa,
+    0x0, 0xa, 0x20, 0x0, 0xb0, 0xb0, 0xa0, 0x0,
+    0xa2, 0x0, 0xc, 0x55, 0x5c, 0x10, 0xa, 0x20,
+    0x0, 0x60, 0x0, 0x0, 0x0, 0xa2, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xae, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x20, 0x0, 0x0,
+
+    /* U+753B "画" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x65,
+    0x55, 0x55, 0x55, 0x59, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x85, 0x56, 0x59,
+    0x40, 0x0, 0x1, 0xc, 0x0, 0xa0, 0xb0, 0x8,
+    0x1, 0xb0, 0xb0, 0xa, 0xb, 0x0, 0xb0, 0x1a,
+    0xc, 0x55, 0xc5, 0xc0, 0xb, 0x1, 0xa0, 0xb0,
+    0xa, 0xb, 0x0, 0xb0, 0x1a, 0xb, 0x0, 0xa0,
+    0xb0, 0xb, 0x1, 0xa0, 0xb0, 0xa, 0xb, 0x0,
+    0xb0, 0x1a, 0xc, 0x55, 0x55, 0xa0, 0xb, 0x3,
+    0xb5, 0x55, 0x55, 0x55, 0x55, 0xb0, 0x3, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0x0,
+
+    /* U+754C "界" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x55, 0x57, 0x55, 0x97, 0x0, 0x0, 0xb,
+    0x0, 0x19, 0x0, 0x74, 0x0, 0x0, 0xc, 0x55,
+    0x6b, 0x55, 0x94, 0x0, 0x0, 0xb, 0x0, 0x19,
+    0x0, 0x74, 0x0, 0x0, 0xc, 0x55, 0xb7, 0x75,
+    0x94, 0x0, 0x0, 0x1, 0x7, 0x70, 0x34, 0x0,
+    0x0, 0x0, 0x0, 0x7b, 0x0, 0x7, 0x93, 0x0,
+    0x0, 0x29, 0x4a, 0x40, 0x2b, 0x2a, 0xe3, 0x4,
+    0x30, 0xc, 0x0, 0x1a, 0x0, 0x0, 0x0, 0x0,
+    0x2a, 0x0, 0x1a, 0x0, 0x0, 0x0, 0x1, 0xa1,
+    0x0, 0x1a, 0x0, 0x0, 0x0, 0x46, 0x0, 0x0,
+    0x2a, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7559 "留" */
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x22,
+    0x69, 0x80, 0x0, 0x0, 0x40, 0xc, 0x20, 0x0,
+    0x6a, 0x95, 0x6b, 0x0, 0xb0, 0x17, 0x10, 0x93,
+    0x3, 0x80, 0xb, 0x1, 0x7d, 0x1b, 0x0, 0x56,
+    0x1, 0xd9, 0x60, 0x49, 0x22, 0x6b, 0x30, 0x7,
+    0x0, 0x16, 0x20, 0x3, 0x70, 0x0, 0x59, 0x55,
+    0x59, 0x55, 0x6c, 0x0, 0x4, 0x80, 0x1, 0xb0,
+    0x1, 0xa0, 0x0, 0x4a, 0x55, 0x6c, 0x55, 0x6a,
+    0x0, 0x4, 0x80, 0x1, 0xb0, 0x1, 0xa0, 0x0,
+    0x48, 0x0, 0x1b, 0x0, 0x1b, 0x0, 0x5, 0xa5,
+    0x55, 0x65, 0x56, 0xb0, 0x0, 0x11, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+756A "番" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0,
+    0x0, 0x24, 0x79, 0xbb, 0x10, 0x0, 0x36, 0x64,
+    0xa2, 0x9, 0x10, 0x0, 0x0, 0xb, 0x9, 0x24,
+    0x60, 0x0, 0x6, 0x55, 0x88, 0xc8, 0x75, 0x57,
+    0x40, 0x0, 0x4, 0x99, 0x27, 0x0, 0x0, 0x0,
+    0x6, 0x60, 0x92, 0x9, 0x71, 0x0, 0x26, 0x40,
+    0x8, 0x10, 0x8, 0xd7, 0x11, 0xb, 0x55, 0x97,
+    0x55, 0xd2, 0x0, 0x0, 0xb0, 0x7, 0x40, 0xb,
+    0x0, 0x0, 0xb, 0x55, 0xa7, 0x55, 0xc0, 0x0,
+    0x0, 0xb0, 0x7, 0x40, 0xb, 0x0, 0x0, 0xb,
+    0x55, 0x55, 0x55, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+756B "畫" */
+    0x0, 0x0, 0x0, 0x12, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2b, 0x0, 0x30, 0x0, 0x0, 0x6,
+    0x55, 0x6b, 0x55, 0xd1, 0x20, 0x3, 0x65, 0x55,
+    0x6b, 0x55, 0xc5, 0x70, 0x0, 0x7, 0x55, 0x6b,
+    0x55, 0xc0, 0x0, 0x0, 0x5, 0x55, 0x6b, 0x55,
+    0x76, 0x0, 0x0, 0x23, 0x22, 0x3a, 0x22, 0x25,
+    0x20, 0x0, 0x45, 0x33, 0x33, 0x33, 0x53, 0x10,
+    0x0, 0xd, 0x55, 0x6b, 0x55, 0xb4, 0x0, 0x0,
+    0xc, 0x55, 0x6b, 0x55, 0xb1, 0x0, 0x0, 0xb,
+    0x0, 0x29, 0x0, 0xa1, 0x0, 0x0, 0xc, 0x55,
+    0x55, 0x55, 0x91, 0x10, 0x5, 0x55, 0x55, 0x55,
+    0x55, 0x58, 0xe1, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7570 "異" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x55, 0x57, 0x55, 0xa5, 0x0, 0x0, 0xb0, 0x0,
+    0xb0, 0x9, 0x10, 0x0, 0xc, 0x55, 0x5c, 0x55,
+    0xb1, 0x0, 0x0, 0xb0, 0x0, 0xb0, 0x9, 0x10,
+    0x0, 0xd, 0x55, 0x58, 0x55, 0xb2, 0x0, 0x0,
+    0x21, 0xb0, 0x8, 0x20, 0x0, 0x0, 0x65, 0x6c,
+    0x55, 0xa6, 0x5a, 0x10, 0x0, 0x1, 0xa0, 0x8,
+    0x10, 0x0, 0x3, 0x55, 0x6c, 0x55, 0xa6, 0x57,
+    0x80, 0x10, 0x0, 0x91, 0x4, 0x30, 0x0, 0x0,
+    0x4, 0xb7, 0x10, 0x4, 0xb5, 0x0, 0x37, 0x50,
+    0x0, 0x0, 0x0, 0xb5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x10,
+
+    /* U+7576 "當" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x6,
+    0x10, 0x1b, 0x3, 0x70, 0x0, 0x0, 0x39, 0x0,
+    0xa0, 0x92, 0x0, 0x0, 0x75, 0x65, 0x5b, 0x67,
+    0x55, 0xa0, 0x29, 0x0, 0x0, 0x0, 0x10, 0x74,
+    0x6, 0x40, 0xb5, 0x55, 0x5c, 0x22, 0x0, 0x0,
+    0xb, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x0, 0xc5,
+    0x55, 0x5c, 0x0, 0x0, 0x0, 0x31, 0x0, 0x0,
+    0x2, 0x30, 0x0, 0x1c, 0x55, 0x5c, 0x55, 0xa7,
+    0x0, 0x1, 0xc5, 0x55, 0xc5, 0x5a, 0x40, 0x0,
+    0x1a, 0x0, 0xb, 0x0, 0x74, 0x0, 0x1, 0xc5,
+    0x55, 0xc5, 0x5a, 0x40, 0x0, 0x15, 0x0, 0x0,
+    0x0, 0x42, 0x0,
+
+    /* U+75B2 "疲" */
+    0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0x40, 0x0, 0x0, 0x0, 0x9,
+    0x55, 0x58, 0x85, 0x56, 0xc1, 0x2, 0xb, 0x0,
+    0x0, 0x91, 0x0, 0x0, 0x8, 0x2b, 0x6, 0x55,
+    0xd5, 0x58, 0x40, 0x5, 0x4b, 0xb, 0x0, 0xb0,
+    0x9, 0x20, 0x0, 0xb, 0xb, 0x0, 0xb0, 0x1,
+    0x0, 0x16, 0x7b, 0xb, 0x55, 0xb5, 0x79, 0x0,
+    0x15, 0xa, 0xb, 0x5, 0x0, 0xa3, 0x0, 0x0,
+    0x47, 0xb, 0x3, 0x44, 0x90, 0x0, 0x0, 0x92,
+    0x55, 0x0, 0x9b, 0x0, 0x0, 0x1, 0x80, 0x90,
+    0x4, 0x99, 0x83, 0x0, 0x6, 0x6, 0x13, 0x63,
+    0x0, 0x3a, 0xc1, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+75C5 "病" */
+    0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x75, 0x0, 0x0, 0x0, 0xc, 0x55,
+    0x56, 0x65, 0x58, 0x60, 0x60, 0xc0, 0x0, 0x0,
+    0x0, 0x20, 0x8, 0x3c, 0x26, 0x55, 0xb5, 0x58,
+    0x20, 0x10, 0xb0, 0x0, 0xd, 0x0, 0x0, 0x1,
+    0x6b, 0x9, 0x55, 0xd5, 0x5b, 0x22, 0xb1, 0xa0,
+    0xb0, 0x2a, 0x0, 0xc0, 0x0, 0x28, 0xb, 0x6,
+    0x86, 0xc, 0x0, 0x6, 0x40, 0xb0, 0xa0, 0x76,
+    0xc0, 0x0, 0x90, 0xb, 0x61, 0x1, 0x6c, 0x0,
+    0x26, 0x0, 0xb0, 0x0, 0x10, 0xc0, 0x6, 0x0,
+    0xb, 0x0, 0x3, 0xcc, 0x0, 0x0, 0x0, 0x10,
+    0x0, 0x0, 0x0,
+
+    /* U+75DB "痛" */
+    0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0x90, 0x0, 0x10, 0x0, 0x9,
+    0x55, 0x55, 0x85, 0x58, 0x90, 0x7, 0xa, 0x15,
+    0x55, 0x55, 0x57, 0x0, 0x7, 0x6a, 0x10, 0x3,
+    0x23, 0x85, 0x0, 0x3, 0x3a, 0x13, 0x0, 0xc3,
+    0x3, 0x0, 0x0, 0xb, 0x1c, 0x55, 0xc5, 0x5b,
+    0x30, 0x3, 0x8c, 0xb, 0x0, 0xb0, 0xa, 0x10,
+    0x3a, 0xb, 0xb, 0x55, 0xc5, 0x5b, 0x10, 0x0,
+    0x19, 0xb, 0x55, 0xc5, 0x5b, 0x10, 0x0, 0x73,
+    0xb, 0x0, 0xb0, 0xa, 0x10, 0x1, 0x80, 0xb,
+    0x0, 0xb0, 0x1a, 0x10, 0x6, 0x0, 0xb, 0x0,
+    0x90, 0x7d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+767A "発" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x65, 0x55, 0xd5, 0x12, 0xc1, 0x0, 0x0, 0x15,
+    0x7, 0x70, 0x76, 0x4, 0x10, 0x0, 0xa, 0x3a,
+    0x0, 0x54, 0x48, 0x20, 0x0, 0x3, 0xa0, 0x0,
+    0x8, 0xa1, 0x0, 0x0, 0x58, 0x55, 0x55, 0x58,
+    0xad, 0xb1, 0x4, 0x10, 0x1b, 0x0, 0xb0, 0x0,
+    0x10, 0x0, 0x0, 0xb, 0x0, 0xb0, 0x0, 0x0,
+    0x2, 0x55, 0x5c, 0x55, 0xc5, 0x58, 0x70, 0x0,
+    0x10, 0xb, 0x0, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x65, 0x0, 0xb0, 0x0, 0x30, 0x0, 0x3, 0x80,
+    0x0, 0xb0, 0x0, 0x70, 0x2, 0x64, 0x0, 0x0,
+    0x9a, 0x9b, 0xa0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+767C "發" */
+    0x0, 0x0, 0x4, 0x10, 0x21, 0x0, 0x0, 0x46,
+    0x59, 0xb2, 0x38, 0x11, 0x0, 0x3, 0x73, 0xa0,
+    0x5, 0x25, 0x70, 0x0, 0x7, 0x80, 0x0, 0x4,
+    0x91, 0x0, 0x36, 0x86, 0xa0, 0x18, 0x5a, 0x8a,
+    0x21, 0x0, 0xb, 0x2, 0x80, 0xb0, 0x0, 0x4,
+    0x22, 0xb0, 0x55, 0xc, 0x1, 0x0, 0xc2, 0x25,
+    0x8, 0x0, 0x69, 0x91, 0xd, 0x55, 0x93, 0x26,
+    0x46, 0xb0, 0x0, 0x30, 0xc, 0x1, 0x10, 0xa3,
+    0x0, 0x0, 0x2, 0xa0, 0x3, 0x98, 0x0, 0x0,
+    0x0, 0x57, 0x0, 0x57, 0x97, 0x0, 0x2, 0x9d,
+    0x22, 0x53, 0x0, 0xa4, 0x0, 0x1, 0x10, 0x10,
+    0x0, 0x0, 0x0,
+
+    /* U+767D "白" */
+    0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3e,
+    0x10, 0x0, 0x0, 0x0, 0x9, 0x20, 0x0, 0x0,
+    0x7, 0x56, 0x85, 0x55, 0x56, 0xc0, 0xa2, 0x0,
+    0x0, 0x0, 0x1a, 0x9, 0x20, 0x0, 0x0, 0x1,
+    0xa0, 0x92, 0x0, 0x0, 0x0, 0x1a, 0x9, 0x75,
+    0x55, 0x55, 0x56, 0xa0, 0x92, 0x0, 0x0, 0x0,
+    0x1a, 0x9, 0x20, 0x0, 0x0, 0x1, 0xa0, 0x92,
+    0x0, 0x0, 0x0, 0x1a, 0xa, 0x75, 0x55, 0x55,
+    0x56, 0xa0, 0xa2, 0x0, 0x0, 0x0, 0x19, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+767E "百" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x55,
+    0x55, 0x55, 0x55, 0x59, 0x90, 0x10, 0x0, 0xb,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x85, 0x77, 0x55, 0x5b, 0x0,
+    0x0, 0xd, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0,
+    0xd0, 0x0, 0x0, 0xd, 0x0, 0x0, 0xd, 0x0,
+    0x0, 0x0, 0xd0, 0x0, 0x0, 0xd5, 0x55, 0x55,
+    0x5d, 0x0, 0x0, 0xd, 0x0, 0x0, 0x0, 0xd0,
+    0x0, 0x0, 0xd0, 0x0, 0x0, 0xd, 0x0, 0x0,
+    0xd, 0x55, 0x55, 0x55, 0xd0, 0x0, 0x0, 0xd0,
+    0x0, 0x0, 0xd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+7684 "的" */
+    0x0, 0x11, 0x0, 0x1, 0x10, 0x0, 0x0, 0x5,
+    0x90, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x70, 0x0,
+    0xb, 0x30, 0x0, 0x1, 0xa7, 0x5b, 0x42, 0xd5,
+    0x56, 0xb0, 0x1b, 0x0, 0xb0, 0x92, 0x0, 0x3a,
+    0x0, 0xb0, 0xb, 0x35, 0x0, 0x3, 0x90, 0xb,
+    0x0, 0xb2, 0x25, 0x0, 0x39, 0x0, 0xc5, 0x5c,
+    0x0, 0xa3, 0x4, 0x90, 0xb, 0x0, 0xb0, 0x5,
+    0x40, 0x48, 0x0, 0xb0, 0xb, 0x0, 0x0, 0x5,
+    0x70, 0xb, 0x0, 0xb0, 0x0, 0x0, 0x66, 0x1,
+    0xc5, 0x5c, 0x0, 0x14, 0x2b, 0x40, 0x19, 0x0,
+    0x70, 0x0, 0x2d, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+7686 "皆" */
+    0x20, 0x0, 0x4, 0x0, 0x0, 0x0, 0xb1, 0x0,
+    0xb, 0x20, 0x57, 0x0, 0xb5, 0x5b, 0x2b, 0x8,
+    0x82, 0x0, 0xb0, 0x0, 0xb, 0x40, 0x0, 0x30,
+    0xb0, 0x35, 0x1b, 0x0, 0x0, 0x80, 0xdb, 0x41,
+    0x39, 0xa9, 0x99, 0xe1, 0x10, 0x4, 0x70, 0x11,
+    0x11, 0x0, 0x8, 0x59, 0x55, 0x55, 0xa0, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0xc0, 0x0, 0xd, 0x55,
+    0x55, 0x55, 0xc0, 0x0, 0xc, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc0, 0x0,
+    0xd, 0x55, 0x55, 0x55, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+76BF "皿" */
+    0x0, 0x75, 0x56, 0x55, 0x55, 0xa2, 0x0, 0x0,
+    0xc0, 0xb, 0x2, 0x90, 0xc0, 0x0, 0x0, 0xc0,
+    0xb, 0x2, 0x90, 0xc0, 0x0, 0x0, 0xc0, 0xb,
+    0x2, 0x90, 0xc0, 0x0, 0x0, 0xc0, 0xb, 0x2,
+    0x90, 0xc0, 0x0, 0x0, 0xc0, 0xb, 0x2, 0x90,
+    0xc0, 0x0, 0x0, 0xc0, 0xb, 0x2, 0x90, 0xc0,
+    0x0, 0x0, 0xc0, 0xb, 0x2, 0x90, 0xc0, 0x0,
+    0x0, 0xc0, 0xb, 0x2, 0x90, 0xc1, 0x40, 0x26,
+    0x65, 0x56, 0x55, 0x65, 0x66, 0x60,
+
+    /* U+76D7 "盗" */
+    0x0, 0x0, 0x0, 0x31, 0x0, 0x0, 0x0, 0x63,
+    0x0, 0xc, 0x60, 0x0, 0x0, 0x0, 0xd0, 0x44,
+    0xc5, 0x55, 0x84, 0x0, 0x1, 0x62, 0xa0, 0x62,
+    0x9, 0x20, 0x0, 0x38, 0x61, 0xd, 0x41, 0x0,
+    0x0, 0x6e, 0x10, 0x5, 0x87, 0x0, 0x0, 0x0,
+    0xb0, 0x0, 0xc1, 0x2a, 0x0, 0x0, 0x3b, 0x2,
+    0x92, 0x0, 0x6e, 0x40, 0x0, 0x31, 0x30, 0x0,
+    0x3, 0x30, 0x0, 0xc, 0x5c, 0x65, 0xc5, 0xb4,
+    0x0, 0x0, 0xb0, 0xa1, 0xb, 0x9, 0x10, 0x0,
+    0xb, 0xa, 0x10, 0xb0, 0x91, 0x0, 0x35, 0xc5,
+    0xc6, 0x5c, 0x5b, 0x8b, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+76EE "目" */
+    0x85, 0x55, 0x55, 0x5a, 0x1d, 0x0, 0x0, 0x0,
+    0xd0, 0xd0, 0x0, 0x0, 0xd, 0xd, 0x0, 0x0,
+    0x0, 0xd0, 0xd5, 0x55, 0x55, 0x5d, 0xd, 0x0,
+    0x0, 0x0, 0xd0, 0xd0, 0x0, 0x0, 0xd, 0xd,
+    0x55, 0x55, 0x55, 0xd0, 0xd0, 0x0, 0x0, 0xd,
+    0xd, 0x0, 0x0, 0x0, 0xd0, 0xd5, 0x55, 0x55,
+    0x5d, 0xc, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+76F4 "直" */
+    0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x69, 0x0, 0x2, 0x0, 0x4, 0x65,
+    0x55, 0xa8, 0x55, 0x5a, 0x40, 0x0, 0x1, 0x0,
+    0xa1, 0x0, 0x20, 0x0, 0x0, 0xc, 0x55, 0x75,
+    0x56, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x1,
+    0xa0, 0x0, 0x0, 0xc, 0x55, 0x55, 0x56, 0xa0,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0x1, 0xa0, 0x0,
+    0x0, 0xc, 0x55, 0x55, 0x56, 0xa0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x1, 0xa0, 0x0, 0x0, 0xc,
+    0x55, 0x55, 0x56, 0xa0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0x1, 0xa1, 0x60, 0x16, 0x56, 0x55, 0x55,
+    0x55, 0x65, 0x61,
+
+    /* U+76F8 "相" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa4, 0x0, 0x10, 0x0, 0x30, 0x0, 0x9, 0x10,
+    0xd, 0x55, 0x5d, 0x30, 0x0, 0x91, 0x20, 0xc0,
+    0x0, 0xc0, 0x6, 0x5d, 0x67, 0x4c, 0x0, 0xc,
+    0x0, 0x0, 0xf2, 0x0, 0xc5, 0x55, 0xd0, 0x0,
+    0x5f, 0x97, 0xc, 0x0, 0xc, 0x0, 0xa, 0xa1,
+    0xb0, 0xc0, 0x0, 0xc0, 0x3, 0x79, 0x10, 0xc,
+    0x55, 0x5d, 0x0, 0x80, 0x91, 0x0, 0xc0, 0x0,
+    0xc0, 0x31, 0xa, 0x10, 0xc, 0x0, 0xc, 0x0,
+    0x0, 0xa2, 0x0, 0xd5, 0x55, 0xd0, 0x0, 0xa,
+    0x20, 0xc, 0x0, 0xa, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+770B "看" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0,
+    0x0, 0x13, 0x57, 0x9b, 0xb5, 0x0, 0x1, 0x44,
+    0x43, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x65, 0x58,
+    0xb5, 0x55, 0xa4, 0x0, 0x0, 0x0, 0xb, 0x20,
+    0x0, 0x0, 0x40, 0x17, 0x55, 0x7b, 0x55, 0x55,
+    0x56, 0x92, 0x0, 0x0, 0xb1, 0x0, 0x0, 0x30,
+    0x0, 0x0, 0x7, 0xe5, 0x55, 0x55, 0xd0, 0x0,
+    0x0, 0x45, 0xc5, 0x55, 0x55, 0xc0, 0x0, 0x4,
+    0x40, 0xc0, 0x0, 0x0, 0xc0, 0x0, 0x11, 0x0,
+    0xc5, 0x55, 0x55, 0xc0, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xc5, 0x55,
+    0x55, 0xc0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x0,
+    0x60, 0x0,
+
+    /* U+771F "真" */
+    0x0, 0x0, 0x0, 0x14, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3b, 0x0, 0x1, 0x30, 0x0, 0x65,
+    0x55, 0x8a, 0x55, 0x56, 0x70, 0x0, 0x0, 0x0,
+    0x56, 0x0, 0x30, 0x0, 0x0, 0x1, 0xc5, 0x65,
+    0x56, 0xc0, 0x0, 0x0, 0x1, 0xc5, 0x55, 0x56,
+    0x90, 0x0, 0x0, 0x1, 0xb0, 0x0, 0x2, 0x90,
+    0x0, 0x0, 0x1, 0xc5, 0x55, 0x56, 0x90, 0x0,
+    0x0, 0x1, 0xc5, 0x55, 0x56, 0x90, 0x0, 0x0,
+    0x1, 0xb0, 0x0, 0x2, 0x90, 0x52, 0x6, 0x55,
+    0x6a, 0x55, 0x86, 0x65, 0x64, 0x0, 0x0, 0x89,
+    0x10, 0x8, 0x91, 0x0, 0x0, 0x28, 0x30, 0x0,
+    0x0, 0x5c, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x2, 0x0,
+
+    /* U+7720 "眠" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0,
+    0x30, 0xa5, 0x55, 0x5c, 0x20, 0xc5, 0x5c, 0xb,
+    0x0, 0x0, 0xc0, 0xb, 0x1, 0xa0, 0xb0, 0x0,
+    0xc, 0x0, 0xb0, 0x1a, 0xc, 0x59, 0x55, 0xd0,
+    0xc, 0x55, 0xa0, 0xb0, 0x91, 0x0, 0x0, 0xb0,
+    0x1a, 0xb, 0x8, 0x30, 0x37, 0xc, 0x55, 0xa0,
+    0xc4, 0x88, 0x44, 0x41, 0xb0, 0x1a, 0xb, 0x3,
+    0x90, 0x0, 0xb, 0x1, 0xa0, 0xb0, 0xc, 0x0,
+    0x3, 0xc5, 0x5b, 0xb, 0x23, 0x5a, 0x1, 0x5b,
+    0x0, 0x70, 0xe7, 0x0, 0x8b, 0x84, 0x0, 0x0,
+    0x8, 0x0, 0x0, 0x5e, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+773E "眾" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0xb, 0x55,
+    0xa5, 0x5b, 0x55, 0xd2, 0xb, 0x0, 0xa0, 0xe,
+    0x0, 0xb0, 0xb, 0x0, 0xa0, 0xe, 0x0, 0xb0,
+    0xb, 0x55, 0x55, 0x55, 0x55, 0x90, 0x0, 0x0,
+    0x0, 0x14, 0x7b, 0xb0, 0x4, 0x55, 0x6a, 0x94,
+    0x32, 0x10, 0x0, 0x46, 0x5, 0x50, 0x9, 0x0,
+    0x0, 0x93, 0x5, 0x50, 0x3a, 0x0, 0x0, 0xc7,
+    0x5, 0x50, 0x9a, 0x0, 0x8, 0x23, 0xc5, 0x52,
+    0x91, 0x80, 0x43, 0x0, 0x65, 0x77, 0x0, 0x78,
+    0x0, 0x0, 0x5, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x0, 0x0, 0x0,
+
+    /* U+7740 "着" */
+    0x0, 0x0, 0x20, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x0, 0x3b, 0x0, 0x67, 0x0, 0x0, 0x3, 0x55,
+    0x5c, 0x55, 0x95, 0x5c, 0x30, 0x1, 0x0, 0x0,
+    0xc0, 0x0, 0x20, 0x0, 0x0, 0x36, 0x58, 0xa5,
+    0x57, 0x90, 0x0, 0x0, 0x0, 0xb, 0x10, 0x0,
+    0x4, 0x40, 0x16, 0x55, 0xa8, 0x55, 0x55, 0x55,
+    0x40, 0x0, 0x3, 0xe5, 0x55, 0x55, 0xb0, 0x0,
+    0x0, 0x39, 0x92, 0x0, 0x0, 0xb0, 0x0, 0x4,
+    0x60, 0x96, 0x55, 0x55, 0xb0, 0x0, 0x21, 0x0,
+    0x96, 0x55, 0x55, 0xb0, 0x0, 0x0, 0x0, 0x92,
+    0x0, 0x0, 0xb0, 0x0, 0x0, 0x0, 0x96, 0x55,
+    0x55, 0xb0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0,
+    0x20, 0x0,
+
+    /* U+77E5 "知" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x47,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x96, 0x66,
+    0xb0, 0x95, 0x55, 0xc0, 0x0, 0x80, 0xc0, 0x0,
+    0xb0, 0x0, 0xb0, 0x5, 0x10, 0xc0, 0x0, 0xb0,
+    0x0, 0xb0, 0x1, 0x0, 0xc0, 0x62, 0xb0, 0x0,
+    0xb0, 0x6, 0x55, 0xd5, 0x53, 0xb0, 0x0, 0xb0,
+    0x0, 0x2, 0xc0, 0x0, 0xb0, 0x0, 0xb0, 0x0,
+    0x7, 0x59, 0x30, 0xb0, 0x0, 0xb0, 0x0, 0xb,
+    0x1, 0xd2, 0xc5, 0x55, 0xb0, 0x0, 0x82, 0x0,
+    0x64, 0xb0, 0x0, 0xb0, 0x6, 0x30, 0x0, 0x0,
+    0x50, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+77ED "短" */
+    0x0, 0x32, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x97, 0x0, 0x55, 0x55, 0x58, 0x60, 0x0, 0xc0,
+    0x1, 0x10, 0x0, 0x0, 0x0, 0x3, 0xba, 0x69,
+    0x0, 0x0, 0x1, 0x0, 0x8, 0x1c, 0x0, 0xc,
+    0x55, 0x5d, 0x0, 0x3, 0xc, 0x0, 0xb, 0x0,
+    0xb, 0x0, 0x3, 0x3d, 0x39, 0x2b, 0x0, 0xb,
+    0x0, 0x3, 0x2c, 0x22, 0x1c, 0x55, 0x5b, 0x0,
+    0x0, 0xd, 0x10, 0x6, 0x0, 0x34, 0x0, 0x0,
+    0x29, 0x83, 0x8, 0x0, 0xa5, 0x0, 0x0, 0x73,
+    0x1b, 0x7, 0x50, 0xa0, 0x0, 0x0, 0x90, 0x2,
+    0x3, 0x21, 0x50, 0x30, 0x6, 0x10, 0x5, 0x55,
+    0x56, 0x55, 0x91, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+77F3 "石" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x30, 0x6,
+    0x55, 0x59, 0xa5, 0x55, 0x55, 0x50, 0x0, 0x0,
+    0xc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xd5, 0x55, 0x55,
+    0xc3, 0x0, 0x0, 0x48, 0xc0, 0x0, 0x0, 0xc0,
+    0x0, 0x2, 0x70, 0xc0, 0x0, 0x0, 0xc0, 0x0,
+    0x24, 0x0, 0xc0, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0,
+    0xc5, 0x55, 0x55, 0xd0, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+7802 "砂" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0x0, 0xd, 0x0, 0x0, 0x7, 0x79,
+    0x67, 0x0, 0xb, 0x0, 0x0, 0x0, 0x74, 0x0,
+    0x27, 0xb, 0x22, 0x0, 0x0, 0xa0, 0x0, 0x68,
+    0xb, 0x9, 0x60, 0x0, 0xb0, 0x40, 0xa1, 0xc,
+    0x1, 0xe0, 0x5, 0xe5, 0xc3, 0x80, 0xc, 0x0,
+    0x20, 0x7, 0xb0, 0xa6, 0x10, 0xc, 0xa, 0x20,
+    0x21, 0xb0, 0xa2, 0x0, 0x8, 0x6c, 0x10, 0x0,
+    0xb0, 0xa0, 0x0, 0x4, 0xb0, 0x0, 0x0, 0xc5,
+    0xc1, 0x0, 0x5a, 0x0, 0x0, 0x0, 0xb0, 0x60,
+    0x18, 0x60, 0x0, 0x0, 0x0, 0x30, 0x25, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7814 "研" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x12, 0x56, 0x55, 0x58, 0x70, 0x6, 0x78,
+    0x65, 0x9, 0x20, 0xb0, 0x0, 0x0, 0x73, 0x0,
+    0x9, 0x20, 0xb0, 0x0, 0x0, 0xa0, 0x0, 0x9,
+    0x20, 0xb0, 0x0, 0x0, 0xe5, 0xa3, 0x9, 0x20,
+    0xb0, 0x20, 0x6, 0xe0, 0x94, 0x6b, 0x65, 0xc6,
+    0x90, 0x7, 0xb0, 0x92, 0xa, 0x10, 0xb0, 0x0,
+    0x20, 0xb0, 0x92, 0xb, 0x0, 0xb0, 0x0, 0x0,
+    0xb0, 0x92, 0x1b, 0x0, 0xb0, 0x0, 0x0, 0xc5,
+    0xb2, 0x74, 0x0, 0xb0, 0x0, 0x0, 0x70, 0x12,
+    0x70, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x26, 0x0,
+    0x0, 0xb1, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7834 "破" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0x0, 0x0, 0x6, 0x58,
+    0x86, 0x30, 0xb, 0x0, 0x40, 0x0, 0x38, 0x0,
+    0xa5, 0x5c, 0x58, 0xa0, 0x0, 0x74, 0x0, 0xa0,
+    0xb, 0x3, 0x0, 0x0, 0xb1, 0x50, 0xa0, 0xb,
+    0x0, 0x0, 0x3, 0xd3, 0xc1, 0xa5, 0x6a, 0x5c,
+    0x10, 0x8, 0xb0, 0xb0, 0xb0, 0x50, 0x1a, 0x0,
+    0x22, 0xb0, 0xb0, 0xb0, 0x60, 0x74, 0x0, 0x0,
+    0xb0, 0xb0, 0xa0, 0x17, 0xb0, 0x0, 0x0, 0xc5,
+    0xc5, 0x40, 0xb, 0x80, 0x0, 0x0, 0xb0, 0x68,
+    0x0, 0x85, 0x89, 0x30, 0x0, 0x50, 0x52, 0x56,
+    0x10, 0x5, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+78BA "確" */
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x3,
+    0x33, 0x74, 0x0, 0xd, 0x30, 0x0, 0x3, 0x75,
+    0x11, 0x46, 0x6c, 0x55, 0xa5, 0x0, 0x91, 0x0,
+    0xc0, 0x95, 0x10, 0x50, 0x0, 0xb0, 0x10, 0x2,
+    0xa0, 0xb0, 0x0, 0x0, 0xd5, 0xc3, 0xb, 0x65,
+    0xa5, 0xa2, 0x5, 0xc0, 0xa0, 0x8c, 0x1, 0x90,
+    0x0, 0x7, 0xa0, 0xa5, 0x2c, 0x56, 0xb5, 0x80,
+    0x22, 0xa0, 0xa0, 0xb, 0x1, 0x90, 0x0, 0x0,
+    0xa0, 0xa0, 0xb, 0x23, 0xa4, 0x60, 0x0, 0xb5,
+    0xb0, 0xc, 0x34, 0xa2, 0x20, 0x0, 0x90, 0x0,
+    0xb, 0x1, 0x90, 0x40, 0x0, 0x0, 0x0, 0xc,
+    0x55, 0x55, 0x52, 0x0, 0x0, 0x0, 0x2, 0x0,
+    0x0, 0x0,
+
+    /* U+793A "示" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x15, 0x55, 0x55, 0x55, 0x9b, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x40, 0x6, 0x55, 0x55, 0x68, 0x55,
+    0x55, 0xa3, 0x0, 0x0, 0x0, 0x2a, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xe2, 0x2a, 0x6, 0x0, 0x0,
+    0x0, 0x8, 0x70, 0x2a, 0x0, 0xa2, 0x0, 0x0,
+    0x3a, 0x0, 0x2a, 0x0, 0x2d, 0x20, 0x1, 0x90,
+    0x0, 0x2a, 0x0, 0x6, 0xb0, 0x6, 0x0, 0x23,
+    0x6a, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+793C "礼" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x30, 0x0, 0xd0, 0x0, 0x0, 0x0, 0x2,
+    0xb0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x12,
+    0x20, 0xc0, 0x0, 0x0, 0x2, 0x65, 0x5e, 0x60,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x58, 0x0, 0xc0,
+    0x0, 0x0, 0x0, 0x2, 0xd0, 0x0, 0xc0, 0x0,
+    0x0, 0x0, 0x19, 0xd9, 0x40, 0xc0, 0x0, 0x0,
+    0x1, 0x70, 0xc1, 0xc0, 0xc0, 0x0, 0x0, 0x3,
+    0x0, 0xc0, 0x0, 0xc0, 0x0, 0x10, 0x0, 0x0,
+    0xc0, 0x0, 0xc0, 0x0, 0x50, 0x0, 0x0, 0xc0,
+    0x0, 0xc0, 0x0, 0xa0, 0x0, 0x0, 0xd0, 0x0,
+    0x8b, 0xbb, 0xd2, 0x0, 0x0, 0x20, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+793E "社" */
+    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x10, 0x0, 0x2b, 0x0, 0x0, 0x0, 0x7,
+    0x30, 0x0, 0x2a, 0x0, 0x0, 0x5, 0x55, 0x78,
+    0x0, 0x2a, 0x0, 0x0, 0x1, 0x0, 0xb4, 0x0,
+    0x2a, 0x0, 0x0, 0x0, 0x4, 0x90, 0x55, 0x6b,
+    0x58, 0x90, 0x0, 0xe, 0x70, 0x10, 0x2a, 0x0,
+    0x0, 0x0, 0x9d, 0x3c, 0x0, 0x2a, 0x0, 0x0,
+    0x6, 0x2c, 0x4, 0x0, 0x2a, 0x0, 0x0, 0x11,
+    0xc, 0x0, 0x0, 0x2a, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x2a, 0x0, 0x0, 0x0, 0xc, 0x4,
+    0x55, 0x6b, 0x55, 0xc3, 0x0, 0xc, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7956 "祖" */
+    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x59, 0x0, 0x65, 0x55, 0x5a, 0x0, 0x0, 0xc,
+    0x0, 0xa2, 0x0, 0xc, 0x0, 0x5, 0x55, 0xa1,
+    0xa2, 0x0, 0xc, 0x0, 0x0, 0x2, 0xa0, 0x92,
+    0x0, 0xc, 0x0, 0x0, 0xa, 0x20, 0x96, 0x55,
+    0x5c, 0x0, 0x0, 0x4d, 0x60, 0x92, 0x0, 0xc,
+    0x0, 0x0, 0x9b, 0x78, 0x92, 0x0, 0xc, 0x0,
+    0x6, 0xb, 0x4, 0x96, 0x55, 0x5c, 0x0, 0x0,
+    0xb, 0x0, 0x92, 0x0, 0xc, 0x0, 0x0, 0xb,
+    0x0, 0x92, 0x0, 0xc, 0x0, 0x0, 0xb, 0x0,
+    0x92, 0x0, 0xc, 0x52, 0x0, 0xc, 0x26, 0x55,
+    0x55, 0x55, 0x54, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+795D "祝" */
+    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2a, 0x0, 0x20, 0x0, 0x4, 0x0, 0x0, 0xa,
+    0x10, 0xb5, 0x55, 0x5d, 0x0, 0x5, 0x55, 0x93,
+    0xb0, 0x0, 0xb, 0x0, 0x1, 0x0, 0xc0, 0xb0,
+    0x0, 0xb, 0x0, 0x0, 0x7, 0x40, 0xb0, 0x0,
+    0xb, 0x0, 0x0, 0x2e, 0x30, 0xb6, 0x89, 0x5c,
+    0x0, 0x0, 0x9b, 0x95, 0x14, 0x6b, 0x1, 0x0,
+    0x6, 0x1b, 0x15, 0x5, 0x4b, 0x0, 0x0, 0x21,
+    0xb, 0x0, 0x8, 0x1b, 0x0, 0x0, 0x0, 0xb,
+    0x0, 0xa, 0xb, 0x0, 0x50, 0x0, 0xc, 0x0,
+    0x82, 0xb, 0x0, 0x80, 0x0, 0xc, 0x6, 0x20,
+    0x7, 0xa9, 0xd2, 0x0, 0x4, 0x30, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+795E "神" */
+    0x0, 0x0, 0x0, 0x0, 0x5, 0x0, 0x0, 0x0,
+    0x29, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0xb, 0x0, 0x10, 0x5, 0x55, 0x92,
+    0xb5, 0x5c, 0x55, 0xd0, 0x1, 0x0, 0xb0, 0xb0,
+    0xb, 0x0, 0xb0, 0x0, 0x7, 0x40, 0xb5, 0x5c,
+    0x55, 0xb0, 0x0, 0x2d, 0x60, 0xb0, 0xb, 0x0,
+    0xb0, 0x0, 0x9b, 0x69, 0xb0, 0xb, 0x0, 0xb0,
+    0x6, 0xb, 0x3, 0xb5, 0x5c, 0x55, 0xb0, 0x10,
+    0xb, 0x0, 0x50, 0xb, 0x0, 0x20, 0x0, 0xb,
+    0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0xb, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x3,
+    0x0, 0x0,
+
+    /* U+796D "祭" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0x90, 0x11, 0x30, 0x3, 0x0, 0x0, 0xb,
+    0x55, 0xc5, 0x95, 0x5d, 0x30, 0x0, 0x57, 0x92,
+    0xc0, 0x71, 0x71, 0x0, 0x1, 0x93, 0x4a, 0x40,
+    0x1b, 0x20, 0x0, 0x5, 0xb, 0x49, 0x0, 0x7,
+    0x70, 0x0, 0x0, 0x2, 0x96, 0x55, 0x68, 0x8b,
+    0x30, 0x0, 0x37, 0x0, 0x0, 0x0, 0x5, 0xa2,
+    0x15, 0x56, 0x55, 0x56, 0x55, 0x87, 0x0, 0x0,
+    0x0, 0x55, 0xb, 0x13, 0x0, 0x0, 0x0, 0x3,
+    0xc3, 0xb, 0x3, 0xa4, 0x0, 0x0, 0x49, 0x0,
+    0xb, 0x0, 0x1d, 0x30, 0x2, 0x30, 0x5, 0xb9,
+    0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x31, 0x0,
+    0x0, 0x0,
+
+    /* U+7981 "禁" */
+    0x0, 0x0, 0x40, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x0, 0xc0, 0x0, 0xb, 0x10, 0x0, 0x4, 0x55,
+    0xc5, 0xa2, 0x5d, 0x56, 0xa0, 0x0, 0xb, 0xc2,
+    0x0, 0x5f, 0x50, 0x0, 0x0, 0x56, 0xb9, 0x50,
+    0x9b, 0x46, 0x0, 0x2, 0x80, 0xb1, 0x27, 0x1b,
+    0x8, 0xb1, 0x4, 0x0, 0x80, 0x21, 0x7, 0x20,
+    0x20, 0x0, 0x6, 0x55, 0x55, 0x55, 0x92, 0x0,
+    0x5, 0x55, 0x55, 0x55, 0x55, 0x55, 0xb1, 0x1,
+    0x0, 0x42, 0xc, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xd4, 0xc, 0x7, 0x60, 0x0, 0x0, 0x48, 0x10,
+    0xc, 0x0, 0x8a, 0x0, 0x2, 0x30, 0x6, 0xd9,
+    0x0, 0x8, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+79C0 "秀" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x50, 0x0, 0x0,
+    0x4, 0x56, 0x7a, 0x89, 0x72, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0x0, 0x0, 0x10, 0x4, 0x65, 0x55,
+    0x8c, 0x65, 0x56, 0xb1, 0x0, 0x0, 0xb, 0x5a,
+    0x42, 0x0, 0x0, 0x0, 0x0, 0xa4, 0x1a, 0x8,
+    0x60, 0x0, 0x0, 0x29, 0x20, 0x15, 0x2, 0x6d,
+    0x72, 0x4, 0x42, 0x6b, 0x65, 0x8a, 0x1, 0x60,
+    0x0, 0x0, 0xc, 0x0, 0xa2, 0x4, 0x0, 0x0,
+    0x0, 0x1b, 0x0, 0x85, 0x6c, 0x0, 0x0, 0x0,
+    0x93, 0x0, 0x0, 0x47, 0x0, 0x0, 0x6, 0x60,
+    0x0, 0x10, 0x93, 0x0, 0x0, 0x64, 0x0, 0x0,
+    0x4d, 0xb0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0,
+
+    /* U+79C1 "私" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4a, 0xd1, 0x5, 0x10, 0x0, 0x2, 0x46,
+    0xd1, 0x0, 0xb, 0x50, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0xd, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x52,
+    0x2a, 0x0, 0x0, 0x6, 0x55, 0xe5, 0x53, 0x65,
+    0x0, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x90, 0x0,
+    0x0, 0x0, 0xb, 0xd6, 0xb0, 0x90, 0x10, 0x0,
+    0x0, 0x83, 0xc0, 0x93, 0x50, 0x35, 0x0, 0x5,
+    0x40, 0xc0, 0x7, 0x0, 0xb, 0x10, 0x13, 0x0,
+    0xc0, 0x18, 0x0, 0x7, 0xb0, 0x0, 0x0, 0xd0,
+    0x8e, 0xa8, 0x64, 0xf0, 0x0, 0x0, 0xe0, 0x12,
+    0x0, 0x0, 0x50, 0x0, 0x0, 0x30, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+79CB "秋" */
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x3, 0xaa, 0x0, 0xb4, 0x0, 0x0, 0x3, 0x5b,
+    0x30, 0x0, 0xb1, 0x0, 0x0, 0x0, 0x9, 0x20,
+    0x1, 0xb1, 0x9, 0x10, 0x15, 0x5b, 0x7b, 0x35,
+    0xc2, 0x6a, 0x10, 0x1, 0xe, 0x20, 0x84, 0xd6,
+    0x70, 0x0, 0x0, 0x4f, 0x50, 0xa0, 0xc7, 0x0,
+    0x0, 0x0, 0x9b, 0x7a, 0x0, 0xc7, 0x0, 0x0,
+    0x3, 0x69, 0x29, 0x3, 0x97, 0x10, 0x0, 0x6,
+    0x9, 0x20, 0x9, 0x42, 0x90, 0x0, 0x20, 0x9,
+    0x20, 0x1b, 0x0, 0xb3, 0x0, 0x0, 0xa, 0x20,
+    0x91, 0x0, 0x2e, 0x40, 0x0, 0xa, 0x46, 0x0,
+    0x0, 0x6, 0x70, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+79CD "种" */
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x4, 0xb8, 0x0, 0xd, 0x0, 0x0, 0x4, 0x5c,
+    0x10, 0x0, 0xb, 0x0, 0x0, 0x0, 0xb, 0x0,
+    0x10, 0xb, 0x0, 0x40, 0x16, 0x5c, 0x69, 0xa5,
+    0x5c, 0x56, 0xb0, 0x0, 0xe, 0x0, 0xa1, 0xb,
+    0x2, 0x90, 0x0, 0x3f, 0x61, 0xa1, 0xb, 0x2,
+    0x90, 0x0, 0xad, 0x3c, 0xa1, 0xb, 0x2, 0x90,
+    0x3, 0x7b, 0x2, 0xa5, 0x5c, 0x56, 0x90, 0x8,
+    0xb, 0x0, 0x20, 0xb, 0x0, 0x0, 0x30, 0xb,
+    0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0xb, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0xb, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x3,
+    0x0, 0x0,
+
+    /* U+79D1 "科" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0,
+    0x2, 0x8d, 0x0, 0x0, 0xc2, 0x0, 0x4, 0x5b,
+    0x40, 0x3, 0x10, 0xb0, 0x0, 0x0, 0x8, 0x20,
+    0x1, 0xd0, 0xb0, 0x0, 0x0, 0x8, 0x25, 0x10,
+    0x40, 0xb0, 0x0, 0x26, 0x5d, 0x65, 0x31, 0x0,
+    0xb0, 0x0, 0x0, 0x1f, 0x60, 0x5, 0x70, 0xb0,
+    0x0, 0x0, 0x8c, 0x6b, 0x0, 0x90, 0xb0, 0x30,
+    0x2, 0x88, 0x26, 0x0, 0x3, 0xd6, 0x70, 0x7,
+    0x8, 0x23, 0x65, 0x41, 0xb0, 0x0, 0x30, 0x9,
+    0x20, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x9, 0x20,
+    0x0, 0x0, 0xb0, 0x0, 0x0, 0x9, 0x30, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x40, 0x0,
+
+    /* U+79D8 "秘" */
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x38, 0xb7, 0x0, 0x70, 0x6, 0x0, 0x4, 0x2b,
+    0x0, 0x0, 0x4b, 0x1e, 0x10, 0x0, 0xb, 0x0,
+    0x6, 0x44, 0x49, 0x0, 0x14, 0x4c, 0x4a, 0x9,
+    0x20, 0x95, 0x0, 0x2, 0x1f, 0x0, 0x9, 0x20,
+    0xd1, 0x0, 0x0, 0x5f, 0x82, 0x49, 0x23, 0xb5,
+    0x20, 0x0, 0xac, 0x29, 0x99, 0x2a, 0x50, 0xd0,
+    0x4, 0x5b, 0x6, 0x99, 0x5c, 0x0, 0xb2, 0x7,
+    0xb, 0x2, 0x19, 0xe2, 0x1, 0x10, 0x20, 0xb,
+    0x0, 0xb, 0x60, 0x5, 0x0, 0x0, 0xb, 0x0,
+    0x8c, 0x20, 0x9, 0x10, 0x0, 0xb, 0x26, 0x15,
+    0xca, 0xad, 0x30, 0x0, 0x5, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+79FB "移" */
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x3, 0xa8, 0x0, 0xb4, 0x0, 0x0, 0x4, 0x6d,
+    0x20, 0x4, 0xb5, 0x59, 0x30, 0x0, 0xb, 0x0,
+    0x19, 0x50, 0x2b, 0x0, 0x0, 0xb, 0x5, 0x30,
+    0xa2, 0xb1, 0x0, 0x26, 0x5f, 0x55, 0x10, 0x2a,
+    0x10, 0x0, 0x0, 0x3f, 0x20, 0x4, 0x78, 0x50,
+    0x0, 0x0, 0x9e, 0x77, 0x42, 0x4b, 0x10, 0x30,
+    0x1, 0x8c, 0x7, 0x3, 0xa5, 0x59, 0xb0, 0x7,
+    0xc, 0x0, 0x48, 0x70, 0x1c, 0x10, 0x22, 0xc,
+    0x1, 0x20, 0x92, 0xb2, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0x4a, 0x20, 0x0, 0x0, 0xc, 0x0, 0x57,
+    0x50, 0x0, 0x0, 0x0, 0x3, 0x13, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7A0B "程" */
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x37, 0xb9, 0x18, 0x55, 0x59, 0x30, 0x4, 0x3b,
+    0x0, 0x1a, 0x0, 0xa, 0x0, 0x0, 0xb, 0x0,
+    0xa, 0x0, 0xa, 0x0, 0x15, 0x5c, 0x5a, 0x2c,
+    0x55, 0x5c, 0x0, 0x1, 0x1e, 0x0, 0x17, 0x0,
+    0x5, 0x0, 0x0, 0x5f, 0x71, 0x35, 0x55, 0x57,
+    0x70, 0x0, 0x9c, 0x2b, 0x10, 0xb, 0x0, 0x0,
+    0x1, 0x7b, 0x1, 0x0, 0xb, 0x0, 0x0, 0x7,
+    0xb, 0x0, 0x16, 0x5c, 0x59, 0x30, 0x23, 0xb,
+    0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0xb, 0x0, 0x30, 0x0, 0xc, 0x3, 0x65,
+    0x57, 0x55, 0x80, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7A2E "種" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x2, 0x95, 0x14, 0x6a, 0xa8, 0x0, 0x3, 0x5c,
+    0x20, 0x0, 0xb, 0x0, 0x10, 0x0, 0xb, 0x1,
+    0x65, 0x5c, 0x56, 0x70, 0x4, 0x4c, 0x67, 0x20,
+    0xb, 0x2, 0x0, 0x2, 0x4d, 0x0, 0xa5, 0x5c,
+    0x5c, 0x10, 0x0, 0x7c, 0x80, 0xa5, 0x5c, 0x5c,
+    0x0, 0x0, 0xab, 0x65, 0xa0, 0xb, 0xb, 0x0,
+    0x5, 0x3b, 0x1, 0xa5, 0x5c, 0x5c, 0x0, 0x5,
+    0xb, 0x0, 0x40, 0xb, 0x4, 0x0, 0x10, 0xb,
+    0x0, 0x65, 0x5c, 0x59, 0x40, 0x0, 0xc, 0x0,
+    0x0, 0xb, 0x0, 0x0, 0x0, 0xc, 0x3, 0x55,
+    0x5c, 0x57, 0xd0, 0x0, 0x3, 0x1, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7A4D "積" */
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0,
+    0x27, 0xd3, 0x0, 0xc, 0x0, 0x40, 0x3, 0x3b,
+    0x0, 0x65, 0x5c, 0x55, 0x61, 0x0, 0xb, 0x0,
+    0x27, 0x5c, 0x57, 0x50, 0x6, 0x6d, 0x85, 0x11,
+    0x1b, 0x11, 0x62, 0x0, 0x5d, 0x31, 0x63, 0x33,
+    0x33, 0x52, 0x0, 0xab, 0x83, 0x96, 0x55, 0x56,
+    0xb0, 0x1, 0x8b, 0x23, 0x86, 0x55, 0x56, 0x90,
+    0x7, 0x1b, 0x0, 0x81, 0x0, 0x2, 0x90, 0x14,
+    0xb, 0x0, 0x86, 0x55, 0x56, 0x90, 0x0, 0xb,
+    0x0, 0x96, 0x55, 0x56, 0x90, 0x0, 0xc, 0x0,
+    0x2a, 0x60, 0x37, 0x10, 0x0, 0xb, 0x3, 0x73,
+    0x0, 0x2, 0xc0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x20,
+
+    /* U+7A76 "究" */
+    0x0, 0x0, 0x1, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x75,
+    0x55, 0x87, 0x55, 0x5c, 0x10, 0x3, 0x90, 0x94,
+    0x1, 0x50, 0x36, 0x0, 0x3, 0x29, 0x75, 0x10,
+    0x2b, 0xa0, 0x0, 0x2, 0x61, 0xb, 0x10, 0x0,
+    0x91, 0x0, 0x0, 0x46, 0x6d, 0x66, 0x94, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0x0, 0x92, 0x0, 0x0,
+    0x0, 0x0, 0x38, 0x0, 0x92, 0x0, 0x0, 0x0,
+    0x0, 0x93, 0x0, 0xa1, 0x0, 0x0, 0x0, 0x2,
+    0xb0, 0x0, 0xa1, 0x0, 0x50, 0x0, 0xb, 0x20,
+    0x0, 0xa1, 0x1, 0x90, 0x1, 0x82, 0x0, 0x0,
+    0x5b, 0xac, 0x90, 0x4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7A7A "空" */
+    0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa6, 0x0, 0x0, 0x0, 0x0, 0x10,
+    0x0, 0x16, 0x0, 0x2, 0x0, 0x4, 0x95, 0x56,
+    0x55, 0x55, 0x5c, 0x80, 0xd, 0x30, 0xa9, 0x0,
+    0x57, 0x25, 0x0, 0x0, 0x9, 0x70, 0x0, 0x2,
+    0xc8, 0x0, 0x2, 0x72, 0x0, 0x0, 0x0, 0x1b,
+    0x10, 0x3, 0x17, 0x55, 0x85, 0x57, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa2, 0x0, 0x0, 0x0, 0x5, 0x55, 0x55, 0xc7,
+    0x55, 0x5d, 0x60, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7A93 "窓" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4c, 0x0, 0x0, 0x0, 0x0, 0x75,
+    0x55, 0x5c, 0x55, 0x56, 0xa0, 0x3, 0x90, 0x18,
+    0x0, 0x54, 0x5, 0x50, 0x6, 0x25, 0xa4, 0x63,
+    0x4, 0xd7, 0x0, 0x0, 0x52, 0x3, 0xc3, 0x10,
+    0x4, 0x0, 0x0, 0x0, 0x58, 0x0, 0xa, 0x10,
+    0x0, 0x0, 0x8, 0xda, 0x87, 0x68, 0xb0, 0x0,
+    0x0, 0x2, 0x30, 0x50, 0x0, 0x80, 0x0, 0x0,
+    0x10, 0xc1, 0x2c, 0x0, 0x5, 0x0, 0x0, 0x70,
+    0xc0, 0x7, 0x0, 0x46, 0x70, 0x7, 0x90, 0xc0,
+    0x0, 0x1, 0x70, 0xb0, 0x3, 0x0, 0xbb, 0xbb,
+    0xbc, 0xb0, 0x0,
+
+    /* U+7ACB "立" */
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x68, 0x0, 0x1, 0x0, 0x2, 0x65, 0x55,
+    0x55, 0x55, 0x5c, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0x0, 0x0, 0x0, 0x1, 0x40, 0x0, 0xe,
+    0x40, 0x0, 0x0, 0x0, 0x90, 0x0, 0x1c, 0x0,
+    0x0, 0x0, 0x0, 0x67, 0x0, 0x47, 0x0, 0x0,
+    0x0, 0x0, 0x3d, 0x0, 0x91, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0x0, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x2, 0x40, 0x0, 0x0, 0x15, 0x55, 0x55,
+    0x59, 0x55, 0x57, 0xd1, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+7AD9 "站" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x43, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xd,
+    0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0x7, 0x0,
+    0x30, 0xb, 0x1, 0x40, 0x6, 0x55, 0x56, 0x70,
+    0xc, 0x55, 0x50, 0x0, 0x10, 0x28, 0x0, 0xb,
+    0x0, 0x0, 0x0, 0x70, 0x57, 0x0, 0xb, 0x0,
+    0x0, 0x0, 0xb0, 0x72, 0xa, 0x5a, 0x5b, 0x30,
+    0x0, 0x94, 0x80, 0xb, 0x0, 0xb, 0x0, 0x0,
+    0x51, 0x60, 0xb, 0x0, 0xb, 0x0, 0x0, 0x36,
+    0x95, 0x2b, 0x0, 0xb, 0x0, 0xc, 0x83, 0x0,
+    0xc, 0x55, 0x5c, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0x0, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7AE5 "童" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0x40, 0x14, 0x0, 0x0, 0x46, 0x97,
+    0x55, 0xc6, 0x50, 0x0, 0x0, 0x1, 0xb0, 0x26,
+    0x0, 0x0, 0x5, 0x65, 0x56, 0x57, 0x55, 0x87,
+    0x0, 0x0, 0x75, 0x55, 0x55, 0x75, 0x0, 0x0,
+    0xb, 0x0, 0x91, 0x5, 0x50, 0x0, 0x0, 0xb5,
+    0x5b, 0x65, 0x95, 0x0, 0x0, 0xb, 0x55, 0xb6,
+    0x59, 0x60, 0x0, 0x0, 0x60, 0x9, 0x10, 0x33,
+    0x0, 0x0, 0x55, 0x55, 0xb6, 0x55, 0xb4, 0x0,
+    0x0, 0x0, 0x9, 0x10, 0x0, 0x20, 0x6, 0x55,
+    0x55, 0x75, 0x55, 0x58, 0x50,
+
+    /* U+7AEF "端" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x71, 0x0, 0x50, 0x1c, 0x2, 0x10, 0x0, 0x48,
+    0x0, 0xb0, 0xa, 0x4, 0x70, 0x0, 0x1, 0x50,
+    0xa0, 0xa, 0x4, 0x60, 0x5, 0x44, 0x62, 0x85,
+    0x55, 0x57, 0x40, 0x3, 0x10, 0xd3, 0x55, 0x55,
+    0x55, 0x92, 0x1, 0x72, 0x80, 0x10, 0x92, 0x0,
+    0x0, 0x0, 0xb5, 0x30, 0x85, 0xa5, 0x55, 0x90,
+    0x0, 0x66, 0x0, 0xb0, 0xa0, 0xa0, 0xb0, 0x0,
+    0x8, 0x53, 0xb0, 0xa0, 0xa0, 0xb0, 0xb, 0xa3,
+    0x0, 0xb0, 0xa0, 0xa0, 0xb0, 0x1, 0x0, 0x0,
+    0xb0, 0xa0, 0x90, 0xb0, 0x0, 0x0, 0x0, 0xb0,
+    0x40, 0x29, 0xa0, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x2, 0x10,
+
+    /* U+7B11 "笑" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x30, 0x0, 0x5a, 0x0, 0x0, 0x0, 0x4c,
+    0x55, 0xb3, 0xc6, 0x57, 0xb0, 0x0, 0xa0, 0x82,
+    0x5, 0x50, 0xa1, 0x0, 0x6, 0x20, 0x47, 0x15,
+    0x0, 0x73, 0x0, 0x1, 0x0, 0x13, 0x67, 0xad,
+    0xc0, 0x0, 0x0, 0x24, 0x43, 0xb3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x2, 0x10,
+    0x6, 0x55, 0x55, 0xd7, 0x55, 0x58, 0x60, 0x0,
+    0x0, 0x4, 0x83, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x10, 0x83, 0x0, 0x0, 0x0, 0x1, 0x92,
+    0x0, 0xa, 0x92, 0x0, 0x2, 0x56, 0x0, 0x0,
+    0x0, 0x6e, 0xa0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7B26 "符" */
+    0x0, 0x2, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0xd, 0x30, 0x0, 0x69, 0x0, 0x0, 0x0, 0x6a,
+    0x65, 0x92, 0xb5, 0x75, 0x90, 0x1, 0x90, 0x1a,
+    0x5, 0x30, 0x83, 0x0, 0x6, 0x0, 0x54, 0x25,
+    0x0, 0x32, 0x0, 0x0, 0x2, 0xd1, 0x0, 0x0,
+    0xd0, 0x0, 0x0, 0xb, 0x25, 0x55, 0x55, 0xc5,
+    0xa2, 0x0, 0x7d, 0x10, 0x20, 0x0, 0xb0, 0x0,
+    0x6, 0x3b, 0x0, 0x75, 0x0, 0xb0, 0x0, 0x11,
+    0xb, 0x0, 0xd, 0x0, 0xb0, 0x0, 0x0, 0xb,
+    0x0, 0x1, 0x0, 0xb0, 0x0, 0x0, 0xb, 0x0,
+    0x0, 0x0, 0xb0, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x6c, 0x90, 0x0, 0x0, 0x2, 0x0, 0x0, 0x3,
+    0x0, 0x0,
+
+    /* U+7B2C "第" */
+    0x0, 0x2, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0,
+    0xc, 0x50, 0x10, 0x8a, 0x0, 0x10, 0x0, 0x6a,
+    0x85, 0x94, 0xc7, 0x65, 0x91, 0x3, 0x70, 0x66,
+    0x8, 0x0, 0xb0, 0x0, 0x2, 0x25, 0x67, 0x65,
+    0x55, 0x89, 0x0, 0x0, 0x1, 0x0, 0xb, 0x0,
+    0xb, 0x0, 0x0, 0x9, 0x55, 0x5c, 0x55, 0x5b,
+    0x0, 0x0, 0x1b, 0x0, 0xb, 0x0, 0x5, 0x0,
+    0x0, 0x7a, 0x55, 0x5c, 0x55, 0x55, 0x90, 0x0,
+    0x21, 0x5, 0x9b, 0x0, 0x1, 0xb0, 0x0, 0x0,
+    0x59, 0xb, 0x0, 0x4, 0x80, 0x0, 0x18, 0x50,
+    0xb, 0x2, 0x9e, 0x30, 0x15, 0x50, 0x0, 0xb,
+    0x0, 0x12, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0,
+    0x0, 0x0,
+
+    /* U+7B46 "筆" */
+    0x0, 0x4, 0x10, 0x0, 0x22, 0x0, 0x0, 0x0,
+    0xd, 0x40, 0x0, 0x78, 0x0, 0x10, 0x0, 0x5b,
+    0x65, 0x95, 0xc5, 0x76, 0xa0, 0x0, 0xa0, 0x2b,
+    0x6, 0x30, 0x69, 0x0, 0x7, 0x10, 0x8, 0x39,
+    0x0, 0x1a, 0x0, 0x1, 0x4, 0x65, 0x6b, 0x55,
+    0xd2, 0x0, 0x1, 0x55, 0x55, 0x6b, 0x55, 0xd9,
+    0x80, 0x0, 0x10, 0x0, 0x29, 0x0, 0xc0, 0x0,
+    0x0, 0x4, 0x65, 0x6b, 0x55, 0xa0, 0x0, 0x0,
+    0x2, 0x22, 0x4a, 0x23, 0x80, 0x0, 0x0, 0x3,
+    0x33, 0x5a, 0x33, 0x35, 0x10, 0x3, 0x65, 0x55,
+    0x6b, 0x55, 0x57, 0x40, 0x0, 0x0, 0x0, 0x2a,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0x0,
+    0x0, 0x0,
+
+    /* U+7B49 "等" */
+    0x0, 0x3, 0x0, 0x0, 0x12, 0x0, 0x0, 0x0,
+    0xe, 0x50, 0x10, 0x88, 0x0, 0x10, 0x0, 0x5b,
+    0x75, 0x85, 0xb7, 0x55, 0x80, 0x1, 0xa0, 0x84,
+    0x5, 0x10, 0xb0, 0x0, 0x6, 0x0, 0x35, 0xc,
+    0x0, 0x70, 0x0, 0x0, 0x6, 0x55, 0x5d, 0x55,
+    0x78, 0x0, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x30, 0x6, 0x55, 0x55, 0x57, 0x56, 0x55, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0x21, 0x30, 0x1,
+    0x75, 0x75, 0x55, 0x5c, 0x55, 0x60, 0x0, 0x0,
+    0x39, 0x0, 0xb, 0x10, 0x0, 0x0, 0x0, 0xb,
+    0x10, 0xb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xae, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x12,
+    0x0, 0x0,
+
+    /* U+7B54 "答" */
+    0x0, 0x2, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0xf, 0x20, 0x1, 0xe0, 0x0, 0x0, 0x0, 0x7b,
+    0x55, 0xa7, 0x86, 0x59, 0x30, 0x1, 0xa0, 0xa0,
+    0x16, 0x6, 0x60, 0x0, 0x7, 0x10, 0x85, 0xe1,
+    0x0, 0xa0, 0x0, 0x0, 0x0, 0x4b, 0x17, 0x20,
+    0x0, 0x0, 0x0, 0x6, 0x90, 0x0, 0x79, 0x30,
+    0x0, 0x1, 0x85, 0x65, 0x55, 0xa4, 0xae, 0x80,
+    0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x55, 0x55, 0x5d, 0x30, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0xc, 0x55, 0x55,
+    0x5d, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1,
+    0x0, 0x0,
+
+    /* U+7B56 "策" */
+    0x0, 0x1, 0x10, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x9, 0x70, 0x0, 0x93, 0x0, 0x0, 0x0, 0x3c,
+    0x75, 0x86, 0xa7, 0x58, 0x70, 0x0, 0x90, 0x47,
+    0x5, 0x8, 0x40, 0x0, 0x4, 0x0, 0x4, 0xa,
+    0x2, 0x22, 0x30, 0x4, 0x55, 0x55, 0x5c, 0x55,
+    0x58, 0x80, 0x0, 0x7, 0x55, 0x5c, 0x55, 0x83,
+    0x0, 0x0, 0xb, 0x0, 0xb, 0x0, 0xa1, 0x0,
+    0x0, 0xb, 0x0, 0x7d, 0x11, 0xb0, 0x0, 0x0,
+    0xb, 0x6, 0x8b, 0x87, 0xc0, 0x0, 0x0, 0x0,
+    0x86, 0xb, 0x1a, 0x30, 0x0, 0x0, 0x38, 0x20,
+    0xb, 0x0, 0xac, 0x83, 0x15, 0x30, 0x0, 0xb,
+    0x0, 0x3, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7B97 "算" */
+    0x0, 0x4, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0xd, 0x10, 0x30, 0xb2, 0x0, 0x10, 0x0, 0x77,
+    0x96, 0x75, 0x85, 0x96, 0x60, 0x2, 0x71, 0x37,
+    0x5, 0x0, 0x85, 0x0, 0x5, 0xb, 0x55, 0x55,
+    0x57, 0xb0, 0x0, 0x0, 0xb, 0x55, 0x55, 0x57,
+    0x90, 0x0, 0x0, 0xb, 0x0, 0x0, 0x3, 0x90,
+    0x0, 0x0, 0xc, 0x55, 0x55, 0x57, 0x90, 0x0,
+    0x0, 0xc, 0x59, 0x55, 0x97, 0x90, 0x0, 0x0,
+    0x2, 0x2b, 0x0, 0xc0, 0x0, 0x20, 0x16, 0x55,
+    0x8b, 0x55, 0xd5, 0x57, 0x80, 0x0, 0x0, 0xb2,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0x38, 0x20, 0x0,
+    0xc0, 0x0, 0x0, 0x2, 0x20, 0x0, 0x0, 0x30,
+    0x0, 0x0,
+
+    /* U+7BA1 "管" */
+    0x0, 0x3, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x79, 0x0, 0x11, 0xc1, 0x1, 0x0, 0x0, 0xb7,
+    0x66, 0x58, 0x68, 0x57, 0x40, 0x7, 0x10, 0xa0,
+    0x61, 0x6, 0x60, 0x0, 0x3, 0x0, 0x20, 0x92,
+    0x0, 0x12, 0x30, 0x9, 0x55, 0x55, 0x55, 0x55,
+    0x5b, 0x80, 0x29, 0x8, 0x55, 0x55, 0x5c, 0x4,
+    0x0, 0x0, 0xa, 0x0, 0x0, 0xb, 0x0, 0x0,
+    0x0, 0xa, 0x55, 0x55, 0x5b, 0x0, 0x0, 0x0,
+    0xa, 0x0, 0x0, 0x2, 0x10, 0x0, 0x0, 0xa,
+    0x55, 0x55, 0x5a, 0x60, 0x0, 0x0, 0xa, 0x0,
+    0x0, 0x7, 0x30, 0x0, 0x0, 0xb, 0x55, 0x55,
+    0x5a, 0x40, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7BC0 "節" */
+    0x0, 0x4, 0x0, 0x0, 0x31, 0x0, 0x0, 0x0,
+    0x3c, 0x0, 0x60, 0xb3, 0x3, 0x40, 0x0, 0xa5,
+    0xa8, 0x54, 0xa6, 0xa5, 0x40, 0x4, 0x30, 0xc,
+    0x7, 0x0, 0x5a, 0x0, 0x13, 0x20, 0x0, 0x41,
+    0x20, 0x7, 0x0, 0x0, 0xb5, 0x55, 0xd1, 0xc5,
+    0x5d, 0x0, 0x0, 0xb5, 0x55, 0xb0, 0xb0, 0xb,
+    0x0, 0x0, 0xb0, 0x0, 0xb0, 0xb0, 0xb, 0x0,
+    0x0, 0xb5, 0x55, 0xb0, 0xb0, 0xb, 0x0, 0x0,
+    0xb0, 0x3, 0x10, 0xb0, 0xb, 0x0, 0x0, 0xb0,
+    0x8, 0x50, 0xb2, 0x9a, 0x0, 0x0, 0xc7, 0x74,
+    0xe0, 0xb0, 0x20, 0x0, 0x0, 0x74, 0x0, 0x41,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10,
+    0x0, 0x0,
+
+    /* U+7BC4 "範" */
+    0x0, 0x3, 0x0, 0x0, 0x21, 0x0, 0x0, 0x0,
+    0x4d, 0x10, 0x60, 0xa5, 0x3, 0x40, 0x0, 0xb6,
+    0xa6, 0x55, 0xa6, 0xb6, 0x40, 0x5, 0x40, 0x3d,
+    0x8, 0x0, 0x3d, 0x10, 0x4, 0x11, 0xc4, 0x61,
+    0x20, 0x8, 0x0, 0x2, 0x64, 0xb4, 0x51, 0xc5,
+    0x5c, 0x0, 0x0, 0xb5, 0xc5, 0xc0, 0xa0, 0xa,
+    0x0, 0x0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa, 0x0,
+    0x0, 0xc5, 0xc5, 0xa0, 0xa0, 0xa, 0x0, 0x0,
+    0xc5, 0xc5, 0xb0, 0xa4, 0x7a, 0x0, 0x0, 0x20,
+    0xa0, 0x70, 0xa0, 0x41, 0x20, 0x5, 0x55, 0xc5,
+    0x52, 0xa0, 0x0, 0x50, 0x0, 0x0, 0xb0, 0x0,
+    0xb9, 0x9a, 0xc0, 0x0, 0x0, 0x40, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7C21 "簡" */
+    0x0, 0x3, 0x0, 0x0, 0x40, 0x0, 0x0, 0x3,
+    0xc0, 0x6, 0x3d, 0x10, 0x43, 0x0, 0xa6, 0xb5,
+    0x5a, 0x6b, 0x75, 0x40, 0x51, 0x6, 0x52, 0x20,
+    0x1c, 0x0, 0x0, 0xb4, 0x4b, 0x27, 0x54, 0x5c,
+    0x10, 0xc, 0x55, 0xc0, 0x86, 0x55, 0xc0, 0x0,
+    0xb0, 0xa, 0x8, 0x20, 0xb, 0x0, 0xc, 0x55,
+    0x90, 0x75, 0x55, 0xc0, 0x0, 0xb0, 0x85, 0x55,
+    0x88, 0xb, 0x0, 0xb, 0x9, 0x55, 0x58, 0x70,
+    0xb0, 0x0, 0xb0, 0x91, 0x0, 0x47, 0xb, 0x0,
+    0xb, 0x9, 0x55, 0x57, 0x50, 0xb0, 0x0, 0xc0,
+    0x0, 0x0, 0x4, 0x8d, 0x0, 0x2, 0x0, 0x0,
+    0x0, 0x1, 0x20,
+
+    /* U+7C73 "米" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x10, 0x0, 0xb5, 0x0, 0x60, 0x0, 0x0, 0x1a,
+    0x10, 0xb1, 0x6, 0xc1, 0x0, 0x0, 0x7, 0xa0,
+    0xb1, 0xb, 0x10, 0x0, 0x0, 0x1, 0x90, 0xb1,
+    0x72, 0x0, 0x0, 0x16, 0x55, 0x56, 0xd8, 0x85,
+    0x5b, 0x70, 0x0, 0x0, 0xb, 0xf7, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x4a, 0xb2, 0x80, 0x0, 0x0,
+    0x0, 0x1, 0xc1, 0xb1, 0x67, 0x0, 0x0, 0x0,
+    0xb, 0x20, 0xb1, 0xa, 0x80, 0x0, 0x0, 0x91,
+    0x0, 0xb1, 0x0, 0xbd, 0x60, 0x26, 0x0, 0x0,
+    0xb1, 0x0, 0x9, 0x50, 0x0, 0x0, 0x0, 0xb2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+7CBE "精" */
+    0x0, 0x2, 0x0, 0x0, 0x5, 0x0, 0x0, 0x0,
+    0xd, 0x10, 0x0, 0xc, 0x0, 0x0, 0x6, 0xb,
+    0xb, 0x36, 0x5c, 0x57, 0x60, 0x6, 0x6b, 0x63,
+    0x0, 0xb, 0x3, 0x0, 0x1, 0x3b, 0x31, 0x6,
+    0x5c, 0x56, 0x10, 0x6, 0x5d, 0x57, 0x45, 0x5c,
+    0x55, 0x90, 0x0, 0x5e, 0x10, 0x12, 0x0, 0x2,
+    0x0, 0x0, 0xac, 0xa4, 0xc, 0x55, 0x5d, 0x10,
+    0x1, 0x9b, 0x27, 0xc, 0x55, 0x5c, 0x0, 0x7,
+    0x2b, 0x0, 0xb, 0x0, 0xb, 0x0, 0x14, 0xb,
+    0x0, 0xc, 0x55, 0x5c, 0x0, 0x10, 0xb, 0x0,
+    0xb, 0x0, 0xb, 0x0, 0x0, 0xc, 0x0, 0xb,
+    0x2, 0x8c, 0x0, 0x0, 0x2, 0x0, 0x3, 0x0,
+    0x12, 0x0,
+
+    /* U+7CD6 "糖" */
+    0x0, 0x20, 0x0, 0x0, 0x31, 0x0, 0x0, 0x0,
+    0x67, 0x0, 0x0, 0xc, 0x0, 0x10, 0x15, 0x65,
+    0x95, 0xb5, 0x59, 0x57, 0x70, 0xc, 0x66, 0x90,
+    0xb0, 0xc, 0x1, 0x0, 0x5, 0x69, 0x0, 0xb4,
+    0x6c, 0x5d, 0x0, 0x36, 0xa8, 0x95, 0xb1, 0x1b,
+    0xb, 0x50, 0x0, 0xb5, 0x0, 0xa5, 0x4c, 0x5c,
+    0x40, 0x0, 0xea, 0x71, 0xa3, 0x5c, 0x5c, 0x0,
+    0x5, 0xa5, 0xa3, 0x81, 0xb, 0x4, 0x0, 0x7,
+    0x65, 0x6, 0x58, 0x56, 0x5b, 0x10, 0x31, 0x65,
+    0x9, 0xa, 0x0, 0xb, 0x0, 0x0, 0x75, 0x16,
+    0xa, 0x0, 0xb, 0x0, 0x0, 0x75, 0x60, 0xb,
+    0x55, 0x5c, 0x0, 0x0, 0x20, 0x0, 0x2, 0x0,
+    0x0, 0x0,
+
+    /* U+7CFB "系" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x42, 0x0, 0x0,
+    0x2, 0x46, 0x79, 0xaa, 0x60, 0x0, 0x24, 0x32,
+    0xb7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x85, 0x0,
+    0x25, 0x0, 0x0, 0x4, 0x94, 0x23, 0x5c, 0x60,
+    0x0, 0x0, 0x9a, 0x65, 0xa7, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0x81, 0x3, 0x60, 0x0, 0x1, 0x8b,
+    0x64, 0x55, 0x59, 0xe1, 0x0, 0x1a, 0x64, 0x2c,
+    0x0, 0x9, 0x20, 0x0, 0x7, 0x70, 0xc1, 0x61,
+    0x0, 0x0, 0x5, 0xb1, 0xc, 0x1, 0xb9, 0x0,
+    0x7, 0x60, 0x21, 0xc0, 0x0, 0xc8, 0x5, 0x10,
+    0x3, 0xca, 0x0, 0x1, 0x50, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x0,
+
+    /* U+7D00 "紀" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0x30, 0x0, 0x0, 0x5, 0x10, 0x0, 0x38,
+    0x0, 0x36, 0x55, 0x5d, 0x20, 0x0, 0x80, 0x34,
+    0x0, 0x0, 0xc, 0x0, 0xb, 0x65, 0xb3, 0x0,
+    0x0, 0xc, 0x0, 0x6, 0x38, 0x40, 0x7, 0x55,
+    0x5d, 0x0, 0x0, 0x65, 0x26, 0xc, 0x0, 0x6,
+    0x0, 0x8, 0x84, 0x6d, 0x2c, 0x0, 0x0, 0x0,
+    0xb, 0x82, 0x6, 0x1c, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x16, 0xc, 0x0, 0x0, 0x20, 0x6, 0xb,
+    0xb, 0x2c, 0x0, 0x0, 0x80, 0xb, 0xb, 0x36,
+    0x3d, 0x0, 0x0, 0xc0, 0x36, 0x3, 0x0, 0x9,
+    0xdb, 0xbd, 0xe1,
+
+    /* U+7D04 "約" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xa0, 0x0, 0x6b, 0x0, 0x0, 0x0, 0xa,
+    0x10, 0x0, 0xa3, 0x0, 0x0, 0x0, 0x72, 0x9,
+    0x1, 0xd5, 0x55, 0xb1, 0x7, 0xa6, 0x97, 0x6,
+    0x20, 0x0, 0xc0, 0x4, 0x54, 0x80, 0x15, 0x0,
+    0x0, 0xc0, 0x0, 0x38, 0x8, 0x12, 0x20, 0x0,
+    0xc0, 0x5, 0xb4, 0x6a, 0x80, 0xb6, 0x0, 0xb0,
+    0x5, 0x83, 0x2, 0x50, 0x1d, 0x1, 0xa0, 0x0,
+    0x12, 0x5, 0x10, 0x1, 0x2, 0x90, 0x4, 0x36,
+    0x51, 0xc0, 0x0, 0x4, 0x80, 0xb, 0x23, 0xa0,
+    0xa0, 0x0, 0x6, 0x60, 0x9, 0x0, 0x20, 0x0,
+    0x5, 0xce, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x10, 0x0,
+
+    /* U+7D19 "紙" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x10, 0x0, 0x1, 0x7c, 0x10, 0x0, 0x74,
+    0x0, 0x85, 0x6d, 0x40, 0x0, 0x3, 0x70, 0x63,
+    0x91, 0xb, 0x0, 0x0, 0x2d, 0x76, 0xb1, 0x91,
+    0xb, 0x0, 0x0, 0x6, 0x19, 0x10, 0x91, 0xa,
+    0x3, 0x30, 0x0, 0x91, 0x62, 0x95, 0x5b, 0x55,
+    0x40, 0x1c, 0x66, 0x8b, 0x91, 0x7, 0x20, 0x0,
+    0x9, 0x40, 0x7, 0x91, 0x5, 0x60, 0x0, 0x1,
+    0x20, 0x61, 0x91, 0x0, 0xa0, 0x10, 0x7, 0x47,
+    0x2b, 0x91, 0x1, 0xa2, 0x60, 0x39, 0xb, 0x2,
+    0xa7, 0x50, 0x2c, 0xa0, 0x64, 0x0, 0x0, 0xa4,
+    0x0, 0x2, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7D20 "素" */
+    0x0, 0x0, 0x0, 0x13, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2b, 0x0, 0x6, 0x0, 0x0, 0x56,
+    0x55, 0x6b, 0x55, 0x55, 0x20, 0x0, 0x5, 0x55,
+    0x6b, 0x55, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x29,
+    0x0, 0x0, 0x60, 0x6, 0x55, 0x5b, 0xa5, 0x55,
+    0x55, 0x62, 0x0, 0x2, 0x75, 0x12, 0xc6, 0x0,
+    0x0, 0x0, 0x7, 0x96, 0x8a, 0x33, 0x0, 0x0,
+    0x0, 0x0, 0x48, 0x40, 0x6, 0xa0, 0x0, 0x0,
+    0xe, 0xd8, 0x8c, 0x53, 0x75, 0x0, 0x0, 0x2,
+    0x92, 0x29, 0x25, 0x10, 0x0, 0x0, 0x9, 0x70,
+    0x29, 0x2, 0xb8, 0x0, 0x2, 0x61, 0x16, 0xd8,
+    0x0, 0xc, 0x20, 0x0, 0x0, 0x0, 0x30, 0x0,
+    0x0, 0x0,
+
+    /* U+7D30 "細" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x10, 0x0, 0x0, 0x0, 0x10, 0x0, 0x74,
+    0x0, 0xb5, 0x5a, 0x57, 0xc0, 0x3, 0x60, 0x62,
+    0xb0, 0xb, 0x2, 0x90, 0x3c, 0x66, 0xc1, 0xb0,
+    0xb, 0x2, 0x90, 0x6, 0x2a, 0x10, 0xb0, 0xb,
+    0x2, 0x90, 0x0, 0x91, 0x70, 0xb5, 0x5c, 0x56,
+    0x90, 0x2c, 0x66, 0x98, 0xb0, 0xb, 0x2, 0x90,
+    0x1a, 0x51, 0x16, 0xb0, 0xb, 0x2, 0x90, 0x1,
+    0x10, 0x61, 0xb0, 0xb, 0x2, 0x90, 0x7, 0x28,
+    0x3b, 0xb0, 0xb, 0x2, 0x90, 0x2a, 0xd, 0x5,
+    0xb5, 0x5b, 0x56, 0x90, 0x44, 0x1, 0x0, 0xb0,
+    0x0, 0x2, 0x90, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+7D39 "紹" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0x50, 0x35, 0x55, 0x55, 0xa1, 0x0, 0x2a,
+    0x0, 0x10, 0xa3, 0x0, 0xc0, 0x0, 0x90, 0x16,
+    0x0, 0xc1, 0x1, 0xb0, 0xa, 0x75, 0xa5, 0x1,
+    0xc0, 0x3, 0x90, 0x7, 0x57, 0x60, 0x7, 0x50,
+    0x5, 0x70, 0x0, 0x47, 0x33, 0x27, 0x1, 0x8d,
+    0x30, 0x6, 0x82, 0x5d, 0x43, 0x0, 0x3, 0x40,
+    0xa, 0x94, 0x17, 0xc, 0x55, 0x55, 0xd0, 0x0,
+    0x2, 0x18, 0xb, 0x0, 0x0, 0xb0, 0x4, 0x28,
+    0x28, 0x6b, 0x0, 0x0, 0xb0, 0xb, 0x26, 0x61,
+    0x3c, 0x55, 0x55, 0xb0, 0x8, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7D42 "終" */
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0xa, 0x30, 0x2, 0xe1, 0x0, 0x0, 0x0, 0x39,
+    0x0, 0x8, 0x85, 0x5a, 0x20, 0x0, 0x90, 0x35,
+    0x2b, 0x10, 0x2b, 0x0, 0xb, 0x76, 0xb3, 0x60,
+    0x70, 0xa2, 0x0, 0x5, 0x38, 0x40, 0x0, 0x5a,
+    0x70, 0x0, 0x0, 0x64, 0x25, 0x0, 0x4e, 0x60,
+    0x0, 0x9, 0x85, 0x5d, 0x15, 0x70, 0xab, 0x50,
+    0x8, 0x62, 0x5, 0x62, 0x29, 0x25, 0x81, 0x1,
+    0x2, 0x35, 0x0, 0x4, 0xa0, 0x0, 0x7, 0xa,
+    0xc, 0x12, 0x62, 0x10, 0x0, 0xc, 0xb, 0x23,
+    0x0, 0x1a, 0xb1, 0x0, 0x26, 0x0, 0x0, 0x0,
+    0x0, 0x89, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0,
+
+    /* U+7D44 "組" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x30, 0x7, 0x55, 0x59, 0x0, 0x0, 0x47,
+    0x0, 0xc, 0x0, 0xc, 0x0, 0x1, 0x80, 0x36,
+    0xc, 0x0, 0xc, 0x0, 0xc, 0x76, 0xb3, 0xc,
+    0x0, 0xc, 0x0, 0x6, 0x38, 0x30, 0xd, 0x55,
+    0x5c, 0x0, 0x0, 0x74, 0x26, 0xc, 0x0, 0xc,
+    0x0, 0xa, 0x85, 0x6d, 0x2c, 0x0, 0xc, 0x0,
+    0x8, 0x61, 0x5, 0x1d, 0x55, 0x5c, 0x0, 0x1,
+    0x3, 0x26, 0xc, 0x0, 0xc, 0x0, 0x7, 0xa,
+    0xc, 0x1c, 0x0, 0xc, 0x0, 0xc, 0x9, 0x32,
+    0xc, 0x0, 0xc, 0x0, 0x16, 0x0, 0x4, 0x5d,
+    0x55, 0x5d, 0xd1, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7D4C "経" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x66, 0x55, 0x59, 0x40, 0x0, 0x74,
+    0x0, 0x7, 0x0, 0x1d, 0x20, 0x2, 0x70, 0x62,
+    0x2, 0x70, 0xa4, 0x0, 0x1c, 0x55, 0xb0, 0x0,
+    0x7b, 0x60, 0x0, 0x7, 0x3a, 0x10, 0x0, 0x9b,
+    0xa2, 0x0, 0x0, 0x82, 0x61, 0x48, 0x14, 0x4d,
+    0xc2, 0x9, 0x64, 0x7b, 0x10, 0xd, 0x0, 0x10,
+    0xa, 0x62, 0x7, 0x25, 0x5d, 0x59, 0x50, 0x0,
+    0x12, 0x52, 0x1, 0xc, 0x0, 0x0, 0x7, 0xb,
+    0xd, 0x0, 0xc, 0x0, 0x0, 0x1c, 0xc, 0x5,
+    0x0, 0xc, 0x0, 0x70, 0x25, 0x0, 0x3, 0x65,
+    0x55, 0x55, 0x51,
+
+    /* U+7D50 "結" */
+    0x0, 0x1, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0xc, 0x20, 0x0, 0xc, 0x10, 0x0, 0x0, 0x66,
+    0x0, 0x0, 0xb, 0x0, 0x0, 0x2, 0x80, 0x54,
+    0x45, 0x5c, 0x55, 0xb1, 0x1c, 0x66, 0xc2, 0x10,
+    0xb, 0x0, 0x0, 0x7, 0x39, 0x20, 0x0, 0xb,
+    0x0, 0x0, 0x0, 0x83, 0x34, 0x16, 0x5a, 0x59,
+    0x40, 0x1a, 0x64, 0x6e, 0x10, 0x0, 0x0, 0x0,
+    0xb, 0x62, 0x7, 0xb, 0x55, 0x5c, 0x20, 0x1,
+    0x3, 0x26, 0xb, 0x0, 0xb, 0x0, 0x6, 0xa,
+    0xb, 0x2b, 0x0, 0xb, 0x0, 0xc, 0xa, 0x34,
+    0x1c, 0x55, 0x5c, 0x0, 0x27, 0x1, 0x0, 0xb,
+    0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7D61 "絡" */
+    0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0,
+    0x1c, 0x0, 0x4, 0xb0, 0x0, 0x0, 0x0, 0x73,
+    0x0, 0xa, 0x75, 0x59, 0x10, 0x2, 0x70, 0x60,
+    0x2b, 0x0, 0x3c, 0x10, 0x1b, 0x34, 0xc0, 0x72,
+    0x50, 0xc1, 0x0, 0x9, 0x4b, 0x12, 0x0, 0x5b,
+    0x30, 0x0, 0x0, 0x72, 0x60, 0x0, 0x99, 0x80,
+    0x0, 0x8, 0x42, 0x87, 0x37, 0x10, 0x5d, 0x91,
+    0x1e, 0x95, 0x29, 0x28, 0x55, 0x59, 0x20, 0x0,
+    0x0, 0x20, 0xb, 0x0, 0xb, 0x0, 0x5, 0x6,
+    0x56, 0xb, 0x0, 0xb, 0x0, 0xb, 0xd, 0x1b,
+    0xb, 0x0, 0xb, 0x0, 0x48, 0x6, 0x0, 0xd,
+    0x55, 0x5b, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x0,
+
+    /* U+7D66 "給" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x8, 0x50, 0x0, 0x2e, 0x10, 0x0, 0x0, 0x1a,
+    0x0, 0x0, 0x87, 0x40, 0x0, 0x0, 0x81, 0x34,
+    0x1, 0xb0, 0x70, 0x0, 0x7, 0x85, 0xa3, 0x9,
+    0x20, 0x1b, 0x10, 0x4, 0x57, 0x50, 0x63, 0x0,
+    0x16, 0xe4, 0x0, 0x36, 0x27, 0x16, 0x55, 0x64,
+    0x30, 0x4, 0xa4, 0x6d, 0x11, 0x0, 0x3, 0x0,
+    0x5, 0x83, 0x6, 0x1c, 0x55, 0x5d, 0x10, 0x1,
+    0x14, 0x35, 0xa, 0x0, 0xb, 0x0, 0x6, 0x27,
+    0x3d, 0x2a, 0x0, 0xb, 0x0, 0xd, 0x6, 0x54,
+    0x1c, 0x55, 0x5c, 0x0, 0x3, 0x0, 0x0, 0x1a,
+    0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7D71 "統" */
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0xb, 0x30, 0x0, 0x97, 0x0, 0x0, 0x0, 0x38,
+    0x0, 0x0, 0x17, 0x0, 0x60, 0x0, 0x90, 0x34,
+    0x65, 0xa8, 0x55, 0x50, 0xb, 0x65, 0xb3, 0x3,
+    0xa0, 0x31, 0x0, 0x7, 0x38, 0x30, 0x47, 0x0,
+    0x1b, 0x20, 0x0, 0x64, 0x34, 0x99, 0x65, 0x36,
+    0x80, 0x9, 0x74, 0x6e, 0x16, 0x50, 0xa0, 0x0,
+    0xb, 0x83, 0x17, 0x7, 0x40, 0xb0, 0x0, 0x1,
+    0x11, 0x55, 0x9, 0x20, 0xb0, 0x0, 0x7, 0xb,
+    0xc, 0xb, 0x0, 0xb0, 0x30, 0x1c, 0xa, 0x1,
+    0x57, 0x0, 0xb0, 0x60, 0x13, 0x0, 0x6, 0x60,
+    0x0, 0xba, 0xd4, 0x0, 0x0, 0x30, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7D75 "絵" */
+    0x0, 0x1, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0,
+    0x1d, 0x0, 0x0, 0x8a, 0x0, 0x0, 0x0, 0x93,
+    0x0, 0x1, 0xc5, 0x20, 0x0, 0x4, 0x50, 0x82,
+    0x9, 0x30, 0x91, 0x0, 0x2d, 0x77, 0xb0, 0x55,
+    0x0, 0x1c, 0x40, 0x5, 0x1a, 0x14, 0x34, 0x55,
+    0xb5, 0xb3, 0x0, 0x91, 0x62, 0x1, 0x0, 0x0,
+    0x0, 0x1a, 0x44, 0x8b, 0x0, 0x0, 0x4, 0x30,
+    0x1d, 0x73, 0x8, 0x55, 0xa7, 0x55, 0x40, 0x0,
+    0x11, 0x51, 0x1, 0xd2, 0x0, 0x0, 0x6, 0xa,
+    0x1c, 0x9, 0x20, 0x33, 0x0, 0xa, 0xb, 0x6,
+    0x74, 0x12, 0x3c, 0x20, 0x24, 0x0, 0x0, 0xb9,
+    0x64, 0x25, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7D93 "經" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0x1, 0x55, 0x55, 0x58, 0x90, 0x0, 0x82,
+    0x0, 0x23, 0x5, 0x4, 0x0, 0x2, 0x60, 0x70,
+    0x68, 0x3a, 0x1c, 0x10, 0x1b, 0x46, 0xa0, 0x90,
+    0x80, 0x71, 0x0, 0x8, 0x3a, 0x1, 0x70, 0x80,
+    0x83, 0x0, 0x0, 0x82, 0x50, 0x86, 0x4a, 0xd,
+    0x10, 0x7, 0x51, 0x95, 0x26, 0x7, 0x4, 0x0,
+    0xd, 0xa5, 0x47, 0x45, 0x55, 0x57, 0x70, 0x1,
+    0x1, 0x41, 0x10, 0xb, 0x0, 0x0, 0x6, 0x9,
+    0x1b, 0x0, 0xb, 0x0, 0x0, 0xc, 0xc, 0x6,
+    0x0, 0xb, 0x0, 0x0, 0x18, 0x2, 0x2, 0x55,
+    0x5c, 0x56, 0xd1, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+7D9A "続" */
+    0x0, 0x1, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x1c, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x73,
+    0x0, 0x55, 0x5c, 0x57, 0xa0, 0x1, 0x70, 0x60,
+    0x10, 0xb, 0x0, 0x0, 0xb, 0x45, 0xa0, 0x6,
+    0x5a, 0x5a, 0x10, 0x8, 0x4a, 0x0, 0x30, 0x0,
+    0x0, 0x20, 0x0, 0x72, 0x50, 0xa5, 0x55, 0x55,
+    0xe1, 0x6, 0x51, 0x96, 0x74, 0x51, 0x44, 0x20,
+    0xd, 0xa6, 0x57, 0x5, 0x71, 0xa0, 0x0, 0x1,
+    0x0, 0x30, 0x7, 0x41, 0x90, 0x0, 0x5, 0x17,
+    0x2a, 0xa, 0x1, 0x90, 0x40, 0xb, 0xc, 0x7,
+    0x47, 0x1, 0x90, 0x70, 0x17, 0x3, 0x6, 0x60,
+    0x0, 0xca, 0xe2, 0x0, 0x0, 0x30, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7DAD "維" */
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x1b, 0x0, 0x6, 0x6a, 0x30, 0x0, 0x0, 0x82,
+    0x0, 0xb, 0x14, 0x80, 0x0, 0x2, 0x60, 0x70,
+    0x1d, 0x57, 0x58, 0x80, 0x1b, 0x56, 0xa0, 0x7b,
+    0xa, 0x10, 0x0, 0x6, 0x2a, 0x1, 0x6b, 0xa,
+    0x11, 0x0, 0x0, 0x81, 0x74, 0xc, 0x5c, 0x57,
+    0x40, 0x9, 0x54, 0xa7, 0xb, 0xa, 0x10, 0x0,
+    0xc, 0x72, 0x16, 0xb, 0xa, 0x13, 0x10, 0x1,
+    0x20, 0x51, 0xc, 0x5c, 0x55, 0x30, 0x6, 0x19,
+    0x1d, 0xb, 0xa, 0x10, 0x0, 0x2a, 0xc, 0x5,
+    0xb, 0xa, 0x12, 0x50, 0x33, 0x0, 0x0, 0xd,
+    0x55, 0x55, 0x50, 0x0, 0x0, 0x0, 0x2, 0x0,
+    0x0, 0x0,
+
+    /* U+7DB2 "網" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1b, 0x0, 0x85, 0x55, 0x55, 0xa1, 0x0, 0x72,
+    0x0, 0xb2, 0x20, 0x82, 0xc0, 0x2, 0x60, 0x60,
+    0xb0, 0xb2, 0x90, 0xc0, 0x1c, 0x67, 0x90, 0xb4,
+    0x88, 0x86, 0xc0, 0x6, 0x2a, 0x0, 0xb1, 0x42,
+    0x0, 0xc0, 0x0, 0x91, 0x60, 0xb0, 0xd, 0x0,
+    0xc0, 0x9, 0x54, 0xa6, 0xb6, 0x86, 0x77, 0xc0,
+    0xb, 0x72, 0x25, 0xb0, 0xb0, 0x0, 0xc0, 0x1,
+    0x20, 0x70, 0xb0, 0xb0, 0x40, 0xc0, 0x7, 0x45,
+    0x76, 0xb1, 0x75, 0x52, 0xc0, 0x3a, 0x29, 0x23,
+    0xb0, 0x0, 0x0, 0xc0, 0x42, 0x0, 0x0, 0xb0,
+    0x0, 0x5d, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0,
+
+    /* U+7DD1 "緑" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1b, 0x0, 0x65, 0x55, 0x5c, 0x0, 0x0, 0x82,
+    0x0, 0x0, 0x0, 0xc, 0x0, 0x3, 0x50, 0x70,
+    0x26, 0x55, 0x5c, 0x0, 0x1c, 0x67, 0x80, 0x0,
+    0x0, 0xc, 0x20, 0x6, 0x29, 0x1, 0x75, 0x69,
+    0x58, 0x81, 0x0, 0x90, 0x70, 0x20, 0x2d, 0x2,
+    0x60, 0xb, 0x66, 0xa6, 0x86, 0x2c, 0x68, 0x20,
+    0x9, 0x50, 0x24, 0x9, 0x3a, 0xa0, 0x0, 0x2,
+    0x31, 0x91, 0x5, 0x7a, 0x64, 0x0, 0x8, 0x1a,
+    0x57, 0x94, 0x2a, 0xb, 0x20, 0x4a, 0x8, 0x7,
+    0x30, 0x29, 0x2, 0xc2, 0x21, 0x0, 0x0, 0x5,
+    0xe7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20,
+    0x0, 0x0,
+
+    /* U+7DD2 "緒" */
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x1a, 0x0, 0x0, 0x92, 0x1, 0x0, 0x0, 0x82,
+    0x0, 0x0, 0x91, 0x2b, 0x20, 0x2, 0x60, 0x60,
+    0x65, 0xb6, 0x98, 0x0, 0x1b, 0x46, 0xa0, 0x0,
+    0x91, 0xa0, 0x10, 0x7, 0x3a, 0x5, 0x65, 0x9b,
+    0x76, 0xa0, 0x0, 0x91, 0x60, 0x0, 0x75, 0x0,
+    0x0, 0xa, 0x54, 0xa7, 0xa, 0xa5, 0x59, 0x0,
+    0xb, 0x62, 0x26, 0x89, 0x0, 0xa, 0x0, 0x1,
+    0x20, 0x64, 0x1b, 0x55, 0x5b, 0x0, 0x7, 0x36,
+    0x84, 0x9, 0x0, 0xa, 0x0, 0x2a, 0x1b, 0x25,
+    0x19, 0x0, 0xa, 0x0, 0x33, 0x1, 0x0, 0x1b,
+    0x55, 0x5b, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0,
+
+    /* U+7DDA "線" */
+    0x0, 0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0,
+    0x29, 0x0, 0x0, 0x85, 0x0, 0x0, 0x0, 0x92,
+    0x0, 0x95, 0x85, 0x5c, 0x10, 0x3, 0x50, 0x50,
+    0xb0, 0x0, 0xb, 0x0, 0x2a, 0x37, 0x80, 0xb5,
+    0x55, 0x5c, 0x0, 0x18, 0x4a, 0x0, 0xb0, 0x0,
+    0xb, 0x0, 0x0, 0x92, 0x40, 0xa5, 0x6b, 0x59,
+    0x0, 0x9, 0x33, 0xd1, 0x1, 0x1d, 0x1, 0x50,
+    0x1d, 0x73, 0x74, 0x6c, 0x8b, 0x59, 0x50, 0x2,
+    0x30, 0x80, 0xb, 0x1a, 0x90, 0x0, 0x7, 0x65,
+    0x93, 0x83, 0x1a, 0x57, 0x0, 0x86, 0x37, 0x15,
+    0x50, 0x1a, 0xa, 0xa1, 0x30, 0x0, 0x42, 0x6,
+    0xd8, 0x1, 0x20, 0x0, 0x0, 0x0, 0x0, 0x30,
+    0x0, 0x0,
+
+    /* U+7DE0 "締" */
+    0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0,
+    0x1b, 0x0, 0x0, 0x5b, 0x0, 0x0, 0x0, 0x82,
+    0x2, 0x65, 0x59, 0x58, 0x70, 0x2, 0x60, 0x50,
+    0x8, 0x0, 0xa2, 0x0, 0x1a, 0x35, 0xa0, 0x5,
+    0x60, 0x80, 0x0, 0x8, 0x4a, 0x5, 0x75, 0x56,
+    0x55, 0xd1, 0x0, 0x81, 0x5b, 0x10, 0x18, 0x2,
+    0x30, 0x8, 0x42, 0xa3, 0x20, 0x19, 0x3, 0x0,
+    0xe, 0x94, 0x55, 0xa5, 0x6b, 0x5c, 0x10, 0x0,
+    0x10, 0x50, 0xa0, 0x19, 0xa, 0x0, 0x6, 0x63,
+    0x85, 0xa0, 0x19, 0xa, 0x0, 0x29, 0x2a, 0x13,
+    0x90, 0x19, 0x7b, 0x0, 0x53, 0x1, 0x0, 0x0,
+    0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0,
+
+    /* U+7DE9 "緩" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x1c, 0x0, 0x35, 0x67, 0x9b, 0x40, 0x0, 0x85,
+    0x0, 0x30, 0x50, 0x1a, 0x0, 0x2, 0x70, 0x60,
+    0x65, 0x46, 0x55, 0x0, 0x1b, 0x46, 0xa1, 0x77,
+    0x65, 0x88, 0x60, 0x7, 0x3a, 0x0, 0x1, 0xa0,
+    0x0, 0x0, 0x0, 0x81, 0x64, 0x67, 0xa5, 0x55,
+    0xb1, 0x8, 0x54, 0xa6, 0x8, 0x40, 0x0, 0x0,
+    0xb, 0x72, 0x25, 0xb, 0x85, 0x6d, 0x0, 0x2,
+    0x30, 0x60, 0x47, 0x70, 0xa4, 0x0, 0x8, 0x38,
+    0x85, 0x90, 0x1c, 0x70, 0x0, 0x59, 0x9, 0x19,
+    0x10, 0x7a, 0xb2, 0x0, 0x10, 0x0, 0x21, 0x27,
+    0x30, 0x3d, 0xb2, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x20,
+
+    /* U+7DF4 "練" */
+    0x0, 0x1, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x1c, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0x72,
+    0x3, 0x65, 0x5c, 0x56, 0xb1, 0x2, 0x60, 0x70,
+    0x0, 0xa, 0x0, 0x0, 0x1c, 0x56, 0x90, 0x95,
+    0x5c, 0x5b, 0x20, 0x6, 0x29, 0x0, 0xa5, 0xa,
+    0x7b, 0x0, 0x0, 0x81, 0x60, 0xa4, 0x6a, 0x7a,
+    0x0, 0x8, 0x53, 0x97, 0xb5, 0x6d, 0x5c, 0x0,
+    0xc, 0x73, 0x26, 0x61, 0xdb, 0x33, 0x0, 0x1,
+    0x11, 0x61, 0x8, 0x5a, 0x80, 0x0, 0x6, 0xa,
+    0x3a, 0x39, 0xa, 0x49, 0x0, 0x1b, 0xc, 0x5,
+    0x80, 0xa, 0x9, 0xc3, 0x25, 0x0, 0x14, 0x0,
+    0xa, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0,
+
+    /* U+7E3D "總" */
+    0x0, 0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x76, 0x0, 0x0, 0x0, 0x73,
+    0x0, 0x94, 0x84, 0x48, 0x70, 0x1, 0x70, 0x60,
+    0xa0, 0xa5, 0x27, 0x50, 0xb, 0x45, 0xa0, 0xa3,
+    0x85, 0xc9, 0x50, 0x7, 0x39, 0x0, 0xa3, 0x39,
+    0x76, 0x50, 0x0, 0x81, 0x60, 0xb1, 0x66, 0xc6,
+    0x50, 0x9, 0x65, 0x97, 0xb8, 0x66, 0x7a, 0x50,
+    0xa, 0x62, 0x15, 0x21, 0x44, 0x2, 0x0, 0x0,
+    0x14, 0x30, 0x2c, 0xd, 0x14, 0x60, 0x5, 0x63,
+    0xc6, 0x2a, 0x3, 0x3, 0xc2, 0x1a, 0x37, 0x1d,
+    0xa, 0x0, 0x6, 0x10, 0x56, 0x0, 0x1, 0xd,
+    0xaa, 0xbc, 0x0,
+
+    /* U+7E3E "績" */
+    0x0, 0x0, 0x0, 0x0, 0x12, 0x0, 0x0, 0x0,
+    0x1c, 0x0, 0x0, 0x2a, 0x4, 0x0, 0x0, 0x73,
+    0x3, 0x65, 0x6b, 0x56, 0x30, 0x1, 0x70, 0x60,
+    0x46, 0x6b, 0x58, 0x0, 0xb, 0x45, 0x91, 0x11,
+    0x39, 0x14, 0x70, 0x7, 0x39, 0x3, 0x63, 0x33,
+    0x36, 0x30, 0x0, 0x72, 0x60, 0xc5, 0x55, 0x5d,
+    0x20, 0x7, 0x52, 0xa5, 0xc5, 0x55, 0x5c, 0x0,
+    0xc, 0x94, 0x36, 0xc4, 0x44, 0x4c, 0x0, 0x0,
+    0x20, 0x50, 0xc1, 0x11, 0x1b, 0x0, 0x6, 0x37,
+    0x57, 0xa6, 0x55, 0x5a, 0x0, 0x1b, 0xc, 0x3,
+    0xb, 0x60, 0x67, 0x10, 0x24, 0x0, 0x1, 0x93,
+    0x0, 0x5, 0xd0, 0x0, 0x0, 0x3, 0x0, 0x0,
+    0x0, 0x30,
+
+    /* U+7E54 "織" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x10, 0x0, 0x0,
+    0x83, 0x0, 0x39, 0x0, 0xa0, 0x0, 0x0, 0x90,
+    0x6, 0x58, 0x93, 0x97, 0x10, 0x6, 0x13, 0x15,
+    0x20, 0xc0, 0x92, 0x90, 0x49, 0x4b, 0x21, 0x93,
+    0x40, 0x90, 0x0, 0x35, 0x74, 0x26, 0x57, 0x55,
+    0xb5, 0xb1, 0x1, 0x74, 0x22, 0x0, 0x30, 0x93,
+    0x20, 0x19, 0x25, 0xb9, 0x65, 0xc0, 0x99, 0x40,
+    0x4b, 0x51, 0x79, 0x10, 0xa0, 0x9b, 0x0, 0x0,
+    0x24, 0x29, 0x65, 0xa0, 0xa5, 0x0, 0x7, 0x92,
+    0xc9, 0x10, 0xa1, 0xc6, 0x22, 0x77, 0x75, 0x2a,
+    0x65, 0x97, 0xb, 0xa0, 0x41, 0x0, 0x1, 0x1,
+    0x50, 0x1, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7E70 "繰" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x10, 0xb, 0x55, 0x5c, 0x0, 0x0, 0x45,
+    0x0, 0xb, 0x0, 0xb, 0x0, 0x0, 0x80, 0x61,
+    0xb, 0x55, 0x5a, 0x0, 0xb, 0x86, 0xb0, 0x75,
+    0x70, 0x75, 0x70, 0x4, 0x19, 0x10, 0xa0, 0xa0,
+    0xb0, 0x90, 0x0, 0x73, 0x61, 0xc5, 0xb0, 0xc5,
+    0xa0, 0x6, 0x84, 0x8a, 0x40, 0x36, 0x50, 0x30,
+    0x8, 0x83, 0x7, 0x65, 0x6e, 0x55, 0xb1, 0x0,
+    0x10, 0x61, 0x0, 0xbc, 0x50, 0x0, 0x7, 0xa,
+    0x2a, 0x9, 0x2c, 0x64, 0x0, 0x1b, 0xc, 0x3,
+    0x82, 0xc, 0x9, 0x81, 0x14, 0x0, 0x15, 0x0,
+    0xc, 0x0, 0x60, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0,
+
+    /* U+7E7C "繼" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x56, 0x8, 0x16, 0x0, 0x33, 0x0, 0x0, 0xa0,
+    0xa, 0x37, 0x40, 0x93, 0x20, 0x6, 0x31, 0x3a,
+    0xb6, 0xa6, 0x8a, 0x20, 0x3a, 0x49, 0x4a, 0x18,
+    0x30, 0x64, 0x10, 0x26, 0x57, 0xa, 0xa7, 0x96,
+    0xa4, 0xa0, 0x1, 0x81, 0x4a, 0x10, 0x0, 0x13,
+    0x50, 0x1a, 0x34, 0xda, 0x59, 0x55, 0x69, 0x30,
+    0x2c, 0x51, 0x6a, 0x18, 0x30, 0x73, 0x20, 0x0,
+    0x13, 0xa, 0x95, 0xa6, 0x89, 0x40, 0x6, 0x81,
+    0xba, 0x18, 0x20, 0x64, 0x30, 0x56, 0x84, 0x7a,
+    0x96, 0x95, 0xa4, 0x90, 0x61, 0x10, 0xc, 0x75,
+    0x86, 0x67, 0xb0, 0x0, 0x0, 0x3, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7E8C "續" */
+    0x0, 0x0, 0x0, 0x0, 0x15, 0x0, 0x0, 0x0,
+    0xb, 0x2, 0x55, 0x6c, 0x55, 0xb1, 0x0, 0x64,
+    0x0, 0x21, 0x2a, 0x15, 0x20, 0x1, 0x80, 0x40,
+    0x55, 0x44, 0x44, 0x40, 0x9, 0x23, 0xb0, 0xb5,
+    0xa5, 0xa5, 0xc0, 0xa, 0x5b, 0x10, 0xa0, 0x90,
+    0x90, 0xa0, 0x0, 0x63, 0x50, 0x95, 0x55, 0x56,
+    0x50, 0x6, 0x52, 0x95, 0x87, 0x55, 0x5a, 0x50,
+    0xd, 0x95, 0x37, 0x77, 0x55, 0x5a, 0x40, 0x0,
+    0x10, 0x30, 0x87, 0x55, 0x5a, 0x40, 0x6, 0x64,
+    0x93, 0x87, 0x55, 0x5a, 0x40, 0x29, 0x2a, 0x34,
+    0x39, 0x60, 0x48, 0x10, 0x43, 0x1, 0x4, 0x84,
+    0x0, 0x4, 0xd0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x20,
+
+    /* U+7EDF "统" */
+    0x0, 0x22, 0x0, 0x4, 0x0, 0x0, 0x0, 0x9,
+    0x70, 0x0, 0x2c, 0x0, 0x0, 0x1, 0xb0, 0x5,
+    0x55, 0xa5, 0x6c, 0x10, 0x81, 0xa, 0x20, 0x77,
+    0x0, 0x0, 0x57, 0x39, 0x70, 0x19, 0x2, 0x0,
+    0x7, 0x65, 0x80, 0x8, 0x0, 0x3a, 0x20, 0x1,
+    0x90, 0xb, 0xaa, 0x6a, 0x7c, 0x1, 0xa2, 0x34,
+    0x34, 0xa0, 0xb0, 0x30, 0x6d, 0x72, 0x0, 0x39,
+    0xb, 0x0, 0x0, 0x0, 0x0, 0x5, 0x70, 0xb0,
+    0x0, 0x14, 0x76, 0x40, 0x93, 0xb, 0x4, 0x8,
+    0x81, 0x0, 0x3a, 0x0, 0xb0, 0x61, 0x0, 0x0,
+    0x57, 0x0, 0xb, 0xbc, 0x40, 0x0, 0x10, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+7F3A "缺" */
+    0x0, 0x20, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0xb4, 0x0, 0x0, 0xc2, 0x0, 0x0, 0x0, 0xb0,
+    0x1, 0x0, 0xb0, 0x0, 0x0, 0x5, 0x89, 0x59,
+    0x46, 0xc5, 0x6b, 0x0, 0x7, 0xa, 0x0, 0x0,
+    0xb0, 0x19, 0x0, 0x11, 0xa, 0x1, 0x20, 0xb0,
+    0x19, 0x0, 0x36, 0x5c, 0x57, 0x60, 0xb0, 0x19,
+    0x30, 0x5, 0x1a, 0x5, 0x65, 0xc7, 0x57, 0x72,
+    0xa, 0xa, 0xa, 0x2, 0x86, 0x0, 0x0, 0xa,
+    0xa, 0xa, 0x7, 0x33, 0x60, 0x0, 0xa, 0x5c,
+    0x5c, 0x9, 0x0, 0xa1, 0x0, 0x8, 0x60, 0x4,
+    0x81, 0x0, 0x3d, 0x20, 0x0, 0x0, 0x16, 0x10,
+    0x0, 0x5, 0xb1, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7F6E "置" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0xb6, 0x6b, 0x66, 0xa6, 0x6d, 0x0, 0x0, 0xc0,
+    0xc, 0x0, 0xb0, 0xd, 0x0, 0x0, 0xc6, 0x6b,
+    0x76, 0xa6, 0x6d, 0x0, 0x0, 0x20, 0x0, 0xa3,
+    0x0, 0x7, 0x0, 0x2, 0x76, 0x66, 0xd6, 0x66,
+    0x66, 0x10, 0x0, 0xa, 0x66, 0x96, 0x69, 0xa0,
+    0x0, 0x0, 0xb, 0x10, 0x0, 0x4, 0x80, 0x0,
+    0x0, 0xb, 0x66, 0x66, 0x68, 0x80, 0x0, 0x0,
+    0xb, 0x76, 0x66, 0x69, 0x80, 0x0, 0x0, 0xb,
+    0x10, 0x0, 0x4, 0x80, 0x0, 0x0, 0xb, 0x76,
+    0x66, 0x69, 0x80, 0x0, 0x26, 0x6d, 0x76, 0x66,
+    0x69, 0xb7, 0xd2, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7F8E "美" */
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0xa3, 0x0, 0xc3, 0x0, 0x0, 0x0, 0x0,
+    0x57, 0x3, 0x40, 0x44, 0x0, 0x3, 0x65, 0x55,
+    0xd5, 0x55, 0x54, 0x0, 0x0, 0x45, 0x55, 0xd5,
+    0x56, 0xa1, 0x0, 0x0, 0x10, 0x0, 0xc0, 0x0,
+    0x0, 0x0, 0x25, 0x55, 0x55, 0xd5, 0x55, 0x5b,
+    0x70, 0x1, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x0,
+    0x4, 0x55, 0x55, 0xe5, 0x55, 0x98, 0x0, 0x1,
+    0x0, 0x6, 0x76, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x2, 0x80, 0x0, 0x0, 0x0, 0x1, 0xa3,
+    0x0, 0x3c, 0x61, 0x0, 0x2, 0x67, 0x10, 0x0,
+    0x1, 0x9f, 0x90, 0x11, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7FA9 "義" */
+    0x0, 0x0, 0x40, 0x0, 0x32, 0x0, 0x0, 0x0,
+    0x0, 0x58, 0x0, 0xa3, 0x12, 0x0, 0x2, 0x65,
+    0x57, 0x95, 0x75, 0x88, 0x0, 0x0, 0x25, 0x55,
+    0xc5, 0x55, 0xb0, 0x0, 0x0, 0x1, 0x0, 0xb0,
+    0x0, 0x5, 0x0, 0x5, 0x55, 0x55, 0x85, 0x55,
+    0x59, 0x30, 0x0, 0x0, 0x38, 0xb5, 0x82, 0x81,
+    0x0, 0x1, 0x45, 0xc3, 0x13, 0x90, 0x57, 0x0,
+    0x16, 0x55, 0xc5, 0x55, 0xc5, 0x59, 0x80, 0x0,
+    0x0, 0xa3, 0x30, 0xb0, 0x68, 0x0, 0xb, 0xa7,
+    0xc0, 0x0, 0x6b, 0x90, 0x20, 0x0, 0x0, 0xa0,
+    0x3, 0xac, 0x50, 0x60, 0x0, 0x29, 0xd2, 0x53,
+    0x0, 0x7c, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+7FD2 "習" */
+    0x0, 0x0, 0x20, 0x0, 0x0, 0x20, 0x26, 0x55,
+    0xd2, 0x55, 0x57, 0xc0, 0x6, 0x70, 0xc0, 0x39,
+    0x12, 0x90, 0x0, 0xb0, 0xc0, 0x6, 0x32, 0x90,
+    0x0, 0x46, 0xd0, 0x3, 0x77, 0x90, 0x5b, 0x40,
+    0xc2, 0x99, 0x12, 0x70, 0x21, 0x0, 0xc, 0x30,
+    0x0, 0x0, 0x0, 0x85, 0x78, 0x55, 0x5a, 0x20,
+    0x0, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0xd5, 0x55, 0x55,
+    0x5d, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0xd5, 0x55, 0x55, 0x5d, 0x0, 0x0, 0x10,
+    0x0, 0x0, 0x1, 0x0,
+
+    /* U+8001 "老" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb4, 0x0, 0x14, 0x0, 0x0, 0x0,
+    0x0, 0xb2, 0x5, 0x8c, 0x0, 0x0, 0x16, 0x55,
+    0xc6, 0x58, 0xd1, 0x0, 0x0, 0x0, 0x0, 0xb2,
+    0xc, 0x30, 0x0, 0x5, 0x55, 0x55, 0xb6, 0xaa,
+    0x55, 0xc2, 0x0, 0x0, 0x0, 0x9, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xb4, 0x1, 0x40, 0x0,
+    0x0, 0x0, 0x7e, 0x10, 0x3d, 0x90, 0x0, 0x0,
+    0x49, 0x5c, 0x28, 0x71, 0x1, 0x0, 0x5, 0x30,
+    0x1d, 0x40, 0x0, 0x5, 0x0, 0x0, 0x0, 0x1c,
+    0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0xc, 0xcb,
+    0xbb, 0xbe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8003 "考" */
+    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe0, 0x0, 0x71, 0x0, 0x0, 0x0,
+    0x0, 0xc0, 0x55, 0xc1, 0x0, 0x0, 0x16, 0x55,
+    0xd5, 0x8c, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc2,
+    0xb0, 0x0, 0x60, 0x16, 0x55, 0x55, 0x8c, 0x55,
+    0x55, 0x51, 0x0, 0x0, 0x4, 0xa0, 0x0, 0x15,
+    0x0, 0x0, 0x0, 0x76, 0x99, 0x55, 0x56, 0x0,
+    0x0, 0x48, 0x10, 0xa2, 0x0, 0x20, 0x0, 0x4,
+    0x10, 0x0, 0x95, 0x55, 0xa6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x16,
+    0xab, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x43,
+    0x0, 0x0,
+
+    /* U+8005 "者" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xd0, 0x0, 0x31, 0x0, 0x0, 0x0,
+    0x0, 0xc1, 0x71, 0xd4, 0x0, 0x0, 0x36, 0x55,
+    0xd5, 0x5d, 0x40, 0x0, 0x0, 0x0, 0x0, 0xc0,
+    0xa5, 0x0, 0x50, 0x7, 0x55, 0x55, 0x7c, 0x75,
+    0x56, 0x72, 0x0, 0x0, 0x1, 0xa3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbb, 0x65, 0x56, 0xd0, 0x0,
+    0x0, 0x18, 0xe0, 0x0, 0x1, 0xa0, 0x0, 0x4,
+    0x50, 0xc5, 0x55, 0x56, 0xa0, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0x1, 0xa0, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0x1, 0xa0, 0x0, 0x0, 0x0, 0xc5, 0x55,
+    0x56, 0xb0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0,
+    0x10, 0x0,
+
+    /* U+800C "而" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15,
+    0x55, 0x55, 0x55, 0x55, 0x58, 0xb0, 0x1, 0x0,
+    0x0, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x75, 0x57, 0x75,
+    0x55, 0x5a, 0x10, 0x0, 0xc0, 0xb, 0x0, 0xb0,
+    0xd, 0x0, 0x0, 0xc0, 0xb, 0x0, 0xb0, 0xc,
+    0x0, 0x0, 0xc0, 0xb, 0x0, 0xb0, 0xc, 0x0,
+    0x0, 0xc0, 0xb, 0x0, 0xb0, 0xc, 0x0, 0x0,
+    0xc0, 0xb, 0x0, 0xb0, 0xc, 0x0, 0x0, 0xc0,
+    0xb, 0x0, 0xb0, 0xc, 0x0, 0x0, 0xc0, 0xb,
+    0x0, 0xb1, 0x1c, 0x0, 0x0, 0x90, 0x3, 0x0,
+    0x24, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8033 "耳" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0x57, 0x55, 0x55, 0x57, 0x58, 0x80, 0x0, 0xa,
+    0x20, 0x0, 0xc, 0x0, 0x0, 0x0, 0xa, 0x20,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0xa, 0x65, 0x55,
+    0x5c, 0x0, 0x0, 0x0, 0xa, 0x20, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0xa, 0x20, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0xa, 0x65, 0x55, 0x5c, 0x0, 0x0,
+    0x0, 0xa, 0x20, 0x0, 0xc, 0x0, 0x20, 0x0,
+    0xa, 0x32, 0x34, 0x5d, 0x56, 0x91, 0x26, 0x55,
+    0x42, 0x10, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x0, 0x0,
+
+    /* U+805E "聞" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa5, 0x55,
+    0xd0, 0x95, 0x55, 0xc3, 0xb0, 0x0, 0xb0, 0xa0,
+    0x0, 0xa0, 0xb5, 0x55, 0xb0, 0xa5, 0x55, 0xc0,
+    0xb5, 0x55, 0xa0, 0xa5, 0x55, 0xc0, 0xb0, 0x0,
+    0x0, 0x0, 0x40, 0xa0, 0xb0, 0x6a, 0x65, 0x69,
+    0x72, 0xa0, 0xb0, 0xa, 0x65, 0x78, 0x0, 0xa0,
+    0xb0, 0xa, 0x10, 0x28, 0x0, 0xa0, 0xb0, 0xa,
+    0x65, 0x78, 0x0, 0xa0, 0xb0, 0xa, 0x32, 0x5a,
+    0x79, 0xa0, 0xb3, 0x54, 0x32, 0x38, 0x0, 0xb0,
+    0xb0, 0x0, 0x0, 0x25, 0x3a, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x10,
+
+    /* U+806F "聯" */
+    0x0, 0x0, 0x0, 0x2, 0x20, 0x3, 0x0, 0x5,
+    0x55, 0x5c, 0x59, 0x30, 0x59, 0x0, 0x1, 0xb0,
+    0x91, 0x54, 0x63, 0x80, 0x82, 0x0, 0xb0, 0x93,
+    0xd7, 0x86, 0x87, 0x80, 0x0, 0xc5, 0xb1, 0x18,
+    0x31, 0x36, 0x30, 0x0, 0xb0, 0x92, 0x93, 0x83,
+    0x84, 0x94, 0x0, 0xb0, 0x93, 0xb5, 0x53, 0x83,
+    0x23, 0x0, 0xc5, 0xb1, 0x1, 0x44, 0xa1, 0x10,
+    0x0, 0xb0, 0x91, 0x1a, 0x44, 0xa0, 0xa0, 0x1,
+    0xc6, 0xc5, 0x29, 0x64, 0xa0, 0xa0, 0xd, 0x71,
+    0x91, 0x2a, 0x83, 0xa5, 0xb0, 0x0, 0x0, 0xa1,
+    0x0, 0xa0, 0xa0, 0x0, 0x0, 0x0, 0xa2, 0x38,
+    0x20, 0xb0, 0x0, 0x0, 0x0, 0x11, 0x10, 0x0,
+    0x20, 0x0,
+
+    /* U+8072 "聲" */
+    0x0, 0x0, 0x50, 0x0, 0x10, 0x10, 0x0, 0x4,
+    0x55, 0xc5, 0xa2, 0xb5, 0xc1, 0x0, 0x1, 0x0,
+    0xa0, 0x31, 0x80, 0xa4, 0x50, 0x2, 0x85, 0x55,
+    0x57, 0x10, 0x28, 0x60, 0x0, 0xb5, 0xa6, 0xb2,
+    0x95, 0xa8, 0x0, 0x1, 0xb5, 0xc6, 0x90, 0x1b,
+    0x70, 0x0, 0x3, 0x60, 0x0, 0x2, 0x85, 0x98,
+    0x50, 0x6, 0x35, 0x55, 0x68, 0x55, 0x89, 0x40,
+    0x2, 0x1, 0xb1, 0x11, 0x17, 0x30, 0x0, 0x0,
+    0x0, 0xb4, 0x44, 0x49, 0x30, 0x0, 0x0, 0x0,
+    0xb5, 0x55, 0x5a, 0x30, 0x20, 0x2, 0x44, 0xc5,
+    0x55, 0x5a, 0x76, 0x80, 0x1, 0x10, 0x0, 0x0,
+    0x7, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x0, 0x0,
+
+    /* U+8077 "職" */
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x10, 0x0, 0x5,
+    0x55, 0x5a, 0x3b, 0x10, 0xc0, 0x0, 0x0, 0xa0,
+    0xa2, 0x68, 0x67, 0xb5, 0x30, 0x0, 0xa0, 0xa0,
+    0x50, 0x55, 0xa0, 0xc0, 0x0, 0xc5, 0xc0, 0x73,
+    0x70, 0xa0, 0x0, 0x0, 0xa0, 0xa4, 0x75, 0x85,
+    0xc5, 0xb1, 0x0, 0xa0, 0xa0, 0x31, 0x40, 0xa1,
+    0x90, 0x0, 0xc5, 0xc0, 0xb4, 0xa3, 0x94, 0x70,
+    0x0, 0xa0, 0xa0, 0xa0, 0x81, 0x7b, 0x10, 0x0,
+    0xb3, 0xc4, 0xb5, 0xb1, 0x4b, 0x0, 0xc, 0xa4,
+    0xa0, 0xa0, 0x81, 0x8a, 0x3, 0x0, 0x0, 0xa0,
+    0xa5, 0x84, 0x67, 0xa2, 0x0, 0x0, 0xb0, 0x0,
+    0x26, 0x0, 0xc2, 0x0, 0x0, 0x10, 0x0, 0x10,
+    0x0, 0x0,
+
+    /* U+807D "聽" */
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x5,
+    0x55, 0x57, 0x80, 0xa, 0x10, 0x30, 0x0, 0xa0,
+    0xa, 0x46, 0x5a, 0x55, 0x71, 0x0, 0xc5, 0x5a,
+    0x15, 0x36, 0x33, 0x60, 0x0, 0xc5, 0x5a, 0x1a,
+    0x56, 0xb2, 0xb0, 0x0, 0xa0, 0xa, 0x1a, 0x44,
+    0xa0, 0xa0, 0x6, 0x75, 0x5a, 0x1b, 0x77, 0xb4,
+    0xa0, 0x5, 0x67, 0x5a, 0x15, 0x11, 0x11, 0x50,
+    0x0, 0x83, 0xa, 0x36, 0x55, 0x55, 0x92, 0x5,
+    0xa9, 0x3a, 0x1, 0x47, 0x11, 0x0, 0x0, 0x82,
+    0xa, 0x34, 0xa2, 0x82, 0xa1, 0x6, 0xa6, 0x2a,
+    0xd1, 0xa0, 0x4, 0x63, 0x4, 0x0, 0xb, 0x10,
+    0xc9, 0x9c, 0x40, 0x0, 0x0, 0x3, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8089 "肉" */
+    0x0, 0x0, 0x31, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x60, 0x0, 0x0, 0x95, 0x55, 0xa8, 0x55, 0x5a,
+    0x2d, 0x0, 0xc, 0x10, 0x0, 0xc1, 0xd0, 0x2,
+    0xb8, 0x50, 0xc, 0x1d, 0x1, 0x92, 0x9, 0xc0,
+    0xc1, 0xd2, 0x60, 0x97, 0x9, 0xc, 0x1d, 0x10,
+    0xe, 0x20, 0x0, 0xc1, 0xd0, 0x7, 0x57, 0x81,
+    0xc, 0x1d, 0x4, 0x60, 0x6, 0xd0, 0xc1, 0xd3,
+    0x30, 0x0, 0x7, 0xc, 0x1d, 0x0, 0x0, 0x0,
+    0x56, 0xe0, 0xc0, 0x0, 0x0, 0x0, 0xa9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+80A9 "肩" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xc0, 0x0, 0x0, 0x0, 0x49, 0x55,
+    0x57, 0x55, 0x5c, 0x30, 0x3, 0x90, 0x0, 0x0,
+    0x0, 0xb1, 0x0, 0x3b, 0x55, 0x55, 0x55, 0x5c,
+    0x10, 0x3, 0x90, 0x10, 0x0, 0x0, 0x20, 0x0,
+    0x48, 0xd, 0x55, 0x55, 0x6c, 0x0, 0x4, 0x70,
+    0xc0, 0x0, 0x2, 0xa0, 0x0, 0x75, 0xd, 0x55,
+    0x55, 0x6a, 0x0, 0xa, 0x10, 0xd5, 0x55, 0x56,
+    0xa0, 0x0, 0x90, 0xc, 0x0, 0x0, 0x2a, 0x0,
+    0x62, 0x0, 0xc0, 0x0, 0x2, 0x90, 0x23, 0x0,
+    0xc, 0x0, 0x6, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x0,
+
+    /* U+80AF "肯" */
+    0x0, 0x0, 0x0, 0x5, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0x70, 0xe, 0x0, 0x1, 0x0, 0x0, 0x6,
+    0x70, 0xd, 0x55, 0x6a, 0x0, 0x0, 0x6, 0x70,
+    0xd, 0x0, 0x0, 0x20, 0x17, 0x57, 0x75, 0x5a,
+    0x55, 0x57, 0xa0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x40, 0x0, 0x0, 0xd, 0x55, 0x55, 0x55, 0xe1,
+    0x0, 0x0, 0xd, 0x0, 0x0, 0x0, 0xd0, 0x0,
+    0x0, 0xd, 0x55, 0x55, 0x55, 0xd0, 0x0, 0x0,
+    0xd, 0x55, 0x55, 0x55, 0xd0, 0x0, 0x0, 0xd,
+    0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0xd, 0x0,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0xe, 0x0, 0x1,
+    0x6d, 0xa0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x2,
+    0x0, 0x0,
+
+    /* U+80B2 "育" */
+    0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0x10, 0x0, 0x20, 0x6, 0x55, 0x58,
+    0x85, 0x55, 0x6a, 0x10, 0x0, 0x6, 0x92, 0x4,
+    0x10, 0x0, 0x0, 0x39, 0x53, 0x33, 0x4c, 0xa0,
+    0x0, 0x2, 0xa7, 0x53, 0x20, 0xa, 0x10, 0x0,
+    0x9, 0x55, 0x55, 0x5b, 0x30, 0x0, 0x0, 0xa1,
+    0x0, 0x0, 0xa2, 0x0, 0x0, 0xa, 0x65, 0x55,
+    0x5c, 0x20, 0x0, 0x0, 0xa1, 0x0, 0x0, 0xa2,
+    0x0, 0x0, 0xa, 0x65, 0x55, 0x5c, 0x20, 0x0,
+    0x0, 0xa1, 0x0, 0x0, 0xa1, 0x0, 0x0, 0xb,
+    0x10, 0x3, 0x9e, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x10, 0x0,
+
+    /* U+80CC "背" */
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xd0, 0x2c, 0x0, 0x60, 0x6, 0x55, 0x6c,
+    0x2, 0xb5, 0x98, 0x10, 0x0, 0x4, 0xc0, 0x2c,
+    0x0, 0x4, 0x3b, 0x96, 0x4c, 0x1, 0xe6, 0x68,
+    0xb0, 0x20, 0x2, 0x80, 0x4, 0x66, 0x52, 0x0,
+    0xb, 0x55, 0x55, 0x55, 0xe1, 0x0, 0x0, 0xd0,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0xd, 0x55, 0x55,
+    0x55, 0xc0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0xd, 0x55, 0x55, 0x55, 0xc0, 0x0,
+    0x0, 0xd0, 0x0, 0x0, 0xc, 0x0, 0x0, 0xd,
+    0x0, 0x1, 0x6c, 0xa0, 0x0, 0x0, 0x50, 0x0,
+    0x0, 0x41, 0x0,
+
+    /* U+80F8 "胸" */
+    0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x65,
+    0x5a, 0x14, 0x90, 0x0, 0x0, 0x9, 0x20, 0xb0,
+    0x92, 0x0, 0x3, 0x10, 0x92, 0xb, 0xa, 0x57,
+    0x65, 0xa3, 0x9, 0x65, 0xc4, 0x12, 0x79, 0x8,
+    0x20, 0x92, 0xb, 0x2, 0x6a, 0x11, 0x82, 0x9,
+    0x20, 0xb0, 0xb3, 0x90, 0xb8, 0x20, 0x96, 0x5c,
+    0xa, 0x4b, 0xa, 0x81, 0xa, 0x10, 0xb0, 0xa7,
+    0x82, 0xa9, 0x10, 0xb0, 0xb, 0xc, 0x23, 0x2a,
+    0x91, 0xa, 0x0, 0xb0, 0xa5, 0x55, 0xaa, 0x1,
+    0x62, 0x3c, 0x0, 0x0, 0x33, 0xc0, 0x40, 0x9,
+    0x70, 0x0, 0x1, 0x89, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+80FD "能" */
+    0x0, 0x6, 0x0, 0x2, 0x0, 0x0, 0x0, 0x7,
+    0x80, 0x0, 0xb2, 0x3, 0x0, 0x4, 0x60, 0x26,
+    0xb, 0x7, 0xb1, 0x5, 0xa5, 0x55, 0xa5, 0xb6,
+    0x20, 0x20, 0x35, 0x20, 0x2, 0x2b, 0x0, 0x6,
+    0x0, 0xa5, 0x55, 0xb0, 0x8a, 0x99, 0xd1, 0xc,
+    0x0, 0x1a, 0x0, 0x0, 0x0, 0x0, 0xd5, 0x55,
+    0xa0, 0xb1, 0x5, 0x0, 0xc, 0x0, 0x1a, 0xb,
+    0x7, 0xb2, 0x0, 0xd5, 0x55, 0xa0, 0xc8, 0x40,
+    0x0, 0xc, 0x0, 0x1a, 0xb, 0x0, 0x4, 0x0,
+    0xc0, 0x1, 0xa0, 0xb0, 0x0, 0x80, 0xc, 0x5,
+    0xc8, 0xa, 0xba, 0xad, 0x30, 0x20, 0x3, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+8131 "脱" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0xa5, 0xa3, 0x8, 0x0, 0xe1, 0x0, 0x0, 0xb0,
+    0x92, 0x9, 0x44, 0x70, 0x0, 0x0, 0xb0, 0x92,
+    0x23, 0x17, 0x4, 0x0, 0x0, 0xc5, 0xb2, 0xb5,
+    0x55, 0x5c, 0x0, 0x0, 0xb0, 0x92, 0xa0, 0x0,
+    0x1b, 0x0, 0x0, 0xb0, 0x92, 0xa0, 0x0, 0x1b,
+    0x0, 0x0, 0xc5, 0xb2, 0xb8, 0x9b, 0x6b, 0x0,
+    0x0, 0xa0, 0x92, 0x24, 0x6a, 0x0, 0x0, 0x1,
+    0x90, 0x92, 0x5, 0x5a, 0x0, 0x0, 0x4, 0x50,
+    0x92, 0x8, 0x2a, 0x0, 0x40, 0x7, 0x11, 0xa1,
+    0x1a, 0xa, 0x10, 0x70, 0x6, 0x5, 0xd2, 0x70,
+    0x7, 0xb9, 0xc2, 0x10, 0x0, 0x2, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+814A "腊" */
+    0x0, 0x0, 0x0, 0x2, 0x0, 0x20, 0x0, 0x0,
+    0x95, 0xa3, 0x7, 0x80, 0xc1, 0x0, 0x0, 0xb0,
+    0xa1, 0x7, 0x50, 0xb2, 0x30, 0x0, 0xb0, 0xa1,
+    0x6a, 0x85, 0xc5, 0x40, 0x0, 0xc5, 0xc1, 0x7,
+    0x50, 0xb0, 0x0, 0x0, 0xb0, 0xa3, 0x5a, 0x85,
+    0xc5, 0xc2, 0x0, 0xb0, 0xa1, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0xc5, 0xc1, 0x65, 0x55, 0x59, 0x20,
+    0x0, 0xb0, 0xa1, 0x92, 0x0, 0xa, 0x10, 0x1,
+    0x90, 0xa1, 0x96, 0x55, 0x5c, 0x10, 0x3, 0x60,
+    0xa1, 0x92, 0x0, 0xa, 0x10, 0x7, 0x11, 0xb0,
+    0x96, 0x55, 0x5c, 0x10, 0x5, 0x6, 0xd0, 0x91,
+    0x0, 0x9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8155 "腕" */
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x1,
+    0x42, 0x61, 0x0, 0x38, 0x0, 0x0, 0x1, 0xb3,
+    0xc0, 0x75, 0x5c, 0x55, 0x80, 0x1, 0xa0, 0xb2,
+    0x95, 0x0, 0x3, 0x50, 0x1, 0xb5, 0xc2, 0x3a,
+    0x0, 0x2, 0x0, 0x1, 0xa0, 0xb0, 0x68, 0x8b,
+    0x5b, 0x20, 0x1, 0xa0, 0xb0, 0x90, 0xba, 0xa,
+    0x0, 0x1, 0xb5, 0xc2, 0xa1, 0xaa, 0xa, 0x0,
+    0x2, 0x90, 0xb4, 0x49, 0x6a, 0xa, 0x0, 0x3,
+    0x70, 0xb0, 0xa, 0x1a, 0x3d, 0x0, 0x5, 0x40,
+    0xb0, 0x18, 0xa, 0x3, 0x40, 0x8, 0x0, 0xb0,
+    0x80, 0xa, 0x0, 0x70, 0x6, 0x18, 0xc5, 0x10,
+    0x7, 0xa9, 0xc2, 0x10, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8166 "腦" */
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0xa5, 0xa3, 0x3d, 0xa, 0x50, 0xd1, 0x0, 0xb0,
+    0xa1, 0x82, 0x19, 0x6, 0x60, 0x0, 0xb0, 0xa2,
+    0x60, 0x70, 0x27, 0x0, 0x0, 0xc5, 0xc1, 0x91,
+    0x47, 0x19, 0x30, 0x0, 0xb0, 0xa1, 0x3b, 0x48,
+    0x61, 0xe0, 0x0, 0xb0, 0xa1, 0x4, 0xa1, 0x10,
+    0x30, 0x0, 0xc5, 0xc1, 0xb5, 0x65, 0x55, 0xd0,
+    0x0, 0xb0, 0xa1, 0xb2, 0x0, 0xd2, 0xb0, 0x0,
+    0x90, 0xa1, 0xb0, 0x7b, 0x50, 0xb0, 0x3, 0x60,
+    0xa1, 0xb0, 0x5b, 0x70, 0xb0, 0x6, 0x10, 0xa0,
+    0xb3, 0x50, 0xb1, 0xb0, 0x6, 0x29, 0xd0, 0xb6,
+    0x55, 0x55, 0xb0, 0x11, 0x0, 0x20, 0x50, 0x0,
+    0x0, 0x50,
+
+    /* U+8170 "腰" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x65, 0xc4, 0x55, 0x55, 0x58, 0x70, 0x9, 0x20,
+    0xb1, 0xa, 0xa, 0x0, 0x0, 0x9, 0x20, 0xb5,
+    0x6c, 0x5c, 0x5a, 0x10, 0x9, 0x65, 0xb7, 0x3a,
+    0xa, 0xb, 0x0, 0x9, 0x20, 0xb7, 0x3a, 0xa,
+    0xb, 0x0, 0x9, 0x20, 0xb7, 0x79, 0x57, 0x5c,
+    0x0, 0x9, 0x65, 0xb1, 0x9, 0x50, 0x0, 0x0,
+    0x9, 0x10, 0xb6, 0x5d, 0x55, 0x77, 0x90, 0xa,
+    0x0, 0xb0, 0x64, 0x5, 0x60, 0x0, 0x9, 0x0,
+    0xb0, 0xb4, 0x1b, 0x0, 0x0, 0x17, 0x11, 0xb0,
+    0x2, 0xda, 0x61, 0x0, 0x50, 0x2c, 0x71, 0x58,
+    0x20, 0x5d, 0x0, 0x0, 0x0, 0x13, 0x0, 0x0,
+    0x1, 0x0,
+
+    /* U+819D "膝" */
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x4,
+    0x37, 0x30, 0x0, 0xb1, 0x4, 0x0, 0xa, 0x2a,
+    0x25, 0x59, 0xf5, 0x57, 0x20, 0xa, 0xa, 0x10,
+    0x2a, 0xb6, 0x82, 0x0, 0xa, 0x5c, 0x12, 0x80,
+    0x70, 0x2e, 0x20, 0xa, 0xa, 0x33, 0x6, 0xc2,
+    0x3, 0x10, 0xa, 0xa, 0x10, 0x3a, 0x6, 0x60,
+    0x0, 0xa, 0x5c, 0x14, 0x70, 0xb1, 0x6d, 0x80,
+    0xa, 0xa, 0x33, 0x55, 0xb2, 0xb2, 0x20, 0xa,
+    0xa, 0x10, 0x8, 0xd4, 0x0, 0x0, 0x9, 0xa,
+    0x10, 0x66, 0xb5, 0x93, 0x0, 0x25, 0x1b, 0x1c,
+    0x50, 0xb0, 0x1d, 0x20, 0x50, 0x5b, 0x0, 0x18,
+    0xe0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x0, 0x10,
+    0x0, 0x0,
+
+    /* U+81C9 "臉" */
+    0x0, 0x0, 0x0, 0x0, 0x12, 0x0, 0x0, 0x1,
+    0x85, 0xa1, 0x0, 0x8a, 0x0, 0x0, 0x1, 0x90,
+    0xa0, 0x2, 0x91, 0x50, 0x0, 0x1, 0x90, 0xa0,
+    0x9, 0x0, 0x57, 0x0, 0x1, 0xb5, 0xb0, 0x65,
+    0x55, 0x96, 0xc3, 0x1, 0x90, 0xa2, 0x20, 0x21,
+    0x10, 0x40, 0x1, 0x90, 0xa0, 0xb5, 0xb3, 0xa5,
+    0xb0, 0x1, 0xb5, 0xb0, 0x90, 0x92, 0x70, 0x90,
+    0x1, 0x80, 0xa0, 0xb5, 0xa3, 0x95, 0x90, 0x3,
+    0x60, 0xa0, 0x1b, 0x0, 0x38, 0x0, 0x5, 0x30,
+    0xa0, 0x49, 0x0, 0x74, 0x0, 0x7, 0x12, 0xa0,
+    0x82, 0xb0, 0x96, 0x80, 0x4, 0x9, 0x63, 0x30,
+    0x36, 0x10, 0x74, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+81EA "自" */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0xe2, 0x0,
+    0x0, 0x10, 0x44, 0x0, 0x3, 0xd, 0x56, 0x55,
+    0x55, 0xd4, 0xd0, 0x0, 0x0, 0xc, 0xd, 0x0,
+    0x0, 0x0, 0xc0, 0xd5, 0x55, 0x55, 0x5d, 0xd,
+    0x0, 0x0, 0x0, 0xc0, 0xd0, 0x0, 0x0, 0xc,
+    0xd, 0x55, 0x55, 0x55, 0xd0, 0xd0, 0x0, 0x0,
+    0xc, 0xd, 0x0, 0x0, 0x0, 0xc0, 0xe5, 0x55,
+    0x55, 0x5d, 0x14, 0x0, 0x0, 0x0, 0x40,
+
+    /* U+81F3 "至" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0x55, 0x55, 0x55, 0x55, 0x6d, 0x20, 0x1, 0x0,
+    0xa, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x58,
+    0x1, 0x50, 0x0, 0x0, 0x0, 0x4, 0x80, 0x0,
+    0x2c, 0x50, 0x0, 0x0, 0x89, 0x45, 0x66, 0x67,
+    0xe5, 0x0, 0x0, 0x98, 0x53, 0xb2, 0x0, 0x34,
+    0x0, 0x0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x0,
+    0x0, 0x55, 0x55, 0xc7, 0x55, 0xd5, 0x0, 0x0,
+    0x10, 0x0, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa2, 0x0, 0x7, 0x50, 0x26, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x40,
+
+    /* U+81FA "臺" */
+    0x0, 0x0, 0x0, 0x13, 0x0, 0x0, 0x10, 0x6,
+    0x55, 0x55, 0x6c, 0x55, 0x58, 0xa0, 0x0, 0x24,
+    0x44, 0x6b, 0x44, 0x94, 0x0, 0x0, 0x8, 0x55,
+    0x55, 0x55, 0xa1, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x0, 0xc0, 0x0, 0x1, 0xb, 0x55, 0x55, 0x55,
+    0x90, 0x0, 0x8, 0x55, 0x55, 0x55, 0x55, 0x56,
+    0xd1, 0x4b, 0x35, 0x55, 0x65, 0x56, 0xb5, 0x20,
+    0x0, 0x0, 0x48, 0x30, 0x6, 0x30, 0x0, 0x0,
+    0x1d, 0xc8, 0x88, 0x55, 0xc5, 0x0, 0x0, 0x3,
+    0x0, 0x38, 0x0, 0x82, 0x0, 0x0, 0x36, 0x55,
+    0x7b, 0x55, 0x52, 0x0, 0x4, 0x55, 0x55, 0x7b,
+    0x55, 0x5c, 0x70, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8207 "與" */
+    0x0, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x24, 0xa7, 0x70, 0x1, 0x16, 0x0, 0x0, 0xd2,
+    0x6, 0x85, 0xa6, 0x4d, 0x20, 0x0, 0xc0, 0x26,
+    0x50, 0x0, 0xc, 0x0, 0x0, 0xc5, 0x59, 0x85,
+    0xb3, 0x6c, 0x0, 0x0, 0xb0, 0x3, 0x0, 0xb0,
+    0xb, 0x0, 0x0, 0xc5, 0x99, 0x40, 0xb2, 0x5c,
+    0x0, 0x0, 0xc0, 0x9, 0x20, 0xb0, 0x1b, 0x0,
+    0x0, 0xc0, 0x9, 0x20, 0xb0, 0xb, 0x50, 0x8,
+    0x65, 0x66, 0x55, 0x65, 0x56, 0x61, 0x0, 0x1,
+    0xd5, 0x0, 0x17, 0x50, 0x0, 0x0, 0x1b, 0x40,
+    0x0, 0x0, 0x5d, 0x40, 0x4, 0x81, 0x0, 0x0,
+    0x0, 0x4, 0xb0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8208 "興" */
+    0x0, 0x38, 0x68, 0x55, 0x85, 0x15, 0x0, 0x0,
+    0xc1, 0x19, 0x2, 0x65, 0x5c, 0x10, 0x0, 0xb2,
+    0x1a, 0x66, 0x84, 0xb, 0x0, 0x0, 0xb5, 0x39,
+    0x67, 0x75, 0x5c, 0x0, 0x0, 0xa0, 0x19, 0x89,
+    0x64, 0xb, 0x0, 0x0, 0xb8, 0x49, 0x89, 0x65,
+    0x4b, 0x0, 0x0, 0xb1, 0x19, 0x89, 0x64, 0x2b,
+    0x0, 0x0, 0xb0, 0x19, 0x0, 0x64, 0x1b, 0x50,
+    0x6, 0x65, 0x57, 0x55, 0x65, 0x56, 0x61, 0x0,
+    0x0, 0x9a, 0x0, 0x18, 0x60, 0x0, 0x0, 0x9,
+    0x70, 0x0, 0x0, 0x7e, 0x50, 0x3, 0x71, 0x0,
+    0x0, 0x0, 0x5, 0x90, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+8209 "舉" */
+    0x0, 0x0, 0x31, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0xa7, 0x85, 0xd5, 0x95, 0x6c, 0x20, 0x0, 0xb0,
+    0x31, 0xa0, 0x0, 0xb, 0x0, 0x0, 0xb5, 0x65,
+    0xb5, 0xa5, 0x6b, 0x0, 0x0, 0xa0, 0x61, 0x50,
+    0xc0, 0xa, 0x0, 0x0, 0xa6, 0x53, 0xb0, 0xc4,
+    0x6b, 0x0, 0x5, 0xb6, 0x56, 0xb5, 0xd5, 0x5d,
+    0xb1, 0x1, 0x0, 0xc4, 0x25, 0x5, 0x0, 0x0,
+    0x0, 0xa, 0x50, 0x37, 0x24, 0x80, 0x0, 0x1,
+    0x93, 0x46, 0x79, 0x54, 0x2b, 0x50, 0x15, 0x25,
+    0x55, 0x79, 0x55, 0xb6, 0x70, 0x0, 0x1, 0x0,
+    0x37, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+822A "航" */
+    0x0, 0x3, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0x30, 0x0, 0x45, 0x0, 0x0, 0x0, 0x99,
+    0x5a, 0x0, 0xb, 0x1, 0x0, 0x0, 0xb0, 0xb,
+    0x45, 0x55, 0x59, 0x50, 0x0, 0xb6, 0x2b, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb2, 0x6b, 0x9, 0x55,
+    0xb2, 0x0, 0x15, 0xc5, 0x5c, 0xa, 0x10, 0xb0,
+    0x0, 0x1, 0xa1, 0xb, 0xa, 0x10, 0xb0, 0x0,
+    0x0, 0xa6, 0x4b, 0xa, 0x0, 0xb0, 0x0, 0x1,
+    0x81, 0x7b, 0xa, 0x0, 0xb0, 0x0, 0x4, 0x40,
+    0xb, 0x9, 0x0, 0xb0, 0x40, 0x7, 0x1, 0xb,
+    0x43, 0x0, 0xb0, 0x80, 0x14, 0x2, 0xc9, 0x60,
+    0x0, 0x8b, 0xe2, 0x10, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+822C "般" */
+    0x0, 0x3, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0x30, 0x7, 0x55, 0x82, 0x0, 0x0, 0xa7,
+    0x5b, 0x2a, 0x10, 0xb0, 0x0, 0x0, 0xb3, 0xb,
+    0xb, 0x0, 0xb0, 0x0, 0x0, 0xb4, 0x7b, 0xa,
+    0x0, 0x8b, 0xc2, 0x0, 0xb0, 0x3b, 0x35, 0x0,
+    0x0, 0x0, 0x5, 0xc5, 0x5c, 0x37, 0x55, 0x7c,
+    0x0, 0x0, 0xb2, 0xb, 0x4, 0x10, 0x75, 0x0,
+    0x0, 0xb6, 0x4b, 0x0, 0x60, 0xc0, 0x0, 0x1,
+    0x91, 0x7b, 0x0, 0x79, 0x60, 0x0, 0x4, 0x50,
+    0xb, 0x0, 0x4f, 0x30, 0x0, 0x8, 0x2, 0x3c,
+    0x4, 0x91, 0xc8, 0x10, 0x24, 0x0, 0x78, 0x64,
+    0x0, 0x9, 0xc1, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8239 "船" */
+    0x0, 0x2, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x40, 0x0, 0xa5, 0x5b, 0x0, 0x0, 0x98,
+    0x5b, 0x20, 0xa0, 0xb, 0x0, 0x0, 0xb1, 0xb,
+    0x0, 0xa0, 0xb, 0x0, 0x0, 0xb5, 0x5b, 0x2,
+    0x80, 0xb, 0x0, 0x0, 0xb0, 0x4b, 0x7, 0x20,
+    0xb, 0xb6, 0x16, 0xc5, 0x5c, 0x34, 0x0, 0x0,
+    0x0, 0x0, 0xa1, 0xb, 0x11, 0x75, 0x56, 0x60,
+    0x0, 0x96, 0x4b, 0x2, 0x90, 0x5, 0x60, 0x2,
+    0x70, 0x6b, 0x1, 0x90, 0x5, 0x50, 0x5, 0x30,
+    0xb, 0x1, 0x90, 0x5, 0x50, 0x8, 0x1, 0x4b,
+    0x2, 0xb5, 0x59, 0x60, 0x13, 0x0, 0x67, 0x2,
+    0x80, 0x4, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+826F "良" */
+    0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0x20, 0x0, 0x0, 0x8, 0x55, 0xb6, 0x59, 0x30,
+    0x0, 0xc0, 0x0, 0x0, 0xa2, 0x0, 0xc, 0x0,
+    0x0, 0xa, 0x20, 0x0, 0xd5, 0x55, 0x55, 0xc2,
+    0x0, 0xc, 0x0, 0x0, 0xa, 0x20, 0x0, 0xd5,
+    0x65, 0x55, 0xb2, 0x0, 0xc, 0x2, 0x30, 0x5,
+    0xd1, 0x0, 0xc0, 0x8, 0x37, 0x50, 0x0, 0xc,
+    0x0, 0x3b, 0x10, 0x0, 0x0, 0xc5, 0x71, 0x2b,
+    0x94, 0x10, 0xd, 0x50, 0x0, 0x5, 0xce, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8272 "色" */
+    0x0, 0x0, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd5, 0x0, 0x50, 0x0, 0x0, 0x0, 0x7,
+    0x95, 0x58, 0xe3, 0x0, 0x0, 0x0, 0x2a, 0x0,
+    0x9, 0x10, 0x0, 0x0, 0x1, 0xd6, 0x55, 0x86,
+    0x55, 0xa1, 0x0, 0x16, 0x82, 0x0, 0xb0, 0x0,
+    0xb0, 0x0, 0x0, 0x82, 0x0, 0xb0, 0x0, 0xb0,
+    0x0, 0x0, 0x87, 0x55, 0xc5, 0x55, 0xc0, 0x0,
+    0x0, 0x82, 0x0, 0x0, 0x0, 0xa0, 0x0, 0x0,
+    0x82, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x82,
+    0x0, 0x0, 0x0, 0x0, 0x60, 0x0, 0x83, 0x0,
+    0x0, 0x0, 0x1, 0xa0, 0x0, 0x5d, 0xaa, 0xaa,
+    0xaa, 0xac, 0xa0,
+
+    /* U+8282 "节" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0x0, 0xd, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0xc, 0x1, 0xa0, 0x6, 0x55, 0x5d,
+    0x55, 0x5d, 0x55, 0x52, 0x0, 0x0, 0xb, 0x0,
+    0xa, 0x0, 0x0, 0x0, 0x45, 0x55, 0x55, 0x55,
+    0x5a, 0x0, 0x0, 0x10, 0x0, 0xb0, 0x0, 0x2b,
+    0x0, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x2b, 0x0,
+    0x0, 0x0, 0x0, 0xb0, 0x0, 0x2b, 0x0, 0x0,
+    0x0, 0x0, 0xb0, 0x0, 0x2a, 0x0, 0x0, 0x0,
+    0x0, 0xb0, 0x58, 0xe8, 0x0, 0x0, 0x0, 0x0,
+    0xb0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+82B1 "花" */
+    0x0, 0x0, 0x20, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x84, 0x1, 0xc0, 0x0, 0x0, 0x25, 0x55,
+    0xa7, 0x56, 0xd5, 0x5c, 0x80, 0x1, 0x0, 0x73,
+    0x1, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x71, 0x0,
+    0x50, 0x0, 0x0, 0x0, 0x3, 0xb0, 0x7, 0x20,
+    0x2, 0x0, 0x0, 0xb, 0x20, 0xb, 0x10, 0x8c,
+    0x0, 0x0, 0x5f, 0x10, 0xb, 0x2a, 0x80, 0x0,
+    0x1, 0x9c, 0x0, 0xb, 0xb3, 0x0, 0x0, 0x27,
+    0xc, 0x2, 0x7d, 0x10, 0x0, 0x0, 0x10, 0xc,
+    0x12, 0xa, 0x10, 0x0, 0x50, 0x0, 0xc, 0x0,
+    0xa, 0x10, 0x0, 0x80, 0x0, 0xc, 0x0, 0x7,
+    0xca, 0xab, 0xc0, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+82E5 "若" */
+    0x0, 0x0, 0x21, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x68, 0x0, 0xc2, 0x0, 0x0, 0x5, 0x55,
+    0x99, 0x55, 0xd5, 0x5c, 0x30, 0x0, 0x0, 0x56,
+    0x10, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x33, 0xd0,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x6, 0x70, 0x0,
+    0x3, 0x40, 0x6, 0x55, 0x5d, 0x55, 0x55, 0x56,
+    0x50, 0x0, 0x0, 0x76, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xe5, 0x55, 0x57, 0x90, 0x0, 0x0,
+    0x4a, 0xc0, 0x0, 0x4, 0x80, 0x0, 0x5, 0x50,
+    0xc0, 0x0, 0x4, 0x80, 0x0, 0x10, 0x0, 0xc5,
+    0x55, 0x58, 0x80, 0x0, 0x0, 0x0, 0xc0, 0x0,
+    0x4, 0x70, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+82E6 "苦" */
+    0x0, 0x0, 0x20, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x0, 0x76, 0x0, 0xd, 0x0, 0x10, 0x6, 0x55,
+    0xa8, 0x55, 0x5c, 0x56, 0xc2, 0x0, 0x0, 0x74,
+    0x10, 0xb, 0x0, 0x0, 0x0, 0x0, 0x31, 0xa4,
+    0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa1, 0x0,
+    0x1, 0x80, 0x6, 0x55, 0x55, 0xc5, 0x55, 0x55,
+    0x51, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0x55, 0x85, 0x55, 0xb3, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0xa1, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0xa1, 0x0, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0xa1, 0x0, 0x0, 0xd, 0x55, 0x55,
+    0x55, 0xc1, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x10, 0x0,
+
+    /* U+82F1 "英" */
+    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x67, 0x0, 0x1c, 0x0, 0x30, 0x6, 0x55,
+    0x88, 0x55, 0x5c, 0x56, 0xb2, 0x0, 0x0, 0x55,
+    0x42, 0xa, 0x0, 0x0, 0x0, 0x0, 0x11, 0x84,
+    0x1, 0x0, 0x0, 0x0, 0xa, 0x55, 0xb7, 0x55,
+    0xc3, 0x0, 0x0, 0xb, 0x0, 0x92, 0x0, 0xa0,
+    0x0, 0x0, 0xb, 0x0, 0xa1, 0x0, 0xa0, 0x0,
+    0x5, 0x5c, 0x55, 0xd5, 0x55, 0xc6, 0xd2, 0x1,
+    0x0, 0x2, 0xb3, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x30, 0x74, 0x0, 0x0, 0x0, 0x1, 0xa5,
+    0x0, 0x8, 0xa3, 0x0, 0x0, 0x57, 0x10, 0x0,
+    0x0, 0x3c, 0xd2, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x10,
+
+    /* U+8336 "茶" */
+    0x0, 0x0, 0x30, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0xb3, 0x0, 0xc1, 0x3, 0x0, 0x6, 0x55,
+    0xc6, 0x55, 0xd5, 0x59, 0x60, 0x0, 0x0, 0xb2,
+    0xc1, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x29, 0x65,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x86, 0x1, 0x81,
+    0x0, 0x0, 0x0, 0x18, 0x40, 0x82, 0x9, 0xa4,
+    0x10, 0x4, 0x50, 0x0, 0xc0, 0x2, 0x8b, 0x60,
+    0x0, 0x55, 0x55, 0xd5, 0x57, 0x70, 0x0, 0x0,
+    0x1, 0xa0, 0xc0, 0x33, 0x0, 0x0, 0x0, 0xa,
+    0x40, 0xc0, 0x5, 0xa1, 0x0, 0x0, 0x82, 0x10,
+    0xc0, 0x0, 0x6c, 0x0, 0x4, 0x0, 0x2b, 0xd0,
+    0x0, 0x5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8377 "荷" */
+    0x0, 0x0, 0x2, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0x0, 0x49, 0x0, 0x10, 0x5, 0x55,
+    0x5d, 0x55, 0x79, 0x56, 0xc2, 0x0, 0x0, 0xc,
+    0x0, 0x36, 0x0, 0x0, 0x0, 0x3, 0xa3, 0x0,
+    0x11, 0x0, 0x30, 0x0, 0xa, 0x46, 0x55, 0x55,
+    0x59, 0xa3, 0x0, 0x4b, 0x0, 0x0, 0x10, 0x1a,
+    0x0, 0x1, 0xad, 0x8, 0x65, 0xe1, 0x1a, 0x0,
+    0x7, 0x1b, 0x8, 0x30, 0xb0, 0x1a, 0x0, 0x0,
+    0xb, 0x8, 0x30, 0xb0, 0x1a, 0x0, 0x0, 0xb,
+    0x8, 0x75, 0xb0, 0x1a, 0x0, 0x0, 0xb, 0x6,
+    0x10, 0x0, 0x1a, 0x0, 0x0, 0x1c, 0x0, 0x0,
+    0x5, 0xc8, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x20, 0x0,
+
+    /* U+83D3 "菓" */
+    0x0, 0x0, 0x10, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x5a, 0x0, 0x48, 0x0, 0x20, 0x6, 0x55,
+    0x8a, 0x55, 0x89, 0x57, 0xb2, 0x0, 0x0, 0x47,
+    0x0, 0x46, 0x0, 0x0, 0x0, 0xb, 0x55, 0x58,
+    0x55, 0xd4, 0x0, 0x0, 0xb, 0x0, 0x1a, 0x0,
+    0xc0, 0x0, 0x0, 0xc, 0x55, 0x6c, 0x55, 0xd0,
+    0x0, 0x0, 0xc, 0x55, 0x6c, 0x55, 0xd0, 0x0,
+    0x0, 0x4, 0x0, 0x1a, 0x0, 0x38, 0x0, 0x2,
+    0x65, 0x57, 0xdc, 0x85, 0x56, 0x40, 0x0, 0x0,
+    0x2c, 0x4a, 0x36, 0x0, 0x0, 0x0, 0x5, 0x91,
+    0x1a, 0x4, 0xb4, 0x0, 0x4, 0x63, 0x0, 0x2a,
+    0x0, 0x2b, 0xd2, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0,
+
+    /* U+83DC "菜" */
+    0x0, 0x0, 0x4, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0x0, 0xc1, 0x1, 0x40, 0x6, 0x55,
+    0x5d, 0x55, 0xd5, 0x57, 0x90, 0x0, 0x0, 0xa,
+    0x0, 0x73, 0x81, 0x0, 0x0, 0x34, 0x56, 0x78,
+    0x97, 0x62, 0x0, 0x0, 0x11, 0x0, 0x54, 0x0,
+    0xb1, 0x0, 0x0, 0xb, 0x30, 0xb, 0x4, 0x70,
+    0x0, 0x0, 0x3, 0x30, 0x38, 0x7, 0x0, 0x20,
+    0x17, 0x55, 0x55, 0xab, 0x65, 0x58, 0xb1, 0x0,
+    0x0, 0xa, 0x88, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x95, 0x38, 0x19, 0x10, 0x0, 0x0, 0x29, 0x20,
+    0x38, 0x2, 0xc8, 0x30, 0x5, 0x50, 0x0, 0x38,
+    0x0, 0x7, 0x91, 0x0, 0x0, 0x0, 0x11, 0x0,
+    0x0, 0x0,
+
+    /* U+843D "落" */
+    0x0, 0x0, 0x20, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0xb2, 0x0, 0xc0, 0x3, 0x20, 0x6, 0x55,
+    0xc5, 0x55, 0xc5, 0x58, 0x70, 0x1, 0x40, 0x60,
+    0x36, 0x50, 0x0, 0x0, 0x0, 0x86, 0x10, 0xa7,
+    0x55, 0x80, 0x0, 0x0, 0x2, 0x42, 0x84, 0x8,
+    0x40, 0x0, 0xa, 0x23, 0x27, 0x5, 0x77, 0x0,
+    0x0, 0x3, 0x47, 0x21, 0x6, 0xc6, 0x0, 0x0,
+    0x0, 0x17, 0x0, 0x76, 0x5, 0xc7, 0x30, 0x3,
+    0xb3, 0x37, 0xa5, 0x55, 0xb7, 0x70, 0x2, 0xd0,
+    0x2, 0x90, 0x0, 0xb0, 0x0, 0x0, 0xd0, 0x2,
+    0x90, 0x0, 0xb0, 0x0, 0x0, 0xb0, 0x2, 0xb5,
+    0x55, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+8449 "葉" */
+    0x0, 0x0, 0x20, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x91, 0x0, 0xb1, 0x6, 0x60, 0x16, 0x55,
+    0xb5, 0x55, 0xc5, 0x55, 0x50, 0x0, 0x6, 0x35,
+    0x10, 0x50, 0x0, 0x0, 0x0, 0xa, 0x1b, 0x10,
+    0xa3, 0x16, 0x0, 0x4, 0x5c, 0x5c, 0x55, 0xb6,
+    0x55, 0x10, 0x0, 0xa, 0xb, 0x55, 0xb1, 0x0,
+    0x0, 0x0, 0xc, 0x57, 0x55, 0x75, 0xb1, 0x0,
+    0x0, 0x2, 0x0, 0xc0, 0x0, 0x4, 0x0, 0x5,
+    0x55, 0x5a, 0xe7, 0x55, 0x6a, 0x40, 0x0, 0x0,
+    0x79, 0xc1, 0x60, 0x0, 0x0, 0x0, 0x19, 0x50,
+    0xc0, 0x1a, 0x71, 0x0, 0x14, 0x50, 0x0, 0xd0,
+    0x0, 0x6e, 0x90, 0x0, 0x0, 0x0, 0x30, 0x0,
+    0x0, 0x0,
+
+    /* U+8457 "著" */
+    0x0, 0x0, 0x10, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x6, 0x70, 0xc, 0x10, 0x60, 0x5, 0x55, 0x98,
+    0x55, 0xc5, 0x57, 0x30, 0x0, 0x5, 0x38, 0x27,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb0, 0x61, 0xb2,
+    0x0, 0x0, 0x65, 0x5c, 0x56, 0xd6, 0x0, 0x4,
+    0x55, 0x55, 0xc5, 0xd8, 0x5b, 0x70, 0x10, 0x0,
+    0x4, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x6a, 0xb5,
+    0x55, 0xa0, 0x0, 0x1, 0x7e, 0x10, 0x0, 0xb,
+    0x0, 0x15, 0x50, 0xb5, 0x55, 0x55, 0xb0, 0x0,
+    0x0, 0xb, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0,
+    0xb5, 0x55, 0x55, 0xc0, 0x0, 0x0, 0x2, 0x0,
+    0x0, 0x2, 0x0,
+
+    /* U+8535 "蔵" */
+    0x0, 0x0, 0x1, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0x0, 0xa3, 0x2, 0x40, 0x6, 0x55,
+    0x6b, 0x55, 0xb6, 0x57, 0x80, 0x0, 0x0, 0x5,
+    0x0, 0x74, 0x80, 0x0, 0x0, 0x41, 0x11, 0x11,
+    0x97, 0x76, 0x50, 0x0, 0xb4, 0x44, 0x46, 0x88,
+    0x44, 0x30, 0x0, 0xb1, 0xb6, 0x87, 0x56, 0x6,
+    0x20, 0x0, 0xb1, 0x93, 0x54, 0x38, 0xc, 0x30,
+    0x0, 0xb1, 0xb5, 0x5c, 0x1b, 0x39, 0x0, 0x0,
+    0xb1, 0xb5, 0x6b, 0xb, 0xb1, 0x0, 0x0, 0x91,
+    0x93, 0x52, 0x9, 0xa0, 0x40, 0x5, 0x22, 0xa5,
+    0x68, 0x75, 0xa5, 0x70, 0x5, 0x0, 0x0, 0x16,
+    0x20, 0xa, 0xc0, 0x10, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x20,
+
+    /* U+8584 "薄" */
+    0x0, 0x0, 0x3, 0x0, 0x21, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0x0, 0x58, 0x1, 0x50, 0x3, 0x65,
+    0x5c, 0x55, 0x8a, 0x85, 0x60, 0x1, 0x81, 0x4,
+    0x0, 0xa1, 0x83, 0x20, 0x0, 0x46, 0x26, 0x55,
+    0xd5, 0x56, 0x70, 0x4, 0x0, 0x47, 0x55, 0xc5,
+    0x5c, 0x0, 0x5, 0x84, 0x9, 0x54, 0xc4, 0x4b,
+    0x0, 0x0, 0x26, 0x9, 0x31, 0xb1, 0x1b, 0x0,
+    0x0, 0x44, 0x9, 0x65, 0xc5, 0x6a, 0x0, 0x5,
+    0xe0, 0x56, 0x55, 0x65, 0xd5, 0xb1, 0x0, 0xc0,
+    0x11, 0x70, 0x0, 0xb0, 0x0, 0x0, 0xe0, 0x0,
+    0x54, 0x0, 0xb0, 0x0, 0x0, 0xa0, 0x0, 0x0,
+    0x5d, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0,
+
+    /* U+85AC "薬" */
+    0x0, 0x0, 0x2, 0x0, 0x11, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0x0, 0x3a, 0x0, 0x81, 0x6, 0x55,
+    0x5c, 0x55, 0x7a, 0x55, 0x52, 0x0, 0x0, 0x2,
+    0x2a, 0x11, 0x0, 0x0, 0x1, 0x72, 0x17, 0x95,
+    0x59, 0x2, 0x60, 0x0, 0x2a, 0x19, 0x0, 0xa,
+    0x58, 0x30, 0x0, 0x0, 0x4b, 0x55, 0x5a, 0x40,
+    0x0, 0x4, 0x96, 0x29, 0x0, 0xa, 0x1a, 0x80,
+    0x3, 0x10, 0x19, 0x57, 0x57, 0x0, 0x60, 0x3,
+    0x55, 0x55, 0x5e, 0x55, 0x57, 0xd1, 0x1, 0x0,
+    0x9, 0x9b, 0x51, 0x0, 0x0, 0x0, 0x2, 0xa5,
+    0xb, 0x7, 0x82, 0x0, 0x3, 0x55, 0x0, 0xb,
+    0x0, 0x3c, 0xd3, 0x0, 0x0, 0x0, 0x2, 0x0,
+    0x0, 0x0,
+
+    /* U+85DD "藝" */
+    0x0, 0x0, 0x2, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0x0, 0x1b, 0x0, 0x80, 0x5, 0x55,
+    0x5c, 0x55, 0x6a, 0x55, 0x52, 0x0, 0x0, 0xa0,
+    0x10, 0x7, 0x0, 0x0, 0x0, 0x65, 0xb5, 0x73,
+    0x5c, 0x58, 0x0, 0x3, 0x75, 0x96, 0x93, 0xa,
+    0x18, 0x0, 0x1, 0x92, 0xb6, 0x90, 0x5b, 0x19,
+    0x0, 0x3, 0x26, 0xb5, 0x30, 0x95, 0x7b, 0x40,
+    0x0, 0x78, 0xa5, 0x35, 0x21, 0x16, 0xc0, 0x0,
+    0x33, 0x65, 0x55, 0x57, 0x72, 0x20, 0x1, 0x65,
+    0x55, 0x95, 0x55, 0x5a, 0x30, 0x0, 0x0, 0x18,
+    0x71, 0x27, 0x30, 0x0, 0x0, 0x8, 0xea, 0x87,
+    0x54, 0xb4, 0x0, 0x0, 0x2, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8607 "蘇" */
+    0x0, 0x0, 0x2, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x1b, 0x0, 0xa2, 0x2, 0x50, 0x6, 0x55,
+    0x5b, 0x55, 0xc5, 0x55, 0x50, 0x0, 0x8, 0x24,
+    0x0, 0x40, 0x15, 0x0, 0x0, 0x3c, 0x5a, 0x13,
+    0x5b, 0x86, 0x10, 0x0, 0xa0, 0x44, 0x0, 0xa,
+    0x0, 0x0, 0x6, 0xb5, 0xa5, 0xa5, 0x6d, 0x59,
+    0x50, 0x0, 0x90, 0x91, 0x80, 0x9d, 0x50, 0x0,
+    0x0, 0xb5, 0xb5, 0x80, 0x9a, 0x70, 0x0, 0x0,
+    0x90, 0x91, 0x93, 0x5a, 0x29, 0x0, 0x0, 0x85,
+    0x55, 0x45, 0xb, 0x9, 0xa1, 0x0, 0x43, 0x65,
+    0x60, 0xb, 0x0, 0x20, 0xa, 0x2a, 0x44, 0x70,
+    0xb, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0,
+
+    /* U+8655 "處" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd1, 0x0, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0xd5, 0x55, 0x61, 0x0, 0x0, 0xb5, 0x55,
+    0xa5, 0x55, 0x59, 0x90, 0x0, 0xb0, 0x0, 0xd1,
+    0x3, 0x16, 0x0, 0x0, 0xb2, 0x34, 0xc4, 0x55,
+    0x32, 0x0, 0x0, 0xb0, 0x20, 0xb9, 0x88, 0x9a,
+    0x0, 0x0, 0xb0, 0xa4, 0x1, 0x20, 0x20, 0x0,
+    0x0, 0xa0, 0xc5, 0x8b, 0x87, 0xc2, 0x0, 0x0,
+    0x95, 0x80, 0x93, 0x91, 0xa0, 0x20, 0x3, 0x57,
+    0x36, 0xa0, 0x90, 0xa0, 0x70, 0x6, 0x10, 0x2c,
+    0x97, 0x10, 0x38, 0x70, 0x13, 0x5, 0x60, 0x17,
+    0xac, 0xdd, 0xb1, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+884C "行" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x80, 0x0, 0x0, 0x6, 0x0, 0x0, 0x3a,
+    0x0, 0x55, 0x55, 0x56, 0x10, 0x1, 0x80, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x1, 0xd1, 0x0,
+    0x0, 0x0, 0x20, 0x0, 0xb, 0x34, 0x65, 0x59,
+    0x57, 0x90, 0x0, 0x7e, 0x10, 0x0, 0xc, 0x0,
+    0x0, 0x4, 0x6c, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x13, 0xc, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0x12, 0x2c, 0x0, 0x0, 0x0, 0xc, 0x0, 0x6,
+    0xe8, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x10,
+    0x0, 0x0,
+
+    /* U+8853 "術" */
+    0x0, 0x21, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x87, 0x0, 0xd2, 0x2, 0x55, 0x90, 0x1, 0x90,
+    0x0, 0xb5, 0x60, 0x10, 0x0, 0x7, 0x9, 0x0,
+    0xb0, 0x60, 0x0, 0x0, 0x20, 0x5a, 0x33, 0xc6,
+    0x50, 0x0, 0x50, 0x0, 0xd1, 0x2a, 0xc1, 0x15,
+    0x6c, 0x51, 0x7, 0xd2, 0xb, 0xc4, 0x0, 0xb,
+    0x0, 0x32, 0xb0, 0x19, 0xb6, 0x90, 0xb, 0x0,
+    0x0, 0xb0, 0x63, 0xb0, 0x70, 0xb, 0x0, 0x0,
+    0xb0, 0x70, 0xb0, 0x0, 0xb, 0x0, 0x0, 0xb4,
+    0x10, 0xb0, 0x0, 0xb, 0x0, 0x0, 0xb1, 0x0,
+    0xb0, 0x0, 0xb, 0x0, 0x0, 0xb0, 0x0, 0xb0,
+    0x6, 0xd9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x10, 0x0,
+
+    /* U+8868 "表" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc1, 0x0, 0x1, 0x0, 0x1, 0x65,
+    0x55, 0xd5, 0x55, 0x6c, 0x10, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0x20, 0x0, 0x0, 0x26, 0x55, 0xd5,
+    0x55, 0x92, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0,
+    0x2, 0x30, 0x6, 0x55, 0x57, 0xe5, 0x55, 0x57,
+    0x70, 0x0, 0x0, 0xc, 0x45, 0x0, 0xc3, 0x0,
+    0x0, 0x0, 0xc4, 0x8, 0x28, 0x20, 0x0, 0x0,
+    0x3a, 0xe0, 0x1, 0xb0, 0x0, 0x0, 0x16, 0x50,
+    0xd0, 0x0, 0x4a, 0x10, 0x0, 0x0, 0x0, 0xd2,
+    0x73, 0x3, 0xda, 0x61, 0x0, 0x0, 0xe9, 0x0,
+    0x0, 0x7, 0x40, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+88AB "被" */
+    0x0, 0x20, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0,
+    0x49, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x6,
+    0x0, 0x0, 0xb, 0x0, 0x0, 0x5, 0x55, 0xc1,
+    0xb5, 0x5c, 0x55, 0xe1, 0x0, 0x2, 0xa0, 0xb0,
+    0xb, 0x5, 0x30, 0x0, 0xa, 0x33, 0xb0, 0xb,
+    0x0, 0x0, 0x0, 0x3b, 0x65, 0xc5, 0x5b, 0x5a,
+    0x30, 0x0, 0x8d, 0x60, 0xc1, 0x30, 0xd, 0x0,
+    0x6, 0xb, 0x94, 0xb0, 0x60, 0x66, 0x0, 0x0,
+    0xb, 0x15, 0xa0, 0x55, 0xc0, 0x0, 0x0, 0xb,
+    0x4, 0x50, 0xe, 0x50, 0x0, 0x0, 0xb, 0x8,
+    0x1, 0x94, 0xa6, 0x0, 0x0, 0xc, 0x43, 0x56,
+    0x0, 0x8, 0xd3, 0x0, 0x1, 0x11, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+88CF "裏" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3a, 0x0, 0x5, 0x20, 0x5, 0x55,
+    0x55, 0x55, 0x55, 0x65, 0x30, 0x0, 0xc, 0x55,
+    0x69, 0x55, 0xd1, 0x0, 0x0, 0xc, 0x55, 0x6b,
+    0x55, 0xc0, 0x0, 0x0, 0xb, 0x0, 0x19, 0x0,
+    0xb0, 0x0, 0x0, 0x7, 0x55, 0x6b, 0x55, 0x70,
+    0x0, 0x0, 0x36, 0x55, 0x6b, 0x55, 0x74, 0x0,
+    0x4, 0x65, 0x55, 0x8a, 0x55, 0x58, 0x80, 0x0,
+    0x0, 0x7, 0xa5, 0x1, 0xc4, 0x0, 0x0, 0x4,
+    0xba, 0x3, 0x87, 0x20, 0x0, 0x3, 0x64, 0x48,
+    0x15, 0x4a, 0x85, 0x30, 0x0, 0x0, 0x6d, 0x70,
+    0x0, 0x49, 0x40, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+88DC "補" */
+    0x0, 0x20, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x1b, 0x0, 0x0, 0xd, 0x37, 0x0, 0x0, 0x7,
+    0x0, 0x0, 0xb, 0x7, 0x40, 0x6, 0x55, 0xc4,
+    0x65, 0x5c, 0x55, 0xb3, 0x0, 0x3, 0x90, 0x20,
+    0xb, 0x0, 0x30, 0x0, 0xa, 0x23, 0xb5, 0x5c,
+    0x57, 0xb0, 0x0, 0x4c, 0x57, 0xb0, 0xb, 0x2,
+    0x90, 0x1, 0x8c, 0x70, 0xb5, 0x5c, 0x56, 0x90,
+    0x6, 0xb, 0x95, 0xb0, 0xb, 0x2, 0x90, 0x10,
+    0xb, 0x17, 0xb5, 0x5c, 0x56, 0x90, 0x0, 0xb,
+    0x0, 0xb0, 0xb, 0x2, 0x90, 0x0, 0xb, 0x0,
+    0xb0, 0xb, 0x2, 0x90, 0x0, 0xc, 0x0, 0xb0,
+    0xa, 0x3b, 0x60, 0x0, 0x1, 0x0, 0x20, 0x0,
+    0x1, 0x0,
+
+    /* U+88E1 "裡" */
+    0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1b, 0x0, 0x30, 0x0, 0x4, 0x0, 0x0, 0x7,
+    0x0, 0xb5, 0x5c, 0x5c, 0x20, 0x6, 0x55, 0xc1,
+    0xa0, 0xb, 0xa, 0x0, 0x0, 0x3, 0x90, 0xa5,
+    0x5c, 0x5c, 0x0, 0x0, 0xa, 0x23, 0xa0, 0xb,
+    0xa, 0x0, 0x0, 0x3c, 0x48, 0xa0, 0xb, 0xa,
+    0x0, 0x0, 0x8c, 0x70, 0xb5, 0x5c, 0x5b, 0x0,
+    0x6, 0xb, 0x95, 0x40, 0xb, 0x0, 0x0, 0x10,
+    0xb, 0x17, 0x0, 0xb, 0x6, 0x10, 0x0, 0xb,
+    0x0, 0x75, 0x5c, 0x55, 0x20, 0x0, 0xb, 0x0,
+    0x0, 0xb, 0x0, 0x0, 0x0, 0xc, 0x5, 0x55,
+    0x5c, 0x57, 0xc1, 0x0, 0x3, 0x1, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+88FD "製" */
+    0x0, 0x10, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x84, 0xa3, 0x1, 0x0, 0xb, 0x20, 0x2, 0x95,
+    0xc5, 0x68, 0x8, 0xb, 0x0, 0x7, 0x55, 0xc5,
+    0x5a, 0x1b, 0xb, 0x0, 0x0, 0x75, 0xc5, 0x58,
+    0xb, 0xb, 0x0, 0x0, 0xa0, 0xa0, 0xa, 0xb,
+    0xb, 0x0, 0x0, 0xa0, 0xa1, 0x79, 0x2, 0x1b,
+    0x0, 0x0, 0x60, 0x90, 0x64, 0x0, 0x7a, 0x0,
+    0x4, 0x55, 0x55, 0x5b, 0x55, 0x5d, 0x60, 0x1,
+    0x0, 0x3a, 0x25, 0x0, 0x73, 0x0, 0x0, 0x17,
+    0xd1, 0x0, 0x76, 0x50, 0x0, 0x15, 0x40, 0xa1,
+    0x55, 0x1a, 0x51, 0x0, 0x0, 0x0, 0xbb, 0x30,
+    0x0, 0x6c, 0x80, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8907 "複" */
+    0x0, 0x20, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0x57, 0x0, 0xc, 0x40, 0x0, 0x10, 0x0, 0xa,
+    0x0, 0x1d, 0x55, 0x56, 0xa1, 0x5, 0x55, 0xa0,
+    0x76, 0x0, 0x4, 0x0, 0x0, 0x3, 0xa1, 0x6c,
+    0x55, 0x5c, 0x20, 0x0, 0xa, 0x25, 0xc, 0x55,
+    0x5c, 0x0, 0x0, 0x3b, 0x57, 0xb, 0x0, 0xb,
+    0x0, 0x0, 0x9c, 0x70, 0x9, 0xd5, 0x58, 0x0,
+    0x7, 0xa, 0x94, 0x4, 0xa5, 0x5b, 0x0, 0x0,
+    0xa, 0x16, 0x17, 0x50, 0x67, 0x0, 0x0, 0xa,
+    0x0, 0x40, 0x46, 0xa0, 0x0, 0x0, 0xa, 0x0,
+    0x0, 0x6d, 0x60, 0x0, 0x0, 0xa, 0x1, 0x57,
+    0x30, 0x5c, 0xa3, 0x0, 0x1, 0x12, 0x0, 0x0,
+    0x0, 0x10,
+
+    /* U+897F "西" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x20, 0x65,
+    0x55, 0xc5, 0x5c, 0x55, 0x53, 0x0, 0x0, 0xb,
+    0x0, 0xb0, 0x0, 0x0, 0x7, 0x55, 0xc5, 0x5c,
+    0x55, 0x92, 0x0, 0xb0, 0xb, 0x0, 0xb0, 0xb,
+    0x0, 0xb, 0x0, 0xc0, 0xb, 0x0, 0xb0, 0x0,
+    0xb0, 0x1a, 0x0, 0xb0, 0xb, 0x0, 0xb, 0x6,
+    0x40, 0xb, 0x1, 0xb0, 0x0, 0xb1, 0x70, 0x0,
+    0x7a, 0x9b, 0x0, 0xb, 0x30, 0x0, 0x0, 0x0,
+    0xb0, 0x0, 0xc5, 0x55, 0x55, 0x55, 0x5d, 0x0,
+    0xb, 0x0, 0x0, 0x0, 0x0, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+8981 "要" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55,
+    0x55, 0x55, 0x55, 0x56, 0xd2, 0x0, 0x0, 0xb,
+    0x0, 0xb0, 0x0, 0x0, 0x7, 0x55, 0xc5, 0x5c,
+    0x5b, 0x20, 0x0, 0xb0, 0xb, 0x0, 0xb0, 0xb0,
+    0x0, 0xb, 0x0, 0xb0, 0xb, 0xb, 0x0, 0x0,
+    0xa5, 0x5a, 0x65, 0x55, 0x90, 0x0, 0x0, 0x1,
+    0xd1, 0x0, 0x0, 0x61, 0x26, 0x55, 0xc7, 0x55,
+    0x89, 0x57, 0x40, 0x0, 0x39, 0x0, 0xb, 0x10,
+    0x0, 0x0, 0x3, 0x66, 0x7b, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x4a, 0x66, 0xca, 0x10, 0x3, 0x56,
+    0x74, 0x0, 0x0, 0x59, 0x1, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+898B "見" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x55, 0x55, 0x55, 0xe1, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xc, 0x55,
+    0x55, 0x55, 0xc0, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0xc, 0x55, 0x55, 0x55,
+    0xc0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0xc0, 0x0,
+    0x0, 0xd, 0x5c, 0x65, 0xd5, 0xb0, 0x0, 0x0,
+    0x3, 0xc, 0x0, 0xc0, 0x0, 0x10, 0x0, 0x0,
+    0x1c, 0x0, 0xc0, 0x0, 0x50, 0x0, 0x0, 0xa4,
+    0x0, 0xc0, 0x0, 0x90, 0x0, 0x48, 0x40, 0x0,
+    0xdb, 0xaa, 0xe2, 0x14, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+898F "規" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0x0, 0x85, 0x55, 0x5b, 0x20, 0x0, 0xb,
+    0x0, 0xb0, 0x0, 0xb, 0x0, 0x4, 0x5c, 0x74,
+    0xb5, 0x55, 0x5c, 0x0, 0x1, 0xb, 0x0, 0xb0,
+    0x0, 0xb, 0x0, 0x0, 0xb, 0x0, 0xb5, 0x55,
+    0x5c, 0x0, 0x17, 0x5c, 0x59, 0xb0, 0x0, 0xb,
+    0x0, 0x0, 0xb, 0x0, 0xb0, 0x0, 0xb, 0x0,
+    0x0, 0x1c, 0x10, 0xb5, 0xd7, 0x9a, 0x0, 0x0,
+    0x37, 0x76, 0x10, 0xc3, 0x70, 0x0, 0x0, 0x82,
+    0xc, 0x14, 0x83, 0x70, 0x20, 0x1, 0x70, 0x1,
+    0xb, 0x13, 0x70, 0x60, 0x6, 0x0, 0x3, 0x71,
+    0x2, 0xca, 0xd1, 0x10, 0x0, 0x11, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8996 "視" */
+    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1a, 0x0, 0x85, 0x55, 0x5b, 0x30, 0x0, 0x8,
+    0x20, 0xb0, 0x0, 0xb, 0x0, 0x6, 0x55, 0xb2,
+    0xb5, 0x55, 0x5c, 0x0, 0x0, 0x2, 0xa0, 0xb0,
+    0x0, 0xb, 0x0, 0x0, 0xa, 0x10, 0xb5, 0x55,
+    0x5c, 0x0, 0x0, 0x5d, 0x10, 0xb0, 0x0, 0xb,
+    0x0, 0x2, 0x7b, 0xa5, 0xb0, 0x0, 0xb, 0x0,
+    0x15, 0xb, 0x19, 0xb5, 0xd7, 0x9b, 0x0, 0x0,
+    0xb, 0x0, 0x0, 0xb3, 0x70, 0x0, 0x0, 0xb,
+    0x0, 0x5, 0x73, 0x70, 0x30, 0x0, 0xc, 0x0,
+    0x1a, 0x3, 0x70, 0x70, 0x0, 0xc, 0x3, 0x60,
+    0x1, 0xca, 0xe2, 0x0, 0x1, 0x21, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+899A "覚" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x72, 0xa, 0x10, 0x97, 0x0, 0x1, 0x1, 0xc0,
+    0x57, 0x19, 0x0, 0x0, 0x75, 0x56, 0x55, 0x58,
+    0x55, 0xa9, 0x3d, 0x1, 0x0, 0x0, 0x2, 0x9,
+    0x1, 0x20, 0xa5, 0x55, 0x55, 0xd4, 0x10, 0x0,
+    0xa, 0x55, 0x55, 0x5c, 0x0, 0x0, 0x0, 0xa0,
+    0x0, 0x0, 0xb0, 0x0, 0x0, 0xa, 0x55, 0x55,
+    0x5c, 0x0, 0x0, 0x0, 0xa5, 0x75, 0x75, 0xc0,
+    0x0, 0x0, 0x3, 0xc, 0xb, 0x3, 0x0, 0x30,
+    0x0, 0x7, 0x60, 0xb0, 0x0, 0x15, 0x0, 0x47,
+    0x50, 0x8, 0xba, 0xac, 0x90, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+89AA "親" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0x80, 0x6, 0x55, 0x56, 0x80, 0x2, 0x65,
+    0xa6, 0x89, 0x10, 0x3, 0x60, 0x0, 0x51, 0xb,
+    0x9, 0x65, 0x57, 0x60, 0x0, 0x1a, 0x16, 0x9,
+    0x10, 0x3, 0x60, 0x5, 0x56, 0x85, 0xa9, 0x65,
+    0x57, 0x60, 0x0, 0x1, 0x80, 0x9, 0x10, 0x3,
+    0x60, 0x2, 0x56, 0xb6, 0x69, 0x65, 0x57, 0x60,
+    0x0, 0x1, 0x80, 0x8, 0x47, 0xa2, 0x40, 0x0,
+    0xa4, 0x95, 0x0, 0x55, 0xa0, 0x0, 0x2, 0x81,
+    0x86, 0x80, 0x82, 0xa0, 0x20, 0x7, 0x1, 0x80,
+    0x71, 0x90, 0xa0, 0x40, 0x1, 0x4c, 0x50, 0x26,
+    0x0, 0x7a, 0xc4, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+89BA "覺" */
+    0x0, 0x0, 0x20, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0x86, 0x71, 0x6a, 0x36, 0x98, 0x0, 0x0, 0xa4,
+    0x63, 0x47, 0x14, 0x94, 0x0, 0x0, 0x92, 0x31,
+    0x4a, 0x12, 0xa2, 0x0, 0x0, 0x87, 0x43, 0x7a,
+    0x16, 0xd0, 0x0, 0x9, 0x76, 0x55, 0x55, 0x55,
+    0x97, 0xb0, 0x58, 0x8, 0x55, 0x55, 0x5a, 0x25,
+    0x0, 0x0, 0xa, 0x55, 0x55, 0x5b, 0x0, 0x0,
+    0x0, 0xa, 0x33, 0x33, 0x3b, 0x0, 0x0, 0x0,
+    0xa, 0x11, 0x11, 0x1a, 0x10, 0x0, 0x0, 0x8,
+    0x5c, 0x5c, 0x58, 0x0, 0x30, 0x0, 0x0, 0x56,
+    0xa, 0x0, 0x0, 0x60, 0x0, 0x36, 0x50, 0x8,
+    0xa9, 0x9a, 0xd0, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+89C0 "觀" */
+    0x0, 0x10, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x93, 0x56, 0x6, 0x55, 0x57, 0x60, 0x6, 0xb6,
+    0x99, 0x99, 0x10, 0x5, 0x50, 0x1, 0x53, 0x42,
+    0x28, 0x65, 0x58, 0x50, 0xa, 0x5b, 0xa5, 0xb8,
+    0x10, 0x5, 0x50, 0xa, 0x59, 0xa5, 0x98, 0x65,
+    0x58, 0x50, 0x2, 0xa5, 0x50, 0x8, 0x10, 0x5,
+    0x50, 0x4, 0xa5, 0xa7, 0x78, 0x65, 0x58, 0x50,
+    0xb, 0x52, 0x81, 0x8, 0x57, 0xa4, 0x30, 0x26,
+    0x86, 0xa6, 0x30, 0x55, 0xa0, 0x0, 0x5, 0x86,
+    0xa7, 0x40, 0x82, 0xa0, 0x20, 0x5, 0x52, 0x81,
+    0x21, 0x90, 0xa0, 0x50, 0x6, 0x85, 0x55, 0x66,
+    0x0, 0x9a, 0xd3, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0,
+
+    /* U+89D2 "角" */
+    0x0, 0x0, 0x12, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x90, 0x1, 0x0, 0x0, 0x0, 0x1, 0xd5,
+    0x55, 0xc9, 0x0, 0x0, 0x0, 0xa3, 0x0, 0x18,
+    0x0, 0x0, 0x0, 0x7d, 0x55, 0x5a, 0x55, 0x5e,
+    0x0, 0x63, 0xb0, 0x0, 0xc0, 0x0, 0xc0, 0x0,
+    0xb, 0x55, 0x5d, 0x55, 0x5c, 0x0, 0x0, 0xb0,
+    0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc, 0x55, 0x5d,
+    0x55, 0x5c, 0x0, 0x0, 0xb0, 0x0, 0xc0, 0x0,
+    0xc0, 0x0, 0x38, 0x0, 0xc, 0x0, 0xc, 0x0,
+    0xa, 0x10, 0x0, 0xc0, 0x0, 0xc0, 0x7, 0x20,
+    0x0, 0x1a, 0x6, 0xda, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x0,
+
+    /* U+89E3 "解" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x30, 0x4, 0x56, 0x55, 0xa0, 0x0, 0x2d,
+    0x58, 0x0, 0x1b, 0x0, 0xb0, 0x0, 0x92, 0x58,
+    0x0, 0x75, 0x0, 0xa0, 0x3, 0xc5, 0x97, 0x63,
+    0x90, 0x4a, 0x70, 0x4, 0xa0, 0xa5, 0x74, 0x41,
+    0x93, 0x0, 0x0, 0xc5, 0xc8, 0x50, 0xc2, 0xa0,
+    0x20, 0x0, 0xa0, 0xa5, 0x55, 0x95, 0xc6, 0x70,
+    0x0, 0xb3, 0xb7, 0x67, 0x1, 0xa0, 0x0, 0x0,
+    0xa2, 0xb7, 0x77, 0x55, 0xc5, 0x95, 0x2, 0x70,
+    0xa5, 0x50, 0x1, 0xa0, 0x0, 0x6, 0x20, 0xb5,
+    0x50, 0x1, 0xa0, 0x0, 0x6, 0x0, 0x6b, 0x40,
+    0x1, 0xb0, 0x0, 0x10, 0x0, 0x2, 0x0, 0x0,
+    0x10, 0x0,
+
+    /* U+89E6 "触" */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x40, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x2c,
+    0x5a, 0x20, 0x0, 0xa0, 0x0, 0x0, 0x91, 0x28,
+    0x0, 0x0, 0xa0, 0x10, 0x4, 0xc5, 0x95, 0xa3,
+    0xa5, 0xc5, 0xd0, 0x13, 0xa0, 0x90, 0xa3, 0x70,
+    0xa0, 0xa0, 0x0, 0xc5, 0xb5, 0xa3, 0x70, 0xa0,
+    0xa0, 0x0, 0xa0, 0x90, 0xa3, 0x70, 0xa0, 0xa0,
+    0x0, 0xc5, 0xb5, 0xa3, 0xa5, 0xc5, 0xa0, 0x0,
+    0xa0, 0x90, 0xa1, 0x10, 0xa0, 0x0, 0x2, 0x60,
+    0x90, 0xa0, 0x0, 0xa2, 0x60, 0x6, 0x10, 0xa0,
+    0xa3, 0x56, 0xc4, 0xb3, 0x5, 0x0, 0x47, 0x98,
+    0x62, 0x0, 0x33, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8A00 "言" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x35, 0x0, 0x5, 0x20, 0x65, 0x55, 0x55, 0x55,
+    0x55, 0x54, 0x0, 0x0, 0x0, 0x0, 0x2, 0x70,
+    0x0, 0x0, 0x65, 0x55, 0x55, 0x55, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x50, 0x0, 0x0, 0x65,
+    0x55, 0x55, 0x56, 0x10, 0x0, 0x3, 0x0, 0x0,
+    0x0, 0x40, 0x0, 0x0, 0xc5, 0x55, 0x55, 0x6c,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0x2, 0xa0, 0x0,
+    0x0, 0xc5, 0x55, 0x55, 0x7a, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x2, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+8A08 "計" */
+    0x0, 0x21, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0,
+    0x1d, 0x10, 0x0, 0xd, 0x10, 0x0, 0x15, 0x5d,
+    0x67, 0x80, 0xc, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x3, 0x44, 0x49, 0x0,
+    0xc, 0x0, 0x30, 0x2, 0x21, 0x11, 0x36, 0x5d,
+    0x56, 0x80, 0x4, 0x55, 0x5a, 0x10, 0xc, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x7, 0x55, 0x59, 0x0, 0xc, 0x0, 0x0, 0xb,
+    0x0, 0xb, 0x0, 0xc, 0x0, 0x0, 0xb, 0x0,
+    0xb, 0x0, 0xc, 0x0, 0x0, 0xb, 0x55, 0x5b,
+    0x0, 0xd, 0x0, 0x0, 0xb, 0x0, 0xb, 0x0,
+    0xd, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0,
+
+    /* U+8A0A "訊" */
+    0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x39, 0x4, 0x68, 0x55, 0xd0, 0x0, 0x15, 0x5c,
+    0x6a, 0xb, 0x0, 0xc0, 0x0, 0x1, 0x0, 0x0,
+    0xb, 0x0, 0xb0, 0x0, 0x4, 0x55, 0x91, 0xb,
+    0x0, 0xb0, 0x0, 0x1, 0x0, 0x0, 0xb, 0x10,
+    0xb0, 0x0, 0x4, 0x55, 0xa3, 0x6c, 0x74, 0xa0,
+    0x0, 0x1, 0x0, 0x0, 0xb, 0x0, 0xb0, 0x0,
+    0x7, 0x55, 0x92, 0xb, 0x0, 0xb0, 0x0, 0xb,
+    0x0, 0xa1, 0xb, 0x0, 0x93, 0x10, 0xb, 0x0,
+    0xa1, 0xb, 0x0, 0x48, 0x60, 0xb, 0x55, 0xc1,
+    0xc, 0x0, 0xc, 0xb0, 0xb, 0x0, 0xa1, 0xb,
+    0x0, 0x1, 0xd0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8A0E "討" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x46, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xa,
+    0x6, 0x0, 0x0, 0xd0, 0x0, 0x26, 0x55, 0x55,
+    0x10, 0x0, 0xd0, 0x10, 0x4, 0x55, 0x93, 0x54,
+    0x44, 0xd5, 0x80, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0xd0, 0x0, 0x0, 0x0, 0x50, 0x8, 0x0, 0xd0,
+    0x0, 0x5, 0x55, 0x50, 0x4, 0xb0, 0xd0, 0x0,
+    0x6, 0x55, 0x82, 0x0, 0x90, 0xd0, 0x0, 0xb,
+    0x0, 0xa1, 0x0, 0x0, 0xd0, 0x0, 0xb, 0x0,
+    0xa1, 0x0, 0x0, 0xd0, 0x0, 0xb, 0x55, 0xc1,
+    0x1, 0x0, 0xd0, 0x0, 0xc, 0x0, 0xa1, 0x1,
+    0x7e, 0xc0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x2,
+    0x10, 0x0,
+
+    /* U+8A13 "訓" */
+    0x0, 0x20, 0x0, 0x1, 0x0, 0x0, 0x10, 0x0,
+    0x39, 0x0, 0xc, 0x7, 0x11, 0xc0, 0x25, 0x5b,
+    0x6a, 0xc, 0xb, 0x0, 0xa0, 0x0, 0x0, 0x0,
+    0xc, 0xb, 0x0, 0xa0, 0x5, 0x55, 0x91, 0xb,
+    0xb, 0x0, 0xa0, 0x0, 0x0, 0x10, 0xc, 0xb,
+    0x0, 0xa0, 0x4, 0x55, 0x81, 0xc, 0xb, 0x0,
+    0xa0, 0x0, 0x0, 0x10, 0xc, 0xb, 0x0, 0xa0,
+    0xb, 0x55, 0xc3, 0x1a, 0xb, 0x0, 0xa0, 0xb,
+    0x0, 0xa1, 0x56, 0xb, 0x0, 0xa0, 0xb, 0x0,
+    0xa1, 0xa1, 0xb, 0x0, 0xa0, 0xb, 0x55, 0x94,
+    0x70, 0x7, 0x1, 0xa0, 0x5, 0x0, 0x16, 0x0,
+    0x0, 0x1, 0xa0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8A18 "記" */
+    0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4a, 0x0, 0x25, 0x55, 0x5a, 0x20, 0x25, 0x5d,
+    0x59, 0x31, 0x0, 0xc, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0x0, 0x4, 0x55, 0x58, 0x0,
+    0x0, 0xc, 0x0, 0x1, 0x0, 0x0, 0x9, 0x55,
+    0x5d, 0x0, 0x4, 0x55, 0x76, 0xc, 0x0, 0x5,
+    0x0, 0x1, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0,
+    0x7, 0x55, 0x5a, 0xc, 0x0, 0x0, 0x0, 0xb,
+    0x0, 0xc, 0xc, 0x0, 0x0, 0x10, 0xb, 0x0,
+    0xb, 0xc, 0x0, 0x0, 0x50, 0xb, 0x55, 0x5b,
+    0xc, 0x0, 0x0, 0x90, 0xc, 0x0, 0xb, 0x9,
+    0xcb, 0xbc, 0xb0, 0x2, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8A2A "訪" */
+    0x0, 0x20, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x67, 0x0, 0x0, 0x4b, 0x0, 0x0, 0x25, 0x6b,
+    0x68, 0x0, 0xb, 0x30, 0x10, 0x1, 0x0, 0x0,
+    0x65, 0x85, 0x57, 0x90, 0x4, 0x55, 0x91, 0x0,
+    0xd0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xd0,
+    0x1, 0x0, 0x3, 0x55, 0x80, 0x0, 0xc5, 0x5c,
+    0x40, 0x1, 0x0, 0x0, 0x2, 0x80, 0xa, 0x10,
+    0x7, 0x55, 0xa2, 0x6, 0x50, 0xb, 0x0, 0xb,
+    0x0, 0xb0, 0xa, 0x0, 0xc, 0x0, 0xb, 0x0,
+    0xb0, 0x27, 0x0, 0xc, 0x0, 0xb, 0x55, 0xc0,
+    0x80, 0x12, 0x2a, 0x0, 0xb, 0x0, 0x95, 0x20,
+    0x5, 0xf3, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x10, 0x0,
+
+    /* U+8A2D "設" */
+    0x0, 0x20, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x67, 0x0, 0xb, 0x55, 0xd2, 0x0, 0x25, 0x6b,
+    0x67, 0xc, 0x0, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x0, 0xb0, 0x0, 0x5, 0x55, 0x91, 0x29,
+    0x0, 0xb2, 0x30, 0x0, 0x0, 0x0, 0x80, 0x0,
+    0x4a, 0x92, 0x4, 0x65, 0x84, 0x46, 0x55, 0x6d,
+    0x10, 0x0, 0x0, 0x0, 0x6, 0x0, 0x88, 0x0,
+    0xa, 0x55, 0xb2, 0x3, 0x41, 0xc0, 0x0, 0xb,
+    0x0, 0xb0, 0x0, 0x9a, 0x30, 0x0, 0xb, 0x0,
+    0xb0, 0x0, 0x9c, 0x0, 0x0, 0xb, 0x55, 0xc0,
+    0x7, 0x46, 0xa0, 0x0, 0xb, 0x0, 0x72, 0x72,
+    0x0, 0x7e, 0x81, 0x1, 0x0, 0x13, 0x0, 0x0,
+    0x3, 0x40,
+
+    /* U+8A31 "許" */
+    0x0, 0x20, 0x0, 0x1, 0x20, 0x0, 0x0, 0x0,
+    0x49, 0x0, 0x4, 0xb0, 0x0, 0x0, 0x15, 0x5d,
+    0x59, 0x8, 0x30, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0xc, 0x58, 0x59, 0x40, 0x4, 0x55, 0x91, 0x45,
+    0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x70, 0xc,
+    0x0, 0x0, 0x3, 0x55, 0x92, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x65, 0x5d, 0x55, 0xc1,
+    0x7, 0x55, 0xa2, 0x0, 0xc, 0x0, 0x0, 0xb,
+    0x0, 0xb0, 0x0, 0xc, 0x0, 0x0, 0xb, 0x0,
+    0xb0, 0x0, 0xc, 0x0, 0x0, 0xb, 0x55, 0xc0,
+    0x0, 0xc, 0x0, 0x0, 0xb, 0x0, 0x70, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x0, 0x0,
+
+    /* U+8A33 "訳" */
+    0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x29, 0x0, 0x5, 0x22, 0x22, 0x60, 0x26, 0x59,
+    0x6a, 0x1d, 0x33, 0x34, 0xa0, 0x0, 0x0, 0x10,
+    0xc, 0x0, 0x2, 0x90, 0x4, 0x55, 0x80, 0xc,
+    0x0, 0x2, 0x90, 0x0, 0x0, 0x10, 0xd, 0x56,
+    0x56, 0x90, 0x4, 0x55, 0x70, 0xb, 0x5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0x7, 0x0, 0x0,
+    0xb, 0x55, 0xc4, 0x28, 0x8, 0x0, 0x0, 0xb,
+    0x0, 0xb0, 0x64, 0x4, 0x60, 0x0, 0xb, 0x0,
+    0xb0, 0x90, 0x0, 0xc1, 0x0, 0xb, 0x55, 0xc2,
+    0x80, 0x0, 0x4c, 0x0, 0x6, 0x0, 0x27, 0x0,
+    0x0, 0x9, 0xd4, 0x0, 0x0, 0x31, 0x0, 0x0,
+    0x0, 0x40,
+
+    /* U+8A34 "訴" */
+    0x0, 0x30, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0,
+    0x68, 0x0, 0x3, 0x36, 0xac, 0x30, 0x16, 0x6a,
+    0x69, 0xd, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0x4, 0x65, 0x81, 0xd,
+    0x55, 0x55, 0xb1, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0xc0, 0x0, 0x3, 0x55, 0x80, 0xc, 0x22, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0x4, 0xe8, 0x10,
+    0xa, 0x55, 0xc2, 0x38, 0x0, 0xc5, 0xe0, 0xb,
+    0x0, 0xb0, 0x74, 0x0, 0xc0, 0x30, 0xb, 0x0,
+    0xb0, 0xa0, 0x0, 0xc0, 0x0, 0xb, 0x55, 0xc5,
+    0x40, 0x0, 0xd0, 0x0, 0x7, 0x0, 0x36, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8A55 "評" */
+    0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x59, 0x0, 0x36, 0x59, 0x56, 0x70, 0x15, 0x5d,
+    0x67, 0x20, 0xc, 0x1, 0x30, 0x1, 0x0, 0x0,
+    0x56, 0xc, 0x6, 0xa0, 0x3, 0x55, 0x90, 0xe,
+    0x1c, 0xa, 0x0, 0x1, 0x0, 0x0, 0x8, 0x1c,
+    0x34, 0x0, 0x3, 0x44, 0x70, 0x0, 0xc, 0x10,
+    0x50, 0x1, 0x11, 0x11, 0x65, 0x5d, 0x55, 0x71,
+    0x7, 0x55, 0x92, 0x0, 0xc, 0x0, 0x0, 0xb,
+    0x0, 0xb0, 0x0, 0xc, 0x0, 0x0, 0xb, 0x0,
+    0xb0, 0x0, 0xc, 0x0, 0x0, 0xb, 0x55, 0xc0,
+    0x0, 0xd, 0x0, 0x0, 0xb, 0x0, 0xa0, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8A66 "試" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x74, 0x0, 0x0, 0xb, 0x43, 0x0, 0x0, 0x1a,
+    0x4, 0x0, 0xb, 0xc, 0x10, 0x16, 0x55, 0x56,
+    0x11, 0x1b, 0x13, 0x60, 0x3, 0x55, 0x82, 0x32,
+    0x2b, 0x32, 0x20, 0x1, 0x0, 0x0, 0x0, 0x9,
+    0x10, 0x0, 0x0, 0x0, 0x51, 0x67, 0xa9, 0x30,
+    0x0, 0x4, 0x55, 0x50, 0xb, 0x6, 0x50, 0x0,
+    0x6, 0x55, 0x81, 0xb, 0x3, 0x80, 0x0, 0xb,
+    0x0, 0xb0, 0xb, 0x0, 0xb0, 0x10, 0xb, 0x0,
+    0xb0, 0x4d, 0x62, 0x84, 0x50, 0xb, 0x55, 0xc3,
+    0x91, 0x0, 0x1c, 0xa0, 0xb, 0x0, 0xa0, 0x0,
+    0x0, 0x2, 0xb0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8A71 "話" */
+    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x66, 0x0, 0x0, 0x14, 0x7c, 0xa0, 0x15, 0x5c,
+    0x59, 0x24, 0x5c, 0x31, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0xb, 0x0, 0x0, 0x2, 0x33, 0x80, 0x0,
+    0xb, 0x0, 0x70, 0x2, 0x21, 0x12, 0x65, 0x5c,
+    0x55, 0x51, 0x3, 0x55, 0x80, 0x0, 0xb, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x43, 0x3c, 0x37, 0x10,
+    0x7, 0x55, 0x91, 0x94, 0x22, 0x2b, 0x10, 0xb,
+    0x0, 0xb0, 0x92, 0x0, 0xb, 0x0, 0xb, 0x0,
+    0xb0, 0x92, 0x0, 0xb, 0x0, 0xb, 0x55, 0xc0,
+    0x96, 0x55, 0x5c, 0x0, 0xb, 0x0, 0x90, 0x91,
+    0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8A72 "該" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x73, 0x0, 0x0, 0x85, 0x0, 0x0, 0x0, 0x1a,
+    0x4, 0x0, 0xc, 0x0, 0x0, 0x16, 0x55, 0x55,
+    0x54, 0x54, 0x44, 0xa1, 0x3, 0x55, 0x80, 0x0,
+    0xc4, 0x1, 0x0, 0x1, 0x0, 0x0, 0x8, 0x50,
+    0x2e, 0x10, 0x0, 0x0, 0x40, 0xaa, 0x87, 0xc4,
+    0x0, 0x4, 0x55, 0x50, 0x44, 0x17, 0x52, 0x0,
+    0x6, 0x55, 0x81, 0x0, 0x73, 0x1d, 0x40, 0xb,
+    0x0, 0xb0, 0x45, 0x0, 0xb4, 0x0, 0xb, 0x0,
+    0xb1, 0x0, 0x1c, 0x86, 0x0, 0xb, 0x55, 0xc0,
+    0x3, 0xa2, 0x6, 0xb0, 0xc, 0x0, 0xa2, 0x66,
+    0x0, 0x0, 0xb2, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8A73 "詳" */
+    0x0, 0x10, 0x0, 0x0, 0x0, 0x5, 0x0, 0x0,
+    0x67, 0x0, 0x9, 0x10, 0x2d, 0x10, 0x15, 0x5b,
+    0x6a, 0x6, 0x90, 0x73, 0x0, 0x1, 0x0, 0x1,
+    0x45, 0x84, 0xa4, 0xb1, 0x3, 0x55, 0x91, 0x21,
+    0x1c, 0x11, 0x10, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0x2, 0x0, 0x3, 0x55, 0x90, 0x26, 0x5d, 0x57,
+    0x30, 0x1, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x6, 0x44, 0x81, 0x0, 0xc, 0x0, 0x70, 0xb,
+    0x0, 0xb2, 0x65, 0x5d, 0x55, 0x52, 0xb, 0x0,
+    0xb0, 0x0, 0xc, 0x0, 0x0, 0xb, 0x55, 0xc0,
+    0x0, 0xc, 0x0, 0x0, 0x9, 0x0, 0x70, 0x0,
+    0xd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x0, 0x0,
+
+    /* U+8A8C "誌" */
+    0x0, 0x20, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x77, 0x0, 0x0, 0xc, 0x0, 0x0, 0x15, 0x6b,
+    0x68, 0x0, 0xb, 0x0, 0x20, 0x1, 0x0, 0x0,
+    0x65, 0x5c, 0x56, 0xa0, 0x3, 0x55, 0x90, 0x0,
+    0xb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0x4, 0x10, 0x3, 0x55, 0x80, 0x26, 0x55, 0x55,
+    0x20, 0x1, 0x0, 0x0, 0x0, 0x43, 0x0, 0x0,
+    0x6, 0x55, 0x91, 0x8, 0x1c, 0x31, 0x0, 0xb,
+    0x0, 0xb0, 0x6b, 0x3, 0x24, 0x90, 0xb, 0x0,
+    0xb3, 0x8b, 0x0, 0x3, 0xa4, 0xb, 0x55, 0xc7,
+    0x2b, 0x10, 0x19, 0x0, 0xb, 0x0, 0xb0, 0x3,
+    0xaa, 0xa5, 0x0, 0x2, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8A8D "認" */
+    0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x57, 0x0, 0x14, 0x44, 0x45, 0x70, 0x15, 0x5c,
+    0x68, 0x2, 0x76, 0x14, 0xa0, 0x1, 0x0, 0x0,
+    0x42, 0x93, 0x4, 0x80, 0x3, 0x55, 0x91, 0xc1,
+    0xc0, 0x6, 0x60, 0x1, 0x0, 0x0, 0x27, 0x60,
+    0x9, 0x40, 0x3, 0x55, 0x70, 0x38, 0x3, 0x9d,
+    0x0, 0x1, 0x0, 0x0, 0x40, 0x35, 0x21, 0x0,
+    0x7, 0x55, 0x92, 0x7, 0x1b, 0x21, 0x0, 0xb,
+    0x0, 0xb0, 0x6b, 0x3, 0x5, 0x60, 0xb, 0x0,
+    0xb4, 0x8b, 0x0, 0x4, 0xb1, 0xb, 0x55, 0xc5,
+    0x2b, 0x10, 0x29, 0x10, 0xb, 0x0, 0xa0, 0x3,
+    0xaa, 0xa6, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8A95 "誕" */
+    0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x84, 0x1, 0x15, 0x0, 0x16, 0x90, 0x15, 0x8a,
+    0x97, 0x4d, 0x36, 0xb6, 0x20, 0x1, 0x0, 0x0,
+    0x57, 0x0, 0x72, 0x0, 0x4, 0x55, 0x80, 0xb1,
+    0x5, 0x72, 0x0, 0x0, 0x0, 0x3, 0xa2, 0xb,
+    0x77, 0x90, 0x4, 0x55, 0x83, 0x6b, 0x4a, 0x72,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xa, 0x72, 0x0,
+    0xa, 0x55, 0xc5, 0xa, 0xa, 0x72, 0x0, 0xa,
+    0x0, 0xa1, 0xb6, 0x2c, 0x97, 0x90, 0xa, 0x0,
+    0xa0, 0xb9, 0x2, 0x0, 0x0, 0xa, 0x55, 0xb7,
+    0x34, 0xc8, 0x53, 0x21, 0x5, 0x0, 0x53, 0x0,
+    0x5, 0xac, 0xa1, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8A98 "誘" */
+    0x0, 0x20, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0,
+    0x85, 0x0, 0x35, 0x7a, 0xbb, 0x20, 0x15, 0x79,
+    0x92, 0x0, 0xb, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x65, 0x7d, 0x65, 0xb1, 0x4, 0x55, 0x80, 0x2,
+    0xbb, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2a, 0x1b,
+    0x2b, 0x10, 0x4, 0x55, 0x74, 0x70, 0xb, 0x3,
+    0xd3, 0x0, 0x0, 0x10, 0x46, 0x95, 0x7a, 0x0,
+    0xb, 0x55, 0xd1, 0x2, 0xb0, 0x85, 0x0, 0xb,
+    0x0, 0xb0, 0x5, 0x70, 0xb5, 0xd1, 0xb, 0x0,
+    0xb0, 0xb, 0x10, 0x0, 0xc0, 0xb, 0x55, 0xc0,
+    0x75, 0x0, 0x4, 0x90, 0x4, 0x0, 0x26, 0x30,
+    0x2, 0xae, 0x20, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x11, 0x0,
+
+    /* U+8A9E "語" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x74, 0x0, 0x22, 0x22, 0x28, 0x0, 0x0, 0x1a,
+    0x13, 0x33, 0xb3, 0x33, 0x0, 0x16, 0x55, 0x54,
+    0x12, 0xb2, 0x52, 0x0, 0x3, 0x55, 0x80, 0x3,
+    0xa2, 0xa3, 0x0, 0x1, 0x0, 0x0, 0x1, 0x80,
+    0xa2, 0x0, 0x0, 0x0, 0x41, 0x35, 0x93, 0xc5,
+    0xa0, 0x4, 0x55, 0x51, 0x42, 0x22, 0x22, 0x20,
+    0x6, 0x55, 0x81, 0x1a, 0x44, 0x4d, 0x0, 0xb,
+    0x0, 0xb0, 0xb, 0x0, 0xc, 0x0, 0xb, 0x0,
+    0xb0, 0xb, 0x0, 0xc, 0x0, 0xb, 0x55, 0xc0,
+    0xd, 0x55, 0x5c, 0x0, 0xa, 0x0, 0x80, 0x1a,
+    0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8AAA "說" */
+    0x0, 0x20, 0x0, 0x0, 0x30, 0x30, 0x0, 0x0,
+    0x57, 0x0, 0x2, 0xd1, 0x70, 0x0, 0x15, 0x5c,
+    0x68, 0xa, 0x20, 0x64, 0x0, 0x1, 0x0, 0x0,
+    0x65, 0x0, 0xc, 0x40, 0x3, 0x55, 0x94, 0x58,
+    0x55, 0x5c, 0xb2, 0x0, 0x0, 0x0, 0xb, 0x0,
+    0xa, 0x0, 0x3, 0x55, 0x90, 0xb, 0x0, 0xa,
+    0x0, 0x1, 0x0, 0x0, 0xc, 0x33, 0x3b, 0x0,
+    0x7, 0x55, 0x92, 0x7, 0xb3, 0xc5, 0x0, 0xb,
+    0x0, 0xb0, 0x0, 0xb0, 0xb0, 0x0, 0xb, 0x0,
+    0xb0, 0x1, 0xa0, 0xb0, 0x30, 0xb, 0x55, 0xc0,
+    0x8, 0x30, 0xb0, 0x60, 0xb, 0x0, 0xa0, 0x64,
+    0x0, 0xb9, 0xd1, 0x1, 0x0, 0x3, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+8AAC "説" */
+    0x0, 0x20, 0x0, 0x10, 0x0, 0x23, 0x0, 0x0,
+    0x77, 0x0, 0xa, 0x0, 0x78, 0x0, 0x15, 0x6b,
+    0x75, 0x8, 0x50, 0x90, 0x0, 0x1, 0x0, 0x0,
+    0x44, 0x44, 0x66, 0x0, 0x4, 0x55, 0x91, 0xb3,
+    0x33, 0x3b, 0x10, 0x0, 0x0, 0x0, 0xb0, 0x0,
+    0xa, 0x0, 0x4, 0x55, 0x90, 0xb0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x0, 0xb6, 0x85, 0x8b, 0x0,
+    0xa, 0x55, 0xc2, 0x32, 0xa1, 0xa0, 0x0, 0xb,
+    0x0, 0xb0, 0x4, 0x91, 0xa0, 0x0, 0xb, 0x0,
+    0xb0, 0x9, 0x41, 0xa0, 0x50, 0xb, 0x55, 0xc0,
+    0x3a, 0x1, 0xa0, 0x70, 0x9, 0x0, 0x45, 0x80,
+    0x0, 0xc9, 0xd2, 0x0, 0x0, 0x32, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8AAD "読" */
+    0x0, 0x20, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x74, 0x0, 0x0, 0xc, 0x0, 0x0, 0x15, 0x78,
+    0x94, 0x55, 0x5c, 0x56, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0x0, 0x0, 0x4, 0x55, 0x91, 0x16,
+    0x5a, 0x58, 0x30, 0x0, 0x0, 0x0, 0x30, 0x0,
+    0x0, 0x20, 0x4, 0x55, 0x81, 0xb5, 0x55, 0x55,
+    0xe1, 0x0, 0x0, 0x13, 0x52, 0x80, 0x74, 0x10,
+    0xb, 0x55, 0xd1, 0x3, 0xa0, 0xb0, 0x0, 0xb,
+    0x0, 0xb0, 0x5, 0x80, 0xb0, 0x20, 0xb, 0x0,
+    0xb0, 0xa, 0x30, 0xb0, 0x40, 0xb, 0x55, 0xc0,
+    0x4a, 0x0, 0xb0, 0x70, 0x7, 0x0, 0x25, 0x80,
+    0x0, 0xba, 0xd1, 0x0, 0x0, 0x32, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8AB0 "誰" */
+    0x0, 0x10, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0,
+    0x65, 0x0, 0x7, 0x59, 0x40, 0x0, 0x13, 0x3b,
+    0x46, 0xb, 0x1, 0x71, 0x10, 0x3, 0x22, 0x22,
+    0x3d, 0x59, 0x57, 0x60, 0x4, 0x55, 0x80, 0xab,
+    0xa, 0x0, 0x0, 0x1, 0x0, 0x4, 0x5b, 0xa,
+    0x5, 0x10, 0x4, 0x55, 0x93, 0xc, 0x4c, 0x54,
+    0x20, 0x1, 0x0, 0x0, 0xb, 0xa, 0x0, 0x0,
+    0x5, 0x44, 0x81, 0xb, 0xa, 0x4, 0x10, 0xb,
+    0x11, 0xb1, 0xc, 0x5c, 0x55, 0x30, 0xb, 0x0,
+    0xb0, 0xb, 0xa, 0x0, 0x0, 0xb, 0x55, 0xc0,
+    0xb, 0xa, 0x2, 0x50, 0xb, 0x0, 0xa0, 0xd,
+    0x55, 0x55, 0x50, 0x1, 0x0, 0x0, 0x2, 0x0,
+    0x0, 0x0,
+
+    /* U+8AB2 "課" */
+    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x84, 0x0, 0xa5, 0x58, 0x5d, 0x20, 0x15, 0x89,
+    0x84, 0xb0, 0xb, 0xb, 0x0, 0x1, 0x0, 0x0,
+    0xb5, 0x5c, 0x5c, 0x0, 0x5, 0x55, 0x90, 0xb0,
+    0xb, 0xb, 0x0, 0x0, 0x0, 0x0, 0xb5, 0x5c,
+    0x5c, 0x0, 0x5, 0x55, 0x80, 0x40, 0xb, 0x3,
+    0x0, 0x0, 0x0, 0x2, 0x55, 0x5c, 0x56, 0xc2,
+    0xa, 0x55, 0xd1, 0x0, 0xec, 0x40, 0x0, 0xb,
+    0x0, 0xb0, 0x8, 0x6b, 0x80, 0x0, 0xb, 0x0,
+    0xb0, 0x3a, 0xb, 0x48, 0x0, 0xb, 0x55, 0xc2,
+    0x90, 0xb, 0xa, 0xa2, 0x5, 0x0, 0x34, 0x0,
+    0xc, 0x0, 0x51, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0,
+
+    /* U+8ABF "調" */
+    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x94, 0x0, 0x95, 0x56, 0x55, 0xd0, 0x14, 0x79,
+    0x64, 0xb0, 0xb, 0x0, 0xb0, 0x2, 0x11, 0x11,
+    0xb2, 0x5c, 0x74, 0xb0, 0x4, 0x54, 0x81, 0xb0,
+    0xa, 0x0, 0xb0, 0x0, 0x0, 0x0, 0xb4, 0x5c,
+    0x57, 0xb0, 0x5, 0x65, 0x91, 0xb1, 0x0, 0x0,
+    0xb0, 0x0, 0x0, 0x0, 0xb2, 0xa5, 0xb3, 0xb0,
+    0x9, 0x55, 0xb2, 0xb1, 0x80, 0x91, 0xb0, 0xb,
+    0x0, 0xb0, 0xb2, 0xb5, 0xb1, 0xb0, 0xb, 0x0,
+    0xb3, 0x71, 0x50, 0x50, 0xb0, 0xb, 0x55, 0xb8,
+    0x10, 0x0, 0x32, 0xb0, 0x4, 0x0, 0x24, 0x0,
+    0x0, 0x1b, 0x70, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8AC7 "談" */
+    0x0, 0x20, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x95, 0x0, 0x1, 0xa2, 0x5, 0x20, 0x15, 0x89,
+    0x85, 0x17, 0xa1, 0x8a, 0x30, 0x1, 0x0, 0x0,
+    0xc3, 0xb8, 0x30, 0x0, 0x5, 0x55, 0x90, 0x21,
+    0xe5, 0x60, 0x0, 0x0, 0x0, 0x0, 0xa, 0x50,
+    0x3d, 0x20, 0x5, 0x55, 0x82, 0x72, 0x94, 0x3,
+    0x30, 0x0, 0x0, 0x0, 0x2, 0xa3, 0x6, 0x0,
+    0x9, 0x55, 0xb2, 0x55, 0xc6, 0x98, 0x20, 0xb,
+    0x0, 0xb1, 0xb1, 0xc8, 0x0, 0x0, 0xb, 0x0,
+    0xb0, 0x7, 0x67, 0x30, 0x0, 0xb, 0x55, 0xc0,
+    0x1b, 0x1, 0xd2, 0x0, 0xb, 0x0, 0x83, 0x80,
+    0x0, 0x4f, 0x91, 0x1, 0x0, 0x34, 0x0, 0x0,
+    0x3, 0x30,
+
+    /* U+8ACB "請" */
+    0x0, 0x10, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x57, 0x0, 0x0, 0xc, 0x0, 0x0, 0x14, 0x4c,
+    0x75, 0x55, 0x5c, 0x58, 0x80, 0x2, 0x11, 0x11,
+    0x0, 0xb, 0x5, 0x0, 0x2, 0x44, 0x81, 0x16,
+    0x5c, 0x55, 0x20, 0x1, 0x11, 0x12, 0x65, 0x5b,
+    0x56, 0xa0, 0x2, 0x33, 0x71, 0x2, 0x0, 0x4,
+    0x0, 0x1, 0x21, 0x10, 0xc, 0x55, 0x5c, 0x20,
+    0x6, 0x55, 0x92, 0xc, 0x55, 0x5c, 0x0, 0xb,
+    0x0, 0xb0, 0xb, 0x0, 0xb, 0x0, 0xb, 0x0,
+    0xb0, 0xc, 0x55, 0x5c, 0x0, 0xb, 0x55, 0xc0,
+    0xb, 0x0, 0xb, 0x0, 0x7, 0x0, 0x50, 0xa,
+    0x4, 0xad, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x0,
+
+    /* U+8AD6 "論" */
+    0x0, 0x20, 0x0, 0x0, 0x14, 0x0, 0x0, 0x0,
+    0x76, 0x0, 0x0, 0x6d, 0x0, 0x0, 0x15, 0x6b,
+    0x67, 0x0, 0xd5, 0x20, 0x0, 0x1, 0x0, 0x0,
+    0x8, 0x50, 0x90, 0x0, 0x3, 0x44, 0x80, 0x57,
+    0x0, 0x5b, 0x10, 0x1, 0x21, 0x16, 0x56, 0x55,
+    0x95, 0xd4, 0x3, 0x55, 0x90, 0x65, 0x55, 0x55,
+    0x80, 0x1, 0x0, 0x0, 0xa0, 0xa0, 0xa0, 0x90,
+    0x6, 0x55, 0x90, 0xa0, 0xa0, 0xa0, 0x90, 0xa,
+    0x0, 0xb0, 0xb5, 0xc5, 0xc5, 0x90, 0xa, 0x0,
+    0xa0, 0xa0, 0xa0, 0xa0, 0x90, 0xa, 0x55, 0xb0,
+    0xa0, 0xa0, 0x80, 0x90, 0xa, 0x0, 0xa0, 0xa0,
+    0x0, 0x4b, 0x80, 0x1, 0x0, 0x0, 0x10, 0x0,
+    0x2, 0x0,
+
+    /* U+8AF8 "諸" */
+    0x0, 0x10, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x84, 0x0, 0x0, 0xb1, 0x2, 0x30, 0x14, 0x69,
+    0x73, 0x0, 0xa0, 0x3a, 0x70, 0x2, 0x0, 0x0,
+    0x45, 0xc5, 0x8a, 0x0, 0x5, 0x55, 0x90, 0x0,
+    0xa0, 0xc1, 0x20, 0x0, 0x0, 0x3, 0x65, 0x8b,
+    0x86, 0x90, 0x5, 0x55, 0x80, 0x0, 0x84, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1b, 0x85, 0x5b, 0x10,
+    0x9, 0x55, 0xd4, 0x8a, 0x0, 0xb, 0x0, 0xb,
+    0x0, 0xb2, 0x1c, 0x55, 0x5c, 0x0, 0xb, 0x0,
+    0xb0, 0x1a, 0x0, 0xb, 0x0, 0xb, 0x44, 0xc0,
+    0x1c, 0x55, 0x5c, 0x0, 0x7, 0x0, 0x50, 0x17,
+    0x0, 0x8, 0x0,
+
+    /* U+8B02 "謂" */
+    0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x67, 0x0, 0x95, 0x57, 0x56, 0xb0, 0x25, 0x6b,
+    0x78, 0xb0, 0xb, 0x1, 0x90, 0x0, 0x0, 0x0,
+    0xb5, 0x5c, 0x56, 0x90, 0x5, 0x55, 0x92, 0xb0,
+    0xb, 0x1, 0x90, 0x0, 0x0, 0x0, 0xb5, 0x57,
+    0x56, 0x70, 0x5, 0x55, 0x81, 0x16, 0x55, 0x59,
+    0x20, 0x0, 0x0, 0x0, 0x19, 0x0, 0xb, 0x0,
+    0xa, 0x55, 0xc2, 0x1b, 0x55, 0x5c, 0x0, 0xb,
+    0x0, 0xb0, 0x19, 0x0, 0xb, 0x0, 0xb, 0x0,
+    0xb0, 0x1b, 0x44, 0x4c, 0x0, 0xb, 0x55, 0xc0,
+    0x19, 0x0, 0xb, 0x0, 0x8, 0x0, 0x60, 0x29,
+    0x1, 0x8c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0,
+
+    /* U+8B1B "講" */
+    0x0, 0x10, 0x0, 0x2, 0x0, 0x20, 0x0, 0x0,
+    0x85, 0x0, 0x9, 0x40, 0xb0, 0x10, 0x12, 0x4a,
+    0x64, 0x6b, 0x65, 0xc5, 0x80, 0x14, 0x33, 0x31,
+    0x9, 0x20, 0xa1, 0x20, 0x3, 0x44, 0x70, 0x6b,
+    0x65, 0xc5, 0x40, 0x0, 0x0, 0x4, 0x57, 0x67,
+    0x85, 0x82, 0x5, 0x55, 0x80, 0x55, 0x5d, 0x58,
+    0x20, 0x0, 0x0, 0x0, 0x91, 0xa, 0xa, 0x0,
+    0x9, 0x55, 0xb0, 0x95, 0x5c, 0x5c, 0x0, 0xa,
+    0x0, 0xa0, 0x91, 0xa, 0xa, 0x10, 0xa, 0x0,
+    0xa4, 0xb5, 0x59, 0x5c, 0x91, 0xb, 0x55, 0xa0,
+    0x91, 0x0, 0xa, 0x0, 0x7, 0x0, 0x40, 0xa0,
+    0x2, 0x8d, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x2, 0x0,
+
+    /* U+8B1D "謝" */
+    0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0x92, 0x0, 0xa, 0x0, 0xa, 0x10, 0x0, 0x57,
+    0x43, 0x86, 0x80, 0xa, 0x0, 0x16, 0x55, 0x57,
+    0x40, 0xa0, 0xa, 0x0, 0x4, 0x56, 0x75, 0x74,
+    0xb4, 0x5c, 0x80, 0x1, 0x0, 0x5, 0x40, 0xa0,
+    0xa, 0x0, 0x3, 0x55, 0x85, 0x75, 0xb6, 0x2a,
+    0x0, 0x1, 0x0, 0x6, 0x41, 0xa0, 0xda, 0x0,
+    0x7, 0x55, 0x95, 0x4c, 0xc0, 0x3a, 0x0, 0xa,
+    0x0, 0xa0, 0x29, 0xa0, 0xa, 0x0, 0xa, 0x0,
+    0xa0, 0x90, 0xa0, 0xa, 0x0, 0xa, 0x55, 0xa7,
+    0x20, 0xa0, 0x1b, 0x0, 0x6, 0x0, 0x51, 0x1a,
+    0xb1, 0x8c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8B58 "識" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x1,
+    0x70, 0x0, 0x83, 0x0, 0xb0, 0x0, 0x0, 0x84,
+    0x25, 0x89, 0x83, 0xa6, 0x30, 0x16, 0x55, 0x35,
+    0x10, 0xa1, 0xa0, 0xa0, 0x3, 0x48, 0x2, 0xa2,
+    0x80, 0xa0, 0x0, 0x1, 0x0, 0x45, 0x79, 0x55,
+    0xc5, 0xb0, 0x4, 0x59, 0x23, 0x0, 0x30, 0xa0,
+    0x70, 0x1, 0x0, 0xb, 0x55, 0xc0, 0xa4, 0x90,
+    0x8, 0x5a, 0x3a, 0x0, 0xa0, 0x9b, 0x20, 0xa,
+    0x9, 0xa, 0x55, 0xa0, 0x6b, 0x0, 0xa, 0x9,
+    0x1a, 0x0, 0xa0, 0xba, 0x4, 0xb, 0x5b, 0x1b,
+    0x55, 0xa7, 0x48, 0xa3, 0x7, 0x6, 0x3, 0x0,
+    0x64, 0x0, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x10,
+    0x0, 0x0,
+
+    /* U+8B70 "議" */
+    0x0, 0x10, 0x0, 0x3, 0x0, 0x52, 0x0, 0x0,
+    0xa3, 0x0, 0x4, 0x90, 0xb2, 0x0, 0x25, 0x98,
+    0x93, 0x65, 0x98, 0x68, 0x70, 0x1, 0x0, 0x0,
+    0x1, 0x46, 0x15, 0x0, 0x5, 0x56, 0x60, 0x25,
+    0x78, 0x44, 0x0, 0x0, 0x0, 0x2, 0x65, 0x78,
+    0x56, 0xb0, 0x5, 0x56, 0x70, 0x3, 0x77, 0x25,
+    0x0, 0x0, 0x0, 0x1, 0x6c, 0x39, 0x6, 0x30,
+    0x9, 0x55, 0xc4, 0x5c, 0x5b, 0x65, 0xb2, 0xa,
+    0x0, 0xa0, 0xa, 0x26, 0x46, 0x20, 0xa, 0x0,
+    0xa5, 0x9d, 0x22, 0xc9, 0x0, 0xb, 0x55, 0xa3,
+    0xa, 0x5, 0xd4, 0x21, 0x6, 0x0, 0x51, 0x7c,
+    0x54, 0xa, 0xc1, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x31,
+
+    /* U+8B77 "護" */
+    0x0, 0x20, 0x0, 0x3, 0x10, 0x40, 0x0, 0x0,
+    0xa4, 0x0, 0x7, 0x40, 0xb0, 0x40, 0x25, 0x99,
+    0x87, 0x5a, 0x95, 0xc5, 0x52, 0x1, 0x0, 0x0,
+    0x66, 0x1b, 0x20, 0x10, 0x5, 0x55, 0x80, 0xd5,
+    0x5c, 0x57, 0x80, 0x0, 0x0, 0x6, 0xd4, 0x4c,
+    0x58, 0x20, 0x5, 0x55, 0x73, 0xa5, 0x5c, 0x58,
+    0x20, 0x0, 0x0, 0x0, 0xa1, 0x1a, 0x11, 0x80,
+    0xb, 0x55, 0xc0, 0x74, 0x44, 0x47, 0x41, 0xa,
+    0x0, 0xa1, 0x68, 0x55, 0x8d, 0x0, 0xa, 0x0,
+    0xa0, 0x3, 0x53, 0xa1, 0x0, 0xb, 0x55, 0xa0,
+    0x1, 0xbc, 0x10, 0x0, 0x3, 0x0, 0x33, 0x55,
+    0x1, 0x9a, 0x92,
+
+    /* U+8B8A "變" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x1, 0x0, 0x0,
+    0x85, 0x0, 0x44, 0x30, 0x2a, 0x0, 0x4, 0x77,
+    0x36, 0x55, 0x82, 0x85, 0x70, 0x9, 0x8a, 0x14,
+    0x66, 0x86, 0x9c, 0x30, 0x5, 0x96, 0x74, 0x33,
+    0x51, 0x96, 0x80, 0x4, 0x86, 0x96, 0x75, 0xb0,
+    0xa7, 0x82, 0x6, 0x44, 0x96, 0x75, 0x91, 0x57,
+    0x71, 0x6, 0x15, 0x53, 0x10, 0x35, 0x15, 0x22,
+    0x0, 0x3, 0xf6, 0x55, 0x56, 0x7a, 0x0, 0x0,
+    0x2a, 0x33, 0x0, 0x49, 0x0, 0x0, 0x0, 0x40,
+    0x4, 0x65, 0x90, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xbc, 0x40, 0x0, 0x0, 0x2, 0x46, 0x74, 0x0,
+    0x5a, 0xbb, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8B93 "讓" */
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x1,
+    0x80, 0x0, 0x0, 0x57, 0x0, 0x20, 0x0, 0x75,
+    0x34, 0x55, 0x57, 0x55, 0x91, 0x26, 0x55, 0x50,
+    0x84, 0x95, 0x54, 0x80, 0x5, 0x55, 0x50, 0xb5,
+    0xa6, 0x75, 0x90, 0x0, 0x0, 0x0, 0x34, 0x32,
+    0x50, 0x20, 0x4, 0x57, 0x53, 0x6a, 0x65, 0xc6,
+    0xa0, 0x0, 0x0, 0x0, 0x8, 0x10, 0x91, 0x40,
+    0x8, 0x55, 0x90, 0x6a, 0x65, 0xb5, 0x60, 0x9,
+    0x0, 0x95, 0x59, 0x96, 0x86, 0x92, 0x9, 0x0,
+    0x90, 0x1c, 0x27, 0x38, 0x30, 0xa, 0x55, 0x93,
+    0x8b, 0x3, 0xb3, 0x0, 0x5, 0x0, 0x23, 0xb,
+    0x70, 0x9, 0xc2, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0,
+
+    /* U+8BA1 "计" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x46, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0, 0xb,
+    0x40, 0x0, 0xb2, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb2, 0x0, 0x0, 0x16, 0x5c, 0x16, 0x55, 0xc6,
+    0x56, 0xb0, 0x0, 0xb, 0x0, 0x0, 0xb2, 0x0,
+    0x0, 0x0, 0xb, 0x0, 0x0, 0xb2, 0x0, 0x0,
+    0x0, 0xb, 0x0, 0x0, 0xb2, 0x0, 0x0, 0x0,
+    0xb, 0x3, 0x0, 0xb2, 0x0, 0x0, 0x0, 0xb,
+    0x82, 0x0, 0xb2, 0x0, 0x0, 0x0, 0x1f, 0x60,
+    0x0, 0xb2, 0x0, 0x0, 0x0, 0x6, 0x0, 0x0,
+    0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10,
+    0x0, 0x0,
+
+    /* U+8BDE "诞" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0x20, 0x0, 0x40, 0x0, 0x2a, 0x80, 0x0, 0xd0,
+    0x67, 0xd2, 0x68, 0xd3, 0x0, 0x0, 0x20, 0x7,
+    0x50, 0x0, 0xb0, 0x0, 0x0, 0x0, 0xb, 0x0,
+    0x50, 0xb0, 0x0, 0x26, 0xb2, 0x58, 0x30, 0xc0,
+    0xc6, 0xa0, 0x0, 0xb0, 0x56, 0xc3, 0xa0, 0xb0,
+    0x0, 0x0, 0xb0, 0x20, 0xb0, 0xa0, 0xb0, 0x0,
+    0x0, 0xb0, 0x34, 0xb0, 0xa0, 0xb0, 0x10, 0x0,
+    0xb0, 0x3c, 0x51, 0xc5, 0x85, 0x90, 0x0, 0xb9,
+    0x1b, 0x90, 0x0, 0x0, 0x0, 0x0, 0xa2, 0x81,
+    0x2b, 0x96, 0x43, 0x20, 0x0, 0x16, 0x10, 0x0,
+    0x37, 0xac, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8C50 "豐" */
+    0x0, 0x0, 0x30, 0x41, 0x2, 0x0, 0x0, 0x0,
+    0xb0, 0x93, 0xa1, 0xb, 0x1a, 0x0, 0x0, 0xa4,
+    0xc5, 0x93, 0x6b, 0x3a, 0x0, 0x0, 0xa4, 0xb7,
+    0x93, 0x6c, 0x5a, 0x0, 0x0, 0xa3, 0xb7, 0x93,
+    0x5b, 0x4a, 0x0, 0x1, 0xd5, 0xb5, 0xb5, 0x5b,
+    0x5a, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x6,
+    0x0, 0x2, 0x65, 0x55, 0x55, 0x55, 0x57, 0x30,
+    0x0, 0x7, 0x55, 0x55, 0x55, 0xa0, 0x0, 0x0,
+    0xa, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0xa,
+    0x65, 0x55, 0x56, 0xa0, 0x0, 0x0, 0x1, 0x47,
+    0x0, 0x68, 0x0, 0x0, 0x5, 0x55, 0x5a, 0x55,
+    0xa5, 0x57, 0xd1, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8C61 "象" */
+    0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5d, 0x10, 0x13, 0x0, 0x0, 0x0, 0x4b, 0x55,
+    0x5c, 0x80, 0x0, 0x0, 0x5d, 0x55, 0x58, 0x75,
+    0x58, 0x0, 0x42, 0xb0, 0x3, 0xa0, 0x2, 0xa0,
+    0x0, 0xd, 0x55, 0xa9, 0x55, 0x6a, 0x0, 0x0,
+    0x70, 0x3d, 0x10, 0x2, 0x70, 0x0, 0x0, 0x67,
+    0x3b, 0x6, 0x95, 0x0, 0x3, 0x62, 0x59, 0x79,
+    0x60, 0x0, 0x0, 0x2, 0x85, 0x2b, 0xb3, 0x60,
+    0x0, 0x4, 0x40, 0x59, 0xd, 0x9, 0x80, 0x0,
+    0x3, 0x84, 0x2, 0xc0, 0x8, 0xe4, 0x35, 0x30,
+    0x4b, 0xe4, 0x0, 0x1, 0x0, 0x0, 0x0, 0x12,
+    0x0, 0x0, 0x0,
+
+    /* U+8CA0 "負" */
+    0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6c, 0x10, 0x21, 0x0, 0x0, 0x3, 0xc5, 0x55,
+    0xd8, 0x0, 0x0, 0x3a, 0x10, 0x5, 0x60, 0x0,
+    0x5, 0x75, 0x22, 0x38, 0x23, 0x70, 0x1, 0x2b,
+    0x22, 0x22, 0x23, 0xb0, 0x0, 0x1c, 0x55, 0x55,
+    0x56, 0xa0, 0x0, 0x1a, 0x0, 0x0, 0x1, 0xa0,
+    0x0, 0x1c, 0x55, 0x55, 0x56, 0xa0, 0x0, 0x2a,
+    0x0, 0x0, 0x1, 0xa0, 0x0, 0x2a, 0x85, 0x55,
+    0x76, 0x90, 0x0, 0x4, 0xd4, 0x0, 0x4a, 0x60,
+    0x0, 0x77, 0x0, 0x0, 0x0, 0xb6, 0x2, 0x0,
+    0x0, 0x0, 0x0, 0x1,
+
+    /* U+8CA1 "財" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x7,
+    0x55, 0x59, 0x0, 0x0, 0xb2, 0x0, 0xb, 0x0,
+    0xb, 0x0, 0x0, 0xb0, 0x0, 0xb, 0x0, 0xb,
+    0x0, 0x0, 0xb0, 0x50, 0xb, 0x55, 0x5b, 0x35,
+    0x59, 0xf5, 0x50, 0xb, 0x0, 0xb, 0x0, 0xc,
+    0xc0, 0x0, 0xb, 0x55, 0x5b, 0x0, 0x49, 0xb0,
+    0x0, 0xb, 0x0, 0xb, 0x0, 0xb1, 0xb0, 0x0,
+    0xb, 0x0, 0xb, 0x7, 0x40, 0xb0, 0x0, 0xb,
+    0x55, 0x5a, 0x36, 0x0, 0xb0, 0x0, 0x1, 0x82,
+    0x52, 0x50, 0x0, 0xb0, 0x0, 0x4, 0x90, 0x1b,
+    0x0, 0x0, 0xb0, 0x0, 0x28, 0x0, 0x8, 0x10,
+    0x4a, 0xe0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x1,
+    0x30, 0x0,
+
+    /* U+8CA7 "貧" */
+    0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x98, 0x0, 0x61, 0x0, 0x0, 0x0, 0x85, 0x0,
+    0x0, 0x86, 0x0, 0x2, 0x73, 0x6a, 0x75, 0x5c,
+    0x9d, 0x80, 0x0, 0x6, 0x80, 0x0, 0xc0, 0x0,
+    0x0, 0x27, 0x40, 0x2, 0xa8, 0x0, 0x0, 0x12,
+    0x95, 0x55, 0x56, 0x5c, 0x0, 0x0, 0xb, 0x55,
+    0x55, 0x55, 0xb0, 0x0, 0x0, 0xb0, 0x0, 0x0,
+    0xb, 0x0, 0x0, 0xb, 0x55, 0x55, 0x55, 0xc0,
+    0x0, 0x0, 0xb5, 0x55, 0x55, 0x5b, 0x0, 0x0,
+    0x2, 0x5c, 0x0, 0x37, 0x82, 0x0, 0x4, 0x85,
+    0x0, 0x0, 0x2, 0xc3, 0x2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+8CA9 "販" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0x55, 0x59, 0x1, 0x25, 0x9c, 0x70, 0xb, 0x0,
+    0xb, 0xc, 0x31, 0x0, 0x0, 0xb, 0x11, 0x1b,
+    0xa, 0x0, 0x0, 0x0, 0xb, 0x33, 0x3b, 0xc,
+    0x55, 0x58, 0x10, 0xb, 0x0, 0xb, 0xa, 0x50,
+    0xc, 0x0, 0xb, 0x55, 0x5b, 0x19, 0x60, 0x29,
+    0x0, 0xb, 0x0, 0xb, 0x18, 0x43, 0x65, 0x0,
+    0xb, 0x0, 0xb, 0x46, 0x8, 0xb0, 0x0, 0xb,
+    0x55, 0x5b, 0x63, 0x9, 0x80, 0x0, 0x1, 0xb1,
+    0x91, 0x80, 0x1b, 0xa0, 0x0, 0x6, 0x60, 0x57,
+    0x60, 0x91, 0x5b, 0x10, 0x17, 0x0, 0x5, 0x25,
+    0x0, 0x7, 0xa0, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8CAC "責" */
+    0x0, 0x0, 0x1, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2b, 0x0, 0x7, 0x0, 0x6, 0x55, 0x56,
+    0xb5, 0x56, 0x52, 0x0, 0x6, 0x55, 0x6b, 0x55,
+    0x85, 0x0, 0x11, 0x11, 0x13, 0xa1, 0x11, 0x2a,
+    0x4, 0x47, 0x44, 0x44, 0x44, 0x75, 0x41, 0x0,
+    0xc5, 0x55, 0x55, 0x59, 0x60, 0x0, 0xc, 0x44,
+    0x44, 0x44, 0x95, 0x0, 0x0, 0xc5, 0x55, 0x55,
+    0x59, 0x50, 0x0, 0xc, 0x0, 0x0, 0x0, 0x75,
+    0x0, 0x0, 0xb5, 0x75, 0x55, 0x59, 0x40, 0x0,
+    0x0, 0x8c, 0x10, 0x48, 0x82, 0x0, 0x5, 0x94,
+    0x0, 0x0, 0x3, 0xd3, 0x2, 0x10, 0x0, 0x0,
+    0x0, 0x1, 0x0,
+
+    /* U+8CB7 "買" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x55,
+    0x85, 0x58, 0x55, 0xc0, 0xc, 0x0, 0xb0, 0xb,
+    0x1, 0xa0, 0xc, 0x0, 0xb0, 0xb, 0x1, 0xa0,
+    0x9, 0x55, 0x55, 0x55, 0x55, 0x70, 0x0, 0x95,
+    0x55, 0x55, 0x5c, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0xc5, 0x55, 0x55, 0x5c, 0x0,
+    0x0, 0xc5, 0x55, 0x55, 0x5c, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0xb5, 0x75, 0x55,
+    0x59, 0x0, 0x0, 0x1b, 0x90, 0x3, 0x78, 0x20,
+    0x6, 0x82, 0x0, 0x0, 0x3, 0xd0, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+8CB8 "貸" */
+    0x0, 0x0, 0x11, 0x1, 0x11, 0x0, 0x0, 0x0,
+    0xc, 0x60, 0xc0, 0xa5, 0x0, 0x0, 0x1c, 0x40,
+    0xa, 0x12, 0x39, 0x20, 0x48, 0x93, 0x55, 0x7a,
+    0x43, 0x32, 0x11, 0x8, 0x20, 0x0, 0x86, 0x0,
+    0x50, 0x0, 0x71, 0x0, 0x0, 0x7b, 0x78, 0x0,
+    0xb, 0x55, 0x55, 0x55, 0xd5, 0x50, 0x0, 0xc5,
+    0x55, 0x55, 0x5c, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0xc5, 0x55, 0x55, 0x5c,
+    0x0, 0x0, 0xc, 0x55, 0x55, 0x55, 0xc0, 0x0,
+    0x0, 0x19, 0xa0, 0x2, 0x78, 0x20, 0x0, 0x59,
+    0x30, 0x0, 0x0, 0x4d, 0x0, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+8CBB "費" */
+    0x0, 0x0, 0x20, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0xa1, 0xc, 0x3, 0x0, 0x4, 0x55, 0xc5, 0x5c,
+    0x5c, 0x20, 0x5, 0x95, 0xc5, 0x5c, 0x5a, 0x0,
+    0x9, 0x95, 0xc5, 0x5c, 0x55, 0x69, 0x0, 0x8,
+    0x20, 0xa, 0x3, 0x84, 0x14, 0x95, 0x44, 0x49,
+    0x48, 0x60, 0x0, 0xb1, 0x11, 0x11, 0x1c, 0x0,
+    0x0, 0xb5, 0x55, 0x55, 0x5b, 0x0, 0x0, 0xb5,
+    0x55, 0x55, 0x5b, 0x0, 0x0, 0xb5, 0x55, 0x55,
+    0x5b, 0x0, 0x0, 0x49, 0x50, 0x4, 0x78, 0x0,
+    0x5, 0x94, 0x0, 0x0, 0x5, 0xd1, 0x21, 0x0,
+    0x0, 0x0, 0x0, 0x20,
+
+    /* U+8CBF "貿" */
+    0x0, 0x0, 0x60, 0x0, 0x0, 0x0, 0x5, 0x58,
+    0x63, 0x55, 0x55, 0x93, 0xb, 0x1, 0x50, 0x1c,
+    0x0, 0xb0, 0xb, 0x0, 0xa5, 0x29, 0x0, 0xc0,
+    0xc, 0x87, 0x23, 0xa1, 0x58, 0x90, 0x5, 0x10,
+    0x16, 0x10, 0x7, 0x10, 0x0, 0x95, 0x55, 0x55,
+    0x5d, 0x10, 0x0, 0xb5, 0x55, 0x55, 0x5c, 0x0,
+    0x0, 0xb0, 0x0, 0x0, 0xc, 0x0, 0x0, 0xb5,
+    0x55, 0x55, 0x5d, 0x0, 0x0, 0xb5, 0x65, 0x55,
+    0x5c, 0x0, 0x0, 0x17, 0xc0, 0x2, 0x78, 0x10,
+    0x4, 0x84, 0x0, 0x0, 0x4, 0xd0, 0x21, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+8CC3 "賃" */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b,
+    0x23, 0x68, 0x9b, 0x70, 0x3, 0xc0, 0x11, 0x1b,
+    0x0, 0x0, 0x37, 0xb3, 0x65, 0x5c, 0x55, 0x86,
+    0x20, 0xb0, 0x0, 0xb, 0x0, 0x20, 0x0, 0x70,
+    0x36, 0x57, 0x57, 0x70, 0x0, 0x95, 0x55, 0x55,
+    0x5d, 0x0, 0x0, 0xb5, 0x55, 0x55, 0x5b, 0x0,
+    0x0, 0xb0, 0x0, 0x0, 0xb, 0x0, 0x0, 0xb5,
+    0x55, 0x55, 0x5c, 0x0, 0x0, 0xb5, 0x55, 0x55,
+    0x5b, 0x0, 0x0, 0x16, 0xb0, 0x2, 0x67, 0x10,
+    0x3, 0x95, 0x0, 0x0, 0x3, 0xd1, 0x11, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+8CC7 "資" */
+    0x0, 0x0, 0x4, 0x10, 0x0, 0x0, 0x8, 0x50,
+    0x1c, 0x10, 0x0, 0x10, 0x0, 0x46, 0x3a, 0x56,
+    0x57, 0xb0, 0x0, 0x80, 0x90, 0x3d, 0x5, 0x0,
+    0x3e, 0x12, 0x10, 0xb4, 0x70, 0x0, 0xc, 0x0,
+    0x9, 0x50, 0x6a, 0x41, 0xa, 0x34, 0x72, 0x11,
+    0x19, 0x94, 0x0, 0xc3, 0x33, 0x33, 0x3d, 0x0,
+    0x0, 0xc5, 0x55, 0x55, 0x5c, 0x0, 0x0, 0xc5,
+    0x55, 0x55, 0x5c, 0x0, 0x0, 0xc5, 0x55, 0x55,
+    0x5c, 0x0, 0x0, 0x3a, 0x80, 0x2, 0x78, 0x0,
+    0x5, 0x94, 0x0, 0x0, 0x5, 0xd0, 0x21, 0x0,
+    0x0, 0x0, 0x0, 0x10,
+
+    /* U+8CEA "質" */
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x20, 0x0, 0x7,
+    0x58, 0xa2, 0x66, 0x8a, 0x30, 0x0, 0xb0, 0x2,
+    0xc, 0x0, 0x3, 0x0, 0xc, 0x5b, 0x63, 0xd5,
+    0x97, 0x60, 0x4, 0x70, 0xb0, 0x37, 0x8, 0x30,
+    0x0, 0x90, 0xa, 0x19, 0x0, 0x83, 0x0, 0x40,
+    0x55, 0x68, 0x55, 0x5a, 0x10, 0x0, 0x8, 0x40,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x87, 0x55, 0x55,
+    0x5d, 0x0, 0x0, 0x8, 0x75, 0x55, 0x55, 0xd0,
+    0x0, 0x0, 0x87, 0x55, 0x55, 0x5d, 0x0, 0x0,
+    0x2, 0x3b, 0x10, 0x26, 0x60, 0x0, 0x1, 0x77,
+    0x10, 0x0, 0x6, 0xd0, 0x0, 0x30, 0x0, 0x0,
+    0x0, 0x2, 0x0,
+
+    /* U+8CFD "賽" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x10, 0x0, 0x39, 0x0, 0x1, 0x0, 0x0, 0xa5,
+    0x59, 0x55, 0x85, 0x5b, 0x40, 0x1, 0x56, 0x5c,
+    0x55, 0xc5, 0x85, 0x0, 0x0, 0x5, 0x5c, 0x55,
+    0xc5, 0x71, 0x0, 0x1, 0x56, 0x5c, 0x55, 0xc5,
+    0x59, 0x30, 0x0, 0x10, 0x95, 0x0, 0x25, 0x0,
+    0x0, 0x0, 0x19, 0xd5, 0x55, 0x5d, 0xb3, 0x0,
+    0x4, 0x50, 0xc5, 0x55, 0x5b, 0x2a, 0xc1, 0x0,
+    0x0, 0xc3, 0x33, 0x3b, 0x10, 0x0, 0x0, 0x0,
+    0xc1, 0x11, 0x1a, 0x10, 0x0, 0x0, 0x0, 0x9a,
+    0x55, 0xa9, 0x0, 0x0, 0x0, 0x2, 0x96, 0x10,
+    0x6, 0xc1, 0x0, 0x0, 0x23, 0x0, 0x0, 0x0,
+    0x21, 0x0,
+
+    /* U+8D39 "费" */
+    0x0, 0x0, 0x40, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x10, 0xd0, 0x1, 0x0, 0x6, 0x55, 0xc5,
+    0x5c, 0x56, 0xc0, 0x0, 0x75, 0x5c, 0x55, 0xc5,
+    0x69, 0x0, 0xc, 0x0, 0xb0, 0xb, 0x0, 0x34,
+    0x1, 0x75, 0xa8, 0x55, 0xd5, 0x57, 0xc0, 0x0,
+    0x66, 0x0, 0xb, 0x4, 0xc3, 0x3, 0x59, 0x55,
+    0x55, 0x55, 0xb2, 0x0, 0x0, 0xc0, 0x6, 0x50,
+    0x1a, 0x0, 0x0, 0xc, 0x0, 0x92, 0x1, 0xb0,
+    0x0, 0x0, 0xb0, 0xb, 0x21, 0x17, 0x0, 0x0,
+    0x0, 0xa, 0x30, 0x5b, 0x81, 0x0, 0x2, 0x67,
+    0x10, 0x0, 0x9, 0xa0, 0x3, 0x20, 0x0, 0x0,
+    0x0, 0x1, 0x0,
+
+    /* U+8D64 "赤" */
+    0x0, 0x0, 0x0, 0x21, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x67, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x65, 0x0, 0x52, 0x0, 0x0, 0x16, 0x55,
+    0x99, 0x55, 0x53, 0x0, 0x0, 0x0, 0x0, 0x65,
+    0x0, 0x0, 0x0, 0x4, 0x55, 0x55, 0x99, 0x55,
+    0x56, 0xc1, 0x0, 0x1, 0xa, 0x20, 0xc0, 0x0,
+    0x0, 0x0, 0xd, 0x3b, 0x0, 0xc1, 0x60, 0x0,
+    0x0, 0x57, 0xc, 0x0, 0xc0, 0x2b, 0x10, 0x1,
+    0x70, 0x39, 0x0, 0xc0, 0x7, 0xa0, 0x5, 0x0,
+    0x92, 0x0, 0xc0, 0x0, 0x60, 0x0, 0x6, 0x50,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0x63, 0x0, 0x5b,
+    0xe0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1, 0x20,
+    0x0, 0x0,
+
+    /* U+8D70 "走" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa1, 0x1, 0x70, 0x0, 0x0, 0x45, 0x55,
+    0xc6, 0x55, 0x50, 0x0, 0x0, 0x0, 0x0, 0xa1,
+    0x0, 0x0, 0x0, 0x16, 0x55, 0x55, 0xb6, 0x55,
+    0x5c, 0x50, 0x0, 0x1, 0x0, 0xa3, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0x30, 0xa1, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0x0, 0xa6, 0x55, 0xc4, 0x0, 0x0,
+    0x4b, 0x0, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x92,
+    0x81, 0xa1, 0x0, 0x0, 0x0, 0x2, 0x90, 0xa,
+    0xe6, 0x31, 0x11, 0x20, 0x8, 0x0, 0x0, 0x48,
+    0xbd, 0xff, 0x60, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8D77 "起" */
+    0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb0, 0x60, 0x65, 0x5b, 0x10, 0x2, 0x65, 0xc5,
+    0x50, 0x0, 0xb, 0x0, 0x0, 0x0, 0xb0, 0x0,
+    0x0, 0xb, 0x0, 0x6, 0x55, 0xc5, 0xa5, 0x95,
+    0x5c, 0x0, 0x0, 0x0, 0xb2, 0x0, 0xb0, 0x4,
+    0x0, 0x0, 0xc0, 0xb0, 0x0, 0xb0, 0x0, 0x10,
+    0x0, 0xc0, 0xb5, 0xb2, 0xb0, 0x0, 0x50, 0x3,
+    0xa0, 0xb0, 0x0, 0xb0, 0x0, 0xa0, 0x6, 0x75,
+    0xb0, 0x0, 0x89, 0x9a, 0x90, 0x8, 0x3, 0xc7,
+    0x42, 0x0, 0x0, 0x10, 0x23, 0x0, 0x3, 0x8b,
+    0xde, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8D85 "超" */
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0x30, 0x2, 0x22, 0x23, 0x40, 0x0, 0xa,
+    0x4, 0x4, 0xc5, 0x38, 0x60, 0x4, 0x5c, 0x56,
+    0x10, 0xd0, 0x8, 0x40, 0x0, 0xa, 0x0, 0x2,
+    0xa0, 0xa, 0x20, 0x5, 0x5c, 0x5a, 0x3a, 0x11,
+    0x9d, 0x0, 0x1, 0x8, 0x20, 0x63, 0x0, 0x3,
+    0x0, 0x3, 0x78, 0x20, 0xc, 0x55, 0x5d, 0x30,
+    0x5, 0x68, 0x68, 0x5c, 0x0, 0xb, 0x0, 0x6,
+    0x48, 0x20, 0xc, 0x0, 0xb, 0x0, 0x8, 0x5a,
+    0x20, 0xc, 0x55, 0x5d, 0x0, 0x8, 0x6, 0x84,
+    0x15, 0x0, 0x1, 0x0, 0x31, 0x0, 0x5, 0x9b,
+    0xcd, 0xde, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8D8A "越" */
+    0x0, 0x2, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0xb, 0x10, 0x0, 0xd, 0x33, 0x0, 0x1, 0x1b,
+    0x17, 0x10, 0xb, 0xc, 0x0, 0x4, 0x3c, 0x33,
+    0x17, 0x5d, 0x58, 0xa0, 0x0, 0xb, 0x0, 0xb,
+    0xb, 0x0, 0x0, 0x36, 0x5b, 0x58, 0x6b, 0xb,
+    0xa, 0x30, 0x1, 0x7, 0x40, 0xb, 0xa, 0x1c,
+    0x0, 0x4, 0xa7, 0x31, 0x1b, 0x7, 0xb4, 0x0,
+    0x6, 0x67, 0x76, 0x4c, 0x64, 0xd0, 0x50, 0x8,
+    0x47, 0x30, 0x1c, 0x1a, 0x96, 0x80, 0xa, 0x6a,
+    0x30, 0x1, 0x81, 0x9, 0xc0, 0x8, 0x7, 0xa4,
+    0x14, 0x0, 0x0, 0x30, 0x41, 0x0, 0x17, 0xbc,
+    0xcc, 0xdd, 0xa1, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x11, 0x0,
+
+    /* U+8DA3 "趣" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0xa,
+    0x16, 0xa5, 0xa7, 0x20, 0x0, 0x4, 0x5c, 0x73,
+    0xa0, 0xa2, 0x65, 0xb0, 0x0, 0xa, 0x0, 0xa5,
+    0xc0, 0x2, 0x80, 0x15, 0x5c, 0x5a, 0xa0, 0xa1,
+    0x45, 0x50, 0x1, 0x9, 0x10, 0xa0, 0xa0, 0x5b,
+    0x10, 0x5, 0x4a, 0x0, 0xa5, 0xc0, 0xd, 0x0,
+    0x8, 0x4a, 0x67, 0xa0, 0xa3, 0x68, 0x70, 0x9,
+    0x1a, 0x4, 0xc7, 0xc2, 0x60, 0xb0, 0x9, 0x6b,
+    0x3, 0x10, 0xa3, 0x0, 0x10, 0x7, 0x9, 0x72,
+    0x0, 0x60, 0x0, 0x0, 0x31, 0x0, 0x27, 0xbc,
+    0xcd, 0xde, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8DB3 "足" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x9, 0x55, 0x55, 0x55, 0xd0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0xa0, 0x0, 0x0, 0xa, 0x0,
+    0x0, 0x0, 0xa0, 0x0, 0x0, 0xa, 0x0, 0x0,
+    0x0, 0xa0, 0x0, 0x0, 0xa, 0x55, 0xc5, 0x55,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0x10, 0xc0, 0x0, 0x34, 0x0,
+    0x0, 0x2d, 0x0, 0xc5, 0x55, 0x55, 0x0, 0x0,
+    0x7a, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xc1,
+    0x70, 0xc0, 0x0, 0x0, 0x0, 0x5, 0x40, 0x19,
+    0xe3, 0x21, 0x1, 0x21, 0x16, 0x0, 0x0, 0x49,
+    0xce, 0xef, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8DDF "跟" */
+    0x4, 0x55, 0x59, 0x7, 0x55, 0x59, 0x0, 0x7,
+    0x40, 0xb, 0xb, 0x0, 0xc, 0x0, 0x7, 0x40,
+    0xa, 0xb, 0x0, 0xb, 0x0, 0x7, 0x40, 0xa,
+    0xd, 0x55, 0x5b, 0x0, 0x7, 0x7b, 0x57, 0xb,
+    0x0, 0xb, 0x0, 0x1, 0xa, 0x0, 0xc, 0x65,
+    0x5b, 0x0, 0xa, 0x2b, 0x59, 0x1b, 0x41, 0x6,
+    0x40, 0xa, 0xa, 0x0, 0xb, 0x16, 0x59, 0x20,
+    0xa, 0xa, 0x0, 0xb, 0x9, 0x40, 0x0, 0xa,
+    0xb, 0x55, 0x1b, 0x3, 0xb1, 0x0, 0x4d, 0xb7,
+    0x10, 0xd, 0x80, 0x3d, 0x91, 0x35, 0x0, 0x0,
+    0x8, 0x0, 0x1, 0x30,
+
+    /* U+8DEF "路" */
+    0x0, 0x0, 0x0, 0x1, 0x20, 0x0, 0x0, 0x3,
+    0x22, 0x25, 0x6, 0xa0, 0x0, 0x0, 0x8, 0x53,
+    0x4a, 0xa, 0x65, 0x5c, 0x0, 0x8, 0x20, 0x19,
+    0x1b, 0x0, 0x66, 0x0, 0x9, 0x20, 0x19, 0x61,
+    0x71, 0xa0, 0x0, 0x8, 0x6b, 0x66, 0x50, 0x4e,
+    0x20, 0x0, 0x0, 0xa, 0x0, 0x0, 0xa9, 0xb2,
+    0x0, 0xa, 0x2b, 0x68, 0x9, 0x30, 0x3d, 0xb1,
+    0xa, 0xa, 0x3, 0x6c, 0x55, 0x5c, 0x20, 0xa,
+    0xa, 0x0, 0xb, 0x0, 0xb, 0x0, 0xa, 0xc,
+    0x64, 0xb, 0x0, 0xb, 0x0, 0x3d, 0x94, 0x0,
+    0xc, 0x55, 0x5b, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8EAB "身" */
+    0x0, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x93, 0x0, 0x0, 0x0, 0x0, 0xa, 0x58,
+    0x55, 0x5d, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0xc0, 0x0, 0x0, 0xd, 0x55, 0x55, 0x5c, 0x3,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0xc5, 0xc0, 0x0,
+    0xd, 0x55, 0x55, 0x5e, 0xb0, 0x0, 0x0, 0xc0,
+    0x0, 0x4, 0xe1, 0x0, 0x36, 0x57, 0x55, 0x58,
+    0xbc, 0x0, 0x0, 0x0, 0x0, 0x6, 0x90, 0xc0,
+    0x0, 0x0, 0x0, 0x19, 0x50, 0xc, 0x0, 0x0,
+    0x0, 0x67, 0x10, 0x0, 0xc0, 0x0, 0x24, 0x50,
+    0x0, 0x5, 0xca, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x0, 0x0,
+
+    /* U+8ECA "車" */
+    0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x0, 0x2,
+    0x65, 0x55, 0x5c, 0x55, 0x56, 0xb1, 0x0, 0x0,
+    0x0, 0x0, 0xa0, 0x0, 0x20, 0x0, 0x0, 0x1b,
+    0x55, 0x5c, 0x55, 0x5e, 0x10, 0x0, 0x1, 0x90,
+    0x0, 0xa0, 0x0, 0xb0, 0x0, 0x0, 0x1b, 0x55,
+    0x5c, 0x55, 0x5b, 0x0, 0x0, 0x1, 0x90, 0x0,
+    0xa0, 0x0, 0xb0, 0x0, 0x0, 0x1b, 0x55, 0x5c,
+    0x55, 0x5c, 0x0, 0x0, 0x0, 0x10, 0x0, 0xa0,
+    0x0, 0x2, 0x20, 0x6, 0x55, 0x55, 0x5c, 0x55,
+    0x55, 0x88, 0x0, 0x0, 0x0, 0x0, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0,
+    0x0,
+
+    /* U+8EDF "軟" */
+    0x0, 0x3, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0xb, 0x20, 0x0, 0xc3, 0x0, 0x0, 0x6, 0x5c,
+    0x59, 0x50, 0xb0, 0x0, 0x0, 0x0, 0xa, 0x0,
+    0x5, 0x95, 0x57, 0x90, 0xa, 0x5c, 0x5c, 0x29,
+    0x45, 0x7, 0x30, 0xb, 0xa, 0xa, 0x33, 0x48,
+    0x2, 0x0, 0xb, 0x5c, 0x5b, 0x10, 0x5a, 0x0,
+    0x0, 0xb, 0xa, 0xa, 0x0, 0x7a, 0x0, 0x0,
+    0xb, 0x5c, 0x5b, 0x0, 0xa6, 0x20, 0x0, 0x2,
+    0xa, 0x1, 0x41, 0xb1, 0x90, 0x0, 0x36, 0x5c,
+    0x55, 0x58, 0x30, 0xa3, 0x0, 0x0, 0xa, 0x0,
+    0x55, 0x0, 0x2d, 0x30, 0x0, 0xb, 0x4, 0x40,
+    0x0, 0x4, 0xa1, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8EE2 "転" */
+    0x0, 0x4, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x6, 0x5c,
+    0x5a, 0x45, 0x65, 0x5b, 0x10, 0x0, 0xa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0x5c, 0x5c, 0x10,
+    0x0, 0x0, 0x0, 0xb, 0xa, 0xa, 0x0, 0x0,
+    0x0, 0x40, 0xb, 0x5c, 0x5b, 0x46, 0x59, 0x56,
+    0x70, 0xb, 0xa, 0xa, 0x0, 0x4a, 0x0, 0x0,
+    0xb, 0x5c, 0x5b, 0x0, 0xa1, 0x0, 0x0, 0x2,
+    0xa, 0x4, 0x12, 0x70, 0x31, 0x0, 0x36, 0x5c,
+    0x55, 0x38, 0x0, 0xa, 0x20, 0x0, 0xa, 0x0,
+    0x7b, 0x97, 0x67, 0xa0, 0x0, 0xb, 0x0, 0x23,
+    0x0, 0x0, 0x50, 0x0, 0x4, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8EFD "軽" */
+    0x0, 0x4, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x10, 0x36, 0x55, 0x5b, 0x40, 0x6, 0x5c,
+    0x5a, 0x24, 0x0, 0x2a, 0x0, 0x0, 0xa, 0x0,
+    0x0, 0x70, 0xa1, 0x0, 0xa, 0x5c, 0x5d, 0x10,
+    0x5b, 0x30, 0x0, 0xb, 0xa, 0xa, 0x0, 0x89,
+    0x91, 0x0, 0xb, 0x5c, 0x5b, 0x27, 0x22, 0x4d,
+    0xa1, 0xb, 0xa, 0xb, 0x30, 0xd, 0x10, 0x10,
+    0xb, 0x5c, 0x5b, 0x0, 0xb, 0x5, 0x20, 0x3,
+    0xa, 0x2, 0x46, 0x5c, 0x55, 0x30, 0x26, 0x5c,
+    0x55, 0x40, 0xb, 0x0, 0x0, 0x0, 0xa, 0x0,
+    0x0, 0xb, 0x0, 0x30, 0x0, 0xb, 0x1, 0x65,
+    0x57, 0x56, 0x81, 0x0, 0x4, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8F03 "較" */
+    0x0, 0x4, 0x10, 0x0, 0x11, 0x0, 0x0, 0x0,
+    0xb, 0x10, 0x0, 0xb, 0x30, 0x0, 0x6, 0x5c,
+    0x5b, 0x20, 0x3, 0x20, 0x30, 0x0, 0xa, 0x0,
+    0x26, 0x75, 0x56, 0x70, 0xa, 0x5c, 0x5c, 0x20,
+    0xc3, 0x26, 0x0, 0xb, 0xa, 0xa, 0x6, 0x50,
+    0x3, 0xc0, 0xb, 0x5c, 0x5b, 0x37, 0x20, 0x26,
+    0x62, 0xb, 0xa, 0xa, 0x40, 0x60, 0x69, 0x0,
+    0xb, 0x5c, 0x5b, 0x0, 0x71, 0xb1, 0x0, 0x2,
+    0xa, 0x3, 0x20, 0x1c, 0x80, 0x0, 0x26, 0x5c,
+    0x56, 0x40, 0x2c, 0x80, 0x0, 0x0, 0xa, 0x0,
+    0x4, 0x80, 0x8b, 0x30, 0x0, 0xb, 0x1, 0x64,
+    0x0, 0x5, 0xa2, 0x0, 0x4, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8F09 "載" */
+    0x0, 0x0, 0x41, 0x0, 0x4, 0x0, 0x0, 0x0,
+    0x0, 0xa1, 0x51, 0xd, 0x73, 0x0, 0x0, 0x65,
+    0xc5, 0x53, 0xb, 0x19, 0x0, 0x6, 0x55, 0xb5,
+    0x55, 0x5c, 0x55, 0xb3, 0x0, 0x0, 0x92, 0x21,
+    0xb, 0x0, 0x0, 0x2, 0x65, 0xc5, 0x66, 0xb,
+    0x2, 0x30, 0x0, 0x95, 0xc5, 0xa5, 0xb, 0x7,
+    0x70, 0x0, 0xb0, 0xa0, 0x91, 0xb, 0xb, 0x0,
+    0x0, 0xc5, 0xc5, 0xb1, 0x9, 0x68, 0x0, 0x0,
+    0xd5, 0xc5, 0xb1, 0x5, 0xe1, 0x0, 0x0, 0x20,
+    0xa0, 0x26, 0x9, 0xd0, 0x3, 0x5, 0x55, 0xc5,
+    0x55, 0xa6, 0x59, 0x15, 0x0, 0x0, 0xa0, 0x38,
+    0x20, 0x7, 0xd5, 0x0, 0x0, 0x40, 0x20, 0x0,
+    0x0, 0x34,
+
+    /* U+8F15 "輕" */
+    0x0, 0x4, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x10, 0x12, 0x22, 0x25, 0x60, 0x16, 0x5c,
+    0x5a, 0x36, 0x45, 0x45, 0x40, 0x0, 0xa, 0x0,
+    0x9, 0x3a, 0x3a, 0x30, 0xa, 0x5c, 0x5c, 0x37,
+    0x34, 0x25, 0x0, 0xb, 0xa, 0xa, 0x35, 0x36,
+    0x18, 0x0, 0xb, 0x5c, 0x5b, 0xa, 0x3a, 0x37,
+    0x60, 0xb, 0xa, 0xa, 0x3, 0x43, 0x12, 0x20,
+    0xb, 0x5c, 0x5b, 0x6, 0x58, 0x59, 0x50, 0x3,
+    0xa, 0x1, 0x30, 0xb, 0x0, 0x0, 0x36, 0x5c,
+    0x55, 0x50, 0xb, 0x0, 0x0, 0x0, 0xa, 0x0,
+    0x0, 0xb, 0x0, 0x0, 0x0, 0xb, 0x0, 0x55,
+    0x5c, 0x55, 0xd2, 0x0, 0x8, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+8F2A "輪" */
+    0x0, 0x5, 0x0, 0x0, 0x5, 0x0, 0x0, 0x0,
+    0xb, 0x0, 0x0, 0x2d, 0x0, 0x0, 0x6, 0x5c,
+    0x5a, 0x0, 0x95, 0x50, 0x0, 0x0, 0xa, 0x0,
+    0x2, 0xa0, 0x84, 0x0, 0xb, 0x5c, 0x5d, 0x19,
+    0x0, 0x3d, 0xa2, 0xb, 0xa, 0xb, 0x62, 0x65,
+    0x53, 0x40, 0xb, 0x4c, 0x4a, 0x45, 0x55, 0x55,
+    0x80, 0xb, 0xa, 0xa, 0x64, 0x90, 0x90, 0xa0,
+    0xb, 0x5c, 0x5a, 0x64, 0x90, 0x90, 0xa0, 0x2,
+    0xa, 0x5, 0x68, 0xb5, 0xb5, 0xa0, 0x26, 0x5c,
+    0x55, 0x74, 0x90, 0x90, 0xa0, 0x0, 0xa, 0x0,
+    0x64, 0x90, 0x90, 0xa0, 0x0, 0xb, 0x0, 0x64,
+    0x60, 0x67, 0x90, 0x0, 0x4, 0x0, 0x10, 0x0,
+    0x1, 0x0,
+
+    /* U+8F38 "輸" */
+    0x0, 0x1, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0,
+    0xc, 0x10, 0x0, 0x6c, 0x0, 0x0, 0x6, 0x5c,
+    0x5a, 0x0, 0xd4, 0x40, 0x0, 0x0, 0xa, 0x0,
+    0x6, 0x80, 0x84, 0x0, 0x9, 0x5c, 0x5c, 0x39,
+    0x65, 0x8c, 0xa2, 0xb, 0xa, 0xb, 0x60, 0x1,
+    0x4, 0x50, 0xb, 0x5c, 0x5a, 0x68, 0x69, 0x39,
+    0x20, 0xb, 0xa, 0xa, 0x65, 0x29, 0xa8, 0x10,
+    0xc, 0x5c, 0x5a, 0x68, 0x59, 0x98, 0x10, 0x2,
+    0xa, 0x6, 0x67, 0x49, 0x98, 0x10, 0x26, 0x5c,
+    0x55, 0x76, 0x39, 0xa8, 0x10, 0x0, 0xa, 0x0,
+    0x65, 0x18, 0x18, 0x10, 0x0, 0xc, 0x0, 0x66,
+    0xa7, 0x6d, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8F9B "辛" */
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb3, 0x0, 0x71, 0x0, 0x6, 0x57, 0x55, 0x58,
+    0x65, 0x30, 0x0, 0x0, 0x75, 0x0, 0xa6, 0x0,
+    0x0, 0x0, 0x2, 0xd0, 0x9, 0x0, 0x0, 0x6,
+    0x55, 0x57, 0x68, 0x65, 0x5c, 0x60, 0x0, 0x0,
+    0xa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa2,
+    0x0, 0x30, 0x0, 0x6, 0x55, 0x5c, 0x75, 0x5b,
+    0x30, 0x0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x0,
+
+    /* U+8F9E "辞" */
+    0x0, 0x0, 0x0, 0x0, 0x31, 0x0, 0x0, 0x0,
+    0x0, 0x6c, 0x0, 0x1b, 0x0, 0x0, 0x3, 0x6a,
+    0x93, 0x36, 0x57, 0x56, 0x90, 0x0, 0x4, 0x70,
+    0x2, 0x0, 0x15, 0x0, 0x0, 0x4, 0x72, 0x46,
+    0x50, 0x5b, 0x0, 0x5, 0x57, 0x95, 0x41, 0xa0,
+    0x91, 0x0, 0x0, 0x4, 0x70, 0x45, 0x45, 0x84,
+    0x92, 0x1, 0x77, 0x98, 0x20, 0xb, 0x0, 0x0,
+    0x1, 0xb0, 0xb, 0x0, 0xb, 0x0, 0x0, 0x1,
+    0xb0, 0xb, 0x26, 0x5c, 0x57, 0x70, 0x1, 0xb0,
+    0xb, 0x0, 0xb, 0x0, 0x0, 0x1, 0xc5, 0x5c,
+    0x0, 0xb, 0x0, 0x0, 0x1, 0x80, 0x3, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0x0, 0x0,
+
+    /* U+8FA6 "辦" */
+    0x0, 0x0, 0x0, 0x10, 0x2, 0x0, 0x0, 0x0,
+    0xa1, 0x0, 0xc0, 0x1, 0xc0, 0x0, 0x3, 0x97,
+    0x40, 0xa0, 0x13, 0x75, 0x40, 0x4, 0x26, 0x35,
+    0xc9, 0x53, 0x25, 0x20, 0x7, 0x2a, 0x20, 0xa7,
+    0x29, 0xb, 0x20, 0x3, 0x57, 0x11, 0x97, 0x17,
+    0x37, 0x0, 0x36, 0xa6, 0x83, 0x78, 0x55, 0x96,
+    0xa0, 0x0, 0xa0, 0x5, 0x49, 0x0, 0xa0, 0x0,
+    0x3, 0xb6, 0x49, 0xa, 0x0, 0xa1, 0x20, 0x3,
+    0xa1, 0x29, 0xa, 0x26, 0xc6, 0x50, 0x0, 0x90,
+    0x81, 0xa, 0x0, 0xa0, 0x0, 0x6, 0x34, 0x43,
+    0xb7, 0x0, 0xa0, 0x0, 0x25, 0x24, 0x0, 0x20,
+    0x0, 0xb0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x30, 0x0,
+
+    /* U+8FB2 "農" */
+    0x0, 0x0, 0x16, 0x0, 0x60, 0x0, 0x0, 0x5,
+    0x56, 0xc5, 0x5d, 0x58, 0x20, 0x0, 0x92, 0x1a,
+    0x0, 0xb0, 0xa1, 0x0, 0x9, 0x66, 0xc5, 0x5c,
+    0x5c, 0x0, 0x0, 0x92, 0x1a, 0x0, 0xb0, 0xa1,
+    0x0, 0x7, 0x55, 0x65, 0x56, 0x59, 0x10, 0x0,
+    0x85, 0x55, 0x55, 0x55, 0x87, 0x0, 0x9, 0x33,
+    0x33, 0x33, 0x62, 0x0, 0x0, 0x93, 0x21, 0x11,
+    0x11, 0x15, 0x0, 0xb, 0x5b, 0x57, 0x65, 0x58,
+    0x61, 0x0, 0xb0, 0xa0, 0x7, 0x18, 0x70, 0x0,
+    0x55, 0xa, 0x1, 0x3a, 0xa0, 0x0, 0x17, 0x0,
+    0xda, 0x60, 0x6, 0xdb, 0x52, 0x0, 0x2, 0x0,
+    0x0, 0x0, 0x30,
+
+    /* U+8FBA "辺" */
+    0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x86, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1e,
+    0x6, 0x57, 0x75, 0x5c, 0x60, 0x0, 0x0, 0x0,
+    0x8, 0x30, 0xa, 0x10, 0x0, 0x6, 0x0, 0xa,
+    0x10, 0xa, 0x0, 0x6, 0x5d, 0x0, 0xc, 0x0,
+    0xb, 0x0, 0x0, 0xa, 0x0, 0x1a, 0x0, 0xb,
+    0x0, 0x0, 0xa, 0x0, 0x74, 0x0, 0xc, 0x0,
+    0x0, 0xa, 0x0, 0xa0, 0x0, 0xb, 0x0, 0x0,
+    0xa, 0x7, 0x20, 0x0, 0x58, 0x0, 0x0, 0x7c,
+    0x32, 0x0, 0x19, 0xe2, 0x0, 0x1d, 0x51, 0xa4,
+    0x0, 0x0, 0x10, 0x0, 0x2, 0x0, 0x6, 0xbc,
+    0xdd, 0xde, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8FBC "込" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x92, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x3d,
+    0x0, 0x3, 0x20, 0x0, 0x0, 0x0, 0x4, 0x0,
+    0x0, 0x60, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0,
+    0xd0, 0x0, 0x0, 0x6, 0x5e, 0x10, 0x5, 0x94,
+    0x0, 0x0, 0x0, 0xb, 0x0, 0xb, 0x9, 0x0,
+    0x0, 0x0, 0xb, 0x0, 0x55, 0x7, 0x30, 0x0,
+    0x0, 0xb, 0x1, 0x80, 0x0, 0xc1, 0x0, 0x0,
+    0xb, 0x17, 0x0, 0x0, 0x5c, 0x20, 0x0, 0x6c,
+    0x40, 0x0, 0x0, 0x8, 0xb1, 0xc, 0x61, 0x94,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x5, 0xbc,
+    0xcc, 0xdd, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8FCE "迎" */
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x70, 0x0, 0x7, 0xb1, 0x0, 0x0, 0x0, 0x78,
+    0xa, 0x41, 0x8, 0x55, 0xa0, 0x0, 0x13, 0xb,
+    0x0, 0xb, 0x0, 0xb0, 0x0, 0x0, 0xb, 0x0,
+    0xb, 0x0, 0xb0, 0x6, 0x6c, 0xb, 0x0, 0xb,
+    0x0, 0xb0, 0x0, 0xa, 0xb, 0x0, 0xb, 0x0,
+    0xb0, 0x0, 0xa, 0xb, 0x4, 0x2b, 0x0, 0xb0,
+    0x0, 0xa, 0xc, 0xb3, 0xb, 0x26, 0xa0, 0x0,
+    0xa, 0x5, 0x10, 0xb, 0x5, 0x30, 0x1, 0x89,
+    0x20, 0x0, 0xb, 0x0, 0x0, 0x1d, 0x20, 0x68,
+    0x42, 0x14, 0x11, 0x23, 0x0, 0x0, 0x1, 0x69,
+    0xbc, 0xcd, 0xc1,
+
+    /* U+8FD1 "近" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x70, 0x0, 0x10, 0x14, 0x8d, 0x20, 0x0, 0x59,
+    0x0, 0xb5, 0x53, 0x10, 0x0, 0x0, 0x2, 0x0,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0xb0,
+    0x0, 0x0, 0x40, 0x7, 0x6d, 0x0, 0xb5, 0x55,
+    0xb5, 0x62, 0x0, 0xa, 0x0, 0xb0, 0x0, 0xb0,
+    0x0, 0x0, 0xa, 0x0, 0xa0, 0x0, 0xb0, 0x0,
+    0x0, 0xa, 0x4, 0x60, 0x0, 0xb0, 0x0, 0x0,
+    0xa, 0x8, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x3b,
+    0x21, 0x0, 0x0, 0xc0, 0x0, 0x6, 0x80, 0x74,
+    0x0, 0x0, 0x40, 0x0, 0x9, 0x0, 0x5, 0xbc,
+    0xdd, 0xdd, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8FD4 "返" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x62, 0x1, 0x1, 0x37, 0xca, 0x0, 0x0, 0x1d,
+    0x3, 0xb4, 0x31, 0x0, 0x0, 0x0, 0x5, 0x3,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xb5,
+    0x55, 0x69, 0x0, 0x7, 0x5c, 0x4, 0x80, 0x0,
+    0x67, 0x0, 0x0, 0xb, 0x5, 0x74, 0x0, 0xc0,
+    0x0, 0x0, 0xb, 0x6, 0x30, 0x89, 0x60, 0x0,
+    0x0, 0xb, 0x9, 0x0, 0x2c, 0xb1, 0x0, 0x0,
+    0xb, 0x26, 0x2, 0xa1, 0x3d, 0x10, 0x0, 0xb,
+    0x40, 0x47, 0x0, 0x5, 0x30, 0x4, 0x83, 0x75,
+    0x10, 0x0, 0x0, 0x0, 0x9, 0x0, 0x6, 0xbc,
+    0xdd, 0xde, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+8FEB "迫" */
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x40, 0x0, 0x0, 0xd2, 0x0, 0x0, 0x0, 0x87,
+    0x0, 0x1, 0x80, 0x0, 0x0, 0x0, 0x2b, 0x0,
+    0xa7, 0x65, 0x5d, 0x0, 0x0, 0x0, 0x0, 0xc0,
+    0x0, 0x1b, 0x0, 0x5, 0x5a, 0x0, 0xc0, 0x0,
+    0x1b, 0x0, 0x1, 0xc, 0x0, 0xd5, 0x55, 0x5b,
+    0x0, 0x0, 0xc, 0x0, 0xc0, 0x0, 0x1b, 0x0,
+    0x0, 0xc, 0x0, 0xc0, 0x0, 0x1b, 0x0, 0x0,
+    0xc, 0x0, 0xd5, 0x55, 0x5b, 0x0, 0x0, 0x7d,
+    0x10, 0xc0, 0x0, 0x9, 0x0, 0xc, 0x60, 0x86,
+    0x31, 0x0, 0x1, 0x22, 0x3, 0x0, 0x3, 0x8b,
+    0xcd, 0xee, 0xc1,
+
+    /* U+8FFD "追" */
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x0, 0x79,
+    0x0, 0x75, 0x95, 0x59, 0x0, 0x0, 0x17, 0x0,
+    0xb0, 0x0, 0x1a, 0x0, 0x0, 0x0, 0x0, 0xb0,
+    0x0, 0x1a, 0x0, 0x6, 0x5b, 0x0, 0xc5, 0x55,
+    0x6a, 0x0, 0x0, 0xb, 0x0, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0x0, 0xc5, 0x55, 0x5b, 0x50,
+    0x0, 0xb, 0x0, 0xb0, 0x0, 0x9, 0x20, 0x0,
+    0xb, 0x0, 0xb0, 0x0, 0x9, 0x20, 0x0, 0x6c,
+    0x10, 0xd5, 0x55, 0x5b, 0x20, 0xb, 0x60, 0x85,
+    0x40, 0x0, 0x1, 0x0, 0x4, 0x0, 0x5, 0xac,
+    0xcc, 0xdd, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x11, 0x10,
+
+    /* U+9000 "退" */
+    0x0, 0x60, 0x0, 0x20, 0x0, 0x5, 0x0, 0x0,
+    0x6a, 0x0, 0xd5, 0x55, 0x5d, 0x0, 0x0, 0x6,
+    0x0, 0xc0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0,
+    0xd5, 0x55, 0x5c, 0x0, 0x5, 0x5b, 0x0, 0xc0,
+    0x0, 0xc, 0x0, 0x0, 0xc, 0x0, 0xd5, 0x55,
+    0x58, 0x30, 0x0, 0xc, 0x0, 0xc1, 0x40, 0x2a,
+    0x40, 0x0, 0xc, 0x0, 0xc0, 0x18, 0xa0, 0x0,
+    0x0, 0xc, 0x0, 0xc2, 0x62, 0x5d, 0x30, 0x0,
+    0x6b, 0x21, 0xf7, 0x0, 0x4, 0x80, 0xc, 0x40,
+    0x67, 0x50, 0x0, 0x0, 0x12, 0x1, 0x0, 0x3,
+    0x9b, 0xde, 0xef, 0xe2,
+
+    /* U+9001 "送" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0,
+    0x70, 0x0, 0x81, 0x1, 0xd0, 0x0, 0x0, 0x88,
+    0x0, 0x4a, 0x7, 0x30, 0x0, 0x0, 0x13, 0x3,
+    0x57, 0x59, 0x5b, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0x0, 0x7, 0x6b, 0x0, 0x0, 0xc0,
+    0x0, 0x40, 0x0, 0x19, 0x26, 0x55, 0xd5, 0x56,
+    0x80, 0x0, 0x19, 0x0, 0x2, 0xb0, 0x0, 0x0,
+    0x0, 0x19, 0x0, 0x9, 0x69, 0x40, 0x0, 0x0,
+    0x19, 0x0, 0x48, 0x0, 0xa9, 0x0, 0x0, 0x5c,
+    0x4, 0x60, 0x0, 0xc, 0x0, 0xa, 0x61, 0xa6,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0x0, 0x7, 0xbb,
+    0xcc, 0xde, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9003 "逃" */
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0xb, 0x2c, 0x20, 0x0, 0x0, 0x59,
+    0x11, 0xb, 0xb, 0x5, 0x40, 0x0, 0x6, 0xb,
+    0xb, 0xb, 0x39, 0x10, 0x0, 0x0, 0x8, 0x2b,
+    0xb, 0x40, 0x0, 0x6, 0x5c, 0x0, 0xb, 0xb,
+    0x10, 0x0, 0x0, 0xa, 0x1, 0x7d, 0xb, 0x6b,
+    0x10, 0x0, 0xa, 0x5a, 0xc, 0xb, 0x5, 0x60,
+    0x0, 0xa, 0x0, 0x38, 0xb, 0x0, 0x50, 0x0,
+    0xa, 0x0, 0x91, 0xb, 0x20, 0xa1, 0x0, 0x6b,
+    0x15, 0x10, 0x4, 0x99, 0x80, 0xb, 0x60, 0x84,
+    0x0, 0x0, 0x0, 0x11, 0x3, 0x0, 0x5, 0xac,
+    0xde, 0xef, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+900F "透" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x1,
+    0x30, 0x0, 0x14, 0x79, 0xb4, 0x0, 0x0, 0xa4,
+    0x1, 0x31, 0xa0, 0x0, 0x20, 0x0, 0x32, 0x36,
+    0x58, 0xd6, 0x56, 0xa0, 0x0, 0x0, 0x0, 0x2a,
+    0xa4, 0x50, 0x0, 0x4, 0x59, 0x3, 0x70, 0xa0,
+    0x5b, 0x61, 0x2, 0x1a, 0x46, 0x67, 0x85, 0x92,
+    0x60, 0x0, 0xa, 0x0, 0xb, 0x4, 0x72, 0x0,
+    0x0, 0xa, 0x0, 0x19, 0x6, 0x5d, 0x0, 0x0,
+    0xa, 0x0, 0x72, 0x0, 0x1a, 0x0, 0x0, 0x3b,
+    0x3, 0x50, 0x16, 0x96, 0x0, 0x9, 0x71, 0x84,
+    0x0, 0x3, 0x80, 0x0, 0x6, 0x0, 0x7, 0xab,
+    0xcc, 0xcd, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0,
+
+    /* U+9010 "逐" */
+    0x0, 0x82, 0x0, 0x0, 0x0, 0x2, 0x60, 0x0,
+    0x3c, 0x6, 0x55, 0xd5, 0x55, 0x50, 0x0, 0x3,
+    0x0, 0x9, 0x40, 0x4, 0x10, 0x0, 0x0, 0x1,
+    0x71, 0x90, 0x3a, 0x20, 0x6, 0x5c, 0x3, 0x5,
+    0xaa, 0x50, 0x0, 0x0, 0xb, 0x0, 0x65, 0xc,
+    0x0, 0x0, 0x0, 0xb, 0x15, 0x20, 0xad, 0x76,
+    0x0, 0x0, 0xb, 0x0, 0x9, 0x4a, 0x19, 0x80,
+    0x0, 0xb, 0x3, 0x81, 0xc, 0x0, 0xb0, 0x0,
+    0x4c, 0x23, 0x5, 0x7c, 0x0, 0x0, 0xa, 0x50,
+    0x94, 0x0, 0x72, 0x0, 0x0, 0x4, 0x0, 0x6,
+    0xbc, 0xcc, 0xcd, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x11, 0x0,
+
+    /* U+9019 "這" */
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x92, 0x0, 0x0, 0xb2, 0x0, 0x0, 0x0, 0x3c,
+    0x0, 0x0, 0x42, 0x4, 0x30, 0x0, 0x1, 0x6,
+    0x55, 0x55, 0x55, 0x40, 0x0, 0x1, 0x0, 0x55,
+    0x55, 0x79, 0x0, 0x6, 0x7d, 0x0, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x19, 0x0, 0x65, 0x55, 0x77,
+    0x0, 0x0, 0x19, 0x0, 0x20, 0x0, 0x3, 0x0,
+    0x0, 0x19, 0x0, 0xd5, 0x55, 0x5d, 0x0, 0x0,
+    0x19, 0x0, 0xb0, 0x0, 0xb, 0x0, 0x1, 0xab,
+    0x20, 0xc5, 0x55, 0x5b, 0x0, 0x1d, 0x30, 0x86,
+    0x70, 0x0, 0x3, 0x1, 0x2, 0x0, 0x3, 0x9b,
+    0xcd, 0xde, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+901A "通" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x60, 0x3, 0x65, 0x55, 0x7e, 0x20, 0x0, 0x87,
+    0x0, 0x5, 0x54, 0x60, 0x0, 0x0, 0x23, 0x4,
+    0x0, 0xc4, 0x0, 0x40, 0x0, 0x0, 0xc, 0x55,
+    0xc5, 0x56, 0xa0, 0x5, 0x4b, 0xb, 0x55, 0xc5,
+    0x56, 0x90, 0x0, 0xa, 0xb, 0x0, 0xb0, 0x2,
+    0x90, 0x0, 0xa, 0xb, 0x55, 0xc5, 0x56, 0x90,
+    0x0, 0xa, 0xb, 0x0, 0xb0, 0x2, 0x90, 0x0,
+    0xa, 0xb, 0x0, 0xb0, 0x2, 0x90, 0x0, 0x3c,
+    0xb, 0x0, 0xa0, 0x4a, 0x80, 0x8, 0x80, 0x75,
+    0x0, 0x0, 0x5, 0x10, 0x6, 0x0, 0x5, 0xac,
+    0xdd, 0xde, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x11, 0x10,
+
+    /* U+901F "速" */
+    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x2,
+    0x10, 0x0, 0x0, 0xb2, 0x0, 0x0, 0x0, 0xc2,
+    0x35, 0x55, 0xd5, 0x57, 0x90, 0x0, 0x63, 0x0,
+    0x0, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x55,
+    0xc5, 0x5c, 0x0, 0x3, 0x38, 0x9, 0x10, 0xb0,
+    0xb, 0x0, 0x3, 0x1b, 0x9, 0x65, 0xc5, 0x5b,
+    0x0, 0x0, 0xb, 0x6, 0x6, 0xf0, 0x5, 0x0,
+    0x0, 0xb, 0x0, 0x39, 0xb6, 0x71, 0x0, 0x0,
+    0xb, 0x2, 0x80, 0xb0, 0x3d, 0x30, 0x0, 0x4b,
+    0x33, 0x0, 0xc0, 0x2, 0x40, 0xa, 0x60, 0x84,
+    0x0, 0x90, 0x0, 0x0, 0x4, 0x0, 0x5, 0xab,
+    0xcd, 0xde, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9020 "造" */
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x1,
+    0x50, 0x0, 0x30, 0xb2, 0x0, 0x0, 0x0, 0xa6,
+    0x0, 0xd2, 0xb0, 0x3, 0x0, 0x0, 0x33, 0x3,
+    0xa5, 0xc5, 0x69, 0x10, 0x0, 0x0, 0x7, 0x0,
+    0xb0, 0x0, 0x0, 0x6, 0x6b, 0x26, 0x55, 0xc5,
+    0x55, 0xc2, 0x0, 0x19, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x19, 0x0, 0xa5, 0x55, 0x5d, 0x0,
+    0x0, 0x19, 0x0, 0xb0, 0x0, 0xb, 0x0, 0x0,
+    0x19, 0x0, 0xb0, 0x0, 0xb, 0x0, 0x1, 0x8b,
+    0x0, 0xc5, 0x55, 0x5b, 0x0, 0x1d, 0x40, 0x95,
+    0x50, 0x0, 0x1, 0x0, 0x3, 0x0, 0x6, 0xbc,
+    0xcd, 0xee, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9023 "連" */
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x93, 0x0, 0x0, 0xa2, 0x1, 0x0, 0x0, 0x2c,
+    0x5, 0x55, 0xc5, 0x57, 0x50, 0x0, 0x1, 0x0,
+    0x30, 0xa0, 0x5, 0x0, 0x0, 0x1, 0x0, 0xc5,
+    0xc5, 0x5c, 0x10, 0x16, 0x5e, 0x10, 0xc5, 0xc5,
+    0x5b, 0x0, 0x0, 0xb, 0x0, 0xb0, 0xa0, 0xa,
+    0x0, 0x0, 0xb, 0x0, 0xc5, 0xc5, 0x5b, 0x0,
+    0x0, 0xb, 0x0, 0x10, 0xa0, 0x0, 0x30, 0x0,
+    0xb, 0x46, 0x55, 0xc5, 0x55, 0x71, 0x2, 0xaa,
+    0x20, 0x0, 0xa0, 0x0, 0x0, 0xd, 0x20, 0x78,
+    0x31, 0x70, 0x0, 0x22, 0x1, 0x0, 0x2, 0x7a,
+    0xcc, 0xdd, 0xa1,
+
+    /* U+902E "逮" */
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x71, 0x0, 0x0, 0xc1, 0x1, 0x0, 0x0, 0x2c,
+    0x3, 0x65, 0xc5, 0x5d, 0x0, 0x0, 0x2, 0x0,
+    0x0, 0xb0, 0xc, 0x40, 0x0, 0x0, 0x26, 0x55,
+    0xc5, 0x5d, 0x52, 0x7, 0x6d, 0x2, 0x55, 0xc5,
+    0x5c, 0x0, 0x0, 0xa, 0x4, 0x20, 0xb0, 0x4,
+    0x0, 0x0, 0xa, 0x0, 0xb3, 0xb2, 0xa7, 0x0,
+    0x0, 0xa, 0x0, 0x26, 0xd8, 0x0, 0x0, 0x0,
+    0xa, 0x3a, 0x70, 0xb2, 0x98, 0x0, 0x0, 0x5a,
+    0x13, 0x33, 0xc0, 0x7, 0x40, 0x9, 0x50, 0x83,
+    0x8, 0x90, 0x0, 0x0, 0x4, 0x0, 0x6, 0xab,
+    0xbc, 0xcd, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9031 "週" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x85, 0x8, 0x55, 0x65, 0x5b, 0x30, 0x0, 0xd,
+    0xb, 0x0, 0xa2, 0xa, 0x0, 0x0, 0x0, 0xa,
+    0x6, 0xc7, 0x4a, 0x0, 0x0, 0x5, 0xa, 0x0,
+    0xa0, 0x3a, 0x0, 0x16, 0x5d, 0xa, 0x36, 0x65,
+    0x7a, 0x0, 0x0, 0xa, 0x9, 0x8, 0x59, 0x4a,
+    0x0, 0x0, 0xa, 0x9, 0xa, 0x8, 0x2a, 0x0,
+    0x0, 0xa, 0x8, 0xc, 0x5a, 0x2a, 0x0, 0x0,
+    0xa, 0x24, 0x7, 0x2, 0xa, 0x0, 0x0, 0x7b,
+    0x50, 0x0, 0x2, 0x7c, 0x0, 0x1c, 0x30, 0x94,
+    0x0, 0x0, 0x3, 0x0, 0x2, 0x0, 0x6, 0xbb,
+    0xcc, 0xde, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9032 "進" */
+    0x0, 0x0, 0x0, 0x10, 0x10, 0x0, 0x0, 0x0,
+    0x84, 0x0, 0xa7, 0x49, 0x0, 0x0, 0x0, 0x1e,
+    0x0, 0xd0, 0x9, 0x2, 0x0, 0x0, 0x1, 0x5,
+    0xc5, 0x59, 0x58, 0x40, 0x0, 0x4, 0xa, 0xa0,
+    0xa, 0x1, 0x0, 0x6, 0x5d, 0x63, 0xc5, 0x5c,
+    0x59, 0x10, 0x0, 0xb, 0x0, 0xa0, 0xa, 0x0,
+    0x0, 0x0, 0xb, 0x0, 0xc5, 0x5c, 0x5b, 0x10,
+    0x0, 0xb, 0x0, 0xa0, 0xa, 0x0, 0x0, 0x0,
+    0xb, 0x0, 0xa0, 0xa, 0x5, 0x30, 0x1, 0x8b,
+    0x10, 0xc5, 0x55, 0x55, 0x30, 0xd, 0x40, 0x96,
+    0x20, 0x0, 0x0, 0x1, 0x3, 0x0, 0x5, 0xbc,
+    0xcd, 0xef, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9045 "遅" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x84, 0x2, 0x95, 0x55, 0x55, 0xc0, 0x0, 0x1d,
+    0x1, 0xa0, 0x0, 0x0, 0xb0, 0x0, 0x1, 0x0,
+    0xc5, 0x55, 0x55, 0xb0, 0x0, 0x4, 0x0, 0xa2,
+    0x70, 0x67, 0x0, 0x6, 0x5d, 0x11, 0xa5, 0xb5,
+    0xb6, 0x90, 0x0, 0xb, 0x3, 0x71, 0xb, 0x1,
+    0x0, 0x0, 0xb, 0x6, 0x36, 0x5c, 0x59, 0x40,
+    0x0, 0xb, 0x8, 0x0, 0xb, 0x0, 0x51, 0x0,
+    0xb, 0x33, 0x55, 0x5d, 0x55, 0x52, 0x0, 0x7c,
+    0x40, 0x0, 0xc, 0x0, 0x0, 0xc, 0x50, 0x95,
+    0x0, 0x8, 0x0, 0x0, 0x4, 0x0, 0x5, 0xab,
+    0xbb, 0xcd, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+904A "遊" */
+    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x85, 0x0, 0x93, 0x0, 0xc1, 0x0, 0x0, 0x1c,
+    0x0, 0x24, 0x5, 0x60, 0x41, 0x0, 0x0, 0x16,
+    0x75, 0x9a, 0x55, 0x53, 0x0, 0x3, 0x1, 0x90,
+    0x44, 0x55, 0xa1, 0x6, 0x6d, 0x2, 0xb6, 0xa0,
+    0x5, 0x50, 0x0, 0x19, 0x4, 0x63, 0x70, 0x1a,
+    0x10, 0x0, 0x19, 0x7, 0x24, 0x77, 0x5b, 0x75,
+    0x0, 0x19, 0x9, 0x6, 0x40, 0x18, 0x0, 0x0,
+    0x19, 0x43, 0x9, 0x10, 0x18, 0x0, 0x0, 0x7b,
+    0x41, 0x9b, 0x3, 0x88, 0x0, 0x1d, 0x31, 0x82,
+    0x0, 0x0, 0x41, 0x0, 0x2, 0x0, 0x6, 0xaa,
+    0xbb, 0xcc, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x11, 0x0,
+
+    /* U+904B "運" */
+    0x1, 0x80, 0x5, 0x65, 0x55, 0x56, 0x70, 0x0,
+    0x6a, 0xc, 0x0, 0x72, 0x6, 0x30, 0x0, 0x5,
+    0x6, 0x55, 0xc5, 0x59, 0x20, 0x0, 0x1, 0x0,
+    0x30, 0xa0, 0x4, 0x0, 0x6, 0x6e, 0x10, 0xc5,
+    0xc5, 0x5c, 0x0, 0x0, 0xa, 0x0, 0xc5, 0xc5,
+    0x5b, 0x0, 0x0, 0xa, 0x0, 0xa0, 0xa0, 0xa,
+    0x0, 0x0, 0xa, 0x0, 0xa5, 0xc5, 0x58, 0x0,
+    0x0, 0xa, 0x26, 0x55, 0xc5, 0x55, 0xa0, 0x0,
+    0x7c, 0x0, 0x0, 0xa0, 0x0, 0x0, 0x1d, 0x51,
+    0x93, 0x0, 0xa0, 0x0, 0x0, 0x2, 0x0, 0x6,
+    0xbb, 0xcc, 0xcd, 0xb2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+904E "過" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x94, 0x0, 0x75, 0x55, 0x69, 0x0, 0x0, 0x2d,
+    0x0, 0x91, 0x3, 0x46, 0x0, 0x0, 0x1, 0x0,
+    0x86, 0x89, 0x46, 0x0, 0x0, 0x3, 0x1, 0x81,
+    0x46, 0x46, 0x20, 0x16, 0x6d, 0xb, 0x65, 0x56,
+    0x56, 0xd0, 0x0, 0x19, 0xa, 0x7, 0x55, 0x90,
+    0xa0, 0x0, 0x19, 0xa, 0xa, 0x0, 0xa0, 0xa0,
+    0x0, 0x19, 0xa, 0xb, 0x55, 0xb0, 0xa0, 0x0,
+    0x19, 0xb, 0x9, 0x0, 0x70, 0xa0, 0x0, 0x7a,
+    0xa, 0x0, 0x0, 0x3a, 0x80, 0x1d, 0x41, 0x84,
+    0x0, 0x0, 0x1, 0x0, 0x2, 0x0, 0x5, 0xac,
+    0xcd, 0xdd, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9053 "道" */
+    0x0, 0x0, 0x0, 0x10, 0x0, 0x20, 0x0, 0x0,
+    0x84, 0x0, 0x67, 0x0, 0xc4, 0x0, 0x0, 0x2c,
+    0x0, 0xa, 0x4, 0x40, 0x40, 0x0, 0x1, 0x16,
+    0x55, 0xa6, 0x55, 0x82, 0x0, 0x4, 0x0, 0x75,
+    0xa5, 0x59, 0x0, 0x7, 0x6d, 0x0, 0xc0, 0x0,
+    0xc, 0x0, 0x0, 0xa, 0x0, 0xc5, 0x55, 0x5b,
+    0x0, 0x0, 0xa, 0x0, 0xb0, 0x0, 0xb, 0x0,
+    0x0, 0xa, 0x0, 0xc5, 0x55, 0x5b, 0x0, 0x0,
+    0xa, 0x0, 0xb0, 0x0, 0xb, 0x0, 0x1, 0x88,
+    0x20, 0xc5, 0x55, 0x5b, 0x0, 0xc, 0x20, 0x77,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8b,
+    0xcc, 0xde, 0xd2,
+
+    /* U+9054 "達" */
+    0x0, 0x20, 0x0, 0x0, 0x31, 0x0, 0x0, 0x0,
+    0x76, 0x0, 0x0, 0xa3, 0x2, 0x0, 0x0, 0xd,
+    0x2, 0x65, 0xb6, 0x67, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa1, 0x1, 0x70, 0x0, 0x3, 0x26, 0x88,
+    0x55, 0xb5, 0x51, 0x16, 0x6c, 0x0, 0xc, 0x6,
+    0x62, 0x20, 0x0, 0x19, 0x6, 0x55, 0xb6, 0x56,
+    0x50, 0x0, 0x19, 0x1, 0x55, 0xb6, 0x69, 0x0,
+    0x0, 0x19, 0x0, 0x10, 0xa1, 0x0, 0x10, 0x0,
+    0x19, 0x17, 0x55, 0xb6, 0x56, 0x70, 0x2, 0xbb,
+    0x10, 0x0, 0xa1, 0x0, 0x0, 0x1e, 0x20, 0xa6,
+    0x10, 0x81, 0x0, 0x0, 0x1, 0x0, 0x5, 0xbd,
+    0xde, 0xef, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9055 "違" */
+    0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x4,
+    0x90, 0x0, 0xc, 0x10, 0x40, 0x0, 0x0, 0xb5,
+    0x6, 0x8a, 0x55, 0xc0, 0x0, 0x0, 0x20, 0x22,
+    0x77, 0x22, 0xb4, 0x70, 0x0, 0x20, 0x35, 0x22,
+    0x22, 0x43, 0x20, 0x46, 0xc5, 0x9, 0x65, 0x55,
+    0xb4, 0x0, 0x0, 0x92, 0x9, 0x65, 0x75, 0xb1,
+    0x0, 0x0, 0x92, 0x2, 0x0, 0xa0, 0x34, 0x0,
+    0x0, 0x92, 0x4a, 0x55, 0xc5, 0x54, 0x0, 0x0,
+    0x92, 0x4c, 0x55, 0xc5, 0x57, 0x80, 0x5, 0xc6,
+    0x11, 0x0, 0xb0, 0x0, 0x0, 0x8b, 0x5, 0x81,
+    0x0, 0x90, 0x0, 0x0, 0x10, 0x0, 0x3a, 0xcb,
+    0xbc, 0xde, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0,
+
+    /* U+9060 "遠" */
+    0x0, 0x0, 0x0, 0x0, 0x41, 0x0, 0x0, 0x0,
+    0x74, 0x0, 0x0, 0xb2, 0x2, 0x0, 0x0, 0xe,
+    0x1, 0x75, 0xc5, 0x59, 0x10, 0x0, 0x3, 0x0,
+    0x0, 0xb0, 0x0, 0x60, 0x0, 0x0, 0x26, 0x65,
+    0x55, 0x57, 0x51, 0x16, 0x6c, 0x0, 0xc4, 0x44,
+    0x4d, 0x0, 0x0, 0x19, 0x0, 0xc5, 0x55, 0x5b,
+    0x0, 0x0, 0x19, 0x0, 0x77, 0xb0, 0x6, 0x0,
+    0x0, 0x19, 0x0, 0x78, 0xa4, 0x58, 0x20, 0x0,
+    0x19, 0x27, 0x31, 0x90, 0x79, 0x10, 0x1, 0x8b,
+    0x10, 0x2, 0x90, 0x3, 0x90, 0x1d, 0x40, 0x94,
+    0x1, 0x60, 0x0, 0x0, 0x2, 0x0, 0x5, 0xab,
+    0xcc, 0xdd, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9069 "適" */
+    0x0, 0x0, 0x0, 0x1, 0x20, 0x0, 0x0, 0x0,
+    0x91, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x0, 0x5a,
+    0x6, 0x55, 0x65, 0x58, 0x80, 0x0, 0x2, 0x0,
+    0x46, 0x6, 0x50, 0x0, 0x0, 0x2, 0x6, 0x5a,
+    0x5a, 0x58, 0x30, 0x16, 0x6d, 0xa, 0x0, 0xa2,
+    0x9, 0x20, 0x0, 0x19, 0xa, 0x26, 0xc5, 0x89,
+    0x10, 0x0, 0x19, 0xa, 0x2, 0xa1, 0x19, 0x10,
+    0x0, 0x19, 0xa, 0xc, 0x59, 0x59, 0x10, 0x0,
+    0x19, 0xa, 0xc, 0x59, 0x49, 0x10, 0x0, 0x7b,
+    0xb, 0x5, 0x3, 0x3a, 0x10, 0x1d, 0x41, 0x94,
+    0x0, 0x0, 0x39, 0x0, 0x2, 0x0, 0x7, 0xbb,
+    0xcc, 0xcd, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9078 "選" */
+    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x95, 0x7, 0x59, 0x48, 0x5a, 0x20, 0x0, 0x1d,
+    0x9, 0x9, 0x19, 0x9, 0x0, 0x0, 0x0, 0x9,
+    0x57, 0x39, 0x57, 0x30, 0x0, 0x2, 0x8, 0x65,
+    0x98, 0x65, 0x90, 0x16, 0x6d, 0x0, 0x3a, 0x11,
+    0x72, 0x0, 0x0, 0x19, 0x4, 0x5c, 0x57, 0xb8,
+    0x50, 0x0, 0x19, 0x1, 0x9, 0x2, 0x70, 0x0,
+    0x0, 0x19, 0x35, 0x5b, 0x56, 0x95, 0xa1, 0x0,
+    0x19, 0x0, 0xa, 0x23, 0x61, 0x0, 0x1, 0xac,
+    0x3, 0x93, 0x0, 0x1c, 0x30, 0x1e, 0x41, 0xa6,
+    0x0, 0x0, 0x1, 0x10, 0x3, 0x0, 0x6, 0xaa,
+    0xbb, 0xbc, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x11, 0x0,
+
+    /* U+907F "避" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x3,
+    0x60, 0x32, 0x25, 0x2, 0xa0, 0x0, 0x0, 0xa4,
+    0x94, 0x3c, 0x65, 0x86, 0x70, 0x0, 0x10, 0x91,
+    0xa, 0x31, 0xa, 0x0, 0x0, 0x0, 0x96, 0x5b,
+    0xb, 0x26, 0x0, 0x46, 0xa5, 0x90, 0x3, 0x57,
+    0x95, 0xa0, 0x0, 0x92, 0xa4, 0x25, 0x10, 0xa0,
+    0x0, 0x0, 0x92, 0x8c, 0x3b, 0x0, 0xa0, 0x30,
+    0x0, 0x93, 0x6b, 0xa, 0x55, 0xc5, 0x40, 0x0,
+    0x97, 0xb, 0xa, 0x0, 0xa0, 0x0, 0x1, 0x94,
+    0xc, 0x5a, 0x0, 0xb0, 0x0, 0x3b, 0x4, 0x72,
+    0x0, 0x0, 0x50, 0x0, 0x1, 0x0, 0x18, 0xbc,
+    0xcc, 0xde, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9084 "還" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xa0, 0xa, 0x58, 0x58, 0x5b, 0x30, 0x0, 0x97,
+    0xb, 0xa, 0xa, 0x9, 0x0, 0x0, 0x11, 0xc,
+    0x59, 0x59, 0x5b, 0x10, 0x0, 0x10, 0x57, 0x55,
+    0x55, 0x56, 0xb0, 0x36, 0xb5, 0x4, 0x55, 0x55,
+    0x58, 0x0, 0x0, 0x92, 0x7, 0x30, 0x0, 0xb,
+    0x0, 0x0, 0x92, 0x7, 0x7c, 0x55, 0x59, 0x0,
+    0x0, 0x92, 0x0, 0xb6, 0x42, 0x96, 0x0, 0x0,
+    0x92, 0x29, 0x94, 0x2a, 0x60, 0x0, 0x1, 0xb5,
+    0x40, 0x79, 0x72, 0x8a, 0x0, 0x3c, 0x15, 0x71,
+    0x35, 0x0, 0x2, 0x0, 0x43, 0x0, 0x29, 0xbc,
+    0xcc, 0xcd, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+908A "邊" */
+    0x0, 0x0, 0x0, 0x0, 0x23, 0x0, 0x0, 0x0,
+    0x71, 0x0, 0x55, 0xb7, 0x58, 0x0, 0x0, 0x3d,
+    0x0, 0xb5, 0x55, 0x5b, 0x0, 0x0, 0x7, 0x0,
+    0xa5, 0x55, 0x5b, 0x0, 0x0, 0x0, 0x0, 0xb5,
+    0x55, 0x5c, 0x0, 0x14, 0x5a, 0x2, 0x30, 0x55,
+    0x2, 0x30, 0x1, 0x1a, 0x2a, 0x5a, 0x77, 0x85,
+    0xb1, 0x0, 0x19, 0x12, 0x54, 0x45, 0x35, 0x30,
+    0x0, 0x19, 0x6, 0x58, 0x75, 0x57, 0x70, 0x0,
+    0x19, 0x0, 0xb, 0x55, 0x5d, 0x10, 0x1, 0x9b,
+    0x11, 0x92, 0x3, 0x58, 0x0, 0x1d, 0x31, 0xaa,
+    0x10, 0x1, 0x91, 0x0, 0x2, 0x0, 0x6, 0xbc,
+    0xdd, 0xde, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+90A3 "那" */
+    0x2, 0x55, 0x55, 0x93, 0x75, 0x56, 0x70, 0x0,
+    0x11, 0xa0, 0xa1, 0xb0, 0x7, 0x70, 0x0, 0x1,
+    0xa0, 0xa1, 0xb0, 0xa, 0x0, 0x1, 0x55, 0xc5,
+    0xc1, 0xb0, 0x25, 0x0, 0x0, 0x11, 0xa0, 0xa1,
+    0xb0, 0x50, 0x0, 0x0, 0x2, 0x90, 0xa1, 0xb0,
+    0x7, 0x0, 0x2, 0x67, 0xa5, 0xc1, 0xb0, 0x5,
+    0x40, 0x0, 0x6, 0x30, 0xa1, 0xb0, 0x0, 0xa0,
+    0x0, 0x9, 0x0, 0xa1, 0xb0, 0x13, 0xb0, 0x0,
+    0x27, 0x0, 0xb0, 0xb1, 0x7f, 0x40, 0x0, 0x80,
+    0x5b, 0xc0, 0xb0, 0x0, 0x0, 0x5, 0x0, 0x3,
+    0x10, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x10, 0x0, 0x0,
+
+    /* U+90AA "邪" */
+    0x2, 0x55, 0x55, 0x87, 0x75, 0x57, 0x70, 0x1,
+    0x0, 0xb0, 0xb, 0x0, 0x95, 0x0, 0xb2, 0xb,
+    0x0, 0xb0, 0xa, 0x0, 0x1c, 0x0, 0xb0, 0xb,
+    0x4, 0x40, 0x7, 0xa5, 0x5c, 0x7a, 0xb0, 0x60,
+    0x0, 0x10, 0x9, 0xd0, 0xb, 0x4, 0x30, 0x0,
+    0x2, 0xab, 0x0, 0xb0, 0x9, 0x0, 0x0, 0xa1,
+    0xb0, 0xb, 0x0, 0x47, 0x0, 0x64, 0xb, 0x0,
+    0xb0, 0x3, 0xa0, 0x44, 0x0, 0xb0, 0xb, 0x28,
+    0xe6, 0x22, 0x3, 0x3c, 0x0, 0xb0, 0x4, 0x0,
+    0x0, 0x9, 0x90, 0xb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x10, 0x0, 0x0,
+
+    /* U+90E8 "部" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xa0, 0x0, 0x1, 0x0, 0x10, 0x0, 0x0,
+    0x92, 0x15, 0xc, 0x55, 0xd2, 0x3, 0x75, 0x55,
+    0x75, 0xb, 0x1, 0xa0, 0x0, 0x37, 0x2, 0xc0,
+    0xb, 0x6, 0x30, 0x0, 0xb, 0x7, 0x10, 0xb,
+    0x7, 0x0, 0x6, 0x55, 0x57, 0x58, 0x6b, 0x6,
+    0x0, 0x0, 0x10, 0x0, 0x30, 0xb, 0x3, 0x60,
+    0x0, 0xc5, 0x55, 0xd2, 0xb, 0x0, 0xb0, 0x0,
+    0xb0, 0x0, 0xb0, 0xb, 0x0, 0xa2, 0x0, 0xb0,
+    0x0, 0xb0, 0xb, 0x59, 0xd0, 0x0, 0xb5, 0x55,
+    0xc0, 0xb, 0x6, 0x20, 0x0, 0x90, 0x0, 0x70,
+    0xb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x0, 0x0,
+
+    /* U+90F5 "郵" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x1,
+    0x47, 0xab, 0xa0, 0x65, 0x58, 0x50, 0x1, 0x10,
+    0xa0, 0x0, 0x82, 0xc, 0x30, 0x5, 0x55, 0xc5,
+    0x5a, 0x92, 0x36, 0x0, 0x0, 0xa0, 0xa0, 0xa0,
+    0x82, 0x70, 0x0, 0x0, 0xa0, 0xa0, 0xa1, 0x82,
+    0x50, 0x0, 0x5, 0xc5, 0xc5, 0xb6, 0x82, 0x33,
+    0x0, 0x0, 0xa0, 0xa0, 0xa0, 0x82, 0x7, 0x30,
+    0x5, 0xc5, 0xc5, 0xc9, 0x92, 0x0, 0xa0, 0x1,
+    0x0, 0xa0, 0x0, 0x82, 0x0, 0xc0, 0x0, 0x0,
+    0xb4, 0x53, 0x85, 0x7e, 0x80, 0x7, 0xca, 0x52,
+    0x0, 0x82, 0x3, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x82, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+90FD "都" */
+    0x0, 0x0, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb2, 0x3, 0x6, 0x44, 0x72, 0x0, 0x45,
+    0xc7, 0x8d, 0x3c, 0x11, 0xd1, 0x0, 0x10, 0xb1,
+    0x67, 0xb, 0x3, 0x70, 0x0, 0x0, 0xb3, 0xb0,
+    0x3b, 0x7, 0x10, 0x5, 0x55, 0x7d, 0x65, 0x5b,
+    0x6, 0x0, 0x0, 0x1, 0xa2, 0x3, 0xb, 0x6,
+    0x10, 0x0, 0x4d, 0x55, 0x6c, 0xb, 0x0, 0xa0,
+    0x5, 0x4a, 0x0, 0x19, 0xb, 0x0, 0xa3, 0x0,
+    0xc, 0x55, 0x69, 0xb, 0x0, 0x94, 0x0, 0xa,
+    0x0, 0x1a, 0xb, 0x3b, 0xd0, 0x0, 0x1c, 0x55,
+    0x6a, 0xb, 0x1, 0x0, 0x0, 0x1a, 0x0, 0x16,
+    0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0x0, 0x0,
+
+    /* U+914D "配" */
+    0x25, 0x55, 0x55, 0xb3, 0x55, 0x58, 0x10, 0x1,
+    0xa, 0x91, 0x0, 0x10, 0xb, 0x0, 0x3, 0xa,
+    0x91, 0x40, 0x0, 0xb, 0x0, 0xb, 0x5b, 0xb6,
+    0xc0, 0x0, 0xb, 0x0, 0xb, 0x18, 0x91, 0xb0,
+    0x75, 0x5c, 0x0, 0xb, 0x44, 0x91, 0xb0, 0xb0,
+    0x7, 0x0, 0xb, 0x70, 0x4a, 0xb0, 0xb0, 0x0,
+    0x0, 0xb, 0x0, 0x0, 0xb0, 0xb0, 0x0, 0x0,
+    0xb, 0x55, 0x55, 0xb0, 0xb0, 0x0, 0x10, 0xb,
+    0x0, 0x0, 0xb0, 0xb0, 0x0, 0x50, 0xb, 0x55,
+    0x55, 0xb0, 0xb0, 0x0, 0x90, 0xb, 0x0, 0x0,
+    0xb0, 0xaa, 0x9b, 0xb0, 0x4, 0x0, 0x0, 0x30,
+    0x0, 0x0, 0x0,
+
+    /* U+9152 "酒" */
+    0x1, 0x60, 0x45, 0x55, 0x55, 0x56, 0xa0, 0x0,
+    0x75, 0x10, 0xa, 0xa, 0x0, 0x0, 0x0, 0x1,
+    0x32, 0xa, 0xa, 0x3, 0x0, 0x7, 0x1, 0x4d,
+    0x5c, 0x5c, 0x5c, 0x20, 0x4, 0x95, 0xb, 0xa,
+    0xa, 0xb, 0x0, 0x0, 0x27, 0xb, 0x9, 0xa,
+    0xb, 0x0, 0x0, 0x26, 0xb, 0x53, 0x6, 0x9d,
+    0x0, 0x1, 0x92, 0xb, 0x30, 0x0, 0xb, 0x0,
+    0x4, 0xe0, 0xc, 0x55, 0x55, 0x5c, 0x0, 0x0,
+    0xb0, 0xb, 0x0, 0x0, 0xb, 0x0, 0x0, 0xe0,
+    0xd, 0x55, 0x55, 0x5c, 0x0, 0x0, 0x80, 0xb,
+    0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+9154 "酔" */
+    0x0, 0x0, 0x0, 0x0, 0x32, 0x0, 0x0, 0x15,
+    0x55, 0x55, 0x90, 0x85, 0x0, 0x0, 0x1, 0x54,
+    0x90, 0x4, 0xa7, 0x58, 0x0, 0x1, 0x54, 0x92,
+    0x1, 0x91, 0xa, 0x0, 0xa, 0x88, 0xba, 0x50,
+    0xa0, 0xa, 0x10, 0x9, 0x53, 0x97, 0x24, 0x60,
+    0x9, 0x50, 0x9, 0x71, 0x97, 0x46, 0x8, 0x4a,
+    0xa3, 0x9, 0x70, 0xac, 0x40, 0xc, 0x10, 0x0,
+    0xa, 0x0, 0x7, 0x43, 0x3c, 0x43, 0x80, 0xa,
+    0x55, 0x5a, 0x43, 0x2c, 0x32, 0x20, 0x9, 0x0,
+    0x7, 0x20, 0xb, 0x10, 0x0, 0xa, 0x55, 0x5a,
+    0x30, 0xc, 0x10, 0x0, 0xa, 0x0, 0x7, 0x20,
+    0xc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0,
+
+    /* U+9178 "酸" */
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x15,
+    0x55, 0x56, 0x80, 0x3a, 0x11, 0x0, 0x1, 0x36,
+    0x90, 0x2, 0x70, 0x8, 0x40, 0x1, 0x36, 0x91,
+    0x2c, 0x86, 0x55, 0xd0, 0xa, 0x79, 0xbb, 0x32,
+    0x51, 0x33, 0x30, 0xa, 0x45, 0x99, 0x13, 0xa1,
+    0x7, 0xb0, 0xa, 0x53, 0x99, 0x45, 0x57, 0x0,
+    0x81, 0xa, 0x70, 0x9c, 0x10, 0xc6, 0x5b, 0x30,
+    0xa, 0x20, 0x9, 0x16, 0x70, 0x1b, 0x0, 0xa,
+    0x55, 0x5b, 0x44, 0x51, 0xa3, 0x0, 0xa, 0x0,
+    0x9, 0x20, 0xc, 0x70, 0x0, 0xa, 0x55, 0x5b,
+    0x10, 0x59, 0xa1, 0x0, 0xb, 0x0, 0x8, 0x27,
+    0x50, 0x3d, 0x92, 0x3, 0x0, 0x1, 0x40, 0x0,
+    0x1, 0x50,
+
+    /* U+91AB "醫" */
+    0x0, 0x0, 0x0, 0x10, 0x0, 0x10, 0x0, 0x0,
+    0xb5, 0x85, 0x82, 0x95, 0xb3, 0x0, 0x0, 0xa6,
+    0x96, 0x80, 0x90, 0x86, 0x30, 0x0, 0xa4, 0x27,
+    0x34, 0x30, 0x16, 0x20, 0x0, 0xa5, 0xaa, 0x52,
+    0x75, 0xb7, 0x0, 0x0, 0xa3, 0x51, 0x61, 0x29,
+    0xb1, 0x0, 0x2, 0xa6, 0x55, 0x57, 0x53, 0x29,
+    0x10, 0x5, 0x55, 0x55, 0x95, 0x95, 0x55, 0x91,
+    0x0, 0x17, 0x55, 0xc5, 0xc5, 0x76, 0x0, 0x0,
+    0x1a, 0x5, 0x50, 0xa0, 0x55, 0x0, 0x0, 0x1a,
+    0x44, 0x0, 0x57, 0xa5, 0x0, 0x0, 0x1b, 0x55,
+    0x55, 0x55, 0x85, 0x0, 0x0, 0x1b, 0x55, 0x55,
+    0x55, 0x85, 0x0, 0x0, 0x15, 0x0, 0x0, 0x0,
+    0x22, 0x0,
+
+    /* U+91CD "重" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x23, 0x57, 0x9b, 0x90, 0x0, 0x0, 0x23,
+    0x22, 0xb1, 0x0, 0x2, 0x0, 0x5, 0x65, 0x55,
+    0xc5, 0x55, 0x5a, 0x40, 0x0, 0x2, 0x0, 0xa1,
+    0x0, 0x40, 0x0, 0x0, 0xd, 0x55, 0xc5, 0x55,
+    0xc0, 0x0, 0x0, 0xd, 0x55, 0xc5, 0x55, 0xb0,
+    0x0, 0x0, 0xc, 0x0, 0xa1, 0x0, 0xb0, 0x0,
+    0x0, 0xd, 0x55, 0xc5, 0x55, 0xc0, 0x0, 0x0,
+    0x4, 0x0, 0xa1, 0x0, 0x50, 0x0, 0x0, 0x65,
+    0x55, 0xc5, 0x55, 0x86, 0x0, 0x0, 0x0, 0x0,
+    0xa1, 0x0, 0x1, 0x40, 0x26, 0x55, 0x55, 0x85,
+    0x55, 0x57, 0x91,
+
+    /* U+91CE "野" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x95,
+    0x75, 0x5b, 0x45, 0x55, 0xd2, 0xb, 0x9, 0x10,
+    0xb0, 0x0, 0x75, 0x0, 0xb0, 0x91, 0xb, 0x5,
+    0x93, 0x0, 0xb, 0x5b, 0x65, 0xb0, 0x9, 0x60,
+    0x0, 0xb0, 0x91, 0xb, 0x65, 0x86, 0x89, 0xb,
+    0x5b, 0x65, 0xb0, 0xa, 0x8, 0x0, 0x40, 0x91,
+    0x2, 0x0, 0xa1, 0x10, 0x1, 0x19, 0x10, 0x70,
+    0xa, 0x0, 0x0, 0x54, 0xb6, 0x55, 0x0, 0xa0,
+    0x0, 0x0, 0x9, 0x10, 0x11, 0xa, 0x0, 0x1,
+    0x46, 0xb7, 0x53, 0x0, 0xa0, 0x0, 0x59, 0x30,
+    0x0, 0x3, 0x9e, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x20, 0x0,
+
+    /* U+91CF "量" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0xb, 0x55, 0x55, 0x55, 0xd0, 0x0, 0x0, 0xb,
+    0x55, 0x55, 0x55, 0xb0, 0x0, 0x0, 0xb, 0x55,
+    0x55, 0x55, 0xb0, 0x0, 0x0, 0x8, 0x0, 0x0,
+    0x0, 0x40, 0x50, 0x17, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x72, 0x0, 0xa, 0x55, 0x57, 0x55, 0xb0,
+    0x0, 0x0, 0xb, 0x0, 0x19, 0x0, 0xb0, 0x0,
+    0x0, 0xc, 0x55, 0x6b, 0x55, 0xc0, 0x0, 0x0,
+    0xd, 0x55, 0x6b, 0x55, 0xb0, 0x0, 0x0, 0x2,
+    0x0, 0x19, 0x0, 0x34, 0x0, 0x0, 0x56, 0x55,
+    0x6b, 0x55, 0x54, 0x0, 0x5, 0x55, 0x55, 0x6b,
+    0x55, 0x56, 0xc1, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+91D1 "金" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x37, 0x0, 0x0, 0x0, 0x0, 0x0, 0x78,
+    0x3, 0x80, 0x0, 0x0, 0x0, 0x5, 0x90, 0x0,
+    0x4b, 0x20, 0x0, 0x0, 0x56, 0x0, 0x0, 0x6,
+    0xdb, 0x71, 0x15, 0x21, 0x65, 0xc5, 0x56, 0x5,
+    0x50, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x65, 0x55, 0xd5, 0x55, 0x95, 0x0, 0x0,
+    0x4, 0x0, 0xc0, 0x7, 0x10, 0x0, 0x0, 0x3,
+    0xc0, 0xc0, 0x1c, 0x10, 0x0, 0x0, 0x0, 0xb3,
+    0xc0, 0x72, 0x0, 0x0, 0x15, 0x55, 0x65, 0xd5,
+    0x95, 0x58, 0xa0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+91DD "針" */
+    0x0, 0x3, 0x10, 0x0, 0x6, 0x10, 0x0, 0x0,
+    0xe, 0x50, 0x0, 0xc, 0x10, 0x0, 0x0, 0x58,
+    0x79, 0x0, 0xc, 0x0, 0x0, 0x0, 0xa0, 0x8,
+    0x30, 0xc, 0x0, 0x0, 0x6, 0x30, 0x22, 0x0,
+    0xc, 0x0, 0x0, 0x24, 0x5b, 0x63, 0x35, 0x5d,
+    0x56, 0xb0, 0x0, 0x9, 0x10, 0x1, 0xc, 0x0,
+    0x0, 0x4, 0x6b, 0x6b, 0x10, 0xc, 0x0, 0x0,
+    0x1, 0x9, 0x15, 0x0, 0xc, 0x0, 0x0, 0x0,
+    0xa9, 0x2c, 0x0, 0xc, 0x0, 0x0, 0x0, 0xba,
+    0x62, 0x0, 0xc, 0x0, 0x0, 0x2, 0x5c, 0x85,
+    0x10, 0xc, 0x0, 0x0, 0x9, 0x61, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0x0, 0x0,
+
+    /* U+9244 "鉄" */
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0xe, 0x30, 0x0, 0xd, 0x0, 0x0, 0x0, 0x59,
+    0x84, 0xd, 0x1b, 0x0, 0x0, 0x0, 0xa0, 0xc,
+    0x5a, 0xb, 0x3, 0x0, 0x6, 0x30, 0x32, 0x77,
+    0x5c, 0x57, 0x30, 0x24, 0x6c, 0x53, 0x90, 0xb,
+    0x0, 0x0, 0x0, 0xb, 0x3, 0x10, 0x1a, 0x0,
+    0x30, 0x5, 0x6c, 0x57, 0x56, 0x7d, 0x55, 0x71,
+    0x3, 0xb, 0x9, 0x10, 0x78, 0x20, 0x0, 0x4,
+    0x7b, 0x29, 0x0, 0xb0, 0x90, 0x0, 0x1, 0x8b,
+    0x42, 0x16, 0x50, 0x75, 0x0, 0x5, 0x8b, 0x73,
+    0x47, 0x0, 0xd, 0x70, 0x7, 0x20, 0x4, 0x40,
+    0x0, 0x1, 0x92, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+925B "鉛" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0x30, 0x2, 0x0, 0x3, 0x0, 0x0, 0x59,
+    0x85, 0x7, 0x95, 0x5c, 0x0, 0x0, 0xa0, 0xc,
+    0x27, 0x50, 0xa, 0x0, 0x6, 0x30, 0x32, 0x8,
+    0x30, 0xa, 0x0, 0x24, 0x6c, 0x52, 0xa, 0x0,
+    0xb, 0x0, 0x0, 0xb, 0x0, 0x45, 0x0, 0x7,
+    0x93, 0x5, 0x5c, 0x5b, 0x33, 0x0, 0x4, 0x0,
+    0x2, 0xb, 0x7, 0xc, 0x55, 0x5b, 0x40, 0x4,
+    0x6b, 0x2a, 0xb, 0x0, 0x9, 0x20, 0x1, 0x9b,
+    0x42, 0x1b, 0x0, 0x9, 0x20, 0x5, 0x8c, 0x74,
+    0xc, 0x55, 0x5b, 0x20, 0x7, 0x20, 0x0, 0xb,
+    0x0, 0x5, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9280 "銀" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0x10, 0x2, 0x0, 0x3, 0x0, 0x0, 0x97,
+    0x82, 0x1c, 0x55, 0x5d, 0x0, 0x1, 0xa0, 0x2c,
+    0xa, 0x0, 0xb, 0x0, 0x9, 0x10, 0x41, 0xc,
+    0x55, 0x5b, 0x0, 0x23, 0x6c, 0x52, 0xa, 0x0,
+    0xb, 0x0, 0x0, 0xb, 0x0, 0xc, 0x55, 0x5b,
+    0x0, 0x6, 0x5c, 0x6a, 0x1a, 0x40, 0x6, 0x50,
+    0x2, 0xb, 0x7, 0xa, 0x6, 0x19, 0x30, 0x8,
+    0x2b, 0x57, 0xa, 0x8, 0x50, 0x0, 0x5, 0x4b,
+    0x61, 0x1a, 0x2, 0xb2, 0x0, 0x4, 0x7c, 0x74,
+    0x2c, 0x71, 0x2c, 0xa2, 0xa, 0x20, 0x0, 0x19,
+    0x0, 0x0, 0x20,
+
+    /* U+9322 "錢" */
+    0x0, 0x6, 0x0, 0x6, 0x33, 0x20, 0x0, 0x0,
+    0x4d, 0x0, 0x6, 0x60, 0xa3, 0x20, 0x0, 0xa2,
+    0xa5, 0x46, 0xc5, 0x55, 0x20, 0x4, 0x60, 0x8,
+    0x0, 0xb1, 0xa7, 0x0, 0x8, 0x55, 0x92, 0x0,
+    0x6e, 0x40, 0x10, 0x10, 0x1b, 0x0, 0x37, 0x77,
+    0xb3, 0x51, 0x0, 0xb, 0x4, 0x27, 0x47, 0x5b,
+    0xe3, 0x5, 0x5c, 0x66, 0x5, 0x73, 0x42, 0x60,
+    0x4, 0xb, 0x1a, 0x56, 0xc5, 0x54, 0x20, 0x5,
+    0x6b, 0x63, 0x0, 0xb1, 0x96, 0x0, 0x2, 0x4b,
+    0x65, 0x0, 0x4d, 0x80, 0x0, 0xb, 0x96, 0x10,
+    0x2, 0x8a, 0x91, 0x41, 0x2, 0x0, 0x1, 0x44,
+    0x0, 0x4b, 0xc3,
+
+    /* U+932F "錯" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x3d, 0x0, 0x1, 0xc0, 0xc1, 0x0, 0x0, 0xa7,
+    0x81, 0x0, 0xa0, 0xc4, 0x20, 0x2, 0x90, 0x4b,
+    0x36, 0xc5, 0xd5, 0x30, 0x9, 0x10, 0x42, 0x0,
+    0xa0, 0xc0, 0x0, 0x31, 0x5c, 0x43, 0x55, 0xc5,
+    0xd5, 0xb2, 0x0, 0xb, 0x1, 0x10, 0x0, 0x0,
+    0x0, 0x6, 0x5c, 0x78, 0xa, 0x55, 0x5b, 0x30,
+    0x3, 0xb, 0x9, 0xc, 0x0, 0xb, 0x0, 0x7,
+    0x4b, 0x56, 0xd, 0x55, 0x5d, 0x0, 0x4, 0x4b,
+    0x52, 0x1c, 0x0, 0xb, 0x0, 0x6, 0x9b, 0x73,
+    0xd, 0x55, 0x5d, 0x10, 0x8, 0x10, 0x0, 0xb,
+    0x0, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9332 "録" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4c, 0x0, 0x25, 0x55, 0x59, 0x10, 0x0, 0xb5,
+    0x92, 0x1, 0x0, 0xb, 0x0, 0x2, 0x80, 0x3a,
+    0x4, 0x55, 0x5b, 0x0, 0x9, 0x11, 0x60, 0x1,
+    0x0, 0xb, 0x0, 0x32, 0x5c, 0x42, 0x55, 0x55,
+    0x5c, 0xb3, 0x0, 0xb, 0x0, 0x20, 0xb, 0x0,
+    0x20, 0x6, 0x5c, 0x76, 0x39, 0xe, 0x8, 0x80,
+    0x3, 0xb, 0x28, 0x8, 0xc, 0x92, 0x0, 0x8,
+    0x3b, 0x74, 0x1, 0x3b, 0x72, 0x0, 0x5, 0x3b,
+    0x53, 0x47, 0xb, 0xc, 0x30, 0x16, 0x9a, 0x64,
+    0x90, 0xb, 0x2, 0xc2, 0x7, 0x10, 0x0, 0x5,
+    0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10,
+    0x0, 0x0,
+
+    /* U+9577 "長" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0x65, 0x55, 0x55, 0xa2, 0x0, 0x0, 0x8,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x85,
+    0x55, 0x58, 0x50, 0x0, 0x0, 0x8, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0x85, 0x55, 0x58,
+    0x70, 0x0, 0x0, 0x8, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x16, 0x5b, 0x85, 0x55, 0x55, 0x57, 0x90,
+    0x0, 0xd, 0x0, 0x60, 0x0, 0x60, 0x0, 0x0,
+    0xd, 0x0, 0x17, 0x29, 0x60, 0x0, 0x0, 0xd,
+    0x0, 0x14, 0xb0, 0x0, 0x0, 0x0, 0xd, 0x37,
+    0x10, 0x4c, 0x71, 0x0, 0x0, 0xd, 0x80, 0x0,
+    0x0, 0x8e, 0x80, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9589 "閉" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x55,
+    0xd3, 0xa, 0x55, 0xb5, 0xc, 0x0, 0xb0, 0xa,
+    0x0, 0xa2, 0xd, 0x55, 0xc0, 0xb, 0x55, 0xb2,
+    0xd, 0x55, 0xc0, 0xc, 0x55, 0xb2, 0xc, 0x0,
+    0x30, 0x24, 0x0, 0xa2, 0xc, 0x0, 0x0, 0xb1,
+    0x0, 0xa2, 0xc, 0x26, 0x58, 0xe5, 0x83, 0xa2,
+    0xc, 0x0, 0x2b, 0xb0, 0x0, 0xa2, 0xc, 0x2,
+    0x91, 0xb0, 0x0, 0xa2, 0xc, 0x36, 0x0, 0xb0,
+    0x0, 0xa2, 0xc, 0x0, 0x29, 0xd0, 0x0, 0xa2,
+    0xc, 0x0, 0x0, 0x20, 0x3a, 0xe0, 0x2, 0x0,
+    0x0, 0x0, 0x1, 0x10,
+
+    /* U+958B "開" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x55,
+    0xa5, 0xb, 0x55, 0xb4, 0xc, 0x0, 0x83, 0xc,
+    0x0, 0xa2, 0xd, 0x55, 0xa3, 0xc, 0x55, 0xb2,
+    0xd, 0x55, 0xa3, 0xc, 0x55, 0xb2, 0xc, 0x0,
+    0x20, 0x5, 0x0, 0xa2, 0xc, 0x4, 0x65, 0x56,
+    0x80, 0xa2, 0xc, 0x0, 0x55, 0xa, 0x0, 0xa2,
+    0xc, 0x15, 0x88, 0x5c, 0x85, 0xa2, 0xc, 0x1,
+    0x74, 0xa, 0x0, 0xa2, 0xc, 0x0, 0xa0, 0xa,
+    0x0, 0xa2, 0xc, 0x7, 0x30, 0xa, 0x0, 0xa2,
+    0xc, 0x10, 0x0, 0x1, 0x2a, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x10,
+
+    /* U+9593 "間" */
+    0x1, 0x0, 0x10, 0x1, 0x0, 0x20, 0xd, 0x55,
+    0x97, 0xb, 0x55, 0xc4, 0xc, 0x0, 0x54, 0xb,
+    0x0, 0xa2, 0xd, 0x55, 0x94, 0xc, 0x55, 0xb2,
+    0xd, 0x55, 0x95, 0xc, 0x55, 0xb2, 0xc, 0x0,
+    0x10, 0x3, 0x0, 0xa2, 0xc, 0x0, 0xa5, 0x59,
+    0x50, 0xa2, 0xc, 0x0, 0xc0, 0x7, 0x30, 0xa2,
+    0xc, 0x0, 0xd5, 0x5a, 0x30, 0xa2, 0xc, 0x0,
+    0xc0, 0x7, 0x30, 0xa2, 0xc, 0x0, 0xd5, 0x5a,
+    0x30, 0xa2, 0xc, 0x0, 0x70, 0x4, 0x20, 0xa2,
+    0xc, 0x0, 0x0, 0x0, 0x2a, 0xe0, 0x2, 0x0,
+    0x0, 0x0, 0x1, 0x10,
+
+    /* U+95A2 "関" */
+    0x1, 0x0, 0x10, 0x1, 0x0, 0x1, 0x0, 0xd5,
+    0x5c, 0x30, 0xc5, 0x56, 0xc0, 0xd, 0x55, 0xc0,
+    0xc, 0x55, 0x6a, 0x0, 0xc0, 0xb, 0x0, 0xb0,
+    0x2, 0xa0, 0xd, 0x55, 0xc0, 0xc, 0x55, 0x6a,
+    0x0, 0xc0, 0x6, 0x0, 0x71, 0x2, 0xa0, 0xc,
+    0x0, 0x73, 0x29, 0x0, 0x2a, 0x0, 0xc0, 0x55,
+    0x6a, 0x57, 0x32, 0xa0, 0xc, 0x0, 0x5, 0x70,
+    0x3, 0x2a, 0x0, 0xc1, 0x65, 0xd8, 0x55, 0x42,
+    0xa0, 0xc, 0x0, 0x67, 0x4a, 0x60, 0x2a, 0x0,
+    0xc0, 0x65, 0x0, 0x6, 0x2, 0xa0, 0xc, 0x10,
+    0x0, 0x0, 0x17, 0xc9, 0x0, 0x40, 0x0, 0x0,
+    0x0, 0x4, 0x0,
+
+    /* U+95DC "關" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0xb5,
+    0x59, 0x60, 0xc5, 0x56, 0xc0, 0x1b, 0x55, 0x95,
+    0xc, 0x55, 0x6a, 0x1, 0xa0, 0x6, 0x50, 0xb0,
+    0x1, 0xa0, 0x1b, 0x55, 0x92, 0x9, 0x85, 0x6a,
+    0x1, 0xa0, 0x38, 0x21, 0x82, 0x31, 0xa0, 0x1a,
+    0x1a, 0x88, 0x67, 0xa5, 0x1a, 0x1, 0xa0, 0x76,
+    0x84, 0x93, 0x71, 0xa0, 0x1a, 0x8, 0x37, 0x55,
+    0x14, 0x1a, 0x1, 0xa0, 0xa0, 0xb4, 0x70, 0xa1,
+    0xa0, 0x1a, 0x17, 0x59, 0x39, 0x5a, 0x1a, 0x1,
+    0xa0, 0x6, 0x44, 0x60, 0x1, 0xa0, 0x1a, 0x2,
+    0x20, 0x12, 0x5, 0xc7, 0x0, 0x20, 0x0, 0x0,
+    0x0, 0x3, 0x0,
+
+    /* U+95F0 "闰" */
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0x20, 0x55, 0x55, 0x55, 0x90, 0x15, 0x64, 0x1,
+    0x0, 0x0, 0xc, 0x2, 0xb0, 0x0, 0x0, 0x0,
+    0x30, 0xc0, 0x2a, 0x17, 0x55, 0xb5, 0x67, 0xc,
+    0x2, 0xa0, 0x0, 0xc, 0x0, 0x0, 0xc0, 0x2a,
+    0x0, 0x0, 0xc0, 0x42, 0xc, 0x2, 0xa0, 0x36,
+    0x5d, 0x55, 0x30, 0xc0, 0x2a, 0x0, 0x0, 0xc0,
+    0x0, 0xc, 0x2, 0xa0, 0x0, 0xc, 0x0, 0x60,
+    0xc0, 0x2a, 0x46, 0x55, 0x55, 0x55, 0x2c, 0x2,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0xb0, 0x29, 0x0,
+    0x0, 0x0, 0x5, 0xd8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x0,
+
+    /* U+9633 "阳" */
+    0x65, 0x58, 0x51, 0x0, 0x0, 0x10, 0x92, 0xb,
+    0x3b, 0x55, 0x55, 0xd0, 0x92, 0x17, 0xb, 0x0,
+    0x0, 0xb0, 0x92, 0x60, 0xb, 0x0, 0x0, 0xb0,
+    0x92, 0x60, 0xb, 0x0, 0x0, 0xb0, 0x92, 0x9,
+    0xb, 0x55, 0x55, 0xb0, 0x92, 0x6, 0x6b, 0x0,
+    0x0, 0xb0, 0x92, 0x7, 0x7b, 0x0, 0x0, 0xb0,
+    0x95, 0xbe, 0x1b, 0x0, 0x0, 0xb0, 0x92, 0x31,
+    0xb, 0x0, 0x0, 0xb0, 0x92, 0x0, 0xb, 0x55,
+    0x55, 0xc0, 0x92, 0x0, 0x8, 0x0, 0x0, 0x70,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+9644 "附" */
+    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x1, 0x85,
+    0x93, 0xb, 0x40, 0xc, 0x0, 0x1a, 0xa, 0x1,
+    0xb0, 0x0, 0xb0, 0x1, 0xa0, 0x80, 0x73, 0x0,
+    0xb, 0x0, 0x1a, 0x52, 0xd, 0x24, 0x55, 0xc8,
+    0x31, 0xa3, 0x15, 0xa1, 0x10, 0xb, 0x0, 0x1a,
+    0x8, 0x29, 0x14, 0x0, 0xb0, 0x1, 0xa0, 0x72,
+    0x91, 0x3b, 0xb, 0x0, 0x1a, 0x7, 0x49, 0x10,
+    0x50, 0xb0, 0x1, 0xba, 0xc0, 0x91, 0x0, 0xb,
+    0x0, 0x1a, 0x10, 0x9, 0x10, 0x0, 0xb0, 0x1,
+    0xa0, 0x0, 0x91, 0x2, 0x1b, 0x0, 0x19, 0x0,
+    0x8, 0x10, 0x2c, 0x60, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+964D "降" */
+    0x0, 0x0, 0x0, 0x25, 0x0, 0x0, 0x2, 0xa5,
+    0x89, 0x7, 0xa5, 0x59, 0x10, 0x1a, 0xa, 0x20,
+    0xb2, 0x3, 0xb0, 0x1, 0xa0, 0x90, 0x53, 0x71,
+    0xb0, 0x0, 0x1a, 0x32, 0x13, 0x3, 0xe2, 0x0,
+    0x1, 0xa1, 0x40, 0x2, 0x94, 0xa6, 0x20, 0x1a,
+    0x6, 0x35, 0x50, 0xa1, 0x59, 0x11, 0xa0, 0x2a,
+    0x36, 0x5c, 0x58, 0x50, 0x1a, 0x3, 0xa5, 0x30,
+    0xb0, 0x0, 0x1, 0xb9, 0xe3, 0xb1, 0xb, 0x0,
+    0x30, 0x1a, 0x1, 0x28, 0x55, 0xc5, 0x57, 0x21,
+    0xa0, 0x0, 0x0, 0xb, 0x0, 0x0, 0x1a, 0x0,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x20, 0x0, 0x0,
+    0x3, 0x0, 0x0,
+
+    /* U+9650 "限" */
+    0x75, 0x5a, 0x8, 0x55, 0x5a, 0x40, 0xa, 0x12,
+    0x90, 0xb0, 0x0, 0xa1, 0x0, 0xa1, 0x62, 0xb,
+    0x0, 0xa, 0x10, 0xa, 0x16, 0x0, 0xd5, 0x55,
+    0xc1, 0x0, 0xa1, 0x50, 0xb, 0x0, 0xa, 0x20,
+    0xa, 0x12, 0x50, 0xd6, 0x55, 0xc2, 0x0, 0xa1,
+    0xa, 0xb, 0x14, 0x2, 0x90, 0xa, 0x10, 0xb0,
+    0xb0, 0x71, 0xa5, 0x0, 0xa5, 0xbd, 0xb, 0x7,
+    0x70, 0x0, 0xa, 0x14, 0x10, 0xb0, 0x1b, 0x20,
+    0x0, 0xa1, 0x0, 0xd, 0x82, 0x2d, 0x93, 0xa,
+    0x10, 0x1, 0xc1, 0x0, 0x1a, 0x40, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+9662 "院" */
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x65, 0x58,
+    0x0, 0xa, 0x10, 0x0, 0xa0, 0x48, 0x55, 0x5b,
+    0x65, 0x83, 0xa0, 0x71, 0xb0, 0x0, 0x0, 0x80,
+    0xa0, 0x60, 0x40, 0x0, 0x5, 0x0, 0xa0, 0x40,
+    0x5, 0x55, 0x55, 0x0, 0xa0, 0x53, 0x0, 0x0,
+    0x0, 0x40, 0xa0, 0xb, 0x56, 0xb5, 0xb5, 0x71,
+    0xa0, 0xc, 0x0, 0xb0, 0xb0, 0x0, 0xa3, 0xbb,
+    0x1, 0xa0, 0xb0, 0x0, 0xa0, 0x30, 0x6, 0x60,
+    0xb0, 0x4, 0xa0, 0x0, 0x1a, 0x0, 0xb0, 0x17,
+    0xa0, 0x3, 0x70, 0x0, 0xaa, 0xba, 0x40, 0x11,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+9664 "除" */
+    0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x6, 0x55,
+    0xa1, 0x4, 0xe1, 0x0, 0x0, 0xa0, 0x2a, 0x0,
+    0xc2, 0x70, 0x0, 0xa, 0x7, 0x20, 0x66, 0x4,
+    0x80, 0x0, 0xa0, 0x60, 0x38, 0x0, 0x6, 0xc5,
+    0xa, 0x4, 0x25, 0x46, 0x85, 0x83, 0x70, 0xa0,
+    0x54, 0x0, 0xb, 0x0, 0x0, 0xa, 0x0, 0xc3,
+    0x55, 0xc5, 0x5b, 0x20, 0xa0, 0x1c, 0x12, 0xb,
+    0x0, 0x0, 0xa, 0x4e, 0x50, 0xd3, 0xb0, 0x61,
+    0x0, 0xa0, 0x0, 0x85, 0xb, 0x1, 0xb2, 0xa,
+    0x0, 0x64, 0x0, 0xb0, 0x5, 0x90, 0xb0, 0x1,
+    0x4, 0xbd, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x0,
+
+    /* U+9678 "陸" */
+    0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x7, 0x55,
+    0x91, 0x0, 0xc1, 0x0, 0x0, 0xb0, 0xb, 0x0,
+    0xb, 0x0, 0x60, 0xb, 0x5, 0x32, 0x65, 0xc5,
+    0x55, 0x0, 0xb0, 0x50, 0x0, 0xb, 0x0, 0x3,
+    0xb, 0x5, 0x16, 0x58, 0x65, 0x55, 0x60, 0xb0,
+    0x34, 0x7, 0xa1, 0x6, 0x91, 0xb, 0x0, 0xb5,
+    0x50, 0xb1, 0x5, 0x70, 0xb0, 0x2b, 0x10, 0xb,
+    0x0, 0x0, 0xb, 0x6d, 0x23, 0x65, 0xc5, 0x69,
+    0x0, 0xb0, 0x0, 0x0, 0xb, 0x0, 0x0, 0xb,
+    0x0, 0x0, 0x0, 0xb0, 0x0, 0x20, 0xb0, 0x6,
+    0x55, 0x58, 0x55, 0x77, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+967D "陽" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x55,
+    0xb2, 0xa5, 0x55, 0x5c, 0x0, 0xb0, 0x1b, 0xb,
+    0x0, 0x0, 0xb0, 0xb, 0x6, 0x20, 0xb5, 0x55,
+    0x5b, 0x0, 0xb0, 0x50, 0xb, 0x55, 0x55, 0xc0,
+    0xb, 0x6, 0x0, 0x50, 0x0, 0x3, 0x10, 0xb0,
+    0x27, 0x65, 0x85, 0x55, 0x59, 0xb, 0x0, 0xb0,
+    0x2b, 0x0, 0x0, 0x30, 0xb1, 0x1d, 0x1a, 0x5d,
+    0x6c, 0x6b, 0xb, 0x4d, 0x67, 0x17, 0x57, 0x53,
+    0x80, 0xb0, 0x2, 0x5, 0x62, 0xa0, 0x56, 0xb,
+    0x0, 0x4, 0x22, 0x91, 0x9, 0x30, 0xa0, 0x0,
+    0x4, 0x60, 0x4b, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x30, 0x0,
+
+    /* U+968E "階" */
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x9, 0x55,
+    0xb5, 0xb0, 0xc, 0x0, 0x0, 0xa0, 0xb, 0x1a,
+    0x1, 0xb0, 0xb5, 0xa, 0x6, 0x21, 0xc6, 0x5c,
+    0x82, 0x0, 0xa0, 0x60, 0x1a, 0x0, 0xb0, 0x4,
+    0xa, 0x6, 0x1, 0xc6, 0x2b, 0x0, 0x90, 0xa0,
+    0x18, 0x19, 0x4, 0x49, 0x97, 0xa, 0x0, 0xb0,
+    0x11, 0x80, 0x2, 0x0, 0xa4, 0x8d, 0xc, 0x55,
+    0x55, 0xd0, 0xa, 0x5, 0x10, 0xb0, 0x0, 0xb,
+    0x0, 0xa0, 0x0, 0xc, 0x55, 0x55, 0xb0, 0xb,
+    0x0, 0x0, 0xb0, 0x0, 0xb, 0x0, 0xa0, 0x0,
+    0xc, 0x55, 0x55, 0xc0, 0x0, 0x0, 0x0, 0x10,
+    0x0, 0x0, 0x0,
+
+    /* U+969B "際" */
+    0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x7, 0x55,
+    0xa1, 0x86, 0x24, 0x0, 0x20, 0xb0, 0x3a, 0xb,
+    0x5c, 0x85, 0x97, 0xb, 0x8, 0x17, 0x75, 0xa3,
+    0x38, 0x0, 0xb1, 0x53, 0x75, 0x93, 0xb, 0x20,
+    0xb, 0x6, 0x0, 0x57, 0x0, 0x3c, 0x40, 0xb0,
+    0x45, 0x35, 0x55, 0x58, 0x58, 0x1b, 0x0, 0xc1,
+    0x1, 0x0, 0x0, 0x0, 0xb3, 0x5b, 0x26, 0x55,
+    0x75, 0x77, 0xb, 0x8, 0x10, 0x13, 0xb, 0x20,
+    0x0, 0xb0, 0x0, 0xb, 0x60, 0xb1, 0xa2, 0xb,
+    0x0, 0x17, 0x20, 0xb, 0x2, 0xe0, 0xb0, 0x3,
+    0x0, 0x6d, 0x80, 0x3, 0x1, 0x0, 0x0, 0x0,
+    0x20, 0x0, 0x0,
+
+    /* U+969C "障" */
+    0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x6, 0x45,
+    0x70, 0x0, 0xc0, 0x1, 0x0, 0xc0, 0x77, 0x17,
+    0x57, 0x57, 0x90, 0xb, 0x9, 0x0, 0x19, 0x4,
+    0xa0, 0x0, 0xb0, 0x61, 0x33, 0xa3, 0x83, 0x49,
+    0xb, 0x5, 0x3, 0x42, 0x22, 0x25, 0x20, 0xb0,
+    0x54, 0xc, 0x55, 0x55, 0xd1, 0xb, 0x0, 0xc0,
+    0xc5, 0x55, 0x5c, 0x0, 0xb0, 0xe, 0xb, 0x0,
+    0x0, 0xb0, 0xb, 0x5d, 0x80, 0xa5, 0xc5, 0x59,
+    0x0, 0xb0, 0x12, 0x65, 0x5c, 0x55, 0x5b, 0x1b,
+    0x0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0xc0, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x30, 0x0, 0x0,
+
+    /* U+96A3 "隣" */
+    0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x7, 0x56,
+    0x80, 0x71, 0x94, 0xa, 0x0, 0xb0, 0x74, 0x2,
+    0x89, 0x27, 0x40, 0xb, 0x8, 0x4, 0x66, 0xc8,
+    0x85, 0x70, 0xb3, 0x10, 0x2, 0xaa, 0x65, 0x0,
+    0xb, 0x14, 0x5, 0x60, 0x92, 0x5c, 0x70, 0xb0,
+    0x74, 0x14, 0x6, 0x10, 0x31, 0xb, 0x3, 0x86,
+    0x92, 0x10, 0x19, 0x20, 0xb5, 0x97, 0xa5, 0xc4,
+    0x86, 0xb5, 0xb, 0x6, 0x78, 0x1b, 0x3b, 0x19,
+    0x0, 0xb0, 0x0, 0x49, 0x37, 0x65, 0xb7, 0x1b,
+    0x0, 0x4, 0x70, 0x0, 0x19, 0x0, 0xb0, 0x4,
+    0x50, 0x0, 0x1, 0x90, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x0,
+
+    /* U+96A8 "隨" */
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x8, 0x5a,
+    0x40, 0x0, 0xd, 0x0, 0x20, 0xa0, 0xb2, 0x64,
+    0x69, 0x95, 0x55, 0xa, 0x35, 0xb, 0x3, 0xb5,
+    0x78, 0x30, 0xa5, 0x0, 0x13, 0x62, 0x3a, 0x27,
+    0xa, 0x33, 0x2, 0x2, 0x42, 0x24, 0x20, 0xa0,
+    0x95, 0xb5, 0xb, 0x55, 0xa3, 0xa, 0x8, 0x39,
+    0x10, 0xc5, 0x5a, 0x10, 0xb7, 0xc1, 0x91, 0xa,
+    0x0, 0x81, 0xa, 0x33, 0x9, 0x10, 0xc5, 0x5a,
+    0x10, 0xa0, 0x0, 0x91, 0xa, 0x4, 0xa1, 0xa,
+    0x0, 0x83, 0x65, 0x30, 0x17, 0x0, 0xa0, 0x26,
+    0x0, 0x4a, 0xdc, 0xdb, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+96BB "隻" */
+    0x0, 0x0, 0x0, 0x31, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc1, 0x1d, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x70, 0x4, 0x0, 0x8, 0x0, 0x0, 0x5f, 0x55,
+    0x5d, 0x55, 0x55, 0x10, 0x3, 0x5b, 0x55, 0x5d,
+    0x55, 0x83, 0x0, 0x2, 0xb, 0x0, 0xc, 0x0,
+    0x33, 0x0, 0x0, 0xb, 0x55, 0x5d, 0x55, 0x54,
+    0x0, 0x0, 0xb, 0x44, 0x49, 0x44, 0x49, 0x30,
+    0x0, 0x36, 0x55, 0x55, 0x58, 0x50, 0x0, 0x0,
+    0x10, 0x61, 0x0, 0x3c, 0x30, 0x0, 0x0, 0x0,
+    0x8, 0x57, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xcc, 0x62, 0x0, 0x0, 0x2, 0x46, 0x72, 0x0,
+    0x49, 0xbc, 0xb1, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+96C6 "集" */
+    0x0, 0x0, 0x50, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xc1, 0x1c, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0x75, 0x59, 0x55, 0x5a, 0x40, 0x0, 0x5d, 0x0,
+    0xb, 0x0, 0x0, 0x0, 0x2, 0x7c, 0x55, 0x5c,
+    0x55, 0x77, 0x0, 0x15, 0xb, 0x0, 0xb, 0x0,
+    0x33, 0x0, 0x0, 0xc, 0x55, 0x5c, 0x55, 0x54,
+    0x0, 0x0, 0xc, 0x55, 0x5a, 0x55, 0x5a, 0x20,
+    0x0, 0x7, 0x0, 0x1b, 0x0, 0x0, 0x30, 0x16,
+    0x55, 0x57, 0xbc, 0x85, 0x55, 0x73, 0x0, 0x0,
+    0x3b, 0x2a, 0x35, 0x0, 0x0, 0x0, 0x7, 0x70,
+    0x1a, 0x4, 0xb5, 0x0, 0x4, 0x61, 0x0, 0x1b,
+    0x0, 0x19, 0xe3, 0x10, 0x0, 0x0, 0x2, 0x0,
+    0x0, 0x0,
+
+    /* U+96D1 "雑" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x76, 0x70, 0x0, 0x3, 0x6c,
+    0x6a, 0x0, 0xc1, 0xc0, 0x0, 0x0, 0x28, 0x47,
+    0x1, 0xc5, 0x75, 0xb1, 0x0, 0x83, 0x74, 0x57,
+    0xa0, 0xb0, 0x0, 0x3, 0x61, 0x4a, 0x99, 0xa0,
+    0xb0, 0x0, 0x3, 0x5, 0x70, 0x32, 0xc5, 0xc5,
+    0x80, 0x2, 0x37, 0x83, 0x81, 0xa0, 0xb0, 0x0,
+    0x2, 0x26, 0x72, 0x21, 0xa0, 0xb0, 0x40, 0x0,
+    0xb6, 0x95, 0x1, 0xc5, 0xc5, 0x50, 0x3, 0x65,
+    0x67, 0x71, 0xa0, 0xb0, 0x0, 0x6, 0x5, 0x60,
+    0x51, 0xa0, 0xb0, 0x51, 0x0, 0x3c, 0x50, 0x1,
+    0xc5, 0x55, 0x52, 0x0, 0x2, 0x0, 0x0, 0x20,
+    0x0, 0x0,
+
+    /* U+96D6 "雖" */
+    0x1, 0x10, 0x4, 0x1, 0xb2, 0x70, 0x0, 0x2,
+    0xa5, 0x5c, 0x5, 0x90, 0x94, 0x0, 0x1, 0x70,
+    0xa, 0x9, 0x65, 0x65, 0x90, 0x2, 0xa8, 0x5a,
+    0xe, 0x10, 0xa0, 0x0, 0x0, 0x1a, 0x0, 0x5a,
+    0x10, 0xa0, 0x0, 0x9, 0x5b, 0x58, 0x49, 0x65,
+    0xc6, 0x70, 0xa, 0xa, 0x4, 0x29, 0x10, 0xa0,
+    0x0, 0xa, 0xa, 0x4, 0x29, 0x10, 0xa1, 0x30,
+    0x8, 0x5b, 0x56, 0x19, 0x65, 0xc5, 0x40, 0x0,
+    0xa, 0x5, 0x9, 0x10, 0xa0, 0x0, 0x4, 0x6c,
+    0x78, 0x49, 0x10, 0xa0, 0x60, 0x9, 0x52, 0x2,
+    0x6a, 0x65, 0x55, 0x51, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x0,
+
+    /* U+96D9 "雙" */
+    0x0, 0x0, 0x20, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x67, 0x92, 0x5, 0x87, 0x50, 0x0, 0x0, 0xd5,
+    0x67, 0x69, 0x68, 0x69, 0x20, 0x7, 0xb0, 0xa0,
+    0xf, 0xa, 0x1, 0x0, 0x13, 0xc5, 0xc7, 0x6b,
+    0x5c, 0x57, 0x0, 0x0, 0xa0, 0xa2, 0x1a, 0xa,
+    0x3, 0x0, 0x0, 0xc5, 0xc5, 0x2a, 0x5c, 0x55,
+    0x0, 0x0, 0xc5, 0x95, 0x6b, 0x5b, 0x58, 0x30,
+    0x0, 0x40, 0x0, 0x3, 0x0, 0x30, 0x0, 0x0,
+    0x66, 0x95, 0x55, 0x5d, 0x80, 0x0, 0x0, 0x0,
+    0x26, 0x2, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xcd, 0x20, 0x0, 0x0, 0x0, 0x15, 0x65, 0x12,
+    0x8a, 0x98, 0x72, 0x4, 0x30, 0x0, 0x0, 0x0,
+    0x14, 0x30,
+
+    /* U+96E2 "離" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0x80, 0x10, 0x84, 0x70, 0x0, 0x6, 0x56,
+    0x85, 0x91, 0xa0, 0x83, 0x0, 0x4, 0x34, 0x85,
+    0x30, 0xc5, 0x66, 0x90, 0x7, 0x26, 0xb1, 0x95,
+    0xb0, 0xb0, 0x0, 0x7, 0x51, 0x52, 0x95, 0xb0,
+    0xb0, 0x0, 0x8, 0x57, 0x85, 0x80, 0xc5, 0xc6,
+    0x60, 0x3, 0x19, 0x51, 0x60, 0xb0, 0xb0, 0x0,
+    0xa, 0x3a, 0x53, 0xc0, 0xb0, 0xb0, 0x20, 0xa,
+    0x65, 0x75, 0xa0, 0xd5, 0xc5, 0x40, 0xa, 0x54,
+    0x13, 0xa0, 0xb0, 0xb0, 0x0, 0xa, 0x0, 0x0,
+    0xa0, 0xb0, 0xb0, 0x40, 0xa, 0x0, 0x3b, 0x80,
+    0xd5, 0x55, 0x50, 0x2, 0x0, 0x0, 0x0, 0x10,
+    0x0, 0x0,
+
+    /* U+96E3 "難" */
+    0x0, 0x10, 0x0, 0x0, 0x40, 0x10, 0x0, 0x0,
+    0xa0, 0x74, 0x3, 0xe1, 0x93, 0x0, 0x15, 0xb5,
+    0x97, 0x87, 0x60, 0x35, 0x20, 0x1, 0x90, 0x73,
+    0xb, 0x65, 0xa6, 0x80, 0x0, 0x8a, 0x82, 0x2e,
+    0x20, 0xb0, 0x0, 0x6, 0x5c, 0x5a, 0x69, 0x20,
+    0xb0, 0x0, 0x9, 0x1a, 0xa, 0x9, 0x65, 0xc6,
+    0x40, 0x8, 0x5c, 0x58, 0x9, 0x20, 0xb0, 0x0,
+    0x4, 0x5c, 0x58, 0x19, 0x30, 0xb2, 0x20, 0x15,
+    0x5c, 0x56, 0x79, 0x64, 0xc4, 0x20, 0x1, 0x9,
+    0x11, 0x9, 0x20, 0xb0, 0x0, 0x0, 0x83, 0xa,
+    0x49, 0x20, 0xb0, 0x40, 0x6, 0x30, 0x1, 0x49,
+    0x65, 0x65, 0x60, 0x10, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0,
+
+    /* U+96E8 "雨" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x44, 0x45, 0x55,
+    0x5c, 0x55, 0x55, 0x54, 0x0, 0x0, 0xb, 0x0,
+    0x0, 0x20, 0xc, 0x55, 0x5c, 0x55, 0x55, 0xe0,
+    0xc, 0x26, 0xb, 0x6, 0x0, 0xc0, 0xc, 0x8,
+    0x7b, 0x4, 0xb0, 0xc0, 0xc, 0x0, 0x2b, 0x0,
+    0x30, 0xc0, 0xc, 0x33, 0xb, 0x3, 0x0, 0xc0,
+    0xc, 0xb, 0x4b, 0x6, 0xa0, 0xc0, 0xc, 0x1,
+    0x2b, 0x0, 0x50, 0xc0, 0xc, 0x0, 0xb, 0x0,
+    0x45, 0xb0, 0xa, 0x0, 0x7, 0x0, 0x1b, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+96EA "雪" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x46, 0x55, 0x65, 0x55, 0xc4, 0x0, 0x0, 0x0,
+    0x0, 0x73, 0x0, 0x0, 0x10, 0x4, 0x75, 0x55,
+    0xa7, 0x55, 0x58, 0xb0, 0xb, 0x35, 0x53, 0x73,
+    0x45, 0x44, 0x0, 0x3, 0x0, 0x0, 0x74, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0x53, 0x84, 0x45, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x40, 0x0,
+    0x0, 0x46, 0x55, 0x55, 0x55, 0xc2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x16,
+    0x55, 0x55, 0x55, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb0, 0x0, 0x0, 0x65, 0x55, 0x55,
+    0x55, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x20, 0x0,
+
+    /* U+96F2 "雲" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x7,
+    0x55, 0x77, 0x55, 0x83, 0x0, 0x3, 0x0, 0x5,
+    0x60, 0x0, 0x12, 0x2, 0xa5, 0x55, 0x89, 0x55,
+    0x59, 0xb0, 0x93, 0x55, 0x35, 0x63, 0x54, 0x50,
+    0x0, 0x0, 0x0, 0x57, 0x0, 0x0, 0x0, 0x0,
+    0x55, 0x34, 0x44, 0x54, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x70, 0x0, 0x1, 0x65, 0x55, 0x55,
+    0x55, 0x20, 0x3, 0x65, 0x55, 0x65, 0x55, 0x58,
+    0x80, 0x0, 0x0, 0xa8, 0x2, 0x20, 0x0, 0x0,
+    0x5, 0x71, 0x0, 0x6, 0xa1, 0x0, 0x6, 0xeb,
+    0x98, 0x65, 0x57, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x0,
+
+    /* U+96FB "電" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x6,
+    0x55, 0x59, 0x55, 0x91, 0x0, 0x7, 0x55, 0x56,
+    0xc5, 0x55, 0x69, 0x3, 0x90, 0x0, 0x1a, 0x0,
+    0x5, 0x60, 0x32, 0x45, 0x42, 0xa3, 0x55, 0x30,
+    0x0, 0x4, 0x54, 0x29, 0x35, 0x50, 0x0, 0x0,
+    0x20, 0x0, 0x0, 0x3, 0x0, 0x0, 0xc, 0x55,
+    0x6b, 0x55, 0xc3, 0x0, 0x0, 0xc5, 0x56, 0xc5,
+    0x5c, 0x0, 0x0, 0xb, 0x0, 0x1a, 0x0, 0xb0,
+    0x0, 0x0, 0xc5, 0x56, 0xc5, 0x5c, 0x3, 0x0,
+    0x5, 0x0, 0x1a, 0x0, 0x30, 0x70, 0x0, 0x0,
+    0x0, 0xe9, 0x99, 0x9d, 0x10,
+
+    /* U+9700 "需" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0,
+    0x36, 0x55, 0x77, 0x55, 0x85, 0x0, 0x1, 0x65,
+    0x55, 0x99, 0x55, 0x56, 0x80, 0x8, 0x40, 0x0,
+    0x66, 0x0, 0x6, 0x50, 0x4, 0x4, 0x52, 0x66,
+    0x45, 0x31, 0x0, 0x0, 0x5, 0x52, 0x66, 0x45,
+    0x30, 0x0, 0x3, 0x55, 0x55, 0x55, 0x55, 0x5b,
+    0x40, 0x1, 0x0, 0x3, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x85, 0x59, 0x55, 0x75, 0x5b, 0x0, 0x0,
+    0xb1, 0xb, 0x0, 0xb0, 0x1a, 0x0, 0x0, 0xb1,
+    0xb, 0x0, 0xb0, 0x1a, 0x0, 0x0, 0xb1, 0xb,
+    0x0, 0xb0, 0x1a, 0x0, 0x0, 0xb0, 0x7, 0x0,
+    0x52, 0xb8, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x10, 0x0,
+
+    /* U+9707 "震" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0,
+    0x26, 0x55, 0x95, 0x56, 0x80, 0x0, 0x0, 0x85,
+    0x55, 0xc5, 0x55, 0x59, 0x40, 0x8, 0x50, 0x0,
+    0xb0, 0x0, 0x9, 0x10, 0x3, 0x5, 0x52, 0xb0,
+    0x55, 0x30, 0x0, 0x0, 0x24, 0x42, 0x80, 0x44,
+    0x52, 0x0, 0x0, 0xb5, 0x55, 0x55, 0x55, 0x65,
+    0x0, 0x0, 0xb0, 0x65, 0x55, 0x55, 0x90, 0x0,
+    0x0, 0xc5, 0x55, 0x55, 0x55, 0x5a, 0x50, 0x0,
+    0xb0, 0xb0, 0x42, 0x2, 0x80, 0x0, 0x0, 0xa0,
+    0xb0, 0x8, 0x57, 0x20, 0x0, 0x6, 0x30, 0xb3,
+    0x51, 0x99, 0x30, 0x0, 0x15, 0x0, 0xb6, 0x0,
+    0x3, 0xaf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9752 "青" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0x0, 0x1, 0x20, 0x6, 0x55, 0x55,
+    0xd5, 0x55, 0x88, 0x0, 0x4, 0x55, 0x5d, 0x55,
+    0x6a, 0x0, 0x0, 0x10, 0x0, 0xc0, 0x0, 0x2,
+    0x3, 0x65, 0x55, 0x59, 0x55, 0x55, 0x96, 0x0,
+    0x7, 0x55, 0x55, 0x58, 0x20, 0x0, 0x0, 0xc0,
+    0x0, 0x0, 0xb1, 0x0, 0x0, 0xc, 0x55, 0x55,
+    0x5c, 0x10, 0x0, 0x0, 0xc0, 0x0, 0x0, 0xb1,
+    0x0, 0x0, 0xc, 0x55, 0x55, 0x5c, 0x10, 0x0,
+    0x0, 0xc0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0xc,
+    0x0, 0x3, 0xae, 0x0, 0x0, 0x0, 0x30, 0x0,
+    0x1, 0x10, 0x0,
+
+    /* U+9759 "静" */
+    0x0, 0x3, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0,
+    0xb, 0x11, 0x1, 0xc1, 0x10, 0x0, 0x7, 0x5c,
+    0x57, 0x48, 0x75, 0xd2, 0x0, 0x4, 0x5c, 0x58,
+    0x36, 0x2, 0x50, 0x0, 0x1, 0xa, 0x0, 0x36,
+    0x69, 0x5c, 0x10, 0x26, 0x58, 0x57, 0x80, 0xa,
+    0xa, 0x0, 0x5, 0x55, 0x59, 0x35, 0x5b, 0x5c,
+    0x90, 0x9, 0x10, 0xa, 0x1, 0xa, 0xa, 0x0,
+    0x9, 0x65, 0x5a, 0x1, 0x1a, 0x1b, 0x0, 0x9,
+    0x65, 0x5a, 0x5, 0x4b, 0x36, 0x0, 0x9, 0x10,
+    0xa, 0x0, 0xa, 0x0, 0x0, 0x9, 0x10, 0xa,
+    0x0, 0x9, 0x0, 0x0, 0x9, 0x14, 0xc7, 0x5,
+    0xc7, 0x0, 0x0, 0x1, 0x0, 0x10, 0x0, 0x20,
+    0x0, 0x0,
+
+    /* U+975E "非" */
+    0x0, 0x0, 0x1, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0x10, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0xc0, 0x0, 0x0, 0x4, 0x55, 0x5d,
+    0x0, 0xd5, 0x57, 0x80, 0x0, 0x0, 0xc, 0x0,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x0, 0xc0,
+    0x0, 0x0, 0x1, 0x75, 0x5d, 0x0, 0xd5, 0x58,
+    0x40, 0x0, 0x0, 0xc, 0x0, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0x0, 0xc0, 0x0, 0x0, 0x6,
+    0x55, 0x5d, 0x0, 0xd5, 0x55, 0xb1, 0x0, 0x0,
+    0xc, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x0,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x10,
+    0x0, 0x0,
+
+    /* U+9762 "面" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x6,
+    0x55, 0x55, 0x75, 0x55, 0x56, 0xc1, 0x0, 0x0,
+    0x0, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x10, 0x4,
+    0x30, 0x0, 0x2, 0x0, 0x0, 0xd5, 0x5b, 0x55,
+    0xb5, 0x5d, 0x10, 0x0, 0xc0, 0xb, 0x0, 0xb0,
+    0xc, 0x0, 0x0, 0xc0, 0xb, 0x55, 0xc0, 0xc,
+    0x0, 0x0, 0xc0, 0xb, 0x0, 0xb0, 0xc, 0x0,
+    0x0, 0xc0, 0xb, 0x0, 0xb0, 0xc, 0x0, 0x0,
+    0xc0, 0xb, 0x55, 0xc0, 0xc, 0x0, 0x0, 0xc0,
+    0xb, 0x0, 0xb0, 0xc, 0x0, 0x0, 0xd5, 0x5c,
+    0x55, 0xd5, 0x5d, 0x0, 0x0, 0xb0, 0x0, 0x0,
+    0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9769 "革" */
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0x0, 0x38, 0x1, 0x0, 0x1, 0x65,
+    0x5c, 0x55, 0x6a, 0x59, 0x50, 0x0, 0x0, 0x1b,
+    0x0, 0x27, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x5a,
+    0x65, 0x0, 0x0, 0x0, 0x3, 0x0, 0xc, 0x0,
+    0x30, 0x0, 0x0, 0xd, 0x55, 0x5d, 0x55, 0xb4,
+    0x0, 0x0, 0xc, 0x0, 0xc, 0x0, 0x92, 0x0,
+    0x0, 0xc, 0x55, 0x5d, 0x55, 0x91, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0x0, 0x0, 0x50, 0x6, 0x55,
+    0x55, 0x5d, 0x55, 0x56, 0x71, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0,
+    0x0, 0x0,
+
+    /* U+9774 "靴" */
+    0x0, 0x20, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb0, 0x84, 0x5, 0x8a, 0x10, 0x0, 0x16, 0xb5,
+    0xa9, 0x49, 0x3b, 0x0, 0x0, 0x0, 0xa0, 0x82,
+    0xb, 0xa, 0x4, 0x50, 0x1, 0xaa, 0x82, 0x28,
+    0xa, 0xb, 0x20, 0x5, 0x5c, 0x57, 0x7b, 0xa,
+    0x55, 0x0, 0x9, 0x1a, 0xb, 0x4a, 0xa, 0x80,
+    0x0, 0x9, 0x1a, 0xb, 0xa, 0xd, 0x10, 0x0,
+    0x8, 0x5c, 0x57, 0xa, 0x5a, 0x10, 0x0, 0x0,
+    0xa, 0x4, 0x1a, 0x9, 0x10, 0x0, 0x26, 0x5c,
+    0x55, 0x2a, 0x9, 0x10, 0x40, 0x0, 0xb, 0x0,
+    0xa, 0x9, 0x10, 0x70, 0x0, 0xb, 0x0, 0xb,
+    0x6, 0xba, 0xc0, 0x0, 0x4, 0x0, 0x2, 0x0,
+    0x0, 0x0,
+
+    /* U+97F3 "音" */
+    0x0, 0x0, 0x1, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x65,
+    0x55, 0x87, 0x55, 0x98, 0x0, 0x0, 0x0, 0x53,
+    0x0, 0x3c, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x0,
+    0x84, 0x0, 0x0, 0x0, 0x0, 0x6, 0x0, 0x70,
+    0x5, 0x70, 0x26, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x50, 0x0, 0x7, 0x55, 0x55, 0x56, 0xa0, 0x0,
+    0x0, 0x9, 0x20, 0x0, 0x2, 0x90, 0x0, 0x0,
+    0x9, 0x65, 0x55, 0x56, 0x90, 0x0, 0x0, 0x9,
+    0x20, 0x0, 0x2, 0x90, 0x0, 0x0, 0xa, 0x65,
+    0x55, 0x56, 0xa0, 0x0, 0x0, 0x9, 0x20, 0x0,
+    0x2, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+97FF "響" */
+    0x0, 0x0, 0x0, 0x31, 0x0, 0x0, 0x0, 0x2,
+    0xa0, 0x66, 0x76, 0x54, 0x71, 0x1, 0x71, 0x49,
+    0x0, 0xa9, 0x18, 0x0, 0xa6, 0x93, 0xa5, 0x5a,
+    0x95, 0x0, 0x2, 0x62, 0x9a, 0x57, 0x59, 0x8,
+    0x0, 0x46, 0x93, 0xa6, 0x67, 0x94, 0xa1, 0x0,
+    0x67, 0x4, 0x71, 0x18, 0x14, 0x0, 0x46, 0x55,
+    0x57, 0x76, 0x5a, 0x0, 0x0, 0x0, 0x47, 0x2,
+    0xa0, 0x1, 0x0, 0x65, 0x55, 0x65, 0x75, 0x55,
+    0x91, 0x0, 0xa, 0x55, 0x55, 0x5b, 0x20, 0x0,
+    0x0, 0xa5, 0x55, 0x55, 0xc0, 0x0, 0x0, 0xa,
+    0x55, 0x55, 0x5c, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x20, 0x0,
+
+    /* U+9803 "頃" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30,
+    0x0, 0x46, 0x57, 0x55, 0xa3, 0xd, 0x0, 0x0,
+    0x0, 0xb0, 0x0, 0x0, 0xb0, 0x0, 0x8, 0x67,
+    0x55, 0xb0, 0xb, 0x0, 0x10, 0xb0, 0x0, 0xb,
+    0x0, 0xc5, 0x65, 0xc, 0x55, 0x55, 0xb0, 0xb,
+    0x0, 0x0, 0xb0, 0x0, 0xb, 0x0, 0xb0, 0x0,
+    0xc, 0x55, 0x55, 0xb0, 0xb, 0x0, 0x20, 0xb0,
+    0x0, 0xb, 0x0, 0xb2, 0x82, 0xd, 0x55, 0x55,
+    0xb0, 0x1f, 0xa0, 0x0, 0x1a, 0x23, 0x20, 0x0,
+    0x40, 0x0, 0x7, 0x70, 0xa, 0x50, 0x0, 0x0,
+    0x5, 0x30, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+9805 "項" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x46, 0x56, 0x55, 0xb3, 0x5, 0x67,
+    0x77, 0x0, 0xc, 0x0, 0x0, 0x0, 0xb, 0x0,
+    0x7, 0x68, 0x55, 0x90, 0x0, 0xb, 0x0, 0xc,
+    0x0, 0x0, 0xb0, 0x0, 0xb, 0x0, 0xd, 0x55,
+    0x55, 0xb0, 0x0, 0xb, 0x0, 0xb, 0x0, 0x0,
+    0xb0, 0x0, 0xb, 0x0, 0xc, 0x55, 0x55, 0xb0,
+    0x0, 0xb, 0x3, 0xb, 0x0, 0x0, 0xb0, 0x0,
+    0x5d, 0x61, 0xd, 0x55, 0x55, 0xb0, 0x1e, 0x70,
+    0x0, 0x2, 0x82, 0x31, 0x10, 0x0, 0x0, 0x0,
+    0x6, 0x80, 0xa, 0x40, 0x0, 0x0, 0x0, 0x54,
+    0x0, 0x1, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9808 "須" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa1, 0x45, 0x56, 0x55, 0xb3, 0x0, 0x8,
+    0x70, 0x0, 0xc, 0x0, 0x0, 0x0, 0x66, 0x0,
+    0x7, 0x68, 0x55, 0x90, 0x5, 0x20, 0x10, 0xb,
+    0x0, 0x0, 0xb0, 0x0, 0x0, 0x98, 0xc, 0x55,
+    0x55, 0xb0, 0x0, 0x7, 0x80, 0xb, 0x0, 0x0,
+    0xb0, 0x0, 0x64, 0x0, 0xc, 0x55, 0x55, 0xb0,
+    0x3, 0x0, 0x7, 0xb, 0x0, 0x0, 0xb0, 0x0,
+    0x0, 0x6b, 0x1d, 0x55, 0x55, 0xb0, 0x0, 0x6,
+    0x80, 0x2, 0x61, 0x31, 0x10, 0x0, 0x64, 0x0,
+    0x5, 0xa1, 0xa, 0x40, 0x2, 0x0, 0x0, 0x56,
+    0x0, 0x1, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9817 "頗" */
+    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc0, 0x26, 0x55, 0x55, 0xb3, 0x0, 0x0,
+    0xa0, 0x0, 0xc, 0x10, 0x0, 0x2, 0xa4, 0xc5,
+    0xa5, 0x5a, 0x55, 0x91, 0x1, 0x90, 0xa5, 0x2b,
+    0x0, 0x0, 0xb0, 0x1, 0x90, 0xa2, 0xb, 0x55,
+    0x55, 0xc0, 0x1, 0xb5, 0x98, 0x6a, 0x0, 0x0,
+    0xb0, 0x2, 0x80, 0x8, 0x1a, 0x55, 0x55, 0xc0,
+    0x4, 0x65, 0x1a, 0xa, 0x0, 0x0, 0xb0, 0x5,
+    0x30, 0xb6, 0xb, 0x55, 0x55, 0xc0, 0x7, 0x3,
+    0x9c, 0x3, 0x63, 0x21, 0x20, 0x6, 0x27, 0x7,
+    0x13, 0xb1, 0x9, 0x50, 0x12, 0x30, 0x0, 0x37,
+    0x0, 0x0, 0xd0, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x10,
+
+    /* U+9818 "領" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x10, 0x56, 0x56, 0x55, 0xb3, 0x0, 0x2c,
+    0x50, 0x0, 0xc, 0x0, 0x0, 0x0, 0x83, 0x68,
+    0x7, 0x68, 0x55, 0x90, 0x1, 0x92, 0xa, 0x4b,
+    0x0, 0x0, 0xb0, 0x7, 0x16, 0x51, 0xc, 0x55,
+    0x55, 0xb0, 0x22, 0x0, 0x70, 0xb, 0x0, 0x0,
+    0xb0, 0x2, 0x65, 0x5d, 0x2b, 0x55, 0x55, 0xb0,
+    0x0, 0x0, 0x47, 0xb, 0x0, 0x0, 0xb0, 0x1,
+    0x20, 0x80, 0xc, 0x55, 0x55, 0xb0, 0x0, 0x6a,
+    0x20, 0x2, 0x82, 0x22, 0x10, 0x0, 0x9, 0x80,
+    0x6, 0x80, 0x8, 0x60, 0x0, 0x0, 0x60, 0x54,
+    0x0, 0x0, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+982D "頭" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0x36, 0x55, 0x55, 0xb1, 0x16, 0x55,
+    0x55, 0x20, 0xc, 0x0, 0x0, 0x2, 0x0, 0x4,
+    0x6, 0x57, 0x44, 0x80, 0xa, 0x65, 0x5d, 0xc,
+    0x0, 0x0, 0xb0, 0xa, 0x10, 0xb, 0xc, 0x55,
+    0x55, 0xb0, 0xa, 0x55, 0x5b, 0xb, 0x0, 0x0,
+    0xb0, 0x4, 0x0, 0x12, 0xb, 0x55, 0x55, 0xb0,
+    0x3, 0x20, 0x67, 0xb, 0x0, 0x0, 0xb0, 0x0,
+    0xc0, 0x90, 0xc, 0x55, 0x55, 0xb0, 0x0, 0x60,
+    0x73, 0x12, 0x82, 0x13, 0x10, 0x2c, 0xa8, 0x41,
+    0x6, 0x90, 0x6, 0x80, 0x2, 0x0, 0x0, 0x55,
+    0x0, 0x0, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+983C "頼" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x20, 0x36, 0x56, 0x55, 0xb1, 0x1, 0x1b,
+    0x16, 0x10, 0xc, 0x10, 0x0, 0x5, 0x3b, 0x33,
+    0x26, 0x59, 0x55, 0x90, 0x3, 0x1a, 0x14, 0xc,
+    0x0, 0x0, 0xb0, 0xa, 0x4b, 0x4c, 0x1b, 0x55,
+    0x55, 0xb0, 0xa, 0xa, 0xb, 0xb, 0x0, 0x0,
+    0xb0, 0xa, 0x5d, 0x5c, 0xb, 0x55, 0x55, 0xb0,
+    0x2, 0x5f, 0x41, 0xb, 0x0, 0x0, 0xb0, 0x0,
+    0xab, 0x3b, 0xb, 0x55, 0x55, 0xb0, 0x6, 0x3a,
+    0x6, 0x52, 0x83, 0x14, 0x10, 0x24, 0xa, 0x0,
+    0x5, 0x90, 0x6, 0x90, 0x0, 0xa, 0x0, 0x45,
+    0x0, 0x0, 0xb2, 0x0, 0x1, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+984C "題" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0x75, 0x5b, 0x36, 0x55, 0x57, 0x90, 0x4, 0x50,
+    0xa, 0x0, 0x9, 0x0, 0x0, 0x4, 0x85, 0x5a,
+    0x7, 0x67, 0x5b, 0x0, 0x5, 0x51, 0x1a, 0xa,
+    0x0, 0xa, 0x0, 0x4, 0x64, 0x46, 0xa, 0x55,
+    0x5a, 0x0, 0x5, 0x55, 0x57, 0x7a, 0x55, 0x5a,
+    0x0, 0x3, 0xa, 0x0, 0xa, 0x0, 0xa, 0x0,
+    0x8, 0x3a, 0x3, 0x1a, 0x55, 0x58, 0x0, 0x9,
+    0x1a, 0x55, 0x21, 0xc0, 0x44, 0x0, 0x9, 0x5a,
+    0x0, 0x8, 0x20, 0xa, 0x40, 0x7, 0xb, 0x30,
+    0x30, 0x0, 0x1, 0x20, 0x41, 0x0, 0x7b, 0xbb,
+    0xcc, 0xde, 0x80, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9854 "顔" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x40, 0x36, 0x56, 0x55, 0xb1, 0x5, 0x66,
+    0x79, 0x60, 0xc, 0x10, 0x0, 0x0, 0x71, 0x39,
+    0x7, 0x59, 0x55, 0xa0, 0x1, 0x36, 0x60, 0x1c,
+    0x0, 0x0, 0xa0, 0xa, 0x55, 0x66, 0x6b, 0x55,
+    0x55, 0xa0, 0xa, 0x0, 0x2a, 0xb, 0x0, 0x0,
+    0xa0, 0xa, 0x5, 0x71, 0xb, 0x55, 0x55, 0xa0,
+    0xa, 0x20, 0x1b, 0x4b, 0x0, 0x0, 0xa0, 0x9,
+    0x3, 0x82, 0xb, 0x55, 0x55, 0xa0, 0x8, 0x22,
+    0x6, 0xb1, 0x93, 0x24, 0x0, 0x15, 0x1, 0x87,
+    0x5, 0x90, 0x7, 0x80, 0x40, 0x45, 0x0, 0x45,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+9858 "願" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0x55, 0x59, 0x76, 0x57, 0x55, 0xb1, 0xa, 0x0,
+    0x90, 0x0, 0xc, 0x10, 0x0, 0xa, 0x23, 0x32,
+    0x15, 0x48, 0x44, 0x90, 0xa, 0x58, 0x59, 0x4b,
+    0x11, 0x11, 0xc0, 0xa, 0x57, 0x59, 0x2b, 0x55,
+    0x55, 0xb0, 0xa, 0x54, 0x7, 0x2b, 0x0, 0x0,
+    0xb0, 0xa, 0x57, 0x99, 0x2b, 0x55, 0x55, 0xb0,
+    0x8, 0x10, 0xa0, 0xb, 0x0, 0x0, 0xb0, 0x7,
+    0x85, 0xa6, 0x1b, 0x55, 0x55, 0xb0, 0x33, 0x70,
+    0xa2, 0xa1, 0x83, 0x14, 0x10, 0x24, 0x22, 0xb0,
+    0x54, 0x90, 0x6, 0x90, 0x0, 0xa, 0x70, 0x36,
+    0x0, 0x0, 0xc1, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+985E "類" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0x9, 0x35, 0x26, 0x56, 0x55, 0xb1, 0x2, 0xa9,
+    0x2a, 0x0, 0xc, 0x20, 0x0, 0x0, 0x39, 0x73,
+    0x45, 0x49, 0x44, 0x90, 0x26, 0xaf, 0xb6, 0x4b,
+    0x10, 0x0, 0xb0, 0x3, 0x89, 0x3b, 0x3b, 0x55,
+    0x55, 0xb0, 0x34, 0x9, 0x32, 0x3a, 0x0, 0x0,
+    0xb0, 0x0, 0x6, 0x4b, 0xa, 0x55, 0x55, 0xb0,
+    0x12, 0x29, 0x55, 0x6a, 0x0, 0x0, 0xb0, 0x14,
+    0x3d, 0x33, 0x3b, 0x55, 0x55, 0xb0, 0x0, 0x2a,
+    0x78, 0x1, 0x84, 0x14, 0x10, 0x0, 0xa1, 0x7,
+    0x54, 0xa0, 0x6, 0x90, 0x6, 0x10, 0x0, 0x36,
+    0x0, 0x0, 0xb1, 0x10, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+986F "顯" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0x55, 0x59, 0x56, 0x57, 0x58, 0x70, 0xa, 0x0,
+    0xa, 0x0, 0xc, 0x0, 0x0, 0xa, 0x55, 0x5c,
+    0x6, 0x68, 0x59, 0x30, 0xa, 0x55, 0x5a, 0xb,
+    0x0, 0x9, 0x10, 0x2, 0x80, 0x17, 0xa, 0x55,
+    0x5b, 0x10, 0x6, 0x34, 0x74, 0x5a, 0x0, 0x9,
+    0x10, 0x28, 0x91, 0x8a, 0x1a, 0x55, 0x5b, 0x10,
+    0x27, 0x54, 0x64, 0x4a, 0x0, 0x9, 0x10, 0x36,
+    0x39, 0x63, 0x7a, 0x55, 0x5b, 0x10, 0x3, 0x31,
+    0x54, 0x21, 0x92, 0x24, 0x0, 0x19, 0x37, 0xa2,
+    0xa3, 0x90, 0x8, 0x60, 0x33, 0x2, 0x10, 0x36,
+    0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+98A8 "風" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x86, 0x55, 0x55, 0x55, 0xd0, 0x0, 0x0, 0x82,
+    0x0, 0x4, 0x92, 0xb0, 0x0, 0x0, 0x84, 0x57,
+    0xd5, 0x20, 0xb0, 0x0, 0x0, 0x82, 0x0, 0xb0,
+    0x0, 0xb0, 0x0, 0x0, 0x82, 0xa5, 0xc5, 0xc1,
+    0xb0, 0x0, 0x0, 0x82, 0xb0, 0xb0, 0xb0, 0xb0,
+    0x0, 0x0, 0x82, 0xb0, 0xb0, 0xb0, 0xb0, 0x0,
+    0x0, 0x91, 0xa5, 0xc5, 0x90, 0xb0, 0x0, 0x0,
+    0xb0, 0x0, 0xb0, 0x60, 0xc0, 0x0, 0x0, 0xa0,
+    0x0, 0xb4, 0x7a, 0x93, 0x50, 0x6, 0x49, 0xc9,
+    0x63, 0xb, 0x3c, 0x90, 0x16, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xd0, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x10,
+
+    /* U+98DB "飛" */
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x65, 0x55, 0x55, 0xc6, 0x3, 0x0, 0x0, 0x0,
+    0x73, 0x90, 0xa4, 0x88, 0x0, 0x0, 0x2b, 0x51,
+    0xa0, 0x98, 0x52, 0x0, 0x3, 0x3a, 0x0, 0xa0,
+    0x5a, 0xa, 0x31, 0x0, 0xa, 0x0, 0xa0, 0xb,
+    0x50, 0x61, 0x15, 0x5c, 0x55, 0xb5, 0xa2, 0x78,
+    0xc5, 0x1, 0xa, 0x0, 0xa0, 0xb0, 0x12, 0x11,
+    0x0, 0xb, 0x0, 0xa0, 0xb6, 0x73, 0x0, 0x0,
+    0xa, 0x0, 0xa0, 0xb1, 0xa6, 0x0, 0x0, 0x45,
+    0x0, 0xa0, 0x76, 0x5, 0x13, 0x0, 0x80, 0x0,
+    0xa0, 0xb, 0x60, 0x53, 0x15, 0x0, 0x1, 0x50,
+    0x0, 0x6b, 0xd5,
+
+    /* U+98DF "食" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4c, 0x7, 0x10, 0x0, 0x0, 0x0, 0x3, 0xb1,
+    0x71, 0x96, 0x0, 0x0, 0x0, 0x59, 0x0, 0x58,
+    0x8, 0xd9, 0x60, 0x16, 0x39, 0x65, 0x56, 0x5d,
+    0x28, 0x40, 0x0, 0x9, 0x20, 0x0, 0xc, 0x0,
+    0x0, 0x0, 0x9, 0x65, 0x55, 0x5c, 0x0, 0x0,
+    0x0, 0x9, 0x65, 0x55, 0x5c, 0x0, 0x0, 0x0,
+    0x9, 0x22, 0x0, 0x7, 0xb0, 0x0, 0x0, 0x9,
+    0x20, 0x68, 0x66, 0x0, 0x0, 0x0, 0xa, 0x34,
+    0x52, 0x8c, 0x50, 0x0, 0x0, 0xb, 0xb3, 0x0,
+    0x3, 0xe2, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x10, 0x0,
+
+    /* U+98EF "飯" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x60, 0x1, 0x1, 0x5b, 0x60, 0x0, 0x1b,
+    0x66, 0xb, 0x54, 0x31, 0x0, 0x0, 0x84, 0x6,
+    0x8b, 0x0, 0x0, 0x0, 0x4, 0x41, 0xa0, 0x2b,
+    0x0, 0x0, 0x0, 0x13, 0xa5, 0x6a, 0x2b, 0x65,
+    0x58, 0x90, 0x0, 0xa0, 0xa, 0xb, 0x30, 0x7,
+    0x30, 0x0, 0xc5, 0x5c, 0xb, 0x4, 0xa, 0x0,
+    0x0, 0xc5, 0x5c, 0xb, 0x6, 0x27, 0x0, 0x0,
+    0xa0, 0x42, 0xa, 0x5, 0xb0, 0x0, 0x0, 0xa0,
+    0x4a, 0x18, 0x6, 0xb0, 0x0, 0x0, 0xc9, 0x4a,
+    0x51, 0x37, 0x49, 0x0, 0x0, 0xa1, 0x0, 0x52,
+    0x50, 0x8, 0xb1, 0x0, 0x0, 0x2, 0x2, 0x0,
+    0x0, 0x30,
+
+    /* U+98F2 "飲" */
+    0x0, 0x1, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
+    0x8, 0x70, 0x0, 0xc2, 0x0, 0x0, 0x0, 0xb,
+    0x65, 0x0, 0xb0, 0x0, 0x0, 0x0, 0x84, 0x7,
+    0x85, 0x95, 0x58, 0x60, 0x3, 0x41, 0xa0, 0x29,
+    0x10, 0x9, 0x30, 0x13, 0x95, 0x7a, 0x44, 0x4a,
+    0x7, 0x0, 0x0, 0xa0, 0xa, 0x20, 0x59, 0x11,
+    0x0, 0x0, 0xc5, 0x5c, 0x0, 0x69, 0x0, 0x0,
+    0x0, 0xc5, 0x5c, 0x0, 0x97, 0x0, 0x0, 0x0,
+    0xa0, 0x42, 0x0, 0xb1, 0x60, 0x0, 0x0, 0xa0,
+    0x5b, 0x3, 0x80, 0xa1, 0x0, 0x1, 0xe9, 0x18,
+    0x8, 0x0, 0x3c, 0x10, 0x0, 0x50, 0x0, 0x50,
+    0x0, 0x5, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9928 "館" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x8, 0x70, 0x0, 0x7, 0x60, 0x0, 0x0, 0xc,
+    0x74, 0x8, 0x56, 0xa5, 0x93, 0x0, 0x85, 0xa,
+    0xb6, 0x0, 0x0, 0x90, 0x3, 0x53, 0x80, 0x23,
+    0x11, 0x16, 0x10, 0x14, 0x85, 0x79, 0x19, 0x64,
+    0x4c, 0x10, 0x0, 0xa0, 0xa, 0x9, 0x20, 0xb,
+    0x0, 0x0, 0xb5, 0x5b, 0x9, 0x65, 0x59, 0x0,
+    0x0, 0xa1, 0x1b, 0x9, 0x20, 0x2, 0x30, 0x0,
+    0xb3, 0x65, 0x9, 0x65, 0x58, 0x80, 0x0, 0xa0,
+    0x4a, 0x9, 0x20, 0x5, 0x50, 0x1, 0xd9, 0x4a,
+    0x9, 0x65, 0x58, 0x60, 0x0, 0x80, 0x0, 0x9,
+    0x20, 0x4, 0x30, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0,
+
+    /* U+9996 "首" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x0, 0x84, 0x0, 0x4c, 0x0, 0x0, 0x0, 0x0,
+    0x1e, 0x0, 0x81, 0x0, 0x30, 0x16, 0x55, 0x58,
+    0xb5, 0x75, 0x57, 0x91, 0x0, 0x0, 0x2, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0x57, 0x65, 0x56,
+    0xc0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x1, 0xa0,
+    0x0, 0x0, 0xc, 0x55, 0x55, 0x56, 0xa0, 0x0,
+    0x0, 0xc, 0x0, 0x0, 0x1, 0xa0, 0x0, 0x0,
+    0xc, 0x55, 0x55, 0x56, 0xa0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x1, 0xa0, 0x0, 0x0, 0xc, 0x55,
+    0x55, 0x56, 0xa0, 0x0, 0x0, 0xc, 0x0, 0x0,
+    0x1, 0xa0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9999 "香" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x35, 0x8b, 0xc3, 0x0, 0x0, 0x4,
+    0x55, 0x4c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x1, 0x80, 0x4, 0x55, 0x58, 0xdd,
+    0x95, 0x55, 0x51, 0x0, 0x0, 0x2b, 0x1c, 0x18,
+    0x10, 0x0, 0x0, 0x5, 0x90, 0xd, 0x1, 0xb9,
+    0x30, 0x1, 0x64, 0x75, 0x57, 0x55, 0xa6, 0xc4,
+    0x3, 0x0, 0xb0, 0x0, 0x0, 0xb0, 0x0, 0x0,
+    0x0, 0xb0, 0x0, 0x0, 0xa0, 0x0, 0x0, 0x0,
+    0xc5, 0x55, 0x55, 0xa0, 0x0, 0x0, 0x0, 0xb0,
+    0x0, 0x0, 0xa0, 0x0, 0x0, 0x0, 0xc5, 0x55,
+    0x55, 0xb0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+99C4 "駄" */
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x2,
+    0xa5, 0x85, 0x80, 0xb, 0x20, 0x0, 0x1, 0xa0,
+    0xa0, 0x0, 0xa, 0x0, 0x0, 0x1, 0xb5, 0xc6,
+    0x60, 0xa, 0x0, 0x10, 0x1, 0xa0, 0xa0, 0x26,
+    0x5c, 0x65, 0x91, 0x1, 0xb5, 0xc5, 0x40, 0xa,
+    0x50, 0x0, 0x1, 0xa0, 0xa0, 0x30, 0x9, 0x60,
+    0x0, 0x1, 0xb4, 0x54, 0xd1, 0x37, 0x70, 0x0,
+    0x0, 0x21, 0x40, 0xb0, 0x72, 0x81, 0x0, 0x4,
+    0x66, 0x85, 0xb0, 0xa0, 0x47, 0x0, 0xa, 0x82,
+    0x42, 0x93, 0x82, 0xc, 0x0, 0x14, 0x1, 0x8,
+    0x69, 0xa, 0x27, 0x90, 0x0, 0x0, 0x8c, 0x61,
+    0x3, 0x10, 0xc4, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+99C5 "駅" */
+    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x2,
+    0xa5, 0x95, 0x86, 0x65, 0x55, 0xc0, 0x1, 0x90,
+    0xb0, 0x16, 0x40, 0x0, 0xb0, 0x1, 0xb5, 0xc6,
+    0x56, 0x40, 0x0, 0xb0, 0x1, 0x90, 0xb0, 0x16,
+    0x40, 0x0, 0xb0, 0x1, 0xb5, 0xc5, 0x46, 0x88,
+    0x55, 0xa0, 0x1, 0x90, 0xb0, 0x26, 0x45, 0x0,
+    0x0, 0x1, 0xb4, 0x54, 0xd7, 0x34, 0x30, 0x0,
+    0x0, 0x11, 0x40, 0xb8, 0x10, 0x80, 0x0, 0x4,
+    0x64, 0x77, 0xb9, 0x0, 0xa0, 0x0, 0xa, 0x73,
+    0x53, 0x98, 0x0, 0x49, 0x0, 0x14, 0x0, 0x8,
+    0x83, 0x0, 0xb, 0x80, 0x0, 0x0, 0x7c, 0x60,
+    0x0, 0x0, 0x93, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9A12 "騒" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x85, 0x76, 0x74, 0x65, 0x56, 0xb0, 0x1, 0xa0,
+    0xb0, 0x0, 0x51, 0x9, 0x40, 0x1, 0xb5, 0xc7,
+    0x40, 0x9, 0x3a, 0x0, 0x1, 0xa0, 0xb0, 0x0,
+    0x4, 0xf2, 0x0, 0x1, 0xb5, 0xc7, 0x40, 0x58,
+    0x5c, 0x83, 0x1, 0xa0, 0xb0, 0x14, 0x20, 0xc0,
+    0x51, 0x2, 0xb4, 0x74, 0xd6, 0x85, 0xc5, 0xc0,
+    0x0, 0x1, 0x30, 0xb5, 0x60, 0xb0, 0xb0, 0x3,
+    0x66, 0x85, 0xa5, 0x95, 0xc5, 0xc0, 0xa, 0x65,
+    0x43, 0x82, 0x20, 0xb2, 0x30, 0x14, 0x0, 0x6,
+    0x50, 0x0, 0xb3, 0xb2, 0x0, 0x3, 0x9c, 0x1c,
+    0xb8, 0x63, 0x28, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9A13 "験" */
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x1,
+    0x85, 0x77, 0x50, 0x1e, 0x10, 0x0, 0x1, 0x90,
+    0xb0, 0x0, 0x93, 0x70, 0x0, 0x1, 0xb5, 0xc7,
+    0x24, 0x70, 0x2b, 0x51, 0x1, 0x90, 0xb0, 0x37,
+    0x68, 0x6a, 0x82, 0x1, 0xb5, 0xc7, 0x20, 0xa,
+    0x11, 0x0, 0x1, 0x90, 0xb0, 0x1b, 0x5c, 0x5b,
+    0x40, 0x2, 0xa4, 0x66, 0x9b, 0xa, 0x19, 0x10,
+    0x0, 0x1, 0x43, 0x7b, 0x5c, 0x5b, 0x10, 0x7,
+    0x66, 0x88, 0x66, 0xb, 0x14, 0x0, 0x2b, 0x73,
+    0x36, 0x40, 0x28, 0x70, 0x0, 0x11, 0x0, 0x9,
+    0x21, 0xa0, 0x59, 0x0, 0x0, 0x2, 0xaa, 0x37,
+    0x0, 0x6, 0xd3, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+9A57 "驗" */
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x1,
+    0x85, 0x68, 0x40, 0xd, 0x30, 0x0, 0x1, 0x90,
+    0xa0, 0x0, 0x64, 0x80, 0x0, 0x1, 0xb5, 0xc8,
+    0x12, 0x80, 0x2a, 0x10, 0x1, 0x90, 0xa0, 0x18,
+    0x65, 0x5b, 0xc5, 0x1, 0xb5, 0xc7, 0x31, 0x1,
+    0x10, 0x20, 0x1, 0x90, 0xa0, 0xc, 0x77, 0xb5,
+    0xc0, 0x1, 0xb4, 0x77, 0x8a, 0x35, 0xa0, 0xa0,
+    0x0, 0x20, 0x34, 0x5c, 0x76, 0xb5, 0xb0, 0x4,
+    0x56, 0x4b, 0x56, 0x81, 0x46, 0x40, 0xa, 0x82,
+    0x37, 0x44, 0x80, 0xc, 0x0, 0x14, 0x0, 0xa,
+    0x19, 0x63, 0x48, 0x60, 0x0, 0x2, 0x9a, 0x53,
+    0x8, 0x70, 0x81, 0x0, 0x0, 0x0, 0x10, 0x2,
+    0x0, 0x0,
+
+    /* U+9AD4 "體" */
+    0x0, 0x0, 0x0, 0x0, 0x11, 0x20, 0x0, 0x0,
+    0x85, 0x5a, 0x0, 0x46, 0xb1, 0x0, 0x0, 0xa2,
+    0x1a, 0x7, 0x89, 0xc6, 0xa0, 0x0, 0xca, 0x5a,
+    0xb, 0x46, 0xa2, 0x90, 0x2, 0xa7, 0x3a, 0x1b,
+    0x78, 0xc6, 0x90, 0xb, 0x66, 0x57, 0x9b, 0x78,
+    0xc6, 0x90, 0x25, 0x85, 0x5b, 0x5, 0x0, 0x1,
+    0x60, 0x0, 0xb0, 0xa, 0x26, 0x55, 0x56, 0x51,
+    0x0, 0xc5, 0x5a, 0x7, 0x75, 0x5a, 0x60, 0x0,
+    0xb0, 0xa, 0x6, 0x52, 0x28, 0x40, 0x0, 0xc5,
+    0x5a, 0x5, 0x73, 0x59, 0x20, 0x0, 0xb0, 0xa,
+    0x0, 0x83, 0x64, 0x0, 0x0, 0xb2, 0x99, 0x45,
+    0x66, 0x95, 0xb2, 0x0, 0x20, 0x0, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+9AD8 "高" */
+    0x0, 0x0, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa2, 0x0, 0x0, 0x20, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x69, 0x0, 0x3, 0x65, 0x55, 0x59,
+    0x0, 0x0, 0x0, 0x46, 0x0, 0x0, 0xb0, 0x0,
+    0x0, 0x4, 0x95, 0x55, 0x5c, 0x0, 0x0, 0x0,
+    0x32, 0x0, 0x0, 0x50, 0x10, 0x0, 0xc5, 0x55,
+    0x55, 0x55, 0x5d, 0x30, 0xb, 0x6, 0x55, 0x59,
+    0x30, 0xc0, 0x0, 0xb0, 0x91, 0x0, 0x91, 0xc,
+    0x0, 0xb, 0x9, 0x65, 0x5b, 0x20, 0xc0, 0x0,
+    0xb0, 0x70, 0x0, 0x61, 0xc, 0x0, 0xb, 0x0,
+    0x0, 0x0, 0x39, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x0,
+
+    /* U+9AEA "髪" */
+    0x0, 0x20, 0x0, 0x30, 0x0, 0x20, 0x0, 0x0,
+    0xa5, 0x55, 0x50, 0x5, 0xb3, 0x0, 0x0, 0xa5,
+    0x56, 0x44, 0x73, 0x4, 0x0, 0x0, 0xa5, 0x56,
+    0x50, 0x3, 0xa6, 0x0, 0x6, 0xa8, 0x55, 0x86,
+    0x53, 0x3, 0x40, 0x0, 0x58, 0x16, 0x20, 0x3,
+    0x98, 0x30, 0x6, 0xc7, 0x55, 0x84, 0x64, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x40, 0x0, 0x7, 0x20,
+    0x16, 0x55, 0x8b, 0x55, 0x55, 0x55, 0x30, 0x0,
+    0x1, 0xb8, 0x55, 0x5d, 0x40, 0x0, 0x0, 0x1a,
+    0x23, 0x42, 0xb4, 0x0, 0x0, 0x3, 0x70, 0x1,
+    0xad, 0x50, 0x0, 0x0, 0x22, 0x4, 0x66, 0x10,
+    0x5b, 0xa8, 0x60, 0x1, 0x30, 0x0, 0x0, 0x0,
+    0x3, 0x0,
+
+    /* U+9B5A "魚" */
+    0x0, 0x0, 0x4, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xd5, 0x0, 0x10, 0x0, 0x0, 0x0, 0xa7,
+    0x55, 0xab, 0x0, 0x0, 0x0, 0x83, 0x0, 0x19,
+    0x0, 0x0, 0x0, 0x7b, 0x55, 0x5a, 0x55, 0x6d,
+    0x1, 0x50, 0xb0, 0x0, 0xc0, 0x2, 0xa0, 0x0,
+    0xb, 0x55, 0x5d, 0x55, 0x7a, 0x0, 0x0, 0xb0,
+    0x0, 0xc0, 0x2, 0xa0, 0x0, 0xb, 0x0, 0xc,
+    0x0, 0x2a, 0x0, 0x0, 0xb5, 0x55, 0x55, 0x56,
+    0x70, 0x0, 0x12, 0x22, 0x4, 0x20, 0x53, 0x0,
+    0xb, 0x0, 0xc0, 0xd, 0x10, 0xc6, 0x9, 0x80,
+    0xb, 0x10, 0x82, 0x2, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+9CE5 "鳥" */
+    0x0, 0x0, 0x1, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0x50, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x58, 0x55, 0x5b, 0x20, 0x0, 0x0, 0xb, 0x0,
+    0x0, 0xb, 0x0, 0x0, 0x0, 0xc, 0x55, 0x55,
+    0x5c, 0x0, 0x0, 0x0, 0xc, 0x55, 0x55, 0x5c,
+    0x0, 0x0, 0x0, 0xc, 0x55, 0x55, 0x55, 0x56,
+    0xa0, 0x0, 0xb, 0x0, 0x0, 0x0, 0x2, 0x0,
+    0x0, 0xb, 0x55, 0x55, 0x55, 0x5b, 0x50, 0x0,
+    0x11, 0x2, 0x30, 0x73, 0xb, 0x10, 0x0, 0x60,
+    0xa0, 0xa4, 0x1d, 0xc, 0x0, 0x5, 0x80, 0xa1,
+    0x24, 0x13, 0x1c, 0x0, 0x6, 0x10, 0x10, 0x0,
+    0x29, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x30, 0x0,
+
+    /* U+9E97 "麗" */
+    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x4,
+    0x65, 0x56, 0x64, 0x65, 0x56, 0x40, 0x0, 0xb5,
+    0x5c, 0x10, 0xb5, 0x5b, 0x0, 0x0, 0xb2, 0x5b,
+    0x0, 0xb8, 0x1a, 0x0, 0x0, 0x90, 0x28, 0x56,
+    0x92, 0xa, 0x0, 0x0, 0x96, 0x59, 0x56, 0x95,
+    0x57, 0x50, 0x0, 0x96, 0x5b, 0x65, 0xb5, 0x58,
+    0x10, 0x0, 0x92, 0x9, 0x10, 0x90, 0xa, 0x0,
+    0x0, 0xa6, 0x86, 0x55, 0xa7, 0x59, 0x0, 0x0,
+    0xc0, 0xa1, 0x2, 0x90, 0x18, 0x0, 0x0, 0xa0,
+    0xa5, 0x55, 0x96, 0x74, 0x30, 0x2, 0x60, 0xa1,
+    0x43, 0x90, 0x0, 0x60, 0x7, 0x0, 0xb9, 0x20,
+    0x6b, 0xaa, 0xd1, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9EBC "麼" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0xc0, 0x0, 0x21, 0x0, 0xc5, 0x56,
+    0x57, 0x56, 0x58, 0x60, 0xb, 0x0, 0xa1, 0x0,
+    0xa2, 0x0, 0x0, 0xb5, 0x6d, 0x74, 0x6d, 0x67,
+    0x40, 0xb, 0x4, 0xf6, 0x14, 0xf6, 0x10, 0x0,
+    0xa2, 0x7a, 0x16, 0x7a, 0x1b, 0x60, 0xa, 0x40,
+    0x81, 0x50, 0x60, 0x12, 0x0, 0x90, 0x3, 0x95,
+    0x5, 0x20, 0x0, 0x27, 0x1b, 0x96, 0x49, 0xa3,
+    0x0, 0x4, 0x30, 0x41, 0x37, 0x20, 0x50, 0x0,
+    0x70, 0x5, 0x75, 0x34, 0x59, 0x70, 0x4, 0x0,
+    0xc9, 0x64, 0x20, 0xa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+9EC4 "黄" */
+    0x0, 0x0, 0x21, 0x0, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x56, 0x0, 0xb2, 0x1, 0x0, 0x0, 0x65,
+    0x98, 0x55, 0xc5, 0x5a, 0x20, 0x0, 0x0, 0x54,
+    0x0, 0xb0, 0x0, 0x20, 0x26, 0x55, 0x77, 0x75,
+    0x95, 0x56, 0xa1, 0x0, 0x2, 0x0, 0x91, 0x0,
+    0x30, 0x0, 0x0, 0xd, 0x55, 0xb6, 0x55, 0xc2,
+    0x0, 0x0, 0xc, 0x0, 0x91, 0x0, 0xb0, 0x0,
+    0x0, 0xd, 0x55, 0xb6, 0x55, 0xc0, 0x0, 0x0,
+    0xc, 0x0, 0x91, 0x0, 0xb0, 0x0, 0x0, 0xb,
+    0x88, 0x55, 0x96, 0x90, 0x0, 0x0, 0x4, 0xd5,
+    0x0, 0x7, 0xa3, 0x0, 0x0, 0x77, 0x0, 0x0,
+    0x0, 0x3e, 0x20, 0x4, 0x10, 0x0, 0x0, 0x0,
+    0x1, 0x0,
+
+    /* U+9ED2 "黒" */
+    0x1, 0x95, 0x55, 0x65, 0x55, 0xa0, 0x0, 0x1a,
+    0x0, 0xb, 0x0, 0xb, 0x0, 0x1, 0xc5, 0x55,
+    0xc5, 0x55, 0xb0, 0x0, 0x1a, 0x0, 0xb, 0x0,
+    0xb, 0x0, 0x1, 0xc5, 0x55, 0xc5, 0x55, 0xb0,
+    0x0, 0x3, 0x0, 0xb, 0x0, 0x2, 0x0, 0x5,
+    0x65, 0x55, 0xc5, 0x55, 0xb2, 0x0, 0x0, 0x0,
+    0xb, 0x0, 0x1, 0x40, 0x46, 0x55, 0x55, 0x85,
+    0x55, 0x79, 0x10, 0x4, 0x6, 0x0, 0x70, 0x8,
+    0x0, 0x4, 0x60, 0x74, 0x8, 0x40, 0x86, 0x0,
+    0xc1, 0x4, 0x30, 0x33, 0x3, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+9EDE "點" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x7,
+    0x57, 0x59, 0x30, 0xd, 0x0, 0x0, 0x9, 0x1a,
+    0x3a, 0x0, 0xb, 0x0, 0x0, 0x9, 0x8a, 0x6a,
+    0x0, 0xc, 0x44, 0x80, 0x9, 0x6c, 0x5b, 0x10,
+    0xb, 0x0, 0x0, 0x6, 0xa, 0x4, 0x0, 0xb,
+    0x0, 0x0, 0x2, 0x3b, 0x38, 0x10, 0xb, 0x0,
+    0x0, 0x2, 0x3b, 0x22, 0x19, 0x5a, 0x5b, 0x20,
+    0x0, 0xa, 0x54, 0x1a, 0x0, 0xb, 0x0, 0xb,
+    0xa5, 0x1, 0xa, 0x0, 0xb, 0x0, 0x2, 0x20,
+    0x62, 0x7a, 0x0, 0xb, 0x0, 0x7, 0x27, 0x71,
+    0x8b, 0x55, 0x5c, 0x0, 0x19, 0x2, 0x0, 0xb,
+    0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0,
+    0x0, 0x0,
+
+    /* U+9EE8 "黨" */
+    0x0, 0x0, 0x0, 0x5, 0x0, 0x10, 0x0, 0x0,
+    0x6, 0x70, 0xb, 0x6, 0x80, 0x0, 0x0, 0x53,
+    0xa3, 0x3b, 0x38, 0x33, 0x70, 0x3, 0x82, 0x52,
+    0x22, 0x25, 0x26, 0x91, 0x8, 0x10, 0x96, 0x55,
+    0x5c, 0x12, 0x0, 0x0, 0x0, 0x96, 0x55, 0x5a,
+    0x0, 0x0, 0x0, 0x29, 0x65, 0x58, 0x55, 0x6a,
+    0x0, 0x0, 0x29, 0x37, 0xa, 0x19, 0x18, 0x0,
+    0x0, 0x2b, 0x56, 0x5b, 0x65, 0x68, 0x0, 0x0,
+    0x47, 0x55, 0x5b, 0x55, 0x5a, 0x10, 0x4, 0x55,
+    0x55, 0x5b, 0x55, 0x55, 0xb1, 0x1, 0x30, 0x4,
+    0x0, 0x40, 0x4, 0x10, 0x2, 0xa0, 0x2, 0x70,
+    0x35, 0x1, 0x80, 0x2, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+9F13 "鼓" */
+    0x0, 0x0, 0x40, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x0, 0xd0, 0x0, 0x9, 0x40, 0x0, 0x6, 0x55,
+    0xd5, 0x75, 0x9, 0x20, 0x0, 0x0, 0x0, 0xb0,
+    0x5, 0x5b, 0x65, 0xa0, 0x1, 0x75, 0xb5, 0x91,
+    0x9, 0x20, 0x0, 0x0, 0x10, 0x0, 0x20, 0x9,
+    0x21, 0x10, 0x0, 0xd5, 0x55, 0xd3, 0x86, 0x5b,
+    0x70, 0x0, 0xd0, 0x0, 0xb0, 0x50, 0xc, 0x0,
+    0x0, 0xd5, 0x55, 0xa0, 0x43, 0x66, 0x0, 0x0,
+    0x40, 0x9, 0x10, 0xa, 0xb0, 0x0, 0x0, 0x19,
+    0x9, 0x0, 0xb, 0x90, 0x0, 0x0, 0x15, 0x78,
+    0x53, 0x82, 0x7a, 0x10, 0xc, 0x95, 0x20, 0x36,
+    0x0, 0x6, 0xc1, 0x0, 0x0, 0x1, 0x10, 0x0,
+    0x0, 0x0,
+
+    /* U+9F3B "鼻" */
+    0x0, 0x0, 0x3, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0x5a, 0x65, 0x58, 0x10, 0x0, 0x0, 0xa,
+    0x22, 0x22, 0x2a, 0x0, 0x0, 0x0, 0xa, 0x33,
+    0x33, 0x3a, 0x0, 0x0, 0x0, 0xa, 0x55, 0x55,
+    0x5b, 0x0, 0x0, 0x0, 0x9, 0x55, 0x55, 0x5a,
+    0x0, 0x0, 0x0, 0xa5, 0x55, 0x95, 0x55, 0xc2,
+    0x0, 0x0, 0xa5, 0x55, 0xc5, 0x55, 0xc0, 0x0,
+    0x0, 0xb5, 0x55, 0xc5, 0x55, 0xc0, 0x0, 0x0,
+    0x40, 0x0, 0x0, 0x0, 0x42, 0x40, 0x17, 0x55,
+    0xc6, 0x55, 0xd5, 0x55, 0x40, 0x0, 0x1, 0xa0,
+    0x0, 0xb0, 0x0, 0x0, 0x0, 0x29, 0x10, 0x0,
+    0xb0, 0x0, 0x0, 0x1, 0x30, 0x0, 0x0, 0x30,
+    0x0, 0x0,
+
+    /* U+F001 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x7b, 0xfb, 0x0,
+    0x0, 0x0, 0x4, 0x9d, 0xff, 0xff, 0xd0, 0x0,
+    0x3, 0xaf, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xdf, 0xd0, 0x0, 0xa,
+    0xff, 0xff, 0xb6, 0x10, 0xed, 0x0, 0x0, 0xaf,
+    0x94, 0x0, 0x0, 0xe, 0xd0, 0x0, 0xa, 0xf1,
+    0x0, 0x0, 0x0, 0xed, 0x0, 0x0, 0xaf, 0x10,
+    0x0, 0x0, 0xe, 0xd0, 0x0, 0xa, 0xf1, 0x0,
+    0x0, 0x45, 0xfd, 0x0, 0x0, 0xaf, 0x10, 0x1,
+    0xef, 0xff, 0xd0, 0x17, 0x9d, 0xf1, 0x0, 0x5f,
+    0xff, 0xfc, 0xe, 0xff, 0xff, 0x10, 0x0, 0xaf,
+    0xfd, 0x31, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x1,
+    0x0, 0x3, 0xbd, 0xa3, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+F008 "" */
+    0x50, 0x18, 0x88, 0x88, 0x88, 0x84, 0x5, 0xfa,
+    0xbf, 0xdd, 0xdd, 0xdd, 0xfd, 0xaf, 0xe4, 0x7f,
+    0x10, 0x0, 0x0, 0xca, 0x4e, 0xe0, 0x4f, 0x10,
+    0x0, 0x0, 0xc8, 0xe, 0xfe, 0xef, 0x10, 0x0,
+    0x0, 0xcf, 0xef, 0xe0, 0x3f, 0xee, 0xee, 0xee,
+    0xf8, 0xe, 0xf6, 0x8f, 0x76, 0x66, 0x66, 0xeb,
+    0x6f, 0xf8, 0xaf, 0x10, 0x0, 0x0, 0xcc, 0x8f,
+    0xe0, 0x3f, 0x10, 0x0, 0x0, 0xc8, 0xe, 0xfc,
+    0xdf, 0x65, 0x55, 0x55, 0xee, 0xcf, 0xc2, 0x5f,
+    0xff, 0xff, 0xff, 0xf9, 0x2c,
+
+    /* U+F00B "" */
+    0x57, 0x75, 0x5, 0x77, 0x77, 0x77, 0x75, 0xff,
+    0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x2f, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xe,
+    0xff, 0xff, 0xff, 0xfe, 0x1, 0x10, 0x0, 0x11,
+    0x11, 0x11, 0x10, 0xef, 0xfe, 0xe, 0xff, 0xff,
+    0xff, 0xfe, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0x68, 0x87, 0x7, 0x88, 0x88, 0x88, 0x86, 0x68,
+    0x87, 0x7, 0x88, 0x88, 0x88, 0x86, 0xff, 0xff,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0xff, 0xff, 0xff, 0xff, 0xdf, 0xfd, 0xd, 0xff,
+    0xff, 0xff, 0xfd,
+
+    /* U+F00C "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1d, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xff, 0xe2, 0x2d, 0x60, 0x0, 0x1,
+    0xdf, 0xfe, 0x20, 0xdf, 0xf7, 0x0, 0x1d, 0xff,
+    0xe2, 0x0, 0x8f, 0xff, 0x71, 0xdf, 0xfe, 0x20,
+    0x0, 0x8, 0xff, 0xfe, 0xff, 0xe2, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7d, 0x20, 0x0, 0x0, 0x0,
+
+    /* U+F00D "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0,
+    0xb, 0xe2, 0xef, 0xf6, 0x0, 0xbf, 0xf8, 0x4f,
+    0xff, 0x6b, 0xff, 0xd1, 0x4, 0xff, 0xff, 0xfd,
+    0x10, 0x0, 0x5f, 0xff, 0xe1, 0x0, 0x0, 0xbf,
+    0xff, 0xf6, 0x0, 0xb, 0xff, 0xdf, 0xff, 0x60,
+    0xbf, 0xfd, 0x14, 0xff, 0xf5, 0xcf, 0xd1, 0x0,
+    0x4f, 0xf6, 0x17, 0x10, 0x0, 0x3, 0x60,
+
+    /* U+F011 "" */
+    0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0x21, 0xff, 0x12, 0xf7, 0x0, 0x6, 0xff, 0x61,
+    0xff, 0x16, 0xff, 0x60, 0x1f, 0xf9, 0x1, 0xff,
+    0x10, 0x9f, 0xf1, 0x6f, 0xe0, 0x1, 0xff, 0x10,
+    0xe, 0xf6, 0xaf, 0x80, 0x1, 0xff, 0x10, 0x8,
+    0xfa, 0xcf, 0x60, 0x1, 0xff, 0x10, 0x6, 0xfc,
+    0xaf, 0x80, 0x0, 0xaa, 0x0, 0x8, 0xfb, 0x7f,
+    0xd0, 0x0, 0x0, 0x0, 0xd, 0xf7, 0x1f, 0xf8,
+    0x0, 0x0, 0x0, 0x8f, 0xf1, 0x7, 0xff, 0x91,
+    0x0, 0x2a, 0xff, 0x70, 0x0, 0x9f, 0xff, 0xee,
+    0xff, 0xf9, 0x0, 0x0, 0x5, 0xcf, 0xff, 0xfd,
+    0x50, 0x0, 0x0, 0x0, 0x2, 0x44, 0x20, 0x0,
+    0x0,
+
+    /* U+F013 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xc0, 0x0, 0x0, 0x3, 0xd6, 0xdf,
+    0xff, 0xfd, 0x6d, 0x30, 0xe, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x5f, 0xff, 0xff, 0xaa, 0xff,
+    0xff, 0xf5, 0x1a, 0xff, 0xf4, 0x0, 0x4f, 0xff,
+    0xa1, 0x3, 0xff, 0xd0, 0x0, 0xd, 0xff, 0x30,
+    0x4, 0xff, 0xf0, 0x0, 0xf, 0xff, 0x40, 0x4f,
+    0xff, 0xfb, 0x22, 0xbf, 0xff, 0xf4, 0x2f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf2, 0x9, 0xfe, 0xff,
+    0xff, 0xff, 0xef, 0x90, 0x0, 0x50, 0x5e, 0xff,
+    0xe5, 0x5, 0x0, 0x0, 0x0, 0xc, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x77, 0x40, 0x0,
+    0x0,
+
+    /* U+F015 "" */
+    0x0, 0x0, 0x0, 0x3, 0x10, 0x3, 0x41, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xf5, 0xd, 0xf5, 0x0,
+    0x0, 0x0, 0x1b, 0xfd, 0xff, 0x8d, 0xf5, 0x0,
+    0x0, 0x2, 0xdf, 0xb1, 0x2d, 0xff, 0xf5, 0x0,
+    0x0, 0x4f, 0xf8, 0x3e, 0xc2, 0xbf, 0xf5, 0x0,
+    0x7, 0xff, 0x55, 0xff, 0xfe, 0x39, 0xfe, 0x40,
+    0x9f, 0xe3, 0x8f, 0xff, 0xff, 0xf5, 0x6f, 0xf6,
+    0xac, 0x2a, 0xff, 0xff, 0xff, 0xff, 0x73, 0xe6,
+    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0,
+    0x0, 0x6f, 0xff, 0xd7, 0x7f, 0xff, 0xf2, 0x0,
+    0x0, 0x6f, 0xff, 0x90, 0xd, 0xff, 0xf2, 0x0,
+    0x0, 0x6f, 0xff, 0x90, 0xd, 0xff, 0xf2, 0x0,
+    0x0, 0x4f, 0xff, 0x70, 0xb, 0xff, 0xe1, 0x0,
+
+    /* U+F019 "" */
+    0x0, 0x0, 0x0, 0x33, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xe2, 0x0,
+    0x0, 0x2, 0xef, 0xff, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xe2, 0x0, 0x0, 0x79, 0x99,
+    0x82, 0xde, 0x28, 0x99, 0x97, 0xff, 0xff, 0xfb,
+    0x22, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0xb3, 0xcf, 0xac, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xca,
+
+    /* U+F01C "" */
+    0x0, 0x6, 0xbb, 0xbb, 0xbb, 0xba, 0x30, 0x0,
+    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x0,
+    0x0, 0xef, 0x30, 0x0, 0x0, 0x6, 0xfb, 0x0,
+    0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x50,
+    0x4f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe1,
+    0xdf, 0x84, 0x42, 0x0, 0x0, 0x34, 0x4b, 0xf9,
+    0xff, 0xff, 0xfd, 0x0, 0x1, 0xff, 0xff, 0xfb,
+    0xff, 0xff, 0xff, 0x98, 0x8b, 0xff, 0xff, 0xfc,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+
+    /* U+F021 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x33, 0x0,
+    0x1, 0x8d, 0xff, 0xc6, 0x0, 0xef, 0x0, 0x4e,
+    0xff, 0xff, 0xff, 0xe4, 0xdf, 0x4, 0xff, 0xb3,
+    0x0, 0x4c, 0xff, 0xff, 0xe, 0xf9, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0x6f, 0xc0, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0x8e, 0x50, 0x0, 0x1, 0xde, 0xee,
+    0xed, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x22, 0x22, 0x22, 0x0, 0x0, 0x0, 0x21, 0xff,
+    0xff, 0xff, 0x10, 0x0, 0x8, 0xf8, 0xff, 0xfb,
+    0xbc, 0x10, 0x0, 0x1e, 0xf4, 0xff, 0xfc, 0x10,
+    0x0, 0x1, 0xdf, 0xc0, 0xfe, 0xef, 0xe8, 0x44,
+    0x8e, 0xfe, 0x10, 0xfe, 0x1a, 0xff, 0xff, 0xff,
+    0xc1, 0x0, 0xfd, 0x0, 0x28, 0xbb, 0x94, 0x0,
+    0x0,
+
+    /* U+F026 "" */
+    0x0, 0x0, 0x2, 0x70, 0x0, 0x2, 0xef, 0x0,
+    0x2, 0xef, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x34, 0x47, 0xff, 0xf0,
+    0x0, 0x5, 0xff, 0x0, 0x0, 0x5, 0xc0, 0x0,
+    0x0, 0x0,
+
+    /* U+F027 "" */
+    0x0, 0x0, 0x2, 0x70, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0x0, 0x0, 0x0, 0x2, 0xef, 0xf0, 0x0,
+    0xd, 0xff, 0xff, 0xff, 0x2, 0x20, 0xff, 0xff,
+    0xff, 0xf0, 0x8e, 0x1f, 0xff, 0xff, 0xff, 0x0,
+    0xe7, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0x5f, 0xff,
+    0xff, 0xff, 0x8, 0x90, 0x34, 0x47, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+F028 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x70, 0x0,
+    0x0, 0x0, 0x2, 0x70, 0x0, 0x5, 0xfa, 0x0,
+    0x0, 0x0, 0x2e, 0xf0, 0x0, 0x81, 0x4f, 0x60,
+    0x0, 0x2, 0xef, 0xf0, 0x1, 0xdd, 0x7, 0xf0,
+    0xdf, 0xff, 0xff, 0xf0, 0x32, 0x1e, 0x80, 0xf6,
+    0xff, 0xff, 0xff, 0xf0, 0x8e, 0x27, 0xe0, 0xb9,
+    0xff, 0xff, 0xff, 0xf0, 0xe, 0x73, 0xf1, 0x9b,
+    0xff, 0xff, 0xff, 0xf0, 0x3f, 0x54, 0xf0, 0x9a,
+    0xff, 0xff, 0xff, 0xf0, 0x89, 0xa, 0xc0, 0xd8,
+    0x34, 0x47, 0xff, 0xf0, 0x0, 0x7f, 0x43, 0xf3,
+    0x0, 0x0, 0x5f, 0xf0, 0x2, 0xf6, 0xc, 0xb0,
+    0x0, 0x0, 0x5, 0xc0, 0x0, 0x0, 0xbf, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xe3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x10, 0x0,
+
+    /* U+F03E "" */
+    0x37, 0x88, 0x88, 0x88, 0x88, 0x88, 0x73, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0x32,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x7f,
+    0xff, 0xfd, 0xff, 0xff, 0xfd, 0x10, 0xcf, 0xff,
+    0xa0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
+    0x7, 0xff, 0xff, 0xf3, 0x5f, 0xa0, 0x0, 0x0,
+    0xcf, 0xff, 0x30, 0x3, 0x0, 0x0, 0x0, 0xcf,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf9,
+
+    /* U+F043 "" */
+    0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x1, 0xfa,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0x10, 0x0, 0x0,
+    0xd, 0xff, 0x70, 0x0, 0x0, 0x6f, 0xff, 0xf1,
+    0x0, 0x1, 0xef, 0xff, 0xfa, 0x0, 0xb, 0xff,
+    0xff, 0xff, 0x60, 0x5f, 0xff, 0xff, 0xff, 0xe0,
+    0xcf, 0xff, 0xff, 0xff, 0xf6, 0xfe, 0xbf, 0xff,
+    0xff, 0xf9, 0xfd, 0x4f, 0xff, 0xff, 0xf9, 0xbf,
+    0x49, 0xff, 0xff, 0xf5, 0x3f, 0xe5, 0x2e, 0xff,
+    0xd0, 0x6, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x28,
+    0xba, 0x60, 0x0,
+
+    /* U+F048 "" */
+    0x4, 0x30, 0x0, 0x0, 0x31, 0x1f, 0xe0, 0x0,
+    0x6, 0xf9, 0x1f, 0xe0, 0x0, 0x7f, 0xfa, 0x1f,
+    0xe0, 0x9, 0xff, 0xfa, 0x1f, 0xe0, 0xaf, 0xff,
+    0xfa, 0x1f, 0xeb, 0xff, 0xff, 0xfa, 0x1f, 0xff,
+    0xff, 0xff, 0xfa, 0x1f, 0xff, 0xff, 0xff, 0xfa,
+    0x1f, 0xe6, 0xff, 0xff, 0xfa, 0x1f, 0xe0, 0x5f,
+    0xff, 0xfa, 0x1f, 0xe0, 0x4, 0xff, 0xfa, 0x1f,
+    0xe0, 0x0, 0x3e, 0xfa, 0xf, 0xd0, 0x0, 0x2,
+    0xd7, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F04B "" */
+    0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xe6, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe6, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x0, 0xf,
+    0xff, 0xff, 0xfd, 0x40, 0x0, 0x0, 0xff, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0xf, 0xff, 0xa1, 0x0,
+    0x0, 0x0, 0x0, 0x6a, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+F04C "" */
+    0x14, 0x44, 0x20, 0x1, 0x44, 0x42, 0xd, 0xff,
+    0xff, 0x10, 0xdf, 0xff, 0xf1, 0xff, 0xff, 0xf3,
+    0xf, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x40, 0xff,
+    0xff, 0xf4, 0xff, 0xff, 0xf4, 0xf, 0xff, 0xff,
+    0x4f, 0xff, 0xff, 0x40, 0xff, 0xff, 0xf4, 0xff,
+    0xff, 0xf4, 0xf, 0xff, 0xff, 0x4f, 0xff, 0xff,
+    0x40, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xf4, 0xf,
+    0xff, 0xff, 0x4f, 0xff, 0xff, 0x40, 0xff, 0xff,
+    0xf4, 0xff, 0xff, 0xf4, 0xf, 0xff, 0xff, 0x4f,
+    0xff, 0xff, 0x30, 0xff, 0xff, 0xf3, 0x9f, 0xff,
+    0xc0, 0x9, 0xff, 0xfc, 0x0,
+
+    /* U+F04D "" */
+    0x14, 0x44, 0x44, 0x44, 0x44, 0x42, 0xd, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0,
+
+    /* U+F051 "" */
+    0x2, 0x10, 0x0, 0x0, 0x42, 0xf, 0xe2, 0x0,
+    0x3, 0xfb, 0xf, 0xfe, 0x30, 0x4, 0xfb, 0xf,
+    0xff, 0xf4, 0x4, 0xfb, 0xf, 0xff, 0xff, 0x54,
+    0xfb, 0xf, 0xff, 0xff, 0xfa, 0xfb, 0xf, 0xff,
+    0xff, 0xff, 0xfb, 0xf, 0xff, 0xff, 0xff, 0xfb,
+    0xf, 0xff, 0xff, 0xd6, 0xfb, 0xf, 0xff, 0xfd,
+    0x14, 0xfb, 0xf, 0xff, 0xc1, 0x4, 0xfb, 0xf,
+    0xfb, 0x0, 0x4, 0xfb, 0xc, 0xa0, 0x0, 0x3,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F052 "" */
+    0x0, 0x0, 0x0, 0x12, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x2e, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x1, 0xef,
+    0xff, 0xff, 0x40, 0x0, 0x0, 0x1d, 0xff, 0xff,
+    0xff, 0xf3, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
+    0xfe, 0x20, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0x3, 0x99, 0x99, 0x99, 0x99, 0x99, 0x50, 0x5,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf3, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf4, 0xb, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xd1,
+
+    /* U+F053 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0x90, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f,
+    0xfd, 0x10, 0x0, 0x3f, 0xfd, 0x10, 0x0, 0x3f,
+    0xfd, 0x10, 0x0, 0x1f, 0xfd, 0x10, 0x0, 0x0,
+    0xcf, 0xf4, 0x0, 0x0, 0x0, 0xcf, 0xf4, 0x0,
+    0x0, 0x0, 0xcf, 0xf4, 0x0, 0x0, 0x0, 0xcf,
+    0xf4, 0x0, 0x0, 0x0, 0xcf, 0xe0, 0x0, 0x0,
+    0x0, 0xa4, 0x0,
+
+    /* U+F054 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x10, 0x0,
+    0x0, 0x1f, 0xfd, 0x10, 0x0, 0x0, 0x3f, 0xfd,
+    0x10, 0x0, 0x0, 0x3f, 0xfd, 0x10, 0x0, 0x0,
+    0x3f, 0xfd, 0x10, 0x0, 0x0, 0x3f, 0xfd, 0x0,
+    0x0, 0x8, 0xff, 0x90, 0x0, 0x8, 0xff, 0x90,
+    0x0, 0x8, 0xff, 0x90, 0x0, 0x8, 0xff, 0x90,
+    0x0, 0x2, 0xff, 0x90, 0x0, 0x0, 0x7, 0x80,
+    0x0, 0x0, 0x0,
+
+    /* U+F067 "" */
+    0x0, 0x0, 0x4, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7, 0x0, 0x0,
+    0x6, 0x99, 0x9a, 0xff, 0xc9, 0x99, 0x80, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf2, 0x1, 0x11, 0x3f, 0xf7,
+    0x11, 0x10, 0x0, 0x0, 0x3, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xd3, 0x0, 0x0, 0x0,
+
+    /* U+F068 "" */
+    0x69, 0x99, 0x99, 0x99, 0x99, 0x98, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf3, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+F06E "" */
+    0x0, 0x0, 0x1, 0x56, 0x64, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xbf, 0xfe, 0xef, 0xf9, 0x10, 0x0,
+    0x0, 0x7f, 0xfa, 0x10, 0x3, 0xdf, 0xe4, 0x0,
+    0x8, 0xff, 0xa0, 0x9, 0xb4, 0x1e, 0xff, 0x50,
+    0x4f, 0xff, 0x20, 0xb, 0xff, 0x26, 0xff, 0xe1,
+    0xef, 0xff, 0x9, 0xcf, 0xff, 0x63, 0xff, 0xfa,
+    0xbf, 0xff, 0x9, 0xff, 0xff, 0x54, 0xff, 0xf6,
+    0x1e, 0xff, 0x51, 0xdf, 0xfb, 0x9, 0xff, 0xb0,
+    0x3, 0xef, 0xe2, 0x4, 0x30, 0x5f, 0xfc, 0x10,
+    0x0, 0x2c, 0xff, 0x95, 0x6a, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x49, 0xdf, 0xfd, 0x92, 0x0, 0x0,
+
+    /* U+F070 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf5, 0x0, 0x14, 0x66, 0x40,
+    0x0, 0x0, 0x0, 0x4, 0xef, 0xac, 0xff, 0xef,
+    0xff, 0x91, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xa1,
+    0x0, 0x4d, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x9f,
+    0xf5, 0xab, 0x31, 0xef, 0xf4, 0x0, 0x7, 0xb1,
+    0x5, 0xff, 0xff, 0xe1, 0x7f, 0xfe, 0x10, 0xf,
+    0xfe, 0x30, 0x2d, 0xff, 0xf5, 0x4f, 0xff, 0x90,
+    0xc, 0xff, 0xe0, 0x0, 0xaf, 0xf6, 0x5f, 0xff,
+    0x60, 0x2, 0xff, 0xf4, 0x0, 0x6, 0xff, 0xef,
+    0xfb, 0x0, 0x0, 0x4f, 0xfd, 0x10, 0x0, 0x3e,
+    0xff, 0xc0, 0x0, 0x0, 0x2, 0xdf, 0xe8, 0x54,
+    0x1, 0xbf, 0xe3, 0x0, 0x0, 0x0, 0x5, 0xae,
+    0xff, 0x60, 0x7, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xa1,
+
+    /* U+F071 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3e, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfc, 0xcf,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfb, 0x0,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xc0,
+    0xf, 0xff, 0x70, 0x0, 0x0, 0x4, 0xff, 0xfd,
+    0x1, 0xff, 0xff, 0x10, 0x0, 0x0, 0xdf, 0xff,
+    0xe0, 0x2f, 0xff, 0xfa, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0x9b, 0xff, 0xff, 0xf3, 0x0, 0x1f, 0xff,
+    0xff, 0xb0, 0xe, 0xff, 0xff, 0xc0, 0xa, 0xff,
+    0xff, 0xfe, 0x24, 0xff, 0xff, 0xff, 0x60, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x6,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcb, 0x30,
+
+    /* U+F074 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0x80, 0xdd, 0xdb,
+    0x0, 0x0, 0x8d, 0xef, 0xf8, 0xff, 0xff, 0xb0,
+    0x7, 0xff, 0xff, 0xfd, 0x55, 0x6f, 0xf4, 0x6f,
+    0xf8, 0xaf, 0xe2, 0x0, 0x5, 0x74, 0xff, 0x90,
+    0x7e, 0x20, 0x0, 0x0, 0x3f, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xef, 0xb2, 0x50, 0x4a, 0x0,
+    0x1, 0x2e, 0xfd, 0x1d, 0xf4, 0x8f, 0xb0, 0xff,
+    0xff, 0xd1, 0xb, 0xff, 0xff, 0xfb, 0xff, 0xfe,
+    0x20, 0x0, 0xcf, 0xff, 0xfb, 0x12, 0x21, 0x0,
+    0x0, 0x2, 0x9f, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5b, 0x0,
+
+    /* U+F077 "" */
+    0x0, 0x0, 0x7, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x8, 0xff, 0x95, 0xff,
+    0xb0, 0x0, 0x8, 0xff, 0x90, 0x5, 0xff, 0xb0,
+    0x7, 0xff, 0x90, 0x0, 0x5, 0xff, 0xb0, 0x9f,
+    0x90, 0x0, 0x0, 0x5, 0xfd, 0x0, 0x40, 0x0,
+    0x0, 0x0, 0x3, 0x10,
+
+    /* U+F078 "" */
+    0x4c, 0x20, 0x0, 0x0, 0x0, 0xb6, 0xb, 0xfe,
+    0x20, 0x0, 0x0, 0xcf, 0xf0, 0x2e, 0xfe, 0x20,
+    0x0, 0xcf, 0xf4, 0x0, 0x2e, 0xfe, 0x20, 0xcf,
+    0xf4, 0x0, 0x0, 0x2e, 0xfe, 0xcf, 0xf4, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x13, 0x0, 0x0, 0x0,
+
+    /* U+F079 "" */
+    0x0, 0x8, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xf3, 0x8, 0xbb, 0xbb, 0xbb,
+    0x90, 0x0, 0xb, 0xff, 0xff, 0x39, 0xff, 0xff,
+    0xff, 0xf1, 0x0, 0x8f, 0xcf, 0xcf, 0xf0, 0x0,
+    0x0, 0xa, 0xf1, 0x0, 0x38, 0x2f, 0x94, 0x80,
+    0x0, 0x0, 0xa, 0xf1, 0x0, 0x0, 0x2f, 0x90,
+    0x0, 0x0, 0x0, 0xa, 0xf1, 0x0, 0x0, 0x2f,
+    0x90, 0x0, 0x0, 0x3, 0xa, 0xf1, 0x30, 0x0,
+    0x2f, 0x90, 0x0, 0x0, 0x1f, 0xcb, 0xf8, 0xf8,
+    0x0, 0x2f, 0xeb, 0xbb, 0xbb, 0x39, 0xff, 0xff,
+    0xe2, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xb0, 0x9f,
+    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xd1, 0x0,
+
+    /* U+F07B "" */
+    0x37, 0x88, 0x87, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xfd, 0xcc, 0xcc, 0xb6, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf9,
+
+    /* U+F093 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xdd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x1, 0xdf,
+    0xff, 0xfd, 0x10, 0x0, 0x0, 0x1d, 0xff, 0xff,
+    0xff, 0xd1, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x1, 0x1c, 0xff, 0xc1, 0x10,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xc0, 0x0, 0x0, 0x79, 0x99,
+    0x3b, 0xff, 0xb3, 0x99, 0x97, 0xff, 0xff, 0xb2,
+    0x44, 0x2b, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xdd,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0xb3, 0xcf, 0xac, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xca,
+
+    /* U+F095 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xc7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xef, 0xf3, 0x0, 0x0, 0x4a, 0x30, 0x2,
+    0xdf, 0xf8, 0x0, 0x5, 0xdf, 0xfe, 0x15, 0xef,
+    0xfb, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xa2, 0x0, 0x0,
+    0x0, 0x2, 0xba, 0x85, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+F0C4 "" */
+    0x4, 0x86, 0x0, 0x0, 0x0, 0x10, 0x6, 0xff,
+    0xfa, 0x0, 0x2, 0xdf, 0xd1, 0xef, 0x3c, 0xf1,
+    0x1, 0xdf, 0xfa, 0xe, 0xe0, 0xaf, 0x21, 0xdf,
+    0xfa, 0x0, 0x9f, 0xef, 0xf6, 0xdf, 0xfa, 0x0,
+    0x0, 0x8d, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x48, 0xef,
+    0xff, 0xf6, 0x0, 0x0, 0x6f, 0xff, 0xfb, 0xff,
+    0xf6, 0x0, 0xe, 0xf3, 0xcf, 0x23, 0xff, 0xf6,
+    0x0, 0xee, 0xa, 0xf2, 0x4, 0xff, 0xf6, 0x9,
+    0xfe, 0xfc, 0x0, 0x4, 0xff, 0xf1, 0x8, 0xda,
+    0x10, 0x0, 0x2, 0x62, 0x0,
+
+    /* U+F0C5 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xf9, 0x87, 0x0, 0x0, 0x8, 0xff,
+    0xff, 0x98, 0xf7, 0x8, 0xa6, 0x8f, 0xff, 0xf9,
+    0x59, 0x90, 0xff, 0xa8, 0xff, 0xff, 0xfc, 0xcc,
+    0xf, 0xfa, 0x8f, 0xff, 0xff, 0xff, 0xf1, 0xff,
+    0xa8, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xfa, 0x8f,
+    0xff, 0xff, 0xff, 0xf1, 0xff, 0xa8, 0xff, 0xff,
+    0xff, 0xff, 0x1f, 0xfa, 0x8f, 0xff, 0xff, 0xff,
+    0xf1, 0xff, 0xa8, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0xfa, 0x7f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe3,
+    0x12, 0x22, 0x22, 0x21, 0xf, 0xff, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0xac, 0xcc, 0xcc, 0xcb, 0x50,
+    0x0, 0x0,
+
+    /* U+F0C7 "" */
+    0x49, 0x99, 0x99, 0x99, 0x95, 0x0, 0xe, 0xff,
+    0xff, 0xff, 0xff, 0xf6, 0x0, 0xfd, 0x22, 0x22,
+    0x22, 0x4f, 0xf6, 0xf, 0xc0, 0x0, 0x0, 0x1,
+    0xff, 0xf3, 0xfc, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0x6f, 0xc0, 0x0, 0x0, 0x2, 0xff, 0xf6, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0xff, 0xff,
+    0xdc, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xb0, 0x5,
+    0xff, 0xff, 0x6f, 0xff, 0xf6, 0x0, 0xf, 0xff,
+    0xf6, 0xff, 0xff, 0xc0, 0x6, 0xff, 0xff, 0x6f,
+    0xff, 0xff, 0xed, 0xff, 0xff, 0xf6, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x10,
+
+    /* U+F0C9 "" */
+    0xcd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x2f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf3, 0x12, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xde,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F0E0 "" */
+    0x37, 0x88, 0x88, 0x88, 0x88, 0x88, 0x73, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x1c, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc1, 0xd2, 0x8f, 0xff, 0xff,
+    0xff, 0xf8, 0x2d, 0xff, 0x64, 0xef, 0xff, 0xfe,
+    0x45, 0xff, 0xff, 0xfa, 0x2b, 0xff, 0xb2, 0xaf,
+    0xff, 0xff, 0xff, 0xd3, 0x55, 0x3d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf9,
+
+    /* U+F0E7 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xf0, 0x0, 0x4, 0xff, 0xff, 0xd0, 0x0, 0x6,
+    0xff, 0xff, 0x80, 0x0, 0x8, 0xff, 0xff, 0x30,
+    0x0, 0xa, 0xff, 0xff, 0xaa, 0xa6, 0xc, 0xff,
+    0xff, 0xff, 0xf8, 0xe, 0xff, 0xff, 0xff, 0xe1,
+    0xb, 0xdd, 0xdf, 0xff, 0x60, 0x0, 0x0, 0x4f,
+    0xfd, 0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0,
+    0x0, 0xbf, 0xa0, 0x0, 0x0, 0x0, 0xff, 0x10,
+    0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x3,
+    0xc0, 0x0, 0x0,
+
+    /* U+F0EA "" */
+    0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x4, 0x55,
+    0xef, 0xb5, 0x52, 0x0, 0x0, 0xff, 0xfd, 0x1f,
+    0xff, 0xb0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0xff, 0xff, 0x53, 0x33, 0x20, 0x0,
+    0xf, 0xff, 0x97, 0xff, 0xfb, 0x57, 0x0, 0xff,
+    0xf8, 0xaf, 0xff, 0xc6, 0xf8, 0xf, 0xff, 0x8a,
+    0xff, 0xfc, 0x4a, 0xa1, 0xff, 0xf8, 0xaf, 0xff,
+    0xe3, 0x22, 0xf, 0xff, 0x8a, 0xff, 0xff, 0xff,
+    0xf4, 0xff, 0xf8, 0xaf, 0xff, 0xff, 0xff, 0x4f,
+    0xff, 0x8a, 0xff, 0xff, 0xff, 0xf4, 0x35, 0x52,
+    0xaf, 0xff, 0xff, 0xff, 0x40, 0x0, 0xa, 0xff,
+    0xff, 0xff, 0xf4, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xfe, 0x20,
+
+    /* U+F0F3 "" */
+    0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f,
+    0xfa, 0x30, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0x10,
+    0x0, 0x1f, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x5f, 0xff,
+    0xff, 0xff, 0xf9, 0x0, 0x8, 0xff, 0xff, 0xff,
+    0xff, 0xc0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0x20, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x2, 0x22,
+    0x22, 0x22, 0x22, 0x21, 0x0, 0x0, 0x8, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xa2, 0x0,
+    0x0, 0x0,
+
+    /* U+F11C "" */
+    0x5b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xa3,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0xfc, 0xc, 0x30, 0xe1, 0x1d, 0xd, 0x11, 0xfc,
+    0xfc, 0xb, 0x30, 0xe0, 0x1d, 0xd, 0x10, 0xfc,
+    0xff, 0xfe, 0xff, 0xef, 0xfe, 0xfe, 0xef, 0xfc,
+    0xff, 0xf1, 0x5a, 0x8, 0x70, 0xa0, 0x5f, 0xfc,
+    0xff, 0xf3, 0x7b, 0x29, 0x92, 0xc2, 0x7f, 0xfc,
+    0xff, 0xbf, 0xcb, 0xbb, 0xbb, 0xbf, 0xcb, 0xfc,
+    0xfc, 0xb, 0x20, 0x0, 0x0, 0xd, 0x0, 0xfc,
+    0xff, 0xcf, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc, 0xfb,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+
+    /* U+F124 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x18, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x29, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
+    0x4, 0x9a, 0xaa, 0xaf, 0xff, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xb3, 0x0, 0x0, 0x0,
+
+    /* U+F15B "" */
+    0x35, 0x55, 0x55, 0x2, 0x0, 0xf, 0xff, 0xff,
+    0xf2, 0xf4, 0x0, 0xff, 0xff, 0xff, 0x2f, 0xf4,
+    0xf, 0xff, 0xff, 0xf2, 0xff, 0xf3, 0xff, 0xff,
+    0xff, 0x32, 0x22, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x8a, 0xaa, 0xaa,
+    0xaa, 0xaa, 0x30,
+
+    /* U+F1EB "" */
+    0x0, 0x0, 0x0, 0x24, 0x55, 0x31, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xaf, 0xff, 0xff, 0xff, 0xc7,
+    0x0, 0x0, 0x2, 0xbf, 0xff, 0xfe, 0xde, 0xff,
+    0xff, 0xf6, 0x0, 0x5f, 0xff, 0xb5, 0x10, 0x0,
+    0x3, 0x8e, 0xff, 0xb0, 0xdf, 0xd3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf5, 0x18, 0x0, 0x5,
+    0xae, 0xfe, 0xc8, 0x10, 0x4, 0x60, 0x0, 0x2,
+    0xdf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0x95, 0x34, 0x7d, 0xff, 0x40, 0x0,
+    0x0, 0x2, 0xa2, 0x0, 0x0, 0x0, 0x77, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x96, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xda, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F240 "" */
+    0x5b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xba,
+    0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0xfc, 0x12, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0xf, 0xf7, 0xfc, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x2c, 0xfa, 0xfc, 0x5f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x21, 0xfa, 0xfc, 0x5f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x27, 0xfa, 0xfc, 0x26,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x1f, 0xfa, 0xfe,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xb1,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+F241 "" */
+    0x5b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xba,
+    0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0xfc, 0x12, 0x22, 0x22, 0x22, 0x21,
+    0x0, 0xf, 0xf7, 0xfc, 0x5f, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0xc, 0xfa, 0xfc, 0x5f, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x1, 0xfa, 0xfc, 0x5f, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x7, 0xfa, 0xfc, 0x26,
+    0x66, 0x66, 0x66, 0x63, 0x0, 0xf, 0xfa, 0xfe,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xb1,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+F242 "" */
+    0x5b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xba,
+    0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0xfc, 0x12, 0x22, 0x22, 0x10, 0x0,
+    0x0, 0xf, 0xf7, 0xfc, 0x5f, 0xff, 0xff, 0xd0,
+    0x0, 0x0, 0xc, 0xfa, 0xfc, 0x5f, 0xff, 0xff,
+    0xd0, 0x0, 0x0, 0x1, 0xfa, 0xfc, 0x5f, 0xff,
+    0xff, 0xd0, 0x0, 0x0, 0x7, 0xfa, 0xfc, 0x26,
+    0x66, 0x66, 0x50, 0x0, 0x0, 0xf, 0xfa, 0xfe,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xb1,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+F243 "" */
+    0x5b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xba,
+    0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0xfc, 0x12, 0x22, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xf7, 0xfc, 0x5f, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0xc, 0xfa, 0xfc, 0x5f, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x1, 0xfa, 0xfc, 0x5f, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x7, 0xfa, 0xfc, 0x26,
+    0x66, 0x10, 0x0, 0x0, 0x0, 0xf, 0xfa, 0xfe,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xb1,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+F244 "" */
+    0x5b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xba,
+    0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xf7, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xfa, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xfa, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa, 0xfe,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xb1,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+F287 "" */
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xb2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xdf, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa9, 0x3d, 0xf5,
+    0x0, 0x0, 0x0, 0x4, 0x40, 0x2, 0xe0, 0x0,
+    0x10, 0x0, 0x0, 0x0, 0xaf, 0xf8, 0xb, 0x60,
+    0x0, 0x0, 0x0, 0x6c, 0x30, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xaf, 0xf9,
+    0x0, 0xc, 0x50, 0x0, 0x0, 0x6d, 0x40, 0x5,
+    0x50, 0x0, 0x4, 0xc0, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc4, 0x3e, 0xe8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xef, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+F293 "" */
+    0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x7,
+    0xef, 0xff, 0xb3, 0x0, 0x0, 0xaf, 0xfd, 0x8f,
+    0xff, 0x20, 0x4, 0xff, 0xfd, 0x9, 0xff, 0xb0,
+    0xa, 0xfe, 0xfd, 0x12, 0xaf, 0xf0, 0xe, 0xf5,
+    0x5d, 0x2c, 0xe, 0xf3, 0xf, 0xff, 0x33, 0x12,
+    0x9f, 0xf5, 0xf, 0xff, 0xf3, 0x7, 0xff, 0xf6,
+    0xf, 0xff, 0xe2, 0x6, 0xff, 0xf6, 0xf, 0xfe,
+    0x24, 0x13, 0x7f, 0xf5, 0xd, 0xf5, 0x7d, 0x2c,
+    0xd, 0xf3, 0xa, 0xff, 0xfd, 0x11, 0xbf, 0xf0,
+    0x3, 0xff, 0xfe, 0xb, 0xff, 0xa0, 0x0, 0x7f,
+    0xfe, 0xbf, 0xfe, 0x10, 0x0, 0x3, 0xac, 0xdc,
+    0x81, 0x0,
+
+    /* U+F2ED "" */
+    0x0, 0x0, 0x34, 0x43, 0x0, 0x0, 0x5, 0x66,
+    0x7f, 0xff, 0xf9, 0x66, 0x50, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x35, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x50, 0x1c, 0xcc, 0xcc, 0xcc, 0xcc, 0xc4,
+    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x2f,
+    0xf3, 0xfb, 0x7f, 0x6d, 0xf6, 0x2, 0xff, 0x2f,
+    0xb7, 0xf5, 0xdf, 0x60, 0x2f, 0xf2, 0xfb, 0x7f,
+    0x5d, 0xf6, 0x2, 0xff, 0x2f, 0xb7, 0xf5, 0xdf,
+    0x60, 0x2f, 0xf2, 0xfb, 0x7f, 0x5d, 0xf6, 0x2,
+    0xff, 0x2f, 0xb7, 0xf5, 0xdf, 0x60, 0x2f, 0xf3,
+    0xfb, 0x7f, 0x6d, 0xf6, 0x1, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x50, 0x7, 0xbc, 0xcc, 0xcc, 0xcc,
+    0x90, 0x0,
+
+    /* U+F304 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x4, 0x39, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0x39, 0xff, 0xa0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0x39, 0xb0, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x4, 0xff,
+    0xff, 0xff, 0xb0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0xd, 0xff, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xa8, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+F55A "" */
+    0x0, 0x0, 0x17, 0x88, 0x88, 0x88, 0x88, 0x87,
+    0x40, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf4, 0x0, 0x3e, 0xff, 0xff, 0xcf, 0xff,
+    0xcf, 0xff, 0xf7, 0x3, 0xef, 0xff, 0xf9, 0x8,
+    0xf8, 0x9, 0xff, 0xf8, 0x3e, 0xff, 0xff, 0xfe,
+    0x20, 0x40, 0x2e, 0xff, 0xf8, 0xdf, 0xff, 0xff,
+    0xff, 0xe1, 0x1, 0xef, 0xff, 0xf8, 0x9f, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x8f, 0xff, 0xf8, 0x9,
+    0xff, 0xff, 0xf9, 0x2, 0xc2, 0x9, 0xff, 0xf8,
+    0x0, 0x9f, 0xff, 0xfe, 0x4e, 0xfe, 0x4e, 0xff,
+    0xf8, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc1,
+
+    /* U+F7C2 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef,
+    0xff, 0xff, 0xe2, 0x3, 0xfb, 0xfb, 0xce, 0xbf,
+    0xa4, 0xff, 0x1d, 0x3, 0xa1, 0xfa, 0xff, 0xf1,
+    0xd0, 0x3a, 0x1f, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x29, 0xaa, 0xaa,
+    0xaa, 0xa8, 0x0,
+
+    /* U+F8A2 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf1, 0x0,
+    0x8, 0x20, 0x0, 0x0, 0x1, 0xff, 0x10, 0xb,
+    0xf7, 0x0, 0x0, 0x0, 0x2f, 0xf1, 0xc, 0xff,
+    0x94, 0x44, 0x44, 0x45, 0xff, 0x1b, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf1, 0x8f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x0, 0x7f, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+FF08 "（" */
+    0x0, 0x0, 0x20, 0x0, 0x61, 0x0, 0x81, 0x0,
+    0x46, 0x0, 0xb, 0x10, 0x0, 0xc0, 0x0, 0xc,
+    0x0, 0x0, 0xb0, 0x0, 0x4, 0x60, 0x0, 0x8,
+    0x20, 0x0, 0x6, 0x20, 0x0, 0x1,
+
+    /* U+FF09 "）" */
+    0x30, 0x0, 0x1, 0x70, 0x0, 0x1, 0x90, 0x0,
+    0x6, 0x60, 0x0, 0xc, 0x0, 0x0, 0xd0, 0x0,
+    0xd, 0x0, 0x0, 0xc0, 0x0, 0x66, 0x0, 0x2a,
+    0x0, 0x27, 0x0, 0x2, 0x0, 0x0,
+
+    /* U+FF0C "，" */
+    0x1, 0x0, 0xfc, 0x7, 0xb0, 0x63, 0x3, 0x0,
+
+    /* U+FF11 "１" */
+    0x0, 0x23, 0x0, 0x5, 0xd6, 0x0, 0x0, 0x86,
+    0x0, 0x0, 0x86, 0x0, 0x0, 0x86, 0x0, 0x0,
+    0x86, 0x0, 0x0, 0x86, 0x0, 0x0, 0x86, 0x0,
+    0x0, 0x96, 0x0, 0x14, 0x66, 0x40,
+
+    /* U+FF12 "２" */
+    0x0, 0x0, 0x0, 0x7, 0x67, 0x91, 0x87, 0x0,
+    0x99, 0x69, 0x0, 0x8b, 0x0, 0x0, 0xd5, 0x0,
+    0x6, 0x80, 0x0, 0x39, 0x0, 0x2, 0x90, 0x0,
+    0x19, 0x0, 0x3, 0xab, 0xaa, 0xb4, 0x12, 0x22,
+    0x20
+};
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 112, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 112, .box_w = 3, .box_h = 10, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 15, .adv_w = 112, .box_w = 6, .box_h = 4, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 27, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 62, .adv_w = 112, .box_w = 6, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 104, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 143, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 178, .adv_w = 112, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 184, .adv_w = 112, .box_w = 4, .box_h = 15, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 214, .adv_w = 112, .box_w = 4, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 244, .adv_w = 112, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 272, .adv_w = 112, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 304, .adv_w = 112, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 310, .adv_w = 112, .box_w = 7, .box_h = 1, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 314, .adv_w = 112, .box_w = 3, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 317, .adv_w = 112, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 366, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 401, .adv_w = 112, .box_w = 5, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 426, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 461, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 496, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 531, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 566, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 601, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 636, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 671, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 706, .adv_w = 112, .box_w = 3, .box_h = 7, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 717, .adv_w = 112, .box_w = 3, .box_h = 9, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 731, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 770, .adv_w = 112, .box_w = 7, .box_h = 4, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 784, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 823, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 858, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 893, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 928, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 963, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 998, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1033, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1068, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1103, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1138, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1173, .adv_w = 112, .box_w = 5, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1198, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1240, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1275, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1310, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1345, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1380, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1415, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1450, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1489, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1524, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1559, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1594, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1629, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1664, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1699, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1734, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1769, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1804, .adv_w = 112, .box_w = 5, .box_h = 14, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 1839, .adv_w = 112, .box_w = 6, .box_h = 13, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1878, .adv_w = 112, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1913, .adv_w = 112, .box_w = 5, .box_h = 2, .ofs_x = 1, .ofs_y = 10},
+    {.bitmap_index = 1918, .adv_w = 112, .box_w = 7, .box_h = 1, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1922, .adv_w = 112, .box_w = 3, .box_h = 2, .ofs_x = 1, .ofs_y = 10},
+    {.bitmap_index = 1925, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1950, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1989, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2014, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2053, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2078, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2113, .adv_w = 112, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2145, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2184, .adv_w = 112, .box_w = 5, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2209, .adv_w = 112, .box_w = 5, .box_h = 12, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 2239, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2278, .adv_w = 112, .box_w = 5, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2306, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2331, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2356, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2381, .adv_w = 112, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2413, .adv_w = 112, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2445, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2470, .adv_w = 112, .box_w = 5, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2488, .adv_w = 112, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2515, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2540, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2565, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2590, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2615, .adv_w = 112, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2647, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2672, .adv_w = 112, .box_w = 4, .box_h = 14, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 2700, .adv_w = 112, .box_w = 1, .box_h = 15, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 2708, .adv_w = 112, .box_w = 4, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 2736, .adv_w = 112, .box_w = 7, .box_h = 3, .ofs_x = 0, .ofs_y = 10},
+    {.bitmap_index = 2747, .adv_w = 112, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2747, .adv_w = 224, .box_w = 4, .box_h = 5, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2757, .adv_w = 224, .box_w = 4, .box_h = 5, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 2767, .adv_w = 224, .box_w = 8, .box_h = 11, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 2811, .adv_w = 224, .box_w = 4, .box_h = 12, .ofs_x = 8, .ofs_y = -1},
+    {.bitmap_index = 2835, .adv_w = 224, .box_w = 4, .box_h = 12, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 2859, .adv_w = 224, .box_w = 8, .box_h = 9, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 2895, .adv_w = 224, .box_w = 10, .box_h = 12, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 2955, .adv_w = 224, .box_w = 8, .box_h = 7, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 2983, .adv_w = 224, .box_w = 10, .box_h = 9, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3028, .adv_w = 224, .box_w = 8, .box_h = 12, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 3076, .adv_w = 224, .box_w = 8, .box_h = 9, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 3112, .adv_w = 224, .box_w = 10, .box_h = 12, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 3172, .adv_w = 224, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3238, .adv_w = 224, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3304, .adv_w = 224, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3370, .adv_w = 224, .box_w = 8, .box_h = 12, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 3418, .adv_w = 224, .box_w = 11, .box_h = 12, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 3484, .adv_w = 224, .box_w = 6, .box_h = 12, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 3520, .adv_w = 224, .box_w = 9, .box_h = 12, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 3574, .adv_w = 224, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3646, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3731, .adv_w = 224, .box_w = 9, .box_h = 10, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3776, .adv_w = 224, .box_w = 11, .box_h = 11, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3837, .adv_w = 224, .box_w = 8, .box_h = 11, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 3881, .adv_w = 224, .box_w = 11, .box_h = 13, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 3953, .adv_w = 224, .box_w = 8, .box_h = 12, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 4001, .adv_w = 224, .box_w = 8, .box_h = 12, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 4049, .adv_w = 224, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 4121, .adv_w = 224, .box_w = 14, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4205, .adv_w = 224, .box_w = 11, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4260, .adv_w = 224, .box_w = 13, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4332, .adv_w = 224, .box_w = 10, .box_h = 12, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 4392, .adv_w = 224, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 4464, .adv_w = 224, .box_w = 10, .box_h = 12, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 4524, .adv_w = 224, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4590, .adv_w = 224, .box_w = 10, .box_h = 11, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4645, .adv_w = 224, .box_w = 9, .box_h = 7, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4677, .adv_w = 224, .box_w = 11, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4727, .adv_w = 224, .box_w = 12, .box_h = 10, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 4787, .adv_w = 224, .box_w = 10, .box_h = 10, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4837, .adv_w = 224, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 4903, .adv_w = 224, .box_w = 8, .box_h = 12, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 4951, .adv_w = 224, .box_w = 11, .box_h = 11, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5012, .adv_w = 224, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 5078, .adv_w = 224, .box_w = 10, .box_h = 9, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5123, .adv_w = 224, .box_w = 12, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5183, .adv_w = 224, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 5255, .adv_w = 224, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5316, .adv_w = 224, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 5382, .adv_w = 224, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 5454, .adv_w = 224, .box_w = 13, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5526, .adv_w = 224, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 5592, .adv_w = 224, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 5664, .adv_w = 224, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 5736, .adv_w = 224, .box_w = 10, .box_h = 10, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5786, .adv_w = 224, .box_w = 12, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5846, .adv_w = 224, .box_w = 11, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5901, .adv_w = 224, .box_w = 12, .box_h = 8, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 5949, .adv_w = 224, .box_w = 12, .box_h = 9, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 6003, .adv_w = 224, .box_w = 12, .box_h = 9, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 6057, .adv_w = 224, .box_w = 10, .box_h = 11, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 6112, .adv_w = 224, .box_w = 13, .box_h = 11, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 6184, .adv_w = 224, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 6250, .adv_w = 224, .box_w = 8, .box_h = 12, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 6298, .adv_w = 224, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6359, .adv_w = 224, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 6420, .adv_w = 224, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 6481, .adv_w = 224, .box_w = 8, .box_h = 12, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 6529, .adv_w = 224, .box_w = 10, .box_h = 9, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 6574, .adv_w = 224, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 6640, .adv_w = 224, .box_w = 8, .box_h = 8, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 6672, .adv_w = 224, .box_w = 11, .box_h = 11, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 6733, .adv_w = 224, .box_w = 7, .box_h = 8, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 6761, .adv_w = 224, .box_w = 8, .box_h = 10, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 6801, .adv_w = 224, .box_w = 8, .box_h = 12, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 6849, .adv_w = 224, .box_w = 7, .box_h = 12, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 6891, .adv_w = 224, .box_w = 9, .box_h = 11, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 6941, .adv_w = 224, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 7013, .adv_w = 224, .box_w = 10, .box_h = 11, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 7068, .adv_w = 224, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 7140, .adv_w = 224, .box_w = 10, .box_h = 12, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 7200, .adv_w = 224, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 7261, .adv_w = 224, .box_w = 8, .box_h = 9, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 7297, .adv_w = 224, .box_w = 10, .box_h = 12, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 7357, .adv_w = 224, .box_w = 8, .box_h = 10, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 7397, .adv_w = 224, .box_w = 9, .box_h = 12, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 7451, .adv_w = 224, .box_w = 10, .box_h = 12, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 7511, .adv_w = 224, .box_w = 9, .box_h = 6, .ofs_x = 2, .ofs_y = 1},
+    {.bitmap_index = 7538, .adv_w = 224, .box_w = 11, .box_h = 8, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 7582, .adv_w = 224, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 7648, .adv_w = 224, .box_w = 10, .box_h = 11, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 7703, .adv_w = 224, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 7775, .adv_w = 224, .box_w = 10, .box_h = 12, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 7835, .adv_w = 224, .box_w = 11, .box_h = 12, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 7901, .adv_w = 224, .box_w = 9, .box_h = 12, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 7955, .adv_w = 224, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 8021, .adv_w = 224, .box_w = 10, .box_h = 11, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 8076, .adv_w = 224, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 8142, .adv_w = 224, .box_w = 9, .box_h = 8, .ofs_x = 2, .ofs_y = 1},
+    {.bitmap_index = 8178, .adv_w = 224, .box_w = 12, .box_h = 10, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 8238, .adv_w = 224, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 8304, .adv_w = 224, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 8382, .adv_w = 224, .box_w = 11, .box_h = 10, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 8437, .adv_w = 224, .box_w = 11, .box_h = 11, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8498, .adv_w = 224, .box_w = 11, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8553, .adv_w = 224, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8619, .adv_w = 224, .box_w = 11, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8674, .adv_w = 224, .box_w = 13, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8746, .adv_w = 224, .box_w = 8, .box_h = 11, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 8790, .adv_w = 224, .box_w = 10, .box_h = 12, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 8850, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 8935, .adv_w = 224, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 9001, .adv_w = 224, .box_w = 8, .box_h = 8, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 9033, .adv_w = 224, .box_w = 10, .box_h = 11, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 9088, .adv_w = 224, .box_w = 10, .box_h = 11, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 9143, .adv_w = 224, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 9215, .adv_w = 224, .box_w = 6, .box_h = 11, .ofs_x = 5, .ofs_y = -1},
+    {.bitmap_index = 9248, .adv_w = 224, .box_w = 8, .box_h = 11, .ofs_x = 5, .ofs_y = -1},
+    {.bitmap_index = 9292, .adv_w = 224, .box_w = 10, .box_h = 11, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 9347, .adv_w = 224, .box_w = 12, .box_h = 7, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 9389, .adv_w = 224, .box_w = 10, .box_h = 12, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 9449, .adv_w = 224, .box_w = 10, .box_h = 10, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9499, .adv_w = 224, .box_w = 12, .box_h = 7, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 9541, .adv_w = 224, .box_w = 12, .box_h = 10, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 9601, .adv_w = 224, .box_w = 12, .box_h = 10, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 9661, .adv_w = 224, .box_w = 8, .box_h = 10, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 9701, .adv_w = 224, .box_w = 9, .box_h = 10, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 9746, .adv_w = 224, .box_w = 10, .box_h = 10, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 9796, .adv_w = 224, .box_w = 10, .box_h = 10, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9846, .adv_w = 224, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9924, .adv_w = 224, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 10002, .adv_w = 224, .box_w = 12, .box_h = 9, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 10056, .adv_w = 224, .box_w = 12, .box_h = 10, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 10116, .adv_w = 224, .box_w = 10, .box_h = 10, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 10166, .adv_w = 224, .box_w = 11, .box_h = 12, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 10232, .adv_w = 224, .box_w = 10, .box_h = 11, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 10287, .adv_w = 224, .box_w = 10, .box_h = 8, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 10327, .adv_w = 224, .box_w = 6, .box_h = 11, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 10360, .adv_w = 224, .box_w = 10, .box_h = 10, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 10410, .adv_w = 224, .box_w = 10, .box_h = 11, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 10465, .adv_w = 224, .box_w = 11, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 10515, .adv_w = 224, .box_w = 10, .box_h = 8, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 10555, .adv_w = 224, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 10616, .adv_w = 224, .box_w = 10, .box_h = 6, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 10646, .adv_w = 224, .box_w = 8, .box_h = 7, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 10674, .adv_w = 224, .box_w = 9, .box_h = 10, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 10719, .adv_w = 224, .box_w = 10, .box_h = 11, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 10774, .adv_w = 224, .box_w = 7, .box_h = 11, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 10813, .adv_w = 224, .box_w = 12, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 10867, .adv_w = 224, .box_w = 8, .box_h = 9, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 10903, .adv_w = 224, .box_w = 9, .box_h = 8, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 10939, .adv_w = 224, .box_w = 10, .box_h = 11, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 10994, .adv_w = 224, .box_w = 10, .box_h = 9, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 11039, .adv_w = 224, .box_w = 8, .box_h = 8, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 11071, .adv_w = 224, .box_w = 14, .box_h = 3, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 11092, .adv_w = 224, .box_w = 14, .box_h = 2, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 11106, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 11197, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 11282, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 11380, .adv_w = 224, .box_w = 14, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 11464, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 11555, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 11640, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 11738, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 11836, .adv_w = 224, .box_w = 14, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 11920, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 12018, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 12116, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 12207, .adv_w = 224, .box_w = 11, .box_h = 14, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 12284, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 12375, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 12473, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 12564, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 12662, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 12747, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 12845, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 12943, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 13034, .adv_w = 224, .box_w = 11, .box_h = 14, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 13111, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 13196, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 13294, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 13392, .adv_w = 224, .box_w = 14, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13462, .adv_w = 224, .box_w = 14, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 13546, .adv_w = 224, .box_w = 14, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 13630, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 13721, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 13819, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 13910, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 14008, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 14106, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 14204, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 14302, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 14400, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 14498, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 14596, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 14694, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 14792, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 14890, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 14988, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 15072, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 15170, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 15268, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 15366, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 15464, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 15555, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 15653, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 15751, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 15849, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 15947, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 16045, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 16143, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 16241, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 16339, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 16430, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 16528, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 16626, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 16724, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 16822, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 16920, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 17018, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 17116, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 17214, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 17305, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 17403, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 17501, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 17599, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 17697, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 17795, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 17893, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 17991, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 18089, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 18180, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 18278, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 18376, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 18474, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 18572, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 18670, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 18768, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 18866, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 18964, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 19062, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 19160, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 19258, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 19356, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 19454, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 19552, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 19650, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 19748, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 19846, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 19944, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 20029, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 20120, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 20211, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 20309, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 20407, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 20505, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 20603, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 20701, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 20792, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 20890, .adv_w = 224, .box_w = 14, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 20974, .adv_w = 224, .box_w = 11, .box_h = 14, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 21051, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 21149, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 21240, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 21338, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 21436, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 21534, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 21632, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 21730, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 21828, .adv_w = 224, .box_w = 11, .box_h = 14, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 21905, .adv_w = 224, .box_w = 11, .box_h = 13, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 21977, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 22068, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 22166, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 22257, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 22348, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 22446, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 22544, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 22642, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 22740, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 22838, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 22922, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 23020, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 23118, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 23216, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 23314, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 23412, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 23510, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 23608, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 23699, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 23797, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 23888, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 23986, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 24084, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 24182, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 24273, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 24371, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 24462, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 24560, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 24658, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 24756, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 24847, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 24938, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 25036, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 25134, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 25232, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 25330, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 25421, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 25519, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 25617, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 25715, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 25813, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 25911, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 26009, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 26100, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 26198, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 26296, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 26394, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 26478, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 26576, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 26674, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 26772, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 26870, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 26968, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 27066, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 27164, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 27262, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 27360, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 27444, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 27542, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 27640, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 27731, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 27822, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 27913, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 28011, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 28109, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 28200, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 28291, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 28389, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 28487, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 28585, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 28683, .adv_w = 224, .box_w = 11, .box_h = 11, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 28744, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 28842, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 28940, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 29031, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 29115, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 29199, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 29290, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 29374, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 29465, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 29550, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 29641, .adv_w = 224, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 29719, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 29804, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 29902, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 30000, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 30084, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 30169, .adv_w = 224, .box_w = 11, .box_h = 14, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 30246, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 30337, .adv_w = 224, .box_w = 13, .box_h = 12, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 30415, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 30500, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 30591, .adv_w = 224, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 30669, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 30760, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 30851, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 30942, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 31040, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 31138, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 31229, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 31313, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 31397, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 31482, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 31580, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 31665, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 31756, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 31847, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 31938, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 32029, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 32120, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 32211, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 32309, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 32400, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 32491, .adv_w = 224, .box_w = 13, .box_h = 12, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 32569, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 32660, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 32758, .adv_w = 224, .box_w = 11, .box_h = 14, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 32835, .adv_w = 224, .box_w = 11, .box_h = 13, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 32907, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 32998, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 33082, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 33166, .adv_w = 224, .box_w = 11, .box_h = 14, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 33243, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 33327, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 33418, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 33502, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 33586, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 33677, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 33768, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 33866, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 33957, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 34055, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 34153, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 34244, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 34335, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 34433, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 34531, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 34629, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 34727, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 34825, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 34923, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 35021, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 35119, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 35217, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 35315, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 35413, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 35504, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 35595, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 35686, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 35777, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 35875, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 35973, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 36064, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 36155, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 36239, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 36337, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 36435, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 36533, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 36631, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 36729, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 36827, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 36925, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 37023, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 37121, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 37219, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 37317, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 37415, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 37513, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 37611, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 37709, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 37807, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 37905, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 38003, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 38101, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 38192, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 38290, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 38388, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 38486, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 38584, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 38682, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 38780, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 38878, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 38976, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 39074, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 39172, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 39270, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 39368, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 39466, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 39564, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 39655, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 39753, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 39851, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 39949, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 40040, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 40131, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 40222, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 40313, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 40411, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 40509, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 40600, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 40691, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 40782, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 40880, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 40971, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 41069, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 41167, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 41265, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 41356, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 41454, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 41552, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 41650, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 41741, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 41839, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 41923, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 42021, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 42112, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 42210, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 42308, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 42399, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 42497, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 42595, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 42693, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 42791, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 42882, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 42980, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 43078, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 43162, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 43253, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 43337, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 43435, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 43533, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 43624, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 43715, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 43806, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 43897, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 43995, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 44093, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 44191, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 44282, .adv_w = 224, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 44360, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 44451, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 44549, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 44640, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 44731, .adv_w = 224, .box_w = 14, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 44815, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 44900, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 44998, .adv_w = 224, .box_w = 13, .box_h = 12, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 45076, .adv_w = 224, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 45148, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 45239, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 45337, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 45428, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 45526, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 45617, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 45715, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 45813, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 45911, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 46009, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 46107, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 46198, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 46289, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 46387, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 46485, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 46583, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 46681, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 46772, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 46870, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 46968, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 47066, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 47164, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 47262, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 47360, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 47451, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 47549, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 47647, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 47745, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 47843, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 47941, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 48039, .adv_w = 224, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 48116, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 48207, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 48298, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 48396, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 48487, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 48571, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 48669, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 48767, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 48865, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 48963, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 49061, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 49159, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 49257, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 49355, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 49453, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 49551, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 49649, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 49747, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 49845, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 49943, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 50041, .adv_w = 224, .box_w = 14, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 50125, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 50210, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 50301, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 50399, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 50497, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 50595, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 50693, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 50784, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 50875, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 50973, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 51064, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 51162, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 51247, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 51332, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 51423, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 51521, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 51612, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 51703, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 51788, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 51879, .adv_w = 224, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 51957, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 52041, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 52139, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 52224, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 52322, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 52407, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 52505, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 52603, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 52694, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 52792, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 52890, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 52988, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 53086, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 53184, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 53282, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 53380, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 53478, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 53576, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 53674, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 53772, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 53863, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 53961, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 54059, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 54157, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 54255, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 54353, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 54451, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 54549, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 54640, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 54738, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 54836, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 54934, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 55032, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 55130, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 55221, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 55319, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 55417, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 55515, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 55613, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 55711, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 55809, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 55907, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 56005, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 56103, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 56201, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 56299, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 56397, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 56495, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 56593, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 56691, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 56789, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 56887, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 56985, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 57083, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 57181, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 57279, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 57377, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 57468, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 57566, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 57664, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 57762, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 57860, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 57958, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 58056, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 58154, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 58252, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 58350, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 58448, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 58546, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 58644, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 58742, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 58840, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 58938, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 59036, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 59134, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 59232, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 59330, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 59428, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 59519, .adv_w = 224, .box_w = 9, .box_h = 13, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 59578, .adv_w = 224, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 59656, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 59747, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 59838, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 59936, .adv_w = 224, .box_w = 11, .box_h = 14, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 60013, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 60097, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 60195, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 60286, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 60377, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 60475, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 60566, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 60664, .adv_w = 224, .box_w = 14, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 60748, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 60839, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 60930, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 61021, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 61119, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 61210, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 61294, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 61379, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 61477, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 61568, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 61659, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 61750, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 61841, .adv_w = 224, .box_w = 11, .box_h = 14, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 61918, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 62016, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 62107, .adv_w = 224, .box_w = 10, .box_h = 14, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 62177, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 62261, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 62359, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 62457, .adv_w = 224, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 62534, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 62632, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 62717, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 62808, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 62906, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 63004, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 63102, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 63200, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 63298, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 63396, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 63494, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 63592, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 63690, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 63788, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 63886, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 63984, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 64082, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 64180, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 64271, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 64369, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 64467, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 64565, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 64663, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 64761, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 64852, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 64950, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 65048, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 65146, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 65244, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 65342, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 65440, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 65538, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 65636, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 65734, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 65832, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 65930, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 66028, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 66126, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 66224, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 66322, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 66420, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 66518, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 66616, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 66714, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 66812, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 66910, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 67008, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 67106, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 67204, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 67302, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 67400, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 67498, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 67596, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 67694, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 67792, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 67890, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 67988, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 68086, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 68184, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 68282, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 68373, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 68464, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 68555, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 68653, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 68744, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 68842, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 68940, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 69038, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 69136, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 69234, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 69332, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 69430, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 69528, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 69626, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 69724, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 69822, .adv_w = 224, .box_w = 12, .box_h = 13, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 69900, .adv_w = 224, .box_w = 14, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 69984, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 70068, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 70159, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 70257, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 70355, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 70453, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 70551, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 70649, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 70747, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 70845, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 70936, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 71034, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 71132, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 71230, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 71321, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 71419, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 71517, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 71608, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 71706, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 71804, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 71895, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 71993, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 72091, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 72189, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 72287, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 72385, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 72483, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 72581, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 72679, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 72777, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 72875, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 72973, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 73064, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 73162, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 73253, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 73344, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 73442, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 73540, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 73638, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 73736, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 73834, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 73932, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 74023, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 74114, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 74212, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 74310, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 74408, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 74506, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 74604, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 74702, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 74800, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 74898, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 74996, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 75094, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 75192, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 75290, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 75381, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 75479, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 75570, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 75668, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 75766, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 75864, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 75955, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 76046, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 76137, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 76228, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 76319, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 76410, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 76508, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 76606, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 76704, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 76802, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 76893, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 76991, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 77089, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 77187, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 77285, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 77383, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 77481, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 77579, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 77677, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 77768, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 77866, .adv_w = 224, .box_w = 14, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 77950, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 78041, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 78139, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 78237, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 78328, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 78419, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 78510, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 78601, .adv_w = 224, .box_w = 10, .box_h = 12, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 78661, .adv_w = 224, .box_w = 11, .box_h = 14, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 78738, .adv_w = 224, .box_w = 10, .box_h = 14, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 78808, .adv_w = 224, .box_w = 12, .box_h = 13, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 78886, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 78970, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 79055, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 79140, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 79238, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 79329, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 79420, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 79518, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 79609, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 79700, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 79798, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 79889, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 79987, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 80085, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 80176, .adv_w = 224, .box_w = 11, .box_h = 14, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 80253, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 80344, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 80435, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 80519, .adv_w = 224, .box_w = 14, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 80589, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 80680, .adv_w = 224, .box_w = 9, .box_h = 13, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 80739, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 80830, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 80921, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 81019, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 81117, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 81208, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 81292, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 81390, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 81488, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 81586, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 81677, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 81775, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 81873, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 81971, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 82069, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 82167, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 82265, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 82363, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 82461, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 82559, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 82657, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 82755, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 82853, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 82951, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 83049, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 83147, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 83245, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 83343, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 83441, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 83539, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 83637, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 83735, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 83833, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 83931, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 84029, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 84120, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 84211, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 84309, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 84394, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 84492, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 84590, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 84688, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 84786, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 84884, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 84982, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 85080, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 85178, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 85276, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 85374, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 85472, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 85570, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 85661, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 85759, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 85857, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 85955, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 86046, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 86137, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 86235, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 86333, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 86431, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 86529, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 86627, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 86725, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 86823, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 86914, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 87012, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 87110, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 87208, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 87306, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 87404, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 87502, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 87600, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 87698, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 87796, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 87894, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 87992, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 88090, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 88188, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 88286, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 88384, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 88475, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 88573, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 88671, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 88769, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 88867, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 88965, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 89056, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 89154, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 89252, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 89350, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 89448, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 89532, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 89630, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 89728, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 89826, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 89924, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 90022, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 90106, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 90204, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 90302, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 90400, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 90498, .adv_w = 224, .box_w = 11, .box_h = 14, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 90575, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 90666, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 90764, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 90855, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 90946, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 91037, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 91128, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 91226, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 91324, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 91422, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 91520, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 91618, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 91716, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 91814, .adv_w = 224, .box_w = 9, .box_h = 14, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 91877, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 91968, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 92066, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 92164, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 92255, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 92353, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 92451, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 92549, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 92647, .adv_w = 224, .box_w = 11, .box_h = 14, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 92724, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 92815, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 92913, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 93011, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 93109, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 93207, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 93305, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 93403, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 93501, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 93599, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 93697, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 93795, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 93893, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 93984, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 94082, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 94180, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 94278, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 94376, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 94474, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 94572, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 94670, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 94768, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 94866, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 94964, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 95062, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 95160, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 95258, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 95356, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 95454, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 95539, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 95630, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 95728, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 95826, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 95924, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 96015, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 96113, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 96211, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 96309, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 96400, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 96498, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 96596, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 96687, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 96785, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 96883, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 96981, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 97079, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 97177, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 97275, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 97373, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 97471, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 97569, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 97667, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 97765, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 97863, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 97961, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 98059, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 98157, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 98255, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 98353, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 98451, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 98549, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 98647, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 98745, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 98843, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 98941, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 99039, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 99137, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 99235, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 99333, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 99431, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 99529, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 99620, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 99718, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 99816, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 99914, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 100012, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 100110, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 100201, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 100299, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 100397, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 100495, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 100593, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 100691, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 100782, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 100866, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 100964, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 101055, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 101153, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 101244, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 101328, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 101419, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 101503, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 101587, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 101671, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 101755, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 101846, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 101944, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 102035, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 102133, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 102231, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 102329, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 102427, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 102525, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 102623, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 102721, .adv_w = 224, .box_w = 14, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 102805, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 102903, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 102994, .adv_w = 224, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 103099, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 103197, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 103295, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 103393, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 103491, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 103589, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 103687, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 103785, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 103883, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 103974, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 104072, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 104170, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 104261, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 104359, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 104457, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 104548, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 104646, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 104744, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 104835, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 104933, .adv_w = 224, .box_w = 14, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 105017, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 105115, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 105213, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 105311, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 105402, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 105500, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 105598, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 105696, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 105794, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 105885, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 105983, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 106081, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 106179, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 106277, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 106375, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 106466, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 106564, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 106655, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 106753, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 106851, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 106949, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 107047, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 107145, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 107243, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 107341, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 107439, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 107530, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 107615, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 107713, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 107811, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 107909, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 108000, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 108091, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 108189, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 108287, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 108385, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 108476, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 108567, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 108665, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 108763, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 108861, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 108959, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 109057, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 109148, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 109239, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 109337, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 109435, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 109533, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 109617, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 109701, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 109785, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 109876, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 109967, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 110058, .adv_w = 224, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 110136, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 110227, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 110318, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 110403, .adv_w = 224, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 110487, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 110578, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 110669, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 110760, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 110851, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 110942, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 111033, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 111124, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 111215, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 111313, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 111411, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 111509, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 111600, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 111698, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 111796, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 111894, .adv_w = 224, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 111972, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 112070, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 112161, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 112246, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 112344, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 112442, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 112533, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 112631, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 112729, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 112827, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 112925, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 113023, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 113121, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 113212, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 113303, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 113401, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 113499, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 113597, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 113695, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 113793, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 113891, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 113989, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 114087, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 114185, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 114283, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 114381, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 114479, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 114570, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 114668, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 114766, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 114864, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 114962, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 115060, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 115158, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 115256, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 115354, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 115452, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 115550, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 115648, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 115746, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 115837, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 115935, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 116026, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 116124, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 116222, .adv_w = 224, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 116313, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 116411, .adv_w = 224, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 116496, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 116594, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 116692, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 116790, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 116888, .adv_w = 224, .box_w = 15, .box_h = 15, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 117001, .adv_w = 224, .box_w = 14, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 117078, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 117169, .adv_w = 224, .box_w = 14, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 117246, .adv_w = 154, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 117301, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 117406, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 117511, .adv_w = 252, .box_w = 16, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 117615, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 117720, .adv_w = 252, .box_w = 16, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 117808, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 117913, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 117955, .adv_w = 168, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 118021, .adv_w = 252, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 118133, .adv_w = 224, .box_w = 14, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 118210, .adv_w = 154, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 118285, .adv_w = 196, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 118355, .adv_w = 196, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 118453, .adv_w = 196, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 118538, .adv_w = 196, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 118623, .adv_w = 196, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 118693, .adv_w = 196, .box_w = 14, .box_h = 13, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 118784, .adv_w = 140, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 118843, .adv_w = 140, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 118902, .adv_w = 196, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 118987, .adv_w = 196, .box_w = 13, .box_h = 4, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 119013, .adv_w = 252, .box_w = 16, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 119101, .adv_w = 280, .box_w = 18, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 119236, .adv_w = 252, .box_w = 17, .box_h = 15, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 119364, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 119455, .adv_w = 196, .box_w = 13, .box_h = 8, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 119507, .adv_w = 196, .box_w = 13, .box_h = 8, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 119559, .adv_w = 280, .box_w = 18, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 119658, .adv_w = 224, .box_w = 14, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 119735, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 119840, .adv_w = 224, .box_w = 15, .box_h = 15, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 119953, .adv_w = 196, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 120038, .adv_w = 196, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 120136, .adv_w = 196, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 120221, .adv_w = 196, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 120299, .adv_w = 224, .box_w = 14, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 120376, .adv_w = 140, .box_w = 10, .box_h = 15, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 120451, .adv_w = 196, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 120549, .adv_w = 196, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 120647, .adv_w = 252, .box_w = 16, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 120735, .adv_w = 224, .box_w = 16, .box_h = 15, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 120855, .adv_w = 168, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 120938, .adv_w = 280, .box_w = 18, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 121055, .adv_w = 280, .box_w = 18, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 121145, .adv_w = 280, .box_w = 18, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 121235, .adv_w = 280, .box_w = 18, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 121325, .adv_w = 280, .box_w = 18, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 121415, .adv_w = 280, .box_w = 18, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 121505, .adv_w = 280, .box_w = 18, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 121613, .adv_w = 196, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 121703, .adv_w = 196, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 121801, .adv_w = 224, .box_w = 15, .box_h = 15, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 121914, .adv_w = 280, .box_w = 18, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 122013, .adv_w = 168, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 122096, .adv_w = 225, .box_w = 15, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 122171, .adv_w = 224, .box_w = 5, .box_h = 12, .ofs_x = 7, .ofs_y = -1},
+    {.bitmap_index = 122201, .adv_w = 224, .box_w = 5, .box_h = 12, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 122231, .adv_w = 224, .box_w = 3, .box_h = 5, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 122239, .adv_w = 224, .box_w = 6, .box_h = 10, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 122269, .adv_w = 224, .box_w = 6, .box_h = 11, .ofs_x = 4, .ofs_y = 0}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_1[] = {
+    0x0, 0x1, 0x4, 0xb, 0xc, 0x40, 0x41, 0x42,
+    0x43, 0x45, 0x46, 0x47
+};
+
+static const uint8_t glyph_id_ofs_list_4[] = {
+    0, 0, 0, 1, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3, 4, 5, 6, 0, 7,
+    8, 9, 0, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22,
+    23, 24, 25, 26, 27, 28, 29, 0,
+    30, 31, 32, 0, 33, 34, 0, 35,
+    36, 37, 38, 39, 40, 0, 41, 42,
+    43, 44, 45, 46, 47, 48, 49, 50,
+    51, 0, 52, 53, 54, 55, 56, 57,
+    58, 59, 60, 61, 62, 63, 64, 0,
+    65, 66, 67, 68, 69, 70, 71
+};
+
+static const uint16_t unicode_list_5[] = {
+    0x0, 0x4, 0x7, 0xd, 0x1d11, 0x1d14, 0x1d18, 0x1d19,
+    0x1d1a, 0x1d1b, 0x1d1c, 0x1d1e, 0x1d24, 0x1d25, 0x1d27, 0x1d32,
+    0x1d37, 0x1d3e, 0x1d4c, 0x1d56, 0x1d5c, 0x1d5f, 0x1d60, 0x1d68,
+    0x1d6e, 0x1d70, 0x1d97, 0x1d99, 0x1d9a, 0x1d9c, 0x1d9d, 0x1da5,
+    0x1dac, 0x1db2, 0x1db5, 0x1db7, 0x1dbd, 0x1dcb, 0x1dd1, 0x1ddb,
+    0x1ddc, 0x1dde, 0x1de6, 0x1de7, 0x1de9, 0x1df4, 0x1df5, 0x1df6,
+    0x1dff, 0x1e07, 0x1e0c, 0x1e0e, 0x1e12, 0x1e1b, 0x1e22, 0x1e2b,
+    0x1e2e, 0x1e49, 0x1e4d, 0x1e57, 0x1e5e, 0x1e5f, 0x1e60, 0x1e64,
+    0x1e66, 0x1e6a, 0x1e6d, 0x1e71, 0x1e90, 0x1e97, 0x1e9c, 0x1eac,
+    0x1eae, 0x1eb2, 0x1ed0, 0x1ed3, 0x1eee, 0x1ef2, 0x1eff, 0x1f1c,
+    0x1f22, 0x1f2a, 0x1f30, 0x1f35, 0x1f4d, 0x1f6b, 0x1f6d, 0x1f76,
+    0x1f85, 0x1faa, 0x1fc4, 0x1fd6, 0x1fde, 0x1fe0, 0x1fe6, 0x200a,
+    0x2015, 0x203b, 0x2050, 0x2054, 0x2055, 0x2056, 0x2059, 0x205a,
+    0x205c, 0x205e, 0x2063, 0x206b, 0x2076, 0x2078, 0x2079, 0x207a,
+    0x207c, 0x207d, 0x207e, 0x2082, 0x2087, 0x2088, 0x2096, 0x2097,
+    0x209b, 0x209e, 0x20aa, 0x20ac, 0x20bd, 0x20c8, 0x20de, 0x20ee,
+    0x20f7, 0x210b, 0x2117, 0x2118, 0x211b, 0x2128, 0x212e, 0x2135,
+    0x2136, 0x213a, 0x2141, 0x2147, 0x2149, 0x214c, 0x2158, 0x215b,
+    0x215e, 0x216c, 0x2183, 0x2186, 0x2194, 0x21ac, 0x21b0, 0x21b1,
+    0x21b9, 0x21ba, 0x21bb, 0x21c4, 0x21da, 0x21e6, 0x21ea, 0x21ee,
+    0x21f5, 0x2206, 0x2216, 0x2227, 0x2228, 0x224c, 0x2251, 0x2252,
+    0x2254, 0x2259, 0x225b, 0x2263, 0x2265, 0x2268, 0x2269, 0x2282,
+    0x2284, 0x228c, 0x22ab, 0x22b0, 0x22c4, 0x22cc, 0x22d3, 0x22d4,
+    0x22d9, 0x22db, 0x22dc, 0x22de, 0x22e7, 0x22e8, 0x22f4, 0x22f5,
+    0x22f6, 0x22f7, 0x22fb, 0x22fc, 0x2300, 0x2301, 0x2303, 0x2304,
+    0x2308, 0x2309, 0x2314, 0x2315, 0x2319, 0x231d, 0x231e, 0x2322,
+    0x2337, 0x2338, 0x2351, 0x235b, 0x2373, 0x2379, 0x2384, 0x238d,
+    0x238e, 0x239d, 0x23c3, 0x23d2, 0x23f2, 0x23fb, 0x2457, 0x245b,
+    0x2460, 0x2477, 0x2495, 0x249a, 0x24ad, 0x24ae, 0x24bf, 0x24c7,
+    0x24df, 0x2500, 0x252c, 0x25c5, 0x25ec, 0x25ef, 0x25f1, 0x2601,
+    0x2604, 0x260e, 0x261c, 0x261e, 0x2623, 0x2629, 0x2630, 0x2634,
+    0x2639, 0x2641, 0x2658, 0x265b, 0x2661, 0x269c, 0x26f0, 0x2708,
+    0x270b, 0x2742, 0x2745, 0x275b, 0x277a, 0x2794, 0x27a8, 0x27af,
+    0x27db, 0x27e4, 0x27fc, 0x2801, 0x2803, 0x281a, 0x2820, 0x2826,
+    0x2827, 0x282b, 0x282d, 0x2831, 0x2838, 0x283a, 0x283b, 0x283c,
+    0x283f, 0x2842, 0x2858, 0x2862, 0x2868, 0x2884, 0x288a, 0x288e,
+    0x2893, 0x2898, 0x28c4, 0x28ca, 0x28cc, 0x28da, 0x28dc, 0x28e1,
+    0x28e5, 0x2929, 0x296b, 0x2977, 0x29a3, 0x29ce, 0x29dd, 0x2a1a,
+    0x2a61, 0x2a68, 0x2a69, 0x2a74, 0x2a77, 0x2a7a, 0x2a7c, 0x2a89,
+    0x2a94, 0x2a96, 0x2a98, 0x2a99, 0x2a9a, 0x2a9d, 0x2aa9, 0x2aaa,
+    0x2aab, 0x2aaf, 0x2ab0, 0x2ab3, 0x2ab5, 0x2ac4, 0x2ac6, 0x2ac7,
+    0x2aca, 0x2ad0, 0x2ad5, 0x2ad7, 0x2add, 0x2ae3, 0x2aee, 0x2af0,
+    0x2af7, 0x2afc, 0x2b0b, 0x2b0f, 0x2b15, 0x2b18, 0x2b19, 0x2b1e,
+    0x2b1f, 0x2b20, 0x2b22, 0x2b2b, 0x2b35, 0x2b42, 0x2b4b, 0x2b51,
+    0x2b56, 0x2b5b, 0x2b5c, 0x2b66, 0x2b76, 0x2b7d, 0x2b82, 0x2c07,
+    0x2c5d, 0x2cee, 0x2cef, 0x2cf6, 0x2cf7, 0x2cff, 0x2d02, 0x2d03,
+    0x2d13, 0x2d14, 0x2d19, 0x2d1d, 0x2d3c, 0x2d3e, 0x2d40, 0x2d41,
+    0x2d44, 0x2d47, 0x2d49, 0x2d56, 0x2d84, 0x2d85, 0x2d89, 0x2d8f,
+    0x2d94, 0x2d97, 0x2da6, 0x2da8, 0x2dad, 0x2db7, 0x2db8, 0x2dbc,
+    0x2dbe, 0x2dc8, 0x2df1, 0x2e0b, 0x2e10, 0x2e20, 0x2e26, 0x2e30,
+    0x2e42, 0x2e46, 0x2e48, 0x2e64, 0x2e73, 0x2e82, 0x2e8a, 0x2e8d,
+    0x2e91, 0x2e96, 0x2e99, 0x2e9c, 0x2e9d, 0x2ea3, 0x2ea4, 0x2ea8,
+    0x2eaf, 0x2eb2, 0x2eba, 0x2ed4, 0x2ed6, 0x2ee9, 0x2eea, 0x2efc,
+    0x2f06, 0x2f1f, 0x2f23, 0x2f26, 0x2f2e, 0x2f36, 0x2f38, 0x2f80,
+    0x2fb9, 0x2fbb, 0x2fc3, 0x2fd6, 0x3004, 0x3019, 0x3020, 0x302b,
+    0x302c, 0x3030, 0x305c, 0x3074, 0x3078, 0x307f, 0x30da, 0x3109,
+    0x3121, 0x3122, 0x3127, 0x3137, 0x3141, 0x314c, 0x3150, 0x3151,
+    0x315c, 0x315e, 0x3164, 0x3166, 0x318f, 0x3191, 0x319b, 0x31a6,
+    0x31cd, 0x31d6, 0x31da, 0x31ec, 0x31f2, 0x31fd, 0x31fe, 0x3210,
+    0x3212, 0x3218, 0x322a, 0x3266, 0x3279, 0x3299, 0x32a3, 0x32ac,
+    0x32b2, 0x32b3, 0x32b6, 0x32b8, 0x32b9, 0x32e0, 0x32e1, 0x32ec,
+    0x32ff, 0x330b, 0x334b, 0x33d2, 0x33d8, 0x33e5, 0x33eb, 0x3440,
+    0x344a, 0x344f, 0x3450, 0x3456, 0x3459, 0x3468, 0x346a, 0x3473,
+    0x3481, 0x3485, 0x3498, 0x34aa, 0x34be, 0x34c1, 0x34c8, 0x34ca,
+    0x34cd, 0x34ce, 0x34d2, 0x34d6, 0x34e0, 0x34f3, 0x34f6, 0x34f7,
+    0x34fa, 0x3507, 0x3518, 0x351f, 0x3524, 0x3525, 0x3530, 0x3531,
+    0x3536, 0x3539, 0x3540, 0x354d, 0x3553, 0x357a, 0x357f, 0x3580,
+    0x3585, 0x358b, 0x3598, 0x35a2, 0x35a7, 0x35a8, 0x35d8, 0x35ed,
+    0x3603, 0x3605, 0x3609, 0x360f, 0x3610, 0x3611, 0x3614, 0x3619,
+    0x361a, 0x361c, 0x361e, 0x362c, 0x362e, 0x3630, 0x3639, 0x363b,
+    0x363c, 0x363d, 0x363e, 0x364b, 0x3661, 0x3662, 0x3670, 0x3672,
+    0x3676, 0x3680, 0x3682, 0x36a1, 0x36a8, 0x36ad, 0x36e1, 0x36f6,
+    0x3702, 0x370c, 0x3710, 0x3722, 0x3732, 0x373b, 0x374a, 0x374d,
+    0x3754, 0x3759, 0x37ae, 0x37c1, 0x37ff, 0x381e, 0x382d, 0x386b,
+    0x387e, 0x3886, 0x388e, 0x3893, 0x38dc, 0x38e9, 0x3913, 0x392a,
+    0x3932, 0x3934, 0x393b, 0x394a, 0x395c, 0x3970, 0x3a32, 0x3a43,
+    0x3a5d, 0x3a61, 0x3a72, 0x3a73, 0x3a74, 0x3a75, 0x3a76, 0x3a7a,
+    0x3a80, 0x3a83, 0x3a84, 0x3a88, 0x3a8c, 0x3a9b, 0x3a9c, 0x3ac6,
+    0x3ade, 0x3adf, 0x3ae0, 0x3ae5, 0x3aec, 0x3b20, 0x3b22, 0x3b25,
+    0x3b28, 0x3b45, 0x3b48, 0x3b49, 0x3b53, 0x3b6b, 0x3b71, 0x3b8b,
+    0x3b99, 0x3ba3, 0x3bca, 0x3bcc, 0x3bd2, 0x3bdb, 0x3be6, 0x3bf3,
+    0x3bf4, 0x3bf9, 0x3c04, 0x3c1c, 0x3c28, 0x3c43, 0x3c4c, 0x3c4f,
+    0x3c52, 0x3c56, 0x3c85, 0x3c88, 0x3c99, 0x3ccd, 0x3d02, 0x3d08,
+    0x3d16, 0x3d18, 0x3d19, 0x3d1a, 0x3d2c, 0x3d32, 0x3d3a, 0x3d40,
+    0x3d67, 0x3da1, 0x3da7, 0x3dae, 0x3e10, 0x3e33, 0x3e49, 0x3ed4,
+    0x3ef0, 0x3f74, 0x3f7c, 0x3f8e, 0x3fca, 0x3fcb, 0x4032, 0x4047,
+    0x406a, 0x40c2, 0x40f0, 0x413e, 0x4147, 0x4149, 0x4158, 0x416c,
+    0x4171, 0x417a, 0x418a, 0x41bd, 0x41c0, 0x41c7, 0x41d1, 0x41fd,
+    0x41fe, 0x423c, 0x4250, 0x4283, 0x42ba, 0x430f, 0x4314, 0x4317,
+    0x43c1, 0x4429, 0x442b, 0x4430, 0x4433, 0x4434, 0x4439, 0x4441,
+    0x4442, 0x4444, 0x4446, 0x4448, 0x444b, 0x444c, 0x445d, 0x446a,
+    0x447b, 0x447c, 0x4481, 0x4487, 0x44c3, 0x44d6, 0x44ec, 0x458b,
+    0x458d, 0x458e, 0x458f, 0x4595, 0x4597, 0x45d0, 0x45e8, 0x45ff,
+    0x4605, 0x4609, 0x461c, 0x4630, 0x4631, 0x464f, 0x4651, 0x46f6,
+    0x46fe, 0x4704, 0x4713, 0x4725, 0x4745, 0x47cb, 0x484b, 0x484d,
+    0x484f, 0x4867, 0x486e, 0x486f, 0x487e, 0x4892, 0x48d1, 0x48d2,
+    0x48dc, 0x48de, 0x48e2, 0x48e9, 0x490c, 0x491c, 0x493f, 0x495e,
+    0x4987, 0x498b, 0x49a4, 0x49dc, 0x49ea, 0x49f6, 0x4a00, 0x4a22,
+    0x4a37, 0x4a3d, 0x4a57, 0x4a5a, 0x4a65, 0x4a67, 0x4aa8, 0x4ab2,
+    0x4ad1, 0x4ad5, 0x4b32, 0x4b84, 0x4bcf, 0x4be7, 0x4c0c, 0x4c11,
+    0x4c15, 0x4c2a, 0x4c31, 0x4c41, 0x4c4a, 0x4c53, 0x4c55, 0x4c5d,
+    0x4c61, 0x4c72, 0x4c77, 0x4c82, 0x4c86, 0x4ca4, 0x4cab, 0x4cbe,
+    0x4cc3, 0x4ce2, 0x4ce3, 0x4ceb, 0x4cf1, 0x4cfa, 0x4d05, 0x4d4e,
+    0x4d4f, 0x4d65, 0x4d81, 0x4d8d, 0x4d9d, 0x4df0, 0x4e4b, 0x4e7f,
+    0x4e9f, 0x4eba, 0x4ee3, 0x4f12, 0x4f14, 0x4f16, 0x4f1d, 0x4f44,
+    0x4f6f, 0x4f80, 0x4f83, 0x4f88, 0x4f8e, 0x4f9a, 0x4fba, 0x4fc0,
+    0x4fc3, 0x4fdd, 0x5009, 0x500e, 0x5042, 0x505b, 0x5066, 0x5077,
+    0x5081, 0x50ae, 0x50da, 0x50fb, 0x5104, 0x510b, 0x5118, 0x5119,
+    0x511a, 0x513b, 0x513d, 0x514a, 0x5180, 0x5183, 0x5193, 0x51c2,
+    0x51f6, 0x51f7, 0x5202, 0x5247, 0x5288, 0x52e4, 0x52ed, 0x534e,
+    0x535a, 0x5368, 0x5446, 0x5495, 0x54bd, 0x54ee, 0x5518, 0x5566,
+    0x575d, 0x5764, 0x5779, 0x57bc, 0x57e0, 0x57ed, 0x57f2, 0x580e,
+    0x5818, 0x5890, 0x5892, 0x589c, 0x58a0, 0x58a7, 0x58ab, 0x58bb,
+    0x58cb, 0x58d1, 0x58e3, 0x58f4, 0x58f7, 0x5911, 0x5919, 0x591b,
+    0x591f, 0x5924, 0x5929, 0x593b, 0x593e, 0x5942, 0x5944, 0x5945,
+    0x5966, 0x5977, 0x5982, 0x5983, 0x5984, 0x599d, 0x599e, 0x59a6,
+    0x59a9, 0x59af, 0x59bb, 0x59bd, 0x59be, 0x59c1, 0x59c3, 0x59d0,
+    0x59d8, 0x59dc, 0x59e7, 0x5a09, 0x5a13, 0x5a2c, 0x5a2e, 0x5a69,
+    0x5a81, 0x5a88, 0x5a9b, 0x5aa4, 0x5ab2, 0x5aef, 0x5b61, 0x5b72,
+    0x5bb1, 0x5bb2, 0x5bb8, 0x5bba, 0x5bbd, 0x5bc8, 0x5bc9, 0x5bcc,
+    0x5bd0, 0x5bd4, 0x5bd8, 0x5bfb, 0x5c0e, 0x5c4a, 0x5c75, 0x5c81,
+    0x5c88, 0x5c96, 0x5c9b, 0x5cb4, 0x5cc4, 0x5cf0, 0x5d00, 0x5dbc,
+    0x5ddb, 0x5df0, 0x5df3, 0x5e0e, 0x5e14, 0x5e1a, 0x5e26, 0x5e3b,
+    0x5e49, 0x5eac, 0x5eaf, 0x5eb7, 0x5ec3, 0x5ecb, 0x5ecd, 0x5edf,
+    0x5ee2, 0x5ee5, 0x5efc, 0x5f0e, 0x5f11, 0x5f12, 0x5f14, 0x5f20,
+    0x5f21, 0x5f2a, 0x5f2b, 0x5f30, 0x5f31, 0x5f34, 0x5f3f, 0x5f42,
+    0x5f43, 0x5f56, 0x5f5b, 0x5f5c, 0x5f5f, 0x5f64, 0x5f65, 0x5f66,
+    0x5f71, 0x5f7a, 0x5f89, 0x5f90, 0x5f95, 0x5f9b, 0x5fb4, 0x5fbb,
+    0x5ff9, 0x6006, 0x600e, 0x605e, 0x6063, 0x6065, 0x6089, 0x60bc,
+    0x60de, 0x60df, 0x60e0, 0x60e2, 0x60ee, 0x6155, 0x616c, 0x6191,
+    0x6233, 0x6240, 0x6243, 0x6488, 0x649a, 0x649c, 0x64a4, 0x64b3,
+    0x64ed, 0x6501, 0x6544, 0x6555, 0x655e, 0x6561, 0x6573, 0x6575,
+    0x6589, 0x658e, 0x659f, 0x65ac, 0x65ad, 0x65b4, 0x65b9, 0x65cc,
+    0x65d7, 0x65e2, 0x65e7, 0x65ea, 0x65f3, 0x65f4, 0x65f9, 0x65fb,
+    0x6603, 0x660c, 0x6611, 0x6618, 0x6663, 0x666a, 0x666f, 0x6673,
+    0x667a, 0x6685, 0x6704, 0x6710, 0x6714, 0x6716, 0x6719, 0x6728,
+    0x6729, 0x673e, 0x674d, 0x675d, 0x6765, 0x6769, 0x676f, 0x6780,
+    0x67b9, 0x67ec, 0x67f0, 0x6800, 0x6803, 0x6839, 0x68a7, 0x68aa,
+    0x68d5, 0x68d6, 0x6923, 0x6924, 0x6968, 0x69e5, 0x69e9, 0x69fb,
+    0x6a6b, 0x6bf6, 0x6da8, 0x6dcd, 0x6dd5, 0x6de3, 0x6def, 0x6df9,
+    0x6e24, 0x6e4c, 0xbf12, 0xbf19, 0xbf1c, 0xbf1d, 0xbf1e, 0xbf22,
+    0xbf24, 0xbf26, 0xbf2a, 0xbf2d, 0xbf32, 0xbf37, 0xbf38, 0xbf39,
+    0xbf4f, 0xbf54, 0xbf59, 0xbf5c, 0xbf5d, 0xbf5e, 0xbf62, 0xbf63,
+    0xbf64, 0xbf65, 0xbf78, 0xbf79, 0xbf7f, 0xbf81, 0xbf82, 0xbf85,
+    0xbf88, 0xbf89, 0xbf8a, 0xbf8c, 0xbfa4, 0xbfa6, 0xbfd5, 0xbfd6,
+    0xbfd8, 0xbfda, 0xbff1, 0xbff8, 0xbffb, 0xc004, 0xc02d, 0xc035,
+    0xc06c, 0xc0fc, 0xc151, 0xc152, 0xc153, 0xc154, 0xc155, 0xc198,
+    0xc1a4, 0xc1fe, 0xc215, 0xc46b, 0xc6d3, 0xc7b3, 0xce19, 0xce1a,
+    0xce1d, 0xce22, 0xce23
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 96, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 12289, .range_length = 72, .glyph_id_start = 97,
+        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 12, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    },
+    {
+        .range_start = 12362, .range_length = 24, .glyph_id_start = 109,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 12387, .range_length = 43, .glyph_id_start = 133,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 12431, .range_length = 95, .glyph_id_start = 176,
+        .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_4, .list_length = 95, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL
+    },
+    {
+        .range_start = 12527, .range_length = 52772, .glyph_id_start = 248,
+        .unicode_list = unicode_list_5, .glyph_id_ofs_list = NULL, .list_length = 1187, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+#if LVGL_VERSION_MAJOR >= 8
+/*Store all the custom data of the font*/
+
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+#else
+static lv_font_fmt_txt_dsc_t font_dsc = {
+#endif
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 0,
+    .cmap_num = 6,
+    .bpp = 4,
+    .kern_classes = 0,
+    .bitmap_format = 0,
+
+};
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+#if LVGL_VERSION_MAJOR >= 8
+const lv_font_t lv_font_simsun_14_cjk = {
+#else
+lv_font_t lv_font_simsun_14_cjk = {
+#endif
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 15,          /*The maximum line height required by the font*/
+    .base_line = 2,             /*Baseline measured from the bottom of the line*/
+#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
+    .subpx = LV_FONT_SUBPX_NONE,
+#endif
+#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
+    .underline_position = -2,
+    .underline_thickness = 1,
+#endif
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+};
+
+#endif /*#if LV_FONT_SIMSUN_14_CJK*/
@@ -0,0 +1,15 @@
+/*
+ * Autogenerated by the Meson build system.
+ * Do not edit, your changes will be lost.
+ */
+
+#pragma once
+
+#define THORVG_SW_RASTER_SUPPORT 1
+
+#define THORVG_SVG_LOADER_SUPPORT LV_USE_LOTTIE
+
+#define THORVG_LOTTIE_LOADER_SUPPORT LV_USE_LOTTIE
+
+#define THORVG_VERSION_STRING "0.13.5"
+